@@ -1,6 +1,7 @@
 COMMON_SRC = \
             build/build_config.c \
             build/debug.c \
+            build/timings.c \
             build/version.c \
             $(TARGET_DIR_SRC) \
             main.c \
@@ -158,6 +159,7 @@ COMMON_SRC = \
             sensors/barometer.c \
             sensors/rangefinder.c \
             telemetry/telemetry.c \
+            telemetry/telemetry_scheduler.c \
             telemetry/crsf.c \
             telemetry/srxl.c \
             telemetry/frsky_hub.c \
@@ -192,6 +194,7 @@ SIZE_OPTIMISED_SRC  := ""
 
 ifneq ($(TARGET),$(filter $(TARGET),$(F1_TARGETS)))
 SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
+            build/timings.c \
             common/encoding.c \
             common/filter.c \
             common/maths.c \
@@ -0,0 +1,12290 @@
+# 0 "./src/main/blackbox/blackbox.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/blackbox/blackbox.c"
+# 21 "./src/main/blackbox/blackbox.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "./src/main/blackbox/blackbox.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 23 "./src/main/blackbox/blackbox.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 24 "./src/main/blackbox/blackbox.c" 2
+# 1 "/usr/include/math.h" 1 3 4
+# 27 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 2 3 4
+# 41 "/usr/include/math.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 44 "/usr/include/math.h" 2 3 4
+# 152 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 1 3 4
+# 153 "/usr/include/math.h" 2 3 4
+# 163 "/usr/include/math.h" 3 4
+typedef float float_t;
+typedef double double_t;
+# 204 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 1 3 4
+# 205 "/usr/include/math.h" 2 3 4
+# 247 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h" 1 3 4
+# 248 "/usr/include/math.h" 2 3 4
+
+
+
+enum
+  {
+    FP_INT_UPWARD =
+
+      0,
+    FP_INT_DOWNWARD =
+
+      1,
+    FP_INT_TOWARDZERO =
+
+      2,
+    FP_INT_TONEARESTFROMZERO =
+
+      3,
+    FP_INT_TONEAREST =
+
+      4,
+  };
+# 312 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsig (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignaling (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 313 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+__attribute__ ((__simd__ ("notinbranch"))) extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern void sincos (double __x, double *__sinx, double *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincos (double __x, double *__sinx, double *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double exp10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
+__attribute__ ((__simd__ ("notinbranch"))) extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double nextdown (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextdown (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nextup (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextup (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double roundeven (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __roundeven (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalize (double *__cx, const double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double fmaxmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaxmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double fmaximum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorder (const double *__x, const double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermag (const double *__x, const double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern double getpayload (const double *__x) __attribute__ ((__nothrow__ , __leaf__)); extern double __getpayload (const double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayload (double *__x, double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsig (double *__x, double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 314 "/usr/include/math.h" 2 3 4
+# 329 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 330 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+__attribute__ ((__simd__ ("notinbranch"))) extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern void sincosf (float __x, float *__sinx, float *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf (float __x, float *__sinx, float *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float exp10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
+__attribute__ ((__simd__ ("notinbranch"))) extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float nextdownf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextdownf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nextupf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextupf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float roundevenf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundevenf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef (float *__cx, const float *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float fmaxmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float fmaximumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf (const float *__x, const float *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf (const float *__x, const float *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern float getpayloadf (const float *__x) __attribute__ ((__nothrow__ , __leaf__)); extern float __getpayloadf (const float *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf (float *__x, float __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf (float *__x, float __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
+# 331 "/usr/include/math.h" 2 3 4
+# 398 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 399 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosl (long double __x, long double *__sinx, long double *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosl (long double __x, long double *__sinx, long double *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern long double exp10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
+ extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double nextdownl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextdownl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nextupl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextupl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double roundevenl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundevenl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizel (long double *__cx, const long double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double fmaxmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double fmaximuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderl (const long double *__x, const long double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagl (const long double *__x, const long double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern long double getpayloadl (const long double *__x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __getpayloadl (const long double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadl (long double *__x, long double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigl (long double *__x, long double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 400 "/usr/include/math.h" 2 3 4
+# 450 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float32 acosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __acosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 asinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __asinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atan2f32 (_Float32 __y, _Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atan2f32 (_Float32 __y, _Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 cosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __cosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 sinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 tanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 coshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __coshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 sinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 tanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf32 (_Float32 __x, _Float32 *__sinx, _Float32 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf32 (_Float32 __x, _Float32 *__sinx, _Float32 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float32 acoshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __acoshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 asinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __asinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32 expf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __expf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 frexpf32 (_Float32 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __frexpf32 (_Float32 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 ldexpf32 (_Float32 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __ldexpf32 (_Float32 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 logf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __logf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 modff32 (_Float32 __x, _Float32 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __modff32 (_Float32 __x, _Float32 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float32 exp10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __exp10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 expm1f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __expm1f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log1pf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log1pf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 logbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __logbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 exp2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __exp2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float32 powf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __powf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 sqrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sqrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float32 hypotf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __hypotf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 cbrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __cbrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 ceilf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __ceilf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fabsf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fabsf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 floorf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __floorf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmodf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fmodf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 copysignf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __copysignf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 nanf32 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nanf32 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 j0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __j0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 j1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __j1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 jnf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __jnf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 y0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __y0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 y1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __y1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 ynf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __ynf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32 erff32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __erff32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float32 erfcf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __erfcf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 lgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __lgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 tgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 lgammaf32_r (_Float32, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __lgammaf32_r (_Float32, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 rintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __rintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 nextafterf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextafterf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 nextdownf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextdownf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float32 nextupf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextupf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 remainderf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __remainderf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 scalbnf32 (_Float32 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __scalbnf32 (_Float32 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 scalblnf32 (_Float32 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __scalblnf32 (_Float32 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 nearbyintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nearbyintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 roundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __roundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32 truncf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __truncf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 remquof32 (_Float32 __x, _Float32 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __remquof32 (_Float32 __x, _Float32 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 fdimf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fdimf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 fmaxf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaxf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32 fmaf32 (_Float32 __x, _Float32 __y, _Float32 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fmaf32 (_Float32 __x, _Float32 __y, _Float32 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 roundevenf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __roundevenf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef32 (_Float32 *__cx, const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 fmaxmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaxmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 fmaximumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf32 (const _Float32 *__x, const _Float32 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf32 (const _Float32 *__x, const _Float32 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float32 getpayloadf32 (const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __getpayloadf32 (const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf32 (_Float32 *__x, _Float32 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf32 (_Float32 *__x, _Float32 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 451 "/usr/include/math.h" 2 3 4
+# 467 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float64 acosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __acosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 asinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __asinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atan2f64 (_Float64 __y, _Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atan2f64 (_Float64 __y, _Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 cosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __cosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 sinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 tanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 coshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __coshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 sinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 tanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf64 (_Float64 __x, _Float64 *__sinx, _Float64 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf64 (_Float64 __x, _Float64 *__sinx, _Float64 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float64 acoshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __acoshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 asinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __asinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64 expf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __expf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 frexpf64 (_Float64 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __frexpf64 (_Float64 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 ldexpf64 (_Float64 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __ldexpf64 (_Float64 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 logf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __logf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 modff64 (_Float64 __x, _Float64 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __modff64 (_Float64 __x, _Float64 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float64 exp10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __exp10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 expm1f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __expm1f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log1pf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log1pf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 logbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __logbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 exp2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __exp2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float64 powf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __powf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float64 hypotf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __hypotf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 cbrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __cbrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 ceilf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __ceilf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fabsf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fabsf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 floorf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __floorf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmodf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fmodf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 copysignf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __copysignf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 nanf64 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nanf64 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 j0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __j0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 j1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __j1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 jnf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __jnf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 y0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __y0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 y1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __y1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 ynf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __ynf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64 erff64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __erff64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float64 erfcf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __erfcf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 lgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __lgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 tgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 lgammaf64_r (_Float64, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __lgammaf64_r (_Float64, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 rintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __rintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 nextafterf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextafterf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 nextdownf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextdownf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float64 nextupf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextupf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 remainderf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __remainderf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 scalbnf64 (_Float64 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __scalbnf64 (_Float64 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 scalblnf64 (_Float64 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __scalblnf64 (_Float64 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 nearbyintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nearbyintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 roundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __roundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64 truncf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __truncf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 remquof64 (_Float64 __x, _Float64 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __remquof64 (_Float64 __x, _Float64 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 fdimf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fdimf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 fmaxf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaxf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64 fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 roundevenf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __roundevenf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef64 (_Float64 *__cx, const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 fmaxmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaxmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 fmaximumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf64 (const _Float64 *__x, const _Float64 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf64 (const _Float64 *__x, const _Float64 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float64 getpayloadf64 (const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __getpayloadf64 (const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf64 (_Float64 *__x, _Float64 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf64 (_Float64 *__x, _Float64 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 468 "/usr/include/math.h" 2 3 4
+# 481 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 482 "/usr/include/math.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float128 acosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __acosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 asinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __asinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atan2f128 (_Float128 __y, _Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atan2f128 (_Float128 __y, _Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 cosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __cosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 sinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 tanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 coshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __coshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 sinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 tanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf128 (_Float128 __x, _Float128 *__sinx, _Float128 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf128 (_Float128 __x, _Float128 *__sinx, _Float128 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float128 acoshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __acoshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 asinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __asinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float128 expf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __expf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 frexpf128 (_Float128 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __frexpf128 (_Float128 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 ldexpf128 (_Float128 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __ldexpf128 (_Float128 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 logf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __logf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 modff128 (_Float128 __x, _Float128 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __modff128 (_Float128 __x, _Float128 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float128 exp10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __exp10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 expm1f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __expm1f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log1pf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log1pf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 logbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __logbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 exp2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __exp2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float128 powf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __powf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float128 hypotf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __hypotf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 cbrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __cbrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 ceilf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __ceilf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fabsf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fabsf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 floorf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __floorf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmodf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fmodf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 copysignf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __copysignf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 nanf128 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nanf128 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 j0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __j0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 j1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __j1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 jnf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __jnf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 y0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __y0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 y1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __y1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 ynf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __ynf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float128 erff128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __erff128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float128 erfcf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __erfcf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 lgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __lgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 tgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 lgammaf128_r (_Float128, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __lgammaf128_r (_Float128, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 rintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __rintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 nextafterf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextafterf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 nextdownf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextdownf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float128 nextupf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextupf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 remainderf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __remainderf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 scalbnf128 (_Float128 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __scalbnf128 (_Float128 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 scalblnf128 (_Float128 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __scalblnf128 (_Float128 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 nearbyintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nearbyintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 roundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __roundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float128 truncf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __truncf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 remquof128 (_Float128 __x, _Float128 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __remquof128 (_Float128 __x, _Float128 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 fdimf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fdimf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 fmaxf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaxf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float128 fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 roundevenf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __roundevenf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef128 (_Float128 *__cx, const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 fmaxmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaxmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 fmaximumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf128 (const _Float128 *__x, const _Float128 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf128 (const _Float128 *__x, const _Float128 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float128 getpayloadf128 (const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __getpayloadf128 (const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf128 (_Float128 *__x, _Float128 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf128 (_Float128 *__x, _Float128 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 485 "/usr/include/math.h" 2 3 4
+# 501 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float32x acosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __acosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x asinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __asinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atan2f32x (_Float32x __y, _Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atan2f32x (_Float32x __y, _Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x cosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __cosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x sinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x tanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x coshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __coshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x sinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x tanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf32x (_Float32x __x, _Float32x *__sinx, _Float32x *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf32x (_Float32x __x, _Float32x *__sinx, _Float32x *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float32x acoshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __acoshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x asinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __asinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32x expf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __expf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x frexpf32x (_Float32x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __frexpf32x (_Float32x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x ldexpf32x (_Float32x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __ldexpf32x (_Float32x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x logf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __logf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x modff32x (_Float32x __x, _Float32x *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __modff32x (_Float32x __x, _Float32x *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float32x exp10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __exp10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x expm1f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __expm1f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log1pf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log1pf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x logbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __logbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x exp2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __exp2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float32x powf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __powf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float32x hypotf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __hypotf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x cbrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __cbrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x ceilf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __ceilf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fabsf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fabsf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x floorf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __floorf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmodf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fmodf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x copysignf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __copysignf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x nanf32x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nanf32x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x j0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __j0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x j1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __j1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x jnf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __jnf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x y0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __y0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x y1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __y1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x ynf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __ynf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32x erff32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __erff32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float32x erfcf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __erfcf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x lgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __lgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x tgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x lgammaf32x_r (_Float32x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __lgammaf32x_r (_Float32x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x rintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __rintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x nextafterf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextafterf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x nextdownf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextdownf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float32x nextupf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextupf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x remainderf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __remainderf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x scalbnf32x (_Float32x __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __scalbnf32x (_Float32x __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x scalblnf32x (_Float32x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __scalblnf32x (_Float32x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x nearbyintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nearbyintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x roundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __roundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32x truncf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __truncf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x remquof32x (_Float32x __x, _Float32x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __remquof32x (_Float32x __x, _Float32x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x fdimf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fdimf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x fmaxf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaxf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32x fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x roundevenf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __roundevenf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef32x (_Float32x *__cx, const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x fmaxmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaxmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x fmaximumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf32x (const _Float32x *__x, const _Float32x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf32x (const _Float32x *__x, const _Float32x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float32x getpayloadf32x (const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __getpayloadf32x (const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf32x (_Float32x *__x, _Float32x __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf32x (_Float32x *__x, _Float32x __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 502 "/usr/include/math.h" 2 3 4
+# 518 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float64x acosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __acosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x asinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __asinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atan2f64x (_Float64x __y, _Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atan2f64x (_Float64x __y, _Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x cosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __cosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x sinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x tanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x coshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __coshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x sinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x tanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf64x (_Float64x __x, _Float64x *__sinx, _Float64x *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf64x (_Float64x __x, _Float64x *__sinx, _Float64x *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float64x acoshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __acoshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x asinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __asinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64x expf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __expf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x frexpf64x (_Float64x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __frexpf64x (_Float64x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x ldexpf64x (_Float64x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __ldexpf64x (_Float64x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x logf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __logf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x modff64x (_Float64x __x, _Float64x *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __modff64x (_Float64x __x, _Float64x *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float64x exp10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __exp10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x expm1f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __expm1f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log1pf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log1pf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x logbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __logbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x exp2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __exp2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float64x powf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __powf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float64x hypotf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __hypotf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x cbrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __cbrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x ceilf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __ceilf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fabsf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fabsf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x floorf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __floorf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmodf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fmodf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x copysignf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __copysignf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x nanf64x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nanf64x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x j0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __j0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x j1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __j1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x jnf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __jnf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x y0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __y0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x y1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __y1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x ynf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __ynf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64x erff64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __erff64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float64x erfcf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __erfcf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x lgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __lgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x tgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x lgammaf64x_r (_Float64x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __lgammaf64x_r (_Float64x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x rintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __rintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x nextafterf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextafterf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x nextdownf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextdownf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float64x nextupf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextupf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x remainderf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __remainderf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x scalbnf64x (_Float64x __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __scalbnf64x (_Float64x __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x scalblnf64x (_Float64x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __scalblnf64x (_Float64x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x nearbyintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nearbyintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x roundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __roundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64x truncf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __truncf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x remquof64x (_Float64x __x, _Float64x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __remquof64x (_Float64x __x, _Float64x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x fdimf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fdimf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x fmaxf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaxf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64x fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x roundevenf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __roundevenf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef64x (_Float64x *__cx, const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x fmaxmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaxmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x fmaximumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf64x (const _Float64x *__x, const _Float64x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf64x (const _Float64x *__x, const _Float64x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float64x getpayloadf64x (const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __getpayloadf64x (const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf64x (_Float64x *__x, _Float64x __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf64x (_Float64x *__x, _Float64x __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 519 "/usr/include/math.h" 2 3 4
+# 566 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern float fadd (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fdiv (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ffma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fmul (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsub (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 567 "/usr/include/math.h" 2 3 4
+# 587 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern float faddl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fdivl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ffmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fmull (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsubl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 588 "/usr/include/math.h" 2 3 4
+# 616 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern double daddl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ddivl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dfmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dmull (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dsqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dsubl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 617 "/usr/include/math.h" 2 3 4
+# 697 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 698 "/usr/include/math.h" 2 3 4
+# 707 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 708 "/usr/include/math.h" 2 3 4
+# 717 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 718 "/usr/include/math.h" 2 3 4
+# 727 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 728 "/usr/include/math.h" 2 3 4
+# 747 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 748 "/usr/include/math.h" 2 3 4
+# 757 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 758 "/usr/include/math.h" 2 3 4
+# 767 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 768 "/usr/include/math.h" 2 3 4
+# 787 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64 f64addf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64divf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64mulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64subf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 788 "/usr/include/math.h" 2 3 4
+# 797 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64 f64addf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64divf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64mulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64subf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 798 "/usr/include/math.h" 2 3 4
+# 817 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64x f64xaddf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xdivf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xfmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xmulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xsqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xsubf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 818 "/usr/include/math.h" 2 3 4
+# 854 "/usr/include/math.h" 3 4
+extern int signgam;
+# 934 "/usr/include/math.h" 3 4
+enum
+  {
+    FP_NAN =
+
+      0,
+    FP_INFINITE =
+
+      1,
+    FP_ZERO =
+
+      2,
+    FP_SUBNORMAL =
+
+      3,
+    FP_NORMAL =
+
+      4
+  };
+# 1054 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h" 3 4
+extern int __iscanonicall (long double __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 1055 "/usr/include/math.h" 2 3 4
+# 1471 "/usr/include/math.h" 3 4
+
+# 25 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 167 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 168 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 27 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 29 "./src/main/target/SITL/target.h" 2
+# 157 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+
+extern uint8_t eepromData[32768];
+
+
+
+
+
+
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 239 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+
+
+
+typedef struct sitlLatency_s {
+    uint32_t latencyUs;
+    uint32_t spikeUs;
+    uint32_t spikeInterval;
+    uint32_t count;
+} sitlLatency_t;
+
+void sitlLatencyInit(sitlLatency_t *latency, const char *envName);
+uint32_t sitlLatencyNext(sitlLatency_t *latency);
+# 169 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 170 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 32 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 171 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 172 "./src/main/platform.h" 2
+# 27 "./src/main/blackbox/blackbox.c" 2
+
+
+
+# 1 "./src/main/blackbox/blackbox.h" 1
+# 21 "./src/main/blackbox/blackbox.h"
+       
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 21 "./src/main/build/build_config.h"
+       
+# 25 "./src/main/blackbox/blackbox.h" 2
+# 1 "./src/main/common/time.h" 1
+# 21 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/pg/pg.h" 1
+# 21 "./src/main/pg/pg.h"
+       
+
+
+
+
+
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+# 73 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 190 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+
+# 192 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 192 "./src/main/pg/pg.h"
+    pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 196 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 196 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 29 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 83 "./src/main/common/time.h" 3 4
+_Bool 
+# 83 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 84 "./src/main/common/time.h" 3 4
+_Bool 
+# 84 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 91 "./src/main/common/time.h" 3 4
+_Bool 
+# 91 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 95 "./src/main/common/time.h" 3 4
+_Bool 
+# 95 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 96 "./src/main/common/time.h" 3 4
+_Bool 
+# 96 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 98 "./src/main/common/time.h" 3 4
+_Bool 
+# 98 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 99 "./src/main/common/time.h" 3 4
+_Bool 
+# 99 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+
+void rtcPersistWrite(int16_t offsetMinutes);
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcPersistRead(rtcTime_t *t);
+# 26 "./src/main/blackbox/blackbox.h" 2
+
+
+typedef enum BlackboxDevice {
+    BLACKBOX_DEVICE_NONE = 0,
+
+    BLACKBOX_DEVICE_FLASH = 1,
+
+
+    BLACKBOX_DEVICE_SDCARD = 2,
+
+    BLACKBOX_DEVICE_SERIAL = 3
+} BlackboxDevice_e;
+
+typedef enum BlackboxMode {
+    BLACKBOX_MODE_NORMAL = 0,
+    BLACKBOX_MODE_MOTOR_TEST,
+    BLACKBOX_MODE_ALWAYS_ON,
+    BLACKBOX_MODE_STREAM
+} BlackboxMode;
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct blackboxConfig_s {
+    uint16_t p_ratio;
+    uint8_t device;
+    uint8_t record_acc;
+    uint8_t mode;
+} blackboxConfig_t;
+
+extern blackboxConfig_t blackboxConfig_System; extern blackboxConfig_t blackboxConfig_Copy; static inline const blackboxConfig_t* blackboxConfig(void) { return &blackboxConfig_System; } static inline blackboxConfig_t* blackboxConfigMutable(void) { return &blackboxConfig_System; } struct _dummy;
+
+union flightLogEventData_u;
+void blackboxLogEvent(FlightLogEvent event, union flightLogEventData_u *data);
+
+void blackboxInit(void);
+void blackboxUpdate(timeUs_t currentTimeUs);
+void blackboxSetStartDateTime(const char *dateTime, timeMs_t timeNowMs);
+int blackboxCalculatePDenom(int rateNum, int rateDenom);
+uint8_t blackboxGetRateDenom(void);
+void blackboxValidateConfig(void);
+void blackboxFinish(void);
+
+# 73 "./src/main/blackbox/blackbox.h" 3 4
+_Bool 
+# 73 "./src/main/blackbox/blackbox.h"
+    blackboxMayEditConfig(void);
+# 31 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/blackbox/blackbox_encoding.h" 1
+# 21 "./src/main/blackbox/blackbox_encoding.h"
+       
+
+int blackboxPrintf(const char *fmt, ...);
+void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...);
+
+void blackboxWriteUnsignedVB(uint32_t value);
+void blackboxWriteSignedVB(int32_t value);
+void blackboxWriteSignedVBArray(int32_t *array, int count);
+void blackboxWriteSigned16VBArray(int16_t *array, int count);
+void blackboxWriteS16(int16_t value);
+void blackboxWriteTag2_3S32(int32_t *values);
+int blackboxWriteTag2_3SVariable(int32_t *values);
+void blackboxWriteTag8_4S16(int32_t *values);
+void blackboxWriteTag8_8SVB(int32_t *values, int valueCount);
+void blackboxWriteU32(int32_t value);
+void blackboxWriteFloat(float value);
+# 32 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/blackbox/blackbox_fielddefs.h" 1
+# 21 "./src/main/blackbox/blackbox_fielddefs.h"
+       
+
+typedef enum FlightLogFieldCondition {
+    FLIGHT_LOG_FIELD_CONDITION_ALWAYS = 0,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8,
+    FLIGHT_LOG_FIELD_CONDITION_TRICOPTER,
+
+    FLIGHT_LOG_FIELD_CONDITION_MAG,
+    FLIGHT_LOG_FIELD_CONDITION_BARO,
+    FLIGHT_LOG_FIELD_CONDITION_VBAT,
+    FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC,
+    FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER,
+    FLIGHT_LOG_FIELD_CONDITION_RSSI,
+
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2,
+
+    FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME,
+
+    FLIGHT_LOG_FIELD_CONDITION_ACC,
+    FLIGHT_LOG_FIELD_CONDITION_DEBUG,
+
+    FLIGHT_LOG_FIELD_CONDITION_NEVER,
+
+    FLIGHT_LOG_FIELD_CONDITION_FIRST = FLIGHT_LOG_FIELD_CONDITION_ALWAYS,
+    FLIGHT_LOG_FIELD_CONDITION_LAST = FLIGHT_LOG_FIELD_CONDITION_NEVER
+} FlightLogFieldCondition;
+
+typedef enum FlightLogFieldPredictor {
+
+    FLIGHT_LOG_FIELD_PREDICTOR_0 = 0,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS = 1,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE = 2,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2 = 3,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE = 4,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0 = 5,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_INC = 6,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD = 7,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_1500 = 8,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_VBATREF = 9,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME = 10,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR = 11
+
+} FlightLogFieldPredictor;
+
+typedef enum FlightLogFieldEncoding {
+    FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB = 0,
+    FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB = 1,
+    FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT = 3,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB = 6,
+    FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32 = 7,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16 = 8,
+    FLIGHT_LOG_FIELD_ENCODING_NULL = 9,
+    FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE = 10
+} FlightLogFieldEncoding;
+
+typedef enum FlightLogFieldSign {
+    FLIGHT_LOG_FIELD_UNSIGNED = 0,
+    FLIGHT_LOG_FIELD_SIGNED = 1
+} FlightLogFieldSign;
+
+typedef struct flightLogEvent_syncBeep_s {
+    uint32_t time;
+} flightLogEvent_syncBeep_t;
+
+typedef struct flightLogEvent_flightMode_s {
+    uint32_t flags;
+    uint32_t lastFlags;
+} flightLogEvent_flightMode_t;
+
+typedef struct flightLogEvent_inflightAdjustment_s {
+    int32_t newValue;
+    float newFloatValue;
+    uint8_t adjustmentFunction;
+    
+# 125 "./src/main/blackbox/blackbox_fielddefs.h" 3 4
+   _Bool 
+# 125 "./src/main/blackbox/blackbox_fielddefs.h"
+        floatFlag;
+} flightLogEvent_inflightAdjustment_t;
+
+typedef struct flightLogEvent_loggingResume_s {
+    uint32_t logIteration;
+    uint32_t currentTime;
+} flightLogEvent_loggingResume_t;
+
+
+
+typedef union flightLogEventData_u {
+    flightLogEvent_syncBeep_t syncBeep;
+    flightLogEvent_flightMode_t flightMode;
+    flightLogEvent_inflightAdjustment_t inflightAdjustment;
+    flightLogEvent_loggingResume_t loggingResume;
+} flightLogEventData_t;
+
+typedef struct flightLogEvent_s {
+    FlightLogEvent event;
+    flightLogEventData_t data;
+} flightLogEvent_t;
+# 33 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/blackbox/blackbox_io.h" 1
+# 21 "./src/main/blackbox/blackbox_io.h"
+       
+
+typedef enum {
+    BLACKBOX_RESERVE_SUCCESS,
+    BLACKBOX_RESERVE_TEMPORARY_FAILURE,
+    BLACKBOX_RESERVE_PERMANENT_FAILURE
+} blackboxBufferReserveStatus_e;
+# 41 "./src/main/blackbox/blackbox_io.h"
+extern int32_t blackboxHeaderBudget;
+
+void blackboxOpen(void);
+void blackboxWrite(uint8_t value);
+int blackboxWriteString(const char *s);
+
+void blackboxDeviceFlush(void);
+
+# 48 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 48 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceFlushForce(void);
+
+# 49 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 49 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceOpen(void);
+void blackboxDeviceClose(void);
+
+void blackboxEraseAll(void);
+
+# 53 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 53 "./src/main/blackbox/blackbox_io.h"
+    isBlackboxErased(void);
+
+
+# 55 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 55 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceBeginLog(void);
+
+# 56 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 56 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceEndLog(
+# 56 "./src/main/blackbox/blackbox_io.h" 3 4
+                         _Bool 
+# 56 "./src/main/blackbox/blackbox_io.h"
+                              retainLog);
+
+
+# 58 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 58 "./src/main/blackbox/blackbox_io.h"
+    isBlackboxDeviceFull(void);
+
+# 59 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 59 "./src/main/blackbox/blackbox_io.h"
+    isBlackboxDeviceWorking(void);
+unsigned int blackboxGetLogNumber(void);
+
+void blackboxReplenishHeaderBudget(void);
+blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
+
+
+# 65 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 65 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceStreamCanHold(int32_t bytes);
+
+# 66 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 66 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceStreamHasRoom(int32_t bytes);
+
+# 67 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 67 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceStreamRestartRequested(void);
+# 34 "./src/main/blackbox/blackbox.c" 2
+
+
+# 1 "./src/main/build/debug.h" 1
+# 21 "./src/main/build/debug.h"
+       
+
+
+extern int16_t debug[4];
+extern uint8_t debugMode;
+
+
+
+
+
+
+extern uint32_t sectionTimes[2][4];
+# 51 "./src/main/build/debug.h"
+typedef enum {
+    DEBUG_NONE,
+    DEBUG_CYCLETIME,
+    DEBUG_BATTERY,
+    DEBUG_GYRO_FILTERED,
+    DEBUG_ACCELEROMETER,
+    DEBUG_PIDLOOP,
+    DEBUG_GYRO_SCALED,
+    DEBUG_RC_INTERPOLATION,
+    DEBUG_ANGLERATE,
+    DEBUG_ESC_SENSOR,
+    DEBUG_SCHEDULER,
+    DEBUG_STACK,
+    DEBUG_ESC_SENSOR_RPM,
+    DEBUG_ESC_SENSOR_TMP,
+    DEBUG_ALTITUDE,
+    DEBUG_FFT,
+    DEBUG_FFT_TIME,
+    DEBUG_FFT_FREQ,
+    DEBUG_RX_FRSKY_SPI,
+    DEBUG_RX_SFHSS_SPI,
+    DEBUG_GYRO_RAW,
+    DEBUG_DUAL_GYRO,
+    DEBUG_DUAL_GYRO_RAW,
+    DEBUG_DUAL_GYRO_COMBINE,
+    DEBUG_DUAL_GYRO_DIFF,
+    DEBUG_MAX7456_SIGNAL,
+    DEBUG_MAX7456_SPICLOCK,
+    DEBUG_SBUS,
+    DEBUG_FPORT,
+    DEBUG_RANGEFINDER,
+    DEBUG_RANGEFINDER_QUALITY,
+    DEBUG_LIDAR_TF,
+    DEBUG_ADC_INTERNAL,
+    DEBUG_RUNAWAY_TAKEOFF,
+    DEBUG_SDIO,
+    DEBUG_CURRENT_SENSOR,
+    DEBUG_USB,
+    DEBUG_SMARTAUDIO,
+    DEBUG_RTH,
+    DEBUG_ITERM_RELAX,
+    DEBUG_ACRO_TRAINER,
+    DEBUG_RC_SMOOTHING,
+    DEBUG_RX_SIGNAL_LOSS,
+    DEBUG_RC_SMOOTHING_RATE,
+    DEBUG_ANTI_GRAVITY,
+    DEBUG_DYN_LPF,
+    DEBUG_RX_SPEKTRUM_SPI,
+    DEBUG_DSHOT_RPM_TELEMETRY,
+    DEBUG_RPM_FILTER,
+    DEBUG_D_MIN,
+    DEBUG_AC_CORRECTION,
+    DEBUG_AC_ERROR,
+    DEBUG_DUAL_GYRO_SCALED,
+    DEBUG_DSHOT_RPM_ERRORS,
+    DEBUG_CRSF_LINK_STATISTICS_UPLINK,
+    DEBUG_CRSF_LINK_STATISTICS_PWR,
+    DEBUG_CRSF_LINK_STATISTICS_DOWN,
+    DEBUG_COUNT
+} debugType_e;
+
+extern const char * const debugModeNames[DEBUG_COUNT];
+# 37 "./src/main/blackbox/blackbox.c" 2
+
+
+# 1 "./src/main/common/axis.h" 1
+# 21 "./src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH
+} angle_index_t;
+# 40 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/common/encoding.h" 1
+# 21 "./src/main/common/encoding.h"
+       
+
+
+
+uint32_t castFloatBytesToInt(float f);
+uint32_t zigzagEncode(int32_t value);
+# 41 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/common/maths.h" 1
+# 21 "./src/main/common/maths.h"
+       
+# 63 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+int gcd(int num, int denom);
+float powerf(float base, int exp);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadband(float value, float deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+float scaleRangef(float x, float srcFrom, float srcTo, float destFrom, float destTo);
+
+void normalizeV(struct fp_vector *src, struct fp_vector *dest);
+
+void rotateV(struct fp_vector *v, fp_angles_t *delta);
+void buildRotationMatrix(fp_angles_t *delta, float matrix[3][3]);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+
+float exp_approx(float val);
+float log_approx(float val);
+float pow_approx(float a, float b);
+# 145 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 42 "./src/main/blackbox/blackbox.c" 2
+
+
+
+# 1 "./src/main/config/feature.h" 1
+# 21 "./src/main/config/feature.h"
+       
+# 32 "./src/main/config/feature.h"
+typedef enum {
+    FEATURE_RX_PPM = 1 << 0,
+    FEATURE_INFLIGHT_ACC_CAL = 1 << 2,
+    FEATURE_RX_SERIAL = 1 << 3,
+    FEATURE_MOTOR_STOP = 1 << 4,
+    FEATURE_SERVO_TILT = 1 << 5,
+    FEATURE_SOFTSERIAL = 1 << 6,
+    FEATURE_GPS = 1 << 7,
+    FEATURE_RANGEFINDER = 1 << 9,
+    FEATURE_TELEMETRY = 1 << 10,
+    FEATURE_3D = 1 << 12,
+    FEATURE_RX_PARALLEL_PWM = 1 << 13,
+    FEATURE_RX_MSP = 1 << 14,
+    FEATURE_RSSI_ADC = 1 << 15,
+    FEATURE_LED_STRIP = 1 << 16,
+    FEATURE_DASHBOARD = 1 << 17,
+    FEATURE_OSD = 1 << 18,
+    FEATURE_CHANNEL_FORWARDING = 1 << 20,
+    FEATURE_TRANSPONDER = 1 << 21,
+    FEATURE_AIRMODE = 1 << 22,
+    FEATURE_RX_SPI = 1 << 25,
+    FEATURE_SOFTSPI = 1 << 26,
+    FEATURE_ESC_SENSOR = 1 << 27,
+    FEATURE_ANTI_GRAVITY = 1 << 28,
+    FEATURE_DYNAMIC_FILTER = 1 << 29,
+} features_e;
+
+typedef struct featureConfig_s {
+    uint32_t enabledFeatures;
+} featureConfig_t;
+
+extern featureConfig_t featureConfig_System; extern featureConfig_t featureConfig_Copy; static inline const featureConfig_t* featureConfig(void) { return &featureConfig_System; } static inline featureConfig_t* featureConfigMutable(void) { return &featureConfig_System; } struct _dummy;
+
+
+# 65 "./src/main/config/feature.h" 3 4
+_Bool 
+# 65 "./src/main/config/feature.h"
+    featureIsEnabled(const uint32_t mask);
+void featureEnable(const uint32_t mask);
+void featureDisable(const uint32_t mask);
+void featureDisableAll(void);
+uint32_t featureMask(void);
+
+void featureSet(const uint32_t mask, uint32_t *features);
+void featureClear(const uint32_t mask, uint32_t *features);
+# 46 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/pg/pg_ids.h" 1
+# 21 "./src/main/pg/pg_ids.h"
+       
+# 48 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/pg/rx.h" 1
+# 21 "./src/main/pg/rx.h"
+       
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 21 "./src/main/drivers/io_types.h"
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 48 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 24 "./src/main/pg/rx.h" 2
+
+
+
+
+
+
+typedef struct rxConfig_s {
+    uint8_t rcmap[8];
+    uint8_t serialrx_provider;
+    uint8_t serialrx_inverted;
+    uint8_t halfDuplex;
+    ioTag_t spektrum_bind_pin_override_ioTag;
+    ioTag_t spektrum_bind_plug_ioTag;
+    uint8_t spektrum_sat_bind;
+    uint8_t spektrum_sat_bind_autoreset;
+    uint8_t rssi_channel;
+    uint8_t rssi_scale;
+    uint8_t rssi_invert;
+    uint16_t midrc;
+    uint16_t mincheck;
+    uint16_t maxcheck;
+    uint8_t rcInterpolation;
+    uint8_t rcInterpolationChannels;
+    uint8_t rcInterpolationInterval;
+    uint8_t fpvCamAngleDegrees;
+    uint8_t airModeActivateThreshold;
+
+    uint16_t rx_min_usec;
+    uint16_t rx_max_usec;
+    uint8_t max_aux_channel;
+    uint8_t rssi_src_frame_errors;
+    int8_t rssi_offset;
+    uint8_t rc_smoothing_type;
+    uint8_t rc_smoothing_input_cutoff;
+    uint8_t rc_smoothing_derivative_cutoff;
+    uint8_t rc_smoothing_debug_axis;
+    uint8_t rc_smoothing_input_type;
+    uint8_t rc_smoothing_derivative_type;
+    uint8_t rc_smoothing_auto_factor;
+    uint8_t rssi_src_frame_lpf_period;
+} rxConfig_t;
+
+extern rxConfig_t rxConfig_System; extern rxConfig_t rxConfig_Copy; static inline const rxConfig_t* rxConfig(void) { return &rxConfig_System; } static inline rxConfig_t* rxConfigMutable(void) { return &rxConfig_System; } struct _dummy;
+# 49 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/drivers/compass/compass.h" 1
+# 21 "./src/main/drivers/compass/compass.h"
+       
+
+# 1 "./src/main/drivers/bus.h" 1
+# 21 "./src/main/drivers/bus.h"
+       
+
+
+
+# 1 "./src/main/drivers/bus_i2c.h" 1
+# 21 "./src/main/drivers/bus_i2c.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/rcc_types.h" 1
+# 21 "./src/main/drivers/rcc_types.h"
+       
+
+
+
+
+typedef uint8_t rccPeriphTag_t;
+# 27 "./src/main/drivers/bus_i2c.h" 2
+
+
+
+
+
+typedef enum I2CDevice {
+    I2CINVALID = -1,
+    I2CDEV_1 = 0,
+    I2CDEV_2,
+    I2CDEV_3,
+    I2CDEV_4,
+} I2CDevice;
+# 58 "./src/main/drivers/bus_i2c.h"
+struct i2cConfig_s;
+void i2cHardwareConfigure(const struct i2cConfig_s *i2cConfig);
+void i2cInit(I2CDevice device);
+
+# 61 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 61 "./src/main/drivers/bus_i2c.h"
+    i2cWriteBuffer(I2CDevice device, uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data);
+
+# 62 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 62 "./src/main/drivers/bus_i2c.h"
+    i2cWrite(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t data);
+
+# 63 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 63 "./src/main/drivers/bus_i2c.h"
+    i2cRead(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf);
+
+uint16_t i2cGetErrorCounter(void);
+# 26 "./src/main/drivers/bus.h" 2
+
+
+typedef enum {
+    BUSTYPE_NONE = 0,
+    BUSTYPE_I2C,
+    BUSTYPE_SPI,
+    BUSTYPE_MPU_SLAVE,
+    BUSTYPE_GYRO_AUTO,
+} busType_e;
+
+struct spiDevice_s;
+
+typedef struct busDevice_s {
+    busType_e bustype;
+    union {
+        struct deviceSpi_s {
+            SPI_TypeDef *instance;
+# 51 "./src/main/drivers/bus.h"
+            IO_t csnPin;
+        } spi;
+        struct deviceI2C_s {
+            I2CDevice device;
+            uint8_t address;
+        } i2c;
+        struct deviceMpuSlave_s {
+            const struct busDevice_s *master;
+            uint8_t address;
+        } mpuSlave;
+    } busdev_u;
+} busDevice_t;
+
+
+
+
+
+
+# 68 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 68 "./src/main/drivers/bus.h"
+    busWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+
+# 69 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 69 "./src/main/drivers/bus.h"
+    busReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+uint8_t busReadRegister(const busDevice_t *bus, uint8_t reg);
+# 24 "./src/main/drivers/compass/compass.h" 2
+# 1 "./src/main/drivers/sensor.h" 1
+# 21 "./src/main/drivers/sensor.h"
+       
+
+
+
+
+typedef enum {
+    ALIGN_DEFAULT = 0,
+    CW0_DEG = 1,
+    CW90_DEG = 2,
+    CW180_DEG = 3,
+    CW270_DEG = 4,
+    CW0_DEG_FLIP = 5,
+    CW90_DEG_FLIP = 6,
+    CW180_DEG_FLIP = 7,
+    CW270_DEG_FLIP = 8
+} sensor_align_e;
+
+typedef 
+# 38 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 38 "./src/main/drivers/sensor.h"
+            (*sensorInterruptFuncPtr)(void);
+struct magDev_s;
+typedef 
+# 40 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 40 "./src/main/drivers/sensor.h"
+            (*sensorMagInitFuncPtr)(struct magDev_s *magdev);
+typedef 
+# 41 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 41 "./src/main/drivers/sensor.h"
+            (*sensorMagReadFuncPtr)(struct magDev_s *magdev, int16_t *data);
+struct accDev_s;
+typedef void (*sensorAccInitFuncPtr)(struct accDev_s *acc);
+typedef 
+# 44 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 44 "./src/main/drivers/sensor.h"
+            (*sensorAccReadFuncPtr)(struct accDev_s *acc);
+struct gyroDev_s;
+typedef void (*sensorGyroInitFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 47 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 47 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 48 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 48 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadDataFuncPtr)(struct gyroDev_s *gyro, int16_t *data);
+# 25 "./src/main/drivers/compass/compass.h" 2
+# 1 "./src/main/drivers/exti.h" 1
+# 21 "./src/main/drivers/exti.h"
+       
+
+
+
+
+
+typedef enum {
+    EXTI_TRIGGER_RISING = 0,
+    EXTI_TRIGGER_FALLING = 1,
+    EXTI_TRIGGER_BOTH = 2
+} extiTrigger_t;
+
+typedef struct extiCallbackRec_s extiCallbackRec_t;
+typedef void extiHandlerCallback(extiCallbackRec_t *self);
+
+struct extiCallbackRec_s {
+    extiHandlerCallback *fn;
+};
+
+void EXTIInit(void);
+
+void EXTIHandlerInit(extiCallbackRec_t *cb, extiHandlerCallback *fn);
+void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, ioConfig_t config, extiTrigger_t trigger);
+void EXTIRelease(IO_t io);
+void EXTIEnable(IO_t io, 
+# 45 "./src/main/drivers/exti.h" 3 4
+                        _Bool 
+# 45 "./src/main/drivers/exti.h"
+                             enable);
+# 26 "./src/main/drivers/compass/compass.h" 2
+
+typedef struct magDev_s {
+    sensorMagInitFuncPtr init;
+    sensorMagReadFuncPtr read;
+    extiCallbackRec_t exti;
+    busDevice_t busdev;
+    sensor_align_e magAlign;
+    ioTag_t magIntExtiTag;
+    int16_t magGain[3];
+} magDev_t;
+# 51 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/drivers/time.h" 1
+# 21 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+
+uint32_t getCycleCounter(void);
+
+
+
+
+
+
+
+int32_t clockCyclesToMicros(int32_t clockCycles);
+int32_t clockCyclesTo10thMicros(int32_t clockCycles);
+uint32_t clockMicrosToCycles(uint32_t micros);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 53 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/fc/config.h" 1
+# 21 "./src/main/fc/config.h"
+       
+# 32 "./src/main/fc/config.h"
+typedef struct pilotConfig_s {
+    char name[16u + 1];
+    char displayName[16u + 1];
+} pilotConfig_t;
+
+extern pilotConfig_t pilotConfig_System; extern pilotConfig_t pilotConfig_Copy; static inline const pilotConfig_t* pilotConfig(void) { return &pilotConfig_System; } static inline pilotConfig_t* pilotConfigMutable(void) { return &pilotConfig_System; } struct _dummy;
+
+typedef struct systemConfig_s {
+    uint8_t pidProfileIndex;
+    uint8_t activeRateProfile;
+    uint8_t debug_mode;
+    uint8_t task_statistics;
+    uint8_t rateProfile6PosSwitch;
+    uint8_t cpu_overclock;
+    uint8_t powerOnArmingGraceTime;
+    char boardIdentifier[sizeof("SITL") + 1];
+    uint8_t hseMhz;
+    uint8_t configured;
+    uint8_t schedulerOptimizeRate;
+} systemConfig_t;
+
+extern systemConfig_t systemConfig_System; extern systemConfig_t systemConfig_Copy; static inline const systemConfig_t* systemConfig(void) { return &systemConfig_System; } static inline systemConfig_t* systemConfigMutable(void) { return &systemConfig_System; } struct _dummy;
+
+struct pidProfile_s;
+extern struct pidProfile_s *currentPidProfile;
+
+
+void initEEPROM(void);
+void resetEEPROM(void);
+
+# 61 "./src/main/fc/config.h" 3 4
+_Bool 
+# 61 "./src/main/fc/config.h"
+    readEEPROM(void);
+void writeEEPROM(void);
+void writeEEPROMWithFeatures(uint32_t features);
+void ensureEEPROMStructureIsValid(void);
+
+void saveConfigAndNotify(void);
+void validateAndFixGyroConfig(void);
+
+void setConfigDirty(void);
+
+# 70 "./src/main/fc/config.h" 3 4
+_Bool 
+# 70 "./src/main/fc/config.h"
+    isConfigDirty(void);
+
+uint8_t getCurrentPidProfileIndex(void);
+void changePidProfile(uint8_t pidProfileIndex);
+void changePidProfileFromCellCount(uint8_t cellCount);
+struct pidProfile_s;
+void resetPidProfile(struct pidProfile_s *profile);
+
+uint8_t getCurrentControlRateProfileIndex(void);
+void changeControlRateProfile(uint8_t profileIndex);
+
+
+# 81 "./src/main/fc/config.h" 3 4
+_Bool 
+# 81 "./src/main/fc/config.h"
+    canSoftwareSerialBeUsed(void);
+
+uint16_t getCurrentMinthrottle(void);
+
+void resetConfigs(void);
+void targetConfiguration(void);
+void targetValidateConfiguration(void);
+
+
+# 89 "./src/main/fc/config.h" 3 4
+_Bool 
+# 89 "./src/main/fc/config.h"
+    isSystemConfigured(void);
+void setRebootRequired(void);
+
+# 91 "./src/main/fc/config.h" 3 4
+_Bool 
+# 91 "./src/main/fc/config.h"
+    getRebootRequired(void);
+# 55 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/fc/controlrate_profile.h" 1
+# 21 "./src/main/fc/controlrate_profile.h"
+       
+
+
+
+
+
+typedef enum {
+    RATES_TYPE_BETAFLIGHT = 0,
+    RATES_TYPE_RACEFLIGHT,
+    RATES_TYPE_KISS,
+} ratesType_e;
+
+typedef enum {
+    THROTTLE_LIMIT_TYPE_OFF = 0,
+    THROTTLE_LIMIT_TYPE_SCALE,
+    THROTTLE_LIMIT_TYPE_CLIP,
+    THROTTLE_LIMIT_TYPE_COUNT
+} throttleLimitType_e;
+
+typedef enum {
+    TPA_MODE_PD,
+    TPA_MODE_D
+} tpaMode_e;
+
+
+
+typedef struct controlRateConfig_s {
+    uint8_t thrMid8;
+    uint8_t thrExpo8;
+    uint8_t rates_type;
+    uint8_t rcRates[3];
+    uint8_t rcExpo[3];
+    uint8_t rates[3];
+    uint8_t dynThrPID;
+    uint16_t tpa_breakpoint;
+    uint8_t throttle_limit_type;
+    uint8_t throttle_limit_percent;
+    uint16_t rate_limit[3];
+    uint8_t tpaMode;
+    char profileName[8u + 1];
+} controlRateConfig_t;
+
+extern controlRateConfig_t controlRateProfiles_SystemArray[6]; extern controlRateConfig_t controlRateProfiles_CopyArray[6]; static inline const controlRateConfig_t* controlRateProfiles(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t* controlRateProfilesMutable(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t (* controlRateProfiles_array(void))[6] { return &controlRateProfiles_SystemArray; } struct _dummy;
+
+extern controlRateConfig_t *currentControlRateProfile;
+
+void loadControlRateProfile(void);
+void changeControlRateProfile(uint8_t controlRateProfileIndex);
+
+void copyControlRateProfile(const uint8_t dstControlRateProfileIndex, const uint8_t srcControlRateProfileIndex);
+# 56 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/fc/rc.h" 1
+# 21 "./src/main/fc/rc.h"
+       
+
+# 1 "./src/main/fc/rc_controls.h" 1
+# 21 "./src/main/fc/rc_controls.h"
+       
+
+
+
+# 1 "./src/main/common/filter.h" 1
+# 21 "./src/main/common/filter.h"
+       
+
+
+struct filter_s;
+typedef struct filter_s filter_t;
+
+typedef struct pt1Filter_s {
+    float state;
+    float k;
+} pt1Filter_t;
+
+typedef struct slewFilter_s {
+    float state;
+    float slewLimit;
+    float threshold;
+} slewFilter_t;
+
+
+typedef struct biquadFilter_s {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+} biquadFilter_t;
+
+typedef struct laggedMovingAverage_s {
+    uint16_t movingWindowIndex;
+    uint16_t windowSize;
+    float movingSum;
+    float *buf;
+    
+# 49 "./src/main/common/filter.h" 3 4
+   _Bool 
+# 49 "./src/main/common/filter.h"
+        primed;
+} laggedMovingAverage_t;
+
+
+typedef struct movingAverageFilter_s {
+    int32_t *buf;
+    int32_t sum;
+    uint16_t windowSize;
+    uint16_t index;
+    uint16_t count;
+} movingAverageFilter_t;
+
+
+typedef struct medianFilter_s {
+    int32_t *window;
+    int32_t *sorted;
+    uint16_t windowSize;
+    uint16_t index;
+    uint16_t count;
+} medianFilter_t;
+
+typedef enum {
+    FILTER_PT1 = 0,
+    FILTER_BIQUAD,
+} lowpassFilterType_e;
+
+typedef enum {
+    FILTER_LPF,
+    FILTER_NOTCH,
+    FILTER_BPF,
+} biquadFilterType_e;
+
+typedef float (*filterApplyFnPtr)(filter_t *filter, float input);
+
+float nullFilterApply(filter_t *filter, float input);
+
+void biquadFilterInitLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+
+float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
+float biquadFilterApply(biquadFilter_t *filter, float input);
+float filterGetNotchQ(float centerFreq, float cutoffFreq);
+
+void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf);
+float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float input);
+
+void movingAverageFilterInit(movingAverageFilter_t *filter, int32_t *buf, uint16_t windowSize);
+int32_t movingAverageFilterApply(movingAverageFilter_t *filter, int32_t input);
+
+# 99 "./src/main/common/filter.h" 3 4
+_Bool 
+# 99 "./src/main/common/filter.h"
+    movingAverageFilterIsPrimed(const movingAverageFilter_t *filter);
+
+void medianFilterInit(medianFilter_t *filter, int32_t *window, int32_t *sorted, uint16_t windowSize);
+int32_t medianFilterApply(medianFilter_t *filter, int32_t input);
+
+float pt1FilterGain(float f_cut, float dT);
+void pt1FilterInit(pt1Filter_t *filter, float k);
+void pt1FilterUpdateCutoff(pt1Filter_t *filter, float k);
+float pt1FilterApply(pt1Filter_t *filter, float input);
+
+void slewFilterInit(slewFilter_t *filter, float slewLimit, float threshold);
+float slewFilterApply(slewFilter_t *filter, float input);
+# 26 "./src/main/fc/rc_controls.h" 2
+
+
+typedef enum rc_alias {
+    ROLL = 0,
+    PITCH,
+    YAW,
+    THROTTLE,
+    AUX1,
+    AUX2,
+    AUX3,
+    AUX4,
+    AUX5,
+    AUX6,
+    AUX7,
+    AUX8
+} rc_alias_e;
+
+
+
+typedef enum {
+    THROTTLE_LOW = 0,
+    THROTTLE_HIGH
+} throttleStatus_e;
+
+
+
+typedef enum {
+    NOT_CENTERED = 0,
+    CENTERED
+} rollPitchStatus_e;
+
+typedef enum {
+    RC_SMOOTHING_OFF = 0,
+    RC_SMOOTHING_DEFAULT,
+    RC_SMOOTHING_AUTO,
+    RC_SMOOTHING_MANUAL
+} rcSmoothing_t;
+
+typedef enum {
+    RC_SMOOTHING_TYPE_INTERPOLATION,
+    RC_SMOOTHING_TYPE_FILTER
+} rcSmoothingType_e;
+
+typedef enum {
+    RC_SMOOTHING_INPUT_PT1,
+    RC_SMOOTHING_INPUT_BIQUAD
+} rcSmoothingInputFilter_e;
+
+typedef enum {
+    RC_SMOOTHING_DERIVATIVE_OFF,
+    RC_SMOOTHING_DERIVATIVE_PT1,
+    RC_SMOOTHING_DERIVATIVE_BIQUAD
+} rcSmoothingDerivativeFilter_e;
+# 105 "./src/main/fc/rc_controls.h"
+extern float rcCommand[4];
+
+typedef struct rcSmoothingFilterTraining_s {
+    float sum;
+    int count;
+    uint16_t min;
+    uint16_t max;
+} rcSmoothingFilterTraining_t;
+
+typedef union rcSmoothingFilterTypes_u {
+    pt1Filter_t pt1Filter;
+    biquadFilter_t biquadFilter;
+} rcSmoothingFilterTypes_t;
+
+typedef struct rcSmoothingFilter_s {
+    
+# 120 "./src/main/fc/rc_controls.h" 3 4
+   _Bool 
+# 120 "./src/main/fc/rc_controls.h"
+        filterInitialized;
+    rcSmoothingFilterTypes_t filter[4];
+    rcSmoothingInputFilter_e inputFilterType;
+    uint8_t inputCutoffSetting;
+    uint16_t inputCutoffFrequency;
+    rcSmoothingDerivativeFilter_e derivativeFilterType;
+    uint8_t derivativeCutoffSetting;
+    uint16_t derivativeCutoffFrequency;
+    int averageFrameTimeUs;
+    rcSmoothingFilterTraining_t training;
+    uint8_t debugAxis;
+    uint8_t autoSmoothnessFactor;
+} rcSmoothingFilter_t;
+
+typedef struct rcControlsConfig_s {
+    uint8_t deadband;
+    uint8_t yaw_deadband;
+    uint8_t alt_hold_deadband;
+    uint8_t alt_hold_fast_change;
+    
+# 139 "./src/main/fc/rc_controls.h" 3 4
+   _Bool 
+# 139 "./src/main/fc/rc_controls.h"
+        yaw_control_reversed;
+} rcControlsConfig_t;
+
+extern rcControlsConfig_t rcControlsConfig_System; extern rcControlsConfig_t rcControlsConfig_Copy; static inline const rcControlsConfig_t* rcControlsConfig(void) { return &rcControlsConfig_System; } static inline rcControlsConfig_t* rcControlsConfigMutable(void) { return &rcControlsConfig_System; } struct _dummy;
+
+typedef struct flight3DConfig_s {
+    uint16_t deadband3d_low;
+    uint16_t deadband3d_high;
+    uint16_t neutral3d;
+    uint16_t deadband3d_throttle;
+    uint16_t limit3d_low;
+    uint16_t limit3d_high;
+    uint8_t switched_mode3d;
+} flight3DConfig_t;
+
+extern flight3DConfig_t flight3DConfig_System; extern flight3DConfig_t flight3DConfig_Copy; static inline const flight3DConfig_t* flight3DConfig(void) { return &flight3DConfig_System; } static inline flight3DConfig_t* flight3DConfigMutable(void) { return &flight3DConfig_System; } struct _dummy;
+
+typedef struct armingConfig_s {
+    uint8_t gyro_cal_on_first_arm;
+    uint8_t auto_disarm_delay;
+} armingConfig_t;
+
+extern armingConfig_t armingConfig_System; extern armingConfig_t armingConfig_Copy; static inline const armingConfig_t* armingConfig(void) { return &armingConfig_System; } static inline armingConfig_t* armingConfigMutable(void) { return &armingConfig_System; } struct _dummy;
+
+
+# 163 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 163 "./src/main/fc/rc_controls.h"
+    areUsingSticksToArm(void);
+
+
+# 165 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 165 "./src/main/fc/rc_controls.h"
+    areSticksInApModePosition(uint16_t ap_mode);
+throttleStatus_e calculateThrottleStatus(void);
+void processRcStickPositions();
+
+
+# 169 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 169 "./src/main/fc/rc_controls.h"
+    isUsingSticksForArming(void);
+
+int32_t getRcStickDeflection(int32_t axis, uint16_t midrc);
+void rcControlsInit(void);
+# 24 "./src/main/fc/rc.h" 2
+
+typedef enum {
+    INTERPOLATION_CHANNELS_RP,
+    INTERPOLATION_CHANNELS_RPY,
+    INTERPOLATION_CHANNELS_RPYT,
+    INTERPOLATION_CHANNELS_T,
+    INTERPOLATION_CHANNELS_RPT,
+} interpolationChannels_e;
+
+extern uint16_t currentRxRefreshRate;
+
+void processRcCommand(void);
+float getSetpointRate(int axis);
+float getRcDeflection(int axis);
+float getRcDeflectionAbs(int axis);
+float getThrottlePIDAttenuation(void);
+void updateRcCommands(void);
+void resetYawAxis(void);
+void initRcProcessing(void);
+void rcChangeProfile(uint8_t controlRateProfileIndex);
+
+# 44 "./src/main/fc/rc.h" 3 4
+_Bool 
+# 44 "./src/main/fc/rc.h"
+    isMotorsReversed(void);
+
+# 45 "./src/main/fc/rc.h" 3 4
+_Bool 
+# 45 "./src/main/fc/rc.h"
+    rcSmoothingIsEnabled(void);
+rcSmoothingFilter_t *getRcSmoothingData(void);
+
+# 47 "./src/main/fc/rc.h" 3 4
+_Bool 
+# 47 "./src/main/fc/rc.h"
+    rcSmoothingAutoCalculate(void);
+
+# 48 "./src/main/fc/rc.h" 3 4
+_Bool 
+# 48 "./src/main/fc/rc.h"
+    rcSmoothingInitializationComplete(void);
+# 57 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/fc/rc_modes.h" 1
+# 21 "./src/main/fc/rc_modes.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+
+    BOXARM = 0,
+
+    BOXANGLE,
+    BOXHORIZON,
+    BOXMAG,
+    BOXHEADFREE,
+    BOXPASSTHRU,
+    BOXFAILSAFE,
+    BOXGPSRESCUE,
+    BOXID_FLIGHTMODE_LAST = BOXGPSRESCUE,
+
+
+
+
+    BOXANTIGRAVITY,
+    BOXHEADADJ,
+    BOXCAMSTAB,
+    BOXBEEPERON,
+    BOXLEDLOW,
+    BOXCALIB,
+    BOXOSD,
+    BOXTELEMETRY,
+    BOXSERVO1,
+    BOXSERVO2,
+    BOXSERVO3,
+    BOXBLACKBOX,
+    BOXAIRMODE,
+    BOX3D,
+    BOXFPVANGLEMIX,
+    BOXBLACKBOXERASE,
+    BOXCAMERA1,
+    BOXCAMERA2,
+    BOXCAMERA3,
+    BOXFLIPOVERAFTERCRASH,
+    BOXPREARM,
+    BOXBEEPGPSCOUNT,
+    BOXVTXPITMODE,
+    BOXPARALYZE,
+    BOXUSER1,
+    BOXUSER2,
+    BOXUSER3,
+    BOXUSER4,
+    BOXPIDAUDIO,
+    BOXACROTRAINER,
+    BOXVTXCONTROLDISABLE,
+    BOXLAUNCHCONTROL,
+    CHECKBOX_ITEM_COUNT
+} boxId_e;
+
+typedef enum {
+    MODELOGIC_OR = 0,
+    MODELOGIC_AND
+} modeLogic_e;
+
+
+typedef struct boxBitmask_s { uint32_t bits[(CHECKBOX_ITEM_COUNT + 31) / 32]; } boxBitmask_t;
+# 103 "./src/main/fc/rc_modes.h"
+typedef struct channelRange_s {
+    uint8_t startStep;
+    uint8_t endStep;
+} channelRange_t;
+
+typedef struct modeActivationCondition_s {
+    boxId_e modeId;
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+    modeLogic_e modeLogic;
+    boxId_e linkedTo;
+} modeActivationCondition_t;
+
+extern modeActivationCondition_t modeActivationConditions_SystemArray[20]; extern modeActivationCondition_t modeActivationConditions_CopyArray[20]; static inline const modeActivationCondition_t* modeActivationConditions(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t* modeActivationConditionsMutable(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t (* modeActivationConditions_array(void))[20] { return &modeActivationConditions_SystemArray; } struct _dummy;
+
+typedef struct modeActivationProfile_s {
+    modeActivationCondition_t modeActivationConditions[20];
+} modeActivationProfile_t;
+
+
+
+
+# 124 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 124 "./src/main/fc/rc_modes.h"
+    IS_RC_MODE_ACTIVE(boxId_e boxId);
+void rcModeUpdate(boxBitmask_t *newState);
+
+
+# 127 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 127 "./src/main/fc/rc_modes.h"
+    airmodeIsEnabled(void);
+
+
+# 129 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 129 "./src/main/fc/rc_modes.h"
+    isRangeActive(uint8_t auxChannelIndex, const channelRange_t *range);
+void updateActivatedModes(void);
+
+# 131 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 131 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionPresent(boxId_e modeId);
+
+# 132 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 132 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionLinked(boxId_e modeId);
+void removeModeActivationCondition(boxId_e modeId);
+
+# 134 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 134 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionConfigured(const modeActivationCondition_t *mac, const modeActivationCondition_t *emptyMac);
+void analyzeModeActivationConditions(void);
+# 59 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/fc/runtime_config.h" 1
+# 21 "./src/main/fc/runtime_config.h"
+       
+
+
+
+
+typedef enum {
+    ARMED = (1 << 0),
+    WAS_EVER_ARMED = (1 << 1),
+    WAS_ARMED_WITH_PREARM = (1 << 2)
+} armingFlag_e;
+
+extern uint8_t armingFlags;
+# 42 "./src/main/fc/runtime_config.h"
+typedef enum {
+    ARMING_DISABLED_NO_GYRO = (1 << 0),
+    ARMING_DISABLED_FAILSAFE = (1 << 1),
+    ARMING_DISABLED_RX_FAILSAFE = (1 << 2),
+    ARMING_DISABLED_BAD_RX_RECOVERY = (1 << 3),
+    ARMING_DISABLED_BOXFAILSAFE = (1 << 4),
+    ARMING_DISABLED_RUNAWAY_TAKEOFF = (1 << 5),
+    ARMING_DISABLED_CRASH_DETECTED = (1 << 6),
+    ARMING_DISABLED_THROTTLE = (1 << 7),
+    ARMING_DISABLED_ANGLE = (1 << 8),
+    ARMING_DISABLED_BOOT_GRACE_TIME = (1 << 9),
+    ARMING_DISABLED_NOPREARM = (1 << 10),
+    ARMING_DISABLED_LOAD = (1 << 11),
+    ARMING_DISABLED_CALIBRATING = (1 << 12),
+    ARMING_DISABLED_CLI = (1 << 13),
+    ARMING_DISABLED_CMS_MENU = (1 << 14),
+    ARMING_DISABLED_BST = (1 << 15),
+    ARMING_DISABLED_MSP = (1 << 16),
+    ARMING_DISABLED_PARALYZE = (1 << 17),
+    ARMING_DISABLED_GPS = (1 << 18),
+    ARMING_DISABLED_RESC = (1 << 19),
+    ARMING_DISABLED_RPMFILTER = (1 << 20),
+    ARMING_DISABLED_REBOOT_REQUIRED = (1 << 21),
+    ARMING_DISABLED_ARM_SWITCH = (1 << 22),
+} armingDisableFlags_e;
+
+
+
+extern const char *armingDisableFlagNames[((32*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) + (16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L) + (8*((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L)) >>8*((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L)) >>8*((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L))>255))/2+1))))) + 1)];
+
+void setArmingDisabled(armingDisableFlags_e flag);
+void unsetArmingDisabled(armingDisableFlags_e flag);
+
+# 74 "./src/main/fc/runtime_config.h" 3 4
+_Bool 
+# 74 "./src/main/fc/runtime_config.h"
+    isArmingDisabled(void);
+armingDisableFlags_e getArmingDisableFlags(void);
+
+typedef enum {
+    ANGLE_MODE = (1 << 0),
+    HORIZON_MODE = (1 << 1),
+    MAG_MODE = (1 << 2),
+
+
+
+    HEADFREE_MODE = (1 << 6),
+
+    PASSTHRU_MODE = (1 << 8),
+
+    FAILSAFE_MODE = (1 << 10),
+    GPS_RESCUE_MODE = (1 << 11)
+} flightModeFlags_e;
+
+extern uint16_t flightModeFlags;
+# 111 "./src/main/fc/runtime_config.h"
+typedef enum {
+    GPS_FIX_HOME = (1 << 0),
+    GPS_FIX = (1 << 1),
+    CALIBRATE_MAG = (1 << 2),
+    SMALL_ANGLE = (1 << 3),
+    FIXED_WING = (1 << 4)
+} stateFlags_t;
+
+
+
+
+
+extern uint8_t stateFlags;
+
+uint16_t enableFlightMode(flightModeFlags_e mask);
+uint16_t disableFlightMode(flightModeFlags_e mask);
+
+
+# 128 "./src/main/fc/runtime_config.h" 3 4
+_Bool 
+# 128 "./src/main/fc/runtime_config.h"
+    sensors(uint32_t mask);
+void sensorsSet(uint32_t mask);
+void sensorsClear(uint32_t mask);
+uint32_t sensorsMask(void);
+
+void mwDisarm(void);
+# 60 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/flight/failsafe.h" 1
+# 21 "./src/main/flight/failsafe.h"
+       
+# 35 "./src/main/flight/failsafe.h"
+typedef struct failsafeConfig_s {
+    uint16_t failsafe_throttle;
+    uint16_t failsafe_throttle_low_delay;
+    uint8_t failsafe_delay;
+    uint8_t failsafe_off_delay;
+    uint8_t failsafe_switch_mode;
+    uint8_t failsafe_procedure;
+    uint16_t failsafe_recovery_delay;
+    uint8_t failsafe_stick_threshold;
+} failsafeConfig_t;
+
+extern failsafeConfig_t failsafeConfig_System; extern failsafeConfig_t failsafeConfig_Copy; static inline const failsafeConfig_t* failsafeConfig(void) { return &failsafeConfig_System; } static inline failsafeConfig_t* failsafeConfigMutable(void) { return &failsafeConfig_System; } struct _dummy;
+
+typedef enum {
+    FAILSAFE_IDLE = 0,
+    FAILSAFE_RX_LOSS_DETECTED,
+    FAILSAFE_LANDING,
+    FAILSAFE_LANDED,
+    FAILSAFE_RX_LOSS_MONITORING,
+    FAILSAFE_RX_LOSS_RECOVERED,
+    FAILSAFE_GPS_RESCUE
+} failsafePhase_e;
+
+typedef enum {
+    FAILSAFE_RXLINK_DOWN = 0,
+    FAILSAFE_RXLINK_UP
+} failsafeRxLinkState_e;
+
+typedef enum {
+    FAILSAFE_PROCEDURE_AUTO_LANDING = 0,
+    FAILSAFE_PROCEDURE_DROP_IT,
+
+
+
+    FAILSAFE_PROCEDURE_COUNT
+} failsafeProcedure_e;
+
+extern const char * const failsafeProcedureNames[FAILSAFE_PROCEDURE_COUNT];
+
+typedef enum {
+    FAILSAFE_SWITCH_MODE_STAGE1 = 0,
+    FAILSAFE_SWITCH_MODE_KILL,
+    FAILSAFE_SWITCH_MODE_STAGE2
+} failsafeSwitchMode_e;
+
+typedef struct failsafeState_s {
+    int16_t events;
+    
+# 82 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 82 "./src/main/flight/failsafe.h"
+        monitoring;
+    
+# 83 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 83 "./src/main/flight/failsafe.h"
+        active;
+    uint32_t rxDataFailurePeriod;
+    uint32_t rxDataRecoveryPeriod;
+    uint32_t validRxDataReceivedAt;
+    uint32_t validRxDataFailedAt;
+    uint32_t throttleLowPeriod;
+    uint32_t landingShouldBeFinishedAt;
+    uint32_t receivingRxDataPeriod;
+    uint32_t receivingRxDataPeriodPreset;
+    failsafePhase_e phase;
+    failsafeRxLinkState_e rxLinkState;
+} failsafeState_t;
+
+void failsafeInit(void);
+void failsafeReset(void);
+
+void failsafeStartMonitoring(void);
+void failsafeUpdateState(void);
+
+failsafePhase_e failsafePhase(void);
+
+# 103 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 103 "./src/main/flight/failsafe.h"
+    failsafeIsMonitoring(void);
+
+# 104 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 104 "./src/main/flight/failsafe.h"
+    failsafeIsActive(void);
+
+# 105 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 105 "./src/main/flight/failsafe.h"
+    failsafeIsReceivingRxData(void);
+void failsafeOnRxSuspend(uint32_t suspendPeriod);
+void failsafeOnRxResume(void);
+
+void failsafeOnValidDataReceived(void);
+void failsafeOnValidDataFailed(void);
+# 62 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/mixer.h" 1
+# 21 "./src/main/flight/mixer.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/pwm_output_counts.h" 1
+# 21 "./src/main/drivers/pwm_output_counts.h"
+       
+# 28 "./src/main/flight/mixer.h" 2
+
+# 1 "./src/main/drivers/pwm_output.h" 1
+# 21 "./src/main/drivers/pwm_output.h"
+       
+
+
+
+
+
+
+
+# 1 "./src/main/drivers/timer.h" 1
+# 21 "./src/main/drivers/timer.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/timer_def.h" 1
+# 21 "./src/main/drivers/timer_def.h"
+       
+# 29 "./src/main/drivers/timer.h" 2
+
+# 1 "./src/main/pg/timerio.h" 1
+# 21 "./src/main/pg/timerio.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/io.h" 1
+# 21 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 21 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_GYRO_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_GYRO_EXTI,
+    OWNER_BARO_EXTI,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_TRANSPONDER,
+    OWNER_VTX_POWER,
+    OWNER_VTX_CS,
+    OWNER_VTX_DATA,
+    OWNER_VTX_CLK,
+    OWNER_COMPASS_CS,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_USB_MSC_PIN,
+    OWNER_MCO,
+    OWNER_RX_SPI_BIND,
+    OWNER_RX_SPI_LED,
+    OWNER_PREINIT,
+    OWNER_RX_SPI_EXTI,
+    OWNER_RX_SPI_CC2500_TX_EN,
+    OWNER_RX_SPI_CC2500_LNA_EN,
+    OWNER_RX_SPI_CC2500_ANT_SEL,
+    OWNER_QUADSPI_CLK,
+    OWNER_QUADSPI_BK1IO0,
+    OWNER_QUADSPI_BK1IO1,
+    OWNER_QUADSPI_BK1IO2,
+    OWNER_QUADSPI_BK1IO3,
+    OWNER_QUADSPI_BK1CS,
+    OWNER_QUADSPI_BK2IO0,
+    OWNER_QUADSPI_BK2IO1,
+    OWNER_QUADSPI_BK2IO2,
+    OWNER_QUADSPI_BK2IO3,
+    OWNER_QUADSPI_BK2CS,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 29 "./src/main/drivers/io.h" 2
+# 128 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 21 "./src/main/drivers/io_def.h"
+       
+# 54 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 21 "./src/main/drivers/io_def_generated.h"
+       
+# 55 "./src/main/drivers/io_def.h" 2
+# 129 "./src/main/drivers/io.h" 2
+
+
+# 130 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 130 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 131 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 131 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+
+# 139 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 139 "./src/main/drivers/io.h"
+    IOIsFreeOrPreinit(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 27 "./src/main/pg/timerio.h" 2
+# 31 "./src/main/drivers/timer.h" 2
+
+
+
+
+
+typedef uint16_t captureCompare_t;
+# 64 "./src/main/drivers/timer.h"
+typedef uint32_t timCCR_t;
+typedef uint32_t timCCER_t;
+typedef uint32_t timSR_t;
+typedef uint32_t timCNT_t;
+
+
+
+
+typedef enum {
+    TIM_USE_ANY = 0x0,
+    TIM_USE_NONE = 0x0,
+    TIM_USE_PPM = 0x1,
+    TIM_USE_PWM = 0x2,
+    TIM_USE_MOTOR = 0x4,
+    TIM_USE_SERVO = 0x8,
+    TIM_USE_LED = 0x10,
+    TIM_USE_TRANSPONDER = 0x20,
+    TIM_USE_BEEPER = 0x40,
+    TIM_USE_CAMERA_CONTROL = 0x80,
+} timerUsageFlag_e;
+
+
+struct timerCCHandlerRec_s;
+struct timerOvrHandlerRec_s;
+typedef void timerCCHandlerCallback(struct timerCCHandlerRec_s* self, uint16_t capture);
+typedef void timerOvrHandlerCallback(struct timerOvrHandlerRec_s* self, uint16_t capture);
+
+typedef struct timerCCHandlerRec_s {
+    timerCCHandlerCallback* fn;
+} timerCCHandlerRec_t;
+
+typedef struct timerOvrHandlerRec_s {
+    timerOvrHandlerCallback* fn;
+    struct timerOvrHandlerRec_s* next;
+} timerOvrHandlerRec_t;
+
+typedef struct timerDef_s {
+    TIM_TypeDef *TIMx;
+    rccPeriphTag_t rcc;
+    uint8_t inputIrq;
+} timerDef_t;
+
+typedef struct timerHardware_s {
+    TIM_TypeDef *tim;
+    ioTag_t tag;
+    uint8_t channel;
+    timerUsageFlag_e usageFlags;
+    uint8_t output;
+# 150 "./src/main/drivers/timer.h"
+} timerHardware_t;
+
+typedef enum {
+    TIMER_OUTPUT_NONE = 0,
+    TIMER_OUTPUT_INVERTED = (1 << 0),
+    TIMER_OUTPUT_N_CHANNEL = (1 << 1),
+} timerFlag_e;
+# 181 "./src/main/drivers/timer.h"
+extern const timerHardware_t timerHardware[];
+# 223 "./src/main/drivers/timer.h"
+extern const timerDef_t timerDefinitions[];
+
+typedef enum {
+    TYPE_FREE,
+    TYPE_PWMINPUT,
+    TYPE_PPMINPUT,
+    TYPE_PWMOUTPUT_MOTOR,
+    TYPE_PWMOUTPUT_FAST,
+    TYPE_PWMOUTPUT_SERVO,
+    TYPE_SOFTSERIAL_RX,
+    TYPE_SOFTSERIAL_TX,
+    TYPE_SOFTSERIAL_RXTX,
+    TYPE_SOFTSERIAL_AUXTIMER,
+    TYPE_ADC,
+    TYPE_SERIAL_RX,
+    TYPE_SERIAL_TX,
+    TYPE_SERIAL_RXTX,
+    TYPE_TIMER
+} channelType_t;
+
+void timerConfigure(const timerHardware_t *timHw, uint16_t period, uint32_t hz);
+
+void timerChConfigIC(const timerHardware_t *timHw, 
+# 245 "./src/main/drivers/timer.h" 3 4
+                                                  _Bool 
+# 245 "./src/main/drivers/timer.h"
+                                                       polarityRising, unsigned inputFilterSamples);
+void timerChConfigICDual(const timerHardware_t* timHw, 
+# 246 "./src/main/drivers/timer.h" 3 4
+                                                      _Bool 
+# 246 "./src/main/drivers/timer.h"
+                                                           polarityRising, unsigned inputFilterSamples);
+void timerChICPolarity(const timerHardware_t *timHw, 
+# 247 "./src/main/drivers/timer.h" 3 4
+                                                    _Bool 
+# 247 "./src/main/drivers/timer.h"
+                                                         polarityRising);
+volatile timCCR_t* timerChCCR(const timerHardware_t* timHw);
+volatile timCCR_t* timerChCCRLo(const timerHardware_t* timHw);
+volatile timCCR_t* timerChCCRHi(const timerHardware_t* timHw);
+void timerChConfigOC(const timerHardware_t* timHw, 
+# 251 "./src/main/drivers/timer.h" 3 4
+                                                  _Bool 
+# 251 "./src/main/drivers/timer.h"
+                                                       outEnable, 
+# 251 "./src/main/drivers/timer.h" 3 4
+                                                                  _Bool 
+# 251 "./src/main/drivers/timer.h"
+                                                                       stateHigh);
+void timerChConfigGPIO(const timerHardware_t* timHw, ioConfig_t mode);
+
+void timerChCCHandlerInit(timerCCHandlerRec_t *self, timerCCHandlerCallback *fn);
+void timerChOvrHandlerInit(timerOvrHandlerRec_t *self, timerOvrHandlerCallback *fn);
+void timerChConfigCallbacks(const timerHardware_t *channel, timerCCHandlerRec_t *edgeCallback, timerOvrHandlerRec_t *overflowCallback);
+void timerChConfigCallbacksDual(const timerHardware_t *channel, timerCCHandlerRec_t *edgeCallbackLo, timerCCHandlerRec_t *edgeCallbackHi, timerOvrHandlerRec_t *overflowCallback);
+void timerChITConfigDualLo(const timerHardware_t* timHw, FunctionalState newState);
+void timerChITConfig(const timerHardware_t* timHw, FunctionalState newState);
+void timerChClearCCFlag(const timerHardware_t* timHw);
+
+void timerChInit(const timerHardware_t *timHw, channelType_t type, int irqPriority, uint8_t irq);
+
+void timerInit(void);
+void timerStart(void);
+void timerForceOverflow(TIM_TypeDef *tim);
+
+uint32_t timerClock(TIM_TypeDef *tim);
+
+void configTimeBase(TIM_TypeDef *tim, uint16_t period, uint32_t hz);
+
+rccPeriphTag_t timerRCC(TIM_TypeDef *tim);
+uint8_t timerInputIrq(TIM_TypeDef *tim);
+
+
+
+
+const timerHardware_t *timerGetByTag(ioTag_t ioTag);
+const timerHardware_t *timerGetByTagAndIndex(ioTag_t ioTag, unsigned timerIndex);
+ioTag_t timerioTagGetByUsage(timerUsageFlag_e usageFlag, uint8_t index);
+
+
+
+
+
+
+
+void timerOCInit(TIM_TypeDef *tim, uint8_t channel, TIM_OCInitTypeDef *init);
+void timerOCPreloadConfig(TIM_TypeDef *tim, uint8_t channel, uint16_t preload);
+
+
+volatile timCCR_t *timerCCR(TIM_TypeDef *tim, uint8_t channel);
+uint16_t timerDmaSource(uint8_t channel);
+
+uint16_t timerGetPrescalerByDesiredHertz(TIM_TypeDef *tim, uint32_t hz);
+uint16_t timerGetPrescalerByDesiredMhz(TIM_TypeDef *tim, uint16_t mhz);
+uint16_t timerGetPeriodByPrescaler(TIM_TypeDef *tim, uint16_t prescaler, uint32_t hz);
+
+int8_t timerGetTIMNumber(const TIM_TypeDef *tim);
+uint8_t timerLookupChannelIndex(const uint16_t channel);
+# 30 "./src/main/drivers/pwm_output.h" 2
+# 49 "./src/main/drivers/pwm_output.h"
+typedef enum {
+    DSHOT_CMD_MOTOR_STOP = 0,
+    DSHOT_CMD_BEACON1,
+    DSHOT_CMD_BEACON2,
+    DSHOT_CMD_BEACON3,
+    DSHOT_CMD_BEACON4,
+    DSHOT_CMD_BEACON5,
+    DSHOT_CMD_ESC_INFO,
+    DSHOT_CMD_SPIN_DIRECTION_1,
+    DSHOT_CMD_SPIN_DIRECTION_2,
+    DSHOT_CMD_3D_MODE_OFF,
+    DSHOT_CMD_3D_MODE_ON,
+    DSHOT_CMD_SETTINGS_REQUEST,
+    DSHOT_CMD_SAVE_SETTINGS,
+    DSHOT_CMD_SPIN_DIRECTION_NORMAL = 20,
+    DSHOT_CMD_SPIN_DIRECTION_REVERSED = 21,
+    DSHOT_CMD_LED0_ON,
+    DSHOT_CMD_LED1_ON,
+    DSHOT_CMD_LED2_ON,
+    DSHOT_CMD_LED3_ON,
+    DSHOT_CMD_LED0_OFF,
+    DSHOT_CMD_LED1_OFF,
+    DSHOT_CMD_LED2_OFF,
+    DSHOT_CMD_LED3_OFF,
+    DSHOT_CMD_AUDIO_STREAM_MODE_ON_OFF = 30,
+    DSHOT_CMD_SILENT_MODE_ON_OFF = 31,
+    DSHOT_CMD_SIGNAL_LINE_TELEMETRY_DISABLE = 32,
+    DSHOT_CMD_SIGNAL_LINE_CONTINUOUS_ERPM_TELEMETRY = 33,
+    DSHOT_CMD_MAX = 47
+} dshotCommands_e;
+
+
+
+
+typedef enum {
+    PWM_TYPE_STANDARD = 0,
+    PWM_TYPE_ONESHOT125,
+    PWM_TYPE_ONESHOT42,
+    PWM_TYPE_MULTISHOT,
+    PWM_TYPE_BRUSHED,
+
+
+
+
+
+
+
+    PWM_TYPE_MAX
+} motorPwmProtocolTypes_e;
+# 125 "./src/main/drivers/pwm_output.h"
+typedef struct {
+    TIM_TypeDef *timer;
+# 145 "./src/main/drivers/pwm_output.h"
+    uint16_t timerDmaSources;
+} motorDmaTimer_t;
+
+typedef struct {
+    ioTag_t ioTag;
+    const timerHardware_t *timerHardware;
+    uint16_t value;
+# 187 "./src/main/drivers/pwm_output.h"
+    motorDmaTimer_t *timer;
+    volatile 
+# 188 "./src/main/drivers/pwm_output.h" 3 4
+            _Bool 
+# 188 "./src/main/drivers/pwm_output.h"
+                 requestTelemetry;
+# 197 "./src/main/drivers/pwm_output.h"
+    uint8_t dmaBuffer[18];
+
+
+} motorDmaOutput_t;
+
+motorDmaOutput_t *getMotorDmaOutput(uint8_t index);
+
+struct timerHardware_s;
+typedef void pwmWriteFn(uint8_t index, float value);
+typedef void pwmCompleteWriteFn(uint8_t motorCount);
+typedef 
+# 207 "./src/main/drivers/pwm_output.h" 3 4
+       _Bool 
+# 207 "./src/main/drivers/pwm_output.h"
+            pwmStartWriteFn(uint8_t motorCount);
+
+typedef struct {
+    volatile timCCR_t *ccr;
+    TIM_TypeDef *tim;
+} timerChannel_t;
+
+typedef struct {
+    timerChannel_t channel;
+    float pulseScale;
+    float pulseOffset;
+    
+# 218 "./src/main/drivers/pwm_output.h" 3 4
+   _Bool 
+# 218 "./src/main/drivers/pwm_output.h"
+        forceOverflow;
+    
+# 219 "./src/main/drivers/pwm_output.h" 3 4
+   _Bool 
+# 219 "./src/main/drivers/pwm_output.h"
+        enabled;
+    IO_t io;
+} pwmOutputPort_t;
+
+
+typedef struct motorDevConfig_s {
+    uint16_t motorPwmRate;
+    uint8_t motorPwmProtocol;
+    uint8_t motorPwmInversion;
+    uint8_t useUnsyncedPwm;
+    uint8_t useBurstDshot;
+    uint8_t useDshotTelemetry;
+    ioTag_t ioTags[8];
+} motorDevConfig_t;
+
+extern 
+# 234 "./src/main/drivers/pwm_output.h" 3 4
+      _Bool 
+# 234 "./src/main/drivers/pwm_output.h"
+           useBurstDshot;
+
+
+
+
+
+void motorDevInit(const motorDevConfig_t *motorDevConfig, uint16_t idlePulse, uint8_t motorCount);
+
+typedef struct servoDevConfig_s {
+
+    uint16_t servoCenterPulse;
+    uint16_t servoPwmRate;
+    ioTag_t ioTags[8];
+} servoDevConfig_t;
+
+void servoDevInit(const servoDevConfig_t *servoDevConfig);
+
+void pwmServoConfig(const struct timerHardware_s *timerHardware, uint8_t servoIndex, uint16_t servoPwmRate, uint16_t servoCenterPulse);
+
+
+# 253 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 253 "./src/main/drivers/pwm_output.h"
+    isMotorProtocolDshot(void);
+# 297 "./src/main/drivers/pwm_output.h"
+void pwmOutConfig(timerChannel_t *channel, const timerHardware_t *timerHardware, uint32_t hz, uint16_t period, uint16_t value, uint8_t inversion);
+
+void pwmWriteMotor(uint8_t index, float value);
+void pwmShutdownPulsesForAllMotors(uint8_t motorCount);
+void pwmCompleteMotorUpdate(uint8_t motorCount);
+
+# 302 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 302 "./src/main/drivers/pwm_output.h"
+    pwmStartMotorUpdate(uint8_t motorCount);
+
+void pwmWriteServo(uint8_t index, float value);
+
+pwmOutputPort_t *pwmGetMotors(void);
+
+# 307 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 307 "./src/main/drivers/pwm_output.h"
+    pwmIsSynced(void);
+void pwmDisableMotors(void);
+void pwmEnableMotors(void);
+
+# 310 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 310 "./src/main/drivers/pwm_output.h"
+    pwmAreMotorsEnabled(void);
+# 30 "./src/main/flight/mixer.h" 2
+# 39 "./src/main/flight/mixer.h"
+typedef enum mixerMode
+{
+    MIXER_TRI = 1,
+    MIXER_QUADP = 2,
+    MIXER_QUADX = 3,
+    MIXER_BICOPTER = 4,
+    MIXER_GIMBAL = 5,
+    MIXER_Y6 = 6,
+    MIXER_HEX6 = 7,
+    MIXER_FLYING_WING = 8,
+    MIXER_Y4 = 9,
+    MIXER_HEX6X = 10,
+    MIXER_OCTOX8 = 11,
+    MIXER_OCTOFLATP = 12,
+    MIXER_OCTOFLATX = 13,
+    MIXER_AIRPLANE = 14,
+    MIXER_HELI_120_CCPM = 15,
+    MIXER_HELI_90_DEG = 16,
+    MIXER_VTAIL4 = 17,
+    MIXER_HEX6H = 18,
+    MIXER_PPM_TO_SERVO = 19,
+    MIXER_DUALCOPTER = 20,
+    MIXER_SINGLECOPTER = 21,
+    MIXER_ATAIL4 = 22,
+    MIXER_CUSTOM = 23,
+    MIXER_CUSTOM_AIRPLANE = 24,
+    MIXER_CUSTOM_TRI = 25,
+    MIXER_QUADX_1234 = 26
+} mixerMode_e;
+
+
+typedef struct motorMixer_s {
+    float throttle;
+    float roll;
+    float pitch;
+    float yaw;
+} motorMixer_t;
+
+extern motorMixer_t customMotorMixer_SystemArray[8]; extern motorMixer_t customMotorMixer_CopyArray[8]; static inline const motorMixer_t* customMotorMixer(int _index) { return &customMotorMixer_SystemArray[_index]; } static inline motorMixer_t* customMotorMixerMutable(int _index) { return &customMotorMixer_SystemArray[_index]; } static inline motorMixer_t (* customMotorMixer_array(void))[8] { return &customMotorMixer_SystemArray; } struct _dummy;
+
+
+typedef struct mixer_s {
+    uint8_t motorCount;
+    uint8_t useServo;
+    const motorMixer_t *motor;
+} mixer_t;
+
+typedef struct mixerConfig_s {
+    uint8_t mixerMode;
+    
+# 88 "./src/main/flight/mixer.h" 3 4
+   _Bool 
+# 88 "./src/main/flight/mixer.h"
+        yaw_motors_reversed;
+    uint8_t crashflip_motor_percent;
+} mixerConfig_t;
+
+extern mixerConfig_t mixerConfig_System; extern mixerConfig_t mixerConfig_Copy; static inline const mixerConfig_t* mixerConfig(void) { return &mixerConfig_System; } static inline mixerConfig_t* mixerConfigMutable(void) { return &mixerConfig_System; } struct _dummy;
+
+typedef struct motorConfig_s {
+    motorDevConfig_t dev;
+    uint16_t digitalIdleOffsetValue;
+    uint16_t minthrottle;
+    uint16_t maxthrottle;
+    uint16_t mincommand;
+    uint8_t motorPoleCount;
+} motorConfig_t;
+
+extern motorConfig_t motorConfig_System; extern motorConfig_t motorConfig_Copy; static inline const motorConfig_t* motorConfig(void) { return &motorConfig_System; } static inline motorConfig_t* motorConfigMutable(void) { return &motorConfig_System; } struct _dummy;
+
+
+
+extern const mixer_t mixers[];
+extern float motor[8];
+extern float motor_disarmed[8];
+extern float motorOutputHigh, motorOutputLow;
+struct rxConfig_s;
+
+uint8_t getMotorCount(void);
+float getMotorMixRange(void);
+
+# 115 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 115 "./src/main/flight/mixer.h"
+    areMotorsRunning(void);
+
+void mixerLoadMix(int index, motorMixer_t *customMixers);
+void initEscEndpoints(void);
+void mixerInit(mixerMode_e mixerMode);
+
+void mixerConfigureOutput(void);
+
+void mixerResetDisarmedMotors(void);
+void mixTable(timeUs_t currentTimeUs, uint8_t vbatPidCompensation);
+void syncMotors(
+# 125 "./src/main/flight/mixer.h" 3 4
+               _Bool 
+# 125 "./src/main/flight/mixer.h"
+                    enabled);
+void writeMotors(void);
+void stopMotors(void);
+void stopPwmAllMotors(void);
+
+float convertExternalToMotor(uint16_t externalValue);
+uint16_t convertMotorToExternal(float motorValue);
+
+# 132 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 132 "./src/main/flight/mixer.h"
+    mixerIsTricopter(void);
+
+void mixerSetThrottleAngleCorrection(int correctionValue);
+float mixerGetLoggingThrottle(void);
+
+# 136 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 136 "./src/main/flight/mixer.h"
+    isDshotTelemetryActive(void);
+# 63 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/pid.h" 1
+# 21 "./src/main/flight/pid.h"
+       
+# 51 "./src/main/flight/pid.h"
+typedef enum {
+    PID_ROLL,
+    PID_PITCH,
+    PID_YAW,
+    PID_LEVEL,
+    PID_MAG,
+    PID_ITEM_COUNT
+} pidIndex_e;
+
+typedef enum {
+    SUPEREXPO_YAW_OFF = 0,
+    SUPEREXPO_YAW_ON,
+    SUPEREXPO_YAW_ALWAYS
+} pidSuperExpoYaw_e;
+
+typedef enum {
+    PID_STABILISATION_OFF = 0,
+    PID_STABILISATION_ON
+} pidStabilisationState_e;
+
+typedef enum {
+    PID_CRASH_RECOVERY_OFF = 0,
+    PID_CRASH_RECOVERY_ON,
+    PID_CRASH_RECOVERY_BEEP,
+    PID_CRASH_RECOVERY_DISARM,
+} pidCrashRecovery_e;
+
+typedef struct pidf_s {
+    uint8_t P;
+    uint8_t I;
+    uint8_t D;
+    uint16_t F;
+} pidf_t;
+
+typedef enum {
+    ANTI_GRAVITY_SMOOTH,
+    ANTI_GRAVITY_STEP
+} antiGravityMode_e;
+
+typedef enum {
+    ITERM_RELAX_OFF,
+    ITERM_RELAX_RP,
+    ITERM_RELAX_RPY,
+    ITERM_RELAX_RP_INC,
+    ITERM_RELAX_RPY_INC
+} itermRelax_e;
+
+typedef enum {
+    ITERM_RELAX_GYRO,
+    ITERM_RELAX_SETPOINT
+} itermRelaxType_e;
+
+
+
+typedef struct pidProfile_s {
+    uint16_t yaw_lowpass_hz;
+    uint16_t dterm_lowpass_hz;
+    uint16_t dterm_notch_hz;
+    uint16_t dterm_notch_cutoff;
+
+    pidf_t pid[PID_ITEM_COUNT];
+
+    uint8_t dterm_filter_type;
+    uint8_t itermWindupPointPercent;
+    uint16_t pidSumLimit;
+    uint16_t pidSumLimitYaw;
+    uint8_t pidAtMinThrottle;
+    uint8_t levelAngleLimit;
+
+    uint8_t horizon_tilt_effect;
+    uint8_t horizon_tilt_expert_mode;
+
+
+    uint8_t antiGravityMode;
+    uint16_t itermThrottleThreshold;
+    uint16_t itermAcceleratorGain;
+    uint16_t yawRateAccelLimit;
+    uint16_t rateAccelLimit;
+    uint16_t crash_dthreshold;
+    uint16_t crash_gthreshold;
+    uint16_t crash_setpoint_threshold;
+    uint16_t crash_time;
+    uint16_t crash_delay;
+    uint8_t crash_recovery_angle;
+    uint8_t crash_recovery_rate;
+    uint8_t vbatPidCompensation;
+    uint8_t feedForwardTransition;
+    uint16_t crash_limit_yaw;
+    uint16_t itermLimit;
+    uint16_t dterm_lowpass2_hz;
+    uint8_t crash_recovery;
+    uint8_t throttle_boost;
+    uint8_t throttle_boost_cutoff;
+    uint8_t iterm_rotation;
+    uint8_t iterm_relax_type;
+    uint8_t iterm_relax_cutoff;
+    uint8_t iterm_relax;
+    uint8_t acro_trainer_angle_limit;
+    uint8_t acro_trainer_debug_axis;
+    uint8_t acro_trainer_gain;
+    uint16_t acro_trainer_lookahead_ms;
+    uint8_t abs_control_gain;
+    uint8_t abs_control_limit;
+    uint8_t abs_control_error_limit;
+    uint8_t abs_control_cutoff;
+    uint8_t dterm_filter2_type;
+    uint16_t dyn_lpf_dterm_min_hz;
+    uint16_t dyn_lpf_dterm_max_hz;
+    uint8_t launchControlMode;
+    uint8_t launchControlThrottlePercent;
+    uint8_t launchControlAngleLimit;
+    uint8_t launchControlGain;
+    uint8_t launchControlAllowTriggerReset;
+    uint8_t use_integrated_yaw;
+    uint8_t integrated_yaw_relax;
+    uint8_t thrustLinearization;
+    uint8_t d_min[3];
+    uint8_t d_min_gain;
+    uint8_t d_min_advance;
+    uint8_t motor_output_limit;
+    int8_t auto_profile_cell_count;
+    uint8_t transient_throttle_limit;
+    char profileName[8u + 1];
+} pidProfile_t;
+
+extern pidProfile_t pidProfiles_SystemArray[3]; extern pidProfile_t pidProfiles_CopyArray[3]; static inline const pidProfile_t* pidProfiles(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t* pidProfilesMutable(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t (* pidProfiles_array(void))[3] { return &pidProfiles_SystemArray; } struct _dummy;
+
+typedef struct pidConfig_s {
+    uint8_t pid_process_denom;
+    uint8_t runaway_takeoff_prevention;
+    uint16_t runaway_takeoff_deactivate_delay;
+    uint8_t runaway_takeoff_deactivate_throttle;
+} pidConfig_t;
+
+extern pidConfig_t pidConfig_System; extern pidConfig_t pidConfig_Copy; static inline const pidConfig_t* pidConfig(void) { return &pidConfig_System; } static inline pidConfig_t* pidConfigMutable(void) { return &pidConfig_System; } struct _dummy;
+
+union rollAndPitchTrims_u;
+void pidController(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
+
+typedef struct pidAxisData_s {
+    float P;
+    float I;
+    float D;
+    float F;
+
+    float Sum;
+} pidAxisData_t;
+
+extern const char pidNames[];
+
+extern pidAxisData_t pidData[3];
+
+extern uint32_t targetPidLooptime;
+
+extern float throttleBoost;
+extern pt1Filter_t throttleLpf;
+
+void pidResetIterm(void);
+void pidStabilisationState(pidStabilisationState_e pidControllerState);
+void pidSetItermAccelerator(float newItermAccelerator);
+void pidInitFilters(const pidProfile_t *pidProfile);
+void pidInitConfig(const pidProfile_t *pidProfile);
+void pidInit(const pidProfile_t *pidProfile);
+void pidChangeProfile(uint8_t pidProfileIndex);
+void pidCopyProfile(uint8_t dstPidProfileIndex, uint8_t srcPidProfileIndex);
+
+# 216 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 216 "./src/main/flight/pid.h"
+    crashRecoveryModeActive(void);
+void pidAcroTrainerInit(void);
+void pidSetAcroTrainerState(
+# 218 "./src/main/flight/pid.h" 3 4
+                           _Bool 
+# 218 "./src/main/flight/pid.h"
+                                newState);
+void pidInitSetpointDerivativeLpf(uint16_t filterCutoff, uint8_t debugAxis, uint8_t filterType);
+void pidUpdateSetpointDerivativeLpf(uint16_t filterCutoff);
+void pidUpdateAntiGravityThrottleFilter(float throttle);
+
+# 222 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 222 "./src/main/flight/pid.h"
+    pidOsdAntiGravityActive(void);
+
+# 223 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 223 "./src/main/flight/pid.h"
+    pidOsdAntiGravityMode(void);
+void pidSetAntiGravityState(
+# 224 "./src/main/flight/pid.h" 3 4
+                           _Bool 
+# 224 "./src/main/flight/pid.h"
+                                newState);
+
+# 225 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 225 "./src/main/flight/pid.h"
+    pidAntiGravityEnabled(void);
+
+float pidApplyThrustLinearization(float motorValue);
+float pidCompensateThrustLinearization(float throttle);
+
+
+void pidUpdateAirmodeLpf(float currentOffset);
+float pidGetAirmodeThrottleOffset();
+# 246 "./src/main/flight/pid.h"
+void dynLpfDTermUpdate(float throttle);
+void pidSetItermReset(
+# 247 "./src/main/flight/pid.h" 3 4
+                     _Bool 
+# 247 "./src/main/flight/pid.h"
+                          enabled);
+float pidGetPreviousSetpoint(int axis);
+# 64 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/servos.h" 1
+# 21 "./src/main/flight/servos.h"
+       
+
+
+
+
+
+
+enum {
+    INPUT_STABILIZED_ROLL = 0,
+    INPUT_STABILIZED_PITCH,
+    INPUT_STABILIZED_YAW,
+    INPUT_STABILIZED_THROTTLE,
+    INPUT_RC_ROLL,
+    INPUT_RC_PITCH,
+    INPUT_RC_YAW,
+    INPUT_RC_THROTTLE,
+    INPUT_RC_AUX1,
+    INPUT_RC_AUX2,
+    INPUT_RC_AUX3,
+    INPUT_RC_AUX4,
+    INPUT_GIMBAL_PITCH,
+    INPUT_GIMBAL_ROLL,
+    INPUT_SOURCE_COUNT
+};
+
+
+typedef enum {
+    SERVO_GIMBAL_PITCH = 0,
+    SERVO_GIMBAL_ROLL = 1,
+    SERVO_FLAPS = 2,
+    SERVO_FLAPPERON_1 = 3,
+    SERVO_FLAPPERON_2 = 4,
+    SERVO_RUDDER = 5,
+    SERVO_ELEVATOR = 6,
+    SERVO_THROTTLE = 7,
+
+    SERVO_BICOPTER_LEFT = 4,
+    SERVO_BICOPTER_RIGHT = 5,
+
+    SERVO_DUALCOPTER_LEFT = 4,
+    SERVO_DUALCOPTER_RIGHT = 5,
+
+    SERVO_SINGLECOPTER_1 = 3,
+    SERVO_SINGLECOPTER_2 = 4,
+    SERVO_SINGLECOPTER_3 = 5,
+    SERVO_SINGLECOPTER_4 = 6,
+
+    SERVO_HELI_LEFT = 0,
+    SERVO_HELI_RIGHT = 1,
+    SERVO_HELI_TOP = 2,
+    SERVO_HELI_RUD = 3
+
+} servoIndex_e;
+# 89 "./src/main/flight/servos.h"
+typedef struct servoMixer_s {
+    uint8_t targetChannel;
+    uint8_t inputSource;
+    int8_t rate;
+    uint8_t speed;
+    int8_t min;
+    int8_t max;
+    uint8_t box;
+} servoMixer_t;
+
+extern servoMixer_t customServoMixers_SystemArray[(2 * 8)]; extern servoMixer_t customServoMixers_CopyArray[(2 * 8)]; static inline const servoMixer_t* customServoMixers(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t* customServoMixersMutable(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t (* customServoMixers_array(void))[(2 * 8)] { return &customServoMixers_SystemArray; } struct _dummy;
+
+
+
+
+
+typedef struct mixerRules_s {
+    uint8_t servoRuleCount;
+    const servoMixer_t *rule;
+} mixerRules_t;
+
+extern const mixerRules_t servoMixers[];
+
+typedef struct servoParam_s {
+    uint32_t reversedSources;
+    int16_t min;
+    int16_t max;
+    int16_t middle;
+    int8_t rate;
+    int8_t forwardFromChannel;
+} servoParam_t;
+
+extern servoParam_t servoParams_SystemArray[8]; extern servoParam_t servoParams_CopyArray[8]; static inline const servoParam_t* servoParams(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t* servoParamsMutable(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t (* servoParams_array(void))[8] { return &servoParams_SystemArray; } struct _dummy;
+
+typedef struct servoConfig_s {
+    servoDevConfig_t dev;
+    uint16_t servo_lowpass_freq;
+    uint8_t tri_unarmed_servo;
+    uint8_t channelForwardingStartChannel;
+} servoConfig_t;
+
+extern servoConfig_t servoConfig_System; extern servoConfig_t servoConfig_Copy; static inline const servoConfig_t* servoConfig(void) { return &servoConfig_System; } static inline servoConfig_t* servoConfigMutable(void) { return &servoConfig_System; } struct _dummy;
+
+typedef struct servoProfile_s {
+    servoParam_t servoConf[8];
+} servoProfile_t;
+
+extern int16_t servo[8];
+
+
+# 138 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 138 "./src/main/flight/servos.h"
+    isMixerUsingServos(void);
+void writeServos(void);
+void servoMixerLoadMix(int index);
+void loadCustomServoMixer(void);
+int servoDirection(int servoIndex, int fromChannel);
+void servoConfigureOutput(void);
+void servosInit(void);
+void servosFilterInit(void);
+void servoMixer(void);
+
+void servosTricopterInit(void);
+void servosTricopterMixer(void);
+
+# 150 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 150 "./src/main/flight/servos.h"
+    servosTricopterIsEnabledServoUnarmed(void);
+# 65 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/io/beeper.h" 1
+# 21 "./src/main/io/beeper.h"
+       
+# 32 "./src/main/io/beeper.h"
+typedef enum {
+
+    BEEPER_SILENCE = 0,
+
+    BEEPER_GYRO_CALIBRATED,
+    BEEPER_RX_LOST,
+    BEEPER_RX_LOST_LANDING,
+    BEEPER_DISARMING,
+    BEEPER_ARMING,
+    BEEPER_ARMING_GPS_FIX,
+    BEEPER_BAT_CRIT_LOW,
+    BEEPER_BAT_LOW,
+    BEEPER_GPS_STATUS,
+    BEEPER_RX_SET,
+    BEEPER_ACC_CALIBRATION,
+    BEEPER_ACC_CALIBRATION_FAIL,
+    BEEPER_READY_BEEP,
+    BEEPER_MULTI_BEEPS,
+    BEEPER_DISARM_REPEAT,
+    BEEPER_ARMED,
+    BEEPER_SYSTEM_INIT,
+    BEEPER_USB,
+    BEEPER_BLACKBOX_ERASE,
+    BEEPER_CRASH_FLIP_MODE,
+    BEEPER_CAM_CONNECTION_OPEN,
+    BEEPER_CAM_CONNECTION_CLOSE,
+    BEEPER_RC_SMOOTHING_INIT_FAIL,
+    BEEPER_ARMING_GPS_NO_FIX,
+    BEEPER_ALL,
+
+} beeperMode_e;
+# 96 "./src/main/io/beeper.h"
+void beeper(beeperMode_e mode);
+void beeperSilence(void);
+void beeperUpdate(timeUs_t currentTimeUs);
+void beeperConfirmationBeeps(uint8_t beepCount);
+void beeperWarningBeeps(uint8_t beepCount);
+uint32_t getArmingBeepTimeMicros(void);
+beeperMode_e beeperModeForTableIndex(int idx);
+uint32_t beeperModeMaskForTableIndex(int idx);
+const char *beeperNameForTableIndex(int idx);
+int beeperTableEntryCount(void);
+
+# 106 "./src/main/io/beeper.h" 3 4
+_Bool 
+# 106 "./src/main/io/beeper.h"
+    isBeeperOn(void);
+timeUs_t getLastDshotBeaconCommandTimeUs(void);
+# 67 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/io/gps.h" 1
+# 21 "./src/main/io/gps.h"
+       
+# 35 "./src/main/io/gps.h"
+typedef enum {
+    GPS_NMEA = 0,
+    GPS_UBLOX,
+    GPS_MSP
+} gpsProvider_e;
+
+typedef enum {
+    SBAS_AUTO = 0,
+    SBAS_EGNOS,
+    SBAS_WAAS,
+    SBAS_MSAS,
+    SBAS_GAGAN
+} sbasMode_e;
+
+
+
+typedef enum {
+    GPS_BAUDRATE_115200 = 0,
+    GPS_BAUDRATE_57600,
+    GPS_BAUDRATE_38400,
+    GPS_BAUDRATE_19200,
+    GPS_BAUDRATE_9600
+} gpsBaudRate_e;
+
+typedef enum {
+    GPS_AUTOCONFIG_OFF = 0,
+    GPS_AUTOCONFIG_ON
+} gpsAutoConfig_e;
+
+typedef enum {
+    GPS_AUTOBAUD_OFF = 0,
+    GPS_AUTOBAUD_ON
+} gpsAutoBaud_e;
+
+
+
+
+
+
+typedef struct gpsConfig_s {
+    gpsProvider_e provider;
+    sbasMode_e sbasMode;
+    gpsAutoConfig_e autoConfig;
+    gpsAutoBaud_e autoBaud;
+    uint8_t gps_ublox_use_galileo;
+    uint8_t gps_set_home_point_once;
+    uint8_t gps_ublox_nav_pvt;
+    uint8_t gps_ublox_rate_hz;
+} gpsConfig_t;
+
+extern gpsConfig_t gpsConfig_System; extern gpsConfig_t gpsConfig_Copy; static inline const gpsConfig_t* gpsConfig(void) { return &gpsConfig_System; } static inline gpsConfig_t* gpsConfigMutable(void) { return &gpsConfig_System; } struct _dummy;
+
+typedef struct gpsCoordinateDDDMMmmmm_s {
+    int16_t dddmm;
+    int16_t mmmm;
+} gpsCoordinateDDDMMmmmm_t;
+
+
+typedef struct gpsLocation_s {
+    int32_t lat;
+    int32_t lon;
+    int32_t altCm;
+} gpsLocation_t;
+
+typedef struct gpsSolutionData_s {
+    gpsLocation_t llh;
+    uint16_t groundSpeed;
+    uint16_t groundCourse;
+    uint16_t hdop;
+    uint8_t numSat;
+} gpsSolutionData_t;
+
+typedef enum {
+    GPS_MESSAGE_STATE_IDLE = 0,
+    GPS_MESSAGE_STATE_INIT,
+    GPS_MESSAGE_STATE_SBAS,
+    GPS_MESSAGE_STATE_GALILEO,
+    GPS_MESSAGE_STATE_NAV_PVT,
+    GPS_MESSAGE_STATE_ENTRY_COUNT
+} gpsMessageState_e;
+
+typedef struct gpsData_s {
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t lastMessage;
+    uint32_t lastLastMessage;
+
+    uint32_t state_position;
+    uint32_t state_ts;
+    uint8_t state;
+    uint8_t baudrateIndex;
+    gpsMessageState_e messageState;
+} gpsData_t;
+
+
+extern char gpsPacketLog[21];
+
+extern int32_t GPS_home[2];
+extern uint16_t GPS_distanceToHome;
+extern int16_t GPS_directionToHome;
+extern uint32_t GPS_distanceFlownInCm;
+extern int16_t GPS_verticalSpeedInCmS;
+extern int16_t GPS_angle[2];
+extern float dTnav;
+extern float GPS_scaleLonDown;
+extern int16_t nav_takeoff_bearing;
+
+typedef enum {
+    NAV_MODE_NONE = 0,
+    NAV_MODE_POSHOLD,
+    NAV_MODE_WP
+} navigationMode_e;
+extern navigationMode_e nav_mode;
+
+typedef enum {
+    GPS_DIRECT_TICK = 1 << 0,
+    GPS_MSP_UPDATE = 1 << 1
+} gpsUpdateToggle_e;
+
+extern gpsData_t gpsData;
+extern gpsSolutionData_t gpsSol;
+
+extern uint8_t GPS_update;
+extern uint32_t GPS_packetCount;
+extern uint32_t GPS_svInfoReceivedCount;
+extern uint8_t GPS_numCh;
+extern uint8_t GPS_svinfo_chn[16];
+extern uint8_t GPS_svinfo_svid[16];
+extern uint8_t GPS_svinfo_quality[16];
+extern uint8_t GPS_svinfo_cno[16];
+
+
+
+
+void gpsInit(void);
+void gpsUpdate(timeUs_t currentTimeUs);
+
+# 171 "./src/main/io/gps.h" 3 4
+_Bool 
+# 171 "./src/main/io/gps.h"
+    gpsNewFrame(uint8_t c);
+
+# 172 "./src/main/io/gps.h" 3 4
+_Bool 
+# 172 "./src/main/io/gps.h"
+    gpsIsHealthy(void);
+struct serialPort_s;
+void gpsEnablePassthrough(struct serialPort_s *gpsPassthroughPort);
+void onGpsNewData(void);
+void GPS_reset_home_position(void);
+void GPS_calc_longitude_scaling(int32_t lat);
+void GPS_distance_cm_bearing(int32_t *currentLat1, int32_t *currentLon1, int32_t *destinationLat2, int32_t *destinationLon2, uint32_t *dist, int32_t *bearing);
+# 68 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/io/serial.h" 1
+# 21 "./src/main/io/serial.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/serial.h" 1
+# 21 "./src/main/drivers/serial.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_e;
+
+typedef enum {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 52 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_e;
+
+
+
+
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    portMode_e mode;
+    portOptions_e options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+
+    uint8_t identifier;
+} serialPort_t;
+# 97 "./src/main/drivers/serial.h"
+typedef struct serialPinConfig_s {
+    ioTag_t ioTagTx[10];
+    ioTag_t ioTagRx[10];
+    ioTag_t ioTagInverter[10];
+} serialPinConfig_t;
+
+extern serialPinConfig_t serialPinConfig_System; extern serialPinConfig_t serialPinConfig_Copy; static inline const serialPinConfig_t* serialPinConfig(void) { return &serialPinConfig_System; } static inline serialPinConfig_t* serialPinConfigMutable(void) { return &serialPinConfig_System; } struct _dummy;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 116 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 116 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_e mode);
+    void (*setCtrlLineStateCb)(serialPort_t *instance, void (*cb)(void *instance, uint16_t ctrlLineState), void *context);
+    void (*setBaudRateCb)(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+uint8_t serialRead(serialPort_t *instance);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_e mode);
+void serialSetCtrlLineStateCb(serialPort_t *instance, void (*cb)(void *context, uint16_t ctrlLineState), void *context);
+void serialSetBaudRateCb(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+# 137 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 137 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 28 "./src/main/io/serial.h" 2
+
+typedef enum {
+    PORTSHARING_UNUSED = 0,
+    PORTSHARING_NOT_SHARED,
+    PORTSHARING_SHARED
+} portSharing_e;
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_GPS = (1 << 1),
+    FUNCTION_TELEMETRY_FRSKY_HUB = (1 << 2),
+    FUNCTION_TELEMETRY_HOTT = (1 << 3),
+    FUNCTION_TELEMETRY_LTM = (1 << 4),
+    FUNCTION_TELEMETRY_SMARTPORT = (1 << 5),
+    FUNCTION_RX_SERIAL = (1 << 6),
+    FUNCTION_BLACKBOX = (1 << 7),
+    FUNCTION_TELEMETRY_MAVLINK = (1 << 9),
+    FUNCTION_ESC_SENSOR = (1 << 10),
+    FUNCTION_VTX_SMARTAUDIO = (1 << 11),
+    FUNCTION_TELEMETRY_IBUS = (1 << 12),
+    FUNCTION_VTX_TRAMP = (1 << 13),
+    FUNCTION_RCDEVICE = (1 << 14),
+    FUNCTION_LIDAR_TF = (1 << 15),
+} serialPortFunction_e;
+
+
+
+
+typedef enum {
+    BAUD_AUTO = 0,
+    BAUD_9600,
+    BAUD_19200,
+    BAUD_38400,
+    BAUD_57600,
+    BAUD_115200,
+    BAUD_230400,
+    BAUD_250000,
+    BAUD_400000,
+    BAUD_460800,
+    BAUD_500000,
+    BAUD_921600,
+    BAUD_1000000,
+    BAUD_1500000,
+    BAUD_2000000,
+    BAUD_2470000
+} baudRate_e;
+
+extern const uint32_t baudRates[];
+
+
+typedef enum {
+    SERIAL_PORT_NONE = -1,
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_UART4,
+    SERIAL_PORT_UART5,
+    SERIAL_PORT_USART6,
+    SERIAL_PORT_USART7,
+    SERIAL_PORT_USART8,
+    SERIAL_PORT_USB_VCP = 20,
+    SERIAL_PORT_SOFTSERIAL1 = 30,
+    SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+extern const serialPortIdentifier_e serialPortIdentifiers[8];
+# 103 "./src/main/io/serial.h"
+typedef struct serialPortBuffers_s {
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint16_t rxBufferSize;
+    uint16_t txBufferSize;
+    uint16_t rxBufferWanted;
+    uint16_t txBufferWanted;
+} serialPortBuffers_t;
+
+typedef struct serialPortUsage_s {
+    serialPort_t *serialPort;
+    serialPortFunction_e function;
+    serialPortIdentifier_e identifier;
+
+
+
+} serialPortUsage_t;
+
+serialPort_t *findSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+
+
+
+typedef struct serialPortConfig_s {
+    uint16_t functionMask;
+    serialPortIdentifier_e identifier;
+    uint8_t msp_baudrateIndex;
+    uint8_t gps_baudrateIndex;
+    uint8_t blackbox_baudrateIndex;
+    uint8_t telemetry_baudrateIndex;
+} serialPortConfig_t;
+
+typedef struct serialConfig_s {
+    serialPortConfig_t portConfigs[8];
+    uint16_t serial_update_rate_hz;
+    uint8_t reboot_character;
+} serialConfig_t;
+
+extern serialConfig_t serialConfig_System; extern serialConfig_t serialConfig_Copy; static inline const serialConfig_t* serialConfig(void) { return &serialConfig_System; } static inline serialConfig_t* serialConfigMutable(void) { return &serialConfig_System; } struct _dummy;
+
+typedef void serialConsumer(uint8_t);
+
+
+
+
+void serialInit(
+# 148 "./src/main/io/serial.h" 3 4
+               _Bool 
+# 148 "./src/main/io/serial.h"
+                    softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+void serialRemovePort(serialPortIdentifier_e identifier);
+uint8_t serialGetAvailablePortCount(void);
+
+# 151 "./src/main/io/serial.h" 3 4
+_Bool 
+# 151 "./src/main/io/serial.h"
+    serialIsPortAvailable(serialPortIdentifier_e identifier);
+
+# 152 "./src/main/io/serial.h" 3 4
+_Bool 
+# 152 "./src/main/io/serial.h"
+    isSerialConfigValid(const serialConfig_t *serialConfig);
+serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e identifier);
+
+# 154 "./src/main/io/serial.h" 3 4
+_Bool 
+# 154 "./src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function);
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function);
+
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function);
+
+# 159 "./src/main/io/serial.h" 3 4
+_Bool 
+# 159 "./src/main/io/serial.h"
+    isSerialPortShared(const serialPortConfig_t *portConfig, uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+void pgResetFn_serialConfig(serialConfig_t *serialConfig);
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
+int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+
+
+
+
+
+
+serialPort_t *openSerialPort(
+    serialPortIdentifier_e identifier,
+    serialPortFunction_e function,
+    serialReceiveCallbackPtr rxCallback,
+    void *rxCallbackData,
+    uint32_t baudrate,
+    portMode_e mode,
+    portOptions_e options
+);
+void closeSerialPort(serialPort_t *serialPort);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+baudRate_e lookupBaudRateIndex(uint32_t baudRate);
+
+
+
+
+
+void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *leftC, serialConsumer *rightC);
+# 69 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/rx/rx.h" 1
+# 21 "./src/main/rx/rx.h"
+       
+# 47 "./src/main/rx/rx.h"
+typedef enum {
+    RX_FRAME_PENDING = 0,
+    RX_FRAME_COMPLETE = (1 << 0),
+    RX_FRAME_FAILSAFE = (1 << 1),
+    RX_FRAME_PROCESSING_REQUIRED = (1 << 2),
+    RX_FRAME_DROPPED = (1 << 3)
+} rxFrameState_e;
+
+typedef enum {
+    SERIALRX_SPEKTRUM1024 = 0,
+    SERIALRX_SPEKTRUM2048 = 1,
+    SERIALRX_SBUS = 2,
+    SERIALRX_SUMD = 3,
+    SERIALRX_SUMH = 4,
+    SERIALRX_XBUS_MODE_B = 5,
+    SERIALRX_XBUS_MODE_B_RJ01 = 6,
+    SERIALRX_IBUS = 7,
+    SERIALRX_JETIEXBUS = 8,
+    SERIALRX_CRSF = 9,
+    SERIALRX_SRXL = 10,
+    SERIALRX_TARGET_CUSTOM = 11,
+    SERIALRX_FPORT = 12,
+    SERIALRX_DJI_HDL_7MS = 13,
+} SerialRXType;
+# 85 "./src/main/rx/rx.h"
+extern const char rcChannelLetters[];
+
+extern int16_t rcData[18];
+
+
+
+
+
+
+typedef enum {
+    RX_FAILSAFE_MODE_AUTO = 0,
+    RX_FAILSAFE_MODE_HOLD,
+    RX_FAILSAFE_MODE_SET,
+    RX_FAILSAFE_MODE_INVALID
+} rxFailsafeChannelMode_e;
+
+
+
+typedef enum {
+    RX_FAILSAFE_TYPE_FLIGHT = 0,
+    RX_FAILSAFE_TYPE_AUX
+} rxFailsafeChannelType_e;
+
+
+
+typedef struct rxFailsafeChannelConfig_s {
+    uint8_t mode;
+    uint8_t step;
+} rxFailsafeChannelConfig_t;
+
+extern rxFailsafeChannelConfig_t rxFailsafeChannelConfigs_SystemArray[18]; extern rxFailsafeChannelConfig_t rxFailsafeChannelConfigs_CopyArray[18]; static inline const rxFailsafeChannelConfig_t* rxFailsafeChannelConfigs(int _index) { return &rxFailsafeChannelConfigs_SystemArray[_index]; } static inline rxFailsafeChannelConfig_t* rxFailsafeChannelConfigsMutable(int _index) { return &rxFailsafeChannelConfigs_SystemArray[_index]; } static inline rxFailsafeChannelConfig_t (* rxFailsafeChannelConfigs_array(void))[18] { return &rxFailsafeChannelConfigs_SystemArray; } struct _dummy;
+
+typedef struct rxChannelRangeConfig_s {
+    uint16_t min;
+    uint16_t max;
+} rxChannelRangeConfig_t;
+
+extern rxChannelRangeConfig_t rxChannelRangeConfigs_SystemArray[4]; extern rxChannelRangeConfig_t rxChannelRangeConfigs_CopyArray[4]; static inline const rxChannelRangeConfig_t* rxChannelRangeConfigs(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t* rxChannelRangeConfigsMutable(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t (* rxChannelRangeConfigs_array(void))[4] { return &rxChannelRangeConfigs_SystemArray; } struct _dummy;
+
+struct rxRuntimeConfig_s;
+typedef uint16_t (*rcReadRawDataFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig, uint8_t chan);
+typedef uint8_t (*rcFrameStatusFnPtr)(struct rxRuntimeConfig_s *rxRuntimeConfig);
+typedef 
+# 127 "./src/main/rx/rx.h" 3 4
+       _Bool 
+# 127 "./src/main/rx/rx.h"
+            (*rcProcessFrameFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig);
+
+typedef struct rxRuntimeConfig_s {
+    uint8_t channelCount;
+    uint16_t rxRefreshRate;
+    rcReadRawDataFnPtr rcReadRawFn;
+    rcFrameStatusFnPtr rcFrameStatusFn;
+    rcProcessFrameFnPtr rcProcessFrameFn;
+    uint16_t *channelData;
+    void *frameData;
+} rxRuntimeConfig_t;
+
+typedef enum {
+    RSSI_SOURCE_NONE = 0,
+    RSSI_SOURCE_ADC,
+    RSSI_SOURCE_RX_CHANNEL,
+    RSSI_SOURCE_RX_PROTOCOL,
+    RSSI_SOURCE_MSP,
+    RSSI_SOURCE_FRAME_ERRORS,
+    RSSI_SOURCE_RX_PROTOCOL_CRSF,
+} rssiSource_e;
+
+extern rssiSource_e rssiSource;
+
+typedef enum {
+    LQ_SOURCE_NONE = 0,
+    LQ_SOURCE_RX_PROTOCOL_CRSF,
+} linkQualitySource_e;
+
+extern linkQualitySource_e linkQualitySource;
+
+extern rxRuntimeConfig_t rxRuntimeConfig;
+
+void rxInit(void);
+
+# 161 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 161 "./src/main/rx/rx.h"
+    rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
+
+# 162 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 162 "./src/main/rx/rx.h"
+    rxIsReceivingSignal(void);
+
+# 163 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 163 "./src/main/rx/rx.h"
+    rxAreFlightChannelsValid(void);
+
+# 164 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 164 "./src/main/rx/rx.h"
+    calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+
+struct rxConfig_s;
+
+void parseRcChannels(const char *input, struct rxConfig_s *rxConfig);
+
+
+
+void setRssiDirect(uint16_t newRssi, rssiSource_e source);
+void setRssi(uint16_t rssiValue, rssiSource_e source);
+void setRssiMsp(uint8_t newMspRssi);
+void updateRSSI(timeUs_t currentTimeUs);
+uint16_t getRssi(void);
+uint8_t getRssiPercent(void);
+
+# 178 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 178 "./src/main/rx/rx.h"
+    isRssiConfigured(void);
+
+
+
+uint16_t rxGetLinkQuality(void);
+void setLinkQualityDirect(uint16_t linkqualityValue);
+uint16_t rxGetLinkQualityPercent(void);
+
+uint8_t getRssiDbm(void);
+void setRssiDbm(uint8_t newRssiDbm, rssiSource_e source);
+void setRssiDbmDirect(uint8_t newRssiDbm, rssiSource_e source);
+
+void resetAllRxChannelRangeConfigurations(rxChannelRangeConfig_t *rxChannelRangeConfig);
+
+void suspendRxPwmPpmSignal(void);
+void resumeRxPwmPpmSignal(void);
+
+uint16_t rxGetRefreshRate(void);
+# 71 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/sensors/acceleration.h" 1
+# 21 "./src/main/sensors/acceleration.h"
+       
+
+
+
+# 1 "./src/main/drivers/accgyro/accgyro.h" 1
+# 21 "./src/main/drivers/accgyro/accgyro.h"
+       
+
+
+
+
+
+
+
+# 1 "./src/main/drivers/accgyro/accgyro_mpu.h" 1
+# 21 "./src/main/drivers/accgyro/accgyro_mpu.h"
+       
+# 143 "./src/main/drivers/accgyro/accgyro_mpu.h"
+enum gyro_fsr_e {
+    INV_FSR_250DPS = 0,
+    INV_FSR_500DPS,
+    INV_FSR_1000DPS,
+    INV_FSR_2000DPS,
+    NUM_GYRO_FSR
+};
+
+enum icm_high_range_gyro_fsr_e {
+    ICM_HIGH_RANGE_FSR_500DPS = 0,
+    ICM_HIGH_RANGE_FSR_1000DPS,
+    ICM_HIGH_RANGE_FSR_2000DPS,
+    ICM_HIGH_RANGE_FSR_4000DPS,
+    NUM_ICM_HIGH_RANGE_GYRO_FSR
+};
+
+enum clock_sel_e {
+    INV_CLK_INTERNAL = 0,
+    INV_CLK_PLL,
+    NUM_CLK
+};
+
+enum accel_fsr_e {
+    INV_FSR_2G = 0,
+    INV_FSR_4G,
+    INV_FSR_8G,
+    INV_FSR_16G,
+    NUM_ACCEL_FSR
+};
+
+enum icm_high_range_accel_fsr_e {
+    ICM_HIGH_RANGE_FSR_4G = 0,
+    ICM_HIGH_RANGE_FSR_8G,
+    ICM_HIGH_RANGE_FSR_16G,
+    ICM_HIGH_RANGE_FSR_32G,
+    NUM_ICM_HIGH_RANGE_ACCEL_FSR
+};
+
+typedef enum {
+    GYRO_OVERFLOW_NONE = 0x00,
+    GYRO_OVERFLOW_X = 0x01,
+    GYRO_OVERFLOW_Y = 0x02,
+    GYRO_OVERFLOW_Z = 0x04
+} gyroOverflow_e;
+
+typedef enum {
+    MPU_NONE,
+    MPU_3050,
+    MPU_60x0,
+    MPU_60x0_SPI,
+    MPU_65xx_I2C,
+    MPU_65xx_SPI,
+    MPU_9250_SPI,
+    ICM_20601_SPI,
+    ICM_20602_SPI,
+    ICM_20608_SPI,
+    ICM_20649_SPI,
+    ICM_20689_SPI,
+    BMI_160_SPI,
+    L3GD20_SPI,
+} mpuSensor_e;
+
+typedef enum {
+    MPU_HALF_RESOLUTION,
+    MPU_FULL_RESOLUTION
+} mpu6050Resolution_e;
+
+typedef struct mpuDetectionResult_s {
+    mpuSensor_e sensor;
+    mpu6050Resolution_e resolution;
+} mpuDetectionResult_t;
+
+struct gyroDev_s;
+struct gyroDeviceConfig_s;
+void mpuGyroInit(struct gyroDev_s *gyro);
+
+# 218 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 218 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuGyroRead(struct gyroDev_s *gyro);
+
+# 219 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 219 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuGyroReadSPI(struct gyroDev_s *gyro);
+void mpuPreInit(const struct gyroDeviceConfig_s *config);
+
+# 221 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 221 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuDetect(struct gyroDev_s *gyro, const struct gyroDeviceConfig_s *config);
+uint8_t mpuGyroDLPF(struct gyroDev_s *gyro);
+uint8_t mpuGyroReadRegister(const busDevice_t *bus, uint8_t reg);
+
+struct accDev_s;
+
+# 226 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 226 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuAccRead(struct accDev_s *acc);
+# 30 "./src/main/drivers/accgyro/accgyro.h" 2
+
+#pragma GCC diagnostic push
+
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 32 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 2 3 4
+
+
+
+
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 33 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+typedef __pid_t pid_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+
+
+
+extern int clone (int (*__fn) (void *__arg), void *__child_stack,
+    int __flags, void *__arg, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int unshare (int __flags) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getcpu (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int getcpu (unsigned int *, unsigned int *) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setns (int __fd, int __nstype) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 130 "/usr/include/sched.h" 3 4
+extern int sched_setaffinity (__pid_t __pid, size_t __cpusetsize,
+         const cpu_set_t *__cpuset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getaffinity (__pid_t __pid, size_t __cpusetsize,
+         cpu_set_t *__cpuset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 23 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 73 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 23 "/usr/include/x86_64-linux-gnu/bits/timex.h" 2 3 4
+
+
+
+struct timex
+{
+# 58 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+  unsigned int modes;
+  __syscall_slong_t offset;
+  __syscall_slong_t freq;
+  __syscall_slong_t maxerror;
+  __syscall_slong_t esterror;
+  int status;
+  __syscall_slong_t constant;
+  __syscall_slong_t precision;
+  __syscall_slong_t tolerance;
+  struct timeval time;
+  __syscall_slong_t tick;
+  __syscall_slong_t ppsfreq;
+  __syscall_slong_t jitter;
+  int shift;
+  __syscall_slong_t stabil;
+  __syscall_slong_t jitcnt;
+  __syscall_slong_t calcnt;
+  __syscall_slong_t errcnt;
+  __syscall_slong_t stbcnt;
+
+  int tai;
+
+
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32;
+
+};
+# 74 "/usr/include/x86_64-linux-gnu/bits/time.h" 2 3 4
+
+
+
+
+extern int clock_adjtime (__clockid_t __clock_id, struct timex *__utx) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 90 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 38 "/usr/include/time.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 47 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 48 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern char *strptime (const char *__restrict __s,
+         const char *__restrict __fmt, struct tm *__tp)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *strptime_l (const char *__restrict __s,
+    const char *__restrict __fmt, struct tm *__tp,
+    locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int timespec_get (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 399 "/usr/include/time.h" 3 4
+extern int timespec_getres (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 425 "/usr/include/time.h" 3 4
+extern int getdate_err;
+# 434 "/usr/include/time.h" 3 4
+extern struct tm *getdate (const char *__string);
+# 448 "/usr/include/time.h" 3 4
+extern int getdate_r (const char *__restrict __string,
+        struct tm *__restrict __resbufp);
+
+
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 27 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 31 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+
+extern long int __sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+# 34 "/usr/include/pthread.h" 2 3 4
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+  , PTHREAD_MUTEX_FAST_NP = PTHREAD_MUTEX_TIMED_NP
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+
+
+
+
+extern int pthread_tryjoin_np (pthread_t __th, void **__thread_return) __attribute__ ((__nothrow__ , __leaf__));
+# 233 "/usr/include/pthread.h" 3 4
+extern int pthread_timedjoin_np (pthread_t __th, void **__thread_return,
+     const struct timespec *__abstime);
+# 243 "/usr/include/pthread.h" 3 4
+extern int pthread_clockjoin_np (pthread_t __th, void **__thread_return,
+                                 clockid_t __clockid,
+     const struct timespec *__abstime);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_attr_setaffinity_np (pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern int pthread_attr_getaffinity_np (const pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+extern int pthread_getattr_default_np (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_setsigmask_np (pthread_attr_t *__attr,
+           const __sigset_t *sigmask);
+
+
+
+
+extern int pthread_attr_getsigmask_np (const pthread_attr_t *__attr,
+           __sigset_t *sigmask);
+
+
+
+
+
+
+
+extern int pthread_setattr_default_np (const pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_getattr_np (pthread_t __th, pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int pthread_getname_np (pthread_t __target_thread, char *__buf,
+          size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int pthread_setname_np (pthread_t __target_thread, const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+extern int pthread_getconcurrency (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setconcurrency (int __level) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int pthread_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int pthread_yield (void) __asm__ ("" "sched_yield") __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("pthread_yield is deprecated, use sched_yield instead")))
+                                                      ;
+
+
+
+
+
+
+
+extern int pthread_setaffinity_np (pthread_t __th, size_t __cpusetsize,
+       const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getaffinity_np (pthread_t __th, size_t __cpusetsize,
+       cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 732 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel_defer (__pthread_unwind_buf_t *__buf)
+     ;
+# 745 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel_restore (__pthread_unwind_buf_t *__buf)
+  ;
+
+
+
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 817 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_clocklock (pthread_mutex_t *__restrict __mutex,
+        clockid_t __clockid,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_consistent_np (pthread_mutex_t *) __asm__ ("" "pthread_mutex_consistent") __attribute__ ((__nothrow__ , __leaf__))
+                                __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutex_consistent_np is deprecated, use pthread_mutex_consistent")))
+                                                                         ;
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_getrobust_np (pthread_mutexattr_t *, int *) __asm__ ("" "pthread_mutexattr_getrobust") __attribute__ ((__nothrow__ , __leaf__))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutexattr_getrobust_np is deprecated, use pthread_mutexattr_getrobust")))
+                                                                               ;
+
+
+
+
+
+
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_setrobust_np (pthread_mutexattr_t *, int) __asm__ ("" "pthread_mutexattr_setrobust") __attribute__ ((__nothrow__ , __leaf__))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutexattr_setrobust_np is deprecated, use pthread_mutexattr_setrobust")))
+                                                                               ;
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1004 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockrdlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1051 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockwrlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1171 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_clockwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       __clockid_t __clock_id,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 4)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) pthread_equal (pthread_t __thread1, pthread_t __thread2)
+{
+  return __thread1 == __thread2;
+}
+
+
+
+# 34 "./src/main/drivers/accgyro/accgyro.h" 2
+
+
+
+
+
+# 38 "./src/main/drivers/accgyro/accgyro.h"
+typedef enum {
+    GYRO_NONE = 0,
+    GYRO_DEFAULT,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_MPU6000,
+    GYRO_MPU6500,
+    GYRO_MPU9250,
+    GYRO_ICM20601,
+    GYRO_ICM20602,
+    GYRO_ICM20608G,
+    GYRO_ICM20649,
+    GYRO_ICM20689,
+    GYRO_BMI160,
+    GYRO_FAKE
+} gyroHardware_e;
+
+typedef enum {
+    GYRO_HARDWARE_LPF_NORMAL,
+    GYRO_HARDWARE_LPF_1KHZ_SAMPLE,
+
+    GYRO_HARDWARE_LPF_EXPERIMENTAL
+
+} gyroHardwareLpf_e;
+
+typedef enum {
+    GYRO_32KHZ_HARDWARE_LPF_NORMAL,
+    GYRO_32KHZ_HARDWARE_LPF_EXPERIMENTAL
+} gyro32khzHardwareLpf;
+
+typedef enum {
+    GYRO_RATE_1_kHz,
+    GYRO_RATE_1100_Hz,
+    GYRO_RATE_3200_Hz,
+    GYRO_RATE_8_kHz,
+    GYRO_RATE_9_kHz,
+    GYRO_RATE_32_kHz,
+} gyroRateKHz_e;
+
+typedef struct gyroDev_s {
+
+    pthread_mutex_t lock;
+
+    sensorGyroInitFuncPtr initFn;
+    sensorGyroReadFuncPtr readFn;
+    sensorGyroReadDataFuncPtr temperatureFn;
+    extiCallbackRec_t exti;
+    busDevice_t bus;
+    float scale;
+    float gyroZero[3];
+    float gyroADC[3];
+    float gyroADCf[3];
+    int32_t gyroADCRawPrevious[3];
+    int16_t gyroADCRaw[3];
+    int16_t temperature;
+    mpuDetectionResult_t mpuDetectionResult;
+    sensor_align_e gyroAlign;
+    gyroRateKHz_e gyroRateKHz;
+    
+# 98 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 98 "./src/main/drivers/accgyro/accgyro.h"
+        dataReady;
+    
+# 99 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 99 "./src/main/drivers/accgyro/accgyro.h"
+        gyro_high_fsr;
+    uint8_t hardware_lpf;
+    uint8_t hardware_32khz_lpf;
+    uint8_t mpuDividerDrops;
+    ioTag_t mpuIntExtiTag;
+    uint8_t gyroHasOverflowProtection;
+    gyroHardware_e gyroHardware;
+} gyroDev_t;
+
+typedef struct accDev_s {
+
+    pthread_mutex_t lock;
+
+    float acc_1G_rec;
+    sensorAccInitFuncPtr initFn;
+    sensorAccReadFuncPtr readFn;
+    busDevice_t bus;
+    uint16_t acc_1G;
+    int16_t ADCRaw[3];
+    mpuDetectionResult_t mpuDetectionResult;
+    sensor_align_e accAlign;
+    
+# 120 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 120 "./src/main/drivers/accgyro/accgyro.h"
+        dataReady;
+    
+# 121 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 121 "./src/main/drivers/accgyro/accgyro.h"
+        acc_high_fsr;
+    char revisionCode;
+    uint8_t filler[2];
+} accDev_t;
+
+static inline void accDevLock(accDev_t *acc)
+{
+
+    pthread_mutex_lock(&acc->lock);
+
+
+
+}
+
+static inline void accDevUnLock(accDev_t *acc)
+{
+
+    pthread_mutex_unlock(&acc->lock);
+
+
+
+}
+
+static inline void gyroDevLock(gyroDev_t *gyro)
+{
+
+    pthread_mutex_lock(&gyro->lock);
+
+
+
+}
+
+static inline void gyroDevUnLock(gyroDev_t *gyro)
+{
+
+    pthread_mutex_unlock(&gyro->lock);
+
+
+
+}
+#pragma GCC diagnostic pop
+# 26 "./src/main/sensors/acceleration.h" 2
+# 1 "./src/main/sensors/sensors.h" 1
+# 21 "./src/main/sensors/sensors.h"
+       
+
+typedef enum {
+    SENSOR_INDEX_GYRO = 0,
+    SENSOR_INDEX_ACC,
+    SENSOR_INDEX_BARO,
+    SENSOR_INDEX_MAG,
+    SENSOR_INDEX_RANGEFINDER,
+    SENSOR_INDEX_COUNT
+} sensorIndex_e;
+
+extern uint8_t requestedSensors[SENSOR_INDEX_COUNT];
+extern uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+
+typedef struct int16_flightDynamicsTrims_s {
+    int16_t roll;
+    int16_t pitch;
+    int16_t yaw;
+} flightDynamicsTrims_def_t;
+
+typedef union flightDynamicsTrims_u {
+    int16_t raw[3];
+    flightDynamicsTrims_def_t values;
+} flightDynamicsTrims_t;
+
+
+
+
+typedef enum {
+    SENSOR_GYRO = 1 << 0,
+    SENSOR_ACC = 1 << 1,
+    SENSOR_BARO = 1 << 2,
+    SENSOR_MAG = 1 << 3,
+    SENSOR_SONAR = 1 << 4,
+    SENSOR_RANGEFINDER = 1 << 4,
+    SENSOR_GPS = 1 << 5,
+    SENSOR_GPSMAG = 1 << 6
+} sensors_e;
+# 27 "./src/main/sensors/acceleration.h" 2
+
+
+typedef enum {
+    ACC_DEFAULT,
+    ACC_NONE,
+    ACC_ADXL345,
+    ACC_MPU6050,
+    ACC_MMA8452,
+    ACC_BMA280,
+    ACC_LSM303DLHC,
+    ACC_MPU6000,
+    ACC_MPU6500,
+    ACC_MPU9250,
+    ACC_ICM20601,
+    ACC_ICM20602,
+    ACC_ICM20608G,
+    ACC_ICM20649,
+    ACC_ICM20689,
+    ACC_BMI160,
+    ACC_FAKE
+} accelerationSensor_e;
+
+typedef struct acc_s {
+    accDev_t dev;
+    uint32_t accSamplingInterval;
+    float accADC[3];
+    
+# 53 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 53 "./src/main/sensors/acceleration.h"
+        isAccelUpdatedAtLeastOnce;
+} acc_t;
+
+extern acc_t acc;
+
+typedef struct rollAndPitchTrims_s {
+    int16_t roll;
+    int16_t pitch;
+} rollAndPitchTrims_t_def;
+
+typedef union rollAndPitchTrims_u {
+    int16_t raw[2];
+    rollAndPitchTrims_t_def values;
+} rollAndPitchTrims_t;
+
+
+typedef struct accelerometerConfig_s {
+    uint16_t acc_lpf_hz;
+    uint8_t acc_hardware;
+    
+# 72 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 72 "./src/main/sensors/acceleration.h"
+        acc_high_fsr;
+    flightDynamicsTrims_t accZero;
+    rollAndPitchTrims_t accelerometerTrims;
+} accelerometerConfig_t;
+
+extern accelerometerConfig_t accelerometerConfig_System; extern accelerometerConfig_t accelerometerConfig_Copy; static inline const accelerometerConfig_t* accelerometerConfig(void) { return &accelerometerConfig_System; } static inline accelerometerConfig_t* accelerometerConfigMutable(void) { return &accelerometerConfig_System; } struct _dummy;
+
+
+
+# 80 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 80 "./src/main/sensors/acceleration.h"
+    accInit(uint32_t gyroTargetLooptime);
+
+# 81 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 81 "./src/main/sensors/acceleration.h"
+    accIsCalibrationComplete(void);
+void accSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void resetRollAndPitchTrims(rollAndPitchTrims_t *rollAndPitchTrims);
+void accUpdate(timeUs_t currentTimeUs, rollAndPitchTrims_t *rollAndPitchTrims);
+
+# 85 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 85 "./src/main/sensors/acceleration.h"
+    accGetAccumulationAverage(float *accumulation);
+union flightDynamicsTrims_u;
+void setAccelerationTrims(union flightDynamicsTrims_u *accelerationTrimsToUse);
+void accInitFilters(void);
+void applyAccelerometerTrimsDelta(union rollAndPitchTrims_u *rollAndPitchTrimsDelta);
+# 73 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/barometer.h" 1
+# 21 "./src/main/sensors/barometer.h"
+       
+
+
+# 1 "./src/main/drivers/barometer/barometer.h" 1
+# 21 "./src/main/drivers/barometer/barometer.h"
+       
+
+
+
+struct baroDev_s;
+
+typedef void (*baroOpFuncPtr)(struct baroDev_s *baro);
+typedef void (*baroCalculateFuncPtr)(int32_t *pressure, int32_t *temperature);
+
+typedef struct baroDev_s {
+    busDevice_t busdev;
+    uint16_t ut_delay;
+    uint16_t up_delay;
+    baroOpFuncPtr start_ut;
+    baroOpFuncPtr get_ut;
+    baroOpFuncPtr start_up;
+    baroOpFuncPtr get_up;
+    baroCalculateFuncPtr calculate;
+} baroDev_t;
+# 25 "./src/main/sensors/barometer.h" 2
+
+typedef enum {
+    BARO_DEFAULT = 0,
+    BARO_NONE = 1,
+    BARO_BMP085 = 2,
+    BARO_MS5611 = 3,
+    BARO_BMP280 = 4,
+    BARO_LPS = 5,
+    BARO_QMP6988 = 6
+} baroSensor_e;
+
+
+
+typedef struct barometerConfig_s {
+    uint8_t baro_bustype;
+    uint8_t baro_spi_device;
+    ioTag_t baro_spi_csn;
+    uint8_t baro_i2c_device;
+    uint8_t baro_i2c_address;
+    uint8_t baro_hardware;
+    uint8_t baro_sample_count;
+    uint16_t baro_noise_lpf;
+    uint16_t baro_cf_vel;
+} barometerConfig_t;
+
+extern barometerConfig_t barometerConfig_System; extern barometerConfig_t barometerConfig_Copy; static inline const barometerConfig_t* barometerConfig(void) { return &barometerConfig_System; } static inline barometerConfig_t* barometerConfigMutable(void) { return &barometerConfig_System; } struct _dummy;
+
+typedef struct baro_s {
+    baroDev_t dev;
+    int32_t BaroAlt;
+    int32_t baroTemperature;
+    int32_t baroPressure;
+} baro_t;
+
+extern baro_t baro;
+
+void baroPreInit(void);
+
+# 62 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 62 "./src/main/sensors/barometer.h"
+    baroDetect(baroDev_t *dev, baroSensor_e baroHardwareToUse);
+
+# 63 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 63 "./src/main/sensors/barometer.h"
+    isBaroCalibrationComplete(void);
+void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+uint32_t baroUpdate(void);
+
+# 66 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 66 "./src/main/sensors/barometer.h"
+    isBaroReady(void);
+int32_t baroCalculateAltitude(void);
+void performBaroCalibrationCycle(void);
+# 74 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/battery.h" 1
+# 21 "./src/main/sensors/battery.h"
+       
+
+
+
+
+
+# 1 "./src/main/sensors/current.h" 1
+# 21 "./src/main/sensors/current.h"
+       
+
+
+# 1 "./src/main/sensors/current_ids.h" 1
+# 21 "./src/main/sensors/current_ids.h"
+       
+
+
+
+
+
+typedef enum {
+    CURRENT_METER_ID_NONE = 0,
+
+    CURRENT_METER_ID_BATTERY_1 = 10,
+    CURRENT_METER_ID_BATTERY_2,
+
+    CURRENT_METER_ID_BATTERY_10 = 19,
+
+    CURRENT_METER_ID_5V_1 = 20,
+    CURRENT_METER_ID_5V_2,
+
+    CURRENT_METER_ID_5V_10 = 29,
+
+    CURRENT_METER_ID_9V_1 = 30,
+    CURRENT_METER_ID_9V_2,
+
+    CURRENT_METER_ID_9V_10 = 39,
+
+    CURRENT_METER_ID_12V_1 = 40,
+    CURRENT_METER_ID_12V_2,
+
+    CURRENT_METER_ID_12V_10 = 49,
+
+    CURRENT_METER_ID_ESC_COMBINED_1 = 50,
+
+    CURRENT_METER_ID_ESC_COMBINED_10 = 59,
+
+    CURRENT_METER_ID_ESC_MOTOR_1 = 60,
+    CURRENT_METER_ID_ESC_MOTOR_2,
+    CURRENT_METER_ID_ESC_MOTOR_3,
+    CURRENT_METER_ID_ESC_MOTOR_4,
+    CURRENT_METER_ID_ESC_MOTOR_5,
+    CURRENT_METER_ID_ESC_MOTOR_6,
+    CURRENT_METER_ID_ESC_MOTOR_7,
+    CURRENT_METER_ID_ESC_MOTOR_8,
+    CURRENT_METER_ID_ESC_MOTOR_9,
+    CURRENT_METER_ID_ESC_MOTOR_10,
+    CURRENT_METER_ID_ESC_MOTOR_11,
+    CURRENT_METER_ID_ESC_MOTOR_12,
+
+    CURRENT_METER_ID_ESC_MOTOR_20 = 79,
+
+    CURRENT_METER_ID_VIRTUAL_1 = 80,
+    CURRENT_METER_ID_VIRTUAL_2,
+
+    CURRENT_METER_ID_MSP_1 = 90,
+    CURRENT_METER_ID_MSP_2,
+
+} currentMeterId_e;
+# 25 "./src/main/sensors/current.h" 2
+
+typedef enum {
+    CURRENT_METER_NONE = 0,
+    CURRENT_METER_ADC,
+    CURRENT_METER_VIRTUAL,
+    CURRENT_METER_ESC,
+    CURRENT_METER_MSP,
+    CURRENT_METER_COUNT
+} currentMeterSource_e;
+
+extern const char * const currentMeterSourceNames[CURRENT_METER_COUNT];
+
+typedef struct currentMeter_s {
+    int32_t amperage;
+    int32_t amperageLatest;
+    int32_t mAhDrawn;
+} currentMeter_t;
+
+
+
+typedef struct currentMeterMAhDrawnState_s {
+    int32_t mAhDrawn;
+    float mAhDrawnF;
+} currentMeterMAhDrawnState_t;
+
+
+
+
+
+typedef enum {
+    CURRENT_SENSOR_VIRTUAL = 0,
+    CURRENT_SENSOR_ADC,
+    CURRENT_SENSOR_ESC,
+    CURRENT_SENSOR_MSP
+} currentSensor_e;
+
+
+
+
+
+
+typedef struct currentMeterADCState_s {
+    currentMeterMAhDrawnState_t mahDrawnState;
+    int32_t amperage;
+    int32_t amperageLatest;
+} currentMeterADCState_t;
+
+typedef struct currentSensorADCConfig_s {
+    int16_t scale;
+    int16_t offset;
+} currentSensorADCConfig_t;
+
+extern currentSensorADCConfig_t currentSensorADCConfig_System; extern currentSensorADCConfig_t currentSensorADCConfig_Copy; static inline const currentSensorADCConfig_t* currentSensorADCConfig(void) { return &currentSensorADCConfig_System; } static inline currentSensorADCConfig_t* currentSensorADCConfigMutable(void) { return &currentSensorADCConfig_System; } struct _dummy;
+
+
+
+
+
+typedef struct currentMeterVirtualState_s {
+    currentMeterMAhDrawnState_t mahDrawnState;
+    int32_t amperage;
+} currentSensorVirtualState_t;
+
+typedef struct currentSensorVirtualConfig_s {
+    int16_t scale;
+    uint16_t offset;
+} currentSensorVirtualConfig_t;
+
+extern currentSensorVirtualConfig_t currentSensorVirtualConfig_System; extern currentSensorVirtualConfig_t currentSensorVirtualConfig_Copy; static inline const currentSensorVirtualConfig_t* currentSensorVirtualConfig(void) { return &currentSensorVirtualConfig_System; } static inline currentSensorVirtualConfig_t* currentSensorVirtualConfigMutable(void) { return &currentSensorVirtualConfig_System; } struct _dummy;
+
+
+
+
+
+typedef struct currentMeterESCState_s {
+    int32_t mAhDrawn;
+    int32_t amperage;
+} currentMeterESCState_t;
+
+
+
+
+
+
+typedef struct currentMeterMSPState_s {
+    int32_t mAhDrawn;
+    int32_t amperage;
+} currentMeterMSPState_t;
+
+
+
+
+
+
+void currentMeterReset(currentMeter_t *meter);
+
+void currentMeterADCInit(void);
+void currentMeterADCRefresh(int32_t lastUpdateAt);
+void currentMeterADCRead(currentMeter_t *meter);
+
+void currentMeterVirtualInit(void);
+void currentMeterVirtualRefresh(int32_t lastUpdateAt, 
+# 126 "./src/main/sensors/current.h" 3 4
+                                                     _Bool 
+# 126 "./src/main/sensors/current.h"
+                                                          armed, 
+# 126 "./src/main/sensors/current.h" 3 4
+                                                                 _Bool 
+# 126 "./src/main/sensors/current.h"
+                                                                      throttleLowAndMotorStop, int32_t throttleOffset);
+void currentMeterVirtualRead(currentMeter_t *meter);
+
+void currentMeterESCInit(void);
+void currentMeterESCRefresh(int32_t lastUpdateAt);
+void currentMeterESCReadCombined(currentMeter_t *meter);
+void currentMeterESCReadMotor(uint8_t motorNumber, currentMeter_t *meter);
+
+void currentMeterMSPInit(void);
+void currentMeterMSPRefresh(timeUs_t currentTimeUs);
+void currentMeterMSPRead(currentMeter_t *meter);
+void currentMeterMSPSet(uint16_t amperage, uint16_t mAhDrawn);
+
+
+
+
+extern const uint8_t supportedCurrentMeterCount;
+extern const uint8_t currentMeterIds[];
+void currentMeterRead(currentMeterId_e id, currentMeter_t *currentMeter);
+# 28 "./src/main/sensors/battery.h" 2
+# 1 "./src/main/sensors/voltage.h" 1
+# 21 "./src/main/sensors/voltage.h"
+       
+
+# 1 "./src/main/sensors/voltage_ids.h" 1
+# 21 "./src/main/sensors/voltage_ids.h"
+       
+
+
+
+
+
+typedef enum {
+    VOLTAGE_METER_ID_NONE = 0,
+
+    VOLTAGE_METER_ID_BATTERY_1 = 10,
+    VOLTAGE_METER_ID_BATTERY_2,
+
+    VOLTAGE_METER_ID_BATTERY_10 = 19,
+
+    VOLTAGE_METER_ID_5V_1 = 20,
+    VOLTAGE_METER_ID_5V_2,
+
+    VOLTAGE_METER_ID_5V_10 = 29,
+
+    VOLTAGE_METER_ID_9V_1 = 30,
+    VOLTAGE_METER_ID_9V_2,
+
+    VOLTAGE_METER_ID_9V_10 = 39,
+
+    VOLTAGE_METER_ID_12V_1 = 40,
+    VOLTAGE_METER_ID_12V_2,
+
+    VOLTAGE_METER_ID_12V_10 = 49,
+
+    VOLTAGE_METER_ID_ESC_COMBINED_1 = 50,
+
+    VOLTAGE_METER_ID_ESC_COMBINED_10 = 59,
+
+    VOLTAGE_METER_ID_ESC_MOTOR_1 = 60,
+    VOLTAGE_METER_ID_ESC_MOTOR_2,
+    VOLTAGE_METER_ID_ESC_MOTOR_3,
+    VOLTAGE_METER_ID_ESC_MOTOR_4,
+    VOLTAGE_METER_ID_ESC_MOTOR_5,
+    VOLTAGE_METER_ID_ESC_MOTOR_6,
+    VOLTAGE_METER_ID_ESC_MOTOR_7,
+    VOLTAGE_METER_ID_ESC_MOTOR_8,
+    VOLTAGE_METER_ID_ESC_MOTOR_9,
+    VOLTAGE_METER_ID_ESC_MOTOR_10,
+    VOLTAGE_METER_ID_ESC_MOTOR_11,
+    VOLTAGE_METER_ID_ESC_MOTOR_12,
+
+    VOLTAGE_METER_ID_ESC_MOTOR_20 = 79,
+
+    VOLTAGE_METER_ID_CELL_1 = 80,
+    VOLTAGE_METER_ID_CELL_2,
+
+    VOLTAGE_METER_ID_CELL_40 = 119,
+
+} voltageMeterId_e;
+# 24 "./src/main/sensors/voltage.h" 2
+
+
+
+
+
+typedef enum {
+    VOLTAGE_METER_NONE = 0,
+    VOLTAGE_METER_ADC,
+    VOLTAGE_METER_ESC,
+    VOLTAGE_METER_COUNT
+} voltageMeterSource_e;
+
+extern const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT];
+
+
+
+typedef struct voltageMeter_s {
+    uint16_t filtered;
+    uint16_t unfiltered;
+    
+# 43 "./src/main/sensors/voltage.h" 3 4
+   _Bool 
+# 43 "./src/main/sensors/voltage.h"
+        lowVoltageCutoff;
+} voltageMeter_t;
+
+
+
+
+
+
+typedef enum {
+    VOLTAGE_SENSOR_TYPE_ADC_RESISTOR_DIVIDER = 0,
+    VOLTAGE_SENSOR_TYPE_ESC
+} voltageSensorType_e;
+# 76 "./src/main/sensors/voltage.h"
+typedef enum {
+    VOLTAGE_SENSOR_ADC_VBAT = 0,
+    VOLTAGE_SENSOR_ADC_12V = 1,
+    VOLTAGE_SENSOR_ADC_9V = 2,
+    VOLTAGE_SENSOR_ADC_5V = 3
+} voltageSensorADC_e;
+
+
+typedef struct voltageSensorADCConfig_s {
+    uint8_t vbatscale;
+    uint8_t vbatresdivval;
+    uint8_t vbatresdivmultiplier;
+} voltageSensorADCConfig_t;
+
+extern voltageSensorADCConfig_t voltageSensorADCConfig_SystemArray[1]; extern voltageSensorADCConfig_t voltageSensorADCConfig_CopyArray[1]; static inline const voltageSensorADCConfig_t* voltageSensorADCConfig(int _index) { return &voltageSensorADCConfig_SystemArray[_index]; } static inline voltageSensorADCConfig_t* voltageSensorADCConfigMutable(int _index) { return &voltageSensorADCConfig_SystemArray[_index]; } static inline voltageSensorADCConfig_t (* voltageSensorADCConfig_array(void))[1] { return &voltageSensorADCConfig_SystemArray; } struct _dummy;
+
+
+
+
+void voltageMeterReset(voltageMeter_t *voltageMeter);
+
+void voltageMeterADCInit(void);
+void voltageMeterADCRefresh(void);
+void voltageMeterADCRead(voltageSensorADC_e adcChannel, voltageMeter_t *voltageMeter);
+
+void voltageMeterESCInit(void);
+void voltageMeterESCRefresh(void);
+void voltageMeterESCReadCombined(voltageMeter_t *voltageMeter);
+void voltageMeterESCReadMotor(uint8_t motor, voltageMeter_t *voltageMeter);
+
+
+
+
+
+extern const uint8_t voltageMeterADCtoIDMap[1];
+
+extern const uint8_t supportedVoltageMeterCount;
+extern const uint8_t voltageMeterIds[];
+void voltageMeterRead(voltageMeterId_e id, voltageMeter_t *voltageMeter);
+# 29 "./src/main/sensors/battery.h" 2
+# 37 "./src/main/sensors/battery.h"
+enum {
+    AUTO_PROFILE_CELL_COUNT_STAY = 0,
+    AUTO_PROFILE_CELL_COUNT_CHANGE = -1,
+};
+
+typedef struct batteryConfig_s {
+
+    uint16_t vbatmaxcellvoltage;
+    uint16_t vbatmincellvoltage;
+    uint16_t vbatwarningcellvoltage;
+    uint16_t vbatnotpresentcellvoltage;
+    uint8_t lvcPercentage;
+    voltageMeterSource_e voltageMeterSource;
+
+
+    currentMeterSource_e currentMeterSource;
+    uint16_t batteryCapacity;
+
+
+    
+# 56 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 56 "./src/main/sensors/battery.h"
+        useVBatAlerts;
+    
+# 57 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 57 "./src/main/sensors/battery.h"
+        useConsumptionAlerts;
+    uint8_t consumptionWarningPercentage;
+    uint8_t vbathysteresis;
+
+    uint16_t vbatfullcellvoltage;
+
+    uint8_t forceBatteryCellCount;
+    uint8_t vbatLpfPeriod;
+    uint8_t ibatLpfPeriod;
+    uint8_t vbatDurationForWarning;
+    uint8_t vbatDurationForCritical;
+} batteryConfig_t;
+
+extern batteryConfig_t batteryConfig_System; extern batteryConfig_t batteryConfig_Copy; static inline const batteryConfig_t* batteryConfig(void) { return &batteryConfig_System; } static inline batteryConfig_t* batteryConfigMutable(void) { return &batteryConfig_System; } struct _dummy;
+
+typedef struct lowVoltageCutoff_s {
+    
+# 73 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 73 "./src/main/sensors/battery.h"
+        enabled;
+    uint8_t percentage;
+    timeUs_t startTime;
+} lowVoltageCutoff_t;
+
+typedef enum {
+    BATTERY_OK = 0,
+    BATTERY_WARNING,
+    BATTERY_CRITICAL,
+    BATTERY_NOT_PRESENT,
+    BATTERY_INIT
+} batteryState_e;
+
+void batteryInit(void);
+void batteryUpdateVoltage(timeUs_t currentTimeUs);
+void batteryUpdatePresence(void);
+
+batteryState_e getBatteryState(void);
+batteryState_e getVoltageState(void);
+batteryState_e getConsumptionState(void);
+const char * getBatteryStateString(void);
+
+void batteryUpdateStates(timeUs_t currentTimeUs);
+void batteryUpdateAlarms(void);
+
+struct rxConfig_s;
+
+float calculateVbatPidCompensation(void);
+uint8_t calculateBatteryPercentageRemaining(void);
+
+# 102 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 102 "./src/main/sensors/battery.h"
+    isBatteryVoltageConfigured(void);
+uint16_t getBatteryVoltage(void);
+uint16_t getLegacyBatteryVoltage(void);
+uint16_t getBatteryVoltageLatest(void);
+uint8_t getBatteryCellCount(void);
+uint16_t getBatteryAverageCellVoltage(void);
+
+
+# 109 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 109 "./src/main/sensors/battery.h"
+    isAmperageConfigured(void);
+int32_t getAmperage(void);
+int32_t getAmperageLatest(void);
+int32_t getMAhDrawn(void);
+
+void batteryUpdateCurrentMeter(timeUs_t currentTimeUs);
+
+const lowVoltageCutoff_t *getLowVoltageCutoff(void);
+# 75 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/compass.h" 1
+# 21 "./src/main/sensors/compass.h"
+       
+# 31 "./src/main/sensors/compass.h"
+typedef enum {
+    MAG_DEFAULT = 0,
+    MAG_NONE = 1,
+    MAG_HMC5883 = 2,
+    MAG_AK8975 = 3,
+    MAG_AK8963 = 4,
+    MAG_QMC5883 = 5,
+    MAG_LIS3MDL = 6
+} magSensor_e;
+
+typedef struct mag_s {
+    float magADC[3];
+    float magneticDeclination;
+} mag_t;
+
+extern mag_t mag;
+
+typedef struct compassConfig_s {
+    int16_t mag_declination;
+
+    sensor_align_e mag_align;
+    uint8_t mag_hardware;
+    uint8_t mag_bustype;
+    uint8_t mag_i2c_device;
+    uint8_t mag_i2c_address;
+    uint8_t mag_spi_device;
+    ioTag_t mag_spi_csn;
+    ioTag_t interruptTag;
+    flightDynamicsTrims_t magZero;
+} compassConfig_t;
+
+extern compassConfig_t compassConfig_System; extern compassConfig_t compassConfig_Copy; static inline const compassConfig_t* compassConfig(void) { return &compassConfig_System; } static inline compassConfig_t* compassConfigMutable(void) { return &compassConfig_System; } struct _dummy;
+
+
+# 64 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 64 "./src/main/sensors/compass.h"
+    compassIsHealthy(void);
+void compassUpdate(timeUs_t currentTime);
+
+# 66 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 66 "./src/main/sensors/compass.h"
+    compassInit(void);
+void compassPreInit(void);
+# 76 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/gyro.h" 1
+# 21 "./src/main/sensors/gyro.h"
+       
+# 32 "./src/main/sensors/gyro.h"
+typedef struct gyro_s {
+    uint32_t targetLooptime;
+    float gyroADCf[3];
+} gyro_t;
+
+extern gyro_t gyro;
+
+enum {
+    GYRO_OVERFLOW_CHECK_NONE = 0,
+    GYRO_OVERFLOW_CHECK_YAW,
+    GYRO_OVERFLOW_CHECK_ALL_AXES
+};
+
+enum {
+    DYN_NOTCH_RANGE_HIGH = 0,
+    DYN_NOTCH_RANGE_MEDIUM,
+    DYN_NOTCH_RANGE_LOW,
+    DYN_NOTCH_RANGE_AUTO
+};
+
+
+
+
+
+enum {
+    DYN_LPF_NONE = 0,
+    DYN_LPF_PT1,
+    DYN_LPF_BIQUAD
+};
+
+
+
+
+
+enum {
+    FILTER_LOWPASS = 0,
+    FILTER_LOWPASS2
+};
+
+typedef enum gyroDetectionFlags_e {
+    NO_GYROS_DETECTED = 0,
+    DETECTED_GYRO_1 = (1 << 0),
+
+    DETECTED_GYRO_2 = (1 << 1),
+    DETECTED_BOTH_GYROS = (DETECTED_GYRO_1 | DETECTED_GYRO_2),
+    DETECTED_DUAL_GYROS = (1 << 7),
+
+} gyroDetectionFlags_t;
+
+typedef struct gyroConfig_s {
+    uint8_t gyroMovementCalibrationThreshold;
+    uint8_t gyro_sync_denom;
+    uint8_t gyro_hardware_lpf;
+
+    uint8_t gyro_high_fsr;
+    uint8_t gyro_to_use;
+
+    uint16_t gyro_lowpass_hz;
+    uint16_t gyro_lowpass2_hz;
+
+    uint16_t gyro_soft_notch_hz_1;
+    uint16_t gyro_soft_notch_cutoff_1;
+    uint16_t gyro_soft_notch_hz_2;
+    uint16_t gyro_soft_notch_cutoff_2;
+    int16_t gyro_offset_yaw;
+    uint8_t checkOverflow;
+
+
+    uint8_t gyro_lowpass_type;
+    uint8_t gyro_lowpass2_type;
+
+    uint8_t yaw_spin_recovery;
+    int16_t yaw_spin_threshold;
+
+    uint16_t gyroCalibrationDuration;
+
+    uint16_t dyn_lpf_gyro_min_hz;
+    uint16_t dyn_lpf_gyro_max_hz;
+    uint8_t dyn_notch_range;
+    uint8_t dyn_notch_width_percent;
+    uint16_t dyn_notch_q;
+    uint16_t dyn_notch_min_hz;
+    uint8_t gyro_filter_debug_axis;
+} gyroConfig_t;
+
+extern gyroConfig_t gyroConfig_System; extern gyroConfig_t gyroConfig_Copy; static inline const gyroConfig_t* gyroConfig(void) { return &gyroConfig_System; } static inline gyroConfig_t* gyroConfigMutable(void) { return &gyroConfig_System; } struct _dummy;
+
+void gyroPreInit(void);
+
+# 120 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 120 "./src/main/sensors/gyro.h"
+    gyroInit(void);
+
+void gyroInitFilters(void);
+void gyroUpdate(timeUs_t currentTimeUs);
+
+# 124 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 124 "./src/main/sensors/gyro.h"
+    gyroGetAccumulationAverage(float *accumulation);
+const busDevice_t *gyroSensorBus(void);
+struct mpuDetectionResult_s;
+const struct mpuDetectionResult_s *gyroMpuDetectionResult(void);
+void gyroStartCalibration(
+# 128 "./src/main/sensors/gyro.h" 3 4
+                         _Bool 
+# 128 "./src/main/sensors/gyro.h"
+                              isFirstArmingCalibration);
+
+# 129 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 129 "./src/main/sensors/gyro.h"
+    isFirstArmingGyroCalibrationRunning(void);
+
+# 130 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 130 "./src/main/sensors/gyro.h"
+    isGyroCalibrationComplete(void);
+void gyroReadTemperature(void);
+int16_t gyroGetTemperature(void);
+int16_t gyroRateDps(int axis);
+
+# 134 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 134 "./src/main/sensors/gyro.h"
+    gyroOverflowDetected(void);
+
+# 135 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 135 "./src/main/sensors/gyro.h"
+    gyroYawSpinDetected(void);
+uint16_t gyroAbsRateDps(int axis);
+uint8_t gyroReadRegister(uint8_t whichSensor, uint8_t reg);
+gyroDetectionFlags_t getGyroDetectionFlags(void);
+
+float dynThrottle(float throttle);
+void dynLpfGyroUpdate(float throttle);
+# 77 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/rangefinder.h" 1
+# 21 "./src/main/sensors/rangefinder.h"
+       
+
+
+
+# 1 "./src/main/drivers/rangefinder/rangefinder.h" 1
+# 21 "./src/main/drivers/rangefinder/rangefinder.h"
+       
+# 30 "./src/main/drivers/rangefinder/rangefinder.h"
+typedef struct rangefinderHardwarePins_s {
+    ioTag_t triggerTag;
+    ioTag_t echoTag;
+} rangefinderHardwarePins_t;
+
+struct rangefinderDev_s;
+typedef void (*rangefinderOpInitFuncPtr)(struct rangefinderDev_s * dev);
+typedef void (*rangefinderOpStartFuncPtr)(struct rangefinderDev_s * dev);
+typedef int32_t (*rangefinderOpReadFuncPtr)(struct rangefinderDev_s * dev);
+
+typedef struct rangefinderDev_s {
+    timeMs_t delayMs;
+    int16_t maxRangeCm;
+
+
+    int16_t detectionConeDeciDegrees;
+    int16_t detectionConeExtendedDeciDegrees;
+
+
+    rangefinderOpInitFuncPtr init;
+    rangefinderOpStartFuncPtr update;
+    rangefinderOpReadFuncPtr read;
+} rangefinderDev_t;
+
+extern int16_t rangefinderMaxRangeCm;
+extern int16_t rangefinderMaxAltWithTiltCm;
+extern int16_t rangefinderCfAltCm;
+# 26 "./src/main/sensors/rangefinder.h" 2
+
+
+
+typedef enum {
+    RANGEFINDER_NONE = 0,
+    RANGEFINDER_HCSR04 = 1,
+    RANGEFINDER_TFMINI = 2,
+    RANGEFINDER_TF02 = 3,
+
+    RANGEFINDER_SRF10 = 4,
+    RANGEFINDER_HCSR04I2C = 5,
+    RANGEFINDER_VL53L0X = 6,
+    RANGEFINDER_UIB = 7,
+} rangefinderType_e;
+
+typedef struct rangefinderConfig_s {
+    uint8_t rangefinder_hardware;
+} rangefinderConfig_t;
+
+extern rangefinderConfig_t rangefinderConfig_System; extern rangefinderConfig_t rangefinderConfig_Copy; static inline const rangefinderConfig_t* rangefinderConfig(void) { return &rangefinderConfig_System; } static inline rangefinderConfig_t* rangefinderConfigMutable(void) { return &rangefinderConfig_System; } struct _dummy;
+
+typedef struct rangefinder_s {
+    rangefinderDev_t dev;
+    float maxTiltCos;
+    int32_t rawAltitude;
+    int32_t calculatedAltitude;
+    timeMs_t lastValidResponseTimeMs;
+
+    
+# 54 "./src/main/sensors/rangefinder.h" 3 4
+   _Bool 
+# 54 "./src/main/sensors/rangefinder.h"
+        snrThresholdReached;
+    int32_t dynamicDistanceThreshold;
+    int16_t snr;
+} rangefinder_t;
+
+extern rangefinder_t rangefinder;
+
+void rangefinderResetDynamicThreshold(void);
+
+# 62 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 62 "./src/main/sensors/rangefinder.h"
+    rangefinderInit(void);
+
+int32_t rangefinderGetLatestAltitude(void);
+int32_t rangefinderGetLatestRawAltitude(void);
+
+void rangefinderUpdate(timeUs_t currentTimeUs);
+
+# 68 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 68 "./src/main/sensors/rangefinder.h"
+    rangefinderProcess(float cosTiltAngle);
+
+# 69 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 69 "./src/main/sensors/rangefinder.h"
+    rangefinderIsHealthy(void);
+# 78 "./src/main/blackbox/blackbox.c" 2
+# 87 "./src/main/blackbox/blackbox.c"
+extern const blackboxConfig_t pgResetTemplate_blackboxConfig; blackboxConfig_t blackboxConfig_System; blackboxConfig_t blackboxConfig_Copy; extern const pgRegistry_t blackboxConfig_Registry; const pgRegistry_t blackboxConfig_Registry __attribute__ ((section(".pg_registry"), used, aligned(4))) = { .pgn = 5 | (1 << 12), .size = sizeof(blackboxConfig_t) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&blackboxConfig_System, .copy = (uint8_t*)&blackboxConfig_Copy, .ptr = 0, .reset = {.ptr = (void*)&pgResetTemplate_blackboxConfig}, };
+
+const blackboxConfig_t pgResetTemplate_blackboxConfig __attribute__ ((section(".pg_resetdata"), used, aligned(2))) = { .p_ratio = 32, .device = BLACKBOX_DEVICE_SERIAL, .record_acc = 1, .mode = BLACKBOX_MODE_NORMAL }
+
+
+
+
+ ;
+# 106 "./src/main/blackbox/blackbox.c"
+static const char blackboxHeader[] =
+    "H Product:Blackbox flight data recorder by Nicholas Sherlock\n"
+    "H Data version:2\n";
+
+static const char* const blackboxFieldHeaderNames[] = {
+    "name",
+    "signed",
+    "predictor",
+    "encoding",
+    "predictor",
+    "encoding"
+};
+
+
+typedef struct blackboxFieldDefinition_s {
+    const char *name;
+
+    int8_t fieldNameIndex;
+
+
+    uint8_t arr[1];
+} blackboxFieldDefinition_t;
+
+
+
+
+
+typedef struct blackboxSimpleFieldDefinition_s {
+    const char *name;
+    int8_t fieldNameIndex;
+
+    uint8_t isSigned;
+    uint8_t predict;
+    uint8_t encode;
+} blackboxSimpleFieldDefinition_t;
+
+typedef struct blackboxConditionalFieldDefinition_s {
+    const char *name;
+    int8_t fieldNameIndex;
+
+    uint8_t isSigned;
+    uint8_t predict;
+    uint8_t encode;
+    uint8_t condition;
+} blackboxConditionalFieldDefinition_t;
+
+typedef struct blackboxDeltaFieldDefinition_s {
+    const char *name;
+    int8_t fieldNameIndex;
+
+    uint8_t isSigned;
+    uint8_t Ipredict;
+    uint8_t Iencode;
+    uint8_t Ppredict;
+    uint8_t Pencode;
+    uint8_t condition;
+} blackboxDeltaFieldDefinition_t;
+
+
+
+
+
+
+
+static const blackboxDeltaFieldDefinition_t blackboxMainFields[] = {
+
+    {"loopIteration",-1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_INC, .Pencode = FLIGHT_LOG_FIELD_ENCODING_NULL, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"time", -1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisP", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisP", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisP", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"axisI", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisI", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisI", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisD", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0},
+    {"axisD", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1},
+    {"axisD", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2},
+    {"axisF", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisF", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisF", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"rcCommand", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"rcCommand", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"rcCommand", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"rcCommand", 3, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+
+    {"setpoint", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"setpoint", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"setpoint", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"setpoint", 3, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"vbatLatest", -1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_VBATREF, .Iencode = FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_VBAT},
+    {"amperageLatest",-1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC},
+
+
+    {"magADC", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_MAG},
+    {"magADC", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_MAG},
+    {"magADC", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_MAG},
+
+
+    {"BaroAlt", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_BARO},
+
+
+
+
+    {"rssi", -1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_RSSI},
+
+
+    {"gyroADC", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"gyroADC", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"gyroADC", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"accSmooth", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ACC},
+    {"accSmooth", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ACC},
+    {"accSmooth", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ACC},
+    {"debug", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 3, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+
+    {"motor", 0, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1},
+
+    {"motor", 1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2},
+    {"motor", 2, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3},
+    {"motor", 3, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4},
+    {"motor", 4, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5},
+    {"motor", 5, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6},
+    {"motor", 6, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7},
+    {"motor", 7, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8},
+
+
+    {"servo", 5, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_TRICOPTER}
+};
+
+
+
+static const blackboxConditionalFieldDefinition_t blackboxGpsGFields[] = {
+    {"time", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME},
+    {"GPS_numSat", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_coord", 0, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_coord", 1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_altitude", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_speed", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_ground_course", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS}
+};
+
+
+static const blackboxSimpleFieldDefinition_t blackboxGpsHFields[] = {
+    {"GPS_home", 0, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB},
+    {"GPS_home", 1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB}
+};
+
+
+
+static const blackboxSimpleFieldDefinition_t blackboxSlowFields[] = {
+    {"flightModeFlags", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB},
+    {"stateFlags", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB},
+
+    {"failsafePhase", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32},
+    {"rxSignalReceived", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32},
+    {"rxFlightChannelsValid", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32}
+};
+
+typedef enum BlackboxState {
+    BLACKBOX_STATE_DISABLED = 0,
+    BLACKBOX_STATE_STOPPED,
+    BLACKBOX_STATE_PREPARE_LOG_FILE,
+    BLACKBOX_STATE_SEND_HEADER,
+    BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER,
+    BLACKBOX_STATE_SEND_GPS_H_HEADER,
+    BLACKBOX_STATE_SEND_GPS_G_HEADER,
+    BLACKBOX_STATE_SEND_SLOW_HEADER,
+    BLACKBOX_STATE_SEND_SYSINFO,
+    BLACKBOX_STATE_PAUSED,
+    BLACKBOX_STATE_RUNNING,
+    BLACKBOX_STATE_SHUTTING_DOWN,
+    BLACKBOX_STATE_START_ERASE,
+    BLACKBOX_STATE_ERASING,
+    BLACKBOX_STATE_ERASED
+} BlackboxState;
+
+
+typedef struct blackboxMainState_s {
+    uint32_t time;
+
+    int32_t axisPID_P[3];
+    int32_t axisPID_I[3];
+    int32_t axisPID_D[3];
+    int32_t axisPID_F[3];
+
+    int16_t rcCommand[4];
+    int16_t setpoint[4];
+    int16_t gyroADC[3];
+    int16_t accADC[3];
+    int16_t debug[4];
+    int16_t motor[8];
+    int16_t servo[8];
+
+    uint16_t vbatLatest;
+    int32_t amperageLatest;
+
+
+    int32_t BaroAlt;
+
+
+    int16_t magADC[3];
+
+
+
+
+    uint16_t rssi;
+} blackboxMainState_t;
+
+typedef struct blackboxGpsState_s {
+    int32_t GPS_home[2];
+    int32_t GPS_coord[2];
+    uint8_t GPS_numSat;
+} blackboxGpsState_t;
+
+
+typedef struct blackboxSlowState_s {
+    uint32_t flightModeFlags;
+    uint8_t stateFlags;
+    uint8_t failsafePhase;
+    
+# 332 "./src/main/blackbox/blackbox.c" 3 4
+   _Bool 
+# 332 "./src/main/blackbox/blackbox.c"
+        rxSignalReceived;
+    
+# 333 "./src/main/blackbox/blackbox.c" 3 4
+   _Bool 
+# 333 "./src/main/blackbox/blackbox.c"
+        rxFlightChannelsValid;
+} __attribute__((__packed__)) blackboxSlowState_t;
+
+
+extern boxBitmask_t rcModeActivationMask;
+
+static BlackboxState blackboxState = BLACKBOX_STATE_DISABLED;
+
+static uint32_t blackboxLastArmingBeep = 0;
+static uint32_t blackboxLastFlightModeFlags = 0;
+
+static struct {
+    uint32_t headerIndex;
+
+
+
+
+    union {
+        int fieldIndex;
+        uint32_t startTime;
+    } u;
+} xmitState;
+
+
+static uint32_t blackboxConditionCache;
+
+_Static_assert(((sizeof(blackboxConditionCache) * 8) >= FLIGHT_LOG_FIELD_CONDITION_LAST), "too_many_flight_log_conditions");
+
+static uint32_t blackboxIteration;
+static uint16_t blackboxLoopIndex;
+static uint16_t blackboxPFrameIndex;
+static uint16_t blackboxIFrameIndex;
+
+
+static int16_t blackboxIInterval = 0;
+
+static int16_t blackboxPInterval = 0;
+static int32_t blackboxSInterval = 0;
+static int32_t blackboxSlowFrameIterationTimer;
+static 
+# 372 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 372 "./src/main/blackbox/blackbox.c"
+           blackboxLoggedAnyFrames;
+
+
+
+
+
+
+static uint16_t vbatReference;
+
+static blackboxGpsState_t gpsHistory;
+static blackboxSlowState_t slowHistory;
+
+
+static blackboxMainState_t blackboxHistoryRing[3];
+
+
+static blackboxMainState_t* blackboxHistory[3];
+
+static 
+# 390 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 390 "./src/main/blackbox/blackbox.c"
+           blackboxModeActivationConditionPresent = 
+# 390 "./src/main/blackbox/blackbox.c" 3 4
+                                                    0
+# 390 "./src/main/blackbox/blackbox.c"
+                                                         ;
+
+
+static int32_t blackboxIterationMaxBytes;
+
+
+
+
+
+# 398 "./src/main/blackbox/blackbox.c" 3 4
+_Bool 
+# 398 "./src/main/blackbox/blackbox.c"
+    blackboxMayEditConfig(void)
+{
+    return blackboxState <= BLACKBOX_STATE_STOPPED;
+}
+
+static 
+# 403 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 403 "./src/main/blackbox/blackbox.c"
+           blackboxIsOnlyLoggingIntraframes(void)
+{
+    return blackboxConfig()->p_ratio == 0;
+}
+
+static 
+# 408 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 408 "./src/main/blackbox/blackbox.c"
+           testBlackboxConditionUncached(FlightLogFieldCondition condition)
+{
+    switch (condition) {
+    case FLIGHT_LOG_FIELD_CONDITION_ALWAYS:
+        return 
+# 412 "./src/main/blackbox/blackbox.c" 3 4
+              1
+# 412 "./src/main/blackbox/blackbox.c"
+                  ;
+
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8:
+        return getMotorCount() >= condition - FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1 + 1;
+
+    case FLIGHT_LOG_FIELD_CONDITION_TRICOPTER:
+        return mixerConfig()->mixerMode == MIXER_TRI || mixerConfig()->mixerMode == MIXER_CUSTOM_TRI;
+
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0:
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1:
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2:
+        return currentPidProfile->pid[condition - FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0].D != 0;
+
+    case FLIGHT_LOG_FIELD_CONDITION_MAG:
+
+        return sensors(SENSOR_MAG);
+
+
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_BARO:
+
+        return sensors(SENSOR_BARO);
+
+
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_VBAT:
+        return batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE;
+
+    case FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC:
+        return (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) && (batteryConfig()->currentMeterSource != CURRENT_METER_VIRTUAL);
+
+    case FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER:
+
+
+
+        return 
+# 456 "./src/main/blackbox/blackbox.c" 3 4
+              0
+# 456 "./src/main/blackbox/blackbox.c"
+                   ;
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_RSSI:
+        return isRssiConfigured();
+
+    case FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME:
+        return blackboxConfig()->p_ratio != 1;
+
+    case FLIGHT_LOG_FIELD_CONDITION_ACC:
+        return sensors(SENSOR_ACC) && blackboxConfig()->record_acc;
+
+    case FLIGHT_LOG_FIELD_CONDITION_DEBUG:
+        return debugMode != DEBUG_NONE;
+
+    case FLIGHT_LOG_FIELD_CONDITION_NEVER:
+        return 
+# 472 "./src/main/blackbox/blackbox.c" 3 4
+              0
+# 472 "./src/main/blackbox/blackbox.c"
+                   ;
+
+    default:
+        return 
+# 475 "./src/main/blackbox/blackbox.c" 3 4
+              0
+# 475 "./src/main/blackbox/blackbox.c"
+                   ;
+    }
+}
+
+static void blackboxBuildConditionCache(void)
+{
+    blackboxConditionCache = 0;
+    for (FlightLogFieldCondition cond = FLIGHT_LOG_FIELD_CONDITION_FIRST; cond <= FLIGHT_LOG_FIELD_CONDITION_LAST; cond++) {
+        if (testBlackboxConditionUncached(cond)) {
+            blackboxConditionCache |= 1 << cond;
+        }
+    }
+}
+
+static 
+# 489 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 489 "./src/main/blackbox/blackbox.c"
+           testBlackboxCondition(FlightLogFieldCondition condition)
+{
+    return (blackboxConditionCache & (1 << condition)) != 0;
+}
+# 505 "./src/main/blackbox/blackbox.c"
+static int blackboxEncodingMaxBytes(uint8_t encoding)
+{
+    switch (encoding) {
+    case FLIGHT_LOG_FIELD_ENCODING_NULL:
+        return 0;
+    case FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT:
+        return 2;
+    case FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16:
+        return 1 + 2;
+    case FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB:
+        return 1 + 5;
+    case FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32:
+        return 1 + 4;
+    default:
+        return 5;
+    }
+}
+
+
+
+
+
+static int32_t blackboxCalculateIterationMaxBytes(void)
+{
+    int32_t iFrameBytes = 1;
+    int32_t pFrameBytes = 1;
+    for (unsigned i = 0; i < (sizeof(blackboxMainFields) / sizeof((blackboxMainFields)[0])); i++) {
+        if (testBlackboxCondition(blackboxMainFields[i].condition)) {
+            iFrameBytes += blackboxEncodingMaxBytes(blackboxMainFields[i].Iencode);
+            pFrameBytes += blackboxEncodingMaxBytes(blackboxMainFields[i].Pencode);
+        }
+    }
+
+    int32_t bytes = __extension__ ({ __typeof__ (iFrameBytes) _a = (iFrameBytes); __typeof__ (pFrameBytes) _b = (pFrameBytes); _a > _b ? _a : _b; }) + 1;
+    for (unsigned i = 0; i < (sizeof(blackboxSlowFields) / sizeof((blackboxSlowFields)[0])); i++) {
+        bytes += blackboxEncodingMaxBytes(blackboxSlowFields[i].encode);
+    }
+
+
+    if (featureIsEnabled(FEATURE_GPS)) {
+        bytes += 2;
+        for (unsigned i = 0; i < (sizeof(blackboxGpsHFields) / sizeof((blackboxGpsHFields)[0])); i++) {
+            bytes += blackboxEncodingMaxBytes(blackboxGpsHFields[i].encode);
+        }
+        for (unsigned i = 0; i < (sizeof(blackboxGpsGFields) / sizeof((blackboxGpsGFields)[0])); i++) {
+            if (testBlackboxCondition(blackboxGpsGFields[i].condition)) {
+                bytes += blackboxEncodingMaxBytes(blackboxGpsGFields[i].encode);
+            }
+        }
+    }
+
+
+    return bytes + 3 * (2 + 2 * 5);
+}
+
+static void blackboxSetState(BlackboxState newState)
+{
+
+    switch (newState) {
+    case BLACKBOX_STATE_PREPARE_LOG_FILE:
+        blackboxLoggedAnyFrames = 
+# 565 "./src/main/blackbox/blackbox.c" 3 4
+                                 0
+# 565 "./src/main/blackbox/blackbox.c"
+                                      ;
+        break;
+    case BLACKBOX_STATE_SEND_HEADER:
+        blackboxHeaderBudget = 0;
+        xmitState.headerIndex = 0;
+        xmitState.u.startTime = millis();
+        break;
+    case BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER:
+    case BLACKBOX_STATE_SEND_GPS_G_HEADER:
+    case BLACKBOX_STATE_SEND_GPS_H_HEADER:
+    case BLACKBOX_STATE_SEND_SLOW_HEADER:
+        xmitState.headerIndex = 0;
+        xmitState.u.fieldIndex = -1;
+        break;
+    case BLACKBOX_STATE_SEND_SYSINFO:
+        xmitState.headerIndex = 0;
+        break;
+    case BLACKBOX_STATE_RUNNING:
+        blackboxSlowFrameIterationTimer = blackboxSInterval;
+        break;
+    case BLACKBOX_STATE_SHUTTING_DOWN:
+        xmitState.u.startTime = millis();
+        break;
+    default:
+        ;
+    }
+    blackboxState = newState;
+}
+
+static void writeIntraframe(void)
+{
+    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+
+    blackboxWrite('I');
+
+    blackboxWriteUnsignedVB(blackboxIteration);
+    blackboxWriteUnsignedVB(blackboxCurrent->time);
+
+    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, 3);
+    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_I, 3);
+
+
+    for (int x = 0; x < 3; x++) {
+        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x]);
+        }
+    }
+
+    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_F, 3);
+
+
+    blackboxWriteSigned16VBArray(blackboxCurrent->rcCommand, 3);
+
+
+
+
+
+    blackboxWriteUnsignedVB(blackboxCurrent->rcCommand[THROTTLE]);
+
+
+    blackboxWriteSigned16VBArray(blackboxCurrent->setpoint, 4);
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
+
+
+
+
+
+
+        blackboxWriteUnsignedVB((vbatReference - blackboxCurrent->vbatLatest) & 0x3FFF);
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC)) {
+
+        blackboxWriteSignedVB(blackboxCurrent->amperageLatest);
+    }
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
+        blackboxWriteSigned16VBArray(blackboxCurrent->magADC, 3);
+    }
+
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
+        blackboxWriteSignedVB(blackboxCurrent->BaroAlt);
+    }
+# 660 "./src/main/blackbox/blackbox.c"
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
+        blackboxWriteUnsignedVB(blackboxCurrent->rssi);
+    }
+
+    blackboxWriteSigned16VBArray(blackboxCurrent->gyroADC, 3);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
+        blackboxWriteSigned16VBArray(blackboxCurrent->accADC, 3);
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
+        blackboxWriteSigned16VBArray(blackboxCurrent->debug, 4);
+    }
+
+
+    blackboxWriteUnsignedVB(blackboxCurrent->motor[0] - motorOutputLow);
+
+
+    const int motorCount = getMotorCount();
+    for (int x = 1; x < motorCount; x++) {
+        blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
+
+        blackboxWriteSignedVB(blackboxCurrent->servo[5] - 1500);
+    }
+
+
+
+
+    blackboxHistory[1] = blackboxHistory[0];
+
+    blackboxHistory[2] = blackboxHistory[0];
+
+    blackboxHistory[0] = ((blackboxHistory[0] - blackboxHistoryRing + 1) % 3) + blackboxHistoryRing;
+
+    blackboxLoggedAnyFrames = 
+# 696 "./src/main/blackbox/blackbox.c" 3 4
+                             1
+# 696 "./src/main/blackbox/blackbox.c"
+                                 ;
+}
+
+static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHistory, int count)
+{
+    int16_t *curr = (int16_t*) ((char*) (blackboxHistory[0]) + arrOffsetInHistory);
+    int16_t *prev1 = (int16_t*) ((char*) (blackboxHistory[1]) + arrOffsetInHistory);
+    int16_t *prev2 = (int16_t*) ((char*) (blackboxHistory[2]) + arrOffsetInHistory);
+
+    for (int i = 0; i < count; i++) {
+
+        int32_t predictor = (prev1[i] + prev2[i]) / 2;
+
+        blackboxWriteSignedVB(curr[i] - predictor);
+    }
+}
+
+static void writeInterframe(void)
+{
+    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+    blackboxMainState_t *blackboxLast = blackboxHistory[1];
+
+    blackboxWrite('P');
+
+
+
+
+
+
+
+    blackboxWriteSignedVB((int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
+
+    int32_t deltas[8];
+    int32_t setpointDeltas[4];
+
+    arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, 3);
+    blackboxWriteSignedVBArray(deltas, 3);
+
+
+
+
+
+    arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, 3);
+    blackboxWriteTag2_3S32(deltas);
+
+
+
+
+
+    for (int x = 0; x < 3; x++) {
+        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
+        }
+    }
+
+    arraySubInt32(deltas, blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, 3);
+    blackboxWriteSignedVBArray(deltas, 3);
+
+
+
+
+
+    for (int x = 0; x < 4; x++) {
+        deltas[x] = blackboxCurrent->rcCommand[x] - blackboxLast->rcCommand[x];
+        setpointDeltas[x] = blackboxCurrent->setpoint[x] - blackboxLast->setpoint[x];
+    }
+
+    blackboxWriteTag8_4S16(deltas);
+    blackboxWriteTag8_4S16(setpointDeltas);
+
+
+    int optionalFieldCount = 0;
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
+        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->vbatLatest - blackboxLast->vbatLatest;
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC)) {
+        deltas[optionalFieldCount++] = blackboxCurrent->amperageLatest - blackboxLast->amperageLatest;
+    }
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
+        for (int x = 0; x < 3; x++) {
+            deltas[optionalFieldCount++] = blackboxCurrent->magADC[x] - blackboxLast->magADC[x];
+        }
+    }
+
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
+        deltas[optionalFieldCount++] = blackboxCurrent->BaroAlt - blackboxLast->BaroAlt;
+    }
+# 797 "./src/main/blackbox/blackbox.c"
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
+        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->rssi - blackboxLast->rssi;
+    }
+
+    blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
+
+
+    blackboxWriteMainStateArrayUsingAveragePredictor(
+# 804 "./src/main/blackbox/blackbox.c" 3 4
+                                                    __builtin_offsetof (
+# 804 "./src/main/blackbox/blackbox.c"
+                                                    blackboxMainState_t
+# 804 "./src/main/blackbox/blackbox.c" 3 4
+                                                    , 
+# 804 "./src/main/blackbox/blackbox.c"
+                                                    gyroADC
+# 804 "./src/main/blackbox/blackbox.c" 3 4
+                                                    )
+# 804 "./src/main/blackbox/blackbox.c"
+                                                                                          , 3);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(
+# 806 "./src/main/blackbox/blackbox.c" 3 4
+                                                        __builtin_offsetof (
+# 806 "./src/main/blackbox/blackbox.c"
+                                                        blackboxMainState_t
+# 806 "./src/main/blackbox/blackbox.c" 3 4
+                                                        , 
+# 806 "./src/main/blackbox/blackbox.c"
+                                                        accADC
+# 806 "./src/main/blackbox/blackbox.c" 3 4
+                                                        )
+# 806 "./src/main/blackbox/blackbox.c"
+                                                                                             , 3);
+    }
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(
+# 809 "./src/main/blackbox/blackbox.c" 3 4
+                                                        __builtin_offsetof (
+# 809 "./src/main/blackbox/blackbox.c"
+                                                        blackboxMainState_t
+# 809 "./src/main/blackbox/blackbox.c" 3 4
+                                                        , 
+# 809 "./src/main/blackbox/blackbox.c"
+                                                        debug
+# 809 "./src/main/blackbox/blackbox.c" 3 4
+                                                        )
+# 809 "./src/main/blackbox/blackbox.c"
+                                                                                            , 4);
+    }
+    blackboxWriteMainStateArrayUsingAveragePredictor(
+# 811 "./src/main/blackbox/blackbox.c" 3 4
+                                                    __builtin_offsetof (
+# 811 "./src/main/blackbox/blackbox.c"
+                                                    blackboxMainState_t
+# 811 "./src/main/blackbox/blackbox.c" 3 4
+                                                    , 
+# 811 "./src/main/blackbox/blackbox.c"
+                                                    motor
+# 811 "./src/main/blackbox/blackbox.c" 3 4
+                                                    )
+# 811 "./src/main/blackbox/blackbox.c"
+                                                                                        , getMotorCount());
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
+        blackboxWriteSignedVB(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
+    }
+
+
+    blackboxHistory[2] = blackboxHistory[1];
+    blackboxHistory[1] = blackboxHistory[0];
+    blackboxHistory[0] = ((blackboxHistory[0] - blackboxHistoryRing + 1) % 3) + blackboxHistoryRing;
+
+    blackboxLoggedAnyFrames = 
+# 822 "./src/main/blackbox/blackbox.c" 3 4
+                             1
+# 822 "./src/main/blackbox/blackbox.c"
+                                 ;
+}
+
+
+
+static void writeSlowFrame(void)
+{
+    int32_t values[3];
+
+    blackboxWrite('S');
+
+    blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
+    blackboxWriteUnsignedVB(slowHistory.stateFlags);
+
+
+
+
+    values[0] = slowHistory.failsafePhase;
+    values[1] = slowHistory.rxSignalReceived ? 1 : 0;
+    values[2] = slowHistory.rxFlightChannelsValid ? 1 : 0;
+    blackboxWriteTag2_3S32(values);
+
+    blackboxSlowFrameIterationTimer = 0;
+}
+
+
+
+
+static void loadSlowState(blackboxSlowState_t *slow)
+{
+    memcpy(&slow->flightModeFlags, &rcModeActivationMask, sizeof(slow->flightModeFlags));
+    slow->stateFlags = stateFlags;
+    slow->failsafePhase = failsafePhase();
+    slow->rxSignalReceived = rxIsReceivingSignal();
+    slow->rxFlightChannelsValid = rxAreFlightChannelsValid();
+}
+
+
+
+
+
+
+
+static 
+# 865 "./src/main/blackbox/blackbox.c" 3 4
+                  _Bool 
+# 865 "./src/main/blackbox/blackbox.c"
+                       writeSlowFrameIfNeeded(void)
+{
+
+    
+# 868 "./src/main/blackbox/blackbox.c" 3 4
+   _Bool 
+# 868 "./src/main/blackbox/blackbox.c"
+        shouldWrite = blackboxSlowFrameIterationTimer >= blackboxSInterval;
+
+    if (shouldWrite) {
+        loadSlowState(&slowHistory);
+    } else {
+        blackboxSlowState_t newSlowState;
+
+        loadSlowState(&newSlowState);
+
+
+        if (memcmp(&newSlowState, &slowHistory, sizeof(slowHistory)) != 0) {
+
+            memcpy(&slowHistory, &newSlowState, sizeof(slowHistory));
+            shouldWrite = 
+# 881 "./src/main/blackbox/blackbox.c" 3 4
+                         1
+# 881 "./src/main/blackbox/blackbox.c"
+                             ;
+        }
+    }
+
+    if (shouldWrite) {
+        writeSlowFrame();
+    }
+    return shouldWrite;
+}
+
+void blackboxValidateConfig(void)
+{
+
+    if (blackboxConfig()->mode == BLACKBOX_MODE_STREAM) {
+        blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    }
+
+
+    switch (blackboxConfig()->device) {
+
+    case BLACKBOX_DEVICE_FLASH:
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+
+    case BLACKBOX_DEVICE_SERIAL:
+
+        break;
+
+    default:
+        blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    }
+}
+
+static void blackboxResetIterationTimers(void)
+{
+    blackboxIteration = 0;
+    blackboxLoopIndex = 0;
+    blackboxIFrameIndex = 0;
+    blackboxPFrameIndex = 0;
+    blackboxSlowFrameIterationTimer = 0;
+}
+
+
+
+
+static void blackboxStart(void)
+{
+    blackboxValidateConfig();
+
+    if (!blackboxDeviceOpen()) {
+        blackboxSetState(BLACKBOX_STATE_DISABLED);
+        return;
+    }
+
+    memset(&gpsHistory, 0, sizeof(gpsHistory));
+
+    blackboxHistory[0] = &blackboxHistoryRing[0];
+    blackboxHistory[1] = &blackboxHistoryRing[1];
+    blackboxHistory[2] = &blackboxHistoryRing[2];
+
+    vbatReference = getBatteryVoltageLatest();
+# 951 "./src/main/blackbox/blackbox.c"
+    blackboxBuildConditionCache();
+
+    blackboxIterationMaxBytes = blackboxCalculateIterationMaxBytes();
+    if (blackboxConfig()->mode == BLACKBOX_MODE_STREAM && !blackboxDeviceStreamCanHold(blackboxIterationMaxBytes)) {
+
+        blackboxDeviceClose();
+        blackboxSetState(BLACKBOX_STATE_DISABLED);
+        return;
+    }
+
+    blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
+
+    blackboxResetIterationTimers();
+
+
+
+
+
+    blackboxLastArmingBeep = getArmingBeepTimeMicros();
+    memcpy(&blackboxLastFlightModeFlags, &rcModeActivationMask, sizeof(blackboxLastFlightModeFlags));
+
+    blackboxSetState(BLACKBOX_STATE_PREPARE_LOG_FILE);
+}
+
+
+
+
+void blackboxFinish(void)
+{
+    switch (blackboxState) {
+    case BLACKBOX_STATE_DISABLED:
+    case BLACKBOX_STATE_STOPPED:
+    case BLACKBOX_STATE_SHUTTING_DOWN:
+
+        break;
+    case BLACKBOX_STATE_RUNNING:
+    case BLACKBOX_STATE_PAUSED:
+        blackboxLogEvent(FLIGHT_LOG_EVENT_LOG_END, 
+# 988 "./src/main/blackbox/blackbox.c" 3 4
+                                                  ((void *)0)
+# 988 "./src/main/blackbox/blackbox.c"
+                                                      );
+        __attribute__ ((fallthrough));
+    default:
+        blackboxSetState(BLACKBOX_STATE_SHUTTING_DOWN);
+    }
+}
+
+
+
+
+static 
+# 998 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 998 "./src/main/blackbox/blackbox.c"
+           startedLoggingInTestMode = 
+# 998 "./src/main/blackbox/blackbox.c" 3 4
+                                      0
+# 998 "./src/main/blackbox/blackbox.c"
+                                           ;
+
+static void startInTestMode(void)
+{
+    if (!startedLoggingInTestMode) {
+        if (blackboxConfig()->device == BLACKBOX_DEVICE_SERIAL) {
+            serialPort_t *sharedBlackboxAndMspPort = findSharedSerialPort(FUNCTION_BLACKBOX, FUNCTION_MSP);
+            if (sharedBlackboxAndMspPort) {
+                return;
+            }
+        }
+        blackboxStart();
+        startedLoggingInTestMode = 
+# 1010 "./src/main/blackbox/blackbox.c" 3 4
+                                  1
+# 1010 "./src/main/blackbox/blackbox.c"
+                                      ;
+    }
+}
+
+static void stopInTestMode(void)
+{
+    if (startedLoggingInTestMode) {
+        blackboxFinish();
+        startedLoggingInTestMode = 
+# 1018 "./src/main/blackbox/blackbox.c" 3 4
+                                  0
+# 1018 "./src/main/blackbox/blackbox.c"
+                                       ;
+    }
+}
+# 1031 "./src/main/blackbox/blackbox.c"
+static 
+# 1031 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1031 "./src/main/blackbox/blackbox.c"
+           inMotorTestMode(void) {
+    static uint32_t resetTime = 0;
+
+    if (!(armingFlags & (ARMED)) && areMotorsRunning()) {
+        resetTime = millis() + 5000;
+        return 
+# 1036 "./src/main/blackbox/blackbox.c" 3 4
+              1
+# 1036 "./src/main/blackbox/blackbox.c"
+                  ;
+    } else {
+
+        return (millis() < resetTime);
+    }
+    return 
+# 1041 "./src/main/blackbox/blackbox.c" 3 4
+          0
+# 1041 "./src/main/blackbox/blackbox.c"
+               ;
+}
+
+
+static void writeGPSHomeFrame(void)
+{
+    blackboxWrite('H');
+
+    blackboxWriteSignedVB(GPS_home[0]);
+    blackboxWriteSignedVB(GPS_home[1]);
+
+
+    gpsHistory.GPS_home[0] = GPS_home[0];
+    gpsHistory.GPS_home[1] = GPS_home[1];
+}
+
+static void writeGPSFrame(timeUs_t currentTimeUs)
+{
+    blackboxWrite('G');
+
+
+
+
+
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME)) {
+
+        blackboxWriteUnsignedVB(currentTimeUs - blackboxHistory[1]->time);
+    }
+
+    blackboxWriteUnsignedVB(gpsSol.numSat);
+    blackboxWriteSignedVB(gpsSol.llh.lat - gpsHistory.GPS_home[0]);
+    blackboxWriteSignedVB(gpsSol.llh.lon - gpsHistory.GPS_home[1]);
+    blackboxWriteUnsignedVB(gpsSol.llh.altCm / 10);
+    blackboxWriteUnsignedVB(gpsSol.groundSpeed);
+    blackboxWriteUnsignedVB(gpsSol.groundCourse);
+
+    gpsHistory.GPS_numSat = gpsSol.numSat;
+    gpsHistory.GPS_coord[0] = gpsSol.llh.lat;
+    gpsHistory.GPS_coord[1] = gpsSol.llh.lon;
+}
+
+
+
+
+
+static void loadMainState(timeUs_t currentTimeUs)
+{
+
+    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+
+    blackboxCurrent->time = currentTimeUs;
+
+    for (int i = 0; i < 3; i++) {
+        blackboxCurrent->axisPID_P[i] = pidData[i].P;
+        blackboxCurrent->axisPID_I[i] = pidData[i].I;
+        blackboxCurrent->axisPID_D[i] = pidData[i].D;
+        blackboxCurrent->axisPID_F[i] = pidData[i].F;
+        blackboxCurrent->gyroADC[i] = lrintf(gyro.gyroADCf[i]);
+
+        blackboxCurrent->accADC[i] = lrintf(acc.accADC[i]);
+
+
+        blackboxCurrent->magADC[i] = mag.magADC[i];
+
+    }
+
+    for (int i = 0; i < 4; i++) {
+        blackboxCurrent->rcCommand[i] = lrintf(rcCommand[i]);
+    }
+
+
+    for (int i = 0; i < 3; i++) {
+        blackboxCurrent->setpoint[i] = lrintf(pidGetPreviousSetpoint(i));
+    }
+
+    blackboxCurrent->setpoint[3] = lrintf(mixerGetLoggingThrottle() * 1000);
+
+    for (int i = 0; i < 4; i++) {
+        blackboxCurrent->debug[i] = debug[i];
+    }
+
+    const int motorCount = getMotorCount();
+    for (int i = 0; i < motorCount; i++) {
+        blackboxCurrent->motor[i] = motor[i];
+    }
+
+    blackboxCurrent->vbatLatest = getBatteryVoltageLatest();
+    blackboxCurrent->amperageLatest = getAmperageLatest();
+
+
+    blackboxCurrent->BaroAlt = baro.BaroAlt;
+
+
+
+
+
+
+
+    blackboxCurrent->rssi = getRssi();
+
+
+
+    blackboxCurrent->servo[5] = servo[5];
+
+
+
+
+}
+# 1171 "./src/main/blackbox/blackbox.c"
+static 
+# 1171 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1171 "./src/main/blackbox/blackbox.c"
+           sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const void *fieldDefinitions,
+        const void *secondFieldDefinition, int fieldCount, const uint8_t *conditions, const uint8_t *secondCondition)
+{
+    const blackboxFieldDefinition_t *def;
+    unsigned int headerCount;
+    static 
+# 1176 "./src/main/blackbox/blackbox.c" 3 4
+          _Bool 
+# 1176 "./src/main/blackbox/blackbox.c"
+               needComma = 
+# 1176 "./src/main/blackbox/blackbox.c" 3 4
+                           0
+# 1176 "./src/main/blackbox/blackbox.c"
+                                ;
+    size_t definitionStride = (char*) secondFieldDefinition - (char*) fieldDefinitions;
+    size_t conditionsStride = (char*) secondCondition - (char*) conditions;
+
+    if (deltaFrameChar) {
+        headerCount = (sizeof(blackboxFieldHeaderNames) / sizeof((blackboxFieldHeaderNames)[0]));
+    } else {
+        headerCount = ((sizeof(blackboxFieldHeaderNames) / sizeof((blackboxFieldHeaderNames)[0])) - 2);
+    }
+
+
+
+
+
+
+
+    if (xmitState.u.fieldIndex == -1) {
+        if (xmitState.headerIndex >= headerCount) {
+            return 
+# 1194 "./src/main/blackbox/blackbox.c" 3 4
+                  0
+# 1194 "./src/main/blackbox/blackbox.c"
+                       ;
+        }
+
+        uint32_t charsToBeWritten = strlen("H Field x :") + strlen(blackboxFieldHeaderNames[xmitState.headerIndex]);
+
+        if (blackboxDeviceReserveBufferSpace(charsToBeWritten) != BLACKBOX_RESERVE_SUCCESS) {
+            return 
+# 1200 "./src/main/blackbox/blackbox.c" 3 4
+                  1
+# 1200 "./src/main/blackbox/blackbox.c"
+                      ;
+        }
+
+        blackboxHeaderBudget -= blackboxPrintf("H Field %c %s:", xmitState.headerIndex >= ((sizeof(blackboxFieldHeaderNames) / sizeof((blackboxFieldHeaderNames)[0])) - 2) ? deltaFrameChar : mainFrameChar, blackboxFieldHeaderNames[xmitState.headerIndex]);
+
+        xmitState.u.fieldIndex++;
+        needComma = 
+# 1206 "./src/main/blackbox/blackbox.c" 3 4
+                   0
+# 1206 "./src/main/blackbox/blackbox.c"
+                        ;
+    }
+
+
+    const uint32_t LONGEST_INTEGER_STRLEN = 2;
+
+    for (; xmitState.u.fieldIndex < fieldCount; xmitState.u.fieldIndex++) {
+        def = (const blackboxFieldDefinition_t*) ((const char*)fieldDefinitions + definitionStride * xmitState.u.fieldIndex);
+
+        if (!conditions || testBlackboxCondition(conditions[conditionsStride * xmitState.u.fieldIndex])) {
+
+
+            int32_t bytesToWrite = 1;
+
+
+            if (xmitState.headerIndex == 0) {
+                bytesToWrite += strlen(def->name) + strlen("[]") + LONGEST_INTEGER_STRLEN;
+            } else {
+
+                bytesToWrite += LONGEST_INTEGER_STRLEN;
+            }
+
+
+            if (blackboxDeviceReserveBufferSpace(bytesToWrite) != BLACKBOX_RESERVE_SUCCESS) {
+
+                return 
+# 1231 "./src/main/blackbox/blackbox.c" 3 4
+                      1
+# 1231 "./src/main/blackbox/blackbox.c"
+                          ;
+            }
+
+            blackboxHeaderBudget -= bytesToWrite;
+
+            if (needComma) {
+                blackboxWrite(',');
+            } else {
+                needComma = 
+# 1239 "./src/main/blackbox/blackbox.c" 3 4
+                           1
+# 1239 "./src/main/blackbox/blackbox.c"
+                               ;
+            }
+
+
+            if (xmitState.headerIndex == 0) {
+                blackboxWriteString(def->name);
+
+
+                if (def->fieldNameIndex != -1) {
+                    blackboxPrintf("[%d]", def->fieldNameIndex);
+                }
+            } else {
+
+                blackboxPrintf("%d", def->arr[xmitState.headerIndex - 1]);
+            }
+        }
+    }
+
+
+    if (xmitState.u.fieldIndex == fieldCount && blackboxDeviceReserveBufferSpace(1) == BLACKBOX_RESERVE_SUCCESS) {
+        blackboxHeaderBudget--;
+        blackboxWrite('\n');
+        xmitState.headerIndex++;
+        xmitState.u.fieldIndex = -1;
+    }
+
+    return xmitState.headerIndex < headerCount;
+}
+
+
+static char *blackboxGetStartDateTime(char *buf)
+{
+
+    dateTime_t dt;
+
+
+    rtcGetDateTime(&dt);
+    dateTimeFormatLocal(buf, &dt);
+
+
+
+
+    return buf;
+}
+# 1294 "./src/main/blackbox/blackbox.c"
+static 
+# 1294 "./src/main/blackbox/blackbox.c" 3 4
+                  _Bool 
+# 1294 "./src/main/blackbox/blackbox.c"
+                       blackboxWriteSysinfo(void);
+
+
+
+
+
+
+static 
+# 1301 "./src/main/blackbox/blackbox.c" 3 4
+                  _Bool 
+# 1301 "./src/main/blackbox/blackbox.c"
+                       blackboxWriteSysinfo(void)
+{
+    const uint16_t motorOutputLowInt = lrintf(motorOutputLow);
+    const uint16_t motorOutputHighInt = lrintf(motorOutputHigh);
+
+
+    if (blackboxDeviceReserveBufferSpace(64) != BLACKBOX_RESERVE_SUCCESS) {
+        return 
+# 1308 "./src/main/blackbox/blackbox.c" 3 4
+              0
+# 1308 "./src/main/blackbox/blackbox.c"
+                   ;
+    }
+
+    char buf[30];
+
+
+    rcSmoothingFilter_t *rcSmoothingData = getRcSmoothingData();
+
+
+    const controlRateConfig_t *currentControlRateProfile = controlRateProfiles(systemConfig()->activeRateProfile);
+    switch (xmitState.headerIndex) {
+        case 0: blackboxPrintfHeaderLine("Firmware type", "%s", "Cleanflight"); break;;
+        case 1: blackboxPrintfHeaderLine("Firmware revision", "%s %s (%s) %s", "Betaflight", "4" "." "1" "." "0", shortGitRevision, targetName); break;;
+        case 2: blackboxPrintfHeaderLine("Firmware date", "%s %s", buildDate, buildTime); break;;
+        case 3: blackboxPrintfHeaderLine("Log start datetime", "%s", blackboxGetStartDateTime(buf)); break;;
+        case 4: blackboxPrintfHeaderLine("Craft name", "%s", pilotConfig()->name); break;;
+        case 5: blackboxPrintfHeaderLine("I interval", "%d", blackboxIInterval); break;;
+        case 6: blackboxPrintfHeaderLine("P interval", "%d", blackboxPInterval); break;;
+        case 7: blackboxPrintfHeaderLine("P ratio", "%d", blackboxConfig()->p_ratio); break;;
+        case 8: blackboxPrintfHeaderLine("minthrottle", "%d", motorConfig()->minthrottle); break;;
+        case 9: blackboxPrintfHeaderLine("maxthrottle", "%d", motorConfig()->maxthrottle); break;;
+        case 10: blackboxPrintfHeaderLine("gyro_scale", "0x%x", castFloatBytesToInt(1.0f)); break;;
+        case 11: blackboxPrintfHeaderLine("motorOutput", "%d,%d", motorOutputLowInt,motorOutputHighInt); break;;
+
+        case 12: blackboxPrintfHeaderLine("acc_1G", "%u", acc.dev.acc_1G); break;;
+
+
+        case 13: {if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) { blackboxPrintfHeaderLine("vbat_scale", "%u", voltageSensorADCConfig(VOLTAGE_SENSOR_ADC_VBAT)->vbatscale); } else { xmitState.headerIndex += 2; }}; break;
+
+
+
+
+
+             ;
+
+        case 14: blackboxPrintfHeaderLine("vbatcellvoltage", "%u,%u,%u", batteryConfig()->vbatmincellvoltage, batteryConfig()->vbatwarningcellvoltage, batteryConfig()->vbatmaxcellvoltage); break;
+
+                                                                                                                ;
+        case 15: blackboxPrintfHeaderLine("vbatref", "%u", vbatReference); break;;
+
+        case 16: {if (batteryConfig()->currentMeterSource == CURRENT_METER_ADC) { blackboxPrintfHeaderLine("currentSensor", "%d,%d",currentSensorADCConfig()->offset, currentSensorADCConfig()->scale); }}; break;
+
+
+
+             ;
+
+        case 17: blackboxPrintfHeaderLine("looptime", "%d", gyro.targetLooptime); break;;
+        case 18: blackboxPrintfHeaderLine("gyro_sync_denom", "%d", gyroConfig()->gyro_sync_denom); break;;
+        case 19: blackboxPrintfHeaderLine("pid_process_denom", "%d", pidConfig()->pid_process_denom); break;;
+        case 20: blackboxPrintfHeaderLine("thr_mid", "%d", currentControlRateProfile->thrMid8); break;;
+        case 21: blackboxPrintfHeaderLine("thr_expo", "%d", currentControlRateProfile->thrExpo8); break;;
+        case 22: blackboxPrintfHeaderLine("tpa_rate", "%d", currentControlRateProfile->dynThrPID); break;;
+        case 23: blackboxPrintfHeaderLine("tpa_breakpoint", "%d", currentControlRateProfile->tpa_breakpoint); break;;
+        case 24: blackboxPrintfHeaderLine("rc_rates", "%d,%d,%d", currentControlRateProfile->rcRates[ROLL], currentControlRateProfile->rcRates[PITCH], currentControlRateProfile->rcRates[YAW]); break;
+
+                                                                                                                    ;
+        case 25: blackboxPrintfHeaderLine("rc_expo", "%d,%d,%d", currentControlRateProfile->rcExpo[ROLL], currentControlRateProfile->rcExpo[PITCH], currentControlRateProfile->rcExpo[YAW]); break;
+
+                                                                                                                   ;
+        case 26: blackboxPrintfHeaderLine("rates", "%d,%d,%d", currentControlRateProfile->rates[ROLL], currentControlRateProfile->rates[PITCH], currentControlRateProfile->rates[YAW]); break;
+
+                                                                                                                  ;
+        case 27: blackboxPrintfHeaderLine("rate_limits", "%d,%d,%d", currentControlRateProfile->rate_limit[ROLL], currentControlRateProfile->rate_limit[PITCH], currentControlRateProfile->rate_limit[YAW]); break;
+
+                                                                                                                       ;
+        case 28: blackboxPrintfHeaderLine("rollPID", "%d,%d,%d", currentPidProfile->pid[PID_ROLL].P, currentPidProfile->pid[PID_ROLL].I, currentPidProfile->pid[PID_ROLL].D); break;
+
+                                                                                                               ;
+        case 29: blackboxPrintfHeaderLine("pitchPID", "%d,%d,%d", currentPidProfile->pid[PID_PITCH].P, currentPidProfile->pid[PID_PITCH].I, currentPidProfile->pid[PID_PITCH].D); break;
+
+                                                                                                                ;
+        case 30: blackboxPrintfHeaderLine("yawPID", "%d,%d,%d", currentPidProfile->pid[PID_YAW].P, currentPidProfile->pid[PID_YAW].I, currentPidProfile->pid[PID_YAW].D); break;
+
+                                                                                                              ;
+        case 31: blackboxPrintfHeaderLine("levelPID", "%d,%d,%d", currentPidProfile->pid[PID_LEVEL].P, currentPidProfile->pid[PID_LEVEL].I, currentPidProfile->pid[PID_LEVEL].D); break;
+
+                                                                                                                ;
+        case 32: blackboxPrintfHeaderLine("magPID", "%d", currentPidProfile->pid[PID_MAG].P); break;;
+
+        case 33: blackboxPrintfHeaderLine("d_min", "%d,%d,%d", currentPidProfile->d_min[ROLL], currentPidProfile->d_min[PITCH], currentPidProfile->d_min[YAW]); break;
+
+                                                                                                          ;
+        case 34: blackboxPrintfHeaderLine("d_min_gain", "%d", currentPidProfile->d_min_gain); break;;
+        case 35: blackboxPrintfHeaderLine("d_min_advance", "%d", currentPidProfile->d_min_advance); break;;
+
+        case 36: blackboxPrintfHeaderLine("dterm_filter_type", "%d", currentPidProfile->dterm_filter_type); break;;
+        case 37: blackboxPrintfHeaderLine("dterm_lowpass_hz", "%d", currentPidProfile->dterm_lowpass_hz); break;;
+
+        case 38: blackboxPrintfHeaderLine("dterm_lowpass_dyn_hz", "%d,%d", currentPidProfile->dyn_lpf_dterm_min_hz, currentPidProfile->dyn_lpf_dterm_max_hz); break;
+                                                                                                                    ;
+
+        case 39: blackboxPrintfHeaderLine("dterm_filter2_type", "%d", currentPidProfile->dterm_filter2_type); break;;
+        case 40: blackboxPrintfHeaderLine("dterm_lowpass2_hz", "%d", currentPidProfile->dterm_lowpass2_hz); break;;
+        case 41: blackboxPrintfHeaderLine("yaw_lowpass_hz", "%d", currentPidProfile->yaw_lowpass_hz); break;;
+        case 42: blackboxPrintfHeaderLine("dterm_notch_hz", "%d", currentPidProfile->dterm_notch_hz); break;;
+        case 43: blackboxPrintfHeaderLine("dterm_notch_cutoff", "%d", currentPidProfile->dterm_notch_cutoff); break;;
+        case 44: blackboxPrintfHeaderLine("iterm_windup", "%d", currentPidProfile->itermWindupPointPercent); break;;
+        case 45: blackboxPrintfHeaderLine("vbat_pid_gain", "%d", currentPidProfile->vbatPidCompensation); break;;
+        case 46: blackboxPrintfHeaderLine("pidAtMinThrottle", "%d", currentPidProfile->pidAtMinThrottle); break;;
+
+
+        case 47: blackboxPrintfHeaderLine("anti_gravity_mode", "%d", currentPidProfile->antiGravityMode); break;;
+        case 48: blackboxPrintfHeaderLine("anti_gravity_threshold", "%d", currentPidProfile->itermThrottleThreshold); break;;
+        case 49: blackboxPrintfHeaderLine("anti_gravity_gain", "%d", currentPidProfile->itermAcceleratorGain); break;;
+
+        case 50: blackboxPrintfHeaderLine("abs_control_gain", "%d", currentPidProfile->abs_control_gain); break;;
+
+
+        case 51: blackboxPrintfHeaderLine("use_integrated_yaw", "%d", currentPidProfile->use_integrated_yaw); break;;
+
+        case 52: blackboxPrintfHeaderLine("feedforward_transition", "%d", currentPidProfile->feedForwardTransition); break;;
+        case 53: blackboxPrintfHeaderLine("feedforward_weight", "%d,%d,%d", currentPidProfile->pid[PID_ROLL].F, currentPidProfile->pid[PID_PITCH].F, currentPidProfile->pid[PID_YAW].F); break;
+
+                                                                                                              ;
+
+        case 54: blackboxPrintfHeaderLine("acc_limit_yaw", "%d", currentPidProfile->yawRateAccelLimit); break;;
+        case 55: blackboxPrintfHeaderLine("acc_limit", "%d", currentPidProfile->rateAccelLimit); break;;
+        case 56: blackboxPrintfHeaderLine("pidsum_limit", "%d", currentPidProfile->pidSumLimit); break;;
+        case 57: blackboxPrintfHeaderLine("pidsum_limit_yaw", "%d", currentPidProfile->pidSumLimitYaw); break;;
+
+
+        case 58: blackboxPrintfHeaderLine("deadband", "%d", rcControlsConfig()->deadband); break;;
+        case 59: blackboxPrintfHeaderLine("yaw_deadband", "%d", rcControlsConfig()->yaw_deadband); break;;
+
+        case 60: blackboxPrintfHeaderLine("gyro_hardware_lpf", "%d", gyroConfig()->gyro_hardware_lpf); break;;
+        case 61: blackboxPrintfHeaderLine("gyro_lowpass_type", "%d", gyroConfig()->gyro_lowpass_type); break;;
+        case 62: blackboxPrintfHeaderLine("gyro_lowpass_hz", "%d", gyroConfig()->gyro_lowpass_hz); break;;
+
+        case 63: blackboxPrintfHeaderLine("gyro_lowpass_dyn_hz", "%d,%d", gyroConfig()->dyn_lpf_gyro_min_hz, gyroConfig()->dyn_lpf_gyro_max_hz); break;
+                                                                                                              ;
+
+        case 64: blackboxPrintfHeaderLine("gyro_lowpass2_type", "%d", gyroConfig()->gyro_lowpass2_type); break;;
+        case 65: blackboxPrintfHeaderLine("gyro_lowpass2_hz", "%d", gyroConfig()->gyro_lowpass2_hz); break;;
+        case 66: blackboxPrintfHeaderLine("gyro_notch_hz", "%d,%d", gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_hz_2); break;
+                                                                                                               ;
+        case 67: blackboxPrintfHeaderLine("gyro_notch_cutoff", "%d,%d", gyroConfig()->gyro_soft_notch_cutoff_1, gyroConfig()->gyro_soft_notch_cutoff_2); break;
+                                                                                                                   ;
+
+        case 68: blackboxPrintfHeaderLine("acc_lpf_hz", "%d", (int)(accelerometerConfig()->acc_lpf_hz * 100.0f)); break;;
+        case 69: blackboxPrintfHeaderLine("acc_hardware", "%d", accelerometerConfig()->acc_hardware); break;;
+
+
+        case 70: blackboxPrintfHeaderLine("baro_hardware", "%d", barometerConfig()->baro_hardware); break;;
+
+
+        case 71: blackboxPrintfHeaderLine("mag_hardware", "%d", compassConfig()->mag_hardware); break;;
+
+        case 72: blackboxPrintfHeaderLine("gyro_cal_on_first_arm", "%d", armingConfig()->gyro_cal_on_first_arm); break;;
+        case 73: blackboxPrintfHeaderLine("rc_interpolation", "%d", rxConfig()->rcInterpolation); break;;
+        case 74: blackboxPrintfHeaderLine("rc_interpolation_interval", "%d", rxConfig()->rcInterpolationInterval); break;;
+        case 75: blackboxPrintfHeaderLine("rc_interpolation_channels", "%d", rxConfig()->rcInterpolationChannels); break;;
+        case 76: blackboxPrintfHeaderLine("airmode_activate_throttle", "%d", rxConfig()->airModeActivateThreshold); break;;
+        case 77: blackboxPrintfHeaderLine("serialrx_provider", "%d", rxConfig()->serialrx_provider); break;;
+        case 78: blackboxPrintfHeaderLine("use_unsynced_pwm", "%d", motorConfig()->dev.useUnsyncedPwm); break;;
+        case 79: blackboxPrintfHeaderLine("motor_pwm_protocol", "%d", motorConfig()->dev.motorPwmProtocol); break;;
+        case 80: blackboxPrintfHeaderLine("motor_pwm_rate", "%d", motorConfig()->dev.motorPwmRate); break;;
+        case 81: blackboxPrintfHeaderLine("dshot_idle_value", "%d", motorConfig()->digitalIdleOffsetValue); break;;
+        case 82: blackboxPrintfHeaderLine("debug_mode", "%d", debugMode); break;;
+        case 83: blackboxPrintfHeaderLine("features", "%d", featureConfig()->enabledFeatures); break;;
+
+
+        case 84: blackboxPrintfHeaderLine("rc_smoothing_type", "%d", rcSmoothingData->inputFilterType); break;;
+        case 85: blackboxPrintfHeaderLine("rc_smoothing_debug_axis", "%d", rcSmoothingData->debugAxis); break;;
+        case 86: blackboxPrintfHeaderLine("rc_smoothing_cutoffs", "%d, %d", rcSmoothingData->inputCutoffSetting, rcSmoothingData->derivativeCutoffSetting); break;
+                                                                                                                     ;
+        case 87: blackboxPrintfHeaderLine("rc_smoothing_auto_factor", "%d", rcSmoothingData->autoSmoothnessFactor); break;;
+        case 88: blackboxPrintfHeaderLine("rc_smoothing_filter_type", "%d, %d", rcSmoothingData->inputFilterType, rcSmoothingData->derivativeFilterType); break;
+                                                                                                                  ;
+        case 89: blackboxPrintfHeaderLine("rc_smoothing_active_cutoffs", "%d, %d", rcSmoothingData->inputCutoffFrequency, rcSmoothingData->derivativeCutoffFrequency); break;
+                                                                                                                       ;
+        case 90: blackboxPrintfHeaderLine("rc_smoothing_rx_average", "%d", rcSmoothingData->averageFrameTimeUs); break;;
+
+
+
+        default:
+            return 
+# 1483 "./src/main/blackbox/blackbox.c" 3 4
+                  1
+# 1483 "./src/main/blackbox/blackbox.c"
+                      ;
+    }
+
+    xmitState.headerIndex++;
+    return 
+# 1487 "./src/main/blackbox/blackbox.c" 3 4
+          0
+# 1487 "./src/main/blackbox/blackbox.c"
+               ;
+}
+
+
+
+
+
+void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
+{
+
+    if (!(blackboxState == BLACKBOX_STATE_RUNNING || blackboxState == BLACKBOX_STATE_PAUSED)) {
+        return;
+    }
+
+
+    blackboxWrite('E');
+    blackboxWrite(event);
+
+
+    switch (event) {
+    case FLIGHT_LOG_EVENT_SYNC_BEEP:
+        blackboxWriteUnsignedVB(data->syncBeep.time);
+        break;
+    case FLIGHT_LOG_EVENT_FLIGHTMODE:
+        blackboxWriteUnsignedVB(data->flightMode.flags);
+        blackboxWriteUnsignedVB(data->flightMode.lastFlags);
+        break;
+    case FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT:
+        if (data->inflightAdjustment.floatFlag) {
+            blackboxWrite(data->inflightAdjustment.adjustmentFunction + 128);
+            blackboxWriteFloat(data->inflightAdjustment.newFloatValue);
+        } else {
+            blackboxWrite(data->inflightAdjustment.adjustmentFunction);
+            blackboxWriteSignedVB(data->inflightAdjustment.newValue);
+        }
+        break;
+    case FLIGHT_LOG_EVENT_LOGGING_RESUME:
+        blackboxWriteUnsignedVB(data->loggingResume.logIteration);
+        blackboxWriteUnsignedVB(data->loggingResume.currentTime);
+        break;
+    case FLIGHT_LOG_EVENT_LOG_END:
+        blackboxWriteString("End of log");
+        blackboxWrite(0);
+        break;
+    }
+}
+
+
+static void blackboxCheckAndLogArmingBeep(void)
+{
+
+    if (getArmingBeepTimeMicros() != blackboxLastArmingBeep) {
+        blackboxLastArmingBeep = getArmingBeepTimeMicros();
+        flightLogEvent_syncBeep_t eventData;
+        eventData.time = blackboxLastArmingBeep;
+        blackboxLogEvent(FLIGHT_LOG_EVENT_SYNC_BEEP, (flightLogEventData_t *)&eventData);
+    }
+}
+
+
+static void blackboxCheckAndLogFlightMode(void)
+{
+
+    if (memcmp(&rcModeActivationMask, &blackboxLastFlightModeFlags, sizeof(blackboxLastFlightModeFlags))) {
+        flightLogEvent_flightMode_t eventData;
+        eventData.lastFlags = blackboxLastFlightModeFlags;
+        memcpy(&blackboxLastFlightModeFlags, &rcModeActivationMask, sizeof(blackboxLastFlightModeFlags));
+        memcpy(&eventData.flags, &rcModeActivationMask, sizeof(eventData.flags));
+        blackboxLogEvent(FLIGHT_LOG_EVENT_FLIGHTMODE, (flightLogEventData_t *)&eventData);
+    }
+}
+
+static 
+# 1559 "./src/main/blackbox/blackbox.c" 3 4
+                  _Bool 
+# 1559 "./src/main/blackbox/blackbox.c"
+                       blackboxShouldLogPFrame(void)
+{
+    return blackboxPFrameIndex == 0 && blackboxConfig()->p_ratio != 0;
+}
+
+static 
+# 1564 "./src/main/blackbox/blackbox.c" 3 4
+                  _Bool 
+# 1564 "./src/main/blackbox/blackbox.c"
+                       blackboxShouldLogIFrame(void)
+{
+    return blackboxLoopIndex == 0;
+}
+# 1577 "./src/main/blackbox/blackbox.c"
+static 
+# 1577 "./src/main/blackbox/blackbox.c" 3 4
+                  _Bool 
+# 1577 "./src/main/blackbox/blackbox.c"
+                       blackboxShouldLogGpsHomeFrame(void)
+{
+    if (GPS_home[0] != gpsHistory.GPS_home[0] || GPS_home[1] != gpsHistory.GPS_home[1]
+        || (blackboxPFrameIndex == blackboxIInterval / 2 && blackboxIFrameIndex % 128 == 0)) {
+        return 
+# 1581 "./src/main/blackbox/blackbox.c" 3 4
+              1
+# 1581 "./src/main/blackbox/blackbox.c"
+                  ;
+    }
+    return 
+# 1583 "./src/main/blackbox/blackbox.c" 3 4
+          0
+# 1583 "./src/main/blackbox/blackbox.c"
+               ;
+}
+
+
+
+static void blackboxAdvanceIterationTimers(void)
+{
+    ++blackboxSlowFrameIterationTimer;
+    ++blackboxIteration;
+
+    if (++blackboxLoopIndex >= blackboxIInterval) {
+        blackboxLoopIndex = 0;
+        blackboxIFrameIndex++;
+        blackboxPFrameIndex = 0;
+    } else if (++blackboxPFrameIndex >= blackboxPInterval) {
+        blackboxPFrameIndex = 0;
+    }
+}
+
+
+
+
+
+
+static 
+# 1607 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1607 "./src/main/blackbox/blackbox.c"
+           blackboxIsPausedBySwitch(void)
+{
+    return blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode;
+}
+
+static 
+# 1612 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1612 "./src/main/blackbox/blackbox.c"
+           blackboxShouldResume(void)
+{
+    if (blackboxConfig()->mode == BLACKBOX_MODE_STREAM) {
+        return !blackboxIsPausedBySwitch() && blackboxDeviceStreamHasRoom(blackboxIterationMaxBytes);
+    }
+    return IS_RC_MODE_ACTIVE(BOXBLACKBOX);
+}
+
+
+static void blackboxLogIteration(timeUs_t currentTimeUs)
+{
+
+    if (blackboxShouldLogIFrame()) {
+
+
+
+
+        if (blackboxIsOnlyLoggingIntraframes()) {
+            writeSlowFrameIfNeeded();
+        }
+
+        loadMainState(currentTimeUs);
+        writeIntraframe();
+    } else {
+        blackboxCheckAndLogArmingBeep();
+        blackboxCheckAndLogFlightMode();
+
+        if (blackboxShouldLogPFrame()) {
+
+
+
+
+            writeSlowFrameIfNeeded();
+
+            loadMainState(currentTimeUs);
+            writeInterframe();
+        }
+
+        if (featureIsEnabled(FEATURE_GPS)) {
+            if (blackboxShouldLogGpsHomeFrame()) {
+                writeGPSHomeFrame();
+                writeGPSFrame(currentTimeUs);
+            } else if (gpsSol.numSat != gpsHistory.GPS_numSat
+                    || gpsSol.llh.lat != gpsHistory.GPS_coord[0]
+                    || gpsSol.llh.lon != gpsHistory.GPS_coord[1]) {
+
+                writeGPSFrame(currentTimeUs);
+            }
+        }
+
+    }
+
+
+    blackboxDeviceFlush();
+}
+
+
+
+
+void blackboxUpdate(timeUs_t currentTimeUs)
+{
+    switch (blackboxState) {
+    case BLACKBOX_STATE_STOPPED:
+        if ((armingFlags & (ARMED))) {
+            blackboxOpen();
+            blackboxStart();
+        }
+
+        if (IS_RC_MODE_ACTIVE(BOXBLACKBOXERASE)) {
+            blackboxSetState(BLACKBOX_STATE_START_ERASE);
+        }
+
+        break;
+    case BLACKBOX_STATE_PREPARE_LOG_FILE:
+        if (blackboxDeviceBeginLog()) {
+            blackboxSetState(BLACKBOX_STATE_SEND_HEADER);
+        }
+        break;
+    case BLACKBOX_STATE_SEND_HEADER:
+        blackboxReplenishHeaderBudget();
+
+
+
+
+
+
+        if (millis() > xmitState.u.startTime + 100) {
+            if (blackboxDeviceReserveBufferSpace(64) == BLACKBOX_RESERVE_SUCCESS) {
+                for (int i = 0; i < 64 && blackboxHeader[xmitState.headerIndex] != '\0'; i++, xmitState.headerIndex++) {
+                    blackboxWrite(blackboxHeader[xmitState.headerIndex]);
+                    blackboxHeaderBudget--;
+                }
+                if (blackboxHeader[xmitState.headerIndex] == '\0') {
+                    blackboxSetState(BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER);
+                }
+            }
+        }
+        break;
+    case BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER:
+        blackboxReplenishHeaderBudget();
+
+        if (!sendFieldDefinition('I', 'P', blackboxMainFields, blackboxMainFields + 1, (sizeof(blackboxMainFields) / sizeof((blackboxMainFields)[0])),
+                &blackboxMainFields[0].condition, &blackboxMainFields[1].condition)) {
+
+            if (featureIsEnabled(FEATURE_GPS)) {
+                blackboxSetState(BLACKBOX_STATE_SEND_GPS_H_HEADER);
+            } else
+
+                blackboxSetState(BLACKBOX_STATE_SEND_SLOW_HEADER);
+        }
+        break;
+
+    case BLACKBOX_STATE_SEND_GPS_H_HEADER:
+        blackboxReplenishHeaderBudget();
+
+        if (!sendFieldDefinition('H', 0, blackboxGpsHFields, blackboxGpsHFields + 1, (sizeof(blackboxGpsHFields) / sizeof((blackboxGpsHFields)[0])),
+                
+# 1728 "./src/main/blackbox/blackbox.c" 3 4
+               ((void *)0)
+# 1728 "./src/main/blackbox/blackbox.c"
+                   , 
+# 1728 "./src/main/blackbox/blackbox.c" 3 4
+                     ((void *)0)
+# 1728 "./src/main/blackbox/blackbox.c"
+                         )) {
+            blackboxSetState(BLACKBOX_STATE_SEND_GPS_G_HEADER);
+        }
+        break;
+    case BLACKBOX_STATE_SEND_GPS_G_HEADER:
+        blackboxReplenishHeaderBudget();
+
+        if (!sendFieldDefinition('G', 0, blackboxGpsGFields, blackboxGpsGFields + 1, (sizeof(blackboxGpsGFields) / sizeof((blackboxGpsGFields)[0])),
+                &blackboxGpsGFields[0].condition, &blackboxGpsGFields[1].condition)) {
+            blackboxSetState(BLACKBOX_STATE_SEND_SLOW_HEADER);
+        }
+        break;
+
+    case BLACKBOX_STATE_SEND_SLOW_HEADER:
+        blackboxReplenishHeaderBudget();
+
+        if (!sendFieldDefinition('S', 0, blackboxSlowFields, blackboxSlowFields + 1, (sizeof(blackboxSlowFields) / sizeof((blackboxSlowFields)[0])),
+                
+# 1745 "./src/main/blackbox/blackbox.c" 3 4
+               ((void *)0)
+# 1745 "./src/main/blackbox/blackbox.c"
+                   , 
+# 1745 "./src/main/blackbox/blackbox.c" 3 4
+                     ((void *)0)
+# 1745 "./src/main/blackbox/blackbox.c"
+                         )) {
+            blackboxSetState(BLACKBOX_STATE_SEND_SYSINFO);
+        }
+        break;
+    case BLACKBOX_STATE_SEND_SYSINFO:
+        blackboxReplenishHeaderBudget();
+
+
+
+        if (blackboxWriteSysinfo()) {
+
+
+
+
+
+            if (blackboxDeviceFlushForce()) {
+                blackboxSetState(BLACKBOX_STATE_RUNNING);
+            }
+        }
+        break;
+    case BLACKBOX_STATE_PAUSED:
+
+        if (blackboxShouldResume() && blackboxShouldLogIFrame()) {
+
+            flightLogEvent_loggingResume_t resume;
+
+            resume.logIteration = blackboxIteration;
+            resume.currentTime = currentTimeUs;
+
+            blackboxLogEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
+            blackboxSetState(BLACKBOX_STATE_RUNNING);
+
+            blackboxLogIteration(currentTimeUs);
+        }
+
+        blackboxAdvanceIterationTimers();
+        break;
+    case BLACKBOX_STATE_RUNNING:
+
+
+        if (blackboxIsPausedBySwitch()) {
+            blackboxSetState(BLACKBOX_STATE_PAUSED);
+        } else if (blackboxConfig()->mode == BLACKBOX_MODE_STREAM && !blackboxDeviceStreamHasRoom(blackboxIterationMaxBytes)) {
+
+            blackboxSetState(BLACKBOX_STATE_PAUSED);
+        } else {
+            blackboxLogIteration(currentTimeUs);
+        }
+        blackboxAdvanceIterationTimers();
+        break;
+    case BLACKBOX_STATE_SHUTTING_DOWN:
+
+
+
+
+
+
+
+        if (blackboxDeviceEndLog(blackboxLoggedAnyFrames) && (millis() > xmitState.u.startTime + 200 || blackboxDeviceFlushForce())) {
+            blackboxDeviceClose();
+            blackboxSetState(BLACKBOX_STATE_STOPPED);
+        }
+        break;
+
+    case BLACKBOX_STATE_START_ERASE:
+        blackboxEraseAll();
+        blackboxSetState(BLACKBOX_STATE_ERASING);
+        beeper(BEEPER_BLACKBOX_ERASE);
+        break;
+    case BLACKBOX_STATE_ERASING:
+        if (isBlackboxErased()) {
+
+            blackboxSetState(BLACKBOX_STATE_ERASED);
+            beeper(BEEPER_BLACKBOX_ERASE);
+        }
+        break;
+    case BLACKBOX_STATE_ERASED:
+        if (!IS_RC_MODE_ACTIVE(BOXBLACKBOXERASE)) {
+            blackboxSetState(BLACKBOX_STATE_STOPPED);
+        }
+    break;
+
+    default:
+        break;
+    }
+
+
+    if (isBlackboxDeviceFull()) {
+
+        if (blackboxState != BLACKBOX_STATE_ERASING
+            && blackboxState != BLACKBOX_STATE_START_ERASE
+            && blackboxState != BLACKBOX_STATE_ERASED)
+
+        {
+            blackboxSetState(BLACKBOX_STATE_STOPPED);
+
+            if (startedLoggingInTestMode) {
+                startedLoggingInTestMode = 
+# 1842 "./src/main/blackbox/blackbox.c" 3 4
+                                          0
+# 1842 "./src/main/blackbox/blackbox.c"
+                                               ;
+            }
+        }
+    } else {
+        switch (blackboxConfig()->mode) {
+        case BLACKBOX_MODE_MOTOR_TEST:
+
+            if (inMotorTestMode()) {
+                if (blackboxState==BLACKBOX_STATE_STOPPED) {
+                    startInTestMode();
+                }
+            } else {
+                if (blackboxState!=BLACKBOX_STATE_STOPPED) {
+                    stopInTestMode();
+                }
+            }
+
+            break;
+        case BLACKBOX_MODE_ALWAYS_ON:
+            if (blackboxState==BLACKBOX_STATE_STOPPED) {
+                startInTestMode();
+            }
+
+            break;
+        case BLACKBOX_MODE_STREAM:
+            if (blackboxDeviceStreamRestartRequested()) {
+
+                stopInTestMode();
+            } else if (blackboxState==BLACKBOX_STATE_STOPPED) {
+                startInTestMode();
+            }
+
+            break;
+        case BLACKBOX_MODE_NORMAL:
+        default:
+
+            break;
+        }
+    }
+}
+
+int blackboxCalculatePDenom(int rateNum, int rateDenom)
+{
+    return blackboxIInterval * rateNum / rateDenom;
+}
+
+uint8_t blackboxGetRateDenom(void)
+{
+    return blackboxPInterval;
+
+}
+
+
+
+
+void blackboxInit(void)
+{
+    blackboxResetIterationTimers();
+
+
+
+
+    if (targetPidLooptime == 31) {
+        blackboxIInterval = 1024;
+    } else if (targetPidLooptime == 63) {
+        blackboxIInterval = 512;
+    } else {
+        blackboxIInterval = (uint16_t)(32 * 1000 / targetPidLooptime);
+    }
+
+
+    if (blackboxConfig()->p_ratio == 0) {
+        blackboxPInterval = 0;
+    } else if (blackboxConfig()->p_ratio > blackboxIInterval && blackboxIInterval >= 32) {
+        blackboxPInterval = 1;
+    } else {
+        blackboxPInterval = blackboxIInterval / blackboxConfig()->p_ratio;
+    }
+    if (blackboxConfig()->device) {
+        blackboxSetState(BLACKBOX_STATE_STOPPED);
+    } else {
+        blackboxSetState(BLACKBOX_STATE_DISABLED);
+    }
+    blackboxSInterval = blackboxIInterval * 256;
+}
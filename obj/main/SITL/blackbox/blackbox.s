@@ -0,0 +1,4208 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\240\t\375\""
+	.string	"\246\252\234Bp\252Mk\341\314\2332@\312"
+	.string	"Qee\2732!\370\211m\200\3648oP\330\311y\324\251>\241q1\331\257\252\252B$k\343\361\304#\002\002`\332>\001\274\216\243)\304\267a\243$I\233l\231\266\f\210"
+	.string	"s"
+	.string	"\222"
+	.ascii	"\033\221p\272\332\310\230\226\224\350t\336\367R\007\306\013\223"
+	.ascii	"%I\273:hU\356\364J2\243\026\036$\213\204\270e\210\227\353\262"
+	.ascii	"\345k\320Q\311'\215\313httd\264\323M\213\276;\33534BZv\272\242"
+	.ascii	"\363\322,t\3442\345\274Oo\235N\364=\267\265\333\203\272'kaIr"
+	.ascii	"\344y\331d9\026-\016g~\3734\275\302|\3611oV\r -ie\275[F=`\345"
+	.ascii	"\345\365\372tr\272\216H\214\024;]4\213\336\257S\323:5\204\373"
+	.ascii	"\324\017v\260\375~kT\203\357\f\276/\370\256\340\236\240\026@"
+	.ascii	"\360\255\265\326Z\353\201\r|/\360\235\300v\300e\255\002\276R"
+	.ascii	"Q\327\340\301\246\003|\201?v!5{\312D\005\357R\023#\002\241|\333"
+	.ascii	"\337\367\337P\277\247\237\250\323M\373\266\373\006p\0259D\016"
+	.ascii	"\021\316\317n\315[\240\2651\306\247\373\345]_\232\351\245\225"
+	.ascii	"N\372\336\2737\3227\177\232\364)\2428a\242\304\360a\035>\224"
+	.ascii	"\312a)K\023Fb\204\322\307\261/E\0217b\236\242\221\020 \354\326"
+	.ascii	"\264\207\300\204H\371`\265\325\302\205\302j5\025NQ\220iD\316"
+	.ascii	"\314<h\270\3140\255\032\210\341"
+	.string	"\202\005\251\201\004*\f\254\252B\314\234\374\311\352@A\202e[\203R\205\003\326\025\325T\347T\323;\205\355\275\"'n\214O6\234O\370>\341JX\207\333\352\021%L\250!C\325\371Y\322Z\236\233\346*\344\332\034\1774\301\320 A\204#\004\364n\031\365\200\3610\275\322\004a\333Q\305\366h\t\322A\247\003L3\307\262c\016\362\320\025\25778>\327p\375P\273Q\032\275\f1b\343\314\312\332v\230\203\217\004\262\243\022\210\310U\3034$\247\330F\303\236\2311\323\232\201;\30366G\206\2178d\312\304\370\332\001\323\305\006\306\360a\211\233\"\226'\310\013^oW\246\244\315 \027Xcamu\344\021@dEZ\\}\365\325v]\333\0275:,6\334\333\221I\242ve\005\357K\242\371!ZQq\245\023\006M\237\024\303\2075\201\007\250\26191#C\222$)T\2061\001\005N2\307\330\361\022"
+	.ascii	"\364)\234(\021\232\231\231$)HA}\262q#\200\036b\244\305\343\372"
+	.ascii	"\251\342'g\222\007U\356\262\252G\007\350\367cG\255\225\t\306"
+	.ascii	"\034\314\333~\375\305\323\016\016\364$\033B\\D\0316DO\377\204"
+	.ascii	"\235\206\3371\337\017\232\214G\330\240\254\"$\027P-\222]s\320"
+	.ascii	"\365\254q\320'\327\256/\273\324\333\275\022Y\346\322b\0175\227"
+	.ascii	"\321\257\303H=I\304\257\357j\002\221\277T4\222\350\226\374\366"
+	.ascii	"\301\2317\247\320\347oP5\277\310\320\343J\266\250\325_\261\001"
+	.ascii	"\223\223?\204i%\177\233\005\223\271\357\230\262<VT\263\3318\023"
+	.ascii	"U$=c\232\321\220L-R|\350%kS\003\226\033\211\363\2106{\033=>\355"
+	.ascii	"\036\314^\266\240W\240\276\030\345Y\035\n\331Y\227\236kL\225"
+	.ascii	"\317\0219\312V\206E\2744M7\033\222\246X\217\376\001]\327$\260"
+	.ascii	"\373XxGm]\204\245\252\312\240\t9Y\013\206\n\270B\350*\03121\255"
+	.ascii	"\364\351\317\324\260\023\224\246%\\\016a\316s\032\017$\336f\327"
+	.ascii	"\002wy\\(;\375\253&s]\247eb\200\203\021\202\360\223\3776\032"
+	.ascii	"\323Nn\366o\021Hc<\206\017\035\tJ\216\334#\2057gf\002\327|m\320"
+	.ascii	"\033m\203\255\255\317zg\375\307\237\333Q\304{wT[\034:\363\211"
+	.ascii	"\301\266?\211-\006\371\226\r\343\227\027Ln\222\323\306\366\255"
+	.ascii	"\005\030F\020\315km\361\274\272+\231\321\b=a\336\271\177\325"
+	.ascii	"\220k\277`\253Y\217\255;g\350\212\276\271\351\001W\362\354/a"
+	.ascii	"\025\366\324o\271\002&\206\3140W\264!\345\221\265\332\354\021"
+	.ascii	"\324l\325\227\2233\376\177\f\3600n\374\366\322\20122F\032\336"
+	.ascii	"f\021\375#*G\364\025\363`\342M%\275\353\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`s\002\345\007"
+	.ascii	"bG\027\0350U\322\001\303C=m\022\021I\302E\035\23750\260\341\313"
+	.ascii	"p\216i\r\001Dn\231\002sQ\017u\020\377P\277H\307\266`z\252\016"
+	.ascii	"\347\364\215\346\f\346\302\227\345+\224\211$\302!\017Gc\306\342"
+	.ascii	"\251H\374\207\033\335\254t\3076C\341&|\037\004\276\0038)>\221"
+	.ascii	"\344\177\254\217\270UQ\250\340t[Hc\220\002*\262\332\006\022 "
+	.ascii	"\366@\243I\206f\202\231\200\266\374\254Y\357\027r\340\314\021"
+	.ascii	"\245&A\327\222\323\322\003\246+\211\221H\210`\226`vM\005\313"
+	.ascii	"\352X\324\307\242\\D\266T\347\316\234\223@\0306\203F\270x\272"
+	.ascii	"aIF\034\372\222j@E\320\216\201 y\222jT\036O\371\2179n4O\304\234"
+	.ascii	"\217>LbG)l\234\001\235Z\027\0359\350t-\337\357j\271\274g`AL\345"
+	.ascii	"\220\314\243\020\230\205 \267pD\216\"[P\n\263*\b\304s\223\326"
+	.ascii	"\305&\310\241"
+	.text
+	.section	.gnu.lto_.inline.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\246\022\375."
+	.string	"&u\272J\220\330Q:\300\023r\376<\027q\347\025A\240\027F@\2046\034~\222\017N\034\316\342|\337\244\323]JKV/\022\001@\242\037S\271\177V"
+	.string	")\332\270P\354\236\225\002D\300*\354eSt\344\337\306X\377G\2244\262\245L\001\240"
+	.string	"\237"
+	.string	"\253"
+	.string	"\"\376\333\344p\267\364\257\001`\253\321fD\377\321\020\377w\213\300N\036\036\361"
+	.string	"__=\322#\t\323\257\216\363^\325jB*I\203\230(\306\251\004\3566\300\272e\265\205\\!\260>\261\332B\276\370\232\337V\371H\354HL\253\234\234XAs\333\037\304Q\260\024\311R TeHA9!\370\354\337\tkl\373qVw\327\034\375N\270\377\326\370\3779\272B\325\013\311H\245\303\373\237\002\357\371\013\242\312\270BR\271\371\311\347\036ww\237?P\255r$&u\370_\037\363P\032\307r\277\201\343\230\002\247\221\355N\370\3778\254\204VR\032\304FJJK\314\236\371\332\274\3770\037y\025\237\250l\212\231W\340]\331\377\034\336\223\377[\340\315\332\034&\021\341\314a\"Y\321\225\263\002\023\355\214G\262\252\312\305>"
+	.ascii	"\004\033\201\242\344\230\033\252QF\034M\351s~\023\325\231\275"
+	.ascii	"\323m\2427\321\036~\372\324\207\231\314\030\262\240}\373\313"
+	.ascii	"}n\237)Z\332G;m^\355*~}\235\327\365u\315c!GI*\363;\375\235\366"
+	.ascii	"\341\026]\3051\332\323\356\005.\316\277\250\273\203?\017/\026"
+	.ascii	"\325\3620pjy8\304.H\200\244\367 {\007$C\25208U`\312\344\355\034"
+	.ascii	"6\270#l\006\227\004\254|\022E\005\202o\250:]\335ms\r4\302\356"
+	.ascii	"\246=C\220\211\024\224\215\\\215\"b\251\302\035\303\257T\032"
+	.ascii	"\271l\222\277("
+	.string	"\215^6\207\202\013;\304)\240 \031W\t\310FZ\256\220\007\373\204\277\336\260\350\016\342\240\022~\337\255Buw\316\006\341\265\246\356\236iuw\372\007\377wB\336\244.K\305\035\016U\025a:\220\026\305\035\2343\273\337\363^v\232\1775\177\352rYfy\376\276Z\003\314\351\206\354\213\377\372\253`\222\214\262\316\027\007\b<\257c\310\250\033\020\220|\300hR\340!z\025xN\r}gf1\216\303!5x,\t\004k\f\343@\205\310\234?\312^4\244\206\264\377\202L\234g\342z\362J\357\023;\022\223\267 J\343\230\355@=\023\210\273w)\335=\363\237 \n\035VK\rr$\255,-\370\207\277\376f\205\323\016\0337\250\317\212\361\"\322\344\366\364\003\313\007\316\344m\212\352L6\317f\317\036=\372\241vF\317(O)K\317\251\356\254;\353x\314\365\304\325\304@<\325\335\002\226[j\274\313\0014"
+	.ascii	"\246\234;&\372\371\372c0\313\345\030\006"
+	.string	"\357\371q$fI\003\201_\250\221522C3\222\224$\205t\301\204\214A\306 <\017\022`\022\221\b\2069\305\030!\310(#\"\"\221\210\004))H\n\222\341\016\212>\006\204\224\255\330\324]U\360YZ)mm\345\001\205|\310\006\025\025\204\340\342g\t\266\314\007\265\b\235\322\033\275\345\274\317Gnc\221\315\240Tj\373\246\034\nX!\\\006\200\277\002\312\212\0174\313\353\350Pl\r\274D\340\022\007Vr\233\235n\320\236\342P\375\3258\261Y\331\276\321^\264\2241\305\332\231\243\243\300\\\177\234\371@\b\246D\3379z%\312\226\262\032\332R\373\006\216e\022\216O\225\317\036\243\"]\001\303wY\013\"\250J\215D\241dWT\317\030=\214\237\321s$\3010\324{\243\206\271:\324\262\005;\307-\312nEzU\0029j\033(\203\262\245d\264\206>\251\t\354\237\211\207p\223T\315K\315\355\3320\301"
+	.string	"\270\237O\033R\224\361 &\364\t\2318\306\341\013\211\003L"
+	.string	"\360\345\360\277/\374\217\274\212\272s\273L\226\357\230Q\342~\023\256\312!\331?\257P5\233)\220\377"
+	.string	"\004\\\217\360\213\206\217\343\036[\016\027\344\272/\270c\372\331\374\005\203\342"
+	.ascii	"{\304\334\222\230\207z:0\027X\364\354>\220\024\3477P>\355'A\036"
+	.ascii	"\016\375\202\254\236.\022\310\375Z\212\305vRi$\275UW\257\024"
+	.ascii	"\235\302\3668\211\275\221\343~\327\370\372L\007\024\250\344\276"
+	.ascii	"\264p$\306K\321\024y\270M\372\274\026\367\330\240\342\311$\""
+	.ascii	"\371ow'\375\320\331;3\016n\2539F%\024*N)\023\037O\237\332\314"
+	.ascii	"J{\343\313f\3221\354\254Hv\332\317_\261\330\311=[\002\\\376\274"
+	.ascii	"\341r\275l\357Z<\317\024|\251\360\333d(\213\035.\312\222\226"
+	.ascii	"\210\352O\313\233\245\334\032\213\250\313tXY4Y+\023\306\223e"
+	.ascii	"u\027\336\311\237BB\030\004U\037\271\277\343\3469X\013P\023\240"
+	.ascii	"\261Z\302F\327\337&:\024\330Z\207\t!(\034QxpW8D\376\365\351T"
+	.ascii	"\016\"\003\005\254\003\034z\314\232TI\307Z`\013\034\b\235sL\006"
+	.ascii	"8\013&\227\013\233\354/\313\341\337>\206\374\027G\315I6{!\210"
+	.ascii	"*\227\257\347k0g\357\016\3747y\036E\304\327\3728D\235\202\305"
+	.ascii	"\032\236\335\214\225g\305&\003:g[U6\263[=d\251\256\211W\253&"
+	.ascii	"\306\314/\334\230\307\345\255i/\216\244\004\247b\004d\0036^\272"
+	.ascii	"\212\332)]$\202\310\033:\005\350o'F#p\341\210\005\315\016\230"
+	.ascii	"i-\272\323*\306T[M\332A\254=vk\005\025mlM\031b\202\220\t\334"
+	.ascii	"\371\356\371\254\225X\316\223\025x\005\217\330\016c\037]f\373"
+	.ascii	"\233\320V:V\001\n\210\021f.\347\260\021#\273\nK\302-\256\376"
+	.ascii	"\235\3504\214\251\334\212\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\b/\235Z"
+	.ascii	"jl\024\027>p\3566\007QX"
+	.string	"*\327f\361dW,\353\256\205\032\237\256!\357\262=T\276\341\366\361\333hTM\224\033\262f\262\266\330k\372bKc\013\274|#\355\211\375\013#\262\261\266-\275mK\231Re\001f\001]\001@0A\0221,7\0221,#\022q\230\007\211\030\346\337\346=\271M\376\222\243\344\037\217\\\205\364\270\326\270\270\270\244\270\212\\Z\024\362\t\325\204]B'b2\333\322$\3420R\353\220\210a\255>c2\333\242c\246\225\2455\245u\004\223\210C\220\021\231\314\202\201\2622\013\302\021q\006\303\200SD\034\202F\312d\026\f\202!\375\360\"Ag2\213\357\244\311,V\263&\263\030\013^R\251P\233\314^8W\314\245\362&\263w\310[\302m\234\314\376\2429\231}Bu2\373}\354d\366\331<\226\177<\231}$\337\252\"\016\235\332VOfk\2108;n[>\231u!\342>\231\305 \342\374'\263\t\034"
+	.string	"\312lL\304\241\224\007\372\335\337\363\257\347\003e\266\365\355\357\337'(\274\357\277\013\302q\037\241\314\276\210\301\227z\030l\301\375-\270\277\023*R\334\337\257}\027\203\002\r\026\344\f\202\357+t\357\373\n\205\367\2420\340\376\3739?\300\261\036\353}\206\234\242\242\336\207\310ev\354|\353$e\017\243,FYR\370<\204\020\277S\333\276\233\3776\017!\364\207\020\336\307m\313\342\376\360\377\313\375\316\035\367\214\333\266\007\226\217\367@\341\375\337\203p\374A8\357~O\334\337\211\373s\372\277\241\273?\360\320\204{\204\254-\354\242\362c|D@$>#\341\027\261\262\363r\260\230\277\"\302\353\255V"
+	.string	"\374\005\203\361)\001\233\370\226\204\001\336\035\205\337\302:z\027c'\177g\264\027\367\1776\373=\346\362$\274\267@\201\322\375\367\003\301\020\367W\334\207\375\337\234\273\343\334w\027J\333\372\315}\273\223\356n\243\003^gq\301\373?\005\202\352\305\351\305!\003\006\332\247H\307u#\342\277m\235:!\256\257\030\377}U\302\3539\334\035\307\rw\001\002\334_\302\357.\rw\237\341.\303_\340(\177o\006\363\375e\320\345z:t\362\344\361\343G\302\240A\240\213\t/\201\205\211{\275Px\253\320\213I"
+	.string	"\002\024\347{\334\020\356\256\301\003\036<\027tj7\265-\026\326\305J\332\326\333\366\177\027O\370_\363\257\346\357\377&a\271\232\224\245\303\205\003\347=\220\214\214\210\257\2108\2742*2%2\254\230#\021\313\334\1777\306(&H\304\331\007\306\346\2108\254\200\261|X\374\303\270O\213\217\313\375\"\337\302\2617Y\\bTbLbB\372<\226\373\r\202\205\365\303\301\275\260H\214D\034\302\b\341\026\366\007VG\304\341\032\330\027\330\026X\225\337\303\222\2108\303\202\274$\275\022\t\3423\347\225%\342\360\345\305\212\210a/)\270\365\222\331\327\0210\231}\005\233\034\251\264\025"
+	.string	"\207\npZ\221\243\200\250\013\252\252wT\250\371\344<r3'kRd-\364\234mEO(\347\221\033o;3f\263i"
+	.ascii	"h\252\247f\276SME\246:7\342\264\016\200\353R=\256jZ\336\306\023"
+	.ascii	"\035Mm\033\321\324\nG\300\237\334\324=\325\334\347\251s\266\361"
+	.ascii	"D\313U\233\350.\335\353Y\216\266\024\201os]\3214\267\216{\325"
+	.ascii	"i\251\021x\272\311\262W\225\232\272L\267\n\345\344\266\235V\352"
+	.ascii	"\311\033\267\312{r\023\265\241+\232\356\242|\257:\035uT\2731"
+	.ascii	"EWT\347\344\233g\352\336\270M\262\034W4\247\222O\276IT\027su"
+	.ascii	"\247\274U\357\333\013\312\325\262J\2178\336\324&\007x\212\256"
+	.ascii	"6}\033\321\225\247\367\316j\035\323\275\232\345\355\200\223"
+	.string	"5\232\024Ys\271z\273\241+\3176\356^\271\332\264\002\3378\235\356\236\036\253\322\021w\226\271\025Eu\352hK\r8\007\265F\263\325h\244\271\313\021\264\022N\216\203\254\331h9Y\303\356\256s7w\270o\371{\361\221\277\013\302\377\005!\2036\023fW\222\360\032\251\253LW\224*T@se\351*\323\025\246\360\307\305\270\311\337Y\231\253M>\256\332\337\0356\n\262&\310|@0\031\237\0200\203\273K\371\220\370\206\200\033>\216CM\332\r\245\221\247\210\330\251\267\tBV\201\202\005\n\030B\363\246\327\375!\026A\255A\240\315\374DK\265\354\355\024\312\325\032M\255\205\256K\313\021{\325$mM\365\252\322ph\212(Wk\330\267N\237\264\365\246S\020&b\264\0261Oi-\362Y\352dUZ'\363\252ZU\205V\314W\336n\345\261\2209\t\013.\337\246\266\251c\314\245x\265\327j\242=\323\334\266"
+	.string	"\316\253a\277\3554{\212\252\347\206\261\236;My\266\231o]\271\356P\324|\351\320s\223\243\252n\033\232\356\240\234,u9\315\255/\177\371z\226\350n\207\336\351\324\250w\253\223\253\266\364\345\350\256j\217\2664\273\032\272*3\3214\347lk\271{Qi+\227\271{\333|y\b\023-pZ\347\3620\346\333v\352\036\251\307\263\324\215\344\354i\300\005'\347\221s\"\243|\307#\317\222j\324\245{-\001\220\345n\\\365To\026\343,U\254\036H\023\315\251;\315\255\005\254\326\262\247S\334X\256\247\206\362\263\324\270\321D\323\365Dm\243:\245\237H\\\224\227\352\251\323\265\300\313\327\034\256\334T#\231j\252\024\275\221{\337\242f\016s"
+	.ascii	"N\245\255\306\265\324\225\346\250\343\251d\271{z9y\352)R\007"
+	.ascii	"\202\205\250\302\362\"\222\320\310\214\210\210$I\222\016\302"
+	.ascii	"\t\020\210f\201\234\307e\331\001\022`\022i\b\3430\f\243\024!"
+	.ascii	"\204\020D\214!\214\210H$\"#\"\201P;&\210~vp\340\030K>\225V\322"
+	.ascii	"\217\306\254\260\3149\270\004\311,\205W\346\f\022&\003DC\273"
+	.ascii	"f\013T\302\326v\363\2520P\205\202\273\024h\210R\b\274\240\352"
+	.ascii	"k\351)\032h\037\220\017\2252\225{\375p$r\024\247@\273N/`bF\221"
+	.ascii	"\263\306\027\316\245\3704\251=\353\211B\376\037\222\266\371p"
+	.ascii	"\222@\251\241q>U\025F\262\310\343\266\270x\216\361\332~}V\212"
+	.ascii	"\320x\316E\335\223%\226\352A\204d\260\275Re\304\007w\244\346"
+	.ascii	"\022\033JC\341C\002\245)?\271\252R)x\320?\221\361\356\305\211"
+	.ascii	"\314\002j\300y\323k\026Z\017C\214L/>\371\275'}|\345\215\354\375"
+	.ascii	"\244\223\256\351\n\225L\245}\366>(\033\330\310]\243\3216\237"
+	.ascii	"\344Q\275\204M\020vw+\030\3133;B\360\210\323w`LZ\026\3653\335"
+	.ascii	"\246Zh\250zdVr\272\222\035\224\033^\236\267\201&\2757\317\202"
+	.ascii	"3&D\216P\260~\211N\275D\375\233\024\224\204~\255e\337\275A\315"
+	.ascii	"\376Q\036\377\244\0174\375\333\252D\317\253B\335\322\317\215"
+	.ascii	"pYH\0138\205\330<\357!\304\363\233\356W\\'\2605Qv\227A\264'\252"
+	.ascii	"\201\r4\273\231\217\366\365\025{\332\343Iu\"\321\334\017E\317"
+	.ascii	"\360]j\0303\361\244\247\340\321\264\214\22186\231\340Fy\202\004"
+	.ascii	"g\203\350\2219\352Jp\310\255\031y#L\363o\305Y]\222\2311\020\244"
+	.ascii	"'\261\334\352\216\341j\227\377\312}\370Ic\250~\352\344`\304\""
+	.ascii	"\276\340\200;\243#S\337\315\252\223\230\3214\001\354\004\340"
+	.ascii	"df\030\333\322\255\244\323AB_\345\362t\256s\225\332XT=\251@l"
+	.ascii	"d\314U\2132D\346}"
+	.string	"\026v\361\326CY<\316\242\204\214\201\036\207\020>\206N f\021R_h\371\"K\224\363\210\344M\373\033\320/UP\354\032\245S,\207\007j\250W\320\n\3508Y\246\rm\306%\324\006*[\316X\344D\374\221z\316\321\362\341\270e\255\001\215\2242S\331/\311\243\2144\t\001\350\205\227\275\305\301M\306\n&Q!dQu\260\\wQ_\343\372\030v\034\017\271}\334\262\203\336le\227\350\300\370/-x\205\357\245\362\324I\220S3\221\322\370\027\t&P\023\206\254\224nM8\353\315\356\3135Pa\002\307\342\354\b\277~x\337\026K\225\222LH!j\363\002\344\027\243\305\305\013\323-o\0054\365\357H]\335D\316\212\342~X\313\013\306,\""
+	.string	"J\254f>\374\"\b\367}G\271a\352\223\214\272\241\234-\312\213N\237F\201,\257\325\305\034F\360\214\025\322\270\275\347\305\355Q[/\2470\023\2271j6\2141\006(9\357\214\201\215\235D\355X\033\313fF\343\330\350?\310\221\254\227\362\370\342t\235\032\236\021\302\007K)\024b\031\300\324\330:|\222uc\274\352t\224\350\235\324\263\254\227\360\022tC\246?y%*\260\330\275<\360\212\313\317\273\211!\326\363\315\274\342\347k\215\374\243q\264Ls\301\243\016\341rh\013\305\177yU\nE\244\2339\313\177\256\004,\261\211H.b\363Jq\364\227\331x\240\215\323?\234u\205\204\366\332\306d\307\n\343'\232\220\210\335\300\360\307\274\305\370\013\211\211\344m5\272\002\371\3658E\325\220\004S4\305jQe\356\231%SY\260\330Q<\200A4)N\321\212\006\025\303\222\255"
+	.string	"SY\371\007\264t\327>z\257\022\221<\264v8\270l!\226E\333Q\240&B\274\241&\332\251\252\262t\242.\\;f\334h\231\202\270\005\353\203\316\217\"\017\313\254m\275=\311b\323Z\177m\205pmF8\t\235\327\357\232\271t!\342x\321\301\334\027s\245\247k\375\211T\365\230\n\021\266u\310\214\346\214\034p\365X\223\331\007T\261&6\361\311\366\321\301\241\225gR\305\251\033\322\301\363F\224\352&\324\316\037\337\217\320\347l\257\205\376QF \262k\263\213AFC\321\337\032\r\246\353\323\376-\203\241\240\267Rh\364\327r\274q\216[ \371\316\250\036\2466\017\215\271\22281\325\324\355-\346C\350^\210\355\203\245\345\356\006\007\261\353X6\334\256]\336\024I\203"
+	.string	"$*\316,:v\310R\212\207\177\365\323\215 \235Y\n\271\201\352\b\021L\360z\367\023_\216\373\365~\375t\323\241\363\275\336\311\372\354\006\\g\260\221<\247\215\275p\370\351\372\227\204bQ\2076\251\210"
+	.string	"\353\235\310\356\303\252pq\360P\002#7`E\037\267\002+L\245x\243_\343\314\325\245\300@\003&[\024\225R\317\324\214(\262\246\203N\344\265\324\345\235H_\2043\225gJ\324\227%\302\002e\211n\244"
+	.ascii	"y\202c\321\030\0302{\260X+\341x\177}\002\346\007\343Q\352\213"
+	.ascii	"/\271\035#n\263\201\n\331\026\203,\030d\222E\363\236\223\312"
+	.ascii	"\356*\202\004m\270\022\001J\n\233\321?\320\263'om<T1\210\314"
+	.ascii	"\301G\236\023N\025\210\245BFu\226\326\"\245\302\355?R\224\347"
+	.ascii	"\022,2\345$}\267\031K\277\267W\335\341*\263Cn\004M\242\030\025"
+	.ascii	"\243\300A\004#\004"
+	.text
+	.section	.gnu.lto_.pureconst.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 w\025\003"
+	.string	"r\207\027\037`W\032\003!\bnI\016R\t\017\230\272\036Jzg;\234?\001\260J\036\255\240\237\360t\007N\262\032Y\211<\344 \377\270\307;V\034\337\270\306\3138F\273\270\305+N\361&.\361\210C\264\207\347\360\032\316\360\026\232BCx:h2h\005'\370\300\005Z\300\001\032e\265\022k\255R"
+	.text
+	.section	.gnu.lto_.ipa_modref.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\316\004\315\021"
+	.string	"\006\223A>0\251&\351\300\300\300\300\300@m8\017\313B\345\255t'\335\231\315\310n\237h}\333\3515D\004U\224e\261\373\262&\022K\325\"'\003\316O'5\227b\330J\017/m[k\335\354\226)-"
+	.string	"1"
+	.string	"4"
+	.string	"\020\277\007\224\371\320\206\2171\233)\360\271/\373K\n\363\275\027\206@\346_\225\252RV\255\246e\331\200\274\365d\257\200\234\246\230\341)\n\001\243\304\260fU\241\0301\212D\331t?\324\305/4q\006\302\t\020B\030 \306\313\211\340@N\365\373\fd\336\220\325Q\235\325Y]\307[\022\031\361\177$\207s$EB\266\255 ?}|5-=~1^8\276G\360@\020=\320\0344`\260@A&X\330\260\200_\215Q6\343\271\2715W\305]sa\267\001s\036\347u6\326\330\353l\250,\273"
+	.string	"\270\345/\264`\262\3741n\333\212J\n\312\367\344kr\347\257\004\320T\262%\311\232k\356v\016\313K\n\200\256\250\240\322\214$I\222\016\220\002\231\261\242n\021\320!\022\020\272\222$I\246\003\013\264\225!v\251\312b(4\326\235cm\204\206%\216\344\253\225K\350gI\235x\376\215\376\367\344\036\310 \037\326\021\347\f>-\373\325s\372r\214(\362\337L\371B\273\302\335.y\205\367\243\340\356s\357\371[\350\177I\3055\375\371s\304\306x\024\360\f\002\376\327\024\t<t\250"
+	.string	"\0255\304'\"\336\222\307\001k\323\200\210\210:\343\354o)\302\364.9\211o\327z\375\034\361%\314*m\005\026:\t\335\306g\253\371\210\\\234\341\207Q!%!\304d\210\013Cjo\212\247A\027\330R\365\220\313\317\3758\026%\337zAH2\322\\M\335\002\262\330r\bz\005\253%\rS0Nr\313\242\222\025\f\300b}#3\257,q5\035\336Dr\007Ay(\371X@E%V=\036\224\245\035\0171\252 T\020\333P\002\313\300\302\224!\260\307\004\346\240{\034\313\213\342\237g\307\274\021\340\037\tL\221\265\033e\341^\330\256\365\024\334\310\366\227-|%"
+	.ascii	"\322Zj\236\0011"
+	.text
+	.section	.gnu.lto_.lto.43ef1dd3fa501e1a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.94.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 \232M\004"
+	.string	"\204\007a"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\327\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\006\205 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.ascii	"\313R0\345z\230\305S\324}\003(\002"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.96.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 7\215\001"
+	.string	"d\002*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\003\005\001\006'\001 ?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"@\210\224\241\007P\004"
+	.text
+	.section	.gnu.lto_blackboxHeader.97.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.98.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\350\236\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\370\365Qy\276\004\230\365\001}\301\003\330\364\001y\304\002\005\001'C\206\bw\364\001u\307'K\206\bs\330\357\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.99.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\224\f\335&"
+	.string	"\206\373\332@@\246j\016\245Y)\f'\342\227a\310\b\210/\r*\026gm\374\0315\242\214\341\035\263\317Q\333\354e1:\331\352\007\356\200\037\360k\257=@\302|\007\227\007\260"
+	.string	"\275\251\031\031m\214\330\224\211\004\310"
+	.string	"\317"
+	.string	"\304"
+	.string	"\376\303\2038\020\365\347\340\342\371F\241m\036\250\340[\203\371\347b\013\201\216\362\323\301\027"
+	.ascii	"\377\362\323\305\030\024!\215\235\344[\224\277N\004\332\246\023"
+	.ascii	"\232Lj5^\336\261\367\364\362\333\225K\031\354\356\216]\210P\376"
+	.ascii	";\270]\003Y\240c\017\022\224\377.\366\r\177\340\216-\027\227"
+	.ascii	"\037\017~$\016e}\216\035\273\345\307C\352\300\266GO\376<\330"
+	.ascii	"\003Z\332\261\325\360\344\317\213\205IOadef\307\256s\226_\017"
+	.ascii	"\016\201\266\231d>T;\201Y5r\355$\333H\255\01636\362F\3139\366"
+	.ascii	"\230\216\035-\266\325\3055B,+%\001\337\240\004nm\275\355\325"
+	.ascii	"f\217\363u\264M\263\025\b\333<\273\004\320\017\204m\226ke\311"
+	.ascii	"\004'\036\227]0n+h\233\002\336\374\250\376(n\352\303G\365Ax\200"
+	.ascii	"\0366\325\007c\002I\244\032\036\365\311\372\013m\263\300\035"
+	.ascii	";S_\026\0330+\233z3\370\300\234\261\2517\213\235\302\326NzXr"
+	.ascii	"\352\317Z\234o{\241m\"xC\246\325`q\340\270\370\264\027\347\313"
+	.ascii	"\003m\223)\201\253a\263\006\306\247\3051\316\027\013m3\200\202"
+	.ascii	"3f\250^\r^0F\f\325\253\305\f\274\313\027/T\277&\343|k\240m*5"
+	.ascii	"h<-Y\206\337&\003m\323\201"
+	.string	"O\261j\266\265\223H\247rt+^e\306\273\245\347\013\003m\263G\323\003(\360\360\341b\bM\276\206\037\007Gh\244\222$\303\217\213\211\347\273\002mS\202\221\"\352\313\301\023|H\227\372r1\205N\374\211Gq)~\305\261\370\026\347\342`<\214\223\3612\216\306\323x\033w\343`\216t9.\346t\234\314\317\274\216\243y\232\257y\036\337\343m\356\346\261\377q8\237s@>\310\351\374\316\t9\236\347y\"W\344~!\234\2217rA\177\364>\236\353\203\374\373C\336\353\215\374\221W\002\342\277>H\t\301\326fc\362KP\270\236\212\363\3551\324\356\223<\222\031\276\327`E\210d\337\213\377\273\204d\347\203\221\220\017\344\177d\347[\363[\203\331\373ba\240\243\354~p\022\032\340_v\277\230\314\242>\276\354\177\003\\\017\321^\366\277\230\200\222\027:d({ \334e\311\256.{`\314$(PvA8"
+	.ascii	"R.%\026[t\323\226\350Je\261\354\225\200\222\270\026]\263d!e\342"
+	.ascii	"\204\261\230#\025\2264\260\322ue\243\206\255R\351b\025\331,\227"
+	.ascii	"h\004\340\246U8\226J\327Ht\323\024D5m\211Yk\332\244\246kR\351"
+	.ascii	"^\221`\333\264\304Y\026\215\306\326,\243L\220`[\035\352Y\332"
+	.ascii	"pYvu1\034\246J\245z\243\212HCX\266\254\313\256\302r\370\224\203"
+	.ascii	"\255\262\032\246WUPX\305t\205\032\266F\250\247\b%\233El\241\\"
+	.ascii	"\226m\241\226J\026GK4\n\313\236\323t\332N\337\351\265\316\323"
+	.ascii	"m\315\247\375\364[\3175\240\246\353\2726\324\207\032Q'\352\276"
+	.ascii	"\366kF\335\250\005\373\221\373p.\177]\210{9\021?\342H|\2113\361"
+	.ascii	"\200\354\250\201lE\316Z\230\362)d\031\003 #\021\241\232\016\021"
+	.ascii	"@4e\214A\n\0233U\320\302f\225\227\262N\241\376p\212\352\227z"
+	.ascii	"\346\251\300\373\\\200^C\252\025\022\031\260\303\234\327*"
+	.string	"*\325\342\002\344u\221\236\337I\350xo\300\251K\202\216\016-j\325\3249h\374}\336\254{y\003\343,\273\207\327\200V\271B,fb\274D\224g\247Q\334\210E9C\341\n\205\002\261\236\226\320\344\313\207\216\r7_\326=\337\200\363]\007\335\244\235A%\335\305\340\300\316w\245\b\340\351\276\030\003\216\266\336\355\023\233\b\252>\355\271\347!Lz\317\355\274\310\267\262\343\300\340\027\260;!A\342A\303C\204h\271\257\206s\216\207\363w\0060\3313\274r\020\226\352\204)(S\374\327\001\255X\025\263Q\3379d\370n\031\376\tv\177\306\331W\335\003\252\367~o\031\327\205\242\333\007\016o\376\206\n\376\363\020\336\260\030\216[\324\373\002!\231\203\236\\\372\257\003\261=\313U\f*\345n&\036.u\371 \b\301\244\200\306\241\243F4\025\377\220\305\355B\036V+zj\342\216\261\b`\006\3071[4\247/s\347"
+	.string	"\025\202z\347"
+	.ascii	"-\342f\264\\\336a\260R\334R\343-\022Ur\034`\313\\\n\f0\321`\224"
+	.ascii	"\0229\326Tn\221a\177\355&\267\316\226\233\220\002"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.100.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\331\277\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\375\003k\302\303\005\005\001'L\206\bi\330\374\003g\306\307\004\007\001\005\001'Z\374\003k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\367\003k\321\322\001w\320\002\005\001'e\206\be\230\367\003c\325\326\035\001\023\n\005\001'q\206\ba\330\366\003_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.101.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\310\310\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\304\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.102.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\341\311\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\315\004m\302\303\003\005\001'W\206\bk\230\315\004i\306\307\002\001\005\001'f\206\bg\230\314\004e\313\314\312r\206\bc\330\307\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.124.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 \375\265\006"
+	.string	"\222\f.4Pm\222\016$\217\250\23328k\237\005\200!\004\266o\237\003\177\336\237}\373wKC\035\025\334,\032\024\31533\213(\242\017\027,\254L\035\325\332\3266\221)W\027\t+\243Pa\0262\257A\203ax\325\365\360.\002[\016\t\327\203\260\254\353Y\264\354\210\003\037\004\335n(E\304\2068@\365\350\307\346f\034\301q\315J]\016\245T\021\200\342\343\266\327<\016-\276Sb\305\357F\347\356\024P\032\321l\231\242\355$E\250\322\306\337y\313\006\007\235\261j\030\242j\220B &\231\332\303\213bu\330mG\247\022\222\220l\344\251\253 d\346.\033Mt\354O\360\027\374\244\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.126.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\244\t\365/"
+	.string	"jR"
+	.string	"\022F`\\R\007s\253\345d!\207m\303c}\031\254\346\367\206|\263\255),#H\221\215\342\341h\314\30664\377\323h\362o$\031_\030`|I<\316\306e\271\201\241\177o\331\035\305b\225VZ\343nr\357\224R\n\016\001\375"
+	.ascii	"\020\001=\347\365:\367\336\371\246\316\252\352\234\276\363\247"
+	.ascii	"\316\376\316m\240\341\260\341\331\235h\266mTTN\353T\261\2001"
+	.ascii	"s3\263\ff 3\2733wY/\221\321f1\322b\373\224\245dk[4\006\334`m"
+	.ascii	"U\250yn\253i\357\334V\231\231\035<\220\301l\243mE\365\240\306"
+	.ascii	"\222jxm\213F\364B\232m\237\036$\317q\307\250S$\016\205A\340\317"
+	.ascii	"\267\366\256\232\276\263\334L\3553lz\365t\210\032b\207\374j\236"
+	.ascii	"/?zu\371\016\262\351\303\230\262A\235eP\235\261.\256f\242\224"
+	.ascii	"\304n\362\321\303\026\223\362\341\3020R\313THL\n\313\203@PQ\240"
+	.ascii	"\020\032\366\373A\241\361-y\305\255!\326\336\354z\353\216\276"
+	.ascii	"I5M\260\364\222c85#\345\001\223E\007\234\242\341i\237\265*EW"
+	.ascii	"W\006\rrc\254\237\310\220*\256\255+\253\036<\236~SNc7\275\303"
+	.ascii	"\361\326A\244\300\204\336+j\333\226]9u\243\031@37\0363G`^\223"
+	.ascii	"\002fMR\232\213R\343\373\027\370T-i\346\344Q\356\367\357d^\223"
+	.ascii	"G9\350\314I'\274\225\375G+,\247\3233q\253usq\342\3251\371\234"
+	.ascii	"\2410,\265/\303m\206\247\253H\373C\f\367\230c\024\227\223\033"
+	.ascii	"\f?'\340-\257v\274\364\227\216+\032\325\270\225\215\275qw!B\335"
+	.ascii	"\312\306\266ps\341g\317\211\2330\013\267\026~\336hU\220\215\373"
+	.ascii	"\np\315\032\267\225\037\273\262\205:Sd\n7\025~^\272*\337\223"
+	.ascii	"\206\322Q\370\271\366\272nh\323\324\225\215\265?\322\270\235"
+	.ascii	"\360\363\001]\307\270\2556\023f~R8\263\274j[\246^2\363\323\225"
+	.ascii	"-\202V\215\337g\375\353\342&j\331.=\217\031\315\311\237\311\334"
+	.ascii	"\037\215F\271\360kq\001v&\300\316B\354,\200\235\203\330\031\210"
+	.ascii	"\235\177\330\331\207\235"
+	.string	"{\330\031\311\316\3076\3536\372\234\213>g\242\317y\310\316\302w\016\2763\220\235\177\253\263/E\240u:\317Dk.\352\342PA\273pA\023\211\017D\374\tk\306\031\276\226\033\355\270Y\t#$\273\353\007\331\244\241y\3628H\374\211%s\247\025AR\215\254\255\271(\310.\271\275\017\372K\206U\342-\273$\257\243\354Y\005#\243\333j\357.\n5\303\322\\\004L\005\374\321\252M\263\035N\356\027\300\327\266p\231/`\360V\n\375\321\252\315\371T\245\035\356\212\357\231\032\356}\237\017ZKj\341\f\rGC\313m1s\213\276\3430\264\325\266\255\204\016\375\306\303\332\266-\0047/>\0308\323\345\342\266z\277\345\270\314\210\321h\264\256\017\\\343\253\177\327h,\271\353\332\316\005w\027\203\b\021\342}Tk\310\252\340\332\341\2208\327g\262\253\n\332\357\202\036\276\r\346\341\023\270\275gr7\022+H\226\373Z"
+	.string	"\214"
+	.ascii	"D\255\250\324>\272\377\237$m\356\311\3430\263\210\246;Z\333\366"
+	.ascii	"\t\0027\232N3\202\273\253UF2\241r\233\270\255\376\320\026:h*"
+	.ascii	"\224\222Z$\225P\241\204\344c\244\0060\224H\234@\032\201\202\004"
+	.ascii	"\221\212\244\021)\210\220\226X\0205\030\300J+L,\021\265PRZ\""
+	.ascii	"\002\2425u\332\276\026\367\334\233\270\236\343{\330\233/$\362"
+	.ascii	"}\256M\236\261\347\177QW\311\246\316\317\367\326TAi\026="
+	.string	"\252\203vv_D\240\3770\271<`\320\267\034\325O\3007\220/_>\241\0372\341\236\253\317?\031\334\262G\340\215PV\222\315/`AM\031\224\246w\263W\310\302\367w\342n\322\\\224\372<\223;\370\307\357\244\026\327\341T\032X lV\326m5\370=![\240Ud\332\343\336\234L>\247\207GA\373qA\027\213\217D\006pr\227\203\347\350\002\337\305\230~\343h\n\370\021\346\216\367\367.\226\026\300\375\367\307e\233\363)L{\\\026\347\3163Y\256\353\373\236W\333\204\270\r\226\313k\270\222%\302z\261`\336J\026\354\266\352kB\345\232\213\214C\316\314\032a\217x+\177\376\270$s:\271u\237\265\2076\001\200\302\250aD\342\240S2$\")HR)t\240\002\221!\262\316\001\021\340D\246,\2320\n\222$m\007\240\241\004rg\333\311\3241\004\236\373~Nd\263N\232>'4jZ\362e"
+	.string	"\316\321\001kQ\002\005\301f\230-\024\325\261a\362\237fCql\322$\332\\M\231\213\246H\002\370\021\025\036O\337G-\0026\036 \257\307\357`s\246\263Y\257\231P\211\323\236Y\356\274\354\330\032"
+	.ascii	"4\240&\320\t\0044\036\030\023\265\203\n\213\t\337\306\342\232"
+	.ascii	"9l\362B\340@\216\200\265\3758\324\2321\375QXQ\035\304M\020\006"
+	.ascii	"\307\037\2520C\217|\320T\362\350$z\256\262\233H\376\033\375\212"
+	.ascii	"\221\013\254#\016\030}?\227*\273\202\036\024%\366\0268\023S;"
+	.ascii	"F\266\236O,`\t\306\242\230J\327rE\210\036\305\367\022\350\301"
+	.ascii	"\354\r\263\360\3358\370\2377\356#az@T%\326\220;\217\340ID\030"
+	.ascii	"K\303\007\323\212%\033\263\247A\031u\306(~<\221\r\362\025\372"
+	.ascii	"P\274d\213\257\021z<\312m\270<\314S\324\355)JX\t\307\206\021"
+	.ascii	"\031\257S{\337\236\310\n\375\3629\254\374+\257\023{x\323i\307"
+	.ascii	"\361\3013\204G\001u~V\240\357\342\022\312\2655\304\022\r\013"
+	.ascii	"\022!\242\223,\325A:tB$\205c\002b\016\270,\261\310\264\240J("
+	.ascii	"\267\222=\254h\214\3517\243\211\202\230\271\241\002"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.127.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\246\001\325\017"
+	.string	"\266\234fF"
+	.string	"\261&\035\003\371\034\273\035\231O\021$I\364g\017\261\323\210\237D\300\r\245\243\360\032\370\031\026\326&Y\321k\321\272Z%8\351RDt^\355\322\377\377\347X\3623\025q\363\317\231[\310vc$d\357-eJ\001R"
+	.string	"N"
+	.string	"T"
+	.string	"2,U\n\327\234S[\021\226j:&#\\5\3715\027\360\275\270\356t\f\252\013\0269\242N\005\021\300\320\314\334\273\256t(\225\0353,\217\035\016E]\005\b2\347\004u)\335{'\360\355p\035\313\025S0\347\264r\235\206;\273\355\224\355\003\366{\002\367\210\211\341\362\272\330\241\263n\t\325\021\252!T\357\252U\325\027}\264\274\240p3'\206\3277[QG\346\254\333'\341{\006\275\304M\230\316B\311N\0312\235\034\234\2379\275\002\217\036e\217 \367\220\217\360"
+	.ascii	"\344\343A6\3312\356\215\230X*\340\016x\371\240\273{\325\r\271"
+	.ascii	"\006\256{\232\017\206\312\207\322\327k\274\254@\001'\310o\311"
+	.ascii	"\306'\2456\334\241r\355\221m\357\375\027x<\264R{Z\237\026\033"
+	.ascii	",\354\256J\244\177\3426%~\214MN\364\334\243\177\"\037\261\233"
+	.ascii	"\036\027\215\024}\331\336Iwe\007\013H6\0224i$a\023q@\ny \242"
+	.ascii	"\2214\b\031\321H%\023m\364\341\r\002\203\222\026a\333J\032\310"
+	.ascii	"\233_\027\273\346\031\017\210V\312\242\260]9\001\027C\313\001"
+	.ascii	"\243^\t\020\342p\3169\345\256\216\"\345\206\026\373\371vTZP\372"
+	.ascii	"\322\030\027\347\334\f\270\273q\257\342\020' @\002\243\220\252"
+	.ascii	"\033`\352\305\003{O+\332\036&\325\257\217\271\264\0020\327\342"
+	.ascii	"\330\303\026K\260\240\344\022n\034\262\030\212\235\302\004\203"
+	.ascii	"-,!\020k\317\214>\253\232\r,k\305\213\235\202Z_,\240\215\254"
+	.ascii	"\244\026\032\332B\342\352\364\323Dw\f\205\nQ|\313\246cu\330\264"
+	.ascii	"\337\021\314\023"
+	.text
+	.section	.gnu.lto_blackboxCalculateIterationMaxBytes.130.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\232\016%C"
+	.string	"\252p\200\030<0\246J:\341A.\273qj\374\342rzf\277\235\257o5a\303\331\371\246\306a\034#t\336`\266\273^\214"
+	.string	"\360\235[\226\036\252\350\205\330\202\006\273\036\241\326Z#\204\220-w\222\001y\001a\001s\001y\256\207\331\310I\336\307\032\226\203o\326u\345$\314\306\237"
+	.string	"\b\227J\336\307H\226\203\233\230_\207\337d\243\035\257(v\3142\207\353\272\227B\375\2512/\341\313\371\234\363\261\221\316\030\262\275\344]\357\210`\222ISA\375y\275\344\327\267\365P.1\361\016\327u}\360\223\301\324\237\317;\234%\234,\361\344\354\r\311\344\242fg\323\272\256a\310g\241?\357\257\320\237\035&MS\001\326\332\254\363<\2478\302\357\336\271x&?@"
+	.string	"W"
+	.string	""
+	.ascii	"[Z]YXWVUTSRQGc\221\250\246\350y\333&\371)\331\t>)\223\326\334"
+	.ascii	"\232|\300U\305\316X\001y\347\302{\200\273\003xsg\267\360\002"
+	.ascii	"\321X\255\224\354gy\357\272Y\205mq\256\003@26\313\314\261\354"
+	.ascii	"~U\306\316Z\245d\200W\0231\363P\242{3\363\252\300\033(l\203s"
+	.ascii	"\221|c,\325-\n\372\361ya\233\230k\201\214\032\346\377n@M\233"
+	.ascii	"\026;\305\345Rs\217\272H5m[.\322@a\333"
+	.string	"\234=\376\3752\363\230to\\n\274\0173\245\323\013\333\262\3341@\224\322\336\274U\272\241\331\"\2307,'\312]M\311\350\336\226O\325\226\026-\272]\371\371\344\"\247\270\245\331{\221\205mr\027\271\256\253\321\315\211\3557\017\203Y\206\022\335\033\226\333\224l]W\266knog\002g\2667\230Y\005\363\3210}\205\335(\233\345 \247w2\254\263\274]g\003}`\265\260\225ib\311\320\221\023\333\211\0314\202~\320W[\242\335\320\017\331\340\3331\016\035\366k:\320\237\fz\301\230e\202F\320\267\375\365\004}=\177\020\027\211\217Q\323\023\232\r\305o\333\217\244\006\212y\234\220\031\0071\353\352\344\0023\347\370\240\036\027\032\255\253\023\261@\027\344\343\336\356'\377\b\202~\355'?\b\372\363\375\346\317\303\345\340\235\336\231\r\325\230\372\2400\273\353\230\367\320\354\213o4\365\341\376\302\254Z\036\241Z\026q-\207"
+	.ascii	"\221Z\376\220Z&K-{P-\217\251\226;\250\2269\\\313\033T\313\032"
+	.ascii	"T\313\031\256e1\3252\006\325\362\205k\331\202j\271\202j\231\302"
+	.ascii	"\004\t\021\302\256e0\b_\251\345\007l\331A\003\257\3242\203\005"
+	.ascii	"\nT\313\tR\313\b\016 \331r\201\256\3779o\275\317Y\353~\347,\254"
+	.ascii	"+\253\252\353\235\251n\347<%\365\275s\324\361t\316\306k\271x"
+	.ascii	"Z&^\313\352\265\234\242\226\321k\371\274\226\357\265\334\247"
+	.ascii	"e{-\277\354\350f\217\333\327\372\326\225J(O+\242\323\017\232"
+	.ascii	"\377\371\373\374~\277\235_\357\337\373\351<e>\241 \273X2\022"
+	.ascii	"\344#KF\201~~\270\306R\021 \034f\036>\fci\350\315_\336\003\017"
+	.ascii	"\2012\217 a\277\206\3361tC\344\244\233PIA\350\254f\234\236\361"
+	.ascii	"\240\236\325\312\377\375T\232q\177R_qg\214\310\246j\245\027\232"
+	.ascii	"E\2544\026\270\342MEeh\276\307c\272\006O\317j\b=\304PyHCS\365"
+	.ascii	"W\325\247CIR}\230\223S\254\232M\313\320\210KJ\2356Q]\307bg\213"
+	.ascii	"5[\023\026\315\354u`\3303\024cv\265MT\254h\321\002\375y\366\377"
+	.ascii	"^\326\2664\324\025\262@qt,J5\210V\362-\036;\302\327\0134\262"
+	.ascii	"*R\332\034\210\216\320\005\372{N\f\343EI\230\226\t\315\2062v"
+	.ascii	"\035c\350D\234\320pM8=\313Qep`\354\327\245Z\311\227h\354\363"
+	.ascii	"\375S\232ps\366\353\307V\246s\354\240\341\373]\273\216\337|\031"
+	.ascii	"\334\"U\202TG\265\362\315_K\023\316\220\032\326|\373\330"
+	.string	"\306\337\013\235\352\t\352$\303\265C\226\230Rh\276\3501\275B\205\226j\t\207\222T<\314I\272s\332D!=/4\337\363,\210bh%/:\230\242\337\006{\361K\226*]\302;=\f}\354\260+\277CIh\327\335aNZ9$\026d1\276\243?\212!c\006:\003\375y\241\357\347\314\206j\304\314KX\t\263$\273\2666\370y\373\211?1\013\331N\364]\250\205\356B\377\364.\264\333B\263M\233C\243\361Df\3673\354\361>\356\003\204Y\020\035E\312\210\030\215\230\035I\262\343d\036`H\206\354\370\301C\007\220\035aB|\350\b\022\306\243\210\2210\260\002<\204\210Y\221\260#C\206\024\t3\356\235]\300U\363\245\352j,\007\215<k4N\200\325\016:mn@\327q\006<.\005\235\272\016\352[\255d.\253\346\333U\325W\255\364B\267\232\330\244\351\246\201\241\241=\001\201\177\\S\016T"
+	.string	"\005\315W\353\252\255\266z\201Z\311\220m\222\345\002 \242\371n\035\323G\214\350\253V`\365)\300 3\223Mv\214\030\021D\267F\203"
+	.string	"B\024;D\022\215\2553\373\236/\3115oz)6\232f\311\210\223\225\027@\273\255\256C\364\017V\f\333\2329d\355\241?\330.dc\355\201\330_\037\353\023\252Ml\353\247\006\352,\311\264\\\314\306X\330\271\344\032\016Z\354\226d\0337\311\273;\364\247\332\017\374\271i\311\350.A\037\035 \255\256\376\302\031\360\260\032\364VS\356L\325A]\253\225\007\224\323\303\362\352\363\311\315U\035\350\252V\262\027\252U\244\233\022\364\233\222u\305\241\371Z\035\323;hu\203.b\310F\330\241\253\332\313\252\020\326\037\346$\024\033w\205\303\235?W\033\322\336P\305\354M\027\366\r\305\353\264Y\267d^2NRNR\016\3723\355\003\276l\271T\304\251x\347\006\306\252\353\272\372"
+	.string	"\tC6>\247\226\274FU]\307|\247\250\272\253\2257\202\242\275\203\317Q\001\3735\201'\250q4\344\2144\n\215\210\210H\222$\351a\005\004)\006%\254\007\022@&1\251\031SB\244$E\005\251\324\0306\0030\341[$P\240\323\342&\327\251\224\037\337C\357G\002\265\356\254\335\327y1\215\fY\273\r\373\314H\200\246+\231\344\242u7\246o\0265\"\2773\302%\201F]\031\276h\223\177\321+d\343\0309\307\217(\\\312\021\177\204?\323f\016\262\002\256]y\372\206\200A%U[\275/\177\\\003$p\003:J->\020\330l#\330q\321i1\335\001/\356C"
+	.string	"\2674%g\335\350\034V\241\3659\224sPb\215\361\022\227\223[F;z\372\355\370Z\310/z\020\332]\237\017?\n\320\342^\300\350\364.\202P\001r=\224\013-\027\n\320.{\342(O\210v@\020\303LPt#\264\315\0011N\247\370\034!5\245'\372#\244\307Q8S\372\027\260\224\013\003\231\013\213\341\336\233AJ`\365\347\336*\031\301\372o=8D\243i\b \202~c:r\257Sru7`P>\267\325``\217y\r\345\037\033\242\354\314\231\252\246\261\f7\230q\337\025"
+	.ascii	"\013\203\004\233X\256C\" \004\262i\351\315\262\311\227I\210\321"
+	.ascii	"c_\316O\n9\270\245lCN\312\216\316\204\225\351\265\033\245\301"
+	.ascii	";d\020T\253\231zGY!\251PV\243\241@YI\b7\325\246\242\305\217M"
+	.ascii	"\362\336\301\345\225<\241]S\023\351)u\036@}r.\307X\271k3\224"
+	.ascii	"\024#\366k\003\005\320\267\240b\352\204\bq7"
+	.ascii	"\036hGL\244#\212\352~\n_\2444\344\242\023\205b\275t\027\323\016"
+	.ascii	"\356\fM<\007\360\"\367\230\361c|\306\264\365\2633\357\360\027"
+	.ascii	"\300\243\026\013\005\034\2756^\204@I@\003\235\031l\310\216\245"
+	.ascii	"Q}\017\026\373R\n\322\230G\177L\021\353!\235\227\377\260\362"
+	.ascii	"5\257\0278\363\016\305\177\374\235\222&\240\342\375\\\360;\301"
+	.ascii	"\234N\313L6 <\275\354Y\317\321\327\036\207d\020qSW\316\274\177"
+	.ascii	"\352Mm\247\302BC\272Z)Q\366\240\220nf\336\003Y\254:\372X@\304"
+	.ascii	"Y\033\243G\246*M\005"
+	.text
+	.section	.gnu.lto_writeIntraframe.132.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\232\021-I"
+	.ascii	"\212x,\032=@\246N\0070\307*]S\001\347\251\267dU\306\213\022<"
+	.ascii	"\317\223\374d\207\354U\030\024\223\265\231\315\020Dd\r\375\320"
+	.ascii	"3\362\335\242\355\247>\001\347\325p\310\375\034\024\326M\204"
+	.ascii	"\354\275SJ)\220\001p\001\243\001\253\363\220u\026\n\235Y\326"
+	.ascii	"y]\235\325\325\371UgW\235\273G\262\222\364OM]\334\003Fo\223i"
+	.ascii	"\245\353\267\346\3215_\367^\367]w\232V\231{\017\033\245r\202"
+	.ascii	"e\"\351\311\303\027\320\002\215\301\303\306=\276\323\327\354"
+	.ascii	"6\222Hug\004\357\275!\206z\310\301<y\310Kt\326\344\221\323z\201"
+	.ascii	"\330\326\342\354\235\301\351s\223\354\223\247\3274\033f#\013"
+	.ascii	"i5\374e{\204\330\312\334{\215\2752\013a6\366Z\3543-e#w\264\321"
+	.ascii	"\264\235\206\210z\317\242\327\354(M\363\213Z\030\366\312\321"
+	.ascii	"a\227i3m\337\025\311\032\213\3362\341\237\034\2412Z\275r\327"
+	.ascii	"\260\327\254\246b{U[\212\355\225[fEWG\256X\204:-dk\"\335{\225"
+	.ascii	"\217E(\264\342o5\332\314~\333I\344\225U\025\325\224T\024\324"
+	.ascii	"\223\323\261\211\311X$\016\205\354\252\276\267\334\322.\220V"
+	.ascii	"I\254\223d\032I\306\316\257\324! 'c\324\nsnu\305\214\256\253"
+	.ascii	"\204\033\366\264\0019\3012vU\314\350\232jKOm\221s\251\270\216"
+	.ascii	"\212\323\342Pp\375\004\227\305\235\332\372\330\306\346MR\232"
+	.ascii	"I\312\232\033\325\272\250\226\346D\002U\314\320z\330\200\234"
+	.ascii	"\240\265\264\txqr\346B\365\351\336{,#S\035\270\222\262\246\263"
+	.ascii	"\305.\320^\241\264\2526\020\254\363\350XvD\245j2\3674\226\215"
+	.ascii	"\3717\236n\200\346G\n\b\247\f\332.\334p\357e\177\226\2315c5\263"
+	.ascii	"\017\231Y\004\363\023\206Q\022I\001\331Tj\372\224\327g\277\023"
+	.ascii	"\221]zR\376\372\215\247\207\200\322\2656N\266f\277*\330\332u"
+	.ascii	"\240\n\370\204\026"
+	.string	"p\256\376gn\315\264g\214S\216 \002\362d\346\320\207\274\206\275\016\357\275\377V\177j~\236P\347\016M\250\204O\340\006l\307>te\221#\302\366\352\217\354\323s\207\345\375\314#Hd\365_\007*\301-\307'R\244`{\355G\366\241\235Q9\277i\276\3032\257`\341\375\344\005\203\370\370\215\275\330V\373!\222\201\320\275\267\0027\237\356\323\202[\256Wv\001\303\373\t\203\3555\303\013\251\340qa3\223g\304\247\314\321\246\377[\364\2550\253\316K\325\031Lu\346\241:\357P\235u\250\3169Tg\034\252\363\r\325\331\206\352\\Cu\246\241:\317P\235\277Tg\0311Tg\030\315\327\374\202u^\321w\315*Tg\024\252\263\t\325\231\204\352\f\242\350\354\325i\23234_\263\203\336kV\272s\227\2233\227\223\363\326\321Y\353\350\334\340\350\314\340\350\274\300\235\025\260\316\tXg\004D\347\003\254\263\001\326\271"
+	.string	"\321\231"
+	.ascii	"\353\234Et\036\320\344,@u\016\300\344\f\200\311\031\213\3119"
+	.ascii	"ItF\016\235\257\214\316VF\347*\325\231\252\350<\305:K\031\235"
+	.ascii	"\243Xg(\325\371\251\350\354Tt>\026\235\233\206\316L\252\263\221"
+	.ascii	"\350\\\034:\023\003\367\356x\036dv|\273\221\262\202 \206\314"
+	.ascii	"\303X=\226[\034\236'4J\007\223\271\034\257\243.\3077\234*#\227"
+	.ascii	"$NW\365I\267\2706O(\024\325\324S}\343\265J\\\256\2152\234\372"
+	.ascii	"\246\223\266'\351\tG\234\337\033\217\003\356\306w\034')&~E\352"
+	.ascii	"\037\244\341\331\035m0\271\362T\343m\270\325\370\226\323\024"
+	.ascii	"\005a\n\216&\336\326\226E=\226[\026\300'\224\211\006\223*\303"
+	.ascii	"\031Ocm\3067\0356B\265O\034\255\255c\"\244\204\372\007hSIw\305"
+	.ascii	"\257)"
+	.string	"\025\216\312\370/\250\214\357<\"\226?y\375\023\024\036\331%#\323i+`\235\336\353\331\311\316\216\337\364N\217\264\344\344\322\364)\0247k\243\034\277\325\024\272\363&\356\244\215\202\326\252\265jl\257M\317\336\241Y\262;\033\376\333`\303\360\263%\223\376d\335^\300\202x\030\276\004\304\267^{\234;Dlf\316T&$R\234\254\205c\372\244\033\333\234'\324X|\343su\371X\333F\001\2137[\270\342w\037\264@\273<\245s5\321\255}\363\273\304\322\323\026\216\370I7)m\206\225\342\232\322\360[\332+\376\326\002\237P\341\277\261\220o\215\361o\310\265Z\371J\270Z\371}'m\277\367\212\261\377\246\374\030\357\344\2466\365\225\201\013\351\332.S:R[w\344\026LC\222 \374\013h\201$i\230{\262\251\377\306%X\022\277\266\204\221X\243?Cc>\211Q\274\211'\361Mv\326\364\251\243V\214\211O"
+	.ascii	"w\266\342Q|\263\277\325+\276\365\264VA\372\007\030\215\2600 "
+	.ascii	"^N?\300\200,\275\302\226?\226<\212\374\325\025d)C\307W\214\035"
+	.ascii	"2\224`8b\360P~\205\371Pv\r\340e\017\032a\312\037\313e\230\322"
+	.ascii	"\0305\322o\205=\370q\"I\320\3107\271\233y\210e_\344\214\230\207"
+	.ascii	"\0221\003\003\331^\207\244U\032\343\250\353\003\025q"
+	.string	"=;\242C]\337\316/{\330\255\347\362\242\365[\337\340\265\036y\307\231\307\340\033\374U\"'[/i\356c\027<\203og_S\020spx\257\221~\262\377y \346\"f6b\016r3\007\331\005o\3657\007\311\031\246\351~\374\217\237\037\233s\200OF\n\336\371\020\251\312\322\367k\236\214\370\210\f]\217\202o/i\203v\234L\360\303\n\202O\360\215w\340\021\270\035\277\303\204\344zk\257\007\276\371\322\024\331\345!\227a\320\250`\277\244\003\366\315\346\352\337\230h\250\352\305\277!\252\255v\240\342\035\364\251\367\336k\345\340_\274\224T\016\222\223\215\201\033(\360Yo\340\033\317\311\205\300\027\370&\273\204\327\266\265^\234\266\331x\004\276\365\n\345\r\370\254\357\226\315\341\264m\023\336(\007|\357\351\225/\rP\322\177\364^\261*\001\257\342\333\022\331%/gfRbZ\362~\n\370\367;\244\346\327|1\306\362"
+	.string	""
+	.string	">\300s9\373|\362\001|;\2714\325\370\032\236\303\234\262\034\226\303\366\212\365D\344'\237\265\344\024\334\3624m\233\0041G\3236\273\220\337{i\202\354\362\250\236}u\267<\342fZ\270+HO\350\024\017\272\016\201b\250q8E\021CC\"\"\"I\222dX\003\261\005\204\030\306\234\264\016\021"
+	.ascii	"!cN!\"\232$)t\372\255\004\246~\2362\345\273\224c\3575F\2425\320"
+	.ascii	"Lv6\263\324\004d\fFB\331\323)\\\316\001e\270\304pe\252\034P\264"
+	.ascii	"\222(\316\003P\354\230Sn\217\333A\201\373\032\337VRUb\260v\214"
+	.ascii	"ej\360\224zx\021\367?v\253\250\360H\002\365I\023\223\250\217"
+	.ascii	"\251\255\r\333b\345,\n\373\241\270]\355-`Z\3763\345)3\027\330"
+	.ascii	"o\013\f\241\303\0058\b\324\221\265yA)\350bl\351\b\271\320\216"
+	.ascii	"\302!\355-\205\013\212\345\375\300\251\221\016\216\306\3213u"
+	.ascii	"\006\321>\225'\022\023\244\374>\203\260K\020\022\363\250_$\371"
+	.ascii	":\362\\W\342\202\317\r\001m\230[\274\b\t1\3773@\306\354UHP\264"
+	.ascii	"\306\215\366a$\260\251\252.YIj\273\334\231a\256Kd\346\002\210"
+	.ascii	"PT\226US\225\302\bKo\200\323p\032\215\344L\276 \245s@9i\274\""
+	.ascii	"\362_\205\311\343\357s\212*\361\2707\211\222\021\231y\204T\371"
+	.ascii	"c@\200\032K\231\353oLE\221*\300"
+	.ascii	"\355\t\220\323\333_\301\230C%h\235ILbW\320\214\266\204t\0010"
+	.ascii	"'\177\365\335\224\231\007\350cA1I\212vc\312\177Xf\330\371\240"
+	.ascii	"\271\b\036\033\272Ay\r4\315\207\206\221\346\022~!\313\030\245"
+	.ascii	"\204!~\255\3060\322\342\217[\350\032a>!+H\240\311\005\332\257"
+	.ascii	"\216=1\027UM>Nm\307\235,t\252\340)M\352\331\352\027\243\271y"
+	.ascii	"[\337\031\203\352\230\334\253.e^\264\372\005\r\350\323~/\"\330"
+	.ascii	"8\253\353\341\232\273\360\316.$\036\327+\001\223l\352l<\322y"
+	.ascii	"?\017\032,\352v\203\226\320+\225\212\343\r\303\"N[J\364\324\255"
+	.ascii	"%4j\262\245Hz\205x\006*\0027\003$\216\251\342\240\250\347\266"
+	.ascii	"x\322\301\0178yC\f\245\241]\25334\343\013s\271\367N\344?mH\031"
+	.ascii	"\222p\016m\305\030\033\364\251\022\030R\2412\304\373\276V\016"
+	.ascii	"s\300*>h&\332K\264\217\334oV\272\313\236\303x\353\364\221\274"
+	.ascii	"\254\351\217\360\357@\231\177u\370\373\263s\003's\307x\251\002"
+	.ascii	"\246\211\2024\205\031\376\315|m\351\020\317\rc\376\r\350\254"
+	.ascii	"\242\026\025 \032\265\353\365N\3476\2278\331\n\370R\004\374R"
+	.ascii	"\004x]\004x)\007x)\026`\\q\206\301.\2133\312 ^\253\373\264\235"
+	.ascii	"^\007\375\007"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingAveragePredictor.133.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`;\003U\027"
+	.string	"\026-\231H\320\026Q:\324\241\024D\212nI\212QI\203rN\237k"
+	.string	"\305\210\n\232\034uB@\266\256\031\217qZ"
+	.string	"\375\2232ne\b\204\035\350^?\270J\255U^\016\304\017\327n\202\213\317/IeQ\374S\361\t!\233\310\235R\202"
+	.string	"{"
+	.string	"\207"
+	.string	"\265V\003\247f\020\236^d\343\\,\bO\375i\377\305a\274\256\343\037\257Tml2\034\265V\004n\tO\013|\345;\365\036\340;\365\313&r\212UX\202\025L6\314HRkM\255\b\203eY\226\367p\2677_\247\336\316\227\037\343\236\355V\312h\260S\017\214y(A\242\305<\227%A\273\353>g\264\232\351\241"
+	.string	"\361\275\356\324v\363\221\321@|\202\nj\255\2362\332\207\373\273m\f\266_\354]\005;\232Y\3328\330\334\034\373.#\226\004yql\324w\356\323q\277"
+	.ascii	"o\232\345:\377\312s\267\351\323*\237.\201\323)\3374\351\323\243"
+	.ascii	"O\243\200\323\242o\032\300\247C\340t\370M\203t\372\243\323t\247"
+	.ascii	"\275\235^oz\356\364\007\214\200\204\320n\002H\255\036\312&\365"
+	.ascii	"\007\335\231\370\316\237\263?\303\347\261hGC\007\034\0263\007"
+	.ascii	"\341e\370:\213Nm\347\374\363\372\241\236C\022\026\035\202\002"
+	.ascii	"*\356\363\321\236v\366\220.P6\264\243\365\234\2207\242E\231 "
+	.ascii	"\362\026\300R$\341\206\366\377\231a\205$\374\326w\032\356g5\226"
+	.ascii	"\335\005C\244\212o\347\262\254'y3o\036\037\335oO\246\250\231"
+	.ascii	"\245MK\367<\177\001\272\371\330\345\321\021\243\355q|\227c\336"
+	.ascii	"?\037\252\334\261C\360\033=\273?R+[\354Vv\356\034\262\341\t\315"
+	.ascii	",\017\334F\206\260\326\352\342\323x\r\n>\211S[\020\347e\342w"
+	.ascii	"\372\275\221\332\023%\001\243\350R\261 \254\306\231\020\353."
+	.ascii	"\231\013\242\212f\030EW\213\325@\306\201k\325\212\020\341\301"
+	.ascii	"8\302\230\254j\301 \306PP\301T\210I\311\260`,\244Tc+\325B\300"
+	.ascii	"\342\314jL\271DqL\211p\365\213\023\343\347@$\304\017\232\255"
+	.ascii	"\241\233\343PmQ\273A\246\201\233v&`M{\235\\\017\233\271\344^"
+	.ascii	"\255\265z\233cZ\324^\367\027\333\315\207\274!M\225\265W\022\346"
+	.ascii	"e.`\2630\237\266\264*\373\036\362D\312\226bR\276\2445\001\335"
+	.ascii	"\212\220\0019 \200\002\231B\242\007\340\353\305\002\377\356@"
+	.ascii	"\353@\345[\253\247\221B\032\034c\357\037\311\006\326eD\371>Z"
+	.ascii	"$5\3575\224\035\315A2\263\331\020k\274\251\315\347'F[\267\367"
+	.ascii	"d.l\375\261\r=Z\254\260\245\372\005\353\213\202\357\244\350\366"
+	.ascii	"\030\331\315\360\325.\374\310\336?vL\351e\367R\351]\304\304\357"
+	.ascii	"\201\032\356\222\310\204\375\220j\224\306\365u\0311_\007\246"
+	.ascii	"\274\367\022Y\344\205\3056\0360\021\323\325\237"
+	.text
+	.section	.gnu.lto_writeInterframe.134.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\033\027\225`"
+	.ascii	"j\236\264\"L0N\323\031\016\200>6\303\005}P\024\2011A\264\204"
+	.ascii	"\353\035Qz\361T\f\205\212dc\024\"\355\210\346\252\315h\303\356"
+	.ascii	"J\342A8\365\313=}!\324\201C\030H\212\3335i\253\2625\372~R\277"
+	.ascii	"\024\362\203\372\211\214\032\331{K\231d\007\002\371\001!\002"
+	.ascii	"\030R^\245\2247)\345\275\020\344EJy\217\200\274F@\336\" /\021"
+	.ascii	"\310;Ly\211P^!\312\033l^ \312\233\242\274(\312{6o\243\274\334"
+	.ascii	"\274\377\226'uZ\262$\217\026g]\265\374\025Z\355\320\2712\307"
+	.ascii	"\373\363\374v\177\363_\363\267\375n\376\267"
+	.string	"\007w\237g\205\211\246\274\333a\037<w6\206r\017\315\343\366vvh7\350\354\004\253`\035\033:mr\346<\301y\311a\302\271\013dB\007s\307\263[\202]\356ov\207\033\345q\333I\274@\3134\353\272\016\217\356F\331\035\036\035^\204\257\335\355$\034n\207oRl\030\253\3648S\226\255\253\332\003\3016\037A\275\033)H\353\235\365I\27530\276uUS xt\325\202l\316\246\276m\312\271\2669\317\320\224\035\020<\312PjW\243~\r\005^\201\316\320\370\326\225\353F\360\350W\244}\232\247\251o.\335\327\256\365U\362\234\375\361\255\353\032utQ\004\217B})=z^)=\252\356\366i\312Z\257X\234}i\261\rZ\327u\252\307t7\322y\236\302\355\237j\337\364T\277A\203S\023S\206%\fJI\027\220\216\236\214\212\210C\"a\020\230\242g\263\272\207;\b0AW\337\020\3025\204"
+	.ascii	"\002;\241\275\t\r\r3\225y\206\337\341*\303\001/mp\f\033\220a"
+	.ascii	"%\262'\221i\300\027N\244\024y_\030\thCL\027"
+	.string	"\363G\307b\376)\357\037\356p\215\245a\243\345\213\226\02701L\027\330\207w\270\300N(8%\023\235D<3/\277\303\345\345\\\361\365\206\367\273\1778\303\345\305\302\017b\272\276\036\004\332\270\373y\326\307L\230\256\257\003O\244u]\215\222Zg\n\336J\0329%2\303\345\250\005?O\023|%\260`\224\314:\227\264p\200\034&\251p\337\316M(\371\254\345\271Ir9\003m\254\353\272\214Lv}9|\227}\354.\224\335%\004\002\215\324\337\323:\204\244\243\217\372v\036\314[K\213s\\\032\331\354\353m\205\336\021\334\301\003\365\314O\027;*Em\264\245\313\210\253I\020\215\265\024u\021<i\342\200`\251\207`\252i\252\b~vY}\265\036X\352\303&\366\343\356\206cIO\007\217!\006Z}\265\313V\252\264!6J\207\344\302\307&\310]\037\234\005\244\257\3306\354\"xBH\001\311\305\211\211z\327"
+	.ascii	"\004\240\204M\324RZ\207\202\235\266\2607\364\035\227\214\305"
+	.ascii	"$\330\357\033\373!^\377\370(\260\357G\317\034\332\334i\003\r"
+	.ascii	"\035\313\214\374\267\374!\351\331h7\3259\2361\022\212\340\354"
+	.ascii	"\307\321\3437\250\373p\306\0228\013C\202\353\272\272\330\367"
+	.ascii	"M\240@\220\214\224\364(\267\214\261"
+	.string	"& )\301?\357\317Q\306Q\342}\363\245Kw\027h\200\217\\\022}\322\354\250\364\225\324\373H\221\301\334c\240\255\224qh'\256\202\224\031z\353\272\302\330\353\371\036\007\366d\216.\021#|\244\221\364\350\002\r\004C\207\3172m\016\213\377v\325\214\334bxf_o\2663\330\355Jri\311\202\345\312\026\322\312\355\276\257\202\362\376\370\254\224w\n\312\033\005\345\205\322\004\345eB\265$\t\022\224\027\202\273\3712\360\267\357\002\307\373\n\t\002\344\307\233_\037o~{\274\371\345\361<\337\035\267\373\352h\336\034E\2748\212x\013 \362\336 \362\332 \362\326 \362\322h\336\031\315+#\345% \345\215!\344\035 \345\205!\344}\221\362\272\030\362\266HyY\244\274+\210x\005HyU\020\361\246Hy\247R^\024)\257T\312{\"\345\215\022\362\232HyK\byI\244\274\001\244\274#R^\021)o\210\224\027"
+	.string	"\"^\020)\357\007\"^\250\224\327C\312\333A\310\313!\345}\022\362nHy5\244\274NB\336\246\224\227I\310\233\001\310\273\004\344\r|\226P\272\250.\321'\272\311\220\217N\322g\337qi\242\243\350\324\260\327\231\240Z"
+	.string	"\307D\277N\317\034\211.\221\207\347\324\260\263m\341\022T\013f\350\221\350\347}\007\027\2608\264\177\275\341\2419j\261\375Sg \246\225\354S\204\244\367$\362\350\036H1j\202\310\376\034\243"
+	.string	"\232oD\213\350"
+	.string	"\332\211\355Xv\342<\032I\237t\307\245\021N%\033\321\2173\326\354\302$\250d\"\372u`nE-\266\"\264\222\034\fO\234\330\366w\210(\352<z\313J\330\252Y\351\323y\t\267\275\265<7/#1D\237}\310?"
+	.string	"\364\207\016\321N}\3072c\003\320wk\003\321\257\033kB\365\207F\331\276\230MU\266\201\352\264\013\214\r\255\271\342\353Mo\330b\313`\377\221\275\262\204\001\003\265\236D\nA\377\270\006\202~\335\371\255\311g\231\346\205\305\177k\352\005_\374\276\034\356g\372\021D\024|V\367\036`\324w\364\326\216s]\327U\270\243\237\325GaMA\307\245\2075\225\214\251;\364S{h \035\207\356"
+	.ascii	"\202\032v:\2647&\207>\335\206~:S\303^0\301\360\007(6\364\351"
+	.ascii	"(\013\241i\350\273\251dG\\\007\371\247\231ZC\247u\216eM\355d"
+	.ascii	"\246\206=\216yF\035\303F\257\251\03776\227\241\231\372Z\207\376"
+	.ascii	"p\231\0326%\306e\3241#2\364\357\2166\225\202\374\332L\260\004"
+	.ascii	"\273,\f\2754\306\\\0223\306bm\030\372p\017\336\301\223\366\207"
+	.ascii	"\344\002l\261\005\316A_\245{\017G]Go5\327\336_oxj\322\026\323"
+	.ascii	"\321\257\322Gair\214:"
+	.string	"\261RR_h\245\376\336\261\314\030F%{\035&\230\313\351%\365\353\214\025\003\361\027\225\214\306\252\033\360\262\005\363B\277\005\345\236\337\034\326\336\225q\231\235CR&\r\206\205\0055\200\360\354\241\302-l\224\206\322L\372Z^F/\254\034\262'\263j\031\325\f\037\251\232I\217B\351\021c^S:J\277O|J\037\317\243\272\354\255\345\265\025:\n\021\334\212\352\210\023'Pp\034Y=!\022\204\370@\372\204\210\225\222#9\254\250\220T1\261:\362\304\310\212\nJ\025\216\007\224\034A\262C\t\021\252*$VL\252\222\326\b\212\b\252\212$1BDI\221)*$D\226L\031q\362d\n\205\207\255br\304\311\224UU\225\223\251\241\032\326;\203\345q\001\237\037\037V\033\227\2025\347\272\206\251\301\267\246\270B\272\375\325^\212+\024\001\025\373\372\322\243\022\200\tB\023(Gw\341\202\243\267+\330\222\243\177\354"
+	.ascii	"\205\264\200\306\321N\206\216gnt\001m\243o\264\023\335q\256F"
+	.ascii	"\333\350\246\275\343\362W\276tR\032]\243\177\244cl,EB\301u\305"
+	.ascii	":r{\253\257\024\005\355\026\375\212\204\212\204R\032\315\204"
+	.ascii	"'.\357\370\301\214\266R\345D\037;k\206\337\\\267QJ\006fc\261"
+	.ascii	"!\3774\313\350\237\001\353C\333@@\214\206\321\004\364\341\216"
+	.ascii	"e\003t\214Bj\330\345\230\204\212\177nz\003\364\345^4\f\026\304"
+	.ascii	"~j\230\013\275\242!\036T\374\233B_\364\347\200\371A\233\303\342"
+	.ascii	"?\r-\266]ggW\240d\377\215\213^9P-\332E\363\332\235\333\241\032"
+	.ascii	"\274\253\032\325,>\262E\277\216\233\262\314\217\317"
+	.string	"\330WN2\230\323\374|\177\033@fvM-\266\\\037\\}\345\332\323\322\237crCt\373\262\363\343\313\352\253\017we\311\fM-9\fMzO% \035$\213\331z\022i\026\275c\351\233 \203\245\276lT+\352\326\027\b\016\322\035\260"
+	.string	"\332\262\304BoE\253h\026\355\304\006\244\233\b\320+\372v\004\350\307I\321*\264p\n\252\262M\212V\221\274\033\264L\303\320bDL42-\271$\252\336\363\302\217\006r\245\f\257W\372p\224\246\366\240h\251\236\352&\270\037M\205B\033\212\276\234\236&V\222Oh#\205\326\201\321\371%!\371\350=\215z\364\217-\r\220\266\372r.\264\330\n\275\034-\351%\255-\315\247\250\013\351\255\347\375c\264\266\304\035%\351=\237z\264\017!\375>\177\3033\303"
+	.string	"\251\305\204\364\222N\n\033!\205\3432\201\321\250a<\005\025S\206fD\222\202$\205\346\261\005\204\030\307\0343z\021\320$s\216!\032!IR\220\fs\360\201\355\\W\262?\230\372\371\224u\270\246\345\263\354\362\347\260?mW\032\t\313\330Sy\240\315n\233t0\311\2225\3662W\271wO\f\002n\270\3309\265"
+	.string	"\025}\242\376Ra\366z\240\315]\230x\374\265&*\327V\200iI\232\305\226\312\350\3436\033`\264\366\004\316_$Y\265\235\222\335\227jYe5\373\205Z\317H\303\361\243g\003\321\302f\271W\305\301l4\250\021#\245\260\261\251\211\263+\267>\330\201\200\324Yf6:e\346\022P\221-\236\235\307\026\317 w\r\250\222t\177\373\320f\007I\205j\303\374NtD\342\201\313h\351'%\341\221l\007 \002\305\362\334\302\232E\016\316\355\245\240PW\347M$.\013\300\362\212\232\376\f\251\247%\030f\204b\030\357\005\215\353\316n\004\225"
+	.string	"\332\0038\207\234T|\274\365\212\232,\3206\\\243HxRi\360\b\026\300\260\350\t\220@\354;\224\311B.\344\327V\363\222O\304-\252\212R\353\237Q\\,\007\t\275\207\007/o\251\363\315Z\270\303\f\272\016\026/&B\026\252\363\214\323\036\024H\204\016\341\337\350\025\023\317?tA\t\373\bF/\243-\350\345U9y\274z\\-Qv\342\300:\031\272\201gE\036\177\016PH\224\200g\320\262\322\372DA\364s\325$\301\373\243\307wZ\217\nr\305I\201\346Y\302\233r\3420\337\034\357\341\275\004\200\360X\344\0179\017l\234\367\201?'}r\2625\222c\332#\333\b\004k\320p\314\306\240\201U-G6\2411\357\035\250J\310\231Y\031\231K.\"n\001\351m"
+	.string	"Zp\354\030\024<z5P4\355\260\3145\213\024&\325\322ZC\205\325\303\341\347;JW\260p<0\246\333\301\365\031\022\311\035\242\265\200\233a\203%\315)\021\357y`\016\376~\326\225\027\343\022\233\307<\007g(a\022\b\203\267\n\035x*.\311\232[\272\231\243Q\nq$\016\233\235\270Q\330\013\344\222;\254\237\316#\311\312\234\034\216\030Bp\276\261W\367\214l\b\301\2524W\353\225r}\206\004\022\352\372\235y ?\275\212\227\314\225\325uW\252\254q\363\006\220\214V#\332M\200\004\001d\003\227\302\\y\352\237\352\025\212\b\311v\302(b\364\333\021\347\213\244_\371@\340\241\352"
+	.string	"rX6\"k\222\330\030\037A\246\017d\333\230\302`\307E\323p\366U\333Ac\265\340\336\035e)j\356\214\350\037D\326\251\244\350\232H\324\034\236#^3\251\234\001\303\024\0244-Hh5\027\311\315\224\236\001.\034\204\032\357\267\237\346\007\033\030mZ\216\212Gp\347\225\361\357F!.\244[\306v\273"
+	.string	"\272\277\354\360\375\343\212\247\230\016@\213Ip"
+	.string	"\323\360T\213,\233\364\214~\372\346\223"
+	.ascii	"\306\212\2011\337H\030\333\201\264\037\303\353\002\230zd\230"
+	.ascii	"O\241\365\n\311[S\261\216u\332M\3211!7U\006{`\313\013Q\n\246"
+	.ascii	"bT~\263$\223\302\037\f=:\206\317\2467\247\016F\030E\203\255J"
+	.ascii	"F\260X\317t\236w\\A\361T\367_\360\367\007"
+	.text
+	.section	.gnu.lto_writeSlowFrame.135.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\375\001\r\020"
+	.string	"\026\335fE\340\224(\035\362\025\265$x\n\024+\366\007/\234|\342nW\376B\210o9\031$\016\213\247\024\021\303\220in?e?c\325X\303z\251\2029\330\213\270\017\007bh\026\275\215=\235\204\222\031\300\223F\366\2262\245O"
+	.string	"K"
+	.string	"W"
+	.ascii	"q\007\213\303~\373\217\331\304\207\361\030\252\303d\340\346\300"
+	.ascii	"\227\355f\327\004\312\243C\335\243k7\300=\0028\001\356\321*{"
+	.ascii	"\310\001\022\273Ry%\241\231!\331]OU\\\365T\371\217\035\364\261"
+	.ascii	"V\317\217\204\335u~\254\023\267\336v\003\333*v\326\004/\245\374"
+	.ascii	"\367\350\227\270\307k\002\234\037\260\231\274\271K\363\270i\234"
+	.ascii	"\375\001\225\377|b\344V\033\241+[\266JMa\037\356\356Zml\230\006"
+	.ascii	"\305t\007\323\237\230\346`:j\032fZ5\235\231~\001\001;.\326q\354"
+	.ascii	"\354\226\270)\331Z \345l\027N\353\321\365|R8\375(G\303p\0351"
+	.ascii	"98M\265t^\260\250\266\035<\306\022@\310\356B\270\355+\0025\352"
+	.ascii	"3\334\206\016\324T\213F\217\246\252\246\320,\2615\274\306\206"
+	.ascii	"\234\324\337\264f\257\001y\265E#\006&}\306\241\333\335\007\376"
+	.ascii	"\214\343\270\370\256G\007(R\f\214(\004\347Q(ejy\031\211`Z\274"
+	.ascii	"\016.\242\2227:\241\274\320\002\233<\220N\036\b\223\351\344\231"
+	.ascii	"\310\366p\325\246\343yQ\233Q\021\226\201\273(\"\020\221\2217"
+	.ascii	"\243\334\007\362 ,\276\313\023VVjZ7\\\034A\220\227=FA\301\212"
+	.ascii	"\317\256`\341\204\247E\r\244>\362\261\323+ \320\002\221\031\\"
+	.ascii	"\007\340\326\033CG\030\330\221<\225Dl\210\\\naL3\314\016\024"
+	.ascii	"1\215DF\376f\250N\226\211\254\204\231\200\223\022\031\333-\f"
+	.ascii	"\023r\b\330sB/\2531gdW9L\326\373\271`\201\220\265{\023\027\323"
+	.ascii	"`\005\332\365K# l\024\fI\374\215\306;\247\277\214i\013P\346E"
+	.ascii	"\233\311"
+	.text
+	.section	.gnu.lto_loadSlowState.136.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`H\001=\r"
+	.string	"fYYC"
+	.string	"\2216\035\233\031K3\270\251\bH\006t\255\347{F\225\272\016\325J\300\337\343\367\022\241L\344\315BK\350\240\bw\006Vx\330\3766I\016\315\026"
+	.string	"\024 D\003\200\274&Z\260\177\205\202i\220\275\245L)E"
+	.string	"A"
+	.string	"H"
+	.string	"\366S\\\205\366\223\221ovM02v\275\004\356T\217\366\316\241\036\253\023\240\036\255\3311\0058\354\266"
+	.string	"\205\211\222\024\035\273k)\211kO\315\377\212\007\340J\333\023@\203\335ur\245\017\267\336\366\001\333\n\354\277\004~w\017\303\200\240\304.\351\334\243?\322\213hy\351"
+	.string	"\202\2243\266\267\245\216\260\017ww\255&;\246\253\237\374\024LG\230\206\231VMg\246\277\031\020\323\225\336\342\262\353a\206\307\236\342\312\t\215\355gjO8\214TUU)\351\261I\273\202'\317\245*\313G\343D\242\233\257\366\365\027\241jw\031\370.2\220"
+	.string	"\230\335}7\302\311\244\274E\310\357\374!J\021\365x\245\020b\306\016\223J}\224,\304\357\322\206\311Q\316BC\"\030\310\b\372\352l\300>\242\313\003\362\261,|xB\254+\033Y\035\003\306.\2002+\003\206e\226\306\333\303U\223\253/\307\211\244$\216j;\370\nTy\020\025\262|8\240\332\020\036CDkp2\234\264#H\310sP\365\306\347\242\001\032"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\375*\n\b\021T\300"
+	.ascii	"V\r\277\325x\\\305g\351\215\bc\325\203\001\227\020\232\325\024"
+	.ascii	"p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.137.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\342\002-\025"
+	.string	"\206\245\205I\300\020)\035\300N%D\327\207\004hv1>:\311\346\360\332\373\200\316\276\271u-\344\037\020:\345tF\"\332>\265\315;\367_q\313~\373\033;\214\202\2420\377\306\327$\256"
+	.string	"\354\263M\254\324\177[/\373\204\020B\344N)r"
+	.string	"i"
+	.string	"o"
+	.string	"\341\355\030?\310\254\003\325BJ\336\332\210;J?\240\221\207&!\037z\001\203\030\327\016\310\224P!?)h\212p\354\362Z*\342\265\257\310Q\fA\2355\177,\201p[2\312\351\312\257rN\316\270\311\021)q\263\233\243(\242\203\263{8\323\223\231`\207n\303\365C\207\003Cv\367A\2375\272\333\234c\311\356z\346t8w\307mw\260\375\300\236Q\001F\262\251\253\023\275\b\203\357\343\026\227\371\334C\337E|x\365xj\"\341!hg\233U6\257\234\312c\037\\\ra\203\200\323\253\003\335\243N\253NO\235\276"
+	.string	"\004T>&\242\237#\245\301[\233*\252\375\205H#>\364\003}\332\267/\344\367\314\362O\234\027\363!\230\357\314^\027\365\223\344\264{\323\200\367\002\342C\362\003\304\007\177\361\342\373(\350\331]\n\342\303\225\216;2\214j8<T\036\217\\u\346\273\201\233S\0160\311\033\206x\337[ \271^\3639\325\327\220\n\372\315h\351{/F\346z'\245L\200\036\363B_\021#wmGW\001\343\373<4J,&>\264SV\346s>\n\251\017?\234\226swKU\036-\233~|K\2709\345\251\327Q\317\202F\350\0260\232\213f\362\"S1y\201\261"
+	.ascii	"\200\321b\263\b\025T\\d\026ZX~\221d\220\235\244\274\\*'-\226"
+	.ascii	"\230k\245\365\232\265\264H\022Xv\0016k\321d\262Y\213\305\333"
+	.ascii	"\223\177M48^\351 Zc\033D\377\223z\372\331\364\006\256\bL[\302"
+	.ascii	"\204\030\277\033o\267$\225\3075q\324\235\206\034 \240\230t\024"
+	.ascii	"a\300]\035\007\037\372\235z\263\312+MB\211\031\350\331\265}\330"
+	.ascii	"p\021? \240\002\031A[\007\240\365>\003\316\260e\030\330\223\354"
+	.ascii	"\246\265\"7\342\366q\024\202\344\242X\2156\270\276%V\016\317"
+	.ascii	"\026\263i\r\\\002\200&\244\3056\224f`M\013\307ytc(\b\243\241"
+	.ascii	"m\334\273\034\210\257\312\305K]\020\013\205&Y\"\231\303@\305"
+	.ascii	"\311\333\242\016\336Z\003qM)\3552x\370\370x\356\341\016\024\304"
+	.ascii	"i\300\202\021\26760e\372c\0057\337\227\032\007z\031\354\030\017"
+	.ascii	"\244^\313-\0305\037\303\0167\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.138.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`G\001\375\f"
+	.string	"&WTA\020\221\223\016\363\203\"\201A\300=\203\364\241u\007j\263\321\204\204\317\375\336q\202\361\001[\270\332\351f\013\336\320\337\235\250\260h\021lt\217"
+	.string	""
+	.string	"\030D\n\b=@m\320I\320\276\355\023\262\311\2262\245@"
+	.string	">"
+	.string	"C"
+	.ascii	"\236\277\311iz\374\213\336\241\301"
+	.string	"\223?*dw30\303'\r\254\340\006\354\256\007\244\220.\345\352\nl-R< \310\001\200\241a\306EO\0130\313\244Bv\327\251A\f7u\333#\266\r\330\347\020~\311\373t\305Tb\b\227OF{\224\245\206\354\273\325\025;\323U\246\251\247\363\351g>:\264\300\277\210\261{!\342\330\322\264\342\203\355k\354\261i|\304\262\001D7P^`v\327\322\r\017\031\235J\251\023%\307\t\023\251\023\266\027\033NC\327\263IN\272\b\260\354.\211\203P\21105\356A\333J\252!}\347]7$\031\240\214\261\355\340#:\325.\350\200/\342.\020\374\226O\216P\222\327>\005\346\200H\2706\n8\"\0136\026\203\004\"$\026\007\353X \002|5\030\301\254\007\327\205Y\232\321\347nu\245\212aQ\372h\3664T\342)Pl*rwO\246\274\311\253\364\242# \271\370\2101\306\233<J+}[\026\036"
+	.ascii	"`\2517\023:\226\002_x\215\351wx-C`\0310\004@\030v9Y&IfS3f_\215"
+	.ascii	"\r\246\031\b\f\b\0312L\272A\220\207\213%!!\024/\276\302\210\355"
+	.ascii	"\232\250\226\t\372e\b\340\362\215\331\302\025\361\247\024\n\n"
+	.text
+	.section	.gnu.lto_blackboxStart.140.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`~\002\245\023"
+	.string	"\346\341zH\320\362&\035\252p\364[8\273\3501\263\2776\f\354\210\332\013\037F\375\320\027-\343]\207\263\360\016\nG/\237\255\331\241\225\006/\346\301\002'\037\343\356\036F\251+\207a\353\024\211C\023\032\233\2409tk\204lB\266L)g"
+	.string	"_"
+	.string	"i"
+	.string	"I$hKR\273\333\222\037^sU\b\316\317\223Z\343\307\256\272\314\347\341\004\202\302\201\264\363\260\343s\320#\t\332\260{\221N\006\257$\306\023\355GW\034\221\246s%\366\374c\211\026\274\222\335\r\021o\324\343\271\364\b\330d\360\204\2106\336H\r \250\347\256\027\304\231*x\262\273\326\232\270s\257n\273\307v\001[\211\002\020b\364\265\230\371o\312\347\356\361\370\031E(\311t\264q3\2257\373r\034\307\3212\310\376\324\252O\035zj\320SO\251\276H\205\02198\342\241N\354\346\214?\366\351s\"\262}\037\367\334\314\221\274\262\331\220\232\261\237t%\232#\331\200\355\206\321?\233\306f\375S\226k\354\250"
+	.ascii	"7\033;\020:\035j\277X\344\217\016\200\205\017\fO3\031\233\362"
+	.ascii	"\226\342N-lM\237^f\252Pt3D.3C"
+	.string	"\251\222\3236\323\321\240\f\245\225\026d\205\nPR\260-\355<yk\231\317\231\301Q\264\b\020\332]\246\027\375\214R=\016\242f{\222\362&\3772\247t\351r\330\350\224\237\263\313\227^\302]\033\004\276\356%`\376\320?\007~\231H\200\271\\^+\r\\-\007-+/\255\027LL\313\204\304\260\007,0\255\b0\030L\213\205\223\375D&g\336\356\256jD\355\004\n\3645\377\350'3\031\233\35202\205\362\346\224\351\2778\214\024\177\310\013TT\346?\024\237\246\235\006\231\216.\242B\241\325Y\016;\340\337\225\2762\021\002\267\333\021S zCc\215\300\t\363\322\0259 `\002\2311\274\r`\324\223\017\250?l\241\2603\202t%i[\333\"\207\304*M2\017\266S\2216\352\0310\001\016\320\265Z\321\024P\rs\337i\027lB\331\216\265\031\2721bq\204Y\200\206\233*\365\3656\246\354~j\314\303"
+	.string	"@;\004$\270n\260\\$\312A\260\250\327U\222\245\362\343\222&\305^A"
+	.ascii	"\326D\002\027DC\021$\034\\\241\341W\227\215e\362\315n\346<)\217"
+	.ascii	"\004\327\336%\376\224\202B\001"
+	.text
+	.section	.gnu.lto_blackboxFinish.141.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`d\001\335\r"
+	.string	"\266XYD\020q\233\016\273yM\"\b"
+	.string	"\2343\251Y\201\236\0133\2421\354k\237/&/\225\231*\257\264\330\350&\260\337\2506 =\b\356\t\357\007\346UM\007(\274"
+	.string	"(\004\334\376\317\241\274\240\001\"\303O\233\354\235RA"
+	.string	"F"
+	.string	"G"
+	.string	"\330\253-bc\257\307\314\331\344E\017\033`D8A\245ew3\332\341\334kE'\347\337t\314\007v\257\231W\027x\341\224\344Y\231p\374p\201\022\350\274tv\327\363\003In\353\266\017\330\036`_F;\354\213'\261\371&\206\0202\377\275\372!\326\353\251\201T\210R\n\206\321,m\2214)\007\373\264,\313\033\246%\366\234\376\205#\031\251"
+	.string	"\036G\215\335\221R\307\242\352\013\020\266\357\247\374$r\024\023\320@\343dw\003\363\237\177z\307\243\235\257\342\356t3\365p\faP\373.Ljb\254`\337\254\025g\361\026&53V0\227\312Q<\205\311\247D\2242|\373f\275\316o77a\233\364\330\355^\362h\016\026\224\223\335\260\033\001\336\f\006q\"h\037\005 \317\202O\306 \344\371\310@\"\220\214\243\261\326"
+	.ascii	"\201({\240i\242\f\023G\257\226\226\330\246\237Bi\0015\242$\377"
+	.ascii	"DU\001L;A\210\226\370M/`\003\325\3022\307p4\251\256\351\177X"
+	.ascii	"/\257Y\376\311\001H# `\202QF\253\003`\324\023\n\r.A\030*\374"
+	.ascii	"(c\342C<\256\362v\373\026M\205\227\367\320\345\345^\006\213\367"
+	.ascii	"\t\251;\244\335\002\2730\032?\r$\2742\333\220\265N-\005e}\341"
+	.ascii	"\241\200\317\036\022\342x\305L\272h;C\306\301\325f\326e\201\f"
+	.text
+	.section	.gnu.lto_startInTestMode.143.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`f\001=\017"
+	.string	"\366\\hF\360\260(\035Ic\254\b9k\222N\007I\325\005'\234f\205/\007\253\303z\"uk\bI\206\326Sk\373d\302\257e\214u\334s\362\215\337\340\f\221\017\251\267\305\214W,\265\267,EH\223Uf\242\367&r\247\024W"
+	.string	"N"
+	.string	"T"
+	.string	"8DV\3735\210\321\264\254\320\331]NG\374\364)5\215'?"
+	.string	"\370}n\037.5\003-\263\022 \340JK\240\363\315x@\226\250i\013^j<<\\i!3D\340x@UT\017\310\242!\330\335\277\036]\300T\214\037\240\335ud\201\035\356\217\333.\261\035\301>\211/2 Pq\307\016SQ]\366\265\335]+\214\375\330\275i\264\306\350\0038\321\264\\\300\367x\261\333\332\341\2616r\306\304c\267\237\302\017/s\330\351\261\025\001Kc\017\342\304jrvC\006\227\376l\227\016\0372/\267\023\230\227\367\370d\007\254M\037\276@\316\016\n\233\225~\226\261j\235\320\324e}i\252z2\033\252\270\343.J\333\256\312\201\317\342-:?\346\322\030L\246y\251\272!\304\r\035\260\270\273\237\252\313*\363*\222\335\250\342\016\373*.S\361c\234!%\236u\351\247\350_W"
+	.string	"\316j\004(^7\341\304$a\304\344\001\204\021\222\027\262`\022\361\350\243\241\023\225\214B\027D\234\tI\250\304\215<\023\3679\340\356\204\344q(]\347q\236\020u\2051\b\245\2519 \332\024B\361,\377uPJ\277\303\200q\370\344\312\334T~\263\034\262\033\220\370\223\346\367\2161\355\n$\361\001\032"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\317om\033\"{$\310\231`\343,L\b\3432[\027\366"
+	.ascii	"\262\312\362\322\004p\367\252\020\272%\214\013*\374v\2252"
+	.text
+	.section	.gnu.lto_inMotorTestMode.145.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`y\001\205\017"
+	.string	"\326\034hG\340\262(\035\260\366\322#\271\033\301\016\024A\222\265C\263\242:\\S\200\376\274\221p\241\323RT\265\325D\377z\264v\343\300\027'L\344"
+	.string	"^\267\201\031f\230\207\021\n\321\340\214\240|L?\237\262\363p\310\336[\312\224\002Y"
+	.string	"K"
+	.string	"U"
+	.string	"v\210\025,pq\252"
+	.string	"\214\212G\202Z\213\345\342\307\2341nG<u\031\341j\312W]\262\330\320d\221\201\r\214\031\0343\027\207CH\002T\363!\322:\341\205\270^t\241H\317\214\016\221\013\006\222\300fl\370\3155\306\325\251n&sN\253\347\312po\267\235b\033\201\375\2358\317\231\340\233\360J\213\336{\364[\344\343\3677\037\tj\341\003\303y\255\364\263c*\335\032\373\373}\337\347\245\261\255\036\255Zd\365\006\325\022\252#TC\250^\253u\325\0370\342\305X\361\036;s\266\276\241\311\023e\240P\275\355\022:\r*\224J\362QixA\007.\334$w\341\256\220\005X\247\237\005\250\375"
+	.string	"E\357\355\352\217\210\024<\335\252\354\035,j\334\200)\251\253%d9\002\250\255r\322{\272\367 \323\255\352Z\023\352\221\331\255\361IR\004\300\206\354\347E\203\370'\311\257h\255\254W\3676\225P8\235\244\230J\020N\270\b(%\025\316\204Z\341J\f\370$\301\001\212c9\235P\\l~i|\237\032\b\026-\216\206j\037th\360O\311mclok\223\325vp\3169\245\334\270\243=K\305L.\211\304k\025\227\300L\003\020\020\240\305\220\023\242C\204\353\277x\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.146.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`7\001\255\013"
+	.string	"\206\023IA \253j8H9!\371$D\234\276O`oM\377H3\270\365\0038\r\352\032\037\t\300\215\177\fFvN\331\3033\355\266\277\334\347\274\020\200\020\251\003\260\311x\300\r\363\235\312(\206G\333\275\245L)3"
+	.string	"2"
+	.string	"9"
+	.string	"\273*\343\207\255q\262\226\355w.\331\032(P6\334\210\021Hyu\330]O\005\274\364,\3717\360\213\210\n\237\020\036\273\353\024Q\251[o\033\303v\306\376\204'Y\316]1\024$\310L9zK\303\356\231\305.1\311\213\316P\321j'\rmW\230\032\300\376\266\272\262\237\336\236\326\247\363\351w\023\255\f\251\213\034\002\034\013\316\340\353x<\226szA\334`\312Q\001L\365"
+	.ascii	"X\026<d\346\257\004\251\230\n+]^\355\017\350\342\244\241\306"
+	.ascii	"\021\200\021\273\333\341\037\270+\344\0178\347\021)/\236s\376"
+	.ascii	"4$ \347\363m@8^\310\307\006\344}\242\221\247\2610(\322\021y#"
+	.ascii	" (\362:\327~[]\371\242\032k&=\361\246\263\b\020b\0176Z\001\231"
+	.ascii	"\252\003\260\202\345\315\033\204$0\354n\" \260\002\031*\365 "
+	.ascii	"\325\033\021\372\273\030F\002s\3674\030\207\230p@\001\224qlL"
+	.ascii	"\021\254<\202/\374-\204\266\347\215%\037\330d\366\334\301\274"
+	.ascii	"\211\217\264\356e\216\341\333\221z\220\360cA\207\204\2021\023"
+	.ascii	"\265~\320\357C\200\323-\332\365\004"
+	.text
+	.section	.gnu.lto_writeGPSFrame.147.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`T\005\255\034"
+	.string	"\206\261\256G\220\232Q:\032\020\262k\205\233#J\330sB\351f\276\213 \347FkHG\202\300\034\205\326\335\202\354\037\033\355\t\334\253\273\255\347n\256N5"
+	.string	"4\311\363\374\272r\023\326\341sB\274\272\310\355"
+	.string	"\377m\177\357-\245L\001\217"
+	.string	"\212"
+	.string	"\240"
+	.string	"\247\222?'_J~K>7\177\217\206\204Y6V\006\227Zi\024\303*\327\334*\362}\262PT,\326\023\004\273j;\177\025\177m\347\326\376/\377\353d\255\306\025\262\370\254V\036YZ\265b\341\216$\333I\2647\272S\256\020\335\371\361w\003\240E}R\200\205JT\224:\265\326\\\003\331qe\363\370\335\253\235\001\245\236V\336\330\226\007\336`\371\362\221\202\2227\032D\200{\265\034C\352\307\034\203Pk=\003\245l\354\347\376\237\360\337\301?\245\004\\\334 \330\033\255>\217\032\365^-O\335PBF\216\2315P\fv\242Z\267"
+	.ascii	"-j\243\336\250\251\037\027\377\225\262Sx_\252\203`\342\005\356"
+	.ascii	"\3742\321\235E\275P\226\263\204mvXM\371\270x\032\177\312~\013"
+	.ascii	"\375\233z\274\300\033\350\221\203\013\252\237~\254\037\367\217"
+	.ascii	"\177em\037\277\344\033I~\321\nw\003P\376\215\362\207&_H\362\203"
+	.ascii	"b| \311\377\211\361m\222\357C\371=\224\317C\3715\312\247Q\376"
+	.ascii	"\214\362e\224\037\243\034f\312\314\274\252\204G,\353\177L2.\211"
+	.ascii	"5mY\343\216`\307\350\036\f?V\255\230\261\t\203 \230\r3Z\215W"
+	.ascii	"\021\"\320\235\261~\240f\313'a\277\350\216\206\237\260^\222\212"
+	.ascii	"\206;\273\320^\035\3019\304\033O\331\263qQw|\024v\213R\226\325"
+	.ascii	"R\341\026.\360\002/\320\235\262\027GpN\225\274q\367\257a\003"
+	.ascii	"\021w\200\356^+.\214\3748\254\026o\301\367\312\212\0162\252\024"
+	.ascii	"t'\367FQ#\364q\021\267VR\310j\255\r\276U6\313\303\227j\347\227"
+	.ascii	"v;\272s\233\326\b\272!n\371\002%2\360\232\2300\230\030\301sr"
+	.ascii	":\261\353\371\016\tE\357C\210\335\222\210\017\271\021LKM\271"
+	.ascii	"\235S\211\034\322\200\367H\360\234r&z=\247\\\r\313\267\262\266"
+	.ascii	"\217\317zxq\371\372\367\033\216g\310\210\3010^p\324\2158\324"
+	.ascii	"\334B'\340\007C\215MlC\376uI\340'\035\002\256"
+	.string	"IG\303\342P/\222`X\225P\b\310\332Q\262\r\303:\f0\016\230\022Q\210N\020P\007\005\331// \342\217\255\177\204l\234q\210\f\216\355\253\312\247\247}h<\335\323\323\313\005\223_\221\355\322\021h\223d\304\206\247wG\320\213X\243\365\254k\3034hh\343\221=\023l\250aP\345\02036#IAQA\322\001\260\002\021\031\263n\021p\251Q\f\t\215l\314\032`GC+\002\031\230Q\016b\235j~\005ZlK\260\265\251\360\034\361\234\360\205\361\234i\240\221\201z!A\256\337\322s\001\347\347\364N1H\277&{c\237R\371\347^!R[\356/->\026\247\274\fS\231\364\345^b\367\231e<\266X\002\016\006ger\270/\004\332Go~L\376\364\360*?\373;\252\220\315\333 \341\276=\017:\002\267\032\b`\341\034[\2325\240\345\222N\252z\020\3451S2\364p\254q\003\222!"
+	.ascii	"\3407\005\334\035\016\034\311\332\215\t\307\364%\205\016\202"
+	.ascii	"~\027\247\230\217`\332u\250.\346\215\362\252m\r\322\257DO\274"
+	.ascii	"\364\213!MA~\n)\324"
+	.text
+	.section	.gnu.lto_loadMainState.148.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`p\r\325;"
+	.ascii	"Jgx\026@P\246N\007\227\372\306\025\377\357\225\273\024\3061["
+	.ascii	"G\356\251\334\021\303\371P\303\227\206V\324\217v\265\036\362"
+	.ascii	")\2531\201\210\246\211\236hqo#]\3521\223\375\360\375\310\t\361"
+	.ascii	"\204\204\354-eJ)\005Q\001:\001Y\001N\203M\265fs\256+\221AFk\235"
+	.ascii	"\313\267lg\267^\367\231\3562\335x\335\314\3561\2352\367\236\036"
+	.ascii	"\232\274&\0273v\315\333\352\233R\245\311p\3471\021\217\327$\352"
+	.ascii	"#\222B\330\3676\230\276cb\230\026\243\366\030\036"
+	.string	"K\353\235\265\323\374\372\316\002\327\225\351\201)\354&\224\331\243W\265\265\2010\352k\006\256\353\212\325\227+\b\3732s;s{\351:\265\355|\360p]\2354\367\326\225\331\200\035\b\373J\365\023\332\327v\023\332We\016$\200l\r\213\320\007\304\354.\321\272\256Y/\307,\024*Yk\211\377/\264\326\242\374m\231\315\026U\273\250\224\204D<\032\n\323%\3642\331w\225\373\256-r\t\242cZX\027mJF\204J\337A[b'(\n\344\353=%\256\004\327I{m\373\364\346\234\250\3015\322\033\232\236\262\202\226\304\211Sqjn}\224f@\323\266/o\316\211\232[\017\333\354\203\246\231\013\323\fqjl\235\266\030[/Y\244=W\222\364\035\264\244\205\320\326\334\323f\310\034=\232;\322Wx\244\231\354\322\0354\245}\340gi?\334\316\025\351\357\274\276H\266\301cZ\221\3664\303\272\256\354\3074\265f"
+	.ascii	"\315\334J\230Y\0053\222W|\302B\034\232P\372B\017-(\0200}\242"
+	.ascii	"\200>\364\237\373(\210\376\353\343w\365\350\354\036\021\255\347"
+	.ascii	"\337\222h<w\354\3747\033e\363i\347O\247D\225\037\263\211\236"
+	.ascii	"\203B\330\327@\037\007\365\373[\301\262"
+	.string	"9):\016;\265\374\2644\234\025\021\222n\372\r\013n\341\302\373\350\002\355\333\337y}\331(\233tvb>\370\235T\024\270\367\374\340\231_t\033.\341\272\256\022\270\331\250L\272\240\222Rx\240}u(\311<\337\304|\220A\253\341a\301o]\327\t\334|\335\027\203[J_\2261\303\373\330\227{\006\3327\353\301\224wO>1\037df\206\371#\231{BRQ ?\024\346\021\035\2664`hf\263V\333u?\3501\315Y\355l^\320z\315W}\246\331\252\3134W5^3U\352\254`\350\234\340:O]g\251\241sT\352\214\300:\037\020:\033H\235\013\244\316\004P\347\001\326Y\200u\016\220:C\241\316O\326\331)unB\235\001Xg\246\324y\311:\027Sg%\3249\311:#\245\316D\324\371\310:\017\257\263\320:\247\327\031\265\316\367:[\353\374\327\331\255s\223\b\3544\266\256b\n\002\274"
+	.string	"+\027\234Y%S\315\274\217\001\276\357\372\311M\234`\235\037\0376|$\247o\322\255\377\277%\254\266\262\022Z\375\326\027\221nm\240\254\370\233\272\254J\006q7u\355\351\241\336\032rz\242\340VBT\"\336G\247\357f?\201\211CTg\354\303\322\245\333\341\377\217\t\253\253\376\214\327\240U\336\326\334\223D\253\276\303\027\221I"
+	.string	"\233\376\210\272\254\362Ks#\352\032\200oz+\310\004"
+	.ascii	"\213\253\261S\350h\236\246\032A\242\266\265\241}\231\276\315"
+	.ascii	"\364\265\242lC\307\267\345>\222\233\351\241p\372\346G\374\377"
+	.ascii	"9VS\375Y\203\246\372\266"
+	.string	"\023\3637\346\212\332\316\023?L\373H\252\037\361E$\333`\031\334\017\037\344\245!n.D\275R\374\245\267z\316\330\031A\211\037\325:\006~\016\304\203\250K\232\250O\236\240}\213\337{J5O%/S\227TI\244\223%\275\322[=HI.\306\316\253\244\234\207\251u\021\006}U\225j\024u\212\367Q\235\202\366E\372~S:\351\370\210/\250.\251\346\232\221z\345\350\211o\001\2315\252\362\3413\253[T:\264\217G/5\366a\374d\347\225\332\245\023\251uZ\311C\215H\375\302\254a\203\367q\003\332w\370\r\247DC\0272\032\314F\327\327W\216\rE0\0339\2746|y\201y\3258\302\201\242\253\206\214\023`6\272\276\276rp%1\227\203\035^0fp\275\240\001#\313\206\214\0275\262\270\276pd9\210b\257\033]_Y`^^_YD\346\332\017\205\207r\202u\304\376\007+\370<uy"
+	.ascii	"\317\361\214\200P/\350a\374N\214\2171\002\2261\2369\203\366\275"
+	.ascii	"}\0250z\362%\320s\346\313q&\370\357#\007g*\215\327\275\241\343"
+	.ascii	" c\237w)\341t\316\305\270\246\215\321\215\033\264\357\3247\233"
+	.ascii	"2\320\323N\n\216o)\001\250\004\035\243\035\357\243\324\333\247"
+	.ascii	"\\\226\250g"
+	.string	"6\342q,F=Pz\307A!\372\030\375x\037\243\234\334\310])>\222\207\177I\030\376\377\220\260z\201\326/\210c\225\026<\206o\272{\003D\360s\3522\312\b\310\253\030\001\017<\202\267r\312\346Pq*\354\224\342S\214\202\b\031\r\031\r\241}\017|\357\361y\2746diI\006^\353[\320\254\321\2263\033\237\306E\336G\003Mv\344\332\220\2164\374\377\r\261\372\352\317\034I_\021\257^\303\027\221oxep\005^\251.\243\374\214\202\236T\327\254\234*\036\247.\2418R]3\016\252aah\337\002\337h\372bQ\346y\036\021p\340N\324eT\023u\rj\300\023x\273F\300\200\227\032s\266\242\225\003\201\004\250A8\004\025s\206DdD$I\222B\007\361\005\204\030\347\034\231\007\021\020%\205\316\314\204\231\024\224\244V\007!\306\245`\215\004\004@\005\272\303^X\0361\237\007R(YEO@"
+	.string	"\254\370\t\237t\222*@\364\205\25150\200\257\350\360\220\031z\260\021\241\334\347p\217\336\263\226\316\341\367f$\177\005\t\t*R\022\351\356\353\333\224b\326\276\002\311?\r<\324E\370j\033*\331\b\222\374\335\024+G\212\307\3232~o\210<N\314:\331j\261\220\236\025\204{;0/xhlYY\0026\215\317\r\334\342\312\230\336\314\037\323\225|\231\r\213\326-\274`s\316\2729o\030\021\203\342\017\220\217\307\020"
+	.string	"\036\216o\345\361\241\024\317\007\263\357\347!\325:d\260$J\0178J\244w\301w\312\216\3457/\366j\025\315\367A\220\341\016|`j\"\007\212\307\201\037n/\214\207J\216@7\332g#\002\363\210o4\267\0274\t\\J3\235\234l\n7\337b\337\351h\031\262\241<.\224\310\0078]\224\003\006\350G\263\034\013\314_\227K\336\212\325\345\013q,\316\250D\305&\2739[5\272\272D\305&\2739\253?\360\312\022\025\233\354\216\223\237\021\373\206SC;\325(\032\354\351\300O\240\370\365\274\317\277\364\0236\327B\203\007\333.\325h\335v\235,\213\031\f|\374-\377\355Uh\021\202\240"
+	.string	"\037B;\021\237\004>)\362\345\334n\bv\241\301\3400\211\217\200\2060\210\230<\020tg\021[\302aS\365\362\325\212\035p\020\207\034\304!G\320.\206R\213p\351w\354\"\344\036\360$\tYp<4a#\027@C:\202\262?\006'\035M"
+	.ascii	"\021!+\254A\r\030\023S\267P\001"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.149.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\323\0205U"
+	.string	"\312\221@ N0\222\322\031\016\265&\235xS\036x\201\370\226\364\267"
+	.string	"\275\351\f\b\306\270\263/"
+	.string	"\331X\r\345@\034\003:\031\213\201\261G\376\037\353\372\253\276q\023\377]}\215\020"
+	.ascii	"P\232\340\223\356\216Vu!\034\023\021*U\315\352(\f\033m\262\245"
+	.ascii	"L2\362\001\271\001\364\001B\002\345\254b\202xM\276\367{\371\261"
+	.ascii	"\374w'\362\361\376-\027\356\036\314^\017\"\363\355n\325\033\236"
+	.ascii	"\313"
+	.string	"^o\211^\264\226\364Y\031\346\275\313.q\267\316e\205tyr\320\342\326u%n\355\022\037\354\335\037\373,\327r\034\376\\\342\026\016\216+\337z\263\267'\0235S\360N \305\346\326\262\035)lp\342\3408\271\353\232\n\013\262\300\023\016\2065,]\350z6\267\232\t\2014\357\342\236\036\334\237]\301\362 A+\035\250\360\343Sn\367\343T\366\271:\353\232\326\3075|\020\211\036(\215\262>\354X_6\303\263MM\005(\357~\3566\3748\335\372Pt\\\305\352\226\334\255\353\034\212e`\356B\351\203\303\003\245\316?\027\315\217\023a{]\321n\270[\327\025\305F\r\037T!\300\217U\213\200|\255I\361l*\245\300Y\3279\251V\262G\254~I)\t)\304\221Q\021\321\220P\020\320\217\317\321\330S\344!\356\350\f\205i\020mV\367__\022N\355\250\345\371\255I3\203r%\347\223\234r\214\204\256"
+	.ascii	"\002g\205\363-\235(O\034\245\016w[\306q\210\363-\237<\217\360"
+	.ascii	"\321\013fNn$\234*\202;\021\337\022\356n\313&<\364\306\204\205"
+	.ascii	"\202\226\034\buR\243\345\315\371\226m\250\220\020&cw[6\371\007"
+	.ascii	"u!\367\266v\276%\033\332tvy>k?\256\251\261\021\314\231\370\226"
+	.ascii	"p(\262\007\205\332A\006#\347[\242\241@E\256\354\360'\022.\262"
+	.ascii	"\223\363\254p\"\323\216p*\315L\205\353\360-\215\024\341\341\301"
+	.ascii	"\240\\xF,Sr\212.\271\200\344\257\247,\211\"\365\304(\257w&\267"
+	.ascii	"%\024\016\242Nh_\206\234o\271\002*4\246\0054@\030\035\362\356"
+	.ascii	")\013C\221\353\272\376y&+\023c\026N\255\353\272<Vf\366E~\227"
+	.ascii	"\243v\377\335\236\263\351\260\251\232\237I4a\017[\270\247\004"
+	.ascii	"\024\301i\357\252r*\024\376\230\260\037D\022\261\376\362\340"
+	.ascii	"id\f\327U\214\200=\017GC\205*@#\375\030\215\364\301\264\007\240"
+	.ascii	"\343\322\006M\016O\247\257\315-m"
+	.string	"\346\006\320hs\325\205\251q?\255a\037\332\327;\372\205\r\315\237\023\214\003\203\306\322\222\004\233\271;yo\032\375\211t\310J\036\030N\177\"\r\240\311\242\336\275\243\316o\227\201\353\260\317\241\335\006N\306\206\220\332\272\256-\306\234\317\201}\333\203{#\007\177,G\372`w\004lh\340\234`h3\223\352\314\220\320\027!\225\321\r\366dSwF\214\343,\367T\214\206\321\334!\3124\363\222\357\027\3752J@0\016\\\027}@\277\377|0\016\333\227:3Sh\b\343\300\335\2710n\346\356\017Pb)\333va\267\310[U\344\305\240\310{\201\216\346\315\361-_\034\313{\343T\376\006\232\267F\363\322h\336\031\217\373\025\270\227/\325\235\277\214c\371N\335\312\037\343W~\030\277\373\2768\335\357\342Q\376\003\232\227\305\362\256\370\336W\305\361\276\001\024yS\024y\245\212\274Q\315\213\242y\241\216\274O\315\353\324\274"
+	.string	"4\357\211\3465\341\303[\242\310\333\324\274$\202xG\364\360\212(\3622-/\262y\227\232W\351\310\233\004\304\213\004\304{d\3445\352\341-*\362\022\375\360\016\371\360\n\005y\203\214\274@F\336\037#\257O\363\036\233\327\330\274=\315[\354\341\345)\362\022\217\274;\315\253S\344\035\032y\205=\274i\363\006\213\274h\3636\017/\363\360~\307\223\23302Q\236K\332\314\334\032c\252\004\265`\250\3573\335U\211\250)\360\307\226\2530\321[>\022\270\260"
+	.string	"\324\314\345\022\216LC\366\003M.pgKIT\264R/\241)\265N\332\236\032\232\334\331Z\221\032\316\374\260A\301\330\357\221.\215\255\351\341\250\243U4\331\232'\365\323T$5Wa\362D\214X\177\371 \265\216\340%H\217\032\251o\324G\335n\212\214\372'\250E\370\254\305r\n#pQU\340 }\260\250OC\323\016\356G\220\2049rd\263\023\365\323\352\374\230\310\020\242>\230\243m\232S\376\234N\2408\237\030\265\322\252\206#\002e\f\0332g0\350\013\272\252\257<\343%\227i\035Q\221 I\037\304\240K\254\235\345\350\013\372J\300\241\206z\216~\227?\245\220\246\316\314\0249B=\324\315&\350PY\030\266\t\365\311\214"
+	.ascii	"u\214\016ja\231\251\366i\2406r\223t\013c\274.A\216\364\274\203"
+	.ascii	"4F7]^`\235\337O\273h\034\3754\311\031^\264O\3774R\231\244\233"
+	.ascii	"S\373\320\300c\003\2543c\007\330dx\240\243RD\341$J\020\236f."
+	.ascii	"\357\314h\022V\366\234:4\232E\223\245\313cL\246f\251-\264\220"
+	.ascii	">\250\203\r\210\2676\307\016\302JNB\335\330\307\3569,\306a\f"
+	.ascii	"f\354\b\330\336\3749{z?\207\327\217\375P\243\213\335\323O\302"
+	.ascii	"\3609\007\354\261o[\225\251*aUI\372`\261\227\326\316\236\230"
+	.ascii	"\247Y\364\277<\b\2659\\\327\344\307\324%\303\344\373L\250M\324"
+	.ascii	"\030\370c5\032\231\354/\224\250@\317\340\035\031M\243\377F\273"
+	.ascii	"B\246\323\327J\211\315/\324\201\021\3438<\016\304\033\236n3k"
+	.ascii	"x`\034\330\206\r\261\177\200\345\265\241\3119S\2713\024\206\315"
+	.ascii	"|\220\026#h\204\315TeHw\232\253\356L\023\353\324\240\302\361"
+	.ascii	"\307v\032I\325:-d.\t$^+{\325\324k\301U\023\005\3015\240\253\t"
+	.ascii	"i\325\204D.`\304\332\302\321\205\345\005\302\016\036\037X^^Y"
+	.ascii	"\\\020"
+	.string	"`!\260\205\243\213\253\212\207\3251\003\254\253\346\302\272\252\302\342A\274:b]eqy\3358R\031w\274|t\260E\2653\343\312\307\226\025V\227P\227\217\255,\257,\037Y\031`%p\245\001VV\006\307*/\r\260\256z\270\252xPaiUq\315(\256U\324\007[;zXUi\260C\312GV\225\226\224\025W\227T\324\322nm\200\305%\345\265\265\305%E\234\003{\273\260\312,J7:G\237\235\235\220\225\374z\327i{z\261\313\022\344\022\276bE\357\024X\207\235\260\324\314\024}\243\321\247\362\355\213^\212\236\240\331F\251\2319p\227\274/\233>\274\265\221\352\247\226\220\332\226_+\215j\251n7Z\264\206wQ\215\243\331\303\237\263\005\357\274J\0238\024W\324\367H\241\032E?\211V\005\252Ch\246\371;S#F\231\324\314}j\216S\347\007\365\247fa%\210$\177j\304\372\353\301\034\244"
+	.string	"\"5s\037\367\224\243\314r\344\324\301&\013v\021\22176\260!\343'\306q\220\206\310\275\205h\3466\320N\315L\352\276\210q\234)\373$\352\223bc\250/\212S\023\3719\177t]\327\365\b"
+	.ascii	"\272}\302\260\301\306\213\271\023\r@\027\315a\347>a\260\234\215"
+	.ascii	"\027q'\244\350\362\3244\236\224'p\214L8\031a\016\211\021\002"
+	.ascii	"\207\311\003\226h\023\3157\314\3005\250,H\251\255\372\3054\250"
+	.ascii	"a\017B\365\225h\2515<c```\340\265R\246nj+f\234\231$ZX\321\023"
+	.ascii	"\223\350\207a\031T %\324\224\303\344\341,\022H\177"
+	.ascii	"\355\210&\321Df\234\335R\321\262\206\206\250\231\352U\262tD\337"
+	.ascii	"\215\004n\242\222\215\350\r\232a\376\234\005\260\b!j\331\215"
+	.ascii	"6\021}\030\232`\206\\\321s3\304\304\266\306\324\302\264=4hrN"
+	.ascii	"!5}\301\203f\036\2346`\034x;!\001\201I\250\221(\305\224R\n\221"
+	.ascii	"\214\210$I\222\346A\005\304(&)4\017\021@\265SN\315HL\205\306"
+	.ascii	"\213\236$01\f\021\34286qd\223\347\243OA\020\250<\207\2643\225"
+	.ascii	"V\272\233\007\236\007\217\302'L\357\354RZ\375\177\344T\355}\323"
+	.ascii	"c\030\236\177,G\340\244\251:\205\005\206\031\334\274\223\226"
+	.ascii	"\321\270\230\244\226Qr\366w& \243\250\334\312%\252Q\321-9b\311"
+	.ascii	"\003?I\2148]\362C\374\345B\241\227w\341\235s1\033\317\304\361"
+	.ascii	"\365&\242&3\t\b\230{\361FMh\256\f\177+U4\001\234\374\236\235"
+	.ascii	"\020\026\365\227\313\001K\317=X\n\343.0\302Y\352\260\266\351"
+	.ascii	"p\301\240\004[ &\341\306Ur~\rq\257\341\222\314\362\243\206e\233"
+	.ascii	"Q\250\210pIH\373\232x\232\205\227X\007\007|\265\353\326\372\031"
+	.ascii	"L{\204e\036\302S\367t^\306\236\033\303\363\2665\345\336\307\241"
+	.ascii	"\306u\006K\340\301\304\313=\021\221\244\3123Yk\302\374K\345\376"
+	.ascii	"\002\272:\025\312-\360"
+	.string	"\002v\276\003\250\214g\373~Z\243_\016#\310\375$\033\240?NFN!\313W|c\027\232\262\200u\312\303\371|`x\330n\231v\0025\375\017R\0250\177 \345\320\0040\277Y\003\277\237E\201\230\317`\367\363\013\264\034@\260emLc\276#\007Pt`\335\361v\246v\320\273\237\025\334;!\323\354fW\3151l\332\271\353\005\353n\3465\263\350\220\367\\?\350\313\301\313O\214\362p\306\222\230\313\371\007\240N.\005A\373\023\242_\301\251\334\027<S3\225@\262\322EUq)8*O\257\331<D\300\323\020\221\f\003^\006\354\240\250J\371\211O\002\262wU\243\372|A\007\372\033\n\031\332\373\356\223\236\021J\204\313v~D\006R\004\267`\377\003]\252\031h\223\207^\272\223\370\377\373R\243-\013H\300\n\177\240X\302k\234\351\273\366+\306\\\237\232:&\005\005\311c\004R\021\341n\234\247\207\036"
+	.string	"\0229a\\\r\247\312\252\3021\r\200\"iH\035\013II\036}\033zI"
+	.ascii	"'\314\220\323\305Eb\201Q\027\266=\240\201G&\023\361\321\250:"
+	.ascii	"\333\013\244\270\204\233\264op&\240B7g\266.\325?\257\017\204"
+	.ascii	"\274\003\261|<\311\365\346h^4\304\354\333\305?\254:\006\360z"
+	.ascii	"\212H~;A\025]\370\226\025]E\217\002D\373\354\370\271\371\312"
+	.ascii	"\020\206\002\207\260\257\004\224\357y;\0165"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.151.43ef1dd3fa501e1a,"e",@progbits
+	.ascii	"(\265/\375`.mmH\001\232(\246yR\020 Gi\215\001\027\356;4\242\343"
+	.ascii	",:\343\b\270S3\022\302\321Qg*\216\210\263\243\360\276\367\306"
+	.ascii	"\315Cw#\263\"pC\200\021\204h\247\271\016\364\035\220\177A\236"
+	.ascii	"\003\373\027\362\030\346f\212X)\372\0225S\330V\nB\004\242d\224"
+	.ascii	"\333([J)\005\013\0075\007\325\007\316\316\324:\373\363\350\354"
+	.ascii	"K\255\263+\035\235=\t\204\263#\3358\373Q\353\354\357\321\271"
+	.ascii	"\003[\347\006D:\367_\353\334k\220\316\255\246u\3564G\347\366"
+	.ascii	"k\235\033\315\321\271\373Z\347>stn3\255s\2279:7\231\326\271\307"
+	.ascii	"\034\235[L\353\334a\216\316\315\327:\367\365\350\334{\255s\203"
+	.ascii	"9:\367\227\326\271\275\034\235[\257un\353\321\271\273\264\316"
+	.ascii	"\235wtn\274\326\271\357\212\316\315\245\350\334[Z\347\326\202"
+	.ascii	"tn\273\326\271\353\220\316M\327:\367\034\322\271\345Z\347\316"
+	.ascii	"\202tn,\255s\307!\235\033\256u\3567\244s\273\265\316]=:\367\225"
+	.ascii	"\326\271\333\220\316m\245un6\244sWi\235{\r\351\334j\255s\247"
+	.ascii	"\035\235\033\255un\352\321\271\247\255sK\217\316M\245u\356\263"
+	.ascii	"\243sOi\235\333\f\351\334e8\316-\245u\356(H\347\206\202\343\334"
+	.ascii	"d\255s\217!\235[\f\307\271\237\264\316\035\206tn0\034\347v\322"
+	.ascii	":\367\027\322\271\233\264\316\355\205tn&\255s/A:7\027\216s+i"
+	.ascii	"\235;\311\321\271\267p\234[\253u\356\254\243sc\3418\367U\353"
+	.ascii	"\334VG\347F\202\343\334U\255sG\221\316}\004\307\271sh\235\333"
+	.ascii	"\b\322\271\213\34087\221\326\271\207\034\235[\b\216sS\265\316"
+	.ascii	"\035"
+	.string	"\344\350\334S8\316\rm\235\033\310\321\271\245p\234\373G\353\334QG\347\206\302qn\037\255s\367@:7\017\034\347\336\321:\267\016\244s\347\300qn\034\255s\337@:\267\r\034\347~j\235\273\006\322\271i\3408\267S\353\334MG\347\236\201\343\3348\264\316\315\204t\356g\353\334KH\347V\302q\356\244\326\271\221\220\316}\204\343\334o\353\354\036\235\2358\316\315\326\331\350\350\\\204\343|C\353,\343\350l\003\2163Q\353\034\343\350\f\243uf\036\235\207Z\347\345\321\371\0028\316B\255s\320\321\031\b\307\371E\353\374st\266@\353\\\201\243\263O\353\354\342\350\334\002\307\231E\353\254<:\367\264\316<G\347\025\255s\362\350L\001\034\347\235\326y\002Gg\t\264\316\0218:C\240u~\300\321\271\006\034g\007\264\316\r8:3\240u\246\341\350\274\200\326y\206\243\263\002p\234\023\320:\313\200t\216\241uF"
+	.string	"\322\371"
+	.string	"\255\263\001\220\316\005h\235\tpt\206\241u\036\300\321\371\205\326\331\205\243\263"
+	.ascii	"Z\347\026\216\316,\264\316\0018:\003\240uVqtN\321:\257ptV\241"
+	.ascii	"uFqtN\241uF\341\350|B\353l\002\322\371D\353l\342\350\\B\353L"
+	.ascii	"\302\321y\204\326Y\204\243s\b\2553\bG\347\022\255\263\316\321"
+	.ascii	"9\347\306\231D\353\374\201\007g\017Z\347\016<8s\360\301y\203"
+	.string	"\326Y\003\244\363\210\3269\003\2443\006\255\363\005Hg\013Zg\021H\347\nn\234)h\235'8:K\320:G\200t\206\240u~\240uv\340\306\271\201\326\231\001\244s\210\326\031\004\322\031\247u\376\200tF\266\316\036<8wh\235o<8\267\035\234\217\035\234m:8\033;8\027o\234\211\255\363\360\350,\264qf\215\316\301\242\363\033\235\275\350\334\177T\342J\022\227\262\270\254\357B\366\332\b\\\363\332\261V\264\272\255[\254;J\367\224n*\31527\007\365\224;D\311[\302m\245\333\270\257\260\r37[\363\0029\362\254\027\340fc\033\265^\273@W\031\022\201D\366\036\031\227\306\310\302\320\264 6\313U\214Mm4f\033\206\321Sf\307t\t\233\n{\337\327\246Yf\030\3146\315>s\223{\254\245\364YK\331\206\nQ\360\215\252\210\323\332\242\201X\326f\315\236B$\002\211\354\275a\263D%\013"
+	.string	"\261Y\017N\326P\232\035EF\277\317\227h\215\033\013\363\2767V 6\333a(\340\016\353'\315\026+\n\276Pdo\216\0333\264*ah\336\227\354\203fY\207\330,\223u\ba\263\304\306\0216\313\"\224\320d\327\201\245#2\"\342\260\230\314\320\274/Y\211?\322n\363\035s\341-\254\205\355\270\216\351x\216\3458\013c\3418\206\3437v\343*_\3416\266\302l\\\205\327X\215\323\030\215\251<e)S\3413\236\302f\\\306R8\nCa\262\024+\250\200\"\005\024N0\341\204\211\022H\030A\204\020@(\241\223C\342\003\017:\340`\003\rFd\200\301\005\026\210\250\200\202\t$\210"
+	.string	"\202\007\034h\200\201\020 p> =t\270i\2176\306\"q(d\203\357.\367Q\363\235\t\2555.]\2468t4s\021s\335\342`\234\304\250i\241\212\311\262\0233U\347t\324:@\272\272\274\271::\271;\247\272\254,i\324\272),uOqs\200ps\327\2679:\267\271\352\031\352\234\330\225\271\034\332\3168\315MY\231{b3\343\224\005\260J\026\272\265,Yjq\200im\206\032wE\233s\212\023\243\372\232S\334\3244\356I\372\006H\345M\355\354m\312[\01730NoOe\325\253\224*]\224j\026\224j\017&\303s\252>\245"
+	.string	"Cm\003\\\301\377\234\332\304T\350sj\313B\321\366\224\002\033\ne\234\330\304N\350\243\262e\231\300\326\343D\236\2111\272\022\370\234\306\324H\030\023\033a,\007\021\306\246B\030{\002\341\t`\t\257\243>\321\241>\311\312\271R\237L\221\240\202\001~p\365\340\216\n&\326A\327Q\301\2468\270n\260G\375\022\323\300\f\365\353i\204\363Q\275\3502\3705'\257,\f|\r\265\353\002\017t\352R\263\340\315\234\272\246D\360Q\273\236*"
+	.string	"\244"
+	.ascii	"\217\312u\235\340\216\312E'\001\225K-\202<'.1\b\220U*W\326\003"
+	.ascii	"\016\004GXB\003D\202!I\324\3401\r\323]+\271\321\304\033H\222"
+	.ascii	"\305\300\207@\247 \200!\202 "
+	.string	"@\f!Bm\234\240\007a\330\316\364\226\033W\301\0206\262\232Z\311\r+\377\240\346\004UC\3569A\263<\320Q\241S\035\240\317\033:')\300\366\215*u=\332H\271\331T\235\244\324\214nNRb\305.NRY\304\236\243JM\r\275\352$\365$li\373\217\f\342\326\230\326v\f!Bmv*\2452&\366$\f\314\311W\023\255,\254++$U\321 SP R?\242\240l<\325\240\341\3244\003\207@\300\2775j\322\370\241\341\273\356\201\371\342E\317ZG7'\227\005K\034\334\232Z\032\032u*\2452&\366$\f\314\311\227V\026\026\222\252h\220)(\020\251\037Q\302\032\226\250\364\220\033PLOa\rKT\2148\226\2045,Q\0011$\t-\002A\017D\320\372\203\025\024\t\342w\203C)(\"\213\035SK\333\235p$\271\017U\274\357\313\336\204#G\263\262\231\213J\230\205]\314\022"
+	.ascii	"\0135\210O\037\003\365G\214\301g`\203}.a\360-\247g\301_\200\203"
+	.ascii	"Mb\221,\370\016\254\252\340E\274Wu\260/`0\320\311\203}8\243\242"
+	.ascii	"\204\315V\360-\355\002L]\005\372\361hV\021\202\202gv\253\202"
+	.ascii	"k\\\253W\263v^P\215\213\345j\271I\232\306\214i\342S\360)T\237"
+	.ascii	"SI"
+	.ascii	"\036\350\255g\204\n\304\004\337\323\240\237\013\3555\321>\227"
+	.ascii	"\251\367\242y\022\374\004\017A\232T\260\214\3335&H\306\t%\276"
+	.ascii	"\357\033\304)\204\210\260Y\t\336\257zbH\036\310c\310\334\341"
+	.ascii	"\274\0210\355H\276\245\355Y=\300\264\220\341\342E\311\323\260"
+	.ascii	"\210\2679\020z\364\035\3117\023T\3225\310\347Z\031q\0369\"l\326"
+	.ascii	"\243\337h\355hb`\246\236@\345\370\020\001\230-^\234U9V+\342\323"
+	.ascii	"\261@\360\021\274W\261\202]\234Zm\306\354L\022\314sr\245\210"
+	.ascii	"\276\357k\242Y\016\336\005\361\234]^\316\257/a\263\020|\233U"
+	.ascii	"\211\331\350\226r\305\331!\035\370\007\266\270I*D\275\315\316"
+	.ascii	"\215\312\261Nq\250\177\340;\352\035x\2572\001\322\350\226rU\355"
+	.ascii	"<40\347\004Cau>!>\235,\213\313\224c]B\001\347\265fWz_$\f\230"
+	.ascii	"\235P\234R\274\233\032x"
+	.string	"\032\250\224\376\210}F\267\224\253\315\256\003\003nW\216\204x\006\314\202lUB\224\371z\336\200Ps\241(\320\334\250\234\250\377\300y\020gA\351Y\220\212SJu\246\245\t\233\305ir\305\347\227\324\254\242\375`\346BMX\2458\327\234l\304\247\343@\376\207\3674v\266\005\311\210\210\357\253d\202\203b\3011g\365\315\031\027'l\026\371-m\027\230\\\361\371\333\254\342\350!\314\211/ux\017^Y\234Z\274\233\232\355\360\007fs\363=\rv\271P\024~\304e\346\371G\334\376\3157\023\240Vp\3139\307}\305\316:\247\026wj\0216\333\246\351\226r}\331\0319\210\345\344\342\335\304 \004\257\234x\334W\315\262\263\213S\317\273\t\211\013E\021u\231r\364\212\\L\354\236}E\020\326`\021\027\332e\321!\316/\316=\342\263\253-\355\336A\225\242\362\013\363\374#\036\n\276\357\220\024\335\326\035&\212\007\362"
+	.ascii	"\024P\027f*\254\247-\305)\206\214\323\214\026\032\273\245?\342"
+	.ascii	"\026\274\253}\305\351G|\337\267\233\270\333\234j\234\177\336"
+	.ascii	"M\334W\3328\r\334\362\013\243\364G\334e\232U\020m\376\370=\r"
+	.ascii	"F\271I*X\325|\270Br\242c\"\230v8\003\2179\216l\304p\r\213o\374"
+	.ascii	"\236\006o\270I]\267D|v\223'\227\251\257\314 >\373*H\303\025\222"
+	.ascii	"\302\332\320`\223\353T\203\370\354\246\340\033\365GL6\\\036\302"
+	.ascii	"nj\326\370E\250\240Rp\311\305\021\354+vu\270<\204<\204\315\026"
+	.ascii	"\037\204\036\024\222\007r_\273\245\\I\204$xO\203HnT\227I\021"
+	.ascii	"\237\315\340\353BU\260\006!>el\320lO\037\320\025\222\023}\337"
+	.ascii	"g7\271D\210\317\nl\320,\263k\304=\342\335\3043P=\377\210\373"
+	.ascii	"K7\327\224\335\221\3771\223%\265\313E)\261o\344\323\360\253\301"
+	.ascii	"\362\324\307\217&\216F\031~3pMb\370\307\274\325\315\270\362\363"
+	.ascii	"\271\005~\341\007S\005\334z\251\254\374zW\376\266^*<\376<\276"
+	.ascii	"\352\374\265m\341\347\302W\242\025\277\255\227\252\216\337\216"
+	.ascii	"\257:k\240\330\344\370\347\340\252\304\361c\341\253"
+	.string	"N\037\324\232\033\377\033\234Z\033\377\025\276\352\234\201J\253\302\317\006\207\226\306\257\306W\0353P\324)?\025nz\306O\205\257:e\240\244e\374f|\325\341\243\002\205?\n_u\256pgb\374c|\325\331\203\232\002\306\037\006g\326\204\377\213\257:]\240\312\272\370\231\360U\007O\212\022~.\270(Z\374[|\325\271\203\202\362W\374X|\325\251\203c\262*~$|\325\241K\221\003\377\021\276\352\314A\255@\204\277\b\234\nT\374B\370\252#\207\342\241\374S|\325yK\341\177\360K\361U\307\r\016\005\037\374P' \331\301\317\303\204*\034\3749ND\237\370m\230\b\342\304O\243\004)\034\370g\220\360c\211\3779\002\324#\361'\211P#\220\377\r\301i\r\373\037\bM~\354iJ\314\3158\303\336\247\003H\206\275L\316_\030v1$\326\354\261_?P\343\205\375\213\007i\272\260[;\360\273c\307\343"
+	.string	"\215\026\366-\033\360\321\261\327i"
+	.ascii	"&\013\273\334\b/p\354q\031\350U\331\3350\250\263\302\336v\001"
+	.ascii	"\335\032{\025\013\262\240\261\247\211\210\223\262O+P\233\302"
+	.ascii	"~F\001U\n{\331\004T\310\330\241H\360\344\t\273X\004N\234\260"
+	.ascii	"\203A\240\345\305\336\344\201\253%\354]\016T%aW\322@4\213]\213"
+	.ascii	"\201 [/\225\025\373U\210\251\255\227*\312^\005\002j\204=\007"
+	.ascii	"\276\346\250\341\fa'\302\327\2344\270\017A\330\251\220?\266^"
+	.ascii	"*\007\302\016\345k\316\024\017\036\305\376\243C\226&\357\301"
+	.ascii	"\356\203\257$\002o\\\007\373\016\276\222"
+	.string	"\350\203ko\260\3438\202\331z\251\274\006\373\223\215\027obw2\352m\275TL\3548\360\225D\031\250\242\022\373\022\321\217\330\221\370J\202o\b\310\035(\234S\303\275\206\225\333z\251\320p\373\301\005\315p\237\341+\211=\250\367=\352\251o\327J\330\354\030n2\036\307\307\035\246\341\266^\252\267\0030\334{|%\276\357QOq\273V\302f\231\231\231\233\314\327n\2527nm\353}\337\016\232en/\314|\025A+\255\311\373\036\365\02433s\223\371\352M\357\373\276o\007\315\022\237\001\262\244'\016\310\314nU[]+\342\373\276&\270\363\272\213\213\305}\325,\273Zn\022\357\246f\271\335$\302f\211\037\201\253._bH\036\310\302\037\376\020\217\t\020\311\003\231\331\345\352;\267\213\370\276J&\270\2674\027\327\213\373\252Yv\277\\0\357\246f\271]0a\263\302\027\256\271\312\363\023C\362@\266\300\231\3351"
+	.string	"x79\220\327q\212\242\362\013\223\364G\314dI\335i\204\004R\t\276\021f\356\376?\"xj\376\2150337\013B\366WH\361\242\344ix\002g\262\346\252\220\371\005\030\274\233\330o\251\222>;\245?\342\340{\324;\036\023 \222\007\362\003\376\317\034C\002\204\335\024|\021J\177\304\334o\235\205\327\270\257\270"
+	.string	"\254\346\335\324\354\177+\271\222\373\202B\362@\366w\250w<&@$\017\344\007\274\2379\206\004\b\273\311_\204\322\0371\367[\303\361\032\367\025\317\300j\336M\315r\263\232\260\331\376\226\366\007HxaSO\240\220<\220\231,\251\203\357\373\276\376F\230;\370\276\357\313_\204\371\306\331\221\3348{\264\305\232\035HOi\366\250\246\322\354P\354\354;n\234]\307\215\263\347h\235\035G\353\3547\220\316n\243u\366'\244\263\327"
+	.string	"\341\3544B8\273S\353\354MGg\237\321:;\016\307Y\210\177N-#4ej\244|\277U}\217n\251\223*"
+	.ascii	"\242\370\365\021w@\371\2162G,\343\3242\002\2042\206\354\273Z"
+	.ascii	"\365:\332T\214\205q\241(\242W\243:#-\304'q\206\330\367\030\027"
+	.ascii	"\342\027\247\226\222\230\336\223\3575\275\277\321-u\302\226\""
+	.ascii	"\254\013\3360\r\330w\030\036qK\023\230\235\223\357\352\327\030"
+	.ascii	"[a\311\267\327\367\327\367\224H\347d\3522\253\\^7\371\376\212"
+	.ascii	"sj\365\325J\202\b\327\304j\274\267\256k\362}\325c\362\355Uuj"
+	.ascii	"y\225x\245\211\345g\3266\263(\223\367j\025\327\367\022\243.D"
+	.ascii	"6\247\226\237\261\022\2534\261\374\032%\2565\2234\1774\271\274"
+	.ascii	"\213\225\353\375\214^\232\222\367.\337\344\245B\022\252t\250"
+	.ascii	"\266\365\235\304H\2178\205j\213X\246\365M\367L\335R'](\262\276"
+	.ascii	"\247\304(D\262\241\023\254\357\254/\304'9`\201]}\313U\275R"
+	.ascii	"\222\024\254\276\274\206Q$\337V{\304%M\253+$J\252\276\337\376"
+	.ascii	"H\n\205\350V\326\220\307\221\357(\037\321\312\251\245\344HU\016"
+	.ascii	"\337oz\200\335R'>N0\362=%\036q\241=\205h\304H\214\021\031\342"
+	.ascii	"S\370W\344\333\210\221\031\342\220&E\210TD\276\351\324tK\235"
+	.ascii	"\3600a\310\367\2248E\004\"\364\"\344{\210Q\0371\252i%&\204\350"
+	.ascii	"\203\352\373M\017M\267\324\211\216\023A\276\247D\036D\035B\270"
+	.ascii	"\251\357 ~\304\033eSO\320\357\267*3\177&\200|O\2114\210MB\251"
+	.ascii	"\3247\020#5D\246\246\325T\212\270\364\343\273\2527FM\tQ\337S"
+	.ascii	"b\222\013U\301J<2\3723\n$>\205`P\337QGC\300\246U\025\2505>\276"
+	.ascii	"\253U|~$\364H\203Fx\204\307w\217\244\241\0317\036dv|\313\201"
+	.ascii	"\351\033A\207\030>\0379\276u,\r\301\310\345\360\202C\317\214"
+	.ascii	"\b7\276\247C\3530O\310d\343\373\006\323\220\313\026\033Z\236"
+	.ascii	"\276\335\252\362\310\204P\243n\256\f\215\357\0323\206X\234ZV"
+	.ascii	"\032pN\337oz\\\304\200\320\364=\035\272\271\320.\033^q~\311\261"
+	.ascii	"\262v3\276\233\234\206lM\253\353\2145\034\276\345\354\352J,}"
+	.ascii	"3}O\207inR\233Y\251\315\0326\210Ov\312\364\374f\3021\244\202"
+	.ascii	"\346\371M\247'\246\364\275\244c8\005\215RY\322\373Y\225\317u"
+	.ascii	"K\275\342t\220\242\270\320\024dM\036M\037\304'\333\244\217\276"
+	.ascii	"\221\242\206O\234ZM\300>\372\342\020\254\337\357\267*(,\335R"
+	.ascii	"\257j\216\373=\035~\r\275X#\316w\245\206K\224\234J\232\337oo"
+	.ascii	"m$\214\266\\\350\n\321,WH\216\225\355Q\364F\320\241US\321\027"
+	.ascii	"\305\252n\370\256\352]\031\373@\306\021\027\212\302\210\313\224"
+	.ascii	"ce\233lx\031A\206C\232VD\341\227\363F\223\313\206/\016\251\210"
+	.ascii	"\276\257TA\261uK\275\236x\260|\346\307\370\236\016\247\206@\330"
+	.ascii	"$\030\037\203\3040\252i\325rPW`|\313U\r=s\330\243i\325k\242<"
+	.ascii	"\272\314\320\367\232\013\374r\250\243i\345r\326\367}M`n\n\031"
+	.ascii	"\346h\022\231jry\365\002\357rzV\2067\204\336\253UPj\335R//\273"
+	.ascii	"\016\202\276\247\303'\027j\302:\244\241\006\350\203\2063\232"
+	.string	"V=7|\016qhb\365\225!S\221&W\253\005\201\276\347\206J/\276\325\250\\\034\270\370\n\374\317\367t\2104|\305X\340\177\376\326\250\261\200\317W\300\017M\237\022\237\026\357\302\214\216\260L\023\313\361\310(iry]\213w>1,\336\353\250@7H>\317+\371\234L&\204{A\275\236WziZ\365]T\257\211\325oVk\265\347\373n\305\363\3445\255\334\314\212\327\304\352\277\350]\237Y\361nF\201OniZy\027-M,\247\263#kr\271\034\005\336\273\320\355\274\313U\231uK\275|h\360\200\217\300O@\316\311t\302\212\305\311\224S'\201\237\300[\323\252\363\242nM\254\226\263V\335\242\022\370\316\203\300G\240\255i\345hV+M\254\016\214\262\365\032\b\274\243\351\325\360\017XkZ9\237Z\023\313\361\254ijM.\257\213\326\360\316Gu\300{]\025T\224n\251\027\216\0213<\r\337"
+	.string	"\351\231\033\003\276\001F\204eM\253\306\223\322\304j\271(U\006|\343-\340i8\"$kZ\371\331X\023\253\001\305\272o\001\357g\n\370\031\232U\302\260\246\225\357\2015\261\374.\312M-\241\223f\022\242\360\313)\327\344\3629k\327 lV\001\357{UbB&B\257\032\270\257\270\331\325\364\362\0226\233\200\3679=\25015\031\030\340\021\3602,q2\251 T\022\224\306\3602h\021\365\2365\253\t\326\r\214\331\263b]\305\360\275\247w\200G"
+	.string	"\022\"\227\253j\2029N\224=k\364\310\001\336\345\n\360\0060B\364g\321/a\221&\230W0d\317JdH\001\376\317\252\302\314`\340\302\017\340\t@\345d21\345&\345X\203Q`x\002H\271]}\367#\307^X\024\024\f\337wU/\374"
+	.string	"z\270]\216\026\345\221c/l\207P\307\013\357h\002x\027\2048\334./c}\"\2741d/LhC\370$\200\3672z_u\027\250\370"
+	.string	"|\013\337S!\r'\323\211\250\260)\370\305\302\267@B\310\344v5\236\365\251doK\270$Tb\341\033\017"
+	.string	"\037"
+	.ascii	"!\222\333\345j\3211\341Q\224\275-\341\033\b\200w\265\252\024"
+	.ascii	"\257\342\317\355\362\276\350\030\273\246)\305#\330\262\267\245"
+	.string	"&M\212\367\276*+L\342,@\341Q\374\n\337S\026\215\223\351\204\326\031#*\374\n$X2nW\347\215iJ\351\006\242\210\t\243\302w^\n\217\"\207\275\272]\276f\335kJq\344\0260_Rx_\323;\341Q`\026\217\325s\273\374/\372\276J&07\241\260\326\246\024\237 \307^\021\266K\2367W\205\315\236\360\376We\205\253M\204\t\\\\\350\nV-M\263\346\031\361\031\344q\342M\220\262tD\335@\224=\2529\271\023\337t[l\025\230\300\002\347T\302\233\240\262\3255W\332J\300\352\2262\031\263\243\200\004\266\265\340\321\bOB\032\213\266\005\f\032\352t\204\357\267*$\335R&O\354&\020\201\212\013=1\005M\b/\302\032+\305\355\352\020V\300\224\231\n{_%\023\355\306,\304Fi\262\r\353\306\326\254\302\336\3675\241Yf\311X(\315\266j\363-N\330l\b\337nzG\300$"
+	.ascii	"\341{\312\212\271\320.\013s]\262\022\017B\026\366\313\213m\322"
+	.ascii	"\234\253kj\321\"l\266\204\025,\265\257\"\021\350t\271\320\024"
+	.ascii	"Q\256\327\312y\235\367*\027v\313\355b\263X\255&^\263KS\257\251"
+	.ascii	"'l6\247\nV\232\237\230\220f\025\020\220\370\236\262W.\364\004"
+	.ascii	"\213\304\311\224c5\302\334\374\302\036q\255\210\254\0216\207"
+	.ascii	"\346\036_SLS\214\260Y\022\037\242Jl\252\353\201\016\376\203\357"
+	.ascii	")K\304Mj@++\304\025\322\327\357\341\301\177@\206\235\202z\360"
+	.ascii	"N\247\307\301w\360\020\3145\315\260R\315>6\212\375\321\364\343"
+	.ascii	"\246\232\346_\363O\330,\007\357\201S\302\2708\320\316#\341\006"
+	.ascii	"\337N\244\350)y\032fn\006\262"
+	.string	"=\234G<6`\201`M\371\222j@\203\357)\253\303\205\236\210naq8\327r\254_c\304k\300\326`\237\234ZI\316\245%a\263#>D\025\024T\267\224\t\017;\006D\374\005\237\301\367\224ur2\245\210:g\020\237\237\304\316p:\345X\235\001\254l\221\\*c$wlX*%X\0061y\222,v\202\2300\222\017p\317\b\021$zF\fy(\004\017\371\330\220t`h\207g\371\201\207\224K\030\314\244\222E\261\005\214\025\312\036\033V\302\370I\306\330Q\376\364\370\3540\203\\\f\365 ;\360O\020O\0203h)\264\363\202Hh\007\207_\020\t\355\364(y\200d\f\001\301\330Q\016\301@\362R\331\343\023#h)\264c\303\362'\351\263T\016}\330Q2\2231|\230<\311\035eO\320\213\245O\022\002\036\372Q\002\001%]\360\354@\220\374\t\022Z\362,\221\374b\231\334a\016-}X\354"
+	.ascii	"\005\355\374$y\030h\221|\321rr\305\r\363\360$[\276\301\305\016"
+	.ascii	"\013!\233\0177|\203\013$\b\276\301\205\007\026B?;\312e\222\250"
+	.ascii	"g\231t\361a\207()\243\345\036\240\344\212\236\244\262\247\370"
+	.ascii	"\002\306P\217\217"
+	.string	"P\313F\036\236\344\215\222\b\207\201\202|\230>C@\311%s\247g\231$Z\006\261\350Q*Y4\300DI\031;=Jfr\331B\311\004\362\331Q\016\301\300\331\031Z\221D\366\374\004\271\030R.]0\033`eO\320\213\035\031L\237\030\311e\213\035\037&P\362\303\002\200|\016\300\004@\217\217\020\262\307G\350\206\205`\364"
+	.string	"\371\020\371\264\314\202E\020\023\006\217\013\036f\020P\007\242\244\214\016|\203\213\035\021>\210\200\3037\270\330\001\222\321\023\202op\26134\224\024\"\n\372A\356,\225\314\037\037\026;/\226Jf\317\007V\362"
+	.ascii	"%c\364$o\030\310'\331b\307\206\201|^\354\364\b[$_\374(c(\177"
+	.ascii	"\210\2222\206\334\002\f2\270\340a\372\b\025\271\005\030d\370"
+	.ascii	"\371\tZ\022y\210\351\363\302\347\347(\344"
+	.string	"Y\022\271g\004\211\"\017\361,\213\314\004\362\t\022\262@R\271\\\261\223\024bv`%3\271\334I\n1\213\034$d\203rg\351\202Y\344\036\237\027;K\027L\"\273\320Q\376\370\260\bZ\n\355(\231\311\345O\320\222\t\024\304S\202\207E\006CCJ\236\240\245\320N\217\217\320\007~\021\004\244\354\331\341\001\222\341A((\350\247\310\313\240! \345\fL \345r\t\203\347\206Y(\227\314\344\212\030D&\001cD\221\225-\222\314\237\240\030??J\036frE\f\017\314\344\212\0306\fc\304\363\013!\354\360\360$\207\3343\202D\317\b!\037\331\206\0216\200\300\262\362'\3113\264\023\264\224\321\302\306\206\344\213#+\177\230\314\240\245\013&\220\317\213#\007\3710\223K\0212\020e\260\341\236\021\317?\311\030K%\023\310G\004\f6\254|\221\004\022\301d\221\\\262`\303\312\027>L\3462\311\034\022\321\"\310"
+	.string	"8,d%3\331\303 \350\204\240C\2020\311T\006\300\206\207F\210\350`h\004\007\"\206F\210\030\032q\303@A>C>1\224\313\017\314t\321\302\347\207\005PR\371\303\302\221\207F<+\205d0E(\227I\242\027K\037\027n\230=\316\004\202\201(\310"
+	.ascii	"H&\020\f.Z\370\f\200\tC\210\t#\206e\0203\350\305\007\0260V|\222"
+	.ascii	"\231l\241\005\220\217\013fP\320\213\031x\226\035\230G\307\206"
+	.ascii	"\240\025\026\340I\376\254(\001\344\223|Q\202g9TB\247\002\016"
+	.ascii	"\022R.K0\203\202\226%l\230\231\311\220\372\213p_\325I\235\255"
+	.ascii	"\005\273]aK\233\270&.\354l\355\271]\241\357x'f\366\035\317*\220"
+	.ascii	">\211eD\351\2266\262\365\232U|` ``\217\353\370\"\256U\207\250"
+	.ascii	"\r\021\276\366\034\357:\376\253\317\251$\267\312F\210kE\264\241"
+	.ascii	"\362\034\377[\326\240\231z\322}fxQxp|Om\246l\200\264\320\242"
+	.ascii	"1\233(\256\206\210\366\234\025\307\207\360\203\256xz\277\361"
+	.ascii	"=\265\361\341\254\352\264\250\r\217\"(ER\210\317\366\265\361"
+	.ascii	"~\303\314&\207S\313\3067\236^\215\367\2473\233\033N\255\032\357"
+	.ascii	"ig"
+	.string	"\242\222N\3574\276\2476O\316\252>\243\221\307\364Gs63\212\352h|\337U\211Im\230\212\250N\357fUd\272\245b<(\320\364=\265Y\262\332$\025\245\255\021\237G\264\031\357Ml6\357\214o\272\2520\335R1\035;\317w\034\276\247F@gU\233\035\313\214k\216YLL\3578\264\031\375\230\226\336\237Uc\337\322{\331^\340\004\224\276\247F3.\264\317\242F2EoEq\304\347\221\207'\275+e1\206iZy\322\367\234\227n)\330\237\235\004\034\351\n\346\2104g\324+\252#\276\357k\202\215\326\242)EZ\210E\302f\035\351\273tK\301\324\330E\300\217\276\247\306<\343\235\r\032\032\250\212\270\030\265\024\341\325\031\355\212\272\024\351\025}\371\"l\326\217\232d\375}\335A\300\337\357\251q\316\230\305&\360\3755\276\031\341\232V\334W\\\264W\304W\304'l\266\003_K\267\024\214\214\335\003"
+	.string	"\253mX\376\276\001\305\030\253\020\255\375\255\371\242kVQ\303\232\357\2511\315H\265\231\252\371^C\306H\205\250\335\316\212\324\364\225)j\260d\365\371eq@\232\357\251\261\314\030\305\206\211\337w\0323\3061\267\253\345\304\212\324\264\333\023\2771Y}_p\r@\003\366eS\244\357\033M\237\221\211\333\325oV.\3623v\025\251\351j\364}\225\316\214K\372\350\262\316\370U\031pF\211\013\3552\343\226\r\0163\337g\212\376\214XWf\316|Y\241\241\f\222\350\0312\337e\212\002\215F\212\220\361[[\300\230!TY\304|\21792B\201\2101\2036C\230\357\251\361\207\013m\264(\224Q\222\321\022\361i$\343\373\016\303d\344\261\203\257\214T\001\327\357\2511\207\361\2061k\357\373:\303X\303\350d\244a\344T\303\310\206\215\2752_S\022"
+	.string	"\346{j\234\341B{\212\221\311\b\207\221\016\342\323\350\343\3137\030\036F%#\2221\311\310G\224\221\224\324\2270Y|~Rd\360\362=5\276\200\306\031z\337^\240E5~\3054FA\204\030\021!\"l\266\365\256~d1X\373\\\350\nQ3i\272|[\215\024\307\270]a\212b\214\216T\031YY\t\233\355.{O\020\220w\005S\004\203\367\235\367^\305*\352\271]V<\027\344\262\27289\300\335\367\264\230W\274+\332q\371\276{\257>\351\326\232\312Mo\371\346\362\375T\222\344\201\334Z\276\267\274\004\177\3170v\337Z\276\265\212vDt\305:\243$\\F]]\302f\333\256LV\227//\003\314}\327\311\271I]\206\245\230F\367]\347U|s\243\373v\223\373\236\373*^i\223K\223\205\347\267\244"
+	.ascii	"q\337Y\276\247E67i\205\342ZQ\f\313w\026\260\"\032\025\313\367"
+	.ascii	"\025\270\357\270'E)\025\270\027\260d\335%!\300\333\224\262\342"
+	.ascii	"\225\333\367\333X"
+	.string	"\021\n\231\233\225\254\273,\030\252b\326bX\021\352\312w\025J\361\253\311\225:\253f\025\003`\373n\373\236\026\231D\213K\214\244\030\231\021\237\305$+\337mg\305$[V\276\337\364\252|\263I\213YDXU^(\223E\027}a\355{Z\264r\241)\252\234\3161j\337k\324b\016DF\324\252d\315}\031q!\215\210\220:\264\357\264\264\342\024\024\315oH\263\n\001P\277\247E\251b\024\021m\372M5Z+\366(\362\230^\311\222\013\322\254\242\005\351\367\264\250\243\210C\214\312\267\224\255\370T\243\251\270e\275}\001iV\301\302\331\367\264\350\344BOX\2133\210K\246|\237\265\025\237nWQ\251\270dd\364fd\024'l\266\247\210e\271\371\211E5\253\b\200\331\367\264\210T|\211C\312\276\315\002\207u\250\303\300f\221\210\250\307\020C\"#\"\222$IZ\003\203\033 \b\307\2014Neq\003\023"
+	.ascii	"\204\307\307\244a4N\364 g\030\204f\247\240\322\001\213\251\270"
+	.ascii	"\200H$\364\016\241\345~\254\353\233\212\201U\231\255D\246Ur*"
+	.ascii	"\215BM)\353\2603\347\342\307\003!\177\226\327]\346z\016n]\006"
+	.ascii	"\2037\344k4\001y\325\025t\201\325\262\243\302\205\370X\352\230"
+	.ascii	"`\215\250\211V\332Q\023'\261%Us\265\310\017\322]\305\003\354"
+	.ascii	"\202P\212\254\271V\357\305sQ\217\232{P;\214\305\322\354\300~"
+	.ascii	",\214\246\350\013\230[\356\252g\366\354\202\213V\366\356\272"
+	.ascii	"\305\3226g^VD~t\343l\261{Q\016:\025\033J\363\265\311\351\266"
+	.ascii	"\023"
+	.string	"-\025\003\266\205^?\177\334\302\003\227X\213\333\315\030!D+\216\342\203\346\005\272\f-\227\244\027;*k#\373\316\037'\354&\362\275\022\213\354\007\366\231l\326b\013E\253\271\321\323?\373\027\"D\337\270\272\250.\245 o\354E\2538\236E\r\320\321\263e\2176\321]La!\022\f]\277\200\241k\303\244\350\206\030\347u?7\303I\232\305/\346\f\007\016h\017\256\213\242\236\325$3\003\252\241\353\030\2115e\330\260\013\3653\025\r"
+	.string	"\027T\275WJ\033\002\200\305E\017\341\234\236@)\222\026$\255\243L8\332d\322\332\006&ic\201\255\306V\225\b\266(\177\376\362\303\307\242\240h_8\240\323\311*\361H\276KFJ.\f?DF\315dK\245\365\314(\250\021Cv\257\216x\305\370>\331\300\263\024\242\231\365\026\037\364\263\223\256\250R\351T\263\220\235y"
+	.string	"\235\276\345Q\340\t\225\247\200\212\275\2224\246\273T\205)\024\024\205!\bX\016g7\204\354f9\233\207*\323(\b\005\370\344\245\256\231\206\253Q\353\2035NQGf\006$\300\221#\3649\355\345\263\370\376h\360\362\211$\340\202\237\230\336\343:\226\034\374q\346\302e\024\331\300s\346\022\335I\230/\310\304\023\363\202j\275T\264\271\2539\315X\232D\234\317\262\004\020\344\231\337\031\311\254a\372Y\001\226\r\224K\251\003\003\016yY6\254\017\352\017\016\343\325<\355\024:{_\324\223\034\233)\235Y\tI\006W(\030Rg\246\2364\355\001\240{\004B\350\374L\236u\007\207\b\247]\001\366\037t3\002\235 \270!\370q)+*x.\337\364\337\nfii\347h\236Dd>\005\256\243\007\305\353G\231"
+	.string	"\225w\207\0016\274\364\212}\022\326K\262\352\245f\027+89\2004\261\337\246\360w\235V\317\toE\253#\273\337\013\030E\353\223/\244^{F\333!Qv\305\206\314\270\003\b\346c\262\224z[\255\221l\334K\226\355|&\"\301]\240\005\347\306\020\324\346\346\371\t\365zQ\343U\356\366\026!\236e?\222\334\371\257\264\370\200\353\334<\301\254\307\364\n\376\3440\027\321\370\341\302\367\001`\305\325<?\311L\3322\320\004\220\331\244\001\036\024\245\301\023\350\027\262p=Ks\365a\035Z\340(\301\220\250&\007,\306\214\260\037\353\016(\321{\366o\034\237\313\340\264\274Z\222C\t6\202\267DO\347\265\323%\226\344\021|\350N\033\254\377k\352\236YW\263u\341\274\215[V# \340\311\321d\311e}|\303"
+	.ascii	"c\371}\266\235\333\216^\277z'\233\2000\254\212\270g^\177\250"
+	.ascii	"\3235\013%\022 \313\207\340\263[n\255\221\177\357\237l\231\315"
+	.ascii	"\356\003p\225\226\032\247"
+	.string	"\3627\223\351,ms$J\322\343\366\260\206\231f|u]\303\tN\t:\003\277\n\232\224\375%W4\026=\026\"\355\224q\327P\001\321R\026\323\265\252\364\276\312\313\002\267q\260\177\325\367[a\231\004T`\251\210\267\240\313*\267nZ\373p\333\006\375\177G\321mM\224s\365n\260\213\256\3372\360\362\374\340V\372}jx\3465\321t\233,\026\313\253@_\024\222\276\237\255\026\315D.\244\231o\205e\022P\370E6\027\375\371\021\272\222e\005U\372\\W\332xO\005@\t\357\020\235\243\231\304\004?\214\032P.c1]\033(\362\347\b_P$\212F*\342\"{f(\235A\027\2408'\315'\221\334\235Z\354\271\032*\274\266\235\212\222\216\222\244\273\365\203\337\016\265k/\037\370e\317\377\217{\222\362\256\336\r\366LM\0019\303`\r;\230+\272\031\347\031\307x\252\243\321\247!\375\346\315\345@\257\256L"
+	.string	"\342I\3228_\237\207\227tR\274x\330\304H\007T\235K\374a\364\305t\362\2371v\254i\374\343Sd\302\013ab(\250mJ\261 \230k\265s\222\036\224\252\321H\030ez2\330k\266F\333\231\352\273\334@Rq\034el\212!\247oS\270\224\037\031\365r\024\341\343\032\236\004\304\327b\261L%\203\370\2553\032 \252\241h\001\316<\371}\346\247\307\202#\257\r\230\f2ny&\036\b\261*0b3\367\373m_\223\t'<\224\032\3178\311\276\303\216\332\211\003\310\032a\276\3129\037\006\210\242`\031\371\312a\350NNh\263hh\3500u\007\343E\361\253\235\t\231\272`\330\033\367H\003U/\304\350@\r\257Dq!\020\227\025p\243\225\276O\001\n\367\265\371S\261\025\360<R\260\311"
+	.ascii	")\277\001X\017\202\037\311\240\253#\007\340\234@\232\205\202"
+	.ascii	"\354D\345\355\265\f\373\226\301\3136\3305\270)\242\360\356\301"
+	.ascii	"\267Br\320\222B\247J\366\304k\337I\330\313|\325\244Mc\223\240"
+	.ascii	"{\022\217^.\317\310\212\316\376\201\346C\374^\235X\211\r7\245"
+	.ascii	"\235\001R\327q\005pzS5C1\330\307\004\017\372\256\252\205a\275"
+	.ascii	"\220\323\004\300`\330\242\365\356\300y$\222\024\271\b\204\334"
+	.ascii	"\310\350\241|\203A2W\2122r"
+	.string	"\034\323\224'\034\264\247V&}\034\f\024\025g(\211\177f\326?\224\246W\244\207y\005\235\341\323\315\202u\013\242\217\203A\311\217\025A\244\371\016\177\232a%\2739%\224Ba\344q\276\335\016\026|\250\3708B\231\tj@\242\205\221\"\222\271\251L\303\341\201'[\370\245\220\325? \f\316\024\354\273\331\236G\023$\370QmYU\342\031\013\344\3459\024MkDa$\356\317j\261\351\302\\\032\203?\366aJ\016\261\266\307\033\230\257!\n\331\263\220\223\r\234\302\350\3068\016\246a4\343\023\267\355\327\231\203\316\334\"W\251\022\207\221\235\2662\325s\206g4F\001t\311\237'8p\203\330\226\214\315IQ9/\233\251\036\372\013\366e\\a\273\3635}&\026\005\331o\204\013X\016\277u\236'\363\361\353\224qw\2475\367\243\005t\321\266\211\346\235}\213GFH\006\307\371\316\327\266\013\te\037\016\212\225\265\362"
+	.string	"\350W\320\222\320\334\273\244I(\262hW\343U\341\362\203\352\362\030\274\273\321[LZ8\362lY\276%\034\334:\323\307\354\031+G\247b*\343/\231m*j\256o\261qt\254T"
+	.string	"M{\0203\314\376B\273rb9N\244\376\236g\371\347\r\215\340\273\377\326~\t\271l4NV\221\367(\225){F84\2528J^U\241j\270,\236\235D\275y!\"\232\022)Y!\234\314\006m\333\r/Z\t\276\t\226\202\235\0020\320zA\331&K\370,\204yZ"
+	.ascii	"\357\0021'\003\355}\347\253\244a;\313\357\001}9\337qNo&\315\365"
+	.ascii	"\254\007.K\207\361\261x\220\017\361 \222R\340\006\362\372d|&"
+	.ascii	"\224\352\225z.\340\266\301\373\273d\225\0356\024\303\020\t\254"
+	.ascii	"n\b\276\363w\240\256\243\312\205Y?\250F\306tc\313H-\217\242A"
+	.ascii	"\215\217J\006\"\277O\033\233\223\256v\206@r\320|\203\220\265"
+	.ascii	"\325{\231\032\323\303\354\005\262Ed\220\3643\322PA\225\207\361"
+	.ascii	"\t\244\311r^\215\252\007\306\177F\226\b\301 \365\302\005a^\277"
+	.ascii	"\026\211p\231\013\034\260\321\267K\232_\302\tH\273\307\237,\250"
+	.ascii	"\216\227\017\202\255\346\004\3420\265\251{$,\226\225\r\363\032"
+	.ascii	"&6\034]\222\037H\232$\306\305\221\270`\006JN\235\270\247\333"
+	.ascii	"esy\251\327\272\370\254\212\234P|%\257\374\353\332\371\\\025"
+	.ascii	"W\302\265=\301l\327\n\363\342\237\321*\216\375wU\271\251\023"
+	.ascii	"\302\334"
+	.ascii	"t\256\017\354\244s.w<\377G\253${\267\243qp\221\t\205_eA\206e"
+	.ascii	"\367\262(C\223K\205\223\177"
+	.string	"\223\227\213\315\320\371r\207\324\303\215\007\b\342\256\r\022,\337\225c\t\215.\252\240\200E\267R\\@\243\273*\312\241\331]\026\2040\342\252\n2\024w\225\003\t\233\357\312\221\204N\027U@\300\246[)\026\240i\275\201u1\251\032\253%\377\310;\256\2103|\030\215D\034\270>\222,b\344\215\271\3420b\217\300\354p\300`\215Y\035\325/\241^}\fc\b2\367\364y$\207\344#\r\t\355\265B\275\261\343\3513\027\361\302\271\303\205\301,8\200\002_y\277\272\034\356S<\351K\2626\263\b\376\037'\351\257F#\001 \206)\021\022,\207\003\024\261\321\377\270J:\244\353\344h\022\005PF\304\316\326\234\306\314\301\305\013Y\023\005o(*\334\256\304\013R\216\177LS\236\"x\270\202vz\204?Rv2'`s\303\365<o\343x+\306\274T.FH\007\347|\226.\023\007\311\343\207\307G\201LE\323"
+	.string	"\305 \t\354\220#\026\336Q\274\001\004\247h*\330\335Z\302U\242\232'\341\240h>\365\223\356p2&\007\220\220\237\303\300\2046\257P@\247\342\377\202z\034\356\250\023\236\023c`>\016\270\314y\202`\004\203\b\f\2741M\224\241\007\363\300\225!e\240\330:\323\n\006\246A\236\005-\206\232G/3\315\f$\304s\370e\021\312Dl|\250\247\315\313Ce"
+	.ascii	"\250\257x.Y\332\221^{E\322_\350?\271\036\377\016\f\032(\307\""
+	.ascii	"\362\216\256\237\037\215\004\020\225\212\256\247\t5\n\201|\216"
+	.ascii	"\247`\242\211\202.\2240F\201k\023\216M8&\301X\204i\021\206e\030"
+	.ascii	"\026a\332C\206\001\371X\206i\031\246E\030\226aX\202\261\t\306"
+	.ascii	"$\034\223`l\202\261\b\323\"\f\3130,\226\3016\232\340%\204\377"
+	.ascii	"\"\357\235t\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.152.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"U\f"
+	.string	"&\327SA\020q\224\016"
+	.string	"\005C!"
+	.string	"\246j\001\206Xa\337@h\240E\036\354\320baT@\007Zjm\366\261!O\264\332\033\305l\005\363V\002"
+	.string	""
+	.string	"@O*\005\202\237\006\032\330\177>\336o\223C\366\2262\245@"
+	.string	"A"
+	.string	"@"
+	.ascii	"\357\005\252Ck\366\215s"
+	.string	"\"\2139A\321!\245cw/5q\355OS\363-[\351\317\n\271\276\004&\"R\0026\323c\260\002\205\305\273\347\307v\312\004\260\331]'j\003\271\341mG\260\r\301>\026$?|\351\324\364-\004\321\003\310S\342\356\207\250\262(\220\306\210\355_l'\367\027\332K4`\b\354\251\373x`\035\232\263\236\366[\334\205v\222\r\016\260;B\306\214]\316\2015\326\341\202\037\250\016\003\245\307H\241\"\242\317T\251\234\316\306)S< \306\230\343\231\352\232z\016!LO\335\344\202\177\302\"R\036E\252\016\257\357\376T\214\324\330\001\302#\243\315\225RK\330\177\273\273V\022\366K\376\352\001\330\b\223\360F \017\006\017tG\223!\343P\350`\0258\027h\002\366\271:!\321\245Q\340\314\202't\215\262,t]\270\375\306CMN\003\033r\002\003\307r\333\340\271r\2151\256<KV\n\325\376dy\224\241\006\026"
+	.ascii	"`\251'3\340\324a\233\205\225\"h1k+0\230\250\006@@\213X$L\344"
+	.ascii	"ICa\230\320\3205\240\030F\003\34175\005\356\005SS\304]n\252="
+	.ascii	"\032\230\332\003"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.153.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\375\001\005\022"
+	.string	"V\341vG\3200'\035\300\312~\274\035&\030\302\312\313\bZ\341\315\375\211\275n,G\300\317\021\272\007\206\320r\377\200\2327J]\260\213\316\376\217`h\332\344\013\f\341\025\214\221\343\bSl\200l\261\313r\0247\314\250d\023)S\na"
+	.string	"["
+	.string	"e"
+	.ascii	"\336c\367\022\357\321\256\261\277\307\177\216\331P\002r\326F"
+	.ascii	"\201S\270\243\304cwWJ\342\261{\261\323\214\371\257=\004\234\331"
+	.ascii	"\334\0030\363\360\b\364\256\033\260$\24442\303\351\f\234\310"
+	.ascii	"\325\216\313I\355Rd\344vFf:\035\312\220\320\324kO\r3Y\346\207"
+	.ascii	"\203\335u\202\263\237\373\343\266[l3"
+	.string	"\260\023B\037i\313X\310\203\327\263x\002\312\311\324\306\266\311R\211\354w\253C\266\246E\272\364\247i\325tj\372$\004F\364p8\017\323\356\206\260js\021\306\321m\277}\037\305q5Or\002\032\023mw\277#\371\267\247\270\212\330m4\337\237=h\224\243'j\327\007\301\243W@\036S~\022\235\022]\305\023\321\026\216\006I\030\206;\256\342}*\242\327\001!\313\320~\213\273p\275XX\274\307O\217{g\342h\306T\220[~s9)\332\335\005#;<8@)\325\246N\t\224R\375\355&/\236>\234*D\270B\225\310\251\327\026\356\006NR\331_:\223\213o\344\027X\364a\336cj\001\033A7\031:\254\031\326\203\031\230\327\205W\210]+\030`-\027\027\213Bk\005\323\302zY\271bdV+(\206Ux\305\254f`\260\230\325g\273y\355\317\360T\"w\2432\217\246\333\025\321\340\266\377\366"
+	.string	"QI\031\306"
+	.ascii	")Z\037\2504\331\016NMQk\333\003\217\317\036\261$\237\364[\004"
+	.ascii	"\017\211\306D\003}\t\236\217\233\300\312\203\216\256\241\243"
+	.ascii	"\312(( @\002c\030J\036\240\352I\002:\314\271a\245\001\351\332"
+	.ascii	"[\2427\356\272\3718a/\300\005JG\354\355\255\322\t\266\255J\302"
+	.ascii	"E(\303\230\b\206\317\266\017\344zK\020\317\232\226x\340\210\325"
+	.ascii	"9S\026\007\306x\177 v\242A\030[\313\240\\\361\371\260\002\360"
+	.ascii	"\301\2651\220#\221\310\302\357\263-;\031\340="
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.154.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`y\002\215\024"
+	.string	"\026d\201I\300\322Q:r\220' \243k\t\303(\354#\311.\351\370\177A\003\r\373t\261H\3719\214`\"\321\205\353\340\377\372\030\235\243\252Q\001O\365\007h$\022a\020\224\306\0331\365\253\336|\026\3339\211\252j\232?\366&{\247\024h"
+	.string	"d"
+	.string	"r"
+	.string	">R\273:(\247NY\235z\367\222z\272\372\200zj\323\330\342\351E\327\354(\0026k[0E\302C\022\325\356\266&\320k\2574\234\262\346\207\254\210\2149\333++'\3424\304\303\320D\311'i$W\023& \002\026\335g#\347H\356&D\260\273/\272\314\311\341\244\fY\331]\3131\267s\207\334v\213\355\006\266\204\0212Y=\275\321Y\314V\273\267\217\276\322W\264\370B\247v\231Q\177Vi\032\344\307\317\267\200:\002\336L\233\275\303\311\371c?\334y\302\016\245\305*\315\242\3225\224\226S\372#\005P\b\2018\216\216\335\017\301\037\013\244MC\337\375\366\375\243\373h\336\263\212\356'\336\310\347\035\351*j\337\315|w\366;)\246\002A\037?\251\254)\316\337\224\3009\235\006\205\n,\222\245\236\262\346P\r\247\0312\347\311\254\242\373\021\325\371\213\311H"
+	.string	"\354\350iz\f\231\236\313\254\025\264{\263PO\353\254@#S\316\b9\355\013\347\301J\202v\227\301\307\036L0_H\316\363\036V\351d\020\365\334dP\356\256m\316\037\243\374\363\345\343Q#\253\034@\206\367S\275\321_\310\226\356\002\026\013\256\030\327\203\230\227\030\207\230\210a)\035h/\027\230\013\303\253\365\322\342\232\265`0\033Z)\007L\313\020\203i\305\320h0-qw{\321\217\003\365\004\274M\\\235\twM8\340]\200TO\006q\254\202V'J\222,\317\215%\251\335\255\202\323K \324D\276w\036\204\212\244\373Q\215\006\036\241\372>\t\023\344G\323is\216\236 <\341\374\371I\025\347\313g#\030\f: P\2021t\310\035`\352\311\003v\370\202\302J\t\370\316^\211]2l-\336\272u\304\tm\201Y\240\223\210\255\275#\354\324\222\254%G\301\2279\034\334\253\244;\253\327H\003\313\210\354"
+	.string	"1\254\037\204 \210\320!,c8"
+	.string	"q\200N\226!\360\305O\212\306\016\002D\016\3324R"
+	.ascii	";\016\264\343$;p\247\323\211\246\313l\203c\242E\020{#\026m\260"
+	.ascii	"n\274&\354\004zpmL\314\021\021\026m\317\226\332|s[\033\364"
+	.text
+	.section	.gnu.lto_blackboxShouldLogGpsHomeFrame.157.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`^\002\315\022"
+	.string	"v!vF\340P%\035\333A\007\017\303\362\277\221\253\267\030U\210S\036;r\0354\206?l\340q\375\266\221\361\305\262j\243]Y\343g\204\251\243\250\370\351!\206\031\346BIVR\332\263\2041\007>\301\305g0B\366\336R\246\024f"
+	.string	"V"
+	.string	"f"
+	.string	"\027\232\346\304\271\2521[\304%\016\266a\354\316\007\020\300\370\025`\006&\343\243*\205l\304\2149\207Z\273\341\257o2\302\325\227\017\373\326"
+	.string	"\210\352)\306\321\227\3412B\002;*0x|2\b\300\205\206\251\356\233Q(\323}4\272\036_\f~\3149\037t\265\371hT\267\2219\247\265\346\313\271\271\333\206\331f\331\312\023'BIYY\221\217\272\254(\003\007\341qs\316\005\276\320?\260\370?\217vy\321\327<\372/\362\361\373\240\203\350\030M\355\b-\305\350\225=\004\323\245\331\207syl\253;V\335\255\232C\325\033P\315A\365\246j\271\352\250j\250\352U\265\252\372\036\177R\302\271\321y\033\241(\212\333\r\275"
+	.ascii	"\271-\267\247\361\020S\372\211\007\020HH\344\343\266\n|fq\345"
+	.ascii	"^fu\244\233(\361\177\354:\321\327\234\310\307\270\317\001\242"
+	.ascii	"\3520;\\\232\341\356\252U\t\357L=G,G\202\"\001\367L>\254\327"
+	.ascii	"\214v\031\370\\\347\234\260\335\257I\221\224\214\322\020\341"
+	.ascii	"\261\240,\341E, =s\316\004!\002v\211X\360LR\\%*&\255\t(%+-W\213"
+	.ascii	"KKd\200=\n'-\255\n\236\327\322\352\206\346\341\\\036k\274\323"
+	.ascii	"U\252X\324\222\240\377\222\017:W\243jE-I\376/\331\2616\266;\326"
+	.ascii	"#1\033\333\226\346\275\201a\365B\206\310nW\312W\017\221\034\333"
+	.ascii	"\355e\263\030\n\007\034\373\246\250Y\001\242\232S\\\2327V\006"
+	.ascii	"7 \220\002\031);\017\240\365.\037\272\006\023\212z77\267B'\r"
+	.ascii	"Vd\025\311\370KF\023~\261\nd`R3\032G\334\216\036\245\037qX\274"
+	.ascii	"<\t2\303\177\253e+\375\027\242%\256\nH\200\236\241\001\020mc"
+	.ascii	"\277\362\361\034aA@(\276mE\262@\363:@\221|\332\336Z\204\030\307"
+	.ascii	"$\343X(\021Zh\207\027\265\343\230Fd\201\373T\324\360\270P\007"
+	.ascii	"\236\025Bu\212~\323\233`\312"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.158.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\001\002\265\017"
+	.string	"v\232^C\020\221\223\016u\037U!\227\\\310\007\2219\341\373\221Gc\265+A6\227\247 \364\017\324\237\177Ph\315\370\3323\346C\321\321\312\031X\333\206 \002\300\n*CG\003\320\235\361\242\342\226\020[\334{K\231RJ"
+	.string	"B"
+	.string	"P"
+	.string	"\273\034z\320,\ft\021a\373\231K\366\215"
+	.string	"\027\326\204 \207\215\024\313\216\335\325\024\304K\207O\263\344\177\210\\*\316t\270A\371\3038\224+"
+	.ascii	"\356\344\025\330\335\223xf\340P\231\037\"\273\353Tq\035\356x"
+	.ascii	"\333\nl\033\260\223\024\251\307\360\001\365\0227A\342\207p\211"
+	.ascii	"I^u\350\233\304\303+\326\311\214X\235\262\207\255bJe\331\177"
+	.ascii	"\253)\266\2469\232\316\236\306^\372zz\243\351\250i\230\351\227"
+	.ascii	"i}:\237>\210\200\031\032<|\003\216&U\026\246\033\365\254\310"
+	.ascii	"8I\036\276\024\323\247Z\247\026w\361\240\363\371\304\303K\007"
+	.ascii	"\324Xm\364-\251V\324\226\263\200\"\324\250\342+@\020B\241x\b"
+	.ascii	"\365@G3\3634\205(\252\276\225\243\020\215l[<TM \363\262J=q\225"
+	.ascii	"\216\237$^\003\376\204\2206\217\350\323\211\340\321$\204:#\332"
+	.ascii	"gT\242\205\020\3606\0014\322(l\333H\313T\366o5\345\242\301\301"
+	.ascii	"\234\024\005A\322^\300 \257\262\252i\237\262^\374\245\201\205"
+	.ascii	"\256\325\305p4\006\213g\312\201\341 SRW3\263\002E\227\n]M\027"
+	.ascii	"\223\273\0337 \300\002\0311\243\007\340\2527\"t\252\004>\376"
+	.ascii	"5q\356\345\262\366#M\t\204\206\030\263\211BQ\2632\304r\312\314"
+	.ascii	"\022\360\350\223\024\343|\331xl\304A\003&+\1777\244\270\321\263"
+	.ascii	";{\341l\334\371\260<\ro\261\225\267\311\273y\026;H\324l\374b"
+	.ascii	"\325\265K\035\310\030n\220\243\266\370\225\251\331Q\033e)KL\023"
+	.ascii	"\rE\207\370\032,\224\211\006lO\036~zki\031"
+	.text
+	.section	.gnu.lto_blackboxIsPausedBySwitch.159.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\035\f"
+	.string	"&\026Q@\020Q\225\016;"
+	.string	"\207\307O\321\227`\022\247d\2132\254\004\371\022\033\006\023\231\f\314t\301\342\224\r\221\214A\322\317\200\302\006\343\032\001\240\002\240\brA\242\004\244.y8\234\030\307\326\222\275\245L)?"
+	.string	"?"
+	.string	"<"
+	.string	"\3343\031W9\177\343:\251\370\300\356\031\006\360\202J\311\206G\n\350E\313\234\263\002\216t#\201\027\013\035\025\320\213"
+	.string	"L\252\357%\256%P\244\032Y0\347\264~`\206;r\333\233\355\003\366\031\004\025\020\034B\032\263Y\235nh?\316E\331VOT-\255\216\352\177\b\240\221B\303O\2569M1\036S\206l!\302\366m\203l\212\023("
+	.string	"\231\0130\352p \310a\"\241\3301'K\333\017\017)\271\341\367\305\f\0177\342\206'\256\273*\211\206\\Bf{(\350?\335\307\350\340m\367\247`\257\025\273\241m.\373\202\220h\331\360\024f\177u\023\234\037\302\025>\372\357\322\377d\227\337\326\\,l\231\215\006\363 \243Ap\200\341h\232\216G\273\f\360\026\241AG\233\260m\035\215\302\232_\2245\026\270J\003\227[\262=YKhE\226;\331\223z\2044&\311b\213\023\3670j\254]\254F\004\030"
+	.ascii	"`\3253\230\200\tu<\317\312%ac\340\004\356\365ct`\301\210\210"
+	.ascii	"x\204 \301\200\260\216\020\"\346\345\020\264k\"\204\t\200\334"
+	.ascii	"\221\340\215dA\220\241n\201\360\252\232\334\273\n\024"
+	.text
+	.section	.gnu.lto_blackboxShouldResume.160.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\220\001=\020"
+	.string	"\026\337nF\340\360&\035\332\241(~\024\016\206\216\034D\255\246C\274Q\301\211\013r\004\004"
+	.string	")\373J=\206\037\360bk\333w\267\343\344\367\207\032\177\357\340#\0063\314g\030\332\251pdRxiI\224\255+\313[\262\367\2262\245_"
+	.string	"T"
+	.string	"Z"
+	.ascii	".A8\346\374\341\266\304_7m2\302\325\227\017\273\351\204v\263"
+	.ascii	"\235\347\001\222h#\224H\314\324\\\232><\246\274\026\3701\347"
+	.ascii	"<y\033\024B\005IC7N^\013\364\220\311\351R\336L\027\206\270\360"
+	.ascii	"^\244<\027(@\247\306\211\363\\_<\231\352&2\347\264v\336\314\r"
+	.ascii	"\340\266_l7\260/\024\276\212\367\250\3708\217\316\260\242\357"
+	.ascii	"\036\375\025\371\370"
+	.string	"=\317\341\322\016\214\235\236\230\326\354\037\231\356g\037\316\265\261\255VY\215Z\365f\265\264:\256\032Z\255\252\376\200\003HB\036\016\302\306\23425\035\263(\3060a\233\305>9\344\001\213_\006Z`J\016h!\002\373\3352\210n`\342~+\036\t(\\\233\302J\337\305\375\230-\314>\213\007\265|\034\217\220\220\310G\270\334QMLkO\220\202\206\003\334\317\177I]]\002B:\251]b\242\357t\265\205\221O\221la\246\221C\353\260\373\355Q\344\227\005t4\323\034\266]\367A1\3159\203\020n\201hp\261JZ+\013,\356B\205\225\t\327JQ\341@\020\330u2\222\302ap\271R\270\323O\354p\256\215S1:\"6\324sbP\354\220\252\225+\327\"\261\225\231<\264\300#H[\302\004}\207\332\3170\"*\232-\315\020\214\322\266\2375.\270B\006\337\366\305\336V\265w\331\021\323\232\224\001\034"
+	.string	"`\325\313Xh\370\215\263\263\002\351\220`/\273\267\327\032\313\315\334\223\230\0161\330\003c8Eq"
+	.ascii	"&?0\016\372\254\272\002\025\022\007\217\271\3215<=\026\020f\202"
+	.ascii	"\f\277o\0165b\336\324\264+C\361\017<\364\354*f"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.161.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\031\006\355!"
+	.string	"\006\370\313I\200\030R:~\351k\341\013\177\215\256-xay;X\361\227\215_\013\200\240\\\024\352\241\306\261L\364\325\375\035\177\260q\350\334v\230\370\016\311\017\314\357\004a\271\300\357\201"
+	.string	"2C\032Rz\021\"\377T\325\177B\310&{'\031\266"
+	.string	"\251"
+	.string	"\276"
+	.ascii	"\235\313\031\353\214,\347$\203\026R\217\201\276\203\036\237\017"
+	.ascii	"\200\036\367\332\275\306\263\224\201\016\332\2000)\337r\316\275"
+	.ascii	"\313\343\353y9;\234\033\235MNMQ|^\273\366S\242\334\260\b</\307"
+	.ascii	"\270;w\270\354\020s4\242\325\251\300J\013\024\316\tt\266d:\032"
+	.ascii	"\021\307\371\223u\005w.\342\225\275I\211th\304\252s\021oX\033"
+	.ascii	"\343\t\304E\244\262\271 ,\247\251\253\\D)\233\242\021\247N\240"
+	.ascii	"0&\213\036\354AXN\306\343\250\237\273\342\222\256(\264\367\334"
+	.ascii	"i\n2\334\025g\234\n\330\252\2409\330-\215b\320\332\224(\347\334"
+	.ascii	"vXtz\003x\367\021t\367\204n\334#\367\312[\257.#V_H{e\251i\310"
+	.ascii	"\355#T\347JU\255\001\333\272\244\tm\\\367\241<\312Q\377G\233"
+	.ascii	"@\262\037\"\241\307:\367O~\240\213\362\315\352KJ"
+	.string	"\3116\273\223A{\265\272\177\233\315f\263oV\267j\333G\265\335\243\332\346Qm\353\034\371\363R\333jj;Mm\243\251m\214\332>Q\333\027\333\266\330\366\177z\260\244<\235\312-\347\246\246\232\274\304eB\372N\376\244\305\223\335\340\250%I\213&W\276x\262#l\301\362\242\373K\036\006\343\311\226pd\352\216\273at\353\216\257\256\273o\273\357\365\257\365H\031\001nG\bS\362\330\315\212\304l\300\261\203\025cfY\022`Cb\246;\227\333{\254U\211\275V\214y\305\206\005\372\373c\242\026d\237\277\202\241\335\026.\3343\255,\2059\fH\246\027\330_cLI\022\216-x\201j\225\373\250\205\365\210\237\231\371\\\n[H%\333\264\362\225\304\230^-)\357\271\366\b\023,\031z\356\303\236 \250\364\242\201j\203\3242xc\034\033\031:\300vs\350\300\204\022`y\267\373\003\b1\346\323Rx\201Dp"
+	.ascii	"\333\035B\204\375\260\237\366e\3152x\201M\206\nXu\026\241<UU"
+	.ascii	"ct\\\331#NV\244\346,\034\352\217\235\212\257\377\343\270\215"
+	.ascii	"J\224@\217y\002*>\030!\035yX\201\302\350\367c\341\303i"
+	.string	"\237\220\213$\022&|E'H\364P\034\025!\365|?\025=\241\237NJa\364\353\255HJ\372\365tI\245\237\371fuN-j\251t\203Q\t\324\236\316\234s\346\235Y\n/\360A\2165\260\034\365\246\f\256&M\234j\343onhR5\307\\\030\253,;\364\342\373#\275\340f\326\253\n\020\272\327\251\267\2557\206\312\240\267\302V\031\216\263\255W\006\214\275\352\370\230u\307\217\361x\r\337C\035\335\340\n\270\225-q\256V\237\367\336#\265.F\355aV\036[\253\017\037\350\361y\037\244\0019\230U\210\232s\036\352\1779s%\262\026Y\273\326.\364\370\336\030\307\200\210\250\2010%\215cnD\244$)H!\035\220\002\221\251\262n\0208\207jH\222d8\340\3171Z\302p$\212\177\n\202RaC\335\347\302\377x\200\307\2326D\310\361\241\025\022Zp\002Lsh)\270ij\021\037hL\202!\017\307"
+	.string	"^Y@\242\007\206\314\337\005\005\t\362[\325j\304z\270\214\200\2145\245\345\325\374c2\313\352\220Y\215\016\335,\032 \027g\324\256M\254<\330\333\001\220)H|\351L\324\237af\361,\236=\277\033 \320Z\245\004\250\303,\201\320\\"
+	.ascii	"Cu\367l\276\355\032P\033h\013!\345\004\r\241\f\264s\004\"\006"
+	.ascii	"\221,\372y\243U+\372\211\001P\243\252R\255\350\375T\207@h\272"
+	.ascii	"\220VkeK\353\030\374\313\277*n\005\260\031\303a \261P5+(\350"
+	.ascii	"\372$b\321O\320\237\n S\250d\233\322?\303\205b~\224\221\356["
+	.ascii	"\253\303 \206\340]\370\372\006\337C\033\312\305\235+i\233\274"
+	.ascii	"\252zj"
+	.text
+	.section	.gnu.lto_blackboxUpdate.162.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`v'\345\211"
+	.string	"*\312<-M0\016\333\031\003\376\317\200\b\200\343\031\216\263a\371\003%\032%2\003\377\337=y\232\201[\2767\232\366w\374}\217U*C\360\311\323\034\201"
+	.string	"\323\326Hg/\235\371u\3367\345*\204Ur\214\322\355\315i\206S\251\352\240%+\267L)\245\321\002\205\002\304\002\201Uo\007}\211T\t_\3510\f\225\356\353\306\013\374c\030|nz\r\310\243\377\370E\030\237\337^\363\271\335\247\203\b\n\372R\001I=\321\234\202\357\253,\240\330C\206\026\273\207\345\301\234\207\307m\375R\275\035\344.\320K\337\373\276J=\344\030\305;1nu`d\004\3510"
+	.string	"S#(\367\202\215T\0052R\2463\016F\331\333\033\035\323\312LX\233\327\373\276n\021\204\321\265\365\230\036\r\345f\206\331\t\366`f+\254\002\003\343\215\233\332\013\347\2274\026\3166\301.o\321\030h\334\314\372L\205\206\362\263\325\021\252\300\\\206\201\263*\330YZ\313\n\r\345a\0215k\230\316\367}qz\310\274\0023N\017\177p\230\271\235\271\235\375t[\314\007\033\337\267)\266\366\276\320\024\274T\354!Q\373\260=\\\273\207\355!\273\314{\r\325z=\004\022\221\332\"\370\276/\323?\201\366\nm\316q\267\371\214\315x\013\223\261\026\316\302\320\0312b\300xA\300"
+	.string	"\002\004"
+	.string	"\200\213\026,V\250`ZJ\201B)\t\351\350\204\t\243\022E$F\020\211\030\022\n\n\001\342\203\007\240\037\237\016=\0346\360h\330\321\311\301a\264\243\261Hd\207\353\273\313\355\3177\2629.K\247\3463\263!\316[\310\264L9k\021\222t\316\302\320\261^]h\"\201\370\f\031e\205\036\203\320a\274X[D\tZ\005\345\270\221\242k.\245\033'`\220\352\003\004\251\262<JA\226\347}\337\016\002\254F\232M\210t"
+	.ascii	"{\016@P\023ID\317]\360\251\361\026Q\026x\276B\305\2353q\271["
+	.ascii	"RK\221\207\342\r\316\225\270\224g<\tm\r\351\210H\003L\367\362"
+	.ascii	"\204\233\232\233X\223\230oFZN\351\266\372\244i\242\246\307\276"
+	.ascii	"\270\021[\257M\224@\313t\2114/^D\2441\326\013<\021\273sRI4\251"
+	.ascii	"\270\364\210\021M\252h\023\255\037\314\230li9%\332j\342K\032"
+	.ascii	"\326\200Q\027\301e\314\207\270\210\271\220[P\236\323C\2049\b"
+	.ascii	"3\037\276\334\303\033\020\025\377\211\363\341\222\342\035\244"
+	.ascii	"=r\034\2404\2272\006\337\300%\247\334r\036:\rL|g}-gdb<\275\266"
+	.ascii	"\232K\271\304u\326\326H\220\226S2\327\031Nym:\357\312s`\240\262"
+	.ascii	"j\234~\262jF\373i\"\253\374\250\304\215u\335\313\342\b.e\225"
+	.ascii	"\023\2114\356\272H\t\324\371\325\244\312kVN\231\267\022\275\357"
+	.ascii	"\373\303\207Gz]\223\372\300\260\331YF\255>D\246${\254}j\t\345"
+	.ascii	"?E\023g\246\313\023\314kJ\024\255$R\307%\222]\233\313 \335T\346"
+	.ascii	"ip\"\215\367}\331\223K\252\346\032\315\314\3660s\002\314$z\002"
+	.ascii	"\307\317b\342\017\277\211,\216\351\330'\3760\360\007\023\311"
+	.ascii	"\305\3552\272\343\250\273U\342\016\215}\243\251\030\017\277\247"
+	.ascii	"yG\334&Q\2746\356D\006\313\370Tf\302g\271\026\267\353\347\211"
+	.ascii	"gq\267z\b\375\302\344_\222s\327\271R\\*\336I\023~E\233\013\344"
+	.ascii	"v\273\330\256c\327\212;\335.\037\255\367}\003`\007\3630\367\n"
+	.ascii	"w\224\036\262\213\305\375\372b{\330V\021\n\256Qjv,\356\345\206"
+	.ascii	"\271Ow\314\035c{\310B\025\241\327\232+u}4\273\352+~\226O\351"
+	.ascii	"U\2043#\240\200wr\375\236\342\301\365\233\356\261>~i[#~\0267"
+	.ascii	"w\033\347\252 \211\032\325\352\311\253U\366\212Z\257\362\305"
+	.ascii	"\352\273>\232uA\251\033\200\2245\331\034\354\177S\220\003u\r"
+	.ascii	"\226\331\201\007\274\223\377\215\267&\205z\247!\004x`@\316,\001"
+	.ascii	"\005\336I\356)\336\227\024\371N8/\314Pe\025b}|\217u\361\217\f"
+	.ascii	"\017\312\335p\267\020\353\357\343\331\245\252\220\016\203?\261"
+	.ascii	"\340\202\f2`{\350\277\003,\215\332\203\275\303\206%\330\347\344"
+	.ascii	"\205$\226@\312\376\263\274\t\273\223\235'\026\373\013:S\256\330"
+	.ascii	"\2319[J\330\227\340P\247\252 a\257:\356U1\302~\304\230\266d\247"
+	.ascii	"*\202\3359\275|\b;\021b\233+\237bo\201\365\222:\275\200\260\007"
+	.ascii	"\031\022F\261\377X\343\374\211\035\371`U\366\327\033\353\r\224"
+	.ascii	"R\345\305\"\344.\344\275b\367\006Q\304\2555\247W\273a\346\275"
+	.ascii	"\257\213\302\264z_\247fz\362EZ_-\177\303\334mZp\003\356(\314"
+	.ascii	"\201\007\336I\017\330\036\366K \206\216\371\254z\362*3\024\351"
+	.ascii	"\237\305\334_\255V\317\370\2350\027\235}\030\235{\030\235Q8:"
+	.ascii	"\363 :\357\310q\326\261\343\334\224\343|\302\321\331\204\033"
+	.ascii	"-\326]\243\361\232]\020\235[\030\235Y\020\235W\020\235U\020\235"
+	.ascii	"\231\214\316KE\347\024Fg\024Gg%\242s\222\321\031\311\350|dt>"
+	.ascii	"at6qt6::\2278:\027\031\235I\3448\2170:\023\031\235E\3448\017"
+	.ascii	"\025\235\205\214\316AG"
+	.string	"\347\020Fg\020F\347\017Fg\017Fg \243\363\217\321\331\307\350\334\301\350\334\243\343\314\341\350\274A\307\231\347\350\254\341\350\274st\326\311q\316\311q\306\311q>\026\235\2158\316\305\2433\361\350\314\036\235\207F\347\325\350\374Eg':w3\221\361F6W\026_V!\236\271%k?\267\313\347\356\335\374\240\333\265\245=;c{\030\342\333\257\207Taz\324\252bYs)\242\215\262M\357\345\n0\r\340\334\364\331|\2336\332\245M\3634\266\207M\337c\372\304\334\026\301!\020\337\244\006\342{\312\307\244\buM\b\311\003\236\360~-\230\347k\331\334\261\023\276\271\222\234Q\253\364\334\244A\037\276\233m\037\336\243|\313\020\036Z2\036\276\247{\201R\244+\003A,\377\316\f\273V\276\356g0\37393}4\263R\345\003\320K\351\241\264\205C\003\327\302\235\371\267\266\314\231\026\016\216\r\350\207\256\360\254\236B"
+	.ascii	"\327<\f\031\363&\346\215-\314\333\232\332\033\320\217\227.\\"
+	.ascii	"\3324\254U\364\254\245\306\b;C\363f[\3324]\025\346\245\214\230"
+	.ascii	"\245\265\203\212\265v\316\177\266s3\264vvg??t5\267\267$\351\367"
+	.ascii	"3\205%\356J\234\f]qV\252\304\371\370\274\224\346n\251\254Ci\365"
+	.ascii	">\206\031Z\257\325\352=\f\377\244\235\266y\255\036\333\352\261"
+	.ascii	"=TjF\363\371\241\2531\302A\227B\003\3550\344\005)\023)\363J\272"
+	.ascii	"D\211\264[k\216*\355\001\362H\246\376\310\2237\362E\344\330\265"
+	.ascii	"\362\313W\312q\350\200\327\200\367\333\255\037\313\334\002\266"
+	.ascii	"\201\336\311\016e6\364$\340\r\375\251d[\330^R|\220\266\312Z\001"
+	.ascii	"\371\037-5\006\330\032An\007?\252-<q\367\276P\0010\212\207j\253"
+	.ascii	"]\005\026\350\325Cv7\217dU4\364_7J\203\326\033\257v\231\326\373"
+	.ascii	"\376\340i\326\203:\241\033U|\337\037\235dw\343\203\256\023\322"
+	.ascii	"\215\212Z\213J\271A\274\223=?t\005\346|\225\344\215A\235\221"
+	.ascii	"\362D\255Y\232\362?n\243\363\353ke\2222\3015\376\354\246\333"
+	.ascii	"\323k\223\224\345\321\365\321\214\t\324\357\276\242h\230k\016"
+	.ascii	"\337\\dS\r|z\307\341\215\246a\236\352f\3300\004\003S\363\265"
+	.ascii	"\363YBX\236\016\\\316\025R|_\250\001\330\245\236\306%\262"
+	.string	".\335\"l\021\266\207<\037c\032\346)\016N\303\367\226\351\253\301%\245:\237\305\002\200\341\334xb\f\r(\265\213\237Jk\027\357r\275FX\206-g\347\317\270]\255F\313L\353\374\316\017\315@\306\355*\216\321\371V\263%\206\242]\374\215'\301.\212]\316\213\351\344\237\333n\030\213\3639\337`p\276\271\300\354\276\252"
+	.ascii	"\360\3433\273H\334$D\306?\276\353I\275\341y\343w^c\360$\n\237"
+	.ascii	"\324\233'\257\256\334\005"
+	.string	"J\335 \316gq\367p\355\317\255\201w\262\204-~7\311\246+\234\241\315m,\263\313\304}\301;Y|\217\346!\t8r\360\320\201\243\211\r\241uP\200#G\b\023\354 \001GS\023\217\033:|c)\205\022l\210p\303\203\021l0\221\020\202\0079\230n4\351`Z\022\301%\230\200\243\211iG\t%41\341@\237z}\337\t\007a\003(}z$\257^\030\030[\240\305\267\230]\01365\202\314\247\002Z\216gd\242\020\350A\327\343[\313\001,\250,\336\243l\260\260uG\331\\\221\032\020esEc\305wS\272\342Yx\232Q\327\265\266\002\245\366\315\3502\037\203\024\370;\261\204B\330\310@\341m\220\341\301\241\360]\326E\313\252\224\371\364!2%\031C\005\336\031\025U\030>\n}\n\330\206}\"\377^|\026\3237\027\231\033\323\267\021g\341\027\001K\337M\037\325\245\367(\340\372\245\0330n"
+	.ascii	"1\274\266\t\r*Y\301\360\032Fh\260\205U\215}\213\257\312\232&"
+	.ascii	"cLU\013\254(\177\323\205K\2127\026\261\363b>\305\004\370,\264"
+	.ascii	"\226\301\031\350\265\206\241(\314\234\332%(\214\212\3309a>\253"
+	.ascii	"\b\313\316\032\200>b\225\376\311\352\362\326\364\021\233\364"
+	.ascii	"JcI\377\302\271\367\365\276\257\223\013\244\267\201D\372%/\265"
+	.ascii	"\217\332Lc}\337\367m\341\214\2628r)}\364\355\367W(\205j6\322"
+	.ascii	"\337\340\212\265\253\325\220`Q\373\240\232`\351\242\342\3047"
+	.ascii	"E\235\370\236\376\241\221\"\2314\322\037\234\224\211\005\357"
+	.ascii	"\3516\310T+\244\005\265#Pj\037\024\226\2254\"mVjG\224K\237\305"
+	.ascii	"SZ\255\215\254x!d>\227\177_\305\257(P)L\374\016\230\211'v9\212"
+	.ascii	"\317b\243/\372\337k\264\022o\364A[\326-\267\253\307\254Z\356"
+	.ascii	"V\267\335\255OJ|\217)\372\256b!\337\251\225H|\023\n>\342H\213"
+	.ascii	"\304;I\342\211\210~\304\267\324\233\265\2716\311\221\244]\262"
+	.ascii	"\204\355!\321\277p\246Q\253\2224\322\037\222\244\350_\021\244"
+	.ascii	"\261j\337\316\021#\323#&\030\007\244\362uB\304\347L!\303;\301"
+	.ascii	"\207\230\264\"\236\b\352\235\2244\031\372>\233\366\260.\356\317"
+	.ascii	"D\267\205\254\320\367\2246kE\322\026\026y=\262"
+	.string	"\272\320>\341\255\026\n\024\266\207BHdh\3240\237bFF\326\"l%\202\244\004\001\272\013\215\304\007'u\362\302\" *\024\214\365\206(_\031\022:\326\367m\316\350\323\342U\006\301kt\265W\374\272\207|)TR\373\240\336imA\307\232\\\201\350\370\016l\245\245\027'\363Y\265\376\200\362\350,\3025\247\340\013\365\302\021\037x\377\265_\373\325@\3108A\2463\271\323m\030\313\r\330>\333\261\341;\275\fPJ\210>\213\273\217X\036o\203,NC\265Zm\323G\354\216\347Q\335\361\r\330ET\2055\262(\303\366\002\203?\250\022Y)\rJ\210\324\214\210\210H\222$\351\262\013\020\204\"ITcg\036\022\240\0039\b\204T1D##2\n\222\242\244\264\034`0\346\264\264jTrT\346\022\3400\320\367\347\204\001\266\345\327\376(\033\205xG\343\n\276\272\244|\200\241\343Y\034\321tQ\355`K"
+	.string	"\304\340W\250JN\315\203\224\312\364F\255\016\r\0244\177\223?\201Qa9\177\300\360O\277\"\203\207\361\222U%\371\267\260\234\251\016\367B\354\037\317\207\203\376\2110\377O\210\312\274\214\033\006*,+"
+	.string	"\031,\256x?\333"
+	.string	"M^v\317\337\037:st\3129\270\016\352\301.\032?\250\225\250\007\220E\275\306\r\353\237\274\013\236\303\270\034@\306F[\244\374S\243\214\331V0\\\363\306\374\305\245Wp\021Q\332\027\343I\003>\032\032\"\263\260'\265\300k/\203\362\3742\334k\245\263\235\334\22382\246\211\2333\232w*M\3233%\217~\244\321\277\203\177s\n\336\322*\240T\253E\336\224\235@JI\037'\225\370\376G\364U\031T\243\336\311\304]\214\375A\216\355\317o]\210\275R\331\2314\027. \3102v\222bV\357\237\262\341\346\027\2476J@\265\006\374\272\262\021^\021\033\322\264\220\321\342\234L<\353\202H\324]~\200\224\317\212\"\354L\024\001J\340c\r\212o\354\204\"\f1\204l\201\027\313\006\003Q\310\276\226\336\356\333_\244C`,\212\361&\323\2009\213#\200}\307\333M\226K"
+	.ascii	"*;\303'\242\336\240P\274J\257\361x\300jf\032\255\214\300\026"
+	.ascii	"\360\\Z\030\321\237\350b\263]\017\205\305Y\276\303H\035\247\312"
+	.ascii	"\306\352s\212\b\036\024\303\216\022\256\341\2512xAlSY\203R\374"
+	.ascii	"I\002\272\216!^K`\232\022\316\332*\346L\030\243\343\036B\350"
+	.ascii	"\272\216\0358!\215JD\233\374w#\344\203e\033\177\327\344\310\240"
+	.ascii	"\336\032Z_y\243\030B`3\005\253,\213\264 \230^\213\301d,N\372"
+	.ascii	"D\255TsK\377\001Y\2500\r\037\203\315\332\206w\243ycy\214\003"
+	.ascii	"\365\261\337\260\265\204\242ni\006\027\006\032\316\230\231\016"
+	.ascii	"i\315\357\016\242\266'\\4\007WM\020\232Z"
+	.string	"\245\216\337\232\3564n.6Y_#\3222H\003\364\024>\352\005\217\n\034\247w\230\212\253@\260)\364\2424\322\244\001C\357;u\3708\332;|\341\343*p\263\311W\345d?VH\034a4\230\2009\003L\343\2027\364\226\261\266. \305\211\016(\313\340~\323\241\317\313\245+\016x\251+\0353\242\215\257\221\362\377\243\347\003\240T\200\322\273\276\252\344\"\3228\244^\203\003\317\371\346%y8\363|\027)y\b\260\274\337\0039\361\020\334\347H\t\330\221\204|\b\006\336\236\t8R\027\016\016\222\246B#\b\314\263\320\270/\275\305od\330\300l\005k\316gE+\302\354\367\024\026\227N5\255d!\373\007\0225\337K\231\300lk-:\323\020\032\304\244\333\250I)\207\321\314\256\251d\371\202\232\037\033s\260\354ks\250\206\243\005\004\346\f:L\240\033i2\030;\0363\244\264{wQ+\233\224\233\355c\322"
+	.ascii	"\2619\3047\262_\241Q\262\036b\257\003\223\312{\214\215\031`\351"
+	.ascii	"\242X\206\241\365\n\0230l^+`\200t^\b+\240\0263{\303R\200\216"
+	.ascii	"\2125m\002'\343\300>\255,LiB\224R\220j\251\262\264\223\025J\212"
+	.ascii	"2\344o!\b(7\005\266\370\222\227\210\222\335#\300\334\260]\353"
+	.ascii	"E\373\230z]A\243\2174\214a\336\261\337lkLa\350\373n,\226\"\217"
+	.ascii	"\302D\026S\302\033Z/\302)Ta\\\335\001\t\270\275Bb\370Z\303\206"
+	.ascii	"\310}C\034u\342u\235)\236(;J\201\016\214\267u`*=N\236\362,\253"
+	.ascii	"\r5\362\310\200c\"\211q\271\354\016Q~a\217\2420}\027\222uc\230"
+	.ascii	"\302\217\243;F\221}\003[\022v\245\274\221\2103\216$\306\232\205"
+	.ascii	"aA\035\266;\2720\031\313\007p\0359\316\330a\376\231\372\222\264"
+	.ascii	"\223v\025{\342bSa\321\325\216\237"
+	.string	"\322\2403\226l\305\345\306\260\217\343\263\364\264\325\230\2765$\244\214&.\224\221\275("
+	.string	"\237\225\200>\253\004\336\2334\274\017\007o:\262l30h\333Za\310<i\375\371m\215'\213M\306\310\203\217\360R\005\236\353\336cIVQ\037\322\245Pn^\307W0\312q\200ER)\204@!9\224C\274Q\371\004\347\363*\233\204\252\030b\004\337\314\264,\002a7$\345\022Z\254\r\"\335'\313\365'\350!O>\214\346\272@\342o\247\036"
+	.ascii	"W\253\367'\371\367\275\345\253\330\323F\252\025+,\\?\025`\250"
+	.ascii	"e\233s\210\326\276\001\025U.\220\247\311\372` \333\260\235V-"
+	.ascii	"\306j\247\301\336\021\177\332\210\213\223#Z\022\255t\211\224"
+	.ascii	"R\245\327p\3502\224\334\3700\272G\210\261P\026:\2754\215\250"
+	.ascii	"xZ\271'\002`=\316n\\!\267T\350\354!,\244\376$l\240\006dtM\315"
+	.ascii	"P\212n\332\216\311\004\365;\260l\275\276\227\207\331\020\250"
+	.ascii	"\325\245\b\262~uP&\346\241\252\250\262\201edL\231\352\352K\372"
+	.ascii	"X\276;b, $+\023\215\240\301\177\016\376\340\025e@H\331P\357t"
+	.ascii	"\262:\245B\0051\304\250\323\354.\020\023\002B]tO\316}\227\227"
+	.ascii	"GU\020C\354C\024v\236\264\260\210\246\034\245\204\333\364\031"
+	.ascii	"-\243\300hq\020\264u\275=?\247\016\213V\230\306\246d\225z\\\326"
+	.ascii	"\361\275@\0262)\322\024\233\261\222\204\211\377(\310\022\304"
+	.ascii	"Qx\253\255\301`\312\250{,>\2231\320r{bo\204A9\310\245\031f\b"
+	.ascii	"\321\002"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.163.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\345\t"
+	.string	"\246RC<0\305*\035\036p\373\271N\205\275\374\317\274\250\372\351\bY\312\271m5\030.\026\207\307]F\226\301\307n0\342q\273\350],d\221\262NU\241\214"
+	.string	"N\276\035@\373\204l\"eJ\0012"
+	.string	"1"
+	.string	"."
+	.string	"\206ia\307\252\240@+\365\"\260\273\235\346\230\355Q;\301\366\250\034\007\237\240\177\222;\244b2\325\252\364\344\026v\327\251Z]\334z\333\007\266\025\354c\002\361i}:3\375\212\201\f\005\343\261\001\273\0263\003+ \002"
+	.string	"\261\r\332\027;\f\220\360\274\3130[v5NRv\027\301\233\312\243m\277\365\021\320\001QSU\217\n9\345\314\327\324\247\016\274\344&#\377\303\024\244\274\212\264=^3\036\031\246\234\331a)u\303\276\266\312\262\237\346\036\376\333]\177 /\364a\260\200F\r\037\021\347\343\354\331Tx\035\b\017'\242\323\205\0368\240\316\363Mt\233\214=\211\317\327\211<\357\353.\341^[eq\2521\351\311\233\252r\032_(\221\021"
+	.ascii	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.\327"
+	.ascii	"p\020Z\300&\204\003\346@f`DP\001\007\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.164.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\262L/5PO\222\016\203^\3054l-\006\204\262+\322\253\201T 8L\337\322/d\333\326\242\rl\363q\264\017\033\317\314\222$\024\007\360ZA\235j\3702\324\354&2\005S\235\214\352\003Ay\">o\342\301#\361(\253\342u\n\256(\034\254gQU\326\343lY$!\032\210P\343\"b3\232\236\024\345\342\222\214\001r\325:]\020@\247\242"
+	.string	"\210\310\325\374\2069\024\371n23G\322\357F\347\356\206"
+	.string	"\206\343\243\245\225\314\216\232\231t\231XJ\376\320sVX\b}\rl`/\0072*YJL\346\366p\244W\335uk\322\206\254\324\242\215\260\272"
+	.string	"\206\314\334i#\217\216\375\021\376\204?$\t"
+	.ascii	"`\251'\0230\2013\3348T\204\272\257\256)K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_blackboxInit.165.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\260\005\235\037"
+	.string	"\326\363\270I\240\230Q:\017\341\236\221\321\370\322\363\234\301\326c\234|\326~\265\303\nr!(\350\2635\272^\303\343H\255\363\237\377\301\365\346#\254\212\230D\254\260\216\257\360\234m\300\253\2404\027_\b\005\364[`\337X\373\311&D\312$\003\246"
+	.string	"\233"
+	.string	"\245"
+	.string	"\007>\350\342N\013!x\276\334u\261{\276\354sq\273a.T\252\004\316X\331)1\326Zi\335\343\270\333\324\320\314dg\f\3662iI6\343\366A&:-NzA\267\t\376\275\032\341I$#\241S\326\216\"\245\323\350\370\361\f\201\314\314\001sfk\314y\203c8H\234%\"#\206\2319;\212r\374\225\205\310\006\211Sk}\323\021,\021\371\330\254qZ\016\235=\030L\2329\265\326X\257\306\233d\360\223\242A\323\023\"\005`A\002\363\246s\214\236\216\331\314\251\265.\363zE_"
+	.ascii	"\337\275\201\335u\260"
+	.string	"[\212\b l\3577]\001\223\325\321\017\350k\360\375\323\241B\214\330\3311\372I\031\245\360\034\220\362\375\311\243\370\334~Q\306\037\272or'?$\200\200\350\313\003Q\276\327\350^\311\227\324\366@\326\204\215\317\263\321\227\037>\301\030\254!?\247\253\034\037w\205:\356\244\335\367\361x<n\363\330\245\2743\312+#yO\2237F\362\302(\357\213\362\232$/\245\274e\311K\222\274\335\274\334\274\307\271A\2022\343SQ\265\3128nUb\t%dw\277G\362a\213;m\fX\325bW(!I\225\247\016\245\335Z\177\254\223\326\354\262_\f\257\3206\373\273\256/\264\035\370\360\221]v\200\035\025\325\256\013\326I:\264\313\005.\"\\k\rze\240\344b\370\226\f\257Z\205\"\354\263\\\213\206=\220\227\273\201\003\007\372\222\354\033p++\230\343#Yk\255f7\261\247xE\356\356\256\332u\365\265\352k\224\273"
+	.string	"\223+VCFt|<\225\016\030\205\222RX[,\"A\225\023\232\214\325\017~\302\302rD\276\352u\350>\352Ut:|\370@_\256"
+	.ascii	"^\031\037\204\367#v'\335\274F\337=C/B\254\265Sj\001\353\363\200"
+	.ascii	"\205\255\247\346\303S\242\207v\002\210\307\004\315\347\226\202"
+	.ascii	"\366\340fm(~n4\0256\333\215v\ns'\253V\016b\256u;\353\375\023"
+	.ascii	"\353B4\3550\027\257\310\365K\205\312z\326\037Z:[\306\365l\300"
+	.ascii	"t5\344\007\364\331,\227\022\227\"\304 \346\252\301\001\351\336"
+	.ascii	"\370,\034\020w\204\002\005\372\322\203\r)Y8r|,\023\346\245T\211"
+	.ascii	"\352Q]\360\362\302"
+	.string	"\307\2260\t\263\304\0041\027\215\005\032\353\236\341\227\n'c\241\030\353[0I\221 9\203\265\230\363\212\257\206uO\225m\366\253\007t\24123dDw\331\253\272\210\254\260\326\032\200\213\250\2018\346\030QjDDF\222$\205t\320\002\021\"\2629\021\2009\203\306\246\311\262\337\001\340R\222\243[\211\034\311\301\034\021\337w\274\265\370\3614\271\304\275'\334\004\240\245\225\206]D\301\332\223\324\0176\0065\371\244\244\265\374\007\304\302\331z\n\215c\211h\250\2468HB\344\261\212\321\310\323\325n\226#!\305\016\200\302\242o\330\340x\202\3110c\036Kk\r\301e\177\200\310\264\353\017\236\304nJ4l\226Y\324\002tF\216;nG@[\323\245\"N\350\330Si9<\216\022\360\020\003e\\\207a\354\243xC\322\330\206\217\210\315\252\b\314\346\276\033\027\266\236\032}\234\020\247\337w\n3\202\3659O 8\b\370"
+	.ascii	"\263\0214a\250u\307\305\324sl\320\257\377\351\363\013=\370\233"
+	.ascii	"\234\324\222\202\b\347\355*~9\026\354\267\025h\303%9&\303\334"
+	.ascii	"e\366\242\034a\360\222g\325\2660\236\224ES\230{)\223c/\262\335"
+	.ascii	"\343\376+Y\r"
+	.text
+	.section	.gnu.lto_CSWTCH.155.265.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375 l\235\002"
+	.string	"\304\003_"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\006\005\005\001\006\325"
+	.string	"\177\001\004\006\003\002\001\002"
+	.string	"?\202\210\2008}\304\001\303\001\302\001\275\001\301\001\275\001\300\001\277\001\276\001\275\001\274\001.\273\001,"
+	.string	"\t"
+	.string	"@\b\317\271\224c6\233"
+	.ascii	"qa\316P\271\222\322\n\006\212"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.267.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\275\013"
+	.string	"\346TK@ \213*\035H1\"\321\002\017`"
+	.string	"H\362\371\"\374\256\203\031\326]\026\023\322B\211\366\344\261\314\260\225\016\241\200\324\332\030h\357\f\023`\324"
+	.string	"\026\202\303\344\031\256\276\342\261\020\276~|\262\267\224)\0058"
+	.string	"6"
+	.string	":"
+	.string	"[\302\2400!\025\273\260\273\333\243\0268\351P3\222|\n\246\322y\245\303\354<"
+	.string	"W\b\017\005)v\367\256g\211w\312\214x\244`v\327\016\001n\355\2663l_\330\357\004*S~\251,k<\\]\331\232\2160\r5\255\231\316L\377!\025T\b\3305\3714,\201\370 \201}\327\310\266X\036\277\300\366\310\226\375e`OL\262e\022#\001\250\314`\250Q\237\232\231bo\300\361p\234\366\b\325\342\200J5c\251Y*\354\033\272\n\377G\273\246\236d\300)?\373\f\376\372\370\b\034\022\345\273G_\244=^5Z3\f\001\336\\@8\rg\223\351h\266\016\216\214g\333\200B\333e\302\234\307\006h\373\3408\320f\261\235\207\253+W$x\021Lz\202\312\362Gs\020\322\372Z\026\364\271\273%U\226\243\252\212\300 \004\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.338.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\336\005\305\""
+	.string	"&;\322I\200\030R:\ry\227\265B\034\204&\035\2441;\321\026\332\206Y\325\355]\n\207\036ACP\247<\246\253Pu\265\377\357:\023\226\022\341nR\004-\371`\210h\226dn4M\315\315]\032|\266\244\371\316E\232\335\204\354\235d\267"
+	.string	"\301"
+	.string	"\273"
+	.string	"\331\230\373\331\306\037\270?o/p\177\276\373\375)\2472\343\304\266I\273\2223\260\216\246$u\242qb/X\013ZYH\327Dy\225\215\023\233\301\225\240\215~\361\306\033'\366\216\232TJ\225s\276q\373\303\241n\034\356\347\241t\367P\367\231\033\205\031\251q\367\231\004Dy\207aX\374Y%s\316\271\237\226\310\361\357i\332j\303\375\212\002w\277\257z\003\246-\275\257)@\245\237\027\nM\032\024\250t\323\274@\224t\302\001\211\314"
+	.ascii	"j~]7@_"
+	.string	"\265f\204t\213\307\r\220\310<\020\006\312\314\207\257F\300^\255\004n\263q\3109\367m\351}{w\313\350n\021\335w@\265\373\003\b[\311\244\r\217=\273\353\276\230\231\260\257\203\221\251o.\367\313\253k\314\204\2079\202\351\177!\241\200+DN\353[\"F\354\354\\\t\367B\002\2010\347\254\241\237\365.%L\2348q\177\336\364\304\262P%^]6\201j\340\255us~\342\267\360\334\bs\346e\271\026\024}\251\237\235\202\247\036\345\271>*\352\321\376\3606WZY\211\304aw\325F\265\265\335.\227\313e\333!\335\001j\333p\265\257M\355\323\246\266\t\240\266\275\325\256\266\332\3071\213?\004\2449\037-\325\362\323\231%\t\226\241\0262s\320(L\262A\205%\251\222\331g\314\261\362+4Z(\201Q\230\264\323\004\214*\231\003\370\350vc \336Q\217\236\366D\256\331q\364\331-1ERN\033\325="
+	.ascii	"+M\355(\305\312VH\367q\217\3335\327\035\356\261\204\231\230\254"
+	.ascii	"\356`\252\212Z:t\342\325\245\217c\245)\217=\234\037hO\314\237"
+	.ascii	"kZ+\246\252L\205Zm7\006\202\203\324\243\246\275\362\311gwm\177"
+	.ascii	"$hz\2646\312\036G]k{\252\300|U\r\324\325\340\250[\316\276\f\375"
+	.ascii	"\344\225\230\b.\202\215\030\261A\351\232\023b\265\375\263\243"
+	.ascii	"\341#8\t\236\302S\367\247]{\300\0047\251G\2535\261\322\312\216"
+	.ascii	"8\265\033C\301\303z\305\205T\"o\373\310\217\341b_\252;\350\324"
+	.ascii	"\243:\367g\345B\311\024\004\315\302\207B\r\240\236\037\037\036"
+	.ascii	"\027=9\030-x^\344|\202\204r\024\0304P\f\025A9\031@@A9\234\231"
+	.ascii	"9\360l\257\355\315\234s\276\365\351\374\332\323\0370lTu\b\300"
+	.ascii	"+\233u\n\303\277\233\n\026\254L\265i\005Q'\246C3A\2303O7v\177"
+	.ascii	"\332\354\241\224YFM\327.\341^\031\376Y/\224\314C\355\326\245"
+	.ascii	"\321)\353\321k?\374\201\374\312\220\224\310\234\367\317*\017"
+	.ascii	"|$\rO\275)\335J&\351\326\266\202f:\216\244[\006\245Y\311\342"
+	.ascii	"\355#k\016\\\334\351,\310\n\232\361\352\262w\273\026U\024\367"
+	.ascii	"\210\360\357g\274\203\261\263%)\225\331i\273\342\250\277\237"
+	.ascii	"\"ldt\177\236^(\331\206Z\340\001\200\211\250\2218\006\2212C#"
+	.ascii	"\201\220$\005)\346\220\002\2219c\035\021\200ID(I\332\377\fCT"
+	.ascii	"\007|*\371QL\240\225\004n\350\217ef\262\332\261r\360w\225U\216"
+	.ascii	"\230\254\2173\263\215\266\021\212\210\361\235^\270\313\020\201"
+	.ascii	"\236\207*\347`\337\211_JI\244\240\363`\322\241E\020\211\374&"
+	.ascii	"\207\222hc\204\325\201\267q\340\356\036w\373\026W\316\274z(u"
+	.ascii	"\316JC\366\376\225\272\321\361\233\201T\372\361\372\261\356\023"
+	.ascii	"k\300\203\205\323`\211OWC\202\352\233\227\r4\205:\227\2445\212"
+	.ascii	"\016<\353M\356(\277\261G\355D\234ydl4\222\362C\224\006|\370\351"
+	.ascii	"\207\250@\314\242\274\330\017M\f3\323\203\261qL\216\360\005\264"
+	.ascii	"\3660\033=\322\232\321v\024\243l\242\206j\026\352\370\220\t\001"
+	.ascii	"\265\363\013)\327\273iVP\335\034\304\213\017\037\245\231\335"
+	.ascii	"\350BV\243@\343*dW\267\031\202k\305\261\027\362\234\326,\006"
+	.ascii	"H\277zT\215\"\237\252\327\2754"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.340.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`!\001\325\f"
+	.string	"fWUB\020o\225\016\340|\023\2456\201\022\253D\240;DC\372\013U\t\324\264\3341\235\004&Z\377\302\331|\373b,\325|C\001\006\325\373\343\017"
+	.string	"JE\310H\004\256R!\002\250\b\241.t}D6\331;\245="
+	.string	"A"
+	.string	"H"
+	.string	"\333I_v\262\273\356\364!l\237\354\220\327\330\262<\332!\236\204E\031\230}P\350\240\355\356w:;|\374\224\333\350\243>)\255\013\227\002\276I0\273\353\311\353\246\267]\300\366\002\373\020\002.\n\206\332\004\030m\267~\247\322\276\317\361\f\277\303\335\306\351\032%\351\325u\261.\3637\352G\214\327(\005X\024\373\026\310\354\204\310n\265\234\37229u=\001\356t\362\001\334\251M\317p%\305\307n w\372\227\206\025 T\244\344\210%\322\026\035\310\257|\331_\301\243\306b!\242\232(91<\267o;/\354m\233\201"
+	.string	"\200\355Z\030i\261\033\250\211\017\347\270\207I\333f\2501\227\204C\255\212\240m\204j1\231\344\325X\366\214BP\201HL\300\t\035@\300\351\204\031\217\350ysy"
+	.string	"j>\233L\003\315\027b\220\001}\233P\374.\025\203\242N\370\215@0\374:\333\362\363\302\230\324T\315\211\361\017\347\223x\211\217\357\301 P~u\352\007\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\326g\002\004D\3010W\270-+\004\004!\211\021\"\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.341.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\333\006\225 "
+	.string	"\366w\302H\220XN:\302\217q\226\340]\3412Uo\213t\016fb=!0\201\007\374\021\364R\016\211\017\017)\364?f\316\205\323h\307\ns\0060\001\304\004\">\302\210\030E\013H\371\230\235\304\006,S\177[3b\t![\246\024\251"
+	.string	"\230"
+	.string	"\266"
+	.string	"\373\257$a\205A\211\334\353|\021\02596\265\311\253\205\002\363\244\205\346\356\205I\017\"\215\302*\025\345]\373C\336u>\210d\\\255Wbc\265\n\023\234t\217yR\347\002\312\223\343\003\224'\355\013\261\235\024\345\323N\2730\253\346\230\371x\372\"Sk\365\235\2449~>\2073o%9\322\325\235\376BI)=\307\206\033\315\322\266\314\235[\311\223z\032uj\255:)\247%=\224m\215\007\273i\305,L\355\n\006\325\351T\323\214\0259)\24627\324\032\376*\212\252\\"
+	.string	"\327\335\036\324Z\375%\032\367\356\266\223\330\226`\227\301f\255J\257\362\221\312\261z\253j\206\344G\255\265'\346W\331\0173\205\265w\362\364\301\030\304\247=\343\335R\252\263\224\322\203\275@\2312Og\226\266\350\027\217T\236.\365>\315`\332\242w\353\257{X\332CD{(\037\354\327\321\325Fl\242JK\261Lu\037+\305a\227\353\233rmC\256k\3105\317\\\323\340\326;r\2553\3279s\215\273\255\315r}+\327e\271&\377\365\217\344\232\216\353\275\360\377\316\002\035\324\250\365E\321L\265\"\231"
+	.ascii	"m\337>X\222\255\323\231\006\036\"\312Q\035=Z=\205\022Gs4\247"
+	.ascii	"\315\251\312\236p1\024\026\204\371!\200\243o\002L\343\242?0\324"
+	.ascii	"\"+)\226M\224&5\362\332\322\264l\266+\\\315\004\217\205\177\371"
+	.ascii	"\3011\351\251\200hd\357\005\201\220\267\013G\353r\243\276.S8"
+	.ascii	"[b\270\226\f?\323PR\037`\226\265(\357\005m\2148KR{\003\007\273"
+	.ascii	"\303\257x\330\331@\267\022\304sVkeP\005\205\220\317\343\244\257"
+	.ascii	"\242<IR\037 \026\256\256\261?(\203\250\264m\246\367Pk\230E)\226"
+	.ascii	"M\305GB\364\"\305\2372 \212X\231\017\205\367\204\313\320oBCf"
+	.ascii	"\005\345G\265\252\275%>\023\247\005\026\361\033\241\023\342\247"
+	.ascii	"\003\242h\202\016\350\b\b\304xT$\204B\210tPO\212\337\007\242"
+	.ascii	" \240\021\037|EC@$|AF'|=\004\374+!d\344;\372\375\214|:\333{\212"
+	.ascii	"\303\017\226(\223\037\366\323b\261\250\226\333-\202\203\361\355"
+	.ascii	"\215\254\213\363\306\200\263Z\235\016ub\231N\r\f\2349N\035G\202"
+	.ascii	"j\304\023\337\013\232\341nv,\024\213s\353\206\372\306\224\331"
+	.ascii	"P{\003\207\036\353t\002w\305\271\305sfC}\200c\236\274\027tb\362"
+	.ascii	"l\r\2203\310\311\265K\247\220U\3721pVC}a\246x4\224w\246\215\306"
+	.ascii	"\313\332mgw\324>\203\020\"\234\315Jxk?<Y;\352K+\353Z\322Q\007"
+	.ascii	"\200\205\250QL\342\034sFF\202\214\202$\205\f\007\320\002\021"
+	.ascii	"\232Z7\021\3004\347\034\032*)lZ\277\003\344\374\237\256,\313"
+	.ascii	"\252\265\t\250\301\277\330N\236Y\276\211\0220\013r\372\270~\035"
+	.ascii	"E\336=\271CJ`\005\"i3\344k\302n\311\b\247\017J<\n\355\032\247"
+	.ascii	"\020E\235f\233\202\307e\272\240]\320\263\315\305\354\200*\240"
+	.ascii	"hW\337zH\223\353t)\227t\351\360#N1\004\344t\272}j\324\277\023"
+	.ascii	"(a\310\020Bw\035\333\314\307\037\027\362A\357f\371E~\207/\267"
+	.ascii	"\223F\004\rp|\224VBB\212UD\243\305\224\220\220\362;\b\376\201"
+	.ascii	"9O\315l\372\0010\263Q(\221[\342-\t\300\341\2504\335\203\226\263"
+	.ascii	"C0`t\364\230\267\256\354iSa\252\200\227'\254\273\220a(\271X*"
+	.ascii	"A\346\254\246\301s\005\301\241|\223\326\355\225\202*\206\260"
+	.ascii	"o\332\274\205\307m\035d(-\224E\002a02\ru\317\342E\005"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.344.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`;\001\005\r"
+	.string	"\306\025PA M&\035\023\246\250*\220\274DE\372\342~\006p\306\257"
+	.string	"$k\340\254\020\270MU\007\240\200\b\210\220b\206\233~t\026$<\"\004\204\200U\200\371\to\340_)\250\027\267\331?!D6\331;\245<"
+	.string	"<"
+	.string	"?"
+	.ascii	"\366\214\374\261E|\\\355\305\353A\202\030\211\335\365^\251\203"
+	.ascii	"\177N'\367\361[\237\rB\300h3\022\350\364\343g\351\203\2106#-"
+	.string	"\370\2448\367\230\354\256!\f\356z\333\035\2667\354S\b%\b\320,'U\231r\347\226\246ln\372\035\367\222M\234v\025\334l\213\252\036 \370\025\016\343\334\345\227\265\223\211\343\277>v\3562%\225\266\323\204\335\355L\277\345\261#\221\327K\260\003%\016\244\351\364\243\301g\260X\214\026\360\331\245b\265\273\034\030.\303\370\254Wg\302y1\354^i)\216\b\315\233\037\323\0377\007\346\305\323\217\177\312B\004\024Y\023QP\f\202Z\215\327\214\022\001\006%\b\302\n\006\374\006T<\002\227/\343\201\232\215'\301pX\300\242\361\f\204\241\306\213\330\236\347\226\246\334:\344\0029\"k!*\3520EO(U\231\322\371\032\276\201\342\263\034\340\233\027\277\356\025@) p\202\231D\323\003\347\327\333\316\030\205\235o\254\333\254\332\321\nt\315H\026tX\314\013#\r$\026\3448\302\001\201\223\230QK#\310!\277\003T\r"
+	.ascii	"\331\353\312&\022\255a>\034]\013\234i\274A\220$\321\323H\366"
+	.ascii	"KcC\022\013\347t\013\355\2245\003\240\366\304\244\266\375'\274"
+	.ascii	"1"
+	.text
+	.section	.gnu.lto_stopInTestMode.part.0.345.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"-\b"
+	.string	"\002\01766Po\322\001\020\245\21261K\022\265B\356\331\366\n\214\354)\006f\373uh\331FP>\200FM\013\307\232\005\3753\323\302\331\272\257\232\026\036\304\207\350A\366\226;\245\276.\026X\006\342\302Dd\346\304\003Fb^\331f^\020\214Q8d\263\002\303\262i\331\206\217\253#7|\035\352\344\321\217U\225dM\345w7\321\370\"\336p\340\271K\237S]^\344\321B\262\342\201\237#\264/0\3409\023\240| \324\351\243\033T\2225>\256\216\354\030M\251\202\216\335\215/\265\0372e\304~\251c[\326\345Klwl\357]\310\202\254\331\336A\306n\n&O\343\204ew\347\245\202\\\273\302\250\371/]\200\013m\327\201\020\307\241\301#"
+	.string	"\303\356:@t\313\333^\260\235`[%\021"
+	.string	"g\325\003\233\300x\360_\f18\004\b\210\202a\256p\030&.\316\210E\235\013Lw\032"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`)\032-N"
+	.ascii	"J{\024\032H\200\226N:\2772\261S8\264\247Mr_C\313,sx\b2~\030\377"
+	.ascii	"?\222f,\362\206d\036>\f\230\233i}wb\314\037w\234CB\251\376\223"
+	.ascii	"P\252\357\002\241\246e\272\356\021:\334{\271\302\306Q\312\324"
+	.ascii	"\304\336I\006\203\001\212\001\227\001\364\307G\177\372?`\364"
+	.ascii	"\257O\237\211Zv\363\211\321\027\375\241\260o\244\200\3664\245"
+	.ascii	"\002\206\006\3734\366\372AT\030\324\322k\316\263a\232\246\345"
+	.ascii	"\365\227\360\372H\311\376\221\005\323\324\354\367\245/D\357\232"
+	.ascii	"N\241v\375\031\364\004\033}u\214\305\013\307\371\220M\313\216"
+	.ascii	"\254\245K_\211\3225\225\301\205\372ly\220\275k\351\023\321\""
+	.ascii	"\326\021\331\263\364a\320\271\357\311=\214\361xX\236\214\373"
+	.ascii	"]\361v>\270\327\235\375\2427>\232} 7F\372H\360][\377\207\262"
+	.ascii	"\235\316g\342H\326\3721\350\025\366\242\306_\254p\026\376\252"
+	.ascii	"\322\267\224\312\345\322\216\005\355qg/\232\035n\312O)7\313n"
+	.ascii	"\205x7\262\277E9\025(o{\302uN\316\326\344iLn\034\343.\"\276\266"
+	.ascii	"\344gb7S\362)I.\245|\025$'\013;\024\260\276\216\257?\361zS\027"
+	.ascii	"\233\\,\347\243\360\003\205\350G\3728\250\215T\226/\337j\336"
+	.ascii	"\243Z_b\344L\212<\211/\353cuoo\017\355D\232\365\2060\236\217"
+	.ascii	"{.\204\255`\365}\320\025|6\303\245\340\242\217\257(\220"
+	.string	"O\310o\300\"wd\267\352\013\253^\203\212\223S\375\0364\310\347\244x\316\027\325\277A\241\3726(\020\0063\341)I\367\247\276\017ub.ML\367\037\274\305W\231o\203%\330N\301/}\341c\346_P(\f\032anf(C\007\020\f\006\203g\352'Qf\276q\020\365\367\202\325\251!\312\237\256\355\007\304\275\217J\022\275\016\033\356y\t\021H\026\r\367/rb\245\216\303\340\324\034{6\201\316\226\030\211So\356\251\226W\327\026\002\373'\365`K\232\261\377q\031\345\340<\234\n\304\303\2511\366\002\260H]\261\036N\265\360*'\345\006\320\201\004\225\300\255\001s\240\312X`\371\345@\345\371\003\253\244$\234<P\177\345k\021qF\027\256\263\251/\257\223U\004\304w6U\303yn\n94\300\246\"8\331\216\246\362\324\r\2504w\246\224\001\306\234\002\352\357\374\331\377)IG\306^\004\b\250\277<\307"
+	.ascii	"\265\301\001\004\221\001\252\214}\025C\363!\342\343\257\206\365"
+	.ascii	"\247\300\372U_}+\257>\221\256\276\020\256~\221#}\255\255\276"
+	.ascii	"\021\255\376\226\221\376\221\"\375,Y}(\"Ma\f\351s\t\351\207a"
+	.ascii	"\365\301\256\372YV\375\257\252~\027US;\325w\n\3224(\325\264'"
+	.ascii	"\252\251\020\252\377\005H\037\314S\337\313\251\237\327\324\327"
+	.ascii	"\373\321\347r\373^\230\372]\206\375\343R\037\351\243\257\245"
+	.ascii	"G\177\213R?JR\237\310\243\257\266\243\177\005\251\217v\324/3"
+	.ascii	"\3527\321\321\227\312\321w\202\243\177U\324/o\364\305l\364\225"
+	.ascii	"\020\365\207\f\365\261\204\372T5\372@h\364\237\036\f\006\231"
+	.ascii	"sf\364\243Ne\260\232\217y\205\t\024'>x\b\3425\037s\006\024\031"
+	.ascii	"xPp8\301\301\004\006\017%\"\360\255\017\005\3426\037\215\021"
+	.ascii	"\234\246\223d\247u\243{\304iU\315\004Rr$N\253@\3634h\306gu\250"
+	.ascii	"k\351\210\271\200\255\025_\304e\224X\347\346\3438\270\254~x]"
+	.ascii	"\b[$\231X[\260\030~\001\\\025\321\360\307\304\252\302\022]\034"
+	.ascii	"k\203\211\265\200%p\326\3343\\\325\020\026\037\313 &V\231{\243"
+	.ascii	"\204\301\304\n\2747\230Xc\312#\023+\017#\231X5\3148i\360X\315"
+	.ascii	"y\r\036\2537\234\344\261j\340\0268\205.\201!\036\273\033\323"
+	.ascii	"\\\226\f\360\226\307jL\330\351Wy^F\330\207\247A0\026\253\300"
+	.ascii	" .\353K\036.\271\254\277\362\207\301\352\317\306`0 \006\253&"
+	.ascii	"n\210\363\365+\030\354\001a9\271S=\234\035\356\006\233\223so"
+	.ascii	"N\004\245\201[\300\336Fh*\210\346\244\2713>;u\006x\276\302T\220"
+	.ascii	"\022\037w\352\257\374\331\303\330\251/o\317_;\365\302\371k\247"
+	.ascii	"V\271S\316\026\337\314\322"
+	.string	"\253\313n]\255,\"XWTSQPNMLu\270\247W&\317\273\213<r9\267\314\311\305\025\337\256i\273\316\255R\353\022\261W'U9u\243\254\323\331T2]:\264z'^\231\274w\026y\036\313-\347\\)w\343\354\333\351Uv]-\213uR\225QNg\352\026,T\2448a\202\304\210\362\254\344\310\033\b\017\033\354\371\210<s.\316\275\2717\366A\235\212\300@\001\002eMIS\322\330\231\262G\247\316\334\013u\252\f\220\252\035Y\336\323\251\277\373'\227\366\226\374\205N=\236N\3747\2419<P\f\315\207\343\274\356\371\253G\227\371\001\311\237\223\327\266\314\377\362h\330q\234V\330\177\\/\216\274\226\025v\376*\273\362Ae?U.\225\303(\273\004U2\235\017`D\312\336\210\215>\262c\332o\323e:\377\303\3740\35438\212\214]\336W\\;\362\2359\200\215\265\305\360\214\215\225\205\371"
+	.string	"\345\220\210M6V\025a\257B,\022\263\261\261\236\020\332\260\261\222\270\327\324ac\035Q\206"
+	.string	"\341\241\303\006\241\006\034\2730\0346\326\233\333$\252\210\307H6V\032\213\307\306:ce\316&6V`\021\033kLy'62 \212Qr\035\033\353O\310jl\224Y\202\253\372\023\033\235X\345=1\033c)r\234\031\224\231\024\277q\261^\370C\231A\2351\033\027\353\205\"~\2535Jl\326\032\341%\370\330\342\025&\200\315*3\374\r]V\225"
+	.ascii	"l\362\024\256\"O|\355\330\254@!\321\204\240\244V\304bC7a\233"
+	.ascii	"\271\303&\232\217\220\025\217\261\311]\220"
+	.string	"zx\260\030\233\365g\236\213FzE\314\306n2\330\255\376\302\316o\310<)f\343\266z{$n\253\rn\355\357\214\2712V\246|\322\2359\017\301\fj\n\037\231\255\322\224\326K\031\206\331j\315y6\2032{b$\263\235\254+F\017_\3415F\363\021\252:\017^\253\f\016@\215\257\324\230!\247\261Z\375\355`\265\332 \307\255\301i\365f\002N\253?\341+\r\247}*H\251\355:\002\201\365\250A4\n\251\"\021\021\021I\222$\215\001\361\005\2041\307\210\233\003\021\200\034\311\024\242LD$\020Q\222\364\005\257)\206\020\262gv`6pr?!X\300!ch\271\212\276\022<\335k\004\005\362\245b\320\300xH}\345\\8\340\362!\250\207I\002Io\266\220|\220\032\240}\201\370\037_g\347_c\227w\245\326\220\270\242\236Y\035\277\351\246)\021`\301\023\313\351\216/\266\315\223\344\007\\Jy\362"
+	.string	"\246\205?\224\276\241\033\311\253\223y\017\257B\302\260^\226\003IA\231(\260\363\334\001K\210\007\273\315\266\240\337\222i\223\210\216_=\017\210\327\274t\362\216\371`\035"
+	.ascii	"D\365\020\204.Ni\2412pT\240\376\236$\377\275\032\030\016.\202"
+	.ascii	"\240\013\210\240\\`\027 \307\301\361\370\377\022s\374\001&8\022"
+	.ascii	"%\375\013@/*<(\250\354\223\311\315\bp\371(\240\320G|\260\355"
+	.ascii	"\217\203\210\245<\263\303\313\234\351\200q\216t\031\332\335\261"
+	.ascii	"\326\023\277\374\232\3034j\022\345MQG\020n\274\203\373\272)J"
+	.ascii	"\376K\235&.=\271\035\333\347KK6\025\030 \307(\352\003\036_EB"
+	.ascii	"\264\255\004\003"
+	.string	"naT?\254\252\271\332 \\\016]\200\205\310_*_)/_\343\b\002\333\224\213"
+	.ascii	"\276\f\344W\300tf'\rb\236\016\t`\344\177\t\224\324\317\212\236"
+	.ascii	"\035]\223\254qK\255\034\3007\246\177\333\352"
+	.string	"\027\346\313(\177:\260fT'\343\317\373\250N\376\265\311\2776\371\327\246#\177\245{\017\336E{\362\257M~\256\367\351z\237\256\367\351z_\tL\243\351<\232\316\243\351<\232\316\243\351\274\301\367\366\034\366\323\276\306\204\264\253{\207+\337\327\345ue\031\004L\025\332\373\356\013\022U@\245\353\220\314\016\013\362\312:\206\304\231&\3612\"4:\2467\372)\261\025\353\006\b\376Q\013\005\"\016\257M\222\324?\341\t\206\332.{*\316u\030\360\331\207\350\207\267;W\321\300\243\024'\243\331\242\304q\241Q\257\303\340\3430\3708\f>\016\203\217\303\340\3430\3708\f>\016\203\217\303\340\3430\3708\f>\016\203\217\303\340\3430\3708\f>\016\203\217\303`\017`\f\201\246\343\024UBl\340\336\370\332\367dE~\006\362\311\200\321\220[\244\t!\313\330\207Ou$\373\343Y\003\246t\230]0\342\301\273E\332\307\257\033"
+	.string	"\272@7\246W\221\240\3204\240\366\257\266\327\371\273oe5\201|\230X\341\347\335<?\215\226\215`\333\216F\274rB\256=?\024Y\t\230\263\024G\330\224mI*?\262s\026\252\325V\\\367oL\212\275\247\322J\234'~V6\205\031=\222\215\204@\201B\007\345\232\262Ht\\\003\301!\323\351t\332T'\232\366\351d\352*\265~\252L\266*\260\265\226\353\345r\361\305]\223\274\252\n\216\244/\265V\006.\240\361\026gd\n\307::X\177[\031\224\002l\t\005HB$?\nP\354L\301V\247\234\2047"
+	.ascii	"!\264\316\201\006\311H\300\311\276\364\236\247\375\263S\244\354"
+	.ascii	"=\356\210\341\322\031\200j"
+	.text
+	.section	.gnu.lto_.refs.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`\030\007\305$"
+	.string	"\252Q\\\0163\200\362\2449\002[$\241\201%\f\267\177k\221\361\275"
+	.string	"%\214\345\034\305\366\034\002G\336>\246\375\333\227B\260\006\313\031\245\316\326\337\335\232Z\223F\310\3362\005\276"
+	.string	"\353"
+	.string	"\321"
+	.string	"\367\271\275\367\3346q\273\304\202W\304\202C\210\275\037\304\256p{B\355\333\2027\301\355=p;L\354- v"
+	.ascii	"\005\177\335\316R0\326m\332m\002\003\257j\257U\355!\350\216\035"
+	.ascii	"\030\202\355\005\266\013\204m\013{\313\300\264\002\t\320\316"
+	.ascii	"\006\374l\005p\377\361\372\036\260\343\251\235\016\330\"\274"
+	.ascii	"\366\020`\t^;\370Z\200\327^]ky}\325\365\254\366\353\n\200\353"
+	.ascii	"\214\353\267U\213\313\200{\027d-\306\275\n\262\276qo\202\254"
+	.ascii	"\303\262&\2205X\326^\334]Yoqke\215\225\365\2146W\213\325\025"
+	.ascii	"\213{\255\336{eUF\273\243\375h\255\272[\263\261d\323\272g\334"
+	.ascii	"\2627\307\375\336\264\257\300\002\357M\232(\235\340\236$\211"
+	.ascii	"\366\216D\373\242Z\203\333\211S\033D\355\r"
+	.string	"\265-\324\226P\233\001\206\025\324\006P\2733Q\002lg\350\366v\204nwjH\334\2359pgF\314\227.\025\356\266`\251\"\305\311\210;%\"\356\214\204\270\023\002b.\325\250\017s\240<i\302D\tR\243E\207\006\001\3320\307\007\217\207\2719o\330\244!\003\246\213\026+S\234$10GDU)Q\2350Mj\204h\320\037=q\334\240\031\323\345\212\201\037\225)Q\232,IR\244\303o\310*T\246H\211\362\244\311R\207K\342pG\033\316H\303\021\031\312pB\2010\354\311\023\366;s.|\242\366\b\013c\250\360X\205#\330n0\266\002\331\t(pm\023\026 \341\257\b{AX\353v\355\3012\007\277\006\031\304\364\"E\211\016\025\022{\017\022\273\237\333\235\355\307u\006\227\343z2^\255+\333+\263\335\331^\214Y\004\007\302.z\r\234s\201\212\336\001\266\356\0250{\301\002\230x\277\266^"
+	.string	"\023\2755\333X\003^+\f\257\354\004WF{\273\023\334\216\366r'\270\034\307\301\260\375\352^\257\331\013`6W\226\354\320\241\255L\2742\023w\336\213\254W\335;\033\273\353\336\327u![K\350\253\204\336w\320\026\335\007\345=q\202\344\004\367\0351B\243\275\217\b-T\247\332\"j\207\325\256\321\266\242-\243\261\370\332\316@\227\023\320\037\376\031C?#\330\347\001\371\034\300\302"
+	.ascii	"4\254\205eu\317\335=+\266\326\332yi\263v\270\334<w\252\230\365"
+	.ascii	"z\347\335\252\321d\355\314\2653\205\325.\235\3379Qps\032'{\342"
+	.ascii	"\202\342l\\\220.\203y\336\r\201\201\261\3276\366~\311\356\032"
+	.ascii	"{\271lo\311\336\232\354\275\222\275V;=\223uo7{\271g\342\001\t"
+	.ascii	"\360\215\375\361>Y"
+	.string	"\037\357\233\003\247\315\2324g\312\220\341z\237\2300^\036\227,T\236\224\307\344\366;2\216\252\001\266\237\n\005\352\323</\231x\245\221 }4\317\241\333#\364\305-(\020\240\333\353\003\306\255'\017\236\333\253\023\200[\3168\267\367\304\355-A\342\366\216\270=\017]\334\r\032no\206\333ka&\n3=\3416\204\333\353\3406\003\261WL\354\002\267\005\200\335\336\257\333\353%6h\217|x\274\035OG\016\3317Q\034\257\254\273\275\033\334\004\334\b\262\016\3436\300= k-\333\265\356P\033\265WV\263s\026-\342\270\032Vi\023=\343*J\243\033\200\256\250Ahf\210qDFF$I\013\222\244\003\320\002\251\232Q\016\020\310\225\2359c&\326\344\263&l\002\265=\277_\036\235\233\241\263\320\223\332\315\025#\245n\301\303WSN\2121\234\232\224\232m\3575\263\"%V\027!\023\343\362\342[\n\030\345"
+	.ascii	"\331\206\335\363\2642,\032'\037r\f\207\200\236dr\255\206]\234"
+	.ascii	"\344S\001rm\373\366'\f^\032\023\327\227\230\336\353X\302+9\007"
+	.ascii	"83f\202`\365w\225\244\245\tB\301Tn\206\222\355\312nv\346\320"
+	.ascii	"\275D\212\032!t\254\346~\375\232\017\331O\342\022\022\226]\001"
+	.ascii	"\316n=\203\334\212\273\0202\007\013\234\005\374\241Zb\275W\026"
+	.ascii	"\001\222X\026!Dn\302\310\334v\232\327g\004#\t\361\267Ky\312p"
+	.ascii	" \375\342\303\321\325G\371\246\327\305\337\262\200\336r\267\001"
+	.ascii	"K\251\202\b\3441\251\242\024 7\033\245\252\2704ee}\0257\255\255"
+	.ascii	"\377"
+	.text
+	.section	.gnu.lto_.decls.43ef1dd3fa501e1a,"e",@progbits
+	.string	"(\265/\375`o\376\315\374\003\3769\206\372\025S\020(e%5\006;8\016\330\003\216\305o~\234\206\320\311p=\372\207\207|\204\257\372\241\232\034\207]\017\364\307\367\333\3158\226"
+	.string	"Y8\020\341bJ\337n\201\b\267\024\245\370\275"
+	.string	"\207S!\226\373\206M\247eq\032\fM\337\307\254\264\3226\271\367J\"e\n"
+	.ascii	"\023v\026\307\026\323#_\246G\316\312\252\030\211N\245O\362\336"
+	.ascii	"\270\250\312\346\226\246\371\212\024\262)cT\304\246@Z\312W\347"
+	.ascii	"\313\363\231])\201\024f\272W&oO\256\006\bW\204D\363\321\231\255"
+	.ascii	"\273\274/R\232\346\250\021q\322\326\205\247P\234L\247Z\312\267"
+	.ascii	"\304\307\204hd|_\2569X\260|M\252\350'\355\244\275\364\230f\242"
+	.ascii	"\3034\225^\242\243\372\206^\322S\232\207.\242\205\350\035\232"
+	.ascii	"I\017\321\\\372\207\336\322Gt\222\356\322J\264\2256\242\241t"
+	.ascii	"\225\306\322:4\022\255\244\243\264\230&\323R\035D\327\3204\364"
+	.ascii	"\225\216\242s\350,\r\246\201h\033:\211v\242}\350&\335C\177\351"
+	.ascii	"&\272L\023\321P\264\231\326\3228\364\f\375D\313\300R-\245\215"
+	.ascii	"\256\2174\322\036\030\033\3210w\300\340\274-VS<\207-\215\226"
+	.ascii	"\362\025\361}\371\314\242&H\0013}\337\027\247\211\306E\361tL"
+	.ascii	"\315\227\344\317Gf\352L\247Q\224\232D\303\374x\317'fo\352{\342"
+	.ascii	"\305\t\356FtJ\306eE/N\277pS\234\247\245|Z\256\246\357k\246\245"
+	.ascii	"|iR\276\246\357k\346cr\005\313\b\277\232\325\303>\353\215w\373"
+	.ascii	"\3064\373\306\267}c\332\276q\311\376\363]\033\237\033\037\036"
+	.ascii	"\316\341%\013[\326v|z5\330\232d}\343\327\246\343\233\343\273"
+	.ascii	"\363\311\301R_\035\037\2347B\246\276:\2768C\246`\246d\272\242"
+	.ascii	"\276:>;\017\354\264\342\302\336\327L\355\242\262#\003\3247\346"
+	.ascii	"\33076\355\033m\354\033i\354\033g\354\033\2216\236\342\f\253"
+	.ascii	"\004\330g}\361\315~\321\313~qm\277\350d\277Xd\277x\265_\244\261"
+	.ascii	"O\234\356\023\347\366\211i\373\304$\373D\255}\"\216}\342\321"
+	.ascii	"\376\360\315\376\360m\177\270\266?\224\356\017\211\354\017\251"
+	.ascii	"\366\207I\373B7\373B\271}\241\226}\241t_\b\266/\334\332\0276"
+	.ascii	"\355\007\365\366\203m\366\203p\373A\266\375\240\222\375\340\325"
+	.ascii	"~\320\306>\360\315>pn\037\310\266\017\\\262\017\334\332\007>"
+	.ascii	"\355\377\360\366\177g\366\177[\366\177Lv\007\234a\375\017k\377"
+	.ascii	"\327\264C\270\331\337_\366\367\224\375\r\266}L\216\327\236_;"
+	.ascii	"\246d\375Md\177\373\330\277\303\031\326o\034\373\373\335g\351"
+	.ascii	"\366\331\266\375\373\214\334\367\365\373\210d.YL\013C\244p\204"
+	.ascii	"\311\032\223\001\335g\244H\246M\216\221\254\317F\331?\237W\227"
+	.ascii	"\\\025\273&[bC|B|A\260\324\327\345\003r\\\307Gu\f\302\217\234"
+	.ascii	"\206\347\250^\2437\0250y\361\242w\276.\037\027\bS\274h\230\332"
+	.ascii	"\345\2074l\353\263U\373\354\323\376\232\267\277\226\331\277O"
+	.ascii	"\253\207\320\216\214\255\035Y\037\203\251\272\363Q\355\300kD"
+	.ascii	"\337\373\366\250s\326\303\247\003\257\3419\252\021\306\354`\371"
+	.ascii	"\262|>|WX\352\353\341\263z6{\337$_\017\037\017\\G<2{\237\330"
+	.ascii	"\265\351\034\252\273\3675\313[\270\344\362\200\372+\222\375\325"
+	.ascii	"k\177\375\261\277\356\330?8\303\3725\307\376}S>) \216$Ft>\251"
+	.ascii	"\037\247\361\325\360\345\370\211\t\321q&k\034D+\250)duB\354x"
+	.ascii	"\231)\022}_3&\"LXLC\246\276'\237\223\017\312\327\344\213\362"
+	.ascii	"\335\300R\037\223\317\206\352e\267DG\324W\253l\226\206oILZ\223"
+	.ascii	" \371\3107\003w\331(\242%\353\374\372d\370\2246\022\232\030\273"
+	.ascii	"\273\373\224~<'\327\361%\t\201m\236\200\351\221\265\017\211\215"
+	.ascii	"\262\323D,\353\253C\234\354TE\367|F\371\216\357"
+	.string	"(\353a\251\357\315xZ\362x\370\336\033\2767w\331\221q\260\275}\t\365\325\255}\025i_\343m\365\305\031V\034\005\350\371N\377\230\343\004FgN\360\316\231\"bp\236\347\3749N\226s72Hf\354\262\306s8\303\312\001\373\254X\016\350\031Nn\002di\210\335\033\366-\207\233\261\274\366\374\346\317l\271-O?\020\3634\225u\335\017pI\2247oY_\307\355\343\262\267\034\2474\226\257`A\303pnM\262p=\361 \237\311`2\231\0202\236~5\270\304\246\\\272\224\0351c&-\372\276f@g\362\026\274F42{\235X.'3\344\3562]n\223\327d4\231MN\223\335d5X\232\317\3442\307h\370\315\177\314V)&b\226z\364u\226}\215d\377\231\314\030\262\034@\210\230\225\275\357[\374a\301S\"\225u\016\223\347\236\305d\271,\346\203\254\367=\312b\212y\357{T\304X"
+	.string	"\030\013@\217m}UY\365\265\221}\335\265\263\227\f\207\245?\371\313\030\244\033VY_k\355\016\274\370g\375\036\376Y\257q\354\353\032\373h8\303zm\264\357\253\263\377\2063\254\367M\367}t\373t8\303\332\301\2133\254\353\213}\326\254\006\364\274\206\201\037Y]Ys`%\215\214\313\026Z\3269-g\264\\\3459-S9\b\020.L\312i\372}\2170\026"
+	.ascii	"\021c\001\250nE\216\242\254\372\2761\373\317S\316~r\316P\251"
+	.ascii	"\311\372,'\311N|\322'\006\220Q\213\222\3152\224,\315R\2604\237"
+	.ascii	"\345'`\362Y\376\302k>\263(Ke\353m\232\217\200\261E\201\220\340"
+	.ascii	":\244\265(\332Y\216Fi\233\276\257\231\006$\246\220 \021\352\373"
+	.ascii	"\2564\301]V\252\270e}\037\224\375?\217e\261L\206\245\271,3\361"
+	.ascii	"`\211\223\262\260-\264\262\254\004K\301sh\257\336z\302c,\354"
+	.ascii	"}\337\037\r4\320@\250\245\314\356j\353\373\202\354\373v\354\373"
+	.ascii	"\244\366}P\373\276\246}\237\321~\216\263?\305\031\326\347\272"
+	.ascii	"\375L\267\377l$\202\242\331T\323\217\"\035\206u\316 \205\021"
+	.ascii	"\321\\G\330\310\274\206\020\255\250\021\002\227\365\220?\013"
+	.ascii	"\311]\031\210P3\tBcJ\326\330\fgX\177r\020 \300\2608\036\\\262"
+	.ascii	"\3763\020\256a\230#Q\354\262\376\361\363;\023\362\343F\326\317"
+	.ascii	"[\366\0274n\346\320\t\363e\016\237y\273\352\234\351\3413\304"
+	.ascii	"\243\2703#\214\227\006\027\235f)l\207\345\020\217\214oR\032\272"
+	.ascii	"h"
+	.string	"^\226\302w\360\031\342\021\030|\366\003-\255\245\301j\260\224\2565\321|\224\224\225|\322\247\022]oS\240g\251L#7\371\244O\233J\232\025L'\243-K\345\031Y\211\230d|\337.\266(\335\217\367\362\373e\372\276\357\377\034\225}\344\255\314#\347\310=\262V\306\221\257rV\236\312X\271*Se\035\331*\357\300\322,\225o<;\345'\234\006\257Q3}_\2639Y\n\337a<\237\331\225\337\214.\271)\334\217\277<Ke(\\\3473\273\262g\244\351M\337\327L\203\037\r4\320\300\207T\006/\252\002\375\334\266\367\034\316\260b&\354\263>\223\355\\#\333\300\322\016\231\311\254\370;\003\347\n-\353g\260}\334a-vX\237\213\354\347\255\375\274c?;e\245?#a:,%\013\257\344\311\230\312\372Yi\013\261\317:\001\336>\266\333\035\250\331\307d\366\315\260\317\212\361\320\2108\244\204Ue\215\353"
+	.ascii	"\035\333\031\301\353\307X\326>0\373\270\313\376\2258\030\r\277"
+	.ascii	"Q{\337WCQ\216\021\332\231\2541\034\240\3438"
+	.ascii	"\022\254\271a\311\232\305>\3531\226\215_\234a\375\034\366Y1\033"
+	.ascii	"\334\006K1\300n\314\212\331\353NZ\224\254\217\321"
+	.string	"\3661\006\253oo\017c\260\0367\331\307F\366\247\330g\375\034\316\260\036\003\331?\026s|\346\307r8\f6\203\2634\260Q[\244Y\262\306c0\031,\335\200\313\034\307a0W\217\314^3;!HPY\037\367\330\034x_\274a\305{{x\303\212\343\200\216\305\370\256p\221\221\227\365\261\216\335\001\316\260\256\330g5\342\fk\306>+~\261\317\372+8\303\372c/\033X&X\260\200\274a\260\223\264X)\353\262%\310\304\314\033\223\254\357A\033\236BL2\276IVjD\337\367\275\007?F\373A\200\200\267\3404\274F42\276Hk\230\242\357k\366\037\273a-\230\013\226\342-\370\3121\026\234\345\332\354}\223\336\367=.\373\201\266`6<\305'}z\223\242\270Q \206\016\025&w\357\373j\240\301\217\006+\016'g\210l\215\263p\206\025\003\366Y\017\201}\025\366K\330\270\n\266\202\245\021`\265\203"
+	.string	"\341>#(o\331\373\232\025\207zbzxY\037\001\3738\202\025\357\341\b\326\203\330F\354\263\376\230\312\024\337\022S\326\213\366\276f<)\324\250\341&\353\03779\236\202\245\344\254WC\360k\312\315M\326\330\t~\202\245w\303P\216\243\340\263\377\222\314\336\263\367}\213\270\253\213QW\326\023\340\f\253\306>\3535\330\307f\357\321zAx\3360\336\367}\361\335Vvooo\017\337m\005\001t\334\344\307d\270\314g}\2422{\321\336\367-\256a[|\324\311\372f8\303\272\261\317\252"
+	.string	"\023\337?\021\n\013\217\301>\242"
+	.string	"\243\237-S\203\374\352\017UiG\340\337\022\370\177$~u\351We\2503~U\310\257\332P\243~\225\353Ws\250]\252W\nd\277J\204\005\2018DA\321\217\004\326C\004\326\b\330\016\354\331"
+	.ascii	"\354\022\377o\003\226\353\367\341\002\373\315\252t7\025X\260"
+	.ascii	"\027\360\033\361o\255]\364#\341\337G\330\001\234\360\023K\024"
+	.ascii	"\371a9\034\340\307E\317\277\360\313\317\352\"l\004V\024X\270"
+	.ascii	"\3427\002\013\377\007\360\023\277\212\260+\374W\363\372I\301"
+	.ascii	"\365o\013\374\254\t\026\303n\341\337-\376\235\334\312\377g\200"
+	.ascii	"\022\376=\364\357\346\377\023\001\367P\256\025\370\201\360\013"
+	.ascii	"\241\372\370U-\366\373\002\377\312c\275\361g\032\277\002`\344"
+	.ascii	"\317\236\360\013!\307\230\332\317\177\333\240`\273\377.\202["
+	.string	"8r\016?~\037\224\370U'O\372\211R\377\246\300\217CH\371\026\023k\003\330\020\353\232\n\374@`\363\357\203\377\007\342\377u0\302\377\020~b\f\226\353g\201\374\277\017+t-\261m\254\316\037\233\020\206a\255\330\253\377\267\001f\200R\230\026\301\332\200}u\001\313A\204\177E\321\200\273\375\254\300&\204P\004\370\3252\250\177?\260F\260n\330Zj\016\003\374\207\340'\026\375<\350`;\234\3707\003\376\237\006\277\272\201\252\237\005\341\030~\"\006~\366\203c\240\022\001\201\350\302\257\022\377_\006\373W\327_\025\376Z\313\377\353\300\376*\360W\213\377\017\203\236_\345\371\365\333\257b\370\265\330J\367\273 \237\371\263\226?s\3713\334\237\315\374?\013~=\365k$\277\256\372\177\025\350#\277\366\372\3272?=\364\257s\377*\346\377Q\360\353\344\277\306\375\004\360\353\023\376\365\3557\301\257\013\360k\021\376u\313/"
+	.string	"\277o\313\357s\373}N~_\332\3573\373}U\376\237\004\276)\277/\313\357\343\362\373\332~\237\224_\013\177\r\374\327+\277\b\376|\200?{\310\026\374\031\370\3439\177^\300\237\207\177\356\340\317\036\374?\016\031\001\177\236\340\317#\374\371\202\177\277Y\304\237{\376\274\376Y\3753\317\2373\370\177"
+	.ascii	"\310\301?\377\344\004\374Y\001\177\016\341\317\005\370\263\206"
+	.ascii	"\037/\371q\234\037\323\361\325\371\177\020\374\276\274\337g\347"
+	.ascii	"\367\355\375\277\r>\274\337G\347\367\305\371\365\377\325\312"
+	.ascii	"\277\252\375~\304\374\353\224\237\206\337'\375W(\277\007~\037"
+	.ascii	"\226o\307\357\243\372\177\031\376\265\354_\233\374?\f\031\372"
+	.ascii	"g\026\177V\372\236~\037\216\237\317\357\313\341\203\372\222~"
+	.ascii	"\337\313v\371\331\267\377\327\363\3471\177\236\373\327\350\217"
+	.ascii	"\007[\025YS\370\031\177Ev\216\025\363\377\210?[\346\377\r\177"
+	.ascii	"B\021~\301\237\325\362\377\200\277z\207\335\362\377~X\230\177"
+	.ascii	"h\375\366\317\252\371\261+\226\306\362k2\025\230\305\004~\353"
+	.ascii	"\277\367\376\215\367o\034\352\206_\315\200M\f\013\360o;\371\351"
+	.ascii	"\337u2\324\277\357~\266l\323\3117\376\214#/M\261a\254\330\277"
+	.ascii	"\347\374,\222\237M\362\263J\376-\347g\331v\234\025\307\277\346"
+	.ascii	"\3707\234?s\340\317/\374\371\205\272\206\177k\261G0\213\t\374"
+	.ascii	"l\343`\327\336\\\235H\370\207\001\370q\004\352\213\r\201\372"
+	.ascii	"\374W\021\333n\275\300\233\275\341\337\022\374{\252\232\240\226"
+	.ascii	"`\205{\202\177\013\340\337u\273\0027?\226@%\241.\340_\025\260"
+	.ascii	"\333\370\226\376\025\001\233"
+	.string	"\r\016\300^\363\263p\376\255\346\367\371\370s\232\177=\300N\243\026@\005A\r\341\377\231\372\301\257\032\340W\017\240\216\300\341\023HAu\362\n\374\304\341\377,\377\267\374X\304\217\027\200E\370q\210K\301\006 \361c\004\374\230\204\377j+\213\177\323a\341/\260@u\362\017\277\260\311\177\267\177\035n4\353\211\377S$\360\337\370\013\225\374X\b\342\337\036\374\373\203\177\237\331!\\\215\210\335\200M\0203 \300^\341_y\314\344%\241\0373`\227\371Y\017D\026\026\300~\240\226m0\005\374'\376\304\016\374k\004v\221\265\204\rlb\037\371\003?\261\204\037g\365\370\363\3229\034\370\023i\374k\004v\221\007\210\374\253\235\177\005n\257\237\r\371\277\202\315\031~\242\312\356\255%\266\215\255\376{\375w\020\325\303\232\267\201l\256\255\265\263J\200o\370\207tT\n\250\037T\f~\265\002\325\202_\275\340\277\232\232\201\007\225"
+	.string	"&\316\001\353G\360\017\357<\316\366\361o\fv\006\373\367o\340\277\2636\007\273\203\177c\341\037\\\301W\2500~\365\205\233\370\211\026\224\371\271\004\260\005+^\374\205^q\3267\273\307\217#\300\002\300=?\346\360\343"
+	.string	"\374\230\347\307\024\374x\202\377f~\f\301\217}\376\273\331W?\316\300\322\371\331\273\177[\375X\002\274\341g\237~\026\352\337<\260\006\374\300\317\346\375\354\235\177W\375\030"
+	.string	"?\326?\376a\251\366\2166l\216M\365\343\f\376\225\205K\340\377\004\236\302\277u\374'\354\303\306\261\247\336\200\177\330\345\30774\330`\345\340g}\260Z\377\316\361c\016\254\025\\P\364\257C-\362\322\n\342\003\f\3026\216\177C\375\253\013\031\374\302.\377\352b7\375X\270\231V\250b\017\376\303 K\364c\254\037[\255!\266\213\177-\261m\374y\371\357\032\177\306\300\277i\374\353\373\257F\377^\372\331\256\037\013\367\214\037\313\371\257\366c;\177\026\300\217\361\376\214\341_7"
+	.ascii	"\344\205-\343gW\374\254\221\177+\375\202?\253\370s\t\307\340"
+	.ascii	"?\207\365E\007\277\260\356_I\330I\277\272\001l\342\377\372\023"
+	.ascii	"\2256\322\257\3129\372\3251F\347\371\205\r\300\034\370\361\373"
+	.ascii	"c\r\374\330\350\307\033\370\327\001\b+\360\257\031\274\277Z\207"
+	.ascii	"o\374\370\351\307L?\206\372q\323\356\300{~\341\n\233\003\373"
+	.ascii	"\005\225\275\201\035\343W\263h\340W\361p\320\217\231?"
+	.ascii	"\276\300\217[\374\330\205\037\013\375x\350\307\313\235\201?W"
+	.ascii	"\375\347\360\013\203\376\025\307\277_\370U\264\177\307\370\325"
+	.ascii	",\377\206\361\253t\376\375\342\307F\376"
+	.string	"\377\376a\006?{\302\177\374\023y\374\270\307\217\261~\234\365c\253\237m\377\253?q\355g\217~v\351gg\374\254\322\317\"\375\254\214\237\255\361\257\030\370\331\246\177\273\370Y\f\374\254\321\317\276?\333\342\337E\377\213\177Q\303\277\335\177?\377M\364\357\346\277/\360o\241\177\267\370\267\362\337-\374\333\002\377\246\300\277%\360\357\007\374\373\204\1773\340\337%\376]\302\277G\374[\304\277C\370\367\007\377\356\340\337\031\374\033\203\177[\360o\001\374[\202\177s\3707\004\377\326\360o\340\277\327\177\343\237\335\373\331;?{\367\263p~v\315\317\232\371Y1?\373\366\263[~\266\355g\233\374\254\330\317*\371Y#?K\344g\207\374,\220\237\325\372\331\253\237\335\361\263R?\013\365\263M?k\343g[\374l\004~\226\205\237]\341gS\374,\n?\313\200\237\005\341gM\374\254\002~\226\304\317\222\360\263\013\370\331\021~\326"
+	.ascii	"?\033\342gC\370Y\017?K\200\237\245\340g;\374\354\005?;\200\237"
+	.ascii	"\r\300\317r\370\331\b~v\303\317>\360\263\030~\266\347g\215?["
+	.ascii	"\374\331\341\317\n\1776\370\263\300\237\335?\273\376\254\376"
+	.ascii	"\331\374\263\377W\275\177\315\373W\274\177\215\363\257v\377\332"
+	.ascii	"\346_\327\374k\232\1775\363\257b\376\025\314\277z\371W\267\177"
+	.ascii	"\305\362\257k\377J\345_\243\374\353\223\177m\362\257b\377\312"
+	.ascii	"\344_\221\374\353\221\177-\362\257^\377\332\365\257A\376\225"
+	.ascii	"\353_\267\376\025\353_\257\376\225\307\277\356\370\327\251\177"
+	.ascii	"\315\361\257P\377\352\364\257J\377\212\364\257F\377\272\201\177"
+	.ascii	"\315\300\277\276\370W\350\277b\340_\235\377:\364\257.\374\253"
+	.ascii	"\320\277\266\370W\345\277\262\370\327\026\376\325\002\377*\201"
+	.ascii	"\177e\341_W\370W\024\377\232\302\2776\340_O\374\253\211\177\035"
+	.ascii	"\361\253^\377J\302\3778\377*\342WM\370o\347WG\374\253\002\376"
+	.ascii	"\025\001\377z\200_=\300\257z\370\237\302\277\212\360g\034\177"
+	.ascii	"\206\361\347\016\374k\210\037\233\370\327\020~\\\301\2173\370"
+	.ascii	"_\346\277\233\177\035\376?\373/\345\307A\377\n\364\257 \376\365"
+	.ascii	"\203\177\365\340_7\370W\016\376\365\303\217\235\376\274\364\257"
+	.ascii	"\035\3765\203\177\365\360\257\032\374k\005\377z\301\277Z\360"
+	.ascii	"\257\002\370W\t\3765\202\177\205\340_y\376\225\370\257\300\177"
+	.ascii	"\335\377\312\376\253\372\253w~\025\357W\355\374*\235_\225\363"
+	.ascii	"\253p\376\\\365\253o~\265\356W\331\374*\335\257\236\371\3251"
+	.ascii	"\277:\345\307F~5\314\257\302\375*\227_\315\362\253X~\225\355"
+	.ascii	"W\255\374*\332\257R\371\325(?\026\376*\224_\225\376\252\223_"
+	.ascii	"-\373\337\374q\013\277*\366\177\305\257.\371U%\277\372\365\253"
+	.ascii	"F~\265\310\257\022\371U\016\374j\006~5\306\257\276\370U\027\277"
+	.ascii	"Z\342WK\370U\022\277J\302\257\216\360\253\037~u\203_%\300\257"
+	.ascii	"\002\340W!\370\325\007~5\303\257\313~=\366k%\277v\376Z\350\327"
+	.ascii	"\016\370\365\b\2776\376\332\367\373\306\374\276.\277O\353\367"
+	.ascii	"\361\370}9~\037\215?\243\371\263\364\317_\377Q\370\263\324\237"
+	.ascii	"s\374\231\306\237g\374\371\350\317F\177\316\300\237"
+	.string	"\213\376\354\376\331\204?\217\3703\211\037\017\371\261\217\037K\375x\351\307J?v\361c\f\374\230\001?.\341\307\033\374\330\202\037\023\340\307\036~\254\301\217/\370\377\366\277\313\177.\377\247\374W\361\343\021\377\277\374\357`ooo\357\017@\207\337\203:?\221\004\004\027Ac\377A&A\037ot(\305-Q\362\333\343\n\363\001\366\240\222?\210$\230$\213i\341\211\0211X\262\326m\330g\r\036\001z\020L\255\242\261\227#\353\263I\203\321\022\226\360X\363\005\225}\210!\223g$\270#\307\027\025\245\254\377`\221 \021!r\326\240d\355\265AcE\355\246Y\177\001q\202A\202SA\036f\250\246\301 \3017\310\344\223>=\200\253jz\025\344\362I\237~8\224xL\337\367\025\022\354\n\002\t\016\301\322`\220\240U0H\260)(\345\223>\375\242\270vL7h\200\335\\\321\221\002\352\037*Y\024*\254\254\277"
+	.string	"\267}\017zp\321\b\372\bf\345p\262\273\013\323\nnai\320G\020kxgz\027\265\352/ m\177\001C\366\027p\265\277"
+	.string	"\247}\005\330\251:+rE\303\234\262\276\002\346\250\2604\270#\250cG\246\221&\372\276f?\032\260[R\240\326\264\276\002\246\354+\240\311\316\3613R\363\345I\326W\200\217}\017n\344\2466\321 T\360)\212\233i0*\210\003K\203PA\247\365\352\f\034\232U_\001:\366\023\200\267\237"
+	.string	"9\373\tPcC\255r\307\253.\353'`\312\376\037\\\n\316\b\322\b\312\300\322`\215`\322\321\034%\326\216\223\335\335]\260F\320(/\372\276f\301\032A$,%\216\223\335]\230\317M\22276\200\372\t\210\332G\200\233}\004\230\331G@\227}\004\234\355#\340\310\376\201{zlF=\240\262\006\352\001\357\374\274`\211\351\310\372\b\330\332?0\017\017\253\251\231\021\305\273\332\236Z\253\361\304\016\260\016\322\227\035)u\260\024\337kg\316\215\273c9b\366\242\254\320\211C$\316,I\326s\322\356\242t\300*XJ]\0248\007(\007\b\007h\207\245\3008\300\272\003\247\3007y\3008\030\r\21117\323\367}\201qT4\240\033\004\3005\301Y\242A\261-\252\346\tP\253o\330g=\002\254v\033\235\206\365#)\353# j\003\323"
+	.string	"\277\254I8 -\351,O\246q@2\034\220\226L\304a\233z\301ui\3215@4\3003\3002@3@5@: \033,\005\246\001\262\035h\005\250\366\2372`\032 \034\332\332\332\036\027\2657\240[\225(0\r\260\013\320Mk\203)'4\321\273\3675+\356\021\021R\326\243\305"
+	.string	"\307\314\225y\2222G\213\230\271!\225/UGa\016\234\233##\257J\326@9_\230;@\216\300\374\377\r\235D\321p\001\203\245|\335\370\222\223\365GH\333\037\001\312\376\bb\373#D\367G\b\262?B\326\376\b:\200[0X\223,\251\254?\002\r\240\026`\226=D\313\313\013\210\345\300,\034nx\221e}9\300+\377\177\3009QB\352\\\001\266\3415b\312\334\001\333\200lT\216\216\220\262\376\001\366\366\017p\2675\032\366Y\177"
+	.string	"\272\375\003|\331?\020\rHe\003-E\200d \225\267\255f\252\324\200L\301x.\250\250\234H9\233\201u\026&\353\263\267\345MC\316\035;Q\314\234\200\211\242\2265\320\f\350\344K\024h\206\347T5\304$\263\327\b'i\322\263\023\006\204\002\224b)\320\f\370\344g\330\004\352\215\315\252\177"
+	.string	"\267\375\003H\367\017lr`\231\225 ma\262\006\226\375\300(\360\b\220,\307Qbd\226\365\330\376\242\243\201d\377\007&\001\206\001\227"
+	.string	"\231"
+	.ascii	"\225`)P\f\bF\027\247F\364\315Rt:\203F\324g\3676b\222\361\265"
+	.ascii	"\241\264\027\005\212\001\221\274\201\242\025'|cUFN\250\177\200"
+	.ascii	"\257\375\003\370\330\2769\234a\035\341++e)5\216t\030\001v\355"
+	.ascii	"M\267\236\024\001\0221{#\243\226\265W\024\324\226\267\254\177"
+	.ascii	"\200\246\r\354\002f\345&\"\224\331\013\305Z\331\001\024\002\344"
+	.ascii	"\002\002\001\006\001\016\301R`\027\320\007"
+	.string	"p\013\233\275Khe?\256f\310\335a\255\251\212\366\360\3421C\356\016\330\005\274\362\262\232!wW\344\301\345K\210P\337"
+	.string	"t\366\017\324\372\177@0tvD\263\276\001\246\373\006\210\3337\200\332\276\001\244\373\006@\262o"
+	.string	"\255\375\003\255\262\230%3\036\234\364\245\006\205G\025Q\234&jv\034X\225\333T9\031\2225\220\n\350\300\035D1\243+#YG"
+	.string	"\324\361\313\002\234\002J\351\3155\275Y\347"
+	.string	"\326q\"\207F\3267\300\215\355\344\tW\r\026\251\313\317\213O\372\264\333\242\330\001\336\370I\177k>\351S\n.\032?\263+z?36\256\245)p\t\210\003\b\005t\002\316"
+	.string	">\001\233\2004\2006\200Q\300\032@&,\005\336"
+	.string	"\"\035\230\004Tb\221\2007~X~[|\322\247\235\205\314\235\351QN\363\231E\331)[wS\026\351\307\005oz\343\007\0074\362I\237T\210R\207Er\313\233\376\234"
+	.string	"o"
+	.ascii	"e\330\370\231\001o\374\332X=3\274g\305\b\027\b\364E\250\263\203"
+	.ascii	"f8\303\212\303\260\317z\021\314\354\213\240e\003\215\016|\263"
+	.ascii	"\312fG\013\225\254\367\200O\326\354\225e}\021\306\366\235\337"
+	.ascii	"\227\037\031\237\364\351Wck\3154\357\247\207\245\277;\2772\277"
+	.ascii	";?3?<\0164\336\367\210\b\373\326\204$\353\325\320\202[\265\235"
+	.ascii	"\2756d\213I\326\027\301k\037\227\255\341B\307\343J\031\032'^"
+	.ascii	"\200\324\274E\337\367\255\223\3632m\263\344m\212v\206\213\227"
+	.ascii	"4dW\344\374\340\374\350\374\356~v\2779\277:\277\351/\016\226"
+	.ascii	"\376\336\374\334\274\371\261\301Q'o\323\367}\203TW\226\3500\350"
+	.ascii	"\213 d_\204\035\373\"L\355\213\200c_\204\247}\021\232\366E\250"
+	.ascii	"\261/\302\214}\021\222\366E0\332\017\021g?\304\227=f\0054Ntd"
+	.ascii	"\375\020m\373\370L\356m\304\337\373\2765\211\206\371\305\275"
+	.ascii	"\r\317\241\275JR\002\3349mq\271\373\211\371\315a\351/\314\017"
+	.ascii	"\314O\314G\230\214U?\304\221\375\020\\\373!\260\366CH\355\207"
+	.ascii	"\270Q\366{S\305\354\270\254\262~\001\344\354\027\300\314~\001"
+	.ascii	"\262\354\027\240\311O\313\332\264\344M\223\365\013\200\265\263"
+	.ascii	"\024\240\306~\bv\373!\274\355\207 e\253\255j\244s<\262~\b]\373"
+	.ascii	"\270\f\212\\\224\273\371\244O{\312\026\230\351\017\3557%\314"
+	.ascii	"4\355g\345W\345G\005K\177h?)?\264_\330\373\333\241fK\007P?\004"
+	.ascii	"\256\375\020h\354\207\240\264\017\302\336>\bx\373 \330m\234E"
+	.ascii	"\267q\364\327\344W\366+\373\221\375\304~`Y\"\227\365O\354\307"
+	.ascii	"\344\356\206\233%wcX\372\023\373\205\375\f\267\262hT\321\372"
+	.ascii	" \220\355\203\340\265\377\337\022\267\274\274\262\254\217\301"
+	.ascii	"\340\265\321K\363\253\372q\375\272~\321\237\324\317\353\367\365"
+	.ascii	";\362+\362\243\372)\371M\375v\374\222\374\204\374\300~<~D~V\277"
+	.ascii	"!?\254\037\220\337\326\317\310/\353\327\343w\365\373"
+	.string	"\361\013\362\363\361\323\361\323\302\322\037\222_\324\1778~9\320~o\030\337\223\273|\264\343\344E\303\320\251\363[j\253\223\343\360\034\325\bau\323#\337\236c\347,\351\313\206sg\357\3215U\221a\247\307de\306\017\311\357\351\007E\364\275\357\217'\321\033i4\360\032\033\030%\270)P\215\265\237\r5\213\332\364\207\024g\264\337\354\241\335Yc\347\347\204\366C\262\363\330\374\220l9sn\250\221\013\373A1\242\343\t\t:Oq\206\365\003\366Y\017\002\323\376A\3415\026\311\336\r\273\254\017\202\214\375\017\342\354\1770f\377\203.\373\037,\331\377\340j\377\003\033\373\036\324\355{0f\337\203.\373\036X\331\367@\312\276\007e\373\036 \331\367`k\337\003\033\373 \340\354\203\230\333\007Ae\037\004\331>\210\257}\020X\373 h\354\003\335\331\007Z\263\017\204e\037\bl\037\250j\037\350h\277\0033\373\035\250\355w"
+	.string	"6\255\363YikB\325f\273\301\322]\267\331\230\255i\002B\335V\223\327\204D/LH\326\304\255\306\252\337\301\326~\007M\373\034\340\355\177\247\331h\210X\234\200\240\331q\330\f\236\023\262\200\2614gv\230mf\223\331s{\314\026\263\313l\271M\207\245\033\315\006\2437\232\255e\203\3419!z\016\336\324M\315R\247\f\216\r\22777\\\274\264\321\322\245.\272\321\354-j\226\215f\177Q\343D\001qi\322\263\263C\354\252\314\003\372\034\254\355s\320d\237\003$\373\034"
+	.string	"\331\347\240j\237\003\033\373\037\360\366?\260\331\3770\267\377A\313\376\007+\373\337Y6\033\223\033\223\254\217\341\234D\201\203\262\261\354\264]e\257\355\266}e\253m\264m\005K7\333\246\342{\"=S\263x\231b\006fZ\266\331\366\023\271\351f\333R@\2106\301Yr\367\276fA;@\340\2200\350\177\330\261\377\201i\177\203\274\375\r\352\3667\b\263\277\001\333\376\006f\373\033\030\331\337"
+	.string	"k\177\003\034M\312\366\f.Nq\3106\223-\266\303\366\030\226\356\262\255\344{I>\362\fW\266\243\366\026\007\245\367\325\022[\2230\005\311\273+\333Ip\035\007\245\367\315\352\261Z1\005\311+S\353\326(S\220]\266\221\364`\n\222w\267\313\366\217\rF\266\202\375H\311*2\025j\"\366YO\200;\373\004\260\333'\200\231}d5b\306\216[\326'@\333\236\332E\360\234\020\255\267\243\333\b\226\356\257\315\265\2776\016|\206\250\276\357\021\\4\210\365\003\212\306\252\211$\371\356\274\\\261\222\365\t\240\244k-\032\204m\310\366\332B\260twm I]TMc\344\3249\323:o\266>\001p\354{\240\263\357A\314\276\007/Z\033\204_\316Ty\263\276\007)\373\377\316\332XX\272}l\251\251\335\303gve\267m\321\230n\037\033\307\316\261\265\024}\337w\203\006\032"
+	.ascii	"\355\206T\255\372\352g\030$K\tV\326\367Pd\037\203\331\201\315"
+	.ascii	"\020\325\367\315\312\213n\253]\205\245\233\307\336<\266\016l"
+	.ascii	"\006\2049\276:g`\246\253\276\207 \373\036p\354{\270\261\357a"
+	.ascii	"\306\276\006p\366\316q\206c.\315\216\254\257A\335\276\006q\373"
+	.ascii	"\337P\373)(\205\314\313\314v\33276\323n\3326\260t?\355\032W\223"
+	.ascii	"|O\216\225\200K\232\220\350\335\311X\242\232\261\2376\r`\217"
+	.ascii	"&$z\032\260U\226\240\361!\324\327\200\310\276\006[\373\032L\355"
+	.ascii	"k\220\264\237A\335~\006p\373\337I\033\t\312\2174F\262\336GA\244"
+	.ascii	"0=\262\262~\006S\366=\230\266\3611!\372\336\367h\r\bh\346\260"
+	.ascii	"tX;\354\036\033\207\315c\357\330;,\336~\331:\254\234m\204\245"
+	.ascii	"\254\036\373\346\254\035\013\347\231\313\2326SV\217MS7e\365X"
+	.ascii	"6>&x\216J\217\261\231\276\357\313\352\261f\3303xN\210.\2633u"
+	.ascii	"\203\351\324\270\211\226\301\233\242\261z\276\"\276/<G\245\223"
+	.ascii	"\344M\353X=\226\016O\233\274\242\302\206o\254\312\020\341\240"
+	.ascii	"\363\023\316\260R\200}\326g\320\264\237\201\322~\207\274\375"
+	.ascii	"\016o\366;\244\331\3570f\277C\334~\207,\373\035\242\354w\370"
+	.ascii	"\332\357@\305\326\341b\234\"v\210d\375\016M\373\035\224\366\317"
+	.ascii	"\222a\303 e\215\341e}\017\342\270\326\204a\341\244\264\371\302"
+	.ascii	"&\312\312\261b\3309v\f\226\262aX0l\030\326\013\2301Zq\252\025"
+	.ascii	"\036\357\r\240>\006u\3661@\263\217\201\332>\006^\373\030\314"
+	.ascii	"\330?\373\306F!C\305\312-k&bQ\260'\321$"
+	.string	"M\246B\344\272\300\210E\323\236|\251\205}\225\rA+\322\366\003\315\310\332\024\211\223h>\002BWF\344m:$n:F\004\315\013.\037\005\t\243\306:a\323\3303v\013\253\205\245\302Ja\321\3305\326\n{\205\305\302\232\261\\\330*\254\033\373\204\225\262]\33066\013;\205\205\302\262a)\033\205m\302Fa\311\274\226\214M\217`3[hJ\312\362\021\033\205\345J3}_34\256.M\037\350_`g\377\002/\373\027\244\355_\300d\377\202\256\375\013\256\366/h\332\267 o\337\0024\373\026\260\355[ \266oA\326\276\005O\373\026\034\355W0\335\257"
+	.string	"\314~\005V\366+\b\333\257 k\277\002\246\375\001\334\355\017\200n\177"
+	.string	"W\366\007p\266?"
+	.string	"$\373\003\260\332?\273\305\372\370\262f\315\221\254}\260WU\264\330,,e}\260X\332\007\333#\212i,\352\316\267$&\312\221U\237\002;\373\024\254\331\247`\214\025\217\350\3336\307V\261;\260\224\345\301R\235\201\231\302f\252\242\357\373\262<X\035\330\f\030\323\022\252\260\t|aSg\325\247\300k\237\002\256}\nz\354\237\225bs(\225\331\321e\215\303,\311\306\024\336\235\254O\201\322>\b6\214D\231\212DY'6\212\205\302R\366\211m\002b\237\330\033x\355j\225c\372\352\301<3\342c\353\013 \313\276"
+	.string	"\304\366\005\360\265/"
+	.string	"\037\373gk\260Kh\242l\244e\315.\341;\252\032<\207\246\227\260ae\2604\330\031\254\022\226\262K\354\321Y$6\351?\354\222\272&7A\211\300\205)H\336\335\027vIMc\001\034S\220\274;vIEc\2158 -\275/\224\b[\230\202\344\335\275\357\273\341\214p\354"
+	.string	"\352\337\023\366Y?\301\335f_\342X\230)\260\254?A\335V\337\250q|\322\247m\005\251\316\311\032%J\232\250*gE\342@\343}\177\214\261qL@\300\356\334d1Ul\034& `ww\353\331\3338\320x\3377\036\354\025& `w\323\2346e\002\002\0266\275S\353r\032\007\244\367\355\261\203\265c\002\002v\267\312Y\363\326:\253\235uo\275\263\332\255qV:+\234Uo\305[\347`\351z\267.\271\312Fm\363\237\365n\225\261&\t!\343\211\001[k\246\357\373\336\255T\326:\237\331\221\367=*\302\226\371\222\374x:]\337p@z\337\254+v\016\023\020\260\2739\353\335\252\304f\357nU\2626\t!\343\351w#\212\232\351\234\365nM\302g8(\275\357\321\025\013\307\004\004L\203\341\224\032\2475\016\353\033\274\326\302\253\201\007\356\t+\353O"
+	.string	"e\257n6\024\177\00492\223\365'"
+	.string	"\333h\253\025\237Y\324\004\244\033j\3266\353\032,]\331\254lV\265u.\204\214'\025\220\232\246l\3264\217\343\200\264\364\036\371\350\340\b\336\236\236\236\"\304\013\326\326\017"
+	.string	"\235}\034\346m\003\236\023\262"
+	.string	"0+g`\304\246s\353\332\332\205\003\322\322\tojS\270\273\021\177\357\253\205\02676\245\373\322\001\317\241\221\270R6}_\263un\225\273\233\221\260\351:\267z\331\260vy\351Q\335\235Y\351V1\253\231\225\314ZfE\263\216\301\322un\r\363\237)R\356\360z\364\003"
+	.string	"\266\037"
+	.string	"\257\375"
+	.string	"l\355\007\200\307~"
+	.string	"\242\366\003`c?"
+	.ascii	"H\373\022\324\341\242fT7\306)\353K@\247e\335\202\245\253\333"
+	.ascii	"\332\306\266b\371\321&\352\266fY\261\364\264Y\003\247\354\316"
+	.ascii	"\307\266&\216\224U_\202 \373_\261\\\t\3525\271\322\273\262\266"
+	.ascii	"\021\235|1\375\310\372\0228\355K\260\264/\201\321~\004v\366\277"
+	.ascii	"V\221\262NQ\323h|\231\221\365\232\006\364\265\212\222\020\246"
+	.ascii	"\250\2541\200\263\037\201\233\235\315p\206\265\003\366Y\037\001"
+	.ascii	"\031\351\n\305l\0271c\265\205MjF\006\355\245\313z5\273\233U\215"
+	.ascii	"\021\027;T\326\262\261\274),_Y?\002\260},]\311\326\261\265$4"
+	.ascii	"\324\262^\307r\232\220\203\320N\234\\\216\254/g\r\373\377#\236"
+	.ascii	"q\322\246%\353\177\rcBl\032\363j1Y\227\374\346\320\335!\313\372"
+	.ascii	"\021t\355G\240\205$\257i\242cJ\326\217`*\272\036\301\322\025"
+	.ascii	"l\265\221\264\202\2553\326\032l\0328`+\323j\004\317Q\031\337"
+	.ascii	"$7w\246x\n\027=\273Uc\255^l\242EV\"\353\027\226\256F\276\032"
+	.ascii	"Y\233\326)\242\021\317\373\002\311\213\032Yu\254W\304$"
+	.string	"\2637j\255C\"\223e\203\006\032\004\231\270\256\214\266\376\277v\255C\260t\365Z\205l\255A\210V\266\310d\271\363Z\263V-\016HK&\266\254\231n-C\266t\255\372\021\324\330\377\032\004\b\2156$h~\254\\@)\252\271-Y\237\203\336\376q|\343\210\322\227\254\317A\316>\226\276\315\352\343n\274\342\246\232d}\016\323}\016i\3669\230\331\367`\275\362U\255Ux\016\215\204\234\233\325j\355\201\245\353\325\312c\275Zo\300\325\021\277\220\2205Y\3659x\331\232I\022\0250\353\216\225\352\035\016\335\\\271%\311\372\034\332\3669X\331\377\327\034\253\024\226\256S+\216ujuZ\2438 -\235\350ag\235Zo\004\277\220\220\311r\307\376\310\362d\310\252\317!k\377k\324\n\265ci-\317L\355BU\246H\326\377\261t}Zm\274?A55^7Y\237\303\216}\016P\373\034\226\366\001\260\267\017"
+	.string	"8+\r*ZN\302\262>"
+	.string	"\322\254K"
+	.string	"\020\263\017"
+	.string	"0\373"
+	.string	"\340\262\017\200\266\275\036\375\024q\\QY\312\372"
+	.ascii	"\030\333\367`\216Z\307'}\332U\202x\355\255FX\272\276\252\235"
+	.ascii	"\365U\361T=<\207\366\036\341\250@N\224\261+wU\356\360\246V\235"
+	.ascii	"\247\336)\332(2\303+/\357\315>\004qt\324\273\034%e\310\025:i"
+	.ascii	"\373\020,Q\341\220\231c\207F\326\207 \210j\007A\217}\br\354C"
+	.ascii	"0c\177\203\235\315\232\341\f\353\357\316\250j\336\226s\2307="
+	.ascii	"\356\262\376\006\265\375\253tj\2310;\033LY\337\003*hj\031\025"
+	.ascii	"M\005\3433\273\362\263\022\345\311\024\255\214\032EmjF\035\243"
+	.ascii	"\222Q\305\250h\3243X\252\226Q\345\256\206Q\347\236\317\244T\t"
+	.ascii	"s\206\321\312\250S\304\236\360\242E25J\230\0205\276\2023\254"
+	.ascii	"\020`\237\365\033\234\354\270\254\263\224\031\362\226\3657\024"
+	.ascii	"\331\307gV\324\242^\324+\252\026\242\221\361M\242\322\026\205"
+	.ascii	"S\335T.\352\027\365M\355\242n\301R\325\213\332\246\246\206\306"
+	.ascii	"\312\032\232*h\326\242^\3244\274\026\204m\252zQ\331\336#\243"
+	.ascii	"\020up\f\t\273{_\263\237\016*\252+F\255j\311\322\302\253aS%1"
+	.ascii	"Me\255b\321S`\270\214d\375\rI\373?w\366\177\330\354\377\204\331"
+	.ascii	"\377a\333\377)\333\377)\262\377\203\265\377\323\264\377Cc_\203"
+	.ascii	"\335\276\2063\373\032\340\3665\264\355k0\333\277\nelJ\234\216"
+	.ascii	"$;\2264E\237 \331\342q\004k\252\304i\252\216\251LlL\3251\025"
+	.ascii	",\013\236U\230\023\225L}\242J\325&\252\231Z\206\245\352\230\032"
+	.ascii	"vU\f\303\371\346<\31125j \366Y\257\241j_\203\324\276\006\247"
+	.ascii	"}\r6\3665(\355?pg\377\0019\373\017\270\331\277\032U\273\274\310"
+	.ascii	"p\231\223\365=\320z\013c%\027\355\021\027\275\002\203\225\005"
+	.ascii	"\027U\201\250AT!\352\017\325\210JD-\242z\251CT.\365\013K\325"
+	.ascii	".u\013_\331AG\225&\252CMT\355R}x\231\002\251"
+	.string	"]j\225\312\203hd\366\032\255V\354\346\304\335\005k\310\3211\365\243\377"
+	.ascii	"\225\375\007\230\354?\300\265\377@\325\376\0035\3663\304\331"
+	.ascii	"\317pf?C\333\346!f]J\322J\222\3653<\331\317\020\266\237\241\310"
+	.ascii	"~\006\035\373W\247~\326\344\201\221\223\312\261\"\321C\202\222"
+	.ascii	"\265\031\276\303\3322#\353c\270\203\2047}\337\027H}R\231\324"
+	.ascii	"\033zPj\224\352\204\245\352\223jC}\312`2\031<Ge\366F\001\267"
+	.ascii	"\352\314\220\273\333m\310\220fl\375\253MWo\254\265\360\276en"
+	.ascii	"\257\335\227\254\201\200\2566\341'x\322.Y\037C\235}\fa\366\257"
+	.ascii	"\326\240\341\253\321$N[\326fB''\257\254%u\306\217I\016\2720J"
+	.ascii	"xO\225\221\311\b\2073\326\216\222\262\366\2758\303\252&\001]"
+	.ascii	"U\242\203\302\"\225\265\252\"e2\230.z\025\247\036\251o\023/\\"
+	.ascii	"\236d}|vG\327\301sh%\254IS\215\364\036\226\252\357\265\331\253"
+	.ascii	"\276Z/7Y\021\233\016\327x\305\205\255\372\030\264\354c\300\262"
+	.ascii	"\177\235W'\227\331\321\205#\353\273\273y=\231\326\321tr\023\320"
+	.ascii	"\n\232\266\243\361\260T\3279\333\020\224\2032v\267\352c\230\262"
+	.ascii	"\217\241l\316\026-G\263I\343%LK\326`p\035Q}\337,0Q\240/a\246"
+	.ascii	"]\264\227(\2705\\\207\347\204,\240\354N\232\326\230\274;\264"
+	.ascii	",Y\362\021\032\031\033V\360\032\320\321\230\27407z\252\351t\033"
+	.ascii	"]F\277\321i\364\030}F\243\321uZ\215\266\323k4\034MF\307\321f"
+	.ascii	"\260T\263\321a\256\347\264\0308\272\251f\243\265h.\304$\263\027"
+	.ascii	"\212\270\006eL\336\035\0276\274*x\355\203#Qa\260\370\352\216"
+	.ascii	"\306\344\205]\311i\353W\324\230\274;9(tjvc\362\3564\033\035g"
+	.ascii	"e\314\230\274;4\315F\267}i\215\311\273{_\263\237M\346\006\023"
+	.ascii	"%\027\350\234\2053\254\025`\237\365\030n\354\373\340\355\373"
+	.ascii	"\320\355\373`\331\367a\262\357\3235E\277\r\347t\244\251\222\365"
+	.ascii	"}r\354\373\030i7\334\024\207kI\326\357a\263\267\364x\331\357"
+	.ascii	"I\333\357!\333\357\001\262\337Cc\237\307\316>\317\231}\236+\373"
+	.ascii	"<P\366y\222\354\363\\\355\363(\355_S\231\242F\201\033;\312ZO"
+	.ascii	"\271\206\2225\364\035M\201i\223\242\317\264P\301U\311\372\327"
+	.ascii	"gZJ\215\034:\266\254\357A\034\323t\215\232h\227\035\3210l\322"
+	.ascii	"L\201\366\276D\301\220\2713\315Gt[m\362Q\0326y\\\252\322\200"
+	.ascii	"\301\345\271\361\230*y\213\246A\342e\032\306f\245\310to\214\336"
+	.ascii	"4K\017\27004\246phax*\266\026E\343&\27265C\233\276\257\231\232"
+	.ascii	"5\001\372I,::\341\333\272W\307LI\326O\3368sF\210\226\001N\n\254"
+	.ascii	"\352\356\367eU\226wg\314\030c\231\237,\2439\354\223\225\327T"
+	.ascii	"\256\202#7\204\314\215e\364d\274\261\242\365\377\327\201\032"
+	.ascii	"/#Y\237\305\234\2719!\032\216#\005V\025\246\251\230\200\301\221"
+	.ascii	"\365Y\210\221\223\023\242M\r\331\320\354\270\222\365Y\224\031"
+	.ascii	"\343\214qB8'\371\255\216\233\256\254\317B\310\333\233\021n\003"
+	.ascii	"\225\016 ew>\260,q\362\274\334\b\227\313\316\3124\261\220bc3"
+	.ascii	"r\301b\355\254\276\354h0YXj\\\271\221\213\321m\013R\2261n\306"
+	.ascii	"-o7\276xe\255\245\312\312\026/Y\0379\335\306,F,\302\036\\Uh\262"
+	.ascii	">\222\3146\266\341\272_\0314eB\262\276\034a\324\232\230)kY\037"
+	.ascii	"\311\266\325\3242d\221\002\253*\306\321\203\353\222\365\221d"
+	.ascii	"ii\306*l\225\225\327\224J#*\212N\025\237\032&s_Y\037i\303H\305"
+	.ascii	"H\0058\225\203I\216;\257\25162Y\277\0055R\244\b\341\266\020\213"
+	.ascii	"Lq\022\223\365[\340\022%J\021\310O\226\221\2345J\n\254JL\257"
+	.ascii	"\312n,\354\306\2610\243\324w\006\233\275TYFoD\300\223\332\220"
+	.ascii	"\212ir\243\364F3\020 \274M\330\2223GY\033\237\030\235\030\313"
+	.ascii	"\336&'i\303\364&k#\331\335\204Th\356\202\210\375\262\364\340"
+	.ascii	"\322\312\372l\2253<\242Y\277\005$\306%\306%B4\fM\242x\321;\031"
+	.ascii	"IXY\277\005-\365\210z\304\230\344'\313\350M\006OVZ=t\020;M\324"
+	.ascii	"$1\"\251\263#\353\216\021L\311EeK\326?\352yy\031\243\300,:\366"
+	.ascii	"\246\302\206j\264hl\371\2721:ECK+k\243\021 \230\342\031:%G\262"
+	.ascii	"6\026\001\202\0212\304jI\326F\"n\306.c\227\261"
+	.string	"FZ\224M\213\0341Y\377\350\304\030\304\030\244xgC\016\225\207\324\013]\326?\006\331\3322ra(\257S\007\216\264\342\302\200L3\266\354\030\177\334\310\325V\245\311\336\333\361)+\313\350\003Cy\2358`\231\342E\251\306,A\312\332\350\343mT^OY\337\002w\306\036\306\036\306*\262\2501ywfq\234\242d}\013\314\031\255\214V\3025dvc\362\214p\020!c3\3560\3560VU\005\257\350\370\202\303eS\352\334\251\302u^R\031>\262\276\005\246\030\231nt22\031u\024\227\254V\250\240\230\232%[\242n\324q\343\224\032]TH\326F\251\343.8S\226\262\2761\307\357\b\0335\275\254\2158\362\225\035\037yY\033\241^\007\207\345\216G\326\306\247\327\r\325\244B\254\212l>\271-2HY\033o\030\233,\360\304\270d\\2\326\320\333ciO\260\030i\334XC\257\001#'\213\005\204"
+	.string	"{"
+	.ascii	"{\030et\261V:\354\222\024o\374\200C2\3120*\305\311\305\311em"
+	.ascii	"LR\001lI\005\354\030\221\214FF\243\034\272\216\222\246\n\234"
+	.ascii	"\331\333\023\242\375d\031\311\tN\351\370\202\313ckr\263f\347"
+	.ascii	"\267S\274s_\322\333\243,Z\224A'\207\227\274\027\357\b\277 Q\031"
+	.ascii	"e]\304\003\202\371\315\001\213\243\007&GN\361\316\016\320\354"
+	.ascii	"\210S\233\"\235\027\357\334l*rwH\262.\316\311Dt\227/X\336\nH"
+	.string	"\265y\361M\233\"\034v\313O\227\017\236\0164Uw\357\222U\207  Xqv/\302y\334\272'\345\212Vq\312\2421\363\005J\326\305:\225\007\2165I\334\374?\241\22089\273\254O\2010\373\024xC\203\246\270\346'\313\310N\2042\035g\250\342\274f^\227\363\342\232\242\232\033xj\332\324\244\331u\246H\223r\274\273n\351\313N\221\016\210DC\312&\353S\340\b\231\223)\232\301P^'\021\264\360\254\302|Jt_\326\312\274h\306\303X\324\031\005\264\340\340\212b0(\201\202guWtKR3e\356E1I\272\334\200\312\272\030&\030e\023v#\211\334\377\337\nJ\336\262\310\025\301\210\221\203%G\326\3058\253/W\216d}\n\350\330\305/j\230\306\272\322\361\226\365)\200\304\205K\361\355'\313\350M\007;\035O\252\356X(Xh\200uy\361-7\311\030C\323{\033V\302&V%\353O"
+	.string	"\013\026,\305-?\323\337\016\033`H\264\274\270e\fY\234\253\254\213Y2\231\255\264\265\247\t\204=yQ\312\223b[\021\r\277/\325\213\224\364\366\300\202 \214\016\262\250\273w\211\252\303p\255J,k\312\213m/V\001\001B\221\355\206\233\326\234\254\213V\212jX\372/\305\265\233\025\211Yf\244}\311\372\023\250\332\307\377\262v"
+	.ascii	"\377\313ZL;\221\nL\226i\326/R)\242\375? \022\2563&Y\177\002Q"
+	.ascii	"\373\033\374\377m(SPP\305"
+	.ascii	"(/\236\375\277\240\0237\031d\262\376\004j\354\242\364E(\377\017"
+	.ascii	"\003\27117&\353O@i\377E\263\377'|CdjH\326\237\300\273/\201:d"
+	.ascii	"d\305&xL\n\254*\214\030\207\212T^\331\213M\3340\235$q\206d2E"
+	.ascii	"&x6\316d}\t\230a\302\244(\206An\265#\304M\257\030\366\242\230"
+	.ascii	"\323\0275M\262~&S\366\205F.\353K\200K4ZT\362\223e\004\007\001"
+	.ascii	"zR`Uw\277\032L\32289\362\242\222b"
+	.string	"\222.% _\262.\"a\231\214\244\275Y_\002aE0\t\3500b\204\350\366\223e\364\246\202&Ox\321\225\311\025\227\267\254/\001\032D\210\b\321\202[t|\301a\240\205\213^\031!B\212C\200OS@\222\370\306h\234\301\352zqH\334\217\037E 9\244\300\252\202f\342\246\340\270^\004R\334\322a4\306\f\013\253\250\205\241\274Nk\324\r7K\302\204O\354\214i\342\343E\255\241\034)sN\212Y_<x\024\257~\262\214\344\260w9\230\344\270#\222\001R\303\206\325\213WE$%D\326\202P\206am\314\354\270\322\241\243\270\003Cy\235\\\035@\312\204{V\312\034\241zq\207&\363\344\f]nZ\345\234\362\354d\375\b(\341\300Q\224\302P^'\034&\005V\025\366\276T\035T6$3Fr`iQJ%\313b\246cmk\016\233\266\254\017\001:E\247\242S\021\nCy\235~\346\350"
+	.ascii	"Rv\367\276T\035D\340\212\003'\353\277\370\364\"\324q\225\227"
+	.ascii	"\212H\326\227\203\245\374\377\255i\222\370\230\221\365!\020\266"
+	.string	"\377bS\261I(\226\215\357\273uw\345}\242\362\2606A\021[\313\372\020\370Awb\035\221\256h\303\267D\365\342\320\200\314W0IH\223Z\326\305\032Y\r\316\0331Y\037\002:\366q\331\224h\267f\n\207\370\206\003\322\222\21125S9D:xN\310\002\226\204\231\2567\210o\212HE\032\305\245\242\214bRq\006\226\026\225\210wE%b\034:%b\235\242\021[\335\024XCk\356\212\250\247o\303\001i\311\204\2236\323\342[<\302\322\242\021\032P\321\210h\207\270'B\234\016\255\251\r\032\f\355\312\320\361X\365O\334#\352\251\231\005\201\2235\361\016\225\216/JY\237\005:\373'\342a)1o\313\t\303\202\3676]\206l\305\331g\301\315>\013b6q\316\273\315L\257\344\262>\013_\366Y\350\262\317B\226}\026\326\366O\264#\2769\203\213#\367\006\f\023R\326g!m\023\331\020\335\024\307\256"
+	.ascii	"\261\222\365\211m\376\377R\030\022\306J\326zM\376\362\025m\312"
+	.ascii	"\372D5D:#i\322\254OL\363\377\247Z\331\213\263#\353\340t\313`"
+	.ascii	"\201\f\003\340\025\033\026\217\254\317\302\326\227\023\315\020"
+	.ascii	"\277\020\317d\251\231\021\021I\314\312\003\002\314\244\361(j"
+	.ascii	"\351q\245eM\024C$C,\363\377~Z\230\310Xe}\026x\354\023\307\b\031"
+	.ascii	"SDI\326\031\337m%\2069q\356\377\261eOIiY\237\205\251}\"\030\242"
+	.ascii	"\334\377\363\335\211\323B#\353\263pc\237\030\367\377\327\201"
+	.ascii	"5>\304\262\016\332m\031\017\330\303\340\247\006J\033\257\254"
+	.ascii	"\377\200\271\375\023\275x\311M&\262\216\242*\200\003\246\025"
+	.ascii	"G\264\232\321\204\307\326\245\213\020.\277\357\373F\3317</\272"
+	.ascii	"G\2203,Y\377\001\322-[\210n9\253\f\036\332\364\245\242\352\360"
+	.ascii	"c\003f\211\226\254\211ni\240\302\232\020ik#f1\201\001\217L)\325"
+	.ascii	"\265\005\313\211Y\334\212e\32143Y\023\257< \007"
+	.string	"Q\rK\211j\3045 \031\2701-\314!\001B\225\365\037\240T\245\212Pn\277r\234\210t\332\3368e\375\025\346L!\242M\241B\305\315\nh\366W\300rv&\204\333F?dx\302/YT\216d\375\025\3066\024(B4\023/.\322#k\271CF.\353\257\360\303\t\321\314\211\020\356\311\023!\334\223!pyHB\262\376\nR\373+\366\210e\3042\241\034\264\310\f\27105\3041\342\230\020\356\r\217\250\332\016\013\023\302M\360\276\257\214\027F\2340{\323\025F\214\020\227\030!*!~\021\277\210J\266\321O\030#T\035\2022\320\304\346\222\234\250\204\355\202\263\025\2275\021I\260\tS[\2318\"X\020\215\223X\027\"\030\361\b\260\b\02264\274\266\020\253\264)b4h\265A\267\341\341\343I\326_q\265\277Bi\017!\022\031\342\345\365\344M\316\276\n\271M\024B\024RdJe\237\370\003\023\201"
+	.ascii	"\021F\321f/T\320\212\227\330>\026FY}\020\267|hi5y\242\302k_\305"
+	.ascii	"\324\376\211XD,8\025I<\210W<\204p\353\373b\263,\247'++!\034~"
+	.ascii	"\237>x\303\306\314~\212'\373B\036\230Hu\242\024qGn\322/\332{"
+	.ascii	"\024\365\001\026\252\024J\366St\355\2378E\234\022\300Sq\316\222"
+	.ascii	"+\257\254\237\342*G\016!Z\007X\234R4EE\t\341\230"
+	.string	"\354\270\263\177l\207\355\260\0345\351\005\"\004\030\235\372\212\232\300\035R\032\247c)\321I\b\005\001s\364\025\262\244#Y\337\001q\373\307t0\035 \025\023Y/T\b2Vk*\217\307\335\035\306\353\220u\2445\301Tj\310\324\335\360\310\230\024\244l\224\215\200g\032\312\213\203\005\243\362\300\3029z\303#\353\237X\203XChf\"\353\205\022\241\214\b\244\215\226\032Y\337\001o\373'.a)q\tXf\"\353\215\n\001\347\347\305\016\2170Y\337\001W\2102\2102\204rZ\226\240\354{\300\304\244$5\016\210\022\217\210Gdi\016\330\261\177\342K|m\254AQg\353\351\t\341\304\360P\250\331?\020\013\210\205\327|Io\017!\354\234) I\324\266(:\216d=g\316\020\217l\310\f\271\273\241\235\017\361\336\202\3009\223\365\345\f\353\250U\251#$\353\177Xgxg%L\020*/mE\344\315\231\254\351"
+	.string	"}"
+	.ascii	"\267\3767j\313M\230\254\217\242,N\234\234\326\001K\305\006\233"
+	.ascii	")\212:,\035\326\r\355L\230\275F\305&\032\307b>\264\373\207\323"
+	.ascii	"\341\233\314\225\233\364\252xe\rA\026\316\260\372~`\237\365("
+	.ascii	"\236\366?l3l\343E\005\275\341\232\341\032$CTp\203\006\3150\215"
+	.ascii	"\211\254#\034\002\320\273\341f\211\035Y\027\243\254\207tz%\202"
+	.ascii	"\204,,\353\253 \267\257\002\231c\351\220\314\320\214\232\364"
+	.ascii	"\036y\2559n\250\221\333\342\372\372\221\365\260\314\1778~9\212"
+	.ascii	"Sk\270\340d}\025\234\354\253`$L\230\241\030_\322\233\365\025"
+	.ascii	"\214\002>A\353\2617\234\243B\204\314L\326W\001k_\005\033\373"
+	.ascii	"\037~\031~\031\2021\221\365\342\020@^\223\236\235\244\035lXY"
+	.ascii	"\017\343\240\306\260Ye\375\024\360\366S8\263\377a\027\351\260"
+	.ascii	"\313\320K\207\254\027G\006[\232\340,Y\341@y\303\226\365\360m"
+	.ascii	"-nZ%\353\247\260e?\205&\373\037j\301\322\241\226\241\233\232"
+	.ascii	"\364\0369Y\307\200\\C\212\354\r\267\260H\230\364\b\313\372)\004"
+	.ascii	"\331O\201i\377\303\266c\351\260m\210\305\227\364\036\221\001"
+	.ascii	"\313\232\220\350\351\251\226\261wx\345\316G\217-Y\037\205:\373"
+	.ascii	"(\210\331\3770\rK\207i\303\265\016Y/\016 \275&\257\250\2731\264"
+	.ascii	"+2Y\017\327\376a\225\241\225\241\032\316*\003cCBfD\312\227\254"
+	.ascii	"\205j\330g=\n\322\375\017\245\f\245\f\251t\310z\243:\b\023\245"
+	.ascii	"\025G$LTJ\326\303)V\300D\321\222"
+	.string	"\365QP\262\217\302\217\375\017\245\307\322\241t\030\005\005~_+[m\246FMj\250e=\204b$\t^\225\254\217\202\216}\024\224\236<\021\226\231\310z\241\020P\3054\026\265\251\310dY\222\365Qx\311\310\206M\324\244W+m\035cZB\025eK\253\306\260\214\230eK\2307Y\377\0044\373'\244\355\177(6\024\303;\201l\377C%C%C&\276\244\367(m\215\303\364\325c\212I\017*y\310\344\303%\300\263\034j\252\302\232p\241\313\372'P\355\177\210\344X:D\"t\342[\312z\241D\2302\005\311\353pg\255-\353\237\220c\377\303\257c\351\360kx\244C\326\033\025Bl\212\027\035z\251Sf'\353a\024h\205%\256M\326?A\306~\003\340\f\213\f\213`36\3224@\214\227\027\333\260J\032\336\223.]]^\204t^:m\326\202\004\021\216a\236\244\367\207\225\350\373\306y"
+	.string	"\252Y\363z\263~\003\312\270\270\204c\276\245\254\243\255\f\236\244\310\236\356\3367\316\303\357\212\013\211*\3537@j\377C\037\322\241\217\341\026\206\362\032\005\333d\231\023\007\304\302\323+\223\365Pk\350\244J\034#Y\277\0012\366\031`\207\205\365\266\377\222\336\267\036W\336\227\312C\020\257\213\334\230\254\317\2001WWo3\221\245\024e\004\2629\274\250\357\006\034\026T\326g\200\226=\3441\344!D\303^\2120\300\311\220\352\007\001\302\360i\270#\247M`d\366:\255\020\306\200$\373\f\020\262\377\341\324p\nK1\221u\024%"
+	.ascii	"0)\260\252\003H\277\326d\375\023\323},\206\2078\260t\210c\230"
+	.ascii	"\203\030EN8&\314\212c\312\361%\353\237\350\262\377!\324\020J"
+	.ascii	"}\177\314\336(\027\252\234X\033\316\030\316\030:\271y\ro|\350"
+	.ascii	"\024T\262\253\353\221\365\260)\002pIqY\017\231\262\230b\032."
+	.ascii	"l\242Y\017m\b\3074\251\271e=\254\361:\240\033\251\225)Y\017i"
+	.ascii	"\334\315\027\205\211\232;Y\017\227\204g\254\324\270e}9j\215\377"
+	.ascii	"\277\340\026\2302`\262\376\t\261\241\322PI\b\367\365\344\304"
+	.ascii	"\325\376\207HC$\274\366\223ed7\201\235\324\220)}\247\356LW\326"
+	.ascii	"7\261w,\025\356\r\215Ld\2758&82fL\336\006\031:\204d=|\265\235"
+	.ascii	"\035&\322\354\233\330\262\177\341\235;\372\354\007\312\033U\374"
+	.ascii	":\232\023w\367\276o\036\212U\336\216\246Y\337\004\224\375\013"
+	.ascii	"\353H\205u\204x?YoT\b&fxQ\325\314\r/c\262\026\332\021K\2625\226"
+	.ascii	"\365M$\3317\341c\313\221#\244\263\337\367m\n\023\316\271\220"
+	.ascii	"\216\232\366\303ni\354\377\357'-\243\004\227\365M \301\201\203"
+	.ascii	"\2454\355\230!wW\342\215T\370F(\326\341}\2414@\372\242\362\240"
+	.ascii	"f\3251\033\313\372%\264\324\325Y\225p\262\333`\251\260M\236\243"
+	.ascii	".\341,\245/\274\351\373$\303\303K Q\243F\270\306n\202#Xk\260"
+	.ascii	"\024%'B\304\262~\211':\272\234\206\315^'\005\260\321\331\317"
+	.ascii	"iXx\346\007\001\002\226\n\317\344\264\237\327\327\346\306\f\271"
+	.ascii	"\260+e\312\b\321:\200\343d\002\223\375\013\307\214\0212\321P"
+	.ascii	"^#\242\024\262,6\025\025'\353\233\020\335\277pn.7i\263\027\n"
+	.ascii	"\350\265f\302\216\2708\241\334\bX\322\242B0\027\312\021\313\334"
+	.ascii	"\246u\262\276\234\340\223\377\277\243\333\220\273\254o\202\r"
+	.ascii	"/^\204pX\212\300\251c\222\030\251\222\365K\250\263\177a\027,"
+	.ascii	"\025v\311C:\230\275F\305\"L3\344\356\322\354,Y\204nX\t\236p\313"
+	.ascii	"\205nw\003\254\322\345\005/k\241\026\366\213\334\026V\326\227"
+	.ascii	"\363\323RX\310\300d\375\022\302\366/\274r\005\327\241\3305\274"
+	.ascii	"\342\246%\374\330\027\252a!\033\0336\203"
+	.string	"b\327\260\021f\372>\275\036^B\324>\306f\326_hE*\264\202\353\262\331\373\004\364\372b\346\341$\364\366\217\333p\033\236\002Tb\3421F\234#\207K,\353\013\245\b\247\\H\345B*B\264\337\373\276/\325k\004g\2027^f\310\335\275TO\035\376\313\271\020\355w\004\311\026S\326'1\267\177\374\374\257\357\321\323\373\276Q\252\331\373\204$\\\177|\254b\334\341\037b\037\246\340\277\366\375*\252`\274o\227Z\336\373\2768\316F\322v\304c\202\367\377\257\341}_\250\245\244\327\b/\235iA-\235i=\361,\305iA\275IPaIZYx)I\353\351)\3515\342y\317\264\236\226^-(\343{\366\352X:;2\302KI/\324\373j\275\306w\351\b\352=3{\342Y:\323zZ:\323\202\342Y:;\202Zz\263^\343\222\331\217\247\327L\313\210\307\306\331\021\324{\226\005\305\363\236iA\321"
+	.ascii	"\202\365&\003\2659.\252\2753-N\370\310R\322{\243\311\352\350"
+	.ascii	"\3118\267d\226\365\322\275/F\223\361>\275s\357K\301\373Ze=\321"
+	.ascii	"\035\351\300W\220\346n \251\035ea\263\367}74!me\275IsF\370\235"
+	.ascii	"[J\222\365\276I\220\204\336\246\367}\337\017\214\314\346\336"
+	.ascii	".<g\364\303\352e\222\361\276\020\274f\357\333\364\276F\370\235"
+	.ascii	"{\337\327\350}_\366\311\312\354}\253\214K\321\246\246\367\245"
+	.ascii	"\372iz\255\214\260\310x\337\214\246\346\n\324\322\331V\026\020"
+	.ascii	"\226)g\321w\206\231\021^b\312z\243/\235\326\323>3\222\276L\357"
+	.ascii	"\373b8;\n\205\303.k\263\340\225\036i9\326\304p\361\222\265PJ"
+	.ascii	"%%\211T\326'\221d\013\237\324!3\305,\353\2230\262\205M\340\330"
+	.ascii	"\3259e}\022B\266\220\354\372\007\223\233\266\254O\302\207\031"
+	.ascii	"\325\322\232\223\254\205a\026\3702\226\365I<m\341\222`\023\224"
+	.ascii	")\017=%H\204n|D\315\035\301R\341"
+	.string	"\021!\222\236'\026\270\340\204`\020\370\310\201\243\204\244\251\2515Q#\2764\032A\302\212H\205E\204Fz\236X\240\262'\374!\314\262\253\253:\362Fd\310\232EG\016\017!X*\024\"\034\322\363$\0014l\246\357S\016\017\302\256\274\243\210\031\023\0247\265i\326\037!e\377\302 B.,Wf\212d},\206\205[X*\334\022r\2310{\2154\244\335\310\341A\370c\237\201\211\345@\223\366u\225\365G\200e\t}d\0356\300\242\262\376\b\256,,\262&\257$Y_\310\003\013\257\216\245\302\253\334\204\237v\025/#\323\367\351\212\207\217\240\261\217s\323\372\013q\340\020Vi(oT\320\253k\206\334\335\373Ry\360M1\321i\311z\007~C\302\206L\326'!o\377\027\352\300R!\2250\007\232\220J(%\234\342@\343}\177\274\255q9\230\344(\326\351\b\222C\013\247rSn\002\202f)\353\223"
+	.string	"f\237\204+\373$\220\t\241\210sl\310\351\222\365I"
+	.string	"\262\205OB\246c\251\220Ix\003\370\224\302\232;\323\367\351\311\203\260\251x\326\304\255,\353\223\200c\237\204\245\375\013kH\2055\200D~\314\336\250\242\r\275\031rw\357\323\223\207\213\310\333c\260\344P\261\311\372\027\3168\226\ng\b\225~\366\233\024\2676}_*\017B57\230"
+	.ascii	"\311\372\"\322\354_(C\250T|2CMI\326\302\244\037a\02357,Y_\304"
+	.ascii	"\227\f&H&-*4\022\"a\251\360(\270\2071\232\360H\370\006\311\244"
+	.ascii	"i\315\211\313joO\302\254\372\"\332\366EH\367\037\274\363\240"
+	.ascii	"\336\255\300~pe\035\234\002\364\340\235\035_|x\005\363Z\270S"
+	.ascii	"\304F\230:\017\342\375\301\265"
+	.string	"\240\235,\246\205!9\330\350d\215\303p\2065\270\006\350\301:C!D\226\264\321y\360\356YL\013{_q\230\262\366\021\001z\220NR\216*F\202r\036\234\243\206\225\203\307\230\254\203V\200\036\224\263\352\325\261\201\006\347\3018?\306\202\263\300qu\271\221u\320\f\320\203p\254|\271\363\365\346A\2733\361\240\252\313:X\007\364\340\233\374\205\366\345\213\233\007\247\177\260._ya\357\016\235\254\207\330g\315H@\017\272\t\312q\231>Q\363`\233?\270&\310&(\r\223'\2265\216\342\f\353\003\330g\rz\001zPM\361\312\210\021\025\335\203i\236\2134\r\251\222u\320\r\350A\2726\2620?\312<\210\346\017\232\t\236\221z\265dd\215\251p\206\325\007\373\254A9\240\007\313\374\322\354"
+	.string	"\351\"\346A2\1770.8fn\311\2223Y\343%\234a\305h@\017\212\001\262M\311\234\300<8\367\007\345\202a\210XP\240Pe\215\237p\206\265\007\373\254\3018\240\007\301\020\241\304\244T\311\232\347\355\301/\177\320K\020n8E\312Q\231\254\261\020\234a\315\200}V\214\005\350\301\267\255\307\345FWp\313\203]\376\240[\220\313\230\243!C\262\306h8\303\272\001\373\254Y\b\320\203[\204Z\242\240t\tj\3711\034_\231\0316;!A,\017f\t\322\030s\227#\353\340\025\240\007\261\260C|4\361\312\032"
+	.string	"l\017\266\261jsuPY\007\327\200\036d\333YK\230le\255!X\345A\265?h\305\227\344\213\0272xY\027\261\317\272\227"
+	.ascii	"=Xe\357\355i\351\312:\230\366,\246\205\367M\022\262\201\221\002"
+	.ascii	"$\210\026\244\"u\302\221$(\345A*\177pJ\326\002\202\251+H\326"
+	.ascii	"A\354\263\252b@\017JY\302\033\013\236i\256\036j\260\2626\303"
+	.ascii	"@\305\344F\326A\351/\253*\312Q\326\027!\0264\013:\021\036M\261"
+	.ascii	"\211\311\372\"\242;x\307\214\252G\326eA2\340\024\022\322\233"
+	.ascii	"\365E\370\330S\276\034i\013\212\005\303\222LY\315\311"
+	.string	":A\313\026M\347\b(\207\0231\230M\025\240'\236%~\226\300\007\030[&\013\344\n\027k{|:\211\200\355Q\005\367\351$\032B\235l\353\"S(\213\220,v\373\302RE\373\302R\305v\367S\250D\266&\230K\344\nW\370tQ\264?@\244\213$\341B\022\311\202\311D\216\200\361$\266*\232K_\206\022\232-\221\nA\316\023\232\313\240\226\004!\350\262\3312\211\332\024%\264\311\247\323\004!h\021\223\311\024\241l\241\310g\t\306\225\311,2\001\272\304\240l]h[\204\2016E\233B\bZ\3044\301\205\036\205*\224\355\023)\244B\331\\\266\300\320l\211T\270\320\007\016\234K\3473\271D\241\035Z\256h\2034@\227\023\264P's\004\323i\242\211\034\321B\207\332\2415\250\271l6\213R@\333'\322\350\036\241(\264CKw_\350\003T\310E\016\201\360\300m\236`Q\244\"\006\362\371D\016C"
+	.ascii	"R\361\001\t\017P\021\342\030B\005\264\310\271t\321>Q\270m\t\345"
+	.ascii	"\222\350\001\267-\241\341\001n\033\244A\204\333\006\361,\241"
+	.ascii	"\320\024n\033\304\022\r%\207\332\241\025\204\007*<8\202\bB\256"
+	.ascii	"\270\320\207\366X\fj.\241'`<\333\247\b\030\317\037\bHx@\b@\034"
+	.ascii	"\230\310\244\220\213\034\342\300\2056\235I\225\271^\350\003\322"
+	.ascii	"E\222H\341\266A=$\334\266D\322}\022\335#\220\211L:Op\221CO\247"
+	.ascii	"\t>n\363\204s\205\213t&}\332\346\362\204\013}\200>\340\036\333"
+	.ascii	"\027\226\320\225\311,j6\235M\366\205\363)\344:\233l\013d\313"
+	.ascii	"\324\355\263\210H7[\346\323\205\256A\315\345\323U\341\323\302"
+	.ascii	"m.\237(\216\320\"\027\351\252h\223H\"\025\317\266E\213\"\022"
+	.ascii	"Z\027\317\026\332\246\230\300m\203\2060\236\312\366Y\264\204"
+	.ascii	"BS@\227Fv\310\351L\001E\232\030B\266O\227D\t\320\023\306\022"
+	.ascii	"\036pb\305\b\021\307\022H\250\200\302qD\212\243\212\023<\320"
+	.ascii	"\346\n\027\372\020\324\\v \341\0011\210\234#.\364!\210(\331,"
+	.string	"2!\330l\221U\3501\210H\350\036\233ADj3\210\310\327\276\260\204\352\030D\316\244~\272D\276\017c<]\3502\250MqT\266\254\262\205\026i({\244\213T\036\203\210>\020\217\255\213d\022\r\265+\202\210$P.Q\360\270\313\346\ta\353\"S\270m\211!g\263%\201\202H\344t\241\031\226\312\022b Q \nA\227\315\245\t'\0049OP6E\270\220l\205F\024\037 j[\022\\(\362\004w\350>\221\256\n\fDN\347\t\035|p\237H\242\017P\021\026\374:\370\320\016-W\004\203O\247\353D\241\271,>\333\013}\200r\340|\"Y\350 \344\220\017\351\"I(\227D\254\ne\253l\333\024Z\234x\340\331\016-W\f!\237\304c;\264t\233EO\016\222-\224H's\b\215\321\024\241l\203\202\234'h\bj.S \237n\363D\321\305\340\026]\037\027\203\373\200\013\201\253\001\032"
+	.string	"\227\307\371\214\021\244\335\237\b\332d\263}\266-\332\024\024$\223H\237\333\203\242u\221$\332\241\345\212_\nwY\302}:\205\240\306\013}h\207\220)"
+	.string	"]\037\241\240\245\211\342\013\347\t*8[4\227\320\030*~@\037\224m\333\f^\350\203s\351\266A\312\"\0220@\333!d\n&\334\345\020\214\237\262\331B}\226E$\\\350CP\021\213V\311\201\222\271,b\321*\235(\270\030P\360\270=\312V(\211L6Wp\241\255\033A\006\f \200"
+	.string	"\364\301\304\210\025,\250\030\001\204\266n\f\022` Q\240"
+	.string	"\332\256h\2368A\331\376\240\270 \006\t\312\026Z\204D\001=\361\263\266BI\344\210\007\206*P\224h\335\345\363\005O\361\351D!\"\250\271\204\256\020\003\371|\212h\335\345\223\205\016N\234\340A1\3444\001%*\021\344<A\311,r\n\251\210\340\311\345\263m\266A\373\037\204\260A\b!`\260\017a\200\016\f\320\301\372\020\006"
+	.string	"\0022@\b@\373!"
+	.string	"\371\\\327u\233K$\n&J@\211J@_8\231*\216Dm\313Bx\002"
+	.string	"\334\344\223\203d\013w\311B\017\271K\022`8Y\b]\200\"Qh:\227\311'\206\366\370t\242\300\340\366@\211\202\2001\236N\027\2724\361\302\311\204\006\207Z\027\032CE\217;\204L!\006\222I\004]*\203\256\223\271$\032\266G\345\t\030N\026\254{t7\321\004\rn;\264\\\021\204\036%h\335\023AN\246\260\035*\202\266)\202\232\313\240 'sX\204\301\205\0367\020\265-\t\311f\f\350v\241H\346\017z\004"
+	.string	"4\b\311l\241\002\335\013}\200\266h\225\307 $\323\004\027\351d\266\370A\217G\267\331\272(!\310y\302"
+	.string	"^\264\315\215t2Mx\3216\207\315\"\023\220=n\263\035r\241E\027P\212h.{Z\027\351\2220\204\036W\367B\037\220,0\264.\222Y\224d\"\223\277\325-\332DE\333u\211\212\216\233H\005\347\023\311\342GTtt\333\240\265}\026\271\355\212\366Y\004\205\266O\024*\211\344\322m\233A\310!\037w\250H\205\017\272\204!B\271$\032\272\312%\023\371"
+	.string	"\023`<3([\027\222H\242\025\372\302\311T\241t\242P\204\006!\231&"
+	.ascii	"[(R\bE\333\002\te.\221-\206\312\326\305\262M\266)\230\310f\320"
+	.ascii	"R\005\214\247\3215"
+	.string	"\001\nm\233N\267\b\211\001z\364Q\266/,\231\310\245\273l\236\340qA\304\310\320#\261\003\026\031\210E\006\301\"\003!3\bd\006\202\221A\300\310@1\262\022Y\204\201%\013a\321\021\352\002\300\005\f=\006[\027\351BU \227\350\267\266\307\023?\305\036\f\355\221D\004-Q\f\fA\315\245\353\266*4\304H6\333\"\f\264O\023Fl\200\2560\204|\232\340\002\331\343\302@\016\371\240\307\025&\250H>\0010T\004\365\251\315\345\220/\250\271\334\320%\f\021\277\013}\340\200C\213\"\264}\026\271\310\326\004e\313d\201l\266\305\013}\200\361\344 \210\310\007\306\023H\204\034J>\325g\253\\\272p>\211\224-\214'\023\271|\266P\036\030-\223\250\210D\013&R\b\330*\227\317\346r\202cP\021\223\350\347\251l.Y\034]$\3648T\364t]h\211\240"
+	.string	"\020\266Ld\022\350>[\027\315e\362\251\\\016\251\315\345\320\206\201\034\332E\350\b\246\223(\371\324"
+	.string	"m\333gPKb\b9\302\005Q\213\036\021K\344Os\231l\241E0\236Af\333l\"\205\222G\030E\310#\f\344P\021\232!\330\022\305py6H\340\026\0215\227\032Z\027K\027\351b\371l\225\034\236N7\211lq\fj.\205\\\247s\bzL>\177\210\216C\310g\213c\362\t=.\241\320\347\006$q\350\211<\272\320\347\262\305\261\351<2\221\311\fCO$t\251\344\271\320\207\b\240H\242!g\262\330\\2\223\2552\b9\364\013B\016\t\203\304 \344P\221\030\204\034\n\006!W\270DE\317g\3536\227B\347\263\225@\020r\210\275\320\207b\023\232<.\211\240\302\3421\tbi\034\266L\242!$\224\007\272t6\211\314\326\305\261E\362\350|\"Y\0043\274 tlA\304t\335c\213V\271\341B\037^ c\370\240"
+	.string	"\200&\227C\310f\f\022\031\234\317V\002\311$\222u[\264\312\243\253A(\351.\211T(\223\351|jh[\304D\272X\213\216BIw\211B\331\024\301d:\237>/\220O\037th\371\\\361l\335v\310\331s\241\017\320\344\223\0034\371\354\331/\2201\204\312&\222\205\022\331*y\332\240&R(yt\241\310\026G%\323)tt\231H\f/\22010\270\027\372\300t>\335\nZ\027\231\302'\204r\211\302S\310eC8\211`\224\360\024r7\020\332\272\310\024\311'\353$\202QB\362\271B[\027\371TI\234@\361\024Z\321\214\241t\001\331>Y\034\221D.\261%\212\341>\340\"Q@\022\271\254rI\024\204B\333\244\363ItT.\211x\232\316\245\333l]\264O\"\b&8\266.\262U\036[\264p\266. \335c\f\344\013d\263\3509"
+	.ascii	"\350Q\270\302m\266C\255\013'\n\023\f9\233\255\362\230l\306\200"
+	.ascii	"\266 b\036\333'\362\205\362\211\024\032\266\320\242\243\323\r"
+	.ascii	"\276 T|A\310\b\004\004\342\370\202\020\006\020G\267\205\023\372"
+	.ascii	"\363\002\031\343X|\341d\266x\266.Tp!\331\n%\207<-Q\f\267\207"
+	.ascii	"\347\0052F\017\213%\0239\302\371\214\021\244\301\307\247\rj\""
+	.ascii	"\237E!W\271|\241\001\003\301f\f\245\361\201\013}p>c\0049\237"
+	.ascii	"1\202\326vh\351\0229\235'\270m\320\023\351\022[\354\013}P\235"
+	.ascii	"\253{\241\017\317v\311$Z\272\314\242!\f#H\250\370i\231\310$\324"
+	.ascii	"E\262p\361c\"]\270X*\241\355\363B\037\232\316%\222\002\3501\231"
+	.ascii	"D\252\356\205>X\360l\231\314e\213\325-\036\331\013}p\223EO\027"
+	.ascii	"\n\002z\204\321\272EC<.$\235\314\343q=\262\317\266\371\302y<"
+	.ascii	"\262\320g\013-j\036\217[\331\\\272p<\256\320\346\222\bz<\262"
+	.ascii	"\314\366x\374\271G\027\272d\032/\364"
+	.string	"\001\332\022\305p7P\266O\244\020t\003\016\240\356\222\005\007E\315\240\r`\0245\227\314\r>\b\341\030B\b\030\034\264\312\"f\262\271\344\340\t-\342@\004\027F\333d\"\233O%\262}\n\271D\307\243\006\027\355\223\350x\\]\350\222y<\256H\027\251<\036\327\366\205%\364x\\]H:\231:\331>\217@w\331<\3214\301]6\227\353\323E\221l\026\231\240D\266)\222I\021\030\240G\027-\211d\022\271\233&(\221\355su\241\307%\221\212\026-\211\226(\306\212\343\t\024*\202m\262\211t\241\315\345v\217*\234\320\315%\212&4\271.\211\240>\350q\004\210\023\301\021 N\374\222 \226\276\013}\200\026\261@\301\370l](rh\205B\333\247R\211d[\027H\246\212\"\242\241]tt\321*\241E,6\364H\002Z\304\"\330\036[\242\030+\240E,~-Q\f\027Z\304\202\205\026\261\360\225"
+	.ascii	":&\223\310\365\0052\305\b\022\"V\367B\037\212\210\206\216\316"
+	.ascii	"g\214\240d\022\231A{L\321\001\b\035\204PD4\344\003m\237@\350"
+	.ascii	"\021C{TQD4\024\\]f\021\264M\321t.\335d\353\266$\212\210\206z"
+	.ascii	"\332c3h\311D\036\211\315\240%SD2\211\3341\224\3106\005\322E*"
+	.ascii	"\177Oh\213\243P\320R\350\230L\"\205\255\3229\242\351\\B\227."
+	.ascii	"\332\247\220\211t\361l\335\346\211\240\346\222I4\204T\221L\""
+	.ascii	"}\332dS\005\027\212lOpE([\027\251$Z\001\272\3340t/\364a\350\005"
+	.ascii	"\021\007\320g\353b\371TN\340\036Yh\020r\205s\271\272hI\264.2"
+	.ascii	"\205\220\351L:]\347\023\205\261\351\\B\237\255\213\346\211\241"
+	.ascii	"\027<C/P(\333d3\006\264\271B\013-\"\272\320g\021\t-\264h\030"
+	.ascii	"\343\351\266C-\263]\341:\205\240$Zh\021\217\213V\351k\213\230"
+	.ascii	"\310\007\270-\264E\013\025Z\246\362\004\023\351.\203\226\312"
+	.ascii	"\007\232\313\241 \f\344P0\331\\\016\001[\246\023\005\361B\037"
+	.ascii	"\332\241\245\313A\32394\344Ln\200\036]\244\362\030|\"\333\030"
+	.ascii	"Z\310m:\207\324\030H\245\017\372,r\n\251\320\326-j.\207X\250"
+	.ascii	"\262\351L\266P\026\272d2\227C\353\205>p\220\3240\324\272\320"
+	.ascii	"\030Pb\321\305\322M\"yZ\245s\b\bM.]\350\322E\272\320\243\013"
+	.ascii	"P\244[\024J\272\313\027*\240N\024!\264.\362\231\301\205\244\223"
+	.ascii	"\231|\266.\234\307\"\242\344\260\035Z\256h\223\310g\211\240\346"
+	.ascii	"r\350)\242\251\302\263}\341$z\340\331.[,\335f\253<\241|\"\235"
+	.ascii	",\212/\b\241\320B\205Ve\373,J\002[\027\231\242}a9\264t\211Tx"
+	.ascii	"\266\314\"e+\224\204fp\237O\244o\303\263U\"[\241`\021\006\266"
+	.ascii	"C\313\025\356\023\351B\177\027\372\300\001\364\351\2046[h\004"
+	.ascii	"0\220\315\345P\317\213\007\334f\013m\237D\256\263\351\"Y\270"
+	.ascii	"\330\220t\301\034\266\307\236\366\210\241M>\213\234*\236\255"
+	.ascii	"\333\242\3406\333\347\263(\331\023\303]&\221DH\026E\027I\302"
+	.ascii	"\003Zh\321\020\352>[\246\210\021-\264\bC\033\204l:\227.\321P"
+	.ascii	"\021\264\351Lr\200.\241\355\263u\2411\204\\$\013\027\3046\b\351"
+	.ascii	"2\235.\230\3146\311d\026\265p\221,\\\370\270\315\"\347\b&\263"
+	.ascii	"\035\021\343\331\272.\222\2046\371t\266\310\340b\250t.\237-\212"
+	.ascii	"\026D'\270H\026\313aPs\331|\"Yx\200\211L.\335\345s\304\323iB"
+	.ascii	"\263\210\204\213d\341B\003\364\210B\271$\022\276 t|\201\214A"
+	.ascii	"|A\350h|AH(\351:\233\356\205>("
+	.ascii	"\227D?&`\350\261\205rI\264\242\300'0\t\254\\\022\371\334\346"
+	.ascii	"\322\211\202\250H\331\\\262\240!\370\002\031\201\"\025\312%\021"
+	.ascii	"\261\271D\301\025\241\\\022\031[\027-\263\350&\333\026-|Z\245"
+	.ascii	"s\350\350>[\"\030\355\321e.\335c\323\371\302\362\351\024\372"
+	.ascii	"i\225N\024b\270K\027\310g\211\245\333D\026W<\320\\\"K<\235.\362"
+	.ascii	"\331bH\361\002\031\203\207\331&\223\"Z\027\371$*\203\214J\246"
+	.ascii	"S\b\332>\205\334\343O;\264t\2011\220\314V\031\304\320\272\310"
+	.ascii	"\347\321\007\332l\211\206\234#\224K\024.\222\205\013\237\246"
+	.ascii	"s\351\256P>\221/\236N\023\224m\333\"\303\013d\214c\021\370\202"
+	.ascii	"\320\021\004\024\212$z\341d\362\304x\266.\234\311\366y$\022]"
+	.ascii	"\250\323\311\"\203\353$\266D1\\\3432\030\324D\376@\2270\220G"
+	.ascii	"\r\315%2\210\007:tT\"[!\244\013N'\363\370l\233K\344\323=:\237"
+	.ascii	"I\344\206\346\022\031d\344y:\237\317VC\213\026N\267(yL\036\241"
+	.ascii	",\220=-Q\f\367\b\342\331\272\314e\213\236\027\204\216\315\345"
+	.ascii	"\013BG\030\310\241\343\320\263u\225\307\026D\314c3\206\022C"
+	.string	"\253t\242\200b\005\007w9\264<\241e\0065Ehh.\221%x\334\026\332\246x\266AA\313\347\212\027N&S\004\323\371t\233\316\021B\311f\021\222)\301\261\205\026\365\300@2\333\347\361\0052\306Q\331\272\310gP\3536\227\030^X>\221msy\202\013-z\n\271>js\211\f\002\266\311&\322\205\022yl.\207\216\312\241[D\344\0269{\334f\2213yd2\333\344\361\350t\213\220\032\334\345\320\222yl\231\256\353|\n\271G\267\331.\241M\344\323\375i\207\220)\264\314e\013\347\223(x\241\017\034\270BAKf\013\b\206\255\322\211\302\263\205\261\034\372)[\350\263u\321>\217\320\027\310\030>n\263M>[\242\343\221h\311l!\004E>\223\032.\004=\006-[\030\235K\027\371<\022\261mr\351\242U\256\311$\362\250|:\223\355\023\330*\235C\332e\"GT\340\256-\223hh\251\""
+	.ascii	"\254\253l:\223\277es\331\242%\241d\266K\023\220."
+	.string	"\263%!\301\023)\224\324\355\020\262\251W\030\255\262y\242\035B\246\240d\266\313\026De\333\fZ\252\200.\367\211\023\254\233\\*\333'\021\212\335*\235\311f\213\202e:\235$\034U\350\021\351\"I4\235K\267\210\351T\001%\n\342q/\364\001J\024\304\201s\211ah\204\313D\252\320c\323\271t\221I\347\tP\242\240\241\213d\372\232N\246O\210\311\364)\333\226HE\260\205>\213\234#\224\315\"\3473HH\344T\n\351\325]B\241O\335\\\"Q\360q\217 <h\207\226\256Fq\202\204\tG\022'P@\2270\220?e\02394\344\034\221|\376\334\346\322I\344\266\320=\202\204\b\3473F\020;\202\204\210d\022\271\006\025\261h\225\352\323\351:\207T\247\213g\013U\213\266\213d\341\002\350B[\027yB\033\204|\266DCH\242\313\024\341|\"I`\335c\b@ns\311\216 !\"\b9\264>"
+	.ascii	"w\022\265O\016\\\247\363\311A\020zl]\244\253\002JT\242\247\035"
+	.ascii	"r\n\035U\240(\261\225O\2473yT\201\242\304\317=\206p\233\313\""
+	.ascii	"\326E\252\030*j\036U\240(\001t\217 <p\233K\366@@#&X!\205\022"
+	.ascii	";\371\001\206\223\205\013I$\223\005\007\315%r\210\203\344\023"
+	.ascii	"\312\301\007\t\376\367H1\302\025\177P\341\245\235\031\245sO\366"
+	.ascii	"\272\262\356q\322\343\244\007\n~z\242\240\356\312\034\252\036"
+	.ascii	"(=\322,W\257\021i\217\031\n4Jw\3020\240\322\036\236U\317\023"
+	.ascii	"\237U\024\031\033\256\254\037\264f\367\224\365\224y\261\355\277"
+	.ascii	"\207\314X\0068\205\311\032\2641\243\233\342\313t\225$\026\344"
+	.ascii	"\032#\243\325#l\350\364\203\303c\354\213\tqM\230\306\t\035\033"
+	.ascii	"K\204rzvR\260d\235$I\331\222\036\260\0360!\232\t#\257 \251\236"
+	.ascii	"hOT\210\366{\237\336|\265\270\263\377\236\257\"\020\326\306\031"
+	.ascii	"\270)F\212W\3037cs\210\024\tJ\255Y\350\256v\020\341A\024\363"
+	.ascii	"\304*\216\227\261J\221F\0177xC\262\f\363\342\334\325\351\nv\311"
+	.ascii	"\312\302B#$\330\226\335le\311\013\222\246\206Z\223\216\254\363"
+	.ascii	"\320\215\222\034x\\\3014\3055Lf\330~\f\315\374\270sEfk(F\354"
+	.ascii	"\fl\212\026\230\\\366r\275>\274\344;[ZbYn\257\232\2519=X\301"
+	.ascii	"8D\272\252$qzz\f\261\364x3w\025\304\253Z\323%\211U\360\213\016"
+	.ascii	"7\264\254\205g\330\216\2353zY\2534Z\260B\226\204\251g\307p\215"
+	.ascii	"]B5\346\245\207jH\305\207C\b\222)=:\206Q\230\244GIv\3108\321"
+	.ascii	"\221\0326!\206\261Q\221\346\0302\321n\272\240\312\340(\2765)"
+	.ascii	"\223\362F\r\217\004\1770\301\035\201\022\322\200\272\275\261"
+	.ascii	"\365<\005\321\254PE\312\224\351q*\212\301\203\342\246M\317\r"
+	.ascii	"\236<0#Ix\3644\025\315\224\305\2119\351a\022\216\021\317L\363"
+	.ascii	"\326zl\004\365\246\224\244;zj\024\267\350\035Z\266\370\350\241"
+	.ascii	"1\334\002\276Fl]z\226\212k\332\350x\342\321ct\243\036\031\357"
+	.ascii	"9z_\244\367\355AD\004\275&\257\250\236\243\367\310\370A\200\320"
+	.ascii	"\243\324%\367\203I\217RO\322\326\017\243\267}d6\346DL\017\022"
+	.ascii	"\373\306\211\327\327\221\026i\366\235;<{!\272\264\321;\317^0"
+	.ascii	"Z\254\263s\322\026\214\336\241MQ\313\372-\256\354b\034\016\223"
+	.ascii	"rf\212\027<c\"\375!#\2534\330\031`\360\244\262\326Hp8\254\356"
+	.ascii	"\232\024\247wr\316\350\210\351\273<'?\346(\311lu\240\354\310"
+	.ascii	"i[\2578=\231\022g\230#\r\r\2567p\240\214P\343\016\315N\270\206"
+	.ascii	"IK\023&o\252.\230\301tej\364\201F\025Wg\344\332nz\034)\343Fh"
+	.ascii	"\026L\223\2221\245\215\320\311\327\226%$\263$T\302\316\254)\302"
+	.ascii	"\231r\307\026\245FX\266\002Z\023.i\230\374^$e\222\320\to\344"
+	.ascii	"1P\260\304A\223\304\367\245M\t\2233F.,\231+\272\035fx\312\310"
+	.ascii	"\221q$k-\353\221\325\336\214<%<d!d<\375\234\242tM\317\234\\E"
+	.ascii	"\367\232\364\210\226aM\347\360p\341\321\022\245jJ\205\247\212"
+	.ascii	"O\372\264\253\220a\232r\003\210\215'K\b\031O?\034H4\246I\336"
+	.ascii	"&\204\214\247\237\f2C\316v<\261\342\341\302c\306\003%\204\214"
+	.ascii	"\247\237\r2<x\302\360\300\361\220\341\231\343\021\3033\206\347"
+	.ascii	"\215\247\013\217\034\217\027\0367\2368\0360<[x\276`)\017\027"
+	.ascii	"#\026\036)<\\|:x\3268\320x_-!\353\224\025\034.l\2201!w&\320o"
+	.ascii	"!d\377<Y\260\240I\331\250\321`h\332\276x\256\360\264\255N\310"
+	.ascii	"\264\320\261\337\342i[\341Q+\322i\212s&\353\267P\262\302\223"
+	.ascii	"&L\022\345d$\353\267tx\320\332\272\375\366\314~\353e\277U\333"
+	.ascii	"o\243\354\237\007\n\2174\372\005\245M\326sE\241\036\031\031\037"
+	.ascii	"Y\277\035\333o\213\354\267Y\373-\216\375V\006\317\230\222\026"
+	.ascii	"-B\262\276\262\315>\226\362\210\361\204\255c\232\274S\230\234"
+	.ascii	"'\254X\204M\314\217\254y\226\340\272=\26687\345\230}\245\226"
+	.ascii	"\375\363 !*y\013\013\363\2245\317\027\317\027\317\221#t<\321"
+	.ascii	"\363\034\0216qj\263\026E\315"
+	.ascii	"\220\351\232\254\257\204\262\177\036#B8\235\266C\310V\021\243"
+	.ascii	"\216\342\230\037GFx\210\f\361fX\301\271e\315\323\3053\344\177"
+	.ascii	"\363\016\250\314\262T.S\252\037Y\037\377\315\332\001\3747\353"
+	.ascii	"\317#\304(C\214\023\322\222\254\357K2\313:SC\032\253\002\"\254"
+	.ascii	"\302\222\223\272\312\232g\313\327\201\275\275\275\275\274\367"
+	.ascii	"=\342\331\312<\\<?\316\263\365\"K\027\266t\264j\t\335\204t\301"
+	.ascii	"\362Q\243hW6D+\313\030U\323\304(\325\301\032\332\tq\234\311\301"
+	.ascii	"\322\003\327\255:\224\360\254\\\335\001\231\352P\211c\005\345"
+	.ascii	"\243\323%\213\f\036w\200UHVoU\305\035\372\214M\235;;\212R\304"
+	.ascii	";834\250\360\231\347\325\333\035\317\224\034\032\245\223\375"
+	.ascii	"\363Hi\361\340\340\301!\244\363{\237\336\227\352\365\325yQ\n"
+	.ascii	"\341q\342q\342\201\332F\254S\235\034\035~\236\247\363@\271\255"
+	.ascii	"i|T\261Q:\355\237\347\206\220\216jW\005\326\245)\315\315\234"
+	.ascii	"\215\254\217\245<Lh$\3301qe\275\231\034\t\202\227\265Y\256R\025"
+	.ascii	"\027\204\306"
+	.string	"\320hHfg\210\214\245\342\220\"]\026\027\323\f\274U.\212\027/\031D\267\240\021\263,JJ\302(N\302lIK\232s\006\210\0239\036\244 \2311?\262\360\034\005\333\024\307\270~\360\030M\201H\251\"\305\363\316I\221r\344i\317N\370\316\001\031\243\027T\023n=\245\341\272\023\314;B\0351\223\247\362\030\312Q\2635\003/-\210fJ\\\232\035-ZN\03108\352\004\357\202JOqJw\276/U\2724\247\n\035\261$m\270\242\314!\236A\342A$\3538q\226\340%Zk_Y_ydg'\267:%\261Rf\315t\232\247\325\276\264%\311\372\3115#\033#\033\243\033<\225\002\253\n\013\022\301\201\247els\243\0335-XLrZ\215(-=\262~2L\215\032!Z\206+R`UwB$dG\354r\222\303\250\304E\017\325\345S\302(G\002%\007r\3121\244\252h\023\004C\025"
+	.string	"0P@\036\220\310\204i\224\r\024\200\013S\306\212zP\252\f\264(\211\2302#"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004\001\230\"\251vCZ|\300\327}v\"^Sw\022\202\002\357\006\ny!J\202\304\203\373B_\345\027\233\272\332N\243#\216C\370\360\367\345\255k\210gg\250"
+	.string	"\035\204\n\f\005^H\341\234\005yRn4''\031\351h\001\366\024\373\001\024_\352\214D0\216)\3739 t\177\325\226\032xd\243X\027\236\217\217\020\2129c\020K\336*\n#(\231\316\0040iq\374,\006\223\217\022\370L\250~P\342\r\335K|\222\221\377**\360Um`w\264 \267\240\234\013T7[\022\312\360\004\033\226\326\353\224"
+	.string	"D\007\276\322\253\375\t\250;\363=\241\207\277b\207*v\365\265\272P\027\335\361w&\263\354\252o\273\245\265\2678\262[F,\316\016\262\324\207\246"
+	.ascii	";ae\256\007\261\276\213@\2412\214`\253>\f- \023\255\251\317\272"
+	.ascii	"\214UI\326H\223\311#SW\330\242\367q\bX\342\263HD\024a)\007AJ"
+	.ascii	"G\345\341x\375\342\212\304\271\013\013\254\353\241\367\300\354"
+	.ascii	"\006"
+	.string	"\377\231'\227<u\236\377\367\270\322~\252\234\306O\352lS\"\375B\n\207\370\220^\023\253z\024\\\033\324\267`\365\204\321MCt\307k\253\254\244\344\320\3761\212\277\264\351\034sD\355\250DN4\035\t\303;\276\320\254,\005\227\003\320\034&\n\255\236\227\202`\360\236h\202\274*\023<\t!5j:\035)\025\n\"\227\237\t\214-X\254\345T#\323*\310.\356\350cM\367\313\232\227\351\bO\310\256ja\2666\336\242\355\232\265\335\003\004\352!8\301\377\271\027Q\222=8/\263\225\367<J\322\345;\340('o\303W\351\311\233\267\"Z@lZ\334q8#\022I0<\227@\2718\236\344\\\317\215r\335\230\032\013\365)w\354\354\206OF\250\307L,{W\366U\342X\332\301\225h3\222\327\320\261\304\r\217\036\237f7B`\307\212\233\226\374\221+u=\252y\026f.j6\030\340[c\355\017\341"
+	.string	"V:H\020\243\034\234\227+\3235\301\267\030N\022\036\273\216)\034%i[\247<y\205\207\237Uj\026d\316\212\224\b\252\004y\356\341\240\222h}\004\212\236`\n\221\252\257afr\340\003\255j\355#]\212\270\252\362K\334?c\032\221P\345[4\243\244\033\274s\225\f\372V"
+	.ascii	"\006\265\004Q\033\360m\314\271w\223\272\030s\027Q\2015\275)x"
+	.ascii	"-\351\334\375\375\351x\332\332k~\354\003\225\345s\2765\372@b"
+	.ascii	"\310\260\023\330s\266h\205\333Q\267\227\004\245\033:(JD\207\033"
+	.ascii	"\315I\255>\350\037\377@\357\257\310\3763B\372\316W\220\351:\363"
+	.ascii	"?\207\301)\005uT&1!\025\246\263\366V\3330\277\342\265\250\362"
+	.ascii	"Z\250\325\306\304\311D\305I}leU*|3\252\342\226\f \025\f\227H"
+	.ascii	"-4*BZ!\b\373\271\350\0012c\026\027\373l\231\257'\332/*\202=\257"
+	.ascii	"\311\020\312\354\215\225\307\200\"az\345\234(\365zQr\324\351"
+	.ascii	")\032^Y\312\311\330\242-`\235.2z\222\016\224\361f/U\200;*I'\256"
+	.ascii	"\310Z\376Wj'\030w\332!\024A\211YB\234%\354\246\201\337\022\033"
+	.ascii	"<\215\030\331\212\027\271?\207ut\"\300\b\333!\212\376\340\002"
+	.ascii	"\217X\227k>\026y\332\244\212`Z\017>0^\223\020{\320\376X\340f"
+	.ascii	"\243\366\363"
+	.string	"\313C\362\372\272\020]\323\331\207\034\f\016\fnya+\f\216\026F\311\224#E\336\202N\267\350\363\004z>\306\313\302Q\237F7\207pq\376lpU\241\233\203{P\026\003\222\203?\300\212Z\320^,\354\nC\311\360\r\027Zu\260\321\237-\257\260\367K\034+k74\323\n=Y\344\331\2170\312x\036KD_\340\316\274\304>sP\\\251m\320\350@bb\305\265%\330\342En\254.&\210[`\337\327\rs\033R\357\235m\270\334\034\234\372v\030\363\301I)\215u\205\344\321\022K\222\223\003\277\007\204\033c\033\342\207\01361{:\254\343\341\354\204\205\336\372\006{\264= \350r\344\276\005&\227\261E\210\031R-\266\031\256\033\310\242#\312`\240\021\3636<\222R\tQoCa#\350\353\230\312\213V\316\013\254\204\367\334}\363\\\246\025\013\255\213\nuA\256\277\013\307f%^0\330\254p\206\336"
+	.string	"GJ\033\375\252\325\362\311\307\005\226\326\371I\343y8%\327'\3331+\226:?\026\271"
+	.ascii	"\221\205\255xz\256\353\254\320#\337g\377\224\24475'\2178P[\202"
+	.ascii	"\204^\367Y\364\035d#88E\324'\366\226)4\361\236\016Q\210\035\305"
+	.ascii	"#.P\216t\313%\016\266P\027U\243\245G&\2278\325P{+f\252p\306Q"
+	.ascii	"|\315\f\260\374\356WmD8\226\177\325<\"\351\312B\335\223a\276"
+	.ascii	"[\2012\345o\203\273h\364-7\022\217\350\2446\354\245\210w\371"
+	.ascii	"\332q-8\205\335^4\260\262>\253r\r1\301\335p\364\250\024IF\335"
+	.ascii	"\fT7\232\275\342VtJj&\267\017\207\f\254^Z==}\270\301\207[\235"
+	.ascii	"\222\345Y\021\314\346d\017\277hGp\222\332\331\333p}/\035\252"
+	.ascii	"\360\3459\223\207p3\035.0\300\336F\007\310i\002\304\024\331\323"
+	.ascii	"BT\215wE\232h\302\364\006\2529\347\f\216\210\333[\020\203\006"
+	.ascii	"C\2559\007\206\002#"
+	.ascii	"N\300+\330\026\274\235\210T\204P\352\027!"
+	.string	"\r\006z\315#C\335\231.\346\336\020a\255\201S}\212\335(\360\362\350\336\316\244\261\301\226\037(\217-ITG\325&\243\265\240\303\230M\365\033\343\311\245\026\264>/g\371*\366\203DL\362\2340o\303\"\3107\306\233\333\316B\2010YS\350\373\3161U\252\346\364\r\327\235\256\016w\243\351c\034\303%I+g\216\327\240G\020\032\254\027\316\226\031h@\253\002\035\213E\215\272\377h\340>D\303\030X:\247\330\020\254\026|\336_\332\207\340\301\236\021\226Z\203{hq[\350\b\334;\271\2633\260\320=\260\306\246\0335\032\266\004\212@\035Rg\330xG\305w\370\207\032\"]\244\311\324\033D\225\355\030\277\206\262d\023\333\312\316\330\\T\201>\023\371\247 \320\353\b\364\n\343X\234r>\257\364h\316\201\245P\033\223\326\203:\030\244\017Z\306\212w\255k\272\026\245F\027\241\371\231\250\323\307\320\243(\302\323="
+	.string	"\035s\303\374fa\366<\322\331-q\363\013\253\002(p\344\273_\346\033\340V\220\273\232\357A\207/%\t\242\313\236\360\357\365\331$\345\031\370YA\310\2471\313Q: \001\260\372\351\n\312R\027\377q+F\216\371\342\301\317\227<?J^]\037\210\320\31436\253\366\303q\266w\035\246s\031Jr\263\277\310u\251;\250{\310\235i\020L!F\360\357\225\036\304\235\216\217_\356\261\255*\023\020#\312\205\023@\2372\324\306u\024T\bc\376+YQ\265Xz\034*x\2157\320AX\253l\032]\211O\322\3352.\246\250b\251\200\301\306\354u\351\274h}M\324\"(\264\247\364\356F\314\247\022\257\300\354P\241R7\326\177fbz\313\235\351\275\301\306\326+\330\271\336\341)}\262B\201\202\277tV\233(\366Ek\002\204\345\322\313g\250\342\317\325\231X"
+	.string	"\362\367\332\204\254\t\335[\343\360/\027\341p\227A\205d\203D\261\276c\224\247E\310\242\027G\323`\273\372\310b\333@\320\266FJ\035e\373\271\250(\241\214\354\266\347\346\025\202\370\033CkP\347\026\253\236\336\020g\263\224<\254\207\357\302cS\360\3534\370\205A\236\"RJi\026}q\270\362\250F\026\201\260\223\323\317 \331L"
+	.ascii	"\200x\353mJ\252?>\037\275]\305\257\240\314\033\275r\024X\226"
+	.ascii	"\221k\235Z\364\321i+\221\376\222\243\274\327\376\315\237\235"
+	.ascii	"?<\316\217\b\274\257M\323\267#\212\333\252Q\003\317{Ou\306\261"
+	.ascii	"w\240\t\217V;\363\2279\360\033^\224\333O\342c\224u\257\357\263"
+	.ascii	"\n:\033Wa\272-w7C\203\004)t\373[d\212\300\275\254_?>S\353\355"
+	.ascii	"/\263\251\257<\3753|eJ\252-nw$\314}a*r\034D\376+Y\222!\265\371"
+	.ascii	"9?\0162\272YR\241\bqK\342\341\274\324"
+	.string	"9\177\271\371{Q^M\374\266\320<\213\3478QFN\347\323c`\322X\260(\tX<\241\224X\205\276\021J\310\372\201\363\020\327\271&~\023\235\343P\236I\277c\026\310\3179e7`\257\351l`\231\235\251\331\314\373\226\"_\262\264\227-WQ\225\316\025\351q\315F-D\275E(\\E\362!c\234J^\202\302\2170\212\r6\277=\370I!\r\313\003\005\004\212\001\230\267\263\342\3035\023\224\203W\332*\367\206d\321\330\343\206\230\326\263,\345X\231\020\324\225\352j\001\231\022h\261V\303\204\334v\262\310\027\312\n\277\240@\227\206\251\306|\240\354N\375\217\251\336b\341\300\2776\343q\332\375L1\240\363\221~\310\212\352a\240\331\267PA\314\260\322l \212\233\2446\007\027x\250\b\263\345n\351\341\300\202E\214\256\036\206u\304g\022Q\315K\240\332\304S\251Aa\333\240\211\035\272%\334\026\277\371EY1"
+	.string	"Q\324#\023R9P\275 \200\375$O\366\355\213\026\221\215\362\321UG\3766VO\364\271,\2207\005\334!d\221W\353\332t\\\"\264\320}\367s\002h\0343Th*\275\356~h\004U\266\366\300\236L\240\224\361\337*\327\n\302\366\312\366\232\222\262\246\373\211\222\315&"
+	.string	"\337\317\254tBZ\322\031\372)\fl\256\313$\270R\322O\007\277\212b\276\005\001\370\337\003|m\255\262$\213\311\030on\331\201\377\200\247\361\377VD\243|\177\322\230\025\007\213)`\234\302\301\f\001\f\203Z\r\236r2q\024\336\001\343\322\376\3523\024\355\331\322\022z\205\235 \314H\260\216pH\250U\334\261\307FhN\352\254\223\273Gh\3331\302\f\310\024\001d-E\360\005\337\2424\002OX^\273\340\360\244\341)\013%&G\304\232\003!`0\323\347\2636\036e\n\371\345\352\326M\2617On\332\251g\315&T7\225\332\311\301\263s0\330\332i\223\343\233\273\005\326\313k\360\233s[<\274F\366z\\\\=x\262\264\330\244/U"
+	.string	"\\\265\250\302\275\241\220\2312\276]\031+u\007\375\253ZtAF\b\277\315\034\205\356\362s\340\023A\334\273\324\202\333\020@\037\207\177]\217\244W\205\005\250\f\343\357A\313q\332\006{\217\335\307Y\r\303\250X]\204\021=\240{\035\037\031x\346\n\032\305\"\253\245\316\230\033\301i\303\013\346R/\332\"\252)\221\272\370\251\0132v\301\332H/\256\362=\315\030\200\024\376\020@DJ\202\202\223Z\224\"\275<\201\327K\371\304\325\325j\300\275\001\260\t\230l\250\\\220\261\202}$\204\177(q\366\335<$\260\022\201\202\373\245\b\247~\036\005^\377\251\30085\fX\361"
+	.string	"\244^\020\212\224\300\344\206ow@\\O\343\325\272|\346Km\273d\232<lNb\024\3375.\276\365\271\264G\246\265\270\372\227%\371\361\353\257\220]PS\001\300=^0\355\272S\276\002\370\320\370\005_\255Q\321\212\353\313\025\013\220w\036R\261\226B\243F\274\3472\373\017V\344iFVB\375!1a\004F\016\304|\037p$P\270\013\006\273\021\350V\312\370#\342\334G\370\305ot\007\360\353\2419\203\177\265\271\261\230S0\334\300Rm\332\210t\026\025\271J\341\322]\365\022\337\r=\361X3\206\202\272L\267d0T\351\"\345\202\250\035y\222\322}\004T\366T"
+	.string	"l@\257\030\335\314v\334\2632\357Ix\301l\245\340\274x\274\201\bX\355$y\247\026\237\03205gR\335\260Q\225\322\335\177\377\253\r6\343\031y\007\251\311\366\177\031\255\002\3610"
+	.string	"\323\340a\031\005P\364\202Ak\343s}1\267gUU\336\206_\246\261D\202VyV\320\033\3222\030:\220\220\2000\266H \224\026\207\321'\n\372a\246H\365f\f\367\004 \370\273W' \353\023\276\235\217\204\204Ep\324\225W\235\274L\310\370v'+\020\245B\r\n\231x$\335e\210B\343\330\377\300!l\271KM\022\333\030\243\025\264\276O\202K\250\226\213\270\360\024\024o\267d\220\2227\250\235F\354\2604\330\372\374$MCp6\375\241`\336I\365\225<W)\237\371\022\022\r\325\311\274"
+	.ascii	"\226KgRn\277\362\b(OC\304\037r_\227/4oY+\227\302e*\021\213\217"
+	.ascii	"r\267\341\356\301\217\310~\212E\017\024o\023\204\bW\001\306)"
+	.ascii	"\217rU\225\211Ys\021\216+\312\254\323N\031\264\203+-\211\006"
+	.ascii	"\022d\225\003'N\303vD)\371\345g8\020\371]\305zs)\234\244<\\\""
+	.ascii	"\237\2477\276\342\321\350\321,"
+	.string	"\225\001\200\221\271X\374\001\270]\306\323{O\006 K\366\201\202\\b2\371.\2739\241c\033\243&?m9\365;AVe\270u<\257\216\257\306SV\321\320\017 \357\260`\320\271\250\227<F\345\307#\233nG\374-\252|\314\022\237\033B!5\006\233\360P\336\004\343{`$\t\276m\205\035d\020\266\244w\237~\230\214T\364e?\333;\303p\2526\365\321\300m,\003\253\225'\356E\330\344\224\3673\336{\002\336\311#d'_t\207\200H\226\311DK\324\224\265r\313\312>\202\237\3205f\316\227\026\364\340\020`\r\266\240]5\257A\001\250\264\201\375j-\3339\314@\356\025\361\031\223%\354\221\251\322\225\211$\265\267\360\331\304\221\352\232\206\361\214[\267\367O1Rrx\200\\\\\343"
+	.string	"\255\032\276y\f\221\366\001]\252$g\261P\256:'\301\314\263\371\266~\234\304\244\301\206\201\332s\005^\317\335\333\322\344]\374\024\210\302\032\260\261\3059\264K\207\321\210\236-@`\322_$\023a\311\264\242\316%\025\017\240\225\247\320*x\305\245?Km\235(\00502\333\304\347>:\303\324\330\266\376\260\033\r\030\224\256`I\236\345l-_\326\351\036\016>E\004n\225\254s\273\226Tu\251\240\240pcO[\r\247>\212NFD`\272X\244\302\"\312\"^XJK\243\261\201 F^\364Mf:\365\366\007\332x"
+	.string	"j\233\261\264d\210y\210/\347\364\366\343o\232\372\271\243\013\006\344\372Y\363mz\237\345\"\003\005\230;\312wh\225\2565\226\017\206\r\272\263\016\357\303\231\223N\271\n3\302p\363\324\220\342\205\242\024UZ\327_p\342\342\274\262*y\2626l@\r\301\353\327\270\256^T\317\004\377\372\007\273\007n\3520l\2051\232&\242\326\204Y\232\340\366\277\220\016\256Iq\373\252\035\034Y\350\355\333\314\033j\364\217\313\372\3700o\216\02400\376\307!\301C\275\357|\"\346Z\3542t\334\306\305\021\0325%\276vt\273\241>\220\356\021{\3079\224\214\377\301Z\256>i\321g\320\274\023\232(\355\224\"\250\200\314\337GmC\206u\312D\033C\202\357\315\325\206\322[w\033\370\314[QFa\207\207\357\221\275c!\031\372\213\366\251u!\335\317\240_l#B\r\334\265w\t\230\247"
+	.ascii	"}9\315\365\307\335@1\023\241M\251\026i\2661v\233\300\306\274"
+	.ascii	"\205?\273a\214\315\036\217\017\343T`\232\001\316\f\222r\264\005"
+	.ascii	"A\212\027]\334\240\320"
+	.string	"\310\310\002\013#\264\370\017\243\315\240\320\037\263\334\020\\\324\344\"\336\273\316\0368\221\314\312\325\273\006\205<\ru\030\035\231\270\033t\224\327M\347\374\3515\031jn\236-\241.n\207D/~D:@S\315\241\345\n\336\031f\263\f\310\227\026p\001L\006O\273]}~<\032\022\031\346r*e\3409\bH\202\260\324\301\264F\001Rp\241}'\274K0\243:\f\034\255q\fG\371`\364\223\274\340\344\321\310\333'\202\177\322Z#\"\242RR\325\363\315F\212p]\331Si>\023\234g\3164\3772\312\374\372\037\375\\\005\214\323\364W\367\252\300\232\240v\234\273B.\231C=u\311\233'\b\232bK\t\223\025\305\366l\333\n\315@\323\371.8\264i\357\3336.\313\021\013\265\325\324\3201\250\002Q\315\335;\376\236\252\234c\\\b\312\307Ph\265q\033\022<9'\210\020\231;4\232\373\252\177\270\226\362\210\""
+	.string	"\225\226x~w~^\251\016*M\230\265\341\347\211\031\002\352\bi\250\365+\337\202\330v\210A4Z\203\021$\032\315\013B\205XM'P6\230\217\204(\365\375\325\331\277\034\272\362\306kM\301\002\265!\263\371\034\312\264\215\022\rN+\324\0317\250\025\033q\037\027\273\337R\216\223H\302\375EJ*~\017&\267JNZ\261\320\003N\373\\\017\313?<Q\254fN\210]\354b\325>@?\232d(\257\3366\371!#\217%\310$'\213G\223c\325\231T\263\334#R"
+	.ascii	"\245\234\341\217\345\362\242.Fw(\343\004z:)\215\211\243\243\006"
+	.ascii	"\217\244Rr\006\0235/\027\260\342a9e\036{3\354X\377\365\221i\263"
+	.ascii	"[$K\322%\307 W\215Ub\270Ka\233\027h4\257\347\333U{{\257w\200"
+	.ascii	"\215\020\006#s8#\306\347\332\tUK"
+	.string	"\2341\214\211'^&k\234\353\261pm\312\250VhZ1\323\367\030\305*\025\224\205\031^\321o\033\243,r\t+\225)\020P\024%1#8<\357\360\253t\316\023K\"vb\237]\266Q\253;\002\370\355z\002\3079(\021k%\357o\252\207\257\340?\252\023GG\205\221T\201h \322J.@\2126|\300\027\304\243\033\376\312\034QB\201\0204]V\270vCC\345tj\210\266\003LnZ\377*?\363\tk\230\264\222\325F\213\036p\205\204\323\301\320\342cV\201b\334\031\202\301M*j\204\205\034\033\036t\307\027\324:\224M\321\253\330\371\212\346\203\257U\007\365\255\207\345\232Tz\034R\342\353\274\037\3505P&\313Z\212~2J+\"\013\356\302\321\257\337\255\333}\225\244a`\214!}2\344Z0*?\366\304@\032G|\224\307p\021=\024\374\204\354\362\360_k\246{Fk\354\310F\262NB+"
+	.string	"<g\030\0064\321\325+a\344\317f|\352\177\213\220Wi\031=\032\\\233lb\210\224\321'\226\242c\3239\215E\266Z\t \366\033\212\375lC\347$\300>b\210VB\276\237.TT\021\0315\3745u\335Q\336\374\235\b\204d_\247\221\245gz\304\005\227\335\272Nb\034\242\032\357\2351\205\325\206\3765\230Gn\332up,T\340\251;p\024\b\371\251\335'\332O\333\343\177\373\005\315\217\013P\263<\033\323(\242\001\355\027\267\230\257\\\211ul\323\267) Y\351p*\316\346\237& \246\355r*8\305\373/\002\375`\360\312{){tL\362Y\351\332\261i\336\3543\332]\200Z\250\341~\026\244"
+	.string	"I\032\006i\\\253\262\203vcf\204hj?8S,_5\260\376ej\220%\021(1\030\264\352[\271\004\323\304\371\313\212\2405\003\263\356.\207\312\354"
+	.ascii	"\244\221\213G\030p\311\036\"\231\320\321dz\235V\345\b\267\314"
+	.ascii	"p\344A[\037\236\bY\332x\203\341"
+	.string	"\313i\337\016\2700t\217\f\214\351\246\f\020Y\301\002\016$(\265\366\344}r\330\323wa\322\237\371\323w\021j\024O\365c\223\2067F\353\235\345\021\355\002Kcc\245\343(+3l\304\316i\2106\214\204\201\327\3060\034\301\360<\370\\\351\027\346\235U\215/\267+\253\362>\366\362\251\261\216;\300\037\320\307\205W\376F\324\324\200t2\265%\260gW\267]\304W\356\200)\252\337~\262e>\375@\256S<F\366M\3378\005`\002U\321\nG\037\304\213\357\362\031\274\007\225G\336&\320\n1\241\226m\301h\032\202\013g\243ar\247Ef\020\242T\351\377\0337 \n\274\026\255 V\243\371\364[;#\223W\021T\222\360A1\200\365R\235G|\357\"9,{Ds\016\3448g\310^\212\nrm\220?\033\254\356Xuf\262FU\260\236-_\371h\220\323\177<\024,\177u\201\030\222:\271\305\367c"
+	.ascii	"\374H\336\263\373\304\314\313H\030\222\031\265U@n\005\276i\034"
+	.ascii	"\344\246\006\205\210\224Z\r#\220\241]\020\352\323\210\373j\342"
+	.ascii	"k?6\230"
+	.string	"F)\342\234i\201#\271\302\301\202(ge\n\355\216\211G\275r|\004\275U"
+	.ascii	"O\352\313\3117l\301E\335\355\2076x\325\355\006\245\002"
+	.string	"\212\264k\327\002\n\362\201\3331h\376\006\377\222\344\307\037\335\221:\036\006\312\273\245\350\246+Q#\330\013\305\237\376\365\304Qq\236\272g\276\024\305\030?\320\006\001\"\354\261\253A\220td\217\207435\365\017\336ST\224SC\211\321\203E|\271\2447\b\315\321\\\022\311\027\341\363\355P\207\2379\262\202\022\245\232{\351/\box>[\321\205\350\234\337q1\3437~u\350#\231\315\272a4\t+\230\325\223\n<`e\310\365\276xk\232\361\215\022d^\003\352\326I \3014\f\336\377A\300k3\201\027\377\310\307).\004x\221\264\272\373k\355\002\335f\270,\021\272\350\256\006Jx\324\004!~\020\207\b\221\034a[\256\n\265\361\246~\312O\265L\361\234t\210&\232 V\233\341u\3424zj)\355-\2064\337\222:GH\250\"\201\343\307\357\021\024W\3145\242\332\251S\004D\324)\322\001\216\257\003"
+	.string	"\335\202\265\317y\350P\342\256\255\022\360\221\230\331\006>\367{0\256\\\234\365\324t\221f\207\340\257G\324\031u\231vW\266XAr,\324H\353\257\201\203ba6P\275E\237\364\3145\311b\0059]\363\006\346\\\324\220D \0254\177\f\272\335\305\261\"\fVb[\354\315\025\2520\325Qy=\2457R\324\362\f\204\235$\022_N\262r\037\356q4B%\230\265\272\326\334|\250N\005\372#]\207\333;'H2\351\266\254\2362\323w\227\300Ll\265g7\335\211\305\217\350S\212\243C/\332\216&rK\275\234\371,d7sl\315^\340\360"
+	.ascii	"(\360J\350]D\247\334\325 :.'\203]\214Y\225\177\\=\252G\271\007"
+	.ascii	"a5\003_\244:\0219\366q\334T\341\221_\227\037&\031\b.D\317\236"
+	.ascii	"B\367!~\232}\355X\002\375\2546\365\322\324\037D\025\306\3736"
+	.ascii	"+\n\031\357\216\264\n\021\313K\353G!\347e\t\331\027tK\343\031"
+	.ascii	"\n\366y\346\337\244\216\016g\367\374X\300\200P\336\002\340-\342"
+	.ascii	"Ry\263\305\013\237L\373_A\266\255M\205p]\251_\300]2\211*\232"
+	.string	"\030\236\024fg\247\360\243Co8\223\334LCXdV\367\262\277\344\243TO\306\217\204\007\2443\236P\306~\250b,\236\257\020P\0260\264a6\333\244SW\306\377\nF\017\035\033\261\322\226\354x\333G\025g\027\004F$\315\345T\352\330R\221\362\030qt\332\\\302\376\273\221>\202\26332h\361QM\345h<\246\022\314\250q\271ZQBvM{\312\352d&\340\2513\214)\322/\332N\305\335F\31185\240\304\214\007\324$O\005\0168o\275\354\tf\244\324\237\375\250I\237Z\252\n\307U\031]\310\271z\377\021\232j^\262aC\f\370\237\nE:\302\331>\324/\261mf;\324\024\261>\230c\333\356\304\345\302\306\231\027\004ML\2674\006,\307\034\177\374-\210\017r\211\004@\275\006\025\335\260'\001\032\321\207d\247\035\227\"9\006\t\203\017\365\215\3429\022\241\256)\373M)\230\257\332\245:\2035"
+	.ascii	"k\257\272U\323\034\013\341@P\346nG\3557\266\301\333p`\326/\n"
+	.ascii	"J\200t\213\027"
+	.string	"o\210e\031\213\373\266h\226\023\316\037ZAb\373vk\323]T\302P\366\24442\227\266\327=8\241F\242d\317\342\273\t\362\004\r\262[\337_\0309\017I\370\315\323\231[]\013\240\302\247A\335#@\255\266X\031W\326\321O\231'=\364{\240\323@\345S\350q\3233\036r\227\301\331\026\0279\366\353\347\264\266\246\371\017\206\241H\273H\202\007\324\343\261\357\322\266\205\214\206\304\334\356\213\357\332\017\201\250\346\356\252\n\347|\206t2c!\306\227\323\2074\207~1\016Z\302\320\313eD\303).\372\200\b\220\177<\223\332\266\n\204\346\177&H\266j\201\023~\276\232\375\271\273@\303\325\240)\b\2204\375\bE`\314\212 \310\226\371(\371yLf\266\217\341D<\322T\002\b\013{c\254V\246XwY<\240}\210\325\370\002\251\363\225\235Hh\225K\242\2174c@_<\220\201r>\021\007\254\324\221qg"
+	.string	"%\201T\2556\251O\203"
+	.ascii	"\205AP\323H\252\244\262e!\332e\033Y\031\225\210\007\362\317\275"
+	.ascii	"\353i\364\217\270\3774\025\306\314\204G\201\365>\303\022\355"
+	.ascii	"`\376x\256\026\242\027H\271\265op\t\201\277P\350\206\221N\226"
+	.ascii	"\026\332\251n\001G\373\306\235\rh\325\325[\207\375Xl\271S\323"
+	.ascii	"\031EU4\224\357.\025\207\0326D\255S~\204\305\267\0072\235`\260"
+	.ascii	".\251\301\252\2532\340G\334\2266LJ\357W/\222\206\313d"
+	.string	"b\321\202J\206\224\326\nxVM\212RB$\270j\r\302\b\266\024\322\374\222m7\340'\3763\024W\247\243\327m\372\002)%\025\321\230\205\031\201\rm\235$\027\327\207}b\272\226OT\360J\350C8\346\263\264G\020J\236\270\363\232\275I\216\013O\036\364\2347U\217\220\300\027\377\304\346\363X<\267\\\007\3608\320\006\314\312y@\216\007\344\377\37316*\006j\310\255\177\177\307\262I\304\026\224\355\311\005Dc\365\016\235G65@\006Eub;\325\240\257\220\343~s\001;w\3313\261\205=\374\255\361\373\367,\360\256\020\246bN\200*\3544\374\226-+\203\\\247\231\3712\035\364\361(\257\373\b\3703L9\177\304\342\334\302;y\262vO\213\206\247\262\342$\266y\216\226\310\310\017\311\021%\232\274~\264P\260\252MHq`C\003\350!\256\2025`\367\246\235\375l\022\266M\217\307pK\213\016\317\234"
+	.string	"\323|u)\344\222\177\347\351/\277\347Q\375\301\251\203\376\004\tnI\3037\027\022\354\244\t\211\241\363+\2678\"a\320\325\343G]\r\361\224\302\345\344aR\201\356\006P4UES=%\003\004\222V\2552#_+\017):\306\317^\334\215\244O\001\325\310\221\344a\254\r\334\007.\334\315\245H\355\335\375\203\270 (h\247k\331*\"\n\341^Ks\022\236\226\3431\303%=E\355\240\301\330\032\222\257\0343G\021\1770\200E\273\334Q:\335\207`H\347\211\247[;\347aM\302\020\375'\245\003\"\256q\316\311E\n\034\251\232\0172\\\352\353&\021ZN"
+	.string	"\b2\363\201\022\230\312!:I\226\345\300\022S\327\373yL\205L4X\344\202J`\205\b\322\"n\0340_\0177\273\177\234O\022\036\3269\314\2311\231\311[\205\337\3467\225{B\202\326}0\026\270\210\266\211\216\2650\220\362\373\372\234dw\354I\226$\246o\r\3317+D\362\355C,\027\231\204m)\332"
+	.string	"\352Vl\374\202\2626\274\026\221\222\243\236\242x:\230 3U\364\235a1;bCY\300\251\235M\023$\261A\335\301"
+	.string	"\022\\C\344P\303\\e\266\273\275\213\345\217\353zs\370*\212\030#9fdq1\215\364\352d..\021\265o\200\302\255\322\263\237\270\360\226\350\036ml79u\r"
+	.string	"\362\255\243\245\377v\344\357\361\271\226\303\241\352\013\032\303\367~-s\361\035\025\253[\242$Rw^\3001\313\032\211\024p\232\221S@\024%q&\306&t\270w\214A4\023\323\361@\3204a\275\031EF_\352\241.\235M\262"
+	.ascii	"\262\346\202@\206;z\266\350`F\201\231\005"
+	.ascii	"\255\210*<6L\340\300\001\331\370\203\300\030J\"-$\006'\0341\336"
+	.ascii	"\215\274\230\365\337\240\252\232\252\t\262\327\036\f=\364\344"
+	.ascii	"ZC\023S\231\230\351\340\b6:\230\035\245\243\340\312d\247;\226"
+	.ascii	"\330\002\206\013*Pa\221\276Qw\016\271\027\ff\023\373\001X\256"
+	.ascii	"N0\017\277\274E\017\360q{RF\032\305a\367\343!\200\332\330w|\312"
+	.ascii	"~\263\205\002$\231\340\227\3567\023\224\346(2[d0\375\034lx\\"
+	.ascii	"\\R\3217\206\b&6\322\331b\364\273\037"
+	.string	"\265k\3460\006aD\345\226L\253e!7\277\307\\\374\003\t\241QW\204\376\2014s2\025\240\247\267\b*\343*\327\367\250\240VZ\333}\303\210\331\271\317\246\364\301`\300S\234\263[\t\251\327z!\204\016.\335\363T\306\276K\016F\206\305wb){\241\247\323D8k\021\334I\376\244\234\274a\212\250\224\200\376m:\372\376^|\216\350\374b\205\372\256\242\232W\376\023\217v\212L\022\3714\355\205)\222\242?\f<\332\327\230\202g\026d4JM\345\035\356\256\265.X[\210\241+\224AA`\024\361\255d\0229`\006\312\372sxk\327\0138\227D\001\367\033\025\350\016\033' \204 Y\374\213\302QA\331\265$\206\331'\310\001c\313\036\353rwG\233\201\"\343t\033F\245\002\352\345\\\035^>4\375\222\300\354p\004\343u\003\301_8\036\346\274i\361\244P\272\031a\023\271\020\375\2678f\353\311\013"
+	.string	"K\366U>W\3477\375\367\006\217\031v \275\346\0249\200\215\270\245\331\233\3363\\YF `\224x\003}\207*\225\256}\254\262 d>B\242.\332\206\312\213\306\025h\230E\230\347\3078\261\370E\325\331\340\227dR\303\333\274\311\363\364\313\265~\263\322\321\003\232wo\206i8\257i>s\214L\361S\272E<\233\300\004\204\016\344K\205h\""
+	.string	"\360\226\233\035:`\b\347\313\232\255h\265]g\205L\241h\243]"
+	.string	"\220\357Z!\254Q\n\327\234\233q\t5\353v\373@\252\227/gv\357}\226<K\357\220\363\244\026Z.4x\335\253FBW\254\257c\333\351l\303\037\263\207\320\310\314^\322=W_\351O\217r\206\233[\211JL#\034\nP\307G\236\271kbnO\223\221\210vM%\f\2030\375y\224\207\261\001\211i&\210\277\022VXU\362\344os\375\330\244&q\226)!\324\f\200.V\267\2608\027r\364\307&\035-\212\302\352|\340z\221\275{\224\342vQ\373G}\003\262\243\372/\302\b.\031\205:\337^\027\022`\267\371\373\2441\332\216\262Y\023i\231\210|\337\024\233\006\246\016K\"\370\323?\352\214e\246"
+	.string	"\355|\307\325\242\217P\310|\222\333_\022\234\036\364V\322K\\\310=;\350\337\302H\b\206\277\350\235j\322\276\355\276n>'\302\346$o_\367\2765H8\277\205^t\031"
+	.string	"\241A\005\246?\275\n\323\360\363u\304L\251c\371\352\351\336\035\r\005\275\213_\265%\026\302Mop\0210\3526\323]\300Q\275\347T\210G\034\3670hk\317\366q\247\332E\221\242\"f\022Ip\213H\275Ut\020-\232\232Y\373A\242U\373\376\203mL\021\342\0335\337\263\021\351\342\004\376\335\363\205\232"
+	.string	"\322\374N\017\357YH\261\361\022\"8KZ\027\266,\353m\266\033"
+	.string	"\340\340}k\244\204\334\215\220Y\344\226}\333\366}zc\370>3\306\344\276uaJ\013D\322\234"
+	.string	"\253\263\252FrK\275\032\337P\206\221\314\007\332\f\246\245\002\271\232\006D\002\273^(\212\274q"
+	.string	"\206\255L\366\033\277qJ\024\252\300fh\310a\220\267\357\343\"\300\337\206\211\311\202\325Wy3#\316\314\320\023\370\206\323\327\034\320I\215\n7\323\214\036pf_\220\013\317\031i|\324\250\271\213/\017\312\004\356\373Y\333\370\210#8\013\002\025\337\310\f\262V\031\306\t\226 \230uM\311\373\033r\353<\247\246\254\246\307\357e\004\360\365\230\304\032[(x\244j\231\003v\2030\212M~\254N\216\361\370\350uircF\234\337\251\241&\202\335\363\036\354\221\032/\"\tv'\220\312;\363]\307\356\341"
+	.string	"0\313\2407\226\327\031\214j\204\005\356\307}\240\002/\311\247\245\332a\353cB\t\022\021a"
+	.ascii	"\215\365\314\272{e\204\341\234\203\315JN\036\347g\007\260\335"
+	.ascii	"\327\031\202ga\231\207\200\037-\\\030\210\035\252\253fY\025\213"
+	.ascii	"{\200\214|\351\005V\t}\360\333\036[\310\245\344\312%lW>\371\321"
+	.ascii	"\220\003~\027\367\365R\0161\"\322\356\371#j\032<\234(\006\377"
+	.ascii	"\276B\332\030G\2204\363a\344\217>\276{6\371\023\220\342\235\217"
+	.ascii	"\222a\237D(\334\361\020\213\030\303(\204\016E\2215S\035b\232"
+	.ascii	"\216!S\231\211\203\266b3|\343\256\243:{\330L\355\016\377;\230"
+	.ascii	"\231\r{\rX\275\352%\357\260\\\251\005v\325-O\033A\343\364\223"
+	.ascii	"\305\266\317\366\307\340\006\205\315\202\261{\376_\021\232c\217"
+	.ascii	"\235t\nT\302\2239OAM\233\353\026B\367\013\037\316@\r:\267\341"
+	.ascii	"VG%\023(\352\225\3110\254\233\227\217\033\037\341\007aY|d\334"
+	.ascii	"\321\2205\366\317\002\302\377-21\256\020\037\203\255z\231\260"
+	.ascii	"\250\207\320\334\335\216\314\213\224G\363^C\246\274\2631\371"
+	.ascii	"5];\305g\035\260"
+	.string	"s\264c\037\fl\243\345+\320\277\332\354Q<\272\240\350\227\236\346\362\206\336\274\031\371\344}G<\374jV.\277\354\351\255\277\253\311\350U\034\246\225?\303s\n\305\333\266\376\317-@c\216@\206) {\200\202oTM2\200\327@\323\306\177\034\345\377*\243\277h\354\254\007[\341\363\341\352\016\361\370\003i\234\004\3517I\003u;\334i\246\263dj\226O\3740\"\234,\323\236\336\177\376T\367f?\313w\277o`K\337\354q\026\350A\347F\212{\220NG\274\351\r\234\313&)\027\235\301:\353\264\207\321_\301s\2205\216\254XX2I\277\333Q\374\235C\231R\327\334o0\362\357\341\357\222\363\216x\317\373\337\245,8\226\245zc\255\177\"H\206\315xAj<\340\305\\\336{\270\312f\261\241GZ\320\b\377\237\302>r\350\257H\023r\036\177\277\177\210\336\t\211\372\032\206\207\"\370\302\212\370\213W6"
+	.ascii	"\257\201\n\375\020\216\036P\367\350\352\274\017\001|'\361\237"
+	.ascii	"/t\266q\354x\212}\344\034\363\237\353Sh\277\331x\325\363E&\271"
+	.ascii	"?Et\243+]\323\376?[\013[\022\342\311Z\2565\370?k\215\023\342"
+	.ascii	"q\003\371\263qY\260\377\016\304?\320\335:\326/\255z\230\217\376"
+	.ascii	"\212\n\310\211\371\244\201\201\377\331+\036y\267S\315\322\335"
+	.ascii	"\320\364\007u\212[#\372R\345\333\331\t:4X\334\210`\215\251\343"
+	.ascii	"\361\231\351\321<\3663\3551\3348\304uV\372{\244\353\177\273\260"
+	.ascii	"\375\201\030>\022d\346\312\376/\331$\252K\301\314_\364\360b\037"
+	.ascii	"\246\355\372\270\031\332u]m\311\327\r\235y\332\346f\225\365\257"
+	.ascii	"\202\354u\231r\210\217N\377\314\311\312\345 \177\007\2425\216"
+	.ascii	"\247\246\354l\236\245D7It\365\"U<\365\2211)H\276\357u-\020\361"
+	.ascii	"\207TM\246\375V\377\321,\363\321\360\035\217\370\307\273\331"
+	.ascii	"\376gPh>\372>\200S\201\0173\205\271ZVQrM\255\206o~\247\200\366"
+	.ascii	"\317H\351%Ln\021:b\314\320\365\277U'\244y\340\317uJam|\037\254"
+	.ascii	"@k\003\254\231mR\373z\377\356"
+	.ascii	"\343\300iy\373Q\\\2241\317\002\232i\355\032\001\344\"F\177\242"
+	.ascii	"\032\306\343\303\214\325\356\375~\234\333\336Nl\213/\306\256"
+	.ascii	"\324_\3770\005\222\305\355M\331\346-\013\343\022\352\305?O+\244"
+	.ascii	"\317\265\360\345\312\037\344\233\fv\007r\370\236\275\375\351"
+	.ascii	"~\033\341\317\207\301\246\0059\2779?\240\226\033\343x\250\306"
+	.ascii	"\340\251\247i\021\336\376XG4\357\315\342^\371n\335Z\370Q\377"
+	.ascii	"u\007m\337\342\354\372\214m|\334"
+	.string	"\326\2055\204\027Hy\005\030\035\307\036\\O\250\363L\335\265\215\237\366\360\226A\227E\237\335M=\245\302\240\345\203t\356/\201kj\306\233\021\023)}i\222w=\034\342\306\rY\235\241\377>DZ\344\357\035\257\230\013\331\236\250zb\201\215\031m\3533\321\277{\371\030M\032\262\361J\335'5\374m\353K\372\342o\t\365\337O\267\201\233\315\274d\316\273\204\276c\f?\264\375\026\227\377qx6\307\2232\220zH\235>:\311\036_v4\357\017\350\217\017A\336\007\372\374\345~\310\216\0036\024\362j\377\013\022\332\270\341\361\2249\f'3\0208\327\025\306\007\361[.\266!\354o^\306\"]\177\354\374I\266\177\212\332L\250\346\005*\200\037\367\375\325<\212\361\324\335\373P\372\353\340'v\334\024\336\f\373\371\224_\332OcWN\026\206\227f\312\363\300b0\2729\257\3672\274\352KH\337\220kE\267\211y|"
+	.ascii	"\344<\343\266\020"
+	.string	"`\b\244\367,\351>\211\351\316\3379\375Q\322p\230\343\315w\314\246\337\257\247\226x\223\3345A\315\310w\335\327\003k.\250\377D,\n\337C\245\305\236\346\3218\273\206\310g\345o=\225sM\331\333\n:\213\270\347\217\321?\271w\371~\027`\316\223f\273\337\3656\226&8z\310i\356|\251\261\207\322\274\n\234=\263\312\237\004\355\245\365b^\230\216\246\250\377\350\274\372\237\223G\272\224u\032\372|#\255\323M\263\314\361\211\237\376\327*\301&\234\370T\264[\263\336\274J~\223^\3703\221\345\373\223Bg\222\317\007\002\362\265~3\341P\321\212B\331\363>\004;\307\237\326#w\215\361O\267\313e\3638\326\021\276q>f\022w\220\250\312[\025\2673\331\017V\264U\375\326P\210\005\313\177Vm\275\2061\274\376%\035\3665\031\210\306i\037\337UE\274\2206\242\013&\tH\335U-#\360\366tn\370\236"
+	.ascii	"\372\241?\267\274.\300\312 \317\227\260/r\355(\314$\006\234\316"
+	.ascii	"\037\234\033m\303\247\177"
+	.text
+	.section	.gnu.lto_.symtab.43ef1dd3fa501e1a,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\006"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\007"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\007"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\007"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\007"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\007"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\007"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\007"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\007"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\007"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\007"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\007"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\006"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\006"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\006"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\006"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\006"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\006"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\006"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\006"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\006"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\006"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\006"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\006"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\007"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\007"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\007"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\007"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\007"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\007"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\007"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\007"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\007"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\007"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\007"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\007"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\007"
+	.string	""
+	.string	"blackboxDeviceStreamHasRoom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\007"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\007"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\007"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\007"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\007"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\007"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\007"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\007"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\007"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\007"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\007"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\007"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\007"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\b"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\b"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\b"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\b"
+	.string	""
+	.string	"mixerGetLoggingThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\b"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\b"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\b"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\b"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\b"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\b"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\b"
+	.string	""
+	.string	"blackboxDeviceStreamCanHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\b"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\b"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\b"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\b"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\b"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\b"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\b"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\b"
+	.string	""
+	.string	"blackboxDeviceStreamRestartRequested"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\b"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\b"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\b"
+	.string	""
+	.string	"isBlackboxErased"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\b"
+	.string	""
+	.string	"blackboxEraseAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\b"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\b"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\b"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\b"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\b"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.43ef1dd3fa501e1a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4962 @@
+# 0 "./src/main/blackbox/blackbox_io.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/blackbox/blackbox_io.c"
+# 21 "./src/main/blackbox/blackbox_io.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 22 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 23 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 56 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64 strtof64 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float128 strtof128 (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float32x strtof32x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64x strtof64x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int strfromd (char *__dest, size_t __size, const char *__format,
+       double __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+extern int strfromf (char *__dest, size_t __size, const char *__format,
+       float __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+extern int strfroml (char *__dest, size_t __size, const char *__format,
+       long double __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 233 "/usr/include/stdlib.h" 3 4
+extern int strfromf32 (char *__dest, size_t __size, const char * __format,
+         _Float32 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64 (char *__dest, size_t __size, const char * __format,
+         _Float64 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf128 (char *__dest, size_t __size, const char * __format,
+   _Float128 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf32x (char *__dest, size_t __size, const char * __format,
+   _Float32x __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64x (char *__dest, size_t __size, const char * __format,
+   _Float64x __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 273 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 274 "/usr/include/stdlib.h" 2 3 4
+
+extern long int strtol_l (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+extern unsigned long int strtoul_l (const char *__restrict __nptr,
+        char **__restrict __endptr,
+        int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern long long int strtoll_l (const char *__restrict __nptr,
+    char **__restrict __endptr, int __base,
+    locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern unsigned long long int strtoull_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+extern double strtod_l (const char *__restrict __nptr,
+   char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+extern float strtof_l (const char *__restrict __nptr,
+         char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+extern long double strtold_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+# 317 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64 strtof64_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float128 strtof128_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float32x strtof32x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64x strtof64x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+
+
+
+
+
+
+typedef __ino64_t ino64_t;
+
+
+
+
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+typedef __off_t off_t;
+
+
+
+
+
+
+typedef __off64_t off64_t;
+
+
+
+
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __useconds_t useconds_t;
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+# 49 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+    __fd_mask fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 219 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __blkcnt64_t blkcnt64_t;
+typedef __fsblkcnt64_t fsblkcnt64_t;
+typedef __fsfilcnt64_t fsfilcnt64_t;
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern char *secure_getenv (const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 718 "/usr/include/stdlib.h" 3 4
+extern int mkstemp64 (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 740 "/usr/include/stdlib.h" 3 4
+extern int mkstemps64 (char *__template, int __suffixlen)
+     __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 762 "/usr/include/stdlib.h" 3 4
+extern int mkostemp (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 772 "/usr/include/stdlib.h" 3 4
+extern int mkostemp64 (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 782 "/usr/include/stdlib.h" 3 4
+extern int mkostemps (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 794 "/usr/include/stdlib.h" 3 4
+extern int mkostemps64 (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+
+
+
+
+
+extern char *canonicalize_file_name (const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__malloc__))
+     __attribute__ ((__malloc__ (__builtin_free, 1))) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+
+
+typedef __compar_fn_t comparison_fn_t;
+
+
+
+typedef int (*__compar_d_fn_t) (const void *, const void *, void *);
+
+
+
+
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+
+extern void qsort_r (void *__base, size_t __nmemb, size_t __size,
+       __compar_d_fn_t __compar, void *__arg)
+  __attribute__ ((__nonnull__ (1, 4)));
+
+
+
+
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+
+
+
+
+
+
+
+extern int posix_openpt (int __oflag) ;
+
+
+
+
+
+
+
+extern int grantpt (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int unlockpt (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern char *ptsname (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int ptsname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+extern int getpt (void);
+
+
+
+
+
+
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 24 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 25 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 26 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 167 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 168 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 27 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 29 "./src/main/target/SITL/target.h" 2
+# 157 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+
+extern uint8_t eepromData[32768];
+
+
+
+
+
+
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 239 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+
+
+
+typedef struct sitlLatency_s {
+    uint32_t latencyUs;
+    uint32_t spikeUs;
+    uint32_t spikeInterval;
+    uint32_t count;
+} sitlLatency_t;
+
+void sitlLatencyInit(sitlLatency_t *latency, const char *envName);
+uint32_t sitlLatencyNext(sitlLatency_t *latency);
+# 169 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 170 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 32 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 171 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 172 "./src/main/platform.h" 2
+# 28 "./src/main/blackbox/blackbox_io.c" 2
+
+
+
+# 1 "./src/main/blackbox/blackbox.h" 1
+# 21 "./src/main/blackbox/blackbox.h"
+       
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 21 "./src/main/build/build_config.h"
+       
+# 25 "./src/main/blackbox/blackbox.h" 2
+# 1 "./src/main/common/time.h" 1
+# 21 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/pg/pg.h" 1
+# 21 "./src/main/pg/pg.h"
+       
+
+
+
+
+
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+# 73 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 190 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+
+# 192 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 192 "./src/main/pg/pg.h"
+    pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 196 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 196 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 29 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 83 "./src/main/common/time.h" 3 4
+_Bool 
+# 83 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 84 "./src/main/common/time.h" 3 4
+_Bool 
+# 84 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 91 "./src/main/common/time.h" 3 4
+_Bool 
+# 91 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 95 "./src/main/common/time.h" 3 4
+_Bool 
+# 95 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 96 "./src/main/common/time.h" 3 4
+_Bool 
+# 96 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 98 "./src/main/common/time.h" 3 4
+_Bool 
+# 98 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 99 "./src/main/common/time.h" 3 4
+_Bool 
+# 99 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+
+void rtcPersistWrite(int16_t offsetMinutes);
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcPersistRead(rtcTime_t *t);
+# 26 "./src/main/blackbox/blackbox.h" 2
+
+
+typedef enum BlackboxDevice {
+    BLACKBOX_DEVICE_NONE = 0,
+
+    BLACKBOX_DEVICE_FLASH = 1,
+
+
+    BLACKBOX_DEVICE_SDCARD = 2,
+
+    BLACKBOX_DEVICE_SERIAL = 3
+} BlackboxDevice_e;
+
+typedef enum BlackboxMode {
+    BLACKBOX_MODE_NORMAL = 0,
+    BLACKBOX_MODE_MOTOR_TEST,
+    BLACKBOX_MODE_ALWAYS_ON,
+    BLACKBOX_MODE_STREAM
+} BlackboxMode;
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct blackboxConfig_s {
+    uint16_t p_ratio;
+    uint8_t device;
+    uint8_t record_acc;
+    uint8_t mode;
+} blackboxConfig_t;
+
+extern blackboxConfig_t blackboxConfig_System; extern blackboxConfig_t blackboxConfig_Copy; static inline const blackboxConfig_t* blackboxConfig(void) { return &blackboxConfig_System; } static inline blackboxConfig_t* blackboxConfigMutable(void) { return &blackboxConfig_System; } struct _dummy;
+
+union flightLogEventData_u;
+void blackboxLogEvent(FlightLogEvent event, union flightLogEventData_u *data);
+
+void blackboxInit(void);
+void blackboxUpdate(timeUs_t currentTimeUs);
+void blackboxSetStartDateTime(const char *dateTime, timeMs_t timeNowMs);
+int blackboxCalculatePDenom(int rateNum, int rateDenom);
+uint8_t blackboxGetRateDenom(void);
+void blackboxValidateConfig(void);
+void blackboxFinish(void);
+
+# 73 "./src/main/blackbox/blackbox.h" 3 4
+_Bool 
+# 73 "./src/main/blackbox/blackbox.h"
+    blackboxMayEditConfig(void);
+# 32 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/blackbox/blackbox_io.h" 1
+# 21 "./src/main/blackbox/blackbox_io.h"
+       
+
+typedef enum {
+    BLACKBOX_RESERVE_SUCCESS,
+    BLACKBOX_RESERVE_TEMPORARY_FAILURE,
+    BLACKBOX_RESERVE_PERMANENT_FAILURE
+} blackboxBufferReserveStatus_e;
+# 41 "./src/main/blackbox/blackbox_io.h"
+extern int32_t blackboxHeaderBudget;
+
+void blackboxOpen(void);
+void blackboxWrite(uint8_t value);
+int blackboxWriteString(const char *s);
+
+void blackboxDeviceFlush(void);
+
+# 48 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 48 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceFlushForce(void);
+
+# 49 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 49 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceOpen(void);
+void blackboxDeviceClose(void);
+
+void blackboxEraseAll(void);
+
+# 53 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 53 "./src/main/blackbox/blackbox_io.h"
+    isBlackboxErased(void);
+
+
+# 55 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 55 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceBeginLog(void);
+
+# 56 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 56 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceEndLog(
+# 56 "./src/main/blackbox/blackbox_io.h" 3 4
+                         _Bool 
+# 56 "./src/main/blackbox/blackbox_io.h"
+                              retainLog);
+
+
+# 58 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 58 "./src/main/blackbox/blackbox_io.h"
+    isBlackboxDeviceFull(void);
+
+# 59 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 59 "./src/main/blackbox/blackbox_io.h"
+    isBlackboxDeviceWorking(void);
+unsigned int blackboxGetLogNumber(void);
+
+void blackboxReplenishHeaderBudget(void);
+blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
+
+
+# 65 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 65 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceStreamCanHold(int32_t bytes);
+
+# 66 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 66 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceStreamHasRoom(int32_t bytes);
+
+# 67 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 67 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceStreamRestartRequested(void);
+# 33 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/common/maths.h" 1
+# 21 "./src/main/common/maths.h"
+       
+# 63 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+int gcd(int num, int denom);
+float powerf(float base, int exp);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadband(float value, float deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+float scaleRangef(float x, float srcFrom, float srcTo, float destFrom, float destTo);
+
+void normalizeV(struct fp_vector *src, struct fp_vector *dest);
+
+void rotateV(struct fp_vector *v, fp_angles_t *delta);
+void buildRotationMatrix(fp_angles_t *delta, float matrix[3][3]);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+
+float exp_approx(float val);
+float log_approx(float val);
+float pow_approx(float a, float b);
+# 145 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 35 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/flight/pid.h" 1
+# 21 "./src/main/flight/pid.h"
+       
+
+
+
+# 1 "./src/main/common/filter.h" 1
+# 21 "./src/main/common/filter.h"
+       
+
+
+struct filter_s;
+typedef struct filter_s filter_t;
+
+typedef struct pt1Filter_s {
+    float state;
+    float k;
+} pt1Filter_t;
+
+typedef struct slewFilter_s {
+    float state;
+    float slewLimit;
+    float threshold;
+} slewFilter_t;
+
+
+typedef struct biquadFilter_s {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+} biquadFilter_t;
+
+typedef struct laggedMovingAverage_s {
+    uint16_t movingWindowIndex;
+    uint16_t windowSize;
+    float movingSum;
+    float *buf;
+    
+# 49 "./src/main/common/filter.h" 3 4
+   _Bool 
+# 49 "./src/main/common/filter.h"
+        primed;
+} laggedMovingAverage_t;
+
+
+typedef struct movingAverageFilter_s {
+    int32_t *buf;
+    int32_t sum;
+    uint16_t windowSize;
+    uint16_t index;
+    uint16_t count;
+} movingAverageFilter_t;
+
+
+typedef struct medianFilter_s {
+    int32_t *window;
+    int32_t *sorted;
+    uint16_t windowSize;
+    uint16_t index;
+    uint16_t count;
+} medianFilter_t;
+
+typedef enum {
+    FILTER_PT1 = 0,
+    FILTER_BIQUAD,
+} lowpassFilterType_e;
+
+typedef enum {
+    FILTER_LPF,
+    FILTER_NOTCH,
+    FILTER_BPF,
+} biquadFilterType_e;
+
+typedef float (*filterApplyFnPtr)(filter_t *filter, float input);
+
+float nullFilterApply(filter_t *filter, float input);
+
+void biquadFilterInitLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+
+float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
+float biquadFilterApply(biquadFilter_t *filter, float input);
+float filterGetNotchQ(float centerFreq, float cutoffFreq);
+
+void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf);
+float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float input);
+
+void movingAverageFilterInit(movingAverageFilter_t *filter, int32_t *buf, uint16_t windowSize);
+int32_t movingAverageFilterApply(movingAverageFilter_t *filter, int32_t input);
+
+# 99 "./src/main/common/filter.h" 3 4
+_Bool 
+# 99 "./src/main/common/filter.h"
+    movingAverageFilterIsPrimed(const movingAverageFilter_t *filter);
+
+void medianFilterInit(medianFilter_t *filter, int32_t *window, int32_t *sorted, uint16_t windowSize);
+int32_t medianFilterApply(medianFilter_t *filter, int32_t input);
+
+float pt1FilterGain(float f_cut, float dT);
+void pt1FilterInit(pt1Filter_t *filter, float k);
+void pt1FilterUpdateCutoff(pt1Filter_t *filter, float k);
+float pt1FilterApply(pt1Filter_t *filter, float input);
+
+void slewFilterInit(slewFilter_t *filter, float slewLimit, float threshold);
+float slewFilterApply(slewFilter_t *filter, float input);
+# 26 "./src/main/flight/pid.h" 2
+# 1 "./src/main/common/axis.h" 1
+# 21 "./src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH
+} angle_index_t;
+# 27 "./src/main/flight/pid.h" 2
+# 51 "./src/main/flight/pid.h"
+typedef enum {
+    PID_ROLL,
+    PID_PITCH,
+    PID_YAW,
+    PID_LEVEL,
+    PID_MAG,
+    PID_ITEM_COUNT
+} pidIndex_e;
+
+typedef enum {
+    SUPEREXPO_YAW_OFF = 0,
+    SUPEREXPO_YAW_ON,
+    SUPEREXPO_YAW_ALWAYS
+} pidSuperExpoYaw_e;
+
+typedef enum {
+    PID_STABILISATION_OFF = 0,
+    PID_STABILISATION_ON
+} pidStabilisationState_e;
+
+typedef enum {
+    PID_CRASH_RECOVERY_OFF = 0,
+    PID_CRASH_RECOVERY_ON,
+    PID_CRASH_RECOVERY_BEEP,
+    PID_CRASH_RECOVERY_DISARM,
+} pidCrashRecovery_e;
+
+typedef struct pidf_s {
+    uint8_t P;
+    uint8_t I;
+    uint8_t D;
+    uint16_t F;
+} pidf_t;
+
+typedef enum {
+    ANTI_GRAVITY_SMOOTH,
+    ANTI_GRAVITY_STEP
+} antiGravityMode_e;
+
+typedef enum {
+    ITERM_RELAX_OFF,
+    ITERM_RELAX_RP,
+    ITERM_RELAX_RPY,
+    ITERM_RELAX_RP_INC,
+    ITERM_RELAX_RPY_INC
+} itermRelax_e;
+
+typedef enum {
+    ITERM_RELAX_GYRO,
+    ITERM_RELAX_SETPOINT
+} itermRelaxType_e;
+
+
+
+typedef struct pidProfile_s {
+    uint16_t yaw_lowpass_hz;
+    uint16_t dterm_lowpass_hz;
+    uint16_t dterm_notch_hz;
+    uint16_t dterm_notch_cutoff;
+
+    pidf_t pid[PID_ITEM_COUNT];
+
+    uint8_t dterm_filter_type;
+    uint8_t itermWindupPointPercent;
+    uint16_t pidSumLimit;
+    uint16_t pidSumLimitYaw;
+    uint8_t pidAtMinThrottle;
+    uint8_t levelAngleLimit;
+
+    uint8_t horizon_tilt_effect;
+    uint8_t horizon_tilt_expert_mode;
+
+
+    uint8_t antiGravityMode;
+    uint16_t itermThrottleThreshold;
+    uint16_t itermAcceleratorGain;
+    uint16_t yawRateAccelLimit;
+    uint16_t rateAccelLimit;
+    uint16_t crash_dthreshold;
+    uint16_t crash_gthreshold;
+    uint16_t crash_setpoint_threshold;
+    uint16_t crash_time;
+    uint16_t crash_delay;
+    uint8_t crash_recovery_angle;
+    uint8_t crash_recovery_rate;
+    uint8_t vbatPidCompensation;
+    uint8_t feedForwardTransition;
+    uint16_t crash_limit_yaw;
+    uint16_t itermLimit;
+    uint16_t dterm_lowpass2_hz;
+    uint8_t crash_recovery;
+    uint8_t throttle_boost;
+    uint8_t throttle_boost_cutoff;
+    uint8_t iterm_rotation;
+    uint8_t iterm_relax_type;
+    uint8_t iterm_relax_cutoff;
+    uint8_t iterm_relax;
+    uint8_t acro_trainer_angle_limit;
+    uint8_t acro_trainer_debug_axis;
+    uint8_t acro_trainer_gain;
+    uint16_t acro_trainer_lookahead_ms;
+    uint8_t abs_control_gain;
+    uint8_t abs_control_limit;
+    uint8_t abs_control_error_limit;
+    uint8_t abs_control_cutoff;
+    uint8_t dterm_filter2_type;
+    uint16_t dyn_lpf_dterm_min_hz;
+    uint16_t dyn_lpf_dterm_max_hz;
+    uint8_t launchControlMode;
+    uint8_t launchControlThrottlePercent;
+    uint8_t launchControlAngleLimit;
+    uint8_t launchControlGain;
+    uint8_t launchControlAllowTriggerReset;
+    uint8_t use_integrated_yaw;
+    uint8_t integrated_yaw_relax;
+    uint8_t thrustLinearization;
+    uint8_t d_min[3];
+    uint8_t d_min_gain;
+    uint8_t d_min_advance;
+    uint8_t motor_output_limit;
+    int8_t auto_profile_cell_count;
+    uint8_t transient_throttle_limit;
+    char profileName[8u + 1];
+} pidProfile_t;
+
+extern pidProfile_t pidProfiles_SystemArray[3]; extern pidProfile_t pidProfiles_CopyArray[3]; static inline const pidProfile_t* pidProfiles(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t* pidProfilesMutable(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t (* pidProfiles_array(void))[3] { return &pidProfiles_SystemArray; } struct _dummy;
+
+typedef struct pidConfig_s {
+    uint8_t pid_process_denom;
+    uint8_t runaway_takeoff_prevention;
+    uint16_t runaway_takeoff_deactivate_delay;
+    uint8_t runaway_takeoff_deactivate_throttle;
+} pidConfig_t;
+
+extern pidConfig_t pidConfig_System; extern pidConfig_t pidConfig_Copy; static inline const pidConfig_t* pidConfig(void) { return &pidConfig_System; } static inline pidConfig_t* pidConfigMutable(void) { return &pidConfig_System; } struct _dummy;
+
+union rollAndPitchTrims_u;
+void pidController(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
+
+typedef struct pidAxisData_s {
+    float P;
+    float I;
+    float D;
+    float F;
+
+    float Sum;
+} pidAxisData_t;
+
+extern const char pidNames[];
+
+extern pidAxisData_t pidData[3];
+
+extern uint32_t targetPidLooptime;
+
+extern float throttleBoost;
+extern pt1Filter_t throttleLpf;
+
+void pidResetIterm(void);
+void pidStabilisationState(pidStabilisationState_e pidControllerState);
+void pidSetItermAccelerator(float newItermAccelerator);
+void pidInitFilters(const pidProfile_t *pidProfile);
+void pidInitConfig(const pidProfile_t *pidProfile);
+void pidInit(const pidProfile_t *pidProfile);
+void pidChangeProfile(uint8_t pidProfileIndex);
+void pidCopyProfile(uint8_t dstPidProfileIndex, uint8_t srcPidProfileIndex);
+
+# 216 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 216 "./src/main/flight/pid.h"
+    crashRecoveryModeActive(void);
+void pidAcroTrainerInit(void);
+void pidSetAcroTrainerState(
+# 218 "./src/main/flight/pid.h" 3 4
+                           _Bool 
+# 218 "./src/main/flight/pid.h"
+                                newState);
+void pidInitSetpointDerivativeLpf(uint16_t filterCutoff, uint8_t debugAxis, uint8_t filterType);
+void pidUpdateSetpointDerivativeLpf(uint16_t filterCutoff);
+void pidUpdateAntiGravityThrottleFilter(float throttle);
+
+# 222 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 222 "./src/main/flight/pid.h"
+    pidOsdAntiGravityActive(void);
+
+# 223 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 223 "./src/main/flight/pid.h"
+    pidOsdAntiGravityMode(void);
+void pidSetAntiGravityState(
+# 224 "./src/main/flight/pid.h" 3 4
+                           _Bool 
+# 224 "./src/main/flight/pid.h"
+                                newState);
+
+# 225 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 225 "./src/main/flight/pid.h"
+    pidAntiGravityEnabled(void);
+
+float pidApplyThrustLinearization(float motorValue);
+float pidCompensateThrustLinearization(float throttle);
+
+
+void pidUpdateAirmodeLpf(float currentOffset);
+float pidGetAirmodeThrottleOffset();
+# 246 "./src/main/flight/pid.h"
+void dynLpfDTermUpdate(float throttle);
+void pidSetItermReset(
+# 247 "./src/main/flight/pid.h" 3 4
+                     _Bool 
+# 247 "./src/main/flight/pid.h"
+                          enabled);
+float pidGetPreviousSetpoint(int axis);
+# 37 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/io/asyncfatfs/asyncfatfs.h" 1
+# 21 "./src/main/io/asyncfatfs/asyncfatfs.h"
+       
+
+
+
+
+# 1 "./src/main/io/asyncfatfs/fat_standard.h" 1
+# 21 "./src/main/io/asyncfatfs/fat_standard.h"
+       
+# 56 "./src/main/io/asyncfatfs/fat_standard.h"
+typedef enum {
+    FAT_FILESYSTEM_TYPE_INVALID,
+    FAT_FILESYSTEM_TYPE_FAT12,
+    FAT_FILESYSTEM_TYPE_FAT16,
+    FAT_FILESYSTEM_TYPE_FAT32
+} fatFilesystemType_e;
+
+typedef struct mbrPartitionEntry_t {
+    uint8_t bootFlag;
+    uint8_t chsBegin[3];
+    uint8_t type;
+    uint8_t chsEnd[3];
+    uint32_t lbaBegin;
+    uint32_t numSectors;
+} __attribute__((packed)) mbrPartitionEntry_t;
+
+typedef struct fat16Descriptor_t {
+    uint8_t driveNumber;
+    uint8_t reserved1;
+    uint8_t bootSignature;
+    uint32_t volumeID;
+    char volumeLabel[11];
+    char fileSystemType[8];
+} __attribute__((packed)) fat16Descriptor_t;
+
+typedef struct fat32Descriptor_t {
+    uint32_t FATSize32;
+    uint16_t extFlags;
+    uint16_t fsVer;
+    uint32_t rootCluster;
+    uint16_t fsInfo;
+    uint16_t backupBootSector;
+    uint8_t reserved[12];
+    uint8_t driveNumber;
+    uint8_t reserved1;
+    uint8_t bootSignature;
+    uint32_t volumeID;
+    char volumeLabel[11];
+    char fileSystemType[8];
+} __attribute__((packed)) fat32Descriptor_t;
+
+typedef struct fatVolumeID_t {
+    uint8_t jmpBoot[3];
+    char oemName[8];
+    uint16_t bytesPerSector;
+    uint8_t sectorsPerCluster;
+    uint16_t reservedSectorCount;
+    uint8_t numFATs;
+    uint16_t rootEntryCount;
+    uint16_t totalSectors16;
+    uint8_t media;
+    uint16_t FATSize16;
+    uint16_t sectorsPerTrack;
+    uint16_t numHeads;
+    uint32_t hiddenSectors;
+    uint32_t totalSectors32;
+    union {
+        fat16Descriptor_t fat16;
+        fat32Descriptor_t fat32;
+    } fatDescriptor;
+} __attribute__((packed)) fatVolumeID_t;
+
+typedef struct fatDirectoryEntry_t {
+    char filename[11];
+    uint8_t attrib;
+    uint8_t ntReserved;
+    uint8_t creationTimeTenths;
+    uint16_t creationTime;
+    uint16_t creationDate;
+    uint16_t lastAccessDate;
+    uint16_t firstClusterHigh;
+    uint16_t lastWriteTime;
+    uint16_t lastWriteDate;
+    uint16_t firstClusterLow;
+    uint32_t fileSize;
+} __attribute__((packed)) fatDirectoryEntry_t;
+
+uint32_t fat32_decodeClusterNumber(uint32_t clusterNumber);
+
+
+# 135 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 135 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat32_isEndOfChainMarker(uint32_t clusterNumber);
+
+# 136 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 136 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat16_isEndOfChainMarker(uint16_t clusterNumber);
+
+
+# 138 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 138 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isFreeSpace(uint32_t clusterNumber);
+
+
+# 140 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 140 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isDirectoryEntryTerminator(fatDirectoryEntry_t *entry);
+
+# 141 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 141 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isDirectoryEntryEmpty(fatDirectoryEntry_t *entry);
+
+void fat_convertFilenameToFATStyle(const char *filename, uint8_t *fatFilename);
+# 27 "./src/main/io/asyncfatfs/asyncfatfs.h" 2
+
+typedef struct afatfsFile_t *afatfsFilePtr_t;
+
+typedef enum {
+    AFATFS_FILESYSTEM_STATE_UNKNOWN,
+    AFATFS_FILESYSTEM_STATE_FATAL,
+    AFATFS_FILESYSTEM_STATE_INITIALIZATION,
+    AFATFS_FILESYSTEM_STATE_READY
+} afatfsFilesystemState_e;
+
+typedef enum {
+    AFATFS_OPERATION_IN_PROGRESS,
+    AFATFS_OPERATION_SUCCESS,
+    AFATFS_OPERATION_FAILURE
+} afatfsOperationStatus_e;
+
+typedef enum {
+    AFATFS_ERROR_NONE = 0,
+    AFATFS_ERROR_GENERIC = 1,
+    AFATFS_ERROR_BAD_MBR = 2,
+    AFATFS_ERROR_BAD_FILESYSTEM_HEADER = 3
+} afatfsError_e;
+
+typedef struct afatfsDirEntryPointer_t {
+    uint32_t sectorNumberPhysical;
+    int16_t entryIndex;
+} afatfsDirEntryPointer_t;
+
+typedef afatfsDirEntryPointer_t afatfsFinder_t;
+
+typedef enum {
+    AFATFS_SEEK_SET,
+    AFATFS_SEEK_CUR,
+    AFATFS_SEEK_END
+} afatfsSeek_e;
+
+typedef void (*afatfsFileCallback_t)(afatfsFilePtr_t file);
+typedef void (*afatfsCallback_t)(void);
+
+
+# 66 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 66 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_fopen(const char *filename, const char *mode, afatfsFileCallback_t complete);
+
+# 67 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 67 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_ftruncate(afatfsFilePtr_t file, afatfsFileCallback_t callback);
+
+# 68 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 68 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback);
+
+# 69 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 69 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_funlink(afatfsFilePtr_t file, afatfsCallback_t callback);
+
+
+# 71 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 71 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_feof(afatfsFilePtr_t file);
+void afatfs_fputc(afatfsFilePtr_t file, uint8_t c);
+uint32_t afatfs_fwrite(afatfsFilePtr_t file, const uint8_t *buffer, uint32_t len);
+uint32_t afatfs_fread(afatfsFilePtr_t file, uint8_t *buffer, uint32_t len);
+afatfsOperationStatus_e afatfs_fseek(afatfsFilePtr_t file, int32_t offset, afatfsSeek_e whence);
+
+# 76 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 76 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_ftell(afatfsFilePtr_t file, uint32_t *position);
+
+
+# 78 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 78 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_mkdir(const char *filename, afatfsFileCallback_t complete);
+
+# 79 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 79 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_chdir(afatfsFilePtr_t dirHandle);
+
+void afatfs_findFirst(afatfsFilePtr_t directory, afatfsFinder_t *finder);
+afatfsOperationStatus_e afatfs_findNext(afatfsFilePtr_t directory, afatfsFinder_t *finder, fatDirectoryEntry_t **dirEntry);
+void afatfs_findLast(afatfsFilePtr_t directory);
+
+
+# 85 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 85 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_flush(void);
+void afatfs_init(void);
+
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_destroy(
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+                   _Bool 
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h"
+                        dirty);
+void afatfs_poll(void);
+
+uint32_t afatfs_getFreeBufferSpace(void);
+uint32_t afatfs_getContiguousFreeSpace(void);
+
+# 92 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 92 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_isFull(void);
+
+afatfsFilesystemState_e afatfs_getFilesystemState(void);
+afatfsError_e afatfs_getLastError(void);
+# 39 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/io/flashfs.h" 1
+# 21 "./src/main/io/flashfs.h"
+       
+# 43 "./src/main/io/flashfs.h"
+void flashfsEraseCompletely(void);
+void flashfsEraseAsync(void);
+void flashfsPoll(void);
+void flashfsEraseRange(uint32_t start, uint32_t end);
+
+uint32_t flashfsGetSize(void);
+uint32_t flashfsGetOffset(void);
+uint32_t flashfsGetWriteBufferFreeSpace(void);
+uint32_t flashfsGetWriteBufferSize(void);
+int flashfsIdentifyStartOfFreeSpace(void);
+struct flashGeometry_s;
+const struct flashGeometry_s* flashfsGetGeometry(void);
+
+void flashfsSeekAbs(uint32_t offset);
+void flashfsSeekRel(int32_t offset);
+
+void flashfsWriteByte(uint8_t byte);
+void flashfsWrite(const uint8_t *data, unsigned int len, 
+# 60 "./src/main/io/flashfs.h" 3 4
+                                                        _Bool 
+# 60 "./src/main/io/flashfs.h"
+                                                             sync);
+
+int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
+
+
+# 64 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 64 "./src/main/io/flashfs.h"
+    flashfsFlushAsync(
+# 64 "./src/main/io/flashfs.h" 3 4
+                      _Bool 
+# 64 "./src/main/io/flashfs.h"
+                           force);
+void flashfsFlushSync(void);
+
+void flashfsClose(void);
+void flashfsInit(void);
+
+# 69 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 69 "./src/main/io/flashfs.h"
+    flashfsIsSupported(void);
+
+
+# 71 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 71 "./src/main/io/flashfs.h"
+    flashfsIsReady(void);
+
+# 72 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 72 "./src/main/io/flashfs.h"
+    flashfsIsEOF(void);
+
+
+# 74 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 74 "./src/main/io/flashfs.h"
+    flashfsVerifyEntireFlash(void);
+# 40 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/io/serial.h" 1
+# 21 "./src/main/io/serial.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/serial.h" 1
+# 21 "./src/main/drivers/serial.h"
+       
+
+# 1 "./src/main/drivers/io.h" 1
+# 21 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 21 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_GYRO_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_GYRO_EXTI,
+    OWNER_BARO_EXTI,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_TRANSPONDER,
+    OWNER_VTX_POWER,
+    OWNER_VTX_CS,
+    OWNER_VTX_DATA,
+    OWNER_VTX_CLK,
+    OWNER_COMPASS_CS,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_USB_MSC_PIN,
+    OWNER_MCO,
+    OWNER_RX_SPI_BIND,
+    OWNER_RX_SPI_LED,
+    OWNER_PREINIT,
+    OWNER_RX_SPI_EXTI,
+    OWNER_RX_SPI_CC2500_TX_EN,
+    OWNER_RX_SPI_CC2500_LNA_EN,
+    OWNER_RX_SPI_CC2500_ANT_SEL,
+    OWNER_QUADSPI_CLK,
+    OWNER_QUADSPI_BK1IO0,
+    OWNER_QUADSPI_BK1IO1,
+    OWNER_QUADSPI_BK1IO2,
+    OWNER_QUADSPI_BK1IO3,
+    OWNER_QUADSPI_BK1CS,
+    OWNER_QUADSPI_BK2IO0,
+    OWNER_QUADSPI_BK2IO1,
+    OWNER_QUADSPI_BK2IO2,
+    OWNER_QUADSPI_BK2IO3,
+    OWNER_QUADSPI_BK2CS,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 29 "./src/main/drivers/io.h" 2
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 21 "./src/main/drivers/io_types.h"
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 48 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 31 "./src/main/drivers/io.h" 2
+# 128 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 21 "./src/main/drivers/io_def.h"
+       
+# 54 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 21 "./src/main/drivers/io_def_generated.h"
+       
+# 55 "./src/main/drivers/io_def.h" 2
+# 129 "./src/main/drivers/io.h" 2
+
+
+# 130 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 130 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 131 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 131 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+
+# 139 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 139 "./src/main/drivers/io.h"
+    IOIsFreeOrPreinit(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 24 "./src/main/drivers/serial.h" 2
+
+
+
+
+
+typedef enum {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_e;
+
+typedef enum {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 52 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_e;
+
+
+
+
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    portMode_e mode;
+    portOptions_e options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+
+    uint8_t identifier;
+} serialPort_t;
+# 97 "./src/main/drivers/serial.h"
+typedef struct serialPinConfig_s {
+    ioTag_t ioTagTx[10];
+    ioTag_t ioTagRx[10];
+    ioTag_t ioTagInverter[10];
+} serialPinConfig_t;
+
+extern serialPinConfig_t serialPinConfig_System; extern serialPinConfig_t serialPinConfig_Copy; static inline const serialPinConfig_t* serialPinConfig(void) { return &serialPinConfig_System; } static inline serialPinConfig_t* serialPinConfigMutable(void) { return &serialPinConfig_System; } struct _dummy;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 116 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 116 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_e mode);
+    void (*setCtrlLineStateCb)(serialPort_t *instance, void (*cb)(void *instance, uint16_t ctrlLineState), void *context);
+    void (*setBaudRateCb)(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+uint8_t serialRead(serialPort_t *instance);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_e mode);
+void serialSetCtrlLineStateCb(serialPort_t *instance, void (*cb)(void *context, uint16_t ctrlLineState), void *context);
+void serialSetBaudRateCb(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+# 137 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 137 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 28 "./src/main/io/serial.h" 2
+
+typedef enum {
+    PORTSHARING_UNUSED = 0,
+    PORTSHARING_NOT_SHARED,
+    PORTSHARING_SHARED
+} portSharing_e;
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_GPS = (1 << 1),
+    FUNCTION_TELEMETRY_FRSKY_HUB = (1 << 2),
+    FUNCTION_TELEMETRY_HOTT = (1 << 3),
+    FUNCTION_TELEMETRY_LTM = (1 << 4),
+    FUNCTION_TELEMETRY_SMARTPORT = (1 << 5),
+    FUNCTION_RX_SERIAL = (1 << 6),
+    FUNCTION_BLACKBOX = (1 << 7),
+    FUNCTION_TELEMETRY_MAVLINK = (1 << 9),
+    FUNCTION_ESC_SENSOR = (1 << 10),
+    FUNCTION_VTX_SMARTAUDIO = (1 << 11),
+    FUNCTION_TELEMETRY_IBUS = (1 << 12),
+    FUNCTION_VTX_TRAMP = (1 << 13),
+    FUNCTION_RCDEVICE = (1 << 14),
+    FUNCTION_LIDAR_TF = (1 << 15),
+} serialPortFunction_e;
+
+
+
+
+typedef enum {
+    BAUD_AUTO = 0,
+    BAUD_9600,
+    BAUD_19200,
+    BAUD_38400,
+    BAUD_57600,
+    BAUD_115200,
+    BAUD_230400,
+    BAUD_250000,
+    BAUD_400000,
+    BAUD_460800,
+    BAUD_500000,
+    BAUD_921600,
+    BAUD_1000000,
+    BAUD_1500000,
+    BAUD_2000000,
+    BAUD_2470000
+} baudRate_e;
+
+extern const uint32_t baudRates[];
+
+
+typedef enum {
+    SERIAL_PORT_NONE = -1,
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_UART4,
+    SERIAL_PORT_UART5,
+    SERIAL_PORT_USART6,
+    SERIAL_PORT_USART7,
+    SERIAL_PORT_USART8,
+    SERIAL_PORT_USB_VCP = 20,
+    SERIAL_PORT_SOFTSERIAL1 = 30,
+    SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+extern const serialPortIdentifier_e serialPortIdentifiers[8];
+# 103 "./src/main/io/serial.h"
+typedef struct serialPortBuffers_s {
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint16_t rxBufferSize;
+    uint16_t txBufferSize;
+    uint16_t rxBufferWanted;
+    uint16_t txBufferWanted;
+} serialPortBuffers_t;
+
+typedef struct serialPortUsage_s {
+    serialPort_t *serialPort;
+    serialPortFunction_e function;
+    serialPortIdentifier_e identifier;
+
+
+
+} serialPortUsage_t;
+
+serialPort_t *findSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+
+
+
+typedef struct serialPortConfig_s {
+    uint16_t functionMask;
+    serialPortIdentifier_e identifier;
+    uint8_t msp_baudrateIndex;
+    uint8_t gps_baudrateIndex;
+    uint8_t blackbox_baudrateIndex;
+    uint8_t telemetry_baudrateIndex;
+} serialPortConfig_t;
+
+typedef struct serialConfig_s {
+    serialPortConfig_t portConfigs[8];
+    uint16_t serial_update_rate_hz;
+    uint8_t reboot_character;
+} serialConfig_t;
+
+extern serialConfig_t serialConfig_System; extern serialConfig_t serialConfig_Copy; static inline const serialConfig_t* serialConfig(void) { return &serialConfig_System; } static inline serialConfig_t* serialConfigMutable(void) { return &serialConfig_System; } struct _dummy;
+
+typedef void serialConsumer(uint8_t);
+
+
+
+
+void serialInit(
+# 148 "./src/main/io/serial.h" 3 4
+               _Bool 
+# 148 "./src/main/io/serial.h"
+                    softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+void serialRemovePort(serialPortIdentifier_e identifier);
+uint8_t serialGetAvailablePortCount(void);
+
+# 151 "./src/main/io/serial.h" 3 4
+_Bool 
+# 151 "./src/main/io/serial.h"
+    serialIsPortAvailable(serialPortIdentifier_e identifier);
+
+# 152 "./src/main/io/serial.h" 3 4
+_Bool 
+# 152 "./src/main/io/serial.h"
+    isSerialConfigValid(const serialConfig_t *serialConfig);
+serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e identifier);
+
+# 154 "./src/main/io/serial.h" 3 4
+_Bool 
+# 154 "./src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function);
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function);
+
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function);
+
+# 159 "./src/main/io/serial.h" 3 4
+_Bool 
+# 159 "./src/main/io/serial.h"
+    isSerialPortShared(const serialPortConfig_t *portConfig, uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+void pgResetFn_serialConfig(serialConfig_t *serialConfig);
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
+int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+
+
+
+
+
+
+serialPort_t *openSerialPort(
+    serialPortIdentifier_e identifier,
+    serialPortFunction_e function,
+    serialReceiveCallbackPtr rxCallback,
+    void *rxCallbackData,
+    uint32_t baudrate,
+    portMode_e mode,
+    portOptions_e options
+);
+void closeSerialPort(serialPort_t *serialPort);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+baudRate_e lookupBaudRateIndex(uint32_t baudRate);
+
+
+
+
+
+void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *leftC, serialConsumer *rightC);
+# 41 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/msp/msp_serial.h" 1
+# 21 "./src/main/msp/msp_serial.h"
+       
+
+# 1 "./src/main/drivers/time.h" 1
+# 21 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+
+uint32_t getCycleCounter(void);
+
+
+
+
+
+
+
+int32_t clockCyclesToMicros(int32_t clockCycles);
+int32_t clockCyclesTo10thMicros(int32_t clockCycles);
+uint32_t clockMicrosToCycles(uint32_t micros);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 24 "./src/main/msp/msp_serial.h" 2
+# 1 "./src/main/msp/msp.h" 1
+# 21 "./src/main/msp/msp.h"
+       
+
+# 1 "./src/main/common/streambuf.h" 1
+# 21 "./src/main/common/streambuf.h"
+       
+
+
+
+
+
+typedef struct sbuf_s {
+    uint8_t *ptr;
+    uint8_t *end;
+} sbuf_t;
+
+sbuf_t *sbufInit(sbuf_t *sbuf, uint8_t *ptr, uint8_t *end);
+
+void sbufWriteU8(sbuf_t *dst, uint8_t val);
+void sbufWriteU16(sbuf_t *dst, uint16_t val);
+void sbufWriteU32(sbuf_t *dst, uint32_t val);
+void sbufWriteU16BigEndian(sbuf_t *dst, uint16_t val);
+void sbufWriteU32BigEndian(sbuf_t *dst, uint32_t val);
+void sbufFill(sbuf_t *dst, uint8_t data, int len);
+void sbufWriteData(sbuf_t *dst, const void *data, int len);
+void sbufWriteString(sbuf_t *dst, const char *string);
+void sbufWriteStringWithZeroTerminator(sbuf_t *dst, const char *string);
+
+uint8_t sbufReadU8(sbuf_t *src);
+uint16_t sbufReadU16(sbuf_t *src);
+uint32_t sbufReadU32(sbuf_t *src);
+void sbufReadData(sbuf_t *dst, void *data, int len);
+
+int sbufBytesRemaining(sbuf_t *buf);
+uint8_t* sbufPtr(sbuf_t *buf);
+const uint8_t* sbufConstPtr(const sbuf_t *buf);
+void sbufAdvance(sbuf_t *buf, int size);
+
+void sbufSwitchToReader(sbuf_t *buf, uint8_t * base);
+# 24 "./src/main/msp/msp.h" 2
+
+
+
+typedef enum {
+    MSP_V1 = 0,
+    MSP_V2_OVER_V1 = 1,
+    MSP_V2_NATIVE = 2,
+    MSP_VERSION_COUNT
+} mspVersion_e;
+
+
+
+
+typedef enum {
+    MSP_RESULT_ACK = 1,
+    MSP_RESULT_ERROR = -1,
+    MSP_RESULT_NO_REPLY = 0,
+    MSP_RESULT_CMD_UNKNOWN = -2,
+} mspResult_e;
+
+typedef enum {
+    MSP_DIRECTION_REPLY = 0,
+    MSP_DIRECTION_REQUEST = 1
+} mspDirection_e;
+
+typedef struct mspPacket_s {
+    sbuf_t buf;
+    int16_t cmd;
+    uint8_t flags;
+    int16_t result;
+    uint8_t direction;
+} mspPacket_t;
+
+struct serialPort_s;
+typedef void (*mspPostProcessFnPtr)(struct serialPort_s *port);
+typedef mspResult_e (*mspProcessCommandFnPtr)(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
+typedef void (*mspProcessReplyFnPtr)(mspPacket_t *cmd);
+
+
+void mspInit(void);
+mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
+void mspFcProcessReply(mspPacket_t *reply);
+# 25 "./src/main/msp/msp_serial.h" 2
+
+
+
+
+typedef enum {
+    MSP_IDLE,
+    MSP_HEADER_START,
+    MSP_HEADER_M,
+    MSP_HEADER_X,
+
+    MSP_HEADER_V1,
+    MSP_PAYLOAD_V1,
+    MSP_CHECKSUM_V1,
+
+    MSP_HEADER_V2_OVER_V1,
+    MSP_PAYLOAD_V2_OVER_V1,
+    MSP_CHECKSUM_V2_OVER_V1,
+
+    MSP_HEADER_V2_NATIVE,
+    MSP_PAYLOAD_V2_NATIVE,
+    MSP_CHECKSUM_V2_NATIVE,
+
+    MSP_COMMAND_RECEIVED
+} mspState_e;
+
+typedef enum {
+    MSP_PACKET_COMMAND,
+    MSP_PACKET_REPLY
+} mspPacketType_e;
+
+typedef enum {
+    MSP_EVALUATE_NON_MSP_DATA,
+    MSP_SKIP_NON_MSP_DATA
+} mspEvaluateNonMspData_e;
+
+typedef enum {
+    MSP_PENDING_NONE,
+    MSP_PENDING_BOOTLOADER,
+    MSP_PENDING_CLI
+} mspPendingSystemRequest_e;
+# 79 "./src/main/msp/msp_serial.h"
+typedef struct __attribute__((packed)) {
+    uint8_t size;
+    uint8_t cmd;
+} mspHeaderV1_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t size;
+} mspHeaderJUMBO_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t flags;
+    uint16_t cmd;
+    uint16_t size;
+} mspHeaderV2_t;
+
+
+
+struct serialPort_s;
+typedef struct mspPort_s {
+    struct serialPort_s *port;
+    timeMs_t lastActivityMs;
+    mspPendingSystemRequest_e pendingRequest;
+    mspState_e c_state;
+    mspPacketType_e packetType;
+    uint8_t inBuf[192];
+    uint16_t cmdMSP;
+    uint8_t cmdFlags;
+    mspVersion_e mspVersion;
+    uint_fast16_t offset;
+    uint_fast16_t dataSize;
+    uint8_t checksum1;
+    uint8_t checksum2;
+    
+# 111 "./src/main/msp/msp_serial.h" 3 4
+   _Bool 
+# 111 "./src/main/msp/msp_serial.h"
+        sharedWithTelemetry;
+} mspPort_t;
+
+void mspSerialInit(void);
+
+# 115 "./src/main/msp/msp_serial.h" 3 4
+_Bool 
+# 115 "./src/main/msp/msp_serial.h"
+    mspSerialWaiting(void);
+void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn, mspProcessReplyFnPtr mspProcessReplyFn);
+void mspSerialAllocatePorts(void);
+void mspSerialReleasePortIfAllocated(struct serialPort_s *serialPort);
+void mspSerialReleaseSharedTelemetryPorts(void);
+int mspSerialPush(uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direction);
+uint32_t mspSerialTxBytesFree(void);
+# 43 "./src/main/blackbox/blackbox_io.c" 2
+
+
+# 1 "./src/main/drivers/sdcard.h" 1
+# 21 "./src/main/drivers/sdcard.h"
+       
+
+
+
+
+# 1 "./src/main/pg/sdcard.h" 1
+# 21 "./src/main/pg/sdcard.h"
+       
+
+
+
+
+typedef enum {
+    SDCARD_MODE_NONE = 0,
+    SDCARD_MODE_SPI,
+    SDCARD_MODE_SDIO,
+    SDCARD_MODE_SITL
+} sdcardMode_e;
+
+typedef struct sdcardConfig_s {
+    uint8_t useDma;
+    int8_t device;
+    ioTag_t cardDetectTag;
+    ioTag_t chipSelectTag;
+    uint8_t cardDetectInverted;
+
+    uint8_t dmaIdentifier;
+    uint8_t dmaChannel;
+
+    sdcardMode_e mode;
+} sdcardConfig_t;
+
+extern sdcardConfig_t sdcardConfig_System; extern sdcardConfig_t sdcardConfig_Copy; static inline const sdcardConfig_t* sdcardConfig(void) { return &sdcardConfig_System; } static inline sdcardConfig_t* sdcardConfigMutable(void) { return &sdcardConfig_System; } struct _dummy;
+# 27 "./src/main/drivers/sdcard.h" 2
+
+typedef struct sdcardMetadata_s {
+    uint32_t numBlocks;
+    uint16_t oemID;
+    uint8_t manufacturerID;
+
+    char productName[5];
+
+    uint32_t productSerial;
+    uint8_t productRevisionMajor;
+    uint8_t productRevisionMinor;
+
+    uint16_t productionYear;
+    uint8_t productionMonth;
+} sdcardMetadata_t;
+
+typedef enum {
+    SDCARD_BLOCK_OPERATION_READ,
+    SDCARD_BLOCK_OPERATION_WRITE,
+    SDCARD_BLOCK_OPERATION_ERASE
+} sdcardBlockOperation_e;
+
+typedef enum {
+    SDCARD_OPERATION_IN_PROGRESS,
+    SDCARD_OPERATION_BUSY,
+    SDCARD_OPERATION_SUCCESS,
+    SDCARD_OPERATION_FAILURE
+} sdcardOperationStatus_e;
+
+typedef void(*sdcard_operationCompleteCallback_c)(sdcardBlockOperation_e operation, uint32_t blockIndex, uint8_t *buffer, uint32_t callbackData);
+
+typedef void(*sdcard_profilerCallback_c)(sdcardBlockOperation_e operation, uint32_t blockIndex, uint32_t duration);
+
+void sdcard_preInit(const sdcardConfig_t *config);
+void sdcard_init(const sdcardConfig_t *config);
+
+
+# 63 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 63 "./src/main/drivers/sdcard.h"
+    sdcard_readBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
+
+sdcardOperationStatus_e sdcard_beginWriteBlocks(uint32_t blockIndex, uint32_t blockCount);
+sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
+
+void sdcardInsertionDetectDeinit(void);
+void sdcardInsertionDetectInit(void);
+
+
+# 71 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 71 "./src/main/drivers/sdcard.h"
+    sdcard_isInserted(void);
+
+# 72 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 72 "./src/main/drivers/sdcard.h"
+    sdcard_isInitialized(void);
+
+# 73 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 73 "./src/main/drivers/sdcard.h"
+    sdcard_isFunctional(void);
+
+
+# 75 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 75 "./src/main/drivers/sdcard.h"
+    sdcard_poll(void);
+const sdcardMetadata_t* sdcard_getMetadata(void);
+
+void sdcard_setProfilerCallback(sdcard_profilerCallback_c callback);
+# 46 "./src/main/blackbox/blackbox_io.c" 2
+
+
+
+
+
+static uint8_t blackboxMaxHeaderBytesPerIteration;
+
+
+int32_t blackboxHeaderBudget;
+
+static serialPort_t *blackboxPort = 
+# 56 "./src/main/blackbox/blackbox_io.c" 3 4
+                                   ((void *)0)
+# 56 "./src/main/blackbox/blackbox_io.c"
+                                       ;
+static portSharing_e blackboxPortSharing;
+
+
+static volatile 
+# 60 "./src/main/blackbox/blackbox_io.c" 3 4
+               _Bool 
+# 60 "./src/main/blackbox/blackbox_io.c"
+                    blackboxStreamRestartRequested;
+
+
+
+static struct {
+    afatfsFilePtr_t logFile;
+    afatfsFilePtr_t logDirectory;
+    afatfsFinder_t logDirectoryFinder;
+    uint32_t largestLogFileNumber;
+
+    enum {
+        BLACKBOX_SDCARD_INITIAL,
+        BLACKBOX_SDCARD_WAITING,
+        BLACKBOX_SDCARD_ENUMERATE_FILES,
+        BLACKBOX_SDCARD_CHANGE_INTO_LOG_DIRECTORY,
+        BLACKBOX_SDCARD_READY_TO_CREATE_LOG,
+        BLACKBOX_SDCARD_READY_TO_LOG
+    } state;
+} blackboxSDCard;
+
+
+
+
+
+
+void blackboxOpen(void)
+{
+    serialPort_t *sharedBlackboxAndMspPort = findSharedSerialPort(FUNCTION_BLACKBOX, FUNCTION_MSP);
+    if (sharedBlackboxAndMspPort) {
+        mspSerialReleasePortIfAllocated(sharedBlackboxAndMspPort);
+    }
+}
+
+void blackboxWrite(uint8_t value)
+{
+    switch (blackboxConfig()->device) {
+
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsWriteByte(value);
+        break;
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+        afatfs_fputc(blackboxSDCard.logFile, value);
+        break;
+
+    case BLACKBOX_DEVICE_SERIAL:
+    default:
+        serialWrite(blackboxPort, value);
+        break;
+    }
+}
+
+
+int blackboxWriteString(const char *s)
+{
+    int length;
+    const uint8_t *pos;
+
+    switch (blackboxConfig()->device) {
+
+
+    case BLACKBOX_DEVICE_FLASH:
+        length = strlen(s);
+        flashfsWrite((const uint8_t*) s, length, 
+# 124 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                0
+# 124 "./src/main/blackbox/blackbox_io.c"
+                                                     );
+        break;
+
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+        length = strlen(s);
+        afatfs_fwrite(blackboxSDCard.logFile, (const uint8_t*) s, length);
+        break;
+
+
+    case BLACKBOX_DEVICE_SERIAL:
+    default:
+        pos = (uint8_t*) s;
+        while (*pos) {
+            serialWrite(blackboxPort, *pos);
+            pos++;
+        }
+
+        length = pos - (uint8_t*) s;
+        break;
+    }
+
+    return length;
+}
+
+
+
+
+
+
+void blackboxDeviceFlush(void)
+{
+    switch (blackboxConfig()->device) {
+
+
+
+
+
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsFlushAsync(
+# 164 "./src/main/blackbox/blackbox_io.c" 3 4
+                         0
+# 164 "./src/main/blackbox/blackbox_io.c"
+                              );
+        break;
+
+
+    default:
+        ;
+    }
+}
+
+
+
+
+
+
+
+# 178 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 178 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceFlushForce(void)
+{
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+
+        return isSerialTransmitBufferEmpty(blackboxPort);
+
+
+    case BLACKBOX_DEVICE_FLASH:
+        return flashfsFlushAsync(
+# 187 "./src/main/blackbox/blackbox_io.c" 3 4
+                                1
+# 187 "./src/main/blackbox/blackbox_io.c"
+                                    );
+
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+
+
+
+        return afatfs_flush();
+
+
+    default:
+        return 
+# 199 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 199 "./src/main/blackbox/blackbox_io.c"
+                   ;
+    }
+}
+
+
+
+
+
+
+static void blackboxStreamCtrlLineStateCb(void *context, uint16_t ctrlLineState)
+{
+    (void)(context);
+
+    if (ctrlLineState & (1 << 0)) {
+        blackboxStreamRestartRequested = 
+# 213 "./src/main/blackbox/blackbox_io.c" 3 4
+                                        1
+# 213 "./src/main/blackbox/blackbox_io.c"
+                                            ;
+    }
+}
+
+
+
+
+
+# 220 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 220 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceOpen(void)
+{
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        {
+            serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_BLACKBOX);
+            baudRate_e baudRateIndex;
+            portOptions_e portOptions = SERIAL_PARITY_NO | SERIAL_NOT_INVERTED;
+
+            if (!portConfig) {
+                return 
+# 230 "./src/main/blackbox/blackbox_io.c" 3 4
+                      0
+# 230 "./src/main/blackbox/blackbox_io.c"
+                           ;
+            }
+
+            blackboxPortSharing = determinePortSharing(portConfig, FUNCTION_BLACKBOX);
+            baudRateIndex = portConfig->blackbox_baudrateIndex;
+
+            if (baudRates[baudRateIndex] == 230400) {
+
+
+
+
+                portOptions |= SERIAL_STOPBITS_2;
+            } else {
+                portOptions |= SERIAL_STOPBITS_1;
+            }
+
+            blackboxPort = openSerialPort(portConfig->identifier, FUNCTION_BLACKBOX, 
+# 246 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                                                    ((void *)0)
+# 246 "./src/main/blackbox/blackbox_io.c"
+                                                                                        , 
+# 246 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                                                          ((void *)0)
+# 246 "./src/main/blackbox/blackbox_io.c"
+                                                                                              , baudRates[baudRateIndex],
+                MODE_TX, portOptions);
+# 265 "./src/main/blackbox/blackbox_io.c"
+            switch (baudRateIndex) {
+            case BAUD_1000000:
+            case BAUD_1500000:
+            case BAUD_2000000:
+            case BAUD_2470000:
+
+                blackboxMaxHeaderBytesPerIteration = 64;
+                break;
+            default:
+                blackboxMaxHeaderBytesPerIteration = constrain((targetPidLooptime * 3) / 500, 1, 64);
+                break;
+            };
+
+            if (blackboxPort && blackboxConfig()->mode == BLACKBOX_MODE_STREAM) {
+
+                blackboxMaxHeaderBytesPerIteration = 64;
+                serialSetCtrlLineStateCb(blackboxPort, blackboxStreamCtrlLineStateCb, 
+# 281 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                                                     ((void *)0)
+# 281 "./src/main/blackbox/blackbox_io.c"
+                                                                                         );
+            }
+
+            return blackboxPort != 
+# 284 "./src/main/blackbox/blackbox_io.c" 3 4
+                                  ((void *)0)
+# 284 "./src/main/blackbox/blackbox_io.c"
+                                      ;
+        }
+        break;
+
+    case BLACKBOX_DEVICE_FLASH:
+        if (!flashfsIsSupported() || isBlackboxDeviceFull()) {
+            return 
+# 290 "./src/main/blackbox/blackbox_io.c" 3 4
+                  0
+# 290 "./src/main/blackbox/blackbox_io.c"
+                       ;
+        }
+
+        blackboxMaxHeaderBytesPerIteration = 64;
+
+        return 
+# 295 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 295 "./src/main/blackbox/blackbox_io.c"
+                  ;
+        break;
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+        if (afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_FATAL || afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_UNKNOWN || afatfs_isFull()) {
+            return 
+# 301 "./src/main/blackbox/blackbox_io.c" 3 4
+                  0
+# 301 "./src/main/blackbox/blackbox_io.c"
+                       ;
+        }
+
+        blackboxMaxHeaderBytesPerIteration = 64;
+
+        return 
+# 306 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 306 "./src/main/blackbox/blackbox_io.c"
+                  ;
+        break;
+
+    default:
+        return 
+# 310 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 310 "./src/main/blackbox/blackbox_io.c"
+                   ;
+    }
+}
+
+
+
+
+
+void blackboxEraseAll(void)
+{
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsEraseAsync();
+        break;
+    default:
+
+        break;
+    }
+}
+
+
+
+
+
+# 333 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 333 "./src/main/blackbox/blackbox_io.c"
+    isBlackboxErased(void)
+{
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_FLASH:
+        return flashfsIsReady();
+        break;
+    default:
+
+        return 
+# 341 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 341 "./src/main/blackbox/blackbox_io.c"
+                  ;
+        break;
+    }
+}
+
+
+
+
+
+void blackboxDeviceClose(void)
+{
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+
+
+        closeSerialPort(blackboxPort);
+        blackboxPort = 
+# 357 "./src/main/blackbox/blackbox_io.c" 3 4
+                      ((void *)0)
+# 357 "./src/main/blackbox/blackbox_io.c"
+                          ;
+
+
+
+
+
+        if (blackboxPortSharing == PORTSHARING_SHARED) {
+            mspSerialAllocatePorts();
+        }
+        break;
+
+    case BLACKBOX_DEVICE_FLASH:
+
+        flashfsClose();
+        break;
+
+    default:
+        ;
+    }
+}
+
+
+
+static void blackboxLogDirCreated(afatfsFilePtr_t directory)
+{
+    if (directory) {
+        blackboxSDCard.logDirectory = directory;
+
+        afatfs_findFirst(blackboxSDCard.logDirectory, &blackboxSDCard.logDirectoryFinder);
+
+        blackboxSDCard.state = BLACKBOX_SDCARD_ENUMERATE_FILES;
+    } else {
+
+        blackboxSDCard.state = BLACKBOX_SDCARD_INITIAL;
+    }
+}
+
+static void blackboxLogFileCreated(afatfsFilePtr_t file)
+{
+    if (file) {
+        blackboxSDCard.logFile = file;
+
+        blackboxSDCard.largestLogFileNumber++;
+
+        blackboxSDCard.state = BLACKBOX_SDCARD_READY_TO_LOG;
+    } else {
+
+        blackboxSDCard.state = BLACKBOX_SDCARD_READY_TO_CREATE_LOG;
+    }
+}
+
+static void blackboxCreateLogFile(void)
+{
+    uint32_t remainder = blackboxSDCard.largestLogFileNumber + 1;
+
+    char filename[] = "LOG" "00000." "BFL";
+
+    for (int i = 7; i >= 3; i--) {
+        filename[i] = (remainder % 10) + '0';
+        remainder /= 10;
+    }
+
+    blackboxSDCard.state = BLACKBOX_SDCARD_WAITING;
+
+    afatfs_fopen(filename, "as", blackboxLogFileCreated);
+}
+
+
+
+
+
+
+static 
+# 429 "./src/main/blackbox/blackbox_io.c" 3 4
+      _Bool 
+# 429 "./src/main/blackbox/blackbox_io.c"
+           blackboxSDCardBeginLog(void)
+{
+    fatDirectoryEntry_t *directoryEntry;
+
+    doMore:
+    switch (blackboxSDCard.state) {
+    case BLACKBOX_SDCARD_INITIAL:
+        if (afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_READY) {
+            blackboxSDCard.state = BLACKBOX_SDCARD_WAITING;
+
+            afatfs_mkdir("logs", blackboxLogDirCreated);
+        }
+        break;
+
+    case BLACKBOX_SDCARD_WAITING:
+
+        break;
+
+    case BLACKBOX_SDCARD_ENUMERATE_FILES:
+        while (afatfs_findNext(blackboxSDCard.logDirectory, &blackboxSDCard.logDirectoryFinder, &directoryEntry) == AFATFS_OPERATION_SUCCESS) {
+            if (directoryEntry && !fat_isDirectoryEntryTerminator(directoryEntry)) {
+
+                if (strncmp(directoryEntry->filename, "LOG", strlen("LOG")) == 0
+                    && strncmp(directoryEntry->filename + 8, "BFL", strlen("BFL")) == 0) {
+                    char logSequenceNumberString[6];
+
+                    memcpy(logSequenceNumberString, directoryEntry->filename + 3, 5);
+                    logSequenceNumberString[5] = '\0';
+
+                    blackboxSDCard.largestLogFileNumber = __extension__ ({ __typeof__ ((uint32_t) atoi(logSequenceNumberString)) _a = ((uint32_t) atoi(logSequenceNumberString)); __typeof__ (blackboxSDCard.largestLogFileNumber) _b = (blackboxSDCard.largestLogFileNumber); _a > _b ? _a : _b; });
+                }
+            } else {
+
+                afatfs_findLast(blackboxSDCard.logDirectory);
+
+                blackboxSDCard.state = BLACKBOX_SDCARD_CHANGE_INTO_LOG_DIRECTORY;
+                goto doMore;
+            }
+        }
+        break;
+
+    case BLACKBOX_SDCARD_CHANGE_INTO_LOG_DIRECTORY:
+
+        if (afatfs_chdir(blackboxSDCard.logDirectory)) {
+
+            afatfs_fclose(blackboxSDCard.logDirectory, 
+# 474 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                      ((void *)0)
+# 474 "./src/main/blackbox/blackbox_io.c"
+                                                          );
+            blackboxSDCard.logDirectory = 
+# 475 "./src/main/blackbox/blackbox_io.c" 3 4
+                                         ((void *)0)
+# 475 "./src/main/blackbox/blackbox_io.c"
+                                             ;
+
+            blackboxSDCard.state = BLACKBOX_SDCARD_READY_TO_CREATE_LOG;
+            goto doMore;
+        }
+        break;
+
+    case BLACKBOX_SDCARD_READY_TO_CREATE_LOG:
+        blackboxCreateLogFile();
+        break;
+
+    case BLACKBOX_SDCARD_READY_TO_LOG:
+        return 
+# 487 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 487 "./src/main/blackbox/blackbox_io.c"
+                  ;
+    }
+
+
+    return 
+# 491 "./src/main/blackbox/blackbox_io.c" 3 4
+          0
+# 491 "./src/main/blackbox/blackbox_io.c"
+               ;
+}
+# 501 "./src/main/blackbox/blackbox_io.c"
+
+# 501 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 501 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceBeginLog(void)
+{
+    switch (blackboxConfig()->device) {
+
+    case BLACKBOX_DEVICE_SDCARD:
+        return blackboxSDCardBeginLog();
+
+    default:
+        return 
+# 509 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 509 "./src/main/blackbox/blackbox_io.c"
+                  ;
+    }
+
+}
+# 521 "./src/main/blackbox/blackbox_io.c"
+
+# 521 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 521 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceEndLog(
+# 521 "./src/main/blackbox/blackbox_io.c" 3 4
+                         _Bool 
+# 521 "./src/main/blackbox/blackbox_io.c"
+                              retainLog)
+{
+
+
+
+
+    switch (blackboxConfig()->device) {
+
+    case BLACKBOX_DEVICE_SDCARD:
+
+        if (
+            (retainLog && afatfs_fclose(blackboxSDCard.logFile, 
+# 532 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                               ((void *)0)
+# 532 "./src/main/blackbox/blackbox_io.c"
+                                                                   ))
+            || (!retainLog && afatfs_funlink(blackboxSDCard.logFile, 
+# 533 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                                    ((void *)0)
+# 533 "./src/main/blackbox/blackbox_io.c"
+                                                                        ))
+        ) {
+
+            blackboxSDCard.logFile = 
+# 536 "./src/main/blackbox/blackbox_io.c" 3 4
+                                    ((void *)0)
+# 536 "./src/main/blackbox/blackbox_io.c"
+                                        ;
+            blackboxSDCard.state = BLACKBOX_SDCARD_READY_TO_CREATE_LOG;
+            return 
+# 538 "./src/main/blackbox/blackbox_io.c" 3 4
+                  1
+# 538 "./src/main/blackbox/blackbox_io.c"
+                      ;
+        }
+        return 
+# 540 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 540 "./src/main/blackbox/blackbox_io.c"
+                   ;
+
+    default:
+        return 
+# 543 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 543 "./src/main/blackbox/blackbox_io.c"
+                  ;
+    }
+}
+
+
+# 547 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 547 "./src/main/blackbox/blackbox_io.c"
+    isBlackboxDeviceFull(void)
+{
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        return 
+# 551 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 551 "./src/main/blackbox/blackbox_io.c"
+                   ;
+
+
+    case BLACKBOX_DEVICE_FLASH:
+        return flashfsIsEOF();
+
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+        return afatfs_isFull();
+
+
+    default:
+        return 
+# 564 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 564 "./src/main/blackbox/blackbox_io.c"
+                   ;
+    }
+}
+
+
+# 568 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 568 "./src/main/blackbox/blackbox_io.c"
+    isBlackboxDeviceWorking(void)
+{
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        return blackboxPort != 
+# 572 "./src/main/blackbox/blackbox_io.c" 3 4
+                              ((void *)0)
+# 572 "./src/main/blackbox/blackbox_io.c"
+                                  ;
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+        return sdcard_isInserted() && sdcard_isFunctional() && (afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_READY);
+
+
+
+    case BLACKBOX_DEVICE_FLASH:
+        return flashfsIsReady();
+
+
+    default:
+        return 
+# 585 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 585 "./src/main/blackbox/blackbox_io.c"
+                   ;
+    }
+}
+
+unsigned int blackboxGetLogNumber(void)
+{
+
+    return blackboxSDCard.largestLogFileNumber;
+
+    return 0;
+}
+
+
+
+
+
+void blackboxReplenishHeaderBudget(void)
+{
+    int32_t freeSpace;
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        freeSpace = serialTxBytesFree(blackboxPort);
+        break;
+
+    case BLACKBOX_DEVICE_FLASH:
+        freeSpace = flashfsGetWriteBufferFreeSpace();
+        break;
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+        freeSpace = afatfs_getFreeBufferSpace();
+        break;
+
+    default:
+        freeSpace = 0;
+    }
+    blackboxHeaderBudget = __extension__ ({ __typeof__ (__extension__ ({ __typeof__ (freeSpace) _a = (freeSpace); __typeof__ (blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration) _b = (blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration); _a < _b ? _a : _b; })) _a = (__extension__ ({ __typeof__ (freeSpace) _a = (freeSpace); __typeof__ (blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration) _b = (blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration); _a < _b ? _a : _b; })); __typeof__ (256) _b = (256); _a < _b ? _a : _b; });
+}
+
+
+
+
+
+# 628 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 628 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceStreamCanHold(int32_t bytes)
+{
+
+    if (!blackboxPort->txBufferSize) {
+        return 
+# 632 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 632 "./src/main/blackbox/blackbox_io.c"
+                  ;
+    }
+
+    return (int32_t) blackboxPort->txBufferSize - 1 >= bytes;
+}
+
+
+
+
+
+
+
+
+# 644 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 644 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceStreamHasRoom(int32_t bytes)
+{
+    return (int32_t) serialTxBytesFree(blackboxPort) >= bytes;
+}
+
+
+
+
+
+# 652 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 652 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceStreamRestartRequested(void)
+{
+    if (blackboxStreamRestartRequested) {
+        blackboxStreamRestartRequested = 
+# 655 "./src/main/blackbox/blackbox_io.c" 3 4
+                                        0
+# 655 "./src/main/blackbox/blackbox_io.c"
+                                             ;
+        return 
+# 656 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 656 "./src/main/blackbox/blackbox_io.c"
+                  ;
+    }
+    return 
+# 658 "./src/main/blackbox/blackbox_io.c" 3 4
+          0
+# 658 "./src/main/blackbox/blackbox_io.c"
+               ;
+}
+# 679 "./src/main/blackbox/blackbox_io.c"
+blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
+{
+    if (bytes <= blackboxHeaderBudget) {
+        return BLACKBOX_RESERVE_SUCCESS;
+    }
+
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+
+
+
+
+        if (blackboxPort->txBufferSize && bytes > (int32_t) blackboxPort->txBufferSize - 1) {
+            return BLACKBOX_RESERVE_PERMANENT_FAILURE;
+        }
+        return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
+
+
+    case BLACKBOX_DEVICE_FLASH:
+        if (bytes > (int32_t) flashfsGetWriteBufferSize()) {
+            return BLACKBOX_RESERVE_PERMANENT_FAILURE;
+        }
+
+        if (bytes > (int32_t) flashfsGetWriteBufferFreeSpace()) {
+
+
+
+
+
+            flashfsFlushAsync(
+# 709 "./src/main/blackbox/blackbox_io.c" 3 4
+                             0
+# 709 "./src/main/blackbox/blackbox_io.c"
+                                  );
+        }
+        return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
+
+
+
+    case BLACKBOX_DEVICE_SDCARD:
+
+        return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
+
+
+    default:
+        return BLACKBOX_RESERVE_PERMANENT_FAILURE;
+    }
+}
@@ -0,0 +1,1991 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`Z\001E\r"
+	.string	"\304\023N\002"
+	.string	"%"
+	.string	"\257\342\325\332\r\002\002"
+	.string	"\002"
+	.string	"\002\272\207\313\263\004\n\002\001\002\002\002\003\004\003\240\342\234\212\n\004\324\213\264\330\t\n\005\002\005\002\006\002\005\005\002\005\005\334\266\343\236\t \007\006\002\b\b\002\b\001\007\002\007\006\367\267\243\372\b\007\210\210\322\322\003\004\b\237\215\217\205\002\002\002\t\002\t\t\352\263\360\321\b\n\321\334\207\323\007\004\002\n\002\n\013\317\202\320\324\003"
+	.string	"\f\375\206\225\206\r\376\201\211\336\n\006\013\002\013\016\017\360\335\231z"
+	.string	"\020\317\213\262\254\003\006\002\f\002\r\003\002\016\022\311\231\247\372\017"
+	.string	"\023\252\336\251\354\013\004\001\002\002\024\244\206\236\215\f\025\276\330\302\311\007\002\026\311\334\251\213\013\027\371\377\210\210\004\030\311\311\224\247\005\031\331\346\253\202\t\032\321\266\274\351\r\033\256\262\262\264\r\n\004\002\002\034\261\332\301\034\035\335\271\212\274\007\034\002\f\002\017\002\003\002\020\002\021\002\017\f\002\f\002\003\002\003\f\002\f\037!\356\251\306\202\003\004\"\306\321\247\216\t#\316\220\366\340\004\n\002\022$%\232\277\353\252\003\004&\363\364\341\340\017'\202\352\265\276\003\004\002"
+	.string	"(\272\306\270\313\016\002\002\022\002\022"
+	.ascii	"1 \200\002\032;\362e\216\240\334\342\021\231\327{k\3202\204\026"
+	.ascii	"\031p\271\345L2\355^Z\t\n8\025`}F\306\316^\013f\031\n\002/\354"
+	.ascii	"\002a\272b+J\231+n\027\226\021\352\331\267U\250,%\217\372\006"
+	.ascii	"v\031\252\270\240\355\250J\333\306\335\311\202\357\033n\341C"
+	.ascii	"\033\317\353\251\274K\013bC\204b\260\367;X\237q1\335"
+	.text
+	.section	.gnu.lto_.ipa_sra.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\335\005"
+	.string	"\322\306\023\032PU\322\0010sUUUUUI\037\234\200]\017\023\353?t#d\313\224\002N\375M\251\231\031\314\245\264T\324\311\224D \373p4\030\213\262V\212\377O(\342\203\226\206-\314\2220\020\354\003\017\260\242\316\377\350e\332E\357\244N\212s\0023 p\002RY\364\367(y\\\177\330a_\007\362y\020D\n@M3\031\256\301\262\276\271j\262]\200q1\033\2101.+G\006\022h@\262\t\024"
+	.string	"\200\020>\226w\273%Q"
+	.string	"`r\356p_$+\230\371H[]oY\2667u#\357=+"
+	.ascii	"2\212\201 \242{\343s\356Kv\004\361`\006\204\235\255\261t\031"
+	.ascii	"\r\f\001"
+	.text
+	.section	.gnu.lto_.inline.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\266\006U\031"
+	.string	"\366\337sJ\340\260*\0350\220\251\303\034\31068\354\345qL\376Ap=.\206b\306\245\261Ch\204Gx\322\216\221?\020\225\024Le\214<\003\377\210JT.\240\t8\2061\306\030c\270\352\030\372\352\307\253\363H\263\204d\020\022D\266\224)R"
+	.string	"a"
+	.string	"d"
+	.string	"\337Yo\335\261\361\342E\006\034\002F\267\303'\375\344/\364\337\304[\263&N\331\004\240\211U^\277\255\372\003\243\263A\236\377\217\305|\361g\345\363\311\335\335\340\357\240\273_\377\367\277\304\273\273\013\300\207\360\271\377\226\200%VY\376\266x\247\273\303\177\344!\032'\277\232\311\310\231\241\225\027 \344\220(?~53\341\023\257\253\212',>\374\352\216\206\006\213\317\3059Y\206 \361 Y\326sY/\372\366d\375y\024\372j\266\373\257fe\035\327\244\366z\275\0345\037\230MA\003\026A\243\"\350:\243\320_\377\213PX\007\320\013K\212\377E\2515\200^XJ\242\017 \002\033\361w\240\351\207\362"
+	.ascii	"V\214Hu\342S(\223\327\335\245\237*\330\252\270\033\234\236\360"
+	.ascii	"\246?8\211\251\036\002\253h\212\272 \265\244(\f\363%\366\221"
+	.ascii	"\355<\2207\367\333\25275\025b$'d&pT'\275\300\377d\036\007\336"
+	.ascii	"J\231\303`[\0019H\213o\335=\336@L\230!/*\367[\353\356P\177\201"
+	.ascii	"4\031\r<>~`C\211\024/D~\312c\303\021\276\204dDcv.\342\r\364t"
+	.ascii	"\367\310\256\273E^\340\254\004^\247\227\371\001\017\377\233\037"
+	.ascii	".\346\231aA\306\365\243C\241\366\026\027P[R4\306\350*q\317\342"
+	.ascii	"X\204\016\022\300\223\316\342\235\213\r\356\253\264\\\017\024"
+	.ascii	"#\212\327fQ\234r\004 \352F\f\256\227\n\200\242\250\201\261Bf"
+	.ascii	"\b\245\251Qh3`\2421Df\036\022 \005I\tQ#P\310\230\241\022\231"
+	.ascii	"\3344\251s\245\003\004\033x\275(\342n\255\345<<\017\225\234{"
+	.ascii	"\220\361p4\260/c B\263\034k\0254 J\210\222m\225\235`\367\320"
+	.ascii	"S\242\004R]\017\020\311\263U\256\274j\353x\f\236V\330\326g\207"
+	.ascii	"\254\277\220\031Y\370\257\231\347\326\024\260\337\315\212\032"
+	.ascii	"\2373\313\257P.\026E\356\260t\347i\032t\227\257\005\267\317\331"
+	.ascii	"\247\216\355\207@\3529\303\300\216\234>|\247\322V\313\005\267"
+	.ascii	"\376\252Q\005!\356\226\375\026\370\265\360Z\022\302\346\220\335"
+	.ascii	"\037`\340\032\273\3679p\341|\324\007a\261\320\001\245\206\023"
+	.ascii	"\216\257f\233 \n\025\222\314\206\204GO\302\005\364\311E\030\031"
+	.ascii	"\306\325\004'Vp\257\201\002<%\365\"\277\260\232z4\304\026P>`"
+	.ascii	"Q\300\201\313*\337/\214-(\374\311\200\224\005\315\246\232\251"
+	.ascii	"\013\315\345\024n\350\007\346 \300\004\f\030\340`\003\334tQ\271"
+	.ascii	"^\3627Y\376b\364\030!\nE\226\031\021\025\004>Y\002zh\210L\276"
+	.ascii	"\325\f\345\262I\200\204\363j9\374\351A\306\232\276]\366N\222"
+	.ascii	"z\202w\331\227\245q\376\207\256+\312\222dU\262\306_\277A\267"
+	.ascii	"TO+P\360"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\331\004e\020"
+	.string	"\346\224C;0k\224t\300\300\300\300\212h\360C\r\374H\230\\'#\"\002\037[\263\330\345a\211\304L\b\347\b<\343`!w\357\332\343T\321\230\242\006\360\217Bh\241H\233\246I#d\313\024/"
+	.string	"7"
+	.string	"0"
+	.string	"\b\036\276\373\247\254\346\265\232\217\005[G\355\205*\240B\265Z\226\363Z\316\303\236\350\260\353\260\376{'\301l-B0+x\243\305-\216\374$\n\351\360]\f-\351\223\301V\201\n9\254\3460C+\253\335ZZ\240B\223\325\246\251)zXU}\303\313\321k\222^/\f\266\021\030\240\303\036g\251\300\201\t\264\023\277\323\225\237r\005<\371%;\272\025\271Yv\002\371&\005\020\310I\\\217\035C4>@\021\377\241Y/\257\275<\254U\335\254\023\252\031&\301\3269\207{{\034@x0\255Y\260qo\022\030p{\032\364z+se`\374\005\006\244\001{\275{=,\026\261)\341M\310F|g@\021"
+	.string	"\266/\025\235R\221b\371)&\376u\250AQ\305\250\266 \205L\333\001P\002!\246n\312\003\021\340\2443\006*#CcT\230\306"
+	.string	"\372\205\270\005\345\025BSG\026\355Ix\240u\333+g\204\3654\365\260V/\330\t\365\220\332N\341#\312\377\255\211\002\352%\322Z\024j\351\377U\002F\265aak?\020\006\317\307 B\002\342\016\244\261\363\301\rg\244\204\325\207/\022\236C\346\236\377\265)y\212\020\222{\202\226\241H>\323\346>\nP\263\326\347?<\230\275\314\326c\304p\262\226vX\003F\033\334)h+\0236*\013a$q\b\004\017\341\267h\027%\274\222\020:\254\320\336qlAa\"=\370t\036\375^\317F\306\002d\214<\324\264?\3274\201\276\362\232W\355Dm\rV\177Q\247\346\371\337\362G6\245\312\372\022\216Eh"
+	.ascii	"\366\3541<]=\276\235\235\246^\236\021#\001\3720\233\251\212\363"
+	.ascii	"\314\037\317\253\007\244"
+	.text
+	.section	.gnu.lto_.pureconst.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375 e\265\002"
+	.string	"R\206\024 \200k\032\003&q\331~"
+	.string	"\246\214,C&d5\220\0326@b\3336]4\3244\324$\023!\003.\261E\034b\345\341\016)\rg\310\024\236p\204\037\334\340\005'\370\300\005\036p\200_2\313+\247|r\311K\344\220?\356hi\\gl\267\270\273I"
+	.text
+	.section	.gnu.lto_.ipa_modref.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\316\001E\t"
+	.string	"\322\312$,pK3\034\374\277\352\001 \026\210\001"
+	.string	""
+	.ascii	"h\007\376\350?\226\325\377e\353\331\347 \022\375D\240\\\277\035"
+	.ascii	"\361\325\307\306l\273\t\2212\005O\326U1;\313YW\305v\315a\\\215"
+	.ascii	"j&$\330\204\021T9\005\361\340p\321\245\201\241]PH@8\220\0309"
+	.ascii	"\035\357\343=\203\277\320\005\277\233\026U~\026B\202\007\330"
+	.ascii	"\312[+\0200@?\203\316?\345O\344\313\236\204\036\210\306\344\275"
+	.ascii	"\267!\211\024\206\313OIgT\205\025\345U\331\346IQ\336x\264OK_"
+	.ascii	"\216L\250\240\230\214\246\031\326\200\002\231+\242\007\021p\235"
+	.ascii	"4P\321\004N\215\001\030\002:\035\267-}\216O\340\2221,\322\302"
+	.ascii	"\227\207_\267\025\374\326\232l\007]e\005o\344\214)T\275\373\243"
+	.ascii	"\027\026R\342\f\354*-J@\247\225\244\300ld\007\272T\250\037\035"
+	.ascii	"\232\276S#\251]\203-\365\005\301!\214\331\325 6\265\036\230\372"
+	.ascii	"\334Y\205E\371?\242\343\245i\360,\377\300\351\013s\030\257\033"
+	.ascii	"\200\025\001\354\301_\3411\345\315%K\355\020\242n\251\377GS\003"
+	.ascii	"\225\r"
+	.text
+	.section	.gnu.lto_.lto.5c7948ff1e8ebfc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.41.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\365\n"
+	.string	"\026\324LD\020\311*\035"
+	.string	"\016\320)\250\210]\357l\3418aeE\34244AVdN9+ \252)\2061\215\326\303b|e\253A\r\252\311\3236wUGK\345\324\006"
+	.string	"U: %:\344I\311sc\204\354\275S\n8"
+	.string	"8"
+	.string	"9"
+	.string	"\237\005H)@aw;:\363\360\225\316\320\277\354\033qT\275\302\234V\t\332\002\001\016#\253zbd\016\\\366\2512\256\346d\250\330]Oq|\271\267\333\316\260\255a\177\006w\345\270\t\r\"j\273-\027,l\271!\200=\366\333\277\314\034\177\300\t\204\217\245\276-\227\215H\203E\330%'\276\231B\363\315\344!\270o\232?p\337\034\332\020N\002\330\363\242\033\fH(Yst\260\242\200\322\227S\\\245\035\026\332\354\001kV\3606\377\021\356{'\340\354\022\223y\261\322\256\305\240D\241*\233TM\372\262_wwM]\366c\001\250\317\3438\201\033#\223\305\305\210\364\201<\300\216E\037\257\324A\342\205>D \220Pg*\201B:\321\007v\037\217\275\023\351\353P\236\367u\034r_\227\2720j\345\t]U\315\254\324\026\001\003\017"
+	.ascii	"8\263\002K\275\231\320\b4\260\327[c\330\333h[@\270\3238\340B"
+	.ascii	"\227\321_]\026\260E\\\346\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_blackboxWrite.42.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\346\001\355\017"
+	.string	"\226\035gE\360\256*\035\343\217\233\235\236\357\206\333PJ\037\177\0024\330\362\266SzD/6\207\350\200\241\361\227\360l[\205\266\262\300^b\031\274\257\006{\\\026'\334\271@\370\3058\373\002\346\271\254\235<\337>\331D\312\224\002U"
+	.string	"L"
+	.string	"V"
+	.ascii	"\237\003\247\307*XwUb%vi\005l\200\363\350\223=s\032\206}Mf\342"
+	.ascii	"\362bw=\275\360\323\273\310i\236|\216\224\020d\241\336qP\036"
+	.ascii	"7j\334e\3478\264d@\026\312u\245\352\002\274b2d\260J47\036\273"
+	.ascii	"\353\004Y'\367\346\266\035\330\006\331\211 \366\310=|\234\335"
+	.ascii	"\025\310o9-\202\257\341\321$\246<\370\350\233\272\307\324\215"
+	.ascii	"\t\031\232Y*C\233\246Je\261\257a\030\322XW\354\307\376\016\227"
+	.ascii	"\3562\0353\315eZ5\235\032\233\031\013\001.v-\2040\366\026Ol\260"
+	.ascii	"}\217\355L;\335c\247\235YG\243~Z\241\355iK\3414\222S\233\024"
+	.ascii	"\222\007=`\245(w\224\323O+\205I\315A|srCe\214\277b^(TY.\302\177"
+	.ascii	"I\030\330\272\\\374\020\236\341\374\033\335\343\013l\327~\315"
+	.ascii	"-T\354\242\256\342\004W\265\002\266\256%\340q\255\262\306\001"
+	.ascii	"#\223HhB\264\250\343#}P\370@BD!\021\020\357\001)4\342\211J$^"
+	.ascii	"\007\207?\b\243\222'\341\373J\236\207\226:\267\272\222\240\345"
+	.ascii	"\226R\025\267\273\333\251\332\n.\273\207\252\363\303\323\326"
+	.ascii	"!\002\310\250\235\332\013\030\224(\312v\203\303|pv\027\344\217"
+	.ascii	"8\211\220h4\n( \240\002\231\301\271\r\240\325\233\025ZH\201\345"
+	.ascii	"^\261\225\234\036E\020\020\203\310\024%KU\372\323\313f`\212M"
+	.ascii	"\016X\263\315t\311\324\026,%$\322.\232\334\336\257\220\222\207"
+	.ascii	"30\241\334D\305t\023kv\256\307\347\026\266;\240J\214\003\337"
+	.ascii	"\227\212pB\207\274\017\tc\316F\317\211\316\355O"
+	.text
+	.section	.gnu.lto_blackboxWriteString.43.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\321\002]\025"
+	.string	"\306'\213J\300\020)\035\373\034o\260\346\371/\332\0333F\2133\013\270\215\201\235\247\302\\\216\032Dpx\022l\"\003\254v\373\377p\t=\264T?l9\343\177\023\345o\216\202\201-\373\240\200\305m\354\2202)rV\332'\215l\"wJ\001q"
+	.string	"r"
+	.string	"w"
+	.string	"\301Z\313\221S#\030O\247\375\243\217\240\275\274pX\255CL\277ZK\003>0\236\272\034m\373!\336\243\331Pa\311\323]\bF\316GUk\225\211<&\236\206\377\020O\227\003m\322.\322p'\3157*\222\"u\265\213\343\317)\001\027\341}\017A"
+	.ascii	"\315 u?_\334M\214\025Aup\3510\354d\241\324Z=I]\206\233u\3333"
+	.ascii	"\266O\354\r\t\025g\342+}\211\306\367p\352\331\315<y\352\337\210"
+	.ascii	"\247sOzz;\021G\266ye\227\267\271D\366\317\253\n6y\207l\230\307"
+	.ascii	"\313\377u\244\333\325\022\247G:\315\n\247E:M\303\351\360I\367"
+	.ascii	"\356\364\374H)\251h\b\220\252\265"
+	.string	"\347\nG\005R\025\037\216\364'\321|\022\367\271\303O2\324X\363\031K\b\305\b\326Z\023\214H\026^w|Z<7\031\001\353!n\214\324\340t\220'\037\033!l\216\234\356\n\313<i\221\235\2559\\\272%@/\302\205\355\364\345\254l\363\312\257\371Z\373\005f\236\f7\226\253\001\304m\315O\361\005AT\301\332\314\241\200W\025\334%\362\177\376\323\344-\365\214j\020\223\337\344\251\361\017 \236\216\017*\320\257gt\024\266\247@\200\273\r\265\326\276\263\355\251I\326\002\035A\270ie;\346&d\306\032\024t`j^f\304\234\231\315\346\334.$\263\230\225\n\263\026\031\027\226\231\026YM\f\013\215\314\005'GF2\3003\233\027\034\231\316l\206#\353(m\277\207t\227\2229\245\320c]\267\0339\247\205m\313\255}\221Q@\333\336~\342\022Yg\305n\276\326\265<v\b\203\006\363\344\356}G9q\243P"
+	.string	"\223\265\257\035\327v"
+	.ascii	"\301\216\360\026)c\255\325\304g\361(\t\023TT\266u\304\332\022"
+	.ascii	"\236\224\0306 \200\002\241\321\232\007\240\353y\031\370\036\326"
+	.ascii	"!cf\026\r\267\326\2357\333\022\371BK\031\3515\003\261H\262 i"
+	.ascii	"\0350\036\007\007\372@0\350\023_W\264\331\260\343h\243/\272\262"
+	.ascii	"\017B\344\313\223&\332\312\n\f\221\201\213]\301f%3p\276\f\220"
+	.ascii	"=\213\217+\024\236\270\001\330G\200`8`\252\222EC\\\313\244\026"
+	.ascii	"t\270\273\224jPAsB\207\334\016\tc\216F\307\211\3165O"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.44.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\325\t"
+	.string	"\266\321B: \261\322\001xd\242\003\222\t\013\220\b\301\3316\246x\244U6K\343\302\204#\232\333O6F.\030\315,\023\376\003\026P\030=\200\244\030\275\221 \213\255N\002\304F\310\226)\0050"
+	.string	"1"
+	.string	"1"
+	.string	"\273\013N\223\243\336ME\371\207\2753\222\342;\202\317.\340\306z\371HU\247\320Q\216\f\220+U"
+	.string	"\207\335\265\216$\310\355\335v\203\355\004\373\002\001\233{\237\f!4$1YJs\366L\245\263\304~\267\323e_}\017\224R\316 \330v=r5[\363\\Pl\3773\312\216\371\354\265\247\301X\2642\037=\247\310y\355\307\356z>\221\232\2508\333Zd\255y\203\315g\001\013\314Jo\266M_\311\340\354\256\026\374\330e\032\376\311=s\234\364\343=\377\024\036}B\022\304F(\222\030\205&D`\005)D\001\216J&\360s\340\320\"\242\004b\204a\t\374f\251w;]~P\251\245\246\252\265\036\320\2262\242\342\272\216\332\341\205\006\021"
+	.ascii	"`\2517\023z\202b\2508(Z\021\036\314^Y\333W2Q\201T\024\001>\016"
+	.ascii	"\001\272\206\247\207\340/\343\212K\027\263\235\2670\313"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.45.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\310\001\r\017"
+	.string	"V[`D"
+	.string	"\221(\035\023G\250\206\224\355\303@\277\217G~\177\252\352Z\324\274\234\275\216M\374]\023X5\0302\342\277\325S\320\375\325\2337%\356\326\004(\001\200\025\301\265\241\037\324\303j\\\361h\201\224XB\266\224)\005N"
+	.string	"H"
+	.string	"M"
+	.string	"166\246\265@\261=b{N\240`\304\240\267@\234\256\202Qz\315v[\237~8\350\233\0265A~\350\233\276\\.\264\247\274\200\b\306\345\302\202\352\360\030\340:\"!m"
+	.ascii	"v\267Ce\210\231\361\330]g\210\342pgn\033\264\215\300\316\216"
+	.ascii	"\266,\3035\340\231\220\344\r\333\024N\342\303\355\222\026\370"
+	.ascii	"\254\257X\360C\\\363\005\221|x\315\027\331\256\245>\345\311*"
+	.ascii	"\031\221b\255\2102\306n\215RU\366\343\352\211\355t\3474\347t"
+	.ascii	"tZ3\235\336g\303,\306\246e\367\024\032G\036\270\375\240\223\017"
+	.ascii	";\325\230f\304H&\356\311\210\305.\355\0200\037\252\252\206\374"
+	.ascii	"\024\037\020J\230\257\252|\025>\213\212x\241\262\332E\341\303"
+	.ascii	"r\346\362OX\306\375\035\3335\216\301\242\260PY\255\211\375\022"
+	.ascii	"\266e\002V)\017\273\241\247\034\346l\300N\003\f \b\004\316G\004"
+	.ascii	"\220OB\347#\344\343x>\337\206\200\301\t\016<_\005\020\364|^K"
+	.ascii	"\364\270z\342\214\313\t\266\"}\320\2261\225`\032\2475J\260\330"
+	.ascii	"\251U5\252\311v\324\324\221\337\272=\342\306\341T\243\241$6z"
+	.ascii	"]\323\362B\343%) \240\002\231\311\231\003\240\365\254\037\332"
+	.ascii	"\017\t\266\n\303\220d8,\366\031{\026\330wE.,\254\347\t\351k\367"
+	.ascii	"\337\330m;4-\355e<$\347\0043\211\267\231\370-\313=\220\226Il"
+	.ascii	"h1n\277\f\320\035\316\\\243PH\344\360\367eQ#8r\273\352\366\333"
+	.ascii	"b\344\303\314\272\254\223\001"
+	.text
+	.section	.gnu.lto_blackboxStreamCtrlLineStateCb.46.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"\215\013"
+	.string	"\366UO>\020O5\035"
+	.string	"{\373\342\345MA\240h:\022\236\262\325\317"
+	.string	"d\232{\325\366\247\324wwz\020\325\350\241\303"
+	.string	"\303j\351\304U\371]\201I\251A\236\202eP\001\032,\277\240\260\221\275\267L):"
+	.string	">"
+	.string	";"
+	.string	"\003\252Ow6\213\207\245\265H\245\317\207\324\356^\221\364\3562j\347[\024"
+	.string	" \320\273\304\360("
+	.string	"\364H\311\356^\343\032\002?U\213\262\273V\020x\341\236\267\335\3006\003\373\t\002?\375ZmP\251\026\013D\354Z\330\230\261&&\211\r\266\377\260\035\303\233\272\237:\nY\317\027R\340\370\204\350\325>\207w\350\356\301+\036\331\025\241\030\261\033\0360\002\307\247\303\023\250>\035\017\024$\327`\315F\017\372\3647\325\347\343+\221zq\322\335\365\242\rT3^\343\021\223\n\317\305\211\024\036\225\341\277Si\234\321\372\311\360\351\206\035z\032G\366\345\356\256\243\310\226\352\031\031W\341\036d\231\213\003\314\306a\0018N\306e4\31426\321.\0208\232%\002V\301X\256\314\245\"\341\3026\3155)`mB\266]\234\246m\327#\334\313\215\"K\030\250\030\250\n\361\223qt\255\362A<D\023"
+	.ascii	"`\2517\023Z\213b<\030\370\212w +\373@\026V\273\345\202}v\215"
+	.ascii	"2\206y\231\n\277\251Qp\231\234\032\r\334%`\300\242\312mW\321"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.47.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\036\n-9"
+	.string	"\372dL\026CP^N:+C\364c\025}\3053\\\247d\027\035\2168,T\317\016Q\326Y\377\026\361)\324k\002\210\301\317\375@\316\240\003@\234\202\200"
+	.string	"\303\035\203\215(w"
+	.string	"\376\312ASU\246f\326\210%\204\354\235dZ\0011\001P\001\177\273\234\305\260\264\273\017\322\366JvK\016//\027\332\257}\271g\301\272tG\233\345l\361"
+	.string	"\277\f\276\257T\301\327v\320~U\372\222\375\252^\311~\355\346\321}\374\372n\254\356c?\220\200\325\356\245j_O\203\363\252\353\363\276\322\247\234v\367\003\220\004\004"
+	.string	"p\2644R\026\021\r\t%\203\220Gc\261%\262\253\232\261\333\317\372"
+	.string	"\2742H\202\177\002\260\004\360s^\001\240:}\001Tw?'\024\365\310M+\372\350\033>Zb"
+	.ascii	"\363\307\311\215V78h\200^\300\204\\\311\326\346\\\303E\252\001"
+	.ascii	"%H\f\337\346l\242*\251\351\363z\364K~\3165L\264\206}\351\213"
+	.ascii	"~h\351,L\355B*\004\256>e\310C\2577os\"\301IUY\004L\234\3739\325"
+	.ascii	"\324\005q\246\220\275\315\371\304Ah\220D(.\271.>\303\263\260"
+	.ascii	"\262\037\215\250J\306\3739\311\356\276\324\346,\303E\"\224\335"
+	.ascii	"U=/R8\303\263\260#oU\2456\347\230\252\344\347,\202\211D\316\252"
+	.ascii	"\t\236|B\222`]\352\322\rZ\035/\274^+zU]0v\267&\t\306\245*\001"
+	.ascii	"\253\240\335\356\370\007\330\026\316\314'?s2a\207\336\3675\202"
+	.ascii	"m\251\230\b\365\276o\343&X\330\233\300\273q\262\273mt\267B\002"
+	.ascii	"i\236\224\273G\224\300of#\233\037\247\341 W\316j4R\304\260\254"
+	.ascii	"\031\212\367\206\372\361\237\334\227T\315\320\306\301&\345\246"
+	.ascii	"\247\225\271\300-|\330K\374\367'\330n\024)\360\233I\371v?\224"
+	.ascii	"/\261\276\255\234\3257s\245,\f\3509C\317\364\321\344h\037\270"
+	.ascii	"+\357[\246\277\207\303\240\031\323\327k\301\366/\300~mE\274`"
+	.ascii	"\244pW^\263\327)\257\273\005\231\334\236e\357\233\365\247 n\276"
+	.ascii	"NG3.\034\250\273W<\f\213\366}\267&\364\277\034LT\237\355kKM\341"
+	.ascii	"7\277\366\247\330\257\317\217\036\307\035\351\363\214\223\323"
+	.ascii	"\302\323n)\023gh\367\363t:\235vV\322\335\270\023\034q3\265\270"
+	.ascii	"\021|\313{\351\\\336I\215\373\350\322\367\262q\033!q+\221\270"
+	.ascii	"\213\0327Q\343\0262\342N\262\270\203X\334\310#\356c\213\333\330"
+	.ascii	"\342.\266\270[#nb\0217\333\342^Y\334*\021wfq\377\001S\337\263"
+	.ascii	",-.\003J\337\257\351\237\267o\325\203r\351\277\345\347\362\334"
+	.ascii	"\375~\334\357x\274KSA\325\236p\357\373\036\256\257\345s\267\353"
+	.ascii	"\323\275\016\353\\p\004\371\004\027cK\337{\354\357^4;cF'\257"
+	.ascii	"\270\340L\310\334\327\203\3377\t\2312\222\001\335\036\023\320"
+	.ascii	"\016\231\364\262\347wlb\215\271\300\220;sl\266\360a\201!ku\306"
+	.ascii	"\fm\005?\346\337\035\217\ryC\226"
+	.string	"\347/\320\230\217\231\325\343\025H\253\260\230\215y@]\027\026\346]$l\233\213\371]m\314\037\336\217\213$\211\213\206\226%\270\355\275\215%\365\310\364\0253Tz\016l_\317\367p\200\272ii\354\327 \272\274>\205\255\332\353\304!ff8\330fhcUa\373;\330\027\002z\256\370;\330e\376\221\337\304\"`\256\021\232N\247\205ob\2272\202\334\270\353\311\304\323&\346\276\235\013\316p\231\270k\356\032\3735\3575\t\235\3602\343\273P\3305?\275\357Ja\237\346l\356v\247\270T\360\233\304\254\276d9\313\312\345\270oIj\023\344\260\2318\307\347\215\230\241\026\232\234\361\301f%\235\354\361\336\215\262k\376\231\013w8n\224B\377\357o\3348\325\315\222\201\315\300~]3\021M\360MO\315K9\257\361\n\324\033\356\206\303\204>\237\206\016\355\373\276g\373\252\346b\036;or9\367\331\274\215\207>[\177"
+	.string	"\001\"L\223P\013O;"
+	.string	"~\035\243\301\215\030WQ5\236\250\252j\324\250\222B\202!\343\005U\325\006\243\216)\027T\036\246\256\242H\270\300\021\325\"\350\006U\225\214+\033!\256\254\252l\034[\252A\225\f\026:\252Z\314\220\212\242\321\342\211JFT\215')\253\033O\r\016t\225\215)\253\247\253\252*\253\247\243\326\3257+\351G\337!0\317.o\371\273l\021\0238\257\274\241\004\037"
+	.ascii	"\361\354\362T\034\344G}\224qfvC\251\003\306\322\314\220\350|"
+	.ascii	"u!\301\0212x(\300(\033\021f\031ec\026\334T\206//@\206\2662#\347"
+	.ascii	"(3\033m2D\3744\001\334e\262E\331j"
+	.string	".\360\202\227\353\003\277Y\224\223d\336\310|i$\312Q\206\276\351\234k\272\226`*\226\270=\341\234\240x\257\221\2314R\246J\034\344D\031?\371A\224\177\304\214\231\263\216\241K\026\302\"\227\025\312Vs\025p\267\373\345\202\3417\205\262\220\230X\037S\314\037\275\211\"\257\341 \021\326z2'\310\367*c\007\003If\017\320\301g\334\230\026\236F\207&\340\247\277\213;\304%\322\276\257\326\233\304\"\256\021\374f\033\351\345\351\353\312Y}>\357A\307w\245\020\271\245NT(C\233\005\033\224\177\350\036\301\\x+(G\b\274p\207\254Jr\006K\\\323\202\347o\316\026>\f\312\320>\021\347x\f\200\276\250q(\005\035CfhF\202H\222$i\f\220\002\221\241\262n\020P\207\204&I2\034\313=\246\315Q\340\213\020\244t\303\322\254H@r4\007\324\262\242\254\3736\337\366\207\210\241w\312\323#\302\362\227"
+	.string	"Y\245_n\370\n\345\213\320Y\357C`\347\001>\021\261\352\023\022\227I\230\342\2059\350\2417\212\037X\f\247\341a=\300\274E$\374\331\240\265\323\035\215\314\227l\207\214\344\320\364\3276\024\272O@?\267\024OO^,\026B^\206\304\\\2568\2755\316%F\002{\340?\211\241A5\274i\237g\017XtK\346\336%\373X\356\316\204\235\372x\031B\236|\207\221\323yW\320\373A\256Svh\013D\331\203*\330\255HM\300\243x)f\346\310\025\3014\267\261\251\270"
+	.string	"\267y\2008\321P\362\322\247\331>\025\305\245\204\007b7\322\200\212\214;5\255\002d\026\273\366\272\356o\345F\212\224E\203\373(!\246\231\331\212\265\307\262\272\363\222\273*l\023\fG\367\030\027\021\262\201\034R\222<\fA*o\037\221L[\302\344"
+	.string	"\256\311D!x\321OX\345\370U\253Y\210T\220\326\2479\024\375\331d\025\272\343\336\025\252\006L|\307p"
+	.ascii	"\025\213\017\341\362r\b\261\372A-\261\203[cP\n \313\301np\003"
+	.ascii	"\254 =\n\230;y\323\363%\237\350\243P\250\342H\221R\343\315\227"
+	.ascii	"\230\013z\277H\361aS\037\"{7\002\320\235\227\237\201\353\375"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_blackboxEraseAll.48.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\335\t"
+	.string	"\326\221C: \223\322\001\237\t\312\265\b\334\300x\227\267\017\355[@\251w\244p\340\200c\024\327\254\374f]\253/Y\364\343\341\272C\243@\312\001\301K\207\214\033\r\264\205y\355\337{\357\224\0022"
+	.string	"1"
+	.string	"3"
+	.string	"\255\323)[\276\254q\tE\327\351QNMhlB\221\343\223\216p1\234N\004\251A\306\315#@\204I\031B\330]\313P\224\335\365\266\023l\027\330\346\t2,'\265\227\314\3316\360t'\210}\272sf_\372\225Dr\243\220\333\325\310\365\354XcFl\277s\313\336\271\215\266\177\371\211\265\334v\327\233!\017.\021m7v\227\200$\033]\322\30790\265\217y\001\320'iE\007&q\266WW\251\020\355\302\016\374\224\327,|\221Wc\260\344\303W\237\005z\375\f\005F\225\276\024\303\305wr@\231\036N^D\312\004\341\241T+\2574\340O\242A\345Q|\237\312\353l\257\323\2353/\224\214\257\tR"
+	.string	"i\177\023\362\241G3\035#8\003\020"
+	.ascii	"`\2517\023\032\201bP\030J\361\366\356\332\226\221\211\n\244\240"
+	.ascii	"\b\b\336\b\303El\002&\370\313\270\342\322\301l\034\215\240\240"
+	.text
+	.section	.gnu.lto_isBlackboxErased.49.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\355\n"
+	.string	"\006\224KA0m5\034\250o\255\332k\272\316`\236\205\321\234\235\267?v\362\266+8T\252\270O\234'\034\371\366c\334H\375\323\227_\230\376a\241\001|\302\320\250p\213\021\205\304\023\204D \240\221\275\267\224)\0059"
+	.string	"5"
+	.string	":"
+	.string	"\025$\2308\314vGO)\034\374\246\t\372\242og\275\243\024\302%\363 >\270n\0274\323\210\212\030n\"\245Y\004\f\221\2249\301\354\256\363$:\270\271\333.\261\rb\337\022\335\271\353Y\367\020\361J\321\032e\315\036\303T\225\375m5e;\3359\235\231\376\344\031vv\002"
+	.string	"\212]TM\305\306\270\017\030l\207\354\212CFB\006?\256P\017?u\252\001\001D,T\221\t\312j\033\354\356\207\005\026\023\345\n\313`\255\t\252\252\177\243\273Z\\$HI\263}\340\033>\224]\022\211\257\341\255\004\276\205sV"
+	.string	"\312\237\316\371\240\336\\>N\200\005\237f\300&C@\343\025\340d:\336\306\363\361.\034\376\f\b\360x\b\276\317\343U\306\321\267\325\224'%.tx\345\017vg=C;Me\240\306\2144\334,\322\356|\031\020"
+	.ascii	"`\325\233\"t\224\215\006\263P\016\263\227W\035\370\262H\206u"
+	.ascii	"\212\026\205\204\021\3215\274\n\213\307\206 \343\256\233\252"
+	.ascii	"F\236KA\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.50.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`%\001}\f"
+	.string	"\346\025QD\020\215*\035W\0352\222\024\212\214\366v&R\035.f\346\361\266d;\2426J\307\327\321J\032\270\343A\032\351\330<\334`\323\3239\003\224i\362\030\001\200:\2012\226Fa\323\t(\230\372\033\212d\223\275S\n>"
+	.string	":"
+	.string	">"
+	.string	"\">>\330wX%h\325v\267\243\016\016z\335\350\004\371S\346\n\305\357\365\026\276U\210\311B\261\3017\313)(\342,\247\027\004\013\021\001\235\024\037\273\353\031\212\fn\356\266Els\330\027\003\035\276\352\253\002~\204W\037\370\314\207\257\376\207{=\365\220@\032\251V\241Y\332#8\251\311>-\313\222\204i\311\376\364\271\263\266F\033)w\027\224%\226\254\036&\330~\305 ;\017M\351\347\267\236\361M\023?\275N\037(5}\203\357\242!8\244P\273\031|\r?\006\367\352\031\256\202\031\005\373\027\274\373}D\001\331\330,\205Z\322nTH\242y\302\266\347,\002\224]Q\326\\\274\r\211\001/\303\321`L2\035\200\r\346\244\323t<\335E\303^\200\222N7\300\363:]e\f}[Z\n\241\221!\n\372\343'\f\004\271\355\356V\316\005\354E\202\030~\325\326Fl\025\323\366\004\314\036"
+	.ascii	"`\2517\023\272\224\002\303\361U\200\024\250\013\325i\246,\003"
+	.ascii	"w#=v\264\306\353F( \206\313R\341\224\2472q\212\024\260\rR\243"
+	.ascii	"g\202v\274\365\371\224\205r\031\345e\210q\351`6NSRQw@\276]V\236"
+	.text
+	.section	.gnu.lto_blackboxLogDirCreated.51.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"M\013"
+	.string	"\366\024N?\020Q\225\016\200j\365\204\257\326:\222\002V*\007\2271\262\240\214Z\0063\353\2030\311\017\033\302\315bb\036\177\361\254[L4\202\253\bE"
+	.string	"J\205\202\242\001\2518\361\rV}Q#{o\231R;"
+	.string	";"
+	.string	"<"
+	.string	"\256\035\273\233\301\020\347.#T\316?\353\223\316\023]\002\360L\217\022\323aL0\003\206\211"
+	.string	"^)V<\200`q\326U\203GR\2158\330]k\347u\270\261\333~`\273\201\375\003\001\206'\373\253_1\004$b\\p\354r\b\001\331\227t\241\242\330\276\332G\361\024\334W\241\013\330=\335h\261\373)\360\002\311\245\277\023\300.%\037\200]\232\263?\376\2456\"\002$C*,\370#.\335\371\350\273K\377\203]Fh\2548\241c\244!\377\370\220#\025\243*\264A\030\364\235#\024\251'c\303\013\350\020\246\320\200\252G\313FIy\330\237H!\312~\334\335\r\240mz4\315\266\2110\261f\231\233\313\205\231\221\240a&d2\n\033\f'\323\266Nf\251xV\320l\231g\316-\243|\373\270\360d\b%^#H\222\02051\233s\327,Pcw\031\370\255\007\022"
+	.string	"`\2517\023\032\204b\350\030\312\340w\274\f\255"
+	.ascii	"\201\205\272\n\032\016]A\bk\025\340\273X\320\254\246\214\273"
+	.ascii	"\034\263\311\246\304\2431\250="
+	.text
+	.section	.gnu.lto_blackboxLogFileCreated.52.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`Z\001}\r"
+	.string	"\266\227XE\360\222(\0350\355\346\337hL~\005\335\367\204\220\005\022$L-\252S\252\374N+\361'9\330\227\252\206i\204\320q\267\260\3052\b\364\271/\211\215\303\260p\361,\0038\236|\214\006_\357\354\333\376\336{\313\224\002B"
+	.string	">"
+	.string	"G"
+	.string	"\233\255\343\236\207\335\200H\261\220\242fw1\330\341\333e\204\272\371_y\207\353H.Q\036=\035\312a\004\261\\>"
+	.string	"\235I4\360\251\244|\345z\241[\251n\026\354\256\225\3532\334\363\266\031\330N`\277%\266G\242\220\203\375\270\273k\330\262\357\372\243\252U\325\367\020\230a#\253\261\213\341\365cedL\210\217\355\253\375\0227\261\335\245z\200\335V\216\027\273\336\001#\340\\\332\273\200y\3119h^:G\315C\205\362\306\311\206\225\276lkoAqT\034N\0272\\\021\332\"G\241\n\315\354\256\002\377\304Y&\370\037.MaD\317]\372#\363\262s\362\322CC\211\276\364Sa\301@\253f\204\003F\360`\301a\242>\002\246\220\354AtI\244e\016*h$\220\322(\204\204A\310F'\254\224\022\301D\005\254E0\2450\t\232\226\302>\336\036\266\334\200\206L\t\\\311\030\003\023\203\004\315Y.\237\210(\177\2326\310_N-6\037\214\032\032\205,P\241\231\025\334\216\007\037"
+	.string	"`\25173\340\235! \024*\205\356\201\306\200\023\020_\257\320"
+	.ascii	"*Ns\021l\267)\321K1\316j\021x/V\215oe\033\020\327))\237\212\025"
+	.ascii	" ph\bJ\b\253`\312%\330f5e\334\345\236M>\245\256F\253\366"
+	.text
+	.section	.gnu.lto_blackboxCreateLogFile.53.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\234\002\375\025"
+	.string	"\206\252\224K\260\022R:rARs\310%>\3609\303\371m\026\271\365\253\235\326~+9\247\037\236-\343\204\026\026\004,I\353[%\356=OG\325\3235\277\023~\313\264`\3153\342)\307\3510\213wDS\340\245\325\261\376 \237l\"w\222\001~"
+	.string	"w"
+	.string	"\177"
+	.string	"\273\262\227S.1\031eu\007\027\224\257'\343\376\350/x\007\322\224=\264\302t\224\325\235c\340u\017\224\257Ku\023\362u\344%\344\353\362v\261\036\374i\227\220\213\233\341Vw\313X\305\326\217\301\357Hy\257#S\336^x\224+\255\363\327{\035_PLM"
+	.ascii	"~ F\004@-\210N<\305\371\371\350H\244s>\361\005\254\264\316\237"
+	.ascii	"\316\251\253Aw/=\177$\276\344w7\267\273\024v\351R/~\017s\307"
+	.ascii	"\2671\237\261+\273;\301>\306e\340\366A\257\233AG\177\276\356"
+	.ascii	"u\344\353Y\304\264Q\004\254\241\305\335`\217r\017T\320\325\326"
+	.ascii	"2\317.\t\354\365\341\327\365\244/Y\351\326\221\3568\322e\246"
+	.ascii	"K\231\356\003\f8\201\343\326\324=\242\b\244\247\252\023\213\017"
+	.ascii	"\177\340\237t\336\375\356\225\366\304\341B\235\330\300\332F\b"
+	.ascii	"8\324\335\017\312\327\037\351\302\025\331\007\017\203\367\244"
+	.ascii	"\225{\326U\305$\354!\n\213\272pN|\210\220\224\b\206\361\205/"
+	.ascii	"}D\255\240/&\031\207~\241H\027\037(\254\262\241?>vw\217\261\273"
+	.ascii	"\230\204?Xi\231;>\246\223\f\343\tWK\246Q\345\335\2359\322\006"
+	.ascii	"\001T\335\255\200\3528w\214\\\371*\347@2\217|\312\314ux\023\344"
+	.ascii	"\365\035I2\345\023_u"
+	.string	"\254\212\246\223\217\026\231\201\236J\204\340\245)\315\225\224\003\317>7\212r\376\035y\016\253\233\361\262\2548\210\251@\210\3002b{\256f\241\226\013\251\305\314dj0\266\013\345\322b8\233K\007\334\313\2156\203y\221\311\330f12ZN'\213\241,n\246\226\223i\300\341r2\221`\237y\266\005\305T\r\373\226f\354N\301 +\211\026\267\204^\251\245\002\245\352\256\371y\245K\271\020\370\3516\177\316JSB\312\353\225\216D3\3719wk\030\350\317\2455LL\231\334\333\377F\356\332N\343fB\365t\341S|rl\361\b, `\002)\205E\017\034\310J\b \212L\207V\351d\275\217\317{\022%O\t\031\204(\021\231S\341(\fgl\\T\007\034\374\321B6\323\232\365\355\363\rI11F\334\006,.\024\341\370!\037\2403\343Z\2348\016\t6\264 z\237r\f\275\"L\"\270\343\361\344\331"
+	.ascii	"_eq\227a\021\357\205\332\361\236D:\027}\002"
+	.text
+	.section	.gnu.lto_blackboxSDCardBeginLog.54.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`_\nm9"
+	.string	"jd\030\026CP^N:sf|XG\027\035s\316\005\376\371lG\310~P\251\277!\377\f*\214\311,o\307\036\342\007\235\273\367\344\277)D"
+	.string	"2\240u9pv\002\226R\252\017\030\301ahof\215X\"m\357$\003L\0016\001L\001\r\222\264\212\262\326\031\324.\347\251\023\033\346b\254NW\365,$\337\007\237\2561\301\234\247M\354\325\244\341\341\372s^.g\365/9\222\232E9S\341J\3139\312\304^\225\260\366\216\356\343\325w[\365\333\376\326\307\276\333\273X}\312\343\331\031-\006!\263'\230\263\035\204\253\215a\372"
+	.string	"\353U\366H\353\325\376\332\255\316\326\201\277\024@\301\234\263\203\253=\201\275\332\024,Xu\373\251\264\213\310\245\367\224#\314y\272\204\2354Q\017q{\244#\243\"\242\344\020\362h,\262\304U\0050\304\267\3557\217Da\220\337\021\306\333\3132\032~\211\2358\rn\276\332\256\026}r\213\222^O\261K\344\024\222\344I\"\207\267/\bK\023\347'\306k\310\207\016\230\t!;r\370@\320\214\237"
+	.string	"]S\240W\213\036\271\307\276(\3310)\347|\265\250\221kT\353\213\216\335\342\360\242\001\352y_\024\3110C\032\"]\177\373\001\265h\221\313\242\235\030\366uXa\213\360H\322\3539D\006z\312\371\333\357\017/\347Uo\222\003\200\"\215r\263(\332\326j\274\203rg\364z\256\303\t_\307F\257\257_\"\207\234s_\250\227\220w\200w\037\332\335?\272\213\032\002[g\256u\230\004\376"
+	.string	"\213M\374\020\016b\335B\243 9o+>k|\025\353\305\3138@\255\033\250\005\334n\026-\356\241\027'\363\330\360e\341f\037\357\177\273\252\227F(\330\323,\025\237\265ysh^B\375_\bc\003\005"
+	.string	">\223\323\237\323\201D?1\025N\277o\310\246\310\203\354\330\266\344\2627\375=\3345%-\227\345\365\335t\340Z\270\346\256\351\263\351@6\347\346\311\372\314\365j_h\346\262\223\246\246\233\254\003/4\347c\331\363\026\352n\027O\303ds\316\027\372g\216\346E?\312\325\206\321t\017mZ\257\036s\321\"%ks\303\272\205\375_\271 b\316!>\353^\363\245\307\030\306g\375\373\337\001\323e\2471\223n\242\333\021\222\267\025\234\356\235\340d\336\b\3726\022\362\366Q\3376B\336.\032\272M\204\274\235D\336\036:\336F\026o\037\215\267\215\305\333E\3666{o\023\373\266zoc\342\355\273\336\276\204\013\232\022\352\261\361'\347\256\302A\231O=C\345t?\231\377\313?\375\260\373\375\270\333u\037{\307\353\372\336\375\345\234\217`\372c^\246\217d\0029\2069\233m\020\204\273\205\255"
+	.ascii	"sU-\370\003\362\271\237\rP,\001F\200\025`\022"
+	.string	"x\234~\262naw\267a\027Z\205\007I\257\217\004\030\323y\342\026\001#\300/\363+\275{\026\252p\215\375\326\310\372:\025\215\355\217\214\355v-\2226\311=4\002\276\335\377\025\266\326\205E\320\211\233J\326\356\276X\237k\225(Is\316\030\324\367\335zu\3509f\313\240\322U\221\370`>\327\236\025\220:i\237\340#\255D\214\304\237\373%\024\324tr\3164\344\021?\313\001\375p\037t\203\301U\343\021'9q\223\210\215\370\006\241\237\363J\326\345\f\016A;\342\263\206\360\"\276Z\034\340\203\213\337JY\017w\302\226\n\333Va\2355\030\\e\255\264X\356\241E\374\242\314\211\233\335\357\243l\265|\260]\323s\243\345\302F\271\312\342C\211`\335B\">j\221\003$\026\346\257\211\032c\273\252\370\036\270\030w\267]:\334CU\374\"eZ\270\371\274\261/~\212\370\254\317c\305\370fqu>=\306^"
+	.ascii	"\211a<J\322\b\331\273gI\313\262\205X\340\036\016\004"
+	.string	"S\362/g\254C\017\367@\021\004\2449;\017%\301:\241\030\230@q\017\355d\336\036_MC\311)JJ\006\025s\tJF\225\324\323T\324\322\222Y\265$\240K\204\3600l&\024%\206\315\234\241\224Rc4]\247\246;c*jI\265b\t\345d\243\352\004\324\323\024T\025\016\250\0253\224R\003v,\251\246@\354X*\251\236\240\226Q2\222PK\245\t\245\214\265\237\224\224QM:\224N5\236bH9-ME\305\260\261\364\264d.)!h\345\r\250\345\022\225R\271\\:N\261\216\231\364\232'o\256\216\370=Ly\352\346\352\206\177\273\"\341\037\335\215\204\233\003\026\316j\036S#A\2708\357C\032q\273\257\360\\\345A\356\205\361e\361\375\356\201\361\035\335N\0367p\2520\323F\264\r\222\261\201\255RZ0\002\177Q\\\264\335!c\033d\272\375+>\353Q\237\253?[R'G\030\343\351Y"
+	.ascii	"B\210\320h\317\215\3602\256\316\207[\204\273\257\004]\021\272"
+	.ascii	"\207\032a&-\030\273\244\bc<7knz\277o\364\370\232\227P\321\257"
+	.ascii	"\nW\"L\004e\303=\334\337\332\254\233\244\335\002 \315\031\353"
+	.ascii	"y\311Z\037/#E\362\243\345\272\207\022\341$\347X\221\344\323\313"
+	.ascii	"\232\033\326-\374\220\b/\211\317\350\352\260\205\311\330\254"
+	.ascii	"\377\346\335..\030\323\300\375\362K\263e\020\303\035\362b\322"
+	.ascii	"\302\315!\327\253\005c\243Cukn\t\326\240fC\001\200\307\250\201"
+	.ascii	" \344\024c\b\321\210\210\210&MZ\003p\002\221)+v\021p=C7#\211"
+	.ascii	"*\355\033`\376\240x\361\374\356\230\035\032]va\227\036\230X\234"
+	.ascii	"\365\bZ\252\377\200Y\312\317\357`\245U|\n\264\373\244\342pZ\032"
+	.ascii	")\003\300\246!\026\026\004\351\032x\272g\340\214\224TH\223\207"
+	.ascii	"@i\232\033\026,\227\341\251\r'\335\262\020\313'\004\032!O\004"
+	.ascii	"C\220\231\240\021\347\216\234\360\\\317\b\026\253\205\340P!S"
+	.ascii	"^\277\337\222\032\013d5\377U\274\020\232|\036\257\354\250zI\217"
+	.ascii	"\224\004\2304\2159/\025\021J\202\005\337\020\362\337\270^`\321"
+	.ascii	" \002 \312\315\037^\260\363\205\363yx\335P\341\334zzL\310\006"
+	.ascii	"d\\\227&\025\360\001c\214\322)\277\353\r>\200\200\257\r7\037"
+	.ascii	"qW'X:r\232AN\244C\t\277d5\350E\026\t\212\364q\353\310(\365( "
+	.ascii	"\357\320\003\003\321|oE\263z%\331(A2&PcC\241Zl1\305l|'\034\203"
+	.ascii	"\001\231\306<\204wfyU\304\210m\025:%\366\207\340Z\350\3150\275"
+	.ascii	"\tB\250A\245\243\204fJ:\236\314k\354\245W\364\332\200\315\377"
+	.ascii	"\026\237\206<\007Ao|\352\201\365-H\001-\017\027wyY\360Q\f\007"
+	.ascii	"\0268A\226\025\365\316\235\004\301e\310i8ad\264R\255;3D\265f"
+	.ascii	"\0368\342\256e\017gM\336{\273\"-{\265J1`\262\211uW\333\376\035"
+	.ascii	"\340=/\031\343\230q\007\272\261\330m.\344\323n \0201$\26200\254"
+	.ascii	"\273H\240\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.55.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\345\n"
+	.string	"\326\023KA0\213j80p\210\362\235\257\364V+4$\315\234\257\333\017\364\346\356\251\255Qqzr\301\276\377\265\375nk{\204\351C\026\273\021,\f\261@A\f\b\375j\310\246\340(\322"
+	.string	"\350\277\355\275\245L)9"
+	.string	"5"
+	.string	";"
+	.string	",\016\247\t\262\335\321S\007\007\277i\202>\351\333[\3278\321BX\0051\301u\233\230\2354\\\304p\373( S@!\2322+\232\335u\242D\0047w\333\"\266;\354c\002\335\271\353[\337\310\020\023\341*e\315\036\303\324\006\366\267U\225\355t\347tf\372\225N\\\331\007\002\261\335Tm\304\2768\f,\333#\373b\017\220\221\301\217\253\324\003\237/\217\352\324bA\210W\250\244\016\226\325\036\330]\016\f\020/R\322\f\273\340b\240\277\350\256\030\t\033L9\263\235\362\b!\313\256)\304\207pW"
+	.string	"\377\3019\013\020\345Q\347|Q\356d>\317\310\200\217S\322\331\230p\274\023\317\346\343u@!/\223\341\017\205\004\344\001\370>\220w\031K\337VU\256x\240Q\260\220?\330\275\365\n\3554\325\200ZS\322p\223H;\021"
+	.ascii	"`\325\233\"t\224\215vE(\207\331\313\253\016|Y$\203\025\032\246"
+	.ascii	"\330\025paE\027\362*\314\036\033\214\214kn*\035yZ\005\005"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.56.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`s\002M\023"
+	.string	"6#~I\340\360&\035\370\031\321N\350\003\236\022\336'\256,\234\261\317X^D\030\367\213\323\"\2416\201q\201\224+\361\216\335\342\365\013\300J\224s\3067\255y\323;\254A\006\266!\356\265[\007<\221W.\375\345\265%d\223-wJ\001k"
+	.string	"_"
+	.string	"k"
+	.string	"/j\315)\360\002\360\236m3h \343\330s@5\0017\036\033\235T\255\271\325\206x\354*\360\243\336\\\031\363\305\231\253\300\217\0307K\243\016\020:;\377l$\275\214\347\236\210Xc#\247\2108\233$\265\326\343.o\304\fr\347"
+	.string	"\030=6@D\232\231\300\326\304\341O9;R~'\265VK\232\250s\177\334\266\007\333\016l\231\023S\266[N\024\202\265\316L\374\023\317Y\360\203\356\371%F\236v\317\217\241\367\276\307\375@\222\021\017\033\316\204L\356\354\034\215\334\037\373\273\333\355v^\037\373\343\037b\351\317\322tJ{\226\236SzW\372"
+	.ascii	"Z:\265\r\34250\325Z\333\361\250N\236\222\220m\031\033\304\266"
+	.ascii	"\224\037c\005\236Cj\f\337\334?]\305wm\t\223\305\212\335\357\246"
+	.ascii	"\033\242\373sCA\365(y\373ct\272\207\n"
+	.string	" \375\t\324[;\205%O\243KR\2633\266[O\341\002k\255&>\212\037\255\274XX\350=o?\034:\022f\252\251\r\315\030\r\331%\322\t\025\325\230\311\251\033 P\315\251\265\"PQr\232\221=>\202fs\332\217\320/\201\"\0323\031+!\004\227\027\013\306\005S\271U\022\276R.\204*,-\026\005\225\225\313\213\325\262j\301^V%\006\034Vp\301V0a\b[9'\373\254\353c\f\267\361\b\311\273\321\217\273*\350V\342\b\t\374c\364\333\033\333\337\372D\2664\263\326ZU\213\203\323$\002\234G\241v\204\273@Y\372\240\223a\033\243\356\242I\256\221\031-TD:'\333\030\365\240\303\016\234. \220\002\221\261\273\r\363\225\373\222\242|_\361\272\005\033Yznx\370\306\355\302\250\036K\026\365^\217\245\361\362i!q}f1\240\020\276\357r\251\013\2074\234\364Q\2766\336\006f\220\361\321"
+	.ascii	"_u\033H\266}\260\002\034Xk\250\272k\330\220\025\203\307\303}"
+	.ascii	"\223\311\3356\026'\305\262\367v\b\317\262\017\227h\336\304uc"
+	.ascii	"\245\363\265o\017"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.57.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`a\001\345\r"
+	.string	"&\031[D"
+	.string	"\261&\035K\023\241\300\275\242k\205SD\201E%0\233w\347i7\177\305\003\272\317\363\324\223#\354\211\247\035\033Rh\334\021\214&"
+	.string	"\206\b\231\001\376\377\251\177.f\3248\004W\223z\207\"~o\"eJ\001I"
+	.string	"C"
+	.string	"G"
+	.string	"6\211\315\261\202\005$\336\356\211\020\t0\2550\211\241\261\353a\032\342\333\241\245\271\371\237C=9q\035\312\255\267\334b\341a\306\311FE\207r\r\201\342\200\022\315\b\216.\203&"
+	.ascii	"\217\335ur]\207;\336v\003\333\t\354\243\002\327n\210\201\357"
+	.ascii	"\362\027\013\376\312\241/\214\344\271C\177$\036^\337r\00332,"
+	.ascii	"#\227\227\222\374l\017\224\252b_\277\357\253aM\261\235\276\234"
+	.ascii	"\216Ng\246\037 \213!:\351\316\301fW\364\335\254\n\266 \341!Z"
+	.ascii	"\236\2734\275\032\023*\220~|\024\317XT\237\264\361\022M\311\205"
+	.ascii	"\252\212/\343\243R\306\311O\341\325\365\023\210\207?iM/J,\311"
+	.ascii	"\376\t\333\253\243VF\037v?\037\331^%\267\b8\244P\336\260M\341"
+	.ascii	"0\"\001\316:\264\216\003\f\032\b\204\354#\002\b&\241\363\021"
+	.ascii	"\202e\036\021\254\243\200\265\t\017<X\005M\363`\034\257\344\326"
+	.ascii	"j\212#\b\rV\324\223L0LRz]7\246\024*\225\376\026S7h*\310\367n"
+	.ascii	"\017\013v\342L\314\017\324\300X\034i\007  \200\202\031Qd\007"
+	.ascii	"\240\365Z\037\372yb\341\331PP\t\350\211\316[`\227\034G`\261\341"
+	.ascii	"!E\260\342\230\270\363\312*\004\213\212\007\032\251(\254=\023"
+	.ascii	",\203\340\f\006\356\227\001\232?p@A@\356Kb\r\3508XSv\267s\337"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.58.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\375\001M\020"
+	.string	"F\336iF"
+	.string	"\221(\035(\267\305\200\340\360\357\335\\\031\30684\r\0173\024\257\230\351\224'\r\373\276Z<\375y\031\266\026l\266u\017wU9\332\302\365\217\201\273\364\337\035\353\237\213\231\207\245\211\200P\023\337F\"\331[\312\224\002Y"
+	.string	"O"
+	.string	"T"
+	.string	"*\017\253\253hs\252B\234Y\2234J\330F\261=V\260"
+	.ascii	"\305\244\203$T\003`7(\231\2339\301nG\234\364M\306U\222_\372&"
+	.ascii	"cE\026#9\225\307\273<\362`\345|8fV*\337/\345\264\t\230svV\032"
+	.ascii	"\242~\204\3149\255\251\325\207\373\343\266"
+	.string	"G\266\023\330\332 4\265V\2109Ko\331\256\321\324D\340q\2354\307\266\367\025\024\2709S\030\370/\2071\361[.ma\244O]\372\243\355R\367.?0c\226\243\365\002c\322\320\006?\335\227\375\r\3030\364\262\330Vw\254\346\254\226V\307U\257\252\325Cr\"\273[\362e\2562\0216;l\342\276N\266]n\217\252\361ih\237\3461N\374\026\227\204B\333\345.\006VN\n\226IC\377\305\013\224\264\307w_>\f\177fO\253\262\241\002\305\2342\177\246\2600\306w\341\032\356'\260]\376\256\031\343`b\272\354\263\260]\363\376\200x \007\027\274\221\222\217H\204\221N\002H$\324}D&\035\210\001{\023\036\210\272\n\236'\352<\240\351\361\313\342\f\261\225\031M}\322\346\212u@\321dg\035\243\004\240\003\206\203\242-\267q7\330\373\371\340\035\022\267\017H\237\352\254\2027@\324\276\026'a\325d"
+	.string	"\265!\200\364)\031) \220\202\031I\272\001\240\365\370\016\202DB\021E\262*\241\236\r,1\203"
+	.ascii	"\257\277\016\264c\270_x\211s1_l_\n\374[\274X\262y\351/\033Es"
+	.ascii	"J\260R{\357\226\267\302\2063\315\030\306p\200\341~i\241\273\003"
+	.ascii	"9\030$\374\276\3202.\002u\257\360\020\330\253\344\203\314\272"
+	.ascii	"\314\220\001"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.59.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"5\007"
+	.string	"\302\21525@s\322\001\230V\327\224\250X\324mB\234'#\026E\0322\rEn\212\244\t\314'\216\024\326\321\261$\3512<\312\340\361\325\250l`\262\310\324\332\222M\244L)\2768\020\324p\001?\017\227\007\342\363$@\236\210wa\241\30790\234p\300\036\005\204\330\263\266\275\232R\335\3114\303v\350+\025"
+	.string	"\273\253\340\253|\263\360C\356\214!\312\223\356|Qu\227z\224S2%\227\222\224,O\3666J\375\260O\255\232\354\247S\005`b\264\227fv9N5\373\342ZDlG\333\362M~\022\215\300\240\221i\013$\036\033,4\273\33338AuG}\240\272S\220\307g\364\003\264\321s\323\331]'I\353\270\365\266\013l'\330\036\t\t"
+	.ascii	"`\251'\023\260\2033\274\307\001\272\206\207F8)\004\031\356\312"
+	.ascii	"mK\036"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.60.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`S\003\355\026"
+	.string	"\006\253\224H\240XU:\201C\364\356\020\344\271\306\367\022\211\355\362$\336\377\n\256\2614\023k\0206X@\357\203\202t\363>\364\273\251\352:\277i\302D\272Ns\274\224\034\276\025\236\301\260\017?X\t\337\221e}8\376\226l\"eJ\001~"
+	.string	"u"
+	.string	"\202"
+	.string	"\347q\344 \314\2157Y6\246\364\222\022\240.\355\003m\325\345\377\263\312\317q\035\265\373\200>G\314\203`\352\031]\231s\342\\\372"
+	.string	"\352\222\3463\343\245\370\326x\351\232\275t \2149\240W$\324C\313\234\323\265/^\373(\305\325\232_C4\324\355l\037\211\204\310M!E\374\357\013X\244\360\241\333\225\370\342>\004\2150sN"
+	.string	"\273\234\250'\2359\247U\267\033q\237n\233f[\201\275&\0027@l/\021\250\302dN\333U\250n\336\250x\037\264\311\366\317}\\@\315\031\204\300\357q$\231/\343\322\032hz\335\245O\033/\277\036\206\222\266\370n:\264\2018]\027\366\305\271-l\251\226\221\352\326\217\356\030\326\352\345\276;%\325(\251>\251z\024\325RT\213\242zW\255\252\276\200"
+	.string	"Y\250\354\216b\311\234\"\206\\\246P&\231\361\243\337w\265o\177\207\003\r\034<x0^\216{\036\227\320d\310J\321\217[G\034\345\256 \310\032Dn\243\264B\212\313\212Q{\002\217^'\256NQ2!\304\255\315\017r\033%\022B\233v\271\350\335\227\325'BM+\325\265_0\275n\227&hm\366\225<\330\301\227\341\n\261\330x\251\033a\b\312\226\0237\035\372GNc\323.\237\353\002\211\237d}4\346,\342\033Q#B\374!^B\375\005\306\313\363f/\b\215\311\233\001><\n{\365dh"
+	.string	"\203\315(\244\374\312\221\305x8\310|~^=\026|\\\030b=\027\\\257\031\315\225c\300\262\f\260\231k\203L6s\251\200\267\213s[x4BR\234\217F9\271\332\261\350\206\310\332\031$\034M\373\262\251\r\201R\372\to\213\263\314F\371\357'\212\241\363\016\216\255\225\331\003_\023\002K\216\t\267\251m-\020\221\034\023N\207F\355ic\366'\230S\201{\362$ \006;;\343%jS'\306=\355\205\232\336\344N\002A\250\021@\231r\310\030\222\tF&\210\202\304\351\340\002\031\261\321\003\021\2405\223J\223f7\240\350\325v\343y>\366! R\213)u\322do\245l\344$\277\327/B>5\347\tI9?\346G\334}\201A;yQ@\002\361:&yP\342\377!\004#s?\202\016\320\204j\217\305p\314\315\342:"
+	.ascii	"\347\312P\033\201\341\273SV\347\025p4$\b\252\230\004\357\346"
+	.ascii	"\207\026\370\007M\204\321\b\001N\350\331\255\340\\\267\3474"
+	.text
+	.section	.gnu.lto_blackboxDeviceStreamCanHold.61.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\350"
+	.string	"\245\f"
+	.string	"\266\330XC \217\223\016;F\2058^\214Eh\200O\240 ~\335\302\370\221\373\005W\205\202A\001\004\372\202\023O\030B}<\326\013\\'\352C\241\2537!\004\200\031\030\207L,\016^\343\220\244{c\t\331{K\231RG"
+	.string	"@"
+	.string	"G"
+	.ascii	"\017\020\017m[\301\202\217AOy \t0\311\210`X\273\251L;\034\364"
+	.ascii	"\247\t"
+	.string	"\362K\376\006\250dP1\352R\256\357@)E\n\200.\3646V*2wy\242t'\231\227\307\356:G\235\205\033\3366\003\333\035\366?\002\034\354\277\335]\353\212\257\243\376\350\364\203i}\351\324\364\261\006,R\205\356%\027\273\244\326\314\256\200&>\330\376\330\032\2663\355\237\336\3629j\2025\273\033N\220\330]\004N\200\035\022\370F<|\001\251\252G\201A\306\013\213\230\031Y\342\305J\203\232\023S\265\227\026'\t\303\366\310a8\035\376\b\n\033\266\273g\361\304\303T\r\352!.\302\343\2638\002\227\037\035\372\\<\274\336\345\006V\252S\251\345\202I\266\354TIj\\\b\211G\203\336pl\"\037\0226md\003\342@\313\036\210\200p\262M\207\3138\nx\203\020\322\311H\266\255\223i\244\366ou\305\n\302\024C\244\322\013\2331\261bT\371\203\342S\024\333O\355a\242\241\027U\365\322\213N\241l9\021"
+	.ascii	"`\325\203#\264\302\302\203\26204fEO\265\001\017\335X\221dv\265"
+	.ascii	"l\022j\361(%J\227Q\345\032%\252\230\020\247\252\221\347RP"
+	.text
+	.section	.gnu.lto_blackboxDeviceStreamHasRoom.62.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"U\t"
+	.string	"\326RC: \005)\035'\341(l\f\004\334\f\201\001EY\240T\3548\271\202\260N\017\254\366\266~\313\310<\261h{\362\324\027$\220"
+	.string	"\b5\024\217@B\205\265\226\246\360\237\220M\244L)2"
+	.string	"2"
+	.string	"0"
+	.string	"\332\t\266G\333fhHY\3650\366*(\321p\261\334\354\206\235\206\\\365T\371G9\304J\314\006\204\255\236\334\303\356:A\330\306\255\267\235`\333\3016M\337bZ\265tj\372\234\001\017\031\330c3\273\257\031\200\205\211.$\266Sv\307v\246}\223\237\244.\303p\300n\307K\313\356*x\201\363\350\271\301\366\030\217q\005\020\310\253]\362\362`\252'CW\366S\256\202\362Gl\361\345\301G\377\333\036\257\007\"\034\254\234\331\341*\025\304\276\266\273k\3750w\331\003\337\350\204\nE\213>\036)\342\302\013I\210@\023\241\216\202\004*u\"\323\327}\020\354U\214L\335\311\363L]'\334\233S\017K[\336T\225\323\255\306%k\345\314\251\252\001\t"
+	.ascii	"`\251'3 \f3\016\227\253*\273\273\214\302\325(\017\035\"\232\256"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_blackboxDeviceStreamRestartRequested.63.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\375\t"
+	.string	"&\222D; \261\322\001@0\376\312\240\245,\004I\333v\035Pa\242\017:\256v\251\210\303\304\212\212hl\031\273\210\036\314\241\271|?\200\201\002F\2009?\005\350*r\024\231\361\t!r\247\0242"
+	.string	"4"
+	.string	"3"
+	.string	"\377\226\226\276\351\337f\254\265.\264r/\230\025\223\365\375\016\\.\254"
+	.string	"\023\365\r\274\274dN;U\231'J7c\255\3254er\334\340m3\330F\260\357\035(\264g\237&\2721\373_]\230M\375\360\241e\265a\036d\246\326U\217Wu \013\211\355\222\315q\202B\311\345O\331J`\346\241\241\262\253\365\024\367\343e6]\217\031{\3726f\373\311KZ\270\035\315GR.\335\272\f\277\237\224\030\024\255\261_\273\211\005\301E\214A\242O\035\364I\341\301\357i70s;W-\006u\310P\303\005\371\201"
+	.string	"yD\037Q\"\344\211\020A#\n\261S`r\302a$V\220\344H\344\234\365\013\263h\026r\303\321\333~\332\001x3\331\r\267\177\031\322U9\020"
+	.string	"`\325\213C\300\250:J\035\326Me\rX\202+^\200\n\211\270\325\206"
+	.ascii	"]\303\021&H\371\2156X\036\327\\\240\2322\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.64.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\205\013"
+	.string	"&\026P?\020Q\225\016<\242\240\025\250\212\343N\323\fA|\007\245\205\222\355\002\214K\n\223\201k\212\362\302\315b\354\030\337\373\001\232\2633\031"
+	.string	""
+	.string	"\024\246\")\216\350\231\016\001\022^v\336\016\331[\312\224\002>"
+	.string	"<"
+	.string	"="
+	.string	"$ZhX\241c\367\225\031\370\004{\204/\200=\352\207s\207\232\234/\300\023\035FPW\250@%\0035\300#\301I\310\312\306?\236&\257\224\t\300\262\273\316\316\343p\307\333v`\273b\277\022\237\225e\337\365cNC\230NM?\262\0019m\360\036\202\305\356\351\343\2614\"\214\021\266C\266\304v\346] H`K\253\224\213\335]`\006\221G\333~\211\233\b\231{\200a\324\241A0@bjo\025\362]*TQ\276\310\021\342A\265eL\257\232\212\031\245\334a\037\305S\200|\020\356|\362\335\243\377\301\036\257\3778\002\034 5T'R\243\374\354\027)\265e_\277\357\013\235\214\347\202\026\215\241l\032\b\0266-\002\346\"A\3136\232\313\204\f\303\351d\224\003\336(d8\231g\3338\231\3445:\274\262\216\312\020CD\372\034\006\325d\033j*\351Fv\233\300\026Q\366\200\273\273\001\021"
+	.ascii	"`\251\007U\020\253bt\016L<c\334\002\236\03123\n\270bh[F\310)"
+	.ascii	"\220\t\360\\\003#&\334\3603MK{40\265\007"
+	.text
+	.section	.gnu.lto_blackboxLogDirCreated.part.0.110.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"=\f"
+	.string	"\006\026PC \213*\035\300\262\002["
+	.string	"\030e\224lr\314\261o?|\023\030\231\220R\023\024\b\367m\201\351!\337b\254[\275\006\352\340\2601\230\204\320\353\025\200\230F\300\351\362\004!B\216Vl\266U[#\233\354\235R8"
+	.string	";"
+	.string	"="
+	.string	"\225Gp\257\366\023\330&\235<\332\033^\266\226R\200v\002\233\355n\367J\t|<\235\333\350\223\250\322\351_\237$*\365\t\361\215\242\261\273\256\b\270\353molg\330/\005te\277\374\317MX\250v\001\324h;\240Z8`\373\366_$\373r\361\234/Iw\215(\312\rp\362\234\366\025|\301x\327\350\017\273+\r\025v\313\213WcT^]^\202{\r\030\331\256\351\244\355y\204\317\037\264^!\204!\363\2441\030R1\023Z\362\251\r\272\203QF\266\273\033\277\301a\"\276\201W\217\210\346\311W_\304\275Z.\324:\250L\2636)\313t\3336\"1\fy\237\bvX\354iB\220\203$\354x<\216G\247\373"
+	.string	"9\237\316\023A\235\246\302!\310'v\2410\024\273\313\266t\345\r\0041\023-1\245\224\365\217\263\275S\3702\262\t\224\f\260\031\007\314<\203K"
+	.string	"\003\034"
+	.ascii	"`\251g\364p\3422\214\333C\264\031m\023\256U\004\b.W\321\353\300"
+	.ascii	"\r\253E\260\262Ub\273&\203\340)@\346\352\266\251-\202\206\b$"
+	.ascii	"\204\316y\207vZ\260\231\274\323,p\355\271\240\216\331\316\023"
+	.ascii	"\312\030"
+	.text
+	.section	.gnu.lto_blackboxWrite.part.0.112.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`4\001E\r"
+	.string	"6\030WC"
+	.string	"\221(\035\333\210\372\n\026\261\201\312\243\2244\224y\017\031.\327\230\326\025\335\364\n\257\200\225QQ\212\032\202c\306\317\376\317\233\342`\252\013J\024 \350\232\356G\025\211\332/S\n#C\036\244\222M\244L)?"
+	.string	"E"
+	.string	"F"
+	.string	"\221\301\241\033d\207\366S\330\356J\354\3318\036U\366-\253\021\027\326\356n\207:\342\3365/\317OU\3533I]\037\177\231P\345\370L:<\007\374\002\300\331]g\036nx\333\017lK\260\377!6VX\253!.x\313Yx\030e \252p\210\200\342\306\f\326n\334\016\035_"
+	.string	";\314N"
+	.string	"\373\355\361\025\326\0304\264\373\261\2635\315\232g\261f\323}\365\361\270$%\326\2645\033\357\253\017\353\256\210\025\030\273\001'a\256\224\377\016\375\022v\250\032"
+	.string	"\3045U\243\2521\262\003$[/\331\311*8\314\227\0230\251\324\221\232b\275~\255\242\330XZ5\235g\371\217\tp\020\263K\322\212\331\023(\243\204Kg\024'd\203\310\365\"D\246\2209"
+	.string	"B\215:\030\240?\031.4!\003\347\021}:#\317V!\324!m\037\323i\313$0g\001d\332.p\234i\323l\347\257U\024CP\001\003\242!\252)\266\265LU\265E\244\374g\004\"\232\262\337\342.N\016\035"
+	.string	"L\261\177V=\326\215\021\266P\310\017\004a\"a\2143\240!j\f\034\320\336\372\263\t\020\005\303\\\341\366X\221\177\206\310sK\224\267'4;s\330]\241\357\253v5\347z\233~;W"
+	.ascii	"N\036\314\3434[zB\031\003"
+	.text
+	.section	.gnu.lto_blackboxWriteString.part.0.114.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\262\002\315\024"
+	.string	"\366\246\206H\320\016)\035C\365\253q\246\016\275.x\b\266h\320\177\306=ScK?\310*\242\341}9@o\306\n~\364\377\375\227C\272yKq\262D\314"
+	.string	">)\365\352AH\260\205\225\013\3760je\034\232k{\322\310&R\246\024q"
+	.string	"v"
+	.string	"g"
+	.string	"7\361q\366 \231\007\230s\347\bi\316\361\300\245A\304K\217\242\375\0222\335I\034hf/\201c\317\356:N5=\2509\247\353\262\343\002\302K\360\033\341\345v\360\352\354\022\\\rg~\210O\023nG\273D\340\343\303\3552\034\004U7\033\017\032\273\0310$\352)\351F\327\334\256\246\313\002\201\341\272\361P%2\347\264\250\341V\3356\314v\004[Y\004\241\372\032\005~"
+	.ascii	"\340\314i\363\223\23292\351\303\213~\242\037\371E\304f\341\006"
+	.ascii	"\032\341 \001A\315\231\321\003\306/\034c\317\215\203\021.\244"
+	.ascii	"\240\346\034]\227k\3370G\341U!\243u\237H\346\027\335\310-\237"
+	.ascii	"\354=\331\314\357\335\347\326\245?\344%\221\246\023\207t^<\315"
+	.ascii	"9\025\234\210\371\244\321\255r6\030Os\216\036\227N Z\365B\262"
+	.ascii	"\007\311p\214\363FgU;\372S\262-\263gv\f\305M\003\227\026\241"
+	.ascii	"\351\f\357\3019\347\334\345\261\rrp\3456\340\265\240\ta\323\237"
+	.ascii	"5Tw\327\206\225\350q\356\270-\315~\212#\305\374\037\237\240\350"
+	.ascii	"q\227>\312\2566|u\027\360\232j\246j\372\363~}L\267\235.\2177"
+	.ascii	"\f\351\211z\362\356\330\254\027\335\253\225Z\274\320\257\n%("
+	.ascii	"\252W\245\3266\371\030`\342R\242\002K\t[b+\333r\223|\304N$T\210"
+	.ascii	"\215\240\220\274RF\\*'\257\t.\022\226\026\327\007\001\307V`,"
+	.ascii	".\227X\214\305\325\372\356\3709JS\340jY\254_\3001\255\250\255"
+	.ascii	"M\202\013n(\356j\265W3\245\332p\305\205\300\373\321\210\260\351"
+	.ascii	"\017\\\036\273(\341\204\252}0\244r\301\315\331\257\360\313\300"
+	.ascii	"iF\243\354/Qx=&\274\374\336\350\312S\312q\250\0056 `\002)v\267"
+	.ascii	"\r\346\031\003C\375\230\002\240\\n\364\265\265X\2623\022\373"
+	.ascii	"p7\266f)Z\234a\335\212\237\265AZ\257,\232\244x\231\261=\330Z"
+	.ascii	"\027\2700E\024w\330*L\220]\031\330g/\331\306R\324\3440(\036\034"
+	.ascii	"\214\227  hth\313\314\321\036\203\367iU\202\020\f\240O\fq\350"
+	.ascii	"\364N\266\366\266\033\\\310\367\320\344\246Y\307c\037\266\037"
+	.ascii	"l\\Sq\375\351\327\2521"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.part.0.116.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"%\013"
+	.string	"F\022F="
+	.string	"%+\035\214\304\217\324"
+	.string	"$a\314\312\362d\006\372\017\340\217\354E2q\206N\b2\234\f\315b\020\312\237\342\036EU\355\377\023_\372uUq\013\267c\003\264\325D\n\247\221\275wJ\0011"
+	.string	"2"
+	.string	"9"
+	.string	"\345m\277\313y\354~\273+\036\244'w\235\316\352\362\247J\216l\366:\275\356\265%\205G6\033\371$x\r(\355\256C$7x\333\f\266\035\354\233\002.\277\215\225\243\3620-\263\020\312\233\310\003N\207\367\333-\305\203.\177"
+	.string	":\030z\001\350w\353/\246<\234\360\276\216\264\303\360\340s\266\311\020\273\354\235\007v\206\306\274\314\0024%\276\030}\311\330&E!\321A\203\033\026\237\236\327\0040\251\315\264\276.\255\331t\2417`\262\013\022\340gi o%\2064\253\004\373\350\2505(6\001\216 %8E\032U\246\215\021%\221:M\240\304\n\325\211BL\255.D\222\202G\013\210\225\2101\216+1\264=_\227\326\334\200\363qP\330\f\215\326[Jm\266As\364\037"
+	.ascii	"F1sV=\272\025\030\027\006\202\003\034\003S\200\200\243\342F\031"
+	.ascii	"\342k\006\203\301\224\266\005\316\f\017\210\202a\256p\301&\354"
+	.ascii	"\317\020yne\301~\220\337\023\204u\212\222\2413\224\315\274\235"
+	.ascii	"\026\200k\017\246p\232\227^[\306"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.118.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`'\001e\f"
+	.string	"6\026P@\020Q\225\016\\\017\306\201\023\252\b"
+	.string	"\352\331\254\007\026\304\fy\025v\205\220\226\177\350\2025\367\355\376\347P:\361PD\336\272;\001x\006"
+	.string	"\330\002\024\243\243x\370\343t\243\177{R\321\3306\2212\245<"
+	.string	"D"
+	.string	":"
+	.string	"'\341\013\306S\331\366\00532\351\241+\365\026\r\n+d\273!\367\250\036N\272\246F\362\363[\225\256\007\037\300\024K!\343\265\302\360\254\\\353\310\354\256'\031\356x\333\005l\033\260\257\n\022\001\033<8\354\246f8\266C\204\205@\3419\2249U\230\240\275@\274(![TH \374\t\221C!\241\353\302\001\0213`\016\017\"y\234\374C\362[t\023V\230\215\021\273\273\335\007={\263G\366\366\030\377RGPZ\262\317\342-\"\370\037\374"
+	.string	"\224\377\036}\220FS\354\206\006S\316T\330\366jL\\\253\332\335\001\217\007Oq\001#F)s\244\266\254\332\265U\226\355\264:\2351\375V`\0211\307\322u\020H\3506\0138\032\006\033\256AG\343\3418\037\020g\001\340\316A\202\017\007\241\353>\334vm\225\345\203\257d\252\252\005\333\252\251\247W~\273\316\250\266lS\362j{\272\f\036"
+	.ascii	"F1\003V=\262\305H\272\202A\034\bQ3\003 I\034\030\323\016+?\013"
+	.ascii	"9\207\3605\315\360\bm\3462@\024\fs\205\233h\"\377\f\221\347\226"
+	.ascii	"\005\233\372\320\223\216\267\016\347\252\232x\251\323\276\244"
+	.ascii	"\246\250y\377\265e\f"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.122.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\236\001\325\016"
+	.string	"\366Y_E\360\222(\035\2201\352P\2005`d\375aZ b\021\241\214.\322\301\340\214Vh\330\314\277\325;.\254V\364\312C\232\336\372X\201\344o\337^7,\211eP\034sR\025$\027\037\205\235\033\323?\"{K\231RG"
+	.string	"L"
+	.string	"L"
+	.string	"Ga\033\325\342\224\275\343\236\314^F\214\305\305\267\273\333\243\212x\352P3\246\374\303\016\240k\251\016\263k}\270\302\005+_\bP\213\005\005\350\260\324\034\366\344\320Ze\026x\004!\331]{\\n\355\266\033\330v`?'\216\351\204\351{F\276\001/\273\035v|\254+\312J\254@\031\205d\265a\005\316\240\301I\361-\313\033\361\256\"\305(\007<\031\017\017L\334\310\276]o{\264\367\020\355\321s\003\332\343\355;\3451\353\215\232\023\273\373\271\017C\331\237\317c>\215\327 I(\225\264\307T\006$t\274\300~\242\305\2108l\276\234"
+	.ascii	"y\265M\270|\347\004,U\331\177q\030'\376\bc8\345\273G\377\244"
+	.ascii	"\352b\363\002\241\222;-l\243D<\"\217!\257\226\0368\252\374\221"
+	.ascii	"\032c\215\207\2530\016\236\020B\340Q\210+E\320\300\225P\030\211"
+	.ascii	"*\224l\026J\"\223md:m!\005\346.\220L[\006\2163m\037\270\nc\b"
+	.ascii	"<f*\272\222\271\\9C3\203\004\322\026\215\362\235A3\257\331JU"
+	.ascii	"\326;\207\215\230K5\306y\222\226jbq\303J\035\007' p\202!3\363"
+	.ascii	"\346\314\200\257g\217\303\375\261an\245u\344X#\302c$V\274\b\026"
+	.ascii	"\207\2029\340\352\354)\315\024\\g\326\265\260\227\253\235v\323"
+	.ascii	"\212\215\306I\267\031PcB\236G\0301\216*\306/D\366\326.j\260@"
+	.ascii	"\206.\224\231\267i!\250\275\27184\037\367.3\006"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.part.0.129.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\376\001\325\020"
+	.string	"v\236kF\360\262&\035\022\b\257o-\265\267\217\254\312\353\026p0\233\022\317\337o\254\376uZ&Q\204le\f\0326m\233\266\372\235\t`\360\220\333k-\236\321\260\2428\274u\227XW\345~\356\203\202\213\203\330\275\267\224)\005\\"
+	.string	"W"
+	.string	"U"
+	.string	"'.N\335\353\\\003H\004\311\264\b\232\323\323\0367\304S\027\311\bW\263\224\257-Nu\321\205<\360\254n\274\340:\\B\022\233\031\033h\340\344\210\321\230q8\034q0\272\220\004HF\017"
+	.ascii	"\034\013\216\270D\264\036\273\316p+U\221g\"\2249\247\377\362"
+	.ascii	"\272An;\3066\003[\013\004\352(\3250\252W\375\020\250\363!\200"
+	.ascii	"\315\234\256\317\307\274\211=#V\240\314\002\347\313\353j\216"
+	.ascii	"\343\362P\004M\226W\342]E\213Y\bx]M\003\023?=\366>\"\037\263"
+	.ascii	"\013\220\217\267\357\226\247\360\202\327\320\2119\347\350~\f"
+	.ascii	"e\217l\027{\364\370\035\233\234\240hl\333$R\203\002\037\036:"
+	.ascii	"q\277:`vt\340\302\\\\WK\254\350\036\304\315\376\235\020P\214"
+	.ascii	"]\230\355\224\374n\017\0268X*d\020\2657\013\372\326W=\033\234"
+	.ascii	"\317jU<\266Q;\262n\322\314\233\211\340\361\261\277\253\361\371"
+	.ascii	"\250tH\027\346\315\276\337\367}\336\034\333j\351\216@2\340\022"
+	.ascii	"i39\310\260\251\254\224R$\250h\024L)\023\264\322\351\202F:\340"
+	.ascii	"\255\302\203\223\206a\333N\332\350pn\216\037\273\210\214+-Ww"
+	.ascii	"\005C[FQ\351\220ha\326\230\340\nK\016w\306\206\033\3672?^\364"
+	.ascii	"\363\036\3169\247,\311\375\tQ\033\202I\337\332\r. p\202\031\303"
+	.ascii	"\252\003f\230\001_\2750\031\203F\302?\211B\\\233\210\352A-\320"
+	.ascii	"&Fb\241\215\3254\3203\300\333\r\213]\333\337\235\332\337\220"
+	.ascii	"\270\270Wn\032\335\376\206\346\002\265ZbA\0020r\333\210\302\260"
+	.ascii	"\375\201\327\331\260\211\336\026.\027\312\337\263\340,,G@\t\245"
+	.ascii	"z\240\355\007j\256\202]\357\220/\273\301\256\227\007"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.131.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\261\004\205\035"
+	.string	"&\265\270G\220\234M:\004rJK\220\313\377\317|Q\333|\3674\252\f\035\270\236aE\364\204\2272\020V\234\334\250N\303\217\355mg\001ql\324\"\364\024A\230\b\220\001 \342q\022T\233\022,\321 \3206B\b![\356\224\002\253"
+	.string	"\233"
+	.string	"\237"
+	.string	"O\216l\243>\252\235\316\266\357\344=\032\266eP\272\345\300\220\004\013SV\260V\037\355a\317\013\210\017\351\t\210\017\227\310m\337\231\311Jr\024C\272\223\307\346\217?H\337\231\271\335\216\317(\2046]b\005\232\216\344\216D\347c\312\326jLn\307\343%u\020TR\343btP\364"
+	.string	"\223V\234c\235\001\022]\217I\216\343\017\365\202\022\373\225\251\262\343q1\352!\255p\243\013\217\347\315\220/\263\335\322\244"
+	.string	"vJ\264\007\353\323\306\01677I\351@tO\242\200Z\253l\307D\347\200\363\214?\265V\377\366\343\006p\333fl\203\260i\211\327z\025\"\277\352\241K\024\315\347\036\372E{\254S9Pl\230@\271\315\261\271</\317i\255\265z\205\330\262iY9]\222\323d9=\222\323\342}\177XNSrz\307\351)N\177"
+	.ascii	"]R$\200T\255Mcs\352T\230\305j\312\221_\320\372\344\243r\n0\246"
+	.ascii	"*\330\013V\234/B\326\245\300\360\013\004>*\247\016K\316\200\331"
+	.ascii	"G\336\276a\374\347\013Pl\256j\255\263\373XG\366\314\246a\317"
+	.ascii	"\274\363\276#_\335\351\274\363QdP\001\025\027\344\211\253\326"
+	.ascii	":\341\241)\220\017\355\007?\363G'\353*\\^\270t\247\230\337\327"
+	.ascii	".]q\213\251\316\336\276Z+]\236E\210\273\265\037\032\334\224c"
+	.ascii	";\304\303D\220\265V\013~\230\031#\374*\026[B\361\301\374\213"
+	.ascii	"\205_e\022@@\342\303\2715(1&O\2679\346{\275\007i\322\361\376"
+	.ascii	"\273<\273\213\357e\275\252\221`\357j\213\317\305\300\203Q#\025"
+	.ascii	"5\265\274\313\317b \371+\020\271H\252\252\253SWZ+\256\336U\235"
+	.ascii	"\252\017\256\330\006\376kJ*\252V\244K\331\337\262}\004\234\271"
+	.ascii	"\372`6\2454\353\330\016\272\225!\262V\234\005\0076\341\263\240"
+	.ascii	"\005\221\013\031B\241\207|\214\212\200b\030\t\235\030\nB!DSQ"
+	.ascii	"\024\224\2026TkA\363i`\243\025D5\232\013#\243\032mf{\236\326"
+	.ascii	"\025b\003K_`\343\274M\324\261\364U'\374m\242lm\330\226\355\334"
+	.ascii	"$2?t'\301\214p[\303\206\371\234o\006\350#\f\227\340\306\305\315"
+	.ascii	"\254$\267\344@\216u\265Q\343$\223\200#J\224OS\016`\271<\217\033"
+	.ascii	"n\355\007&\356\270s\315\201i{\3700\237\023w\203i\342\204%-\222"
+	.ascii	"\317\365c\375Ti\340\204\221[\357\335\232h\215U8\234\364\250\324"
+	.ascii	"\005\342=\317\233!_\304\345\371\016[\250aD\242\2242\304\021)"
+	.ascii	"\021I#\251\206\003\200\002\0312\253:\021\220=c5\222$\205\322"
+	.ascii	"2\007L\252y\276\177hrg\017*\020\035J\016[K\366\235\360\275\362"
+	.ascii	"\214\340\321\343\222tU\312\r\217\022C3T\364\222\335\221\243f"
+	.ascii	"K\320\210\255\273p\3624\246\355\354\342\n\b2A\233YnA\370\256"
+	.ascii	"\2758\f\226B\312\271\353\324\260`A&\271\221\021C\321`\352\005"
+	.ascii	"\2632\340\276\177uW\325G\335\033Dz\004s9\256I_o\0040\350y'\376"
+	.ascii	"\340\217\371F\003h\204\277\240\334NN\214\031e\324l\306\334\354"
+	.ascii	"\331S\266\\\021\311\346x\3264S\0322\204$\3728\351\r\226\f\212"
+	.ascii	"l\264\206\344T\237\203\025\266\356\031u\003\261\301\020L\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`\344\t5\037"
+	.string	"f\262\265B`\346M:\274B\357\034\364\314\244\371\371:/\201\224\037\303\253\340\373\331\310\204\277\223<\311\256\375DDj\033\314\216\254lRVvd\225,\034,\306-\205)\2303\312Y\2076u\235\021\240y\017Id\n\246"
+	.string	"\231"
+	.string	"\250"
+	.ascii	"*\232\313<X\n\004\025ES8\321[\246\211\3262K\034\256\222 \326"
+	.ascii	"\021w\253\"\032B\210\316\002\321X\037\372\312CK\350\320\0218"
+	.ascii	"\264\325\206v\240\241\033l\030\275\274\266\f\315`\321WW\231\311"
+	.ascii	"3\r\206^p\341g\325B\257\024\336\333\333\333\253\320\013\3465"
+	.ascii	"U\273\372z\\\375D&\205\376!\023+\214^\336V\337\220V\202\212f"
+	.ascii	"\365\363\f`\365\007\231S]\\\274\264+\201\256\372h\236h\0367\006"
+	.ascii	"O\321\261\215g\001\252\250\236`"
+	.string	"\362\277(jTP\377\373\316dr\354\314\337\177\033\226=:\317\363\254\352\007\346\177\240]{\344R'V\254\374K\027\034\261\224>\240d\037o\301\372o\366\354\267u\377-J\037\016\224~\234'\375>N\372qM\372|\230\364\347,\351\317)\351\313%\351\273A\322O;\322G3\322W+\322oC\244\277\034\322'\023\322/\013\322\017\004\244/\350G\377\217\217\276\237\036\375:\036}\272\035}6\035\375\265\034}3\034}=\310\276\234\033}:6\372uj\364\355\320\350\337\231\321Oe\364\361\304\350\333\301\350\347y\321\277\333\363<\377\002.\372{\266E\177\214E{\231+\272+u]L\214\300\213\211\177\312\335%\006*\367pyxZ\270\226\030\t\335\250\244\\\241\343\022\177-k\005y\321\267\255 \357r\257\354\b\231)\006\031\211\245\304\233\356\373\274\255\371\222\245\304\310\253\244#\022#\227\321\346\246d1\002yQ#"
+	.string	"\376\232\360\343\013kf\271\263B\367\3631T\330Q\345't\215V\032)\252\252\354\304\240\262P\331\240r0]\"\232*a\016*\007@\037TFZ\356\331\314\250\220\201P\031\230\356\246\207\266\210\261\252\fD\227\325\374\200\221\263\252\374C\227\351t9K\024\241\262\017] \243\224LB\345U\006\267\261&\034\242<^\226\250\370k\217\246\330\007G\344\"\362\302!\262O\211v\200\367.x\200\241\224K%\247\216\333\327\206\374\224\356\343paT\2458\344'eq\310Na\333\225\306\306\220\324\220\205\251\233!3\245\233T\206\247\346o\206\374k\033\322\225\331\222\346nC\336\267\341\232\024/\312&\305>eU\324\347\246\\!s\265\250\n\305\273L#\300\253D"
+	.string	"m"
+	.string	"/\372\263\247\275\231\023\357\362\270IN\274I$\001\fL\002\233\370\247,kb\237r\323e\023/\3726M\374K\002\020\262oL\270bqbr'\02322\200\221\250Q\020Er-\221\221\242\330X\306\300\002\031\242\342t\021p\030\2111C\004\304\020\201\020\t\246F\374\346$tf"
+	.ascii	"z|@A9\023\377\347aI\372\3754\356Y\261q\"\356^\213W\360\2025L"
+	.ascii	"\237>\020N\211\217}\352\342\275b\022\254DG\231y\3130\021\211"
+	.ascii	"\256\2747E\366\352\310\210\264\346\326\t.J\017\236k\\5y_\220"
+	.ascii	"\375\006\202\342\263\245s\247\023\016\245^{R\207n\214\363\227"
+	.ascii	"$ia\232\"o\242\272J\340\241:c\301\363\030\210`.\326\266\344."
+	.ascii	"\326\266\344.\326\266\344.\326\266\344.\326\266\344.\330\203"
+	.ascii	"Q\276\001`\354f\032fY\035kV\216\274\23254l\276\333\240U\247\230"
+	.ascii	"\213\276\t\036\271\366+\264\234\355.\231\202\002\203\306q\311"
+	.ascii	"\211\311\311I\256\222\313\234\234\262\241c\n\203\026\340\347"
+	.ascii	"fwIOpJo8xr\224\005\241ez{\022\204\030v]\340C\2607\\\326\332t"
+	.ascii	"mT0\346\375\316\035\257FSV5"
+	.text
+	.section	.gnu.lto_.refs.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\005\007"
+	.string	"v\320*  \253(\035"
+	.string	"\f"
+	.string	"\f"
+	.string	"\f\005\360\211\274\216\3331\3668\316c^/\334\374b\355\223&\267L\001\036"
+	.string	"\037"
+	.string	"&"
+	.string	"K}Gy\243\337,7\243\236\021wC\345\354Jg\312\227rU\336\376\225\247.9\237\r\001\320+\213O\017\374\326"
+	.string	"\274\353\206_o\226Lo\271\360\205r\205\362I_\322\217\364n\375\251\fK\2143\246W0\236X\334\221\276\201\f\036\007wJ\325\013T\203`@\200\f.\370Aq7\r\270\225\365\214N\334*\317\266\204<\341\0208\327\021\276h<j\217`C\324\354\017\036\334\f\214O\030o\353!\337\017\306\247\350\026"
+	.string	"ak\210\224\300f\210/\037!\332\020\020\034\002c]\331\373\252\035\330\006\226"
+	.ascii	"9p,\245[\317m`e\200ZK3\260X\312*\007\013B`\023\n"
+	.text
+	.section	.gnu.lto_.decls.5c7948ff1e8ebfc,"e",@progbits
+	.string	"(\265/\375`>LU8\001:\t\362pU \fI:\351|iU\004"
+	.string	"\314\334\214\210\273\370W\333Y\"\026<\376~OD\323\322l\274\273\231i\276\356\254\352\271\341K\211\221Za\215bN\361SG\246\313\341gnc\247\f8\013\355\267\213\254\355CE}h\354\267\013My\0311\221|:\202\b\331[\356\024\350\005\362\006P\007e\332\350\267p]\325G\255\264U\246r\221\222D\032_\0254\300\234\231\013HS\322\262"
+	.string	"\037#\245\302\232(\1773\300\032\377\016\246\277\\\322\277cD\365R\004\223\027\216\306\r\243\347\035\003-K\n\024\322\270\246Jjcw\320\337\273\364M\346\322^j&\333\274\240\233\230:8g\202\234\tl\374\373\226\336^\200\332A{\001\372\353#\375\355J\317g5\240\2775\322_\246\364\035\230\276\273\244\035X\r\350{Jj\317\330A\333\324\2403S\247s\230\201k6~/Io5@\357\340\240\325"
+	.ascii	"}\267\245\237\263\032\320\333\246\r\004\024\341G\r.e\310\330"
+	.ascii	"\334 R$F\237\237\rc\001G\300\341\004\203f\376\032\3331\366\357"
+	.ascii	"\026\320\212\271\210\021\277\312\265|\226s\266\200\013\300\312"
+	.ascii	"\271\310\002\352\b\346\\\244cm\006\326f\200\205h\365(\202\342"
+	.ascii	"\267Zz-V\003\212cwP\013\246\347\266o\007]N1ul\244,\341Kk|cw\320"
+	.ascii	"\337\362!9\233O\204\024}\371@\006\213QYc\275N\262\203\310\213"
+	.ascii	"\306\367\340\212\222\007\277\205Kb\251\\\265\245p\311h\211\257"
+	.ascii	"G\317V\261VH -\205KZ.~\253\305n\261{\226\213\355b\2336\313y\230"
+	.ascii	"9\037\345\234o\317\346l\335U[\246nM&\276\234\231\267o\277\205"
+	.ascii	"\323\263F,\222\234#f\206\262yUQ\202\033l\300\263\301\006\302"
+	.ascii	"\2460Yj\334\340\316V\003\212\201\335A\337R\251\315#r\277\370"
+	.ascii	"`\332h\374FJo\311\244x<9\201_\\S\032\337\352\245\267q\177\317"
+	.ascii	"\255\024\333\304B\261x]\024\020\262\307\227s\376o\247\330(\266"
+	.ascii	"i\245X&\307\314\234\337r\316\367\340\357\271\225b\227\330:\017"
+	.ascii	"J9gYY\220G$n\n`\316\314\rx6\2707\300\2724A\261ub\237\330f\007"
+	.ascii	"{w\253\304\332\375,bff\316Y\307\366u\031A5\276\355\221\252 g"
+	.ascii	"\333\001\265\203\203\266\003z\273\225\3362\2457Aj\301j@\333\356"
+	.ascii	"\240\007\372`\351\204GL\035!\026\277\252\267\306\007Az\023\251"
+	.ascii	"=b\345l\263\210\215;^\303\312l93qn\221T\024$\215o?\240:\203\203"
+	.ascii	"\203\203\366\003z\n\244\030X\r(\266;\250\005\273\203\036\317"
+	.ascii	"j@\177\353\326V\323\306\304(\251\361m\323\266\021\301\341\312"
+	.ascii	"#\013\323\370\277mZ\"\226\215\231yR\257\"A\300\306\367 \335\260"
+	.ascii	"\226G<M\177\253\366[3{f\323n\022\023V~\313\231y\201\306l\211"
+	.ascii	"\326[c\233\326\026\3152o\323\354\220\213\030\361\233\243|\226"
+	.ascii	"3\323\246\341\234\213\254\315 \307\332\fN\273\035EM\024\277\323"
+	.ascii	"3\255\0064\265;hO]\006"
+	.string	"x\271\007\277\233\305\266]\233\324\263\373\255\225\275z\272\"\024\255\\\370/\334\337K7\204)jw7\310oI`\203<4\261\360\337\260\277\215n\211\013\302\177) w\257Pp\035\360_\357y=^\374\026\314m\200\2271\313w\245=\234?n\200\005#~\013\002\025<\270\347\222\370-\316\324e\300\337c\376\376\373\357\007\327`\354\035~l\200\323\235\346\307\031\330\266km\320\226$\177\313\365\\\337\233\037\3234\002\214\374w\304\321\360\265nf\002\331\372\303om\334\021\177'\340o\005\374w\001\177;\340\357\007\330\027\307\273\036\374\266\306\365\376\347u\t\277\335\272\"z~\013\342r\360\267\212\273\301o\277.\002~\033\200\337j\370\255\006\177\247\360w\361\277\037\376\036\372m\017\r~\273\343\036\340Y@\320$\214\277\r\273\006\370;i\025\360\337\002\374\366\303o\335.\360\337\247\277\t\360[\252k\301\311\334\016\227\303\177\r"
+	.string	"\237\341\277JZ\366\256\001U\003\376g\371/W\243\312\366\360\261VWyn\375\026h\363\337\277n#\343G\364\267\nW\303\337\267\353\272I\333\335\f\277U\341?\335\335\271\030~[\327U\356\205\337.\375\266\350o\232\277\323k\341\267J\277\305A\273:\177\353\375\315\345\2779\177\363\375\366\307\305\351\344\377\023\262-\376\367po~;\302\177\205\177\237\024\370\261\315\331\275\377\017pkf\202\337\376m\333\265S\256\363\337\264\337Z]yx\315\177\201\374v\311\375\337a\203\255v\346o33\032\374\377\300\177\017a\277\340\277=\332K\360\377\336\377<-{$\360\267+\374\226\004\277ev\231\377D\376{\370\177\302oq\276\341\277U\177_\221\371{\353\267?"
+	.ascii	"\377\376\013\377\373\345\357\277\277\375\376\006\3637\227\277"
+	.ascii	"\363\376v\362w\335\337s\177\313\375m\344\357\"\177\277\375\335"
+	.ascii	"\3667\333\337k\177\237\375-\366\267\216\277\277\376\346\372\033"
+	.ascii	"\353\357\032\177\317\370[\352o\030\177G\375\275\374\233\351o"
+	.ascii	"\244\277\217\376N\301\337&\370\273\004\177\027\377\016\372\373"
+	.ascii	"\003\177c\340o\t\374\r\201\277\025\3607\002\376.\300o\373\376"
+	.ascii	"\366\360\267\005\177\363\374\235\341o\f\177[\370\355\226\277"
+	.ascii	"q\376\266\371[\370\367\371\367\375\333\376\326\314o\363~\033"
+	.ascii	"\370[2\277\235\362\333\273\3372\371\255\334o\377~+\346\267~\277"
+	.ascii	"\325\373-\226\337Z\371-\336o\241\374\266\311o\353~\213\344\267"
+	.ascii	"p\277u\373-\333o\327~\353\364[\025\277e\376\026\355\277\334\177"
+	.ascii	"\272\377[~{\366\333\022~K\342\267f\277\375\361\333\261\337\206"
+	.ascii	"\375\266\307ow\374\366\353\267]\277\335\372\377\367\237\313o"
+	.ascii	"\265\376\343\375\326\306o\253~K\365[\251\337\276\370_\374\217"
+	.ascii	"\366[\234\377y\377\017\360\333\377G\361\333\250\337B\375\366"
+	.ascii	"\351\267A\277]\361[\343o\205~\233\302o\211\277\005\361[\004\374"
+	.ascii	"/\363\237\314\377/\377\275\374\357\362\277\355?\363\377\321\377"
+	.ascii	"\273\377\031\f\016\016\016\3766F\376\033(\377\002\220\002n[\266"
+	.ascii	"\\\267\fa\200\001(C\362j|\234 \351qh\244\377\305\322\274Xn\032"
+	.ascii	"ff\250\020\220\301A\252r\255T\271Wyy\367*\016\255\246+G\327Q"
+	.ascii	"\343\337\364\245\277a\222J\271xR\256\333\224)\327\215K\017}\263"
+	.ascii	"SSk\374\033\264\3647V\351\223\013\345\311\275\272\273\273WD\314"
+	.ascii	"\306\224\031\222\244\361o\\\244\267\371\222*\271M\224\\&vv\227"
+	.ascii	"\211\226\336)W\266c\312\222_&v\366\217,\314W\343\213\271b\377"
+	.ascii	"\205:@\002\227\2604\276\315]z\033f\372;go]\363\326\365\026\036"
+	.ascii	"f\216\n\001 \223\203\333\214\245\267\275\005\215\273H\342\256"
+	.ascii	"\034\232\263eb=-\363\324\362\203\021#W.U\332\346\220\251\017"
+	.ascii	"\251\340\337\225\323\021\333\274rfuL\031NZc\366\2204\276\rWz"
+	.ascii	"\233e\nw\301\340.\325\r\326\023M\016A\277\264\255\355\2725E\211"
+	.ascii	"\022\004t\263i\302\2601-\246\306\257\201\222\262\261\335\253"
+	.ascii	"4\357(\253iK\377\273\366\213\030a\233w\355\016\261\314\374\364"
+	.ascii	"\001A*\034\274\006Gz\231\"\270\023\322\3705R\351EC\255x\321\351"
+	.ascii	"5~MR\212\227c\323\002\211V\\Y\3315\2639\347<\225o\226\256(\301"
+	.ascii	"2!\277f]\225\227\216\032\337 \247W\224\322\257\361\305\340\264"
+	.ascii	"\261\251\033z\367G\316\230%1L\032_h\227^\037\267\273c^L\224^"
+	.ascii	"\215/<\222\376W,\314\f"
+	.string	"\306\r\035YGH\027\350#F\217\036\227*U\346\020\024\002I\377\253\3437\307\335q#\027\205\310\215\306\037\254\006\324\026\351\371\325\201\267\306<\211}\375\346\260\200#\310\034\204r]_|\215\257T\317\357\027\004rl\ti|o\\\034\266\371\273\333u\246NN]\013\270\273\306\027\202\245\267\277CW`\177\207\376\227+\260F[\326\236\226m^-\2537\0023+\177\254\242\004\001\363r\311\301\2056\256\r+O8\004\033_\270Lo\233\027\353\nnF\227\226\230\337\253\263\n\031\217\"\327\352R9\021\334\362\243\361\357\324\235\361K\243yi\\\2524\347\254d\346'\232\0354\242\004\001\363\324\362\303\177k\374R\331h\261\261\306\244\361\305X+\377\2058ef\364\336\032?%\223\376\267\357\037\315E\313\234s\324\311\314K\243\033\364\267\267\247\265\037~\034{\355"
+	.string	"\376\343\234\217\2005\347\"9\274\234\263\r\223\216!)\252\201A>\361r>\312RR \013\352(KF\022[\026\324\205$\266\254\254<\342\241\274\260\314Y\312$\266\234/\034\035)C\300\202Jb+\312\027\222\3302TfQ\005\312ff\2262\037a\345\013\371(\027e6,(\f\222\216\262\240\222\330\212\240.$\261eAe\266\254l!\037\025-\225\216\362\362Bf\313\002\223\331\260\240,$\261aA%\261ey\3312%\034QQG\360\270hX\265\244\243\354\324DU\264\264\200\227\304\304\312Zr\266oHy\231\361r\036@\316TXK-E2\354\234\021\236\223\221\221\",\313\3149wh2\322\302\312GxJ\233\361\222\310\260r&3\n\312M9\347\274"
+	.string	"%\023/{Y<\345\026UfB\312\331\202\314\314\271)g\245\315x9ge\316\231fI\305\314\231\206\205$\260\246\246\234\247x\2322\225\222\016)\347~\323\233\203Jb\323\302\352\241kc\003\313-\230J\233\304\204\225\301\262\226\254e\312\246T\313L9g\353\227\202A\275\350\2731~e\374W\252\3710\227\225\336U\343kwP\253\244\3477\306\334\022$A\030\226\312\025\266@\034\215\257\322\016\252\013\230\250\013\325rA\312\314~\241\352\032kye\356(J\343\377.\357\023\215\276*\265\306NN\226|Y\032?UK\377\337\245\353\342&\335\026\227\351*\331\346m\272,n\301\330\267\343\333\324K\256\321U[\246HX$\361\345\234\337\313\213\304\004f\003\271\226\370rf\336\246{\324\312\313\234K[4\007\371Z\320\314\025\027`\267\251\317\264S\216\222\231\2376"
+	.ascii	"\245%V\2263\223g\003\035,\177oNr\360S\250\3644g\322\323\200\271"
+	.ascii	"E\226\315\315+\260\361i\236\244=x\263m^\3453\216\r\327\334[Q"
+	.ascii	"\343\025r\316\331\336\016\245\271\035z\232\267\3644?\322\277"
+	.ascii	"Y\r\350i\256\322\277\313\214\271)\203\2445\243\361\255]\037`"
+	.ascii	"\363\201i\247\234\233\263\025\031\2601]\244\235,\336\024\004"
+	.ascii	"\204\224\371k\300&\323bl\263\307t\230\267\007=\246\375Z\231S"
+	.ascii	"\304\314K\232#|\177gZ\t\227\024\301\032|\324Kz\024KztJzTI\312"
+	.ascii	"\323_.\320aJ5my\351.]\366\336\\\\\f\t\203\2441\363\346\351)\007"
+	.ascii	"\226\336\2264\214\022\032E[\264h\021\203\024\3268K\021\325`\213"
+	.ascii	"\306G\335\322\260\261\016B\002i)|jz\361\305\r\251\002k!gV`-\304"
+	.ascii	"\354\212\017\314I/\321\261F\243\247\255\341\256\3322-\222\307"
+	.ascii	"\304G\304I\256\353H -\205/\214\224:L\354]H -\205Hy_M[\227sd!"
+	.ascii	"\037i\315h!hT\026K;\351\264V\313\253\301W\245\2434\226\316k+"
+	.ascii	"}\245\357\372ISi(\335"
+	.string	"\244\2474^3i)\266\331N:\311[I\333\305\261M\361\265\223.\322G,\336[.\212\302 \f\314\217\214\006\207\220.3\030\340\243W\351\311\264\032\3207\261;\350\321\250\364\357:\2727\265==&\026\313\202\244G\3175\022\024-\257\353I\343\243\312\364g\231\2706\242\363\327\024\006K\343\237_:N\257\337n\310\242\236x4\376\t\245\335N%\351\317\270\364'Z\3723,\375\331\225\376\255\326L\260\036k]\032\343\351\334\2341\313\263\321\370\347U\3723*\375\311\"=\006L\217\271\244\035\330\035\264\313~`\026I\222t5>\256Ko\233\r\344\007ZeHn\363\361\376q/7\331\203\316\0169*[\215\233\254\225\203rP\354\032_\214\320\206\311\227\226\224\306\307n\351qYz\246\335A?\327\203\207\030=\255\026\215\233\307\337;\332\bM:\312\"k\214\332\035\264s\364\274u\\-Pt1\032\237\375\345\365"
+	.ascii	"\270\245T\343\277\275\272\313\376h\022b\2451\317M\024\300<\037"
+	.ascii	"\215o\343X\234\001k!\b\326UM\303\326]6\260\324\215\210\013\276"
+	.ascii	"%\024 \237\340o\341\254\031\026J`I\177\217R\240\035R+s\240,\344"
+	.ascii	"##3`\366\254\250\225\227\r,mA$\251\247\253\372EK]&\230\211\346"
+	.ascii	"\027\276\267\247v\312QZ\310Fyd\300\232\253\265\032"
+	.string	"\253k4\216\266\3217:\253\251\332\252\267\372\3126\273\252e\364\f\313\314IaD\214\350\252v\321N\227\tF\343\246\025rc\215\317)\035\304KOHR\343S\312\273\034m\205\3355>\243\330\2723\253:'\215O(}\304\006\316aQj\270\333\346u\005\255\361y\274\224(9\235\320\361\371\351\\i\356%i\362\323\t\022\225\034J\032\237L\316\"\"M\027\203\215O\273s\211\337\213/K\256\031\215\034c\234\360,\353\352z\352\362\316\312\210 y\322\324\370\034\314\314\315\025\345\235\225\t\225I\226\214\341\223\223\273n<X7\357\314I\252L\030g\305\214U\025#F\260W\223\223\024 \312d\243I\213\306\347\220\244H\221{\025&\226w\006x\267\230th\215\317\241\355\355-\325\201%H\006\244\255\355^\305\255\345\235a%\262\2660\\ll\327Mk\207\223\224\2244&7\032\237\303\324\211v\242\235kH\326\362\316"
+	.string	"q\260\364-\211Q\373\271\226\2236W\006\257\361\311\354\275\033;n"
+	.ascii	"i|\246}\360r\221\225\304a\351$\373\t\344$;\317n_\004\354\216"
+	.ascii	"\320\b\202U\366\363\354\247\231\210\021\327\313\311.kL\343S\310"
+	.ascii	"q\334/"
+	.string	"\314\231\212R\307\327\370g\220\363\307\351\203\003\017\036\247Xs\206\223\224\275\222\245\217\353\f\373)v\233KE_\032\237`\326\212\215\025\034_\254\032\237=z\017\313\237\021\275:)O\202e\032\177\303\230S\307\251\343\312\361`\335/byg \006\371\032\177\303\225\023\307\211\343\374\232r\222\022Bq\351\243\363\372\371\205\212\341\355\371h|v\2350\232\240\350\330\320$+\353\344\342\301R\202\201@\032\024\216\202E\347b\353'\327Y\204\225\030\325Ui|j\265\322J\226\263\256\013\344\b\225\266#\215\277\241YUub\r\251\242G\226\243\334[\332\272\372\211\205\267\260Pza\205E/\020\317\352\314,\312<ak\374\rZ5j\2343~\217\262\225\036\030\272\345\214\314\252\3617\034MM\2353\320#bygiNir\347\214\272\253\007\004\257\207\236\224\224\007Q\\\372\312\274\314XQi|\rK`\300\270n}\\\372"
+	.ascii	"\033G\037\337\221\306\327\200#*\352^\331\265\374\024\201:=\262"
+	.ascii	"\262\264\300<+?'\247si\327\362\023O\2240-1\300K\3675X\346\351"
+	.ascii	"\347\262\346F\r\345Y\343\213\021\342\215\031\363\226"
+	.string	"\227\224t2\331\265\374\204b\351GVf\243E\216H\327\271\364\223iN\352\353tq\303Tf/.\224\204}{\\\216r\214j\200\341h\374\fn'\322\211\204\225\031\302\212\362\316r\244\316D-Q\2359s\036\331\265\374\264\201\354GV\206\377\250\204\315\235F?\217\256"
+	.ascii	"\n*5\306\203gQ\016%2\306\316\242S\331\304\351.G\026L#N\211\223"
+	.ascii	"3w\222\033+.\032Y2,\311\220\301\202v-?\331\246\227\223\024`\026"
+	.ascii	"A,'8\360X\220\346\007s\312Xc\\\306Z\261a\372\021D\356\307\r\032"
+	.ascii	"\034\240r\320\317\017\377\331\265\374\224\243\205\346$\005\230"
+	.ascii	"\363\324\207\013HI\323\361\207\307,\215)-5\306bp\252h]\271\322"
+	.ascii	"\370;Yp\230\235#^\274`0V+t\031\204\342"
+	.string	";\006\203N\001&\315h\214\277\3540\365~=\274g\327\362S\206$\314*h\200x\351\254\310\020.\307{q:\276\340\302x\0046U5\376\216\r(\307xP\260\226+&\315Jf\236\302R\202\351\200I\031\2345.>\330\362\216\265\034g\0211\342viU\227\013\263\306\030\313\025+\270\312\025\203s\023\233\321\030S\271b/\362\002f\212\r\232\035R^c,\305\336p\302\253\022\345\027\336\200\321!\365\325\370;T\351w` 9\246C\202\237\334\274\233\254\\\313O4qB\200\224\311Y\372\222\305\245\344\370\311\261\023\021#\336\305x\243\255\2551nr\353\345\327\226\304D\030\266g\344Lc\274D\001Uel\b6>\266\373/\254\351\252\262\303G\343\266\267Cq\222n\252\363Q\325\030\327\375\213\021\265.*/)ZyF\215\361\234\260\316\212+\253\361i\212`\251\001\326\370\030\3060\217\331\230\370\b\017\226\262\257"
+	.string	"Qh\3748\003\230\223\246>\3508\351\352\241\007w|\344\330\210\210\021\207\202U\306\213]\343\343\"8\356\027\326\214q\261\001i|\fL\322+ ]\223\202\202j\214\335\360\033\022#\251\030\215k\264\320h\361\327\030\023\301maHO"
+	.string	"\033/\265\230\005>\331\305\2403\213\322\030\257\0357\177\2410\252E\217\272\364\307j\277\360>i\261\230k|\fE\322ch\242\035\355R\361\244yH3\007_\316S\037h\264t\301R\327\370\030\306z\364\300g\035\330\334BN\353\213\357\276e\351bQv|\206\315p\302\214\220,\033c!'\223.\006\225\306\307P\003\007\301@\254\225\272&LA\032\3431\374c\310\230Z\026\376\201}\324\311"
+	.ascii	"\262\206\227S5\272%\026\230\31429\337\374\314\324\360\006s6\226"
+	.ascii	"\210\205\t\307\2041Y\t\303`c0\266d4\006k\031=#))\006\216\270"
+	.ascii	"\306\307\260\224#\007\336qe\363\302p\304\320q\274C8\343\214]"
+	.ascii	"\334\231\0337\260\027\223\216\236\020*K\272\216\275r\256\004"
+	.ascii	"\215\2644\3068\254\0250.]F\262\336rWV\343_\340K\255\254\360\026"
+	.ascii	"\017\326\315s\341$U\226\363\324\207\232)-UxZ\307[7]{{G\215q\326"
+	.ascii	"\025\323\201'%\2511\266q\305n\221/00\326\177\341err%\206\257"
+	.ascii	"d\274\275\321h\374\013w\351/\310QQ]7\252\032M\376\346\032\377"
+	.ascii	"\202\027\r\032xj\004S\024\263\213K\343_hJ\261\024\226\302S#\344"
+	.ascii	"\261\275(A\300(\\X\262d\034Oi\311PV\001\003\003\306%\303\314"
+	.ascii	"\f%\302\313\024\0077Z\264\316pA\211\212\272W\235s\316`4M\306"
+	.ascii	"\202\360Y\001\234\352k|\013h)~\302Ox)\314\031\f\2111\2341\031"
+	.ascii	"P\201x\371\213\030\361a\b\231\237\227\306\267\340\225\376\270"
+	.ascii	"\t7\331\272\021\260\212\242\n\340'\2265\007\230s\023\016r\250"
+	.ascii	"Z4\0056\276\316\231\364\307KM\274\324N\226\231\237Np\321\271"
+	.ascii	"K\177\334\242\005V\032\001+GA`LMK\f0g*\016\322\033,\266\f\301"
+	.ascii	"I\266\215\331T\322\230\231a\n\210S\343\353\320\245\230\005fq"
+	.ascii	"\335\316\036\220U\307D\303F\330\350\272\305\331\036RyW\215\257"
+	.ascii	"\34358\210\225=3hbH\231j\322\370\307\371X\331F\222\\\001I\373"
+	.ascii	"/\274q\021\225\304\252\361u`\2301s\335\276t\021\262x\022\264"
+	.ascii	"j\374\0343i`\340uK\263\315Q\225\263#\211\211\213\306\317\331"
+	.ascii	"K\311\220\271W[\316D\t\226\261}1"
+	.string	"\001k\374\234\273\364\357\357^\245\271\271\343\206\034sH\343\347\310\245\377\025\323\274b\256Z\257eeN\217\271\2773\2009Oqp\343\202\031\306\327\3709e{\327o\357\366uy\227\333g\3632\347\251\254\364\203\200\017$7[``\234\274\374\366]0\330\213\305\215\273\306_.\037\r\023\017\270\334\37094\276\220\375\027\242[\310l\264h|\0342\351q\350\264\\=-7*\210)\214\307\022\252\221X4\022}\210\214*j\210\307u\210U\237\232\007\201H\006\255C\241\020\306\243\220\320\361\307\002#q\210\\\223\306\343\217PU\221&V8\341\202\212TW\025(\203Q\035:\346\254*\n uE\036\207\206\210P`0\241\001\021\222$\024\213D&\222\304\024\214\304\242\221(g\005\320P5!IB\316\205\240$Q\361\306\250\026\221k\022UW\"\322\004\352\272\002\004\013?+\321P\n \0259\fB\001d$\246\310"
+	.string	"\224\202\204\344P-\252&\b@U\221&\002\240\236\200\210B\265@\207\342p\347A \200\324\025\251&\215$$\211>@\310\341\017P\362\202\317PR(\304PR(\271\"\217'\324u\370s,\026+0\224\024\332\200Bg\305:$$\302J\024J\032\207\310\023\212C\"RE\221$\002\340A B\034\211?\306\025\311\n$S\004%\207\305\024\027l\326$\222h\302\202\352\303!\251\026\211&VUE\007$\021(\005!\344q\035\032\211BH\365\204$\321g\035\246\b\200\212$\032\302CB?F\344\232\244y\320\212\241\037!U\b}\020\b\024\210E\2405\031B\005\"*\376\030\211!\220I\242\020\033\212E\"\243\361h\244I1T\213\330\004Gd\320z4\322\024\217+rM\242krX\302\220\006\326\025\324\f"
+	.string	"\031\211)|t\220D\240\240\0375y,\376\340d0\252C\307\024>\005\020:\036MH\016G"
+	.string	"*\036G0\016K"
+	.string	"`UU"
+	.string	"\021\005%\211F\2658\244\232\240\342X\302\252Z\340A \200\210C!\326 \025\304b\n\036U\210\270\016\035\217%"
+	.string	"\021O\254\252\n\344p\275`TW\022\220\352\211\244\272\256"
+	.string	"\001\251\002\r\325\021V\030b`"
+	.string	"I\241Q\035\322"
+	.string	"\206b\221\310D\006\025\307\022\200\214\"d"
+	.string	"\262P,V@M\016\221\"X0\252C\032\020R\327\344\n\024\252O\222h\035\256(0\030\016\241\320\200C\n\310\243\007@H\022\003pBM\036\213%x~\220G\023\002\bJ\022\025M\204\260\243\302HD\256(,X\221\307\02378\031:"
+	.string	"\261\"\207C <\2508\226`$\252PA"
+	.ascii	"R\327\244JT\002\325\204\0259\\\223\252\t\001XU\037\025F\"r\030"
+	.ascii	"\204\002\205\022\352:\\Q\250Fb\tE\344ZBh\250\"W\024\027\250>"
+	.ascii	"&2\320\224\240a\365QO@L\242@\310a\211\020P\344\254>\026\200\324"
+	.ascii	"u\250\"K\374\020\221\252QU\221~\001\037(\340\003\022+\320\234"
+	.ascii	"\204\003:p@\007\350I8\240\247\307\001\037\364\244\377\240\347"
+	.ascii	"\256\030\216D\016+\220\253*\244\026\325\225\003\206\024\222C"
+	.ascii	"\f\030\217\304\365\307H\224\342F\365!a\303PR("
+	.string	"9\244\342\202\272\016\221@DC\024|6<\b\204"
+	.ascii	"\222>*\210)\214\307\022\026\216\304u\210\364\031\242Q\177\210"
+	.ascii	"*\250@\350\317\317\320\007\by\374Q\2215\353\203@\204H\"U\025"
+	.ascii	"\210H \017H\225\230\202\270\032U b"
+	.string	"M\322\347\246\003+\362x\302\202ZDax\202\n\250\352\243\002\0351\260\"\217C5*\320Q\b\253>\032X\221\307!\234\244\361H\\\207\2164\352:4\001\210h\210B\252\236\200\210B=\001\021E\272\246\310\033\240\241:B\2218<\001\251\246HA\004\302\n\353\rr=\241\252@T\177T\023\212C\"RM\362\324\f\327a\b)\374\fQ(\026\207%V@\346<\b\004\020r\bd\034\256I\237u\230\342\203z\002\"\n 5\205\237\341\020\272\372\254\303\024;\252\320\320\250\026\211)R\024\210\310u\035\242@\252\nH5\251\232\260\032kV\037\022\253\221HD\223\fZ\215\352\t\030T!\342\t\306#q\035\252\310\237\033u\035\206\220L\252??\025X\223\303bN\220\n\342\b\026T!\342\t\352:\fA]\211H\017\254\311a\021g\365\371\240\307\004\307\022\220\352\232$*\226X\223Hb\n\035\3440\350\007\177"
+	.string	"E\232\325\007\271\236P\213:7\253\017R\0052\346<\b\304\217qEr\030\342H<\300\217C*2\304z<\"C\330\254>\037\364\254F\"\315\n*\220\221\204\025\310\325\250\326\254>Hu5\022\217'V W\243\bHb\b\034\212\303\037brE\320\211d\006\244\nd$\232X\201<\256?*\222\030\202\212c\021\303\352#\302\203\325H$J\221*\nBD\031P\213D\023*\216%\254IU\005rX\314\240\256\3035y\256>j\221h\"\231b\035\246\030\336\274\247\247\004\006\034\310\200\005\322\037\020G\242\317\nG\024R\370\031\026Q\ba$\016\205B\374 \223!@dP<\036A\3609\377\243m\347\222\313\013\0240\"'SJ\306\016\006\031\266\363(G\214\025\220\033Mt\315\250\206\216\306L\235\2543\\pgg(s"
+	.ascii	"_\346\376\316\240\314_\304\b4\255\353\2522\2174\024\355D\026"
+	.ascii	"\026\200\227Y\303b0\220\n\035\322a\242\314\366\344\322\0375\303"
+	.ascii	"\2025XV/\266P!}d\240\312\004!\353\341\324CL\3319C\311\312K \220"
+	.ascii	"\363\257f\312\f\217(?\274\032\020\247\205\346\003\357\320\331"
+	.ascii	"\201\243\210\031\031>+\363\325\244k\354\310Y\324Y \032vT\254"
+	.ascii	"O\312F\215\306h\017\024\f\bX\221-\357\342el\257\016\2551\272"
+	.ascii	"\003\345\241\323\005\006\227\344_\316\247\003H\006\250\247\003"
+	.ascii	"?q2\013\274\3219n\016\035\0326\270\\|a-B,\301( ^x\017\377\360"
+	.ascii	"BR\353\272<l\262\264A\201\303\201\301\340\024\335\255Y\271\321"
+	.ascii	"RjO/\310\250\216"
+	.string	"\332\240B\267p\260\224b\020`\366\325:nxu\241[G\265D\214\270\235\220)G_\032\037\315B\257\216b\375\302\233\033UE]\032\277C3E\255p\304\200\371\221\325\030\255\352\200\226\376h\215+\003\210\332\026R\323\330\332\022V\226\2431:\325\250\ft\306\321\2513\321)\001\b\352X\233\201\016\215\270&b\250\024\376\303y\303\242\002\030\343tb\243\006\305D\007\303\326\301y\301[z\321N\235\027\205\311(*\357T\203\021\245\b\205\302J7V^,\260\240\313\233\226\226)Y\326\241O\\R\257\246\0206\324\351\004\343\006\2306\2431\312d\323%\007\035W\343w\030C\227P\026(\013T\311.\227}\t\260\363\373\342\003\314S0>\374h\322Q%\244\2750U\032\243-n\027\b\227f\2451\212t\273;)ZW\357\340\224\376\350\321\035\242\004e\0205\302J\235\314Tu\204\026\271\201\320\307\304\245\274Lt\370"
+	.string	"\305\260\241Y\254\205\030\2751\007\327\322!I\372\216\316\234\241sOimf\316/\241\331\224:\034\202r9\200O\256(\005\252\221u\341j\236e\2600`5\347G\206+\257J\313\214\306b\304\234\177\033\300B\243h)\305\215\371\371Ww\303\225\247C\213G\320\317\357\234!\304I\352,,\311K\225.]N0\035\330\334\"\216\313\214\017\347+\006\217\026^~\202\341\373[\242\303\302\367\005C1\262t\205\353\214\223/G\256\374\312\311\305\256\345'\017P\321\022\233"
+	.string	"\020+D\364~r\271in]A\2624>\261\234[\3161>.$[~j\301{\"\225\345\324\341\355\tT\226\313\002"
+	.string	"]\222\216\360\224\335\335\235yw6.\332\230$R\252\374\314\023~\005a\362\321\370\244r\215h\376\266\246\2145>\361.\020\033\"[\001\205\210\250\323\361srT\266\205 H\2411\312\320\320l\222\f\007C\026@ @L\034\227i\353\256\017\023"
+	.string	"D\314ku\201 \307\230RFfDD$I\222Ls``\264\312\021U\210\233\336$\366\246C\033\343\270\230"
+	.ascii	"=\222\236\023M\3031\333\"\021\225\341\270\214\221\034H\301\t"
+	.ascii	"r@\0324\342x\207\360\312\240b\r"
+	.string	"\274\3761\300\270\230\303\237\337\017\022\215)\310DL\310\342\2044\343&\231\032\315\033\b\267\262&3Ti\230\276m\330\022\326\224\36136\303\200`%\037\242\264%GnD^\350 \354\330\323\f\034\226\305\315\255\355\300I\333\360\253\020:'\005\025Qh\346S\022<IK\276\366\340EN\234\276\0248\037E\365|\274?\017\034\035\030\036\344sq\314\177\037\f\203J\302-\330\223Zy\266\024\256\005\354\307{\202\031/\316\177G\346\260\207\235\312\325\344{\207bm,\302X\263\237P\245w\354+\246\306RO\317$\371\005|\233\2203\227\210-\r\240c\365\215\217\350\305\214\004\rM4\332~\306\213\347B\363\345\257~\274\304\306\007g\006+\261>\223Q_\260\037@@\324\007\223\311\031\023\204\270a\261\205\2028\022Q\345\312\213\037\023\310\271\202\036\267v\345\204\347\360:\271\372\216\360\221\313\233./\363\361\024(\226\377\314\b"
+	.string	"\367&q\222P&\016\nk \207\2378\246k\373\b0\233b]\303hDH\204\003<\226\342\341V\037\362\027\027\263\231q\\\264\003t\340\005\374yA)%\216\254\325t<@c\346\033\030\244\333\335\331Po\257\257\225VMN&\271R\301\034\036\"\tY\004\346&UW+\364\334>\357\310D\367\243o\f\"\363\203@\204=\344\177\363<\212\353\220|\251l\r\321\207\005J\316\211y\332\"\206cw#\271\200\314g\006\303-\177\341\223St\350?F\312\030\276\252h\016\271N\300\366\303-\304B\f\345\337\3423\234\200"
+	.string	"\231\247)\323\346>O\301"
+	.ascii	"\226\256\247d\306Q\342\302\n\037\212r\2233e)\0258p\231l\210\307"
+	.ascii	"\221\fN\257\037[\366\253\032\331\341\262\003\177\007\3413\324"
+	.ascii	"I\321\2156\223\326\017T\264B\037> 6\360\224\327:U\352#]2\222"
+	.ascii	"\036\300\001?\244\335|\375\303\030>\257\225\314\307?\317\t\344"
+	.ascii	"s\241.\253\267\232\004\261k\302TzeW\376\270\354\326\315\243\354"
+	.ascii	"j!\232\340\3561\025\311\004g_\271\336\377\303\356\346\346\236"
+	.ascii	"\313?\231\177\234\357\237\365\275\263\266o\326\365\f4\376\001"
+	.ascii	"\316\\-j\376\263\214\332).Cxu\316K\324M]\216\321\224\177\370"
+	.ascii	"\277\f\364.mF)\246\300\262G\264\313H\247\204\347\352b\226\277"
+	.ascii	"\252\323\002\362P\n\036\\p\273J\242\325f]T\200\212\325l\334\026"
+	.ascii	"\311\323\225F\262\233\347s\351\244l\235#\261\243o$\220"
+	.string	"\307\261\241Hu\024\030\213\210C\305of4Z\217G\004P\005g\006\327\3007l{/\267\3072\311~\251\206\224\311\335N\rQf"
+	.ascii	"\035\366a\307\017\252\257 P\224\351'\375)c~\250I\314\261\272"
+	.ascii	"\2406k\003GW\033\212\354uF\013 \374h)\366=o\b!\2502\007m{:0j"
+	.ascii	"4Q.\200N\2018EB\303\343f\2149\220\3274\336\320\236\\\363\222"
+	.ascii	"\036\322\315~j\376;\360}\032\344\311\263\224\332\250\243lL,\212"
+	.ascii	"\034\214=`\256\f\325n\023\177\223\266\321@\231"
+	.string	"\275\"\265\356\026\026s\331\225U\300O\222t\246S\335N\024\326\036\0368\263Cl\314}\324\262:\212\334\037\350\027wl'\343\215i\313\374(\332\206\302H\300U\230\031,\362\223s\352\213\325\2619\206\2513\230\322\207\233\320q\316\372\312\031\200\336d\203\2132B\331\355^\257CfgQ6\324\036\016\034\216\361\221x\fq\257\251\316b\367\305x\337%K\215\323\357rnG\322\2431o\024<1\017\345\341\343\376u\211^\356\227\004\226\246\352\327U\303\202*5\212\233]$\253\370\367\246.\352\224\270)a\341\340G\016\020\306\203\016\257\304\256\376\032\217\336\372\2255\314\265\252\325n\024\361SYw\351\r$+\373]M\376\366\365[\2661\235\032P]\375\225!_e\f\323\353$Cr\bi\350e:\360\320\b>\247sU!\317\205\354\251k\317\363\205$\322g\226\230<.Hx\350\261\016\231/b\251\256\246\334\354\364"
+	.string	"\322\241\315\032_w\243}}\025\330\234I\350\004k\324l9(\251\251j\231\354\252\305\221\237\362\243@%\325A5{.DN\277sX\007\351TU\370\314f\2315\252\037`F\330J8\337C\216Y\026DyO\242\365D!\340h\341\226\307-7\241\332[ _\272\272_\002d\210PZ\023\272t\223\330\0320\353a\212\377J\tH*\270$\362W\227\2558\261\215f\227\221\001I|\026\366"
+	.string	"\003\006sb\207\032\352\r\267D\213\237\007\024&\352\222;\027$:O\210\017M\271u\317\271\351N9@K\332Z8{p\"\276-V\020\3239\005n+\373\243\211uZ\347\314\203\226\035\342BZAP\277]\007\374*V`\333\245\227T\327\257\276\246\200\300\002\017\327\260\337\335_4\331\342Pl\315J`S3\325\032\331\035\251\236rj3\273}\026\356$\242s\366#:8.\0027:<\375\241\247\323(\006\237\272\020\377\277\224\001K\221\357\020\203:Y\261\267\217\355\024\022"
+	.ascii	"\034\216\034*\326\022\007\027>\375\376Mz\3570\352gK8#\021\361"
+	.ascii	"\203bU\330\305=j\225\001W+H\253Ha\333\034\217\024%k4\025\251"
+	.ascii	"*:\333Z\232K\254\006\375;Fkj\013\356\253:\n\255\t\f\370\204\227"
+	.ascii	"5\373\306\031\353M\032R=\017Y\356\312\025m\306\307\013F\231\""
+	.ascii	"d\001Zne\361\303D\005u\223\007BT\002s\260\266\3778\345\021E\256"
+	.ascii	"\370\bM\\\361Y\304\343\375\020\326\n\225\212\264BSf\200\365\350"
+	.ascii	"\255?\357_\367\330\270S\317vL\2342[N\016\275\356a*V\345\211\356"
+	.ascii	"\323u\266\374L)\210\355?s(q\364\267B\366\335\274)\331B\265,\004"
+	.ascii	"\246\004\367'\254u\272\021(\306Nc ~\b``\310\027>3][8G\354L\265"
+	.ascii	"\346\022O\366\265\305[\"\274\240\321$z\025\265\373\361g]\273"
+	.ascii	"\326}?\375\226\2629ew\223x\002\350;\322]\211\261g'~ \255)\022"
+	.ascii	"\2466\243\242d(\205\202XP8Z@ZUf\020\242\217\367\306o\217\310"
+	.ascii	"\365\365\016o\253\317\035\313\207jo\001@\026ot|\337\261\335\276"
+	.ascii	"w\341\340\212\277)\2057\337\0349\036\016F\220\267\234\262U\377"
+	.ascii	"\252\2135\352\"\334=\2431\253 \033?\303bf)D\340o:\034\2576(T"
+	.ascii	"qi\3778\037\025\321Uf\007}-\271\216\306\214\203\240\241\362\346"
+	.ascii	"\223\002\335\013%-\202\330\334\327\275\237\rD\003y \354\"\327"
+	.ascii	"\327\215\023,\251\275|\306\355\262\263\25327\261\274\313\347"
+	.ascii	"\352\340D\254P4HH\272G2:\226\335\341\031\035\362V\271\027\352"
+	.ascii	"\265\300\321S\017\033\360\227\373\331\013\221e\216\001\035A\317"
+	.ascii	"\261\202\263\223"
+	.string	"\005\235\231lI\t\337\302\214u\350\347\265\204n\303\245\240\335+\255O\325\330\270\272\224\273\244\004X?\250\226\204\202&\301\372\334\313\312^9\353\177-\t5H\030\275\346\216\t\243\017\006\343#XDq\013'e\300\347(x\232\266~\001X`;N\353\316\243\016o\255\305\353\004B\255\214\3425Xg|H\353\322\232\275\321Y\341\356\357x@\017\004\005\241\335\301\321\337J\007\214\031\204\024<\013~n\344\205\006\213\fp\232\376\233,\255\240\215\205G\022\274A\332\356%\240\ff2\310+\201\357\003\301\334\331\2562\b\335\267+lu\340_B\254\007\022\301\215\"\\)\334\336$\324\301\t''\265u\021\356\247F\376\271\346\361\230\326\232G\373\300\361\335\251\220\265\275\003402\213\217\355\230@H:@\226\360\200K!\001\315sNfB\354\267\317p\177|5j\367\3735.]\177\200`DCaW\t{\350O\201\233"
+	.ascii	"\332\013\314\311\005\036l\353\252\313c\313;\004\314nDS\325\b"
+	.ascii	"\342\352\t\232NM\013\331\354\221dJ\033.\342\251\224N\252\373"
+	.ascii	"5\001\022\373V\372\340\323m)\243Ew\232\251|\300\216\237\374\347"
+	.ascii	"-\361uvQbw\337\347\252\326\200u\007w;\307MZ\336\"\026\233\363"
+	.ascii	"@\302b\347}\253\216T\375?\022\344\364\351\306\317\343\003\246"
+	.ascii	"-\366\250\0012\003\320\357\013\331\f4\370Q\267\313C\236\013b"
+	.ascii	"\376\204S\341E\224r\326\272\265\246\032\f4sF\247\321\376c\375"
+	.ascii	"S\3111P\323\002\245\205\177}\310\376\"*\257\360\226?\350\240"
+	.ascii	"\366\277\276\214\310\377\250\261\016\357>]iQW\230\272ts\220\263"
+	.ascii	"\371\030\337\3527i%g\371\231q\207\241=\030\376\315\365\233Hv"
+	.ascii	"\336aWY\315\262\326\207r\335u\322y\324\313\316L\344\260\2154"
+	.ascii	"\276\340G3\374\247\360\374\267\242\203\376e -\310\036?4\277g"
+	.ascii	";e\363\20618\300\376n\261\007\237\374W\277\034QVoY\210\345\255"
+	.ascii	"\003=>l\2373PQ\377\207?\027\231MB\367\025\311x)/\260x\201\001"
+	.ascii	"\357\306\317\335\234}\2440\220.\372\034O-\207\315\373hf3\252"
+	.ascii	"\354\223\357>ChY\255Nl\3415s\333r\351z\313\315\226\036\3056\317"
+	.ascii	"\024\274Xsg\365\247\277\332\216M\357 V\374L\346Cp\371hy\261\353"
+	.ascii	"\334\271\224{\023\263\236N1\277-\323\017\325X\226\311-3\333\367"
+	.ascii	"\030\246\343\364\367\025\373h<\223\365r\2601\016b=\253e \316"
+	.ascii	"\237*\340F-B3I>\370\276\207A\030\276\342P\372\0169\223o\273\317"
+	.ascii	"\036\357zp_\354\371\233\235\232\204\25569\237\207\234\253\324"
+	.ascii	"F\254\357Ds\023\347\301\005\353h\302\315\371\023\3772\037\321"
+	.ascii	"\230H\314\306t\356\327\0258\302\266\201\373\374@4\327\244f\253"
+	.ascii	"i\247\001{\344\340\373E\342{\311_B\331Y\222\233jGH<\273\362|"
+	.ascii	"Y\302\203\310\261\375\317\313\345\0130\331\236\237g\247a\345"
+	.ascii	"H7\037\235\337n\r\3026\244\253_;\277\376\374\317\002;\017p\320"
+	.ascii	"3q\207{\3576\205\354\235\026\262\200\313'\226v\246\2757\303\023"
+	.ascii	"\252\027H\341\257\016\017\345e\362\353V\333\236\003\313\207\347"
+	.ascii	"\274\227U\377t\245\300\033\232\335\275\234c\367\032\347"
+	.ascii	"i\017]\001"
+	.text
+	.section	.gnu.lto_.symtab.5c7948ff1e8ebfc,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"blackboxEraseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"isBlackboxErased"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"blackboxDeviceStreamCanHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"blackboxDeviceStreamHasRoom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"blackboxDeviceStreamRestartRequested"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"afatfs_fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"afatfs_fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"afatfs_chdir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"afatfs_findNext"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"afatfs_findLast"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"strtol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"fat_isDirectoryEntryTerminator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"afatfs_mkdir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"afatfs_getFilesystemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"afatfs_findFirst"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"flashfsFlushAsync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"sdcard_isInserted"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"sdcard_isFunctional"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"flashfsGetWriteBufferSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"flashfsGetWriteBufferFreeSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"afatfs_fputc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"flashfsWriteByte"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"afatfs_fwrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"flashfsWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"afatfs_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"flashfsEraseAsync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"flashfsClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"afatfs_funlink"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"afatfs_isFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"flashfsIsEOF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"flashfsIsSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"afatfs_getFreeBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5c7948ff1e8ebfc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
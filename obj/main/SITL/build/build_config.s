@@ -0,0 +1,113 @@
+	.file	"build_config.c"
+	.section	.gnu.lto_.profile.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.c4921895a147f26b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c4921895a147f26b,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.c4921895a147f26b,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.c4921895a147f26b,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
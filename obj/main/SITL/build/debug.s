@@ -0,0 +1,249 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\363\234\321\333\003\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.64ff0861f153aeb4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.6.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375`7\t%/"
+	.string	"zV\370\022<0\252i\01603\323\231\350\254\022\217Q\274k\316\314\374Dx|\030\214+\021H"
+	.ascii	"l\247\020@itM\220\357M%\004\375m\273\330:`\212E\213E\316z\235"
+	.ascii	"$q\233&[\223I\006\030\001,\001\"\001p?\b\273\007\331\307\375"
+	.ascii	"\222\364\347\0216\033\362\343\346]\252?\2270"
+	.string	"*\351\366rr\2352\336\237\372\363\t\240\322\227\233\037\365\347\024:\231_\247\250?\257\240\311\354\353\346=\367\347\026.\231o'\237e\274\377\364\347\235\022\372vsX\031\357\270\376\374B$\262\277\223\341\364\347\030\034\221\375\335\274\305\364\347\031\026\245\217'\217\225\361\226\322\237k@T|\274\231-\343\r\244?\337P\210\354\363d\267\214\377S\177\316\241\357\370ysY\031\277\245\376|\013\020\362\365d\024e\374\205\372s\341^\212\327\233\3412~\272\376\274\303\037\263\337\223W\224\361\323\351\317=\3609\373\275\271E\031\377\233\376\374\203\035\332\363\311.\312\370\301\364\347 \350\322\236oV+\343\267\322\237s\311\255}\237\374E\372\363\256\267\265\357\233g\2241\216\376\334\353N\215\037$\333(\343\024\375\371\027\235\033?h\316Q\306g\177\036\342\013\004\237\353\227\243\203j\312!5n\242\330\330\342\037\362<Y\306\273?\327\277\2565"
+	.string	"`\273\315~\263\341\3548[\316v\333t\266\235}g\347\331o;n\313m=\233n\327u\355\273\215\267\373l?;o\353m\276=\357@[\320\036\264\tmC\\\033\021\210\344\033"
+	.string	"slAx\224\320\373P\322\315\202\034\324\322\013%\333,\314A(\375\371\356;v9x\244?\377\001B\3533p\017m\003\347\177\216\033x\243\376<\310\007\345 \363@\3759"
+	.string	"\2735\0163\237\353{\222m[Ssf[<M\177N\005\227l\023\312\334K\177^\205\347L8\363+\375\271U\235\224K\346H\372\363\2539)\027\020\253-\255kS\177\236\345\306\354\232\201\001\326\244y\311\214\372s-4i^s_\177.\240\f\331\227|\327\237\017\020C\3665\003\355\364\347\004\276\244\211\220\201n\372\363\002\\\222m\"f9e\f\034\323\237\033\310\2026\002H\245??`\2458\002(\244?G0%%!'\220S\022?\005N\326J\374\370\372\363\005K\222n%\346_\237\376\234\301Fr\366o\362\217\256?o\260\213\240\377\366s\353\317\035l!)\036N\376=\330q\332\007\346\225&\032UxE\016K\235\032]\270xl\3371\324\350\302'\332"
+	.ascii	"\032\331\276h\021U\321\227\200n\321WM\211UzM\213\3600\250W6}"
+	.ascii	"O\264m\331\023>M,}\232Sz\210\252\346\351\302l\213\f\203U\363"
+	.ascii	"8\324\322n\313\266-\n\027\215-\374\262b\356PK\033\217\ft[fL\240"
+	.ascii	"Wl\265\250\241\342\214\205\220\305\013\264\032*\2040\320\314"
+	.ascii	"\322\204+d\314\020n%\320j1\316d\bi\250\251\311\020V\351\265\214"
+	.ascii	"\035\302\356\231\276n\372\232\257\013\217\255\251\n\023\335\366"
+	.ascii	"T\240\177\316\273}\235\267\363x>\317\303}\334\317\275\236\337"
+	.ascii	"\363u\177\367x\337\347\375|\336\353=\337\317\037\350\005\375"
+	.ascii	"\240'\364\206\376\320'zE\317\350\033\375\243\207\364\222~\322"
+	.ascii	"WzK\217\3513\375\246\347\364\236\376\323\207zQO\352K\355\035"
+	.ascii	"\233\307\366\261\177l ;\310\036\262\211l#\373\310N\262\225l&"
+	.ascii	"\273\311~\262\241\354([\312\246\262\253\354+\033\313\326\262"
+	.ascii	"\267\354.\333\313\006\263\303\3541\233\3146\263\317\3544[\315"
+	.ascii	"f\023\032]\331\225\243\352\211<\2514"
+	.string	"\262E\337\327\004+\365\020\305B\213l\213\252\350idYu\230\032K+Se\215\255\026\252\206\255&\225\256\322-\252\036\207\250\330\351R\351\261\323|\335\240.\032[c\361\205O\027\315\322\350\360\370\246\257jN\351\227H\004j\264\230\276dhK\204_\"q\n9\346\266D\327\025#^Mi*]f\266X\032]S\260\"{\n\320Db:\314\322Yz\354d\325\323\253\213\353\353\204Y\324\322\356\021\314\345\372mY#1\250\255T\363H\006\267\350pM\211h\330j\266\0044\361\205[s\230\252SZ5\327\026}\327\024>\207D\026\0353_\030i\226\231\353\261\r\340r\335\262\356\212\272\360\273\242m{<\2634\230{\004j6\035\036\315\2675\213n\225\026{[\240>a\252h\013\027[\364M\255t\213\256\251\331\2760\333\236\346\225\276\322\256\313\252\260j\256ai\226F_\263\205\303\326T\354e\331\242\013\237\255"
+	.ascii	"\215|S\023f\033\006\247\357\032\200\237\250A \243 \267d.))(H"
+	.ascii	"!\303\030\300\")\232)\017\021\240\220"
+	.string	"\262\211\340\316\236\001j\233)B\032B\032\016Y\226\210\225\211>M\250\324q\273\261\026}\271\351#\r*\220e\243\224 \326h\371\247$A2\213\352!a\216\361\032\222\301\231\316\253\206\2652\272\273\346\230\b\236\323S\032\205\022\236L5\177ox\230\232j%Am\np\3720\013\366\270Bf\b\266\264\245\240\322\327\337(\024_W\366`\003J\177\240\362\350\031E\221\035DK'\207\030\001\342\353E\026\302\267\201\022\332c.\020\263\347\364N\247\357e\343c\366\246X\033\232\341y;'\021UT\nv\365\005\205\261}|q-\236S\232\025\007\277\323\006\347\203$vg\203\031sf\2179\374\034\266Q\007\212\217x\353\003OI\017\326\2420\247w8\265\031\016!\304\356\325p\r]>x\027\027\f\017\223\r\0168\272\214\335\\\306\033\344\322\303\033x\266\322\205@\032f\005\017p\006%x\2003(\301\003\034\006\257\373\302"
+	.ascii	"sm7\200T\026\364"
+	.text
+	.section	.gnu.lto_.symbol_nodes.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.64ff0861f153aeb4,"e",@progbits
+	.string	"(\265/\375`\373\tM1"
+	.string	"\212\\T\023E`\330N:?F}\327W\311\027\006\372\034\246\233\033c\304\036\230iC\001b\263\3336\203\355\210]1\215\256\023\257ek4\234V>\235e\235e\235MN\303\243\261Dx}X\027\325?\033g\231\027\033\344\376R\246\365"
+	.ascii	"*\001(\001m\317s?\2631\023~\262\323\274\367\351\336[\2008\205"
+	.ascii	"\026\305j\373\363\023\226\336("
+	.string	"\227\315\250\217\361i\365e$\312V\264c\243\344\252-\307\261\223\263\034\303\235\250\35075\336.\333\275\227\345.4\357ub9c\233{\235\214\314\r\230\033\330\265.\2629\325\336\002\221\243\353\271\311\317n\374vT\231X\321+\275\367\032o\326D\231xmO\344\243\232\201\217\352\271\355\004\336n\321}\210\b\242\214To\244|T\337\304\377P~\016\3613\210\237?\374\354\341g\016?o\370Y\303\317\031~.\372\371\302\317\353\317\025~\236\360\263\320\317\022~\216\360\363\203\237\035\374\274\340g\005?\003\375\374\363\363\361g\001?\363\374\274\363s\316\317\352\317\3753\3777\374\337\346\277\232\377i\376\227\371O\346?\204\237\263\376\207\371\017\370\177\357?\335\177\373?\357\177O\247\323\351\377\264\377U\177\261\031\203L\206\345P\034\321\0216\327\226\2470R5 f=\217)Jy\3669\333\002\3611\020\312\201\034\206}\356u>\221"
+	.string	"\340\263s>\205\001\303\315{\245=UqiZmY\220\2710\024\210\273\234\275\360\227\3438Eo\224\313\024\261A\3256"
+	.string	"#\325\346%\221\306\275\f\244\362t\312@\352\371F\337OT\304P\356c\300\237\016fl\203\227\211'\244\006\222\241y\266e?\336\302\320\004\374\307s\250v\310\246\355i\020\317\tT\236r\002\365I\342\317uP\256\343\275\242\322\236A\007/\023K\310\004\024\312\253\355y\357g)<\205\365\272\013\227n\207m\317z?[\341;\316\353\346\275t\352\222\273$fm\371\ncah\020\343\235\263\260\226\027\237\242\027\356\336\250\261(h&\210\264-\003F\252\326\005\361\034\244\0329H\345"
+	.ascii	"|T\231\312z\256\322A\314\271\326\366\206\217*\321z\266S\323\254"
+	.ascii	"p\025\266\355\313H\225\301\t\342Y\215\371\t\345'\323\025\225"
+	.ascii	"\367\362X{,\313\310\020^&\020\241\233\0356\266DA\261|cwiQ\035"
+	.ascii	",e\224\266V?\376\3326\327\372\036\242\036\026JI\333\032\233["
+	.ascii	"=]\264\316\316\264}o\375\035\244\205h\361\302\262\243-7\031\251"
+	.ascii	"\016\370\261\276\201\350@\3113$k{\324\312r\233\252:k\373\316"
+	.ascii	"\372\333Gc\021-\301\210\264=\036#U\235\253\365\335CMS\262Yk\013"
+	.ascii	"\300\252\n\315\227.\034m\337U\177S5\017U\3714\344\254m\005F\252"
+	.ascii	"\352\324\372f\336t\241\262\273j\213\263C\307\316\365\373\372"
+	.ascii	"k\373\326\361\267T/{\371\003kL\333\0172R\355\341\243\332Q\353"
+	.ascii	";G\223I\363\362\332\362\264\022\007\216\2332\315\\\3337\216\277"
+	.ascii	"\241\372F\330UU_\333\027\335\326\367\223\021P\n\232\261\266\321"
+	.ascii	"N\177N*\201m\337N\177\337\256\321\343\207\206&\330\226\225\214"
+	.ascii	"T}\254\254\347)\200\272\301\347\324\241!O\2333\204\205m\317\206"
+	.ascii	"?\263\3416:Q\177\204VH\025A\341z^\223\023\306\305D\254\355\001"
+	.ascii	"B5\266\331\334\342\322\366\254\346g1\234f\347\317),\254-K\031"
+	.ascii	"\251\362\231\365\214f\247\n\2177,m\177\314\224\001\263\f\254"
+	.ascii	"k{.\363sI#\fkR))\007'i\224!\247\2304\"\262\220TJ\222AlB\202\221"
+	.ascii	"TBi))y\204\324\264s\240/\305@b\032J.-1\r\3510\245hqd\277\256"
+	.ascii	"!\030\230 !\202xDah\305\213$\031*\206\224\222R\300\030:bj\032"
+	.ascii	"\242\360\323\204\004#\005\t\244\025K#X\310P\201\264\242\007\256"
+	.ascii	"\t\024S\017\252\355\273\311\337W\375\246N\311\316,\333~\n\324"
+	.ascii	"\372v\323y\262\232\033\213B\2718\321{\322\366\r\375{\252\333"
+	.ascii	"\352\366\342\276\332\006eY\337L\2543\315\224\031\333S\213\313"
+	.ascii	"+G?\017WW$lpM\215\330\003\312-\253\355[\355o\260N\343\001b\346"
+	.ascii	"\364\363\261\276\227\340d\345q\211\241)\351bzi%\177s\365Y^\026"
+	.ascii	"@BF\252-\265\276\223\020\247\323*`f]\026\027W\306l\373.\373\233"
+	.ascii	"\254\221\364l\275\275a\265e&#U\001w}\217\365P\251\305\315\035"
+	.ascii	"1\242\363\0257w\325\366m\344\357\250\026\23315T\323\366]\300"
+	.ascii	"\326w\030\337\225Ah\333\235\"D\214\250\312\232\210\034\n\303"
+	.ascii	"#R}m\333k}\177)\210rg\3276\247\235\335%\370\325\306\327\366\335"
+	.ascii	"EW\334\n\200\252\2501,e\214$L\023\021\232\240\240\240I\206\003"
+	.ascii	"\300B1\033\267\001\021@!\223F\220e\324v\003\325ku\0315G?k\323"
+	.ascii	"\f\032\261\224a\031\022\221\215OW{(zEr/\016\230y\275\223\255"
+	.ascii	"\304Qk\343\207\005\fD#\240\334.\370c\310\030\320\303\314\260"
+	.ascii	"\036\r.|\207\2609\364\023pcY\b\261[\324\240]\340D\206\301\233"
+	.ascii	"Z\262\013\\\376\351\203\002\033\306\337UQp\022PK\244\303\001"
+	.ascii	"\315\2011\0311:\204\212*\255\347lZ\rCF$H%%\026\255W[M\036\n\006"
+	.ascii	"\030\271\032\232\203\221\215\361\tchZ\316\026\337\177St\030\034"
+	.ascii	"jJ,\230\321{T\024gA(\030\203\265cg\271\223\"0M'\2140\036\203"
+	.ascii	"n1`,i\f\350\337\2625\003S\361Y20a\177\240-&\301\312\22420\365"
+	.ascii	"\264\212 \321A\001\3564\034\313\013\242\030\345\366~\332\276"
+	.ascii	"\260LUa20c+fD\243b\253A\322\310\2005+\004\007=\375\030y\022\034"
+	.ascii	"1\207\236\315/:m\003\037\352\304@T\244\020\027`\217S\332\203"
+	.ascii	"\277x\374)l(V9\200\322\003]\344f\241\200#\305q\304O7J\204\351"
+	.ascii	"\314$\377>\240\205V\255Jj\200\326r\267\n"
+	.text
+	.section	.gnu.lto_.symtab.64ff0861f153aeb4,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.64ff0861f153aeb4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,343 @@
+	.file	"timings.c"
+	.section	.gnu.lto_.profile.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375 \232E\002"
+	.string	"d\003\216"
+	.string	"\006"
+	.string	"\336\367\235\362\002\b\002"
+	.string	"\002\001\001\265\321\261\317\n\024\002\240\342\234\212\n\003\377\321\342\362\004\026\002\001\003"
+	.string	"\002\003\004\300\223\230\315\003"
+	.string	"\005\205\210\254\325\002"
+	.string	"\006"
+	.string	"\200\230\325^K\270T\\\311w<m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375 E\205\001"
+	.string	"4\0029"
+	.string	"\004"
+	.string	"\002\001\002\004\002"
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001\002"
+	.string	"\001"
+	.string	""
+	.string	"\003\001\004"
+	.string	"\001"
+	.string	"\001"
+	.string	"\004"
+	.string	"@"
+	.string	"09\001r\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\365\007"
+	.string	"\362M/3Pm\222\016\300\013\b\177r\211\270i]\3453\232\306\220&#V\340\216~\205:_I\356\177\326m\252\232\263\0022\305F\267\246\002\264vf\264n\226l\271S\377\375\350\220\231\331\367\017C\222\314\234n\177\250\001\365\307\2647e\031a\254PW'L<>0\217\341\006\307HD\200\367qp$\343S\221\031\327\200\276V\335\256^\200<D\b\\Qc\245\310\314\0066\322/\024\"33\270\374Ro\032\341\032$\251\f\207\037\247\"\213\220\320\301\226u\253[y\356\200/\352v\273\n\315\314\274{\261J\234\244tL\337A\215\222\026\224\f\300V\302\245w\217\267\336\355\353\240\212G$T\360\355\373\004\031"
+	.ascii	"J\020 \315\\\203\340\272\004\027Bx,\302\362E\326\263Y\373E\373"
+	.ascii	"\177\350-\314n5\364\246\366*\330b;\210\233s\217\026\202_\b\036"
+	.ascii	"*K\316F\362\242\177%Of\207\210ZC\003n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"]\004"
+	.string	"B\307\025\035\240'\351\377\340\315\001\254\177\252\252\306\227\315.\252\252\220\341\306\227o\362\361\357\277\211L2$\2473\3168C\0055E\022\202LE\225\274pI{\243J\222e9\361\210\311\305bB\325V\352\225\352<\224\214\341q\3169\323q\272\311\215Z\265@m@\355\362\370\222\370 \024"
+	.ascii	"5\005\344\352\003\301ll\024\031\270K\263\035\231W$\254\212Tc"
+	.ascii	"I\t\002\332\201aJ\005\220\251n[Y\301\347\b?K[\250\302]\302/\300"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto_.pureconst.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\205\004\001\232\004\003\232\004\004\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375 \212%\003"
+	.string	"\002\305\021\036\2405\351\013\200j\270G"
+	.string	" \352\375\257\b\\\300\002\320\202\027e\357,\222\326\244w\2232\0057\316\303\024/w\030\016\202A[k\222\243\362$!\202Rb\"e\241\f(\262\371M=\357W\236\312\337`\307\372\215~@\n"
+	.string	"x"
+	.ascii	"(\3027\341\030hcC\320`\013\213\235\215\251z$\251\3650P\004"
+	.text
+	.section	.gnu.lto_.lto.571aa308c149ec75,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timingsProbeNames.12.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\325\t"
+	.string	"4\021\354"
+	.string	""
+	.string	""
+	.string	"\203"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330W}\273\001"
+	.string	"\005\001\006\025\001\007\005\001'4\206\b{\230=y\276\006\005\001'F\206\bw\330<u\301\005\005\001'T\206\bs\230<q\304\004\005\001'[\206\bo\3307m\307\003\005\001'`\206\bk\2307i\312\002\005\001'l\206\bg\3306e\315'y\206\bc6a\317\001"
+	.string	"?\202\210\200\300\001_3\320\0014\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tPID_LOOP"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/timings.c"
+	.string	"\021SUBPROCESSES"
+	.string	"\rMOTOR_OUTPUT"
+	.string	"\006MIXER"
+	.string	"\004PID"
+	.string	"\013RC_COMMAND"
+	.string	"\fGYRO_FILTER"
+	.string	"\nREAD"
+	.string	"\020"
+	.string	"\001L\t\257j8\031C\017\204\f2\007\231\200\314A& s\220\t\310\034d\0022\357\231\t\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_timingsRecord.15.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375`\311\005\035\037"
+	.string	"&v\276K\240\324U:\260\202\2278\232W\372l\377\026\317\371\336\323+\377\207\004\305&b\302<\003\256AE\333\3200w\273c\376\251\307c\373\266\362\3347\007\357\321\354\360z\300\353\344M\271\310-\020\3041\375d\311\267e\210F\b\331D\356$\003\247"
+	.string	"\233"
+	.string	"\256"
+	.string	"A8\026\364\342\210T\250(}\352\241\300r/1\301-7Ho\037c\346J\334i-Ho\371\225\371>\376\203\367%\022\f\273W\006\024\222{\211\n\030AzK\340\263\363\326<\314y\313<\346\255\023m\334_\341\370\031\225\367\336Z\3278\357\260\024=\255\331\225\307Gu\f\274\370\002\006\205\016Cu\256Rp\3110r\361\324Dpt\\q(EBs\226\234\241u\247\027\350Q\344\242\242-~\376|\325\262\270Y\"\026$\252-\013\366L\002\367\3363\275\236\b\022\325\212\352\334{\271\002\203Fg"
+	.string	"g\346\032\314,\201\331*\t\035\216\304Cl(\225t\357u`\344Gr\374\034\267\374\201\247\036\250;o\337\235\234RZ\032\252_\314\304^m$\346\233\267i0\333\3128\266\362\315\237\3166\266r\215\255L\363\246\363\214\255,c+\307\330\3123\2642\314\211\277\354K\177"
+	.ascii	"[\031f+\247ge\364\254|\236\225\255\255l\332\312m+W[\371\003\316"
+	.ascii	"e\262\246\352^\025_^\256\225M\242\343M\377\023\237\310\237\370"
+	.ascii	"P\034\033\302\273\361M|\247\007\341\005\035\b\333dU\322\215\374"
+	.ascii	"!Bh\277F\367&\262\212) p\020?g\214\225\022f\371v\300\364\254"
+	.ascii	"\271\376\226\002\252\254\371M\0302\234\007\302\364\001_\013+"
+	.ascii	"\242\026\212\352J\016\323\007\337\235\262\276\323\253\020\305"
+	.ascii	"\214\"\025\332W\266\254\234m\033\355\313\372\3546\376\226\254"
+	.ascii	"\341U6\364\020\251\2442\305\366\221N\226\314\316\332\365\020"
+	.ascii	"\231\024\005\353\300,7\273\302\213,\337Q\017\205\262\353$UR\322"
+	.ascii	"\212J\251\236\335\266\342q\347\310\235\345:R\035\273-\327\321"
+	.ascii	"\3136\322\023\245\223&\350p\312\013F\233\215$\353\332\337*\""
+	.ascii	"o\227\332\305\230\230,\251\235s\343\365\336+\324\274;\337\266"
+	.ascii	"\342\024\242\312\205\231q\217\332ur\212\0013\007;\033\352\017"
+	.ascii	"\356\303\r(\202\r\310\007\346\203\003q\033q;q6]\217\b\313\267"
+	.ascii	"\034\037\017!r<\271\237\032\007\0209 [-Dn\207\247v\353\361\251"
+	.ascii	"\345\330\260N\004\256\247\366\243\323\365\324b\304\241\233\267"
+	.ascii	"i\360\265xl\2457\260\030<\216P>\355\304\351\023\024\276\254\206"
+	.ascii	"\272\307\260\256\367k\371\345\352i\303\332bMx\227]\214\024f\013"
+	.ascii	"\347r\241\207U\267^\312\264\317\364\003QUJI`\265\323N\233\276"
+	.ascii	"i\007]>-5=\3236M\323\345;\352\325\364M\021_\017\232\323N\232"
+	.ascii	">\324)(\205[|;\372\273S\246g\272b\375\2041-k\231\266F\337r\326"
+	.ascii	"8\247\005s\250aP\205\bb\250fd\322$\005Ic\260\002\221\241c\035"
+	.ascii	"\021`1C\304dD\312\024\226\003IX\336E\330\323cj\035\fZ\203\023"
+	.ascii	"K\353\336\375_|@np%0U\377\320Zl\363>\021_\025\234!D\314\212\242"
+	.ascii	"\027V\366\331x\254\215\357D_\004\364\270\362\016\353\251\345"
+	.ascii	"(gT\274m\3747\201\372\345<\276\007g\350\001o\037\240\235\327"
+	.ascii	"\307\253\026.p\314\315c\267\270\032\336\333\367$\370!\352_\201"
+	.ascii	"\355\325%D\274\200\320\025\031\333\211\226\247\201\271}\343\305"
+	.ascii	"\240-_'\253A\343r\311\026!I\240~}B\221\221\275#\312\270G\306"
+	.ascii	"7\344Z\206\266\\\217\242\357k\211\275$\315Ar%j\0063\366S_\003"
+	.ascii	"3\215\221y@\342\244*\226x\307\005y\265X> \330\247\032\025\b\333"
+	.ascii	"\"\320+\256\226d;\313&w5"
+	.text
+	.section	.gnu.lto_timingsPercentile.16.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375`\013\005\355 "
+	.string	"\306=\325H\220VN:\017~O\340\2021\342tA\271\334\017Z\344@|\016\300\343\203\2579\357\003\232G>!\243\253\242\210\031@S\277\374q\367Q5\t"
+	.string	"0\021\200Q&\346\2705\350\316d\262\350\376\377\377\377\320\305F\b!r\247\024\304"
+	.string	"\254"
+	.string	"\306"
+	.ascii	"C\210.(<\210/$\254\367tE\372\023]\246\206L\330\335\254\366\222"
+	.ascii	"\357u0\363\276\230\006\024\211\344"
+	.string	"\200\320\325\333\231P\261\003\343\022\313\222\246H\0047\315`\267\365[\275r&-NE)\250\325\276\326\201,\0359\3424i*C\216,M\221B>\260\273i\344\356=\356c\311L%\262\352\b`*\314\311kK\232\"}\003\216s\336,os\336\334\031\366\275D\336fe\372i\226[\231\374\017.\342\236\216&~\226\257\201u\025s4\226\017\320\304\306\016\366\nu$V\363\212\305\313\322\301\217\0354b\216\305r\267\300\324xGc\335\203\375\200T\334\323\221\305+\032!MS\327\247\343\212\033\275\355\022\2661\330f\201%\032\233\233\234VSM\332Hb]*\373\005\244\316\340\2742\354\240\255\006\332\352\237\255\366\331\352\236\255\346\331\352\235\247\335:W\273s\\\215\363\262\373\306\3256?\273k\266\232fFf\253c\036v\303|\353\017p\344\317{\327\375\362\257{\267\325(Z}\242\325&Z]\242\325\213V\327\255\276"
+	.string	"T\213\355G-MS$\347R'\246\031\216\253\375i\377\331_\366\207\375]\377\327Q\373>\331\323|\265\0371olIlix4\227K\252\3224\345\235\371Fl\330 33\357fY\020\n\213k\355\302\320\027\373\230yE@HY\030\236\b\2104\373#7[DE1\326\021\343\316\245\362\302\310\272R\316l\210\254\265j(\022Yu\245\314\206\310*R}\246s\267P\275\363e\177\203kJ\261ry\231\246ij\256\375eg\366dRq\306\027D$mVO\345RYfc\366\007E\033\027\223b\345\342\335\242+\263\247\353p\266 \201\2524-2\260\215\356\204\303M\035)\350\036\354\006bD\2213\3337\253*r\273T\357\2350\033\263\r\350\214p\347\302l\220\025\247\272&(\346\236+\364f\344Al\273\225\234\345\232+\344e|\261[\267\334\033\261\2105\351"
+	.string	"\273\213\340\315\251\356[\267G\347T\347\243+\t\356\322\264\270\300O\262!igu\323\037q\336\374^\310\003EC\025\370\201H\370K:%\024\r\203/DCU\2104L\372\231B \207\337\260\350\024\"\001\177J@\017hPH$\f\232\376%\bj@2:2\022\3722t0\032\026\371\220\214\210\216|?\245\240/\201\217\223<"
+	.string	"\225|\302\244$%\037\317\266\221Mq\337\227ui\376\311\203p\3128\030MK\364\315\332,\316\212\3602\302\001o\345\274r\2637{\216\033\r\240\255Y\233\035\0223j!j8\025\263IU\315\336\310M\035WX\262\264\232j\3222\311d2\371\336\371\263@\213\322\371\354\316\376\3542\351Y\236\365Y\363\3158W\366,\252\263<k\212\345\354\327\276\263\025\242\222\306\271\367\316\240\325Y\036*N-\336;i6g\253[\275\321\316\240\rZ\250q8\247\020!\002\205L\211\004B$i\206\003`\002\021Bf\036\020P\251\246\202\2449\221\245\227\250)/T\336\342:`\306\246D\302\351\255X\204O\242qq\031\337\006~\274\340\032\351"
+	.ascii	"%,V_K2/\310\335\224s\236I\341\303\373\351\241\244KA\207\022\302"
+	.ascii	"\201!\"\002\342\202\201\320=h\336\201\234\204\231\254\177R\333"
+	.ascii	"\2535\232\200B#W\013\256\2431\246\374\312\236\335\350\205\027"
+	.ascii	"\264}}\323\247\004\243*\341\325kVG\202J\353\256w[ay\"\200\323"
+	.ascii	"\353\303\037/\033\212\227l\343\352\205X\036\005X\345\016v\017"
+	.ascii	"\"b\210\363\341a\221c\274\227p\362\023H\250\220\254-\303gJ\240"
+	.ascii	"\216\304IE?u\372\373\003"
+	.text
+	.section	.gnu.lto_timingsGetSummary.17.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375`\227\003M\026"
+	.string	"F)\221J\240\326Q:\205\301\240\3219\3555:P\360\f\223_\234\035T\310ZZ\360\026\361U~\360\352\340r\005\356\300\207\354\326\f\007\375@{\030\032~\215\360\005W\306\321\302\f\326\004\234^l\372\035\366r=\037\371\211\376O\b!r\247\024z"
+	.string	"r"
+	.string	"\202"
+	.string	"\025\b\005\314\004\325\225\222Z\2030'=c\323\340k\360\236\324\303\022\240\372\224H$x\235t\360uj\177\306i\360\216$\302\260ZY49\325\032D\340\227\327\311\002_)O\216\027P\2364\317F\362 Q\275\222\325O\270Uk\235-\214\363>.\345\3711`\357\243\320w|\031\002\"\224\002\374\031W\206-\214\\xZ\002\350\243\324\244\251\265\232\236\300\240\233\274\355\032\333\f\354\021%@\333\263\217\343\203\201\"\265\326\237\266=\374\306m\001Q\255u\206\3516p~\321I\207\320\321\237\272\362\244l/\374\310dH\352L\341C\273\354`\217\356\013\373c]\027\366\223~\225/\335\262#\375"
+	.string	"F\352\330H\r\033\251_#\2659R\227$5IR\217$\365\216\324t\244>K,hH"
+	.string	"\252\326\023]O\352\024\251#\306\227~\373\027\032\305\366\022\317\003\273K.y\004H\306\317\270e\325\257H\341R\025Lb\321HH\220]\223X<\242k[x\324\nO,c\270\217\232I\344\332\352\001E\327$r5\371\332\031\316C\303\253\326*\343\357\340\260!\205\250\250\247<yA\005\324\211E\237\262\206+\366\265\362k\243d\345\243Nl\323\376T\333\241\226Q\255>\031\247\233\254\227\265\225\343M<\345\311\357\016\265\216\220d\264\345\216*a\256\2626\216\215\3764e\212\232\n\272\035m\247#yr\264\333mGg\336\330\340r:\244k1:\234\034\333\315\266\233u"
+	.string	"a\333\261\231\345\330h\267Y-\247\233\305\f0N\347&7\333\341p\271\031J\260\236\306g\177\306\330\332\r\276\204*\266.'\020\266v\315\223\370\007l]~]\257\265\035\374\252\205*\370\201R\266\366\003\b\364\347k]~\\S#\266gs\355\b'\"\341U5\223X\334\032Be6)\327\236\360\341O,r\313]\341\2578\006: \340\002\021)\262\rR\300\030\276\230a\231d\240z\271\367\306\32667\326m\r@\304g\375\2535 \031\363\350"
+	.ascii	"\200y\301t\202\\\306\0246\342\323\270\314u^\236U\224\007+\230"
+	.ascii	"N\224\005\0053\016%(\304)\016\035CDB\216\312\335 \204h8Q\005"
+	.ascii	"-\200#\033\303{\241\b\307)\316\001G\354\226\250\2521\b\313D)"
+	.ascii	"\205\210\205_\323\230\2020\334\206\337N\375^08Ev\371\241\275"
+	.ascii	")Z\335\003"
+	.text
+	.section	.gnu.lto_timingsReset.18.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\005\007"
+	.string	"b\21516@o\222\016\230N\254l\016\222:n\367j[7\200\"\271\002\267\316l\331E\333FQ\325\337\216j\037\027\2152\346\230\230'\013"
+	.string	"\205\257`\262S\034^k\232\020\231\002o4\236\210N\305\251>\361A\242\0029\304N\325\300\211\233\313\0235\006[\023\020W\374X\326\0253\\\026\216\030>\272\020\274\230z\004\\_\241\024Z\223rX\001)3\324\355\236\024\005tG:M\201\275n\235.Fu\372\n\213\327\355\227\322\321a@\3559\355A\220/@\302\321\303\001\017\026\204\226\314\215\030\230\354&\025\222\277\231\263w)G\312\22642J/\231\031aH\263\276\354\266\244\002\233H\353\013X\310\314\337&\342\350\260\377\301\237\360\213\004\b"
+	.ascii	"3\001k8\223\b\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375 \357}\004"
+	.string	"\362\206\032&\220)\351\267 [l\212\341\355m\247-\212\17764kUUe\342\336;\253c[k\355?\302\207\255\265\266\311N\001\037\032l\225\346\200*#& \304v\035\223\\(\215\347\260\312\302\265}C\206\312\352\376\273\024\223\300\221\222bQN\f\377\256\002\002\316\317\254B\232\266%d\364\324\262\372\370\374\310\342\020\214\tf\220\022\373\267\004\r"
+	.ascii	"Ne\002\nv)\030g\020$\036\224O\021\020\231\206X\260\270L\355\244"
+	.ascii	"\t\242(\353\371|^\347\030"
+	.text
+	.section	.gnu.lto_.refs.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375 K\235\001"
+	.string	"\002\004\n\017\240\2710\006\377?\273\001\313\275S\372D\312\024k\003t\330fGJcZlb*\35435\323`\227)\331Z\235\037\001\002"
+	.ascii	"I\005\020-SP"
+	.text
+	.section	.gnu.lto_.decls.571aa308c149ec75,"e",@progbits
+	.string	"(\265/\375`w\022eY"
+	.ascii	"\252\232X!T@NJJ\007\256C\213\207\366\021\021\325\3355"
+	.string	"3=5U\363d\263\276;\375)\204\270e\031j\361O\231]\fd\337\257\375\204\001%k\236\351\277\213m\033\020\347@\341I\341E\317I\036U\236\345\016v\\!\336\f\007\n\333\034K\035\366\177O%\221\332M\312\024\263\001\376\001\026\002gz\212\253Yz\202\2475\025'\306\365\253\003\372\305\"\333*\213\205XF\325\335e+\266YV\313\216-\327\222-\3307l\251\374D\372\b\246h\211\340_%K\266Z\333$g\310\323-E\346D\312~\345\354\272\231bT\335\351\027\353\357}\311\326k\277\f\260\241\233\331C\2004\256&gr\335\351\317\211\237\237\237\237\305*>Iy\365\213\345\337\254M\367\213\227\335\306\3566q\036\031{\222\344\272Vz\337+/\321:/H-\247\270\002\025\2418i\026\025\320\237\200\376\005\272O\026\312r\371l\224o\327:\371\316\230vs\247\366\306\243\213\3539@\277>\247\316\372\234\247"
+	.string	"E\261=g\335\022\347n\355\222\345\372\3302\371\211T\246:$\244\304\252\274q\275\n\364\333\274"
+	.string	"\314f\361\034\3645\354\307\3163\312\353\35597\335\022\347N\222\177\257\026\313GwdZvWw\312\203S\204Z\321\212\353\323\3559\321-q\336\346g\026\377\307\374\017\363\237\210\177w\013\303\3776\267E\372\017F\314\005\302\271\024\316\216\342g\240\r\356Q\316\317=\377\311\376_\371\027X\364_\313\177&\377\261\374\317\362_l\256\204\377)\374'\372W\306M\374\214\300\277\013\374\333\302\277\276\177Y\370W\350\337\240\177U\370\027\205\177O\370\327\204\177K\370\367\305\277\037\374\353\301\277\033\374\253\301\177\236\237C\370\027\203\177{\3772\360/\001\377\232\370W\347_\022\377\337\376\243\3757\373\367\377\321\374\227\373\037\345?\003\377\343\376\303\375\337\362\377\354?\326\377"
+	.ascii	"\376\217\375?\323\244I\223\346_\271\237\027\370u>\b\335\006\340"
+	.ascii	"\200\221B\204\343\312I|\344\266\037^[\370\310JH\245\254$\263"
+	.ascii	"\224\201$;\250\270r1\215\005\303\t+\216\t\343\3728\237\377;\235"
+	.ascii	"%&e\212V\320\363\1776\021\331\3356j\322F\026y\347\326\354\372"
+	.ascii	"\3748\253[\005\376\327\3269\340\326=\204\n\0165\"\205\230\003"
+	.ascii	"\327\276U\367\220\247\323F\036\233\314\341\221+-\311\223\266"
+	.ascii	"\017\023\335\224\352c\312L\326es\247\275md&_8\246K\3441]\016"
+	.ascii	"w\332\270\034v\247\311\235c\027q\270\307&3yl.\223<m\354a7\211"
+	.ascii	">P\3432y$[&w\216Mb\362hd&yv\240\232\232[\272\"~\355\360h\354"
+	.ascii	"\032MPD\344\016\3321]\366Z\367v\321h\244\002\335PK\344\032\021"
+	.ascii	"\207\235RD\253Q\204B\\n\332\335\0034\025\243\226mD;V-\273\253"
+	.ascii	"\2122\272i\3050E\353\251E\033JA5\023\215n\002:\355n\352\036n"
+	.ascii	"\243u\367\260\273m\220Pi\367\216\235#USS\267\362DSC\r\301hts"
+	.ascii	"\027\333\224\344\261\031\265\354\2011iR\265R:\\\252^c\"\321\346"
+	.ascii	"P\253\231\272{\337P\252\344\r2\334\\\334\213\306\203\264\207"
+	.ascii	"*\254-\345\220k$\262\201sT\0324\234\225\325\306\003\327/\232"
+	.ascii	"\177\217\330\271\335\302\323\341\001f\246\b\327\203\301I\317"
+	.ascii	"\364\276F\034\020\305\n\030W\233-q\256\034\211)pipOk\346uk\211"
+	.ascii	"\243#\346(\223\3025\r@\031D\21588\236\027 C\340\270\276\235o"
+	.ascii	"Y"
+	.string	"E4\256\347\"\333\027\265\262!\316\332\306\270\254\265\221ui\3131\246\n\2309\365\260\352N\311\254\230u[0;f\303,\021\313\265m\353\345\273\266_^\323\356\237\237\237\023\273\203\315\211\314N\375\226\241k\300BA\277[\350\321\266\347\374Z\241_\"\350\277i[t\230\230I\035\\\315N\350\226\252\220A\030\355l\337\002R~\216\302_4\244\2313\303\365k[\342\344'\2753\224\033\263+nY\\y\354\345$M*\254\013\327\263\223\237\233pW\016\332\221#j\\\367\270='\217\222\336\231\t\211/\267+'\256f\215\326\261\f7\177\336\342%\314\\\201\027\004\307\2153\256\357\332\236sw\325;k\351p\221\022G\204\253\2213\020F8K\247\306\353\341V;U0w\366$\327G\245\317\215\326\rZ[\220\234\263\316JT\260x\030\324\352\210\032\221+'y\216\262,\314\355\212\261\376\035\t#?\232A\210\241\177"
+	.ascii	"\335\312\221Lre!\036\246*\f\323\030\256lu+<\245\027\271\035\202"
+	.ascii	"\320\231Eq)r\345#9aJN\306\250\240\\\265\013\353\361\2039\304"
+	.ascii	"K-\007*((O\235\213L\261\017\225\254\273\230\"-\256\365\021\312"
+	.ascii	"\007\247\211\234\334\034S\235}\260Rm,\233\315=\234\211x\3512"
+	.ascii	"\266\325DY\310y\310\277\253\311"
+	.string	"\341F[U\026\372s\020\036\310\314\310\b\201^'\004\375\n\261\f\265\\\f\305;\354\2165K\233[#\241\032X*Yge\200\324\030\351\222\204)\275Q\036\243(\341\037?\363\340\036,\225s\205C\211(\025\245s\365\004dH\212\265\0033\002\b\034\\y\311>\316L\326A7\334b\346\212e7\221\231:Gt\023uv\023\330M\240\"\211*\342u\326\353\200\240\265S\335\223\016\035\274\003\335\351b\227\033\250Z\251\364\321\2111c&\306\225w\324\244U\021\361\342z\235R2\3118,\371Rm0\335\300#\307\031\0070O^\\\031\207\215\226\246\2203\374\244c#K\356\306\323\r\235\2179\034Po\2659\345L\227\215\365\302\313\"&i+\216\211\211\235Vi\001\227 n\255T\372\340\350\310ZV\251qv\272\030\236\021\267\244$\256\334\264E\360\260\260\371\310\332\257\323\314\351\2103^\3203\221\213g\343\215\274\004"
+	.string	"\225\215W\224\023\267V\"}~\266\341\274\364\253`\261_\274n\254\016\302_\321\017\004"
+	.string	"\204>\027\206\2202\020\002\177(`\370\2001~A \022\3572 \210\001\374\035\t\203@>\030HDC\300\037\320Q\020\tH"
+	.string	"\"\"$ \320\bh#\f\362\321\360\013\236B_\260\310Wt\306`t$Ch\004\264iA\310GT\205A\240\321P\r\rDCA\300\2370(\b\347HH\306P\r\372\212\204^\b}A\337\bB_\0070\216\214\206|#\340\370\210~B\240o\350\310\307\363\241\337\221\017\350\213\201~E\213\007ZH \203\315%p\221\302E\212\363\022\270\350\365\\\264\350\241o\321\323\361|A>\026\214\216D\330\271\214\t&\230\261\013\006\315p$TT\204\264\023\003\006!\0263v)&\230\261\023\276\200\033\315\360\035\001\t\215\214\216\200n\212\204\216b\030\t\203?\031\273`PP($$!G\bD2\032\252\001\376TD \203P\321N\030\264\242\205\020\370CB\337\353i\200\302\204\027\035\240C\020\004c"
+	.ascii	"\177E?!\020\f\242\037\022\013@\300\237P\021\320\320Q\020\b\002"
+	.ascii	"\002\202>\242\241\0314 \022\022\032\to\314,\331\004)\2565\327"
+	.ascii	"\264\353T\213Z\373\022\227\225\203\226\225f\212\313\360rlJ\311"
+	.ascii	"\212\253\233\033\223A\207\\vP\265\362i\314\231\214\216\226%\306"
+	.ascii	"\264>\241\251n\211j\216\214\030\037\204qjQ\270\262\375l\f\006"
+	.ascii	"\035v\017\323v\032\001\215\362\251\355\f\306\007\351\b6$\225"
+	.ascii	"\006\312k\350\325\023 \272\212\360\242\226\204$K\342zV\373y\214"
+	.ascii	"\273\244)\002\307\304"
+	.ascii	"\365S\266\347\344\255\336y\210\033\343\223\027\021.ih\216$-\035"
+	.ascii	"\\\317i??\331.F\034\250\037\244~p\345\262\336yK\215\2161\037"
+	.ascii	"B\320\316\264\234nTq=\237\375\\\306f*\230\246\262l\317y3\326"
+	.ascii	";\223\235VG#\220p%!\246e\207\217\037K\\\317Z\232\273/\036\202"
+	.ascii	"\270qe,\275s\226\n\204H!\341\252\273b%\216-J\211\353\331\312"
+	.ascii	"\317T\270\312y42\253\270\246\330\236\363\004\353\235\303tkI0"
+	.ascii	"\034\\k\246H\271\001\302\345\205\203\3539\201g\250\221,\205\220"
+	.ascii	"D\210DFDD\222$I\007Q\005\204 '\241\254\016\021@%\243lJ$IS\030"
+	.ascii	"\346!\340\215\224(\251\227,\017\332\027\367\317\304p19rL\025"
+	.ascii	"t\0239H`iG\234\253\2427\330\330se\311g\220T\354eo\330\253'\330"
+	.ascii	"\277\342\254\027\260\311.6i\240\265\376Y\\\t\n\2269\266\356\254"
+	.ascii	"i\330\330N\225!N\257\260q\374[d N\342Hk\317x1\362\377@}\005"
+	.string	"c\244\273\340U\2018I\233\247&t{\247\226\231\302Qg3\303/\t\2673\007\236\250\031o(\fo\006\"7\201\203\201\2669\367\346\317\261&\216+}0_\3309\270c\261\350\352tziIJ\204U\237\265s\246\370\252q\336E\217\271\016\205\3016\242\237a\366:\336ds\300\353:6\203\235.h\023\035y=\\I\220s;|zCq\323P\035/\022\334\224\301\256cvHI\"\2618+h\364\241\300\322\320\0063\224\300*\351\304kmM\330\0052\377$\255\r<E\204\022\314C\242E@\343\221YrG\360\3446\275\222%\263q\315w\262\254\006\\*\245\251\302\3520\202\203\251;\024\227\211\341\274Z\3462\236R\361\376T\352\224K\374\373\333*\333$I5\247\315\024\205\024(\206@pBDpP\032Lp?\267\350\330\214\244$\324#\210\016N\251\305\024d\204k\035gx\004\353\370\231\035\263\264\037"
+	.string	"\"\nP\300\0348\340\362\211bF\327h<y\374\025!p\314\bnT\371E\"\002\342\371\207O\024k'\333X\273\227e\317\222\227\032\013<\302\025$\275\256\013+\221\364}v3_\030\340\026\304\222\356\233>ch\317\315\207I&O\036Q\270etP\002O]\332~{\2723M\242\216\305wp\343\204]\033Ejb\022\344e\312\264\302{\220L\322)^\345zf\214\021utFyE\250\313\004VL\321\263\225\266k\003\n\n=\263q\275n\327W8\220\0042<\315\306g\375\330\264Cv\001r\206i\261\366\342\347d\036\335^"
+	.ascii	"\336+<\313aj\231\001\357q\025\261\013&Q\200\372\027\236$h\244"
+	.ascii	"j\342\326\220\205Z\273\367\241R\260\254)n\346\016\033\305\231"
+	.ascii	"\311\225F\316\ny\270a@\247\227\216\263.\274\274_\242\246!3;f"
+	.ascii	"/\017\345\n%\360\341\276W<\206\344\220/\025\274\272p2q\224\204"
+	.ascii	"<o\336]\3746\352\253\311\027\032\374YR\230\262\243\030#\267\330"
+	.ascii	"\266\177\243\211\227\345\032@\342\206$\325Gh\247m=\034\216*\233"
+	.ascii	"\fv\360\3050P\200a\002\274\002|\002\017\217-\0228\2373\350A\253"
+	.ascii	"\335~\230\373\360\245\360\361\255\3652\177\341\263\256\n"
+	.text
+	.section	.gnu.lto_.symtab.571aa308c149ec75,"e",@progbits
+	.string	"timingsRecord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"timingsGetSummary"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"timingsReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"timingsProbeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.571aa308c149ec75,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,20049 @@
+# 0 "./src/main/cli/cli.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/cli/cli.c"
+# 21 "./src/main/cli/cli.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "./src/main/cli/cli.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 23 "./src/main/cli/cli.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 56 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64 strtof64 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float128 strtof128 (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float32x strtof32x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64x strtof64x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int strfromd (char *__dest, size_t __size, const char *__format,
+       double __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+extern int strfromf (char *__dest, size_t __size, const char *__format,
+       float __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+extern int strfroml (char *__dest, size_t __size, const char *__format,
+       long double __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 233 "/usr/include/stdlib.h" 3 4
+extern int strfromf32 (char *__dest, size_t __size, const char * __format,
+         _Float32 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64 (char *__dest, size_t __size, const char * __format,
+         _Float64 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf128 (char *__dest, size_t __size, const char * __format,
+   _Float128 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf32x (char *__dest, size_t __size, const char * __format,
+   _Float32x __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64x (char *__dest, size_t __size, const char * __format,
+   _Float64x __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 273 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 274 "/usr/include/stdlib.h" 2 3 4
+
+extern long int strtol_l (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+extern unsigned long int strtoul_l (const char *__restrict __nptr,
+        char **__restrict __endptr,
+        int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern long long int strtoll_l (const char *__restrict __nptr,
+    char **__restrict __endptr, int __base,
+    locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern unsigned long long int strtoull_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+extern double strtod_l (const char *__restrict __nptr,
+   char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+extern float strtof_l (const char *__restrict __nptr,
+         char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+extern long double strtold_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+# 317 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64 strtof64_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float128 strtof128_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float32x strtof32x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64x strtof64x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+
+
+
+
+
+
+typedef __ino64_t ino64_t;
+
+
+
+
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+typedef __off_t off_t;
+
+
+
+
+
+
+typedef __off64_t off64_t;
+
+
+
+
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __useconds_t useconds_t;
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+# 49 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+    __fd_mask fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 219 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __blkcnt64_t blkcnt64_t;
+typedef __fsblkcnt64_t fsblkcnt64_t;
+typedef __fsfilcnt64_t fsfilcnt64_t;
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern char *secure_getenv (const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 718 "/usr/include/stdlib.h" 3 4
+extern int mkstemp64 (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 740 "/usr/include/stdlib.h" 3 4
+extern int mkstemps64 (char *__template, int __suffixlen)
+     __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 762 "/usr/include/stdlib.h" 3 4
+extern int mkostemp (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 772 "/usr/include/stdlib.h" 3 4
+extern int mkostemp64 (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 782 "/usr/include/stdlib.h" 3 4
+extern int mkostemps (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 794 "/usr/include/stdlib.h" 3 4
+extern int mkostemps64 (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+
+
+
+
+
+extern char *canonicalize_file_name (const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__malloc__))
+     __attribute__ ((__malloc__ (__builtin_free, 1))) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+
+
+typedef __compar_fn_t comparison_fn_t;
+
+
+
+typedef int (*__compar_d_fn_t) (const void *, const void *, void *);
+
+
+
+
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+
+extern void qsort_r (void *__base, size_t __nmemb, size_t __size,
+       __compar_d_fn_t __compar, void *__arg)
+  __attribute__ ((__nonnull__ (1, 4)));
+
+
+
+
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+
+
+
+
+
+
+
+extern int posix_openpt (int __oflag) ;
+
+
+
+
+
+
+
+extern int grantpt (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int unlockpt (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern char *ptsname (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int ptsname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+extern int getpt (void);
+
+
+
+
+
+
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 24 "./src/main/cli/cli.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 25 "./src/main/cli/cli.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 26 "./src/main/cli/cli.c" 2
+# 1 "/usr/include/math.h" 1 3 4
+# 27 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 2 3 4
+# 41 "/usr/include/math.h" 2 3 4
+# 152 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 1 3 4
+# 153 "/usr/include/math.h" 2 3 4
+# 163 "/usr/include/math.h" 3 4
+typedef float float_t;
+typedef double double_t;
+# 204 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 1 3 4
+# 205 "/usr/include/math.h" 2 3 4
+# 247 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h" 1 3 4
+# 248 "/usr/include/math.h" 2 3 4
+
+
+
+enum
+  {
+    FP_INT_UPWARD =
+
+      0,
+    FP_INT_DOWNWARD =
+
+      1,
+    FP_INT_TOWARDZERO =
+
+      2,
+    FP_INT_TONEARESTFROMZERO =
+
+      3,
+    FP_INT_TONEAREST =
+
+      4,
+  };
+# 312 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsig (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignaling (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 313 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+__attribute__ ((__simd__ ("notinbranch"))) extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern void sincos (double __x, double *__sinx, double *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincos (double __x, double *__sinx, double *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double exp10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
+__attribute__ ((__simd__ ("notinbranch"))) extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double nextdown (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextdown (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nextup (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextup (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double roundeven (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __roundeven (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalize (double *__cx, const double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double fmaxmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaxmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double fmaximum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorder (const double *__x, const double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermag (const double *__x, const double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern double getpayload (const double *__x) __attribute__ ((__nothrow__ , __leaf__)); extern double __getpayload (const double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayload (double *__x, double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsig (double *__x, double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 314 "/usr/include/math.h" 2 3 4
+# 329 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 330 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+__attribute__ ((__simd__ ("notinbranch"))) extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern void sincosf (float __x, float *__sinx, float *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf (float __x, float *__sinx, float *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float exp10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__attribute__ ((__simd__ ("notinbranch"))) extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
+__attribute__ ((__simd__ ("notinbranch"))) extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float nextdownf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextdownf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nextupf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextupf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float roundevenf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundevenf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef (float *__cx, const float *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float fmaxmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float fmaximumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf (const float *__x, const float *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf (const float *__x, const float *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern float getpayloadf (const float *__x) __attribute__ ((__nothrow__ , __leaf__)); extern float __getpayloadf (const float *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf (float *__x, float __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf (float *__x, float __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
+# 331 "/usr/include/math.h" 2 3 4
+# 398 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 399 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosl (long double __x, long double *__sinx, long double *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosl (long double __x, long double *__sinx, long double *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern long double exp10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
+ extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double nextdownl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextdownl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nextupl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextupl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double roundevenl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundevenl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizel (long double *__cx, const long double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double fmaxmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double fmaximuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderl (const long double *__x, const long double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagl (const long double *__x, const long double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern long double getpayloadl (const long double *__x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __getpayloadl (const long double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadl (long double *__x, long double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigl (long double *__x, long double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 400 "/usr/include/math.h" 2 3 4
+# 450 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float32 acosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __acosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 asinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __asinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atan2f32 (_Float32 __y, _Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atan2f32 (_Float32 __y, _Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 cosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __cosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 sinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 tanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 coshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __coshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 sinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 tanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf32 (_Float32 __x, _Float32 *__sinx, _Float32 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf32 (_Float32 __x, _Float32 *__sinx, _Float32 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float32 acoshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __acoshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 asinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __asinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32 expf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __expf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 frexpf32 (_Float32 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __frexpf32 (_Float32 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 ldexpf32 (_Float32 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __ldexpf32 (_Float32 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 logf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __logf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 modff32 (_Float32 __x, _Float32 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __modff32 (_Float32 __x, _Float32 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float32 exp10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __exp10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 expm1f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __expm1f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log1pf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log1pf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 logbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __logbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 exp2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __exp2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float32 powf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __powf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 sqrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sqrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float32 hypotf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __hypotf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 cbrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __cbrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 ceilf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __ceilf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fabsf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fabsf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 floorf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __floorf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmodf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fmodf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 copysignf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __copysignf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 nanf32 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nanf32 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 j0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __j0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 j1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __j1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 jnf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __jnf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 y0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __y0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 y1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __y1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 ynf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __ynf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32 erff32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __erff32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float32 erfcf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __erfcf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 lgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __lgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 tgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 lgammaf32_r (_Float32, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __lgammaf32_r (_Float32, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 rintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __rintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 nextafterf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextafterf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 nextdownf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextdownf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float32 nextupf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextupf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 remainderf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __remainderf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 scalbnf32 (_Float32 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __scalbnf32 (_Float32 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 scalblnf32 (_Float32 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __scalblnf32 (_Float32 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 nearbyintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nearbyintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 roundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __roundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32 truncf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __truncf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 remquof32 (_Float32 __x, _Float32 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __remquof32 (_Float32 __x, _Float32 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 fdimf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fdimf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 fmaxf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaxf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32 fmaf32 (_Float32 __x, _Float32 __y, _Float32 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fmaf32 (_Float32 __x, _Float32 __y, _Float32 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 roundevenf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __roundevenf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef32 (_Float32 *__cx, const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 fmaxmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaxmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 fmaximumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf32 (const _Float32 *__x, const _Float32 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf32 (const _Float32 *__x, const _Float32 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float32 getpayloadf32 (const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __getpayloadf32 (const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf32 (_Float32 *__x, _Float32 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf32 (_Float32 *__x, _Float32 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 451 "/usr/include/math.h" 2 3 4
+# 467 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float64 acosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __acosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 asinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __asinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atan2f64 (_Float64 __y, _Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atan2f64 (_Float64 __y, _Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 cosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __cosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 sinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 tanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 coshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __coshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 sinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 tanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf64 (_Float64 __x, _Float64 *__sinx, _Float64 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf64 (_Float64 __x, _Float64 *__sinx, _Float64 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float64 acoshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __acoshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 asinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __asinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64 expf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __expf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 frexpf64 (_Float64 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __frexpf64 (_Float64 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 ldexpf64 (_Float64 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __ldexpf64 (_Float64 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 logf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __logf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 modff64 (_Float64 __x, _Float64 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __modff64 (_Float64 __x, _Float64 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float64 exp10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __exp10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 expm1f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __expm1f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log1pf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log1pf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 logbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __logbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 exp2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __exp2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float64 powf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __powf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float64 hypotf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __hypotf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 cbrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __cbrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 ceilf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __ceilf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fabsf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fabsf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 floorf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __floorf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmodf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fmodf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 copysignf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __copysignf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 nanf64 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nanf64 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 j0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __j0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 j1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __j1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 jnf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __jnf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 y0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __y0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 y1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __y1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 ynf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __ynf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64 erff64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __erff64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float64 erfcf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __erfcf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 lgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __lgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 tgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 lgammaf64_r (_Float64, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __lgammaf64_r (_Float64, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 rintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __rintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 nextafterf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextafterf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 nextdownf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextdownf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float64 nextupf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextupf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 remainderf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __remainderf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 scalbnf64 (_Float64 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __scalbnf64 (_Float64 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 scalblnf64 (_Float64 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __scalblnf64 (_Float64 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 nearbyintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nearbyintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 roundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __roundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64 truncf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __truncf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 remquof64 (_Float64 __x, _Float64 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __remquof64 (_Float64 __x, _Float64 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 fdimf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fdimf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 fmaxf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaxf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64 fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 roundevenf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __roundevenf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef64 (_Float64 *__cx, const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 fmaxmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaxmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 fmaximumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf64 (const _Float64 *__x, const _Float64 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf64 (const _Float64 *__x, const _Float64 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float64 getpayloadf64 (const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __getpayloadf64 (const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf64 (_Float64 *__x, _Float64 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf64 (_Float64 *__x, _Float64 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 468 "/usr/include/math.h" 2 3 4
+# 481 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 482 "/usr/include/math.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float128 acosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __acosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 asinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __asinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atan2f128 (_Float128 __y, _Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atan2f128 (_Float128 __y, _Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 cosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __cosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 sinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 tanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 coshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __coshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 sinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 tanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf128 (_Float128 __x, _Float128 *__sinx, _Float128 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf128 (_Float128 __x, _Float128 *__sinx, _Float128 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float128 acoshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __acoshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 asinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __asinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float128 expf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __expf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 frexpf128 (_Float128 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __frexpf128 (_Float128 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 ldexpf128 (_Float128 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __ldexpf128 (_Float128 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 logf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __logf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 modff128 (_Float128 __x, _Float128 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __modff128 (_Float128 __x, _Float128 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float128 exp10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __exp10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 expm1f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __expm1f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log1pf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log1pf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 logbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __logbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 exp2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __exp2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float128 powf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __powf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float128 hypotf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __hypotf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 cbrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __cbrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 ceilf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __ceilf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fabsf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fabsf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 floorf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __floorf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmodf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fmodf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 copysignf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __copysignf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 nanf128 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nanf128 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 j0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __j0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 j1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __j1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 jnf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __jnf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 y0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __y0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 y1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __y1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 ynf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __ynf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float128 erff128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __erff128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float128 erfcf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __erfcf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 lgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __lgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 tgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 lgammaf128_r (_Float128, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __lgammaf128_r (_Float128, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 rintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __rintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 nextafterf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextafterf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 nextdownf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextdownf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float128 nextupf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextupf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 remainderf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __remainderf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 scalbnf128 (_Float128 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __scalbnf128 (_Float128 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 scalblnf128 (_Float128 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __scalblnf128 (_Float128 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 nearbyintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nearbyintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 roundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __roundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float128 truncf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __truncf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 remquof128 (_Float128 __x, _Float128 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __remquof128 (_Float128 __x, _Float128 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 fdimf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fdimf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 fmaxf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaxf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float128 fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 roundevenf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __roundevenf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef128 (_Float128 *__cx, const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 fmaxmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaxmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 fmaximumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf128 (const _Float128 *__x, const _Float128 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf128 (const _Float128 *__x, const _Float128 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float128 getpayloadf128 (const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __getpayloadf128 (const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf128 (_Float128 *__x, _Float128 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf128 (_Float128 *__x, _Float128 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 485 "/usr/include/math.h" 2 3 4
+# 501 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float32x acosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __acosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x asinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __asinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atan2f32x (_Float32x __y, _Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atan2f32x (_Float32x __y, _Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x cosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __cosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x sinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x tanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x coshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __coshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x sinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x tanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf32x (_Float32x __x, _Float32x *__sinx, _Float32x *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf32x (_Float32x __x, _Float32x *__sinx, _Float32x *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float32x acoshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __acoshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x asinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __asinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32x expf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __expf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x frexpf32x (_Float32x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __frexpf32x (_Float32x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x ldexpf32x (_Float32x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __ldexpf32x (_Float32x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x logf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __logf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x modff32x (_Float32x __x, _Float32x *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __modff32x (_Float32x __x, _Float32x *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float32x exp10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __exp10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x expm1f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __expm1f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log1pf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log1pf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x logbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __logbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x exp2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __exp2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float32x powf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __powf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float32x hypotf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __hypotf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x cbrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __cbrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x ceilf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __ceilf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fabsf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fabsf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x floorf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __floorf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmodf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fmodf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x copysignf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __copysignf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x nanf32x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nanf32x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x j0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __j0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x j1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __j1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x jnf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __jnf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x y0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __y0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x y1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __y1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x ynf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __ynf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32x erff32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __erff32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float32x erfcf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __erfcf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x lgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __lgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x tgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x lgammaf32x_r (_Float32x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __lgammaf32x_r (_Float32x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x rintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __rintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x nextafterf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextafterf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x nextdownf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextdownf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float32x nextupf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextupf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x remainderf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __remainderf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x scalbnf32x (_Float32x __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __scalbnf32x (_Float32x __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x scalblnf32x (_Float32x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __scalblnf32x (_Float32x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x nearbyintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nearbyintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x roundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __roundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32x truncf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __truncf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x remquof32x (_Float32x __x, _Float32x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __remquof32x (_Float32x __x, _Float32x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x fdimf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fdimf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x fmaxf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaxf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32x fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x roundevenf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __roundevenf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef32x (_Float32x *__cx, const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x fmaxmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaxmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x fmaximumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf32x (const _Float32x *__x, const _Float32x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf32x (const _Float32x *__x, const _Float32x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float32x getpayloadf32x (const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __getpayloadf32x (const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf32x (_Float32x *__x, _Float32x __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf32x (_Float32x *__x, _Float32x __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 502 "/usr/include/math.h" 2 3 4
+# 518 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float64x acosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __acosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x asinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __asinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atan2f64x (_Float64x __y, _Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atan2f64x (_Float64x __y, _Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x cosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __cosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x sinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x tanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x coshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __coshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x sinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x tanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf64x (_Float64x __x, _Float64x *__sinx, _Float64x *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf64x (_Float64x __x, _Float64x *__sinx, _Float64x *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float64x acoshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __acoshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x asinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __asinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64x expf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __expf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x frexpf64x (_Float64x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __frexpf64x (_Float64x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x ldexpf64x (_Float64x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __ldexpf64x (_Float64x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x logf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __logf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x modff64x (_Float64x __x, _Float64x *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __modff64x (_Float64x __x, _Float64x *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float64x exp10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __exp10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x expm1f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __expm1f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log1pf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log1pf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x logbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __logbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x exp2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __exp2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float64x powf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __powf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float64x hypotf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __hypotf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x cbrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __cbrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x ceilf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __ceilf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fabsf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fabsf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x floorf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __floorf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmodf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fmodf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x copysignf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __copysignf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x nanf64x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nanf64x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x j0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __j0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x j1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __j1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x jnf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __jnf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x y0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __y0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x y1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __y1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x ynf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __ynf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64x erff64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __erff64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float64x erfcf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __erfcf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x lgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __lgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x tgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x lgammaf64x_r (_Float64x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __lgammaf64x_r (_Float64x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x rintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __rintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x nextafterf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextafterf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x nextdownf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextdownf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float64x nextupf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextupf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x remainderf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __remainderf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x scalbnf64x (_Float64x __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __scalbnf64x (_Float64x __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x scalblnf64x (_Float64x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __scalblnf64x (_Float64x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x nearbyintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nearbyintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x roundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __roundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64x truncf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __truncf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x remquof64x (_Float64x __x, _Float64x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __remquof64x (_Float64x __x, _Float64x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x fdimf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fdimf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x fmaxf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaxf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64x fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x roundevenf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __roundevenf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef64x (_Float64x *__cx, const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x fmaxmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaxmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x fmaximumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf64x (const _Float64x *__x, const _Float64x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf64x (const _Float64x *__x, const _Float64x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float64x getpayloadf64x (const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __getpayloadf64x (const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf64x (_Float64x *__x, _Float64x __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf64x (_Float64x *__x, _Float64x __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 519 "/usr/include/math.h" 2 3 4
+# 566 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern float fadd (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fdiv (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ffma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fmul (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsub (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 567 "/usr/include/math.h" 2 3 4
+# 587 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern float faddl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fdivl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ffmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fmull (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsubl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 588 "/usr/include/math.h" 2 3 4
+# 616 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern double daddl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ddivl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dfmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dmull (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dsqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dsubl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 617 "/usr/include/math.h" 2 3 4
+# 697 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 698 "/usr/include/math.h" 2 3 4
+# 707 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 708 "/usr/include/math.h" 2 3 4
+# 717 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 718 "/usr/include/math.h" 2 3 4
+# 727 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 728 "/usr/include/math.h" 2 3 4
+# 747 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 748 "/usr/include/math.h" 2 3 4
+# 757 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 758 "/usr/include/math.h" 2 3 4
+# 767 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 768 "/usr/include/math.h" 2 3 4
+# 787 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64 f64addf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64divf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64mulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64subf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 788 "/usr/include/math.h" 2 3 4
+# 797 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64 f64addf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64divf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64mulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64subf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 798 "/usr/include/math.h" 2 3 4
+# 817 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64x f64xaddf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xdivf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xfmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xmulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xsqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xsubf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 818 "/usr/include/math.h" 2 3 4
+# 854 "/usr/include/math.h" 3 4
+extern int signgam;
+# 934 "/usr/include/math.h" 3 4
+enum
+  {
+    FP_NAN =
+
+      0,
+    FP_INFINITE =
+
+      1,
+    FP_ZERO =
+
+      2,
+    FP_SUBNORMAL =
+
+      3,
+    FP_NORMAL =
+
+      4
+  };
+# 1054 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h" 3 4
+extern int __iscanonicall (long double __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 1055 "/usr/include/math.h" 2 3 4
+# 1471 "/usr/include/math.h" 3 4
+
+# 27 "./src/main/cli/cli.c" 2
+# 1 "./src/main/ctype.h" 1
+# 38 "./src/main/ctype.h"
+
+# 38 "./src/main/ctype.h"
+int isalnum (int __c);
+int isalpha (int __c);
+int iscntrl (int __c);
+int isdigit (int __c);
+int isgraph (int __c);
+int islower (int __c);
+int isprint (int __c);
+int ispunct (int __c);
+int isspace (int __c);
+int isupper (int __c);
+int isxdigit (int __c);
+int tolower (int __c);
+int toupper (int __c);
+int isblank (int __c);
+# 28 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 167 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 168 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 27 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 29 "./src/main/target/SITL/target.h" 2
+# 157 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+
+extern uint8_t eepromData[32768];
+
+
+
+
+
+
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 239 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+
+
+
+typedef struct sitlLatency_s {
+    uint32_t latencyUs;
+    uint32_t spikeUs;
+    uint32_t spikeInterval;
+    uint32_t count;
+} sitlLatency_t;
+
+void sitlLatencyInit(sitlLatency_t *latency, const char *envName);
+uint32_t sitlLatencyNext(sitlLatency_t *latency);
+# 169 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 170 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 32 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 171 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 172 "./src/main/platform.h" 2
+# 30 "./src/main/cli/cli.c" 2
+
+
+
+uint8_t cliMode = 0;
+
+
+
+
+
+
+
+# 1 "./src/main/blackbox/blackbox.h" 1
+# 21 "./src/main/blackbox/blackbox.h"
+       
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 21 "./src/main/build/build_config.h"
+       
+# 25 "./src/main/blackbox/blackbox.h" 2
+# 1 "./src/main/common/time.h" 1
+# 21 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/pg/pg.h" 1
+# 21 "./src/main/pg/pg.h"
+       
+
+
+
+
+
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+# 73 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 190 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+
+# 192 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 192 "./src/main/pg/pg.h"
+    pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 196 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 196 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 29 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 83 "./src/main/common/time.h" 3 4
+_Bool 
+# 83 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 84 "./src/main/common/time.h" 3 4
+_Bool 
+# 84 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 91 "./src/main/common/time.h" 3 4
+_Bool 
+# 91 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 95 "./src/main/common/time.h" 3 4
+_Bool 
+# 95 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 96 "./src/main/common/time.h" 3 4
+_Bool 
+# 96 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 98 "./src/main/common/time.h" 3 4
+_Bool 
+# 98 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 99 "./src/main/common/time.h" 3 4
+_Bool 
+# 99 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+
+void rtcPersistWrite(int16_t offsetMinutes);
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcPersistRead(rtcTime_t *t);
+# 26 "./src/main/blackbox/blackbox.h" 2
+
+
+typedef enum BlackboxDevice {
+    BLACKBOX_DEVICE_NONE = 0,
+
+    BLACKBOX_DEVICE_FLASH = 1,
+
+
+    BLACKBOX_DEVICE_SDCARD = 2,
+
+    BLACKBOX_DEVICE_SERIAL = 3
+} BlackboxDevice_e;
+
+typedef enum BlackboxMode {
+    BLACKBOX_MODE_NORMAL = 0,
+    BLACKBOX_MODE_MOTOR_TEST,
+    BLACKBOX_MODE_ALWAYS_ON,
+    BLACKBOX_MODE_STREAM
+} BlackboxMode;
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct blackboxConfig_s {
+    uint16_t p_ratio;
+    uint8_t device;
+    uint8_t record_acc;
+    uint8_t mode;
+} blackboxConfig_t;
+
+extern blackboxConfig_t blackboxConfig_System; extern blackboxConfig_t blackboxConfig_Copy; static inline const blackboxConfig_t* blackboxConfig(void) { return &blackboxConfig_System; } static inline blackboxConfig_t* blackboxConfigMutable(void) { return &blackboxConfig_System; } struct _dummy;
+
+union flightLogEventData_u;
+void blackboxLogEvent(FlightLogEvent event, union flightLogEventData_u *data);
+
+void blackboxInit(void);
+void blackboxUpdate(timeUs_t currentTimeUs);
+void blackboxSetStartDateTime(const char *dateTime, timeMs_t timeNowMs);
+int blackboxCalculatePDenom(int rateNum, int rateDenom);
+uint8_t blackboxGetRateDenom(void);
+void blackboxValidateConfig(void);
+void blackboxFinish(void);
+
+# 73 "./src/main/blackbox/blackbox.h" 3 4
+_Bool 
+# 73 "./src/main/blackbox/blackbox.h"
+    blackboxMayEditConfig(void);
+# 42 "./src/main/cli/cli.c" 2
+
+
+# 1 "./src/main/build/debug.h" 1
+# 21 "./src/main/build/debug.h"
+       
+
+
+extern int16_t debug[4];
+extern uint8_t debugMode;
+
+
+
+
+
+
+extern uint32_t sectionTimes[2][4];
+# 51 "./src/main/build/debug.h"
+typedef enum {
+    DEBUG_NONE,
+    DEBUG_CYCLETIME,
+    DEBUG_BATTERY,
+    DEBUG_GYRO_FILTERED,
+    DEBUG_ACCELEROMETER,
+    DEBUG_PIDLOOP,
+    DEBUG_GYRO_SCALED,
+    DEBUG_RC_INTERPOLATION,
+    DEBUG_ANGLERATE,
+    DEBUG_ESC_SENSOR,
+    DEBUG_SCHEDULER,
+    DEBUG_STACK,
+    DEBUG_ESC_SENSOR_RPM,
+    DEBUG_ESC_SENSOR_TMP,
+    DEBUG_ALTITUDE,
+    DEBUG_FFT,
+    DEBUG_FFT_TIME,
+    DEBUG_FFT_FREQ,
+    DEBUG_RX_FRSKY_SPI,
+    DEBUG_RX_SFHSS_SPI,
+    DEBUG_GYRO_RAW,
+    DEBUG_DUAL_GYRO,
+    DEBUG_DUAL_GYRO_RAW,
+    DEBUG_DUAL_GYRO_COMBINE,
+    DEBUG_DUAL_GYRO_DIFF,
+    DEBUG_MAX7456_SIGNAL,
+    DEBUG_MAX7456_SPICLOCK,
+    DEBUG_SBUS,
+    DEBUG_FPORT,
+    DEBUG_RANGEFINDER,
+    DEBUG_RANGEFINDER_QUALITY,
+    DEBUG_LIDAR_TF,
+    DEBUG_ADC_INTERNAL,
+    DEBUG_RUNAWAY_TAKEOFF,
+    DEBUG_SDIO,
+    DEBUG_CURRENT_SENSOR,
+    DEBUG_USB,
+    DEBUG_SMARTAUDIO,
+    DEBUG_RTH,
+    DEBUG_ITERM_RELAX,
+    DEBUG_ACRO_TRAINER,
+    DEBUG_RC_SMOOTHING,
+    DEBUG_RX_SIGNAL_LOSS,
+    DEBUG_RC_SMOOTHING_RATE,
+    DEBUG_ANTI_GRAVITY,
+    DEBUG_DYN_LPF,
+    DEBUG_RX_SPEKTRUM_SPI,
+    DEBUG_DSHOT_RPM_TELEMETRY,
+    DEBUG_RPM_FILTER,
+    DEBUG_D_MIN,
+    DEBUG_AC_CORRECTION,
+    DEBUG_AC_ERROR,
+    DEBUG_DUAL_GYRO_SCALED,
+    DEBUG_DSHOT_RPM_ERRORS,
+    DEBUG_CRSF_LINK_STATISTICS_UPLINK,
+    DEBUG_CRSF_LINK_STATISTICS_PWR,
+    DEBUG_CRSF_LINK_STATISTICS_DOWN,
+    DEBUG_COUNT
+} debugType_e;
+
+extern const char * const debugModeNames[DEBUG_COUNT];
+# 45 "./src/main/cli/cli.c" 2
+# 1 "./src/main/build/timings.h" 1
+# 21 "./src/main/build/timings.h"
+       
+
+
+
+# 1 "./src/main/drivers/time.h" 1
+# 21 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+
+uint32_t getCycleCounter(void);
+
+
+
+
+
+
+
+int32_t clockCyclesToMicros(int32_t clockCycles);
+int32_t clockCyclesTo10thMicros(int32_t clockCycles);
+uint32_t clockMicrosToCycles(uint32_t micros);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 26 "./src/main/build/timings.h" 2
+
+
+typedef enum {
+    TIMINGS_GYRO_READ,
+    TIMINGS_GYRO_FILTER,
+    TIMINGS_RC_COMMAND,
+    TIMINGS_PID,
+    TIMINGS_MIXER,
+    TIMINGS_MOTOR_OUTPUT,
+    TIMINGS_PID_SUBPROCESSES,
+    TIMINGS_PID_LOOP,
+    TIMINGS_COUNT
+} timingsProbe_e;
+
+extern const char * const timingsProbeNames[TIMINGS_COUNT];
+
+typedef struct timingsSummary_s {
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t avgCycles;
+    uint32_t maxCycles;
+    uint32_t p50Cycles;
+    uint32_t p90Cycles;
+    uint32_t p99Cycles;
+} timingsSummary_t;
+
+void timingsRecord(timingsProbe_e probe, uint32_t cycles);
+void timingsGetSummary(timingsProbe_e probe, timingsSummary_t *summary);
+void timingsReset(void);
+# 46 "./src/main/cli/cli.c" 2
+
+
+# 1 "./src/main/cli/settings.h" 1
+# 21 "./src/main/cli/settings.h"
+       
+
+
+
+
+
+
+typedef enum {
+    TABLE_OFF_ON = 0,
+    TABLE_UNIT,
+    TABLE_ALIGNMENT,
+
+    TABLE_GPS_PROVIDER,
+    TABLE_GPS_SBAS_MODE,
+
+
+
+
+
+
+    TABLE_BLACKBOX_DEVICE,
+    TABLE_BLACKBOX_MODE,
+
+    TABLE_CURRENT_METER,
+    TABLE_VOLTAGE_METER,
+
+    TABLE_GIMBAL_MODE,
+
+
+
+
+
+
+
+    TABLE_GYRO_HARDWARE_LPF,
+    TABLE_ACC_HARDWARE,
+
+    TABLE_BARO_HARDWARE,
+
+
+    TABLE_MAG_HARDWARE,
+
+    TABLE_DEBUG,
+    TABLE_MOTOR_PWM_PROTOCOL,
+    TABLE_RC_INTERPOLATION,
+    TABLE_RC_INTERPOLATION_CHANNELS,
+    TABLE_LOWPASS_TYPE,
+    TABLE_DTERM_LOWPASS_TYPE,
+    TABLE_ANTI_GRAVITY_MODE,
+    TABLE_FAILSAFE,
+    TABLE_FAILSAFE_SWITCH_MODE,
+    TABLE_CRASH_RECOVERY,
+
+
+
+    TABLE_BUS_TYPE,
+# 87 "./src/main/cli/settings.h"
+    TABLE_GYRO_OVERFLOW_CHECK,
+
+    TABLE_RATES_TYPE,
+
+
+
+
+
+
+
+    TABLE_GYRO,
+
+    TABLE_THROTTLE_LIMIT_TYPE,
+
+
+
+
+    TABLE_ITERM_RELAX,
+    TABLE_ITERM_RELAX_TYPE,
+
+
+    TABLE_ACRO_TRAINER_DEBUG,
+
+
+    TABLE_RC_SMOOTHING_TYPE,
+    TABLE_RC_SMOOTHING_DEBUG,
+    TABLE_RC_SMOOTHING_INPUT_TYPE,
+    TABLE_RC_SMOOTHING_DERIVATIVE_TYPE,
+
+
+
+
+
+
+
+    TABLE_GYRO_HARDWARE,
+
+    TABLE_SDCARD_MODE,
+
+
+    TABLE_LAUNCH_CONTROL_MODE,
+
+
+    TABLE_TPA_MODE,
+
+
+
+
+
+    TABLE_GYRO_FILTER_DEBUG,
+    TABLE_POSITION_ALT_SOURCE,
+    LOOKUP_TABLE_COUNT
+} lookupTableIndex_e;
+
+typedef struct lookupTableEntry_s {
+    const char * const *values;
+    const uint8_t valueCount;
+} lookupTableEntry_t;
+
+
+
+
+
+
+typedef enum {
+
+    VAR_UINT8 = (0 << 0),
+    VAR_INT8 = (1 << 0),
+    VAR_UINT16 = (2 << 0),
+    VAR_INT16 = (3 << 0),
+    VAR_UINT32 = (4 << 0),
+
+
+    MASTER_VALUE = (0 << 3),
+    PROFILE_VALUE = (1 << 3),
+    PROFILE_RATE_VALUE = (2 << 3),
+    HARDWARE_VALUE = (3 << 3),
+
+
+    MODE_DIRECT = (0 << 5),
+    MODE_LOOKUP = (1 << 5),
+    MODE_ARRAY = (2 << 5),
+    MODE_BITSET = (3 << 5),
+    MODE_STRING = (4 << 5),
+} cliValueFlag_e;
+
+
+
+
+
+
+typedef struct cliMinMaxConfig_s {
+    const int16_t min;
+    const int16_t max;
+} cliMinMaxConfig_t;
+
+typedef struct cliMinMaxUnsignedConfig_s {
+    const uint16_t min;
+    const uint16_t max;
+} cliMinMaxUnsignedConfig_t;
+
+typedef struct cliLookupTableConfig_s {
+    const lookupTableIndex_e tableIndex;
+} cliLookupTableConfig_t;
+
+typedef struct cliArrayLengthConfig_s {
+    const uint8_t length;
+} cliArrayLengthConfig_t;
+
+typedef struct cliStringLengthConfig_s {
+    const uint8_t minlength;
+    const uint8_t maxlength;
+    const uint8_t flags;
+} cliStringLengthConfig_t;
+
+
+
+
+typedef union {
+    cliLookupTableConfig_t lookup;
+    cliMinMaxConfig_t minmax;
+    cliMinMaxUnsignedConfig_t minmaxUnsigned;
+    cliArrayLengthConfig_t array;
+    cliStringLengthConfig_t string;
+    uint8_t bitpos;
+    uint32_t u32Max;
+} cliValueConfig_t;
+
+typedef struct clivalue_s {
+    const char *name;
+    const uint8_t type;
+    const cliValueConfig_t config;
+
+    pgn_t pgn;
+    uint16_t offset;
+} __attribute__((packed)) clivalue_t;
+
+
+extern const lookupTableEntry_t lookupTables[];
+extern const uint16_t valueTableEntryCount;
+
+extern const clivalue_t valueTable[];
+
+
+extern const char * const lookupTableGyroHardware[];
+
+extern const char * const lookupTableAccHardware[];
+
+
+extern const char * const lookupTableBaroHardware[];
+
+
+extern const char * const lookupTableMagHardware[];
+
+
+extern const char * const lookupTableRangefinderHardware[];
+
+extern const char * const lookupTableLedstripColors[];
+# 49 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/cms/cms.h" 1
+# 21 "./src/main/cms/cms.h"
+       
+
+# 1 "./src/main/drivers/display.h" 1
+# 21 "./src/main/drivers/display.h"
+       
+
+struct displayPortVTable_s;
+
+typedef struct displayPort_s {
+    const struct displayPortVTable_s *vTable;
+    void *device;
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t posX;
+    uint8_t posY;
+
+
+    
+# 34 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 34 "./src/main/drivers/display.h"
+        useFullscreen;
+    
+# 35 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 35 "./src/main/drivers/display.h"
+        cleared;
+    int8_t cursorRow;
+    int8_t grabCount;
+} displayPort_t;
+
+
+
+typedef struct displayPortVTable_s {
+    int (*grab)(displayPort_t *displayPort);
+    int (*release)(displayPort_t *displayPort);
+    int (*clearScreen)(displayPort_t *displayPort);
+    int (*drawScreen)(displayPort_t *displayPort);
+    int (*screenSize)(const displayPort_t *displayPort);
+    int (*writeString)(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *text);
+    int (*writeChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t c);
+    
+# 50 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 50 "./src/main/drivers/display.h"
+        (*isTransferInProgress)(const displayPort_t *displayPort);
+    int (*heartbeat)(displayPort_t *displayPort);
+    void (*resync)(displayPort_t *displayPort);
+    
+# 53 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 53 "./src/main/drivers/display.h"
+        (*isSynced)(const displayPort_t *displayPort);
+    uint32_t (*txBytesFree)(const displayPort_t *displayPort);
+} displayPortVTable_t;
+
+typedef struct displayPortProfile_s {
+    int8_t colAdjust;
+    int8_t rowAdjust;
+    
+# 60 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 60 "./src/main/drivers/display.h"
+        invert;
+    uint8_t blackBrightness;
+    uint8_t whiteBrightness;
+} displayPortProfile_t;
+
+
+
+void displayGrab(displayPort_t *instance);
+void displayRelease(displayPort_t *instance);
+void displayReleaseAll(displayPort_t *instance);
+
+# 70 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 70 "./src/main/drivers/display.h"
+    displayIsGrabbed(const displayPort_t *instance);
+void displayClearScreen(displayPort_t *instance);
+void displayDrawScreen(displayPort_t *instance);
+int displayScreenSize(const displayPort_t *instance);
+void displaySetXY(displayPort_t *instance, uint8_t x, uint8_t y);
+int displayWrite(displayPort_t *instance, uint8_t x, uint8_t y, const char *s);
+int displayWriteChar(displayPort_t *instance, uint8_t x, uint8_t y, uint8_t c);
+
+# 77 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 77 "./src/main/drivers/display.h"
+    displayIsTransferInProgress(const displayPort_t *instance);
+void displayHeartbeat(displayPort_t *instance);
+void displayResync(displayPort_t *instance);
+
+# 80 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 80 "./src/main/drivers/display.h"
+    displayIsSynced(const displayPort_t *instance);
+uint16_t displayTxBytesFree(const displayPort_t *instance);
+void displayInit(displayPort_t *instance, const displayPortVTable_t *vTable);
+# 24 "./src/main/cms/cms.h" 2
+
+
+
+typedef enum {
+    CMS_KEY_NONE,
+    CMS_KEY_UP,
+    CMS_KEY_DOWN,
+    CMS_KEY_LEFT,
+    CMS_KEY_RIGHT,
+    CMS_KEY_ESC,
+    CMS_KEY_MENU,
+    CMS_KEY_SAVEMENU,
+} cms_key_e;
+
+extern 
+# 38 "./src/main/cms/cms.h" 3 4
+      _Bool 
+# 38 "./src/main/cms/cms.h"
+           cmsInMenu;
+
+
+
+# 41 "./src/main/cms/cms.h" 3 4
+_Bool 
+# 41 "./src/main/cms/cms.h"
+    cmsDisplayPortRegister(displayPort_t *pDisplay);
+
+extern displayPort_t *pCurrentDisplay;
+
+
+void cmsInit(void);
+void cmsHandler(timeUs_t currentTimeUs);
+
+
+# 49 "./src/main/cms/cms.h" 3 4
+_Bool 
+# 49 "./src/main/cms/cms.h"
+    cmsDisplayPortSelect(displayPort_t *instance);
+void cmsMenuOpen(void);
+long cmsMenuChange(displayPort_t *pPort, const void *ptr);
+long cmsMenuExit(displayPort_t *pPort, const void *ptr);
+void cmsSetExternKey(cms_key_e extKey);
+# 51 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/common/axis.h" 1
+# 21 "./src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH
+} angle_index_t;
+# 53 "./src/main/cli/cli.c" 2
+# 1 "./src/main/common/color.h" 1
+# 21 "./src/main/common/color.h"
+       
+
+
+typedef enum {
+    RGB_RED = 0,
+    RGB_GREEN,
+    RGB_BLUE
+} colorComponent_e;
+
+
+
+struct rgbColor24bpp_s {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+
+typedef union {
+    struct rgbColor24bpp_s rgb;
+    uint8_t raw[(RGB_BLUE + 1)];
+} rgbColor24bpp_t;
+
+
+
+
+
+typedef enum {
+    HSV_HUE = 0,
+    HSV_SATURATION,
+    HSV_VALUE
+} hsvColorComponent_e;
+
+
+
+typedef struct hsvColor_s {
+    uint16_t h;
+    uint8_t s;
+    uint8_t v;
+} hsvColor_t;
+# 54 "./src/main/cli/cli.c" 2
+# 1 "./src/main/common/maths.h" 1
+# 21 "./src/main/common/maths.h"
+       
+# 63 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+int gcd(int num, int denom);
+float powerf(float base, int exp);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadband(float value, float deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+float scaleRangef(float x, float srcFrom, float srcTo, float destFrom, float destTo);
+
+void normalizeV(struct fp_vector *src, struct fp_vector *dest);
+
+void rotateV(struct fp_vector *v, fp_angles_t *delta);
+void buildRotationMatrix(fp_angles_t *delta, float matrix[3][3]);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+
+float exp_approx(float val);
+float log_approx(float val);
+float pow_approx(float a, float b);
+# 145 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 55 "./src/main/cli/cli.c" 2
+# 1 "./src/main/common/printf.h" 1
+# 105 "./src/main/common/printf.h"
+       
+
+
+
+typedef void (*putcf) (void *, char);
+extern putcf stdout_putf;
+extern void *stdout_putp;
+
+void init_printf(void *putp, void (*putf) (void *, char));
+
+int tfp_sprintf(char *s, const char *fmt, ...);
+int tfp_format(void *putp, void (*putf) (void *, char), const char *fmt, va_list va);
+# 56 "./src/main/cli/cli.c" 2
+# 1 "./src/main/common/printf_serial.h" 1
+# 22 "./src/main/common/printf_serial.h"
+struct serialPort_s;
+
+void printfSerialInit(void);
+void setPrintfSerialPort(struct serialPort_s *serialPort);
+
+int tfp_printf(const char *fmt, ...);
+# 57 "./src/main/cli/cli.c" 2
+# 1 "./src/main/common/strtol.h" 1
+# 21 "./src/main/common/strtol.h"
+       
+
+long strtol(const char * str, char ** endptr, int base);
+
+unsigned long strtoul(const char * str, char ** endptr, int base);
+
+int atoi(const char *str);
+# 58 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/common/typeconversion.h" 1
+# 21 "./src/main/common/typeconversion.h"
+       
+
+
+
+void uli2a(unsigned long int num, unsigned int base, int uc, char *bf);
+void li2a(long num, char *bf);
+void ui2a(unsigned int num, unsigned int base, int uc, char *bf);
+void i2a(int num, char *bf);
+char a2i(char ch, const char **src, int base, int *nump);
+char *ftoa(float x, char *floatString);
+float fastA2F(const char *p);
+
+
+char *itoa(int i, char *a, int r);
+# 60 "./src/main/cli/cli.c" 2
+
+
+# 1 "./src/main/config/config_eeprom.h" 1
+# 21 "./src/main/config/config_eeprom.h"
+       
+
+
+
+
+
+
+
+# 28 "./src/main/config/config_eeprom.h" 3 4
+_Bool 
+# 28 "./src/main/config/config_eeprom.h"
+    isEEPROMVersionValid(void);
+
+# 29 "./src/main/config/config_eeprom.h" 3 4
+_Bool 
+# 29 "./src/main/config/config_eeprom.h"
+    isEEPROMStructureValid(void);
+
+# 30 "./src/main/config/config_eeprom.h" 3 4
+_Bool 
+# 30 "./src/main/config/config_eeprom.h"
+    loadEEPROM(void);
+void writeConfigToEEPROM(void);
+uint16_t getEEPROMConfigSize(void);
+# 63 "./src/main/cli/cli.c" 2
+# 1 "./src/main/config/feature.h" 1
+# 21 "./src/main/config/feature.h"
+       
+# 32 "./src/main/config/feature.h"
+typedef enum {
+    FEATURE_RX_PPM = 1 << 0,
+    FEATURE_INFLIGHT_ACC_CAL = 1 << 2,
+    FEATURE_RX_SERIAL = 1 << 3,
+    FEATURE_MOTOR_STOP = 1 << 4,
+    FEATURE_SERVO_TILT = 1 << 5,
+    FEATURE_SOFTSERIAL = 1 << 6,
+    FEATURE_GPS = 1 << 7,
+    FEATURE_RANGEFINDER = 1 << 9,
+    FEATURE_TELEMETRY = 1 << 10,
+    FEATURE_3D = 1 << 12,
+    FEATURE_RX_PARALLEL_PWM = 1 << 13,
+    FEATURE_RX_MSP = 1 << 14,
+    FEATURE_RSSI_ADC = 1 << 15,
+    FEATURE_LED_STRIP = 1 << 16,
+    FEATURE_DASHBOARD = 1 << 17,
+    FEATURE_OSD = 1 << 18,
+    FEATURE_CHANNEL_FORWARDING = 1 << 20,
+    FEATURE_TRANSPONDER = 1 << 21,
+    FEATURE_AIRMODE = 1 << 22,
+    FEATURE_RX_SPI = 1 << 25,
+    FEATURE_SOFTSPI = 1 << 26,
+    FEATURE_ESC_SENSOR = 1 << 27,
+    FEATURE_ANTI_GRAVITY = 1 << 28,
+    FEATURE_DYNAMIC_FILTER = 1 << 29,
+} features_e;
+
+typedef struct featureConfig_s {
+    uint32_t enabledFeatures;
+} featureConfig_t;
+
+extern featureConfig_t featureConfig_System; extern featureConfig_t featureConfig_Copy; static inline const featureConfig_t* featureConfig(void) { return &featureConfig_System; } static inline featureConfig_t* featureConfigMutable(void) { return &featureConfig_System; } struct _dummy;
+
+
+# 65 "./src/main/config/feature.h" 3 4
+_Bool 
+# 65 "./src/main/config/feature.h"
+    featureIsEnabled(const uint32_t mask);
+void featureEnable(const uint32_t mask);
+void featureDisable(const uint32_t mask);
+void featureDisableAll(void);
+uint32_t featureMask(void);
+
+void featureSet(const uint32_t mask, uint32_t *features);
+void featureClear(const uint32_t mask, uint32_t *features);
+# 64 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/drivers/accgyro/accgyro.h" 1
+# 21 "./src/main/drivers/accgyro/accgyro.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/exti.h" 1
+# 21 "./src/main/drivers/exti.h"
+       
+
+
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 21 "./src/main/drivers/io_types.h"
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 48 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 26 "./src/main/drivers/exti.h" 2
+
+typedef enum {
+    EXTI_TRIGGER_RISING = 0,
+    EXTI_TRIGGER_FALLING = 1,
+    EXTI_TRIGGER_BOTH = 2
+} extiTrigger_t;
+
+typedef struct extiCallbackRec_s extiCallbackRec_t;
+typedef void extiHandlerCallback(extiCallbackRec_t *self);
+
+struct extiCallbackRec_s {
+    extiHandlerCallback *fn;
+};
+
+void EXTIInit(void);
+
+void EXTIHandlerInit(extiCallbackRec_t *cb, extiHandlerCallback *fn);
+void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, ioConfig_t config, extiTrigger_t trigger);
+void EXTIRelease(IO_t io);
+void EXTIEnable(IO_t io, 
+# 45 "./src/main/drivers/exti.h" 3 4
+                        _Bool 
+# 45 "./src/main/drivers/exti.h"
+                             enable);
+# 27 "./src/main/drivers/accgyro/accgyro.h" 2
+# 1 "./src/main/drivers/bus.h" 1
+# 21 "./src/main/drivers/bus.h"
+       
+
+
+
+# 1 "./src/main/drivers/bus_i2c.h" 1
+# 21 "./src/main/drivers/bus_i2c.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/rcc_types.h" 1
+# 21 "./src/main/drivers/rcc_types.h"
+       
+
+
+
+
+typedef uint8_t rccPeriphTag_t;
+# 27 "./src/main/drivers/bus_i2c.h" 2
+
+
+
+
+
+typedef enum I2CDevice {
+    I2CINVALID = -1,
+    I2CDEV_1 = 0,
+    I2CDEV_2,
+    I2CDEV_3,
+    I2CDEV_4,
+} I2CDevice;
+# 58 "./src/main/drivers/bus_i2c.h"
+struct i2cConfig_s;
+void i2cHardwareConfigure(const struct i2cConfig_s *i2cConfig);
+void i2cInit(I2CDevice device);
+
+# 61 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 61 "./src/main/drivers/bus_i2c.h"
+    i2cWriteBuffer(I2CDevice device, uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data);
+
+# 62 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 62 "./src/main/drivers/bus_i2c.h"
+    i2cWrite(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t data);
+
+# 63 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 63 "./src/main/drivers/bus_i2c.h"
+    i2cRead(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf);
+
+uint16_t i2cGetErrorCounter(void);
+# 26 "./src/main/drivers/bus.h" 2
+
+
+typedef enum {
+    BUSTYPE_NONE = 0,
+    BUSTYPE_I2C,
+    BUSTYPE_SPI,
+    BUSTYPE_MPU_SLAVE,
+    BUSTYPE_GYRO_AUTO,
+} busType_e;
+
+struct spiDevice_s;
+
+typedef struct busDevice_s {
+    busType_e bustype;
+    union {
+        struct deviceSpi_s {
+            SPI_TypeDef *instance;
+# 51 "./src/main/drivers/bus.h"
+            IO_t csnPin;
+        } spi;
+        struct deviceI2C_s {
+            I2CDevice device;
+            uint8_t address;
+        } i2c;
+        struct deviceMpuSlave_s {
+            const struct busDevice_s *master;
+            uint8_t address;
+        } mpuSlave;
+    } busdev_u;
+} busDevice_t;
+
+
+
+
+
+
+# 68 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 68 "./src/main/drivers/bus.h"
+    busWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+
+# 69 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 69 "./src/main/drivers/bus.h"
+    busReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+uint8_t busReadRegister(const busDevice_t *bus, uint8_t reg);
+# 28 "./src/main/drivers/accgyro/accgyro.h" 2
+# 1 "./src/main/drivers/sensor.h" 1
+# 21 "./src/main/drivers/sensor.h"
+       
+
+
+
+
+typedef enum {
+    ALIGN_DEFAULT = 0,
+    CW0_DEG = 1,
+    CW90_DEG = 2,
+    CW180_DEG = 3,
+    CW270_DEG = 4,
+    CW0_DEG_FLIP = 5,
+    CW90_DEG_FLIP = 6,
+    CW180_DEG_FLIP = 7,
+    CW270_DEG_FLIP = 8
+} sensor_align_e;
+
+typedef 
+# 38 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 38 "./src/main/drivers/sensor.h"
+            (*sensorInterruptFuncPtr)(void);
+struct magDev_s;
+typedef 
+# 40 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 40 "./src/main/drivers/sensor.h"
+            (*sensorMagInitFuncPtr)(struct magDev_s *magdev);
+typedef 
+# 41 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 41 "./src/main/drivers/sensor.h"
+            (*sensorMagReadFuncPtr)(struct magDev_s *magdev, int16_t *data);
+struct accDev_s;
+typedef void (*sensorAccInitFuncPtr)(struct accDev_s *acc);
+typedef 
+# 44 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 44 "./src/main/drivers/sensor.h"
+            (*sensorAccReadFuncPtr)(struct accDev_s *acc);
+struct gyroDev_s;
+typedef void (*sensorGyroInitFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 47 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 47 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 48 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 48 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadDataFuncPtr)(struct gyroDev_s *gyro, int16_t *data);
+# 29 "./src/main/drivers/accgyro/accgyro.h" 2
+# 1 "./src/main/drivers/accgyro/accgyro_mpu.h" 1
+# 21 "./src/main/drivers/accgyro/accgyro_mpu.h"
+       
+# 143 "./src/main/drivers/accgyro/accgyro_mpu.h"
+enum gyro_fsr_e {
+    INV_FSR_250DPS = 0,
+    INV_FSR_500DPS,
+    INV_FSR_1000DPS,
+    INV_FSR_2000DPS,
+    NUM_GYRO_FSR
+};
+
+enum icm_high_range_gyro_fsr_e {
+    ICM_HIGH_RANGE_FSR_500DPS = 0,
+    ICM_HIGH_RANGE_FSR_1000DPS,
+    ICM_HIGH_RANGE_FSR_2000DPS,
+    ICM_HIGH_RANGE_FSR_4000DPS,
+    NUM_ICM_HIGH_RANGE_GYRO_FSR
+};
+
+enum clock_sel_e {
+    INV_CLK_INTERNAL = 0,
+    INV_CLK_PLL,
+    NUM_CLK
+};
+
+enum accel_fsr_e {
+    INV_FSR_2G = 0,
+    INV_FSR_4G,
+    INV_FSR_8G,
+    INV_FSR_16G,
+    NUM_ACCEL_FSR
+};
+
+enum icm_high_range_accel_fsr_e {
+    ICM_HIGH_RANGE_FSR_4G = 0,
+    ICM_HIGH_RANGE_FSR_8G,
+    ICM_HIGH_RANGE_FSR_16G,
+    ICM_HIGH_RANGE_FSR_32G,
+    NUM_ICM_HIGH_RANGE_ACCEL_FSR
+};
+
+typedef enum {
+    GYRO_OVERFLOW_NONE = 0x00,
+    GYRO_OVERFLOW_X = 0x01,
+    GYRO_OVERFLOW_Y = 0x02,
+    GYRO_OVERFLOW_Z = 0x04
+} gyroOverflow_e;
+
+typedef enum {
+    MPU_NONE,
+    MPU_3050,
+    MPU_60x0,
+    MPU_60x0_SPI,
+    MPU_65xx_I2C,
+    MPU_65xx_SPI,
+    MPU_9250_SPI,
+    ICM_20601_SPI,
+    ICM_20602_SPI,
+    ICM_20608_SPI,
+    ICM_20649_SPI,
+    ICM_20689_SPI,
+    BMI_160_SPI,
+    L3GD20_SPI,
+} mpuSensor_e;
+
+typedef enum {
+    MPU_HALF_RESOLUTION,
+    MPU_FULL_RESOLUTION
+} mpu6050Resolution_e;
+
+typedef struct mpuDetectionResult_s {
+    mpuSensor_e sensor;
+    mpu6050Resolution_e resolution;
+} mpuDetectionResult_t;
+
+struct gyroDev_s;
+struct gyroDeviceConfig_s;
+void mpuGyroInit(struct gyroDev_s *gyro);
+
+# 218 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 218 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuGyroRead(struct gyroDev_s *gyro);
+
+# 219 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 219 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuGyroReadSPI(struct gyroDev_s *gyro);
+void mpuPreInit(const struct gyroDeviceConfig_s *config);
+
+# 221 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 221 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuDetect(struct gyroDev_s *gyro, const struct gyroDeviceConfig_s *config);
+uint8_t mpuGyroDLPF(struct gyroDev_s *gyro);
+uint8_t mpuGyroReadRegister(const busDevice_t *bus, uint8_t reg);
+
+struct accDev_s;
+
+# 226 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 226 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuAccRead(struct accDev_s *acc);
+# 30 "./src/main/drivers/accgyro/accgyro.h" 2
+
+#pragma GCC diagnostic push
+
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+# 43 "/usr/include/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+
+
+
+extern int clone (int (*__fn) (void *__arg), void *__child_stack,
+    int __flags, void *__arg, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int unshare (int __flags) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getcpu (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int getcpu (unsigned int *, unsigned int *) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setns (int __fd, int __nstype) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 130 "/usr/include/sched.h" 3 4
+extern int sched_setaffinity (__pid_t __pid, size_t __cpusetsize,
+         const cpu_set_t *__cpuset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getaffinity (__pid_t __pid, size_t __cpusetsize,
+         cpu_set_t *__cpuset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 23 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 73 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timex.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+struct timex
+{
+# 58 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+  unsigned int modes;
+  __syscall_slong_t offset;
+  __syscall_slong_t freq;
+  __syscall_slong_t maxerror;
+  __syscall_slong_t esterror;
+  int status;
+  __syscall_slong_t constant;
+  __syscall_slong_t precision;
+  __syscall_slong_t tolerance;
+  struct timeval time;
+  __syscall_slong_t tick;
+  __syscall_slong_t ppsfreq;
+  __syscall_slong_t jitter;
+  int shift;
+  __syscall_slong_t stabil;
+  __syscall_slong_t jitcnt;
+  __syscall_slong_t calcnt;
+  __syscall_slong_t errcnt;
+  __syscall_slong_t stbcnt;
+
+  int tai;
+
+
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32;
+
+};
+# 74 "/usr/include/x86_64-linux-gnu/bits/time.h" 2 3 4
+
+
+
+
+extern int clock_adjtime (__clockid_t __clock_id, struct timex *__utx) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 90 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+# 48 "/usr/include/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern char *strptime (const char *__restrict __s,
+         const char *__restrict __fmt, struct tm *__tp)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *strptime_l (const char *__restrict __s,
+    const char *__restrict __fmt, struct tm *__tp,
+    locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int timespec_get (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 399 "/usr/include/time.h" 3 4
+extern int timespec_getres (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 425 "/usr/include/time.h" 3 4
+extern int getdate_err;
+# 434 "/usr/include/time.h" 3 4
+extern struct tm *getdate (const char *__string);
+# 448 "/usr/include/time.h" 3 4
+extern int getdate_r (const char *__restrict __string,
+        struct tm *__restrict __resbufp);
+
+
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+
+extern long int __sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+# 34 "/usr/include/pthread.h" 2 3 4
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+  , PTHREAD_MUTEX_FAST_NP = PTHREAD_MUTEX_TIMED_NP
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+
+
+
+
+extern int pthread_tryjoin_np (pthread_t __th, void **__thread_return) __attribute__ ((__nothrow__ , __leaf__));
+# 233 "/usr/include/pthread.h" 3 4
+extern int pthread_timedjoin_np (pthread_t __th, void **__thread_return,
+     const struct timespec *__abstime);
+# 243 "/usr/include/pthread.h" 3 4
+extern int pthread_clockjoin_np (pthread_t __th, void **__thread_return,
+                                 clockid_t __clockid,
+     const struct timespec *__abstime);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_attr_setaffinity_np (pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern int pthread_attr_getaffinity_np (const pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+extern int pthread_getattr_default_np (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_setsigmask_np (pthread_attr_t *__attr,
+           const __sigset_t *sigmask);
+
+
+
+
+extern int pthread_attr_getsigmask_np (const pthread_attr_t *__attr,
+           __sigset_t *sigmask);
+
+
+
+
+
+
+
+extern int pthread_setattr_default_np (const pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_getattr_np (pthread_t __th, pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int pthread_getname_np (pthread_t __target_thread, char *__buf,
+          size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int pthread_setname_np (pthread_t __target_thread, const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+extern int pthread_getconcurrency (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setconcurrency (int __level) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int pthread_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int pthread_yield (void) __asm__ ("" "sched_yield") __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("pthread_yield is deprecated, use sched_yield instead")))
+                                                      ;
+
+
+
+
+
+
+
+extern int pthread_setaffinity_np (pthread_t __th, size_t __cpusetsize,
+       const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getaffinity_np (pthread_t __th, size_t __cpusetsize,
+       cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 732 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel_defer (__pthread_unwind_buf_t *__buf)
+     ;
+# 745 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel_restore (__pthread_unwind_buf_t *__buf)
+  ;
+
+
+
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 817 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_clocklock (pthread_mutex_t *__restrict __mutex,
+        clockid_t __clockid,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_consistent_np (pthread_mutex_t *) __asm__ ("" "pthread_mutex_consistent") __attribute__ ((__nothrow__ , __leaf__))
+                                __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutex_consistent_np is deprecated, use pthread_mutex_consistent")))
+                                                                         ;
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_getrobust_np (pthread_mutexattr_t *, int *) __asm__ ("" "pthread_mutexattr_getrobust") __attribute__ ((__nothrow__ , __leaf__))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutexattr_getrobust_np is deprecated, use pthread_mutexattr_getrobust")))
+                                                                               ;
+
+
+
+
+
+
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_setrobust_np (pthread_mutexattr_t *, int) __asm__ ("" "pthread_mutexattr_setrobust") __attribute__ ((__nothrow__ , __leaf__))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutexattr_setrobust_np is deprecated, use pthread_mutexattr_setrobust")))
+                                                                               ;
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1004 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockrdlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1051 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockwrlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1171 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_clockwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       __clockid_t __clock_id,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 4)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+# 1346 "/usr/include/pthread.h" 3 4
+
+# 34 "./src/main/drivers/accgyro/accgyro.h" 2
+
+
+
+
+
+# 38 "./src/main/drivers/accgyro/accgyro.h"
+typedef enum {
+    GYRO_NONE = 0,
+    GYRO_DEFAULT,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_MPU6000,
+    GYRO_MPU6500,
+    GYRO_MPU9250,
+    GYRO_ICM20601,
+    GYRO_ICM20602,
+    GYRO_ICM20608G,
+    GYRO_ICM20649,
+    GYRO_ICM20689,
+    GYRO_BMI160,
+    GYRO_FAKE
+} gyroHardware_e;
+
+typedef enum {
+    GYRO_HARDWARE_LPF_NORMAL,
+    GYRO_HARDWARE_LPF_1KHZ_SAMPLE,
+
+    GYRO_HARDWARE_LPF_EXPERIMENTAL
+
+} gyroHardwareLpf_e;
+
+typedef enum {
+    GYRO_32KHZ_HARDWARE_LPF_NORMAL,
+    GYRO_32KHZ_HARDWARE_LPF_EXPERIMENTAL
+} gyro32khzHardwareLpf;
+
+typedef enum {
+    GYRO_RATE_1_kHz,
+    GYRO_RATE_1100_Hz,
+    GYRO_RATE_3200_Hz,
+    GYRO_RATE_8_kHz,
+    GYRO_RATE_9_kHz,
+    GYRO_RATE_32_kHz,
+} gyroRateKHz_e;
+
+typedef struct gyroDev_s {
+
+    pthread_mutex_t lock;
+
+    sensorGyroInitFuncPtr initFn;
+    sensorGyroReadFuncPtr readFn;
+    sensorGyroReadDataFuncPtr temperatureFn;
+    extiCallbackRec_t exti;
+    busDevice_t bus;
+    float scale;
+    float gyroZero[3];
+    float gyroADC[3];
+    float gyroADCf[3];
+    int32_t gyroADCRawPrevious[3];
+    int16_t gyroADCRaw[3];
+    int16_t temperature;
+    mpuDetectionResult_t mpuDetectionResult;
+    sensor_align_e gyroAlign;
+    gyroRateKHz_e gyroRateKHz;
+    
+# 98 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 98 "./src/main/drivers/accgyro/accgyro.h"
+        dataReady;
+    
+# 99 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 99 "./src/main/drivers/accgyro/accgyro.h"
+        gyro_high_fsr;
+    uint8_t hardware_lpf;
+    uint8_t hardware_32khz_lpf;
+    uint8_t mpuDividerDrops;
+    ioTag_t mpuIntExtiTag;
+    uint8_t gyroHasOverflowProtection;
+    gyroHardware_e gyroHardware;
+} gyroDev_t;
+
+typedef struct accDev_s {
+
+    pthread_mutex_t lock;
+
+    float acc_1G_rec;
+    sensorAccInitFuncPtr initFn;
+    sensorAccReadFuncPtr readFn;
+    busDevice_t bus;
+    uint16_t acc_1G;
+    int16_t ADCRaw[3];
+    mpuDetectionResult_t mpuDetectionResult;
+    sensor_align_e accAlign;
+    
+# 120 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 120 "./src/main/drivers/accgyro/accgyro.h"
+        dataReady;
+    
+# 121 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 121 "./src/main/drivers/accgyro/accgyro.h"
+        acc_high_fsr;
+    char revisionCode;
+    uint8_t filler[2];
+} accDev_t;
+
+static inline void accDevLock(accDev_t *acc)
+{
+
+    pthread_mutex_lock(&acc->lock);
+
+
+
+}
+
+static inline void accDevUnLock(accDev_t *acc)
+{
+
+    pthread_mutex_unlock(&acc->lock);
+
+
+
+}
+
+static inline void gyroDevLock(gyroDev_t *gyro)
+{
+
+    pthread_mutex_lock(&gyro->lock);
+
+
+
+}
+
+static inline void gyroDevUnLock(gyroDev_t *gyro)
+{
+
+    pthread_mutex_unlock(&gyro->lock);
+
+
+
+}
+#pragma GCC diagnostic pop
+# 66 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/adc.h" 1
+# 21 "./src/main/drivers/adc.h"
+       
+# 46 "./src/main/drivers/adc.h"
+typedef enum ADCDevice {
+    ADCINVALID = -1,
+    ADCDEV_1 = 0,
+
+
+
+
+
+
+
+    ADCDEV_COUNT
+} ADCDevice;
+
+
+
+
+typedef enum {
+    ADC_BATTERY = 0,
+    ADC_CURRENT = 1,
+    ADC_EXTERNAL1 = 2,
+    ADC_RSSI = 3,
+
+
+
+
+
+
+    ADC_CHANNEL_COUNT
+} AdcChannel;
+
+typedef struct adcOperatingConfig_s {
+    ioTag_t tag;
+
+
+
+    uint8_t adcChannel;
+    uint8_t dmaIndex;
+    
+# 83 "./src/main/drivers/adc.h" 3 4
+   _Bool 
+# 83 "./src/main/drivers/adc.h"
+        enabled;
+    uint8_t sampleTime;
+} adcOperatingConfig_t;
+
+struct adcConfig_s;
+void adcInit(const struct adcConfig_s *config);
+uint16_t adcGetChannel(uint8_t channel);
+# 67 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/buf_writer.h" 1
+# 21 "./src/main/drivers/buf_writer.h"
+       
+
+
+typedef void (*bufWrite_t)(void *arg, void *data, int count);
+
+typedef struct bufWriter_s {
+    bufWrite_t writer;
+    void *arg;
+    uint8_t capacity;
+    uint8_t at;
+    uint8_t data[];
+} bufWriter_t;
+
+
+
+
+
+
+bufWriter_t *bufWriterInit(uint8_t *b, int total_size, bufWrite_t writer, void *p);
+void bufWriterAppend(bufWriter_t *b, uint8_t ch);
+void bufWriterFlush(bufWriter_t *b);
+# 68 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/bus_spi.h" 1
+# 21 "./src/main/drivers/bus_spi.h"
+       
+
+
+
+
+
+
+
+# 1 "./src/main/pg/pg_ids.h" 1
+# 21 "./src/main/pg/pg_ids.h"
+       
+# 30 "./src/main/drivers/bus_spi.h" 2
+# 52 "./src/main/drivers/bus_spi.h"
+typedef enum {
+    SPI_CLOCK_INITIALIZATION = 256,
+# 71 "./src/main/drivers/bus_spi.h"
+    SPI_CLOCK_SLOW = 128,
+    SPI_CLOCK_STANDARD = 4,
+    SPI_CLOCK_FAST = 2,
+    SPI_CLOCK_ULTRAFAST = 2
+
+} SPIClockDivider_e;
+# 86 "./src/main/drivers/bus_spi.h"
+typedef enum {
+    SPI_MODE0_POL_LOW_EDGE_1ST = 0,
+    SPI_MODE1_POL_LOW_EDGE_2ND,
+    SPI_MODE2_POL_HIGH_EDGE_1ST,
+    SPI_MODE3_POL_HIGH_EDGE_2ND
+} SPIMode_e;
+
+typedef enum SPIDevice {
+    SPIINVALID = -1,
+    SPIDEV_1 = 0,
+    SPIDEV_2,
+    SPIDEV_3,
+    SPIDEV_4,
+    SPIDEV_5,
+    SPIDEV_6
+} SPIDevice;
+# 120 "./src/main/drivers/bus_spi.h"
+void spiPreinit(void);
+void spiPreinitRegister(ioTag_t iotag, uint8_t iocfg, uint8_t init);
+void spiPreinitByIO(IO_t io);
+void spiPreinitByTag(ioTag_t tag);
+
+
+# 125 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 125 "./src/main/drivers/bus_spi.h"
+    spiInit(SPIDevice device);
+void spiSetDivisor(SPI_TypeDef *instance, uint16_t divisor);
+uint8_t spiTransferByte(SPI_TypeDef *instance, uint8_t data);
+
+# 128 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 128 "./src/main/drivers/bus_spi.h"
+    spiIsBusBusy(SPI_TypeDef *instance);
+
+
+# 130 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 130 "./src/main/drivers/bus_spi.h"
+    spiTransfer(SPI_TypeDef *instance, const uint8_t *txData, uint8_t *rxData, int len);
+
+uint16_t spiGetErrorCounter(SPI_TypeDef *instance);
+void spiResetErrorCounter(SPI_TypeDef *instance);
+
+SPIDevice spiDeviceByInstance(SPI_TypeDef *instance);
+SPI_TypeDef *spiInstanceByDevice(SPIDevice device);
+
+
+
+
+
+
+# 142 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 142 "./src/main/drivers/bus_spi.h"
+    spiBusIsBusBusy(const busDevice_t *bus);
+
+
+# 144 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 144 "./src/main/drivers/bus_spi.h"
+    spiBusTransfer(const busDevice_t *bus, const uint8_t *txData, uint8_t *rxData, int length);
+
+uint8_t spiBusTransferByte(const busDevice_t *bus, uint8_t data);
+void spiBusWriteByte(const busDevice_t *bus, uint8_t data);
+
+# 148 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 148 "./src/main/drivers/bus_spi.h"
+    spiBusRawTransfer(const busDevice_t *bus, const uint8_t *txData, uint8_t *rxData, int len);
+
+
+# 150 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 150 "./src/main/drivers/bus_spi.h"
+    spiBusWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+
+# 151 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 151 "./src/main/drivers/bus_spi.h"
+    spiBusRawReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+
+# 152 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 152 "./src/main/drivers/bus_spi.h"
+    spiBusReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+void spiBusWriteRegisterBuffer(const busDevice_t *bus, uint8_t reg, const uint8_t *data, uint8_t length);
+uint8_t spiBusRawReadRegister(const busDevice_t *bus, uint8_t reg);
+uint8_t spiBusReadRegister(const busDevice_t *bus, uint8_t reg);
+void spiBusSetInstance(busDevice_t *bus, SPI_TypeDef *instance);
+void spiBusSetDivisor(busDevice_t *bus, SPIClockDivider_e divider);
+
+void spiBusTransactionInit(busDevice_t *bus, SPIMode_e mode, SPIClockDivider_e divider);
+void spiBusTransactionSetup(const busDevice_t *bus);
+void spiBusTransactionBegin(const busDevice_t *bus);
+void spiBusTransactionEnd(const busDevice_t *bus);
+
+# 163 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 163 "./src/main/drivers/bus_spi.h"
+    spiBusTransactionWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+uint8_t spiBusTransactionReadRegister(const busDevice_t *bus, uint8_t reg);
+
+# 165 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 165 "./src/main/drivers/bus_spi.h"
+    spiBusTransactionReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+
+# 166 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 166 "./src/main/drivers/bus_spi.h"
+    spiBusTransactionTransfer(const busDevice_t *bus, const uint8_t *txData, uint8_t *rxData, int length);
+
+
+
+
+
+struct spiPinConfig_s;
+void spiPinConfigure(const struct spiPinConfig_s *pConfig);
+# 69 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/dma_reqmap.h" 1
+# 25 "./src/main/drivers/dma_reqmap.h"
+# 1 "./src/main/drivers/timer.h" 1
+# 21 "./src/main/drivers/timer.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/timer_def.h" 1
+# 21 "./src/main/drivers/timer_def.h"
+       
+# 29 "./src/main/drivers/timer.h" 2
+
+# 1 "./src/main/pg/timerio.h" 1
+# 21 "./src/main/pg/timerio.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/io.h" 1
+# 21 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 21 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_GYRO_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_GYRO_EXTI,
+    OWNER_BARO_EXTI,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_TRANSPONDER,
+    OWNER_VTX_POWER,
+    OWNER_VTX_CS,
+    OWNER_VTX_DATA,
+    OWNER_VTX_CLK,
+    OWNER_COMPASS_CS,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_USB_MSC_PIN,
+    OWNER_MCO,
+    OWNER_RX_SPI_BIND,
+    OWNER_RX_SPI_LED,
+    OWNER_PREINIT,
+    OWNER_RX_SPI_EXTI,
+    OWNER_RX_SPI_CC2500_TX_EN,
+    OWNER_RX_SPI_CC2500_LNA_EN,
+    OWNER_RX_SPI_CC2500_ANT_SEL,
+    OWNER_QUADSPI_CLK,
+    OWNER_QUADSPI_BK1IO0,
+    OWNER_QUADSPI_BK1IO1,
+    OWNER_QUADSPI_BK1IO2,
+    OWNER_QUADSPI_BK1IO3,
+    OWNER_QUADSPI_BK1CS,
+    OWNER_QUADSPI_BK2IO0,
+    OWNER_QUADSPI_BK2IO1,
+    OWNER_QUADSPI_BK2IO2,
+    OWNER_QUADSPI_BK2IO3,
+    OWNER_QUADSPI_BK2CS,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 29 "./src/main/drivers/io.h" 2
+# 128 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 21 "./src/main/drivers/io_def.h"
+       
+# 54 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 21 "./src/main/drivers/io_def_generated.h"
+       
+# 55 "./src/main/drivers/io_def.h" 2
+# 129 "./src/main/drivers/io.h" 2
+
+
+# 130 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 130 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 131 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 131 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+
+# 139 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 139 "./src/main/drivers/io.h"
+    IOIsFreeOrPreinit(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 27 "./src/main/pg/timerio.h" 2
+# 31 "./src/main/drivers/timer.h" 2
+
+
+
+
+
+typedef uint16_t captureCompare_t;
+# 64 "./src/main/drivers/timer.h"
+typedef uint32_t timCCR_t;
+typedef uint32_t timCCER_t;
+typedef uint32_t timSR_t;
+typedef uint32_t timCNT_t;
+
+
+
+
+typedef enum {
+    TIM_USE_ANY = 0x0,
+    TIM_USE_NONE = 0x0,
+    TIM_USE_PPM = 0x1,
+    TIM_USE_PWM = 0x2,
+    TIM_USE_MOTOR = 0x4,
+    TIM_USE_SERVO = 0x8,
+    TIM_USE_LED = 0x10,
+    TIM_USE_TRANSPONDER = 0x20,
+    TIM_USE_BEEPER = 0x40,
+    TIM_USE_CAMERA_CONTROL = 0x80,
+} timerUsageFlag_e;
+
+
+struct timerCCHandlerRec_s;
+struct timerOvrHandlerRec_s;
+typedef void timerCCHandlerCallback(struct timerCCHandlerRec_s* self, uint16_t capture);
+typedef void timerOvrHandlerCallback(struct timerOvrHandlerRec_s* self, uint16_t capture);
+
+typedef struct timerCCHandlerRec_s {
+    timerCCHandlerCallback* fn;
+} timerCCHandlerRec_t;
+
+typedef struct timerOvrHandlerRec_s {
+    timerOvrHandlerCallback* fn;
+    struct timerOvrHandlerRec_s* next;
+} timerOvrHandlerRec_t;
+
+typedef struct timerDef_s {
+    TIM_TypeDef *TIMx;
+    rccPeriphTag_t rcc;
+    uint8_t inputIrq;
+} timerDef_t;
+
+typedef struct timerHardware_s {
+    TIM_TypeDef *tim;
+    ioTag_t tag;
+    uint8_t channel;
+    timerUsageFlag_e usageFlags;
+    uint8_t output;
+# 150 "./src/main/drivers/timer.h"
+} timerHardware_t;
+
+typedef enum {
+    TIMER_OUTPUT_NONE = 0,
+    TIMER_OUTPUT_INVERTED = (1 << 0),
+    TIMER_OUTPUT_N_CHANNEL = (1 << 1),
+} timerFlag_e;
+# 181 "./src/main/drivers/timer.h"
+extern const timerHardware_t timerHardware[];
+# 223 "./src/main/drivers/timer.h"
+extern const timerDef_t timerDefinitions[];
+
+typedef enum {
+    TYPE_FREE,
+    TYPE_PWMINPUT,
+    TYPE_PPMINPUT,
+    TYPE_PWMOUTPUT_MOTOR,
+    TYPE_PWMOUTPUT_FAST,
+    TYPE_PWMOUTPUT_SERVO,
+    TYPE_SOFTSERIAL_RX,
+    TYPE_SOFTSERIAL_TX,
+    TYPE_SOFTSERIAL_RXTX,
+    TYPE_SOFTSERIAL_AUXTIMER,
+    TYPE_ADC,
+    TYPE_SERIAL_RX,
+    TYPE_SERIAL_TX,
+    TYPE_SERIAL_RXTX,
+    TYPE_TIMER
+} channelType_t;
+
+void timerConfigure(const timerHardware_t *timHw, uint16_t period, uint32_t hz);
+
+void timerChConfigIC(const timerHardware_t *timHw, 
+# 245 "./src/main/drivers/timer.h" 3 4
+                                                  _Bool 
+# 245 "./src/main/drivers/timer.h"
+                                                       polarityRising, unsigned inputFilterSamples);
+void timerChConfigICDual(const timerHardware_t* timHw, 
+# 246 "./src/main/drivers/timer.h" 3 4
+                                                      _Bool 
+# 246 "./src/main/drivers/timer.h"
+                                                           polarityRising, unsigned inputFilterSamples);
+void timerChICPolarity(const timerHardware_t *timHw, 
+# 247 "./src/main/drivers/timer.h" 3 4
+                                                    _Bool 
+# 247 "./src/main/drivers/timer.h"
+                                                         polarityRising);
+volatile timCCR_t* timerChCCR(const timerHardware_t* timHw);
+volatile timCCR_t* timerChCCRLo(const timerHardware_t* timHw);
+volatile timCCR_t* timerChCCRHi(const timerHardware_t* timHw);
+void timerChConfigOC(const timerHardware_t* timHw, 
+# 251 "./src/main/drivers/timer.h" 3 4
+                                                  _Bool 
+# 251 "./src/main/drivers/timer.h"
+                                                       outEnable, 
+# 251 "./src/main/drivers/timer.h" 3 4
+                                                                  _Bool 
+# 251 "./src/main/drivers/timer.h"
+                                                                       stateHigh);
+void timerChConfigGPIO(const timerHardware_t* timHw, ioConfig_t mode);
+
+void timerChCCHandlerInit(timerCCHandlerRec_t *self, timerCCHandlerCallback *fn);
+void timerChOvrHandlerInit(timerOvrHandlerRec_t *self, timerOvrHandlerCallback *fn);
+void timerChConfigCallbacks(const timerHardware_t *channel, timerCCHandlerRec_t *edgeCallback, timerOvrHandlerRec_t *overflowCallback);
+void timerChConfigCallbacksDual(const timerHardware_t *channel, timerCCHandlerRec_t *edgeCallbackLo, timerCCHandlerRec_t *edgeCallbackHi, timerOvrHandlerRec_t *overflowCallback);
+void timerChITConfigDualLo(const timerHardware_t* timHw, FunctionalState newState);
+void timerChITConfig(const timerHardware_t* timHw, FunctionalState newState);
+void timerChClearCCFlag(const timerHardware_t* timHw);
+
+void timerChInit(const timerHardware_t *timHw, channelType_t type, int irqPriority, uint8_t irq);
+
+void timerInit(void);
+void timerStart(void);
+void timerForceOverflow(TIM_TypeDef *tim);
+
+uint32_t timerClock(TIM_TypeDef *tim);
+
+void configTimeBase(TIM_TypeDef *tim, uint16_t period, uint32_t hz);
+
+rccPeriphTag_t timerRCC(TIM_TypeDef *tim);
+uint8_t timerInputIrq(TIM_TypeDef *tim);
+
+
+
+
+const timerHardware_t *timerGetByTag(ioTag_t ioTag);
+const timerHardware_t *timerGetByTagAndIndex(ioTag_t ioTag, unsigned timerIndex);
+ioTag_t timerioTagGetByUsage(timerUsageFlag_e usageFlag, uint8_t index);
+
+
+
+
+
+
+
+void timerOCInit(TIM_TypeDef *tim, uint8_t channel, TIM_OCInitTypeDef *init);
+void timerOCPreloadConfig(TIM_TypeDef *tim, uint8_t channel, uint16_t preload);
+
+
+volatile timCCR_t *timerCCR(TIM_TypeDef *tim, uint8_t channel);
+uint16_t timerDmaSource(uint8_t channel);
+
+uint16_t timerGetPrescalerByDesiredHertz(TIM_TypeDef *tim, uint32_t hz);
+uint16_t timerGetPrescalerByDesiredMhz(TIM_TypeDef *tim, uint16_t mhz);
+uint16_t timerGetPeriodByPrescaler(TIM_TypeDef *tim, uint16_t prescaler, uint32_t hz);
+
+int8_t timerGetTIMNumber(const TIM_TypeDef *tim);
+uint8_t timerLookupChannelIndex(const uint16_t channel);
+# 26 "./src/main/drivers/dma_reqmap.h" 2
+
+typedef uint16_t dmaCode_t;
+
+typedef struct dmaChannelSpec_s {
+    dmaCode_t code;
+
+
+
+
+    DMA_Channel_TypeDef *ref;
+
+} dmaChannelSpec_t;
+
+
+
+
+
+
+
+typedef enum {
+    DMA_PERIPH_SPI_TX,
+    DMA_PERIPH_SPI_RX,
+    DMA_PERIPH_ADC,
+    DMA_PERIPH_SDIO,
+    DMA_PERIPH_UART_TX,
+    DMA_PERIPH_UART_RX,
+} dmaPeripheral_e;
+
+typedef int8_t dmaoptValue_t;
+
+
+
+
+
+
+dmaoptValue_t dmaoptByTag(ioTag_t ioTag);
+const dmaChannelSpec_t *dmaGetChannelSpecByPeripheral(dmaPeripheral_e device, uint8_t index, int8_t opt);
+const dmaChannelSpec_t *dmaGetChannelSpecByTimerValue(TIM_TypeDef *tim, uint8_t channel, dmaoptValue_t dmaopt);
+const dmaChannelSpec_t *dmaGetChannelSpecByTimer(const timerHardware_t *timer);
+dmaoptValue_t dmaGetOptionByTimer(const timerHardware_t *timer);
+# 70 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/camera_control.h" 1
+# 21 "./src/main/drivers/camera_control.h"
+       
+
+
+
+
+typedef enum {
+    CAMERA_CONTROL_KEY_ENTER,
+    CAMERA_CONTROL_KEY_LEFT,
+    CAMERA_CONTROL_KEY_UP,
+    CAMERA_CONTROL_KEY_RIGHT,
+    CAMERA_CONTROL_KEY_DOWN,
+    CAMERA_CONTROL_KEYS_COUNT
+} cameraControlKey_e;
+
+typedef enum {
+    CAMERA_CONTROL_MODE_HARDWARE_PWM,
+    CAMERA_CONTROL_MODE_SOFTWARE_PWM,
+    CAMERA_CONTROL_MODE_DAC,
+    CAMERA_CONTROL_MODES_COUNT
+} cameraControlMode_e;
+
+typedef struct cameraControlConfig_s {
+    cameraControlMode_e mode;
+
+    uint16_t refVoltage;
+    uint16_t keyDelayMs;
+
+    uint16_t internalResistance;
+
+    ioTag_t ioTag;
+    uint8_t inverted;
+} cameraControlConfig_t;
+
+extern cameraControlConfig_t cameraControlConfig_System; extern cameraControlConfig_t cameraControlConfig_Copy; static inline const cameraControlConfig_t* cameraControlConfig(void) { return &cameraControlConfig_System; } static inline cameraControlConfig_t* cameraControlConfigMutable(void) { return &cameraControlConfig_System; } struct _dummy;
+
+void cameraControlInit(void);
+
+void cameraControlProcess(uint32_t currentTimeUs);
+void cameraControlKeyPress(cameraControlKey_e key, uint32_t holdDurationMs);
+# 71 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/compass/compass.h" 1
+# 21 "./src/main/drivers/compass/compass.h"
+       
+
+
+
+
+
+typedef struct magDev_s {
+    sensorMagInitFuncPtr init;
+    sensorMagReadFuncPtr read;
+    extiCallbackRec_t exti;
+    busDevice_t busdev;
+    sensor_align_e magAlign;
+    ioTag_t magIntExtiTag;
+    int16_t magGain[3];
+} magDev_t;
+# 72 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/drivers/dma.h" 1
+# 21 "./src/main/drivers/dma.h"
+       
+
+
+
+struct dmaChannelDescriptor_s;
+typedef void (*dmaCallbackHandlerFuncPtr)(struct dmaChannelDescriptor_s *channelDescriptor);
+
+typedef struct dmaChannelDescriptor_s {
+    DMA_TypeDef* dma;
+
+
+
+
+    DMA_Channel_TypeDef* ref;
+
+    dmaCallbackHandlerFuncPtr irqHandlerCallback;
+    uint8_t flagsShift;
+    IRQn_Type irqN;
+    uint32_t userParam;
+    resourceOwner_e owner;
+    uint8_t resourceIndex;
+    uint32_t completeFlag;
+} dmaChannelDescriptor_t;
+# 117 "./src/main/drivers/dma.h"
+typedef enum {
+    DMA_NONE = 0,
+    DMA1_CH1_HANDLER = 1,
+    DMA1_CH2_HANDLER,
+    DMA1_CH3_HANDLER,
+    DMA1_CH4_HANDLER,
+    DMA1_CH5_HANDLER,
+    DMA1_CH6_HANDLER,
+    DMA1_CH7_HANDLER,
+# 134 "./src/main/drivers/dma.h"
+    DMA_LAST_HANDLER = DMA1_CH7_HANDLER
+
+} dmaIdentifier_e;
+# 168 "./src/main/drivers/dma.h"
+dmaIdentifier_e dmaGetIdentifier(const DMA_Channel_TypeDef* channel);
+DMA_Channel_TypeDef* dmaGetRefByIdentifier(const dmaIdentifier_e identifier);
+
+
+
+void dmaInit(dmaIdentifier_e identifier, resourceOwner_e owner, uint8_t resourceIndex);
+void dmaSetHandler(dmaIdentifier_e identifier, dmaCallbackHandlerFuncPtr callback, uint32_t priority, uint32_t userParam);
+
+resourceOwner_e dmaGetOwner(dmaIdentifier_e identifier);
+uint8_t dmaGetResourceIndex(dmaIdentifier_e identifier);
+dmaChannelDescriptor_t* dmaGetDescriptorByIdentifier(const dmaIdentifier_e identifier);
+# 74 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/flash.h" 1
+# 21 "./src/main/drivers/flash.h"
+       
+
+
+
+# 1 "./src/main/pg/flash.h" 1
+# 21 "./src/main/pg/flash.h"
+       
+
+
+
+
+
+
+
+typedef struct flashConfig_s {
+    ioTag_t csTag;
+    uint8_t spiDevice;
+    uint8_t quadSpiDevice;
+} flashConfig_t;
+
+extern flashConfig_t flashConfig_System; extern flashConfig_t flashConfig_Copy; static inline const flashConfig_t* flashConfig(void) { return &flashConfig_System; } static inline flashConfig_t* flashConfigMutable(void) { return &flashConfig_System; } struct _dummy;
+# 26 "./src/main/drivers/flash.h" 2
+# 34 "./src/main/drivers/flash.h"
+typedef enum {
+    FLASH_TYPE_NOR = 0,
+    FLASH_TYPE_NAND
+} flashType_e;
+
+typedef uint16_t flashSector_t;
+
+typedef struct flashGeometry_s {
+    flashSector_t sectors;
+    uint16_t pageSize;
+    uint32_t sectorSize;
+    uint32_t totalSize;
+    uint16_t pagesPerSector;
+    flashType_e flashType;
+} flashGeometry_t;
+
+void flashPreInit(const flashConfig_t *flashConfig);
+
+# 51 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 51 "./src/main/drivers/flash.h"
+    flashInit(const flashConfig_t *flashConfig);
+
+
+# 53 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 53 "./src/main/drivers/flash.h"
+    flashIsReady(void);
+
+# 54 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 54 "./src/main/drivers/flash.h"
+    flashWaitForReady(uint32_t timeoutMillis);
+void flashEraseSector(uint32_t address);
+void flashEraseCompletely(void);
+void flashPageProgramBegin(uint32_t address);
+void flashPageProgramContinue(const uint8_t *data, int length);
+void flashPageProgramFinish(void);
+void flashPageProgram(uint32_t address, const uint8_t *data, int length);
+int flashReadBytes(uint32_t address, uint8_t *buffer, int length);
+void flashFlush(void);
+const flashGeometry_t *flashGetGeometry(void);
+
+
+
+
+
+typedef struct flashPartition_s {
+    uint8_t type;
+    flashSector_t startSector;
+    flashSector_t endSector;
+} flashPartition_t;
+# 83 "./src/main/drivers/flash.h"
+typedef enum {
+    FLASH_PARTITION_TYPE_UNKNOWN = 0,
+    FLASH_PARTITION_TYPE_PARTITION_TABLE,
+    FLASH_PARTITION_TYPE_FLASHFS,
+    FLASH_PARTITION_TYPE_BADBLOCK_MANAGEMENT,
+    FLASH_PARTITION_TYPE_FIRMWARE,
+    FLASH_PARTITION_TYPE_CONFIG,
+    FLASH_PARTITION_TYPE_FLASHFS_LOG_INDEX,
+    FLASH_MAX_PARTITIONS
+} flashPartitionType_e;
+
+typedef struct flashPartitionTable_s {
+    flashPartition_t partitions[FLASH_MAX_PARTITIONS];
+} flashPartitionTable_t;
+
+void flashPartitionSet(uint8_t index, uint32_t startSector, uint32_t endSector);
+flashPartition_t *flashPartitionFindByType(flashPartitionType_e type);
+const flashPartition_t *flashPartitionFindByIndex(uint8_t index);
+const char *flashPartitionGetTypeName(flashPartitionType_e type);
+# 75 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/inverter.h" 1
+# 21 "./src/main/drivers/inverter.h"
+       
+
+# 1 "./src/main/drivers/serial.h" 1
+# 21 "./src/main/drivers/serial.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_e;
+
+typedef enum {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 52 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_e;
+
+
+
+
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    portMode_e mode;
+    portOptions_e options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+
+    uint8_t identifier;
+} serialPort_t;
+# 97 "./src/main/drivers/serial.h"
+typedef struct serialPinConfig_s {
+    ioTag_t ioTagTx[10];
+    ioTag_t ioTagRx[10];
+    ioTag_t ioTagInverter[10];
+} serialPinConfig_t;
+
+extern serialPinConfig_t serialPinConfig_System; extern serialPinConfig_t serialPinConfig_Copy; static inline const serialPinConfig_t* serialPinConfig(void) { return &serialPinConfig_System; } static inline serialPinConfig_t* serialPinConfigMutable(void) { return &serialPinConfig_System; } struct _dummy;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 116 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 116 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_e mode);
+    void (*setCtrlLineStateCb)(serialPort_t *instance, void (*cb)(void *instance, uint16_t ctrlLineState), void *context);
+    void (*setBaudRateCb)(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+uint8_t serialRead(serialPort_t *instance);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_e mode);
+void serialSetCtrlLineStateCb(serialPort_t *instance, void (*cb)(void *context, uint16_t ctrlLineState), void *context);
+void serialSetBaudRateCb(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+# 137 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 137 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 24 "./src/main/drivers/inverter.h" 2
+
+void initInverters(const serialPinConfig_t *serialPinConfigToUse);
+
+void enableInverter(USART_TypeDef *USARTx, 
+# 27 "./src/main/drivers/inverter.h" 3 4
+                                          _Bool 
+# 27 "./src/main/drivers/inverter.h"
+                                               on);
+# 76 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/drivers/io_impl.h" 1
+# 21 "./src/main/drivers/io_impl.h"
+       
+
+
+
+
+
+
+typedef struct ioDef_s {
+    ioTag_t tag;
+} ioDef_t;
+
+typedef struct ioRec_s {
+    GPIO_TypeDef *gpio;
+    uint16_t pin;
+    resourceOwner_e owner;
+    uint8_t index;
+} ioRec_t;
+
+extern ioRec_t ioRecs[];
+
+int IO_GPIOPortIdx(IO_t io);
+int IO_GPIOPinIdx(IO_t io);
+
+int IO_GPIO_PinSource(IO_t io);
+int IO_GPIO_PortSource(IO_t io);
+
+
+
+
+
+
+GPIO_TypeDef* IO_GPIO(IO_t io);
+uint16_t IO_Pin(IO_t io);
+
+
+
+
+
+
+uint32_t IO_EXTI_Line(IO_t io);
+ioRec_t *IO_Rec(IO_t io);
+# 78 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/light_led.h" 1
+# 21 "./src/main/drivers/light_led.h"
+       
+
+
+
+
+
+
+
+typedef struct statusLedConfig_s {
+    ioTag_t ioTags[3];
+    uint8_t inversion;
+} statusLedConfig_t;
+
+extern statusLedConfig_t statusLedConfig_System; extern statusLedConfig_t statusLedConfig_Copy; static inline const statusLedConfig_t* statusLedConfig(void) { return &statusLedConfig_System; } static inline statusLedConfig_t* statusLedConfigMutable(void) { return &statusLedConfig_System; } struct _dummy;
+# 79 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/pwm_output.h" 1
+# 21 "./src/main/drivers/pwm_output.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/pwm_output_counts.h" 1
+# 21 "./src/main/drivers/pwm_output_counts.h"
+       
+# 29 "./src/main/drivers/pwm_output.h" 2
+# 49 "./src/main/drivers/pwm_output.h"
+typedef enum {
+    DSHOT_CMD_MOTOR_STOP = 0,
+    DSHOT_CMD_BEACON1,
+    DSHOT_CMD_BEACON2,
+    DSHOT_CMD_BEACON3,
+    DSHOT_CMD_BEACON4,
+    DSHOT_CMD_BEACON5,
+    DSHOT_CMD_ESC_INFO,
+    DSHOT_CMD_SPIN_DIRECTION_1,
+    DSHOT_CMD_SPIN_DIRECTION_2,
+    DSHOT_CMD_3D_MODE_OFF,
+    DSHOT_CMD_3D_MODE_ON,
+    DSHOT_CMD_SETTINGS_REQUEST,
+    DSHOT_CMD_SAVE_SETTINGS,
+    DSHOT_CMD_SPIN_DIRECTION_NORMAL = 20,
+    DSHOT_CMD_SPIN_DIRECTION_REVERSED = 21,
+    DSHOT_CMD_LED0_ON,
+    DSHOT_CMD_LED1_ON,
+    DSHOT_CMD_LED2_ON,
+    DSHOT_CMD_LED3_ON,
+    DSHOT_CMD_LED0_OFF,
+    DSHOT_CMD_LED1_OFF,
+    DSHOT_CMD_LED2_OFF,
+    DSHOT_CMD_LED3_OFF,
+    DSHOT_CMD_AUDIO_STREAM_MODE_ON_OFF = 30,
+    DSHOT_CMD_SILENT_MODE_ON_OFF = 31,
+    DSHOT_CMD_SIGNAL_LINE_TELEMETRY_DISABLE = 32,
+    DSHOT_CMD_SIGNAL_LINE_CONTINUOUS_ERPM_TELEMETRY = 33,
+    DSHOT_CMD_MAX = 47
+} dshotCommands_e;
+
+
+
+
+typedef enum {
+    PWM_TYPE_STANDARD = 0,
+    PWM_TYPE_ONESHOT125,
+    PWM_TYPE_ONESHOT42,
+    PWM_TYPE_MULTISHOT,
+    PWM_TYPE_BRUSHED,
+
+
+
+
+
+
+
+    PWM_TYPE_MAX
+} motorPwmProtocolTypes_e;
+# 125 "./src/main/drivers/pwm_output.h"
+typedef struct {
+    TIM_TypeDef *timer;
+# 145 "./src/main/drivers/pwm_output.h"
+    uint16_t timerDmaSources;
+} motorDmaTimer_t;
+
+typedef struct {
+    ioTag_t ioTag;
+    const timerHardware_t *timerHardware;
+    uint16_t value;
+# 187 "./src/main/drivers/pwm_output.h"
+    motorDmaTimer_t *timer;
+    volatile 
+# 188 "./src/main/drivers/pwm_output.h" 3 4
+            _Bool 
+# 188 "./src/main/drivers/pwm_output.h"
+                 requestTelemetry;
+# 197 "./src/main/drivers/pwm_output.h"
+    uint8_t dmaBuffer[18];
+
+
+} motorDmaOutput_t;
+
+motorDmaOutput_t *getMotorDmaOutput(uint8_t index);
+
+struct timerHardware_s;
+typedef void pwmWriteFn(uint8_t index, float value);
+typedef void pwmCompleteWriteFn(uint8_t motorCount);
+typedef 
+# 207 "./src/main/drivers/pwm_output.h" 3 4
+       _Bool 
+# 207 "./src/main/drivers/pwm_output.h"
+            pwmStartWriteFn(uint8_t motorCount);
+
+typedef struct {
+    volatile timCCR_t *ccr;
+    TIM_TypeDef *tim;
+} timerChannel_t;
+
+typedef struct {
+    timerChannel_t channel;
+    float pulseScale;
+    float pulseOffset;
+    
+# 218 "./src/main/drivers/pwm_output.h" 3 4
+   _Bool 
+# 218 "./src/main/drivers/pwm_output.h"
+        forceOverflow;
+    
+# 219 "./src/main/drivers/pwm_output.h" 3 4
+   _Bool 
+# 219 "./src/main/drivers/pwm_output.h"
+        enabled;
+    IO_t io;
+} pwmOutputPort_t;
+
+
+typedef struct motorDevConfig_s {
+    uint16_t motorPwmRate;
+    uint8_t motorPwmProtocol;
+    uint8_t motorPwmInversion;
+    uint8_t useUnsyncedPwm;
+    uint8_t useBurstDshot;
+    uint8_t useDshotTelemetry;
+    ioTag_t ioTags[8];
+} motorDevConfig_t;
+
+extern 
+# 234 "./src/main/drivers/pwm_output.h" 3 4
+      _Bool 
+# 234 "./src/main/drivers/pwm_output.h"
+           useBurstDshot;
+
+
+
+
+
+void motorDevInit(const motorDevConfig_t *motorDevConfig, uint16_t idlePulse, uint8_t motorCount);
+
+typedef struct servoDevConfig_s {
+
+    uint16_t servoCenterPulse;
+    uint16_t servoPwmRate;
+    ioTag_t ioTags[8];
+} servoDevConfig_t;
+
+void servoDevInit(const servoDevConfig_t *servoDevConfig);
+
+void pwmServoConfig(const struct timerHardware_s *timerHardware, uint8_t servoIndex, uint16_t servoPwmRate, uint16_t servoCenterPulse);
+
+
+# 253 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 253 "./src/main/drivers/pwm_output.h"
+    isMotorProtocolDshot(void);
+# 297 "./src/main/drivers/pwm_output.h"
+void pwmOutConfig(timerChannel_t *channel, const timerHardware_t *timerHardware, uint32_t hz, uint16_t period, uint16_t value, uint8_t inversion);
+
+void pwmWriteMotor(uint8_t index, float value);
+void pwmShutdownPulsesForAllMotors(uint8_t motorCount);
+void pwmCompleteMotorUpdate(uint8_t motorCount);
+
+# 302 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 302 "./src/main/drivers/pwm_output.h"
+    pwmStartMotorUpdate(uint8_t motorCount);
+
+void pwmWriteServo(uint8_t index, float value);
+
+pwmOutputPort_t *pwmGetMotors(void);
+
+# 307 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 307 "./src/main/drivers/pwm_output.h"
+    pwmIsSynced(void);
+void pwmDisableMotors(void);
+void pwmEnableMotors(void);
+
+# 310 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 310 "./src/main/drivers/pwm_output.h"
+    pwmAreMotorsEnabled(void);
+# 80 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/rangefinder/rangefinder_hcsr04.h" 1
+# 21 "./src/main/drivers/rangefinder/rangefinder_hcsr04.h"
+       
+
+
+
+# 1 "./src/main/drivers/rangefinder/rangefinder.h" 1
+# 21 "./src/main/drivers/rangefinder/rangefinder.h"
+       
+# 30 "./src/main/drivers/rangefinder/rangefinder.h"
+typedef struct rangefinderHardwarePins_s {
+    ioTag_t triggerTag;
+    ioTag_t echoTag;
+} rangefinderHardwarePins_t;
+
+struct rangefinderDev_s;
+typedef void (*rangefinderOpInitFuncPtr)(struct rangefinderDev_s * dev);
+typedef void (*rangefinderOpStartFuncPtr)(struct rangefinderDev_s * dev);
+typedef int32_t (*rangefinderOpReadFuncPtr)(struct rangefinderDev_s * dev);
+
+typedef struct rangefinderDev_s {
+    timeMs_t delayMs;
+    int16_t maxRangeCm;
+
+
+    int16_t detectionConeDeciDegrees;
+    int16_t detectionConeExtendedDeciDegrees;
+
+
+    rangefinderOpInitFuncPtr init;
+    rangefinderOpStartFuncPtr update;
+    rangefinderOpReadFuncPtr read;
+} rangefinderDev_t;
+
+extern int16_t rangefinderMaxRangeCm;
+extern int16_t rangefinderMaxAltWithTiltCm;
+extern int16_t rangefinderCfAltCm;
+# 26 "./src/main/drivers/rangefinder/rangefinder_hcsr04.h" 2
+# 1 "./src/main/sensors/battery.h" 1
+# 21 "./src/main/sensors/battery.h"
+       
+
+
+
+# 1 "./src/main/common/filter.h" 1
+# 21 "./src/main/common/filter.h"
+       
+
+
+struct filter_s;
+typedef struct filter_s filter_t;
+
+typedef struct pt1Filter_s {
+    float state;
+    float k;
+} pt1Filter_t;
+
+typedef struct slewFilter_s {
+    float state;
+    float slewLimit;
+    float threshold;
+} slewFilter_t;
+
+
+typedef struct biquadFilter_s {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+} biquadFilter_t;
+
+typedef struct laggedMovingAverage_s {
+    uint16_t movingWindowIndex;
+    uint16_t windowSize;
+    float movingSum;
+    float *buf;
+    
+# 49 "./src/main/common/filter.h" 3 4
+   _Bool 
+# 49 "./src/main/common/filter.h"
+        primed;
+} laggedMovingAverage_t;
+
+
+typedef struct movingAverageFilter_s {
+    int32_t *buf;
+    int32_t sum;
+    uint16_t windowSize;
+    uint16_t index;
+    uint16_t count;
+} movingAverageFilter_t;
+
+
+typedef struct medianFilter_s {
+    int32_t *window;
+    int32_t *sorted;
+    uint16_t windowSize;
+    uint16_t index;
+    uint16_t count;
+} medianFilter_t;
+
+typedef enum {
+    FILTER_PT1 = 0,
+    FILTER_BIQUAD,
+} lowpassFilterType_e;
+
+typedef enum {
+    FILTER_LPF,
+    FILTER_NOTCH,
+    FILTER_BPF,
+} biquadFilterType_e;
+
+typedef float (*filterApplyFnPtr)(filter_t *filter, float input);
+
+float nullFilterApply(filter_t *filter, float input);
+
+void biquadFilterInitLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+
+float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
+float biquadFilterApply(biquadFilter_t *filter, float input);
+float filterGetNotchQ(float centerFreq, float cutoffFreq);
+
+void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf);
+float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float input);
+
+void movingAverageFilterInit(movingAverageFilter_t *filter, int32_t *buf, uint16_t windowSize);
+int32_t movingAverageFilterApply(movingAverageFilter_t *filter, int32_t input);
+
+# 99 "./src/main/common/filter.h" 3 4
+_Bool 
+# 99 "./src/main/common/filter.h"
+    movingAverageFilterIsPrimed(const movingAverageFilter_t *filter);
+
+void medianFilterInit(medianFilter_t *filter, int32_t *window, int32_t *sorted, uint16_t windowSize);
+int32_t medianFilterApply(medianFilter_t *filter, int32_t input);
+
+float pt1FilterGain(float f_cut, float dT);
+void pt1FilterInit(pt1Filter_t *filter, float k);
+void pt1FilterUpdateCutoff(pt1Filter_t *filter, float k);
+float pt1FilterApply(pt1Filter_t *filter, float input);
+
+void slewFilterInit(slewFilter_t *filter, float slewLimit, float threshold);
+float slewFilterApply(slewFilter_t *filter, float input);
+# 26 "./src/main/sensors/battery.h" 2
+
+# 1 "./src/main/sensors/current.h" 1
+# 21 "./src/main/sensors/current.h"
+       
+
+
+# 1 "./src/main/sensors/current_ids.h" 1
+# 21 "./src/main/sensors/current_ids.h"
+       
+
+
+
+
+
+typedef enum {
+    CURRENT_METER_ID_NONE = 0,
+
+    CURRENT_METER_ID_BATTERY_1 = 10,
+    CURRENT_METER_ID_BATTERY_2,
+
+    CURRENT_METER_ID_BATTERY_10 = 19,
+
+    CURRENT_METER_ID_5V_1 = 20,
+    CURRENT_METER_ID_5V_2,
+
+    CURRENT_METER_ID_5V_10 = 29,
+
+    CURRENT_METER_ID_9V_1 = 30,
+    CURRENT_METER_ID_9V_2,
+
+    CURRENT_METER_ID_9V_10 = 39,
+
+    CURRENT_METER_ID_12V_1 = 40,
+    CURRENT_METER_ID_12V_2,
+
+    CURRENT_METER_ID_12V_10 = 49,
+
+    CURRENT_METER_ID_ESC_COMBINED_1 = 50,
+
+    CURRENT_METER_ID_ESC_COMBINED_10 = 59,
+
+    CURRENT_METER_ID_ESC_MOTOR_1 = 60,
+    CURRENT_METER_ID_ESC_MOTOR_2,
+    CURRENT_METER_ID_ESC_MOTOR_3,
+    CURRENT_METER_ID_ESC_MOTOR_4,
+    CURRENT_METER_ID_ESC_MOTOR_5,
+    CURRENT_METER_ID_ESC_MOTOR_6,
+    CURRENT_METER_ID_ESC_MOTOR_7,
+    CURRENT_METER_ID_ESC_MOTOR_8,
+    CURRENT_METER_ID_ESC_MOTOR_9,
+    CURRENT_METER_ID_ESC_MOTOR_10,
+    CURRENT_METER_ID_ESC_MOTOR_11,
+    CURRENT_METER_ID_ESC_MOTOR_12,
+
+    CURRENT_METER_ID_ESC_MOTOR_20 = 79,
+
+    CURRENT_METER_ID_VIRTUAL_1 = 80,
+    CURRENT_METER_ID_VIRTUAL_2,
+
+    CURRENT_METER_ID_MSP_1 = 90,
+    CURRENT_METER_ID_MSP_2,
+
+} currentMeterId_e;
+# 25 "./src/main/sensors/current.h" 2
+
+typedef enum {
+    CURRENT_METER_NONE = 0,
+    CURRENT_METER_ADC,
+    CURRENT_METER_VIRTUAL,
+    CURRENT_METER_ESC,
+    CURRENT_METER_MSP,
+    CURRENT_METER_COUNT
+} currentMeterSource_e;
+
+extern const char * const currentMeterSourceNames[CURRENT_METER_COUNT];
+
+typedef struct currentMeter_s {
+    int32_t amperage;
+    int32_t amperageLatest;
+    int32_t mAhDrawn;
+} currentMeter_t;
+
+
+
+typedef struct currentMeterMAhDrawnState_s {
+    int32_t mAhDrawn;
+    float mAhDrawnF;
+} currentMeterMAhDrawnState_t;
+
+
+
+
+
+typedef enum {
+    CURRENT_SENSOR_VIRTUAL = 0,
+    CURRENT_SENSOR_ADC,
+    CURRENT_SENSOR_ESC,
+    CURRENT_SENSOR_MSP
+} currentSensor_e;
+
+
+
+
+
+
+typedef struct currentMeterADCState_s {
+    currentMeterMAhDrawnState_t mahDrawnState;
+    int32_t amperage;
+    int32_t amperageLatest;
+} currentMeterADCState_t;
+
+typedef struct currentSensorADCConfig_s {
+    int16_t scale;
+    int16_t offset;
+} currentSensorADCConfig_t;
+
+extern currentSensorADCConfig_t currentSensorADCConfig_System; extern currentSensorADCConfig_t currentSensorADCConfig_Copy; static inline const currentSensorADCConfig_t* currentSensorADCConfig(void) { return &currentSensorADCConfig_System; } static inline currentSensorADCConfig_t* currentSensorADCConfigMutable(void) { return &currentSensorADCConfig_System; } struct _dummy;
+
+
+
+
+
+typedef struct currentMeterVirtualState_s {
+    currentMeterMAhDrawnState_t mahDrawnState;
+    int32_t amperage;
+} currentSensorVirtualState_t;
+
+typedef struct currentSensorVirtualConfig_s {
+    int16_t scale;
+    uint16_t offset;
+} currentSensorVirtualConfig_t;
+
+extern currentSensorVirtualConfig_t currentSensorVirtualConfig_System; extern currentSensorVirtualConfig_t currentSensorVirtualConfig_Copy; static inline const currentSensorVirtualConfig_t* currentSensorVirtualConfig(void) { return &currentSensorVirtualConfig_System; } static inline currentSensorVirtualConfig_t* currentSensorVirtualConfigMutable(void) { return &currentSensorVirtualConfig_System; } struct _dummy;
+
+
+
+
+
+typedef struct currentMeterESCState_s {
+    int32_t mAhDrawn;
+    int32_t amperage;
+} currentMeterESCState_t;
+
+
+
+
+
+
+typedef struct currentMeterMSPState_s {
+    int32_t mAhDrawn;
+    int32_t amperage;
+} currentMeterMSPState_t;
+
+
+
+
+
+
+void currentMeterReset(currentMeter_t *meter);
+
+void currentMeterADCInit(void);
+void currentMeterADCRefresh(int32_t lastUpdateAt);
+void currentMeterADCRead(currentMeter_t *meter);
+
+void currentMeterVirtualInit(void);
+void currentMeterVirtualRefresh(int32_t lastUpdateAt, 
+# 126 "./src/main/sensors/current.h" 3 4
+                                                     _Bool 
+# 126 "./src/main/sensors/current.h"
+                                                          armed, 
+# 126 "./src/main/sensors/current.h" 3 4
+                                                                 _Bool 
+# 126 "./src/main/sensors/current.h"
+                                                                      throttleLowAndMotorStop, int32_t throttleOffset);
+void currentMeterVirtualRead(currentMeter_t *meter);
+
+void currentMeterESCInit(void);
+void currentMeterESCRefresh(int32_t lastUpdateAt);
+void currentMeterESCReadCombined(currentMeter_t *meter);
+void currentMeterESCReadMotor(uint8_t motorNumber, currentMeter_t *meter);
+
+void currentMeterMSPInit(void);
+void currentMeterMSPRefresh(timeUs_t currentTimeUs);
+void currentMeterMSPRead(currentMeter_t *meter);
+void currentMeterMSPSet(uint16_t amperage, uint16_t mAhDrawn);
+
+
+
+
+extern const uint8_t supportedCurrentMeterCount;
+extern const uint8_t currentMeterIds[];
+void currentMeterRead(currentMeterId_e id, currentMeter_t *currentMeter);
+# 28 "./src/main/sensors/battery.h" 2
+# 1 "./src/main/sensors/voltage.h" 1
+# 21 "./src/main/sensors/voltage.h"
+       
+
+# 1 "./src/main/sensors/voltage_ids.h" 1
+# 21 "./src/main/sensors/voltage_ids.h"
+       
+
+
+
+
+
+typedef enum {
+    VOLTAGE_METER_ID_NONE = 0,
+
+    VOLTAGE_METER_ID_BATTERY_1 = 10,
+    VOLTAGE_METER_ID_BATTERY_2,
+
+    VOLTAGE_METER_ID_BATTERY_10 = 19,
+
+    VOLTAGE_METER_ID_5V_1 = 20,
+    VOLTAGE_METER_ID_5V_2,
+
+    VOLTAGE_METER_ID_5V_10 = 29,
+
+    VOLTAGE_METER_ID_9V_1 = 30,
+    VOLTAGE_METER_ID_9V_2,
+
+    VOLTAGE_METER_ID_9V_10 = 39,
+
+    VOLTAGE_METER_ID_12V_1 = 40,
+    VOLTAGE_METER_ID_12V_2,
+
+    VOLTAGE_METER_ID_12V_10 = 49,
+
+    VOLTAGE_METER_ID_ESC_COMBINED_1 = 50,
+
+    VOLTAGE_METER_ID_ESC_COMBINED_10 = 59,
+
+    VOLTAGE_METER_ID_ESC_MOTOR_1 = 60,
+    VOLTAGE_METER_ID_ESC_MOTOR_2,
+    VOLTAGE_METER_ID_ESC_MOTOR_3,
+    VOLTAGE_METER_ID_ESC_MOTOR_4,
+    VOLTAGE_METER_ID_ESC_MOTOR_5,
+    VOLTAGE_METER_ID_ESC_MOTOR_6,
+    VOLTAGE_METER_ID_ESC_MOTOR_7,
+    VOLTAGE_METER_ID_ESC_MOTOR_8,
+    VOLTAGE_METER_ID_ESC_MOTOR_9,
+    VOLTAGE_METER_ID_ESC_MOTOR_10,
+    VOLTAGE_METER_ID_ESC_MOTOR_11,
+    VOLTAGE_METER_ID_ESC_MOTOR_12,
+
+    VOLTAGE_METER_ID_ESC_MOTOR_20 = 79,
+
+    VOLTAGE_METER_ID_CELL_1 = 80,
+    VOLTAGE_METER_ID_CELL_2,
+
+    VOLTAGE_METER_ID_CELL_40 = 119,
+
+} voltageMeterId_e;
+# 24 "./src/main/sensors/voltage.h" 2
+
+
+
+
+
+typedef enum {
+    VOLTAGE_METER_NONE = 0,
+    VOLTAGE_METER_ADC,
+    VOLTAGE_METER_ESC,
+    VOLTAGE_METER_COUNT
+} voltageMeterSource_e;
+
+extern const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT];
+
+
+
+typedef struct voltageMeter_s {
+    uint16_t filtered;
+    uint16_t unfiltered;
+    
+# 43 "./src/main/sensors/voltage.h" 3 4
+   _Bool 
+# 43 "./src/main/sensors/voltage.h"
+        lowVoltageCutoff;
+} voltageMeter_t;
+
+
+
+
+
+
+typedef enum {
+    VOLTAGE_SENSOR_TYPE_ADC_RESISTOR_DIVIDER = 0,
+    VOLTAGE_SENSOR_TYPE_ESC
+} voltageSensorType_e;
+# 76 "./src/main/sensors/voltage.h"
+typedef enum {
+    VOLTAGE_SENSOR_ADC_VBAT = 0,
+    VOLTAGE_SENSOR_ADC_12V = 1,
+    VOLTAGE_SENSOR_ADC_9V = 2,
+    VOLTAGE_SENSOR_ADC_5V = 3
+} voltageSensorADC_e;
+
+
+typedef struct voltageSensorADCConfig_s {
+    uint8_t vbatscale;
+    uint8_t vbatresdivval;
+    uint8_t vbatresdivmultiplier;
+} voltageSensorADCConfig_t;
+
+extern voltageSensorADCConfig_t voltageSensorADCConfig_SystemArray[1]; extern voltageSensorADCConfig_t voltageSensorADCConfig_CopyArray[1]; static inline const voltageSensorADCConfig_t* voltageSensorADCConfig(int _index) { return &voltageSensorADCConfig_SystemArray[_index]; } static inline voltageSensorADCConfig_t* voltageSensorADCConfigMutable(int _index) { return &voltageSensorADCConfig_SystemArray[_index]; } static inline voltageSensorADCConfig_t (* voltageSensorADCConfig_array(void))[1] { return &voltageSensorADCConfig_SystemArray; } struct _dummy;
+
+
+
+
+void voltageMeterReset(voltageMeter_t *voltageMeter);
+
+void voltageMeterADCInit(void);
+void voltageMeterADCRefresh(void);
+void voltageMeterADCRead(voltageSensorADC_e adcChannel, voltageMeter_t *voltageMeter);
+
+void voltageMeterESCInit(void);
+void voltageMeterESCRefresh(void);
+void voltageMeterESCReadCombined(voltageMeter_t *voltageMeter);
+void voltageMeterESCReadMotor(uint8_t motor, voltageMeter_t *voltageMeter);
+
+
+
+
+
+extern const uint8_t voltageMeterADCtoIDMap[1];
+
+extern const uint8_t supportedVoltageMeterCount;
+extern const uint8_t voltageMeterIds[];
+void voltageMeterRead(voltageMeterId_e id, voltageMeter_t *voltageMeter);
+# 29 "./src/main/sensors/battery.h" 2
+# 37 "./src/main/sensors/battery.h"
+enum {
+    AUTO_PROFILE_CELL_COUNT_STAY = 0,
+    AUTO_PROFILE_CELL_COUNT_CHANGE = -1,
+};
+
+typedef struct batteryConfig_s {
+
+    uint16_t vbatmaxcellvoltage;
+    uint16_t vbatmincellvoltage;
+    uint16_t vbatwarningcellvoltage;
+    uint16_t vbatnotpresentcellvoltage;
+    uint8_t lvcPercentage;
+    voltageMeterSource_e voltageMeterSource;
+
+
+    currentMeterSource_e currentMeterSource;
+    uint16_t batteryCapacity;
+
+
+    
+# 56 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 56 "./src/main/sensors/battery.h"
+        useVBatAlerts;
+    
+# 57 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 57 "./src/main/sensors/battery.h"
+        useConsumptionAlerts;
+    uint8_t consumptionWarningPercentage;
+    uint8_t vbathysteresis;
+
+    uint16_t vbatfullcellvoltage;
+
+    uint8_t forceBatteryCellCount;
+    uint8_t vbatLpfPeriod;
+    uint8_t ibatLpfPeriod;
+    uint8_t vbatDurationForWarning;
+    uint8_t vbatDurationForCritical;
+} batteryConfig_t;
+
+extern batteryConfig_t batteryConfig_System; extern batteryConfig_t batteryConfig_Copy; static inline const batteryConfig_t* batteryConfig(void) { return &batteryConfig_System; } static inline batteryConfig_t* batteryConfigMutable(void) { return &batteryConfig_System; } struct _dummy;
+
+typedef struct lowVoltageCutoff_s {
+    
+# 73 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 73 "./src/main/sensors/battery.h"
+        enabled;
+    uint8_t percentage;
+    timeUs_t startTime;
+} lowVoltageCutoff_t;
+
+typedef enum {
+    BATTERY_OK = 0,
+    BATTERY_WARNING,
+    BATTERY_CRITICAL,
+    BATTERY_NOT_PRESENT,
+    BATTERY_INIT
+} batteryState_e;
+
+void batteryInit(void);
+void batteryUpdateVoltage(timeUs_t currentTimeUs);
+void batteryUpdatePresence(void);
+
+batteryState_e getBatteryState(void);
+batteryState_e getVoltageState(void);
+batteryState_e getConsumptionState(void);
+const char * getBatteryStateString(void);
+
+void batteryUpdateStates(timeUs_t currentTimeUs);
+void batteryUpdateAlarms(void);
+
+struct rxConfig_s;
+
+float calculateVbatPidCompensation(void);
+uint8_t calculateBatteryPercentageRemaining(void);
+
+# 102 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 102 "./src/main/sensors/battery.h"
+    isBatteryVoltageConfigured(void);
+uint16_t getBatteryVoltage(void);
+uint16_t getLegacyBatteryVoltage(void);
+uint16_t getBatteryVoltageLatest(void);
+uint8_t getBatteryCellCount(void);
+uint16_t getBatteryAverageCellVoltage(void);
+
+
+# 109 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 109 "./src/main/sensors/battery.h"
+    isAmperageConfigured(void);
+int32_t getAmperage(void);
+int32_t getAmperageLatest(void);
+int32_t getMAhDrawn(void);
+
+void batteryUpdateCurrentMeter(timeUs_t currentTimeUs);
+
+const lowVoltageCutoff_t *getLowVoltageCutoff(void);
+# 27 "./src/main/drivers/rangefinder/rangefinder_hcsr04.h" 2
+
+
+
+typedef struct sonarConfig_s {
+    ioTag_t triggerTag;
+    ioTag_t echoTag;
+} sonarConfig_t;
+
+extern sonarConfig_t sonarConfig_System; extern sonarConfig_t sonarConfig_Copy; static inline const sonarConfig_t* sonarConfig(void) { return &sonarConfig_System; } static inline sonarConfig_t* sonarConfigMutable(void) { return &sonarConfig_System; } struct _dummy;
+
+
+# 37 "./src/main/drivers/rangefinder/rangefinder_hcsr04.h" 3 4
+_Bool 
+# 37 "./src/main/drivers/rangefinder/rangefinder_hcsr04.h"
+    hcsr04Detect(rangefinderDev_t *dev, const sonarConfig_t * sonarConfig);
+# 81 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/sdcard.h" 1
+# 21 "./src/main/drivers/sdcard.h"
+       
+
+
+
+
+# 1 "./src/main/pg/sdcard.h" 1
+# 21 "./src/main/pg/sdcard.h"
+       
+
+
+
+
+typedef enum {
+    SDCARD_MODE_NONE = 0,
+    SDCARD_MODE_SPI,
+    SDCARD_MODE_SDIO,
+    SDCARD_MODE_SITL
+} sdcardMode_e;
+
+typedef struct sdcardConfig_s {
+    uint8_t useDma;
+    int8_t device;
+    ioTag_t cardDetectTag;
+    ioTag_t chipSelectTag;
+    uint8_t cardDetectInverted;
+
+    uint8_t dmaIdentifier;
+    uint8_t dmaChannel;
+
+    sdcardMode_e mode;
+} sdcardConfig_t;
+
+extern sdcardConfig_t sdcardConfig_System; extern sdcardConfig_t sdcardConfig_Copy; static inline const sdcardConfig_t* sdcardConfig(void) { return &sdcardConfig_System; } static inline sdcardConfig_t* sdcardConfigMutable(void) { return &sdcardConfig_System; } struct _dummy;
+# 27 "./src/main/drivers/sdcard.h" 2
+
+typedef struct sdcardMetadata_s {
+    uint32_t numBlocks;
+    uint16_t oemID;
+    uint8_t manufacturerID;
+
+    char productName[5];
+
+    uint32_t productSerial;
+    uint8_t productRevisionMajor;
+    uint8_t productRevisionMinor;
+
+    uint16_t productionYear;
+    uint8_t productionMonth;
+} sdcardMetadata_t;
+
+typedef enum {
+    SDCARD_BLOCK_OPERATION_READ,
+    SDCARD_BLOCK_OPERATION_WRITE,
+    SDCARD_BLOCK_OPERATION_ERASE
+} sdcardBlockOperation_e;
+
+typedef enum {
+    SDCARD_OPERATION_IN_PROGRESS,
+    SDCARD_OPERATION_BUSY,
+    SDCARD_OPERATION_SUCCESS,
+    SDCARD_OPERATION_FAILURE
+} sdcardOperationStatus_e;
+
+typedef void(*sdcard_operationCompleteCallback_c)(sdcardBlockOperation_e operation, uint32_t blockIndex, uint8_t *buffer, uint32_t callbackData);
+
+typedef void(*sdcard_profilerCallback_c)(sdcardBlockOperation_e operation, uint32_t blockIndex, uint32_t duration);
+
+void sdcard_preInit(const sdcardConfig_t *config);
+void sdcard_init(const sdcardConfig_t *config);
+
+
+# 63 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 63 "./src/main/drivers/sdcard.h"
+    sdcard_readBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
+
+sdcardOperationStatus_e sdcard_beginWriteBlocks(uint32_t blockIndex, uint32_t blockCount);
+sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
+
+void sdcardInsertionDetectDeinit(void);
+void sdcardInsertionDetectInit(void);
+
+
+# 71 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 71 "./src/main/drivers/sdcard.h"
+    sdcard_isInserted(void);
+
+# 72 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 72 "./src/main/drivers/sdcard.h"
+    sdcard_isInitialized(void);
+
+# 73 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 73 "./src/main/drivers/sdcard.h"
+    sdcard_isFunctional(void);
+
+
+# 75 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 75 "./src/main/drivers/sdcard.h"
+    sdcard_poll(void);
+const sdcardMetadata_t* sdcard_getMetadata(void);
+
+void sdcard_setProfilerCallback(sdcard_profilerCallback_c callback);
+# 82 "./src/main/cli/cli.c" 2
+
+
+# 1 "./src/main/drivers/serial_escserial.h" 1
+# 21 "./src/main/drivers/serial_escserial.h"
+       
+
+
+
+
+
+typedef enum {
+    ESCSERIAL1 = 0,
+    ESCSERIAL2
+} escSerialPortIndex_e;
+
+typedef enum {
+    PROTOCOL_SIMONK = 0,
+    PROTOCOL_BLHELI = 1,
+    PROTOCOL_KISS = 2,
+    PROTOCOL_KISSALL = 3,
+    PROTOCOL_CASTLE = 4,
+    PROTOCOL_COUNT
+} escProtocol_e;
+
+
+
+# 42 "./src/main/drivers/serial_escserial.h" 3 4
+_Bool 
+# 42 "./src/main/drivers/serial_escserial.h"
+    escEnablePassthrough(serialPort_t *escPassthroughPort, const motorDevConfig_t *motorConfig, uint16_t escIndex, uint8_t mode);
+
+typedef struct escSerialConfig_s {
+    ioTag_t ioTag;
+} escSerialConfig_t;
+
+extern escSerialConfig_t escSerialConfig_System; extern escSerialConfig_t escSerialConfig_Copy; static inline const escSerialConfig_t* escSerialConfig(void) { return &escSerialConfig_System; } static inline escSerialConfig_t* escSerialConfigMutable(void) { return &escSerialConfig_System; } struct _dummy;
+# 85 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/sound_beeper.h" 1
+# 21 "./src/main/drivers/sound_beeper.h"
+       
+# 33 "./src/main/drivers/sound_beeper.h"
+void systemBeep(
+# 33 "./src/main/drivers/sound_beeper.h" 3 4
+               _Bool 
+# 33 "./src/main/drivers/sound_beeper.h"
+                    on);
+void systemBeepToggle(void);
+struct beeperDevConfig_s;
+void beeperInit(const struct beeperDevConfig_s *beeperDevConfig);
+# 86 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/stack_check.h" 1
+# 21 "./src/main/drivers/stack_check.h"
+       
+
+
+
+void taskStackCheck(timeUs_t currentTimeUs);
+uint32_t stackUsedSize(void);
+uint32_t stackTotalSize(void);
+uint32_t stackHighMem(void);
+# 87 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/system.h" 1
+# 21 "./src/main/drivers/system.h"
+       
+
+
+
+
+void systemInit(void);
+
+typedef enum {
+    FAILURE_DEVELOPER = 0,
+    FAILURE_MISSING_ACC,
+    FAILURE_ACC_INIT,
+    FAILURE_ACC_INCOMPATIBLE,
+    FAILURE_INVALID_EEPROM_CONTENTS,
+    FAILURE_FLASH_WRITE_FAILED,
+    FAILURE_GYRO_INIT_FAILED
+} failureMode_e;
+# 45 "./src/main/drivers/system.h"
+void indicateFailure(failureMode_e mode, int repeatCount);
+void failureMode(failureMode_e mode);
+
+
+void systemReset(void);
+void systemResetToBootloader(void);
+void checkForBootLoaderRequest(void);
+
+# 52 "./src/main/drivers/system.h" 3 4
+_Bool 
+# 52 "./src/main/drivers/system.h"
+    isMPUSoftReset(void);
+void cycleCounterInit(void);
+
+void initialiseMemorySections(void);
+
+void enableGPIOPowerUsageAndNoiseReductions(void);
+
+
+extern uint32_t hse_value;
+extern uint32_t cachedRccCsrValue;
+
+typedef void extiCallbackHandlerFunc(void);
+
+void registerExtiCallbackHandler(IRQn_Type irqn, extiCallbackHandlerFunc *fn);void unregisterExtiCallbackHandler(IRQn_Type irqn, extiCallbackHandlerFunc *fn);
+# 88 "./src/main/cli/cli.c" 2
+
+
+# 1 "./src/main/drivers/transponder_ir.h" 1
+# 21 "./src/main/drivers/transponder_ir.h"
+       
+# 92 "./src/main/drivers/transponder_ir.h"
+typedef struct transponder_s {
+    uint8_t gap_toggles;
+    uint32_t timer_hz;
+    uint32_t timer_carrier_hz;
+    uint16_t bitToggleOne;
+    uint32_t dma_buffer_size;
+
+
+
+
+
+    const struct transponderVTable *vTable;
+} transponder_t;
+
+typedef enum {
+    TRANSPONDER_NONE = 0,
+    TRANSPONDER_ILAP,
+    TRANSPONDER_ARCITIMER,
+    TRANSPONDER_ERLT
+} transponderProvider_e;
+
+
+
+struct transponderVTable {
+    void (*updateTransponderDMABuffer)(transponder_t *transponder, const uint8_t* transponderData);
+};
+
+
+# 119 "./src/main/drivers/transponder_ir.h" 3 4
+_Bool 
+# 119 "./src/main/drivers/transponder_ir.h"
+    transponderIrInit(const ioTag_t ioTag, const transponderProvider_e provider);
+void transponderIrDisable(void);
+
+void transponderIrHardwareInit(ioTag_t ioTag, transponder_t *transponder);
+void transponderIrDMAEnable(transponder_t *transponder);
+
+void transponderIrWaitForTransmitComplete(void);
+
+void transponderIrUpdateData(const uint8_t* transponderData);
+void transponderIrTransmit(void);
+
+
+# 130 "./src/main/drivers/transponder_ir.h" 3 4
+_Bool 
+# 130 "./src/main/drivers/transponder_ir.h"
+    isTransponderIrReady(void);
+
+extern volatile uint8_t transponderIrDataTransferInProgress;
+# 91 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/usb_msc.h" 1
+# 25 "./src/main/drivers/usb_msc.h"
+       
+
+void mscInit(void);
+
+# 28 "./src/main/drivers/usb_msc.h" 3 4
+_Bool 
+# 28 "./src/main/drivers/usb_msc.h"
+    mscCheckBoot(void);
+uint8_t mscStart(void);
+
+# 30 "./src/main/drivers/usb_msc.h" 3 4
+_Bool 
+# 30 "./src/main/drivers/usb_msc.h"
+    mscCheckButton(void);
+void mscWaitForButton(void);
+void systemResetToMsc(int timezoneOffsetMinutes);
+void systemResetFromMsc(void);
+# 92 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/vtx_common.h" 1
+# 23 "./src/main/drivers/vtx_common.h"
+       
+# 73 "./src/main/drivers/vtx_common.h"
+typedef enum {
+    VTXDEV_UNSUPPORTED = 0,
+    VTXDEV_RTC6705 = 1,
+
+    VTXDEV_SMARTAUDIO = 3,
+    VTXDEV_TRAMP = 4,
+    VTXDEV_UNKNOWN = 0xFF,
+} vtxDevType_e;
+# 111 "./src/main/drivers/vtx_common.h"
+typedef struct vtxDeviceCapability_s {
+    uint8_t bandCount;
+    uint8_t channelCount;
+    uint8_t powerCount;
+    uint8_t filler;
+} vtxDeviceCapability_t;
+
+struct vtxVTable_s;
+typedef struct vtxDevice_s {
+    const struct vtxVTable_s * const vTable;
+
+    vtxDeviceCapability_t capability;
+
+    const uint16_t *frequencyTable;
+    const char **bandNames;
+    const char **channelNames;
+    const char *bandLetters;
+    const uint16_t *powerValues;
+    const char **powerNames;
+
+    uint16_t frequency;
+    uint8_t band;
+    uint8_t channel;
+    uint8_t powerIndex;
+    uint8_t pitMode;
+} vtxDevice_t;
+
+
+
+
+
+
+typedef struct vtxVTable_s {
+    void (*process)(vtxDevice_t *vtxDevice, timeUs_t currentTimeUs);
+    vtxDevType_e (*getDeviceType)(const vtxDevice_t *vtxDevice);
+    
+# 146 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 146 "./src/main/drivers/vtx_common.h"
+        (*isReady)(const vtxDevice_t *vtxDevice);
+
+    void (*setBandAndChannel)(vtxDevice_t *vtxDevice, uint8_t band, uint8_t channel);
+    void (*setPowerByIndex)(vtxDevice_t *vtxDevice, uint8_t level);
+    void (*setPitMode)(vtxDevice_t *vtxDevice, uint8_t onoff);
+    void (*setFrequency)(vtxDevice_t *vtxDevice, uint16_t freq);
+
+    
+# 153 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 153 "./src/main/drivers/vtx_common.h"
+        (*getBandAndChannel)(const vtxDevice_t *vtxDevice, uint8_t *pBand, uint8_t *pChannel);
+    
+# 154 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 154 "./src/main/drivers/vtx_common.h"
+        (*getPowerIndex)(const vtxDevice_t *vtxDevice, uint8_t *pIndex);
+    
+# 155 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 155 "./src/main/drivers/vtx_common.h"
+        (*getPitMode)(const vtxDevice_t *vtxDevice, uint8_t *pOnOff);
+    
+# 156 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 156 "./src/main/drivers/vtx_common.h"
+        (*getFrequency)(const vtxDevice_t *vtxDevice, uint16_t *pFreq);
+} vtxVTable_t;
+
+
+
+
+
+
+void vtxCommonInit(void);
+void vtxCommonSetDevice(vtxDevice_t *vtxDevice);
+vtxDevice_t *vtxCommonDevice(void);
+
+
+void vtxCommonProcess(vtxDevice_t *vtxDevice, timeUs_t currentTimeUs);
+vtxDevType_e vtxCommonGetDeviceType(const vtxDevice_t *vtxDevice);
+
+# 171 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 171 "./src/main/drivers/vtx_common.h"
+    vtxCommonDeviceIsReady(const vtxDevice_t *vtxDevice);
+void vtxCommonSetBandAndChannel(vtxDevice_t *vtxDevice, uint8_t band, uint8_t channel);
+void vtxCommonSetPowerByIndex(vtxDevice_t *vtxDevice, uint8_t level);
+void vtxCommonSetPitMode(vtxDevice_t *vtxDevice, uint8_t onoff);
+void vtxCommonSetFrequency(vtxDevice_t *vtxDevice, uint16_t freq);
+
+# 176 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 176 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetBandAndChannel(const vtxDevice_t *vtxDevice, uint8_t *pBand, uint8_t *pChannel);
+
+# 177 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 177 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPowerIndex(const vtxDevice_t *vtxDevice, uint8_t *pIndex);
+
+# 178 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 178 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPitMode(const vtxDevice_t *vtxDevice, uint8_t *pOnOff);
+
+# 179 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 179 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetFrequency(const vtxDevice_t *vtxDevice, uint16_t *pFreq);
+
+# 180 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 180 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetDeviceCapability(const vtxDevice_t *vtxDevice, vtxDeviceCapability_t *pDeviceCapability);
+const char *vtxCommonLookupBandName(const vtxDevice_t *vtxDevice, int band);
+char vtxCommonLookupBandLetter(const vtxDevice_t *vtxDevice, int band);
+char vtxCommonGetBandLetter(const vtxDevice_t *vtxDevice, int band);
+const char *vtxCommonLookupChannelName(const vtxDevice_t *vtxDevice, int channel);
+uint16_t vtxCommonLookupFrequency(const vtxDevice_t *vtxDevice, int band, int channel);
+
+# 186 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 186 "./src/main/drivers/vtx_common.h"
+    vtxCommonLookupBandChan(const vtxDevice_t *vtxDevice, uint16_t freq, uint8_t *pBand, uint8_t *pChannel);
+const char *vtxCommonLookupPowerName(const vtxDevice_t *vtxDevice, int index);
+uint16_t vtxCommonLookupPowerValue(const vtxDevice_t *vtxDevice, int index);
+# 93 "./src/main/cli/cli.c" 2
+# 1 "./src/main/drivers/vtx_table.h" 1
+# 36 "./src/main/drivers/vtx_table.h"
+struct vtxTableConfig_s;
+void vtxTableInit(void);
+void vtxTableStrncpyWithPad(char *dst, const char *src, int length);
+void vtxTableConfigClearBand(struct vtxTableConfig_s *config, int band);
+void vtxTableConfigClearPowerValues(struct vtxTableConfig_s *config, int start);
+void vtxTableConfigClearPowerLabels(struct vtxTableConfig_s *config, int start);
+void vtxTableConfigClearChannels(struct vtxTableConfig_s *config, int band, int channels);
+
+extern int vtxTableBandCount;
+extern int vtxTableChannelCount;
+extern uint16_t vtxTableFrequency[8][8];
+extern const char * vtxTableBandNames[8 + 1];
+extern char vtxTableBandLetters[8 + 1];
+extern const char * vtxTableChannelNames[8 + 1];
+extern int vtxTablePowerLevels;
+extern uint16_t vtxTablePowerValues[8];
+extern const char * vtxTablePowerLabels[8 + 1];
+# 94 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/fc/board_info.h" 1
+# 21 "./src/main/fc/board_info.h"
+       
+
+void initBoardInformation(void);
+
+char *getBoardName(void);
+char *getManufacturerId(void);
+
+# 27 "./src/main/fc/board_info.h" 3 4
+_Bool 
+# 27 "./src/main/fc/board_info.h"
+    boardInformationIsSet(void);
+
+
+# 29 "./src/main/fc/board_info.h" 3 4
+_Bool 
+# 29 "./src/main/fc/board_info.h"
+    setBoardName(char *newBoardName);
+
+# 30 "./src/main/fc/board_info.h" 3 4
+_Bool 
+# 30 "./src/main/fc/board_info.h"
+    setManufacturerId(char *newManufacturerId);
+
+# 31 "./src/main/fc/board_info.h" 3 4
+_Bool 
+# 31 "./src/main/fc/board_info.h"
+    persistBoardInformation(void);
+
+uint8_t * getSignature(void);
+
+# 34 "./src/main/fc/board_info.h" 3 4
+_Bool 
+# 34 "./src/main/fc/board_info.h"
+    signatureIsSet(void);
+
+
+# 36 "./src/main/fc/board_info.h" 3 4
+_Bool 
+# 36 "./src/main/fc/board_info.h"
+    setSignature(uint8_t *newSignature);
+
+# 37 "./src/main/fc/board_info.h" 3 4
+_Bool 
+# 37 "./src/main/fc/board_info.h"
+    persistSignature(void);
+# 96 "./src/main/cli/cli.c" 2
+# 1 "./src/main/fc/config.h" 1
+# 21 "./src/main/fc/config.h"
+       
+# 32 "./src/main/fc/config.h"
+typedef struct pilotConfig_s {
+    char name[16u + 1];
+    char displayName[16u + 1];
+} pilotConfig_t;
+
+extern pilotConfig_t pilotConfig_System; extern pilotConfig_t pilotConfig_Copy; static inline const pilotConfig_t* pilotConfig(void) { return &pilotConfig_System; } static inline pilotConfig_t* pilotConfigMutable(void) { return &pilotConfig_System; } struct _dummy;
+
+typedef struct systemConfig_s {
+    uint8_t pidProfileIndex;
+    uint8_t activeRateProfile;
+    uint8_t debug_mode;
+    uint8_t task_statistics;
+    uint8_t rateProfile6PosSwitch;
+    uint8_t cpu_overclock;
+    uint8_t powerOnArmingGraceTime;
+    char boardIdentifier[sizeof("SITL") + 1];
+    uint8_t hseMhz;
+    uint8_t configured;
+    uint8_t schedulerOptimizeRate;
+} systemConfig_t;
+
+extern systemConfig_t systemConfig_System; extern systemConfig_t systemConfig_Copy; static inline const systemConfig_t* systemConfig(void) { return &systemConfig_System; } static inline systemConfig_t* systemConfigMutable(void) { return &systemConfig_System; } struct _dummy;
+
+struct pidProfile_s;
+extern struct pidProfile_s *currentPidProfile;
+
+
+void initEEPROM(void);
+void resetEEPROM(void);
+
+# 61 "./src/main/fc/config.h" 3 4
+_Bool 
+# 61 "./src/main/fc/config.h"
+    readEEPROM(void);
+void writeEEPROM(void);
+void writeEEPROMWithFeatures(uint32_t features);
+void ensureEEPROMStructureIsValid(void);
+
+void saveConfigAndNotify(void);
+void validateAndFixGyroConfig(void);
+
+void setConfigDirty(void);
+
+# 70 "./src/main/fc/config.h" 3 4
+_Bool 
+# 70 "./src/main/fc/config.h"
+    isConfigDirty(void);
+
+uint8_t getCurrentPidProfileIndex(void);
+void changePidProfile(uint8_t pidProfileIndex);
+void changePidProfileFromCellCount(uint8_t cellCount);
+struct pidProfile_s;
+void resetPidProfile(struct pidProfile_s *profile);
+
+uint8_t getCurrentControlRateProfileIndex(void);
+void changeControlRateProfile(uint8_t profileIndex);
+
+
+# 81 "./src/main/fc/config.h" 3 4
+_Bool 
+# 81 "./src/main/fc/config.h"
+    canSoftwareSerialBeUsed(void);
+
+uint16_t getCurrentMinthrottle(void);
+
+void resetConfigs(void);
+void targetConfiguration(void);
+void targetValidateConfiguration(void);
+
+
+# 89 "./src/main/fc/config.h" 3 4
+_Bool 
+# 89 "./src/main/fc/config.h"
+    isSystemConfigured(void);
+void setRebootRequired(void);
+
+# 91 "./src/main/fc/config.h" 3 4
+_Bool 
+# 91 "./src/main/fc/config.h"
+    getRebootRequired(void);
+# 97 "./src/main/cli/cli.c" 2
+# 1 "./src/main/fc/controlrate_profile.h" 1
+# 21 "./src/main/fc/controlrate_profile.h"
+       
+
+
+
+
+
+typedef enum {
+    RATES_TYPE_BETAFLIGHT = 0,
+    RATES_TYPE_RACEFLIGHT,
+    RATES_TYPE_KISS,
+} ratesType_e;
+
+typedef enum {
+    THROTTLE_LIMIT_TYPE_OFF = 0,
+    THROTTLE_LIMIT_TYPE_SCALE,
+    THROTTLE_LIMIT_TYPE_CLIP,
+    THROTTLE_LIMIT_TYPE_COUNT
+} throttleLimitType_e;
+
+typedef enum {
+    TPA_MODE_PD,
+    TPA_MODE_D
+} tpaMode_e;
+
+
+
+typedef struct controlRateConfig_s {
+    uint8_t thrMid8;
+    uint8_t thrExpo8;
+    uint8_t rates_type;
+    uint8_t rcRates[3];
+    uint8_t rcExpo[3];
+    uint8_t rates[3];
+    uint8_t dynThrPID;
+    uint16_t tpa_breakpoint;
+    uint8_t throttle_limit_type;
+    uint8_t throttle_limit_percent;
+    uint16_t rate_limit[3];
+    uint8_t tpaMode;
+    char profileName[8u + 1];
+} controlRateConfig_t;
+
+extern controlRateConfig_t controlRateProfiles_SystemArray[6]; extern controlRateConfig_t controlRateProfiles_CopyArray[6]; static inline const controlRateConfig_t* controlRateProfiles(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t* controlRateProfilesMutable(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t (* controlRateProfiles_array(void))[6] { return &controlRateProfiles_SystemArray; } struct _dummy;
+
+extern controlRateConfig_t *currentControlRateProfile;
+
+void loadControlRateProfile(void);
+void changeControlRateProfile(uint8_t controlRateProfileIndex);
+
+void copyControlRateProfile(const uint8_t dstControlRateProfileIndex, const uint8_t srcControlRateProfileIndex);
+# 98 "./src/main/cli/cli.c" 2
+# 1 "./src/main/fc/core.h" 1
+# 21 "./src/main/fc/core.h"
+       
+
+
+
+
+
+extern int16_t magHold;
+
+
+extern 
+# 30 "./src/main/fc/core.h" 3 4
+      _Bool 
+# 30 "./src/main/fc/core.h"
+           isRXDataNew;
+
+typedef struct throttleCorrectionConfig_s {
+    uint16_t throttle_correction_angle;
+    uint8_t throttle_correction_value;
+} throttleCorrectionConfig_t;
+
+typedef enum {
+    LAUNCH_CONTROL_DISABLED = 0,
+    LAUNCH_CONTROL_ACTIVE,
+    LAUNCH_CONTROL_TRIGGERED,
+} launchControlState_e;
+
+typedef enum {
+    LAUNCH_CONTROL_MODE_NORMAL = 0,
+    LAUNCH_CONTROL_MODE_PITCHONLY,
+    LAUNCH_CONTROL_MODE_FULL,
+    LAUNCH_CONTROL_MODE_COUNT
+} launchControlMode_e;
+
+
+
+extern const char * const osdLaunchControlModeNames[LAUNCH_CONTROL_MODE_COUNT];
+
+
+extern throttleCorrectionConfig_t throttleCorrectionConfig_System; extern throttleCorrectionConfig_t throttleCorrectionConfig_Copy; static inline const throttleCorrectionConfig_t* throttleCorrectionConfig(void) { return &throttleCorrectionConfig_System; } static inline throttleCorrectionConfig_t* throttleCorrectionConfigMutable(void) { return &throttleCorrectionConfig_System; } struct _dummy;
+
+union rollAndPitchTrims_u;
+void handleInflightCalibrationStickPosition(void);
+
+void resetArmingDisabled(void);
+
+void disarm(void);
+void tryArm(void);
+
+
+# 65 "./src/main/fc/core.h" 3 4
+_Bool 
+# 65 "./src/main/fc/core.h"
+    processRx(timeUs_t currentTimeUs);
+void updateArmingStatus(void);
+
+void taskMainPidLoop(timeUs_t currentTimeUs);
+
+
+# 70 "./src/main/fc/core.h" 3 4
+_Bool 
+# 70 "./src/main/fc/core.h"
+    isFlipOverAfterCrashActive(void);
+int8_t calculateThrottlePercent(void);
+uint8_t calculateThrottlePercentAbs(void);
+
+# 73 "./src/main/fc/core.h" 3 4
+_Bool 
+# 73 "./src/main/fc/core.h"
+    areSticksActive(uint8_t stickPercentLimit);
+void runawayTakeoffTemporaryDisable(uint8_t disableFlag);
+
+# 75 "./src/main/fc/core.h" 3 4
+_Bool 
+# 75 "./src/main/fc/core.h"
+    isAirmodeActivated();
+timeUs_t getLastDisarmTimeUs(void);
+
+# 77 "./src/main/fc/core.h" 3 4
+_Bool 
+# 77 "./src/main/fc/core.h"
+    isTryingToArm();
+void resetTryingToArm();
+
+void subTaskTelemetryPollSensors(timeUs_t currentTimeUs);
+
+
+# 82 "./src/main/fc/core.h" 3 4
+_Bool 
+# 82 "./src/main/fc/core.h"
+    isLaunchControlActive(void);
+# 99 "./src/main/cli/cli.c" 2
+# 1 "./src/main/fc/rc.h" 1
+# 21 "./src/main/fc/rc.h"
+       
+
+# 1 "./src/main/fc/rc_controls.h" 1
+# 21 "./src/main/fc/rc_controls.h"
+       
+
+
+
+
+
+
+typedef enum rc_alias {
+    ROLL = 0,
+    PITCH,
+    YAW,
+    THROTTLE,
+    AUX1,
+    AUX2,
+    AUX3,
+    AUX4,
+    AUX5,
+    AUX6,
+    AUX7,
+    AUX8
+} rc_alias_e;
+
+
+
+typedef enum {
+    THROTTLE_LOW = 0,
+    THROTTLE_HIGH
+} throttleStatus_e;
+
+
+
+typedef enum {
+    NOT_CENTERED = 0,
+    CENTERED
+} rollPitchStatus_e;
+
+typedef enum {
+    RC_SMOOTHING_OFF = 0,
+    RC_SMOOTHING_DEFAULT,
+    RC_SMOOTHING_AUTO,
+    RC_SMOOTHING_MANUAL
+} rcSmoothing_t;
+
+typedef enum {
+    RC_SMOOTHING_TYPE_INTERPOLATION,
+    RC_SMOOTHING_TYPE_FILTER
+} rcSmoothingType_e;
+
+typedef enum {
+    RC_SMOOTHING_INPUT_PT1,
+    RC_SMOOTHING_INPUT_BIQUAD
+} rcSmoothingInputFilter_e;
+
+typedef enum {
+    RC_SMOOTHING_DERIVATIVE_OFF,
+    RC_SMOOTHING_DERIVATIVE_PT1,
+    RC_SMOOTHING_DERIVATIVE_BIQUAD
+} rcSmoothingDerivativeFilter_e;
+# 105 "./src/main/fc/rc_controls.h"
+extern float rcCommand[4];
+
+typedef struct rcSmoothingFilterTraining_s {
+    float sum;
+    int count;
+    uint16_t min;
+    uint16_t max;
+} rcSmoothingFilterTraining_t;
+
+typedef union rcSmoothingFilterTypes_u {
+    pt1Filter_t pt1Filter;
+    biquadFilter_t biquadFilter;
+} rcSmoothingFilterTypes_t;
+
+typedef struct rcSmoothingFilter_s {
+    
+# 120 "./src/main/fc/rc_controls.h" 3 4
+   _Bool 
+# 120 "./src/main/fc/rc_controls.h"
+        filterInitialized;
+    rcSmoothingFilterTypes_t filter[4];
+    rcSmoothingInputFilter_e inputFilterType;
+    uint8_t inputCutoffSetting;
+    uint16_t inputCutoffFrequency;
+    rcSmoothingDerivativeFilter_e derivativeFilterType;
+    uint8_t derivativeCutoffSetting;
+    uint16_t derivativeCutoffFrequency;
+    int averageFrameTimeUs;
+    rcSmoothingFilterTraining_t training;
+    uint8_t debugAxis;
+    uint8_t autoSmoothnessFactor;
+} rcSmoothingFilter_t;
+
+typedef struct rcControlsConfig_s {
+    uint8_t deadband;
+    uint8_t yaw_deadband;
+    uint8_t alt_hold_deadband;
+    uint8_t alt_hold_fast_change;
+    
+# 139 "./src/main/fc/rc_controls.h" 3 4
+   _Bool 
+# 139 "./src/main/fc/rc_controls.h"
+        yaw_control_reversed;
+} rcControlsConfig_t;
+
+extern rcControlsConfig_t rcControlsConfig_System; extern rcControlsConfig_t rcControlsConfig_Copy; static inline const rcControlsConfig_t* rcControlsConfig(void) { return &rcControlsConfig_System; } static inline rcControlsConfig_t* rcControlsConfigMutable(void) { return &rcControlsConfig_System; } struct _dummy;
+
+typedef struct flight3DConfig_s {
+    uint16_t deadband3d_low;
+    uint16_t deadband3d_high;
+    uint16_t neutral3d;
+    uint16_t deadband3d_throttle;
+    uint16_t limit3d_low;
+    uint16_t limit3d_high;
+    uint8_t switched_mode3d;
+} flight3DConfig_t;
+
+extern flight3DConfig_t flight3DConfig_System; extern flight3DConfig_t flight3DConfig_Copy; static inline const flight3DConfig_t* flight3DConfig(void) { return &flight3DConfig_System; } static inline flight3DConfig_t* flight3DConfigMutable(void) { return &flight3DConfig_System; } struct _dummy;
+
+typedef struct armingConfig_s {
+    uint8_t gyro_cal_on_first_arm;
+    uint8_t auto_disarm_delay;
+} armingConfig_t;
+
+extern armingConfig_t armingConfig_System; extern armingConfig_t armingConfig_Copy; static inline const armingConfig_t* armingConfig(void) { return &armingConfig_System; } static inline armingConfig_t* armingConfigMutable(void) { return &armingConfig_System; } struct _dummy;
+
+
+# 163 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 163 "./src/main/fc/rc_controls.h"
+    areUsingSticksToArm(void);
+
+
+# 165 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 165 "./src/main/fc/rc_controls.h"
+    areSticksInApModePosition(uint16_t ap_mode);
+throttleStatus_e calculateThrottleStatus(void);
+void processRcStickPositions();
+
+
+# 169 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 169 "./src/main/fc/rc_controls.h"
+    isUsingSticksForArming(void);
+
+int32_t getRcStickDeflection(int32_t axis, uint16_t midrc);
+void rcControlsInit(void);
+# 24 "./src/main/fc/rc.h" 2
+
+typedef enum {
+    INTERPOLATION_CHANNELS_RP,
+    INTERPOLATION_CHANNELS_RPY,
+    INTERPOLATION_CHANNELS_RPYT,
+    INTERPOLATION_CHANNELS_T,
+    INTERPOLATION_CHANNELS_RPT,
+} interpolationChannels_e;
+
+extern uint16_t currentRxRefreshRate;
+
+void processRcCommand(void);
+float getSetpointRate(int axis);
+float getRcDeflection(int axis);
+float getRcDeflectionAbs(int axis);
+float getThrottlePIDAttenuation(void);
+void updateRcCommands(void);
+void resetYawAxis(void);
+void initRcProcessing(void);
+void rcChangeProfile(uint8_t controlRateProfileIndex);
+
+# 44 "./src/main/fc/rc.h" 3 4
+_Bool 
+# 44 "./src/main/fc/rc.h"
+    isMotorsReversed(void);
+
+# 45 "./src/main/fc/rc.h" 3 4
+_Bool 
+# 45 "./src/main/fc/rc.h"
+    rcSmoothingIsEnabled(void);
+rcSmoothingFilter_t *getRcSmoothingData(void);
+
+# 47 "./src/main/fc/rc.h" 3 4
+_Bool 
+# 47 "./src/main/fc/rc.h"
+    rcSmoothingAutoCalculate(void);
+
+# 48 "./src/main/fc/rc.h" 3 4
+_Bool 
+# 48 "./src/main/fc/rc.h"
+    rcSmoothingInitializationComplete(void);
+# 100 "./src/main/cli/cli.c" 2
+# 1 "./src/main/fc/rc_adjustments.h" 1
+# 21 "./src/main/fc/rc_adjustments.h"
+       
+
+
+
+# 1 "./src/main/fc/rc_modes.h" 1
+# 21 "./src/main/fc/rc_modes.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+
+    BOXARM = 0,
+
+    BOXANGLE,
+    BOXHORIZON,
+    BOXMAG,
+    BOXHEADFREE,
+    BOXPASSTHRU,
+    BOXFAILSAFE,
+    BOXGPSRESCUE,
+    BOXID_FLIGHTMODE_LAST = BOXGPSRESCUE,
+
+
+
+
+    BOXANTIGRAVITY,
+    BOXHEADADJ,
+    BOXCAMSTAB,
+    BOXBEEPERON,
+    BOXLEDLOW,
+    BOXCALIB,
+    BOXOSD,
+    BOXTELEMETRY,
+    BOXSERVO1,
+    BOXSERVO2,
+    BOXSERVO3,
+    BOXBLACKBOX,
+    BOXAIRMODE,
+    BOX3D,
+    BOXFPVANGLEMIX,
+    BOXBLACKBOXERASE,
+    BOXCAMERA1,
+    BOXCAMERA2,
+    BOXCAMERA3,
+    BOXFLIPOVERAFTERCRASH,
+    BOXPREARM,
+    BOXBEEPGPSCOUNT,
+    BOXVTXPITMODE,
+    BOXPARALYZE,
+    BOXUSER1,
+    BOXUSER2,
+    BOXUSER3,
+    BOXUSER4,
+    BOXPIDAUDIO,
+    BOXACROTRAINER,
+    BOXVTXCONTROLDISABLE,
+    BOXLAUNCHCONTROL,
+    CHECKBOX_ITEM_COUNT
+} boxId_e;
+
+typedef enum {
+    MODELOGIC_OR = 0,
+    MODELOGIC_AND
+} modeLogic_e;
+
+
+typedef struct boxBitmask_s { uint32_t bits[(CHECKBOX_ITEM_COUNT + 31) / 32]; } boxBitmask_t;
+# 103 "./src/main/fc/rc_modes.h"
+typedef struct channelRange_s {
+    uint8_t startStep;
+    uint8_t endStep;
+} channelRange_t;
+
+typedef struct modeActivationCondition_s {
+    boxId_e modeId;
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+    modeLogic_e modeLogic;
+    boxId_e linkedTo;
+} modeActivationCondition_t;
+
+extern modeActivationCondition_t modeActivationConditions_SystemArray[20]; extern modeActivationCondition_t modeActivationConditions_CopyArray[20]; static inline const modeActivationCondition_t* modeActivationConditions(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t* modeActivationConditionsMutable(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t (* modeActivationConditions_array(void))[20] { return &modeActivationConditions_SystemArray; } struct _dummy;
+
+typedef struct modeActivationProfile_s {
+    modeActivationCondition_t modeActivationConditions[20];
+} modeActivationProfile_t;
+
+
+
+
+# 124 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 124 "./src/main/fc/rc_modes.h"
+    IS_RC_MODE_ACTIVE(boxId_e boxId);
+void rcModeUpdate(boxBitmask_t *newState);
+
+
+# 127 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 127 "./src/main/fc/rc_modes.h"
+    airmodeIsEnabled(void);
+
+
+# 129 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 129 "./src/main/fc/rc_modes.h"
+    isRangeActive(uint8_t auxChannelIndex, const channelRange_t *range);
+void updateActivatedModes(void);
+
+# 131 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 131 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionPresent(boxId_e modeId);
+
+# 132 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 132 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionLinked(boxId_e modeId);
+void removeModeActivationCondition(boxId_e modeId);
+
+# 134 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 134 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionConfigured(const modeActivationCondition_t *mac, const modeActivationCondition_t *emptyMac);
+void analyzeModeActivationConditions(void);
+# 26 "./src/main/fc/rc_adjustments.h" 2
+
+typedef enum {
+    ADJUSTMENT_NONE = 0,
+    ADJUSTMENT_RC_RATE,
+    ADJUSTMENT_RC_EXPO,
+    ADJUSTMENT_THROTTLE_EXPO,
+    ADJUSTMENT_PITCH_ROLL_RATE,
+    ADJUSTMENT_YAW_RATE,
+    ADJUSTMENT_PITCH_ROLL_P,
+    ADJUSTMENT_PITCH_ROLL_I,
+    ADJUSTMENT_PITCH_ROLL_D,
+    ADJUSTMENT_YAW_P,
+    ADJUSTMENT_YAW_I,
+    ADJUSTMENT_YAW_D,
+    ADJUSTMENT_RATE_PROFILE,
+    ADJUSTMENT_PITCH_RATE,
+    ADJUSTMENT_ROLL_RATE,
+    ADJUSTMENT_PITCH_P,
+    ADJUSTMENT_PITCH_I,
+    ADJUSTMENT_PITCH_D,
+    ADJUSTMENT_ROLL_P,
+    ADJUSTMENT_ROLL_I,
+    ADJUSTMENT_ROLL_D,
+    ADJUSTMENT_RC_RATE_YAW,
+    ADJUSTMENT_PITCH_ROLL_F,
+    ADJUSTMENT_FEEDFORWARD_TRANSITION,
+    ADJUSTMENT_HORIZON_STRENGTH,
+    ADJUSTMENT_ROLL_RC_RATE,
+    ADJUSTMENT_PITCH_RC_RATE,
+    ADJUSTMENT_ROLL_RC_EXPO,
+    ADJUSTMENT_PITCH_RC_EXPO,
+    ADJUSTMENT_PID_AUDIO,
+    ADJUSTMENT_PITCH_F,
+    ADJUSTMENT_ROLL_F,
+    ADJUSTMENT_YAW_F,
+    ADJUSTMENT_OSD_PROFILE,
+    ADJUSTMENT_LED_PROFILE,
+    ADJUSTMENT_FUNCTION_COUNT
+} adjustmentFunction_e;
+
+typedef enum {
+    ADJUSTMENT_MODE_STEP,
+    ADJUSTMENT_MODE_SELECT
+} adjustmentMode_e;
+
+typedef union adjustmentConfig_u {
+    uint8_t step;
+    uint8_t switchPositions;
+} adjustmentData_t;
+
+typedef struct adjustmentConfig_s {
+    adjustmentFunction_e adjustmentFunction;
+    adjustmentMode_e mode;
+    adjustmentData_t data;
+} adjustmentConfig_t;
+
+
+
+typedef struct adjustmentRange_s {
+
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+
+
+    uint8_t adjustmentConfig;
+    uint8_t auxSwitchChannelIndex;
+
+
+    uint8_t adjustmentIndex;
+    uint16_t adjustmentCenter;
+    uint16_t adjustmentScale;
+} adjustmentRange_t;
+
+extern adjustmentRange_t adjustmentRanges_SystemArray[30]; extern adjustmentRange_t adjustmentRanges_CopyArray[30]; static inline const adjustmentRange_t* adjustmentRanges(int _index) { return &adjustmentRanges_SystemArray[_index]; } static inline adjustmentRange_t* adjustmentRangesMutable(int _index) { return &adjustmentRanges_SystemArray[_index]; } static inline adjustmentRange_t (* adjustmentRanges_array(void))[30] { return &adjustmentRanges_SystemArray; } struct _dummy;
+
+
+
+typedef struct adjustmentState_s {
+    uint8_t auxChannelIndex;
+    const adjustmentConfig_t *config;
+    uint32_t timeoutAt;
+} adjustmentState_t;
+
+
+
+
+
+void resetAdjustmentStates(void);
+struct controlRateConfig_s;
+void processRcAdjustments(struct controlRateConfig_s *controlRateConfig);
+const char *getAdjustmentsRangeName(void);
+int getAdjustmentsRangeValue(void);
+void activeAdjustmentRangeReset(void);
+# 101 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/fc/runtime_config.h" 1
+# 21 "./src/main/fc/runtime_config.h"
+       
+
+
+
+
+typedef enum {
+    ARMED = (1 << 0),
+    WAS_EVER_ARMED = (1 << 1),
+    WAS_ARMED_WITH_PREARM = (1 << 2)
+} armingFlag_e;
+
+extern uint8_t armingFlags;
+# 42 "./src/main/fc/runtime_config.h"
+typedef enum {
+    ARMING_DISABLED_NO_GYRO = (1 << 0),
+    ARMING_DISABLED_FAILSAFE = (1 << 1),
+    ARMING_DISABLED_RX_FAILSAFE = (1 << 2),
+    ARMING_DISABLED_BAD_RX_RECOVERY = (1 << 3),
+    ARMING_DISABLED_BOXFAILSAFE = (1 << 4),
+    ARMING_DISABLED_RUNAWAY_TAKEOFF = (1 << 5),
+    ARMING_DISABLED_CRASH_DETECTED = (1 << 6),
+    ARMING_DISABLED_THROTTLE = (1 << 7),
+    ARMING_DISABLED_ANGLE = (1 << 8),
+    ARMING_DISABLED_BOOT_GRACE_TIME = (1 << 9),
+    ARMING_DISABLED_NOPREARM = (1 << 10),
+    ARMING_DISABLED_LOAD = (1 << 11),
+    ARMING_DISABLED_CALIBRATING = (1 << 12),
+    ARMING_DISABLED_CLI = (1 << 13),
+    ARMING_DISABLED_CMS_MENU = (1 << 14),
+    ARMING_DISABLED_BST = (1 << 15),
+    ARMING_DISABLED_MSP = (1 << 16),
+    ARMING_DISABLED_PARALYZE = (1 << 17),
+    ARMING_DISABLED_GPS = (1 << 18),
+    ARMING_DISABLED_RESC = (1 << 19),
+    ARMING_DISABLED_RPMFILTER = (1 << 20),
+    ARMING_DISABLED_REBOOT_REQUIRED = (1 << 21),
+    ARMING_DISABLED_ARM_SWITCH = (1 << 22),
+} armingDisableFlags_e;
+
+
+
+extern const char *armingDisableFlagNames[((32*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) + (16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L) + (8*((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L)) >>8*((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L)) >>8*((((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))*1L >>16*(((ARMING_DISABLED_ARM_SWITCH)*1L >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0) >>16*((ARMING_DISABLED_ARM_SWITCH)/2L>>31 > 0))>65535L))>255))/2+1))))) + 1)];
+
+void setArmingDisabled(armingDisableFlags_e flag);
+void unsetArmingDisabled(armingDisableFlags_e flag);
+
+# 74 "./src/main/fc/runtime_config.h" 3 4
+_Bool 
+# 74 "./src/main/fc/runtime_config.h"
+    isArmingDisabled(void);
+armingDisableFlags_e getArmingDisableFlags(void);
+
+typedef enum {
+    ANGLE_MODE = (1 << 0),
+    HORIZON_MODE = (1 << 1),
+    MAG_MODE = (1 << 2),
+
+
+
+    HEADFREE_MODE = (1 << 6),
+
+    PASSTHRU_MODE = (1 << 8),
+
+    FAILSAFE_MODE = (1 << 10),
+    GPS_RESCUE_MODE = (1 << 11)
+} flightModeFlags_e;
+
+extern uint16_t flightModeFlags;
+# 111 "./src/main/fc/runtime_config.h"
+typedef enum {
+    GPS_FIX_HOME = (1 << 0),
+    GPS_FIX = (1 << 1),
+    CALIBRATE_MAG = (1 << 2),
+    SMALL_ANGLE = (1 << 3),
+    FIXED_WING = (1 << 4)
+} stateFlags_t;
+
+
+
+
+
+extern uint8_t stateFlags;
+
+uint16_t enableFlightMode(flightModeFlags_e mask);
+uint16_t disableFlightMode(flightModeFlags_e mask);
+
+
+# 128 "./src/main/fc/runtime_config.h" 3 4
+_Bool 
+# 128 "./src/main/fc/runtime_config.h"
+    sensors(uint32_t mask);
+void sensorsSet(uint32_t mask);
+void sensorsClear(uint32_t mask);
+uint32_t sensorsMask(void);
+
+void mwDisarm(void);
+# 103 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/flight/failsafe.h" 1
+# 21 "./src/main/flight/failsafe.h"
+       
+# 35 "./src/main/flight/failsafe.h"
+typedef struct failsafeConfig_s {
+    uint16_t failsafe_throttle;
+    uint16_t failsafe_throttle_low_delay;
+    uint8_t failsafe_delay;
+    uint8_t failsafe_off_delay;
+    uint8_t failsafe_switch_mode;
+    uint8_t failsafe_procedure;
+    uint16_t failsafe_recovery_delay;
+    uint8_t failsafe_stick_threshold;
+} failsafeConfig_t;
+
+extern failsafeConfig_t failsafeConfig_System; extern failsafeConfig_t failsafeConfig_Copy; static inline const failsafeConfig_t* failsafeConfig(void) { return &failsafeConfig_System; } static inline failsafeConfig_t* failsafeConfigMutable(void) { return &failsafeConfig_System; } struct _dummy;
+
+typedef enum {
+    FAILSAFE_IDLE = 0,
+    FAILSAFE_RX_LOSS_DETECTED,
+    FAILSAFE_LANDING,
+    FAILSAFE_LANDED,
+    FAILSAFE_RX_LOSS_MONITORING,
+    FAILSAFE_RX_LOSS_RECOVERED,
+    FAILSAFE_GPS_RESCUE
+} failsafePhase_e;
+
+typedef enum {
+    FAILSAFE_RXLINK_DOWN = 0,
+    FAILSAFE_RXLINK_UP
+} failsafeRxLinkState_e;
+
+typedef enum {
+    FAILSAFE_PROCEDURE_AUTO_LANDING = 0,
+    FAILSAFE_PROCEDURE_DROP_IT,
+
+
+
+    FAILSAFE_PROCEDURE_COUNT
+} failsafeProcedure_e;
+
+extern const char * const failsafeProcedureNames[FAILSAFE_PROCEDURE_COUNT];
+
+typedef enum {
+    FAILSAFE_SWITCH_MODE_STAGE1 = 0,
+    FAILSAFE_SWITCH_MODE_KILL,
+    FAILSAFE_SWITCH_MODE_STAGE2
+} failsafeSwitchMode_e;
+
+typedef struct failsafeState_s {
+    int16_t events;
+    
+# 82 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 82 "./src/main/flight/failsafe.h"
+        monitoring;
+    
+# 83 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 83 "./src/main/flight/failsafe.h"
+        active;
+    uint32_t rxDataFailurePeriod;
+    uint32_t rxDataRecoveryPeriod;
+    uint32_t validRxDataReceivedAt;
+    uint32_t validRxDataFailedAt;
+    uint32_t throttleLowPeriod;
+    uint32_t landingShouldBeFinishedAt;
+    uint32_t receivingRxDataPeriod;
+    uint32_t receivingRxDataPeriodPreset;
+    failsafePhase_e phase;
+    failsafeRxLinkState_e rxLinkState;
+} failsafeState_t;
+
+void failsafeInit(void);
+void failsafeReset(void);
+
+void failsafeStartMonitoring(void);
+void failsafeUpdateState(void);
+
+failsafePhase_e failsafePhase(void);
+
+# 103 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 103 "./src/main/flight/failsafe.h"
+    failsafeIsMonitoring(void);
+
+# 104 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 104 "./src/main/flight/failsafe.h"
+    failsafeIsActive(void);
+
+# 105 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 105 "./src/main/flight/failsafe.h"
+    failsafeIsReceivingRxData(void);
+void failsafeOnRxSuspend(uint32_t suspendPeriod);
+void failsafeOnRxResume(void);
+
+void failsafeOnValidDataReceived(void);
+void failsafeOnValidDataFailed(void);
+# 105 "./src/main/cli/cli.c" 2
+# 1 "./src/main/flight/imu.h" 1
+# 21 "./src/main/flight/imu.h"
+       
+
+
+
+
+
+
+
+extern uint32_t accTimeSum;
+extern int accSumCount;
+extern int32_t accSum[3];
+extern 
+# 32 "./src/main/flight/imu.h" 3 4
+      _Bool 
+# 32 "./src/main/flight/imu.h"
+           canUseGPSHeading;
+extern float accAverage[3];
+
+typedef struct {
+    float w,x,y,z;
+} quaternion;
+
+
+typedef struct {
+    float ww,wx,wy,wz,xx,xy,xz,yy,yz,zz;
+} quaternionProducts;
+
+
+typedef union {
+    int16_t raw[3];
+    struct {
+
+        int16_t roll;
+        int16_t pitch;
+        int16_t yaw;
+    } values;
+} attitudeEulerAngles_t;
+
+
+extern attitudeEulerAngles_t attitude;
+
+typedef struct imuConfig_s {
+    uint16_t dcm_kp;
+    uint16_t dcm_ki;
+    uint8_t small_angle;
+    uint8_t fast_attitude;
+} imuConfig_t;
+
+extern imuConfig_t imuConfig_System; extern imuConfig_t imuConfig_Copy; static inline const imuConfig_t* imuConfig(void) { return &imuConfig_System; } static inline imuConfig_t* imuConfigMutable(void) { return &imuConfig_System; } struct _dummy;
+
+typedef struct imuRuntimeConfig_s {
+    float dcm_ki;
+    float dcm_kp;
+    
+# 70 "./src/main/flight/imu.h" 3 4
+   _Bool 
+# 70 "./src/main/flight/imu.h"
+        fast_attitude;
+} imuRuntimeConfig_t;
+
+void imuConfigure(uint16_t throttle_correction_angle, uint8_t throttle_correction_value);
+
+float getCosTiltAngle(void);
+void getQuaternion(quaternion * q);
+void imuUpdateAttitude(timeUs_t currentTimeUs);
+void imuUpdateGyroAttitude(timeUs_t currentTimeUs);
+int16_t imuGetAttitudeAngle(int axis);
+
+void imuResetAccelerationSum(void);
+void imuInit(void);
+
+
+void imuSetAttitudeRPY(float roll, float pitch, float yaw);
+void imuSetAttitudeQuat(float w, float x, float y, float z);
+
+
+
+
+
+void imuQuaternionComputeProducts(quaternion *quat, quaternionProducts *quatProd);
+
+# 93 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 93 "./src/main/flight/imu.h"
+    imuQuaternionHeadfreeOffsetSet(void);
+void imuQuaternionHeadfreeTransformVectorEarthToBody(t_fp_vector_def * v);
+void imuComputeQuaternionFromRPY(quaternionProducts *qP, int16_t initialRoll, int16_t initialPitch, int16_t initialYaw);
+
+# 96 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 96 "./src/main/flight/imu.h"
+    shouldInitializeGPSHeading(void);
+# 106 "./src/main/cli/cli.c" 2
+# 1 "./src/main/flight/mixer.h" 1
+# 21 "./src/main/flight/mixer.h"
+       
+# 39 "./src/main/flight/mixer.h"
+typedef enum mixerMode
+{
+    MIXER_TRI = 1,
+    MIXER_QUADP = 2,
+    MIXER_QUADX = 3,
+    MIXER_BICOPTER = 4,
+    MIXER_GIMBAL = 5,
+    MIXER_Y6 = 6,
+    MIXER_HEX6 = 7,
+    MIXER_FLYING_WING = 8,
+    MIXER_Y4 = 9,
+    MIXER_HEX6X = 10,
+    MIXER_OCTOX8 = 11,
+    MIXER_OCTOFLATP = 12,
+    MIXER_OCTOFLATX = 13,
+    MIXER_AIRPLANE = 14,
+    MIXER_HELI_120_CCPM = 15,
+    MIXER_HELI_90_DEG = 16,
+    MIXER_VTAIL4 = 17,
+    MIXER_HEX6H = 18,
+    MIXER_PPM_TO_SERVO = 19,
+    MIXER_DUALCOPTER = 20,
+    MIXER_SINGLECOPTER = 21,
+    MIXER_ATAIL4 = 22,
+    MIXER_CUSTOM = 23,
+    MIXER_CUSTOM_AIRPLANE = 24,
+    MIXER_CUSTOM_TRI = 25,
+    MIXER_QUADX_1234 = 26
+} mixerMode_e;
+
+
+typedef struct motorMixer_s {
+    float throttle;
+    float roll;
+    float pitch;
+    float yaw;
+} motorMixer_t;
+
+extern motorMixer_t customMotorMixer_SystemArray[8]; extern motorMixer_t customMotorMixer_CopyArray[8]; static inline const motorMixer_t* customMotorMixer(int _index) { return &customMotorMixer_SystemArray[_index]; } static inline motorMixer_t* customMotorMixerMutable(int _index) { return &customMotorMixer_SystemArray[_index]; } static inline motorMixer_t (* customMotorMixer_array(void))[8] { return &customMotorMixer_SystemArray; } struct _dummy;
+
+
+typedef struct mixer_s {
+    uint8_t motorCount;
+    uint8_t useServo;
+    const motorMixer_t *motor;
+} mixer_t;
+
+typedef struct mixerConfig_s {
+    uint8_t mixerMode;
+    
+# 88 "./src/main/flight/mixer.h" 3 4
+   _Bool 
+# 88 "./src/main/flight/mixer.h"
+        yaw_motors_reversed;
+    uint8_t crashflip_motor_percent;
+} mixerConfig_t;
+
+extern mixerConfig_t mixerConfig_System; extern mixerConfig_t mixerConfig_Copy; static inline const mixerConfig_t* mixerConfig(void) { return &mixerConfig_System; } static inline mixerConfig_t* mixerConfigMutable(void) { return &mixerConfig_System; } struct _dummy;
+
+typedef struct motorConfig_s {
+    motorDevConfig_t dev;
+    uint16_t digitalIdleOffsetValue;
+    uint16_t minthrottle;
+    uint16_t maxthrottle;
+    uint16_t mincommand;
+    uint8_t motorPoleCount;
+} motorConfig_t;
+
+extern motorConfig_t motorConfig_System; extern motorConfig_t motorConfig_Copy; static inline const motorConfig_t* motorConfig(void) { return &motorConfig_System; } static inline motorConfig_t* motorConfigMutable(void) { return &motorConfig_System; } struct _dummy;
+
+
+
+extern const mixer_t mixers[];
+extern float motor[8];
+extern float motor_disarmed[8];
+extern float motorOutputHigh, motorOutputLow;
+struct rxConfig_s;
+
+uint8_t getMotorCount(void);
+float getMotorMixRange(void);
+
+# 115 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 115 "./src/main/flight/mixer.h"
+    areMotorsRunning(void);
+
+void mixerLoadMix(int index, motorMixer_t *customMixers);
+void initEscEndpoints(void);
+void mixerInit(mixerMode_e mixerMode);
+
+void mixerConfigureOutput(void);
+
+void mixerResetDisarmedMotors(void);
+void mixTable(timeUs_t currentTimeUs, uint8_t vbatPidCompensation);
+void syncMotors(
+# 125 "./src/main/flight/mixer.h" 3 4
+               _Bool 
+# 125 "./src/main/flight/mixer.h"
+                    enabled);
+void writeMotors(void);
+void stopMotors(void);
+void stopPwmAllMotors(void);
+
+float convertExternalToMotor(uint16_t externalValue);
+uint16_t convertMotorToExternal(float motorValue);
+
+# 132 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 132 "./src/main/flight/mixer.h"
+    mixerIsTricopter(void);
+
+void mixerSetThrottleAngleCorrection(int correctionValue);
+float mixerGetLoggingThrottle(void);
+
+# 136 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 136 "./src/main/flight/mixer.h"
+    isDshotTelemetryActive(void);
+# 107 "./src/main/cli/cli.c" 2
+# 1 "./src/main/flight/pid.h" 1
+# 21 "./src/main/flight/pid.h"
+       
+# 51 "./src/main/flight/pid.h"
+typedef enum {
+    PID_ROLL,
+    PID_PITCH,
+    PID_YAW,
+    PID_LEVEL,
+    PID_MAG,
+    PID_ITEM_COUNT
+} pidIndex_e;
+
+typedef enum {
+    SUPEREXPO_YAW_OFF = 0,
+    SUPEREXPO_YAW_ON,
+    SUPEREXPO_YAW_ALWAYS
+} pidSuperExpoYaw_e;
+
+typedef enum {
+    PID_STABILISATION_OFF = 0,
+    PID_STABILISATION_ON
+} pidStabilisationState_e;
+
+typedef enum {
+    PID_CRASH_RECOVERY_OFF = 0,
+    PID_CRASH_RECOVERY_ON,
+    PID_CRASH_RECOVERY_BEEP,
+    PID_CRASH_RECOVERY_DISARM,
+} pidCrashRecovery_e;
+
+typedef struct pidf_s {
+    uint8_t P;
+    uint8_t I;
+    uint8_t D;
+    uint16_t F;
+} pidf_t;
+
+typedef enum {
+    ANTI_GRAVITY_SMOOTH,
+    ANTI_GRAVITY_STEP
+} antiGravityMode_e;
+
+typedef enum {
+    ITERM_RELAX_OFF,
+    ITERM_RELAX_RP,
+    ITERM_RELAX_RPY,
+    ITERM_RELAX_RP_INC,
+    ITERM_RELAX_RPY_INC
+} itermRelax_e;
+
+typedef enum {
+    ITERM_RELAX_GYRO,
+    ITERM_RELAX_SETPOINT
+} itermRelaxType_e;
+
+
+
+typedef struct pidProfile_s {
+    uint16_t yaw_lowpass_hz;
+    uint16_t dterm_lowpass_hz;
+    uint16_t dterm_notch_hz;
+    uint16_t dterm_notch_cutoff;
+
+    pidf_t pid[PID_ITEM_COUNT];
+
+    uint8_t dterm_filter_type;
+    uint8_t itermWindupPointPercent;
+    uint16_t pidSumLimit;
+    uint16_t pidSumLimitYaw;
+    uint8_t pidAtMinThrottle;
+    uint8_t levelAngleLimit;
+
+    uint8_t horizon_tilt_effect;
+    uint8_t horizon_tilt_expert_mode;
+
+
+    uint8_t antiGravityMode;
+    uint16_t itermThrottleThreshold;
+    uint16_t itermAcceleratorGain;
+    uint16_t yawRateAccelLimit;
+    uint16_t rateAccelLimit;
+    uint16_t crash_dthreshold;
+    uint16_t crash_gthreshold;
+    uint16_t crash_setpoint_threshold;
+    uint16_t crash_time;
+    uint16_t crash_delay;
+    uint8_t crash_recovery_angle;
+    uint8_t crash_recovery_rate;
+    uint8_t vbatPidCompensation;
+    uint8_t feedForwardTransition;
+    uint16_t crash_limit_yaw;
+    uint16_t itermLimit;
+    uint16_t dterm_lowpass2_hz;
+    uint8_t crash_recovery;
+    uint8_t throttle_boost;
+    uint8_t throttle_boost_cutoff;
+    uint8_t iterm_rotation;
+    uint8_t iterm_relax_type;
+    uint8_t iterm_relax_cutoff;
+    uint8_t iterm_relax;
+    uint8_t acro_trainer_angle_limit;
+    uint8_t acro_trainer_debug_axis;
+    uint8_t acro_trainer_gain;
+    uint16_t acro_trainer_lookahead_ms;
+    uint8_t abs_control_gain;
+    uint8_t abs_control_limit;
+    uint8_t abs_control_error_limit;
+    uint8_t abs_control_cutoff;
+    uint8_t dterm_filter2_type;
+    uint16_t dyn_lpf_dterm_min_hz;
+    uint16_t dyn_lpf_dterm_max_hz;
+    uint8_t launchControlMode;
+    uint8_t launchControlThrottlePercent;
+    uint8_t launchControlAngleLimit;
+    uint8_t launchControlGain;
+    uint8_t launchControlAllowTriggerReset;
+    uint8_t use_integrated_yaw;
+    uint8_t integrated_yaw_relax;
+    uint8_t thrustLinearization;
+    uint8_t d_min[3];
+    uint8_t d_min_gain;
+    uint8_t d_min_advance;
+    uint8_t motor_output_limit;
+    int8_t auto_profile_cell_count;
+    uint8_t transient_throttle_limit;
+    char profileName[8u + 1];
+} pidProfile_t;
+
+extern pidProfile_t pidProfiles_SystemArray[3]; extern pidProfile_t pidProfiles_CopyArray[3]; static inline const pidProfile_t* pidProfiles(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t* pidProfilesMutable(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t (* pidProfiles_array(void))[3] { return &pidProfiles_SystemArray; } struct _dummy;
+
+typedef struct pidConfig_s {
+    uint8_t pid_process_denom;
+    uint8_t runaway_takeoff_prevention;
+    uint16_t runaway_takeoff_deactivate_delay;
+    uint8_t runaway_takeoff_deactivate_throttle;
+} pidConfig_t;
+
+extern pidConfig_t pidConfig_System; extern pidConfig_t pidConfig_Copy; static inline const pidConfig_t* pidConfig(void) { return &pidConfig_System; } static inline pidConfig_t* pidConfigMutable(void) { return &pidConfig_System; } struct _dummy;
+
+union rollAndPitchTrims_u;
+void pidController(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
+
+typedef struct pidAxisData_s {
+    float P;
+    float I;
+    float D;
+    float F;
+
+    float Sum;
+} pidAxisData_t;
+
+extern const char pidNames[];
+
+extern pidAxisData_t pidData[3];
+
+extern uint32_t targetPidLooptime;
+
+extern float throttleBoost;
+extern pt1Filter_t throttleLpf;
+
+void pidResetIterm(void);
+void pidStabilisationState(pidStabilisationState_e pidControllerState);
+void pidSetItermAccelerator(float newItermAccelerator);
+void pidInitFilters(const pidProfile_t *pidProfile);
+void pidInitConfig(const pidProfile_t *pidProfile);
+void pidInit(const pidProfile_t *pidProfile);
+void pidChangeProfile(uint8_t pidProfileIndex);
+void pidCopyProfile(uint8_t dstPidProfileIndex, uint8_t srcPidProfileIndex);
+
+# 216 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 216 "./src/main/flight/pid.h"
+    crashRecoveryModeActive(void);
+void pidAcroTrainerInit(void);
+void pidSetAcroTrainerState(
+# 218 "./src/main/flight/pid.h" 3 4
+                           _Bool 
+# 218 "./src/main/flight/pid.h"
+                                newState);
+void pidInitSetpointDerivativeLpf(uint16_t filterCutoff, uint8_t debugAxis, uint8_t filterType);
+void pidUpdateSetpointDerivativeLpf(uint16_t filterCutoff);
+void pidUpdateAntiGravityThrottleFilter(float throttle);
+
+# 222 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 222 "./src/main/flight/pid.h"
+    pidOsdAntiGravityActive(void);
+
+# 223 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 223 "./src/main/flight/pid.h"
+    pidOsdAntiGravityMode(void);
+void pidSetAntiGravityState(
+# 224 "./src/main/flight/pid.h" 3 4
+                           _Bool 
+# 224 "./src/main/flight/pid.h"
+                                newState);
+
+# 225 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 225 "./src/main/flight/pid.h"
+    pidAntiGravityEnabled(void);
+
+float pidApplyThrustLinearization(float motorValue);
+float pidCompensateThrustLinearization(float throttle);
+
+
+void pidUpdateAirmodeLpf(float currentOffset);
+float pidGetAirmodeThrottleOffset();
+# 246 "./src/main/flight/pid.h"
+void dynLpfDTermUpdate(float throttle);
+void pidSetItermReset(
+# 247 "./src/main/flight/pid.h" 3 4
+                     _Bool 
+# 247 "./src/main/flight/pid.h"
+                          enabled);
+float pidGetPreviousSetpoint(int axis);
+# 108 "./src/main/cli/cli.c" 2
+# 1 "./src/main/flight/position.h" 1
+# 21 "./src/main/flight/position.h"
+       
+
+
+
+typedef struct positionConfig_s {
+    uint8_t altSource;
+} positionConfig_t;
+
+extern positionConfig_t positionConfig_System; extern positionConfig_t positionConfig_Copy; static inline const positionConfig_t* positionConfig(void) { return &positionConfig_System; } static inline positionConfig_t* positionConfigMutable(void) { return &positionConfig_System; } struct _dummy;
+
+
+
+typedef struct altitudeEstimator_s {
+    float altitudeCm;
+    float velocityCmS;
+    float accBiasCmSS;
+    
+# 37 "./src/main/flight/position.h" 3 4
+   _Bool 
+# 37 "./src/main/flight/position.h"
+        initialised;
+} altitudeEstimator_t;
+
+void altitudeEstimatorInit(altitudeEstimator_t *estimator, float altitudeCm);
+void altitudeEstimatorPredict(altitudeEstimator_t *estimator, float accZCmSS, float dt);
+void altitudeEstimatorCorrect(altitudeEstimator_t *estimator, float altitudeCm, float dt);
+
+void positionUpdateVerticalAcceleration(timeUs_t currentTimeUs, float accZCmSS);
+
+# 45 "./src/main/flight/position.h" 3 4
+_Bool 
+# 45 "./src/main/flight/position.h"
+    isAltitudeOffset(void);
+void calculateEstimatedAltitude(timeUs_t currentTimeUs);
+int32_t getEstimatedAltitudeCm(void);
+int16_t getEstimatedVario(void);
+# 109 "./src/main/cli/cli.c" 2
+# 1 "./src/main/flight/servos.h" 1
+# 21 "./src/main/flight/servos.h"
+       
+
+
+
+
+
+
+enum {
+    INPUT_STABILIZED_ROLL = 0,
+    INPUT_STABILIZED_PITCH,
+    INPUT_STABILIZED_YAW,
+    INPUT_STABILIZED_THROTTLE,
+    INPUT_RC_ROLL,
+    INPUT_RC_PITCH,
+    INPUT_RC_YAW,
+    INPUT_RC_THROTTLE,
+    INPUT_RC_AUX1,
+    INPUT_RC_AUX2,
+    INPUT_RC_AUX3,
+    INPUT_RC_AUX4,
+    INPUT_GIMBAL_PITCH,
+    INPUT_GIMBAL_ROLL,
+    INPUT_SOURCE_COUNT
+};
+
+
+typedef enum {
+    SERVO_GIMBAL_PITCH = 0,
+    SERVO_GIMBAL_ROLL = 1,
+    SERVO_FLAPS = 2,
+    SERVO_FLAPPERON_1 = 3,
+    SERVO_FLAPPERON_2 = 4,
+    SERVO_RUDDER = 5,
+    SERVO_ELEVATOR = 6,
+    SERVO_THROTTLE = 7,
+
+    SERVO_BICOPTER_LEFT = 4,
+    SERVO_BICOPTER_RIGHT = 5,
+
+    SERVO_DUALCOPTER_LEFT = 4,
+    SERVO_DUALCOPTER_RIGHT = 5,
+
+    SERVO_SINGLECOPTER_1 = 3,
+    SERVO_SINGLECOPTER_2 = 4,
+    SERVO_SINGLECOPTER_3 = 5,
+    SERVO_SINGLECOPTER_4 = 6,
+
+    SERVO_HELI_LEFT = 0,
+    SERVO_HELI_RIGHT = 1,
+    SERVO_HELI_TOP = 2,
+    SERVO_HELI_RUD = 3
+
+} servoIndex_e;
+# 89 "./src/main/flight/servos.h"
+typedef struct servoMixer_s {
+    uint8_t targetChannel;
+    uint8_t inputSource;
+    int8_t rate;
+    uint8_t speed;
+    int8_t min;
+    int8_t max;
+    uint8_t box;
+} servoMixer_t;
+
+extern servoMixer_t customServoMixers_SystemArray[(2 * 8)]; extern servoMixer_t customServoMixers_CopyArray[(2 * 8)]; static inline const servoMixer_t* customServoMixers(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t* customServoMixersMutable(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t (* customServoMixers_array(void))[(2 * 8)] { return &customServoMixers_SystemArray; } struct _dummy;
+
+
+
+
+
+typedef struct mixerRules_s {
+    uint8_t servoRuleCount;
+    const servoMixer_t *rule;
+} mixerRules_t;
+
+extern const mixerRules_t servoMixers[];
+
+typedef struct servoParam_s {
+    uint32_t reversedSources;
+    int16_t min;
+    int16_t max;
+    int16_t middle;
+    int8_t rate;
+    int8_t forwardFromChannel;
+} servoParam_t;
+
+extern servoParam_t servoParams_SystemArray[8]; extern servoParam_t servoParams_CopyArray[8]; static inline const servoParam_t* servoParams(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t* servoParamsMutable(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t (* servoParams_array(void))[8] { return &servoParams_SystemArray; } struct _dummy;
+
+typedef struct servoConfig_s {
+    servoDevConfig_t dev;
+    uint16_t servo_lowpass_freq;
+    uint8_t tri_unarmed_servo;
+    uint8_t channelForwardingStartChannel;
+} servoConfig_t;
+
+extern servoConfig_t servoConfig_System; extern servoConfig_t servoConfig_Copy; static inline const servoConfig_t* servoConfig(void) { return &servoConfig_System; } static inline servoConfig_t* servoConfigMutable(void) { return &servoConfig_System; } struct _dummy;
+
+typedef struct servoProfile_s {
+    servoParam_t servoConf[8];
+} servoProfile_t;
+
+extern int16_t servo[8];
+
+
+# 138 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 138 "./src/main/flight/servos.h"
+    isMixerUsingServos(void);
+void writeServos(void);
+void servoMixerLoadMix(int index);
+void loadCustomServoMixer(void);
+int servoDirection(int servoIndex, int fromChannel);
+void servoConfigureOutput(void);
+void servosInit(void);
+void servosFilterInit(void);
+void servoMixer(void);
+
+void servosTricopterInit(void);
+void servosTricopterMixer(void);
+
+# 150 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 150 "./src/main/flight/servos.h"
+    servosTricopterIsEnabledServoUnarmed(void);
+# 110 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/io/asyncfatfs/asyncfatfs.h" 1
+# 21 "./src/main/io/asyncfatfs/asyncfatfs.h"
+       
+
+
+
+
+# 1 "./src/main/io/asyncfatfs/fat_standard.h" 1
+# 21 "./src/main/io/asyncfatfs/fat_standard.h"
+       
+# 56 "./src/main/io/asyncfatfs/fat_standard.h"
+typedef enum {
+    FAT_FILESYSTEM_TYPE_INVALID,
+    FAT_FILESYSTEM_TYPE_FAT12,
+    FAT_FILESYSTEM_TYPE_FAT16,
+    FAT_FILESYSTEM_TYPE_FAT32
+} fatFilesystemType_e;
+
+typedef struct mbrPartitionEntry_t {
+    uint8_t bootFlag;
+    uint8_t chsBegin[3];
+    uint8_t type;
+    uint8_t chsEnd[3];
+    uint32_t lbaBegin;
+    uint32_t numSectors;
+} __attribute__((packed)) mbrPartitionEntry_t;
+
+typedef struct fat16Descriptor_t {
+    uint8_t driveNumber;
+    uint8_t reserved1;
+    uint8_t bootSignature;
+    uint32_t volumeID;
+    char volumeLabel[11];
+    char fileSystemType[8];
+} __attribute__((packed)) fat16Descriptor_t;
+
+typedef struct fat32Descriptor_t {
+    uint32_t FATSize32;
+    uint16_t extFlags;
+    uint16_t fsVer;
+    uint32_t rootCluster;
+    uint16_t fsInfo;
+    uint16_t backupBootSector;
+    uint8_t reserved[12];
+    uint8_t driveNumber;
+    uint8_t reserved1;
+    uint8_t bootSignature;
+    uint32_t volumeID;
+    char volumeLabel[11];
+    char fileSystemType[8];
+} __attribute__((packed)) fat32Descriptor_t;
+
+typedef struct fatVolumeID_t {
+    uint8_t jmpBoot[3];
+    char oemName[8];
+    uint16_t bytesPerSector;
+    uint8_t sectorsPerCluster;
+    uint16_t reservedSectorCount;
+    uint8_t numFATs;
+    uint16_t rootEntryCount;
+    uint16_t totalSectors16;
+    uint8_t media;
+    uint16_t FATSize16;
+    uint16_t sectorsPerTrack;
+    uint16_t numHeads;
+    uint32_t hiddenSectors;
+    uint32_t totalSectors32;
+    union {
+        fat16Descriptor_t fat16;
+        fat32Descriptor_t fat32;
+    } fatDescriptor;
+} __attribute__((packed)) fatVolumeID_t;
+
+typedef struct fatDirectoryEntry_t {
+    char filename[11];
+    uint8_t attrib;
+    uint8_t ntReserved;
+    uint8_t creationTimeTenths;
+    uint16_t creationTime;
+    uint16_t creationDate;
+    uint16_t lastAccessDate;
+    uint16_t firstClusterHigh;
+    uint16_t lastWriteTime;
+    uint16_t lastWriteDate;
+    uint16_t firstClusterLow;
+    uint32_t fileSize;
+} __attribute__((packed)) fatDirectoryEntry_t;
+
+uint32_t fat32_decodeClusterNumber(uint32_t clusterNumber);
+
+
+# 135 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 135 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat32_isEndOfChainMarker(uint32_t clusterNumber);
+
+# 136 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 136 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat16_isEndOfChainMarker(uint16_t clusterNumber);
+
+
+# 138 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 138 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isFreeSpace(uint32_t clusterNumber);
+
+
+# 140 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 140 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isDirectoryEntryTerminator(fatDirectoryEntry_t *entry);
+
+# 141 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 141 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isDirectoryEntryEmpty(fatDirectoryEntry_t *entry);
+
+void fat_convertFilenameToFATStyle(const char *filename, uint8_t *fatFilename);
+# 27 "./src/main/io/asyncfatfs/asyncfatfs.h" 2
+
+typedef struct afatfsFile_t *afatfsFilePtr_t;
+
+typedef enum {
+    AFATFS_FILESYSTEM_STATE_UNKNOWN,
+    AFATFS_FILESYSTEM_STATE_FATAL,
+    AFATFS_FILESYSTEM_STATE_INITIALIZATION,
+    AFATFS_FILESYSTEM_STATE_READY
+} afatfsFilesystemState_e;
+
+typedef enum {
+    AFATFS_OPERATION_IN_PROGRESS,
+    AFATFS_OPERATION_SUCCESS,
+    AFATFS_OPERATION_FAILURE
+} afatfsOperationStatus_e;
+
+typedef enum {
+    AFATFS_ERROR_NONE = 0,
+    AFATFS_ERROR_GENERIC = 1,
+    AFATFS_ERROR_BAD_MBR = 2,
+    AFATFS_ERROR_BAD_FILESYSTEM_HEADER = 3
+} afatfsError_e;
+
+typedef struct afatfsDirEntryPointer_t {
+    uint32_t sectorNumberPhysical;
+    int16_t entryIndex;
+} afatfsDirEntryPointer_t;
+
+typedef afatfsDirEntryPointer_t afatfsFinder_t;
+
+typedef enum {
+    AFATFS_SEEK_SET,
+    AFATFS_SEEK_CUR,
+    AFATFS_SEEK_END
+} afatfsSeek_e;
+
+typedef void (*afatfsFileCallback_t)(afatfsFilePtr_t file);
+typedef void (*afatfsCallback_t)(void);
+
+
+# 66 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 66 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_fopen(const char *filename, const char *mode, afatfsFileCallback_t complete);
+
+# 67 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 67 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_ftruncate(afatfsFilePtr_t file, afatfsFileCallback_t callback);
+
+# 68 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 68 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback);
+
+# 69 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 69 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_funlink(afatfsFilePtr_t file, afatfsCallback_t callback);
+
+
+# 71 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 71 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_feof(afatfsFilePtr_t file);
+void afatfs_fputc(afatfsFilePtr_t file, uint8_t c);
+uint32_t afatfs_fwrite(afatfsFilePtr_t file, const uint8_t *buffer, uint32_t len);
+uint32_t afatfs_fread(afatfsFilePtr_t file, uint8_t *buffer, uint32_t len);
+afatfsOperationStatus_e afatfs_fseek(afatfsFilePtr_t file, int32_t offset, afatfsSeek_e whence);
+
+# 76 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 76 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_ftell(afatfsFilePtr_t file, uint32_t *position);
+
+
+# 78 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 78 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_mkdir(const char *filename, afatfsFileCallback_t complete);
+
+# 79 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 79 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_chdir(afatfsFilePtr_t dirHandle);
+
+void afatfs_findFirst(afatfsFilePtr_t directory, afatfsFinder_t *finder);
+afatfsOperationStatus_e afatfs_findNext(afatfsFilePtr_t directory, afatfsFinder_t *finder, fatDirectoryEntry_t **dirEntry);
+void afatfs_findLast(afatfsFilePtr_t directory);
+
+
+# 85 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 85 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_flush(void);
+void afatfs_init(void);
+
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_destroy(
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+                   _Bool 
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h"
+                        dirty);
+void afatfs_poll(void);
+
+uint32_t afatfs_getFreeBufferSpace(void);
+uint32_t afatfs_getContiguousFreeSpace(void);
+
+# 92 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 92 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_isFull(void);
+
+afatfsFilesystemState_e afatfs_getFilesystemState(void);
+afatfsError_e afatfs_getLastError(void);
+# 112 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/beeper.h" 1
+# 21 "./src/main/io/beeper.h"
+       
+# 32 "./src/main/io/beeper.h"
+typedef enum {
+
+    BEEPER_SILENCE = 0,
+
+    BEEPER_GYRO_CALIBRATED,
+    BEEPER_RX_LOST,
+    BEEPER_RX_LOST_LANDING,
+    BEEPER_DISARMING,
+    BEEPER_ARMING,
+    BEEPER_ARMING_GPS_FIX,
+    BEEPER_BAT_CRIT_LOW,
+    BEEPER_BAT_LOW,
+    BEEPER_GPS_STATUS,
+    BEEPER_RX_SET,
+    BEEPER_ACC_CALIBRATION,
+    BEEPER_ACC_CALIBRATION_FAIL,
+    BEEPER_READY_BEEP,
+    BEEPER_MULTI_BEEPS,
+    BEEPER_DISARM_REPEAT,
+    BEEPER_ARMED,
+    BEEPER_SYSTEM_INIT,
+    BEEPER_USB,
+    BEEPER_BLACKBOX_ERASE,
+    BEEPER_CRASH_FLIP_MODE,
+    BEEPER_CAM_CONNECTION_OPEN,
+    BEEPER_CAM_CONNECTION_CLOSE,
+    BEEPER_RC_SMOOTHING_INIT_FAIL,
+    BEEPER_ARMING_GPS_NO_FIX,
+    BEEPER_ALL,
+
+} beeperMode_e;
+# 96 "./src/main/io/beeper.h"
+void beeper(beeperMode_e mode);
+void beeperSilence(void);
+void beeperUpdate(timeUs_t currentTimeUs);
+void beeperConfirmationBeeps(uint8_t beepCount);
+void beeperWarningBeeps(uint8_t beepCount);
+uint32_t getArmingBeepTimeMicros(void);
+beeperMode_e beeperModeForTableIndex(int idx);
+uint32_t beeperModeMaskForTableIndex(int idx);
+const char *beeperNameForTableIndex(int idx);
+int beeperTableEntryCount(void);
+
+# 106 "./src/main/io/beeper.h" 3 4
+_Bool 
+# 106 "./src/main/io/beeper.h"
+    isBeeperOn(void);
+timeUs_t getLastDshotBeaconCommandTimeUs(void);
+# 113 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/flashfs.h" 1
+# 21 "./src/main/io/flashfs.h"
+       
+# 43 "./src/main/io/flashfs.h"
+void flashfsEraseCompletely(void);
+void flashfsEraseAsync(void);
+void flashfsPoll(void);
+void flashfsEraseRange(uint32_t start, uint32_t end);
+
+uint32_t flashfsGetSize(void);
+uint32_t flashfsGetOffset(void);
+uint32_t flashfsGetWriteBufferFreeSpace(void);
+uint32_t flashfsGetWriteBufferSize(void);
+int flashfsIdentifyStartOfFreeSpace(void);
+struct flashGeometry_s;
+const struct flashGeometry_s* flashfsGetGeometry(void);
+
+void flashfsSeekAbs(uint32_t offset);
+void flashfsSeekRel(int32_t offset);
+
+void flashfsWriteByte(uint8_t byte);
+void flashfsWrite(const uint8_t *data, unsigned int len, 
+# 60 "./src/main/io/flashfs.h" 3 4
+                                                        _Bool 
+# 60 "./src/main/io/flashfs.h"
+                                                             sync);
+
+int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
+
+
+# 64 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 64 "./src/main/io/flashfs.h"
+    flashfsFlushAsync(
+# 64 "./src/main/io/flashfs.h" 3 4
+                      _Bool 
+# 64 "./src/main/io/flashfs.h"
+                           force);
+void flashfsFlushSync(void);
+
+void flashfsClose(void);
+void flashfsInit(void);
+
+# 69 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 69 "./src/main/io/flashfs.h"
+    flashfsIsSupported(void);
+
+
+# 71 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 71 "./src/main/io/flashfs.h"
+    flashfsIsReady(void);
+
+# 72 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 72 "./src/main/io/flashfs.h"
+    flashfsIsEOF(void);
+
+
+# 74 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 74 "./src/main/io/flashfs.h"
+    flashfsVerifyEntireFlash(void);
+# 114 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/gimbal.h" 1
+# 21 "./src/main/io/gimbal.h"
+       
+
+
+
+typedef enum {
+    GIMBAL_MODE_NORMAL = 0,
+    GIMBAL_MODE_MIXTILT = 1
+} gimbalMode_e;
+
+
+
+typedef struct gimbalConfig_s {
+    uint8_t mode;
+} gimbalConfig_t;
+
+extern gimbalConfig_t gimbalConfig_System; extern gimbalConfig_t gimbalConfig_Copy; static inline const gimbalConfig_t* gimbalConfig(void) { return &gimbalConfig_System; } static inline gimbalConfig_t* gimbalConfigMutable(void) { return &gimbalConfig_System; } struct _dummy;
+# 115 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/gps.h" 1
+# 21 "./src/main/io/gps.h"
+       
+# 35 "./src/main/io/gps.h"
+typedef enum {
+    GPS_NMEA = 0,
+    GPS_UBLOX,
+    GPS_MSP
+} gpsProvider_e;
+
+typedef enum {
+    SBAS_AUTO = 0,
+    SBAS_EGNOS,
+    SBAS_WAAS,
+    SBAS_MSAS,
+    SBAS_GAGAN
+} sbasMode_e;
+
+
+
+typedef enum {
+    GPS_BAUDRATE_115200 = 0,
+    GPS_BAUDRATE_57600,
+    GPS_BAUDRATE_38400,
+    GPS_BAUDRATE_19200,
+    GPS_BAUDRATE_9600
+} gpsBaudRate_e;
+
+typedef enum {
+    GPS_AUTOCONFIG_OFF = 0,
+    GPS_AUTOCONFIG_ON
+} gpsAutoConfig_e;
+
+typedef enum {
+    GPS_AUTOBAUD_OFF = 0,
+    GPS_AUTOBAUD_ON
+} gpsAutoBaud_e;
+
+
+
+
+
+
+typedef struct gpsConfig_s {
+    gpsProvider_e provider;
+    sbasMode_e sbasMode;
+    gpsAutoConfig_e autoConfig;
+    gpsAutoBaud_e autoBaud;
+    uint8_t gps_ublox_use_galileo;
+    uint8_t gps_set_home_point_once;
+    uint8_t gps_ublox_nav_pvt;
+    uint8_t gps_ublox_rate_hz;
+} gpsConfig_t;
+
+extern gpsConfig_t gpsConfig_System; extern gpsConfig_t gpsConfig_Copy; static inline const gpsConfig_t* gpsConfig(void) { return &gpsConfig_System; } static inline gpsConfig_t* gpsConfigMutable(void) { return &gpsConfig_System; } struct _dummy;
+
+typedef struct gpsCoordinateDDDMMmmmm_s {
+    int16_t dddmm;
+    int16_t mmmm;
+} gpsCoordinateDDDMMmmmm_t;
+
+
+typedef struct gpsLocation_s {
+    int32_t lat;
+    int32_t lon;
+    int32_t altCm;
+} gpsLocation_t;
+
+typedef struct gpsSolutionData_s {
+    gpsLocation_t llh;
+    uint16_t groundSpeed;
+    uint16_t groundCourse;
+    uint16_t hdop;
+    uint8_t numSat;
+} gpsSolutionData_t;
+
+typedef enum {
+    GPS_MESSAGE_STATE_IDLE = 0,
+    GPS_MESSAGE_STATE_INIT,
+    GPS_MESSAGE_STATE_SBAS,
+    GPS_MESSAGE_STATE_GALILEO,
+    GPS_MESSAGE_STATE_NAV_PVT,
+    GPS_MESSAGE_STATE_ENTRY_COUNT
+} gpsMessageState_e;
+
+typedef struct gpsData_s {
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t lastMessage;
+    uint32_t lastLastMessage;
+
+    uint32_t state_position;
+    uint32_t state_ts;
+    uint8_t state;
+    uint8_t baudrateIndex;
+    gpsMessageState_e messageState;
+} gpsData_t;
+
+
+extern char gpsPacketLog[21];
+
+extern int32_t GPS_home[2];
+extern uint16_t GPS_distanceToHome;
+extern int16_t GPS_directionToHome;
+extern uint32_t GPS_distanceFlownInCm;
+extern int16_t GPS_verticalSpeedInCmS;
+extern int16_t GPS_angle[2];
+extern float dTnav;
+extern float GPS_scaleLonDown;
+extern int16_t nav_takeoff_bearing;
+
+typedef enum {
+    NAV_MODE_NONE = 0,
+    NAV_MODE_POSHOLD,
+    NAV_MODE_WP
+} navigationMode_e;
+extern navigationMode_e nav_mode;
+
+typedef enum {
+    GPS_DIRECT_TICK = 1 << 0,
+    GPS_MSP_UPDATE = 1 << 1
+} gpsUpdateToggle_e;
+
+extern gpsData_t gpsData;
+extern gpsSolutionData_t gpsSol;
+
+extern uint8_t GPS_update;
+extern uint32_t GPS_packetCount;
+extern uint32_t GPS_svInfoReceivedCount;
+extern uint8_t GPS_numCh;
+extern uint8_t GPS_svinfo_chn[16];
+extern uint8_t GPS_svinfo_svid[16];
+extern uint8_t GPS_svinfo_quality[16];
+extern uint8_t GPS_svinfo_cno[16];
+
+
+
+
+void gpsInit(void);
+void gpsUpdate(timeUs_t currentTimeUs);
+
+# 171 "./src/main/io/gps.h" 3 4
+_Bool 
+# 171 "./src/main/io/gps.h"
+    gpsNewFrame(uint8_t c);
+
+# 172 "./src/main/io/gps.h" 3 4
+_Bool 
+# 172 "./src/main/io/gps.h"
+    gpsIsHealthy(void);
+struct serialPort_s;
+void gpsEnablePassthrough(struct serialPort_s *gpsPassthroughPort);
+void onGpsNewData(void);
+void GPS_reset_home_position(void);
+void GPS_calc_longitude_scaling(int32_t lat);
+void GPS_distance_cm_bearing(int32_t *currentLat1, int32_t *currentLon1, int32_t *destinationLat2, int32_t *destinationLon2, uint32_t *dist, int32_t *bearing);
+# 116 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/ledstrip.h" 1
+# 21 "./src/main/io/ledstrip.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/light_ws2811strip.h" 1
+# 21 "./src/main/drivers/light_ws2811strip.h"
+       
+# 48 "./src/main/drivers/light_ws2811strip.h"
+typedef enum {
+    LED_GRB,
+    LED_RGB
+} ledStripFormatRGB_e;
+
+void ws2811LedStripInit(ioTag_t ioTag);
+void ws2811LedStripEnable(void);
+
+
+# 56 "./src/main/drivers/light_ws2811strip.h" 3 4
+_Bool 
+# 56 "./src/main/drivers/light_ws2811strip.h"
+    ws2811LedStripHardwareInit(ioTag_t ioTag);
+void ws2811LedStripDMAEnable(void);
+
+void ws2811UpdateStrip(ledStripFormatRGB_e ledFormat);
+
+void setLedHsv(uint16_t index, const hsvColor_t *color);
+void getLedHsv(uint16_t index, hsvColor_t *color);
+
+void scaleLedValue(uint16_t index, const uint8_t scalePercent);
+void setLedValue(uint16_t index, const uint8_t value);
+
+void setStripColor(const hsvColor_t *color);
+void setStripColors(const hsvColor_t *colors);
+
+
+# 70 "./src/main/drivers/light_ws2811strip.h" 3 4
+_Bool 
+# 70 "./src/main/drivers/light_ws2811strip.h"
+    isWS2811LedStripReady(void);
+
+
+
+
+
+typedef uint32_t ws2811Compare_t;
+
+
+extern ws2811Compare_t ledStripDMABuffer[(32 * 24 + 42)];
+extern volatile 
+# 80 "./src/main/drivers/light_ws2811strip.h" 3 4
+               _Bool 
+# 80 "./src/main/drivers/light_ws2811strip.h"
+                    ws2811LedDataTransferInProgress;
+
+extern uint16_t BIT_COMPARE_1;
+extern uint16_t BIT_COMPARE_0;
+# 28 "./src/main/io/ledstrip.h" 2
+# 80 "./src/main/io/ledstrip.h"
+typedef enum {
+    COLOR_BLACK = 0,
+    COLOR_WHITE,
+    COLOR_RED,
+    COLOR_ORANGE,
+    COLOR_YELLOW,
+    COLOR_LIME_GREEN,
+    COLOR_GREEN,
+    COLOR_MINT_GREEN,
+    COLOR_CYAN,
+    COLOR_LIGHT_BLUE,
+    COLOR_BLUE,
+    COLOR_DARK_VIOLET,
+    COLOR_MAGENTA,
+    COLOR_DEEP_PINK,
+    COLOR_COUNT
+} colorId_e;
+
+typedef enum {
+    LED_MODE_ORIENTATION = 0,
+    LED_MODE_HEADFREE,
+    LED_MODE_HORIZON,
+    LED_MODE_ANGLE,
+    LED_MODE_MAG,
+    LED_MODE_BARO,
+    LED_SPECIAL,
+    LED_AUX_CHANNEL
+} ledModeIndex_e;
+
+typedef enum {
+    LED_SCOLOR_DISARMED = 0,
+    LED_SCOLOR_ARMED,
+    LED_SCOLOR_ANIMATION,
+    LED_SCOLOR_BACKGROUND,
+    LED_SCOLOR_BLINKBACKGROUND,
+    LED_SCOLOR_GPSNOSATS,
+    LED_SCOLOR_GPSNOLOCK,
+    LED_SCOLOR_GPSLOCKED
+} ledSpecialColorIds_e;
+
+typedef enum {
+    LED_DIRECTION_NORTH = 0,
+    LED_DIRECTION_EAST,
+    LED_DIRECTION_SOUTH,
+    LED_DIRECTION_WEST,
+    LED_DIRECTION_UP,
+    LED_DIRECTION_DOWN
+} ledDirectionId_e;
+
+typedef enum {
+    LED_FUNCTION_COLOR,
+    LED_FUNCTION_FLIGHT_MODE,
+    LED_FUNCTION_ARM_STATE,
+    LED_FUNCTION_BATTERY,
+    LED_FUNCTION_RSSI,
+    LED_FUNCTION_GPS,
+    LED_FUNCTION_THRUST_RING
+} ledBaseFunctionId_e;
+
+typedef enum {
+    LED_OVERLAY_THROTTLE,
+    LED_OVERLAY_LARSON_SCANNER,
+    LED_OVERLAY_BLINK,
+    LED_OVERLAY_VTX,
+    LED_OVERLAY_INDICATOR,
+    LED_OVERLAY_WARNING
+} ledOverlayId_e;
+
+typedef enum {
+    LED_PROFILE_RACE = 0,
+    LED_PROFILE_BEACON,
+
+
+
+    LED_PROFILE_COUNT
+} ledProfile_e;
+
+typedef struct modeColorIndexes_s {
+    uint8_t color[6];
+} modeColorIndexes_t;
+
+typedef struct specialColorIndexes_s {
+    uint8_t color[11];
+} specialColorIndexes_t;
+
+typedef uint32_t ledConfig_t;
+
+typedef struct ledCounts_s {
+    uint8_t count;
+    uint8_t ring;
+    uint8_t larson;
+    uint8_t ringSeqLen;
+} ledCounts_t;
+
+typedef struct ledStripConfig_s {
+    uint8_t ledstrip_visual_beeper;
+    ioTag_t ioTag;
+    ledStripFormatRGB_e ledstrip_grb_rgb;
+    ledProfile_e ledstrip_profile;
+    colorId_e ledstrip_race_color;
+    colorId_e ledstrip_beacon_color;
+    uint16_t ledstrip_beacon_period_ms;
+    uint8_t ledstrip_beacon_percent;
+    uint8_t ledstrip_beacon_armed_only;
+    colorId_e ledstrip_visual_beeper_color;
+} ledStripConfig_t;
+
+extern ledStripConfig_t ledStripConfig_System; extern ledStripConfig_t ledStripConfig_Copy; static inline const ledStripConfig_t* ledStripConfig(void) { return &ledStripConfig_System; } static inline ledStripConfig_t* ledStripConfigMutable(void) { return &ledStripConfig_System; } struct _dummy;
+# 206 "./src/main/io/ledstrip.h"
+static inline uint8_t ledGetXY(const ledConfig_t *lcfg) { return ((*lcfg >> 0) & ((1 << (8)) - 1)); }
+static inline uint8_t ledGetX(const ledConfig_t *lcfg) { return ((*lcfg >> (0 + 4)) & 0x0F); }
+static inline uint8_t ledGetY(const ledConfig_t *lcfg) { return ((*lcfg >> (0 + 0)) & 0x0F); }
+static inline uint8_t ledGetFunction(const ledConfig_t *lcfg) { return ((*lcfg >> 8) & ((1 << (4)) - 1)); }
+static inline uint8_t ledGetOverlay(const ledConfig_t *lcfg) { return ((*lcfg >> 12) & ((1 << (6)) - 1)); }
+static inline uint8_t ledGetColor(const ledConfig_t *lcfg) { return ((*lcfg >> 18) & ((1 << (4)) - 1)); }
+static inline uint8_t ledGetDirection(const ledConfig_t *lcfg) { return ((*lcfg >> 22) & ((1 << (6)) - 1)); }
+static inline uint8_t ledGetParams(const ledConfig_t *lcfg) { return ((*lcfg >> 28) & ((1 << (4)) - 1)); }
+
+static inline 
+# 215 "./src/main/io/ledstrip.h" 3 4
+             _Bool 
+# 215 "./src/main/io/ledstrip.h"
+                  ledGetOverlayBit(const ledConfig_t *lcfg, int id) { return ((ledGetOverlay(lcfg) >> id) & 1); }
+static inline 
+# 216 "./src/main/io/ledstrip.h" 3 4
+             _Bool 
+# 216 "./src/main/io/ledstrip.h"
+                  ledGetDirectionBit(const ledConfig_t *lcfg, int id) { return ((ledGetDirection(lcfg) >> id) & 1); }
+
+
+# 218 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 218 "./src/main/io/ledstrip.h"
+    parseColor(int index, const char *colorConfig);
+
+
+# 220 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 220 "./src/main/io/ledstrip.h"
+    parseLedStripConfig(int ledIndex, const char *config);
+void generateLedConfig(ledConfig_t *ledConfig, char *ledConfigBuffer, size_t bufferSize);
+void reevaluateLedConfig(void);
+
+void ledStripInit(void);
+void ledStripEnable(void);
+void ledStripDisable(void);
+void ledStripUpdate(timeUs_t currentTimeUs);
+
+
+# 229 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 229 "./src/main/io/ledstrip.h"
+    setModeColor(ledModeIndex_e modeIndex, int modeColorIndex, int colorIndex);
+
+void applyDefaultLedStripConfig(ledConfig_t *ledConfig);
+void applyDefaultColors(hsvColor_t *colors);
+void applyDefaultModeColors(modeColorIndexes_t *modeColors);
+void applyDefaultSpecialColors(specialColorIndexes_t *specialColors);
+
+void updateRequiredOverlay(void);
+
+uint8_t getLedProfile(void);
+void setLedProfile(uint8_t profile);
+# 117 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/serial.h" 1
+# 21 "./src/main/io/serial.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    PORTSHARING_UNUSED = 0,
+    PORTSHARING_NOT_SHARED,
+    PORTSHARING_SHARED
+} portSharing_e;
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_GPS = (1 << 1),
+    FUNCTION_TELEMETRY_FRSKY_HUB = (1 << 2),
+    FUNCTION_TELEMETRY_HOTT = (1 << 3),
+    FUNCTION_TELEMETRY_LTM = (1 << 4),
+    FUNCTION_TELEMETRY_SMARTPORT = (1 << 5),
+    FUNCTION_RX_SERIAL = (1 << 6),
+    FUNCTION_BLACKBOX = (1 << 7),
+    FUNCTION_TELEMETRY_MAVLINK = (1 << 9),
+    FUNCTION_ESC_SENSOR = (1 << 10),
+    FUNCTION_VTX_SMARTAUDIO = (1 << 11),
+    FUNCTION_TELEMETRY_IBUS = (1 << 12),
+    FUNCTION_VTX_TRAMP = (1 << 13),
+    FUNCTION_RCDEVICE = (1 << 14),
+    FUNCTION_LIDAR_TF = (1 << 15),
+} serialPortFunction_e;
+
+
+
+
+typedef enum {
+    BAUD_AUTO = 0,
+    BAUD_9600,
+    BAUD_19200,
+    BAUD_38400,
+    BAUD_57600,
+    BAUD_115200,
+    BAUD_230400,
+    BAUD_250000,
+    BAUD_400000,
+    BAUD_460800,
+    BAUD_500000,
+    BAUD_921600,
+    BAUD_1000000,
+    BAUD_1500000,
+    BAUD_2000000,
+    BAUD_2470000
+} baudRate_e;
+
+extern const uint32_t baudRates[];
+
+
+typedef enum {
+    SERIAL_PORT_NONE = -1,
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_UART4,
+    SERIAL_PORT_UART5,
+    SERIAL_PORT_USART6,
+    SERIAL_PORT_USART7,
+    SERIAL_PORT_USART8,
+    SERIAL_PORT_USB_VCP = 20,
+    SERIAL_PORT_SOFTSERIAL1 = 30,
+    SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+extern const serialPortIdentifier_e serialPortIdentifiers[8];
+# 103 "./src/main/io/serial.h"
+typedef struct serialPortBuffers_s {
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint16_t rxBufferSize;
+    uint16_t txBufferSize;
+    uint16_t rxBufferWanted;
+    uint16_t txBufferWanted;
+} serialPortBuffers_t;
+
+typedef struct serialPortUsage_s {
+    serialPort_t *serialPort;
+    serialPortFunction_e function;
+    serialPortIdentifier_e identifier;
+
+
+
+} serialPortUsage_t;
+
+serialPort_t *findSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+
+
+
+typedef struct serialPortConfig_s {
+    uint16_t functionMask;
+    serialPortIdentifier_e identifier;
+    uint8_t msp_baudrateIndex;
+    uint8_t gps_baudrateIndex;
+    uint8_t blackbox_baudrateIndex;
+    uint8_t telemetry_baudrateIndex;
+} serialPortConfig_t;
+
+typedef struct serialConfig_s {
+    serialPortConfig_t portConfigs[8];
+    uint16_t serial_update_rate_hz;
+    uint8_t reboot_character;
+} serialConfig_t;
+
+extern serialConfig_t serialConfig_System; extern serialConfig_t serialConfig_Copy; static inline const serialConfig_t* serialConfig(void) { return &serialConfig_System; } static inline serialConfig_t* serialConfigMutable(void) { return &serialConfig_System; } struct _dummy;
+
+typedef void serialConsumer(uint8_t);
+
+
+
+
+void serialInit(
+# 148 "./src/main/io/serial.h" 3 4
+               _Bool 
+# 148 "./src/main/io/serial.h"
+                    softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+void serialRemovePort(serialPortIdentifier_e identifier);
+uint8_t serialGetAvailablePortCount(void);
+
+# 151 "./src/main/io/serial.h" 3 4
+_Bool 
+# 151 "./src/main/io/serial.h"
+    serialIsPortAvailable(serialPortIdentifier_e identifier);
+
+# 152 "./src/main/io/serial.h" 3 4
+_Bool 
+# 152 "./src/main/io/serial.h"
+    isSerialConfigValid(const serialConfig_t *serialConfig);
+serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e identifier);
+
+# 154 "./src/main/io/serial.h" 3 4
+_Bool 
+# 154 "./src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function);
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function);
+
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function);
+
+# 159 "./src/main/io/serial.h" 3 4
+_Bool 
+# 159 "./src/main/io/serial.h"
+    isSerialPortShared(const serialPortConfig_t *portConfig, uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+void pgResetFn_serialConfig(serialConfig_t *serialConfig);
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
+int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+
+
+
+
+
+
+serialPort_t *openSerialPort(
+    serialPortIdentifier_e identifier,
+    serialPortFunction_e function,
+    serialReceiveCallbackPtr rxCallback,
+    void *rxCallbackData,
+    uint32_t baudrate,
+    portMode_e mode,
+    portOptions_e options
+);
+void closeSerialPort(serialPort_t *serialPort);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+baudRate_e lookupBaudRateIndex(uint32_t baudRate);
+
+
+
+
+
+void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *leftC, serialConsumer *rightC);
+# 118 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/transponder_ir.h" 1
+# 21 "./src/main/io/transponder_ir.h"
+       
+
+
+
+
+typedef struct transponderConfig_s {
+    transponderProvider_e provider;
+    uint8_t reserved;
+    uint8_t data[9];
+    ioTag_t ioTag;
+} transponderConfig_t;
+
+typedef struct transponderRequirement_s {
+    uint8_t provider;
+    uint8_t dataLength;
+    uint16_t transmitDelay;
+    uint16_t transmitJitter;
+} transponderRequirement_t;
+
+extern transponderConfig_t transponderConfig_System; extern transponderConfig_t transponderConfig_Copy; static inline const transponderConfig_t* transponderConfig(void) { return &transponderConfig_System; } static inline transponderConfig_t* transponderConfigMutable(void) { return &transponderConfig_System; } struct _dummy;
+
+extern const transponderRequirement_t transponderRequirements[3];
+
+void transponderInit(void);
+
+void transponderUpdate(timeUs_t currentTimeUs);
+void transponderUpdateData(void);
+void transponderTransmitOnce(void);
+void transponderStartRepeating(void);
+void transponderStopRepeating(void);
+# 119 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/usb_msc.h" 1
+# 21 "./src/main/io/usb_msc.h"
+       
+
+
+# 23 "./src/main/io/usb_msc.h" 3 4
+_Bool 
+# 23 "./src/main/io/usb_msc.h"
+    mscCheckFilesystemReady(void);
+# 120 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/vtx_control.h" 1
+# 21 "./src/main/io/vtx_control.h"
+       
+# 33 "./src/main/io/vtx_control.h"
+typedef struct vtxChannelActivationCondition_s {
+    uint8_t auxChannelIndex;
+    uint8_t band;
+    uint8_t channel;
+    uint8_t power;
+    channelRange_t range;
+} vtxChannelActivationCondition_t;
+
+typedef struct vtxConfig_s {
+    vtxChannelActivationCondition_t vtxChannelActivationConditions[10];
+    uint8_t halfDuplex;
+} vtxConfig_t;
+
+extern vtxConfig_t vtxConfig_System; extern vtxConfig_t vtxConfig_Copy; static inline const vtxConfig_t* vtxConfig(void) { return &vtxConfig_System; } static inline vtxConfig_t* vtxConfigMutable(void) { return &vtxConfig_System; } struct _dummy;
+
+void vtxControlInit(void);
+void vtxControlInputPoll(void);
+
+void vtxIncrementBand(void);
+void vtxDecrementBand(void);
+void vtxIncrementChannel(void);
+void vtxDecrementChannel(void);
+
+void vtxCyclePower(const uint8_t powerStep);
+void vtxCycleBandOrChannel(const uint8_t bandStep, const uint8_t channelStep);
+
+void vtxUpdateActivatedChannel(void);
+
+void handleVTXControlButton(void);
+# 121 "./src/main/cli/cli.c" 2
+# 1 "./src/main/io/vtx.h" 1
+# 21 "./src/main/io/vtx.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+     VTX_LOW_POWER_DISARM_OFF = 0,
+     VTX_LOW_POWER_DISARM_ALWAYS,
+     VTX_LOW_POWER_DISARM_UNTIL_FIRST_ARM,
+} vtxLowerPowerDisarm_e;
+
+typedef struct vtxSettingsConfig_s {
+    uint8_t band;
+    uint8_t channel;
+    uint8_t power;
+    uint16_t freq;
+    uint16_t pitModeFreq;
+    uint8_t lowPowerDisarm;
+} vtxSettingsConfig_t;
+
+extern vtxSettingsConfig_t vtxSettingsConfig_System; extern vtxSettingsConfig_t vtxSettingsConfig_Copy; static inline const vtxSettingsConfig_t* vtxSettingsConfig(void) { return &vtxSettingsConfig_System; } static inline vtxSettingsConfig_t* vtxSettingsConfigMutable(void) { return &vtxSettingsConfig_System; } struct _dummy;
+
+void vtxInit(void);
+void vtxUpdate(timeUs_t currentTimeUs);
+# 122 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/msp/msp.h" 1
+# 21 "./src/main/msp/msp.h"
+       
+
+# 1 "./src/main/common/streambuf.h" 1
+# 21 "./src/main/common/streambuf.h"
+       
+
+
+
+
+
+typedef struct sbuf_s {
+    uint8_t *ptr;
+    uint8_t *end;
+} sbuf_t;
+
+sbuf_t *sbufInit(sbuf_t *sbuf, uint8_t *ptr, uint8_t *end);
+
+void sbufWriteU8(sbuf_t *dst, uint8_t val);
+void sbufWriteU16(sbuf_t *dst, uint16_t val);
+void sbufWriteU32(sbuf_t *dst, uint32_t val);
+void sbufWriteU16BigEndian(sbuf_t *dst, uint16_t val);
+void sbufWriteU32BigEndian(sbuf_t *dst, uint32_t val);
+void sbufFill(sbuf_t *dst, uint8_t data, int len);
+void sbufWriteData(sbuf_t *dst, const void *data, int len);
+void sbufWriteString(sbuf_t *dst, const char *string);
+void sbufWriteStringWithZeroTerminator(sbuf_t *dst, const char *string);
+
+uint8_t sbufReadU8(sbuf_t *src);
+uint16_t sbufReadU16(sbuf_t *src);
+uint32_t sbufReadU32(sbuf_t *src);
+void sbufReadData(sbuf_t *dst, void *data, int len);
+
+int sbufBytesRemaining(sbuf_t *buf);
+uint8_t* sbufPtr(sbuf_t *buf);
+const uint8_t* sbufConstPtr(const sbuf_t *buf);
+void sbufAdvance(sbuf_t *buf, int size);
+
+void sbufSwitchToReader(sbuf_t *buf, uint8_t * base);
+# 24 "./src/main/msp/msp.h" 2
+
+
+
+typedef enum {
+    MSP_V1 = 0,
+    MSP_V2_OVER_V1 = 1,
+    MSP_V2_NATIVE = 2,
+    MSP_VERSION_COUNT
+} mspVersion_e;
+
+
+
+
+typedef enum {
+    MSP_RESULT_ACK = 1,
+    MSP_RESULT_ERROR = -1,
+    MSP_RESULT_NO_REPLY = 0,
+    MSP_RESULT_CMD_UNKNOWN = -2,
+} mspResult_e;
+
+typedef enum {
+    MSP_DIRECTION_REPLY = 0,
+    MSP_DIRECTION_REQUEST = 1
+} mspDirection_e;
+
+typedef struct mspPacket_s {
+    sbuf_t buf;
+    int16_t cmd;
+    uint8_t flags;
+    int16_t result;
+    uint8_t direction;
+} mspPacket_t;
+
+struct serialPort_s;
+typedef void (*mspPostProcessFnPtr)(struct serialPort_s *port);
+typedef mspResult_e (*mspProcessCommandFnPtr)(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
+typedef void (*mspProcessReplyFnPtr)(mspPacket_t *cmd);
+
+
+void mspInit(void);
+mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
+void mspFcProcessReply(mspPacket_t *reply);
+# 124 "./src/main/cli/cli.c" 2
+# 1 "./src/main/msp/msp_box.h" 1
+# 21 "./src/main/msp/msp_box.h"
+       
+
+
+
+typedef struct box_s {
+    const uint8_t boxId;
+    const char *boxName;
+    const uint8_t permanentId;
+} box_t;
+
+
+
+const box_t *findBoxByBoxId(boxId_e boxId);
+const box_t *findBoxByPermanentId(uint8_t permanentId);
+
+struct boxBitmask_s;
+int packFlightModeFlags(struct boxBitmask_s *mspFlightModeFlags);
+struct sbuf_s;
+void serializeBoxNameFn(struct sbuf_s *dst, const box_t *box);
+void serializeBoxPermanentIdFn(struct sbuf_s *dst, const box_t *box);
+typedef void serializeBoxFn(struct sbuf_s *dst, const box_t *box);
+void serializeBoxReply(struct sbuf_s *dst, int page, serializeBoxFn *serializeBox);
+void initActiveBoxIds(void);
+
+# 44 "./src/main/msp/msp_box.h" 3 4
+_Bool 
+# 44 "./src/main/msp/msp_box.h"
+    getBoxIdState(boxId_e boxid);
+# 125 "./src/main/cli/cli.c" 2
+# 1 "./src/main/msp/msp_protocol.h" 1
+# 56 "./src/main/msp/msp_protocol.h"
+       
+# 126 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/osd/osd.h" 1
+# 21 "./src/main/osd/osd.h"
+       
+
+
+
+
+
+# 1 "./src/main/sensors/esc_sensor.h" 1
+# 21 "./src/main/sensors/esc_sensor.h"
+       
+
+
+
+typedef struct escSensorConfig_s {
+    uint8_t halfDuplex;
+    uint16_t offset;
+
+} escSensorConfig_t;
+
+extern escSensorConfig_t escSensorConfig_System; extern escSensorConfig_t escSensorConfig_Copy; static inline const escSensorConfig_t* escSensorConfig(void) { return &escSensorConfig_System; } static inline escSensorConfig_t* escSensorConfigMutable(void) { return &escSensorConfig_System; } struct _dummy;
+
+typedef struct {
+    uint8_t dataAge;
+    int8_t temperature;
+    int16_t voltage;
+    int32_t current;
+    int32_t consumption;
+    int16_t rpm;
+} escSensorData_t;
+
+
+
+
+
+
+# 46 "./src/main/sensors/esc_sensor.h" 3 4
+_Bool 
+# 46 "./src/main/sensors/esc_sensor.h"
+    escSensorInit(void);
+void escSensorProcess(timeUs_t currentTime);
+
+
+
+escSensorData_t *getEscSensorData(uint8_t motorNumber);
+
+void startEscDataRead(uint8_t *frameBuffer, uint8_t frameLength);
+uint8_t getNumberEscBytesRead(void);
+
+uint8_t calculateCrc8(const uint8_t *Buf, const uint8_t BufLen);
+
+int calcEscRpm(int erpm);
+# 28 "./src/main/osd/osd.h" 2
+
+
+extern const char * const osdTimerSourceNames[4];
+# 76 "./src/main/osd/osd.h"
+typedef enum {
+    OSD_RSSI_VALUE,
+    OSD_MAIN_BATT_VOLTAGE,
+    OSD_CROSSHAIRS,
+    OSD_ARTIFICIAL_HORIZON,
+    OSD_HORIZON_SIDEBARS,
+    OSD_ITEM_TIMER_1,
+    OSD_ITEM_TIMER_2,
+    OSD_FLYMODE,
+    OSD_CRAFT_NAME,
+    OSD_THROTTLE_POS,
+    OSD_VTX_CHANNEL,
+    OSD_CURRENT_DRAW,
+    OSD_MAH_DRAWN,
+    OSD_GPS_SPEED,
+    OSD_GPS_SATS,
+    OSD_ALTITUDE,
+    OSD_ROLL_PIDS,
+    OSD_PITCH_PIDS,
+    OSD_YAW_PIDS,
+    OSD_POWER,
+    OSD_PIDRATE_PROFILE,
+    OSD_WARNINGS,
+    OSD_AVG_CELL_VOLTAGE,
+    OSD_GPS_LON,
+    OSD_GPS_LAT,
+    OSD_DEBUG,
+    OSD_PITCH_ANGLE,
+    OSD_ROLL_ANGLE,
+    OSD_MAIN_BATT_USAGE,
+    OSD_DISARMED,
+    OSD_HOME_DIR,
+    OSD_HOME_DIST,
+    OSD_NUMERICAL_HEADING,
+    OSD_NUMERICAL_VARIO,
+    OSD_COMPASS_BAR,
+    OSD_ESC_TMP,
+    OSD_ESC_RPM,
+    OSD_REMAINING_TIME_ESTIMATE,
+    OSD_RTC_DATETIME,
+    OSD_ADJUSTMENT_RANGE,
+    OSD_CORE_TEMPERATURE,
+    OSD_ANTI_GRAVITY,
+    OSD_G_FORCE,
+    OSD_MOTOR_DIAG,
+    OSD_LOG_STATUS,
+    OSD_FLIP_ARROW,
+    OSD_LINK_QUALITY,
+    OSD_FLIGHT_DIST,
+    OSD_STICK_OVERLAY_LEFT,
+    OSD_STICK_OVERLAY_RIGHT,
+    OSD_DISPLAY_NAME,
+    OSD_ESC_RPM_FREQ,
+    OSD_RATE_PROFILE_NAME,
+    OSD_PID_PROFILE_NAME,
+    OSD_RSSI_DBM_VALUE,
+    OSD_ITEM_COUNT
+} osd_items_e;
+# 144 "./src/main/osd/osd.h"
+typedef enum {
+    OSD_STAT_RTC_DATE_TIME,
+    OSD_STAT_TIMER_1,
+    OSD_STAT_TIMER_2,
+    OSD_STAT_MAX_SPEED,
+    OSD_STAT_MAX_DISTANCE,
+    OSD_STAT_MIN_BATTERY,
+    OSD_STAT_END_BATTERY,
+    OSD_STAT_BATTERY,
+    OSD_STAT_MIN_RSSI,
+    OSD_STAT_MAX_CURRENT,
+    OSD_STAT_USED_MAH,
+    OSD_STAT_MAX_ALTITUDE,
+    OSD_STAT_BLACKBOX,
+    OSD_STAT_BLACKBOX_NUMBER,
+    OSD_STAT_MAX_G_FORCE,
+    OSD_STAT_MAX_ESC_TEMP,
+    OSD_STAT_MAX_ESC_RPM,
+    OSD_STAT_MIN_LINK_QUALITY,
+    OSD_STAT_FLIGHT_DISTANCE,
+    OSD_STAT_MAX_FFT,
+    OSD_STAT_TOTAL_FLIGHTS,
+    OSD_STAT_TOTAL_TIME,
+    OSD_STAT_TOTAL_DIST,
+    OSD_STAT_MIN_RSSI_DBM,
+    OSD_STAT_COUNT
+} osd_stats_e;
+
+
+_Static_assert((OSD_STAT_COUNT <= 32), "osdstats_overflow");
+
+typedef enum {
+    OSD_UNIT_IMPERIAL,
+    OSD_UNIT_METRIC
+} osd_unit_e;
+
+typedef enum {
+    OSD_TIMER_1,
+    OSD_TIMER_2,
+    OSD_TIMER_COUNT
+} osd_timer_e;
+
+typedef enum {
+    OSD_TIMER_SRC_ON,
+    OSD_TIMER_SRC_TOTAL_ARMED,
+    OSD_TIMER_SRC_LAST_ARMED,
+    OSD_TIMER_SRC_ON_OR_ARMED,
+    OSD_TIMER_SRC_COUNT
+} osd_timer_source_e;
+
+typedef enum {
+    OSD_TIMER_PREC_SECOND,
+    OSD_TIMER_PREC_HUNDREDTHS,
+    OSD_TIMER_PREC_TENTHS,
+    OSD_TIMER_PREC_COUNT
+} osd_timer_precision_e;
+
+typedef enum {
+    OSD_WARNING_ARMING_DISABLE,
+    OSD_WARNING_BATTERY_NOT_FULL,
+    OSD_WARNING_BATTERY_WARNING,
+    OSD_WARNING_BATTERY_CRITICAL,
+    OSD_WARNING_VISUAL_BEEPER,
+    OSD_WARNING_CRASH_FLIP,
+    OSD_WARNING_ESC_FAIL,
+    OSD_WARNING_CORE_TEMPERATURE,
+    OSD_WARNING_RC_SMOOTHING,
+    OSD_WARNING_FAIL_SAFE,
+    OSD_WARNING_LAUNCH_CONTROL,
+    OSD_WARNING_GPS_RESCUE_UNAVAILABLE,
+    OSD_WARNING_GPS_RESCUE_DISABLED,
+    OSD_WARNING_RSSI,
+    OSD_WARNING_LINK_QUALITY,
+    OSD_WARNING_RSSI_DBM,
+    OSD_WARNING_COUNT
+} osdWarningsFlags_e;
+
+
+_Static_assert((OSD_WARNING_COUNT <= 32), "osdwarnings_overflow");
+
+
+
+
+
+
+
+extern const uint16_t osdTimerDefault[OSD_TIMER_COUNT];
+
+typedef struct osdConfig_s {
+    uint16_t item_pos[OSD_ITEM_COUNT];
+
+
+    uint16_t cap_alarm;
+    uint16_t alt_alarm;
+    uint8_t rssi_alarm;
+
+    osd_unit_e units;
+
+    uint16_t timers[OSD_TIMER_COUNT];
+    uint32_t enabledWarnings;
+
+    uint8_t ahMaxPitch;
+    uint8_t ahMaxRoll;
+    uint32_t enabled_stats;
+    int8_t esc_temp_alarm;
+    int16_t esc_rpm_alarm;
+    int16_t esc_current_alarm;
+    uint8_t core_temp_alarm;
+    uint8_t ahInvert;
+    uint8_t osdProfileIndex;
+    uint8_t overlay_radio_mode;
+    uint16_t link_quality_alarm;
+    uint8_t rssi_dbm_alarm;
+} osdConfig_t;
+
+extern osdConfig_t osdConfig_System; extern osdConfig_t osdConfig_Copy; static inline const osdConfig_t* osdConfig(void) { return &osdConfig_System; } static inline osdConfig_t* osdConfigMutable(void) { return &osdConfig_System; } struct _dummy;
+
+typedef struct statistic_s {
+    timeUs_t armed_time;
+    int16_t max_speed;
+    int16_t min_voltage;
+    int16_t max_current;
+    uint8_t min_rssi;
+    int32_t max_altitude;
+    int16_t max_distance;
+    float max_g_force;
+    int16_t max_esc_temp;
+    int32_t max_esc_rpm;
+    uint16_t min_link_quality;
+    uint8_t min_rssi_dbm;
+} statistic_t;
+
+extern timeUs_t resumeRefreshAt;
+extern timeUs_t osdFlyTime;
+
+extern float osdGForce;
+
+
+
+
+
+
+struct displayPort_s;
+void osdInit(struct displayPort_s *osdDisplayPort);
+
+# 288 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 288 "./src/main/osd/osd.h"
+    osdInitialized(void);
+void osdUpdate(timeUs_t currentTimeUs);
+void osdStatSetState(uint8_t statIndex, 
+# 290 "./src/main/osd/osd.h" 3 4
+                                       _Bool 
+# 290 "./src/main/osd/osd.h"
+                                            enabled);
+
+# 291 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 291 "./src/main/osd/osd.h"
+    osdStatGetState(uint8_t statIndex);
+void osdWarnSetState(uint8_t warningIndex, 
+# 292 "./src/main/osd/osd.h" 3 4
+                                          _Bool 
+# 292 "./src/main/osd/osd.h"
+                                               enabled);
+
+# 293 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 293 "./src/main/osd/osd.h"
+    osdWarnGetState(uint8_t warningIndex);
+void osdSuppressStats(
+# 294 "./src/main/osd/osd.h" 3 4
+                     _Bool 
+# 294 "./src/main/osd/osd.h"
+                          flag);
+
+uint8_t getCurrentOsdProfileIndex(void);
+void changeOsdProfileIndex(uint8_t profileIndex);
+
+# 298 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 298 "./src/main/osd/osd.h"
+    osdElementVisible(uint16_t value);
+
+# 299 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 299 "./src/main/osd/osd.h"
+    osdGetVisualBeeperState(void);
+statistic_t *osdGetStats(void);
+# 128 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/pg/adc.h" 1
+# 21 "./src/main/pg/adc.h"
+       
+
+
+
+
+
+
+
+typedef struct adcChannelConfig_t {
+    
+# 30 "./src/main/pg/adc.h" 3 4
+   _Bool 
+# 30 "./src/main/pg/adc.h"
+        enabled;
+    ioTag_t ioTag;
+} adcChannelConfig_t;
+
+typedef struct adcConfig_s {
+    adcChannelConfig_t vbat;
+    adcChannelConfig_t rssi;
+    adcChannelConfig_t current;
+    adcChannelConfig_t external1;
+    int8_t device;
+
+    uint16_t vrefIntCalibration;
+    uint16_t tempSensorCalibration1;
+    uint16_t tempSensorCalibration2;
+
+    uint8_t dmaopt[3];
+} adcConfig_t;
+
+extern adcConfig_t adcConfig_System; extern adcConfig_t adcConfig_Copy; static inline const adcConfig_t* adcConfig(void) { return &adcConfig_System; } static inline adcConfig_t* adcConfigMutable(void) { return &adcConfig_System; } struct _dummy;
+# 130 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/beeper.h" 1
+# 21 "./src/main/pg/beeper.h"
+       
+
+
+
+
+typedef struct beeperConfig_s {
+    uint32_t beeper_off_flags;
+    uint8_t dshotBeaconTone;
+    uint32_t dshotBeaconOffFlags;
+} beeperConfig_t;
+
+extern beeperConfig_t beeperConfig_System; extern beeperConfig_t beeperConfig_Copy; static inline const beeperConfig_t* beeperConfig(void) { return &beeperConfig_System; } static inline beeperConfig_t* beeperConfigMutable(void) { return &beeperConfig_System; } struct _dummy;
+# 131 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/beeper_dev.h" 1
+# 21 "./src/main/pg/beeper_dev.h"
+       
+
+
+
+
+
+
+typedef struct beeperDevConfig_s {
+    ioTag_t ioTag;
+    uint8_t isInverted;
+    uint8_t isOpenDrain;
+    uint16_t frequency;
+} beeperDevConfig_t;
+
+extern beeperDevConfig_t beeperDevConfig_System; extern beeperDevConfig_t beeperDevConfig_Copy; static inline const beeperDevConfig_t* beeperDevConfig(void) { return &beeperDevConfig_System; } static inline beeperDevConfig_t* beeperDevConfigMutable(void) { return &beeperDevConfig_System; } struct _dummy;
+# 132 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/board.h" 1
+# 21 "./src/main/pg/board.h"
+       
+# 34 "./src/main/pg/board.h"
+typedef struct boardConfig_s {
+    uint8_t signature[32];
+    char manufacturerId[4 + 1];
+    char boardName[20 + 1];
+    uint8_t boardInformationSet;
+    uint8_t signatureSet;
+} boardConfig_t;
+
+extern boardConfig_t boardConfig_System; extern boardConfig_t boardConfig_Copy; static inline const boardConfig_t* boardConfig(void) { return &boardConfig_System; } static inline boardConfig_t* boardConfigMutable(void) { return &boardConfig_System; } struct _dummy;
+# 133 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/bus_i2c.h" 1
+# 21 "./src/main/pg/bus_i2c.h"
+       
+
+
+
+
+
+
+
+typedef struct i2cConfig_s {
+    ioTag_t ioTagScl;
+    ioTag_t ioTagSda;
+    
+# 32 "./src/main/pg/bus_i2c.h" 3 4
+   _Bool 
+# 32 "./src/main/pg/bus_i2c.h"
+        overClock;
+    
+# 33 "./src/main/pg/bus_i2c.h" 3 4
+   _Bool 
+# 33 "./src/main/pg/bus_i2c.h"
+        pullUp;
+} i2cConfig_t;
+
+extern i2cConfig_t i2cConfig_SystemArray[4]; extern i2cConfig_t i2cConfig_CopyArray[4]; static inline const i2cConfig_t* i2cConfig(int _index) { return &i2cConfig_SystemArray[_index]; } static inline i2cConfig_t* i2cConfigMutable(int _index) { return &i2cConfig_SystemArray[_index]; } static inline i2cConfig_t (* i2cConfig_array(void))[4] { return &i2cConfig_SystemArray; } struct _dummy;
+# 134 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/bus_spi.h" 1
+# 21 "./src/main/pg/bus_spi.h"
+       
+
+
+
+
+
+
+typedef struct spiPinConfig_s {
+    ioTag_t ioTagSck;
+    ioTag_t ioTagMiso;
+    ioTag_t ioTagMosi;
+    int8_t txDmaopt;
+    int8_t rxDmaopt;
+} spiPinConfig_t;
+
+extern spiPinConfig_t spiPinConfig_SystemArray[4]; extern spiPinConfig_t spiPinConfig_CopyArray[4]; static inline const spiPinConfig_t* spiPinConfig(int _index) { return &spiPinConfig_SystemArray[_index]; } static inline spiPinConfig_t* spiPinConfigMutable(int _index) { return &spiPinConfig_SystemArray[_index]; } static inline spiPinConfig_t (* spiPinConfig_array(void))[4] { return &spiPinConfig_SystemArray; } struct _dummy;
+# 135 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/gyrodev.h" 1
+# 21 "./src/main/pg/gyrodev.h"
+       
+
+
+
+
+
+
+
+typedef struct gyroDeviceConfig_s {
+    int8_t index;
+    uint8_t bustype;
+    uint8_t spiBus;
+    ioTag_t csnTag;
+    uint8_t i2cBus;
+    uint8_t i2cAddress;
+    ioTag_t extiTag;
+    uint8_t align;
+} gyroDeviceConfig_t;
+
+extern gyroDeviceConfig_t gyroDeviceConfig_SystemArray[2]; extern gyroDeviceConfig_t gyroDeviceConfig_CopyArray[2]; static inline const gyroDeviceConfig_t* gyroDeviceConfig(int _index) { return &gyroDeviceConfig_SystemArray[_index]; } static inline gyroDeviceConfig_t* gyroDeviceConfigMutable(int _index) { return &gyroDeviceConfig_SystemArray[_index]; } static inline gyroDeviceConfig_t (* gyroDeviceConfig_array(void))[2] { return &gyroDeviceConfig_SystemArray; } struct _dummy;
+# 136 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/max7456.h" 1
+# 21 "./src/main/pg/max7456.h"
+       
+
+
+
+
+typedef struct max7456Config_s {
+    uint8_t clockConfig;
+    ioTag_t csTag;
+    uint8_t spiDevice;
+    
+# 30 "./src/main/pg/max7456.h" 3 4
+   _Bool 
+# 30 "./src/main/pg/max7456.h"
+        preInitOPU;
+} max7456Config_t;
+
+
+
+
+
+
+extern max7456Config_t max7456Config_System; extern max7456Config_t max7456Config_Copy; static inline const max7456Config_t* max7456Config(void) { return &max7456Config_System; } static inline max7456Config_t* max7456ConfigMutable(void) { return &max7456Config_System; } struct _dummy;
+# 137 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/mco.h" 1
+# 21 "./src/main/pg/mco.h"
+       
+
+
+
+
+
+
+
+typedef struct mcoConfig_s {
+    uint8_t enabled[2];
+} mcoConfig_t;
+
+extern mcoConfig_t mcoConfig_System; extern mcoConfig_t mcoConfig_Copy; static inline const mcoConfig_t* mcoConfig(void) { return &mcoConfig_System; } static inline mcoConfig_t* mcoConfigMutable(void) { return &mcoConfig_System; } struct _dummy;
+# 138 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/pinio.h" 1
+# 21 "./src/main/pg/pinio.h"
+       
+
+
+
+# 1 "./src/main/drivers/pinio.h" 1
+# 21 "./src/main/drivers/pinio.h"
+       
+# 33 "./src/main/drivers/pinio.h"
+struct pinioConfig_s;
+
+void pinioInit(const struct pinioConfig_s *pinioConfig);
+void pinioSet(int index, 
+# 36 "./src/main/drivers/pinio.h" 3 4
+                        _Bool 
+# 36 "./src/main/drivers/pinio.h"
+                             on);
+# 26 "./src/main/pg/pinio.h" 2
+
+typedef struct pinioConfig_s {
+    ioTag_t ioTag[4];
+    uint8_t config[4];
+} pinioConfig_t;
+
+extern pinioConfig_t pinioConfig_System; extern pinioConfig_t pinioConfig_Copy; static inline const pinioConfig_t* pinioConfig(void) { return &pinioConfig_System; } static inline pinioConfig_t* pinioConfigMutable(void) { return &pinioConfig_System; } struct _dummy;
+# 139 "./src/main/cli/cli.c" 2
+
+
+# 1 "./src/main/pg/rx.h" 1
+# 21 "./src/main/pg/rx.h"
+       
+# 30 "./src/main/pg/rx.h"
+typedef struct rxConfig_s {
+    uint8_t rcmap[8];
+    uint8_t serialrx_provider;
+    uint8_t serialrx_inverted;
+    uint8_t halfDuplex;
+    ioTag_t spektrum_bind_pin_override_ioTag;
+    ioTag_t spektrum_bind_plug_ioTag;
+    uint8_t spektrum_sat_bind;
+    uint8_t spektrum_sat_bind_autoreset;
+    uint8_t rssi_channel;
+    uint8_t rssi_scale;
+    uint8_t rssi_invert;
+    uint16_t midrc;
+    uint16_t mincheck;
+    uint16_t maxcheck;
+    uint8_t rcInterpolation;
+    uint8_t rcInterpolationChannels;
+    uint8_t rcInterpolationInterval;
+    uint8_t fpvCamAngleDegrees;
+    uint8_t airModeActivateThreshold;
+
+    uint16_t rx_min_usec;
+    uint16_t rx_max_usec;
+    uint8_t max_aux_channel;
+    uint8_t rssi_src_frame_errors;
+    int8_t rssi_offset;
+    uint8_t rc_smoothing_type;
+    uint8_t rc_smoothing_input_cutoff;
+    uint8_t rc_smoothing_derivative_cutoff;
+    uint8_t rc_smoothing_debug_axis;
+    uint8_t rc_smoothing_input_type;
+    uint8_t rc_smoothing_derivative_type;
+    uint8_t rc_smoothing_auto_factor;
+    uint8_t rssi_src_frame_lpf_period;
+} rxConfig_t;
+
+extern rxConfig_t rxConfig_System; extern rxConfig_t rxConfig_Copy; static inline const rxConfig_t* rxConfig(void) { return &rxConfig_System; } static inline rxConfig_t* rxConfigMutable(void) { return &rxConfig_System; } struct _dummy;
+# 142 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/rx_spi_cc2500.h" 1
+# 21 "./src/main/pg/rx_spi_cc2500.h"
+       
+
+
+
+
+
+typedef enum {
+  FRSKY_SPI_A1_SOURCE_VBAT = 0,
+  FRSKY_SPI_A1_SOURCE_EXTADC,
+  FRSKY_SPI_A1_SOURCE_CONST
+} frSkySpiA1Source_e;
+
+typedef struct rxCc2500SpiConfig_s {
+    uint8_t autoBind;
+    uint8_t bindTxId[2];
+    int8_t bindOffset;
+    uint8_t bindHopData[50];
+    uint8_t rxNum;
+    uint8_t a1Source;
+    uint8_t chipDetectEnabled;
+    ioTag_t txEnIoTag;
+    ioTag_t lnaEnIoTag;
+    ioTag_t antSelIoTag;
+} rxCc2500SpiConfig_t;
+
+extern rxCc2500SpiConfig_t rxCc2500SpiConfig_System; extern rxCc2500SpiConfig_t rxCc2500SpiConfig_Copy; static inline const rxCc2500SpiConfig_t* rxCc2500SpiConfig(void) { return &rxCc2500SpiConfig_System; } static inline rxCc2500SpiConfig_t* rxCc2500SpiConfigMutable(void) { return &rxCc2500SpiConfig_System; } struct _dummy;
+# 143 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/rx_spi.h" 1
+# 21 "./src/main/pg/rx_spi.h"
+       
+
+
+
+
+
+typedef struct rxSpiConfig_s {
+
+    uint8_t rx_spi_protocol;
+
+    uint32_t rx_spi_id;
+    uint8_t rx_spi_rf_channel_count;
+
+
+    ioTag_t csnTag;
+    uint8_t spibus;
+
+    ioTag_t bindIoTag;
+    ioTag_t ledIoTag;
+    uint8_t ledInversion;
+
+    ioTag_t extiIoTag;
+} rxSpiConfig_t;
+
+extern rxSpiConfig_t rxSpiConfig_System; extern rxSpiConfig_t rxSpiConfig_Copy; static inline const rxSpiConfig_t* rxSpiConfig(void) { return &rxSpiConfig_System; } static inline rxSpiConfig_t* rxSpiConfigMutable(void) { return &rxSpiConfig_System; } struct _dummy;
+# 144 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/rx_pwm.h" 1
+# 21 "./src/main/pg/rx_pwm.h"
+       
+
+
+# 1 "./src/main/drivers/rx/rx_pwm.h" 1
+# 21 "./src/main/drivers/rx/rx_pwm.h"
+       
+
+typedef enum {
+    INPUT_FILTERING_DISABLED = 0,
+    INPUT_FILTERING_ENABLED
+} inputFilteringMode_e;
+
+
+
+
+struct ppmConfig_s;
+void ppmRxInit(const struct ppmConfig_s *ppmConfig);
+struct pwmConfig_s;
+void pwmRxInit(const struct pwmConfig_s *pwmConfig);
+
+uint16_t pwmRead(uint8_t channel);
+uint16_t ppmRead(uint8_t channel);
+
+
+# 39 "./src/main/drivers/rx/rx_pwm.h" 3 4
+_Bool 
+# 39 "./src/main/drivers/rx/rx_pwm.h"
+    isPPMDataBeingReceived(void);
+void resetPPMDataReceivedState(void);
+
+
+# 42 "./src/main/drivers/rx/rx_pwm.h" 3 4
+_Bool 
+# 42 "./src/main/drivers/rx/rx_pwm.h"
+    isPWMDataBeingReceived(void);
+# 25 "./src/main/pg/rx_pwm.h" 2
+
+
+
+typedef struct ppmConfig_s {
+    ioTag_t ioTag;
+} ppmConfig_t;
+
+extern ppmConfig_t ppmConfig_System; extern ppmConfig_t ppmConfig_Copy; static inline const ppmConfig_t* ppmConfig(void) { return &ppmConfig_System; } static inline ppmConfig_t* ppmConfigMutable(void) { return &ppmConfig_System; } struct _dummy;
+
+typedef struct pwmConfig_s {
+    ioTag_t ioTags[8];
+    inputFilteringMode_e inputFilteringMode;
+} pwmConfig_t;
+
+extern pwmConfig_t pwmConfig_System; extern pwmConfig_t pwmConfig_Copy; static inline const pwmConfig_t* pwmConfig(void) { return &pwmConfig_System; } static inline pwmConfig_t* pwmConfigMutable(void) { return &pwmConfig_System; } struct _dummy;
+# 145 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/serial_uart.h" 1
+# 21 "./src/main/pg/serial_uart.h"
+       
+# 31 "./src/main/pg/serial_uart.h"
+typedef struct serialUartConfig_s {
+    int8_t txDmaopt;
+    int8_t rxDmaopt;
+} serialUartConfig_t;
+
+extern serialUartConfig_t serialUartConfig_SystemArray[8]; extern serialUartConfig_t serialUartConfig_CopyArray[8]; static inline const serialUartConfig_t* serialUartConfig(int _index) { return &serialUartConfig_SystemArray[_index]; } static inline serialUartConfig_t* serialUartConfigMutable(int _index) { return &serialUartConfig_SystemArray[_index]; } static inline serialUartConfig_t (* serialUartConfig_array(void))[8] { return &serialUartConfig_SystemArray; } struct _dummy;
+# 146 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/sdio.h" 1
+# 21 "./src/main/pg/sdio.h"
+       
+
+
+
+typedef struct sdioConfig_s {
+    uint8_t clockBypass;
+    uint8_t useCache;
+    uint8_t use4BitWidth;
+    int8_t dmaopt;
+} sdioConfig_t;
+
+extern sdioConfig_t sdioConfig_System; extern sdioConfig_t sdioConfig_Copy; static inline const sdioConfig_t* sdioConfig(void) { return &sdioConfig_System; } static inline sdioConfig_t* sdioConfigMutable(void) { return &sdioConfig_System; } struct _dummy;
+# 147 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/pg/usb.h" 1
+# 21 "./src/main/pg/usb.h"
+       
+
+
+
+
+
+enum USB_DEV {
+    DEFAULT,
+    COMPOSITE
+};
+
+typedef struct usbDev_s {
+    uint8_t type;
+    ioTag_t mscButtonPin;
+    uint8_t mscButtonUsePullup;
+    ioTag_t detectPin;
+} usbDev_t;
+
+extern usbDev_t usbDevConfig_System; extern usbDev_t usbDevConfig_Copy; static inline const usbDev_t* usbDevConfig(void) { return &usbDevConfig_System; } static inline usbDev_t* usbDevConfigMutable(void) { return &usbDevConfig_System; } struct _dummy;
+# 149 "./src/main/cli/cli.c" 2
+# 1 "./src/main/pg/vtx_table.h" 1
+# 21 "./src/main/pg/vtx_table.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/vtx_table.h" 1
+# 36 "./src/main/drivers/vtx_table.h"
+struct vtxTableConfig_s;
+void vtxTableInit(void);
+void vtxTableStrncpyWithPad(char *dst, const char *src, int length);
+void vtxTableConfigClearBand(struct vtxTableConfig_s *config, int band);
+void vtxTableConfigClearPowerValues(struct vtxTableConfig_s *config, int start);
+void vtxTableConfigClearPowerLabels(struct vtxTableConfig_s *config, int start);
+void vtxTableConfigClearChannels(struct vtxTableConfig_s *config, int band, int channels);
+
+extern int vtxTableBandCount;
+extern int vtxTableChannelCount;
+extern uint16_t vtxTableFrequency[8][8];
+extern const char * vtxTableBandNames[8 + 1];
+extern char vtxTableBandLetters[8 + 1];
+extern const char * vtxTableChannelNames[8 + 1];
+extern int vtxTablePowerLevels;
+extern uint16_t vtxTablePowerValues[8];
+extern const char * vtxTablePowerLabels[8 + 1];
+# 28 "./src/main/pg/vtx_table.h" 2
+
+typedef struct vtxTableConfig_s {
+    uint8_t bands;
+    uint8_t channels;
+    uint16_t frequency[8][8];
+    char bandNames[8][8 + 1];
+    char bandLetters[8];
+    char channelNames[8][1 + 1];
+
+    uint8_t powerLevels;
+    uint16_t powerValues[8];
+    char powerLabels[8][3 + 1];
+} vtxTableConfig_t;
+
+struct vtxTableConfig_s;
+extern struct vtxTableConfig_s vtxTableConfig_System; extern struct vtxTableConfig_s vtxTableConfig_Copy; static inline const struct vtxTableConfig_s* vtxTableConfig(void) { return &vtxTableConfig_System; } static inline struct vtxTableConfig_s* vtxTableConfigMutable(void) { return &vtxTableConfig_System; } struct _dummy;
+# 150 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/rx/rx.h" 1
+# 21 "./src/main/rx/rx.h"
+       
+# 47 "./src/main/rx/rx.h"
+typedef enum {
+    RX_FRAME_PENDING = 0,
+    RX_FRAME_COMPLETE = (1 << 0),
+    RX_FRAME_FAILSAFE = (1 << 1),
+    RX_FRAME_PROCESSING_REQUIRED = (1 << 2),
+    RX_FRAME_DROPPED = (1 << 3)
+} rxFrameState_e;
+
+typedef enum {
+    SERIALRX_SPEKTRUM1024 = 0,
+    SERIALRX_SPEKTRUM2048 = 1,
+    SERIALRX_SBUS = 2,
+    SERIALRX_SUMD = 3,
+    SERIALRX_SUMH = 4,
+    SERIALRX_XBUS_MODE_B = 5,
+    SERIALRX_XBUS_MODE_B_RJ01 = 6,
+    SERIALRX_IBUS = 7,
+    SERIALRX_JETIEXBUS = 8,
+    SERIALRX_CRSF = 9,
+    SERIALRX_SRXL = 10,
+    SERIALRX_TARGET_CUSTOM = 11,
+    SERIALRX_FPORT = 12,
+    SERIALRX_DJI_HDL_7MS = 13,
+} SerialRXType;
+# 85 "./src/main/rx/rx.h"
+extern const char rcChannelLetters[];
+
+extern int16_t rcData[18];
+
+
+
+
+
+
+typedef enum {
+    RX_FAILSAFE_MODE_AUTO = 0,
+    RX_FAILSAFE_MODE_HOLD,
+    RX_FAILSAFE_MODE_SET,
+    RX_FAILSAFE_MODE_INVALID
+} rxFailsafeChannelMode_e;
+
+
+
+typedef enum {
+    RX_FAILSAFE_TYPE_FLIGHT = 0,
+    RX_FAILSAFE_TYPE_AUX
+} rxFailsafeChannelType_e;
+
+
+
+typedef struct rxFailsafeChannelConfig_s {
+    uint8_t mode;
+    uint8_t step;
+} rxFailsafeChannelConfig_t;
+
+extern rxFailsafeChannelConfig_t rxFailsafeChannelConfigs_SystemArray[18]; extern rxFailsafeChannelConfig_t rxFailsafeChannelConfigs_CopyArray[18]; static inline const rxFailsafeChannelConfig_t* rxFailsafeChannelConfigs(int _index) { return &rxFailsafeChannelConfigs_SystemArray[_index]; } static inline rxFailsafeChannelConfig_t* rxFailsafeChannelConfigsMutable(int _index) { return &rxFailsafeChannelConfigs_SystemArray[_index]; } static inline rxFailsafeChannelConfig_t (* rxFailsafeChannelConfigs_array(void))[18] { return &rxFailsafeChannelConfigs_SystemArray; } struct _dummy;
+
+typedef struct rxChannelRangeConfig_s {
+    uint16_t min;
+    uint16_t max;
+} rxChannelRangeConfig_t;
+
+extern rxChannelRangeConfig_t rxChannelRangeConfigs_SystemArray[4]; extern rxChannelRangeConfig_t rxChannelRangeConfigs_CopyArray[4]; static inline const rxChannelRangeConfig_t* rxChannelRangeConfigs(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t* rxChannelRangeConfigsMutable(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t (* rxChannelRangeConfigs_array(void))[4] { return &rxChannelRangeConfigs_SystemArray; } struct _dummy;
+
+struct rxRuntimeConfig_s;
+typedef uint16_t (*rcReadRawDataFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig, uint8_t chan);
+typedef uint8_t (*rcFrameStatusFnPtr)(struct rxRuntimeConfig_s *rxRuntimeConfig);
+typedef 
+# 127 "./src/main/rx/rx.h" 3 4
+       _Bool 
+# 127 "./src/main/rx/rx.h"
+            (*rcProcessFrameFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig);
+
+typedef struct rxRuntimeConfig_s {
+    uint8_t channelCount;
+    uint16_t rxRefreshRate;
+    rcReadRawDataFnPtr rcReadRawFn;
+    rcFrameStatusFnPtr rcFrameStatusFn;
+    rcProcessFrameFnPtr rcProcessFrameFn;
+    uint16_t *channelData;
+    void *frameData;
+} rxRuntimeConfig_t;
+
+typedef enum {
+    RSSI_SOURCE_NONE = 0,
+    RSSI_SOURCE_ADC,
+    RSSI_SOURCE_RX_CHANNEL,
+    RSSI_SOURCE_RX_PROTOCOL,
+    RSSI_SOURCE_MSP,
+    RSSI_SOURCE_FRAME_ERRORS,
+    RSSI_SOURCE_RX_PROTOCOL_CRSF,
+} rssiSource_e;
+
+extern rssiSource_e rssiSource;
+
+typedef enum {
+    LQ_SOURCE_NONE = 0,
+    LQ_SOURCE_RX_PROTOCOL_CRSF,
+} linkQualitySource_e;
+
+extern linkQualitySource_e linkQualitySource;
+
+extern rxRuntimeConfig_t rxRuntimeConfig;
+
+void rxInit(void);
+
+# 161 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 161 "./src/main/rx/rx.h"
+    rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
+
+# 162 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 162 "./src/main/rx/rx.h"
+    rxIsReceivingSignal(void);
+
+# 163 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 163 "./src/main/rx/rx.h"
+    rxAreFlightChannelsValid(void);
+
+# 164 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 164 "./src/main/rx/rx.h"
+    calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+
+struct rxConfig_s;
+
+void parseRcChannels(const char *input, struct rxConfig_s *rxConfig);
+
+
+
+void setRssiDirect(uint16_t newRssi, rssiSource_e source);
+void setRssi(uint16_t rssiValue, rssiSource_e source);
+void setRssiMsp(uint8_t newMspRssi);
+void updateRSSI(timeUs_t currentTimeUs);
+uint16_t getRssi(void);
+uint8_t getRssiPercent(void);
+
+# 178 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 178 "./src/main/rx/rx.h"
+    isRssiConfigured(void);
+
+
+
+uint16_t rxGetLinkQuality(void);
+void setLinkQualityDirect(uint16_t linkqualityValue);
+uint16_t rxGetLinkQualityPercent(void);
+
+uint8_t getRssiDbm(void);
+void setRssiDbm(uint8_t newRssiDbm, rssiSource_e source);
+void setRssiDbmDirect(uint8_t newRssiDbm, rssiSource_e source);
+
+void resetAllRxChannelRangeConfigurations(rxChannelRangeConfig_t *rxChannelRangeConfig);
+
+void suspendRxPwmPpmSignal(void);
+void resumeRxPwmPpmSignal(void);
+
+uint16_t rxGetRefreshRate(void);
+# 152 "./src/main/cli/cli.c" 2
+# 1 "./src/main/rx/spektrum.h" 1
+# 21 "./src/main/rx/spektrum.h"
+       
+# 45 "./src/main/rx/spektrum.h"
+extern uint32_t spekChannelData[12];
+
+extern 
+# 47 "./src/main/rx/spektrum.h" 3 4
+      _Bool 
+# 47 "./src/main/rx/spektrum.h"
+           srxlEnabled;
+extern int32_t resolution;
+extern uint8_t rssi_channel;
+
+void spektrumBind(rxConfig_t *rxConfig);
+
+# 52 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 52 "./src/main/rx/spektrum.h"
+    spektrumInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+
+
+# 54 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 54 "./src/main/rx/spektrum.h"
+    srxlTelemetryBufferEmpty();
+void srxlRxWriteTelemetryData(const void *data, int len);
+
+# 56 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 56 "./src/main/rx/spektrum.h"
+    srxlRxIsActive(void);
+# 153 "./src/main/cli/cli.c" 2
+# 1 "./src/main/rx/rx_spi_common.h" 1
+# 21 "./src/main/rx/rx_spi_common.h"
+       
+
+# 1 "./src/main/rx/rx_spi.h" 1
+# 21 "./src/main/rx/rx_spi.h"
+       
+
+
+
+
+
+
+typedef enum {
+    RX_SPI_NRF24_V202_250K = 0,
+    RX_SPI_NRF24_V202_1M,
+    RX_SPI_NRF24_SYMA_X,
+    RX_SPI_NRF24_SYMA_X5C,
+    RX_SPI_NRF24_CX10,
+    RX_SPI_NRF24_CX10A,
+    RX_SPI_NRF24_H8_3D,
+    RX_SPI_NRF24_INAV,
+    RX_SPI_FRSKY_D,
+    RX_SPI_FRSKY_X,
+    RX_SPI_A7105_FLYSKY,
+    RX_SPI_A7105_FLYSKY_2A,
+    RX_SPI_NRF24_KN,
+    RX_SPI_SFHSS,
+    RX_SPI_CYRF6936_DSM,
+    RX_SPI_FRSKY_X_LBT,
+    RX_SPI_PROTOCOL_COUNT
+} rx_spi_protocol_e;
+
+typedef enum {
+    RX_SPI_RECEIVED_NONE = 0,
+    RX_SPI_RECEIVED_BIND,
+    RX_SPI_RECEIVED_DATA
+} rx_spi_received_e;
+
+
+typedef enum {
+    RC_SPI_ROLL = 0,
+    RC_SPI_PITCH,
+    RC_SPI_THROTTLE,
+    RC_SPI_YAW,
+    RC_SPI_AUX1,
+    RC_SPI_AUX2,
+    RC_SPI_AUX3,
+    RC_SPI_AUX4,
+    RC_SPI_AUX5,
+    RC_SPI_AUX6,
+    RC_SPI_AUX7,
+    RC_SPI_AUX8,
+    RC_SPI_AUX9,
+    RC_SPI_AUX10,
+    RC_SPI_AUX11,
+    RC_SPI_AUX12,
+    RC_SPI_AUX13,
+    RC_SPI_AUX14
+} rc_spi_aetr_e;
+# 84 "./src/main/rx/rx_spi.h"
+
+# 84 "./src/main/rx/rx_spi.h" 3 4
+_Bool 
+# 84 "./src/main/rx/rx_spi.h"
+    rxSpiInit(const rxSpiConfig_t *rxSpiConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+# 24 "./src/main/rx/rx_spi_common.h" 2
+
+
+
+
+
+void rxSpiCommonIOInit(const rxSpiConfig_t *rxSpiConfig);
+
+void rxSpiLedOn(void);
+void rxSpiLedOff(void);
+void rxSpiLedToggle(void);
+void rxSpiLedBlink(timeMs_t blinkMs);
+void rxSpiLedBlinkRxLoss(rx_spi_received_e result);
+void rxSpiLedBlinkBind(void);
+
+void rxSpiBind(void);
+
+# 39 "./src/main/rx/rx_spi_common.h" 3 4
+_Bool 
+# 39 "./src/main/rx/rx_spi_common.h"
+    rxSpiCheckBindRequested(
+# 39 "./src/main/rx/rx_spi_common.h" 3 4
+                            _Bool 
+# 39 "./src/main/rx/rx_spi_common.h"
+                                 reset);
+# 154 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/scheduler/scheduler.h" 1
+# 21 "./src/main/scheduler/scheduler.h"
+       
+# 31 "./src/main/scheduler/scheduler.h"
+typedef enum {
+    TASK_PRIORITY_IDLE = 0,
+    TASK_PRIORITY_LOW = 1,
+    TASK_PRIORITY_MEDIUM = 3,
+    TASK_PRIORITY_MEDIUM_HIGH = 4,
+    TASK_PRIORITY_HIGH = 5,
+    TASK_PRIORITY_REALTIME = 6,
+    TASK_PRIORITY_MAX = 255
+} cfTaskPriority_e;
+
+typedef struct {
+    timeUs_t maxExecutionTime;
+    timeUs_t totalExecutionTime;
+    timeUs_t averageExecutionTime;
+    timeUs_t averageDeltaTime;
+} cfCheckFuncInfo_t;
+
+typedef struct {
+    const char * taskName;
+    const char * subTaskName;
+    
+# 51 "./src/main/scheduler/scheduler.h" 3 4
+   _Bool 
+# 51 "./src/main/scheduler/scheduler.h"
+                isEnabled;
+    uint8_t staticPriority;
+    timeDelta_t desiredPeriod;
+    timeDelta_t latestDeltaTime;
+    timeUs_t maxExecutionTime;
+    timeUs_t totalExecutionTime;
+    timeUs_t averageExecutionTime;
+    timeUs_t averageDeltaTime;
+    float movingAverageCycleTime;
+} cfTaskInfo_t;
+
+typedef enum {
+
+    TASK_SYSTEM = 0,
+    TASK_MAIN,
+    TASK_GYROPID,
+    TASK_ACCEL,
+    TASK_ATTITUDE,
+    TASK_RX,
+    TASK_SERIAL,
+    TASK_DISPATCH,
+    TASK_BATTERY_VOLTAGE,
+    TASK_BATTERY_CURRENT,
+    TASK_BATTERY_ALERTS,
+
+
+
+
+    TASK_GPS,
+
+
+    TASK_COMPASS,
+
+
+    TASK_BARO,
+
+
+
+
+
+    TASK_ALTITUDE,
+
+
+
+
+
+    TASK_TELEMETRY,
+# 128 "./src/main/scheduler/scheduler.h"
+    TASK_RCDEVICE,
+
+
+
+
+
+
+
+    TASK_PINIOBOX,
+
+
+
+    TASK_COUNT,
+
+
+    TASK_NONE = TASK_COUNT,
+    TASK_SELF
+} cfTaskId_e;
+
+typedef struct {
+
+
+    const char * taskName;
+    const char * subTaskName;
+
+    
+# 153 "./src/main/scheduler/scheduler.h" 3 4
+   _Bool 
+# 153 "./src/main/scheduler/scheduler.h"
+        (*checkFunc)(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
+    void (*taskFunc)(timeUs_t currentTimeUs);
+    timeDelta_t desiredPeriod;
+    const uint8_t staticPriority;
+
+
+    uint16_t dynamicPriority;
+    uint16_t taskAgeCycles;
+    timeDelta_t taskLatestDeltaTime;
+    timeUs_t lastExecutedAt;
+    timeUs_t lastSignaledAt;
+    timeUs_t lastDesiredAt;
+
+
+
+    float movingAverageCycleTime;
+    timeUs_t movingSumExecutionTime;
+    timeUs_t movingSumDeltaTime;
+    timeUs_t maxExecutionTime;
+    timeUs_t totalExecutionTime;
+
+} cfTask_t;
+
+extern cfTask_t cfTasks[TASK_COUNT];
+extern uint16_t averageSystemLoadPercent;
+
+void getCheckFuncInfo(cfCheckFuncInfo_t *checkFuncInfo);
+void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t *taskInfo);
+void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros);
+void setTaskEnabled(cfTaskId_e taskId, 
+# 182 "./src/main/scheduler/scheduler.h" 3 4
+                                      _Bool 
+# 182 "./src/main/scheduler/scheduler.h"
+                                           newEnabledState);
+timeDelta_t getTaskDeltaTime(cfTaskId_e taskId);
+void schedulerSetCalulateTaskStatistics(
+# 184 "./src/main/scheduler/scheduler.h" 3 4
+                                       _Bool 
+# 184 "./src/main/scheduler/scheduler.h"
+                                            calculateTaskStatistics);
+void schedulerResetTaskStatistics(cfTaskId_e taskId);
+void schedulerResetTaskMaxExecutionTime(cfTaskId_e taskId);
+
+void schedulerInit(void);
+void scheduler(void);
+void taskSystemLoad(timeUs_t currentTime);
+void schedulerOptimizeRate(
+# 191 "./src/main/scheduler/scheduler.h" 3 4
+                          _Bool 
+# 191 "./src/main/scheduler/scheduler.h"
+                               optimizeRate);
+# 156 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/sensors/acceleration.h" 1
+# 21 "./src/main/sensors/acceleration.h"
+       
+
+
+
+
+# 1 "./src/main/sensors/sensors.h" 1
+# 21 "./src/main/sensors/sensors.h"
+       
+
+typedef enum {
+    SENSOR_INDEX_GYRO = 0,
+    SENSOR_INDEX_ACC,
+    SENSOR_INDEX_BARO,
+    SENSOR_INDEX_MAG,
+    SENSOR_INDEX_RANGEFINDER,
+    SENSOR_INDEX_COUNT
+} sensorIndex_e;
+
+extern uint8_t requestedSensors[SENSOR_INDEX_COUNT];
+extern uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+
+typedef struct int16_flightDynamicsTrims_s {
+    int16_t roll;
+    int16_t pitch;
+    int16_t yaw;
+} flightDynamicsTrims_def_t;
+
+typedef union flightDynamicsTrims_u {
+    int16_t raw[3];
+    flightDynamicsTrims_def_t values;
+} flightDynamicsTrims_t;
+
+
+
+
+typedef enum {
+    SENSOR_GYRO = 1 << 0,
+    SENSOR_ACC = 1 << 1,
+    SENSOR_BARO = 1 << 2,
+    SENSOR_MAG = 1 << 3,
+    SENSOR_SONAR = 1 << 4,
+    SENSOR_RANGEFINDER = 1 << 4,
+    SENSOR_GPS = 1 << 5,
+    SENSOR_GPSMAG = 1 << 6
+} sensors_e;
+# 27 "./src/main/sensors/acceleration.h" 2
+
+
+typedef enum {
+    ACC_DEFAULT,
+    ACC_NONE,
+    ACC_ADXL345,
+    ACC_MPU6050,
+    ACC_MMA8452,
+    ACC_BMA280,
+    ACC_LSM303DLHC,
+    ACC_MPU6000,
+    ACC_MPU6500,
+    ACC_MPU9250,
+    ACC_ICM20601,
+    ACC_ICM20602,
+    ACC_ICM20608G,
+    ACC_ICM20649,
+    ACC_ICM20689,
+    ACC_BMI160,
+    ACC_FAKE
+} accelerationSensor_e;
+
+typedef struct acc_s {
+    accDev_t dev;
+    uint32_t accSamplingInterval;
+    float accADC[3];
+    
+# 53 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 53 "./src/main/sensors/acceleration.h"
+        isAccelUpdatedAtLeastOnce;
+} acc_t;
+
+extern acc_t acc;
+
+typedef struct rollAndPitchTrims_s {
+    int16_t roll;
+    int16_t pitch;
+} rollAndPitchTrims_t_def;
+
+typedef union rollAndPitchTrims_u {
+    int16_t raw[2];
+    rollAndPitchTrims_t_def values;
+} rollAndPitchTrims_t;
+
+
+typedef struct accelerometerConfig_s {
+    uint16_t acc_lpf_hz;
+    uint8_t acc_hardware;
+    
+# 72 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 72 "./src/main/sensors/acceleration.h"
+        acc_high_fsr;
+    flightDynamicsTrims_t accZero;
+    rollAndPitchTrims_t accelerometerTrims;
+} accelerometerConfig_t;
+
+extern accelerometerConfig_t accelerometerConfig_System; extern accelerometerConfig_t accelerometerConfig_Copy; static inline const accelerometerConfig_t* accelerometerConfig(void) { return &accelerometerConfig_System; } static inline accelerometerConfig_t* accelerometerConfigMutable(void) { return &accelerometerConfig_System; } struct _dummy;
+
+
+
+# 80 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 80 "./src/main/sensors/acceleration.h"
+    accInit(uint32_t gyroTargetLooptime);
+
+# 81 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 81 "./src/main/sensors/acceleration.h"
+    accIsCalibrationComplete(void);
+void accSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void resetRollAndPitchTrims(rollAndPitchTrims_t *rollAndPitchTrims);
+void accUpdate(timeUs_t currentTimeUs, rollAndPitchTrims_t *rollAndPitchTrims);
+
+# 85 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 85 "./src/main/sensors/acceleration.h"
+    accGetAccumulationAverage(float *accumulation);
+union flightDynamicsTrims_u;
+void setAccelerationTrims(union flightDynamicsTrims_u *accelerationTrimsToUse);
+void accInitFilters(void);
+void applyAccelerometerTrimsDelta(union rollAndPitchTrims_u *rollAndPitchTrimsDelta);
+# 158 "./src/main/cli/cli.c" 2
+# 1 "./src/main/sensors/adcinternal.h" 1
+# 21 "./src/main/sensors/adcinternal.h"
+       
+
+
+
+void adcInternalInit(void);
+void adcInternalProcess(timeUs_t currentTimeUs);
+int16_t getCoreTemperatureCelsius(void);
+uint16_t getVrefMv(void);
+# 159 "./src/main/cli/cli.c" 2
+# 1 "./src/main/sensors/barometer.h" 1
+# 21 "./src/main/sensors/barometer.h"
+       
+
+
+# 1 "./src/main/drivers/barometer/barometer.h" 1
+# 21 "./src/main/drivers/barometer/barometer.h"
+       
+
+
+
+struct baroDev_s;
+
+typedef void (*baroOpFuncPtr)(struct baroDev_s *baro);
+typedef void (*baroCalculateFuncPtr)(int32_t *pressure, int32_t *temperature);
+
+typedef struct baroDev_s {
+    busDevice_t busdev;
+    uint16_t ut_delay;
+    uint16_t up_delay;
+    baroOpFuncPtr start_ut;
+    baroOpFuncPtr get_ut;
+    baroOpFuncPtr start_up;
+    baroOpFuncPtr get_up;
+    baroCalculateFuncPtr calculate;
+} baroDev_t;
+# 25 "./src/main/sensors/barometer.h" 2
+
+typedef enum {
+    BARO_DEFAULT = 0,
+    BARO_NONE = 1,
+    BARO_BMP085 = 2,
+    BARO_MS5611 = 3,
+    BARO_BMP280 = 4,
+    BARO_LPS = 5,
+    BARO_QMP6988 = 6
+} baroSensor_e;
+
+
+
+typedef struct barometerConfig_s {
+    uint8_t baro_bustype;
+    uint8_t baro_spi_device;
+    ioTag_t baro_spi_csn;
+    uint8_t baro_i2c_device;
+    uint8_t baro_i2c_address;
+    uint8_t baro_hardware;
+    uint8_t baro_sample_count;
+    uint16_t baro_noise_lpf;
+    uint16_t baro_cf_vel;
+} barometerConfig_t;
+
+extern barometerConfig_t barometerConfig_System; extern barometerConfig_t barometerConfig_Copy; static inline const barometerConfig_t* barometerConfig(void) { return &barometerConfig_System; } static inline barometerConfig_t* barometerConfigMutable(void) { return &barometerConfig_System; } struct _dummy;
+
+typedef struct baro_s {
+    baroDev_t dev;
+    int32_t BaroAlt;
+    int32_t baroTemperature;
+    int32_t baroPressure;
+} baro_t;
+
+extern baro_t baro;
+
+void baroPreInit(void);
+
+# 62 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 62 "./src/main/sensors/barometer.h"
+    baroDetect(baroDev_t *dev, baroSensor_e baroHardwareToUse);
+
+# 63 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 63 "./src/main/sensors/barometer.h"
+    isBaroCalibrationComplete(void);
+void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+uint32_t baroUpdate(void);
+
+# 66 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 66 "./src/main/sensors/barometer.h"
+    isBaroReady(void);
+int32_t baroCalculateAltitude(void);
+void performBaroCalibrationCycle(void);
+# 160 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/sensors/boardalignment.h" 1
+# 21 "./src/main/sensors/boardalignment.h"
+       
+
+
+
+typedef struct boardAlignment_s {
+    int32_t rollDegrees;
+    int32_t pitchDegrees;
+    int32_t yawDegrees;
+} boardAlignment_t;
+
+extern boardAlignment_t boardAlignment_System; extern boardAlignment_t boardAlignment_Copy; static inline const boardAlignment_t* boardAlignment(void) { return &boardAlignment_System; } static inline boardAlignment_t* boardAlignmentMutable(void) { return &boardAlignment_System; } struct _dummy;
+
+void alignSensors(float *dest, uint8_t rotation);
+void initBoardAlignment(const boardAlignment_t *boardAlignment);
+# 162 "./src/main/cli/cli.c" 2
+# 1 "./src/main/sensors/compass.h" 1
+# 21 "./src/main/sensors/compass.h"
+       
+# 31 "./src/main/sensors/compass.h"
+typedef enum {
+    MAG_DEFAULT = 0,
+    MAG_NONE = 1,
+    MAG_HMC5883 = 2,
+    MAG_AK8975 = 3,
+    MAG_AK8963 = 4,
+    MAG_QMC5883 = 5,
+    MAG_LIS3MDL = 6
+} magSensor_e;
+
+typedef struct mag_s {
+    float magADC[3];
+    float magneticDeclination;
+} mag_t;
+
+extern mag_t mag;
+
+typedef struct compassConfig_s {
+    int16_t mag_declination;
+
+    sensor_align_e mag_align;
+    uint8_t mag_hardware;
+    uint8_t mag_bustype;
+    uint8_t mag_i2c_device;
+    uint8_t mag_i2c_address;
+    uint8_t mag_spi_device;
+    ioTag_t mag_spi_csn;
+    ioTag_t interruptTag;
+    flightDynamicsTrims_t magZero;
+} compassConfig_t;
+
+extern compassConfig_t compassConfig_System; extern compassConfig_t compassConfig_Copy; static inline const compassConfig_t* compassConfig(void) { return &compassConfig_System; } static inline compassConfig_t* compassConfigMutable(void) { return &compassConfig_System; } struct _dummy;
+
+
+# 64 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 64 "./src/main/sensors/compass.h"
+    compassIsHealthy(void);
+void compassUpdate(timeUs_t currentTime);
+
+# 66 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 66 "./src/main/sensors/compass.h"
+    compassInit(void);
+void compassPreInit(void);
+# 163 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/sensors/gyro.h" 1
+# 21 "./src/main/sensors/gyro.h"
+       
+# 32 "./src/main/sensors/gyro.h"
+typedef struct gyro_s {
+    uint32_t targetLooptime;
+    float gyroADCf[3];
+} gyro_t;
+
+extern gyro_t gyro;
+
+enum {
+    GYRO_OVERFLOW_CHECK_NONE = 0,
+    GYRO_OVERFLOW_CHECK_YAW,
+    GYRO_OVERFLOW_CHECK_ALL_AXES
+};
+
+enum {
+    DYN_NOTCH_RANGE_HIGH = 0,
+    DYN_NOTCH_RANGE_MEDIUM,
+    DYN_NOTCH_RANGE_LOW,
+    DYN_NOTCH_RANGE_AUTO
+};
+
+
+
+
+
+enum {
+    DYN_LPF_NONE = 0,
+    DYN_LPF_PT1,
+    DYN_LPF_BIQUAD
+};
+
+
+
+
+
+enum {
+    FILTER_LOWPASS = 0,
+    FILTER_LOWPASS2
+};
+
+typedef enum gyroDetectionFlags_e {
+    NO_GYROS_DETECTED = 0,
+    DETECTED_GYRO_1 = (1 << 0),
+
+    DETECTED_GYRO_2 = (1 << 1),
+    DETECTED_BOTH_GYROS = (DETECTED_GYRO_1 | DETECTED_GYRO_2),
+    DETECTED_DUAL_GYROS = (1 << 7),
+
+} gyroDetectionFlags_t;
+
+typedef struct gyroConfig_s {
+    uint8_t gyroMovementCalibrationThreshold;
+    uint8_t gyro_sync_denom;
+    uint8_t gyro_hardware_lpf;
+
+    uint8_t gyro_high_fsr;
+    uint8_t gyro_to_use;
+
+    uint16_t gyro_lowpass_hz;
+    uint16_t gyro_lowpass2_hz;
+
+    uint16_t gyro_soft_notch_hz_1;
+    uint16_t gyro_soft_notch_cutoff_1;
+    uint16_t gyro_soft_notch_hz_2;
+    uint16_t gyro_soft_notch_cutoff_2;
+    int16_t gyro_offset_yaw;
+    uint8_t checkOverflow;
+
+
+    uint8_t gyro_lowpass_type;
+    uint8_t gyro_lowpass2_type;
+
+    uint8_t yaw_spin_recovery;
+    int16_t yaw_spin_threshold;
+
+    uint16_t gyroCalibrationDuration;
+
+    uint16_t dyn_lpf_gyro_min_hz;
+    uint16_t dyn_lpf_gyro_max_hz;
+    uint8_t dyn_notch_range;
+    uint8_t dyn_notch_width_percent;
+    uint16_t dyn_notch_q;
+    uint16_t dyn_notch_min_hz;
+    uint8_t gyro_filter_debug_axis;
+} gyroConfig_t;
+
+extern gyroConfig_t gyroConfig_System; extern gyroConfig_t gyroConfig_Copy; static inline const gyroConfig_t* gyroConfig(void) { return &gyroConfig_System; } static inline gyroConfig_t* gyroConfigMutable(void) { return &gyroConfig_System; } struct _dummy;
+
+void gyroPreInit(void);
+
+# 120 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 120 "./src/main/sensors/gyro.h"
+    gyroInit(void);
+
+void gyroInitFilters(void);
+void gyroUpdate(timeUs_t currentTimeUs);
+
+# 124 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 124 "./src/main/sensors/gyro.h"
+    gyroGetAccumulationAverage(float *accumulation);
+const busDevice_t *gyroSensorBus(void);
+struct mpuDetectionResult_s;
+const struct mpuDetectionResult_s *gyroMpuDetectionResult(void);
+void gyroStartCalibration(
+# 128 "./src/main/sensors/gyro.h" 3 4
+                         _Bool 
+# 128 "./src/main/sensors/gyro.h"
+                              isFirstArmingCalibration);
+
+# 129 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 129 "./src/main/sensors/gyro.h"
+    isFirstArmingGyroCalibrationRunning(void);
+
+# 130 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 130 "./src/main/sensors/gyro.h"
+    isGyroCalibrationComplete(void);
+void gyroReadTemperature(void);
+int16_t gyroGetTemperature(void);
+int16_t gyroRateDps(int axis);
+
+# 134 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 134 "./src/main/sensors/gyro.h"
+    gyroOverflowDetected(void);
+
+# 135 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 135 "./src/main/sensors/gyro.h"
+    gyroYawSpinDetected(void);
+uint16_t gyroAbsRateDps(int axis);
+uint8_t gyroReadRegister(uint8_t whichSensor, uint8_t reg);
+gyroDetectionFlags_t getGyroDetectionFlags(void);
+
+float dynThrottle(float throttle);
+void dynLpfGyroUpdate(float throttle);
+# 165 "./src/main/cli/cli.c" 2
+
+
+# 1 "./src/main/telemetry/frsky_hub.h" 1
+# 21 "./src/main/telemetry/frsky_hub.h"
+       
+
+
+
+typedef enum {
+    FRSKY_VFAS_PRECISION_LOW = 0,
+    FRSKY_VFAS_PRECISION_HIGH
+} frskyVFasPrecision_e;
+
+typedef void frSkyHubWriteByteFn(const char data);
+
+void handleFrSkyHubTelemetry(timeUs_t currentTimeUs);
+void checkFrSkyHubTelemetryState(void);
+
+
+# 35 "./src/main/telemetry/frsky_hub.h" 3 4
+_Bool 
+# 35 "./src/main/telemetry/frsky_hub.h"
+    initFrSkyHubTelemetry(void);
+
+# 36 "./src/main/telemetry/frsky_hub.h" 3 4
+_Bool 
+# 36 "./src/main/telemetry/frsky_hub.h"
+    initFrSkyHubTelemetryExternal(frSkyHubWriteByteFn *frSkyWriteFrameExternal);
+
+void processFrSkyHubTelemetry(timeUs_t currentTimeUs);
+# 168 "./src/main/cli/cli.c" 2
+# 1 "./src/main/telemetry/telemetry.h" 1
+# 28 "./src/main/telemetry/telemetry.h"
+       
+
+
+
+# 1 "./src/main/telemetry/ibus_shared.h" 1
+# 29 "./src/main/telemetry/ibus_shared.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    IBUS_SENSOR_TYPE_NONE = 0x00,
+    IBUS_SENSOR_TYPE_TEMPERATURE = 0x01,
+    IBUS_SENSOR_TYPE_RPM_FLYSKY = 0x02,
+    IBUS_SENSOR_TYPE_EXTERNAL_VOLTAGE = 0x03,
+    IBUS_SENSOR_TYPE_CELL = 0x04,
+    IBUS_SENSOR_TYPE_BAT_CURR = 0x05,
+    IBUS_SENSOR_TYPE_FUEL = 0x06,
+    IBUS_SENSOR_TYPE_RPM = 0x07,
+    IBUS_SENSOR_TYPE_CMP_HEAD = 0x08,
+    IBUS_SENSOR_TYPE_CLIMB_RATE = 0x09,
+    IBUS_SENSOR_TYPE_COG = 0x0a,
+    IBUS_SENSOR_TYPE_GPS_STATUS = 0x0b,
+    IBUS_SENSOR_TYPE_ACC_X = 0x0c,
+    IBUS_SENSOR_TYPE_ACC_Y = 0x0d,
+    IBUS_SENSOR_TYPE_ACC_Z = 0x0e,
+    IBUS_SENSOR_TYPE_ROLL = 0x0f,
+    IBUS_SENSOR_TYPE_PITCH = 0x10,
+    IBUS_SENSOR_TYPE_YAW = 0x11,
+    IBUS_SENSOR_TYPE_VERTICAL_SPEED = 0x12,
+    IBUS_SENSOR_TYPE_GROUND_SPEED = 0x13,
+    IBUS_SENSOR_TYPE_GPS_DIST = 0x14,
+    IBUS_SENSOR_TYPE_ARMED = 0x15,
+    IBUS_SENSOR_TYPE_FLIGHT_MODE = 0x16,
+    IBUS_SENSOR_TYPE_PRES = 0x41,
+    IBUS_SENSOR_TYPE_ODO1 = 0x7c,
+    IBUS_SENSOR_TYPE_ODO2 = 0x7d,
+    IBUS_SENSOR_TYPE_SPE = 0x7e,
+
+    IBUS_SENSOR_TYPE_GPS_LAT = 0x80,
+    IBUS_SENSOR_TYPE_GPS_LON = 0x81,
+    IBUS_SENSOR_TYPE_GPS_ALT = 0x82,
+    IBUS_SENSOR_TYPE_ALT = 0x83,
+    IBUS_SENSOR_TYPE_ALT_MAX = 0x84,
+
+    IBUS_SENSOR_TYPE_ALT_FLYSKY = 0xf9,
+
+
+
+
+
+    IBUS_SENSOR_TYPE_UNKNOWN = 0xff
+} ibusSensorType_e;
+# 89 "./src/main/telemetry/ibus_shared.h"
+
+# 89 "./src/main/telemetry/ibus_shared.h" 3 4
+_Bool 
+# 89 "./src/main/telemetry/ibus_shared.h"
+    isChecksumOkIa6b(const uint8_t *ibusPacket, const uint8_t length);
+# 33 "./src/main/telemetry/telemetry.h" 2
+
+typedef enum {
+    FRSKY_FORMAT_DMS = 0,
+    FRSKY_FORMAT_NMEA
+} frskyGpsCoordFormat_e;
+
+typedef enum {
+    FRSKY_UNIT_METRICS = 0,
+    FRSKY_UNIT_IMPERIALS
+} frskyUnit_e;
+
+typedef enum {
+    SENSOR_VOLTAGE = 1 << 0,
+    SENSOR_CURRENT = 1 << 1,
+    SENSOR_FUEL = 1 << 2,
+    SENSOR_MODE = 1 << 3,
+    SENSOR_ACC_X = 1 << 4,
+    SENSOR_ACC_Y = 1 << 5,
+    SENSOR_ACC_Z = 1 << 6,
+    SENSOR_PITCH = 1 << 7,
+    SENSOR_ROLL = 1 << 8,
+    SENSOR_HEADING = 1 << 9,
+    SENSOR_ALTITUDE = 1 << 10,
+    SENSOR_VARIO = 1 << 11,
+    SENSOR_LAT_LONG = 1 << 12,
+    SENSOR_GROUND_SPEED = 1 << 13,
+    SENSOR_DISTANCE = 1 << 14,
+    ESC_SENSOR_CURRENT = 1 << 15,
+    ESC_SENSOR_VOLTAGE = 1 << 16,
+    ESC_SENSOR_RPM = 1 << 17,
+    ESC_SENSOR_TEMPERATURE = 1 << 18,
+    ESC_SENSOR_ALL = ESC_SENSOR_CURRENT
+                            | ESC_SENSOR_VOLTAGE
+                            | ESC_SENSOR_RPM
+                            | ESC_SENSOR_TEMPERATURE,
+    SENSOR_TEMPERATURE = 1 << 19,
+    SENSOR_ALL = (1 << 20) - 1,
+} sensor_e;
+
+typedef struct telemetryConfig_s {
+    int16_t gpsNoFixLatitude;
+    int16_t gpsNoFixLongitude;
+    uint8_t telemetry_inverted;
+    uint8_t halfDuplex;
+    frskyGpsCoordFormat_e frsky_coordinate_format;
+    frskyUnit_e frsky_unit;
+    uint8_t frsky_vfas_precision;
+    uint8_t hottAlarmSoundInterval;
+    uint8_t pidValuesAsTelemetry;
+    uint8_t report_cell_voltage;
+    uint8_t flysky_sensors[15];
+    uint16_t mavlink_mah_as_heading_divisor;
+    uint32_t disabledSensors;
+} telemetryConfig_t;
+
+extern telemetryConfig_t telemetryConfig_System; extern telemetryConfig_t telemetryConfig_Copy; static inline const telemetryConfig_t* telemetryConfig(void) { return &telemetryConfig_System; } static inline telemetryConfig_t* telemetryConfigMutable(void) { return &telemetryConfig_System; } struct _dummy;
+
+extern serialPort_t *telemetrySharedPort;
+
+void telemetryInit(void);
+
+# 93 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 93 "./src/main/telemetry/telemetry.h"
+    telemetryCheckRxPortShared(const serialPortConfig_t *portConfig);
+
+void telemetryCheckState(void);
+void telemetryProcess(uint32_t currentTime);
+
+
+# 98 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 98 "./src/main/telemetry/telemetry.h"
+    telemetryDetermineEnabledState(portSharing_e portSharing);
+
+
+# 100 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 100 "./src/main/telemetry/telemetry.h"
+    telemetryIsSensorEnabled(sensor_e sensor);
+# 169 "./src/main/cli/cli.c" 2
+
+# 1 "./src/main/cli/cli.h" 1
+# 21 "./src/main/cli/cli.h"
+       
+
+extern uint8_t cliMode;
+
+struct clivalue_s;
+void *cliGetValuePointer(const struct clivalue_s *value);
+const void *cliGetDefaultPointer(const struct clivalue_s *value);
+
+struct serialConfig_s;
+void cliInit(const struct serialConfig_s *serialConfig);
+void cliProcess(void);
+struct serialPort_s;
+void cliEnter(struct serialPort_s *serialPort);
+# 171 "./src/main/cli/cli.c" 2
+
+static serialPort_t *cliPort;
+# 182 "./src/main/cli/cli.c"
+static bufWriter_t *cliWriter;
+static uint8_t cliWriteBuffer[sizeof(*cliWriter) + 64];
+
+static char cliBuffer[256];
+static uint32_t bufferIndex = 0;
+
+static 
+# 188 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 188 "./src/main/cli/cli.c"
+           configIsInCopy = 
+# 188 "./src/main/cli/cli.c" 3 4
+                            0
+# 188 "./src/main/cli/cli.c"
+                                 ;
+
+
+static int8_t pidProfileIndexToUse = -1;
+static int8_t rateProfileIndexToUse = -1;
+
+static 
+# 194 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 194 "./src/main/cli/cli.c"
+           featureMaskIsCopied = 
+# 194 "./src/main/cli/cli.c" 3 4
+                                 0
+# 194 "./src/main/cli/cli.c"
+                                      ;
+static uint32_t featureMaskCopy;
+
+
+static 
+# 198 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 198 "./src/main/cli/cli.c"
+           commandBatchActive = 
+# 198 "./src/main/cli/cli.c" 3 4
+                                0
+# 198 "./src/main/cli/cli.c"
+                                     ;
+static 
+# 199 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 199 "./src/main/cli/cli.c"
+           commandBatchError = 
+# 199 "./src/main/cli/cli.c" 3 4
+                               0
+# 199 "./src/main/cli/cli.c"
+                                    ;
+
+
+
+static 
+# 203 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 203 "./src/main/cli/cli.c"
+           boardInformationUpdated = 
+# 203 "./src/main/cli/cli.c" 3 4
+                                     0
+# 203 "./src/main/cli/cli.c"
+                                          ;
+
+static 
+# 205 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 205 "./src/main/cli/cli.c"
+           signatureUpdated = 
+# 205 "./src/main/cli/cli.c" 3 4
+                              0
+# 205 "./src/main/cli/cli.c"
+                                   ;
+
+
+
+static const char* const emptyName = "-";
+static const char* const emptyString = "";
+
+
+
+static const char * const mixerNames[] = {
+    "TRI", "QUADP", "QUADX", "BI",
+    "GIMBAL", "Y6", "HEX6",
+    "FLYING_WING", "Y4", "HEX6X", "OCTOX8", "OCTOFLATP", "OCTOFLATX",
+    "AIRPLANE", "HELI_120_CCPM", "HELI_90_DEG", "VTAIL4",
+    "HEX6H", "PPM_TO_SERVO", "DUALCOPTER", "SINGLECOPTER",
+    "ATAIL4", "CUSTOM", "CUSTOMAIRPLANE", "CUSTOMTRI", "QUADX1234", 
+# 220 "./src/main/cli/cli.c" 3 4
+                                                                   ((void *)0)
+
+# 221 "./src/main/cli/cli.c"
+};
+
+
+
+static const char * const featureNames[] = {
+    "RX_PPM", "", "INFLIGHT_ACC_CAL", "RX_SERIAL", "MOTOR_STOP",
+    "SERVO_TILT", "SOFTSERIAL", "GPS", "",
+    "RANGEFINDER", "TELEMETRY", "", "3D", "RX_PARALLEL_PWM",
+    "RX_MSP", "RSSI_ADC", "LED_STRIP", "DISPLAY", "OSD",
+    "", "CHANNEL_FORWARDING", "TRANSPONDER", "AIRMODE",
+    "", "", "RX_SPI", "SOFTSPI", "ESC_SENSOR", "ANTI_GRAVITY", "DYNAMIC_FILTER", 
+# 231 "./src/main/cli/cli.c" 3 4
+                                                                                ((void *)0)
+
+# 232 "./src/main/cli/cli.c"
+};
+
+
+static const char rxFailsafeModeCharacters[] = "ahs";
+
+static const rxFailsafeChannelMode_e rxFailsafeModesTable[2][3] = {
+    { RX_FAILSAFE_MODE_AUTO, RX_FAILSAFE_MODE_HOLD, RX_FAILSAFE_MODE_SET },
+    { RX_FAILSAFE_MODE_INVALID, RX_FAILSAFE_MODE_HOLD, RX_FAILSAFE_MODE_SET }
+};
+
+
+
+static const char * const sensorTypeNames[] = {
+    "GYRO", "ACC", "BARO", "MAG", "RANGEFINDER", "GPS", "GPS+MAG", 
+# 245 "./src/main/cli/cli.c" 3 4
+                                                                  ((void *)0)
+
+# 246 "./src/main/cli/cli.c"
+};
+
+
+
+static const char * const *sensorHardwareNames[] = {
+    lookupTableGyroHardware, lookupTableAccHardware, lookupTableBaroHardware, lookupTableMagHardware, lookupTableRangefinderHardware
+};
+# 261 "./src/main/cli/cli.c"
+typedef enum dumpFlags_e {
+    DUMP_MASTER = (1 << 0),
+    DUMP_PROFILE = (1 << 1),
+    DUMP_RATES = (1 << 2),
+    DUMP_ALL = (1 << 3),
+    DO_DIFF = (1 << 4),
+    SHOW_DEFAULTS = (1 << 5),
+    HIDE_UNUSED = (1 << 6),
+    HARDWARE_ONLY = (1 << 7),
+    BARE = (1 << 8),
+} dumpFlags_t;
+
+typedef 
+# 273 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 273 "./src/main/cli/cli.c"
+            printFn(dumpFlags_t dumpMask, 
+# 273 "./src/main/cli/cli.c" 3 4
+                                          _Bool 
+# 273 "./src/main/cli/cli.c"
+                                               equalsDefault, const char *format, ...);
+
+
+static void backupPgConfig(const pgRegistry_t *pg)
+{
+    memcpy(pg->copy, pg->address, pg->size);
+}
+
+static void restorePgConfig(const pgRegistry_t *pg)
+{
+    memcpy(pg->address, pg->copy, pg->size);
+}
+
+static void backupConfigs(void)
+{
+
+    for (const pgRegistry_t *(pg) = __pg_registry_start; (pg) < __pg_registry_end; pg++) {
+        backupPgConfig(pg);
+    }
+
+    configIsInCopy = 
+# 293 "./src/main/cli/cli.c" 3 4
+                    1
+# 293 "./src/main/cli/cli.c"
+                        ;
+}
+
+static void restoreConfigs(void)
+{
+    for (const pgRegistry_t *(pg) = __pg_registry_start; (pg) < __pg_registry_end; pg++) {
+        restorePgConfig(pg);
+    }
+
+    configIsInCopy = 
+# 302 "./src/main/cli/cli.c" 3 4
+                    0
+# 302 "./src/main/cli/cli.c"
+                         ;
+}
+
+static void backupAndResetConfigs(void)
+{
+    backupConfigs();
+
+    resetConfigs();
+}
+
+static void cliPrint(const char *str)
+{
+    while (*str) {
+        bufWriterAppend(cliWriter, *str++);
+    }
+    bufWriterFlush(cliWriter);
+}
+
+static void cliPrintLinefeed(void)
+{
+    cliPrint("\r\n");
+}
+
+static void cliPrintLine(const char *str)
+{
+    cliPrint(str);
+    cliPrintLinefeed();
+}
+
+
+
+
+static void cliPrintHashLine(const char *str)
+{
+    cliPrint("\r\n# ");
+    cliPrintLine(str);
+}
+
+
+static void cliPutp(void *p, char ch)
+{
+    bufWriterAppend(p, ch);
+}
+
+static void cliPrintfva(const char *format, va_list va)
+{
+    tfp_format(cliWriter, cliPutp, format, va);
+    bufWriterFlush(cliWriter);
+}
+
+static 
+# 352 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 352 "./src/main/cli/cli.c"
+           cliDumpPrintLinef(dumpFlags_t dumpMask, 
+# 352 "./src/main/cli/cli.c" 3 4
+                                                   _Bool 
+# 352 "./src/main/cli/cli.c"
+                                                        equalsDefault, const char *format, ...)
+{
+    if (!((dumpMask & DO_DIFF) && equalsDefault)) {
+        va_list va;
+        
+# 356 "./src/main/cli/cli.c" 3 4
+       __builtin_va_start(
+# 356 "./src/main/cli/cli.c"
+       va
+# 356 "./src/main/cli/cli.c" 3 4
+       ,
+# 356 "./src/main/cli/cli.c"
+       format
+# 356 "./src/main/cli/cli.c" 3 4
+       )
+# 356 "./src/main/cli/cli.c"
+                           ;
+        cliPrintfva(format, va);
+        
+# 358 "./src/main/cli/cli.c" 3 4
+       __builtin_va_end(
+# 358 "./src/main/cli/cli.c"
+       va
+# 358 "./src/main/cli/cli.c" 3 4
+       )
+# 358 "./src/main/cli/cli.c"
+                 ;
+        cliPrintLinefeed();
+        return 
+# 360 "./src/main/cli/cli.c" 3 4
+              1
+# 360 "./src/main/cli/cli.c"
+                  ;
+    } else {
+        return 
+# 362 "./src/main/cli/cli.c" 3 4
+              0
+# 362 "./src/main/cli/cli.c"
+                   ;
+    }
+}
+
+static void cliWrite(uint8_t ch)
+{
+    bufWriterAppend(cliWriter, ch);
+}
+
+static 
+# 371 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 371 "./src/main/cli/cli.c"
+           cliDefaultPrintLinef(dumpFlags_t dumpMask, 
+# 371 "./src/main/cli/cli.c" 3 4
+                                                      _Bool 
+# 371 "./src/main/cli/cli.c"
+                                                           equalsDefault, const char *format, ...)
+{
+    if ((dumpMask & SHOW_DEFAULTS) && !equalsDefault) {
+        cliWrite('#');
+
+        va_list va;
+        
+# 377 "./src/main/cli/cli.c" 3 4
+       __builtin_va_start(
+# 377 "./src/main/cli/cli.c"
+       va
+# 377 "./src/main/cli/cli.c" 3 4
+       ,
+# 377 "./src/main/cli/cli.c"
+       format
+# 377 "./src/main/cli/cli.c" 3 4
+       )
+# 377 "./src/main/cli/cli.c"
+                           ;
+        cliPrintfva(format, va);
+        
+# 379 "./src/main/cli/cli.c" 3 4
+       __builtin_va_end(
+# 379 "./src/main/cli/cli.c"
+       va
+# 379 "./src/main/cli/cli.c" 3 4
+       )
+# 379 "./src/main/cli/cli.c"
+                 ;
+        cliPrintLinefeed();
+        return 
+# 381 "./src/main/cli/cli.c" 3 4
+              1
+# 381 "./src/main/cli/cli.c"
+                  ;
+    } else {
+        return 
+# 383 "./src/main/cli/cli.c" 3 4
+              0
+# 383 "./src/main/cli/cli.c"
+                   ;
+    }
+}
+
+static void cliPrintf(const char *format, ...)
+{
+    va_list va;
+    
+# 390 "./src/main/cli/cli.c" 3 4
+   __builtin_va_start(
+# 390 "./src/main/cli/cli.c"
+   va
+# 390 "./src/main/cli/cli.c" 3 4
+   ,
+# 390 "./src/main/cli/cli.c"
+   format
+# 390 "./src/main/cli/cli.c" 3 4
+   )
+# 390 "./src/main/cli/cli.c"
+                       ;
+    cliPrintfva(format, va);
+    
+# 392 "./src/main/cli/cli.c" 3 4
+   __builtin_va_end(
+# 392 "./src/main/cli/cli.c"
+   va
+# 392 "./src/main/cli/cli.c" 3 4
+   )
+# 392 "./src/main/cli/cli.c"
+             ;
+}
+
+
+static void cliPrintLinef(const char *format, ...)
+{
+    va_list va;
+    
+# 399 "./src/main/cli/cli.c" 3 4
+   __builtin_va_start(
+# 399 "./src/main/cli/cli.c"
+   va
+# 399 "./src/main/cli/cli.c" 3 4
+   ,
+# 399 "./src/main/cli/cli.c"
+   format
+# 399 "./src/main/cli/cli.c" 3 4
+   )
+# 399 "./src/main/cli/cli.c"
+                       ;
+    cliPrintfva(format, va);
+    
+# 401 "./src/main/cli/cli.c" 3 4
+   __builtin_va_end(
+# 401 "./src/main/cli/cli.c"
+   va
+# 401 "./src/main/cli/cli.c" 3 4
+   )
+# 401 "./src/main/cli/cli.c"
+             ;
+    cliPrintLinefeed();
+}
+
+static void cliPrintErrorVa(const char *format, va_list va)
+{
+    cliPrint("###ERROR: ");
+    cliPrintfva(format, va);
+    
+# 409 "./src/main/cli/cli.c" 3 4
+   __builtin_va_end(
+# 409 "./src/main/cli/cli.c"
+   va
+# 409 "./src/main/cli/cli.c" 3 4
+   )
+# 409 "./src/main/cli/cli.c"
+             ;
+    cliPrint("###");
+
+
+    if (commandBatchActive) {
+        commandBatchError = 
+# 414 "./src/main/cli/cli.c" 3 4
+                           1
+# 414 "./src/main/cli/cli.c"
+                               ;
+    }
+
+}
+
+static void cliPrintError(const char *format, ...)
+{
+    va_list va;
+    
+# 422 "./src/main/cli/cli.c" 3 4
+   __builtin_va_start(
+# 422 "./src/main/cli/cli.c"
+   va
+# 422 "./src/main/cli/cli.c" 3 4
+   ,
+# 422 "./src/main/cli/cli.c"
+   format
+# 422 "./src/main/cli/cli.c" 3 4
+   )
+# 422 "./src/main/cli/cli.c"
+                       ;
+    cliPrintErrorVa(format, va);
+}
+
+static void cliPrintErrorLinef(const char *format, ...)
+{
+    va_list va;
+    
+# 429 "./src/main/cli/cli.c" 3 4
+   __builtin_va_start(
+# 429 "./src/main/cli/cli.c"
+   va
+# 429 "./src/main/cli/cli.c" 3 4
+   ,
+# 429 "./src/main/cli/cli.c"
+   format
+# 429 "./src/main/cli/cli.c" 3 4
+   )
+# 429 "./src/main/cli/cli.c"
+                       ;
+    cliPrintErrorVa(format, va);
+    cliPrintLinefeed();
+}
+
+static void getMinMax(const clivalue_t *var, int *min, int *max)
+{
+    switch (var->type & (0x07)) {
+    case VAR_UINT8:
+    case VAR_UINT16:
+        *min = var->config.minmaxUnsigned.min;
+        *max = var->config.minmaxUnsigned.max;
+
+        break;
+    default:
+        *min = var->config.minmax.min;
+        *max = var->config.minmax.max;
+
+        break;
+    }
+}
+
+static void printValuePointer(const clivalue_t *var, const void *valuePointer, 
+# 451 "./src/main/cli/cli.c" 3 4
+                                                                              _Bool 
+# 451 "./src/main/cli/cli.c"
+                                                                                   full)
+{
+    if ((var->type & (0xE0)) == MODE_ARRAY) {
+        for (int i = 0; i < var->config.array.length; i++) {
+            switch (var->type & (0x07)) {
+            default:
+            case VAR_UINT8:
+
+                cliPrintf("%d", ((uint8_t *)valuePointer)[i]);
+                break;
+
+            case VAR_INT8:
+
+                cliPrintf("%d", ((int8_t *)valuePointer)[i]);
+                break;
+
+            case VAR_UINT16:
+
+                cliPrintf("%d", ((uint16_t *)valuePointer)[i]);
+                break;
+
+            case VAR_INT16:
+
+                cliPrintf("%d", ((int16_t *)valuePointer)[i]);
+                break;
+            }
+
+            if (i < var->config.array.length - 1) {
+                cliPrint(",");
+            }
+        }
+    } else {
+        int value = 0;
+
+        switch (var->type & (0x07)) {
+        case VAR_UINT8:
+            value = *(uint8_t *)valuePointer;
+
+            break;
+        case VAR_INT8:
+            value = *(int8_t *)valuePointer;
+
+            break;
+        case VAR_UINT16:
+            value = *(uint16_t *)valuePointer;
+
+            break;
+        case VAR_INT16:
+            value = *(int16_t *)valuePointer;
+
+            break;
+        case VAR_UINT32:
+            value = *(uint32_t *)valuePointer;
+
+            break;
+        }
+
+        
+# 508 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 508 "./src/main/cli/cli.c"
+            valueIsCorrupted = 
+# 508 "./src/main/cli/cli.c" 3 4
+                               0
+# 508 "./src/main/cli/cli.c"
+                                    ;
+        switch (var->type & (0xE0)) {
+        case MODE_DIRECT:
+            if ((var->type & (0x07)) == VAR_UINT32) {
+                cliPrintf("%u", (uint32_t)value);
+                if ((uint32_t)value > var->config.u32Max) {
+                    valueIsCorrupted = 
+# 514 "./src/main/cli/cli.c" 3 4
+                                      1
+# 514 "./src/main/cli/cli.c"
+                                          ;
+                } else if (full) {
+                    cliPrintf(" 0 %u", var->config.u32Max);
+                }
+            } else {
+                int min;
+                int max;
+                getMinMax(var, &min, &max);
+
+                cliPrintf("%d", value);
+                if ((value < min) || (value > max)) {
+                    valueIsCorrupted = 
+# 525 "./src/main/cli/cli.c" 3 4
+                                      1
+# 525 "./src/main/cli/cli.c"
+                                          ;
+                } else if (full) {
+                    cliPrintf(" %d %d", min, max);
+                }
+            }
+            break;
+        case MODE_LOOKUP:
+            if (value < lookupTables[var->config.lookup.tableIndex].valueCount) {
+                cliPrint(lookupTables[var->config.lookup.tableIndex].values[value]);
+            } else {
+                valueIsCorrupted = 
+# 535 "./src/main/cli/cli.c" 3 4
+                                  1
+# 535 "./src/main/cli/cli.c"
+                                      ;
+            }
+            break;
+        case MODE_BITSET:
+            if (value & 1 << var->config.bitpos) {
+                cliPrintf("ON");
+            } else {
+                cliPrintf("OFF");
+            }
+            break;
+        case MODE_STRING:
+            cliPrintf("%s", (strlen((char *)valuePointer) == 0) ? "-" : (char *)valuePointer);
+            break;
+        }
+
+        if (valueIsCorrupted) {
+            cliPrintLinefeed();
+            cliPrintError("CORRUPTED CONFIG: %s = %d", var->name, value);
+        }
+    }
+}
+
+
+static 
+# 558 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 558 "./src/main/cli/cli.c"
+           valuePtrEqualsDefault(const clivalue_t *var, const void *ptr, const void *ptrDefault)
+{
+    
+# 560 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 560 "./src/main/cli/cli.c"
+        result = 
+# 560 "./src/main/cli/cli.c" 3 4
+                 1
+# 560 "./src/main/cli/cli.c"
+                     ;
+    int elementCount = 1;
+    uint32_t mask = 0xffffffff;
+
+    if ((var->type & (0xE0)) == MODE_ARRAY) {
+        elementCount = var->config.array.length;
+    }
+    if ((var->type & (0xE0)) == MODE_BITSET) {
+        mask = 1 << var->config.bitpos;
+    }
+    for (int i = 0; i < elementCount; i++) {
+        switch (var->type & (0x07)) {
+        case VAR_UINT8:
+            result = result && (((uint8_t *)ptr)[i] & mask) == (((uint8_t *)ptrDefault)[i] & mask);
+            break;
+
+        case VAR_INT8:
+            result = result && ((int8_t *)ptr)[i] == ((int8_t *)ptrDefault)[i];
+            break;
+
+        case VAR_UINT16:
+            result = result && (((uint16_t *)ptr)[i] & mask) == (((uint16_t *)ptrDefault)[i] & mask);
+            break;
+        case VAR_INT16:
+            result = result && ((int16_t *)ptr)[i] == ((int16_t *)ptrDefault)[i];
+            break;
+        case VAR_UINT32:
+            result = result && (((uint32_t *)ptr)[i] & mask) == (((uint32_t *)ptrDefault)[i] & mask);
+            break;
+        }
+    }
+
+    return result;
+}
+
+static const char *cliPrintSectionHeading(dumpFlags_t dumpMask, 
+# 595 "./src/main/cli/cli.c" 3 4
+                                                               _Bool 
+# 595 "./src/main/cli/cli.c"
+                                                                    outputFlag, const char *headingStr)
+{
+    if (headingStr && (!(dumpMask & DO_DIFF) || outputFlag)) {
+        cliPrintHashLine(headingStr);
+        return 
+# 599 "./src/main/cli/cli.c" 3 4
+              ((void *)0)
+# 599 "./src/main/cli/cli.c"
+                  ;
+    } else {
+        return headingStr;
+    }
+}
+
+static uint8_t getPidProfileIndexToUse()
+{
+    return pidProfileIndexToUse == -1 ? getCurrentPidProfileIndex() : pidProfileIndexToUse;
+}
+
+static uint8_t getRateProfileIndexToUse()
+{
+    return rateProfileIndexToUse == -1 ? getCurrentControlRateProfileIndex() : rateProfileIndexToUse;
+}
+
+
+static uint16_t getValueOffset(const clivalue_t *value)
+{
+    switch (value->type & (0x18)) {
+    case MASTER_VALUE:
+    case HARDWARE_VALUE:
+        return value->offset;
+    case PROFILE_VALUE:
+        return value->offset + sizeof(pidProfile_t) * getPidProfileIndexToUse();
+    case PROFILE_RATE_VALUE:
+        return value->offset + sizeof(controlRateConfig_t) * getRateProfileIndexToUse();
+    }
+    return 0;
+}
+
+void *cliGetValuePointer(const clivalue_t *value)
+{
+    const pgRegistry_t* rec = pgFind(value->pgn);
+    if (configIsInCopy) {
+        return ((void *)(rec->copy + getValueOffset(value)));
+    } else {
+        return ((void *)(rec->address + getValueOffset(value)));
+    }
+}
+
+const void *cliGetDefaultPointer(const clivalue_t *value)
+{
+    const pgRegistry_t* rec = pgFind(value->pgn);
+    return rec->address + getValueOffset(value);
+}
+
+static const char *dumpPgValue(const clivalue_t *value, dumpFlags_t dumpMask, const char *headingStr)
+{
+    const pgRegistry_t *pg = pgFind(value->pgn);
+
+
+
+
+
+
+
+    const char *format = "set %s = ";
+    const char *defaultFormat = "#set %s = ";
+    const int valueOffset = getValueOffset(value);
+    const 
+# 659 "./src/main/cli/cli.c" 3 4
+         _Bool 
+# 659 "./src/main/cli/cli.c"
+              equalsDefault = valuePtrEqualsDefault(value, pg->copy + valueOffset, pg->address + valueOffset);
+
+    headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+    if (((dumpMask & DO_DIFF) == 0) || !equalsDefault) {
+        if (dumpMask & SHOW_DEFAULTS && !equalsDefault) {
+            cliPrintf(defaultFormat, value->name);
+            printValuePointer(value, (uint8_t*)pg->address + valueOffset, 
+# 665 "./src/main/cli/cli.c" 3 4
+                                                                         0
+# 665 "./src/main/cli/cli.c"
+                                                                              );
+            cliPrintLinefeed();
+        }
+        cliPrintf(format, value->name);
+        printValuePointer(value, pg->copy + valueOffset, 
+# 669 "./src/main/cli/cli.c" 3 4
+                                                        0
+# 669 "./src/main/cli/cli.c"
+                                                             );
+        cliPrintLinefeed();
+    }
+    return headingStr;
+}
+
+static void dumpAllValues(uint16_t valueSection, dumpFlags_t dumpMask, const char *headingStr)
+{
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 677 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 677 "./src/main/cli/cli.c"
+                                                      , headingStr);
+
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        const clivalue_t *value = &valueTable[i];
+        bufWriterFlush(cliWriter);
+        if ((value->type & (0x18)) == valueSection || ((valueSection == MASTER_VALUE) && (value->type & (0x18)) == HARDWARE_VALUE)) {
+            headingStr = dumpPgValue(value, dumpMask, headingStr);
+        }
+    }
+}
+
+static void cliPrintVar(const clivalue_t *var, 
+# 688 "./src/main/cli/cli.c" 3 4
+                                              _Bool 
+# 688 "./src/main/cli/cli.c"
+                                                   full)
+{
+    const void *ptr = cliGetValuePointer(var);
+
+    printValuePointer(var, ptr, full);
+}
+
+static void cliPrintVarRange(const clivalue_t *var)
+{
+    switch (var->type & (0xE0)) {
+    case (MODE_DIRECT): {
+        switch (var->type & (0x07)) {
+        case VAR_UINT32:
+            cliPrintLinef("Allowed range: 0 - %u", var->config.u32Max);
+
+            break;
+        case VAR_UINT8:
+        case VAR_UINT16:
+            cliPrintLinef("Allowed range: %d - %d", var->config.minmaxUnsigned.min, var->config.minmaxUnsigned.max);
+
+            break;
+        default:
+            cliPrintLinef("Allowed range: %d - %d", var->config.minmax.min, var->config.minmax.max);
+
+            break;
+        }
+    }
+    break;
+    case (MODE_LOOKUP): {
+        const lookupTableEntry_t *tableEntry = &lookupTables[var->config.lookup.tableIndex];
+        cliPrint("Allowed values: ");
+        
+# 719 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 719 "./src/main/cli/cli.c"
+            firstEntry = 
+# 719 "./src/main/cli/cli.c" 3 4
+                         1
+# 719 "./src/main/cli/cli.c"
+                             ;
+        for (unsigned i = 0; i < tableEntry->valueCount; i++) {
+            if (tableEntry->values[i]) {
+                if (!firstEntry) {
+                    cliPrint(", ");
+                }
+                cliPrintf("%s", tableEntry->values[i]);
+                firstEntry = 
+# 726 "./src/main/cli/cli.c" 3 4
+                            0
+# 726 "./src/main/cli/cli.c"
+                                 ;
+            }
+        }
+        cliPrintLinefeed();
+    }
+    break;
+    case (MODE_ARRAY): {
+        cliPrintLinef("Array length: %d", var->config.array.length);
+    }
+    break;
+    case (MODE_BITSET): {
+        cliPrintLinef("Allowed values: OFF, ON");
+    }
+    break;
+    }
+}
+
+static void cliSetVar(const clivalue_t *var, const uint32_t value)
+{
+    void *ptr = cliGetValuePointer(var);
+    uint32_t workValue;
+    uint32_t mask;
+
+    if ((var->type & (0xE0)) == MODE_BITSET) {
+        switch (var->type & (0x07)) {
+        case VAR_UINT8:
+            mask = (1 << var->config.bitpos) & 0xff;
+            if (value) {
+                workValue = *(uint8_t *)ptr | mask;
+            } else {
+                workValue = *(uint8_t *)ptr & ~mask;
+            }
+            *(uint8_t *)ptr = workValue;
+            break;
+
+        case VAR_UINT16:
+            mask = (1 << var->config.bitpos) & 0xffff;
+            if (value) {
+                workValue = *(uint16_t *)ptr | mask;
+            } else {
+                workValue = *(uint16_t *)ptr & ~mask;
+            }
+            *(uint16_t *)ptr = workValue;
+            break;
+
+        case VAR_UINT32:
+            mask = 1 << var->config.bitpos;
+            if (value) {
+                workValue = *(uint32_t *)ptr | mask;
+            } else {
+                workValue = *(uint32_t *)ptr & ~mask;
+            }
+            *(uint32_t *)ptr = workValue;
+            break;
+        }
+    } else {
+        switch (var->type & (0x07)) {
+        case VAR_UINT8:
+            *(uint8_t *)ptr = value;
+            break;
+
+        case VAR_INT8:
+            *(int8_t *)ptr = value;
+            break;
+
+        case VAR_UINT16:
+            *(uint16_t *)ptr = value;
+            break;
+
+        case VAR_INT16:
+            *(int16_t *)ptr = value;
+            break;
+
+        case VAR_UINT32:
+            *(uint32_t *)ptr = value;
+            break;
+        }
+    }
+}
+# 816 "./src/main/cli/cli.c"
+static void cliPrompt(void)
+{
+    cliPrint("\r\n# ");
+}
+
+static void cliShowParseError(void)
+{
+    cliPrintErrorLinef("PARSE ERROR");
+}
+
+static void cliShowArgumentRangeError(char *name, int min, int max)
+{
+    cliPrintErrorLinef("%s NOT BETWEEN %d AND %d", name, min, max);
+}
+
+static const char *nextArg(const char *currentArg)
+{
+    const char *ptr = strchr(currentArg, ' ');
+    while (ptr && *ptr == ' ') {
+        ptr++;
+    }
+
+    return ptr;
+}
+
+static const char *processChannelRangeArgs(const char *ptr, channelRange_t *range, uint8_t *validArgumentCount)
+{
+    for (uint32_t argIndex = 0; argIndex < 2; argIndex++) {
+        ptr = nextArg(ptr);
+        if (ptr) {
+            int val = atoi(ptr);
+            val = ((constrain(val, 900, 2100) - 900) / 25);
+            if (val >= 0 && val <= ((2100 - 900) / 25)) {
+                if (argIndex == 0) {
+                    range->startStep = val;
+                } else {
+                    range->endStep = val;
+                }
+                (*validArgumentCount)++;
+            }
+        }
+    }
+
+    return ptr;
+}
+
+
+static 
+# 863 "./src/main/cli/cli.c" 3 4
+      _Bool 
+# 863 "./src/main/cli/cli.c"
+           isEmpty(const char *string)
+{
+    return (string == 
+# 865 "./src/main/cli/cli.c" 3 4
+                     ((void *)0) 
+# 865 "./src/main/cli/cli.c"
+                          || *string == '\0') ? 
+# 865 "./src/main/cli/cli.c" 3 4
+                                                1 
+# 865 "./src/main/cli/cli.c"
+                                                     : 
+# 865 "./src/main/cli/cli.c" 3 4
+                                                       0
+# 865 "./src/main/cli/cli.c"
+                                                            ;
+}
+
+static void printRxFailsafe(dumpFlags_t dumpMask, const rxFailsafeChannelConfig_t *rxFailsafeChannelConfigs, const rxFailsafeChannelConfig_t *defaultRxFailsafeChannelConfigs, const char *headingStr)
+{
+
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 871 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 871 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (uint32_t channel = 0; channel < 18; channel++) {
+        const rxFailsafeChannelConfig_t *channelFailsafeConfig = &rxFailsafeChannelConfigs[channel];
+        const rxFailsafeChannelConfig_t *defaultChannelFailsafeConfig = &defaultRxFailsafeChannelConfigs[channel];
+        const 
+# 875 "./src/main/cli/cli.c" 3 4
+             _Bool 
+# 875 "./src/main/cli/cli.c"
+                  equalsDefault = !memcmp(channelFailsafeConfig, defaultChannelFailsafeConfig, sizeof(*channelFailsafeConfig));
+        const 
+# 876 "./src/main/cli/cli.c" 3 4
+             _Bool 
+# 876 "./src/main/cli/cli.c"
+                  requireValue = channelFailsafeConfig->mode == RX_FAILSAFE_MODE_SET;
+        headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+        if (requireValue) {
+            const char *format = "rxfail %u %c %d";
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                channel,
+                rxFailsafeModeCharacters[defaultChannelFailsafeConfig->mode],
+                (750 + 25 * defaultChannelFailsafeConfig->step)
+            );
+            cliDumpPrintLinef(dumpMask, equalsDefault, format,
+                channel,
+                rxFailsafeModeCharacters[channelFailsafeConfig->mode],
+                (750 + 25 * channelFailsafeConfig->step)
+            );
+        } else {
+            const char *format = "rxfail %u %c";
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                channel,
+                rxFailsafeModeCharacters[defaultChannelFailsafeConfig->mode]
+            );
+            cliDumpPrintLinef(dumpMask, equalsDefault, format,
+                channel,
+                rxFailsafeModeCharacters[channelFailsafeConfig->mode]
+            );
+        }
+    }
+}
+
+static void cliRxFailsafe(char *cmdline)
+{
+    uint8_t channel;
+    char buf[3];
+
+    if (isEmpty(cmdline)) {
+
+        for (channel = 0; channel < 18; channel++) {
+            cliRxFailsafe(itoa(channel, buf, 10));
+        }
+    } else {
+        const char *ptr = cmdline;
+        channel = atoi(ptr++);
+        if ((channel < 18)) {
+
+            rxFailsafeChannelConfig_t *channelFailsafeConfig = rxFailsafeChannelConfigsMutable(channel);
+
+            const rxFailsafeChannelType_e type = (channel < 4) ? RX_FAILSAFE_TYPE_FLIGHT : RX_FAILSAFE_TYPE_AUX;
+            rxFailsafeChannelMode_e mode = channelFailsafeConfig->mode;
+            
+# 923 "./src/main/cli/cli.c" 3 4
+           _Bool 
+# 923 "./src/main/cli/cli.c"
+                requireValue = channelFailsafeConfig->mode == RX_FAILSAFE_MODE_SET;
+
+            ptr = nextArg(ptr);
+            if (ptr) {
+                const char *p = strchr(rxFailsafeModeCharacters, *(ptr));
+                if (p) {
+                    const uint8_t requestedMode = p - rxFailsafeModeCharacters;
+                    mode = rxFailsafeModesTable[type][requestedMode];
+                } else {
+                    mode = RX_FAILSAFE_MODE_INVALID;
+                }
+                if (mode == RX_FAILSAFE_MODE_INVALID) {
+                    cliShowParseError();
+                    return;
+                }
+
+                requireValue = mode == RX_FAILSAFE_MODE_SET;
+
+                ptr = nextArg(ptr);
+                if (ptr) {
+                    if (!requireValue) {
+                        cliShowParseError();
+                        return;
+                    }
+                    uint16_t value = atoi(ptr);
+                    value = ((constrain(value, 750, 2250) - 750) / 25);
+                    if (value > ((2250 - 750) / 25)) {
+                        cliPrintLine("Value out of range");
+                        return;
+                    }
+
+                    channelFailsafeConfig->step = value;
+                } else if (requireValue) {
+                    cliShowParseError();
+                    return;
+                }
+                channelFailsafeConfig->mode = mode;
+            }
+
+            char modeCharacter = rxFailsafeModeCharacters[channelFailsafeConfig->mode];
+
+
+
+
+
+            if (requireValue) {
+                cliPrintLinef("rxfail %u %c %d",
+                    channel,
+                    modeCharacter,
+                    (750 + 25 * channelFailsafeConfig->step)
+                );
+            } else {
+                cliPrintLinef("rxfail %u %c",
+                    channel,
+                    modeCharacter
+                );
+            }
+        } else {
+            cliShowArgumentRangeError("CHANNEL", 0, 18 - 1);
+        }
+    }
+}
+
+static void printAux(dumpFlags_t dumpMask, const modeActivationCondition_t *modeActivationConditions, const modeActivationCondition_t *defaultModeActivationConditions, const char *headingStr)
+{
+    const char *format = "aux %u %u %u %u %u %u %u";
+
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 990 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 990 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (uint32_t i = 0; i < 20; i++) {
+        const modeActivationCondition_t *mac = &modeActivationConditions[i];
+        
+# 993 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 993 "./src/main/cli/cli.c"
+            equalsDefault = 
+# 993 "./src/main/cli/cli.c" 3 4
+                            0
+# 993 "./src/main/cli/cli.c"
+                                 ;
+        if (defaultModeActivationConditions) {
+            const modeActivationCondition_t *macDefault = &defaultModeActivationConditions[i];
+            equalsDefault = !isModeActivationConditionConfigured(mac, macDefault);
+            headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+            const box_t *box = findBoxByBoxId(macDefault->modeId);
+            const box_t *linkedTo = findBoxByBoxId(macDefault->linkedTo);
+            if (box) {
+                cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                    i,
+                    box->permanentId,
+                    macDefault->auxChannelIndex,
+                    (900 + 25 * macDefault->range.startStep),
+                    (900 + 25 * macDefault->range.endStep),
+                    macDefault->modeLogic,
+                    linkedTo ? linkedTo->permanentId : 0
+                );
+            }
+        }
+        const box_t *box = findBoxByBoxId(mac->modeId);
+        const box_t *linkedTo = findBoxByBoxId(mac->linkedTo);
+        if (box) {
+            cliDumpPrintLinef(dumpMask, equalsDefault, format,
+                i,
+                box->permanentId,
+                mac->auxChannelIndex,
+                (900 + 25 * mac->range.startStep),
+                (900 + 25 * mac->range.endStep),
+                mac->modeLogic,
+                linkedTo ? linkedTo->permanentId : 0
+            );
+        }
+    }
+}
+
+static void cliAux(char *cmdline)
+{
+    int i, val = 0;
+    const char *ptr;
+
+    if (isEmpty(cmdline)) {
+        printAux(DUMP_MASTER, modeActivationConditions(0), 
+# 1034 "./src/main/cli/cli.c" 3 4
+                                                          ((void *)0)
+# 1034 "./src/main/cli/cli.c"
+                                                              , 
+# 1034 "./src/main/cli/cli.c" 3 4
+                                                                ((void *)0)
+# 1034 "./src/main/cli/cli.c"
+                                                                    );
+    } else {
+        ptr = cmdline;
+        i = atoi(ptr++);
+        if (i < 20) {
+            modeActivationCondition_t *mac = modeActivationConditionsMutable(i);
+            uint8_t validArgumentCount = 0;
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                const box_t *box = findBoxByPermanentId(val);
+                if (box) {
+                    mac->modeId = box->boxId;
+                    validArgumentCount++;
+                }
+            }
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                if (val >= 0 && val < (18 - 4)) {
+                    mac->auxChannelIndex = val;
+                    validArgumentCount++;
+                }
+            }
+            ptr = processChannelRangeArgs(ptr, &mac->range, &validArgumentCount);
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                if (val == MODELOGIC_OR || val == MODELOGIC_AND) {
+                    mac->modeLogic = val;
+                    validArgumentCount++;
+                }
+            }
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                const box_t *box = findBoxByPermanentId(val);
+                if (box) {
+                    mac->linkedTo = box->boxId;
+                    validArgumentCount++;
+                }
+            }
+            if (validArgumentCount == 4) {
+                mac->modeLogic = MODELOGIC_OR;
+                mac->linkedTo = 0;
+            } else if (validArgumentCount == 5) {
+                mac->linkedTo = 0;
+            } else if (validArgumentCount != 6) {
+                memset(mac, 0, sizeof(modeActivationCondition_t));
+            }
+            analyzeModeActivationConditions();
+            cliPrintLinef( "aux %u %u %u %u %u %u %u",
+                i,
+                findBoxByBoxId(mac->modeId)->permanentId,
+                mac->auxChannelIndex,
+                (900 + 25 * mac->range.startStep),
+                (900 + 25 * mac->range.endStep),
+                mac->modeLogic,
+                findBoxByBoxId(mac->linkedTo)->permanentId
+            );
+        } else {
+            cliShowArgumentRangeError("INDEX", 0, 20 - 1);
+        }
+    }
+}
+
+static void printSerial(dumpFlags_t dumpMask, const serialConfig_t *serialConfig, const serialConfig_t *serialConfigDefault, const char *headingStr)
+{
+    const char *format = "serial %d %d %ld %ld %ld %ld";
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 1103 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 1103 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (uint32_t i = 0; i < 8; i++) {
+        if (!serialIsPortAvailable(serialConfig->portConfigs[i].identifier)) {
+            continue;
+        };
+        
+# 1108 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 1108 "./src/main/cli/cli.c"
+            equalsDefault = 
+# 1108 "./src/main/cli/cli.c" 3 4
+                            0
+# 1108 "./src/main/cli/cli.c"
+                                 ;
+        if (serialConfigDefault) {
+            equalsDefault = !memcmp(&serialConfig->portConfigs[i], &serialConfigDefault->portConfigs[i], sizeof(serialConfig->portConfigs[i]));
+            headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                serialConfigDefault->portConfigs[i].identifier,
+                serialConfigDefault->portConfigs[i].functionMask,
+                baudRates[serialConfigDefault->portConfigs[i].msp_baudrateIndex],
+                baudRates[serialConfigDefault->portConfigs[i].gps_baudrateIndex],
+                baudRates[serialConfigDefault->portConfigs[i].telemetry_baudrateIndex],
+                baudRates[serialConfigDefault->portConfigs[i].blackbox_baudrateIndex]
+            );
+        }
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            serialConfig->portConfigs[i].identifier,
+            serialConfig->portConfigs[i].functionMask,
+            baudRates[serialConfig->portConfigs[i].msp_baudrateIndex],
+            baudRates[serialConfig->portConfigs[i].gps_baudrateIndex],
+            baudRates[serialConfig->portConfigs[i].telemetry_baudrateIndex],
+            baudRates[serialConfig->portConfigs[i].blackbox_baudrateIndex]
+            );
+    }
+}
+
+static void cliSerial(char *cmdline)
+{
+    const char *format = "serial %d %d %ld %ld %ld %ld";
+    if (isEmpty(cmdline)) {
+        printSerial(DUMP_MASTER, serialConfig(), 
+# 1136 "./src/main/cli/cli.c" 3 4
+                                                ((void *)0)
+# 1136 "./src/main/cli/cli.c"
+                                                    , 
+# 1136 "./src/main/cli/cli.c" 3 4
+                                                      ((void *)0)
+# 1136 "./src/main/cli/cli.c"
+                                                          );
+        return;
+    }
+    serialPortConfig_t portConfig;
+    memset(&portConfig, 0 , sizeof(portConfig));
+
+    serialPortConfig_t *currentConfig;
+
+    uint8_t validArgumentCount = 0;
+
+    const char *ptr = cmdline;
+
+    int val = atoi(ptr++);
+    currentConfig = serialFindPortConfiguration(val);
+    if (currentConfig) {
+        portConfig.identifier = val;
+        validArgumentCount++;
+    }
+
+    ptr = nextArg(ptr);
+    if (ptr) {
+        val = atoi(ptr);
+        portConfig.functionMask = val & 0xFFFF;
+        validArgumentCount++;
+    }
+
+    for (int i = 0; i < 4; i ++) {
+        ptr = nextArg(ptr);
+        if (!ptr) {
+            break;
+        }
+
+        val = atoi(ptr);
+
+        uint8_t baudRateIndex = lookupBaudRateIndex(val);
+        if (baudRates[baudRateIndex] != (uint32_t) val) {
+            break;
+        }
+
+        switch (i) {
+        case 0:
+            if (baudRateIndex < BAUD_9600 || baudRateIndex > BAUD_1000000) {
+                continue;
+            }
+            portConfig.msp_baudrateIndex = baudRateIndex;
+            break;
+        case 1:
+            if (baudRateIndex < BAUD_9600 || baudRateIndex > BAUD_115200) {
+                continue;
+            }
+            portConfig.gps_baudrateIndex = baudRateIndex;
+            break;
+        case 2:
+            if (baudRateIndex != BAUD_AUTO && baudRateIndex > BAUD_115200) {
+                continue;
+            }
+            portConfig.telemetry_baudrateIndex = baudRateIndex;
+            break;
+        case 3:
+            if (baudRateIndex < BAUD_19200 || baudRateIndex > BAUD_2470000) {
+                continue;
+            }
+            portConfig.blackbox_baudrateIndex = baudRateIndex;
+            break;
+        }
+
+        validArgumentCount++;
+    }
+
+    if (validArgumentCount < 6) {
+        cliShowParseError();
+        return;
+    }
+
+    memcpy(currentConfig, &portConfig, sizeof(portConfig));
+
+    cliDumpPrintLinef(0, 
+# 1212 "./src/main/cli/cli.c" 3 4
+                        0
+# 1212 "./src/main/cli/cli.c"
+                             , format,
+        portConfig.identifier,
+        portConfig.functionMask,
+        baudRates[portConfig.msp_baudrateIndex],
+        baudRates[portConfig.gps_baudrateIndex],
+        baudRates[portConfig.telemetry_baudrateIndex],
+        baudRates[portConfig.blackbox_baudrateIndex]
+        );
+
+}
+# 1249 "./src/main/cli/cli.c"
+static void cbCtrlLine(void *context, uint16_t ctrl)
+{
+
+    int contextValue = (int)(long)context;
+    if (contextValue) {
+        pinioSet(contextValue - 1, !(ctrl & (1 << 0)));
+    } else
+
+    (void)(context);
+
+    if (!(ctrl & (1 << 0))) {
+        systemReset();
+    }
+}
+
+static void cliSerialPassthrough(char *cmdline)
+{
+    if (isEmpty(cmdline)) {
+        cliShowParseError();
+        return;
+    }
+
+    int id = -1;
+    uint32_t baud = 0;
+    
+# 1273 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 1273 "./src/main/cli/cli.c"
+        enableBaudCb = 
+# 1273 "./src/main/cli/cli.c" 3 4
+                       0
+# 1273 "./src/main/cli/cli.c"
+                            ;
+    int pinioDtr = 0;
+    
+# 1275 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 1275 "./src/main/cli/cli.c"
+        resetOnDtr = 
+# 1275 "./src/main/cli/cli.c" 3 4
+                     0
+# 1275 "./src/main/cli/cli.c"
+                          ;
+    unsigned mode = 0;
+    char *saveptr;
+    char* tok = strtok_r(cmdline, " ", &saveptr);
+    int index = 0;
+
+    while (tok != 
+# 1281 "./src/main/cli/cli.c" 3 4
+                 ((void *)0)
+# 1281 "./src/main/cli/cli.c"
+                     ) {
+        switch (index) {
+        case 0:
+            id = atoi(tok);
+            break;
+        case 1:
+            baud = atoi(tok);
+            break;
+        case 2:
+            if (strcasestr(tok, "rx")) {
+                mode |= MODE_RX;
+            }
+            if (strcasestr(tok, "tx")) {
+                mode |= MODE_TX;
+            }
+            break;
+        case 3:
+            if (strncasecmp(tok, "reset", strlen(tok)) == 0) {
+                resetOnDtr = 
+# 1299 "./src/main/cli/cli.c" 3 4
+                            1
+# 1299 "./src/main/cli/cli.c"
+                                ;
+
+            } else {
+                pinioDtr = atoi(tok);
+
+            }
+
+            break;
+        }
+        index++;
+        tok = strtok_r(
+# 1309 "./src/main/cli/cli.c" 3 4
+                      ((void *)0)
+# 1309 "./src/main/cli/cli.c"
+                          , " ", &saveptr);
+    }
+
+    if (baud == 0) {
+        enableBaudCb = 
+# 1313 "./src/main/cli/cli.c" 3 4
+                      1
+# 1313 "./src/main/cli/cli.c"
+                          ;
+    }
+
+    cliPrintf("Port %d ", id);
+    serialPort_t *passThroughPort;
+    serialPortUsage_t *passThroughPortUsage = findSerialPortUsageByIdentifier(id);
+    if (!passThroughPortUsage || passThroughPortUsage->serialPort == 
+# 1319 "./src/main/cli/cli.c" 3 4
+                                                                    ((void *)0)
+# 1319 "./src/main/cli/cli.c"
+                                                                        ) {
+        if (enableBaudCb) {
+
+            baud = 57600;
+        }
+
+        if (!mode) {
+            mode = MODE_RXTX;
+        }
+
+        passThroughPort = openSerialPort(id, FUNCTION_NONE, 
+# 1329 "./src/main/cli/cli.c" 3 4
+                                                           ((void *)0)
+# 1329 "./src/main/cli/cli.c"
+                                                               , 
+# 1329 "./src/main/cli/cli.c" 3 4
+                                                                 ((void *)0)
+# 1329 "./src/main/cli/cli.c"
+                                                                     ,
+                                         baud, mode,
+                                         SERIAL_NOT_INVERTED);
+        if (!passThroughPort) {
+            cliPrintLine("could not be opened.");
+            return;
+        }
+
+        if (enableBaudCb) {
+            cliPrintf("opened, default baud = %d.\r\n", baud);
+        } else {
+            cliPrintf("opened, baud = %d.\r\n", baud);
+        }
+    } else {
+        passThroughPort = passThroughPortUsage->serialPort;
+
+
+
+        if (baud) {
+            cliPrintf("already open, setting baud = %d.\n\r", baud);
+            serialSetBaudRate(passThroughPort, baud);
+        } else {
+            cliPrintf("already open, baud = %d.\n\r", passThroughPort->baudRate);
+        }
+
+        if (mode && passThroughPort->mode != mode) {
+            cliPrintf("Mode changed from %d to %d.\r\n",
+                   passThroughPort->mode, mode);
+            serialSetMode(passThroughPort, mode);
+        }
+
+
+
+        if (passThroughPort->rxCallback) {
+            passThroughPort->rxCallback = 0;
+        }
+    }
+
+
+    if (enableBaudCb) {
+        cliPrintLine("Baud rate change over USB enabled.");
+
+
+        serialSetBaudRateCb(cliPort, serialSetBaudRate, passThroughPort);
+    }
+
+    char *resetMessage = "";
+    if (resetOnDtr) {
+        resetMessage = "or drop DTR ";
+    }
+
+    cliPrintLinef("Forwarding, power cycle %sto exit.", resetMessage);
+
+    if (resetOnDtr
+
+        || pinioDtr
+
+        ) {
+
+        serialSetCtrlLineStateCb(cliPort, cbCtrlLine, (void *)(intptr_t)(pinioDtr));
+    }
+
+    serialPassthrough(cliPort, passThroughPort, 
+# 1391 "./src/main/cli/cli.c" 3 4
+                                               ((void *)0)
+# 1391 "./src/main/cli/cli.c"
+                                                   , 
+# 1391 "./src/main/cli/cli.c" 3 4
+                                                     ((void *)0)
+# 1391 "./src/main/cli/cli.c"
+                                                         );
+}
+
+
+static void printAdjustmentRange(dumpFlags_t dumpMask, const adjustmentRange_t *adjustmentRanges, const adjustmentRange_t *defaultAdjustmentRanges, const char *headingStr)
+{
+    const char *format = "adjrange %u %u %u %u %u %u %u %u %u";
+
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 1399 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 1399 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (uint32_t i = 0; i < 30; i++) {
+        const adjustmentRange_t *ar = &adjustmentRanges[i];
+        
+# 1402 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 1402 "./src/main/cli/cli.c"
+            equalsDefault = 
+# 1402 "./src/main/cli/cli.c" 3 4
+                            0
+# 1402 "./src/main/cli/cli.c"
+                                 ;
+        if (defaultAdjustmentRanges) {
+            const adjustmentRange_t *arDefault = &defaultAdjustmentRanges[i];
+            equalsDefault = !memcmp(ar, arDefault, sizeof(*ar));
+            headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                i,
+                arDefault->adjustmentIndex,
+                arDefault->auxChannelIndex,
+                (900 + 25 * arDefault->range.startStep),
+                (900 + 25 * arDefault->range.endStep),
+                arDefault->adjustmentConfig,
+                arDefault->auxSwitchChannelIndex,
+                arDefault->adjustmentCenter,
+                arDefault->adjustmentScale
+            );
+        }
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            i,
+            ar->adjustmentIndex,
+            ar->auxChannelIndex,
+            (900 + 25 * ar->range.startStep),
+            (900 + 25 * ar->range.endStep),
+            ar->adjustmentConfig,
+            ar->auxSwitchChannelIndex,
+            ar->adjustmentCenter,
+            ar->adjustmentScale
+        );
+    }
+}
+
+static void cliAdjustmentRange(char *cmdline)
+{
+    const char *format = "adjrange %u %u %u %u %u %u %u %u %u";
+    int i, val = 0;
+    const char *ptr;
+
+    if (isEmpty(cmdline)) {
+        printAdjustmentRange(DUMP_MASTER, adjustmentRanges(0), 
+# 1440 "./src/main/cli/cli.c" 3 4
+                                                              ((void *)0)
+# 1440 "./src/main/cli/cli.c"
+                                                                  , 
+# 1440 "./src/main/cli/cli.c" 3 4
+                                                                    ((void *)0)
+# 1440 "./src/main/cli/cli.c"
+                                                                        );
+    } else {
+        ptr = cmdline;
+        i = atoi(ptr++);
+        if (i < 30) {
+            adjustmentRange_t *ar = adjustmentRangesMutable(i);
+            uint8_t validArgumentCount = 0;
+
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                if (val >= 0 && val < 4) {
+                    ar->adjustmentIndex = val;
+                    validArgumentCount++;
+                }
+            }
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                if (val >= 0 && val < (18 - 4)) {
+                    ar->auxChannelIndex = val;
+                    validArgumentCount++;
+                }
+            }
+
+            ptr = processChannelRangeArgs(ptr, &ar->range, &validArgumentCount);
+
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                if (val >= 0 && val < ADJUSTMENT_FUNCTION_COUNT) {
+                    ar->adjustmentConfig = val;
+                    validArgumentCount++;
+                }
+            }
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                if (val >= 0 && val < (18 - 4)) {
+                    ar->auxSwitchChannelIndex = val;
+                    validArgumentCount++;
+                }
+            }
+
+            if (validArgumentCount != 6) {
+                memset(ar, 0, sizeof(adjustmentRange_t));
+                cliShowParseError();
+                return;
+            }
+
+
+            ar->adjustmentCenter = 0;
+            ar->adjustmentScale = 0;
+
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                ar->adjustmentCenter = val;
+                validArgumentCount++;
+            }
+            ptr = nextArg(ptr);
+            if (ptr) {
+                val = atoi(ptr);
+                ar->adjustmentScale = val;
+                validArgumentCount++;
+            }
+
+            activeAdjustmentRangeReset();
+
+            cliDumpPrintLinef(0, 
+# 1509 "./src/main/cli/cli.c" 3 4
+                                0
+# 1509 "./src/main/cli/cli.c"
+                                     , format,
+                i,
+                ar->adjustmentIndex,
+                ar->auxChannelIndex,
+                (900 + 25 * ar->range.startStep),
+                (900 + 25 * ar->range.endStep),
+                ar->adjustmentConfig,
+                ar->auxSwitchChannelIndex,
+                ar->adjustmentCenter,
+                ar->adjustmentScale
+            );
+
+        } else {
+            cliShowArgumentRangeError("INDEX", 0, 30 - 1);
+        }
+    }
+}
+
+
+static void printMotorMix(dumpFlags_t dumpMask, const motorMixer_t *customMotorMixer, const motorMixer_t *defaultCustomMotorMixer, const char *headingStr)
+{
+    const char *format = "mmix %d %s %s %s %s";
+    char buf0[11];
+    char buf1[11];
+    char buf2[11];
+    char buf3[11];
+    for (uint32_t i = 0; i < 8; i++) {
+        if (customMotorMixer[i].throttle == 0.0f)
+            break;
+        const float thr = customMotorMixer[i].throttle;
+        const float roll = customMotorMixer[i].roll;
+        const float pitch = customMotorMixer[i].pitch;
+        const float yaw = customMotorMixer[i].yaw;
+        
+# 1542 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 1542 "./src/main/cli/cli.c"
+            equalsDefault = 
+# 1542 "./src/main/cli/cli.c" 3 4
+                            0
+# 1542 "./src/main/cli/cli.c"
+                                 ;
+        if (defaultCustomMotorMixer) {
+            const float thrDefault = defaultCustomMotorMixer[i].throttle;
+            const float rollDefault = defaultCustomMotorMixer[i].roll;
+            const float pitchDefault = defaultCustomMotorMixer[i].pitch;
+            const float yawDefault = defaultCustomMotorMixer[i].yaw;
+            const 
+# 1548 "./src/main/cli/cli.c" 3 4
+                 _Bool 
+# 1548 "./src/main/cli/cli.c"
+                      equalsDefault = thr == thrDefault && roll == rollDefault && pitch == pitchDefault && yaw == yawDefault;
+
+            headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                i,
+                ftoa(thrDefault, buf0),
+                ftoa(rollDefault, buf1),
+                ftoa(pitchDefault, buf2),
+                ftoa(yawDefault, buf3));
+        }
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            i,
+            ftoa(thr, buf0),
+            ftoa(roll, buf1),
+            ftoa(pitch, buf2),
+            ftoa(yaw, buf3));
+    }
+}
+
+
+static void cliMotorMix(char *cmdline)
+{
+
+
+
+    int check = 0;
+    uint8_t len;
+    const char *ptr;
+
+    if (isEmpty(cmdline)) {
+        printMotorMix(DUMP_MASTER, customMotorMixer(0), 
+# 1578 "./src/main/cli/cli.c" 3 4
+                                                       ((void *)0)
+# 1578 "./src/main/cli/cli.c"
+                                                           , 
+# 1578 "./src/main/cli/cli.c" 3 4
+                                                             ((void *)0)
+# 1578 "./src/main/cli/cli.c"
+                                                                 );
+    } else if (strncasecmp(cmdline, "reset", 5) == 0) {
+
+        for (uint32_t i = 0; i < 8; i++) {
+            customMotorMixerMutable(i)->throttle = 0.0f;
+        }
+    } else if (strncasecmp(cmdline, "load", 4) == 0) {
+        ptr = nextArg(cmdline);
+        if (ptr) {
+            len = strlen(ptr);
+            for (uint32_t i = 0; ; i++) {
+                if (mixerNames[i] == 
+# 1589 "./src/main/cli/cli.c" 3 4
+                                    ((void *)0)
+# 1589 "./src/main/cli/cli.c"
+                                        ) {
+                    cliPrintErrorLinef("INVALID NAME");
+                    break;
+                }
+                if (strncasecmp(ptr, mixerNames[i], len) == 0) {
+                    mixerLoadMix(i, customMotorMixerMutable(0));
+                    cliPrintLinef("Loaded %s", mixerNames[i]);
+                    cliMotorMix("");
+                    break;
+                }
+            }
+        }
+    } else {
+        ptr = cmdline;
+        uint32_t i = atoi(ptr);
+        if (i < 8) {
+            ptr = nextArg(ptr);
+            if (ptr) {
+                customMotorMixerMutable(i)->throttle = fastA2F(ptr);
+                check++;
+            }
+            ptr = nextArg(ptr);
+            if (ptr) {
+                customMotorMixerMutable(i)->roll = fastA2F(ptr);
+                check++;
+            }
+            ptr = nextArg(ptr);
+            if (ptr) {
+                customMotorMixerMutable(i)->pitch = fastA2F(ptr);
+                check++;
+            }
+            ptr = nextArg(ptr);
+            if (ptr) {
+                customMotorMixerMutable(i)->yaw = fastA2F(ptr);
+                check++;
+            }
+            if (check != 4) {
+                cliShowParseError();
+            } else {
+                printMotorMix(DUMP_MASTER, customMotorMixer(0), 
+# 1628 "./src/main/cli/cli.c" 3 4
+                                                               ((void *)0)
+# 1628 "./src/main/cli/cli.c"
+                                                                   , 
+# 1628 "./src/main/cli/cli.c" 3 4
+                                                                     ((void *)0)
+# 1628 "./src/main/cli/cli.c"
+                                                                         );
+            }
+        } else {
+            cliShowArgumentRangeError("INDEX", 0, 8 - 1);
+        }
+    }
+
+}
+
+static void printRxRange(dumpFlags_t dumpMask, const rxChannelRangeConfig_t *channelRangeConfigs, const rxChannelRangeConfig_t *defaultChannelRangeConfigs, const char *headingStr)
+{
+    const char *format = "rxrange %u %u %u";
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 1640 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 1640 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (uint32_t i = 0; i < 4; i++) {
+        
+# 1642 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 1642 "./src/main/cli/cli.c"
+            equalsDefault = 
+# 1642 "./src/main/cli/cli.c" 3 4
+                            0
+# 1642 "./src/main/cli/cli.c"
+                                 ;
+        if (defaultChannelRangeConfigs) {
+            equalsDefault = !memcmp(&channelRangeConfigs[i], &defaultChannelRangeConfigs[i], sizeof(channelRangeConfigs[i]));
+            headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                i,
+                defaultChannelRangeConfigs[i].min,
+                defaultChannelRangeConfigs[i].max
+            );
+        }
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            i,
+            channelRangeConfigs[i].min,
+            channelRangeConfigs[i].max
+        );
+    }
+}
+
+static void cliRxRange(char *cmdline)
+{
+    const char *format = "rxrange %u %u %u";
+    int i, validArgumentCount = 0;
+    const char *ptr;
+
+    if (isEmpty(cmdline)) {
+        printRxRange(DUMP_MASTER, rxChannelRangeConfigs(0), 
+# 1667 "./src/main/cli/cli.c" 3 4
+                                                           ((void *)0)
+# 1667 "./src/main/cli/cli.c"
+                                                               , 
+# 1667 "./src/main/cli/cli.c" 3 4
+                                                                 ((void *)0)
+# 1667 "./src/main/cli/cli.c"
+                                                                     );
+    } else if (strcasecmp(cmdline, "reset") == 0) {
+        resetAllRxChannelRangeConfigurations(rxChannelRangeConfigsMutable(0));
+    } else {
+        ptr = cmdline;
+        i = atoi(ptr);
+        if (i >= 0 && i < 4) {
+            int rangeMin = 750, rangeMax = 2250;
+
+            ptr = nextArg(ptr);
+            if (ptr) {
+                rangeMin = atoi(ptr);
+                validArgumentCount++;
+            }
+
+            ptr = nextArg(ptr);
+            if (ptr) {
+                rangeMax = atoi(ptr);
+                validArgumentCount++;
+            }
+
+            if (validArgumentCount != 2) {
+                cliShowParseError();
+            } else if (rangeMin < 750 || rangeMin > 2250 || rangeMax < 750 || rangeMax > 2250) {
+                cliShowParseError();
+            } else {
+                rxChannelRangeConfig_t *channelRangeConfig = rxChannelRangeConfigsMutable(i);
+                channelRangeConfig->min = rangeMin;
+                channelRangeConfig->max = rangeMax;
+                cliDumpPrintLinef(0, 
+# 1696 "./src/main/cli/cli.c" 3 4
+                                    0
+# 1696 "./src/main/cli/cli.c"
+                                         , format,
+                    i,
+                    channelRangeConfig->min,
+                    channelRangeConfig->max
+                );
+
+            }
+        } else {
+            cliShowArgumentRangeError("CHANNEL", 0, 4 - 1);
+        }
+    }
+}
+# 1871 "./src/main/cli/cli.c"
+static void printServo(dumpFlags_t dumpMask, const servoParam_t *servoParams, const servoParam_t *defaultServoParams, const char *headingStr)
+{
+
+    const char *format = "servo %u %d %d %d %d %d";
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 1875 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 1875 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (uint32_t i = 0; i < 8; i++) {
+        const servoParam_t *servoConf = &servoParams[i];
+        
+# 1878 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 1878 "./src/main/cli/cli.c"
+            equalsDefault = 
+# 1878 "./src/main/cli/cli.c" 3 4
+                            0
+# 1878 "./src/main/cli/cli.c"
+                                 ;
+        if (defaultServoParams) {
+            const servoParam_t *defaultServoConf = &defaultServoParams[i];
+            equalsDefault = !memcmp(servoConf, defaultServoConf, sizeof(*servoConf));
+            headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                i,
+                defaultServoConf->min,
+                defaultServoConf->max,
+                defaultServoConf->middle,
+                defaultServoConf->rate,
+                defaultServoConf->forwardFromChannel
+            );
+        }
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            i,
+            servoConf->min,
+            servoConf->max,
+            servoConf->middle,
+            servoConf->rate,
+            servoConf->forwardFromChannel
+        );
+    }
+
+    for (uint32_t i = 0; i < 8; i++) {
+        const char *format = "smix reverse %d %d r";
+        const servoParam_t *servoConf = &servoParams[i];
+        const servoParam_t *servoConfDefault = &defaultServoParams[i];
+        if (defaultServoParams) {
+            
+# 1907 "./src/main/cli/cli.c" 3 4
+           _Bool 
+# 1907 "./src/main/cli/cli.c"
+                equalsDefault = servoConf->reversedSources == servoConfDefault->reversedSources;
+            for (uint32_t channel = 0; channel < INPUT_SOURCE_COUNT; channel++) {
+                equalsDefault = ~(servoConf->reversedSources ^ servoConfDefault->reversedSources) & (1 << channel);
+                if (servoConfDefault->reversedSources & (1 << channel)) {
+                    cliDefaultPrintLinef(dumpMask, equalsDefault, format, i , channel);
+                }
+                if (servoConf->reversedSources & (1 << channel)) {
+                    cliDumpPrintLinef(dumpMask, equalsDefault, format, i , channel);
+                }
+            }
+        } else {
+            for (uint32_t channel = 0; channel < INPUT_SOURCE_COUNT; channel++) {
+                if (servoConf->reversedSources & (1 << channel)) {
+                    cliDumpPrintLinef(dumpMask, 
+# 1920 "./src/main/cli/cli.c" 3 4
+                                               1
+# 1920 "./src/main/cli/cli.c"
+                                                   , format, i , channel);
+                }
+            }
+        }
+    }
+}
+
+static void cliServo(char *cmdline)
+{
+    const char *format = "servo %u %d %d %d %d %d";
+    enum { SERVO_ARGUMENT_COUNT = 6 };
+    int16_t arguments[SERVO_ARGUMENT_COUNT];
+
+    servoParam_t *servo;
+
+    int i;
+    char *ptr;
+
+    if (isEmpty(cmdline)) {
+        printServo(DUMP_MASTER, servoParams(0), 
+# 1939 "./src/main/cli/cli.c" 3 4
+                                               ((void *)0)
+# 1939 "./src/main/cli/cli.c"
+                                                   , 
+# 1939 "./src/main/cli/cli.c" 3 4
+                                                     ((void *)0)
+# 1939 "./src/main/cli/cli.c"
+                                                         );
+    } else {
+        int validArgumentCount = 0;
+
+        ptr = cmdline;
+
+
+
+
+        while (*ptr) {
+            if (*ptr == '-' || (*ptr >= '0' && *ptr <= '9')) {
+                if (validArgumentCount >= SERVO_ARGUMENT_COUNT) {
+                    cliShowParseError();
+                    return;
+                }
+
+                arguments[validArgumentCount++] = atoi(ptr);
+
+                do {
+                    ptr++;
+                } while (*ptr >= '0' && *ptr <= '9');
+            } else if (*ptr == ' ') {
+                ptr++;
+            } else {
+                cliShowParseError();
+                return;
+            }
+        }
+
+        enum {INDEX = 0, MIN, MAX, MIDDLE, RATE, FORWARD};
+
+        i = arguments[INDEX];
+
+
+        if (validArgumentCount != SERVO_ARGUMENT_COUNT || i < 0 || i >= 8) {
+            cliShowParseError();
+            return;
+        }
+
+        servo = servoParamsMutable(i);
+
+        if (
+            arguments[MIN] < 750 || arguments[MIN] > 2250 ||
+            arguments[MAX] < 750 || arguments[MAX] > 2250 ||
+            arguments[MIDDLE] < arguments[MIN] || arguments[MIDDLE] > arguments[MAX] ||
+            arguments[MIN] > arguments[MAX] || arguments[MAX] < arguments[MIN] ||
+            arguments[RATE] < -100 || arguments[RATE] > 100 ||
+            arguments[FORWARD] >= 18
+        ) {
+            cliShowParseError();
+            return;
+        }
+
+        servo->min = arguments[MIN];
+        servo->max = arguments[MAX];
+        servo->middle = arguments[MIDDLE];
+        servo->rate = arguments[RATE];
+        servo->forwardFromChannel = arguments[FORWARD];
+
+        cliDumpPrintLinef(0, 
+# 1998 "./src/main/cli/cli.c" 3 4
+                            0
+# 1998 "./src/main/cli/cli.c"
+                                 , format,
+            i,
+            servo->min,
+            servo->max,
+            servo->middle,
+            servo->rate,
+            servo->forwardFromChannel
+        );
+
+    }
+}
+
+
+
+static void printServoMix(dumpFlags_t dumpMask, const servoMixer_t *customServoMixers, const servoMixer_t *defaultCustomServoMixers, const char *headingStr)
+{
+    const char *format = "smix %d %d %d %d %d %d %d %d";
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 2015 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 2015 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (uint32_t i = 0; i < (2 * 8); i++) {
+        const servoMixer_t customServoMixer = customServoMixers[i];
+        if (customServoMixer.rate == 0) {
+            break;
+        }
+
+        
+# 2022 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 2022 "./src/main/cli/cli.c"
+            equalsDefault = 
+# 2022 "./src/main/cli/cli.c" 3 4
+                            0
+# 2022 "./src/main/cli/cli.c"
+                                 ;
+        if (defaultCustomServoMixers) {
+            servoMixer_t customServoMixerDefault = defaultCustomServoMixers[i];
+            equalsDefault = !memcmp(&customServoMixer, &customServoMixerDefault, sizeof(customServoMixer));
+
+            headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                i,
+                customServoMixerDefault.targetChannel,
+                customServoMixerDefault.inputSource,
+                customServoMixerDefault.rate,
+                customServoMixerDefault.speed,
+                customServoMixerDefault.min,
+                customServoMixerDefault.max,
+                customServoMixerDefault.box
+            );
+        }
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            i,
+            customServoMixer.targetChannel,
+            customServoMixer.inputSource,
+            customServoMixer.rate,
+            customServoMixer.speed,
+            customServoMixer.min,
+            customServoMixer.max,
+            customServoMixer.box
+        );
+    }
+}
+
+static void cliServoMix(char *cmdline)
+{
+    int args[8], check = 0;
+    int len = strlen(cmdline);
+
+    if (len == 0) {
+        printServoMix(DUMP_MASTER, customServoMixers(0), 
+# 2058 "./src/main/cli/cli.c" 3 4
+                                                        ((void *)0)
+# 2058 "./src/main/cli/cli.c"
+                                                            , 
+# 2058 "./src/main/cli/cli.c" 3 4
+                                                              ((void *)0)
+# 2058 "./src/main/cli/cli.c"
+                                                                  );
+    } else if (strncasecmp(cmdline, "reset", 5) == 0) {
+
+        memset(customServoMixers_array(), 0, sizeof(*customServoMixers_array()));
+        for (uint32_t i = 0; i < 8; i++) {
+            servoParamsMutable(i)->reversedSources = 0;
+        }
+    } else if (strncasecmp(cmdline, "load", 4) == 0) {
+        const char *ptr = nextArg(cmdline);
+        if (ptr) {
+            len = strlen(ptr);
+            for (uint32_t i = 0; ; i++) {
+                if (mixerNames[i] == 
+# 2070 "./src/main/cli/cli.c" 3 4
+                                    ((void *)0)
+# 2070 "./src/main/cli/cli.c"
+                                        ) {
+                    cliPrintErrorLinef("INVALID NAME");
+                    break;
+                }
+                if (strncasecmp(ptr, mixerNames[i], len) == 0) {
+                    servoMixerLoadMix(i);
+                    cliPrintLinef("Loaded %s", mixerNames[i]);
+                    cliServoMix("");
+                    break;
+                }
+            }
+        }
+    } else if (strncasecmp(cmdline, "reverse", 7) == 0) {
+        enum {SERVO = 0, INPUT, REVERSE, ARGS_COUNT};
+        char *ptr = strchr(cmdline, ' ');
+
+        if (ptr == 
+# 2086 "./src/main/cli/cli.c" 3 4
+                  ((void *)0)
+# 2086 "./src/main/cli/cli.c"
+                      ) {
+            cliPrintf("s");
+            for (uint32_t inputSource = 0; inputSource < INPUT_SOURCE_COUNT; inputSource++)
+                cliPrintf("\ti%d", inputSource);
+            cliPrintLinefeed();
+
+            for (uint32_t servoIndex = 0; servoIndex < 8; servoIndex++) {
+                cliPrintf("%d", servoIndex);
+                for (uint32_t inputSource = 0; inputSource < INPUT_SOURCE_COUNT; inputSource++) {
+                    cliPrintf("\t%s  ", (servoParams(servoIndex)->reversedSources & (1 << inputSource)) ? "r" : "n");
+                }
+                cliPrintLinefeed();
+            }
+            return;
+        }
+
+        char *saveptr;
+        ptr = strtok_r(ptr, " ", &saveptr);
+        while (ptr != 
+# 2104 "./src/main/cli/cli.c" 3 4
+                     ((void *)0) 
+# 2104 "./src/main/cli/cli.c"
+                          && check < ARGS_COUNT - 1) {
+            args[check++] = atoi(ptr);
+            ptr = strtok_r(
+# 2106 "./src/main/cli/cli.c" 3 4
+                          ((void *)0)
+# 2106 "./src/main/cli/cli.c"
+                              , " ", &saveptr);
+        }
+
+        if (ptr == 
+# 2109 "./src/main/cli/cli.c" 3 4
+                  ((void *)0) 
+# 2109 "./src/main/cli/cli.c"
+                       || check != ARGS_COUNT - 1) {
+            cliShowParseError();
+            return;
+        }
+
+        if (args[SERVO] >= 0 && args[SERVO] < 8
+                && args[INPUT] >= 0 && args[INPUT] < INPUT_SOURCE_COUNT
+                && (*ptr == 'r' || *ptr == 'n')) {
+            if (*ptr == 'r') {
+                servoParamsMutable(args[SERVO])->reversedSources |= 1 << args[INPUT];
+            } else {
+                servoParamsMutable(args[SERVO])->reversedSources &= ~(1 << args[INPUT]);
+            }
+        } else {
+            cliShowParseError();
+            return;
+        }
+
+        cliServoMix("reverse");
+    } else {
+        enum {RULE = 0, TARGET, INPUT, RATE, SPEED, MIN, MAX, BOX, ARGS_COUNT};
+        char *saveptr;
+        char *ptr = strtok_r(cmdline, " ", &saveptr);
+        while (ptr != 
+# 2132 "./src/main/cli/cli.c" 3 4
+                     ((void *)0) 
+# 2132 "./src/main/cli/cli.c"
+                          && check < ARGS_COUNT) {
+            args[check++] = atoi(ptr);
+            ptr = strtok_r(
+# 2134 "./src/main/cli/cli.c" 3 4
+                          ((void *)0)
+# 2134 "./src/main/cli/cli.c"
+                              , " ", &saveptr);
+        }
+
+        if (ptr != 
+# 2137 "./src/main/cli/cli.c" 3 4
+                  ((void *)0) 
+# 2137 "./src/main/cli/cli.c"
+                       || check != ARGS_COUNT) {
+            cliShowParseError();
+            return;
+        }
+
+        int32_t i = args[RULE];
+        if (i >= 0 && i < (2 * 8) &&
+            args[TARGET] >= 0 && args[TARGET] < 8 &&
+            args[INPUT] >= 0 && args[INPUT] < INPUT_SOURCE_COUNT &&
+            args[RATE] >= -100 && args[RATE] <= 100 &&
+            args[SPEED] >= 0 && args[SPEED] <= 
+# 2147 "./src/main/cli/cli.c" 3 4
+                                              (255) 
+# 2147 "./src/main/cli/cli.c"
+                                                              &&
+            args[MIN] >= 0 && args[MIN] <= 100 &&
+            args[MAX] >= 0 && args[MAX] <= 100 && args[MIN] < args[MAX] &&
+            args[BOX] >= 0 && args[BOX] <= 3) {
+            customServoMixersMutable(i)->targetChannel = args[TARGET];
+            customServoMixersMutable(i)->inputSource = args[INPUT];
+            customServoMixersMutable(i)->rate = args[RATE];
+            customServoMixersMutable(i)->speed = args[SPEED];
+            customServoMixersMutable(i)->min = args[MIN];
+            customServoMixersMutable(i)->max = args[MAX];
+            customServoMixersMutable(i)->box = args[BOX];
+            cliServoMix("");
+        } else {
+            cliShowParseError();
+        }
+    }
+}
+
+
+
+
+static void cliWriteBytes(const uint8_t *buffer, int count)
+{
+    while (count > 0) {
+        cliWrite(*buffer);
+        buffer++;
+        count--;
+    }
+}
+
+static void cliSdInfo(char *cmdline)
+{
+    (void)(cmdline);
+
+    cliPrint("SD card: ");
+
+    if (!sdcard_isInserted()) {
+        cliPrintLine("None inserted");
+        return;
+    }
+
+    if (!sdcard_isFunctional() || !sdcard_isInitialized()) {
+        cliPrintLine("Startup failed");
+        return;
+    }
+
+    const sdcardMetadata_t *metadata = sdcard_getMetadata();
+
+    cliPrintf("Manufacturer 0x%x, %ukB, %02d/%04d, v%d.%d, '",
+        metadata->manufacturerID,
+        metadata->numBlocks / 2,
+        metadata->productionMonth,
+        metadata->productionYear,
+        metadata->productRevisionMajor,
+        metadata->productRevisionMinor
+    );
+
+    cliWriteBytes((uint8_t*)metadata->productName, sizeof(metadata->productName));
+
+    cliPrint("'\r\n" "Filesystem: ");
+
+    switch (afatfs_getFilesystemState()) {
+    case AFATFS_FILESYSTEM_STATE_READY:
+        cliPrint("Ready");
+        break;
+    case AFATFS_FILESYSTEM_STATE_INITIALIZATION:
+        cliPrint("Initializing");
+        break;
+    case AFATFS_FILESYSTEM_STATE_UNKNOWN:
+    case AFATFS_FILESYSTEM_STATE_FATAL:
+        cliPrint("Fatal");
+
+        switch (afatfs_getLastError()) {
+        case AFATFS_ERROR_BAD_MBR:
+            cliPrint(" - no FAT MBR partitions");
+            break;
+        case AFATFS_ERROR_BAD_FILESYSTEM_HEADER:
+            cliPrint(" - bad FAT header");
+            break;
+        case AFATFS_ERROR_GENERIC:
+        case AFATFS_ERROR_NONE:
+            ;
+            break;
+        }
+        break;
+    }
+    cliPrintLinefeed();
+}
+
+
+
+
+
+static void cliFlashInfo(char *cmdline)
+{
+    const flashGeometry_t *layout = flashGetGeometry();
+
+    (void)(cmdline);
+
+    cliPrintLinef("Flash sectors=%u, sectorSize=%u, pagesPerSector=%u, pageSize=%u, totalSize=%u",
+            layout->sectors, layout->sectorSize, layout->pagesPerSector, layout->pageSize, layout->totalSize);
+
+    for (uint8_t index = 0; index < FLASH_MAX_PARTITIONS; index++) {
+        const flashPartition_t *partition;
+        if (index == 0) {
+            cliPrintLine("Paritions:");
+        }
+        partition = flashPartitionFindByIndex(index);
+        if (!partition) {
+            break;
+        }
+        cliPrintLinef("  %d: %s %u %u", index, flashPartitionGetTypeName(partition->type), partition->startSector, partition->endSector);
+    }
+
+    const flashPartition_t *flashPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS);
+
+    cliPrintLinef("FlashFS size=%u, usedSize=%u",
+            (flashPartition->endSector + 1 - flashPartition->startSector) * layout->sectorSize,
+            flashfsGetOffset()
+    );
+
+}
+
+
+static void cliFlashErase(char *cmdline)
+{
+    (void)(cmdline);
+
+    if (!flashfsIsSupported()) {
+        return;
+    }
+
+
+    uint32_t i = 0;
+    cliPrintLine("Erasing, please wait ... ");
+
+
+
+
+    bufWriterFlush(cliWriter);
+    flashfsEraseCompletely();
+
+    while (!flashfsIsReady()) {
+
+        cliPrintf(".");
+        if (i++ > 120) {
+            i=0;
+            cliPrintLinefeed();
+        }
+
+        bufWriterFlush(cliWriter);
+
+        delay(100);
+    }
+    beeper(BEEPER_BLACKBOX_ERASE);
+    cliPrintLinefeed();
+    cliPrintLine("Done.");
+}
+# 2482 "./src/main/cli/cli.c"
+static char *formatVtxTableBandFrequency(const uint16_t *frequency, int channels)
+{
+    static char freqbuf[5 * 8 + 1];
+    char freqtmp[5 + 1];
+    freqbuf[0] = 0;
+    for (int channel = 0; channel < channels; channel++) {
+        tfp_sprintf(freqtmp, " %4d", frequency[channel]);
+        strcat(freqbuf, freqtmp);
+    }
+    return freqbuf;
+}
+
+static const char *printVtxTableBand(dumpFlags_t dumpMask, int band, const vtxTableConfig_t *currentConfig, const vtxTableConfig_t *defaultConfig, const char *headingStr)
+{
+    char *fmt = "vtxtable band %d %s %c%s";
+    
+# 2497 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 2497 "./src/main/cli/cli.c"
+        equalsDefault = 
+# 2497 "./src/main/cli/cli.c" 3 4
+                        0
+# 2497 "./src/main/cli/cli.c"
+                             ;
+
+    if (defaultConfig) {
+        equalsDefault = 
+# 2500 "./src/main/cli/cli.c" 3 4
+                       1
+# 2500 "./src/main/cli/cli.c"
+                           ;
+        if (strcasecmp(currentConfig->bandNames[band], defaultConfig->bandNames[band])) {
+            equalsDefault = 
+# 2502 "./src/main/cli/cli.c" 3 4
+                           0
+# 2502 "./src/main/cli/cli.c"
+                                ;
+        }
+        if (currentConfig->bandLetters[band] != defaultConfig->bandLetters[band]) {
+            equalsDefault = 
+# 2505 "./src/main/cli/cli.c" 3 4
+                           0
+# 2505 "./src/main/cli/cli.c"
+                                ;
+        }
+        for (int channel = 0; channel < 8; channel++) {
+            if (currentConfig->frequency[band][channel] != defaultConfig->frequency[band][channel]) {
+                equalsDefault = 
+# 2509 "./src/main/cli/cli.c" 3 4
+                               0
+# 2509 "./src/main/cli/cli.c"
+                                    ;
+              }
+        }
+        headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+        char *freqbuf = formatVtxTableBandFrequency(defaultConfig->frequency[band], defaultConfig->channels);
+        cliDefaultPrintLinef(dumpMask, equalsDefault, fmt, band + 1, defaultConfig->bandNames[band], defaultConfig->bandLetters[band], freqbuf);
+    }
+
+    char *freqbuf = formatVtxTableBandFrequency(currentConfig->frequency[band], currentConfig->channels);
+    cliDumpPrintLinef(dumpMask, equalsDefault, fmt, band + 1, currentConfig->bandNames[band], currentConfig->bandLetters[band], freqbuf);
+    return headingStr;
+}
+
+static char *formatVtxTablePowerValues(const uint16_t *levels, int count)
+{
+
+    static char pwrbuf[5 * 8 + 1];
+    char pwrtmp[5 + 1];
+    pwrbuf[0] = 0;
+    for (int pwrindex = 0; pwrindex < count; pwrindex++) {
+        tfp_sprintf(pwrtmp, " %d", levels[pwrindex]);
+        strcat(pwrbuf, pwrtmp);
+    }
+    return pwrbuf;
+}
+
+static const char *printVtxTablePowerValues(dumpFlags_t dumpMask, const vtxTableConfig_t *currentConfig, const vtxTableConfig_t *defaultConfig, const char *headingStr)
+{
+    char *fmt = "vtxtable powervalues %s";
+    
+# 2538 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 2538 "./src/main/cli/cli.c"
+        equalsDefault = 
+# 2538 "./src/main/cli/cli.c" 3 4
+                        0
+# 2538 "./src/main/cli/cli.c"
+                             ;
+    if (defaultConfig) {
+        equalsDefault = 
+# 2540 "./src/main/cli/cli.c" 3 4
+                       1
+# 2540 "./src/main/cli/cli.c"
+                           ;
+        for (int pwrindex = 0; pwrindex < 8; pwrindex++) {
+            if (defaultConfig->powerValues[pwrindex] != currentConfig->powerValues[pwrindex]) {
+                equalsDefault = 
+# 2543 "./src/main/cli/cli.c" 3 4
+                               0
+# 2543 "./src/main/cli/cli.c"
+                                    ;
+            }
+        }
+        headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+        char *pwrbuf = formatVtxTablePowerValues(defaultConfig->powerValues, 8);
+        cliDefaultPrintLinef(dumpMask, equalsDefault, fmt, pwrbuf);
+    }
+
+    char *pwrbuf = formatVtxTablePowerValues(currentConfig->powerValues, currentConfig->powerLevels);
+    cliDumpPrintLinef(dumpMask, equalsDefault, fmt, pwrbuf);
+    return headingStr;
+}
+
+static char *formatVtxTablePowerLabels(const char labels[8][3 + 1], int count)
+{
+    static char pwrbuf[(3 + 1) * 8 + 1];
+    char pwrtmp[(3 + 1) + 1];
+    pwrbuf[0] = 0;
+    for (int pwrindex = 0; pwrindex < count; pwrindex++) {
+        strcat(pwrbuf, " ");
+        strcpy(pwrtmp, labels[pwrindex]);
+
+        char *sp;
+        while ((sp = strchr(pwrtmp, ' '))) {
+            *sp = 0;
+        }
+        strcat(pwrbuf, pwrtmp);
+    }
+    return pwrbuf;
+}
+
+static const char *printVtxTablePowerLabels(dumpFlags_t dumpMask, const vtxTableConfig_t *currentConfig, const vtxTableConfig_t *defaultConfig, const char *headingStr)
+{
+    char *fmt = "vtxtable powerlabels%s";
+    
+# 2577 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 2577 "./src/main/cli/cli.c"
+        equalsDefault = 
+# 2577 "./src/main/cli/cli.c" 3 4
+                        0
+# 2577 "./src/main/cli/cli.c"
+                             ;
+    if (defaultConfig) {
+        equalsDefault = 
+# 2579 "./src/main/cli/cli.c" 3 4
+                       1
+# 2579 "./src/main/cli/cli.c"
+                           ;
+        for (int pwrindex = 0; pwrindex < 8; pwrindex++) {
+            if (strcasecmp(defaultConfig->powerLabels[pwrindex], currentConfig->powerLabels[pwrindex])) {
+                equalsDefault = 
+# 2582 "./src/main/cli/cli.c" 3 4
+                               0
+# 2582 "./src/main/cli/cli.c"
+                                    ;
+            }
+        }
+        headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+        char *pwrbuf = formatVtxTablePowerLabels(defaultConfig->powerLabels, 8);
+        cliDefaultPrintLinef(dumpMask, equalsDefault, fmt, pwrbuf);
+    }
+
+    char *pwrbuf = formatVtxTablePowerLabels(currentConfig->powerLabels, currentConfig->powerLevels);
+    cliDumpPrintLinef(dumpMask, equalsDefault, fmt, pwrbuf);
+    return headingStr;
+}
+
+static void printVtxTable(dumpFlags_t dumpMask, const vtxTableConfig_t *currentConfig, const vtxTableConfig_t *defaultConfig, const char *headingStr)
+{
+    
+# 2597 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 2597 "./src/main/cli/cli.c"
+        equalsDefault;
+    char *fmt;
+
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 2600 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 2600 "./src/main/cli/cli.c"
+                                                      , headingStr);
+
+
+    equalsDefault = 
+# 2603 "./src/main/cli/cli.c" 3 4
+                   0
+# 2603 "./src/main/cli/cli.c"
+                        ;
+    fmt = "vtxtable bands %d";
+    if (defaultConfig) {
+        equalsDefault = (defaultConfig->bands == currentConfig->bands);
+        headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+        cliDefaultPrintLinef(dumpMask, equalsDefault, fmt, defaultConfig->bands);
+    }
+    cliDumpPrintLinef(dumpMask, equalsDefault, fmt, currentConfig->bands);
+
+
+    equalsDefault = 
+# 2613 "./src/main/cli/cli.c" 3 4
+                   0
+# 2613 "./src/main/cli/cli.c"
+                        ;
+    fmt = "vtxtable channels %d";
+    if (defaultConfig) {
+        equalsDefault = (defaultConfig->channels == currentConfig->channels);
+        headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+        cliDefaultPrintLinef(dumpMask, equalsDefault, fmt, defaultConfig->channels);
+    }
+    cliDumpPrintLinef(dumpMask, equalsDefault, fmt, currentConfig->channels);
+
+
+
+    for (int band = 0; band < currentConfig->bands; band++) {
+        headingStr = printVtxTableBand(dumpMask, band, currentConfig, defaultConfig, headingStr);
+    }
+
+
+
+    equalsDefault = 
+# 2630 "./src/main/cli/cli.c" 3 4
+                   0
+# 2630 "./src/main/cli/cli.c"
+                        ;
+    fmt = "vtxtable powerlevels %d";
+    if (defaultConfig) {
+        equalsDefault = (defaultConfig->powerLevels == currentConfig->powerLevels);
+        headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+        cliDefaultPrintLinef(dumpMask, equalsDefault, fmt, defaultConfig->powerLevels);
+    }
+    cliDumpPrintLinef(dumpMask, equalsDefault, fmt, currentConfig->powerLevels);
+
+
+
+
+    headingStr = printVtxTablePowerValues(dumpMask, currentConfig, defaultConfig, headingStr);
+    headingStr = printVtxTablePowerLabels(dumpMask, currentConfig, defaultConfig, headingStr);
+}
+
+static void cliVtxTable(char *cmdline)
+{
+    char *tok;
+    char *saveptr;
+
+
+    tok = strtok_r(cmdline, " ", &saveptr);
+
+    if (!tok) {
+        printVtxTable(DUMP_MASTER | HIDE_UNUSED, vtxTableConfigMutable(), 
+# 2655 "./src/main/cli/cli.c" 3 4
+                                                                         ((void *)0)
+# 2655 "./src/main/cli/cli.c"
+                                                                             , 
+# 2655 "./src/main/cli/cli.c" 3 4
+                                                                               ((void *)0)
+# 2655 "./src/main/cli/cli.c"
+                                                                                   );
+        return;
+    }
+
+    if (strcasecmp(tok, "bands") == 0) {
+        tok = strtok_r(
+# 2660 "./src/main/cli/cli.c" 3 4
+                      ((void *)0)
+# 2660 "./src/main/cli/cli.c"
+                          , " ", &saveptr);
+        int bands = atoi(tok);
+        if (bands < 0 || bands > 8) {
+            cliPrintErrorLinef("INVALID BAND COUNT (SHOULD BE BETWEEN 0 AND %d)", 8);
+            return;
+        }
+        if (bands < vtxTableConfigMutable()->bands) {
+            for (int i = bands; i < vtxTableConfigMutable()->bands; i++) {
+                vtxTableConfigClearBand(vtxTableConfigMutable(), i);
+             }
+        }
+        vtxTableConfigMutable()->bands = bands;
+
+    } else if (strcasecmp(tok, "channels") == 0) {
+        tok = strtok_r(
+# 2674 "./src/main/cli/cli.c" 3 4
+                      ((void *)0)
+# 2674 "./src/main/cli/cli.c"
+                          , " ", &saveptr);
+
+        int channels = atoi(tok);
+        if (channels < 0 || channels > 8) {
+            cliPrintErrorLinef("INVALID CHANNEL COUNT (SHOULD BE BETWEEN 0 AND %d)", 8);
+            return;
+        }
+        if (channels < vtxTableConfigMutable()->channels) {
+            for (int i = 0; i < 8; i++) {
+                vtxTableConfigClearChannels(vtxTableConfigMutable(), i, channels);
+            }
+        }
+        vtxTableConfigMutable()->channels = channels;
+
+    } else if (strcasecmp(tok, "powerlevels") == 0) {
+
+        tok = strtok_r(
+# 2690 "./src/main/cli/cli.c" 3 4
+                      ((void *)0)
+# 2690 "./src/main/cli/cli.c"
+                          , " ", &saveptr);
+        if (tok) {
+            int levels = atoi(tok);
+            if (levels < 0 || levels > 8) {
+                cliPrintErrorLinef("INVALID POWER LEVEL COUNT (SHOULD BE BETWEEN 0 AND %d)", 8);
+            } else {
+                if (levels < vtxTableConfigMutable()->powerLevels) {
+                    vtxTableConfigClearPowerValues(vtxTableConfigMutable(), levels);
+                    vtxTableConfigClearPowerLabels(vtxTableConfigMutable(), levels);
+                }
+                vtxTableConfigMutable()->powerLevels = levels;
+            }
+        } else {
+
+        }
+        return;
+
+    } else if (strcasecmp(tok, "powervalues") == 0) {
+
+        uint16_t power[8];
+        int count;
+        int levels = vtxTableConfigMutable()->powerLevels;
+
+        memset(power, 0, sizeof(power));
+
+        for (count = 0; count < levels && (tok = strtok_r(
+# 2715 "./src/main/cli/cli.c" 3 4
+                                                         ((void *)0)
+# 2715 "./src/main/cli/cli.c"
+                                                             , " ", &saveptr)); count++) {
+            int value = atoi(tok);
+            power[count] = value;
+        }
+
+
+
+        if (count < levels) {
+            cliPrintErrorLinef("NOT ENOUGH VALUES (EXPECTED %d)", levels);
+            return;
+        } else if ((tok = strtok_r(
+# 2725 "./src/main/cli/cli.c" 3 4
+                                  ((void *)0)
+# 2725 "./src/main/cli/cli.c"
+                                      , " ", &saveptr))) {
+            cliPrintErrorLinef("TOO MANY VALUES (EXPECTED %d)", levels);
+            return;
+        }
+
+        for (int i = 0; i < 8; i++) {
+            vtxTableConfigMutable()->powerValues[i] = power[i];
+        }
+
+    } else if (strcasecmp(tok, "powerlabels") == 0) {
+
+        char label[8][3 + 1];
+        int levels = vtxTableConfigMutable()->powerLevels;
+        int count;
+        for (count = 0; count < levels && (tok = strtok_r(
+# 2739 "./src/main/cli/cli.c" 3 4
+                                                         ((void *)0)
+# 2739 "./src/main/cli/cli.c"
+                                                             , " ", &saveptr)); count++) {
+            strncpy(label[count], tok, 3);
+            for (unsigned i = 0; i < strlen(label[count]); i++) {
+                label[count][i] = toupper(label[count][i]);
+            }
+        }
+
+
+
+        if (count < levels) {
+            cliPrintErrorLinef("NOT ENOUGH LABELS (EXPECTED %d)", levels);
+            return;
+        } else if ((tok = strtok_r(
+# 2751 "./src/main/cli/cli.c" 3 4
+                                  ((void *)0)
+# 2751 "./src/main/cli/cli.c"
+                                      , " ", &saveptr))) {
+            cliPrintErrorLinef("TOO MANY LABELS (EXPECTED %d)", levels);
+            return;
+        }
+
+        for (int i = 0; i < count; i++) {
+            vtxTableStrncpyWithPad(vtxTableConfigMutable()->powerLabels[i], label[i], 3);
+        }
+    } else if (strcasecmp(tok, "band") == 0) {
+
+        int bands = vtxTableConfigMutable()->bands;
+
+        tok = strtok_r(
+# 2763 "./src/main/cli/cli.c" 3 4
+                      ((void *)0)
+# 2763 "./src/main/cli/cli.c"
+                          , " ", &saveptr);
+        if (!tok) {
+            return;
+        }
+
+        int band = atoi(tok);
+        --band;
+
+        if (band < 0 || band >= bands) {
+            cliPrintErrorLinef("INVALID BAND NUMBER %s (EXPECTED 1-%d)", tok, bands);
+            return;
+        }
+
+
+        tok = strtok_r(
+# 2777 "./src/main/cli/cli.c" 3 4
+                       ((void *)0)
+# 2777 "./src/main/cli/cli.c"
+                           , " ", &saveptr);
+
+        if (!tok) {
+            return;
+        }
+
+        char bandname[8 + 1];
+        memset(bandname, 0, 8 + 1);
+        strncpy(bandname, tok, 8);
+        for (unsigned i = 0; i < strlen(bandname); i++) {
+            bandname[i] = toupper(bandname[i]);
+        }
+
+
+        tok = strtok_r(
+# 2791 "./src/main/cli/cli.c" 3 4
+                       ((void *)0)
+# 2791 "./src/main/cli/cli.c"
+                           , " ", &saveptr);
+
+        if (!tok) {
+            return;
+        }
+
+        char bandletter = toupper(tok[0]);
+
+        uint16_t bandfreq[8];
+        int channel = 0;
+        int channels = vtxTableConfigMutable()->channels;
+
+        for (channel = 0; channel < channels && (tok = strtok_r(
+# 2803 "./src/main/cli/cli.c" 3 4
+                                                                 ((void *)0)
+# 2803 "./src/main/cli/cli.c"
+                                                                     , " ", &saveptr)); channel++) {
+            int freq = atoi(tok);
+            if (freq < 0) {
+                cliPrintErrorLinef("INVALID FREQUENCY %s", tok);
+                return;
+            }
+            bandfreq[channel] = freq;
+        }
+
+        if (channel < channels) {
+            cliPrintErrorLinef("NOT ENOUGH FREQUENCIES (EXPECTED %d)", channels);
+            return;
+        } else if ((tok = strtok_r(
+# 2815 "./src/main/cli/cli.c" 3 4
+                                  ((void *)0)
+# 2815 "./src/main/cli/cli.c"
+                                      , " ", &saveptr))) {
+            cliPrintErrorLinef("TOO MANY FREQUENCIES (EXPECTED %d)", channels);
+            return;
+        }
+
+        vtxTableStrncpyWithPad(vtxTableConfigMutable()->bandNames[band], bandname, 8);
+        vtxTableConfigMutable()->bandLetters[band] = bandletter;
+
+        for (int i = 0; i < channel; i++) {
+            vtxTableConfigMutable()->frequency[band][i] = bandfreq[i];
+        }
+    } else {
+
+        cliPrintErrorLinef("INVALID SUBCOMMAND %s", tok);
+    }
+}
+
+
+static void printName(dumpFlags_t dumpMask, const pilotConfig_t *pilotConfig)
+{
+    const 
+# 2835 "./src/main/cli/cli.c" 3 4
+         _Bool 
+# 2835 "./src/main/cli/cli.c"
+              equalsDefault = strlen(pilotConfig->name) == 0;
+    cliDumpPrintLinef(dumpMask, equalsDefault, "\r\n# name: %s", equalsDefault ? emptyName : pilotConfig->name);
+}
+
+static void cliName(char *cmdline)
+{
+    const unsigned int len = strlen(cmdline);
+    
+# 2842 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 2842 "./src/main/cli/cli.c"
+        updated = 
+# 2842 "./src/main/cli/cli.c" 3 4
+                  0
+# 2842 "./src/main/cli/cli.c"
+                       ;
+    if (len > 0) {
+        memset(pilotConfigMutable()->name, 0, (sizeof(pilotConfig()->name) / sizeof((pilotConfig()->name)[0])));
+        if (strncmp(cmdline, emptyName, len)) {
+            strncpy(pilotConfigMutable()->name, cmdline, __extension__ ({ __typeof__ (len) _a = (len); __typeof__ (16u) _b = (16u); _a < _b ? _a : _b; }));
+        }
+        updated = 
+# 2848 "./src/main/cli/cli.c" 3 4
+                 1
+# 2848 "./src/main/cli/cli.c"
+                     ;
+    }
+    printName(DUMP_MASTER, pilotConfig());
+    if (updated) {
+        cliPrintLine("###WARNING: This command will be removed. Use 'set name = ' instead.###");
+    }
+}
+
+
+
+
+
+static void printBoardName(dumpFlags_t dumpMask)
+{
+    if (!(dumpMask & DO_DIFF) || strlen(getBoardName())) {
+        cliPrintLinef("board_name %s", getBoardName());
+    }
+}
+
+static void cliBoardName(char *cmdline)
+{
+    const unsigned int len = strlen(cmdline);
+    if (len > 0 && boardInformationIsSet() && (len != strlen(getBoardName()) || strncmp(getBoardName(), cmdline, len))) {
+        cliPrintErrorLinef("%s CANNOT BE CHANGED. CURRENT VALUE: '%s'", "BOARD_NAME", getBoardName());
+    } else {
+        if (len > 0) {
+            setBoardName(cmdline);
+            boardInformationUpdated = 
+# 2875 "./src/main/cli/cli.c" 3 4
+                                     1
+# 2875 "./src/main/cli/cli.c"
+                                         ;
+        }
+        printBoardName(DUMP_ALL);
+    }
+}
+
+static void printManufacturerId(dumpFlags_t dumpMask)
+{
+    if (!(dumpMask & DO_DIFF) || strlen(getManufacturerId())) {
+        cliPrintLinef("manufacturer_id %s", getManufacturerId());
+    }
+}
+
+static void cliManufacturerId(char *cmdline)
+{
+    const unsigned int len = strlen(cmdline);
+    if (len > 0 && boardInformationIsSet() && (len != strlen(getManufacturerId()) || strncmp(getManufacturerId(), cmdline, len))) {
+        cliPrintErrorLinef("%s CANNOT BE CHANGED. CURRENT VALUE: '%s'", "MANUFACTURER_ID", getManufacturerId());
+    } else {
+        if (len > 0) {
+            setManufacturerId(cmdline);
+            boardInformationUpdated = 
+# 2896 "./src/main/cli/cli.c" 3 4
+                                     1
+# 2896 "./src/main/cli/cli.c"
+                                         ;
+        }
+        printManufacturerId(DUMP_ALL);
+    }
+}
+
+
+static void writeSignature(char *signatureStr, uint8_t *signature)
+{
+    for (unsigned i = 0; i < 32; i++) {
+        tfp_sprintf(&signatureStr[2 * i], "%02x", signature[i]);
+    }
+}
+
+static void cliSignature(char *cmdline)
+{
+    const int len = strlen(cmdline);
+
+    uint8_t signature[32] = {0};
+    if (len > 0) {
+        if (len != 2 * 32) {
+            cliPrintErrorLinef("INVALID LENGTH: %d (EXPECTED: %d)", len, 2 * 32);
+
+            return;
+        }
+
+
+        for (unsigned i = 0; i < 32; i++) {
+            char temp[2 + 1];
+            strncpy(temp, &cmdline[i * 2], 2);
+            temp[2] = '\0';
+            char *end;
+            unsigned result = strtoul(temp, &end, 16);
+            if (end == &temp[2]) {
+                signature[i] = result;
+            } else {
+                cliPrintErrorLinef("INVALID CHARACTER FOUND: %c", end[0]);
+
+                return;
+            }
+        }
+
+    }
+
+    char signatureStr[32 * 2 + 1] = {0};
+    if (len > 0 && signatureIsSet() && memcmp(signature, getSignature(), 32)) {
+        writeSignature(signatureStr, getSignature());
+        cliPrintErrorLinef("%s CANNOT BE CHANGED. CURRENT VALUE: '%s'", "SIGNATURE", signatureStr);
+    } else {
+        if (len > 0) {
+            setSignature(signature);
+
+            signatureUpdated = 
+# 2948 "./src/main/cli/cli.c" 3 4
+                              1
+# 2948 "./src/main/cli/cli.c"
+                                  ;
+
+            writeSignature(signatureStr, getSignature());
+        } else if (signatureUpdated || signatureIsSet()) {
+            writeSignature(signatureStr, getSignature());
+        }
+
+        cliPrintLinef("signature %s", signatureStr);
+    }
+}
+
+
+
+
+
+
+static void cliMcuId(char *cmdline)
+{
+    (void)(cmdline);
+
+    cliPrintLinef("mcu_id %08x%08x%08x", 0, 1, 2);
+}
+
+static uint32_t getFeatureMask(const uint32_t featureMask)
+{
+    if (featureMaskIsCopied) {
+        return featureMaskCopy;
+    } else {
+        return featureMask;
+    }
+}
+
+static void printFeature(dumpFlags_t dumpMask, const featureConfig_t *featureConfig, const featureConfig_t *featureConfigDefault, const char *headingStr)
+{
+    const uint32_t mask = getFeatureMask(featureConfig->enabledFeatures);
+    const uint32_t defaultMask = featureConfigDefault->enabledFeatures;
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 2984 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 2984 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (uint32_t i = 0; featureNames[i]; i++) {
+        if (strcmp(featureNames[i], emptyString) != 0) {
+            const char *format = "feature -%s";
+            const 
+# 2988 "./src/main/cli/cli.c" 3 4
+                 _Bool 
+# 2988 "./src/main/cli/cli.c"
+                      equalsDefault = (~defaultMask | mask) & (1 << i);
+            headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+            cliDefaultPrintLinef(dumpMask, (defaultMask | ~mask) & (1 << i), format, featureNames[i]);
+            cliDumpPrintLinef(dumpMask, equalsDefault, format, featureNames[i]);
+        }
+    }
+    for (uint32_t i = 0; featureNames[i]; i++) {
+        if (strcmp(featureNames[i], emptyString) != 0) {
+            const char *format = "feature %s";
+            if (defaultMask & (1 << i)) {
+                cliDefaultPrintLinef(dumpMask, (~defaultMask | mask) & (1 << i), format, featureNames[i]);
+            }
+            if (mask & (1 << i)) {
+                const 
+# 3001 "./src/main/cli/cli.c" 3 4
+                     _Bool 
+# 3001 "./src/main/cli/cli.c"
+                          equalsDefault = (defaultMask | ~mask) & (1 << i);
+                headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+                cliDumpPrintLinef(dumpMask, equalsDefault, format, featureNames[i]);
+            }
+        }
+    }
+}
+
+static void cliFeature(char *cmdline)
+{
+    uint32_t len = strlen(cmdline);
+    const uint32_t mask = getFeatureMask(featureMask());
+    if (len == 0) {
+        cliPrint("Enabled: ");
+        for (uint32_t i = 0; ; i++) {
+            if (featureNames[i] == 
+# 3016 "./src/main/cli/cli.c" 3 4
+                                  ((void *)0)
+# 3016 "./src/main/cli/cli.c"
+                                      ) {
+                break;
+            }
+            if (mask & (1 << i)) {
+                cliPrintf("%s ", featureNames[i]);
+            }
+        }
+        cliPrintLinefeed();
+    } else if (strncasecmp(cmdline, "list", len) == 0) {
+        cliPrint("Available:");
+        for (uint32_t i = 0; ; i++) {
+            if (featureNames[i] == 
+# 3027 "./src/main/cli/cli.c" 3 4
+                                  ((void *)0)
+# 3027 "./src/main/cli/cli.c"
+                                      )
+                break;
+            if (strcmp(featureNames[i], emptyString) != 0)
+                cliPrintf(" %s", featureNames[i]);
+        }
+        cliPrintLinefeed();
+        return;
+    } else {
+        if (!featureMaskIsCopied) {
+            featureMaskCopy = featureMask();
+            featureMaskIsCopied = 
+# 3037 "./src/main/cli/cli.c" 3 4
+                                 1
+# 3037 "./src/main/cli/cli.c"
+                                     ;
+        }
+        uint32_t feature;
+
+        
+# 3041 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 3041 "./src/main/cli/cli.c"
+            remove = 
+# 3041 "./src/main/cli/cli.c" 3 4
+                     0
+# 3041 "./src/main/cli/cli.c"
+                          ;
+        if (cmdline[0] == '-') {
+
+            remove = 
+# 3044 "./src/main/cli/cli.c" 3 4
+                    1
+# 3044 "./src/main/cli/cli.c"
+                        ;
+            cmdline++;
+            len--;
+        }
+
+        for (uint32_t i = 0; ; i++) {
+            if (featureNames[i] == 
+# 3050 "./src/main/cli/cli.c" 3 4
+                                  ((void *)0)
+# 3050 "./src/main/cli/cli.c"
+                                      ) {
+                cliPrintErrorLinef("INVALID NAME");
+                break;
+            }
+
+            if (strncasecmp(cmdline, featureNames[i], len) == 0) {
+                feature = 1 << i;
+
+
+
+
+
+
+
+                if (feature & FEATURE_RANGEFINDER) {
+                    cliPrintLine("unavailable");
+                    break;
+                }
+
+                if (remove) {
+                    featureClear(feature, &featureMaskCopy);
+                    cliPrint("Disabled");
+                } else {
+                    featureSet(feature, &featureMaskCopy);
+                    cliPrint("Enabled");
+                }
+                cliPrintLinef(" %s", featureNames[i]);
+                break;
+            }
+        }
+    }
+}
+# 3212 "./src/main/cli/cli.c"
+static void printMap(dumpFlags_t dumpMask, const rxConfig_t *rxConfig, const rxConfig_t *defaultRxConfig, const char *headingStr)
+{
+    
+# 3214 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 3214 "./src/main/cli/cli.c"
+        equalsDefault = 
+# 3214 "./src/main/cli/cli.c" 3 4
+                        1
+# 3214 "./src/main/cli/cli.c"
+                            ;
+    char buf[16];
+    char bufDefault[16];
+    uint32_t i;
+
+    headingStr = cliPrintSectionHeading(dumpMask, 
+# 3219 "./src/main/cli/cli.c" 3 4
+                                                 0
+# 3219 "./src/main/cli/cli.c"
+                                                      , headingStr);
+    for (i = 0; i < 8; i++) {
+        buf[rxConfig->rcmap[i]] = rcChannelLetters[i];
+        if (defaultRxConfig) {
+            bufDefault[defaultRxConfig->rcmap[i]] = rcChannelLetters[i];
+            equalsDefault = equalsDefault && (rxConfig->rcmap[i] == defaultRxConfig->rcmap[i]);
+        }
+    }
+    buf[i] = '\0';
+
+    headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
+    const char *formatMap = "map %s";
+    if (defaultRxConfig) {
+        bufDefault[i] = '\0';
+        cliDefaultPrintLinef(dumpMask, equalsDefault, formatMap, bufDefault);
+    }
+    cliDumpPrintLinef(dumpMask, equalsDefault, formatMap, buf);
+}
+
+
+static void cliMap(char *cmdline)
+{
+    uint32_t i;
+    char buf[8 + 1];
+
+    uint32_t len = strlen(cmdline);
+    if (len == 8) {
+
+        for (i = 0; i < 8; i++) {
+            buf[i] = toupper((unsigned char)cmdline[i]);
+        }
+        buf[i] = '\0';
+
+        for (i = 0; i < 8; i++) {
+            buf[i] = toupper((unsigned char)cmdline[i]);
+
+            if (strchr(rcChannelLetters, buf[i]) && !strchr(buf + i + 1, buf[i]))
+                continue;
+
+            cliShowParseError();
+            return;
+        }
+        parseRcChannels(buf, rxConfigMutable());
+    } else if (len > 0) {
+        cliShowParseError();
+        return;
+    }
+
+    for (i = 0; i < 8; i++) {
+        buf[rxConfig()->rcmap[i]] = rcChannelLetters[i];
+    }
+
+    buf[i] = '\0';
+    cliPrintLinef("map %s", buf);
+}
+
+static char *skipSpace(char *buffer)
+{
+    while (*(buffer) == ' ') {
+        buffer++;
+    }
+
+    return buffer;
+}
+
+static char *checkCommand(char *cmdline, const char *command)
+{
+    if (!strncasecmp(cmdline, command, strlen(command))
+        && (isspace((unsigned)cmdline[strlen(command)]) || cmdline[strlen(command)] == 0)) {
+        return skipSpace(cmdline + strlen(command) + 1);
+    } else {
+        return 0;
+    }
+}
+
+static void cliRebootEx(
+# 3294 "./src/main/cli/cli.c" 3 4
+                       _Bool 
+# 3294 "./src/main/cli/cli.c"
+                            bootLoader)
+{
+    cliPrint("\r\nRebooting");
+    bufWriterFlush(cliWriter);
+    waitForSerialPortToFinishTransmitting(cliPort);
+    stopPwmAllMotors();
+    if (bootLoader) {
+        systemResetToBootloader();
+        return;
+    }
+    systemReset();
+}
+
+static void cliReboot(void)
+{
+    cliRebootEx(
+# 3309 "./src/main/cli/cli.c" 3 4
+               0
+# 3309 "./src/main/cli/cli.c"
+                    );
+}
+
+static void cliBootloader(char *cmdline)
+{
+    (void)(cmdline);
+
+    cliPrintHashLine("restarting in bootloader mode");
+    cliRebootEx(
+# 3317 "./src/main/cli/cli.c" 3 4
+               1
+# 3317 "./src/main/cli/cli.c"
+                   );
+}
+
+static void cliExit(char *cmdline)
+{
+    (void)(cmdline);
+
+    cliPrintHashLine("leaving CLI mode, unsaved changes lost");
+    bufWriterFlush(cliWriter);
+
+    *cliBuffer = '\0';
+    bufferIndex = 0;
+    cliMode = 0;
+
+    mixerResetDisarmedMotors();
+    cliReboot();
+
+    cliWriter = 
+# 3334 "./src/main/cli/cli.c" 3 4
+               ((void *)0)
+# 3334 "./src/main/cli/cli.c"
+                   ;
+}
+
+
+static void cliGpsPassthrough(char *cmdline)
+{
+    (void)(cmdline);
+
+    gpsEnablePassthrough(cliPort);
+}
+# 3373 "./src/main/cli/cli.c"
+static int parseOutputIndex(char *pch, 
+# 3373 "./src/main/cli/cli.c" 3 4
+                                      _Bool 
+# 3373 "./src/main/cli/cli.c"
+                                           allowAllEscs) {
+    int outputIndex = atoi(pch);
+    if ((outputIndex >= 0) && (outputIndex < getMotorCount())) {
+        cliPrintLinef("Using output %d.", outputIndex);
+    } else if (allowAllEscs && outputIndex == 255) {
+        cliPrintLinef("Using all outputs.");
+    } else {
+        cliPrintErrorLinef("INVALID OUTPUT NUMBER. RANGE: 0 - %d.", getMotorCount() - 1);
+
+        return -1;
+    }
+
+    return outputIndex;
+}
+# 3709 "./src/main/cli/cli.c"
+static void cliMixer(char *cmdline)
+{
+    int len;
+
+    len = strlen(cmdline);
+
+    if (len == 0) {
+        cliPrintLinef("Mixer: %s", mixerNames[mixerConfig()->mixerMode - 1]);
+        return;
+    } else if (strncasecmp(cmdline, "list", len) == 0) {
+        cliPrint("Available:");
+        for (uint32_t i = 0; ; i++) {
+            if (mixerNames[i] == 
+# 3721 "./src/main/cli/cli.c" 3 4
+                                ((void *)0)
+# 3721 "./src/main/cli/cli.c"
+                                    )
+                break;
+            cliPrintf(" %s", mixerNames[i]);
+        }
+        cliPrintLinefeed();
+        return;
+    }
+
+    for (uint32_t i = 0; ; i++) {
+        if (mixerNames[i] == 
+# 3730 "./src/main/cli/cli.c" 3 4
+                            ((void *)0)
+# 3730 "./src/main/cli/cli.c"
+                                ) {
+            cliPrintErrorLinef("INVALID NAME");
+            return;
+        }
+        if (strncasecmp(cmdline, mixerNames[i], len) == 0) {
+            mixerConfigMutable()->mixerMode = i + 1;
+            break;
+        }
+    }
+
+    cliMixer("");
+}
+
+
+static void cliMotor(char *cmdline)
+{
+    if (isEmpty(cmdline)) {
+        cliShowParseError();
+
+        return;
+    }
+
+    int motorIndex = 0;
+    int motorValue = 0;
+
+    char *saveptr;
+    char *pch = strtok_r(cmdline, " ", &saveptr);
+    int index = 0;
+    while (pch != 
+# 3758 "./src/main/cli/cli.c" 3 4
+                 ((void *)0)
+# 3758 "./src/main/cli/cli.c"
+                     ) {
+        switch (index) {
+        case 0:
+            motorIndex = parseOutputIndex(pch, 
+# 3761 "./src/main/cli/cli.c" 3 4
+                                              1
+# 3761 "./src/main/cli/cli.c"
+                                                  );
+            if (motorIndex == -1) {
+                return;
+            }
+
+            break;
+        case 1:
+            motorValue = atoi(pch);
+
+            break;
+        }
+        index++;
+        pch = strtok_r(
+# 3773 "./src/main/cli/cli.c" 3 4
+                      ((void *)0)
+# 3773 "./src/main/cli/cli.c"
+                          , " ", &saveptr);
+    }
+
+    if (index == 2) {
+        if (motorValue < 1000 || motorValue > 2000) {
+            cliShowArgumentRangeError("VALUE", 1000, 2000);
+        } else {
+            uint32_t motorOutputValue = convertExternalToMotor(motorValue);
+
+            if (motorIndex != 255) {
+                motor_disarmed[motorIndex] = motorOutputValue;
+
+                cliPrintLinef("motor %d: %d", motorIndex, motorOutputValue);
+            } else {
+                for (int i = 0; i < getMotorCount(); i++) {
+                    motor_disarmed[i] = motorOutputValue;
+                }
+
+                cliPrintLinef("all motors: %d", motorOutputValue);
+            }
+        }
+    } else {
+        cliShowParseError();
+    }
+}
+
+
+static void cliPlaySound(char *cmdline)
+{
+    int i;
+    const char *name;
+    static int lastSoundIdx = -1;
+
+    if (isEmpty(cmdline)) {
+        i = lastSoundIdx + 1;
+        if ((name=beeperNameForTableIndex(i)) == 
+# 3808 "./src/main/cli/cli.c" 3 4
+                                                ((void *)0)
+# 3808 "./src/main/cli/cli.c"
+                                                    ) {
+            while (
+# 3809 "./src/main/cli/cli.c" 3 4
+                  1
+# 3809 "./src/main/cli/cli.c"
+                      ) {
+                if (++i >= beeperTableEntryCount())
+                    i = 0;
+                if ((name=beeperNameForTableIndex(i)) != 
+# 3812 "./src/main/cli/cli.c" 3 4
+                                                        ((void *)0)
+# 3812 "./src/main/cli/cli.c"
+                                                            )
+                    break;
+                if (i == lastSoundIdx + 1) {
+                    cliPrintErrorLinef("ERROR PLAYING SOUND");
+                    return;
+                }
+            }
+        }
+    } else {
+        i = atoi(cmdline);
+        if ((name=beeperNameForTableIndex(i)) == 
+# 3822 "./src/main/cli/cli.c" 3 4
+                                                ((void *)0)
+# 3822 "./src/main/cli/cli.c"
+                                                    ) {
+            cliPrintLinef("No sound for index %d", i);
+            return;
+        }
+    }
+    lastSoundIdx = i;
+    beeperSilence();
+    cliPrintLinef("Playing sound %d: %s", i, name);
+    beeper(beeperModeForTableIndex(i));
+}
+
+
+static void cliProfile(char *cmdline)
+{
+    if (isEmpty(cmdline)) {
+        cliPrintLinef("profile %d", getPidProfileIndexToUse());
+        return;
+    } else {
+        const int i = atoi(cmdline);
+        if (i >= 0 && i < 3) {
+            changePidProfile(i);
+            cliProfile("");
+        } else {
+            cliPrintErrorLinef("PROFILE OUTSIDE OF [0..%d]", 3 - 1);
+        }
+    }
+}
+
+static void cliRateProfile(char *cmdline)
+{
+    if (isEmpty(cmdline)) {
+        cliPrintLinef("rateprofile %d", getRateProfileIndexToUse());
+        return;
+    } else {
+        const int i = atoi(cmdline);
+        if (i >= 0 && i < 6) {
+            changeControlRateProfile(i);
+            cliRateProfile("");
+        } else {
+            cliPrintErrorLinef("RATE PROFILE OUTSIDE OF [0..%d]", 6 - 1);
+        }
+    }
+}
+
+static void cliDumpPidProfile(uint8_t pidProfileIndex, dumpFlags_t dumpMask)
+{
+    if (pidProfileIndex >= 3) {
+
+        return;
+    }
+
+    pidProfileIndexToUse = pidProfileIndex;
+
+    cliPrintLinefeed();
+    cliProfile("");
+
+    char profileStr[10];
+    tfp_sprintf(profileStr, "profile %d", pidProfileIndex);
+    dumpAllValues(PROFILE_VALUE, dumpMask, profileStr);
+
+    pidProfileIndexToUse = -1;
+}
+
+static void cliDumpRateProfile(uint8_t rateProfileIndex, dumpFlags_t dumpMask)
+{
+    if (rateProfileIndex >= 6) {
+
+        return;
+    }
+
+    rateProfileIndexToUse = rateProfileIndex;
+
+    cliPrintLinefeed();
+    cliRateProfile("");
+
+    char rateProfileStr[14];
+    tfp_sprintf(rateProfileStr, "rateprofile %d", rateProfileIndex);
+    dumpAllValues(PROFILE_RATE_VALUE, dumpMask, rateProfileStr);
+
+    rateProfileIndexToUse = -1;
+}
+
+
+static void cliPrintCommandBatchWarning(const char *warning)
+{
+    cliPrintErrorLinef("ERRORS WERE DETECTED - PLEASE REVIEW BEFORE CONTINUING");
+    if (warning) {
+        cliPrintErrorLinef(warning);
+    }
+}
+
+static void resetCommandBatch(void)
+{
+    commandBatchActive = 
+# 3915 "./src/main/cli/cli.c" 3 4
+                        0
+# 3915 "./src/main/cli/cli.c"
+                             ;
+    commandBatchError = 
+# 3916 "./src/main/cli/cli.c" 3 4
+                       0
+# 3916 "./src/main/cli/cli.c"
+                            ;
+}
+
+static void cliBatch(char *cmdline)
+{
+    if (strncasecmp(cmdline, "start", 5) == 0) {
+        if (!commandBatchActive) {
+            commandBatchActive = 
+# 3923 "./src/main/cli/cli.c" 3 4
+                                1
+# 3923 "./src/main/cli/cli.c"
+                                    ;
+            commandBatchError = 
+# 3924 "./src/main/cli/cli.c" 3 4
+                               0
+# 3924 "./src/main/cli/cli.c"
+                                    ;
+        }
+        cliPrintLine("Command batch started");
+    } else if (strncasecmp(cmdline, "end", 3) == 0) {
+        if (commandBatchActive && commandBatchError) {
+            cliPrintCommandBatchWarning(
+# 3929 "./src/main/cli/cli.c" 3 4
+                                       ((void *)0)
+# 3929 "./src/main/cli/cli.c"
+                                           );
+        } else {
+            cliPrintLine("Command batch ended");
+        }
+        resetCommandBatch();
+    } else {
+        cliPrintErrorLinef("Invalid option");
+    }
+}
+
+
+static void cliSave(char *cmdline)
+{
+    (void)(cmdline);
+
+
+    if (commandBatchActive && commandBatchError) {
+        cliPrintCommandBatchWarning("PLEASE FIX ERRORS THEN 'SAVE'");
+        resetCommandBatch();
+        return;
+    }
+
+
+    cliPrintHashLine("saving");
+
+
+    if (boardInformationUpdated) {
+        persistBoardInformation();
+    }
+
+    if (signatureUpdated) {
+        persistSignature();
+    }
+
+
+
+    if (featureMaskIsCopied) {
+        writeEEPROMWithFeatures(featureMaskCopy);
+    } else {
+        writeEEPROM();
+    }
+
+    cliReboot();
+}
+
+static void cliDefaults(char *cmdline)
+{
+    
+# 3976 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 3976 "./src/main/cli/cli.c"
+        saveConfigs;
+
+    if (isEmpty(cmdline)) {
+        saveConfigs = 
+# 3979 "./src/main/cli/cli.c" 3 4
+                     1
+# 3979 "./src/main/cli/cli.c"
+                         ;
+    } else if (strncasecmp(cmdline, "nosave", 6) == 0) {
+        saveConfigs = 
+# 3981 "./src/main/cli/cli.c" 3 4
+                     0
+# 3981 "./src/main/cli/cli.c"
+                          ;
+    } else {
+        return;
+    }
+
+    cliPrintHashLine("resetting to defaults");
+
+    resetConfigs();
+
+
+
+
+
+
+    commandBatchError = 
+# 3995 "./src/main/cli/cli.c" 3 4
+                       0
+# 3995 "./src/main/cli/cli.c"
+                            ;
+
+
+    if (saveConfigs) {
+        cliSave(
+# 3999 "./src/main/cli/cli.c" 3 4
+               ((void *)0)
+# 3999 "./src/main/cli/cli.c"
+                   );
+    }
+}
+
+void cliPrintVarDefault(const clivalue_t *value)
+{
+    const pgRegistry_t *pg = pgFind(value->pgn);
+    if (pg) {
+        const char *defaultFormat = "Default value: ";
+        const int valueOffset = getValueOffset(value);
+        const 
+# 4009 "./src/main/cli/cli.c" 3 4
+             _Bool 
+# 4009 "./src/main/cli/cli.c"
+                  equalsDefault = valuePtrEqualsDefault(value, pg->copy + valueOffset, pg->address + valueOffset);
+        if (!equalsDefault) {
+            cliPrintf(defaultFormat, value->name);
+            printValuePointer(value, (uint8_t*)pg->address + valueOffset, 
+# 4012 "./src/main/cli/cli.c" 3 4
+                                                                         0
+# 4012 "./src/main/cli/cli.c"
+                                                                              );
+            cliPrintLinefeed();
+        }
+    }
+}
+
+static void cliGet(char *cmdline)
+{
+    const clivalue_t *val;
+    int matchedCommands = 0;
+
+    pidProfileIndexToUse = getCurrentPidProfileIndex();
+    rateProfileIndexToUse = getCurrentControlRateProfileIndex();
+
+    backupAndResetConfigs();
+
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        if (strcasestr(valueTable[i].name, cmdline)) {
+            val = &valueTable[i];
+            if (matchedCommands > 0) {
+                cliPrintLinefeed();
+            }
+            cliPrintf("%s = ", valueTable[i].name);
+            cliPrintVar(val, 0);
+            cliPrintLinefeed();
+            switch (val->type & (0x18)) {
+            case PROFILE_VALUE:
+                cliProfile("");
+
+                break;
+            case PROFILE_RATE_VALUE:
+                cliRateProfile("");
+
+                break;
+            default:
+
+                break;
+            }
+            cliPrintVarRange(val);
+            cliPrintVarDefault(val);
+
+            matchedCommands++;
+        }
+    }
+
+    restoreConfigs();
+
+    pidProfileIndexToUse = -1;
+    rateProfileIndexToUse = -1;
+
+    if (matchedCommands) {
+        return;
+    }
+
+    cliPrintErrorLinef("INVALID NAME");
+}
+
+static uint8_t getWordLength(char *bufBegin, char *bufEnd)
+{
+    while (*(bufEnd - 1) == ' ') {
+        bufEnd--;
+    }
+
+    return bufEnd - bufBegin;
+}
+
+uint16_t cliGetSettingIndex(char *name, uint8_t length)
+{
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        const char *settingName = valueTable[i].name;
+
+
+        if (strncasecmp(name, settingName, strlen(settingName)) == 0 && length == strlen(settingName)) {
+            return i;
+        }
+    }
+    return valueTableEntryCount;
+}
+
+static void cliSet(char *cmdline)
+{
+    const uint32_t len = strlen(cmdline);
+    char *eqptr;
+
+    if (len == 0 || (len == 1 && cmdline[0] == '*')) {
+        cliPrintLine("Current settings: ");
+
+        for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+            const clivalue_t *val = &valueTable[i];
+            cliPrintf("%s = ", valueTable[i].name);
+            cliPrintVar(val, len);
+            cliPrintLinefeed();
+        }
+    } else if ((eqptr = strstr(cmdline, "=")) != 
+# 4105 "./src/main/cli/cli.c" 3 4
+                                                ((void *)0)
+# 4105 "./src/main/cli/cli.c"
+                                                    ) {
+
+
+        uint8_t variableNameLength = getWordLength(cmdline, eqptr);
+
+
+        eqptr++;
+        eqptr = skipSpace(eqptr);
+
+        const uint16_t index = cliGetSettingIndex(cmdline, variableNameLength);
+        if (index >= valueTableEntryCount) {
+            cliPrintErrorLinef("INVALID NAME");
+            return;
+        }
+        const clivalue_t *val = &valueTable[index];
+
+        
+# 4121 "./src/main/cli/cli.c" 3 4
+       _Bool 
+# 4121 "./src/main/cli/cli.c"
+            valueChanged = 
+# 4121 "./src/main/cli/cli.c" 3 4
+                           0
+# 4121 "./src/main/cli/cli.c"
+                                ;
+        int16_t value = 0;
+        switch (val->type & (0xE0)) {
+        case MODE_DIRECT: {
+                if ((val->type & (0x07)) == VAR_UINT32) {
+                    uint32_t value = strtoul(eqptr, 
+# 4126 "./src/main/cli/cli.c" 3 4
+                                                   ((void *)0)
+# 4126 "./src/main/cli/cli.c"
+                                                       , 10);
+
+                    if (value <= val->config.u32Max) {
+                        cliSetVar(val, value);
+                        valueChanged = 
+# 4130 "./src/main/cli/cli.c" 3 4
+                                      1
+# 4130 "./src/main/cli/cli.c"
+                                          ;
+                    }
+                } else {
+                    int value = atoi(eqptr);
+
+                    int min;
+                    int max;
+                    getMinMax(val, &min, &max);
+
+                    if (value >= min && value <= max) {
+                        cliSetVar(val, value);
+                        valueChanged = 
+# 4141 "./src/main/cli/cli.c" 3 4
+                                      1
+# 4141 "./src/main/cli/cli.c"
+                                          ;
+                    }
+                }
+            }
+
+            break;
+        case MODE_LOOKUP:
+        case MODE_BITSET: {
+                int tableIndex;
+                if ((val->type & (0xE0)) == MODE_BITSET) {
+                    tableIndex = TABLE_OFF_ON;
+                } else {
+                    tableIndex = val->config.lookup.tableIndex;
+                }
+                const lookupTableEntry_t *tableEntry = &lookupTables[tableIndex];
+                
+# 4156 "./src/main/cli/cli.c" 3 4
+               _Bool 
+# 4156 "./src/main/cli/cli.c"
+                    matched = 
+# 4156 "./src/main/cli/cli.c" 3 4
+                              0
+# 4156 "./src/main/cli/cli.c"
+                                   ;
+                for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
+                    matched = tableEntry->values[tableValueIndex] && strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
+
+                    if (matched) {
+                        value = tableValueIndex;
+
+                        cliSetVar(val, value);
+                        valueChanged = 
+# 4164 "./src/main/cli/cli.c" 3 4
+                                      1
+# 4164 "./src/main/cli/cli.c"
+                                          ;
+                    }
+                }
+            }
+
+            break;
+
+        case MODE_ARRAY: {
+                const uint8_t arrayLength = val->config.array.length;
+                char *valPtr = eqptr;
+
+                int i = 0;
+                while (i < arrayLength && valPtr != 
+# 4176 "./src/main/cli/cli.c" 3 4
+                                                   ((void *)0)
+# 4176 "./src/main/cli/cli.c"
+                                                       ) {
+
+                    valPtr = skipSpace(valPtr);
+
+
+
+
+                    switch (val->type & (0x07)) {
+                    default:
+                    case VAR_UINT8:
+                        {
+
+                            uint8_t *data = (uint8_t *)cliGetValuePointer(val) + i;
+
+                            *data = (uint8_t)atoi((const char*) valPtr);
+                        }
+
+                        break;
+                    case VAR_INT8:
+                        {
+
+                            int8_t *data = (int8_t *)cliGetValuePointer(val) + i;
+
+                            *data = (int8_t)atoi((const char*) valPtr);
+                        }
+
+                        break;
+                    case VAR_UINT16:
+                        {
+
+                            uint16_t *data = (uint16_t *)cliGetValuePointer(val) + i;
+
+                            *data = (uint16_t)atoi((const char*) valPtr);
+                        }
+
+                        break;
+                    case VAR_INT16:
+                        {
+
+                            int16_t *data = (int16_t *)cliGetValuePointer(val) + i;
+
+                            *data = (int16_t)atoi((const char*) valPtr);
+                        }
+
+                        break;
+                    }
+
+
+                    valPtr = strchr(valPtr, ',') + 1;
+
+                    i++;
+                }
+            }
+
+
+            valueChanged = 
+# 4231 "./src/main/cli/cli.c" 3 4
+                          1
+# 4231 "./src/main/cli/cli.c"
+                              ;
+
+            break;
+        case MODE_STRING: {
+                char *valPtr = eqptr;
+                valPtr = skipSpace(valPtr);
+
+                const unsigned int len = strlen(valPtr);
+                const uint8_t min = val->config.string.minlength;
+                const uint8_t max = val->config.string.maxlength;
+                const 
+# 4241 "./src/main/cli/cli.c" 3 4
+                     _Bool 
+# 4241 "./src/main/cli/cli.c"
+                          updatable = ((val->config.string.flags & (1 << 0)) == 0 ||
+                                        strlen((char *)cliGetValuePointer(val)) == 0 ||
+                                        strncmp(valPtr, (char *)cliGetValuePointer(val), len) == 0);
+
+                if (updatable && len > 0 && len <= max) {
+                    memset((char *)cliGetValuePointer(val), 0, max);
+                    if (len >= min && strncmp(valPtr, emptyName, len)) {
+                        strncpy((char *)cliGetValuePointer(val), valPtr, len);
+                    }
+                    valueChanged = 
+# 4250 "./src/main/cli/cli.c" 3 4
+                                  1
+# 4250 "./src/main/cli/cli.c"
+                                      ;
+                } else {
+                    cliPrintErrorLinef("STRING MUST BE 1-%d CHARACTERS OR '-' FOR EMPTY", max);
+                }
+            }
+            break;
+        }
+
+        if (valueChanged) {
+            cliPrintf("%s set to ", val->name);
+            cliPrintVar(val, 0);
+        } else {
+            cliPrintErrorLinef("INVALID VALUE");
+            cliPrintVarRange(val);
+        }
+
+        return;
+    } else {
+
+        cliGet(cmdline);
+    }
+}
+
+static void cliStatus(char *cmdline)
+{
+    (void)(cmdline);
+
+
+
+    cliPrintf("MCU %s Clock=%dMHz", "SIMULATOR", (SystemCoreClock / 1000000));
+# 4302 "./src/main/cli/cli.c"
+    cliPrintLinefeed();
+
+
+
+
+    cliPrintf("Stack size: %d, Stack address: 0x%x", stackTotalSize(), stackHighMem());
+
+
+
+    cliPrintLinefeed();
+
+
+
+
+
+
+    cliPrintLinef("Config size: %d, Max available config: %d", getEEPROMConfigSize(), 32768);
+
+
+
+
+    const uint32_t detectedSensorsMask = sensorsMask();
+    for (uint32_t i = 0; ; i++) {
+        if (sensorTypeNames[i] == 
+# 4325 "./src/main/cli/cli.c" 3 4
+                                 ((void *)0)
+# 4325 "./src/main/cli/cli.c"
+                                     ) {
+            break;
+        }
+        const uint32_t mask = (1 << i);
+        if ((detectedSensorsMask & mask) && (mask & (SENSOR_GYRO | SENSOR_ACC | SENSOR_BARO | SENSOR_MAG | SENSOR_RANGEFINDER))) {
+            const uint8_t sensorHardwareIndex = detectedSensors[i];
+            const char *sensorHardware = sensorHardwareNames[i][sensorHardwareIndex];
+            if (i) {
+                cliPrint(", ");
+            }
+            cliPrintf("%s=%s", sensorTypeNames[i], sensorHardware);
+
+            if (mask == SENSOR_ACC && acc.dev.revisionCode) {
+                cliPrintf(".%c", acc.dev.revisionCode);
+            }
+
+        }
+    }
+    cliPrintLinefeed();
+
+
+
+
+    cliPrintf("System Uptime: %d seconds", millis() / 1000);
+
+
+    char buf[30];
+    dateTime_t dt;
+    if (rtcGetDateTime(&dt)) {
+        dateTimeFormatLocal(buf, &dt);
+        cliPrintf(", Current Time: %s", buf);
+    }
+
+    cliPrintLinefeed();
+
+
+
+    const int gyroRate = getTaskDeltaTime(TASK_GYROPID) == 0 ? 0 : (int)(1000000.0f / ((float)getTaskDeltaTime(TASK_GYROPID)));
+    const int rxRate = currentRxRefreshRate == 0 ? 0 : (int)(1000000.0f / ((float)currentRxRefreshRate));
+    const int systemRate = getTaskDeltaTime(TASK_SYSTEM) == 0 ? 0 : (int)(1000000.0f / ((float)getTaskDeltaTime(TASK_SYSTEM)));
+    cliPrintLinef("CPU:%d%%, cycle time: %d, GYRO rate: %d, RX rate: %d, System rate: %d",
+            constrain(averageSystemLoadPercent, 0, 100), getTaskDeltaTime(TASK_GYROPID), gyroRate, rxRate, systemRate);
+
+
+
+    cliPrintLinef("Voltage: %d * 0.01V (%dS battery - %s)", getBatteryVoltage(), getBatteryCellCount(), getBatteryStateString());
+
+
+
+
+
+
+    const uint16_t i2cErrorCounter = 0;
+
+    cliPrintLinef("I2C Errors: %d", i2cErrorCounter);
+
+
+    cliSdInfo(
+# 4382 "./src/main/cli/cli.c" 3 4
+             ((void *)0)
+# 4382 "./src/main/cli/cli.c"
+                 );
+
+
+    cliPrint("Arming disable flags:");
+    armingDisableFlags_e flags = getArmingDisableFlags();
+    while (flags) {
+        const int bitpos = ffs(flags) - 1;
+        flags &= ~(1 << bitpos);
+        cliPrintf(" %s", armingDisableFlagNames[bitpos]);
+    }
+    cliPrintLinefeed();
+}
+
+
+static void cliTasks(char *cmdline)
+{
+    (void)(cmdline);
+    int maxLoadSum = 0;
+    int averageLoadSum = 0;
+
+
+    if (systemConfig()->task_statistics) {
+        cliPrintLine("Task list             rate/hz  max/us  avg/us maxload avgload     total/ms");
+    } else {
+        cliPrintLine("Task list");
+    }
+
+    for (cfTaskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
+        cfTaskInfo_t taskInfo;
+        getTaskInfo(taskId, &taskInfo);
+        if (taskInfo.isEnabled) {
+            int taskFrequency;
+            int subTaskFrequency = 0;
+            if (taskId == TASK_GYROPID) {
+                subTaskFrequency = taskInfo.movingAverageCycleTime == 0.0f ? 0.0f : (int)(1000000.0f / (taskInfo.movingAverageCycleTime));
+                taskFrequency = subTaskFrequency / pidConfig()->pid_process_denom;
+                if (pidConfig()->pid_process_denom > 1) {
+                    cliPrintf("%02d - (%15s) ", taskId, taskInfo.taskName);
+                } else {
+                    taskFrequency = subTaskFrequency;
+                    cliPrintf("%02d - (%11s/%3s) ", taskId, taskInfo.subTaskName, taskInfo.taskName);
+                }
+            } else {
+                taskFrequency = taskInfo.averageDeltaTime == 0 ? 0 : (int)(1000000.0f / ((float)taskInfo.averageDeltaTime));
+                cliPrintf("%02d - (%15s) ", taskId, taskInfo.taskName);
+            }
+            const int maxLoad = taskInfo.maxExecutionTime == 0 ? 0 :(taskInfo.maxExecutionTime * taskFrequency + 5000) / 1000;
+            const int averageLoad = taskInfo.averageExecutionTime == 0 ? 0 : (taskInfo.averageExecutionTime * taskFrequency + 5000) / 1000;
+            if (taskId != TASK_SERIAL) {
+                maxLoadSum += maxLoad;
+                averageLoadSum += averageLoad;
+            }
+            if (systemConfig()->task_statistics) {
+                cliPrintLinef("%6d %7d %7d %4d.%1d%% %4d.%1d%% %9d",
+                        taskFrequency, taskInfo.maxExecutionTime, taskInfo.averageExecutionTime,
+                        maxLoad/10, maxLoad%10, averageLoad/10, averageLoad%10, taskInfo.totalExecutionTime / 1000);
+            } else {
+                cliPrintLinef("%6d", taskFrequency);
+            }
+            if (taskId == TASK_GYROPID && pidConfig()->pid_process_denom > 1) {
+                cliPrintLinef("   - (%15s) %6d", taskInfo.subTaskName, subTaskFrequency);
+            }
+
+            schedulerResetTaskMaxExecutionTime(taskId);
+        }
+    }
+    if (systemConfig()->task_statistics) {
+        cfCheckFuncInfo_t checkFuncInfo;
+        getCheckFuncInfo(&checkFuncInfo);
+        cliPrintLinef("RX Check Function %19d %7d %25d", checkFuncInfo.maxExecutionTime, checkFuncInfo.averageExecutionTime, checkFuncInfo.totalExecutionTime / 1000);
+        cliPrintLinef("Total (excluding SERIAL) %25d.%1d%% %4d.%1d%%", maxLoadSum/10, maxLoadSum%10, averageLoadSum/10, averageLoadSum%10);
+    }
+}
+
+
+
+static void cliTimings(char *cmdline)
+{
+    if (strcasecmp(cmdline, "reset") == 0) {
+        timingsReset();
+        return;
+    } else if (!isEmpty(cmdline)) {
+        cliShowParseError();
+        return;
+    }
+
+    cliPrintLine("           Probe      count  min/us  avg/us  p50/us  p90/us  p99/us  max/us");
+    for (timingsProbe_e probe = 0; probe < TIMINGS_COUNT; probe++) {
+        timingsSummary_t summary;
+        timingsGetSummary(probe, &summary);
+
+        cliPrintf("%16s %10u", timingsProbeNames[probe], summary.count);
+        const uint32_t cycles[] = { summary.minCycles, summary.avgCycles, summary.p50Cycles, summary.p90Cycles, summary.p99Cycles, summary.maxCycles };
+        for (unsigned i = 0; i < (sizeof(cycles) / sizeof((cycles)[0])); i++) {
+            const int32_t time = clockCyclesTo10thMicros(cycles[i]);
+            cliPrintf(" %5d.%1d", time / 10, time % 10);
+        }
+        cliPrintLinefeed();
+    }
+}
+
+
+static void cliVersion(char *cmdline)
+{
+    (void)(cmdline);
+
+    cliPrintf("# %s / %s (%s) %s %s / %s (%s) MSP API: %s",
+        "Betaflight",
+        targetName,
+        systemConfig()->boardIdentifier,
+        "4" "." "1" "." "0",
+        buildDate,
+        buildTime,
+        shortGitRevision,
+        "1" "." "42"
+    );
+
+
+
+    cliPrintLinefeed();
+
+}
+
+
+static void cliRcSmoothing(char *cmdline)
+{
+    (void)(cmdline);
+    rcSmoothingFilter_t *rcSmoothingData = getRcSmoothingData();
+    cliPrint("# RC Smoothing Type: ");
+    if (rxConfig()->rc_smoothing_type == RC_SMOOTHING_TYPE_FILTER) {
+        cliPrintLine("FILTER");
+        uint16_t avgRxFrameMs = rcSmoothingData->averageFrameTimeUs;
+        if (rcSmoothingAutoCalculate()) {
+            cliPrint("# Detected RX frame rate: ");
+            if (avgRxFrameMs == 0) {
+                cliPrintLine("NO SIGNAL");
+            } else {
+                cliPrintLinef("%d.%dms", avgRxFrameMs / 1000, avgRxFrameMs % 1000);
+            }
+        }
+        cliPrint("# Input filter type: ");
+        cliPrintLinef(lookupTables[TABLE_RC_SMOOTHING_INPUT_TYPE].values[rcSmoothingData->inputFilterType]);
+        cliPrintf("# Active input cutoff: %dhz ", rcSmoothingData->inputCutoffFrequency);
+        if (rcSmoothingData->inputCutoffSetting == 0) {
+            cliPrintLine("(auto)");
+        } else {
+            cliPrintLine("(manual)");
+        }
+        cliPrint("# Derivative filter type: ");
+        cliPrintLinef(lookupTables[TABLE_RC_SMOOTHING_DERIVATIVE_TYPE].values[rcSmoothingData->derivativeFilterType]);
+        cliPrintf("# Active derivative cutoff: %dhz (", rcSmoothingData->derivativeCutoffFrequency);
+        if (rcSmoothingData->derivativeFilterType == RC_SMOOTHING_DERIVATIVE_OFF) {
+            cliPrintLine("off)");
+        } else {
+            if (rcSmoothingData->derivativeCutoffSetting == 0) {
+                cliPrintLine("auto)");
+            } else {
+                cliPrintLine("manual)");
+            }
+        }
+    } else {
+        cliPrintLine("INTERPOLATION");
+    }
+}
+# 5575 "./src/main/cli/cli.c"
+static void printConfig(char *cmdline, 
+# 5575 "./src/main/cli/cli.c" 3 4
+                                      _Bool 
+# 5575 "./src/main/cli/cli.c"
+                                           doDiff)
+{
+    dumpFlags_t dumpMask = DUMP_MASTER;
+    char *options;
+    if ((options = checkCommand(cmdline, "master"))) {
+        dumpMask = DUMP_MASTER;
+    } else if ((options = checkCommand(cmdline, "profile"))) {
+        dumpMask = DUMP_PROFILE;
+    } else if ((options = checkCommand(cmdline, "rates"))) {
+        dumpMask = DUMP_RATES;
+    } else if ((options = checkCommand(cmdline, "hardware"))) {
+        dumpMask = DUMP_MASTER | HARDWARE_ONLY;
+    } else if ((options = checkCommand(cmdline, "all"))) {
+        dumpMask = DUMP_ALL;
+    } else {
+        options = cmdline;
+    }
+
+    if (doDiff) {
+        dumpMask = dumpMask | DO_DIFF;
+    }
+
+    if (checkCommand(options, "defaults")) {
+        dumpMask = dumpMask | SHOW_DEFAULTS;
+    } else if (checkCommand(options, "bare")) {
+        dumpMask = dumpMask | BARE;
+    }
+
+    backupAndResetConfigs();
+
+
+    
+# 5606 "./src/main/cli/cli.c" 3 4
+   _Bool 
+# 5606 "./src/main/cli/cli.c"
+        batchModeEnabled = 
+# 5606 "./src/main/cli/cli.c" 3 4
+                           0
+# 5606 "./src/main/cli/cli.c"
+                                ;
+
+    if ((dumpMask & DUMP_MASTER) || (dumpMask & DUMP_ALL)) {
+        cliPrintHashLine("version");
+        cliVersion(
+# 5610 "./src/main/cli/cli.c" 3 4
+                  ((void *)0)
+# 5610 "./src/main/cli/cli.c"
+                      );
+
+        if (!(dumpMask & BARE)) {
+
+            cliPrintHashLine("start the command batch");
+            cliPrintLine("batch start");
+            batchModeEnabled = 
+# 5616 "./src/main/cli/cli.c" 3 4
+                              1
+# 5616 "./src/main/cli/cli.c"
+                                  ;
+
+
+            if ((dumpMask & (DUMP_ALL | DO_DIFF)) == (DUMP_ALL | DO_DIFF)) {
+                cliPrintHashLine("reset configuration to default settings");
+                cliPrintLine("defaults nosave");
+            }
+        }
+
+
+        cliPrintLinefeed();
+        printBoardName(dumpMask);
+        printManufacturerId(dumpMask);
+
+
+        if ((dumpMask & DUMP_ALL) && !(dumpMask & BARE)) {
+            cliMcuId(
+# 5632 "./src/main/cli/cli.c" 3 4
+                    ((void *)0)
+# 5632 "./src/main/cli/cli.c"
+                        );
+
+            cliSignature("");
+
+        }
+
+        if (!(dumpMask & HARDWARE_ONLY)) {
+            printName(dumpMask, &pilotConfig_Copy);
+        }
+# 5652 "./src/main/cli/cli.c"
+        if (!(dumpMask & HARDWARE_ONLY)) {
+
+            const char *mixerHeadingStr = "mixer";
+            const 
+# 5655 "./src/main/cli/cli.c" 3 4
+                 _Bool 
+# 5655 "./src/main/cli/cli.c"
+                      equalsDefault = mixerConfig_Copy.mixerMode == mixerConfig()->mixerMode;
+            mixerHeadingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, mixerHeadingStr);
+            const char *formatMixer = "mixer %s";
+            cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
+            cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
+
+            cliDumpPrintLinef(dumpMask, customMotorMixer(0)->throttle == 0.0f, "\r\nmmix reset\r\n");
+
+            printMotorMix(dumpMask, customMotorMixer_CopyArray, customMotorMixer(0), mixerHeadingStr);
+
+
+            printServo(dumpMask, servoParams_CopyArray, servoParams(0), "servo");
+
+            const char *servoMixHeadingStr = "servo mixer";
+            if (!(dumpMask & DO_DIFF) || customServoMixers(0)->rate != 0) {
+                cliPrintHashLine(servoMixHeadingStr);
+                cliPrintLine("smix reset\r\n");
+                servoMixHeadingStr = 
+# 5672 "./src/main/cli/cli.c" 3 4
+                                    ((void *)0)
+# 5672 "./src/main/cli/cli.c"
+                                        ;
+            }
+            printServoMix(dumpMask, customServoMixers_CopyArray, customServoMixers(0), servoMixHeadingStr);
+
+
+
+            printFeature(dumpMask, &featureConfig_Copy, featureConfig(), "feature");
+# 5688 "./src/main/cli/cli.c"
+            printMap(dumpMask, &rxConfig_Copy, rxConfig(), "map");
+
+            printSerial(dumpMask, &serialConfig_Copy, serialConfig(), "serial");
+# 5700 "./src/main/cli/cli.c"
+            printAux(dumpMask, modeActivationConditions_CopyArray, modeActivationConditions(0), "aux");
+
+            printAdjustmentRange(dumpMask, adjustmentRanges_CopyArray, adjustmentRanges(0), "adjrange");
+
+            printRxRange(dumpMask, rxChannelRangeConfigs_CopyArray, rxChannelRangeConfigs(0), "rxrange");
+
+
+
+
+
+
+            printVtxTable(dumpMask, &vtxTableConfig_Copy, vtxTableConfig(), "vtxtable");
+
+
+            printRxFailsafe(dumpMask, rxFailsafeChannelConfigs_CopyArray, rxFailsafeChannelConfigs(0), "rxfail");
+        }
+
+        if (dumpMask & HARDWARE_ONLY) {
+            dumpAllValues(HARDWARE_VALUE, dumpMask, "master");
+        } else {
+            dumpAllValues(MASTER_VALUE, dumpMask, "master");
+
+            if (dumpMask & DUMP_ALL) {
+                for (uint32_t pidProfileIndex = 0; pidProfileIndex < 3; pidProfileIndex++) {
+                    cliDumpPidProfile(pidProfileIndex, dumpMask);
+                }
+
+                pidProfileIndexToUse = systemConfig_Copy.pidProfileIndex;
+
+                if (!(dumpMask & BARE)) {
+                    cliPrintHashLine("restore original profile selection");
+
+                    cliProfile("");
+                }
+
+                pidProfileIndexToUse = -1;
+
+                for (uint32_t rateIndex = 0; rateIndex < 6; rateIndex++) {
+                    cliDumpRateProfile(rateIndex, dumpMask);
+                }
+
+                rateProfileIndexToUse = systemConfig_Copy.activeRateProfile;
+
+                if (!(dumpMask & BARE)) {
+                    cliPrintHashLine("restore original rateprofile selection");
+
+                    cliRateProfile("");
+
+                    cliPrintHashLine("save configuration");
+                    cliPrint("save");
+
+                    batchModeEnabled = 
+# 5751 "./src/main/cli/cli.c" 3 4
+                                      0
+# 5751 "./src/main/cli/cli.c"
+                                           ;
+
+                }
+
+                rateProfileIndexToUse = -1;
+            } else {
+                cliDumpPidProfile(systemConfig_Copy.pidProfileIndex, dumpMask);
+
+                cliDumpRateProfile(systemConfig_Copy.activeRateProfile, dumpMask);
+            }
+        }
+    } else if (dumpMask & DUMP_PROFILE) {
+        cliDumpPidProfile(systemConfig_Copy.pidProfileIndex, dumpMask);
+    } else if (dumpMask & DUMP_RATES) {
+        cliDumpRateProfile(systemConfig_Copy.activeRateProfile, dumpMask);
+    }
+
+
+    if (batchModeEnabled) {
+        cliPrintHashLine("end the command batch");
+        cliPrintLine("batch end");
+    }
+
+
+
+    restoreConfigs();
+}
+
+static void cliDump(char *cmdline)
+{
+    printConfig(cmdline, 
+# 5781 "./src/main/cli/cli.c" 3 4
+                        0
+# 5781 "./src/main/cli/cli.c"
+                             );
+}
+
+static void cliDiff(char *cmdline)
+{
+    printConfig(cmdline, 
+# 5786 "./src/main/cli/cli.c" 3 4
+                        1
+# 5786 "./src/main/cli/cli.c"
+                            );
+}
+# 5820 "./src/main/cli/cli.c"
+typedef struct {
+    const char *name;
+
+    const char *description;
+    const char *args;
+
+    void (*func)(char *cmdline);
+} clicmd_t;
+# 5845 "./src/main/cli/cli.c"
+static void cliHelp(char *cmdline);
+
+
+const clicmd_t cmdTable[] = {
+    { "adjrange" , "configure adjustment ranges" , 
+# 5849 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5849 "./src/main/cli/cli.c"
+   , cliAdjustmentRange },
+    { "aux" , "configure modes" , "<index> <mode> <aux> <start> <end> <logic>" , cliAux },
+
+    { "batch" , "start or end a batch of commands" , "start | end" , cliBatch },
+# 5865 "./src/main/cli/cli.c"
+    { "bl" , "reboot into bootloader" , 
+# 5865 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5865 "./src/main/cli/cli.c"
+   , cliBootloader },
+
+    { "board_name" , "get / set the name of the board model" , "[board name]" , cliBoardName },
+
+
+
+
+    { "defaults" , "reset to defaults and reboot" , "[nosave]" , cliDefaults },
+    { "diff" , "list configuration changes from default" , "[master|profile|rates|hardware|all] {defaults|bare}" , cliDiff },
+# 5887 "./src/main/cli/cli.c"
+    { "dump" , "dump configuration" , "[master|profile|rates|hardware|all] {defaults|bare}" , cliDump }
+                                                                       ,
+
+
+
+    { "exit" , 
+# 5892 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5892 "./src/main/cli/cli.c"
+   , 
+# 5892 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5892 "./src/main/cli/cli.c"
+   , cliExit },
+    { "feature" , "configure features" , "list\r\n" "\t<->[name]" , cliFeature }
+
+                                  ,
+
+    { "flash_erase" , "erase flash chip" , 
+# 5897 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5897 "./src/main/cli/cli.c"
+   , cliFlashErase },
+    { "flash_info" , "show flash chip info" , 
+# 5898 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5898 "./src/main/cli/cli.c"
+   , cliFlashInfo },
+
+
+
+
+
+
+    { "get" , "get variable value" , "[name]" , cliGet },
+
+    { "gpspassthrough" , "passthrough gps to serial" , 
+# 5907 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5907 "./src/main/cli/cli.c"
+   , cliGpsPassthrough },
+
+
+
+
+    { "help" , 
+# 5912 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5912 "./src/main/cli/cli.c"
+   , 
+# 5912 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5912 "./src/main/cli/cli.c"
+   , cliHelp },
+
+
+
+
+    { "manufacturer_id" , "get / set the id of the board manufacturer" , "[manufacturer id]" , cliManufacturerId },
+
+    { "map" , "configure rc channel order" , "[<map>]" , cliMap },
+    { "mcu_id" , "id of the microcontroller" , 
+# 5920 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5920 "./src/main/cli/cli.c"
+   , cliMcuId },
+
+    { "mixer" , "configure mixer" , "list\r\n\t<name>" , cliMixer },
+
+    { "mmix" , "custom motor mixer" , 
+# 5924 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5924 "./src/main/cli/cli.c"
+   , cliMotorMix },
+
+
+
+    { "motor" , "get/set motor" , "<index> [<value>]" , cliMotor },
+
+
+
+
+
+
+
+    { "name" , "name of craft" , 
+# 5936 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5936 "./src/main/cli/cli.c"
+   , cliName },
+
+    { "play_sound" , 
+# 5938 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5938 "./src/main/cli/cli.c"
+   , "[<index>]" , cliPlaySound },
+
+    { "profile" , "change profile" , "[<index>]" , cliProfile },
+    { "rateprofile" , "change rate profile" , "[<index>]" , cliRateProfile },
+
+    { "rc_smoothing_info" , "show rc_smoothing operational settings" , 
+# 5943 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5943 "./src/main/cli/cli.c"
+   , cliRcSmoothing },
+
+
+
+
+    { "rxfail" , "show/set rx failsafe settings" , 
+# 5948 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5948 "./src/main/cli/cli.c"
+   , cliRxFailsafe },
+    { "rxrange" , "configure rx channel ranges" , 
+# 5949 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5949 "./src/main/cli/cli.c"
+   , cliRxRange },
+    { "save" , "save and reboot" , 
+# 5950 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5950 "./src/main/cli/cli.c"
+   , cliSave },
+
+    { "sd_info" , "sdcard info" , 
+# 5952 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5952 "./src/main/cli/cli.c"
+   , cliSdInfo },
+
+    { "serial" , "configure serial ports" , 
+# 5954 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5954 "./src/main/cli/cli.c"
+   , cliSerial },
+
+
+
+
+
+    { "serialpassthrough" , "passthrough serial data to port" , "<id> [baud] [mode] [dtr pinio|'reset']" , cliSerialPassthrough },
+
+
+
+
+
+    { "servo" , "configure servos" , 
+# 5966 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5966 "./src/main/cli/cli.c"
+   , cliServo },
+
+    { "set" , "change setting" , "[<name>=<value>]" , cliSet },
+
+    { "signature" , "get / set the board type signature" , "[signature]" , cliSignature },
+
+
+    { "smix" , "servo mixer" , "<rule> <servo> <source> <rate> <speed> <min> <max> <box>\r\n" "\treset\r\n" "\tload <mixer>\r\n" "\treverse <servo> <source> r|n" , cliServoMix }
+
+
+                                                      ,
+
+    { "status" , "show status" , 
+# 5978 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5978 "./src/main/cli/cli.c"
+   , cliStatus },
+
+    { "tasks" , "show task stats" , 
+# 5980 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5980 "./src/main/cli/cli.c"
+   , cliTasks },
+
+
+
+
+
+    { "timings" , "show gyro and pid loop timings" , "[reset]" , cliTimings },
+
+    { "version" , "show version" , 
+# 5988 "./src/main/cli/cli.c" 3 4
+   ((void *)0) 
+# 5988 "./src/main/cli/cli.c"
+   , cliVersion },
+# 5997 "./src/main/cli/cli.c"
+    { "vtxtable" , "vtx frequency able" , "<band> <bandname> <bandletter> <freq> ... <freq>\r\n" , cliVtxTable },
+
+};
+
+static void cliHelp(char *cmdline)
+{
+    (void)(cmdline);
+
+    for (uint32_t i = 0; i < (sizeof(cmdTable) / sizeof((cmdTable)[0])); i++) {
+        cliPrint(cmdTable[i].name);
+
+        if (cmdTable[i].description) {
+            cliPrintf(" - %s", cmdTable[i].description);
+        }
+        if (cmdTable[i].args) {
+            cliPrintf("\r\n\t%s", cmdTable[i].args);
+        }
+
+        cliPrintLinefeed();
+    }
+}
+
+void cliProcess(void)
+{
+    if (!cliWriter) {
+        return;
+    }
+
+
+    bufWriterFlush(cliWriter);
+
+    while (serialRxBytesWaiting(cliPort)) {
+        uint8_t c = serialRead(cliPort);
+        if (c == '\t' || c == '?') {
+
+            const clicmd_t *cmd, *pstart = 
+# 6032 "./src/main/cli/cli.c" 3 4
+                                          ((void *)0)
+# 6032 "./src/main/cli/cli.c"
+                                              , *pend = 
+# 6032 "./src/main/cli/cli.c" 3 4
+                                                        ((void *)0)
+# 6032 "./src/main/cli/cli.c"
+                                                            ;
+            uint32_t i = bufferIndex;
+            for (cmd = cmdTable; cmd < cmdTable + (sizeof(cmdTable) / sizeof((cmdTable)[0])); cmd++) {
+                if (bufferIndex && (strncasecmp(cliBuffer, cmd->name, bufferIndex) != 0))
+                    continue;
+                if (!pstart)
+                    pstart = cmd;
+                pend = cmd;
+            }
+            if (pstart) {
+                for (; ; bufferIndex++) {
+                    if (pstart->name[bufferIndex] != pend->name[bufferIndex])
+                        break;
+                    if (!pstart->name[bufferIndex] && bufferIndex < sizeof(cliBuffer) - 2) {
+
+                        cliBuffer[bufferIndex++] = ' ';
+                        cliBuffer[bufferIndex] = '\0';
+                        break;
+                    }
+                    cliBuffer[bufferIndex] = pstart->name[bufferIndex];
+                }
+            }
+            if (!bufferIndex || pstart != pend) {
+
+                cliPrint("\r\033[K");
+                for (cmd = pstart; cmd <= pend; cmd++) {
+                    cliPrint(cmd->name);
+                    cliWrite('\t');
+                }
+                cliPrompt();
+                i = 0;
+            }
+            for (; i < bufferIndex; i++)
+                cliWrite(cliBuffer[i]);
+        } else if (!bufferIndex && c == 4) {
+            cliExit(cliBuffer);
+            return;
+        } else if (c == 12) {
+
+            cliPrint("\033[2J\033[1;1H");
+            cliPrompt();
+        } else if (bufferIndex && (c == '\n' || c == '\r')) {
+
+            cliPrintLinefeed();
+
+
+            char *p = cliBuffer;
+            p = strchr(p, '#');
+            if (
+# 6080 "./src/main/cli/cli.c" 3 4
+               ((void *)0) 
+# 6080 "./src/main/cli/cli.c"
+                    != p) {
+                bufferIndex = (uint32_t)(p - cliBuffer);
+            }
+
+
+            while (bufferIndex > 0 && cliBuffer[bufferIndex - 1] == ' ') {
+                bufferIndex--;
+            }
+
+
+            if (bufferIndex > 0) {
+                cliBuffer[bufferIndex] = 0;
+
+                const clicmd_t *cmd;
+                char *options;
+                for (cmd = cmdTable; cmd < cmdTable + (sizeof(cmdTable) / sizeof((cmdTable)[0])); cmd++) {
+                    if ((options = checkCommand(cliBuffer, cmd->name))) {
+                        break;
+                    }
+                }
+                if (cmd < cmdTable + (sizeof(cmdTable) / sizeof((cmdTable)[0]))) {
+                    cmd->func(options);
+                } else {
+                    cliPrintError("UNKNOWN COMMAND, TRY 'HELP'");
+                }
+                bufferIndex = 0;
+            }
+
+            memset(cliBuffer, 0, sizeof(cliBuffer));
+
+
+            if (!cliMode)
+                return;
+
+            cliPrompt();
+        } else if (c == 127) {
+
+            if (bufferIndex) {
+                cliBuffer[--bufferIndex] = 0;
+                cliPrint("\010 \010");
+            }
+        } else if (bufferIndex < sizeof(cliBuffer) && c >= 32 && c <= 126) {
+            if (!bufferIndex && c == ' ')
+                continue;
+            cliBuffer[bufferIndex++] = c;
+            cliWrite(c);
+        }
+    }
+}
+
+void cliEnter(serialPort_t *serialPort)
+{
+    cliMode = 1;
+    cliPort = serialPort;
+    setPrintfSerialPort(cliPort);
+    cliWriter = bufWriterInit(cliWriteBuffer, sizeof(cliWriteBuffer), (bufWrite_t)serialWriteBufShim, serialPort);
+
+    schedulerSetCalulateTaskStatistics(systemConfig()->task_statistics);
+
+
+    cliPrintLine("\r\nEntering CLI Mode, type 'exit' to return, or 'help'");
+
+
+
+    setArmingDisabled(ARMING_DISABLED_CLI);
+
+    cliPrompt();
+
+
+    resetCommandBatch();
+
+}
+
+void cliInit(const serialConfig_t *serialConfig)
+{
+    (void)(serialConfig);
+}
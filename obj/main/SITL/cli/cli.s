@@ -0,0 +1,8839 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\314\001"
+	.text
+	.section	.gnu.lto_.icf.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`;\017\025A"
+	.string	"\272_\324\0257 \244Ncz\242\300\254k\031f\217\326wZ\177\234\206\232\021\264 \322\324\262\037c;\370\f\241\266\tu\f\261$\305e\322^\034\226>\211\t\331{\267\033m\332$I\031K\001I\001R\001i\031\016\374\300?g\001%\031a\200\202\202\272|\003\227_\340`\342\\\345P\335\022\022\021\236\005\002\247\376\351O\003\036_~F\212\331fVx\232\235]b\234z\214\266\275\016\222\322O4s\210\211\024\254h\377"
+	.string	"Np:\365o4\357\013\221\245\204\375\013\270\200\247\371\217\357\313\244U\317\215jab\021ts,1\022\004-W\2069{|\260O}\364\321\2467\035\300\003\034\300\265\325\356\302\243\213\324@\307\202a\204\342\252\31637\261<\006\324Ce\311\265\353\242\003\372X4\333=(\335 +fk@\313\217\036\0052S"
+	.string	"\256\304VF\"\300\004\257\251\351E>\271\227\022]\315\006hwRM+\351\324L\243\255\244&`\203)Jv5\275Q;~\"\251\t0\375\364\207~\261\035\216\001\320\357b\227k&\225Iz\267\031\350\261P\317T:G\315\004\343$\345\371\363\377\224\263\324\206\211\335K@\257,\034\205\302\207\237\206\367F\370\224/\377oD\206\346\315\013\217\225idsB\013!\335E\272\361\343\303\207\357\302W\310<m\315\350\243\277\363\357\r\216\017\364\371:\335\002\315\302\256@\275\335|\363\373\377\276>\200\370Rp1O\357\254f\232\no\326\374\345(q\022\3173\210\231_p\350\375g'\220\234\0335$d\215x\210\213x\210\307\327z\326\233\236\207\036\265\2254\264\024mP\016\222\214\030X\307\302:\326\325\255\256\257.\337\352V\217\212\212]\037\371`H\335\0061\332\276"
+	.ascii	"q\371\303\365\235\240\320\035\022\272\320U\355\341\325G\335Q"
+	.ascii	"\361\217\334V\207W\017\235b/\265\212Zp8\007\016\257z\024\fG\213"
+	.ascii	"\007\210E\\5We\370|(\250,\2414+4l\220/kx\363\031\236\001\303"
+	.ascii	"1\\K\236\364\252+DAu*=SQ]\317\277\360\013\247:\325\255I\032="
+	.ascii	"\242s\302\302-X\220\212c\251S_\341\372R\237\272\324\341S\270"
+	.ascii	"\276\365\275\244\2069W\302\275;\341\372P8\023n\321\022\t\251"
+	.ascii	"\340uO\321\b\t\326[\377@\226\255\227#D\270\f\341\017 \274\372"
+	.ascii	"\340\372ZL\322 \201\t\301 \013]\237\030\255\317nw\214aYX\016"
+	.ascii	"\356\340\rd0\307A\276\253w*\271\206Q\321\n\204\324\217\220\022"
+	.ascii	"\340\007]ep\371LN\354\237D>\017\035\026|\301\025\\\301\243.\377"
+	.ascii	"\035\260\006\250\016\207O\265m2\365\252\234\177\306\020'm@p\235"
+	.ascii	"\340\324#\270><];\253\f1\217S\277\343\361\027\274\3278,\346\016"
+	.ascii	"\363\276}\\\342\3646\230\246\037>\206\340\366\227\352v\343\b"
+	.ascii	"\326\241\3551\351\214G\220\036\310\335\245\372\036\215\220\321"
+	.ascii	"n_\367\253\277\023\356\216\322v\213\301m^l\030wX\016\035\317"
+	.ascii	"q\215\3437\0365\033\372![\333`\323,\244\234\235\375%G'\365\352"
+	.ascii	"*m/.\273ko\321\3276.\303N@g{\177Z\b\234\032?fz\263\213\330\264"
+	.ascii	",4\036\353\327x\3655\252\247\361\370N\262\243KjkX4\f\346%s\354"
+	.ascii	"\312\235h\205\312\004Y1\243\270\205\254\362\\3\363\353C\305z"
+	.ascii	"\253\223s\360M\236\301)3>\3432\023\244\0316Rd\304\370\324\237"
+	.ascii	"`J9\260IQ$\034\306\247\016\225\362M\036\372=\321\257!\235\343"
+	.ascii	"\245\223&\257\324p\322\316\213\311\326\365\013\375\255W\267\356"
+	.ascii	"b\353\315\267\210R&R\004\251\344\225\373B$\226\344\352W,\276"
+	.ascii	"B\305U\274)\226t\007\027xD\307\227{\227\302\030)\022?\226\347"
+	.ascii	"-\210\346\370\021\321\377\n\304|3\304}.R>J\nI\241S\244x\365)"
+	.ascii	"n\342\016\236\202\224\206c\200\234x\025\305\343\237\270\376\211"
+	.ascii	"\233\270u\326J&z\361!mt\325C\331csa3\231\307\305\343\262\233"
+	.ascii	"Z\313r\3329K\233p\220\302\265v\351\330$\341m\301\254g5ar&KN\325"
+	.ascii	"r-\251\341\271\333~\366\367n*\251r\226q\034\243\270\003\253\257"
+	.ascii	"\272\357a\234F\302\335G\311\251\322"
+	.string	"\271\021\321\362\314\006\204\247\221\221]\206\233\217\273\017\335\354\022\367\237v\306\311\023\251f\373A\017\255N1\361\0041\332{\266\033H\207,l\353\311\243\257\223<\t\324\321P\243\331\356\323P\273m#:\033\217\276F\202\344H4\304\215b\226\201\366\035\275\353\332,\337\266\235\315\24713m\363\355\267\306\300\271\275\247_\305D/}v\035=\257E\312\375m:\272Y\2065\333\3569\027>;p)\261\230\214\233\215\206v\225\331\025\332oG~\344n\272\364e\267\233nj\033\377\016\3555\332\255\024\024wf\267\351\031\255\017\214\320Vc\344F^+7[H;\215\206n\037\315!\333ht\224Oq\321\341f\323\357\2429G\\v\266\310]\270,o\260\3176\263\301\b\356\261\264\311L\333\310\352\352\3544\"'\362!\037r!\247\006\271| \007\362\037\017p\037\327\261\224\220\f\220\233}\246\345:C\210p\333,\256\366"
+	.ascii	"Qx\310\313.\323\233m\322\355\320\306r\235\353;\276\343\\\\\017"
+	.ascii	"\201^\250A1a\304\030\032\231\021\2214I\032\003\341\004R2\207"
+	.ascii	"\306\314\016\022@\324\035\ftD\251\021\031\tD\202$\005\005\005"
+	.ascii	"\251L\007\240\315\271\020\314\352\023\307\261\354gz\200\300\013"
+	.ascii	"\347\324=mc@\325~z\201\001\236\301\323\314\210\207t\034f\226"
+	.ascii	"\307c\224\200\013\243\207U\031\331\217?\230Yv\331\355I?.\232"
+	.ascii	"\254Y~\266\374\004\351\225\271y\205\253{\262}\035\"fr\302\272"
+	.ascii	"\221\310\301L\021\316c\210<|\320\257PJ\032\017\226\223\345aR"
+	.ascii	"\314\203\005.\206\036\013?\373y\376\343K\205\356\315\355\205"
+	.ascii	"\234\203\253k\222\252\337\260\365mvq\275\206O\313\235I\376\314"
+	.ascii	"\"\253\300LF7b\355<\"\375\365G\256^>\363`d\277\227Z[\307\321"
+	.ascii	"\357F\223\237\3734\272\231\364\310\333\032u\331\277\3306\313"
+	.ascii	"H\250o\346\370\265\202\355\360v\224\274\237D\202\366\313e\017"
+	.ascii	"\304#\222\372\346!\207D\271\354\370!\241rt\212'\277)\023\007"
+	.ascii	"\355\311f\35105\341]\361\222(\244\236*\232I@\310\013\345\241"
+	.ascii	"\254QMH\301\036\352i\366r\273\353<O\207\346\030T\354\214\377"
+	.ascii	"\024\356\336P\255\303a\213q!\346\205\342\316<\330\2137|\212\002"
+	.ascii	"\313Y*\005\323\326.$VmR!\257\234\277m\3530P\236Q\217\336\325"
+	.ascii	"\376\237\222T]@o~\363\204\231\f7o?Z\324\207\352\325\034U\200"
+	.ascii	"\"\365@\334yc7\370\302{\034|[n\004:#\267\341\237%\236e\322\222"
+	.ascii	"v\235\230l\264\303\244\016%o\364\336^\240#vy=\357\372\370\371"
+	.ascii	"!\305\331\324\324\236\265\021h\024\003\247\360=q\316\251\003"
+	.ascii	"?\340\246W\233\367\347U\226\317\315\354o\360Pb\231/\004\030\016"
+	.ascii	"\326\254\312\177\371<\027\251|\030\030qw\255\357\336\311)\250"
+	.ascii	"\230_\352\361\353\274\223%\372U\355\353\316t/\377;\b\317\200"
+	.ascii	"\343\262\030\357?\030\227\363%\377\320o\227O\334\276\356\332"
+	.ascii	"sF\202\005\222[!\314tX[\372\214\263\310\303\177o\2462d,X8\332"
+	.ascii	"\r!>\212\313w\357,\204\n=\023\275k\347\240\001\327\210\314gz"
+	.ascii	"~\315$\022J\357\325\373\021yd:.\351\303\374\230\311o\273\341"
+	.ascii	"\343z\023\364"
+	.ascii	"\3743\222\313\235\205\371w\320\323\352\200\240F\376\204q\374"
+	.ascii	"\345q-w\261MrB\r\260\302\013\\\3543[`+\376\204\004\270\377dA"
+	.ascii	"\360b\177*\234\205jjp(>.dF\367\224\f\231\206uL\207\305\202\216"
+	.ascii	"\326Lr\217\345+\306\222U\317\311\357\311ke\200s4:Gy\323\n\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\300\031]0"
+	.string	"V\337Z3\260\336$\351"
+	.string	"\365P\277\364\240\257\f\314?\235Z\277\303\340\377A1\016\270.YH\341\327\372nY\364\264\346\342\230\335U\337\020\342\277YKH\263\215l\231dE"
+	.string	"F"
+	.string	"Q"
+	.ascii	"\327\240\2213h/\370\024\350|\202F\366\020\314?\2203\371k\326"
+	.ascii	"@\201&\364\004\346|\300\344\n\272O\002\032Y\tMVAk\222\"c\001"
+	.ascii	"\340\224G\322u4)\321\335\275\326\362\264\367\\\3443\226\247\037"
+	.ascii	"\201\230\243%\337E\334\221B\354\200`\275\017\354Vy\267\363?>"
+	.ascii	"\351\341&v\256\016\235\303|C\211\275\245!\003Yr\r\335K\335\204"
+	.ascii	"\341\302\265\300+<\205\343\004F\316\252\364}\213\250\305^$\265"
+	.ascii	"\247/!\002\204\371\240\344\355`^\013!\371\020\233\261Q\t\210"
+	.ascii	"\023\b9\177\354\243\007\017\222;\270\216\371?%\243Oy\317=\262"
+	.ascii	"q\2207h\243\006\215\0312>F\203\361\302E\213\211\234\005`l\247"
+	.ascii	">:\315\321\233\305+\330}\324\267<\025\254\365\024\034\305\211"
+	.ascii	"\312\204h\225 \211\2736\215`\234\"\343\277\331\315\3746"
+	.string	"d\325\0376k\030W\223\006\315\237YfzS\0312s\314\0223\303\020\314\227\266\227.\\\332\226\236\005\313\025+U\2462\345\245D\341\202\322D\354\311Nn\302\204u5.\231JXK\322\220\334\021\026\344\233\214\364.R\336\"\221\207\264}t\202x\250bL\325\314$)\264\006\"\n8\216\204y\032\326\322\003\022\340!Q\njAJ1d\020!\"\"\"\"\"\"RP\220$\351]\301\262\202\345\207\f\377D\023\200l\373\271\267\236\212ut\363\n\256\367\331\030\345h[\331L<\r\005EP\212>-\200\303 \035\024\277\205\246\b\275T7\224O\036\332\247\330\3521N\002\377\322\311\264\030A\265z\212Y\243\325>\215\267\327k\001o\315p\024\270M\2504H\204\031\342i\322\330\376\005\256W@}\357\3273\346\205\203\232\370\b\002}\024\360P\212\022\305g\3321\377\355h\255\004\264\327\020;\256\247W\261u)\326"
+	.string	"\317\363\200\3764\351F\350&\361\232-e'\354\323\206\347\205\f\034]\223$4\232R\371@\303\036\211\221\2618\034\253S\266\355\347\363\251wC\236\0057\324\301\303\324\234\366\273\304\023\023Yz\344G~\025\376U\265\250"
+	.string	"\240D\310kl\211\341%\203\367\364\024}\007YD/\314\b\230%b\0262Sd\td\317p\351\267<\210\213(29\316\213\315/\343\243\2033\rS\026\"\346x\357\254z)\274L4B\3433\214,R\\\367\352\246\211\344\3219\037\352"
+	.string	"\221\336\231a\006DPZ\230=\0130\2342q$_\372Z\tI\004(\224\351\002\315A\333\320\264)\346\324a\365\0044#\016{\354\"\264C\253x\346\211k\267;\2628\362IC\310~\376\207q\021\007\347s\343\024\366[W\236\306?\206R\230\325\366\260\272\032f\225\202\311\306\203E\024i\002'\263\233\246\004\211b\2700\016\273\304~x\310\325\367.7\303\375\323z\376\201Z\340\210\237}\250[&\311\230\216\315\254PI\316B\027\233^:\"\002w\221\264\016.`)\003\364\342\200\274\375:d\302[\2261\227\377\003\264\353\240N\037\020\006\220\365\234r\274"
+	.ascii	"\317\364\207\260\365(\355T\262\370\013J\367\035u\007\n\\\036"
+	.ascii	"\361*\234\335\307\212In\251\334N\230\210ZeUL\337\021\344\205"
+	.ascii	"\213x\361\331!\364\304h\036\013\332\b\013\362\025t\246\201\365"
+	.ascii	"\372C_w\246-r\276\032q\030f\204Y\371\036\263\210\261py\031\355"
+	.ascii	"@2R\334wB\206\344:\036\214\036_\005?N\233Yu\355sn\002!\325\\"
+	.ascii	"\236\323d\261\260(\230\"\317\270\336\322\\\005\253]\004\025\207"
+	.ascii	"\370\312IeY\251\t\270\314P\263\266\373W\324\247\261aC\331\206"
+	.ascii	"\307\020\016\236\025wR\031\223y\227\002\220\037\210q%Pa\254\227"
+	.ascii	"\337jp\200~\225W\347\217\030e\307\023\247\316\034^\266\031=\034"
+	.ascii	"\310#\244I\256\016\217\002\253\334\367S\013{\347\337\201\337"
+	.ascii	"}\004!D\214\373v\203\331\247\274\003[\315U\016C\336\317(\025"
+	.ascii	"\373h(\211\360U\032\013\327\300\026\334CL\375\232\222\214\035"
+	.ascii	"8\302;e\350]\341`\276)\240S\377s%\312\316B\210`*-\334[K\037\350"
+	.ascii	"\254\271\3046x',\013\303M\270\033\233\207m\257E\220\231\261\331"
+	.ascii	"GMw\245L\261\027\323\022il\253PB\017i\232\266\252LK\030\017/"
+	.ascii	"\365\021\210\322f\264\244\002b\264\373\322(\355A7\002\266L\310"
+	.ascii	"\232||\025IT\027y\274\265\003b\330t\025\201\260\025\3047\316"
+	.ascii	"\013\177\202H\034\227\236\204\375w\rt\366X\007\240(\035\263\237"
+	.ascii	"t{:n\336\377\013\264\323]\330\025\233\250\262\234\312v\020Ar"
+	.ascii	"\211\017{V\025\377\215\026\343fa\241\323\0252\257\263G\304\354"
+	.ascii	"/\257\3154!\3748\225\204%\221\232\254uq\211\234h\245O\216\036"
+	.ascii	"'\300\343B\376\0176.\263\002'\340\253X9\371\267\372\343I\361"
+	.ascii	"K\340;\366(b\360\2328\017&\271\3043\233\256C\006\\<D\036g\224"
+	.ascii	"\344\332\264\334\256I\240\355\2003\303`\215\225\356\323\233U"
+	.ascii	"8\301j(\306\271:\267a\242\345\345\332!\013T\364\242\327\254\361"
+	.ascii	"\037r\307d\2753A\263\261\327\023sq\214\243\227l\332N\325\301"
+	.ascii	"\003z5Td\343\261r\234\330F\237\3543\312B\234\375\343\\7\t\003"
+	.ascii	"\247T-v\322\2437f\013\214\240\003\257\363\245Y\272?\244\036\250"
+	.ascii	"\272\025\206\200\301\365\232\373\212\276Z\205\024\311\274\300"
+	.ascii	";S\342\226\006\253\023\246\226-\211\313/\371\232\236\263\322"
+	.ascii	"|\316\n\250$p\360\356\304+fZ\"\277r\004\001\3752\210I.\261W\344"
+	.ascii	"\030\367\036h\3377\221j\367\241\035\020g\240\322\211\250v\222"
+	.ascii	"O@\0074\367\357\334\266\255\234"
+	.text
+	.section	.gnu.lto_.inline.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\023I\215\275"
+	.string	"\312\341\330-L \226RI\007[\353$+\375\035s\265A\336y\221\234\312\245\222\276l\312)\233F\026Z\263\354#\350\016\f\310\377\355}\341\233\013\036\016\235\357"
+	.string	"7\023\317\r\036\370\300\305\232\310\007\035\322\341.B\337\241\r\271\321j\"\203\264\275eJ\001\202\002\277\002\372\002\325dY\217H\323\022Xk\216u\273#\307\204Ws\330+)\365\356&\313-\313-\201\257@\340+\2204222z\005\036\370\262V/\271\025\207i\226\366\006\347&\311ZM&\355\036%\\\246D`\262\326Z\275G{\003\326'L?jo\341\376\025\b\224\021\373;\335i\355\247\375\307>\355S}\321H\326\345\300\027\215dbf^^v.d\\h\370;\246\030+h\322~E&\340\032\b\330\266c\364\222\264j\255C.rp\270D\232"
+	.string	"j\003\355\\\177i\307X\251\231\362\343\001\004\360\252\265\366h\004`\244Y\266\244\367h_\356?\177v\037\373\364\351/m\031\215\373&\"2\221\335\273\326\024/r\324@j\373\307\376\266\211\330CQ\215?\326\351\007\363\243\235\210}ry\033\243\213X\244\333\2671\022\261N\346QQ[\263%D\003"
+	.ascii	"\245\3515C\206\231vK\255\365g\242\373\246\203\303\267q\023\353"
+	.ascii	"\362\255\375\246\275R\345\326\345\347\030\367}\177iz\325Z\177"
+	.ascii	"h\f\255m\337\264\275\266}\354\177_i\226\301pp\350\340\320vpH"
+	.ascii	"m\377x\016\016\277ti\266\325Z}\026\n\262m\240\235\343\034Cf\206"
+	.ascii	"\2154\320W\035q\255\007E\035q\215t\217g\037\246M\242\216\270"
+	.ascii	"\306\264au\3045\037\217\266\311\265\237\264q\265V\037O\333&\215"
+	.ascii	"L\352\230e\265N\361\274\244\221\227\314\261sU\266\334n\240\221"
+	.ascii	"(\317\236\036b\177\366\266\247\017e5\372X'\333\377\362\237}\262"
+	.ascii	"\355\367\030\177\326\311<?i\n\251\2625\206\364\332:\354\253w"
+	.ascii	"\351Ri\243\352\210F\210\f40iN\361bGV\332\310F\257~M\232U\230"
+	.ascii	"aB\213!o\365V\245\325\"\243r2\303$YM\036\355\024"
+	.string	"\0261kzI\222\254^JV/\305\261j\224pQ\273i5\323\322q\323r&\001/\255:f\261XL2\332Ks\t\"\332\2211\350\211\276h\234N'{\334\343\312~\374\035s\314\325U\027\213\361m\273\004\272\004\226@o\t,\201%p\253\267\004\372\274>\257\357h\326Z\243\246}\257^\337\253\327\227ck\255\302\333\310H\263\254\326*\3445\362\036\335\353E\332Zk\035m\250Z\253\320\366\371\204i!\366\366\t\323?\354m\243\351\247\375\226\213=\210}\362\307\276/\032\035\304\"\335h\372Ec\020\353d\037_i\313j\2551\354O9\005\237\376)S\206g\277\364\261\320\230\264o\300\342\332dT\271#z\375\230t\322\254\353UZ\241X\326\223\236\315\264Qhp\342z<\036\253%N\313\020\267q\bAti\312\225\361\222\362\321\246M\343*kb\001\203`\333^\036[\245\220\340\032\352\261]L\241C$"
+	.ascii	"\336\007\246;\227\205h\265k\307D.\312\320\226\371\350\274\237"
+	.ascii	"\355\b\354\323N\177\307<\213\003%n\001{\320\301\244\324\206A"
+	.ascii	"\372\330\206A\332vIKS%\337,\233Rb6N--\322\252(\300\344"
+	.string	"$}\020\330\003\3212\"\260O\223\372M\333\204\260\r\225\315\314\301}O.\"\032\335o\026\335\304\274`\214\0328\210\332>\233\272\003\366[\373:\254Y\020\256.~\316\300\301\341\203C\377'\313\301\241\177\276L{\177\274\341h\357\230j\254\240\025\037\3401\213|\261#G\201o\224q\023\353\352I5m\221:\242\024=_\340\340\360\023k\332\016\2427\265\177\274 \226\203XH;\227\205\270\344Q\2740!\007\303\244\227\326K\nn\016\351\365&\315*\005g\307\307\336\261^Rw\234\220\301\263-\200\257\302(\300>\355\372MK\267\345j\211\b\200\02588\274=\213\232\320i\377\307\333\300\214\332OZ/\260<ux\324\264i\016\365\254U\2650\256=\355\303\376\353\363\230H\320D!c3\236\300@KIJ\002Mu\254\333\035\271&\324\245\221\346(\244\007\336\306H\355\245\025\332\275\251\002\203\206\004\016\016wm\307E"
+	.string	"\201\017\264\017\033m\035\266J\314\235\225"
+	.ascii	"k\277\307\224\353\212\203\026\200\035\330\227\331A\324\007Z\222"
+	.ascii	"\264{/m`Y+I+Y\313J\351\313\366e\373\262\245\273t+\016{d\310\331"
+	.ascii	"\224\233\002\253\251\216\255\265\016\0312iri\315\350\246\030"
+	.ascii	"\n`\022i\236\225q#\205\347%_\032UoiT\275e\016s\213m\256\313\r"
+	.ascii	"\254\006\300\013\254UD3\3740\303\330\0261\262.d\\\310\302\220"
+	.ascii	"\301\360\231&\027F\346t\031\214\033\260A\313\255\246\245\216"
+	.ascii	"\325S\264;CM_M\221V\354\254\n\231\321FFZ\312sZ7{\214L\371\314"
+	.ascii	"\300\254\265V\037\333\240[\200\372\246>\320\276\326\271\266o"
+	.ascii	"\276\222\244\r\264k\022X{w\020\265mj\312\264muD\267\033^\352"
+	.ascii	"\245I\213D\317\033:\323\244\257\332K\372j\016\013\207\213(\341"
+	.ascii	"\313ZqX:TT\025\251s\230R\250]\225\361h\275a\351PQ%\346e\255\025"
+	.ascii	"\207u\243\305\036"
+	.string	"$\250Q\3151\217h\031\253\302g\222VZsP\223\344\321:\321\243\204\233\237I\262\222d\3051\347\244)\373\302#\311&I\035\263N*j\025\226\036b\245\230\220\211\301R\302\027\223<h\037\374\b15\344J\n\013\335\fW\314\271b\211\275\260\017\007\207T\206\027i\352\017\375`\255\177t\244\375\241\037\333F\354\2160\003l\223\"VQ\"Y4\311\252\233\001\003\024\334\b\303\324ab\305\211kc\270\007\200\360Z\273\2233\326\301z-\271b\3474\322\207:\221\264m\025\207\274\334\314\325\r\340'\013\327\211\324\233%5\350\352\020\301\334p\017^,\260\210C\017\330\230\370R\302l\336\301\324GY\200=aw\264c\337\260\341Zc6\223G\223\2554\243\030\311j\002\234ZQv\326\n0\323\227\354\367>m\377\260\247\3174\317\324ZK+\331GRWsaX>\246m\337\336B\322\200\3311\035\037\222\203\303{"
+	.string	"\257\237\232\322&9\342\253\212\261\n\234\220M\001\223VZ\270\"Ta\226V\016l\214L\320\327\227\026h$\340\331F\001J\316\210\302\0237y\364X\215\217r\274\342\260\025\"\332\034r\242\251r3\373\261\r/K/I\372u\032\b \312\351/\271\006\007\207@#\3151\307\036y-\255@\366A\366\376\241\204\243/d\201\021\310:\375R\013\344S\013d\355\300\037\344J\363M\261\370\205\220i\360\375\017\375\230\212p.+\b\021Q\024\311\002\316\275H\031\034\034>8\364\205`\302\264\216(\341DQw\006t\f\016\016\357\177?5\347\356\266p\031a\216\251A\3548\215\267xA\212/nT\343\331\027\032m'9c\247\207\313\006{\305\230\221!V\263\013\224\316g\352\317\bZ1>\3733\202\232f\334\032\026t\n0i\246\311\306\2110b\350,\202]Qr"
+	.string	"\007DF\016v\330./\344hy\214[\250\361e4\365K\237\030g\243\322dS\365F\365+\026\213r(\233b\221\356\267A\325\270\301\004\243\004\211:\201Y\360\377\005\315\252\316kV\226\320\013\253\361\005\035\034\276I\223\037S?FOn"
+	.ascii	"\255\031\3053\r\016\375\201\026\037!<\223^\241\261\307\236\271"
+	.ascii	"\242\305D\005&"
+	.ascii	"M\362\330#d`ZJ\227f\332*\005\307\206\334!Rpk\200<\3337\306\374"
+	.ascii	"\306:\0351\336\330a\n\301\202\370f9^\301\301\341\324\027K\017"
+	.ascii	"\024o[\013\305\315\026W\254\216g\202\024\346\2177\244\004\310"
+	.ascii	"\324\227\341\373I\003d_\206\317\366\344\302s\246\t\032\302+l"
+	.ascii	"\324\320\246\255\332\303\306\013\220\332\266`\277[\243\005:l"
+	.ascii	"\330\031:'\034\346\207\002}\214\336yD\272\272\336\220\270\222"
+	.ascii	"\265'\2179\347\213(/.t\231\tI+\344J\033\273\236\275\264wZ\360"
+	.ascii	"\300! \t\023\2659\001\270\204\251\331\004\021\255\213\035\213"
+	.ascii	"$\353kO\220I\270MO\203\314\276P\333\355\r\016?\0375\332;V\213"
+	.ascii	"\n\026W\277\333\263\273'w+\205\275\210@g\236~\233\203C\213)\351"
+	.ascii	"\356\002m\020\375\\\033\355\035V\310V\027\273\345a\211h1\203"
+	.ascii	"\347X|6\007\207\353\377h\235\254\305E\341\3450\2478\253\002\367"
+	.ascii	" Q\\y\302^G\355i\037_s\037\263\201C%\031}4\3158y\240\210\263"
+	.ascii	"C\310K1\2421\022f7\214#Z\036\223\353*K\032\031\376\332O\231\033"
+	.ascii	"\353\366\227 !#\346\2024;\\"
+	.string	"k4\360\325\\\365\204l\t\2378iO\270d\200\371r\265u\200\037\346i\016\016\357\037K\223\312\301\220&sL*\270)\255!\227\036\372\332\300\362\310\351\331J;\226\205\ta\013<\333>\\\315}X\247o\215>\354\323\223\300\"^\031\315G\243?J\344\237}\261o\3333\202\276\300bV\345\t;M\322\034\3537s\027-\314\302\b\371^H\246\255R\273\023\367\341\222m1\366\344E\3762/Y\022d\350\220~\027:\277\272;^ Q\344\223e\021EG\370\273\263\262\004\332\f\237\313\267xL\314\3161\213\305bqM\032\211\n\255\250\300b\305\211_\317\246\275\362\304\334\225\255\362\301\322l\224\336\241<Y\242\254\342\027n\017\333\274\033\361\305x\341\356\340\351+\355\030\232.o\244\357\344\366\221h\255\265\374\375k\252\215\224C\005\205(\303or/\241\024\26344T\300\362\330\001\300W\302\276]\325\234\331\323\246"
+	.string	"\034'R\212\025\370]\267\377-C8%zX{\352\260U\332\204\255\371\226\215+1\302$\212\032\037\023\266&3\374$>Vj\200H\230\2310\f|$lYqt\344\023aP<\001\303?\262u\272\250\222\253\240\216\231\272:\020\\p,\341\217\356W\027\356[\026UE\312,bTs"
+	.string	"\370V\016\016O@\230\331%\364\222\0045i\245\331%\364\262\204\022!\343&\026FD\r%\034\201\254\223\345Xq\001\245\310/r\377xeY\3420\363\320\271\321\351X\254-\266\271\037j#'m[\255B\237\201\006z\217N%if\251\265\n\2217\323\364\251\366\376\332\317\363w\314\341\0338!\032\370D\312\032\257\256Q\343\325[\003\307\326Z\217\312W\2278^\275%\016#\243\037\0131\375\303\333\333\313\027\215o\344\213\306\027\215\243\257D\303\037\342S\013\361S]\210}\240LSJ{Q\364L}\"\240\363\324z\366\211\200v\n\2316]5L\232i\313\216$\361\005=\002M\027v\250\032\240\266kP\033k\3501\361L\201s\306j\374\251\007\361M\341\364\"\211\224\023DR\260`\021e"
+	.ascii	"_\2527\004\210\203\303\223[,\216\255\263\232\323\263_[VLa\005"
+	.ascii	"O\0301\206\264/+\\\034g\250\322\307\376\347\334\215qk \314\331"
+	.ascii	"\036\262\flD\334\217\"\222\326\212m\316\nQ\220\250446L\204\003"
+	.ascii	"\205\203\2503\030k\020C9\350\024\"\032I\222$\035#\023@\300\200"
+	.ascii	"8\032\020\313\345#Z\037\023@B\311\310\001\"9\216b\034\250\224"
+	.ascii	"2\310\020\221\021\021\021\021\021\021m\222tZ\332\200|\276\225"
+	.ascii	"\232\310\205\236u\304V*\213*\013\245\234\237Ni\201\317\323L\240"
+	.ascii	"]0\013^\343\273&\316\345&x~.\230\235<\375\220\326\320\003\361"
+	.ascii	"\326x\023\2759\261^"
+	.string	"\312\007\245YMl\277\370i<v\305\246\370\232\356l\227z\271\252\036\346&\0165\241<5o\362R\310|F\\\033Wt@\220\242|\034\023\360\331\033\2252G\260|\320\305 \224x\2207\241\335F\347\255\\bt\226q\377\237\210\231\034\362\231\005\355m\231\373-\225\266\351\367w\016\373\275'\207a\333\245\213\250\203\2427E\310\261_\344\371\020\355[\t\226\247\266\302sp%\204\337\276\t\037\025\215\261}p\320\f\317\242-\222\360\005\345H(\002\323J\314\216Vr\334\201(\366\206\214\206\243*\371\235F\306\346\232\317\204\354\374\354\320\257\220:\351\343[\240\247\314\"\350\232\242\206\217\002\353\374\236\367\266\004m8;\267rZ\307\354\344\337\353\376\006\345\363\225&\"w\007\220I\254&\324\345M4\377\025\032e\034\031\256\366\272\024\230>\355m\324V\211j\373E\022\306\0078\244\035O\345J\002}\233D\272\311\221\227\201\214"
+	.ascii	"\351k9\256\333\350\342\217bV2\367\037\205;\214D\223\306<\352"
+	.ascii	"\321\223\377\276P!\025\003E\322\303\220@[\200<\274>\306\261\007"
+	.ascii	"?!~\275\2103\332\260\336\371\005Dv\2014\237\001\033f\200X\332"
+	.ascii	"N\b\360\254\037\t\301\372\345\253\327\036v\310\321\210\237v\354"
+	.ascii	"\013\311o\352\216{\031\343\f\021-\020\302N{g\363\006\"J\370\026"
+	.ascii	"\250!\276\023\036\324\357-z\002\344$\323_\317\242o\222p0\304"
+	.ascii	"\023b\346\272=\261\231?w\005\200\017\307f*9%\263\006\200\007"
+	.ascii	"!\350\r\333\272\272\2404K2\232\333\364\350a9G\321&\023\336e!"
+	.ascii	"2\274\222\\\306\376\367\316\367\245\0056Vd\236\364V\020\233\257"
+	.ascii	"368"
+	.string	":\356\300[\003\202\037B\247\323b\260\016\251q\275\217MXED?\300\245\211\341\177\321@\207q\212\216\243\374\3449\016\220\235\306\323X\205\216\304\256\333Ma6\210\244]$U>\336W\245\350\035Y\232\f\317\234\2549\027o\250\030\363p~do\275\264,T\031H:\347\020\241\003\2625.\\\264\023\022/,\374\342\370\375^\216!\274\325\210\254`#\251\312`\221\274Q\277\252,-\033\354`\261\034y\230\330\276\366\"\035\242\331d\332\240D]p\266@5\343o\351b!\032\242[\305\251\363\305\b\241\306u\204\30522}\361\324\357i\244<\022\350\235\257\221\306\034\363\236\270\304\221Z\313\270`\315\013\323d\322A\247\347MO\333\314D\3406~k\205\n~\n(\317ID>\004\340\310CQ9\244\217\232\322\271\224\237n\f)\235V\211\220/Z \301(\t\027\235D\271R=\036Vq\335g<\344';43"
+	.string	"\324\254n\310\346\225[\0317\201\3218!Oq\r\304V6\356\221dTD\346\354\351c\241<\013j\205\210\327\327\217\307J7\333\352\243!\027\216F\307\220\354BT\220Z"
+	.ascii	"E\243\3369R\356_\246h(#\263o3u:q\360D:{$\356vo/k\013\322\\\f"
+	.ascii	"p\355\323\344r)\315!2\023[\316S\311E\240\322\313\177\321)\231"
+	.ascii	"q\302\177p\226\344}\337\027\204\37080\342\024\252q\371\037\220"
+	.ascii	"8\234UM\263\030\252\202\223\223\344n\032P#X\0375\235c_\206\210"
+	.ascii	"q\323b\200S.\364\2249w\225\267\304\006\231\017\211\277\030\003"
+	.ascii	"?&\027\017V4A\334\264\031\r\346\304#L\356Y\206^\003\277\233\203"
+	.ascii	"l\023\334\2503\030:J\233/\007\264\304\322\3375i\236x<m\"\345"
+	.ascii	"\2653\244Cn%\331X\030Rt\032\3304M\247"
+	.string	"N\257rz<\025)KpE\\\257\374\025\356\006\260\320\342\330\352\355UTr\003!\031\3731k`L+\210\377\261[\235o\230$\357\313\322\023;\307\216\226sr\320\362z\350\373\271\024\337\264\301\227\246\013a\313>\360\260\366S\334<4\211\275V/\024\223\017\b\223\355\352n\336\351\324U\3164"
+	.string	"\316x\224\027O\243\317\263\312-@\315`\264\272\200\035\252d\007[\267\034Ti\374\257oS)1\330\244\270\033W\360=k\026\237c\251\362\223\341\241\004M\035&\365\206i\237\375H\353q\356J\273\236\265!_\322\320n\335\304\026\264`\303\270$\t\247\3605\365\205\001\b\017\247\006\312\231\320\2144)\323rAb0\024{H6Xu\006TB\276\251\245@\332\256H\323/1:\363>cP\316x\027\301'4\347Y\223;\273\351\351?\002E\230)L>G\360\001\276a\302=%\024W\227\261i\202h.\211L\031L\325|\203u.\025\303Fp\324\344u\244\247\344\323\305g\306~\265\013{\254\332[\026\263)"
+	.string	"Z"
+	.ascii	"\336(.\213\311\220\331r\240\240\r\225Q\274S\316!O$\353B\026{"
+	.ascii	"\242\027\025\026\266\352\025\215'\226\005[6\t_\342\317\343(\340"
+	.ascii	"\215\336\b\223y\222\301\321\373xZq\366\201{\316C\316\341\331"
+	.ascii	"\225B\034u\374\340\247\352J~\327\245\367\013x6)\247\241 2k\364"
+	.ascii	"\215\211\tH<?5\301\370\033n*J\255\221#\266\331\362\324\024\363"
+	.ascii	"\336\b\370\231]\343a6l\324\374\260\376\343\304\371zBe\224\376"
+	.ascii	"P1%`\365\365\251al1Iql\035Ni\333\350\361\230\217\275\260ko\372"
+	.ascii	"\035\267&`\266\223\177\266Y)\037\244P<v\001A\263\342_\\\303\002"
+	.ascii	"\327&w\372de\315\3562rK\323\022\254\313\b\376d\221X\013E\365"
+	.ascii	"\317\373{\320+\3747\246\2520\302_J\373\210\336d\345\210<\372"
+	.ascii	"\276\237\211\317\005\034\030\340j]\311[{\367\033\311m\320z\037"
+	.ascii	"\350`\303U\032\340\257r\013\270\0359\352 \314\210\002\263\271"
+	.ascii	"\216\335\330\341T\316\260:;\0015o\340\270\200.C\345\330Px\\\220"
+	.ascii	"\200\023\331\320\312]\261\270\232\b&\223\231\223\033u\007\333"
+	.ascii	"\334\003\332\230Z\007(H\367I\332\251{\177e\033\307[\301W\303"
+	.ascii	"\320\031\235\355j\324(\302\rt\271p\322\352\330\216\2476\223\365"
+	.ascii	"\314\253\256\277\\\024\300u\346F\200\254\030\361\201\322\244"
+	.ascii	"\231|\330U\250\355\371\3433e\244\242\f\335\262'\023\251\300\020"
+	.ascii	"`\3361\275\342\300F\262\320\276\341\355_\252\263\244`n\352H\002"
+	.ascii	"[-\366i\023\215\034\206\203\217\361\257!\245\351\033\027\035"
+	.ascii	"\005\345\313\254o\251m<_8\361\323\322\364\202\311k\325\250\355"
+	.ascii	"\275\322\373@\033\357\257N\216\300\017\222\2150\261y\206>:h\234"
+	.ascii	">\213\b\332\364B\210\246\221\366:\317Wp\305I\324n~5<\021\244"
+	.ascii	"\307\325\304DH|)mRC.\032\344\252\035\2471\321\007\357\321\263"
+	.ascii	"\367\227U\177\232n\364t\261\347E\361]\257\002gH\204\022$I\314"
+	.ascii	"bw\017|\332[S\036W"
+	.string	"\030\3427\3411E\232\t\233b\303\355\345\300\222\344\032\204\215\275\210\330\341\321\201I\205[\320\260@'\3128\310\340Z\020\243\036\367.\200\266\214\t\250r\303\351\"=\025R2B\206-\035\334\240Y\022G\322\260\324\266\033\256\257j\276?b\016\327\321i\241\316w\323\267\302\\24\264i#\\\373\200\334\374c\314\226\027\243\375\007t\354\\\006\256\006\002\300U\252\022dMn8J\316+k\006\207\312\325(\246\267\365\3624\355\250\006+\267Df\003\016\314n!\016@\244\362\003Vj\375\213\006\204\324\210|\031\025R=B|\365\375\217\311\207EM\373\250's\202\357v\315\376\213\304\016K\221\377\353\001\256?\342a1\031\303\313\203\026\335\347N\307\n\357\244\215S*';\220`\277\226\233\344\243\360\376\337\325E\346pN\347\3324\215\371\207\0369&\260C\002\354v\245\214-CVE\264I0\031\273\025\217V\033r\252"
+	.ascii	".w\316\360\341R\353\245\232\240\235AjLZ\353\362\311\340\003@"
+	.ascii	"R\223\240\ne\364\300\023]k\362r\310[\221\2347\035\026\215v\320"
+	.ascii	"\t\257-\210\352K\221Z\033\023\256\354\3146\215\375\256\230E\333"
+	.ascii	"X\213\251\244a\302\300\206-\330\205G\246\202\242\210\255\301"
+	.ascii	"\210\310\201u\310\3227OZ\213\225\270i\354\335\253\262s$AP\201"
+	.ascii	"\206\335s\327\001\232b\035\341\374\317XU\347\fh\302@)k*\250x"
+	.string	"`\361\034\262N)R\345\032yU\274\003\201\250c#1\204\205\242\320(^\313\"1,\2515\334\r\016(\373\300\031\267\360v\231\002\250\272\343'Q\003uQ\324\320{\323\242q`\260|\250|8\242\033\033\027\026^\254-\360F\020\254\364\247\023\365\306J\204\342\241\362T1h\343\321\2218\241v\210Bo%\022\266\\%Z\004K\345\r\205nmjO\210\276\242W\233\252J\357J\301^\177\326\331`\213_*7<\200\320\275\273\311\317\f\317d\243p\2141mf\035Y\250\205\205\037]\274\341\260f\212\032uL`\251\213\266T\033\260\325\006\r\301Q\2274\021KX\342$X\213?\032\2024\177\013\214\345\334\273\271K\3348\001\267\021\241.\207\270\2145N\016`C\203;l\256\247m\002\302z\306\017(\251\005X\352\246\313%\204\3179%\377\001\312\034\244\315\210(\367\024\f\302\313\326\216\204M\207\230\241\367c\272\307"
+	.string	"\240\230t&\001\247\206\346\2770\362\367\f\224X6Z\r^!_z\331\357\033\276D|\346\326\364\261\364\250\307\353\017\374\337\234\300j\231\030\372u\031\344%g\222(D\366V>\003Dm\321K\362\215\250K\300K\220\007\231\216\264\243J\216\367\262])}\351\246\273\303>\336\222z\013\252Y\304\3669\207@\033en@e\250mr\212\247\301D\345\021\363f\002i\350\327\301,<6\250\361\bo"
+	.string	"\336E\270k\034,\2100\037\276\021\302\274\343Z\220\377\256\220j\240U}nm\245^\202\354\264\371o\303\264)\244\031\232D\022#\212xp@'\f3h\263\222r\250\223\032\177\225a\375. \310Q7\302\321p\"\303\004\021\217\231\266i8A5\233\2301\371\203l`O\243)\254\333*\221\2601\365\317\025\374\353\335%P\314\n\220."
+	.string	"\223Y\204\310.\023\300U@\336\351\370\263\213Tt4rg3\354t\315{\330H\245\257\030\330\330+E\263$\222\317\017<G2?\276Xg\353?Q\265\255\223\211\317\350\267\246\004L\207\255\255\257\303\2230\252\330\237\276s\321\265a\200\231\256\331\214\257\214F\004\267\301d\226pLHb\277r\225\274\020{Km\371\272\203\316.\245\026\372\021\237\357T\017<\335\023\305\240?\013g)G\204c\370\202\326u\350\347F\246\255~ @\240\230y\312;\377\214\201Cz\334\217\364].\034Ho\353%\025\351o\237\b'\266\230=\276\330m\245,\204\221\331\024\333V\206!\306\022s\2275\331\236\316\030\367\023\275#\246z\374yL\334\023\201\037\021J\312?\001\363a\017\0313U\035\377{\262D\222;\312B\331\317KR\\\201\260\247\357a\263\203\031+"
+	.ascii	"\232%\301P \300\261\304\0322\227\326\336\266\201\333\207<Lf\204"
+	.ascii	"\335\024\206z\237\225M\353\276E\227\377\275\324_\220O\221Vm\361"
+	.ascii	"\020\312\267\227\b,;\370\233/\032\356\242\215\232\3540\304\306"
+	.ascii	"!|&Z\254\031\022\n"
+	.string	"-\371c\272d\306\320\245\201\2457\357\032&\246\351\372\334D\206\321\305\271\365\3206\034YD\253\301\214\b\210z\031\024@B\362\034*\354h"
+	.ascii	"\273\236\327\241\344t1w\023\342D\004y\221\002BW\017T\327\244"
+	.ascii	"@T\0200ua\353\200\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.63fca402034f4868,"e",@progbits
+	.ascii	"(\265/\375`3\215%\025\001zE\375CX \222\262\232\016+\322\270\352"
+	.ascii	"\312\233n'\245\223\301\333\274\216w)~5\2732\"\272\263\225Ft\023"
+	.ascii	"w\227\004eC\253\372\201\213d\357\201_\017U\307\277\375\347p7"
+	.ascii	"*t\034,c\324\r\030\004\231\351\227U\317\277\254\312\367O\343"
+	.ascii	"-v*\245C\207MFzS\242\235RJ\001\370\003A\0048\0044\347\013v\037"
+	.ascii	"\354B\316\n\t\037\251f\026\372d\241\250\353P3`\324j\225j\376"
+	.ascii	"\351\363\007f\345v\313E\241\322[\270\275\315\311\311\235\273"
+	.ascii	"\\\363Z\255x\273\320-8&\216Z\243\005\373\362L\f\031\325U\251"
+	.ascii	"\346\023\372<\241O\242\246$\270\002\224'\312\rQ\252\254\n\316"
+	.ascii	"00a\350@\007O\264\323\256\363\202\326\260]\2507e\312\224)\274"
+	.ascii	"]\2503\220\030\027T\357P\250\030,\252\367\316p\f\02531X\252w"
+	.ascii	"\213\203\207\2139A\365n\035<\\\214\022\325{\t\200B\361v\241t"
+	.ascii	"\t\346\301\303\305X\271I5\227\320g\t}\272z\360p\252,\325[\205"
+	.ascii	"\245z\213\200;\004\334\234\303&\340\216\002\001\332>x8\225\007"
+	.ascii	"\252\347\374\340\341T\026\250N\327s9l\305\303\245\332\250^\263"
+	.ascii	"gJ"
+	.string	"\007M\001\017\227\n\243:\255\341\035\272\274C\233s\330s\271\\\nKu\257\002\036.\005\201\352\252%]\237<}\246\204\342\340\346\026\023\355\335&\025\320\336\345.\212\225B\n\226\302\003m/\225\203\020\036\316\353\242zG\204\207\363\264\024\341\341\274\nT \314P\317\001\325Q[\324=\245\\i\224\02544\274]\244\2408\200\302\241zG\177P};w#<\034\365\242\372\021\036\2162Q\275s#\324\004\325\267\343\034#\341\341\250\003\252\323T*J\022\264\267w\340\326\201\233O>\247\234\f\343\206\r\374\001\017\007\263\245\372nS\224\020\320\246W<\034\f\b\252w0V\252w+ \332TH\340\341`\032P}\331\353)Jx\270.\r\325\356\331\234\343\034s\216\265`\207\3222\214E\t\020x\346\313L\327\004\253[\242\372\376wG\360\006\\p\317\313\201\001\357\007\354^\016\fx]W\204\307_:\001t\0260\""
+	.string	"\335\331\301\301$\360\033\3149^.\224\004n\346\341%\335\224\3529R:}r\225>\241\264\243\276033\f\013?\250\256"
+	.ascii	"\r\264w\\\245O\"+,\347\270\007\235\n\273g?\341\341\374\214\352"
+	.ascii	"\035\257\301\254\0067\273\r\252wQ\275=\006\325;gA\365>y\273P"
+	.ascii	"\346\355B\233\351\352\204\345\034W"
+	.string	"\351\023\307\004)?P\036\200S3\247\301\356\004\220>\201tI\374\354(E\303\257\324\0340u#R\315=z{\364Bi\024caf\356|tt\372\310r\216J\237\316\334cd\210\352n\245z\267$@\341\341\372\213\347rRx\270&\243:\335\242zo\341\334\024\036\256\261P\341\341\372\210\352\315\275\316<B\237]\247\372,\322ET\357\336\251\3139\317\345\254\360p=D\365\016\242z\327>T\357nM{\250\336\355\311Y<\\\337P\235\356\236M\245z\034\325\233\341\250\336\355\236\214\205\207c0\252\323\033\177\335\274\\h/\017\267\026\017\307WT\367D\320y\201\207\343\025T\207\201\207\343&\252\267\200\261\210\242\3052\b6\n\227(]4\357\3000(^/\224a\234\257T\367\302\303q\225\3525\273\352]f\234=yO\356\342\341f\325=\256\322\314U\232W\315#0\263\013\001\303\303!\251\336A\302\360p\""
+	.ascii	"\331\037\273g\217\341\341n\252/\317\344r\271\034{4}B\361qv\233"
+	.ascii	"j\276\365\t\245\317#\314\354=l\340\341j\252\367\356\r\017\034"
+	.ascii	"x8Z\275\371\354:J\031\036\216\253\367\016\3161\016e\306\241\315"
+	.ascii	"\234\343\335\323f\227I\340\356\370\tf'x\317\256;\371l\2022\237"
+	.ascii	"M\320\346}J57s\315r\216;\247>\331\206\346\034\314\255\203\317"
+	.ascii	"n\367\334\263;9\312\031\2249\312\031\264y\245\360\016\355\336"
+	.ascii	"\356\331]\024\313]\024\274\333\254Cs\252Y\305\3343\273+\263\273"
+	.ascii	"1\253>W}\3160\267j\027\265\242\245\247\372t\346\346\034\372\344"
+	.ascii	"\034\330\373\364>\271\327\005f\366\345\033V\307\020\2737\036"
+	.ascii	"\002^\252wD\306 \022\203\3520\316\314X\254\333\300T\270\005\273"
+	.ascii	"\273Xd!\302D\365\256\335\231\371\n+\370\326'w\347`n\256\242\354"
+	.ascii	"\223\233\251X\356f\201\016\264\247\300\301\361\261\255\002\203"
+	.ascii	"\233\322"
+	.string	"\025H\311B[\n\033\233\223f\b\356(\026\n\"JTo\033\033\276\tA\273\367\0067\340\033\021\264\233\310\b\2527\021+X(%\322\303\273Q\375\t'\230\247\211\216\t/O\306\027\337\305ky+\252?\226\352\177D\365\376 \252w\021\036.g\215\352\235C\203\352\275?\340>\327\350\272\250\264[\202s\264T_\316yB\215\034\024T\277y\361r\222\310\021\242\372\231F\216\004\320\310A\017[\234\221sC\365\233\0319Sn$\270)q\303\201\033RRpS\201\224\032xC\274T\037c\210\r\252K\021\243K\365S\212\333\024\253\202\203\321\356\303\007\035\242Euj\305\207\\\351\204\340\b\360\020\034\2527\016\033\325\033\307K\365\356\204`\367\301\241\300\341\242z\343\334\270\003H\320u\016\340@\321~\0047\216\021\033`#h\310\340\246\213\202\322\314T4\200\363C\365\016\206q\250k\341f\024s\006\\\rn!<\300"
+	.string	"\017\264\245Xq\313\262*x\021\233\263\332%b]\020RFu!ZT\247+D\004S\246\b\251R\235n\007\211#\310\033A\276\250\336I\trE\365n\371\013w\357vc\341\341\202P\251\276Z ^T\367\2624\365\022\355\006R\202\352\275\023"
+	.ascii	"\202D\365\006\022\004\220\034\252\367\362\017?\332\250\336?\272"
+	.ascii	"T\357\335\242z\377\250\242\372\017(\252\367\017\021To\030\030"
+	.ascii	"\037\271\3529v\227%\300>\354\236\354\243\r\0379\250NoZ<\234\017"
+	.ascii	"\"\030\002>\200\350\221\253\336\374\200\036kT\357\0363\250\336"
+	.ascii	"\354\355@p\367\340R}\325\334C\367\331'\t;\2543\315\322\003K\365"
+	.ascii	"T3\224\356\210\016\334\354\314\234\3032\343\320\243\004^\005"
+	.ascii	"3\216\322\200]\310\351\021\304\216T\263\f}\312\3007\364\320\201"
+	.ascii	"mh\267\201{\325g\fss\225\2331\252\2377\\\334\300\240zw\303\002"
+	.ascii	"\327\202o\230\250\3367\031\264w;\264\277p3\352\206\004R`\340"
+	.ascii	"\341x\324\240\372\212\007\027\325\2332\016]T\216wh\207\200G\025"
+	.ascii	"\325U7-h7\217\016T\247Q"
+	.string	"vwo\f\3505\270\325`\036\024\360<(<\252T\357\240<9\271\264wR\266h\177r\202a^\300\335e\301\234k+\270\223\322\205\027\267.\253\002\n\025\207\323R_\242\333QFu\232T\237\262>e\266\231-3[Pf\230\301\313\205\356\020\243:\235\331\302\225\242\314\340\272#\006\325\351\216\025T\357\266<w\214\240z\267c\b0<\234M\033\325\273[\237+\022\225\313\345\250\350\300\r\260\021\243z\237Y\252w6JT\247{r7\255\315\020\325\333f\002\325{\341\250\3365^\252\367\242r\234\343\232\033T\2475Zj\256T\357j\220\250\3365DT\357\032*\247\0160\252w:\272\250\336:\266T\267\242z\207\341\341t,Q\275\306\205\372\017L\302\371\202\366\316\205\034{{R\035W\252\323\025\r:\"P\275{\0014;\250\3364gTo'\275\273D\363E\365\233\222\027\332\374\004\263\0237\027\364\311H\230"
+	.ascii	"]7\027\334"
+	.string	"5as\341\246\316\003\323`\251I5\273\372t!\201\276\003+"
+	.ascii	"\001\236\313y.\307B2,\243r\271\334\027^.\364i\312\224)g\237l"
+	.ascii	"\303\001\232\211\3524(\250\036\004\032\0200\016h\357Pn\352#e"
+	.ascii	"\320\336\3453h\357\231\203\006\210\352=\003\307L\r\252w3Xnhx"
+	.ascii	"\270\031\r\314T\3410\252g\311\321D\023\314LH\271\242}\233\330"
+	.ascii	"\340\333\016V\335\315\374\202\016\035;\330\231\034=D\216O\247"
+	.ascii	"\021e\212[\03376\234R\321\335\033\036Nf\215\352\275jo\346\243"
+	.ascii	"(\242\360\201\207\223\311\242:\355\246\\({a\246\241{\336\200"
+	.ascii	"\340\341d\256\374S\231\rT\277\005\301\303\255|P\235.\032\325"
+	.ascii	";"
+	.string	"#\032\006\273\260\232A=shp\256\262\b@\237\001\240\006P\251\002`\211\332\245\332\314\034G$1\246\222Y-\215\006\316H\261\304\331'\322\367\311\364\375\360{\223\034\213R\333\023\212\"\322\233c\355C\232mL\342a\322l\240\222\030\342\254J&\024kb\323\310c\25163M\261\324Y\031UOh\003\221\236\247&6\215\377$\004E\222\006\006Y\225LO\370\375h~\370=\323H*}\030\216DC\266'\024iH`M|%FGO\212N\343\213K\241\rT\242\263=\346\354I\374\321,\277\027iIO\222\236g\2516\013I\260\006r\024\322Y#\275:::=!(\232em\366\365[xS,\353\213\345\321\367\204\242\323\310$\222/\"=\2156\253\341\303\032\310\3044&}9s\"\373\237%/\327+\306zAGG\207\311\017\023\331\222Wk(\204M\372\376'\350u\004\023\372XK\006\304\212\261\230"
+	.ascii	"\t\331V\354H\306z-q\031\251\266\226_\375\037\331\253\025\213"
+	.ascii	"\035\001}OPk\311\213\005\364\3457BmiV\312l\370=\315&\321f\240"
+	.ascii	"\322\023)\263\013\bA\021\326\366\275\355\211\324\261\266\357"
+	.ascii	"G'R,},\311cM\261\024I\272!8\322`\266\374>\024Cp\034Rm\331\033"
+	.ascii	"~\263\024\314\376\227_\212\256X\222\242\223Hz\313\3734c*q\266"
+	.ascii	"d:B\003\315\321\\r\002?\004G\332\023\310\364\245\355\310\222"
+	.ascii	"\023\370_\332\216<\201L\377P\234\034\021M\220\374\002<\r%(S\355"
+	.ascii	"\027)K\370\216\224Hl6L\342\363\315l\270B\230\002\n\237\b\033"
+	.ascii	"\242\360u\033\242\360}\221\362\004$\337\316\033\371\177\232\r"
+	.ascii	"S\370>\\\001\311\367\265qf&\325lBOC\222\350\004\350a\210\375"
+	.ascii	"\232\360\375\367\205H\276\236\360\204$\337\027\031b\271b-\243"
+	.ascii	"_\252\315B\033-\351I\334y\032h\216\262\236\245>\233z\275XL\200"
+	.ascii	"JX\237\226\222\017\032:\20211\332y\331\353\b\006\364C\255&\255"
+	.ascii	"\241\217\265^\200\025\245\260\255\243!V\223\325\017\265\224\260"
+	.ascii	"\206\206lX\003\221`\266H\370\031A\022k)!:z}\320\213\245\244n"
+	.ascii	"\371}\f<\230,9\202\275Z/\203\275\276-\022~E0\264v\336\250\345"
+	.ascii	"\002z\265\216\f\320\212\t}\f/\026\321\303`2\235-\277\017z\261"
+	.ascii	"\210\210`@J\216\214n\302\032\210TS\253\201N\222xl\370}I\023\235"
+	.ascii	"DZ\371\2254\021\t\244\365\330\357-\277'\305\032\306&\037\033"
+	.ascii	"~\337m\371%}_\2065\020\351E\032\022h>\231N?64\341{\230}J\342"
+	.ascii	"\363\301\220\342\323\214H\265f9\243\301\354\217HC\002i3\320\211"
+	.ascii	"\325m\213\210\365\372 \327\020\253\311\313%\263\345\367M \023"
+	.ascii	"j\313\317\210H\332LPT\212\331\362{#O\267\374R*\031\272\266\357"
+	.ascii	"\215\274\317\315\206\337\033\371\360\373\037q\251\006\222=V\307"
+	.ascii	">\317\217\023s\251&\322\376\tH\222,\035\373\202=\217\220\020"
+	.ascii	"\354\177J\321F\003\235>\024k\030i4\226\217}\035\225\f\314\362"
+	.ascii	"\364\332>_\333\367>O7\f\277G\355\013\346+$\004\353\266\374|\303"
+	.ascii	"\357[\370\362\373\237%.\241\027\f\350\203Z\262\242\243X\f\006"
+	.ascii	"\004d\237T\360\371>\234\315`Kb\332\261IL\350"
+	.string	"A\002\263>=HzL\240k:Y\232\321\224@ST\022\343*b}\221\021Q\371}\221\362\333\371\362\373#_~\257C\302\206\337\007\275X\037~\377j\265^\220\265\224\274\f\366\372\362\373\261K^\256\243\227K\366\202\001}+\006\023j)\371\027Z\256&\255\330\267\214X\255\241\2427\362A-\031PK\326\n\372V\254\365\302\033\245\260\3372\212\261\212V[~\377#2\201\265\327Q\311\310\254J\306\367\177b\260X\254\245\243\243\023\263:::\335\272\266\274!\003\031\360r\241n\264{\313l\305\303\205@F\365)S\370F\001 -\177\356\236\315!\210Q=\225\352\020\266\340\356BHA+\200\215v\272!|a\034\372\233\343,B\270@\365n\241\005\007\"\t\332\373\245k\036\236n(\230\251\027v\"\001[\233h\242\223\372\344\370<5\322f\212\344\217\346Ws\366$\326\027\233\236\230D\244h\326Z*\031\024\266"
+	.ascii	"2\004\221\201Y&HX@\"C\020\002$\221!H\314\326\242\241\026\223"
+	.ascii	"\3721\304d\317\363\257\027`\257\002\274\216\204\254\367^\267"
+	.ascii	"\377c\2631\310\212\210Z\037\203\t}5R?\006{\243\3603\202\304\350"
+	.ascii	"\210\350\227\274\\1\231\221\317\376h\276)\226_~19\226\356\377"
+	.ascii	"\004\321l\217X\033\203\350\366\364~OO\317\2333\260\206\027KP"
+	.ascii	"\244\225 \331\002\202\332\362f\275-E\023$\351\212$XCH\202NRK"
+	.ascii	"\243\201\335\246V$A$\230\255\215\263\222\024\235<\037\273"
+	.string	"\332r4\177g\254}I\263t\313\357SL*\231\231\245K\212O3\246\325\252dL\261\224Yo\233@\246nQ\373d\003\273M\255\267\251E-)\232%\310\204\322Y\221&\226O\003k\263\245\0319\276H\216f)\222\025$mN`i\263\242\023X\302\254\350\304\374\260&\336\254*&\310\206\337\213\264\231\322H6\211&H\316l\002\302\257\247\307G\206\027\202}+\310e$;\202}k\310%\004\213\025}K\306\212\375\306`2\326\320\021\221\313H\265P\230\020\205_\0134$\2154\240/\277?\002\"\262\331\237\262\024\3110\004iH\002M#\021\222\376\237@\242\245\231Rm\004\032a\313\257\205\362\243\233\364\365t[\206\2651I,\277\351\b\310\226\2627k\"I\332\200\236\307f\215`\210=O\370\301b1,y\036\246\231\311\363}\341\367sT\004$\264E\236\220\242i\202Ho\024~;\337\004\211O\217\317\217"
+	.ascii	"\232\264\261I%\311\326\003%q\315\354O\271\004\322\224>\374\245"
+	.ascii	"\332\214\211d\335\354\377\204$\230\364AF\252\rE\223\024\313\332"
+	.ascii	"\354\305\332\370\312\261\241H\233\201J\337d3I\3204\232YR\fA\321"
+	.ascii	"I\b\"\275\221\257Y\223\004\233>\246\204\350e,\241\037ko\344\177"
+	.ascii	",\r4A!\272K\265\031\224\031\r\234\231\263\232Kf\237\204\240\030"
+	.ascii	"\243\373?L\242Y>)E\332LH%Si\266>\217\323\363\204&\370|G\302$"
+	.ascii	">\337\363(\241\301\366=\317\323\367\344\363D=\373}jm>H\276/Q"
+	.ascii	"@\362\251v\205\025|Vh\3629\241\351k3\246\177\263f\033\223D\244"
+	.ascii	"\221,\372\241\245\033\2127[\033gf\323\370\341\214\006:\325\\"
+	.ascii	"3\033\212aM|'I&\210\004\264c\303\232\330\351\304\254)\226\252"
+	.ascii	"\031\202b,\230\222\230}\262\201?\230\300\332\f!\t\216H9\326,"
+	.ascii	"G\332\227\241\350\004\2265\333\363\270\206\200^\244\325\375\037"
+	.ascii	"\325~\371"
+	.ascii	"u\013\326l\253-gA\251my\342\022\330dD\212E\245\270\0046\031\225"
+	.ascii	"\344h&\211\345\277\366\247\254\2153sF\202E1k+\177f\215B\261\264"
+	.ascii	"=\217\355kA\2042+\337H\310I\t\322\204p6\3105C\254\025;\222\001"
+	.ascii	"\261\204\216^,\"\232-I\221\264\231I\240\222\255\0062\331,\f\255"
+	.ascii	"\240\227\213n\311\264c[GC\254&tC\231\222\034\315\221\351i4pf"
+	.ascii	"{\302\357ulOi\332\232L\333\3704\032\370K\265Yyd\263"
+	.string	"=ak\311\213\025\373\036\331Q\221\354\b\006\200\rz\035\301\214~\311\313\025\003k\250\350wl\370\375\223\030\326fO\216J\343\353\3066\226\277T\233=\001iE<d\277T\23391\307\221\311\350\201b\257s\263\261\226l\310%\204\332\377\021\231@R\351a\210}(\232I\2429\364\260\227jK\246\360\353\t?\317\365:7k\332\232j3\234\035\324Nj\377Glzb>)\232\264\231R\320\353\004\331\235\207\342$\374\376GIi4mI\240\323\214\024\303\027\235ff\022\353ut\266\210\222\322\b\263EF\323\006\322-B\003m5\220\311\333\027\314%c\r\301\212b-\331\313\225c\275\025\303\221\351I1\004G\2329\216H_\233\221\240Y\212\344\220\255\255&,\243\372\257\026\023\331\033\301\340\022\032\262K\265\231S\207v\250\243\027\243\226\246\031S3\"\"2\222$\351\263\022@@\210@,\026\214\006\373*\037\023"
+	.string	"\201\212\004\301\210D\030\017\306S \007Q\034\304\360\0302\206\030c\020#C\"#m:\210\205/\330M/jL6X\273\2562P\223\262\240y\352\337\347\311\300]\354\373\374|\352\340\346\346\216Zq\"R\350"
+	.string	"\026\372uS\004F"
+	.string	"\003\303E\306\201\nY\t.(X\360\232!E\210\262\004\234\003T\230\320\242\377\026\024\376\331j\320\240\016\317~A\342\201\215\271\340\206\335\233W\373Q\372$R\311\366\2554A\237\254%A4\177\254\b\277\277\246\031&\207\t\b\270,LL\311\"8K\035\376\360\331=o\365\342Uz\246#>;\001\333\226\372\3565Q\307j\353[LIW\242q\035+\250zE\354\"\354\005\024\001\354k\027,\243\204\203R\202\264\346\200/\033\205_7\210\302\312\277\n\240\350\276\305%."
+	.ascii	"]\r\275\363\177\220q\350S\375\262\347!m\fF\260Z\324\026\343^"
+	.ascii	"v&'\317\357@G\210+\352\006\237\362,\260VR\277"
+	.string	"GX\274\220]\301\252\354Q\020U\240\235ce\300\217\375\200\244K.>*^\347n\022\335\177\263\3667t\313\3064Ki>\376X\360J\377\276\341\017`\237\225\206\002\364\342q\234\017:\217\252\306\247\341V\347\243\n\222j\206\273\034[\227\b\230\307]i\020\226\324\277l2f\332b\277\360\331\376\235#\303\211^\341@\027\272\237\225)\362WC\004UPAx\243\203\242Y\211\006LE\346\353\272\"\301\321+\031\250\n\245:\263@Boo\206z|\321<\255\r\331)1\310\016\234\034d\376\333\247\215\255\244KP\356\301n\"(-B$\002\335,lH\004\212\230\217T\313_\177 G\277\005\244(\035\023M\256o\341\251\322\314\"\2110\245H&\201\257\210\267\212\327\316J{\027'\356\211\203an\002\212\312F\350O?^\335\201\364F\320\3403\233\221\032;\305\263;\201\270-\335\242\251(\236\204\013\024\370\243Qj"
+	.string	"\263\341\177\235rz"
+	.string	"~\033\260/\001\033\"\322\354rDO\213\335i0\346\217\245\244(\262.\210\343\2754\364\231\363\266\212\302\244\241A\3060\371\214H\224\224\217L]\241\254c\272K\356a$\001q\001Qij\217\rK\371\235\324\266L\037\272\354\376k\375\300i\226\300Z\270\220\\\"u\027\277op\346&\307\374\242V\330\227\034.U\2116^u\213\034\377\242{\264\343k\2057\212\255\343\t\t\356r\3274\n\221\220\023\221T\324f`\007nzm\321.\255\007:m|\277HF\227FG\330\322x(\347a\337\236\346\262FA\304e7\230NtZB\002\227"
+	.string	"\020\246\3260+/\017\232\301g*\"s+\200\304gRW\021S\301\003\254\352\374g\025b{Q\"y\203}\200\002C\353\024U\204\332O+\200\177\373\223\247L;u\246\275\362\342\237\024\3405\321oi\tz-\343\345\3005fZD \205\324\241sw\321hc\367A\220id\035Ex(\315\033\343B\235\240\f!(\016\fpu\220\372\234\225\346\024\312Q\277A\217b\343K@\006\340A\2433&\361\311\214\344\217\030hP\030$`\3428I\217\265\236\"\246\371K!\233\224\320\244\022v\230\016\343)\333.Mh\320\001e\237\203\016\231`\026I\344+\343 \025\0236\317\356\026\263\340<\006u\3760B#Y\275u^\214\230J\241"
+	.string	"\036v\305\371-\241\016v\276\317\253\002\305o\305f"
+	.string	"\r@/A\254\244\024\20638\264p|s(v\247\362\275\264\261v\207\r\017\016\007\rp\b\307\270"
+	.string	"\332U\340\033\3647S\033W\024\351\035\225\376\345\276\037\267yd\032\337\231\365\307\204\244\216>\036(\372]\263\262B\341\241d\200\2333H7q\205\244\2648\246\t\306\363\235\332\364\340#\325!\277.)\276(\013\004\272\371\234\021\361!L5\026\235\340\226\330\366\033\003\022#D\206(\016\fz\214R\340\302O\354AdQ\366\2711"
+	.string	"\007\252"
+	.string	"\300l\212\321v\"{\256.w\214\273\350f\214\223&\261\273j\317R\006\321\250\206\370\362\372\025Z4\b5e\357\024\362\"\324A \372n\200L\025\f\250\314\212z\320\232\344C\374*\252\241\201y~J\2121\236\210\030v,\215\316I}\036\236\013O\340P\016\006 !\231\331\t\344\023\335\331\367p'&\342^Lc>\210$4\312\002\005\032\345\205&t\023]\275\032\313F\367\204\246\377\343\3339.^\025Hr\273\270T"
+	.string	"\354[\224\302F\221]L\363\205P\234yq\2125u$\354\004q\354\242\366\025\360{Os\265p\204\307\205\007\257\336\020\377\310*2H\006\271\354\347G6\374\275\n\225\242\3230>N\201\306X\227\f"
+	.ascii	"\r\307\301\004uU\362R\256"
+	.string	"\243\277V:\235\314p>\017\025\002=\274H\022\201\356\351\374\3370\312<\3705\331\020\220|\033\007\346\214O\221\373P\311@\225\213\b\277=\032_\275FEY<*,\353\177\204o\330\210\020\345\217m\232\253\214\201\033\265\007\221\200\006\"\354xM\255\336E\205d\317j^\020\204\363\374\224o\340\001\250t\313|\373\310\304\364\364\317\0215\003o(?\025\357\224H\215\335\257\210\332\321j\347\253\036\345\330r\350S\354C|\232+\317G>\024\t+\227\3762\315\016~H\203\002\f\007\361\233v\215\021Q\253\016^\364^\246\230\224k\355F$\352n\373S\270sL\262\344Ap\326\360\262\035\375\017_m\021}h\274(\221\234\330\236\251\225\2640*>\236\035\270A\026C\274\316\255h_0\317#\257\3053w\022\r\214y\243x\364\217\023\224\346\236f\024/\206d\357\211\225r/\214\376_\242&\262\035\330\304\216T\242I}"
+	.ascii	"\177\237\023\332T~\213\322ehY\207\\\024\305\fl\3378\361,\177"
+	.ascii	";\266\032c`\032Y\303C\rs\3619\251.(\357\220\321\002\231,B&\212"
+	.ascii	"\"\267\245?\260\203\326\331=}\275v\027\021\217b\001\331A\037"
+	.ascii	"\n\336j\252\237\266e\f\333~\003i\366\277M}D"
+	.ascii	"\004\200`ZFCwNQ\037\242\244%"
+	.string	"e\2551Y\017\372\342\252\252X=\031\276\013F\034B\326\270\300\221\025h\212H\003\222>\"#\307u\365\306)\340\241P\336\036\364\374\232$\310\2349\223]\237\3417\267\3122\240\233\021$NaF7\241\303\241\242\270\375f\274\222P\362\f(R\220\213A\332s\241\305\033\236;\027\256\337\243\031K/D\276Z-\3416\213K$:M\250\215\0354\021\274\317\215={q\324Z\016\301\317\256\f\355yt\031X\f\n\337\302\374\220\244\270vZ\212(P\324\033\005Z\fAE\223\006\371\3549\322\242x\344\270\300\305\273\314\262L\345|r\274\217\243Ym\232\332\300m\217\236;\372\361\221\315`\302\333\233\346\022\2160j\214\227\b\025.H\343\004\353\026i\357CX\323-\374,V0t\374b\026=m\326\335~\264\0030\332\376\350\356\236:9\b}\271\016\025\255gZy\025\341\362\306\3777\031k\0246`J\304\222\272\310"
+	.string	"x\207g4\222@\372'\3700#;\213qqJ@\270\235J\344!\033PM\353\232\350\270.S\f\033\031{\307b\372\344\315\256\037}\376U\220\273\310x\364\306B\357bSN\302\224\347\324\274\321\270\316\251\374D\244\362\364!\206\020!\235\337\331zS\007\222&\022o;F\rt\036R\302w\277\021\350\030\364\231\377\344I`\305%N\2439V\357=\355\213\227f#k\247\332\320i\027w*'\220]\255\213\210\177t\340\00583\002s\367\340\263\264\316\032\025\230]\331\246\262\222\206hJg\367N\321Zr\256Y\312\234\264\241\271'\3535__\017Id\301\023\205\352\373\343\223\241j\224\200\te"
+	.string	"up\2274\341\332\232\215\034\3235\263\377\017\273T\234\001\314\007\365\264S^\311\353\275\177H2v\021\340\311\024\\R<\022A\b\321hFkf\347<\2528z\250\2032\341\353\370\005\206\345\271\266\301\006\202\252A_\330\200\240\316\351\210e\327\007&v\335V\274;\364\037\325\237\241,\017:\300\016\302a\347\351\260\234\t\234|q\362\2452\003\324\317\"\032F\371\215\3440\003\344\313\276\275\217\321x\360J\377\022!x\3443\201\331f"
+	.ascii	"\367\362\031\025F\034\"\365b\312!\330\370\211\301\257\002\376"
+	.ascii	"\327\366\303\300\273\244f?\027\3550\306\022]\255\242\265&\352"
+	.ascii	"\336\265\300\243c\370l\306\031\r\274\232\203\305hg\3625\270R"
+	.ascii	"\245B\022Y\277\003\017\001\004!\367\347\266\351v\250(V\274\327"
+	.ascii	"\336C\360oo\267\262g!\215&\212&\301\0058+^\207\270kV\336\233"
+	.ascii	"\022d\3465\267\022\341\242\001U\177f8\315t\376\027\374\372\t"
+	.ascii	"\"a\371\004\333\f\226\227W\232\301@\032Xn\376\035\t\236\222\377"
+	.ascii	"#\003)K\372\215\001\317\032(\276Sn\243!\257\214\037R?\246irz"
+	.ascii	"\201\271\372\357\342\037@\322\320\3027\303\354\316\021"
+	.string	"\241\337\035<\311[p{\232@#0=cEoh\231\351\324s\335\032\231\226G=T\025:\035\336\276C\336%\344\213\246d\254\217G\320\300\r\266H\377\213\307\236\202\350\252JkR\254=\340&\246\377\376D\316dl\023\337\030\317\023Dy%\257\255U*\201\320\346\354\270\024\334\357U?\331z\360M)\202!\373\217\202L/#\214[z\204\312.H\344\356\376g\350A\322W\273\275{8\304\037BI](\233f\225\241\306\033g\253\230\302R&g\257\002L>|\035k\220\274\255\\\224\3301\214\224N\006\002.7D\263<B\252\246\271S\021\371\3040\265\037k\316]\373. \314j\245n\326\027\260\240\331\303@-\204\024\331\n\234(\251\304\224\331m\330Y&\020\222d!j\232G!\252A\035dT\013\206Oh\271~q\347[Y0\202\205\335\326\230t\b\245>\234\245.\300\rR\345\240I\216\224\004*\002"
+	.string	"A\2360#\220\035y\334^\307?\030\257\2269\b`\210\343d\n\244\374\331\344\216\002\304"
+	.string	"%{c`\255.\\M\307J\375\004\377F\305\264\360+7\304\240\217\267$\320+\211\005n\352M\2600\331'-{\234\337\246h\237\344B\306\204?:\247\201*\245\201PY\331t%4p\235\"B?q\034yF\232h\217\247\352j\022I^\003\214\260\277\006\210\206a\231E\345\007\245\247\223\006\253\320\326C\344k\212\370\230/\232\340\2705\315c\320\2775\275~\320\302Gj,\013'\234rK"
+	.string	"\322i\224\031S.\344`0\344\320\236\261\016\304Y\0065\236\213m\003\301\221\007%\201\371\260\004\277\372\235Z\036`\n\347\260\314=d5\226%)b\244\302`|\262\311\203\005y\261Q\311\353i\322\016\0205e\006\222H\t\221\305\314D%\325X\3457\357\314\\\271\005]8\236S\326\226\001]\271\201\362\235\021\316\324[m\223M\246\316\032\317\321Jt#/R\354\311\330)5\361b\224\320\270\361"
+	.ascii	"\020\342O\004\265t\003\225nkx\276%`k\247m%n&\340\347f\364\315"
+	.ascii	"\025<\235h\362\327\212_\217f\237\375\360\353fJ\2619\bA\305\233"
+	.ascii	"\377F^\375\274\2408g\027\347\226\3350\3422\240\355\030\tW\256"
+	.ascii	"\251'b\301\\\240\272p\262\353\356\320\270\266\353\201\177\252"
+	.ascii	"\214a\314,\303&\245\026\356A*\241\3666\217\253\303\002\336\017"
+	.ascii	"^\035\026nS\315L\273\220z\3756]E\237\225\241\026Z\340\337\202"
+	.ascii	"\005Gr\353\266\303\273\005\260%VNPpL\320\334]<\"\f-\225O\013"
+	.ascii	"o-\272\200\322\311\002y\355\320\224\322,\031%\035\231PBZ\372"
+	.ascii	"u\315\220\356HU\346\306\312\376\275\254\260\323\022\360\361\217"
+	.ascii	"\033r=\234S\277\336\370\324\324\323S\210R\227\304\314P(5\"\303"
+	.ascii	")\272\334A\\\224\346@\017H\023f}4\211X\200\313\221\017\315)\230"
+	.ascii	"U\363\216/\271\272\326\021\2642\004\204\333\206N\343\306\362"
+	.ascii	"\222\025n\023\201\036X\207\034\307\353\r\310\200\331\0263`\366"
+	.ascii	"\201Y\005v\364<\341~\305\\\314yR\013\bF\274+\240a\017\355\244"
+	.ascii	"OLC\345\327k\\N\343\273\023k\3265\246\310\033\221/\362\320\244"
+	.ascii	"\2444q\334rR\213\202\t\240\007\212\351\bMV\3662\360Zl\363W\236"
+	.ascii	"\306 #\362Z\025\336\267=\320<\003C"
+	.string	"n\272\247\311\206\370 \006\216ZP\206\343*\374\"T\272\252\027\332?\343<\nI\236c\310\211\037p\t\254T\032\341\013?\265\302J|\234\371\323VT%\361Lr\226\370\301$&\252\274\023\365\254\240\326\276\001\020(\365'\037r\262\315aT\304\314\177\215\004\322\204\b\305\004N\b\260l\342\346p\213\023\3409\361\332\212J\330\201\005\210W*w\240\\\305#\312\2306\356\311\276\374\244\274V\366\022\362\020\002\265\033\373\260Q\227#\007\241\261F\24512\274\354\260v\333b\331\311r\256\203\331(tH\200\260\004|\267X>Ppj\273\377M\005j\277\340P\221`]g\2564\376\330\\\335\001\216MY\370\272\231\003#\330\020b\272Qp=+\257\031\303\022\031\346\313\226\334\271B\022\235\207\317q\345\f$\212\320\022\221\340P\r\230\231M\013\256\302W\005V\244\004\240\270_-\262\275\2570#\004\246\253F\216G\256!\213"
+	.string	"HC\207t\345\037\n\234\325\255^\301\243\325\030\366\345\246\240\320t\350\220]Y\321\274\374\315\322\340O\252\001\300\203\001\252E\300\206\352\224\024\264"
+	.ascii	"\335\212\t +\335\266\237\324\367\004}\3611\217\311\007\237\177"
+	.ascii	"\346qV\203\313l\2341\376=~"
+	.ascii	"Jc\253\215\003"
+	.string	"\255G\016\362\261\035\r\200o\262\376\210#\006\025T\212c\322\257.\025M\332\025>\327Mbk\371\346=T\332:\261\311\216Z\246\266\321S\247\234\277\252\225\272\367\003\243\222\362\253\202G\004\314\277\343\212#H#\332\306\264z\354\037!('\206n\315+\220;\3465\354\226|)u\327u\242\345j\r\"\373?[\274\230h\nB\303\243\r\2267\357\254/\312\034Iw\323\343\\S>\200\363\340\3365\317!\243z%w70\fr\2001\315\321\317\251[\353\300\345\372\002\227\233RA\247\235/p\036\233\251\332\216N\030\245w'6\345\003\2528\300\316s\203L\371)\346\204X+\210\025\334\301m\013\256*\336\223b\t\350<uJ4\264\276\233Z\004<y\027\335zxs\244\272\007\005%\351\313\371\207\246\337:\350OTi\223\005\345_\"}\350\2072\352\220h\f\361!\002\324\036l\337l\334\237:\224\227\300\311dT"
+	.ascii	"h'KkD\n\257<M&\354\336\005\370\202\240\002\004\256D\377\037l"
+	.ascii	"\344]p\223n:\337\316m\033\321\324\366\323\206_\3611\022C:\005"
+	.ascii	"9\325m\204P\310\323\273\355e]\032n\321K\322\242[\235u\265\034"
+	.ascii	"\237\242\323\316\340\\\ft\361\330\275\"a\226t\022\353\3574\214"
+	.ascii	"Q\n\233\np\263s\262\320\245C\254\226\260\222\220\200b\203l\203"
+	.ascii	"\204\315T\255\310\365;8\235u\036|{\304\274"
+	.string	"\323\206\221p\237\203z\347\",\2408\356\013\320<;?L\210\321\333\210C\316\320\035\254'\b\252\004\bJX\\\004q\253o\206\016\335\235)\036\026\3278y9\2066o<\343\020,\035G@TZWt\204\245\242\313\b^A-\312\017\f\367Rj\216+\005\021\224\027_2\311\200\273\347\245AY>\243\322]\025P\354hy%\334W\240\277iL\200`\272\367\023G\305B\374\020\\\035J%|n\003\314w\251W\363\"}\n\370{0`,\322\251's\371\343\221Rb\b\374\003Z\312\234met\361\006\030\267s1Kv\273\226\037#\320q\007\017Tw-!\340\365=\276TF\233\006~C9\013\022&W\302M|\265\326g\230\352\244-b\332>k\031\377\357C\2241\225\311\354Q\341\n\262\nGG\270c\213\bm>ml\270\342\217\361\243\030\353\033\3142\3001\026\376\314\226$eL-\346\n\225\347\\"
+	.string	"-\026\362\017\236\b\206\0234\210\3164\330h0)\235iEG"
+	.ascii	"\214\201\206\177\241\216\303rN\201\354\215FP\351\256\020\025"
+	.ascii	"bO<2;\007\020Ywo\202#\004p\340Dy\261L\0052\220`\351L\022.mV,"
+	.ascii	"6\006\n\255 8l\264\221\001\277,4\331\340 \260n#\024\345\200\032"
+	.ascii	"\n\345\322\351\251G\227W\364\260P\206\322\372\322\260\362\\\201"
+	.ascii	"\n\"\352\0336\274\354j\304\343\342bs\303\335Y\002 \360J`\301"
+	.ascii	"\204\334K\335\311\255\256\375\332&a\302\271w`\336\213%b\220\346"
+	.ascii	"\n\222b9N\340\213`\350\t\200\217\264\314\310sF\224\002\235K*"
+	.ascii	"\327c\b\351\330a\275\324\267T\200Mf\255\2438;\247\3653\307\367"
+	.ascii	"\232X_Df\220\002\207\027\257^\264\230\2056R\207\353v\362\314"
+	.ascii	"=\347O\346 \211L3\335\024\235K\324bC\240\""
+	.text
+	.section	.gnu.lto_.pureconst.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\005\n"
+	.string	"&\034O,\260t\220\f\007\314\214*E`\331\235r\204\001\265uY\300c\364\021\"\316\306E\030^\241\216\200\f\333\342\312n\327R\f\340\227\035\331\002E"
+	.string	"E"
+	.string	"A"
+	.ascii	"\375p=\314\016\223\303\3340"
+	.string	"5\\e\230\030\346\205i\341V\230\024\346\204)aF\230\020\346\203)\272\016f\203\311`\206\346\202+\0053\301D0\017L\003\263\300$\002s\300$\001\217\002<\001x\332\013\264\t\004Z)E.\221\327\220)d\006\231@\346\217\351\343\366\230<\356\216\251\343\346\2308^7\246\215[\343\322\2703\256\214W\214\013\343\365\342\272\230j\361b\361\264\342\252\270).\212\251\023\327\304-qI\334\021W\304\fqA\034d\346\306\314\211\231\013\363\032\230\253}\231\363r\327e\216\313\334\2269-sY\246\206E\264+wV\356\252\314Q\271\233\356F\241M\231Q.\224\373d:\231M&\223\273\344*y%\271H\346\221id*K\331\2379?W\353\363\032\237\327l\317\324\364\334\345\271\3033w\3475;wu\346\350\2746gN\316kq\346\340L\2554\367f\316\315\\\23396wj\346\322\314\241\231;3gf\256\314\\"
+	.text
+	.section	.gnu.lto_.ipa_modref.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`[\rM4"
+	.string	"\332Dt\016@pl\315p(\224\203*{F\030\013\207:\235\024T\352!\216\232\203'\265\307*UB5\254T\320B$\302\365\016\264\352\017JFX\244A/\230\340\347\221\252u\371\016J\261\271\323\270\324\310\336R\246\300"
+	.string	"\344"
+	.string	"\326"
+	.ascii	"\206\272_>\345\225\367\035\244\204@\326b\022\002\305\204@_?\221"
+	.ascii	"A2X\013\222\0346hx\006\f\\\226"
+	.string	"\247\311\374\013\214\252\275\337\223\005F\325\376U\220\022v\357i)\374Dx\367O\237\236\b\237'\217\265\337\306\t\022\226:\302\317\353\340\r\316\340\013\256`W\022o-\310\t\226\332\266\332\326\021\301\017\334\300R\337n[\200\303\t|\300\377H\221x\233\004<@jK\031\300\317?\255\267\366\335&\274o\302\374\337\326;\376\273|\305\373+'\274w\362\204\367O\230_\226\264\377\264\224\226B\215\373\363y\376\273\2749\336\237\346\367|!qY>\375~\177\376\026y\377\327\342\324\342\334\306o\356\"~&\003\001\272\0276\342\022\277\324bs\245<\250\036\203\265\236\016\03500f\027\024\272\266\356\360\"0\347n\267Z\220lq\376\263\260\230Y\334\344f~Y\302\260\025?\256\260\021U0\351\356\334\207\356\346\t\273{\035A)\233c\262Q\333\254D\332\235\373\332\225u\223\332gQd\243\260.v\f\204\205i\024\346\245\033M"
+	.string	"\024\023F\211\t\355\370\320\241\026\232"
+	.string	"\350k^\227\027D]8\037:\024C\207~R6K\263<\231b\037\221(\366KW\226+Nys>\261b\274\3620\371\276m2\375\250\250l+i\202\304\0370\032\324\353\342\353\261l\323\3742\377\b\227e9>-\227\002}\2314\343\245\215\b\340u\204\227\212C\334\316 \232T@\305_"
+	.ascii	"\265;\315\352\333\021'\221\301\365\360\033?)\221\351\334\214"
+	.ascii	"\203z\214\006\365\002\357\302\205yw\253[3\260\241\256Mw\363\346"
+	.ascii	"\376\357\223&\265\233Bw/\0271\345\222v\267\223o\321\302\337#"
+	.ascii	"\3745\222\345\252\3112\201p.Y%\020\314\306ZsENr\022V:W\354b_"
+	.ascii	"\220 $V\n\260\\\261\342-\037\357\215\024\341%\362[\321\342q\310"
+	.ascii	"w-T(\b\220\037\367\361\237\277=\204@\365\256\254y(\221\351\334"
+	.ascii	"4/B\255\315Z\233\377.--\237~\231\246\236\347\267\n\225\035:r"
+	.ascii	"\340@\340\325Vl\232\346\024\336\033\267q\0331\330\275\373(?R"
+	.ascii	"\370{\305\3439\n\177\243z<\3268\221\373\342\325\221\323}\032"
+	.ascii	"\2736\033\265{Tg0:\244\362\013\242\034\364\210\361\312\363k\346"
+	.ascii	"\305\3403\024\030\273)\376J\351\351\032\200\250kkO\267\221$\314"
+	.ascii	"\034\307MU9\321\216s\302MU9M\235Ng\215*'\333O\0318\0318\031U"
+	.ascii	"\032l?\247\2524\320\036h\377g\\\027m\037\362\254\016Tg-\237\357"
+	.ascii	"\356a=\337<\213\347E\252\335;v\376alll\2147\254\316\022\372\036"
+	.ascii	":\304\234\202\321Yq\226VPT\354)\352\234\240\034\006S\373\207"
+	.ascii	".\027\261\263\234\245\026zwB\3555g\215\225f%s\374%\377\363\252"
+	.ascii	"I\203\346\214\031 o\0312\3771\351\346\"DH\314\317\233e\261\034"
+	.ascii	"\f\357\225RQ\261IIY`\314:\253{\353k\245\251[\213\204\263\366"
+	.ascii	"\216\370*R\3022\334\350P\n:\354\205\375\177\252\005k\301q\245"
+	.ascii	"\\\211LG\306\212\3274\237\350\313c\252q\243\364L\363Er\335\345"
+	.ascii	"-\224n\024\026\202L\367\246\373\013\263\027\376\006\201e\250"
+	.ascii	"\341D\350\324\214\310H\222$\313\001\201\004\306Q\016:\f\355\022"
+	.ascii	"\200d5G\203\330!\031\221\244 )d?\016\240\246b\262>#\"\024\227"
+	.ascii	"\246M\232t5N\335\261b\367\371Id4`\344\034(\240\274\367\355\023"
+	.ascii	"\005\r\215\321\225;D\272c~{P\374\177\232Y\004\376\240\356\213"
+	.ascii	"\3270~[\324U \"\320q\361n\316#=\357)\361\236\375O\334\204*R\t"
+	.ascii	"cI8\233hW~\221\362\253='\331\204\007!\360iW\320\242\244;Y|0\373"
+	.ascii	"T|\2718o\321\274\222\344G\006\347\303\226F\231\317\243\242\207"
+	.ascii	"=46\005\352P\206%\345\242<\177\315\225\370H\3149\030\020\025"
+	.ascii	"\343\322\306T\217w\004\316V\2437fB(e\342\\)}5W\341\026\005fV"
+	.ascii	"\360\267uP\024\024\223\006T\005\217\253\202J\255\213 \310ez\247"
+	.ascii	"\021\262\256Be\013Mq-}\r\275\223\315\326\032\363\250\235,\301"
+	.ascii	"\017K\3123dm<S\350J$\330B\035q\274[\214\217\310}\371\235\330"
+	.ascii	"\375\033A\027\"\234"
+	.string	"\024|30\376n\332\335d\212z\2367\304~\231)_\n\334,\200\t\226\200P\003\224i\013\325V\005z\003\254\353U\006.\3101c\317wy\032:\215/\247[\301\340\360lU\362\356F\224v\255\3611\312\250\367\020\227\035\227>z\320>'\002\f_\372\336\032mpN\241\367i\214\023.\314v\375c\222\202X\355a4\341\025\b\321YK9'\277\217\245\304C\275\034`\273j\232\352hC=\253\227\007\001\300\322{$6\022\255\317\302&\013\347m\301\364\253i8N\263e`D\217\021{\322\364&\013\002,n%\006\206\273E\370\310\316\201}\336\377\355\\\217\023\301\322\347\036\376\002\351\024\272\343\277\3622\231p\371\346\226m\375A\201+N\341\233V\230n\334\261\212\357K\013\374\0028\357A\210\253{\215Z\341\377R\273\024\004\304\032%fp\252\370\227\215\3529\334\224\212\032\356\364\251%N\317\363\356\320\220\0312"
+	.string	"\300\250\2475y\365\004\205\203wX_V!\3364M\250:\307\356\256\330\235$\337\247\224;\016&\024t\240\375\370>,\247\241\2138c\327(=\224\306\226e\335gE\020\004\257,\315\235\232w\320\240\251bq\253\353\300qXp+72F\252\222\306"
+	.string	"!\255'A\212\212\322d%\202\027(\225\222@J\3410\027\312\256b\3214\263\352\345\247\226\366\314\360\320\325?o\351\244\307\246\376\247uB\2169}\"\214K\242\302\346t\016c\267\307\302|\327\274&+\033u\2522\177\260\017H}\271\3150\275i\260H\002\2006J.\321C"
+	.ascii	"\265\342i#\347\033 1)\356;t\314k\240pS\314\372\376\212\243L\212"
+	.ascii	"o0\247|\"\214\336\006\225~A\001"
+	.text
+	.section	.gnu.lto_.lto.63fca402034f4868,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerNames.200.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`6\003%\025"
+	.string	"\326\244\211K\240\230Q:\n\3479\030\317k\\\214Nql\006\270\266\334\232\036O\301\313\361\360\233\343Y\n(\374;l\026\260\303\307\325QA\237N\256\0373\326\016\322\312\225\260\243-\206W\244\017\361\255\013\277\016\217\376\240G\344\266\261\255r\020\222vs"
+	.string	"s"
+	.string	"v"
+	.string	"DxC7\337\004~\333\f\351]\242\233\317\204\337"
+	.ascii	"\204\277q\252\351$\360;@\324\204[t\363\223\360[@\017\337E\302"
+	.ascii	"\357\001:*\030\335L\001\277\t\340\360\215S\302\f7C\300o\262\306"
+	.ascii	"\r\277\013\310\370i\270\371\001~\033x\261\201\303\315\r\360\373"
+	.ascii	"@\013\340\205\3417\002\025\300\227\023\225U\211\254`0\177\351"
+	.ascii	"\335\341f\021\277\023\234\274\207\326\333\236\264v$\003\357\362"
+	.ascii	"/bPL\022\225\304\0201Q\304Nm\024\006G$9\260bN\201n\026\2310\210"
+	.ascii	"%\374\026\305\017\242\022~\217^\204F)\341\027\374\206\341\202"
+	.ascii	"\205\337}\262\225\345\n\277['[Wp\343\260)w\363\253\360\333eE"
+	.ascii	"\205\251\b\335\335\315\037\342wLU\024~\277\236\374.\024~\313"
+	.ascii	"0\001\336'\374\236I\002\034\207\302\243"
+	.string	"\300o\032#\021$\334\374\023\370]\023\250z;K\033{\336\326Z\272\342r\262\227\355\335\024Y\350\301.\024\r\031\301zG?\330\ri}\030\210\216`H>\337\021L\306\306vtrt\2632\007\364\262wz\212\2578\213\273\370\323a<\306g\234\306m\374\306\241\236\343;\316\343>\376\343@.\365 \027\362\341\247^\344T?r$W\362%or'\207\362(\227\362)\257\242\340W\267r,\307\272\226oyV\366\274\2550V\325\315\312\034P\313\236=\243E\313\236\332IsY\236\335h\333\322l\247\020\217f;w\250\317\214\215\355F\253[\240sYU\267\226\250O\272\312\322W\214\255\2512\031\017G'\247\306\322\314\031\017\207\001\357D\315\237\231 \227\375\341\321\231?-\233\006\335L\034/]y5U\245A\313\334L\306\336\314UMe&J\263\2358\032\033C\317r-]\326eM[\031@\250\021p$)"
+	.string	"\213\334Q\224\222\244\315\320\002\031+z\020(\2020\022\247\003e(\233\210E\275\262\027;|-Ay\252#\305\007j.\222\205\374\315\264\225\233\362\322H\020\346FMFn\022\377\206\362N\3631]\316s\317\246W\002{]9\355u\264\324\025\037rB\332\253u/\246"
+	.ascii	"v\"\372\274;K]\233*\326\254\333uW\246\247\352\005\201#S^\234"
+	.ascii	"\232\272\020}^\204\3431"
+	.text
+	.section	.gnu.lto_featureNames.201.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\303\003e\027"
+	.string	"V*\232I\220\332m\306B\001\200\004u<\351b1\bJ "
+	.string	"\bJ`\0041O\235D\200(\263\321\203?\0134\022\215\017\335\350\361\2226\023\030\276mB\273\353v\232n\322\030\327,d\220\260\n\210H\256\227\335\322E\256]ha[&\031\211"
+	.string	"\211"
+	.string	"\205"
+	.string	"\307;_\250\204\274\276\205>\346\251\242\333\345\365,\364q\317\024^~\225>\016"
+	.ascii	"\245\350\363\332\232\220\327O\351c\237&\002\266T\243\274:\351"
+	.ascii	"cZ\222#\244\274R\320\307\003\214\360\276/+#}L`H\001 IJyU\365"
+	.ascii	"\261\001\037\025\226\362\252\323\307\007x\3602\344\265\324\307"
+	.ascii	"\br4m\310\353\003}\234\300\206S\346\220\327 }\254`F\007\331\225"
+	.ascii	"\330\330\213\261^o\275\324\261\207\274^}\274\340\264\177\260"
+	.ascii	"9\266g`\355\007\025\\\356\345_\036\3660\037s\261\227\271\231"
+	.ascii	"\237i\3604\267w\237n\210;\342\2567\352\222\270S\227\352\232\270"
+	.ascii	"'.\212\240\253\002H\374\304zQO\016\354Mq]\350\252\244|o\t\334"
+	.ascii	"\230\327\273B\037\177W\352R\351\343\032\250\246\257\313\352\366"
+	.ascii	"\3641\026\021\246\217m.\210\203\351\343\233\323l\320\024e.=\226"
+	.ascii	"\364um\341\220\271\226>\226\211\311\322\307309] \344\362z,}\254"
+	.ascii	"\243\305\374\274\254\"\344\3651\3641\200+\207\241\003i\216\025"
+	.ascii	"C3\267G0\333\253D\373\306\216'\232\336L4\333m\242\245\210\252"
+	.ascii	"6T\234\331]:\016\201\033\247\216i\t\352\330\243\037%\013G\265"
+	.ascii	"\013JFK\265#\246\246\332\017\315\3620 1\3254\360xL\265\231\335"
+	.ascii	"bJ\2167\3256\346\300r\027\356\330\313\370\325i\274\306o\034\307"
+	.ascii	"u|\307\261\336\343?\236\365 \027r\"/\362#Gr\255+\371\2223\271"
+	.ascii	"\223?y\224K9\225s\275\353^\007\273\225cy\226oy6w\236$hSm6PM\205"
+	.ascii	"p#y+\307\036\231=\315\024U\267\231\232\271\231M\3111U\315\241"
+	.ascii	"-\2423K\202\343\026g\026=q5\343M\304\225\340\316\261\273\235"
+	.ascii	"\2129\221\024S\231\r\201>\233\323\235*)\222$\270\301S%\332<\366"
+	.ascii	"Ds\266\020TG\024\3358\366\034w\212\252\241H\312\354\016$Ot\f"
+	.ascii	"\263\rQ\263\306\342\3121\334\240n\2337\225\024\313\022\024\262"
+	.ascii	"\371\330-\206\245y\242%\270\003D\250!<\314\004\222\221\273\254"
+	.ascii	"\242\024\013\007 \003\221\321l\003\020 c8\013\3224\006\375X\223"
+	.ascii	"Y\3008_v\220\035\337`\312\3214+\315\343\177}^f\302pG\022{\254"
+	.ascii	"\272\266\257\371\343a\243\276\303\201\016Y9\276}\310\360F`\250"
+	.ascii	"\334\307#\216\005\362\t\255&\333\207\034,\016?\350cM\2444W\f"
+	.ascii	"t\324p\036\371\216@e5\r\3354\325y\031>\236\322\024M\321\256\030"
+	.ascii	"R\315\302\270\303\357\222\311"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.203.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 [-\002"
+	.string	"D\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300?\202\210\200\020{3\301\0014\277\001"
+	.string	"\006"
+	.ascii	"\200\b(\327\316\t\340\\J\353\030(\002"
+	.text
+	.section	.gnu.lto_sensorTypeNames.204.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"e\007"
+	.string	"T\f\331"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\350\276\n{\275\006\005\001'-\206\by\bw\300\005\005\001'2\206\bus\303\004\005\001'?\306\003\005\001'D\206\bqo\311\002\005\001'J\314'O\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\020"
+	.string	"\270\212nv\201y\212\033\260\004\340\032d\f\b\203\214U\305\037\310\r\220\3103;\220cA%N\261o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.205.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 \233\375\003"
+	.string	"\264\006l"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\303\375\363\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_backupPgConfig.206.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"}\t"
+	.string	"vRA80\221\322\001#\002gJ\236D\236\r\032FH0W\001\337\354\373\f\330\355k\257\326\260\013\350sH\353\353V\353\300\005\003\017h\021s\216\300s\305\203w%\237\220-eJ\001/"
+	.string	"0"
+	.string	"2"
+	.string	"\367h\317\266\023h\317\374\3311\017=v\343z\251Nfv\227\323\216\177\317\317\377\3109+\026\352\271Y\330]\347\212\245q\353m\033\330F\260\237\020-\373\340\257\305t\214i\325tf\372\333@\313\013\203\314nF\214fa\231\312G\307\366\323~\310E\276\203\247\013\354\266`Rv\303\217\017\266g\016\003G\211\032\340\002I7\351T\013\\\327\324\217\252\306\023/1m\273\027\n>\211W\261\275\236\371'\355\331\225\263\302\002\002\2462f\207\250T\016\373qw\327\032\242R:\004\032E\2048\211\221\003\211\013y&\016\344qWz\3608\212\256\363\270N\270\217\253-7\270\300Rja\200LU\215j\213F\371\225;\033\030\212\262\r\021\017"
+	.ascii	"\357b\310\304K\274h\303\005\204\250\364\300\220\237rrU3\230\312"
+	.ascii	":3\241\025\030p\t\241YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_restorePgConfig.207.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\205\t"
+	.string	"v\222A90\345(\035\036\336\f\006^\252\246z0\030\352\220Q\013([\331\223\0269$9.l\303.p\234\310\334\306\252\342\"\b!(\230-%\037a\006R\212\236\341\222O\310\2262\245/"
+	.string	"0"
+	.string	"2"
+	.string	"\347h\317\266\027h\317\374\3311\017?6\303\022A\245\274v\227S\217\177\317\317\177\3115)\225\351\231a\330]gJ\265q\353m\037\330N\260\257\020+\373\340\257\305t\214i\325tf\372\033\301\013\246\301eW#\006`[\031K\310\306\366\323\376\310I\276\203\245\017\354\256\\+\273a\307\b\3333\207\001W\211*\300\002EG\351T\r\\\327\324\016*\200)~B\332v1\026|\023\317b\003y\346\227\264gWM\313\013\f<e\314\016M\251\035\366\343\356\2565\240Q\372\343\tI|\270\211\320\203\210\373x$\316\303q7\202\360\270\212\256\363\270M\270\217\253+;\300Z'\275p@\246\252F\265A\241|\312\033\216\f5\331\216\b\017"
+	.ascii	"\357b\310\304K\274h\303\005\204\250\364\300\220\237rrU3\230\312"
+	.ascii	":3\241\025\030p\t\241YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_backupConfigs.208.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`#\001\215\r"
+	.string	"6\031[C\020\217(\035#\376+E\246\177\347\301\001\2318*\245u\364r\303Cj\016f\326\354\273\013<`\366\204\007\255~\253?\236\331\260\n\353k\243+\002"
+	.string	"\020"
+	.string	"!\034\024\221\202\f"
+	.string	"\004\2414xK\366\336r\247\024G"
+	.string	"F"
+	.string	"G"
+	.string	"\232\301r\204S\261\214p*\326\341\274\341\363<B}\036\237\344\317\304\n\261R\333\347\021b\242\322\206"
+	.string	"\233\bn\270:\225\217-\364`\007\323\365\363\217\204\t\023Vj3\375a\bv\327\217\264]\270\345m\203lg\330\327\002\266<\352>vn\325b\221\340\265[z\271\330UT\341p\324\355\177\360\2471>\210\227x\216\242\360\035Y"
+	.string	"PJ\221\322\355N\003\217\036py\364<\206|\274\\\200|<\306\036{\305g\310b\032J*\240\264v7\013;:9\n\004x\221Gwt\344I\217~G\365\205\311\212\307s\035\356\356B=\331.\240R\345\212j\304\310C\350\275\f\337\325\2260\341\235\344\317_Np\030Z:\017\375\250\212(!\332TO\366\374\274\215\020Wg\005\t\f8\2363\032\032\007\231\354\201F\301&\313p:2\r\fk\034\0138Y\004M\343d\230\271W\020Gn\325\322\2014\344_#\375\224\2474\276\210\033l\336\206\344\004NXZ-@\357\025\365\344\003*T*\346z\326:\031(\256\037!:\227\r\033"
+	.ascii	"\357b\310D\033\360\262\030\266\003F\\\021P\216\251Es\207\357"
+	.ascii	"\247\220\"X\321\304\351\032\311&\023\017f$\270\333\322g\224\035"
+	.ascii	"\272\225\303-\375\"D\220\031\227\335`\236\321U\203{\206\027\024"
+	.ascii	"\345\3275\237"
+	.text
+	.section	.gnu.lto_restoreConfigs.209.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`#\001\245\r"
+	.string	"6\331[D"
+	.string	"\221(\035{\254\362t\300K\267\2125\331\367\246\360\341\265\251\375m\274\214\217\314\250\251\323*]fP\210\320\352\267\272\017\346\217A\210\235\324\367\245\377]U\002k|H\f\246!);\031f\020!{o\271S\nH"
+	.string	"G"
+	.string	"G"
+	.string	"z\301\022\205\244\205\005\nIK\353p\336\360\201\036\241>\220\237\362\207\212Qi\261\270\320#\304H\247\f"
+	.ascii	"8\022\374"
+	.string	"pu.#\334\350A\016\250\353\347\337\t\030\243\026\213C\375a\007v\327\317\304Y\270\345m\213lw\330\337\002\266\374\352>\366T'#\003\201\211\335\323\213\306\252\210.\032\276\272\375\017\376\264\306\007\361\020\240\257&|K\0256N.Rt\273\263\300\243\005d\217\236\347\220\217\331\003\310\307k\f\262c|\232,\206\001\005\005\026\231\335\325\002[Z9\313\003\370\223G\207|\344M\217\376G\265\206\n\214\310s\035\356\356BU\331&\240R%L\211\227R\207\321{\031\276\253\035A\302\273\311\237\317V\2446\314t\"\032R\035\361B\342TU\366\f\275\017\023Wg-\t\013@\2367\036\234\006\033\315\001'AG\333xB4\017\016o \n<\032\204m\363h\232\271\327\022\307T7\323\211td\237#}\022gq\374\0233\350\274N\312\007\254\304x\230!z\257\250*\033x\241R1\327\363\366\351hq\035\021\361\3116\033"
+	.ascii	"\357b\310D\033\360\262\030\266\003F\\\021P\216\251Es\207\357"
+	.ascii	"\247\220\"X\321\304\351\032\311&\023\017f$\270\333\322g\224\035"
+	.ascii	"\272\225\303-\375\"D\220\031\227\335`\236\321U\203{\206\027\024"
+	.ascii	"\345\3275\237"
+	.text
+	.section	.gnu.lto_backupAndResetConfigs.210.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 \337\275\005"
+	.string	"\342\211%,pm:\240{7\202\034\001M\240"
+	.string	"\253\266\036I\225\304\371\225R$<\237\332D1\245^\377'\024\001\021\215\327\377\"\277\205\210\3342\005\257X\246U\232i\225*\262C\202V\216A1\301\267\005\202\243\215m\343\2505\366\262h\b\225\021\376\034\327\207\347\377\200\314\005?=d\371\261\367\217\336d\313\277T\263\370S\027HT \273)'S\227\200\216\346\377Z\357~\322\216\230\2562#\t\247\324\335\224/\333\355\354\276\273\331"
+	.string	"\030z;+Bw\177\202ae\317;\370?\t\f"
+	.ascii	"3\003\366:\303\fW\240]\232\202\327\274\3145\234,\204\3612\004"
+	.ascii	"\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliPrint.211.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`7\001\215\r"
+	.string	"f\232[B \217\223\016\370\030\254\301\013\210n\031!\013\317r\254\026\271\242\201\313\325=\2319z"
+	.string	"\200\367\227z\332\2335\326\002\032\303kS\342\242\020H\207\200P@$U0\305\210+\004\360\215b\013b\367\336R\246\024I"
+	.string	"E"
+	.string	"H"
+	.string	"\320\037\333\3059\223\305lh\031Ai\331]L5\370\345\347\360i~\374\354^h\033\350\360aF$\0344\266\321\323\250XR\216z\2226Q\276\017%\327\243\376Bt)m+yb\016\354\256S\333*\334\361\266\033\330&`?C&\233\003\245\306D\305b-\331\327O\277\365\323\035_\032\302\364{i\325tf\372"
+	.string	"6\\V\022t\273$+\227U\201)\035.\333O\373\">\342\363S\310\003\354\226P\250\330\345\nx\200uh\356\034\361\320\372F|\017\211\232.E\272\020z\273\273OM\2663\231\252j\177t\362\232\005\214\024d\237\304KL\360O,\301\223\327\016}O<T\315\260pM}\212\247\327\307b\344%\224+\033x\324K\357\241[A\001\204(Wj\"5\332T\003\031\210G\275\351\340<\330`\0208\f>\260M\346\301:8\334\211\340\221a \235N\206]\334^KV\020C%\244\"k$T\333\303\201\310\t\250\013^`@5\371\250gV0\234\364R\277\2644*\311\346\304\247\bZ\210\244\312>J\306\261N\034\032"
+	.ascii	"\357b\310D3\3602\f[\005M\300\275\ncu\230\r\f\255\206\266\005"
+	.ascii	"\210\333x/\033`\262!7\260\360\227\3010\217\202&\200\234\267D"
+	.ascii	"\271\004\333\254\246\004\367\342\226*U\313@\275l\022\346\023"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.212.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 \345M\006"
+	.string	"\262\013,3PO\222\016 [nU\026\206J\252<t!\005V\233\013<\226\212Fc\304\332\036B\242\304\243\331\264N\303\230!b\017\255\344\f-hV?4\033\333D\246\017\020\340\323\206\3630\271\bN\003\204\233\252\t\2671\230\222p\250\034\005EU.\203e\021\364BH\226\201\032G\255'E\251(\bev\372,\002:\t\232F\177\201\321\372n,\037\331\006^\217]\rE\276"
+	.string	"\231\231#\350\361"
+	.string	"\244\205A%\323\023\003\223Y\264R\3627\263\365.\305B)\221tp\244\274d\246\303\221Zm\326\255I\005\336\347j\223\0242\363\366>\036\035\373#\374\232\337\023\b"
+	.ascii	"\357b\310\204\006\340q\200\013\233.\203\274\f\001.\335\242\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_cliPrintLine.213.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"U\007"
+	.string	"b\01634PO\323\001\240\\\354PA\210\213\252\244\361RD2\366\225\201a}\315\rub\254l\345\243\331T\247a\314\020\261\207#\013\302\256\370\272\256c\211\355\266eJ\001\025\310z\235<\037\206):|\024\032\342TY\321\303)\365\260PE\020EUq\303\335\321\237V\204\221\216\342\205*ekAtB\272\320\303\032e\2766B\"\2355W6\272\212\207\265\034\226\217\243u\364\377}Z\353\315N\330\021aIp\3711b`\336A\025\220M[gk\022\227\\\336&\034\360k()?gP\002\215a9s2\206\032\013d\f{\265-\346<.}\\X\234\274\374\217\257\303\227\363\252mb\200,\003sJ\007\377\233Y\206\206\373\334v\240mA\333-\n"
+	.string	"\357b\310\304\023\276hq\241\264\031\\\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.214.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\202\01775`o\032\003\024\022\002;\341\033'\202\353\305\035\250\256\3376\024\202\025L=\306\036\n:$\3142\365\212&:\302\300\020(\262C\375;\200\227\001\310v[\331\244L)=\370\004\bD\2154\202\305B\"\bLJ\210\034\"$\246\215d\310\323l\342A\223\244,\323dg\336\233\303S\031\\V\032p\243\326\203\260\245`\261\236\247Q*\006P\177\311\235\305URHpl/0\236\273\276\227\225\025\007\344\332\311=\030\322z\363\377\205\247\326)\033F\203\226\230\206\232\337\243\206\346\253\250\"\351\264\365k]b\223\315\251\f\023\374'\030\225\177\202\212p9v\332c9^.\260\034\273\2652\236\250sF@:Rf\376K(\342\315o\253}b\200\316\304\371q\026\376\367u\246\017\027\272\355\247-\250\255*\013"
+	.ascii	"\357b\310\304\263\276hq\241\202\024@\252\225\002$\027k\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPutp.215.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\205\b"
+	.string	"FQ<70\345(\035\236cT-\322\344'\2628\253\262\006?@S8?\005,}\373\247\375\001\232\261\367p\3141\023\212\240!\013\325c\366E\222\232\260%\272F\311\357&eJ\001+"
+	.string	"+"
+	.string	"*"
+	.string	"\033\023h\354\272\265-~ \307BDN(1\377\263\374\360f\334j\2378"
+	.string	"\225*\031\261\206\377ET\212\303M\267=h\253\320\326\025*#m\315i\233\330.0l~\030\315\277#\205\365\337\323\004c\353\022\233l^\325\345\201_E\302\372\237\247\b\033\273>w4v\001NLg:\005V^\247"
+	.string	"&|\265\257\204\351\321:\363\377MU\353\225\355\374\354L,f\260\306\n\\X\036`\376\215\027\200\267\\\022\032\212\\\355\003\232\320\262\n\020\004E\246\215H\331\247\323\220(b\224Y\204B\243\214\363\356\314SU\207\227\226)3\212!\246\313\226t\201F\325@#K\r\n"
+	.string	"\357b\310\304\213\277h\300\005\002\346"
+	.ascii	"\346\032\373*\fVP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintfva.216.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\215\n"
+	.string	"6TH?0\307(\035\310o\262\354\003x\375oz\320\337_\346n\250aB\247(\215\f\215\240R\034'\376G\345`\342\237\314\204\177\326'\200$\031\n\331B\b\230B\004qR\206E\375(\371d\223-S\n4"
+	.string	"5"
+	.string	"4"
+	.string	"n\330>=~\243}nW\320>\035\332\013>\236,\006\205\005\325b\260\273\2344yx\r\375\003xFL\231\256\230\211\335\265\212\251\221[\3366\203\355\b\373\022\001\237_\375\231T\253T\177[\200%\260@\260+\022\203\355k\032P\261}\215mU\377\205\345\241"
+	.string	"\302\037\355\314\247\035\256\366[\356\022~\365\361\204]\025\201\002\273\343C:e&\037 \364m\273\247\213\227\266\306H/\232\203\222&\373\255\013\350\360S\274Q\322\213%\355\363\222\302\265Br\322\230=\232T\226\330\317vw-U\366Y\017\035\207z\036\321\210\363\001\273\215\324\205\300\357B\263\327\001ax\\\006\250\013q\0368\342:\033\177\"\017\310\221\276\017\3444\343>[\251rE\203\327I\202\030AU\332\037P\310"
+	.string	"\225\323u\340 \022"
+	.ascii	"\357b\310\304\023\242\321\340\002\200+ \273]Y{\210.\017f\001"
+	.ascii	"s\341]\206!\3014p\305\251\2711\003\005\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.217.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\321\001\255\021"
+	.string	"fbyH\320\360(\035\330T\332\371\002\327\254\035X~\022\354\313\277\345\032\206\246u\023\302\270\240\031B\024O\305\"\274\334\361\326\301\350JAo\310>K\303\205t\b\035v \217\352\261\301 (\311\3547\006p?\317\006\311 do\231Rc"
+	.string	"`"
+	.string	"g"
+	.string	"7\361zO\006\003\330\275)\032\332\035I<\340{'r\020\357\335\374\207\367\316\266\013\034x\031\3661\004\315\306\314-\246\206\264;\202\022\304a\357\246T\230\317!\306\336u\3704\2110Sdw;\304\231\312i"
+	.ascii	"\006\311C\207(\233\001\224bZ\274v\235\021g\252\033&\273k\225"
+	.ascii	"\0219\334\336m;\260}b+*\022\307\376\317\377}\374\273\367\374"
+	.ascii	"\323j\365\324?\275\304\2104\003\202\320.\315R\215\027\026\235"
+	.ascii	"\n\235\003\335>\n\037g\223o\373\355u \327WC\r\003\021A\271\335"
+	.string	"\032\324;+\370\336}\f\271\375\262M\266\247\317i\257\377`\b\361\330\031m\304\020\202\361\223\372\021\026r\0327\036\"\222\357\235U\355\363\004a*\3349J\312\315d\314'=\372\244M!E\2653\304\241\250?\350\270\225\200\r\273{\031\233\305\242\227\361q\377\214vnI9\030\031\263\2228\372 N\230\327I\024Z\214\231*\335c\354\322F\347\204\221\2249\036\361.%\320`\314T\311\036\037\361\246\274|\355\004V\270\220\275\260\331\310t\311\036c*s\354\317\335]\007\341\005u\tW-\026\212\347\242\342\nQT'-*\241\213Eu\252\320\0226XY\271&|N\225\244\250\244@\013)\341\nL\265Z\300\022\020\263VT-\320\205\305j\201\246q?W\342\370\265\243\212l6\371\024?\356\013d\020\331\204\346\017\363T\316\330Vi\223\027){\347\232\2737\tr>\272\344\017\265\037D\310%\345d2f\017\r\037"
+	.string	"\3571\270\026/,\013zm%nv\005c\255\037b8E\020L\024s\200\314\250\206D-W\244\220"
+	.ascii	"\013\tZ0\3710\b\273\314\326\205\024\027\031N\344\321\336\021"
+	.ascii	"\226\0029\245\202\301\025F\f.\302\035\004\264\231 \210wU\271"
+	.ascii	"\336U\366"
+	.text
+	.section	.gnu.lto_cliWrite.218.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\255\007"
+	.string	"\202\21754@\217\n\035\233NL\267\031/\03133\343\020N\007\n\327Dp\302\007_\264?b\355\324M&\177\243\202\3038:\203\346\201\343%_\"\031c\377\227\374\275e\n\017\240\033\364\tA\2004\211PC\204\006\032\221\264O\300\242\t\207\221V!\022\2154\317\226\315$\262^`\201\2410c\316\025\017\237\202tU=\240\201\247\357I\267\213;\262E\351\252jvK\232f\207\235\016\304\"\300+%\025\203\272\330o\247\303\217o&\221\365m\265\210\367\335]\215\200\253\205!\226\271\021\203IX\346\"\371\353\371\357\036!\301\324\026\306\230\351a\242\222\271\035\\\300i\266\351]\272\205\344F\344\225By\311L\rAj\352\231nK\332Q\255N\275\215Bf~\252\025G\307\376\004\277\301\277\022\n"
+	.string	"\357b\310\304\253\276h\206\213\rf"
+	.ascii	"\256\211\r\230@Tj2\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.219.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\356\001\205\022"
+	.string	"\346\243\177I\300\322Q:p%\345](!,\021 3u1w\370.WCfP\301\340\320\247\320\365w\b\375\253\311\nw\374\365\366\361\303u\nd\332\276<D\266i\360\207\371\362Ya\334\201\350\262{\237\230'R\320~Cd\357-S\nl"
+	.string	"d"
+	.string	"m"
+	.string	"DWA{\321\006\257j\005bR\252U\\1\001\325\351\311[\340\351|\txj\333\006\016\320\\\273H\202'D\007\252\003O\252V\321%G\274v:\345\326|"
+	.ascii	":\333)\210\317\231\362[\212b\351rf\213\307DnD\207[9[N\"t\214"
+	.ascii	"\350rfJ\210\032\037\316\373\352\350n\273!-\265VoN\347"
+	.string	"\341\006o\033\202m\027{\031\004\227\3438\216\226A\366\221\376\325\305\237\276\350\237^/\270\376\310\227z\244xPx\252\225g\004\202\323Dc\f=\351\366Y\370>\263\374\336[\320\2364{\345\320\323\240\204\324\257\326\036\225S+P\235^4\271M\263Y\266\347\321w\264#i0!\251\270\335\220\022\002Q%\367b\315\344>\232\210h\254\250N\275k?\022&\244\230\372\221,\216\225\264\303\027\314\350GdU~\027\367]\020\260Sk}\316\206\211\t\215|\246~9\322\346\325\016\270e\200v\254f\237\363}\377\316\f\246&\234\264\331;V\330\2701\245\220_\003\251\334\023\267h\373.\365p\372\221R\310(\340e\205]\016\334\376\360\311Q\300)/\317{\001\024Q\273\247\236\317mG[\264\255\024\262\003a\206\275\tgd\261\027\360Ff\026\276\300\\ld\302Y\rL$\306&t@33\263\240\362\213\005F\346\345\302"
+	.string	"\023\316\270^2\033\027K\3131\032\230\314u\023\213\311\\,\261~V\031\344]\336U\306^O\376\305\357\373\002\250 =\030\363\257\201+ul\257t\013\216\274}\326Z+\235\315Z\201\022\374\216vt\200\265\037D\020\247~7is\311\006\" \200\202\031\301\365\237\030x\211\027\243x\265A\024\020\266\017\302d\347\300 \225\255"
+	.ascii	"\035\210m\2170\271\202\035\310\031\306m<a\234\316\b7E\036\361"
+	.ascii	"c\333@#\216\024\336\335|{\307\227\"\247\016\346\025\006\203\013"
+	.ascii	"\356 @3A\342\025\267\240Q"
+	.text
+	.section	.gnu.lto_cliPrintf.220.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"]\n"
+	.string	"V\023F:0\257\322\001\204\3569\366"
+	.string	"K!\206\277S\272\261\340\2212\257J\037VC\020\361~2,\301\366\boa\224S\326\r\306\210\b\013@8\203qK\324J\241\365\272\332\306\215\366N)1"
+	.string	"5"
+	.string	"6"
+	.string	"\257&\017\342^9\017\340^\r\3321'Kv\343\352\330X\251\355nGI\016~\202\376c\357\210\254\360ss\260\273\236\"+\344\246\267]`[d\237\0240\273 \267\231\325Ku19\354\267\377\230=6\371\024\3600\325WcDp}\224\273c\350\325!\316\353\005>\355\237\034\005\374\313\342\237\335\026K\313.)\262\001'%\006\r\335\231\0034Jm\017\002$+\271\031\372U\036\223 \360\020m\212\212y\321\037\031\315Vf\320\320&\303IG\354kvwM[\366_?\335|6\326d\026\002\245\211\231*\241>O\201\263itj0u\016\247\022\2523}\021\335\bd\357!\341\353R\236\367u\036r\257Y\332r\235\215\266rE/\254\322\354\212\220J\330\274\031`\236\030f\034\266\023"
+	.ascii	"\357b\314\304\2131\\\340G\355\230`\203\304E\020\004\016\033\325"
+	.ascii	"\005\254A\024\375\252\261\314\256)h8\270S\026\203!\362\024\025"
+	.ascii	"p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPrintLinef.221.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\355\n"
+	.string	"\006\024JA \3458\035 \213\367=d\200\300L\340,|\304"
+	.string	"\344n\352\251\242\002m\3740\020\242\312VB\344\304OX!\t#x\3733\207\355\247$\203\020\002"
+	.string	"\020\3247\n\252\210\250\200\013\177B\022\273wJ\0013"
+	.string	"8"
+	.string	"7"
+	.string	"\f\3357\233\377p\337\272\037p\337<\332\006n\262\354\246e\02223\333]\257\256|<\035\375\303\316)W\344\351\306awM\313\025\311]o{\301v\310>D.3\004\340\201\335\221Z\002\224l\023\320\362\327o\3770wl\3631\343_\247/\210\352\241ur\356\252@\337\f\352\276\035\341\324\376\313a\306\273:\356\331e\001\b\260k\206\034\024\234\210\225\320N\217J\232C\023\n\324j\207\027\237\330r\024\364\313\034\226\241 R\332\033\034\364\245=\003f\264\363\243\222\266I\322\252b_\263\273\353\312\262\357\372k\367X#\rj\032\225\304P\202\363'\002)>\257\002\034\225\274O\304\360D\037\207\026$\3213\205\241\350u\314\275f+\313\021\004d\250\232\362I\263\233\322p\276h\315\006\324\376H(\2643UI\027\004\024"
+	.ascii	"\357b\314\304\023|\270Q\213\017\263\340\2070\034\220\270\b\202"
+	.ascii	"\300a\243\272\2005\210\242_5\226\3315\005\r\007w\312b0D\236\242"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliPrintErrorVa.222.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`P\001]\016"
+	.string	"\346\331^E"
+	.string	"\221(\0358\2245j1\240kt\003~\370\241\363\212i\243)&L\374\\\007F&\263\241Y\254\212>\311Gz\213\322k\376\206\360\266$\261\025\004~}\024\324\304\230\354\002\244J\267=q&5\322\366&[\246\024H"
+	.string	"D"
+	.string	"P"
+	.string	"\273b\305\330\r\013X@v\351\360\235y\231=\300\274\264\311\316\361\220e7--\035X\324\354.\027I\334t,\252\311\337\210p@\325w,\304\343\207\n\205yv\3671W\017*\024\325\215\310\356ZA\025\210[\336\013\354\273\004\240;4Z\256\026*~v\370i\\\261\217\355\356:\256\354\303\374\363/\277\214\352kg\245\324\320H\330\261\373\341\325cg\344\f\023\266\257\331V\365U\300hp\031\360C\233si\002W\373(\236\302\364\227\r\007\331_ti>B\210\301\201R\036\366_\034F\311/a\007#zpd^>F\0216\\*'}\271x\320e\251\004\035\231\021\037:\243\035\"\001\221Q\321tF\031\355\t\"\255A3\303!~\316\364+\336\302\002"
+	.ascii	"\226\335\324AR\226:0\340B\006}\336\266\r\263\007\301\207\301"
+	.ascii	"\347\243`\3336\255\303\240\240\220\t\311C\342u\331I'\362F\021"
+	.ascii	"\246A!%\024@\\\205\222N\304\201<\022\027\322\361\310$\344q'\243"
+	.ascii	"\221\307i\341\036\333\270\262d\245\270Z\247\210\202\305\225\227"
+	.ascii	"\246\214\006\033\227\033't\234\364\245\273\033\" \240\202\031"
+	.ascii	"\302\362\357\030\263\342y'\\\222\020\317\256\233\232\333\304"
+	.ascii	"v7\310\325\245\353^\311\335\261\337Ra\214L\024\tb\007>\2740\376"
+	.ascii	"\203F\214\001\217`\311\035\273|\310\247y\305\325\3340P\300E\001"
+	.ascii	"^\302\200\345\312=\272\371\341\301\001"
+	.text
+	.section	.gnu.lto_cliPrintError.223.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\305\t"
+	.string	"f\222B90\257\322\001\204$\031z\b\271\261*`\311\310\177=\214\224A\351\303\022\r\334\027\275\322,\266Gx\013\243\034B\205mK\n\b\201a\200\375\337\323\022\311\353\213\242\306\215\366N)/"
+	.string	"0"
+	.string	"4"
+	.string	"\367p\237\232\003p\237\376l\226\327\216\315\274J,Hl\273K%\307\277\307\317\277\354\033\260\245z\314\024\354\256#\330\312\270\345m\013\330\016\331\377\0043\305\343\261\337\376e\346\330\365\"\337c\251o\005\313\340e\022\356\262@\237\006i>\037\360h\037\344!\337a\022\357\354\272NPvk\310\003\232O\327\356\030<\263\220\213\240\177\3442\207\317\005hCD\304\203\356\314j.!\205T\331U\025\345\206}\314\356\256\245\313>\354\227\334U\326\326bZ\331\305\270\275\254h\001\243\207\210\032\235\274.\2013IT2\221\250Bit\242$\257\201\212<\356\026\020<\212\352:\217r\352\036\263\322\345\203\017\332JN8\205\331\325 \bc\361\346M\254I\351\021"
+	.ascii	"\357b\314\304\2030\334\317\307\367C00\327\250+\300\016\242\343"
+	.ascii	"WM`vMA\303\301\235\262\030\f\221\247\250\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_cliPrintErrorLinef.224.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"M\n"
+	.string	"F\023F< \345*\035 W\262\016\f\026\234@U;BdF3TE.h\215\201\020\261\033 \332\277\021l\333d\033F9\345\301\275\n\001\241"
+	.string	""
+	.string	"@:\302\202\342\020\037e\303k\033\t\3322\2451"
+	.string	"4"
+	.string	"4"
+	.string	"\234\311\203\272s\234\013t\347\034\3322'Ev\363r\331H\261\355\2567C\036^C\377\262w\306\226x\335$\354\256uly\334\363\266\013l\213\354\037\004\333q\013\240*9\226\221\307~\373\227\331c\223?\t\037K}5X\n/Zm\227\025:\347\020\347\334\007\256\366I^\022\036\206\361\317\256\213\246\262K\212l\300yStGc\346\264?\t\320\254\3544\364\243\\FA\3001\332\026\027\372\321\237Y\013\200Z\306\024mR\324\tb_\263\273\353\351\262\017\373\347\346/k\2339\301l\244\nE\221N\340\327\320\27142=\224<\b\023\351\344\225\300\to\004\362\027\301"
+	.string	"z\250\357\003=\017\271\327\354tya\245T\315\225S\232\335\017\204ZLo\016P\333\344\2403\223r\025\022"
+	.ascii	"\357b\314\304\0231\334\330\307\207Xx\"\004\004s\215\272\002\354"
+	.ascii	" :~\325\004f\327\0244\034\334)\213\301\020y\212\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_getMinMax.225.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\023\003-\023"
+	.string	"v\340qF\320\224M:\257\312\364\251\021)\267\017\004\363\272\n\336H\331G\366\360S0@\035<|\220\034\212\030\345\322\217Lc\002\230`V\201\203\270\355?\n\020\370\342\021_2)\371JJ\337\r\3441\300\326\254\021\2627\2212\245Z"
+	.string	"W"
+	.string	"_"
+	.ascii	"\366_\034\306\353\264\226\017\330\245\351\301\263\373\241\030"
+	.ascii	"Aw\350\357&\361\260;*\036\372e\017\375\263Y\216\305\020\230\235"
+	.ascii	"\242\335\365T\305_\207\233\346\313\317\"\034\262\031\354\260"
+	.ascii	"u\264]\347\233\013#?\262\331\211\353\313v`w\001\314b\231\334"
+	.ascii	"\203\335u\312f1w\274m\b\266=[c\0011\007\376N\006\017\335\212"
+	.ascii	"\226xx\205#\222\340\320\\r\311\376`\337VS\330\337VilM\243\236"
+	.ascii	"\363\013\370\367\0078\355/\201iSLw0\315\305t\204i\270\2457\230"
+	.ascii	"\326-\235\232>\001\0031A,AvK,!m\r\366\264\260\375\223\235\223"
+	.ascii	"\324 ?\373\020Q\360\fGRU\017\243\344\222z\217\n\305\306+\317"
+	.ascii	"\241\341Dhu\236\r\207&B\251\247\032\"\243\323x\001\0375X&\345"
+	.ascii	"\356\302\3247<\024\211d\362'\261\206o\003\026\271\331\265?\303"
+	.ascii	"\366P\267\013;\n\247lI\034\335\354\314.8D\351u\316`&\226J\346"
+	.ascii	"~\022\257(u\302\310\274\230\365\030\255n7\"R,eY\261\324\225\n"
+	.ascii	"\241V\245\2548\250<\226U\212\345\251\\\037\274\024\023\267:\254"
+	.ascii	"\270<\020\255\226\313;}\373m\225\306\026L\324\\\364\005\232:"
+	.ascii	"5E\270\220\240Zg\304\251D\345$\034\310\204\004\024\376\243\002"
+	.ascii	"PTS\215\022\216\214'\020\321\0061l\n/\234\307\317\216S\r\022"
+	.ascii	"\016M\325\367Q\261\216\022\337>\361\360Hd\001I\250aP\004\225"
+	.ascii	"b3\023\244\240\240\240 \315\030\300\002\221\251\272\r\0210A\246"
+	.ascii	"L\025iR\250\214\001\337|V\250'\013\267$\001\005\260oS\215\363"
+	.ascii	"\"\355\022\016o\252\376\274\361\022\220\270}QG\307\204\235# "
+	.ascii	"\313\032\247\354J1);\206\026\241\005d\004\325\217\311~\231x\203"
+	.ascii	"\202E\301q\221}\030\032! \310\344\300\3278\225>,~/\272\013t\315"
+	.ascii	"\027\"\300\336\230\365c\216\226\211\355\321\264\033\3509\331"
+	.ascii	"\267\226w\036\342\242\241\221_\013\310\253\323&X\357\323h\305"
+	.ascii	"\006\242\354\032J\005"
+	.text
+	.section	.gnu.lto_printValuePointer.226.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\252\023\315W"
+	.string	"z\221( O0R\322\031\016\237C\021IA\331\034\207Wb\3318+\2518\356\316_S\374\005\017\303\333\271*\263\315\241y\213Z\355\r\357\347\341\337?\003\211\324\020 \n\001\200\2642\242L\315*:f\006))(\252\213\020\220\214H\304E\021\023\262\367\2262\311\351\001\304\001\371\001\274\301\2237Ey\321 \357\231\3626\312\313(\357'\270\333\016aG\316\2104\031\266\325+0\210\265\211r9\373\334_\367\307\375o?w\277{-{\272\333-\261n\357\316\025\356"
+	.string	"(^O\326u\tCxtn\357\216Xl\353\027Q\211\007lj@\254\353\322"
+	.string	"\271%\036\215{;\223S\261\217a\017\267D,wS\377\266w\302\344R\030W\007\002\337\272\256OG7\205\360\350\361d\342\356\236\274;\025\200\372+\034\234\355\b\254\251\346%"
+	.ascii	"f[\036\206vV\2546.\247\363\356\325^E\375Z\007\347Y\327%e\354"
+	.ascii	"\326\225\255\304.\t\217.\333\201\322\243\302\373\244GW\335Es"
+	.ascii	"6\2625x\326\245\205\005\210u]\245\232\311>\360'\333\227\310\352"
+	.ascii	"\233\230\220K\"\224\222\216HGF\243\020EDCBA@?>=<;:98E\342\360"
+	.ascii	"F\030L\321\263\235X\335\007\253\332\256\304<\323F&\356+\371&"
+	.ascii	"&\344\334\227\264\314\261\b\245\244\270,|D\242\223\263\302G\306"
+	.ascii	"`\225Q\b5*\\\364B\025&\242\373P\232\335\024\026\252{P\235\031"
+	.ascii	"\003\351-\235\234G\264%\035\377\234\311\255\300>rpk\027[\252"
+	.ascii	"\220\026s\210\002V\207\366\364\361\234\331)\243\023\006J\216"
+	.ascii	"\334c\234\325\220F\254H\223\343\224\221\235\020v\261%\222tx\327"
+	.ascii	"\344n\223\304\226M\322\342\031\314\3622\273\336\262\356\034\300"
+	.ascii	"\217"
+	.string	"\217\313\341\316]_WLL\241\210\221\017\223\304\212\200\375\346$\301\267\205\315\365\226`'\220\227\031\327\321\226&\260\220J\320,\325)\203\202\036\356'\227\276\246Z\237X\021\346O-eV\272\263\256\353\360\013\353\354\0171r\247\223D\230\r\"\\oy\344\004\022\243d\207\267=\tm\351\2059X\265\256\3532\327W\221\357\210\357v\320\356\202\260\273\343\027:\322\243><M\325=G\363\235\346\331\351\373\320\246\213\230\347\340\245\t\352\250\311i\035\276\034-v\244Gs\212M\3258\374\005\223\022\273\330W\242\021\373l\374x\300{\016^\227tx\346\246\207f|\270\370\221\036\275\t6U\013\203\375\036\374\336\300<\007\257\n\272FN\373Y\276\027\303\270\267\256\312s\311\020*\023hR`\001>\327\036\263:\271h\247\315sZ\200C\216\203\220\031{\f\322\243h\277\013\254\233\252\317\276\222\205+\016\334\023\335}\037\372\362\264"
+	.string	"_\303\217\2364\223\374\267i\326\210Yr\366\230\336~LO\311\3337Y\005\033\366a\216\206=Y\223\254#\276\354.\032\341\272&\037\266\314\265z1\237\254\353:\342\350\213\223J\222,\006\334\340\215)\367\213.\334\207{\223\326[_\277u\311\372\352\036\333\177"
+	.string	"2?>'\266\033\323\024\375\266\013\365\332\312`\261\337\276yc\372N\321\313Z\314\253u\3402\320\020\256+\226"
+	.ascii	"{.*\021\b\204+t\220"
+	.string	"\036}\033\325X\b\253\2626\204\003w\331\222\334c\273\377\030\2272O\266\227\354\326\370\225_\006\312\373\002\345mQ\305\242\200\025*\316\366S\241\274)\276\366\023\360\303\213\342q\337\251\277}O\364\360\232\360\341\225:y\243N\336\022'/\024\312\373\324\303K\202\207w\304\220\327i\310\333\304\303\313t\362\"Q\336\245\035^\021'\257\322\311\233\244\303{\324\341E\322\341=\312\3415\026y\215nxC\240\274E'/\021\312;t\362\n\235\274A(/\320\311\373\223\303\353\203\303\3333\344\345\031\362\356\234\274:E\336\034\"/\316\220\2678\344%\236\274\303\033\336\033!\2570\r\337\302,P\340\002\n\376\226\323}\313\355v\006.\002zW5\242\"\271\335{\340\364\2424\225\235\314\221\302$\023:\232\251' \355\241 TB\300{z&4\263:y$I)A=\266\034\2442\232\212\210\230\0305c\314`\261\037\030\034R"
+	.string	"\352\261=6R\037M\t7Q\307\002(+q\354\317\300\214\241o\315\310H}-\314\304\201\251F\352\241\222\255\267\240\2248\271\237\267h'+\201me\030\354:\002\233}|@h\364\324\370\374\261\341Q\321\377sagE\277\r\033\235\002\372m\\\310a\321w\322\007\210S\325\30139\255\272\342\323\247\272K\311\362\222\257O\262B\311\222d\031\205f\227\235\332\024$\313a\307g5\227\027\265)F\226\267"
+	.string	"M`\256uM\321:\002\355\372\370\224\f\270\214\365\363\237Z\317Q\253\340\022\324-\225\211Z\226\036=j\033\200^/\346\205\341\351\025\315a\324-\325\212\261m"
+	.string	"\346}\360b\336\335\216Q\027\300\247n\2650j\033\177\201]/\346U\321\t\321,\314\250[.B\264\215\277<\017^\314k!\247\250\253\232\303\250[3\204Em#\210\300.0V\036\351H\317\021&y8\274\\\376:\321\200\260\037c\206\310\276\211\307\\_Xkyk\3518k\205d\353rek\321\227\373\211\344\031ij1\340\336\313\337-\316\224\241a+\366\330\352p\rk4\332\304\351\351'\272\213\250\217f\250\211\370\212\206\024\017Q\323\2408\2714\324Re?\327u]\211P?\3215\372|@\374\300C\022\374,\017T\235\030\311\3243\241\222\201&(j\224\037\274\300&V'O\302\031\233\021nzlO\264P_\254\r/\352A-\324\350\032e\030P\007\365[x\0204\232\310V\225\3626j\332\022\231J\345~j\225\243Fd@}C&/M\370\003\204O\377\254\261\241Z\t\233\003y\\q\314"
+	.ascii	"yL\021C\006\f\006f\2708\036\360\242F\003\020<\360\300\f\027E"
+	.ascii	"[\2027\003d/\f\0303\316e`Fo\016\3441\007\362\030\334 \310\243"
+	.ascii	"\211c\272A\220\275P\2749\220\355cG\217\336\340F\217Fw\234\007"
+	.ascii	"\217 \025\234@th\340c\307\217\006t\004\341qCH\021\310\r!\275"
+	.ascii	"8\242v\360\300!\345c\307\215\036R8\200d \025\005\264?.\320\001"
+	.ascii	"DJ\203\037?\200H\021\327\367\222\266\177k\214\224\346\220\276"
+	.ascii	"Zf~\253\222\374\327d\202\214\025\031\343\236U\031\241R\003+\035"
+	.ascii	"\026\240J\242\354\344\031\276\301\352\317"
+	.string	"D\237\rs\207\2645\004x\327*\215\225\032\034a\315+#\323L\tS\217m\177YZ\026\243:9\226=\f\232\216\366\027\021T\215\242\273P\344\305\020\352q\"{\214\227n\265&\225j!mf\030\214\272e\265&\202\364\250T\037\215!\322\245\013L\354\207\033\023BSD\rV?\030\255\372\204J\013\376\224\256\205i\310\001\247\3277\374\001\312\013IO\217\202z\211\216\352k1\241z\252K4\317)\001\237\032\252\337\206e\240\001\265\307e\351\251\217\306\f\323w\302\213n%$\351\343;\222\350#V'w\271N]\301\352/\231\036%\321<\347\324L=B\370\005\2236\265\323T75\021\016V\201\254EM\336mON\315j\"\213c\352\024\214IC\337\332\020$d_l\251\221W\fG\343ndS\370M\315b\332[W\254\001\260\260\233\252u\256\352\001\227\332\225\036]\352\273\225}\300m\252\227\212/\276\242\206"
+	.ascii	"\300\036\fP{\"\372|L\032\322\326\216\374r\347\201\323\353\322"
+	.ascii	"<2r\013Q"
+	.ascii	"\232FJ\235\224\246\216P\202P)\201\225\246\222\211\326$D\217\261"
+	.ascii	"\ng\002C\317\345\300U\244\324l\326f\303\334\225:\252\f\223"
+	.string	"h\356\356\\W1\026\257\373\371\256p`\320\210\026\021\206\246:\251\356I\275\001\223.\2159\325\001\201\201\250q4\343\030T\206FDDA\222$i\r\221\005\304\030\306\030\273;\022\240SA\210\224\016\232\231\222$%5\352t\\b\372\270e\254\3304q\3659\253\345Z\006K\205\2416\251\335q$\322\312gAj\337>\266\223\n\373\t\241\244\333\322\271\277M\0250\r\016WM\224\3078\005\031\255\264\254[\257\f\307\2373\312\363r>\264yN\270\035\004\362B\307\354\341\352\256\244\356\302p\343\0233\351\314\305b\035\313\240\3273\260/\333\f\261\342\031?\177\003\207q\177\342\003\252\0312(\304M]\017\333\016\005\255\243\201\312\335\306\032!cM\261*8z\276\325\357\352:\276\344K\257,\257\352h\3419\317pV\357BG\237o9\323\215\223\356/\266Y\036\fxN\327\327\266\272B\252\213\203 Y\232\377t\322,"
+	.string	"S\002g\252\353\021\323`\257\260\217\214\346d\271\342\304\272\244\3710\273o"
+	.string	"\274\343\327+%@\370!\271\347\2015jmP\177\324J\t\220W\314\240\355\251i\212j\006\224H\243\216\347\223\230\217\216\034.o\374"
+	.string	"\017\025\226\"T?\216'\007\017\251g\221,\255$\355j\372|\207E.+o\262\203\031\236\372\021\353\3557D\020IJ\206\340\033~\220W\242\344\230\345\264\371}\344w\2000\210\232\024\261*\231\300\f\370\b\b\253\246\245\327\362<E\252z\342\375\004\027\300\325\345\216\003\031\027m\256\234\342\313\275\"\257\356\027\031\325d\256\254\217\321@Ow\f\315z\036HA\021I\372\331\001\206\027d1\242\2178\224\375\275\013\fb\220lw\315;\360\221\017]\024\205\001\246}\321\222\221\244Q\006Xf$\025\235\nA\027\027s\346}\267Q\266\267\245rE4DQ\262\313\264"
+	.ascii	"LJ'\275.\022e\332\360X\354\013\315\222\222\004\356\332\326W6"
+	.ascii	"{7\254\242\2000\016\353\017\366\304\237\236\005\315 \bJN\360"
+	.ascii	"2!\270\034\274\364g\225o\211\300\030\005p\300v\360\351\236Uw"
+	.ascii	"\235U`\006\201\\PNN,\026\367\264\024\021\242\331\211\031G\200"
+	.ascii	"3PG.Y\320\271\317\3039\237\274+`\033Kho&]\233'c'\246|U\002\245"
+	.ascii	"C\330K\255\260\316!H;!\267s\233I\\\317\236T\370\266!>\374\003"
+	.ascii	"\203\006\253Q\361$\354\345Rp\037\372F\003M\303\375\364\220\033"
+	.ascii	"A\277v\254\254\340-qp\2266@\377\233\003\224\341\342\253.I<h\236"
+	.ascii	"\361\001q\205\357\300\33484\013\322\246\312\300\305\341\207\002"
+	.ascii	"\3563+\221Y\352#\267\255C\270\301(\020\244N?\021\005\235\213"
+	.ascii	";\034=\036I\247\022;\032\177\034<\222;\rN\b\0341\232\370~\001"
+	.ascii	"\242g\313\013Q\bR\231u\354\303\303\351c\305\206\376\323\027\365"
+	.ascii	"?\034\244c\t\326V\317\342\301\3461\255\034\0255"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.227.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`I\f\2659"
+	.string	"\312d\b\026BP\244N\007e\301/\3575\375\273\364(&\026} p\363\320\304\f.\177S\334\302\032\"4e%\302+\212z\tFU\020Q\n"
+	.ascii	"\"2]?\363\311g_`\206\231if\321MDh\023\271wJ)\005Y\001-\001J\001"
+	.ascii	"b\351e\273\337\267#JG\345\336\350\006<\326\353\253v\373\006\034"
+	.ascii	"(\235\277{o\204\265\325-\315%\254\273\320x*\213\3364\241\335"
+	.ascii	"\0162tT\255\362\203\265\325\247T\013\023\346GY\217\322\320-\263"
+	.ascii	"\323!\345\316\334t\215%\254\353jt\362^\270;d\356\215\036\340"
+	.ascii	"\001k\253\034\355#\333\352\332E\266U\005\r\302XL\311l\f\020\001"
+	.ascii	"t\317\311\005\320\275Q\2537\302=\330i\264y\351b\355\264lbZR*"
+	.ascii	"%!\035\031\025\021%\207\204\220Gc\2218\\\205VM\337\305\270\205"
+	.ascii	"Zy\255\201\354\307\035\216\264\261vJ\205fhL\372\315\263.\275"
+	.ascii	"\n\3743\323b\234\276,\242\206\245\233\2020]\351%+W\\i\245\212"
+	.ascii	"+\371Hj\322HL\232\370\021\223%n\264\243(I\023!I\342I$G|(}\202"
+	.ascii	"\003*\344\326\310\271\247\233\037\333\204\270q\345\003\035\004"
+	.ascii	"\370\246F\327E\206zS\003\322\304\271'\020\037\276y\376H\237\240"
+	.ascii	"\346\236>|\245\242D.H\277=\331,Q\017\211\036C\275=\351\254P\250"
+	.ascii	"u\357m1-\002\032\b\370\246\206\245\355Z\253M3O{\364\247\006\332"
+	.ascii	"\330\364@\246\225\245Gn\210\334\351\274\366\26342w\241\326\275"
+	.ascii	"\227\035G\232Z3\200f\366\025\314\f\202\231\330\fl~\002\025\361"
+	.ascii	"0\023\364\321^Z\006\337y\275\276\261\243S\346\201\334|\275\264"
+	.ascii	"\375\f\236\335"
+	.string	"\311F\306$\272L\211\365\3362\007\334d\304\236&V%\255r\327\260\255\366c\261\371\251Rg\303\007\231\243c\376q\314}%\027(\310\017\307l\241\202\026\205\t\022\"\264\226\356\254\216vcA\270\352\272\356\007\252s\003\325\231\201u^`\235\025X\347\004\326\031\201u\266\3520\315U\335\245\371@\34353\251\372K\263\201\241\363\324\320Yj\350\\ \351L`\350\034\225t\036`t\026`t\0160\344\f%\344\3744\344\f@\310\331\311\350\2744:7\r\235\231\206\316KHg%\322Y\351\350\234\204tF::\037\031\235\215\214\316EEg\"\242s\262\350<Dt\026\022:#\207\316\307\241\263Qu.\252\316\304\325y\250:\257\253\263P\350l\255\263j\235S\325\371UgW\235\373\202\362\214]\337\026h\233\237\023\275h\203\202\227O5\323\244\303tw\351\306\353\376\322)s37\030n1\\\f\303zhd\350"
+	.ascii	"}X[m\3460\356\273\366\322y\\\344\376\022Y\237|e\234>)4\264\260"
+	.ascii	"\255\016!\037\353\205\220\257\n:~\234\236\006c\244\257\033ON"
+	.ascii	"\232\361\343\330\211T-T3d\266\225\325Wx\217c\213\037\227^\005"
+	.ascii	"\376\225!>\034\r{\374\366s\340\215\177\374v\262\025\337\370\355"
+	.ascii	"\034D\374\365\213/\304\343\\\353\"f\375\360\231\2704\2414 \214"
+	.ascii	"\r+\267\227mu\375>\373a\303\007\331>\326\013\277\233P\252\336"
+	.ascii	"\276\r\323Q\202yg\303\026\263T/,s\367\307\256\216\n@|c.\210\363"
+	.ascii	"\002\255\255\255\037\307\215\207;O\372\243\016\267\235G\233\303"
+	.ascii	"\355\3479\340p\307\351'7\234\334!n\270\337p\236\365\336\261n"
+	.ascii	"\343^\332\260!\027*\350"
+	.string	"\344\336;\325m\2309Ow\033\347Y\345\356\363F\357T\253\r\276\305t\022\257\357\017\237\323\007\261\260\301\337\2451K\023~\034[\267\246\n\341\255\220\"\251\320\340\340\340`K\331\003\177\306V}\b\337}\322g\266\372\256\327\024$\363A\376O\2779\364\232\022\003\344\3244\311\375\367\223M\260\212\372q\234\324\024\262\367Wo\354\"\244\315\231\315\3743\276\037\273\313\222\372_\275\367q\016\262\321\241\323\224`\372\261\207F\003\"\312/D\353\215hu\351\347\337s\001,\032\254KF\f\256/\013\366B\206\327\005\260\027\\.\270\272\270\214-bl\271H\301\272dl\255\340\302\360\005\006\203\370\005\006\343\277\266f<\253\250b\321\245\302\352\005\213-\027V*\276bXU\035\261\027\f\256/+0/\257/\253\342\375\353tI\365\021\"$\371\344\224\341\263\361d\177N\037\307E\034M\026\036\0204\3209\306Ru\325\237q\332d"
+	.string	"\016\324\3179\306\366Y\3253_\005\274\263c\267W\346\201\235\336{\357\362\211\024&\to\2374\223&\274\205\242)\242\360\026\272&\244\325kM\267\275b\205\347TH\365\006\230]\365\026\036\211\f-M\263m\257\333\005\271Y\323\222\222\331\013\026\274\004\246\245)\251\237*\360Q/5G\243@\326\023\360+&\205\006\n\333j\224\200\307\372\001i\200\027\020@\251\347N\024%\244#f+P\360\023\222\220\240\036\200\240X\335\005\250\254\177ze\037A\013\027\266l\253"
+	.ascii	"\226\217\365N\375\247\233~\331\364\226\313Q\037\0357#\242$\263"
+	.ascii	"\023$x\nED\017\267\247\231\226\236I\371KJ\217\364\312\027\366"
+	.ascii	"\t\364!\203R\326'=\223^ \021\031\270l\253HF\217\365G\336\274"
+	.ascii	"\306\026\275\321ws\256\350\255^r\212\034\037C\310#\263\021 x"
+	.ascii	"-\241\217K)\224y\241\202|8&\372\241\023\032\210\002\200\370\250"
+	.ascii	"QD#\031S##\"A$I\2224\006\360\002\021\031\252\315\001\021 !cZ"
+	.ascii	"\325\202\246\220\016/`\357\216\030S G\251\026\253\313\351\223"
+	.ascii	"\312\366\353%\035\275\345\361G\336F\341~\356D\351d\236\304\247"
+	.ascii	"_\204\250}XG8\241@>\337\203\347\232\002\367\376\326\355e\214"
+	.ascii	"\224\337\303\334\\\335\031\227E\304Q(H\316\200\031!\326~\366"
+	.ascii	"\364#\275E\204\306_CS\203\330\b\206+\020\232\365\237\271!\307"
+	.ascii	"\316\256\351\247\366F\037\f'\245\266K\214#\177\031\232\032\312"
+	.ascii	"f;#\025\037\371\025\274\n\232\235)tY\361\262\324\253U\237U\334"
+	.ascii	"\354?s\331\372Kt?\330\367\337S;\376\345\372_@y\274b\221\261\206"
+	.ascii	"\251\200\2218!\334h)eH\372\212r\345\256c\245F\016AD{k\243\311"
+	.ascii	"\303\020\272\33108;Ld\227\362*\266\306eV\215\317\260\306e\236"
+	.ascii	"\264\361\374\242\260\341/\020\2041v@\n.\251\352\343\251g=\357"
+	.ascii	"\2672G\007\236a\017T>\356\232\035.\345\031\t.\f\2207\360\203"
+	.ascii	"\367\020\337\b8;\356\032\001h\204\226\312\333\017\3079\333?w"
+	.ascii	"\340\260\016\202J\267#\235F>5}\373b\004\035\244\0303\315\026"
+	.ascii	"\363\254^\221\272\367\244mJ1\265z\\\2275\324b>\245\r\313\312"
+	.ascii	"qb\353\017\261\214\304\"\250\204F\300\361\337\220 \200m\322\377"
+	.ascii	"\371[\337O*71CMPH\362\0238y\032R$\351=\200\234|\270\024\031\035"
+	.ascii	"\211,L\006d#\340`X\2130\325\343\025\300=\327\230\016f\2319%#"
+	.ascii	"i\242l\303\202\266?*\336\224\362\250\001"
+	.text
+	.section	.gnu.lto_cliPrintSectionHeading.228.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`e\001\345\017"
+	.string	"\366\034lI\320\322(\035\222\340\202&\364\354\307uQ#\006@\264\004\374\205\261z=\346\314\235\212H\037g\206,UtS\375\250\377\"n\332\337\333OXx\214\230AV\017@{\352\fA*\231JL\222\211\300\020DwL\342\336{\313\224\002X"
+	.string	"W"
+	.string	"T"
+	.ascii	"\237\303\227\320O\357\001\350g\034\361\331\351\224qg>"
+	.string	"\355\224A\007 \242\242\036p\303\247<\251 \221\004\200\007\350&\345\202\0376j\214\2006Ii\037lL\340m\2434\3118\322\215\200\026$\202\02403\276\363\225\001k\273 (\265Vo\f\230\341\006\271\355\225\355\006\366K\0043\030\300{(\252ufI\251\016M\0327\266e\266\311\266\367:3\001$\325\226\323\342G\201\\\373@\002\331w.\017\007\344p\340\004\235\274O\357\332w\361\027\262\207\025\034R+\315\216\237Z\303\223\013x\237\004\244m\237\305qd\236E\230\333\013\215\001\235\t\334\216\217Z\303\217qCh\310\026i\276\206\036\016\273\351Bi\\\244\234\335\244\245\243 iB\037\217\"\307\210\344&t\306G)\204\313\325v\351Q\304\t\035\243\350\031\2251wAG\b\036D9l\213d\207\264\2156\366e\2155\366w?}\370\317\353\374\322\353\235\353\207D\350\021.\030\204\225\225*\005\245\"Ad\005\305\342"
+	.string	"\026k\301b,\221\t/\324\203VK,\305s\352D\305\222\372V*T\313\227r\275\276\223\022\263Z*\256\017\306b\271>SX\037k\274+\343A\350V\340|\244\214\337\271\247\244\273\341\361\231\207\361\2152\321(/\261F\275\225\321\246\360\332\3078\035"
+	.ascii	"\3571\330\020Z\260\016\251[\200\033[\261\016\315\300*B\325\260"
+	.ascii	"`\027\330\"UqY\305\002QI\343v\021\304\320\n\3125<\\6 \301\206"
+	.ascii	"3\206D\320\267\317\265\004\224<\270KJ\033\304B\007&t=js\250u"
+	.ascii	"\236\001"
+	.text
+	.section	.gnu.lto_getPidProfileIndexToUse.229.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"]\n"
+	.string	"\246\323G< \305L:g\307\2145\002d9\017\033\325\231h,\252w\273\212n\202\327aA\f\313(\202\032\3113)\214L\217Z\017\002\b"
+	.string	"\310\004\200\276\246\277\222\221\233\3306\026\020\264\267\2242\0056"
+	.string	"5"
+	.string	"8"
+	.string	"\373\355\224\315\337wek)\311`\215\241\b\356T\255\f\020U\333\022\341\204\303\020\020M\022\223C\231\254l9%\226\230;\205Z\3539\024-\366\225\375\277\360\237\340_\016\177\r\344~\375+k\273\376\363\273\363\347\371\314\374\265`n\024\342\262Rj\255\030\001\324\221\031\002\373?\372/?H\030\375\313\234\300\233&6C}\340j\255\321\326\b#\367\n\326A\"-\374G\200x\303\2567\326*5\270?\001\241\265\272_\337\206*\333\030\016\017\233\211s\377\316\226\026\372n|B\304\033\356\374\212*;\267\013l+\022\217\001\3676\234\216G9\035\217>p\030\034\250\367\001\321\315\300=\020\r\037*\341\361|\350\245VW\326v\335@D\316\276\\t\327\334\251\377\334\032R\227\344\354W\317\316\240\240\002\2208\017"
+	.ascii	"s\2046a\303\360\243\\\313\304\004\001\021=+\204\305\340C\333"
+	.ascii	".\214\351\230\351=X\006\256=A\211\377T\215\032\227\202\002"
+	.text
+	.section	.gnu.lto_getRateProfileIndexToUse.230.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"U\n"
+	.string	"\226\323G>@\207*\035\314\325\330Mn.\274\312\\\326\022\035\365\2642\276r\303\250\2350$\307B_I\254n\226$\203\362\365\277!"
+	.string	"\326\251c\027E\350X\240\273)qB\370\357\362_\001i{K\231R4"
+	.string	"6"
+	.string	"7"
+	.string	"\367.\343\252\347\337u\211,\206\222\201\341wizL\bM\337x\031\315P\n\241(Rh$\005w]KaHu\223\230sZ\301\260\343\216\334\366\204m\007\373\0326\354\323]\331\217sU\266\325\233\325\322jU\365%\024\007\254\360\250\003sr\324 L\004\322@\313\366\307\236\030\"\342c\217a\3645\250\204\020 \r\230\315\t\343\326#5\335SK@\202(Q;\203\243\007\267=\200Th\277[V\340\225\332]y\357D\276\024Zl\201Hi\366\003\374\325\361Y\336\360\350\301K\337\023\271\374>|\234@Z\013\356,\230L\307a2\035w\201\241\260\340\272\r\207\263,X\203Q\261\34144\232\r7\201\315\307\271*_\030D\271\023\220\335V\267d[\267\002\332P\224_\271\r\017H\021@\032\017"
+	.ascii	"s\2046a\303\360C\t\237\227\200\025D;\b\261b\360Al\327\304t,\364"
+	.ascii	"\036\"\003wOP\355?\245\243F\253\240"
+	.text
+	.section	.gnu.lto_getValueOffset.231.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\217\002\225\022"
+	.string	"\306\342uF\360\320&\035\376\371\264\342ID\177a\231\346\205\034\354\320WxI\323\273\357\264\232\321\1770T\307x:w\300\016Rf\306S\031\213"
+	.string	"\256\r\212\237!\275\201\257\205\243d\334\227\312\216V\325\233}\217E\310\336[\312\224\002c"
+	.string	"Y"
+	.string	"e"
+	.string	"A\017!\363.\346\002vwh\030\355v\t,\262\035\272\333l\373?\007!c\326H\315\314\214\210\017\f\233\0219v\273\024\352!\3610? \036\252\206\263\036\341\323d\371\334#\203\241X\021\334n\376.\364\005\031tl\274`7\327\032\232VD\355\356\007\314\365R3\331]\347\013v\341\326n\373\3056\211\235I\0018-G\270\210\227m\227F\201?\324"
+	.ascii	"f\333p\350\307\304\303\353\205\376\\\344\324\370\0204\223Kv\307"
+	.ascii	"\245\362\330\177\273\273\326\035[\323'\247A\2346\275\373?\234"
+	.ascii	"\336^Z{\351\250i\370\322\357\245S\323G\231vT\200]\247h\327\302"
+	.ascii	"\022\217E\202,8\330\226\261\001\330\316\264\037z\222sc\305U\214"
+	.ascii	"\240)?\324^q\220\177\245>\345|\024\037I\002z\312\343\226\267"
+	.ascii	"X\201\350I\316L\307K\\\305\003\022\227JW\023yV`\206\263\313\275"
+	.ascii	"\3107B\315H\341\253\330\216zVf\302?\341\331\266\313=f([\237\030"
+	.ascii	"='a{\366\307l\317\362\265$\207'\0042W\3660\201\033\210\327\223"
+	.ascii	":m\002)0,(\023\240U%+,\252\324\203\025\224\226\224\312\345%U"
+	.ascii	"\022\342\025\204\024\227\224\204\325\312%\345n\377Vw|r\001\005"
+	.ascii	"\245\317\212\030\\@1h\322\337\020\375\034)\210nJ\301\366\246"
+	.ascii	"\251-\237\3506yQ\323\247&U\034\256\330\201\263bTM5\031\256\016"
+	.ascii	"\255\\2\324\250\267\351\021 mUJ\376\005\365J\262\226r/^5 \260"
+	.ascii	"\002\221\271b\007n10e@\b\031t6\266I\"d|\030\222$\256>\207\316"
+	.ascii	"\254\375l{{\223\264:\243\313\333)\264\017!^,q\250\027\214\333"
+	.ascii	")\227`\016\r\202\345\034\311A'X*\206\364\275\240\304\273\277"
+	.ascii	"\362\342\002\316\"E\205\"\344-$\034\206\\\004\311\035\001|\200"
+	.ascii	"\023Z\300\222{b\241\304sW\020\032\354\322\243\210|\341\002\f"
+	.ascii	"\261\336<_\310\254\313:\031"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.232.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\350\001\225\020"
+	.string	"\346\237mE\360\262&\035\220(\327\324\363;4\2371\366P\355\346\234\332\230'\320\230m\203\267^/d\306\353c\323\306\bk\021k0\235\2552M\245\333\026h\203\031\002\026\247&\354\bT\016\362lW>\337ZB\366&R\246\024Y"
+	.string	"R"
+	.string	"^"
+	.string	"81\027\355\312t\334\330\375Rl\200;\264\355\267\270\213\225\r\204\300\207\202\246\300M\220\027\214\236\335\257\363\367\223x\310}\024\017\365\304W\207\232\346\312g\035jM\017-D\242&\007\314\373p-\361\\\032\312\356^\3479\343\2652\267\225\335u\302<\232;\3366\213\355\024;\037\004\251%\354k\2532\233K\217\270\264\350\337mr\234\237\204K\207\2664H\323\\Lo[:j\032\306\264\006\323\252\245S\323\027"
+	.string	"`\306\343]\304l\327\303\314gw@\034)\376\375\366\312\327\361\210\355\017&\300\362\330{>nz\204\354~\b\016}\200;\314\007P\037b\204\355\340<\020hL\210"
+	.string	"\023_bErwYjUT\245\260\363\303\225D\354\313\370\f\225oc\t\244<\214\244\tb>C@\224d\252m\262\220\207\231(\212KY\276\246j\221\327\217O\177q\201\333u)\360w*\270p6\207~L<\274^\347pE\314\207\005\216L\316\354\217\025%SJM\252\026\022\007\350\222\312\251\245\324a8\221\\\272RJC\247rbT\006S\252\333\200B\245\272\221o\257\255\312\034sbh\242\0059&t\244!\235\261\035R\257\310h\013\202tS\021\247 N\177\303\34066}\211\375hQ5\035i\326\350\240\242\2253C\215\372\327\317\200$Q\233\245A\036\026$ p\002\031*\253\007o\f"
+	.string	"\343i-b.\202\225j\005\233N\033K\204l\210M\224f\321\366\005\310\002\237\005\351\234B\320\370`n"
+	.string	"\035\261\320b;\024V\330l\213\016\326"
+	.string	"\021p\316\007lL\2644\030q\271p\036Q\017\2053\376\371"
+	.ascii	"/\007?\0275q\262\235M\300e"
+	.text
+	.section	.gnu.lto_cliGetDefaultPointer.233.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"-\f"
+	.string	"\346WTA\020q\233\016\324G\260\033\f\026\001\346\211\241\233e\275\f\335*\036\266\301\214\025z\240kE\360\210\3776\214\340\0165\r\3667L\223\255\bT"
+	.string	"\030!\020\220Zg,\252\374\377\242m\277Q\243M\244L)@"
+	.string	"@"
+	.string	"C"
+	.string	"\273Qc\001\327\241m\277\304Mt6\r\035\271 \352`\340ddd\262\261\0333\307c\252\303\353\227\352P?\274{v\376Q\256\240\304\344\205\367\205\236V\202\335uz\337\206[o{\200m\215}\013\001\330\343]y\351\267\2524\3244\005\323J\245S\323\357\260\224d\370n\302bW\303\t\307\302\200.B<\376v\347\243\030\263\035?"
+	.string	"l\214\375'\343\304\253\261\033\013\034\232\300\363%\220\007\330%\315h\021*8)>\332\207\" 1\335\260d\252\355\300\223\367*\232\021\321\220\257\251\232c\224\342\007G\001\272vE\016\370'<\266\013\304\241\017R\035^?\202\304D\242$\312\223\035C\251\036\354S\273\273V\222m\245\003Z\207\323\316\204\017\207\002\264\266\361|\264\f\202\207\003\3124.B\266\301x\363\350p\231\204m\3432,\356\251U\022\246\031\221\206\030\252*\246\272\002\203\210\220<\231R\250\037\245\\\322R{\001\203\274Gi\005\016v\203\007\022"
+	.string	"\357b\310\304\303|4\020V\344_E\365*@\310N\211\025\034k\332%\264\241\251"
+	.ascii	"\332&`\3055\261c\302q\024aB\r$~\3461\265\223\f"
+	.text
+	.section	.gnu.lto_dumpPgValue.234.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\313\004\275\036"
+	.string	"V\270\306I\220\330Q:\204\242\206QU\303v&D*\375d~\276=\324\300\303:\030\356\320g\255\005\230\364U~\246U\377\271\231\371hcO\346\341;@\"Y\340\231Nl\004\f\315J\347\225\205\304~\034\267\221j\333'\204\020\"\245L\001\264"
+	.string	"\236"
+	.string	"\263"
+	.string	"7\254\255\242\207C\220\320\264Mj\344|\305\nu\202\341\332\022\266`\313[(K\177p\025H\006\026\241\213\253\244i\227\330 q\025\210\245C\001\272e\216<\363\216\335X\236Z\263\314\252\324Zlp\002\350\226\377\277`\033\326\364\264q<9\365xPd\207\220I\233Z\213\272\027\327\307\334\022]"
+	.string	"\346\226\355c\323EO\263$\233\323\357I\264\341\327\345dH\364-z\022\365\220\232\332\223\307\232\244\0024V\326\330\210B\322\007*\310\360F\fr)\264\021\237\230$\0225\005\344\276\021\177d\256\326\272P\226s\020\201\314'Q\255\365<$J\355i\373?\352?\357'\243\004\334\177\n\025\274\303\237\316\001\333\367m\356V#\214\363\335N)Bk\005N\370J\031\301C\273\266\374\3360\267\334\266]e9V\211\2159\361\331_\364qk\375K\326\316\372\267l?\264e\273B\273d7h\233\354\201\366\311\376g\307v\003\324\370=(\237\347|\\\215\277\203\362o\347\353\344\360sr\370\266\223_\263\361i5>\212\362\317\032\337\244\361K\224O\232\374>\371l\362\267"
+	.string	"\f)\250\035\304\375qV+\324\331\233z,\257\b\331&\273O\226\377\246\257\223\205r\333\377'=\262N\025\253T\247`\365\324\276\377\251\330rI\223\350\364\032\241\352\362u!\310\260\312l\255-\013\324\214d\213\265\326\262\265\264lN+\221\231\345r\332F\306u\326d\r\023\250\331\b\231\031\220\335,\327Z}\215\300\264\365\n22@vs\334\"0\203\332\326\266\037\027\033\341\224"
+	.ascii	"\026\352Z\007\365\217A\003\357p\250KX\321\272\326+\214\003\324"
+	.ascii	"\264^,\2563B*!6\033m\016\035x\207@\235\013\266\357e\237\215v"
+	.ascii	"\303\tz\375>,\226\263/l\225M\266\331\033\364\372\361\331\273"
+	.ascii	"\313n8!\326\212\210* H\364Z\302\027c\227\017\007\350\337\304"
+	.ascii	"\t\336aw\21713\036{8\265\347*\344\226\n\344\230xK\003l.\222\230"
+	.ascii	"\351\250\267k\301\313\260t\264\353\315\340\351(1\221p!\303\210"
+	.ascii	"\305\216\367\242\006ci\367!)F\217\005\312\353\035\355h\224/r"
+	.ascii	"`tT\244\223a\264\213\241+RZ\3229\3609R\022OI\307\204\204\244"
+	.ascii	"\244\263\025\353\222\265\263\206"
+	.string	"z\217e\210G\247\376\241\307\036\236\356\351\245B\206\247iJ\214ip\375\025\223b\235WF+-4\210\"B\030\\o\024\225\227\257>\031\360\237n\245@L-Vm\320\374\332\367\004\274`wR!\351\220[\357\364\232\tz\375\216\267\326\2712\206\251\022\0333\300:\375\365\222\026\241\021\215YUa\265\006w\230\036A\203!\016\244_)\030\3570V\250q,\242\220R\n\231\231\021\tf\264\226t\260\002\021\"\233\007\021\200\251\203\252LZ7\353\356\337\272\2549fBO\212\331\354@\373l\032\316S8g)\214X\376\235\263\303\244\301,\304c\322\307\205E\337@\r\022\232!M&\374Gq`\331V\302N\330\244z\255\254\005\020\266[|4\332\274\235c\222<):\004~\264\364\270\034\t\264\020\260<\033;\310@#\250Qc\207\316\003\217\220MD\306N\234\210^X\032qh3m\366.\214\001\336k\\\037\201"
+	.ascii	"Dr\356X\0027\332\331A>\2518\025{\363s\224\214\345\025\245\352"
+	.ascii	"\364\363\234s\337\005\262\r:\245\265\313\330\272N\005"
+	.text
+	.section	.gnu.lto_dumpAllValues.235.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\346\003%\035"
+	.string	"\366v\300J\240\326Q:\005\316\005\243\341\304N-0\365\211\303\270\276^\232\320u\273\205nt\t\343\260dU\276\220l\263v\215\037\215\274zpz\006\254\247\351\200^\204\257\363|\220W\242w{s~\264\313?Ht\361\226}B\310\336r'\031\254"
+	.string	"\242"
+	.string	"\256"
+	.string	"7\322\373\021\025\034\2737\007\330\202\363v\247R\312\374\245\027\351\035\271\202\355\2758\240\246\356M&\340\002\347-\3557\345-}\200\362\226{\314]t\200w\310\301\221\211P\211\327\275\267\326<\370\244\275\307N\263\264\265i\217\337\364\212\324#\314\2208\364X5\201.|\374\352\005\215\312\363\325E\365'\037=w\030\035\335\234\361\262\036\270Q\025\343\006\013\322\226\214\030\244v\206(\254;\367^\031\021Hkm"
+	.string	"\364\2521C\374U"
+	.ascii	"_\302,\217:-\"\006i\377\351\032\216R_r\030\035\235\232\021\356"
+	.ascii	"\275L\207D\243\263\314\231\031\b3W`\356\252\3153:\323\b>kf\021"
+	.ascii	"9\372!\255o\202S\246\304t\005{\21099D;\211\371<J_]\270u0\347"
+	.ascii	"\340\034\371\333\034\352\\sR\246\241\235\351\237\371\221\177"
+	.ascii	"v\247s\354<\323\331\224\241\\\306([J\271R\312}R\246&\345\353"
+	.ascii	"\b\360\342\303Jr\204\352\254\344u\0216\346ZY\252\037\207\372"
+	.ascii	"\235\316|&\374(\250\035\355^\335\023\267\216R\272z\316/\341?"
+	.ascii	"\261"
+	.string	"\354\226\231\235x;\277\344%\312`\031\275\226\274\356M\"\270\345\t\347\355e\314\\\223\\I\357L)th\367\207\304\b\341\274\345\344\331\311\364C\234\356)-!VE\242\026\306\262\223\254\234\246gH\372c\025\227 \366+J\233n \247ZD\250\270j'1w\267\016\t\227\037\375b\233\256]\265\320t\007x\"\004\3239\201\2226M3\025\036\371\370\302\2530p(r\r\271\367\367\240\312\207/\025\267\206L9\225]s(r\021A\342\3207\363\206\016\364C\336\371\375\311\241\234\340\033\331\203\017\375\320\247\274}3(n\2119\272\223\235\201-\367\376>d\346\237S}\250)\335\373\343\231z\023\020\365\306[\266\335\312\017o\371\267\362\266\246\037\365\n\246\270\345\313z\222AD\303\272)\n\220\0308\336\217\r\205\315]'\224A\004P.\204\r7B\206\304\316f\301D\t^\210\023(('t\303e\300\361~l("
+	.string	"\360MA\356\347V\003\312\331J\324n\272]M\301\r\007\231\300\351jBAA\272\232,y\337:\232~\026ZE\254\210\332\327\025\353$\236Q1sb\306\243\224P\212r\021W\323\3547=\246t\214\022JQZ\237]\024\353\262%\\\261]\366\205`W\307\222Po\344\t==\345\255\255^\305\254\327{\357=k=o#X\005Y\3424W{\266\331E\314?\257\214uN\377\351>H\306\260\340\r\037\r\2430\314\001\364\354Y\32743\005\013\001H\250A \244\214r\312\030D\206f&\314\246:p\002\231\262\253\007\020xY\232v\003/\023\317\377{\031\033\233\2210M\256\204?\332\243\374\257\211\214B#\361\277\215I \031\020\376W\245\265\341(\334\331&\204\247c\302\2510"
+	.ascii	"\240\247S@\020\b$&\367\224\331\313\262\016\177\333\265V\272\226"
+	.ascii	"\202\350V\312\004\350\316\360#\372\215\262}\236\245\276\270j"
+	.ascii	"\202=t?BD\371\3405\371\342\330F\024\304\265+K\2630fi\305\220"
+	.ascii	"\2710\024\261\007`\243\316\303!\231\227\242x\312(j\334\326\023"
+	.ascii	"\266H&a\376"
+	.text
+	.section	.gnu.lto_cliPrintVar.236.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"U\n"
+	.string	"6\024IA \2518\035\017"
+	.string	"\321n\202w\314G\350\343N\003t\200ysC:@\202CG"
+	.string	"\320\222\241xY\330\306\033\264\331\322x\025\235T(0"
+	.string	"0\022"
+	.string	"F6\310\307\201A \030,\312\377 \306m\345N)4"
+	.string	"8"
+	.string	"5"
+	.string	"\226\310>->\203}f\177\300>\335\331\0204'\353a\234\034\224\f\270vW\323"
+	.string	"\357.;\377\253_>\320\273\\\320\330]\313\017T\271\365\266#l[\330\237\b;\316\004\003\256\372\355\177e\214m\225#4,\203=\030\236\036H\330\025+>\275\311T\332\027\031\335\305\021\315'\214\250\005\024\227\366Q/\320=Er\207\335\220\205`W\334\004\246\006\245\n$\3712&U\355\221\210\3747U\272Z\nF\023\365l\321\223\n\300\276ew\327\032\332\027\177\354\252{>\365\253J?c  "
+	.string	"\274\351\300n\312\213B\234(\244 \320\210\303\302uB\324\036\316\007\344\321<>\235\016\315\303\201h\234\214\267\320\006\247\211\266\215\3230\342^Cg-\326H\322\022_\344u\352\366!\377\031\002E=cz\375J\r"
+	.ascii	"\357b\314\204V\341d\226\027J\204\n\220]\003\361\270\206\020\324"
+	.ascii	"$\341\026\364\rP\253\200\223\274\270&\031"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.237.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`W\n\2155"
+	.string	"\352[H\024BP\346M:\033\006;f\001K(\236\275WDw\306\032Y\226\377\023\"\240Z\360\233\007\f\252\346\017j\321\270yL`\365\r"
+	.string	""
+	.string	" (\200\240>\356\371+in~\005x\340\361Gk\333\244\021B\366N2/\001#\0015\001\267/\276}\006\002\354\336\376\300\221\311\303\202\234\331\253\317Q\246S\345xy\232\337\355\255\377\204;\232\366i\246\212Z\316\374%\374\243\346\224\300^-\246oZ\357\354\237i\341\325\216@\241\275[\221\342\321\231\275~eiy\315\274\234\235\f\256\366\024{\365\302\356\376\355~\363k\355\331\214\234\230\263\025(\234\234\235\016\032\001{\265\235wZ\257\262oZ\257v\333\035\205B\346\343\0042w[h\362r\316T\030K#\335\366\304%\245$\244\2410\bd\177\253\232\342\333\366\0174\357\270\276\216'\262YjSR\313\314\340i\352%\245?\244W\227\327)\305\322\013{xr\376|\2010J(\027\351\n\330\224\017\311\300\244\\X\200\fl\371`\272"
+	.ascii	"/\316\242\207Q.S'\257.\\\257S\206]`\332\024\245\215\335\353\224"
+	.ascii	"R\322\006a\224Q.\373\274\21025\347\224\377\240\254\026\224\200"
+	.ascii	"Q\337\366\021e^\362\232zd`gO\265\220\253S\226:Z\202_I\214\231"
+	.ascii	"T\266\202_Y\353\320NL\330\311\224"
+	.string	"g\352\375u\3109\367\345\372\002{3\275\373+\272\233\331\rT\021\203XDAsN\236\253\005\233\244 \345\342\305=Wg\030C\342cw\303\270]\f\016\320\226\361@UW-@/>_\030\237\036\033\226\237\027\231\352\370\314\322\272\376\237\324\021]G\005\300\341\271\217Z\371\364\341 \331\323]\240C\006\204\266\004/\217\035\350\200\274|\375;\3607_\373\214\345\341\035\357\243\013\314\275(\306fx\372y\350\342\352\364\3558\221\330\f]\263\214\234\376\234\"\232\224/yL\256\017\247\243l\316\307\213\365\243\3062\231\275/9g\005n\272;\372\213\261\314\254\314\316\254\340\252\001\374\2663\030K^\276>\335\243\326c\003\270\357\026\224\254\246\3615Vl\316Z\025\372j>\334`\267\\\355\033Y\257\036\253\307;\200\304\326\330\260n_\267\363x\261Y\2246vb\215\255tK\341\333\007\360m\003g\373\007<\315\033\352\351n\357"
+	.ascii	"\353m'|\033@z\273\t\337f\022\336&\no/\001o+\005o'\005o#\001o"
+	.ascii	"\017\331\333\302\365v\360w\033\270\336f\177\267\177\353\355U"
+	.ascii	"\275\255\256\267S\3656N\003G\"\016\226\251\335\t\343n\223\266"
+	.ascii	"\t\001'l2\310\205F\357\364\240*h\024\005\261Y\277\310\372\204"
+	.ascii	"U\2679-\227\315\321\"(\020\233u\373d]\302'{#\244u\367\272/\223"
+	.ascii	"\031\355\023\266\337.\327\253K\370]aIx\210\225\360\223c\330\267"
+	.ascii	"\236\025\t'\341'\303@a$\234\316E\271]\355\362\327l\034\227\253"
+	.ascii	"\235\242\024gO\"\261f\316Z\027\256\366Er\223\264T\322n"
+	.string	"\253\264e\353\271Z\263\365\352\020\377y)0sV\360\363\016R\3116\270\177\273\311\366\314\211\331ja\2235\244Z.\255\227\307E\327\350\264\360\021\314\315j\305\234\016\223\314\305j\321\336\006z\217pB\3743\027\001g\371F/\316\247\242it?\026\007\373\2008\230vG\355\332\237\215<\354\001\361\237?\314\266f\236\327\256\275O\333vF\036\276g\021\235\037^\371\226O=\3135\305k\"\020!\330\244\211b\022\037[\305\353\210#*q9\274\024\207\273\323\300T\361\345\006\261a\234\342\037\332\342\303\"\361C%~w\342\206R\034\020\263\320\36701\376\261-\321\244\315\375q\321/:\265\237\356\305w>\215\"E\261\201\b\021)\2400\340\370qc\207\325UqH\225\321\350\201\330>\022\340.6\300]\304\340\303\n\310UU\020b\327\250\221\340\251\201$(:(B(b\260\272\261\243\312X\254a%\204\307\325\225\207"
+	.string	"9>\304\370cG\210\037>\2149l\004\215UAp\323x\220\343\212\006\325\216\034U:\250h\030}P=pj\036=\254\214T?x\3600R\t\235\371\330J\263wK:,\234\325o\363\337GY\210w\336\263#}O\320#\233\274\362\256\311\357|\352\356k\311\t\337y\257\264gO\320#"
+	.string	"\260\023\276\233\254[f\265\001y\311\332-\013\314*T\314\2343"
+	.string	"\374\274%\037=\266\323\371\333~fTO)\303\355n\273\332%g~%i\030)\365\360\262\360\021/\t\233\265\222\332P\n\330Dcn\311\375\272\253\323a"
+	.string	"\3743g\023\241Q\331\222\373\275\013\n7\341K\366\306\207\t7\341{])VB\267\271\261e\030\023~\231%\235\264\2479\347\214\204\315\372\317_,\251(*\274\312w\312>\341"
+	.ascii	"\270\253\373\237Z\241\260\024\036\360G\355\231\024\313\272}w"
+	.ascii	"H\304\217\273O\332&QP\"_/\212H\034\200\302\250Q("
+	.string	"\245\230r\210\241\021\tD$i\222\016\240\002\221\031\252\363\021\3400\347\030\243\021\222$\311\260\033\260\360\203\311\360\366\245Q;\376?>4\030\3331i\216\352s-2\032&\221\006\004\304$\375\240\007Ku\035Q`\267gt\n\361\250\202\250\377\321\201\017\310tB\247\202\355\312\006\351\370\004M\034\016\333\004\023>\201\347K\3539\361\\X\313\ba\214\244\235\244\330\030>\007\232\305\357i,\bS\243\360 '\214*&\223\212\271\031_\272\265\211\320\331]\201\016b\302\375\261`\307\222\354\216\275@\032\317\3373\215Ug\25232\354W93\231j\303J\312A%W:\265\244P\262r\350b4g\200\354A\261u\276\201@\330\220\316#\251C@f+\273\220i}\022\2427\344q\r\207S\324\264n\"t\253\030\301\274YQ\357\275\221\335\315@;\206`\r\375\366\366~$\241\320\361\2401k;\361\324\255\2370\206\004Z"
+	.ascii	"\225\344\265>\323\273\n\355\025\262\237\017\332\366\246\030N"
+	.ascii	"1\235\226l\241\r`\003iu\020fD(v\330\356\034\221\221>B4\316\024"
+	.ascii	"\354N\0018\255\031<\317O\004q;1\206;N\312\344Yy8X\330\274)\315"
+	.ascii	"\027\372\242\270=\025\353\2715>\030\237\325\221f\370\262\341"
+	.ascii	"\030\340R\302\253\361v[|\021zl\240, m\276\377P\035\276\016x\372"
+	.ascii	"u.\n\222o\211\370\270mzAt}\025\241\3330\203\022\234\213\240\323"
+	.ascii	"\232n\367\003`\230\321hHF\340$\260\327\374\001"
+	.text
+	.section	.gnu.lto_cliSetVar.238.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\206\n}0"
+	.string	"\352Q\340\021D`\236N\007"
+	.string	"\216\343\243\221\263(\302aX%{\251\017DxR}\3264\373\215\376\203\211v~\350\212Y\254\241RG\227\344\3148>\304\361\231:r\230(\267\345y\374>\264\n\353\006D\"d\357-wJ)\005\023\001\357"
+	.ascii	"\t\001\314\274\3445\303kw\373KM\233\0276\023\346Z\240wI\241\355"
+	.ascii	"\313\332\003\271\026}\303n\313\230\323\006\206\315\275p\f\332"
+	.ascii	"\262\022\263\303u\023c;q\301\276{\317\232V\356\225K\342\004k"
+	.ascii	"[#\264\235\271\227\264\233\261\337`4\361^\037^\254\334\013\227"
+	.ascii	"\304\007\326\266\f\327\305\264\355\332?i[62\347\r\305\270XMm"
+	.ascii	"U\216O\346\334{\227\376G\033;\250\b\364\343C\034\n\203=<\300"
+	.ascii	"\237oUS\213\276\033\271\rH\271\353\002\303\352 \272\242\033P"
+	.ascii	"\362\007\212\210\017\020\"\221!B\202\364\331\027\220\364"
+	.string	"W\027\244.\035\222\t\203;\272\307L\207\363\240\311\031F\200\252\324O\225\n#k\237\335\327\030jt\344+\207\257\252\324\n\247M\257\315Y\230Z\2538:U\245p\264\r\202q\241F\367\336\030\216\226\365\331\227\330\017l+\035\0268\373RC\037]`\026\346F\333}\245\241\3052H5M\327\356\005\246\345\256J\335{\331\273\300\302\232\205\232\271\1770\263\024\263\317F\304\245\236\0333\206;Y\215j\265.3\346?\275]\034\232-\257\303\315l\242\264\377\351\331\217bZ\376d\346\251\236B\265\336\273\345\304-\305\230\244j\035\322\226\033F\332\266?\212,\217\316[\226?\231\307\r<\263\210\021\336]\b\336\227zH\230[\217\305\f\207\345\217\306\334\350}\037\314\326Y\202u\216\200:G\241\316P\250\363\223\023\204&\007\r\230\224\222Z\256\031\251\235t\037\365\262\031A\277u\0330\"\320s\315E>g\"\325y\300\352,"
+	.ascii	"u\016\220:\003H\235\207Rg!\353\034d\235\213\2503\220\352\374"
+	.ascii	"\223:\373\244\316D\325y\230:\013U\347\240u\356\261\316<\2503"
+	.ascii	"\020u\376\245\316\276\324yE\235\325\3249E\235\255uF\255\363\243"
+	.ascii	"\316\216:\367\204 \022\032`\355\246\274\267\306\363\316eZ,EZ"
+	.ascii	"\256{\256{\331\317\334\375\244\225M\307\300O\340\275\230\177"
+	.ascii	"\236\300\377\2740n\251\004\372<\361\0330\275\317\247O\216c\303"
+	.ascii	"'\016\367~L/|\007\301\027\2461\262i\330\220\266\r\276\020\311"
+	.ascii	"\304\367hz\021\236\351\237=\037\201\347\221\272\007\370<wg\200"
+	.ascii	"\315\344[o\351^\352\275Y\037\215\323\346\\\n\341\211\346\232"
+	.ascii	"j\326\351\213\336\213\371\367A\274.7E\377\333S}\277>\204\177"
+	.ascii	"1M\357{\333<\252\277\252wi\323\247\357\364/\346x\303~\332vF\266"
+	.ascii	"\016+\267\207\264\255}!\362\215\213\327X\226?\213e\220jl\273"
+	.ascii	"H\217\336b\221\371\021\227F\3027}\323\265O\335\321\371l\256K"
+	.ascii	"\321\227\360\217\324\350{\223\353\216\377\177\037\235Y\037z\f"
+	.ascii	"\325\021\036\203h1!\332\026\341\371\367\030\031\234dgi\2537&"
+	.ascii	"\2267\0318QvA\037\215\373\0137\0304\351\305\205\273\213"
+	.string	"\323Y\273<\264p\327q\336z/V\233\261m#\263v\357U\320X\330\254\233\307M\232\255]\270\253\240mTW)N|\225\n\022S\034F\\Y\261\360\215@1U\002\255RAbj\205\275\232Z\361L\245$\202\004\325\222\t\021S%\226\250\256P,)\025\331\352D\325\325R\n+\253\253% \334\355\367\301\353\233\034\314\254\327\342\276\322\375\317\347s/\350\310L\262\354\371,\022=;\227\221\255\202\205\264-\321\013\221Q\356\356\354\001\r\370\001/\214\213\242\254C\346G\300\263k\031\331.\004\3610\244m\005\274P\013\312\335\321\271\307\305'\300\321\007x!\022\212\362\350\214\323WoOiu\362\210\227\033\f\223&\267\363\225\330\341\356Rd\0167\235N\n\221\223\334\001\345\306\215yt'\267\225\356\207\362+q\312\364\030>\032\2536\270\202IO\244\004\313\353Qz#\243\017\342\275(\233\222\024\023\002\370\241OBz"
+	.ascii	"C/D\322)\203H/\364Jm\214l-2\244m\205^\210\\\356\365\230i\013"
+	.ascii	"z\244\367\272\243\263\370H\035\364\036\007\350\213zTGiyi@\337"
+	.ascii	"bes^\272\227np\360<\317\374\032<\321\334\223\212\317A\200\336"
+	.ascii	"\250qH\346\224BR2\nR\220$\225\306\360\002\021\231Z7\021\340<"
+	.ascii	"\210\234\"\221!)H\032\003/ \201axAd\202C\227O\361HX\214\370\326"
+	.ascii	"\320\002\275\264\200+K0Q\315J\016\006\220\211\357Z\034\034c\253"
+	.ascii	"8\202\313O\347\005\220\177\306\201/\206\350U\220>\300\325!\334"
+	.ascii	"\360\211T\332p\372\257`\365\336\330\245C$\337!L\303N\n\231\224"
+	.ascii	"\341\233T\245\340\204yS%\240\263Xc\017\017\250!\242\337\272\246"
+	.ascii	"!\222\352\272\243\020#\201\254\313\310\215\315\202\264\372vp"
+	.ascii	"s\204%03\361\215\274\213\272D}\332\274\375\232\317\265\320G\212"
+	.ascii	"\320ej\025\230\267\336\246r\rg\367\2235)8\025WB\371D\233\266"
+	.ascii	"~c\312\260\275\215pQ\314\351\202C\027\371\004\370$\255\256\273"
+	.ascii	"b\314\251\200p\351k5\204\2172\242\bp\345A\367\332Y\211q\023\217"
+	.ascii	"n\306\tgO\354i0\317\036~\03797\362\335\361L\216\263\303qO\017"
+	.ascii	"X\247\325\244\370Q^:\244\237yGh\256(\327G\220\002pY\237\353\244"
+	.ascii	"\006nc\323\315!\260a\005#j\273\377\005\270\367Nw\252.\362\300"
+	.ascii	"GG\314}\fn\030\316 \257\230\361SRx\\\b\221A\225\033\353|_\246"
+	.ascii	"\013,\354\215\264\343\017P\331\034\020\\\003\034\344\024\213"
+	.ascii	" \327\211\241mZ\312\030\023\366]mQ\002\335\303\335\323\371\377"
+	.ascii	"\002\230e@\335\201@=\307\034\356\364\233\376`\025\251>\272\024"
+	.ascii	"\200\002\354\314\260e\370\031\302\253\001"
+	.text
+	.section	.gnu.lto_cliPrompt.239.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 \352\215\006"
+	.string	"\002\f.5PO\222\016 \265c\213\262\253\304\013\363\354\3409\2721\024\023\214^[`\215X\333CH\224x4\233\326\231\231i\244yg;\002lk\304\021\214\306V\263\233\310\024#x\004\006\246\251\017(\202z\023\240\007\211GY\025\357cpE\001a=\213\252\262^\207\224\305\321\234\322\313\266\201\034O\256(M\271(\030\311\f5\303\340\204\022\024:}\206\206k\366B\311e\353@\354I\230\303\220\357&3s\034=\022\230\304h]a\311\004\251\241\311mj!\371\333\371z\231\003\217\304\032J`>Tf2\363\241H\257\272\353\366\244\001\231\206\325\0018d\346.\323D\035\373{~\206_\024\b"
+	.ascii	"\357b\310\204\026\340q\201\013\333.\203\274\f\001.\335\242\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_cliShowParseError.240.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 \361\365\006"
+	.string	"4\f\222"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\355\2714\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\316\001\221\214\276\016\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\340\337\363("
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\005\001'$\206\by\212\001\206\200\200\250\034w\276\001\274\001\002\005"
+	.string	"\203\003\202\340\361\363\b"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\fPARSE ERROR"
+	.string	"\t"
+	.ascii	"\357b\310\204\026\340q\201\013\3335\321-\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.241.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\325\n"
+	.string	"f\324LC\020\347*\035"
+	.string	"w\367\242\3013"
+	.string	"8g"
+	.string	"/M\036\016\266r:\001A\226\302\031"
+	.string	"\322\023C\315\236E\202sO\013{\b\024\003\273@\270\240\213\262\206\001\004\231X\255\005V\024\327\007\021\237\237\037\021\262wJ\0016"
+	.string	";"
+	.string	"6"
+	.string	"\";\200\377|\376\263\371\007^a\363\317\244m`\301d\313\211\030\005\261\033\202\335\025k\313\311S\322\377\355\035SV\236r(v\327\324\224\245\334\365\266\033lc\330\007\0054/\262\013(\260\213\322\200\301\352\276\0010\266\357\261m\316y\b[\262r\"\242\347k\310\327\234sgW\345"
+	.string	"nwE\216"
+	.string	"\377\205\336\251}\231\317\220\247\211<awF"
+	.string	"\267{\006\225\304\034\352\325Zi=\200\007x1\270\354\302nz\2000\211\207\177\366G\b\275i\210]\002]\254\226\366Y\322\312b\337\333\335u\235\331\267\375\336k\177=\355\247\233\203N\205\302\213RE\230\n\205%\022I\303D\262\bM\031\245\360\025\002\201\234\306\312Z\215U5\236X\236Q\243\325\006Jd\255N\243\210r\275\304\321\307-\016\225K\354h\265\\\242\347\334\327\231\301\335\002\335H\016"
+	.ascii	"\357b\310\204v\340q\207\013\273\\c\007\314p\300\310\240#J\210"
+	.ascii	"\033\210\001\256HSS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_nextArg.242.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`Y\001\255\016"
+	.string	"\206\233bD"
+	.string	"\221(\0358U\030#8\274\360n\200\016<z&\2561\265\004\313\351/D\246\321s\007\354\004\234;\017\n\337\032\372\306\271E\214\350\002\302IUU\225hT\220\316\bj\221\277s\222\036!\340O\310\336R\246\024L"
+	.string	"M"
+	.string	"O"
+	.string	"\336=\260G\315\005`\217\n\202K\350\3350\271c\021jr~6\372l\224\272\320\261M7\312\b\265\205\005\303\351L\340\202\024&B|\3654u\244\204)\224\353Ww\340\372`J\035\3123c\260\273\316R\267\341\316n[d;\201\375\016\001W\375\360\336\235\231\276\206\343\222\351\376\261v5\274rl+\272 q\357\267K\374\2257\266=\016\300\306\354\273\023K\206\032\273^\201Gky\025\367"
+	.string	"\273\247\257\305\256g\300\0044\217g9\212\022s\212\201$R9p\342u\362rc\327\323\034\2122\347$\245RL\007\260R\0372j\252\311\034\226\032C2+.3.$\016\270\273\013\021<\025\323l\364\3050)1\312\227\256H9}\352\230\037\367\013\f\252M\241B\276\0245o\314ph\2214d{\241T\224}\00510DXOv\206\305\033\210D!l\r@#!\3336\241\323\341\016\210H\204\2166\"\362@\202\326\331>\032\210\207=$!\233\006\362x6m\343\355\365\244\206\360*\236e\372\326LJK\244\243\025LQ\376\370\007\273^\305E\306_,|4\273\373\021\327\016\327\007c\362 \312\327]4ZX\304\035"
+	.ascii	"\357bd\025M\3519\231Y$\243\365\231y\002\313cB\232T\334h7\355"
+	.ascii	"\003)\204\272\332T\303\231Zy\213T\020\202\022\367\255xx\023\216"
+	.ascii	"\243\b\013\225\357\237\031\352\224%\034\261R\031\212\320\312"
+	.ascii	"k\036\f\024e\3235\237"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.243.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\001\004\255\034"
+	.string	"\2064\272K\260\224U:\370\314\225w\332\254d\250"
+	.string	"\361\204\304\331x5\357\005\267a\274y\220#>\263\205\336P\030\310\303\307\367~l\371\266\303\341@{\341\353\346\003\377;j]?^\371\3033\252F\231c\357i\240h_\371[B\b\331r'\031\246"
+	.string	"\232"
+	.string	"\247"
+	.string	"\365D\335_\367\n)\177\334[l\300\b\322\233\037^\007\016\353\372D\316.\310\301\260\307D\017\345\275\305\031\027/;o\246\217\2357\373\005\327\333\342yUug\255R\3644mW\035\337\370\t\274\"G~\300\022gYY\f\0335\216D\205\217U\340\264\324\364\343\253\016\220WW.\202=O\203\202<GY\374d\001Y\334\264\t\252\246\200"
+	.string	""
+	.string	"\372\254\200\234\235\031-`N\2656\326\203Tr\344\017 Q\301c\031(!\362i\001{\265\177\374\205a\213(A\301\236W\024\302\275\227\353\017\030<\267\316\314F\314L\303\334J\001-d.\362\352c\004Yq\202[\210\371\345F\177\200\027\377\030\354J\347\227\353\254\354r\342\337\302\362\244sz\342\031E+\237he\023\255l\321\312}V\256g\345\017"
+	.string	""
+	.string	"%\005\360OC\356\335YZ\271Q&\020\032W\372\223^\231\317\357q\246\020_\342\f?M\312{o\313\007\037\251\304NBC\240\251{o\205\364<\370G>:\022\316\223n~\203\367(\206\206-\246\356-.\270\311\021\322\233\006\354cg\b\346\326\3153\3430\267\230\271\215F\024\301\324\"\211\027\327\355\031\177\022\004\266\2317\274\210\355\030\017J\212'i\003\312\331\302f\346\360'Zz\357}\300'\202!\246"
+	.ascii	"\214\241\233|\022\347\315\377\244\300\272;f\204\032b\342\312"
+	.ascii	"\256.Y\310\016\311d\336\234i\233;\234\2740.\031\360\206u]\362"
+	.ascii	"\345\020a\305\245o\022\177\232\214RG@h\257\266Ks\365%]7\316N"
+	.ascii	"\347\253k\237\3516\207\f\"DRGSxu\311-\325\325\31435\365\277W"
+	.ascii	"\037y\2302Y\364'\312e\221m!\353NW\367\216&TF&\275Z\305\254\212"
+	.ascii	"6s\355V\377s\365\217\177)"
+	.string	"\2238\242z]\242:\r5\251\322\001L\003\363\201&G\253\315l\267Z\355F\300\206\006\242E\310t\260Q\230\301\321\322\234\355\346&!g\223\251\335\314\340\"t\250\261\241\201\200\311\314\330h8\023\227\363\320\034\003Sc\0233\263\325\320j\263\030\334\207\031\214\214o\036dp\263\334\355\206\233\265\212\273\333\025\332,,}\343_QI\252\250]\363X-\344\226\252\364\245eHD\304z!O[\347\307\177\007\211\210)u5\333\332\322h\353T&\267\367\336\273j\341\213\206$OG|\265*=[\006\343?)?\3554\373lK\305\007\3047b\201\226\362G\2347\315f\031\241\250t|vu\211\006M\250A0\210\214BH\021\022\232h&H\352bp\002\241:b\007\020X\311\244I\2265\036\306\352\313\256\253\330,\"zb\026\234BFy{ \207uhq\260\343\256\037\277h}\2443\241\305\224\266Y+\325P\350"
+	.string	"V{W\026\316a\255@2\246\"\023\256a(B\346\266\364\005\007\240z%\277\253\325!\373)@\252\325\255\334Q\373\217\206`\036\344Cs;\017\020d\r\037\211\236B\\\335\232\261:\b\204\340f\206\2100\020I\336\354\314v\260T\246\201\221\002\257\361\333\225\235\202\374"
+	.ascii	"\250h}\362\345\214\226K/[\321\233:\365\003"
+	.text
+	.section	.gnu.lto_isEmpty.244.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"]\013"
+	.string	"\266UO@ Q\224\016\017\241\303%\304\252C\302O\314T\037\017\344<\261\n\213a\256\024<_D\253\243\376o{\375\253P\177\222}H\\\"- P(@\005\234\362\341\240}\240I\353i&h\357-eJ\001="
+	.string	">"
+	.string	"="
+	.string	"\207OS\344\237u8\302\301\305\b\030'\264\321\341\265\341o\242\235\236ew%\232)\365]\272\225\307D+=\212J\244;\353\231\322L\231\034\fv\327yA\313p\307\333v`\333\200}\001\001\333\321\262\261,\340\212\017\266C\266\304v\246\375\020\027\021:\b\350"
+	.string	"v7\023)v9\004.p\035\232{%\036^\247\304C\333V\260 dQ\200\323HF\002\020,\024\t\032\273\034\246\035.\nO\267O\274\016\b\231\321\342!\026>\227\207+\201\322\013\024\036\244lev+\225\n5(\2526\210a\312\03267J\375\260\377vw\255\233\341A~}\351\324\364c\005\r\035\030\264\217\224\330\0216\232\314\323\211\316`4\0222\330F\363`\002\226\311:\030\246b\016\005\b\031\346\341p2L\302\355us\352\201\347\273<5e\033\252\205\244%\247B=\352\006)[\021\352\207\377\024\351V\252\020"
+	.ascii	"\3571\226\020\032\241\0162\fEe\225\271\325\321I\023\tD\001\215"
+	.ascii	"\313\t\341s\031U\252\361\023\313\302D\302UU\r\351]\005\n"
+	.text
+	.section	.gnu.lto_printRxFailsafe.245.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\242\007\335)"
+	.string	"\332Kx\020Dp\234\316p\033\2556\"\351>d(.\377\233!C"
+	.string	"Q\244\302\243\304\f\332B\217*\350\r\216v\335\230l|\016\2461\317bhT\230\246\326p;\313b#`"
+	.string	"4\251\312\332\255\376%%B\366\336{K\231d\365"
+	.string	"\332"
+	.string	"\366"
+	.ascii	"[\336\366\267\005\272mQ\350\242\201\301\354\313\022\262]\266"
+	.ascii	"-s\rK\2569\202\320\226n?:\200P\374\232\226\271\206\255=\267\214"
+	.ascii	"\213\362\004\206z,{\265\005\376\334\335,.\204^\311\025\3547\267"
+	.ascii	"LF\231\263\256\311\245\237\313B\375\311\300\335\3554\030v\246"
+	.ascii	"\254\\\371\361\304\311S)\276\312\226P\317\352\205\206\244I\375"
+	.ascii	"\271I\365\274\373(\227R\374Y\214\365\255\253\220/n\353\232lZ"
+	.ascii	"\004\352O\341\201\320\237\346\177\320\237[\334\265\023\232\261"
+	.string	"r=0[;^\231\263\256\353\260\213\254\317\315\3447\345\342\325\024=\315\346\342^\371\003bJ\256\253f'qc\343fp\204\231\023\336l\274\271Z\027\247Lx\034\335\361\363\007\266\343\246\251$&F\007\017\330\f\023\250\314X\335\337\3165\300\274\270\257v%d]\027\235\032\030\217sJa]\327\345/\260\034_\337w\227lw\343v\323\241}z1:\341o\030\364\315}c\223.\336[\244~\377\355Oq\220uhtJ=\031\274\327hh\320\005\351\rr\202^zR\357\236\240\342\177-h\240c\031^\036\236\261\271v\223\\\334Cv?$'l\3146\331\356\203\341\327\276Mg\3732\335\312\277t\267\257\322\253\374\f\026<\355O\360\263?\351Y\276HO\373\nS\336\243\037\257Q\312[\244\362\022\245\274\006~\274C)o\001\225W(\345%\360\343\rJy\201T\336\001)\357O\312\353\223\362\nPy{R\336"
+	.string	"?^\236\2247\250\362\002Hy\201)\357/\345\365\251\274j\312\233\372x\321\224\367Ty\315\224\267Q^Fy\017\301H\3315g\305lK\323%\327\033{vV\271\023N\311\327~\266\337\355\317rs\367p\327\262\017vA\003\032\250n@_\017)'\357L\006\231\373\364\317\335\307\\@\373\364\264\2005Gz\372]\220v\312\316\212\030\330\001\032\251\367i.\\\007\362n\316\272\032\377\225A5\036\212\202\237gk\340\300\377Zs\355\321\\\313\323\0016\352h:H\330\317\375\214\007sA\210@\377%\002\375\311\323Lj\340"
+	.string	"t\260_\006@\243>\220p\312\316N\273_\003;\035\033\2434\212\025\370zA}\375\353^\032\233\250\355\353\217\370\222\210\332\207\373\331\006\t'\357\354dq\302\334\230=d\371%P\263\233\212]\03545^Lg\203,\354\264\207m\002\b\332i\377\250\207\366\217]\232\372ltlyw\324\333%\361/%\324u\365\212\260\217+\0361\241\"\331\352 \033;<1)gK\357nj^\036\341z\370^\316\324J\275K\204\342\177u'8\232-\341^j\246\356%\227f\320J\001\033\334\250$!T\222P+IXEE\234z\201\325\003\005Dd!\253\212\250\305B*\b\225b\265"
+	.ascii	"q\302\212*\212(\205\342\367\241E\225\026qJ*\352(\353\004\325"
+	.ascii	"\224\325\225S\225\224\225\025\021\205\223\324\0241\253\212\212"
+	.ascii	"\370\364\002K(E\026\221\303\n\025ZQ\352B5\240\252\202\032ZQ\021"
+	.ascii	"U\f\241\260\262\206\r\200\366j\205\024\326\260\305\325\025\326"
+	.ascii	"\020\230\\\345\256\274\252|\223\313\303\223\321]rj\017\331 \030"
+	.ascii	"\324\207\304,\356\330\306[\343o\367=1[\036\333\320a_y\237\021"
+	.ascii	"\263\266c\033/ha\327`3hk\274\230\316\315u]\327\364w\201\"\365"
+	.ascii	"\203\276\332O0ib]\274\307\350\221\223Q\037u:\226Fi\341zw\214"
+	.ascii	"\210\272\250\016Q_O\354\212\201\274\342\224\353@\336\251\240"
+	.ascii	"\032\257E\301O\ra\315\265Cm\240\32312t\033\036\007\316\220P\027"
+	.ascii	"p#\324\347\362'\037\310\2752N\346`Kr\026\361O\023p\nj\002w!~"
+	.ascii	"\027\200\207\250QD\305\210R\304\320\210L\220$MZ\003\240\002\221"
+	.ascii	"\271\2629\0210)D\316\225\246%)V\003\210dg%\242\272\211\264i\342"
+	.ascii	"\bE|\302\035\t\357!R\377=P\\\"M\254.\373]%\035\f\035\222\037"
+	.ascii	"\021\233\003\002\307MB\0069i\006R\177\003\323\220\351\337y\355"
+	.ascii	"\021g\275\033\246N\365 \222\013E,\253\345[\030\326'\302\266\373"
+	.ascii	"\250\356\372\002\0309G\205\317\327\354u\312\301M\347-\327\033"
+	.ascii	"\222&\226\b0U\216\242\022\335\306\274\017\300\361\262\037\234"
+	.ascii	"\276\372\032_f\301\351\201\0331?\177\275\337\3044\346\002i]\241"
+	.ascii	"bC_\266%K8\367\275\371 \242L\345\362\375\274(\034,\\z^\212\345"
+	.ascii	"\250w~M\\\333!\\\231v\200\016\342\321\264o{\317\240\250\312\025"
+	.ascii	"\266AJkG3\351\213un\217qD\245\0349\210I\274)\f\2644\211\007\316"
+	.ascii	"\3064\271\234\023K9$\365\332\227\201\341\032\355\2265\260\241"
+	.ascii	"\016\204\007,\270\210\300\342:o\275d}P\240\207\234\276f\372\007"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.246.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`8\f\245C"
+	.string	"\032v<\032@@\244N\007S\177\264\024\341\337\021\320\re\257w\003\232\243\016!I`RM\323=\0131\342\320\241\324\222|"
+	.ascii	"\304\233,Cn\2773\372\274\235~\210\314X\306\30643\314\260=\212"
+	.ascii	"\215\354\275\223L)\226\001l\001\222\001\236\313\262G\367\304"
+	.ascii	"qQ\241\306\355^\277\233\001%6\227\311\222\322\364\334\301\035"
+	.ascii	"\2320:\013\265zR\213\206\006X\2238/\036\214\316\232\251\001\325"
+	.ascii	"\234\313A\210\250\207wp\022|L;\231>\326\3318\312\200\331\311"
+	.ascii	"\256\304E\201`t\366\235\352t}\354\005\r^\027\003v#P\234\221\301"
+	.ascii	"\234\347\022\030\035\314\353arx~f#\236\270#\2039K\251\234\355"
+	.ascii	"*\243\263M\357\270\333\341<\356u9\035\236\314\271I\231\273\234"
+	.ascii	"\347\254\332\200\321\331\236se\353\254\321\223Zg\373\355\026"
+	.ascii	"l\342\221\233\f\342\314\240t\2079\347\345?i$_\347\274W\374:\323"
+	.ascii	"\222R)\t)ydT\204t\217DC\306b\313\256\337\204\337v\262\2463-\321"
+	.ascii	"Qq\245RR\321\002\223\262)\216\004(\215\262B\351A\301\311\001"
+	.ascii	"L\312\330\374\250\220\321\n!M\266s@\351\332Z|\253\272\371\233"
+	.ascii	"\024\r\0271)[sd\235\270<.\2404I\037\022|\234\276I\217`\242\242"
+	.ascii	"\205+qn\3740)k\363\241u\201\03125\016(5\262\"\261\b\276\371\233"
+	.ascii	"\364\f\033\3276\r\357\211\003J\317\326\b}m|\276g\206\213k\322"
+	.ascii	"\031\032;\016(e[\253\354X1\342zP\334\256\312 mQ\007\224JY\247"
+	.ascii	"\006\361\n\235\314\023\263\353\267\001\362\341\200\322)\253\004"
+	.ascii	"<\037\201\234\316\361\030\231\023\257DnC\374\215C\274\251\210"
+	.ascii	"\214\307\n\225sv:\037\360&\335\202q\321B\316\271q\224\254\314"
+	.ascii	"\333\311\273}\256\273\353\272\211\324\002t\002\357<\2578q\225"
+	.ascii	"}\265FF_\302\263\201M=\206\333|\3159\347\365\325\034\254uz\t"
+	.ascii	"\377\344\314S}N\235\270\332L\370\277\373%\201=\332PJL\344\315"
+	.ascii	"\246\3651N5a\214\342\357>\221\002{\364\037\352\371\315vz\374"
+	.ascii	"\305\264\300:hb\030\256~\0028AS\376\325\332\375\311\320\354\257"
+	.ascii	"\351\2334\215\326\237\0055P\f\017\352$&\360\335+\260\260G\375"
+	.ascii	"\235\316\335G\235\336\235\240A\261ov\3179\361\253u{\003A\267"
+	.ascii	"\271\376&\335\022\334\214\367\003\027\267\202\345\225\337y[9"
+	.ascii	"\237w\225\267\361\246\232B\340\342>\340y\336RQ^\347m\300\305"
+	.ascii	"]\300\345\334\t8\032\357'\027\343\355\344\342nrq3\271\270\227"
+	.ascii	"\\\334J\027\267\022\022w\222\213\033\t\211;\211\304}\204\304"
+	.ascii	"m\344\342.rq#]\334\256\213\373X\204\233\310\305=\304\3426\"q"
+	.ascii	"\027[\334\255\213\233uq\257\216\373]\334\270\305\355\024\004"
+	.ascii	"\3649\351\210\211;\373;s9H\225P\376c\363\2508\237{\033w3\356"
+	.ascii	"h\334\357\334\363\334\353\334\303\270\213\361\241no\357\3638"
+	.ascii	"\335\307\336r\277\3361-\334\222s\356\343V\367\321M\373\033\276"
+	.ascii	"\0278\244\304\225\311Z\323\276\327\306\306\232\315\346r\231Q"
+	.ascii	"\232\236C\270C,._\323\255t\272w\354\3662\355g<\215\343\271^\037"
+	.ascii	"\363\272\002l\341\264\320yg\314\224\025"
+	.string	"T\360\007\276\361\2630if}\005\357q|\355\022\305\r\336\336\230@\316\252\373\353\322\375u\020qoE\322\345\f\362\311 \342\341\350\231\230\213\305\334\352\275\317\245\232\205\325\326\211\236\335q9\265||\210\350\345\352\215\250|\344@\363\206r\333\032\321\253\341\3567\311\213\206=\332\030\017\"\332\237\363\233\177G%\315\320\253\365\373\214\326*\nL\241\027j\0361<H\0137\337%\017\252\340\374\2461X\313Y\fB\242W_\265'/\033[\353\254\325\007`\313\253\372\343\003\240\356\331#\372\252_\375\b\275nFD\252'z\177\343)\322\366\330=\263\034\337\244\204\306W\003\344T\317\202)L\233\302C\357n\\\320\353V\265\226\363\323\243\355\206~\370NY_*\321\327\255}\255\274X\260G\251\036\212\3077\333\370C\277z\240\027\312\253E\212\361}\317\215\200T=\3251#a\356\235\037a\321F;\365l\223\020\221\032X"
+	.ascii	"\033\360\362\306a\217N=v3\b\361\017;X[|\004?b\352G\275S\227\347"
+	.ascii	"\304\325/>\b\346I2B<S\007\316\246\373\335\342}.\264Ns\b\251y"
+	.ascii	"\340r\316\020\370\270 \206v)\316v\206\rl{\207\326\331\342\267"
+	.ascii	"eS?.r\355K=\353\367\355\273\236\033\005\251z\354\240p^e\277\300"
+	.ascii	"7\206\232!\361\260{\322\276Z\322\301\332\250\1770\204Z\250~\354"
+	.ascii	"G=N\323O D`\217\262\257\300\t\274\201w2\356!\375!C\210\020\027"
+	.ascii	"8`06\262[DAeEA\325\210\202\202\261\205\345\342\206\327Qk]\321"
+	.ascii	"\320\372\302\342Z\306\350\342\342\352\312zj\255\253\033^\313"
+	.ascii	"\033^I\314\026] Z0\277h0\2212\234)\003\354k]\2315``\225`zm\325"
+	.ascii	"\230\301\364r\275\230_YX^XZ\030\230-\272\270\220^_2\036\0063"
+	.ascii	"F\f,\255\254\242\213\032,\236\031c\013F\013\256\254bg]m\301\310"
+	.ascii	"Z\306\330\302\342Zfy\321X^)\273K\006\323k\371\325\325\345\265"
+	.ascii	"<\316\205\271\205\260w>\023\212\351\036.m\230\230\260\245\034"
+	.ascii	"k\316L*\320yr0\f\256\372R\017\0379e\005\234\244r/\203\331^\247"
+	.ascii	"\024\017\343\323\277@\337\036\230\214'\361$\302\371{~\323\350"
+	.ascii	"\247\f\027\245&'\357\330\017\343\323\335\236MUhb\022\004\274"
+	.ascii	"\364L_\340}\rN{\311\004\340y\205\030\237\256D\212\310[\004\372"
+	.ascii	"\315~\360L8\352\312_z\2424Av\317)\366\341J\257\374/\364|Kz%%"
+	.ascii	"`\3109\204\006\321\246Il\037\232\032.rm\223.\017i\317\035\r\n"
+	.ascii	"G\356\350\352\225\352\366\344Z\004\377\364c\177\376\364l\223"
+	.ascii	"\020\035j \n\214\344\3252\301\r\361\221\007\257d\313\013{\244"
+	.ascii	"wh\342\031\230+\233\204\326\314\212$5\334\241\321\271\3161\265"
+	.ascii	"\344\321\027L\004lh\216!\241!B\254\376\350\231\322\372T\241\211"
+	.ascii	"a\255\2323@G\202\244\020\335\214\244\334\f\373\360\275\341+2"
+	.ascii	":\303R\260\343\022C\034\004\003\361\350\237\2427\372\247\264"
+	.ascii	">{\320D'\344\027}\023\233g\027\034e\007\036"
+	.string	"\031\200\355\250q(\305\230S\250dDD\244)H\322\030\200\002\021\2422n\003\021\220\275C6\222$\205\f\007!\243\324\275\327&T\354\344\371\253~\366\370\310\226\350\336\265\345+\025\217\022\306*Y\b\0312\200\374.\325\351\030\214rc\365)%\027\023E\223e\320\265h\354\005\2049\264\224!`\036K\177\270\216;\211\344\337a\244\342(\327\276\026\023\372\221\237[y\017\375\003\235<!\230\002Pd\243&k\022[:6\371:+`j\177\376*O\330\307\200\035xH\331N\356wM\324\216>Y(\221<?%\030?\264\237\300\r\030\375\226\214Op\024\034\254=:4q\252;\226?<\233\r\365\034a\352\272v\361\024\002\032\245\356\374H\376\207\366K\261\003Fx\233\207p\276q\344\314\360SQ\3258$ym<\2666\373\0263}\3110\032\"'=\260\302\335\r\327\345\222\256a\234\207\234\247\350\237\204\226\024U"
+	.ascii	"\215y\212\365e\005B\265\205si!\306\207\325gBQ\226Mw\t\3419\207"
+	.ascii	"\223\217\252\034)\"\313g'{\263\353\277\303uy\330\0263w\215\342"
+	.ascii	"Svl'"
+	.ascii	"S3\271\375z\013VGS\243\200\303\210\221\331\256\0068\031\364%"
+	.ascii	"\220\306!\255]4\365J\n\370>\360\250\277\350tma\370\264\375 \n"
+	.ascii	"\001\367W\324<\365(h;3N\216\343;M\".\221[\222$\017c\2510#l\222"
+	.ascii	"q\332\371\346\345\2210\340\364\036\305 \2341iyNK}L\227\357\265"
+	.ascii	"\315\233\250'H\232\310\034\244\331g\224gm\236\373\227\2140\016"
+	.ascii	"\004\212\254\200\260\300\207^y\016\006\325\302\270\346\3348'"
+	.ascii	"\346\226\32247\200\244\013\t\251\272\270\275\221.\352F\021\235"
+	.ascii	"\355|\230\005E3\326#\277\354=\356\325\357\215\264!\2467\032\377"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_printAux.247.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013\2558"
+	.ascii	"\372e<\026BP\244N\007\257\354_@\303B\246\223i\202\362\373\233"
+	.ascii	"D\230\262\220\240\242\320\375\211\356\241\003\007! \314\241\215"
+	.ascii	"\374\231\005l\277\025\242\006\b\2404|\216vK\315\251\006\267+"
+	.ascii	"\302O#\332$\244\355\235RJ\001X\001.\001U\001E6<\210Z\275\266"
+	.ascii	"\315\376\242d\374\314\314T9\306\005\222\341.\323u}\246\323p\021"
+	.ascii	"\r\217\243\270@\251\220\007\022\222m\347\265\024&m\207\f\233"
+	.ascii	"\004\212\351\326\f\330\006%\020\021Q=Uz0\323\201\251\355\231"
+	.ascii	"\2645+\306\r\336\361\272-\206{\216\213\2752\363\230\034KKi\373"
+	.ascii	"d\367\006\375\271\375\265\2554\252W\266q{\355\"3?\230\035{`|"
+	.ascii	"\221;\003\341\322\206K\266\027\036ID\3552\016M\352\366\312\322"
+	.ascii	"\333\316\334n\335%\331o>\230\330\266jsvm+\225b\247\333\353R\033"
+	.ascii	"\t{U"
+	.string	"\273H\330+'\231\373\222\306\332\260\b\321-M\271\277\266m\251\036\n\013hU\332|\364d\017\035\215BE\226x\207\302U}Or\207\351\246(rJ\276\271gX\017\251?\366\247\244\365\312\240*\006AM:=\247\364\343\023\263\26462\251\231\241\265\220\222.*a+K\342,Z\232fb+C\342\304\"}[\315\354\254\207\255Wv\326xM\027\266\330\221^\325\242#tv\216\3171\325\201\035+H\212O\246\253\252\201\2758X\032\257\231\364\312\216\250MJ\230\220\3514\355d\317\245\177\317\365\332d\320\237\033\240\232YZ\373pC\333\266\354\316\247Y3Q37\0243gaf\217\002<\204\026\276\300\220>p~\366\360,]\020\373S\370\n\277\3361\257(}\352F\330\357\337L6\245O9\352\373;M\203`\203\322Q\362\205\031\024\363\351\363\331\2751y>z\204\217j\b\317\234\025\303\3339\341\215\232\201\362"
+	.string	"\375\230\037\306,\r\363_c\356$*pq\370\2350\223\270\316\"\232\2569D\233i\376p\2359\264\232\346\252\276k\326\220\241\3314_\350/\335\026\032Ms\205\366\322MaB\203\351\216\320o\335\020\256\363\324u\226j\273f\007=\2469\252A\203ifp\235\241\256\363\023\353\274\340:+`\235\235\256s\202\353\334t\235\231X\347\245\353\214\340:\037\270\316\006X\347\002Eg\002\254\363"
+	.string	"\242\263\022\3219\351:#\261\316G\327\331\210u\026p\235\213\256s\200\353\f\200u&\272\316C\327\371x\235\215\254\263P\321\271\310:\263Dg\"\321\371^\347\241\320Yx\235W\241\263:t\366\241s[A\311)\367\276D\271<\237\264\0352\rl\363V4TZM\367]7\233n\272n3\335v\335h\272\307\364eV\303}\327k\032\217\003\275\006\n(\351\303\357"
+	.string	"\024\322\"iu\203\002j{#\376\032\2730\252\333I\264M\263n\310\341\245\236\214\371\311\245\276\370C_\364F\217\364Q\317\035(ie\310D\320/\315\255m\231\355Lb\271\314F{\352u\370I-\3116o'\253-\332\207\361\321#\375\251\223lK\034}\r\350\036\001o\304\245\373X\t\370\037\320\276\2667\261=\035\340\213ZO\003\370"
+	.string	"D\017\240K\373\361!\352\003|\033.\217?\304LSj\276\023\032\377\370/\310d\023z\343w2\332y\254$D\341\252\306\323\241W\251;B\337j\240|\332\336>\364\235\020\305\377\001\345\003\250^\3669<\333D\260\2569\310<\242\355X\325\371\021X\202\375\256\002\375\323<\235\003EmH\247\253~}\016\362\305u\026\270\276?\341\257\255`B\r\277\206\r\356\305!9\261\352;\211\211\326#~\007B\371"
+	.string	"\221\374>\363\211\024\336N\r\337\317%KV\321rX\334\266]N\340~\223t\266\270Sz\275\337}\240|moGo\360\353g\370\267\233&\311\023\376P\370\275\247\211D\375\365\273\t\300/|\205gv\201\364v\252\377~\323#yc\037\306\376\026\376\3027^\253\210\013\224\303\274\242\364e\234 g\352\257q\007\f\246`I\007\030R\351\n\271\305^!\267\336\203\027\r$\230\215,\243\216\256\027\337\205\002+k\006\227\026\215\253\3257\276N\304\340\322\302Bf\311`K|\321"
+	.ascii	"C\302\310\302B\340\245\205\305\325\325\201\253K\353\013\211C"
+	.ascii	"\353\353\252*\013\253k+i\206\027\262D\215-0\254\313WSZ4\256\250"
+	.ascii	"\270\264\220[TW7\274\250\246\214\270\253F\326\r\252\257\256\256"
+	.ascii	"\033TEi\333\357$L\337\271\347\022@?\261W\346\r\375\032\023\267"
+	.ascii	"\030\211S\242\321f\2353\031\253F\006\337a\232\030%\372\326\254"
+	.ascii	"\363\t\337\340\311\272O\253m\333\266\307\034\302\250'\361=\327"
+	.ascii	"\253\021\250\2348>0iJ\237\272\221\215\352\257(\237f]Q\304OM="
+	.ascii	"\201G\360\t^\301?AQq\360P\337\315\301\005\377\344A~\374Y\360"
+	.ascii	"+\240\201N\257\300\235VN\277\002*\330\326\364\t\230\276i\351"
+	.ascii	"\231\2728\220\346\222 \340\201G`\340\017\374\303)\360\006|\314"
+	.ascii	"\352\351\216/\235\242\024\370N\203\016\272\230\020\002\277\002"
+	.ascii	":(4\340E\374\260\311\340\324[\277\001\337g\320i\367\3759\233"
+	.ascii	"\305\020\t\316L\243~'E\016\t\373k\334xM\324\023\245k\326\255"
+	.ascii	"\302\373':\246Y\367\334^B\007O\326x\335hM\3008k\206g\365\033"
+	.ascii	"<\203'\373\360\0177\345\242\024\342\233H\240\020\245\017\200"
+	.ascii	"\300\250Q,(\021\202\204Dd$\210\302"
+	.string	"\202&\351\240\002\221\261*\325\001\021\360\254T\020\322HR\2224\006~\2720\244\206~\3518\225\240!\375\017\301\004\334\363\235\006\200V\346\250z\305\231\034'\006\200\334\2338A\242R\226v\314A0\r\n\205\345V]X+N{\013\021\255\367LX\242\321<\203\330D\030(\370\340\351\364qX\234\256'\361\304\001\245 \215\r\304%\031\214\023\231\251\200\033\035\201<\303\2402\304\255\225\230\024\325\264\332'\024\235A\004.a'0\333\360\036\013\n\004\262\032V\302\235%\333\004i\213\232\346v\017\246\223\371V\266\005\r'\261pz\224\375\020*\236\251r\261\247\235#\242#\023\2525\257\274\006\365\001\200\262\363\345\367\020X\354@\305^\350 \304\370D`R\024\224M[\224\276\334{\244g\330T=\f\b0e\261Y\n\346O\343`\373\242\374\237\336rA\272\223g\316\f\366S\n\t\364\213L\314\315\b\265\0137\324&D"
+	.ascii	"@Y\264N\313\336\017\212\342m\331,?\325\361\262\331g\332#g?\n"
+	.ascii	"_5\354+\267>\335\241D\026w\223\201\3361\001\036\017\0170\355"
+	.ascii	"\264<.1\361\261^\b\214\316\004\344\030\240\243\030\332\336\233"
+	.ascii	"@\210\323'\264\203\360\335.\006\300ji\020C\200M:L<\027\206D\260"
+	.ascii	"\324\276\203j\330\223\"\333=G`ST\270\247\371(\203\210K#]4\345"
+	.ascii	"\037ft*"
+	.text
+	.section	.gnu.lto_cliAux.248.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\r\001\225\r"
+	.string	"\306\031^E"
+	.string	"\223\223\016X\332\023\210\366\022\377\023h?\027\202\n\200\207\240\376\245\262\227\354 >K\215\244t<\f\273[\013\023\242\003\330IP\004\217\022(h\272\2078Y\002\245\025BQ \3246\013\350]G\333\266\367\336;\245I"
+	.string	"G"
+	.string	"L"
+	.string	"\235\013\250\247\036\331>\b\250,i\001M\210\025\032Bv\327\222)>:\2352\216\374\303\334\323}\244\323N\313\247\310\327r9\017\254h\202\004\370N\023\344\255\350\016\363\b\3423\305\310i\260\273\216\335\307r\327\333\206`\333\201}Q$\0334Ey\302\276\f\3030\264D\331\177\371\251\214>\347(\\x\"X\376\341\307\256\027\016\331\032\252C\345\016\007\255 \225\003\306\356~\376\261\375h\337\3452F\177\361\360\221]T\214\231]0\201\rtN\r\036TO\003\227\004\222\332-\275{\214\215\34070\217\312c\301\303ew\031\324\270\215\n\276\212Sg'\324?\251\247\277V\355\rC|\347\313\230xQ\263\362\324\315jF\232C\275\2340\243\307)\336\270F*m\r\033\342\273K"
+	.string	"8H\214\260Y\235d\266\020J\301L6\215\344\342\254\213B\001\f%\023\231h\027\307W(\023]\026JV\242Y\027\227b\205@\336.`\234\225a\3338\353\003\226>W\242\374\240E\t\233UI\232\346\356.\035\020AB|\347\031w\250x\2529\022}\222\352\227\324\307\\&\026"
+	.ascii	"AYz\027C&\336\034\215\206\013\t\016\nm\"c\204\201,YC\027\233"
+	.ascii	"\245%xa\340\020\353\212~a\275\272`\271\323T\263je\234\344\235"
+	.ascii	"W65\271\306\245\240"
+	.text
+	.section	.gnu.lto_printSerial.249.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\236\nm1"
+	.string	"\372U\360\022BP\344\316\030\003\374~x \363\006j\263\0071\300K\3104`\037\034\t \237}O\233\373)\237R\333"
+	.string	"\365KQ>\236\013\363\001\216\222#:\262\331o\305\251\243\006\222U\032(z\023\221[J\231RJ\001\031\001\002\001(\001\254sOpz\243\004\264\233\006yA\351{v\230\347E\263\372-\351\275\356<\346\326\302\315\307F\206@\225\354=1\2441\351{F\214B\321\034\333\316\302\255\307\306^\2319/\006\322R\372>\213k\240\322\271;\357+\205\352\225\261\332^\333\310\314\177'\003\013\364\203\335\030+\227v\225d[\231Q\024\340]^\301\321\240\355\225\245m;s\3175]\262\353h\260\373\276m|\\\336W\332\200\225\332^\221z\210\355U\355 \266WN2\303)\"{\307\246\246jL,w\336\367\225z#\334\266*mv=\331E\267%\262\253\372\236\344\306\353$\2707JA\275\347X\027U\242Y\216\300N\223\003\252V\025\306\201\266^\273\363\251t\267\b\332\217n\211=\232U\217"
+	.ascii	"\315@\001z2\325$\265!Z\214\3172_\303\246G\n\333\320|\264\252"
+	.ascii	">\021v\251c|\222\251CgJ\232\315\327n\366"
+	.string	"\\\372\267^\257Q\250t\316\260\r\355G;\261\302\373\276\354\315'Z\263\261\2319\217\231\313\230\213\027\002x\253\272\366~[w\232\217\247S\375(\267\030\353\377u\205\315\322\3610\221\3673\207\020\341\335\364\277b[\362\210\236b\265\335\333[\373\035'\f\276\357\262\252Dw9\321\276\3572\002\227\344\016\344\324[\334\f\266\327\376\346k\265I\r>\2675\272\272\032~\370xf\206]\236\201\034\302C\365\203g\336J\341\335\234\372\241\346\023BC\302\262\037c\226\216\371G\231\273\252\260\214\t\277\033\363\225UU\333uKh+\335TS}\327\r\241\353\272\037\364^sT\3475C=9\365]3\203\326\271\211ufj\235\227\214\316JE\347\005\255s\222\353\254\240\350\214\324:'p\235\021\024\235\217Z\347\003\256\263\201\242\263Q\353\\\300u.b\235\211Zg\002F\347\241\242\263P\353\034\344:\017(:\013h\235\003\270\316"
+	.string	"\212\316@\255\363\217\353\354St6\266\316E\327\331m\235\333\325\231\330:\263\255\363JtV\211\316\277:{\356<N\275ysi\360}\337\242\377q\262en\215\216\370\344\306\007z\001/\364\004\236\350\331m$\223\020\333\366\356\254\315\275oY7\223K\3322\256\246^\331O6I>\361n\362\321\0168j\257\232\223a-]ITf\350\t<1\n\004\017\212\217%\243D\360\3678u\3104\364-\006\356O\216D\353\311#4\340\203\344\032\217\341\235\001\177\206&\272\016\035\001"
+	.ascii	">\300\224\236#\247\020\200\234V\307\201\003\344\363?I\272v\323"
+	.ascii	"\206\215\217\031\303\025=\230\244\322r\007\266\240\005\225/d"
+	.ascii	"`\273\231\201\355\325\370Gp~\356\027\277\231{xC\253\341@\001"
+	.ascii	"\360x\225F\312\375\316\003wF\256\016\310\237\276}\253\027c#~"
+	.ascii	"\373M\374fz\251z\366\211Q\350!s\017T\257_\365\377\307\364S\372"
+	.ascii	"!\033\271O3\031\366_}f\017 \274\233\353\323`+\353?\030L\203e"
+	.ascii	"\216\024\310P\251\257\276i\246\365\030\030}\367\366\276\313n"
+	.ascii	"\2129v`\230\034\310.\363\237E\006\265\323Lk\"d\200w\354G\373"
+	.ascii	"Z\302\013\265\031R\b\350L\352\f\006\334\245\265\204t\004\326"
+	.ascii	"\205\024\203\261\365\303\325_a!R\270\340\322Bn\251(\206u\211"
+	.ascii	"!Qla\bJ\301\205\302\205\327\205.$\327\327\026\230\017\0130\244"
+	.ascii	"\207\027-\304\264Z\316r\300\325\225%\345\202\013\331B*\353\013"
+	.ascii	"L\312\301\020{\275\330\372\222\n\363\362\372\2222J\337~7\274"
+	.ascii	"n\365\246\260\031\022\326xe\361\243\354\036i\257\342\246o\314"
+	.ascii	">g'\253\255\3237^\273oS!\314>\237\372\247w\266^\273r\324\367"
+	.ascii	"}_\227\310\340YU\237\336\351\235\314\3351X\250\277\372\035p^"
+	.ascii	"\224\202wkJ?\364i\373Qn7S%\314>\266\352\303\246q\314\276\265"
+	.ascii	"\277t\324;\247K\230x\254\325\263\272>=\203w\032\375\321#\375"
+	.ascii	"\202_z\246&8\365U\3731\216\372\2468,$G\230\344\224~\351\331\250"
+	.ascii	"Z\337[2J\224\221cS\221\003\203J\337N\340\326$\245\270\033\221"
+	.ascii	"\005\n>I\316\207\260\tQ W\301\203\250!!\370\004S\034\372\303"
+	.ascii	"\007\202@C\r\236\346<\216\236\310\300\037p\035hO\003\337`\340"
+	.string	"\004;\370\231\233\031=Q\321\027\360\033\034\250\006\003\200\302\250Q@&\rb\204FFDJ\323\2445\300\002\221!\242q\003\021 \255#\f\315M5d7w\3116\362\276\262\313J\202\310\177\367\030\n\222~\351]M\003\322#s\2568D\372d{\031\253y\256-^,u3\345o\315\226\374\232_\232\360Y\017\344\256\025Z9\233\320\312\230\341\037<X\\\216t\302L\302?\245o\247\327\27578\374\235\240-\261\366(7\250\245\214a\257\242\223M\336<\006\\F\246\264\2145\233>\367\250\334?(Y)\271!\217\326\031\032b=zd^\213\3570\222R\021b\340\336\253P\310\336\272\364Q\307\035\227\223\204\377\351m,$\3000#,\3423\204P\301\351 e \n\362b<\004\316$k\234k\2364\302\024\224\354\355\301\fD7\202\202\036\272\303\261;\027\307|\272D\334VC\363M\200[\361\255\326\201:L\373"
+	.ascii	"\334o\354[\370\n*[~\370\342\242@1\225|\311\243r\377\303\206\005"
+	.ascii	"\344\355W\304\272F\222\213{\371\226%\213\233\2111a\320\341\205"
+	.ascii	"\324\273\351c\235c \347_2udm\033\b6P\234\035S%\205\3473\276f"
+	.ascii	"\250\032\302\016\364\312\271!\007%\361|\230.6\031\211\323\344"
+	.ascii	"D\345\025\223L\2403\223\033?\337\300\270\032^\372\027\200<\215"
+	.ascii	"\035\370\2460Dxy#F\240\237,\005;\226\032"
+	.text
+	.section	.gnu.lto_cliSerial.250.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\205\r\375D"
+	.ascii	":v@\032>0\242N\007\313\001<\"h\247\220\314\235G\006\260\262b"
+	.ascii	"{\024u\351\213\326\334\037\021\na9\323\311\260j\361\350\231\304"
+	.ascii	"\210q\316Y\343\271I\304\262\030\213=\263MDp\304Dh\223\235RJ\001"
+	.ascii	"\233\001y\001\223\001\206+ht!?\335\031%T\276{\257\323\033\260"
+	.ascii	"\3054\231\016lBv\n\266\031i\017\236\365\245\273\315kb\236\307"
+	.ascii	"{\345H\\\237\275\324\226\261!'qO\206\005\r\244=\006\255\257\333"
+	.ascii	"\275\001(\021\222A\230\034H\027\316\3559\274DB\217\367\376%`"
+	.ascii	"\376\365\027i\203\341\305*\266\277;\327V\355\256|W\255d,f+\253"
+	.ascii	"\330v\346\346\353>i\373\351\350\244{\361\372\f\357\375C\300\002"
+	.ascii	"\230\255\344\277\206\266\255d\366R\333J\2262\357qj\273i\f\022"
+	.ascii	"\033\337\304@\336{\265>\217\331f\377\232\241\\\332Q\252)\251"
+	.ascii	"(\250'\247&&(\200%\245$\244#\243\242\247\223\250\311\\\266J\366"
+	.ascii	"]\312M4\227\326Q\252;:/=\365\265\310\247\217T\303\221\353\343"
+	.ascii	"\363(\366\tG\256\013\273uX\347PM\350\270\364\223\223cS#\223\224"
+	.ascii	"=\207\252\001P\270\004E\317\225\314$\225AzRE\316\211\037\231"
+	.ascii	"-\366\365\271\243\323\322FK.\274E.}\356\350\266t\021{\340\361"
+	.ascii	"PP\303\221\243\262\320\270\275i+&\361\247\325\256E\272\367\366"
+	.ascii	"\235\034\222\026I.\n\353<B\304NP\034\022\327\212m\005G\316\b"
+	.ascii	"\353zw\372\364a[U\221"
+	.string	"\353\342M\347\322L\253;\272\"\275l8rE\336\274\035\322Jv\251n\220\216\321\234\033\213E\307\212\021\347\\\233\263m\225Z\206/\362\216\316\257\237=@m\fb4\307\306B\3370\321\323\204\355psk\356K\256{/\373t\216\256\271\252\231\275\0033W\231\235<\002j\212V\bx\026\026i\026\357\351\326\267\032+\221+[\273\245\t\245]\240v\356\275\016v<\231\214,\242\346\223\215xV$J\033\255\202\177\2653\205\254\\\353\231\245^,xO\025\274\337\311+t\245\302\220\301{\252\365U\n\032\353\263~9\307\256\216\333\2255\237\344(\1776\263i\257\272\013\233\320\206\221\223)3\007\017.\330\367\027\371\350\326kx\256\217\254\223s\347h\271C\264}\246\033M8\024\261\020\320\016\337\275jk\232\315\bn(&\224\334&\332Vv\237h\231Q\250\360\236r\007\346\035^\337\0300\320\333\222\377*\317h\373Y"
+	.string	"\342asB\214\344X\317\334\345\345=\355o\302\336\320\345\021\362\221\355\323\230\377\326\374\253\314\335d\034\355\314\361\3431sU\350\304f\t\020\0368`\260\325e\232\0254\230f\255\254\366\353\306\"r>\020\300\252*J\325a\232\247\244\212\234\243\234\316PL\347\247\246\263\223\323\271\351\351\314\324t\206:\235\001<\235\227\232\316JN\347\244\2473R\323\371\310\351l\364t.z:;\237\316DO\347f\217if6\235\227N\347\226\310Y\331tf\333\260\371\231\316\276t\356\fWc"
+	.string	"\343\204Il\363u\376n\334\244\241{U\"J\351\304n\303n0\335a\272\307t\227\351\036\354%s37\"\267\";\023\321\360\026\255,\272\220\373\220\235\206K1O\002\321\257\360Fs\366\030\335\250V\\W\316\242\224\307\373w\rtK\262aK\342T\347g\345\323\304T\324h\255S\322\371MmQ\034\ta\201\0361\264\352\001\260\364UV*\325\320d\031\324\035\250W\247\224dN\022\022\333h-\221\241\226\360D\223\201\272\003\255\207\216$\3305!Z\323\025\253\233-\025\320\274y3\372*\365\376]G\367\306\264)\372*;\033\255m~\337\001\272asBh\255\204o>\323\034\2753n\324\265?\335\326\307k\232\037b\307\266<9\317B\234\265\006\222;\322\233\027\333V\016\nb\004~S\256\222k"
+	.string	"\0203\357a\336\233\326\324n%wQ\313\224{\257\201VZ}\007Z\035\257m.\351\206\204\330\3119\277\312\313g\277\254\254\375H\2270\357e\203\300\375\330}\244LXiU\232\327J\363\332V.\277\211x\340[\016b\254\216=\3310Z\345\037x\366\267\"\312\227\360N\370&y\345\254\2364\212\367T\371U\020\236}\245\252\225\361\001\204\303)\341\037H\242\257\362\203\1770\212\177"
+	.ascii	"\357T=\370V\354\244Hk\226\257\033\244C\245\371U\366\303\356\270"
+	.ascii	"i\342\336\362\252\377\341\274\335j\037\202\207~\313\255\237z"
+	.ascii	"8f[\251\367\245\203\017\360p\334\314\257\332i\251w\360Fs\234"
+	.ascii	"L\272Q]J\023J\251\364\324\017\203\367W\252:\031\364&I\345[\f"
+	.ascii	"\276#\255G\256l\237\266\374*O\t\036\376Pv\243\265F\202^~\260"
+	.ascii	"\334h\255\324\303\271\351\255\377,\3665\240j\212_d\211u\205\225"
+	.ascii	"\201\321\320\"\013k\272\001\3665\246\001\314\254K\304\327Y\027"
+	.ascii	"\213\242\260.#\223A\344\"\254\305XY\331\231W\221\331\330\031"
+	.ascii	"\331\005\2631\260\030g.\312,|\205\211u\325P*3\223\361b]5"
+	.string	"\036l,L\354+\206\327\222\275\262\302\304\274\264\306\302\272bhy\225\321\320\312\2022\231\f\2602-32\2622-\347\237\032\220\346R\373\265\006\022}\2723x\324\276~t\303\227\206\352\214\275\367\256B\017v?\202\361I\246\340G\257\364\320wz\250\217zv%\322\266\345]!\244[O\245oL\267\346Q\240\225W\315\322\036R8\3108\352E\362i\034\365\312*\214\200\250}~O\017\365DV\311\265:d$\237\276\204ur\013\b7R\347\304\364MvL\217\303:\031Y\302\207\b\201.=\200$K[R8\335\234\022\322'\035Az\034za\"Y\370\017\367q\364\320'\210Eo\364\375&\311,\372%b\243\023j\237\237\232Or\004\3577S=U\020'\235\363\236\262\001\275@W7\3064\275.S\016\234Y*DJ\304\t;)P\257\315u\355\323\260\356`\311\"\005\025}&jF\237\371p\236\326\314"
+	.string	"j\214Y"
+	.string	"\333\2609!?Q_e\273i\342\336\023\327\277\325\303\305\t&\372==xfN}\325\303\361\023\3253\313\f\360\321\207\263\032\340G1Ow\263\367\336\013\265\024}f\212>\263E\321N\"\330f\317\251\3023\213\024}\252\207c\306j\253\347\372>\354\017b\2360\372S\201\021\250QH\342\024S\204FDDD\222&i\f\201\005\004)\006\341\325\003\021P1S\322\324\244)\fsw\313\236\256\023\314%\367\261\337\031(\376\367\276\360\340\270\201\024\210\203*\fG\2713\253\2404\207\0260\245\370S\225W\320\324Rn\307\231\001\026\314#\024\nd\201\347"
+	.ascii	",\304=\377\264\313u\351\366?\322\355V8a\277G]:\321\354\351@:"
+	.ascii	"\215.\304?4:\034Q\357\030\367\002\226\361\223-7\233\362\\D\t"
+	.ascii	"\360\315\321\201\244\213\020qM\201\361\205\253wP\323\353\376"
+	.ascii	"\260\004ua\200\221\347\275\367Qq\007\364{t\036\031\001\232',"
+	.ascii	"\265}a\216\013\276_\022\235,@\306j\bo\350O\243\002\031\317V\250"
+	.ascii	"X\265\202\357f\341\205\217\342\273j1N\377\364\246\314\271\310"
+	.ascii	"\276\032!\240\233\025\361\310\332\031\274\025\250x\304A@\037"
+	.ascii	"L\217\250\342G~\330\264\t3B\325\261\215\335r\026\256\251\320"
+	.ascii	"\n\245|\312\314A5\234\017\"\250jO$\217\363\315-\003L\306\"\b"
+	.ascii	"{\001\312\247\357\224\264\017\244\t\353f__\364/>P56\313|A\326"
+	.ascii	"\033i\227\357\250"
+	.string	""
+	.ascii	"\t-\221q\247yY_\225\304\252n\260[\324l^\020\345\270\020#\275"
+	.ascii	"\204\237\367\230l\036\222\310(\026\004\374_\270\226\233@\316"
+	.ascii	"~+/!\223H\252\024\335]81\343\266\241\376\211\037\220\271\004"
+	.ascii	"w\352\350\363\3330\212\247\021\246\027\327DW\256\021$\2076%I"
+	.ascii	"\337]\262\360\245\243\tAV\233\005\247\3470\206\334${,wX\262y"
+	.ascii	"\002\355\236\322\316\237\025!Z\351\234`\375\230\350\371U\312"
+	.ascii	"\300\305\370c\335\f\200\210\245\266\333D^\374\033\030\315;L}"
+	.ascii	"\241\020:-\030\t%\326M\234\244a\266J0N\373\305;\374\305\216\326"
+	.ascii	"t\342Y\260O\266j8\345WM1H\177\212\246\3164]B\t\201I8bkc\351Z"
+	.ascii	"fP\364\355\316\235N!h\212*\375f!\217\322o\232m5"
+	.text
+	.section	.gnu.lto_cbCtrlLine.251.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\266\0015\020"
+	.string	"F\036jE\020\217(\035#\341f\345\013\270\214\202\220\211\234\221\200\007%\374\366[\021zos\337\355Y7\267\274\337x\364\177\352m\334\250\274\320\357^\021\240\""
+	.string	"\244P\244d\3000\336\243\220\360\330\013\332\377i\204\220M\244L)T"
+	.string	"S"
+	.string	"T"
+	.string	">\340=\232v\020\367\350\235"
+	.string	"\367h\320vQ`\265(\006/,,\225\030\273\373)\207\203\347\342\246\t\372\257}\323\nQ\347L\036I8\341*7"
+	.string	"!\206\353\206@\246\004\214O8\262\201J<\264^{^\bU\231\235\203\335u\266B\327\335\335\366\310v\003;\275?\247i\325tn\351\007"
+	.ascii	"\315\264\270.{\331-\251\221\2611\321D\354+\277\375\327\314\361"
+	.ascii	"E\\\005\374\212O|]{\013(^Zdv\227\343\321\013\274G\215Mi\017\001"
+	.ascii	"\036E\304qw\203\212\004\336\243\200|\332\227\375\004\374\314"
+	.ascii	"->`\3675s\331\245)\b\037M}\355\017`\262\031\326\214\324\006\327"
+	.ascii	"\321\217v&\252\254\361/\302m\264\243NV\006\325;\320\310\270\250"
+	.ascii	"\302\314\361N5\005\363!\205\305H\322\370\332\351Ipz\375\254d"
+	.ascii	")X3RYc\323P\2510\373\333\356\256\365e\307\364'\246=1\3359\312"
+	.ascii	"\277\371\312,#\n\244\016\b\035\222\351$\332N\025F'\220\222\250"
+	.ascii	"\263(\344A\022} \036\035\037\237\310\024\362\205@.I\030\231\276"
+	.ascii	"S\251d\3728\264\375\266\372\332\304NbR\252\3428iG\3708K\fD\214"
+	.ascii	"JQQa\336\340<\006R0/RV\214\370F=\233\227\251\252\366\204\220"
+	.ascii	"|\313\032+E9\244'\321\020% P\002\"\205\327\r\301\271~6\006\333"
+	.ascii	"\203\2205\217\266B\206I \207\020)\275\263\210fH\213\362\340U"
+	.ascii	"\f\241\201\2570\315\240\227\020_\252P\f\276\224\"\265w\274\001"
+	.ascii	"\346\030\222\034\205\246\330e \373\332e=\313\262~\023*\215\311"
+	.ascii	"\0355\270\221\027!\003\024\327\024o\3235\204\005\005"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.252.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\002\024\325d"
+	.string	"\232\251\b&P0\220J\352*o\225J\367\275!\205]\240rI\301\347\022\257\204<\356\335\036\334J>\022/^'\364\023\212EaPb\2251wkN\316\237\310\242\006"
+	.string	"a\252\272\2429\232\355\271\240\213\262U\201\037\204L\253\017I\252K\013\322\270\355\336;\311\224\002T\002+\002F\002[\334\345\334\273\270{q\377\342\016\306\177\335\356*8\233c\3617\217s-\036u.\316\202\3179\235K{\007L\317\231\241\203\201\232s&\362\005\253\207\305\n\024\210\027\034k\026\222\377\214\0257(\b]zn\315ny}Z\221C\233\222s\366\354:\333"
+	.string	"\234H\272\034\216W\t\315[\355\323\n\030\2647X[\232<{e\377\340\r\335\r\324\234\241Vn\226\035*x|\320"
+	.string	"\235\234'9\313\325p\341vp\261\241\233C\035\256\340mIw\353\271\267\0074w\265O+\331\002\327\331wu\240\366\212\016\237|\227\275\253\211T\013\325\305Z\007<ZY\250)\240;\326,\004\232\275\3323vo\320\336\344\f%\341l;u;\356v4OK\272\332\016\377\311Y\f\214\\\316\320\022\255\344:\333P\017\266\316\272\016\324:\333\311\3566BZY\031"
+	.string	"\035\036\023\313\233\2343\324\233\320\275j\265Z\365\025\352\335\203\223\016\365T\302\211\304\b\021ML!\226\224\222@ \275GFEDC\037<\b\t;\004\203\2008\374\370\364\360"
+	.ascii	"\177;>\035\267\327\262\353\343d\273\257K\351PO=\025a^c\274\204"
+	.ascii	"\030w\022\023\006\223\260\363\021vuX\204\324\233\326\021T.5\370"
+	.ascii	"\035\227t\rn\2255\301`&\034\365\020Y|\311\263\242\256\224E\013"
+	.ascii	"N\212s\020\353k7e\036\211\031\311s3.8\214\024\367\206\337#77"
+	.ascii	"\262\242\206\213\210z*\302\274\266\370\020\332\031\376\300n\241"
+	.ascii	"\242Q\361\260\246\bS&\365;\256*k\233\204\213\tT\260\320\024\027"
+	.ascii	"Nq\202;\224y\260\214\f\007\245\001\335q1i\2029,\361\237%f\\J"
+	.ascii	"\260\317\332\323\332*\363;\256\261\025\005\034j\027-\334\323"
+	.ascii	"SQ\202\227\021\347\001\336q\025Y\337\2343\030\376\355\200I\035"
+	.ascii	"\311\214\213\b\366!\205y\rq\235\025\350+\013\032\277\343\032"
+	.ascii	"\262:\231q}a\227\002!'\364\\\352\f<\335\360\300\274%\301\303"
+	.ascii	"\270\2040}]\313\366\207\006\312\220F\n\343\002c\3313nnF|m\237"
+	.ascii	"jS\264\2740\257\026\374\327\021`a~\360t\365X\203d\222\260q\251"
+	.ascii	"cg\027\017\214{*r\316\215\233]^\336&\274\3737\350\366*\335=q"
+	.ascii	"\001\275\366\202:c\322\020\230\321\366\305\367\312\006?\350\235"
+	.ascii	"\036\2005\251B\3403\2005I\222\2651\336\363\314\342L\235<\351"
+	.ascii	"a|\017K\\\232%\230\223q\307r\220\360\260x#\347\b\323\022nu\\"
+	.ascii	"\300\1776\to\3254a\366\275\316\341$OHBq\227\256\204\311\331\024"
+	.ascii	"\222R\2607\333\177\227\257\354\244\344Y2\r{\223\235\233\366X"
+	.ascii	"\303\302\317\233Z\243o\361\354\233\233\235\177v\020\247\bj:\016"
+	.ascii	"|\257\356\373F\357\214\301W\032\236\353\331T\353\225\276\177"
+	.ascii	"zS\373\276\003\277\203\345m\f\363\007\017\\5\340\214\0318"
+	.string	"\235\177\266\357h\377=\354\245\256p\021p\227\216\204\311Y\005\030\300\336\374\307of)L\265\322@q\361\273x<\307\234\223\205\253\3701\0313#g\334\337\314\212\364\2060\210\357f\321\002{\363\305c.f_S/\343n\006d\252\304r\332\256\013\205#\355?]\350'%x\355j\260\367\\\353\354\027\232.\341\343I>b\246\235\272\215\233\263\322\301\216d\251\363I\316Y\204\337uw\033w0w,seh\026\341l\322\377\342\272\216\344Q\227x\316\267\321iu\261B\330\353\\\313\003AxM\257\3631\020,\341\345\274\364\246\fw\351`L\316N@\001\366\346\211\017\202\253N\363\250K\024cp\246+\007\334]\301\005\330\233\355oN\350\246<\212\224uf\3378Z\377\031lkz`8\335\203\241\276{\212\210\275\351\357R\367\020\340\344\034\311\243\366xe7T\211\3779\267dN\204~\261\356\0300^\270h\341"
+	.string	"\213\025)|\315\033\305\211(\227Ss\207r\250\367\222_\361Vr7\357$\207\363\006\201\364\036\371\026o\243\"\227\363&\032\372\340^\274=\b\t;\004\035\214w\320\343\006z\334\034~\270\177vp\373\254\270{V\334<\336\305\033\370\270\177>\334;\376\305\333\247\203[\307\305\355>\356^\213\273\355\341f\035\367\352\270\277\305\215W\334.\303\245\310m\371\360r\265h\316[\325\033\362\224\355\342\304\241\356k\356W\334\335\334\341\334\263\270\007n\022\344\013H\030\334%\036{\265\032\031\003>\202\305\203\027\202\025\322\215\267\215\271_\242Mz\244"
+	.string	"\366}\357\273\2216 \363\210L\265|E\220q\220r\334%\356\021\345\013\210F\310\034\243\177\366\257\261q\3026\224\345\0049EC\222ZB\2746yDOX(\b\262*T\272K\227S\003\205\206_^^\332\320?\177-M\0326\017nd\200\363\241\013\300^\207\177$\265\212\306\230\356\322\253\200\220t\362\304\025\221\303xsy\036\376\331-0\243\302\367\246\266\327\016Q\217\344\364\025O\004\344,\005nOn\265H/\364P\336\236\354j\333\223\"\264#$\203`o\256\370\001\200TA\313C^)$|\261\036\301I\244,\370k\331\261\332^\203|/\304\303\243\036\243\241\201MM\207\177\362\224\211U\t\276\030\021\220(J\2420n3\004\351h{\357s\330\276pS\207"
+	.ascii	"\215AH\372H\022qs\316\336\304\331\336\003\357\320\240\201\245"
+	.ascii	"\251e\341\2523E\t\303\003\232\"}cF\177\260\322\207ty\314\250"
+	.ascii	"\217\333\271\207wv\007-\212\377,4V\330\242p\n#I$\330\233(\236"
+	.ascii	"\315\203R\344\t\247x\257\303\313\344\263\007\317\004w\351O\230"
+	.ascii	"\222J\222L\244\356\213\373\202\346Q\265^\311\341\237D?\322\246"
+	.ascii	"\374\364\274\037U\364&\206\036\370\316\356\021\276\257'\370)"
+	.ascii	"\336\331Y\356{! fJ7e\324\364\300p\250>\377\354\034R4f\224\007"
+	.ascii	"\306\017\351\252I\357\364@\232\306\214\362\304\370\001Wm\263"
+	.ascii	"\236x\020Go\350n`F\327&Z\351\3420\333V\267\363\242\017\256\031"
+	.ascii	":8\314\350J\302\207:\374V\263\352cm\307j\205\357\354\225'\350"
+	.ascii	"\207t00\243\353\223\007A\374\030\2200$n\312\2549\347\334\363"
+	.ascii	"{\277}F\337+\360\3756;-\276{\357w\373\276\177\364N\227\372*e"
+	.ascii	"\302l\373\271\343h\333W\364\r,\372\336)\372\356\025}\267E\337"
+	.ascii	"l\321\023\r}\257\276!\252\264\214\031\005\262\370\336\031\372"
+	.ascii	"\356\r}\267C\337\354\320\177\020~\373\204\337@\341\367\272#d"
+	.ascii	"\321UC\317\305w+\374f\205\337\341\235\375\013~\373\202\337\300"
+	.ascii	"\340\367N\360\003\375\306\210 \201\327\252h\034\276\306\"\260"
+	.ascii	"\275\237\216T9\210o\361x\265\364\022mL\351\230z\215D\034E\253"
+	.ascii	"\327\211F\025\325\320(\205\303X\\ \251\237\206\357\001\020\310"
+	.ascii	"x\215D\016\212\357Q\312\370&\025\2177\212\306\f\336!\221F\225"
+	.ascii	"T\215\251\2278,\2660\032j\240\217F\025\325\361H\274z\235t\f\245"
+	.ascii	"\210F\033RI\301\366\001\237\206K/\001\357{\264\201%\225\001q"
+	.ascii	"\370:\025\365\323\220XE\264*\276\304\031\357\261X\365\016m`\025"
+	.ascii	"\247\202\375\016\227^\235n;\307\361;\207\361\373\305C*<\304\222"
+	.ascii	"\232\261\316@`"
+	.string	"\210%u"
+	.ascii	"\321\306\f\251*\342\317xL\240HUEe\345\032\217\tT\275\360\021"
+	.ascii	"\207\305\033\253\361hE\344@\352\252\247A\361\3709\210\303**\266"
+	.ascii	"G\306\321X\204Q\203\006V\321X"
+	.string	"#\202\253+)\253 \"\r\251\253+b\213#\361\212h\374\021\253\250l\foL\365z\352\211\312\306\024T\025\225\324\r\250)\343\025\324S\260\213VD#\324\261X4B\355@\263\253\310z\036\236\004\352\275\306<\001K\363\2435O\232<\355Xs\0163\200\272\206\253=\304\370\212\267#\251\264J\017t\206Lc\256\001\275\217\f\206\274\022\030\340\037\025\220l\034\260 \333\3248\274\216\020\237\377y\327\002|\237?:#&\215\323?\233]3\2421\032\362\315\212\314L\234\273|2&g\277\212\210\306U\220Z\216dc\336D\335\3453arv\351\235=g&\236\347{\336\231?H8\360y\276}\212iczy\302KS\220q\202x\317DrI2\021!\345\213\304??L\275\316F\274X\233\370\317j\223D\204\004X\351\275\316\3159\313\233\2779$\335\022\233a(:\332\2334R\212\264\303\336D\332\265\316\376\036"
+	.ascii	"\262\026\250\b\311\302\325'\3108\302\2612Q\334L\177X\260\241"
+	.ascii	"\256\311\214\264\312\214*\365\336\331H\3250\243!V\274\322;\263"
+	.ascii	"^(s\002*f\003S\210\177\222%\273\214\334\214l\356\315\fY\270\n"
+	.ascii	"4\366%\310\322?\225\360\226\357\274Q\ff\222\354\332\371\034d"
+	.ascii	"sT\222`\340(2\3102gQ\2573\206<\223\306]\342+R\246\313v\314X\032"
+	.ascii	"\210\177v\324\353\274/Q\203\237H\027\\\235\017\241\304\221\376"
+	.ascii	"\331.\274\001\201\226\250q,c\021SffDDd$I\322\030Q\005\304 (\031"
+	.ascii	"\256\007\021@5d\254F\022e\231\003w\257\034\327\253\325\341\f"
+	.ascii	"F\312@?P\034O\277\303\207\210\330\t\274\301\224&X\207\"\275\007"
+	.ascii	"\374\033~\030\264!Y\020\361?\343e\036\2120\332,\254o \306\022"
+	.ascii	"(\377\200\310mb\204Q\325\356\273,\241\320na\361H\026\257g\t\271"
+	.ascii	"\230\270\376\302\242\303\274\351_L&x\215\242\256\006T\357A\253"
+	.ascii	"\024\236AK]\267L\267\305\032\355U\214`\241\333\017\035\2210\b"
+	.ascii	"\207\300\306\277s\023\\\004\234p\315@`H\351~\231\243n^\200\311"
+	.ascii	"\321_\013\2509\326:N\343\025\036\003>uF\372Q\215\021\300\021"
+	.ascii	"\036\246'\215l'\247\215XK\005\255u\005\331\006\257\026\2164f"
+	.ascii	"1\302B\337 \217\037QX\307\320\361\202\016\244\375\356\250\rk"
+	.ascii	"\0040\tI\245&\252<5.#{\210\330\211\250]\026\304`qa\213\200\253"
+	.ascii	"h\261\214\301\250\202~w\234f\2641\016\333z&z\tW\036z,y\342\257"
+	.ascii	"\017\352\210\274\356n7q$d\221\310\020\216\006\017NK\240\272R"
+	.ascii	"\227\351\022*\363`g\251\213bdU`gO\004\263\022\t\021\177\312\215"
+	.ascii	"\024\302\370\273s\342\220Q\223\216\334\\\0166\320P\377\243*\365"
+	.ascii	"\3275\017\264\025\234G\314\234\235\311\036n\335N\250\353\b\245"
+	.ascii	"\\\365\301\204s\021Q\027\0335R\257\251\201/:\027\211\303\345"
+	.ascii	"\325\013\205\201r\213\003k\230f\364\020)g\n\"X\020'?\241\007"
+	.ascii	"\244T\017\216\027\302\360\352\357\316 \264\220\375\362\356\270"
+	.ascii	"\360\021\035\225e\332\367E&\033\254\244\036\216D\336*\306\200"
+	.ascii	"\304\307\303oM\373\022k\023|\361oO\300\266\235\002S\037\300\311"
+	.ascii	"\233\"\030\312\016\356u\r\377\226\236)\230\226e\231VR\332\272"
+	.ascii	"]Z\316\231(\207\345B\373\327(\002\361\322\371\315(M\n \002\357"
+	.ascii	"\246\265\314\344\225P}\360\353 @\202M\235*\367)\311\241pF\227"
+	.ascii	"\202\276\350\340c!\020\355\207\344\375%\252P X\362\"\204b;\300"
+	.ascii	"\205\344e\2739\270\321\331w\313\375\006]\377N(\320\005\fAh\310"
+	.ascii	"u\324e*\316\030\362\232$\260\351&1\316\0018\357\255\007\b\275"
+	.ascii	"\351\002\202[\311\037\316\347\325a\262\034A.\033\037t\266\205"
+	.ascii	"\326H\225s4\033\304G\320\333xf..l\301t\330\211\026$\240\212\214"
+	.ascii	"\204S(\037j&\211\222\200\313\263\354G/\216\306Jv\232\300?1\200"
+	.ascii	"K\361\274\025B\007\315C\364\276\037\344\221<\257\\\245\250\351"
+	.ascii	"\004\247\\\350c\236\3773\363\321]\245W\360@\004$\255v\327;g\t"
+	.ascii	"S>\024\345\227\265\344\304tK>[\023X\343\177\260\366\324|ew;~"
+	.ascii	"`\017\347uj\257~(\332\021\305})\343\305 \013\211-\314\032?\206"
+	.ascii	"\002\206\361\"\034\263\261\035+\310a2\367\224\210\313\206N60"
+	.ascii	"\361\026\\B\031G\244\203;\305\2433\035\233\272D\r"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.253.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\006\t\325."
+	.string	"\332TT\022D`\234N\007\177L\311\251\207\2212\374\017Y\220Eu\026\230\013=~zcs\351\357\271xRW\234\217\363\027\365\234A\323x\236\262gh6\270\222\024/\376Y\016|\332\232\315\334\271d\006\302\366\226{\357\224R\n\026\001\362"
+	.ascii	"\034\001\027\206[\336\372\340\234h\336\217\331\336\030\fl\277"
+	.ascii	"\244yI:K\267]\367]7]\243\314\315\334x\334y,\314\022\024\307\367"
+	.ascii	"\345x\205\033K7Yx'\003my0[\034@q|V^P9@\266]X\222\030\263\275"
+	.ascii	"q\327\370\360\264\326\266\302]\307\302N\231\231\016FR\031\263"
+	.ascii	"E\333\031\303\307l\223\323\266\314\250N\331\270v\332Bf~\271\030"
+	.ascii	"qt!\340\002\213\316l*\310\256\"\203\350\247-{3\"\265v\312\314"
+	.ascii	"\265\235\271\333Z\n\262\335f0\333\266B\274\340\265-S\212\233"
+	.ascii	"\326N\223ZH\355\024\355 \265SF2\247!\252\321\2125p\236Q\306\311"
+	.ascii	"i\333\226\370D\030\251Qf\263\352\310\276j\212\276#\271\347zi"
+	.string	"\271\345\315\257\016M\254/\3526\260\210\371\240)\321\2528L\006\273\216\314\325\235%i\235\352h\024=\352\363\342\304\007\255\006\272\344#\310\225n\266\237\241\225\371w]C!\t$\363\253CKk\277\025\332\266e7C\303\321\27463\363`f!\314+3}f\312|\016\373Ox\n\217\356%\233\3544;\325~\377N2!\363A\246\372\376nv\n\210$\360\315oNp\314\007_M\224\035\317g\036\217\360Q\r\341\231\273Tx\233Ix\2413)\200O\300\344\21313\305\374\327\230\373\007\356\317\006\377\020f\254+\253\316\322\\l\270\356\252\276k\246\320U\272'Hh\271\356\b\355\326\r\241\355\232\0314]3\325T\3135/\270\316\304\353<d\235\245\256\263\002\3269\352:C]\347\004\327\031\001\353\374t\235\017\\g\247\353\334\304:3]\347%\326Y\351:'\261\316\006\2563\322\352|t\235\215V\347\002\327\231"
+	.ascii	"\353\\t\235\211X\347\241\353<\340:\013]g\001\254s\320u\006\272"
+	.ascii	"\316\001\256\363\017\353\f\340:\373\260\316=\327\231\207u\026"
+	.ascii	"^\347\235\325\231\275\316"
+	.string	"\353\352|\257\263\232:\247\327\031\275\316\257:\273\352\334\001G\217\304&y\364\305\345^\2017zu\255\f\037 \211d\001&6o\224\250I\361T\311\327\337y\236\367y\240\037\360DO\340\251\236;\rr\312\025\242\246\211Z[\333&\333\354jM\322x\352\024}\013\027\274\315\030m\177\274\030\027=\001\f}\246\350\217K\270\347\320\023e\3502YC\177\\\306\261\271\215\211i\241\037\320}-\340\205\202^\200\206\366#\023\024W\026\340\201\222jE\315{\352\317\007\370\357\222d\362?\337\033:L\326\360\21794\230\016\235>\025\001\360\re)\307\326\363>\037\232\257\347\217K\271\247\360y@t\227,!\033\373;\"\332\311\376q9\367t\273\277\016*\005\231G4\027\022k\333\226=\340\326\202\034+\261\036\351\364\376\320\256\207\033\217O\275\372W\037\006$}\365;\375V\352Y=\372w\215/\2162\252\377\255\376\273(\363"
+	.string	"x\353u\361)<\263\026\227\267\331\377\257yB\347\213\177\325\027\277\363\372C\034\237_\262\t\231\333\200\243\206\207\266\f\265\352\215\322\004\301\264\t\034\346\224\364\225b\313\330\364ed\277\214\216\005\266\302\030\366\202\253\247\253\277\216\037Nxum\031\271P\354\\\035W\204\031Mpm\r\201q\235\3602z8zq\2618\202\205\245\3302\376\250"
+	.ascii	"3np\301\"lke\255a\327\n-\242W\227\221\005Q\353\013\2148\024\342"
+	.ascii	"\026.\270\276\210\307\026-\276\210Bf\333?d\256\327+{\200O\300"
+	.ascii	"\261'\273\277\306,\224\024\213=\342\224\243l:\2371\232.\370\236"
+	.ascii	"k\266\210S\215\262\351\022~\352\317\274-MP\254\321\266m[\365"
+	.ascii	"\327\030\215\263\216\262\211Z\255n\234s\224\315\347\016S\031"
+	.ascii	"\374Y\3475\373\347\024T6\321\253g\364\247~\301\2371w\303P\251"
+	.ascii	"\036\353\273\256\32349527z\244O\372\245?\360P\257\340\207Dd\024"
+	.ascii	"\006O\374V\nJ\375\020\203\267YR_\\\336E\275\002\301\254\250/"
+	.ascii	".\233l\t\036\n\301'"
+	.string	"x\257\363\364\b\002\351<5\237N\177\240\351\235\336\3530}\3233\313\251\210\234\243?\246\357\034K=6\245_\202\243\364\305\245\336\323\300'\271\3112\300\026\200\237\250a,F\221rfDD$\020\3214Ic\240\002\2211\252\325\001\021054\310j4)n\345\276k|\f\252\321m\335{\351\364\337\004\0358\247Y\223\203\n\312'\337+\362\022\207\004\314\257\306\036\260\244DdZ\203\313\203L[\211\310:gF8\204I%=%\311yq\312\037`\036\204\017\202\220h\252\275_&2\373\340\024\177T\"#\276\r\376q\360\255J\205;E\343\220\016\033T\310\344\211\240{\bE.\342q\f\241\200\200\357\251\267\225\230~ \246!\203sq\341\021\362\007\206HX\207\332\332\177q\224\220\200-Y{\3452\211\232E\t3\232!<\306Ob\365\321\215\316=\334\222^C\365\251\255\032\255\216\247\310M)\250Q\331H\351"
+	.string	")\357\252\363\034L\236z8\350#\245\031u*/\005\374\355\325_\342"
+	.ascii	"'\302\257\272D)\207\214\232\3608\327\252\231\351\317\327\364"
+	.ascii	"l{\317\004\322Jt\030\226\276$\231)\351\r_\341B\271\213\243r\177"
+	.ascii	"\206l\0163\242\263r\300\241#\236\013;v\223\3159m\264/\355\206"
+	.ascii	"3\241\300\206j\r#\274`\370\371\313\213,\354\363U\366\362\034"
+	.ascii	"\333\005\372/\243S\001"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.254.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\020\001u\r"
+	.string	"\246\031]E\020\221\223\0168\325\006\t\215\213\274d\351\224\013\f\t\002Y\3046@?v\357"
+	.string	"02\2513\344>\260\273\265\326\377\t+\236I\37183\222\323\256V\004x\006\n\005\013\202\224\250\"\350\245\222\372_\226\354\275\367N)H"
+	.string	"H"
+	.string	"J"
+	.string	"\3409\365T\363"
+	.string	"\365\324\";\306\200\221\035)h\001\202\344e\306\356^\322\303E\247SF\221?:\325\234|n|'\227\323\300*\205\f"
+	.string	"\237irN*\336S\217\033\276R\214V\307\356:z\237\311]o\273\201m\006\366\267\252\025\215\225I\216l\260\024e\007\3732\f\303\320\022e\277\345\2372\372\326S+N%&\207\241\332=\2055V\206\252Xq\206\203N\240\342\342\303\356n\276\261\375h\237\345\"Do\321p\216]\024\212\230]\020\201\013hN\035\207\301\344\013\312.\351\336]\354\0037\221Y\251\222\024\026,\273\273\200\304KH\360SN\255\201P\037\244\236\376[\2659\013\361\236\017\023\342\223!9\312\314*F\032C\275\2040\342\205)\316\270\306)m\221\013\361\336\345S?\207\023\001\236\320\001\205>\331\026\002\211P\370\360x`\335\205E \220}\264\220\217\r\263\214u\264\020\354\372h\236\355\302:\320\325\341\230\253\220uW\210\343\272k\003\222.Q\356 \311\322\334\335\245\002\034<\210\367<\243j\344\26429\242\357Q}O\275K\026"
+	.ascii	"AYz\027cfh:\307\341\356\201\006\205\212\310\230k K\326\320\305"
+	.ascii	"fi\t^\0308\344\272\"cX\245.\250\3574\325\254Z\031'\362\315\354"
+	.ascii	"\232\232\\\343RP"
+	.text
+	.section	.gnu.lto_printMotorMix.255.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`M\t\3751"
+	.ascii	"*Y\264\023G`\330R\007\377F\250\017=\325\004:Gd`E\004p\347>\032"
+	.ascii	"h_\226B\022\203\240\037?\tV\034\222\"+\216\360\034\341\214\267"
+	.ascii	"\370\347\343\363\261\020\213\237\237\277\371n\343l\323\350\317"
+	.ascii	"\n\276\325Avs\033\331[\312\224\002%\001\023\001.\001q\346SBH"
+	.ascii	"cp\357-\365t\376v\016\3275\177s\355\277\"\243^\007\367\226\036"
+	.ascii	"}\353M\367\333\377\267\237~\334\3179,G&jJ\031\025pR\354\356b"
+	.ascii	"\251f\312N|\224\2272\365nR\277\235\333\r\244\236\031\334[\353"
+	.ascii	"\350[W\336\301\356\232\315\305\332\030\b5\274\tY\372P\246\036"
+	.ascii	"\355\305\321f[\245\321@\340~\353R\367\263\373\233\275\223\251"
+	.ascii	"?\203\341\305\275\301\342\344\366\226\"\360!\367[\344\353\f\277"
+	.ascii	"e\037g\370\255O\271w9\312\330T\r\250\205\317\265\302\275wR\213"
+	.ascii	"\271\373\254\364\375\315S\017\277E\2278lY\235\247\374\347>(\252"
+	.ascii	"\227\006\350\266E\3650K\254\241\245\203\205@\350\345\353\355"
+	.ascii	"\252\362\033\204\353\353\213\304\n`\\^\357\002\201qu=\021\211"
+	.ascii	"VW\036\326l=Yd\365s\326\2263\267,\216\027\\\365\373\264\274\330"
+	.ascii	"\003\325$_\360\226\214\314\262\022\234D\205<\336\347\032[V\254"
+	.ascii	"Fk\263\362H\264td\375v\337B\257\205fV0\256\257\317\304\n{o\317"
+	.ascii	"X[\\\357\306ww?w\267\342\356>\003\372\361\236\035\023U\253\002"
+	.ascii	"l;\023#_u[\r\353\234\326Pw)U\326as`\256\276\\\207\271;0\360g"
+	.ascii	"\377\005>\357\335\350\251\357E\317\367N\364~\357C\377\367.\364"
+	.ascii	"j\377A_\345\035\350\357\336\221\217\345\375\347\321\376}\236"
+	.ascii	"\355\277\007\316\316\363u\357\307\235g{\027`\314\256c\314\236"
+	.ascii	"c\314\216c\314\036\300\230\375\306\230\335\306\230\035\2001{"
+	.ascii	"\r\234\235\346\315n|\263\303o\366\367\315^|\263\273ov\342\233"
+	.ascii	"}\230\263\267\305\354l\316\256\335\354\331\315\376\021 \350\245"
+	.ascii	"\371\251Q\255\032P\272m\\\313\354\275\226\316\310\347\375S\377"
+	.ascii	"\371\376\375\376\377\376\253\374\337\375c\371\257\373w\373\207"
+	.ascii	"\373\237\362/\3674\356\357\376Y\374\365~\357\373^\313W\035\376"
+	.ascii	"\353\212\372y\225\221\271|_>\2501\322J\272"
+	.string	"\311j\304\256\356\314\no,p0\365y,\220T\322m\003\006\274\3323+\334[\352\244\342o\345\257<\236\303X\262\236\312\275\213\331\035\345\313\bg\224\355\275_\270U\002\332\335\303\207\374X5\372\005\373\236\354\311\320T\236\223w4\215.\240\335C\214\310\217e@7\17785\225\0335\215\376\347\031#m\324D\261+1\317/\036m\244\263\231\3470\207\253\241,\337\237\336\021\242\016\033\363\260\266\360\352\242\2065\201\351\263\253H\003\351W\373\254=\351\2104R\027\365\200\351\363\037G\232\340\333PC]\305\320\3255\3254\242\036jW\023\247\317\256!\375\243\211\3728}\niV\017\365/\211N\251\002l\243\253\312Wk\374j\023\212\304\304\2776F\244\227\321)\230\370\325\002)\f\351e\024\316z\026#_\277\304\257\306d\232 \244{\004\203t\253\277\372%\304\256\332\234J\2522\221g\035\216VC\375\003?H\367\354"
+	.string	"\302\367\305o\013\211'\214\223\b\200\254%\336K\334"
+	.string	"\t\251ED\331\230\270+\237K\234\fD\032\373\321\"\242k\326\263\"Xa\376X\r\365\330\335\263\020\253\227i\202Vy\214\273+\375\226xhlo\253\007\376\202-\230|\002\311^\350!!gY\373h\255\337\251\304\346\035o\370:\353w\"\251\312W?\352\017\036\023!\227\210\220-\232\236\236r\226)\230\260QJ\351\342\275\020;)\233,\230h\234\234\240\226l\n%fST+\245t\241\233>\201\202\005\fN4M\260K\246\007\024+\232\226\224L)^\013L\247\246\362\004\323\322\316\222\251ES\322\022\212\t\225\364\004\305\214\233J6*beR\324Ss\311u%\244&'\245\344\212&\345SRi\031'\221t\034*\212i\231dBA-\223\260t\277\016\363\r9\344\254\2031t\225\033\234\024\2737\030\205\227\373\237\373\233A\264|\345\001k\250\027\207\024\211\232d\317\362\242"
+	.string	"\355l\356\321;:\313,\307\225\335{\357WC\375\253_\f$\354\361\214s\rhg\331\035-\340\2779<j\007\372\355\276\303\332\365\352\354A \007\3208:G\353\034\275\2059V'\356'g\212\304\311\362o@\001n\244\364\345\345jQC=\023\217\276F\013\341\216g\334\360\300\363\350,w\002\271F\003\3206\372F\037\265g'\006\"\3305\260\207\331\336\316\307\312\340:?\315\350[\036\rI\371\261\234\335:\346\204n\342\206l\246D"
+	.string	"4\362\230\037\360\3378\270XE\001\200\263\250aP\204\220\"3E\"\"a\202\264 \351\300\002\021\252\252t\020PEe\222BZ\003\366-\347"
+	.string	"\\5Aw\216\233ye\324\337\341\200\346\351\025\246o\375(\310\215\001\245C\344\266E\260\244\t\302\022F:\242\0170\252\250h  \305\206-\037\244\247\352.\333\307\360\277\337Sg!JA!=\0020\024\r\023\005l\030\224\016}\355SZ\027\317\317\261\344\226\217\314"
+	.string	""
+	.string	"\202\nAkD\001\363\211?\016\231\345\207\030\206\020\253\262\023&f%\243V\246ef\211\001\017\206\262\344-\207wzoU\350d\215\247\031\305\212\""
+	.ascii	"\223\035f\243X\302\226\360S\232E\355\265\377\277\324oTfP>\233"
+	.ascii	"\304\\\037\022E\017\267\320\0067\356\341\034!\363\215\377\250"
+	.ascii	"w\035H\t%\225\362\201\351\220\032-\205E\306\224y\261\013F3TU"
+	.ascii	"\240\264\206\377y\265\253\035\201\215z\342\277\371V\225\335\n"
+	.ascii	"h\336]_N\260\221\353\017\032!\005\363 \204\201\340\240\215\264"
+	.ascii	"2J\b\376E\341\036e\331:b\212or\325\356\325\217\322lK\257\377"
+	.ascii	"\351(\262\252xpv\214Z\272\336\300\216z\037\035]\220\020V\247"
+	.ascii	"\f\330\211\227L-\312K\035\342L\314\306l\331\365\037F\005\025"
+	.text
+	.section	.gnu.lto_cliMotorMix.256.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\246\fEA"
+	.string	"\032p\034\031?@dN:/FshA\343U\205h\215st `X"
+	.string	"\210a\243HX-\324hqD\333B$\323\261\371\016A\027\002\247_\351_\027\356B\017\222\242\002\302\206\366>\336\330\255\021B\344N2}\001i\001\203\001\200I\002\235\203\024\204\374\216\271\020\261\021\317\346vl\344\267y\235\362n\230\357\355Z{#\202\004\367\246m\333F ~\265R\217d\237C\240\332\276\366jp\202\321i\333>\035|\345,\346_\346;\237Fy5D\036\325\266pk\344\264\355\363\001' ~\345\347\223\354W\342\221\354W%s\242"
+	.string	"em\230\004\3017gv\203m\333j\265\034\237/3\221e\252\253\317\363\222\252<\201\001T\002\002"
+	.string	"\230JJ!\217QPONML\306\245\"q\310\256Uj\337\002J\276\335\257\314\f\252\003\204\243\026v\002\003\250\004\250\311@V\016\275\257yFm\360\326g\211\231\033\200\356"
+	.ascii	"\350\276\334)/Oz\351r\245\270\034\311%\272\345\036\265<J\255"
+	.ascii	"\362\373C\346}M-\352U\024*q>\327\314r\241\324d\232\227\345\373"
+	.ascii	"\232h\324\006\3239\217\036\305r\237\316\320\002\235\204W\326"
+	.ascii	"\240\334i\230fh\031f\355MosM\267\313d\224C\033t\022\032U\fi\350"
+	.ascii	"\262\274\257\031E\3556xx\256\327v\227\240\274\250\367\003}M\347"
+	.ascii	"\\\363\311%\3665\245\334\356\007\346\232lw\250\016\321\232\177"
+	.ascii	"\357k:U.AEP\236Wv\331\2450M\276\022\233\274\352l\256\231\346"
+	.ascii	"\252\257\262\346|\253\031\342\370iqR#S?&\312\235\333\3752\325"
+	.ascii	"\306\356=\276\300PC\333\266|\240\312\232\232\263\2013\337\021"
+	.ascii	"\314\034\306\274\244\027\275$\3076e=\334\324NU\303\261\203\337"
+	.ascii	".RG\250\300]\357\201\375\335\005} \202 \232\241P\3605\304\210"
+	.ascii	"\373\345m)\26460\204S3\013wwP\265\343\2309\300\345\017a\371%"
+	.ascii	"\330\343\035\320\211\333(\260m\305\276<\036s\326\377\240\030"
+	.ascii	"\276!i\024\311\331\266-W\237\373Q\301\347\362\225Y\264X\371-"
+	.ascii	"\330\257\377\013\226\031F\214\373%\337\356G\002m\233B8=;\226"
+	.ascii	"8cZ\357X{\232\276\367<]E%x\3237g\333\232}\351E4\343R\360\225"
+	.ascii	"\325\002\022\332@3{\260"
+	.string	"o\031u\205\310n$f\272\006\232\371\353\306\375\362\315\004mk\022N\311:\214\3719\366\013\212\326\302n\307\361\013\034\230\322\b\215\033\216\331\302\204\253\371%lEx\220\305`\001\326\237\347\253C\317V'^\256\232\372\233sR\ny\274\233sT\3612T\361\362S\361\262S\361r\323\3602\323\343\234\215\303\313K\303\313\305{\231x/\263\304\313\353\360\262:\274\334\303\313\227\275|\f\025\006\325\371\271\021\314k\300g\233V8\251\225\256t\276\034\372\307\371\337\374\317\337\315\361\362@\331\354\344\371q9\\\001\017\233\220\313a\023f\376\320E\2610b\356\361Z\007/\360\315\251w\344\220\340\241\037\207\303\026\350\024\3211\377\216\237\307\306\257o\200X\221=[5c|\250\254\fjx \254Uw\235\236\230:?m\325\227\257\3025\220\246T\273_2\365\243\277\023\2640`\b\247dT\246ty\352\270C\237\352\t'\344\320"
+	.ascii	"\315\336\362\334\340\370\234T\246\25166\363\223\004\021\235E"
+	.ascii	"\231\330&6\223\330\337\273eJ%X\201L\210f<\234H\001C8\335\272"
+	.ascii	"\207^\261\023\352 (s\326\r\353s\333\2456\245\233UY\207\261\261"
+	.ascii	"\227\332(\227\206\207\n\352\306\250\251\330\237\253j\266\267"
+	.ascii	"\212GB~\214\244f\035\306/<\363a\327\256j\276glc\355g\250\315"
+	.ascii	"\033\246\b\367{\227\244\244\222\205\305\n\321L\206\002e\234R"
+	.ascii	"n\n\352&%\234\222\021X\222\206\316\270\307iBWA\335\240\305'\372"
+	.ascii	"T3\331\376\234\211\017*\263\020\333\226\214\213\377\350\220\224"
+	.ascii	"[Te\027\345\027V\371\205\375\312\366\365\256V\242{DHG\354\026"
+	.ascii	"\252\255\202\273%FI\346~\271\366\325\343"
+	.string	"\207GJ\241\217\217\226b\240ou\327\341mI\2404\243Ds\277\334\352\373\321\221r\265d\364\210\035\247\252\202\3124\3125D3\027j\337\356G6~s\244\025\250\360E\032v\034\027\013\255\026z\215T\305\314[\345F=#\215\330\216;\0206\331\026\032\211\227D\221\331\333\330-d\216\"`\336\360B\034-2\272\033|\243\3608\314AN\b\205\321\b\340\003O\260_'`\031\024\273\205\234\354\356\347\375\203\\\022Hg\225\304na\274\302C\007\022 X\356\201e5\303kF\214\035\"\226\330\303\210\r$\254:\200\020\261!\005\t\020M<#\306\016\034+\373\360\352\341\005\306\262\r\b`^A\276rh\371\260Q\343\013\007\r*\376\327oty\331\350Z\301|\360h/\035_8f\344\350\032r\027\204/\034]Z:\276b\344\320\352\002\353\241\005!\311;xx\201i\371\330\261\003L\313\370\024{\3031\333\375G"
+	.string	"\235H\305z,\215\200\207;t\360\313\271Y>(\b\034R\004R\021\302\373%;A\313L\t\247\023\332\262\fx\240_\372\317\271WN\334Fs\342P\f\337\340\276\347\177\203\322\263\004~\246T\034.s\021JE\n\357\227|\363\376\034I\307\360\344\230\b\250\004 B\263:\205l\251f\252g>V\n0"
+	.string	"\262#\024B\205])tt\336\334\366\036@5\253\347\317\017"
+	.string	"2^\222Y\315\252\324\261\221\017\3120x\240g\352\330Ym\304\203\202\347i\354>\331\203\253\303\346\304\017\203\247f\t\375\325Iv\034\213\371\203\\\320\254\036\243\372\330L\006\275\216\355Y\301b\260F\252\3438\252\027\264\021\357\211S\331U2\265\263\246\306\207\345\324l\240?3\310\350\213t\214\330\316\242QY\277\335\211\202\004\367\316\242P\016\036\325L,EWXd\216M\315\274\341&\341\250Q\214\236\223\217\231\306E\002x\231\254\243\345\"\f\367\352\210\222y\277l\352!\233?)\322\n}a\242\256z\035\323Cs\325W\317_\233\224\254\303\002\200\374\250A8\003\031SfddFD\223$\351\320\002\021\241)n\003\021P\255s\216J\222$\303\034\276\223\377T\037Bx\031\b\241\244\023\007NH\007\324N\032\017\320\233\201\213u\024\271\232\204\276\376\2370\t\371-\206\227\245\027_\376\304\333*#\253\351\305"
+	.ascii	"D\332\233\351`\372\271\374 \373\307\020Y\377fy\211\030a@\236"
+	.ascii	"PKiY\371\024\356\3703V?\262\275\020\2618\244\344j\317\271D\201"
+	.ascii	"\256\331\323\244\005|X\027\200\227\016\034\177\263^\215\340)"
+	.ascii	"\230\377l\367$\312]\204\225\320\334\022\023\3654\224\366f\357"
+	.ascii	"+\023D\016g\340Bt\256\211\007\3040\353,Q\243B\214\327\b{+\226"
+	.ascii	"p\256\332\271\330\277\230\220\216\356\016O\251H\177\233\343T"
+	.ascii	"!\265\036\367DT\023\344\301XKh\257\204\326\313]\320\252Cw\264"
+	.ascii	"\320\2035\346\215\332\301x\240\304\201\001\332\323\"\313[h\006"
+	.ascii	"\005\350\364\351\352\302b\305H\347hh\214\034Te\n\300\264\213"
+	.ascii	"\277\006\002\305\276\303\001\324\005~\251\001@\362\237\271\227"
+	.ascii	"\257\004Y\360b@\317\2441n\206\273z\276G\013j\324\340\207\344"
+	.ascii	"\226\206\333;o\006[\321`\321 \207\312D\251\034gX\310\025P\017"
+	.ascii	"\360\363\r\335\322\324\031\03482\225\356hV\260\203\026\"\353"
+	.ascii	"X@\266\304\256hi\260\277\r\276\2775\2761\017U\327\211\225\020"
+	.ascii	"\303w\266}H\235f\272\323\203c-"
+	.string	"\212\307\330a\203\237x*\252\323r"
+	.string	"\016\204N\274\177"
+	.string	"0r\344\024\2640\370\234`P\024\302\374}\277\245\342\247\031\361\200\250\234\331z\233S\375\340y\367\207\235\031\026\357\270d\340V\340\364x\204\210\302\003\352\356\231\035\375\375\021\244a\246B<\tkJ#\315\367\305ou\257$8\354"
+	.ascii	"Y \247\264\315+\r"
+	.text
+	.section	.gnu.lto_printRxRange.257.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\017\005m!"
+	.string	"\366\375\330K\220\026R:\304\344`\304\030{\330\3606\234\002\210\362\303\270\366\r\277n\301_\312\210'9\322\343\216E\n\355\302\367\347\326%\034P\303[\355\022nJ`\216[\005\360W"
+	.string	"\363d\321f\223e\224\002|\230u\260\260\326\b!\204\310\235d\301"
+	.string	"\273"
+	.string	"\303"
+	.ascii	"W\362\355(3w)\345\232\222\327hcN\rA\246\335\233\004:\312D\353"
+	.ascii	"\321\337\230\271\267D\210a\320\022r\242\201M\036\210\360AF\344"
+	.ascii	"\310\334\246,\252\240\365('\327[\346#\357Cx,\022\\\273W\006\330"
+	.ascii	"\362\336d\020\367\254Gs\307\245G\317\327\244GY\310,%\247\304"
+	.ascii	"\035\"h~\025\205\244\335{wm\305\347\317\3449\265\302\253)z\266"
+	.ascii	"\025\362\271\256;nab*\215\303\253\347\213\231\216\0271\306\342"
+	.ascii	"y \312\313\354J&\233\332p@\035m\361\363\324)[\302#\306X\342\324"
+	.ascii	"I\305 \362\257\333'c\223\355+O\340\b%\213\2514B\335\252\f\356"
+	.ascii	"\275l\235\214+\316\353\231\331\0053\233`>\313\002\037\033\036"
+	.ascii	"I;\273\212?\"\315\265\224\324\225&\315\262'M6KGy\231\341h\276"
+	.ascii	"Y\235\006\272\200f\366`d\357\264\3238\024=.\026*\304\0362'\207"
+	.ascii	"\266\253\314tD-\271i0\377\364\350\036\344\347\271\326\237\333"
+	.ascii	"\371\326\257s\254_\300\275\3169\357:\343\334|\353\214S-\333\250"
+	.ascii	"\226kV\3134\252\345\231\325\262\214\265\f \265\034\223Z\206Q"
+	.ascii	"-\277\254\226o\252e\333j\271\246Z^Q\313\252j9U-\243\326\362i"
+	.ascii	"-wj\331\246\226?`\301\026\2462\255&X3\2237E\027-\227\tZ\344\306"
+	.ascii	"\275\376.\346\023\341\177\361\215\r$\020\336+\230\033&o\n\325"
+	.ascii	"jj\351[?\204\0035d4}\250#\232L\317tjE\305\034\323\340s\266\201"
+	.ascii	"\327s%\323>N\260\226\232\247\001\364\211;\276<L\307\300\364U"
+	.ascii	"\034\321\262\230\\\026\305\261\266~i\234\346\213MPg\200!\251"
+	.ascii	"\220\367\022\357Da%*\375\034M\273\202\005{'>oT\017\371\326/\027"
+	.ascii	"~\344v\304\252\265\r\255\310\2059\303\215h\330]\335\333\244\200"
+	.ascii	"\277\f\301\013:\263q\264\326G\036\253`\301\272\331\233^\273\247"
+	.ascii	"\203j\257}\265_4\242\353\264U\253\251)@G[\327MV,\022c\277|\367"
+	.ascii	"\331\314=\"{'\264I\300\260\315\323g\237Ql\347\272[\265B\334q"
+	.ascii	"\236\307\322\267\355\023s0\331.\214\323\357\237\325\024\263\310"
+	.string	"e\311v\t\034\364\311\005}rA\237\0340\004p\346\001R\021/\b\242\007\343;0i\002\321\3177\304\353u\2609H*\n\3628\364\206\002 \021\3718\374\216\034\364\210~<\tE\275\337\217\327A\250\306\003\022\017\302\007\243\340\320\312B\005|EB\273\237\217g\264\023\002\"\355\n\340\370\350C\017\270K::\002\356n\311\373\246\301\347\372\n\366\003\006\026*K\315\244v\025\327j\240?5\033M\261b\230\345'>Q\\\237\353\265\253&\222b\230\335\351\233~\262H\251+1~\336{o\332U|(M%\305\260S\327I\315$\305\260\346\007\323\234~\372\327kgM\262b\330\331\323|\366M\343\372\211\371WJq\372\247\257<\312b\213\312\316t\215M\204\234\266\351\027\271\320tZ\250A@\305\220R\244\f\211H A*P\032\003\200\002\221:*n\021\26095R\245\220i\r\310\344\270\\\212?\325\307\214^"
+	.ascii	"?dK\273oQ\016\026\260]\222\200\250\3304<\220 \204-\333\212%^"
+	.ascii	"\277\231\255\222H\262.\211\364x\251\246v\377\340X\354\375\177"
+	.ascii	"\223T?\020\3020\336\244\316\221\034+\240\215\377\251\340\230"
+	.ascii	"\342\321\025\207\023\023\336\344yz\013\200mTq?\275uT\256\307"
+	.ascii	"-i\260\021\214\340\247\241\3504\222D\003v\344\017s\023\223\021"
+	.ascii	"\272\035\3608\273\001C\246\316\027\260\234\247\273?\"|\030\363"
+	.ascii	"nr\207\363[h\333F/\317\037X\210\326\300\037\0063]\016\241\332"
+	.ascii	"\300\362\257\231\300\007\327\256L_\241\371\003"
+	.text
+	.section	.gnu.lto_cliRxRange.258.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\333\001e\021"
+	.string	"\246\237sH\320\224M:\220\212Q\221D\2011\357\240\374$dy \374\361\024\271n\036\220y\233\n\223\037\210K\210T9\210\332\314Z\375S\2419\207\265:\007P\022\021b\260B\tO\365d;\252\017\366\267eD\0303b\311&[\246\024Z"
+	.string	"\\"
+	.string	"`"
+	.ascii	";2\360\001\357\323\343Y\335\247\367U\367\351\230-\204d\266\262"
+	.ascii	"\006E\236jf\034\331\335O\266x\354\250nrRc\376\203\236\nE\331"
+	.ascii	"Q\336\315\273I\243\022g\312\001\020o.\271\004\266##\003\304\031"
+	.ascii	"\216Us\021>\350zB\224QE\231\354\2565\024Q\334\336m\263\330\206"
+	.ascii	"`kIDK3\352dO9i\203p\321\207\227\001n\034\261"
+	.string	"h\262\315H\231=\312\250\334\261/o\267\333\315R\307>\320\317M\265r\352\247\316\024\243F\263\371\212!\273\265\333\323*M\244\027\026\221\324\223\203\343\021\037-m\222`\344\374\354\256JU\266\257\366\177.#v \022'\260\253\003d\264\001AH\364\343qT\360vi\036Z\360hL\020|^\300\240\017U\026\240\035\215M\266\231\352\230\325|\270\225\372\031:_C\367\241\3338\221=xvc\036~\310^\360\"\224\224\211\032\020\036\016h\274\206\313\357\371\364+e\372)\335\347\017\353l\017+\372\320/Z\272Q\2529\217\223\315H:Dw\271!~y\271\274\300\316\035Z0\340\007\003\256^,0\025\016+.\224]-\230\212\353c\201\241\254|.\320\345k\261\334\362\341\005~/--\340\247\032c\316\255\324\241\260\303\247\311\026#e\270\335]\224\001}\020A\037\232\273\017&\232MW\242\027z\322\311\374!\224\003E"
+	.ascii	"\r\311\022&\250P2\221\0242\234)w\254\340*K\020\005' \220\202"
+	.ascii	"\221\262\362\030\341,\375c\314\212G\242h\022/\272A\261\264Ka"
+	.ascii	"+KF;\375\266R\3625\321\007\314\214\313\023?8\331\203\001\021"
+	.ascii	"T\262p\275\177\210\275\266M%\254!\207\370+:\216\365\302\"\\6"
+	.ascii	"\0345Bj\253\271Z\t\020r{e\322H\013S\212_\3235\204\003\005"
+	.text
+	.section	.gnu.lto_printServo.259.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\203\rUB"
+	.ascii	"\252sp\031=0\244J:C\262\214`\016\2671 N-\216J\213]\212\316\314"
+	.ascii	"\235\321\022\200\371b.\005\274\200_o\352\346\236\247\361w\032"
+	.ascii	"\240\r\177\031f[\003\214\022\253\314\332Zl\244\021B\b\221;\355"
+	.ascii	"\215\001f\001\204\001M\257\341{7G\321B'\002\370\367\355=\022"
+	.ascii	"\272(\241\342\035\374?\214\364{r\nBw\320\301\257\363>\214\264"
+	.ascii	"\023$}\341\240\357\033\2233\220\320\f/\bh\347;\273bB_&\2543P"
+	.ascii	"\221E{9\370{\0309\307\307U\021\350\353\346\"\006\376\271\223"
+	.ascii	"\364\276P\255\253xE{\265\221\030\343\326\003\002\207-\304\033"
+	.ascii	":\0232\364m\320\356&\bU\323[$o\215\253\275\212\241\3553\306\277"
+	.ascii	"\373\023\355xB\360\361}\345\370\356\274/\224\013\037h\257^}\271"
+	.ascii	"^M\017\265^\305\030\r\343DTF^&X\324J\023\216\244\367}\273\332"
+	.ascii	"\251T*\225OQ\270}\n=^U\264/\243\240\236\234\232\230\224\311%"
+	.ascii	"\244{l\247X\251UM;\243\341\3079\026\236^\036\342\236\033\363"
+	.ascii	"K0\200\315\034\265\345\215\356P\205V\362\223\227;uyS\227B.\231"
+	.ascii	")M\345\352\210\334\260\355KJa\220\016c\224\254\334\362\026\367"
+	.ascii	"d\225/U\031\244\222\221\005\344\336\246\334M\031(\372A\272a\333"
+	.ascii	"\224t\311$\314\332\313\264I\311\307\301wp\022\376\271[\224{\213"
+	.ascii	"{\353\345S)T\024>1\351\326 3R\316\347\005\312\264\301e\366D\350"
+	.ascii	".\225\262K\332\006\335\260-L*a\221\")\337K\313\253K\006\312\325"
+	.ascii	"'"
+	.string	"OS\253C\3023J7#)\026\025,t\336\367\314\346V$\367\367\316\340\251'\rq\317\r\3123{\341}_\234\327\334\336\216\251\216\361\0311\306s0F\216\tE\362$\234;\254Gt#R\253[:\026\\\337\271\257V&-7b\007\375~\337\325\300\247\236<\3048\214Dr\243\203@\177v\215\223\371Bk\335Bc<\203,\177-C/\231\234\031\263\250\250\326L\214\241\314\334s\030\177M\302\006\tn-\030\2478Q\342~\307$n\347x\204\210\020\357s\374\301\303\365\034s\370\233\177\303\367\034k\270\233?,\303\365\376\013\307\373-\234\360\030\354~\216\277\216\347\330\353|\307\017>\347\330A\327\365\216\033\270\031s\271\031o\261\031k\271\0313`3^\340f\254\300\3158\001\2331\0027\343,7\343\003n\306\006\330\214\261\334\214\013\270\031_\271\031\023p3\036\260fl\265f\\\305f,\200\3158\3001c"
+	.ascii	"l\306T\307\214\247\330\214\245\216\031/\331\214\243\332\214\241"
+	.ascii	"\330\214\237\332\214\235\330\214\233\216\0313\261\031+\217\031"
+	.ascii	"'\331\214\227\216\031#\331\214\3356\343#\233q\333f\314\262\031"
+	.ascii	"\257j\306*\233q\312"
+	.string	"f\334k\306y\315\370**\350\345\035\276\211riD\350\313\244\221\322\373G\375\023s\302\337\317\337\347\327\363\357\371\361\374~?\337o\347\237s\027\343\027\246\257\034\rQ\3061\202\370\203\030\351'1\232\330\244\355\203\037\210\221\256\223\220\317\235\244<\370{\316\347B\332\021\017QBc\364\004\t\205\212\307\236\303XM\256\264\265\255\005\377J\2772_\246Z\213\3417t\347)\372\222\207\255zCsh\226\220\216Z]\207\265\206\003zU[yuU\237\217\243\2645\254Tk\301G/j\212#]\224\256\331\2271\033N\325\006\3758?r\211~i\366\345\f\335\325lm\276\213;\304|\204Enn\326\236\303\211Q\273f_Z\242u\024\r\323\354k\374\263\365A\263\375\357GBQ5\315\276\364D\343\264\273\272A\263a\374\373X\035t\212\376\336U'zqV\371\251\243Z\252\251:\200\200\260\007-\240\337d\004\320\001\242"
+	.ascii	"\354\246\232jq\252]<\021\027\227-\025)\305\322\016\252\243\036"
+	.ascii	"A\265\213g\342\242S?\365\352\364\203\330\310\320)\3530\021\241"
+	.ascii	"\270gV\255r\333n/\265\262\233\332A\343/\352\300fA\304%\356\356"
+	.ascii	"}\325\276\366\241U\373\224\004W\323\006!\"\177\r\247/\225fb\246"
+	.ascii	"n\"\361DL\204\213\311V\232xb\322\016\331K(n(\005\262p\361\330"
+	.ascii	"\356\212\023:\332\341\261\335\0266\0311f\361A-\332\367-\022\001"
+	.ascii	"\377p\310\237\027-\335U\266\377\366\f\264\210\227\314]\275\366"
+	.ascii	"\211>\273\242\366\332W\373M\300\022\2356\353\024\334\323\324"
+	.ascii	"zw\211\356\301\346_S>\240\223\350\021\215\261\030\214\374\265"
+	.ascii	"\356^\004\251\321\237\334\033\232D\377\357'\234\202q\324\352"
+	.ascii	"\322\002\2601\323\244\017\262n\350\252\270C\200\032\035\032\n"
+	.ascii	"\270l\314\254l\254\307X\331\325\017\262\033fK\034#\353\352,\353"
+	.ascii	"\212\312\306\030\016\034b4`\260M2p\344\b;j0\263!v\266c,I\366"
+	.ascii	"2\036(f\340 \213!6F\303E\301\303\306\231\230\214\261\030Of7\304"
+	.ascii	"\312\304J\344\350Q6f\206\254a&&B\307"
+	.string	"\215\263\030-\206\321\200\314\006\214.\034db7\272`\224\231u5X\342\034:\306\312\272x\344\310Q\326\205\204\276\217\363\266\317\357\316\242\"\221N[\366\034>z\201\022\321\252\032\251\314\274\327{\257>\243\2747Q^-\242\017\250\b\312\311C\263j\2462\363`\315\246\344`\027D\203(\317\023X{h\374\342\004\266\3650.+rTp\336^\232>M\\[\315\240\271z\205\243\325[`\275u\255^\021\251Qb\302\240_\370\224\322\263q\021\217O\320\032/L=\207\277\002\223!\232U\323f\346\277\232My\037\353W\267\\^\372\276\357\253\3549\374\257\016\321\253\232'\244\234\\\020\266\240\221\316\302=K\n\022\264\201V\320+\234&\334\032\244\004\335\212\002\305UA~\265W\343|\004m\r{\230\210\022\332\263U{]\202\253\b\340\232\211?4\202F:\t\033\233\214\257\302'\f\243\333sY\3752\006\232@g\265"
+	.ascii	"D\302HM\270\314\374\201\376\320]\251\th\240\013\364\201\256\032"
+	.ascii	"l\302a\265\201\257\336:V[\301Q\243t\325\005:\255\323\224B\240"
+	.ascii	"\007\364U\263\217\232P\322\2140\"\320\007\354\302&\247a\2004"
+	.ascii	"\240?x\255<Euq\317\036L\f\200\373\250q8\345\fbffFDD\222\244i"
+	.ascii	"\f\240\002\2211*\316\001\021@-C\314\221\310HA\322\312\034M\231"
+	.ascii	"\360\311\230N\357\fN\233J\257=\336ul\002"
+	.string	"\355\261n\372o\202\006\034\273\275\244\245\355\245\034\211\031LO\026%\273\033H\037\342\203-W\344\247\375\300\214;\354B\307+F\302\214~\263\215f\353r\337\2147\027|_y\342\346\272\314\036!7\026Bi\345Q\304L\301\324\\\303\300\243f\345x\311\242\2132\232\363\335Z=\034tt'\360\022\033\034\024t\277\274\370\034\232\277@\255\234\347\026\242D\243\334c\335\334\346\317\027\256\316\020\002\355\2545\341%C3\b\267\240\2204\026\264\374P\3431@rM\260\303\321\307\277\362O\013\321\317\204\253\013\031\210\223\337)\222\316]\274\230e~\205\273\206\362\341\300h\202\355W\217$\361\025\257\2244\354\r\251\353\331\221GC'u)\232Hny\313\001^\222&\346,\027%\225\nU\321ron\270\3645\302\352\235\267\004\276\034\330\242\342#\234\f\210<\222\247\007\367\b)9\304\374\220\262\210\0262Z*y\002\t2(\001"
+	.ascii	"\236q\221J\256\300\373\365\025\211(=\310Q\021\356\304U\325\345"
+	.ascii	"\301=5\221N=;\370\265<\013\377\rV@p\3250I\347Z\247pXI\005\267"
+	.ascii	"9"
+	.ascii	"\026\3319c\"\265\2469s@\363\rOY\210X\221\216\016C@@ *,\235J\353"
+	.ascii	"J\005\036\273\030\024S\307\225\353\263\276r\350\210be\226\203"
+	.ascii	"s<J\033\344-\202&\333p\246H\266\004\257\363\202`\214\320\032"
+	.ascii	"\246y\305\374\203\350\n1\232\310\271]\345\255\031l\024\345\306"
+	.ascii	"\bD7\317\2513\206\235i]\242\032\001\341m%\\\374c\224\300\"\301"
+	.ascii	"\344\306\b\2108\374d@&\360\202\362\325!\037\nvO\363\345Q*"
+	.text
+	.section	.gnu.lto_cliServo.260.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\327\013\305?"
+	.string	"jn\204\030CPdR\007\003\222GP\221"
+	.string	"?\350\362\325\203R4%o\340\241\027\226\347\2328\006-\257\212\3179^(\311\332\221\016R"
+	.string	"P\001\204\002"
+	.ascii	"(<\247\002y\205X\311\271 \361?\300\212lm\357\275w\222)\005y\001"
+	.ascii	"S\001z\001N\246\023@\347\ne\377\342a\034\256\203b\374M\351cr"
+	.ascii	"x\354\214aAV#\t\352\204\016\306\245Jw\3539\217\303b\337agE\222"
+	.ascii	"\027\307\361\001\330[$\353GnTGQ<\215\375\211gU\313\213\343h\322"
+	.ascii	"\333.\320\355\271\333\331\334\213\322\241:\234\030\307glh\342"
+	.ascii	"8j\240\245`o;\352E\327[\330\217\\o[\331\335G\251+\326Z`\375j"
+	.ascii	"\206)\024\3071\325\2475\334C\257t\247&\246%\243R\022\200\"\322"
+	.ascii	"\221\021\261\210h8$\f\002\177G\370u[\366\237\262\262\035\b\246"
+	.ascii	"\345NM^\234iI\351\203\212\221=\236!\241\372\364\311\205E\306"
+	.ascii	"\251k*mI\222\002 J\021\n\322\223#'FM\32621\313\352\247\210%@"
+	.ascii	"F\027\304\247O&l\261\216\031\036\021\253\240\253\320\230O\237"
+	.ascii	"HXa\265i\347U\236jyH\306\225\207\216\270\360\314J\367'X\0266"
+	.ascii	"\346@\237>\215\024\311?f\230\230\037\331\267\353+\212O\237cl"
+	.ascii	"U5O\215\3079T\225g[\206\241\312\302\304\374\r\246\341E\331\250"
+	.ascii	"eal\356\262\022\330\b\371\032\2025\331\354$\317\237 \0303\267"
+	.ascii	"\354\024]\020/>}\022a\211f{\244\036\327\225Y\207s\250\262\260"
+	.ascii	".\376\276u\304\237X\002yi\b\371\364\te\213_Q\234\016\347\331"
+	.ascii	"\013l\231\363[!\216\343\316N\2600o\244w\347\f\335\275\354\376"
+	.ascii	"]\003\355\347w\337\233A~\216\345\262\337\2767\2718\032\307r\377"
+	.ascii	"\331w&\231\360\377\275\331\267\225\257m\300c\270\302\317\357"
+	.ascii	"q\316V\241s\244woj\226\371\352o\300\210ea\333\230\3339\270\355"
+	.ascii	"\035\\/\343n>\344;jq\274\345N/\323]\300\333\200\310G%|R$lq\034"
+	.ascii	"W\261\361\271\020\355O\274m\021#\332\366\021\256\267\356"
+	.string	"%\334n\023'\262;\333\341\252n\352\232ou\b\363\037\255\335\213\200\030\261\362\364g]\303\365G!\325\303\225\253=\314\004\276{E\213\354N\177\207s\357!7\227\204\232\307\365Z\335\321e~\264nW\362Qe\255\377\254\033BU\003\006\356\346\235t\250;\001\251(\217z\007xsC\275\271\221o\356\343\233\373\351\315\355\024\314\335\024\314\315\004\347^\202s\033\225\334\214w\022\234\273\b\347F\002\346>\002\3466\202s\023\333\334Emn\2426\367\020\316=\364\313-ts\007\335\334\300_\356\037\234\033~s\277mn\267\315\335\272\271Y7\367\267\271s\233\333'P\240[\332q\263\212\375]4\376\272\362\305u\255\032)n\306=\352\356\346>\306\331n\357\033~\246=@\255[\272\235L{\\\007\315\364\034\222+\032\203\275iz\360\260\025\212\200#A:\177\341\036\375K\365\002\365W\303\374\205k\364G\3047zv\316"
+	.string	"\361I@\373\250j\232$\321\"z\236=9\017H\216Z\364h\375&\275\307\022w\337\246\204\210\206\244^\351\275\212\376JJ\364\303/\3727L3H\322\223O\364/\237\346\026W\351\207o\324\354\343\247\311f\350\223\357r\n\300CO\002:hM\315V\276\302c~\252\3038\3470\327\346)\351\315\n\223^\352\275~\310\315\365=\021\370f\205\020>\352\275\372\302\026\241\206\346\236\273::;\246\f\261@\251\237\222\203\003\205\033|\322{\001\370\212C\006d\360M_p\372\300U\017\341\275\272\335\035M\031<\253\020nOKk\327%/\210\300\243\236\301\007\233|\344\230W\304\312"
+	.string	"\371"
+	.string	"\"\333@\204\354H\3638Y\023\212\365\367on\272\236\307?k\217s\037\373\202\323\347X\365\315\276Q\037\340\275\350<\370\027\344x\034\007~\360\367\300g\0075\373\332\247\312\0371\340'\355:\\o\177?|\303\273z\025A\340\001\276\352\207M<=\346\225e\276:\033\307q\f?\332gq8e\233\223\232\023\320\373\360\273q\005\\\352\033|\313\207Iv\314Q\337}\001Cv\347\373.\234\275!u\\Uj\325\274\267)wg\330\220\363T\257u\313\327\312`~\340\334G\353\326{\316\225\372V:hO:\207+W\037p\321\263\326>\232\373^\026\255B"
+	.string	"\262\206"
+	.ascii	"\244R\273\230\302\232a\343j\005\026U\226\213\026V0X0e\311\250"
+	.ascii	"1\343\202\005\025V0N\3300\302\312\222\261\"F\215\026W'~V~\225"
+	.ascii	"E\343W\310\260\202\241\"F\212\267SLY\301HA%\303\352D\f\252\024"
+	.ascii	"WXTS\305"
+	.string	"\236Ac\305\025U\326\214\031WT\301\350\226W\330\372\245;\265k\b%!\363\342EZP\2264\345`\343\270\214\202\217q\207sb\036\230|\205{t\001aJf\247\177\372\343#\037\352\223\3379L\351\3445\023dG\306\026\307Lw*\241\300\314\027\003\274Mz+\245(\251dw6\033\217\275V\023\037\n\371~|zwz7\215\252\327d%\377\310\363\321c\351\233\336\350\216z\307\204%;\225Z\336\016\037\036\217\035n|\246\017\246Q\3514\373\212k\231\211\247\213\353\216\352\006\251K\336\262\313Z X\343^\216\345\234\200\266\272\225^\274O\331\366v\370\352\310\032\270\\\267R\315\255 X\343\236\363}p\275\r6\251oN@\304>>\226\372\210\260bT\004\031\037\215\270\364Dk\346,=\211\2660kRn|Jm\367\223\362\245I\3478\210\242\226\244\0343>\203%\237\231\224N\020k|\022mnk\362\360"
+	.ascii	" \375\320R\357*\245\353\253\027\265\370h]|\342\023Y\231*R\335"
+	.ascii	"\243c\254 \021\311\374\314\364\366\314\246;\216\370\270\262\315"
+	.ascii	"Ez\"+zzR9\\\271\352'{\213\364$\240W.;\n\031\005\200\360\250q"
+	.ascii	"0\303\230b\206dDDf$I\2321\240\002\021\252*n\021@\275S\216F\232"
+	.ascii	"$\255\001\276\2565r\304\204\221P\323\277\031\275\271H\207Ox\371"
+	.ascii	"\311U\326.\254\216\272\001\004\334\316oqr\266\247\203\313\022"
+	.ascii	"U;c\223E<\276[\312*'U\205n\007sN\200je\317\237y\356\214\n\r\252"
+	.ascii	"\316\270\021\034\245\330uQ\321,\rDf{\013tV\244\302\304\247\n"
+	.ascii	"\177g9u&_\022a\027mM\207eA\2229\264\022/B\250\211\304\304\357"
+	.ascii	"\311\306$7\271\203\375\002ng\320\216m\230\030\327Q\007\0200\265"
+	.ascii	"\234(\235\202]\344\230%\314\351\346\242\364\023\240\023\234\257"
+	.ascii	"\024\344 \210\2765?RK\201\343\230\342C5Ew\342\004\223h\021\023"
+	.ascii	"_[\233T4|t\351ET\325\243\263\274\345{1[\347V\354\024M2\216\336"
+	.ascii	"\324\260\244\013-\371+U\326\377\224\337w\223\016\260\347\n\277"
+	.ascii	"\242\023V\004\220\203\3723QK\245\343\351\024q,\325\032:\354\t"
+	.ascii	"R\314\243\204\304[\377\253 ?\370\203\216 \024R\245\241\017\337"
+	.ascii	"gg\013\367x\021 \244\275\263z\370Y(E>y\213\007\203\2343\204\343"
+	.ascii	".\024,\237\303o.K\237.SB\262\216\255\365Q\266e\022yRpd\336\354"
+	.ascii	"\264\206`\274\216\2435\036\331\301\002S\007X\365\305\3627\216"
+	.ascii	"\243\317h\265\320\367\343\030m\026\2330tE\016\0130j\210\306\024"
+	.ascii	"\375rD\237\340\037\325\357\331\314\231\363\200&\211\311\311k"
+	.ascii	"z\032-l\007X\364\230\350_B\026\320/>_"
+	.string	"x~\321\363\272\274\234W\340hF\242!z\347D\357h"
+	.ascii	"d\354\201\001\267\313\216$T#(l\0045b\3001\033\325-\033\312\363"
+	.ascii	"G7\001\271\225\005\252\001"
+	.text
+	.section	.gnu.lto_printServoMix.261.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\335\007\315,"
+	.string	"*R\340\021E`\246N\007\357\256\320\334\027\231B2;\230\016\210\f\021\234;\204\207\305\334l){\205\264B\261\306\231\244\264\325B\255\205\266OC\205\341\232\\\"\370\222\324\267G\277&\253QkS\364!\372\335\275\311\336;\245\224\002\013\001\361"
+	.ascii	"\016\001\312\016\263\302\215\245\231q-'\354\271\340\360\247x"
+	.ascii	"\367\226#\270vJ\325k\340@\330W\274\224\206\312\213\243wvg\007"
+	.ascii	"\\\373\215\033\216\333N\231\271\312\013\2450\345=\262uwJ4<\367"
+	.ascii	"*\025t\312Wk\247\3352\363\273\305hC\002\202\rL\004W\366\024a"
+	.ascii	"\257\3110\002\272aTl,X;e\345\332\316\334h\235&l\265\031\354\273"
+	.ascii	"\267Ln\356^\345\002nZ;Uj\"\265S\264\205\324NY\310\374\306\250"
+	.ascii	"\306\035J=\321\212mx\356\275\277?c\240F\225\315\253\013\333\267"
+	.ascii	"\366\324\024}\027r/\233\351\255\r\254\016\3568l\037\372e\272"
+	.ascii	"\224\265\231\034<\320\007dgb\032\256]\354\b\346k\331\030\217"
+	.ascii	"\356\025\031\333\321\252\216NQ\2443b\240\370\034\211(\323\017"
+	.ascii	"!V\332c\rG\321\007iQ\2164\263\375\3061\f\375\265%\027v\261c\321"
+	.ascii	"\277\341:=\273S\2429\313\306v\264\367$\334{\331\215\307\261f"
+	.ascii	"\266\2319\n3#\231{%\002\377M|\322k\376\242\366\3737\261\t\230"
+	.ascii	"?\031\352\373\233\331\027r$\321P\251[\346\321\360\347\227\221"
+	.ascii	"\223\026\347\331\307\177\257\240\243\236\031x\302"
+	.string	"\333\310\340\211p\334\261s\332\021\177\310\254\034\372\23317U\034Q\r?\021f\bTS\315\326-\325k\335\r\030\264[\367\257\325\272\243\372Js\202\256\322\f\365\324n\315\bXg'\326\271\251u>\300:3\265\316K\254\263\022\353\234\324:\033`\235\221|\316\005Xg\002>\347#\326y@\353l\304:\027\265\316\002Xg\242\326y\210u\026\3629\007`\235\203Zg \326\371\307\347\354\303:\367\370\234\001\260\316m\353\314\262\316\276\324ye\235{\254\263\352\316\251\317\031u\347_\235}u\356\b\031\332\300\316\260=\323\276Nyq<\357.\2314\213\222\246\353\276\322=\327]\245Q\346f\356,\334Mn\351Z\370,\361\002j\013\364\336\262\bM\327m\267\346O^\362\366{\376\347\203^\350\211\276\350\241\236\233\2150\331\033\202\207\207\f\355^b\033'\254\304\376\361\324i\357)X\36062z\311~\310\002\276\b\203"
+	.string	"\344\320\023i\350\346\207!8\316"
+	.string	"/\324\354\020"
+	.string	"\t\364A\033\272\371\001\210\216\323\347\177\252|\220"
+	.string	"\276\207C7;"
+	.ascii	"\250\343d\277\255+\346\261\207n~X\357\275S\354\367\222\244\035"
+	.ascii	"\244\232\217?\275\357\251\336+\310\372\276\357\365\273\330\234"
+	.ascii	"\372\336\367\316\360\306\024\363\024\264\372S\377a\212Y\206\274"
+	.ascii	"\267tk\351f\210\325\330Z\232)\243\215\314\"Fx\033\325\3778O'"
+	.ascii	"d\210?\354\nv\\\323\365k\221\372\364\273\331k]\021oI|\002\326"
+	.ascii	"s\222L\037\351\233qi\251O\232S&\316\2316a\236g\311\304\311\003"
+	.ascii	"}3\266R\321\347\242\302&\314\36303\211fZ\255\367\206M\241\377"
+	.ascii	"\225L\203T\343\356\002#\330lF\222p\313P;\355\271\3764b=\374\033"
+	.ascii	"|\214\345\244\004#K+\210T\004T!\250\302\312\253\005\260'\253"
+	.ascii	"\271\272<\234X\221\205e\005D\301R\350R\341ee\002\210e\024\344"
+	.ascii	"\002\302\310\252\332r\301\005\364\240\265\325\025\364\272\nJ"
+	.ascii	"\021\264\252b\241\345\205\265\362UT\226\212\253\337\212,+\255"
+	.ascii	"\337\025W\360\027E\304[,\200\\\277\256\255-\256_\253\274\375"
+	.ascii	"D\226\275f9\006q\332\321x\260:\337\233qkT}I\236oE9g1FU\004\337"
+	.ascii	"\313\366\031y&\213r\316\340\237^\f\r\210\234\341\234F\357\275"
+	.ascii	"wev\220\335\332\221\222\215K\357\315\330\315\323KQ.\235Z\351"
+	.ascii	"<\343\212r(\267\227\232\340\305\272\331\2765\317/E\271\224\352"
+	.ascii	"\031E\237\036\301\2131w\277P\241\036\302/I\242\001\253s#\013"
+	.ascii	"\316\rx\002\217\364I\257\364L\337\344$D&x\247\003\337\204\341"
+	.ascii	"\300\177%\357\234K\317\244a\351\277\222xH5\364\225\276\213y\006"
+	.ascii	">i\203\001d\201G\252*\360_\311<\347\321\0238\372\257\344\023"
+	.ascii	"i\364\003^=\313{2\205R\214\236\350\236wdi\035\200\222\250Q@\346"
+	.ascii	"\220R\206DDD&hA\322\214\001\320\002\2211\3426\021@Ih\252F\241"
+	.ascii	"\n\313\030\262>c\022\322\177\222\037\0373\350Y\234>=\221\007"
+	.ascii	"\320\274\021\022C49\247\336+ (q0\\\013\243\377Ul\353\322\302"
+	.ascii	":}++\002\330A7\362\247\234\254\314O2\335m\"\271\212@Ri\252\265"
+	.ascii	"\205\035\320z\243\006\331\356\252f\366\n7\255\301F\235t<\320"
+	.ascii	"@\326\006\202\254\341S\031I\027Q\245\226\004\210\222\020\211"
+	.ascii	"5\265\2538\023\2179\007\375\003P\"\325\013ifE\323\021Up\235B"
+	.ascii	"\022\372\007\210\242GW\220\220(\002(\t\254\246\244\206\365t\371"
+	.ascii	"\\Z\273\334\232\320\002\361b\304\257\201\211M\240\360\322\363"
+	.ascii	"!@S@?\235\243\017\356Q\270\243\t\352\232\310\006\357\031\313"
+	.ascii	"w\020\036\317\206P\303\234\241Gd\213.\002\352\314\340\230\360"
+	.ascii	"rL/,\263\f\032r\361\310y\2667\371\207#y2i\204U?\260l\263\246"
+	.ascii	"\031\b\206?H\205\"bG\307\316\322\273 \224C\231\351\303\024\361"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cliServoMix.262.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`t\037\005\222"
+	.string	":\357\2505J \016\323\032\003\303\020\347z\303\371\241\226;B\373\375c\255R0\3000\210`i\020k\262Q\037(\323\b23\001g\314p\351u\302N\013P\021\235:\257\307\334\353"
+	.ascii	"\002\200\371\264\277\214B\200\252*\333\007Y\344.!2\245\224\002"
+	.ascii	"Q\003\002\003H\0034\254\177T\336\367M\201>n@V\3765\337\210\275"
+	.ascii	"Y%\333hEg\246\325}l,#\243=k\333k> 0\242`\257\213\r\242m\323\202"
+	.ascii	"\006\210\373\232\275\275c\3107B\312T\365\031\356<V\246`\225\202"
+	.ascii	"\307J3\033\374\274\202o[\261X\237\030\266\320\352;VQwW\207[\f"
+	.ascii	"w\226\225v?\234]o\257U\371&\314\260\255\316\373\276\255\350\240"
+	.ascii	"\305\360\227\305\r\362\007-\206\215]q\207gm>\r\327r\215e\345"
+	.ascii	"\\\323A\273\016\004'\317\373r\021)3\225l\243\277=t\024:\306\205"
+	.ascii	"\251Y\205\214H\2765\030h\207a\275~\307\336\006sc\035b\370\276"
+	.ascii	"\257S\033\371)\331F\247\333\316\334m\355\006m/@\032\350}\321"
+	.ascii	"\276\224y\3377\021\354!\331F~\353\241c\033\223-tl#\2249\216\221"
+	.ascii	"\327\273%e\r\"\225\253\363\276o\3247\341\346O&\221\220\226\315"
+	.ascii	"\244$\206\346\220\273\223\223\355\2765G\361@\233\351x\216\345"
+	.ascii	"8\216\3418\f\203\341\267\027.Z\260X\241\"\005\025\212)\251\023"
+	.ascii	"&J\220\030\021\005%\342\311\251)\004\b\246\017K\036:p\330\340"
+	.ascii	"\324\220\001\203R\022\322\221Q\021\321\320\005\241 \240\037\237"
+	.ascii	"&s\251\354\341I\"\217F\367\035\312\335c\335j\246\233\033\322"
+	.ascii	",\267\3458\270\226\"S\023\2449\f\3215:u\006Ct\215\2069\277\021"
+	.ascii	"]\243`\376b\321](z\213;\316\302\216\257h\301U$z\nD\247\252\343"
+	.ascii	"(\n}*\216K\245"
+	.string	"\340'\\\244\263\277\262%8nB\351\032\245nQ\360\022$\b\337\370\b\027\3515dJ\013V\007]\252DC\274\336\252\361\250\300\206\332v\362\016Y\0249\327\261\300\026!\244\237\260\355:\031\311\216Ti\nq\035K\323 \004\253}lU>g\272\363\017\356\320\232%p\232\316\376\312\232\255\232\365%\367\247\360\212\231\250\352\230\265f\253\332\271\007\301\252\037[\225\214w@\252\r\251\363\327\034\\\023^u\216\264`u\214\273L\224\266i\266\252\030\337\340\016=a\253\322\202U\254\333\244gw\327|_\334Y\327\032\370:y\307ZG\316u\254\2563\264`\365O\273\346\030\334Z\251MP\213'!a0\031\353\322H\\\372\310uV\267\270N\266*\0277\022l\2364\253\0329\327\261.]\244m\243\365\257\312u\314\255\211\\\367z\205\253\005\253S\334\025\200c\024\0330\212\017I\351\013\200mCM\354MJ\013\271'L"
+	.string	"\263k\301\252\027W\211e\301J\363A\361 wh\310\224i\013V\001\335&C3+4\366\211\003)\303\246\206m\210L\306\216\364\017\017U\205i\025\262\366q\302V-\301\233.e\325\"\275+c\272,\334\264\250\265`\365\314\3750t{\235\207\304\227\327\261#\255\314k\367\3105*\206g\304{\004\253j\330\336\300V-\342<.RH\365\004\245kT\314\245\222SX\244\263ROn`2f\326\310\316v\r\2650\3036\304\353\230Y\037[\260JDi\375r\343\205\353\022\261v]\027c\330<iZ\275\334\276r\004Mc\333\251\326.\177\241v$\214\367}\331\247\326\261f"
+	.string	"\232\331x\310\314X\346#(\001\035\366\336`\306w\277k\237vJ0\315\023eb7\330\177\234\334\032\034\241\224\223"
+	.ascii	"%\002\366\215\327B~W=m\027\325\213\205L\217\353\272\020\250\021"
+	.ascii	"$\311\257\366r\203\302\\\317\244P\242\227\310\363i\314C\210\354"
+	.ascii	"\352\033\023\217\036\3262\236\352W8\302.Ol%\031\260\303\344\247"
+	.ascii	"\365\217\243\214\357\352\013a\303X\370:\213\372\"s\37782CKp\260"
+	.ascii	"\037<hqv\316\246\272\f\263\007.\205*q\217\224\330q/\377\202."
+	.ascii	"\201\246A\233xO\241j\3076N99\224\361\377\235m\227K\335\035\334"
+	.ascii	"\226\356{\232\230%A69\0336\2479:u\217q.\253c\222\031.:\276\305"
+	.ascii	"P)\32051\327.\332/4\303\274\343\247\261\377\223\311\215\r\265"
+	.ascii	"rl1}\007\212%\t\315\222\374z2"
+	.string	"\265\021\272\005\332\305{\352\177a\214\214\n\242\341\227\212\271\271\254\361\323\230y\203sop\344\206~96\231\256S\365qN\336\227\253\247M\206\371\251Y\220\361Ek\334\300\211i{\337\227\212N\257@\203;J\033\331\206\225\221\333\352\330\306n\001\216\314\004\030\340=\345 xdI\020\r\245\355d\314\0257\257\227\374|Z\257\345 \300S&w\370\325\323\004\222_\0230\265\221]\227\340q<\225\231\331\251\033\370\357\212\333\302\275\351\362D\356o\340\333N\252\310\345\213<\3448\236\231\201\006\274\247\375\215\355\036\202g5D4\354\372-\346\267h\257(\034\333\372O\343\366\rI\016\205\360\2431w\265\247\035\326f\232\033\254\275:\332[!|\020\344\234\265\001V\217\013\332K\267\004\335\246\031\202\007:Ls\003\355\245\031G;\007\320n\232\255zM`\263\215\376k\256\321{\3154f\264]\263\214\030U?\3160\200\234_"
+	.ascii	"9\273\370qn\001\344\314\342\307y\305\217\263\212\245s\212\245"
+	.ascii	"3U\3575\243X:O\365\231f\251\245\363\211\216k6\261t.\321q\315"
+	.ascii	"$\226\316#\232\316QKg(\037g\021M\347\247\246\263\023\322\271"
+	.ascii	"\251\351\034\242\351\f\242\351\314\264t\376\300t^b:{X:wX:s`:"
+	.ascii	"o`:;\231\316\032\226\316\031\230\316\030\232\316JM\347\244\246"
+	.ascii	"3\322\322\371\310\307\331h\351\\\324t&j:\0175\235/4\235\205\232"
+	.ascii	"\316AMg\240\245\363\017\323\331\207\351\334\\:3\231\316\313\245"
+	.ascii	"\263r\351\334\263t\346Y:'\225\316H\244\363Q\351l\\:\273K\347"
+	.ascii	"_:\273\322\271\233\314\212\016\034\0339\253\330o\337\336!\213"
+	.ascii	"v^\255\021o\255\333t\273\351>\241{Mw`\367_7\232\356\275\3563"
+	.ascii	"\335f\272\355\272\303t\307u\327u\223\271\371\342\230\361\245"
+	.ascii	"`\306g\005\347\202\036\344\317\313\266\271\351\023z\213\306\212"
+	.ascii	"\354\t\225\367-c\246\b\237]\006=jF\f_\254f\303}\245\256p\r\267"
+	.ascii	"\340\337\035\253\032C-+\333\030\370\303}\353\002\037\230G\357"
+	.ascii	"&\300\001\206\340B\267t\364\315\004.\260\313\023E\034\275\006"
+	.ascii	"X9D<*&S\017\237\306\310\316q4\372,8\300\2427\372\247\363\224"
+	.ascii	",\372\033X9\236\023\343\327\201\256\205\340\225\240E4\214\376"
+	.ascii	"\326a\036\007'\215G\361Tv\235UO\342\251^\327D\217\334\232\303"
+	.ascii	"f\350/<\321\277\234\264\314I\374\320{\200sC\227\207\342/\374"
+	.ascii	"\215:E\270-\035^\324\0277H\261&J\3574\204\360@\254\205\322\273"
+	.ascii	"\f\033<\215\2476_\363\270Y\021\245w\032>\340Q\263\n\221\336e"
+	.ascii	"p\352\252\247\3528\n\275\214\240\007z\241\377\240\377\020uC\307"
+	.ascii	"\305\321\232\306\003=\216:;\321-]\236\207\201\371\342\354(gQ"
+	.ascii	"\346\236[G;\213\202=\206\360\356\267\204\216\366\347\3554\226"
+	.ascii	"\365.\f>\340t\216\003N\303\356y\347=\375y\020\222<u\325\177\360"
+	.ascii	"\021\324\331\201\333\316\235E\273\nWU\003\003\336}\275\367<\343"
+	.ascii	"38\355>\377\362\334f\240cj#\226\336s\317{\272\001P\342\222@\355"
+	.ascii	"\027\337\227\265\f"
+	.string	"\237\306$\374\224z\353\221\\\210<\254m<\225\251m\343\237K\257\321i\202\301\306\367\326\353P\023\333\236\321F\177\313\225\374\220:\372\310\304\"\017k"
+	.string	"\236\n\245\001x\237\270\271\026\202\234\\\371\222\364il\364;b\357\362\334\366\341`\034S\033\215~F\354[\236[\244\tu\205u\3000\2651\200\247\002\360\035},51\026\002\370f\343Y\240X4\f6\027\247\327o\271H\237\346\3119\256,Ga\355\363m\002\034a\363\227\357\363H\200R3\3467\277\245\212"
+	.string	"\374S3?I\356\313\316\225g_\003\225\315uMu\033f\013\334\nT\211k\250\342l\3174\3076.\277\343\336x\261\361\312o\301^"
+	.ascii	"+\266(U\004\n\322\025\307\350\323\330\306\367\032_{\002>\003"
+	.ascii	"\223_m\202\266\213\326\353\310\232\231\"\003\234\371\311\346"
+	.ascii	"\351\206\257\201\b\227`\321F\211>\215Q\024\271\320^\217\344\""
+	.ascii	"\344a]\243\331?\2165\376\005=\215+\312P\215o\257\357\241&F\347"
+	.ascii	"\302k|\253\361'P#\030\006\2514`\007\211Yb\345\335\332\206\346"
+	.ascii	"B\2377yn\213\336$\277Z\n\nM<\"Brh\204\200\034\261\376\343\346"
+	.ascii	"\272X\271\263Y\357\210\243\360)\307{\212\365\315\327A\204K\210"
+	.ascii	"h\275\030\216\227WP\0172\311S\205$\235\344W\243\365\224\215\021"
+	.ascii	"I\202h\250$\211\024\240O\233\366\214\357\351w^'\2406-\374:\213"
+	.ascii	"b\221\240\351\375\270\315\031/\365\324\276c\235\"\275k\036\277"
+	.ascii	"\351\251M\337z\216\344\311\302\322\340\0231\371\325D\230\236"
+	.ascii	"-@\251~\255\243\365\372-\256r\236g~.B\267\234R\317\023(E\312"
+	.ascii	"\"Q\301'\371\315\206\374\3437X\362\235_\277\305\035\366\310W"
+	.ascii	"\252Q\367\244\212\317\006\2050uM\027\336zn\006\365zr\"M~5\225"
+	.ascii	")\fJ%\302\023A\251\314M\013\323\357\247\247\217\001O\0045J\017"
+	.ascii	"\353\031O=~\263=Wp\021\240b\311\367\355\242b'\3632\350\020\327"
+	.ascii	"\n%;\222\035\333x|\305\272\275-x\\\276\350\276\357\373.\215\037"
+	.ascii	"\354t\356\341\234\345\354tj-\361\034y\307\322\363\216%\036<F"
+	.ascii	"\326r\276\322\312\272\342\340*+\311ZK\316\035W;r`\r\320\3034"
+	.ascii	"\b\250*\3009\303j\200\252\005\n\260b\362\216\034X\030\030\331"
+	.ascii	"\307\225\326U\326\221-\200\322\212\362aA\005<0\240 \211\333\203"
+	.ascii	"\253\035=\254\2608\310\272\322\352\271\322\221\365\003+\001\037"
+	.ascii	"?4\350\301C\231\345C\203+\016rh!\263|h\360<Z\253\202\254\034"
+	.ascii	"\356\005:\256,\320a\354q\205\301_\365\340\201\301\216\ft Y\007"
+	.ascii	"\024\017\ftD\365\340\221#\203(\035YZQPC\214\245\301UV\224\017"
+	.ascii	",\254\254(\345\033W?\032\303\340\372\350\221\337\242U\033Hn\243"
+	.ascii	"\025R\003\204\272nl\0039\333\312\266h\264qF\0233`d\f>\032\002"
+	.ascii	"J\203\204M\334\2640\252\274\222\303\302$%\244x\030\205/\254<"
+	.ascii	"\022\3038G\214P\375\213\255\013,O\004N\nf$L\275\213/\302\"\t"
+	.ascii	"l\221\345E\030\204SFv\342[<R\030\222=\026[\336\372\354\242\354"
+	.ascii	"\312\266A\241:\244\304\263\370\2427H\356V\270\275\230\2260\b"
+	.ascii	"u\304\257\370$,\022:\251\242\212/\037\366\004\243\354\312\266"
+	.ascii	"\275a~\316=\230\f\343\220\222\377zi\325\021\352U|\206\260#\213"
+	.ascii	"R\305\243\030\237\306)\272\260]U\2127Q\226\315\242B\212\277\201"
+	.ascii	"\335:\027\214Oc\252\237\372\277\302\375uy\242w\275\240\312\342"
+	.ascii	"\202\271\240zfW\326\312G\217T\177\003{\002\342qN\013;=\365\310"
+	.ascii	"\270\254\025f\033\026S\357s\230]\373-c\263\336\033\313\262T\316"
+	.ascii	"\334\212\246\254X<\261\006\007\b\365\247\342\3043\363\262P\024"
+	.ascii	"\3356\236\340;\263\024\334\206\247+\013\245\317\252P\035)\361"
+	.ascii	"$\320\262M\240J\374\r\254\233-\336&\210\"\333#\036\331&\333\304"
+	.ascii	"E\204\233\032\361\314+\331%bF &\253\260\221\3629\r\365\310\303"
+	.ascii	"\354\022\376a3w\002\352y\256\330-B\375\rl\233-\255\224\205\216"
+	.ascii	"\t\237\316q\024\001\301\213xe\230\221E\245A\b\376\0066\260I\213"
+	.ascii	"_\211\023\332\n\260o\233%I\217`\226DT\2147\361\324\256B\026E"
+	.string	"z\027\305\364QOQ\357\364OI\023\357\364=\206\375\203\033A6Ez\007\325\343\033\013\031\024\351\235\210\007\336\352\251\275m\03672)\322;\250\013D8u\214\020 \236\351C c<\b\253gz\034X4l\326\200E\031z\\\367x\367c\002\370!\321\352C\214\277\340#\300\242\371)rZ\250\301\336>\317\020\r\016:\341s\3134\370\300\367\266{\004<,T\020\r\245\214\250\211\370<\272(gn\335w\347\355\t\210\373\276\327\027\206a|\221#p\363T\201h\360)\307\344\213\266\353\267\336\211\220I\226\023p#4-\255\321\372i\003=\374\206_2\353\360\0368|\2077JAZ\204\303\037\331\001j\375\376\322lx+2D\274(\351\334\205p~\037\337^O\347hx\f\357|#=iY\206\327p\364O\235\341\215\356|\331\321\373\301\354\"\243%\r\363\001\236w\006\303w\031,\335\026/\\\276x\264\256"
+	.string	"\242Lg\275\261\213L\026\2707R9\246Oc%\302\244Gz\245oiY\234\244\3579\375\3001\353\221\336\265\223\342E=\rZ} \031%\353\225jf[j\221\244)O\002\202\203\250\362\370\034\316\242\244s\b\315\310\310,H\2224\006\342\n\020\006Da \247\330\003\022@\205=J)#\231\221(i\rB\" \\_\264\177m"
+	.string	"\232`&$<\347\250\213\007uP;f\024\024\337\304\277\013\235\327\260\255\026\313"
+	.string	"\323\255\226\3232y$4m'(N\245Cm+r}\305|\037\321\331\260\250\"0_\336'\022\366\261j\020\201OJ\367\004\f\033\215\037\226\037t\034\037\256\005\377Q4A\302\203\326\211\002.\217W\376p\260\242\223o\376FJ%C\216K\246\223\t\305\006\321\202\\\232\304\343\233\333\366_N\004\001d\242\360\337\027\2438\345t\022\262\206\344\221p\231\"\343\215q\270n\360\036\037\323\036\216\211\021\255C\t[\233\302_\021S\373y\"n\020y\026,3\\\003\016Q\226B\335\200X\217ai\223HW<\350\311%d\211\265Q\202E\0229\362G\374\372\332\005-\023\224\031BY\366\315\016\256\362X\244\374\200\274\r\023)B7%\212\026\213\350\264\3614\327\245\373k;\032\0019LG\332\003\276"
+	.string	"?Ux\030\027\377\272\226\007\226!S/\264>#>\270\301P\331jg$\205"
+	.string	"\003r\223\211\203\252\204\316\2341\033c\f\311\351\375\277\363\241\205\f\352G\222"
+	.string	"R\213;\374\357A$5\241\n\252(\200\202\r\271\341\200$\320\244\360\355h\fp ?r\356\216v6\r\360>\2664N \033\207c\03684\240\233\247B\257\340M< O\234\002\251f`\271l4Y\306Qi\270\200f\316[i\0027\271/\317\341\304$(\305Ip\003\013e?\376\261w\267\274(\002)\210\003\250!"
+	.string	"\013nL\250\370\332\250@\366\031=J\360|S\212R\037"
+	.ascii	":|\234\365]\334}6]\257\233\367\255\353\3066\256\341\322w\216"
+	.ascii	"\347-\202\336\033KY\214}H\252\307\022\336\367c\201Y\346\202t"
+	.ascii	"\2165\265\200\246h\"aR\364N\2364\021\220\004Y\020\273\354\350"
+	.ascii	"\013\022\016,n#&\203N\255S\207\226\034\317n\351M\321m\203%"
+	.string	"\\\226\316b?\255\005\305o\177\364\3503\221E*&\261\226\267\261\351\363@)\2448Y\327\017\342\347\177\024\251\272\227\365y\263\223\215\237\350\316\254\256mA+\202\242#\366\025\033\221\211]\360\327Cg\024\3715\201M\032DR\300d!H\321B\2243\315\227\305C/\021\027\216\004\336;\1779c\356=\021\204\313\037\313\203R\026\306)A\365\354G\201,\355\3075=&\303\006!\323\343\001\253\\v\033e$\017\026+|\032G\034\037L\372\331\031KF\345\035\f\323\357\354 \017\224\340\033\3542\206:\"C\342Vd\035@\212\213'+O\016\333,\177\026\024\025eNU<\332\\\251g\222\215\022\241*x\201\253rz\341\354\250\034\330\320:_"
+	.string	"\344\263\001;\233\210\263\006\020\202\2556\374\253\223v\205u\026\242\224\207o\235\241D_\321\302\275\347c\"\265\273\247\224\304\243\374)1e\0248\030\375\033\274\274\b\322K\313/,\321Z\204\235 \352\355\027\366-\315\245\275\267\017D\030\"\037\200b\326\345\032\350\243~\\\036\346ae\021\224\325qj\013\037&\324\177\325m?\264\305\216e\"*t[D\241\311\317A\002f\3440\001D\342D\346\233\024zC\365\245"
+	.ascii	"\001W\306E\037\245\0321\t=\037\351x\325\312\023\305\223\037\220"
+	.ascii	"\373a,@8\242\202CL\301\026\021)J\230\002+b\005\024\224\356\256"
+	.ascii	"\200C\241\341\242Fl\r\035PT\007SN\2438\2752\273H\300k\211!V\325"
+	.ascii	"\360\rW\031\203\217\304\030/\274\375\2621\370\306\265\312^K{"
+	.ascii	"~/\214\331x\177\002\334A K\203r\231\300\212\37469\275\b(\215"
+	.ascii	"\217)\3133\374\024\3422u\245\233\n\247\205M\336\206\026\364@"
+	.ascii	"*\340c\271\340\346{qJ\221\246\035*r|\362\n\002t\202k\227?.\310"
+	.ascii	"ucC_\0312\366\246\f[\274~(\3356\367}\345\026\340E\347\321\373"
+	.ascii	"\352\331\202X;\272!\234\017\013\363\254_A\213\323\354,\321\323"
+	.ascii	"\321\204[7\250\177\256vkA\352\363T\177v~\221\177\352\215t\307"
+	.ascii	"Ej\366\020YT\213\b\f\2328\310S\313A\"k\241^V\230\003\267`\213"
+	.ascii	"\231\273\2216N\364\215f\372\311M\006\213\350\023:\220\302\025"
+	.ascii	"\034)\301\035\364\251\026e\230j\3240\374\365\250@\031\306\022"
+	.ascii	"\f\244\341\240\340\366P\276\3762d\331f\227\201\364\213\252\252"
+	.ascii	"\345\362\357\030D\354\342G\215\261:\310\022\251\312\f\033\257"
+	.ascii	"\033\317)#\366\204\342\300f\255\354a\266\344Z8\001\334\206\220"
+	.ascii	"cG\213\253\035\001"
+	.text
+	.section	.gnu.lto_cliWriteBytes.263.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`N\001u\016"
+	.string	"&\234bC\020\255(\035s\005\211\235\t\n\313.\207\264\002\327*\324\177\356\204d\272Y\256\035\030LL+\362\324\216|\032_k\361\365\325\367\016\372\356&"
+	.string	""
+	.string	"\020D\b9}\361.\202\025HA\231\272-6B\366\2262\245O"
+	.string	"K"
+	.string	"Q"
+	.ascii	"\366\f\201\323\226\020H\250)Y\251\331\335MS\254}\337\367\035"
+	.ascii	"z7L\322#\324$\371\005\272\017\305\225\036\241vR]\b\300\235\340"
+	.ascii	"F\214\006\366\3273\305\231\022fX]\377\272\002\231\356\005\305"
+	.ascii	"\255\236Z\202"
+	.string	"\335u\2428\223;\273m\221m\003\366O\002\256\033\276uk\246S\323\007\200\361\231X\275k\331U}(6&\3020\330~\307vz\357@\272\313!\\\261Ka\306ew5\234\261y\274\200O\373\033\316\201\364V\310\005\354\262D\270\354z\032\306\330<\332\273E\366\270\371\200\354\321\244\320\236C\355\250\306\322\235 99pU\216j2\035\t\022\r\246\374\254e\252\r2\312\243|1\242%_S\377\241$\305W\"@\330X\360C\262\307+\207\245\033\221\232 \222\237zx9q\252(\266W\312\215\n1\032+\313\356p\356\372\265\267\376\354\001\242\217\021\350\023C\034\035\035#\006\231?\036\217\006\237\355\303c\201\203\355\023\002\331<\026\006=\340\bm\"\020(\264u\274\275\262\314I\371bD\324\024\025\305&*0\332\321\024j\352\257_\005S\001\241\0345\314LUS\266\235q\250\221\325R\342\0053\2221\270\273\033\033"
+	.string	"\357b\310\214\266s9@kz\257\b8\035\233V\240a6\354\317\314U\200\312\203\264\302\302<\n\232h\221\003q\347&\300\021\217\016\304"
+	.ascii	"W\244\251)\301\275\270,\262\024S\252\353\200\"b\272\346\023"
+	.text
+	.section	.gnu.lto_cliSdInfo.264.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\320\001\245\020"
+	.string	"\226\035nG\360\2228c0\323\r\233\243nJ\352\360\374\272\021\323\030\232\245\305cV\217\fN5Q0mv\031\325]\355\376\025 x\375;\350?\302$E\2164:\b|dP\034\032~K9y{,\013n\003\255vwo)S\n["
+	.string	"R"
+	.string	"_"
+	.string	"\267l\340\372\300j\001\344\336\013Z\022O\375\363:n\2635\345s\320\362\337U,\367\356z\315t\233\001\230K\220\016\312\332@4R\026\207\"\202\236u\023]-=`TXn7\005\257\032+\035t\265}nF\3508\315+\b\324\254\325#\271\367\272\266P\225\033\300m\237\266'\330\307\021>\315\037\213\211HW\266\264ie\2651\366m\255V\253\331\302\354Z\315\325j\373\331_k\365=\bf5+\227\231qoJm\310M9\033\023\035\333\257\366S\\\226\372\314\303\003\334\013\223\305\270\227\306\300\007\276s\246\375\323\235\373.\240;\347\224\315\243"
+	.ascii	"J\021P\334\360\221\206\3508[aB\234}\313\213i\313\3330e08\033"
+	.ascii	"\303\3426\264'R\263\312\370q\363\262\271\020\th\370N\007\343"
+	.ascii	"\213\330\314K\264^\251u\207\356\026\303\212\034\253*\304\234"
+	.ascii	"j\223L\365\255\333\333\304\\R\323\226\366\352iWq\362\310\334"
+	.ascii	"{\276u\362\235\013\022\234\2637p\250o\005\026\211\2431\224\001"
+	.ascii	"dr\202\"C\250\022\217E\"\212\024O\245\021$\226L\022D\fz \"C!"
+	.ascii	"\bB\tG,\215#\021)\364\034\216\214\243\020,\215!\022\030\222'"
+	.ascii	"p\344c\223\211H\202(\223\211\004;\264\373\355Z\230IT\326\334"
+	.ascii	"\356\275\367\033Pm\n\025\254w\250\312\024\257\306\302\205\357"
+	.ascii	"\f* \340\002\2211\253\003\2771\004\306C\220p\233/\247\025[\223"
+	.ascii	"\n\021n\271\334XF\310+\301\253\247\233\2727S;\251fb\023_\306"
+	.ascii	"\324\255+\001k\327\341L\342\262\315\341(\350i\310\262\020\314"
+	.ascii	"\270Y\033Vs\035-vDA{$|\353\254\336jYG\307\006\345\345\271\306"
+	.ascii	"\036"
+	.text
+	.section	.gnu.lto_cliFlashInfo.265.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`h\006\325%"
+	.string	"jE\030\017BpjQ\007\251\253~\277"
+	.string	"\217\246HX\035\377\277Y\036GD\313yLKg\257\025K$=D\t\356{r&\313-\021\034E\031\210\351\360\300\260#\344\0036\265\006ak\302\022\371\360\267-\267\334)\245\024\333"
+	.string	"\314"
+	.string	"\343"
+	.ascii	"]27s\223\341.S\226\243\bW1\311\210\263\305\270\311\330\326\225"
+	.ascii	"%P@{\314F\337\341\2752\026\221x8\273v\217\3510\266\201]\t*\246"
+	.ascii	"\030\2209\226.\332m\242\241\242\225@\367\"\033te\007\314\355"
+	.ascii	"\314-\246\275\320\376\322\321L\367B)Ss/\362\001'8\2732\262of"
+	.ascii	"\327\263\233\314\256\2142\377y\342q\205\024\212>z\214%\272\367"
+	.ascii	"B}\024\266]\"\233\255\243}Z\263\226\357(\267\345\020\326\245"
+	.ascii	"1\214\236\224(\354\263<\321\210l\225\026\260\334f)\266Yf\360"
+	.ascii	"\372b\024B\034\226\017F\006N\223\365\001-D\266\274juYJ\030b\004"
+	.ascii	"P\022\221G\211\024\310\017\261\313\264\003!f\3717YWc\227YJ,\266"
+	.ascii	"[\016\367^\366\224X\244\271\326\314\214\205\231\3470W6\001l\377"
+	.ascii	"\214\3527+\354\337\370|\261\3506;\363{\253\374\332\242\327\224"
+	.ascii	"\337\201\374\377\333\370\005Q\217F.\332\354"
+	.string	"\205\177\27312\303\3504\273\363\336\254\n\334hP1Rg\225\256\334Wf\327~{\344\f\031E_;<\215\221\234YF\317;=\360e\237\243V\022\353\205\314H\241?W\2345\206\222\374P\230\033\331\314`A\2275\353\032\254\371@\2175\343\252s\201\352L\240:?Yg'\353<\300t\276Yg\001\326\271\311t\016P\235\231\216\234\227j\316J\247s\222uF2\235\001Xg\233\351|d\235k\326\3714\235mu6\255s5\235K\353\374\246\263W\347~\240\003\024\344H\1771\273wH\032\243\233\254l\256tY\367X7\262\033,\203\216t\222Yv\316\347\342\b\251\271\340\353\024o9\215{ \326\217a}\262|Q\227\367\336k\237k\3017Y\237h?\272\314\206K\260<\215qn{\244_\372\332\267\231\336\203r9\355A\243\234\303\266\262\365Bn\340JTP+\336\351R\322+]\351;h\226\244\3577"
+	.string	"\036iK\243\001\370\316\303\347\353\350m\337i\272trE\035\224\013\352\345\350\355\2423o\272\374\243\034S'f\016S\367/v\226\206\300k\317\214\206A\275\274S\335\347p_{\233\261\013\253\346\274\315\364Y\007\003R>\234\303n\002B\204w\312\335\347\330\225\314z!\333\321*\204\250\264a\342\276\3134\002\2613@a|\262|\321#\357\025>\343\274\377\277\276\371\347\267X\307!q\333s\357\260\323\022\347P\205\202\023)\274S./\222\027\006l\245\323\300\303\321\213\232\342\001\255\200\271\250\020\006\330J\227\263\322\345\200\272\334\205)].\247\304\027\200\277\035\n\033S\355\202\276`\324\217\207\002\310\223\261\253\301\303\321\213r`\245\323"
+	.string	"\374\371\202R<`.\204\211\032\265\033\274\251\252^\rZ\371\256vTf\225\257\027\354\005\177;\0243\200;\252\030I\274\252\036\325\024\r)\313R\020zTRPU\275\035\r(\251\037\020\n\302\215}5x?\250\240\317\367\203\262!o?\224\243\243\242\344\216\307b\2343}\201C\250\221\233\3269l\257\334\360\205L\340\237\276\300\267\021L\332P\013\026\213&D\300\351\237\276{4\032\360\002\336\351+\236!\226\333\017\370\026t\373\rF\007\335\364\002\276\216\005\370\246o@S\002\374\2153g]\023\234\031E\202*\361N\231\236\301\261N\004\367F\231\230\314h\023\364\211w\312\340;\254o\001m\250q\024\345\034d\310\214\004\"#\244i\322\032\220\002\031\252\223\007\0210\275CN\t\215\335\034^\0177@^\254`g"
+	.ascii	"\334\326\322^\312\032r\253I~\2434\365\270\317\3602\364\202K\252"
+	.ascii	"z\301\327\212\267\027O\340l\207_\006A\314\2018_K\032\340\270"
+	.ascii	"\300\354\034\256\177!M\221\\\226\325b\3059JL\373S\261\003\223"
+	.ascii	"p\321\302\003ti\357}\022[0\254V\020'\267\246\275\326\276\302"
+	.ascii	"\310\364\031\320\267\377\265N\026k\271\033\002\3351Tm\371\330"
+	.ascii	"\360\177\034\001\276\004\321Y\2223\236HM[\032'\005\254\344\f"
+	.ascii	"\343\r(\370\233q\036\203\322\266\237\336He\325\371\313w\250\371"
+	.ascii	"A\316\022\363\027\324\217\002C($\265\342\321\330i\347k\177N\001"
+	.ascii	"i\370\001\326&f\212\257(\254#\321\tS\0016h\013w\242Z\021(sY\b"
+	.ascii	"\235>\031e1\253R\323L\377"
+	.text
+	.section	.gnu.lto_cliFlashErase.266.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\215\t"
+	.string	"\006\221@; \345*\035\340\004}8Qm\224\300\001\035K\315` #\213\214\251\204h\032\306\330\2464M\260\027A\260v\034\305\037\206 \200\240\025p\232D?A\270a\033\216j\t\"\233l\231R."
+	.string	"."
+	.string	"/"
+	.string	" \237~\327\244~~@\b^\343V\227\032\201\330\361\222\tMZ\001\212,u\3305#<\251b:\273kU\205\033\367\274m\006\333\b\266W\0023\326\312\330\276\332w]\344\373\313\342\232]\321\344dwL\260\001\367\351\361\233\355\223\273\300\366\351\317V\031@-\250\300\202\245H\\v\267\223\001#)'\235y\252=A\241W]\036vM\254\305\222\231$h\217\240\312\217\026\016\021e)\332\177\375\252\352c\016<0Vw\225\354j\004"
+	.string	"\260\262\036\321\007\364\020\3620\3668\037\220\327\211>\r\241\316#\225:\316\306#\b\017\251\223\030\215H]f\334w.\244I\343\324\216(\351U\226\013!3\026\351\212\355\322!\021"
+	.ascii	"\357b\310\f\rF\354\020\200j *\354\375\331\374U\256X\227\265\013"
+	.ascii	"\213\270\240#SF.\3266\253)\343.7\325\036\rL\355\001"
+	.text
+	.section	.gnu.lto_formatVtxTableBandFrequency.267.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\226\002\245\025"
+	.string	"\026\252\221J\260\022R:\322\002\026\263\343\311s\032S.\250\325\250,\2757L\243\317\225\013\377\177\003t\224i\222\330&\240\277\225\315\032I\366\240\227\271\345k\242\351\027\362s\201\3275\361\022\314\201\272\337\343Bce(q\212qb\367&r'\031|"
+	.string	"u"
+	.string	"{"
+	.string	"\035\246\272\333e_\306\323\025q\347|\223\317O\272\223\206S\335=\22750\236\236\351*j\373\303C\270\033\b\006HYBO>\272{\257\355]\245\236\216G\251\247<b]eY\226\027{_q\376\234\212<\177\366\277\313h\330\262\"u\266S\321\205+Z\"\321\341D\230\241\220\352\301O\"\035\320\024M\034\235\037<%\241U\222\272\243OW\203\356\336I\352\214\276\365\273\333\263\273\016v\247/\266\311\273\335\303\360\206\302\345\244\335\2227\375#w\372C\016\374V\236K]s\3059\227\353\334Y\347\336\204e\305\206\243kYu\027\225@\372\212R\2258\360\367\235N\336\375\356_\354\203\300\255z\033\365\207~ m\t\273;f<\375nm\377[\221u\361\247\332}<\357\\\217XH:\204\335\034ZNw\301x\232\240\036\245\362\334}\357,jw\332*\321\244\203D\004l\333\223I\371P\2171\241"
+	.string	"\257;wrf\314\311\260\234\036\352?\230\200\034\344n\314\302<\271+9\266\255\310\224\037%\024\344T=4\243\322\336\247\236\310\303\215G\230\3719\024\363[\243\236'?w\002h\226[\371\374\340!`m\375\204\202\334f\311\374\223\201\3231\357j\352\356\"\270T\r\t\257\273a\3660\036u\263W:\335\235\331<y\272\237\325\323\007R=R\360\270\315r\267\027KA\301\201\025\352\302\271\321q\345\330\304d\262\231\013\2601\003L\026\333\301\020\243U"
+	.string	"\260\260\027\032\033\330KF3s\363\202\321r^/*;\303\211\321^:\263\031\355%\322\353s\322Z\315\306\033\307\301\324\343\352\306@\313#v\207\210\271\357\377\375D\350Dy\267\001\262\270\2049k\266\2742Q\bW\236K-l\004\315\341\305\356n\221w\225Kx"
+	.string	"P\253\314}H\231\004\016u\032\263\024^\367\355\344\214\215 \341A\246\035W\270+ @\002c\030;;T\222\206\326\2366bk\212[\246Z1\024\227\211\345\370\244"
+	.ascii	"\234bJ\356\212kH'!\360\227Y\033\352@,\321\343W{\016\2555\332"
+	.ascii	"\032<\253\233\263\004Z\236\301\276\342\305\211\371\002uW\023"
+	.ascii	"\321\342\245\005\336\277\264,\005\276\270\271Gd\326\\\271\207"
+	.ascii	"\357\370\317\320&\226PY\244\n\213u<@\"\246\313<\001"
+	.text
+	.section	.gnu.lto_printVtxTableBand.268.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\360\bE2"
+	.string	"\352Wp\023FP\\R:\023)\020\020\024\020\0200\372\274\207U\253\310\342B\031\201\0349\321"
+	.string	"T\202\2135\244\222C\030\202\272(q\305\345."
+	.string	"\020b\004\212\002@\210\317\332\222\207\210\355\r\250\271\177\320\025\355\177+\371\204\220\275\223\f!\001\017\001&\001\237\322\247\372\365\037\322)}\325\206P"
+	.ascii	"\261\274^\357\353O\233\030Ds\347\335b})\347kb/h \366=&rL\372"
+	.ascii	"\276h}\330\321KvG\t[\337\032\322w\255Es\247Z\347t\266\255\\\275"
+	.ascii	"\246\036\007'y.$\254\370MP\f\375\274N<\273\005\231I\377\255?"
+	.ascii	"\257s\307\212)\357\373B5\224{\2661\356\276\335\357\304.U\321"
+	.ascii	"\302\367\205K3\345}\245P\255\344\236E\256W\362:\261n\346\025"
+	.ascii	"fdp\n\332\366<\363\354\274\257T\252\245\027j\317\272\017j\317"
+	.ascii	"\346\036\355~\225\276\217\270yc\3618\024\272\304\226]3n\366\371"
+	.ascii	"\216\201\305\235@\250\332\330\215m/\256A\2644\034\353\0038n\330"
+	.ascii	"j\340cP\002\2175\267\017\331.d\243>IH\232\r\354b\267\023\223"
+	.ascii	"\340\326n\274]\205\302\354Xs1i7\326&7.1>=\303\254\214\257G5\263"
+	.ascii	"\025\371\276\357\247N\234\327 \033{f.&\255m}23\204\355|\307Q"
+	.ascii	"\2652\214\203\022\336\367m\fU[{\373\274\273\003\273;\255\333"
+	.ascii	"\255\nVGsk\026\316\311\003\306m\t\225\315rFG\360j\2549\256\235"
+	.ascii	"\236\363\022\017\b?\343\334\r\"\004>4g\b9\314\362X\367\267hI"
+	.ascii	"2\310B\247\305\204s\233\007\375\225\257C\273\273)\344V\222\257"
+	.ascii	"2\367\276\316\007W\377S\272\357\353tp\266_\245yD\353N\252?\316"
+	.ascii	">\177\372\013S\246N\360\316D\231A\206\003\037\3009\243\313G\321"
+	.ascii	"\032\310C=\304\204\2213&\215\023\337\351\226\216\341,\347\247"
+	.ascii	"\343\016O\347\270\356Gy'\210z\337\373\251\351\322\037\301\233"
+	.ascii	"\374\007\316\344g\272\336\257t'\277\201$$R\201#\243\353\275\t"
+	.ascii	"d\334E\0317Q\020\367P\306=\300\305-\200\210[(\343\0160\304\035"
+	.ascii	"\224q\003\335\357\r \343\376qq\373\020q\0373n\343\020w\361{o"
+	.ascii	"b\306=lq\0133nW\210;(\304\335\272\270Y\027\367\232q\347 n\034"
+	.ascii	"\304\375\005S\\\312\306\344\265\005\3463\322\367E`\236\027\f"
+	.ascii	"K\005r\277\277\357\217\362\357}\355~w>y\2306\375CBM\302\306|"
+	.ascii	"\314\335\315\273\t\370\320\247\314\234\263%g\352}\3258y\307L"
+	.ascii	"\304\006:\243\230\2159\363=\367\220a\n\177c\301\201[\314\301"
+	.ascii	"\030\323*\200vFX)\0173\202\334\235A\003>\264)\203\310q\226\307"
+	.ascii	"Z\230\207\371\317=\302\374'\0331\273\253\220i\225\2623O\366\024"
+	.ascii	"\241\222\f\243r\023\001\344\244\034"
+	.string	"\355a\201\334+\361(#\345h\377\265In\376\257o\226\353S\3777*r\274\bO\346\275\272H\271\300\323\223rT.B\003\370\345\314\255\f\007b*\303,\207\177\320\301\321\020\346\270\016\3466\037n\315\206w\231S3u+si\250\366\252\301\374.>\352^\335 uf\352\251\332\341f\250\220\332|\273i\037\022j~\202\006\350\347f\271\306\254\323O\275\320\307\333\215\347\264u:\200\034\355\2255\312\177\263\361|\322\236\314\217r\264O\\\312\273\213\2669\256\317\346\r\3559]\373\314\366K\336Z<\247\371g\266F9\312\3465/\361\304T\235/\214U\20496\237\017\r\365K\325\201j\267\207{\t\315\\\272ZB2\227\220XKH\244\222KD\022,\005\330\t\".eWWr\304U\260\002\223+\031\366\2454f\205\211\370R.\263\202K0*\255\256-\254\244r\304\220+,\231\245\3042jmeuyQ"
+	.ascii	"\353R.\227aWF\254\256\244\210\225\0043\271\301D\2110,\267\257"
+	.ascii	"\242\266\270\256\244\272\266\222%\244\256\226L\251(\241\3662"
+	.ascii	"\241\\J\201yy-\245\210\322\367k\221\350\226yc\361\234\342\223"
+	.ascii	"92G?\375i\300\240\203Vl\312\275b\245L\200@>\302\240\363\006\360"
+	.ascii	"\rY.k&\234 \017\310C\231\250(\b2\027\345\023e\2503\2672\314\342"
+	.ascii	"kE\362W\252\370\251\354\033\312Ez\2403\004\344\001\031\n\233"
+	.ascii	"U=\017vZ\275\315\234\200\034\2143\275\022 \013%\310\037\360\030"
+	.ascii	"~\247\276W\r\244\212 \224\211\370\202r\200\214\331\350\241\013"
+	.ascii	"\312\347\373j\204\214\036\"nK\354\310p\240q=\"e\"\023~\312@\271"
+	.ascii	"\217\247Y\204\215\221'\207[\335\373\236\035\3324\342\236\241"
+	.ascii	"8p\326\315\b\2204\225\340C{}\331\362X?\235)\003\345\267O\376"
+	.ascii	"\311\267S\205\233\314\325\261\242\023\200\250\250a(\006\221s"
+	.ascii	"dDDDd4M\322\030p\002\021)"
+	.string	"+\353\0210%e\216\221\266\031\346,qV\246|\007\216\276\034\310\273O\353\200y\326\357\231\342\303\250\334\325>\364\016\353\026\277\241\207D\364=\214\327%%\204\231d-\272\314ErM\306\373\3309!Kb\215\271\272\204\300E\237>~\220\277?\244<g\f/\006\231BX\f\342\260)\226X\242\346\335\347\364S`T\233J\320)s\323\352nJ\324\253Zs\336V;\225\312\273e\234y|^\223\313m\200\300\336\331\317-}\351\226\270\342\313\330l\240\025\370\347\274\024\230\f\307\023\354\354\242\203As\035\235\264\2302\301\001\t+\013J\f@\300m\236\0345oq\216\271\b\031\212\363G\302E\347\247\371Am^\213\226_\225\332pK\267[\357\366\266\260\315\001\230\016\016\320\243\t\310\210$$\217\345\216j\b\31178\325\222\204\210\002\006\363d \316\356\353?c\216\030\025\263/\376\357,\257w\227o~\233\022\267\027"
+	.string	"\320\357FA\212;\001\375\325O\f\331\2709*Y\231rX>z\333b\274 \256\033]\246c\337\302H`\300\321\213\315\214\350\353\333!\202\322\206\212\002eTD\355\b\371tu\275\013c\261\214\r\342W\007\001\362\244\243\221\347\033\334\206S\034\013<\244"
+	.ascii	"V\003"
+	.text
+	.section	.gnu.lto_formatVtxTablePowerValues.269.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\217\002\225\025"
+	.string	"\266\352\222I\260\022R:B\355K\361o\001\007-;u\300\357\246OV\206z\347?\242\272\325i\2249.pQ:q\255\252\331C\026\344\366\377\003\337\225\177\007I\336\330Yr)\360\337o\243\256\367\270|\301_n\270\324&\237l\"wJ\001\177"
+	.string	"t"
+	.string	"~"
+	.string	"B 0\320\330]\030\277\214\237-\241\245\274S\317Sv\225\260h\354\356`\\`\374\274\212\257\360\361\217\022\335l\036\024$\245\030\212\302\332\335\271\274;\213\3709^E\374\324\020n\005\203\301\340\303\335\035\312\237\317P\345\217\317;\204\013@\0379\035\320g\330\272\031\215"
+	.ascii	"\240\273\205\257\254\037\325}\227E\272 \031\226@\272\336\367"
+	.ascii	")\002\310\313\351\220.[\rv\3272\247;\272\305\333\346\261\375"
+	.ascii	"\300\226R\001A{\007$u\311\376\213)\353gU\262O\356\364\227\034"
+	.ascii	"\352\037y\357\026Uz\266\244C)\255\242\264\024\245\217\342\022"
+	.ascii	"\244\t\351D\252v\215\202\300\265\232T$\336\373\245>\245\332\267"
+	.ascii	"\377\302\367\365\\\343{\264'\032\222\364\342\267\273\257\361"
+	.ascii	"\363\266\217\3173\211]<\312\347R;_\334\216?\222\234~\273\031"
+	.ascii	"^>\235`\374D ^ETi\177w\026>\207r\215\020e\003\276'\rV7\005r\212"
+	.ascii	"\234\372\251\333\240@\340j\027\367\234\314\210s\340\362\371\251"
+	.ascii	"\363`\001\256rv\254\202|\316-8\005r\250S\037c\250\310\251xdc"
+	.ascii	"\223\337#\276\210\203MKT\365\270\023\362\326!^\245\036g\"H\006"
+	.ascii	"-\352\365\276G\350\001g\f\025\261\311\240*\357\306M\247\272t"
+	.ascii	"\032\321\366\201\313\2401\271\332\335"
+	.string	"\227\017\3431l\374\246O\353\314\344s\237\376L\374\\0\243\nK\210M\006\2361\320\022\362\304fnd\265\035\332H\263\311\251\355\320\304\234\033\235\031l\342\324\304,\304jD\303bd50\327\215L\306\306\005\253\341\270bX<\243\305j\256\234\331\254\346\"\331\355U\311U\263\221\307{<m\260\262i\220w\302\335\017\f.\365\363\236\362\203\232\272d\023 z\242\nD\276\\\324\"\333\036QQ%\212\026;\204d\326\303\335\335P\227D=Q\001= \017\327aE\016`\372\324s\314V\230vm\317\341\260\204\t\017( @\002b\230\273;_\214@4\345\227\251\244\r\332eR9\362\264 dX\\[:\211\201=ly'\353]\326\343\267\366\234\2555\2545xV7o\thy\246}\005\313\353\363\013*\245&b\304\313\r\274ii\f\005\376\271\231Fd\\\234\273\007\333\370yh\203\213PN\3444\213u<"
+	.ascii	"\"\246\313<\001"
+	.text
+	.section	.gnu.lto_printVtxTablePowerValues.270.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`D\0055#"
+	.string	"\n@0\016I\200\030R:\315\262\b8;\001\200\002Axo(i\320\332\360\303u\343\244\"\277q\376\\d\361J\t\177ClY\340:(7\236\331N\257\02689\333^\003\034\317\324{*6B\301u: \365\367\354\253\355\023B\b\221;\311\320"
+	.string	"\301"
+	.string	"\311"
+	.ascii	"-\013\265\253\255\371\201\214\tm\261"
+	.string	"\226m\225\312\346,\343\345\363\2247\260bN_\025\210\204!\037\364\275\220\023:\274\3268\004\310\017\373\224\357e~\220\2035}\211\202om\273e\246\331\266\313\037.\300>\355\241\007r\257&v\352\024QO[\013\224\314cX\231\266]\372xy\034\365)\373\033\365i\327`\366\350\362\254^\247\263\253\232\242}\273N\374\237}\202\212'\023\231,\236%\260U\205\365\025]WP\255\355\222G\024\350K\227,\250\253\342v\\=uq\024\305\2412\203\313.\031\205\"\320zb\365\346\357T\322x\233\275\372\r\275\201\201\266\366*TXh\202\265\036Y?;\001\036T0\356]!\264m\313\027\231\254:\343\316\314>\230\031\311\214\236\t\255\321\301S\376\021\017F\003l\334x\372~\363>>\234e\264\276\216<\335g\217\2550c\244\233\213\177\240/R:n?\241\002h\235\032c\250\200\261\262\305x\3170/\213\267\271\214\310"
+	.string	"C\303M\203\371d\347\036\236\013\371\005\034\355\274\223\363\345\217s\261\377\346D~"
+	.ascii	"g\236y6;\335\305\3165\353\345\034{\031\267^\276\335.\263\354"
+	.ascii	"\345\365fgu\275\234\246\227\321\365r\253\227\257z\371=\fmPV\302"
+	.ascii	"\224L:\313\262e\361L\323NI\217\3448\363G\373\311~\263\243\314"
+	.ascii	"g~\021~\223\311j=\343\262M\342\312\332\264\264\301\243\361\323"
+	.ascii	"8\267\2629"
+	.string	"\231\234\271\211_\3663\3161\203\006M7#\366\212\313R\303\003O[\003\207{$\337\f\254\311\224c\0279\300}\223\257\315\334\341\303=r\247I\304\210\352\"\363\243\b\217\204\022\304\256=\200\315)\005y\305\2737\2356N3\377\204\356\2219\035\024C\252\213\214v\332?:\321\3761K\355Fy0\305@e\031s>\335\347\332\\\254\333\222\362\334\272\224P\216\314\233\317y=\305h\252\353\247\375\366\245|rd\336~\242\272\353)VSy\235\263r\2229\332\266m\2536\177%\0224N\224OT\031\355]\353z\2129\301y\315\323\002\312\332\272HiA\335\347E\2226\327\275\241c\353\005\3324\270\337\337\032\262\004x5%\024\214>v\373jl \236\004\370\243\245m\215@\314EG\022d\333\254d\240\247\004$\036\375J\f\201L\302\244\036\360(\304o\311\304R\t\035\023\300!\244\340\220)\211\225\240t\364#\222"
+	.ascii	"\352\210\210!\206L"
+	.string	"I\352pIC\021Rp\350\007\024\201;\"\376\210\200C\272\242 \021\2220\302\022\022p8$\n\351\214\224~\027\222F\020\207X\026R\020<\022\362!\005\177#|BC%\237\002\034\026&\001\207\276%\241p\350\313-\333\243\253\312bQ:92\357\231\334\246\247\236\366\277h\321\206c\315iF\357M\327\324\364\256\305\223\312\214\227\247\206\342\235\333\223\233\320\263\351\\\277\3539vt\006\270\267\306\365t\207,kA\270^\241 \257\330\276\365\305r\344\n\277b\201\355\237\035\375\021\346\351\245\365\025\344\351>YT\335\265\272sw\232_\005Cj\345\274\242\345\325\266RGf`\003a\250\2218\206\220BDFdDDFa\243\016p\002\021Iu\035\021\2601UE\222d\330\f&\321\222\300\374\353\306R\213\353\227D%\241s\362\355\033\361\252Y\272\373\034i,v\021\025a4\240K\b\2028\021\337\306\353\023'\211m"
+	.ascii	"\224\243\326\200\020\366\223\271\217\350\377\013=\354SLL$\261"
+	.ascii	"\345\201\016\005Cr\023\211\3705\222X\371\237:\024\fK\371\272"
+	.ascii	"\231\240\314UFt\364\203\033\023\227?\350\263\272V\331\326\240"
+	.ascii	"t\2465\035yk\370{\251\017\027\375\td@^88\b\341\005Yn\020z\237"
+	.ascii	"\265n\317\257\035\352\253=\3439\324S\007F/&\306\202>A\0334x\247"
+	.ascii	"i\002\353A\256\013\250\354\024\241\f\"(r\210\360!T\217\374Y\t"
+	.ascii	"]W\306\220\212\214F\r"
+	.text
+	.section	.gnu.lto_formatVtxTablePowerLabels.271.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\244\003-\032"
+	.string	"6r\254I\260\226Q:\344\r\343\334jB\216\376\346Y\221f\3331p\002n\313?\025j\226\353\225!\030#\267\312@\275\313\217a'-C\376j\227\005\254\313:\205\037\342\034\363\325o*\241\017\r\020\372\300\331\311\251\033\206\021K6\331;\245\226"
+	.string	"\213"
+	.string	"\230"
+	.ascii	"\016\312\327\231\321s\372C\356\033\361\230]\244\254\340\256\217"
+	.ascii	"\3064\027b\273\274\372@\371z \017\342\343\033\315\r\001\311x"
+	.ascii	"p\224\205D\221+\273>\230}'@\276\226\227!_i\rW\267\212\305b\361"
+	.ascii	"\243\357n\321\333\313\026YG:o\276\323+\020\225\250\322\355~^"
+	.ascii	"^X\324\002*h\266X\234\034[C)p\270v\270\261\2068\224:\360\223"
+	.ascii	"h'4k\222\321G\340+d\345\254\350vF\247\207z\265\221\003\352v,"
+	.ascii	">[\023v\327S\267Sq\273\3346\020\333\030l\212\"\224g\237$\026"
+	.ascii	"s\230\"\331\257G\335\256\373~\230/\375.\377\335\343\234\246\344"
+	.ascii	"\364$\247/`A\r\023+^\234\262\233\242\230e\255\252T\216G\375\277"
+	.ascii	"\277\351u\216\366\355\037\361\201~\361\243n\257\025\356\213\264"
+	.ascii	"$\235\030\356\372,<\371P~\371y\352\253b\237\303\222Tb\270\273"
+	.ascii	"\024\312\327\333>\276\223_l\344L>o\352\371\342\266\224rT\034"
+	.ascii	"\356\026)x5\204\3625A\275\fi:\355\023\271\222\317\227<5\276V"
+	.ascii	"\210\206\213\340\356\3228T\204/\306\335\335JyJ\356Wu\230\271"
+	.ascii	"\256n\3707\3625\003\025\323\025\312\264dh7\3325)}\360N\034\006"
+	.ascii	"\364t\266M\203\030\223\302PJ\217\343q7!O'=NG\320,z\244\247\001"
+	.ascii	"~\271*\022[\\\363\3013\221\025\350\355\342\256\373P\342. x}\360"
+	.ascii	"T:\003z\273@\327-\361\r\210y\235\017|\314\223\320\310j\210\376"
+	.ascii	"\324\364\210CJy3\322\366\202'\231\001\270\332\335\032\037\311"
+	.ascii	"\245h\376\215W\207\320\231\327\275\372:\344k\004\252\245\037"
+	.ascii	"U\200f\321\366\375\314\236\231\265\235)B\346!\347\306\326S+k"
+	.ascii	"3\036[O\215\344\311\tA\213\325\035\034Y\007\033\0342&\253\355"
+	.ascii	"\314|\260\331\224\2161\270\301\211\301rnlf\260\230m\007\306\200"
+	.ascii	"\200i5\231\r\306C\243\331`/\276=E\362\263tJ\254\013\205>\254"
+	.ascii	"\200h\220{\306\335\031\022\336\364;=fH\244\244<\003\300\"_\224"
+	.ascii	"bM\005\037)\221\013\035\351\354\241\344Dh\022/\201\006\361\250"
+	.ascii	"Ey#}\321C]\303/\007\304\301\b*\320{\360Q\240<\twL\362\311]\364"
+	.ascii	"3\224\260\204&\3212s\346\236\"\r\\i\3300\257s\321\031> p\002"
+	.ascii	"\021\2524\017\257\030B4\305\313\227,\265\270\204\212\034\267"
+	.ascii	"\t\320\3174\372k\303\243(\202\016\320\360\270@\346\356\303j\312"
+	.ascii	"N\302g\243\265\211\254\220h\341y\256\"\264!\343\302$\243\340"
+	.ascii	"\030\005uSd\230\3036\330i\354\021\306\227\264\n\311\035\210\333"
+	.ascii	"\246\374\027\250\271\312\334m\004Fm\\\2701\2468.\340\201\226"
+	.ascii	"\306P\034zN@\223\033\226#\327\362\025\255\333\nKj4<\267\021\225"
+	.ascii	"\031\254`u3\2157\035\306\340*-8\226\344\2167]\357\t"
+	.text
+	.section	.gnu.lto_printVtxTablePowerLabels.272.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`u\005\365#"
+	.string	"\252A|\016I\200\234Q:MC\224\331\252\212\331\026\326\027\225\310\337"
+	.string	"\177Q\006\016\312E\022bf\215\023\202Q\356\372\310\003\253\241\217\305\007\251F\013|\317\026\006%\337\013*\366%\302\262"
+	.string	"\357\246n\210\314\n\270\021/\377'\204\020B\366N2\323"
+	.string	"\306"
+	.string	"\320"
+	.ascii	"\263N\240\200\352_?\033\260\3150\320\037\254W\007\257)3\323h"
+	.ascii	"\263\f\024\315p\r\027\322\317\306\240:\251BB\241\t\222m\200\357"
+	.ascii	"\231\240\020\352\311\301\343\021\003\352\317\276\267\373I\256"
+	.ascii	"\204\352m\212^s\326\212\263\314\2715\320\003\324\2376\363G\316"
+	.ascii	"E\325U\230\305\n+-\004\306,!\022N\316\355\255\333\003@\177\252"
+	.ascii	"\377A\177\342\035\255\336l\337\350\255\272\232\242\247\211\327"
+	.ascii	"[\325O\035$?a\350\242\213%\002\257\036i\311\240\361\324L_\304"
+	.ascii	" S#\nM%6jl\250\270\250\314X\374\211u\263F\\a\332r\316_\376\016"
+	.ascii	"\211\301\213\325\342W\363\247\006\030\231\203\211A\303L\"C\304"
+	.ascii	"\306\223?\032\022\243\306\275\251\203\234s_\226(\343-{w\027\351"
+	.ascii	"\356\026\335gR\367\302#\347\240R\210S\321\2519\007\027\374\354"
+	.ascii	"OY\032qe\031 ?\217\277\374\022\234,W\216b_E\253;\206\273^\304"
+	.ascii	"\221\202\361V\377Jl\256\204\254(\320\037,\004\304\307\2226a\316"
+	.ascii	"\004\257\234\356\026x\361\226\224\034J\3464\326\321}\257\267"
+	.ascii	"Q\321\231\374D\007{\017\t\275\375\003\334\311\017\364&\377\317"
+	.ascii	"\225o\237\036\236\332\235\274i\351\355\035\365\366,\275-[o\257"
+	.ascii	"\352m\365_\3574\275\215\236\267\317\364\266\231\336\306\350\355"
+	.ascii	"\213\336\376\321\0061\3070H\343\r,\326f\030ctr\3309%\310\225"
+	.ascii	"?\330\357\365\177\335\354~\367\243\364\227\312\266b\013\266\231"
+	.ascii	"(K\262aYw\260>\224\236\245h\206\313wS\365\237<\331\001?M\013"
+	.ascii	"\027\356\331\376\027\2307aB\f\354\240{.Wq7S\206{v\b\227\370\302"
+	.ascii	"\013\323\240\252\330\b\315\020\013[\374\271@\030\305\001pw\207"
+	.ascii	"\017\367\254\020\376"
+	.string	"\200\343\n\003\373\304(\276\260\316\211/\264\221b\323\034\222\205\313Q\254\253\216\325\035K\361V\323\316\234Ek\017#\020\241rE\272\017\036\266y\326\360\241|Eb\374!T\256\377\017\345\301C\365m\005\365\3013,$\221\343\315\234sF\227\377\215+Xi\314\376\017m\023\363\340\032\036v'\335\007\027a\001IV\354*K\305\035\273'\336z\230.\2562&\326\321H\307\370Z\307\236{|q7\316\351\236\305\230\t\307\n\f\354\276\226,9\006X6\214H\272\030u\303\336\212\357lw{x\225\\\355#\340\333\345\232p\273^n\212\027e\313\355\232pR'\244L\004\235\310=A\351zSQj\004\337\016\367+\221\243\201\3705\365\246\242\320\236\024S\b(\335\023.'B\266\373\341@\344\236h!t \240x\020\244\240r\275\336\317\2116\302\207\263\020E\342\367\244\266\323\001\335\316\351\006\245\303\221\2709\365|\267\003"
+	.ascii	"\232\027\225\353\335\244x\274\336\255\3157\323T\035c\354!T\336"
+	.ascii	"oy\017\036\036\312?\2438#+\025\302m^ L\243\341Z\261F\216\263"
+	.ascii	"\306\n\253h\242k\264\363\300\326\203w\360\177\f\307\204u\202"
+	.ascii	"\256\f\317\2140\2073f4\314p\332\205-\256X\206\357\030aC\270\230"
+	.ascii	"\204\376\224\245\025?y\323\210\033$\234,$I\254\356\230j\242<"
+	.ascii	"8%\272C\270?\206\302\211\205\304\221\305\225\363\325\331\n\352"
+	.ascii	"U\257@c\250q,\346\2102\004\021\231\021\021\"ij8p\002\0319\263"
+	.ascii	"\016\021\2405eD\222d\330\f&QL\274\275k}>g|.IvB\347\311\027E\304"
+	.ascii	"+\371\362\264gj\203\021\317\325\204\317\n\366\221nc,\330\031"
+	.ascii	"\376W;P&\nh/\371P\365\211\217\020)\217\351\370\326Lb@\313\tZ"
+	.ascii	"\241\305\030\007n\237\267Pn\214\250\t\231\254o9A\236\365\036"
+	.ascii	"\310\343\225:\215\221\201\344u\007M\301w\241\376\006F\312\341"
+	.ascii	"\376w\2346\302I\356\005\240\261\274\323\342\312#yF\307\213\016"
+	.ascii	"@Z1\254\345\326\245\377I\366\320\363\263\235+)\342\fM\"\247\203"
+	.ascii	"\035\221\230@(\374\020\240P\363\256P7\250n\b \002j\023\325\\"
+	.ascii	"f`\364\311\242\222jG\236\267\004:\224\341\342ae\021\322\250\001"
+	.text
+	.section	.gnu.lto_printVtxTable.273.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\334\b=."
+	.string	"\372P\340\021E`\236N\007\373XG\017<\016\035\224\372\325b\245\232\f\212\031\360Fe\200\226o\032\225\246\276{\245\2765r(\364\0278F]\210c3p3\\CB\263~\246\005\271\304i\004{e\252i7\332D\356\235RJ\001\013\001\361"
+	.ascii	"\016\001\255A\204\026\257\275\270\247\335\223\201\262d\201rX"
+	.ascii	"=\365\356H\327uOan*\334vu\234\005\371\005e\315\202uN(kbm\265"
+	.ascii	"\233\216\211\254\264\324\325S\\ \231P\226\354\262\325(\343\346"
+	.ascii	"\307\262\320\005\255\362\007\346\227\203\021\227\026%\245\314"
+	.ascii	"\004\207\366\223\256\206\"\303\350\303~EAKZ[e\350\332\316\334"
+	.ascii	"n\375\326\325p3X\310\262?\242WX\026\232\304Ek\253\310.\336V\323"
+	.ascii	"\016\272\255r\027s\032#\030\313\\z\326\265q~,\313&_\bw`\247\320"
+	.ascii	"\346\325\273\2328\024\256\301\253\246\357]\334tM\224\247\305"
+	.ascii	"\213\f\0253f\023\207~\234\245\365\260\305\224\245\r!)\323\341"
+	.ascii	"\3024\b"
+	.string	"Ff\244\305\224\241\245\022\342\364\335\265]\353\353P\2203g\007\333\256U6'\324\355\357\307\231\263o\263\32500Oq\364\247B{_\224\360\230}\245D;|\3245]\373\230\231\227{\260\002\313\262\354bfg\315:\315\314{\314<\204y\205\n\257~\204'\321#}\365;\375n\261xy /\375\377e\263\021\330\002\372\367/\275\317i\357\274\356\232\376Nf\230\252\257T\255,\373\305\304\035\355r\246X\333Z\355o5<5M\340hx\340\361\306\025\275\3775\031\367\301\033\333\226\370`\263w\346\313\343\260\320\035\374\202N>3\026\013o1\245/6\323\330\277\276\260g2C\231\376k\314-aH\234>~ \314Q\031\240\236\234(4EXj(\335\020ZJ\367\003\245\226\353v\320p\335\311\256kFRp\324S\232\023\030\025! \272\316C\327\031\251:\037\270\316G\325Y\350:\033H\235\013\\g\002\252\363"
+	.string	"\325\331x\235\005\250\316\001\256s\361:\003P\235\203\2563\220\352\374s\235}R\347\236\353\314\243:\357\250\316:\327\231x\235\207\252\263\360:\257\252s\260\345\232\357uVS\347\364:\277\352\354\252s\234^\004_\204\364&\312\227"
+	.ascii	"/ M\200o@\244S\226e\331\225A#}\324\037\331\234sajF/\372\007\017"
+	.ascii	"\341\221:x\360\026\313\360m\327n\244M"
+	.string	"\214\033\353|\346\377\334\0260\263\240_\033U\233\320\264\321\264\275\364\321\2175]w\216&\0175\225\302s\232\022=\202\037\003P<\372b\320\003\370$3A\200\027\350\271\311\200`\302\203\023b\r\213q\324*\317\317\003\215\371\231C\364>\024z\336\347\273\247\351y\376\262\221Ew^\347\233\3024w\276\343\210\300\211h0:/t3\247\247\366\246\376\032\367\333\363K\033\375\245\357\"\317.m\324\271]\334\004?\326M\236`\332\350G\370&\362\304k\243\256\364D?f\245\235\204\371\361!qD\202'~\267\200?\374\244\026\220KS\370\027\007\236\233\224\177|}n\274\022Lxi\230\260lX\213)\3270\252\243V\377\245\226\336b\214l\237\311\301_\277\253\264\2004\2628\203\177\221\340\265i\002't\245<e\204\324\262Z\266XZe-]`\2550Z-\257\256\224(\244\212<e\204\324B.\255L(\267^l\265"
+	.ascii	"\232\272R\232H/hY)\271X,w\262\266<P]UM)\227(\206V\\\312\023\313"
+	.string	"\251\035\252\252\023WX\026\266\256\226YY\\R;)\264\224\034V\250\340\232ZY\252A\225\225T\362\252J\251\")\225\245\225lPd\254\025\313\254\344\026\026VV\222\be\373\201p\277%Ak\243C\247\357\"In\264Qa{i\005I\214\f\237\236S\341}\243!_\236\036\215\367\342\243C=ap>-zG7\202\302\340-\006\365~\307\227E\317\221C\n~\350\300#?)\316\201\2778\362\254\374\021\217\317\355\027\305\2247\347\267a\r\353\262\243V\t\b\375\321\215\320_$yU\376\356\033x*\360\006\276\0138=\201\277lh[\006\274\361\235\3264\007|\313\231\201\343\320}N\243\252\226g\3677L\327\242\277M\327\356l\343c\n\177\215{t\004\243\276\247\371\274q\0274\322\217\265\335S-\230\341\003\200\256\250a@\344\214RfDfDD4M\322\030\320\002\221!\242y\021p\245d\312LA\212\345"
+	.string	"\221\322m\202\t9*\240\316D\226>\231\375H\256\321_\331\002\336\276\361N\2548\307$$Ez\214\002\314\250a`]\334\340\016\021\275)\311vb\025\312\005\n\"2\365\2370n,\221G\221C\227\233\225\275+\343\377\3344\220}o\210 \352@\032\265\017\263\241U\221\327\202Df\002\022\331\017r\277\311R\262\351\243N\232\340T\255\333\004\273Z\375\210\"&\326\207B\366\230\254\017\365M\274\307nR%\335\305\b\263oTS\326h\026\221\314v\266\006\201\215\005yO\357`\027\352\313\336\225\361\377P5\312\2727F\214\241\n\253\0340\335\n7\347\336\217\270\223\005\326\005\334\220\327\"(\327\267-\370\034s\342\253\3179<\263\003\345\314\206\252S_z~\346\351\0217\nD\211\216\027E\232\017\301\353E\352\357.\251\307\202\020\352\352H\273.r= \020\001\260"
+	.ascii	"\206\370\320\205j\204\013\335\331\r\335n\257~\301&\003\376E\222"
+	.ascii	"\237\024\004J\005\020\306\266\201\361\030\f\374\340\013\255 "
+	.ascii	"\333\334\032d\301g~\372b\212&\313h\215-8\305\351\246@G\r"
+	.text
+	.section	.gnu.lto_cliVtxTable.274.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\340(\245\255"
+	.ascii	"\372\016i=L Fa;c3\220\261m\325\023\261\233\252\270\200\024\005"
+	.ascii	"\"\244\320\377\273-\003\347\350=K\371\202L\264\271\205\273ue"
+	.ascii	"\313K\300U=oKWj5\250w}\3329\257Z\256P\"\226TQV\354\334\006\343"
+	.ascii	"QD\005#\022\262\245L)\245\311\003m\003\313\003T6E\002\360\265"
+	.ascii	"_S\377\332\004f\003j\320o\364\355/-ie\326\367\225\372p\273\355"
+	.ascii	"\267B\017\035\373\242\322\314D`\300\355\240N\032\027\353\\\224"
+	.ascii	"\rZ\217\007\300'\247\230\207\307x\354\373\366\262dcT6\265\034"
+	.ascii	"$\360\216\275<\212v\334w\214\326::0*\rw\216w\354!\25217\034\267"
+	.ascii	"\\\034\343\365\333\365\266\2225\264>\353\f7\r\373\234i4\314~"
+	.ascii	"c<eV\333\313\205$\243B\310\346\302\355V\311n\320e\270\327"
+	.string	"\354\001\372\374\364\230vc\0372\034\320pv\220\003MM\204\367m[\321\306A\2057\360m\351!\332\232\365}\353\224\272\345%\267[gn\266\016\303l1\034\264\320\373b\031\241\356}\333\230\370\310\355\226\333\232\350\330\255\333C\307n\231\314\210\031\264\336&\01343\250\031\305\367}\235>K\262\302Q\007\226U\342\276\256\350+\223\234\353r\031N6\333\326<\303\207\331|\307v\\\307t\254\206\347X\216\343\030\216\323\360\033\243\3413l\206\313\260\033\223\3411\334f\300\f(\0311`\274p\361\324\202\305\n\025)8\017\305\t\247&\246%%\023%\222H\214@:\022\021\202\361@(?x\350`\304a\203\206\f\030\212\210.\fY\020\252@\201\327\004\001\375\370\364$]&\001yl\331w&w\017W\263\371\316.\204\346\272\013t\254\206\347\252<\2478\313\305=\273\227\350q5>\231\206Qi\206[S\002E\223\206\355"
+	.ascii	"m43\232:\245\260!\024\233wES\347\227\363[P\336\025\021\215\321"
+	.ascii	"\324\031\245h\352t\342|\246h\352T\342l\306h\352l\322W&\316e\002"
+	.ascii	"\335\220\274$B\351\230\f\013\265\306\313\211\321\324\271\305"
+	.ascii	":\031\2348\236\025u\036S\270\244\271\315h\352\354\300\200\253"
+	.ascii	"7\363\370\214\306\206\362f\037@\306V\327\3302\330\245(i\376:"
+	.ascii	"P\212\207\035\032\\@XQ\214\366R\006E\363d\032\006\3260\3560\372"
+	.ascii	"\013v\305\002:\230\353@\351\"\353\223\306\016Z_\233\365\232:"
+	.ascii	"\301\334\205\321\324iE\321\237Z\2608\264\026\372\n\303V\241\244"
+	.ascii	"\366\306\266\226\302\2609\317\254\352(\322\032\273L\273\020\373"
+	.ascii	"\004\034Bw\002\334\363&@C\023\234\351\257\227\330\237@\251\037"
+	.ascii	"\253\002\221\317\225\372\332\004b#@fF\330\327%\2204\f\333}\223"
+	.ascii	"V\030g\332\365\327I\2542P\232\310*Kp\022\354\b\244\2717q~$\327"
+	.ascii	"\"\224\266(\262\255\205\220k\306c\223\276\316\342\214\246\316"
+	.ascii	"2\026\203\340\\Z\237I\341\034\004\222l\013\225mq\332\245\246"
+	.ascii	"\225\254\t0\277'\035(M\303\022\261\t3\3543\351\233\1778\223\262"
+	.ascii	"\271\007\366\311\240\321\353@\351\b\254\2140jZ\232*\306;\200"
+	.ascii	"\320\025\246\215\250\335\246\201\3512\355\n\323\034\350\300\370"
+	.ascii	"\006!\2444-\0322\200\230v\2515\0065.^4\355Zk\"\263\2742\277\300"
+	.ascii	"\016}\311\255\261K\202hR\372L\272\305\207\276\234I\311\334\202"
+	.ascii	"\020\213l\"\025l\027q\022\245\364\235\025\2570\326\024\306\232"
+	.ascii	"\327\334i\331\342Ah\211P4@\035(\005\253\253\342?!\364\231\224"
+	.ascii	"\212\373\264[\263O\246ac\335\303\"\265\234\230\265\013F\353\335"
+	.ascii	"\2314\212'\2214@\350\372j\267\261\276\232I`\225r\r\"P*\205U\276"
+	.ascii	"\357[4u\2229\222\005Z\tGV\205\226\"\225 .(\373\303\bu\323i\236"
+	.ascii	"\336\262&\254v't\240t\nK\344\304,\352\303\245\345l#\241\275A"
+	.ascii	"\351\236L\303\264\364\263/\374\314\366\202\270\262\330c\230]"
+	.ascii	"\226vk\337\342r\272#i\274\357\313\036\345\352jv\240\231\2218"
+	.ascii	"\230\335\214\371C`Q9X~E\372\330\252r\2056\366\274\030\243\250"
+	.ascii	"\272\315\345\333j\003]\366,~\213\305\037\337\315\332?\222\205"
+	.ascii	"\320"
+	.string	"\376\f-\315X6\245-\271\324,\276\271\374\221\312\336\241\333\340\0310\247_\371\204\263\370V\343cY>`\206\311\265\005\270\3015\252\241\2340s\356\213q7\320\227?:\r<\026\366\237\375\026s,\314,\356\373\276-\302\376[m\357pM\f\226_7\324\0013\210|1w\233\361\216\r\347W\230dGce\356\263\331H0\2710\273T\007\255P\217U-\324\343\213\0219\372\033q3\241\313\336\337\247\220\212\035h#\226_y\204\367\226gf\2461\275\224}Q\336Z\335\2425\353\233p=\346\007\002\300\266\300\271\024\252\246\003\266\205\271v\334\362\235\246\205\030\007\277\250O\020\200o\336Z\245\356\217 \204w\031\367b\206q\231#\270\317N#\321\355\217g\256q\343\177\362\326DX\264j\tN\261\\a;87\002G\356\034\3076\343\\SI\26623_\330\336\027\253\243\354N\\\252@\313\013LyG\247\306t"
+	.ascii	"\216\314\r\364\360\216r\303\t^\251P\037'U\353\277\030sp\374\361"
+	.ascii	"\2575w\307\rN\2263\362\005\3572=\346\007\020a\264\313\270\022"
+	.ascii	"*\017\204\357\373\354\350\003\356\263= \321\255\003\317\fA\225"
+	.ascii	"w\364\307\267[7\223</m\213\326\3477\231\333\234\376bq\316\234"
+	.ascii	"p\361ca\356\270\346\346\322o\315]\266\245\307\232\256\271A\020"
+	.ascii	"k\274\346\266\002\326_"
+	.string	"^\375\244\003\233\273\213\253\367\232\273I'6w\024\332Z\355\354f\017637H\322\202\315H\212`\340\316\346\013,\3508\315A\332N3\005\023HP\005A\347i.\300\003\335\330L\325d\232\177\264\230n\007\\\253yF\317i\206\362\267YF'6\307\350\303f\030-\330\374\242\3354\273\350\276\346\247\266kn\321q\315,z\234W\0049\253\350qN\221tF\201t>\201tvj\235\233~\234\231~\234\227Zg%\244\263\t\244s\211\3269\t\310\231\004\220\363\b g\244\244\363Q\317i\026\201t\016\341\343\f\302\307Y\371\343\374\241\373\232=\3748wh\235\215\220\316\034\220\316\033Zg\r>\316\031\222\316\030\220\316E=\316D=\316\027\222\316CHg\013Ig!\244s\205\2443\005\3279\b\351\f\224t\376A:\373$\235{\\\347$\322\331M:#\221\316\307\244s\213tf\223\316\357:;\322\271;\215"
+	.ascii	"t\3166f\320\270\374`\333\353\344\212\347\245\266w\\\\\253\335"
+	.ascii	"\331\376v\307\351\236\323]\247\333N\367\235\356<\335\215\335"
+	.ascii	"\211\335\207\335\202\335\203\335\205\335n\272\003\273\367\272"
+	.ascii	"\373\272\001\273\361\272\355\272\351\272\343\272\337\272\333"
+	.ascii	"\272\3114\007\346~\276)f\271S\f\265\313\365\227\275\351S\310"
+	.ascii	"V'\247\351\364\t\255\330x\272\261\257okoljy\276\2645\023w\261"
+	.ascii	"\031\231}\347\212}\243\274J`\024\331\324\336W\332Yo\311\024,"
+	.ascii	"\230m\007\311\001\026\275\374i\340\326\361\002X\304\235\343\205"
+	.ascii	"0\210K'\346\315\252FeS<\344FL\n*4#dS\034l\3026\204\323Uf\027"
+	.ascii	"&\351\367\371\272\213i\204\021\270\335\272\022\017\216\b}U\353"
+	.ascii	"\233\270\270\262:6E6\334m\330'\260\207\214,~MU\226\224\255\210"
+	.ascii	"\361\035\375!2\265A\037\316\324\312\007\201\267\324\013\373\351"
+	.ascii	"2\261\345\306\226{\377A\022(\302\277\002\3425\230\211z=X\007"
+	.ascii	"\312ok\273\3258\265\304\250W\211"
+	.string	"\256)v*\250\024\306y\277\331\345/E\324\352\347\343\261@\277\315\242@\257\356\222\351\032\n\346\367\341Cy8\303;P\252\214'\232^<\263L/\036\t\2227*\033\241\351\324<<|\256\246\241\331S\260i\251\235\337\302%)\365\213\337\372\027r\360\2628\231^|;\277\r\315"
+	.ascii	"\237\276\364bL\201\317Dk=\362K\t\376\360\035\336\317\334vx\206"
+	.ascii	"\277%\240w\364\303w\225+0\276\303\263o\240\215\354\373b\235t"
+	.ascii	"\204\361\255\365\037\310\314\022\215~\013\211\007\fc\034\336"
+	.ascii	"\350\331\271)\337\320f\371\306;\312\341\225\032~\303\263\177"
+	.ascii	"\320\306\350w\200\344\211p\305\230\206o\304nM\340\263\263\366"
+	.ascii	"\377%'\330\305\204\016\377^\3029v\3633<\363\262py\030\343\312"
+	.ascii	"\363\263*p\227\264\3412\321m3\374\021\276\023\234\203p^X~E\373"
+	.ascii	"\252+\201\341\231\217\365M\f\337\206t\246L\320\222\212\256\037"
+	.ascii	"\246\350\211W\037u\321\232\241\214\024A\022\217\227'\002X\030"
+	.ascii	"+\031\277\"\225\264\235\031\241\001\373\276S\003\032\260\255"
+	.ascii	"d\220\244\210\350\257oC\350\241\324.\020\335\252L[J\236G.\276"
+	.ascii	"\277\336\002Y\231\036\321;\343\362\316\nB\346e\034_\324`\304"
+	.ascii	"X\267\212\307\303\250\234&.\321\367\233n\025\371\016\027\357"
+	.ascii	"\260\374\232\244d\316\240\210:\3139u\334\347\203\005\345\355"
+	.ascii	"Q\027\255w\354\300\204h\233P\254\364x,^\337fm\030\207\312\335"
+	.ascii	"x\375\363\025N\241>\277\211\304#\310\007\202\215#.\355,\027\335"
+	.ascii	"\247\347\241\266P\265\320\003\226I\342\022\245\207\247g\266\303"
+	.ascii	"\323{\360\360Fegc\346|\340z\017tc\323c~\374\030\033\257R\375"
+	.ascii	"\\\341z\240+\213\"<\277\371U\300\2546\036^\214\337\f\032g\324"
+	.ascii	"O\276\205\343\240\324O\277\325\344\237\276\250)\247\215_\226"
+	.ascii	"3Z\031\301\336tx\372~\362Mm\2670\216\f\360y\341\245M]\336!r\321"
+	.ascii	"\365\027>(\216\214\253\353\273M7\225<\2756\326M\342\333\325\250"
+	.ascii	"\206Wh\356;*u\263i\352\362za\214\231\331d:\253s\250C\337M\276"
+	.ascii	"\017\003\331\f\375\027>\275\305\237(\236 \007\013\200V\013zG"
+	.ascii	"j\254q\0334\b\275\0373\313R\237\320\267\037\237\032\347 \232"
+	.ascii	"\306\f{\276W\202\0263\254(\217"
+	.string	"\204+\213\326\023^\202\343\255\2012\303\274ZEk5%x\030^\254\302\367\031\205\257\240\304\355\352(|\363\361\311\255\261e\202y\212\364\\\rsk\004\023\367\351j\016W\255\342]&\254!\n\372\236Z\371\240\247\2605\226\bf\345;\257\207\356\252_\324\254c\233\031\273\013[\335`oT6e3\247M\2314`\357\325'I\261-tC@g\230N\\.\367\351d@U.&:U\244X\370y72?>\n\255\330\2016\n\275\030'\371(\364\330\267U\036J\335\342\267>ht\253f9\243\035\024'y\025Z|\217}K\331\313\343l\341\r\302\267\370^\343m#@azpg\207\372|\353\222\223E!\211U\345\216\207O\317\373|9\033\230\236o1{x\026-d\201\t\013\362\017\272\355|\2159\245\212\373l;\177l\032\301)@/\306^\245\223 |\362\203\342\300\022\305@x#\2570mvv\256"
+	.string	"\217\322b\337u\3353\270\246H\315\007b~\334_v\001r\345>\373\320\265@f\220\004\252\3267\271\f\0311{>\3107cf9\032+\353|\205\244\304!Uc\201\005\246n\330\350\321@\221\210\034H|\205\244\374qC*\252G"
+	.string	"\242v\034@\304\204\342\nI\271#\312\306\002=\244Hp\253#\312F\r\035?\244j,\240\234\232\342\341!\212\307\215(\006\004\020\225\244l \252\207\216\032>\224\t \320cJ*J\311cJJ\311W>\242t(wD90\305\300\023\377\350\210\222\222\252\221\300\r\025\234\344\022\022 )O(\245\242\242\034\340\021eC\031eC\211CG\217\251\004\032HR\362\220\3521uC\211C\252\206\r%\216\034:j\370\220\312q\202\257\216\034\244\311JH\004UG 8\300\221\f\234((\262\201\225\316\262V\030T\r1bu\344\210\225\220\036\003X\031\231\300E\n\261\212\240JHk\205DHU\006\255\021\253$D\212\264G\206 !\002\244\275\022b\225\201\225\220\343\225\020\253!C\252\202"
+	.string	"q+\350+\t\206TE\320^@\344\310\0339R\304*\203\252+\244\325\220\n\204H\200\001\020$\003i\252@\b\020\247!\025Ta\340\004\304\310\225S\023\021\023)be\304\351\b\021\"F\234|\332\260\372\2610\323\300z'\333\265\343\241\250\271\242\242\n\366\027"
+	.string	"\016\240\320X\025\300\300\217\3572\257\270\344\342\241\213\373l\243,\321K@\333T\362\361\374\350\264T)YR|u]\200Q\201$\337\206"
+	.string	""
+	.string	"\245\236\361[3^\204\t\317\026U\200\216\031\237\344\207\n\337\256O\260\025\377q\226wZ\020Z5p\"D\373\304e\332\bD\344\\T\016\226\273\342\375\331\007x\371\311\375V\025@\005(\370B$M^\276\272\\;\032\203S\202\337\231\305(X=7\246B\305\033 \313\266ws\325f\300|\233e\230'\302@\025\037A\334\333`\364\204!\036"
+	.string	"\250\313\021\306\270O\226\216\036\327\273h\205\341\267\227\243\310\267\231\037\225\273)\362\317\227x\245>\013\323\230%\360b\034do\351f\306}\262j\252\211OiY\020\210\202zfq@\275\b\021oTvm\316i\323\323F\274\003,xgt\253>\025\217\352\207j\301Sx\205\224H\245Qo\320\270\033\030|[\245\241\324P\277\025\344\241\036\303\0309m\204\374\270\350\340\200z\f\\9[bRd\365\t\313;E\204\027|\n\266\261\017\217\333 \032\247`\310D\353\306\213\371\260\361R\b\245\253a\301K\360[\022\274k\275\335\022\3152\215\373d\023\377\250Z<\367\234b\343\202o\265"
+	.ascii	"\275\270\371\271\005\027\274guS\361\312\323\266h\255\260\226"
+	.ascii	"\200+5P|\220\357\303\237cfq\345P|\213\351\243\263(\346\304S\360"
+	.ascii	"]\307\351\304+\233\336\351\377\017\332\350K\226gH\334-M?\024"
+	.ascii	"\027&qK\n\226_\333\232\225Hc\2027*;\341\0034T\2558\201\020c\242"
+	.ascii	"\025\003^\214\201\370\2406\370\226Q\3067i\031L\277\364>u\254"
+	.ascii	"\306\003\304e\372\206rE\306/=k\006\332x\201p\t\233\031\277\244"
+	.ascii	"e\374\006\317\201\214M\357\t\366E\204&^\351\277\204\211\244/"
+	.ascii	"\361\377l<H\334\244\367f\267\013\350{\263x\347\366\004\203r\253"
+	.ascii	"\2360\0015<\251\204\007H\"\027\365\351bO7\031UoT\206\310F\215"
+	.ascii	"\252\025\253\346\374\030Z_\f\252\177\340\375\375\264e\334r\316"
+	.ascii	"}\262\322*\342\036\365\331|u\2130\254\216$\336\210[u\304#=\211"
+	.ascii	"\367:\320'\020<\325\217\370\257\003\375\242\324\020<\322\367"
+	.ascii	"\304}\001\204\2525u\001\036\202?\222}\241{\2029\037(\300{ \242"
+	.ascii	"\035\265uf\255y\361b\017\274Q\331`sN\0338\376\372\373\\\250\232"
+	.ascii	"\316\003\337\214\210^\250GO%\366[\310\216\276\257\335\252\365"
+	.ascii	"\311\035\271\236{.B\274\226%\335\322\316}\262\321\020q\254O\217"
+	.ascii	"\247\247\350\001\025\275\026I\fY\250\350\350\267!\370P\352\030"
+	.ascii	"H>F\203@\250\002\3610\312\362\244ChfDD\222$Ic\002\013\020\204"
+	.ascii	"BY\244\326\322\003\022 D1I\243\214)e\"\"IR\220\312\316\034c\013"
+	.ascii	";\220\266\230\355\004'\372\250"
+	.ascii	"@k@\007\354u\202\\\t\276\005\305:$E4\232\022\322\035\343\263"
+	.ascii	"\242\223I|\027\321\2509\026\034C\324 \nR\353b\361\342\003U\363"
+	.ascii	"6\260\2134Q\323\374\263\1770\006O\rn\254\022v\013R\310\242\243"
+	.ascii	"\375\336\212\255\324\226`f\266D-\225/ b\221\032\265j\313p\342"
+	.ascii	"V\357\377\256@X\200\006\310y^|\367)*&\345\312c\031\317&\"Y\326"
+	.ascii	"U;{\363?\306\332\366\017**\360\272\242l\267x\200\301t\022k\215"
+	.ascii	"d\206~\353\305\325D1L\315\003]]\017N\013\021\313\261\350\232"
+	.ascii	"8\205\216\005\321\026\372p\365\352\324\322\323r\3511\002AW\030"
+	.ascii	"\231\312|\273$\017\37191\201Nd\340\211\372\203\211\032\300\264"
+	.ascii	"]\313\023z\243m(L\315\032\331\321\315\314\007\362\320Q\n\033"
+	.ascii	"\224\302\241\341AT\2334\bQ\267\364\225\026,\304\210\235(x\342"
+	.ascii	"!z\367\310@\247'\2670\274SJ\367\231\344\206\345^A\211\310\031"
+	.ascii	"\363"
+	.string	"Jl\362\243'\261\3223F}\305\332\256\006\255[\n\300b\257d\001\004h\324\305nw\241D\227\312\224\371\211\334\306\357!%E\237\252b\230\335\302\227u4\023\341\343A\250\341&\343\324\021>\023+h!\0054\373W\026\275\201\302n\372\216\276y\n\034\201\364\244\003\277!-M,\017\256\215!S?p\276l\250H\332k\0042|\206\201IJ\227\306\375\245\270\2166rx\367\032\017\244\345A\rA\300\235T\270\317\205\344\307\217QI+\363|\252\247\321\243\036\232\354\256D@\3028\032k\207\341\212\211a\375}S\n\216\354\343$\376\255*|\320g|\0175,\220V\302\304\325\016\205R\f\025rBSZ\204\370\277\342\212g\225\241}h2\205\364\205\203\3724\225}\262\242>\355w\212,di>{\264\376,\302\023\266L\240\346\215\t\261\222)\231\005\345?5Uc\360\243%\375\332\336[\355\2206M\301\271\361"
+	.ascii	"\377\240\344\355\320\204wwsw0\231B8C\241D\017\342\230|q\221\033"
+	.ascii	"\\\204\307\017|{h5M\036\310r\213>@\032\262\304'\2076A+"
+	.string	"\332^T\016\256\326\344|\353\223\370\332\007\374\f\027T\3114\3707\245\302\016\351\240\20054\203\001(\363Sa\036L\206\256\036gm\007\241R\302M\357\247\3334\212\232\216\240\252\334|\366\231\023\203W\317=\217\247\267\211N\372\343qpH\256\255\213N\363\017e\337\271\0355A\2744v\272\242\0360\201f\221\203\241}\200\217\t\035\341E\330W4\222\017.\252\016dem\203\262\235\221\301t\357\223\352i\017\013>\300\0232tQ?d\036\277\fE\242ep\265\035\270{\303\242\321\316\302NZ#\317\222\252\215:\005\272\213t\246-\tp\300;\t\336\336\020\315G\332\027\271xqo\242\211\225\323\335\331\ft\031\376q\226?\343\353\302\334\363y'\204\310\375\201\021\262\f\341I@#I-\024\253\005\216\234\234\214\240\231\213\300TK^\240\007L\252\364\002\037q\242\326\024\351\334\032\b\013|\023N\272 HZw\2317"
+	.ascii	"\234`*D\001\260\205\203\234x\222Me\320\031\202N\235\034\270\372"
+	.ascii	"3\317\246\221x\030\215\005\323\225\320\230\362\024\f\267\367"
+	.ascii	"\002d\204\325r\310\036\256\202\344\006\242\341\274.~\242}\304"
+	.ascii	"\001\301\211\363g\031\227\037\217\236r\257\321-\367)\307!]\262"
+	.ascii	"\277\243\327\034'\225\254\\\313\226\234;zn\323\376\234\351i\376"
+	.ascii	"\034\3164\206\226\223\354f\177\212o\251\332;-\016\347\340C\235"
+	.ascii	"\250\374\236\326\216\354w\236\304\323\202"
+	.string	"'\265\201-\311\264\350\355E\026\273\275\2267s\375\270\360V\\j/\263^\245\001z\021\315\376\t\341\367\273=v\3255\252\310\231\331V\357\t\341\255\340\314\240\246C\316\263\355\352\244A\263\225f>\241\356\314\266\224\373G\373\022,\311(\002\335\003\251\002\344l@\220\376\016CG|\3605\2430\022y\360\351]\314 O~\330\342bh2\274<\"\237\031\205\205\005o \031\370\207\016\242\034tCz&\317\002Nj(ds8\302\357Y\350H\342\016]\303\b\2349W\232\375\324\206\265\221\021?\214~P\f\001\242$\030@p\371\025\320\302\305Ny\261R\31289\236\0202\315T[\\>\023:^\363+\016?\206\354p\231W\njB\254\002'T\031\202w\037\203Z\3022\337\330\227_Vg\351\320\\8\266*\021,\241\205\334u\002Td\322\362\323'\356\303yS\371\2503\236\346\211a\307\247\n--\261fX"
+	.string	"\232\354\337T\245V[\315\302I\304\250\202\007\322\003\300U\262\323\234\225Q\231\304\242\300>\314\b\221C\264U\326\250\371\266\230\324"
+	.string	"*r\361\276\327\224V\355j\271\351\272l\330\021\315d\250\033</\261\302\233\005+\2022m|Mb\341\204\024\277\032\b\330|%\340{\002\032\274.4\237\327\370\201\241\037Ylr\343\310\352O\257\220]l\023\235,\362_4\360\r\335Q[\351\n\200\343\231^R9\240\312\200\263\030\373\337\360\034TC\240S\257<\r\342\341i>\303\277\013\246\213\272\036x\326\220\t\264\306w:\232\335c\336\025bp\224B\266\211?O\276\342\302\277U\037I@\257\264\353T\331\355\007\211\320\266\302\363_P\004lj\311O3\354Acx\333\216\230c\241\004\344\216\022\373>\307z\"\235\270\326"
+	.string	"$\013\315\371\255\257B\270q\t`i|V\332d\350]]}\312\307BvX~\0135\254\224\354\003\032\026\2060R\217\373\340\r\016\270\203,\255!\031\246\317"
+	.ascii	"{\262[\0026\307\243U\211\322\244\315#0D\3556\016\233n\313]k\313"
+	.ascii	"\210A\356\372\220\013{\017\223)2\364\205\353;\316K\330\247t\025"
+	.ascii	"1j\371\315\222i\370,\335$U\"|\267\332\215\304\001\376SDP`\324"
+	.ascii	"l\017;.5\177\253\262\267^F\263Z\036\017\001"
+	.text
+	.section	.gnu.lto_printName.275.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\257\001U\021"
+	.string	"\266!xF\340\322h8R\003r\210\264\230]\206,\226\331:Stt\245\237\b\322\270\245\212<\230\236\263\347\t\235\337\250xP\326>5\f\fdH\271N\231J\201\322Onk\327d\221[;\201\017\001\244\bv\273\355\275\245L)]"
+	.string	"_"
+	.string	"d"
+	.string	"k\033\022Q\341?\217\341\323>\320O\314\036\244\301\"\273!Z\030\355\216(\027\b\377\235^\002\376\363>"
+	.string	"\374\347\231\335\303d\303\322T~F\334r>v7\245\">\273\2479\363K+\"\"\216v\257\303\025"
+	.ascii	"\356\306;\355\356s\317\034\234-\263\264\262\273N\021\307\341"
+	.ascii	"\376n\233\305\366\004;\2776\340\277\353\223j\304\370\241\253"
+	.ascii	"\345\316\036i\251<\366\275\335]\353\216\375\240?\004\323\245"
+	.ascii	"\023\335\340\205\376\017L\353\227N/}\223\005\031C7r?$4\307\270"
+	.ascii	":\273 {"
+	.string	"\364\351J\234\350\267\377\234G\234@ev\242\f'\332\270:\245\035E3\200|\354\216\007\376\231\201\235\343Q\314.dc\022 F\027Rzvq.\252B\034\226\223\177\251\241\332+V^\364\351\2464\203\232\212\272\r\251\345\316\363\224\347\305\313m\364\354\332.\272h\235GI/z\250\345.swi\252<~\321\257-8L\f\351\260%\020\3730\340\025\324\013\271\351nr\207\340,`\034 \355\356\002\373\365\025\260p\327\246@\205l&\005\311'F\245c\006N\rX/U\314\211\200\211\204D\346\252Q\271\260 \304\\\252\232\031\026\311K\313%\006\366@\006s\265dF`b\252\b2\257\032\f\241W(-\327*\025\323R\275R+\232X\n\245\3040\031\026MJ\006\203\321\244F\306\275\267\272\343\324\222\226\374\370\334`\244\257\243 \341\303\016\b\240\n!N\313\311?\325\034S\022\215\243\232\336X@\252>\305\003\034"
+	.ascii	"\357bT\215goB$\275\276\017\263\220e5\210p\b,L\006\307c\320aC"
+	.ascii	"\234\210\206\2531\301bBk(X\337\013VqM,\230#\342l\be.\260\277"
+	.ascii	"\251)p/\230\232\002\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_cliName.276.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`N\003\025\032"
+	.string	"\006\261\257H\240\032U:\234z\200faf\312\021\306\207y2\276-Q0-O\030\207\f\377z\302\345\003\3504\366=\303\350o\217_\262\006\252QE\250\035\322\024\351\203Fe\r\035RSu4\275\200\016Ih\212\031hk\204\020)\223\f\230"
+	.string	"\221"
+	.string	"\232"
+	.string	"i\035\006\020b\2222A\365\362$%P\340=\3759{i\0352\20505%\261\2515\345y\271\017T\347\335'}\t\357Lh\334Uk\221\222\246ZS\b\273@\365r\323\347\230/U'`\276\\\336n\031\235\240\332\243\200D$XdSk\2155\220\363\256J\231%\331\314\333\277\370\225p\330\273J\301\217\033DO\375\213\r\242 \233\005^\3428\031\324\032\376\270I\007OW\324\004\030\002\311\234\241#\341\213g\241\241\2179\225\241\326\272,\034\336\370\256\276\2735vw\307n'\b\345\316\320r\267E\215/\334O9\003e\004\336(\352\251\251\233\2703LV\353\034\035yA\003f\314\217\243\366\315\352.\006\337"
+	.string	"\361qY\274\352\335[\216/|'\310\221\303\006\324\323\257{\273\251\217\233\270\373>\036\217\307\355\242\335\024/N\311\333\272\322\227u&\377\352\351\227,y\333\344\345\222\367\256\024b|`\212HHZLZ\207\216n\252\261\304B\344\351\257\264\373\245\335\326\312\370\322\366\2041\352\221Tkm\361\235\274\270\255\335'\207\302\273\322\214\363\027\3771Q\244$A+\374.'[\350\307$[\347\250\b\002~\224sA\033D\035i\223T+\220\226o\331p\324|\371s0w=|`'\035>\240\236\202\272G\326Z\253\331\304\362"
+	.string	"w\257z\357\224%\204\210\023\247\233\314\20030Y\215\323\217\362U\020&\2465\3004>>V0\2321B\362\234[\007\245"
+	.string	"\267\372K\307\322\243\252\025x\241\t\025\320\302\316\313\023(\370B\356\027\357\032s\246\215\021\330\275\025\360n\365r\220\310\307\307u\261\353\253\305\344\371\276\212\212\b\247\"\333\017y\373z\275`4\031\352\263\303\325\316\235\023\303\211\336d\270\323\007\335\355\234\350\256\347\204\321\320\030\271\033\252;\321\025\247\315V\223q\322p\262\333-7;w5\027%\316\013\034@x"
+	.ascii	"1B\203\211\327\353\325a]\300Z\324X\340r\263\330\214\205\201\205"
+	.ascii	"\3008\324\3264\324GF{\001#\205\342j6\332m\226\332\031\254f\233"
+	.ascii	"\305p5\331-6\323\355b\260\234\315\275@u1\237\\N\027k\245@'k\027"
+	.ascii	"\261\320\3600\002\265O\365\342/\375\013O\211\001#\336\022\025"
+	.ascii	"\220\304\016\257\211\006\276p\0018\351H\241\236~\251&\356\211"
+	.ascii	"HR\202V\312\0074 @\002B\020R\353\001Cc\343\033xT\274\224Ek\277"
+	.ascii	"[c\231\220\255\273,\205R\003u\036\371\360\330\304\226j\tA\246"
+	.ascii	"\221\017\311\016\234\302\003\204\2303W\374=\263K\013qS0\370p"
+	.ascii	"\340W\2742l\302\325\224\262\320\324\215\244eJ\027d\263\203/\375"
+	.ascii	"\264*\222\223U\323x3f\242\275k\r\215\213\312.\350R/\023\332\342"
+	.ascii	"<\334\264\250\020\372\225\342\003\201\337l\033\037\357\270.\343"
+	.ascii	"\274U\355\204\002"
+	.text
+	.section	.gnu.lto_printBoardName.277.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\r\001\365\f"
+	.string	"\226\030XB\020\2176\035\244\351\030\272u"
+	.string	"\256PW\n\271\236\372ak\212b\201\351H\226\323\220WN\030\366\215\210\337\202\340\326h\245\360'\213w\227\001@\240B*\220\"\237e\373$\300\322\345q\n\353F\366\2262\245B"
+	.string	"B"
+	.string	"E"
+	.ascii	"\217\360\002\250G\207\354\026\004F\313!\340\220\002E\004\214"
+	.ascii	"\335\3154\303C\217"
+	.string	"P3\344W\036\030\357\343\036S\016G\327'J\315|\035\304v\367-O\322'\312\254<v\327\351}\023n\352\266\031\330N`_$\024\272<\331%.\025\203}\270\273kU\261\317\362W\232\2060\255\232\316L\037\200\246\303J\312]\\\354J8\311XS4\241\341\262\375\264\357\341\037Bg\211`\314\356\005\024%vK\035.`=b\337\240\002y\317\330H9\250'\361\322b\352\224\263B\215RU\300\302\017\001A\263V\374\215zT\325\031\244\n&yr\2256\250$\357\245~\203\205N\271\347\356rj\016\352\372\001b\205(c8\3009\250J\257\027\311\345\005J\006\031\300:\332f\244\001\310g\263}dB@\233\005$Z\t\210e\216\306#\302\311F<\033-\343|@\231f\303\033I\347\223=\330\266Ov\225\366pUE\343\345\204\311D\273\230I\250/}Dg\200\212\335\223{\016\254\223\216\003\217\266'$\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliBoardName.278.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\355\002\255\027"
+	.string	"\326\254\236H\300\226M:t4G\323B\344\243\002\353\002\024\222\030\314pFdY\262\266V\355\002\203\367\353~\032\336\304\334\347\326\277\211\021Y\021\026H`&\371\231\3439d-\331\355\354$\327\362\242\242\272b7=7$\215l\"eJ\001\213"
+	.string	"|"
+	.string	"\207"
+	.string	"\227\342w\265\037\344Bl\037\222\342\002\346\204J25\347\256\201\023\204\227\336}\006\274\f?"
+	.string	"\274\264\315\326R\2434o\017~\\Y:\2425\347\224\255\216\333\376\212\tA\371\255\332|W\016\002\252\221w\245Dw\373\313\225\023s"
+	.string	"\007\323\214\207 \017&ZA\266p0\3218(\277\031\253',1\235\322\267\300\006\025\f\230\016\247\237\f\230.I\267\312\213\031\2378\347<\357\312B\207\244\352\312\231sZs:\246\033v\333P\266E\330\032%:\347\274\355F\331F\001\306v\225\256\200\360\260\222\324\213\277\261\335#KaT\350\350Pe\3266a\244\317}\r\304\2501\265\225\225\2647{w\323\215\262\377\3159\247\027\312^5\315\245\356\330\207\3742W\273\244\032\274Z\256\372\273z?\265\256\3725\332\013\343\242E\323\231\\\315\351b\3742\253d\023\037\227\372\355\237g\230\275{\021\333\245P|2\315\257\260\372\221%k\316\335\315\245\031\204\001OX\302\032u\355\215\274\t\206/\261\222!\304y\260\271\274\221O\365\024\3301'\3569\016!\316\201\315\245\335\301\203>g\321\265W\322\243Re,\033T0\300\233\203\013\300\213"
+	.string	"\245Y\231\225k\177"
+	.string	"\241\317\201\013:q\302\311\005{{#\205D\212\334(\323\354\267\272%\324\375\366T\234bj\377\214\320\347v\317\273\004\343"
+	.string	"\3438\216\367\024\360K\263\326%\031H:\352\277#P\3679`j\223\020\322\347t;8!\355\355\001\246Y\230\325>H\340\231]\210"
+	.string	"\263\215\221\002\033\021\002\255\247\302l\203\250\241F\343\341\351\321\021q$\320vj\263\t:\"-\202\250\341B\2556\323\021\215\024,\030\372\t\332\237!\240\240\020B>.\373\340"
+	.ascii	"\005\371\310\206\200@\b\311|\212\214d83&*\361S$;ADT$\203\355"
+	.ascii	"\346\277\271P~\365\306*\025\213\364:\240\341mD@{\246\003 \312"
+	.ascii	"\215\251\255\254m\262z\312\022\363\037\201\376\223C9\362{\230"
+	.ascii	"\266#\375\035\360\3624\250\300hq!@\301\302\261z]\252\222\336"
+	.ascii	"d\0253 p\002\021\"\326\r\257\030\203\343\211K\270s\207%\227e"
+	.ascii	"k\317\306\013~\020S\002:.\276\202\305y\315i\241\227\204$ktF "
+	.ascii	"Ln\037GP\b\205\\&\f\254\220\311v\033\231\301\032\220cxJZ\250"
+	.ascii	"X\020\243\215\273\025\330\244\002\327\003\016\307\244\346\017"
+	.ascii	"\273\362\211)\256\204\271\333\315\353\257\024\202\364\016\211"
+	.ascii	"\214\365\004\341\232\"\352\345h\022\026X\350\023\366\204\036"
+	.ascii	"\207P\006"
+	.text
+	.section	.gnu.lto_printManufacturerId.279.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\022\001%\r"
+	.string	"\346\230YB"
+	.string	"\2216\035\034\n46#\242\bt\260\264\360z\374\340\244h\"\274\221\352\331g;\3769\364\277\021\221\263\210\305\0055\224v\346\326?I"
+	.string	"\024 F\351?F\021c1\367_\001\233\"\234\240F\366\2262\245C"
+	.string	"C"
+	.string	"F"
+	.string	"\324#\274\007\365\350\220=\203\300h9\004 $\250\230\240\261\273\231rx\350\021j\206\374*\303\341}\334\343\312\341\350\372D\251\035_\007\261\335\375\210'\351\023eV\231\335uz\037\205\233\272\355\005\2663\366I\002.T*ty\262K\\\352\006\373pw\327\312b\277\345\2574\raZ5\235\231~"
+	.string	"\314\213\024+wa\261;\341dcMq\205\207\313\366\323~\210\213\b\275%\2029v5\264P\261[\nq\001\353\021\373G\356\214\344=c#\345\240\036\305\213\005S\247\234\025j\224j\002\031~\t\b\232\325\301\367P\217\252z\203t\001%O\256\322\376\200\362^\352?d\350\224{\356.\247\006\241\256\rH\304\020e\r\0138\bU\351\365\"\271\004\376\030\300D:\f6\316\006:\331h\034\200J4\232\307\310G\243\300D\003\211X\336`:$\233\254\244\243\321\262\315\366\3110\037\366\230p\266\354\304\343\331\262\253\264\207\253,"
+	.string	"^0\230P\264\213\035\t\365\245\237\340\f\200\261\233r\357\201\225\022r\340\321\001\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliManufacturerId.280.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\362\002\335\027"
+	.string	"\006\255\237H\260\230M:\360D\033\252\277\340\220\362\3608\256!\204\030\t(]\326\216\331\333\016>\350\377\007_\243)n\332\247\254\371,\003{\352\024i\363\032\344\332\230`\330\356\316\260\016t\363\207,*\344\255ol\254\036\322\b!R\246\024\214"
+	.string	"|"
+	.string	"\207"
+	.string	"\027\313\360j?\310\205\340>$\305k\346\224Z\322d\316_\003' /\372w\233\361\"\371\001\343E\343\354-8K3\367"
+	.ascii	"\310\023\323\221/sN\331\3328\35632\344(\206\2538\377\305\203"
+	.ascii	"\340*\212\016K\222^\3563/\036\231\0034\232d\234\034qX\001\203"
+	.ascii	"t\321h\202\372(\2066XQZ\261\336R\270`F\025\030\260\336N\303'"
+	.ascii	"XOI\367\312\013\031a9\347|\325\225EO\247\372\342\231sZy\275\246"
+	.ascii	"\033v\333R\266I\330*%:\347\314\355N\331F1\306v\227\264\270Te"
+	.ascii	"))\030\177c\273G\230\306\250\320\240I\245Y\333\004\222\236\367"
+	.ascii	"5\020\203\207\257kKis\366/\247;e?\234sN\257\224\275\352\233S"
+	.ascii	"\335\261\017\371i\256~\211\352\361jq\325\341\325\033\252u\325"
+	.ascii	"\307Q\256).Z8\335\212\311\234.\202a&Pt\262\343T\277\375W\031"
+	.ascii	"f\377^\004w*\024\237M\363+\260\200@m\315\371\323"
+	.string	"\271h\006dQZ$\216\276\366F\356D\303\225d\331@\356>\344\\\274\2217\271\025\2701\347\356\274\016\344\316A\316E\333\303\007=\317\345k\237\204\353\007\320Y3\252\300\030u>.\215\216\032\275Y\232\025\327\006\021B\317\033w\274\362\355\304\035\305\254\016\025\222)\342N\371f\303\325.\244n\270\267\342\213\251\0354B\317\333}\325E1\016\020\f\006\2037\225\361{\263V\246'\235\006\365a\322\250\373\0320\265I\020\351y\272\036|\272\315=\226P\001\204O\315\347\366C\233M\270\331f\030\0048\007IAN\t\241v\2730\343P\376\330j>>7Z\271#\241\326c\233Q\240\225\265\b\345O\006\233mF+\221\024,(\n\032\332\240\"\241!\021D@/\003\355\b\r\001\311\212\204B\020\311\200\216\220d;66*\021t$;adt$\203\375\346\303\271R\236\341\262\002\252X\335\314\001%\217#2\3323\032"
+	.ascii	")=|][\353\204\025\245E\346O\032}(\217\222\344\347p\255G\364{"
+	.ascii	"\306\213\207\272z\342\303\013\001\013\030\236\305E\004\350\204"
+	.ascii	"\0254 `\002\021\"f\033?1$\304\023\227\2421!\222\357\212\245}"
+	.ascii	"\223U|\005#\2628*\276\202\305y\315\331\276j\263\1774M\242\244"
+	.ascii	"\331\327c<{\030@9\024r\2310\260B\246\333m\300\fk@\214\341\001"
+	.ascii	"i!\261 \215\036wW`\323\005\256\f8\216I\315\037ve\023S_\311\346"
+	.ascii	"h7\217\276R\026\244?$F\254\037\204\313\024q\227#\222\260b\341"
+	.ascii	"\236\260 \3648\2502"
+	.text
+	.section	.gnu.lto_writeSignature.281.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\317\001\375\020"
+	.string	"\226 qF\340\322&\035Rw\3024\313\024\310\274,\306\275\315z\035j|>\304h\215\303\236\232\023\333\253\024\\\371\226\327o\254\371\336]@\217\0254\r1\030A\f\353\263\261>\214\234\314\227\214EK\2425\364E\322\310\336R\246\024\\"
+	.string	"X"
+	.string	"["
+	.ascii	"\005\270G\177'\331\036\271\017\330\036\315\262{\020\220\331\026"
+	.ascii	"\203\035\034\227\314hw;E\341\222\303\357\206\311z\204\232,\277"
+	.ascii	"\347\360\206\246\343\025k=\302\033\225 :\305d\340\003W\216\020"
+	.ascii	"\237=a\261\230\204+h\256\237=\336\320\202^1\232'\t\302\356:_"
+	.ascii	"\261\231{\273\355\225\355\bv\002\b/]vsO\2234\275m\351\030\323"
+	.ascii	"\020\2465\323\251\351\217\240\370\370 \342\264\237]\0205!+\024"
+	.ascii	"m\340\\v\3730\374\231K\276\317c\260.3\371\316\354=\250\330iQ"
+	.ascii	"\264\373!xt\003\356\261\004\276d;\277\227#\005O\373.\376\202"
+	.ascii	"u\036\016\017\260[3\243\306\356w\3426K*\377r\211\247-ojR\222"
+	.ascii	"\036\310\313\211\272\351\363&\033\247Q!\221\307B\025\352\201"
+	.ascii	"\\C|\031\0330p)\374\227\355Q\3650\0220Y\363\265\244\251\367r"
+	.ascii	"b\262fN\257\237}\002\214v\3035\004&k\252E<'F\250\332\330_+Gz"
+	.ascii	"p\fYk\354\323y~\323\277\007\326\260 \201\201\210\272\210j%aE"
+	.ascii	"\225a\225\322B\001\345b\262\n\n\312\202J\327\202Ja\351TT.\035"
+	.ascii	"\n\211S\027VT\335*\225Ru\245o\337\363\277\200\034\t\301hLT\033"
+	.ascii	"\213\350\350I\243N\032\366\037>;:d\220\303\335]\2506'\025\300"
+	.ascii	"\203\026\344\2310%\324\377\234\006\352dh\327\373\253\002\347"
+	.ascii	"98\360H\322& \200\002\2423\356A\265\376\030\341h8\271\020\003"
+	.ascii	"\013Z$\316z\323\261v\232\005#\374\306\340\021\211@\3418\334\r"
+	.ascii	"\372V\177&\331\004oE\361\231\242\200A{\242\354\013Dk\374\312"
+	.ascii	"\301\312\020\231\354\256E\323*\336\330Q\004`\345\264K\260\b\356"
+	.ascii	"\025\313\361\300DL\327z\002"
+	.text
+	.section	.gnu.lto_cliSignature.282.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\203\t\3556"
+	.string	"\032^$\025A@bN:S2\202e.du\372fu\002;\274\313\375;\376\321\031\225\234\241\016\234\031\273'"
+	.ascii	"\325pJ\362\013\342_\204e;_\245J2s\377l\346\332\327\375\211\220"
+	.ascii	"\335\372\246i\211&\204\354\235d9\001)\001A\001i\016mc_\315\327"
+	.ascii	"\270\307\273\361W\355}\217Cr"
+	.string	"j\244\357\373R\265_\225\352\231\243q\177\227C\220\034^\205\366+~\225t7\343\276N\307_\346\333\016\312\031\222\276\257\263\301\327v\320~U{<i\346\270\373c>\347\236\214\330\223\3367\212\032\276\367\245{\320\t\332\257M\367$\373\265\375\022\373\265\335\356B\001f\357\230\00492gh\b\275\357+\225\247\264\362*\335\273\305\356\231\226\224\222\220\216\214\220GcQ\261%bW5\231\261\333/J\033;\323\222\20165+WJBz;z\273Q\0237\214\354\222K\374\323\246F\345G68\347\022l\024t\262\251J8\247\022\\\244>\305M\341\\\320\311D\035pgF\345\320\033\200s&\301E\365\204\224\364\271\206\263;C\276g\206[\"\003R\324\326\316\252\271.\315\237Q\332\231\212a.\314\333\375\230x=\364UU\346\020\032S\250M\255\312\325\363X{Re \355\033tA\347\0255)\004K\263\fgu"
+	.ascii	"\333\034\"\337\273\001A'\022\365\251\016\024>\207\036\243\245"
+	.ascii	"\221aL\304\341}\337\306\3154\2657\200w\277\331\335q\272\333d"
+	.ascii	"\210\370Q\254R\306\371~\317\202\002\372a\302\221\341\304,%\363"
+	.ascii	"$\311\232\304M\367\366c\235\362\363>\347D\002\267\367e\276\231"
+	.ascii	"\242enA\255`\201\337\354\023\036*\2112\363X\022-\017P\315\317"
+	.ascii	"\376\031\f\276|\311\034\245\351\320\024r\261#,\303\323\r\206"
+	.ascii	"zWr~\366\r\326)g\263\302,v\201ex\33290\026\324\357n\001\020O"
+	.ascii	"\234\363\331)\377\320\031\"\017\234\330H\270)w\267\340\302o>"
+	.ascii	"\037z%\302\303\264hY\036\353\246\033\303\371\311\347\r\f\221"
+	.ascii	"\316Q0D\035\357\355t2\177\323\365\336JH\334IG\334HG\334GH\334"
+	.ascii	"FH"
+	.string	"\334H#\356#\022\267\361\210\273\310\210\273X\204\273-\342&:n\226\305\275\036\267\332\342\316D\2701\213\373\031\360T\214\220 E.'\361}\205$\032z\243k\233,\347\373\337\374z\177\335\177\367\343\235\355f\323\357\273_\033\333\334\215\37376\212orsD\264_\005\344/\261|bH\257\340\373\264+rt\244\357\313g\325>\257\277\327\306\257zQ>\346\344\344H\337\227\256\252\375\372\333=\030i\347Bir{\272S\220\371x\207\207\242dy\254\177 B\217\371\331\r~\314\370K\003\254\274\b\326\230\306\255\342^q\263\3407\217\371[\240\270\270^\360\233\306|A\370\370E\212f|\301\026\345K\261#L\200\273\3358W\016\277Y\224S8!\313c\027\320'j\244(?\343\334\317\241]\240\016\214\005\005\275\332\005\0201\316ya\220\032\276b~vq\312F\345u\232l\264\005f\205~\256\276\357\373\266\371\331"
+	.string	"\376\346\330V6c\310h]\304\002<\214K\342b wN\201[\246e\342P\232\345\261ns1c\2753\304\276\324e\302h\255\364\305Z;\320\300<hI\bLy2H\224\237Q\371{\317\332\003H\207\311&\306gC}\337\266\r\322:\234\330D\271\273U<\315\224\223[\023\320\232\211\362\0214\360\357\f\221\207\237\221D-l~\262\271O(\326\344V\340\353\333\354\006\317w6\253"
+	.string	"4,\264V"
+	.string	"#\301y\337\262\255\262\302o\2569O\017\373\242\314\303`\355\334\017\006\023\005\374\225\205\2375\303\001\030_\004\253\346\303\271\337\b"
+	.string	"z\336\367-\221u\301I\316MY\315\031\220\331\205,\347\374\263\035\366\244D\366\022kKk\352\252\312*\253\250\241\302\236\240\224\026\226[!\246L(\265\256\226XX[TJ\b\036\226UW\313\016J\255\021WWST\312\260'\006\315u\2655\342\203\022k\251E5\2055\005\202\252\251\027xXjQ-I\240XF)]<)-\200\320\252\272Z\206Pz\260\n1e\342\312\352@7\246!\243\253\206\352\342\253+{\375\253+F.\202\325\310\352\002\263Q\243\305\327\013\257\260c\327\227W\f\0272\270\210\232\013\202W\f.\251/\257\0262\244\270\300\302\244 ${\006\215.0\251\0323f\200I\031\337s\340\221\311n\204\251\230\375\n\307\260\315E\200+\274[\322Q\227\343N\tJ\017\022\327G"
+	.ascii	"\264\226y\250\013d\n&:a\020\317,)))\237p\272%J6@\312^\025$\244"
+	.ascii	"\214\277 \345\265n\332$\232t\246\013\223#)lT\300(\033\375\365"
+	.ascii	"E\013I\377\027l\220\035\201wa\f)`\2474w\210\321_\237\223B\322"
+	.ascii	"\262<\306\024\255\0035\312\317\376\364G\371X\032\373\300\315"
+	.ascii	"\027}+\355\026q\217\254}\367\b\373\365(\257h\f\307\260\315\255"
+	.ascii	"!\350\241'\016\371?\267<\314t\221<O\217\222\226y:\250\257\317"
+	.ascii	"\303e.\223\002MZ\346\213\340\035&F\245\002\200\300\250q,\345"
+	.ascii	"\224CJ\211L \"iA\222\016p\002\0211\263z\022\200\226I\311\315"
+	.ascii	"\220\304\262\377l\006\256\234*\344\f\003\033\003y`\353\017\260"
+	.ascii	"\376\253\315Zr\024\333f\321\271\355\265_8\017\221\316\001\315"
+	.ascii	"\2105\201\326\320h\354\364\\\323[\027\275et\271\321\316\262I"
+	.ascii	"\204h\203\344|\323e\260~\323N\365\221\223\353]\364\236\253g\022"
+	.ascii	"d\274\003&GH\210\0172*D<@\3603\222\254\303i\343\330\201\337A"
+	.ascii	"\254\247Ve\3352\201\230\025\t\231\230S\374\246\346\204\354\326"
+	.ascii	"\f5\354E\031\242\273\251y7\243\336\362\356\242\372\004\311V\210"
+	.ascii	"\250\r:q\f\3300_\273\355D\036\250\b\311!\255\335\365\303h9 ["
+	.ascii	"\322\262]Zq!\034\"\312W\"\033\231D6\225eZo\366\254\007\377n\002"
+	.ascii	"\323\177\257\351v\024\225J\227\234rQ\244\t\316\350\002B\330]"
+	.ascii	"\001v\246\323\322\347\226-\345\336\235\201\230T\204lr)\211j\n"
+	.ascii	"$\306\305\314\267\330h\023\371G;\222\261*\272\231\3552\260b\200"
+	.ascii	"\273W\335o|yn\312\344\270\204\311\271\177(\037\017\277\003'\245"
+	.ascii	"U\353\333\013*y\210f\360u\255\355\230\210\200\035\016.\234\331"
+	.ascii	"\227\007Ry\213rJC(\\q4\326E\225\347\247<\326\320\210J\221\307"
+	.ascii	"\377 \201\252\b2%++{\201(;8\006\245\024\213\304\371\257\2205"
+	.ascii	"\350\254\226;G\211\212I\252\002F\021\247\364\377f\300\375\025"
+	.ascii	"\361\366\313\322\340\377\336\376\372\201\325"
+	.text
+	.section	.gnu.lto_cliMcuId.283.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\205\b"
+	.string	"&\320<90\217\323\001\004\260=\263@\006trX\311S\005p\r\"4f\240\301\274\266\017\337\330\223\323Z{C(n\352\224\202\202r)\263b\340\334\245\351\246qM\216\265\345\266{\247\024)"
+	.string	","
+	.string	","
+	.string	"\247\376\354\226\202\216\005\037T(\323*fw\353\024\371w\371\37179@x\002/7\237\335\265\fO\037\367\274\355\003\333\037\333\253S\264g\035A\201\234\305e\327cFfY4\205\204c\373\322~\352\252\357%\032\027\330\025S(\273c\203\021\260S\217\317\256S\354\003W\033\223\303\227\224\267\312\3259\303?\376\204\224\255\354\226\036Z`\245\216\302\251\215\221!\037z\241\365\3022M\320\036A9C\354kvw\035\276\200pH0"
+	.string	"m\021$\215#\b\2156\021\210\3236\326<\233H\253\243M\202\253\232GQ=\231\273\211\220W+\272\316\253\234q\257\331):\240\005\303\n\n"
+	.ascii	"\001\265w1d\342%_4\305\205-0\344\022l\263\232\002\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_getFeatureMask.284.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\375\n"
+	.string	"6\024J? O\225\016@?\204`\201[:xH\343f\363\335/\020S:|\001\025s\004\261.]\3330\345\216\217\240\365\243j\321\001H\305\351.\020p\314CL$\024\026\316m\207b\214\221\354-eJ\0014"
+	.string	":"
+	.string	"6"
+	.string	"\313\212\222G\262\303w\217\354P3\234\373\323\344\374\317\337\006\t\266b\324U\270rt\242'\331\335\257\236\244.\224\211A\331]\347\250+\335\360\266\t\330\216\366\005\004\177N\247\246\237E\024\t\013\207\245\330\245\020{\261(\240\211\r\266=6\304v\346U\020\254\261\213\341UbW\304"
+	.string	"\003\3108\264\355\247\336\301c\256@\004P)\200\207\324\204\026\213\r\020\352\001\327\213C\356\356G\335\311\256\bB\250\020\245\013\373\037\016\242\343k\360\206\223\037\035\372\234\354\360\372\325\037\312\345jq\001\2241\233\365I=\331\177\253&\303\253\036\n\266\212\201\213\266\321T.\t \266L0\013,\261\001\246\302 Z\264-N\"\3168\270hQ\223\311h\021\302\332\277U\223?NH\310\327\241PSIj\nHCOO\255\217\340\036l[\366\024"
+	.ascii	"\3571\326\210G\265\021\001\026[c\241\340a\207UM`\341!8\004ZG"
+	.ascii	"\330%:X\350\032\2563\20195\336\305\204\033~f3U\271\243Nnm\321"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_printFeature.285.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`)\tE3"
+	.ascii	"\232]<\024@`\350\315p\277\006\246m\262\232?\236fW\201\007\200"
+	.ascii	"\013\311\306\357\337\227\254\213\373\b\356\f\301$B\303\363\227"
+	.ascii	"X\236\264\\F.\030;_y\373\357\r\303\211\203D\002\306\246\365S"
+	.ascii	"#{\357\275\245L27\001\030\001,\001\273\300:`\216\204\332\366"
+	.ascii	"t\026\270\025\246\264>\007\253\270\205T\303\200u\3119\263D?."
+	.ascii	"g\317\266\300\233kY\305.\244*\366\253K\242\231"
+	.string	"%\352\221\336\344\307\271\332\002\323\210\224*\032\211#\333\030\035hD\2566Q\277\204\314\261\rOU\221\020n\256\214\264\337\024qcEE\233=\033\030\3715Zgc\204\250\244v\235\205IHo.2=\357\336\354G\255\247A\262>U\305\3026GU\221\022\366)\275Y\374\322y\263|\200\363\346j\355\332\021\225\250[SG9\253\233D\252\252J\365\026\3412\275D~\317\326z\2220\210\004\374\371RT\3514\313f\255\275\332\235\344\366\266\236d\245\316\312B\364\203\226&e\017V9\022\031\025\0066ai2\345\277\373a2\345oR\330W\345\351\333\233\3740!+\213\252\252\276\316\233\3120\211\302\350\223\224]\251D\225\204\205\271\037&\\\312\f\213\360\334\316v\006\023\343\342\363G\346\311M'/\313\007xt\362\204bJ\312\245\2600_@\261.\356\263\375\201\\\2413\2724\261'g\364\203\252\252\313_bM\276"
+	.string	"\276\373\022\273;\266\233\212\brI.:5)\r'N\211X\267qw\207\\\241!\234B\357\316\250\301\377\262\320\354\306\210\314\234\227\236+V\030\270Lh\030rt\212\222\370\275{\243\212\377\025\325D\256t\365\326\356\3528\036\"\251\252v]\330\337\321\312b\225~\271\2717r\336|\007\021\345\235);\246I\302{\273\310-n\343\3563pY\204\267\235e7\204\207\317\371v\370\361r\330\240\341p_\f?\336)\013\177\363Wx\232\237\302\321\276\023\336\346\227z\3327\352l~\tw\3732\370\332\027\352i\201\323\337|\233\232\267\230\362*\360\3612\245\274\tP^\004(\357\001\224\327"
+	.string	"\312[ \345%\372x\t\240\274\003P\336%\224W"
+	.string	"\312\033"
+	.string	"\345\035\246\274"
+	.string	"\2327)\345\025\372x\203(/\022\312\013Dy\177)\257\317\307\233\246\274(\312{\242\274f\312[\242\274\215\3622\312{\0214\366\316\376\2709\2565\035R\r\333k\244\316\231nb\016\367\273\375s\376\265\037\355O\373\271\013\267\267#\254\273C3K\364\026\306\271O\275\235\217V\232\251~\035Dgtj\250RgY`\232\031\302\007\346\210gm\343\3679T\203mi6\365\325\356\353r\274\263\266\261\205vj\260\2238\223\372\204\314\274\020\211TU\2732\354\t\275\316Dy\002\305\371/\024\347\315$\007\201\362"
+	.ascii	"\225\035\335\222\360\336KUU\325\263\215{:\367\r:\356Y\333J\017"
+	.ascii	"\275e;uS\203\355\376Y'T\207x\001\226l\363*\343\342=6\321\024"
+	.ascii	"\302\270<x\212\360\210\234\324\373@+|\306\274Bef\252\352\365"
+	.ascii	"\257\026\251\327\221\0067\205\355\342\005\377k\213kom\260\205"
+	.ascii	"H\035\354'\3277`\233\215\324D\270\225\354\327\300F\327\326\261"
+	.ascii	"_3\325%\365V)Cvj_{\350\254+^\275\265i\373\336\347g\247\375\325"
+	.ascii	"\255C\243\215zI\336\355\263\316\263;4;Z\337\314F\223+Y\331f\177"
+	.ascii	"}\004\325\021^6\021\316\253QTsw\237\311u\214\213\367vBs\237\316"
+	.ascii	"\3151rv\\tp\376DL\336X\331\306=\217\223C_\235\021\352\342E\373"
+	.ascii	"\266\363\261\301#\335\3078or\350\263\275D\023\213\005\005\\,"
+	.ascii	"(\tE$\254\036TYB\252\202V\347\201E\345\243\304\001\274\032\322"
+	.ascii	"B\307\017+\034TU;~CzdQ\345\250\032!@\207U\216\037@DT]e\r\241"
+	.ascii	"\252\312\021\344\201E\225\"\210\217,\034\351\336\210\262\352"
+	.ascii	"qC\352\207\025\225\017\251\033WXRQK\013$H\325\225\324\020 @\256"
+	.ascii	"\244\200H\365\235E\355i\034\037<ExI\232+\251\215\013L\013n\200"
+	.ascii	"B\243\364>g\320`\033\\\320"
+	.string	"[*9\365S\203%_,s\275\274\242\203@z\\\204v\356St\\\264\266!i\350-\323\247^ \350\fz\303\0130\273\270\240\317\2507&\001\2471\322\233\033\362S+\320\320H\230ZA\237\tC'\350\237\227\2738\004\215\241{\317\201\0366\202&\256\031\350\003\215\2721\320\267s\363\220\\\2433:8H\005\242z\330\005\032\250v\007g%\003\022\271\330{C >&\227wFD\352\365%\rn\022\t4q@\023h^[\337\226z\330\003\232\210h%\023\320K\215\"\022\320\006\274\330\351\255\253\006\205\321\327\257\215\001\372X&\364\260\003t'\001\364\220AG8\200\376\333Y\250\331\335y5\342\372S\307\006\315\327\306\345Fj\276\326\264\003\200\243\250Q8\303\024S\304\f\211\210\210\264\240\315\032\200\002\2219*z\021 1U\314\206\302\024$\035`\237hc\317\242\203\201}E\017\303\364\321\f3`\343\020\222"
+	.string	"Vn\035\027A\334\\\321\255\222w]\311\335\334,\372\362&iIA\017Sd\220]\244%U\313Q\257I\212\364/H2\367\333\204\034\273\325\236\341)_\257\315\nb9\f\265^rj~\264\337K\0256\352\234\244\222\301dQ\2224\322~t\316\361C\322|\2468h\036*\335\2411\210\020\325"
+	.string	"\206\274\026,\232\225\221\320\375\3401[W,\245\027\245~\222(\274\207\306\203\364\367U $\240\267\260\313\335l\f\267\251\320\277\360\266u\211X\033\bK\317N+"
+	.string	"\262\032\250\310\244\205\220\2214\277\033d\217\360'\242\315\037\221\245\333[\n\262S\343\315p-\261\n\235\212\251d*\302\350$\2232\201\361Ot\025Y\024+\340b\267Zf\377R\f~\260\232\321!\302\333j\b\260\351\276\221\214\022{\352\207sL\330\004(\244u\221U\322\311\032V\3003\245\026\350\027X\303=o\230*\020\274\336S\b\277"
+	.ascii	"I\370\354s\\\363\206\376g\nUc\006\005o\367=\355\\\342h1:\276"
+	.ascii	"\363\215/\0068\305\375u\230?"
+	.text
+	.section	.gnu.lto_cliFeature.286.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\036\fEA"
+	.ascii	"Zr\210\031?@bR\007v4\247`"
+	.string	"\311\314 \226f\377\2775\373\376\rL\\\226\301i.\023\236I\023\033\365\035\362\213\365\276\317\335\312\302\304z{\314\\\320u\254\005\262\031\243\254P\325\177\222n\273\367N2\245\215\001k\001\207\001r1k6\210\247\206\306\341\332\345\342\222\254M\277,\274\336\276S\375\255\215l\266\220T\247P\to\233\257\201\335\215\210\307a\261'\0313U\022\030\307mP\336\366\203\327\333%\353\271\333\325|\rv\266\"\276\024\307Y\330\360\342\270\rB'x\275\3556O\272\336\276\216t\275m\270{P\223W\314ea\232\304\371&\030\307q\324oa\215m\300\3316\357$\013\373\001\003\005\b\f\020\020\240I\t \311\204<.)%!\035\031\031\213\304w\350\266\354g\270\235\313\017@\013\361\324\252Z\302\276\270\201<'J\363\226\024 \260\346\003\376\242j\354\022-\252&\01303\035$\024 MZnbC\213\242\311\312\242Y\241\037"
+	.ascii	"\226\303\032\232.\376\027\r\303\276[\034\237\347\201\311\311"
+	.ascii	"\262\260/\316t\346H\326\001Y\0351\377\213\236\261I<X\002\371"
+	.ascii	"\235Y>z\361%\264\250\227;w\372\213v\311J\"\314\b\345\324\252"
+	.ascii	"Is\0165(G-MK\330\024G\"\363#2\264h\225l\344\177Q*sV\262\321\251"
+	.ascii	",l\212\027Y\n^\202T\374/\312\2055\032t\352q\264\250\224L|s\247"
+	.ascii	"\262\260\251\277.\347,^_\035\023pn\214\230\017\241\270\213\004"
+	.ascii	"\3464\2025s\313f\030\f\324C\002\363b\207^_`\\\316\235\320\242"
+	.ascii	"c\231\025\363g\035\004\346%\362\277h\0246\371\005\346\351o\236"
+	.ascii	"\241`\314\234\207\036\3428\356\374\004\013\363^zw\336\321\335"
+	.ascii	"R\272\213H\001n\250\200p\213\230`o\004ui_\332D)\303\r\257\344"
+	.ascii	"#d}\337s\246\207\376p\377\275\354\205\327\031\361\306\361\221"
+	.ascii	"\f\355s\234\016\t\326\317\274\355\022'\\\177z\333~\302\365\366"
+	.ascii	"\337\345\234\035\354\253K\323\353\312\327Lf\r\f\020\333\224\035"
+	.ascii	"\316\345\250Hr\211\343\246?Y\274M\021O.`d\177\266\317Y\253\370"
+	.ascii	"9\371\311\342\366\275\345:\375{-:C\365s$\01762\347\357\226A#"
+	.ascii	"\373\023\301/\225r\367\224\215\354\317\374?\307\032\305\217\371"
+	.ascii	"\\\355\357\364\216\310i\355\312\327>\312\313\357\316Q\225\375"
+	.ascii	"\351\357o\356O\240\020\022S\r<\362\\\335m\\\371\245|\246^\325"
+	.ascii	"\376,\335\033.\024sWp;o(\007\r\030\264\271\237\334\315\033\201"
+	.ascii	"\223\263\271/\225^\347\r\300\333x'=\316\233\311\331x#\235\315"
+	.ascii	"\373\350x\336Kon\2457w\32207R\233\373h\230\333\210\230\333\350"
+	.ascii	"\346.\262\271\211\303\334\357\233{\350\346v\335\334\355\233\233"
+	.ascii	"\035\346~7wns;\007\035u\324<o\323\347\003\266\305_\327E\261_"
+	.ascii	"\253\027\306\361\334\353\334\355\334\333\270\307\271\273\271"
+	.ascii	"\263\361a\267w;^{^\033\343\214\200\n\345\324\004\335\370]\033"
+	.ascii	"\275\265\333Z\036i"
+	.string	"\213\301\212t\204\202\035^o{\202\005\330\353\206,\271\332\342\257\241\331\"95A\f\357\034\033\007G\247G>\324\357\334\237@\251\336A2\370f\217\313?>\264\231\032|\021\272HQ\223\214\231\257-\301\227\317\340c\364\361\241\002\302\2259\336\351]A\276\024\202_\271\306\317\242\372\351\034\303lWE\\o\215\037\243o\017\023\220N\312q\210[\350a}w\004\017\025\277}\320\t\267\254\300W\256\270\336\276\240g\241\256|-\376\017Z\253~\314c\0226oKC\\\342gQ\3778\"O4\244\375\254a,\2604\303R\327[\342\373\235\263i\372\354T\307.\374\321\361\242\244(\256\0062\223\360x\362/\3541\221\336w:/\244\303\216\002&\316.G/m\036n\005\247\363AX<\3368\216\375\254\035\336\342z[\341W\364\305\241\002\322I\351\352\3004L\322\214\220.\274\222\017\021\230\242\357y\362\241v\374m\341\201"
+	.ascii	"\275\357s{\325\266~\021{3\372\201\273$\271\230\275\315\031o\216"
+	.ascii	"\f5\227\024\241|\370F\250~\032\344\247w8\347\003\207y\3411o\363"
+	.ascii	"\305\223\267\313\357\206\311\300f\262?\207G7k\236_\363\271:\351"
+	.ascii	"z\275^\275\351\270\376O\337\3319\326l\366\360\234!&\310\335p"
+	.ascii	"\032\254F\t\237\241\300j \363u\337r\231~\303"
+	.string	"{X_\034\025\020\216\314\313\320)\377{\033\367\203\247\005\372|x\233*@H\3459k\232\237\327\234-cp\356K\367\334\375\203\340\333w?#r\2161\363\265\331o\337\235V\246\177\340\354\013\351\013}\203\312\252\306\024\226\324\3337\264\252B\020{\n+\210QK\235\370\200b\031\202\204\211\017/P\2208j-\005K\2667XUM\t\371`l ZUVm/\265\024\260\275\334p\203\312\252\306\024\226T\221*+\b\220)*\034C*!=\256\250\262\334*\307\242\262z\036ZSW,\025V\225\325\215+\033\303\266\021\241\312\312F\024V\325\324U\224\215,\255\250\b\311\356\341\203*+\nH\217\036YQ\306\266\330?K{\350z\346\340\001\345;\bD\3756U\262\3001\200\364\256\227\311\340\351\001.)\272\262(\005\246\300L\257\267\351a_&6\006\305\t\250\254\t\201&18\311\001\350\333t$\371j\365\323"
+	.string	"\006_y\343\270k0G\267\332\317\274\205\372\202\301\376\\\013\213vd\b\007\274\264\025%\251"
+	.string	"&\022\320\264\004n\242\300\311\333$\002\005F\236\373\023\276k\264\035c\2460"
+	.string	"\253T\376\322C\035\321t\216\363Ni\364H\017%\372\226\273\364\355\3335\217\322C\375\273qZ\227\376\201+}\222\2315\256\271H\200]\025CM/m(Oz/;z\243?&\375\022\371G_4+\274:\255]\237\007\220\233\234\322\3652\0228\312\202)o\363\n\256\"\225\375\331L|\204\004\304\326\320"
+	.ascii	"0\340\340\225|\204dL\276\347J\243\024\331+\0371z\317\363\247"
+	.ascii	"=k\037\2625=6\216\3438\371\322\3661\323:\347\035\322\255\036"
+	.ascii	"d\332\306ywtE\016\200xej\347\274C6x\177\363\267:\205:\357\002"
+	.ascii	"\200\336\250Q,\005\231c\210dDDAR\230B:\240\002\021)\243n\021"
+	.ascii	"\020\261T\220\rMR\032\306MP\021\341\024p_\375\303\245\003\264"
+	.ascii	"\375\323C\302\256+\327\025\271'\024\025\242\325hy\327\362\007"
+	.ascii	"i\344\030\222\243\235^\005\361\030W.\227/\f1d\264E\314\315\033"
+	.ascii	"s@"
+	.string	"\211ZV|\005\211\\\373X\n$\037\223D\315\007\273b\375\310*\276`H:\200w\344\356aF\202\247\326=\2617{\272\255\020S\365\tgrrM!\265!\003\356\003\222\207$\341\321\311\210\251\262.\301h<-\013HL\024\035JJ/\223\006\222d\204X\033\250\006\201\371t\371\225\330\2705\023\246\230\214V\303V\263{\3263b\2253\245\217O\004\345\324\311F?\225\243\210\034\237\272E\335\322\372mj\025\213<dE\241\227Gu`\204k\245\325\b\367\363a\212\250\207\317W5dr\023\307\213\221;F\001\264\352\250\007\023!D\2327\356\224b\245\027\001\250z\255\307\022\fI\031\f\2329Bd\3568\276P\316B\2709\213\336\350\301\244]\241\nc,\300\313\307D|I\337o\032\314\214O\0272<u/\364\366\2064\367`\244/\22410\212%b%\004\335\345\b\256N\344@\027#\360\220\232\202\320\203\323"
+	.ascii	"\374\262\031`\3236p"
+	.ascii	"\255\341\340\007\375\313\324\356\203\020\364\322\013)\004\007"
+	.ascii	"\324\377\353/\357\354\340%7\300\017\032\204HO\370\313\330v\005"
+	.ascii	"\2109\215`\253\320pW,\267`\367\373L\025\024t\377)ZR%\273K[`z"
+	.ascii	"\\\273e\321\357\323\261\227e\242_\246{E\310\201k\270\367\270"
+	.ascii	"\031\234h\365\226\275\210;\231\361v\"\003\255?"
+	.text
+	.section	.gnu.lto_printMap.287.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\256\005\r%"
+	.string	"*B\274\016Fp\236Q:a\201)\231\245\223e\r0\245\205\374\213Y\345\213\322\341\273\313\r`\211\034|\254%\365\311~\263t\333CxE_\026\026Mq\234\037E\225\335\300f\033\036\201Y\246\336\017\246q\001\225\337\022B\310\336;\311\325"
+	.string	"\313"
+	.string	"\331"
+	.string	"B\002\362p\013\025\n6\371,\301k\251\361\0019\027\371\003!\275\331\311\364\266\373V~%x,6\332\226s\026\230\261\234\223\020zAzs\350\271\363&~\320y\263\203\335v\204nd\341\204\365\252\330eO\316Yw\217tz\234|\333l\3608\365fK\321\323\304\327\006\373\270\213K\216\361(<\216(k\352\352*Fp\266\006\312\337H]\341\242\253!a\336D\352\207\275a4\207\224\025>Z\273cu\262\333\250#\224\265\031\231\252z\2325Eu\324\307O\354"
+	.string	"K\r\217\234\033\"u\324c\321\232"
+	.ascii	"\216D<\224sV\2177,\306AU`h\177#E\205\037\2409\261R\217C{O\366"
+	.ascii	"\020+\327Z\326T\325-j!\347\334\326x\234z\003\275\273\323\272"
+	.ascii	";F\267y!\313\353%\007\037\262\3338\033t\215N\340v\367Z\330\033"
+	.ascii	"s7g\2652\341\243F\274\302\356\244\320^d\367\217\326\210J\372"
+	.ascii	"\026\351.\"\272\226?\301\271\374B\367z\347\356\365\007\035\313"
+	.ascii	"O \265\r\364\2577N\275}\354mKm\247\247m4\265}\246\266M\3246\266"
+	.ascii	"\331\276\251m\213\332\276\002\026"
+	.string	"hPg]V WN2\353X\372\311m\314\262%\377\372\301~1\377\330q\367\377\345a\027;Y\253\022&\004?\366\033\022&\263\216\263\013\211\032\n1@\234\251\220\326 LL\2447\373`\036&x0\34031\237*m\325R\313Y\nDz\363Y\300\203\316\257\030C\303d>\242aI\276\254\354\3119it\263=t_\257\031w4p\251\021\351\355\362V\254\242\230}\224\031eu\262E\211s\316\331v\221}\262\037H\03239P\242\333\370\252\367\366\3078q\267\350\002\350J\"\207\210\005e\2276\275\310\266\247\321U*\346\203\003\335\250n\240Kt\257\331\211^$\2668\242H\3558o\021|\1771\244\rm\237?\b\022\b\034\363\277S\275j\224\365\314\351a>\003sN3#\036|\3155'tf\034x\r\360\275\025\245\031>\026\013\230*_\370\"\307\\\350\236\353\224-\312\241\355\323\367v7\215\213\371"
+	.string	"h\345\234\217p\230\021O\032\021\351\317\034\315\bL\242\304yc\211\363\346\275\023\322\312~\355}\361\317\223]*\275\314\211\004Z9\017\217\272w_\223\322\234\207\024\310\\\340\025\230\303U\343\274\371\213z\255O\260\256\224=\331\375c0\304\264\363\241?\027; \f\036\220\022\020\305\315\240\004Dq\353\275\311\t\204\212\027\275\024;\336\212\333\007'\027\300\235\022/E"
+	.ascii	"\025=\245\027K\030d4\245-~;$&\0370E\332I\021z.\222t/z;\237.\251"
+	.ascii	"\351\247\213\220\353%&^\223\316ii\251I\247&\363\325\255\2526"
+	.ascii	"O\027\n\f\210s\316\252\240\246\305.\305\220\256G\031g\203\321"
+	.ascii	"\226\017\334\001\373\262\207"
+	.string	"!\235<\224p\350t\240\241d#%g\342\215\036R\"S\203\233'\210\020\017\263\265\243M\361\n\373h\017\363\345\346\254Q\302\221\222'\001\224\036hTlS\257\355F]\342\272\304\331\334Mo\207\020\202\336\024\275/Z\331\356y\337\265u\247\370\347\276\363\354b>\234\326\221\322lO\236'\273dr\273\310F\255\322\242{\262\247k+WQ\314vT\343o\250q$\303\224r\006\241\021\221`dF\333\214\001\200\002\031:\242n\021\260\2754tRh3%\236\001#:\346\364\201\204\320\272\206\375\001\212O\372\027>\002\016\f\024\263\224\001\013\227\262\026b\177\337\245\267\310\021\212\220\350\220\0012`\211dp\245\245\016\353v\317\355\371)\302X\006\320\337a$\205!'\243\243=h\326fP\022\320\225\205A>r}\031\342\265\317\023\f\"s\177\021_$\342\031\341\225h$8\017\264\305{\272\300\263\tE\306\244\314-L"
+	.ascii	"\266yn\331\2775\240\327s\006\362\341_\230i\322\256nc\315j\266"
+	.ascii	"\244~\312\274\275]\277\nn\265)d(.\375t\211\200\232\342\235\364"
+	.ascii	"\004\266F7\3516\003\344\247\206[e.J#@X\250\306\272\0070QKO\344"
+	.ascii	"\031\234f\202%\241\007+k\fESzqW30\364\233h\363\007"
+	.text
+	.section	.gnu.lto_cliMap.288.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\252\007\255-"
+	.string	":P\250\021C`\236J:\317h\361!\2257\313G<r\214\271\267f\360\030\333r\252q'\206\336\202\231w\327\261\262EqlzC\307+\033\314\200\330\225\f,w\332{6\312\3153v;lk\255\265\326\b!\204\310\235d\t\001\362"
+	.ascii	"\007\0018~\305\356w\360\301Kc\347\3368\004G\031j=\312t\3362\377"
+	.ascii	"\312\261(\237E\307\203\356MRe\314\275q\t\330i=\312q/J\217\256"
+	.ascii	"\037J\2172+\231\351\034u\335,\007xb\274\270\354\271\367F\365"
+	.ascii	"\022f\006\"\362\3723\356|\236\312\017\t\005\001%\221Gc\2218\\"
+	.ascii	"\325\024=\233\310*\371aY\037\022R{\020\223\"\026(\355I\275\035"
+	.ascii	"\310\223A\327\236!\347\003\033r\032\007\275\334\230\331\343\265"
+	.ascii	"\322n<\023\033\362\342\371\300\204\024\303\226\226\370\272\257"
+	.ascii	"\202x}\002\317\304\232|8@\211X\331\3273\201\233[\237\320\227"
+	.ascii	"/@\036\005\f\210UO\253\346\027x>\260 g\2042d?\212a^6\255\302"
+	.ascii	"\233\023x&Vv\364T}\200\301A\206u\235S\201u\312^w\373\025\266"
+	.ascii	"eO\"\224\261\367:v\242\363\200Y\232\261\363\201\0219\213\330"
+	.ascii	" \231\363\272\017\210\002\266f\255J\341\336\313\226\031&v.:\363"
+	.ascii	"\303\230\031\004sz%\215v\013z\021\362\303\330\270Z\327\370:\372"
+	.ascii	"_e\266\233\272\373\313\267-[\310Hm[\251G[\263-\217\264\272\264"
+	.ascii	"n4\376\007l\361\322F\324Ip\244N\335\313<=s~\\v\220\337N}A/B-"
+	.ascii	"[\310G\333\324\314*\254\354\231\357\327]\250"
+	.string	"\215\032\334\036Wg1\307m\331F\343#s\304\215;\t\263\024\324\323\345\316N\317\3627-)%\235\356\214\244Z>\032Z\006\260Z6\272\345\"\242e\242\324\362\320-\013\r-\007\251\226\223C\313\310\241\345\343j\331\250Z.\33621\265<T-\257C\313\352\320r\272ZFU\313\347-wj\331\242\226\317\300\001\2345\262\2635\357\375Q\350\347\356\241wN.\367w\371\351\336\314\347\032\267\343\034\177\204\305\177\356\315\327q\221\316L\203u\313\271(\337\345\306\357\362\256~xg\354\334\013\266\200n\030w-\312\313\005]\235u\016\342\341R\\\237\032e\242\277{RR\243y\364\334\240\356\330\020\022\223,s\007\017V\216\232\340\336Vg\005\250\313\363\0336\032\231'\365S'\331\332\342,\315\266\314n\237\331\242\017\2621kQw\2239?\242.\352\25312\324\374&\b\t}L\242N\005\227oR\037\366P\037\001\276"
+	.string	"\021=j\252P\377l\356\317\310\006\365\355\236f\304z\357\362L\376\231\243\tq~\355(\213\030\221\236y\224?\"%Q\302\236)\324L]\235\305\311\016j\"[[\241\027ar\003\262\223G\244\261\217\3056\262(\016\273\251\211I=\254\343Eh@\017\020.m4\276J\301\274y\205\374\360'H\005\217\226-D\033\215\3253\r\325(\223\210\277\370\313\221\372Y\346\376\270\354\340\331"
+	.string	"\307\362\316F;\216\024\251\241:\311\306V\2704[\233\2319\274yE\224v\357\235:\363\216\332k\3337@6mf\023T\366L\265\231\320N\333\236\001,\203"
+	.ascii	"S\f\023.T^\241\300\006V\224\212\030CVOA\343"
+	.string	"D\277\250j\321U/\254Z\240pA\2452\225\002\253\026TQ/\254L\270\210\242\302\222\021\245\240\210a\304\250\302\212\232\001\003\006VT1N\353\355\024\264z\353oC\020\376\376\360y\332\023\262%t\343\274\367l\202\0359[\310Ov\351v\277\243tR\324\247\204\262.7\030P\272)\245\3303\031A\033\224\227\271qJNs\017\236\240\272\033(KJ5\237\306\245VR\352\267\375\347\275\367\002)\265T#\331\250\2549\372p\252a\336\001TNY\347\034\365\003\277;\243\006\320\317\360?%\234\200\264{\271\246\230\225V\356\247\304\002\240\357^\256\007G\373\214:\207\234.pw\335\364\301\207L\262\360H\266\245\f\331h|w\247\356<z}X\013\217\274\256c\243\261-\376\356Wz_^b\216\277\373R\177\361T\340\362\211\221\311\336\313\337\\P\313x\244\321\271r\257V\233\273\251\300\026.\330\013\351\321\333\275\t\""
+	.ascii	"3\006\r^\324\372\354\005\200\240\250\201$\305\224D\250DDF$I\222"
+	.ascii	"4\006\200\002"
+	.string	"\231\251\262n\020X\250D\223\fc\2260}\340\242\240\200\224\"\364\003zPb\215\tp\362*\332\020\211U=\342m\374\226 \"\233`\372p\256c\246\221\203\225Mk\254\220\n\305:\031[\356\032<\320\353\306\344\233\341\315\300Y\020FA\224\261\211\331\302\256\231\371D!\035fH\220a2mFri\332\365c\372\333\f \373\355\2001\353\b<\002\274\366\264\245P[J[Q\r\321\260\215\315\205!\320\236\277\001\204\226\267\353\366\257\373wb:c\204U\220\300\367/r`Ln)\336\366N\3048O'GV\205\277\336\241\277\024 X?\034\223<_;(\n\016\361\202\213\206Z\306\373.\251\206\376#\266\357\307\230\220\bbe\377\271m\246'Q\331\220U\207f\255\251\2567o\233\032\271\032\350\177[\356 \212,\201[\322[\257\351\211\264\231Lc\004;_\231\007\255hw6\217\273\335[\376k\206\336T\262\317"
+	.ascii	"\301\307\234\327\020\304\311\200\227\374c\211R\3766r9\254\230"
+	.ascii	"\362\370\255\317\202\212\n= L?#\314\221B\243\025 \235I\026PW"
+	.ascii	"\322O\032\027\321ENV\003"
+	.text
+	.section	.gnu.lto_skipSpace.289.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\315\013"
+	.string	"\326UPA Q\224\016\2340B\001\312\"2\275\rq\270&\306b\0043\315\206A\224\007\244\024\302\t\260),\rsf\033\266\307\211\001*\230\364m\022"
+	.string	"RA\300\2161D\021\206 \223=;\365\311\336[\312\224\002<"
+	.string	"@"
+	.string	"="
+	.string	"PA\370%v\37041\277*\201\264\030i\240\303We\246\017"
+	.string	"Z\3660)\223\220\243\236$M\224\217\304\351z\324\031\220l%#\355\364\254\026\354\256s\244m\270\343mkl\027\260\217 \231\351W\th\260\340\360M\306\256\351$\307\216\300\220\021\266?v\305\266\363\034\366"
+	.string	"\273\035\234\213\335\316\200\tP\016o\342'>\306TC\026\372\240@\304C\006\0258v;\313\335-\361\220r\001\361\001\361z\220\0243.d\312>\n\013\036\212\b\037\213\207\327\252\264\225\220:\204\336\356\356\363\201\247F\255H\266\033\030J\210\362DW\210d\232\252\207\335\201\022\023\"eb\355\260#<\367\353\271;\227f\263\251\340 :s\341<\310X\0218\r X\231k\202u\261\270#AsY\024:\235\313\252t\373\367R!\324\307\370x1\022R\021T\017\037\365\233`\330\250\241Q\375R5\225d\333\003\356\t\025"
+	.ascii	"\3571\216\020\rN\244\214i\250\r\275\017-D\226\005 !\241\f\300"
+	.ascii	"l\024\210h\271C\261\313\226\275\233\261\347\317\f\205\312\022"
+	.ascii	"\334\322\247j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_checkCommand.290.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\266\001\355\020"
+	.string	"v!tF\360\320&\035\362\357\332\337S8\225)\022\036\226\207\310\032\027O\253\314\222\215\026\237\307T\266\330\257\352\035]\314\350\353\355\357\343tRP\307\350\334\201g\340\371\260M"
+	.string	"\034\277\246\302\212A\200s\272A\277\021B\366\2262\245f"
+	.string	"X"
+	.string	"_"
+	.string	"/\001c\325V`\305tH0\304C\023C\232\023\364\f~$\273\334.\222]\356\316U\317d\\U\371\253g\0366>B\256\027\316e\f\021\032b\225\220\370\220#\306\023\026\222\206\217\327L\354\222hbp/\226n\344n`\300>^\255x"
+	.string	"\307\006\023\207]k^2\252\032\312\234\323\352z]\270\265\333F\331>\261\325#\007a\001\202\250hfW6\270\322\325\261\277a\030\206\336\034\233\376\363w\007\177\316\352\222\325[\246\326\242:\213j)\325\321\352\215j]\365?\020\030Y\300y\217\321\2347\241\216Y$W\204\260\rcs\266\025\244p\243\200\376Gu\2209sN\244\230\023,\361\200\355\322\266\357\023\2732\256*D\270x\021\263m"
+	.string	"D\003\200\312\265\277\025\275+[\222\270ro\203f\207\037\233\360\262\3159\317\343\253\262\313\270\257\311\020\243\241\277\335\356\212\240\350\t[#d4\334Y\3258\332\3251\201\3532"
+	.string	"\2321\243I\356\364\313m\267\366\311\201\336\245K\322\332\225K\312\255\235\202\240w}\017\013*-)(T\352\323VZN,*\250O\363grb\371\274\226S\n\312\373\\\"x&#N=Xq\361$\244R.\036\007\316\307\2719V}\320\003\034y\210\017\372a\017\221\246-m\215\355\322\032%fe\342\234sf!\272\255\255`\201\336e\322\266\333m5f\340_m\005\330\370\b\2658h\fC\013\"\371\222\305\036"
+	.ascii	"\3571\376\210\267\244\t\002\007\205h\324\r\034-fP 0\330\255\217"
+	.ascii	"580-\300*\240\332\031\246\b\306xzlq\360l\307\005\3105\225\220"
+	.ascii	"#\"\327\004\016\n\301e`\004\250{\307O>\027\226\273\340SG\031"
+	.ascii	"\reM3"
+	.text
+	.section	.gnu.lto_cliRebootEx.291.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`/\001\025\016"
+	.string	"\026\031^F\360\224\223\016XP\203\026\370<S\236h\371D\2162B\216>1\327\323\261] T"
+	.string	"B\200\252\275\366\323\365\034\201\341\200\251\306\242\351-\345B\321\220\026/On\250"
+	.string	"Z\233b\242\267\270\370\243 k\210l\"eJ\001K"
+	.string	"E"
+	.string	"I"
+	.string	"\254\004.\340y\264\311\016\242\262av\240\0339\034b\030\231sj\213\342\246\307k\325\344g_\367xa+VE\274/\304\367:P\223\003\004\312\207\272RvL"
+	.string	"9\316\265\303wR-a\231sZ\275\357\303\215\335v\213\355\005\366U\001\367.xR\232\201G[\006\203\336\363q~\025\340\027\242\266\263Y\235\256\215\375k\356\t\373\253\377s\251u\325?\001\021\271Q\375EkN\017\255$3\2146@\3337\261\255j+"
+	.string	"\231\276\232Q\271\220\036+\034s\006:>P\212\304\003\324~\340\262\240*<mg\001\252kC\210 \34332H\3306\354Qw\304c\004\212~m\016F\357\231\300a\\G\203\177c\321H\357=\372#\354\361\233\375\330qD\004\215\266\374\321\347\234%\003\244\2303\025\206\211\021\225\244|\341Z2"
+	.string	"'$n\302&\031\224\244|\311\034Z\021Q\bi1\242\255\202\026\"\311h+)\226\0268\222V\222\222\244\231\260\346Yh\366\024\033 "
+	.string	"[h\215!;%.\007.4@\022\341\351,\274\232p\327\306\366\f\366\331M\351p\021\035"
+	.string	"\357b\310\f\rFR6\300\026\201\016\326\036Q\026\320.\026\304"
+	.ascii	"UE\005\270z8hM\023\315\275\266-\223\204\265@\020\300pU\356\260"
+	.ascii	"*\3378\341\036\327\304\307L %5y\334\345\226\366S\271\305\\,\217"
+	.ascii	"\240\366"
+	.text
+	.section	.gnu.lto_cliReboot.292.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 \330\005\006"
+	.string	"d\n\206"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\333\3275\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\347\275\001\226\216\217\274\257\003\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\360\371\320\373\332\002"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\001+\002\003"
+	.string	"\203\003\202\360\371\340\373Z\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\t"
+	.ascii	"3\003\236:C_\270\3175\234.\004\177\031\027\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_cliBootloader.293.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"m\t"
+	.string	"\246QC< \3458\035\300j7\213"
+	.string	"e\276\234\352\210 \267}"
+	.string	"V\2043\013\020\0206\205~\030O\330\213!\btm\255(h\310\237@h\242\b\323Pp\005\037\026\302\3302O\300g\263{\247\024/"
+	.string	"1"
+	.string	"4"
+	.string	"\3178\027\320\236Y\264e\b6v\\h\211\3418\231\331\335\215\206\\\374\024\375\227\274C\252\306\317\r\303\356z\222*\217\233\336\266\201\355\006\333,\001 \3665\273\273\246+[CY0\251\216\217\267RvS\001"
+	.string	"\254+[ayl\177\332\0379\211\370\326\305\003vW(*\273\245\202\0178\317\\\376\243\005\345\236\256\354\020s\301^\0304\303\235\031\272]%\022X/.m\276\274\311\304\200\310.\352$\005\007\025BxfWX\314\223\236.\261\022\366\322\240\243]\216\223\006\356H\325\004\002;\322\250\226\302Z\037@\237\007\202\370\274\020\034\205\247\016,\350>\257D2q\033s\"\257\304m\23772m\034x\332D\037\327\210\016\334\302Z\301\315\023\013"
+	.ascii	"\357b\310\2046\342qpa\221\212,\245B!\030r\t\266YM\001wy\321N"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_cliExit.294.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`7\001m\016"
+	.string	"\346\332bG"
+	.string	"\223\223\016\0332;\2357\254\371\034\032*#\325A\340x\253i\352\r/cD\022E\277[\275U \243\f\030\200\236%\023\025Jq\b\202\004\374x\317\313J\244\226Vi\210X\376uI\372$!\334\373fw\333\275S\nI"
+	.string	"N"
+	.string	"P"
+	.string	"!\333\227\366_\034\306\3511>\\\300\256\312\205\216\335Q\201\021\200N=^\244\236\202>\240\236\372d\373(\020bQ\fr^\"n^\273\253\315\024?]\236\374\333<DL\241.?\020v\327RL\221\270\347m\037\260-\262\317\"5.\201\362\342\251\017\326\323O"
+	.string	";A`402\346\217\374x\031!\001\025\2732\027[@2$#\247v\007\017\362\242%\217\330\bs\201\230({D\311\211\302\276gw\327SeK\351\207\346\352\304\314\210\022\267\311\261;\023\003\262:\024gE4\006\244]\341B\202\225\t\235\030Q\365w\034G\224\301\304\244\236:h\261^'\325\277q\034'())\365\024C\213\325\302W\251\266\027\334\206\212\354\261\273\r|\032\257\261\3715\247\346\272\256\236Z\330\211\275~\004\220\237\266\267A^tv\326o^\374f\tAR\026v+\337\246\201\313F\235\313\026~-\031I7\002K\231\004\n\021\262\225\317s\331:\322H\367y\244Q\211\373\230+\361H\234\366y[I\343L\241V\"b\220Cg\322X@\320\244\205\306\275g\247\312()\027\314\0053c\354\277\324\234\007\255\031\023\346*\032"
+	.string	"\357b\310\304\313\245\321\342B!\270M\343yC\003 \027\334\250\351\"\371\245\037F8\b\030d~4\371\031,\006\311\267\2529\252\374\260\272~a\2028"
+	.ascii	"\243.a5\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.295.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\355\007"
+	.string	"\342\21787@o\323\001\230N:\375\202\317q\021\3329xD\344.\3755R\b\030\332zdK\220\351\313!Wz\335\366\005/\303@p\353\344\342\t\021\236\307e4\276\365&[\246\024\035\220\346q\370d\2273\216\346\311&Hk\370\314\214\013M\316\306\333C\207\233\020\333\306M,\334W\033Ac!\246\323(V\370\322G;\024\241\377\\`\021=\373&?\231\360?,!\322\177\227\276\310\272|\f@\261\210p\2144e\207\236F\017\373\325\356\256#h\253\372\325B\t\265\361\024\230\335\214\324\314\236\244\013\bf\373j\177\344$\335K(.\260\013\252\264\354\206\t>\320\\:\374\306\272\324|\300\272tg\307\020\\\254\247\360\322\201\201\"\263\2733\226\336];\377\246\003|$\357z1\354\256\365#i\334\361\266\rl#\330^\t\t"
+	.ascii	"\357b\310\304\223\276h\217\013\333`\310%\330f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_parseOutputIndex.296.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\345\002-\030"
+	.string	"&\255\243H\240\230Q:\020v\312g\230),\203\021\323\365\232\247C\003\344U8r\320\376\221\236X\330l\034Y;\320\361\267\340\026\t\3358&x\215\363\200\327')B\272\211\367\200\361,\311\326\206h\025LA\246w|B\b!r\247\024\216"
+	.string	"\200"
+	.string	"\222"
+	.ascii	"\265\002!X\201\371\321@\323\266\237\344Jr\366\326\206\246%\237"
+	.ascii	"\004..NA7\265\326\331\371\035\362\243x\002\344\307\r\362\334"
+	.ascii	"_fI\216\342\322\234\257\373\353\301\277zp\235Q\343\343I\352\346"
+	.ascii	"\227\244^\346\370\240N\2124\251\250\177\241\021%Z\240\n3\006"
+	.string	"\346\343\321\221\0342\305I\317\007uQt\220\246J\233\235\031Dz0\037\023]\221\007IW\226\230\257ID\220\325D\365\340i\f\337\216\322\362B\255\325\264\347{\272sn\033\312\266\f\233\036\t\264\313%\r\2606N\211\276\027\333\007?\340M\225\225\220iu6PG\367g_\254;e\277\311\257s\254;v\340\037`\251\315\245.\227\232\024\251GJ-R\352]j*R\177\247\200\2302Z@.\005M\2553\206p\252p\264R\344X\277\235\363\203\206\371X\336z}\252\207\001\206\253K\232Z\353\203\217\246`.\265'P\310\275I\213\003g#T\242\245\301\251\375%g\222;\320\305uj\235\202B%e\252\270\204\273(?\260\314\375}\337Tm\261*\237u\255\023(L^\210\255#B\326\364 \367\347\267 \305}qEFgw\305]3NQ\037\336[dlw\r\310\230\242\345deG\207\213\204\215\r0\243"
+	.ascii	"\032\333g\375I\315\300\230Zy\357\r\231\274\036\006DE\364=\037"
+	.ascii	"JU\025a\323\352\354\254\036\031\034\342\376\034[s\325\205\211"
+	.ascii	"v\371K\367Nq\226\350\3209\324Vq\243\357}o\305c\267\272\037\213"
+	.ascii	"\021**\273??xl\227\027fx\345\205)\226\t\361\234\020\316\bg\005"
+	.ascii	"\037\r@= N\031\b\037\f\035h@\247\b\332\007\0214\017g\206\037"
+	.ascii	"\016=#\200~\026X\206\263\331\202\bX&\304s\236DFE8\232\016\213"
+	.ascii	"!!\243\237$\245\243$\245\033\fW\303\371\330l=+n6[\020\200\024"
+	.ascii	"\265\243uMVd\253\315\214\212\202T\314jH\270\231l\307\267\243"
+	.ascii	"!\244Y\322\355\2064\203\001\353\305\272S\216\335\330\241\243"
+	.ascii	"|\215\0339\316\230\262\233\033\303\266\271\276\260\264\273Wy"
+	.ascii	"\205D\002!%L\036\221\211Svr\313\275\024\236\216q\311q\017\004"
+	.ascii	"1 \200\002\021\262+\017i\036\032\345\325\347}b\204Q<f\211X\263"
+	.ascii	"\3676\266\345\274\033a#\310\221q\f\035\353\017[\343\356\311["
+	.ascii	"\364\005y\031\034\247\347\222>96,\fBN\363\234\213^W@`\315\273"
+	.ascii	"\265d\265\317$\027&x\330\333\320\370\b\266\030\023\031\216E\244"
+	.ascii	"Y0\327\253I\272e_\001\313/\327\322\027\372\252\001\340~p\243"
+	.ascii	"\377\257\311j\225\265>("
+	.text
+	.section	.gnu.lto_cliMixer.297.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\006\375&"
+	.string	"\212F\250\017C`\346Q\007\363\207v\007\b4\036\253:\026*R\250`\036\270\214@\021>K\001O\302O\002\206\374 \326\275r\216*\016\236n\025\366C\353z\201\212\034\304]e\247\306oC<A\3267\031{o)\223L)\346"
+	.string	"\327"
+	.string	"\354"
+	.string	"x\350\356\2349\347\006\216\333\201\352X\351\272\355\3661'[\275\f\210\033\345\3545\266&g\345\203N\240:n\245\013Q\307\252\007@\035\257\335~\004X\345b\005\272CW\314B9\347\341[i\357O\233\200_\2457\357\256\016\374\371\212z<\"5E\203\370\276]\333\213\016T\363\020Yak\306\352\252p5\361\237\226#\356\353\332\242\005\305\026\245\3110\270\336\325@\366\005\314\343\264\236\3347Ks\343jN,\317\227\016\"\t\346$\312\002Ss\324\242\304\325{\341\351d\3638\255%7\265\312\302\342h~`\213\026\023\233\362\266\2248\352SM<\350qZ_\275-\243\305h\362kn\254n\nW\024\277w\203[\222\254\337\226\325\265by"
+	.string	"\371\322-\326V\225\375"
+	.ascii	"n\323\0169\347\266\307-.o#\357\366\021\335\335\324\215A\004e"
+	.ascii	"S\366\316\"\t\363\346>\262\341\370\374\314\315\020_\356\315\331"
+	.ascii	"5\226\263\321\2176"
+	.string	"T\243\204\005\216\373\332\242\027>V\003?\372\277rK.\363T\331g\373\037\275\243\271\262\233\262wMd\205\337\r\245\303\372\321\337\227\356E\232l\264\352\234U_\354VRy\206\"\231\265\177d\273U\342B\345\255\337\253;\t\311\315\274\217\274\314[\350iL\357\340\265\r\274\266\177\330\266\317\313\334\213<\315\273\207\332\346\241\266Ul;}\333(j\033c\333\027\333\376k\333\276m7\340\243\271\264\303\244\263{9e\316\2723\224\3410[\322\323\334\231\356f\376\335\256\246T\245\314[\274?ajc\205\374\254\035\215\371c\b\231\240%\316\234\225\021T\307\326\227\335\353V:\231\325\315\372\3153Wv!\001\3173Trh\003\254\372\236\346wV.Hs]T#\n/*~\315\266,uN\253/\006\365\020ZS\037\331DM\324\244Gj\266\031A\333\177\240\301v)T}\237\022\303\3514\325w4\277\203\236g\352\330"
+	.ascii	"\b\242b$E`\375\314\345\254b\204_+\231j\374\260\216Y\262~l7\243"
+	.ascii	"'\n\234=\2121Q\013qq\304\202\357\325\351\007)`\3217\037\324\020"
+	.ascii	"\252\221\303\002\307\"FX?\246\257d\374b\037=\372\274\254/BWv"
+	.ascii	"\027\372\030\235\370\221\335=\300\342\3673os\002i\016\205j\244"
+	.ascii	"\320)TX?\366\004)V_\344\341m,.\264\263q\266\026\327\005\f\024"
+	.ascii	"\006\352\030\377\020\214\r\202\377\337\037\3004vQ\331\273\266"
+	.ascii	"\377\357Wv-\303\3250\2519WYhG\343i\232\332\2578n\247\032\270"
+	.ascii	"\275\006\352\330>0\315-K\027Y\375\241\304\222\t%\017\"H,\255"
+	.ascii	"0!\302w\033\203\323\323\f\246'\"\023\217\245^\357\220\">\341"
+	.ascii	"\226R\240\204!\312\251\007\261\004\257\235\3508\234\236\336\t"
+	.ascii	"\007\361\211\306\215\246\264\233 \020\237\232\2068\210L7\206"
+	.ascii	"MQRC\b\302\206\312\341\0245\334\001\005\0255\354)\247\374\275"
+	.ascii	"\272\303\324S\271\001>\022\217\033=\322\363\351\266\224C[\203"
+	.ascii	"\342\325\346w\213\214\276\367X\335\300\357\226\341\200Vd\202"
+	.ascii	"\271\234\263\023\3679\006\232\262w\355\276\"\321\337\003\337"
+	.ascii	"{\377"
+	.string	"{\002\311\260\273+;\002i\240\320\371\036\351\373(\336\373\336\367\350\231\003g|;{\314\312\024\371\232\363Y\255$\370\002S\215+\304\336\262$!!\373\322{d\247p~H/l\276u\005\275\216\033=V\3039\357\243^x\2369\336\273\232\337\346\363\r\f\333\315\fl\367\232\\\265\020i\266\255\251sR\021=2\351\235+m\250Q \345\0344\206\031\231\221HD\333\244\003\200\002\221\261\262n\021@I\213lS\320\314\001\241\206\372\030\303T\372a\007\236\036\321w\r\016\260\\\243\234]X-\225\236*h\267\347Ym\336\022\303A\006\367LxK\343\323\221\037<~f*B\2355=\272p\312`\212k\250\316lJJ\306\272\246\272\354\024\r,C.q\310\nY\264\313\220\b&\222p\330N^\353\037\034\t:_OO\366\243[\0235\320\307\321\212\020,\341Q\234\251+\323q\227\272\360\366\221\001Z'-\272$"
+	.ascii	"\231\357\201\n\264|\270\275b\356IJ\210\361\362q\021\371o\305"
+	.ascii	"6\277>\332\223X\315J\322\346\302\273\226\320\227KuA\310\316\t"
+	.ascii	"y\360\3474 S\367j\004\007\300\314;[t\030\303b\267wT*y\033\204"
+	.ascii	"\302M\036\330\304hei\365lLua`\322\212\266\016\247\001"
+	.text
+	.section	.gnu.lto_cliMotor.298.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\365\b\0356"
+	.string	"*_4\025DP\344U\007S\001A7\332\324g\246h\265\214@f\267\222\337\232\t\352\233I\253\235#\013\177\320\3324\326\201\226\312\277\345\3048\r\r \025\020A\002\020A\321\033x9i2p9\\\031\305O\366\336{K\231R@\0010\001C\001ip,\224\301\302`\324\321\301\332veo6\tc\260\200[\272_\271\307*\247\272w\023\002\334|1\361\2339\233\337^\373u\334\261\316\251\356\275\207\337:\021\376V\310~v\177\262/\213\037\f\326\023\355\355\204\214m\357\246\003W"
+	.ascii	"\177\353\315\017\272\337\302o\344~\033\273S\223\266v1\2025\r"
+	.ascii	"IFn\357\335\244\241\3000\320\337\353\365z}\266\371\256\323\361"
+	.ascii	"\007\217\214\212\210\200?\037Ro\210\267\323\301\257\333\262:"
+	.ascii	"\307\376\273\256\342\007\217\234U\336\250\210\210}\267~Xy\251"
+	.ascii	"R\n;!PU\315\247Q\222\201Q\376\347\373\254(\217$UZY[\346\336\213"
+	.ascii	"\341\313\213\312\017I\225IX\341\336\373\263(\221d\036{\300\211"
+	.ascii	"\222\271\227*\247\260\302\266(\362\263(\217\344\235Tid+\353\020"
+	.ascii	"<\361*\362\360\033\026\306F\344"
+	.string	"_\266B\231\230\224\227*\211\260\332\f\315\315;\037A\026%Xv\221\273\256\243\033\234\302\206\212#\370R\022\321-\225\025\312\347\313\253\310\263n\030\330\033\331\334\227\027\330k\266\301R\016\020_\227\026\033\254\323D\317;?su\031s~1\354\275='\273\274\336\001\274\373oqw\037\356/\224[?+rdb{\211\034':\025\336\273\370\313%E\353\333R\034w\247\376/\341([\271\233{\351\333\237\036\202\266U\347\252Z\271\220v\233\232\231i\215\362\243y\264\023Go\311G\363nP(\275\355}\374\244\n\370\310b\301\267I\332\335\351)\177\222\200\316\316\351X\364\250d\354\223\305\366\262;\013\251\374I\177\347tH\324h\264\243\316\030\255\231~\303}\275\342,\217V\016\344\273\234\244\335\251\252\362'_\277\363\237\007\024\316\222\271\252\226.\2727\213Y3\335\177B\2175e\\;qg\"\016\227\024\274\332\273\260"
+	.string	"\001\001o\366"
+	.string	"\017\346?\351\331\336\201o\366\376\3731\357\276\336\247\275\017\361vov\235\233\035n\263\277mv\267\315\336\376\231w\226\315\256\331\354Yg\377\0078\332\234\271\221\261\232\321x\232\373\307u\320\216\266j\302\236\355_\355\337\354\177\314\177\231\377\264\3773\377\272?\375\3238\217m\007\034\240#Q\217\306\177\315y\337\252\341\020j5w\027\357)\026%\223\033\001\177\373\177\366d\036\355\315\274\323yg\234\r\273\3236X\337\\\331{w\b\001\264{\\\026\207\311\237l\365\257}\320I-\"@\007\320\236\223}\262\362\265w \377\330\336\267G\363z4,\330"
+	.ascii	"\037],\340\320aJ\r\362\026\201\202\034\322\314\267\257\341jm"
+	.ascii	"u\006\375]\257rD\276\206\233\265\326/@g\020qbOd\241\254|\365"
+	.ascii	"eY\353\301\323\375t\001\315\345\272\236\026\240\343i6\277\263"
+	.string	"q\013\350\2442i\321\217\033\034\001 eb;\315\364\033\326A\310'L\324Q\3269\310';\374\237\346\302\262\022B>a\246\007\002m[c\th\037<\224\242M\b;\374\036\274\363\301\016\237\247\271\260\\\237fP\326E\214\0377v\357\275u\232\351\357\374\326*\207D{\227\264\273=\355mO\017i.g_\236\016\316\n\207|\272C\355l\313\323;\315\225c\tf\007\305\377Y\202\371{p\231\364\013\232\n\212\036u\321\211\377\323D\375>\303\360\034\227\306|\365\207\363\257\343\f\362Q\204\003d\020!\362'\227\370D\265\346\374;\247t\242\257f:\323\0175\2032/b\374\270\301!e\342\373\264;\t\023\371\223C\255\327L\327D\267t\321\277\355\r\314\331r\325b&\364L\232L\311\270\232\tu\007\001\016\245$\244 C85\345\364s(%!\005(%a\3177\220\370\220\241\204\353\302,\365W3`\\\315"
+	.ascii	"\001\354\0205c\312\251\204U"
+	.string	"\325U\025\325\316\352\nF\024\r'\031o\213'\030\332F\024\324\013\2516\352\205\324\024\024\325\323\353OLRSOM/\244\234\250\232\236\254d41\005\275\nF\224U\323UU\225U\023\257\271\325\036C\2266fo\026\325\202o\233-\313$\003\346\204\0049\302b\367\376\272P5\313\3277z\"'\325M\324\250\213\336\253\023G\245\250P\314\244\t|\214\177\355\213\234\3240D\232\351\275@?\005\372\235\2024|\240\346\002j\235\316V\316\240\260\326\351G\026r\220\335c(\261\224\374IX\377\221%F]|\004chC\200\304\007j\005z@\334\030\2357\305\007\362\247\322\334\253?\315\213\210\033\303s\254f\345\253. =\023\367k\220\205\232\325\377|@q\225\003q\030|\214\021c\211\265d'U\213\253\335\235\306\377\361\347\201\267\275\367\004\377>\357'\346\342\017\366\255\307]\342\261\374\311x\314\375\366\223}\204\332\325"
+	.ascii	"~\210]\217Um6\205\216\357u\233AQ\220\264\223+\253[\244\234/g"
+	.ascii	"yZ-\324\331z\204&\310\001\200\262\250q0\244\224S\246FDFDA\222"
+	.ascii	"\250\003p\002\021\262\252z\021\300\265T4I\222a\fe\006t\366\335"
+	.ascii	"\363+\302\032\034\370_Q\200\025c,\230\310b\273\302\232\350 p"
+	.ascii	"\257\311\221\354\345\360i\363C5\321\317\221\363P6\237\314\\\320"
+	.ascii	"\363%o\375\362\027\3620\312\211D"
+	.string	"W\247\277C\217\300\303\240_\377\337\"\234\375\002\323vf\324LX{A\002\241I@\360\244\246\344\334CG.\347X#%rj\364\347\r\035\320\271\2650\261\2249`\311\272@\276\324V\361YD\315\247|I\306|\272\277\370\367\200f]'\352\271\035\241\266z\023Y\263\365Vz\203\272\r\212\325\006$&\231iy\210\343\252\364V\371\310\252{_\265\303\005J\006\326a\333\207#\206-ky\324\017\373\261]#R\225;1\2403Av\256\325xf\204\2407\030O\372QNL#\311\333\004\036p\373\337\320dd\022\251aK)b\320D\205 `d!\361\327\306!ifQ\b#h\374#7\263\030]\354\202\341A\335\366\250\200\316u\001,\306\371e\003\260\220\233\261\264%\314n\337\274\376\257M\274\377\242\2741\241\266\230i\346\024{(L-\305\373\371\001\320\202t\356\353ub%s\\\002H\347\355J(\005\247"
+	.ascii	"\306\035R\305J?\262Q\f\266a\206{R0\200\022K<\036rS\"\324"
+	.text
+	.section	.gnu.lto_cliPlaySound.299.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\354\004\255!"
+	.string	"\366\273\330Ip\334Q:\310\237\331\373\372\032\211z\302W}\212\302j\350\243\355\206\366u\255NQ\233\240\307\377\265\275\246\272\263\271y\202\256\324u\f \312\275\021@|\2269:\364 LpPBH:\241\371\001O\325\321H,!d\357$\003\300"
+	.string	"\265"
+	.string	"\312"
+	.ascii	"O\373\250\373\267\373M\256\004\036\254\305\001\344\2745\005K"
+	.ascii	"\316\355\201.\260>\355\366A\352\323\365@\352\323\006v\273\tp"
+	.ascii	"\225\203\013\234^\304199g\036\006\322\350\005\236g\307\306\256"
+	.ascii	"\267\232\232\242=\370\002\3736d\360<D;5.0\033\332`\214\0210\252"
+	.ascii	"\217,@\336u\304q\331\032\322\005.e\333\344\331\003K\307W\334"
+	.ascii	"\221\031\277\375\354\250\325u\264qk\350\003\245\227\220\033\222"
+	.ascii	"\210\3420)^>v\242\256c\216"
+	.string	"\253\322xzC\016\257.\272\316x\017zt\006\t\216\237\035s\240@7\310\316\274\353\230u\361\331\361\006\272\3139\177\354\327\210\024\336[C\3129\367-\"\261\336>\357\276\332\335T\335(\211M\244\331\321/\316\341\227\r\265\204\247\362*\335\245O\244\253\232K\332o.\352\323\213\251\322\310<m\270\270u\236\204\312\225\031\214\223\255B=\036!\266\306\352\316i\366\372\340\356\037\212\373\342\361\307~\030L\247\331\023\315\n\007\273\333\340\305\3116XF+\215\267\272\207tB\271\037\334\301~\237\267o\033\273\036\312\273\246\336V\323\333iz\033Mo\343\364\366Eo\237\b7\2312b\324\370\3272g\031u\350d\263T\013\027\276o\177(\307\335\377\223\217\365N?\354b\300C\351.\317X\371/\3148\231\240\345\234\023\254Ow\350\201\324\226\005.\237\345#\223\316/\264\234[\243\027\004\244\311\260\016+(\335\230ihO\264+"
+	.ascii	"p\332$6\234\354\037\334\217R\267\241\303}\021\207\317\246\371"
+	.ascii	"\305\346\356\243|\313\207\243 9\017_\004\261\016\025\030\b!\342"
+	.ascii	"\276\330\227Ms\207\231\025\016\016]\311z\263b*Y[^nx\253W\234"
+	.ascii	"\2529:\212S|,(f\235L/-%.\303"
+	.string	"&\254J\r'[\307|\202\245F\037\360\374\201\352\360\212\215d\037Z\263\016e1\237\255\212\2237\347\034L\321\333\212\243\234N\210\313\236\034\256a\243\016c\374.\2612\237\333\335\364t_\304\270\212\207\260\206u\330C\232\031!\232(ZB4\347\234Q\234\354\237\301\231\230!=x\213\205*\204\245\304\324\360\334\034\356\356\231\270/\n\341+&=U\264s\340TT\302\327\253b\202\322\020\324NE\273\025ON\276\336N\352Gb\347\344K\361\233\332\375\222\204ZBR\007\245\r;\nI\026>@\300\240a\267\244\264\2644!\327\373S\024\223\017}\362\365\240\234\242\232j\335\204\240\007\325\304\363\365\230\242xMRS<\004A\375;\361$\305\243\372\375\244x;m>\222\013,$\343qN!J\301B\370E\234L\342\222\375\301o\343$#.\325!l\303F\234[\3438\313\210K\026\207\033UW\314bcw\321U\225"
+	.ascii	"\227\354\b\\\026w\003\225@'\367E\025\0335\313r\327\206Y&\204"
+	.ascii	"\240\b\353P\004n\2061\033\342`\013\270\335\024,\0305\301\230"
+	.ascii	"\tq\260Y\034\206CZ\234\333.\213\370\330\301\341G\371\227c\250"
+	.ascii	"A4\003\0252\310 B\"#\001\215\250\230\003\200\002\221\2423\017"
+	.ascii	"\020hY\223f\r\306\033\365\331\213\003\365!%\023%=\231\314\002"
+	.ascii	"\301F\252\020a\340\325\366\002\206\264r\243E,:\245\b]6\250 \220"
+	.ascii	"ND[/\030@;;\003Y\013\b\276\034>\231\266p\231\365\254W\306:\345"
+	.ascii	"\212\222|S\227\253h\277\364\320\314\304p\007\212%.cAa\b\033k"
+	.ascii	",\302v\236P\355\363Rz\365\001\267o\323Ji\1774o\366Rg^\356\240"
+	.ascii	"\320\200\033|\303\021\"\276\301\270\"\212/ZP\312]\007$\034H9"
+	.ascii	"t\301zt\215\b\226\254\326\221r\342h'2A\322\323\300\207\336\030"
+	.ascii	"\300\225\203\013\371)\026\321\246\236\203\233\032\032\022`\350"
+	.ascii	"\352\300+h\214\370\017"
+	.text
+	.section	.gnu.lto_cliProfile.300.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\r\002\315\022"
+	.string	"f#}H\260\226Q:K\330\257[\324\244[\300\273\357=$\020\320\203\2765\305?\360J\b\275\266H\2570f\305\252r\263v\352\024\240~\007\304\367[\016\2349\354\033\353\017I\341\204C\035g\211\262;\t^\r\242\366I#{K\231Rg"
+	.string	"`"
+	.string	"k"
+	.string	"s\356\032\030\001x\351\335W\276K\360*\337\245g\266\022\002:\223\366\200\311i\307\250i\316\331Z\027\276Wg\007S\237\214\2533\377F;\370\032\320S+\032(\376\241\334v\336\263\251|1A1a\361\003\364\030%\020\r\275@\271\351\304-\272\001\344\272k\317-GW\345\232\202\231sZ\303\333\317\255\272m\036\333\021l}\t\366\216\3668\347\234\273B\276B02\004\206\027g\237w\257\244Z\365\334\r>\367\313O\035\245z\243ZW}"
+	.string	"/-L\254\270\256\310\234>QO\023I\376\230q\336\355\357\374\236\215\027\315\316\033\361\3713_B\206\023\236%s\316\005\227f"
+	.string	"^\266\304\263l_\355\3278\321\3549\022O\231\023\227\363\021\275\263\226N\354\221\244\242\034r\205l\253\350\356w\327\221a"
+	.ascii	"\022\r\240\315\2017\304\350C\267\350,\315\272\273\337\261\003"
+	.ascii	"U\323(\243\250\375\362\240\0175@\222\322\023$\034\226\024DC\261"
+	.ascii	"\367\003B\276\033\375\bf\363d{\370\001\264\271(\270tT\271\340"
+	.ascii	"\366\330\"\276/\007^\222\034u\262J\301\265c \364\341\367\272"
+	.ascii	"\263\224\232\220r\226\026\226I\320\362\232\201u\210\311lX>\354"
+	.ascii	"\257\032\330\214\f\215+e\227\013l\306\325\252\201\305\320\264"
+	.ascii	"\\\262\233\226\313\212c6/Y+D,&k\261v\363\2133Lmqb\200,jO\240"
+	.ascii	"\240;\214\001\036AMR\005T\265v\005\013\357=%iI\305jUk\r\227j"
+	.ascii	"\032\205#\b\027\344[!\353o\276\2702\036\221\325\306e\371\034"
+	.ascii	"\365\020p\001\203>\\\355\003+ \200\202\031\272\353\237\030B\321"
+	.ascii	"r\317Q\177\255\225j\341\021)\345w<!\255\347x\303\314\004\250"
+	.ascii	"\371c\344\265\363\303\262\326\260\277_\314j<\"\r{\234l\331H\315"
+	.ascii	"\251%\0342\026F\r\270\261\240/\321\3020\001:\234w\366\306\232"
+	.ascii	"\023\235\257\b\222\212\217\254i\364\370\364\2536~\301\306\370"
+	.ascii	"\370\271\326>'"
+	.text
+	.section	.gnu.lto_cliRateProfile.301.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\021\002\365\022"
+	.string	"\346\343~H\260\226Q:j#O}\335\261\2228\370\370*\032\202\r\007/\200\360?\302C\304\331\270\273\235zD\344V\271Y;uJ\330OO*\303SO\234\260\366\221\367\003r\350\245P\231wJ\376\251\bN\b\243\366I#{K\231Ri"
+	.string	"b"
+	.string	"l"
+	.string	"KLs\352\032\030\001xi\335Y\276K\360+\337\245i6\023\002<\263\366 jEO\022\324\234\323\265.|\257\322\016\252>\031Wi>\256v\360\266\240\253X6P\374K\301\365\234wS\t\213b\341\244\005P\320c\214PD\004#\005\307\023\027I\207\220\037]}p;\272+WU\314\234\323\032\342\200\356\325m\227\260-\301V\230N;[\263u\265\3079\347\334\035\362\025\002\222\"1\2749\373\273\233%\325\253\033\335\340\215~\371\251\243ToT\353\252\037"
+	.string	"\206\306\t\025W:2\347\317\224\324t\222Aj|w\373:\237\227\343H\264\357F|\002\315\233\230\021\365\242\311\234s\301\245\031\200\227.\361-\333W\3738^D\273\021\211\253\314\231\013{\336[=\246M\362\204\264$w\310\366\212\356^\367\036\031\006(\321"
+	.string	"\336\034x\203\214>\264\013\317\326\254\273{\037=Ql:\345\024\265a\036\364\241\262\360\350\335p\322iIQD\024y?@\344{\322w\304BH5A\315y{\370\001\274\275(\270tT\271\340\372\330\"\276/\207\335\222\035\205\342\225\202k\313@\350\303\357\217\336\352\021\005\236I\340\002\243\211u\220\315n`923"
+	.ascii	"~\3540\233\030\315L\315K\345\327K\214\346\345\262\211\311\324"
+	.ascii	"\270^3\034\327\013\213e7\260\231+G&\233\271Z\272\371\3159\306"
+	.ascii	"\266:2\300\026\265'P8z\214\201\037BOT\005t\265v\005\013\347]"
+	.ascii	"\345\251\327\304\332\325Z\303\236M\247\224\204rC\276\035\262"
+	.ascii	"<\316\027w\2663\302\332\270\255\237% \002.`\320\207\254* \200"
+	.ascii	"\202\031\272\353\237\030B\321r\317Q\177\255\225j\341\021)\345"
+	.ascii	"w<!\255\347x\303\314\004\250\371c\344\265\363\303\262\326\260"
+	.ascii	"\277_\314j<\"\r{\234l\331HMN\366\3028\003h,\250I\2640L\200\016"
+	.ascii	"\347\235\275\261\346D\347+\202\244\342#k\032=>\375\252\215_\260"
+	.ascii	"1>~\256\265\317\t"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.302.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"]\013"
+	.string	"\006\025N@ Q\224\016\037\2165\016@>\342\006\374\n\215\343\310\340J\006:\310\310"
+	.string	"\247\b:r\031k\250\021\354\312\264\230\312X\373\210\333*\020L\342f\2622\374\023T\242\324\222\333)\304\3066\262\267\224)\005:"
+	.string	";"
+	.string	":"
+	.string	"\250\3452\"%\272\0245v\367\322\020\337\036\241\346\346\003\360\270\307\312\341\206+\264\244<\210\004\360N\360\362\"\244\273\352y\301\343\310\224hv\327\331\341i\270\255\333v`{\201}K\233aecC\242\013\021\266O\261\255i\337\304Ol\377,\300\001{\002\201A\301\344\361\362\212\365\bO\300zt\246\235 \263\375\243d\335\355\300\242\305\356\207\300\007&\217\336\354\031\005\002\n\325\331\3350\345\352#\037V*\240z$\ndI\250\246\234/Y\327\253n\240\213A\003\005\310)G\354\217K\365\260\017WSv\246\341\277_\377\361_\302`\204\f\016_\001c\003\022F\233\007\"\020\2513\251\340\351\204\032x>X\204L\203\320\301D\002\314\301`\037\316\025\3026\240\213\243\215.L\305\231\310\243]\023\262L\273(\337^cR\216G[\251&Q\310w\370\252kP\312\371\001\023"
+	.string	"\357b\310\fMg\004\303"
+	.ascii	"\026\016\n\305\312\020\331\2331`^<\252c\334\022.\214\260\232"
+	.ascii	"\325\2460\304\224\032=\356rK{M\t7\245P{"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.303.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"]\013"
+	.string	"\026\025NA o\224\0163\023\327\350\221\004\356x\006q\205\343F\035\001"
+	.string	"\361\250sLB\204\240\201\214Y\214\0045{"
+	.string	"1\263\261\2768Gv\001P!\002\213\006:\346\030D\005\007\204\305\300\034j\237\354-eJ\001;"
+	.string	";"
+	.string	"9"
+	.string	"\002N\273mHRp!Z\354\256\245\034\256=BM\315\307\350\266\307\313\241\205+\304\2402\220"
+	.string	"\350L0\203b\204{\352)\241\353\310\234pv\327\351\321U\270\253\333V`\373\200}L,v)|.v$\232\350`\373\025\333\232\366?<D\273\027\001Z\326\264a\302\206\362\230\371\245z\204\017P=:\3236\260\321\016\262a\335\305p\242\304\256W\300\004(\217\326\354\025\001\233\257P\235\334\013\216\374^\242\341\023\001\365#O\"\353A\025\345\370\215\352\372\324\007p*>\020\"\246,\261\275-\365\303>\\E\331\231\206\367~=\310\377\t\202\220\021\027N\"\016J\235\005$\221\306\207\002\341\372\214\022\\!P\003,cpet2\213=\032P\310c\215@\035\221\345\311J\226\346b\214teV\006\206eV\305\333s8\264\343\321U\2525\036\344=\374\3249'\r\023"
+	.string	"\357b\310\fMg\004\303"
+	.ascii	"\026\016\n\305\312\020\331\2331`^<\252c\334\022.\214\260\232"
+	.ascii	"\325\2460\304\224\032=\356rK{M\t7\245P{"
+	.text
+	.section	.gnu.lto_cliPrintCommandBatchWarning.304.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\025\f"
+	.string	"\026\226UD"
+	.string	"S\234\016\360\r"
+	.string	"\307\024A\017\261\f\265\340Y\246\223z@\346\312+M\234\320\323\360I.E\201\214\220\243"
+	.string	"\2039jf\337\367\223K\223`\b\033\301\002\360\006\217\251\027\314\006\233\212\302\202u\0306\262\367N)@"
+	.string	"="
+	.string	"F"
+	.string	"\237\rd@\210\005\027\f\021Qb#\310\356n\263\305\277\323)?\377(\037\tE\360\364\304'-\240\302#\006"
+	.string	"\221E\r\244X\221r\224\313\021\342JJ\213\203\335\265\fE\0237v\333\036\333\235\375,\366\b\312\311\302>\335\335\365l\331?\371i\326@e\305\344:r\354\226(Bd]\030\216\027\030\333\227\366e|\306\367\023\325\003\354\266~\334\330\0355>p9\346\361\231\354\330\345\002\262c\016\336\306\001\205\3626\314\270\247;[\306\274T\270@\314\025\315$\235Oy\241\220b\017\022;\246U\031\235\263d\005F\r\037,)\304\231\374x\032\035\b\270\330%y\230\272\220(@p\314\366\360A>t\202\227\211\2135\301\366\200>\024@\237\021(\304\321*\027\212P!h\244\372\251P9\255\212\036T\t\0234\215\326\251#N\035\325\216V\271J\322D\\\210\343*\203\013'\323\311+\245,\3566&\f\335v2\2252l\235\267a\333d\214\322`!\020"
+	.string	"\357b\314\304c\240\341\276\206m\303\262\243-+\341\021\320J\302\256\251\301\302\203y\227"
+	.ascii	"\232\325\024q\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_resetCommandBatch.305.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\355\006"
+	.string	"\"\314.4@O\324\001\200\024S\036\204\205?\212\326o\362\241x\260qA\016\b\256\351\"\"\020Ci\366\310\323\004\205\216w\f\003\301\352\361\262\332\323\3556\264n\273wJ\001\256\322DU:Q\225*L\007\t\264Z\fT\np\265\200`\321\206\252\262h\224\331K\320`\243\344E\263I\b_\344#\016\263%\324\374z|\220\207\\~\206\037\260\370\356\323\307\236O\210\013C\213\217\225-n\354\214\026\345\205}gw\327\022\264\035\311\322\341IP\034\345d\327\333\304l\3124\321\260\375\310\231\255\"\020\261\032\001L\005G\342\262\273Tb<{\314\374{\034\240\373\264G\250`w\035\273o\342\226\037\260\315\021\f"
+	.ascii	"3\001\2138\303\361.\201\035hl(\234\221\024)p\031\372e\bp\351"
+	.ascii	"\306lm\327i\001"
+	.text
+	.section	.gnu.lto_cliBatch.306.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\233\001\315\017"
+	.string	"\306\\hF\020\257&\035@\255\273:/\006\373E\313\267\342\013\251\023\016\277\253\322E\277&\243/ud\330Y\334\337\326\254\027b|$\034\314\246\361\251V\222\021\024"
+	.string	" u\245\320XDx\210\353\220\362Xji\216\204\354M\266L)P"
+	.string	"Q"
+	.string	"W"
+	.ascii	"\357\240\237\332\003\320O\243l\030\005Hjj\201\f\017\030\\nj\255"
+	.ascii	"\233\374p\3243:1\271(?\373h\200a\352\231\366:\315>`\370\372\334"
+	.ascii	"p\254\023\222\260V\002\b[\230\247\326\372\022\337\f\341j7\373"
+	.ascii	"\324Z\275`hrk\267\375\331"
+	.string	"v`\037&\240Ik!\360\370\244\322\256`a\017^n\310\244\270phZ2e\213\253\225(\366\3458\216\243\345\211}\226\237\312\365\356\372\035icR\242\341u\026/\265\226\2143\352\314\204\021\321\261\375\265\277r\022\250\263\\8G\255'++j\025\023\330\200\366i1\356B{\320\0332)384,\231\232\022\345\345)\"d6/FtX\251\371O\024\305]9175\265\326\212\375DWz-.|\227\2378\371!,\022\231\276\b\375\\\311 'F\205\203j\307K\211\342\003\277\fii\301\332\030\326\330\371\022\275x\023\024\264Z[\017\006\205>\217\373L\036\t\335\307\205x@$n4*5\030\340\317\343>\023\r\221D#\240Q\227\271\373\020\215t\033I\304\215\266\3163m\037\035.M\by\333W*y[GT\035\273<\001Qq\341\320\250\344\n\313\004\354\003\b{\320\230L-\345\330\213W\001B"
+	.ascii	"\004\247\265\024x|:' \260\202!\261\365obL\221\035\343\367\261"
+	.ascii	"\315ZBT\301\b\305\341\316 c\231Mb]\201!\254\233\262\326d\355"
+	.ascii	"\016\320\210\032\311\272</,\035F8x\360H\247c\031\356^a\203\311"
+	.ascii	"\302\370\200\031B3O\031.\341\200\317\001\237\337e\271\321uU\272"
+	.ascii	"\255]z"
+	.text
+	.section	.gnu.lto_cliSave.307.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`=\003=\026"
+	.string	"\226d\212L\240\326Q:&\316\037=\206\t\260Ue\332Qy\333E3\007\025\267\256\"w"
+	.string	"\362^\007\033\312\250\333\256\365_\366\267d\260\326wN\372[\037\032\257\036\224\342\240\336\303\345)\274\006\365Ip\004\017\357*\2534T~$\204l\262\245L\001s"
+	.string	"i"
+	.string	"z"
+	.string	"\227VWp\217S`\350\013\3454KK\326\356\235_\251\217S`\250\371rT4\342\227\025\021\0059\273\367\0265\312\312Q\221\210O+\"\0213\361\212\022q\250M!.c\251\020M\203msM\252\260\216\212)\230$\027"
+	.string	"\265\214`[\302!h\n\324\225\224\005\301\030\306R y I\324\022f\342.\221\376\272\315\227{\357{\230\026\3711\376\037\344\277\355\2576=g\027\037\301\323<d{\346)\331r\3452B5\364\323]\277\321\3275\351g\362V\244\277\366\313\356\333\356\223\335\257\335\357\356\263\200\006*L\bq\025\222{\203\272\234\334\243\375\021\003\375\317\375\363\r\306\321\343\034>\f\340^$\033>\3565*x\201\223\355\215,+\331\236\034\240d\373\336\177\204"
+	.string	"\360\372\0304\201\022:i\335\033'\031u#\253O\026\225)\353\037\203\006\252\343\217\213\301\023\302\262V\233\246\036\033ju\341R\302\004\212\303"
+	.ascii	"\026\035\316\240L\r\202\254\250Z\343\211\210\224\215\365\237"
+	.ascii	"\323-\035\177\325w\264\331\310O\037\f\024\2717\310C\2343\230"
+	.ascii	"\200\205\355\317\013\321<<\363\310\232q\004\252\276;-\025\275"
+	.ascii	" kR\023wu\340\264\323U\245\005\367\0240HF}O\311\325\246\351\n"
+	.ascii	"\250\267~\326\301;\002"
+	.string	"\327\345\354H\324\354\230g\251]\200\271\261\314&\324\"X\230\335l46[m\226!\346\301\254v\203\251I\240\240\222\313\331\335x\300\301\231\307\265\354np\264\234]\r\016\r\247\263Ck\221\235\007\"\247C\023\301\343\351\320P\343\345\227\237\372K\3511\351\266\204\216?\030\214\256n\021Q\225.\353_\203\320<\374\214\201\360T\214\314\314L\311\266\254.\\]4\204 )]\275\254\024\215\255>OP*`\005P\250\201T\003\031\263`$\005)\247\260\r\300\002\231\261\352\006\020H\351\246-\f\007\337x\t\f\353\223\336\275,[BR\2521\265\034O\3070\317\023_$\342j\343\315?\323dZ\251\242\326\335\276\246\316\346l\221$[\353d\207\355\t\240\007[EQ-u\247\204\242>\322g \243\251\340,^X\201oYB\237\017Y3\263\361\373O\212\306@\324\007\312L\350&\334]\363\315@3C\235&1q\315"
+	.ascii	"\217Fbh^\007W6_\372Xp\225\322\376\225\2533\265\313\2637e\361"
+	.ascii	"\\\005"
+	.text
+	.section	.gnu.lto_cliDefaults.308.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\313\001U\022"
+	.string	"\006c~I\320\322(\035\226\001[$Q^\321\211"
+	.string	"\2115\267c3\333(\013\304\327\315\253\214\013\224\304\366\314\245*\031\375\301\2729\261\211}\357\324\251\035\344&\001\202\273\r\207\241\033\255:\264\033\352\370(\364\200V\320\t\322\020K6\3312\245h"
+	.string	"a"
+	.string	"m"
+	.string	"\265\352"
+	.ascii	"\315\250\265D`\003\341\251\313\247\300\323\360\002\300S\323\354"
+	.ascii	"\037%6\265\246\302\353p#\264Tk]M\023\247\035\244\337\\\232\017"
+	.ascii	"\200\254\035\fA\234\336P\244\315~_jG\216\017\021\362\366\235"
+	.ascii	"\214\310\361\001E\332v~'I4\202\210\2205_*\307\203\273\356\213"
+	.ascii	"C\332vO+\265V/\216\364p\237n\373\305\366\003{7\266m2\270t\332"
+	.ascii	"2\031\366\270\317\353~\016DC%\230\222l\263f\227\265\235;\366"
+	.ascii	"g\257\327\353y\352\330\377\371\351\313{\316\365\356\372\250\031"
+	.ascii	"\036;#!^n\366(k\256'\244\026\321"
+	.string	"\032=/\177\373\327\031\345\004*\264\2273U\255\2549\260\347\250\364Y\252\265D9\365\201\360k\337\347,h\377\321\360\221H\337\335\207\361\0303\037\205\035\260P\237\005<\2250D\307\022\020\232\355\231dm\b\021P\232p\024\325\314\232G\366A\1771\201\300\tVx[19\265[\342\036\347%\262\201\303\243\264\341\233;F\371\316\231\335Q\200\005\357\002\037\364\026\025\302Zo\307\305\2047\005&\247\343\205=n'\t\211\241\222)\351\2667lr)\246g\340'\205\035R\216\311`dX.b\213j\224\251^^.\231L\214\211\260\001\036_\247\330\213\313\3455.\0201\260b(\361\345\202i\211i\235\334Jq\301\264V/\027+f\325\202\305V))\217\026D\330J6\216\260\025\252\254_\241\2315_\255\265\202\005\326f\320`\236\306'G\005\235;>O\304\215\213\371\335\277\202\027\342F\306\3763pN\034\333s\226"
+	.string	"\365\350\224\214\002\037"
+	.ascii	"\306\214\361.\260\314\320tF\260(@\203\203\300\025\232u\261\261"
+	.ascii	"\356.\306\337\314\036;n\365{+\"]@\022\202-\030\336`\034'\330"
+	.ascii	"\210\225U \213\253\335t\214-\355\232\315\205\313\343l\344\251"
+	.ascii	"\246\201\013\211\342\276#\214\004\311\216\323\252("
+	.text
+	.section	.gnu.lto_cliPrintVarDefault.309.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\303\002m\026"
+	.string	"\326*\227H\260XQ:\302\0179\353\003\205\274\026\b\005\214\3322\264\317o1@d\256\251\353K\313\337rD\3011\215\033#;\257\373\024\217w\206m\013\370\243fO\332\t\274\223\030\336\327\315\372$\372\243;\375I\207\326H#\233H)S\200"
+	.string	"y"
+	.string	"\206"
+	.ascii	"\265J]\034\026\247$L\265\2367Ko#.\377\273[\036\271F,6@\255ER"
+	.ascii	"\226\324z\342<\201\270\364\347\322\204K\305\025\020.=\371s\331"
+	.ascii	"\023G\255qJ\022Bj\252\265\276:\267\344R\260\231\374noS&\256\\"
+	.ascii	":cA\320\206\211\311o\304\005\2014C<\314\025\316\306\r\026\260"
+	.ascii	"B\345\307\036-\307\300\005\201"
+	.string	"\007h\330H\332\336\362\013\\\215\031\025\241\326z6q2\366\341\376\347\371\277\363\367*K\004\204\bq\307\322/\213p\351\366\230\373\351\210xF.\370\351?K\356\033\377\202\265\326\372.\372\327\267o\355\271g\255\321\356J\344\217!_\225\342\247D\276\030\362Q\"?D\361i\310\007A~S>\203\374%\320\342K\315\n\222\023\222\316r\326\241'2U\2116\351\261\276\335\363\337!\337\243\217g\320\200\\\237\nWy\326!U\227%#\273&\034q\351n\357\343\377s\005+MvR\275@\312,\205y\024\035^l\200*\302Vw\221\337\226\032\016[l\f\031x\315V\273n]\2366\252\305\006\247\334t5\r\253\004\325\213\224\2036\330a\357MW\343\247w\323\006\247lX$\034\216\360tx\220\373]i\361\252\177\017\037x\315\356=\332\001Ic|(\331\272d\\\025\030P\372+BV\267\320O\210O\213\215\305\034"
+	.string	"s\3771\031\257\311j\227\255\313os7\030\2412\357\331\">b\2556\007\017wA\220\321f\260\024.\026\212\031\r\026BF\341\304\fF3!\233\351)\3012\332\f\226\202>\226\3433\213\275H\370\300F\274b@'^94\377)!\003z\241\370\371\001z\215g]\260vQo\367\305\030&J.\272F\025\360O\376 \203\030\220\262\244\211\251\326\345\021\360\315\216\244\020\222\247\352\261w\351\246\253=Q\365L\356\307D\304sq\252\277N$\244\236\374vD\273ZokN\020o:\013\226\376\025,\360\232\327\251\021\324\345\377\013\033- p\202\221\251\263\003\017s\274\032\026\355\211\313\266LF\227k\331\036u\354.\245\273P\307"
+	.string	"r\347s>\372&@ \356\347[$\332\226\235lE\001\270\305\205\007\237r\240h\275\2067\365"
+	.string	"7@\262\363"
+	.ascii	"\036@\332@0\234\303\206\255W\240$\253p\013\310\306\006L\032\023"
+	.ascii	"A\356\240\r\256\371:\332\375\214X\336^\231ZN d\262\013\032\005"
+	.text
+	.section	.gnu.lto_cliGet.310.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\335\006\275)"
+	.string	"\032JL\020D`^N:\273\345 7\253\344\0269$7C9\f\306\204qq\026O\325\240G\257\256\316W\371#\273D0\212d`\r\210\257\034\264\301\362\247\3500\016\3344h\275\200d\211\374\203\nvwk\322\b!r'\031\362"
+	.string	"\337"
+	.string	"\371"
+	.string	"GjQ\322\311\2737-C\232v.\352\2730\334/\327\375\2167\312:y\367^\243\237\034!\3759d\3362?\313\265\250G\313q\001\367\232]!so\232\004f\220\376\344\264\007\241?\323\023\321\237\2542\337\0210\336b\005e\035\326Z\237{\357Q\037\341\240U\0174\024\006\201\277\324\207\236f[\225\017D\026\0174\366\241)d6\304\317\351\266\204\230Ck\346\260\276v\005Q\266\306\254\320\364\031\265\234\234n+\210yA/\357\355n\267Y\310*\0334\302%v\240\2022\256\260\377V!P\322_r\005\263S\306\005v\337\027\020\211\205\006)\201[\362\262-\260F\201\3744\211\254\350\235\001B^\231\005\330\214J\202H\2435M\"X\0308\247\333\n3#\300\221\022\026DZ\331\276\333O(\377\330)\343\022\273\365!\335{\331\036\221\\g"
+	.ascii	"g>\312\314*\230\321\251\215\201\314\310\"\016G\242\201\234{\255"
+	.ascii	",0s\323\315\224 Br\257\325\205\267\2271a\236\311O>\221\002M\201"
+	.ascii	"\376<\373n?\303\226K?hTv\35564F\256f\242e^\301\302\376\310F{"
+	.ascii	"z\3141-\232M\267\271\324\335v{vl\363"
+	.string	"\301<\f\023\237\t;\2718\371.\320\237\rw\274\363\266}\254%\225]9h\231a@\331\037\337_;\261\315\236\334\\U\027\231\323\212\266\223\314\277\200D\257\216\333\214\271\350\301\275\234\205\216\366'0-\023\337v\036\n\203\251e\240\317\362\317\264\234\276\313\331w\313(j\371<-\233\246\345>-[\323\362!l\270C\307\353wr\367j\255\177\356\334\371v\366\266\277\313\357\345\315\314\306w\343`\233\r\036M\224\177\220\322\237\277\332\3278\310\314^n\004\270t7\226\210Z\304\355\002\354\226pr\316HE\253\274\373\351Q\2230HR\251\363\333-\247\244\021\354\277\374\216\232$\001\222%\351\225\222\003\265\211z6d\316\252\213\374\272\3672\310\\\321*\271.\311[\322\327\311;>^\200\260'\227\314\216O\207\357\322\364\b\320\237?Yq\365\361\344s\230\371N\035\363uo\361c\366x\213~\022M,dVv\311\004\216"
+	.string	"M\233\330l\261\276\252\354\n\345pT)3V\266>oJ\340X\256U\332\334\315\215\236\261\262\365\362\213\310\032]\250\231U*\252\025\257\005\366\354\177\271\234\252e\200\234{\257~T\267\244W\035\034pH\272\335\262k\316\330E\364\203\005\263D\336\352\210]\226\263\223lta\237X|V\2658\376\232\033A?\252)!\224F\250\201gx|\216@,\332\237=s\314Nr\016\024m)\265:+\253\307\007l\202>\233Y\t\204\375\021\r\374A\004\207\021C\036\224Bp@1Bi\310\347!\rCSD\350\323c,\325\350\251&\031KPPQIMN/\230h,A\001p\222\361\024\243\t\212\311\307L\023\236b0\035\311xZ\202:b\222\232:\232\020\304Q3\234\244\216hDEI\035\005\323\356\333\214\031\211\252\253\200\026\330\263Y\243\252u"
+	.ascii	"\231^\201\370\221\264v\031P\213;34\203\302\366u\226\257\033K"
+	.ascii	"\271\247Vg\357\371`,U\213\032k\\\025\365L\350Jce\323'\017\225"
+	.ascii	"]\325.\026K\226x\362\204\235\344\241\032`\321\273\344\344\304"
+	.ascii	"X\316b\023\030\354\257\375=\344\330\304Y\243\013\231\207\r\354"
+	.ascii	"\244_\003\371z\337S\275\3143a\025L\025S\305\320\237\277\326\261"
+	.ascii	"\004\373\242\262\353\315`'?6DO\334\357A\263\331\302\016v\026"
+	.ascii	"\363o\003\035vQ\0338\303\213c\275\200\027\366\203\006\240\245"
+	.ascii	"\207w5VeW!j\2213\024\002\200\203\2501$\307\230R\b\241\021\221"
+	.ascii	"\031\321\244I\007`\002\021*+\363\021P\3014V\333B\2415?\026\331"
+	.ascii	"\363\276\246y\355\342|\"\362/\332\361\203\253\333\346/\202X\257"
+	.ascii	"\323\027!\367\360\203\212c\226Dj\370\035\305zk\017\233E\302\006"
+	.ascii	"&\243\307\023^*\023\212\365Y\f\001e\214v\226`lu\204\007\025\325"
+	.ascii	"\007*\331\fl\265&u\177\255\233\rmaG\263#\223D\245\217\210\342"
+	.ascii	"\216D\340\241\024\365\036!r\210\013\2704\324\337\337\\2*>\023"
+	.ascii	"\320\022(\307\216\005\314\tP\226:\363\321\354\b\355\304\215\022"
+	.ascii	"\352\t\321\317$\021!\335\343\304pd\271@\273Y\004\244\2510\250"
+	.ascii	"_N7\227\310\267\340\2224{\214\2779\242\006\203n\376]\350\237"
+	.ascii	"BV&\313K\206y\241\005\240\337i\202v\357\335whC\\\006\204\016"
+	.ascii	"\375\324jZ\035<\354+\350\001!(\353\254I\243\223\347`K\207:,h"
+	.ascii	"\206\021I@\310\323\301\362\354\347\262g\355e\217\016\344Q\275"
+	.ascii	"\277\301.p*`bV(\320&\336Q\310\337$?*"
+	.text
+	.section	.gnu.lto_getWordLength.311.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\026\001E\r"
+	.string	"\346\030ZC \217\223\016C\353\230\353\354\023\360\002\001\340g@O\\\341{\252\033pm\020'"
+	.string	"\364+/\375\355\254Y\264\037K|\240\262i\036Zc!\004\300\f\r\300\207\022O\204D\232\341\"hDK\b\331[\312\224\002G"
+	.string	"D"
+	.string	"F"
+	.ascii	"\244\020\f\001]\212\224\0231vc\246\033\374r;|\232\233\257\221"
+	.ascii	"\232\201)q\241\303w\221N\036"
+	.string	"88\322\023Q\305\274\034\3654q\243| T\256G}Aj\325\2258\225\347\205`w\235%\016\303m\3356\307v\001\373Z-\377\365\370\303\367\322\252\351|\274\257q@\306B\206\257dvO\335jY\300\227\017\266A\366\206\035_\200d\332\037q\022\240\267\234\034\300\356\n\n\025\273\021\304\003\260C\307{X\207\330;\254C\002\006@\336\002\004~\t\365\251\311\266?nb\245\336E\211\026\025Re\337\004\005\023\254\303\366\023\3530\365:\255:\223\006\321\333\335}\336\336a=\325\350\225\232qA\t1\312N]V\2208U\026;\206R\204\203*\306\272bk\234\306\036\r<\nHJF,O\307\001'\001I\311\b\346MH\347\301&\363t\030@\3106\232\204,\304\303\237\b\034-\233\360\371h\331F\334\277\367\364\230~\210tdUL\2372C\224\235/\275\252\242\210\030e\007\225\305G\375'\030\031\027T\243\001\031"
+	.ascii	"\3571\274\020\rN\b\3154G\364\370\332\365\376\207jK\313\002\220"
+	.ascii	"\020Qfa6\nD\264\334a\323\352`\214D\237\205\300\b\030\007\206"
+	.ascii	"\005\204\016T\270\270\245O\3252P/\233\204\371\004"
+	.text
+	.section	.gnu.lto_cliGetSettingIndex.312.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\274\002\225\026"
+	.string	"\326k\226H\260VU:pc9\301\277\225\232|\025;dN\026p ,^.\354!M\325,\236\334\026Y~\321\310\262uZ\373\3409\234\327\"\336\275P\276'\267\355\007\234\222rA\177\375\354\035>Tv\327\320\216m-!{\313\235R\206"
+	.string	"x"
+	.string	"\202"
+	.string	"CK.R\332\237q\032\264\367:<@\255;`R\255=\0046`:u\317t\030\217A\363\316\201\036[\315eT\362`\364\244\326\036k\345,\341\251\374\200\360tKX\224;7\211!\235+w\374\332M/\022B\350G<RT\021\364P\224Q1&aB\002H\350t:\220\341\342\304\372~@R\272\0369W:\237\331\002\274\314\351nr\177tZ\024\374\341tA\227\242L\255\325\022\247\003\272O\267=d\373\201-}\004v\257&]`\344H\341\335\331+K\253\356\373U\336\373SG\272Q'K\213\377\335\341I\232\232\244\247(\275SZ\212\322\007"
+	.ascii	"!H\024\364)c\255 F)u\b\355Qt\244\377wi\337>\016\037\210\224\263"
+	.ascii	"R\213\324\353Z\214K1\246\333\360\217\234:\265\321o\320\376\323"
+	.ascii	"y\005\252\377\200b<\262\244\326\336\313\251\023\230N[\346m\232"
+	.ascii	"\235\262=\245\035\263\200v\037\007o\255\001\341\2366g\237V\265"
+	.ascii	")\020A%V\225\370\211B\227\347\335\257\312\013\225\335%`\344!"
+	.ascii	"h\223\343\317\304\t\221\335\\\236_.WVc\351&\243\230E~Q\233Z\273"
+	.ascii	"\202\005y\234\334\026\237\255Y\200D\255\215!\203<\356{$c\220"
+	.ascii	"!\267\255\331n=\311\245\300D\2557\006\266e\347\361\2029R\353"
+	.ascii	"\255\201\216\357\240\231':5\254&<\356\324\257\tOQ{\340\247\220"
+	.ascii	"\261\t\224\03169\256\021$>\034\273\274\257\233\226\004\232\030"
+	.ascii	"l6{\345\244`\3270\243\211\275l\302\327M+6\355\202\201\331\270"
+	.ascii	"X1X\353\206\345\222\345\260`X\214\263\341%c\315ppd\254T\257~"
+	.ascii	"w~\215\377g\304\370#\316=\360\0271b\212\022U\255\270\271\265"
+	.ascii	"\214myV\230\226g\225\220p\265\364\205t.\\\272\021\224\346\322"
+	.ascii	"\375}\374\307\204y\"S\230\t\217\233\331\002'\204f\255\265\212"
+	.ascii	"\313\273N\030\356j\177\364\013E\301\237\317\020\217\034\345\017"
+	.ascii	"\033,\222\3029\0032 `\002!u\327\r\277\030\321\321\232\353r\256"
+	.ascii	"\2640\230H\245\335\205\320\312\004\253\261I5\233]\360YB#q\245"
+	.ascii	"\n\266\365\351G\333\367m9WY\307\344 \306\021\263S\243\021`\243"
+	.ascii	"\025Q\335\2617\016\b\263\022\315\nz\036\372c\267P>\305\271k\304"
+	.ascii	"6@!\2309\355\320\022\346rx\330\256\372\345\372\227Y\032\033\254"
+	.ascii	"q\365\013\246U\345u&\321\361\340\246\353=\001"
+	.text
+	.section	.gnu.lto_cliSet.313.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\232 U\231"
+	.string	"j\376\2648J \320\322\031\016\247\303W\342Z\206:\236t\357x(\037Yg}U5\020\013\003\226\b>\024k:$ #[Z\332\224\352$6\037\037\235O)\325\273b\253\221\2168\356\005\340\367\352\023\376\224Kd\0235l\026Y\332D\312$\003\205\003\"\003\177\003y\323>\035\347nU2\355\263\376\2516`\371\236\337\360?\374\371\374;\374y\376;\177\341O\370\307\371\005\3779\377\233\377\357\007\374\317\374i~5\277\337\317\367\207\371m\370\311\374`\376\275\377\356\367\362\244\335\033\376\360|\276\303\373,2\315\211\227\252)`ik\205i\260\216\253\334\217^\032\233\334\031,<7\244qw{\254\3604I\343\276\320\031Z9\352\321"
+	.string	"\f\255\016\236+8=\2645v\026I\330\301\024=4\276\302\323\331\327Y$a\021)5\244N\376\246\004^\316\007\347`\261\351\241=Q;^\025\334b\242\207\006\245\020\355\270}gR\322&\206t\206n\366p\026\371F\204\033R%\201\357\312\341m\026\t\270}K\257\273\325,\312\204@:-\353\272\206p\374\273#%U\362ww\004\315\325|\315\"\375\370\344\326ueJ\263}Gg\331Q\317L\214\334\272\226\0219^=\263}K\322\022\356\3126(\2637\343'Bq\375\262r\241\325\220\222\025\322\031\n\ts1\277\341}\213$\203\004h\375[\223'\350\231=a\340x\265\206\217i\336\206$@\316\266\025\350\t\230Y\234\217\343U \236\352\022[\271\2424I\237\206\033cF\363|\036\024\327\350\352\264#%%\373BgxC\206\375\f\213\004\003\002\257\320\266U\311\246g\006\255q\274\336\376\313\"\257\356\211"
+	.string	"\304\325\266\0061\3213#\243q\274\352\3410<o\2211\034\257y/$|=[?&\235\"\3068^]\026/d\274\333\002Z\001\327\227\321\231&\026\256\353\035\323\325m:^\345\335\323\275\256y\273\255\007\255\253\024.5\254\353\235\323.\035\257\356\335\211\214W\217\0272^\335\346.\241\321\327\352\2341\335!,\317p]W\250\206\333\237M\332O_\274\373.\025\233\237!%#F\024\f\250'\247&\246\027.Z\260X\241b)\005\212\023K\023%\224H$!\035\031\025\215 \032\022R\006\001%E\204"
+	.ascii	"\201\374\340\341\370cT\213\315\315\375\0073\347gH\375L\005-I"
+	.ascii	"U\250AF\2149\217\222\323'\3100\240\236\004\327\260\223\340\\"
+	.ascii	"\231\032nb\223\206\231\330\240\341\027g\\\374L\235\353\314[\340"
+	.ascii	"\300\002\260LL\0373\274\002p\256\314\216U\f\362\361\322\317\324"
+	.ascii	"\2243\032\236\242\017\2129'\214hg\244K\241%\351\223/3\334\004"
+	.ascii	"\030\031\214@e_\214@\353\272\276P,1x\345\r\251\332\035\rW\232"
+	.ascii	"\003,\303\302$\212\035\303\236\337\001\313\002\2137\352\264T"
+	.ascii	"9\034:N\232r\326\345H\\~\304e\013\033q)6\315\225i\341\"8W.I\225"
+	.ascii	"t\371\210+'R\241\315\025\036\022\372\231r;\223seP\334\\Y\025"
+	.ascii	"\006\002,\263R\\\256\241\302\311\023ng\202\027!\307\314\032\207"
+	.ascii	"`\203\302 \302\324\245`\004\341V\366\304\b\002N\026\265=\341"
+	.ascii	"V&GEJI\237\201t\207ngt\376\341\200eN\372\324\330CQ\250\t\rp\016"
+	.ascii	"X6Xl\202\223E\355y?1W\326\204\217\305\237/%W\016XF\247X\203O"
+	.ascii	"\241\r\377\002\306?R&7\376\313\r\210\"\226\207\027\007\214\031"
+	.ascii	"\223\253_\\,\276XKs\302\001\313\242E\242\034\242\f\"\315\274"
+	.ascii	"\270\213/\n\307\350 \302\254\253H\244\344\312\363yg2\263/\346"
+	.ascii	"\237\251u]\227\237fg_\032\337-\n\260\373\246]\022,\002K\314="
+	.ascii	"G\260\327\300<lZQ\202\272\341\360\347\245\324\223\203\231\017"
+	.ascii	"\027\264\207\316\302S\343\305|\330<\364\2076b}\207Q\002\370\330"
+	.ascii	"LD\346\224\377\274\240\227\025\364\261\271M\372\364\313\301\026"
+	.ascii	"t5\277\370O \355\002\3526\346\317\353\022\264\005\035\202tl\n"
+	.ascii	"\266\302\r\226\240\307\232d\374g\005\375\276\017\025\002\242"
+	.ascii	"\335\035\026\332\210+\003\306C\277-\257\227\240\231xrl0\216o"
+	.ascii	"\2371\002%M3\376S\202\336\002u\313\3627\006\217\340\334\261\337"
+	.ascii	"6\251f\374\222V\371\250K\246\243\177z\307\032c\377,a&I\212Oa"
+	.ascii	"\233h\315\2644\343Uc/U\211r\361\364\305u]\327\237~\023\301\250"
+	.ascii	"\243\277\244\377\345H7R16`kR\274\333l\322t\002\302m\355\257\253"
+	.ascii	"\235\033\305j\377\254w\233lM\024\226\305V\373a\211O\374\217."
+	.ascii	"\266\226TlO\030\231.\236\356\023w\237\0066k\276\025\005\302\035"
+	.ascii	"\301.C\225\246\025\001\332\276\332\251\002\233\320\304\362D\243"
+	.ascii	"\204\246\324\t\332]\024EL\357\320n\371\t\302\212\300u\365\372"
+	.ascii	"sw\231}x\254)\225\242\262\256^5\256.\207\261X3K\361)\\\335&\013"
+	.ascii	"\317\246\013\306\253?\353\317p\017}\244bq\236K\270x\332\275\347"
+	.ascii	"\367efL\301\327\343\257f\227\"*\353\n\366g\263\356\bv\026X4_"
+	.ascii	"\320\301\177\356\021\324\r\355\257\006\025>\205j\277\355\213"
+	.ascii	"\0071r"
+	.string	"?q\331\311$\023\344\230\302~\253U>25.\236\262\t;\026P(\376q\3374a\322J\350%\301\370\243aD\275D\301\023\364b>\373\376\321\374&,\221\213\247[\202#\350]\036=\370\317\367\363~(l\323\032\016\013\275\332\271{\347\344~\333\375\237O\334\270mK\331\375\337\367N\276\344`\276?\273\337\367cW\363\275\327\273\356\374z\301o\363\204\337\255\027~G\370\235/\b\317\363\325\272\3407\213\210\027\311\347|\217|\317\227\203$\357\325\r\277\031\374\360ku>\337!\337\341[\225\344\025B\304KE\304\213\301\303|\203\334\206\357\005\277\373\002\371\335\327\202\223\371V\360\273\257\004\367\362\375q\273?\002%/\002\217\363\365q\301\357\001\177\363\355\361\277\257\001\007\374\3628\337\267\200\363}w\234\357K\300\367\276:\202x\247\224\2749\214x\007P\362\342\030\342\275a\304+@\2227\200!^\033*o\r\225\027"
+	.ascii	"\"^\032J\336\031F\274R@\2742\214xc\020\361F%ya(y\241\316\373"
+	.ascii	"\224\304\353\244\344mJ\3622%y_\030\361\272\020\342m\241\344e"
+	.ascii	"\221\344]\221\344Ua\304\273\204\304\233B\311\213\342\210\367"
+	.ascii	"\204\021\357\222\210\327\204\222\267\304\021\257\222\021/\211"
+	.ascii	"!\336$\"^\244!\336#%\257Q\020oQ\021\357\210$/Q\222w\250\210W"
+	.ascii	"h\004\257r\2107H\311\013\244\344M\016\361\212H\362\206 \342E"
+	.ascii	"*y?\b\361zP\362\036\207x\177\204x\215J^U\345-\006\3616\020/'"
+	.ascii	"y\377'\375\254\203\327&\275\335\305|2\341:@\321)P4\020(\034\333"
+	.ascii	"\211^\366\b]\244s\242\217\364,\373v\316\204P8'x\376\301\263\n"
+	.ascii	"P\270\264\245\211^\2362\275\220\224\b,\242\346y\247Mt\221\316"
+	.ascii	"\003\234U\242/\200NATj\022\275\325E=>Z\251\221\362\302\022;\340"
+	.ascii	" V\230*\360\237$\372u\316\206\320)\207\177l\347 \246\024\376"
+	.ascii	"9\031\021\310\213\312\232\211~\333\035zp\317\262!\243\221\313"
+	.ascii	"\263\254\347h`\344\356\354\026O\030\241\207\246\245\220\306\324"
+	.ascii	"\027'.\327\035\3314\016\310\352.\004d\241\355\260\260\004\026"
+	.ascii	"\256\203\225C\312\204\314,7\250\320a\n\032\201\2424\024\016\316"
+	.ascii	"9\322\037<\003m\306\302l\261\343b!\213\334\241R\277m\b\035"
+	.string	"\032\257\316\027\033\022\375\2669\324\220\336u6=3\304\350{\334\311\227\350\231\3651"
+	.ascii	"\211\200~\337o\202\236\331\22601#\370\315w4Y\217N\352\020:\340"
+	.ascii	"\255A\352\244>\013,\210\205\004\024\335\313\023\030\007\2519"
+	.ascii	"\350\022K\334\275\3001{\222\372m\271\210\337\234\217\330\315"
+	.ascii	"\017\347B\201\200l\204F{\017\214w\322d[,\332\321\207#\rs\364"
+	.ascii	"{`\334\242\321\216&\200Ox\217~W'\335H\225\324a\244\243\036}\024"
+	.ascii	"e\363\274#\"\320J\225#\246\0335\210+C\030H\027mav\341?\215\332"
+	.ascii	"\b\245\355\253\235o\272SGg\324o\373&\026cQ\203\270\202'\347\317"
+	.ascii	"\201&\026\346\013\306\253E}25\242\026\352\021}\260\025\216_4"
+	.ascii	"\306\241&\352\203\315\365\350\2416\362\325\261\032\346\013\252"
+	.ascii	"2\272g\310\314\303i\2300\030!E\367"
+	.string	"\006\3170\032&\0363\217\271\307\224\301xU\250\017\347\352\\t\317p\255\316\356\316\254\355\260\250\337V\b\333\022\242;[\b\024\035\206\230\316\243\311v\204\262\357\354b\336\fl\206\311G\203\212\030\366c\216y\n,\263\347\246\217\214\262\223\272\304\372\034\332q\361\224H\3131\350\267\331\353\202'\310s\377\002\bE\356pH\3508\264\020\203\362L_q]\335r\024\306\300\323m\200\203\202\372n\244%\304\tK\3349d2\004\0015s\301cs\346@\r%\310^b \003\362\352\244\2324Ov\262\215\030\235\303\350\017>\233\2439\233\253Y2\317>\246\237\0234J\226\007\030\b\032\246\032\257\376\232\017}\001l\242\216y\245%\033\340\217u\220\034\230ml@\243\240\375-a\334\241\210\261\026\321\007\304c\343\305|\336\260\036\t\3148\234\307\024,\"E\365\332\256z\301\023\321\347\022\325k[\253\263\013\321\037\353\326\023\226\210"
+	.string	"\177\370\366\031\367L:F u\230v\370\317\020}3\3470P7\304?\260vr\230\024\002C\364\333\026\257dDb&\232\267\007O\360\007\tc\271\020&w\206\205NF\374\361\223C\004\321e\231\356k\225\032\266,\241\321\236\334\332\223\026\226]\270k\222ey\205\345\221\312\032e\202\031:-k\233\334\262t\t\217\353\352\374\332^\311xuh\0053\243\223\343+\273K\370\257\361suq\025\203b\226\2660NT2\"\033\203^\016\213v\361\024\017[\301b#\272\270\246T5\212\346\321\255\321Q\341* \030\257\"{\202h\336\340Z\335\024\020\2268\340\267\246\364IJ\220n5\317%\027\364\207\346B\351s\272b\205<w\220O\3742\354\306\324\023\313#\202\004t\374\020\261K,\255e\022\025\310\245"
+	.string	"\202\006\024\340\261t\200\001\003\226,\234X,\035``\371\200\003< \330\241\303\001\035\007\354X\016Q\341\024\265\344A\300\022\202\007\"P`\331c\001\037\016@\360"
+	.string	"\214u\342\345\241\200\216\005\226\005\370H@\307\217\005|\204\330%\216e\022\025\306]\006\220D\003#WZZVI\226ZF\254\262\262<\330!dED\310\021\017<PiQ\r)\212@\225\225E\205\314\322j\200\b\325\007\306\037I\037Z\037\206XmP\245EU\344\307\310U\221\016\201\252H\253\033hi`\304*\001\253\"T\013X\021\021Bu\225E\365\2012\004\253!F\256\324!V\032\030\241\332`\207\225\007D\250>"
+	.ascii	"A\204\352\203\276\272\021+\"\235\245u\004\211\225je\344\212\310"
+	.ascii	"\220\"U?[\365tE\244\n\312\310\025U\021\250\252\254$POD"
+	.string	"\213u\304*\013J\013\013+\013\ny\267\276\245\354\024WwI\231a\002G\360f+N\023\250\225.F2\234\005J\345\221A\306[s\266\350\260\365\335V\235%;G0^\203Zy\242\3027)\256\314\235\030Q\314\364 V\232\374=\361T\277L\323m\341\331\322s\004\343\263\336\322\304\242\002\321iqa\252/\027-\223\302Z\235\035\362\271\306\025\325o\373\276+\227\222v@\001KS\022&F\005\273\371\026I\354\350\002\n\350\206!o\016\006<m\376\265:\227\244df\350\f\327\273\325\305\373>\345d\304\344\225\034v\200\221c\205\255=M[\207G\260\347\220\243\221Q\236kTD>]\240\372\215\213\257\272\252\007\350\335-\304\255i\222\266\001\232\002h\234\235\024\205^O8\232\347\360\344\\\365\021\033\013\323y\354:\202}\r\213\2538T\266\206;\214\276\372\016\242A\301\351\206U\337\350\347\221\306M\2678\200f\272"
+	.string	"a\314\261\245"
+	.string	"\275\314\240\003\350\257 \215\333\023\226\310\325\324o;\244m4\313\301c\223A\333\350\226\222\250\236\021\342ar\301t\244B\300\276+-\232\216@\223\325\350\317\341\311\341\240\001\350\032\335\210a\321\256W\031\2074"
+	.ascii	"\315Z\244qu\302\310t5\007\375Ai\234\230\0273\3328\002\013i\251"
+	.ascii	"\256*\201\251\204\377\234\321\317\322\006\326N\251\024c\3208"
+	.ascii	"\277\344t:\235\302h!\355\342\007\2059MZ0\315\2142\332X&\332\007"
+	.ascii	"\207'\330oM5\246\031\020\343U\031\215\304G\246\026\243o\247\315"
+	.ascii	"\253\235\314B\356T\006\244\211\366Y\301\023\364\312\363\250\246"
+	.ascii	"Bk7,\034(0\235\320hc\n\032\365IY{\302\266\026\325\327!\332'e"
+	.ascii	"\255.\255\2378Q\353kk\022\315\200\f\223^\202\005@`\223Nc:\221"
+	.ascii	"\352\023\230\202*P\224L\237F\3533\253N\266y\2129\264\203\321"
+	.ascii	"C\272X\005\243+\200\306\325\345` U\375>g.\320\270-\\nh[q@#\235"
+	.ascii	"^\3448\361\264\271\212~\333\"\260\264g\230\230\024_{\204\036"
+	.ascii	"\032[\230\030%\246\373h\262\022`ibabR4\233\r\001\263\254Q\002"
+	.ascii	"\322\007\370h\250f\300#\r\325\"\360\306\310t\305\331[j\272\217"
+	.ascii	"\376\332\327\"\245\342\007\266\026\365\247nv\277A\302MYlL\024"
+	.ascii	"\370\317\247\266\203\306\231\375}\245p\352m(s\t3\212\006M\355"
+	.ascii	"\324\324\027@\341\3600\265\213\326\352\257\277h\246\027.\372"
+	.ascii	"z\340\330\034\342\200\242E"
+	.string	"o\2131\313\230oW,\272\005\213\016\002\205\033\263\242\227\032\204.\"\262\212^\241\242\221\372\226\372x\316|\240pu:\270p\"\202u\250\342\340$N\322(rL\321\314H\222\244\220\326\222\n\020\006ci\"\327\262\007\022\340DA\007\224\210\021\022\221\021%\331\237\003\021#\306\rHk\017\036\214\215\306\243Y\373\356\246\340+B\202\320>\316\205\350\264\037\032\334\364HzT5\n\332<\314\tG\226\236\253+g\364a\317h\027\0256BhC|\037\303\bCw\227l\235[z\312\301\020\004Fv\\\264t*TJ1\370C\342}\321n\004D$\\<Td\326c\227a,\256\2475G1\374\207H\251\330\350\034#\007\bJX>\030P\037\350R$\371\020Xq\310\203Q\330\243\002h\342\326\355m\375J\224N*\221ZS\224\261\336\274\216\t(\332\336De\315v\2419W\204SI\244\221lX\377\315\006r\333"
+	.ascii	"\320\"~\371\0332\0014\234d\032\334\331p\212$WE\222~jt\376\033"
+	.ascii	"#\212B\313\022\323\241\224\334\211\234\347\327\337\324C\360,"
+	.ascii	"\027S\026\336E\265\212\200_\212\250\260\357(l6\024\366\301\347"
+	.ascii	"$\005N\224\277\2502z\240#}\313(\334e\222\254\276z\341\035^\241"
+	.ascii	"v\366\272\256\013T\210\262e\023\234U\240\r1\275\370\2564\302"
+	.ascii	"j\207C\031\317;\302\037\345\365\245\034\254\267J\253V\311\322"
+	.ascii	"Gg\346\262\230\321\225K~\213LVk\210n\210\345"
+	.ascii	"'G\212\026\003nKVM\303\0379`{\315\323\311\367!\204\232\354\271"
+	.ascii	"\270\331\324\006c\215\241\016\3179\327\377\263\234\265\304\344"
+	.ascii	"\023\212\244\3178\002\306`\355\334\2572\336K\001\2008b\2379F"
+	.ascii	"s?l\365\2670\036Wer\bu\214\264K_m\244\253\246\346\024y\316k]"
+	.ascii	"8\275\3379o$\002O0i{\220\007[\270\035\373\332P\037?\263u2-[ "
+	.ascii	"\203e\354\312wyr|D\n*\r\233z\371@\224\251\245\271b\177\320H\b"
+	.ascii	"2\247\023\206L\225\035D\nY\016OR_\2140n\366\260\024\0368\220"
+	.ascii	"Q\271\264)\177X\264=\030[I\370L\213\346\376\322\177s\336\353"
+	.ascii	"\257\b\034\007. Dd\301\215~X\214W\303_o\260\004\220\246w\303"
+	.ascii	"\263\372\332\251\345\371\221a\213\350\002\357l\312o\305\323-"
+	.ascii	"g\204*\357a\305\036/\315\003\313PNa\213\256\324"
+	.string	"\234j\320\211V\210\225\024\315\362\266\2041#\\\032p#\355l<\264\003c\2277\350\252,\023d\020\017\331t>\227\245\252\207r\363\301\231T\365\332\222Z\306\222t\313\361\007OC\234 O\034\316~\005(\202\214\317\030\201\217\221Y\306\267\330\304\031$\005k\023\002\036\325\276\242>Z\353\311\007\035#\211C\216\202q\204\307\013+1\305F\333M\225\341NQ\355\251:\276\206\204Qn\251\332\257\2066`\341\313\006\310\356\020\013\331\303\013\370W&L\\\353\006\n\020\002\225|{a;\274\314\236\221\274\311\302zt\251\324\267\333\t\331\306<\\U\004\242\230\177x\271\013\373\035J\023K\304\2064\365\310@\n)\326d\004\371Fo\267\313!SM\305\305%y\211\353j\032\361G\220,\324D\324\273\347\210\244\276Y\tH\201\3730\244@\234\304\226A\275\375m\222\013|\365\022\215\340[\300n\321\r\017\231\265w\251\272g\375"
+	.string	"\016rU\003\245\330\251\346\201q\352O=\007e\273\362)\346\023\311\037\224\013\b\241\222\350\352\177\001\260(\235(\224\003+\200\262\212\343\031\230\371\026\364p\263b\317\335,(a\227\365\301\b\004\335] \275\343\311\203\332\337\303\251$\037\3026\211\347\227\021\214\301\2168\260\337\211V\334\364\370\024^B\241iKn\237\332D\201=R\017\306\"\037\002Ph \260R\336qQ\214\375&\355\326\230\303\236y\247\312K\221Wtr\360\017\326\017\024y\275\300\210%J\200B\257\322d\0166\0273\0200:\245Z\340b\215\017\367\277\034;V\360\212\343\261,]\t`\305\236\274\3540\377\221\212\003\312\262n\366\317\021\262\330\220v\361\367PmO\2404\217\225\264\236{R\177\3709\017<\342B\025\262\"d\315"
+	.string	"\360\353_ux,\213\201"
+	.string	"\210U\252\370\307\203\321\215G \222\370*\262\262\374M\217\332\301\f\264\004\372\303W"
+	.ascii	">\212\220%\332\365\016\240\027\247k\354\257\034 \020b\213e\177"
+	.ascii	"\021\237[\222\203`\202\222|U\213\303G\240U\b\252\366\374\221"
+	.ascii	"\361]w:\257\234\301$'\306\234R\312\264b\214\212\f\267\306\251"
+	.ascii	"2\310\263~h\b\317\225'\361\2349\373\262\261\374\"\342q\rX\245"
+	.ascii	"7_\240\003\"A\377\367\230\237l=cH\020\336\242\345u\351\"\301"
+	.ascii	"M\306<\003\\\241\204Z\360^\345\344\316G\323\311K\213\335\231"
+	.ascii	"AbHK\223C\320\236\340\357\346-\232\370@\334\316\204\362\226\210"
+	.ascii	"\032#\214QJ\032D\330\363\036\022_\222\206%\325\332"
+	.text
+	.section	.gnu.lto_cliStatus.314.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`7\020\005Y"
+	.ascii	"\352\233\274\"O \324\322\032\003\305\013\376g\024\375\267\212"
+	.ascii	"?\340\337\301\275M\263C\341\013\215>$k\201g(\334\rK[\356CZ*%"
+	.ascii	"\3101\264\024*\224\325\f&\200\371\306\346\351\"\345)\211\260"
+	.ascii	"\200\001|J\035W\360\n\036\217UmL\"&\211H\222RJ\001\r\002\370"
+	.ascii	"\001\035\002\2533\220\317\331\267:\377\3708\373\3748\257?\316"
+	.ascii	"=\037g\036\317\271guVw\316\273\3259\3559\243<g\035\317\371y\316"
+	.ascii	"\316s\356\017\002h\2121\303\222\326\025\347\335\234\275F\346"
+	.ascii	"\360\274N\324\215\254\321t\277u\303u\273u\263u{\351N\353&\323"
+	.ascii	"\255\326=\314\235\006\r\020!S\315i&\304\006\356\033\372\f\367"
+	.ascii	"X\200\001\334\206\213\362-I;\202\206\250\276\005\361w\351\344"
+	.ascii	"\rR\222v$\315sG\031n3\334k\324\215\213er9cR{\215\273\215{lH "
+	.ascii	"*'\357\257+\355\210\332\023\207\332\2507Z\207\351\032\272\311"
+	.ascii	"=\265\020\266f0\315"
+	.string	"\316\024\240\212\3511n\223\021\002\364:\337F!yd\3569\200\332h?Q|i0n\247\021\321\275b\357\273\3052\305\234e\t\320\306;k\032\334\366B\202\356\025\363Rq\275`\252\265\231\331y\3373\244FY\2506\312\352\332\231\333\254\271\270\335\245\204\376\275/\024.m\357{\226\304,\324F\371\254\201i\243j\013\245\215\262\313\f\304\277m\357\222\264\013\316\025\030;\357\373*}\024&bt\327\272\263\346\177\267\213\210\200CBA? \337\217\317\332\343\365\250\273\024\325\275\273\334:f\223M\2515\325E\272]\021#c\035\227E\246\243q\347\351\326M+N\324\302\326X\003\205L\2653frO\266\306z\250J\013U\241\342AS\372\027\2275E\307\226eIq\240'[b\355\023k\342?L\332\207Is\211\257;\005\332:\007\030V\017Un\3100\271\272\227\244yI\272,\013\211\367\350b0\311A\205\006\352"
+	.ascii	"\366C\237\371rU\305\223-\257\336\351b<\313\024\321qY^:\240\221"
+	.ascii	"1eO\353\312S,\255\244\243}\246U\304e%\321\261\357\373\366\264"
+	.ascii	"\212\270N7\300\2242f\233iOA\313J\307{k\262u[\253(\313R\342\317"
+	.ascii	"\323\342j\337)\360\276/\273Rk\253\331\250\231[\215\271\323\230"
+	.ascii	"}\276\002\337{#0WG\370kT\217\3509\227\253\313=r$m\224\367)\300"
+	.ascii	"\260\344\310\271Q\371\034\036\367\253\277\210\275\357K\203\373"
+	.ascii	"N\033\341&\341%n\023o\2226j\343\373LS\320\006KN\0267NcZ\375\220"
+	.ascii	"\"\365\022/N\n\365\227\236\275{\031w\002\034\372au\272\347\217"
+	.ascii	"hq\032x\006\276\347]\214\311\205\355\312\253\312\347X\375\006"
+	.ascii	"\376\301\b_\330j\0164\254\037\252\334\244\341\251\372\372\302"
+	.ascii	"E\246\3730\336\241\351E\360\335\326Ag\342\344\326\234\033\231"
+	.ascii	"\n\037+H\272\373#\032\034+\277\343\266\320t\\\026\324\367\265"
+	.ascii	"\242\301=\247\211p\301t]\245Qv\303\334(\251\033%mt\367m\246\231"
+	.ascii	"\252\260z\220s\3632rRh"
+	.string	"\362R\030x\r\226dG\234\357\333\374\226\246A\270T\200V\324d{q\311\320O?\351\352\b\027W\\\030\274\225\350\277\t\313\261<\350r\214\215\363_\027\307\225\301\347fQ\223\275d\213\356Y\025\316\354\316\260\200\267\362\177\035\273\301\211\302\231m8\360\"n\216S\356Y\365S|\344\376\275\326;H\320\002\207\232\354-\027\215\366Z\3071\371\336\274o\262\225\026\250\311\326\205\216&o%\263\311\237b\004\254\316\032\231\366\373wRKU\253\3515H\356*\214A\006\336\312F\2713H\033\355\347y\301\2311\341\342E\345s\314gU\376a\314MC\354\316\223\037\n\263\007\215\246\331\007qu\346\261:7\255\316;\232\2559\202~k\276\321p\3156\332\255\271\201\325y\251\325\232\031X\235g\254\316J\253\263\214\366\322\234\324l\315\302\2353\022\3179\306\352\fcu~\261:\273X\235[\364\234\203\2533\213 \347\025;g"
+	.ascii	"Vg\025=gvuN\361sF\361s>\261:\233X\235\217~\316%~\316$z\316F?"
+	.ascii	"\347\242\2373\321\352\f\\\235\207\200\234\205x\316A<\347_,\212"
+	.ascii	"Y\332-\336\312\025\237\2769\031\316\320\322\340\255\004\340\315"
+	.ascii	"Y5\343\225^\306\247x\027ZZ\264\026\214\232\364*,\336\257\035"
+	.ascii	"T\274\213gO\022\301\276\212\357\030\302\264Mg\277\307+\305\243"
+	.ascii	"\313\262-C(\236\307\033\2519\201\342K\3201\361'\376\250\311l"
+	.ascii	"\023\377b\204\200\220:}\266\341\352\362kz\245\307\022\353\243"
+	.ascii	"_\307\370\350\017X\226e\t*\361M\237\322!Q\342I4\215\236\304\257"
+	.ascii	"O\346\0306\311\247\t\025\270`\371}\030\373\017R\033\265\265\341"
+	.ascii	"\032\363\355x\031\355\230\324\350_K\025\267\322\216ikh\233m3"
+	.ascii	"m\324\350\213\300\226M9\035P\321\357x\243\267\344\032\242g\266"
+	.ascii	"&b\213_X\275/\325\212\242/!'\211\006\370D\177\004&\371\244\362"
+	.ascii	"\271(\r\374t\316\211\325O\265\257eK\207~\235\202\026\007\003"
+	.ascii	"\367n\315\244\314\355[\013\347\255\034\372\032\3132\030\234V"
+	.ascii	"eK\234?B\007c\002\272\327Z\266\202\216\365M\257u\rm\032\024o"
+	.ascii	"\324\264lH,\313\272\234E~*\210\314\0353\037\016R\241\357\301"
+	.ascii	"\344\275\326a\3326\252\222\271\345\241u\343\255\024z\022\313"
+	.ascii	"2."
+	.string	"\247U\320\367\232#i\341\370|P\223\235g\367\246[9\351\357\203>)\251\345\001gn\205h\347x+\177\277\301\222L\256\233\335bqy\236\353\2071\2451q\241w\344@\\-\235\023m\0355\331v\212\374\024\373\036\350\033\n\263\013\334\325\021\273!\336|\361>\214\207\251\357\275\214[972Tbn\215\360\024\332<I\0044\312\276t\024\332\271)\267\252*m\324\367JR\272P\371\\\3279aJ\317\207\261W\340\305&\n\032\234#\277\361\273o\034\374\004\267H\321\225\232l!N,\311fp&\177J5\300\033\007O\272X'\304PP\223-\307\210\253\005cI\266\305i\365S\\\244$\217\016;\341W\340\265f\016Z\034\257*\272,\364\027\261*\334\306\264\321\033\377M,$\353\363\336\347;\371Bs\232\264\367\353w\262\314F\214\f\262:\256\201t*\262>\240\234\200\034\027 b\3441\352x\264\301.\t"
+	.string	"\201\217a \203l\022K\344h\224\222\032\366`u\024\203/\330\013\002\230!c\006\033\203\3651\224z\212\272\300\005\363\310\301\n\213R\303#\313\224#\003\007X!k|\"\022!\262\302`\260\030\254\321T\301\322\rF\356`\245\240\214\307c\bK\254P\210\221E\250(\242\021\311\002q\222\002\241\211\005b\224B\022\321Q\202\211A\031:F\006\021@\006Sf\205\317D\326\370\324c\370\3444\024a\310\016\031\342\360\341\324\001T\324R\f\036\022\0342\203\255\201D\032\217\305\342\220\025\026\203l\r\343\bNH\366\007q(\245\203\005\347`\332\261\300\004M8 \320\301\343\021\036\300Q\f\"\360\203\030\365\264\304\"\203l\323\022\016!d\024\bRN=\322!\306\"\024\004B\306\343PH\3618|"
+	.ascii	"\371\363\0039\004\242s\352\037\310!\016\3441\n\te\324Q4J\021"
+	.ascii	"\215R\306\242P\007!\364x\251\242#}\f\237:@\215PNOE \304\035\023"
+	.ascii	"e8=\021\225\240\234\206@\224\210G\244\222\f G\201`<*IEE\035\225"
+	.ascii	"zgT\375P\226W\2568\251\276\212\211"
+	.string	"\244\t\321\275\357\223\004\236^|\016\270\274\302,\3720\3564\375\263\323\346k\r\320\203\327\265\265\371\032\033\"~\022\ti\322w\263uX\274z \323\021!}\347\340eZ:\300\367\322\272\340kA\\\315\233\255V\313\325vu\245\215\"}\n\266t\223\305-\351c\274\007\337y\256\274`|\214\027\017\343\375\355\n\211\217\027\366\213o,L\265 \222x~\336\307\273\032\345\020R\236\364\314\355W\233$m\345\317w\232\026r\266\371:\223{~\030\270\"Z\300 \244n0i_J\256\330\204x\374\214\307b\016\322\244e\301[I\374\b\226W\272\234U?\265\346bZ0_\033\246&\237\n\361+\313\316\363\311\271K\220\322R\311\343\264B\352^s\264\326\n\231\232\374$u\234E"
+	.ascii	"x"
+	.string	"\026\337\342\254e\266W\324\244\317\271\372)\016~\213\026\206\340\267\021+>\201)\250q$\345\220c\206HDFD\222&i\r\021\005\304(\b%<\017\021P\251t\2604I\322\034\221\037\340\n\364\201\\\006\351\024t\233\341\320,\326\347\206\364\311^3s\250\002\002\235\237\032=\017\207J8O\031\227z\350!\003H\275\223s\236r\260\201\253\314m\243t2\n\335\357\314\207=z\316\243\333G#\376\243\271\324\204\304\032\n\230\024\300\343\220\251\f\304Vr\340\255}1\370\033\323\\\034\2721P_:P\022\240\216\321\342J\343\324\363)\210\3739\277\215O\335\344\307\247\305@\350\300:q\351wWL;,p\265\374\270'\232r\256;M\310\372\244\312\217\354/C65T\005Y\241p\006\216$\225\244k\227\311\312p\025\223s\272\305\233\352J\321\260\213\263(\037\022\002.\020J}\3219\001\270\235\\b\354\031\031\016\312"
+	.string	"\332\364\205\033\016\2738\027\t\t\313\342\204=\031\252l\3459\243\341)\304H\260\027a\034\317K\200\005\177jS\253W\036\331M\242z\300\376\220\201\305p\t\025\214\235\373\374\030Xb\373\275\"F\325\024\222S\177\204u(\030\360\215\314\314#\201\001y\364\003)\r\345\035\325\271\315\336\327\016j\244\013H\274\034)`#\2736\253\342M\210hR\211\270\242\202{y<\f\343j<\026\353u\340\266\263\"\344\363u\353zH@\263\020\"s9\247\226\330okyktQV!4\023\210\336Pv2\324\322\006\325x;\307\350kD\371\201[\001\333=w\017\325\036<\304\223[\331fxg\027\031\033\315\373\210\306&\374\340\270\356\207\235k\242&\216Q\312:\031\314\245\364Q\275\211B\252\253?-\215Y\347\233\224\272\226\324\036-N55\007\245V|\313'7#\311\224\324#1\"\353\240qL\321q\342\273g"
+	.ascii	"\273\336}\037\215\367}\036\305\342n\b\322\277\266\016\t.x\236"
+	.ascii	"Wh\265\310\\\340\273\332*p[\021\332\243\322q\312\027\3067r\334"
+	.ascii	"e\350\242\301\331a\213\256\037\225\202E\017\342\342\330\257q"
+	.ascii	">\224[\250\303\227\001`~\36689\265y\376\367\201\205\026\2706"
+	.ascii	"\f4\364\335\243-U(V\002Z*MO\321)4\310& +\"35e\341\316\331\rO"
+	.ascii	"8f\333\220\240#X|,\323\263YY\337=\311d7\374\257g\244\001"
+	.text
+	.section	.gnu.lto_cliTasks.315.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\025\020\225R"
+	.ascii	":\213\020\037P0T\322\032\003\305\217\323\271\346\220#D`\251\372"
+	.ascii	"\310\302t_\363\242\375t*\371r9\3221\243\230\367\323\021\032$"
+	.ascii	"[\255\344\031\024\333\b<\261E\013\024y%\b\270>(||>sx\030\362"
+	.ascii	"\"\307\200\305J\023\341\212\030\004\242\254,!2\245\224\002\332"
+	.ascii	"\001\267\001\344\001>g^\2475\247>\347\3579;\317\271'\350)\363"
+	.ascii	"L\013kh\021\256\033\344\256\t7\216\347\306\244\271t\267uk\351"
+	.ascii	"\276\322M\245;\255{J\373\230\273\013\003u\350-ms\341@Xd\215H"
+	.ascii	"\025,\265y}\203\205;K\273i9\303\243m\310\232\230\335\016\265"
+	.ascii	"\n7\264\2554\016m_\351\300]/#n\237\360\212\325\315\271.\323\206"
+	.ascii	"\332\274wW\264\260\327k\334l\fl\036\225\017LX\023\243\233s]4"
+	.ascii	"\003\324\346yKi5\006N\341-j\026S]\023\203\213A\206\212\3267\264"
+	.ascii	"\235\306["
+	.string	"n\264\214\2708^kbc\346\\\327Uj\036\247P\233\307\246\355\314\375\244\241\264\035\005\204\306q\335#O\262\270.\232\n>\2416\217\321z\330k\236\332\302^\363\270e.\363n\026\267HO\f\f\227\032\023\256\353\032\277\005.\362\266\211\330\241\242 \240\037\037b\017\317\316PG\230\203sc\023\254\241\001\256?\325\327K\205\336[n_\215_\027XV\023Ui6E1\247E\211\226cVI\207A\226t\265\032\233\017\245\276\255 KZ\216iC\372\242n\316\255\331^/bA\210\225\016\202\322@O\372'->\353\270\370\254m)i3f\r\356\363\304\211\023{\236\315C\003\023\337Y\322C9\346\0223&\f\256\363B\013_p\301s\2244\216\222$~c3\326\301\261\246\327\020\321 i`\352\323\0043\244\345\230)\244\305\036\310\210h3&\021_Q\350\037\nfL1WS\2466#gZ\216Y$\r\306"
+	.ascii	"\247l\267&2c\206\271/e\345\230P\240\\\336K[\313J\013\371j\254"
+	.ascii	" $J\177\020\fH\312\272\256\333j\355K0\245\273\257\206\353\272"
+	.ascii	"\354]`B\232\215\232\331\007`\356\020\230kj\004?\024\375\232B"
+	.ascii	"\227\256\276\277\361\375\206\351\275\357\323-\357\034\357{\357"
+	.ascii	"C\346\r"
+	.string	"\363\317m\215\204\020F\002\342\272ZF\274\007J\342}S\372]\023\257\244\301\375\332\214\376]I\001\r\345\266\177\036\345\327\224g\223\330V\024\365\235\336\037\364\236\276\335:\315\022&\346NJ\020@\274\256\243C\244\261\371\254z\376U\0074\324Ju]\327\311\037H\346e\367\374\361\306\322\320\004\324\256\247g\266q\003\272D\334\326S\351\262\005\326\213.\220C}\273M\314\353\214\207\364\235\354\337q\335l\2353&:\326L\271?\350\351 \213\274\251R\257\277\364W\352f\213\022\261K\225:\200_r\013\r\275\327\032\316\001\036$\256\373v\027\004\352\333\312\243\b&\360\356b\242\327\331\2278 \237\0054\004J\223\177'\037{\375\025H\021\002\210\32713\005\275\303Qu] N\334_\372\r\311\375B\363\030\212\207wW\363\270y\364\232\327\017\214z%A\027E\313\357\230\321\224\376N\346~\201\244\256\f\377\021f\tv4"
+	.string	"t\326\001t\316\201Cu\276\241:\333\b"
+	.ascii	"\350L\003\350<Cu\226\241:\307\350\266f\030\255\245\371\305\223"
+	.ascii	"\223\213\026M,\230T\347\025\252\263Qu^R\235U\254\316)Vg\245\325"
+	.ascii	"\031\305\352\234\304sF\3729\037\361\234\001P\235\213\252\363"
+	.ascii	"\t\325\331Hu.Z\235\211Vg\226\347<\264:\013\255\316A\2533\320"
+	.ascii	"\352\374\263:\023W\347\236\325\231gu\336Y\235\207M\245Ygu\026"
+	.ascii	"\376\234s|\3168>\347\233\236\322l\263:\007\177\3165?g\232\237"
+	.ascii	"3pU\235\177<g\325\347\354S\235{\001D_\364F\177\342\213O|\341"
+	.ascii	"\277\030"
+	.string	"\241%RD}\333n,uS\370\254\342\367\353d\306\237X6\2157\372^\233\267\364h|\321\367\353\246d\237\350\373H\331\033\234\n\354O\221}q\241\343y'\267[\353\240Ee\030a\270\303\351[\374\262\335Z\030\027=\263\0336\360\234\3524=\323/\033L\017}\257\340\"x\bCo\023\375\332\362\344\035\032\357\364;\336\215\224\275Qy\2333\276\351\033\370\236+\373r\3676\225\303\034\337jb\\\364,\214P\307\323\370e\017G\030\021ft\204^\307\023\225\035\364B\217D\306\265\032\350\203~\210\314\317\023\037\350\347\203H\224})Bx\303\035\325\303\202\223\343g\020\237\346\b2\342\363\220}a\241\313\351\371\034\337\363\003\227\235o\f\317\367\374\220\332\353\344(\204\235\347y!\265\2679|\341\357|\277f/~\370A#e_\304p\331\031\221D\017Gp\336\311\300\030\357l\321\2612641\036\306/\221e&"
+	.string	"q\3743\021=k\332\310\370\324K\264,\fM\214\177\361K3-t\n\261<oj\224\272'.z\326\f\332x\031\277\314\371\247\357\034\334m\317\202r~%\373\202>S\033\234\267\361=?\334\340\274\317\231\367-\3707\377\303^\2224\325\202m\222^\360i\314\332\026\032\332&\t\376\016\331\327\025\272\216\301\rJW\r\315\327\320\265.\300\240\276-\004\027\223\232\377\321Py\262\216\035\234\027\232#\007~\217\351\316\241\221h\317\206\306\2642\250o\277\265M\332'\373~V\r\r\225\002>\220\354KM\b\005'\020@U\251\323,\321\262\021~7>\306/\273\217=\365\037\b#\302\005)a~\037\343q\374\237y\235(\375\216\325\377}s\331i\371\035\224.\202L\227im\030\200"
+	.string	"\002\002\234\244\300"
+	.string	"\b0P@\016\226\307TT\022\253\007\322\007\024\022\253c\211\223.X\300`*\262STQW,\001\354\003\f\260,{\303I\247b\312I\030\305b\222\251\270\224l\361Td\223N\305\023ME\243\025\223\220\331$+\027LE$V\005\233d\261\242h\303+[I\031{\034\257\250\256\222G\252\036>\216R<68\262\254\025\226\321\307Q\212e=\270\300\buu\254b\257\254\242z\260\t \247\260\f\300"
+	.string	"\tu\001\362\252\246\003\344\024\024\226\006PU\006``u\324Q\001\226\325\r\225\005Sj\022\001\f\254\216W=\037G\251U\n+G\362H\245"
+	.string	"\024\217c\025\324\006\307 \324TT\217\244\024\322\307\310\245\250\036H\343T\324Q\312\210\254\2622.\r\231*\003\250*\343\025\025U\225\021\210\246\325\177\204\325\032\307\253I\2218\255W\022\275\223\2319\230KS\361Ko\374\025J~,\301\363\203N}\375-\354\263V\330\274q)}\025\237,\003#\346us\024\257\364)\276\275x\013?\314\360\3748\243\276\376\034\373q\227\"K\351\177Q\264\222\036\3057T\331]\222\276Y\210~\375@\303\333Kwi\271\230[\021\332e\227&%\344X\251{\302\0269}\372KN\213\232\336\006\351+\030k\"}\253u\002\321/\037\236sClm\264\022$\301\263\220\316?\271x\026Z\337\351\227\034\304\3429\025\n\340\233~\231\263\312uwZ\004\324\342\271\347\364.~\311@L\317i\257\351Y\264\004\337l\r\234+kk{\233\035\244\256\273\202"
+	.string	"\320\306\231K\363;\017\202\341m\220\026,\310k\0063@\357d\030\177\024\326\2220T\202\372:\2221&G<<\207M1#~\346\032\200w9\037\342$"
+	.ascii	"\360OI|\336\311c\232\214\030)A\020\301\332\023\304\324\327\311"
+	.ascii	"\222\274f\200\213\333\372\254\236"
+	.string	"wr\201G\250q(\345\224S\n\215\210\210H\222\244\220\016a\005\004)\347 ,\017\022\300e9\2475\243\341dc\377\r-\007\n\334\230\354\333\224/G\312\344D\315>}\355v\357\277\275\004\240\t\364\217D\205\355 \323\306\220\r\271j\207\241!\245\240\215p\344\272\233\376\341\221\302\207\364\226\f\210\246\367\367w\266\306\334\253\331N_\321e\263A\037\237\220\251\003\203d&\321\003\311\363\271<L\345\223\n?6<?Zj-\031\330\331\034\034\233O\032@\021"
+	.string	"{P\265c\321_\210\320\226Ew\037j\306lr\300\024\245\301\0051\033\340<\2035k\220}AmI\023\341\346\021\004\231M\233\355\223/\360R\177\214\223\200\325\202w\231\005\364\260\323\331,\215\314e\324\016I~:\362I7bb0\245\222R*iv'd\f\257](\351\344\216\245\331\376\\\207\3376\331\364\312s<\377\312\351G\217R\367=\260\005\031\303\336\024X\314X\n\205#s\270\363\304\034\200\"\363\230\034\341\204\210A;"
+	.string	"Wd\002w\364rC<\263M\340\0044\201\266S\rF\310@U\310\234\214H\367khMG\021\362\007e\206\224\360M\210\344s*\362](\212*\226J\310\340z\306\177[loH\225\367\243\034\323\356OI\256\256Y\3641o\360\304|\225\200\345s\003m5\037d\361\213\3161\200L\226KN\030\032%a3L\022\030\341#Y\361\005\002\275U1\r\331\022t\262B{Sy\276\227d Hp(Y\032\013\035\210\356\017O}\276\345\201\t\320q\215\2500\200\241\360\n\fR'y\262\336\350 \377M\265\262\341\002\223$\342\325\206E\027f\035\273\234\336{\373f\032\315\311\267-\022b\0211\211\204F\351~~\261\214\365\262\177\307\270\276\217\363\2737\t1\027\346\026\326\320(\233C\247\217\333\002\177\245\033\215E\"=\213\032\372\033-\311\342@\244\305\037\001\022\227\304\\I<\327\242\377\030\263\237"
+	.string	"#O\0327^\325\213\031\210M]-\036\377\027\231\376\305\255N\216\271B"
+	.ascii	"J\354\017\241\221\262H\306k`\220\022\bA\366,\357R\204\234\304"
+	.ascii	"\217\354\323\360\364\376\351Bs\030\017\340\301i\005y\001v!\304"
+	.ascii	"I\0049\272}\364\311KNf79\206\003\215\331\271\034\342\264\255"
+	.ascii	"R\361\226\322\036`\222\267a\270\341Y\001\037D\307\301j\026MH"
+	.ascii	"\336\257\037\236\336?k\214\242lj\204\n"
+	.text
+	.section	.gnu.lto_cliTimings.316.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`)\001\005\016"
+	.string	"&\231^E\360r\234\016\222\241)\263\007\377\002_\356\256\331=\347*\036\361\261V^\330\227O-\332\236^=r\302?8\177q\304 \340g\201\347\322\366\\5\003\317\300\265\223\365d\360L\262E\320\255j\224X\326\2156\2212\245M"
+	.string	"H"
+	.string	"H"
+	.string	"\337~\3272\211\255~>\200ptm[y\346\300F\f\211)0Q#\004\027\2360\016\216\023<6\241I1\223\0241@\300p\345\213A0\311\220\330\204%,\300\f*\307]\327\017!IU#\231sZ\301P\345\336n[d\373\201}\r\001~\353\227\253VU_S\340\307\352%\34217\346\0041$\310\034%\r\026\316\366\325~\213\273\370\336\342p\2219U-\2279\305\006>\260]Z<'\273\334N \273\364g\373\330\3512Kd#`P0d\346\234\335\242\370\002%\001=\\(\214S\273\302G\017\332@\212\305b$\355\313$cw\345\005\377Nh\321Q\322\031oz\361\257\013\333\234\247\203\242\355\304"
+	.string	"\301\245\\\033C\006=\370\275\353O\261V\214\246\035\331\342Hwe_\204\345\305\213W\345N\361D^(\363P<'&\237\216\346\316\210\347\244\323\241xJ>]'$\352F8\006Y\360B]\n\b\024\3528q~U&\361\260$m\200\332\021$\254FE|\311Jf\214$\fF\210\n\371\r\231n\207\226\035\033\365(\350A\335\004)\226k\f\034"
+	.ascii	"\357b\304\214\226s\271\302F\332\247\027\272\346\260.p\n\232]"
+	.ascii	"\2018\220o\225Y0^\205ag\260\037\244F\264\255$\270Q\334\202o\221"
+	.ascii	"r\t\266YM!\356\310M{\020\306,T\217C\255\220GP{"
+	.text
+	.section	.gnu.lto_cliVersion.317.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`V\001\235\016"
+	.string	"F\032bG\360\222(\035\320^Sceb\027\347.\223\nn\035\347\nKp\213\035QY\277~\2523\275\241\351\177\2152\034>\235\032\272\216\206Z\2666\333\212D\002\355\033\273\227B\031\256j\266f*\n?\271-J\032\331d\313\224\002G"
+	.string	"I"
+	.string	"Q"
+	.string	"W\373)^\243\272\315\207\003\330\225\261\221\355\216\n\\\200\373\364x\221\355\223{\200\355\323*\233\207\\\331\302l0/\020-tv\327\223%\256\272\252\374\2538\210\353eu\3658\330]\253\353E\304-o{\304v\213\375\023\001r\365\342\244\271\340 Y\204*A\276\3427\035\264\317\330\203\313v\327\247\357\262}^>\006\206\203\"\306\322\035{l\251$a_\333\335\265\224\261U\255\251Z\252ZU}n\200\217\232\233\330sz\354\206\330\371\261\263Y\303\304\307v49f-\271\262"
+	.string	"\375x\034(\022v#6\201\023WD*\245\r\n\022&#f\201\023SN\343\302g\\\206\301\237\371t\206\221z\356\035\333\307\307\370\266\030\030\216\016\211\023+\210>?\036\206JH\316\256x\027\310\211\tD\237\366\212I\357\262\266#\002fP\322\221L/\350H\272\222\315\251\r*`I\303(E\202\360q\030\0025\210p\362"
+	.ascii	"t\202br \f\031\360@a\b4\202\200\304\002\226RL\237\307_\007\226"
+	.ascii	">\217\005\034\231\274\017\025z\235\210O-$\224\227:\235P\336g"
+	.ascii	"d\375E\243c\306\222-\023P\333D\302|\005! \320\202\241\242n\363"
+	.ascii	"\003\203  \021~\201Eh<R#\001`)\024\303\301.;\255]\033\273\025"
+	.ascii	"M\272\303\363\253\f[\335|\241\233\362\356n\f\026v\\vH\273^\306"
+	.ascii	">\\\315A\306\263\316\260\232gt\354\362\242ed"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.318.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\210\t\2451"
+	.ascii	"\032T\354\022F`\234N\007?h?\362\210\3770\354\334\004\2234\235"
+	.ascii	"}o&\230\352-\\9\343\317\257\023w\255\030{k\324\2668\020\270\245"
+	.string	"\211\367P`\251\225\002?5\213\006\377\356O*z\213\022F\353;b\"B\233\354\275eJ)\017\001\013\001\035\001\302\366\273]\277\203\301ov\375^\203\337*\373\235\327\357W\277}\301O\233\264\2701\017\223\007\303`\201m`\275uJ\020\237s\177\213k\247\223s&\257\317e!\267r\300\310\031q\231\023\b\255\257\310w\207kbw\277\255xX\232\003\326)\213\313\224\220\201\341\267\003\2766\202\326\277\333\223\270\222\327\335Xx\016\f\243=\221\002\303o\t\232\250\365\265\337<\311\372\332\372\016\353k\277\335~\031\226\002\227\261el^si`\030F\312<\374u\344\321\210S$\016\205m\220]\325\374o{0\002\234\013\243\323-G\036\2158f\252K$\254\354\213jN\364\275\260\033d?\034 \fF\320\001\303\206\267{a5\234\316\007\020\t\033\373\240\230\263\303\251\230\257\306i\254\2720\f\023\247]\257\252Gd\356"
+	.ascii	"\215S/5\t\006$\352t\320\317\352\221\031\026\031\276\027\206C"
+	.ascii	"Mn\331!\306\341\374]L\237\377\301\b0\f\367G\2470\274s\274\333"
+	.ascii	"\213\335.\241\273M\020\261C\227\214\244md\001\2604\371[\263X"
+	.ascii	"\242\234a\f\260\210\225w\315\347mkc\023B\32261\007k\323>5\247"
+	.ascii	"\365\025\233sS\016\314\200\357~\227$\275Gs\026\222\266\315\370"
+	.ascii	"L\224\037\317\353M\267\004\307k\274\026\206a\006\355T^7\n\255"
+	.ascii	"\217\0259\350\371\325\245\316\247X\360Qj\343\021KN\347_C\332"
+	.ascii	"6\325\203:\220\250\231^\316i\336\304z&!\327\007\3755\335\215"
+	.ascii	"\301\2434\2650\fe\320\016\305\3554\264\373\360\2657px\217\372"
+	.ascii	"\332\316!\017\271|\345\251q\343\372\300\346y\217\363'\036\216"
+	.ascii	"j0\034{\364C\033+\025\360\265;\204\210\367h\257R67z\320\274\325"
+	.ascii	"\307\357^2\337\243n\006!ec\243\367\314[\335o\317\317i\335\256"
+	.ascii	"\302\031\255\333\347\274\211\374\315\333U\277\203\212\337@\353"
+	.ascii	"\367O\360\333\207\370\335\323~'\207\337<\303\357\235\342\267"
+	.ascii	"N\373\235\243~#\327\357c\360\333H\374\306i\277\213\303o\342\360"
+	.ascii	"{(\374\016[m\354l|\362\317\363_\370\344\250\347\027`\317S\017"
+	.ascii	"O\316\311I\367\363\235\314"
+	.string	"\223\201\376t\362N\327\267x\275t\262\347\365x\257\367\314\353\370\036\372\361w\r\345\344%\227\257\277\347z\327\222\236\2077\f|[\b\251\271hc\307\273\023\266\261 \344vKJ\272J\027\230\2206\247\365\013\306\"s\363}\341i^0d>>\277\374\324\034\001\337i2F\033{\220\031]y\253\215\371\230\335N\314\315d\031\375\326\334\216\036'C\235L\324[\243\375=c}\305\311n\347\302\0061\267\271\230=6\322z_a\207\231\230\201\354b\"\302<\314\376\222\371\230\267L\230\035K\037\016\017\363\236\371\234\332\027\007\363\356(\342\203ah\003>\357{\323\324\227G\364\355\301\372J\300\033/\223\220\373\032\343\305C\322\307\200\244mG\202G\277\346`\366:\337{\177\b\340\013\322\306\016\366\016y\213\270q\336j6\007=\317\2112\233=fS\363\232=\310\347\005X\242\254fG\033\"&0\236\362\374@V\313{D"
+	.string	"\2226\315\324\244\364\224t\241)\203\023\205'&%c\313\266QT\224\325\332\006\240\206\224(\244\232FSJ\254*%\225\001a\033Y9\261\224\006\202\355\2520\001U\344>\210\212\262rb-\245\\&\n)\3472\311\035\022r\272M\246sJ*\312ub\235\250Rr\207z\372\212\n\252H\001TQ\333\027\222\230,(mp\233\230\206Ne\323\215r;8\271PL\347\222\351dNp\207"
+	.ascii	"\264\023\205\247\013J\025\202\355>`\236\310zr]\tN\356P\317\025"
+	.ascii	"\006&\225\262Y!\205S\t\024\312\242\322\251\234P\242J\312\204"
+	.ascii	"\323\312\212j\303\262ydVIMAQ-\203\275T 5\265D\252\222RR"
+	.string	"!-\233WH\n\222mu\202\331DrZY5\221\210o\\\256\302\031M\352\026C\217+?\221q\177\246U\306\307L\033\377\021\270\300\277\373\333rv4{\177\bP{\037h\214O\246\365\247\205\246\215?\315\314\0035\2726\0345\036\224]\207\226\232\037{\301\202\262\316\363\253\315Z\237\271\223\242)>\r-6BjZn\332\370q,e!z\261@0^/ \300\237\354u\037\246\025\030\200\263\250a,\304\034e\206F$\210\202\024$I:\240\002\021)\243z\021\360\250T\016\242\221\230$\017\331\024\232\023\240 \030V\366=\307^\207\254\267~\340\243J$\317@\200\267\324cM\375s\322\331\005\223M\324\232\302\266\254g\267\334}\377\"\225_\252\005\264\217\3102\255I\020\335\252Y2\350L7)\220E\270h\2032G\376\021\366=\023\222\200\346?\022\275Fo\365\034:NTMI\231\323w^\302\346s\217\027"
+	.string	"\005z\307\371\260\247KF\232"
+	.string	"\361\022\020\316"
+	.ascii	"\261\234\315\247I\323\003\353\337\211-@\205\214/w\214\342F\026"
+	.ascii	"TE\202\327#\006\244\035\025X\024o\202\211\206\354C `&\2303\b"
+	.ascii	"=:?\365\372\001.o\261-\300#\306N=\373S9#\250\271|\223\005\204"
+	.ascii	"\263\312\240\002\021[d\247\017\220G?\032!\350N\254\360\221\375"
+	.ascii	"OJ\037/\"6\320\373\260q\340\217\332\306\036n\026\311/u\257V)"
+	.ascii	"\250\320\227\031\320s\354\272p\325U\245\262\226\001\235\013\305"
+	.ascii	"K}\ts\230M\332\261\376\264zCegk\026\327`\260\273\203\230\305"
+	.ascii	"\374\024\006\243\020\224\006e\3638\202A\271\037\271\260\365\004"
+	.ascii	"l\227\266Ly\303\327\343HhA\363\226\250\362i\256\221\326\022\202"
+	.ascii	"\305\006\tmP%\266#\372\303e\277<\342\020\203\341D\233\035\r~"
+	.ascii	",`\275\f\353fF>)\320\377"
+	.text
+	.section	.gnu.lto_printConfig.319.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\223 E\220"
+	.string	"\332\345\2744N0\216\332\351$\365\377@\254\002\317\273\202\222$I\340'\375\177A?"
+	.ascii	"\316c\200\370(5\224\334\373\301\342\321\276\333\256\013\n\372"
+	.ascii	"\244\205h\300W\324@@\205A\250\243Y\351\356\363\036\001\272\333"
+	.ascii	"\255\f\202kj\334\002\263$0\263i\223\235dJ\001\025\003)\003I\003"
+	.ascii	"'\026P\300\204\277\271\2278\346F\300\255\336$\274\357\316{\204"
+	.ascii	"3\361\026\341M\274\235\222!\334\316\273\351s3\365\344\006q\314"
+	.ascii	"\375\341s/\365\344V:\346N\372\334H=\271\217>\267\207\236\334"
+	.ascii	"\035~rs\350\311\215\374\334F?\271\213zrk\370\334D\307\334C?\271"
+	.ascii	"\205\216\271\203>7P\316\375\343\223\333\247\230\273\347s\037"
+	.ascii	"?7OO\356\f\305\334;\237[\347sc\350\311\235\363\271qr\356\233"
+	.ascii	"\317}\241'\267MOn\367\230\333x\314\335\036s\027\217\271\331c"
+	.ascii	"\356\367\334\331s\273C\t8\301\216\272F\347\247\343\377\342\342"
+	.ascii	"\032\3274\261\265\030\005\315\255\356}\356w\356y\356z\356L\334"
+	.ascii	"\233\270\333\271\333\355[\254*\334\254/\227\256\320\212\021\023"
+	.ascii	"\\/j\351S\301\306v\261\326\215\003\324\244U<\252\201\027\016"
+	.ascii	"\346\322Ly(\275\332\306 lT\326\236\274\332\033\272\260\351\035"
+	.ascii	".\361t\260`\253\223\3023\322B\215\016*\2576Q\235u\312\303\312"
+	.ascii	"\253\375kdt\200\340\325\366!)\035\340\224\032\307\361M\267?i"
+	.ascii	"\307s(\276\3277z\\\2030\362\256vbk\254\223\203\216\020-\312\275"
+	.ascii	"{\021\344Hm\004\353\005\256\027s\\\316\347\334I\3378\235\327"
+	.ascii	"=\335.\204\035-\037q\206\022\350\374\302\006#p\275\210d\375\330"
+	.ascii	"6yK@g\304Z?\232\322\020\367N0\021\201\215u\304Y\204Gii\006\251"
+	.ascii	"\207q\034\307\344\305&\341z1w\003 \300\323\343D\brC+\265J\223"
+	.ascii	"\347n\247\272\333\323\337^\317\020\307B\340\366\3428.D\037\271"
+	.ascii	"^\3548\367i\275\350\372\261\365\342\263{\314\307{\261X\353Wc"
+	.ascii	"k\3560\216c\247'k\333\026\251\337\3318o\344?]\204S2D\023\023"
+	.ascii	"\210\017KJIHG\036:p@\032\215\330P\244\201hH(\b\350\307\247\347"
+	.ascii	"\310\223aG\007C\016\316\315\005"
+	.string	"\033\327\330\026\331\317\317v6\210\nS\344\376\236\200e\271\b'\277\234\f\001\330\227\233\230\262`\311 >,\001\272R\025\275\234\304\332\330\250.q._P\330\001\004\213\300\371\026\274\2144\304F\236\037\031Klq\236#51;*\"\020\033y\356\341\316;\334=\311\034\330\035'\254\b-p\0319\304\206\235\033\331\371\b._V\220|\201\311\033\264x\321\233[\326@u\2426\037jc\221Bl{*\344 \352Z\006B\363\037\264\"\331\347\314{\316P\310G\"\316\343Zf\236\201%!\343\220\207s\371\"\302\342\240\331b\301\221|\235\220w\314\220|\225e\035\026\304`\325\214s\371\272\302\372\324(\302\325#c\310\231\212e\034c\t 6\246~\343\\\276xH\363\205\035n\303\345k\007\213\214\3438,\273\034\200\330\320\341F\366\030\206\367\005\003\330\026\333\364%I\033-\312`c<{sc\314\027\f`P6"
+	.string	"1`;\334\211s@\362\245#gc\2118\216;s\201\331\360\006\300\273\377H\367\013\320=\364#\216\341u\276\310Kt\232\363\030\336\267\326h\0351\222\363\306/\351\034\340\324\355\215\202\334\271\210\211\342\217tnmJ\315L\224\274\210\363[\340.\331\2714\370\247\217\350g\365\315\343\274\337\274oMQ\361\027\276\251\326U\267\265\306\346\335W\361Y\315V\024\250\031\354\305\215\343\030'\300\202\1770\241\315;\025\"\r\203\311ep\240\033\307\361"
+	.string	"\235\207d2X\220\fLH\370\276\347E-\3229\352\324\355M+_\203~I\026\263\254\302.@\f\b\201\021\217"
+	.string	"\343X\313\271:\003\311A`\303v\024\274\330\360\031\0301;\027\214\330z\021N\204\325p\351a\225\241\344\307\350\261\361\335\2526\343L\325'9\205\257EYn4\307A\237dU`>\016e<\311"
+	.string	"\307\200\305\210\203\035\302\202\024\366\374X\033E\375"
+	.string	"\267\3642\270\213\320\342\320\371A\331\322\323\361\026\\\304w\271\276\324\2663\332\317(\244]\257[[\207\006\344\344w?\273\236^9pfj<\223\030Z\241\307\022\236`F7\334hF\303\002\366\304\201\224\303\215\346\350\007/8+7B\342N\340\371\261\f?\326\231\004/\276\003\221\003\023T|\f]\320\f\345\274\236aER7\352\210bp\\\317\036Fe?\334\250[\213\274\340\334\2541>\213"
+	.ascii	"+\231$;Pg\237)\007&FF\223|\3661@\321\306$\263{\361\356\347\330"
+	.ascii	"\223L\310\013.\315\312\224\375I\216\242(*\343Sz\232=\317\334"
+	.ascii	".0\361\013q0\306gy\031\232\301=\0357\0201\232\003"
+	.string	"\3017\213\023\342}\242~o[z7)>\371]K\355\333\370R\233\374\177\036941\320\277:\035K\271\373y\344\231$;W\027\275\340rX\241\030r\fA\232:\004\250\321\0319?\326\371\341\3533M\315\215z5\377\222\327\333\025\007\351Km\210O\361\002$\026\376\220-4\364n~\254\335\211\363\354\005\236)b\363\3007\3536}\210\357\362\367 \361\351\346\326)y\321\311_\310\353-\361\302\216/\265M\377\300{YZ\"\337V\t\320|u\233\037\353l\027h8\306X\342[\030\246\320\242\370\026\206&\024O|\213B3\354\002\377U\002\013\265\274\002o\331\304;}W\266\013,\234\032\275\320[\030\322\265\356\220\242g\031FY\326Ch[\024~\371\354!\264y/\260\020Jv\017\241m\372.\021Z\007^\304\0165\177\356\217\361\330\3603\276\020\024\204O\26667\352LP\360\035\360FmO<<\346\351\026"
+	.string	"\340\023\316\215\372\332\t)\031K\214\"\305\005\002M,\340F\375\310\002p:uZP\366\307\274\270\002\017\003\242\b"
+	.string	"\260\0017\352e\n\274\001^om\326\26625c\344\177\254\337\326\304{ \027&FF\323D\331\2378\013)B\224\305q\324\271$p\243\356C\311\213%\276{\202\n\262s\231\370l\r,4\2028(\343\263\272\343\240\371\307\272\375\257\327\353\265_H7\354t=o\r<\317[E\n\b\036\3608w\007\216\271\031@\021Z\371\372D\376\262\304\030y\001y\261\336\210\0272\024&\207y\362\207\336\001\325\244|y)\004`r\302\r?\306$\373\223\177\222b"
+	.ascii	"\300 o*m\267S\215\363\332g\215Nq[#R\344N\334\303\222,\201?\n"
+	.ascii	"\273h\370\261f\255c\244$\f\265\277h\215;\204\212\032\244tF\246"
+	.ascii	"\324\021\337\325\355pMR\024\355H\363\312\212C\256<\223\027\372"
+	.ascii	"\206W\226\2742 \3300\255\022\367\322\330z\275\336^/%@\352\273"
+	.ascii	"\2754\272^/\257\032/\030\225\024\330\236nBCR\2744E\036V^\355"
+	.ascii	"\225\346\"/U\322hPSxs\340x\245J^i\022 \222O\362\346\b{\245R\261"
+	.ascii	"\267\007\234\025-{\365\321P\020m\220\342Y\331\303*\177\366\006"
+	.ascii	"y\277*(\274c\016\354\364\330K\202g\366\022!{\317\210\274gId_"
+	.ascii	"\366\0221{\317\316\320\336#G\254C\204<\335\210\206\244xkS*{\205"
+	.ascii	"\357\201\274i?\307\367\343U3`\003\217*G\320\370x\333\330^\270"
+	.ascii	"\351\013\227,\343\361bo\233\333\013\007\267\344\225\373\"&\026"
+	.ascii	"\366d\323\300#\3053\302\246"
+	.string	"\255\3609\336\2727\\\241\273\351Mx\235@\260aj=\322\206\343\315{\357\336\352\337x\253G\017\3666\336\274W\357\255\276\325W\312K\345H\034\342`\t$\244\b\332 \255\003\234R\331\033T~\204\327/\373D\201\242\227H\355z\261Xy\375\236\306\353\207\004\370[?\343\305\322\367\372\371my\273t1\264ze\257~\214'\2331HZg\235R\337\314\224\327z\005\335\250:W\343\211\232\317z\301\374\275\202\327W\360HM^\363\202\t|\005\005\311\274\204=b\217\242A!\324#\245;\234R\337\212\224|\370&\026\333\340\362\322P\317\274g^\3037\321\360ML*\314e\3363/\342\233\370&\276j\336\253\324\372\314#\336\243\344A\030\372M\242\220\201e<\320\026/c\340\255\026\003K\223"
+	.ascii	"\303\344@x\213\006,\225v\301^R\"\246?\270\206Q\031\f\346F\277"
+	.ascii	"\210X\217\316,<\303\200\344\326\276\254\375\017\263.bV$.-%C0"
+	.ascii	"\216V\350\363\333\215l\205qh\311~p\2160X*\326zQ"
+	.string	"\350\023 \202tv%\026\nz\007r\350\311\017z\037T\033\201\314\226\016\027YL\b\361H\351\312~\207\222\027=K\276\002\377\310^\312\262X\201\203d\243\037i\356\326T\201\311\306`\263\025`3\244\262)\231\nLF\00463;\203\321\302| \016\262\310\032\274c\311U8I.\343X\272\233\362\036\234\366\307-P\356\356\n\360\242\036\254\326^\315y\360]\322]\306\203\325\330\340\273\2736\330\355j\305 {5\333\301p>\245\f^\342F\263\024%/\002\351!\177\036\b\236\363\340\363?\357\202r\271\t<\307$\313\301uN\340\273\274\326\213>o\004]\323\322\243\227A~s\353y\327\003\303\363\307/\352\313\360<m*\220\311\360L\350Z\037\"\006y\347;\257=\335\216]\326\262\034f'J^\274 \005\246b\200\217\255\317\352 \247\301|\005tN\222\225\300VX,p_\333\327zq'\212V\rU\265\274"
+	.string	"U\265\374\351b\037\225\372i9\265\274B\"\247\224UR,\244\230V\310%\323\252y\265dz\350))\345\n,\246\261\261\2320l:*\331\344"
+	.string	"\253\t\303\211\205\213!,\246\213\305dQ\245d~"
+	.string	"\245\264iV-\251\232W/>\200R\0325\326\013%\273\204\262\242\342\340\211\351\364\264B\250\215\035\225\234RJYI\001\265\013%\025\333QI,\246\023\013\027\307v;*\271d\276h*\227+\2344\\\3454\022\247\333\216J^\021uT\322\251\031\305Bjj\305P_\310AbIQQ]\310\321\351+$\244M\267\355\275\204\241\274\262\252B\356\364\025\213*\251fsy\205DZ5\221J\346\013\026R+\252\254\236\220\315\345\325\222\271\324H\234FBU)\251\250\254\236\220\313\250&\262\311T6\257\202\272\312J\352\212\271\204\341zP\354+(\233\236\232R\262\275d*C\200b*\243l\372\252m\027n3\227\315+%\225\261\251d\332`-\241\252\036XNI\255\260bR"
+	.string	"%\345B\207\271\304\222\242\322iN\275P\256X\236\270\232R\276"
+	.string	"a\231\303lZ\300\242J\nJ\271t"
+	.ascii	"KJ\002+\030\314\345\025O\213+\245\004.\250^@\271WUVRM\027VF\250"
+	.ascii	"\345\224\007\312*\024K(+\t\242\236\232J\017vV\254\220:a\005\325"
+	.ascii	".\253\244\246\240\250"
+	.string	"\236\214\375\224\224\232zr\252\222RR9=1\257\234\222>m\345b\311tjZY1\235n\342\264\234\215_\210W\030)V\255\207:\347\302T\255P6\216\343X\304\227\263\016\310\211\033m\315\304\324X/\347]Q\2313\317\215\266%\204I\033qG\030\350\364c-B:\345\317\004!\320j\222\311\017\3043\365\2614f\200x\240 *\320\335\211!\343\021\342\003\373\341\317\275\004\222p\243i\351\214\322/\275\013\2621X\250\322\003AU\230C|k\302\035Y<\230\222\036NzgA\255\214oKG\346\223Q\303\b\b$\277\243G\372\234w]s\364DA\330\256\210oZ\036:\274\207\317y\211h:<\021\224m\r\342\033\321\240\332\225\017\207n\03137\364\226\266\270\031\237J\365\304L\251e\230\312<\323\214\312Z\022\364\236gX\b\235U)n\264\210\306\312\030\370\232D\205J\240\223\317\212\033-F\251*]9"
+	.string	"bq\006\262j\220\317\241\357\277xA\312\261\215A|K\372\261\036\021\346\310\371F4\036\276\352$\276KEK\342\237\313\217\320\005\206\016\351\307\364\234\304;\037gMML\317\310\017\2017z\337\"\306G\342\021\310R\336"
+	.ascii	"\017\217\236\356\374k\255G9\266\277\3032\036^\013|=rny\222\205"
+	.ascii	"=\026g\027%\247\0277Z,\022\302\353\017\007\317\n\202q\207\f\244"
+	.ascii	"P\310\344\300\024}?\337Wq\376\265\243\320N0\316\300@C\256\026"
+	.ascii	"4|\221S\360\251\274\224\237\342$\343$t\026:\013[/j\330 \b\233"
+	.ascii	"\037\"\207\037k\002\270\214\3407\242\031\321]\215\203\304\271"
+	.ascii	"(\321jC"
+	.string	"\252h\001x\370s\254jR\277\350t.'\237\350\273\235g\234\210\f<\321\273\026\267Q\242&\375\003\340\031\370\316\\-\004\202\264\250\302\360,S\342\034S\210fDDS\220$\035\202\013\020\210BY\242\206\345\001\022\340#A\021\244\016\322$M\007 X\215a/k\264?\034^^V\37358\332S\210n4\260\006\b\373h\316\022U\023\240!\021\013\002\213 '\241\234\307\345\r\306^/\374\"<\207\346\331\341\331\230\357\220\0239M\253\344\264k\212\335\307\263\330\357\370\364\001\253X/\345#\004z\236\324\265\320\314_\225*\027\037&d\214\360\350\030Y\344\272uU,\n\b\352\201\336\202L\355W'\207\251f\217X\004<C\3614\030->E\206\233a9\271)\005Z\277\022\231\226\206\313|G\r\036c\030\321\016\320\031\305\270%\231\267\345\260\210!\273\343\300\367\322*\363\330\005N@y@&_\330\234\0045\240"
+	.ascii	"-H$R\275\3055J\250\233\247\303\320\007\224\354i\"\016\216\306"
+	.ascii	"\346@_p\270tp\346\314\"\210x?\354\347\353\3608B\343\325/\263"
+	.ascii	"Tpv\343\355\361\200:\351\213DE\3059O\334\002\016*\335\337\312"
+	.ascii	"\224Lf\367\355\363\3757=\022]F\262!\254"
+	.string	"B+\322Q\2674\354\032\007\225z\333 u6\334)\337\315\344\376\370\031o|\236/\311\302bN\240\377\207\227\255\257\006\354\003y\221\017\220\315I\325\276t\001\2612\026\345\222\2209\212PUn0\221\007\263\323\002\222\016 @\240F\300=\221t\271\260c\"\230\301\375={{dAn\035j\215\351\243\274\307)h\374\005p\332\212\006Ef\017\315^\002\232\357I\216\344\360t\375\263\034;\273#M\330\317*\271=\240\252\346\360\007<\0217lD\376\230e\262\023K\376\257\034\256/z\324\021\307K a\"\210,\273\265\007\017c<\231\2216\330q\003Ha\306v\034\214ck\267\306x\331\214GjI\203L6L\343\322\210!5\002\210.gUf\375\217\237\314]f\230\236[\351\241\307\320\r\201\034\326\300P\261]\036\025\221\203\261\031\214}\265\2333\b0\023\021\250\020\310\215\021\034\201{|\005\372\315\236]\342\034"
+	.ascii	"1\201\267)<\365=\254&\370Q\021\3427&~\321\013\320\017\2122x\255"
+	.ascii	"I\377\273O,\t\t3\227\203\213\237P\005]z}\237\342\256\341\\\320"
+	.ascii	"q=\372\231\263\345z\""
+	.ascii	"|\022\002\306\210\252\3251\b\256|\\1.\274"
+	.string	"\357\256\\hB\366)\323,\2227\305Q\353\3106\215\367\024AN \341\276\330\352\032x\021 \021Z\224I\311\005i\240\225\261\362@P\223O#d\330BR\253h\336K\350\247#\363\314\3277\006\327\254\200t\341N\254\232'\334\322\373$[4I\333\333^C\215M\036\232c\375\227\340\252\367?\274\036P\fM\342\253\357\365\033\211\361H\003!\257\3730B\242\373U}\217e \275\031\341e\271b\243\026K\224\321A\022\271\206Q\f\302\273\372\006z\037u\272V\017\375\t/\033\354\371,3\332\313\333N{0m\370\201\347\301;\235k\377\272'\201\211\0079 \357\346a\324\265O?=\2506\321J\004\022\316\026s\317\237 o\360g{v\271\313\354/\253\177\322<\344\2060\373\231\237P\226muO\314+\024[\334\t\364&d\225\245\353l\026*\226\221\343a\230@\260P\027\351r\375\325X\001\032\375f$Yz"
+	.string	"\2540*\361\177\202\304:\212\203-\243\235\226\372|'\321\354\342]f@\3517_\037\377\242)\326\016c\247\234\017u\365\216q\n\016\020\236L\022\272?\240\002P\306,\021\325\213\332H\226\253R\254h-\226\212x\302\177\257\"\221_\266quDH\363\321A\232\342EI\331\272d\003\201Q\004\233,6\260|\252\r\303E\264ghY'\\\374\332M\265\245\234\033\337\205r\3448\260{k\033\230\276\305Q$\n\032\374\0037\270H\336\363\252\361.\030\032\215\272\211.N _\271C\020\220\340\223D\023\362\305U?B\3138,\037J\363\200\262\230\213\007\301\b\303\020\370c\352j\355\220pVL\025\265Pp\205H5\001\327&\374\224\255\270z@\345\320@I\257@i"
+	.ascii	":p\007PXV@\006\255/\360\343y\351\021\225\334\032\310\261\310"
+	.ascii	"\276\236\016\270\215\331G\001\017p\306\003'\242]Z6\025f\210\313"
+	.ascii	"\236\356J\r\247\214\267\251S\021\247\202\370\021\337Om\374\037"
+	.ascii	"\300=m\033M\303\236\222\f\201\313\354NdE\333%\236\300\212z\313"
+	.ascii	"!\037\300\023b\306&\342H\310\336\213\004\237Z\231\213\203\271"
+	.ascii	"ds\245\347!\325\277\bI(\215\240p\"\203\346\305\027*\223S\316"
+	.ascii	"\3370\3375]dA\274}\200\257\354\274\364v\362E2\217\207"
+	.text
+	.section	.gnu.lto_cliDump.320.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"u\007"
+	.string	"\242\31645`m3\006"
+	.string	"\322\262\r\217@\0217\027tC\350\303yQ\024\263aL\235\024l\020\341\343\376U\254\241\016\266\021\004\261A\300\202\"=\360\032\242<\333K\266\224)\005\033\017\306I\350\\\226^\032\214sM\017\206\320\231\227\26605\230f\n\033m2d\2316/\337=]z\265B\321\250D\202\220\021\235b\306Q\266\r\016\321]\013B\021X\"IH\256\375\270(1ZO\377_\351\265\016\331q2\t(\344\244\304\302\032&?\305\212\312G\324\310\306\245\255ck\017\177l\016=8\340\367:\300\3773(\201e\252\2371\225)\313\002\225\251nm(\017\376\242B\001M\210\244\374\2372\303\233\343V\033\304"
+	.string	"\335\207s\264\034\374o\354>\025\256t\333\201\266\231\266\034\001\t"
+	.ascii	"\357b\310\304\363\275h\306\005\"0\352\022V\263\032\035\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_cliDiff.321.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"}\007"
+	.string	"\242\01655Po3\006 \331wO\260\301d\265\022U\322\361TN\256@\333\220\231Q\215\343H\211\351\007\2145v\326\006\230\231!b\005\362 sj\237\307\302\310h\023)S\n\236P\366Q"
+	.string	"a\231b\235\354\203\315P\226"
+	.string	"\232\330\3060;\234j\013\236m6h\33267\340M]~\275\302\322\307\311\024!%JE\003G\331:<D{%\bK\031'\323\204\354Z\260\213R\2435\365\377\225_\353\221\035)\247t\254\264\260\\\230\343\344\257\210\201\271J\205\342\261i\353\330z\304$\234G\020\006\370?\021\322\017\036t\340rU\320\034\313\325\345"
+	.string	"\313U\2716\224'\035\303r\001\2410y\371?\345\2069G\256v\2115\236\250s\314 \374o\364D\026\256t[\201\266\005mC\002\t"
+	.ascii	"\357b\310\304\363\275h\306\005\"0\352\022V\263\032\035\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_cmdTable.322.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\341\025e\\"
+	.string	"\252\215  SP\022\253:\212\224+\020To\207Gj\336\001\bOFL\235\253N\310\214\232V\2536\\jB\300\243\261Z6\211\332\373\350\023i\306\026!d\223I\022m\307Q\"\316\030c\2141\306\020!\324\f\207)\007"
+	.ascii	"\264\252\271\233\357H?\r?\032\221\301\366O)\245\n\002\r\002\335"
+	.ascii	"\001@\022\347\020\\\241_@\031T\352&\205\243\327\227\020%j\021"
+	.ascii	"<|\265\220\312Q\r`\002\316\031\340\b\022\022'\271\341%\303\006"
+	.ascii	"\225\207\320\257\311%&\245Cg\353\304\fM$\246\241\210\313\013"
+	.ascii	"\221\264NjG\257\256%\351\035<(\230\202\220XH\f\256#2\030\322"
+	.ascii	"<B\277&\022\364\352RA\t\317\026\001-\374H\354\002\376\341\252"
+	.ascii	"\201}\364\3341A\275B`\236\002t\360 q\017\274BO\034\331\216\025"
+	.ascii	"B\277\246\23630\236<\245\3005\360\r\022\247\200q\364`a\033\252"
+	.ascii	"\214\023\364\332\023\205F\224\001\330\204\021\303\360X\006\211"
+	.ascii	"O\230\241\332\300\241\327\236\033b\2509\264\016\275\366\344\220"
+	.ascii	"\255*\017<\354\241\327\234fIu\241\024\224\332x\260\217\304I\230"
+	.ascii	"\204L&\217*D\350\327\224\305\207\225\003\344\214\227\216\277"
+	.ascii	"u\310k\307\007\365\007\020\275\346\251-\225)\210^sp\216*\004"
+	.ascii	"\017\207\3505\023!\242\242\310\nnA@k\274k\374mC\3367n\324\"F"
+	.ascii	"\364\232]\220\261Q\217 \321+\376A\246f\005\036\262I\242\216J"
+	.ascii	"A\252\004\262\306[\306\3373\344E3T\235\264\022\275b4fVhlEF\205"
+	.ascii	"R\203z\275Z*\023\365\"a\nr\331R\300*\fyy\300\252\300\002\275"
+	.ascii	"^2W+.\320\353\255\302\340j\001\252*\362z\351\222\201\006z\275"
+	.ascii	"Wd\\6\020\3725q\240\327\313\244\003\365\n\203a\030\220\032\357"
+	.ascii	"\016\376^!o\026,5\215\203\314\212\007\037\350\365\356\220M\325"
+	.ascii	"\360\220F\bj\2210X\346I\366d\274Q\376F!\357\024)5\355\363\255"
+	.ascii	"6\275\336\022\240\020\t\375\232\270^\217n\257\353\262]\215-\255"
+	.ascii	"\251\341\007\364\371\222\032\270&^\327u\241\306\033\364\227\t"
+	.ascii	"y\235\350\314\355\213\221DA\223\026\247^s9\360\264\013\275\202"
+	.ascii	"p\201/\360\320\347[E\320\253\002\262\353\262#\250Y*\007\327\b"
+	.ascii	"\307\374\340\363%\335\031\327e_w\254\r\321%\031+&\374\241^!\224"
+	.ascii	"V\017\325\230\253|\366Bf0_bN]R Lz\215\335\220q!\302\303XR\020"
+	.ascii	"\225\005\023\224\232-\227\324\230w\360\371\n\231\263`i\241\267"
+	.ascii	"dVR!\351\020\275\002}\231j\201\207@W\210\250EB\2508O/\341\230"
+	.ascii	"\243|\216B\346)R\250\310\240\244E\264\021\275\002\001yrDM!\300"
+	.ascii	"\022\026\f?\240\317\2221\003}\316\201\314M\230\250N\032h)\b\004"
+	.ascii	"\003*E\222&\321\353O\026'\325\314\202\312\263\345\363%e\034\236"
+	.ascii	"\234~\244\224@y\202\025\031\263\021\237\217\220\031\211\r5\375"
+	.ascii	"#\254\341\307H\246\341\307\007\224zc\002B\371\211A\0062\317\220"
+	.ascii	"\207\374\334\310B`x\202R@?\200\220\231\351\205\024\215\206\275"
+	.string	"\221\271\2202I\235\350\025f%\234z\212\345\035c^\301g\026\310\334B^\202U\365\340i\230P\306\243\002<\204AE\251'\230\200[\202ld\034d\316\221\002\214H\276\001\273\021\205j\013D\2361\336\250\214\302\t\252\223\320\257\t6c\212\325S\210L\302\230\225|6\201\3140\362\252\353\344\022\322*Sz\325S9I/I\255\250_\t\030fK\004\336\032\261\017\036\377@b<\370\216Nb'\305\242\265\350U\367\250S\303C}\203\nk\204\0338$\226\023G\307x\223Vy\321\253\217\0320dH\fG\334\203\307Z$^\243\306L\232\r\264\017\025\2324\013\017\241\\\251)\204\3002%\304d\221\270\f\031\237&cxB\277&\237&,3B\270\313\210\277xlE\3420W>A\300\244Y\332g\207\314\213j\003\017}\224R1j\n&\240\326\223\t,ZHL\265\345u'K\232\225\226\321\353k\315\2318"
+	.ascii	"P\031\261\224\277Q$\336a*E#\364kJ\323\350\3655\246\212Z\004\313"
+	.ascii	"\240F\005R\002\312\t\300\311\210\205\036G\2218\n\224\227\027"
+	.ascii	"\374\3445E\207\224\215\212B\t8\347I\200\247\021/\3618\377\363"
+	.ascii	"F\217+\315\333\b\213\366\263\307\216\245G\373Xr\243[\bk\243u"
+	.ascii	"^\216\037\315&\230\325F\374\330\335w/\320-~n\026\355n\204n\264"
+	.ascii	"\237{h\243}L\300\332\372\347\241\274\034\375Y\213\331\236\327"
+	.ascii	"\235.\273c\266D\372\375\367\236\310\315\034\354'\b\366\023D\353"
+	.ascii	"\231=\256\233mZ\351u\275\357N\224\377\333\347\231\347l\323\314"
+	.ascii	"\243\337\317\034\357\317L\037{\362b\366|\331\023\345\350\271"
+	.ascii	"\311\223\243\"\264=\307\322\353<\272w\246\231\333\242\337m\261"
+	.ascii	"\344\333\374/F\003\254\r\355g\3775mK\323\237\277\037m\027\246"
+	.ascii	"\321\031\204\366\320#\230\355\271\"\276_\334\312\316\333=\364"
+	.ascii	"\250\204\375\tR\241B\305\246\265\350\0377\333\264\337Q\264\347"
+	.ascii	"\272\216\227\233&\226\274h\006\201\275\251\360\271\333P\351\271"
+	.ascii	"n\350\366\317!\025&\254\271\353\177\b5\315?\004d\257\016Wx\251"
+	.ascii	"\334*W\313\335r\277\\0W\314\035s{\270i.\234\033\347\376p\357"
+	.ascii	"`%\\\002F\001\323\3009\260\n\230\005\274\204\201\340\027\260"
+	.ascii	"\fx\b6\202k\3008`'\314\0047\301R\360\024l\005_\301\\p\025\306"
+	.ascii	"\302<`3\370\ff\203\333\3409\230\016\316\223}9F\226\221i\344\032"
+	.ascii	"Y\205\254#\373\310\277\fC\016\222\211\344\246|CN\222\225H\220"
+	.ascii	"\235d\0352\225\\%k\311[\262U\276\312Y\231L\326\312j\262\234\b"
+	.ascii	"\262\035\bR\033.)y\316\026\231}\250\023\024'\323\t\252\302a\265"
+	.ascii	"\265f\314m|~C\3468p\202\262\310\334\0049\221\261I\253\340a\220"
+	.ascii	"\216\034*\013!\324\025\316e\306|\306g4dN\223{\b\252!\033\246"
+	.ascii	":x\3505\246ef\005\036\306\260z\250\002\020\260t\325\346\007\314"
+	.ascii	"ax \363\0301\351\222\017\275\306\300\004\266\217%\377,D\016C"
+	.ascii	"\313\256CO\036\013\221\367x\274\307\236]4o~4s}\266i=\036\237"
+	.ascii	"m\332\314\001\373\262\247Xr\235\316\274\031\335P^\264\371\376"
+	.ascii	"\346\001V,\373F\332\350\347\350\031\263\271\242l\177\337&Z\372"
+	.ascii	"\035\200%\002\2629\006jA\026V\200\265\231e\rfq8/\272\354\326"
+	.ascii	"\231\037\267\317>6`]v\357t<\261\204\035\241\177^\204t\2429\036"
+	.ascii	"\307uQ\204m\313\3458R\377\334\205\370\271\021\322\211\204\364"
+	.ascii	";zr]-\002\213\372^wYm\317\216\243=0\302\306l?\371\357#\200v\336"
+	.ascii	"\350\266\215N\236\303\231\260h\037{\354\366\237\037\225\260\266"
+	.ascii	"\232\217=wc\210s7\356\023v\227\353F.\021\326\001k\023\375\376"
+	.ascii	"7\216\343\225\\W#aw\\\327c\177\027\277y\373(\254\215\266\343"
+	.ascii	"\272YM[\321\023\361n:\037\373{.g~\2644o\346\277y\335\356F\250"
+	.ascii	"\350O\274D\330\323\347@\350t&z\362n%^\366\233\250\251C\373\b"
+	.ascii	"\242\266IX\227Eq\374\3376\316\334 \254X\362\314\223\350\005\317"
+	.ascii	"\355\200t\314\366\234\307\231\177\267w\037\205\254\215\326\353"
+	.ascii	"b\351g\265\037\0229^\232\036\345\277\357\314=\226\336\b5M\335"
+	.ascii	"It\373[f{\337\307\2368~\346<\307\355\336\037Ja{_\333\363\357"
+	.ascii	"\\/w\357\023`]\0265\315\242\376\373\021?E"
+	.string	"\020\211\247\266&\256\3647\361\214\331"
+	.ascii	",\t\213~s\267Mts\224\213;\307\375\357\3476\032y\3467B\317\223"
+	.ascii	"\357\266\265\311dH\246/\375n\177T\254m[\027M]m\333D\036/\252"
+	.ascii	"m\232\350g2\373\262\247y\024\201\371\250a(\3151\306D\204$\005"
+	.ascii	"I\n\205\326\241\005\304(D\331\335\006\021\3208\247\234\251#M"
+	.ascii	"\322\034\200##\364\354\273\351\201T\362\021\263l\347\343\213"
+	.ascii	"\025)\265\2077\341\022e8\324\345I\337\324\016p\007S\027\354;"
+	.ascii	"\374\303(O;\213r.\361%\be\b|\274\214%\330\226\332\267\317\320"
+	.ascii	"q\237\372\023\244\274\263)\033y\321\232\314\201\366H\001\305"
+	.ascii	"Z\006\213\247\310i\021\230\273f*O}Fho\251\326\271K\203\260R\003"
+	.ascii	"\346\362\210ta '\357\257\372\261s^\234\345\327\013I*X\301\021"
+	.ascii	"6xZa\026\266\372\206B\217N\020\274m6\256\016\250\245K\3206\202"
+	.ascii	"87|\334\017 \221L\002\344:\"\335$\372\r\305\334H\313\304\212"
+	.ascii	"?\245ry\025\302\255)\355\316\"O\342\343\322\257\347\315#\313"
+	.ascii	"B\021Q\031\013j\222xD\244\035\263\3556\201P{\240\354p"
+	.string	"8\003\2246\337\325:u\177<\213\205.\034\325P.o\0306,f\270\307O\332fM\035;\234\321\n\260\026i\177\314\244\237C\336\343/\334\001\036\242\375\035FV\301\035Qo-J?\315j5!sq\224\207M\357\032\022\224%$\033\250y\346\245\275\274\377\344\271\030\3500\035\324\260f\247\027\325|Z\r\311\345N\006\225t\006\237\333\021#e\242ev\r\260\016\241lc%|\247\311mZ\006\2350\372HwB \217\256\211'\260\027\244\366\251\257\372\3212pG\352\220mW\037]M0 5O$&\344\f\364\204\257\243\224of\225C#6\252p'\310Y\n\266\224\235\213\267`:\241-CX\263\370\262tp);E\315\312\210\271K\034H\304\027L-4K\250n\253\2402\250]S.!\266\243T\003s\223\0161\2070\237\242elZ\265\204kp\374\034R\214\366Es\374-\253\321$\223\364`\225"
+	.ascii	"\362\372\306!\331O,p\0131\007\236\314\337\274\006[J\\\327+\316"
+	.ascii	"\336\021W'RB\301\261\177Kl\221\350&\\\334m\007\305\301z\227\276"
+	.ascii	"\322<\274\205l\260\007\242;.%\256\236\3757\364\027X\361\f\367"
+	.ascii	"\303\rx@/H<\2527\351\271\023\262\020\220\223\262\027v8\372E\346"
+	.ascii	"\212\255\312*\204\343\177\316Q`.T\370\025\305\233\263\326m\313"
+	.ascii	"\252#JH\003\227(\353u-\333\277\036c}`\367\3137C\215$A\036\206"
+	.ascii	"\203A\371\"\0016; \242\216Z\271\302\353\212\353\341,ql^u1.Df"
+	.ascii	"4\t\314\207\250\227D\3433\336\345\301\201\r\337\344\302\361^"
+	.ascii	"\277r\2445t\267\212\333\374\337\301\220\306\017\340\361\002\311"
+	.ascii	"!\346/\320\0042V\230\237\325 +C\005Zg\"\255\271^\320\213\256"
+	.ascii	"\263\006\356v\235bF\027\202'\336\216\267~\323\243\352\027JI\265"
+	.ascii	"\302\032dG?\321g\316\334\230\034?\230\276\261\341Tca\204\307"
+	.ascii	"\315t\b\177\2334\353\022D\234$\311\306\255w.\344\340\351\306"
+	.ascii	"\263\251pjM\307\243eL\214\242:\302\212\031\222\270\367P\246\326"
+	.ascii	"\342\001\354I'?f-0\276\310t\331B<V\021Fg\340u}\007\262 \353y"
+	.ascii	"#\205aV#\260\260\247\272kZ\264\0236y\207\250\330!U\021\013\003"
+	.ascii	"z\340\240(K\261\305Bv*C\001C\200\024VN\357|\346\232daAN\230a"
+	.ascii	"\304\t\350\"a\201\215\200\355+\2418\251\216(\003"
+	.text
+	.section	.gnu.lto_cliHelp.323.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\313\002\365\024"
+	.string	"f%\210J\240\024R:\bFF\363\244R\022\322\362\236\224G!\260W\325!\017\256x\275x\307\302\216\013<v=\272l\346\265\376\275\f\370\334\311=\277~\342\327\340\035X\207\367i\324\002\364\240\365kX\236\340\t\215v\361X\362\t!r\247\024t"
+	.string	"m"
+	.string	"t"
+	.string	"\306\331U[\243\252\212r\253\210O\323\222Z\253lcx\301\307\3636)\3560\363U\222\343R\234\277t\nGE\250\236/w\330x&\256\021\037R\342\304(!\250\273\322Q\023\306o\350/\241\227>\037\236\376\370x\224\f\3728\272\020\231\242\241\342\353\031\021\244h\361\204\342\333\321\375\360'N[TI\\\374\206N_\023j\255\246=\337\357>\271m$\333\021l\372\024HJ<\264k\261\212,~\273@\373\314\321\024!b\225\267\310\216]x\217K\275KM\227\372*\005\224"
+	.string	"\231P|*H\255$\272\270*\221\224\232q\341\355\237\376\360\306\231p\027\356"
+	.string	"\340!\252+AN[TV\265\236\fN\272\201y\362e<\212\355S\3736\036\304])\304Wj-\252\021U\353\031\343\004\346I\237g)O\232\027P\236\fM\264\310"
+	.ascii	"\224\356\233.\225a@\261V"
+	.string	"\336{\032L\236\214\202\2236\315\314\005(\013\213\330\2639\372C$\002i\\\240\355ZI\327&4\262\243Ll\327\274G\315\200\021\217\234\226\342\016\272*\272 W\n\375\3324\016\364=\317\020\3556g\373\346:j\007\212\265\356\036\330\006\361\0349.F\265\356 8\035\307m\274\214\223\376\240S\276w\322\327\331\017_\341E0+\276\301\300Nb\245o0/1/%\355584\233\r7\263\227g24\233\231\f\207Fs#\233\331n2\031\026\327:\324\330d\036j5\233\f\345\254V_\372\n\020\023\023D\236\325Y\301\026\350\231\244Wl\311$\352\237_\335g\356c\255\265\232\013\374N9nlS\216\034M!\341\255\320\321.\267P\333\302\005\002@Y]D\335\346\350k\2058\320*\027\b\365\305p ?|l8 \340\002\2311r\003\2771b\264\027\255 a\227\017\b\371\222:\337aJ\013`\004\333\220\373"
+	.ascii	"\254\r$+\025!\257e\f\271|#\312\001\017\333\344\216\203E\204\244"
+	.ascii	",\236-\331\232\202\341\217\b\243\233gX[\311n\354\t\t\207!jv\273"
+	.ascii	";m\037\266|\271\225;\200\260\342lq\0131g;Ka\315OSM\260X\204\233"
+	.ascii	"\2654\006\254\341\034\343-\256)J\3339Y\331\253=O"
+	.text
+	.section	.gnu.lto_cliProcess.324.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`0\0305w"
+	.string	"\312\277\\+K \220\342\031\003I"
+	.ascii	"\033\342\222\327\016\t\227\204\033\247\210\004X\230~v\373\311"
+	.ascii	"\270\222\021G\357/.\220\231\022G\265\372j _`\236\027JA\255\346"
+	.ascii	"\002\2501\2237\323}\376\"hhq\302U\316S\022\027ZW\266Wn\231RJ"
+	.ascii	"\001\254\002k\002\253\002#\220h\312x\315x,M\013\361\226\224\215"
+	.ascii	"d<e\363\264\215\327H\334N\362\202}\367^\2635\255i\341^\235c\222"
+	.ascii	"\262\221\314\366i\033\3116O\333H\346\256\343\246\362\262\221"
+	.ascii	"TWn\333\301\310y\377^\034\033z\326\025\024\337\027\317\251\221"
+	.ascii	"|\244l\244/]f\304\240\263\327\331Z\323\320\2268\276\357+\365"
+	.ascii	"-\270wP\276@\314|S\303\324,^s\024/\361\227\322m\306\373\032\341"
+	.ascii	"\325\305%bK+\013\353\312\252\212j*\204T\024\324\223S\023\323"
+	.ascii	"\222R\022\322\221Q\021\b\346\007\017DC\035\2048\004\001\375\370"
+	.ascii	"\364\360\354\350\344\340\3340\022\233\232%\315\2142\331\"\331"
+	.ascii	"w\227\273\254\031o\350\255)\203\256=\255F\f\377j\327\256=\302"
+	.ascii	"\353hj\275RW\355\262\226q.+\031\027Q7\306\267\352\252\256\225"
+	.ascii	"U\227\350Xl\223[\026\033\r\bud}\272\300}i)\024\321\257\222$\200"
+	.ascii	"\254\246\211{\217m\365\245\257\312\260\251\246\n;\004 \224P\n"
+	.ascii	"\035t).~Y<jKCi\341\342O~\275s4\255:ni'C)\224\006o\222B\2418\023"
+	.ascii	" t\206>,\276t\245\225\256tR_#\001B\373\372\236\370\321\241\023"
+	.ascii	"7:\344\363\242\267\265\272\006\301V\2359\342h@h\023\266f\f\232"
+	.ascii	"\227\226Bcpf\222\304`\242\226>\033op2\372\003\353E\005\005\032"
+	.ascii	"\376\203p\261\245\320;\367\260\3072\251T'z\354\241\272#\336\201"
+	.ascii	"\256\205\234\2569\030\351 6yF#H\003B\347X\2551\212~A\034\210"
+	.ascii	"\307\232\220\376\351\321\263bY|[\023\322>FzX\254\032}s\r\b\005"
+	.ascii	"\302\316 \016\331k)\324\005\347qZ\351\026y\254\271\365\316\220"
+	.ascii	"\2365\206\305\267\265\037\255\343C\n\355\3419>X\246\024\032\347"
+	.ascii	"8l\227\335\\\217\006\204\346`?\t\023+\315\327 \244\320\037~\323"
+	.ascii	"fn\315H\330\"\027\350\2344 \364\007K\344\247\204\310\317[\263"
+	.ascii	"\004\267a;I\031\023\032\020\272\002;\302\256\t\246\371\234^\223"
+	.ascii	"$\301"
+	.string	"c\rG/A\320\260O6\310\251\320\200\3206\226\347\206\023\033Z\nU\301g~\364\254@\026\337\326\332Z\3116)J\t\343C#\310\263\245P6O\262L@\350\r\226\371\276\357\262\006\232\267|\255c5-\214\202\243\221lT\026\033v\r\b\265cu\340\f\363\232\332\236V\343\314\331~\232\022\376\325U\337\326\256\375\354\023[\fZnj4Y\036\301\"pM\327,\noM\031\356I\022\357\373\262?k\2545\007\320\314H.f\006\201\231g,U\036\225[\257\365i\314\316d\361\374%VA\244\251zf\225Y\217\365i\314\314\346i\253\336\305\337\304M\013\2558\2114\375\352k\313\217\262U\005g\016\232\337\021\330Y\323<\302g\001\210\215\305\031\326\355\3757g\277\272\247\016\245S\317\274\363@\362\344+\277\235t\241K\247|_\263~r\0176\241;e\327\210K\347\375t\351\\;\367\316\3739\363\335\246\303\311"
+	.ascii	"t\r%\224\357\033\003\213\333\213\3136\200\022\310\bm#\225\377"
+	.ascii	"EH\r\373\344\263\207h\217f~\355\2562\322\330K\276h\303>\202\266"
+	.ascii	"F!\177\303`\216\032\355G\377\272\313\213\002\0168\240md\3307"
+	.ascii	"_\263Y\332\032w\270\331\325\244\360\247\210l\321\266\357\"\257"
+	.ascii	"\020\371\354\267\357V4\033_\310\377\032f\032F\013\366\354\223"
+	.ascii	"0%\024\203\346\327\364+\013\371?\363\002`\336O\260g6\226\236"
+	.ascii	"\341\203\006\034p\240m\344\177S;\0018j_\025\n\252\370\306\372"
+	.ascii	"x?s\n\t\274\237\214T\033\003\303_\214/\363!\325.\377Q\006\241"
+	.ascii	"\355\307 \2170\206\217an*]\005\004n \254\202\002\357g#\271)h"
+	.ascii	"\033\331/mc$\342f\307f\346Wf\2742\377(s?]Z\t\374;\230\307\\\264"
+	.ascii	"\020\013K\201\242\2374\237h\273f0\005\276Fxuqu\222f\021[ZY\275"
+	.ascii	"\327\214\325Q\232\257\272I\263U7i\256Z:S\265\316S4\316!l\234"
+	.ascii	"\245\226\316Q7\316PK\347\247\033g\247\034\347\246\031g\246\226"
+	.ascii	"\322\274\324z\315J6\316IKg\244\245\363\321\322\331\250\367\232"
+	.ascii	"\213\226\316 \226\316L\034\347\017Ig\017Ig\242\244\363\320\322"
+	.ascii	"Yh\351\314\201\3069\350\306\031\310\306\371g\306"
+	.string	"\331g\351\334\263t\346Y:\357\3308\353\3148\347\3148\343\3308\337\3148\333\3248\327,\235\2273\31644\31633\316J\245s2\351\334&\235\221Ig\266u~\244s\207\220\365\210W7\247g\235\361\202x/\215k\231\367\017\351'\244\243tK\351~\322\235\244[\257{\257\273I\267]+\231\233\271\241pKi?\177g\350xwv\350]\243tM\253\"\372x\371D\204\267\247i\242\242\226\362\216;\257\231t\f\315\307\313&#0\313t\336w\207]\024\253=\337q\245\356\n\224RI/q[/EZ:C\rI\204\366\3043\320V\006\256\313\215\\\210K\267\f\244^\347\202\224\340\246y?O<\223\032\231\353\337\331\227\251\271m\336\327\276\202\032\0311\375\b\003\342\321\226\366\360\376F\364C\357\341\221\215h6l\210\276\325\202\346G3\364lc\315\reR#\301\274B\0166\230y)Z\374k\266\340\322"
+	.string	"\252\241t\032\300\245]\022f\n\242\006E\233\230)\363G\265\215\211\345}\347p.\335\317\340\333\t\026\020\251\221\261\302OPH\341\003aN\035\023,\036\204\276\203\344\021\272\t5\251\215F\330\230U\032rD\335\264d\207\333\020S\241P\213g\226\303\330\213\020\361\034\276\304\026\034\034\036\250Gw3b\340\023\033:\210\370\026\357sSD&N\267\240g\002}\320\373\223\237\007\372F{|\372\2150%\333\317\357\004R\031\253~f~u\006\344\373\022F\350J\"\r\210A\r\330\256\230X\305\255'\354\307>\215\233\303G\235\331\275\341\266\321\3755\203\370\032\252\311\217\3303\353S\364V\237f\365J\357\200y\\\272\352\034\r\201>j\330V/\366\377\302\364\020\212\223\310\224\3174Wi\231\335\034.\0136d\212\374E\271\317\253\320\021\343\313|\r\005\237\337\201\243\036\032\371+\3029 ?Q\336N\034\352F\211\334\026\224\316"
+	.string	"\224z\270?\230\324\310\fi\247\340\335\371|\224\225\276\350{L^!M\013\322\307\036\300\356\371~S\353y\0328\252\240\021\036\036O+\323\313\347y'25\264r\363\314\254\201\227\020\366A\206+N\277py\202\301sJ\255\354|\224\331\301D+\324\234\345\037M\340g1\204\232T/s\314\016k\213xY\030R\334\373\276Z\334\203\376^\3051\356\374c?\301t\277h\217~\347\335qjxu\272\t\026\312\351|\324\332/\332\345\2774O\013S\214\tKr\\\027\332\233\357\320\330\210\004q\205'\316Gu\376\346\0330\257\002\035\234\317\371\240%N\"M\307\027p\336\253\007\265\303d\340\272\300]\242m\344\315w\232\n5O\3636\337N\"\313\257\371f\\~\022!\230#4`\201T-U\252\231_\227\\Q<\273\371(w#\375\354\202"
+	.ascii	"P\263\365J5Y_\364iEHe"
+	.string	"\\\202\260pC\240\r\273\324\362B4\276\255%\326#\351Y\343\320\240 \323\266|,]<\262p(\256\352\323\234t\242+g5\370\276\316\303Ft\205\260C\\9\345\373:it4\037\266\215\254\372\306\321\326\370#/K\f\037\303\326|\224}\246jG11\254d*YVb@\201\001\fPbJp\342\001\346\223"
+	.string	"&"
+	.ascii	"X`\001\260\022L\023)\300L$`\002\202!6`\212kJE\007\004\250TtX"
+	.ascii	"r\002*:\330 ?\360@l\203"
+	.string	"1\026bI\026\235A\007+~\314\305\005c\037\260h3\360 \214\005\273A\257h^\021\265\001\007+\244<\330\340\202\016\244V\270\370@*\312\207\305X\204\271\220\032\023\023s!\265\304{\373w|\363I\342\025xfG\\\375\027\325\227`\300\247\236\231\254\013Y\240\367\223\312\033\247\346\332\030\025\335\354\330:\352\313\017\307/\253\021\317\354\320\327_}\332\323\021i\n#\246<\004\330\207\370\261\2515\021\355Q\n\001\007\023\006\264\b\366R\217Q\211B\037\365\0367\265\n:\335\232R*\212^J\330\216t}\224I\030\2051\220\313\360\303\034\372\020\261\245a\264P_\242\377\240>iM\036\316Pe\353Q0O\013\016\r0\370\320\272sB\262\032\310\004\225\316\026\327\034<\334\206\032\224\214O\037\210\254\362\004\343t-\364O\337_\246e\3048\335\274\212c\221,\006\332\036\247y\205\312\031)8\301\372(_Y\031\332\036\205"
+	.ascii	"\t:\tsu\343zB7\252U\255\250\274\236\331\246\257\037\361i\r\243"
+	.ascii	"u\372~s-\276\005\006\031!\231!\231a\333H\247\247\201\273\343"
+	.ascii	"Re;\300\375m\246\241u\352\206\3423\270t?qX\310\022\311\026\037"
+	.ascii	"\253\177\316/\253\372\250\f8pwY\034\031\315\374JE\200\367\024"
+	.ascii	"\247B\326\2104H&F\351|\200\254JF\346q\313O\025(S^\317MOfu)d\327"
+	.ascii	" M\337~m\242y'C5\252yB\210(\256\347'\256_\212\352z\261F\347\023"
+	.ascii	"\212\367\202\342\312%\305y\337\320\340\322G\320f\225\223\362"
+	.ascii	"\353\236\277\304F\023\240|H3\353\364\365]\237\266U\b\225\342"
+	.ascii	"\223>\234<pMq>W\016\313\233p\275\027\346ei\303\324M\243\270>"
+	.ascii	"\305\337\314M\253\327vH\340\024\250\217\262\017i\024_\316\364"
+	.ascii	"=\305\367\\:\253A&M\367\314\373\211\342\373\206\2163%2\230\376"
+	.ascii	"C\340\035\025#\324\266\213\220\305\247\217:\273\316\223\204\021"
+	.ascii	"\305!i\277F\321\274{\342\310\250\344\212\027'&\243g\361\022\027"
+	.ascii	"\267,q/\265 >\r\204a\323G\315:\351]J\304\251aJ\273\244\267\352"
+	.ascii	"\341\207s\275^\257\375\2425z\244O\036:\335t\230 \341c2z\227\036"
+	.ascii	"1\372\235\346\235^\225m\247I\334\230%$\237S\234:\212\311\341"
+	.ascii	"\273a\206R\022\363\213\374\341\023\314\207g\376[\321\036\315"
+	.ascii	"\234\210K\247\224;\361\037\036\250y\247$OP/\201\377\250\201$"
+	.ascii	"\345\024ThfDD$)H\222\3061\005\204 \307 t\347\001\0210\261S\220"
+	.ascii	"\215&I\n\215\001o&\270>\001s3\301\322\240(\236\366\212e;\307"
+	.ascii	"<\213\002\350u\360\352\r\0034\243Q\342\177\266s`\305`#\035\031"
+	.ascii	"\fo\002V\301\214\226\312T\277\233X\250mLc\032F\213$U\033;\215"
+	.ascii	"\203\327s\342 qU\321\020\236\261\201\333(\223\266\235\254\365"
+	.ascii	"\032\225\275\024\347\215\364gc\332\211\335Y\374 \252\024\025"
+	.ascii	"\034oC\235\221\323\317\234\013\230\273r\343\323\022\350\301\262"
+	.ascii	"\034D\266L$\326 \306\325\211\210\033\226\202\325\335j\212\302"
+	.ascii	"\237\266\300h\3242\254\335\335z\272\222y\367\373\"\363\326B\317"
+	.ascii	"\376?,$\237\037\030\302\254\026\214s\220k\2058,\030\0313\263"
+	.ascii	"*@r/\205\262SV3\262\310\231\026\2209\257\016\023\262\320\032"
+	.ascii	"\253\005\r|\243\002\360\346\214\243cI\035v\355\r d\322T\026T"
+	.ascii	"\024\221\377-\337/\006D\3117\177\256Z\246\326B\365B\343l\024"
+	.ascii	"\232\024\303\357\272\002\200!\t\240\364\374%\211\020D\364\013"
+	.ascii	"`MyV}\251@\234\226\2755\033H\247\375\227\"14\262\210\236\352"
+	.ascii	"\340\363\031o\301{\270\021\223[\373\316\005\354h\016'3W``\235"
+	.ascii	"\370\350\\_t\2460\275/8\335\2572\263,\276}s\333\225W\346\027"
+	.ascii	"\265$N\223\240\243*\214\242\277\335 \204\220n\317\315\240\300"
+	.ascii	"\212#\324\325\243G0\036\300\2321y+\023\346\355b\237"
+	.string	"\270\222\363`\302\330\234\004s\312\325\2676\027\241;-d\241\013\221\321f\f\030,\345\013\002\246A\235\013\231'\0020\313\312*\025\306\261[ \204\032\314\240SY\334\251\245\227VS\330\202\365<W\277\263}j\001\004\233u\323\"\036\234~\263phRS\227\273\347\0048\330\213\303h\243\224;\354N\305g\373p\365\237\344-\317\210\316R\243\216\\\344\345\307\304\235\005\261\2164\0020d_\333\r\250\307\303\331`\024\244\264\220\304\177\2464\356ub\022.\027\f\030\203q\002\240\241Y\225J:\305\226\255nm\252\355\372\210\360\300\203\\`LgI\315\351\215\207I@\003\236\373\351p\345kl\311\004.w\2103\317+0\020c\320_c%wN\360\034\364\301\177\336\207LCD\206\023\377K\362d\360L\303\277M\337\313\312\214/\027!\305\361b\205\r\0244\307\300\225\361\243\247d>\230p\004\375\031F7\240\237g2"
+	.ascii	"\267\325\034\272\270.;z\330\f\320\003\346\274\244\313z\205\\"
+	.ascii	";\336\027Nlc\254\306\277JP\221\314\340C\213\021\343.K\252A\205"
+	.ascii	"\021\\\340J\2171\023\317GX-\030\007\027u\023M\222\342o\236\263"
+	.ascii	"6\222\024\002C^\033\020'\032\337La\nK\bt\002\325\255\030k\234"
+	.ascii	"\253\207b\2071\003\300)\300\353\001]\230\026!rN[\307\264\005"
+	.ascii	"\214\357\242\3144D\374\321T`d\301/\244\276\016\027QM4V/Dr^&\341"
+	.ascii	"\351\255\203\370YZ4\016Ard\246\004<\324\336\212Y\234\361Z\224"
+	.ascii	"\237\001\211#\267\275\320\256'q\302'\320\2655\261\350\375\350"
+	.ascii	"\327\037\221D\001\261'V\344\rA\306b\365\351G\2503\237\304\343"
+	.ascii	"\027e0\304]\213\205\202C\275@f\t\206\346\330\263\377X\263\216"
+	.ascii	"\332,\007\347\201\177\346!v\345\236\371\237g\334?\272\345\003"
+	.ascii	"5\262,\235\306i\346\0206\\^\332a`\217\246G\026\340w\f\013&iv"
+	.ascii	"\302.pa\276x\016AD\361\262\233\363`\303\207\240@\331\211\337"
+	.ascii	"\322\023\353\270\376\241%^\\\260{\325\0369mm\336\020\376\335"
+	.ascii	"\017\235[\200\351\270\347\204\n\315>\275\226\374Ri\\\367\217"
+	.ascii	"(\360\003{\021\006\215\256\242\314\253\244`\203bu\275\013\022"
+	.ascii	"B\317|g-B\314\310\001W\353\253\270|\030D\357\262L\267\t(Y{\336"
+	.ascii	"1\215\020\216q\307\324\253\243\377"
+	.text
+	.section	.gnu.lto_cliEnter.325.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\321\001\025\022"
+	.string	"\026\242zI\320\224M:\322\236r\340\222k\035D\246SX\032\022 \3006\212%\274\331DU\331P\032\260\027\346\016j\326\212\005\bI\004>^m\020\252o`\004\212\326\204\177\2116\203\177\342-\240\317\305\016\324\214\271\372x\263\264\333\336)\005^"
+	.string	"a"
+	.string	"k"
+	.string	"\246tz\316\351\233\024\250A\033\032\361#H\273\037nKk\253;V\224\330\376\264/\343\264\361B87\331\375\241\025\355\226)>A\275\272\274\212{E]"
+	.string	"\367\352\321\0262\300\303\352p\267 3\"\245\335\365(\320\307\317\321\177\355"
+	.string	"\310\036\330\347\211\301\356z\222= nz\333\007l\177\366\\\020\261\223\376\215\343\240\340\007\275\272\202\214\314\f\213&\330\271!\331f\024\346\324<Q\233\2465O\272\356\334\200\330r(\314'\352\023\335\006\016\006\033\033\356\225\326\222|\220\370A\316\237\361!\320\017r\206\327<\371\352\277\270\327\223\211Z\322\013\"\261y\263K\331\244'\354\233vwM\177\354\013\375\247:m2\315\036[\214.x|zN\346\313\377\030a\250P\354\352\234\034c\240t\274\325\253=\322\306Z\352\246d30M\324fi\351(5\321\317\216\304\356\302MJi\312\314H\346\006?rA\355\346\254\370<n\344\340\005\006\206{\235\224"
+	.string	"\215\332R\021!\352\027]G\207\b11\334\353\215\220CT\363D_J\230\320\343>\342^>\207\fj7^\335\324|\027V]\bv(\256P\203\370\205\035(v+\261\265\341[u\337\r\007\261C\371,\200/\235\313\003\226\216\306\325\n?\321\325B\222Z\021C\020B\315L+\374^$f\251\264jX\236\2535c\343\261\302\227\247\2422x\363\205\236\b\202\241WR\306\316\343S\302\026\2432 \021\n\246=\246\030U\004\360\ta\223Q\230\021L\227\373\221\005\347# `\002\221cv\007\277\030Rh7r\233"
+	.ascii	"\337\013\346q\020\273_\214\314\304\201\232\213-\371\030\231\n"
+	.ascii	"N\026\254\371\210bL\372\004\200r4d\322R\275O_x\250s\002\213K"
+	.ascii	"t>\340n\372\202\2175^\001\237\344\001\232-\bf\255\260\232\305"
+	.ascii	"h\330\345E\033\310"
+	.text
+	.section	.gnu.lto_cliInit.326.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\202L.2`o\032\003\024b\bG<\251\350\f\f\340\217y\315aYo\362\243BKdv\253;\242Z\016b\377(\002\005\246\246\213\273\312\303~P#me\2232\245\016\260A\024\031B\037(A\243\200R\036\030\242\236\b~\036\036%G\317\323i\204"
+	.string	"\311\027\021\243|\234\353nV\r&\032E{\221X\363h\235\371\3776\253e\005&.%\035\306X\3713b`\316\342T@8m\315Z\207XdzD\302\002\277\205\222\362_\tE\330\330\365rg\262\333x`\262\353l[\b*n\241\2518.N^\376\277\366\341i6k\223\030\240T\221\3144\013\377\313J\225\206\333\334\366\240\255B\333\215\t"
+	.ascii	"\357b\310\f\215\250q\270 \007\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_getValueOffset.part.0.513.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`C\001\235\r"
+	.string	"V\332YA\020\221\232\016\324\207\004:\026xZ\020,\372\203\032\004\301\220\023+\264\333K=\005M\276\212\252R\335\254i\233\026\336\017\202\273\337\3563P\003P\004\b\2503`:>\nP\006\001\243\3776\262\367\2262\245H"
+	.string	"D"
+	.string	"I"
+	.string	">\314e,9\321\266\331\366E|D\307\030\001\n\237OH\210\027,'p\354r\325!\200\203\304\303\274\200x\250\035\216]\363a~j-\236\353\273'0\261a\244\265`x~\374I$\273\353)\303\ro\373\200m\021\373.\002i\351\245\343K\303\227~0\255/\235\227\371\357\221.\b4\354Z\030\351X\020l\361\301~w\331\224\335\261)k^\346z\fg"
+	.string	"\267\0276k\332/q\256\363\030\316\003\354\206f\260\330\345\n\034:d:4799\262\352\323\263\314Pi/H\311k\252\207\001\312\324c\333\272\n\007\323\356\004\003~\n\t*\276\207C\237\023\017S\025\270\330\310A\342\223#\024\266\257\032\223h\267\005\255\310\341\273_$\003&\206'w\244\276X\337\337j\310~\001&\020PJ\"@kFNP4\025\203\223\222\224J\263Q\251F@l50\331T\017,kSQ\266\363o5\344w\377\310\250\222V\260-ij\266\302\366\225\232IT_lCM\215\2527V8d3\307\342S\250\221\306\n\210,\036"
+	.ascii	"\332\343E\337`\037\023Z\363\002,\3601\214\270\205\217Y\274d\266"
+	.ascii	"^!\332m\rX0AkZ\340\001\344\3416@\024\fs\205\203\254\305.G($\204"
+	.ascii	"\316y';\355A\273_\t\271y\\xZ\210\324\024\232\227^[\306"
+	.text
+	.section	.gnu.lto_cliBatch.part.0.518.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\303\002m\027"
+	.string	"\246\252\234K\240\024R:\016\\x\265\035\3627\220\302I:\367\207*\373\375\320xQ\274\205\013\256\254\016\013?\253\316\221\233\2675|\371\344\236\231\337\275\365\257\241\327N\026\034i^\242\013\363M\234Vo@\361\3309\361\202R9\237\344\023B\266L2\202"
+	.string	"~"
+	.string	"\215"
+	.string	"\350M.>\346\274\211\376\345\274\311\374\030\314|\304\034\345E\255\013\305@\346(2L7\310"
+	.string	"\314*\304q\312\275wv\323f\035x\0264v\232\245m\031\220\337aI\202gA\271~"
+	.string	"E\024\211\307zH\234\372\371\343;\f\207\021\311\016\342\324\315\026\2420%2u\331B\024\246\304\245\266e\314\223\212\341\217@Q\225\b\220@\276\316\365n\"*u\013\270,\366\340\336\313O*qN\317\314[\314,\202\271\203\001]\205\323\266\367p\336\370\034<\364^\341\207>T\250\200\346\346-\363\007\241\376\260-\214\225\013$\025\244\320\006\333b\261\225\335&\223\311$\333+f\263\2714\233m\331\334/\376\007`\202\351p\251\272\367)i\345\2360\203\254`\346\363m\374Xt#\333!P\222T\311\270\367\026\235\317u\304\234\246\334\375\342\321k\030\311\024o\024\024w3\177\306i"
+	.ascii	"_\303\350\001\356\275\222\361\343\336b\315M\236\t^\327\252\202"
+	.ascii	"\374\201\016h\346\t\025\272\276\300\274\224l\260EL\246o\274\220"
+	.ascii	"\013\005vP\341\216\246\307\207\353w2\362\242\233\250\226\214"
+	.ascii	"8_\3727\036$\003\001-\r\250p\001\315q\303\255?\344\037/3\322"
+	.ascii	"\202\005\025\344\222\r\262=w=\3112aZ\254\036/-\315\007\256\264"
+	.ascii	"3[W\342\304I\252<\321i\355\317\330\204\337u\036D\374\024\254"
+	.ascii	"\373\351\017o\362\177\316\233\326:\b+\002\203*\251\223l\337C"
+	.ascii	"\230\236XX\213\305\t\336\026\311\310d)\334\363\355\206\202|j"
+	.ascii	"n\007t\003\321\253\271pN\227\353\351\324\016\270\241\033\007"
+	.ascii	"5\327\273\361x>\032\f\343\344\324zrj<9:4u\265\351HX#\250>k\r"
+	.ascii	"\303jS\327\035\b+\005\013j\215z\263\362\320V\236\365F]m\253\217"
+	.ascii	"\272c\323\261\331\326\006\234\353\351J]o\007\224\343\341b\214"
+	.ascii	"\263\331\001\341f\275\335\2157\303\375\204f61\354\013\322\375"
+	.ascii	"fC>\337o\226\276\274\366\212S)R^IV\211\355\313{\357ey!\262\032"
+	.ascii	"\300A\205H\366\353J6 \240\002\031;\233\003\377b@H\341Ze8[\002"
+	.ascii	"8\201\035\033\252\372\002\007\2030e\363\025;\315\224q\030\301"
+	.ascii	"7\033\255\246\300\374[6\253\274x\247Gk\365/\207\307\252\030\256"
+	.ascii	"\310\017BV\240\001\215\363{+\310vG\036\214(\033\020i\374\356"
+	.ascii	"\330\330\"j\021HC\247;L\203\205\026\314\355\005\377\330\257\001"
+	.ascii	"!\330n\017s\022S@\270\337\322F\025]\271\201AsL\350N"
+	.text
+	.section	.gnu.lto_cliTimings.part.0.540.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\216\006\335%"
+	.string	"\252C\250\016D\200\252Mcs]\362\301&[\2059O\203\\\344$Ez\336\256\016\321\305\271\347\233\310\264\357\307\235,q%\310[P\220V\370u\226\237\344,o\306\256\312\326\346\323\007\031H,\020Y\207!K\366\336{K\231R\316"
+	.string	"\321"
+	.string	"\333"
+	.string	"RD/\377\222\036L\223\320\223\325\305\025\351\242\222\243\346"
+	.ascii	"}\231#?\300\354\342\342r,\367\2618\371[|\323\342\364\342\215"
+	.ascii	"\034\260\252\301K\327j_\353Y\322\027o\034w/\022\255\257{\213"
+	.ascii	"\017^z\001\372\322\305\017\231/\321\0170_\336^\336\212m'{\316"
+	.ascii	"\213J.\321\251=\307\336\257[eR\221\351\340\302s\357\325\275\264"
+	.ascii	"Il\2634z\262x\2376=z\232%i\253-\365\245\200G\311\323\007\261"
+	.ascii	"\315\327\020\205\220\027\350\244\021\271W\260\236An\2226 `Z\202"
+	.ascii	"\244\204\244\0059N\262\274\354\225\207\024T-\3530k\352d\331Q"
+	.ascii	"6Y\307\343Pj\352\366^?"
+	.string	"\221e\2266\224\n\362*\340\266S\303\275\327\177\032r\377\334\366\226m,\333$\020k\220\206\224\334+\374\360\005*\364\300\200\027\243~\350o\371P\324\224\2613(\013\254\366\312\326f\003R4c\213\304\306\t\331\252\003\330\252\203nv\003\331\252\001\234\325\267\223\335?g\265\355\254F\317\352\363\2546\317\352\362\254&\321j{V\327\207\271\257@\201\217\004W\356\375\261\266\347Z\225\306'\017\363\237\371\301~\262\337\354\327r\323\276\337\345i\374\243ofj|j|\270\252.\252=\034\320\256\243\361\313\310\306\212\306\212\202tQ\351\331\200r]\214o\274\330\031\247\207\375\210en&}\330\257JH5G\355^\"\206\263\003\037`\2029\375\253\006\220x\357\035s2\351\277j\274\210\220*\217\332\275W\002\372\362\006\316\345[\276W\030\247\203ir\016\252x\003\366\302*\301\272\026f\002\331 \313\224uL\023\032\203u\315\f*"
+	.string	"k\247P\322(\365C \233\273Y"
+	.ascii	"\226\f\323\321\3070nL\247\334\354\217G\327\004{\364\241b\264"
+	.ascii	"\267R\340\330\301C\332\364\224Tl\266\212A\275XA\355\367`\235"
+	.ascii	"w,\226\323\276\r\232\226i\355\324,\246}\030V)aCi3\240\221\326"
+	.ascii	"\266\321\215E\276`\271\206u8\220\266@\260\007\037*Z\bj\265\326"
+	.ascii	"\036\315\343t\030z\363\001\025~\n\204\210\tVB\013\264m\034G\033"
+	.ascii	"\201\336\013u\301w\3637%\3103yi\023(\314\017Q\230/\255\245\200"
+	.ascii	"f\264S\\L\005z\357\265P\255\355\261gL\353\251\256Y@=\232\213"
+	.ascii	"\255@\207\2676\213#\261\327!QS\216g9,\320\366\3762\025\265\303"
+	.ascii	"\332+\333A\365[\017vaD\004\301E\005\242\234\315\277\bFD9\237"
+	.ascii	"\005#\242\037\373~:\033G=\f\030\"T\230\361\202\306Q.\347\373"
+	.ascii	"\351\222x\275\\\216)\351\247\264#\221\013\201\324\3431\221\274"
+	.ascii	"7-\035\365z?\337\351C\222\261k\332\231H-\224\226f\224HI<\031"
+	.ascii	".z\273\323;\b<\031;]\022\357\250\247\333-\371t\020\206\2544\003"
+	.ascii	"iI\307\244\244\264\244\273\331\256\327\360d\203\266\250\275\262"
+	.ascii	"\321\320\304\331\223H5Z\341\330\230\304+\315\331d\336\342\354"
+	.ascii	"\275\376(\253,\263\264\032`?\362\336#\031\324\266\3245;\250v"
+	.ascii	"\212\225.Y;\013\232\366\312\023\252\220B\266\314c\315\303\266"
+	.ascii	"\315zd\013\016T\315c{\362\336{K{\365\"\363\307\n\331\227\375"
+	.ascii	"Qq\262\216G\241\221`\320Y\005\246M\n\274I\237\240\302[\345\336"
+	.ascii	"\347@6@\200\217\250qXe\220R3\"\"#I\n\222\306\300\002\231\242"
+	.ascii	"\3326\021@Q\250pRI{\006Nu\030\264qpW\2658BW\375F\311\254`\205"
+	.ascii	"\031R\005'\206\n\307\316\2658\216\024\356\342\210\350\250\252"
+	.ascii	"\235H\253 \221\315r\016O{ZQ2[E:V\001\264\323\241\304\023\267"
+	.ascii	"\245\257@\324#\312\277\272\250\261\255\006$\203\234];:\365D\344"
+	.ascii	"8/\243\236m\032~\316\312t\267\332\363\244\340\276\341\205\301"
+	.ascii	"\027\374\250*l h\303\243d3st5\275\215\365\1776d\036\364\264\374"
+	.ascii	"Ps\265\220\3073(\272\016 \277\235\036\371\354\243\330\033\374"
+	.ascii	"\250\303\233\002\t\020\021\325\254\333L\245w\243k\035\312,\377"
+	.ascii	"jk\342&zf\362u\254\303\376i\310\356't::\003\300\271~\266\017"
+	.ascii	"b\263v9\364\202\310\263\355\301\235\233\350\353\300\024\250\347"
+	.ascii	"W\274\241*\274\316\203u\356u\246\034\210\344rEK\004\305g\300"
+	.ascii	"c\327\225Zj\016\257\023\221\0241fQ\001"
+	.text
+	.section	.gnu.lto_cliSdInfo.part.0.560.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\372\006\345$"
+	.string	"z@H\016I\200\234Q:\327o\222\312\026\332\316)\336e-Y\347\006\202\331\r\f\301\323\003p\347Y\322\235E\364#\266\301\"'\364k\033d\250\372S\323\217\026\032\321\245\242 \207\356R\371\343aNA\206C\310\324n|+\371\204\220\275\223\f\313"
+	.string	"\307"
+	.string	"\317"
+	.string	"\031\306XXN\236X~\274\311\257\344\335?\362\324_r\257\2565a\342t\t(\263U\025\023'\\\036\223\177\224\203\334r\243K\177*y\272\222\205J\254\261\340g\337\333}$O\302^\311\342"
+	.ascii	"r\326q\304J\316J\241\237\235 \375\331\312\367\240?\323\013@\177"
+	.ascii	"\326~\336Hw?u\203]\331#W5\333\rF`*\023\037 _Py\315\3119\357~"
+	.ascii	"b\036g?Ke\350i\342Kc\373\262\"\342g>ZVXO\323\310\344 \301\274"
+	.ascii	"A\213\264#\025\332\303\245\245m\037\255\252+|\"\251\0041eE^O"
+	.ascii	"\313 \243\274\321\262\272:\216\222\242\035\247P\\\316\371ZUW"
+	.ascii	"\346\rp\232\254(\347\334\207\242\361\256\275\273\273\272\373"
+	.ascii	"H7\332\024\006.\306'\226\341\031\256a\033\276\223o\301pC\223"
+	.ascii	"s\361\306\fi\361\301\317\221\206{c\233\231\006&\366\016\266m"
+	.ascii	"x\226uGw\032\256\025\305\2428\374\212\007\032FZn\241\223\342"
+	.ascii	"\331\207WY\323.\024\313@|J\b\024#-\271\3201\361)\342Q\314.$\027"
+	.ascii	"c\374-\2560Tb\335#\016eMs\226\202\320\177\322\202\327\367\361"
+	.ascii	"\263\357\204\376\274\030i\371\205\016\022\250;\326\266\333m\342"
+	.ascii	"wo<\276\327"
+	.string	"{\226pe\371\212\302\304\213w4\246\035\217\215\215\2155\326\321M\273\215\233\335\276\245\267y\316\3336\363\366\216\354vMv\233v\336\236\231\267\323\363\266\f\275\215\236\267O\363\266y\336\306\346\355\373&\357#\270\313\t_r\027\313\n\313>E\271\f\362\213\233\234q\330\274b\315\340\006\213\343\336\210\303w\331\022\231s\243\0202\017jo\234r\330\034;\322b\213\2544\017j\261\276L8,\217\236\255\264\310\364e\213<\233\253\304[\247\361\237s\316\030\357\350\006\353\267\301l2\024 9\253\351\257\271i\244\224\271\231\237i\2604g\342m\364\317\266(\0316IDV\001\222\223\031\350c\3726\272/\246\273\237Re\006\372y\303\265\344\324\025k\240\333\315\376`\203\334\033o\370j\332\243\202{'\007\303\016\271\365`\211\244\305\336O\027k\344r\205}Iab\373\334\363\255\005\345\301\335l\022\n\265\344\024&v\337K\360"
+	.string	"\232\234\245n\354\266\360.\027\024\240\371\311\203o[\355\031\243\214-\364\365V\337\211\336JB\025R\003\364\0220\370\033\376\206\3025\205\212T\341H\355@\301H\r\002U!\265@'\255\303\325\bm\023\300\337\212_\322\372\033\376\200\030l\355\324[}Hh\253\022\224|\303%\247%_\322\317\210f\373\301\365\217\252\353\345\206z9\025\252\256\347\200(\267\3535 \312\251\272\n(\230r\252\256)\327D\244\n}B\246!o-\301\004\\\217\206\326\341\332[\207>\245\324\007\374%\365\224x\262\346\r\375\222x;\340oU\332\361\204K\273\241\236\016\246\360\tw\303`P\270\253\335\314EP8j\026\001\006{\fj\343|E\211\371\315\324\005\033\003\231\026\337^\271\371_\266Idw\212\2351"
+	.string	"+-\376\250\2465\022\366\333\026\371\n\322\302\265\005\275\304\276PY7'\303"
+	.string	"\311\311:\035\200\211\250qH#!C\"\"a\202\224$)\244\003\320\002\221\241Z7\021`1cjf\206\264\225\375\016\021\027\253\247M\215\213\323D|J\036\342Xf\005\316-\242\207\200Y@\276{\327o\2243\370w\246\235B,\013g\026\351\0012\334\343X\036d\r\3619J\211\344\0320Ny\323\344u\360\334^\356YmD@\375\030\210\223\315\334\237\n *Ar\334\305\304j#\254\201noO\005xTUL4\022\351\264b\215\006\321\366\271\3247;\323\253\2027y\214\331\346"
+	.ascii	"\004\272\226Kt\314}\363\343\220V\377\360\365R\266k\235\247B\365"
+	.ascii	"K\347\335\306\355\203J\212`\353\347\244\345\274\264\236\275T"
+	.ascii	"\265\224Dd-t\037\t\276\026v\343\037\027B\"G\234\352\177\200Z"
+	.ascii	"\350\255Z`\205\377;\247n\332\240|r\244\006\316\335'\336\212\205"
+	.ascii	"=\240\025[\001\315B\274[\232\260:\277g\313\346\217\255\032bK"
+	.ascii	"\323\006pX\213\221\230\274\322"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.565.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\013\b\225-"
+	.string	"\252P\320\021G`\\N:\375\231\351$r\370\376/3JZ&\313\240\242\215\334\233\207b\204\224\3248\206\326\227\247\272\377\247e\246R\211\312\002Z\tB\026\247\200I\277\244\274 c_S\373\373\225\r\363\335\372Z%\333\244\021B\366N2\002\001"
+	.string	"\001\013\001W\216\345\370,\375|\316\312\307\202\332E\2419g\007\354\325\240\364>\353\2534c\\\241f\214\235\034\227\277\354\272\303\202\346\314\024\272\332C\354\325\266\357=3\352Sf\004`\346,e\337\333})';~\312\214\363\344\334E\346\314\231\311\340j\037`\2576\363@\353U\366>\353\325\356G\351\356\250\356\2723\301\262\262\217\335u\001\254\262\324\003\273>\244\025\275\2343\321U\374\365\343\2059m\020\310\376V5\305wx\354;o"
+	.string	"\n\233\346\031-K\251\013s\n\264\301\257\260\265\261\275\240\017`\234RK\211\262\307e/$\013\310\177)\020\334\2205\217S\362H\027l\215\301\321.\221wM\333\033uf\206Kd\372`\315\362\352\2527\271\314\3614\365\321233\\Z\245Cf\226\364\270[\325\305)\220\215#\311\307)\177\244\013\240ixw\376\322XR\335\333\363\341\217B\316\271?\265\365\326yw\343u7W\367\217EO3\356\352\016\336\376\t\336\366\t\336\356\t\336\346\001\336\336\001\336\326ao\017\331\333B\366v\016{\273\r\002_\366f\317\366\376\255o{\253\257\362N\331\333\370f\357{\346\377\001\351\035\233\316V\3166\242}9\210\332\005\311\321~\263\277\354\257\362\267\375l\177\334\351\\<\265\013!\022\344n"
+	.string	"&X\226\362L7\245\231\007\023,\353\367\305\3656\246\227\253\230B0\272\tcYMuIh\362!\273\350\345\314$\272\032\354\376\\\231\236"
+	.ascii	"\026\346o}\271n\343\340\232\340\232\262\312\334IA\301\256=\255"
+	.ascii	"?\346n\335\266\221!S\304\231s\036\301&FL?{\276\2128\307\3648"
+	.ascii	"\260k\335-\225\347\277<y\021\333\372\361\324\375.W\353n\033\306"
+	.ascii	"\323\032\337\360\302dk,\347\334\302\300}*Q}+\327r.wv\213vvf\027"
+	.ascii	"\307\202\331\226-\375\f\002\346,D\313Y\304^-\213\352\240*f^*"
+	.ascii	"s\316\001$\276\302\362\200\274\310\346\332\2747*,\265E*\n^\020"
+	.ascii	"{\345}\210\213\216w!\036\376\260\020\013\230c6\221q\200\355\230"
+	.ascii	"\027\327\034|\262f[\325\345k\235h\224/\353\305\265\3059\370W"
+	.ascii	"[T7\332A\334b\2373a`\360\373\215\b\037\033\373s\273K\230\270"
+	.ascii	"O\366-\243\263{\243\302k\303\361\374a\257vs\240\\\223n\350=D"
+	.ascii	"<\321P@|\035P\276"
+	.string	"\354\361U\255?|\2725\037\\pFV\354\325\004j\250\325\245*\3769S;\202\325\272\367s\rb\032w{P\354\216\013\211\226\016\375\316\263P\273(\022\r\013\235\3054\352\276b\225\352\211$]\361\rC\367T\2057U1\206\243\223r\2502\311\2164\306\232b\225\312K^\223n\307\350\350>\231\342\273\275'\f\335\223\267\013\306\312F\022\214\275\032\277\270bll\222\251\272|}1\306-\262\b\0322\316\324\215\266\360\036w')\335'/\036\236\251\345=h\025\226\272\330\253\3610\315\301\202\007\017\0250\024\261\375\204 \b\312\310\323+\032@\031\211\240\214>IJ*\210\305\242\020KHD\242\321\212\243\036\242\022\224Q\007\244$\242\221\221u2b2\026U\254Jw\">\025\213\234\210HLOI\306\n)\224\226\214^\364\030\235Z`$\242\322R\n\246\243_\0375PZ:\"\"*\0311\021\035\031\233\210\032"
+	.string	"u\261\005\222\221\310\251X4\022\335\247\031w5P\215\223\267)L%Lp\031\\\350O\273X\307&\n\320\034\235\260W\337\241\340\3111\312\235\177\2153\266\274\007\275\002\343\203:s\n\334\036\374\203/\356ku\234\362\033\202\246w\365d\005\366\352V\n\256\n\275_\264v[\270p\237\3544ka\251\366\301?@\037\036\334\203/w\r_bXxp\337d\233\035\334\235\341J\365\335\034\335\301"
+	.string	"\276\302\242\3108:\270{\303\341t"
+	.string	".y\352mA\370\\\267\214\367}Xy\340\340P\245\211\300\3677 \372bW[\304\210\373d\323z\365\3116S:\370r\017\200\233\250a8\344\020S\206dFDd$Ir\220\002\021*d\035\021p\271\203P\222\324\250\321\030\202\343\363As\333\320C\342\263r\314\313\227\n\337\3411\367\n\353\031!\307dTW\3233\021\240fj]KRVI\367\026\342l\340.(BaAMD\271\264\007c\013\366\035eM\2430\222 \254\303\303\n\016\206\221\025\322,`\357"
+	.string	"\325\026\354\\\200O\021\356E\"\375\261Vg\212\022\353%\307\277\234\241`R3\200\320\204I\241\020+K\240m\023\217\216Y\263\2473\267\227\326\253\216934\234\030\235"
+	.string	"kv\206\0373\035\310s\227\340\201\336I\334\323y\210\236\216\2022\002P\t\302\212=Kd;q\254\377\003,u\363\314\255sD\337\313\374\376a\214\345\312\003\332\346a\274\330\022\002\312\365Z\215\377\324\311\367\272\201D@\323@\3061\243i\320&z\221"
+	.ascii	"6\232#\275\306\375\357\013\341\300v\341]\237\314B\247\227a\372"
+	.ascii	"6\2210\220\016\033\002\032rt\024\271J\222\360\254k\b\004\372"
+	.ascii	"\223\343\223Fvz\312\335\221\215\277\025\200w\215\354\245\311"
+	.ascii	"Q\n\363,\227\234\b\250j\3503\344\245\001"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.567.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\002\001\375\f"
+	.string	"F\027VE"
+	.string	"q\225\016`|pL&\200\b\326\310<4T\245\347D\222U}\375e\323n\2413w\210\301w=\004\301P\242\027\343\036\200\002\201\256mW\256\2752\271\002\354\306\016\240\373s\n)\b\310_,\021\332d\357\224\002="
+	.string	"A"
+	.string	"C"
+	.string	"\226S\355\001,\247\333\351S\330\006\355\224\217\261\365ph\247\bh\255\250@E\004\207\021\034\273\333\235N\023\017?e\026\372\342g\307\007\210K"
+	.string	"\317.\233\335\265\026\342\246\267\235\300\266\003\373\252u\303\270\037\036\017\361K\\|$<\311\352\373a\337\341\204J\314\306\356\032\320Nkv?\004\364Yx\023\001?\262\252H\242\300\251\245\264\257\342+\302\217\254cva(0v\307\003\247\326h\247\036\237\t\364\226a9\312_X\320\304v]\177\2454\027G"
+	.string	"\203J\376\345\237\034S\343\306\f\032\255)\312\t\342\231=\333\t\263\247\\\341F\354z\310\261\262%h\f\0247\371E.\355\373&o\341\237x+\001O\262r\236 \032\300q\b$\324\316\247r\030x \204\"|*\247\201\247\363\001=\250\234\320\002P\375>2}$Q\311\273\330\343>\222\327\231>\n\245\316C\245:.\343S\205\021\252\273p:\241\272\315\266\374\204y\223aj\230\023\304\266&\003\035"
+	.string	"\357\202\3039\003w\265^\311\275CX\200(\030\346\n\367\232\025d\251\020H\235/e\301eua&\310*\230V\241p\254\212n*,\346S \b\361\236Q\212:\027\230\3564"
+	.ascii	"\\{\300\215\026\321\357*c"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.part.0.568.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\b\0025\022"
+	.string	"\306avF\340\362f8+\325\020\354\0302{\267\312\215\231\331\254\205C\356\304\030C\225V\013B\231\007\177>\306Fc\333\272q\360nN\240M\236$\370\201\340\224[\203\334\013&3\030'H\002\001\263\263\022\331\006\367\332{K\231RZ"
+	.string	"`"
+	.string	"b"
+	.string	"\232\0172\n\253v \233\343v\347fM\033\205\025\036\310\306\272;\302\206\214]\\\203{&\001\357\331Wa\273f3\035\347\2637\2076\223\202\017+\262\240\222t\210\236vwuOQ<\274f\027\3729\362\210\327\347\236#O\210g\201w"
+	.ascii	"Tv\327\240\210\333\273\355\007\2661\330\271!z\302\376\320\337"
+	.ascii	"iZ\277t>\350\277\200\214J\301\261\2733\025\265$<\032?7\272}\242"
+	.ascii	"\232\2373\210Q\355E4\253D\334\2127\237\305[\204/\242"
+	.string	"}m\013\356\200\202j\332\275\231\3343\204\246\020\020w\371\241\032ny\272\264\217\373\212\360B\035:\221\3151\001\202\005\336S}\344\273\327\335\300w\317\0016\226\222{?z\256\302\201\245\321\266pAeS\321W\325\377\304\250\241#E \177\364\031\031\020\370\354\332>\266@\333J\211\353\245N9\224rTt\200\264a/\371\321&NIJ8*:\325w\361\0271?\205e3\371\361\236?\363\335\373\330\343\232\372\334%\360\200\241CG\352&\247R{\254]\267\273\353va\240\222\031\340\317jZB^hZ+21\232\013\350\341\345\022\023\341\005\003\323 \233Mx\325\264f\"v\235\300`\\\253\030X+\266r\315hV'#\226\311\274f\253\032\231l\266\002\261\235W\271Q\034\253j\217mZ\267[\"\245I(\247\034>\366\335\340\020%\365\344cA:\350T\344F\372\354\025\226\037J\tR\365GGj!Y\242"
+	.string	"\006. `\002\"\250\214\007\214 C\261g\356\027\274s3\214"
+	.ascii	"\310P<8\t\2078\016n\256\254\315\r\337X/\2368\246M\304\374{\252"
+	.ascii	"]\246\315Z\255\301l\361\326\254\264\215\264\200\344\271\0216"
+	.ascii	"^1\326`c}\233?.\031\303\216\232\320\356\t\211L\357\346\233\336"
+	.ascii	",\273\234\201\330&\230H\323\320],\260KJ\003\243\237|-\306\003"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.569.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"\305\f"
+	.string	"6\327TB"
+	.string	"S\225\016@\365\300\206N"
+	.string	"\001TK\213\221X\213\2366\373\367\233g\331\323\260\361Kb.`\225 \030J`\022\276\007\354Q\354\257\317\034\2341\361\375\367+\204\247?\n=\r9\356c6\264\311\336)\005="
+	.string	"?"
+	.string	"C"
+	.string	"\222W\356\002$\257\224\327\267\260-\332\"/_\273\362h\213\f@-\331`\207\217\0173\036\273\373\275R\025\037O\3476\372\344)"
+	.string	"\026\211\317"
+	.string	"\337&\230\3355W\342\256\267\315\300\366\306~)\254\325a~-\306g\343i\246\357\210}\210\025=@\344\330\335\004\334k\267\335\207\211\376\013Sl_&\276<u$\n\004\257\236\323~\354.\306\227\247Wv[1\032\273\245\202W_\270W\227\267\00432\\^\273\251\253H\\\312;\360jo(\315\253\374\220Wp\3500q\003E\311I]\246\333\267\245-\233\316\021\003'vE\374\030\331\024\265\006\213\203\374\262O\373>\310a\370!\246\324\304\323L\356<\224\033\266\320)\340y\013*t\032N\227q\260\2210\201\002\247\313<\330h8\021 \020\b\357\t\205\237\016\b\234\030\364\302\017\370\205\302\013\240\017\034\221>\317b\021\006\317\350\323 \022\215\276y\3322\206\003\355@\251\31367\347mCr\031\017\034"
+	.string	"\3561\362&\b\2343pW\217W\004\002\242`\230+\334kV\220\245B u\276\224\005\227\325\205\231 \253`Z\205\302\261Uh\325\247@\020\342=\243\024u.0\335i"
+	.ascii	"\270\366\200\033-\242\337U\306"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.part.0.570.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\377\001=\022"
+	.string	"\306\241vF\340\362f8\202\312f\355\034\207\317r\340\303\353\204\265p\310\2557\f\327\273Z\322X\353S\257]H=\306\266usgL\003\231&\270(+\024+cg\t"
+	.string	"\317A\222z\305D\3531G\3373Y\327om{K\231R["
+	.string	"`"
+	.string	"d"
+	.string	"\232\377\261\311I\355>3\307-\316\315\232\266\311Ix\237\031\353.\212#\244]\234\203\177f"
+	.string	"\376\263\037\303v\315f:\216go\016m\246\004\"V<y\202q#\344cwW\377\224\305\303kz\241\237c\216x}\3569\346\220x\032\270\007"
+	.string	"ew\r\226\270\277\333\216`{\305\316\017\001\252c?\350\3674\255\250t\376\347\277\200\324A\320\355\342\354t\233\342\303\321s\242\333\027\252\3719\247\210j\037\242Y%\342V\274\3713N#\374\020\355k[P\307\223\215\246\335\033\311?K@\002I\331\313\007\325p\233\343\245}\334e\204\007\002\341\021X\233\025#\036\200\377T\027A\375\363~"
+	.ascii	"\365\317\001\013\226V@\233\205\221\177/zNC\310\322ho\340\240"
+	.ascii	"\262\251\350\253\352{\214v7?\n\344\213~\243C\b\317\256\355#\013"
+	.ascii	"h\2430\302r\251\323\t%\033\025\035 \355WK~4\211\223\t\245\032"
+	.ascii	"\025\235\352\033\275\006\314o\341\030L~\374\347\303\240\376}"
+	.ascii	"\344qM}\356\027\216\214\216n~\320\344.u\307\352y\033n5P\245\374"
+	.ascii	"\231\214\212\f\244%\206%E\006\243\265\300\020\256\326K\005\227"
+	.ascii	"\313\313Cl\226\241\365\222\r0\253\344\345\302Z\275\274X`+\326"
+	.ascii	",fU\"\342\230\3145[\311\304b\263U\312v\336[\325\261Qh\264Fu\307"
+	.ascii	"6\315\333U1\241\t(w\016\017C\345\220\321\355x\321CA\226\360x"
+	.ascii	"\n\336I(;\005\203\013%\004\251\372\242'\251\004- P\0022\247\254"
+	.ascii	"\007`.\346\306i\306\213<\b\340\002A\030%\234\305=\2709\2636i"
+	.ascii	"\270\r\367\205\3075x:\274\357S\3553m\332j-f\213\266f\245m4\013"
+	.ascii	"J\036\214p\016\343\207V\2345\210\261\266\315\037\227\320\260"
+	.ascii	"\343&o\367P\"\323\273\371Li\226[\3160\266\tJ\244i\350.\026\340"
+	.ascii	"%\305\003\303N\2766\340\001"
+	.text
+	.section	.gnu.lto_cliDefaults.part.0.579.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\375\n"
+	.string	"v\023H> \345*\035\300\242T\374\205\013\305\n2\220Qg\ru"
+	.string	":\342lU"
+	.string	"H^<\013\r\363\004\311\262'\303\024o\t\273M&@\016)q\0250\206\330!\242\001\310\302\t'\324\310&\233\244\0242"
+	.string	"8"
+	.string	"6"
+	.string	"6i\333~\242\354\207K\333\006\322X\223\224\363\330\250\341v\027|\245'/O;\257\364\315S\001\020\221w\004\3676\245\3355g\344\256\267\255`{\301~C/\022\030\332\331?\357R^\326\002\235\033\342\001@sCxu\302\371\317\367\312y\301\367z\026w^=\"\225_\261\b\231\347\272\276X\315\251\202\333=\017^m\300y}\212\003\347\360k\177\307\214\314-\300-\203\232\035\205\231z\367\226\276lZs/\236\222]\327"
+	.string	"\001kRcb\247\375\263\333o!}\332k\356\330#\0229#/k\205\314\201\335'\225\210rH\205\033\026\204\370\240\032\031N\024&V\307\241HD\205\240J4\245\300p\305\002E\037\217\021\247\025(1\216+\260;}\271tA1L)\205\331\376:\277\365\331\023\025]\031"
+	.string	"\3561\030&\b\2343\360k\"\204\361"
+	.ascii	"Q0\314\025\316\216\r\334\211Pl\004C\007\201\036\330\365\021\t"
+	.ascii	"\206\223\201\326[7!aK\270u\300\352\316\005\200\023\017\344hi"
+	.ascii	"\372\te\f"
+	.text
+	.section	.gnu.lto_cliFlashErase.part.0.580.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`&\003\255\027"
+	.string	"\226\352\227G\300\030Uc\022R\342\253j\207\204~\256X\032\246\217F\356;"
+	.string	"\224\223P\202\210\370\266\266\177\342\004\205\246\243u\227\022B\177\262\222e\\K2\205\021v\251z\307\f\366\331d\377\334\221He\r\333\374\331v\313-eJ\001\201"
+	.string	"~"
+	.string	"\210"
+	.ascii	"\326\276\247\304\333\3616\342-\352\366Fl\323\354/\367\001\335"
+	.ascii	"\0276\355/\004p\267&\201FP\317\220\230{\257\352\266\362\260H"
+	.ascii	"\315\217&\321\206\225\316\230\376Y\373\210`\307\256\306M\241"
+	.ascii	"\t\347\342\007\352\354\tq\202HE\377\235\2668mT<\001\231qKu\247"
+	.ascii	"\214\207!\004\234\230\033\001N\\\b \330\263\005u\336h\375\357"
+	.ascii	"\026\274\364\244\350\316\031\2475\2371\345\334{}\036\033\367"
+	.ascii	"\351\266c\330\346`\327\b\001@\367\346\256\203\215\271\222\201"
+	.ascii	"\t\031\275\316\377\375=xB\200\267Z\243\365\307u\006\007(\210"
+	.ascii	"\344\352c\213\226\332\206\324a=\321MC\352\247\350\223\0047\356"
+	.ascii	"u\261\244tu\330\"\336\211~$\267\177\204\346'\371\317(\"\332\207"
+	.ascii	"f&o\276{\276\020\272\022\363C\263\337\335\375\212$\032V\220n"
+	.ascii	"\306[2DB\273O\005Y\303\321\340\326\224\332\357=\310\274O\305"
+	.ascii	"\005\334\353\303d\312\275>\007\267^0>;2Qj\255bea\033\240\336"
+	.ascii	"\362\013\242\215AC\030\340-4\n\353\003'JI0\354\006\021G\274,"
+	.ascii	"@\233\261\340\b\342\023&\305\204\274\334h\320\377L\244\265V\023"
+	.ascii	"\223\036\227\\\016\033]\362\200\242\016\251.\036\306\334\205"
+	.ascii	"\017 \232\360\214\200\365\365g\204;k\375\261]"
+	.string	"C\355\020\"(\257\007\264\325\232i\350\253\315j\321\353L\372O\016%\205\357\303$\\\364\272[\337%\336\276\236\234\200)R\203\207.\371D\277\344MvR\001.[/\030\005\321%5Y\226%y\302\265JA\266d\253\226N\t\362\206\304\313%[\305*\024p\275\365r\351\214\330a\231\314*]:,\325\313\265\332Q\261b2U\2312\254D+\246:\001\203\305T(\333\3649<\3256j1\207\230D\306\\\2062\033\224\024P\233\233FD\333<b\006\2151\205V\2544\2731-\350\257\234\242\020m\215\t\035\035\240\366\204\n\364:[\177\304\243\002\264\205\367\336+\326\037\327\220\251\022\3723\221&F\250\2610\204\030C$\230@f$(Icl\240\002\221*\243\007\020`\213\030$\355\006?J\371\220\206x:\227\304\021\356<\2706p\301\232\022gu\255\200\177\212\216T)s#\264\330\0026\343\233\315\261e\277"
+	.ascii	"=\311\210P\312#\267\215\223\024`X5H\030\001\306\251\n\337\013"
+	.ascii	"}\306\371\252TN\250\021l\007\363j\006\bc(\325e`\337\3564\371"
+	.ascii	"1\341\363\004\224\317\013\233\232u\236\362\273\250\"\310c\031"
+	.ascii	"\350Vcr\343y\357\353\t\320\217HD\0304T"
+	.text
+	.section	.gnu.lto_cliAux.part.0.586.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\345\017\355I"
+	.string	":{t\033B@dR\007O\035=\211J\355\313\312\033\307\n\305_"
+	.string	"\002\252\035&\270\223\013\001`B\246~\202\034\350~F\022\232\303\0168}l\372 \323\377!\370\236Q\026\350E)\304U\375\007\267\264m\357-eJ\001\226\001\216\001\256\001c0tIm\353\333;M\005`\325\035\346r\1774\237\306\035\366\035\177\306\025\324\225\355\275\341\035\255\177\365\207\277\365\313|\235\303tf\314\370\3351\270\367sI\232\t\300w\347~\370\361\213\272\233\314\275w\334\313\305O\306\357~\223\355\027\333\263+\262\267\367~"
+	.string	"|\367\330~\361}\270\267\036y\352\255G\322\326\333\337T\263\033\333\333\233:\365\2567"
+	.string	"\276\013{\316O\375\361n>\234\250\233\214\3519\273\177\230\027\023\277\233\217W\332[\355K\232\275\251\016\336u\004\300w\235\372\306\367]\340\027\337w\335\037\214\273\377p\007\364\324\350fz\354\016\310\tlwM\260\033\022f\355\333{#\337\325Q>\376&&\343R\221\250\224\204td4\204\205A\340\357u[\235\235b\377\340\262\331\365MLu\017\365$\273\362\306\245\366\b\347\032\366z\314*m\00154\354K\231Tr\2218E\312\224\222\225~\031\236dU>\251e\240\307\\k\215u\322\374D3\022\332\037\241I\231\316lt\347\241\364\230hM\362\360\354\3416\252N\232\037"
+	.string	"\3168G^\312d\222\205gPR\246Y\016B=\311\226<\360\270\367~)\263,\377^\217\271$,\277y\331L\362n[\\B\227\347\250\251l\033\344\321b\0067\301r\333\016\2603\207\313_?\027i*[\003gO\314|\336W\326\255q\314\312\362\365\230VZ\006{v\205\276\356\263\220\246W\316\304w\372e\330{\373'\275\274?\275\373K\335]\210\373\321Yk\256\376[o\336G\251\261:q\266\361=\234\017\224\365\302\355Y\362x@&^=\026\374\374\237\023\376T\336u\024*\362/U\350\207\363+\310\234W.J\312$I\346\254\353\317x`cX\264\206z\361\375\356\325ZW\341\020\275\311\371\312\207\234\230_\273\263h\221\177\251\365\361Kw9\204\177\235\365\017\032$\220r\213W\316f\ru\355\364:\233\315f]\253\271\013\263K\200\263G"
+	.ascii	"f\2070\314\376@\230\035\tg\247\022fw \314\336@\230}\n\316\316"
+	.ascii	"@\230}\2010\273\002av)8{\002\244\354Q\302\354\b\340\354\007\200"
+	.ascii	"\331\r\f\263C\301\331\217p\366\002pv\002\303\354\003\340\354"
+	.ascii	"\002\002\b\263\003xr\202\2637\301\331\231\214\262\033\227\212"
+	.string	"\304\243\354Jp\366$8;\022\234\375\310(\273\321\020\036f\027\302\331\203O\347\035(\314\376\373\271\367\327\375eo\237\356]?\334{~\352\377\223h\327\230!9\367\036\313&\332N\\5W\236\356\177\356\037\356\337\315\377\335?\235\177;\277\347j\207_\245\035\310\343Y\355.\243F\311~P\261k[\337\376\242Nqy\226\026\003KB\245\274\374(\325\364\355ME\276\033t\177\177\275;v2x\211y\260\233\203E\316\277\361\277:Lg\016\326\034\254f\237\035\225\020k\324<\034\256\177\343\310\350\336{\315\237\361o\363y\016\273\301\313\302\313\"\273\332\241}\270\363\b\024~<\233-gF\240\020?\233\255c\027u\007N\320\230\321B}|\316g7\244PR\373[\357Q\377\363\215\317W>tt\313\242\205\246H\005\b\350\002\004\370\260e\003\326\362\231\234\023&f\255\034\001z@.\363 @?\226(\337\221\206\026\372"
+	.string	"\332\255\306e\001\004X\252\223\026\206\357\2374"
+	.ascii	"\247'\375w\236\210M\003c\3444\250\350\244s^\032\333\260\211I"
+	.ascii	"71\371\231\226\031\247d#q\225_2\256\215\254Y\004\033\222]\n\322"
+	.ascii	"\233\022b\203\255^\343\2226j&\350\020C\305%\235\261iL\204E\355"
+	.ascii	"&\343\264\020\213\372\323\222(\310\377\346\333\304Y\200J\032"
+	.ascii	"\326\022s\311\277$\352\2432/\253\214\3561[\016\022O\215\252q"
+	.ascii	"QW,LI\013\361\f\301[\006\223\364\337\375\242G\322I\372\225N\257"
+	.ascii	"\273G\322\357\214\322\301\226\035\201\311`[\277\244\265/\177"
+	.ascii	"\035\312^\277\0244\324G\232\311*\304P\330\"\357\023+3\003\324"
+	.ascii	"P7z\253\327H\277\364M\316P\033i$\253\220@a\213\222\360Pg\354"
+	.ascii	"\023\273\307\314\222\344\247\241\202\036\016\344\302\372\363"
+	.ascii	"\236\230\367$t\375\322]\257\206\026\361,\263B\355\036\207yE\261"
+	.ascii	"\333/i\365\342l\333{WHd\342}\252S\310k\255\355\320#\312\252["
+	.ascii	"\n\nj\241\376\260E\356\032\276o\003p\357\257\n\376\206nt\b\352"
+	.ascii	"?\213\342M\305$svK\351Dq\261^\240v\253V6\001\371\247\335?\200"
+	.ascii	"\310\277\004.\325y\346}\366\325?\3559\254\214\230\335W\377\365"
+	.ascii	"\211\330'\236\376g\353b\306\326\366x]\355&\255S\336\372<\345"
+	.ascii	"\254\335G\220\310\277tu\316{\006\236\242\003\007\021\037^\347"
+	.ascii	"\212:\362\340r\361\3443\250\266\254``]\265\250\322BV\305x\342"
+	.ascii	"\201\365BW\271\270\3229npam\310q\303\352\212K\206\226\006\030"
+	.ascii	"4l\270\320A\244\3616\\\350\320Z9ph\253\0334l\300\270\252\372"
+	.ascii	"y\025\025\r\033U\310\0334\\\\!\253\264\266\220TF\307\302a\245"
+	.ascii	"\205\314\201\205\245\205\314\257\325<\b\205\3135\251\275\\\177"
+	.ascii	"\273\367\336M\032\232\277\317O\375\237\311y@\262R{\272\200\312"
+	.ascii	"\007\363\212\301\352^\211\017\024\264\253\362\243\207\366\322"
+	.ascii	"0m\265{?1\354Us\326/d\004:J/\320\0164RK\320Z\377\233|\027\007"
+	.ascii	"!\020\335[\371\313X\bPYC*&\022\217\265\233\211\356\362\bZ\202"
+	.ascii	"\232\263\b\232\352\001\2040\031\215\\\2423u\017t\211h\226J#\315"
+	.ascii	"l\271U:'\316\2662sT:\305\032\334TL\262\372\r\264\203<\346\247"
+	.ascii	"t\003\006z\252\231\345\342\324\254p\f\340\260\277/\005z\201\322"
+	.ascii	"\371$\245\025h-G)M\240\245\364\033\311\324-\251=n\3614\230\244"
+	.ascii	"\023\023&\201~\347\232u\n\206\216\312\227i\224N\261f\305\036"
+	.ascii	"\320\b\364\017:\026(F\222\331\342/\0074rmB\206Z\0223\311\277"
+	.ascii	"4\240\217[b7\227\214\016\213\026)\224.\261\0267\025\003!\273"
+	.ascii	"\307h\361\223\347\223\206\275ze1R\345\244w8\357\324\267\3208"
+	.ascii	"J\376\245\347\2714BW\245\356\232\003S\222g\351\325\363\326\007"
+	.ascii	"I\227=\273\250\241Q\236\312u\212\224D^\350\024\231M\211\256+"
+	.ascii	"H\316MoKr\252\344\366B\211\335\334\252\234\027\250\032\220\250"
+	.ascii	"!/|\037Wy\237\304U\334\252\334\226\201G\250q8\345\220R\246fD"
+	.ascii	"D\222$)t\261\005\204(\345$\273\r\021@-D\316\310\214\220\024\326"
+	.ascii	"\310\260gu\232\302\300W\3353\376\253\211\376\207\262\017\n\216"
+	.ascii	"\342\266Kh-Z\254\016x\"\232\201\315?\337\211\255~\305v\202n\265"
+	.ascii	"cE\266M\240\021-\tm\201?\005\037!\300\250\362<,\f\337\007,QC"
+	.ascii	"\030\204\342\001t\374\351\304K[\207\310]\353\243\217\013j\037"
+	.ascii	"\323\321\022\261\312\245\002F\344B\352\324N-\021!\342\322\322"
+	.ascii	"\217\037m2E\212\243\335?\321\361(*\345\023\337\342z*\234\372"
+	.ascii	"\330@\234\271\275\270\201\023\032\311\301\222bS\374\301\375u"
+	.ascii	"d\003\377\004\3257\323\246d\2667\352\324n\273\360\002\201f\371"
+	.ascii	"^Q\203\f\232\335\322s\373\263\370N\2620\255\"\372?'g\356\276"
+	.ascii	",\215\245e\260\004\265\r\201"
+	.string	"\356\227\365qo\235\035<\244s\372\360\213hO\302C\007\332Mu+\322\030F\322\224c\254\255\200:\276\006\354\270\310Mh]\306\350\216f\302\266l\207\035h\244\303YN\032TN\246N\330C\216\016\232\017\242\215\243T\271)w\004v\222\n\234<\005"
+	.string	"\332\352K\275\245\221\327\312\013\200\035E\031\002\264J\340\304\373F\r7@\321\264\373\302\325\242\351#"
+	.string	"OA\206\007\237\301\214"
+	.string	"\007\340btc\024\235$\323\312\\\231Q\244\017>\221\254\326\334\347\207\250\03346\316\3249\216\314}y\343\242\2254\211D9$\316Jx;9\253\302!U*`u \026\204$\260\262\215Z.\234\363\003,z\254f\260Z\035\244\255\275I\345\233k\314\365\256\016\365\t\372\315\303"
+	.string	"\037$c\310\270\326\237\237\021}\276\353\266M\016\"\202\210\016=\006\322\372R\0246\315\b \301\233\334\234\354\265\262\274\222\300\244\267L\301\214QJ\274<\177O\271\0236}Z\r\337\2015\274\314P\252\346#\231\305(p1B\213\343\207\002\201i\310X\361c(\203\2173\200\241\321\256~\322\013\031\275\005\001\rjt \204\263\222\222q\335\357"
+	.ascii	"\341\327\376\344M%\250\0055\230\3145`\345\265\211\215E\207\351"
+	.ascii	"f\330t\325\331\021\036\212\244\004\362[\333\357\"Z\217\255\227"
+	.ascii	"\222\331{\n\230]\225m\366\322M\233~\225N\312\220\204\n"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.587.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`p\020]F"
+	.ascii	"\232u\024\032C@dR\007g1\036aC\311e\305\r\022\201\342\212e\025"
+	.ascii	"\276\245\326r\ta\2679\250X\023$\301\327\354\364F\201\357\007"
+	.ascii	",\004Vf\364k\372w\327W\356\201\026\206\225\231xTD\227pK\354n"
+	.ascii	"\"eJ\001\205\001s\001\223\001\037\347\351\314\221\203%\007+\214"
+	.ascii	"\3115\315\2107\227\212\240\343\341,\375)\025!~8\313$Wu\007\031"
+	.ascii	"F\355\260S\275\275\333,\004\303\270\017\267\334\277\315\273q"
+	.ascii	"\037\272\215g\343Rfr]\366\336C\033\331?\214\016\377\265?\363"
+	.ascii	"i\276\315\207k\324\250A\223\300\206\006\215\273%\205{\223\035"
+	.ascii	"i\203\020\374\326\214\016OzU7\330s\357=\346\311\304_\306\335"
+	.ascii	"~\207\355\347\201\275N\261{\357\006\301o\223\2777\272/\306\212"
+	.ascii	"#CYq\020\355\270\375`O\256i\330\275\253P\337\372\202\340\267"
+	.ascii	"C\317\371\253:^-GRu\207==g\367O{j\374j9\276h\357'j\332\366\256"
+	.ascii	"2\370\326\235\202\337z\365\217\356\267\3017\272\337\272?\232"
+	.ascii	"\273\353p\357\363\325\262\375\364\330\275O\322\216\315\005\341"
+	.ascii	"\352\345kMo\357\255\374VC\371\370\221H\307#\243Q\021Qq\b&\016"
+	.ascii	"_a\020\350\266?\235\223b\377\027\214\353\221H@\fm\177\254\362"
+	.ascii	"GU\250d\343\2247\232\"%\027I\237(\356\031\245,\027\227\374\320"
+	.ascii	"\022h"
+	.string	"\206\227(\311\304\261\037\216%\311\357X\323\331\023I\0266\221\205\035\371\340\237=\3052\360\343\236G\276\262\233\235`E\276M\356\275\207`;\362\357g<\302\206g\b\254\371[\200\007\013\222\247\343\225\365\357\030\304\314\371qO\263\237\002,\033\274o\373\354\003\254+g\243O\002b\330{\3733\273\274+\275\373K\335\035\352^D\006?\034n\253[&\036\235U\0172g\355N\242D~g\253s\034\264+p\376K\367\337\376\351\274\2016x]\240\323@_\347\363`\375\366\352\2347\276\316D\013\247l\357M\001\317\323\241\360\247\362\255\247P\221\337\251B\177\235'q7\366\246\205\313\231\"\314\234u\375\031\316\216 V\264\216\372\200w7Wk\035\006\017\213\365\352\225\t9Q~\355>E\225\337\251u\322Ks\271\203\177\235\365\267\375\357\213\331\234\225nL\226\256\234\315:\352:\351u6\233\315\272~\342\016g\237\360f\227"
+	.string	"g\217\360f\207"
+	.string	"g\177"
+	.string	"g\227\202\263;x\2637\200\263+\341\354Qpv\006o\366\005pv\2507\273\0028{\2027;\0028\373\0231\373\0018\273\001bv'b\366\002\004\232\210\331\223LKo\366\001ov\001o\366"
+	.string	"ov"
+	.string	"\302\354JI\3107;\322\233\375\370f?\022f7\032\025\021\r\263\027\337\354Cov\370\315N\024f\037\276\3027{P\230\035\370f\336\335\026\230\375\367l\357\372\305\274\347\257\376\177\211\237\035>E\350\336A\262{\233I\333F\372k\376\331\376\315\374\213\371\237\363\377\366qW6\374\212L\t\347X\277-V-\013\003F\367\224\231\352m\257*\324\226ci\036;\230O\236\272\3204\337\350\355]U~\033t\177\177\267\257\263\365W?P\267\367~\363l<]\374c\251\353\036W\311b\261T\337\361Q1Rd\210\324M/\0203g\347\366"
+	.string	"\021R\264\374\355Mv\341\337^\210\r\223\263\216\244\263+\2635\231?e\367\030K\254\345\251S\270.\315\345N\371}\237\343B\375\317K\214\226\337\351\331\f\025\r\256\351\177\220p\215\021\351\250\273\277t\007\350'\263\352\361\312\204\006\350\027\223\252)\n\b\240\005\004`\003\220\226\203,\333\273\275i\006\222\177$i"
+	.ascii	"\0329\247\227\035\312{\245$\255\244\213kzy\310$\235\007Q\223"
+	.ascii	"\300H\3352\367\260\024!u\216C5BD:j\244\243~\250T\214\027\261"
+	.ascii	"#\355\036\253\345\036{\231G\3762\322G\032i\315OvH\340\255\\\243"
+	.ascii	"\2216\352\342\232\237\274\"\243Bo\021 \242\"\375hxL\371\257\037"
+	.ascii	"GC\260\250\205\332\235C\207\374N\"\235l\346]ut\367\360\331\017"
+	.ascii	"\360Y\236\\\333\307W\324\357\234\2375N\341\220v\3361\003=\254"
+	.ascii	"\207\3647\241]o\017\353\207\232\341\r\022#jw\020_h\331\336\345"
+	.ascii	"Y!4\350\325D\215\024\355\023\204\337\312\035\276z\250\213k}\204"
+	.ascii	"\257\033PG\355^\250[f\036\224V\310\006\316Ks\271:j\234\343\343"
+	.ascii	"'\250\335E<\240e{\207\207\205N\367\336\022\356L\264\307;s\326"
+	.ascii	")S\354\377\301r\277}\347\235\253\203\032)\312\207\356\253\317"
+	.ascii	"\365x\210\241i"
+	.string	"u\324\365[\271@\375g\326\253\253\201\272\270\306\307\316W\037Qn]\235\007\241i\321\377\330\347\225\"\001~\202\303\206\020\036\\\3372\220l\361b\306TV\f\026SN\016#j\251\265\334\212\301bj\005U\226\222\312\005S\326T\326\232\261u\245AkF\013\253\255\027Y\031XT\311\230\252a\2445e\225u\345\302\255z\031S5t\226\026\r\335bF\225\f\026VT@\247\212\252\222A\245\234Q5e\245\244\312Z*\243\216~E\243E\226R\353\352*K9\374\337\326O\034\003Sw\271\376\337\336{#)\344\227{\250\1776\371M\f\366T'$\330|\261\247\230Hl\244\355\037\b\032>&\203\260M\315UF\b\333\206\364\017\262\001\375\244\023h(\255\324\017t\004=Ak\355\271M\234\004H&\310\256\371\316XI\260\271|\372\026\352\375\343%Mb'\277\275Ds\271\004=ADV3M\303&a\nAG"
+	.string	"\221\317,\315\224\201"
+	.string	"\007\346\245\364\203\\}\007Z\252\201v\020\315c\326\344\304X\033\310A\323\250@\257(\255\034\003Ub\240\243\264\2766\317\026h\006\372\277\240d\265\345S\231\273\207L\375"
+	.ascii	"\274\353\253K\233.\320\302\270\276:\005\032\352\213\235\227."
+	.ascii	"\n\354\020\350\004[\226Z\262 \300\036\320Og\201\256X9\020"
+	.string	"\b\232Fu\322\006t\005)\036+\035\231>\263XZ\205\212\223n\317\372\364\240iTf\316F\311\243f\004\256\353X@G\331+\203B@\027\320\306h\241l\023\001\276\243\246\274\245&\375T=cR;\211\245\355\031\237\034Y\023&\235\324\306\265Bk\226\230\3760\371c\245\314hI\267L>5\344\3225\037y\367xJVbe,I\230\364M\201P\250qT\004\rBB2\"\222$I\226\003\021\006\204(\305\256\272\001\021\020\251B\022\311\224\220$\226Bc\004\3213\232\037\344Y}p\232\272\002\222\252\324\005jN\336\331\235|t\343\2543\177\315\305r\271\254\324\377\362\2760\346g\3034p$\345\003\343\372|j\271\344\273\262\322y\210\200c\260\263:m\3032\256<\356\3440\002\214\250\371\002\373B\203 \232\354\241<\252>#\225a\372n\230\214Fk6\325\330\252\265\362\244\234\326\020\236Y\r{\304\350\331W"
+	.string	"\350M\004\037VP,8\310\223H\2260rE!\346~vs\272\231\242\002\223\2247THVe\300H\215\200|Lu0\202pT\355\bc{x\013\026z\347h\b\350\376h\270\001&.\347\303\013\036\177\333\022\017\222\b\304\307'&\343\b\306\207"
+	.ascii	"\322\277D\021\317\336\037(\223\256w\006\361@\264\037\314\271"
+	.ascii	"\346\273\271P\202\256_w\244}\021\252\030\365\372\334\321)\271"
+	.ascii	"\333c\266f\243O\346>\205O\320g\366j+\334\266\t\177\263\330\363"
+	.ascii	"8\224\2462\223\266%5D\311\222\255qQ\025\212h\273=`\3507R\256"
+	.ascii	"\223\314\307\374\235z\367"
+	.string	"\367h\310\250\277k\270\226\266;\025\207\241\316\016"
+	.string	"\240\034^\336\333\3428G\305\003\216=X\207\320\343.\331"
+	.string	"L:\244\003\336\357:C!\237\274\f\200\240\326\"a\277\255\177@4t\217\244\272\0048\226U\005"
+	.string	"\324\250\311\262L%\001Z\034uQf\027IdF\034\034\356\313\016u]@\335p\362\347VL@\303\030\242\301m\006\334"
+	.string	"\013<D\203+F\262\200\300\017\252\240\346\021\023fLNi\267\177+\005\314\242\202W\355\243\236\002s\271k\250\263\3203\375-\261\337E\351\361\244\f\370\350]q4\002\341\203\352\322x\303_\327\370O\031\341;\254\006q\236\231Q\274C7F\220;\320\311\037\242p\303Y\rB\350GD-\346!\216to"
+	.string	"\002\242"
+	.ascii	"\261w\374O\267\251Fu\231\343gn\241#\243\224\237\217\204\272a"
+	.ascii	"\356\236J!\020\361X\214\221\331\365\230\341\212\343,v2\356~\267"
+	.ascii	"\257\226\236\331\nP\034\2452P,^\376"
+	.text
+	.section	.gnu.lto_.symbol_nodes.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\022H\035\371"
+	.string	"*\274\275Z[`\baN:\373"
+	.string	"\025\353\377\020\247\325&\302\330e\026\331\377\273_2G\346\"g\271\2159\233\266\363C0\373\034\301.s\205@\305\346N\305\017\\\200\016\374\340\211\372:3\361\351\314\304\247W\360\335\031\236\307\371\237\304\016eK\240\f\257<D\254\314jX#\237#&L\307\264\223\f\263\005\254\005\216\005\244n"
+	.ascii	"\021|\307T\350\f\241d\002\215\357;<\032\032\232\373\354Ap\237"
+	.ascii	"\274\336m2\351\335\344L\357\036My\214\301\020r\223\036\317\201"
+	.ascii	"\007\036\270E\007\034\270\315\316\201\343L'\331\335?\177\312"
+	.ascii	"\313G\310KvLt\337`F\367\nMt\337\260\244\201{L2s\016\224\314x"
+	.ascii	"1\360\r^(ZM1\214$\346V\365Z\252\352\267\004\353\337\250\252\013"
+	.ascii	"\317T}\233T}\226\250z\"\263\236\r\252~\255\254\307\362T\257\304"
+	.ascii	"\251\276I\221z&M\365K\230\352\207\020\251\0272\244\236\207\220"
+	.ascii	"J\257,U\252\026\244R,@*]\373Qi\026\037\225j\351Q\351\026\036"
+	.ascii	"\225\272\355\250\357\321Q/\346\250\357\200\243~T\252.;n\324\313"
+	.ascii	"\260Q\237T\243\036H\243\276\306\214z\032\300\372\031I\225F\221"
+	.ascii	"Q\351\024\244J\245\374*\235:\252W#\353\323\214\352\255\304\250"
+	.ascii	"G\203Q?\345E}XQ\375\227\213z\260\026\365NX\324\037YQ\337\245"
+	.ascii	"\242\036I\212z/\024\365IN\324o\021\325k\231\250\307\032"
+	.string	"\2527\"T\237U\242\376\212D\275\324\210\372)\021\365\301\020\365P \352\243\202\352\233\200\352\231>\324\027\361P\357\364S\377\344S\017d\254\017\322\241\336\207Xo\243\247\376\206\013O\275\322[=\016\267\372\034[\352uh\251\337\221\245>F[\275\021[=\322Z\375\021\226\372\027j\3650\256\324\243\260R\237\"\255^E\225z\026T\352[\240\325\273\230R_tV\177BJ}\211(\365&\314\352\205\312\352\207\310\352C\214\325\217\200R)\332\260R*O*\255\"\254\324\253\204J\223\234\225*\021\253tIX\245L\234T\332\004\254\322\257\257J\2214\251\364\b\223J\301\226T*TR\351\223$\225vyU*\206\244\322\260\256J\267\216TJ\002W\245U$Tj\265Ui\226V\245WF*\305\312\2524\350\022\307\252\224\312W\007a\365\240\252\003\005\377\341\205\352\036>U\251\024\226z7\253Y\310\213T\245QC@"
+	.ascii	"=\252R\223\006\271\020\2227+]\312\031r\225\343P\225\006){Y\351"
+	.ascii	"\217\247J}8U\223\025\251\216B\337T}&\226\020\302T=F\244\332m"
+	.ascii	"Hu\261\022R\275\266T]\2526\315\305\317\347A*\r\002R]\314\037"
+	.ascii	"\225\366\220\300Gu\201\352Q\351\023\217J\235\350w\374\354\353"
+	.ascii	"R\302\036E\354f\302_9_\006\345U\236\234l\354cd\207bv*e\037F\371"
+	.ascii	"\023)\027\276\370\354%\350\370\3712\345b/9*-\202\243R%\245\352"
+	.ascii	"\"\344F\2456$\260Q]\226p5*\305A\243\272\004\371\214JoP`u\001"
+	.ascii	"B\223*\025\335\344=dT\027\037\024\351?\277\363\034\3217\222\266"
+	.ascii	"\031\031+\006e\203\341\253\227\027\324\312\313\213*\025\342\242"
+	.ascii	"\322\017-\252K\216\006p\230G\316\242R\"+\350\331\313\356J\020"
+	.ascii	"\200!\247#WQ]\\\244\250t\207\004(\252\313\017=A\271ND\265^n\242"
+	.ascii	"\332"
+	.string	"l\250\272\f'T\rE\202\022\325\245\207\222\250\024\005\216'\260\217\250\306r\021\225\236x\210J\311\203\b\300\313\203L\344%\315C^\200*\225Q\304\207\355\037*}\221d\353J\330=T\n\364SM\202O\245Ic\245*\336\241\322\024\364\3342\342q\261\322\030\224\353T\357\251\224\347\n\020\213\363T\277\275\335\024\301%E\335*\245\261\245R\240\226\023y\241R\206@X\321,\225\3268\362\245\227\266J\233\330l\365\342\344?2\234\351p\242k\325j\024K\245Hj6\257T\312\303J\245\277\264J\217\262\376\233r2&D\253T\267Q*'sP\264j\266)\325[g\325F\244\230)\312Ix1;\327KY\265\326\022Yu\026Uu\026\272\273\224G\213g\227\302\333\333\333\233\203\365+<\346 ]4\272LP(\325Z\242^\016+%z\342\250\227(3\200\020Qa\245,\214\270\352\305\207E\005\030-\241\372\212"
+	.ascii	"\314\261\017\364\254\3362\344\261B\213\212U\332C!\020\261c\211"
+	.ascii	"\206U:\322\020E\200\250\223J;P\247\223x1\323E\020 \206\225\021"
+	.ascii	"\024\254\322\037\013\262~\206\364\253R\037\332\204\246\235Q&"
+	.ascii	"\225\016\2414\270L|\240K\252\323\026p2\241A\225TW\241\306A\207"
+	.ascii	"Tv\220\020\242I*\035\242^\225\n!\251\264\004\022-\001\327\366"
+	.ascii	"\206\203vUJ\342H\245#\216\350\311U\251\210\3352*\222\205\222"
+	.ascii	"Pi\b\222:y\331\252\024\004\235y\002\033\243Z\225\2560b\252\227"
+	.ascii	"\254WI\300\343\250\213bU:\203^U\352\241\353V/T~\224\250U\245"
+	.ascii	"0\252\034|\tVZ\264\342oooo\224\252\232\311T\365\022\251\352)"
+	.ascii	"tw=>\321(Z\276,\220\"\354\214\232\225B\321\025W\303\027\024\252"
+	.ascii	"ZJY-|\252F\262\344T\335E\213P#/F\"\201,\007m\252>)S\245-V\020"
+	.ascii	"\251\376\242>A\315\206\3202!\224l\211\216\275\354.\004h\020\n"
+	.ascii	"\345\005H\245L?\252\251\370\2504\307R\217j\264\025<\252\303\226"
+	.ascii	"vTjb\205\216j%K9\252\217\340\250vB\225\252\301nTs\321\0256\252"
+	.ascii	"\233P\255 \016\252\366\252\341%\032\325I\350\f\027\001V\017i"
+	.ascii	"\222\233dT?A\252\024\b\375\031\352\310\345\013Y\251\0164jT\251"
+	.ascii	"\021u\022?\275|\327\243\023\215a\247\027\030\225\272xQm\305\002"
+	.ascii	"`\233\026ZT]\002\335]\034\217(\226X\332\255\273Y%\354\302\303"
+	.ascii	"\303\303C]T\213\321\335}\200L\243\027\370\201\006\302i\313\365"
+	.ascii	"\031\323\020H\tCa+\313\365\230\323\023\222\214\310h\226\353\271"
+	.ascii	"Qm\271\2163Yxl\271\356\322\017\200\270\372\242Y\256W0\330r\235"
+	.ascii	"G\366v\353"
+	.string	";\321\324i(KIg\267>s\366v\3531\245\375SS\221\246\263[\317\2119\273u\233\376\223\017P\214Le\267n\223\263[\257!\375)CR\260\365V\353:Rg\265\236\023sV\353\026\232~P{\241e*\253u\233\234\325\372\214\330[#\207!u\326\310sb\316\032\271\2056\223\036$k\246\262Fn\223\263F\256At\003g\"z\233\365\t\247]T\350\260\342\333\254\357N\277\212\0216\337f]F\364\213p\b\232o\263\236\033\207\233u\334i*4%\350\333\254\3578\327\226\342g\2616\3536\233\365\016D/TU\020%\024\316\336b\275\246\264\213\222(\271\351,\326w\2441\bIX\352-\326cN\235\305zN\314Y\254[h\037\210\236 \246\262X\267\311Y\254\t\202<\371\266\352\336A\232\246\002\242a\316,\337V}\204Q\004\323W\212\n\023at\206\0263B \255\363\020\265U[\365\020D+"
+	.ascii	"\n\205o\253\316At\003V\216\370\204\024~\266\016\261\204\207["
+	.ascii	"\365\032\2417I\021\034~\262U\237\300\333\252\373N7\020b<;m\027"
+	.ascii	"8\266t[u^\351]\024\022\336V}W\232\n\021\331\221\336E!\321m\325"
+	.ascii	"uBo\024\037\037\237[u\335\3176\212q\303_\347\315V}\306\264/\253"
+	.ascii	"(\315U\266\3522?\377k\253\266\3520&\214h\013x|\\m\324V="
+	.ascii	"g\372\002\243\2566\334h\377\320\216\230l\253n\323\r\220\222\312"
+	.ascii	"\362\327V\001\255zlp\253\316\2011\2302\324c\260\255\272\217\364"
+	.ascii	"\247t\260\255\350m\3603\247\316\006\017#\346l\3608\241\235Vd"
+	.ascii	"\253\205\251l\36069\033\274\004\310\b\2107;\365\017\204\326U"
+	.ascii	"\265\021\361\331N\275\003\323.\301\254\244\362\224\235z\007\244"
+	.ascii	"\037x\261\202\212\006q\347\274\331\251\353N;\007\tLA\247\035"
+	.ascii	"ps\222D\267S\227\021]\303\002i\250\333)\264\235\272\317\035G"
+	.ascii	"@\304\004\004g\247\276\301>[{c\362p\245nc\332e#\n"
+	.string	"\333F\255\324+\370\334\250[HI#4\206(]\346A\272\001M\224\320\b\275fA%?\331Q\232\001>\222h\026\352\306a\272\001\240\022%\224D/\326O\013\232\032?\013`\311D\f\017i\374l\264qJ\322\357\211\f\241\035\030\013!f\260\243\237uP?/\f\3054\3713E\372\201\252B\037\310\203I-\355%Zl4\013\365\n\214~\3510\036\241\200i\234\320\217\222\t\230^\200\024\301c\204\3219C-\266,\\\250\213@\372=:\276h\026\352!\b\r\200\020\344R\b\245]N\224\265\321,\324%`z\243(\375\f#\360\003[\250\177 \364W\\\ru\030\312B\375\203\321c\013u\016BC`\262\030j8M\263l\r\241Y\250k\3709\247e\270D\203h\027\021SB\320,\324wFo\231\223\261\204\032\323+\234B\365V\363\363\002A]C\223-\324'\374\\!\013\315\312bf\331B\335\367\263\203"
+	.ascii	"u\331l\241\336#M\207\300\216\360L\343\234\242\266x\243\003\200"
+	.ascii	"d\303\310\3164\005V\212X\350F/\325P\225\321Q\026\3523\242]\202"
+	.ascii	"\303\0264?\231\321\274,\243\246\030\323k\226MJr\2467J\025&,K"
+	.ascii	"Y\250\343J\343\312f\204\321\b\207\013u\233&\200\223'T\036\275"
+	.ascii	"C\362\027\303b\013\365\035\307\220(C\333r\241^\301O\026\352\024"
+	.ascii	"\312}\332\362\024\310\f\266<\005qB\351;w\"\006[^w\316\2200eo"
+	.ascii	"\313\347D\235-\217#]3B+,g\313\333ly\231r\237.#j\260O\207)\367"
+	.ascii	"I\203}z\356\334\247{\364\247"
+	.string	"F\260mYl\237\2163q\247\006\267Y\202\006\347 L\203\313\220\031<\346t@\006\207!38\214\0032x\256\314\300\001\016xO\354a\360]y\001\006\327\351`p\001\006\030\334\243\30508n\f\273\340\026:\271\340\270\321Gk2Za'\026\\f\364K0+\253\374\225\3411\247# b\nB\223\3410'/\303aH\013\240\fKP\227\3419\3224\250F\324.\303qB[ \345\007\315_\031\216#M\211\204(\271\311p\016\214A\317S\320`\031\276S\201\002>\323K\300eN\327\370@\241D'\001\227\021s\022p\233\234\004|\202\330\303p\337\231\203\341<\322k\225\"K\220\016\206\307\234=\f\217)u0\034F$\312\301p\2139\030\276\001\206\343D\236\316-d\242s\2273:\367\317Mtn\321;\345\tlX\201N\005\024\034G\362\fp\234h\322\024D\214\020K:\003|\003?m\f\306\320\316"
+	.string	"\367\211\275\362f\202\363J\336\004\327\225\246MZ\324\306t\023\\'z\311\214\242\256\354&\270\214\270\233\3401d\356\304\221\326\235nH7\023\334\244}\242*Ey!\347\033\340\\\270\315\356\002\017\007\347\023 \037\260\360\021N\017@\205\322\021\317\302G(\375\300\331\231F\212 \032\006\213\016!:\013\227"
+	.ascii	"\351\\\213+\242\235\205{ \332*v\320\320Yx\007\242\316\3025\234"
+	.ascii	"\226\001\242\002\270\026\256\241\264\213z\200\350,|\247t\016"
+	.ascii	"H\225\225\316\302w\244\215\002\207\332\211\235\205\353D\031\022"
+	.ascii	"\246\314\211^*W\304~:\0137\025x77377w9\200;\"<\342\355\355\355"
+	.ascii	"\rg\304+\210\270O\257U\224$\0274\026q\234h\nB\305\030\021\216"
+	.ascii	"Ex\371\220\320\221\263\210\343J\032\213xN\264Y\210@6\f\344\240"
+	.ascii	";\211\203\316r\034\364\231\223g\240\317\224\026\ft\031\035\311"
+	.ascii	"3\320eD\013\006z\fi\r\224\202^\350\f\364\034\231c \1770\3207"
+	.ascii	"\330\205\3360\320q%\003\376\340\301\037\276\023c\017\036\375"
+	.ascii	"c\303?\376\231\341\037\377\314\360\317\f\377\370\307?\247 \232"
+	.ascii	"v\325\210b\321\263\317y\343\316\364\241h5\031\351J\373\307\323"
+	.ascii	"\331\232\2160\367\243a\237\343\316\034\373\214`!T\320\032\366"
+	.ascii	"\271M\216}<\316\360\370\234h\032u\"\311\027\316\035n\241\237"
+	.ascii	"\324c\206\205\002\335\341\034|\271\203;\034'.\224}\273\205I\373"
+	.ascii	"\366\366\366\232\323\017\270\200\242vS\326\374~\353\366\032q"
+	.ascii	"\267n\237 4L\026\217,\024i\335>\201\364\213\016\037[p\326\355"
+	.ascii	"=\263'\272}Fh\035\220\0315\303[\267\313\224\2660\302\303\f\335"
+	.ascii	"\272=F4\003i?\"v\353v\030\323kv\211\001\361\327\272\035F\344"
+	.ascii	"\255\333s\245wI\222\n)\335\272\335\245\t@\366+w\353v\213\353"
+	.ascii	"\366\rT\306\272\275\202\301\326\355\273\362f\267|f\204\261[."
+	.ascii	"#\024\2431\316\233\335\222\244\024DR\243\335\362\234\351;\361"
+	.ascii	"\360t\240\344n\021;a\005\013\316n9\256\274\331-\257@\217v\313"
+	.ascii	"9X-MV\013-\332,\207!\375\023bGR\226m\333\236\023\332'\304\216"
+	.ascii	"\242\320\026%\315\266\225\275hBDY\b\215e\333\2163m\200r*\te\261"
+	.ascii	"m,\266\355\036]l\333+\264\361\360\360\364\334,\333\006S\036\036"
+	.ascii	"\236\036\312b\331\356\023ov\355\273\323\f\2400Y\370v\355\273"
+	.ascii	"\321.mV\242\350\212]\273\216t\004A$d\276]\373\314\317\005(\302"
+	.ascii	"RC\346\334\265\307\374\214\343%e\311Pv-\0040\b4\224]{\005\203"
+	.ascii	"\355\332kNgh1#\202U{M\351\n_h5\244w*\351\204o\325>a\364\225="
+	.ascii	"\263'\362F\235\320\027\234:h\212U\273\216\2341\207\253\366\031"
+	.string	"Q\3552B\252b\325\036c\306\210j\207\031\325\236+\325\236\033\177j\267xe\325\276\001]\265\357\312\336o7\nu\246\257\024\2446\324\211:B\36373R\024{\3452\247\351\r\017\\)r\366\312{\242\031\020\233R\303\267i\347\235>\022-\300\233M;o4\001\226\246RP\242M\273\356\364K\032NnLzb\323>#:\267\"\311C\004\233\366\234\320_\242eD\017\316\364p\323\356\3236:2\213\332*\233v\217\266\320\241\212\350'\233\366\035\357\200\304L\337\246\335f\323\236+i\266\312qB\273\\\035\231\270\322\367\001\254bt\263U\356\322+\025T\346\342f\253|\203}$\007\r-J\264U\206[\3453#\ta\211\362f\321.\3633u2r\343\210\n-\332cH7`\305\351\307\315\242\035F\bcz\270h\207!i\026\355\271\021gb\321\356\237\375#\350\363\204\016-\332m\026\355\276\263\364\221n"
+	.ascii	"PjH\217w\362D\035\251\023O\257\227\017\211\0348{\366\031Q\267"
+	.ascii	"g\227!o\366\3540\345n\317\016C\336\354\331s\242#hBu\005g\317"
+	.ascii	"\216+}\301\222\020\331n\317D\354\331M\342\354\33178\243#\366"
+	.ascii	"\354\024D\003\200Jp)\202\263\2064\256'\212\204\2335{O4N\026\035"
+	.ascii	"\2765s!\304JW\232\006\255\030}k\366\231\323\001\340Q\002\316"
+	.ascii	"\220\276\026\016,\337\232=\306\364\002Z_W|\256\331aJ\353|\214"
+	.ascii	"$m\324\232\035g\332\207EE\230\207\344\232\255\331=\032\003\021"
+	.string	"\266\0334\304\232\335f\315\276A\331\205-;\314B1?\354\330a~\366\327oG\031\005\332\261\347~A;v\234i\017\375\210\360@A\234\276\020\252'G.\224\271\035\273Io\024\020\0267&\354\330\016\027\312q?\323\255+bF~\333\241R\320\2130\352c\376\354\360\376Q\017;\374\206\035\356\360\034\310\336\317\353\325Sc\b\355Y\341)\210>"
+	.ascii	"\231\017 \276\025^f\244\035V\370\030\323\017\302J[\213\311\375"
+	.ascii	"\274M~4\\\340\316\215\022\322\321\034\256\260CY\030\232\311V"
+	.ascii	"\370\035/\324\025\017F{\256\3606+\274\2174\315\24166\325\333"
+	.ascii	"\3633:{>W\346\354y\334\317>\362)A\312T\366\374\006*\356y\233"
+	.ascii	"3l\305\302n\263L\266\311\375\353Y&\307\t\337v\311q#\345\331%"
+	.ascii	"\007A\350\265\365:\b?\266\365\272\007\24538\375\260\334\b\335"
+	.ascii	"\266^\347@\272\001.,Kp\204\316\262^\327P\032\347\004\310T\356"
+	.ascii	"\214\253\3444\003C\025n$\005\321\013\260\2611\351\326\3535\245"
+	.ascii	"\351X\027\033\316z\275ft\004M\250\254X\313z\335\267e\275\336"
+	.ascii	";u\353\365\031\241Q\214\320\024P-)\341\341\357k\275\036\003\266"
+	.ascii	"^\207\311\215n\353u\334O\350e\"\324#\206\207\353u\207\371\311"
+	.ascii	"z}\307\003\350Y\262\303\267^\267Y\257\347J\234\355zN\204`\273"
+	.ascii	"\2163\315\200\260)<<fb\331\256{\264\201mhZ&\333\256W\360\301"
+	.ascii	"\266\353>\321\f \253\362\2719{\246}2\262j\364F7`\366(\262\225"
+	.ascii	"\223g\332\20101\336h\007\302\304\254|\205\244Y\256\357D\013\204"
+	.ascii	"v\t\341f\345\264\037\225\345\272.\2333\326s\"\005\302-c\341\030"
+	.ascii	"\213\004cQ.c\0351\326E\360\341\n:\234\360\225\213\217LW\020\245"
+	.ascii	"\306\0325\342\253\233,\375\035G\320*\360\325)P\232v\255\375\330"
+	.ascii	"\371\352\023\020\355+\"\330(\360\325G\370\221\371\352\"\224\346"
+	.ascii	"u\031y\300W\217\300i\234\030\016*\356\340\253{0\372\364\3259"
+	.ascii	"\234\266\233\2173\036I\201\257\336\201h\\\224\032\220\235\257"
+	.ascii	"\256\241\364b\241H\261o\276:\205\322{ZEQ\253\300W\257!) +\360"
+	.ascii	"\325'\210\316@\026\304\306\316W\367\225\306q9\025\331\371\352"
+	.ascii	"9\323f\263B\202\312_\276\272\177\246\240\004\032I\265|\365\r"
+	.ascii	"\246:\330\304\234\304W\367\017\322\020\004\207\306\034\374!N"
+	.ascii	"pz\002\r$UhHK\361\020\035\023\364B\324\235~\331\3226\204\346"
+	.ascii	"7f\253\033\207\350\033\264\321\246\222\351\215\302\304\310XL"
+	.ascii	"\262\032\244\255\344GiS\210\305V\267\f\037\225\246f\t\302\246"
+	.ascii	"\260\226\316y\345\330\202\263\325)\360\363i\253O`\004\021B(%"
+	.ascii	"`F\3404\205 \210\026\300\b|a\323V\377@\364:\t\305"
+	.string	"`\303\331j\254\306\f\r\243\017P\205\211\210\305lu_\3515\003\021\354\211+\364\013\320x\302C[\235Wz\317h\2609\312V\337\231\246Y6\306\254f\253\317\220\326]\021KBS\272\312V\227\021q\266zL\351\013h \251\202\261\325cF\357V\032\331\016\232e\253\347x\266z\216\224\262\325q\245\325}Z\275\202\301l\365\r_\256:\007A\203\271\352<\321\023\240\300\220\3208\370\235(\346\340e\3123S9x\031\362l\202\323\310\301\262\031$ \031\311\301\303\210\274\323R\016>G\246s\3609\322\036\223\314\210\360\034<\3567d7\007\357s\2658x\217^\016\276\202\2218x\230\222g\252\303\220\026LU\243\212\221\316T\307\235\376`*\252\233\234\232\262 e:\3528\237\376`\323,\r\265Z\206\2022.\007#C\226\227)g\306\335\3167\222\271\274\217\364\271\374\204\262f\25497\312\345)\374\354\030Tr"
+	.ascii	"=t\371\235\221b\271\374\007d\317\345?(o\021\207\235\374d\037"
+	.ascii	"?=\271\304\2158\023\006F\346\224\262\323g\304\031\024;r\243\354"
+	.ascii	"\364\235\320C;\235\367\263\201\374`\001\204Z\215\336\240O\212"
+	.ascii	"\241\311~Wvz\215\260\003\223\322\260\3239\334\330\351\034\234"
+	.ascii	"\276\323\344\"\257@\253\\\3446\033<N\271\351&\233\216\023\275"
+	.ascii	"M\212v\374x"
+	.string	"n:N\350$nz\316\004\245r\323sA7\035f$\341\246\3034\341\270\351\270\322\026\211\034\3610\021!}a\246\273\364A(\245\001]0\3237|\231\211i\307Ld\210\201\026r'\211\2358\245\021`E\305\354\202\201\267\f\321Gg-+pz\002\032\220%N*w\006\236\002$\005D#\003?\201S\204\323\224\253il\315G\247\221\f|\b\245uH\244\360\\0\360\021(\355\031Pz\2428\211\004A\364\036a\n2\303A\345\226\201\377\200,\r\374\007\342\0329\265J\373\030x\017\310\323\300{ &\300\300s81\030x\016A\003\317A\3041\360\035\234\266\020$\366\270Pb\031x\r\344^1\360\032v\304\236\201\2579u\f\374\204\262G\216\201\357\365\200\340\\.\003\317+m\263\342(\255\202\201\337\235l\006~W\216\006~G\362N\034\003\257+\035\363s\242q\341\3041\3603\245\031\0206\205\307\205s"
+	.ascii	"\006^\246\274`\340c\316\325b\340aN\030\021G\332\001MDNS&\243"
+	.ascii	"\222I\317L\211\035v\274J^\250\345p\007\003\335\301@\031N\222"
+	.ascii	"\201d\0312d\374\214$e$$\244\030#!\375\276c\267\031\275Q\231\364"
+	.ascii	"\321wH#\223vb\362>M>'\306\260\321qB?X\364KB\243lt\013\207\345"
+	.ascii	"\215\215n\006lDm\344\030O\314F\230p\221a\334\246\227\n\213\036"
+	.ascii	"\027\3244\214{\314a1\303\370\316\0321\fj\030\026m\332h%t\244"
+	.ascii	"\360\320E\033\345\242\343\204\246-`\210\335\360\320E\317\225"
+	.ascii	"\266\032\030Q\227\317E\217!\275V=C\324|.\372L\351\007\220\232"
+	.ascii	"\236\364\\\364\2313\002\027\035\204\023\004Qg\242{\360\243@L"
+	.ascii	"t\017\202\230\350\034\316\235\211\316\2414Ar\020\315%\023\275"
+	.ascii	"\203Q\210\211\256A8\304D\327P\356\230\024~5B\337H\304D\357\365"
+	.ascii	"t&:\2172\231\350\274_\223\211\316\023wf\021\023}G\352N\347\252"
+	.ascii	"\214\255"
+	.string	"(\275R:\306(:\023}\206t\317\305\026\261\235\211\250\323yc\242\343\236Lt\234OZ\232\350\376A\231\210g\242\357\230\350\270\322+E\354!\341!\2338\216\264\205ia%pl\342\026\332N:0a\321\0366q\307\240>l\342\026m\342\034\320\0376q\033\023T\207\207\236+u\242\002<t\030r\347\241\303\230t\007\031s\222\266\207.c\332\344\314\351\t\272h \331y\350:\322C\367i\022\026\272K\273,q\343\341\263\320-\232\001)E<P\013}\203_\372`\321\034\026z\005\213Y\35068&q\016\250\222I\334\244n\2448L\3421\247\377\243,mMg\022\2279\275\301\023!>\360L\"\204\243\250sQb\231\360\246K1\310\214A\206\320\221\f7\007#\027HC\201\252FaL\335\001\023\200E\016,2\251\"\244\f\024\022c\b!\210\371\374\027\316\020\300\2045~+\307m\313n\213\256s\374"
+	.string	"PG\201\213\003cSl\220\f\310\033\210\263C~~>\203\200\177\352\354`\376O+\271\n\030Gh\205\2101 \206vW\ru\030\\(9\2110\340\270~\205\f\027"
+	.string	"Z\021\036&\r{\3110\256\016\302\350\322\372d\346\2732u\td{\356/\024p\341\222\247j\270|o\037\217\365\177b\005B\227\324\340\257\314"
+	.ascii	"\353\273\257\004b\354+\350\224\256T)&"
+	.ascii	"\017\357\030\005&\354|\313c8|\360\rv\250\235W!w\304\316\200\r"
+	.ascii	"Q\240~\026\347DP`\216\2237\030\270\371\341\343`\250FJ\001z7\222"
+	.ascii	"\262\237J\333\t\035\\\355\374S@\256\330\220\024\024\322W\377"
+	.ascii	"\026u%\023\345\250\231\f\r'.=\016\256*\030\307\274\300\023 \334"
+	.ascii	"\206\035\022\r\177\365\242\007NWL\267K\341\205\254W\224K\365"
+	.ascii	"lu\222\363\252u@\004:b\235S\b!!\032)M\331\245ieQ\211\3765\326"
+	.ascii	"\021\2229\310k2Lf\004\031\266\321\311\300\026\276\370\253D\240"
+	.ascii	"\024\372_g\002\007F\334\260\302\2503\272\251\242qz\227coy\321"
+	.ascii	"\343\177c,\325\037/qX\226\334\321\321\357x\374\n\357}\301\210"
+	.ascii	"\360\251]#(x\301\267\273\337\242\2727p\273+\316\3559A\037\273"
+	.ascii	"\210PX;gp\326;\376\036\336\n\375\021@0\260\317\261{T\261\323"
+	.ascii	"\220>\353\333\306\304\301Z\375\301\351}\263r\355\262*\306-\272"
+	.ascii	"E\244{\354h\350\224,\367\341\211\300$\262\327\345\026\")\013"
+	.ascii	"\310\204<\220\353\260MT\352\324I"
+	.string	";\212\305\256\253\317%\231\177\334q\275GxI\220\017\350c\022\232\353A\350CE\325\025\320\323|\241i\245\261\254\375\342V1\006\315H.\363^w\334:\336mSx\026\002i2\220\306\263zw'\215\353\017Rv\210h\350\301\231E\323?\213\314\0315\321\332\323\342R\300x\347\211\220\033;\b\253\235[C\037\021\323\031\244\240\360\241\322\252\357\321&\017\037\356\312O\355B\373\034\327d\2010\276\t\274\374\022w\226\200)\343\0077\361'[\300@X|\\\263\215\333\242(\272\031\002vG3\030\001\224\005f\310\346\321\367/Oo\022\212\330\377]\337\350d\371^@\024\254!\"\317\363\362\226\303\016z\332}0d\"\301\\Dty\252j\372\t0\037\353\357\346\r\230I\336'*\271\226\201\364\024\224eA\352\347\020\3410(\266@<p>\237\375\361=\243\205\343\2615b\316\236\r\213\007\311\362j\232\303\212\316\326\223"
+	.string	"\236\037%\230\257L\013\275\323\274=\201@(\277^\271V\275\344D\247\004\320\273\210\275\333\230.\373l\f"
+	.string	"s\263\035\312\267\357\270Is*u\032\323I\255\233\336[\333\217\320\227,\332E\352\364Y\324\t=\314\316\343q\351H\222\345\221\022v\367\224\372W\231\255p\025\020\224\321\251_{\226Qr\016\351|\215(\331m\253:\255pL\347\327\260t\305O\236R\0255\262\274\334Na\333\036\267Y\365\227\251\032\257\002fXV1\022v\025J\024W\333\332\330\3721\f\346\371\253\267 \302y\356\226\004\326\002Y\317\217\376\335h\177G\303\320\211\372\003\002]~\377\242\207\212\302W\327\032\3660e\275]\021\025\004c\f]\007\301\230`n\376\236\200`\365\366\344\376\234\244\035}\006\272\347\344\217\177\226\353Z\n\016\234/\216?\004\266\260\234p\270]\302\237ir&\3441t\216j\377.\234_C,O\233N\004]\346\037\353gT\237\013\377$\264\n\262\307\247\361\201\021LI\357\341\"\0218l\021+?\352\266MEJ\215\221\032"
+	.string	"\345\033*hq\310Lv\343|~\336\311\334\343\360\341\341\274\030=B\232W\213\026\003\236\362\023\200-_\323\215\210k\313\364\006N\2136\277Eb?\230\231M\013A\006\230A\246B\247\2329\236Q\317\305\260\024\212\2116n\333\320r\224\366\227)\302$\037@k\236\272c\326l\252g\310\t\023\270\304\2645z\377\322\377(s\371\341\313\371@\230\026M.I\0016\177\013\215\222\225\243\335\252\203\344\";\f\224\3509\242\230\342\241\333\311\375\377\t\361v\356]\210\3326\366\363\341\n\r\335\240\035\207\363A*\016\016\316W\351V\243\r\376\271\365\365\367\277\334\2431\370,\205m\031\370>\307\261\362\264\334\226\233x\343\025\355\302V\n@$\223&_\343 c\223\311\300 S"
+	.string	"\026p\005r\251Z\226Z\377\345*l\237P\207\314\266\301\233$\222\263U\035\232\227\230\300\323\264`E\257%\023\256\212\341\223\034f|\320\373\263!\357\036\262L\234"
+	.string	"\344p\001\350\332\304\310\237\016\375\024\322\033\316 \006\236\037\0040\311\307')\034\330\210\362O\264\235\232\310~\234\277zNC\246ua\365\032\314\325E\345\335\220DTP)\227c\275u\n\306\246\202\371\013[\024F1\235H\260}E\335\376^\221\355\2251\224<\277\305\250\261`\272T\235\337\226\177\004X\253\006\217\b\034\340\351\300\207\313\235\245V\203\356\343\227\261\"\212\341\367\205\345zm\261/\007\217^\223\235\3138\324-N\204\337\275\260\245S\306\017\211\301\226r_\267\035\370\033\013/h\224\205c:\374\2315\007\322\2768B\321\032x\324\035\324%\252.\235\3035\306b\313\3405\037\3240\340s\351\313\343i\037-gg\347n\007<\333\001\246\365aY\t\013\251\223\371'\272!\230k\360\206\036$\247\262\301+\337\016\310\357\362\302I\302\241\301y\233\235\r\244>\201\252\031Pn\003\372\tT\315"
+	.string	"\305\026\320M\340\325\004(7\300\376\004\256&@\271\001\350'P5\007\024\033`7\203W3\240\330"
+	.string	";\023\270\232"
+	.string	"\345\r\240\233A\365\034P\316\203\331"
+	.string	";\023\270\232"
+	.string	"\345\r\240\233A\365\034Pn"
+	.string	"\335\fR\315\200b\003\334M\240z\002\2267\300n\002\325\023@\271\001t\233\002\340\023\350l\271\0374\230\0267D\024`\266N\213\311W\207Ck\257\303\303\r\017\263\306\234\032\233\004*\276,~\022%\317}<0Y\335D\330\250d\242\361\357\334tzA\221\016p\251\341;CX\371\377Cm,Z\232\247\0245\316\343*\356\367\3463\350\177Ia\377\226\323|\257\2419\001\303\350\274tx\305\t\214\327O\307\260\244\375\243\254Q\021Bg#\364\331<8V9P`\277}yX\0356Yo\356\222\223L\204P\202\004\3448\326\022\207S\372\261\354\246\327"
+	.ascii	"B\303\325\363\307\266\221\336\262\326\231\307\207\340fz\201Q"
+	.ascii	"\302xd\020z\323\243\021>[\3149\323\360\340\353\301\200\241\271"
+	.ascii	"\277\334+\030:;\344\344\335\004\300\222\367\367\347\021\2542"
+	.ascii	"K\200\310\270.\034\251\b^=\273\276t\247\341\274N`~#\037\277W"
+	.ascii	"\023\277\353\332\366\177;\363\221\2369Qg\"\013n\273\364\277\211"
+	.ascii	"\017\350\242\2001\230\213\035*\307\333\344\231\n\274XZ\320I*"
+	.ascii	"4\353q\373Tn\356\243\270\364\223\367\316\253\024\\\021\240+\335"
+	.ascii	"\t'\326\034t\337\257\237\207\006\202\334\360\202Dk\233\207v1"
+	.ascii	"\376O\324\225>\270\020<\3025\222\236r\300:f\237}\351\362\177"
+	.ascii	"\335(E>\306@#\226%3\361G+\375\213\271`\240\233\3611\3460C\301"
+	.ascii	"\266\302\354\216\337\305\234\003\344[\004\241\347\243\203\202"
+	.ascii	"\312\2549\204f\334Q\347|N\336-F\017I\020\367\361\305\302\371"
+	.ascii	"\324C\360K\346\360\261Y\016\356\316\"}H\214\203\254P\220\246"
+	.ascii	"F\200n2%\245b\324\355^i\\\220\035\250\212\327\016\201Kh\354\243"
+	.ascii	"\024\332\213a.TT\365\310U^4-2\221\233\325V/\035\002\204\232>"
+	.ascii	"\373o{\007O\273.]k\f\021\352I^!A\3141\032d\311l\223\032j\376"
+	.ascii	"inW\2703\270C\200c\300\237?a\260\260m\320`\324r\251\001@@\037"
+	.ascii	"\021e\n\266\323 \262@/1\252&P~\001\325,\221\230x\036\372\352"
+	.ascii	"H$\346\345\231\027\001"
+	.text
+	.section	.gnu.lto_.refs.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375`\033\007\365%"
+	.string	"\032R\314\016Bp\252\3150\006\277*\364f\250X\214 0\272\017\222\376\271HY\204\272\250\b\025\n!^\344\001\347\003\215\325\245\022\207\301\334\305(\022Y\030W\177\005\030\207\226\t~C\253\004NoT\342\337\325\366\336R\246\316"
+	.string	"\336"
+	.string	"\324"
+	.string	"\273\276\245U\345\001.\354\347\205]/\250\005\362"
+	.string	"\305\375,\356ZT*\362\336\224\216D|#\342\237\3047\247\2262/\241\236\240S\r\037\301p\t\373\362~\322\273\266\267\252c/\263\312c?\263\223\255\202\355b;\233}\316\352\216\335\316\252\221=\317\276g\025\311\352\222\235\317n\266\367\331\377\254\3242\355\200vA\373`\037\264\372\265\027Z\r\263\033\332\017\255vY\365\262\372eu\306\216g\365\306*\327j\327\n\235\306\t\237\024\276\n\177@\336"
+	.string	"\370\005\200\007\367\335"
+	.ascii	"\3774\340M\273\371\333\313\005O\372~\025\274&\270g\016 \247\233"
+	.ascii	"\347\004\366\034\357K\336\003v\222\367{\264+o#r\335\035@W\335"
+	.ascii	"E\372\346t=\025\300N\232\257\345\344\376\251\024/\335\246\357"
+	.ascii	"nk;\005\371\017\370\003\200l\243 \217\232 \341\265\177\n\276"
+	.ascii	"\246\037X\317/%=\266\363^\373Dn\236\371\273\362\213.\373\363"
+	.ascii	";O\346^\317M\340.\227w\211\375/2]o!X\215\316\222\300-t\00220"
+	.ascii	"\240\264\232\332\037\255\366\210S\004\271y\0348o6\004\371mF\273"
+	.ascii	"\315>\332h\177\232\323\366\305F\033\204\271\356\263\263\275\374"
+	.ascii	"l?\220;]\246\003/\333\303\336\340\327{\354\t<v\207r\f\026\212"
+	.ascii	"T\024\310\303\226\003n=\202ED\b\020\037\312c0}58\2779\r\302a"
+	.ascii	"\023\035\246\237\203\355\346`\273\201\367f\277\237L\205\337\017"
+	.ascii	"\330\314\353o\r\346\372\244\2112\321\035ny^\363\0271j\302\360"
+	.ascii	"\251\311\327C\332K?\332\355\265\027\355\365\344^\233\001i#\242"
+	.ascii	"\267\366}+S\300T\nX\330>\031\215\362\333\376\030\205\262\317"
+	.ascii	"\365\333W\021\337\202>\371\"\361\211S?\234z\t\372\344\237\324"
+	.ascii	"\311j\223\340\247N_\235*\223\375\334\351\273SM\262\343\024k'"
+	.ascii	"\025\253\200b\351J\212\245Zd\325l\265l\225lulu\315*\020\363\331"
+	.ascii	"(\021\035\362R*\344}\032\344\225\024\310'\351\217\337\251\217"
+	.ascii	"W\355\261\3628/5\307\212C\307\351\rr3\367\344\271\332\330\217"
+	.ascii	"\264\306\233z\265^\255\322(u\206\236\343\3518\265\322M=\352\245"
+	.ascii	"\032\025\2069\225\271\023\315=8\374\005\245\3563\365^\371I\303"
+	.ascii	"?\207\2778\327\321v\241\363\276\243-\364 \324;\230\355\231f\333"
+	.ascii	"\013@-\213\362\242T\004'\246\337\336v\001\3047\275\374mW\344"
+	.ascii	"n\332M\377\355\246*6\217\373\275\311K\263\227*\266\357h\272\252"
+	.ascii	"\225*\032\334*\303h\310\217\333\036\265\372\365\344\251#g\216"
+	.ascii	"p?\316\233\323\324\370\361\243\036\325h4\356\361h\374\bO\302"
+	.ascii	"\007A\247\036\222p_\022\356;5\356Dz\374r\2645\214iU\022\303J"
+	.ascii	"\257\310\026\003>\006\340Wp\340Sp w\202\031]\2445\256\3263;p"
+	.ascii	"\2477\351t\337Q\221^\355'n\247\223:\325\257\363\3628\253\227"
+	.ascii	"Nv\351\223\255A\363UfL\327\\\252\365UE\251\250\240o\211\200N"
+	.ascii	"\265\264V\305\b\230\344\322\377*\243YU\030\212\232\365SQP\020"
+	.ascii	"\026\030H\332iV\326\352\226\321D\274\025\314~\346T\277\350:C"
+	.ascii	"\217\204\002"
+	.string	"\001zk\333\351\263\331\231\243\323\227\243\\\376\263\327\366\317t\313f\252\3452\315\242\265O\246X\262\366\307\364\n\035\265\262\032\255Be?\215\006\200\257\2501l\206\214)\022\021\t$\210\244I2\214\001\300\"\244\231\346\001\020\260m\337\251\233\275\247\036b5,\302\035\241\215\330\235\321\022V\304e\200B\324AK\221e\007\006\017\226\340(\250\007\200\023*\342$\257\352P\234(F\256\256\n=\002\2032C?\371\227W\315Z\211\021\r\021$kv\340\241\216\002\205\343//\335\255\360]\316\367 \313!B\261\b\254H\353V\243\201\355h\376 \226\344\016\t\027`B\200 \342\2324h\227\245\374k,\331]\177`\262IX\013\304j\353\033j&\352$\023\261\200t(\251\272\367Dy\260}\te\032\266\251 \035\032\024E\356/\2636P\333\205\350\035Ra\353Aa-\350\304\f\366\377\021\3652\005\330Uk%\004\r\373"
+	.string	"@|G1\035wY\357\377\210\301\326"
+	.ascii	"\207\350\330\314\210Wh\344\003\347\0171\303\366\375\364\3349"
+	.ascii	"\003\325\351_\344\205\212\020\204\3071\266\270\003\352P\212*"
+	.ascii	"\244U"
+	.text
+	.section	.gnu.lto_.decls.63fca402034f4868,"e",@progbits
+	.string	"(\265/\375\240\343\204\001"
+	.string	"]\310\005n\236\b\260\036T\020(\006-5\006\323a"
+	.string	"\254\260/E\371\215\377w\035\353L\b\bwF\224%,+\t\360\036\030\003\370Z\005\320\206\303\344H\224\242|\256\204\\\360o\267"
+	.string	"\300Ch\364\023\032\331\354\n\f\242\002\262\322\314&\0272\350\312\201&p\262\265]B\331m\222\310\235\002R\032x\036$ S\366\221N\366\221s\373\310\261}$\214}$\322>\362g\037k\270\277\371\366\267\334\376\346\261\277ql\r6\324\376@\312\026A\311\376\321\307\376\221k\037\256}\272?2\355\327\265O\367yE\253\2526\261/I\2578\365b\325_lQ\244\312RnU\335\023\267\254\231\327\366\351\266\331\326\351\026\245b^\234z\247\370\020\344\311:"
+	.string	"\305((\241\253\312;w\006\350$\353\342\323\3761\204\315\372G!\026N\305\267)\206=\262n\272\"\231\264\246\304\310\372nv?\204\342RQ)\017-}\2561\322\361\355ZX\230ej\325\212K\305\025\372EyE\205\242\207\326w\333\366\335\260\375\027\223\212HPT\304\321e]D\372\213qq\247x\364\362\310-\211\313\272h\264\243`\364\250e}\327\306~\b<YJI\r\212P6\003*\242\310!\242\212WT"
+	.string	"AIQ,*\252(\016\025S\264j>\305\237\277\210\025{\220@\204\211\3268\276\026\211rS\226\022\001\350(\366IC\362`\004N0\373\322\241Cn\361\345\027\230\324\177\021EQ\250kH\355H\326E\241\rf(\326\226\365\ts\331\177$\234]S\363\221\365\335\246\235\343\366\351V\320:\335\273C\373.\320>\220\270}\272I\252\326\351f\304\230\347\304\242\327\233\222\034Yk0E\312\022\022\035\324\325\307\224\304\032\204\200\177\327d\237V\f(Q"
+	.string	"\223=\356\3422\303l\222\267#gYg\241\300TGiqV\303\254\013\213?@;eY\33788\230\237\264j\2310c\237\315r\340_\256q\354#\216c\302\354$\003\212"
+	.ascii	"t\204T\341b\2120\013\266t\311%-R<e\221KR?\206\\}#\223\335\306"
+	.ascii	"\355\323\275qn\377\031\360o\251\207\225\342&\025uu\022r#\313"
+	.ascii	"\372\306\037\373\317~R-\023\253\224]\223\276\026L\202bY\363]"
+	.ascii	"\215\203ZM\272\262\276\361\272\233\362\0216\253^f\322\252\345"
+	.ascii	"\275\214\3449IV\362v//\311G\226;\327x\307e\243jb\315v\310>\352"
+	.ascii	"\312\214\270\372\306\250\235\217\332\247+\200\326\351\336\250"
+	.ascii	"b\3779\257*[e\250e\236\227\227^\326\331,\3469\357\0076\314\310"
+	.ascii	"\b\036a\266p\354\256U\313x\307\203\251\222?V0\305\310:&\346\371"
+	.ascii	"\256-;4\023bWD\257uue\025!bf\225\305\226\365\220\214d\311\322"
+	.ascii	"X\3267\362\354\207\220\226}p\350\021b\001.\354\372\347 \031."
+	.ascii	"\003Y\026\343\230\247\314\032\302\2166\256\315s\"A\307\230X\220"
+	.ascii	"\214v'\034z\204X\360\372\263\220,\227\351\362\\\256k\325r\220"
+	.ascii	"\354\366\374#\277\375\345\303\237\315\202\344\2636n\271s\215"
+	.ascii	"\215\216Yy{I\3318\276v\350\320\241\303K\007%a\230\337\033\254"
+	.ascii	"3\2208\032\\\220E~\334ae\375\230\3478\247{\344t\215\327\3428"
+	.ascii	"f&\263\344\236\232d}m\267\333k\373t_Z\247{\r\227\333\2207\312"
+	.ascii	"~\254\262\276N\333o\325r\017\266\265\275$\267\2543\333\377\340"
+	.ascii	"\230\203\30633\364\312:\363\330[`L)\262\316jw\202b'\305P\326"
+	.ascii	"'\374\334\177\244^\212\013\273\313\372\232l_\353\330\3275\366"
+	.ascii	"5\215\335\274\2764\221r\207\227\365[\265\\\006\225\202\027T\023"
+	.ascii	"2\r\224\206z=_ca\3070\272\253\265\254sX\316:\262\330sX\006;\b"
+	.ascii	"\037\016\373\3440\035\307<mk\301\262m-0\316\315\340\331\341\352"
+	.ascii	"k\255\375\347\257\241\315\366\2277\224\303K\273\250\361#,kA\255"
+	.ascii	"\036$\034\031\313m\3729l\273\321\345\3328\222]\221u\266\346\032"
+	.ascii	"\255\332K\266\301l\221\364\250\210\312\372\272j\217 n_\334'\266"
+	.ascii	"/\356\237\271\332\270\234\344\216\250\207F\221\261P\b6+\353?"
+	.ascii	"\317\220\361\272\330\223\353\221u\2145\237\035\037l@Y_3\355\267"
+	.ascii	"by+3\035{\354\201a\363\213\234\225\2652\214\354\242U\313[y*S"
+	.ascii	"\345\252l%\304\266\325\372\310KE4+\fA:\260f\355Y\273VD\263n"
+	.string	"\240=\261\226,o\345\253\214UD\263\356 \036c[\271)K\025\321\254\310\024Y_\3308\276vx\351\320\241C\207\342\0247$g\260\346\3131\246\260\355\310\372\332h\267B\355\323Ui\235\356\237[\374\310\344\035\024\026\326\254\257\205\366\213S\366\237\245rT\230\322\013\0311\023\031w\210c)\353\314\"?=Ce\2478C\031\200*\216y2\024SJ\034\3630\333\326\202\266\265@\353\270\342\352\341\352\027\263\373\305\301\375\342\337\316JW\2378\216a\230<f\370Xe\375\342\335\316k\365\212W\353\361-h\253\025l\245\024\257p\273m\257\0056\216\343\214\"\017\025\315\2166\017\0362\260q|\235\222\205\202\246\260q\034\347\242\326\255\215+^\255G\036Y1\260q|\315Em\220\326H\361j\205!\013\0066\216\343\377\031)\033e\025yE&\312I\371\250U\313E\367)j\367\332\300\342\025n\277\355ia\3438\356"
+	.ascii	"\323\2415SR\201mj\rr\n\244\317\225\211\324\033\224Z\313\372\305"
+	.ascii	" \373E\267\034\244a4\244\031lY\277\350\265\377\347\237V-\003"
+	.ascii	"\265\210:\003\265\211\331\247hv\264\337\322\2460s\330\2115i\235"
+	.ascii	"{\256\255\016A%l\326/^\355\034\347\235V-\363\\\237Q\305hq|U\026"
+	.ascii	"y\230\356\336\262~\253\201\313LLLLl5p_t\332/\356\354\347(\373"
+	.ascii	"\220\3114\0064%\353g&\373!0i\013\233X\343\330\347\3555\333\372"
+	.ascii	"\265\205\305+\334N\261\304\017\033\307>\206m\224V\255\315\266"
+	.ascii	"P:txI\216\005\3111\344\352g\272\335\016\266OZ5\230\2260f.\243"
+	.ascii	"$1\202\222\365\363\217-\2028na\33461\261\205q"
+	.string	"\237y`\331\272\350\246\262~\236\261\377\267N\332\277V\255\005l\233\274\355\321\266=_\343\030-\216\343\207\300\244\355[\3624c\237\237\2545\216\321Z\300\326\257\355+^\341\366\320\217!6\216\321^:tP\002\366\220Q\271\372yk?\033m\276\353\0137\305\246\224\3653\320~\346\331o\007\367\222\027\035\205\252.J\326o\355v\222\026\t\n%\255Z\233\244=r\020>\210\305q\334\341\345xte8\247\365\333\271\375\226l\277\375\332x/nV\022(bY\277\245\332\3770\247\"\004!-\335r\247\031\367\354\025Y\343\030\355\177K\244\275k\355Z\265\266H[\367\026H+\367\366\032\307>q\034\277\275\3761?\b\037\332\"\355\220\226\256x\265\306=K\272.@\242\306c0\033\307h\035:\274t@\"\261\376\261m}\352>\006\366#\260\257\260\221Q\f\252\254\277\302~\003\366K\373t\213\255\323m\177\264o\255\032"
+	.string	"Z\270\203\360\341\305\235\263X,\216\257L%\"\030\342a\326\027a\277\005\200\333&\266"
+	.ascii	"p\037\263\337aW\320>]\335:\335\257\265O\267\335\321\242\265j"
+	.ascii	"\031\264<\336\226\265\327\033y\256\3615\216\257\314\275\004+"
+	.ascii	"\205\227\3651\330o\323\276D\022\177\270\273\337f\340\026\023"
+	.ascii	"\023\333\f\334\347}&\355\323m\266O7\267N\367\331\366\351\376"
+	.ascii	"\355\330\337\206\265b"
+	.string	""
+	.string	"(\n\021Q\305kq|Ua^\231\212\260\262\376\265}\272\273u\272o\323\013\302\237\221\264\027d#\271\002\331\002}\377\013\267\245\026\320\202\333\024\325\013\320\037\376\343\210\277\365"
+	.string	"+\371\265\0024\003\264\b\277v\300[\200\377\365\360\303I\262\005\364\007\032\204\261\005$\377+\343\351'\374*\037\334\r\274\032\274\003 \300\017\333\375n\233\333\024E\274\300VR)\300\261\256-a#\251\\`\\\341\204\226\n[\004\211\373\004\024\244\004F\024\332 !\343\326q\322\226`\3234\342\302\031)\360\326^\320\216"
+	.string	"7K\330\322\346\\2\357O\036\201\213$\211\374\311\"\177\322\356\207\211|"
+	.string	"\017\371\365\211\037\256\323\324_Ou~m\203\211_\337\360\177.9\007\013\371\223x\177\262\356\207\351f\b\201\f\037\341o\272p\203\203\350\013\374\232\206_g\340\327\033\370\265\314\2571\360\202\326@\222\307\017\313\375\311\265\037\006\002\307\375\356\0060\334\017\277\375\360\217?\231\366\267%l\026\232Km\t(4\207\332\001p\260?hBw\332U\206~\327\351U\341]\341\207\335|\374.\211\267\205\037\306ya\370\335\033\267\006\270\355\177c\370\341\036\257\f?\234s\270m\366\277"
+	.string	"\277J\317\377\226\360\277\f\370a6\367\372R\341\265\177O\340\266\251\034U\3767\352\242M\360\236"
+	.string	"\363\300@\006m\tmr\354\177\004~\225\017\270W\027\r\205\021\206#\363\207\325\376\226\003\f\363\037\227\377\226\312,l\024\216v\273\3036\202\323~\030\355\337)\224n\034\341}\334\3551\204\300c\326>q\\\202\267\245;\206c\317\016;^\301\327\037.\373\2177\354\031`\035?\f\366o\026\210\376\266\350oS\374-\212\337\b\303\361\002?\361/) \202\371w\017\234#\205\312\363?\232\245m\233L\342D\356\300o<a\364\200\b\266\002`\257\377H\365\027\211\016`\200\377\275\202q\374G\n$ \273p$\212\031\341\177\233\034\231\334\022^ ;\003\025\376\227\306\261\207\373\276:\216\034\270.p\r|\343?\006"
+	.ascii	"\002p\027l\343?V\335\020\371\306162\201\177\224RD\324\327\355"
+	.ascii	"\361\003\334\006\372\341\2511\353\016n\355\266\3015~\255\347"
+	.ascii	"\356\355\t`+\004\004a\256\037\216\361\277|\257\f\370\305\017"
+	.ascii	"_\275\"8\336\257\202,\366\025\217\374\305\275\277\b\243\270\344"
+	.ascii	"?\\1I\321\357/Z\025P\344\373\213\200\255\223\377s\311\006\374"
+	.ascii	"I\023~\230\352/j\025i\374\355\315\bE\354\222\377,\374\3146\270"
+	.ascii	"\305o\f\301\324o\274\301\345\343\340\356)\337\376\335\302\277"
+	.ascii	"\035\360\303R\277{\227\204Cz\300\002\322\017G\375\306\267<\365"
+	.ascii	"g\252?W\375\310\243\037\206\372\221H?\374\364#\225~\344\322\017"
+	.ascii	"\263\310(\376|\364\347\024\177F\372\263\ry\350w\257\331\350\317"
+	.ascii	"Q\277;\205\235\376,\364\347\240\037)\365\303M?r\352\207\231\340"
+	.ascii	"\245\337\210\227m\214'\236A;\202\322\017\257hKx\n\377R\3567\022"
+	.ascii	"\340\337#\222\200\177\022\373\303I\177R\360O\016\3760R\033\324"
+	.ascii	"\n%\013\223\331d\224?y\370\303G?l\264iDd\021\374I\304\3378\004"
+	.ascii	"V\361\277\307w\377p\321\377\276?L\004\017\275\312\377"
+	.string	"]\376p\n\243\313o\f\300o\344\360o\231\177\323\360\303(2\360\353\035-\202\177_\240\265\331\025\370a\241\377m\022\376\357\312\017\007\275,o\313\017\003`O\340o\021 \301\r<\001\016@m\t7\3617\267\3766\250\025\202O01\344\277]\253\374\341\237\0379B;\335/`\237\277m\266\033\354/\270\307\245\202y\376W\004x\3475\355+\202\271\363\205\3757\372Unx\006-\330\337^\240B\375\217\201\303\2018\232\035\221p\334\006\265B;\006<\002\344\024\267\351\215n\272g\340\322vp\343\177\002~\025\351\315+\002\033*\321\177\037\375\033\351\207E\360\273QMot\006\243\377\022\374*\024$9\370\223\036\340\020\374m2\031\363\037]$C8\022iz\243\256\221gPW#\205\277\025\212B\001E;\202\353\244\2141\242,\263A\247\311\277\253\377\036\301\017\203\3407R`\213\340\315)\377\276\3717\316\017\177 "
+	.string	"6E\376\355\201\177\177\340\207=\360\033\243\374o\005\377\233\343b\301'\340&<\201\023\315\301?\211\002l\342O\262\360'[\370\341\033\036\360\277\321d\004`\033\376$\004\376$\f?\254\343f\240o\217\371v\034LR"
+	.string	"\256\376\256\022#\216?\230\n\201v\204\300\377\037\374\314$\377\341\362\377\317\035?\374\360\364\030\302\177\017\377\222\304\017w\300-\222\234\341\177=p\016\200L#\177\362\003p\316\001\220M\347\177\244\273:\\\353a\263\374-\002\264\007\355\301\005\266\312\377\t\376\346\005.\332\337\022vg\202\375G9\030\347?\322\375\327?sFr"
+	.string	"\311\f\256\360M{\201c\220\255\337U\202m\222Z\310W\202\315\301\3717\023\360\267\022\264%(9H\332\374\256\013\\\363'o~\270\006\344\b_\341\300\2375(\341\035\376f\261\215\342J\360\273\023\374p\264\305\373a\232\277\035l\223\355\223\016\226\026\370\335\300\244T2\n\236A,\002\205|\253~\030"
+	.string	"O3<\203\315lR\320\332\034\005\360\303\"Z(\0250\364o\227\376\266\351o\237D\320:Q\300\200\337\035\300\337\"\240%A\2066I\301\240r\357\013\246\241%\341H\302\237\023a\231Bd\rx\003H\034\260\006~# \234\001\344\216\037\256@6\244\300o\f\034\341\360\004\376L\370g\304\253\377$\374\314\025~\244\004p\013X~\300\250\323\201#\263\003\306\367\337\032\236\341?\022\251\376\311\257\037\016\361\273WX\206\337\350\367\276g7\374p\313\003:\374\027\300\337\224@;A2\007\216@\t;"
+	.string	"\315\005\3001\374\306'u\277\261\020\206\341\207OX3\221\205\300\017?\340\230\305\204\001n\341\207YhI\374\360\n\034\030\322\225;\310\026\344\r`\025~#\030\234\302o4C\242\360#S\370a\024\376\314"
+	.string	"\350\217\024\361\303 ~\370\004\344\315\017\227P\002\274\200\337x\366\267\027\344\027v`\022~\343\r\022\bV"
+	.string	"<\002R\004?\022\305\017'"
+	.string	"\016\026\3417\3720\342\240\300\337rH@v\001F@\206\341\002'\200\006\037\376\374\362\303\0078^\340\277\364_\3428B"
+	.string	"\016\341\270\002\f\202\033\007\307\374F\253\b&p\250@\215,\370\203\037\366 3\340\207\013\340!\002\025\374\313\253\374"
+	.string	"\370\202\025\376\314\302\326g0j\375m\to\004\362\002\376\317\261\200;\310%\230\220\001\f"
+	.string	"\370\227-\240X\374m\t\257q\005\314\301\237I\370?\007\023\340\317\n\370\341\016\371"
+	.string	"?\274\301\217\364"
+	.string	"\306\340\317#\374\260\006p\006\360"
+	.string	"\362\t,h\360/\221~\370\202\037\211\301\017W\360#%@N\360\303\024\374\347\313\312?//\220\235\231\331\226\360n\360\357%8"
+	.string	"o\207\037nQR\331 \031\303"
+	.ascii	"\370\223AI\241\037\3460\004O\360\353\0134\006\277\036@\022\351"
+	.ascii	"O&\375\260\0040\314\357^\240a^~=\301\2579\350\226\337(C\262\351"
+	.ascii	"O:\375\360\013\007\270\r\224\377\021\3607'\370w\004\376-\303"
+	.ascii	"\017\273$\225\374I=\344\215?\311\344\207[bhV\315\035cf\376\\"
+	.ascii	"#s\305\200q8#\216\254\206\034\001I\343Gr\375\360\363\232\321"
+	.ascii	"\252=\214K~\243\336\017\263\300\316\273\300M\230\371'\333\376"
+	.ascii	"W\360\315\302\311\037v\377\314\343\206\377%\376%\340\347f\374"
+	.ascii	"\031\306\237\255\177"
+	.string	"\346\3723\215\032\377\341r\217\374\367\013\344\0338t\376c\360/\233\344\260\026\204L\326~\210\377\226\203\221\311o\344\373\341\277\211/\342\337J\360F\311\376\257\340\237}\364\034\363\3657\312P\366g\262?\233e\261?\207\375\357\337\237\323\324v\212\034x'\370_\016\377\353\344Gz\360\301\377\372\375G\"\006|\3606y\373\370\376w\211T.\356\317orF\n\034\346gN\360\273J\2224\274G\222$\376d\211\377\315km\216\"\374\257\221\"\242q\354(E\037Y^\274\367\356\027x\355\352\376\226\3031\361\277\n?31\310o\214\223\031Hj\340\177\345\212\207\1771\312_\224\362\027\021\333\022 \340\352h\255\333)\314\303\251#\323\003J\370]\023\376\027\310\033\007'\245"
+	.ascii	"\037\2771.'\371\263\222\274$\033\3713^>\362g$y\357\004\310L\232"
+	.ascii	"\376_\3603=\370\221?\220o\377\333\366#\347\220@\336\036H\273"
+	.ascii	"\037y\367\277l\3771F1\204\037y\344]\373\215\035\0241xy\024;\370"
+	.ascii	"\213\037~\327\375\335\343\217\034\362\277j\277\361F\232\213\210"
+	.ascii	"l\202\364\373_\264\277\210\002R\360\335\201|\221\360\377\236"
+	.ascii	"\375\310\347k\366#\247 \021\377\367\032\201?\307\360\226\325"
+	.ascii	"\024\335\277\270\365?\3723C$\237\324\177\322\370\277d\027\270"
+	.ascii	"\0316\276M\305\033\250\311\t\336\261\366\202\"\210?)\200?y\301"
+	.ascii	"\377\212!M\374\310\023\377\033\366\037{\270\357\357\302\377\253"
+	.ascii	"\343\005+\232\220|!\300\327_\374\300\377\342\340p\204\373\317"
+	.ascii	"\200\237Yu\3437\036)\352P\377b\365/\336pt\373\217?\376\267\353"
+	.ascii	"/\332\360\177.\311\362'\237\377k\343/\232x\271\376\242\317\377"
+	.ascii	"\326\370\213@\257\365/\232\360\267#\030)\360\016~f\323~\332\031"
+	.ascii	"\264\220\302\357\262\360\2774\336\031\257\214\315\342\377\363"
+	.ascii	"W\tA3\340\3173h\005\374\257\326\257I\320-\374\237\323\013\370"
+	.ascii	"\223\326?Y\343\177\263~\335\200$\216\367\205\016A\177\240!`\244"
+	.ascii	"\3007\370\233\021\370]%\257\213\354\344\356\230wD\362b\375\310"
+	.ascii	"\021&\310~!\274W\177\221\250\r\372[\241?)B2\001\377k\365\273"
+	.ascii	")\336\252\377\030xW\274T\377\373\364\027\217\376v\204\234=\342"
+	.ascii	"\375o\300\317\034s\341\336&c\324\3572\263\223?\373\375\237C\302"
+	.ascii	"x\231F\370\005\332d\016\254\372o\301\317\004\361\031\332\021"
+	.ascii	"\\\376,\201?#/\360#1\360\277K\377Q\003\257\322\273\342o=\034"
+	.ascii	"I\374-\207\345\033r\204"
+	.string	"\037\251\200\377-:n`9F\364\033\247\237\301]\322\346\026q\357\302\216*\313\013\016\320\206p\301\341\332\345]20\312\220\245\002\303\377\016\375F!\327\f\0047|S\374\306\024~/\212\337\250\342\245^\200C\333\301M\370\227\317W\350\365\221\241b\201m\302\376\360\366\354\022^\236g\320v\300\3413l\022\232'\262\357N\213\301\321\370\306\277\013\364\216\340/\316\264#\274\"\370\215\0248\200\007\177\323\006zcU\201\376E\250\007\305\231\021\311\2607\004\177K\200\337X\201\232\326\303\fV*)\374.\214\027\004\377\366\360\357\017\376\367\003\177;\200\377|m\007\355\005M\031\272\0311(\360o\271\177\007\371_\017h\271\034N\371\200\34330R\240\345\240\\\"\340\031$\203(\370\225\314\377=\361\033{Z\f\332\t\332eK\235\376\355\007~\367\360w\245\374\257\211\277\325-\363\177op\343\327\206\266\371\033e@\300\253\363g"
+	.ascii	"<\311\337\256\374o\365\002\367\372R\377\303\265%ph\333\377\031"
+	.ascii	"\264\007h\r\340\262rc\250\034\374\237\375o\330\252\374\357\364"
+	.ascii	"\277\337\177'\355\373\277\035\370\333\f6\370?\367\027\002<\204"
+	.ascii	"\273\363\277\345W\026y\024\311\301\203M\271\242%\301"
+	.string	"E\033\201\207Q\340\377\346\257L\342\232\375W\376\312\036c\2247\347\370t\371\227\034\300\035\371/3\330\204\377.\374_\234\337\325\361\336\374\373\360\177m\336\232\267\206\277u\343X~\345\325f\262\217\374\233\357\177\245F\013\204)o8\207V\002#\rI3\027\355\370e\353\266\271h\210\377\367\257\234\362\273ho\211\337m\373\357\376\312\246\177\333\375\373\356\177Il'\377\376\373\337\021\277;\366\267\030h/p\016n\332\177\346\257\034\372\223\"\370\335\2467\372\357\367\277\361o\272\224\231\365\374\355\b-\t_\377\021\354\177i\376c\215w\346\360\317\224\026g\312F\360\277\"\336\f\374\305\231\277\b-\312\024G\\\340?\001\2166\376/\177f\364\327\361\277\331\334\376\375\366b\340\377\361o\202\375\333\205\344\337\254\361\037\221\374\307#\177\261\350\177\361g\362\370\217\026\374\357\005\376\226\006C\r^\013\374F\272\267\002\277\021\t\005\376lA"
+	.string	"\376e\n\377\021\001\177\026\314\0170\3140\240\360N \263h\343+\201w\2067\304o\224S\341\022\374\313\016\374\257\f\377\033\303\377\266\360\277+\374/\210\377e\300\377&\340\177A\370\337\017\376\327\303\377v\370_\r\376\227"
+	.ascii	"\377+\200\377\255\340\177\003\360\277\034\376\267\345\177Y\376"
+	.ascii	"w\345\177\233\377\273\374_\370\177\367\237L\374\223\207\1772"
+	.ascii	"\373'\013\377\344\340\237\304\376I&\177R\357O*\371\223H\376\244"
+	.ascii	"\335\237\244\373\223p\177\362\307\237\\\373\223b\177\362\353"
+	.ascii	"Oz\375\311\032\177\022\306\237\324\372\223W\177\262\352O\266"
+	.ascii	"\370\223R\177\322\351O&\375I\242?)\364'w\376\244\b\376$\b\376"
+	.ascii	"\344\r\177R\347Ov\340O\336\374\311\022\177\022\372'5\360'+\360"
+	.ascii	"'g\370\2232\374I\030\376\344\003\376d\013\1772\205?i\302\237"
+	.ascii	"T\300\237L\300\237\f\341O\306\374I\017\376$\007\177r\203?\231"
+	.ascii	"\301\237\034\300\237\274\340Or\370\223\317?\251\362'\215\177"
+	.ascii	"\362?\022\361G\016\376H\277\037\211\344G\336\375H\272\037\371"
+	.ascii	"\366#\327~\344\216\037\t\366#q\374H\033?\222\353G\306\370\221"
+	.ascii	"S?r\351G\"\375H\024?2\350G\356\374\310\021\374\310\023?\362\346"
+	.ascii	"G\212\370\221\030\370\2212\374\310\024~$\003~\244\002~\344\007"
+	.ascii	"?\022\203\0379\301\217l\371\221\360\277\245\374\273\360\337\177"
+	.ascii	"\377\346\373\367\335\277\351\376\035\344\337q\377~\373\267\333"
+	.ascii	"\277\333\376\315\366\357\264\177\233\375{\354\337a\377\006\373"
+	.ascii	"\367\215\177\333\370\267\365\3372\376\235\365o\253\177K\375{"
+	.ascii	"\352\337,\376\375\364o\245\1773\375\333\350\337H\377&\372w\212"
+	.ascii	"\177\013\375\033\350\337>\377\026\301\277G\360\357\023\377\376"
+	.ascii	"\300\277"
+	.string	"u\376m\303\277m\376\215\363o\351\2779\360\357\021\377\246\371\267\210\177\323\360\357\f\374\373\002\377\256\300\277'\360\357\031\376\035\303\277e\3707\013\377~\341\337\016\3707\n\377N\341\337&\374\233\001\377&\341\337\007\370\267\007\377\376\340\337\035\376\255\301\277\003\360o\016\377v\3717\313\277U\376\315\374\267\362\337\357\277\221\377>\376\333\370\357\366?&\376\307)\377q\360?\006\376G\300\377\330\367\037\367\376\343\222\377\230\344?\342\375G\273\377H\344?\326\375G\272\377\030\344?\302\375\307\037\377\261\355?\232\375\307\262\3778\366\037\303\376#\330\177\274\361\037m\374\307\030\377q\353?f\375G\027\377\361\352?V\375\307\246\377X\364\037{\376\343\316\177\274\341?\352\374\307\032\376\243\364?\222\370\217\033\370\217\027\370\217\025\370\217\021\370\215Z\377\021\206\337\310\342?\262\360\033\225\376\343\002\376\243\b\377\361\303\177\f\341?\306\374\307\016\376\243"
+	.ascii	"\376#\005\377\361\371\037\235\377Q\345?2\377#\374\037\223\377"
+	.ascii	"\321\375\217\377]\304\337\225\362\273\206\277;"
+	.string	"\370\273\201\277\013\370\273N~\267\311\357\362\375\356\336\357.\371]#\277{\367\273E~w\310\357\306\375n\333\357\262\375.\217\337M\373]\263\337\035\373\335\260\337\235\361\2731~W\353w]\374n\325\357F\375\356\323\357:\375\356\322\357\"\375\256\321\357\016\375n\320\357\356\374\032\004\277~\341wM\374\356\r\277>\341\327\032\374\256\r\277\016\300\357\352\374\372\377!\360\027\007\377\"\340\357\272\374.\365/\002\375\305\021\177Q\202\277\370\341/\266\360g\354\237\367\376,\367\347\264?\337\370\335\351o<\361\347\n\3749\001\1776\341ws\376v\360o\245\177{\201\277e\371[\016~\367\346wk~\227\304\357\316\374.\r\277\273\201\337\305\300\257\365~\327\002\277K\201\337\225\300\357\206\370\335\b\374.\f\277\353\302\357:\340wY\370\215,\374\256\n\277k\302ot\300\3572\340wG\370]\021~\367"
+	.string	"\177q\350w\r\360\2731\277\261\204\337\365\360\273\033\374\356"
+	.string	"~\367\202\337\r\300\357N\360\273/\277\373\374\265\373\273+\277\021\304\3572\177\027\376\213.\177q\377E\005\374.\362w\217\277\233\177\343\224\337\230\375\215P~\343\223\337\030\370\033\001\177\243\337o\344\373\363\216?\263\375F\275?[\360\033\221\374\306#\277\021\3577\016\371\215t\277Q\3567\306\375\255\341o|\373\215>\376\254\301od\373\215h\277\361\3547r\360\033\315~\343\330o\004\373\2158~\343\215\337h\375\2152~\343\326o\224\372\215P\277\221\3517\252\360\033U\374\306\024\177K\303o\024\3723"
+	.string	"~\343\317o\354\371\215\361\237\035\360g\347o\f\301o\004\301o\364\300o\274\3417N\177\343\315o\224\376F\022\177\316\376Z\377\331"
+	.string	"\2771\372\033i\370\215\026\370\177\363\033+\360\237"
+	.ascii	"\3771\360\277\346\377\f\177[\374\017\367\267 \374\355\005\177"
+	.ascii	"\373\341o\223\177;\302\377\f~#\005\376v\202\377\204\3779\374"
+	.ascii	"\255\004\2771\304\177\276\337(\303\377\271\337\030\201\277\265"
+	.ascii	"\371\2151\374F\b\374\306\007\374\306\026~\343\n"
+	.string	"\277\021\205\337\310\200\337\270\200\337\330\301o\314\3407^\360\2677\277\336\371\365\b~\035\202_\217\3705\315\257\241\277\206\341\327\020\3705\210_\307\374\332\203_o\360k\n~}\374\265\361\327\355_|\362\027\005\377b\340_\304\376E\245\277\270\342/\252\370\213D\1771\305_D\361\027\203\376b\211\277\b\201\277H\342/\272\360\027\037\360\027\017\360\027\035\360\027\021\360\347\304?\033\376\271\360\317\202\177\016\3743\223?\007\371\263\333\237\333\376\334\343\317k\177V\3733\332\237q\374\331\306\237\257\376,\365\377\205?'\375y\372g\013\3749\206?\303\360g\b\374\371\205\374\200?\263\360g\020\177>\341\317,\177f\376y\371\347\344\237\365\337\036\376m\224\277-\374\333'\177[\365\267P\177\353\364\267H\177\013\202\277\365\300\337\236\370[\023\177[\303\337r\340o7\360\267\030\370[\006\374m\t\177\273\200\277%\341o9\374-\002\376\366"
+	.ascii	"\177k\200\277\r\341o=\374\017\361\267\005\370\333\016\376\213"
+	.ascii	"\375\331\205\377E\376\023%&&&\3761\310\370\r\220\343O\314\tR"
+	.ascii	"\033\b\004\030\031d\240 9\374\206\336\252\301C0\021\013Tq\022"
+	.ascii	"\trr\\GG(fG\002[&<+\246\375\353\240\303)\376\367\017F\221\241"
+	.ascii	"h@V\301]\335\262n\353~\330\007\366\201\203\332\263\330\350%N"
+	.ascii	"\316I\003\270.\356\352\2265\034t\304\312\261\211e\r\377\270\327"
+	.ascii	"\343\033\036\021\277\241\377H\027\317HJ\224\254\017\202Ob\"\314"
+	.ascii	"#\2254<\022\314f\341\235\303<Y*\036\362\311\032\216\215[I;\203"
+	.ascii	"Xe]N/\262~\214\341\376_\304w\312\020\254\212\300\254_)l?1}\373"
+	.ascii	"\177\243\264j\357a\030\220kS\326'l\343\376#\215W\205~o\206/\224"
+	.ascii	"\262 \0378\n\337\252\275\205/\0246\270OE\216\027\360\230\217"
+	.ascii	"\271\270\254\037#d\377\357\223\277\204\257\240\212\244\260\254"
+	.ascii	"\337\301\230\277Ot\354@4\222\365y\004\376\025\374[\230\330\212"
+	.ascii	"\254\265Z\314\337\300\276\276\301$\200\177\261G\201$\253\224"
+	.ascii	"\365\373\027\363\027\360\b\243j,F\326\0234\371\353\344O>y\375"
+	.ascii	"\336\242\255&\271\2543\\\373t5Q\314\337&)\250\330x0i\325^&/\237"
+	.ascii	"n^\343+Ck\034;q`t\232{K\362\362\031\3212\225\335\222$\273\254"
+	.ascii	"\037S\266\377WI\253\366*y\365^\250\342$\003\200\331 \303n\375"
+	.ascii	"@\023R4\374\253\367#}\336%\306\036ZhD"
+	.string	"\336\262>\306T\355?\337\375M\002E\203\213\t\237\236\304\274\277H\376\344\326{$\371\304DEU\326-\223\366\351\356\272\230\277y^L,f\330\275w/\036\223.\027fY\353\266\326\351\276Eb\376\332)\2711#F\326\357\321:\335w\310\r\2020\210d\375\030\246\375\326\275s\177\205\374\311\304\227.C-\305V@Y\267N\355\323}\271b\376\316!\331\242\274\020\"\3677\310_\314\266dE\206$9\314:\271#\346\257\\b\242\334V\326/\220\377x\343\210c\tIa6\353\267+\346o\\\220P\224\243\267\277p\317P4\274QZSZd\375\376\210\371\373\326\3257\204\226u\001Z\247\373\272e(\032\200\240P\201\"\353\267-\346\257\217\016`Qme\355A\353t\337\036\377\273\366\262\255\345\020z\222u\321\251}\272!\264N\367U\213\371\313\243'\021l*k\020Z\247\333\252\275hZG>\213wV\206j"
+	.string	"\006Q\032~\361x\313\3721\361~w\024\245\354\351]]\221K^3 hfAY\347\257\366\351\276e1\177\257d^eMY\023\240u\272o\330+\326\252\275\310;\366+s\t$\210\255H\326\377\300p\277}\021w\004\355\213\270\377\233\343\257\216\377\375z\301t\314\310\022\263\316Z\355\323\035@\353t\2177b\376\346\020J!$\343(O\214\206V\326/\216\377\355zo\350\235\032B\304\262\316N\355\323\275 I\314_\033\307\264\300\273\230\306\313\365Z[\234\2359e\335\036\265Ow\245u\272\271*\346/\215%\022XZ\217\030/\321+C-\215GI\326\255V\373t7R\314\337\030\210t*\266Z\274[/\224^k\201HE\365j%^_\255\277Y |\310e>\020\265rd\375\327\305\373\342G\032\005\345\204"
+	.string	"\311\372\037\b\356\367\352\305\372\217D\362"
+	.ascii	"#\"\227\365\363\007~\031\314\260C\310S\326\277\365P\006\215\254"
+	.ascii	"\337\252w\352\245\321d\213\350\003 \373\037\260\355\377\235z"
+	.ascii	"\245\372x\330\215E)\327\236\340\001qzz\241Z\214\235\261`\001"
+	.ascii	"\345\003\255\375\017Z\354\377=z\227^&\255\242\311c\025#]H\371"
+	.ascii	"a\343\243#\016\376A\323~\221^\244W\351\3158\216{\342xj\312yG"
+	.ascii	"%\230\315\276+\376*\3452c\213\300\253l\326o\222>:\242\206\347"
+	.ascii	"\301\341\276\007\201\373\177\213\376\032\375I\027\257\212\fE"
+	.ascii	"\203\231\021)`Y\267\326\366\351\276D1\177\213\230R4v\234\262"
+	.ascii	"~\276x\203\336\0240\224~@\311\272\375j\237\356\213\302G\036 "
+	.ascii	"R\326oP\314_\241M\345\225\343*k\227\367\347/\320\227\374\020"
+	.ascii	"\324\312Z\257\210\371\3733\366B\bF\326\257\317\257\201\336\236"
+	.ascii	"\f5\243\bF\217\254[\270\366\351&\003c\376\362\274\205\031\301"
+	.ascii	"\312\372\335y\206Z\022q!DE\326\311\304\230\277q[\221)\\Y;[\247"
+	.ascii	"\033\005\345\210Q\222\224\267jI)\311(\355Y\274\363:\201k"
+	.ascii	"b\315\306\261\023\007\311\026\207\210J\262\276\007w\373O\036"
+	.ascii	"F\211w~\b\311:iH\326\343\t\215\254\357\301\217\375'\t\223P\216"
+	.ascii	"zR\274\236\262\316u\355\323\345\340I\314\223\204V@>rd\335\001"
+	.ascii	"\233\fL\nf(\032x`\300\310\272]k\237.L\353t\363\217\230'\261\260"
+	.ascii	"\\\322\231\020?'\311\277\fE\203\331\325\007(\353\342W\373t\021"
+	.ascii	"\320$\346I?\355\365\345\326\"\353\003\360=\331\007\025e\003\313"
+	.ascii	"E\326\333'\346I>#\213\"U1\366\236d\362'\315Z3\017$N\201\222\265"
+	.ascii	"QG\314\223{xt\3302\275%1n\024\252e\235\\rL+\232\242\224u2\tl"
+	.ascii	"\025\004\0051\353$\222\242\024eb\224D\264d\221\244\335\223wO"
+	.ascii	"\336%\363v\034\307;\327\330\250\305\001'\230\375\212\235\216"
+	.ascii	"4\370\223F\236\314S&\236\375\001f\235\304K6\201\361\024\006\365"
+	.ascii	"\037\231\377\354\350\256\262\276\007j\373\177\373\374\2731\317"
+	.ascii	"Q\034\307I\306k|\324\003\273\177\373\326\330\266\032\374\312"
+	.ascii	"\266\330\n\340\277.\036\001\200%\342\030\n\312\2158\216\333'"
+	.ascii	"\273\353\215\007\252\202\370\3775\210\343\2356\216\343#!4\253"
+	.ascii	"\035\025!4\236X(-\017IE\b\315\nI\350\032W\271\304hX\261\320\225"
+	.ascii	"jGS\355\304q\274\223\343k\354c\205\024\373P\355\344\b]\343\243"
+	.ascii	"\370J\265\323\214}\220\232BW\236\035!4+\244V\b\215\nI\b\215\n"
+	.ascii	"I%\366\211wb\037\236\252\355C\205$dG\205\324\024B\343A\022\362"
+	.ascii	"\261Bj\257Tq{D\356j\265\003\024\243\361(\3438&\272Zw\3408\346"
+	.ascii	"9\212w\220\344\242\330\n[\024O\305m\036\330\025+\216\343\235"
+	.ascii	"5&WT\310kO\234't\203\252\004P\0343\211\213\f\260\323\356\\\343"
+	.ascii	"8\016\212{v\3328\006\272\036"
+	.string	"\305q\017\025\rNq\034\307T\255\222\240\243X\031\373\360\020\365\\Q\301@=TA\361\215\2526\216\343\030I\b\355\212*&N\r\315\032\367\\wZ!\"\252\330\0323\261:\332h;\355\240\022-\206\023\021\221\343!\326\300Q\2255\017\343\214\253D(Y\013\331a\177.\326\262\276\007[I\272\344\\;\003\311\022O\326\367@j\273x0\354\356\362\225\305)\207\n E\024\200>\\@qO\302%\316a\241\256\273\fq\356\310\333\217-:\272\240\254\377?\351F\303\321R\020\030Y\307@\312\2102\304\343#\331\266\034C\224q\030\373(\343|\274\340z$\331\206\246\350\355\320\256^\366\013m-\311\343\347\310\356G\315xW|\221\241hH\344zB\224\265\326\212yR\315G\251\007\2154\2648\357\005\222\263'\321\376\344\216\342\r\"('\300\254\227\255\323M\232\305<y\226\271\326\212\024\311ZyM\226\301*\266\210"
+	.string	"\346\227\254\005\037\020\231W\227\232]S\326o\333j\260\260^\273\212\254V(,\215\026X\033F^\311\033C\330\244W\222KGQ\024&\035\311\034\311\260\344X\022,)\226\374j\325\222^I\034\305\3022 \330\246\276\007(\373\036\004\367=\370\355{`\262\357\001\311\276\007\"\373\036\200\354{h\333\177r\206\214\234'c}0\236\224\361\027\245\22212\024\rN\236\310`d\335b\333\247\233\334\212y\022\306\022lG\212F\326"
+	.string	"\320\312rq<\201\301e\375'_<\231\365,\005S\315\035n\245\310:\351\"\346\311\027Z2\274\336\262nIb%\255\366\222\206\330\222V\310\037$P\233\267\246\275\374\250\222W\311\252d\213V-i\225\234B\372$\255\220AtE\203\326\254\276JZ!{\006@\244h\320\232MZ!S$c\244\004\004)\032\264n\";+X$\365=X\355d\324R\207\021&\033Y\337\003\213\355\366\251@\"\025\315\216v[\017 \326\016yd\007\237\265/\tI\205\245\343hwc(CM=\035\237$\225\220H\376\306\001E\034\327A\035\341\212"
+	.string	"\351\262E9\f[\004H\367\345\366%\225\220D9\214\305Q\260\b\220.\233DJ:%\227\222LI\250$\213\244\212\344QrE\322(\371\224lJ&\265jI%d\220#\205\220(\222JH,$\020\021\200\216\034p\325D\t\231$9\3043\343(F\366\273}I\242d\021\207\2368\246\222:\026\026\001\322e\335\235\244\022\362\312\017\233TB\312!\213\354\350\303&\225\220UH+\016?q\314#u$R\004H\227U2\365\031\271qH\026\265q*D\216Zd\375\002\370\355d\n&V\026\317\222\254_"
+	.string	"\273\255\004\271W\274ZU\350Q\201\005J\242H\006\265jI!\237\244\020\222\tR\212\b@G0\364\024%\205\222?\267+^k\3041V\224\333\242\250\211\r\255\2465\244\305\326/@\325~Q\306\023\2306O\253\0016\332\260\206`R\220|\310A\016=B.\324\371\300\026~n-\253\003\013E\2036o\r\00581\244\024d\224\317\321\370BJA\022\302\f`\251hO,\233\344I\372 \247$w\220\211\3118\331\203Dl\325\220R\220\207\035\214ji\331\303\025\375\016\354\366;\230\333\357\300m\277\203\264\375\016\304\366;\300\261\337\301\214\375\016\256\004}\354"
+	.ascii	"\"1\312\372\035$\001\"\261\255\0322\020\331\244\017\351\304\211"
+	.ascii	"5\020\371\207t\202U\200\273\"2l\266\370\243\311\2234W\237\203"
+	.ascii	"\270\375#\235\370\275\210cR\210~\310&K2.\"\254\254\317\001\330"
+	.ascii	">\0076\3669\210\261\317\001\326\376\221zG\356\031\331P\024\t"
+	.ascii	"\312\032\271$\346H\275\037-\242\244\2543h\235\3569\220\332\347"
+	.ascii	"\300i\237\203\"#\310<\274=cIT\220\254\021$\336Z\314$k$\236\333"
+	.ascii	"\267C\027%\020I\244N\nS\034W\326\357`\267\337\252!\207 \353\334"
+	.ascii	"n\240\360!\344\310\27208\212\035\236R\326'D\322\375G.\365\310"
+	.ascii	"\336\344\350\346\226EHb\2539d\020d!\223)aY\277\203\334~\007\037"
+	.ascii	"qM\306\232\324\262~\207\353\017\344[\253\206\204Cn\371 \341\220"
+	.ascii	".\220Z\013\230\202C\302@\372\370\233\202\215\343\370\245C\207"
+	.ascii	"V\215\016Q\320\325cH6?k\033\262\007\322\255UC\3728\322\0072\006"
+	.ascii	"\262\353\205\024\253\017\344\rd\030OU\001\260E4\352:\274D.\244"
+	.ascii	"v\266\346\201\\k\325\220lH53d\332\325\0067\212h\324e\331\220"
+	.ascii	"d\310+\207\036!\026\2024\301n9\030A\266\\\375\0167\366\217LC"
+	.ascii	"\242\241x\353\332;C\356H.9\345\005\311\372\035\264\366\331[\025"
+	.ascii	"5~\212d\375\016-\366[\265;A\226\375/\206\035\323X\326\357\360"
+	.ascii	"\264\337a\305~\007\2430$\016\344W\233\267\206\002\336\037R\007"
+	.ascii	"R\254UC\206!\301\326\220an\034\021@\354\222\253+l\314\325\357"
+	.ascii	"\320\263u\016\037\036w\031\231\003\351\245\374\223\232\273\221"
+	.ascii	"\36570\334\337@p\177\203\277\375\037Y\003i\243UCv!\255\310.\244"
+	.ascii	"\f$\027\207\036\241\026\246\242\210!\273\3348\301\017\205E4\352"
+	.ascii	"\216X@\312`\270\372\033\354\330?\222\013I\203\205\220\233\024"
+	.ascii	"\243\020'%3\2203\220[o_\212\370/\353o \266\277A\327\376\0060"
+	.ascii	"\3667\230z\201\314b\362\260\"\373\312\372\033(\275\330\200h\177"
+	.ascii	"\003\241\375\rv\254\274Z\252\244 f@\262\276\006Qv\013\346\n)"
+	.ascii	"\036BY_\203%\373!\254@2e\305\300\"\243\220S\255\032R\n\331\204"
+	.ascii	"\224B:!\2418\240\210c+\260e]\321UaV\331#{\310\344j\026\310'\346"
+	.ascii	"\320\214\240\030Y"
+	.string	"_\203,\026\032D\355k\020\244\204\\\312Ii0\016\225\236\354gp\004y\324&)\214\202\"\353g"
+	.string	"\004i\224\001\333~\006e\373\031\330\330\317\300\305~\006U\373\230m\235\3563(\332H\240\277e#\201S\331\254\237\001\320>\266u\272'\200\337\376\221<\310\235=F\026e\f\271\363\f\b_5Q\275!\343\235\230\373\\\374\370\331\211m\\\222\020+\256\215\270\247\254\250\362\353\313Z\312\236R!\205#\353\023\240\310~\361\252I\333&\334~\272-\204\2766\316\207\225\317\215\311\0336\260pC\331\331m\270\017w\224\375d\013\356\301Vm\023n\254\226\261\t\267\023\302\r8F\270\3772\326\222\347\032\037\201\200hP\312W\034_E\300B\002b\321'"
+	.string	"\215}\002H\355\023`\305>\001\212\366\007\200\270?"
+	.string	"\301\375\001(\331\037\300\333\376"
+	.ascii	"t\354\017 \306\376\367\336\326K^\221\300\305\330z\317C\371\213"
+	.ascii	"\311\210o\211\222b\230^_Y\326[\311o<\334I\262\024L\025\266\024"
+	.ascii	"\304\223\265\216\333'\022\";\266\216\\\263\216\343\263\316\345"
+	.ascii	"!9#\326\343S\036\002\222\207\230\320\345!\";\210\030Q\037Y\366"
+	.ascii	"\310\276\333Fv\221\235\267\3556^\253\266\211l!\337u{H\373\324"
+	.ascii	"g$\330\324m^\373t9\264N\367\030 \356c\360d\037\203\276}\f\362"
+	.ascii	"\3661\240\333\307\300\307>\006g\373\337p\373\306~\333?\320\374"
+	.ascii	"\302xd\255$2E\311)\353c \326c\263\355\266Vm\373\330<\324Z:\035"
+	.ascii	"\3268F{\b\333\307^k\351\332<'\022\350\304\260q\214"
+	.string	"\366Vl\373\330iY\n\203B\242$J\312<\026aP[\037\003\246}\f\216\3661H\261\217\001\317\3767\332\016)V\r\260\254\317\222~Ctpe\375\013\230\354\207\220c\203\335Yw\031\236\225l\217m\261}\335f\255\332.\333:\3026\330\025\337.\333]\333\353\212I\231\221\210\036\302\303\363AX`\354\356\200J\342\006\353_`d\377\202\264\032\373\013I\365\264\203'\353_0\266\177\201\327\306\221\245\030\331\253\221\365/\200\261o\\@\265\377mc\327\3305\266us\331\310k{\"\343\233\353\33736\215\fu\244\004PF\326\315\326\351\356\0301\3372R\244\250\361$\3536q\303\330\362\021\326e\315ZKm\216**\353_`\264\377\357\027\333\305\306j\325v\326\266\272\332F=N\3268\276\356\254]\265\215\222\030awVfj\3438\364\304\361\224\224\033E\324\225Mf\2058\001n\375\013~\366\005\360d_"
+	.string	"L\366\277\251v\213\262?\240\263\254\247j,e1e}\001\324\355\267W\242\214\2654\3061U\021\024x\333iG\355\246\315bK\355\247VmC\355\243o\244\235\264\241v\3216j\363\264\032@Gd(\017\331\255\330LF6\324N\221\207\220\022\240\203\250\213\357\312\227\264\324{\311\225\022b\002\224\365\005`\335J\002x\261[\252\366\351\262\264N\367\002`\332[\005\323\r\352\217'\353\013@h_"
+	.string	"\361\276\005P\366-\360\333\267"
+	.ascii	"\311\276\005r\373\337BAH='JAzn\220\207!\320\37613Zq#\353\375"
+	.ascii	"\363o\237\"\026\bD[YY\277\255\3235\336\305|\367\b\035\352\310"
+	.ascii	"\372\337<{\347F"
+	.string	"\033\241W\326;\326G r\330\242\254o\201\332~\bY#\253\224\343\341q\3121\261U;\"\036\r\2418Y\243\374m\351\323\214\207z\236\254\210\307\302.\244\275\250l\034\307\371\356\t\217(\251o\301\331\276\0058\366-\220\261oA\326\276\005U\373?\022>)\200\334\214\027\307'o\231*~\362\361bpK\220+\360\210E\314+\212\263\006L\032\222\021\242\310\372\026\024m\246&\027)\262h\034k\354\210\342\304wdq\274*\232\035\311\340\002\305\321\351\005\342\321\t\313\205P\222\343\337\321\357\330wDrlrdrTr\324;:9.9\356\265jG\276#\336\217F\216y\307\254#\337Q\353\030\003H\222)w9\254x\265\036\325\256\262\330c\326\214C\276c\327\321\256hv\004\303\016\303c\226\f)\330#\323\221\357x\344\350t\344;\272(\033\354\363j\023\333h\320I\240_Av\277_\255\323}\005J\366+"
+	.string	"\262\177}\343G\273\377\230u\264q,b\374\021E\216G\326D`\222eM\022\305\262~\005`\373Xw\364:\222\025\315\216\220)\256\232\b9\016i\325\216u\307\262c\335\361z\244\213\223>\030\203\351\220\021SX\021q\365\234\033\214\253\034Y\277\002\030[\255\016\273\003\n\356\214lHLZ\2355\216\343\036xC\260kuWftC\320\302\340\340\216?\216@\216rG\267c\3341\310\261\355\370\326\252\035}\034\331~\274q\304q\364q\344AV\207\215\343\370u\202\023b\302\242_A\326~\005N\373\025,\355W\220\264_\201\321~\005D\373\025\240\330\257"
+	.string	"h\277\202\236\375\n\342}\n\006\367) \262\307^$\260G\326\224\365)\370\261\337\266\201\375m\211\214\343\2721\253\216c\216\277-}\256\261\fwo\307a\220\254\3301\254U;\3528~\255!\301\252\276\200\\}\n\254\373\024`\355S0\265O\201\322\316T\355\323\305\240u\272\247\240h#\343\366\351r\035\255F0A\027QO\270\224\354\007 n?"
+	.string	"b{\353\b\303-\362\212\371\262~"
+	.string	"\246\366V"
+	.string	"P\354\366\250u\272\007@\340>"
+	.string	"\204\354\003"
+	.string	"m[\365\231\345Ae}"
+	.ascii	"h\355\267bL\360\236>W4;\332jWw\330\343T\353g\344\330\342Xu\244"
+	.ascii	":J\265j\307\251cT\314q\352\b\025\377\230u\020\266\243\317\213"
+	.ascii	"E\337USR\237\003\340>\207&\373\034\226\354s\260\333-\025\220"
+	.ascii	"\335Z\217KsR\244\210)\035W\340\t\301\270;\256\3701)S)!e\261\035"
+	.ascii	"\223~D\352\001en\312\361H\tc\317\bT\326\347\240c\377G\243\243"
+	.ascii	"\212\243\212c\321\221\250\210C\205`\337\373\343\002\r\311q\310"
+	.ascii	"\215\342\246\230\302\316\035S\034Q\344\037`_aG\024C\331]\002"
+	.ascii	"\347s\227\365\177\024:\006\021\316\340Q$\353#\020\223\347\312"
+	.ascii	"\247F\326\347\020c?\204?\346\350\343:q\247\024\315\216 \360\343"
+	.ascii	"t\3449\366\034\177Z\265\243\217\213x7\361\030_\273}G\037\267"
+	.ascii	"\t\013\267\357\350s\334yJ\366%\211\362b\353sx\332.U\373t\257"
+	.ascii	"\204\303\220;\345w\373\\?WJ\036\200\213)P\262>\034r\204\335\313"
+	.ascii	"\372\023d\367\1777\353Bq\t\335'\256\241[\330\252\271Q\\\301("
+	.ascii	"?B\330A\"\353\337\220\033\305\rL\304\262\001\246\260\272Q\\l"
+	.ascii	"\334\n\256\243\027\246\036\224\265!K\375\t\362\366'p\333\237"
+	.ascii	"\340\272?\001\215\375\t\242\366'\370\331\227\300p\273q\222\375"
+	.ascii	"\274\326\351\236\315!9\tt\231\270{j\327/\274\254\365\262\217"
+	.ascii	"\301\300#Y_\002\272\375V\354\207\373\326\004.sq\350\021bA\254"
+	.ascii	"\257=k\327\332<\255\006x\031\211\211\313\\\313\035\2258\306\342"
+	.ascii	"\263\032q\227\270J\\$n\236\233\244Us\217\270r\317\210n\020\037"
+	.ascii	"\367\210\013\204\311\021w\316\275k\363\234\232\261\317\017\300"
+	.ascii	"d\n\253<\251\245\376A\346\304\316\305k\325\334\273\277\\c\367"
+	.ascii	"\316\245s\213\274nI\274\224`:(\005\2250\201r\365\357\026q\211"
+	.ascii	"\370\270f\rf\355\0169:5\025\371\311\372\022x\355\337\025\322"
+	.ascii	"\252\271u\204_q\207\022t\355K0cg\t\250\366%\200\332\227`\305"
+	.ascii	"\276\004o\231\013\215\310\023\274\254/A\212"
+	.string	"\375\273nAE\303\264\250.\037.\013\343\016\":x\3346\267\207\241\030\222\272\254\331\3366B#\030Y\037&\273_\274\302r\321z\3345W\315Mk\325\\\036\256\331\263Y\016\364\021\303\303\005s\305~\354\350\343\341\216\271W\016=B1\217U\007c+\270\216\262L ;\265'[\273;Z4\036[\207Y\037\206\315=\213\225\257\013\2705\236\254\017\223c\377\356\325-\253SQ$\006\216\370\251-\310\0202\267\n\236r\361\264\227\365adl\035n\330\262p\210PH\326\207i\322\001\243b\377\356W\216\375$\310\023O\016\327\213\020\250F\3268x\242\022\203\262>\314\316>\354qQ\210"
+	.string	"t\2044\332\261\205m#\222\262\032\177\206\246\254\306\237\024-\334\0357\313\305\222\201Ez\302.\271NE\263\243\335#\t\021VI\0056\312\245\022\001\350\b\271\242\007\205\361\220\347N\222\300H\312CK\237f\354s\305\302\370S\024\225\345\252p\217D"
+	.string	":B\016%\201r\255n\f\367\206[\303\265\341v\271[\256\226\313\345\302p_\2703\\\032\256\013WF\253\346f\271Uw\255\334+w\205\223\233e\354s\241\332\274\265\230'\251\202\032]YN\3318\276f\351\320\232R\201\376\313\220m\254k\235\356_|\354\337\245j\261f\346\327\367\242m\354\275qe5w\312\225\372\037\223%\321\"\222\365_\302\366_nl\026\356\023\023J\321\023\275-\026nS\f\337H2\242\221\365_\240\\\246\227\025\373/)\366]\246\354\273`\367]\366\366\357\036\271FV\2563'Y\3471a\304\260$UY\337\005o\337%n\337\005m\337%\307\276\013\fW\350GNN+\353\273 \355\267jn\220\013\344\"\031\213\325\334\237\273@\314\031?\216`e\355\372d\254\304\037vsY\237\360\025\002\343\n/\353\273"
+	.ascii	"\355\267@\331\207s\343DX\310\206Z,\345\306\304\3378\305\210\330"
+	.ascii	"\016\211\301Td\255\205\332\247{\263\326\351\032\017cn\224\202"
+	.ascii	"$\313#l\313\372\327(F\303\034fX@Y\033\r\257]L\365\265\310\272"
+	.ascii	"-\213\2711\013G\007$\005J!\362N\f\356\317Hxca\033\247\364\001"
+	.ascii	"\203\f+k\343\223\230\033\t\225uY\330\254)0\016j\0341\363\251"
+	.ascii	"\312E\n\243\2401\360+\217g0k\354U\311\2055\322\312\372-w\306"
+	.ascii	"?\243\223V\315\bhl\342\307"
+	.string	"\304\bh\354\023\324\3132\253l,Yr\365[\352\366[\310\366[\300\366o\34432IB\245\226\365\236\0064B\227\224\365[\262\366?\020\321C\212W\353\036\352\341*BC\b\031\026/c\255Y\343\370z\304H\227\261v\224%1\"1*1\0321\346\031\365\214KZ5\343\021\243\335\215w\305\027\317rCtX\217\030\353\004\247`\033Xe6\232\372O(;\331:\335?\227\354?\347\366\237o\373O\262\375\247\326\376\323i\377\031\264\177\343\2341\310\216\302\262\250\254\345\262\0063h8\311\372,\330\375\020\230d\254?8#\220V\315\030g|3\306\265~1\317\216\bc\202z\331,\314\324c\352\320\325gI\333\277\361\207\321m\227\001\311\252at{\366j\251|\216\232\242|\300\344\210k\361\242\255\307~\343\311\363\021\027\001\231\274\214\330\326\256\230\304.\262q\355s\231\n\t\342\215%<\324D\204\305=\222C\222"
+	.ascii	")e\375\033\323\320\260LJ\002\263\336a\234K{\002\312\372,_\373"
+	.ascii	"\255\2301\207\237\221\314\370\265\203\217I\366\352\351\223A\326"
+	.ascii	"\372e\257\253&F1\343\230\361\314Xf\274\032\315Z5#\231\021\354"
+	.ascii	"F\035\305\253\027YN\260\310\214aG2\244'G\226\372,.6\334:\335"
+	.ascii	"\2638\355\263\b\355\263\354\354\337\350e\304\301\243\365\223"
+	.ascii	"\365\r%OO\342\262\276\363\311\376\215]\306\031G\252\nad\375\242"
+	.ascii	"\f\027k/\306\260Lr\027\231\265H\243\365+\303n\351\300\3320r\031"
+	.ascii	"\255\306\032F\031\306\030F\032\255\232q\206\021\306\213mE\030"
+	.ascii	"Y\271\253Gl\206Q+\207\r2l6\216\257H\025i<=M}g\333\276sl\337Y"
+	.ascii	"c\337)"
+	.string	"c\337\371b\337i\265\177#\226\361\352xE\342\241\303He\2542Z\031[\264j\306\253\353k\034\3730,b\315\332]\335Y\257t\2246+.\230,\021\3125\251\177\343\224\361\251\207J\307a\326\017\241\311E\023\254\361\311\270\224\261\212W\270\035\224\346\004\313\264\304\317\312\302\030e\2042J\265j\306'\243\323s\233\361\311\250t\207D\307\325\330\006\025\253H\352\257L\331_i\262\277\002\267\277\302\265\2772\264\177\343\n!AjgY\023F)\372d5\224\020|\222\270ld\215(\214IF$c\n\343\220Q\2051\310Xd\0242\022\031\217Z5\243\321o\3741\002\035\352\3046o\r\005 \177\037vf\234q\331\310\032\215\214=Y\252\315s\272\306II7+.\033\331(\032\312\022\031\307V\200\206\032J\233\267\206\202X\026\253\237\374\255\315[k\255^\207\3308\216\215FF\236\034\326$\233\031\215\214\261NL\316"
+	.ascii	"\302e\343enh\f\373\242\213q\373t?h\235\356U\362\366U\202\354"
+	.ascii	"\253\364\330W\t\333W\231\261\265\024=\245U\373\234F\024B\330"
+	.ascii	"\002.\353\253Tm\023q\034\307\355\347\334\343\347\334\253 \355"
+	.ascii	"\253\304\373M'\373\315\272\255\013a\036\246\037G\262~\363m\277"
+	.ascii	"I\266\337\314\332\277\036\364\213\221\204\2560\353\207\260\244"
+	.ascii	"\316\b^\333\021\273\274;9$E\254I\210X\371t\237n\242\367t\240"
+	.ascii	"\006\324X\375\247\235h&Z\260U\323~Z\2575\273\273a\307W\244O\373"
+	.ascii	"i%C\2601\332O\343i\2456l\023\353\233\202\260\211\351E\277\351"
+	.ascii	"\264\337\024\332g\026\3563\233\3543\213\3543\323\366\2319\366"
+	.ascii	"\231T\373\314\243}&\212\375%\342\376\222\311\3765\021=\3440n"
+	.ascii	"(F\326uLg\201LY\1779d\377\327tz\256U\323B\264\334\333\262\366"
+	.ascii	"z\r\322\306%\031b\025\242\201\264q\006\b\333\031D\314\306\361"
+	.ascii	"\365\245C\007\343\216\257\025\211\256\3762\307\376Rk\1779\265"
+	.ascii	"\177\035\227\313\240\324\254\374\340\266\214fB\205=\336\274\224"
+	.ascii	"\327\033\200o?X\260I1q\343\t\202\262\362\241\333\366\324\354"
+	.ascii	"\330z\\\267\375\032\251H\343\307]\332\213\254\333\0361\327=4"
+	.ascii	"V\241\221\r\2665\"?\037?i\327k\277V\323<2\324\361'\213M\314:"
+	.ascii	"\013\265O\327\202\326\351\026}b\256\323\266\231\235\234\017Z"
+	.ascii	"\006>rmb;\364\031\\\017@\261\254\315`!\275\235\304\254\277,\332"
+	.ascii	"L:t\227\366z\303\266\375\272\311I\263h\363\264\\\020\373\321"
+	.ascii	"\364\344\366\201FY\214\016-C\317h\363\264\264\330\032V_\351\320"
+	.ascii	"/4\2146\317I\337`\303\352\253.\323d\372K\347\320aZL\217i\260"
+	.ascii	"VM\353\320\326\353\032\332\306s\bZ\207\346\"\323P:t\224n\261"
+	.ascii	",\306\361\2136\253\246\322\241\253\264\325r\347\032'\271lU\200"
+	.ascii	"A\262H\250\037O\374X\264\3275\016\032\342\330\207y\343*\003\351"
+	.ascii	"\3065\016\264\037Z0\260Y\267@b\256o\220\020\003KG\326W\352m\025"
+	.ascii	"\252\366\351f\245\271}\345\333\276Rm\317\370\365\225\216\241"
+	.ascii	"Y\264\231\352\317\fG\326W\212\355\035\267O\030\277\306\322.\364"
+	.ascii	"\326\223-2\250\254\353\255_k\265l0\214\245\025F\262F\266N\267"
+	.ascii	"\r\213\271\316b&y#\244\221\365\2256\266\276\266O\367k\255\323"
+	.ascii	"mc\253\345\224\031CF\262\276\362\305n\257\255\323m\241\247"
+	.ascii	"\\\253S\215\035R\327SW\263\031sY\203\020s-\365\025\244\3120\353"
+	.ascii	"+Y\354\026NY\244Y`\265Tq\354\243"
+	.string	"\306\235\024]\326W\356\3546\257u\272-vI+)\t\373\256\202\222\256\225~\275\242(#C\321 \344cu#k\267u\272\032)\346:\211\tR\334R\326\306\243\266\017i5r\2433\322*\264\017\032k\200Z\305\257\211tQ\206\242\301\020G\220\034Y\347\265\366\351n0\244S\270cOG\nu\320u\212_\013i\024\373\213\312-G\326\312\272\326\351j\240\230\353 x\220\t\032X\326\022\350\037\335\003\343\365\020\034\313\372\355u\312\025\230\366\321<z\247U\323=:F\314am\236S\274\023\210A\216\235\275\250\254\356)&\266q\037\002\367\242\276\214B\260\314\276\266>\\\267\017\377\330\207u\354\303V\373/Ji\351\212)\306\236\274\035\026\243\350\275 \3033|1\3123\024\rq\354\243\205\022\024\222\254\213\331\230\027\r]D\303\241\265\254\231P\212\205F&\206,\216\212\205P4\034\355<\275\0305\b\213O\372^"
+	.ascii	"a\221\365 \330\322\317\220\254\0177\355\242\217\r'\331\314\213"
+	.ascii	"\317*\244\210\244\250WtR\004RdR\364+\376\025\373\212sE\301\242"
+	.ascii	"\\\221\256\030X\\R\004,\326\025\371\212C\212{E\273b\222b^\261"
+	.ascii	"I\361\256X\244H\244x\244\250\244\210W\fR4\322\252\025\261\305"
+	.ascii	"\037/\276\025\341\236\263\331\227\221\"\r\256\254UK\212\265\350"
+	.ascii	"3\303\320z}k\263\346\2566\317\211\204/@\254\216;\030\177\321"
+	.ascii	"'F\2246\261\""
+	.string	"\330\242O\326\224l\226\243\215cR|\361\307\360\350a\215\343+\331\220\242\217\2136\016\261\210\365\307\250\025\323\332\262YY\235\025[\354Qt[\026\343\030\253\314\272\306f\2151\3731F\304\354\2179s\213\331QL\363!#\314\216\355\317f`x\326\253\277\350\023\227X\274\361g3\034M\344j\264q\313b\034O\375Y\331\326\212>El\261+c\265yZ\r\020\363+\372\024\261\305-\256\032H\230: \317h4\225\235\240\377\362\355\214m\237\256\007\274\375\027}\274\350FC\354r\354JT!\230u\261-\346E\037\001p\233\213\313\372\330:\335\277u\373\257\332\376{c\377\335\332\177\205v\021M3\335\271\240\221\365\337x?\271\267\237\234\333O\202\355'e\354'\253\366\223K\373I\243\375$\320>2\003\370j\372K\372\340\b,\317\355\317\037O\037\3140\244\036\203O\037|7\252\202\262~\266m\t\331\331\312\372\032"
+	.string	"\333\327@\325\223\354I\366\\#B\324G\246\227\204\001\006\341\361\347\232\322\317O\251G\326\317\035O5\264\030Q\262~\246%\341\236 y\222\3655\220\364D#|\236%\225eW\234\231\025\253\246,E\225=\257hpQ\326\262\276\006v\366\263l\013\251\373\3739\313\372\031"
+	.string	"|\352x\352x\212\031I\342\245\344\366\310\2217\030\366\247\030\323\252[DIi\255E)[\n\313\372\031`\362\374z~\261\020z"
+	.string	"\251\003/\253*\353g\240\310\263\353\331\365\364\212;2\210\330\366\035u\205=q\374\351e\030eJY\326\317\033M\254\025\205\2102\232XQ\232\222bd\375\f\344x\312x\312x\326x\241\332\tL@\022Q\022%\270-\213c\3479\343\317\032O\253\221\3550\260\353i}r%e\207p\270]3P\r\243,\032\233\007O\325a_\326'\334`_N\226\260\310\372\031\320z\302x\302`\t\344 \210$#JQ\226\3653"
+	.ascii	"\365t\361\247\326\323\305\n\022m%\306\004\243\020^\212\323\330"
+	.ascii	"\262~f=_d"
+	.string	"`\305\325\225\322\251\254\306^T\266\245\341\366\366#JU\325s\347\2036\016R\333Q\204-\322p\342\006\344\257E\213\247T\333\274\366$q\262\302Q\221\271\310\372\0308\362|z>=\245j`\013\013_\273\037aD\317\250?\245\020\333\256-\262~B\345!\241,\252\235\3745\001%1\242d}\f\320=\225\236JO\247\027\252\235A\013\020\211\272\262\313\254\036\025\331\323\351\331\344\004.\261\311\263\351\311$$/&\234\022\304\201b\352\271\264\217d\244\361\335\245\251P\361L\372\240\215\203~\\\371\300&\245\3200\"2\3723\t\t\266\033<\242\204t\224\204j\363i3\202u\302\201\201\030\317\024\317\024O\"7\354\021\307\231\220\331s\350O\"\251(\026\201=\030@z\366<{\236B1\216LD]Yd\032\016\246\273\247\317\237B\317\240\273\263\270\3113\350\t\304\345\005eM\2139\306fc\311\363g[\035[\034\375"
+	.string	"j\301\203M\311*\353_ \373\214\237\361s\347\205j'p\003 M^\210/\366\005W\341sg\250/G\036W\326\277\300\017D\304\017pM\254_\206ReAY\377\002f\206\206,R^\250v\n_\261\246\256\257,\274\345C\352\006\313\341Y\244\374\361\375\240X\021E\257\3570/\212K\366\023\205\bZ\326\277@\023\024(6\270Ml\364ee\375\013\354\f\016\262\020Ja\n#\262,\033\203\222\364\344,\204c[GV@,\226%\360\tS\030\221\354\361\007\266.E`\023^\366\256\257\217\345\257=\213\2150\300\243\227\375R\322\201\005\325pr\226\277\234\245*\203\2215\213_\226:\026\265\220\221\324\304\257(G\223\345\213\036\274(QY\337\002n,IX\222\2600\031\213\333\213\312\276pSb\030{ga\362G\025Eh\2305\213\336\347"
+	.string	"\275\212zd}B\226%\377\221N\257\034B,KX\224\034\237\272\354"
+	.ascii	"w\260\206\212\\\215\374,FX\216\224Y[\261\251\244\274\263\034"
+	.ascii	"\321\003d!e\201/\026\",DX@\300\204\350\365\205\346\005h"
+	.string	"fw\226;\2735\240\304\254Y\212\374\355?\222Y\205Mz\352\242\243c\251k\317b#\016qU{QY\267;)QX\204\234\245\356m\310\220\267\031\026\210b\t\302\022d\fi/*\207\024]]\326\267\200\212\2708\026 /;\036\273\032\202E\306D6\256\200\314\341\350\033\253\221uscy\273\252\3032\031\264\361\343,oKb\210\345\265\265)\235^v<\266\203\r\253vH\347\005\204\007\017\026\266\017\3328\210\307\216\037XA'\\8X\326\316\302\006\033\341;\303\022\252\200\216\035;X\322^\250v\n\217GMWJO\203x0\320\316\222\226D\004\nl3\362\037\371A_\f\032Y\277\002P,c,c,f/T;\202\t\020[\262z\342>\211\2571X\314X\256*\016\373\336\256g)3T3\363\001\334\200B\\QX\310\216x\206(\314\374\262~\005\204\302\302\310\226\254\236d}\270\212\204d}\n"
+	.string	"\262\340`\301\301\002\326\236\305F"
+	.string	"PbB\364\202\371\201\302\344\353,`\006\030\323\021#k\226\034\237\273J\212\262f\315\342\225\313\336\274\254S(\240\306\322\305\322%\002\254\032IK\262>\005h\260\324`\251\361\364\022\231\023\322\227\365) \3052\203e\006\013Wb\b\356|H\3218\013W\2222=&\024\370\211\021C\351\364BU\004\314kb\r\"\344%\225\365'`\310\262\305\262\245b&\307u\364\365\224fD-\353O@\216%\213%K\351\264\263\027\365e\206\004\f\233\365'p\346\302E\220mg(d#\353O"
+	.ascii	"\306\324\247X\256^\250v\004\r d\005\327QV;9\013$diq\226+\026"
+	.ascii	"++V6\210\305\212\245\312\316\307\320\222C\330\005\342\020@\026"
+	.ascii	"*Wp\002'Bn\023P"
+	.string	"\321\324\304\022\365B\265\023\370\301\235\353\366\244\313\352t\226(\026(\037/\244<e\315\362\364:\211\021\347\"\353O\240\207\205\205\004"
+	.string	"YV\260\254`Yb\231\033\344:\312f\026?|\372X\224\316\262\204\246d\306\316\220\240\263\240\bbA*&i\257\261\023\325N`\002r,\207"
+	.string	"\255\\\020\235\005\351,G |\270\223\233\027jjY\263\030\261\250`)b\031\272\223\\\004\004\207T\326,)X\204$"
+	.ascii	"\204\205\207\205\207\345\247\211\335\233d\260\317\210\305\347"
+	.ascii	",?Q?\n\263f\351\371\\\213#\016\206\237\004f\260\304,\261\322"
+	.ascii	"\t\bS\037\\\266\207\210\224\034Y_\002>N\302;\263NB'\242a\221"
+	.ascii	"\251,\301(w\"\3369\005\204\017\271\354\306\214\304\274\254\357"
+	.ascii	"\224\342<t\032:\2418\013\r\377\376\347\034\374\240\215\203\332"
+	.ascii	"~z`\343\316\200\260\200w\016\376 |p\n\n\222E1\342\024t\006\242"
+	.ascii	"\261@dc\2133\217<\026,\234X\327\314\307\217)\035Y\237P\345g\207"
+	.ascii	"+\353\3170D\211\022\247\337\013\325N \tE\256\270\216\212d\205"
+	.ascii	"rx\316&w\372\271W\030`D8\262v\366\271hG(XF\272\262v\362\271b"
+	.ascii	"o\032\326\217\256\254\235L\\\024[}:\204\262v\356\335\211\017"
+	.ascii	"V\215\"Y;\365\362\220\330\024\220!Y;\227\270P\355!\234\036\n"
+	.ascii	"\247\242\332\326\022\262\036F\2148\221\250\260\032\267z\200\301"
+	.ascii	"9\217\334\211D\357\374\334M\311\332\231\347^\233\024YY\270P\307"
+	.ascii	"$!pHbuu\316\273\266y\355Y\342deSSaw\347\335U\033\2405kg\021\367"
+	.ascii	"z\324#\252\253\312\3329\304I\3445T\032\262s\022\201\203l\370"
+	.ascii	"8\375\314\240\025\027\347\244\213\300`\226\323\222\035~rsw\322"
+	.ascii	"\001\035\211\021$kg\020\367\232L\333\221\"1k'\020\247\334;\270"
+	.ascii	"\002\220\312)\007\363<\305(\0342\203\321v\366p\366p\276\031\221"
+	.ascii	"\343:\312*\225v\320\320\372q\347\333\317\213\353T\326N7\367\312"
+	.ascii	"\245\365\206\315\332\351\303\275\032i\334\001\266\310\332\331"
+	.ascii	"\366\"\372$I\033\202(wg\0056%\355\316\265\264\025\"f\2206\216"
+	.ascii	"\235\242\222\211gMp\240e\355\344\341T#\f\273s,\314\271C\307["
+	.ascii	"\204)+\233\324\213\242\361\302y\275s\307\235g |x\221\242\037"
+	.ascii	"\035,\262\276\323\314Y\266\342\303}\353aZ\312\332I\266\322\243"
+	.ascii	"\006\020\221\254S\314I\216\034N\260\326\211)\214\310W\273\304"
+	.ascii	"'\360\310\371u'\330\330W\241R\336\215\033N\034\355Yl\364T\332"
+	.ascii	"_\\<\242p\324\350\272\"\312\372!\342\2345\2345\2346^\250v\002"
+	.ascii	"\013\220\304\024F\244\225\362\262Ze\355\264\221\271\320\316\216"
+	.ascii	"\034e\375\020Z\316\031\316\031N\25632l\226\371\003EX\025\215"
+	.ascii	";\271\016\013{\340\b\301Du\347\025\2253\006S\250\215c\247(\027"
+	.ascii	"\351\005\353\363\n\342|qg\214;a\200\360\341s\255\017&V\255\254"
+	.ascii	"\235[N-g\226\323\305\001a\"qY\250\254\235X\007T\3720\323\212"
+	.ascii	"rZ9\253B\030559\247\316\270l|1\231\242\020\362pJ\3359\265\024"
+	.ascii	"\202\304\006\222\254\235Q/\221\025+x\370A5\301\245\231A\335\371"
+	.ascii	"\364\004\256\211\223\223\305rmJ\317`\326\017\301\343T\270b\205"
+	.ascii	"sI\306*\007\366\305@S\272s\351I\022\r7\"\377\221.\2111\202\262"
+	.ascii	"\276\frC\037r\"\265g\261\221\006lp\331\370\202\323\324\310\210"
+	.ascii	"\234Gw\"\021R\351\265\310\372\204N\243\377H\t\234\262\2048\215"
+	.ascii	"\234*l\230\301`\221\265\263\250\030(5$/\353\313`\346$\262\242"
+	.ascii	"@\261\222\370f\215c'\r\230A\326\322\224\262\276\fN==\316 \"V"
+	.ascii	"$Y6"
+	.string	"'\320\235A\307\024t4\212\262v\376\254LYZ\367\254;Y;}\2448w~\347\316Jb\235\265jg\316I\326\217\300\335\312\341\312\341J\"\214\r\246\027bF \200CJV\020\277\222\250\327&\205E\326+RV\246\254\220Z\3225eiF\200 -\027d\330\257\bbW\f\213zp{\270\224X\367\365\232\r\231\035!\374\212\341W\262 |\270\223\375\345\245\307\223\365\n\224\302'w\222o8!\n\314ze\360s\260\323^6+0\207\222\257\350)Y\371c\326\305-%\326)\241\310a\223\370\276\362\367\025' |\310e\3142\260'HY\257\3705\351c\222\313\214GZ\\\371d\275\262\267\204\353\356+yw+HtV\003b\242g\020&\030\205\314+&$\303#_A\002\345\002\311\307\b^\004V\004\371\212\220 +E\336\306q\334\305\224\225\205\211P\344\201\325}\245\310W\210\200\360\341s:\214\370"
+	.string	"\016\241S\022\006zYe\2752\007\205\307W\330x\254"
+	.ascii	"y\321'\236\232r\031k\261Y[n?\276\002\344+q |\310eL)\202oQ\262"
+	.ascii	"\376\n\\q-\310\337\217\254W\336V\200x\210\266\320\262\276\207"
+	.ascii	"\377Hx\212\226\217\025Y\257\270\275^1\210\2400\312z\245m\305"
+	.ascii	"\307\321\351\252\257E\226\212J2y\nZ\351\301\025cJ\212\2702%\223"
+	.ascii	"\260C\243\254W\326\220IA\\p\203W?p\177ff+i\355Yl\004\023\305"
+	.ascii	"\364B\354%s\3215\204\366\225\264\277\n\3548\303\221\365\312\216"
+	.ascii	"\\\246t\342wG\225\365\312Y\216\261\257\224\215\255`\025\377\340"
+	.ascii	"x\347,6J\206-%\326}\305BN\032\300\201d9\320\262^!\263\332\370"
+	.ascii	"\n\016\033+aL\353\024\363\356\210v\370\204E\216\257\204}E\007"
+	.ascii	"\b\037r\3311KI\033Y\326+`_+^Y\312]rv\347c\345FW\f[+/\276\262"
+	.ascii	"\265\362b\305\312\324"
+	.string	"\032\262\204Hd\371\005d\211i%\306W\254_\341\002\341\303\347\216l|)\374\262^\2411C\006\214,\365n\245\3119ieMI}\245\205\324\n\026S\306\313T\262\b\340\flX\326+X_\271\002\341C.\323|=-\276\262^\261\252Z\241Z\231\212\241i\305i\305i\005\212\256\270\266d\225\370\364\025(\215\342\013\b\217\254WX\344\262\343\327P\217\301\030\206VT|\005iE\305\n\023s\255\205\004F\226\022\353\224nO`TI_a\372\312\022\b\037^2\025sV\205Y\257(}\351t\007\004\233\365WV$\273\\\240\345\310\372\0058cBBZ92r\202\370\025\036\304\025\"\246\2176\216\235\342\036\237x*\352\030\270\204H$\033\0139i\220t\343A\333\311\372_\371\371\n\321W\206@\370\3609)\255\024aY\257\244x\2735\250&\224\365W\204VP\374Hd\r?\037\210Y\037\006\267\275\022T"
+	.ascii	"\251(UR\262\376\n\220\026\222\0318\262\316\355\347\334\025\237"
+	.ascii	"$\033\017\033,\262^\351\311RF<\177\201/Y\021\357*IO\326+;/\331"
+	.ascii	"\034P\222\254W\342\366\205\212<$\2112\230`d}\030\326\366a\020"
+	.ascii	"\313^%JVE\212\221\254\310\244\206G\344\360*R\372\004wz\262\376"
+	.ascii	"\313E\206e$k\025\303-\354U\236`U\n\215cq\334\363\301\265\207"
+	.ascii	"I,\344\244\301\261\360I\326\022\302\253\024\ny\251\345P\021\274"
+	.ascii	"\312\340\217D\002\231ra\225\365a\250\332\277J\340\217<\366\320"
+	.ascii	"\203\262f}\030\242\366a\030j\322D\345/F\226)\331\261\304\311"
+	.ascii	"U\376\262Y\237\020\252\254U\374T\212\2746\366\324X\034\0321\242"
+	.ascii	"\302\367B\265Cx\254[*Dt\375zPX\225\\\205\357*L@\370\3609&\217"
+	.ascii	"\243#NY_e\257\005\252\021V"
+	.ascii	"\225\265\312\022\025\275\r\304\307\365\005\201!\031 \345X8I"
+	.string	"T\361!+\223\312Z\345\210\n\222\377\310\244\034^\212#Y\277USA\222\314CBk\002\227\265J\336\217\272:\225\273\366,6j\333\216\366\222\222O6x\264\354\256r\367\302`Qg#\353\023\252\024\261\213\322\023C\245\210\n\221\245\035\237!\261\362\252\317H\205\312\220\354\026\024c\311\254\214\216N%H\333\274\366$\231\262\226\275\351Qe}\bH\251\310\251\310\251\004y\241\332\t\304\240+nbmB\207\302H\326A\370\220\276\306\262>\004z\342\342\372\2169\242\310|(y{3\262\264\241$\b\024777\273\266\305\233\213\027Y\377\005\034\373WiSiSa\313\032r4\213\3414%\353\2770\265\177\025\036<T\330^\316\342\235\345\336[\212'$\214),\212\374G\227\343-\205\312Z\226\202\247\364\321\035f\375\027\200v\354PI\313q\034\307\326#\017$\026\326\330)J\003\375\203\316K\f\355*i:<"
+	.ascii	"\253x4\001lR\222\365]@T)S)S1\233B%\230\375\212\223(\375\270^"
+	.ascii	"\305\354\005\324\216\230{E\346\025\026\256\021\216\215)\235\216"
+	.ascii	"x\020'%3\212\312\372.\364\205\205\025\205*"
+	.string	" L<\304&\361\362R\001s\251L\360%\342a\265\n>\"K_W\00132\0213\302\"k\225\034\206MHO\340n\334(\nQpG\345\002\233\r\033\313\024\205\024\f\261\302I\264\304Tx\321\240\241b\215\213\005\263_\305A\037|R\270\256b\005t\245\340\220\254p\241j\253l\251l\251\310\270\213c\\E\306ku\004\306\\\326*0\340D\036\207g\206.,\251`\251`\251d\031bU^\\%\253\350\026\305pJ\326*.\340\304\262\236\030A\\\030\242\242R\261\202\342\216\345\tf\263\261\223\223\006/\"\340 \222\254\177\225\252\253X\335\311\273c\260l\354\001\331(\225\251()\251W\310\321\222\375\007\264\2518\251<\2518\025\205X\260H\"]\321\366\037\340\265Bei\205\n\023\223\222\322\n\024\254\326\376\003V\250\250P9RQ\241\202\244\202\244b\244b\024\227\367\200\240}\007<!\"*\ny\020\342"
+	.string	"?\225\024*)<\314Y\035\240d\377*B*B\311(/T1\222"
+	.string	"\334^\030CrTe}\007"
+	.string	"\331\277\n\220\nP\023\tK\031.\374\256Y\337\001f*;*;*>\034\004b\005\263_*=W\361\371ks@\231R\222\265\n\217\003pLi&NADl\022\032\352p\300\325\276\003Rd\233Q\262\315\303CC\303\242\020\224(\326\304\375\026\234\0046\013\003\233\204\202\202M\3026>\212c\247\005\030\336Y\233O\336$|\207vT\005\311\2729\330\306\005ySr\330\002\221\375\026\256~\315?\277& `\323I\323IQh\357\254h\241\306~\013PL\232}L\370\370\226e\327\026\216\366Y@\334\177S\257Uk\352%\263b|b\036\031n\324\322\013)aG\256\334x(Q\222\261\362Y|\244\201$.\033_q\\\307\201F\242W\327\224\365Y\240\201\004I\306\322\200\212\207g"
+	.string	"IKVO\222cF\232\022\263>\013?\373o\342\275Uk\3425\363\212BT1R\002\260E\203V\r\246\270\275e\33542(\bh\224\365WH\334_\341\320\356\255Z\323\016\271\263\342\203D\252\025\366\366\337$\242\326$\262\023_\250\342$\013\222\224\020m\b\021\254\201\227\365W"
+	.string	"k\326\3255\335\246\\W\330\332\177\223\216.\017!}b\253\255d\024\245(\326l\034\327q\360Z\021A\271\221\365U\310\356 Ab\001\334\035\375\2755\343\336\232@\200\300\301\255\304\035)\331WAn\377M\037\255Z\323G\323\255"
+	.ascii	"V\242>\262\227JE\366\351\017\246\352Z2F\224\365U0\343\321d\343"
+	.ascii	"\321\354\361f\217\346Zs\355(L\005\257}\025\260v4\323v\024\205"
+	.ascii	"\232hM\264\242\320\233<X\025\240\366U\030\332\177\323L\255i\326"
+	.ascii	"\366\305\320\306BC{=\260ql\307A[\343\253\253(\353\247P\270\377"
+	.ascii	"&Y\223\254Y\326\236\305;\313,\037)\236\334\031\177@K2\232\224"
+	.ascii	"\312\220\262~"
+	.string	"\nM\232_\315\257\246\330\020\253`6\033\366\246\030\262\205\013!I\262n\352\310XH\031OE|Y7\301\356l\334F\323\253\2028\216\201\342\023V\034*\260M\034ozI\221\361\026%\353\346\r8\221\t\227\306\205$\353fW\262.\320\205U]\234\214\246UF\223\313\215\343\366Jet\024;\035i\320\234\321\234\321\344z\223g\313\r\213\2334\336\344\312X\255\024\036\2478\205\263\375\024d4a4aHYSh\321\244jR5\265\240P5\263\336\324z\261@K\232\262n\276H\326\031\376\261\371d\335t\321\304\212\202\202L.\353fU\023+\317\347F\224&V\363\352\211\207W\217\263\326\205\220\240\244\246\325\326q\004e\305\222\024\230\232S\315\251\346\017T\nAM\026M\026\315(\302k\023\352\315\250\344\021\263\036!Y7\237rY\034\223\t\242\020e\277\271\3246\233\232Mm\\{\215\215\334\255\243:\016\226L"
+	.string	"U\254\310\372(\b\356\267m\234\373fR\333Tj*\031\241BAo\277\315C.\022\222\004\2111\236\221\221K\340\221\\QQQh%0V\033\032R:\265RG\326&\212&\212\242\320\004+\250\004\263_SAAE\2416\216\343\330i\001aNV\024\210\232=\315\236\346\217K\215\243\246\317\233?0\335\221\036V\326'\234\273\006\266e}\020\331\346NsG\202!\330\300\304\304%\213%\204\204\314)ob,\230\315J9s\212\353\344b\2160k\346\341\022\306\222U\217\254\231Q\230\206J\032F\270td\315,d\032\266X\205g>\206\331\"\020D\301@(;voh\t\312A9\032\346\025|[\177 \204\354\2379\250\306\034<>a\201*F\022!\f\316\032|C\312\372 \326\002\003\0030$\026\314f\313\374\374\230\200oN"
+	.string	"\005\367w&\340\017\302\207\317\t\356\200\202\313\232\351$\2271\261\002\352\201\240\261\357\241e\362\235\311\204\331\367\2716N\212[\024UP\304\260 \252\366A$\355\355\005"
+	.string	"\n\210\037\346\022\346\022!T'\0242\363Z5f\0363\211Q(\216\225D8\204c\"\311w\206=\2400\217l\261\035fan\323\2234k\326?\341\b\036\336Q.\226c\3321\355\212BS\342\023\322\210\020\031\264\2360\243\256\256(D\001\330\325\005\035\235\322I\202C\353\tP@\2000\203H"
+	.string	"%O\356\314 \337\362[jr\202\021\034\\2\354z\302\317\376\231nn\314\037];\270\216\366\213\037\276\261\244\\n\325\256;\202d}\023\016w\354`\266%\273z\234\331\266\223\274~\222d\315d+\202\315\345H\2225s\215\311C'\341\232\301\2265\023\215\311\203Yf\304K\007\0175\245\022#RbiG\240\255u\303\210E\232\213\250d\002\322\301\303\004@\246\031\323L\351\004\025\013f\277\362\312\312\232\216L\200\033\0333b\202YX\030\023\354\245y\215\257XX\3438\212\003%\334\214\263k\3267a\306\376\231^^L\260\242\020U\274\242\203\256\253(\016\262\220\220\231\237\273\227\221\250\244$a~1sl-\t\244\372js1$\353\233"
+	.ascii	"\305\274\301\274\241t\342#\263\232\300\234\301\234\301\264\261"
+	.ascii	"\304\264\361\306\004\rJ\326'dZ\217C\250\212\230\254\\(\266\004"
+	.ascii	"\261z\205u_r"
+	.ascii	"L\032\256\034!\217&-\262~\003\020\367\317"
+	.string	"\214\301\214\341\346\020\241\310\265\220\271\305\334*\n\3558NN\211\033p\204\231\305\314*\na\0330\204\351\202\351b\020\256\001k\314+\346U\216\274\006\2041Y0Y0\253\300\256\202\331/&\325\231U\313\271\272\254\256\254\231-\222u\205A\022\263fN1\245\340\300\"\033}Y3\237\230R\307\240\262,!\246\0243\352\214\250J\007\266\335\262\033l\20326\201\241\270\345%\30602b6\275cV\301\354\027\223\351\314\246\277)\204-\262f.\271in>/\262f*1W\\c\210Ie\315<b\256@n5%i\302\\\301L\242\343Ae\267\207|\343\311j\201d\264+f\203,\211\301\304\374a\3760\213\226`pL\2423\213\214HNL)\262f\016%\353\222\f\361\344e\315L\301DAc\rr\313\232\t\304D\241TA\203\307\030\023\005S(\251\2470\226c&\371\343[\301\f2\276%\007a\b*5"
+	.ascii	"\005\263\207\331S\024\212k@lh\310\334ava\005\263_\314\370\314"
+	.ascii	"\235\245\245\036\255\254\227\211\311\272\251\027|bY/\021\227"
+	.ascii	"S\340(IE\350\262^FYNa\242\340aA8E\312N\213!\331\035Y\006\034"
+	.ascii	"\335\333\362\320\b\306\305\365C\b\005\312\n\322\225\317\211\223"
+	.ascii	"%!\023\312\365\311\227\204m\321\317\2215\353\345`\262\356\n\n"
+	.ascii	"\024)Y/\005\227\201-\212\035\354\215\254\227\177\313@$\017\236"
+	.ascii	"\023\214\300%V\212T\212\257\033\310\027/\366b@#\f\375\303(\336"
+	.ascii	"*\262[\265e\023xP\003\2528\351\003#I:ld\031F\254iY\237\001=\370"
+	.ascii	"\370\212B\355\007qO\222\270\013\240\256\f0[\346-\363\226{$\204"
+	.ascii	"\261\260\352}\271\307\302G\225\227\365rI\226b\n\006\032^e\275"
+	.ascii	"<\262T\342\032\322 *S\262L\022\350c\303F\335\006Z$\352"
+	.string	"!\321r\217\241\nc\006l\331\335n\211\367\366\350\330\002{\367%\336\321 \212\037UD\210\024\205p\3441`INnY\327\302\302*\230\315\n\371\262ni\305N\261f\275\244\233\013\302\200\240\270\270\345[\313\212\274\277\036=\226oNC\254`\366\353\307\227o\310\275\037P\376\262^\272%\353^)\032\204IY/}\264\315\225\225-\327\234F\362x|\271\026\326\307\266\226\365R-Y\007\203\255\360.\353e\332\3472\216\024F\230d\275D[\356h\177\300\035\315e\275\274.w\264\371\320q-w,\317z \371\200\231)[@!j2\323\326v\310\033\212\246\022v\350\320\261\034s\301!\366\345\230\233\202\215\306\214\254\227a\271,)\t\322\027W\361L\214\260,\353\227p#G\253\266\314\261\374\"\314\0333\032\n\222\365K\330\332\255\332\022\007\034\370B\025'\211\220\303l/j\211\212!H\262~\tL]]E\241"
+	.string	"\224\301\tf\277J(\242AcYc\245,\026\314~Y\277\254\241\344S\244G\326K\256\005$ba-eH w\215\361\245\214\342\035\336\332O\326K\030\311\272 J\202xd\275\334Zj\265~ql~Y/],\265z\304\334\234,\265\226Y9r\034I2\370r\3265\365\242\370\003\246b\362\204Ia\253\266\254ZZ!\205\342xE\007\206G\1770\025^`\033_S\323\262\205\313\220\353\324\227-\2261\216\3700\311z)\325\032M\251\250\313z\031\265\204R\301V\324\225\365\322i\t5\303\310a\323\022j\371$\006\324BES\222\305X\213\025Y\263(\256"
+	.ascii	"\352BL[\200\335ri\2714f\025\314f\027\300c\271b\271\342=\f\313"
+	.ascii	"#CBR:\035\245\342\005\334\330o\301\332\245\212Vm\251bi\264r\024"
+	.ascii	"\307.v<@\211\2438`\226\001&\365%\341`\252\035FZ\034\311\372\013"
+	.ascii	"\210\261$Z\022\025\205<\030;Z\300\325Rh)\264L\341\336a\005\263"
+	.ascii	"\331%\212/S\320\270\312\200\023\355ZT\325\310\372\013HZ\362,"
+	.ascii	"y\226@2\\\034\326\345\317\227@Y\352h\325\332j\313z\351\023\303"
+	.ascii	"\037\325X\326\313\236\034\306\304\326#\n\t\207\313x\031+\323"
+	.ascii	"v\034\307;\315\270\247\311\224\265\017\021Q\231\326\306q\r\270"
+	.ascii	"\273\375+\017\177\250\224\362r\026\357\254d\261\245x\312\306"
+	.ascii	"q\024\007$\\\251\256R`\252\243=\245\303\245\254O\002\034!\241"
+	.ascii	"\3220\320\232\275\322pk\357I_\326J(pb\031 a\224\254\225\205\007"
+	.ascii	"\\\361\263\347\224\303R$\311Me}\022\310\006\007\213B.s$\340\b"
+	.string	"\f\224\273\222\220\005\b\270\206\224r\321\343\024\345\304\311\017e\017\266\303\262\244&M\362_\253\342\023c\r\261\306\261\035\0070\224\030\212\223\254O\202\020\037_\376+\nQ\361\\m\300dT\366\225\215c;\016\222}n1\342\254\257\200\"{{E\241\013\342\256pG\216(\227\264\240\022\314~)\271r\311\322/\310W]\326\312$\271\314hH\264\343.k%\222\317\035\213\340]\265P\200\227\021#\312\264\275CA\215\243\247\273\273\243\024\234\002\204\212\024)BE('\247\034\342\262tTw\345\020 .(Y+\205\314\324P\372\241\253#\033\353\241\244S\316\001a_\304\340k\237\260\245\020\222u\220\214\344|Jz\0205qsS\306\305\200\305p\255\2322\356\365\242\223\221\225\265\362-Y\207\365zc\221\265\362G\016#\004\004\2241\244\255M\351\264\343\270F\274\306\306\2464\033b\325\261\225<\224<\224a;\276\316\215"
+	.string	"c+w(w(\323Z\304\202\331/\264+\3236\"_\213\302\021\252\312\312\224fm,\024g\275^iv\204\212\257.\353g)1\256=\274\254?B\323\376\225cj\312\261\\\244(\024\363X\031\340n\204\"%\227\222K\031\226\203J\351ue\330\225:@\370\360?\370H\320\f\241\254\257\004\3135\266\266\314\262V\346P~\355\260\252\272\313\372y\204\240\f\226C\204\f\305\2248\262\324\366\231\322#S\336H\213+RxC\331u\344\007QE\227\322\252\264\2015JD\312\372W\326\370\221/\034\026\266+\353'\240p?\001L\366\023`7cF`\254\266a\300P\306x\323\005\243\022\314f\0230c_\371\242Uji\345.\022\214`c\016\236"
+	.string	"\247=\2026w\271\312+\345\225\322\205\233C\t\023\027fJ,\345\225U\020X\326O@<5\245\254\322\242\300\020N0\233\245\272\262\252\215\333x\361\033\215\254\225-r\031V\220\237)\301\250\250\034\326^c\243\016`\005\263_yOOynMMJ\2477\245(\350::a\253\246tBr\203F\217\254/B\330\212\025\312\245\266=\222`\320\252T\272r\211\t(H\366&B\215\375\034\326*\221\324\224H9\354%\336\t\374 \220\352\312\301E\220**R\032\275=\332r\021bU\252\270\322(\017\261\261(TR\201\002\205r\210\2058\216s`\005\263_)\256\034R\322\243\211T\226b\3468\034\022\001H\331\243\354Q\006\275=\212r\241\362\200\256\f\202\321\262\200\334e\255\374)\356\320Q\351e\255\3649 \363\351,l\311\001\215m\326\"\275\254\217"
+	.ascii	",\034\345Q\224;N\361N\340\207;*e|\345\216\240\222\022S\326\260"
+	.ascii	"\0248\321ML\352\005\234\b#\376\031\032\362\305X\213\341\370\332"
+	.ascii	"\352\262\236\222\2472\325o\274\302z\375d\r\037>\210\321G\335"
+	.ascii	"\216\030A\260\246\b\251e}\004\350\211)\331\211\222\365r\206\212"
+	.ascii	"-\251\254\365S\331V\013\265\277\301\204f\326"
+	.string	"8\216\233p\337\023\267\265\254\217\200\274}=\232\001\302\005\311\032\026l\273\333!\227\365\021\020d\303X\260\033W:\262>\002\324\366\337_r\211\\\2227+8\365\226\365\021\320\265\177\230O\r\346\203\375V\216\034\360\003\210=\334\344\260\337\3338\032\204\310\246\262\206\373b\0167\261\332Q\230\230\365\205\264N\367\b\320;\314\344O6\201\3672\024\rCA\224\364e]\264\266O\027^\022sXO\207\220@\304\254? \201\223\354$\206.\212d}\004\030!\311k\325\340\274\315\205\024\212c$\003\0309\022\314f\021\360\263\357`\274\246!\033IY\377"
+	.string	"\331;\270\b\215\013\036A\262\376\001"
+	.string	"\367\017\017\201\207P\300\267\257[}C\262\376\001\360\204\b\201\227\220>1\017\013\r\216L\346\242\350\262\376\001v\354\037\236\203\347^\276\025\241\235\344\312\020K(\205I\\\326?\300\214\375\303r\260\334\253W\364\211y\23600\326\200#\344\311\372\007@\212\213\203\337\216\364\211\255\276\340\004\303\204\354d\375\017R\366\017\377\370\001\277\261@\305\203t\001\027\266\2600\213\244\244\f\206vet\205}e\375\017|>|0\211\360\036Eyj\313\372\037\212\354\037\356\321\003&B\372\304<N\032,\345\b\337\234\260\255\255\301jG2\277\212\330a\263\376\007\254\375\303;Z5x\007\254\206\364\211y\244\f0f6\210\230=\276e\013\271b\030\rNK\262e\252c\323\336\214!Y\263\\[\247\373\017;ffp\331\215>1\217\0168;\033[|Y\337"
+	.string	"J\366\017\213\265j\260\030\\f\364\211y\236\f"
+	.string	"fCp\252I/\320\b.\373\3411\230,\331\326\0269)s\313z%\257}\272YF\353to"
+	.string	"6\035:\340\032F\237\370ET\007G\026\203J\206Y\337"
+	.string	"[\373\207\277\340/\255C\003\252\030\211\203\266\032\200A\262\310\256\034w@Y\337"
+	.string	"K^^\360\215\027}b\236\036pf\331(\241\254\037\002v\377pW\253\006w\3017\\\241\r\345\252\t6\216\2358\320n1\220$\3017\210h"
+	.ascii	"\f\262\352e\375\020\334\366\017[a+\\C\003*\236.\022\312\254\364"
+	.ascii	"\262E\245/\030.\262\206k$\313\032\320\206\305\225\365C\210\261"
+	.ascii	"\177X\306\f\230\306\221\024SQYkk\373t\257\326:]8F\314a\031*\270"
+	.ascii	"\374x\262~\032\234u\030\306\017k\301[<Y)xY\353\274\366\351\336"
+	.ascii	"G\353t\337\273\230\303Y~e@V.\\\344!\026b\236$\f\002\3418x\bP"
+	.ascii	"\373\207\253\016c\375\260\025|\225\241h8\024\"\314f\255\261\355"
+	.ascii	"\323\375\217\326\351\302T1\207\253\\\024CkSY\337\255u\272\360"
+	.ascii	"T\035\r\"sY?\004 X\352\351\t\206j\317\342\235\017@\364\262_q"
+	.ascii	"\034\305AQ\216\3130)G\275aD\204\206d}\020\b\367\0177\275U\203"
+	.ascii	"\233`'\r\250\342\244\016jT!a\312^\271\340\302\362i\342b0\353"
+	.ascii	"\203\260d\377\260R\253\006+\301K\006\350\212\333\213j\361j\354"
+	.ascii	"\240\310\032^\332A\231\352ol\t\\\326\007am\303+\376\267\fN\202"
+	.ascii	"\335\240X\271\262\316_1\207\221\356h\360\264\310\372pQ\013\033"
+	.ascii	"\265j\260\321+\365\022\363$uph\025\314f\343#%\016\016\002\327"
+	.ascii	"~\003\321\032\021\320\252\316\013\024,\267\262z#-\276\325\033"
+	.ascii	")\374\242\342\262\362>9\2704\251\360\213\316\013T\nJT\24167R"
+	.ascii	"\350\024y\224\031\021\245:\253\322\233\026\224!j\240Bg\250\201"
+	.ascii	"\202\250FC\320PUh\240Q\031H\334H\253R(\005\250\321\352\211\023"
+	.ascii	"L\310 \0015\352\201\0235\320\033(\0051\260\320D\253S\234\234"
+	.ascii	"\034\235\020+\324\026\226\306\0235\321j\264&\307\006\007\004"
+	.ascii	"uDK\363%rf<\230\031\201A\224\304\r\264\304\314\013U\206\232\032"
+	.ascii	"\0230\260\211\276P\202\204\224\205\032f\240U\231\031j\230\201"
+	.ascii	"V\251\313\227\360`\2033\315\211Fe\242\036\220\206\250FI8k\240"
+	.ascii	"B_\240\276(T\243+\314T\247\313\252L\262\006:\203\343\202\n\316"
+	.ascii	"\346\263\246&\nBD\224\004\264Z\2033\201\023\323h\265\n=\301\204"
+	.ascii	"j\224\304\263J\275\301\2311z\240:\243\244\211V\247Q\352"
+	.string	"M\013*5P\252\224%*\243\244B]p\276\204\207\231\233\023T\250\0078R\002De\\\2425R\025\252Q\0222\324\021U\350\b(L5JBf\005>Rq\2463\322\027JT?\210\301\231\301%*\263\254V\243+\320\334HU \221\343Ra\020T\351\0054-\230\3009\341\304\t&pN\240\271\221\216XV\243$\340\350\f4\207J\225\036\251(\274\274\325h\210d5\272B5\272\002L4\347\304\f'N\240\271\221\252\360\362\022\036<\300\221V\243+PG4\2479$<\300\221\346\220`yR\253Q\022*T\031\230\260\n \230P\245BG\034\2418\325\021\032g\006\023)T[\242$\224O\033(\004\24237\321\032i\b\345\fS\034\025\\^\302\203\013\255BQ\250FI\254D\253\320\032\235\231\032(\b\234\252\216\t783\321\234\023\027@q\252R}\202\013UJ\235Fs\232%\252R\n\270\274"
+	.string	"\203\f1\244\220\302+\265\241\336@\2473\224\240Jo\244*\340\3140\305Q\241*\205\3360"
+	.string	"jM\215\t67\304\220\203S\2456qfp\321\211\201\346F\252\302\004Q\231\2443Z#\002Z#\205\332`Bu\212\023\003\265\205\032\2504g\306&Z\215\206\300\221\336Hs\366Kxx\247U\352\211\023hn\244#(\bq\023\315\301YFip^P\212"
+	.string	"\341\024\001\"Z\205VC\274\324\350\034\251p5\032\202\332\302\362%<\340\214\270\221\312x03\242\032%\001\233\220\276@\003\305qA%\307f\306&j\343VepF\334\3008#nZ \361\276P\003\025:\203"
+	.string	"\2522#fTpF\334\2640s\243\243B\r3\321&\315\r\364\004\227\t\250Sh\264\006D"
+	.string	"\252Q\252M\324\306=\221s|\t\017\321\234\023\325\231i4'G\007\247z|\t\017\"\24454R\234*TOej\300\251N\253\324M\003\215\241DUJ\201\023937\323j\210\226\0239\356\264D\262\n\235\231V\251.U&gD\365}\t\017-7\321\232i\225\352\276\204\007\252KM\215\316\315\r\316\3151:\325\311\321963Q*t\346fZ\245\276+7\340LKTqn\216#\240\321\032Ms\023\225\201\332 s#\255\326HuD\310\3104in\24299&0_\302\303\210\t4\020\203\201\0206`\224\311\031QM\226\240\352\324\250\260\004a\001\210j\224\004\3144Js#\035\021"
+	.string	"\022\320\027\240'\270\314\314\230\320\2023=\261\202KUz\323\202\264f\3468\215VoR\220\326\314\354\030\334jt\005w\n\235"
+	.string	"\313\024:\201)t\002\325\350\n\322\232\231\225\025i\315\f\214kB\307\004i\315\214RI\205NS`\241\276+#FH\217'rp@\250\234\310\301\001\321|QY\201\221\326\314<Ud\2426\322\352\215NK\f4P\034\027^^\302C\264\n\225\241\0045:\035\021\225\301\204\f\325\233\350t\2523\303R\235\231\201\026\247\320\033h\246P\026\234/\341\001"
+	.ascii	"\324\0204Q\032f\316\211\031\230/\341\301\205\031Z\b\341A\r38"
+	.ascii	"5 \242S\034\020L\252N\025ZE\342\214\270i\201&\204\264f\246)\002"
+	.ascii	"g\032\203Jr\006i\315\214\312\226\326\3140YjjL\310\261"
+	.ascii	"\321\241Q\222\210a\371\201\207\352\024\232\343\001\206(\211'"
+	.ascii	"lB\307\204)\024\347\204%\034\245\301yAZ3s\024\361V\245&R\220"
+	.ascii	"\326\314\034\24553I\234\0217-\224\240BkT\220\326\314\30047&<"
+	.ascii	"\2519+\274\340\314\201\2724Q\233)\224*\245\221YNq\2528:9U\035"
+	.ascii	"\030\242\324)4\247\t\177\340\301\004M\013U*\264fIs\243\203\023"
+	.ascii	"\342\004\264F\006i\315\314\222\032\245\301y\201EZ3\243\234Fi"
+	.ascii	"\24085U\034\234\023\24453\312\033\034\351\215K\324\006h\bi\315"
+	.ascii	"\314\021i\"\005\031\24453/\222\212\254\201J_\3522:\305\251R\243"
+	.ascii	"S\346\211"
+	.string	"\034\034\0207-P[X:in\242S\031\022922*T%\211\030rtj\230\201\212XV\2478%H\350\340LKT\251Th\f!l\240\020\220\326\314\034\251Mi\315\f,\003\323\004\026\0232\354d\223Z\003\025:\003\211\251\t.$\246&TMDo\216\322\232\231W\371rCB\032\"Z\225NoX&W\246Q\023Rj\264z\342\004e\016\364\205\r\303\322\232\031\226j\216\r\016\215\315\314\316\251\211\262 \255\2319N\241\023 q#\245\201FY\bq#u\241\004\025\312\002L\205qbP\241iAg\346\005i\315\314\216\332@!\220\214V\241(Dm\2443 _\302\203\r\322\025\252S\234\022\324\346\r\216\224:\215N@Z3\223\324!15\001\206\304\215\364f\n\245\300\004Q\352\024\032\303\r8%BHkfTVn\244\323\034d\216\215\016\n\322\232\031\025\232htD\364F\352BS\t\235"
+	.string	"s#\247H\r\304` f\003\306\n\244\"\24026POP\233$\240P\033dd\224P\033FTo\244\323\030\24453o5J\342\205%J\225"
+	.string	"\316\f1T\243$\\h\2468\024\250FI(\2478\323i\n*\321\231\225\0223U\350\t47P\033\033\034\020*\321\031hN\210\034i\rT$MT\232\203\003\202\332\202S\205j\224\304\362D5\307&\005\252\364X\255\321\201\216\210\242@\255\201\352t \205i5\206g5J\002Y\205\342\324\2140V\2536\322\022!\24453\313h\215\b(U\212\002\224EZ3\203\214\312\344D\243\"\340\252\f\365\205\02398 \232\022<'`9\221\203\003b\345D\016\016\b\345\211\034\034\020*\030\b\200\203\004\024\234\310\301\001\341\304\340D\016\016\b\031\252"
+	.string	",8\221\203\003\242\006*\364\005\226\231i\223\371\002\007*\210(\r\316\013/\247\226\200j\347\t\325h\210\350\215\324\205\232i\025\204\210\231\3444j\243C]q9\001\235NM\240\206\260\301\251Ruf"
+	.string	"\020\225\241i\241\006*t\206\0213\311gU&\352\001)\325\245R\24333PW\003\"`\340\203\r\030c\334\030`@\3600BG\304\364\206\234}\244\271\201\2360\201*\324f\2123b\202\020<\214\320\021\021\302Y\315\251\352\304 \255\2319~F:\215\336DI\354\033\340"
+	.string	"\0058\200\b&\216\325\250\f\225\004\264F\205\034\033\035\232\367%<Dm\244\325*\224F\346\235B\243't\211\352\r\216\215\361\004\224\246H\235\352\340\2240R\243U\235\033\251\315\221Js\2033\023\245\036\251\322\232\032\251\215\373\022\036\246\321\232\250"
+	.string	"\250233Pc\365%<\f`\032\255\251\221\216p\253L\231\343Kx\250\316\350L\253T\020\2502&\242U\035\033\225\032fpjdd\\\031\231\3434zs\003\216\214\314\221:\215Rundd6\315\215\264\006\031\031\227z#\315\241\312\310\034k\24222\310\252L\225*\255i\346\234\250\026\200&:\205\226\240\026\300\003jU*\302\003\235\033\022\0050\241s#\255)\200\001\016 s"
+	.string	"\021Lx\020\245\321\251\231\271\221z0\245\352x\220\200\252\211\350M\r\364f\032\255\336Heh\240\321i\211j\216\214\214\213\214[\245Jkdd\\h\025J##\343F= \245\312\310\2705\314\340\324\350\231\350T&Y\225\336\264p\243BUz#u\247\325\030fntT\240\201Fe\230\2311\201\205*cC\024\205\231\031\350\276Q\201\006\032\235\272U\252\2144'\304\210(\n\321\234\0233\310\264\020C\2107:s\003\255Ro\244\273*\003C\013\372F\032\303\ru\306\225\346P\213T\031\020 \264\360\202"
+	.string	"\241\005\244;\003\202\264\370\022\036\250:\"\2502/\3204\247\321*\025j\343Fm\200\326\204\320\311\261\331:26Di\250:\"6U&:#\265!\212\002UG\304\033\225\211\346\234\230\201\252#\002\031\3159Q\245\352\2108RuD\024W\210\221\231\231\201\2727@e"
+	.ascii	"\201\202\tn\365%<\350\344\330\310\340LO\220\230\231\201"
+	.string	"n\020\225\221\341\203\017\037\034@'\307\306Y\203C\215N\223T\031\226h\b\235\034\233\327\255\326\350P\2432D\253Q\024trlV\24227$\2445P\231)\016\365&J]\336\220\220\326\23003\003\335'h\240Q\031\240U(\rrJ\035!S\202\204\264\204\314\314\f\024\216\322\340\200\230\3026Di\212$n\244596\320\02033P'\b\024L\230\231\201\272\321\231\033\030\252Th\324\205\252\t4\022\250\211\316\314\230@\225\302T_\302C\211\352\r\316\013L\252\f\264\n\245\201V\243/\320L\24134\324&\265\206\031\234\232\023ltn\220(\264`\023\3051\242\320\3024:\325\251\316@G\350\334@m\226Q\033(\004\336\020\312)\016\007\24087\322\027np\244T\251\rQ\031X\246\320\250\005thp\2469\313\227\360\340\001M\215TG\304\211)\324\306F'\004\225\304\215\324FZm\336HmH\330"
+	.ascii	"5\001\265\371\360A\002r\220\324\004$ \007Y}\t\017&p<\310\241"
+	.ascii	"\332\320"
+	.string	"\264P\275\211\336@m\246\321\234\227*c\002G\204\321\030\265\201B\300\004\216\210c\025g\006\232h\r7\322\232Ms\203\003\342\006Gj\003\023\225\241i\301\004\216\210#M\013Q\032\034\0337*\363\316HI\340\270\020\245\301\261AVin\242H\252\314\r\216\264*\255N\24114\337jT\346\215\346\234\230\001I\305\211\256\300\254\312\224\240BkF(\251\307\250\007\244!\242$\2409\324d\324\003\322\020\310)Nu&\032b\032\215\201\032%\001\315YVo\200\236(\302\273\246\006g\252K\314T\2459\306\252\nTj\364\006\247\252\003e\241\3128i\242\036\220\326@\245U\351M\013*U\020Nd\252\314\362\003\0219FD\006AD\216\201f\020\2409\306D\006\301D\2169\221i\240:\035\220\212\200ud\250U\017npllpfjh\2512o\264\n\255R\2151\325\034\344\b7*\323\302\013s\205%*\203\002"
+	.string	"\2429'XB\270\250"
+	.ascii	"\002\206*\001\033\350T\205\225\352Kx\240\326\340L\25378323L\243"
+	.ascii	"\325\032\251\n!f\246\023\330\350P\213\325\033\035\234\031#\211"
+	.ascii	"\033\351\215\024:\255n\252\324\204\tH\227\3524Z\235\201N\241"
+	.ascii	"%fd\25288\"\242\323\346\262zbZ\215\332Dk\242U\227\225\032\250"
+	.ascii	"\320\027\340\034\252\r5\207\204J\025:\245\321\201\212\2201\201"
+	.ascii	"#\242\206\031h\215\210\026\352\024'\347\365@\t\231h\025:\225"
+	.ascii	"\211V\24149:2\317\352Kx \221\343\001\211\234(5*\003\211\234\367"
+	.ascii	"fD6R\245$\2422\220\310\201\243\036\220R5\225\032\235\322\320"
+	.ascii	"@\217'rp"
+	.ascii	"f\364\264\232S\254\252\340HeZ\2502Q\022P\252\004T\222Q\031\025"
+	.ascii	"Xnp\244\325\231\033\235\021\273*#MRe\340\tT\247814mp\2432Q\032"
+	.ascii	"\234\027\252S\234\234dT\006\206\352\024'GI\3059F\253P\031ht\240"
+	.ascii	"\"v\324\003\322\020Q\017HC\354\352\236\3024\320(\0135R\350\f"
+	.ascii	"\323\350\210\021:'\230\250\302\323j\fQ\033\244\321\231\250\f"
+	.ascii	"/Ih\025\212B\r3P\02155P\020&\246\313jN\264J\325\321\021Pj\215"
+	.ascii	"\024\252\202\211)L\224\006\307FW_\302\003\225\202h\rt&\204\212"
+	.ascii	"\016\224\031%q\003\235\032M\350@\237\314i\264z\023\005Q\275\211"
+	.ascii	"\332T\251:\034\240\2016\253&\246N\020&\246-U\033\234\251\n4S"
+	.ascii	"\350\rS\234\021+T\031\033\350\024\032\003\225\031\255\241\241"
+	.ascii	"\221\332\270\325\227\360@\235\200*3\215\232\220\276\200c\303"
+	.ascii	"4J\205\253Q\022ShU\031\235\231\352\340\204x\243U\350T\323D\243"
+	.ascii	"9T\243\t\034\021\305\227\360@#\315y\241\221\346\274687Q\032\031"
+	.ascii	"*5:\2033\315\221\241\221\346\250\334\340H\2537Q\033\242\323\034"
+	.ascii	"\tN@k\2424\025Dk\252U\234i\211\252L\264\n\215\322\310\214\030"
+	.ascii	"\201\023\255\001Z\2259\001\275\001z\2433\275\340%<XP\335Q\033"
+	.ascii	"(\004j\240Bg\020\241C}S\240J\221'\252\322)\216t\032\303\3142"
+	.ascii	"\006\232\350TJ\215\322(\2532o\225\032\255Bk\230&\2406\315\032"
+	.ascii	"h\025\247\272\022\265\221\316p\203#\255\352\314DM\244\300R\225"
+	.ascii	"\241J j#\255n"
+	.string	"h\265&\212\002\264Y3s\002D\224\004t\032\265\301\004\0227R\033plZl\242U\352\t\352\222F\232\303\264AZ\235\201\252Dipl\222\324\031i\225*\255B\253T\231\032\250\320*\263\304LUzC\b*N\f\007\210\326HG\340Lc\210V\241\323g\r3853:93\312\250\215t\206\350\ft\272\002\211\033\251\315\324\204\033\030Z\246Q\351\bi\365&J\323\002\315\024\212#\202\351\201\022/D\251%\\\232\350T'\031\255Be\210z@j#\255\346\3000\215\326\350\320DK\314P\237\325\227\360@\215\322\340\330\310\314L=\230\031\001\223\023\255\206\240\271\211\036\2512Q\0227P\031\2269\321j\210\352\024Z\245\"\253/\341A\306D\325\006\017H\344\324DE@MTmhRin\240\"\214\324}b\346&\252\323\201\350t\004\222\346\006*\002I\235F\253\325\250\01347P\021/5j\003\205"
+	.string	"L\255\211\332\020u\201:\215\336\200\223\363\276\204\007\017\252%HHkF(\243&\2446H\232(u\032\265!:\225\241\336"
+	.ascii	"=\341\254\336Dg\246\321\034\231)N\025\307F&GZ3\242\004\025:\235"
+	.ascii	"q\251\276\204\007\023S\017H\3448ip\244\323h\216\314\210\234\032"
+	.ascii	"\030\023\323d\016\324ffj\234Fi\2446\340Lsh\242&\2465P\3514JU"
+	.ascii	"1\021\255\311\321AaD\r\264D2J#\235N\2436\340\310\334H+\250\312"
+	.ascii	"\034I@g\300\221\312\220\320\251\311yQ\251F\251\321)\315\215T"
+	.ascii	"\204L\025J\225\261\321\231Vk\210\346P'\200\2435\320\231du\032"
+	.ascii	"\265\341F:3\245\221\332\030o\2446\273\206\231h\211\031\023P\233"
+	.ascii	"\315\244\202\250\201\332p\203#\255Bkpr\246\321\352M\0133S\027"
+	.ascii	"j4:%\021E!ZC\342\306\004\033(\b\033rF\254\320\324\340\224\240"
+	.ascii	"F\247%f\210V\2416H\2533&Dip^\230J\241/7\322\231(UG\306\004\324"
+	.ascii	"F\306\304\364\255\211\336\334@K\314\310\230\320\201\312\230\200"
+	.ascii	"\3320\251S\234\3514*\023\265\201NG\310\314L\251O\031)\225:}\243"
+	.ascii	"9'\252*0#F\340Tuf\002@\225\232\200\312\220\320\021\021\245\251"
+	.ascii	"\352\344\334H]\2429'\2522Q\033\244U\250\r\322i\224\206\303\024"
+	.ascii	"\247:\003\035!\203S\325\201\312\220\270\221\226\250\342\340\330"
+	.ascii	"Pef\246/Sh\211\231\nt\224\325\227\360\340\001\007\252\n4\321"
+	.ascii	"\032"
+	.string	"\021\320\233(\223:\325\251B\243#\230U\031\032\233\031i\315\314\376s\346Fg\204\276\301\221Vs\244\323\031j\224\346\245\222\230Bu\265z\243\203\003\"I\22591\255\336\244@u\253/\341\301\203\231\021.Q\033(\004N@kr\250R\232\267\212S#\315QV_\302\203\314\b\035\021\036P\247Q\033\244S\232\n\240U(\215\246\312L\337\252L\264*\235R`\204\216\210\3444Z\225NopIL\241\305\023U\351\f4\007:\263\253\320\\\203\203s\202\214\321\255V\243\324\021#p\\\232h\r3\320\034\227*\023\325\251\201\332 \255\231IN\241%ft\324\006z\243\2439'\252\272\252S\003\235\200\264f\246Y\225\001!\004\023\320\027@\bA\307\255FejVLDinZ\210\326\210\200V\223\321\032\021\320\031\\\220\326\314\264\344\350\324\200\203S\343VU\216n\325\004\324\246\370\302\215\364\005i\315\fLU\346"
+	.string	"1\325\033\251\316\276\221\332\024i\2427$\244\324\033\t\230\200\332\334Hm\226U\367\004t:5AZ3\323r\002:\235B\215\325\227\360@%q#\255V\243T\t\216\223\023\235zP\305\301\231z\360RI@kF\030\2512 \\\b!\255\231q\271\221\332 KTI\334DkL@m\220$n\244\323*\325\255\312\210P\275\221\352\034\25189U\251\b\227\204t\304\r\316\214[\225\271!\221c|L\f\210\n$"
+	.string	"\201\025\366\214\007i\315\214\007\322\232\031\017n\244P\033\017f\246T\017<\260\334\220\310)\036F\017F\017\246\217m\3570}0|Ait3\370`\230\f\025b\337\261\276\2603\252\375\303,Y\356\301\2060\220\234\301(i\241\321\n)c\361\007\203\007\203\007\203d\210\221\303 \2019\222\246\003\020\346\bL\236\262\214F\\\221$wZk\322x\3770w-/\256\210`M\354\236H\022S\340\335(b\247\\\243:\222%\262\254\221l\202\002H\220\242\f+\330\033L\335\223\016\311\302\020\254\nF\b\f\335\362\320\307\214#Q4\220`H\315=\1770\311\310\262\021\004\006n\357\205\214'r\3175"
+	.string	"\274p\213\201\3000b\274\251e\301}=\214\020f\375\274\016\226\365\344%\3452\325\224\340\327\216\037-<\226m@=\236\270\301L\226O\240\310\240|\300~J\237l\337Y[\013\334\326{a\026\367h)s\232B\343.3\305\334\226\342\326Zv\200\240g-\342\2614z\212\262f\325`\322T\220\351-\2019;L\332\017\263\003\006-C\265=;/\356\262.R\265O\327"
+	.ascii	"\255\323}\327b\016s\346B\305\0233\230k;c\213\312o\3540\327\037"
+	.ascii	"\206\f\246\214\231\330\202\350+k7\013\330:]\030\261\230\303\214"
+	.ascii	"\031\255VP?\262\376\037L\030\214\016\375DD7\007\243\3437>\201"
+	.ascii	"\001s\235\354\0211\312\272\315\302|\251\370\2749t\270\031\201"
+	.ascii	"\311\321\024\013z\361\004\306\213Y\265\224\372\271.\201\301\261"
+	.ascii	"\224\221\004\003\373\371\001s\003~\363Q\324\004\323\265l\261"
+	.ascii	"L\342Ct\006c\003\271\307$/\013\246F3j)\204\255\250\016f\006\314"
+	.ascii	"\f\030\256/\030\032\207\341\222B\263B1dOK\013&\206\240\207\241"
+	.ascii	"\032\200Ab\300\300\230a\t\233\n\0300[6\244\344\031\331\361\227"
+	.ascii	"\025\224\365K\324m\030\0270.`^D\031\240F\025\022&\230\027K-1"
+	.ascii	"\031PPY"
+	.ascii	"\277\304\333\206\261\202\261\202\271b\300\033\266\260\020\346"
+	.ascii	"\njn\212\017-\353\2270\333?L\025\213Y\321I\323\021\024U\022\221"
+	.ascii	"i\344lJ`\213dV\211Eb\306\0033\325\354!\365\302\275T=3\366\242"
+	.ascii	"`\226\\\253\330\210\025\niC)\351q\344\311\271\264\234\212\222"
+	.ascii	"\344\216\005<X\\\241\325\245\006\343\004\243\244Q(\355\374\301"
+	.ascii	"49\247\212\3741az\215\270N4\302\2368\2134\013(@\356\262v\262"
+	.ascii	"pqh=\201\255\300V\t\365\334\222\236\203vKW\033H\317\303\024n"
+	.ascii	"\304QG0\227\232\321\033\214\3213qj\354OE\213\320\341\331\237"
+	.ascii	"\023\230\"\230 \0334n@\301\020\265\020\211\331\201\221\301\f"
+	.ascii	"\265\250(\362\206#\007L\212f\236\221+\210P\017\f\212\246\233"
+	.ascii	"\225!P\023\214\320\263\220\b.\353\226\236\2574=l\326x8\224\276"
+	.ascii	"\204~T\262`\036:\204\024\371\250\2001\237\266\244\224z\224U\333"
+	.ascii	"G\217\0273`xZ\300\226N\320\2340\201\331Y\246H\242`\201\204\017"
+	.ascii	"&V\221\361\352\210\352\201$Q\005\t\221\205K\243\371\031N\231"
+	.ascii	"B\270\374\201\372\272\223\002x\330<|\211\342\302\220%-\251\226"
+	.ascii	"\243\311Z\226\205\r\371\303G\255\005\024\026 \314+\032co\205"
+	.ascii	",o\314\300\031\211I\204,u:\016\t\020\212'L@\344\033\217\277\266"
+	.ascii	"A8\320\305\3331$\206 \274\242e\242"
+	.string	"\221\244E\240\224\027\246\340\006\261\314 YF\223\223\026\200*fI\027\177v\326\277\245]\204\007V\227\023\330icM\221J\342\307\362\307W\226\b%\353\227\275\227\275\227\276\031}/|]J\244\fy\341{aRtR\002g\303:\227\343.\353\227\250\261\377\027=\030\252jF\016\253\254\351T\200Z!\247\344)\265$\027\005\307K\222\245U\366:\003\211\322\350}\032\343\001x\304\t&\227\004\250\226\267\034K\026\301&\032\031q\332`b\017\335\244\360^\254\224'Y\303\027\273\277\334\251\301\331\235e\375R$K\375G*Wx\241`\222\365\013\021\035\007\250u\244d\210sG\276\033\"\245\257\356\025\2443\204:\313\372\205\016oO\217I\326/1c\377/s\315\237\342\\\021\330a\020\026\302\275$\351\310\217\234\223V\213\212*\017\bK\240\276b\323\362\212#<F\361 \376\200S\016\331YkYA\334\334^~\004*"
+	.string	"\005\\\023\353\017%]\322\224\036\204Y\277D\325~i\333am8\326\262~\t\245\375\277\364xY\243\316\325\375\310zSeS\370\310:\212\206\026\204N~<^\0350\017\033\336\024\265\367\354\335K\261\244(m%M-\2663CC\"vV8u\366\227\035_q\222<\f\222DI\326/fW>\362\362\262~\271\256\370P\263B\001W\266\362g\fB\025E\210lG\333\226\207]\033K\002*\311\260\370\232\2109\203v\020\375"
+	.ascii	"\f\353\341\325f\247\367\242c%q,\311\314\b\330\353\226$$\322q"
+	.ascii	"\343kYgF\226\b#\353\027\034/8^\274\332\243\243A\0054\251\001"
+	.ascii	"\030$\2732\005\257\207\334\221\254O\002q\377/7\226o.U\234S\\"
+	.ascii	"\327r\315\025\f;\203b\343\255\241\323\322j\034\325x\265\004w"
+	.ascii	"\360\035\345\253\335\324\326\030\327\013\215\263>\032\371\225"
+	.ascii	"\242\001kK\310U\326W\037poB\230\310x\225\340|"
+	.string	"\340\371e\375\222\325R\355\2701eEC\354R\274\002\002\202\313\372\305\005\r;p\020\372\320z\311\352\261\001d+\353\266\317\370#/\214\305\013\027J`LQ\021E\303\023\250\300\243\227\253\277\274\261\3059\262~\261z\275\360\316\322\224V|\270\360\"B\243j\305h\bdI\f\252\025\250\342^\016&\326\026*LS\317\035\024S\177\207/RO!\254\247\250'\021]\026\215\027\250g\322{\345\3232|y\302bJ\r\r\231\362\302\342\351\224\002\033\344\346\324\004\362\322\344\304q\202 \221\013&'\227\222\213G\013#/K\257\236\0174\300\275\027\245%\241\f\027eE\262~A*\216 111QJ\034\363\274 \345\227\025/I\177A:\363\310\344K\210\307\325DD/F|*\212\376b\364\242\302\006,\037\026/*^zhd\231t,\331/B/B/)\300^P\374%\3052\260\216\215Kn\277\360\274\360\274"
+	.ascii	"a\340\023\307@\261\007\022{\332\260/@/?u\\Y</?/>M|\b\301{\361"
+	.ascii	"y\351A\276\255\305\245\300\221\305\221\365I\204\355\377e\347"
+	.ascii	"\345\213\301\025\343%f\356`U\265\310\332e\212\013\342]\022\357"
+	.ascii	"\222\230]\022\213\211\211\356\230\022\036\256v9\314.Q\\\244\334"
+	.ascii	"\345\360\327X,\216\257.\207\024Ha\266\255\005"
+	.string	"\314\247\266:\033\356\223'.\331\036p\204w\311\272@\211\361\342\205\024\027(.\205\313\2779\036((\330Z im,\326EP\013\203\262$2l\340]\004\227S\372\276\302\254\242\266\356!\262\"\352\257%\nv\372Y3s\262be\242\321\330b\341\007\327\210A\254\207O\223\242w0\2210no\317\205oI\0238&w\341c\242\310\210\210sV\022@;I\022\227%?4(\263\322\313f\225\334eI\313\223\362\205\331Z\032\337\376]\220\260\034y\233\306\236\234\216\2600\t\374z\322s\311[~!\3450\002/\355!E\242\340\360\230S\002\t\233He\355B\304\205\210\213\035rg\357\017\256\310]\354X\226\350\0319\370\006\3436\035\235K\335V\007]q{QB\356Rg\350&\301J\245\270\356\337e\356\335Y2y\272\361$\b\313\335N\341\217\\\231r\211\323\222= \314\246\271%\032i?~\270\300\305\370"
+	.ascii	"\314\206\340\324\333]\340\230+\224XL\250\300\270\366\357\342"
+	.ascii	"\366\002a~\2710\363\362\361\006\013\245E]\265\321\275fHDq=\356"
+	.ascii	"\372\214\b\017\331\234H\224?\246ld\255\301)\362\017`\242\016"
+	.ascii	"\0368\264\323\325\220\206\332;c\371\3254\267\346\222\346\364"
+	.ascii	"S\272\343As\016j@\265\037:v\020!\251\244$\3458[ar\341\214\312"
+	.ascii	"\324\314\234\210K\025d=>\256+@\336\031\201aZe?\314=,a\034YT\362"
+	.ascii	"\020LG\342\030\313\025\263E\331\226\233\330\212\3412\257,q+\f"
+	.ascii	"&\312TgR~\\t0\333\224~\342r\344p\371j\201\201\234\034\327\221"
+	.ascii	"\313\327\017\302\007&\217\"aW(Y\177\204\325\376]\274\\)O\202"
+	.ascii	"Rf.8^$\373E\222\026`.7\230?\246\266~\364\272X\226\342\262\232"
+	.ascii	"\360e\355b\315\201SW\0375\\\254\361Q^W\233f=\324\301\005\253"
+	.ascii	"\275\2111\236\354\240\321\324:\366\3402\"\007\003\206\213\214"
+	.ascii	"\257\017\306\314\006\021c\334EF\023\013\251L0\310\b\024\373*"
+	.ascii	"\266\003\203\206\326\263\206\035\341\221,\227\254\247\227\322"
+	.ascii	"jN)\315\345\205r\211R\355F\340\235\213\013f\022\270\247\264/"
+	.ascii	"\027,\370F\017\231\335\025\013\030\017\2159\"+\345\220\253\344"
+	.ascii	"u\244\025\025\345B5\344\2031\033zY\251\273P\271\264P\002%$\314"
+	.ascii	"\245\205\313Tkd\344\215m\005\221>4>\227\253\022H\350K/\353G\343"
+	.ascii	"\\\234\224q;/\210R\220&g\f$X<4\230V\212\324\300g\b\264\264\304"
+	.ascii	"\273#\003\314\332\305\310\305\310e\305Wxb$\361\242\232\330ec"
+	.ascii	"'%\r~\227\244\273\254\2303\002\371=A\222\265\013\322\347\366"
+	.ascii	"![\231\222\254]\216\2422\366\357\242b%\354\210\345\003\310\210"
+	.ascii	"KQr\220\252\305\236\013\321\213\342\n\210\024\227\241w\250\370"
+	.ascii	"\324D\310\r\227"
+	.string	"\024F:\\`\005\271\b\335\005\005Rni\306`\326't\t:\326i\312%\310\005\350\265b{ \231\202\241\260vq?*V:\207\235\334\232O\323\353"
+	.string	"Vey.=e\313\026(\022\361\\x\224\206\3052\"=P\\v\226@I2\254.0\2278\350\203OQ\217\254\227\256\227\214\2408\304\247\230\021\357\350'm\2122\206{#\205\216\")M.M\225u\307\343P%\310K\343\n\344'\312\353\303lB\264\344G\213\241R\312\333\223)Yk\246\n$fEP\224;Laga\205z\212\207\334\016k\326bGt\250\251=Q\232%\371\0212\225u\036$\314Z\2225\326\230\230c\f(\360=\\f\211,A\201-\334I\246\272\224"
+	.ascii	"\206)y\004\366\265\370k\361\313\272\355\305-NT\244\270U+\016"
+	.ascii	"\331Z\232\260hA\304I\326\217b\355\277\245O\205\257\351I\214$"
+	.ascii	"-|\312\264)8=&w\257\236\030\212\354\236\312\237\337\321\215\256"
+	.ascii	"\026=\245\023\033\013\255\253%L\260(wY=%L\033X_7\246\264 yK\022"
+	.ascii	"\246 S\025T\326-y-GrX{\360e\375\327\345\007\204,\353\026\274"
+	.ascii	"\026#L-+\233\334\001\217efod\373\356X\220\216*\302\016_\330\251"
+	.ascii	"\260\261H\264\261\242\245H>\202\004\013\310\022\"\257\020\244"
+	.ascii	"\031J\224\fy\223$\265\365\321\250\323V2H5\226\264\bI\3661\375"
+	.ascii	"\230\261h\241K2y\221\326c\251e"
+	.string	"\356\005\"Tr\267\242%\310\033\344\352\210\317E\326@\200\260H\021\214\352K\332\203\343\222\221\365i\234\354\266\266\02686\354^\022\323\355\311\222\246\267\267\300\251\024I\273\352a\315\272\345G\346\272\262\201D$\353\026\267\317\221\361X\352\313\272\305G\366\201\274r\032J2\302\306\306\f\322\236\305F2<\\6\276\b\261Jzbii-<^\250v\n]\353\322\013)Y\243WR\\\232\332[x\264\211G\322\354`%]V?\203Y\237\006F\213Y\213Y\313\016\027D\330b\241\321\215\246\226\263\267\354P\032r\366\202\246EKXKXK\231\006q+\262\234\220EUfO-do)\203]$\221q5v\335\211\377\306Z\304\220\202~M|\226=P\326\254\254O\223\242\305\253%G\013X\321\357\2505\234\313j\322\002\366\226/\020>\344\2628\037=\262\3763\333\035\341X\326\2371\334-8Zn\330\260\241tZ"
+	.ascii	"\022\301\344\236\224\237T\326\237\301k\261\266X\343\002\007\021"
+	.ascii	"\215E\022q\034\311\3723d--2Zh(\021%Q\312GsNU-3\336B\303\332D"
+	.ascii	"p\214pf\013\006\f'\016\367\251\311\0131\355\215HQ\326\237a\322"
+	.ascii	"\322r\342\230j\362B\314n\031TRnd\375\231 ,\254\226\027\355Yl"
+	.ascii	"d\242\351/\351k\311\367\207\367\344\342-/"
+	.string	"\372~\330\326\354\210\230!)\311\3723;VVJ'\257&/\304=\364\302\254G\037\025U\bGM\254\032\350\n\207S\326\0271\244e\252e\352=t\212\352\252\373\332ogrpY_\004T\213S\213SK\224\021$zY\345\017\300)S-Po\211\0022X\205\366T\\\202D\007\243\345\251\205\005\363H\t\030\021 %PY\037Z\330\302\324\302\364\334\021\263Z\225\242\230d}(_\213R\213\322s'\212\306T\001\202\252\306\262>\364\253%\251%\351Yx\024\005\203\310WU\342\212\270\254\017\3359:z\356\264g\261Q\222i\351\205\224'\202d\326\254O\003a\222F\222F\213\212\243\246\277\244\254(c}-*`;C\026TS\262N\221\242\205\250=\213\215\216JEQ\230\276\212?L\212\270\r\275\205\210\003\035Ih4\350\265\354\264\354\264\b\325\025Eab\316\371\364\251\265\004\275E\350\206\020\025HY\267"
+	.ascii	"\3452\277/\0257\262>a\313\317\177\244\004p\324\001i\371i\361"
+	.ascii	"9"
+	.string	"B\030\247\224uKOT\021\270\032Y\237\206\"\273\205'\211\243\205TS\035\217)S\236\211/T;\201\006\270\023\344\262\221\235\262\323\333{\"\376\231\250\023\337\251$4\304h\360\212\362?\243<\017\335(M\211bZ+PJ\360Pj\216\350G6\353\323@\225\315\252\004\271\"\202\345\271\233\262\225\365i \"$|\026>\035\247\232\022\305\220R=X\304\025\3060\003\252\312\3722v\202\202\317A\032\256\327\322\013\242\245 7\006a%\177xF\210d}\031\265g\337\237\177\317\276'V\037\211\322@\203Q\261`\361\004\374\023\233D\205\026g}B\r\230)\324\n{\262~:9\356-)r\226\365\323\317\b\265\242\311\215&?\022\326\262\303\023\314\3722\327}\031\033L\230L\345,A\254[\326\227\241\322\323s\342\260A4(\345kk\312\324\221\254/C\244D\211\023\307\013\325\016\241k%\032\224r\2454\307\225\3657"
+	.string	"\345\211\367\304{\"IR\206\335\001\250g\207\344\210[\004\204\247\316\3103\317\0053BG\305gd\003su\257{\332\265g\261\221+\245iP\354\001xe2\354\212\fu\241\030\032\362$\242Dr\265dI\326\337"
+	.string	"\323\020\rH\001\002\344I\007\346~\021\rJ)6\231\321\247\202n.\373\245\365\200\315\005Y\321CIN\3125)\266\343*\364\224\333\330?C\037\204Y_\003|ppJ';\242>\262\031\216 \re}\r\330={<{<\177\274P\355\004\006\236H\250t%\r\231f\265\252 \206\023)\346\030bjh6\001\t\023\026"
+	.string	" 80\030\016\210T]\325\265\003\024"
+	.string	"\021S\304\202x<\250\215\2040\212\024D\""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001t}\320\353b\275\321\335\251\355w\326\305\351\302\207\t\244\241\215IR\230\313\263V\032cL\361\021\212F\006\224\256s\334\205\205b\033o\316\030\263#\255h\n|\006\036\0079\214\200\357\003\222\321\241\224g\\\262\310\210\001\300\345&Z\212\016\301\237\0131\344\320P\344\002\214\345\034\312gGG\245@\317\331<\027^\320\310\313\334%|\374|\336\225G\255\"\276\026\346J6\004\357=}<?D'\254s\r\342\235\"0\223\240\331\321\1779s\027X\354J\267;\326\213S\024\023\353\233\301\256\365t1\315\217\323\371|\261Bx\255E\024t\377"
+	.string	"\002\267\016*\311\336t\356)W\tc\001\2150\302\263=by\bV0\373^\177\022\237/\334\30267\207;\2665\002*\315\331e\314\004\3409\374\370Q\357w\276\004\367\302\302\f\227A{\254*\241\377H\326\355\224\242\316\350\025NI\243)\244\036\203a\251P?X\035v\360\376\036n\320$\374Wz\247\203B\340\005vi.\\Se"
+	.ascii	"\226\270\371\357\305\311\306\267\254<M\"\222\240F\325\263;=v"
+	.ascii	"\237sE\032\034\035.\016\234\017\223\235\2160\317\b\037\277\212"
+	.ascii	"\323;\264\271t\235\2456D\b\335s\007\276N\372l\275s6\003\212\331"
+	.ascii	"_nJ\241\332xc\300yw\277\252\025\263\341\016\230V\033\355\275"
+	.ascii	"cY,\324\304\237\374mO\261\306\034\036\216\227\273GN\324!\375"
+	.ascii	"#\230\357\273'\274\005\253e\243\350\230\305\352\262s\257\217"
+	.ascii	"\304>$\"\370\205\326\017U\210\032e\017\244N\025fy\250,\254\023"
+	.ascii	"P\003SS\032\024\377J\375(2P\3476\274\236$\242, \2654\202\215"
+	.ascii	"o\221\341\204\222\004\004\017\206\254\311\270\025\354\323\241"
+	.ascii	"L\027p\005\212a\366\352\320\320FS\"x\377\234\254bL1T\216\006"
+	.ascii	"\254\350gL\301l\273Ro\230\273\003U\257"
+	.ascii	"\301K\024\024\030imQj\020'B\214\361\"t^\346q\220X\244zt\354\001"
+	.ascii	"\302\342Y\222\344c\007)\216\362\271\251h\307q\254\270\240C\307"
+	.ascii	"y9>\367T\370\363zM\305\371\336OX\203\007\223\240o>\316zU\027"
+	.ascii	"?&\233\232>\362b\356\3315\243ur\220\304\310\342\373\315\305\234"
+	.ascii	"\304=\025\016\001\022\2078D(\344\314\214jk\322\241\340\347\373"
+	.ascii	"\306\006\306(7\023@\313\2627\300E*(}\267\337A\322\225\347\320"
+	.ascii	"\201e\223i\037\013@\346z^\235{J\334\333v!\nl\"D\337\357\266\360"
+	.ascii	"\312\312dri~<\t\212\036\317>8%d\351\366\213\t\221\205\302\372"
+	.ascii	"\206\340k\276Q%\036D\230enr\001D\320F\224<\223\320\241\364\364"
+	.ascii	"\362\364%\f\375%\323\312\206h\375\375\355\270\371\276\266\217"
+	.ascii	" \374B\244\n\230\210\346\313\200\032\304\216\370\331N\317F\035"
+	.ascii	" \3102\263\202.\210L+z\244\017\245\3254Y;W\025\317\344@I@\377"
+	.ascii	"\273\"h\303:G\237\302\375v_~)\2566\214\030\342\322'\013\366%"
+	.ascii	"l\270x\002\f\324\252\276_.\365e6\350\016\004\f\331\026WXz\322"
+	.ascii	"\353\024\263\204X\017\325\316\260\253S\211\303\227<So\300w\276"
+	.ascii	"\022^\201\357\"\200\177\356$f0\016\330\374|\016\350|\350O{\323"
+	.ascii	"?HH\266\003\235G\327\t\025\333Xd*j\317`\231\207<\355\343_\211"
+	.ascii	"H\303\272\344\333\341\305\245\221;8\024(ZI\332\022\245\332E\244"
+	.ascii	"\020N<P\220\266\352\223,\207`\333&\021pNUaY4\310\0356R\326\237"
+	.ascii	"H.\223;\261\217\320\224\316<\302\321\007\323k\023V"
+	.string	"\t\367{:\031\024X\3044#:0\022'\205o\2504\270\021VX\3530\311\345\244l\376\r`\356\b \322\fo\220\275\001\330^\300\310%m\256L\302\3554A\005z\177\303C\311\253\013\255\3211zo\024\211-p\332\235\256G<\213\214p\211\300xyi\311\211\240\304\230*D\257\220\275\242\3332A\201\307\305\300\312\026\316\256r$\346\376\337\271E\024\256\225\035\032'\375\213\274\377\302\277\362\253w\270\t\305\"\351\376\030\244\314\354\215\266\034B\004Ms\247\203\263/%=\311FO}\364\265\036,\236\334\316\372c\224$V\267\tWb\007\316\235BJ1\344\254]\324,*\321rE\235\301\2073\205\025\342!0\0372'|'\272\001%5vg\303|^\237\353\341\372\300:y\306\377rYc\261\374\030x\323\002\2614\354\261w\324\374?3\023\217\355\216<\356\227\033nIV\351\342\b\220\277\312'(\326\236\332"
+	.string	"\234\246:\275\335\202(\311n\261\007k}\226zZ\272\016\272\272?{X\310\2362\250\266\322\352\335\330)\200\257[A%\035Rz\310\\\260%\335\313\276\003[\036E\030\001\276`\264\232\004\0332xn1Z\021\027w\334ji\360\002[\333n\311p\344\351\225-?g\f}\031\273\210\260\327\357\301\276N0p\226\236\340\20528\202\366\203E|\022%wF\202\330\302\3337\0066\204A\3748\251\205\251\264\021A\255\310\\\276CWn\251\202h#N\322\f\373\221\351\261\335$o\361\304w\033\007b\331\210\337\245\020[Oy\n,d1\265\325)-\021\277\342\212=\213\201o\001\237\335\305\022\031\365\317\277>\263\376\276-\\*\232#\303\273\242\347w\313\310_h2~q\360"
+	.string	"\265\205\3529\265 \372\303\376\"\272\243}^5\262e\370R8\314@3\320\327q\002z\336rA\303\005\265\344\220\305m\267\004\366\037\346\310\013eOse\032\021+\351\344C\271$\377|\200\317\20111\006\200\350^\201\020\256\205"
+	.string	"\031w\034s\214\232\013\2170Y\304\271\252\253\037\013;|\3558 \352\247\324\240\247\245\007F\t\313\206]\r{*\3559\251\232\354s\\hka()\221\332E\273/\214I\260\215\004\003?nT\305`-)\273)\251\237\367\020\r'\230}\026F\222\237\231\373\303Z=\022\352\367BV(\237^\021\177?\021\313h\013\360\342\200&\363\222]6\316\">.\260|\023\364X\204\255oV3\275\326`Z\220I\004if\305\265?_A\233\315\3114\257k- \244{\005e\002W\304\364P"
+	.string	"P\352\033\\k\302\247\324\tE\024\032\r\302\013Ur\246\314\222\325\302I\276\253\230\262M\373\303(\356\203\024\001\340.\212_\016\036(\244-=X]\246/w\247\375\317\213\315\317\356E\006\033\344\004\233\256{\005\266\333\226\243\3762\244\335\310\017\263p'\t\032\241H\341\203E\277$\247t\021\260\227\251\373\221[l)T\375\203\325\220L\024\346\202dh[?\306\227\356\206\3624=\f\253"
+	.string	"\r\242\263\367\363\"\214\232\324\244\213`\343\325\2678\272\315\3757\362T\013p\330\246\247\026E:\255>\377\204\300SD(\214\304\303\241N\331\332\235\314\250\320\2268\324\316j\025N\205\232\214&;\024\""
+	.string	"\305\242\350T\354\036\206\360\335\261\374'gZ\356\006\031*\272_\037\212\356\316\203\303\244\210\200\305$|\317\267\231\345YF\357\257(c\214X:vEF\223\346\311q"
+	.string	"ns\340|\030\324\241.8\r\255\354D\313VM\017y3\256\r\274\330\341\261\230Y\n\177\032;o\013\244\232PB\270%8\254h\217\323\273j\360\031:Eq\363\323\242e\034H\252\241\366\r\262\354\234\303\036\350vU\243\303w\316\316\232nq\237\257\341;y#I\027\302\206%=\005v\244=\250\242\344\225"
+	.string	"\030\250 ;,-\360\375\223,\203\204\353\277\304@\2622\244\375\217\231\224=%lM\006\260\362\337\217\274\030$1\227xE3\270\235\227\241\371\327\032\001\246G\212\004\257\020\241d\317\n\357\376f\330\232A\277p3\202\274\334l\221\341\007\261\326\360\3706\252\352\244\302/\261L\023(\277o\271\322&r\322V\331\224\310t\376q\301\342\317\332@\361$\035\370\007\303E\017\240\035]\030\007C\330\031\241\326\202\364g\305\201\240\266\013d2\335F\303m(\343\316\021B\254s\200]*\201\257B\372\310\306\326\251/\204\337\204\255\362\216\331]/\002\365\212\243\212Y\320\300\203\332\233\355\203\377\221II\361\262\210\2219\263\2152\214\272\235\r\004\031\366\307{\223"
+	.string	"\377@\244\323\263\301\234\\\212\375\006\225\020\313x\373\236poU\216\217.\271@\267\250\"\002\254>\2239\364\032\211\037\034\251\254\357\001\254\344\305\003\220\372\005\357\205y\373\025\033:\307 \253\f\177&\327\031\312L\212\t\210\211\377\3147\237(T\006Zk\215J%\374&\233UA\206]\310}\260I\324\230s\202\260ejgvX6l\030\346}\304iw("
+	.ascii	"\231@\234\226pKBk\350\b\201qW\306\332\300i\033g!I\002\372\003"
+	.ascii	"\220\253\212\216o\013+P\r\322`\362gd\350\317\275\270\203\027"
+	.ascii	"\251e\240\246ot\255Y)}\024\351\250\244\273\203\311Q\347\370~"
+	.ascii	"D\277\005\013e\f\264\316\317p\230\251\227\245N\024|>\016\227"
+	.ascii	"\330w\004\306\223\270\275\002\212\305j\341F\233\"\343r\313\023"
+	.ascii	"\260\312\201E\255\b-\207\366\021\330\032\312\017ZA\326\027(X"
+	.ascii	"1\024\253\237\017\333\021\245\n\366\217\334\312eR-Q\356\364\r"
+	.ascii	"ac\263\026\221\346j\033\254\255\370Ya\226\366]\310<\310\324\332"
+	.ascii	"\373\362\3179M\232\022_\343\241\240ZS\352@J\253\360y l}\034\370"
+	.ascii	"\356^\302C\360a^\307X\356\302\025\033#\017\375S\r\374\265"
+	.string	"\303\245\376!\203/F\300\225\177\037\340\223t\316\320_\030Yk\355\243f<\301q\310\246T\351$\350:f\034_\333\245#\244\241U\252]\216\034\311\360\340\305\330\214O\372*\352:\331\351\202\032\350\272\021w\327\3564@BZ\216\001\357$\006\315\007\361\355M\035Ci\027B\311\003\002\nz\006\032\301|\270\032\364\370\376"
+	.string	"/D\033G\036\266`\031\352#uo\2028\216\234\356\323\241\201\"\231\202]U\236\003m\230V\330\251c\"\022l\204\0032\004\353\305\231\245\307\375\366\262\275\317F|K\223\314\311y\362\037\363\021\257\020\030.8\200\302\353\312\365\316)1\r\314\2475n*\270N\216\360D{\032/\216zz\326\325\322"
+	.string	"\363\275}\307\337F\206hx<z\027\256\266\236\274\352\216\314\221\253\224t l-\346j\215z\3273\355IqS'\236P\220\323-\345\241Z\274&\327T\355t\246\252v\022m\277t\361q\237\347\366W\361\311\007\376\303c\362\3043\007\367\250\034_\245\340 \3764V\266vI$r\024\024\362\037\307\211n\266\230\274\202\216\033\034\275\213\250\264\245;\327\227_vBD\025:\344\352\374B\354\004\235\365\254F]\301\351\373&\223Q\377\254\354@)t\245\316<\251 =k\021V\327GG\244\312\027\016\256\212\320F\r\263\260\271\305$\303R\177$\222\210a\261\242\323\1772IF=\365B\270\352m*\357\026\301}M\236\001\3026glA\356hd\313\031\345\024'&"
+	.string	"*\016U\311\276\320\246\335\320\327\247\264\271\250\333\036\004\302\236"
+	.ascii	"Z\361A.N\006j\351\267\333\t\253\265\022\306\302\373)\002\334"
+	.ascii	"\274A\332\231\033V\226\217\236d\346\323\023\024\231\035\273\f"
+	.ascii	"\234%s;\030E.\317\245\311I\006\030\366\265\267\246\264\353f\037"
+	.ascii	"\274\317\216\217S\321!T\225h\251\251\274\363\013\350\031f{\254"
+	.ascii	"\360\307\250\341\325\032!Vr\323\300\244|\343\244\215\310S\204"
+	.ascii	"\022+}\305\370\330/\276R\236\234\321oqw\263\255\230K\3436\225"
+	.ascii	"\367\005i\371\262E\367>W\357\247\240\312\352\265\315\234\336"
+	.ascii	"\034\315\024\021\241\303\257\246\246\322\020n\261\363I\355c\246"
+	.ascii	"\303\b\3336e\323\0045X\177FT\025h*\024\367\006\353\200\024;\370"
+	.ascii	"\213\270\264\006\017\005\213\375\354\033|\323\273J\214\366\325"
+	.ascii	"\377D\207\273\221f?Eo\305\314\026uR\226^~\212\237\241\321T\346"
+	.ascii	" 0\264\350\245\375:9\311\034\375\002\235'w\3016\025\355@\004"
+	.ascii	"\3363nZ\367\367i!\215\353\rU\217<l\275\363\216\002}\350\277\217"
+	.ascii	"\345y\262\277 ^\363\"\0177\004Ji\365\3452\266\264w|@r\224\316"
+	.ascii	"{\355\304\033\320\222T\320)}\201\007\245\243\366\2247\200\002"
+	.ascii	"]\231E\270\027\215\023\253\027\345\023\035\\\263a\337\034'\005"
+	.ascii	"8\235\246\253?~#2\b\221*\0239\363{or\301\234\363Sn_\272\3365"
+	.ascii	"\266+\r8;&^\370u\020w\t\022\tM\321\352s\023\323\301\013\317\305"
+	.ascii	"\007\201\223\202\2377\275\023\177g\007\320\221\006\331\317\362"
+	.ascii	"\256\003\351\236;\274\002R9\230\326l\027\2250\026?]\254\351\242"
+	.ascii	"\346\222pw2\\\326-\225\274kf\216P\245\236\344\277%\370\201\220"
+	.ascii	"\2075\025d\236\023 \202\022\030\206\2355\005\237\225a\334'{\300"
+	.ascii	"\2321\023\021\360v\2014\177\305\003\207\2738a \365\307\274\277"
+	.ascii	"w\252\332\022h\355\234\337>\363\371*\326/\375\352\372!\004!\322"
+	.ascii	"}"
+	.string	"B~?\353\034\237\262\203\241\253(D)\333\301\333\253\316\377\327@\374e\006\252Kp`\267\245\306\360\007\315\355\303\301\272\2671-\017\312s\223\367\341t\256\007\201 R\177T\356.6\263\312}F\277p\325W\t\004\311V\363&\017\316%\247\212\027}\253\240^\026\326\020\372\320\210sKC\311P\240p%\242#\376\306\347H\202\305I^G0F\253\345\031s\201\350\274\237\340\301\rB\276\225\326=\252\371\361\005\b4\004@>F\344\003/\323f\262\342|\024\357\344I\017\030\302\204\251\316\345\033O\343*,\350Q\206T\335V\230EwP\t\233n\225n\021\277\317\b1/\223J\213\001\006D_\201a\005\333\0220Cu;\262\205\370\211\300\377\365@\316\346\b\202\206\225\206P\361\334\337k\320#\225:s\032\022,\311\354Xm\214\346\244\276\222\247\026\310\"\035v\203x\216\256\030\256\275)\033:?\271\265H\001 \220"
+	.ascii	"%?\r,\214\346]\352\206t\314\032X-\250\017j\347>06\311^\034gU"
+	.ascii	"\214\321\351\367\324}\272,?)\374\252\316\267\211\205{1\336\201"
+	.ascii	"W\344\030\321q'l.:?7v\346\316 \325\342#\373\211_\322Dp\257\333"
+	.ascii	";S\016\266\3054VKG\257\035\024\345\322\202\304\024\031L\320\320"
+	.ascii	"\352\372\347\006\2111f\322[\362"
+	.string	"jvO6U\277\253\034C\347\023\235:V\301\370\220\274\341\252x\305\201\036\210\200\374j\353)\273\252\247V\246R\357\260^\314\345\303\252=$v\232\020\375\352\263\375L\343\342x\346$\037-\234\251{\300\231\267M\273\267 U\200\264\377\262q/\037\031\332\340\203\335\250p\270t\321\370\0250\255\020\234 \345\030M=\"\231@\365_x~\327D/\243>\255\215v\346\262U\360\374\220\246\216\302H\323\231\032\264Qj5\310\206i@\232\341[uJi5\203\372m;\227i\353\342\2556\323d\317\332\021\324\024\232\006\241H\260\334m\214\325\231\253\346h\200#K\351K\354\351X\373\261\326\343\246\016ld\304\230\222\251p\211\245Fi\351\201\204\25685\330Z\265\b!aJi7\324\243\216\304a\nC\204\337\262\357\246\275\334\330aj\272\276\377\016\253\325\374\013}q7\337\022\025*7:\212\203\333\230\025\361~g\t\r"
+	.ascii	"\304Z4M9\333\013\370\r\354\225s\363%\275\275\231\240\036\373"
+	.ascii	"\006\204\360\240\177YQ\226?Mx?P\354t\232\263\024\225\264z\330"
+	.ascii	"y~{'\232pqY\301ZN\310\323\310\243\363\201 \367\2630!,\205\332"
+	.ascii	"\030W\242uRf\211eED\337j\0243\253\255\2062\0333NyE\366\r\211"
+	.ascii	"\246\355\005,#P\372\021E\t\363\243\261\304\303\024\351\316\323"
+	.ascii	"\317\247A\365]\240\264'H\256\331\003\366\374\227R?\026\001\367"
+	.ascii	"0$\236?\340\323\250\375>\002\227\263o\310p\232\232\n\t*\313\b"
+	.ascii	"m\311\271\336\234L-\026\226|W\244\336\242@\037\265\3067i\237"
+	.ascii	"m\254j\373\321\313\026@\371,i\211\321\260,3\324\032\377\3035"
+	.ascii	"\216y\b\264\342\006\242\022\371o\2729\177\320\2729\376\361\330"
+	.ascii	"Na\270\311\274\264m{+\214)\257\242yy\342\307\224J\323\024\304"
+	.ascii	"\250\333\004\b\b\352\251\301\004\346q\241\241e\2508\003+\017"
+	.ascii	"ba\231\221\245\206\355tC\236#\005D^\016\201\330#\322O\326\352"
+	.ascii	"\201E\230\341\215\2452\372\025\242\240\342\337\270m\302\302\321"
+	.ascii	"\250\3274j)C\005\217MrM\366\345BT\035_&)I\007\333\031z\354\005"
+	.ascii	"`\351\303w\375J\252\267Y\026]\346\332:x\202%\3171\366\275\251"
+	.ascii	"\303\027\363\372\022\225\256\203\314\357\257q\233\022\352\342"
+	.ascii	"&\360l~E{0\217V\343\n\017\355\301B\251\214\262]\231=\301\fE\241"
+	.ascii	"\002\036\017\346\324z\305\326gN\355\362\247\367<t\371#>\266q"
+	.ascii	"\374\316\271\216\037i\205\333I\233Y{\201b\370\027\247p\347\021"
+	.ascii	"e\260@\272\223\237.z\275^^\007X(b\343\340a\343Y\251\302\357\235"
+	.ascii	"\026,\2222\224\241\202\023-\355"
+	.string	"\326\002\017a2j5gUW\220-E\240\037\250\325\204{\252\367\234\253UQ!\3405\237\327[\344r\225\335\034\330\016\2536R6Jn\001q%\264\033\f\b\343\3251\021rq\325\210\306&<>\3310\320\301\320\367\301\312\027zL9\025D\277n\266s\t\251t\324\310\005\224>`0\242\327\325\212\266C%\003\202{\224\337z&\013\025"
+	.string	"\374\353\310\354\233\2519\2523\340E7y)7\211k\030\331AN\375!2\216\243\253\221\340\270\224\263\276\327\030\352$\352F\343"
+	.string	"\204\341>\222e\321\002\221L\374\324\327\373cF\247\261X\221\215i\301\320E\220<\317\022}`\200\213I\262\b\230\263\021Wh\214\203\032{\0076\b\032\025\317l\221G\314,B\317\016\264\021\30616\376g'c\255\216\353\231\2400(GK\265\371iF\203YDr\346U\"\362N\240\252j\277zr\241\207T\373\024<*\234<\274\207P\346\320`5\327~n\334\231\240L\324\017_\270E\350W\312e\242*\036,`\261\376:\031Ces\356p\267y\320\003N"
+	.string	"\365\352\366\303\021~\326s\235f\331\033\264O\241\326K\303\265-j\322\003%\342\022u\341\230\265\210_\374^\006P\220\rV\007p\003jlES\375\230q\356f\034\230\225\t=]\271\330\353\003\004\324\31559\b\233 .\030\334\007'\360hI\377ZV\024ig\202\210\235x>d\324\362A\335\205\271\322H\272T\024\024\202\276\254\267p\"Q<~g\206\202g\215\327w6\033\307\374Q\251\336\364\376O\342N\021\n\024\001G\276H\361R18BT\341M\036\202\324\265Q\002e>h\220\250\254\202 %\016\216\226\242\350\306\326\234\355d\004n\351j\274>\207\224@\345x\267\334\237\235G\211\233\227\213\351\257\037="
+	.ascii	"\021\264\310\276\3615\310\360\232\226\036\374h\245~u+s\237[\022"
+	.ascii	"\253\003\215\336\272\251\263\273\036\215f7\366\037h\327\006e"
+	.ascii	"0Fv\225Vg@\217zMv\tQu\274P\324O)FB\244\021\347\373Zy\273x\031"
+	.ascii	"\355\315\356\233\350\376\333\225\367\r$4u\203\241Y+M\253\302"
+	.ascii	"\344\fL\331\367\037\365L\257\024\030J\347\007\330&?B\320\250"
+	.ascii	"=,\264nt4B"
+	.string	"\300\364\035\006|\335\027\220\026b\346\331\n\221\317B\220\233vIb\306\027\212\333\303_t\001Z\320zC\235\343\274\255Zl\364`\314\301\024*\352\002Y\204\225a)>\262zS\2451\003G\253\373\324\307\177\251\027W%\347\273\003A\264\034\207<\027\225W\213\234`\334Vvme%3\232afU]\200\b\243\211\232\013\222P->WW\360l\305[\"\311\252?\310\200{\354\210gD\267\234\316\353\231\217\003\245\276Q\217\327u\204\263\316\254\277\325\205\252W>\340Y\214E\254\303o\034A\250\360\025\236\037S\313\002:\216\271\343\250\322\303q\032\316\361\207\021\202\032\330\301\331\310\230\240\311f^\226\313\003\375D5EMZd\323Xb\267\2620\252\361\241\242\005\0161w\273&\242\2356\013VY\232\2466\354\n\320h\260\366\205f\217\243\2214\232IS\337$\200\323W6\327q@\305\363\230\201`\241)\205\210UG"
+	.ascii	"\004\302\217\333\032\273H}I\037\350\223>\030"
+	.string	"N\340^Fv,\271\214 \225\307\035\311\374r\306\215\250\025_\237\340y\006i\b\334F\265\\\262\254\035\2612\350gAW2~C\300\024\036S\266\225\333X\320\026\005sU\272\2236\266\362$\"\200\307\304\270\276c\007\245\030e\037\230*\350\376E)n\207\254)\254\376fU=0\231\344@|\3721no\255j)F\264t\315\306\221\025\213\264\315\362\343A\212\262\313\230o*\036\240~\ni)\256+\363\371\231?C\350a\020\256G\336\357\276O6[5\t(f\222\205|\326<S\210 \354\305P[?5\232\177\035\204-\035\0378/M\020>\373}\b\006\306\277\rs;\367\237,\371|e\030l\336\235\305\355\224`\221\263l\003\245\265\240\222\n \300\254\r\235i\345\323~^(\212\234X\344\347\037[\017Rs\0272\"\203\032\237\025\246s'\353\303\002\357\265Y\323\004\n\245\364\245oa\370@\224V\024\333"
+	.ascii	"[]&n\177\362\260\334\266\264V\365\201\373\234q<\3465G\267\332"
+	.ascii	"9: \276\343l\005\234\336\037c\366\250\214\260\324rOW\004E\357"
+	.ascii	"\002w\355Y\344\305b\247\335\032\245\277\0229\216\2470}\035\177"
+	.ascii	"(G\332\314\343\335\320\364\323\276q\005_\321\302c\315\006<\335"
+	.ascii	"\250\346-\353e@\243\234\341\333\207\220\0337\020\333y\333a-\205"
+	.ascii	"X\213\203\232\034\302\326\323@Z\267\311D7E\330`\265`.\300?\316"
+	.ascii	"\222\035z\177\217\031g.\327\016\371\375\221\264k\027\231\255"
+	.ascii	"\351\227sS\271\335\313\254\263\221\262\n'\214\214U\322\r\220"
+	.ascii	"\001\233k\373\222I(e\351\351\260\231\002\tm\350D_\270\212X2\201"
+	.ascii	"\351\252\221\346^\222\345s\022\002\342P\331\246\026\037\231T"
+	.ascii	"'\273,\200\275\031\231=M\372=F"
+	.string	"\320\326\255\271=\244<N!o6\b\324t\323\346u\225NOKY\023g H\035\266\330\316N0\212\023s\257\221~\231\177G\207\016f\026\355;A\240\260,\345A\247KI\361?o\201\256\214\331\013\277K\346_|\021\207;G2\374\331\032\34595\037\3325\263\335W\273k8\327 \251\345\260\032J\212\306\002\360\242\250\254\251\301v\203\361\033\310+\331T/L\005\243\224\312J\270\r\002e\004\321\346XJ\007^+\207\246\265\2471T@\200X\277\207\325(\363BV<th^\025\013\333$N\004\341V\246>\216\202\205\370B:\021\242\354qfh\235\324y\001o\021\222\312\306\257\335\fX|\323@\013>\020\233\232\216N\272J\336\032j\365)\363\207\232l\226\234E\037p\376\227B\265\322mA\243\004k.\274\003]\373\375et\203\323wB:r\302nELz^x\252ST\211\246)\377\265\020x\315\326"
+	.ascii	"\353<,\302\017{\t\0021\204\213\365)\320\352EA\337:\204\021\210"
+	.ascii	"\212\236\256\304\fCDa\370{\253\210\004)5'&\317\213\210\274z!"
+	.ascii	"7;t\355\035\031Fbm\202\354\016:\002\264SO\fp\344\261\212\fe1"
+	.ascii	"\026 n\326~K\322\277D@@\250\216\210y\335$%\205\323Y#t\324\002"
+	.ascii	"3uX\020\220\213Pq\004GT\370\236\343D\030S\0173$\024\372\236i"
+	.ascii	"\242rB\364\tM\316Y\030\022t[\263\215\221\032\273]\202;\256>\362"
+	.ascii	"\327\311\270]M\320O\034v\206\235\3059XN>b\f\303\333\273S1o\235"
+	.ascii	"\267F\257\375\373G\036\020\022)\006\224\205\271\353\223\217\013"
+	.ascii	"\\\326\201\230\025\035\263\343\322\347\331\016\234\361(\364\224"
+	.ascii	"\246u\006&\302\301\250V\206N\214p'\t{\202\035fN\315\315\242I"
+	.ascii	"\307\322\203^\265\347\345\223ZjZa\240x\030\212\217\370\250\342"
+	.ascii	"\206\307-L\022\336j\377\315\300\366\274\327'\030\226\325\341"
+	.ascii	"\364\266\377\002 D]\035\021l\177\317\346\345\356\223\220\353"
+	.ascii	"\237\016\212\236\257\362,\361\227(cjY\034`\003\030\nF\016h\254"
+	.ascii	"\277E\233\332\214\276%[\352\330\366#\032@\257\353N\244L\023\270"
+	.ascii	"\016\233\023\033nta\033\222\235K\027@\204\212 \245\n\257\271"
+	.ascii	"/\301*b\024\252\213O\367\2441G*\315p\255L\204\233`\360\332\312"
+	.ascii	"]\0336`\302\232\225\221a*\243\301\3103C:\336\333\233\244\022"
+	.ascii	"\316\231\375"
+	.string	"\3406_\326e\022I\304$\227Z\"\333\340\3751n\032K(\363\365r\324K$N<y\305\022\336E\310\001{\310\311j\033+\305\302\023\275\332vKt#3R\253\315\333\330z\327\0367\205\354\265\327\266\270\001\307\226\224e\2532*\"\362A\226 \203\343Jq\234~\035=-\331\340\2555v\206\373\237\312d\346}\346\221M\026V2\373mO0\007\270\372|M4;\035\2673 \320BVK\312ZF\321\321\237\024\337\\6"
+	.ascii	"9\0171\333\006\372\324\340L\222\337\\\200\347\247v\312\020\243"
+	.ascii	"\300\013\244\036\235p\250\306 \0268\266\r\313\357\360^\002\214"
+	.ascii	"\376\246\274\267\205\035\301n\317\235\303V\260"
+	.string	"\027\017x\017\306\013\266n\007\360RXXU\217\212.\222b\240\373]\341\1770R\312E:8\263\373\2755)\2640\3310{\214R\335\031\361t\326\030\024\252e\254ME\240\260\302\036\374\342$}\216P\234\202\220\255\210\210\270C\250\327\365_\013\315\003Z\376>\214\361\032\025d\262\016\342\301\034\236\2468\022\230\275\255q\202%TcddXaV\\\237\205\002@xp!I\337\372d\361\314\031\005\274:\326>\257\365q\371\345\022\226\267\351&\310w\bP\022\271p\2342kr\r\252$X\261?!x\217+\237\330\016\211\202<\204\206\357\271\034o\316\036\2071\272\241\032\211\231\212\233\035\251\333\326*\236\2157\253\\\301\3050\334\236\021Z\027W\264\217\220\277%\343\236\356Y<P\222\204\205\235\205\275\225b\314\266\356S\316xM\0160\203@\227\276-`7\245\260\366jV\036o\303A\365\2741\266\027\271\245\215\006\226"
+	.ascii	"A\"\274\347\020\340EE\322v_\356\313\231\242UEsK7\327\242\252"
+	.ascii	"-\226\277x\376\370\375\355\264u\326\215\347\363 I!\203B\205\210"
+	.ascii	"\245\251F\352\320\215\260\355\364v"
+	.string	"\003\221\321\215y\372\\x\034\255\361\360+\265#\342\375\270\361ql,\362\033\310\271\315/\270\200S^\365\263\b8\232\204\0305\204\322G4\235\210\231\221q\334\020K\006\321\261\314\247\020\017g\203\342=\007\373\226\0235h\3628\353\266)\255\321Em\022r\257\021\t\021\276\311!\026\3518\215\332\365o\301\017}\315\247|\252\373@\3028h\376\326\247|)?\226\276$\207M\035\024)\351;\317\373p\036Q\352\356~\352\264G\037`\241\036i\2328%\273x\340\n\316Rn\017\003\323\264\240J\245\r\227n\273\340F\247\036b9\200D\220Y\324.\243\203\343-#\300x\251]\224\350\343\333\306\b\204\302\237MiKm\255OB\025\251\267\037@\342\235[\205\025,\001\207\230\r\234\272\255\236\333\375{\376OY*\357a6a\211\f\013[\260\003\303\332\237\376\271 \275\363\n\036\f\233\360\370\330\003\212\212\213\236~GG\232"
+	.string	"\264\006Z\202\366\\\246\336\334{\0210~Rs\223\005\312\223\356{\306\275\277#\023\002U\365\246\210\252\254\331\177\271HQ+\344\303\264\334\372-X[\354\025\246\021\301hC\236\346@>\005\372\363\233\233\213\252\346\2105\006\"+(,\202\311\213a\315\024\333\304\353+\024\323\\\224\327\355\252Y\303\357\350\301E\3439\363\203PI\237_\032x\231\254\352\320[o6\234\300E\327:\235y\202\232\233\031\334\006u\362\223\376\233\006U\275\022\240X\232@\343\311\311\t\217"
+	.ascii	"\235\330\2735\272\213=\026[\006^%u!\356'J8\341\263\335\344t?"
+	.ascii	"j}\017[\371\022\032)\234\034\026:i\212\346g\353C\310\030!\323"
+	.ascii	"\227,\311blK\326\305\316\255\t"
+	.string	"\267%\235\021xF\232E\262V)\247\331h\273\337[\215}\034\315\016\265w\356$\307.\256]\356\251\304\035(\005\251p\2606qR\207\301r=\253y\223\226\230\241\203\245\277\"\005\252\257rI\220\033Mm\032J\370\272\027<\002\te\273\244\345\372\315k\362\366:\365\370\n\201\371\364\272\035-\3532\367\243\004\300\260k\345\232\327\r\233\004Nkqa\270\2308\310]\036XTO\307e9?m\036\350F\257LWc\262\005s\034T\363w}_I,Ur\r\331\023\312v\237\240\232?\263n\356\313\030\377\3569\023\224\260\321u\256\276K?V\b&\224\22708\247\r@D)j4\221\237\253\267@\331\243\374\224\373m4\355\310\206R\0371\371\360\245\001\223N*5hZ\257\224\253\035\315Y\377q\215(\360$e\363\t\240s\323Fg\347s^\350\371%l\212O\"\261\373\f\370K\"~]\027N \266r\303"
+	.string	"\222S\302NM\322\312\260\303\376{j{\367\300\203[>\354;P_\364\203\343N\223%\336|Nn#\337M\306\025\2640\325\372\230D\255^^i)\253L*"
+	.ascii	"C\243\273\306\242\230r\247\025\036KMED\210\217\262J9\273\026"
+	.ascii	"\205\024w)@6\243\242S\356\300e\t`\357\320\235\264O/]\r\242\323"
+	.ascii	"\002_P\347\360\253Y\337\356\330\325@\255  \340Jl\320&r\035A\346"
+	.ascii	"j\355\016\3052\322\377\244\006\213\036\204\373\276zs\212B\317"
+	.ascii	"\tw\003\250\336\022\377\331( \300\306\210\003\001\362\234y\274"
+	.ascii	"J\024\016\017\213\223\322Q\20233\211\224e\b5\270\021\245\023"
+	.ascii	"\346\334\356\373>\002C\215\023\235\306\326\037\374\020\251\210"
+	.ascii	"\247K?J`\034\031\210\274WK\220P6\345\007\340\246d(\255\204v\274"
+	.ascii	"\t\210\003^\004n\356\0273\361\002\266\2326\314\034\n\345\"k\206"
+	.ascii	"O\271\321\353b\363\347*\230\037\b\276?\037@\016\205v\253t\201"
+	.ascii	" \200u\021\262\023\007\361\301[8a8\235\301\3055h\2668`\035q$"
+	.ascii	"\2554/\365\225\367\376\327\200\321b\233\3719\r\017\363(f\242"
+	.ascii	"=\206`!3\371A\366\357\355\240\245\202`\300\341\025\341\252\334"
+	.ascii	"U\214\246\333\265K\304\fe<\337\361\372\236A\351\224?VeZ\312\361"
+	.ascii	"\035\270)^\314\233\210d+\261\332\323\022\223[\366A\366Om\356"
+	.ascii	"\024\301a\272\224\365\340G@\360\325q\013\267*%s\353\350|en\312"
+	.ascii	"\262\242\311\3340\351H|\017J$\237C\033 \324\313\326a#\313\305"
+	.ascii	"\270G\241FK\236\241N\232(\370\246J\207\267\302\320jZ[\360\223"
+	.ascii	"b\306\276\212^\024\0165&d\030\246] \350zJ\243a4\360\265\033\""
+	.ascii	"~\264\350\353\345\207'\262\353I\332?zp\006\330Z\223\323\205\236"
+	.ascii	"\260\002\307P\345\346\231\255\376!\376\240\252\303\177Z\034]"
+	.ascii	"\307\216p\\\210\231\207\253_#\004\225\250\250\222T\226r\213\345"
+	.ascii	"\022\220\271\"\004\371k\241|\340\366\375/\347\312\203\277\210"
+	.ascii	";Fa\033\002\022\030\335\355\342\214L 1\022:gQ\3546v\216\247|"
+	.ascii	"\324\031\333^\034Llj\023:\274P\020\317\271V'\b~\352t\326!\266"
+	.ascii	"\256+n\236\f(_yA\364\300A]cqAp\2436\366\377\374\036Z\236\353"
+	.ascii	"'@\264!.\027\3414I9\r*v0\242!\226a\264\374p`\0031B\022\214\315"
+	.ascii	"\331\301\3041\345\264\341r\370\321\262\360\353\226\352\031;\031"
+	.ascii	"\267\3762n\325\013\274\360\205Hc\346\271\253gN\030\366\237x]"
+	.ascii	"\220\030Cm\025\373c\242Gm\320\261\241hFnAY\307\257T\352\2576"
+	.ascii	"\257q\206\363e\316;\340\377\n:t_\245\327\266v\365JY\226\373\337"
+	.ascii	"\274\376\376\311-\347\210i8\32016\273\306i9r\202\016\301\266"
+	.ascii	"\231\350kG\216{m,\304v\231\265M\023=V3)\214\201Nj\2305\261\320"
+	.ascii	">\276\305\277\214\373e%W\262\374\366\356"
+	.ascii	"/\034A\034\201)_\304\246\313\3621\212\203V`Lv\240\177\013\254"
+	.ascii	"i\230\\\367\013\220*\b%\370\006\337\177\b3\357!\361\306\232\330"
+	.ascii	"\316D\250\220\354\237M\252Tr\202]N\344\270\221\206\243\002Ix"
+	.ascii	"\t\351\tj-\025eaff\270\341*\234,\336c\007\203\2014O\332\230\t"
+	.ascii	"\320\367\2505\255\232\355uS\203\325S\327\346FH^\002\200\273\367"
+	.ascii	"+X\331h~\034\2148Q\025\303f\203]\004\371\255\312\031T\247\203"
+	.ascii	"\211\005\270'\021\246&"
+	.string	"\306\242\336\225Ra,hg-4rK@&\305\377\203J\230\227E/Z/\364j\212\353^\366no\276q\034\006\332T\253/\300q%\376Cv\242\013cA\277\341J\371\036\202 \225\252\260\004\300\311\317ih\241\2578\255^\231AO\225\326\220\307\026\350\346\247\0375eP|<mC\021\246\337,rd@\312/M\024\211\337\267\214x\242\265\206\322\252K\0250\353\201Y\253\262\004\201\024wd\023\216\274\016\224e\022\264/\217\2150\026\217\033\235\210ZLB\001|\334\252u\342\204\266M\232\264\037\034N\037?\267\235\250Bo\323\223\275\257e~#7n\024\305\241\313\303\331<i\244Vv\354\374s\341\2244ZU\033\374G\325o[\f\371\007\227\267\333\025r\2039\026\215{o\263H\375\261B(N\263\217\205i[\r\262\340\241eI\235Z\301\004\302\266Gn\233WW\263\025\236\377\350mp$\002/\023K!"
+	.string	" \374]\202\204\273\024&,\006K2\226\215\246\271\306\272\214\027'\270\222\361\311\245\376\260\247~1c\327\233 \202\366"
+	.string	"\bwR\215\304\304>\227\371i*5\344V\333t+y\356B[)\020\r\336:\263\203P\202\204f+f\363\214\njH\214\300\360>\231\027\254\264r\2105X\325\345\004\026\247\222\375\356\020\207]\346o\347M9\332\023n\016\355\316\222bb\352\273\375X\360\003;\330\244#\244m\375\264\252e\004G\017\\f*\024\213\n.\244m"
+	.string	"\313\021\257\222\341$\313\333\227^\273!\022\020*\236v\215\251\013\246?\027\3241\367cN1l\211s\354\024_B\006\323\213hM!\262\220\325){Z\372\331\324\212\273\355\352\2202\210\354\007\337\362X\026\355\242*\346\211\324f\222J\251r\215[\256C\303\233\b\306n\2432\356\230\r\241\214\323\342k\315\263!S\025\2239\004\223\251\256\314\377U$m\273D\276\3552\021z'\233C\335\027?G\303\246\3267\200\255C*\277\3531\234\\\374\004\005\362\375)\314g2Z\342\337\330\021\230\310ps0\020\341\013(,|\261\361\242\216\373\035\310i\3754:\340\337\003\244V\365_\243J\331B\351\016\006\2137\2041\303n)\312\250v\200I&\337\263\27292J\212\242\353P\362i\314\342)]\022\213\216\225-&\213E\3420Pc |\311\212l\245\375\277u\233"
+	.string	">\223\007\321\037=\324\"\212\020\331n\036\035qpS\254\214n\005y\365\3331\372\247f97\331\225\350v,\203m\305\321\266F\331\034#\bG\032\305\274^8\345\017\256\214C\265\267\363o\310\312\320\256\f\266\242re\232d9\372\206q\262\200\376\362\241^\267\241\273\265\206\343fg\247\266\245\352\314w\r\204\201\241\204\263T\331\360N\202\377\322\257\215\330\023\242n\210\024P\367c\177\303\257\227:\303Z0\025\3068\353\266\232V2<o\265\335\207\372}.\035\3243\025\362\007\227f\276\032u =#\026\013\305+\370\225\310\302*C(1N\"M\275\320r\350\222\325b\007\022\364Pu\244\366\177\033=&\347\177\215\372\203\3215\372C\265\036\216\301\350\222\005\277eo\234N\024\373.V\271\333\270\265{"
+	.string	"\275d0\262\005\251O\037\200\263_\215*G\206\304\036/\270F[J`\306T\355.l\313\334\377\027I\241|`t\320\022M\267\230\364v\177\235^\375\346\b#\376M\017\340\027\344\2132\365\323R\337R/e7\031\322H\321cb\377\214\001Ra\016\200N@M\271\375\37440Z\216\232y=,\031\301\016\303G\022\r\270c\211\021\"\tW\025M\243@\261\346N\271B\257\303\2151#\362\357u\353\247\330\336\335<<\300j\037M\203I\270\203s)\376\025R\234\n\0205\r/`[}[\361@\241`\333\002\004\2744\375\216\365\006\224S\004\"\3439\001+J\254\352,"
+	.ascii	"4x\2622\321\300\025\2104[\276\357\flC\024I\021\250\220I\235^"
+	.ascii	")\nj=!-\346\361\t\214\243\275\377\237\024\210\3032\345\001.\326"
+	.ascii	"\220\023i\302\371\220\177v:L4E\234L]\305\336$\267\021\324\300"
+	.ascii	"L\004K\033M\206\274T\304/"
+	.string	"\027\371\032\f0\033\226\240\231\252(\276 \206>$\017\216\352\367\332b\n\300g%\313\017\333\006\0013\355\317\310ELAa\005j\353\273\027to4\3165\026\001P{{\":\371\346\323\r4\t\006d\334\331\001\017\370\007\305a}\023\351\210\034\314L\b\353\017\330\024\001\034\\)\210\354rY\237\320\233\\\372\271\311z\260\303\312b\236\325\346\251\031\351W\327F4\254u!\250\203T\251J\353\tg}w\317C\3266\353]\200C'\025\201\036\035LBt\302\033\376\\\031\320Bc\006\311EB<9\227\003\370\b\036.\f\243\343#\021h\013+i\343\324\236\021\344\232\316 \237\257\320\224\330\205+\3043\0232\211\250\265\344]\334\347\002@$!\215\204\320\211\230\371QW\262 \360S\026\271\2439\0319\311\341\247Dw\013@\217\002\312G\235Eid\225\247\225\025%\3121\210\226`)'\002e,9\333\352\322\201\301"
+	.string	"B\272\b\204b<\256rw_\004\bcq\036\370u+\221\373\353\353\346\315\245\365\261\024\341\220\215m\364\367H\216\225\3456\2003\215\253=:\314\004\026\020z\222\\\\P{\374"
+	.string	"\343\250XO\0053b\352\255QGA\3311\202\373R\fL\221+-\024\t8\370h\267\250\251\021\371\037\351\336\303\317\253\325d\353\261\366\243*G%\264O  \221\004\370W\333H\326\254\272&\005\2312?T\314\317\206\024/\310B\036\2634\305\322]\375-Mb\325\2207\030R\313\305\007\253,s\n'\227O\352P\326\023\324l\252\222\366"
+	.string	"b\275\f\212\305\237\202>d\332\221\341\243\266\330\204\272\346\001\261T\275\340\376\302dO\3560\215\362j\265 \314\272\307Td\363\252\007\345m\250\030\201\314JR\026B\360^\336\b\210XK\276\2409?\303Z\313fZ\200\213*y\005\220\030]\312\270\211e\002\377\360\241\315#Q\033\266\276>\212!H{aZ_7\343\356[/\322\021\317\374\316\231l)\235\240\"\377\246\213\300qB\256\345-\342r\303V\275\006'u\317\251\265}\231_\252\300\b\214\204%YM+\323\274\205[\332\226R^\232j\226\007&\350pPT\360\347\242d\366\375\022\234\261\347V\001\354g;\260\313\273\3017\2003uV;\336\207\263\033-\313R\251x\203dd#\235\207\343\3446\215\325\027\242\312\357"
+	.ascii	"\343\204\310R\212\340T\245\230}\025\230jj\201V=\353\356\234\346"
+	.ascii	"+\344\333\334\"\214\245r\257D\240\353/\224pq\\\231U\366\005\316"
+	.ascii	"*\346\314p\232a\302=\034\037\371_\367\020\275\276\267\007q\220"
+	.ascii	"nY\027\006|\210Oz\215\241 sS\365\221\354\270*N\330\243\033$4"
+	.ascii	"\001w\310\260R\334\2270c%\316\0374(\217\265\256\346\214s\265"
+	.string	"\n\243\3131\232\365X\340qD\332*\016\360q\356P\244\237*\252#\207r\306\307+\243\032\026\210\327\2657\202\246M\017\304Qx\027/\372\001\0337\"\005W*\265s_r\330>\006]cA\303\335\341\203\211x\254\247vl\273\370\247^N\377F>QP\303.R\352*\260n\310\220\317./\n\376\"\304\337\235'u\261J:\375R\331\036~\212\344\342Ty\256\304\007\302\266\234\213\314\016\225\023A\377Y\334\037P^\030'^\355F&\260\343e\223N\241"
+	.string	"\255\315\365\t\315Y\360\245.O\004\270\256\201\023|8\350x\256k!~D\231\206Gfu\003^\033j&rN\223uL\203\202\347\204:x\273b70\224s\035\224rY\035%\321J5\005\316\332\311r\bK\372 ?\205\024\020l*\234\036\242\202\324\2374\276\036\222}\340\343)\020\242\312\317X\002\332zi\272\252\361I\246dS\273\313[h\274\273\371y\312R\267\301\320"
+	.string	"\262mZ\234\267\201<\340\364\303\375r\021q3f/6\315\321T\237p\271\r\306\245\362s\003\337Y\205\276\203:\351\203zN\017\034\f{T\036-+j\261\3101\243\236;\212\f\207/\200/\363G\225\003,|N\"\265\177\250M\356\372\326\203\026\237\300\350(\206\322\336R\214\316-\343H\005;g\262\200"
+	.string	"<+\3152\272\273\262+\036\240)\364y\305\316k\200mK\332#|\327\364R\376\020\313\306/\034\033\3710hi\236\362Nn\322\257c@Y1\240\031Eu\340#\307#%\r\020\363\236sja\323\033\007\374\361\020\016|\353\304\3712\236x\031\0324zd\213\212p\247w\025,s\275\321\303\332\232q*\262K\211F\370\241\007}\263\016\273\212-z\233\f\326f\250#\273\310D=E\2349\\\223\373`B\021\320'\005\343\254\352#\347\335\330\271'\021y\001\226hK\272\300yB\2238\330\310\204(\021\022j"
+	.string	"\270\376\037Wk\203\247\367\325\025\250\343\321\232\251\370\376\347\007Z\201\311\330i\330\330\326\314\306\362s\362\344\332\305\021\275\316\312\001\022>^\026$\364;\205#&\315\341\213\213\200\r\246\224\353tW^(\215c\376\020\376\270\356\253\307\030\344\236\035\332\314tP\306FY\241H:\223\273L\224\"\304\2119\324\205\257\240E\177\323\310\226,\005X\272\205\220\207\2264R\342\207p\260\260\375R\212\313\225T\307*\360\374zf\310\226E\024\317\034\032a\23523\370\230\265B\355"
+	.ascii	";;\031\311\033\313\337\335\343K\324P6\225\314\227<vU$\002kZX"
+	.ascii	"'\020\257\021fH\370\252\304m\206\374Q\331M\r\321\230T$\033Za"
+	.ascii	"\257)!\035\246\032\352h{\326\210\021p#\320\347\355\200\227lH"
+	.ascii	"e\357=\322\310\250\205]\002-UH\b\356\243\260\203\206\346\370"
+	.ascii	"\337\265\353\3076 \005\f\265Ya9\300\313g20\n\374\202\240rm\203"
+	.ascii	"\210\3012\302\345\316\222\226;y \324E\302\263o\220R\314\247\373"
+	.ascii	"\337\325\334\302v\360\216\245<f\307\352\260\307mS|\233x\340)"
+	.ascii	"\302\306B9A\306\213\036\220l\374T\270\227Y;\004PF\007\345\016"
+	.ascii	"\256\346 \216\343{\367\003\327G:\027\264\322o\036\021rL\357\005"
+	.ascii	"\2518N\217\376\004\262\001xbAL\004\214T\324\177\25210\0165Sk"
+	.ascii	"Q\356\337SE+X\345\b\231\020e\023\263\376iJ\336w"
+	.string	"T:\221\257\255!\r\227@\326\177~j\007\031\264\360\005\031\370-\244\344w\244D\235'\216F\322\023?\340\341\277\037x\345\201\276J\374\235\201\245z\225\271\3353)\026\217\031(\242\004\226\371\346\177\210PUry\305\242\345\030\340P\"\216\317\271k\346C\325L\027t\252=\216\310\263B\360\007$\274\352\202\333\337\356b?\205C\220\214\265#n\023\257#\340\343hA\354\205\207\247`\263\323\316\377\336\364\252\206^R5s\336\265N\355\234v`\203\302\361\317\224aOVQ\037u\002\312\274B\212d\241\342\335T\351\301A\201\201\367)\232+3po{\322\007\026ZV\213\247\233\344\340\216\016\023\277J#\316K;\347\361%\320\005V\b0Y\226 \354\r>\354\357<AbL\305;\210K\207\330\033h\032\214\177\260\221]\bY$\351\347\304\221\247\246\201\017\304m\255:\265\361H\360\340e+\220o\307s\274\344-\217"
+	.string	"\244\257;\310\"\216S\307\316>\030\016p\255\220$\235r\204\221\207t\361\203\322\334\267\326.\311'\246\"\363\354\f\t)\3649\024\254\033[1x2\210\257Eqd"
+	.string	"\306+CH\372k\337\311c\220\233v\337\353$\212,\361g\f\305\220\037\351oc\217zpc\333\302/\026u\303\364$\031W\242vq!J\224\301\275\213\250\t\0215\240\030\025\345\t\375M\354zW\036YJ8"
+	.ascii	"\365\2533\031N>\223m\234\203\266\342:\340\363Y\005\237fB\003"
+	.ascii	"\205=j\361\306\340t\2414\277)\243\236\002.\265\222\345\226\330"
+	.ascii	"6\230r\301\226\034\261\201l\036<\033\320\343O\233\355\372\316"
+	.ascii	"\320\312\210\304\231\322\270\301\375W\035g'\202\235p X\244\332"
+	.ascii	"\245+\343\033\341\231\030w\270\025Z\211\213\361\212l\274\242"
+	.ascii	"\241\233\244@\"H\3226w\236A:\255\232\027F\375\001!\024\033\035"
+	.ascii	"\r\377\030\033\360\357\264\006\204^R\366\302\371-%\306\260\232"
+	.ascii	"\221+\244\327o \350A\b F\376\272O\026~W\326\232\273\"0V@\213"
+	.ascii	"\030#\246$\2278\n\200K\003?mn\322\267E\frgv\342\301\264\231\360"
+	.ascii	"\215\337\n\030 \303R|\361\337\201`\326\226\277\346\331{\330\024"
+	.ascii	"\272\226\271\231C\312\333\302\304<\376\2774\245\205\232\365Q"
+	.ascii	"V`\216\367g\344\354\271\222S\237H\275{\332\212\224\271nnR\036"
+	.ascii	"^\277h\276\333m\303O_\314\271\225\345\300\315\321\230A\006vE"
+	.ascii	"\340\260-\215\223\314~\216G0l\343\306\247\315\317\263\325\365"
+	.ascii	"\300b\360\327\202\237\026}\\\303\277_\226\277\032\244\254\004"
+	.ascii	"K\255\262\371\3631\277m=\345\250K\tW}\255\226\227\3013\312\267"
+	.ascii	"\261\3629*\333*\\\276\251\213~H=\337\325\017^Q\3259m\232cD7\256"
+	.ascii	"\342\232R\030F\366\200\370\026\246dg\210;\372,B\214\177\372K"
+	.ascii	"9]\\]\252\213i\r8"
+	.string	"\267xK\217\022x\013\271\306\371m\003\024_\312\230\303\211\310C\016=\334H\206)\250\367\2020e\242>\225\265\370[/\236:\272\360q?\030\264{\247)\312\3063\236\301H>\305ua\225\330f\234\344\034\233\363\031d\361T*\371S\340\266>\276\234\260S\257\230\373\004\273\375^G\237\376\216\371;\327\231\311f\231\313\313\340\373\r\346\334\027'\330&\354\377\202U\206g\206\001\323\377}\310\335\003\f8\361\331\264\0347P\222O\205=f\257\004\3372\317\206\307|'\322\217};\331\033m\t\264\330\337I\205\371\316\200c\217y\315\325F\0168\211\031\233\264\210\271-]\324\317\241h_\370}[\272\227\235)\312W9\336\273I\317\"\207$%\013#?)\224\036\016\021\232\001\026\355\207\244|j;qa\303z\367\013<\244\235xl\275\352\3660\032\257\024\377\233ed?\345\334\325\255pR\023_\344S\306\204{o\320"
+	.ascii	"C\205\245!3\315\215\016\337\253\253\346~\255\226\n'F\257c\276"
+	.ascii	"+v\225s\f}\246\345\023\274\347IbG\315\300\033\273>0\366D\231"
+	.ascii	"\377\226i[#V\334q\343\274po\004\330\237\026\354\027P\272\037"
+	.ascii	"\216{5b\332\263"
+	.string	"\037\261j\353]9\231\024\3577\027\325)r\257\242M\036,\351\355\202\304\354\0043g4\371`\327\362\201\257\356\337\227ej\3103\242\305\317\0307\363\336\353\031\373#\0076\373\350>&\341\364\330r\033\371\213\270\364\356\004\214\002\326\016\303\334\227\300\342\377H\366Q8\263\2214\215@\037\003G\356"
+	.string	"\304\375C\370@\341\3230\351\017\262=f\227\256\320\314K$\335w\203V|\240\303Mr)\241;\236\317\225\333\357\241\314K\375\267H~[\377\361k\267\305~\276\302\330\001O\363\374\263\004>\216\367\330\366\006<W\317\350\275\323l*\216\314h\277w\273\027~!\346/\3461\200\203s<2\272\007D_~{\206\373Y5\341v\200^\370\250\306\252\255\247S\271\356o\354/\006\337K\3449\316\346\370\315\002\367\272\245\237\332X\236\001\363\237\326\304C\304\342?\204\244!B*e\370\003\220=i\264\212\276\256\302\274\253\244\233\t\232'\300\n\227Ix\240&\037"
+	.string	"Tx\035\366\353\277\354\374s\312HU\355\033P|\016\030\237\275o\223\301\354/ \304=\301\303\205\250\270!\270\366\376\300\027\"<_\222\344?\t\364\356K\337\024P\337\021O\203\362\365\b\255\370\324'\374S\022\037\300\225\350\347\260\377\035\211kO\372\336\321\r\244\355V\215\030-\3727\363&\023\003cQ\202\375\246vub\201gd\321\201\304\177\273s\331\234\303^'\323\355\223\034\021\371\nR^"
+	.string	"\2477\007{\034\324\\\034\254\277\310\320gO\264\267\327\363\213\033ww\331=\254\253\177\b\350\235\022N\350x\347Z\365\026_O\360\304\021\315\277\b\033b\242\303k\330]m#\336\037\027\276\017D\236\222d[W\3714\016E\355G\377\317O\033>F}\316\034zOL\354?L\344nB\255\001,'\261\311K\227\334\244\212Yd\376\223\252!\222\267\262\2017\366\342s6}xE\340\302k\017\357I\001\373.\236\312\323%h\027\331\034\363\004\212\237+\245Q\335\234\3168\202;\255Jq\316"
+	.string	"\356\253\252F\030\247\016\346\312\276%\363\274/\373\250\243\257\370\354\\\0209\260\341!"
+	.ascii	"\206kC\335t\215\013\331[\267\314M:\222|I\243\276\300\330\355"
+	.ascii	"\025/\371#\226M\215\354\247\002\312v\367\340\213\352x\273k\364"
+	.ascii	"Nq\031j0{\317\276\t\266\003j\005>\206'T\3657\2437.\315\270\347"
+	.ascii	"\342\361n\320\271\354\236\372D\233\361\264\317_\345\363\316\224"
+	.ascii	"\213\375\373\265\342>\270\305<\347\317\2503\314 \317\312p\205"
+	.ascii	"-\366\b\350k\247\326\305\3771>\276\rkc\265\225\343\020\335\207"
+	.ascii	"\307\303>:1\375\247\r\253\247 s\026\346\372\006\331\234\026\231"
+	.ascii	"\214\3604\256\026\332\203\305[\257fH\347&\020\027H\261zof\237"
+	.ascii	"\013'.\217+\215\007\275\345\233\231\375r\002\333v\341{U\355M"
+	.ascii	"N?'\2379\236/\344\3425\272\036\375d8\235\373\274\242\233\333"
+	.ascii	"\235\323\323\353\341\223\357\225\356\037\363\344\215Up9\333+"
+	.ascii	"\033\304,\016`\337\020\177i.\027\326\\\357\367-\031\375\306\327"
+	.ascii	"\022\263\311\273\234\206\350u,\335\340\224\363Lh\276f\\<\204"
+	.ascii	"fR\245\006=\256\231j\346\240E\327\r\342u\001\274f\345a1\275\355"
+	.ascii	"\373\177\244\021\352\374 \"\027Km\333g\314\337st/\003\263\335"
+	.ascii	"\353\217\032]\226\r\237m\326\034\215\216\343\223\365\327\203"
+	.ascii	"(\345\006\220\337!r\027l1\264\377\307@\034\226s\340'\213\311"
+	.ascii	"g\314\020\375Ah|m\215\267x\367}\301r\315+\356\225\336\037\323"
+	.ascii	"\326u\007\347\211\t\2351\275?\362 k2\223R\3668\232\255>P\354"
+	.ascii	"QR\350\333A\367f\2247Iv\\r\345PQ\340\260b\214?\253`=\017\376"
+	.ascii	"\252r\233\222\277\2573\203\314\026\226\371(\375\324\330\276p"
+	.ascii	"\031\260.\n?r\260-\024\376g\245V|R\377\253\327\256\b\177\270"
+	.ascii	"\"\245\177\260\324PZ\273:d\016\261\3109c\002\036\021@E\202\243"
+	.ascii	"?\306>\\6\257\323\365\300\342\212\254\266\202:G(\264\325\267"
+	.ascii	"W\236~\272\216\3144\370N\226\237\251\304\376\005c>\261\357\333"
+	.ascii	"\036\271|\207.\263\003tTj\250\377\217V\365\347\217\356\301nV"
+	.ascii	"\215\351/j\355b\344\021\024|f&|\304\300\235E\fNJ`\0378\351\\"
+	.ascii	"\331\341i\245\237\272\340\0233\301\362\332\320\024\377\303D\256"
+	.ascii	"\360\344-V\366\305\265\276\021\274\272P\372\033\304\034\202+"
+	.ascii	"\336G\032\031\363\007\346\351\356\331\217\203\027\277\241\353"
+	.ascii	"'o\\x\253\341X\272\357w\350\265x\201W`m\034O\374\205\345\357"
+	.ascii	"\346\236\220\031Pb\257\277\357\2246\257L\360\315\3159\304t\217"
+	.ascii	"\227s\214I\362\261\31213\247N(\306\013\025\345\022d\2705U\303"
+	.ascii	"tx\206\275\t \177\235\213\352[5\277m=(N\377mB\357:q\377\252\202"
+	.ascii	"\375\203KEy\316\306\227Kova\277\343\355H\271\313.\233\234\227"
+	.ascii	"\355\363\274\315l\261\226y#\235\260\233K\372\311\032\335\233"
+	.ascii	"m\204w4\373lR\177d\255\313\326l4\314\356S\322\r\232\270Iv\246"
+	.ascii	"\r\366\301\342\317\243\272Y\307\334=a\027\332\355g\352\324\233"
+	.ascii	"\275\357\200\332\272\225fx\332\237\254\177w\201\317\375m\375"
+	.ascii	"J5\374^\256_\345\177%\022\013T\362\353\320\372@\271\276\242\343"
+	.ascii	"q\365\203\335\374?\337\346\341\224G\0304\376\031\020?\207 yp"
+	.ascii	"]\367\345\306\244\342w\323\255\t\345l8\3022\034\2577\034\333"
+	.ascii	"\220\203\241\304\365A8\250\035"
+	.string	"\273\004\\\177(]\327\354\330\347.R\237C\243\254c6\fv\225\3060\347O2\231NXn:\320q\212\361\206n\251.@\324\275,-\241\333\021\224w\360\272o\311x2\344\306\020\325y\326z\002\350s\336\350\373\301:a\230\020\274!{\317\372_\205\366\335\213\357\031n\005\217?g:\034\361\374\311\371\256\271r\315\035\220\337\216\306L\377+L\024}\357\016 \313t\264\243{\207\334\337\361;x\204\\\372Ka\025\364\3053\247\345\227`\236\370?MWi\035\242\013\3439\330\027\003\360\221\343\005\322\347\321\235\313\271\302}=\371\256f7\345\212\356\247\375\372\353u\224\225\327\342\370M\312m+\211\217>\211d<\263\231\307\257\177@aq\202\367\320\213\034Z\220\345\303q'\270\266\020\022\337`v\341\322\217(8\313\"\360t\250\177\221Y\326\240\361\317\210\340\300\265\356N\337d;Xa\201\277\213\352\204\250+\320\354\340"
+	.string	"\377\355\313\323\327\374\f\037dC\226\354e\355\276"
+	.string	"\024[k\312\326\247\336\226\310\204\220\352\004\316\303#\275\036b^\300\301\2519\344!:\342\342\314\364\373\261,\023ys\020iY2\202\035S\276k\356\237so\371<\230\370\027\276\317\234yu!o\035\374\340\321\200\315\347\246\327H\336Nw\251]\375\355\r\223nO\t\3643\233\031\243\\^sQ\207s\213\332\036C\r\2737\032\233\r\334\253\377\267v|\272\3107\\\346\225\373\365\277W\315[\267Y6D\246\007`\361\003B\177=\331\266\344V\366\023]\036\003\321\377\304\301FQ?\215\341\260\323e\275\202\230v=\210\273[\331\324\001\b\257'\354Z2.\342\362\036 \346\351e\275?\342\205[pZ\303\307\217S\035\271\266\316Wl>\b<\b\250\213\307\233!\376\260\336p0\322\277\353!\017e\r\037\351\006\245\327\2720\032\220\342\003\200\310\233\315\234\177\367\345"
+	.ascii	"C\277\377\007\353\217l\030\346\265\336\206\022>\317\277\344\t"
+	.ascii	"\035\037\270\207@\007\335h\210\334\305\240`\303"
+	.string	"$^O\300@\007Q\361\006\300\277/\0047=L,\375\277\230\212\276\004\316\017\325\340\253&t\373"
+	.string	"N<\310^\313\325\225w2\265\037\232\373\021\021\267\006\024\243\207m\032\302\260\273c[\254\026\235\360\346\030F\353"
+	.string	"\232_"
+	.ascii	"\362q\366}\276>gN\375}\374\340\304O.bef\204]\376\005\245\356"
+	.ascii	"\320'[\271\223\273,\375C\017b\203&\327A\013\356\235\377\237\336"
+	.ascii	"`?_G\374,\302\353\300\032@`\353\326V%\265\r\320\233\352/}f\374"
+	.ascii	"=\315\277_\237=\254=\254\310-\365\n/\261\343\364\245\263\305"
+	.ascii	"\253\007\360v\177X\376\231\252S/\267\371\313\267\355\330\370"
+	.ascii	"\201\f\217\005\374-\020\201\025\327\356\212\301\231C^\036\355"
+	.ascii	"e\356\260\217\352S\250V/\301[\320\313\217\016\376/h\345\257\330"
+	.ascii	"\250}bqN\235'"
+	.string	"\313\305\235\327\207\261w\340\322\036\373\342\341+(\213,\365\217\t|\221\355/\314\035\302z\367y\214F\342\357\"\31679\350\236d\341AN\271d\211\023w\336\\\002\227\223\321\315\301\230\236\254?\037\307\r\237\273\270\334]\357\016\305Z3\306\334\201\\\262SR=\262\262#r9\021\270u;t\256\324\235n\336Y\207\227\025\366\321\324\371;\356\345\364\240\313\273\035x\200\232\002\221\217\325\362-\035R\023U\227y\331\237C\1772\330#Z\362\374\373\224\340v\203\330\274D\357\373\034\357\355s\223\367\203\270\234\261\267\233\337\376q\371\313\005_\322\361g'\271\230\326x\t\2639ar6\036S\346^\022N\223\271E(Z\025!\364\201\271\3066\235\223$\362fR>\3207\352EJ\\\312\366\204\322\2734?\341ge\031\367\217\317\306\003\205\020\234\016\250W\001\371\221L<\273>M\321H\336\n\356\314\264]\\\315\377\004\302\313"
+	.ascii	"\376\307\272\311P\355$x\274\300OZ\376\241\211\363C\333\334L\323"
+	.ascii	"\343\270\346wi\327\353\353\307\002\317r\213\f\277\002\3336_,"
+	.ascii	"}\361=uTv=\246p\255,\274#\225m\033\260\007\210\003\362+\342\230"
+	.ascii	"\327\240\212\316\211\223\177\204g\372\346Eq&^}}_l\231c\213l\250"
+	.ascii	"j:\344&\201%-\240=\240`\326\206\341*\327\351\250\307\330\265"
+	.ascii	"VS=\357r\361\350h\362o\031\324\247i\265\337\363\017\211\325\013"
+	.ascii	"\305\265>\210\347\003\331l\377\3176\345M`{S\372\004\247\307d"
+	.ascii	"\370\265\347\255\307\252\347\016\332\221\342{v\337\275\265\223"
+	.ascii	"\233\343{\353\234\026\025\316\243\200W!\257F\320"
+	.string	"\030\330\017\n\320\004\361B3|y\310\224\353\\GOx\036\245\333\262\033w\272\364\342\252\331\226\264\370\236 o3\212\327,S4\374V\270W\336=7\247\216\354\343\256\376\177?\232\247x>+\235\273\366~\b\264\237\375\243 \325+)~X\370\366%\036\306{WUc\r\270\244#S\3124L(Mc\355k\333\323\3028\2354\016o\313\262\351\367tnu\226-\267\331\344\374\026k\001\312\346\371\252\b\213\023E\177\305\376\326\326.\177L\222\313O'\177\214\313J'\233$\363\025J/]\370$\271\363\022\\\274\243\362\376\231\267\376\021G\355|\205w+\"]uo?Q\203\232\276\"\345\\\210\373\224\340\364\215S<\272R\254\355\300\315\016\\\006\227\342\037h\236F\372(\326X\306\263d\035\315\313+\367_\351\357\203\337\006\3355\364t\324\\\360\323<\244x^\207\356\272\237\272z&\326k\033\256\242F+\207\275\317"
+	.ascii	"\273\216\260\347\246.\213\343\200\375<Zow\307\3761\215M\247\356"
+	.ascii	"\313\247'\322\367|\372\013h\013a\005\377\322\246\347Ow\332\232"
+	.ascii	"\321a\335\3723\333\267]\363\355\355{\251vos\352\346\263'K\273"
+	.ascii	"|\214a\nr\341\244\020;\260\271S\215\247)1\033G[\240S\177\316"
+	.ascii	"\026\263\\\252\217\022\350\004\\;\334\016\r\037\216z\300D\367"
+	.ascii	"\377\356\206\354\273K\206\017No\306\326\361\250r"
+	.string	"\023>i\334\243\360\241/;c\373}C?\022~O~t\313\374\375A>\342\265O\026[\001\267\243~\037X\240\356\177U\351\367n\272\330\341\216\273<\223&\304\362\206\342<b\377\027j`\177\254\270\256\311\351\352M\374\033\277\201\315q\247E\337\247\253\346r\217x\274\354\357d\322\316\353n\264H\353\016\367\361q\240\035<(2wF\203C\254q<86\210&=k7\316\036/\"\373\352\377\315\372\375wB\210\357\337{Y!\337\265\351M\300}0\302\236\007\323z\234\267\311\3179\031\356\367\321\274\006\261Y\372\330j\316\205b\245\261-\260\2265Z[!\334I\347\253\320'Z\335\303\257G\320\252\213\333\302\221\352-\034Gu\343\263\013^\324\363$\251\217\366:_\030\317\276\372H\267\363\224\334N\3443cc\373\035t?LQ\243\272w\036\346\245\006;\353\021D\356Z\272\t\0378\006s\206X\036G\372\206\306m"
+	.ascii	"|R\033\343/\335\331:ACy\177>\364\235\366+\377\037\224\352\005"
+	.ascii	"\363\242\270\315@\334\312\304\235p\333\250\376\214D\2037\345"
+	.ascii	"\230t-\n\317qgg\276L\315\323\207v\315\335H\345\313\267\013'\254"
+	.ascii	"L`\343s\214\233~9E\312\022\027\211\360\267\215\n]\366\017"
+	.text
+	.section	.gnu.lto_.symtab.63fca402034f4868,"e",@progbits
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\007"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\b"
+	.string	""
+	.string	"cliGetValuePointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\b"
+	.string	""
+	.string	"cliGetDefaultPointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\b"
+	.string	""
+	.string	"cliPrintVarDefault"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\b"
+	.string	""
+	.string	"cliGetSettingIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\b"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\b"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\b"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\005"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\006"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\007"
+	.string	""
+	.string	"vtxTableConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\005"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\007"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\005"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\005"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\005"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\006"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\007"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\007"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\007"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\006"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\b"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\b"
+	.string	""
+	.string	"timingsProbeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\b"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\b"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\b"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\b"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\b"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\006"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\006"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\b"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\006"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\006"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\006"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\006"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\006"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\006"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\006"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\006"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\006"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\006"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\006"
+	.string	""
+	.string	"vtxTableConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\b"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\006"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\b"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\b"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\b"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\b"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\b"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\b"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\b"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\b"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\b"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\b"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\t"
+	.string	""
+	.string	"vtxTableStrncpyWithPad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\t"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\t"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\t"
+	.string	""
+	.string	"vtxTableConfigClearPowerLabels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\t"
+	.string	""
+	.string	"vtxTableConfigClearPowerValues"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\t"
+	.string	""
+	.string	"vtxTableConfigClearChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\t"
+	.string	""
+	.string	"vtxTableConfigClearBand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\t"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\t"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\t"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\t"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\t"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\t"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\t"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\t"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\t"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\t"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\t"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\t"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\t"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\t"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\t"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\t"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\n"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\n"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\n"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\n"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\n"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\n"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\n"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\n"
+	.string	""
+	.string	"writeEEPROMWithFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\n"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\n"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\n"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\n"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\n"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\n"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\n"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\n"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\n"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\n"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\n"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\n"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\n"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\n"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\n"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\n"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\n"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\n"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\n"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\n"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\n"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\n"
+	.string	""
+	.string	"flashfsGetOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\n"
+	.string	""
+	.string	"flashPartitionFindByType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\n"
+	.string	""
+	.string	"flashPartitionGetTypeName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\n"
+	.string	""
+	.string	"flashPartitionFindByIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\n"
+	.string	""
+	.string	"flashGetGeometry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\n"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\n"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\n"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\n"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\n"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\n"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\n"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\n"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\n"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\n"
+	.string	""
+	.string	"timingsGetSummary"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\n"
+	.string	""
+	.string	"clockCyclesTo10thMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\n"
+	.string	""
+	.string	"timingsReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\n"
+	.string	""
+	.string	"sdcard_getMetadata"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\n"
+	.string	""
+	.string	"afatfs_getFilesystemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\n"
+	.string	""
+	.string	"afatfs_getLastError"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\n"
+	.string	""
+	.string	"sdcard_isInitialized"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\n"
+	.string	""
+	.string	"sdcard_isFunctional"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\n"
+	.string	""
+	.string	"sdcard_isInserted"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\n"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\n"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\n"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\n"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\n"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\n"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\013"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\013"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\013"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\013"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\013"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\013"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\013"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\013"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\013"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \013"
+	.string	""
+	.string	"flashfsEraseCompletely"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\013"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\013"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\013"
+	.string	""
+	.string	"flashfsIsSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\013"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\013"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\013"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\013"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\013"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\013"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\013"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\013"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\013"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.63fca402034f4868,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1532 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\321\b"
+	.string	"\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\233\364\343\336\006"
+	.ascii	"\001\366\342\354\272"
+	.string	"\003\002\233\330\277\300\016\003\354\377\375\212\002\004\376\367\260\205\006\005\323\347\261\306\003\006\330\264\373\207\t\007\263\320\357\247\001\b\261\372\215\340\017\t\367\316\327\257\017\n\363\222\222\233\t\r\216\307\310\264\005\016\307\355\347\305\n\017\336\337\356!\020\336\361\204\276\002\021\206\345\347\303\n\023\355\316\316\363\b\024\327\222\361\365\013\025\342\263\312\237\001\026\302\223\266\246\003\027\302\223\266\246\003\030\257\267\254\261\f\031\214\266\217\340\001\032\320\205\256\202\b\033\344\352\246\263\007\034\345\220\314\235\r\035\375\275\346\323\005\036\355\262\347=\037\322\204\221\306\001 \206\255\214\227\017!\317\234\246\263\t\"\342\335\275\264\003#\363\225\213\300\006$\223\244\353\233\b%\234\260\325\254\r&\302\223\266\246\003'\211\301\261\026(\373\344\335\202\007)\216\350\347\360\n*\264\264\266\260\r+\235\202\211\317\002,\347\205\360\261\n-\246\210\320\217\006.\201\304\320\300\016/\220\207\307\322\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.3d179887d19a4281,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.185.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`\274\001]\016"
+	.string	"$\027\361\001"
+	.string	""
+	.string	"\277"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\237\002}\273\001"
+	.string	"\005\001\006\025\001\020\005\001'/\206\b{\370\375Qy\276\017\005\001'7\206\bw\230\375\001u\301\016\005\001'A\bu\304\r\005\001'K\206\bs\bq\307\f\005\001'V\bu\312\013\005\001'`\315\n\005\001'j\206\bom\320\t\005\001's\323'|\325\007\005\001'\205\001\206\bk\330\374\001i\330\006\005\001'\221\001\by\333\005\005\001'\231\001\336\004\005\001'\242\341\003\005\001'\253\344\002\005\001'\264\001\b}\347'\272\351\001"
+	.string	"?\202\210\200\310\002g3\352\0014\350\001\346\001\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\0015\324\001\322\001\321\001\317\001\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM2068949"
+	.string	"\n08G021"
+	.string	"\bMPU9250650000"
+	.string	"\013LSM303DLHCA28MA8452ADXL345"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"* \020\2431r\003["
+	.ascii	"\316\222\302\206\222\255\222\216\327z\327\030\221\321\203(\n"
+	.ascii	"B\036\017\2576\214\302\273d\367Q3\326\316\313LL\304\313E\362"
+	.ascii	"\370\337%\263\036\317\227\331}\030Y,\177rK\242L\3005k\036\020"
+	.ascii	"[\263<:\363+\017[\317\332\314]\263n\220\337`\212"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.186.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`\223\001\235\r"
+	.string	"\024\026\323\001"
+	.string	""
+	.string	"\264"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\250\002}\273\001"
+	.string	"\005\001\006\025\001\017\005\001'/\206\b{\270\305Ry\276\016\005\001'7\206\bw\330\304\002u\301\r\005\001'A\bu\304\f\005\001'K\206\bs\bq\307\013\005\001'V\bu\312\n\005\001'`\315\t\005\001'j\206\bom\320's\322\006\025\001\007\005\001'|\325\006\005\001'\205\001\230\304\002y\330\005\005\001'\215\001\333\004\005\001'\226\001\336\003\005\001'\240\341\002\005\001'\251\001\b}\344'\257\346\001"
+	.string	"?\202\210\200\300\002k3\347\0014\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\001\324\001\323\0015\321\001\317\001\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM2068949"
+	.string	"\n08G021"
+	.string	"\bMPU9250650000"
+	.string	"\007L3GD23050"
+	.string	"\tL3G4200D50"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.ascii	"& \360\"B\312\003\207\254\372@\227\203j\250h\214\222\201A\f\205"
+	.ascii	"\220\247\207\313$\214\265\273\234\335\373\321d,\206C\314D\306"
+	.ascii	"\213\263\036\277\213\354r\346-f\271\265-\022g\"\256\231\345\001"
+	.ascii	"\2655\317\2033\277\362\260\265\254\231\271/\353\006\371\r\275"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.187.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"e\007"
+	.string	"\264\f\312"
+	.string	""
+	.string	""
+	.string	"Z"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\251\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'2\206\b{\270\314Ry\276\005\005\001'7\206\bw\bu\301\004\005\001'?\304\003\005\001'G\307\002\005\001'O\206\bsq\312'U\314\001"
+	.string	"?\202\210\2008o3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bQMP6988"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004LPS"
+	.string	"\007BMP280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\r"
+	.string	"\350L!\332d\f,\006\204A\306"
+	.ascii	"\177 \023\200k\236y\200\314}f\335\240\362\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.188.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"U\007"
+	.string	"d\f\312"
+	.string	""
+	.string	""
+	.string	"_"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\370\251\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'2\270\317R}\276\005\005\001';\206\b{\by\301\004\005\001'C\304\003\005\001'K\b}\307\002\005\001'T\206\bwu\312'Z\314\001"
+	.string	"?\202\210\2008s3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bLIS3MDL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMC5883"
+	.string	"\007AK89675"
+	.string	"\bH\005NONE"
+	.string	"\005AUTO"
+	.string	"\016"
+	.string	"<\263\216+\331\261\311\r\330\006H\254\232\035\024\366\003\231"
+	.string	"\\\363\314\003d\3563k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.189.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \303U\005"
+	.string	"t\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\252\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\370\325Ry\276\002\005\001'7\by\301'?\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005TF02"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007TFMINI"
+	.string	"\007HCSR04"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OX\314\323\016\260\265\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.190.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 u}\003"
+	.string	"D\0068"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\305\334\022}\273\001-\206\b{\270\334Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.191.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \276]\005"
+	.string	"\204\ts"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\253\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\270\336Ry\276\002\005\001'7\206\bw\bu\301';\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007DISARM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005BEEP"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableUnit.192.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \177\315\003"
+	.string	"\344\0069"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\310\254\002}\273\0011\206\b{\270\344Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.193.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"e\t"
+	.string	"d\017\f\001"
+	.string	""
+	.string	"s"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\350\255\002}\273\0014\370\355R}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'?\206\b{\230\355\002y\300\006\005\001'I\206\bw\330\354\002u\303\005\005\001'R\206\bs\230\354\002q\306\004\005\001'Y\330\347\002q\311\003\005\001'`\206\bo\230\347\002m\314\002\005\001'f\206\bk\330\346\002i\317'k\230\346\002u\321\001"
+	.string	"?\202\210\200\310\001g3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\nCW270FLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\027"
+	.ascii	"D\205\252\"\246p/\313\030_\r\002\006\303\252\341\020\3146`\037"
+	.ascii	"\310\021\344\007r\004\371\201\375@~ G\220\037\310\321g~\254\312"
+	.ascii	"\027\254\270\323\266\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGyro.194.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\256\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\364Ry\276'7\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BOTH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SECOND"
+	.string	"\006FIRST"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.195.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\374\022}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\367Ry\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006UBLOX"
+	.string	"\005NMEA"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.196.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \344\375\005"
+	.string	"t\n\220"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\340\257\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\206\b{\370\375Ry\276\003\005\001'6\by\301\002\005\001'<\b}\304'C\by\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006GAGAN"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\b"
+	.ascii	"JX\314cG\205\267\346\231\007\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.197.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 ~\305\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\320\270\002}\273\0012\206\b{\370\304Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.198.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \307\205\005"
+	.string	"\344\ts"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\271\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\370\307S}\276\002\005\001'9\206\b{\by\301\001C\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"\220\344\t\226\200\314}f\255\240\366\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.199.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \313\215\005"
+	.string	"\364\ts"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\271\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\370\315S}\276\002\005\001'9\206\b{\by\301\001E\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007STREAM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007ALWAYS"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\006"
+	.ascii	"\260\342\t\226\200\314}f\255\240\366\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardwareLpf.200.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \261=\005"
+	.string	"\224\tX"
+	.string	""
+	.string	""
+	.string	"M"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\360\277\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'7\206\b{\270\375Sy\276'F\206\bw\330\374\003u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\0161KHZ_SAMPLING"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.201.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \362=\006"
+	.string	"\304\n\216"
+	.string	""
+	.string	""
+	.string	"X"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\311\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'=\301\002\005\001'H\206\bwu\304'T\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bBRUSHED"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nMULTISHOT"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004OFF"
+	.string	"\n"
+	.string	".I\034\313\032$\320\003\241\001\022A&"
+	.ascii	"\327<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.202.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \302e\005"
+	.string	"\224\ts"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\310\312\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\270\324Ty\276\002\005\001'7\b}\301'?\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.203.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \330\255\005"
+	.string	"\264\t\215"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\326T}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'.\206\b{\by\276\003\005\001'1\206\bwu\301\002\005\001'7\b}\304'<\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004RPT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\002T"
+	.string	"\005RPYTY"
+	.string	"\003RP"
+	.string	"\t"
+	.string	"\021\326\020\221@\272j\030R\330\032d\f\b\347\231\007\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.204.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\310\313\n}\273\0011\206\b{\230\334\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableDtermLowpassType.205.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\313\n}\273\0011\206\b{\330\336\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAntiGravityMode.206.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 {\255\003"
+	.string	"\244\0069"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\314\n}\273\001/\206\b{\230\345\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005STEP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SMOOTH"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.207.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \247\355\004"
+	.string	"\364\bV"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\300\315\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\370\347Ty\276';\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFailsafeSwitchMode.208.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \240\205\004"
+	.string	"\344\007V"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\315\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\355Ty\276'7\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007STAGE2"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005KILL1"
+	.string	"\005"
+	.ascii	"\nV9Z\265\330\247\325\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBusType.209.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \274\025\005"
+	.string	"\004\tq"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\370\315\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\206\b{\by\276\002\005\001'5\301':\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.string	"O\221\202\200\001\376xf\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.210.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \230E\004"
+	.string	"\244\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\306\025}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\370\305U}\276'3\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.211.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \250\335\004"
+	.string	"\324\bV"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\331\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\314Uy\276';\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\005KISS"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013RACEFLIGHT"
+	.string	"\013BETAFLIGHT"
+	.string	"\004"
+	.ascii	"8\027\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableThrottleLimitType.212.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\334\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\337Uy\276'6\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005CLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006SCALE"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableItermRelax.213.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"D\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\350\336\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\270\366Uy\276\003\005\001':\206\bw\bu\301\002\005\001'?\206\bsq\304'C\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bRPY_INC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007RP\004RPY"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\t"
+	.ascii	"\217TB|\2121\260\030\020\3163\017\220\271\317\254\033T~\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_lookupTableItermRelaxType.214.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\337\002}\273\0013\206\b{\370\367Uy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005GYRO"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAcroTrainerDebug.215.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\360\337\002}\273\0010\206\b{\370\376Uy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006PITCH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005ROLL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingType.216.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\350\002}\273\0011\206\b{\370\305Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007FILTER"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\016INTERPOLATION"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDebug.217.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \303\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\350\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'3\206\b{\270\307Vy\276\002\005\001'8\206\bw\bu\301'?\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tTHROTTLE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingInputType.218.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\351\002}\273\0011\206\b{\370\314Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDerivativeType.219.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\351\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\270\316Vy\276'6\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableSdcardMode.220.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \275\r\005"
+	.string	"\364\bs"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\354\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\230\337\006}\276\002\005\001'5\206\b{\by\301':\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005SITL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005SDIO"
+	.string	"\004SPI"
+	.string	"\004OFF"
+	.string	"\006"
+	.string	"6\031\363\264\003d\3563k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableLaunchControlMode.221.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \243\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\355\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\347Vy\276':\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableTpaMode.222.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 sm\003"
+	.string	"$\0068"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\225\205\357\026}\273\001,\206\b{\370\356Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\002D"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003PD"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableLedstripColors.223.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`[\001\365\r"
+	.string	"V\230^F\360r\234\016\220\315\204g`53MD\304\351\231\016\274\252\252\225\003\335\030\304\253\273;\264r\322\314\226<\036\211\303;=\302\257\037V\310\235\267o\360\323\311-\352\222\203\267\326d\352\304\311ki%\201\036{\257\200?\311L"
+	.string	"L"
+	.string	"N"
+	.string	"\f\252\n\226\351ZP\337\001\\\243\351\032K\364~\352;d\3052_\252\023\275\b\352\033+\3212_#\004z\r\324\267\210\210\b\240\027\017\022\350-\251o\001\037\221o\376\207\t\031 0?\\\202\244R\367\031\336\024\350\315\3247s`~\207<J\336\203@x\037\251\013\026\016\360aD\031\243r\251;D\0313~C}gp\250\314\225*D\3575\3247\200Q4W#\206\372\326\314\020M\226j\205\336W\250\357\2061\232\254\226\372\226\037\221-\304\331j@/\251\276\347k4[\001!\222\323\nID\241D\247Lt\020\312H\242\312(\013\231N\031\311"
+	.string	".=\020\2312T\251d\3120\346x\334'\374X\273\t\341\203x\210\2178\211\233\370\211\263\336:\212\247\370\212\002\1779\213\273\370\213\307\270\214\323x\215\333\370\215\347\270\216\007\3149\321:\023\311\026\344P@\2227\366\323\260\335<\355\363L\006y\272\316\246L\333\341:L\262g\355\267\205\240\307u0\366\264\224\223\016A\224\215\3530\266\t:\223f\320v\036NA\310\371\264\215\bk\240g7\255C9\035"
+	.string	"6\263\2562!\363rQNk\020\236\303l\b\362\003Y\202\374~\232\007\371YM\226 \347\254\214\203@"
+	.ascii	"\341 \223\251\f\203@\2622\032d\r2\007Y\203\314A\326 s\237Y7\250"
+	.ascii	"\374\006P\004"
+	.text
+	.section	.gnu.lto_lookupTableGyroFilterDebug.224.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\324\027}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\317Wy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004YAW"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePositionAltSource.225.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \250\335\004"
+	.string	"\244\bV"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\340\372\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'3\206\b{\370\325Wy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\tGPS_ONLY"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nBARO\bDEFAULT"
+	.string	"\005"
+	.string	"LU#\342L\355\323\352\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTables.226.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`\213\005\035\027"
+	.string	"\226#\213F`\232N:\363\322\325r_\263\3102\024\374\022\3669n\311\313\274\005\374\2274`\332\270\250\001~^\035\277@Bn7\002\226\316E\006\377\"\203/2\370e\203gX\323\004\334\320\260\226\322\207\321+\321bm\242(\023\t}"
+	.string	"~"
+	.string	"w"
+	.string	"w+\021\231\364e\216\212w)\\\200g\002\337\345\312\240\356\004\276\314\006aP\340\273\347\340\013\022z\371\324\007^\214\370\362A\330\222\224o\237\032\001K\372,J\307\013\370#\201J\372*)\320\333\334\231\360\206\3147\220\202\224\364m,\360\035T\273\210\255E\026z[+<hx\341\321\322\247\271x\361\223\204r\322p\341\t#\373T\301\265\3455\223\311\247G]\250s\242\341\205g\321y\016\217\002\326\257\347*m\254\260,f\377T\240"
+	.string	"Uc\271\314\002\n\230J\033\bY.\263M\353\323=\322\366a\226\317l\340\232a\200\016\264\242\025T\177\372\206\032j\005\201\032*\263\025\355\240J\200\306\006l\007\327\002\355\304\001_\245j`\260\003\276\3125\250\351!_7\365@\234\017\371\272\255\b\376@\240\367M\275nB\240W\342e]\t\255\021\221\257\334\320\336\210|\347\022\244!\221\257\235\002\275\022\371\006\215\243s\364\216\346\321R\375\243\251Z\355 m\325Y\255\325[=\244\211tW{a\350\257>\322H:\254\305ZI/i\262.\353&}\326O:\355B\257Y\310R\3028\265)l\351V4*l\353\3246K\333IU\266\262u+\217\016\023\254l\355\326\2351\255\242\275S\205I\266P\273\\\207`\\\250\325S\215t\025-S-\342\225-\223\207\353\013\333="
+	.ascii	"-\004,\007\247\321\b+-\035\233\232\2220\361\250\302H\\:\"\241"
+	.ascii	"D#\023&\032\r\235\310\025IL\304&$\222\211\330s^\355k\207\362"
+	.ascii	"(W\336\355p\237r+\277r-\217;\227w\271\334\347\276\036\314\305"
+	.ascii	"\234\356v\277\373\230\347\335\314\227?s4Ws\346\371\336w6o\363"
+	.ascii	"7\367;\340\341\\\316\347<\360\202\235\354\030-\243g\364S\327"
+	.ascii	"h\033\035\025\200\205\2501\220#X<\373w\020C\251\242\007\020\020"
+	.ascii	"d\030\273;J\023x\310i\344\357)\214\264i\230\302l\304\353\366"
+	.ascii	"H\251\236V%*\362\231p\020\332\364~d\031\211\243\352\320Rh\217"
+	.ascii	"\215\265\324\2561Jw\"#l\240;\022|7\337\236\241\257\225\236t}"
+	.ascii	"G6(\372\3511\257\234J\263-\225\244\026IR \340\344\3772\244\242"
+	.ascii	"X\326UQ@\211\331\364\021\252\216\bA\217M\303.&4E\310\301\321"
+	.ascii	"=\356t5,\350\251\r\020\202\333\244\243X3}l\235\005\336\330F\016"
+	.ascii	"-\355'\371Jf\003\244d\336\033$b\242\026b\006\005\033\016\307"
+	.ascii	"\023\027\325\021uv*"
+	.text
+	.section	.gnu.lto_valueTable.227.3d179887d19a4281,"e",@progbits
+	.ascii	"(\265/\375`\"\203\005\231\001\n<\316\202Z0\nI\2729\263\017\357"
+	.ascii	"0\336h\266\016^\334\277\322*\200y\177\273\223\nh`F\306\337\035"
+	.ascii	"\335\331\316\252\220\210j-G\016\335-\233\331\332\236\302\315"
+	.ascii	"pa@ X\004\240@ \020\030\002E\2532\\\327u]\327B\307E\205Z\005"
+	.ascii	"\025T\320vUM\232\250\211\250\233ZKoJ$9\b:\bP\b?\262_\331\217"
+	.ascii	"\271l\373\346\322\220\r\376\376\243\342\004\365\213\362\223\362"
+	.ascii	"\003\373M\271\277)6\364\202\277\377\276\236\242\236lu\375\270"
+	.ascii	"\362\234o\016\245\264^IJ\212\352*\013\013\r\311\252\n\303\025"
+	.ascii	"\023'(\251\250\274\350\233n\303 \370\373\257\311\324\022\222"
+	.ascii	"$M9\3167\353\2063\2160I\240Eetd\354\335\325\277$\244|\350\233"
+	.ascii	"\315!\016\374\375W\344Gd\002'U? \277\241\237\220\037Q\207\277"
+	.ascii	"\363y\345\340\357\277 \347\023\253\035A>z\004\235\361H[\300W"
+	.ascii	"\277\0338~~9r\234\277\023z\243\370La\311\240\361\233\221\363"
+	.ascii	"\374\035\321[\325\223\365\333q\361\342\307\223\017\375\235\321"
+	.ascii	"k\244\005\213\234\251\367\365C\353\340\233\2440\246p\365OE\016"
+	.ascii	"\222\017\024\277\023i\234\223\237\210\037\211\022\277\233\274"
+	.ascii	"\350\357\230\257\f\370\373o\004\326\223^\032\336\317&o\031\366"
+	.ascii	"whc\352\315+\342\316\327\314\231P\035\"h\311\321a\361\325-\341"
+	.ascii	"\376\256\316\255\002\177\367\315\241:[[>6\267+\276\267\374\307"
+	.ascii	"\337\271WmP\270|f\276*\306\336]\355K\363Y\031\341\361|\\\"\360"
+	.ascii	"w\037\232\357\214\202\223\253\313\007\346\033\363\221\371\250"
+	.ascii	",\323\036\017\310\315\001\177\367\211\371\302Z\272\240\364\234"
+	.ascii	"x}E!\352\201\362\026\236li\031\255p\022\305Ge\205u\205\344\226"
+	.ascii	"\250z\377\013J*jI\366xKe\352\215\020\357IJ\223\222$bsH"
+	.string	"\246\2740\262\244\304dK\002{\013FE\210\240\231\025\205\275\205 D\276\241\345\331\343\251UQo\204`@\304\372X\220\217\036\027x<\267.\370\273\217\307\230O\016\240\237\013<^\\\026\016\013Tzf\324\240q\201\307\253cr\201l\307\2051\205\253}/|<\027x\274\246PI\013\037\0137+\003\323w\302\227\302\247\302\227\263l\373< \241\020\n\re>\021>\022%|79\211\317\023\272\200\277\373Fl0k\342\371l\362:|\236\220\320\346.\202\263*:,u9\316\347\031\265p\360\367>\207\352\240\261\275\301]\271?o\251\005sk\313\022\200*\377T%\255[Y\302}\236X\353\004\177\357hVzpde\314|\350\363\324\332!T\306r\246W\252\220\026E\n\330\224e\332\347\271\255\2517\355\215/T\347K\355\311V\027\327\b\237\027\327\336hIY\243\272\312\302\352\360yuW\254\252r&4\t"
+	.ascii	"\017Oa\353NPRQ\035P\247 \026\f\376\336\237\252\264-!I\322\233"
+	.ascii	"\226m\250\223\320\362M\275a\245\340\357\375Hg\262\342F\344(\251"
+	.ascii	"#\345;\250\323\022\273TD\355-\b\321\020'1vhh\355\n\217\036?\272"
+	.ascii	"\217\274\007ub\262@Alp>9\200\372O>\204:\241\261,p|\265\305\365"
+	.ascii	"\314\250\321i\344G\250\223\032+\002\376\336e\270\311u\026\335"
+	.ascii	"E\177\321y:\240Nuk\033\374\275\267@"
+	.string	"\223\336\346:N\2161\305Rw\235\256b\004\324\251\271r\301\337{\212~\202\204\216\"\377\226\226+t_}\204\261wW\367\233N\342F\237\202\326$\360\367.\242\207\330\340\363\272,Mc\357\256\356\345\341\345?\350\223\320\252\003\376\316\241g\207\206\345\212\034]onI\207>\021\255#\342\340\242\224e\261\262\326\326c\353\200>\031\005\335\324\322\262\314\354\250\224\031\323\274\272wfv\243OH\301/&\331K\2355\243L\t\353\201\345G\350\023Z\260J\312\0273\355\256\tL\317\t\335\333\352\342Z\302\241Oq\301!\360\367\236V\357\t\t\350\324\004B\270\307\253\272\352Y\345<(TP\020\210\352\363\240\244\242\204\\<\331\364\230\232\214\017U\367\224\364\222\344E(T\\p\004\374\275\207\244w\244n\b\"=\201\3243\322K\312wP\250:`\335Q\210\036\321\020c\232S\367\214zE7\n\325\004\222\301\337{BD\374"
+	.string	"\"\204\026\005\177\177\250\021\275\035\275\240\036\217\374\007\215R\003\376\200\277\277\024\t\034?9F@\243\334\200,\340\357\250\323\r\r\0335F@\243\342T,o%`\364\304X\302\241QuaZ&X\270h\261\204C\243\232O;\035'\205\212\034\237\037\360\367\036\n\337\211\336M\317D\257\004\220\272\003\177\357\221\370\241\350\331\030S$u/D\017\304\bhU\320\257\016\376\236\346\251)\2624\355\204~R\260"
+	.ascii	"s\342\346\344\210\220\300\005U\260\271\265-\341\320*#9\365\346"
+	.ascii	"\247cm\325A\263R\005\351g\342\214]A\205I\266\244C\253\226\260"
+	.ascii	"\2507\276\263\261vG\n\330\224\245\035Z%\266\274So|S_B\026\\P"
+	.ascii	"\272\230>\266\334\026YN\232\240\371N\300\337?*\027Q\343\202\312"
+	.ascii	"*\255\312\177\320*\265\31665\344y\212J\241r\036h\225[\237\202"
+	.ascii	"\277\247N\271\210\032\t^\244J0\351\022\235\0361\246H\3524I\332"
+	.ascii	"\264\314C\253\342@\2507\335\007\374\375d2\345\"(P\300\001\206"
+	.ascii	"W\021\244\243\234\004z\025TB\275\351,\210\304H\201\320)\221\361"
+	.ascii	"\355\352t\210\220\034\007\275\022B\241\336t\022CA4H\363z\202"
+	.ascii	"|\364\310s\3202\246\216z\323\213"
+	.string	"\343!#\007\320O\276\203\226\251\265Pozh8R\037\341\3473f\030\277\251Nk\320\310\207\32027.\370{*\203F\312\202\307\370Pu\n#}\221\017\241f='\370{\352\"m1\201\257Fz\202NS\030\323\234:\325IU\214\200\232\001\365~\300\337+HQL\260\221\222(\221\3360{:\360\367tD*\342\303\267\334\260\243Q<\343K\325\251M^\376\203\252\241\301\335M\221\2006K\260\361\201\203A\343ht\256\216.?B\331\210\230r\250\215\024K\212C\215F\331\334\332r\036\264\r\r\206z\223r\301\337\321\265\336N\016&\215\232\031\321\263\032\255\202\226\367\240mn3\324\233\224\n\376~6\225\3455j\264\362\0339\016\026?\350\024\032\r\033\023\313\217\3208f\272\004\226fy\030H\tJ\024\257\374\007\215\213\323\241\336\244>]\250\216\016/'\306\327\252Q\255'9\0174\256\256\207z\2036\233h"
+	.ascii	"6\361\034v0\253\214\017U\243WV\371\0174\256\tD\275A\307\340\357"
+	.ascii	"(\025\005\230\220\200NU\300\002\377-<\320&\032]bD\235j\024\352"
+	.ascii	")\037B\345|\204\2507(\026\374\035U\202&I\363\362z3\202\222\224"
+	.ascii	"\230\226\210P$Fz\f1*B\304\b%*B}x\001\031\n\202\204\342\020\372"
+	.ascii	"\241\203G\217\240\016\250\334\022\232\003\177Gwt!\324\006\352"
+	.ascii	"\203\346@q\334\250\234X\035\374\035\275\361\003\202\276\3501"
+	.ascii	"\276]\215\316\220\221\027\241rhD\324\233G\203\277\2431P\030\031"
+	.ascii	"\200AP\235\235\026,\324\274V\004\207N\244@\221\037\241rny\222"
+	.ascii	"z\363S\360w\024\347\275\210P\033\230\247\243Q\021FtD\215\336"
+	.ascii	"\240$:\240rq_\004\376\236\001\r\221+\325\200\310\231^)G\002\201"
+	.ascii	"\227\256\0252\007\363t\364g1\276]\375w\315\033\225\253{\034\360"
+	.ascii	"w\004`\241\251\013A\t\237\323p\207\250\321\357f\374\267\372\341"
+	.ascii	"\256\214\200\322\305M@\275y\023"
+	.string	"\360\367\264\215\002k$<[\005,\360\326\304\371R|\213\357{OE\021\363\254\n\332\005\320;\037\f\2507\017\002\376\376fe'k\0246&v\243w@T4\216(\021\257(R\276:\240wB\033\200{E\262`\276\t\375O\214\257U?\327V\007\364\216(\003\352\215\004\340\357='\032p\363\362\362\362\236\203\357{\357G=z\242\177\312\370T\365[Uq"
+	.string	"\275C\242\242\321\001\365\306\001\360\367\267a\342\001\250\370\243\344\227\"\316\031\336\023\004\024\351-\370\276\277\022\314/\321\217\304\370M\365+I\202\200\303\371I\356\336\355\306^\f5mln\376\304w\031\365\006\205\277[\360\022\370\276\377\021\232\232g\nA\t\252\215\211\020\017\370\316\301\347\276\357\bx\330\367\375\274\340\344<k\t\004N?\204@\204B\367OA\313"
+	.ascii	"\307\307\023\252\203\026\352\340!\334\221\037\375\0245\f\262"
+	.ascii	"\300\337\205@\302\037\037\224\r\237\0339\317Oi\252\325\210!\224"
+	.ascii	"!\354\311y\036\314\007\0030\030RB\026.\204-\2000h\002\177\027"
+	.ascii	"\3560I\241B\230\223\017=\230\032\006H\340\357B\024,h\341\215"
+	.ascii	"1\315\251\205&\204%:<\230\033\006?\340\357B\0224#BPBN\225gD\235"
+	.ascii	"j!\b\241M^\364`q\030\314\200\277\267x=\262*"
+	.string	",vm\226\373\301\3520\270\201\277\267uV)\013\272\205\223\213\313q\036\254y\001\026\370{{\345j\255\215-\250\212Z\233\206\365\333A\267fhgB^e\314\234\tM\372\215\310\n\033k\305\362\242\017C\272\200\tX\023\035^_Q:|\330\322\005D\340\357-\024'O\266\264\226i\037&vA\016\370{\353\344\211\025V{\265l\3730\346\005)\252\250.h\241C\240\244\332\250\245\335\207\241Y\320\006\177o\237Z\241-$I\332\246\016\037\246f\301\027\374\275=\3222Y@2\322&\215\360an\026(\201\277\267G]h\022\335\266Fm\321\022\356\303\342,\020\002EI(H\013$\037z\246\217\005/~xy\355\bjy,\323\236\td\201\b\035C\350\326\307\370ou\233\243\305\021T\301\025\370{{\243\255ABk\243\nE\373\226/\024\216nc\030\323\234\272\225\321\366\3448\317D\252\240\f\376\336\302h_"
+	.string	"\245\354\264hY\344<\317D\253\240\013\376\336\256huh\370<<\245=\221\242E\241\326\004\177oq\300\332\0217-\211\234\3043\335*\b\202\277\267\"\302\360Z\0336o\031\366\314\270\nv\356\304\352\262`\311\177<\263\216\2029\370;K\327\373\032\013\273\022\007\227\347<\263Y\006\177g\337\324\330\326|\270\322\254\204\240\204\317\311\312\214oW\263g\254Y~\364e\024D\301\337Y&K\2462\301\214\250S\315\212\205\005Q"
+	.string	"\004\376\316N\361\235eP\242x\t\321\200\277\263]fYN\214iN\315j=!\242"
+	.string	"\005\374\235mr\236QY\261U\035\276\314h\002\272)\264\247(\026\352\3762\244\t\250\300\337Y'$l\022\266i\t\367eK\023H\035\361\355Xa\217\222\224\214\210\035!I\220\266\030bT\224\347|\031s\202\035\360wV\210Z\272$\024\204\005\222\377\3702\264\tP\374"
+	.ascii	"\366\200\tR\321\354\216 \226G\376\363ej\022\264\301\337Y\035"
+	.ascii	",P\013\333\r\034\254O\276\363e\022\220\331x\245\266\244\236\031"
+	.ascii	"2r\236/kn\305p\333\241\331\026\306\207\252Y\036\326E\236\363"
+	.ascii	"f>\0228\301\337Y\026o(\214l\212\232U\301\346\b\035\301\3377\260"
+	.ascii	"'\256\260 h\226\204\361\337j\266\004{C\324\003\376\316\216`C"
+	.ascii	"\220\300\212X\336\330|\213\257\005\256i\374\267z\305[\357r\234"
+	.ascii	"7[\222\200\006\374}\265[\263\344\"\342V8z\225\243\233\313y\336"
+	.ascii	"LL\002\025\360\3675N.\211\315mm\273\377L,\002,ks}\214^\321\254"
+	.ascii	"\254UF\3703f\004b\360\367\365\214\216\ns%\313s\376\314-\002\254"
+	.ascii	"\261:)`S\362\241?\213\213\200\351\353\304\302\005\245+\337\371"
+	.ascii	"\263\272\b\204l\235Y\262\234\254M\226m\177\326\214`\006\374}"
+	.ascii	"\305:\355\246\252V\252\234\347\325|\"\310\201\277\257LV%9S\360"
+	.ascii	"\310\331t\202Z\237\362\243W\003\332\200\267dU\262J9\357|'\350"
+	.ascii	"\225\311\230\346\324+\222#Aj\360\367u\351(iE\352\360jH\033\212"
+	.ascii	"\234yB\212\326!y\321\253-m\220\"\032\312\231|\315+6>\214\250"
+	.ascii	"S\275\n\375\020\333P\004\376\276\366X\203V\200\3701~S\275\352"
+	.ascii	"X\201\226i\257\306\334\360\003\177_s\204P}\350\265\206\361\241"
+	.ascii	"\352\365\306jc\t\367jh\033p\340\357+\215\364D\316\364^\"|a\353"
+	.ascii	"\013\343\n\243^{\326\030\371\320\25355\320\255XyF\254`\261\356"
+	.ascii	",\311~\rH\003\033\374}\325!\201&\255'\326\024+\212 &\374}\305"
+	.ascii	"\271\031\262\2160\006\205\324\353\315JB\b\n\374}\025\261\206"
+	.ascii	"\320P\342./\210\227\363\374\032\221\206\251\246\t:,\301\272\374"
+	.ascii	"\350\327\2144(\315\341\350x\203\273\202\244!\b\374=\350\226t"
+	.ascii	"\"mMmI\303\217\025\0246\312\316\314\304`0Sd\205\215\21115\344"
+	.ascii	"\200\345\274\360\372\212\222\357\374\032\232\006\020PT<\331\n"
+	.ascii	"j\3458\277\246\326\022\347D'He\205\025\274\312{~\315\255\245"
+	.ascii	"\n\374=X\265\256\200\222\212Z>\371\265\2700\370{\360i\247)\230"
+	.ascii	"$/\372\265\272\026,\370{0\310\2243\005\217t\266\251\207Y\354"
+	.ascii	" \031\t&-\237<[\313\023\374=xT\004nAd\f\n\251\203E\301!\367\263"
+	.ascii	"\005\265\020\301\337\005\020\034\n\006\211\300E\017\343G\325"
+	.ascii	"\301 \233PK\f\370{0\310\027\306\363\243#\b\224\347<\033QK\211"
+	.ascii	"\034/j\334\260a$G\003\3063\351 \fc\352T\007{\2021\362\242gC"
+	.string	"\312P\366\202'g\352\221\271W1\330V\030\037\252\016\262\b\356\344C\317\306\314\360\004\376\036\324\311\225T\344Lj\220\034\t\004^\274\036\324\206\016\342\240\b\236X\206=\033Z\206%\370{\320\204\214\240\210 \211\340\2108\"\370{0\204\335\214\273< ^\276\363lu\031\200\340\357\300&\320\316\346a\032su@\272\034\347\331\232\031`\300\337\201r\300\270\032\276\036\032\330\366\346\346\223a\004\233\215*iV\226i\337&\204\341\r\355\207\2273\275\322\r*\032HV\306$\212B\305GiJ\030X\316\363mL\fUR\276R\034^\\P\272\320\266\200Z\275\317\221\205\325\004\230\225\347|\233\032\006\241\253\037&T\300\251\374\350\333\3340\324\220\002Z\362\004tZ\206}[\034\006%\257\203\t\t\360\310\b\337Vwami\307Q\022\3222\355\333\232Q\340\357\300\"\317\243\005\r\024R4d\231\366q>QDaA?\200"
+	.string	"\205\226O~\316g\271\245\336\\`\202\277\003}"
+	.string	"{T\320\003h\207\016\240\013C?>|a4\320\206\361\233j\240\017\360\306\262\355\347\202.\364\300\337\2015~(\305\220\001\354Y\246\375\234\321\005 \f\037\225P\022\013c\232S\003]"
+	.ascii	"[\344??\267d\301\n\374\035\270\003$\205\021u\252\201*\2009\313"
+	.ascii	"\256\237\023[z\2517\026\244\340\357@\024A\200#h\340\215\361\241"
+	.ascii	"j\240\t`\211\345\327\317-\247\2507\026f\300\337\201$\322\272"
+	.ascii	"!\265\251\342\031\325\274\032\b\002h\223\363\374\\\235\205\034"
+	.ascii	"\023\352]\232\027G$G\207\245\016\210nNL\210\312\346vE}[\266="
+	.ascii	"]P\205\2616*C\316\252\244Y\351\360"
+	.string	"tD\025\254\320\212\320!T\230d\371\320\323\031UP\0323\362\222\0026\345~:\244\n;\340\357\352\227\032\205\002\030\221&Z\306t\255V\271\266\226*\264\200\277\253OT'-UE\252\256T\253\274\350\351\304*\210\240\372#()5\252\303\3231)\264=\251Nw6HLH\2224\345GO\207FA\f\376\256\036\201J*\202dDM\272\237N\215\002\025\374]=\372\300H\020!\306\336]\255\026\rqC\202\277\253D4C!(A\315}\337\005\360\260\257\331\343\207\2178\n>\360w5\250\217-\371\374\350P\201\226iOWG!\007\376\256\346\310\225p\344L?\0269\022\b\274D\004`R{\324\031j\r\225FN\342\351\232\023\344\340\357\252\214\250#*\013\027/T\236\374\350\233>\023\314Z\030"
+	.string	"\311/\345\350\250*\362\236o\002M\370\202\277\253)\232T\022%pL\0041\201\277\2537\nH\202\247\332\030S\270Z\r\241\202\020\232p\224\307"
+	.ascii	"%tX\354~Y\226p\337$\232P\003\376\376\253s\300\222\266+q?\270"
+	.ascii	"|\347\233F\023v\340\357\277\267\237[\223\023\232\025\265\264"
+	.ascii	"\034\347\233H\023FTQ\362\364\033\013J\322%\251T\312$\275J\261"
+	.ascii	"\322'\251V\352\225FI\303R\261\264,5K\323R\265\364-\275\222\322"
+	.ascii	"\245u\351]\212\327\023\321\033\321\303\351\235\350\351\364V\364"
+	.ascii	"xz/z2z3z7z>=\240\236\216^\217\236\217^\220\336P\217H\257HO\251"
+	.ascii	"\267\324[\322s\3521\351M\365\260zY=(=\257\236Xo\254\207\326\253"
+	.ascii	"\322s\353\275\365\352zX\272M\007\321Kt\023}E\337\3510z\214n\243"
+	.ascii	"\337\350:\372\216"
+	.string	".\324\201\364\242n\324\215t\245\256\244/\351L\372To\322\235t(\335\253\207u\261n\326\317\272Z_\353q]\256g\351v>\020\276\020>\023>\034\237\216o\205\017\206/\206\317\206\357\206O\207o\207\357\207O\310'\3047\304w\344C\3621\371\216\370\226\370\234|L|S\276,_\023\037\227\257\313'\3057\305\307\364\225\371\324|k>8_\234/\213\317\356\007\342\027\342g\342\207\363\323\371\255\370\301\370\305\370\325\370\331\370\001\375t\374~\374\204~C~E?#?\245\237\222\337\222\037\223\337\324\257\311\317\311\017\312\317\353\027\366\023\373\231\375\316~k?\266\237\334o\356\327\374\335\251\"\324\021\352\t\025\205\272B\335Qa\2501T\033\352\ru\207\312C\025R\201\250F*\021UI]R\225\250KT&\352\224\212\245f\251]*\0245L\025S\313T3UM]S\341\32485\213j\007\f\001\024\001\304\001\236"
+	.string	"\352"
+	.string	"W"
+	.ascii	"y\200/\2003\2004\2008\2009\200<\200A\300 \300!\240\021\220\b"
+	.ascii	"\320\bP\t\330\004L\002\204\002F\001\253\200V@'\300'@/`\024\240"
+	.ascii	"\030p\fh\006<\003\252\001\327\200W\200p@,\300,A\233 \210\340"
+	.ascii	"M\260D0E0'\330\"\350\"(#8#\350\023\304\021\334\021\344\021\024"
+	.ascii	"\n\002\t\032\005\211\004\225\202K\301%A\247 \223\340T0+\330$"
+	.ascii	"\310\025\354\nJ\tN\tR\t\222\005\321\202U\202l\301\266`\\P.\230"
+	.ascii	"%h\267\332\254 \326\022\253\2115gU\261\266X]\2542\326\031\253"
+	.ascii	"\317\212c\335\261\362X\201\254AV\243\225\310jdUZ\233\326$k\324"
+	.ascii	"*\265Z\255W\353\223Uk\365Z\243\254a\253\330Z\266\232\255i\253"
+	.ascii	"\332\372\266^Y\353V,k\036k\303\232`qX\035v\005\373\202\205\301"
+	.ascii	"\322`k\2609\330\037\266\007\353\203\035b\211X\"l\021v\211eb\225"
+	.ascii	"\260KX)\226\t{\305b\261[,\027\373\305Ja\307X*,\032[\205mc\335"
+	.ascii	"X9v\216\265c\233-\2106D[\2425\321\346\264*Z\027-O;\243\245\321"
+	.ascii	"\376\264@m\217\326G;\324\022\265D\332\"\255R\273\324*i\227\264"
+	.ascii	"L\332\2516\253m\322r\265]\255\224vJK\245%k\253\264VZ\267\366"
+	.ascii	"\255\235k\351\332f{'\f!\024!\304\021\236\020\352\bW\by\204/\204"
+	.ascii	"3\2044\2048\204"
+	.string	"9\204A\302\036\302 \302!!\021a\021\341\222\220I\250D\270D(%d\"\274\022b\t\265\204[\302/\241\024\341\230\220\212\020MXE\330&t\023\322\t\353\204x\302<w\204K\302=\341\242pY\270-\334\030n\217{\303\365qw\270<\\!\027\210;\304-r\225\334%7\211\253\304\225r\231\270Xn\226\273\345r\271_\256\024\227\314e\272U\\+n\233\353\346\312\271sn\323\275{C\274\"^\023/\316\253\342\325y]\274<\357\214\227\306\373\363\002\275>\336\037/\321+\344-\362\036\275K/\323\253\344]\362J\275L\336\253\027\353\345z\273^)\357\224\227\312K\366Vy\255\274n\357\333;\367\322\275\315\367n(b8bxb\210b\270b\2703\2041\2141\2741\364\031\352\030\356\030\n\r\201\f\207\f\213\206H\005\0302\r\217\f\227\f\235\206L\206S\303\254a\223!\327\260k(e8eH\205"
+	.string	"C\264\001,\255. ec\"\304\003\320!egf\313\264\257\252kb\322\220\205\240\204\317\303\306\304\202\206\340\357C04\311\353+\3122\355\255\210"
+	.string	"@\003\312\223\255\241V\236\363VF"
+	.ascii	"@\001\177\037:\351Ya]ux\253%\272*\252\t\035Jj\030\225\017\275"
+	.ascii	"\225\330\007eO\276&%I\320\266\220\374\214,)ux+\265$ID\216\206"
+	.ascii	"E\362\242\267r\373@\210\021\220jH\bQ\207\267\212\373\240\006"
+	.ascii	"\374}\030d\330c\370c\350\343~\253\346\007&\202x\344L\276&\006"
+	.ascii	"\244u\230\303\370P\365\020h\370\223\223\370+\037\017\334\340"
+	.ascii	"\357C\034=2\226\306\320\306\260F\236\363W@\036\204\301\337\207"
+	.ascii	"3\206=$\fex\210\361-\255\213\341\213!\317\262\355\257\204<`\002"
+	.ascii	"\177\037\266\030\262h\021\346\fu\206*\226i\177\205\344A\021\370"
+	.ascii	"\3730\205[\302\210:\325C\234\241\211\016\177\265\344A\016\370"
+	.ascii	"\373\360fH\"g\372\235\260\361\352\320C\233a\210!\210\034\347"
+	.ascii	"\257\324<\340\311\303\3330\304b\227\345~,\"\017l\352&\300\311"
+	.ascii	"\275q\367c\031u\220\006\177\177\257P@u\350w\255\355e\313I<\326"
+	.ascii	"R\007O\324\3228T0C;\313y\036K\255\203\2472\346j!\314\210:\325"
+	.ascii	"\357\330+\226\357<V\263\203$\370\373\013v\301\353+\212O\007="
+	.ascii	"\240`x\262\365j\345G\257\005\324\201\f\370\373\353\344\315\""
+	.ascii	"\341mR\202\226P\006w\t\375RYU\005u\200\003\177\177\247Z\236\242"
+	.ascii	"^\250\274\347\265\2268\300\203\277\277NH\222\274M9\316k\211q"
+	.ascii	"\360\006\177\177\217lHR2\302\034\203\277\277HED\214\320\262\340"
+	.ascii	"\357\357\020\t\230@\206\336 y\321k\251q\320\004\177\177\205\262"
+	.ascii	"x\030\323\234\372\355\021\224\363\274\226\333\020\370\373\273"
+	.ascii	"\343\325\321R\360\276Zq\034\340\200\277\277o\r\022^8\242\024"
+	.ascii	"Y\025\244J\364\013\303\370\306\250_\031=y\316k\325q\260\002\376"
+	.ascii	"~.y\221\327x\313o\3448v\214oW\277-^\0269\317o\tq\020\002\376"
+	.ascii	"\376\256\270 \tEN\n\242\267\023\030\274$J\2747y\316oq\020\203"
+	.ascii	"\277\277#td\220gDG\324/\210\327&\037\372-\016Wx\032`\261\313"
+	.ascii	"\262\204\244\216\216\335\340J\034\\~\364[b\034\210\340\357\256"
+	.ascii	"\032D\315es\327\362\242\337br\360I\343\240\236\321\256\031\332"
+	.ascii	"Y\216\363[h\034Z\300\337\3352"
+	.string	"\016\304\250\270c\313\263\337\252\343\200\002\376\356\206\271Sr&\027\fH\004\004%\212W\336\363[M\0166]\036\36481\242N\265\253\365\304G\016\376\3566\371\240\352\312\n\b>\243\232\"\001\235\232"
+	.string	""
+	.string	"w\311S\024T\020\234\005\177w\235\216\270M.\222|\347\271\204`'\370\273\313\004\202k\204d|\251\3325\342&\3458\317E\004\037\301\337\335#\227\b\tn\021\032\337\222\201"
+	.string	"zL\356\220\361\233jW\210K\224\343<\227\021\354\003\376\356\006\tA-\322\343\207\353#\377\361\\H\260\016\374\335\r\332\371\321\341\002\345=\317\005\217\310\201\343\035"
+	.ascii	"\r\033n\215\234\347\271\3046\230\203\277\2733\\\031C\002\360"
+	.ascii	"\300p_\344G\317\305\334\340\f\376\356\272H*\200\233B\307\230"
+	.ascii	"\346\324\356\216\273b\231\366\\n\033h\301\337]\025nN\005\032"
+	.ascii	"\030@=+\201\343\232X\206=W\334\006L7\007\360\355\320.\bW\204"
+	.ascii	"\033\"\377y\256\272\rp\300\337]\033\004\330\3355Gx\256\346\006"
+	.ascii	"&\262`\261 \001\302\267\2709\241\334\b\337\345\243A\033\334\225"
+	.ascii	"\0138P\200\032\333\032P\2234+\030,@HV&<\023\232-\261\276+\250"
+	.ascii	"\211z\243A\021\374]\310\364\200\001`bay\316w\031i\220c\n\\\003"
+	.ascii	"\204\\P\242x\345C\337\205\244\301\212.'\0278\240\211\361\241"
+	.ascii	"j\341\023\241\223e\336w53p\203\277\013\263\036@eU\345C6\325\364"
+	.ascii	"\024\005\225\343\274\224\f\270\340\357B\247$;\264\020I\222\246"
+	.ascii	"\373\245\004%9\222\244d$\037\372)b\031\f\301\337\205H\302\243"
+	.ascii	"\274\207\227\f\031b|\273Zh$,\312s~\n3\003\033B\210z\347\213\362"
+	.ascii	"\030\023\2215\367;\f!\204\0171\"P8+\320\3105\361{\342\304\031"
+	.ascii	"\177\261\347\231\244\205s\202\222\3029\3372q\022g+T\300\217\364"
+	.ascii	"\013\006\"Qn\317\0171\361\213ruk\332\306\211D\371=a\344:\b#\327"
+	.ascii	"\254\013#\327n\213\244\217\304\271\210t\241\21721\206\221\353"
+	.ascii	"\267\245\225\367;<g[\246)\332r\314\374\201\276c\027\031\027\236"
+	.ascii	"7\235D\272\347q\236\211_\210q\322\226]\330\223h\307E\272\376"
+	.ascii	"\005O#q\216\t\236\355y_Xqv\256e\373%&\332wL\337\267\255\341\f"
+	.ascii	"\2361\304Vi\023m\341\204\363C\314\205\363C\314\006\\F\211\244"
+	.ascii	"3\31434.\317\320\366\\\274g$\f\222\216\301\223\311\372\216\211"
+	.ascii	"\266\004\347=\3176\314\\\214=\320u<\243|y\317;\366 #\307\036"
+	.ascii	"\344z8\027\223\265M\313\024 i\342|\313x\260Y\017v\2053V\016\317"
+	.ascii	"\367$\022\345\270h'"
+	.string	"\211\263]\301C\322\305H\224\217.\255\007\271n\317\"R\256\353${\3264\312\2708\023\22157R&\236o\231\341I\301\255i*\234\367|L\262\347,s\224gl;I\214\355\030\334u\317\032\3718\301\002M\362\030Gp\316\266L\221B\006#\221\306\357x~\221\357#-\277\264\f\317\t\266\234t\211\2210\364Q~\217\262KM\303\260g\rN\023e\245L\214q\331\245\365 \327\027\216G\231\027\fH\272\276p\323\367l\317\370]\023#<\355\031\237ka\313\314\035\317\267\314\213\333\363Q\216q\331\205H\241B\215=\343\270\354\022\317D;\371\322RL\322\366\254\304e\027\372=a\2204\322\226i4\234G\231H\343\264M\214\355\344Kl\313\0247\254t\261=\355\231>*i\374(S\277\262<\037e\342\315\236\370|\277\274$\343\031\\v\241o\032\271&V\322\307\227\f'M\362\370\036e\033\227\231\221qq"
+	.string	"\353Y\034\200\205\223&yl\317\030\030:\2468"
+	.ascii	"\341\\\034\300\360\234\357\243\2142\266g\0349\023)\3244Jwx&g"
+	.ascii	"\354\371\216\213sm\313H\231\230\266\361\t'n\313\370\035\303 "
+	.ascii	"\351\3708#\221r\f\261\245H\327\261\035\203\253v\314=\343\262"
+	.ascii	"\275\266B\"\033\\\317\244\322\303\034\323\3105\300\225\275c\032"
+	.ascii	"\271&h\224g\333%\226\225\270++q`\005\f\307c\322~\207\247=\343"
+	.ascii	"D\331\226c\2101\236L\272\314\366p\306\345\242R&>\312\264=\337"
+	.ascii	"\027N%m\214kb1\226\251\351\365x\224\353\233\305\345\030\277\345"
+	.ascii	"\227X\246\246'\324\266|\323\305\tgm\3131~\333\364K\214L\306G"
+	.ascii	"\231x\341\264\347\"=\223\264\225\361\255\204io\331\345\216o%"
+	.ascii	"\314{\026ed\227\370V\302\b\317\344|\244\2172L<\3372\027\316\231"
+	.ascii	"\210L\306s\235\214\211\361\371\316p\3423\312xFFzH\036]d\342["
+	.ascii	"\t3\001x\026\221\262KQ\236\2131\215\\\323\236\305\371\266\347"
+	.ascii	"\231\331\246\221k,\234u\0229\027\343\373\236\211I[\031\027i\345"
+	.ascii	"\004\344<3\333\312\r\026\314\270<C\343Dy.\306//\311\331(\343"
+	.ascii	"q\215L##e\354\017\316\271\226\221-\222\376\020\023{\220\353\370"
+	.ascii	"Ey\214\2215E\013\024\212\303\n\347\207\230X\204\t\347\207\230"
+	.ascii	"\242\033C\304\223\310\"\205\"\255\214q\331eFx\342r\\\244\225"
+	.ascii	"\0250\324\340\364\214l\303\3044\216\224'\024m\231\306N\276\024"
+	.ascii	"\347\371\005\003\221(\007\2130\303\263xL\306\3343\235T\342\363"
+	.ascii	"\335r\3165\215\257g\215|\234\213\354i\241\302{\326\330\363L\222"
+	.ascii	"8\333q\314-\333DW\306\223\356\311\016)\234J\231\"\222\246iO{"
+	.ascii	"\306i\366lk\231\273H+\207\347\207\230\370\276e%M\362\030\323"
+	.ascii	"\3105\356\351^h9\357:.\312s\214lL&\217\032\316\233\366 g\260"
+	.ascii	"g$-\333x\234\264\211\362\004%\255\252/\252\222.\376^~J\332w\372"
+	.ascii	"^|\026\316\030\034\0069\333\370\215\341D&i\234\302<3\037\331"
+	.ascii	"\023'\316//\025p{Vz\230c\374H\34312\371\201\266\2231-\303\tv"
+	.ascii	"\322\266\347\f\347\313K\022\227!\336.2\2053\236o\031\n\247\007"
+	.ascii	"\3718\3331\215\\\023\027g\\\266af\034I[X\331\223F\256\t\342w"
+	.ascii	"2\3512\234)\3121\222\256\343\".\243\304e\222\261\235\304\223"
+	.ascii	"5\205\023G\312$\211\363\221~I\332\3128\211\313\310\370|\317v"
+	.ascii	"L\223<\036\345\r'\216\234\211\366\254\264g\030\030\332\306+\200"
+	.ascii	"A\312\024N$-\303\304\307\244\215#\223\3048\206\210\224\221\217"
+	.ascii	"\025N[\236\221\3641\306o\031;\006\027\2368]\323\307x>\342x\322"
+	.ascii	"\216\301c\0349\3237R\266\361\226\372\210\267\247\207\371\250"
+	.ascii	"\224)\276\034\345\230\270>\342\356\211#\351\270\266\345\243\034"
+	.ascii	"\343x2\306=\353#\036#\351\270H+\327\343q&\316v\205\r\307Y\346"
+	.ascii	"\305C\315\207\230H\224\225\307c\322\316p\302 \351\242<\307\024"
+	.ascii	"ep\032?\312I\332\226gZN\030d\362\030\343\362\2618\317\312;.\""
+	.ascii	"e\2226L\005\347LD\312\370M\027#8q\344l\3332\304\031F\306\217"
+	.ascii	"\311\231\230x\317\265\322\336@\274g\f\354YY\317x\\\234\217.\362"
+	.ascii	"M\027\343\032\033\237\353\3718\343\024\234\305\031\307\2113>"
+	.ascii	"\0271\024m\231X\274\331\363&\322\370M\3432~\307\306[\306\337"
+	.ascii	"s.&\353\030F\306e.\256g\f\021\247i\356\370N*\r\020\317\270l\017"
+	.ascii	"\317\231(\3330qm\31312\031\3334\312\3419\343\262\035\317\037"
+	.ascii	"\350\232\306\225\311\330\236\2172\3059\206xg8&\211\370-\363\201"
+	.ascii	"\242\034\323$\355Xy\3271n'\2255\362Qy\323\305\rH:.\316G\341\t"
+	.ascii	"C\277 \223\304\366\364\220t\211\2234\222V\006\317[\306%\246\225"
+	.ascii	"w\034s\313\307"
+	.string	"\027\341yo8\217\362\214=\343H:\306\225\365\214\343r<3\027c\234F\322\030\234\310$}\333\363L|L\022\223x\322Vj8g[\006\227\347\227x&\3223s\221h\017C\b!\204\020B\230\2255\370-\343\342\236\267\214\013\255\274c\021\342\244]\003#<o\231\b\020E\240c\021\342\244]\003#<\357{\266\213E9&\212@\307\"\304I\273\006\206\302\211\204\241\217rl'o\344|\307\"\304I\273\006\246\302y\317\270\f\222\256c|\276_^\222\361\214L~\230k\032\317p\336\270\214\337\276\363\306c`\350\343K|\224\361$\036\337\270\214\337\025\316;\236k\032\217\2172\236\304\343\033\227\361\233\302Y\307\370M\027\343\243\214'\361\370\306e\374\246p\316\265\214\354'1"
+	.string	"7\f\222\306\361\371\006\201>\022A@\322r\r\002\321\276A\b\200\2063\251\234m\020\360d\322\006a=g\242-\223\274c\374(\307\310$\215\323wRY\341\374%\357\364W\217\365]\017\345\247<\330Sy\262\267\362i\037\367r\217\367yh\t\324\004\232\203\252@]\240<(\r\264\006\372\203\002\241>\320\037(\021*\004=B\221\320#(\0224\n\225B\261\320,t\013\345B\277P)(\025\224\f\265\202\246\241o\350\025\024\013\232%\005\221\206HM\2448\351\212t'\215\221\366\2446\322\033\251\216tG\372#\025J\213R\2434)5\222\006\213Z\250\364D\236\317\341\360\360\300\205X\t\004\002 \bHs\0304(\212K\003A\360\245\007\024\200\032zxD(6hT\227\021;H`\206"
+	.string	"`\007\177\213\340Pu\355<\342`P\343\322\251\316\355$\257.h:\177\251\310J\030\353\317\341\370\353\031\303\236\034\3344\2349\221\321\254\316\245\214.{'\331(\fdrjD\227\252SM\002\335\334\356\271\356E\005\216o\260W\333yA\nt.l\027\304\260\204am\037\274\335K\250\003-\226/\0366\026\223\365\3244\005\\\tY\204@\275\335\331\221_\\#9\035\267+GN\341\234"
+	.string	"\031T\303\221k\365\326\300\233\226[\f.!\032N*tR\377\212L*\237,4\224\244e\004\257Q\325\020\201\n"
+	.string	"k\256\262\f\331\263\365r\005f(%TWI\340\206\034:x\034\242\236\001\262\b2\007\222\203\035e\365\001G\302\225\371\201.\264\320R\305^\2455\2129>\232S\371+\013\254&\223\022\357\365\363R\216ix\031&)\344o\020y:_\2428\021\372\307\017\324\362\2153\236\204\236ta\002jJ;\202\221\217z.)\021\021V\377\203\312\310\362\243\236\326\001\377l\337\362J\276i\322\t\n\r5]\006\"\345W\277\277\201\342%\2064D\264H\315\2253N\346\326j\252\250\303\031\2636\231\331"
+	.string	"\327\324\3159\235pj\220\362vu\2475\023\250\315<A`\212^p\350\270\342\226\250M\323y\3650\322{m\022\\\331t\033|\005O\377\276p\033\355\371\355\0332\303\2418nk\222<)\313\2711\351\370\217I\253U\216n"
+	.string	"\235\223\216\313b\215\234\232);\002k\020.U\016\273\300Mhe\033\354\223\031F\377?\335\237d\305\275\343\211&\031\316v\310sN\t\206X\307\235\037\312\305\036`\246]\346\302\363\303{Y2oA+|n!q\250\f\244\273\353\356DR\034-c\272\275\215\375\027\311\355\033Zj\300Wi>\262\004:T]\375\r\b\215\247b\222l\327\200\215\212\254j\220T|@\232>\204*\221\371s\226P\326\\\033\303\243\327\366\027\003\034\202\223m\261\250R|\353\211\260\352g\320\375\214}\334\360:\f\276MYNa\244\020+\255\335\3445\272\346\"\235\242\017\367\365\342\237V\177\2018\022\224\200\017p\250\203?j\"\373\327K\343'P_\334\361\214\002\203\353\\)}V\315W\214u0;\2564\034\330H\264X*\326\253*\310\216R\017K\016n\232\t\314\033\346a\322\375j\211-"
+	.string	"0\261\254c\266\245LK\207\026\242\342Q\323\r\323\300\275\3308\212\336Pv\355\203w\345=%\217\372E"
+	.string	"=\002\376,\321\215\220\2576\b\tw.\377\371l\311\022\361-\212l\326\376\231\212d\325==\177\242\270\004"
+	.string	"\201\263_\001E\261Q\255\256\222\360"
+	.string	"\231CuB\375i\267\022\231\226\236\351Iu*\311n\237\230\205\302\243\200\241\211\254J\005^\024\017\231\241\253S/u\272\017|\216\346\004\005m\352\204\216\273w\265r\353R\240\317\243k\312\205\026rN\"\013\303&`H\371\307\202\260\347\326A1\031\223\304\355B\226\233\234\242\354b\227T\262\310\254nL\262\200\342\0250FX\032\340\231\366}\370:O\217\\\224c\363V\252\343"
+	.string	"h\241p\240\346:\005\267\334NH\013w5\002\275\216t\177>\210G\001rN\345\214\233dG3\344\03286\377\252\217\335\370a\3218>:\017\335\205*/\252\376\004\374\277G*\334\314\220C\220(\002\364\354os\037\3352Fd\364r\363\260\037\034\207\374\203\346\306\333\207[\020+t"
+	.string	"\367\347\3750\031\334\217\215\335`\373?\231\253\221\354-\033\255\336\035\016\315\211\204\301\274\017a\230\376\376^\372"
+	.ascii	"7r=X\377\307\356^\034r\377U\212 A\343\256\2326\310\343\351\302"
+	.ascii	"\004\304\236G\362\316&\365\306\030N(\315Jw4)u\257Gm\246\275\275"
+	.ascii	"Ed-zM\312\215\206?\227\247J\017\021\301\021\312\365_k\314\211"
+	.ascii	"\334\232\331:X2\005\bo.\273+\357\304+zn,\003z\274\213\001]\243"
+	.ascii	"\273\263R\241\323\374s\362\204&,\271\3402\271-\351;\234\306V"
+	.ascii	"\246\206$\215\032\242\342\246\301\211\223h\007\226\260\377\240"
+	.ascii	"\272\363\340W\256\342\362\236\367\353+\323\240\003\007\032"
+	.string	"6\236\271\374\001\177\226AU\232\t:\262\346s4\266\204\215\030J\247\036\230.m\310\007\330YX\007x\305\330\002\363\363e\255\337e\262\224|\220\301n.5\316\375\231~s\003\035\321\323s\230\207\330\205\323\273}k\265\031\3758\253\031\270c<\273/\024\371\002,\340\303\310\312\323\366\230\007O)e\367\322\"\376\207\302\360a\366@a\320\263\230\205\3563=!\275xN\037\022\334Bc\311\177[E\024\254\177c\305\343}m\261>\266\254r\336\222\316\204M\315q7\203\352\202\032\322\372\202\224\363t\226Ul\262\201\3214\375\264d\b\013/u\201\221\022\203\t\321\377_\305L\331\f\027x\312\344\252\023\005\302\307\201\2320\232\f\007\250O\214\346\231Ow]7\376\037\327\364/\332\366\353\224C\020J\242\025h\320\032\b\211bI\336\n\260\332\246\364\304\001\326\247\243\b :\251\201\211\332b\3757\344k\325Tw\001-\022"
+	.string	"\320\2171\205\003\312\326\325\305\217\270\3440\213\344\2505\024\366h\247\264Xw7\2165\017b\3456Y\033.\200\365j&\201\312\310\tn[?A\274\263\352z\327 \260\370=X\267u\364\b\247\0359g\221z\257r`\021?\341\033\332\352x]\234"
+	.ascii	"\213J\020\"\241\315\262\266E.\030\326\241\272\221\340\222\226"
+	.ascii	")\243\362H\005\300\237iKnE\332U\262r\216h\255\240\254\264ik("
+	.ascii	"f\324T\224o\217\033\352>\300o\226\231\t\254\267\027\022\200%"
+	.ascii	"\264@\341o\321Ty/\314\233@\275\253\220]f\n{3he\t\\\022\024\301"
+	.ascii	"\214_\335[\276wd\214\032h8\276\026\326\201\240\203\"\252\025"
+	.ascii	">\246\034\274\177\016\005\320\312\356\357\326'\254t\303\r\377"
+	.ascii	"\017"
+	.string	"\001\004A\335`\226V\377\371\206\260\310\335\204\223\b{*\225\304\222\265v\006[\211\262j\350\332\366 \226|>&\322\354\304\0134\016\210\004\037\303\252\372\234\354}G\271\023\226)\253)\226\277\246-\363^\247\034\310\3265\226\232\247U\301\2063\232_\252\334*\352\344\340\226jh\307\217\305\302\260\351\260\260\353w/m\316b\226dx*L\243x%\304\2700R_\341F\261H\264d#\203\315\207A-\201\272\016i\243A0\337\260\347\224%\250\272\200?\271\342}\363a\306\032j\274F\273\002\031\305\220Ng8\320\227\265X\221\267\245\221jM\207\254@\260D\235D\n\202\352\233\357\227)\023i\377\"\234\301\030\tV\377\227\244\b\032M\253\274\232K\004\345\321Nj\346"
+	.string	"K\203\204a\022*Y\253:\264\321\350\344\252\332*0\347li\236\351]\341\216\"\366\351\332\246\240d\023\036\240\036\243\264\036\340\300\256\230\231\004\377\226\347\272\256{'\372$\247~\336\377$\352\336\275 \355!\204+\206\031\300_\250a\031)\372\317\224\210\355MZ'\027JF\304>EH\272\311"
+	.string	":\275\177\026&\037\325D3\205\344y\261\367\310\023(/\n\315\377\255\273o\370Bu<\231\013\322\3756\"xy\313"
+	.string	"\002\376{\2504\261%\022B8wR\366\322%\273 RYq\225\001<%+\033T\241+8\027z\232\245\\\277\244\261qo\320T\272|\004y\317\361\036\315)j\006\367\223\3632\n\276c\241`\\\312\306{\345\2020\347%\247\361\007\177\361\016\250\236\264\\\253\255{\330\364q\203I\r\222\262\027df\002{\370yR\216\376e\326S\324\203\377\342\320\355\314W\036\337\333\3740{:\326\202\205c\306\261\362\337\334\n\032]?I\266'\b\262\fF\370\351S\216\210\355\r\353\300\2173\036U\230\325\301@apo"
+	.ascii	"\357A\251p\370\013E\313\275!\351<\350\2266\226X\025\261\377\261"
+	.ascii	"wZ\245\024\356\275<\027d\024Iq\232yA\005\236Km\005\234\\\314"
+	.ascii	"JP\201S\033\034o\325L8\276\004E\031\203a\023\205\020U\235\233"
+	.ascii	"\354\005\205F\211z@71X\336\364\037\327-0\022\372\352\365\350"
+	.ascii	"\024\353r\325\\[\r\027g\017\343M$\312\272E|\302+KS\241L\220\230"
+	.ascii	"\260\fW\342\332\337\272\342\264{uY\242\250\177,\220+`+e\313)"
+	.ascii	"\242|\277p\r\352\253\013\3010\025\276?\265\002\212\357\3533\326"
+	.ascii	"'_d\263\352\223\222\343T\242k\266XK\243\242k\005y^}\264\264\355"
+	.ascii	"\345\274\003\344\024\364\025\375\305\233C\217\n\254\360%\341"
+	.ascii	"\312}\254]\241cc'\361RM\370/WW\240\232\245\215\"G@\013\247\\"
+	.ascii	"\246\322\357)\2165g5w`\326\216"
+	.string	"\314e\255\314Tzv\212\231\371\03129\255\314X\272\035N\243]\031u h\262\265K\321R\332\261\025\3032exBg\212\265,\220~%\352\232/BW\021\323qSGe\034\004\241^\212)f\377\324B*S\227\021\307]\177\224\237c\332\207\013\033\363\331\253\323\241\264QW\020\256\037\276\006\225\271\254C\352\367\272zj\314W\2639%p\374}y\354\007kK\264{\243\263\332\354\276\221p\271\220\361\\\\h\023\nC\021\316#\233_\346\231Z\206`%\242ZK\314\332*|\226\034o\317\210\355\323\3362\244*\203\343}\366\322\345\2541\r\257\245\261J\352\026\217\211\f\205^\224\002\t\352\372\240h\311C\267\317\377\235\363\301\302r~)\245\306\237\275C$_\351?\201\265\374\f\005\245\253\365\017\001\302\204\230Z\320e'\345\275\356L\340\252\002\210\251\205\r\373\311\373b\243\207*\nw1\245_4\252\314\273\252Z"
+	.string	"~\271\371\271\271\013\225V\374+=\033\003He\337*\277\315\223eM\305k"
+	.string	"8\220\252p\377\335\372o\312\374C\275\242\007_\bG\020$Tqb\317(\022\262\310\"*\251\b{Iw\217\2145\005\334U\360xG\204Q\355\365\f\322\b\200B\275\232\034\325\236\262)\305;\322}b\004i\tW5z\222\271\200[\211C~\232\242\326\360\322\f\024"
+	.ascii	"B\223\373\t\373\252\227\f}v\344\004\222L\004lN\321\023E\333\277"
+	.ascii	"\344\201lN_-\257\007\304="
+	.string	"kx\355%\210\0200\344\306yUMQ\350\326\351v\266\301`e}Q\340\276\021\314pz\251\260B\\\376|g\037h\366\247\264d\357\005\313\006+\240\343W;\377\233\306Z\314\237u\231o\327\361\r\327\265\372mmT|\204C \332<]\255\343\226L\026\372\332\0051=\373.\007\3436\200\377M\nu\207\303\016\242\271\244\301\262\347\3264\247L\001\241\274\201Z\211p\304\224\365\3275G\224j\266\0305\317\304\325\026=\230\033\366\262I\0314\330\266i\203J\256\ri\212\353\307\025\026t\261L\374\277>\230+z\002\333\333Y\216\242cb~\271i\025\013\303\227\361\023\232\344\346\262\211\0072\240\203^\335\265W\223\024\023:\201$\355\016\245\375\031\342\025\340\372\310\021\202\211\304\303`\024\020\370|\271\2607\001\324\0208\231\026\214(\326\231\322\245y\336\017iD\374L\310\275\004\354\254<\340_\005i\273\272\250\305\2539\217"
+	.ascii	"\344\3419\301'M\334Np\231\346\331\325\300!\fQ\340h\210;\225\036"
+	.ascii	"\371\027\270 \223\212\254\314\211k\243\315\274\247\361\025+O"
+	.ascii	"XW\313\343\253\0339\335\356\345\370#\320-%\315\213\232\022\200"
+	.ascii	"\"l\350E\325@L"
+	.string	"$M\251\260a$Y\024Ig\304\257$\226Ky\246\210#\3121y\002\266\035\354BK\214\357\355\243\001z\246\303\273\360\321sg\211\037\251\352\221]J\250\361\334*B_H}^i\\S\203\001\177lu\277\007\213\243l\304\020\262\337\266\222g\\\346\022\357\257f?S\210\315\237\205zT\233R\002'\204\252u;\203<\rq\264\323\003\360\003\032\223\363\034\341\276\362\233\326\256\216`j\274\303\301\222\213\255\203x\035\342\243\227!\373\332bS1\t\316\325\223,\231\310+\334[~\262\343Pt\004p\262\275\027rb2\272\360\210\2653]\346\272\347\255\270\223\226\357\030X\266\204\006\320\362\317\254\3357\323\327\b\270X\230l\205\215\327\036\306\374\266\362\004q\266%p\372\257b\225\326\340\327\005\335g6.\224\367\032\230+\034+_ (-\273\210C^\2222JE\352?\264m5u\310\272\027g\356\331\002s\273\r-\360"
+	.ascii	"\022\354\250\306* 3~\006\023_e==JL\311\021\377_\fB\024\252\253"
+	.ascii	"-?6'\226\235L\271P\222\371l\344\213}\251\223;\210 f\257\354\t"
+	.ascii	"\200\027\334@_`\307z\260\266\306\236\270\220\37179\270<\370\326"
+	.ascii	"\2764\251\341\263\376\261\272\207\017\264\226\376\202]\247\260"
+	.ascii	"\346\210e\341\260q\330\247\343\004\245\225;\261\331\224\256\272"
+	.ascii	"\336\362\235JsE4\307\343\250\241\346\327\355\377X\314\317\242"
+	.ascii	"\006\354\356(\334\322\251K\244\353uR\207\267F~\006w\026KqPl\300"
+	.ascii	"_\324p;{\\@vF\260WX\225\362\316~\341\324\205\265\344\372T\273"
+	.ascii	"\037oL\001\276\254G\r\036\336\301\034\225\245\005*,m\222\360"
+	.ascii	"\013\273m\264\332[\235\2446\0232,\354\304\217\211\346L@\223\033"
+	.ascii	"\363\3646\263\314\306\215\342\301\333\3006\246\304[\007n\251"
+	.ascii	"\316\226w\325#\355j\327\3357\344\026go \003\234\3128,,\310\360"
+	.ascii	"N3\263\350\301\005\304\024i1\023Y\340\006\205Sw\273c\311U\324"
+	.ascii	"\372B\210J\351B\303\371"
+	.string	".\b\322\253$|PM\246=If\326[v\234\227\335\034\272\310\007\217^J5\016_8\274\r\033\356\310_hT\r\322\245\320\265\263\211\004\263Es\356M8eV\261\r\214\234i\325\326\236!eUi\bll\360e\237\313\232\341\253\364\033u+iI\200\203w\321\245u'\311s\240_\360J\263\037\315\265\352\360)\363HX\346\004\377\350\031}(\027BrL=K\030"
+	.string	"\356\f\365g}tmv-\3653\032\334\323\202\251\205_}\324z\027\262E\223\fyN\320\004A\005\263\327H\036P\347\225\377\327\276:\034S_c^\036b5\227\225\317\220\205\2710_\235\255\232\366\277\2253\004)HZ\030\302\344\334\371\204\270{"
+	.ascii	"\266\244\360V"
+	.string	"\267\346O\210\361\312\001\333\016\363\212\243C|W'\302a|\204\315U\313\343p]@\247$\t%\212\327\3412\245\036\310.\033^\241\020\311(\324\020.\300N\353\016\024o\274\031\013,\245UjT\025\323e\251u\222*\260\242\223\034\033r\021u\360\255h\266\311\036\2478\310K}\267lz\264\320v\003\241PH\315\2253M\2574{\216\020\263B\236NB\256xk\361\325\352\235\213\222\216\266\355\026xS\343:q\036\270?m\206r\217\206){\357\225H\007\320\347U\273\2064\032\321\252\271b\303^\330\204\321\277\314\331\257\314-\206\341\337\231\227\347\376T\334_\200\372I\326s\f\237(Q \246\275U\274\006^\240;\227\206\3528=pL\032\214\250\231j\303#\247\307Q\332*LX\360B lr\266\235vS\020b\016|r\214\320\245\016\351\231 0\316|\274\331\237\212\222\250\211K\240\313\331\fL\036\345?T"
+	.ascii	"\234\307\204Y\267}e@\212A7/\236\374J:%\023\024I\202{Y2\344\216"
+	.ascii	"U\204\276e\323\373\234\024\r\324\323\n\342/\033\200\006\252s"
+	.ascii	"2\364\340\252\321\250\202p\205\001\021\201c.\336Z\226\231u-"
+	.string	"\302c${\030\351\264&\357D\322\307\017\204)\275\351\344-\007F1\3424\221\227\365\231K\317\317\036?\007pf\340S\367t\221S\343\0065`\332\304R\260\232|x'\362\333\304\201Wc\351\313\362p\013\305\340|\355\377L\r\034\211A\321sDt\232\3337T\\J\200\370e\360\252\215N*\330\226\360\324\024\244\310c\2134Z\376\0222%-\317\236\342\316\024M\274\322}\362\233\354h\2208\276\216H\270\270\3045\251.\f`\336Gw8\344[\034\344\323\f\303\r\254\332L\215j\344\200\307\360\355lO\027\302c\r'_\234w\247U5\r*Jw\327\312X\021\306\324\261\373\343\223\317\212\316&\016\021\233S\233\005]D\215\267?\017\226\241pJp\301\243\241\006\202\005\240\b\246/}\253\321\202K\263\356\351+\005\243\341\030\004\227\317kF\370C\216\311\336\2425\326\004\241\275\324\216\252\361\344}\240\3368c\261\225"
+	.string	".g)e\203\330\324\355\344\2158\036\r0\216\224\267\377wnF\251\255\201_\236|\200\324\261pC\345`\nk\230\022\t\02613j#\252\207\002\f\370\361O\013\263*yk\245\210Ss*\256\207K\004\336\302~\267`\016\211$\211j\246\254\260o~*EE\021h#E\244B\341\206e\251\372\330\265i\375 '\035U\343G\240)&\013\362\355\351\313\204'W\241\2636d\242\216\021aH\343\321\363\342\244xs\241W\217C\355"
+	.string	"\371+=e\021\331 \362\353|\ni\205.\216\332\257\250X\332?D\255\256\330\215\234\360\225\322/s\003\t\263\0339\361\254\021\224\376\272!e\024t\267\273"
+	.string	">\214\222\271.co\361\346a\027"
+	.ascii	"\221\342\234~\233ch\373\356\366\371\013\364\304\205\314\n7m\314"
+	.ascii	"&\313\277\242\250(E\034t\t1\320O_\016\202\315\203U\037\025E&"
+	.ascii	"{LK\377\204\317\256\024\302;\303\323\325\2545\r\263K(J\363\003"
+	.ascii	"\326\307\207>\2613\310\023\343\247\264c\365\027\nAy\b\210P\240"
+	.ascii	"d\236|\353\354F\254\303l/\335\317\270,O\335`\335\202:\355\265"
+	.ascii	"\306\303\374,U\037\n[N\302"
+	.text
+	.section	.gnu.lto_settingsBuildCheck.229.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 \3005\005"
+	.string	"RI#,pU\323\001"
+	.string	"-\372<u\235p\376\272\305\306I\373\267T \033\266\371\024% \231\3575\005"
+	.string	"\020\364\004\3730\200\200\032\026K\366N)\246\246laMM\2532\235\fJ\255\251h(\205e:\025|9*L\265\353\302T\002\367\3623<$\304\006\271()\366\243\225\237\035\243p\363OgW\022"
+	.string	"\260\236"
+	.string	"\347b\373\2227\033t\320\262\204P\023\311\204vWe\345\333\343\346\037\363A\347q\217\202\304\356:v\336\344\226\267}\260\215\260=\003\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"m\b"
+	.string	"R\21502"
+	.ascii	"Y\222\016\324\n\027\n+\214\206\302j6\312\002\372\377\377\377"
+	.ascii	"\037*=4Z\221\376\377\377\257\252\252\252\252\252\252\024N\230"
+	.ascii	"R8aJ\201\303\356FZ\222\001m\273+Qv\301\346\311M&?\225\354D2\323"
+	.ascii	"\310K\350\236\310J\330\f\031\006r\322\307H\036\037ul\304q\321"
+	.ascii	"\306D\032\017e,\204q\314\305A\026\003U\374C1\314\304>\022\367"
+	.ascii	"D\034C\367 \346A\367\036\336A\367\034\326i8\207a\234\205\255"
+	.ascii	"\260\251p\0136\023f\301&\302+\007\337\030LSpU\n\301T\003\333"
+	.ascii	"\b\\\023\360\f\3002\254\023\177\350\236\366\213\033*;\n]\371"
+	.ascii	"R\3306Sy\301\332V\033{\255m\333\266\265\365T\326\366\253. \320"
+	.ascii	"k\341\201\344\221G\036R[\261$\217<\344\221G\036y\344!\217<\362"
+	.ascii	"\310#\017y\344Qy4\265\025+\226\314c\344\350\255o\331\262\310"
+	.ascii	"r#K7Fd\274\201\344\221\207<\362\310#\265%\235Gw\022\032K>\001"
+	.text
+	.section	.gnu.lto_.refs.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375 [U\002"
+	.string	"\262\205\021\027\360\032\265\006\314\3003\360\f\274\264)\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\2615#\3334e\007\372\351\331vrnjfb^ZVRNJFB>:62.*&\"\036\032\026\022\016\n\006\002f\261Wk\225:\225F\355\356B\001"
+	.text
+	.section	.gnu.lto_.decls.3d179887d19a4281,"e",@progbits
+	.string	"(\265/\375`\3610\345\303"
+	.string	"\3122QBV \212I9\351\276\272>tL\344\326\356\354\316\316\216H\233tB\252 !?bbf&^#\354\236\033S\243\025\263\276\035X\bvc\365T\245\237\fUU,\027h)\r\374\261\273\200\323/\bm\333\212\216^5\230\332E\323\257\007\331#\361=w\235L\276\334R\246w\003\022\004>\004\307[\"s\257\3706\313\220i\225%\004T\206f\307\r\356+\227\310<\307v\310d\265\263%2;@\333\031\347\367l7\355\233\334\264=\353\251kD\216I\332U\2536\017\200\3440\231\341\305}\030'3\331=3W\312.7\311\301\232}\247,\225\3534)\225\312Z\225B>Xx\240aqsX\"\223w\310\374\322\371\345\300\244{{\313\201\371u\262d\337'\311}\262e{\200\352\244\306\210\210\255\265)I\360j\226\016\243\236+Q\276\330t\234 \263\330\211\020\341k~j%\253\265Z"
+	.ascii	"\364F\343L\345N\321TE8\001\316\017\235\277Y+\r\035e\265r\372"
+	.ascii	"1Wg\327\350\007Z\272\033\374\357Z\037B\255\307\2733\311\225\246"
+	.ascii	"\0312\250\377oT\253\321\352\270\3442v8.\233\352\321\314\355\252"
+	.ascii	"\303QY\267&\250\313\037\365\250"
+	.string	"D\032\033i\344\252\254O\\W\365\ti\\:*\253UU\"\215\034\352\323\025\207\243\262\311x\\r]\355q\211\274\352P\237\252\261>5m\235O\310\253c\033\362\212\303q\331tu|\342\272Z%\262.\031-J.cT]6\001\325Z\247\224a\306\237Z\233\254\252\361\215\251*\227\035U\345Q\327\215\211\362G-\252\265\032\317\346| y\224N\325\355\250\004\311\"\252\326\271J\025\202q\215\312Z\253Tu2n\255QJ\253Z\235\220(\262\220kF\312\252\002\325\247\246)'\037\310\237('\244TU\262\265\265\326zu\\\372@\372\262LY\206U'\245q\217S\310\032V\347\270\254\316\245QY\317j\255\333\006h9$k\212\373_\247\177\027\360\263\360g%\016\376\314\342g\025?\037\375\274\201\2375\200\201\237-\360\363\013?W\340g\026~.\3613\211\237%\360\263\n?C\340\347\023\376\255\340\347\007\374\354"
+	.string	"N"
+	.string	"\006\377\331\374\277\373\231\204\237A\370Y\304\317\006\370\271"
+	.ascii	"?s\3603\001~\036\300\317\002(\372\017\347\177\234\377z?o\360"
+	.ascii	"\363\005\377\352\374k\376{\362\005?\177\370\367\003\005\377\347"
+	.ascii	"\376\243\371O\367\257\210\177A\3707\204\177G\370\327\367\257"
+	.ascii	"\002~\366\360s\321\277\026\374\253\301\277\035\376\225\340\337"
+	.ascii	"\240\377\031\370\031\306\277,\360\020G\300\035\230\203\027\013"
+	.ascii	"q\020\003\361\217\n\377J\340\337\025\330\347?\002~\366\001d\353"
+	.ascii	"\337/=?\363\274\303OC\260"
+	.string	"#\207\r\343\007`\264\340\200R\020\250\001\372S\f\274PB\005\b\214\240\r`\363g\235\004P\021|\334?\323\237\377\357\236\036\335\0318\377&\201\341*\377\002\177\377n`\363\376\225\303\311#/\340\375\373\206\211\374\313\244\363S&;?\305\340\337)7\377\336p\236\237V\360/\025\237\237^\375\373\364\357\335\277m\376\255\373w\315\277j\376M\363\257\334\277q\377\232\371\267\314\277n\377\216\371\017\364S\237\177\333\376e\373\267\206\177\261\374k\345_\265\177\323\376=\373W\371/\224\177\311\376m\362\357\330\277b\377*\371\027\311\277a\377\026\371\027\354\337\257\177\275\376\355\372\367\307\277\\\377\"\377\345\361\257\216\177\265\376\315\372\367\306\277U\377R\375\013\365/\b\376\365\300\277\035\370\367\305\277.\376-\376\253\364\357\212\177O\374{\201\177-\360o\005\376e\300\377\264\377e\377\017\360\037\314\177\003\354\355\355\355\375\347\334\277\223\342\327"
+	.ascii	"G\375\303M\025\022n6\302Af\223L\206\343\214\326,w\300\346T\341"
+	.ascii	"\340>\303\375\374\306e\370\013\204\r9\274p\357\024\337\331\f"
+	.ascii	"\305\262\026\225\307\275Efe\333$\263\361\230\0248\324\n\204\206"
+	.ascii	"\260%\017\022.7y\334g1?\203\3416\376b.B\220p\334\213\305w\016"
+	.ascii	"#T\346\312\rE\270[y\226\306\213\027^3\342P\237\340\222a:`\264"
+	.ascii	"l\222\265\360\232\221\262\326\b\2023\202\345\301\322L;\223\232"
+	.ascii	"\302}\346r\376Rk$\032\226\036\267\b\337y\2139\266e\013N\032C"
+	.ascii	"\331$C\341,)(\2531\350\312\030\220\214%\027\022\313\017R\311"
+	.ascii	"\334\024,\334U\224E:z{Gn\340>_\3719\311J\266\362\203\024\222"
+	.ascii	"\321\366E\013w\225\"\n\025eL.9\323\230\206M\262\032O9S\341\263"
+	.ascii	"\027)kU\253\265\252\261\0246#!\312\212g\006\020\036YX\215\321"
+	.ascii	"\340zTm\301\343\261\261\303\212\f\263\257\003v.\207\034f\313"
+	.ascii	"\2408\273\274*\334J\237\254c\025(\334\327\241qr\231\357\034E"
+	.ascii	"'\006\022\215\nw\007;d\202\250Kd\352 u\240v\3256\271jL\306s\254"
+	.ascii	"\225\206Q\022\035Qlx\325J\207\007Bn\344\234mqB\341h\300s\302"
+	.ascii	"=v\366dTC\213\342>WY+\314\004E\255\023\374d\221qc\006\367X\021"
+	.ascii	"\017X\034\031"
+	.string	"Mq\316o\0261\366\261pirL\222\260\022\016\001/a$\233d1\036\302D\270\b\0339z\021[0\314E\227a+H5\261\333\262\\\266K\224\034\331j\021\3430>B\227a\247\024\225'b\374\203\277\3502\214'F\2201\020ET\257\312[\224\2376\343!zhR\332\234{\\\"\263\303\016\201\375<=a\336\344\bSs\276\311\234?\177\261\020z\234B*;\b9\301\352\002\343\311\"'\0046\270\271\213\203\234\275\030He\257\020\220\2656\261\227P^\255MB\273\032\354j\320M|\030I3\373\335v\276\273\234\357\032N\336Rz\020\242B\344\211\253\354\254\333\033\256H\t\261\333c\031h\220\353q\203\263\250P\001\323\342\030lC\212\007km\333\272Qe\330\016\225 C\354jU\262\326\226\3315T\031\266B\220/\036\254\203g`$\347\340\036\274c\223\254\365'\255u\263s\256\310y\331\325ZAx"
+	.string	"\261eX3\3548\0301\016\236'e]\362\304\265\331q6v\276\217`\375,\257\210\240i\23546\3115XFs\r\236\342+Zfu^1\323\023Z\322F\206\243\233\255\224\333\204\r\226\035\367[\352d*\236\261I\256zGA*\201h\323\2150W\214L\24152O\363\316S\270\363T\314y\024\272\361$JO\355<\bo\330)MX\255O\f\265p\330)\006\234\032\273Z\237\376s\024Km\222\241\370\t\004\210\242\236'[\226\310hrre\343&=pSP\2342Uo\220\234 \250u=\230\273\267\267\036\314\323!zhI\326xp\237^\235qV\316&7o\361\276_\226\355\254\254u\t\302\233=\013j\342P\237\240\360\362\026\316\236Q%\226S\006\024\034\273Z\227E @"
+	.ascii	"\3259AA\232}Ju\236\333\234\347\272\363\354v\336]\204\bd\035\007"
+	.ascii	"\351%\016\332\311fm\220\241\315&\227\315\332\255\022D\321\216"
+	.ascii	"\225\0178\\\272\317Q\316\363\220\363\f\344\244+2\203\224yC\306"
+	.ascii	"}\246:/\202\231\031 \304q\250NrTa\265.\317\254\232M\263\311E"
+	.ascii	"\263r_2\373\366UV\337\242\331\271\205\0132*kU\217\\U\325\026"
+	.ascii	"\274Z\227 @\024\201\340y\013[\203v\366W\315\371\335r~\323N\345"
+	.ascii	"OU\325\020\244\362\37429\213\226\310\244;dn\230\025\263\311\017"
+	.ascii	";\206\032\243T2\2409L\346\3109r"
+	.string	"~?\230\273\267\037\314\357\327\371\365qf\260Df\237-\321Z=\341\354v\210\341\376\3568\2779\316\317-\221\031?`\276\224\221\303\335M\276\367\217\275=-B|4\327\032\03754\027{\241Ps\253\273\342n\244\357\275u\"\305\226\370\340\236\240G\363\270\"b\306\f\367\233\307\3376z\307\332\250\\Q\334\2335\203\357\255\203\007-NW\027\356\b\264:\307\234\226\222;\356w\216\277qtV\020\033\220.3\270\027\271D\246\004;d\266\r\337\373\006\r`\364\214p\017a\361\230\237\0356\224\371R\003j'\252MJ\025\032TAp\306\244\330\256\350\215\215\232\353\242\263b:\237\251\2616\267*z\006\264\324\342\0027\343\216\217tU6Tk=^\236\326\342Lq\234Z\2300l2b\2347\240\312rp\277c\374tN\313"
+	.string	"\244\003\311\017 \334wc\343{\037s\200\331\032\"\025eR\321\"%\254\243\224\346V\031\021.\r\325O\325\255\353\255\237\376nj'\366B15CV\035\367\355\226\310\fjc\327.\2634\033\334\357\372\323.\273\245\003{zo\270\351\034\337\351\236\2305\273$\367\217^\036\320\rh|Hq\237\346\3754\006\225s|\342R\302}"
+	.ascii	"1\276\3238sWYl\300\301\343%e?\242(\236\027\n <\320\364xC\335"
+	.ascii	"hm\001\211A"
+	.string	"\335,\255x}\331\335p\367SVUC\t\367\351\335O\331\3206\"\246\204\004\341\276\227%2}\320\370Nm8\312ibWw\342\352\b\034\367i\335Y\220\036\021\031c\270\351\233\357t\315\005U\270d\241S\003e\325\006\305}\252\346\247hh\032s\317\310\035\226%2{\342|\247g|\236\260\322\212\314\311\351\224\035\335\244Q\271\237\306\255\227/\0335\306p\363\300\231\351\033\314\204\251a\346\247o\264\f\234\0256^\334$,\221\271sJ\206\272\371\310MiC\243n?\025C\307\260\027\n+a\314\272\270\215v\310lk\373\212b\033\343r\004\f\214\373A\313-\233\244[([\004V\023\240\322\263;i\320\211Y\033\333\342z\342>\375\362S.t\355\347\211\306\031\0367\355\342;\365\302F\316\300\200\341\006\332!s\347vA_5\324`\344+,\210\n\013\226\020<\242\330\306\200\330X\261\3226FM\215\343\214\254"
+	.ascii	"EIK\343;\272'Qlx@`Q6I\243\320\263\275(6\274]\002\307Vd)\245\256"
+	.ascii	"F\f\356S*?\225B\227>q3\312\224\341\246f\276\323)s\340\3108\343"
+	.ascii	"\026\332!\363\254\025\bK\251\3448\243\031\352\240@\311\n\373"
+	.ascii	"\271BF\306wD\250\2224iB\027\343'kl,\317'OL,\315\032\2377%J<H"
+	.ascii	"\023\3056\246\206\004\t\224(\2661"
+	.string	"#aa\003\230\363\351Q\244\310\220\2520\237\030\024\214\202y\020\203\356\353\213\357\304D\261\215\365\260yy\361\035\317\261\016\300I\024\333XYW\027\233\017\372\203\376\3408#+=U\\\\hwH$\231\027\312\203\3628c\244L\207\016\246\033\302\203jQ-!=\302x\234\262h\026\323\361\034k\007Y\247\232\363\247W\233\244W\364\006=\"k\215\002<1vm\301c:1\257\332b\212p\031\303\2424h\r\376:\253\304\224Y\334\364\350;\305\212\243\264\362\302m\001=\223RU\265#\254G\214\032('\230\324&\251\024\245\252\n\253K\"u#\bX\233\032\367\351\324O\217T\006f\362\025E\206\233\306\360\235\312\340']\307/ns\207LJ\302\211E\353&i\245P>Nx<i\272 \301[\356\300\tQ\243O\264i\247\312\025\336\021n\246\342;u\352\261b\347\244\212\373T\036w\364\346\314\3418\235c\345"
+	.ascii	"\357-/\217\327t\216\265"
+	.string	"\345\216Qlc;jq\342p\234R\016Y\017\234*16\356\357\334\300\303c:zDv\020\366\306n\254V\035\036\364\362\206 2p\337ts\343F\313<\253\333$\327\361]\220\031=E\244\240\332p\237\333\374l\3076\320\270\252%S\270\227\214\357\314\206\001C~4\341\346\f\212\314m\222\347\230.\2058\313\272\"nc\270\317j\030\r\177\351\334\311@\205\307\275_|\3474\001@\342/\006\025\304_\nD\240\nap\005\020I\370k\341\002&\3420ih\302\222\n \211b\322\210 \323\220\005\013\212I\301\b\374\226\\\210`H,\036\t[\374HX\240\202\370;Rab\002\240\213`\361\347\"H\024@\213%\241\n\030 \t\203,\212\303\241\222\211\243\026N \002\205\301\037\321\205!\361h\304\213_\022\260\005\025\210\212A\245 \t`R\2618$\262pA\bX\374\265\020\3030i\005\021\350b\005\013Z\224"
+	.string	"\203\bt1<\002\266\300\202\351G4\241\210\305Q1\030\203\211\017\300\025?\246\244\340/\002C0\212A\027?\"\n\301\242p\004\005JD`\361\204\n\200K0\\`b\372-\3050$\301\224\004\024\n\177,L\330@8\f\026\177I\303%\"\260(T\341\250\205\244\341\321\2608$\262\240\024\003\013g\361A\210\024\036\220Z\244"
+	.string	"\252\bB\372\225\370\035\035\215X\261D\002H\374\305\240\202\370KaH\204AA\322/\205R\020\005\242\263\370"
+	.string	"\210\364+&\r]\204`\"\016\231\204@\246\017L@\245\037\005\200G\304\026C\023D`\021X\242(\004\022\211-\216&\230"
+	.string	"x\024t\001<\341\3050\005\fG\277\244\022<"
+	.string	"U\fK\230\030Q\202\t\"PE\320\305\220\310\202\t\026P"
+	.string	"@Q\bT\022\"\005\223FHP\f\n_\020\022\256\260b\305\n\034\212L'\230L\246\237b\021\310\264b\305\320T\001\204\341\350\267d2\235\b&\035\365\020\177,\216\032\250\364\0236p\tF\261\213\026\b&\035q(\236\020\001\302\213_\t\021 \2640\213\300\023I\021\274"
+	.string	"\252\020\252P\354!\261\324\002\206\3410\311,v\3301\213/~J\264\2040X\"\230t\344A\030T\242*\200B\244 \223\360\205\027?%aP)\250h\216\b&\035\001"
+	.string	"\306\217H\374\351\024\317\202\t\351\227\264B\207\351\204\t$L\004\223\216&\020\006\225xX\024\221\204\300\244\027?%\036$a\220Xd2\213'H\330a\032.\025\203)L\244\340\n\341\360\310,\236\020\"-\351\b\221\226hOQ\330bh\002\fbQ\b\001`R\212\237\013\300\026I?\027\022\024O\214\340+\n\203-\316S\360\341\022\220\030\2428\034\022C\370\334\3473!\203\027(\200\302y\364A\210`\322Q\ba\360\247\024\342\210\310\024\342\003\0170\034\001Y\230\240\")\330\242\004&$a\260X\0042E\360\243 \021(\004\"\235\017a\004\003\214@\302\213\235\2725]ez\364\232\277\3254\035{\241\320\232\233\261\305\275\037\316|\3574b7r\020i4}\306\234R\243\326g\376\226\3539(<\273=n\326\300\316\367\216+k\323\362\004g\006-\311\2216\356\267\231\277\337\272\314\3260`Y\270\271"
+	.string	"n\2767\231&\223{\323\206\333\203\036\323b\204\232"
+	.ascii	"\371\321b\376&\3530>ec\362\230po\330\026\337\273MhG\021c\026"
+	.ascii	"\03063\263#V\334o\266\277g\350/A=\242D\311\342^\253\"\276\267"
+	.ascii	"\227\240+&fi]\326\202\306pp\351\265\277\2674\027\240)fMf\270"
+	.ascii	"\327k\211L\"\034\276\267\226s\316\332\f!5dA\"{\310q\277\263\374"
+	.ascii	"-\244\261\2745}}q\357\331\233\357}E\013\215(]"
+	.string	"\254t\025\032\334\354\316\270\337U\274P\344\311\305\371\340n)\276\267\232\227 v4\244\345\335\341\301\341~\247\375}\326h>2\274\341aq\257\333\022\231\026\210\371\336Tv\276\266\236\f\231b\2465\265\326f\177K\351\245I'\307V\305\275xKdbP\346{G\361\321Sc\323\304}\201\262\223T+M\227N\376\215l(:_XV\336p\357\030\231\357\375\004\310\013L\354\n7"
+	.string	"\2344\211\353\202\"\246\233\\\255\007\326\foL\306\240\352\366\232p\277\307\376\026\353%\354\205b\013\213\262\n\367V0\304\367\016\301O\233\271%\023%\235$K\t\247\223\374}\244\221\264\361H\0272n\316Z\"3"
+	.string	"F|\357\260\0353\033\302T\356\r\2124\2214SpV\270\337D\376\036\322`L\204\352+\215{)\020\342{\177\361\\q2\346\007\267\007\257\016\362\366\243\006\270\016\362\273\211\211\305u5\020\037Vg\032\310O\315VK\204"
+	.string	"\250\262\351<\206Y\304\240\231!\022\221$I\322\030b\n\020\004Cj \267\266\033\022\300\363DKs\220*234\222\244P\330c\016mE\320\376_\312Fw\205\r\205C\001\277\3555\021F=\200\361\317\007gJ\204"
+	.ascii	"\214kY\353p)r\n\377`X&u\347t\311\235a\332 \021\322azb\340\254"
+	.ascii	"\355\267(uI\334\003\\X\220N\235\025Qa8\213\317Q\031%\206\333"
+	.ascii	"n\352\266t\345\212\355Z\215\240Q\344y\362O\322J\305\362\262\253"
+	.ascii	"k\316/\311+\016X\303\272\bn\203\256\255]\030] \277\327"
+	.string	" xvn\343-\244\277\224\321Y8\343\241|\207\034\316Q\214.\353\b@%\322\327|v\252\240\017\027X\\K\023\350\274\301-\322zX\301\302\005\013G\206\320\231\004\r\025o1\325\201N\001\306\277eG\313\376\355<\307\345\314\214\301&\224\n\225\201\bN\2259\220\255\346O*VK\204\260l\017Q\374\316\307\023L\223\306\335\220\r\030\356pH\312\n\310\024E\234\341\003\0059\260\352\240\303\270p*\355\"\030w\300\234\302\310qG\245\372\207@\233\336\223\202o\225/2\216\bp4\350u\035G\210\f'\364\205+\246\021Z\031`\2624\016M\301\250\211A\327;\035V\201=s!B\f\314\314\036\b\213\336\275\f\013Vq\207\301<\322,\\\237\222\031z\306\220\341=\364\377\215^\267\3306\216<\\\313|\360\366\016V\325&7\332\241\246?\274d\006}\262E\374\326\220\220?_\0067e\203v9\037\264\350(I"
+	.string	"<y,\211f\001\253\0219\024#\346\320\314\273\265\207\235\231PP\246h|"
+	.string	"\201\217)G\004\301\004\177\341\332\304\275\316\006\250Wh\034U*\347\245}\310m\306\213\335\311,\221S\t\364\343\261\0342cd\2009\315\311[\260\324$\273~\230\356\224L{\016\001\237\032\314O\234\365\266\362\206\030\b\375\313\2406!Z\322t\n\276\034\314\n3\270AL HRhc\234\355\034\034!\372\251\326:\022\0362*\217q\3662\020\262n^y\232\b\263d \202\254,@\003\214\355B\332b\257\243\177L\377\343\006\024\n\302W\216\224\222\021\037jb\037\352\242\276'\357:Z\324:JM\377\301\322\361"
+	.string	"\003h\\\256\370\362;\270\n\307\2438\203\323j\307D\234\340\213!\223\375\256\2624\234r&(\2704]\251\035\314\037}\025\321\261\350E?_\244\016\206\020\344O\310\245_-G*\312 \236\307'\216\213\306.\360p|\rr\202\347Eb\355k*\274\251\305\310\266r\336\322\365"
+	.string	"\347\227\220\343\200\202\007\272\"G\237!"
+	.string	"ye9\300n4/\272\207\335.s\346\256\211\f\300\335\025\034\277\301 O\200\323\206\237\347\261\374/\261\211\311\364[+\210\270\022\231q\340\274"
+	.string	"nr3\262\202\212\025!\006\220\330\360nd4z\377\311k\356`\026\230\261\322\r\302)}\214\201\261\202\3178\262=\2739\376\202\024$\264\367 t\004\177X;do\333>\027\244^oad\025\345\275\266q\037n\220\202\232u\033>DS\221\350'\224^\020\357\224\333\002\245\303Np\027>\312\002\007\310\305&\033\354T\374\017\t\220\315\204\003\201F\252"
+	.string	"\325\223$L\305/\032\346\376\001\003*\203\024(R\367\244d\346\034a\r\002\330<\225\212I\322\361\272\016\300;\035\352\3148"
+	.string	"\323H\003\026\221\237Bh\211r\243\226\351\316\327H)\270\\\334\261a\354\332@\247\326\250G\216\221*\366\2002\345\361\222J8\0044\020i\205d\252)-\341\241\360\272x\030@\016H\240g\326\317r\326\345\353i\006\370\377\013d\377?8@\330\013&7\230\203\0359\322\300"
+	.string	"%\343\357\t\3604:=_\027\375(q{(2\210\312H\253\n\223\024G\2443\261\357\b\374\303\332\027Fl+\224\332l\213P\306y\365\377"
+	.string	"\005x\340\374\317 \250\362\223\227\017\330>\310\035\2427\317\343\2550\206\207\246\357\322\260\032/'\252\313\376C|1\n=\3112OR\376L\306\007R\200\020\202\020\360i\206Pd\204\021\022\300\002;\tG\365\351.1w \342I|F\f\255\037\341\004\005\310\315m\251\212\026\0340\020\367\b[H\210\214F,\300?\362V\312;\335BD\365\326\332\252\321\001\261\213\201\322\b1\b=\257\"ol\255\230\013\233\360\2076D\356\2350A\257\tn\002\226uY\374?\262\336[7Y\266Z\320,c"
+	.string	"\222'\3329DZ\253\305\257`\377\346\361#\333\313\274\233r\212\365B\025\341\3309\306=\201V \344\246\203\266\027\177\036\177\331p=\261\006[\353+\016\222Q:\240~\223\033\255Ul\214}d2\240\275\274\364\315W\212\244\276\f\247\226\253_\343\232\355C\274\211y]\234>\005\352f@\255u\fG\371\256"
+	.string	"\021\252W-\032\316\002@\013]4L\372\237\360\375m=\023H\271S\240hf\\\336\261\213c\003\376:/\305 N"
+	.string	"\363\300\303\316\324\"x\236\357x#6\257Y\255\031U\203"
+	.string	"\fc\260+\206\257$a\257-\265\370\270Hbd`9!\244b\\$8\347R\320(\027~("
+	.string	"\036\305\2700\001\371U\306\001\237\270\361\364\371\320\336X\266\007\362\303r(\275\334\002\037TA\340w\037\214\365,=\250\356\t\206V\370><\241\310\005N\2330\246\264\237j\b)\017\232\234\354v\321\016\253\357\200? \322\241\362g?j\251#R\205II\027n@9'/x\003\230v\3202\245B@\201\211hi\031D\276\3771N\223\311\036\276\231x\201Q\340P\266g{\367\206\203\231\367\250l\215\205\322\331Z\031\002\324\302\212R\300\254\005\242oX\024\377\370\242c\323\365\312q\361\271\222@T9~\341M\235VN\303\242:\336-}\302\313K\336\206\344\262\222D\215O\003\343\234-\300\301V\367\002\274#\002\321!\027>\343 \342s\350G+I\270\373c\377:8\005\r.\317\241\360\242\266A\fHG{\373R\306\213\200\006#a\365b\360\024\361\022\\\334M\337"
+	.ascii	"S\307w\237\372\016\333`]\373\241A\234/\366\315\213[\250\245\377"
+	.ascii	"\207N|\347\261\227\013O6\3721\350\305\002\017\217<\270\377\257"
+	.ascii	"\341\275\320}Wp\334\351\267m\362\254\245\303\302\354*=\353\334"
+	.ascii	"\252\255\243\232l\n;\251\320\026\235\332\2638\247\301\232@\216"
+	.ascii	")\276\345\300S\366\036i\362#\360\215R/\216=\261\346C\203/\004"
+	.ascii	"uA\221\377Mp_\221\257g\305\257C\017\356\212\036"
+	.string	"gf\237\235\037\235\237\214<\333O,\247\207\277\021\3556\220\315\264\017z9uq\267\336.\371b\367\025\241\260\001\343+\352l0NP]P\333\n'\332\317\257\310G,J\036V\207l\006\310g\341\334\363\273\332\006\236\374n\023$>n\203\357\351n\375\0347\005\356\00431v\260\007\325^W\274\210\334\377\263\261%\321\277\375`}\327Q\3565\313s\224C\375\002\3655\262\341\334\367\236c|\250\356Q\333\024\324C\t\247\317\336\237\036\366\262\017\235\217\377\237\273\212\360\363Np\207G\353\033\346\026\234J\267f\007mA\f\023\355K\316\355\361E\357\212\273\315\217}\356\246)\325\320\376\357\035"
+	.ascii	"\223\333\377\332\027\355\247\312U\374p~pN\241\223\273A\363\b"
+	.ascii	"[\277\216\360\322\3437\356b\0370\274l\036x\357\307#\016T<\022"
+	.ascii	"9\026\335\017Y\321~(\267\\\374\370\275\202-\036\366j\354\342"
+	.ascii	"\260(\276\332\306[\032> 8\274\352h~\254\346\313Y\324i?\306O\005"
+	.ascii	"\026\035\374\326\276\025"
+	.text
+	.section	.gnu.lto_.symtab.3d179887d19a4281,"e",@progbits
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"lookupTableLedstripColors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3d179887d19a4281,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
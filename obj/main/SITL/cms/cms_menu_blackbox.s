@@ -0,0 +1,113 @@
+	.file	"cms_menu_blackbox.c"
+	.section	.gnu.lto_.profile.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.acb3481f8dd2ac14,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.acb3481f8dd2ac14,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.acb3481f8dd2ac14,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.acb3481f8dd2ac14,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
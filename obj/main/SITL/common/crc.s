@@ -0,0 +1,573 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375 s\r\003"
+	.string	"\324\004g"
+	.string	"\t"
+	.string	"\334\206\377\260\007"
+	.string	"\001\317\361\326\237\n\006\002"
+	.string	"\002"
+	.string	"\002\001\002\002\276\361\275\363\t\003\265\212\310\322\f\002\004\276\307\307\\"
+	.string	"\005\277\315\376\324\t\006\220\351\245\372\f\004\002\003\002\004\007\256\306\254\254\004\002\b\365\267\335\206\001\005\002\005"
+	.string	"\007"
+	.ascii	"=\247\270\204\031*<\315K<-\335\265\006\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375 \250u\002"
+	.string	"4\003\234"
+	.string	"\b"
+	.string	"\002"
+	.string	"\003\001\003"
+	.string	"\003\003\002"
+	.string	"\020"
+	.string	"\007\001\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\200\f"
+	.string	""
+	.string	"\b\004\005\006\002\001\002\005\002\003"
+	.string	"\b\001\020\b\006\007\b\t"
+	.string	"\n"
+	.string	"OC1C\276\202\200<\220L+\330;>4\227\001\221"
+	.ascii	"G`\200\005"
+	.text
+	.section	.gnu.lto_.inline.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`O\001\335\007"
+	.string	"\302\213)0`i\223\016\224=\314\f:X\377\3103\002d\006\020%|[\327I!(h\213Z\324i3\f:\fA0\030K\215\257U\251\361\333\023K\210\334)C`\325\004ob#\260jr\304Z`\325\324\230\341v7!\2316Sae\222\300O\302\312\244\202\t+\223\002f~\216\346\017\324\025\301\335\016\224\016\264\0035\322(,\224\212A?#\355\302B\251\020\334\036\346\020R\006\311er\320\376F3\377\246\331\236\220:H.\223\201\241[\241\367.\364y\236\347}l\r\324\025\001\270\237\321|\315\354\031\233E]\321\343\233\213\020# \220\242\222\301;b\0022\r9\200\004\302\344\030R\374\245a\200\206\034\374\213\274\016\001\305\221\330\r\220\314\200"
+	.string	"\005\326\007\f\351\224\007\006\234`\241 fX\270"
+	.string	"\206\030u\375;\025\037\020]"
+	.ascii	"f\017[\316t\022\376\257j\267\326\201M\273\314Z\332\034\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375 \336\375\002"
+	.string	"\242\304\016\030\260%\351\fs8\321\222$\264$I\301a@\007\013\322\b!D\022\231d3e?9\203\260N_\225\023)\315\242]\364\266j\007\253\244\360\024\206\025"
+	.string	"~1a\025\326\360\234Y \016"
+	.ascii	"A)\266\222\007\352aAYO+`\\\310\212\205a\241\202\255I\020&\201"
+	.ascii	"@8/7l\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\200\004\001\205\004\003\231\004\004\200\004\005\205\004\006"
+	.ascii	"\231\004\007\205\004\b\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375 be\001"
+	.string	"\310V"
+	.string	"\006\001\003\200\007\300\005\300\007"
+	.string	""
+	.string	"\001"
+	.string	"\003\002"
+	.string	"\024\005\004\006\007\b"
+	.string	"\b"
+	.ascii	"\300\020\320\017\030\006V~\332\373B\004\b\177\003X"
+	.text
+	.section	.gnu.lto_.lto.7d9ec131d03b45fd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt.3.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`k\0025\024"
+	.string	"\246&\205H\320\360(\035Ca\372\204p\274x\306\2345\376G\362\264\313\225\366\310\360\223\246\n9Y\233\373\346\377\261?\221ei\275o\261I\240g\3529|\341\005W\320\b\037R\235\2059\261/e\204\220\266r\005\375\215\020B\310\2262\245u"
+	.string	"h"
+	.string	"p"
+	.string	"\007\304\177?\361\234\227a\232\3730\243 \007f\247c\316\334\n\300\005\200\377\364*\360\337\342X\274\314\335\241\302.\206\340'Wa\376\316Gzr\304\324\\.\312Pff\306\211f0H\024$\243\f\264ZL\303\0216\007k\376\231j5\227\322@\f\0174P5\n\222\200M\210\346T\223\351\336\347\n\324\213\251\331\\C\006sNkL\355\302=\336\266\006\333+[i\002\266*$\005\"\325\250\217\343~\217\347\376\323w\267\3518\334-\256:\\5\250\352O\325r\325\253jU\365\003\2148TFsZ\350)\315\241\317E\210\357n\237\307\367\361\311\272\367\274\276s\220\234(\032\344\350\034\3159I\376\331D\374'\"o\277\354\223\235`\301\353\271\002\3369mE$\252\307\301\374\315\311A\207\305\2349\023\007G"
+	.string	"\216\233Z\tc\246\024\323\n<$\216\276pCV\177D:\274\005\0047\334\177\013\356\336(\271\334o?\256\334P\266\342&T\350\210\344\336\334\002\356\272tB2M\362\270\273\367\371\310\013\336\362dv\264X\243\326c?\366;O\375\300\324\350\242\326*\336A\340Www3\245\230\366|\332\357\332\200Yz\321\236\235s\321\275\331GA\232\211\360\336\004**\232r\226\213\265f\235\260\\\254\025Kke\245\305Z\261\250\244\254\254X.\t\253\223\001nE\200\340ZMh\265\\\253Sn~ol\031\216\013\002\"\"m\030z\331\230\2707\207E\240\352\001oIInZ\232%(:\300\251\241\037;.\315\274\233vS\364tE2M\272\234s\316po\036K|\2515\201\260\311\220\025\227f\227\334\264\252\re\364f\266\230\366\024\b|/ P\002A\314i\007\023\005>\035\006\352\013o\031\253(\007_\373"
+	.ascii	"\032\302\224}|hK(j\205\357\277,\002Z\371b\364(\267\303\354\036"
+	.ascii	"&j\237\365\006c\332b\251)m\001\360y\332U5\223\332A\3068{\356"
+	.ascii	"\315J\\\262-\326\177\337\306\"P\337\361\267\f/\200\305\377\f"
+	.ascii	"J\336\022x\bh3\270g\f\207\227\030y_\343\367Z\247\245O"
+	.text
+	.section	.gnu.lto_crc16_ccitt_nibble_table.4.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\005\006"
+	.string	"t\b\017\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\357\343\003\005\001\006\025\001\017\316\303\016\255\243\r\214\203\f\353\342\002\013\312\302\n\251\242\t\210\202'\001\347\341\001\007\306\301\006\245\241\005\204\201\004\343\340"
+	.string	"\003\302\300\002\241 "
+	.string	"?\202\210\200\300\002\1773\327\0014\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\314\001\313\001\312\0015\311\001\310\001\307\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\034"
+	.string	"^\020\004\227\201i\340\004h\003\304\005\203\34020\r\\\021s\020\034\313\331\017\254\006\204"
+	.string	"\203\34020\r\234"
+	.ascii	"m\200\270`\020\\\006\246\201+\300`1\257\032@\021"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.5.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`^\003E\030"
+	.string	"\326m\234G\300\226M:\345\214\346\031p\227g\235\231_\201\2612^\364\312?\315`I\310I\024\030\214\230\f\344"
+	.string	"\343\245\243\375P\276\215\215\261\312\342\230\256\242\366\277\344\036"
+	.string	"%\350\020\315R\"4\207\034h\365\240q\b!\204$\231R\212"
+	.string	"~"
+	.string	"\206"
+	.string	"]\320\345\260\216\0373m\350^\221(\305\207\003\241\275\233\356\331:g\033?\276Q'n\211Q\205\023\002\271\260\231^\002\252\027#\n\037@b\314\025\350\200\320\236i\270\306O\2012\247\024\"A\021#\035Qb\314\311^\206\371\354\245a\237\275\257"
+	.string	"\312.\347v\td\257{\002\325oj:\302\005\331\353\300\"\020/Z\270\242\016\247\212*\n\t7\224\235\214\021\276\241\234RH\216p#\234\240\203\030c\363\b'\302\375\334\226\326\266A{\2458JUT\275\212\026\314\332\204\331\032\232\031\031/\331\002\354\344\306\314d\007"
+	.string	"\2631\276a\303\370\311}\361\222\013\003\263.\231m\311\354\313K\256+\263-0\313\222\331\225\314\262\300\254Jf\001d6\f\263`\230\3752\353\201\331.\263\317l~Y\337\270H\3044\305\b\342JJ4\342E\301\260\223\375\344l\177\352\035\206*\253\355\223\317MP\222\030\f\234|\034\fu\200@D\tU\2149\002\366\002_\2219\353\036\023\224\230\253\\\346\206r\013\223?\346M\f\026\242\023\306H\204S\007q\024\205\316-\354\325\302\205\317G\366\352\013\237=\225+`\021\025\336;\200\307z\030\221"
+	.string	"\037\232\207\277\203\217M\271Y\r\371G\004Z\330\242\366\371\354}\217\035A2!t\357^\201\275;8\344f\325\271C\276\374\357\233\024\330\363\337\222|\323T\021\356O:\314c\317#\267\031Cy\325"
+	.string	"\367A\251)#+\241\274jsA\371\244\326\001<\236\260\243\303\323U\350\241\260\243\203\341\313\351\311\231\320\315l\263wf`f\233\311vj4Zm&\333\261\220C\223\315l\032d\006b\255\361\350\330d=\265\232M\306\312Ew\035\354.\3273<1\"\364!\357Imy\360q\232\263<\234H\230\277\034\311P~\340\242\311g\336.\005\034v\244\330_\316\001\207\022\242\254r\027c\214\035\002\277\234\346\340\r\311m\206\315]>\263r\033\t\236\222ry\275\365\226\232\277\262\304\024\227i\276\3575%X\336\352a\231\263\260\002C\250Q8\002\021D\206\002\251\021\t3)\3109p\002\231\272\353\006\020hf\343\fc\322\354\250\207\262;\311I\277D?\244\344Gu\353re)\353\366\212h\277\230C\233\bA\225H\255\021BHz\002R*\271"
+	.ascii	"\260,\233\255\004\234R)\246\244F\203\007\2006\b&\343\3274\035"
+	.ascii	"\2521m\263ee\223x\221r\177auD\265\204\262jJC\220\264\334T\213"
+	.ascii	"i7\371\366`\351Kl\216\016\225\266\327O\304\344|\023-\210D\315"
+	.ascii	"N:\313\201>\354\337\331Y\217\n"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.6.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`\274\004M "
+	.string	"f;\316H\240\226J:\225\217B}h\0058\203n\213\3130t9\250\032\263\243\340\023\370\300\001\337t\262O\326\016\323\361\246\241\255\246\321az\321+\214\227\343\303<\360ozz\355\022\226\227\261\355\356\366\356\332\334H#\204\020\"wJ\001\275"
+	.string	"\262"
+	.string	"\270"
+	.string	"@\017\023\252\304\271\325\032\374\371h \233\0069\264\375\234\332\367\372\215\337qt\270L\255\\?\314j\r*\260\001\363\243\203\257!?\232\337\221\037\177\366\023\234'"
+	.string	"Y\242t\\\251\265\362V\205\315\233?*\006\357s\177\327\2359\263$Gq\351\317\027~"
+	.string	"\026\022\251*\246\353\304\362)\204\213+\241*!\006\301\271\235\335\fHO\001)\254\262\236\023K\020TL\256\204\212\204\030\364\006%k\252\312\211\232)\254\260^^\235<\253\256>\212\005\222\240h{\251\202\022u\264\214\210\320U=QQ\355\364+\306\226\025\326\367fG0|\333\262\312:-\205j\255\246RUV7\200\333vb\373\201-z\b%u\315IM\263\233\311Q\313\224\32410/?\273]\036\374u\007\273\317\343\370\315\227\335\343\305n\261\244\336\222\232\232\324\017"
+	.ascii	"D\343\246I\255!\206Z\352\332x\366\342i\377\331_\366\203\375b"
+	.ascii	"\376\217\247\371j\326\221\375\304\272\003\202\327\227[\255\365"
+	.ascii	"g\354h\266\322\201\370A\366-G\215Z\253\356\343\231OSLu\372\220"
+	.ascii	"\245\244J\027[: \024\347\345\266\3037\263\256\f)\312\320\201"
+	.ascii	"\3711\237\314\347\361\036J\367\3414\237\\\255[_0j\255\r\314\217"
+	.ascii	">\342w\244\222\255\373\370\207]h]\216\353\370]lI\254+\204\274"
+	.ascii	"\26600?\306\320\357H\260\rB\001C(-`\271]?@\356Vg\305\"PZ\200"
+	.ascii	"\364\003\330\f7\022gs\226\222\371\234x\006\362fq\366Q#l\366f"
+	.ascii	"\227J\202\327\254\315~\2675[:\225\335\206"
+	.string	"\217\260$c\006\222f}aF\234(\234wK\263W;\0014\341\nA`\001\"\312\254\27032dQ#bVfM\315;\215\244\033\263G\273\001\240\025(-@:\364\227\356\267D\3055\321\241\375!I=\263\205\217D~\374\336\354#\025\226p*\253\211\0167\350\r\n\306\332\205\232kc \242\227:\227vmYsZ&;\b\244\333e\277\004Ji\363r\331=<O\273wtrNj\234\223\372\246\244\266\t\276$\rKDD{\276\336Z0\272\260I\276\241$\2441\t\311\302\272\267\240\347\353\361\214\216\212\212\216z<#\242\241\"^\317\207\304[\200\343#\r\027|\274\244\243#\037O\027l\372r\331\342).L\204\253\265\246\005Z\206\356V\030\242\227\262\317\3232\031f\027\001\226\020\335v\331%+\367B\341E\034\325\355\230s\331\013/\241\354\b\365\227Hq\247\316\035O\266?\230\002g\342\024\315\335\272"
+	.string	"}\334\027\005WC(\031\271\355r\311V\362H\020\306\355\317wv\312b\331\023A\305\223\235\331\335N\231\310wv\307\206alN\024N\254\265Vs\273\234\243A\352\354\311Bk\314\331\236\235\262\023|gy\266\\\022b\250a$\246\214t\210\b\311\210\310hS\314\030`\002\2312\254\007\020xg\232\f\007*U"
+	.string	"2\254t\naQd<)"
+	.ascii	"\0041\224Z\367\317DX\215-Y\255\013\fS\204\344\221\344\020\254"
+	.ascii	"\336\216\360\277\001\3401\004\266YH\241\034\273\030\335(\316"
+	.ascii	"\376\202\307.\245\177#\361\026\225E\363\206\024O\276\337\323"
+	.ascii	"A\244\330IN\375\312\221\222\241\322J\344\t\001\211\263\005\""
+	.ascii	"S\333\304\200pY\373\243\271[&\002\275lEEw\317\251\240\002)\374"
+	.ascii	"pw-\267\325!\\\360ec\255\2702<\225\n\330`A\222c\212\271\270\256"
+	.ascii	"+\203\035\330\tt\216\2622!@\253\276(F@\177\036$\323\300\370\311"
+	.ascii	"&\322<.\017\by\306\203\226\023\277\365\344ur\247\002"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.7.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`.\002%\023"
+	.string	"\226d\177G\340\360&\035\302\217U\214\304p\302O\350B\324\227`Uv\034\007Je\270\300k?\331\352t\333\215\237\274\033\355\233\315\365\206\272\321ms\216n\260\0160\314\320\006\341\220p\016S&X\340^\316\340;,\022\262\311\2262\245o"
+	.string	"c"
+	.string	"m"
+	.ascii	"\b\276w%\fZ\274z\215\303\214\304\261\340\"\2614g-\334\r\376\036"
+	.ascii	"k\267\247\253\177\236\354\342\352\312\377y\f1\313\305\304\\\376"
+	.ascii	"E\017F\343\342F46\321D)F\206\337\256\257\030K=\235\232K\331;"
+	.ascii	"\216\230\3541\036(\302\201q\212U\210\004n\2060\2001\030\335\337"
+	.ascii	"\256`\206\213\211\325\\=\007sNkL\354\302\275q\333\032l\207\266"
+	.ascii	"B\b\366\207\307\251\003\274\317\317\361\236\177\343\266\373\363"
+	.ascii	"\336s\313Uw\253\216\252^U\353\252\017@\006\025\201\314\230s&"
+	.ascii	"\3274\211:\025\036n\273\375\232\1773\350\2178P\313m\026\372\\"
+	.ascii	"h>\234\315&i\316\031\362\316#\337;\003\027 \337\305\007\220\357"
+	.ascii	"n\267\330\240\355S\340E\210\352{V\3369oD\004\315Y\033q\377\366"
+	.ascii	"c)\314p\255\033\226\346t\205\\\332\023HoO;\340\250\325\304R\031"
+	.ascii	" \020I]\267\036\253'\036\234E\306\355\366.\331n\334\225!r\335"
+	.ascii	"\335\267\232\274\325]\231\2618\217\t\233Q\\\232Y\344We\033\202"
+	.ascii	"Q&{\373\375\355\221g\206\302U\343eq0\032)\326\034\273\261\340"
+	.ascii	"\226\330\344\\2\226\346\354\232\213.\315\276\211R\353\2037'("
+	.ascii	"(zr\224\n\265F\221\240T\250P%\225\222\222B\205*(')!J%!$\001q"
+	.ascii	"j%\202*\234\220J\251B\2606\2779v\364\274\355\3508\254\365C\364"
+	.ascii	"\262\254oi\366\220\344\307\267\264\003\323\220\177\373r\224r"
+	.ascii	"\377\363\257\205N\r\005\327\333\227\205\344\267\rd\216lH0\312"
+	.ascii	"\3648\347\234\336\322\274\240Dw\332\347\354t\210\036+\367e\213"
+	.ascii	"\004* `\202AgV\007\030\n\214xH\334W\326\305a\244\034\272\265"
+	.ascii	"N\201\214\312\247\241\204J\271>\244g\021\270\025\027=\317\026"
+	.ascii	"\3469\235\202\221\330'\240\307\bL\030\334\354\276\253y\205{^"
+	.ascii	"\006\254p\336U\374\026\265=\334\027\274b\215\021\205kx\263C\226"
+	.ascii	"u\021\026\200\315\324e\274t\220\335\032\337k\235v=\001"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.8.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`V\004-\036"
+	.string	"v\370\303L\240\326Q:\002\277\304\035\r8y4\216k:\312\240\240\177\357\217'\361\352\206\344\262))\266l\341\007\345F{k\270\177\335\243\2522\"\261!|-\370\025^\207\327\341\203p\364-(\340\212\n@\373\240\332\256A>!\204\220-w\222\001\262"
+	.string	"\245"
+	.string	"\256"
+	.string	"\214u\225{\215\220\320\020\357R\236<\317R\236\344Z\237\224\343\276\267\310\251\307\275\304\003L\340<\271\240\001\216s'\246\b*\205*|r4\271\227(k\024|\376\314UK<\273:\367\324\205\236fI\332\2569~\r\221\017\020?\017O\255\371!\250\305\201\370\210l\215\226Q\352M\272\352\npB(x\324\232@>\"\007\342\033\2625YX\301O\275\366~\273z\236\020\002\336$\361\322\365#q\322\016\270\022\036y\375xv\246\250JD\372\373P\355\324\005"
+	.ascii	"_\230\020\002\276\337tR\350\"\313\204P\360\325\234p\357\345\n"
+	.ascii	"\342'tF93"
+	.string	"\027a\346\t\314V@\214\222>\351G\257t>\217\3437O\374\3133\235\355\223\316}V\256f\345\317\224L\256f~\334\033t\334\272V\244\224\213K\375P\277\322\317t\313|>\217K\361\2478}\302}\307\243\230o\327\301\357\321YU3\356\275\207:\357\221\251$Tq{R.\201\t%\fa\374\016\376\023\247\267;1\325\351\301w.\025\201\306{o\204\033sz\362\3148\376\322\2338e\342\261\027\030\273\273\342\212#\bJ<\277<\037\332\323\2610\336K\2449\311\016\354\215\027q\307\261\301\306\356N\370\223\340<\t\300ve~\215\333\300\235\030E:\263\207/P\302\372\245e\202\360\266t\365\347\006\222\261li\227\256O\024N+Y\272\245\3573b\245Y\272\227\030\270J\257\364y[\260Vi\235!\037\247\341T\274\"ie\254m\305\252]\325bX\307\372S\2674\206\240z\t\310I\224\355\256\375\352G\335\302"
+	.string	"\036}F\350N\245\001\303y\357\375\n>Oy\262\366}DK\275`O=\326\232,\336Q\367\260\313>\273\016\341\311\320\325#\233\375\346\020\304\362y\322S\217\314D]\355!\363M]\222#\334F\31421\227:\303\274\270\240\225[\320\312,\265\362J\255\254\202V\216\301^)\207z88U\347\025rnt\354\205\035\01397\031J\233\035\233\nvf\2335\317\020\314l3YN\215F\253\315d9864\331\314v\223!\210\341\232\316\215M\266S\253\331d)\261\347\326\325\235\246\375\342-\261\352i]\332C\276\025\322\0234\005=B\342Q\313\266\335c\024\245\331V\264\273\355\251u\tJ\264J\270\354\tk\024\005\267\235\322o\2725\006\217<\031h\017\3314b\306\234Mb"
+	.ascii	"5\315a\272\307\326\224\351G\375\024\362\342I\277\032\326=\246"
+	.ascii	"*a\372\301O\220\242\221]\325\262\367\336{\366\220\031(\225/}"
+	.ascii	"\243\030-H\227\226\351\036\263\201\303tLw\030Z\342\005R\250q"
+	.ascii	"4d\004\312!b\314\310\00433$\256\006`\002\231\302\254\003\021"
+	.ascii	"\3009V\333\264\035{\302\"\033D\347\220\nq\305H\210\2777\265\020"
+	.ascii	"\200g<\2308i\257\331 J\030\272Ur\233\211\235\265\177(r\335\311"
+	.ascii	"\250\211\003?\303?\321Zh\nG@\036\264X\\#\t\016H\336\263\333\234"
+	.ascii	"TjJT6\024\314\217\210\2651\253\243\2606r\365l\3764\377Sg\005"
+	.ascii	"e\026\207\020\267U\352\2367\013\366F\267\030\231\315o\212\230"
+	.ascii	"\330\317\215Fc\200*\255\206\035\347\212\265J`\264\225ZYH\307"
+	.ascii	"\3100\315FJ\204\235&_\372K;\361\f\276\217\243\001\260i\351\177"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.9.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`\234\004\245\037"
+	.string	"\326\371\311K\240\024R:\225\364n\340\204\037Sh\023R\275\034+\275[\370S\270p\361\r\001\031Z4}\274\353\350\337\366\267\310\357\267\f\350\277\313\301\321\315\030/\317\313\361\342\344\275+v&|c\303\206\264S\326\243Ju\304\022B\b\331r'\031\265"
+	.string	"\256"
+	.string	"\271"
+	.string	"g-\206`r\363\312\374\035o\342\335i\304_\356]\242\262\272\267\310\200\021\234'\271x\231\362\344yZy\222y\314M^tqol\032\212\232r\357\255u\013>\177\362\252-\236e\315{*CO\263$mW\036?\352\004\220\234\020\005\177\236ZS\310\004\214#\001\252\2608a_W\247\352U\331"
+	.string	"\026F\303\243\326,\002*9\022\340\221\305\001s2|\326\353/\030TO\026F\302\233)^\312\202)NZ\003[JLZ\202>\013 \311\310\2114(Tm\326\013\b\231V\030\t\337\247:\251$\005\266\302h\370jb\270\367r%\n\032\235W\316\314^\314|\201\331v\bL3+\303\230\225_\320\312.\263\026\226\225\027\177\331\237\316\350\235\376\363V\347\362Sg{\250s\233\225\353Y\371"
+	.string	"\314\341V"
+	.ascii	")\367\232\030\253r\217\220W1\216\365[\375S\377\323\017\305\017"
+	.ascii	"r,~\026\247@x?\376\212\271\347U|!\r\226\004\307\2757\275\225"
+	.ascii	"\275B\013\306&\263\366\034\312\307\201Y\245T\342\253\007\237"
+	.ascii	"\212\323)\235\222T\205\363G>\020N}\\\252\347?x\310\371\003<\217"
+	.ascii	"F\341\327\275\227\302yR\200=\255\354aNO\376\306Gq\312\020$\360"
+	.ascii	"\016\345s^\031\346Q\211\207\204'\020\277> Z\304\345\343\353\336"
+	.ascii	"\342\315I~\0204`\2202m\323?\346\005\247\351\232\026qt\364%\365"
+	.ascii	"\314&>A9\353\231\266\341\362U\351U\022O6\276\312\230\226\351"
+	.ascii	":\245\341\267\222\3261\375!\0240M\353\216\262\340/\r\323\367"
+	.ascii	"U\351\3251\236\365K\363\034i]G\020\343\026y+]:g4\022T\303x\326"
+	.ascii	".\375\254[\035GUCb},\242\"\304v\277[\372W\2673\204cC(z/\362\241"
+	.ascii	"\303\311\327\225'\337@$\255\337\020\250\2165\016\230OF7Q\347"
+	.ascii	"Z!\316{\357\004>\221\035\017\007\\\274\030Q\236D\333d\352\312"
+	.ascii	"\341\004T\307\230\213\275\332D\346\233\275'L\270\227\230mj\216"
+	.ascii	"u\246\231\221A+\307\2405\271\035O\353\350T[\316\326\034vrz\227"
+	.ascii	"\333\260\323\221;\035\207f[\003[\316V\333\301\335n8[mGg\303\255"
+	.ascii	"f\313\351j\rj\030\307\223\223\253\355p\270\\--\002\335\312\272"
+	.ascii	"W2\2508\002\324=\236\325\332g3\333r\352\211X\200P\377\360JW\005"
+	.ascii	"HK\206\304"
+	.string	"\322&2\313\020eA\273r$UY[\264\354G\375\204rC\254\362}\312\356\037\332\266Ou\231\327/@\tC\222\331s\326\345\203\333f\271B\252\362\325@\233\310\246\227YsN\241Q\3247\247\351\037[\323\346\354b\022\353\226\236\365\217\207\2244M\201\004\227\321+\250\206\331{\357=\233\310\021z\2243\375\245]\250a4f\210s\b\t\211\210\210\f%i\f`\002\021:4\017\021\020\272\234\222B\273\001\032^0\322\351F\244\3241\365\325\231\207\370\316\025qTX\230\355\001\341\220\250\360\275?\240\342H\377\206\200\360Y\234w;!\376\020\345\032\025]\023\3038*\216\213yG2i,H\316^S<\210\030o\244\275\037\2116\357tC\217\344\241,\270H\251\222`\273C3C\215\"\364\026\241\024>\355\035 B\326\2464\244\303S\035\004}\221\242*\310\013\003\326\301\r\3073\357\365\315\013g\3429\254&2\336"
+	.ascii	"c_\211\261\fc\206K\223?\362\n\020*'\243\317\004\204\301\n\314"
+	.ascii	"i\215\362m0\031!\247\017Z\242\3118\362\347\3719\217i\304\177"
+	.text
+	.section	.gnu.lto_crc8_xor_update.10.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`\306\001\365\020"
+	.string	"\306\240rF\360\320&\035\372),\202\314rT\346\2232\315\363\t"
+	.string	"Mz\337Y\246:\202i\337A\243\264\254\256,L\321hR\340zf\214\354\245\323\361\303\342cq\030\352\202\320B$\333 \361\204\3233\242]#\204\354-eJ\001^"
+	.string	"`"
+	.string	"["
+	.string	"\316\274\215\312\272\373\002\353\331\375\022\370\300\366\310\240A\312\252\1773-\031\314\n\026\212\031\273\037\247 T\t\277\033\246\352\021j\252|\220W\214\305u\362\b5\225\026\021\034.\025\bRD\344s\330\263\345Z%$\341r=\354\b^A,.\227\247\026aw\235,.\016wv\333%\333\020\354\354\b\206\267\271UKg\226>"
+	.string	"\255\347E\201\235\335\226\030\215\005\212>#\256\363\363<\355\224\277s\230I<%p=tl\n\016\013\232\007:%\337\225\r\243\326\252\005\321\356\347\361h\007\360\304qR\317\311"
+	.string	";6\005F\203\202\355\321"
+	.ascii	"\324\264o\3427\251\177\036z\200\335\030!\217\357\003\262\307"
+	.ascii	"\355\002\262\307)Yt\270\273\013\027\034\352\206\236^A\252\251"
+	.ascii	"$}\fV\207\325S`\360\266\020~I\366\230*\3415\324\372\200\222\261"
+	.ascii	"\324\235\037\025\227\372\032U\323\204\261Rb\2251gz5y\375\260"
+	.ascii	"j\240d\314\376NRe\354\203\314\024\021Yc\354\r\322\3506\377v\235"
+	.ascii	"[{\316\237\375\373\343y\036\247\213\230FN\220\002\311\004\323"
+	.ascii	"\210\205,\204$D\004v\250N\335}t\250\2163y\245\222\327q\246\n"
+	.ascii	"!%\256C]\340>\b\330;\215\2408\022\317Cq\244o\25716\204\252\243"
+	.ascii	"\221r\260n\200Pt\025U\306\007\252Q\241\033z\232\232\227\214\n"
+	.ascii	"\265u\3307\0315.\224\244\206\271\251j\313\2665\205j\202#\024"
+	.ascii	"\" `\002!\265\316\001\226\300\304C\237\265c\263)\324\312\362"
+	.ascii	"v\024\320'fZ\264\026Z\2033\267\274\273\232Z\301= \324\236#\255"
+	.ascii	"X\2348!\300\340\003\tt#\260\303\2572\372\262N\303:\302Z\324\355"
+	.ascii	"\263\335\330c\310\232\t\224m\371\371rG\240O"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.11.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\355\021"
+	.string	"VbwG\360\320&\035\272c\362\207\276\030\264\327\244p\004\271\237f\007\204;\373\310\266\274\216\220g\311\021\245e\365\2064\212F\031\255\300v\272\366\324Q\303\262\211lf\270LQS\375\201^\236x\027\362\261s\356'\204\354-wJ\001b"
+	.string	"a"
+	.string	"e"
+	.string	"\2735=>\273a\002#\340>\035\236\200\366\311}\200\366\351\224=\364\360f\277#\003\006fcw=\345\220\2122\274eL}J\215)\037\366\0034@,W\313\247\334V1\035\002\270V\262\344\210\350\347\262\307\226K\025%\b\231\353e\007\231\251\301r\311<n\016v\327\221\345\302pk\267m\262\335\300\216\020\002\327\271\271\347\374\333|\354\226\347\271U\213\2163\372"
+	.ascii	"\266\"\027\037-vcf86h\376xx\354\327\371y\256\366\355\237\360"
+	.ascii	"e\356b(\326\213!\006\334\347\277s\230;+ I\235g\205\333\017[l"
+	.ascii	"\303\f\022\235\n\337\227\013\035-\225\020\321n\030\362\351\021"
+	.ascii	";\206\250\030!\217\366K\374\225z\016\313\005\004+\232j\213S\251"
+	.ascii	"1\304\016\013\013\361\350rwW\216\\\252\207~\304L\215\027"
+	.string	"\021\2528\263\352\265\323\013\301dP=\005\205\025\316Gi\237\327\313.}ff-\r.q\246\032\003Z\271Tm\\z\017\212\333\335\005>\n\323\204\017\0308,:M\030\335\310q\2113;l\211jc\277\344\346\210\310Zc{t\017\377\216\340\311\244\037\370\351I\n\212\236@\223\223\312<\251\234\250?\221\017\374\274\224\022\211T\372\274\224\b&$\357\003U<\221\002.\231P@\357T*\201^\027\356\265\306\226Ru>\240\021\344\242*w1\352\246\266\004R<\313\006V\332\342\251\021\204f\005L\216\2516\356H\340\274\206b\207Jm\275\214\264\323\303\316\025\275TD?( p\202\231Q\273\001j\340\242\213\"\0357!\320\314qQ\266c\305\030\033KX\031\242\007\327z=r\371FL\004\300\313\220\205\214+%\343\353W\303\232pf+\273\2054\334\035M\223\316\020\0060\274\204\311\303\036\242 \b\216\325\272\362\334"
+	.ascii	"\242\344{(Ys\006\250;\310\033\345\316e\236"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\275\004"
+	.string	"\304\006;\001"
+	.string	""
+	.string	""
+	.string	"\002\003\177\013\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\005\177\f\360\372\250\005\004\r\200\204\001"
+	.string	""
+	.string	"\003\002\006\177\016\354\363\203\007\002\007\177\017\b\177\020\t\177\021\n\177\022\002\013\177\023\001\r\177\024\377\037"
+	.string	""
+	.string	"\200\200\200\001\f\177\025\016\177\026\003\003\n$\003\003\t\344\016\003\006\013\204\016\003\b\013\360\372\2508\001\304\006"
+	.string	"\020"
+	.ascii	"-\242YG0\246\035\240\036>@\220\2774i\004\303eO'\311?N\206NzD"
+	.ascii	"\245G\024hr\250n\001,i0\307"
+	.text
+	.section	.gnu.lto_.refs.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002\013"
+	.string	""
+	.string	"\002\025"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7d9ec131d03b45fd,"e",@progbits
+	.string	"(\265/\375`\373\013\025>"
+	.ascii	"Zlt\027G`\232N:_xL\306\272*\344\037ds\256\275\326\026R'\205\273"
+	.ascii	"\205*\346_\027\306qd\t0\324\2661\332\360\365\373\344\2559^v\244"
+	.ascii	"\215C\217?\270\370\300\206\276F!\327\026\307#\323\177\253\251"
+	.ascii	"QH\"H\332\226)*\001g\001q\001n\242\304\245ote|\340\364\035\367"
+	.ascii	"w\223nk\270vsN\346\234\205z\t\217g\031\234\266[;\351\027B?y\277"
+	.ascii	"5\224\343\034\337\374\342\2627nk8\355\351 \025KX\337\020T`4\332"
+	.ascii	"\020T\234;H%j \265\231\f\337l@\352\262\371f\241\372\327\346\252"
+	.ascii	"\r\247\302'\2045I\367$\r\247\177\257\375\215\244\323\332\tl\261"
+	.ascii	"\334\334\226\363\353\003\204\241\306\027\207\323V\353$\375\""
+	.ascii	"\350%\267\200\341@\326\371\246\345\374\nw\262\262\312\\\234\276"
+	.ascii	"\301\372_\311\00383\206\343\365\215@\355h#P\377v\220\2726\220"
+	.ascii	"\372\235\037\033\320\311\371\261\320\337\005\036\334\312\377"
+	.ascii	"\272\367\374\030(\250\363c\341\337\016\322\037\003\377\366\371"
+	.ascii	"\233A\007-\270\263\211\332\374G\323\n\376/\371\0174\300\337]"
+	.ascii	"\376\357\375\357\277\361\376?\370[\004\316\337S\3766\360\367"
+	.ascii	"\200\277\177\376\346\371[\347\357\234\277\203\177\367\177\277"
+	.ascii	"\377|\377\241\377\363\376G\371\377\364\377\313\177(\377\017\374"
+	.ascii	"\227\373\257\345\377\334\377\270\377k\377\235\377\205\376g\371"
+	.ascii	"\017 \032\215F\177<\364w\373\347|\bL\2377\343\020\312\317\261"
+	.ascii	"\334\276a\314\324\3158\277\271s2\214\311\242}\335e\373\272lO"
+	.ascii	"N\272l"
+	.string	"\316/\263\247m;\262\335>\303\230\355\323e\372\344df\363\363\210cM\272\314\266\316e\366\264\317#\263M\2061}\266v\220uY\2059ot\2276\231c(\275\216\313\036\273\366u\363]\316\335F\225\227\fr\366r\227wG\032\035\005i\027\003\371vt\373\3159\023P\"\305\334\234\264k\207\2709\017A\246\310\312#\366\265\313<\332\216\035\363\312XT9\027P\346\314v\266\3139\2639\347\340\322\353\315\331FOk\246T\346\334\034Rf/V\216*g\334\226\027\205\331>\305\334\241\034\333\323,W\275l\233\345\273\260\345\372d\227d\254\234s\357\255fL\031hp\332\\\332\256\337\242\356\362\366\322_\236\223|\3633G\314\336W\033N\211:HM\247\326w\221*\214F\243\321.\332\242\205\347\307\231\023\211\323\272\241\216\341\205\356\rN\377\264b\351+\375v\226\236\362\246\322U>\364\346\374\226s~\247Y\351\271"
+	.ascii	"\254O\316cjf9\277\277\360\017\263\264\224\236\003\276Br\036\003"
+	.ascii	"\023\262ql4\330\344\374\016E\210\220\"\327\360\352\324\364\033"
+	.ascii	"\326\356i \365I\353\217\326\277\351\346p\236X\370\266\314\311"
+	.ascii	"\341/Z\260\2209\215\347\017\355/t\370\n_\341\252\237\234\343"
+	.ascii	"\272\355\270\326\256YY\265_75\254\251Ay\324\220\200\3452\214"
+	.ascii	"\304H\\\345\341K\217`\023\255\f\217\352\270\212\207\310\022\214"
+	.ascii	"\032N\361\213\bfft8\305\311\346\337\037fqvs6\013\262\211)\241"
+	.ascii	"*X\036\264\016\347c\266\345\326\272.\271<\234v\264\345\220\300"
+	.ascii	"(\251`,5W\323~kOF\352\271\201\342d\361\322\352\271y\373\335\f"
+	.ascii	"0*c\357\rN{M\367\361\340\271hn}mt\314l\354\275\251\013r!\373"
+	.ascii	"\252\340\224MO\371\322\362\241d\016\350LK\243\204o}\243u\243"
+	.ascii	"y\033M\363\345\264\351\026,\320\274\334\222\260\247\366\320\202"
+	.ascii	"L\276\257N\0240\267\255,zz\r\365\220s\006\346\f\306\305,7\233"
+	.ascii	"E@$a\256\236\234yCs\204\270\371\262\302i\233i8\234\347\r,}8\355"
+	.ascii	"2?cL\036Ak0\352\226,\277\276\266\365\035\246\305\274\307\274"
+	.ascii	"=\246\363V6g\366\315YGiWI\330\344\246W\221\220\313\211{\004\247"
+	.ascii	"\235\367[\300\320p;9\247\345\234\017t\026\2145fp\332w\r\027\340"
+	.ascii	"K\b\035\036N\237\006\001\017\03180\\p\372\026[\217\1775\037\227"
+	.ascii	"9g-\2347/\221;j\343t\027\375<\rl\006\031\370\240\273\234g\354"
+	.ascii	"\340[\317\342\216]8\375O\224\177$g\326'\277y\331>\303\330\226"
+	.ascii	"\211\227I:Ec\210 \322pD\223\321\251HbG@\021\312\205P\350\307"
+	.ascii	"\202\224\022S\013\023JI\304\"1*jI\250I\005\323\222Q\251I\005"
+	.ascii	"\023\223\323\323P\223q\311D\324\224\322\317\207\214F'\"Q\tiH"
+	.ascii	",\022uNt*6=5\241X\177\2044\001)\311E\360I\031*d\250\240>)\303"
+	.ascii	"p\230\001i\270\036i\b4*Y\270\360\024\024NL1\255Xj*\032\245\022"
+	.ascii	"\034*\252\251hd\204\202*\032\351\230xj\002J)\235\230b\222R\213"
+	.ascii	"\306(\240Q\ti\270\032\225\222\214ONS\301\017\207\034\210F\200"
+	.ascii	"\350\260\022)\020\213D\243'\250\025+\240\210FONK+\214\210E)#"
+	.ascii	"\nB:p\227\232\257 8\305dG\356\030\316qL\366\027\223\t\375r>v"
+	.ascii	"/\300go2\376T1-`\f#g\252p\030\346J\177\270\331\3619\337\234."
+	.ascii	">pp\301.\037\200?\2641\026\247\370\253\243Q\277/a\373ts>\342"
+	.ascii	"\033\030\354\370\353\275\240{\201\260\004\226\030\226\2326\233"
+	.ascii	"\270\253{^\244\236\023h\243\tC\263\262q\334U\266\205L\013\247"
+	.ascii	"\270F\367\2758\363s\345\304\324\350\305\275\331\332\302\\CkN"
+	.ascii	"\033\222\007\315\321\002\346Mm\3061W\317\005\235|w\254\2100y"
+	.ascii	"iV\234\225\205\265\332\231\340\tU\222#97\213t\306\236<\325`\346"
+	.ascii	"\261\026\016\2206P\354p\212\227\335\227S\004\217\315\006\\\252"
+	.ascii	"\344\254\231\343N\251\314\023v\205\221\302&\200\371\250\321,"
+	.ascii	"F\0244#33\"IA\222t\200\002\221)3\316\001\021p%\224Jh&%I\233\001"
+	.ascii	"h\025\030?JPs\276'b\201H\241\373h/\323\311\356\330dr-\007al\210"
+	.ascii	"7\367D^X>\327FP\r\0202\353\b\020Di\310U\363\316B\264\347\245"
+	.ascii	"\330-G\034\357?`\341\223\343\274\332\201\026% C@\270\025\200"
+	.ascii	"\344`h\021I\036\261\253\347\362Q\213\313 TjIgR\304\330\225\020"
+	.ascii	"$u\323\276|\235{\323\273T\330L9\305\246tx\373\221\202\275\020"
+	.ascii	"\005xa3\301m\205\274\243\216\314U\300\004)r\256\335\215Z4\332"
+	.ascii	"\204\341g\034\352\310\313\225\336Y\350\305\tZ\270\364\217\220"
+	.ascii	"\320\234\264]I}\037x\025'\364"
+	.string	"\373\330m\233\274g\265\205\337\364\310\027\017\234R\303:P:\374EG\033\264K\300\237K\\\274\006\233\243\031\211\231p\263h\256\013\251\020\251J\016\332\b\237eg\006\342`\232Q\004\215m\r\337\317S(\017\352\375j`\240\006zcE:r\322\307C\233\241\370\002\200| \266d\377\"4\024\217\034\227\214\343\333j\b\340IK\022\274r\212\303\234\b\200j\251R#\364\265V\237\356\215\272\023\364S\214I\004\266\036\303(\022F\211\306\324\356\032\367\365\277\201\356;\225\315\257\321\336\360a\250H\350R/\210SG\374v\236;\214?\303\346{\271[c\352`\346\233\337\003\310\232\265\373\022\372\f\216\232\326#\265\026\275\001l\262`O\336\177\254\223\377y\311\031?\341r\375A\316\345\324c\037\266=\271\266\336\244\256\260\005\370\206\271\032\325\371\312;\351\314\264\373\370\210}\025Z\001\017\257\355\277\177\257\241iHy9\357\221\337"
+	.ascii	"\007\352\262\345UF\311\217{\203^\216E\336\320\237m\373\245\201"
+	.ascii	"U"
+	.text
+	.section	.gnu.lto_.symtab.7d9ec131d03b45fd,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7d9ec131d03b45fd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
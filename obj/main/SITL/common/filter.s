@@ -0,0 +1,1029 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\273\001\235\t"
+	.string	"\024\r\257\002"
+	.string	"\025"
+	.string	"\203\255\266\373\b"
+	.string	"\001\356\361\330\337\f"
+	.string	"\002\321\307\201\370\r\004\002"
+	.string	"\002\001\003\353\220\276\200\006\002\004\263\311\277\326\001\006\005\211\337\230\303\002\006\217\364\362\333\n\020\007\225\326\304\223\t"
+	.string	"\b\206\223\232\231\013\022\002"
+	.string	"\002\003\t\311\276\204\302\004"
+	.string	"\n\245\233\254\343\013\020\013\344\247\274\230\005\f\302\265\230\372\n\032\r\243\352\335\360\007\016\222\355\333\035\b\002\004\002\005\006\002\005\002\007\002\005\017\332\256\355\220\007\034\002"
+	.string	""
+	.string	"\005\007\020\263\305\272\332\004\n\002\b\002\t\002\n\002\t\002\004\021\262\241\315\242\013 \b\013\002\013\b\004\002\t\022\240\360\317\325\002\004\002\004\002\f\023\241\213\340U\r\004\024\342\334\305\306\t2\b\002\016\002\017\002\017\016\004\002\r\002\013\002\013"
+	.ascii	". \200\0023\267\036'\002\006\t^\f3+\254\307\265k{\265 B\200Y"
+	.ascii	"\254\275\273\331\314\276w\225\005\213\007\247\206\306\225\224"
+	.ascii	"1O\324\202\370\231?\354g\340\301\333\206\216\342F\216\354\023"
+	.ascii	"\254\300\342\326O@|yJ\031\r\300\215z,\352\270\022\036\322\326"
+	.ascii	"\302\355\351\232\257B\241\302xa\2740\212\342\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\315\004"
+	.string	"\222\006\022\026\220)\351\365\335\335\335\335\235\004\374\007\337\202\337\032j\215l\271S\n\356\216\022\027bG\235\351L\246\350\020}0\234\302#\ff\236`\255u\227@\242j\030\227\021\217K\252A\257\027"
+	.string	"2:^Y\275\245\321+*\251\360E( "
+	.string	"\203\251\352\006\b0\f\t\030\246\243\001o\007\311Z\241\311,\037\266C,\256\306B\004Z\006\340\016I\201\013\020)\203\243"
+	.string	":\264$\213O\233\016\013\023[\352\200\rvs\364\020\232\261\335\030\315"
+	.ascii	"\222\261\340\205\203%\264\0349\031v!\206"
+	.text
+	.section	.gnu.lto_.inline.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\316\t\255\034"
+	.string	"v\242mB \215(\215\001oJ\322\n\312x\334\314h \210\006\336@\361\013\236\016\313\231\337\023\364l\237ZAo\300s,B\277\355\267N\202@J\270P0a\024\001m\331\226H}\240gC\333\377\273\344o)w\nO"
+	.string	"T"
+	.string	"_"
+	.string	"\372^v\227\363#M\351hjR\007\273("
+	.ascii	"_\333Qu\313tL\312\320\020\236\357w\302Lu5\345\346\247\371Q:]"
+	.ascii	"U\3701\267\2249=\233\322ew\337oSn\273\233\017\224\356\\O\331"
+	.ascii	"r\237\3277"
+	.string	"\330]\324\347+)ww\3655\346t\b#W\312\345\234\353\262\271\224\223\202\346\270\177\020U\346\377\\\252\r\210\312\351\277\230\033\034\216\260\261\350\366\022\266(;f\351\363#\371`w\003\300\037#]F\246\373\335\201\013#I\336\265\216\350jw?\206\360iFC\340\030z\364\306N\354\f\311=\223\024\016\217\250\251\r\331\240?;o\330\006)7\022#TL|\376\224%VV+<6\2413\221\224\260\262Z\321\361\347\317w%\335\213\353\344\235@8&\003\004\003\262\254\343\230\034\273\3352\007\327\223\306\026\002b6\026\333\335=51\327\356\236\271\247\213\331\334\272\325\264\002\037\236cz\234+\232\303\261\247\223eX;7H\312\342i\247f\302ba\311?\016)Ie@\3213c\261Lz\002\345\202\210\214O\240\255U\212\b$\027k\252\024\005Y\241e\2630\210C\031;\r\206\245\3030 :\276\265I\212R\201\361"
+	.ascii	"O-\263\020%)\r\242l\231\300as/\346JE\213\245\030Z,\024\026oR"
+	.ascii	"\030\n\037^@\237\027t4B\231\235H\232\224\004\200\346\250!Q\347"
+	.ascii	"HD\222\202\202$\303\001`\002!3bG\017\022\200#%\007\005-#\"\""
+	.ascii	"\"BIZP\036)Ls\243S\021\223p\374\363<da>4&%\ru\335\330\246\314"
+	.ascii	"\240\027B\324C@\242\333t2V\026\2313H3\033\001\264V\241X2\300"
+	.ascii	"\210\0244\374f\364A\0214\327\226\271\022\364d\271@\314UY\245"
+	.ascii	"\352)\230N\025\026=a\266\024\224\307Wa<\311\022\235\t\321g \f"
+	.ascii	"\2443\214\323\026\204\241\235{\301Gt\021:2\207\334\353\324\033"
+	.ascii	"-~k\213N<\007\302\036\021\345'\200X\326\333\r\3136\355*\317w"
+	.ascii	"l\t@\370Zy\342\034\351\026\215\243\326\305}\355,\023Oq\212n\032"
+	.ascii	"|y\316L\333>q\215/0\364A\222\002\227\274\215\236fr\333hzut\244"
+	.ascii	"9\204\261\265f]\2165\364\304\315\367\343\230\330;\324\023\302"
+	.ascii	"8%\230\3070pX\037#yIg\016x\323\305\374pU\232a\177\344\333\334"
+	.ascii	"I\217\360\333*\243\330\315\330\376\213\244\220\"\324\352aA,P"
+	.ascii	"O[\027\255\261\353\231\331\0321\255pv\274\\\264A\244y\236\036"
+	.ascii	"\323F\3475\024\344\246o\317(a\263a\312\324\321sU\353a\324TN\347"
+	.ascii	"\n^\227o{\245\210x\351)}\3237J\300 \02271\211\246,\244&\024\200"
+	.ascii	">\241\230A\342ku'E1N\023\222N\215\233\314\006\341\322r\230\226"
+	.ascii	"\231\007A)Z\215\356M\315\213\021\344\253\203oU\016?\212c\225"
+	.ascii	"\023# \243\262\257(\027\204\033FEI\242\001\243\311@\255\321g"
+	.ascii	"\022.\002\222|]\334<\312\263\235'\325<\247\235h$\222\343\353"
+	.ascii	"P\265\324\310\370#\020m\327v\263\317\342P\333.5[\352\223\375"
+	.ascii	"W\312\024]f\304\261h\006\006g\372\340y"
+	.text
+	.section	.gnu.lto_.jmpfuncs.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\214\001\265\b"
+	.string	"\302M('\240'\351\3773\322R/d\366\207\034Uu\332uV\025FU\b\214\236\270\377\204\020\332F>!\255\211m{\313\235R\nl\324:\264\241e\250\203%\204\203oc\265\215\345\362^\217\2578\212\337\326\266\327$fj\231\307G\230\343/|D\200\371j\241\357\370\312g\004(\tY\205\336`q\277\364c\256\020\024d\017\226\037\232\360X\210\200\310\203\240\007\201\271\264\326Z\351_\177\344}\021{QY\376\024M\223[\200\230i\222\237hU"
+	.ascii	"\211e\237\3216\251K\314\257\231\317\374\245u\231?`&\255\371\320"
+	.ascii	"P2 p\002!:\263\003]\002hj\225\301F\262\001\377wq\220\361p\340"
+	.ascii	"\215M\362O\246\350\207\223a\231o\373\340\310\2729\23630\343\312"
+	.ascii	"O,p\332A\004*0\0361\210\305\007\260\345\264\243\2135\2644\027"
+	.ascii	"\210p\206\f\003c\270,i\307\nd\227\226\310V\203\t\bU\024\254\220"
+	.ascii	"\301\337\245\306\326\222\207\202K\266\022\264\300\270\363q\337"
+	.ascii	"\027[\343\307(\270\033"
+	.text
+	.section	.gnu.lto_.pureconst.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375 D\315\001"
+	.string	"BD\r\025\220Mc~\216233\213\334\375\376\026\376\026\3766\362\311\226\001\0369$\365\270\343\2153\276\270\342\211#~X\031^x\204\017.\270\0368\340-\317$3\233\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\372\002%\f"
+	.string	"\226\22030`E\223t\024\263$\271u\030 tzV\207\204.8B\030\f\203\004A\023\004\305\340`\034W\037\337\376\261[\277nZ L\243\265m\215H\231\002\""
+	.string	")"
+	.string	"'"
+	.ascii	"\r\200.~z\232\022\312\225\363\335\017m\276\273\273S\337n\355"
+	.ascii	"\236s\250\034\241|!\321\336\356\370yE\021L\322\333\275\025U\035"
+	.ascii	")W\006\2248\025T\202\020,\305\230\214\214\022\331Q\202,g\200"
+	.ascii	"!@c\322\213\t%\360\225 \316\363\027\025Q\237<\312\210\n\315\013"
+	.ascii	"/7\254\247\333\203Q\365d\275\326\267\326\221\"T\016I\242\273"
+	.ascii	"\346H\333\370\314\231\273>\017\003[*\026\007\210J\300l\021\274"
+	.ascii	"Li\245\325h_\250\212&\206\0302\262N)o\034\377k-\262U\256\340"
+	.ascii	"4\036\034\\\250pP\311\024%m\006\240\"\0314\333\021\240H\251\230"
+	.ascii	"\222*\205)\024\33239@J\265CZ\022a\265\t\334l \351\374`\324\362"
+	.ascii	"3p\256\231\364\271P\017i\363\212\263GK\235\203\362\205\211Bw"
+	.ascii	"\330\303(\025\250)\244\035v\246\307\254\333*\255\032\005\033"
+	.ascii	"+\271\240n\r\320\2033\220o\302\367\356\316t\252YsV\310\243\253"
+	.ascii	"\213\200\373\211\235\301\233V\320o5\326\251)U*\352\211O\367\377"
+	.ascii	"\245\326\030\304fN\210*\345A\316Ti(;\017\"K*@w\0016h\227\"\261"
+	.ascii	"\366)\342\370\276\201\023j:\344\345\226&P\364\346\262\376\b\331"
+	.ascii	"MR*\025\374\003"
+	.text
+	.section	.gnu.lto_.lto.df029d65e77a1489,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.5.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\265\007"
+	.string	"2O56Pm\222\016$\243\210\"YZ\257\315\203/%\247\264\024\231b\262\026T\230\231\335\220\311ja}\326\227\03573S$=Bb\025X\343\026\306\251mck\215\020\231\002 \211\217\207c]k2\332\006\004\301y\200\236\254\323\3114\320\303q\350@\215\026\0013\006g\237\215\006AY\246A\354?f\253|\244\337\205\342U|\f\271\227\361\255\362\221\276\245\266\017\323 He^\244V\022\3052\361\370\267\307~\347Z\372t@\346I\n*31/\324}C*\2625NT \223D\202\312\214\230\023,\265\216\226\377~\024d\373S\0259:\024J,L*\231\t/-\270jU\035\270j\275\215nu\333\355H\017L'\321(T\007\320\220\231;\321\b\243\277\376\b?\303_\n\013"
+	.string	"\322\032h41\264\n\3075|\232\305"
+	.ascii	"Y\220\225\220@\240,\203&\214\224\224\3165\311"
+	.text
+	.section	.gnu.lto_pt1FilterGain.6.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"=\n"
+	.string	"F\223E< \345*\035H9\002H\005\355\030V\002A\201\230\177\002\274\266&u#"
+	.string	"Q\220\357\331\\Q\343 Fq\245-\366\b*@\233(\\\306(\t\310Z\346\023\205\213\250\346\210\332&r\247\0244"
+	.string	"3"
+	.string	"1"
+	.string	"\255\247\200\2668\341\261\001\201\371P\021\260\273\034\347\006\231\317\355\005\231O59x\t\372\207\275\023 \226R\225.5\021\273k\231R\211\334z\333\t\266\037\354{\002\254\203\225\335\220\261\266\264\351r\362\327o\203>\314\033\333/\213\333\262\034\205\025\003`w\027>\355\020\312\032.\357\262\350\201]Y\253ew\031\254 \360i\333\017\252z\235/1\324\210T\213'\251\321hk\210q\254u\354\232:\252\312\022Q\263\223\034\355\260$\265\304\376\266\272\262/=\037\376\333_\256_^\372\032\202\022\024\262\002C\2228:\013\320t\347\371>\244\214\020\210\033y\"\221\327q\243\320\205\210\353\276\r\316\203`O\343\363q$\317\373\270M\270\337\256\253\251\034\223\236|\335t\352\007\240f[\022"
+	.ascii	"2\203l\215\321cb\311\f\177T \232\272\3035\361\327\242F\265\310"
+	.ascii	"6\0132\021dA\270\013\030\001\371\300\260\240B\013\200\312\330"
+	.ascii	"i\347\023"
+	.text
+	.section	.gnu.lto_pt1FilterInit.7.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\245\t"
+	.string	"V\022C;0\345\2521\200C\336\346\307\257?\004\346\201\216\210\323\326k\372\324HX\210\026\b#\025\220vyC}\023X\037\306\210\030\030\0300l\311\274W\022f\330QS@{[\357\275\245L)0"
+	.string	"1"
+	.string	"2"
+	.string	"\\G't\346<#t\346*\266\002\030>\b\002\200\274h\377\277ib\321R\254\335\342LJu\262\034\250\370_\231R\211\270\323m7m'Z/\004\n\004\376\220Z\201\317\270\027\224\266\326\264\225\243YD\273\032k\346\207\211\221\375\347T\3023\367\260Y\266fyEt\313\344\203\177\005\223\375#\247\020\236\003\016,\025\222X[\271i7\354\322\230\367\237\242~up\024"
+	.string	"81u\346\"Rh4\224\254\265\343I\316\222\326\333\377w\256Z\273\354\315-[v\006#\001\027\016?%Q\b\324\325\323\t?%Q\b\364\221\300\321\b\364|\244\220\305\350\363\204\031_\247\241 \306'\374J \030~\232\361\336>W\345\006\314P\323\243\333l5\f\013\016"
+	.ascii	"2\241'\034\030.\250L}Nj\217\245\255\240\207U\353\302z\f\363\002"
+	.ascii	"\201\301\025ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterUpdateCutoff.8.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\375\b"
+	.string	"fQ?9@\345\2501\240\256\327_\317\341\036\341\341\303qo6~\300\341\005P\0312,N \366\242\200 \343X#Ns\363*\212\216\203\300*{f{\227\341Q\261\264\377J\"eJ\001-"
+	.string	"-"
+	.string	"/"
+	.string	"\b\232\345\346\003\315\262^+S\340\030\b\320\341\212\371?\243\210=C\2576\2125)\325\311P`\342\177aJ\365\341F\267uh\033\321V\0261\251B\322\326\233\266\360\363\211\347V_\325\374+0\260\377\234Bl\226\r\031\303\326%6\361\3142\331\340_\261\300\376\217\323\207\315\262\237\003\030N\351k\373/Q\27342\b^FL\232%\003\013"
+	.string	"\b\n\316\332\357\004cH\353\314\3777\256Z\267\354h\226\reAK\202\313\3571\023\360\025\356>%Q\b\244\325\323\351>%Q\b4I\334h\304y&)D1\232\236\356bv\026\312Y|\272Y\342\270nn\276;\363\270\252\034\020C\305\215\306\330\006\f"
+	.ascii	"2C+\025\003\b_Z\\z\b\265\256\241\3070/\020\030\\\221\246\246"
+	.ascii	"\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.9.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"}\013"
+	.string	"\266\326N= O\234\016$\232\002\027\\\364\346`\306\313V\b\032\372\204"
+	.string	"\037 \003,hm\373"
+	.string	"\324E\374\246\037\257\001\361\254\224\255\rT\003"
+	.string	"C"
+	.string	"\260k=\023*0\356W*\342\240F\366\2262\245<"
+	.string	";"
+	.string	";"
+	.string	"\325\243\271\312\266\017\342!2\333\203\234\206\321\244M\220\320\305\330]\313\300!\323#\374\200\351Q3<{f\376G\034\246\b\255\370\200:OJ\301\356:?\240\n\267\336\366\001\333\023\373\021\002T\246c\246a\2465\323\231\351\003\230B,\bx\273\024>\031\333\021Ql\260\235\331\017\333\231/\331\263\306\256\212\027\033\273\033q\202\247}\322Ed\3478\027\260+:\261\261\313E\214 q\306\346A\313\317\327JU\251n\343\240m^\"5\342\302\017N\302\336\304\3572\020\252\335\375\350\321\347L\217W\252C\367\201\344\311\317\346:\251\030\354\303\335]\253\310~\351\257\316\375\001\232M\006c\211\223)\022\254\242i`a`a\256\313\345\242X\030\313\202\213E\301\034X\222\002\2762\025\314\322\\\027f=\270\275\035\025\262Y\350\360\250\346\250&\002\264\340\370\300\360\344g\250\327\250\220c\273\240\232\n5\023"
+	.ascii	"i\231\"34\030AhB!\270qp\334\t\264\212\031\003\\\256(\232\233"
+	.ascii	"\302\242\026\373\201k\214\310\202\254\204\004\002e\0314\361\244"
+	.ascii	"\244\230\256I\006"
+	.text
+	.section	.gnu.lto_slewFilterInit.10.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\013"
+	.string	"\346TMC \2138\035H\261\3302\bq*\242Z\220\341\276l\305\204\333vX\"I\257l\020\264[p\030\032\350\365\245\265\231\306\b\202\221\020\312\026@\202\303&\247n\251\361\236\303\322\300dj\3135>)\322&{\247\0246"
+	.string	"<"
+	.string	":"
+	.string	"KZ\234\221\275\232|\005\366\232\235\002{\365hs8\211`?\201"
+	.string	"\200\023kw7z\340\343\347\350\377t-$\362|Bt\354\256gH4\340\246\267]\261\355a\237\013\244\177f\230\203\f\026\345\256\200\326\207]\325\013\nl\237b\233\\^\022\033"
+	.string	"\024\342\230\344%\214/\271\264\266\213a\203jw-\326\310^1\256O\373\020\036a<\251\363\211\335\021J\265\001)\013\r.j\227\034U;\244<\024(m\317\212\315y\005\227\331\356n\370\024NL\"4$\350`\257uA\212\001\3533[6\351\231\324\200\375kw\327td\337\364c/\375\327\003\"\232/\023r`F\324\304\316\353@8\234&\3240c. 'j\272\221m\363y\336\207\3316]\210\267a\300p\273\\\370#\341\300M\374>p\243\220\373k\351\310\037\017V\037\n2F\355\360\001\024"
+	.ascii	"i\231\"\023/\307\321\342\202\njCJ\330M\275nj\217\271\255\360"
+	.ascii	"1k\215\013\303\200\031\003\230\013:\247\204`\201\300\340\212"
+	.ascii	"45\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_slewFilterApply.11.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\274\002U\021"
+	.string	"\026\036jF\360\260(\035x\337?\350\316u\263\030jn\261NF1V\004\271\376\b+C}\314e\037\234\022\325\365\031C\032\337\206\343\353K0\312\255\023Wl\"\233\310\336\213\217U\322\370%\353\240V\271\351\346\260d\357\275\245\224)X"
+	.string	"N"
+	.string	"X"
+	.string	"\360\003\301\"Q\033R^pt7\367Q\017\251\021\352"
+	.string	"\251\221?\250I;\332\224\021\362\232\256\023\004g\030f\250\250N\332\231 m\246\254\264\220\332h\240\303jEa\214\n+\233\ne\031\200J\002\374t\267\302t'\250P\273\023\324\335_\025\325J\337\241\377=\374\017\371w&\372\251v\354~\356^\356>\356\036\356\236w\277\273\327"
+	.string	"\022\007\006\201\024\335\024rr\364\213\030#\342\277\351\337\376\357\252\313c\357t\267\250!\353\356\217'\320\375\365\245'L\372\231\250\200n\026\214\254\373\3738\002M\343?\355\377\265\204\2320\375\261\221[,<hL\02227\031\024n\f\331\203\3210+C\2062R#P$\272\202yk\221qmw\237\230[_V^"
+	.string	"\253AY\234\377%\252b\371@\210?P\024\217i\335\035r}i"
+	.string	"Ac1\221\032\225\331fv\363:\331\234\377;-\267~\205\315,\217\272\250n\001\245\222\021\222(\312\207@<\221\222\003\021\003\216\324\215F]\210#\211\024\214\270\220G\302\201\024x7\"\342q\245\256\363\270\355k\205\312,\017\177N\0305\363p\344\340\302\325\211\361D\033\032\227&\233\371\327\335s\262\007\253\221\254<5\300H\336Zf\\/\031Y9\302rd]]\260\221\272\021: \300\002\0311\363\351\232\"\"?\006\235\242\216s\335\034\321\325\\\0361\303\305\t\032'O\314\254\002,\252f\252e\020\3425m\316}\326!\006T\340&{ \353\312\340\3701\253\304r\007\2414\321\346\313\264c"
+	.ascii	"-\353P\236Z\253\224\222\r\270\373\332%!\033\274\023I\022M\227"
+	.ascii	"\271\375\021++'\020d\331&0Y@\236\343\355\210\302p\032,\0339\023"
+	.ascii	"\021\231\201\375(.3\272\247\267v\225\001"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.12.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\345\t"
+	.string	"\006SD=0\307(\0350\237\206ZZ\365\305\255W\375\272\2573S\250\003\330\247\033\031O\032A%m\375\216\317\020\234\004MY\237n\002k`\240;\204\036\025\275\216e\006\027B\320\376A\310\336R\246\0242"
+	.string	"1"
+	.string	"/"
+	.string	"6\n~!\"W\260\242\241\302`w\261\314\023\254Gx\004\353QA\356==\377)\217\035\036\004H\245\320\363\232\330]'\251\304q\353m;\330\226\260\257\020\361i\370\264>\235O\337\322"
+	.string	"\340\013\016\354n\254\032l\202(`\304\266gc\354\017A\304\363'\243l\331-\200\022`w!\374p\360h\3337\371\211\027P\257\227\302\324\310\200j*\324K5\"\261Tu!\0255j\2525\300\322\250\327T\215JD\271\262\277P\352\207}\270j\262\237\276\376\375\326O\177 \215\333p8[\207\221]@\032\267\341\264\356\243e\027g\032N\353*:\034\354\263y<[\206}:\024\036,\343.0\r\2037\013\215\303\272m\3430\314\267\207\253\246K3\031*r\020"
+	.string	"2\2417(p\362\213\005\002\3729\n\030|\314\261\\\303\213h\001-&\0240\0072\003#\202\n8"
+	.ascii	"\225\307\324N2"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.13.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"=\n"
+	.string	"\246\323F<@\305\2521\340i.\273\272\370\\W\254\355\271\267\326v{\326i8B\344t2@\310\033j\377\250\020#LsM\242\273\313\017\247\013\0260\352O\373y\346\324\200\330\226\277\335{K\231R2"
+	.string	"6"
+	.string	"3"
+	.string	"\030s\035\235\320\231\303\030\2413W\261=\340\021\345\016 \340\003F\373\357\315\023\213\226bm\2303)\325\311\362\"\361\2772\245\nq\247\333n\332zZ+\004\007\251%\370\214\033\220\322\326\232\266\363\265\261\031\334\243\204$B\216\006 \332\325X3?\001\232\354?\247\020\030s\r\233ek\226[D\2678|\360\257\n\310\376\221\323\207\245\2561\263\240X\263w\373Q\233m\316)g\233\241!\235\252\003\202\221\213\314S;\236\3444i\275\375\177\347\252\365\313\336\354\262\247[\266\354.*\006\030j\017\237\351CQQ\372\302\320\027j0\276p\242\240+\250\023~&\013Q\310#\201\243\021\b\362H\242\317\310\003\205%\257\263P\360\342\013=\023\b\206\236f\274\267\317U=+3\324\354\350E\326\001\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInit.14.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\305\be'"
+	.string	"\352D\334\016F\200\334M:\0177N\tP\374k\020\260qt\364\026\342\234\263;\202\374\331I\256^\311\377\347U\202D\377L\254\205\246\021\324+\233#(\300\201\223\250\354\234\255\365\341\336\260\231#_\034j\350\037\335\330\232%D\356\224\002\335"
+	.string	"\303"
+	.string	"\336"
+	.string	"\376\267\274\313\217\367\362/\017s1\037s\263\223\361\317Y\031\25123\305\037\231\f\245 \233\"\324\230\fa\2216rT\200\t\202BLI\017\031\245D\330\226\021\\|T2C\206\260\301|\314Q\361("
+	.ascii	"$mMN\255\025\302M\203\260K-3\326:|\371X\n\325\241\325\024"
+	.string	"\016{\245F)T\203E\200`\240\306S\231z\025\037\355S+\031\034d\2555\202)\344n*\225\247\366\245|\312\324\273l\\@\255YGd\255\306\b~\220\273i\343\207n7s'p\273\351)\233\355F\255z+f7\260\264\325Zw\213\344S\277\231\345\322)\237*Q\023bQ\375\306d:\300S\236\314K\256!I!\226\217\357U\320\352&Tk\325a\235%\305i\250\265\232\n\261z\334\270\333\206a\233\206\235C\006eV4Y\016\355.\r\342\021\212hq\310\034\035\2606\f)z\341\320\022\335\360B\013.\225}\274\230\233\034h\325\031\222\3112\301Z\253\226\350\016X\332E\300~\351\376\344\262\242I\013\355\367\006DH\235SN\025M\332F\252\227u\215\330/\353f\331\357\372\0330X\260\244 \201R\022\002\244#\243k\371\017|\354.\372\327o\340d7\321\313\356\241\237\335\003^\345\027\360+\277\320\301\356"
+	.ascii	"\347r\003x\330\035t\344\rt\261\373\347`n\035\245\366\241\324"
+	.ascii	"9J\215\243\3247JmR\352\222R/\245\246\224\372\023tmg\220\324j"
+	.ascii	"\335\221\314S\321L\261&\007\373\271\374a?\362\027\373\301\374"
+	.ascii	"c?\331_\366\237]\347[\311\334\332O\264\002\330\334:m\325\301"
+	.ascii	"\255\355\373\036\240\305\255\323V\234\333"
+	.string	"\332*\236\347go\353\264\245v\226\231k\263\370\035\037s\265V\013\276\235)\256\026Al\226\330\270\335\244X\204A\253[s\235\266\314\234eh\376\362\206`\231\350\234E\244eZ;\271\216\226)\355$\026\255\321^Hb\346\234S\345\346\024\314\211\231`\035\3209\213J\353 \355$&\355\005-1'\227\332)\030VY\264\f6\211\316Y\314\"\332\005\233\264V\264K\233\224v\022\025\354\325\234\\DK\203\345z\030r<\213Os\334\031\032\025\325\263k\304_\363\337\320\037l\3746\277\302Q\254D\324\370k\314\226\253\225\352D\177\306\355\246\251\260Z\261\025\237\346\023sZ\225G5V\246\233\007\226f1C\273\242{l`w\213\002=\025>\250(\363\205\024\225z\242\275\025?\027=s\302\tJ\341\004\255p\202N\350Q\n=Z\241G}\277\032\037x\367\305\350yX!\345\003\246\360\001\177`\370\200\033t7?I"
+	.string	"\372b\270`\221b\367\"\n\n*\352i\367\202E\017j\367\004\224\332I0r\324\317\007\334\305\210\212\002\356~\214\365e\335,7\2551\021,oM\231`\177^l\313`wI\200\0356\215\231H\313\033+\263\013\226\002\330a\323\227y\264\274\257Ri\177^a\273\2644h\207MOL\243\345=\351z\003\264\303\246#&\357H\231\264?/&[\356\227\374\354\260\311\207Y\264<\037\345\317\213\270\n\326\305\224.\252\333a\007;hUke*\274-\202\352\030As\264\321\253\333$\350\r\037m\323%\333\004\r\036i\341\304\310@i\363Y\273G\253\002\254\317:\005\200\235\250aLf\020R\314\314\210(H\222$\255\001\320\002\021)\2536\022"
+	.string	"\0251S\032f\210\244\230\271\244 \246b\315X\024\255\313\322Q\365~\371Gr\212\330\334\351\027\223l2#\026a\275j\307\227Q\345s\036\210\372\274y tbg\222\326\302\241\246~\336h|u\336\215hFu\204\303\3471u\032s\375\016\335Cf\277\201\246\235\300h\254\264\305"
+	.ascii	"\274\033Q\274,\210\320*;V9+g\340\255|\305\r\346\342\371\026/"
+	.ascii	"\031=\347X<p\017\346\032b\"\205nF\260Q/\bV^\311g\354\320\365"
+	.ascii	"\346\356m@\305\303\022\003\223\264\005\002b\256\345\b=\f,\351"
+	.ascii	"\330_C\273\375\276\327\"\305\236\351M\311r\346\037\352\207\363"
+	.ascii	"\374;\021%\224\224\244r\037\220\376\243$l\267@\324\211\312\266"
+	.ascii	"\035j\272X\036\n\267\316\367V \334;f\013FF\364_,U#\366q\207\035"
+	.ascii	"\211\0014\275\203\003`\271\245\252\017\244\276\003\007\004\036"
+	.ascii	"0B\221\336\260\240\316F<~Kx~l0\240\037\025\201\233\336,\rR\005"
+	.ascii	"4\237E\251G\277\202\004\301&K@\255\263\254?"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.15.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\264\002\355\021"
+	.string	"F\337pI\340\262(\035`I\2157d|\361\302\204\262\347(\370_\020\001\212hJ\370\034\007^{Lp\314W\340!,F=\313\235\352\227h\\\345]\354\212m\\\005\034\340\020\207P\250\215\307\252\031\"-\t\372UmO\032!D\356\224\002U"
+	.string	"a"
+	.string	"U"
+	.ascii	"9.]\332\0052\262\355n\211S\337\273\021\356\323~\214\313\200}"
+	.ascii	"\346r\001\2736A\266]\262\304\013\276w&O\300{\367}\200\367\316"
+	.ascii	"0\273\350\344\315\236h6\202\206\321\356\202\252\342\260O\230"
+	.ascii	"\377\237\227dhb\237$\007\273\353)Cc\342\326\333F`[\203\255\t"
+	.ascii	"\002\367\271\271\333f\377D\235^\f\221\034\355\2228*\262B\335"
+	.ascii	"\r\026\247\375\265\337\347\267\235\263\377\236\333x\371\037\237"
+	.ascii	"l52\370\3200\324\\\216\304\240v&DO\213\0136\315\345\027+Q@\004"
+	.ascii	"Q\215\310\356\222\274\263\005\233\343\371P\024a\307%\207\332"
+	.ascii	"\031\030\036\b\252\363\342P\033\203\342D\203I~\006\354\001j\257"
+	.ascii	"8\314\313X\201\213\035[\2431\333\254\007y\2528@d\342\201\272"
+	.ascii	"\033\313up\2528D2\267\236\303\345\267\273\f|\034 <\030\270Y\341"
+	.ascii	"\342\275SU\234\037\267\331\313<\262\311\330\324\024\366\271\335"
+	.ascii	"]\253\215}\236\337\364\235\277t\235\377{\316O:\355\366^\273\273"
+	.ascii	"\251\226y\3222S\257y\362\232\341\312\253\302\204\207.\024\n\033"
+	.ascii	"Z\341\230\022\216'\226p|`\362\2542\031CW\207U\n\250\"\262X\242"
+	.ascii	"\nTY\241\260@\325\330\002M\016X\\\tG\320%\212#x\"\367\334\252"
+	.ascii	"\215%\300\020zQ\030{\352\243H\326\351\320\215\323\036Cd\252<"
+	.ascii	"\002\004y\021r\253\0010MZ\322OI:\0038 \360\002\031\261\321\003"
+	.ascii	"\370r\020\f\221\346)\363xG2\034\214\204\214\035\210*F*\030\033"
+	.ascii	"\260\001\201(\030;`\325\206TZl \206\3433\210\3041x\177!\033\177"
+	.ascii	"-S\346\320\037r:\266\234!DJ\b\345\234\315R\0069r\033\303\020"
+	.ascii	"I\034\311>\361^J'\235\361j\303x\333]\256\266\232\304n\362\274"
+	.ascii	"xY\006,\021F\024q\023\203W\244\261) ./\332C\006"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.16.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\007\003\355\022"
+	.string	"\206avH\340\3604\035\360l\360\264?\017Zs,/\036\261\211Gd?\237&\304\205`G\266\261=\004\303\361\017\201k\360\004\3218*\031\376&Y"
+	.string	"s\250\021\375#\344\f\346Q\246C\345\361\301U<`\203]\236\212mi\223\275S\n\\"
+	.string	"d"
+	.string	"\\"
+	.ascii	"!v\030\314\361*\302\377\230\364\307\356\213\035\345\356\216\230"
+	.ascii	"d{\025\311>\355\367<Ex\037\231\013\330\325Y*w\307\021'\330^="
+	.ascii	"\236\200\366\272}\200\366\352\320\216\372"
+	.string	"\270\263w\232\301!H\307\356vt\304\303\317\320\177\320?npf>S\rv\327\363\006\007\304Mo[e{\202Mm\002\0018%\032+\241]\017=x,S\205\225x\322\017\373\221\376\362\231}\237|\351#\035\366\244+\231;2\"*z\271\\\341\207\302\227\257\260I\016\356\305\037\272\353E?2gD$\341\345\212@dR\244&d;\330\274L@\260_.dr\233\371P`\203S\021\216\335U\360\352\007\333\3539\333\024(&\013\331\232\324/U,\314\337\030\301\t\031\233CgX_\332(\345yj}\217\221\212\261\034\206F)\217S\353\245[\356\302\244\201\235\335]\340\267\320\220\301'\361\352\313h\257\225^\351*\236\246\230\2178{\330#\315\244\"\354gKu\354\227\367v\244;u\330\255=\351\256\007\372\263\377\374\364>\377\f$0\263\004f\222\304\314\222\230\351\271\234\230Th\361\300\024\017\344X<\320\001"
+	.string	"\315(+\320s\271\240\222\322\255|,\326\207\322\255\250\234\260:\024\260\245[\035\360\207\301\003;\227\357\003;n\024\037\364\355\305\202I\2444\336(TT+E\237b\032m\272\321\252\264\206I\020\250*\332\210\345\200L\237\202f\362(\304\036\246u\266+\2522J\351\f> \360\002\021\261\235\003\312C\244y\212\b\355\216\354\311"
+	.ascii	"\b\212\354}](6\025\354\271\230^\230\033\366\nl\264\231\245\365"
+	.ascii	"|=\r\362r\314\024J\342\004\243/\210\301\257e\021\316\330\341"
+	.ascii	"\037k\332\031\343\365\241\005\313d\201\\\303f\0219\320\230\227"
+	.ascii	"p\214 \344\320\226\201v\302\025\ta\033\244s\tCHy\036\343\025"
+	.ascii	"I'\345L\321j5\020\003\336\036\240\343\214(\306M\214\256H\363"
+	.ascii	"S@\\^\264\220\f"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.17.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\374\002\r\023"
+	.string	"\246\243zF\340\322h8\212t\b\202\005\n\244\n\220\367\302 A2|6\352\035\006\023=s\230y\314\217.\310I\256{\332\232\345\312\001\236\254\225\343\204\031\3470\306\235\261\327\301\006\212\203J)\n\237\304\303/\261M\366\336R\246\024a"
+	.string	"Y"
+	.string	"m"
+	.string	"\273\t\356y\001\230\371\035\343L\332\375\341\301\263\273&V\360\264_\373\211\330G\230\247vgf\360\354\216&F"
+	.string	"\336\363\b\332\366K\334D\314\306u\343\b\233\317\202\320\205[\321\356\206\005\256\372\356u\037\371\356\251\210\307\2361\377\267w990h21\317Q\203\335u\322d8\334z\333\006l3\260\025C\231\263\307\230T\032\373\335\352\214}\333\255\372\316O\362\361\037\311t*\323\"\231\016\3114*\323\247L\203d\332\224\351R\246I\231\0063=\312\364\227i/\323]\2465\323\231\351\227\240<\3248!\332\325\220\353\261A^\317\315m\277\035\363o6\331\266U"
+	.string	"c6"
+	.string	"\240\321\024\351\3303\022 j\322\223\022\330\301\272\017\210\236h\302{L\372\034$\375\264\244\001|\200:R\222\226\330\230\341\310Z\347\001\365@55\321\365\026#=\316\323\324O=\241Y\bY\346\334\251\252\247#\0273\034Y\313Wt\372[MMt\271\nU\024\034$zM\355\204f82\277<\205q\340\356\242\370(\036P"
+	.ascii	"m`\276{W\222\330C\247&\0060\225\027\227\325\353\203\275\260\254"
+	.ascii	"\260\274\317)'\257\025L\205\025!\\q\265Z\256\224p\205\005\241"
+	.ascii	"\025\246\274\\\302\023\001v\261\254^!\314\345z\205\246q\337\255"
+	.ascii	"\316\250\024\225\241C\220\2502\2534Hf\323\371 \002\345hC$j\267"
+	.ascii	"\\\206'\376\320\001!\3068\335ppC\2036\224R\224\2524E4DSz\340"
+	.ascii	"\266\372\217\210\246\217\204\277\b\321\274\235\264\244(\035\300"
+	.ascii	"\"4 \340\"\021+z\351\232\"\"\236\224\024\r^\202N4\020\rU\305"
+	.ascii	"\177\301\200u\0335\316\032\204/.5\030h\275\273\342\270@\352\254"
+	.ascii	"\2319b@\311w\240$\",O\f\224|\007\224\004\363\362x]\303\244\346"
+	.ascii	"\302\020HI$\034o\235A7\2051K\311\206\370\r\261B\022\027\030\205"
+	.ascii	"\340MlU\032\221\370p\226Rhr[%\t\004,\263\211\247*\305t\t2"
+	.text
+	.section	.gnu.lto_biquadFilterApply.18.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`b\002\315\020"
+	.string	"\266_lD\020\257h8\300\\[&5\211\336\366\206\322s,>1\272\3475\254h\327\244KJD.4\211\320d?\365\367O\351\216X\002H\332*\002"
+	.string	""
+	.string	"(\231\\\032\236\3771\005\244*\2146\262\265v\357\275\267\224)\005V"
+	.string	"Q"
+	.string	"Z"
+	.string	"\27303.\273\273a\003O\373(\357\300\372\370q\214\335W\t\227\335q\303\004\274o\036=\333\376\206s`\331-\332x\301\204\013\021\t\221\315\354\356'\340"
+	.ascii	"\270o\332C\3347-9\353\311\362/\273v\022;\341\032i=;\005\273\353"
+	.ascii	"t\215P\270\365\266\007\330N`g\213)\177\306\307\037#\323\240L"
+	.ascii	"\1772\355\311t'\323\234Lo2\255\311\264\227\351.\323\\\246\267"
+	.ascii	"Lk\231\326Lg\246\257\3619A\201`\266+a\366bc\266\027\fW\371m\226"
+	.ascii	"/3\307\266J\004\2575A\303URa\305\356\026\370\346\003^\346S\334"
+	.ascii	"bM\233z\252\311\210\031\302\2349\244\234v\312\215\020a\340Cp"
+	.ascii	"*\322tS\225\021a\017\276\242i\027\256\270PM\ri\262\210$\251\203"
+	.ascii	"P\345P\221\241\327TMF\204\205^\375\203[\274\335\345\360=,\200"
+	.ascii	"\340\231|p\337\256\232p%\206\002\2223{l\245Z\260\257\255\276"
+	.ascii	"\354\253\334\241\007\252\216U\212\204\342T+\217Si\343<\022\241"
+	.ascii	"H\252\216R\203\357\004\232L\340\350;\225\030\230\276\021*\365"
+	.ascii	"\211\002\030\364 \241>\025\b\242>\316\270\327V_!\375\210h\210"
+	.ascii	"\001\321\320 \205\371hGA\036\375\224N\302\303\321\216\203\213"
+	.ascii	"\340h\027\262\3046\372\342I\2212\027\013\215z\272\321\316\204"
+	.ascii	"Hb\272\213F/\3534, \260\"\231\263z\251M\021\212\007L\242YI\320"
+	.ascii	"c\003\271\264`\320\233\321\030\3505\034d\0024\214\254\264`\024"
+	.ascii	"\2446`\004\343M\316\214E\037\206<%\004\341\341\340\240\256\354"
+	.ascii	"E1W\243P\321\033\306\234\222\035\361\333cu\024\027\326\206`O"
+	.ascii	",E\024\221\350p\026)4\275\255B\002\201\226o\342\311\245\230\256"
+	.ascii	"N\006"
+	.text
+	.section	.gnu.lto_laggedMovingAverageInit.19.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\315\013"
+	.string	"v\025O@\020O&\035\300\270Wo\"\250\bI{\037\027\341\304c.\325u$\361\246\237\220\341\242\373\n\204\360\373! \250 \001F\343c"
+	.string	"T\004@\342\237\004\023\230\210\240fx\232\313E\227\240M\310\336)\0058"
+	.string	"="
+	.string	"="
+	.string	"'v\253\001\027\350\316\271>"
+	.string	"=\327\035"
+	.string	"=\347\321n\361\352a\3772Qp\315v\327\233\035>^\216\376]\177\214H\237K\307\202\335\265\034\2210\334\363\266\t\330\236\330\257\020\247_\375\333U\277|h\352\354E\202\332\356\205Z\214U\301\241"
+	.string	"a\373\020\333[\3130\001\221\025\261P\nf\275\210\361\253\216\214\254(d\341@w.\"/\355\247\036b\274\312\363\215\335\023\2133\031\235v\370\022\206q\031b\250\3226\355\t'\341\b\245\240\225\336\2416\346#:\335\356\"\360_\034\215\306\212\017\036zn\242a\203)%\003\311\232]?rr\260\277\355\356z\236\354\267\036\026\215\203Y\341|\f6\341\203\313\267\311\240\246H\304J&\302g\361.!\b\206\024\357\3625"
+	.string	"=\212\210\361$\003\034J\250\210^&\fE\017R\367\333\316\2237\030\225\346\0024C\366AjC\270\t\220\025\013\027"
+	.ascii	"i\231\"\023\217\363\242\301\005\027PF\212=GSS!0IQ\035\2520\335"
+	.ascii	"\342\006\231\260\3105 \300\206VB9\230KB\260 |\246F\301eij4\270"
+	.ascii	"\313\213v\222\001"
+	.text
+	.section	.gnu.lto_laggedMovingAverageUpdate.20.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\206\003\355\026"
+	.string	"\026i\215I\340\316*\035\252\034(N\322e\207R\271?\326\030\205|\270\311\006\273;bM\223\250U\033\210\310,W\021\372l\021m\243%9\375c\233\2005\321\020\034f\260a9\206\303\256SM\242\\\276\2306\206\266mk\204l\262\245\224)w"
+	.string	"n"
+	.string	"\177"
+	.string	"9\265\326\217\017X\376\367\267\034j\013<Y"
+	.string	"\265\372\210rj\005~\334\203\\\361@\362\377\227fkj\277p\002[^h\016&w3Tk-;vEW\234\253AWl\013[[*\316\346\332w\024\231E5;:\036\312\322\b+\242x\017fG\255\025\307se{z\364zVP\274\224\271\002\252\300b\203\313;\336\215y\024\251\265\236u<\b\373q\377\307\376\207\374=\"W\260\035.$k\255!\337\233\0030\362\345\204\256\270\315\242\360\323\333\360\263\361\360\007\242p\263\374;k\3738H>kmvW\013\334\325 \371*\346\247F>\212\362O\223o\232\374\022\363I\314\0371\237d\376\330|*\362E\221?'\277\233\317\314\337"
+	.ascii	"\rb\206^\024\030\326\2522,\252?\242\316\205\377\265\277\364\237"
+	.ascii	"ym.\234\252\272\273\251\0043>CB\013\243\353\375t\263\334\324"
+	.ascii	"\245F\020T\221\3021\376\267\226\204\313\324\245\313\257\324;"
+	.ascii	"\256\215\233]\027\355.5\001\232\024\270\036I\304\250I\275\233"
+	.ascii	"\316\205\243\356\031\023\032"
+	.string	"~\253\336h)\005{\210&\220-<\005\255\016\306\330\333d\263\f\\\314mC\314.\374\036\207\2568\366\356$\210\315M{q\030\346\236\207\316\026{\266\300\311\334x\370\356\331\233\233A\262\037\\\335 \257\365p\034n\001.\001&\fJb/\221\276\0052#1Y\360JP\306d0\230\254U\306^#\260\2625\243\225 \254\313JHf\245\211L6+K\300\272\263\266\357,\262zc\210z\323\324\252\336\375\347\350\016[\337\236jRs\364\342J\240:\325\213s\241jT;\250\331\311\315\260\361pR\024\013\242\205\325#\346Z+\212H\243\247^\231\340\n \332\251\r\364|\263Y\226F\377\221\365\241\215\267\023\031\204l.\312\343J\005\005G\250Q(*\0213C\025\210L\"%I\332`\"\221d\327\001\021\240\245TT#E\005\333\f\351\022\207\013\315]\3322\234\033y\007\246`\341\205.\020jpH\321:\2240"
+	.ascii	"\225\265\262\207}\203H\006R\201N\226pX\244\307\006;\361\210\327"
+	.ascii	"\342\356'\n\247P\032\bc7^J\233\334\212\022\032\272\257+\027\206"
+	.ascii	"\036\377 +\263\325\244\354\203MQ\013\335;\027\232\2337\265C\272"
+	.ascii	"\306\250\022\222\307\330\3124>\224\257\235\271\b\257\274h\344"
+	.ascii	"u\223U\2144\226z\200J\365\002\324\206UZ\217d\025\001\272\331"
+	.ascii	"E\232b\n5"
+	.text
+	.section	.gnu.lto_movingAverageFilterInit.21.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\024\001\025\f"
+	.string	"\206UPD\020mL:\b\335B\262^c\254\352\346\333\220\216p\020\235\236\274\"'\261\203\n\362\037\253w8\212\370eC@\340\230\004>\t_G\200\210"
+	.string	"P~\013<\f\310\\\003\n\020\203c0\3476$\022\331\177\357\224\0028"
+	.string	"="
+	.string	">"
+	.string	"!vK\020{x\257.\257\321\275z\317\350^M\332'^R\330\313<0\210\335v\367\243\023N~\222\376c\257@\245H\237\023\001\273\353\211J=\270\351mw\330\016`_B\260\277{\371\323\273\376I\271h\221"
+	.string	"\200b\327A.\305\316\352\210\n\266_\261-\321\360\027y\030hZ\366db\211x\257\2269K\321\206eO\257\006!\237\3661<\003y\327\350\030\273\253Z\b\376\241Z\250\265l\035\265\303w"
+	.string	"ML4\234\352\343\266x\016\013h-\033\2456\347\033D\336\356\216\370\262\220\307\302\004k\324\275V\b%p\252\322\314\331%i\322\b\366%\273\273\246+\373\001\231\020H\340#\036\330\200\037\212\306c\200v\306\\\306L'\001\250\3716b\030\212\230o\003\026\b?\314\310\371.\034\026\025d\306\257#\212\343W)\367\222\245+\017\2700+Q\223\017\3426x\0217\333A\235\035\032"
+	.ascii	"i\231\"\023\217\367\242\301\005 im\033#D@\017\260\021\344\003"
+	.ascii	"A\0345\013\260\323to\334V\350\230\265\306\205\341\037F\203\360"
+	.ascii	"\2230\n\227)a\bP\030\f\013P\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_movingAverageFilterApply.22.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\374\003\225\027"
+	.string	"F)\217J\300\222U:\322\256\332\310\241%\274\225\211\322\346\2660\241\275Z\250\030\373\020qQ\363\357\200\357\254;Dv\252\035u\f]nt/2\330\004l\036\330\246(8\212B9\266\0059\242\\@\204\375\037\240\355\212\256hk{o)e\ny"
+	.string	"l"
+	.string	"~"
+	.ascii	"\032\210j\255*/\300\374\357o\203d\026\030\263\257Zu\232\210j"
+	.ascii	"\005\252<\005\265\363@\324\377o\2115!\363Q\002{z\224\347\206"
+	.ascii	"MPH\255\225f\2623\272Sn\214\356l\236\035\367D\247l\036\277;\264"
+	.ascii	"\322G\220\016^ofO\031\226\332\354x\342\254T\365p\266e\212\317"
+	.ascii	"\006\206V\257F\316\2049<vh\371\246\247c>!\250\265\236y\275\013"
+	.ascii	"{\324\376\257\360\237\345\227\t\002\033T0\001\345a\3477\206\356"
+	.ascii	"\334\356%&\240\037\r\017\177\340\f\367\316\277\262\266\316\311"
+	.ascii	"\n\355\226,p7\200\344\317\232/k~L\362a\222\377\232|\022\312w"
+	.ascii	"Q~\253\371\254\311\037i\376J\362U\222\237\232|\024\345\237(\237"
+	.ascii	"6\177N\276\224\374n>7\177\t\270\206\b\017\fk\2650$R\221\346\013"
+	.ascii	"\020\377e\376\025\257\320(IjMN4X\r iFn\244\373\007H\323\\\265"
+	.ascii	"\fqW\244\333\253^\360;\332\371t\\\364C\330A\252\032\306\350\332"
+	.ascii	"\261<\245Tw\253\232{\354B\350\266\3506~stg\252\367f\303\251e"
+	.ascii	"\243zw#\344\276\006\245}ji\264\023\241\343\341g\323^\233\".\333"
+	.ascii	"B\234\255\002aW\344d\017\250\255\212\261\233\366\003\317\207"
+	.ascii	"\324\275\363\336v0\224T\303C\376G\330\024\334(>\267\355\t\021"
+	.ascii	"Ukey0\271\227[m\322\267\254\340\\`$\324\036\320n\242\315&\266"
+	.ascii	"\320n\265\0066Z\013\216\002mE\300\305\027\027\034\rF\024q\264"
+	.ascii	"\025\260\256\254\255s\322&4\255\373\254a}\322\035\334\221\220"
+	.ascii	"\365,\207(\353\224\256\b\320\251w.R\034\342\022\021!L4\326\034"
+	.ascii	"k\241(\013\362\224hb,\253cm \b\005\354\210\365jX3\213\235\317"
+	.ascii	"h|u\377\004\001\372\225\364\267\210\301(\353A\361\341\340\352"
+	.ascii	"\221&Y\027\333jWs\220\325\255O\250Q(KJ32\025\214\004iIRh\003"
+	.ascii	"\200\"\0213\273\001\021`\245SJ\315\214\026m\355i@\005\313\243"
+	.ascii	"\310\013\356\244 \262gG\2668\255\2658\2534lW\323\"\nt\366\211"
+	.ascii	"\005':\313\214\the\021\"\346\377\336\033<a\003\355wB\344\367"
+	.ascii	";hIc\207\232\266\230\340\214\212\304\244Yp\036\026\220%]\213"
+	.ascii	"9\226/\255\270\2162\365n\253\200\005\260\232\352\353c80\251\326"
+	.ascii	"\234u\b0\377f\2446\2761h\001\362\242\364Cr!\221+\300\324\177"
+	.ascii	"\261=\235\313ZY\036l\347\025\314p%\206\nv&<hS\005\207\005%o\330"
+	.ascii	">\252\327\240\227\032"
+	.text
+	.section	.gnu.lto_movingAverageFilterIsPrimed.23.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\355\b"
+	.string	"v\021?7@\217\322\001{\275\247\273\255"
+	.string	"\203\274\326\006\2241_\367\372\310\002\247\206\204\216o\365:_\331\016\nV;Z\257\031Fw\206P\374\206`\254g\266\020\337H$\233H\231R."
+	.string	"/"
+	.string	"-"
+	.string	"\266\275\300`\362\351\237F\353\260\331\212\304e\367\213\n\373\351y\362\017r\255\305\344\204\345B=\001\034v\327\311r]\334z\333\007\266\025l\277\004\351o\002\030+\017%\273\255\031\314\252@Y\207m\223\235\261\235i\337\343\037\246\307J\017\330}\305\240\354~\tF\340\016\375]\263\035r\037\330\016\003\022\037I5`\361\350\"\023\334\256E\203\037BQ\301q\034\372\245\355\360\252\331\210\245rf\177\250\324\f\373\332\356\256\365e\370\330\257i:5^\207\004\372x6s6^\207\004\372x\242\250\013\205:N\024} B\221\343\215\342\206\300]D\307\213\244\256\363b\346\333\033jAJUN\275B\325\224\225L\025\013"
+	.ascii	"2\003\302\260{8\013ZGT\312\224\316\3122\201q\031\245\250\361"
+	.ascii	"P\035\302\230\256I\006"
+	.text
+	.section	.gnu.lto_medianFilterInit.24.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`@\001}\f"
+	.string	"V\226Q@\020Q\225\016Hk\034\017\t|\002\370 \260\376\216wKH\305N\025\323l\r\013\223x\264\204\233\305Xu\257\025\317\035\031\b3\t@.\200#>\031qD'\"Ta\356{2 !\333\177\357\224\002;"
+	.string	"B"
+	.string	">"
+	.string	"\273%\031\257\335P\201\023h\237\016_\200~j\237\320O\2036\216\207#\366-\016\033T\261\335\335\244\210\203\217\240\177\326\001\214H\237\307\354\301\356:\216H\036ny\333\blG\260\357\"G\375\363\341/\177\372c\204\300\t\033\020r\354v\370\330\261\260I\243\204\355GlCRW\201_m\242dE!\025\016\264OI\374\204\242:\006$+j\361\241A\f;\261\005\217\366W\234\005\370\223\347\003\002\033j{\177M\023\256\230G&\355\372\030\233L\3442Mig\270K\207\2246\346/:\332\3562\360[\034\r\002n\220\360\320\317\231b\231@\200\342\207\035~\242\fa\037\262\273kY\262\277\372\263\034\247\233\020\300\302e\276\212\241\232j\271t\032J]\241|\\\346BWa\273T\317\253\225\355\322Q\360\266\312\207\331(\007\\1p\337\226\251\365\333\"\341\036\262\262d\t(` \031\362g\334\266\360\0320Rx<\036"
+	.string	"1GM\313h\231x\274\027\r."
+	.ascii	"I\325m\314\025\001=\300F\220\031\\v\224\003hWS\341\211\215\353"
+	.ascii	"g\302B\327\200\0343\032\204o\306\3503\\\004\034\006\303@\020"
+	.ascii	"\240\020\\\006F\004\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_medianFilterApply.26.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\305\f\215="
+	.ascii	"\032nL\0279@\352\311p|\207o$c\023\237\212\246\243\032X\322\247"
+	.ascii	"\236\251\tgq\313\252\261\020\263{\341\334\271\233&L\342\220S"
+	.ascii	"~\024OEx\363H~\213\273!B\366\336{\357$\245\fp\001A\001g\001\333"
+	.ascii	"g/\333\300\002\264\210D\341\272B)\024\265*2\377\320p\0373\037"
+	.ascii	"\363\037\263 \346@fB|\3562\241\345B\201\313\202xP\240U\247<r"
+	.ascii	"cg\227\370\207\377\226\001\227\270\307}\230o\271\217\375\226"
+	.ascii	"\310\307\210\036#D\330\316\242\203\221\210\334gyo\211~\206<a"
+	.ascii	"b&\023\007\"\313z\230\317\022\367\274u\301\025\327$L\310\244"
+	.ascii	"\311p\207\361\020\341<o\351\332\227\312\355\261\313\264\256y"
+	.ascii	"\017\330\\\013)\233\305\356]#\273\304\346:\306U\327\365K\250"
+	.ascii	"\276u]\305\266\254{\227\361\230\216\021\316+\302V\353\032\306"
+	.ascii	"P\337\272\346\211-X\312\346\346\245\034\207\345\030Yc\231G\206"
+	.ascii	"\356\264\303\223\273\343i]W\262.\316:\331,\031\353d\363cvj\245"
+	.ascii	"\026\335\3234r\261\212jJ\212h5TS\3644\257\312\267qY\217\313\301"
+	.ascii	"?|stH\270H\206\253\310ti\252\244_\226\236\342\302Rb\244la\342"
+	.ascii	"Q\n\027\266\262\003d\257\273(Zz\350\307L\367E\312\026V\275\276"
+	.ascii	"H\301\302)\243(W\006%i\324\n\237\205\270\347\324Ta\263\250\306"
+	.ascii	"\n_\225\031\346\270\261cFQ\312\224\257\223G\020\027R\322%\017"
+	.ascii	"\342\222\r\237DstU\370%"
+	.string	"X\362\320\024f\024\005K\231\265\bL%\326\343F\322\305u\243\034\326u\335\236\243\223\302\213\305\273\034dw;\354J=\345\315\263\034\241\0327z+\317\201\223\330x\321\217\237\001q\251\306\321#uO\035Q\177\335\366\371kz\223\2224\250\335\275\301\211\372\n\3546\007\013\276\245\353\272VX>dl\322\226\232)r\262\311\377\240\2437xp]\270\233\027\327\257\333\345\002S\346\260\331\207\331e[SS{k\240\2754\322\336\031i\257\f\2647\006\377\361\246\251\2750\324^4\265\367\305\231\332\353\202\373x[\260Xa\246B\355M\201\366\242H{O\244\275&\320\336\022L\210\227\204\332;B\355\025\241\366\206\340@^\020j\357\207\355\365\300\201\274\033\270\016\263\006&\304\213\201\363\230/\240\275\024\322\336\ti\257\204\2637\302\331[v\366B@{\311\322\336\261\264W\354\354\rC{\037\234\275`g\257\003\264\267\001\332\313"
+	.string	"\355]0\354\375\032\366*@{\023\244\275\b\322^/\264\267+\355=\220\366\032P{\271\324\336\002j\357\326\331\253u\366\022@{\007\244\275\002\370\2177"
+	.string	"\363\361f\241\275"
+	.ascii	"\206\275X\303\336\253a\257\025\332[L{\253\322^*\265wJ\355\225"
+	.ascii	"R{\211j\357\220\005\361\252jo\212\366\242i\357\231\366\232go"
+	.ascii	"\211\366\376\354C\270$\2618\373q\002G\200>\265QQ\263\253Z\347"
+	.ascii	"T%\211\3474\275\260\220\337N\002\327zs:&\3434\275\021\370\007"
+	.ascii	"!\275\301\013\320U\007\360\001\337mq\326<\267\022\274\034\217"
+	.ascii	"d\005\274\370\001\357=\253\013xy\347x\207\365\342\001\334\f\004"
+	.ascii	"\207\257\216U\306V\277\262:\272\207\306\230~\024?a\022\036\034"
+	.ascii	"\325\253\316{\307\273\251S\215\261\324\247\2765\352\230$~x\251"
+	.ascii	"\3631\215z\342\2658\311\021\302}\370A\216\237Dr\204\351\271\342"
+	.ascii	"W$\016\342H\263\203h2uh\316\314%\005\321\322\334\220<\177\305"
+	.ascii	"\221uT.\231*\316\2038\375D\345\311\227\337N\263#\367\212\357"
+	.ascii	"\317\313Y\210\325ET\376\224$\216\341\310-K\020\337p\344.\363"
+	.ascii	"\333\211\341*n\306\247\3231\031w\204Rg\276n\231Y\013\034?s\256"
+	.ascii	"\036&\305\323\003\321C\304\224\216(2n\332\311f\212\363\211\227"
+	.ascii	"8\nv\304&~\342|\274\2133\361\013\312\021r\340\242\361\244\264"
+	.ascii	"t]\223TX\226dl\"ci\234l\226\270\271&\360\023\336\210\223\370"
+	.ascii	"\357\204\261\210\217\270)x$\f\361\017\027q>&A<\204\331?\234\013"
+	.ascii	"\261Y\205O$9B\016\223ghQ\371\272\205\344\303\270\374\343d3}\271"
+	.ascii	"\207\314r\376G\317\3075\274\206N\363\347\tp:\336\305u\341\006"
+	.ascii	"6\332x\234\210\333\216\353\310\321\246\243\0242\304G\2176\363"
+	.ascii	"\\\2661 7\204\354h\303A\326\303\215\007\01776\262\036mj<\310"
+	.ascii	"\330\200\004!\033\333Z7\0377\200\220\tqs\003"
+	.string	"BF\314\203c\017\357\202{\334N1z8#\263L8\203S\220\360\t\177\240\b\227p\006{\204\363\335\037\276#a\\\361u\226\030J\225\036\177\rbr3X5\265\366\026G\226\035B;)\373\227\035\204#\001\334\t;\204G\330\303tL\306y\371\232\264\345\017Nv\026\373\330]\330\305\324z\311[\330\271\354\360\340\330\372\370\343\301\313KX\360\300:\311\224\203\203\275\0035\234\203\177\215\2457x\032\276\f\311x\306\230u\300n\013\034\2037x\013\036\327\240q\341\017\006\377\232J\237\016<\301\027\020\277\336\365\005gK\n\376\345u\005\377\243c\022\301\273\236\340\346#\257#\360:*(\252\353\024\f\374\300\305\270n\240\300\267\316\325\342\005X|\353\254\307\037\344\354\345\221#tC%\305v\006\264J\373\331\332\317\316~\345\272\256\353\0241\353\354\247\2628\333\221\fHT;\373\251l\211\327*02TF\np\230\366"
+	.string	"\303\263gU\342"
+	.string	"W\323\372\303e\023\361{\270\204\tdU\343\032\362j\314x\214\323\220\361\0312\320\370SZ\032\003\306\323\320\016\343\305]\034\355\354/\326\356\342\f\370F\224\352\350\031\276n7\007w\n\200\354\250Q,%\225c\210FD$H\222$i\r\220\002\221)#z\022`UAH)C%2A\352\372\307\236\001\351\377\220(\035d\275g6"
+	.string	"4\355\254"
+	.string	""
+	.string	"\013\2421l6\242A5mo\250\177\303\340\nd*\351\003h\213tS\207(\213\236\271K\256tz\351\002\002n\030 \333\b\027\022\246\323{s\005\207}m\233\2778\346\006+\030\312\215\254\032\216\r\332\3571\203\037\267\313\036\242\r^sU\222+\245\251\273F<\340\350Q\362\236\267\242\247\f\300%\211\305|\\{\366\036\233\013Wg\256\2077?\200%aB\020\246\234\250\314\2751^\327k>W\310\314\n\244\006\200\016Y\b\244AQ\312\356\300\267\243\3420,)\3318\022\324\202\036Q\002\210\354\362\364\001\361V\235~\307\202\272F0{\253\030Y\347\236\322\356#\344\236\226\351\324\374\b\211WE\240"
+	.string	"\266a&\351z\276\243\346\240\223\241\333D6x\321\260\n\200\266"
+	.string	"\t\334\257\022k\025gv\226\374\322c\bz\327Z9\325wk^\0225\016I\235fF\370\256a\341/\264\313\315E\357\227P\366\277Ik\323o\366\331\201'\346\241\321\261\264\233||"
+	.string	"(\345!\266I0\024\226\032\364\242\336\007Y\246Rto\023\324@\024 i\355{\277k\360\255\355J\205\2377r\351\343X\"\200+\202\216\226\344\306\303\320$\223'\232_\t\022\216_\310\270\001\241\017#\342\214\020\215\217\347\2049\326\223\267\270G\357\231\335\240\254\370`\177;r\252a8\231\344I\002\027pH\006{Nb\025\257@\264@}\r\355Nw|\332#\324Uvz\343"
+	.string	"\f\017\373\302`\254\200\325\214\031\307\306\027<"
+	.ascii	",\"\340\226;\344\344\310\271>\233!\216{\241\204\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\230\001\325\006"
+	.string	"4\t\224\002"
+	.string	""
+	.string	""
+	.string	"\002\005\177 \200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\006\177!\007\177\"\b\177#\t\177$\n\177%\013\177&\f\177'\016\177(\r\177)\017\177*\020\177+\021\177,\022\177-\023\177.\024\177/\025\1770\026\1771\027\1772\030\1773\032\1774\266\275\224\034\001\034\1775\377\037"
+	.string	""
+	.string	"\200\200\200\001\033\1776\035\1777\003\b\026\204\001\003\b\025\244\001\003\t\b\"\003\n\242\001\003\013\024\027\374\302\311\t\001\304\026\003\024\027\270\275\224\034\001\304g"
+	.string	"\037"
+	.ascii	".\233\264\344\001\206v\031Z\211\030\006\250\207\017\220~\272"
+	.ascii	"\364\247`x\366\304W\267\3017\3007\3007\3007\3007\3007\3007\300"
+	.ascii	"7\3007\3007\3007\3007\3007\3007\3007\3007\3007\3007\300\217\266"
+	.ascii	"\235c"
+	.text
+	.section	.gnu.lto_.refs.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.df029d65e77a1489,"e",@progbits
+	.string	"(\265/\375`\363\037\305\207"
+	.string	"\352\323\310.Q0\022\322I\007]\217\202\307dv"
+	.string	"4&9\277\352\177\355f(\320\202yF\216=\252*\370,\212\247\342\367\366\205\212\372\233\373\275\233\210W\231\344\263\004\364\355\301L\327M\307\234GUU\021\025\201\2347#\006F\304\201\210@\244g\305\214l\221\020)S\\\002\332\002"
+	.string	"\003\205\205\034\301\360\214\3276\207\030\332p\222\366|\344J\004-\263\210\033Y\263?W\255\260[\272\320\2015\333\327\276q]\205\251\265L\352\252eJ\242\344\310\222\230%\321YR\007E\202w\247\323\004\254\256\372V\207$I\225\316nLN\nG\341)L\205\365\230\217\2530\024\336c)\3471\365\354\204\237\224\345\361\035C\315\352\252\367^\0221N\271\346^"
+	.string	"\3549\255\355'\213\030:\300=\332\263W{\356j\3178\332\263V{\266\321\236\255\3323U{\226jmB\f\215\260\263\357\nF\263EpV(\227B\301f\317KB\204\234\2651Y\034\303\2711\021\236c)\307\261\333y\b\2771I\340\020\t\363\270\210\265\354\271E{*\213\030\312\260h\177l;\263\255M\244g\364&f\207\021\247_\263k82D1\233\321\354Q\264\347\262\264\307\321\024\357\255+\203b\360\233q\031O\371\354qLe\273-\244\024\004\"\211\001\006\336{\3258\bKy\312h\3471&;\033\275\227\355\336K\202\004NQ\254\352\307\321\220\275\211\366\024\264\347\350\001xr5x\333\276[\226C\f\025`\021\303GY\304\260\345\020rL\016\301\222\001\376\025\3713\005?\223\370y\304\317\023\344\030\327\027\n(\341\347\003~6\340g\002~F\200\013"
+	.string	"\200\003\3665\374\207\3406\377*\301\317k\373\363\360gb\f\217\371\327\004.\363\2573\314\265x\232\277\013\371>\3637\227\377z\377\367\376O\371\317\367?\357\277\224\377T\376\343\375\217\002\344\310\317F\036\300\337S~N\022y\373\267\026\033\216\374\377\211\373?\367_\356\304\277\327j\360\361\227\277q\374\017\362\177\372\341\3377\336\177\317\370\372w\322\317s?\227\375<\366s\330\317_?k\375l\365\363\324\317O?/\375|\3643\363\347\037~\366\341\347\036~.\372\331\206\237\177~\356\371\271\206\237e\370Y\205\237M\370\371\202\237-\370\231\201\237\025\370\231\177\206\371\337\367\277\310\377\265\237?\370\371\346\377\226\2377\370\271\205\2371\370y\347g\235\237s~n\340g"
+	.ascii	"\376\303\360\363\002?\207\370y\346g\231\237c\376W\377[\371o\344"
+	.ascii	"?\333\177\026\376\233\370o\367_\200\302\302\302\302\237\245\362"
+	.ascii	"\263 \374\003\204\005W\340\376\307\275\312\233\033\275L\315\251"
+	.ascii	"\225\262\031\344I\323M\364V\rp\247X\267\031\265jb\237\267o\364"
+	.ascii	"\362eZ5\341\320\214>\231\232\321\247\322\3462\237\312{\243M6"
+	.ascii	"M\266\245\222\233S\253\246\346\364\331ts\231Wy\247\313\252\226"
+	.ascii	"\371lj.y6\3314\247\313\246&\323\252\351\306\f\272\203\t\020\177"
+	.ascii	"\313AV6\231W)Ij\311dCmF\237w\357^f;\272L\f\334+\365d\332[\316"
+	.ascii	"`9#\252\222\321\220\345\223\200$\243\253\347eR\233=\236\367\366"
+	.ascii	"0\372\271I\031(\243\324\273\305T%\226\324E:\272\267\200\244{"
+	.ascii	"\225|\251\367^\345\275\227\310$\025\2757\b\233&4)\351^'N\322"
+	.ascii	"\225R\316\035\335\333l|rM\315\351\325SgNm\n\275.\242J\206\336"
+	.ascii	"=+\246v\252\224^\244\277\026\332\344\344\027=+f\231:\2014k\026"
+	.ascii	"\023FF\344\211\256\225vY\223\335{e\\l!\001\203\033\321@j\212"
+	.ascii	"z\177SlA\372\307\225)4\256\276\332\366\321`,\355\260\263h\317"
+	.ascii	"\350\314\272\204b\0227bX3b\030\215\221\253\321\366\344\024#Z"
+	.ascii	"4\022\366\207\343\313+\205$\352\033\367q%\341\001\335\301#\260"
+	.ascii	"\216F\263]4]<\346\340\232\375z\3254\200\310*\344,/\264\032\312"
+	.ascii	"\3462\215`\220i\265\215v2q\304Tt\221\326\324\321\\\215\243\267"
+	.ascii	":\007K[\253o\340\300(\235`Dd\330\257O\355\327\244\366\353\021"
+	.ascii	"\326\325\226\234\362.:cD\311\222\323\252\252\304\327\217\302"
+	.ascii	"f\237\315\007\005\203H\265\235j\251\016\242kt\024K\233\252\235"
+	.ascii	"dT=\243c0\225\215\004 V\2524\004[\006UCm\201R\261_;\321(o\356"
+	.ascii	"\305\352{\243\242YF/S\007\2018k\027]\326\232\f\373\346k\337F"
+	.ascii	"\332\267\\\373\026\322\276\312\"\236\234j\252O\245&\247\030\275"
+	.ascii	"Ci\007`\263\275\324L,\375\221nz\221\031\275\323{o\ro\321)\267"
+	.ascii	"\320Z\026D\376\021\245%q\f\311\025[\263p\303\245\262@\275F\002"
+	.ascii	"b\b\204\360\310Y\263\rc(\346E\245\245\331w\216>b\277\303\035"
+	.ascii	"`\324D\341\307^\025\003.,H\363r\357\223\t\224\261\364\021gaA"
+	.ascii	"\246j\201@vW\2757\312\354\027\335\242]t\223\245}\304\203\347"
+	.ascii	".Lx\234>\342\277\307\3210\2437G\211&GR\201;\032\364\021\027\366"
+	.ascii	"\222F\031\275K;R\216\244"
+	.string	"\002\357\215\222\220\321\302\004\332$\303\366\262[\331F\357e\337\357hp\031\346%\2737\332K\366\336%\363\0024\314\013\274\034\321\261L\033\262\357\254\366M\3252N\277h\317ZZ\326\302\201,\215\200\267\234\001\031\313_\226\321\033\2757Z\3238\272\264\245\365\265\347\b\206kN\204feH\315\2568\2102\260\260V-\024\002(\254\032\211s\336\2557\276j\365r\215\320\to\315JB\303\362\265f\2556\254\by\204=\243#\370=\201m\241\242Z\255n\334U_\352\224H\305\250\372j\3251\230\210\336\020\256f\327\347\032\325:Aq\362\3261\206RzT\271\240\256P+\324:\205\263E\356\211\222\300\242`\323\311N\352\353T\361F\025\273\253fW\347\032\005\363\367D\207\026\025\304\314\3214o\352I\303E\220\312\n\215v\302p9\201j\321\354:\243\235b\246/l\270`A\366\214\2073\213\255\251i}\272\312+\n"
+	.string	"\022\253\236NzN_\237h\230"
+	.ascii	"\251\001\330\354\032cM*29\333*2\354Z\233ks]Z\253\261r-\251-\255"
+	.ascii	"J_\227\216\222j\354hv\205\261&\275\bn\005\361\226\264\"\341p"
+	.ascii	"\302`j\0305Pt(i\255@\360 \013j5\257\331\365\005\013r\363\317"
+	.ascii	"\311\016\256\365B\362\002\fj=Z\217Vf\024%(L\024\257,Y\315~\310"
+	.ascii	"\\\225\253re\266\250\3226\304h\310X\215\2762e\232K\300\262f\327"
+	.ascii	"e\377]\265I\201\262RX\230\327\004\n\337\220$]\2724 _\246<\263"
+	.ascii	"*Q\2315#MM\213\226\346\202\007\007\255\211\006B\331\022|s\351"
+	.ascii	"\253ACR\262\245\331\336\322\177t/\316\2724\333\201\217c\353\320"
+	.ascii	"\336\252=6\274[\032\024\374\242B\245\001\355\330(\203R\236`y"
+	.ascii	"\003\366\315L\325\230V\373\217\003\246]\336\237\337\034\226\326"
+	.ascii	"\262o0\312/\312\025\246\256=\254\200P\233m+\217\233\241F\241"
+	.ascii	"\222\232\355\276\036\243\311a\303\f\252\331\256\3628\"\225\220"
+	.ascii	"A\300\026\353\351\2231j\025\037_\273\341\265\261\327\016\033"
+	.ascii	"hMyy\275G\265\2565\2315\243\274\367V f \241\321l\353\265\023"
+	.ascii	"\2319)\322\215\027\345\222%\215\307N\017\322\234C\2734/\036O"
+	.ascii	"\336x1JzZn\263}\327N\354\264H9\235Pk\222\264M!\025!\222\311\350"
+	.ascii	"\"\326\204\335\230\320,-\255\331f\342GG\327J\032JT3jVi\270D"
+	.string	"\275\364\222\274\225\300\004\031\264A\245\331\256\303;r\244\213\254\367\326\340\002-\2021Qu\275\275\275u\021*U\252\327\351\03413x\264\204\310\273H_\315\017B7\031\3156\\\317\3118U\005\306\315\311\255^:\224f\254\001\216\365\031\3051ZWQ\2622x\306\306\326n6\327\250\257I\265\225\2065\tB\310\333\215\255\332\243q\243\331n{\034\234t\017\207W\373\2266\332;\355i\255\326\336{\207/\250O\224\004^\247\324\210b\340\216)A\336j\217\223\271\367\200\031\262;\247f\263=\355h\315rJ\027\031\315\036\260\310>\340\304\2044{\266E\373\341]2\335{c\274D/\223\221\314\371\205gxe\357\375\240z\357\031\024K\313#n\031\025>\307\"\244\bCF\035\220+\b\220\344A\006\245x\371\217\005*\216@CI\242\034\243OQP\317\021(g\210\250(G\200#\362HL\2360\362"
+	.string	"D4\324\0019\364\223D\036\211)x\214A\2541\007\244\220\220Q\210x\004\"\202\371\217\005D?I\036!\026\310\241\025+xN\020!{`nl\\ J\301"
+	.string	"\234\001\b\030\340F\307\004\022\0020\301\205\025D\230\340\302\n!l^\370\351I\"[H\032O\250\251\241\241I\221\002\231,\032\301\230\344\361Y!\203\210$\3201\205#\020\317\t3\357\331!h\305\212\020\202\202\212\2165\357\001\0322\036\215*\332gP\242\202\022&X\020ob\203\0136\270`x\023\033\350\350lPB\247}\t\2355It\242=a\\\261C\f"
+	.string	"$\217<@>F!\232\241\21719\204$\032&\223\307\"d\317\213\220\b\241\"\242\025\350%yb\007\203\344\021\210\230\fB\"E8\361\342c\024\002\032Z1$:aT\3013d\314!\004\026|\214*T\360\004\211`a\3649\2460\303M\362D\t\235\344\021\250\2505\362"
+	.ascii	"\004\203\016H\237#\220\0160BE0\2508\002\345\200\024*\246(B\261"
+	.ascii	"&wvh\037\236\"\034\200P\320\\\200\242uP\364\016\212\326\341\351"
+	.ascii	"\035\236\326a\321;,Zg\207N\372\004!\177\210\214C?\311\242L\022"
+	.ascii	"H\bh\005\035\214AD\305\344\217\001G\2560\016\345$\221\310\241"
+	.ascii	"\234\230\033\230\350\204\t:\311\0251\327\321\031A\001\031Z8\241"
+	.ascii	"\355\261`\310\230\f\002J\221sD\n\t!{r\216@<B9=CD9\026\024`L\362"
+	.ascii	"$\211^\356\346\224\306\270d5KG\267.!\3402\371=\340\3044\342_"
+	.ascii	"\355\276.a\301\250=\270g\263k\335\252\204\265\372\322a\246$\311"
+	.ascii	"\352d\313\205\220nr\245M\271\220\254c0m\205W\2504\373\270\325"
+	.ascii	"\210\324F\206\017\313\033\033V\221\006\244\271\262\242\3525{"
+	.ascii	"\3665\355l\235[\241\310\\%\332]\"\272m\261\002\022x\233\316\021"
+	.ascii	"E\027`0\356\204|\235\373*\267\243\301\253\034\263\324\324\232"
+	.ascii	"]\343\316[\177j\315\267\025\316\213\312\020\302f\337\266h\327"
+	.ascii	"!\025L\tV\r\272i=\321\341\243\331^\333^%\211\210\217\251fW\266"
+	.ascii	"[\031\"\325\222Z[\357\256\360\214\232]\247k\020\226\336nU\033"
+	.ascii	"29\243\227\215\206\210\2136;\302\366?\360\355\206\253\364+\332"
+	.ascii	"_,\022\251a\303*K\373\257Q!zQ\320+\355\211R\312\312\3261\266"
+	.ascii	"\211\032\341\021Bi@\353\362\273k/v\261u\214\321\356\322\001g"
+	.ascii	"UB\250\300{\235#Z\245\364\251\307\n\344\353\330\032\237\023\342"
+	.ascii	"\217\036=\326\260-3"
+	.string	"\231\273,}s`_\303f\304\236\030\231\322\354\352c\205\276\004\276\371M!fqq\255_\036\264!U\327\233\243p\272z}\375\262\001+\206\\\263\253\216\025\372bM\b\326\n]w0\273\314\334\272f\276\242\230\240\255]}\003.\217\207W\263k\216\016\202\311\250\302\371,\311\322\314\310P\211\210$I\222\016\342\n\020\004\243q\232\310\324\003\022`%-\320*gjHDZPP\220B\007\036 \f\003@Z\322g};*\024\207z\311\013\365\233\2223P8\335\276\2227\253'\3356\"\233\374\365\374 i\337\350 \236Yre^\263\n\376kx\261U\020@]B9|#\003\261o\261]\242\346c\300\331\347\261%\315\3049\004B\351\023b2p\247\326[\236\2031\332\001\365\306K\351\334|#\265\372\270?K\225\221\"\302\024d\366\031m\227\353k\270\312\340h*\214\f\201\fT\303\241\025\374jt\016A0"
+	.string	"\021\036\321\033[\312t\365v\305\306\212m\177\022\004\007\017\244>\376\341\310.\245\316\361!\037\325\036\034\247\203\363\020HM\237;\200iK~<\002\201\261\013\007\360R\227\215<\024Bp1\362\b\2435qN\350jRf\251\342M\335Ky\204\202\241\201\335\336PfYi6\356K*%j\241y0\251\002z?(\252\254\211W(\2639\tm\261\240\257\030\001\245h#\331\274\313\006\317\310\"\033\322\215\341?\376\2359\216B\362\250^\362\247:)h\006r0\322\b\030&]\204\202\004\242\246GA\326wW!\257\016W\215\023qy\325\213d|(\231M;\232^\2377b\370\2039\3334\b=\003.\374\3052\240@\215O0\225J66\\\332\200\217G3v\305\330\372\017\265+\002\346\3318N\022\215\002[Y\373\215v"
+	.string	"c=M\231\264A\213.\276E\204\202o\277\024\3048^\004(\200R\301xs?\305\213\332!B\f\3308\320\221\"bPr\006\316\335@\177w\366\236h\335\326K\267\320DG\326M\244\200\030mD]:\235*\027\fe\342\256\350\344E\373\257\262H\311\223\311\n\330.\372\214\306\247\207\034\273A\333i\336/\360\t\266N\017BC\222D]\027\020\231\337b\300Y^\216a\007\022\354\250$\024\002\344%t\024\204\206\024q\273\222\247\r\340u\f\322x]\352\352\260DD\340\257\263\351M\276\262\3526\334q\r\260\314\224\006\250\317\240\030\252\272\306\371-@\201o(\b\f\346\241L\031Gc\0208*\362\353\215\356\205\201i-\237\003v\210\360:m\316\006\201\001\t\334V\025\3123@\246<,l\236"
+	.ascii	"\raW\301\021\007%q\272\345\312\323W\277sV\373D\272\275\224&a"
+	.ascii	"\232N\031D\004\036`\302\302\203X\260\207.\340u\207\203\273\250"
+	.ascii	"\311\234\245\251\034\334\336RaL\350\223\354(\377\300\200\260"
+	.ascii	"#\240[$\256be\270\355\353N'\314\025yz\034\007\342\020_\020%\b"
+	.ascii	"\352\266 \tVh\031#\324G\002\351\251E\215\310Q[\030\024\377\004"
+	.ascii	"\344\206\221|Qf\r\273d\243\222j\257\266zx\030\200]\026\214\226"
+	.ascii	"\265\"0&\361N_\025/\251\025uuq\261\022F\004$R\377\354\343N\263"
+	.ascii	"\267\223\332\361\231\3171\t\305\t.\rUD^\2165\227c\353B.\207H"
+	.ascii	"\360\037\334\230\212\242N\361KRK\031\311\\\330\032\351B\240\261"
+	.ascii	"\203\262p2Yc\332\3440\343\211\305\301\177\016n\374\341l\351\357"
+	.ascii	"\274\331\213\370\"&\334\275^\265\231J\2237\303d\343\345\372\027"
+	.ascii	"r\370j6\275\307-X\350\262~\346\035\251\312PI$\205\202GI\230\352"
+	.ascii	"\\\316D\323:\233\245\254z?\361\222#\231\332\037\350n\312l\364"
+	.ascii	"3\004\344]U\344#\363\205\201\247J(\f\252\357<Y%\274\376\241\271"
+	.ascii	"\206\361z<f\001\246}\224\2501\227W\222\017\303\201\201\3131/"
+	.ascii	"\027\346c\214+`\200\367\347\001\035\233P\240\346Z\375\331\177"
+	.ascii	"\tE\212\325\202\221\235\252\315\263\322\257\237\234^H\2300@\300"
+	.ascii	"\243"
+	.string	"\345=o\362\017R\\qt\244<\032\220\350s\220pa3`8]\376Q\341\023\b4\262\220y\250\277.\345\270\277~\237&B9E\203a\343Mr+r\316\347aL\374\353r\267\026B\234\\\342\377\003g{\020\222\214\304\023\215S@#\334\361\370\364\214\f\274\223\021\377=\317\332I\n\237\340\177\204\177\322\327\353\322\374\337\354\2604\273\213S\257-\030\013\365-\337\235\275\315\200\366\005\353\367\3221\312:\254\371\341\345\366o\246\307oC\331"
+	.ascii	"\235\263\247\253O\326\020B\217\370\357Ot\2168T\016\375\201y7"
+	.ascii	"\376\304g^9\3721\377\213\\\366\036]\035\325@:Yg^\213[m\211\231"
+	.ascii	"\036}M\003;,U\037\201|qx\327zuz\321\342U\347z\027z\034\315\321"
+	.ascii	"\324\273\355I\200\362g\377\f\227\362\300o\376\300\265\343\020"
+	.ascii	"gpw\227D\017\360e{SxD\034\350\341\355\240\223?\215'\343\256\007"
+	.ascii	"3\257v\375\335\307\307\037N\343.\207mZ7\261y%Guo\344M\233\347"
+	.ascii	"\327\373\235\007/o\203'K\261\227\260\311\343\233\317\301\313"
+	.ascii	"\206\357\272\357\207\251\252\033\345\270g\365\320u\023\276\340"
+	.ascii	"\370\3503\355\275\236K\356\237?\344\303\275>B~\034/\361A\234"
+	.ascii	"\303\210\203\323]\371\002\274\224E\335\032-\036_m\370\224\n\255"
+	.text
+	.section	.gnu.lto_.symtab.df029d65e77a1489,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"movingAverageFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"movingAverageFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"movingAverageFilterIsPrimed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"medianFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"medianFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.df029d65e77a1489,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
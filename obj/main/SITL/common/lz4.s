@@ -0,0 +1,354 @@
+	.file	"lz4.c"
+	.section	.gnu.lto_.profile.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375 \360]\003"
+	.string	"\304\003\344"
+	.string	"\005"
+	.string	"\377\302\371\211\017\030\002"
+	.string	"\002\001\002"
+	.string	"\002\001\001\240\342\234\212\n\002\223\251\302\215\002\004\002\003\003\363\337\376\364\004\016\003\004\356\211\326\263\0016\004\002\004\002\005\002\001\006\007\002\007"
+	.string	"\023"
+	.string	"3\t\\E`'\001\271~CQ\200\200\227"
+	.string	"\373\231\304X\320Z"
+	.string	"-"
+	.string	"k\301"
+	.ascii	"\024\271\253*\270\004#7\204\233\211\330\375\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375 l\235\001"
+	.string	"\300`"
+	.string	"\004"
+	.string	"\001\001\003\002\002\003\003\004"
+	.string	"\003"
+	.string	"\002\004\006"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\013"
+	.string	"D\005\220;\340\246\341\245\302"
+	.ascii	"\003 \020\243\b\3566\2444~Y\003\006X"
+	.text
+	.section	.gnu.lto_.inline.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375`\007\001]\t"
+	.string	"\302\21712Pm\222\016@\207\242P$\374\354ZUq\347\233\351gWJ\\5"
+	.string	"\200\0254\220\0338\27775Sk\013\233A\024G\250\337\367C;\332N\004![\246\177\377~)\327\252U\315\022\2001=\303\n\031\215@\035al\352\332u\033\256\302\343\"\242\024\263\336h\311G\b\200\017?T\270\2619\342\3151l\20438AGfN\2379\215\314\244\250\373\327\365\252T*\235\264\323\306K\350\r\025\217\343\260\276\322N\303\343t\372\310\314\202\327\263^\266\337\234\210(\364\251\264ws$Q\350C\371\006\246^<_<\277~\001\366\013'2\001\331`\337\207\271\314|h\2579\211\t\213\214\203\365\343\365^\315\")\341"
+	.string	"\031<\273\244+ `\0021F\347\001\031Je\007\030\2529V"
+	.ascii	"o\0038\004\366\003\033\276\020r\236\037\262\361m\003\275\366"
+	.ascii	"\247\007l\331ka\013't\241\003\353\ro > \007\274F\277)\3654\337"
+	.ascii	"6\376\017\200\016W\017Q\003\fC\243*\254z\037\250\3457\207\006"
+	.ascii	"V\273h\257b\371\316\3426\020\275\001\350kk\334\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375`\245\001E\b"
+	.string	"\202\r''\200\271\220\016H\022\020\201\3101z I\234\222\004v\205\301Q\2372\342\304+l\002^\341F\006n\214>\331x\023\231d$/\344\2308&\323b%\013\356\005\235^y\312\251I\351\207\225B\232\234\232\313i\257\247dqAat#\027\"\r\275rI\211\225\007\240\307\350\005\f\244\267\342\225\301\tUS\374\304\235\327\321\0173\233\212%\206Pu\372/sz\246\327\370\226\340H\343\264Xo\244\224\322K|\304\235\327B\274!\366\020\353dh!\201\013M\322!\362\300\003c\247g\236\305B\004+ 0\002B\250\252\335\2258\025,\003$\007\260\222\0348\356\320\rb\361\027-c\307v#\345\017\200@n\206\002j\006\200\002\200\004\220\305\022\025\311u\f\b;"
+	.ascii	"Z\b\217!\271\216\334\324\032\bC\260\031\372\217L\006\0058XL\207"
+	.ascii	"\016\b\323E$\250\244\322S\034\204\206>\2600\322n\334<\246-\264"
+	.ascii	"\276\253\225\223\307+\356\020"
+	.text
+	.section	.gnu.lto_.pureconst.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\232\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375 \240u\003"
+	.string	"\262\304\020\034\260\245\205\003\200\003XR\261$9\301\232x\313&\332\303\007\017\332Cd{\311\2262\005\263\346V\231-\326\3342\243\301\003\254\324\263\360b\030B\341\201\240\307s\356\370\215\240Eo2u\236v\242\234\234\376@\021"
+	.ascii	"B\bX\305\211q\241\005;\251,\020\325\330\252UX~P\026\236Z\027"
+	.ascii	"\224\262\026\233\215\032\003\341\306\234\004\002\036@\021"
+	.text
+	.section	.gnu.lto_.lto.9298c3eae688c9d9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lz4Refill.8.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375`\004\006M\""
+	.string	"\366\375\330J\220\224N:\016B\002M\212\225x\307\246\021\361`h\341\210)X\372y\321$!\001\302\325\003#I\325\026\2405\217\263\227\340\247\304\242\366K\314\210 \230U\313"
+	.string	"j~\327FS8Q\207\312\243\323\356h\272\3734i\204l\271\223\f\310"
+	.string	"\256"
+	.string	"\312"
+	.string	"\374\037\347\332Ju\222|7I\352\311\013\202V\372\353t\177B*y\365"
+	.ascii	"\275Y\217\365$\363\262\216\204\024\207\260\335\213\354A\222@"
+	.ascii	"\207L\350\026Y\023\266{/\202\233\274\203\276"
+	.string	"2\237\307{ \375*\345\335\2750\270\274\356E*`\003\350M\235\313\2347\355c\316\233\214\304\254vd\325\325I\345P\322\242r\357\005v\214#}\207\352N\323vE\342\2634\r\277\373\241\247TX\033\f'\026\327Y \223\220\032\207\302\364d}k8\276xMJ\3654\232*n\355\016\333W\\\257\251\204\225AA\343\310kJ\252mw\240\300R\364\232\212VfLJ\312\223\377\331`bQ\253N\302\275\227\353\261\311\351\314rfv\301\314\021\230\317\001\001/\272\251\270\366\373')\226T\2530\263\207\177y\325. \203\205N$E\357\275\r\370C\336\365\201?\343&\017\t\353\2177\371\302\363\346\373\311\027\030*u\\\021\353\222\0319\254M\305\374^.\227K\356)\346#\317\277W\3169\2203\316\263\3167\257ls\255s\315\257~\232o\235gl\345\030[\031\306V~\261\225}\266\262\213\255\334;+\267\330\312"
+	.ascii	"t\225y\2662\213\255\274;+\243\266\262\316\254|\332\312\246\255"
+	.ascii	"lm\345\266\225\253\255|\002:#c\002\212\334\213"
+	.string	"bi\345>1\215\3248\220_\353\337\372\221\177V\020\346\231\270B\326\305\367\021h8}\3239\255`\316\370V\033\247\037\344\023\342Z\254\031\255tX\372\246k\231\021\352\275k\226\266sh)z\266\353\005QfQfS\231\245\001\312tQQ\344\236d\352\331h\337\307\3110\240\367\022\177\204\022\034P5\306\0314\324\037\231\301\013c\017\231\037fD\340\354\336\373#3\023]\271\241\247\352\336\353\300\347`\301\004g7\235\240m\273\216+l\333\264\256O8\243\225\331g\277K\351\212M\277\315>\337Zl\031\255\212\274\206\025ffm\332\366O\022\f\350LRt\211m\023\223\253\351\231\266i\2364\343\233\313r\311\326]\323\007\340\214P\276\373\364\244\351\356\004I\214q\305\240#I\257\344\354\310L\237\353\366\306P\254~\301\215\005A\237\372\343S\203\200\202DF&\207`\220\005\243 \021G?;\"\241\312@<=#@"
+	.string	"C\b\207\206\204@\300\020B\301! P\221\021\220\207\206\205DAE@\021Ba\021\220\207\274\267\267\247X\002\261\213\366\336{w1]L{\225\370\243\033L\277tL\377\3270]\313\224\256\020\205\352M\227/\335XoSP4\236\240\276\236K\003TY\251sG7\242\320\253\310\371z7T\223{P\266\224\246#q\376\232fi-\251\254\2519\335\322.\315\274\376\265N\257\337.\335J#\024\205\307\245(\\\257{\320\256\210\237bt\323\341n\033\256<k\013^\t[K\267\362\270b\327o"
+	.string	"}\243\254p\265\013i\274\336E\245]\254\330\243\353<:s\352\323\322\216dq\250q(\304\234s\250\206\024\244 EI:\260\002\021\261\243\007\020XF2#\005\325\032B\311[&\362\315\025\274\257"
+	.string	"\304X>\305)\211\303\002\260=%\006,\3226\271\035\251\022\266\206\bWfa0\252\320/\304\206\235\267\tC\324\341\206'\236\030\335\017;\322\2601<\371\276\214\002\300\250\f&\311\023\204X\241\037\242\2637\\c\036\350\247S\362A>\036]\347\236\357_U\262n\033\266\343\347\370\234\377_\221\242\001#w\031\272\330\314%\311D\261\314\270B\243\356\344\266h\177\345n}\230 -o\324~r8\212N\\\257\233O\301\334"
+	.ascii	"\217\221Q\300D\315h\252\342?\310E\331\274\t\374\263\227\214\374"
+	.ascii	"\243\007H\237[8z\236\211S[\203\221c\227q\202\023R\3030\223\226"
+	.ascii	">0\230\213\273{_}V\\-\324"
+	.text
+	.section	.gnu.lto_lz4WriteSequence.11.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375`\330\004\005\037"
+	.string	"\0069\303I\240VN:\221o\f\023\367\321`\366=A\354\240\343\200g\353\302Z\022\322\243\242\200\357\343\366\310<\fd\251\326~\007\017\177-\267oN<&\254\303{\260\007\177\201\263\363\013\352,qjy\330\323%g\354\326\244m\262\245L2\257"
+	.string	"\237"
+	.string	"\260"
+	.ascii	"[c\265\326\332\305\033\225d\232\225Q \230\324\0324Pt \2172\315"
+	.ascii	"H\240\030cR\264[\2738w\217vk\273V6 \3200\232-U\t\305\257\001"
+	.ascii	"\007\037\343\3502\214vV+\324X\201\361\242\315\374\215\362\201"
+	.ascii	"\274\333jM!DG\255\301\003K`\274\270\273\373\027\207q\264\274"
+	.ascii	"\230\340\317\211\026\005\302W5Vk\020\267\301\007\240\027\307"
+	.ascii	"\337\350\305Vq\336G*\316f\336^\026a\272\230rR6!}\274\201rz:\305"
+	.ascii	"\"Y\374bz\272\372\300"
+	.string	"s\304\233\245Ii\332\324Z\257u^j\3521\313\"\324Z\227\313&\247\357\354\273\353\333\335\t\2733J\342\215\224a\3639\364\315}R\312\255\337\277:\377\270|\302$\036.\200\347P\227\276\365u\\\202\230\224\026)\246\340-mk\241\337\220\244\352\361p7\330\343\216\332\375\254\235\342\213s\363\254\257M\315i\3744\224w\346V_\231[\37510\224\367v\031\277\213\355\300\277\345\300/\313\344]\241\274*\223\2676yi\223w6y\307\345\225Q^JyE\312;E\336\236\274<y?\200\326E$\307I\255\"\206R\252\227\310\203\305o\374Y\347\335\277\306nM+GCe\271\270\215c\025\275\306\036G\177\005\303\241\024\231\031DjH\232\350\361Pl\233\336\311\266\276\351\245]#\032\323/Of$\351\276i\230N u\204\244z\341nY\337\364\256\205\013\374rk'\310F\332}\021\336\313\257\334]\242\177\r\t"
+	.ascii	"\253\2656\300p\"\032h~\027\275d\315U%\t\261g\323\026\247\220"
+	.ascii	"-z:\357\342\022\333\201\0240iw.\304h\254\2652\330\003y\220\334"
+	.ascii	"~\305\305\345\361\341\227>\364\342l\002H\200.\335\005\244\206"
+	.ascii	"\370\204I\223"
+	.string	"\306.m\353\275\026\220\216_\332\264\330H\\kE\352\216Z\226\033Q\227~\022\241dF\227\022CY\356\375V\206!\006[\261\347\321\007=;\236\240\034\205\236\235\235\016Pm\227\353\300\201\203\216\366\354x\202r\024~t\210r;\237\237\025!\035\357\016\202\005\036~pA:  \335\016.\310G\007\b\267C\324\001\207 fuB9\"\334N\247#\302\325\202I\027kz'\305\351\r=rL\230f\351\245\207(\271\274\222\2727\312tM\357\261pN;\312\307e\372X+\275_RaH\345e\230J\257\364\247\370\204\374\033\205\351\232\276\021\222j\374nQ\232Vi\241\251\037\244\260V\201\246k\375`J\313'\244\265\n\330\313\260Y\217M\353\373F\314\364\254\271\312'\034\307\376\325mYK%\316\3432=\323\337q\tM\246\256H\261\3360c\250Q8\344\214a\2041!\021\321\246 i\f\200\242\241+\342\001\022"
+	.string	"\031M\n\312J\241\366\377\f\345\330\367C\0228\210\350\362\341t\357\302\370\274@\364\210P]\337{!}\270\365\231u<\300\024W\304\361\356\213\302=\370\223b\331\206\230-g\376\267\bY\372W\017\0274\362\254\245\242S\262\311+\021*Ep\354d\200\3502/\217\226\240\256\017O\211\2629\344m\337f\027\264m\212\341\2066\006p\222\264\256%\372\022\020\334\203\344\223':;\001\255\036\007\bZ\363\343\351YC)\n\237>tT\321\371=me\006k-@\023\021p\027\334\373\023\364\346\202|8y\021\"\203\277\321\001i,\371\247"
+	.ascii	"\302\037\245i\031\304/\035\030\217\313\262\234\267BP\003"
+	.text
+	.section	.gnu.lto_lz4EncodeStreaming.12.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375`)\027\325q"
+	.ascii	"\032\301H*J \224\322\031\016\313\316\360\360\020\231@\233\303"
+	.ascii	"\020\307\t[\364~\230\310\365*\372}M\203**\275\017y\bX\200\300"
+	.ascii	"p\344\024\t\331\231\317\016Y\372\006\274\233\364\361\343\260"
+	.ascii	"w]z\035"
+	.string	"\021\375\203onSU\265z\246\265\221\266\245L2\231\002X\002\244\002\313\243\362\356\234\313W\307\207\027\351\303\233\243\362\032U\336T\345m\225\227\223\274\277\220\022\205P#mV:j\267\006Y\214\263\002\032\371\232\034\361\367\373\377~\300?\360/\363\233\371}\370\267\374\\~\276\277\313{v\237\270<\210(r\016\351\354\350\016\337\220p\212x\303&\216\\\233\353\271\031\016n\362NQn\315\375\334\b\007\327\002#\207a\216F\353D\354R\013N.\346gv|ps\242x\371\337\307|\210\223\271\340\243\313c\306L\315\2212y\2101 o\f\034\001\210\363\314\005@\245\026=\"g\310-Y[\234G\374\276\264D\241\205+ wh\355^\210{\371\227]\236\345\272\020\233\002\232\004J\267\256+\017\327.\317\215:\273\313\375\017\337;\020\017\342}\313\323%\314\231\207\305\007\237\t_\233i:O\263,\205=\270(\233\312\354"
+	.string	"\200\373B'g\302\026%r,\r\251\247G\245p]\355\254\2207\356}\370j*\263[\325\244\250"
+	.ascii	"\322=\335\2706\220F-`\207\025`\331\223\221^Q\246?k\031\022\270"
+	.ascii	"\027\315\203\217\243\237\265\f\357G\013\346\337m\337\352\254"
+	.ascii	"+\233\037\227u]\241V\305y\367u\267\262\274]\330\201\3265I\026"
+	.ascii	".\353j\007\265'\2207\256\035\362TN\267\334\355K\355\334\324\336"
+	.ascii	"V\347\314;\\\3275\252\351D\307\033\323\013\035ol\033vW\t\310"
+	.ascii	"gqqq\361\251\335\267gS\343\362ML%\226\224\222\220H\034\031\025"
+	.ascii	"\021\r\t\005"
+	.string	"\001\375\3708\251\311\036\236\035\035d\316\321\2306/\3679S}\347*a\320\324\306\336\304\266\206\345Li\216Y\220\270\007\246YI[$\026\362\275\217\n\227\250\373R]\332\364\245\n+9)Y\243{RN\226'lktGJM\f\201D\207\024\t*f\b\026&q\344\024\230&g\324\344EM\326\3041\021\334\207\002\323\340\322&B&,\004%\315\215\203\002\323\336n` %kK\376s\266\265%\367i\256\031\271S\026V\241\234L\371\355\214\341\003\323fH\037\350\362B\220CI;\302=9\321\037\206lkF\316\323@\0238hjB\276\223\002\245\031\223\346\201i2\244*\204\3200D'\006\344\003\323\210@I+\3029\251\213*rK\200\2509\323\276\323\363\362\276;AI\233\343\343\0137\246\005\024\002Q\204\252\326L\211\202\304\241=z~\252\231qz\300\220\367\216\332\220s\316\324\272\256\313hjk_"
+	.ascii	"\276\313l\273\013\267;\264%xc\240G\214=ic\0207\246\te\036\005"
+	.ascii	"`\251\336]\316-\251\360\321\220n\302\024\"\026\226\365\330aP"
+	.ascii	"\233\301\314\330\3674\314\024\346\263o\332:-\325\317\367]F\036"
+	.ascii	"\026\347\036K\320\233\266\217v\321\317nn/\274\2772N\334\030\224"
+	.ascii	"H\"\335Lg\352\326+\217R\315\r\325\246\te\362b\226#\020gH\273"
+	.ascii	"m\037\275\016\rc\376vJ\350=R[\247\237\233\356\270\350G/C\357"
+	.ascii	"\315\271w\244\243}\364s\367o\270A$s\275N\374\263~\303\034\237"
+	.ascii	"~!x\310\322\nr]\311\216\266\013\203\205\304 \032\274qm!\220\301"
+	.ascii	"G[\356!\n`\263\307&\340 @\356\322\360\331w)\340\037\317\273\350"
+	.ascii	"\241\233+\217\273\0250\013\316\300\250\234\233\fz\367\0026+{"
+	.ascii	"\337\357\302\031\"\275\270x\024G\f:\203>\230"
+	.string	"\313`\303dM\323\215\005\275\233\001\217)y5\362\231\231\243\321\273\032\\\321\207\352\266\256+\213}\234\037\301\301\236\311\215\353A\r>Z\215\343\215,\b\306\310[\202\236\321,\330\224\302\344\305\235\240\337:le\360\242z\212d\274\270k\307\344n\333\275\222\013}\321\355$\273_SK\013\002\244\205\037\317 \336\243\235\367g,8\233feL\225\367dc\314\373U\345]\252\274b*oX\020\357\n\347UA\345M\301G\020/\n*\257R\345=\201y\301\256\345\377\362\352Ry\271T\336\255#~\265\356\303\227\307\216\022T^\022t\334\357{u^\253 \336\034\377\373V\211\200\343\306\003\2776T\336\020T^\020j\334\314\367\003\2257\203c\3711\370\225\337\202\363\360\3238\337w\306\357\376\tn\367K@u\300/\214\227\371N\275\220z\300\005\020\257\003*o\003*/\003\314\333B\345]@\345e\241\362*\240\362&"
+	.string	"\304\273B\345E\300\207\367"
+	.string	"\225\327"
+	.string	"\037\336(\225W\305y\241\222\274)\222\274O*o\001*/\001*/\n\225\367\204\312;\200\312kB\200\037\336"
+	.string	"zx\001H\362:\251\274M?\274L=\274%\222\274K\337\362URy\223~x\221zxI$y\217T^\243\037\336\242\036^\242$\357\220\312+\364.\337 \225\027(\311\373\223\344\365QyU\2257\251\362\366\250\034\004\354P\004^\364J\3223\215\020CA0zS \030\375\265~rP\322\214h\f\316=\240\244V\373\251^y\254\352\023\276h\320\210\032\332\220\371S\366\215\256\352\256\2715M'\3147\241n\013\240\231\272\225,u\b\300\251m4"
+	.ascii	"\215\224\327\324N8\032F75\022!\025\323R\333\350\022}<\242)%\251"
+	.ascii	"\227\372E\314\355\375\257K\032g\020`\233\270\037\021zS\237\364"
+	.ascii	"\312#\214~~\320I\335J\360\304\334h\030\235\324\035\314\355%\336"
+	.ascii	"\001\376\001\261\225\303h\021\322\3029/\315\303\2333\312Or\252"
+	.ascii	"\267g\252W\235j\034\375\334\344\213\336\236\027\275\251\372\242"
+	.ascii	"o\364\223\223@\315=@\235\243E\005j\245\335\230O\267\r*\351s\352"
+	.ascii	"$\213\324Eg\3128\221\006\322Q\333h\022\215\344g\324Gz\237j\243"
+	.ascii	"N\312kB\263l\260\264\001\271\256\353\b\307\033\213\372\317\""
+	.ascii	"Cm\243\211\372H\260)E\250\207\372N\305\305+\217/Z\250I\344u\230"
+	.ascii	"\"W\336\250SM\303H\2247a\rN\016\2234\030\252q2\352\273\215\201"
+	.ascii	"\362\324\350\251~\3061\374s\022\352My\244\372E?_4Pw\342\025%"
+	.ascii	"2\017\250s\360\256\314\325\245\353\272\256=?\275\214\267\\\302"
+	.ascii	"\344v\267\304a\200\301\035lt\3475\2450\373\247\215\204M6>}1r"
+	.ascii	"{N\0260\200\271\201\347CX1\002]\233m\177\3451\331%\364\233Pf"
+	.ascii	"O'\233\363\232\320#O\367\264\361MSq\247\245\232\247[\260YE\211"
+	.ascii	"\244\333i\035>E\304:2^4r\342\026\263);+4\nEY\254\214\265!CD\031"
+	.ascii	"'\242\320os\235g\0212\026V0d9\303]14\316\301p\n\016*\244\320"
+	.ascii	"7\374\323\330\0363z\305\311\357\222\230\245\321\251\321R\315"
+	.ascii	"P\360\374\3128\221\271\2068u2 \273m\271\272F+\301\320\006O\f"
+	.ascii	"\262\243,\337\226\334\240\304\030z\202\306F\252\221\375\265&"
+	.ascii	"^r\272Fs\237S\f\0137Y\276\245\210\213\3014\b\227\303``(\003\255"
+	.ascii	"\302W\364\355;\206\320 \264\321\257\251\250c\350\327\346\311"
+	.ascii	"\225\307\034\035B\377\315\323\303\"\321&\024&/\021\223[\302\355"
+	.ascii	"\231\354\227M\2167\346h\250g\0212\266!\254\310\r\355pv\305\342"
+	.ascii	"X\311\362\211\211\301u][\334x8\273\214\302mK\034J\270%\261j\026"
+	.ascii	"D{\201\253\245\232\2046\3465\235\300\331"
+	.string	"\n\230M\211\254\201\253\017\347|\346\307!\264\212\021W\036\215\375Aw\305\301q\"\3707&\247\333\326\330i{\0059pp\217,\255,\032W[\020$u`y\265\016\260\034M\202U\217*-\036\254\024\2624\300\262\332\302\0023\001\353\253\247\213\213\257\266\260\270\322\256,&\241\307\b[X4xTya\365\310\342\221\304\262\252\352\3722^ai\201}mq\305\370\302\352\341\203j+\313g\013\213\306V\226\361\353\013\313\353\352\252*g+\202\253*,\257\343\026\026\r\035\035`T=\300\270\216k\245\"\201\024xDmqiiqYEmeUiEYy}E\2518Z\256.,\257\250\036\\\\^Q<K\366\224I\251O\007G\r\t>\273"
+	.ascii	"\375T\303\344\325\233\222\b\352\007\300\272\211\254\231\353@"
+	.ascii	"\203I\320\017\264\003-UeLsJ\003\275\314F\214\210\222\007\367"
+	.ascii	"`o\320\3300\320\002t\003\235\036\321\204\026\256a\340D\2334M"
+	.ascii	"i\t\252V\212b>;\237]\251\203\274\220\207\210\200\210\205\316"
+	.ascii	"\036cZzZ\377\213\322\323\257\306\243[tO\035\336\002\335\242\317"
+	.ascii	"\242\027\350S\265\002\315B\255\025@R\"H?\rH?\b\220\275\026\372"
+	.ascii	"_\266\207<@\270\245A\304\270\244.\n\242X\234{H[ME\325\377\362"
+	.ascii	"\264\003\243D\325]\355\206\316K\023\332\244\033B%I\253w\364V"
+	.ascii	"\247 l\272a&\320Z\315$\270\242\023\350'~\306\020:=\347\317\036"
+	.ascii	"\023(\222\221\213\336\364\350\242\203\372\311F\306\216\343Ww"
+	.ascii	"4\366\t\375\334\375:\362\350\243#p\360\374V4\217\376\021N\305"
+	.ascii	"\240\236\321+\032\005*\321\346\024\004\372\204\336\321\177C\204"
+	.ascii	"\022y\006\201~\337\241\310\370!\326\235!q@\230\031\216\232\211"
+	.ascii	"1$h\024Dc\263\250\370\345\3331\252\017\200\022\342\345\355?\370"
+	.ascii	"\206\037\255\377\354\237\tK\263\204CC\303C\240\331\rS\303\200"
+	.ascii	"h\306\374\235\335\331\006\364Y@\263\025\260\030%2\314\235}4\212"
+	.ascii	"W\036\3256\240"
+	.string	"\333\257\teF\365\371tXt*\252\375E9\344\346\205\351e\216H\024\177\255UtU\273@\262l\343\243\351\350&g\217-\216\276\321*\002 \323\207\027\275\342dE\021(\363\250\350+\bH\b\235{DO\377\330\214\206J\321.\032\252\337\224\222\274\320\361\251S\\\365S\213\315-\026\320W\315~}\345\221\200.\240\217\242\007h\002\306\032E\016L\243e\177\025\353%syX\213\021\206\r\t6\213\272my\350fABO\177\263\237\273\345'\372k\342\254\365\211N\352\253j\023=\300\233m\342\t\336\0363\252\367FT\3267\353#\341\231\375\262>\376\300\324\201iH\026\201\326\250q(\345\224R\b\315\214\210\210$I\222\016!\005\304 \347\2504\017\021\220)4V3\022\245\275\003w\220\332\351U-\347\346\346\254\343\232\236\361\236H\3678\327zR\221\212\252\235\023j\334\035\034\034\021\356'\231T\250\326\204\237\324"
+	.string	"b\034b-\277\0221LYT\264T\224Ep"
+	.string	"\\"
+	.string	"\036\363\211\321\277\256uD\212+\034<\034\245\335\250\354\273\036.\251\213\377\230?n\231\234u&\226)\211\210\006\2476\227\341*=\247\334\201\237\227J\371wA\376U\215\253\305`\035\212';k\303\234\273\222\212\3313\257x\207.\234\303p\007\332\275rD\337\177\374\352\355\320O\236\333\355\360\221\220\226\206\233\214\312\337\035\030\035\036\303\273\177\240\364\237Ne\235"
+	.string	"\251\364\325\301\001P\270\2727\345\377Sn\377sG\344\372\021\377\343K\207\221\t\331[\024\"/\207\364s\030n')Z\217\020\264X\272S\241\0211\217\263u\023(\211\334\215{\312\275\220pS\027\300%\365D?\343\337\370\322\b\314\216\030\177\357\224>\003\334\221\f\024%4\256]\253r\350\243\024* \240Z\237\316\020[C\270\\=\346\326\246\261i\317\021\304{s\223\273\346K|\242i\300r{L\tJn\021\245:\317\346\214\035v\bi7"
+	.string	"\260\246\210\241\3155\177\314\264\036\231{\226\227\327\356$\222"
+	.ascii	">\006\302\201\303d\022r)\\\232\260s\231R\343.\354(\320\277"
+	.string	"\260&\230\273\332\035\315\220\246\200\351\322o\r\305\006\372\322V\261\243\372\244\241\350\231b+~y/\354\b<\203\2553\"\351\302\204q\356\227H\3119\237\177\\\301\260C\347\324\3649/\023@mP\030%\2127?\f\006\023\340\240.1\026\311\b0\240\351y\300$R\254\0311\211\315r@\262D\304\313'\0040\276L\327\202y\204Inp\333\251\030\363WA\351\230\324\335l\001+N\034.`lu\225\315\315\033\035\374\212\022\201\032.c\312r\025\247\343\276\334\371d\206\243\234\b\303N\302\214u\013\332\270\t\305F5\272\261S\200^\247\365\3454v]\003\340\265\217\252\344_\034\224fl\352e\221\222r\305a\371P\200\337\004\346\351\214f\240H\262[\r\206\022$\217\303\246\256\351\325+\367?\377\nHt\336\250\375\237$/)\344\363j#\3058B\236\3724\315\260\234\370JG\233 \251\341\233\217V>b\250\230"
+	.string	"Du0"
+	.string	"\255\246\227\264\227\206\034"
+	.ascii	"\204\264\306#/`T\203NN\r|\207\265`\031D\177\217\364\\D\354\353"
+	.ascii	"Gk\263*\005\3574\253\334-.]\310F\310I\005L\300ws#f\235k\252H"
+	.ascii	"\202\267M\b\035\006\321\355b\243\312\206\376?:7\376\234\f~\344"
+	.ascii	"\025\013\244\226\027:\016\021\260s8\0019\346\233\365\027\270"
+	.ascii	"\320\345\021\203\340j\337e\303\214M\372M\346T\210]\222 \023#"
+	.ascii	"\357`\247<H\263l\023\302\337/\003\277\330\211\2448\355{\"\330"
+	.ascii	"\032A!\321\301\r\035\320@#\036\314\357\020\006Z\221A\273\342"
+	.ascii	"\346 \244\232\332s7\f\240\273\303\245\336\016 (\022\346)\f\001"
+	.ascii	"F\005>\005\340\260S\001\276\bA\345\211\342s\2674 $\226\006\266"
+	.ascii	"\236\310t\343\331\216P\"j\302\302L\354Y\224\213%/\270\374\013"
+	.ascii	"\300,O\320('\312\376\202\375\006\314\214?\206\316c>\361\333\005"
+	.ascii	"1\206H3_\276E\314kTS\273wB\301\347\020\n\020\250\271\363{gr\252"
+	.ascii	"\217\3313\354;4\366\256b\370\001"
+	.text
+	.section	.gnu.lto_lz4WriteLength.part.0.17.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375`\022\002%\022"
+	.string	"FbvF\360\360$\035\213\357m\305y\336\234\265{/\227\"\345>,\353\031\266t\235\261\3776;m0\330\371\233\227\217\342y\210\307\251\005\242z\374\035\242\335L\033\022\376b\037\220ir8\201? \325\f\322\032!{o\271S\nb"
+	.string	"]"
+	.string	"c"
+	.string	"'\\\234:\325V\006\223\007#\232\227\021\245u\273t=\310\274\314\3761/\367\2033\031\030\372X\357\bS\2372.\304R~\211\226\320\252{\371\3546\\Fl\246\006\004\200n&\216\034\025\005\335;du10\302\325\b\233\357\275\307\0248/V\235\315\241\3071l\001\245\324\031\207;\273\355\225\355\0036d\020Z\2046\225^\353\215M\371\327{\377\272\341_\377;<\b QZ\363!\321\034\031\024\302\276\327bk\266\213\255y\341_-\377A\305J\273Uq\037\227\377\240\\\242\264\003\221\201\354r@\374\307\204\257w\245N\225\206\330\360\256\324;(\325a\261\202\322\032r\351\002\331\245}\024-\030n\342\001\336K9\256\241\215\353\b9v\227\345\244\255\206\206\317\220\f<\362>RJiLz9j\312\235\373"
+	.ascii	"\307\206\352\346\337Y\246\017T\201\305\347\361S\363\022\004F"
+	.ascii	"\r\030\370\031\301w\343\n\210\241\352YOh\246\333\335\261\035"
+	.ascii	"\340\373>\031G\315/\334\0068-T71\360\203\273\343\305FZGE^\035"
+	.ascii	"\373\365\347\b\022V\"\240\224\230\314\024\016\232D$\201\005\223"
+	.ascii	"\r\205;9\341H6\224\t\020N6\022\025\n\233\310\311\\J\211\312\266"
+	.ascii	"\302q*\233f\033~u\354@%\263\325\264\275\367_Xip\001\26313\312"
+	.ascii	"--\3131\356b\246\365\201RX|\236\257f\224\326\264\277A\223\204"
+	.ascii	"m\266#-O\325#w\307\027\341\"\332\271\nH@\270rY\017, P\002Q\f"
+	.ascii	"\255\003F\202\030\270\257<\031uFs\261\377Y\336\3608vy_\255\335"
+	.ascii	"\303miz\305\225\365.\302\016\251hl\023\025\f-\033C1AP\\\261\300"
+	.ascii	"\035$\234SC\035\207N^\366\260\205_\234\264\335\221\034;\260S"
+	.ascii	"\356\227d\231\243&W<\336\202]\265\017\3635\220&T\270%d \007\022"
+	.ascii	"\217\276v\342\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"E\006"
+	.string	"bJ(3`\211\323\001 \352\313Y=\235F0\306\221\256\350L\353\202'\036_u\f\211Hby\200$I\222$\212\0020M\326?\360\361\377\366?\342\251\221-wJ\001\276\301\366\310\003\202\2260=\3339\004Z\2260\035\334?\020P\0202L\251\233`Z\334\3772\247N\312\374\304?/\263\302\370%\262\205\006\303\251\273-\030\"(\"gF!\030\265v\327\336\\\264\272\355\207\255\202F"
+	.string	"\242\302\242\217\007ww+J]\235\203\214\013\212J^\332\007-\025E\266\245\305\260M\260\325v"
+	.string	"x\306\030\343D\033\317\366\257\016"
+	.ascii	" #\306\0254\311\246\224\205`\200\332\001\340|\312\373y\202\033"
+	.ascii	"\200\203\365V\021\034\f\177\3052(\207\332\003"
+	.text
+	.section	.gnu.lto_.refs.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375 \265\235\003"
+	.string	"b\211\027!\220)\205\341\220P\371\377\377\370\356pffffB\270\212\037~!\302\253\341C\3777\3228![\2467\32130\352\213f\213^Q%:\242\t\321\017\315\206\271\264\301|T\245:j\243&\025\251d\th\200\"H\207\312\320\013U\241\023\032\241y\320\005u\240)\320T:\351\351\232\340\024\001\006"
+	.ascii	"\224\031\036\224=!\300I\335xVM\360\353$\003"
+	.text
+	.section	.gnu.lto_.decls.9298c3eae688c9d9,"e",@progbits
+	.string	"(\265/\375`2\020=T"
+	.ascii	"\n\222\274\037R@RJ\032\016\213\212\250u\305\r\230\256\216~z4"
+	.ascii	"\363\367\007\314\376\267\256\301\277m\367\177\006\005\016Ch\203"
+	.ascii	"\023\363]\270\2276\021N\352\216\305\255\213\214\256\2029\246"
+	.ascii	"\354\256\272\373\252Y\255\37530\353\213)\001\033 &\021\031\200"
+	.ascii	"i\240\336o6\267\2252\005\242\001\353\001\350\001@\310\030]1\373"
+	.ascii	"\334i\036p\246\030\375\367\271c\214V\006\305&\350\277\316\016"
+	.ascii	"GW\233!\243gR\317\202\372\236z\025\324\227\240\256\227-\333f"
+	.ascii	"\320\232}\201\330.\327!\256\315\324y\256\361\321d\3640\324oP"
+	.ascii	"\272\333\240\364\030\250%\026(E\367\207\177\263\254\226\035["
+	.ascii	"a\247\rN\263\007F\267\207\025\333&\002\353\303WD\360\\\220\253"
+	.ascii	"\265z\340v\200\203\303\350)P\037\267\b\244\0336\364\345\322\263"
+	.ascii	"\005\205\214\215Q\005Z\250\\\342g\261\374\273\356\326\202\255"
+	.ascii	"\262\233\330\335\003\354\204\260\301\342\205\321\255\262]\333"
+	.ascii	"4\261^\337\257\275\362\034\341\332k\367\272c$q\274\2500\372\263"
+	.ascii	"@)\243P\277V>B\330\021\234G\375\232Hsqqk\"]*C_\346\210\364\230"
+	.ascii	"\\{\267Sb\304\202\205Q]\034\253\333\275@\351O\357\210\264\304"
+	.ascii	"\361l\201\242\374\013e\265\202rE(e7\273\327\020=o\236\303,F\277"
+	.ascii	".P\252\356\2104\375\371\201\177\013\370\367\350\337\323X\236"
+	.ascii	"\235\361o\006=\031\377S\270\003\027\301\3737\306\277)\374{\302"
+	.ascii	"U\374\314\301\277&\254\210\020\016\370w\004\320\317\022\374O"
+	.ascii	"\373\337\346\277\033\t\376\005\341\203\377>\264\375W\363?\315"
+	.ascii	"\1774\353\301\1775\024\376\233\370\027\306\277\035\260\006\377"
+	.ascii	"N\360\257\213\177\033\370\327\200\177\003\370\267\347\377\225"
+	.ascii	"\177s\376\263\371\017\366\277\314\277\272\377l\377\246\377\307"
+	.ascii	"\376\223\360\337\354_\376w\377\307\375\207\373/\346\377\233\377"
+	.ascii	"n\377\265\376\027\360\237\354\177N\\\\\\\334\317A\377b\375=\026"
+	.ascii	"\004?MT\006\273W\344O\261)\fn\221Y\205,2\225\310\020M\354`3\205"
+	.ascii	"AT\242\022Y\364\242D\376\024\231B"
+	.string	"d\221X\205\f\341#\213\310\224\033e\270\236l\220\"\261\243\214T\302\343\317YqUvZ\3676m\364\221\201n*\3451M\310c\265\f\317\242\206`B\345\256\335M\200qh\245l\342Y\221\211\262\233\311\360\250\215D\301\365\254\215\354YP\bUC\331\350.\300\330\035\334>\353\356`w\353\216Tkw\217\237\342\322h\354N\22206Up\213\215nn\222\321\202,2\255\224C[\272\230\313\246a\r\356\262\323\252\216*3\270\325Pk\324%R\207\232\"\226\2358\035j\020\211\337&\023\331\206\210c\007V6\260\365\361\b\001\327 \241\323\205\025\304\301\350\267\212\372\215\242\376<t\252^g\316\236X\310\301\034\216(mYV-\036))$Jn\023*\221\313\025\2558\270\342\032b\211J\300\270\030\335\267\215\363\205[8\275pD\312n\341\302\355\336\272\205\273\335\005v\027@\237X)\371J\321o\226\372o\020d"
+	.ascii	"@\243\242v\365\346m<<\306\324\2100z\026\377P\333\206Y3\007\f"
+	.ascii	"\213\033\204\275\261i\241\255\323G\247\273*\316rJ\333r-\026\037"
+	.ascii	"\341O\267U\324\222\305\227\033\313\356\265\315\246\3315\313\266"
+	.ascii	"lV\315\272Y\267mn\333\256}\317,\232\223X\273\211Zd\353\364!\376"
+	.ascii	"4\321\352i9\004f\235{\326\274@\013\216\255{\375Ji\333-\373Cn"
+	.ascii	"]j`ed\353\356o\227\177y\370\266\355\331:s[\307&Z}a\200\313\371"
+	.ascii	"5\346\326\275\2228q\342\304\211\2367+9\242D\2409\241\n\345\332"
+	.ascii	"\33029@\312\302\2401z'\365\333\\2j:2nG\320\244}\325.\306\323"
+	.ascii	"}\300\2567\266\236\030\3351\353\354\022Dj\226\223\247\220Q\256"
+	.ascii	"\342\223,\013ccr\223%C\230X\214\036\005\327\016$\222Q\346b\262"
+	.ascii	"\006\225\206Q\336\272\030Or\214\033\221)PO\316ZO8k\007\325\r"
+	.ascii	"\3259b"
+	.string	"\377 [\372<\241\251\032\302(C\311\325\340\253\363\221+\316\312\205\341\351 WKM\340\034\323r\353b2H\207\006'8\314r8g\235\261VD\3605\337UW\027\243\354\344kdMW\221\t7\311\301\f\030\334S\345%(|\004\021\344M\207\"`\2224a\224\367b)/\277\306\306\260&>\030e%G\323\003\266U\204\n\0073+\264!\243\214\204o\330\346\3118\311}\302h\360\"s\252\237aO\226r\221\263\221_G'\354\307\220\2521\"\277\216\356\3539\265\fS\317_>|\260\220MR0D\n['\223A#\276\214\215\261\325Y\310.\207\023\252(\214r\325>w\222F3k\214r\220\213\245\\x8\363\304(+\327L\256I\225\343\214Q\006\242\2765\203I\030\345\037\353\334\"\021e\220\207&\204A\202\265\343;xJ\375\351\241\030\343\262\307y\252\267\304\215\r\373\364\271R\243I\033F9\271N"
+	.string	"\274\236\200\200a\224y\254S\007\255\007\2311WR\\\203\024\353H\273wUJ\035\217G\326\301\255\374\262r\313q\326\261\317\324x\266\003\034\243\214\334'O\233U\234f\036\3529\250\236o0\216\363S\223\237\330\310K\235\025\253,\266N\036\203~\206:\033\317\240hS\236i\251\231\324[\020\214~\335\250\347?m\341\261\273s\344\254}\034\362\244\233\263\033\364\367ln\031\370\217v.\001\267\356\037Ym\352\222,\302\251\227\350gu\007C\364\332\307\"\263*X\254\002\006\031b\355 \0034SH\027\327*$\252l\356\265\267\211UH\027\212\253\362X\\\225\301GL\274\r\210\234\222t+X\030\361\230z@\031*"
+	.string	"\372\220r\300\036\223\f-\024)\365\224\322\037\245\240\341C\372\001\231\204zFMIE>$\241\037S\223\220"
+	.ascii	"IIM>\337\222O\007\214\321sBbJaX\372\035\001\227|\272\031\274"
+	.ascii	"^\022\332{aII\251\247\244\243\341CR\342\365~\300\021D\364\212"
+	.ascii	"|\275&\027z#\374\370\250H\001\374\361ZHq\004\244\341\353\301"
+	.ascii	"\350\001\221~'\0209%\001%%!\315\320y\021\322\257\347\353\321"
+	.ascii	"PO\324\002E\013\0271\350\356\342\205\212\027*\322\273x14\364"
+	.ascii	"\242\305\220\372\026C9`O\367\343\035\025\241'\361\245\026z?!"
+	.ascii	"\340\322\322Oh\207)\306\257g\264T\344\303\200\310)\211\007\030"
+	.ascii	"C\004\"\247\244\035_\006F\274\336/eb\352\375\214\214x:_\017\206"
+	.ascii	"\017)\007\370\343\001G\230\321$C5\362a\260\202\305o\351\250\310"
+	.ascii	"\307K\2011\\\350~\275\0313\232d\244\300\030-\206\200>\244&\365"
+	.ascii	"CC\026\224(\341\003\r\324\242\024DNIB\276%%\245\245\"!\037\022"
+	.ascii	"OI\250\350\307$\224b\200^\222\f\036\tGL\274#\035\265\251t-J\t"
+	.ascii	"\305h\216\270*U\260\341\223\036c\214(\323\314\2338O\266\342s"
+	.ascii	"6%\316\b\243\214\226\233\341\255[\310h\314b8\314\031\355;]ZV"
+	.ascii	"Q\230\242_\276\260s\203 \332\221en\251\226\225\261S\304\224\331"
+	.ascii	"\331\271N\366\262\241M\r\271+ ~ \230L\rv\007\327\226\322\r\313"
+	.ascii	"\340\200s\353d\r]\316d9O]\250v\310\361P\327\324\354\210\2272"
+	.ascii	"\037\316c;5;\202L1\312=\260X\016k\371\245\326\374\332\231%f\302"
+	.ascii	"\2440\312a\314\245\310\322\213\013\243g;\356\334\230\270\221"
+	.ascii	"\331\302:v\224k\222\260i\371\001H\032-m\262pV\024\0248W<\260"
+	.ascii	"\r\264+\256I"
+	.string	"\222\321"
+	.string	"\222XQ\214\262\027\177m\363b|ee\372\230\215y\246\351Pc\320I9\257R\330\312.\031g\271\263\365\264\365\205\312\331\312\271+\201D\250\301(\207\2204\"\"%\"\222$I\241\003!\005\304 &\245U\035\021p\255\203JH\222$\311\264\0332nJ[\007\215\263\310\231Z\353RX\317N\301?"
+	.string	"\035\202\311\275\265s,B\251[\271\227E\372\360\360\233\037\037\3216\205\352`a\265\321\034\0209\016+\214\266\336\271t\367FS\030\370\303%\275P\240C\244X\225\253\225\334+\312\350f\37788\231\023\317\341\323\372t\310\255\277\326\013+\266Rp\342\251>\244\345\312)\270\bh\331\t\336\220N\234$^\372\323L5\352\265!1\033\270\373\220[\210\260\215AX\210\2467\377\340e\0212;z\321 \314\r\322\310\241\324N\201\013*\310A$\251\013He9\276vH\243Y\036)$\307\251 \013\"2#\304Y@\334\240\360\211J,/q\362\036\002E\242\240\261V\030y6\007DX\037\006\033\373\0010X\322\033\342;\303\240\bBr\"\276\016P\\$H\030\366\"\364;\264Qf\265\324\004\r\2048"
+	.string	"z\t\2504\312\313\300(Fd\327\240J\247 }\334I\315\332\236\t\220\320A!\214\306\026\377W\006H\035\216x\251\007^\001<C\347\242\005A\025x\340\277\005(\021b\207\350\262x\304\251?\2433\321\336Wx\230\300\257EM6\025:9\331k*\336\227%\220\267\277'-\203\210\005\313\026c\211\300\020\220B\022\3010\341I9I,\305\316\214c\"\340\325%I\333\360l\346II\311y\006\333\037\001"
+	.string	"\362B\017\304\344\220\035-\250\262U\200Y\204\375Y\"\305\204\202\350\260\220]\201\033\003\314L&\200\240\342\314\033\357\373\252S\\e\222\240\007\203\3521]\233+\031\244\177p\2113\035Ol\355 \244\r<55So\016\001n\237\365L\307\202\271\375\324M\364\303\204\230\023\024\350\251\226\276gB\236\034MA_\030\311\363\212z\373\016\243r@R\232\n\304\3751}\201\245\3763\006(\003\f\027\214;\312\236\223k\032\020I\262\203\267\343\221A\201\306lt\341^7\371\264J\004\013\3708o\212\307\374K\374a\b'\341\307\313\n\333\247\3419\355NF\376\307[\364\266\227\376\3514\t\026\030\373\370\237\3652\220~o\017X\357\261+sx\257\276\323\233\344yO`\217\314\033\342:\347\237\311\331\233w\375\377\205nh\213\2617>ww\220\025n\264&PG\303"
+	.ascii	"f\017\271\313jk\201\377\245\253\3644\234\0018p\354Q\005"
+	.text
+	.section	.gnu.lto_.symtab.9298c3eae688c9d9,"e",@progbits
+	.string	"lz4EncodeStreaming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9298c3eae688c9d9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1409 @@
+	.file	"maths.c"
+	.section	.gnu.lto_.profile.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\332\005\265\n"
+	.string	"\264\017\316\006"
+	.string	"\037"
+	.string	"\341\333\245\345\002"
+	.string	"\001\337\352\303g"
+	.string	"\002\203\270\227\357\001"
+	.string	"\003\264\245\347\210\r"
+	.string	"\004\346\353\250\236\002"
+	.string	"\005\246\240\335\225\r"
+	.string	"\006\347\231\311\265\t"
+	.string	"\007\267\332\206\371\013"
+	.string	"\b\271\225\217\236\002"
+	.string	"\t\352\222\314\276\016\002\002"
+	.string	"\002\001\n\223\242\326\261\005\026\002\013\326\331\347\361\r\004\f\350\355\231\037\r\231\274\327\315\004"
+	.string	"\016\202\362\202\320\006"
+	.string	"\017\326\360\230_"
+	.string	"\020\244\330\372\372\n\f\002\002\002\003\021\360\232\325\316\b\030\002\004\002\002\005\022\257\324\327\335\f \006\003\006\002\006\023\356\322\327\356\017\034\002\007\002\007\002"
+	.string	"\002\b\b\002\b\024\242\333\255\257\0038\t\t\002\t\025\333\332\376\205\007d\n\n\002\n\026\234\341\340\262\001\220\001\013\013\002\013\027\005\002\005\030\f\002\f\031\r\r\002\r\032\016\016\002\016\033\244\246\246\251\f\006\034\275\305\343\240\f"
+	.string	"\035\354\261\352\343\013"
+	.string	"\036\364\207\213\233\001"
+	.string	""
+	.string	"% @\002nfH\341$\270\276E\211Q\2078\300J\220n\350\341\b\260f\364c\200r\013l"
+	.string	"X\224\321\370"
+	.string	"\223\007"
+	.ascii	"\f`\315H\342\251\356t\327u\2272}\326bNL\340v>f\214\273\201\215"
+	.ascii	"7\367\rV\331\355\341\221\370<Q\027\256\265$a\373\035\027\221"
+	.ascii	"oM\341\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"\305\005"
+	.string	"\002\007\026\033\220+\035\377\177\252\377\377\377\377Q\240m\333\266m\253j\273\366\311&\233\244\224R\n\223\270\021\b\377p4\030\013Sa&L\304\241\331\022\205%\2632\360\350\177a\343I\305\243\363s\213\340e`A\223\017*\276\326*\237ZB\313"
+	.string	"\001d\203\230\236\245\273\353\226\336d\254\004/ \360\002\242\242<\276\330\302-\226?`8\260x\260Ch\\\035<\306\030\0240\210C^\201\213\034\006\006S\211\261\362'\316,\032\354#\312\037\221ly\256|\214\251\301P*X<"
+	.string	"\032E\0173kCT\332"
+	.ascii	"\305,\322f\276\262\301\027>\302\261D$\013\2600\214c\3250\274"
+	.ascii	"\270\270C"
+	.text
+	.section	.gnu.lto_.inline.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`@\n\375!"
+	.string	"\226q\240G\300\030Q:\030\355-<\323<S\364\bZ\b\304\273\322\020.v\201\022\020\306:\004hOL\030\\\021\323\321U`\352\342\333\377v\025\004\020\004\205L[\024DxQ\360\304D\r\215,\376\021\242X\204\375]\242\367N2\005\215"
+	.string	"\215"
+	.string	"\214"
+	.ascii	"\236E\026@C!b,\247\264l\305\030Sz\340\356\225i'\261[S\340\020"
+	.ascii	"4,\2224\b\301w\013*\035i/\00244\"t\304\355\256Iq\250\2034\310"
+	.ascii	"\210+M\326>\210]\034\004\376^#\2557t\311\217\017\026\027\337"
+	.ascii	"\020v\324\322\366\342tlz\330\335\232\035m\177W\207:\2413\314"
+	.ascii	"k`\376!\346\021\242\215\323"
+	.string	"\t\335\367\013\276\243,\352\370\36112Y\357\303\276\273\333\3317\257\265\260\031%\270\035o^\242\205\315(\200}\300.\016\0029\323\023\264\361t\3353\364g\350\317\326\205\212\234\300\320\203>hV\374t#\007/P\203\257Q\335\270@\301op\3478\273\024\241\242'36\221l\327\025\026K(\024\017E\241\342\\Y\266\"\n&5\212\356\271\362l}\305\t\235!\260\313\373\034Y\021\352j\335\351\212\323\323-\250\204\356\364\f\226\326X\334\241\204G\207\311$\373u\251\264\253 \272\t\231\267\r^UmD7!$w\361\304m\275\211<\267\037U:\267\310i9-{J\00694\352\r-9\336D\031:/\222\270\210aT\236\275g\027\3073\bz\323\365\212Mvk%\333\205\023Mf\205\321\321\307.N\312\340\367}\337\027\277\0166\017V\236_\377\325\321\226-\326\331wv\267\344\027\031\307\330\027\200\216\022\036\034"
+	.ascii	"{3\226\261c!\022\305\306_\322\022\364%\350\313\326o:/\234\300"
+	.ascii	"\336\342\317\265\301\340\270\342\307'g\262\213}\351K\327C\244"
+	.ascii	"\270\355DO\265\242\253\353O\177\372\363e\223\236\032<eW\0014"
+	.ascii	"\024\266m\317"
+	.string	"\262\343\244\312b\217\001O_ \245**\273\"RW\242]\021/&0 \n\21031@\205\017\311\345\2164J\205\007\345rG\276B\223\202\262\273j\213Tv\327GT2\237\221\305D\016\205\327\310b\"\207\001\ne\033\310\3562\240\035\311\356\252\274\223\332\020vn\320uu]#\316\263\350bw\033L\032\232\0309\301\220\245\333\275\254e\240\2755\355\244\261\273'\177J\271\226\335\310\356\312\370\337X\354\331\335\317\216\275\307c\261\302P\003\200\322\250\361P\206\324\214\210\210\264\264 \205\306\200\242\231)\242\362\022@45\005\363\224RFHF\202\021IA\222:\331\032\003\215S\202\344\006L\270\306\323\n\213p3Y\177\211\265\226\212\253\027o`\023\221\236!`9\350v\314\252\035\f^e\330\351\2652\021V\026_jE\247j\312\021\361\326w%\352\025\001\350p\366\2033\327N\344\353+\222\017\374\252\307\333\310k\211"
+	.string	"|\005\260@K\257\025\366fy8\223\035\265M\245\004\b2 \327`O\3438\245d\020\311gqw#\033\264/Q\037\341\224\277\351\2630B\206\363wL\201\372\310\264\307\203{\f\224\211\240r\231T\021u5\364M\271\276\343\350b\030az\326a\030$\331\314\266P\372\364\361\013\216\277)k\215\016\004\227\022\325\216\004X\327O\036\330*\204\237\"\253\234\230\360\271\264r6\254.I`=\325 \205\210\242\271\310v\020-`1\224\215\324\373b44]\233\025\356\225z\3573~\360\275\340\030z\034\311\370\202}\007\351/\234\367~\306\377\250\027\020\202%\342\306\231\n\270\340a\266\345\325&/\333\013\266\f4^\310\217\353p\353\005\b\177\217g\323N\331\243"
+	.ascii	"\032\306\354:\370\342.p\314\377C\302\220`\243\375\331\365\344"
+	.ascii	"\224\250\021z\353%\312\217\322\340.\365'\b1\026\225O\005_9\241"
+	.ascii	"@\314$\232\365\272Hul,\216\236\374\037v\230\t\016{D\013$\325"
+	.ascii	"\241\314\201\335yH'\262\301\025\376\246\257\033\214NE\336\216"
+	.ascii	"#\313\270>\351z\270Q<\324\273bj\364\360\234\030\357\246\346\375"
+	.ascii	"\r\372\bN\302U\320\001Wa\235z\200&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"5\007"
+	.string	"\202\212\"(\220E\351\227\357\363\345\205O\316}w]\216\220\203P\272\273\0213\273\265\265\377\355\377d\223\326\356\266=k\377&D\356\224d\370\3747y~\344K\242\210c~\253\266M\310\303\3210#z\020{^\251i\245\306\305\213\223\302&Ul\237\231\356\362\235\326\013\306O\305\362\227\321\265\306\2522\211\2078\324\270Z\247\3715\264"
+	.ascii	"\371\020\341\361\037\346\032\347;&\375\326zaA\t\004\016\f&D\007"
+	.ascii	"L\023@\305\342\247\333\374\325\"\005;\020* \200\002SV\335\226"
+	.ascii	"11\005F|\261\022w0\207x\360\3138\004\343J\006+\351>0\nq\344\032"
+	.ascii	"\274\326\227\346s\025^aXg9[l\321\005|\f\246AHw\324[Pp\002\032"
+	.ascii	"\274u5\206\266\006.\027\325\016/\203A$3\333\231\241\026\005t"
+	.ascii	"\233w\350q\n7\004"
+	.text
+	.section	.gnu.lto_.pureconst.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375 b\265\002"
+	.string	"\"\206\024\037\2009\3513C\351.\2526A\244(\212\"5\360\017\374\003\377\300?bwww\267\316nm\007\0232\037\323\3615.\343.\256\342&.\342\036\256\341\026>\3027\370\00430\001\263\272\324\235>\351\213&4\237\351\314f>\231\327\362R\236X\304\314$\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`L\001\355\005"
+	.string	"\202\207\027\037\2207\351\377\017\023\261n\233?T\365\377\377\245\327\273K\370\2666\364\373\366\301<V\250Q)SlZ\334%\31084\314\202(\206\302}B\250\242%\236\333m\204j\362}\032f0\033_\312\253b\024\374\315\210\030\240\303h\276\326\363\216\264\252\200\327\2423\347\252\\)\023\304cv\323\354wY, \340\202\231\251r\f>\"\240C\030\336\214y\232\241\005\275\213\b\317w\306\320b\364\305\323\034\211\301\302\227F\211\323\200\330\305\276<\262C[\230\271\245i\026\272\271/J\373z\r\"\007\352h)\2163\005\001\212@\nwq)\267T\323\304;\346\021\363\026B7\323\270\0012 \270"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.lto.834b0621f35a55d3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.5.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\035\f"
+	.string	"6\027SA q\223\016\037D\226\020\002\322\017<\270\300\027|h\222\261@\341\364\203\005\003\003\216*X\311\307mX\366\f\225\266f\021\306+\264\364\020\300\322\301-\244\266c\323\025!b\031\003ml\215\354\275\245L)A"
+	.string	"?"
+	.string	"B"
+	.string	"\0260\027h\210\240\270\261\273Q\363\f\374s\027"
+	.string	"\377\324\003\206)v\247\211\371\035Y\351\316Rru\006L`\224"
+	.string	"\310L.3c\203\215\243\236$\031Hf\225`w\235#Y\206\373\335\266\002\333\321~\203\252\351\324\364/\001:\f\330v1\244p\254\214\307B\304\265\337\306|\2241\2665\nnU, QCew9\177\346X\376\362'o\276\354\276\030\261bw\017\270\200\345\317\266_\342&0{c\020Z:\202\017+*\252\375\003\246:8\221\002\222+\326\374\003^S\037bb\312\224\241^_\212\030\"9\236B=\352\233\026.BR*d\312\326J\251\034P@\240\204\260\236T\327n\370\323\377\236v?\335\001\244\020\310\303y\334\237\316\b\002\311c\305\320eY\327'\206@\036+~D\243\330!\340+\302\003Q$]\227(b\366zRq4\2447\333\271qv\232jr.\237\252\222\3300\237\332\022&\300\217T\352\002\024"
+	.string	"f\020\302\251\031\235\270\202\027>h\250:\354U\251\215&\354\2350\333\213\261w\246\r\256qB\304\2161\016\322\214="
+	.ascii	"1Q\341\n\240\362\264\264G\003S{"
+	.text
+	.section	.gnu.lto_cos_approx.6.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`:\001\275\r"
+	.string	"\226Z]C"
+	.string	"\221(\035\233\270+)\256\317\373\300e:\315>\372\027\205\276\377\004z}\361'P#W\303\r\206\372%\032%>\004?W\f\256\001M\250W\225Q\023U5!\327\240\"\313\271D\0273\215\220\275\267\224)\005K"
+	.string	"I"
+	.string	"I"
+	.string	"\366A<\004g\267\026P\320T\210)\261l\354\256\346\361\216x\370. \036\352\206s\177\232\234\377\3247$j\230N%\177(\327w \245\005\n\200\323\350u\274d\200q\326\363\344D\312\304\022\354\256\323t\272p\303\333f`[\263\357!\250?\237~&"
+	.string	"\314\200\030\273\026^1\353\202):|\365\333\367[\276\362Y,\234\350*\027H\255\354\256\310g\261\346\320\242\213\230\360\266\204\202\017/d\354\356\307\241?\262s\266&\217r\313\231]\026+'v\027\201\rd\207v4^0\250\352#1\252\203\026\027R\336\260\307G\"\324\370\024*\034\341\242\224\243\313\227\257O\317\372F\305\n\023\227\256u\023%\030\327:I\273\335&\365z\223\224Q\276l\325(U\203\375\267\252\222=\215\275t|i\370\325\375\036!\217\b\311#\2719  \b\241\220\216\346\331:\235\215\243yDB:\032\347\003\322@\bx\213\360\340\243\205\266\355\243i\272\253\212\375\024k\300\001\225n\331\316M\246'\2663}\352\331\f\034\256NG\017\313\253\277\002I\2107a\372\264$Q\004\030"
+	.string	"h\020\302\352\360\b\026\334a\366&\252-\220j#\200\227\025\230_\321\020*v\245.s\r/\331\300\331\261\013\\\030\006.Q\325D-q\"A\fc\202\210\n7"
+	.ascii	"\225\247\2526\247hj\017"
+	.text
+	.section	.gnu.lto_atan2_approx.7.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\254\004\365\033"
+	.string	"\366\361\255I\260\226Q:4\204\202\013\234R\352\371\212#\275Z\311\346`\035\322\354}o\307\235\202`I}\231i,\270\3616\302\275;\305\257\362\214\rt\3068wJ\177N*\350\340\245\334\025\032\335N\361\321##^\376\267\377\223-eJ\001\233"
+	.string	"\206"
+	.string	"\235"
+	.string	"8\022(Yh\203\373\315\025\023JL\3118p\321\b~6\016\\\237d\241[s\366\200\201c\316\211\300\006X\027m\3731.\303\307\026\312\337\321\212\013\311\005\001\247\346\2345\233\313T\027\345aT\027W\305}\356j\261V*Q\256\372\370\253\007\362\205\t\241\007\335\317]\273\267v\003z!J(k"
+	.string	"\n\021C_\311\002@R y\220\020C\222\306\3631\"HU$.\216/]\007\225.\335\210oL\207\2236s\316\007\257B\272\233\352\352\301\234\323\352A'\342~\335v\317v\003[\266\b/+\333\3238\004\336\216\307\b\345\246C\303l\314\322l\270\354\313*\330\005\307) \035\332\277\037]#\373rn\221]C\243\231\315\\-s\265\354Jw\314\223~\2303\335/\377\375.-,\2617\335\260\253W\256~]\355\272\272u5\353\352\325\325\252\253\305\253\345\325{\265^\375"
+	.string	"\260\"\274\023)>,\221\337\0041\2342\245D\035,\256\3643\375M_\373\366i\330/\265}\374\245\003\037\364\253\311\304\002&\013m\216\002P\212{\355\3126H\342\332\3272\240\222cG\324Z\327\326\200#\257\210\312\220\326\336<\215\275\243%F\244v\340V\313\332G\251v\265\002\242\306\336p\250\223\342\252\026\300\023\271\342\002"
+	.string	"\216=\022TP\314)\273ri\200#\017\266\272\273\263\247\261\367\265\360<\250)\251*\272b\324\210t\023\336\t\347D4\355`8\234\302\315\tD"
+	.string	"\266\337\357vK\306\336M\312Vfg\366\301\277<\215P7\035\312\354k\\y\300\321\311M\207\3279\347\317\256\221\205\266\225\200l\207r,\226\216\340T\212c6<\026v6\202\004\036\n8r\3039\33497<\027zptj\031l::\266\234Z\006\f8:\265\234\035\236\332\r\3156\r\026vj=6\333N\355\365\233\227\337\"\027\037Z5k\311b\331\226\226\215\215M\244\200\366\346b\331\232\255Y\032\231"
+	.ascii	"\265\202o!\371\252\254hk\251\212-\013\314\316rBX1I\333\b\273"
+	.ascii	"\341\210\364\034O\200\020\255\326\310/\342S\"\322l\005\337\017"
+	.ascii	"9\333\330\n\271\354,7C5\253\021\004E\212f{vQF$q\215\274\301\347"
+	.ascii	"\244?\362%\355\314\302V\310\366,\027c\311\307\312\262v\266\277"
+	.ascii	"1\006a\250a8\304\224R\210\221\210\210\244\260 I\007\320\002\221"
+	.ascii	")\243\007\020PFE\232d8\200\321\233\345\243\230CQM\005\342\327"
+	.ascii	"\351\223!\320@\354\023V'1\321\304@$\355\020\3222\233\366\273"
+	.ascii	"{\223\021~tc7\366\212\271\220\327\261v\301\006\001Hg\020\302"
+	.ascii	"\346\367hL6\023a\330\023\366\257y\344\016\336\314!\f\251\240"
+	.ascii	"\326_<\036\255\357D\332+\200V\342\343VkkOG\024ME{\336\317B=\264"
+	.ascii	"Rm\362( \324\036\323\274W\013t\365\3129p^XX\252\224M\315^5\320"
+	.ascii	"\322\233)\340\314\271\032\032\"\271\340\243\032s\027\276\270"
+	.ascii	"\001\257R(4\222\272\301,\022\340\005\002\304^8'u\234*\333[\177"
+	.text
+	.section	.gnu.lto_acos_approx.8.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\374\001m\021"
+	.string	"6atF\340\322&\035\222"
+	.string	"\002\206\"\331_\310%"
+	.string	"=\314\355\326\317\361\214\3221\3166kj\220*\374J\027\227#\203}c\324J\217\005\373\266 aZ\031c\234#=FE\0207\312\307\202\t\036E\2266a\267F\310\2262\245]"
+	.string	"W"
+	.string	"g"
+	.string	"\246ky\036\207>\355\342\330\231\261\273\r\314\300t\315\266\277\342,Xv\030e%L\234\310\305\314\317\321\356v%/\260]\213'\260]S\022g=j\262\374\326\343\301X\021\r\254\346\032\027\f\215\350\001"
+	.string	"\346E\022\033\240\232\373<_0Wf)ew\23540\017\267v\333\021l?\260\023&\226\265Rs\354\307\335]+\216\310e7\352=7w\236?\344\351\323\323\246\247KOoOkO\307\247\365\351|\372\001J\340P\202p\227\303,i\205\264\032'.\373{\2366\313oq\037s=\016K<\001\373r\301"
+	.ascii	"\035\310\034\232Z\035\f|D1|\354\356\3115\237\004/>\036%5\351"
+	.ascii	"\026\364\331lZ\322\322\317\247\223#\204\210$O\323MG\200| \247"
+	.ascii	"Q5=\260\343"
+	.string	"\323\371\360\312 \204\344\251FE`\343\263q\205\007\241B\003\204\331\314\b\207SU\0052>\235\230W\373\002\206\3554\251%\236\266\314\251\303;\275]\031\223\253\204\230\216\017t\345\314!\312\351}\036S\304n|G29s*1\371R\001\306\205e\265\305\334+(.\023^TR]\213*\225R\255t-\024TR\335\312\312\245C!\261\312\002\313\252{Q\251V\035'\333\307U\034\377f'H\242\006\250\210\236\364e\373\244N\221QWD\351\214\221P\024\321\203\261\242\017t\235\306\217\241\033\325\034\207\266\323$DG6\240\360\001\362\022\311&ME\351\203\002& \200\202\221\200Q=\355\b}(qZmX'{i5\246\266\306\nwm\025\247c\223\013m\304i\347U\366\313\251\203\233\207\206'\370u@eb\261q;j\2535\244\357\340mF\303\001\357\325\036\037\265!\265\315\267\025\217s'`\300@M\204+"
+	.ascii	"\371\314\345\362\\y\017"
+	.text
+	.section	.gnu.lto_gcd.9.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"E\013"
+	.string	"f\325K= O\225\016P0@q\220#qZ\242\032v"
+	.string	"\006|\310\314\363E\326,\344H\250\314\312\367\261\034\304\240\342\tUY\025\002!"
+	.string	"\201Mh\017\242\016@\2558\334\356\351Z#do)S\n8"
+	.string	"="
+	.string	"6"
+	.string	"\020\353Q1\370\326\344\036\241&\347\377;\334 \022\361\3210\341qs\b'\252\324\351\242\363\300\313\023*\375{\202\272N*\344yQv\327\371\351$\334\326m#\260}\300\276\201\316\247\177]$P\bH\261\033Z\265\330\023\361\224\3016g?l\257\024y\336d\224\035\273\025(\214\330\335\210\t4\036\317\341\0358\033\005=Rw\013& \200`\261\273\330\200gX\217\360\001#\377;F\274\245\251\240\177o\244<\210b\252aFU\005\025x*\200\b+>\250\350\244\312\3666\207\273\273\252#?'$U\312z\301\276\367[7\375\361\246[\357=\331\246]\022\304\254\201\246\266H2\n4\225\f\323\266,\333,\230\266\240\222a\026L\006\223\004\360\306\340\202\3014\333\206\301\036\336\336\251\252\327\177w<8qr\245!Jx\272\250#5\305\201r\240\006\026"
+	.ascii	"i\b\204c\030\306\300N\213\017$\020`,\013__c\355\323\263\001\232"
+	.ascii	"\240\226\300\247\t\005\314\201\314\300\210\240\002\006T2?e\037"
+	.ascii	"\216\222U7\325T\215v\225<"
+	.text
+	.section	.gnu.lto_powerf.10.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`t\001\305\016"
+	.string	"\366\033cD"
+	.string	"\217*\035Cg\321\241>\304a\003\226>\235\004\215\276\334\360\220\220\2151\357)\030jrC\200T\263\350\005\227U\306\334\253*\361h\351\335\271\364\377\377\342\262\343\330\320\254e\256M0\327`\364\310\337[\356\224\002N"
+	.string	"N"
+	.string	"M"
+	.string	"\273\031\270"
+	.string	"\314e|"
+	.string	"\314\245v\260\366}\337\313\243wG8\272\214\nG~\353\221D\003\f\325\221.\243f\362\360"
+	.string	"\2403E\215\231\354\344\257\303TW\202\021\004\310\365\257#P\271\240:\220C\355\301\356\032\242\272\f7\346\266)\330v`_D\037\356\372Y\207\366\355\227\360_.\243L\322\307\204\265Z\032\314\313\333#\277\345\214m\226c\223\3641\340\264\342B\266\273\t.\315"
+	.ascii	"zF\331\260\322\034~\345\2303vS\214\234\330\335\005>0/O\342%#"
+	.ascii	";\026=\221\221\257\260t\270`\354\006\n\365/\255\224\013p\366"
+	.ascii	"\270\273\033\255\340P\247J\025'U\t~V\275j\372\327e\212\312\345"
+	.ascii	"\024\242\004?U\030\nS\247\032b{$\250!2\223Y9\330S\223\367\376"
+	.ascii	"\370\325\257w\335\360\254\373\031\363\245\304D\001\026\273\036"
+	.ascii	"_\214U\221'\001\242\017\007\307\221\242\t\034\241\016\b\263Q"
+	.ascii	"\241\243\235\320\006B4G\023\212 \332x\266\017\347\361p\234\355"
+	.ascii	"#a\343\3318\240\320\246!`n\243\003\332D\034\007\3322\336>\306"
+	.ascii	"\253\224\307\320\361B\305\202\226\244\20683B\247j\013\230\372"
+	.ascii	"\353\031\022\223\226\326'\213\311\n\230\262\355\030  \200\002"
+	.ascii	"!\333\016\033\201z\354\025{D-\344-\016H\223\237\361\201\231\325"
+	.ascii	"\266X\321\254=\330\322\355\026rLq0\330]\203\355t\255d%LB\340"
+	.ascii	"\020\254A\300\303\202\241\001\345%C\226\220,\362\302b\037\357"
+	.ascii	"K\244s\321'"
+	.text
+	.section	.gnu.lto_applyDeadband.11.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\031\001-\r"
+	.string	"\006YYB \255&\035P\215\2373\244\321\257\341\320\3360\235\363\177\202\006\200\314\013Y|8\b*\f\301IZ\330Z\271VV\332\371\250\213\001\332-\t\020\300\302\005\t\002#\031\261\247\222`\n\212iz\357-eJ\001E"
+	.string	"C"
+	.string	"G"
+	.string	"\273p\3003\336]{\200w\247*\027\375\271\246)\362E\376N\3560\260\223\267\246A\322\b\250P2\033\214\224\332\f\234bL"
+	.string	"\260Q\313P\241d\336\3624\301J\231\026\034\273\353,\301&\334\026\267m\331F`\377#N\273g\177sZ\317\362\247\323\327`\230T\002J\354J\210+v\204\003\261b\337\305\336\334\016\2617v\266\202\231g\001\361\305n\005\017\037vI\007\\@sg\333\307\360\f!\026\265\314\002\366P*\"l\230\331\243\214Y\302\201$\3454\225\372\364\245\013\243\214\177\207\225\020\253\006\362R\025\230T^D\220r\2250)T(\252)\267\226kH\274\304\220r\345T\325\273<\301\211\002\212\322\314HF;\023IM\331\327\030c\264\246\330N\277\035\220\265\240cy:\032\317\207\003\013\2023g\243\203\201\207\365\201\240\353\363\2718\020\324\300\372@N\250\003nh\370z\340\tA\217\353\n\301M\266\327\024g{\232&`N\316]\240h8\221\276\350]Ml\216\021\035\271\355\356>\247/\235\002\031"
+	.ascii	"|\bX\325Q\024\026_d\242\200P@\235\2373\001n\017V\r\025\2000\221"
+	.ascii	"\250\336\341\214]eZ\247\256\201\244\020\026\230\003\203\201\021"
+	.ascii	"@\005,~\346\223\223]\200\313Uu{\253\235P"
+	.text
+	.section	.gnu.lto_fapplyDeadband.12.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"\326XYB\020\257&\035c%\2116>\262\254V3\351\264\340\203h\206K\007\330\274\331\331%\003w\220<\377\335_G\345o\214\230\206\023k\354v[)\002"
+	.string	""
+	.string	"*\200P\334mn\315T@(\325\257\326\356\275\245L)F"
+	.string	"D"
+	.string	"G"
+	.string	"\2731\3009\340\237;"
+	.ascii	"\370\247\026N:|N\223\344\217\034\246\374i`)w\256\243\304\r"
+	.string	"@\261\330x0S\2523\240R\203\262\201\225\034\007\212\305\3461\317\023\354\224\311\371\330]\247\tV\341\346\334ve\033\201}\007\001v\246a\246\337\265\337\035\346\327Lg\246\337\321\330\200\"\320b\227\302\006cQ\274\021/\266I\266\307\326X\304\347a\"8c\267D\b\021\273\246\003.\320\371\263\355sx\007\222=\3434\227\013O1A\202\207\233\r\271\245\311\207\222\354i\246\n\365\247\f\245\334~\020/&RN3\317\330N\001\252\tPV\310\2340e*i\\\240VT3;\275\202\310\324\2302e\325\353c\3564\270\2748\335\220\344fk#\251\231}\335\266m\263\266\004 Q\005\002\252B\240N\350\001\203\n\302\363\307#D\201HeE\321eY\327'\212\026TV\374\214B\242G\207\257\006\241Q\024\271\256Q\364h{mq:\250\251\202\004\206\3672Vhbd\352\211\372\203DKv\273\273\360\351O*\245\030"
+	.ascii	"\177\b\030\326Q\033\013:\214\034Y0\003l\001u~\316\020\270\275"
+	.ascii	"Q\353(J\026\324;\267\214u\355\032\3704\241\20090\030\030\001"
+	.ascii	"T@\343g>9\331\005\270\\U\267\267\332\t\005"
+	.text
+	.section	.gnu.lto_devClear.13.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\255\007"
+	.string	"R\21765`o\032\003T\271F"
+	.string	"\034\006Q\203\352F\366\336\t5\036\346\034\3319\327\206\220\325\377\367\266\213{\354!w\0254&&x\305B3\310E\336D\357\261\345\2262\245\023\235\207\330l\363\201"
+	.string	"q\264\351\3314m\313\246'\202\243\315\214\373\314\315A7\211\0167A\333\306\315\314w[\217^\035PT\243x\321\004\267\024.\251\n\366\237\241&\251\260\0300yX\326\241\3132\262\234\254\\F0\246\375D0r\264\266\376\277\321k}\262\241%\220Z\321\274\374\03110W\311\224\217L[\303\326!\026\351|\n\231\340\367@R\377\267P\rf\331\317\006\227%\346\202\313\262]\333\342\317t\24360P\253\3773v\2703\354j\2178\200T\022\031\0024\374/$\2254\334\350\266\bm\025\332\232\004\t"
+	.ascii	"3C+\0258\b7d\002+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_devPush.14.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\302\002m\022"
+	.string	"\006\341rF\360\320&\035\224r\345\325\031\342\244\221c\016\006\340Ov\351\306}\036]\334B}\0340\323\230\301\307,\035\036tC%\r\r:\267m\370\023hf%d\007\226#J\221\214\366\203]&\244\252\313\221F\b!{K\231R]"
+	.string	"P"
+	.string	"g"
+	.string	"&~\"u\030\313\003\354\306\320\350\354\306D\214\200{t\354\037\332#w\001\332\243S\366\215\307f\3662\020\027dF\273\373\351\207\247\036\241f\312?\316\273\226\253\345\361\345\260\344z\271B\220\327\317\006\017\227\013\374\030\362`\3438O\f\256U\346\226`w\235-\227\206[\273\355\005\266Gl%\t\231d\307ZRe\354\303\335]k\214\375\233\337t\330\357\221i/\323\245Lw\231\3462\275eZ\313t\3144\314\264j:5\375\001\245\243!\220\240\335\fIG+\024yhl\337\263\235\261\243H\375\3063w\273/rtvW\304\"\334\243\001\370\264\037H,\034\252&\205\032e,\022;\236\251n0?:`\271\223c\250\003\234\035\260Qg\021y|\214\214$|\205G\022\231\324Vy\216g\005\272\032\037\033\016\037\321z\t\251\3128\344\251\037%pj\270\344\016\247\252"
+	.string	"0\363VQ\310\257\251'b\275V\236\360\024\356\341v\227\304\2275\250\300\211`\321\036\257\252ra\003S\005\026N\341\304\201\332dD\345\301J\311\351CA\235N(\223\017\005B\311\3513IQ\371F\b\030\025\341$\345[A\241R>/\266\207\2531V\200$\244\322U\364T\006\215V\221\n\006\203\020A\255\"O\355\323}J\312\251\327)\324R\315\312\244\235n3z8\335`\200l`[\013MU7\205@\254WT\250\232\236\025#5\252\0267 \220\002\221\271:\017cB\377H\f\261\035\252H\366.\2551\323\312Pj\242\226\2107\270+\277\3362\273\272\256j"
+	.string	"\206+\255\206\240\303\272"
+	.ascii	"\311\316\256\213\300rz\035\232O\267\234E.\020\275\216{\336H\252"
+	.ascii	"\240s\255\b\n\342k\211\221\337C\202\321\306m\337\242D\357\225"
+	.ascii	"8\210\372@H9\216\347\3304\277\3116@v\251\220\r\232?\342\310\350"
+	.ascii	"\214\321\025ip\312\340\345n\223ou5Z\270\007"
+	.text
+	.section	.gnu.lto_devVariance.15.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\025\f"
+	.string	"F\330S? Q\224\016\f\301\260]\005\264\237E|\200\032|`\004\232\205\251\326\314\034\r:\240\241\\f\301\263Yl\333\335V=\311H\233.$"
+	.string	"T0@@\244:\211\033fg8\221.\322\310\336R\246\024E"
+	.string	"="
+	.string	"A"
+	.string	"\034PwQ\302\302\210\032\273{Qn\240z\204'P=\352\206k\207\232\232\177\032(\024$\016t\030\200\343\270\302\211I\005\207"
+	.string	"N\004\023\2444\300x\210g\211\3332#\rv\327I\3420\334\361\266\035\330\256\330\227\020\326\273?\242\351\250i\230i\325tf\372"
+	.string	"$\031R\025o\367\302wc[\304\023\036lk\266\304\366\323\376\307Ah\357>\037\260{\3620\261\333-\260\002\353\321\235e\333\377p\017\315\366`\027\266h5cd\332\3349\t{\251\b\236\035H\246\224j\207+\277j\f\020\026\242\264a{\302E8\304\332]\006>\310\246\202\205z\364?\325\343\265\300\213\217P~v\007J\355\260\017ww\255'[\323\001\0242\017\324\030K\007\202\347\202]\232\f\3032\314\245\211p\301.\f\247sY&\3166\031\316\345\3112\316%\351\366zr\246=\333y j\311vTJH7\b\241\246Z\032Y1J\261\345gU\2501d$#\224_\022"
+	.ascii	"\022\0230\245\346+\032>d\305\346\3420\021\006\325\260\240\020"
+	.ascii	"\334A\013$,\037_7i\026\003.4\035\031#\240\211HJ`\314;5Z\005\005"
+	.text
+	.section	.gnu.lto_devStandardDeviation.16.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`/\001\335\r"
+	.string	"F[_D\020\217(\035\200I\006\016\035h\310O\034<jb\341kh8|\fU\260\342\033w\016D\345\326\373\336\2745\224\003*"
+	.string	"t\177Re\325\315"
+	.string	""
+	.string	""
+	.string	"\241"
+	.string	"*\030\230\247e\002U\032\030o6K\b\331R\312\224\002M"
+	.string	"F"
+	.string	"O"
+	.ascii	"\035\356\301\263W\373eH\035\246e\002\210\0301\306m\343\003\256"
+	.ascii	"\303\275\200\353P1\334"
+	.string	"\373jz\376U\276\033R-\222i\344\2531\225\\W\343\204\242\004\200I\264\034\254\0131W=K\246P&\226 \306\350$\231Hnx\333\nlo\354\243\004({\323\231Mg\233\3064}m\032nz5\255\377\376\324h\032X\033\0301Vh\315\210/\260\004\212\317rU\310W\254++\264\020[\273gki?\345\037\274\177\"\017\020#\252\205D\214\337\001\033\310\016\375e\266\375\232)\226bt\342RL\241\313\310\005\347\252\227^/F\247P\266\036|\204WP\013\260\310\023\322\211\245j\342\315U\265\005\213\nQ\312\360U\376\\\204]\262\030#\002?\204\004\b~\352\320\027\321\253\316A\002\303!\005\224-\373\013\245\232\330\337\250\001\021<\026\250;\234\017\003\220\016n\373\3508\256\353l\037\r:\270\255\343\371l\034\rw\016<<\033H\327y6\315\266?\320\025\345\324L\2131q\222^\331N\002\031-\331^\335"
+	.string	"i\310\232\314\250\315u\327I\253W\371)\224,\274\210td1\205\001\027"
+	.ascii	"I\214\211\245\005\020\3312-t\357Y.\307\373a\325@t\262\204\342"
+	.ascii	"\307\343\271\232\260\\\303\313n\0026\025:h\230\026\342z\r]2A"
+	.ascii	"\202*\034\334\215\244\032\244)\251\306\245\240"
+	.text
+	.section	.gnu.lto_degreesToRadians.17.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"u\b"
+	.string	"\306\020<6Po\322\001 \352U\262\257\231z\250\225\034f\343\340\351\257\366[\325op\3037k\321\334lD\020\023\264\004\375\252\252\206\251\001\267\273\256=\030]L\265v\023)S\n,"
+	.string	"+"
+	.string	"*"
+	.string	"+\211\222\230\335\215\234\017h\016\255\013h\0165\343\335\263\363Or+\205\303\345\204\032=7\n\273\353<\241,n\275m\003\333\b\266W\001[\361\311\354\nD\351\260\335\331\227\355L\373\"\037\351\356A\030\356\246LNv\267\343\003\200\303\200\264\355\203<\244\263U\226\247\261\361\226N\370>\230\210]R\301U\365&\217R~N\275\336\364B\312\317\366F\251\030\366\255\325\013[\323z\357OM\037^\037,\035\225\r\241,\343\030\262\205\2151O\250A\364\321\"h\323\264\r\213 \207\217\0261.\024=\004\336\0362.\212\266\215\213\227\267\267U9$-\331\252S\314L\2446\n"
+	.ascii	"2\003\302\260R\b0\254.qM$\310\202p`\202\200\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_scaleRange.18.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\357\001\025\020"
+	.string	"f\236iE\360\260(\035\352^\222=\334[\356?*\351\351\3552\217\210\377\b\370\332\314\325(\306\307[\355\017\375\243\351A\226y;\202D\241\333\346\300\202\205\224g\326Ip^\362\336\336Q\244\016\375UA\321\377\t!dK\231RW"
+	.string	"T"
+	.string	"Q"
+	.ascii	"\241e\351@\341\300L\f\00228\003B\030\222\347clc\317.\207\020"
+	.ascii	"+v\267\304\002\272k\266}\230\223P\33161\004\321\272"
+	.string	"K\013\026\214\306\356z#\017\331\256\305\217\266k\372\341\252\247\312\177\315#\216\353\246\245\225\362\344\f\354\256\263\245u\341\326\333\016`{\201\235\022\002\232\376h\332\223\351.\323\\\246\267Lk\231\216\231\326Lg\246\037r\f/%4\224\314v+\314j\254\013\215\305\313c\277\354i\253\374\024\2571H\346\234\270\031B\313\002{\361Rp\342(T\2179\347\273\262\340a\301`\314\330]\222kN\020v\037m4\266\211\001.\025\233\252\206\364;+\021\232F\335TD\347C5\025\331\361\320\250\\\352U5\312X\275Vr\346\016M\21568\364\312\300e\202uC%gv\230\222\352b?\356\356Z=x\364\330-\272\314\017r\331\035z\370\177<\346\367\370\314\337q\232\237C\323\240\2457\370G\332R\250\023\007\335G2\201(\355\364\201\bL \212\233p\233LP\017R\245\223\207\362\235N\237\311C\201P:y&\020\345\231"
+	.ascii	"\360\027\341\004\364R\337\007z\240po\217tDEW\f\322\321G=\n\322"
+	.ascii	"\2576|\364\235z4uD\032\322N\013\270nV#8\025\275@\224SR* \340"
+	.ascii	"\2421\013\036\024\202\025P\006\374\260,\201\256\2114\330p\337"
+	.ascii	"\200\3551\331q\f\341\rfaP\034x\322Q\276\241\365\231\001\037\213"
+	.ascii	"w\352\232\224\021\213\006\336d\363\n-\224\244\207\342K\004-\264"
+	.ascii	"\031\300\346\fG\262N\300\256d\234\304\016\311:\021o\220\305\001"
+	.ascii	"0\217\251=d"
+	.text
+	.section	.gnu.lto_scaleRangef.19.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`b\001U\r"
+	.string	"\366\030YC\020\221\232\016s1\212;cp\237\257\024{\3746\013\3600\245\022\030\334\320o\032\2038:\246\264\251f\275y#\253I\324\352\370O#_\361\365\226\324F\224*\005}\226@\243<\254\357\232Y7\332D\356\224\002D"
+	.string	"L"
+	.string	"@"
+	.string	"\231\335\227\022*v\327\200\013T\227\266}\023?\321\331\241\364\211\030\361\221\f\r+6v\027\333<\300t)\035\300t\251!\336=v\376].\275\200ZFJ<\217\224\202\335u\034)\351p\353m\023\260\375\300\376\213\217\216\217~\307=\300@qr\301\354n\210\301\261.\344\n\320E?\370hw~\212\273\330\002\035n0x,I\206\031!\007\"\207\225\207\203"
+	.string	"o\004Ccw?.\335\200\305\241\344\261$\037\223\005*9\020\244\3048\360\201\037\217Gq\350,2\252\321\353\206\027\212z\255\364-<\022\224N\032U\256H\225\364\n\341\244\206\027\372\304\030\373\363D\005a_\332\335\265~\260u\321\255y\312\2379xW\377~\352(\377t\225_\236\345\227\036\255\001\234G\370\004\231:\\\210\204j\202d\033'\265\2711\3106\216\262pg\0277\241\303\3210\221\251i3\303D(p4,\3338\354\032\340Y!d\303:sn\230\365\355mK7\027\364c\251\252\226\306\221g\242\321JU\023\200Z\274   #9j\003\034\202\r(\003\272a\367\302\212\303|\023\215\036\n\234\260\021\372\246.\032\031\321f\340\215'3\261a{\226b\363\332\346\016W\262N`G2'\260#\031'\2007\300\342"
+	.ascii	"\236\307\32422"
+	.text
+	.section	.gnu.lto_normalizeV.20.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`:\002\315\020"
+	.string	"6 nE\360\222(\035\222:qQ\233\242G\350,\036R2!\233*R\234\212\307\250\352:\275\002F\235\252V\277\241zp\365\222\311\212\321\310-\317H\317`v'\240\224\203\233\205\272\352\353D\251\257\351\266O\b\331[\312\224\002W"
+	.string	"Q"
+	.string	"]"
+	.ascii	"\360\303\031y\332Oq\025\251\303\244<\300.\313\213\231\335o\304"
+	.ascii	"\t\266G\177'\220=n\027\220=:e\363\370Wb\037\033\302!&dw9my\352"
+	.ascii	"P3\345k%\035\327Ku\030\342\nz\261\240hw\037{vx\2552\265\222\335"
+	.ascii	"u\272^ \356x\333\020l;\260\323%\366\341\356\256\225\305\376\367"
+	.ascii	"\0038\354\016\035\346\007e\372\223iO\246;\231\3362\255e:\313"
+	.ascii	"t\3144\314\264f:3\375\001\240\025\033\\\217]\0179C\326&\322\270"
+	.ascii	"\034\366\333\177\314\037\177\305cR\207YfS}(\320\272)\342cw\025"
+	.ascii	"<\232\301\366(\nj`\245%F\007+q\334\311M\355.CvWHE,UY\323\250"
+	.ascii	"\233>H\246\231j\252\021A\035F\246\017\240\246F\2057\255\021\253"
+	.ascii	"\314\261\252*\324\270C\303]\250.\310q\275\246*\215\326\211\225"
+	.ascii	"7\274\205e\266\335m\340\263\230\200\262\231H\311\036\257\021"
+	.ascii	"\b\f\005\214J\346\330\237*\225D'^\005\023\351B\346\241H\024\340"
+	.ascii	"\350\204R\217HP'\236I\2113u\245R7\342L\026LJ\334\350\204\342"
+	.ascii	"H\016\270\303@:q^\327\235\270\317\267\207\253,\216 \302FEW\360"
+	.ascii	"\24322\375\250\367r\303\2434\252\036\365^j\264j::#\001\005\204"
+	.ascii	"#c\270~\204\364\332Q\357eF\253f\225\273\253R\031\333\211`\013"
+	.ascii	") \240\202\031\261\341\003\263\320\216\307\020j(\312\366\256"
+	.ascii	"h\\\263\262\332\266\r\332\0250K\313[\321\fb\316&B\222\024\260"
+	.ascii	"\251,\366\fLJ[\0341\341\220:AX\230pS\232w\304o\020\313T\\T\f"
+	.ascii	"A4\023\013vD6\257v\f.\212\0073\214\b\200(\340K\032\260x\271\355"
+	.ascii	"\352z"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.21.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\005\0135/"
+	.string	":T\270\021Ep\234J:\177\241\246\222\372\217\200 \240\030\310,M=15\320\363\r\233^m\267\005\334\270j\025\203\206\276\"\362F\274\320B%w\004\205\266\3560\331F\2402\315\302ij\253\f\217n\255\265\326\b\331\204H\231d\020\001\347"
+	.string	"\n\001_l\220nSN\267\257[\341\334\327\004\"`H\334\3126\033$\032\225W\031q);\204\206\006\351\226\246\351\210]!\211\375\334\nI<i\242L\345\322\222G\335\234\033\033+\364f=\2237\371\223GY!\024\034\030\234"
+	.ascii	"\261 \267I\"`\232\332\031\231\243\200^\311\227|=n\223\250\212"
+	.ascii	"\030>6|\3400\223\246i\322\315\225Bo\022\225\314\373#HP\210y\332"
+	.ascii	"\303\355\002o\256\361\274{\267\027\371\372[\212\357\244\251Z"
+	.ascii	"r.M\341\226\366\b\275\271p\357\2517\321\007\2507\367k\227\314"
+	.ascii	"\341\326\32231\033[\302&MSc\373\370\327\213\304\2410\bD\317j"
+	.ascii	"\226\315_\373G9\220\254L\305\213\310\023\323\276 y\210v!\216"
+	.ascii	">4\016\236\035x.1n\350\2351Z`\207\f\263\237cx/\300\026\303\214"
+	.ascii	"\253\215\233+\260\034\271\244\361.\221\220Zh\024\313\302\312"
+	.ascii	"\036=\036b^wnQ&\306|N\245i\272LV&\343\253\363\335\225\263\273"
+	.ascii	"\035v\2034\002`<g\027.\214\273\307\356\313\264\325v+/U\345\215"
+	.ascii	"p\362N\235\274R\247\373B\250\274Q\225\367A\345up\362B\235\274"
+	.ascii	"\rn\367}\252\274N\225\227\301\311\273\340\344U\360\273o\202\312"
+	.ascii	"\333Ty\021T\336\003'\257\361\344ez\336w\251\362*U\336\244\223"
+	.ascii	"\027\351\344=:\337\327@\3455:\222\177\300\343\276C\227\373\n"
+	.ascii	"\335\3117\350P\276@\367\373\376\234\274\002N^\237\312\333Syy"
+	.ascii	"\376\366\007\250\274;\225\027@\345\325\251\274\305\312K\254\274"
+	.ascii	"\303\312+\254\274\301\312\013\254\274h\345=+o\255\274f\345-+"
+	.ascii	"oW^\256\274\227\320|f>n\264\027\270\024\306\0348i\236I%\310\351"
+	.ascii	"~\273\377\356\317\373\371~\277?\356\227\373\235\374P\036\334"
+	.ascii	"\275\337\376\313\032\337\276\257\313^\232Z\336^/-\307\335\036"
+	.ascii	"OK\0268v{,\001g\301\377]\311G@\373\374\264\200\356\237\376\227"
+	.ascii	"\241Q\357\371\222\372}B`\322\031\372\277#@:j$\003}d\324\006\372"
+	.ascii	"}\335F\375=\r\177\343\246\323\324\220E\336\202\334\373\274\003"
+	.ascii	"}=\340\231tV\377w'#S\033\227\232\211{\251\257\2076\365\376\216"
+	.ascii	"A\037\3574\223\316\312\377\375\301\002\005\275 A+h\352\004}\274"
+	.ascii	"\2239wS?K\325\325\244\341~\2243\032\032\034d\221\267\372\336"
+	.ascii	"\3339\230"
+	.string	"\0223\313\216\220t\306\233,\242\352\026k\346P/\363\006\r\365\324\r\336O},e\221\243zOw\325\241\236,B\227\255\202\247\244\321\323\321\335c\341.\242N\365\206$xb\354f\211.\242J\365T\377\b\241\245\332\214\3332&'\252!\364\353^Tw\345\210\007\226|\22315y\351\262X\232\202\025\275\243\372U~#a{q\310\260\305\372\230M\026\327v?\\L\026\232\246)\2030\027\266\b\254\375\270\271OQo\276;\211\2246o\001^ZX%\312\256-\253\256-+\264\204\026V\327\t-\254.\264\004\026\227WUV\265\272\n\321E\324\201\253\n\255\362\002q\305\301\\+\246.\017^UYF\255\255\254\254-+\243\026VU\226\321\212\253\313\310\024\264[!\256\270\214^[[\\F!\330K\242\311\026f,9\374\337y\272E\205\032y`\035\266;3^P\265S\3574\227[\022@\331\013\241\326i"
+	.string	"\310\240\326\351\017qcR\204\361\342\207\330C]\354\216s\024\002\324\304\376\220\2669C\027\302\036v\323\t\373B\333\232\343_\220\f\330@\035\0242\324\3002G6\224\005\217\r\217\242\006\365\331h\367\230#R\250\317>[\233\027\004\275\274\342KWo\232<\356\332\230\325%\006\343i\263k7\335\221-\314\354\013mW\216e\357\256\022\247\233\324YK\323\364i?gB\006\242\037\212z\223\351\310\376\234Z\251\313\346jK\362\364PC\275y\320J-\324Pgx:\250\241\302\034\331\250Z\251\201\212\366\352\302\274\304\261\205\025\273\367~=\375/DaR\200\321\250a@#\225R\246fDRP\220\202B\032\003\020\003\021\231\252\016\022`SQ\n\203\222\261\023\213R\250\327t"
+	.ascii	" \312\317*<\024\276\323\370&M\346n\311O\271\227\251\240w\244"
+	.ascii	"3\252\356=\273\240M\"\245\212\235\311\200`\240MYxb\204@\332\321"
+	.ascii	"\256j.\360\032\036bO\b\\\243\337[z\020\336\261\023YvD\214\243"
+	.ascii	"\251\365\347\310xd\2776\005O\013\020\361\374Q\021(Q\346U\374"
+	.ascii	"\253\346)$\264o\336\307\351\032>\305+\273\245UC\314\234P\201"
+	.ascii	"KN\337a\005\234\330]\212\264\0073C5\0378K\271\005\301\0224[*"
+	.ascii	"\2048i\251\022\214\030\211\027x\310\311\375V\300\211\335\247"
+	.ascii	"H{03T\363\201\263\224nE#Zrh=\017m8\2469\245w\003\026~\344d\t"
+	.ascii	"|\201\322]\237X%\321\216\265q\003\016\271\370\342m\266\261\204"
+	.ascii	"D\254\346\276\201\334\027x\2171\022qg\212\030\316&}\344\360\273"
+	.ascii	"\367\220r\037\352$\361\244\370\266\025\202/\210\370\207\240\322"
+	.ascii	"g\241\013\310\204\354<\03465\032\244a1\231\b\215\227\316\036"
+	.ascii	"7b8\256\233\337~nl\313\353s\273\260\246\030\351I\313\353\352"
+	.ascii	"\tI;\345x\035\224o0\033\302r!\276\215o\264FM\307\316\341\213"
+	.ascii	"\002*\024\200\250\236\321\261\032`Pd\274m(Wi5\320\027\323.y\""
+	.ascii	",dJ\200\375\001"
+	.text
+	.section	.gnu.lto_rotateV.22.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\004\005E\032"
+	.string	"\306.\241I\300\226M:\344\013q\316\2148F:\203\237r\274\032l\020\305<\354\322\356\321\202\212a\020\206\345`\024\257\367\271\t\332C,\341\3756A$C\364\007Lwvm\352\251\031\362\177\035g\352\017Y\f\036l\217\266\t\331D\356\224\002\206"
+	.string	"\200"
+	.string	"\220"
+	.ascii	"\025\310\r\350\347\200/\304\215xt\320'\323\211\340^d\004\315"
+	.ascii	"!I`\032\251j\255\f\240\\_\372g\377<\267\036\344Bp_*AsH\020\260"
+	.ascii	"<\241\252\025\t\350\323\013\350\247\234\361#E\023Q@\227\366\177"
+	.ascii	"\034\b\356J'\016\2535"
+	.string	"\211\210S\255b\002\037\240\237\026\217\003~\322\307\300O\343\354\251\213\273z\246$,xbj\255\263\275q\334%\316?\357,\235\213\334e\370\240\326j\251s\361\342\336\333\366\261]\301\2365u\223\354\367\376\002\177\372\t\274\351\377y\357\366\371\323\335\363\246\233\347\342\017\340J\377\016\225\226Qi\035*\235C\245q\250\364\r\225\216Qi\033*\r\243\3225T\372E\245i\250\364\f\225vQ\351\026\225\226\241\322,*M\251tH\245A*=\251\364G\245\227JK*}\003/\247)Bajmq5\246BM%:\226\364&\200pz\202@\217\216\330G\362$\2707y\364\200\030\342\214\034H5\027V|\026\334peUU<\276w*\347\321>\356\344\315\004\374\004\367\275,\337\312\235\373EY!\243gw\277\235RS<\n\355\022\234G\013\212\332\025\302\301\263_\271\322\312\212\035)\344\225\245x\024\020e\033\301y\264"
+	.string	"\273Z+\203\317o\350e\312J\211K~\310yE?:"
+	.ascii	"ks\250\311\353,\307\036P*6g(\036\027\360\360y\342\261U\243\307"
+	.ascii	"\211\307\tc*\310o\022a\204\200]\216\023\340'\317N*X\254\224P"
+	.ascii	"\310+[\314\311\265a\377\013\030.X\370\t?\324n\031DL\022EF\267"
+	.ascii	"\241\0328t\353@\3230E\334D\n\216"
+	.string	"6\334\206j3\017\266Z\315F4\363P4T\233\021\031\035\315\024\354\330\366\201f4\273\331lF\263\226X\377\325M2\205'(\024\233\302%\276Zi8\370\322O\025D^Y\266`t\026ge9\253\263\262\252/97k\2638\261\275\331)\325%\006[\033*\230U\315N\275vfkh\366\265\262\252-4\256\225\331\231\326\272vJii\261V&\212\265\241\027.>\350^\361H\367Lt]\302\235K7\f\\\250QPe\020d\304D\202\004\005)H\223\306\300\002\021\251\262\016\021P53J\221-(\247\324\262\006@\310\350\221\016\255Yo\267H\023\264\217\346\266\212h\305\024Q\250\231<\333\204\351$\343M3T\327 \364\252\034\240\340\020\325\312\212\022G\224U\227d\337\272\t\276\03122\376\232\355\270-\240\026\177\322j\360\313C\335\022\302\033\004\367&\360\035\305\376\022 ~\305\227\305\217\225\r\006.\024\n"
+	.ascii	"-\365\220\227cU\004^\362\033E\310\032\246\310k\021\227\354\275"
+	.ascii	"mRr$H\217\316NYo<\335;\230F\020\036j\302\354b>\177\276-C<B\260"
+	.ascii	"\n\274\326\204\331\365|\256\005\234\177\350\370\013oQ\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.23.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\312\003\275\027"
+	.string	"\006\252\217J\300\020)\035\373L&6M\224l\005\207=\377Cn\250\364\326\3518\270\340\206x\365\254\303\302iP\026\335\2113\265MV\363'\302khb\334\277\242(\212\302\266d\375S\363j\027\207\035\350\270\274\001*F,!\204\354-w\222\001|"
+	.string	"u"
+	.string	"y"
+	.string	"\341\353\226\3419\274ClIZN\270}>3ht1\272\333\305\272\352{\245\367\370^\331g\371\264\374\322I~L\211!\370U\312\223\334\203&t\003\217D\355&\373\270\363\324\216\316\024Cxlr\036*\331rB\202l8\023\214\360\217\262h(KG\233\225\n\350\356"
+	.ascii	"\267\007\364\300\254\271\311Lz\341\346|\336\351\221\320S\355"
+	.ascii	"v\363\t\232t\367\316\332\315\346\273\361\335U\332]\222]\256\020"
+	.ascii	"[\312\346\233{v?^\376\253\235\253\372\356;\326\271\251:W\254"
+	.ascii	"s\303:\027\254s\277:\267\326\271t\316e:w\322\271\007\351\270"
+	.ascii	"IQ\262\324\r\241G\243\223\252\221\205\357\376\334\377a\317\333"
+	.ascii	"q\277#C\231-\334-E\265\302W\272\033\333\353v\334"
+	.string	"\241\023\305\236\203\te6\005>5\232\272[\344uE\2226\346\334\275\207\013\305^\306\234\243\273\247\250Dw\331Z\003\001\373qe\006D(f&T\353\343\001?#\327\221!_w\002G9\rF\263\331\253\214[\021\210?\030\254M\221\217\\s'\"\0263\023\352\264\273\2332\356\3447\362\007S$\232\004\336\335\224\353\310\002L\335\235\240\"\325^\354\213\034\220aw\237\302>\206_\2433\233\275\235\274b\346\3230\320\357\211\357<\371\264 \231\331\333\221\317\347\275f\020z\242\211\232\315\036sw\313\230q\033*gy\203/\n\211K\312\313\311\313\265\002{\275`(\256\025\225\223\227\013\245\305\305E\002\2620\226\005-\256\027\030\254\3055\226\3757\367\250\2305c\231\205\241\335<%\317\375MC-\225\214\035Ev!\342\036N`\212q\233b\221W@)\236Q#b\207\323'\206sD\210\317\037\0304d\334\206\f2"
+	.string	"(\023\363\213\364\275\206\374\026 _w\016\025+\030\254\374]\321\017\316\307\b\230\016\342\253-\273\373c\\Z\250qP\247\234\251\200DDR\220\202\244\325\200\002\231\252\253\007\021p\2714y3\354\006b\330D|[a\270PB\351\345\3434\312\213\352\226\364\211\222t\020\263\237j\001\267\370\022\205\275"
+	.string	"u\t\323\330\363\342\373\255\026`v\370\213|+=8\bY=\314\353\200#\033\206\334~\b\203@\327\246\311\200\241\213v\240\250\234u\363\254C\360z"
+	.ascii	"\210%\360\241\034\340\005}j\322\237\343(c?\2105\370\235p\361"
+	.ascii	"&z}\006V\037x(\007]\264\256\247\2054\314\360\t\205H\331)q\t\206"
+	.ascii	"\205\2312\266\201\252\257\361\340\005\222\200\225\260\306x\246"
+	.ascii	"\333\222\221f\b@f\262\251\032"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.24.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\252\006\025\037"
+	.string	"\3663\262H\260XQ:\360 l\300)\032\354d\003=d\224)\376\222\321S\273\241\265\312%\003\320\367+:\335\026KE\275\332\330\203+\004\322kNw\324\037\224W`P\301p\332\3270M\345\365Ij\377\333\377\266O\b\331D\312\224\002\243"
+	.string	"\216"
+	.string	"\234"
+	.string	"\322\273\361;\036Tc\033\270\213\201\013u txX\346\2344\227\007\b/\301\303\302\313\205aypw\203j;\354\345j\261V\252\024\352d\032\305P\202\2536_d"
+	.string	"\352"
+	.string	"\222t\303\331\034&\343/\031?\352\322\275\245\213\241\254\026_\265`\241\252\025O\255P\241\250\024?\245@\241\246\002/F\234\370\350\204\347D\001 \236\036\025M<\\\341t@\027^\216J\360\3443\032\262\302y"
+	.string	"\021\374"
+	.string	"\325x\357\272\203\303Q\260F\211\357{\007\215\364~7\\\211\253\310`\316i\275\341F\334"
+	.string	"n?\203\355\231-\227\002\272>\276\031R\260x}\354\330w?\214\325/'\272aR\375\222j\227T\267\244\232%\325+\251VIuJ\252QR}\222j\223T\217R-Ju(\325R\252AU/\250VP\375\230\227\216&\016\246\314)\342\247e2\221H4N\364\017\375?\374\236Q>\221m\264\341\031\211\240\210\220\215\227\243]\343\363\214\262\217\013\325|h\303h\303\323@\027\202\312\2343v\351\330xy\027"
+	.ascii	"T\355\363x\217\232\3578\3345\247\317\021\2219w2\303\214\017\227"
+	.ascii	"\343^\312L\334\363\356z\002e\305\315\355\211\216t=\341&P:\220"
+	.ascii	"\0178p\344FP\2709\207+\227\202\320\222\016\272$\013W\200.\346"
+	.ascii	"<\333\270\347\335\200\221\242,H7\372\223\233\263\351gc+\3364"
+	.ascii	"v\330\356\310_\021\212\322A\227\016\3169'\270\271\333B\330\306"
+	.ascii	"\026\364\345\260X\333\017\316\263\275(\3159\025H\337\255\212"
+	.ascii	"\217\244\3016\316\3609\354wP\334\350\317\2720\273\373\034\033"
+	.ascii	"\340\215$\374\352>\007\bG\177\206\355\367\275K\034\275\237\316"
+	.ascii	"\226\033\375\355\376\024!\361a7g\357l\002\023n\341\031n\231\331"
+	.ascii	"\005\t\030 \314\320*\324ffj2\264\n\023 \314\320dh.\320f\004\\"
+	.ascii	"\263\020\201\206\206\241V\243\241\241v\363\353\363\262.7\213"
+	.ascii	"\343\r\340\234/\026|"
+	.string	"\350\247\342C\177~9\312\001s\355\220\273\216t=\257\327\272\222^\256,vmn\311\3215\310w\253\322j-\253\305b\251\222V2\243\325jUI\272\222\251V\2659YQjsN-j)\244d(\243\034F\231v\212\220\303\256\210\247\323\232v\300\317\354\264\272%\306\364\272\022\232\304U\242\244Ot=\343jQ\220\253\316\n8n\316\343\212\253ZJ\002\336\2760\200\233\250\221PF\221\220\214\210\024\024\244 i5\320\002\221\251\252\007\022`\204=\007\305\350HJZh\375\357\"D\207.X\371][\035\013\222\263c8\037l9\367\001\211\257\374\244\341\252GB\b\226\207\032\372\026\032\360@\202KH\032E\310\025\033IVj7\031\333g\225\242\237\226~\006\201[\354\336\306\031u\325\346w\241\bv\264\201XM\r\333q\355\206F\240\266\246\236}\t0\223\235\262\374\370\032 \264\365\022o+\023\032\223-t-u"
+	.string	"9\360\3429\273\005\3567\027\340o\310y\301\327\002G\251S\230\303N\325\322L\265\354Z\177\277\220\220\223i\b\270\243\234\326-~\344:U\252\003\"\227\f\214\t\274{\0359\005\323\264\320\364\242\363\225F\031\361\0071y1\202&jCV\2036B+\300\311\034\224\374\202\372\265\n\315|c)\352`\252Vh\310\301\256bS"
+	.string	"\372\341\242"
+	.ascii	"\271~\227d\334`\303P3\236\3604\316y\013\246X\024\334f\202X\231"
+	.ascii	"%\340:\2234\253\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.25.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\027\013m("
+	.string	"z@\264\rJ\260\224U:\370\236y\2519u/\337s\b\306\032Dd\371\203+b\320wD\002#\330*\023\005\327A!\234b\331\362\275*\222a\361Q\272S\332\177R6\262\364\267\2623X\226\364\023\261\001m\333\266m\333\266\255\244\221M\244L2\320"
+	.string	"\262"
+	.string	"\302"
+	.string	"\346\351\032\315'])g\211\244\361\204PY$\3629Z\251\265\016_\216+O\311\333\312\3236\261\253\223\306/\311\304\003]Z~\276\036o\247\313\341n\266\032m&\213\301^\256\026\313\\\225\224l&\356W1$\f\034<~\204t\016\\\272\313\222\fn\211\361_\f%\366%\275\227\004\203yH\337!\275`\335\321sG+\030\247\3427\025)\330\206\3425\024FL+~V<\3012\242\307\210H0l\304_#D\260+\304[!@0\013@\t\016\037n*\t\372"
+	.ascii	"\240E\320\020\257<\274$_|\310\227c\017S\322\254\265\306\2042"
+	.ascii	"\220\006\030H\210\207I\026\035\336\257q2\310\215!?B\035\316\253"
+	.ascii	"\230Z\353\362\217\020\207\357\313wy\301\356\nwY\032\002:\335"
+	.ascii	"\347\256Q\207\273\310\330E\27337\376\b\226W\346N_ \345u\241\274"
+	.ascii	"-\224\367Gy}\224\267Gyy\224wGyu\2247Gyq\224\367Fym\224\267Fy"
+	.ascii	"i\224wFye\2247Fya\224\367Ey]\224\267EyY\224\327\244\274+\312"
+	.ascii	"[R^JyI\346m\222\227I\336'\250QI\242\300\251\326\rUX*\022\372"
+	.ascii	"\343\350N\177\323Oc_c]{'\242\251\023d:51\n\232\247\261\335\234"
+	.ascii	"\375q];\343L9o\262`\352\004\315\024\213Rj\2550\247\013c\236\036"
+	.ascii	"\311\217y\3672\276\224s\343\205\323j-\332\321\243Vcp\007\004"
+	.ascii	"=\325\352\206\302qVzZ\265\372\334V\263Zg\024U\266\232\263\004"
+	.ascii	"Y\265\251\222\325\247\360\b/19\307\215s\261\ni\366\271f\257\032"
+	.ascii	"F%4\373PV\375\343iK\232\364\212\366\235v\024\207\312.p\033\327"
+	.ascii	"\275\354s\313\246]\303\004\205\201\251\026\352\373T\236\226\235"
+	.ascii	"+\022\370\221h\366\217\017\020D\b\322\217\035\256\242}.\313\250"
+	.ascii	"gz\365\3030\0076\320\247\230\234``\252\223\265\326J\356O,\201"
+	.ascii	"=\323\344S\017\211\336\335\230\037\211\002\230\324Z\r\320\247"
+	.ascii	"\237){\"\025\210f\212\375\205>\020\210\035\256Zn\004\335\375"
+	.ascii	"\036\027\344\267H\371\346~O\013\036\256Z`\277_\343\364\305\215"
+	.ascii	"!>Yv\270\252\333Xk\017\036\341\024\2764B\t\016&0\260\031B\270"
+	.ascii	"\261\261\271\241\031Bx\300\300fH\203#a(\354\355M\204\0068\303"
+	.ascii	"\t778C\227\261~\215]$\323/;\315\263\026\310ZK\034x\323/e\206"
+	.ascii	"\314\225\005\366\371t\335\323]\372\\\227n\351\032\027a\213\021"
+	.ascii	"\244m\361\005\271mj\365\373\265\257uF?_\351\343u/\b\204\354\365"
+	.ascii	"\271\275\3465\214\252\027\3445\257O\251\037\273]\353\240vR\272"
+	.ascii	"+\253\353\323G.\327\270\250\034\016g\023\366\270\335\332v\353"
+	.ascii	"C\261\331"
+	.string	"hQ\265\346q\335k}n\255i]\023U{B\033\202D\223A\315\204;f}\356\254e\2553\232\te\245\f\026<\242\343\265%\305\241X\254a\301\030\f\346\222zu\216\327\253]R\344\353\t\273\256\254\213\325Q\002\201\002\250\221\\E\221P \"\222\024\244$i\rA\006\204 tf\035\022\240s-\210\305\212*\221$\226\373\377\031\322\320\265K\235\r\263\305{sdo\273\2310\305@>\361yP\374\f\204\005\236\254\316]\345\276\323\377\273\223%\245\276\277\276\336\316\350|\211\343\223\355\340\340%\325\347\270\312^\342\245\365\377'E\354# \322x1\322r\275\235\204\227\214h:w\017\351\2573\200;\211\207\\u\337\f\204\237\023\273@1\021\200O\237\326\347$\007\211p\026Zs\366%\272\346eX\377\033&\363R\231\335\225<\205\247\032\361\0259\273\340_$XTzb\203c\ttx\034nY\257\361Q\341"
+	.string	"N\304_S\rN\256a\330A*\326DmK\216>\237\027\214\304M\300)\254\345e\202\334(\316$\350\316\262.\312R\257R\316Vf\236\005\305\231%\017\301\373\337\221@4\332d\215n\356\022.\250\263%!\225\035<D\315y$\226\253\325G\316e\355\004\330'\277\264pUez\235\216\371\355\304\337\300\260Q<\316,\0277\276g\213Z\020\254\276\246\227\352\216kC\021"
+	.ascii	"M\017\005\354\275\340\361-\002-T>\301\347\224i~\020!se\274\307"
+	.ascii	"\230|:q\225xveb\002H4\007\034~9\350\332K\034>\322\034r\330\251"
+	.ascii	"\221&|Z\301\250\2526|\257\344<\016\370\300\rw\256\344r@\207n"
+	.ascii	"\270s\241\027\007:p\207\273\013\201\313\330\261W\"\310v\231)"
+	.ascii	"\261h\353\260\354\365\026\006\340\345\246\263\370\007"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.26.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\210\017\3352"
+	.string	"zO\034\021K\240\226\231\016+H5\257{:\254\277q\322\224\002\244M\211@r>\022\036\332\253\377\025\363HO@\3155\217\261\343v\032\362\033\346\022\272\214\227\343\345<)m\310\273\356\344\222\374\026p\265|\027\344\271\200\277\205\377\266\367\226;\311\224\002\013\001\346"
+	.string	"\370"
+	.string	"\254\347^\262n\303\205p\032\231.U$U\245\220\006f\025\327u\217>\267\251\236S\247\251\236?E\253<]z\247\030\351\306\227\242\013q(\f\002[~\276\036\013o\247\313\341V\332\233\255F\233\311b\260\227\253\305Z\251\330U\315\351cd\373j \255qD\304\223\314qc\222\277$%\301E$\356\202\344\b&\376\360\341\017$,<\362\340Q\023\003\215\274\305\310\007\376\365p_\217\"\334\033r\226!\034\230w\303w7\204\260\316\206\347l\324\300\270 _\t\242\201\333\027~{\341\002\333Zx\255\005\013L[\341\263\025@X\246\364\230R\005\206\225\360W\t\022\3305\302[#D`V\b_\205"
+	.string	"\201U\277\023\035~\234u\322\363\363\213\321\343\203\327\017\256\276\222\032R\037s\007\347T\225\361s\364JfH\t4\225dx\221\343\r\311\0138\205\341\301\337\213<%b4\305\223\364\340x5\340\272nc\236d\007o\030\357~"
+	.ascii	"\335-\323\355\332\005\032\244t\360\324\177SI\306\317\377\333"
+	.ascii	"\275\314\301\001~\232\320~\024\3354\276t\237i\334\t\234\310\333"
+	.ascii	"\230q\277d\334\305\214\333%\343&f\334\303\214[\230q\0073n`\306"
+	.ascii	"\335\222q\3772n_\306\335\313\270Y2n^\306\275\313\270u\031w.\343"
+	.ascii	"\306e\334+\031w\233q\3372n"
+	.string	"[\306]\313\270i\031\367,\343\226e\334\261\214\033\226q\2772nW\306\335\312\270Y\031\367*\343Ve\334l\306\275f\334j\306\2353\356\024\343\376\0247Nq\273\002Z\214&\b\244\270.\207\251(\227I\026\362\302\211\334w\270\363h/jV;\021\222\315\351a\211\242\f\305\260\236k\3358\355\314fu\016\327\201\343;*\2609=\007\2248\232\\\3275zn#\353\031\233\bb\334\3558|\b\307\227\026\\\346\272(\220\200\270\3562\246\213\001Hk,\366\260o\201\242\261(\025\006sA_\177\364z\275\013\372\222q\275\213\365-\230\246\267No\375\333\255g}ML\013\206\365$\250Y\3776Iy\247\325\377\022#\307B\316u\265z\325\267@M\354\352\261TtU\315\234T\325\272\244\004\372T\372\260\217\233>\034+\251\244\354\277\315\376\372.\250%o\347;\0234]\337\231.{F\3715\277\023!)}\324\027"
+	.string	"\365\036\336\342\232J3\324\177[\375\3745:\226`\300P\375\304\336N\325\263\3727e\2143\221\354;\323\201D\236OBt\360T\376\267U@O\363+\0176\272\3617\270\223\216%\f\030\312S\327u\335\364_G\252\306\247\371\324\271C\342\273\033\251\302\231H\"\324u\335\001\331\3113\245}\t\005$\313\242\335\302\373\006\020:x\252\361\317\374\277\357\314H\275\223T\177\374\276\023\343\002\236j\343\373{\221g\032FS\001\r\374\201O\360\246\221\211\300@\302\214\315\321\301\215\215\315\r\315\321A\203\031\233#\r\204\bG\231\\\337<X"
+	.ascii	"\341(\341\346\006\302\221\265t\375Q$x\237\316_\350\n\251\353"
+	.ascii	"\236(\340;\334\233r$`\nj"
+	.string	"\343\277I\336:\375\345\337~\371\342\327<_\376V\204\362T$B\2238\315I\351\343\342\362\304o\201\240.\217\245\242\210D\341s\210$\035\376\333\303\027\276\013\3529|g\022\276\360\337#\301\177;\370\300\257\211\006\377\006\204\022\324\300\177\237FZZ\376\267\324\362\374\251\277\236\222\">{\246\276\177\333\367\275wA\371\336\231z=\336;YX\236\027\305\"\303{\342\351\242;(\221\335\356u\321\035T\247\352\376]\032\222\313=\256)\207\303\265/\304eHJ\237\225\177{\345\333\257\221Y\201i\225\202Z[\323-\032d\275\335\336\366-P\323\355\261T\324f\243-\325\036H\255\366\264\245\032\224F\223\315~\314f/\233\305\310\236d\260h,*\201d\250\201`e\221P \")(HI2\214\001\201\006\"CV\266\001\022`\262I\016N\031&&\222\032K\373\177\007a\034\266\370\226BJ\326\353\370\200\210\272W\315\366"
+	.string	"\2368S\270+\304\0332*\022\021\303\316&\361~\317w\305\247\264\322\346\001\251\242\201yUhM=\200\274\350\216\246d~,\315]7\300\303w~\033\243\261\230\247pm\271\263f\340\333\207\254\213\2735\230\313o\202\357\215\314\354\211\337\367\026^+\240 l<\n\376\253\313\310K4P=\203)\373&"
+	.string	"t\254%\373@\254\241KM\246@_\341\006\n\260.U\342\332\222\224G9\233\212\337\311\273\277w\314\372\2330v\352\326\256Yx\333\302\363\260\317`\366\210i{[J\020\313\257\373\002E1\206\332b\311'\224l\351k3\337\353\220{\307\276\313\370\231\032\200)Z\360\207\022nZ\321Atz.\346\355\264M\310[\251\264\337\254rE\277\002\206X\354\275\230i?\332wL?\313\032c\201\324\360\223\372\3568H\212/o\313;\221>\207y\340]\215eeo\bh\200\312\221\3012\312\314\006\303T\220\221\304\226\331\304?\324\310|\320\274\343%\224Mp%\212\025\206\353\312\216e\323&,kt\356\272(\006\021\273e\007E\203"
+	.string	"\003\001\023L^\237\220\310<\321\327\311\247-\351\016$\027\rX\326\226\360\bH\037\230\252\207\325\226\232\214\325>\375\026\023"
+	.string	"\302\310%bC\370\007\352\021\013\317\267\\\255}\335\321\214},\360\211\004\321\021\nR*@\372v\001_\024}\030\312)\343\372\003\003\224\025\3137cV\367\3114@x-bD\003\336\271\036\272\366\236\206\257\234@\231\300\324\323\323\220,\201M\345\263\371G\376D\310e\341\247\216\235$\376v\340K\204\\\026~\352\330I\342o\007\276D\310e\341\247\216\235$\376v\340KC\f\311\365J"
+	.ascii	"1\\.\306\366\235\3415\037\212\322O\200\364\230\226\343\037"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.27.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\332\003\275\027"
+	.string	"\366\351\216H\320TQ:X\007\0306\2729\033(\327\016\263\216K\315\025\035\260 \001\321\202\267K\244\335\321>\231\315\364\355\333\263\262x\344\322\346\324\213\370\200/\036`$\360d\303~\367\"8\320\253t\255\020\006\f6K\b\331[\312\224\002|"
+	.string	"r"
+	.string	"y"
+	.string	"\227\016\277\243x\n\226}\213\241\007\020/\242\301C#2\347L\235n\352.\343M\272\313\355\340}\f\357\250\254\203%\322\347u2\256\262|\357%\236\260\335`\262\326A\r/i\310\240\244\025\016\0240\374\323\021\303\2602\"vA=\013\357\342\211'\236h/\225Q\300\2343\200LB<\240=\262\035\215\"*|/\364H44\004&\253p\365^\346\234V\230\214\302Mr\333:l\273\330\253\"-\375\\\037;\345\341\217\"\325\246\327nP\252KRM\222\352O\252=\251\356\244ZJu\274z\243Z\243\372*&D9\030\354\230sB\316\310\304!e\204x\355\017z\013_\310\240_\313\371Z\261\257Vd\003\365]F\233\345\323\f\332,\016\304z\220\316\327\212-(\252\001d\316\311ri\026\034$W\373*\276\202\365\320\266\227\314\351\003#\306\234!\312\006\276;s\267r\035"
+	.ascii	"\331\210\240G\250nO~Z\276=\355\004\210\202\230\220\341\322\234"
+	.ascii	"\334\231I\0376e=\230\262\034\334"
+	.string	"\236\013\001\352\021A\217\036\347\2343\356\3549\035\270)\033q\257\rk[\3464\337\n\360\230s&\2208\230\221o\203\340\333\007\302\267m\337\223\301\2459\353\242\354\356_$\342M\243\373\352\3765bGs\006\367{\241\313\022CCx\216\2704\267;\347l\355\316\35403\257\371\203;\306\345F\006\007F\225\242Y\251T\253\230\024\315\f\214*\025cs\223rQ\361\252\246\201M\ng\265\262I\201\341\374\347\372\230\366\344\332\035\353\30499(x\320\017\204\005\312T\304 i}\300\270\311\017\257\2643\227\226\264'G\245U#-\244\001A:\322\247/\256?\270\370\355\314\337z\013\300h\206\336\270\375\016oO{\311\215\242\365$\352-\206~.t\213\200\307]\034\205\0063ri\316\341\234\263\013]\250aX\246\230!!\031\221\202\244 i5\240\002\231*\243\007\021\2009$\305\263l\006\"\314\214T\276!|\374\216\304"
+	.ascii	"\323\332\360\343\275\217=8\215*\224\370\350\306\336\356AgG\205"
+	.ascii	"r-\307\205\357\315\207\200C8.Ol\222#\306\243\275\211o A\226~"
+	.ascii	"\035\240\204\034\244\0274y\330\207J\316\025\237\035\347\225\r"
+	.ascii	"\354\346\271gAn\022\340\026\202\201x\230O\250\351\363\233\345"
+	.ascii	"q\235@\031\376\201\354\333\356\r\205a\202\226\2173d\027}H\260"
+	.ascii	"D\253\364Z\024;\303p\001\225\356\342:\230oZ\220)\243\366P$\032"
+	.ascii	"<\360\220N\373\226'\230\304)\260\034\244\327\tp0}\364\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.28.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\310\006=\037"
+	.string	"6\364\262H\260XQ:\360\242\327!^\310\016d\275\230\362J\221\320\353\034K\355\206f\224N5\2018\237\356S\276\323J\3539C\217\027\232\300\373\235\302\273C\376P\216\323\212c\353\257"
+	.string	"\313\304y\221\252}\373\337\376O\b\331D\312\224\002\243"
+	.string	"\216"
+	.string	"\236"
+	.string	"\322\273\3618\236\303f\367\300\335\213\237+-\345\360\252\3149k-\017\020^\202\217\205\227\353\302\362\340\356\006\325\366\030\354\345j\261V\252\024\3524\212\241\004Wm\276\310"
+	.string	"\274\321C\272\341j\036\203q\030\f\037}\351\356\322\275\320\326\212\263V\250\320U\212\253R\240\320\324\211\243N\230\320\223\201\026!J|l\262S\302"
+	.string	"\320\016\217\212$\036\262p9`\013\017G%\210\362\025\365X8\017`\002\037 \031'\272\352\340n\024\2241\342{\242\203D\214~7\334\210\253\310`\316i\275\341B\334"
+	.string	"n?\203m\232\035\022\b\272=\276\237\245*\336\036[\366\335\377\"\325.\037\272cR\r\223\352\227T\273\244\272%\325,\251^I\265J\252SR\215\222\352\223T\217R-Ju(\325R\252\301\253\027T+\250>L\254\211\211\203(s\202\370]\231K\344Q\214\017\375B\357\341\0239\345\017m\030kv\306!\245(\263\361r\264m>\317)\233\307\203l\027\3420\326\3544P\202\"e\316)\273\264l\274<\013"
+	.ascii	"W\373:\276\303\366\235\215\376\232\263\007\210\2209w3\277\214"
+	.ascii	"\017H4q\317\373K\211\322\212\233\233\275G\221\216'\334\004I\367"
+	.ascii	"\361\001\274\033\223\215\376\020\024\241\221#\334\234\303\225"
+	.ascii	"K!(I\007m\232\205+@\0073\356y?@\344\212\225#\033\375\311\315"
+	.ascii	"\371\344\263\262\025o*{lu\344\251\004=\351\240M\007\347\234\023"
+	.ascii	"\334\3347\204\261\225-\350\303Q\261\266\037\234\347\236K\322"
+	.ascii	"\234S\201\364\335\230\374#\r\356\215?\276\215\366:&l\364g\335"
+	.ascii	"\227\335=\316\f\360>\022~u\217\003t\243?\307\366{\242\313\032"
+	.ascii	"F\277\234,6\372\333\365\031\"\342\303n\316\336\325\004\023n\341"
+	.ascii	"\031\356\030\332\005\t\030 \310\324*\314\310\310\314\304\324"
+	.ascii	"*L\200 S\213\241\271P\243\025\360\214\205\b45\f334\265\324n~"
+	.ascii	"{\\\266\305fo\314\001\234\263\305\202\013\375Rx\270d\261\021"
+	.ascii	"{m\357\257\"\035\017\f\266/$\330\313\212_\2333bt\305\341\344"
+	.ascii	"\306\344rm\313\325j\255\220X\263\"\026kWH\312\232\255v\265\271"
+	.ascii	"Y\220\017\340]\2659\2536\265\024T\263\024\026\033N\235v\t\310"
+	.ascii	"cQ"
+	.string	"D\024jO+\240\211\206Z\275\002s\202M\tO\342\032I\322$:\236\221\246?\256:\0378n\316\343\212\273bB\002\336\276}\200\237\250\201`E\221\214\214HJ\222\222\264\032\340\002\221)\252\007\022\240\2045\006c\315\225\024\245\230\375\337\002\310g29s\3741\252\035\367\374\\>\326\306\035j\325{\0351\271\220\330a\006]\274'\005<\322\217\013\354\n\375\254\0357\204a|I)\267\t\016\320B\371\261\203\243\366c\250Q\031\222\267\035\034[S\347\201\303\270\004\036@`s\275\364\336\346~Ko\345M\276A\316\260\230wqU\256\200{\336\200_QsaX\245\301V\244s \330\005n$\303\325\340\007V\013^\322\n\211\364\333\354\251]R\024\372\3138[\233\3633h\223\025[\235}\231\247\277+!=\235=\353\322\261I\372=\223\222\203\340\030\0020\361v)1\372\017\357\367\244\217\225f&S!G-\266"
+	.ascii	"\343\331@\253\261\036#\221\245\210\b\250s\021\364\246\356\306"
+	.ascii	"0A\221>\340:\223%\233@T\261\3040\225\323\200\273\202}\bF)E\""
+	.ascii	"\243\346\023^\374R\013\345*\026\r'\234\027V\242\022(\237I\232"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.29.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`K\013\335("
+	.string	"jA\324\rJ\240\226U:\204\236"
+	.string	";\321\223\177\222\2322\343:\005\274>\013:\2550CX\236\0031VZ\340Z\022kY\006?r\214\327\022\315"
+	.string	"\254\302{\260\026\2746g\203\267\323\353\226J\357\0025\331\266m\333\266m\333\266\222F6\2212\311\322"
+	.string	"\264"
+	.string	"\306"
+	.string	"\301\035`\236n\321\374\321e\340\3546\221E\024D_r\3541J\251\265\016[\216+O\311\333\312\323>\261\253\223\305/\3118\007\262\254\374|=\336N\227\303\335l5\332L\026\203\275\\-\226\271*)\331\214\263_\301\2201\2064\021\201r\016L:K\322\f^A\372\017I\006\373\216\336;\212\301<\243\357\214`\260\256\350\271\"\026\214[\361\333\n\"\266\251xME\n\246\r}6\204\202e%\036+A\202a#\376\032!\202]!\336\n\001\202Y"
+	.string	"Lp\370p\023\311\317\007"
+	.ascii	".~\202x\345\341%\331\322C\266\030y\230\222f\2555\006\224\201"
+	.ascii	"|a\037\240\035&[tx\337\306\311 B\236\210@\035\316+\230Z\3532"
+	.ascii	"\021\210\303\267\345\273\254`w\205\273,\244\307\356b\2559\335"
+	.ascii	"\347n1\207[\250\330B\2732/\376\007(o\314\231"
+	.string	"\276@\312\313ByW(\357\217\362\372(o\217\362\362(\357\216\362\352(o\216\362\342(\357\215\362\332(o\215\362\322(\357\214\362\312(o\214\362\302(\357\213\362\272(o\213\362\262(\257IyW\224\267\244\274\224\362\222\347m\222\227I\336'\310\2758\262\200\251\326\rG*\325\b\375Qt\246\177\3515\3666\326\265g\262`\346\374\230LR\304\240y\032\333\305\331\033\327\265K\343J8_\272`\346\374 \220\322\360\244\326\352r\272.\346\351\215\374\316\273\237\361$\234\027\227\307i\265\n\345\350Qk1NZ\301~\312q>J\262j\365\271\255fu\256*\252l5S\t\262jPJV\237\315O\fe6\3438\0179\221f\237k\366\252aTB\263\037\265\352\033O+\262\244W\264_c\307PP\331\005\224\324Z_~\343:#\221J\207\217e\237[6m\032%(\f\\\265P_\247\362\264\354\334\020\001\263o|"
+	.ascii	"\247\032F?t\370H\373\\V\212\226\351\025\221]\016l\237GQb\202"
+	.ascii	"\201\253N\326Z+\331\347-\224\300\226i\322\211\207D\357.\314\215"
+	.ascii	"\333$@I\255\365\205:\021\251\366B*l\223I\264_\036}\037\020:|"
+	.ascii	"\\\356\003\335}\236\027\344\227H\371\346>\217\213\035>.\260\337"
+	.ascii	"\267q\nC\310SO\025\035\016\017\036\341\024\2763B\t\016&0\250"
+	.ascii	"\031"
+	.string	"B\260\251\251\261\231\031Bx\300\240f8s#a(\354\255M\204\0067\303\t667CW\261~\213-\024\323-:\275\263\027\310ZM\030\370\322\377\204F\314\224\005\366\351t\235\361,}.K\2574\r\213pE\207\321\256\370\202\334\346d\365\373\265\257sU?_\351\343u/\b\204\354\365\271\275\3465\214\252\027\3445\257\317\251\037\273]\353\240vS\272)\253\353\323G.\327\270\250\034\016g\023\366\270\335\332v\353G\331l\264\250Z7]g|\255\317\2555\255i\242jR4&#\232\fj&\3441\353sg-\353\\\325L(+e\260\346\247\327\240\206\202b\261\206\005c0\230k\352\325:^\257vM\221/)vMY\027\253\273I\007\201\004\250\221XF\221\214\210\210\244 )IZ\0031\006\204 \345\254:\022\340\203%\310b\re\"A\323\302\326\377;\302P\316\353\327M\321\337\372u\3137vX\034"
+	.ascii	"hXxw\b>\350\203|\277\241\377\005\264PU\030\205\027\016\215\376"
+	.ascii	"N\332\004\330\243\2637\035va\376\310w\024#\301\263\356\306\266"
+	.ascii	"\215\200\020\306\202\316T*E\271)H\276\346\227\r\322\362\314\232"
+	.ascii	"\204\004\023\361\356\350\224!\363\n(\023\306\035\207yM\266G1"
+	.ascii	"\315\006|\334\f\263X\277\202\025\246\026W\321\036\036\360\275"
+	.ascii	"\355\370\272\2743\360\215\360\251LS\031K \324\036\244\257\035"
+	.ascii	"\316\376\203\305\273\2046\272$An\323\267\367#\315!)#\025\240"
+	.ascii	"\022F\240\006\004\342\020\277\314\036-e\245bV3w\3206\364\265"
+	.ascii	"\320!,\"Co9\314(\3521\344\343X\212\311\243\035\344X;\351Zp:\306"
+	.ascii	"\006\025{\036\304\323\360\200\236emDLI/\252\225\222\354u\262"
+	.ascii	"\037F\211P\303]\275tnvn\240E\27103V\214\353\275\250\352\r\214"
+	.ascii	"\362\215\206|\363\364+\007\350\350b$\274+~\331\374\245\275\343"
+	.ascii	"\344x\002\300M\302\311\224F\316\304\353\277\264w\361\365\013"
+	.ascii	">S\206\373\203\brXfF\307\236\207\023\274D\236+S\030\300\260I"
+	.ascii	"\260\363kFo]\0262\024\245\245\026\340jb\354p+\"UU\305\024\211"
+	.ascii	"=/\300\375\t\237\017\314\373\006\256\017\330\375\304\236\027"
+	.ascii	"\340\376\204\317\007\346\335k\214\330+\277\f\fe*\261\322\004"
+	.ascii	"\262\024\322\233\261\200\3561\351\304?"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.30.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\322\017\0052"
+	.string	"\252N\354\020J\240\326U\007\002rx,\231zGg\355\202.|r\"a\177\330r\314\033o\352_Q\201c\274v`r\304\347\026<r\t\201J<^\205\327\202\327\301\233\361w\334"
+	.string	"\351\240-\256\377x\337\365\367\377\377\377\377\377\275\267\334)\245\024\t\001\335"
+	.string	"\365"
+	.ascii	"I\265\223\032\307\0173\324\231\\\341\242\247\214\330\240\304"
+	.ascii	"\302\262l\216\260uh\337\263qh\337W\301\256>\223\315\247\377\264"
+	.ascii	"\261\206f\246(\023\003C|\031\n\203.\300\237\257\307k\331\255"
+	.ascii	"\272\034\356f\253\321f\262\030\354\345RS\364\236\357?\334\251"
+	.ascii	"\201\363\306\224\322P\021P\033\247\272f*\211\323H\365\214\024"
+	.ascii	"\022/B\265\f\324\223\30785\214S\223\023\231\372\205)\210\017"
+	.ascii	"\201\264\020\310\222\007w\264\313\016\035\016\314\321\277\034"
+	.ascii	"8\334\227\324\275\244\033\316C\352\026$\033\276\213\321k\f\030"
+	.ascii	"\256{\321\271\027.\034\327\242o-X\270\r\3315\344\n\247\231\350"
+	.ascii	"\231\211\022.#\3211\022#\034&\242_\"B\270k\210\302\303Q\253N"
+	.ascii	"\210\216\2063\210\214<\005\321\350\254h\303)T\n\371=Q\032GN\263"
+	.ascii	"\"\r'\201&(4z\251\235C\021\006?e|\350\357\245>\215H5\207\212"
+	.ascii	">\264\247\006X\226e\037*\362\320l\323\314\017\200\231q\230e\f"
+	.ascii	"\002Ph\034\375\037\231\223@\036\340\250\251\345O\301\274\323"
+	.ascii	"\311n\235\353\234\240\225\232\215\327\271\346:\323\\\347\231"
+	.ascii	"\353\\\274\3162\3279\346:\303\\g\342u~\271\316\303\353,\274\316"
+	.ascii	"\301\353\354r\235\201\327\371w\235}\327\271w\235y\327\271\345"
+	.ascii	":\357\256\363z\235u\3279w\235q\327\371v\235m\327\271v\235i\327"
+	.ascii	"yv\235e\3279v\235a\327\371u\235]\327Y\275\316\351uF\257\363\275"
+	.ascii	"\316g;\377\351\354\247s+X\261\232 \250\302\262\035\232[,\223"
+	.ascii	"K$F+u\373\350\037\334K\f\343V\262\240\002\021\251JSL\334\250"
+	.ascii	"}s\314?\334J\2061\363\350\036?\355\343\202\nDt`J\211+\226e\215"
+	.ascii	"}\331\250\366\365\0230\355\314\255\243w\374t\222\237\332\306"
+	.ascii	"\262)\230\204\260l\362\206i\324\276\034\262v\366N\263\331\313"
+	.ascii	"\332\031\216L\006\373\230MS\357\224\035\373#\307\036\366<71\033"
+	.ascii	"\330\022\211a\256\253\247\362U^\314\217bjOz\222\276^\357\372"
+	.ascii	"U\353J}\275o1S\327\315\n\352J\255\242Z*\244\221\332z\220v\344"
+	.ascii	"\362T\377\310\352\247/\303\262j^~Gi\317\364[\331\266%R>\275\337"
+	.ascii	"?\234\220F\350\013h\033H\357\224CXA\336\3445A\251\201\376\221"
+	.ascii	"\321\277\317\323\203*\203kq\2257/\321\276\350\257\310\033\365"
+	.ascii	"[\331\304\245\221,\"A\336\274\177d\027\213\337\371t\310\215m"
+	.ascii	"|\016}\245\207U\006\327\352\223eY\366\374c[@\215\277\363\347"
+	.ascii	"R\250\3043\363\317\212V2T\261eYv\300]\016aqSU`(\325\0057?}s\b"
+	.ascii	"\021\344M\366\327\371\377\026\252q6O\241\375\376-4\003\2037\331"
+	.ascii	"\370\375\275\324\327\206TsC\226 o\3767\005\016\032BSh\336\301"
+	.ascii	"\221\320`\202NO\316\003\237\236\036\237\235\234\007\016tzrv\""
+	.ascii	"H\310\301\351\261\017\204\005\021r&\370\370D\310\201%\331\376"
+	.ascii	"\024\t^\030\364\030\370\302\311\262(\n\264\217\356+\036\t\224"
+	.ascii	" \261\261f\252\346\217\\\3634\317SU\363+MT\026M\261M\322\270"
+	.ascii	"*H\243\231\231/\2663[\305bL\225L+%#\3631U2m\314\307\374\021\t"
+	.ascii	"\314\037\031\346\211\317\303\204\371\225\030\205\304\304?VE\275"
+	.ascii	"\274\374\320\352\245j\210\016\203QG\372Fu\n\377\310\302\017\276"
+	.ascii	"\fK\370\035%\030\004\376\322\305\345\201[.8\300,\240\217\371"
+	.ascii	"k\215\374~\357c\376Z\037\352\373\243U\221^\357yW=\036o\367D\332"
+	.ascii	"\346\2044j\371#\267\374\356ypZlvG\220v\272\253\2259$]\327\327"
+	.ascii	"\375\252u\265\276o1u:\234U\356\205\344r\217\263\312\2658\234"
+	.ascii	"\355\006u\273\275\355vc\313\262\321\230\265\255\247\264V{\332"
+	.ascii	"\257Z\314\332\026J\243\005\201a\250qhd\215\214\210\210\224$)"
+	.ascii	"H\2061q\006\"CU\306\r\022@\222I\216\307*\312\\ 2c\033\373\377"
+	.ascii	"\0061\274<\304\277\276\302/\340+\235\275/\212~\247\365'\356\251"
+	.ascii	"H\343\004\177^\360ga\376\037\214"
+	.string	"\357\261\250\341\334\376f\037\325.!\341\230\002[tq\217\323\307'I\005\003\201\375\275G\312\263\230\334M\035\367\266fj\361Q+`\227\363m\rF Y\"\375q\013F1\220\342\023\017/\361Op\225\025l\353\003\352\335\340\264\"\327\311X\322\215\222\030]\224+\227\277(\252\321o\034\n?9\026\345o\226\217Sh\313\250\231(\003\016\031h|\320\305\215\306\026\232B\363\350\351\234\177z\261\tm\016\300dqS\265KA/0\002K\240\234\341\0254\230\006\310\367V\310\332c\357\027c\220\346Lz\304\347\246\241\330\202\275\274\f37\b\251?C+\371\203\363,\323m\030\243e\324\361\t\004\016\345\220\326\316\303\353g\374m\352w|\236\024\362\024\260\214<E\247y.&\372?\327\375+t\203\230\240\232`\367Xq\252M,q:\326~\"xUW\237\016\350\004\330\227\364O\266\254\313\bJ\274*`\233\272\b\365"
+	.string	"\371\036\307\236\256\2021Eg\264O\nQ8\377\314\263Kd\210j\25568\3054Q5 \210`\200\307a\261~)@\245\275\\\227\027\304\315\227{\326\025\200\333\3718>\224+\250\261 i\317\214\313("
+	.string	"\310\315\002\227\271\202x*\340\374\037\331\203\221\364c<h\006\353\007\364\375\265)b\306\264\356}\260"
+	.string	"5\005\330\233\204"
+	.ascii	"~\345\3657\026\032\206\212\353D\002p97bG\022}*\237&\030\266o"
+	.ascii	"\317+\247\353E\325\214\323\217Q\265\262\3505\363o\211Z^\357\213"
+	.ascii	"\365\211$\035\253\266\345\3703\244\336\026\333\3207\364\327+"
+	.ascii	"\273\354\272B\005V\302\254\341$;J\334\004\234I\323f\374\003"
+	.text
+	.section	.gnu.lto_arraySubInt32.31.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\032\002\305\021"
+	.string	"6\"vF\360\356&\035\202W\275\021*\341\267\312c\032\202}\350x\242\234\3533\277\305\267\336\3553\2322>f\307s\354\231\254]\320\263\267\3064\0326V>\221]\363\0258\236G\371\2706.z\235t\2175\030\261\204l)S\n`"
+	.string	"`"
+	.string	"^"
+	.string	"\013\202\370@\367\315\340\005p\337\272{p\337\374\262[\034\274\331\373\220p\331\201\261\273\236rp)\f\303\360\021\274c\276\276E\315\227?\273\001\242\231\354S\371\026K-0\036N_K\024IB\n:\355\371\362\3012\206\230\271\236v\004\265#\3317\363,9\330]\247\354\223\271\271\333\266`\033\202\235\021\002O\2272\315=\275e:>\255\232NM?\300\200\230\024\022T\354\302\2041\266h\013\372\360\236\333G\341\323z,\324\251\304t3\037\034\244\335\375\370\346\007\335\267k\330\316\023\337y\235\307B\021\300\262l\310"
+	.string	"\264\273 n\320}+\020\357\301\351\310`"
+	.string	"\022\205<\355\2278\316\3539)G\355\326\340"
+	.ascii	"m.8\215\332\251\032\305@\300:\264\244wq'\3354\032\371?\027P\272"
+	.ascii	"\016~\n\367\027\232\225\f\235\312\241\252\217\215\210w\215\273"
+	.ascii	"\246>&\002\226\241Mz=\355\321E\355\205\313\214\225\fUgC-\237"
+	.ascii	"\252\215\r\252\244\310M\022\222\265\306F=\347\357\270\316\177"
+	.ascii	":\370s\234\347\337x\317m\312t\027$w\225T`\251\266\005\n0\244"
+	.ascii	"Z\255\024\347:\031\231\020\255\n9\241\340J\255\274\022\326j\305"
+	.ascii	"Ry%$\251\225\247j\235x!\004\3142\031iy.\026\253\345i\200{\255"
+	.ascii	"\361g\357\206\276\242\025\205mjc\023\215\242TY\344\307M\372\262"
+	.ascii	"\241&}\216\t\"\226Lz\334\335\215Np\223\242\3642\265\243\230\206"
+	.ascii	"N\375\037\023\224\323\212\374\221\005* \240\202\031\313m#\016"
+	.ascii	"\224\003{G\226[\224\276\265\240\214\244Q\370(\376U\034\331\221"
+	.ascii	"\231y\233\006Y\301\211\005,*\260\004\213i\256\262\225\331\036"
+	.ascii	"d9\355\266r\ro\030\215]\334\2601\265\016\247\003\033gmv\230!"
+	.ascii	"\f\267dbin\300(\371^>\213\2440T\215\367#\322\271\304\023"
+	.text
+	.section	.gnu.lto_qPercent.32.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"U\b"
+	.string	"FP:6Po\322\0015\241\031Q\304\234\205\316\261\004\230\215\203"
+	.string	"\200T\f\337\034\265\213tk\b\271\257\215\037\304\004,\27533\351\252jX\\\267'!\250<C\233l)S\n)"
+	.string	"+"
+	.string	")"
+	.string	"$2\273\033\tn"
+	.string	"o\345\013\340-\3158\367\344\374\217\374\245R,'\224\350\t\320\260\273\316\023\252\342\326\333F\260\255`{%3\333b\245p\330\336l\215\355L\373!\027\331\336\205,\260k\341\201\262\273\fN\b\270\265y\266\375\217\203l\346\262\323\240\200\033%\246V\201\327\324\214)\251^\036\202\252\327<)u\220rew\242T\f\373o\365\302\357\335\257\232NM\037.\230\334\005fwb\025\022\367\305\371<\200:X\364d\030\226]\321\003\321\301\342\245}\"\347\300Y\204\203\026AY\246EM\267\367\323\315HIN}z\223j\224+\017<\013"
+	.ascii	"2\003\3020H\341H\232\315\2720\216\2145E5B\2011\002\2320RRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_qMultiply.33.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"=\t"
+	.string	"f\022@8@\305(\035\355\245\2030\377I\334\224\272\373~\324\201\265\304j\"v\307.\270'j\373\310\206i/{\262]\252\366*\212\216\252W\227\207\300;\b\303{i\307\336D\312\224\0020"
+	.string	"0"
+	.string	"-"
+	.string	"[r\032\023p\303\205j\001\330\335Hp\003\370\227/\200\177\232\361\355\271\371\0179\266b\322\245T\244g"
+	.string	"\303\356:S*\212[o\033\301\366\202\375K\022]\200Ey#\034\266G\366\305\266\346Y\233\337n\205+c\371s\246\375\217\203\214\316EX`\327b%\262\273\nN\260\374a0\333\376\352\036#\007\332:\275\236\376\324a\312\316\230^\363\004\365*egs\244T\f\373\330\352\205\3554<\367\277\263~L\323\252\351\324\364-\231\222\247\250\354\006\"\210\217\247\363\036n\216&\344 \332d\321\243e\231\306\211\236\316&\213\034P(j\016\254}\032@Q\244i\240x\341\366\206\212)\251\311\252P?p\223\300T\325\016"
+	.ascii	"2\003\302\260Z\270_S\363 X\230A\270&F\322b\177,H$d)\240\206\200"
+	.ascii	"\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_qConstruct.34.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\005\t"
+	.string	"\306\021>6@\217\322\001St\204\357\031\316\345\035\353\251\205\250Z\365\037R\264\234\360A\272o\353\245;lE\223\235\3204;\206\201`~u'\310\261\001\322\243k\365\336[\312\224\002/"
+	.string	"/"
+	.string	")"
+	.string	"\027*\210A\202j\261\354n\314\234"
+	.string	"\376\271\017\300?\265\370\3509\362\357q\247br\222R\221\236"
+	.string	"\n\273\353L\251$n\275m\003\333\t\3661\001)+\273\021/\327\242\274\220\f\333\"\033c\263F4\227?k\332\347x\207\350\033\204\337\356\304\ndw5>\270\374\t\244m\177\343+\221Gn\013\026\201\327\324\237\\\246|\331\3515?P-\245|\331\033)\265\302\276[\245\260\235\206g\375\357\333\3574\255\232NM\377\202P\362\231gA\261\207L\335\331\200\030B\034,f\032\206i\235\2305p\260\330\371\200\342\246\300\232\203\347\023C\232\366\211\230mo\250\231\222\232\024\352O\032OU\265\025\360\017"
+	.ascii	"2\003\3020-n\213\301\n\260\345\237\303\271\206G\322\002~L(`\016"
+	.ascii	"\f&\240\206\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.36.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`F\004\345\030"
+	.string	"\366\352\226K\300\020)\035\346P\236c}\250\346\374\005oe\375z\334o\327\227R7z q\216\206AC9\223ZQ"
+	.string	"\241\3775\272^\363\226\253\t\024\b\022A\223 H|v\353k*@k\232@\376\327l\037*\332\2364B\b![J\231\002\203"
+	.string	"w"
+	.string	"\200"
+	.ascii	"A\273=Z\244\332/t\220;-H\321,Q\325Za+\226l\200q"
+	.string	"E\272#\343\212\375\363\376\330\265m\235,\263$G\2216\273j_\256\341Q\330\026\031\013.E\342q\243\007g\303\236\007X;\032\330$c=8;[\272\330e\240%\265\326\035\332\3510I\223\3431g\3052g)%s7\037^<\034U\251\232r\332\340\262\r\317\306\315\nqayd]d\254\326\372\265q\330\277\366?\214\377)?5\t\314\017a>\b\363?\230\377b\276\213\371-\346\237\314g-\323\336,\311Q\244\315\373\333/\2005\360T\353\315\320\252\362\210N \266i\227i\371\337\177K\320\276M\033\374\t\2441\321^\202[\272\220\326\340\n\021Q)\250}\201?IL\2405\310\300H\306T\255\365d\305\237\234y\177\253T\203vg^\245\013o\326\312\242(E\2555\301\212GP\256\370o\022\355\027\322\037Pf\267\210&\335\320\215\207'\331\343\325\253\246\367\304j\337}f(\001\237p\\e^\354Q"
+	.string	"\212\002\030\222\212J:v\213\214\023{\201Gd\373~B\244}J\267\273mN}f\200Oc7e\262\241\353\211\224\272D\3724b\356m\233\323\031`\013\034W\275\227v\373\204k\202fGT\375G\\\2556\223m\356\r\356\tQ\f\235\320\215\207\357\355\246\0259\036\267\357\355R\001\252\232z\373\374\373\333\025\t)2\034\343\322\"Ce\366,(0\021bVd0\227\231L6c\201\271\264\254\310`,/00\024\222\317$@x\201\305\314f/\260s\333\247\201\260w\202t\310C\3721[\337Z\017h\364`\221}j\212M\342\241F9v\371\321e\203\364\352\320\365^\315\352\217\346\253\016*r<V\256~\265\b\245\023j\265\331\256\036\227tC\025t|Q9pg\267z"
+	.string	"\224\256w\343\341\b\034/~\013\206C)\263\317&\260dv\331\254\026\177\204e\227\035a\250aL\345\0303BB\nR\220\024$\035\260\002\231\301\342\006\021\200\255\223JhAI\n\255\031\257\003\360\221\377\343\3051\224\3424\236{\301xJ\027\nb\357#&g\320\317\356\243r\227]d\335\310\316\251\013\224j?L@\342\344c\362\354u\277\221\03106D\023\002\035\370U\306\030\337\230\246\206\230m\254\242\244%*\334\315\300\033(\260P;\214d\022\221\310B\263\335i\373\366G\372M\240\372\t\236I\270N\247\354\372)\004R\261\\\223%,I\230\202\374a\377\256\031\271"
+	.ascii	"\257D\fKq\355\212E\030\236\237\031\312\003\204R\275h\030\002"
+	.ascii	"\021\227\230\344\2604\361\232\266\202V&Ku\230\327\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`\207\002\275\t"
+	.string	"\204\f\203\003"
+	.string	""
+	.string	""
+	.string	"\002$\177\033\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \005\177\034\253\325\252\325"
+	.string	"\272\200\202\002\006\177\035\200\200\200\200\004\007\177\036\b\177\037\t\177 \n\177!\013\177\"\377\377\377\377\003\f\177#\r\177$\016\177%\017\177&\020\177'\021\177(\022\177)\023\177*\024\177+\025\177,\026\177-\027\177.\001\030\177/\370\354\254\031\1770\200\200\200\300"
+	.string	"\032\1771\350\314\2313\033\1772\034\1773\035\1774\036\1775\037\1776 \1777!\1778\"\1779\001#\177:\037"
+	.string	""
+	.string	"\200\200\200\003\001"
+	.string	"\302\001\003\002"
+	.string	"\241\341\365\321\002\004d\003\f\204\006\003\020\244\006\003\021\342\001\242\007\013\342\016\022\242\026\003\022\021\202\001"
+	.string	"2 "
+	.ascii	"\003!\022\267\001\334C\025v\267E|c\373\202\235f\342gR\310SK\362"
+	.ascii	"\372\206\370\350\021M\226v\2550\031\026\205\200\240\307}\003"
+	.ascii	"p\277\201\237\036\321\3037\362\r1~CBL#<\271W\341\025\214\337"
+	.ascii	"\370\215\337\370\215\337\3107\226\337\370\r\372F\312\276\261"
+	.ascii	"\363\215H\021\256EG\304\013\370\271\341\033\277\021\344\313@"
+	.ascii	"\272\210\317\301\030\003"
+	.text
+	.section	.gnu.lto_.refs.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.834b0621f35a55d3,"e",@progbits
+	.string	"(\265/\375`L\034\235{"
+	.string	"\032\310l,P \022RJ\007\311\264\326FbE\020\033\227\033\t\361V\332\314t3<"
+	.string	"IIM\256tI\025"
+	.ascii	"]\360@\252\311u\2648@\352\346\004\2572I\353\363 \310\231\251"
+	.ascii	"\271\310\252\252\022\210BT\366>NG]U\225\030D\315]&\242>k?!R\246"
+	.ascii	">\002\260\002\334\002\\\306t<\307\3252wa-{F\322\236\257\3323"
+	.ascii	"\220\366\374\243=?\3333\230S;:@\303\355\005\371k\226\341|\316"
+	.ascii	"q\"\204O\250\351\335Y\323\264$\0056\333K^\334\330"
+	.string	"/N\334\3224{\226\302&%\325\022%\345\302]\370\215\313\330\215\267\234\333x\352\306?\234\252\203\304su\034MI\357\275;FX[Z-\213\303F\355\371\266\327\241=\016\355\317k?\203q\030gY\235K\321kv\3574\3040\356\313\232_\263j\004\330\004\036\231Q\322\354\231\355U\214M\245I\241\"\200\222\234\016\025?C9;\333*\366l\313\260\226\364\302\246\234\252C\274\267\r,\355\336\213\306>0\026\246r\032\227\361\025\256r6c+g\247\367\"\335{\317\323\337\347\347(,\205\257\260\330\251\253\330\363\352\310\241d\0010]\312\300\376\356\275&L\2300A\200\211a\2200mi8\354Gh9\312#\204\001p\320\236\311\216\200\321]q\004\332\017\320\236\247=\261}\267\217\343\021\302\004x\204\220e\021B\236)\217\020\266,B\330\300\b[0\262RXCx\261n\240\003\345\203\363t\202m\"p\240\335q"
+	.string	"\007\227HT\225F\304\360?P\370\257!X\207/\277\353\374+\261\356?\335\355\376\347\375\277;"
+	.ascii	"\177W\333\334\376s\231\253a\013\214\377/\252\024\340\3447\177"
+	.ascii	"s\235p\344\377\331\377+\377\251\377\321n\3637\326\177,g\377\216"
+	.ascii	"\032\241#\207\257\177+\377\2778\376\354\344g\257\007\377\206"
+	.ascii	"\361\376\333\205\267\177\273\370y\001n\242\346\303\277C\370\331"
+	.ascii	"\353\347"
+	.string	"\255\237\263~\306\372\271\352g\250\237\237~\356\361\263\323\317;~^\372Y\351g\347\317H?\357\360\363\362\347\032~6\376\f\343g\027~f\341\347\024~6\341\347\017~\326\340\347\n~N\361\363\211\237%\370\371\201\237\031\370\271\201\377q\377\365\376s\371\257\366\263\001?\027\360\363\210\237E\374W\3633\317\377\027\377O\370y\347\347\234\237o~&\376,\374\371\377\327\374\007\374\177\346?\337\377\275\377]\376\273\370\237\345\377\n\3771\370\377\366?\201j\265Z\375\331\266\177\355\371G\254\b!\356\363^\250\273\346\325\361\350\372\273PT%p\232\312\030yr\225b\305\2518\367\206\335{\r\340*c\300\2545{?\"{\241=9k\366]\325\276\231\332\377,\274F\317{\257Spz\237G8\034d.\361\347\360\312\013\334\333\200\364\336*\275\276\226\t\325h\252\331\373\337\333\fq\247\367\351\034\273j:\311\302@CL\257\325"
+	.ascii	"wL\310uN\257\240l\364\366\235^\276HWP\032\316i\364\351\234F\233"
+	.ascii	"<\027)\332\274w\n\345q\232\0315\3319v\005u\216E\241!.\322m\336"
+	.ascii	"1#\253\026)\nuv\211By\234cFP'\322\0254D\020\275\"x9\320\030A"
+	.ascii	"\341\246\023\351\356`\2422z\362\3049\247\321[w/\233%\335\347"
+	.ascii	"\002\367RE\237uF?8\355(n\307\321\025\243(O\231\216\260\242\027"
+	.ascii	")\316\331\025\275\267\353H\306e\242\2409\215\273Z\034\327\024"
+	.ascii	"Bu\227\222\356-\340N\357e\272\267\3117\356\336\333\274\367\016"
+	.ascii	"\237T\323{\245x\234R&\246{\241\b`\272TM\265\244{\333lL\032\324"
+	.ascii	"9\206\025\365Q+\033\223^\034\323&Ko\335\325\263\035k\212\335"
+	.ascii	"%3\255\024\312\203\257\251\3269\037=\230\304\265\375\243\241"
+	.ascii	"\270\214DG\235\341Z\352A\243\351\235\362e\035A\233\345\341\021"
+	.ascii	"\302s[\253\303\275LB\310\325*\223(;\265}\260S\242b<8c\372\260"
+	.ascii	"\230ei\247c8c\316\340\374\232m\350\272C\340\275F\r\355\346\321"
+	.ascii	"No\350\247\314\n0+\2603\254\373r\032\t\237M\302(\027M\251I(F"
+	.ascii	"\346\364\262\203\251\177,)1Q\2274\251.\351 fir\342\204\232\323"
+	.ascii	"F\344\013L)\207\r\024\225\025\225f\3379\366\270\326\200h\226"
+	.ascii	"\301|\336\316\0359\252_\022\034I8o^\320N\372\033\251y\330\241"
+	.ascii	"\242\366A5\313\006\260\ba\033\371\274\217\032\n\021\247\221f"
+	.ascii	"\205\335\354k\345\255\311\226f\337\367\f\3306\235mI\315r\024"
+	.ascii	"\237s\225\025r\246iI\020k\310\224\214~4\273\006\020'-0\351)\020"
+	.ascii	"\260\271vp\3715"
+	.string	"\313\177\234\206\313\316\306jND\232\3361\326\332\322\324:ko\f\253\325j\225\317\206\346LNVu:\245\3313?\367\261\037\203!\246\3319y5\333\r\260\b3`\2420E9\233\375\231o\357f\016\017\252\251Y\326#\221\203D\327$\026\245\r\303dV\261'\trP\364\030\217\2770\230\213\025V\206\363\270\214\361N\242\225b\006\032\025\262w\30354L\232\322\366*\200H\022&\346KJ\307r\\v\\\307c\002-\016\263\263\036hJ\264\344hr\267cG\230\330\327\017k\332\226\226\252\244m\020@:?2%\245\325)\202\335\222\237U\225\251%k\322\232\264:E\230\336&a\021@\036]\1770\312@\321Zq|u\226P\266\325\344\300\234(R:-Uksm\256HX\210f\300\330\236\254G_\221\362V2\272\262\243fW\243.\023D\232\222w\324\177_ZWe?\372\372\272\332\322A\t\371\264\374"
+	.ascii	"\223\246\203\300\321#BDG`\257!\343\366&\327\354\331g\333j\032"
+	.ascii	"P(\346\t\315\020V\t\002b\265\231\207\306F\n\210$I\263\355\327"
+	.ascii	"\1776Rk\200l\371C#\342\217\t\355\f\353\221\320\231\0322D\351"
+	.ascii	"\314\305\354\221\335\261\031\235\271\037X\322\316\340\3415_\240"
+	.ascii	"\231\332\324\307\336\233//\207\007>\036\2404\333z]\206\230\026"
+	.ascii	"&\351\256\314\252\227\304\003\251L\336\n\247#j-\217\267\\\251"
+	.ascii	"\316\351\335\315\315\365\335\034^GY\365\0051\346}G\265)\323\202"
+	.ascii	"%M\263mwjKg&\025D\263]w\352\227\335\325\232f\233\356T\261!ja"
+	.ascii	"\232m1p^\274\264\334\020\270`\327\232\263\2740o9\266\341\022"
+	.ascii	"\273\346V\263\rf\215\226Q\243\232\355\270\033\251\"<|h\266\341"
+	.ascii	"\316\326\002Z\221\002D\263\375\345\007.\\\372\315\215\211\032"
+	.ascii	"$H\334\336o\354\003\017H\322\224\216\264\017I\223\312\226-\315"
+	.ascii	"&\002\226\306\362\204'$\311\332Z\263\021\357s\316\354\206\256"
+	.ascii	"\210\323\222\037\336lTb\031/i\222+4\264V\2333\"\rNu\230\201J"
+	.ascii	"{\253\345\355\\\275\271\277f\233\332g\r\366\325\346c\225\252"
+	.ascii	"R\245\257\220\001\321\273PP%\370\207\032\037N>\274\257\344\215"
+	.ascii	"\375\200F\345\254\323\220\005>\235Y\231r\345CM\r'N\372%\326\254"
+	.ascii	"\031W\361\353r\353\203N\247M6\267\244\227\200\327\021,co2\352"
+	.ascii	"\337R\324m\266\2474\225\240\230=\351\235\030\020WQ#\3156\203"
+	.ascii	"Mb\320\2645\373\325\350\311\223\216\322\322a\031\026 \316\037"
+	.ascii	"\031\027(\357(\f\330H^P\274f\033\254\303\232\246|z~\335\203\320"
+	.ascii	"\256\313\nG_WW;\221#\263&\251\301\2536y;\241\352\230\021Q\243"
+	.ascii	"\326l{\235\272Z\231\013B\205\307\305\325K2\300z\323\353':\252"
+	.ascii	"1%\357%l;aR+s\315\266t\370\366\005\253\212\215\365\241\006\346"
+	.string	"\305\256\335\332j,\276W\316\214G\327\027W\375)q\342%+\253\217\264<\367H\216I*Dc\305\326\203\221\367\021\326\252.\252H\263\255\265\203&Vw$\215\310\2114\026;\233\367\256\367\006\t\224\352"
+	.string	"\241\322uD\326F[H\264\261@\270\227\247\321\246\347\205\352Q\342\035\244\253\336V\177[5V\227\201\202HH\250h$b\"i\350)J\3068q\243(\211\024:A\001\213\037\026-n\364\034\201\212\204\214Id\317\222\250\250\247\307\206r)\203\251L\016\203\212G!\326\030\fb.i\020\005\231\306\242%\223(\251\354\200\206\215\rBCH\246P\221\013\032Df\362h\\\036Q\240\321\216@C\321\n6\024\227\313bN\220\005\025\254\bR!\302\202\nV\250X\036\231BH\020\216.j0\"\213h"
+	.ascii	"\320\302q9$\":\032\215E\241\f*`\370\314\020\274\201\\2\213.\230"
+	.ascii	"J\025\200\204\220E4\210h\341x\003R\2508c\251L\332\004\335\034"
+	.ascii	"c$\213*\034\205\212F\"\033\242"
+	.string	"d\021\tTTA\371\202\350x\\\3068\002\361$\225Hf\021Y\343\350\001\320\262\b\224,2W\250q\004\n\340hL\026\221\313b\0135\216@72\210\212P\250q\004\032.\213G\241\016j\034\201\332 \035\240d\221\006\240\342\321\003\033\204\206\206\2129A\313\243\r\345\220\020\310\030c-\336\244H\026\231E\034\"\245\321\346F\233\tP0\227\305!\0247\224\313\241\241\342O\022I\024\342F\344\362\230<\306hO\001\213\023,Z\334\030\276\305\005\023\\0\201\360-.\360\361\271\200\205O{\026>+\363'\205\317\rd\320\220\371\303\302\247\250\024\n\n2\177R\250`&\221C\346M\320\021\350'\307F\321\206UHH\271de\030\231\310\241 \321Q(F\262(\264Q\\\256K%\323x\254\3613\024D|\201a\340\030\230)\243\200+\207\216\313\036\246R\271\354\271I\376\314X\211~j\034\201\230D\303\373\370t\220"
+	.ascii	"\013'\204\320\032Q\020\311`\026g\364$\2253f(\215=IdqF\217qI\324"
+	.ascii	"\203\202\204\013\0276\216I !\345\317\f\341\n6\216\311\237\031"
+	.ascii	"\302'\325`\232\260\244\036\323>;.\255\325\t\226\225\352\036\231"
+	.ascii	"fW\256\257^\\\215\325z<\275P\321\346^\213\265?\276\347\337uR"
+	.ascii	"\225\b\036q\213\342\243\331\225\311\327.\272\271\267)\177\355"
+	.ascii	"\252\344\353\222)\036w]f\332\177\225\376D\234\254._\370\360\332"
+	.ascii	"\007\351\214\030Y\267\334p\222\322h\325!\371\272\005d\310\345"
+	.ascii	"7\255kv=\322SD1\270(\260.C\206\254Y-\2324\207nJwW\344k\326\315"
+	.ascii	"\335\036\230\\\263+\221\006\002g\365\206$\313j\265Z\255XG\316"
+	.ascii	"\374\232\246P\257\276b\365\224\020).-@\332\360\232h\261\"%\265"
+	.ascii	"V\261\017`9HZ\316*A\276V\345\005\237r\\]5\273\002\341\300\035"
+	.ascii	"1u^J\232]\2518p\3152B\325\244\331u\212\003\211g\226\364\005\001"
+	.ascii	"\006\005uGu\323\334z\222W\344\351iu\252J\207a\316\220\t\362\350"
+	.ascii	"\321cu\"\023|ZK\312\252\256\317\365\271:\021\355\336\364t\306"
+	.ascii	"\274\201Q\262B\277:\005\202g\250R\3610G\003\231A\206JdD\222$"
+	.ascii	"Ic\202\013\020\004CI \346\314\003\022\200D1\223+\246Hf$IQ"
+	.string	"R\032\326`\217\036<T\230?\231\320\006\264\217\212\025\252B\257\224\026\345m\211\375h%\261\222\225\307\b\247]\002\\\016\020\b\316\275I\251\026>D}M1#\023!`d\375\030\3132\300o\337\374p*\023\372\326\326\234KF\022r\244\347\337\351\320\327\221\220\251\337\203\"t\351&\027\026\271H\243\303\234\307j\263i\344d.\260$\256W\311\226\376\361fC\302\225\354iyy\311\273!+\350\240\ry \362\0074E\016\220|\031\232\353c\024\265\336$\\v\272l\004\2378J\257 yr\236O6\240\246kN\306\276O\003\216\353\232\321\310\311i\027)r@\244{7\003X\322NZ\202'fd0\345\373\267\0253[\276\263\330w7u\370u\366\236\225\275\311\316A\023l\255\332\220\322Q`\347\r\025(1\360\035\303J\314\360\002\323\311\301{2`\236\253\330V\333\322\277\241\230R\363\212d)\235\202w\277\f"
+	.ascii	"\217=\202\223\376\237c\311\304,2-\003\351O\201'<\270\317\352"
+	.ascii	"\250\234\202_\314Wq\301W\236o\"\211C\004\326\341\036\260\007"
+	.ascii	"T\304Md\300\261\016\021\375F\274\212]\351\"\201EO\341\227\304"
+	.ascii	"k\370\033\330q\t\364{\236\017\265\224\366\212\234\275m\024\375"
+	.ascii	"\037\024z&\34568\t4\022\333\262\226\361\347+\205h\267\377\206"
+	.ascii	"\364)z\"\374\031\246\032\313\366P\245\216\226\"xM\007\200\352"
+	.ascii	"\272j5\201B\245\355k\270DEY\"\337*\331\3178\034\fL\323yh0&4\022"
+	.ascii	"\026>\n\221\357\307\225\237\205\210\346\222\177URA\270;yB0\""
+	.ascii	"#\r\f:\304P\264\343\273q\332e7H\347r\311U\257m\220+\252\216\033"
+	.ascii	"\r\253\200\330\257\200\302s\344\204\006!\230\245W2\206\334\336"
+	.ascii	"IA4\031\036\032\306\305\313\025\013>]\312\311\340\300\3353\277"
+	.ascii	"\332J\347\264\345\373r\023\250\005\242h\337C\214\265\013dg\021"
+	.ascii	"a\211\267\347\373iU\352NO\264\3523\020\352\331\237\252\303<t"
+	.ascii	")\237\026\2503?\317R\226-\365\240\371s\220\210\233'\203I\037"
+	.ascii	"\224\245x\204B\023@Z\322\272R\302\347\326\306\234\304\233\036"
+	.ascii	"P\334\224\352[\356\236\226\206\355\350\250\235\333\310\216\250"
+	.ascii	"a\355cG\224L\367sl\"\334G\004>.\n\342\221\247\\\334@\354\017"
+	.ascii	",\3120@\253D\373\247\3149\227\\\0060|\017\r~\252\246o\240:\373"
+	.ascii	"N}\"\263U\016fG*\230\253A6\255\352\"*\330\330\032>\021\306\376"
+	.ascii	"\263\237\025*\275;)n\233\355&\031\234\020\274\204A[T&l\301\017"
+	.ascii	"\213\361W\006\226%\0048\230\213\325\302\276LP\t\230\356\366\317"
+	.ascii	"\023\"\211&E\035\031\263\n,\332\230\340N2D\364\t6s\367&*,!\217"
+	.ascii	"\333\03788z\273\3162\274u\333\007\261Ly\247%\020\351h\340=#}"
+	.ascii	"\207\034\001\245\333\223\262\003S\257\360\244m_\212a\"a9\351"
+	.ascii	"@\tn\342x\345h\024\2427\365\302C\300\260s\355O\336\333\246\243"
+	.ascii	"\303\t\024\361c\020x\263\205\337\217W\242\023AR-A\306[\315^;"
+	.ascii	"\332\352s\354\002@\005B\200}T\225\233\342\b)\203\246\332\021"
+	.ascii	"\373\230\225:\317y\222\316\224\326\265\200\241\330\356\216O'"
+	.ascii	"t~\316\330\340\252_\344\003\357\366\257\016Nla{#\275\023\024"
+	.ascii	"\367\373n\f\274\f\035\324o]\203\346Gu\351\274\356c\"\213l\\\364"
+	.ascii	"\020 ]\245\005\033o\277\344\035\0359\005\357\016R\317\315^\202"
+	.ascii	"\234Dd+\305\003P\023\005s\346\214S\224\335\263\367!+\277\377"
+	.ascii	"A\3165\355\243g~\375\313\2069\1775\275\325\356\222\231\264\364"
+	.ascii	">\270l)/\225\274c\361\334r\317g\212\355\n\215,\361\266~\027\347"
+	.ascii	"\245B\277\330\341H`Rl\350\315\354kB\361\241\354\003\360-\352"
+	.ascii	"\336\254\237\364\031\353]\f\263\"q3\332(t\256\2362\017\224\027"
+	.ascii	"\350\317\267\243\224\332W\336\255Xxj\263!\327\227\364KCZ\254"
+	.ascii	"\347\317\355\327\251\372\023\200\177*\242\237\021q8\034-\255"
+	.text
+	.section	.gnu.lto_.symtab.834b0621f35a55d3,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.834b0621f35a55d3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,392 @@
+	.file	"printf_serial.c"
+	.section	.gnu.lto_.profile.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"D\003;"
+	.string	"\005"
+	.string	"\254\277\363\246\017\002\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\226\266\306,\003\376\220\273\353\017\b\002\001\002\001\002"
+	.string	"\002"
+	.string	"\002\003\002\003\006\361\201\277\304\t"
+	.string	""
+	.string	"\003"
+	.ascii	"\270Hg\336\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\350#"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\002\001\001\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"D\005o\ti\003X"
+	.text
+	.section	.gnu.lto_.inline.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 \347\375\003"
+	.string	"2\306\024\037\220)\351\017\211\020\227\210BC\375WP\201\342\355\254\2554\035\273\273\213\232\374]7E\266\224)\237h\253x\376\232j\354\374\203eo\224\366;\024\204\341\250\004\020|L\026\021BaL\2359J\243$(Nfy\003\333\226\374\017\267\275\246(m\001\177\226\004\020"
+	.ascii	"Q3`\n\327\211i\340# \307s:!\240x\016~\231+\270\321\312\342S\305"
+	.ascii	"\370\271\007\250\305T-2\213p\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 \364\275\003"
+	.string	"\002F\022\034\260%\351\f\3400\005/\017\303J\205\212\034{I\222\005\226\024\027\254m\273I\"\223\f\253\013}9\004H\266\002\t\263\033m\017fO<\342*\2406\364\206\370\f<8\237\020\213<\367\342b\317\356ykY\006'x\256S\004\021"
+	.string	"\020\023\204\314bj\022\224\223\0308d\004f"
+	.ascii	"`0S\020\206\215\bs@\347\376\230\026L\005\360g\t\230i!\312\216"
+	.ascii	"\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\270\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 g%\002"
+	.string	"\244\002U"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\004"
+	.string	"\002\002\001\002\006\001"
+	.string	"\003\003\002\013"
+	.string	"\001\002\013\001"
+	.string	"\002\005"
+	.string	"\001\002\005\001"
+	.string	"\202\f\006\005.cO "
+	.string	"\n"
+	.ascii	"8\001\340\216W\331\322\f\356\346E\315\273\027c;s,6\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.2511c09696d586ff,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.22.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\265\007"
+	.string	"B\21766Pm\323\001$\203\310\312\352V\251\226#\242\201T\3218\250\204\2011J\227Bk\332<\277v\347o\013\347k\006U]\263\221b\257\257E\303\223:\031\265\337\233\354\235R[\245\f\001\276\254\007\fV3\233\006\207M\303\252fj4\313\35055\f\223\315\253n\246e`\252\311\324\271QZg\365\355\247\215\236%\007\351\023#\f\243\037r\221\216\237a\b\016|w\351s\250KK\243\303\342\003K\366\347\201\361\302\376\264\273\353\350\331\027\375p\252B\027\222]\212R\312\222\244\311Fe\373\320\276\307?\270\213:\037\330\365F%\273\037\202\023,\227\376~\241.-'\240.\315\331'\005\022\002\243\211\021\224\335\235\021\343\334!\347\037\344"
+	.string	"\035\310sXY\330]\303\016Tq\307\333>\260\255`;\024\t"
+	.ascii	"\3202P&\264\356\005&.\024\202!\227`\233\325\224p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_tfp_printf.23.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375`\337\001e\021"
+	.string	"\326 tG\360\262&\035P\341'T\025\355\367\261\273A_\315\272\205m\222V-\353\3403\247\236\324\252\320\264\201Fk#\332j\261\254\006\017R\315`\356\275\312t\272\304\233\235\315{\177\342\\)\375\3317\255\253\352\264\023D\366\2262\245a"
+	.string	"]"
+	.string	"`"
+	.ascii	"\0270\347\213\007\307\2340\005^\300]\032\306\375\305yT6\020\204"
+	.ascii	"VL\321\303\306\207\310\234\263;\271\311v\031O`\273\\\024^U=\312"
+	.ascii	"U\225/\033\022\272V\217\001X\340\\\306\221\326\215\n\022\027"
+	.ascii	"+\256\020\325~J\\-\335\317\216\342BH\350\302\271\216\264\314"
+	.ascii	"9\255\241K\304\275\3356\3116\213\255\f\002\255]\331\260\225n"
+	.ascii	"\216\375\025\035\242\232\367e?v\217\016\373\271M\035\245z\243"
+	.ascii	"ZW\375\222\317fV`6\347MQ\021\032!\371\263\342\261_\246\362{>"
+	.ascii	"3\211=\343>\252\313fZj<L\224 Z\b\007\334\345\r<f\2408i3\236\030"
+	.ascii	"\241\203'\345\322\r\270K\265\037\3432T\207u\b',\240\007i\230"
+	.ascii	"\340\342\262]\356\036H\213\3079\347\\\233(\205\n\264\241\032"
+	.ascii	"kW\036\240\017|p\373\325\265-\274\350\303\321\236\330\334\306"
+	.ascii	"o8\b\251T\332.u\001\3704^\303\344\357\370\202\247\017/}o\273"
+	.ascii	"\374\352\216\235\0220H\320h\221G\232\362\323>;!\370\020\332_"
+	.ascii	"\006}\350\203\320\031\252\005\244\r\2122\245R\036\310a$u\202"
+	.ascii	"Y\227T0\220<\320$\363\002\223By`L\207\372N\247\257\324\241<\322"
+	.ascii	"\251+\2012\235J\002\1771&\260K}\037\330\221\300\346\3675\332"
+	.ascii	"\363\020\242\331\032\317\3049M\260\\\366\327bZ\0247\307\377\316"
+	.ascii	"r\264\\r_\226\331\342\202=?XJ\344\003\272kG\220\240\017\343\006"
+	.ascii	"& \240\002\021\301\344\001\321\300\312\033\355mC!\245:\325`\273"
+	.ascii	"\313Z\234|\226\316\275Y\024\033\301\200\304\211\360\324p\025"
+	.ascii	"YgQ\fX\220\306\306\273\274J\353z\225=\031Kb\321IC\031w\n\312"
+	.ascii	"\301\322\303\212\250\357\024<X\370w'\035\324\304z\fS\332\204"
+	.ascii	"kZ\347\352O"
+	.text
+	.section	.gnu.lto__putc.24.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"m\t"
+	.string	"v\023C70\221\322\001\003\023\222\237\252\026\304Z\206:\306\371\"\204mS\301\232\256\313\260fI\b\243Af$\301\367\321\364`D0\260)\376\230\213\245\207\310\t\266\332o\233H\231R1"
+	.string	"4"
+	.string	"0"
+	.string	"\235G\207'\330<v>\260y\364g\303<\374X\007\031UJ\314\356f\352\361\357\371\3717\271\007\\\241\236\234\207\335u\202+\215[o\033\3016\203\375NN,}N"
+	.string	"KA\313n\306\213f]q%\304\366?\2665m\205\206\357\241\205u\227C\245\265\273 /<\355\217\234\344{\211_.\260\313\022i\355\206 '\004\007m\200\241(\373'G\251\360AL\341\345Ao\363\250\352\331\270\246\036\323+\204\213\252&\225/;D\245v\330\307vw\255,\373\341\217\305\264j\006\332M\267\026\232\020\221\272\221\027!q*\221:SV\342\266\215\323\262\022I\264eZ\347e\241\003s\246Q\227\2358\256\313>\341\036[e9\316\270Rza\200LU\2657.\003\013"
+	.ascii	"2\241\031h`\341Q\022&\242Kx_F%\327\330Wa\260\202\n=\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_printfSerialInit.25.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 \353}\006"
+	.string	"R\f.3`m\322\001"
+	.string	"VX\013(`V\310\345\033~\275\234?\310\221\377\233\025D\226\340\003W\315*\273y{,\352\203 \020\330\177\366lYM\351\327g\211\334)\005\235,\f\027\nb4\n\013\033\213\202\031g\275\252z\223\263\250K\345&\250q\226\202\276\f\006\272\315{\320U\262;=\225@\237Q\210\223\021\2454{48\004\374\034G\347\366\001\2429v"
+	.string	"\2041\nI$\326fX\313\214\326\322\3777=m\"|D%\004!\277\305\211\311G(\"\034m]\351\325\2228\333\270?(&@D\377]j\370r\273jwX v07\200\204\377m\261s\341\246\333\032\264=h[\021\007"
+	.ascii	"2\003\346j\006q\241\324e\220\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"]\005"
+	.string	"\002\310\035'\200k:\034\216*\003\320v"
+	.string	"\001#\321t\210\300\207\031@\2140\346\326\261\f\034\233u\0318\266\271\226Zt#r\313\024\3350\372\377jJ\364\0042\021C\t2\267A&v\200&f\355\262\303rda\211\302\031\266}\377\333,\224\360\004\021n\274\003D3<\244\013%\003\372\024\214=\356\033\202\257\227-v\257,\251\355t\216\343hZ\267\035\013F\377O\231\361\332b%\024"
+	.string	"K\215\202c\233fY\215\260Mh\236\031\006\250\007"
+	.string	"\007"
+	.string	"\007"
+	.ascii	"\007\037\360\005\026\f\317\036\020(\253\030\013a\221N|\273\""
+	.ascii	"\343U@h\016U\006"
+	.text
+	.section	.gnu.lto_.refs.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\002\001\001\001"
+	.string	"\003\003"
+	.string	"\004\002"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\006\002"
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2511c09696d586ff,"e",@progbits
+	.string	"(\265/\375`\363\021\255X"
+	.ascii	"\252\224(!S@\022&\r\007\366M\020i\354\356\277\ft\242\037\003"
+	.ascii	"U\372\375\254\246\365^\177lJf\237\303:2D\025\375\004\004\007"
+	.ascii	"\300\236 \205\335\035\321B\221\351\361\001\200\315\251'\346\315"
+	.ascii	"\325U\305\257\337Lp=7\262\357\235\035p\317\316\320\377T*\236"
+	.ascii	"%"
+	.string	"\261M\244L\001\307\001\372\001\003\002AK\267e\326\314\216k\331I G\023a\276\310\336\346\272\327\005|\026X\300F\310\rC~ \241\263\306\2065tV)o\325\302Soh\300\270\330\326V\224\006\265*IxX\267\265}z[iC\2700z^\246g\032l\333\306\323\303\022\234\2305li\226L\316\025\016&\2532;\346\350\263\251\263C\352\320\241JZ\372\345\222~\251\244\3375\355i\222\376\213\3663\2363\311\263\215\321\325a\315\366i\300~\331\035\237g<9k\262\322\246\030\375&I\277\006\364\266n\r\350}\203\244$\226G\372\265\221\376\205t\261l\331>\1776\207\257\225\275\362\233\344\332^7b\336z\2001z\244\364\373\323\343\331\237\336\205)\211\025\321C7D/\305\331\212\350-\025\024\0062\262!\214\376E\372}\356\224\177\263\326\311J\331)m4\033\254{\005\321\003\243\325_\214\376\033\366\225\362;"
+	.string	"\301\315\344t;\351\356\021<H\304\320~0\272]\213C\235\230\2272F\327k\241\354\363\304~}\243,\330y\310\265\327\356\225\207\215\374\200C\027\243=+\242\307.\322\357\211\336\256\256nO\364\036\367\266\3777\276,E\252\314\030\375r\035\201gC\360\021\351A\244\347\364\353\330\272\"z\351\206\350\375\233\202\361\275\237\215\377JP\374\210\3770\356\373\331\305\277.T\200q\364\357\t\304\341\277DF\377^p\300\013\3709x\364\347\022\376E\341_\340\277 \374\213\301\277\023\374\033\301\277+\376U\361\257\003\377\242\370\367\304\277\n\374\033\342\337\004\376E\340\337\021\377\342\374/\372\227\347_\002\376\025\361o"
+	.string	"\377\372\376\373\374\357\362\237WWWW\367\257\006?\213\371w\224\004\315c\367\312\354Q\202!\217\253\364\242b*\275\232L\020\235\354c{!\247\322d\223\251\364\322d\366(\275\220Le\222\212\t\342\252\211\204G\r*\344\227\345R&\373\306R\024r\331s\246\\\233=\246{\301\224zi\242;\252\271\034\203\334\261cIg7\222\246 \233;\300RRU\263\223g\312\253f\367U\222\214^Rq\\\317\232\310\236\035\177D\265\r\245n\002\226\272\217\333g\335}\354n\233e\324\332\375\324\243t.-u;\371,u\324\321\212R7\203\255\2151\225^U\315 +_^\316\216a=\256\263\307P-S\257#W\333\350\356}K\235\314&4M\037\2769*j\315R\002\370x\370\340\322\006\327#\212'+G\220#\253\223\033+t5\314"
+	.string	"\365\0247'\247\265c\237\374\364\263\023\363\270YNS"
+	.ascii	"\034\261&\035F\030]\237\r\321\013\n:\357\b\321[:\255\315\263"
+	.ascii	"O\350\270\262\350x\033\037\271\232l\231\201s\364\f\\\240\236"
+	.ascii	"\234\203\233P\246W\2311\306qn\322\251{\2329\303(3\337\206S\246"
+	.ascii	"\310S\026\243\217\343%\233\361\222C\025\243|\203\231\316K^j^"
+	.ascii	"\252hv#y\311\243\246\033\311\263[b\267\004zCU\222\260\036z>\223"
+	.ascii	"\376l\243F\n\207\345\t\3115X\206\035\023\247\244\204Q\246\201"
+	.ascii	"\214\252\213\001L\272\265\256\030S\027\021\267+[z8\307\264H9"
+	.ascii	"\311|\270i-\335\366\260s\273\325i\023\245\352\b\230\247\255\362"
+	.ascii	"\007\251\355ZX\232\r17\334\202\316\354[S\022\215\255'oSJ+\262"
+	.ascii	"\303f\331I\366t\262\212\207\363\201\177\307\270Dm\027\272\365"
+	.ascii	"\262h,\224\22675\322\240~Nn\035+\031\006V\342\030\366\207U\303"
+	.ascii	"I\273f}\340##7\r\367>\227n\341\276q+w\237\265;\331\335\337+\377"
+	.ascii	"\246\205\331,;\256e\032\245\313\311\255{\375:\371\003Oz0\312"
+	.ascii	"[8\007\016\231\231\fh\214\262\026\356\221&\245\304l9\323\260"
+	.ascii	"\263X\030\227\361\264\272\223R\254IcZ\351\364c#\007'$\f\226s"
+	.ascii	"\231O\311\344\253\t\031\017\212\225.rdWr\320`Xs\203\321+\\\205"
+	.ascii	"\255\370\334\230\352\230cc?\334\226\370H\317c\246<\345L\345\212"
+	.ascii	"\024\020*\032R\376\033\23301PNF\317K\246G\337\326\225\301\366"
+	.ascii	"\331L\013\204\207\216\2479\337\0301(C\272\316`\3745\246\243\210"
+	.ascii	"\030\243\374\305\f\205\243\234\277\330+'\271\362\027\332\215"
+	.ascii	"\334-\261\263[\202W\206\004\331\325C\217\266\245\217\343g\316"
+	.ascii	"zl3O\256\0334le\222;IPN!V\322g=\213\267|\232\2730J\035OX\335"
+	.ascii	"N?h\017hJ\264\316[i\230954\030e'|\204\215`\331\261d\347xUrlU"
+	.ascii	"\240`a\261\r\333\245\204\222\232c-&VL\217;\333`\206\007\346\312"
+	.ascii	"*\354\212\t\223\267\371\364\254\311\256/N_\023\031\306\202\f"
+	.ascii	"\271"
+	.string	"\272\342 ;e\0239\305\"\353\f\f\326\\\267\026\00669\006\205\213\321\243\355t2\ri\257k_t\234<T\355Pr\246\241\254\307\324eM\253\207\216\223$jfqD\210\260UO'\261iqk'\247\037\337\227\331\224+$g+\234 PG'Gn\316\344\344\300\216\334\310N\313\215.F\230F?I\301\262\205\213,\\\216\024\220'54!O\026\3025|\326\306A\202\330re\340\273\261\224\2014\3115A\2551\372]Xz\236b\252s\325\377*nJ\327fj\221\006Jj\256\235\226?\337M\245\347\277\327\310ew\343\340\255\275L\312\371\362v\177~\235\335\255\211\336Ap\326]C\023.]R\005\tE\242\217\325}\004\321k/\225^TG%\0240L\020kO\t\320^?Z\271R1\321fs\257\275\235\244b\252\240\\\233K\345\332<\366t2D\352PX<\372\251\302\241\320\247\026\201\252\021"
+	.string	"\2431($\004\354\225\0204\302\003&\360T\240Q\221HDB\030\003\370C2\266`\354A\001\250\376~:+\020\2132T\342\320\206\b\030,B\207\206\301\037\020\3517\024\252E\302\0311~\277\236\"\"\221\202\037\257\005\365\310\350\002Uhd\034\002\2130\214\302\002\202\252\260(\202O\025\01638\272\f\024\005\020\2513\210C\252\321\367;\"Rq^\250Ac\210\017z\210x7!\244\3168\372\361.$,\006\207A\024\322\253X\321\300\n\026,\330\234E\213\024-R\364\316\242EPP\213\025A\351W\004\355T\243\260\350\007D\262)\002e\b\241\352e\240"
+	.string	"2\026\203H\302\342\320\210\023\217\202E \225H,\002\371\212A!\221P\035\006\207\2048\306_N\bj\221\370\242'X\024\003\b\003\251\027\374\005\207\210\033\340\004\207\210Fh\360\327\201Z$\036\351\030\207D\241zD\264\t\252@\017\206f"
+	.ascii	"c\244A\027\204\037\244\352\217\205\215\232\026s\206\200A\f\324"
+	.ascii	"\237\003\017\024\t\2010\212A\"\242\031\024\260\240\346\024\325"
+	.ascii	"\027A$aP(\350\201\217\372[\021\244\016\2053\322\007\005U@\002"
+	.ascii	"\004\016\\\244B(\212\200\302b\320\370#R\207\302\342\021\320\220"
+	.ascii	"hdD\024\002\032\n\201F@BE#\020\212\0228@\025hA\nB\300\030EE\300"
+	.ascii	"\nX(\356\300\261\345x\255VQ\336\266v\342\244\232\004A\003\226"
+	.ascii	"\246)\313\221\206\207\2624Mj\311\016nh;\340\214\244\235\t\202"
+	.ascii	"\246\f\b"
+	.string	"\0163\2546\325D\207\003\243d~2\314\346\223\266V\027\031\2670\375DY\346\314\246\306\313\033\243\274\3666\034,(f2\307\026-9n\350\222v\016\223\306j\274\255\235\216/3.,\346\254\266\263\206\346\230\304h\222\255\037_\030\345\035\300\262da4\tV0XX=\266$\032\316.g\264\363Y\224%\232\223\031\177\371oVII\326\024W\312^X\007%2I\260xY'n\310x\264\3259\351\216X1\312\\\336\226\334\n\201o\250\2014\246\0305#\"\"\"\222$I:q\005\204 F!4\017\022`u5\315A\347\204F\222\0242\354o\260\001\337\224\275\331,\002\002\313\321\277\n\327\001\234\340\371|\032\327\032\212\224\350\231\354\261\271Un\331Jw\2543\353\370\273\264DL\t\314[\200uY&\033\244\t>\364x\363\252\1777\270M\020\201M\341\271\306\262\321\230"
+	.string	"\327\301\244:\2755\231\223\315\372)\367\257\222)\3244\343a\304\241\311\210S\324\f<\031\371\373\216\021\330\f-K\250\355\306\306\365\371hg\310\035X,\321e\342"
+	.string	"[\272\212\035\304k\242\356e\031\207ck\315\226?x\305s\241\200\313\201\020\342\276\0331\232h\256\222}\242)\026\026+]\362^\267L\006\024\351\265\266\201\360A|\207\306\362\023\264\213\361\031\003F\340eE\350S\354\306\243z\33669\354\030oxH\241\215j5\255c\377\244Q0\260f\3663\200,\276F*n\247:\352\236U\355BpZi\n\330\232\237QN\324#\331\021]\351n\003\275"
+	.string	"s\3064\022\245\213h\355\377\to>w9\2326\225W\336Dx\032}\177\211\311\"H\332\344\003S\221\335\021\fk=WH0\251\357\372\370p|\322\221\rG\252\217\212\276\300\005A\326\303\001\270\237\253t\204#Az\021\343\273\241\311\237\341\022^bBh\353\313!\272\300\326D\220\240P\r#uM\222\310\006\002t\267d\364\356h\344\272\037\303.O\372\222\303\025`3\020\023\201^\225Z\377\220\2467\r\032\221\"e\263\204z\310\201\242\212\245?D|\r\274\342\3413\377):-V@\320|\304\244\221\3138x\225d>\317\304R\302G\315\f\r\002\332\022v\236\354p\200\241"
+	.ascii	"\002\330\251\201m\354\200\276\273\240]MJ\244\356B0\031\020\221"
+	.ascii	"\0260\347`\352wo\001\266\243\022\"\0268\bj*\215\352\311\030\372"
+	.ascii	"t\231\277>\230\255\253o\005\257\217\322t8\264c\372\305$CG\215"
+	.ascii	"\031\375\200&dL\327o\244\324\f,\212\316\344\002T\204\210\232"
+	.ascii	"_z\006O\272}d\362\346Z\346*\360A\335\234\253\t\031\001\n\371"
+	.ascii	"\321\220\305\246~=\004z\353\034\016\325\025\2205U1\264\242\001"
+	.ascii	".?`\037\204\0352\020WBV\036\240\354\0314\027\031D9\247\232\217"
+	.ascii	"\025\334\037\204,>9H\276\013Ja\331i$N\243\374\362\241\003!Y%"
+	.ascii	"c\377\177\362\2079\362\241\243e\373\350{\320x\245\022\347,S\327"
+	.ascii	"\3553\363\035X\215\202\251\307f\243+\310 \305l\374\313\314r\026"
+	.ascii	"\266\356\271\303\216\005}?\314\211\260bw\201>\200f\310\005\037"
+	.ascii	"\\-\353\205\271T\001"
+	.text
+	.section	.gnu.lto_.symtab.2511c09696d586ff,"e",@progbits
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"stdout_putf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"stdout_putp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2511c09696d586ff,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
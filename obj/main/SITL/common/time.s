@@ -0,0 +1,1087 @@
+	.file	"time.c"
+	.section	.gnu.lto_.profile.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"m\t"
+	.string	"\204\r\354\001"
+	.string	"\033"
+	.string	"\232\324\333\212\f\020\002"
+	.string	"\002\001\002\003\001\243\214\302\266\b\002\255\263\333\322\001\024\001\003\373\373\217\353\007\016\002\002\001\004\315\203\200\366\013"
+	.string	"\005\320\272\212\332\002*\002\002\002\004\002"
+	.string	"\002\004\002\004\006\346\307\273\333\001\004\002\005\002\005\002\006\002\006\007\352\263\360\321\b\b\303\243\360\202\004"
+	.string	"\t\211\242\243\201\017\002\n\251\324\331\213\005\013\326\225\305\221\002"
+	.string	"\f\324\342\311\266\t\002\002\007\002\b\r\240\342\234\212\n\016\305\237\224\203\017\222\275\371\270\b\020\331\345\253\313\f\b\002\t\n\021\354\242\3530\002\022\221\335\225\216\r\023\266\200\366\276\b\004\024\211\307\225\365\002\024\025\364\235\311\257\t\026\302\366\337\302\f\b\005\027\331\321\262\325\013\030\355\314\246\334\007\031\362\372\330\324\n\032\240\342\234\212\n"
+	.string	"% P\002R\222\235\003H\t\033\030\240\253\f\203\2531,X\211A\026\240\260>\300\3540\376J~[7n\346\371[\211\206\316v\371\276~\350"
+	.string	"\234\013o\205 \t\013\030\270\262o"
+	.ascii	"Z\016\274\205\237\230\002\266\007(\r\b1\200\355~\t\206K\274\231"
+	.ascii	"47\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`B\001]\006"
+	.string	"\002\211\027\030\2207\351\272\273\273\333\373\177\001\261\021\021\022\"\244\326h7i[n\231\002?\342\347\341x'O\303\027\016\226\204>h\323)\005\001t<Z\254\205\0345\227x\233\002\024yz_\323\2174\205\250V\334\243\205<_|\244\260\3107N\327j_V\315I\254#MaE\305\272\n)\203'W\". `\202Br\351\001\023!\323\236 T\203\310\353\362\364\206\0241\230\203l\235\215T\017\3579\fa\225\005'i0\240\354\300\246\206\326\030\242\020\013\302\363pS\030G\033\201\005\317jW\204\367\356\220\rZ\205\314\203`O\356$\030\004\240"
+	.string	",\213]\254\357$"
+	.ascii	"Fc\257\016\243\203\021)o\333\3418\017\206\021\375\200\324\376"
+	.ascii	"\302\r\001"
+	.text
+	.section	.gnu.lto_.inline.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\t\007e\032"
+	.string	"\026\343qC\020\257&\035\227Tf\225m\3404za2\017\267\225\226\376Gb;T!\212\205&\037\330(\035\223\021\b\331\317x33[\372\037\001(TT\220\024@\027\241\020\002\030\034\255\304\216<\271u\333$hK)SU"
+	.string	"a"
+	.string	"_"
+	.string	"\336\347\324\2160\033Es\\`Z\006\254mL3\323\211\262\024\\`Z\004X\365zk\336(5\361\377c\315s>\351\352\177\206\225\333l\332\265n1Bh}~\326RZ\255'\265\354\324\376\377(\232\363\372\023G["
+	.ascii	"\207\254A\232\276\234\252\265\371\017b{\370\202\021~#\371\177"
+	.ascii	"\273\001\022\016^\244d\373\365#\234I\3749\222\bci/\030K\236i"
+	.ascii	"W\177\202\313\372\336o}&\232\326\377\b\376\263\330!\033\267\027"
+	.ascii	"\212\220\224\244!\2203\037)3Z\220\214\311\344"
+	.string	"\220\231\2528wRe9\323\002\031\367\223*+\313\r\271\241)\331\210D\2616T\305\035\316\224FX\235\005@\232(=\374\250\240-\223\272\305\0364\2645\217mRg\021\006\rM GG\324\276\350\300L\3500\3676\277\322\276Xq\263\302\362\346\323\323.\333!M;k2\244\007D\254\220\256$\211\025uE3\234'{\343\340\002\003\25742L\3522I\235I\235\332\006\231\024\265\240\250\251\351<\321\005\377c\316\253K\361?\363G:K\326E\207\235Ne\272\035\035\315\025jN\264\020A\321\351-\006\217\264Q\nBE\006\026\230\210\022/8\034\032b|\200 \202\035%M\216Mi\016\t\032\034\2175uhF\302\213\016\264O6\346A\b\017\232\332FA\003\013\230\343:\363F\272\374\3270(\263lw\377=\376h\330\336M\314c\325\002\200\277\250!=\247\324\b\211H\222$\031\016`\002!TE\346\001\022"
+	.string	"EE\nR\251HD\244 I\n\205\375\343\313\032\344\310\372\236O\325\201c \241e\007\230\257\300\352@\375\222\234S\202\220\305&.\355\204/\314\033`\315\301\222\226\334\363N\350\232}\327\313-\bd\377b\204\033o\376r\265\222\211\232\036R\301\230\265\334"
+	.string	"\221\354|V\353\004\025\310=\265Z\243\001\207|$\016U\211\221\001O\0241\203\243\312\257;\264\364'1\344\356\346\177\264;\315\340\002\375t\312U&\0076\206s\322\004\245\340$"
+	.string	"\264\326\205\220E\324\303,-U\223#\232N\206FL <\250\216\370RD\233X5\013kI\022\204.\363\t\212\001\332\235\244\211\260\0161i\377^{t\207$N)\314\304\262\0330\306\026\255'V>D\020\365)\301\250T\360\224\322Za"
+	.string	"\303Z!E\203\262\262\363Z!W\177\203\362:ob|\253\232\253q\316\213k\332!L\233\020*\365\030\266@\314"
+	.string	"\022\031\017\231\3547\205\007\266D\001[+\264\020e\264\262\305(\324&tV5\210Xm\243\243\374\3270i\250\302\340$\213\374H\374\270B\227bvP l\335\354/\203("
+	.ascii	"Lo\263\253~\323\241\r\216\365\324F\331\301?\246\364\231$\240"
+	.ascii	"\201+P-\032\233G\375\251mNS\250_\2654_ZD<\"V\020\001h\300\372"
+	.ascii	"\031\304P\256\376\346\305\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`w\003M\f"
+	.string	"6\32064P\245&\351\\vf\022QU]\001df\306\021+\036pK\302o\3469\274CJ\342\003\233%c\321\262zdk,\027\373\250\375\036\212\276\275i\322\b\221i\007\""
+	.string	")"
+	.string	"'"
+	.ascii	"\227eY\3268\342z\236m\027\336\256q\314\326\246\357\232\23756"
+	.ascii	"\320\274I\371\366\"{\274\240\005bS\bw\314\214\350SM\270\tx\021"
+	.ascii	"?\366^\316q\317q\035=\032\321\347\006\226PiNR{\200\377\006"
+	.string	"\235\255\024\227\345\001\340\243\"XPW\013bE\322\224\344fr\224\037\b\004\034nt\227\272\364\2358\311I&MK\204\256\311\336a\336\341z\310\203\004\310\260\200\032\216LEmP\035\211\212\302h.2\025\005\321\231\250(\f6\221\333\257[\207\320\032R\336{\017\202\306pm\323\001~\361\340\006\001J\250\361L\247\314\224H(Q\2061\200\")\302\352\022\200ri\206\200\007A\246\224\300\233\211*,\377.l\0038\225\027\350\307\373B\253\213\343&\b\016\233\320\235p\213\223\177\326\320\305\271\225\317uw\356\372\226\325bj\032&\223\213U\0035>\263x8\203J,?\341\017\345\347\323\343\3330\345\205\026\266sLx \365`\311\026=xS\334g\235\021\341\273]H\272\315G<\216P3\213#\277~\2523y\251B\326e'\217a\nozP\351[\n\246\033\240\270\206\217v\213\366d\313\207\225\232o\224\203\006"
+	.ascii	"Z\363\340\325Z\227Y\006"
+	.text
+	.section	.gnu.lto_.pureconst.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375 D\355\001"
+	.string	"BD\016\027\200U\351>\347\036F&dB\225\201\371Z\260h[\367\335\265\246\371\035W\232\321T\027z=\3239\320\\f.S\231\311D\276\3433\006\024\227x\r\363O\270\301g\312\314\246"
+	.text
+	.section	.gnu.lto_.ipa_modref.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`9\001\r\007"
+	.string	"\022\211\036)\200\265I\007`D\002D\344\036\274\335HVDk,\036\203Y\201\021\306\003\307\240\324\314\336\376?=\032\032~[\333F\266L\001/}\224\200\254\"\016\033pF\333=j\313\307\225eb\f,\020&\354\022v\200W\006\320\030\035\301\007\376<\357\203\375\321\272\224\t\330:Q\250-\035\020h\301\\R5O\311\272\247I\261D\020\377\274\277\367\035w\260j\336\275\217G\330?\311\016\215\213+ @BC\025z"
+	.string	"\fd\005h\f3v\207p\201\325uj\322D\204\374i\230Hf\200\271\215r\"G\021\227"
+	.string	"\033\372\f\360\331z\n\034@\304\"\365\026\022\006^3\037Z"
+	.ascii	"A~8\r\206\223\006\242>f\\\204R\3120\303\337+t$K\244\251\306("
+	.ascii	"\002\250\224\20071\202 \340\rX\255\241\272\236\346\206"
+	.text
+	.section	.gnu.lto_.lto.dba9085fceb63cd0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_days.12.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`|\001\305\013"
+	.string	"\206SD<\020%9k\360\3140\202<\001\371\352\336\306)\343\224q\366$9E\020\371\367}\263\221 %\250\214j\200w\316\373\002@\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200,"
+	.string	"\304\325)\320"
+	.string	"\025\200Sk+\2737\3556"
+	.string	"2"
+	.string	"4"
+	.ascii	"\243^\027\231}\344\366\324\270j\2440l\341\201\341\340+B\211f"
+	.ascii	"]\203w\361\235\367\005\036\002\b\035V,\232\002\016[\213\002?"
+	.ascii	"\213\207"
+	.string	"\340w\200\264\b~\2719\256C\b\253\317O\310Y\243\243\234\236\262\272\312\353\255\331Wnw\215\263\\\327\r\"m\254@\233DF*D\203(m\272\274cs\217\317?\310O\243\203\234\036\262\032\032\235\312\345\362\327\346\260\317c\344/\243\303\234\036\263\272\314\353\262\331g\267\317\214\323t5/\302+y(O\3669|\030\337\351\213}\001\256\305-K.7\331<\334$\263\267\334^3\3563J(\260\271\234\266\371\315\3475r\234\321sN\327Y\335\366\372\316\354\267\333y\306{8\002\003\316\305\001M1\307\254o\335D\027< `\023Qs\363IQ(\262\022m\207\024\346Zk\245]\333Zi\327\264&\332\f}[k\244]\323Zi\327\264&\315\265\255\21168t\303\266\326b9n\230\333\206\030w\030nS\f9v.\002\373\240\337P\260#\367\016{e\316e\035\001v\343\260{\337C\333\001\273\256\252\f\211a"
+	.ascii	"\370#\261i\250E"
+	.text
+	.section	.gnu.lto_timeConfig_Registry.16.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\277\217\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\325\006us\356\005uq"
+	.string	"\005\001\006'\001\002\216\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/common/time.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_timeConfig.18.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_dateTimeToRtcTime.19.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\353\004\265\035"
+	.string	"Fy\303H\220VN:\205O'\017\001\376\222\336\264\fb\373;s\237\253\002\257\243\231\364\246+Xo\342"
+	.string	"2\376\375\347^\264\363\320\364Q\267\216\030\300\020\334$K\217\363&\270F\320D\273\177\224\372g\252\377\377k5!\233\020\271S\n\254"
+	.string	"\233"
+	.string	"\265"
+	.ascii	"_?\330\037\366\217\235\264\357\003\271\231\2353\210\227y\261"
+	.ascii	"\306r \354\334\307\333K\276\326\271\356u\037\377q\261\22397V"
+	.ascii	"BB\230\t\b`*\034|I1\350\332\361<\271\324\247\027+n$\330\332\201"
+	.ascii	"i\261`\253uh`x\254\245g)\225#N\224^/Z\260\325Z\t|4\201\362#\217"
+	.ascii	"\370\030:\347\257D\374\245V\030je\265\016\013xW~\264\355\367"
+	.ascii	"\270\325\222\231t\303\031)pZ$\204\\Oj\255<\017?C?\226\217\241"
+	.ascii	"\037W\306\231>\231\374\223]\344!\305$\n\305\210O\262A\255\325"
+	.ascii	"3\nE\212{o\033\310\266\005{4\n5>\372\"\350\307/\t\304\253\352"
+	.ascii	"\252i\276\331C\247\2711\354\213ua\330\344\264\020nz\207\233\016"
+	.ascii	"\302M\003\341\246\177R\246\005<\353\366\371\326\335\363\256;"
+	.ascii	"\300\277n\236\203\335;\017\273u>v\347\374\352\307!\247o\312i"
+	.ascii	"\233rZWN\327\224\3234\345\364L9-SN\307\224\3230\345\364K9\355"
+	.ascii	"BN\267\224\323,\345\364\n\235V\241\3239r\032G\247S\350t9N\223"
+	.ascii	"t\232\322\351q\234\026\307\351\035\247\3478\375\001\324*\211"
+	.ascii	"\216I\255&\336\240T$\243\231\215g\375[\177\327\037\373\2620k"
+	.ascii	"\343\262,\373\262\024\rj\252e]\366B7\253\253Ix\227m\246\035O"
+	.ascii	"\233\260`F\255O\b\320\256\204\202h\341\002}\324\005\372\261e"
+	.ascii	"O\366\227.\032fB+`I\267\007Q\334\n\255\247PEN\307wteY\250\234"
+	.ascii	"zve\177B*\r\312Me{<\334\270\317hnUV<\303m\016\303\217d\300-\211"
+	.ascii	"C\254-"
+	.string	"e\003\224\233\262\"\032\271\345^\303\215\220Kb\211U\321\345\031\372\270tE.\250)\247\371fq\307\375\206\023\021\227t\021\326\266\273C\364!\273$\216\260\252\271:E\0272\333\2769;\317\204n\356\375\214CYk=\340\007y\340+\003F\300`Q\357\003\355!%\001}?z\224\024\354 *\021\031m\007$`\3607\036\021\365\224\304\336\317W!\204\017\230T\"\031M\027\r\365~>$\0360\370\373\005\213x@\037\321\217Wt\364\2017d\343\240\207\336\021\017)\030<\342\345\206M\267w%[\216\2626\266\246ur\320\002\355n\0175u\263A+\256\t\335\232\324\356\"\364g\201v\233@Q\371\354\317\336\354>fN\264\322\274\"|-\303\315\246`\215\265]\331\254\317~M\250\245CX\277\243\272\265\331\235\265\234\255Y\335\352,9\315\326lN\024\235\235Y\232\305YS\360\035\225\331\231\305\341\332\331\230\225Y"
+	.string	"\\\272\357(\314\306\354\215\021(*\236T\250A4#\215a\214\021\222!\005-ha9"
+	.string	"#\031\252u\021`-tl\204R\305\035\022\031|\214\273\322\232\002'\323;B\223C\0360\231\214\254\301<\003\260:M\306U\345\373\220\203.\\\304y;.2!'0\216\2643\351V\312\256k\324e\202\302\251\215\017\025Bm\264\322\320\362\262\307\226\343\344\337\346jiA\256\220\303\247\330"
+	.ascii	"xy\362\330\277\345,\347C\230\3071\327\257#\351\316\307r\0279"
+	.ascii	"#\322\006\323`\361\264\335\276\266\333\327v\373\332\372]\337"
+	.ascii	"\344Q\307\t\366&\247H\340\005O!\374\251\232\350\363\007"
+	.text
+	.section	.gnu.lto_rtcTimeToDateTime.20.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`z\0065&"
+	.string	"*F\f\017G\220XN:\205\324\036\210\351(F\"\367\334`X\314?\221\3229\356\\N+/\260\245 q\310\262\272\255\264?7\3205\223F\177e\310de$\002\020U3\003\f\253\rMw\202*l\372<:\314ZB\b!i'\031\341"
+	.string	"\316"
+	.string	"\336"
+	.string	"\273\266\230\307L\266\272(.\306|\fQSk\235"
+	.ascii	"eW\004\344\251@\037L\272\"\370\211\301~\016\333\2351\256N)`S"
+	.ascii	"\324\324:L2\271\fN\223E#\035\276p\253Rke\260I\246\273^b&?7\201"
+	.ascii	"\341\236Z\177l\251R\353\220\301\356N\223;\364Oi\362\264Oi\362"
+	.ascii	"\267\233\306C\256j\372\340\242\022sSk\345=\210N\207\333{\034"
+	.ascii	"z\313\377\234\303\235fI\216\247"
+	.string	"\2775\325*Va\305pn$\207\030\361r\230+\341H\341\254\314\214\212\342\200\330\320\341\323a\256r\330\310\225\220\232#O\255U\007\0138:\240VXS\264\314y\3410\211\240\207\r\035\036\307%&H\204\350`\311\030\377d\fM\207\005\2447\231\221\262\332\252\260p\230\232\025j\255K\253\260lxu\336]\264\335\255\260[v\b\265V\tk*\277\257\336\311\0201\271\206Q\232t\025\333x\362\264l\311{V\026}|\013\241\227 \361/\272\325r\226Hq\253fQ\322\377\016\362\360\351\3072\2527)Z\\\223\214_\224D\367}B\264\340\327\024-\356\016c\320o\205)\351\242\261\377\261\373@)\t\351hg\244\300M\354\004\216\342-\362\320&r\230w\310P\274B'\335\003#]\003&\335 \223.\220I\267\300I\227\200Iw\200I\367\307\244+\340\244\353s\322\rp\322\3559\351\362\224twN\272:%]"
+	.string	"'\335\234\222\256\256\244\2333\351\342J\272\247I\327,\351\226&]\262\244;\222tO\322\245#]C0\233\200\t2\253\265F\021N\375B\022\2138\314\206bG\361\003J\302\314\332\234;:\337\261\3400?.\203\371\242s\234WZ\222\237\021A\343f~kqCH\244\377\r\275\325r\261\320=\006\314\f\220\276\361\231\031hj\271S,\026\213\336\225BG\272\311L\336\310j\243\006R\246\204\rY\256w\345\216\027z\322\255\326\343\267\366\350"
+	.string	"\036\005\326\005H\337l\316\001\334ToR\273J\336\002b\301\356^\260\026\021Cdj\005N\300\342,$\306\022L\245\253\230J\2239\307yyq#J\271\013\210\225\372o\235y\367\243/e\345\256{\331%hDwd\367\334\215#\013-\370E\264\321w_\312\032\303}\267\311W\316\343\3568\005\214~\336',\006\211SF_\022\266\231\337=a+\345\315S\005/\337B\270\026$Nq\321\025|I\230\026\374\"\277\353d\263\024gM=\247\r-\234\236X\234Q%\232\\\214(|OP=\322g\237\t\272L\r\232zN>\336\023T\257\007\305\304{r*\321\3431E\255\3405"
+	.ascii	"Z(\025MQ<\037\024T\024O7\254\306\231\213w4\207\376\340V\030\234"
+	.ascii	"|\221\372\324\036\370n\006\257\371`\340\007N\305\250\336\244"
+	.ascii	"\230\350\006\356A\253-H\f\372\256\006\257\251\245\031\350A'\305"
+	.ascii	"\004yL}\300\201\356`\027\201\027\370\305~;\254\006\302\210\013"
+	.ascii	"\215\b\"\2563\004n$\204x\364\001W\241\265\366\363]\016.\223\""
+	.ascii	"N\025\233S\224\002\376\363\340\002>B+\215\352\315\347\273\035"
+	.ascii	"<\346C\233*\266\235*\376P\006\270\317\257\326s\236\007Hz\217"
+	.ascii	"\356<\017\241\345\205\352-\367\2555\231\217\314\234J\337q\324"
+	.ascii	"yW\016\r\335l\366Xk\255\270ou\361\320\225\356\035;\326\036w\250"
+	.ascii	"Q \243\220b\212!D#2\332$i\rp\002\031*+z\021\220\255DeS\320\032"
+	.ascii	"\2056\003@\320\031\240\004L\265qtf\367\212\206j\200j\226yB\275"
+	.ascii	"D\204\267\340\374z\240\013\226=\210\213\314\rp\260\306\273dx"
+	.ascii	"r\r\035\374e\375\341|\376\366+\253\205\312\266UR\f\023a\312-"
+	.ascii	"\302\350\304b,\016H\215\364J\037\237\262&'n\334\035\3452S\362"
+	.ascii	"\221\242\302\203\024\201d\210\367\230[\35765\3645KX\254$\251"
+	.ascii	"\326\336\307Rt\037v\003\272U_g\252\354\321z\215R\020\230i\222"
+	.ascii	"\032F\350\233\346\245R`|\025\f\246\0269\274)\235\272\026\034"
+	.ascii	"@B\264\"\t\211\022\204\357\b\267\243\210W\021HB[\315\r\354\236"
+	.ascii	"\n\027R\313\n\032L\335[\312A\3420\300}8\007\0030&k\t\220\024"
+	.ascii	"_\300\334|\017\030\325\205\352\353j\317\024\200rh\r\002}y\312"
+	.ascii	"5\035\304\225v\352\376\007"
+	.text
+	.section	.gnu.lto_rtcIsDateTimeValid.22.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\340\002\205\022"
+	.string	"\206bvE\360\262&\035\002-2\360\031\252\034\237\317\256\205a\274S+(\305\260m\365th{\307RL\332\305\344\324\277\202\232Z\210\fV\314\344{}\262\206\025n\321\333;\217\222\236/w|\227\250Do\226\020\262\367\2262\245c"
+	.string	"Z"
+	.string	"d"
+	.string	"\333\241a7\020\017\267\027\210\207\266\035A\302\212Y\016\273Yi\252 \230\030\217]\330Hm\316\362\020\267i\021>M\026_\033\201\"nl\304\260R\017- ASs\256&7\0243 R\203\311\370\222\360C>\021\313%5\307L\210\027\262\273_\361\224a\2512\265\221\335u\306\260hn\321m\307lC\260\323F\031P\266\023\207\276J<\274\302\030\263\034\235\226\234\331\260T\352\313\376\333\335\265\272\fr\235\037"
+	.string	"L\2074\315\275\364\366\322\332K\307\227\206/\375^Z_:5\375"
+	.string	"\241\032\034\nv\354\256fA{\003\312pl\257\330\"\333\231\366S\\\305\312uTN`\327E\303g\027\366\300\f\002-\233\322{4\205\262XN\324\227\017\274\213Q;\264J\354\374h8\214\bd\330\356\302\004\357\"T\017\253\031\317\237B}1\323_<\2052\027\177\372\262\350]T\265\260\362\261\363\363\331\273\230\252\372f\274\214Py\303c]\002\345\356\246T_\026\320sT\274\222\264pvj\270d\017\333\247\267@m\273;\301g\021\245\316t\241\224R\202a3I\244\324\231RF&\247\256;\221F&\246\222nD:A\031\211 \360\211C\351d\224r:\235\214D\260\275\272\234\\\203\347\346\340!\225\261\r\242!-\252rHA\3640?Zr\006C\372\272\006\355\2468ui:\216\212\\\311e\2408\2052\036\335|\276)I\313\004\351\262\rh\300\356j\024\336EM+\0045 "
+	.ascii	"\003\021\021\353\006\314\b\230\320\307K\240\210\340w%\333\202"
+	.ascii	"\b\3025\315\006\\\213\244\3457Z[\3402\336\2317\260\345-\313\""
+	.ascii	"\341\224`\215\265\344\f\247@\333\007'e\270Ky>\325\314%\3065\351"
+	.ascii	"\227\205\230\203\321XL\301\264\364\350L+\232Z\\$^\353\017\215"
+	.ascii	"1*D\034F\243`\210\035\214\243iC\271\3471\352t\310\200\214\200"
+	.ascii	"\f;R\217\030,\003"
+	.text
+	.section	.gnu.lto_dateTimeWithOffset.23.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\310\001-\021"
+	.string	"\206\"vF"
+	.string	"\317&\035\333qUuE\032\264\325\305N\376\202\347k\203\340\241M0\036\026T\354[\313\234\216Pfl\033u\006`z\207f\013\254\307\275\313-\331^A]4\n\362!c\325&\2167m\027\247=\332&\322\244L)`"
+	.string	"Y"
+	.string	"c"
+	.string	"\255\347LH\324\262\274@"
+	.string	"\355.\210\023\214\276\241\362\035\\\250\""
+	.string	"\265,2\030\221\247\375\016\367\320:\216\3129ve\204\200vC\020\023\030}s\370"
+	.ascii	"\334\267\321;\270on\331)\036\322l\234qi\231\271\330\335N/\274"
+	.ascii	"\365l\371\237=#\366\262\362\214\bv\327\031{\251p\353m\177\330"
+	.ascii	"n`'\203\216iTL\2374m\212\351\215\230\3268\316Oz\316\237\021\323"
+	.ascii	"\243\230\216\017\177"
+	.string	"N\323\"M\253\2463\246\317A\272\031Q@g\327\245\006c\207\266\240\032\333\367}\376\263:\315\036+\236\367\240\234f\0034(vI\347;)\247Y\304\345s\263\273\245ov\212]\372\246%\333\372\341\262,`6\"\035\351\177\376\021\324BfRU\221j\tX\314\201[\004\227\252z\230M\206\246~v\221\006\013>/\023:\033j\322\267\304pe\315\007\372uC\337\363\254!\001\343\020O\374\343\256'\375\316?V\344\310L\320\202^Y3)9\265AU>v\365\340\3110\304\242+v\370J\235\261/\332\335\265\3128+\217\205\222\372\300\030\201\344c})\005'\226\26721q\340\201\337\210\307\"y`rI\210\007~\254.\245\002AUI\227\372H\300\256\344d\325\205\f\260J\202w\322\261T\252\223\256\024\272.Z\225\361\202\rC.}\331\224\032JR\333\203\220\217\371\263\217\204\300\360B\005\005]1J\243j"
+	.string	"@\001\213\321Z\355\244(u\266\300X\210\033iT\r\036"
+	.ascii	"\006\b\312\f\375D\004>.\336UA\220\212Q\023\270\215\323\017e="
+	.ascii	"U\211fZB\225)]z\\\347\322\244\013F`\025\024\006\322\001e\241"
+	.ascii	"P\312q\2101h\264?N\223\204\r%\264\031\034\006\303\002Thp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_dateTimeFormat.24.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\306\b%/"
+	.string	"\312V\350\022E`\236N\007s\2049\006\354b\313\344\265\352\342AM+OCq\220-\024\024\f/2\374\035\021W\022a\237R\232\033P\004\3069\374\201)\342p\240\212\267H20\322\355\020\307\262\305T\255\265\335m\313\235RJ\001\034\001\375"
+	.ascii	" \0014\346\254\311\261`\026\266}\346/n)m\245\355\372\311\302"
+	.ascii	"\273\306\373j\247Q\275w\030\306\332\370\356=Kq\027\354\240\264"
+	.ascii	"\356\347\2121\335\206\334{I\364\224\246\362\325UX/I\254\271\344"
+	.ascii	"\226E.\356\336[\245\266MB\243 \223\222\315k6t\373\"\227\240-"
+	.ascii	"sP\255\367\023d7\217p4\345\262L\260t\315\344\253\233\264\360"
+	.ascii	"\237+\026\026\343\356\336\033\305\r\324\266?\376M\2572P\356\314"
+	.ascii	"-\327I\276z\356E\003\335\313&\345\356\336f\0247\251m\271\331"
+	.ascii	"Bi[\265\203\322\266\314\314\303\006_\214\354f\233\031plm\351"
+	.ascii	"\304\357\336\346\324\377hd\013\203\253\nL-\372\216\344\006J@"
+	.ascii	"\343\202`!CK\2660\250\324#"
+	.string	"\355F\257h\321\332\226\031\275wf\003e\002\343\303L\0279\273\341*PB\2174\034\r\354\275\263\032KO\325\332\n\321\224h\322\275W\006\332\230\2433\372\321'>\274\276\03641T\310,\bY?\333\313\320\302\334\201\022\356\275\354dhi\315;\315\314Mf\236cV!\004O/\225\214\231x\302\233\214\223\224\237d\247\377/\362\206\245\351\243\\\207\033\377\246gW\306\001\323\322N\357\337X\272B\337\233\235\322\331\017\365\256\267\254\003\346\177\f\241\211\276g\274AQ\"\t\363\277n\213\303w\367\317\344\026\251\323\367\22270l\302\224\021\3638\314\3150\177&s\243\367\331\230{\256{h\235\025\364\223n*\353\034\005\325\315\356\247n\322\355$tn\262\316\007:J\263\201\256\322\274\324u\315JI\335lF\262\316GAg#\353\\`u&`\235\213Vg\"\353<`u\036\262\316\002Vg!\353\034`u\016\262\316"
+	.ascii	"\202\316@\326\371'\350\354c\235{Vg\036\353\274\263:\013\255s"
+	.ascii	"pu^\255\263\272:\003\255s\272:[vF\255\363\253\316\256:7\204!"
+	.ascii	"\270\265\034\314\035?\246y\315\376\346\334/\326)\244\243tW\351"
+	.ascii	"\256\353v6\312\334\334y\255\327W\230\205\314\242\363\230(;\337"
+	.ascii	"\363?r&\030\265\335\253l2\n\252\222\005\202\266\303g\266p\301"
+	.ascii	"/\216O\262\317\377\210h?+\237\267<\337\003\242\373x~u\n\177\307"
+	.ascii	"C\267\021>\317\336\230#\353\007;\364\232\365\255\023\370\352"
+	.ascii	"\206\346\003\376\2727\006\316\234\375\364\207pi\226uXC\243\251"
+	.ascii	"R\271\317 \347\214*\\[n\257\264\255}/5\271\265$s`\300grpL\312"
+	.ascii	"\322\316v\227N\231pK;\264\033\231\032\260Pj<\326\344P\244O\372"
+	.ascii	"2\356\322T\337\317\006Zb$\231>\023L\206~Z\201\231\343\247A\315"
+	.ascii	"\0341\033\324\274\361\253\352\200\367&.L\367\025\366@\244\317"
+	.ascii	"\257\273\nD?\253,^_\\\033n\253\264\257\260\210~Z\365\220\271"
+	.ascii	"\367:\350+\335fpk9\332\200\371\2757i\237\311\302\261#K\273\217"
+	.ascii	"\372\224\371\266\364eA'qK\273\207\372\224\351\266\264\363\004"
+	.ascii	"\255\364e\375l&\267\347~zY:.~\250?=\322\227!S\364I0\001r\244"
+	.ascii	"g\036q\345M\206>\017\031\235/b\237D{\374\377\351;\257\003\\b"
+	.ascii	"H\305\364\240\304\220\212\t\213\251k\001\025\223\324\007)~\220"
+	.ascii	"4\244b\212\352b@\305t\244\342\n\253\250\302\032\271\272\212("
+	.ascii	"F\2708\252Z#\\\034\203*\256B\034\211\\\351V1\313\310E\fq\344"
+	.ascii	"*\2420\356\030\211\307\256\255,\rG\242\321\204\211\"\017Q+\353"
+	.ascii	"\003\361xUB5\321E\342\031K\212\250\225u\234\332*ji\025\261\246"
+	.ascii	"\266\262\256\264\246\260\270\214SRD\\\\A\344\232:\026\213\\S"
+	.ascii	"\302&X\243\367\331\f|O\231\336\027\260\017c#zo\217\b\355\354"
+	.ascii	"\346\243\363?\3413\331\327\250\277\241&h\326K\017|\331\322+\370"
+	.ascii	"\003\017\340\003\274\200\037\360E_\340\217\276\363<\0062\tR\211"
+	.ascii	"\252\354\263\035\237d\243?\022\3410\254\214\336\022\370\002 "
+	.ascii	"|I\340W'\321\027y\3601\242\347\331C\003g\350\007t\360\260\241"
+	.ascii	"\267N\241\027\260\301\223B\277\356\005}\200\277\240\367IKsd\016"
+	.ascii	"\350\001\374\020\310"
+	.string	"\230\fM\007\350\027\320\245A\203\317\364\030\316.u\353\263\261\r56L\274(\275\202\357,m!\016\310\237\322\017\314\377\034\313\230\031\021\025\311\323W?\370\001\200\224\250A,\3031\204\320\214\210H \"#J\241\003\300\242\231\"\352\006\021`)dfJLR\324\001\230\2028u\353\th\276&\222\222m\271\025\305\335\326\353^\233\225b\3713\334\277\257\366^gI\312\270\245\"\023H\001\350\3600\"\246\250F\341\326\266F\252=\350\271\235A\323\002\3350W\276\245\377\333m\333\276F\r\213\353\f\330\375O\336\337\233\356\366\246\b\222\244\\h\021IRA\264=\031%I\241!\005\304\2533\006\216\360\032\034\017\362r\270p\241\2057\345/\352\004x(\f\350s\334avWa\355i@\037\302\003E\246\016a'm\271Os\310\200\365\244\355\024\325\260\020d\214z\212\001\301CA6.D\270~6\201\356\227>\267\315"
+	.ascii	"\246\211tqHKO\356\226\2334{\021G\205\320+u\336\225\340\376\353"
+	.ascii	"9\235!\026\251u\351/142\217\201\262\276<r\346\301\222kI\305\205"
+	.ascii	"2\210Zk\210\b/$\004\020\n\212\371=\310R\340U5\215\016v \001)"
+	.ascii	"C\207\314\353Ac\001\246\225K\204S\036\370\007"
+	.text
+	.section	.gnu.lto_rtcTimeMake.25.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\345\t"
+	.string	"\326\023F=P\207(\035\003\325\264\212U\220\032\0038\235\3756\206t\004\030\200Z\024\002\024l\320wj\036\325\276F\221\323~\006\371yn\334\314\314d\342\031\223\023\241]\001\f\214\274\002\371{\023)S\n5"
+	.string	"5"
+	.string	"1"
+	.string	""
+	.string	"\036\2403\247\301\003!E\005\251\320\351\301\356^\366\316\020\017\255/\304C\3758\347\311\361\177:\314\b\371D\243\316S2\261\273N\321\210t\353mC\330\226\260\377\020\213\361AX\004\260\200\210\355\316\236\330\256\006\234@w\223\205\341\356\306\001\324\256Wq\305:T\310L\373\002^\352\356]8a\227\243\204\332\335\212#\254CJe\333\017\267\201xM\325\006\240\221O~\256\364\372T(\202'?\333\353\244z\330\257vw\255\035\266\323\361\246\037\336\373+\230V\230N\230\2765a\220\300\342`\003\\\206\301dZ\344\260\013W\031\263\\\264lse6M\333\260+\223Qh\027\246\341.\213\203\267\212\213\346\332l\233\346\232x{G\245x\364c\325\324\250\007i@U\255$\013\002\r"
+	.string	"2\003\302\260\\8"
+	.ascii	"\354KP\231\264k6\313D\004\004\006W\304\3248\270\373\244Z1\t\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_rtcTimeGetSeconds.26.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"}\b"
+	.string	"v\220:5P\215\322\001\207\002\351f\214"
+	.string	"*\211\204\346]w8D\303mQ\256\301J\347\267\365\365\\\355\033\2223\265\212\230\231E\306\324\362\021\237\374\022\372$i{\023)S\n*"
+	.string	"+"
+	.string	"*"
+	.string	"\244\r\222\335\205\225\013\274\273\353\001\357N%\016z\202\374g\374R\245FJ\246\320\223\202\260\273\316\222\t\342\326\333&\260m`{\025\255\222\005q\036)\333\037;\263\235i_u\214\317\243\347"
+	.string	"\273'\216\216\335x\340\002\354\316\021\263\355[\374\342c\320\025'L\017\305\n\2517i\250\030]\203\241\203Q\370\236ww\275\210C\204([v\f\245\242\354_\253'\273\307\377\322tj\372/c\205\300\217\335\207\234\373b\301h\031\016\324l\232\266]\240&\223\240\301\313f\001Z\006\274)`6\220\263m\033\230\305\275\235VD:r\252\323\223N(\253w\3365\r"
+	.ascii	"2\003\302\260\\\270\372)S>\246\345\236e\256\341$\023XQ\343u`"
+	.ascii	"\342\301]#\325\212I\230d"
+	.text
+	.section	.gnu.lto_rtcTimeGetMillis.27.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\225\b"
+	.string	"\266\320;6@\217\322\001\323\036O\233\033\377\242\311\007\350F\300 D\027\370\316\300\360D\f\337\352u\272\326? \365m\303\024Eq=\272\032R\260\036<\2123n\177o\"eJ\001+"
+	.string	","
+	.string	"+"
+	.string	"\033\252\245\262\033a\300\t\336]~\340\335i\306IO\222\377\220c\254\216\222\224\252\364\2740\354\2563\245\252\270\365\266\017l'\330~\005;\261\255\354\211sq\330\036\331\031\333\231\366Y\007\031=\212.\260\273\"1\331\215\nF\300\3349bl\373\036\377\030\231\224Q\203\342\265\002\357\232z\226\b\327\351\"\020!\314\206/zw\327\247H\\\230r\263c)\025\303>\266\272\262{\3741M\247\246\377"
+	.string	",P\026F6\240{\243\341d\035\020\364hY\246m\240\247\323\220\301\315\347\001j\n\2549p>\020\244i\037\230\211{;50\351\311\251N\217j1\345\346\313\353\241\f"
+	.ascii	"2\003\302\260p\341\210\217=\271g\257k\"\311DS\324 \035\230 \340"
+	.ascii	"\204\221j\305$L2"
+	.text
+	.section	.gnu.lto_dateTimeFormatUTC.28.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"%\b"
+	.string	"V\220:6@\217\322\001Xp\006\354\311,Lc\034c\241h!\357 \271D\033J\256\306\352#Os\0025\310\226\335\202\036\206\341\261\272\2012\360\234\256\364y|\367#;J\231R,"
+	.string	")"
+	.string	"*"
+	.string	"\f\235A\217\035\245\2434F\"\253\335\b\025u\320\023\344\037\344\006!#\"\025\022S\350\031\340\260\273N\222i\343\326\333>\260}\331>\t\036\266o\273\2633\2665^\240$d\332\377x\252\273\n\343\002\273\247T\311nT0\002\346\317\361\004\326\037\346\003\326\237m/\004\232j\177,\362\244\247\232\221\206\354\030J\345\260\017\260\273k=\331N\277\307_\257\372\323\242`Y\2654\254\354\226^\\6\345\231\004\\DJ| \324\330\305\311:\034\364hY\246a\320\323y\310 \266U\300\253\300\332\004g\203\234\246m0\023\367~\252\311P\221\255\334|s\r\t"
+	.ascii	"2\003\202a\353\352\022w\031\033T\003W\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocal.29.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\315\t"
+	.string	"\326SF=0\307(\035\305I\030Cv\216\033RW\361[6\235o*\270A\352\352\2721\260\253|\253\265\372}\202Q\256IR\367\311\330\341a`\200\302\340\\\\(W\251\037\3602\324#\261\233H\231R5"
+	.string	"5"
+	.string	"1"
+	.string	"\230\303\355\b\230C\333\226\240\020y\364x\222:\253\344\364\202\355FNY\037=G\376]\316\340\n\340:"
+	.string	"@Ezj\027\273\353D\251Hn\275\355\006\333\033\373\n\001?|\353\317`:\263\364\267/\302\022X\020\330M\305\024l\0018@\305\266\310\316\330\326\030\202"
+	.string	"\"\323\376\312YDo\211\374`w\325\"`7F\330a;t|BJ\3625\365\006N\013\334\361W\267\355\216T\370\256\277x~\312\241?\276<\352\320\3770\207\327\t\224V)cv4\245\232\330\317vw\255+\333i\3551!\215\334"
+	.string	"\311Ps6\235\316\023\342>^\327y\034\356\343\301\3508\016\350\3436\013\366<: .\344y .\023K\267\246\232\222\232l\220\017O\205\232\251\315\341\311\2434\325\234\002\013"
+	.ascii	"2\003\3020\330\341\364\241jZ]\270'\306FP\r\\\001s\tPq^\327$\003"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocalShort.30.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\275\t"
+	.string	"\326\323E<0\305*\035\236\343\300\213\237G\325'\367\036\307\301\2739}J\214&w2\n\340\317\336\022~u\237Q\327\203$\364$\246\305\214\210`\002\f^\345\376\350x\f\257T\302K\2026\2212\2454"
+	.string	"5"
+	.string	"1"
+	.string	"\227C\356\007\227C\333~\210 \271\364H\262\272K$\025\223\355\306N]/=K\376U\276"
+	.string	"\023\200*\300\3022=7\212\335u\252X!\267\3366\203\355\215\375\204?\374\353\327`:\265\364\271\021\210\354\300\304lw5C\260\003`\200\023\333$\033c[c\207\001M\246}\224\247\220\376\362\270\301n\253\005\300ntp\003w\350x\204j\3625\365\004R\t\254\361\230\307\355~H\370\260\257|\276\311\2419By\325\241\037\272\034^!J^\247\234\331\021\225:b_\333\335\265\266l\247\267\307\242\213\304\030Y\2509\233\216\347\021u\237\317\363>N\367\361Tx\035\007\024\3526\n\3766:\240N\364}\240\016\023O\367\246\231\223\242\\\220\232\247B\325\324\316\360\344U\233fR\001\013"
+	.ascii	"2\003\3020\330\341\364\241jZ]\270'\306FP\r\\\001s\tPq^\327$\003"
+	.text
+	.section	.gnu.lto_dateTimeUTCToLocal.31.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\035\n"
+	.string	"\306\223G? \3078\035\230\305"
+	.string	"\023\220\340d\222\220\034\037\250\341\2200"
+	.string	"\220V,P\001\360\233\345t\210\377z\f\360\204\207\364\3205!\030\200]@\270\032dg\314f\211\327\206\302\201R\317,n\262eJ\0012"
+	.string	"4"
+	.string	"5"
+	.string	"\230O\217g\260|b\276`\371th#\370(\262_\0311\251\022\354n&C\036^C\377(7\020O\243\353\245bw\255\342\351\343\226\267\375`\333\302\276B\327\356\256%\312~\352\237\037\377K\252U\325\277 \0200@q`\327\243\265`WS@\211\355c\366\310\222\270\3327\371I\370\324\306\023vQ"
+	.string	"\002\354\216\031C\004\230\252\234\362\2226\206\247\027\355\320!G\276T\2311\261\374]\245\201\331\345\230\360S\256\002\362I>\035\022\351E\221\345\3632\2424@A\212\244-{,\251\004\261\037\234\327q8P\333t\264\355\353\034p^\307\341@m\263\201!\314\233\206\363:0\363|\236\367m\231\247\323\274l\373\2002M\203\277\f\356\223\201\337\367\311\260\221\364k%\312\027\005V$Yr\r"
+	.ascii	"2\241-h`\342\342-\365\206<Xk\256\261\2550\0340\002\306\201a\001"
+	.ascii	"*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_dateTimeSplitFormatted.32.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\030\002\255\022"
+	.string	"\246\341yI\300\224Q:t *\2422K,"
+	.string	"rjs\330]t\2324P\002F\225\244c\251/\224\321\201\212\3443\242\f\037\374\322_\267\375c\277\346\371\274C\020\004\241\243D@5\225b@\252"
+	.string	""
+	.string	"\3448\226\235\261\"\215\220\275\345N)c"
+	.string	"`"
+	.string	"k"
+	.string	"N`:\365\370\002\336\251\351\004\274S\024\0062\206}\034q\363\235\036\331m\251\3261\334\035{\022\366\317\243s%\314\237\371w\022e41&\275\0248\247\224'\tI\227\023=|\316\024\240\036\022'Q\303\\\333\220\f\022\261F\356q\2270l\304t9\021\347\362S\251\265Z\316\304\016\267\351\266e\266!\330rB%\2745\373\266?\300\307\037"
+	.string	"\370\240\377\2634\235Sz\245\264\374\355\276"
+	.ascii	"\327\321\222\220\007F\265\336\354\214T\034\364\005\212\337n\237"
+	.ascii	"\205\217\273\275^m8\2003\331O\220ZG\005\247N1\235\336\226\261"
+	.ascii	"Il\233\313\300\200Z#\264\301\301\216\256\037(R\332\3779\220\314"
+	.ascii	"\203^/\251\265\226;\252u\\\0204\0204r\367Yk\255\336\311\347\202"
+	.ascii	"\364\203\217N\022\345\324f\320\271s\2774\333oy~Q\206\326+\226"
+	.ascii	"\324CD\272\310\032\263!'\377\312\255\340\263\263Q\021\223;\177"
+	.ascii	"\353\023Yx\235v\234\360]\336)\345\271\261\"\004\215\334!p\221"
+	.ascii	"\2434c\274\345\355\036\367\222\034@D(!\361\250\221E\026\311\207"
+	.ascii	"-\267\253c\2173\262\201\016\032\0011G\245^X\023\305Zi\231-(\026"
+	.ascii	"k%\265R\271\200f1A\245^X!\214*\225R\261\2040/+\251\220eu!49`"
+	.ascii	"U\fj\025\262T\252U8\326o\315\027\272\004]\321\220\221\347\303"
+	.ascii	"\274\343NAG4d4\177\230G\351Z\205fc&\276\3251\230\243\340\322"
+	.ascii	"\231\374v.\315-\276\033\241\307\2130\264L\273{$/ \200\002\021"
+	.ascii	"Z\346\001\245\t\376:wj3\031\362\241\303\202\327\312\233q\275"
+	.ascii	"S+\234\266\376t\221\007\271\240\236\246c\203K\024\b\312\306\t"
+	.ascii	"\fA\231\267b\334-*r\237j\266B,\200\215*\021\213\027\302\326\005"
+	.ascii	"\317\236\315\026\033\370\354\271#\023\031VT\350e\216\310Q\202"
+	.ascii	"\023n\332\212\264\006\347\206m\340\273\264\320#\220\213{]\357"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_rtcHasTime.33.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375 \367\275\006"
+	.string	"\322\314.4P\213\222\016"
+	.string	"FU]\032\244\203\030\263s\017\254\240\374?\315C\034v1\373h\037@\337\352c\273\330_vff\273\030\273\255M\311\020\275\2535jm\023\231\002W\023\212U\271<\313eYW\365,\225\005\353UX\303\233\f|1P\260w\271.\354I\266,\206\020\t8\330\371b\"E\304z8:\035\025\003s)v\310\270j\245n&R\252\030"
+	.string	"\301q\245\3376\016%\276Sb\350w\243sw\022\260\370H\320\310\374\224B\322\203\332\250\3705/\371"
+	.string	"As\326m\342S\021\311\223\001\222\271=\0245\253\313n/:u\214H\032hS\007\240\220\231;\r\364\320\261\177\301o\360G\004\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_rtcGet.34.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\235\013"
+	.string	"\306VQA o\224\0160q\343\214Bf0e\265\035\274\232\215\236\202|\200\027f\001]\255\202\344\022eG\313\2765$\233\204Zy'\t\246.\b\b\360\002\242\"`\304\301\001\216\022\3341g\024\211{o)S\n@"
+	.string	"<"
+	.string	"="
+	.string	"\266\275\200\201\346\355\035\007\215s\234 \215\230\354v\227r|\373\323\334\374"
+	.string	"\034\350\257\262p}\006N\030`\b\340D\357\200\t\022\322C\236&n\224\231a\331]g\211\253p\303\333v`;\201\375\007\001-\032\224\354j\244b,\t,\341a\373>\352\"\236wV\r%\036v\327\362\330\326\341m\315\266lg\332\377\360\017\355 \237SvO\036$v;\005FP\035\272;\201xX}@<\fO\037r\n\352\005\312E\n\026\243<\261\017\342#\034\277\303\024>\371\322\241\377\211\207O/\362\354\330P\261\361q!\224)\273\023\245n\260\377vw\255'\307\203\374\360\245\237\323Yi\035L\002\235\373R\301`\231\316\245\3110,\273\\\232L\004\354\272l8W\245\2003\t\230\315\325\311\262\315eu\241?\215\020V\240\b1\"\375-\246\232\324\226\220\212\036\200\204jg\023\362\245\250OA?\311\220\022\241\346\304\020"
+	.ascii	"_\b\b\303N\026n\025\361#\026\352\r{\r\325\026H=\021\227\367\020"
+	.ascii	" \327\250D!JPA7\257\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_rtcSet.35.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\365\t"
+	.string	"f\024H=@\247j8|\255>\\\366\013w>!\373n\227\322b\253\377\237\303S{(\236\311\240\370\244\nZb\276sI\207\264\037\350.<\214a\006\021`r\301\342\245\202*Y8l\264\367\2262\2456"
+	.string	"5"
+	.string	"7"
+	.string	"o\320\236mg\320\236\3316E\205\307\340\305\222\321M,Q\001\327\256\310\251\351\340\023\364/\340\017'\257\221\225\001\322\347\231p\261\273\316\220\004r\353mC\330\226\260O\tZ\262\237\3725Mc\232V,\235\232\276\002\370\341j`\321\332\035\215\257]\220%@\331\366\330\013\2663\355\003x"
+	.string	"\317S\235SvK(\004\273\342\204#\266g\026\003\254\320\201\352\025\323T\320a\022\312\321\251\252\027E\330\322\346\320\344\303T\f\221\220~\354\253>\316v\362;\332\263\253>h\rX\035\b\001\345h\213\237T\022\373\330\356\256\003\233\333R\271t\230\r\227\361\272\316\263p\031LF\307Y>\rWq\260\267q\371\270\215\347}\234\305=\266Z\362AMc\364\200\300"
+	.string	"\244!c\352\253N\200\343\237\334u\362\341\263\007\t"
+	.ascii	"P\213RF\214\325L\274<\203\225\032\355\314\204\226\256\001\310"
+	.ascii	"\016q^\327$\003"
+	.text
+	.section	.gnu.lto_rtcGetDateTime.36.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\323\002\005\025"
+	.string	"\026'\212I\3200\2511\260k\202\016\200\327p0{\007\275_\241\002\377\022\265\327\260\027A\363\253\031\030\f\221g\304+\201'i\344\005\n\362\374\306\305\017"
+	.string	"91D~\nS\260md-\236.\347\003\2541 aW\337Y#[n)S\nu"
+	.string	"m"
+	.string	"u"
+	.string	"\366\205>4s\"\231\203\334\273\363\231\270\3274\340\002\255[\233\017 \336\266\036\"\336\332\366\t\202\031\323n\376\340\334\007\307m\304\357^s\254>\247]\264a\2454\237\346\"\220\221\255T=\020PH9\016\017\303\003\266\337\316G\316\026z\\\335\236~\332\320\032\016\330\361\334\370\310\325\204#LM\267\373Nor6JY(\367^S\\n\303\315\272m\322v\211]K\002\272\241\0165\032\264\315\032Z{\354\207\367\336\353\272s\007\213\332u\242\337\232\232\262\250\037B"
+	.ascii	"H\267\343\003\254P\346\305\t\002o\223=\021\342\346o\3377:\022"
+	.ascii	"\314IX\200\356G\367\275\234g\021\236\337\213\r\343\027\275g\277"
+	.ascii	"\034s\236\355\256\324\t\335{_1\366\353\226\3323\376\351\227m"
+	.ascii	"s\366\213!\307u\203\312!uo\016\311\255IZ\224\0063\356\275\t\374"
+	.ascii	"\024\262\t~)#\336\276wZ\342\224:!\252\032\r\326\244\362\247\206"
+	.ascii	"\005@_m\265a+\3648\217\330*\215k\325\t\3368A\301B'\244\211\035"
+	.ascii	"\365\347[NE4<\350y?I\021\236\337q\276\217\305\002=\256\243\206"
+	.ascii	"\225\346W\036\202\276Z{\374\231\350\252\367\035\344\264:m\310"
+	.ascii	"\210\262\241W\366K<i\346\227\216\221\3648R\274u\325#\235\226"
+	.ascii	"\272\247\262\313*P\303LVb,\262\261\205\214\305H\330\330\302B"
+	.ascii	"!6\302\\^F\023\021\223\027V\\F\031I\272\214/\263\366\360\326"
+	.ascii	"\235\305(\rGJ\366K\013\2422\034)\205?M\244\365\246\032\245Vk"
+	.ascii	"<\013\357\375\240\340<\210\024O\254=+\030\374I%\006\360\327\340"
+	.ascii	"NS@\030\016\3364e\365Ky\360\027KVA.\376\236!\234ID\325\357O\211"
+	.ascii	"\360\026)v\251*\210\352*\342{\226p\025*\037\0012 \200\002\021"
+	.ascii	"\272\253\007\227\f\375\252\360\216\210\257@\342\017m\240\243"
+	.ascii	"\311s\244\335-\3029\314\361\320\243\311\024[\016\357J\341f\r"
+	.ascii	"\372a\036\270>\354\261\225\034\241\306\215\033{\031X\203\347"
+	.ascii	"\211\365\"\274G\345\021\256y0:\177W\037\337\342H\310<\006\321"
+	.ascii	"\030%\300\007,\030J\367&\3530\213\235\267k(M\230\020\030\351"
+	.ascii	"6\357\0333\225\201\201\362\260|\036\236\264\314\036"
+	.text
+	.section	.gnu.lto_rtcSetDateTime.37.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\315\n"
+	.string	"\326\326N=0O\224\016\357\322\324E)\370\f=\362\f\233\375\344M\027\276]\215\235\253\006\321u\035y\243\265\330Gx\375A\222\265\277\026K\nJ-j\314b\276g\0301\367,\314\226 \262\267\224)\005="
+	.string	";"
+	.string	"="
+	.string	"\273\337\001\027\260\036\375\375Q=Z\027P=\3326\202\004\031s\3774t\276\241\303!\001c\367\3034\303\271'\347\177t\030:\261\302\363h\236\032\013v\327\351y*\334z\333\004l\033\260\257 \351\n\246cL\303\213~\205\351;\002|`\301\240\264\333I\305\330S4u\260}_\304I\230\177\326\021(B\273{a\354\353\361v\306\276lg\332\007\361\020\231\213$\034\300\356\307D\212/\242^+M\025\024@]\246\f5\352936\231\362\225>\351\201\226\367\240\236t\007H\006j\003\325\251\306V\252\332\021,y\357\3720y8MP\215\375u\251\030\354\303\335]\353\307\206\001\027\007\351\f\022\321&\027\214\262i\332\226a\224I\003\r\313*\026\f2\300\033\204H\005\273l[\005\363\2679\\\375\370\\\365\321-\027\026.l\2406\332\271R\277\304K\231\317\301\021I\364%\325\343[x\001\t"
+	.ascii	"w\213\302\2631\354Y8(\204+<\303q\227\331A\005\315\274\212h\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_rtcPersistWrite.38.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\350\002\205\027"
+	.string	"\306\256\237F\300X\321p4p\201\305\224D\226\341\372\023\223\362,\323\0304\214\211\207R<\024\261\230&\215\243\202 \003\t\315\252\206\202\363K\205\002\363\024P\001\235\026\005{\024L\223\223o\227\267\277\264PO\327\331{\357-eJ\001\210"
+	.string	"\177"
+	.string	"\215"
+	.string	"?>2$\210\377\374\334\205d\037\212\2116:\342\016\335\217\322n\216\301??\020\377\245\274L\373@\277!{\220\b\177\273,\202\200\354n\003/\020\377\rx\001\360_\036\005\376\263\314~\362\234\317^\247\242\226\243\312\356\252\364\305e\007?OS\346\207\021"
+	.ascii	"\330n6\007\003\334P\374\023Q\334;\335h^jw\257\033\221\352)\340"
+	.ascii	"Ya\345t\273\361RE\222j?z\346\334h\231a\204\335u\332n&\356\360"
+	.ascii	"\266elc\2605A=\366\275\335]+\217-\246a\3024\312\345\364\240\277"
+	.ascii	"\345C\267x\242;\f\323`\230\376\302\264\027\2465\323\231\351\033"
+	.ascii	"\360\214\020\371\301)\223\334\226\330a\331\244\017)\306\207~"
+	.ascii	"\242\277\350j\337\347\361\037\266\3115\367a\004\270*8\240\335"
+	.ascii	"}\217\037\275nd=1\244\306\356\276lS\215m\372w[\346\343x\216\353"
+	.ascii	"l\362u|\207\354E\260/\216\016\200Z\223\025J\273:\025r\342Q Q"
+	.ascii	",E\033\260\264\372\032FLp\226>}\321o\213\342\251\352\247\307"
+	.ascii	"\301\275\350\236\026\370I\221\252z\025\222t\017\001\257\251\307"
+	.ascii	"\231q\223;\267\350\3653\214\220\324\226f\271s\026\235\335\222"
+	.ascii	"O{\2563(\253\302\033A\030\275\356b\022\034N\004\344\215\256k"
+	.ascii	"\035\350\361\301\001\331\374#\031V\336\006\243\236\332\374J\213"
+	.ascii	"]\221j\217a J\177\364\027!*BR\2244\241\345\025\373A\216\004\363"
+	.ascii	"a\370C+ok\201\377P\372\037O\030\270%\270\033)f\271\263s7\251"
+	.ascii	"\001\253\026\353\302\007\327\b\023=\310\260<\264pp\215\030df"
+	.ascii	"\306\t\260\021\204\351\265\242\251\231aQ\240Y\275:t\030\0058"
+	.ascii	"\306\301\252\305\242Q\315\214\255\326\030\243\232amh\251b\\/"
+	.ascii	"\225\203\003\036C\254\\*\232qt\251L\271\331\225\307\247\261s"
+	.ascii	"\344s\321\330\016\316\373\221\213\232s\033;>\276\223\306vHx~"
+	.ascii	"\f\f5\307\202\224\244\231\336\030\346\355\272\200\2404\224;\277"
+	.ascii	"\244\250\037\001\245\227\f\325\273\006\320\336\020\223\2679\221"
+	.ascii	"\220$\215P\033\360S\027\315`\004\005\324\223\346\224\332R\352"
+	.ascii	"S0/ P\002Q\354v\003\005H\321\026\360y\233'~|\\\001\351\r_\273"
+	.ascii	"\215\222{\035l\346!\013\214!\261n\343\254\035V\343\236\325\017"
+	.ascii	"\307E\037\037\254!,\177X$\355\206z\342\236\004\310\274\242\205"
+	.ascii	"\2061\343!\234,L\025\262z\374:\302\23410\306\016bLO\233=h\370"
+	.ascii	"$A\363\267\013'^\021\024\244=p\340\276\234\311\303\241I\353A"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_rtcPersistRead.39.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\222\001\035\020"
+	.string	"\246 qE\360\320&\035\222\372A\276\256\247\b\212/\210\354]]\177\034~=0\313&\200,\007\306\243\226}S\261\"c\030\374?\224\213\354d\301R\365$\340Z\257\027I\253\303\007\016{]\310c\bvS\214m\333{K\231RZ"
+	.string	"Z"
+	.string	"]"
+	.ascii	"\231\366M<\247u\035\226\007\330\2659\021\264\333%\260\201\322"
+	.ascii	"\241\273\017\210\207\245\013\210\207\266\255`A\313\256w f\216"
+	.ascii	"S\002FVc\267\333\364\303]\177\232.\377\365\2473\206<\020\371"
+	.ascii	"\304j\256\0361\330C\355\356eO\231\230K&)dw\2351"
+	.string	"1\232\033\3366\004\333\016\354\033\005ow\327jc_\347\367\370\316}z\317\2559M\212\351\b\323\020\246\037L+L\347K\377\343\034\204j\304\210@\264;sd\264Bp\305\210\357\374=O\273\345\363\\f\255g\005\005\373X\030N\016\t\006%\373\335Q\264\276\263Rzi(\245\310\240S\264\333!8\364\201\322!\352\005P\243\376\251*\324\277t8\351S\b\003u\263\210\251\252\217\306\213\221\246\251\r~\200`r\264\344\221\335\275\236\273\373R\275\361J\274\222\360\274\200\345\r\237T\323+\206\237\031L\215K\036\331\224\360\244\005hp\b\231\362]\025m\256B>F\323\313n\022\261!\310F\021L_v\367J\275\261\037&,n\004e\305\211\244\240\244R:LX\334\b\312\212\023\271\300M\320T\356\022\220\023UJe[q*\025W\262\255R\022T[\t\313\302\006B\300\034\205\023\326\246\302q\254M\353\366o\325\306"
+	.string	"~f\263\364]\361\262?p\3413\003\322\337\025I*c\233\244\016iQ\227\027\325WA\222\352h\021\302g\211\207\037\212\221\021\027"
+	.ascii	"1\013m#\302Cm/\034}\304\327z\227\245y\342\001\312\026A\315\267"
+	.ascii	"k\030\205\315\310:\027\376\323f\3135\361l\002\007\006\r\225X"
+	.ascii	"\320\034\210[\236\"\207\252rH]\337\332R\006"
+	.text
+	.section	.gnu.lto_rtcGet.part.0.52.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`&\001\215\r"
+	.string	"f\032[C\020\221\223\016_/'\347\210\314!\0208d\177\235\355a\376^\246\227\027\3747\310\243\374\213\252\3563\332\250\241\275\367s\"]\004x\373D"
+	.string	"@\021JJ\005\275k\240\3544\303w\324W\364\336\306\336[\312\224\002G"
+	.string	"K"
+	.string	"F"
+	.string	"\177\216\357\200\177\232\027\200\177\366K\030$$d\262m\220\020\221\267\307\017'_ia\262\232\331\215\327\237\256|\273\246\333\374,\241\214\256W\035\301\210\031)1,\224\rO\002w"
+	.string	"Dv\327\032\016\367\273m\007\266\027\330'\021,Xl\037\346\300(B8\271\270H\265\254\205\310\340\343\315\343\202\312\244fR\276\217\342\253\317OXS`\264\354\356\347\276*dol\221\275\261\346c\350/ \217\270\032L\326\264\357r\023\242\277\200>`\027\305\262b76\370\263\002MO\321\361CX\002\350\371 \370\247\332\001\242\3035\365&7J\262e\216\2643\n\371\322\365\252s\210\260a\242\021\203\244\243T\025\253\273[E\331N\303\307\377\301\264\203i\205\351|\351\007H\360B\300i\367\244Uc=\274\332\315\371\030\301:\332E\222aX\306\271H:\021\260\213\343\251p}\030p6a\304siY\346\2716w\253(_\365\007120*\362\337 \324\f\266\241Z\244DI\252*\266\235\372,\355\253\222\f\325T\247\307p\"e\313>+\032"
+	.ascii	";\213\221\362\006'\007JA\005i\253\030H\005\025\b\004\220\007"
+	.ascii	"F\270b\304\304\006(e\343\227l\360d\016\030eF(\363\235\215\235"
+	.ascii	"\021\205\340\3209\357\320N\0135\207Qg I\r\\\363\376k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\247\002\225\f"
+	.string	"\304\021\243\003"
+	.string	""
+	.string	""
+	.string	"\002\023\177\031\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\f\032\200\204\001"
+	.string	""
+	.string	"\003\002\024\177\033\214\260\273\304"
+	.string	"\002\026\177\034\002\027\177\035\030\177\0364\177\037\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\013 \031\177!\272\200\202\002\032\177\"\033\177#\034\177$\035\177%\005\r&\201"
+	.string	"\002\036\177'\037\177( \177)\252\333\3426!\177*\"\177+#\177,\002$\177-%\177.&\177/'\1770\005\0221\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\0202gistry"
+	.string	""
+	.string	"\005\0163\001(\1774\377\037"
+	.string	""
+	.string	"\200\200\200\001)\1775*\1776+\1777\003\004\200\004\001\"\003\004\002\202\007\003\005\004\320\360\372\250\001\001\202\006\003\005\003\033\204\023\003\005\033\261\217\205\327\002\001\304\033\003\006$\003\013\005\f\005b\003\016\017\004\022\006\310\377\241\372\001\001b\003\023D\003\024\024\002\223\327\3232\001\302\001\003\025\025\034D\003\026\026\204\n\244\n\003\027\036$D"
+	.string	"3 \300\002\221\"2\017\245\2102\264iA\221\311lY\234F\363\240\314[q\337<\025i\245\270\216\3460\222\021\233+\206\220\331\213\033c\274\001\276\036"
+	.string	"\207\013\210\252\226\356\233`t~&\034\263\264\341\323n\3729}N\342\313\320\3037\376gS\002|&\214\337 \374\353\007\026\231\036\277\341?\233"
+	.ascii	"\274\221\214\200h\237\3410\363\345\261z4\324\004\230B\302\314"
+	.ascii	"\025\n"
+	.text
+	.section	.gnu.lto_.refs.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375 ]\205\002"
+	.string	"\324\003Y"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\027"
+	.string	"\003\002"
+	.string	"\001\024"
+	.string	""
+	.string	"\001\033"
+	.string	""
+	.string	"\001+"
+	.string	"\001\006"
+	.string	"\007\003"
+	.string	"\001\f"
+	.string	"\r\001"
+	.string	"\001\016\017\021"
+	.string	"\007\001"
+	.string	"\001\022\023\001\007\005\025\026\003\031\002\r\002\032\002\030"
+	.string	"\007"
+	.ascii	" \004\334\275X\300\312\bh\006\344:Wy\002"
+	.text
+	.section	.gnu.lto_.decls.dba9085fceb63cd0,"e",@progbits
+	.string	"(\265/\375`\335!%\225"
+	.ascii	"Z\347\3102Q0\220\312I\007\326\f\341\256\374cx<\325\037o\366\206"
+	.ascii	")J\177\243\327\303\006\361\253\305>\276\261\260h|r\325}\026\035"
+	.ascii	"\213\230>\237j2\335oE\375\361\311\035\"\315F\207e\312\200\034"
+	.ascii	"5\bK\361\325d*\240T\237m\207N\352\0271b\311\2262\005\245\002"
+	.ascii	"\025\0037\003w\274\274\033\307\371\031w#\353JH\272\303\335\343"
+	.ascii	"\273\241w;\307@\271B|\263\206v\215\271Q\271\251\363\rQ>u\351"
+	.ascii	"\363\\\307r\334\346\347\324\004\303\321\347\271\r\323\261\032"
+	.ascii	"'\005\b\202\303E\005\244O&\232+"
+	.string	":\257\361\375h#\242\244O\037\036B\321\313\344!\224\323\024\235\325\f\241\310\252\365\006a\240DkJ\237\026\r\211\324\250v\026\326'\237\351'M\274\254\372d\022\361\3272\316\256\317\363Tz\326r\366\203\313J\027&\003\"\n\335\"\232(\25623\253\2601C\266p\371\221e\351\220\200\327\330\013\253\331\025-\255\221\005\207\335\275k\321\037\001\005\274\306W\230\314\256\\\267\210&\215\004\021;dT\360\356]\317l\\\206\315p\033\2771\031^\362\032\2039\207a1\357\365^\343\275\327\004\221\235c\345\213\235\320y\027\351\321X\004\332\323B\312h\234\306K\022\374\345\\\205\255\334\347\264\336\265\225\350\231e\351\363'\244g\022\250\335\333c\022\350EH\357A\372\rR\"\f\322\004X\004\372\t\322\022,\002e,\234\205\227\006\360\330#\240\340\226\210\345\206\335\273\006\375\334\001\273S\247\317;\220\236\225\017\001w)xOz6"
+	.string	"\345=6"
+	.string	"}\247\020\260\bT\210E\240\315C(\207\031`\217P\311[v\357\n\"h\365\021\245\325\347W\026\201\246<\204\272\020\302T\030\273\267\300o\322\334ty\210\277\351\330"
+	.string	"\007\256NK\235\272\346\347\017\332\364\374-\245\346\3476C\364\017\177\253%\231\301"
+	.ascii	"\364\367\225\2377\240{\341\367\267\030\013]\367\375\255\004\375"
+	.ascii	"\233\315\330\317k\346\230\002\271\237/\210\373Y\r\303\331\005"
+	.ascii	"\376\256\361s\321\033\223(\3233\230g\204\376^j\340D\177\003\331"
+	.ascii	"\004\333\313\374'\363\377\355\277\333\377\265\263\375'\321b\200"
+	.ascii	"\277O\370\257\367\263\016\253\300\317P~\246\362\363\224\237\277"
+	.ascii	"~\216\3623\330\317bk?g\375\354\365s\327\230\377A\277\315\341"
+	.ascii	"g\007~>\361\277\377v\341g1?\237\375L\366\363\372s\225\237\221"
+	.ascii	"?\353\3603\016?\333\360s\r?\253?\203\360\263\360\347\340\317"
+	.ascii	"J?'\375\034\303\3170\374\374\302\317,\374\234\302\317'\374,\302"
+	.ascii	"\317"
+	.string	"!\374\274\342g\f~V\361s\004??\360s\211\237\021\370\371\200\377\314\237\013\370Y\200\237C\374\374\363\363\357\177\336\377\002\3767\360?\316\377\261\377_~\266?\237\377\357\374\227\363\277\371\377\315\1777\377\353\376\303\375?\363?\354\177\005\377\333\376\217\330\333\333\333\373\321\343\177j\360\023\371\002\357,gG\275)}\366\2256\006\t\271k\023\353\263\3276\322\244F\323\n\327\361\211\202\027ww\374pc\207\232\225\372\372\352\260\":\250\274\303\330\212\310\271\353\263\247\264\021N3\226\344\255\317\006\373\221#w\344R\007\210\253\271\204x\307\313\253\243\374\212v\246\232xP\336Q\372xb\312\016%\235\023'\375\244\267\354xx?\271\233 \2543T`}6W\033\361a\205\221\353\342\346\217\\^\262\213-=\203q'Yv\222f\302s<\337\334\330]$\217\023\275\204\235(\261\003k%?Z\314\364\316\372\\}\320\204\230\361"
+	.ascii	"\223\276\2114VVo\201\260^\035=Y\240\246\232x\267\nY\342\357#"
+	.ascii	"\357\255\346\207[@\317\03006B\372\274\2346\362\237'\005(k_\332"
+	.ascii	"H\0279#'\215\007\323\347\252\r\215\007-\006s\016\tB\265\326\347"
+	.ascii	"\373g\364:!\357\275;|\353E\026?\234}\374\303\226\027\370\177"
+	.ascii	"^\313\200\235{\213\2045\323./NV\235\300\375\357%\202\270\353"
+	.ascii	"E\036\225X\304\343\022N\n\304z\211\bp\225Z\367\270bI\235\311"
+	.ascii	"\333w\275|"
+	.string	"\215XR4\034\327$\362\270&\211B\327\230$\336\273J\t\035\313\234\210|TbI\035\225I)\020\327x\211W\351D$5&\245\216nI)\241\243\322I\352h\304\222\002\241\025\206d\353F\026\\\031\363p4\336\034QWNH!\346qM\336\271{\271\214\306E.p\357U\0229\347D\305hEf\216\342\026\247$\217\210*f%\257\221y\364J\336\353U\204q\243& \256\314\213\204\231D\255\253\013E\343\336\001\242\356%\362e\336{\211\367\336\037\362j\275\027\210\320\221+*\352\336*\242\250{EL\243qo\227\261A\223:*\263\222EicJ\256[c%2\327\235\303B\246J\342\225\013\025'\345\222\232\272\353s]\363\320\350\350\241\317\026B\364\323\246e\313\235\323Wh\2341\2743i\377h \274l\253\237X\222Wy\357\372c\235|\224\361R\002\r*\201\276\253\376\366\321T]\007\244J\222>\371"
+	.ascii	"\036E\357\036@`\304 M\3724\240\247zG\027a\360\271\332\322\033"
+	.ascii	"\322g\333\261\b\024\205\216\2427\362C?]lp(\373|\200\207\320\276"
+	.ascii	"\3218x\3710\r\365\216b-\3471\256W\211d\f\021I\237'\263\2456\374"
+	.ascii	"\302\240}\354\256\3216\336\307\246\361\301\330\307\363^'f\005"
+	.ascii	"\200\230\025\360\205a\342\224E-\375\373\311\370c5\206\325f\331"
+	.ascii	"\306.v\020\305\212"
+	.string	"\256\317&\266\323\273\330\367vq\202\344\275N]\f\262s\257S\020\263\002\314\n\234S\262\234hA\317s\227=\275\021\322\304\345\365\251\307=p\035 \337\275\311:\256{\357\035^\262\036\333Y\211\322\252/tE\316\363|%e<\246\303\313\021\234\307w[E)\260T\207{y\004\312{{<\002=o\245?\317\031\361\223\2226\304\210\034n\316qB\266\327'\303\341n\224nP}\212\255\306\336\022\007\316\231\272\364\034\206e\265\350\210\024\261Yal\266l\222(f\214\330, \"\210{\265\326pE\261a\226\212\005\263R\354\024^\332/\253\344V\210\035bd+\366\313\036a5fni\0206g\223_v\211\365bf\225\3205vycw\3575a\242\347\006\0263\b\320\211\365\272\002\212G\020\252\324uY(\274\264^'Z\257\227eb\2370\263j\275;|\2700\347\334\231\030a\342\347.\315\234\025\372\304\362"
+	.ascii	"\264e=\022\247O\313\365\253\242j{\342\322\204\227\326\211\234"
+	.ascii	"\257\264:\257\033\223$KKzT\231\036\225b\221\244j\354\202\274"
+	.ascii	"\361\220\036e\222\036\335J\217&\323\243V\351o\265l\226OI\246"
+	.ascii	"\371f\263\310\320\224\201*\366y\224*\025\342!4\001\036B\273\004"
+	.ascii	"\020{esLA3rfEB\0223g}\236?\272\315\tWT\225=\31651\273Bu\266\327"
+	.ascii	"\374\321\247\365\221\322@m\220\350\t\322e\210U\237\267>~K\264"
+	.ascii	"=n\330\323\233c\021\250\235*\272\345\341\363&\306\316J\237\037"
+	.ascii	"\344\330{\253\303^\213\354++\322\247x\274:\321F'=XY\211\202\234"
+	.ascii	"\342\224\324\350\323\342\260Q6\307\317\303\243\006\205\346\252"
+	.ascii	".\275\205\332\202c\002\245\317\2666no\374<\2770\244\321l.\275"
+	.ascii	"\255a\217?\217\325sS\263\301Loi\354@G\004\254O\373\224\322\360"
+	.ascii	"\245\221\340a\203\245NI\237\267O\277-Z#\224U\325\233>\017\304"
+	.ascii	"C\250%\026\335:\265\223\262\266\266>\177|Q\356\334\3512$T\246"
+	.ascii	"\232x<q\244"
+	.ascii	"\254t\216\344\345\265\235\f\314\202\330\245zK\232nu\336v\336"
+	.ascii	"\240\035iC\205\207\267FGZ\003n\353\366y\337q\316\234\216\302"
+	.ascii	"\367\326\341q\202\264\222\243\323lv\031\327\035@\247\253\314"
+	.ascii	"\035\0348}\307s\221^\246\232_\266\f\316\335Z\237}\307\303CW\026"
+	.ascii	"\224\034\035]\277\371B\351<\255I7\3577\214\304\016\215\250>\273"
+	.ascii	"\256\215\250\232\024\037m}v\233~\352\321*zA\323OR\310\326\254"
+	.ascii	"\240\305\305\365\0322%A\314\256:\"s\357"
+	.string	"5?OY]S}\266\\\033\361\251\242\206\214\231S,M\032!SM< \271\345\032-\270e\303\365\220^/\022\255\272Su\342\254\273\023;w0\231\375\306U\327\312\375\230j~\375\260\035YR\344N\332\326\326o\351\205J\217\320A\222\243\314\373\315\3475&\207T\237\355\326\3066_9\274\332\214\031\323l\313=\273\036\255;;a\326\336l\254V\246I\031\"mjj\035&\304M\216\025\311\263\363\261AF\214\n\314;L\216\264\255\312\025\021\263\264K\227NC\325\324]\2258\351\304\004Y\202\366N\353q\005\211\227\3161\344L\222/\265\323JW\225\021\261\364\255\205{\313\262\267p\223h\275;Z\264A\336\023\267P\32237\321e\233-\273\f\275\227\327\244\016\344\330X\227\245D>\342VU\342\367\304\f\343B\366.;\307<\0359c9\2763X\236\2705Io\223U\252t\226\364I\b\2261d\034\271"
+	.string	"\2128\f\024\t\2108\214\241\020X\203\2220i"
+	.string	"\325h8Bz\030(\bp\2412)\t\233\206FM.T\237\031M\301\025A\352a\240x\321\224\342E\323\020\022\223\f\017T\340\320\207\311E\373\206F\037T#\246\027M>\246\027M\026x\203\322\360\034\016\201\302\244\244\243\337\214\246 \322)T\233\354\177f\b\325\241\322\013 \nFCI@\246\027J1\216~I\300\241\214\223)\250\244\036\251GIB\243\027M(\200\214\200\352Q\214\246%`\013\0258\004\242\360\242i\200\244# \n\252\222p\005\023\220Ta\020\013 \025\310bx\004\002\222*\354I\002\252\252R\214&\026\001\004[\254h\221\202*\f\302`A\264\004T\2073X\200\210q\204\024\024ahE\213\024F\020b\241\002?"
+	.string	"\316p4\202O\022P\025\036\251\303\037\n\001\nUx\324\204B\005~\200\244\n\177\324\243%a\320\003\240\022`\250J+$\205HR\212q\244\3020\004$U\030\202\203`\013\020\303\031GI\347\221P\b\266"
+	.ascii	"q$%!\220\t\370\"\375\004*\036PQ\201\r\277W`\001\004\026@\200"
+	.ascii	"\276\002\013\212\212,PQ\224^E\221U\201FI!\250H@\031b(Ae\002\252"
+	.ascii	"C\245\241\020\330\004\200j\024\201\0041\202\301\r\214|\302#\030"
+	.ascii	"H\347\320\350\205\222\013\246\340\212\017\277\021T\340\320\205"
+	.ascii	"\213\240\321\r\252\220\212\244\ny\324\236\303\030\361`\023P\230"
+	.ascii	"B\r\006\205)|\206J1b(-\241C#\340\222R\013\240z\224d\344\243\032"
+	.ascii	"\251(J\205G\300\031'\f\225)\270\344\233q\224d\207B\031A\030\276"
+	.ascii	"!P\225\301\244\264\364S\215*P\231\224d\374^T\264\"\201\024H\370"
+	.ascii	" EB\001\\RRS0\005\227\226\202H)\230\224\216\226R \t\207)P\020"
+	.ascii	"\r\223\230\202H\300\341\017\216\025#\307\354\316Y\001\250\222"
+	.ascii	"\222\343\315\027\337\235)gI\334\3303\333\346\005\212\224\272"
+	.ascii	"\262\240,\253\220.m\262\374\320hl-\351\246|\222E&rl\272\252\251"
+	.ascii	")\306f\215%\223\2232\307\325sQ\302\334\300\252\310u\230\327\035"
+	.ascii	"5 }\3324V\315m\334m\\\3338\273\267\207\212\245!CO\313\264L\013"
+	.ascii	"\227\022\263\326\3303\267p\037p\034\331\330R%f\236\354\240"
+	.string	"\303\253\323o[\026\213\322LZ\231f\322\003v\307\244\252OK\306\356`\311\264u\263m\267d\036\364\233\373::\241l=\344,\276\361\330[\263\310(S\324$\373\004\003\306\212!Jo\230\227\031;\002\240zH\263an\305X/s\360\350<\t\2627'F\325\347S\037\\\270\330/\314\345\356\221\371QR\331\342\224v\373\005\210\306\332\003I\237\026\255\203\034Oi\266\304zy\323a'\257\013O\\\234 em\322\377\304\244?\217\261g\250\331\2553\347<\222'\306\306\236Y-t~$\365\372,a\315\222\212\220\201y\222\036\213\305b\311\030\313\325\001\200\030W\236\033\336\275=\260\366\354\330-\331\303\330\370\372B\326\247\375\302\241%\2162\314\211\334[+\263\004Q\341ad\311\032\304\223V\007J\217>\377\273\261\332\265\207\264\3205\026\267\240\361\016\274\253\251\274\035\267Axiw\330*DWV\242\317\333\035\016\203"
+	.ascii	"\250\302\3410\307\362\224B3$\"\"I\222\244\003R\n\020\004\203"
+	.ascii	"a\242\310\255\035\022\240\3658\221*\307FF$IAR\177\232\003\255"
+	.ascii	"I\2659^\316\2003\302u\026\367\363\305\013\236\331\221R\315\370"
+	.ascii	"\362\263\366\217P\274M\024\367?6\345\013H=\242\004\312\003K\021"
+	.ascii	"k)\t\345\344'S\"@\0046\303\306!\220<\t\307\004\264\033\337\362"
+	.ascii	"\032\037\304^\336\323\300R\226\004\020'\375\221\242\035\230,"
+	.ascii	"\265m\313@\203\302\316i\032\372\037;\266j\360H9~$\230\222\032"
+	.ascii	"\236z\254\263\212\235-\274c1\253NLF\374\007d\024d\346\263\037"
+	.ascii	"\242\331/~\3061^\207\303\306\356HQ\344Tg\002\020[\021T[Af\312"
+	.ascii	"(\f\241(\341\212\241W\351e\027\031\227TpR\341\270^~\030?\027"
+	.ascii	"p\232\3750\001\036U\302\376\203+\306\302w\221\364\243\225N\262"
+	.ascii	"\254ZQ\374\342%M\365v\325\311\300\247s\364\203\b\235\251\001"
+	.ascii	"`\201\256\237$\224\323\246>r\374\353\366\364\252\027W\260\306"
+	.ascii	"\223h\230\331\020b\004el3no\002\006\037\005\316\210\016ot\362"
+	.ascii	"\234\343\302\302\360j\034\200\325\225\ry`T\002\201\307c\213\333"
+	.ascii	"j~\022\357h\240\313\364v*\013\360\227\265ljx\026\325\322Mn\016"
+	.ascii	"\267*\0074\307\230J\273b\367\320\340M}\230\214\200\024=\377+"
+	.ascii	"P\253\023\244{A\230\371U#\020 ~\006\224\234\2058\371{\333;\375"
+	.ascii	"^#6\253\317Kye\370\265E\003T&\303\261`+S,\261;*\243\214\322g"
+	.ascii	"\254x\314\256\255\026\007X\333\202\342\351&~\354C\233[\350\347"
+	.ascii	"\277@%\001\021\013\230\341\3144\232S\212\207\336\365\276\220"
+	.ascii	"\241\220\207o\376\210\006\344\312\023\305\035Zw\373\351pl\260"
+	.ascii	"\376-\bsw"
+	.string	"\376Qn_B/b\237\211\256\001\255\371$`\252kN4\213\"wt\024'\035\303=Dw\b\030\230\221\354/CN\327\3206\1778\305~\220cZ\276\341\353\023\013\262\230B\017L\3520f\365\300\221?\233\210Bq]\007\f\013\370[\253N6\276X#\037&1(\261\302\212)\fSb\222\2219\273\tj\220\353j\242\262\nVf\221\030\361C*:\370l=C\016\242\307\223\037\363i\216\206\372\351\262|\246\246d\007\332\330G\363\327\337'!r\256;B\257\302\021\211\232\035\b\245\270l$@\272\320\331\224}\212\360u\260\373\030h1.\364\222+\022 \301\252\b\356\313#\365\360\034\212\363\b\374\237p\205\215\037\321\234\223\200Y\233\2759\203\347<\217lh/\203/\223\301N\331\205<\312\210HA\320O\036\221\301\002\210bD\241\200\362d\177\006\224\003njo<G?<\217Ls^\276\032\335L\265\002\364"
+	.ascii	"5\210@"
+	.string	";#\347T3\324K2\304a\244e\3342J(\017\244\030V]\373\233\377lr~\276,\250\f\210\005?\311\347\310\247\352]#\300K\016\277\363{o\370\210W\"?\272\346\032\332\327\207\243\240\306\353\231P\305\221\212\356BE\202\320\f\b\335D\030\262=\253!\245\357?'\003#\206a\211\350u1\264d\302\337\375\3501\353Gs5 \316I\314JS~"
+	.ascii	"\036\367\341Q>ZA\021\220\374\214Wf((/\201\245\220s|\nt\201\207"
+	.ascii	"\253*\255s\320CM5GFS\2033x\277\261\036Y\201\005<\021\344[\367"
+	.ascii	"\t\311\226q\204\247%\\/R\016;&A\230\336\315,\031\377[\244\323"
+	.ascii	"r\007\220\257f\002L\352\\Q\021\003\037M\340\321\226\260\320\321"
+	.ascii	"KC\204\275\377N\007?!\036\324%\340qY\335\016\352\004\365\005"
+	.ascii	"\003\264MgT\0023<UP\323\311\314vX\311\316\222\2662\257\247\221"
+	.ascii	"\3264\034\304\0245,#\f\361\266\334\341 H\366\303\315\343\rNR"
+	.ascii	"\361\342\003YU\223\211\204F\023+d^\372\b\207\321M\300\002\352"
+	.ascii	"\230\003\363\224\t\315\252\274p1>#\274s\346\253\237#\346g\255"
+	.ascii	"!c\f\305Y\2401\355\305\251I\026\b\371\243\372\035\243;Y\2602"
+	.ascii	"<\004\350\260\277U\362\244\001p\332p\2412?\223\021\027M\003\f"
+	.ascii	"\023w\215;\3604\315o\274\347\355\230\307\2136\265^L\205\341\004"
+	.ascii	">~\217\007Z\265c\332A7;\t\3454\362'\362\324S\223\2671PAc_\007"
+	.ascii	"i\n\260\370\317D\363\377\005"
+	.string	"\020\272\027 o\230\315\016\b6\3520HH\263\321\"{\216j\240`\031\203\211X7\005\227{\030\262sB\377i\243\327'\212[\325\213w^\363V\366\177\256\232\034]\333V\334sp{\373\214\276\331\032\027\"m\227\340N\235\336\223\302\231\332\376\324v\025A\026\242\274\013C\275\326\367\020\315)t\225\323g~\246\363\"\265V\245\357m\317\005z\377H\260u6Fb\020\353q\222C`\257 \237\226\016\253\256\2367g\274+^<\357W\344\357\\`\332\235OG\360\334\204^\204\336\357^\342T\257/\366\307\360u\363\031&\367|>\b(;;g\232\n>\223\201[O`\020\237\372>\270~l\272,8\020\374\305\347\354\214|s\262\361\372\362\374\365\204\353\021[\0070u\367\314\213\253<a\333\363\021q\260:\214\353\276\2311\3159\271k Sj\371\235\275\203\326\234\223\366\327n\303\372\330\323g\365CG\036\213o"
+	.string	"|\215~\321\377\371W\346}\366|\357 \274\361r\310\373\241\335\205\226\257\257\364\224\177jz\335?\341\357\323w+\214\333\353\334\3028px\303\266M;\257];:\257\214\2006i\256M\n^\260N\235f\027\030\222\355hw"
+	.ascii	"\327\322\263f>\2356\202\275\320\316\200O\360-\317\0042\005~\363"
+	.ascii	"\326\r\320\356\345\372\313\246\243i\307\276p\374%_\265\002"
+	.text
+	.section	.gnu.lto_.symtab.dba9085fceb63cd0,"e",@progbits
+	.string	"rtcTimeMake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"rtcTimeGetSeconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"rtcTimeGetMillis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"dateTimeFormatUTC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"timeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"dateTimeFormatLocalShort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"dateTimeUTCToLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"dateTimeSplitFormatted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"rtcGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"rtcPersistWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"rtcPersistRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"pgResetTemplate_timeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"timeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"timeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"persistentObjectWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"persistentObjectRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dba9085fceb63cd0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
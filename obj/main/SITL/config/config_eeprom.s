@@ -0,0 +1,748 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375 \304\205\004"
+	.string	"\244\006\270"
+	.string	"\t"
+	.string	"\300\354\222\337\t\002\002"
+	.string	"\002\001\002\342\247\217\320\002\"\002\002\002\003"
+	.string	"\002\004\002\005\002\001\004\006\002"
+	.string	"\002"
+	.string	"\002\007\002\007\002\003\002\003\002\006\005\233\364\343\336\006"
+	.string	"\006\230\370\222\271\002\b\007\361\323\312\225\n\b\002"
+	.string	"\002\t"
+	.string	"\b\240\342\234\212\n\t\311\306\266\303\013\002\n\253\334\366\333\017\f\002"
+	.string	"\002\t\013\232\362\322\215\r"
+	.string	""
+	.string	"\017"
+	.ascii	"+\013G\265;\224\030]\005\265K\342b\007+\233\314\234\372\363\004"
+	.ascii	"h\263swE\307\246\201\273\326`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375 b\365\001"
+	.string	"\204\002V"
+	.string	"\b"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002\002"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001\005"
+	.string	"\001\006"
+	.string	"\003\007\t"
+	.string	"\003\n"
+	.string	"\003\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"G\005\301\024\025\356\200Q-\332uA\261\004d\262\001,"
+	.text
+	.section	.gnu.lto_.inline.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`\257\001\345\n"
+	.string	"\202\21745@o\222\016\t\027.\007n\036\245q\223\001\002\363\177\033\300\013;O\367\036\357X\350\360\316\366\177\017d\261\345\216E\3053\b\365\"h\374\303lI\b\265F\266\334)\377H\272\336\223\032 3%\004\221\n\027\323\301X\213um+\270\020+(S\0332\030\016\241<a\201)ix\200\323\246\300(\321SG\006I\302\247#+R\213\302"
+	.string	"\235|}\214\350Gn=j\333\250m\032\207k[\376\004\326\247\303\261\342\240\232V,P\030\372(j\212\211G\352\325B\3276\374\263t\017;\216\333mv\234\216T/!y\335\346:\210\252\224P\034\270\301\356\336N\337{\357z\212\367\336\350\257_S\304\317\263\"\026'>\241\013OX\321\326\350)*\206\345\"\373\200\253\n< `\002)Vt\007I\201e\200\022\031 \367\326\016s\315\231q\203w\224\326\nt,`\332\r\303h\b\216 \210>\230\351WB\367\034;v1\003\267\005\372\2029\362,\270ea\335\002"
+	.ascii	"\31598c\343\360a\317\007\324\354\202\216\021\334\f\370\205\307"
+	.ascii	"\242D/\"\2422\324\256`\013\304\313\307\001|\361f\007\021\013"
+	.ascii	"\035\216\206\343J\200\261\327e\016\255\313^\031]\013\206;\227"
+	.ascii	"1\264\255\353\350\346\031\303\374v\005\204V\224!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`A\003-\n"
+	.string	"\"\314\"&\220)\031\016\273\377\270\324\201\222\264\352\266\271\273\253\263\265\334\241[\365?\336\271t\273\013\214\026z\013\362%![&\031\333\266$\231\241\34460dk\310Ka~]8\234V&\260\005\034\020Q\314\242*@B\307\241\343\244\237E\033:~(\013\207\330\302\211\252VQ\366A\350\314\302o'\3761\243f\272\231rF}B\237\001\177;N\034yC\371\320%>\342t\243\337(_\303\215CU#\317F\2367\0220\315T\360\2342d!Q\250\321\265\271\261Ia\245\355`\")\225\326\001\022 C)\001\207\364\0203\002&0\021\321\204\t\314\357V\003A\240\350b\207"
+	.string	"1dGSp\326\2208N+' \270'\232\350G&\210&w\364<\374//\344\nz\033,\272"
+	.ascii	"(4\214r\335\247;\261\266\346\206\274\267\250\214#b\244\344L\326"
+	.ascii	"\344\273\263\ba\246\233y\255Cn\260\2367\034\354\221k=\334\322"
+	.ascii	"\342C\227&S\307BnR\223\027\003\226e\253\357\263K0\357\026\254"
+	.ascii	"ccp\347\336\253\276%\220\022\030\370\331\341 \242v\030\232,\255"
+	.ascii	"\234\266$\261\350\\\374\020_\021\217\307\273h\241\324\244\322"
+	.ascii	"o\211\325\200<"
+	.text
+	.section	.gnu.lto_.pureconst.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\231\004\002\231\004\005\200\004\006\205\004\007\271\004\t\204"
+	.ascii	"\004\n\271\004\013\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375 \232\325\002"
+	.string	"\222\304\f\025\260'\035\fs\204a\030\206\341G\335\360Ad\026\227\005\233d\n\252Z|\036\241\352\260\256\236\363<%O\320!;\263;\006\256\3229\315\323x\301\262\244\022\017"
+	.ascii	"\0208\b7P,2\223\315\316\bTF1\355P,\2239\016%\334\315@w\222`3"
+	.ascii	"j\314\3606\320\006"
+	.text
+	.section	.gnu.lto_.lto.39fa2216aad60a76,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.11.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375 \310=\005"
+	.string	"b\t#*\200k:\300\2347\\t\bx\242!q\261;\335\246\020\377\330^\376\033z{\037\2330\023\252\262\002|cH\220\022#\033\367N)\246\246\213\326\254\252\026\016\253\201Qjb\026\343\232T}\314\311`\232UuB(\255S\372\366\322+D\244\304\376\266(-\366\001+=;&B\240\210\020\356R\302\321~\002\036\215\355K\326l\320?\314\236\223\231t\300\335\235\362r\355Q\363\277\371\200\353\266G\201bw\035\271\256r\313\333>\330F\330\266\002\t"
+	.ascii	"\252\244\233iq\316\f\001_\356\032\236\026\302x\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.12.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\025\n"
+	.string	"\306\222E=@\247j8\300\351\261\315\371\355\341{)\223\226\233\275lgG\334[\001\n\003\323\2711\002\343\220\204\230\234q\206g\277\261\025\323\342\303\360\377\303|\377\300\272BB\007\264k${o)S\n0"
+	.string	"5"
+	.string	"4"
+	.string	";z*\362\360\233f\350\213\276U0\273\2533YL&@\364\270\036\210\245-aw\337z\236DRf\005\263\273N\223\330qs\267\035a{\301v\202?\007\013\344\3035\312\232=\212RU\366\267\325\224\355tf\372\333C\tm\206@`\027U[\260\006\270\001$\266C\266\305\f\r!\207\037GP\017\t\260\001\200\266\001\306\214\224\264\251*wW\244\253\177\272+E\n\202R*\260\375\035\345c\260[r\360O\356\002\351L\306Z\2353FF\305\344"
+	.string	"mwt\3239_\243;w}+\316\\8\037\350\321h$,6\025\235/\343u6\023\034/\003\202\274\213\202?\217\006\364.\276\017\364,\343~[M\271\213\025x\301\362\017\273\267\016\021\203\275`\352\207]\352I\003\017"
+	.ascii	"\252\322Ea:8\314A\314\0267v\204\321\305\306\002\025l_ff\025\027"
+	.ascii	"F\030\314H\033,\217k\016U\032\266\266\350\001"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.13.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`\302\004\225\037"
+	.string	"\006\371\307H\200\234Q:\033\016\356\355\003\344v\002\021\tn\257K\370\321\213\331\"*\324j\"\022\032b\002bpq\265/\240\256\273\213\336\251\016\0036\023E\030\002\222{\210\217\344R\261\330D\037\224\001\357-\376\306j\2374\262\211\334I\006\265"
+	.string	"\252"
+	.string	"\266"
+	.ascii	"L\236\362\215\217|\223\245w\2650\357\024\362Ju\250B2@o\031\211"
+	.ascii	"~\353K\226\316\245\304\023\"o\024\204*\345\026\202[V\200\336"
+	.ascii	"\346.\340\274\255\007p\336\362\002\006K\314t\244\017\343w\204"
+	.ascii	"):Q\336\213\354u\017\266\225\351\266\032J;\255\331\225\211\337"
+	.ascii	"t\033\206,([stHQ\275\366\364\004\310\330I\307\244\f\231q\264"
+	.ascii	"L\324\024\rw,\336\216\303z\232\021\262\3200\336\3535\306\221"
+	.ascii	"h\326\2542\263\247\037@$\312F\265\266\343\214\233\027R\275M\001"
+	.ascii	"F O\270\243\223y\240\315\2258O_\241\216\303Zi\022\356\275\\\237"
+	.ascii	"\216R\347\333\231\031\311\314F\314&2\"\352\237\200\032\005\223"
+	.ascii	";\247\r\261\233\214jx\3012\373\212\177L\202\305E\367\025\327"
+	.ascii	"}\347\233D\252\306\251\322a\346\021\207\342C\357u2\342?\371\027"
+	.ascii	"R\233\301Q"
+	.string	"j\335\262\211\037m\310\233#\367\n\377t\313?q\336\276o\030\265\252\226p\t\353\222\031\331T\373\212\371\267\262\241\003\006\267\0253W.\342\021\355\206\204\202\200\270\262\356'g+\373\324*\343\320\312=he\236\263\362\315V\266\241\225k\264\312\350\271\316gW\266ge\363]\347\266\225\253Y\371\0048\340P\232\355\226\367\032\227u\356\030\013\026\344\\\177\327+\363\231\357\305K\374\265\016j\336O\327\372\305;B\264\373lJ\0242\036\\\320\276b\273\223\021$\025s\252t:\214\352I\034\232X\205\002d_\016\306\202\001\262{o\203\333\260{\317a\347\255\355`*\306\354\\\333\276\035b\221a]rm\263\355\231\223\341\330\327\235f\223C\310\234\263\257\370^?B3UL\242A\255,~\231@\375\323P\367\372\0044T\305$*\324O\2573\357\365.?\232\361\314\226sa6\347m\256\2412\234\265\203i\331\205c\311"
+	.string	"\026B\003\372\r\347m\355,\243\322\274\367^\033\240\326{8\371\311\337\003#\216\252->\225W\371\300\365w\336\366ry\326r2\203\bI\367\005}\315\276\004)\200\301$$$\021&~%T"
+	.ascii	"}=\025\277\021)z\276\340\212^\202\"\006&!\005{,\200\300`\357"
+	.ascii	"\306\367m\3056\027H\212\311ZQ?\375\221\2315_\311\3463\235:\326"
+	.ascii	"u\355\241\315\376\364\331Pl\332\\wC1;0^\351$\352\242\306\220"
+	.ascii	"\225,\202\3714\277\354j\224\370Z|D\241Rx:\303\265OW8\305;\037"
+	.ascii	"\373\021\221\245\3415\256Y`\311!\0329\200\263\233\3278\254\261"
+	.ascii	"]\367\020\ruO\033a\211\271\222w\357\032\367cI,2\274\225w\363"
+	.ascii	"\f\235\315\363\303MQ\027&\371\242v\353\\\013\365\305l}#ck\333"
+	.ascii	"E\005I\200\212v\256\003]\250a<\002\rR\310\021\t\204\002\2310"
+	.ascii	"m\206\003p\002\221\251\272z\021`IED\\h3+`\260 \033\307\240\021"
+	.ascii	"eG\023\356\323\017\214c\fy\274\322\223\310o\216l%\252\354\263"
+	.ascii	"\030\250i\246n-\302\004t\222\272\263\0348\362\353\321=7\301!"
+	.ascii	"?\300P\276\013\005\212mG\037OO\356P\244C\316\016\215\206\201"
+	.ascii	"\030\f\305\234\365c\\\177\270\001a\246\243\316S9}v\221\277\376"
+	.ascii	"\304\342\306\"\031\304x\035&N1C\326\210\342,\313\220\330\327"
+	.ascii	"\007\242\370\030\025\334\220\020]\351h\001\375(\213GoA.\005\336"
+	.ascii	"\246\336}\212P\031\333\\\330\252\255\214\360\336\235\244A\333"
+	.ascii	"h\270g\275y(\"\326\250\207@\355\005@\355\352\325\357\317Gn\255"
+	.ascii	"\213<K\r"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.14.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\342L/3`m\322\001\303\216\002rB\223m-\370\302\231\356\177=\333\373\216\271\340\233\265\326\303h\253-\264\030$\036A\220\260\2614\n\025Ai\367\376\351\335V\312\224\002\2360\032\3678\024\305\360\220q\330\270\251m2\r\2326=\210\2069\260\343P\257E8\367\332%\356U\224j"
+	.string	"\322\t\373#\217\320\367\260D'_}\371\035\366\225\032\200\001\312\222\035?\251\032\366-\253\"\333\351T\201\025\223\204\223\335\212\222\312\226,\222\017\333\036\373\342\207|\3441\314\310a\301H#\nR\312nl\003/`_y\002\366\245\033\207O\350_\344\026\220\016\224*\364y\002,\354\256\263\n]\334z\333\b\266\025lg\004\t"
+	.ascii	"\252\244\223iq\326\0311C(\256\211\267\0218\013\221\207\273bj"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_findRegistryEntry.15.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`\226\001\315\020"
+	.string	"\366\337rG\320\224M:Y\240V\031\310\240Rv\215\243\023\301\254\025\201\213+ \316bz>h\350\f\313\333G\367Anxo6\fk\013^G\332\264\327\330\325\t|\261Y\262\302D\b\204\2014\020$}:A\335\255\221M\244L)^"
+	.string	"X"
+	.string	"c"
+	.ascii	"N`\272\264\355\253\370\212\030\267PF\236\033\222\231\0304AGs"
+	.ascii	"\216\234\307\237h\227\246\233h\227\373\341\255\313l\265\345\313"
+	.ascii	"\\\252\370\020\205\342\206g\231\202!\221\006\200\023F$6qF7;\261"
+	.ascii	"\t\021\006\020\301\314\200\020\033F\016\273\326\210/\325\322"
+	.ascii	"\312\234\323\032\2127\267v\333\016l7\260_\024\273c?\233\253c"
+	.ascii	"K5\312\352\323\201\376\222Tk\377\3713\253u\325\3376\023<\016"
+	.ascii	"\374\230\323&v"
+	.string	"d\026\311\033\"\374\240\013\301\334\205\267\033\037Gs\316\r\306\336.o\307\330\233\355\035\337\"\346@\030\264d\202/\020\fL\227%z\023M\377\323B)\231 ,\2541\347\210 9H\331\356\030\265\245=\354\002\206\224\360@\244G\220\001\261\2534mQ\213R\204\006\347\2451_\310,\237A\3014'\270\300\227a\241\305\357ii\227\332^\350\212\003\003\222\304\342\307\2451\3051c3b=\304:\341\2313\303C\377\305ax\331{.]\201\245=\274\364Y\032\016\007\024\260\035\240\"\331\343K\003\236\220\242\3728\325g\342\242\3726B\367\222\352\276\013\235\311\251\224\026o\365u\335\003\025\213\004\027/\305\271\260@h\341R+\026\227R\300\336\327\255\270\027\317[q\333\350\372\352\370\323\321!;\235rr\030m\266\2725\266u\275\342\332\227$\321\257\235\352\364\341i\t\200+\343\322~U|\210h\222\\\032\333\024\032\002\035"
+	.ascii	"Le\206\252\314l\260\315\351H^\204[5+\214\332\334\311\344\020"
+	.ascii	"#T\t\026/\022\"\300\301#L\340\017\373\273\031\230Y6\271\206\013"
+	.ascii	"\310\006\264C\350\240\"\355*\026\020>\323\321F8\002\312^\361"
+	.ascii	"\223\017\201\313\305\352~\2265\241"
+	.text
+	.section	.gnu.lto_loadEEPROM.16.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`\220\t\3656"
+	.ascii	"\232ap\025F`\336Q:+\313\240\021\301\373\205=\021+\314\342\277"
+	.ascii	"3\317=,\372D\323\311\374\020\242\357\337\371\246\021\231\264"
+	.ascii	"\360\2023\001U\306+\370\023\212\r\246H\251L\002\244\265ru\374"
+	.ascii	"b\027\246\362B\027\360\277\344\023B\344N;M\0014\001E\001TQ\001"
+	.ascii	"bY\314\310.\\\271\364\306\3230\031\227\312\351\252=\345\252\357"
+	.ascii	"\373Bp\317\032\327\007\333(\215\277K'o\307SNu\301\315~v\343h"
+	.ascii	"6\326\027H\364\335\022!\006g\366t\026'p\317\342\350\205\355Y"
+	.ascii	"\367\301\366\254\202\0067\260\362Q\260\254?\3270\261"
+	.string	"\314\275o\024\331I\202-\224 lq\240\004a\243~\215\036\367p\257\312\017\217\204F\301\"\"\340oH(\310\327\343\271H\273\226];+\361\245mR\352\232\026\325\207N~\264:y\265\365\020\26692\347P\247\223,|s\2125\311FL\246Jr0\354EH\266\302N4=\201->R\352\332\023\036\007\356&\030\331\002\373\217\310\207\240N\"\253\361}\3377\247W\026R2\262\325\365\240\365\030\007\212\220\2779\273\326`\020\2668\207:\271\262o\335\341\310\022\373\233s\310\372\200\256\032\346kAr\357H\266\204\234\227\301\356\276J\310\221\326\245&T\330\212a\322\306\016u\222\345\335\352T\005\263\347oN \2530K\254\351\323b\346v\311\342XW\tc|d}\355y\207\326\325\232\303\342\354|z%\250sI\356\236\026\217\347\335\204\367}qnjm\035\0038\306\331\305\030{\300\330u\nV\271\016\277\273wF"
+	.string	"YQ\247\201t"
+	.ascii	"\352\252[\373\211\277v\013\324%L/@\005E\371Y>\246\304\024\037"
+	.ascii	"2\3740\0273\002\223(\261\203\356\231{\337\2527\317\346c:\355"
+	.ascii	"Y\245\001\006\204dl\002\212\007\3253\367\276\3137\211\001Z\216"
+	.ascii	"9\315OOj,\274\002\001\364\247\267\360\214cz\311\277\262\0356"
+	.ascii	"V\262}OI\343\2562\035\3068\352\\\222\356\373^9\300gS\232\245"
+	.ascii	"p\231\234\305W\321\236}\207\375x\343u\206V\225\353\232\213)\306"
+	.ascii	"\254\373\211q\224*?q\251b\301\375\205q\003\234\361\002\005\t"
+	.ascii	"\220\007\256\345\370\350\324f\334\304\264\313x\351h\307J\306"
+	.ascii	"\001\002\212\217\036\023\003$\001@\032\3662>\352e,\354el\304"
+	.ascii	"f\034\\3.\302\031\023\3612\006\3562\376\271\031\017\271\031\013"
+	.ascii	"\255\031\007\3552\366\265\031\367v\031\363\326\214\3356\343"
+	.string	"\366i\307l\316xe3\356\253\035\3475\343;(\302yq=\341\232\032}\263\352\376\274l\3300N\256\345G\373\243\177\332\257v\214\237\005\177\r\373\264\320\250\341\244\312\301={\214o\340W\271\225c\371\024\373\256\2464\006A\007\032\257>\246\026\320X\370\312\226\250oD*G \373\372\327\300>6\306J)\312\262\374&Q\203(\302l*\214O\207\205\222\312\347(\317\316\002{\205\323\3641\324\277\316d~uuut\227j\205z\250[@K\257\240\026\352\307%\203\232\201\022\264^\373Zh\005g\032\250JY\345\324\017\275n3\256\252\327\231\020\2343\365\201\265Z6\005\3369\223#h\355\025\233\211\251\233\270\252\370\236\226\360\0224^\221\210]l\254c\027\373w\244mW\231\356\353\333\364`[\354\004\37512\352rl@.6\306\024*\3447\261Q\227!l\256\232*O\315\340p\362\372\371L\346\204c\272\177"
+	.string	"FWE\352/\032\355\261\211\\aR9b\3465\2611\306\220!\277yl#\216\246\302n\363:\2731\003Uix\033\016n\013I\323\312p\237-O\216\354\212mS\177\355\356\035i\334\213m\333M\2153\023\b\306\035\356\366\241\355\343\217?^gh\271Z\366\306\247\355'f\213?\352H\335\2562]\016Tf\306\203\305i@\024"
+	.string	"+s4!\f\200\275\357\373\300\314\317\3447K\264g\363\373\036\253i\031\3225\335J\275v&\263\034\013)\222S\375\342E2**\306\213\035\214\0261\244(\234H\236\200\222Z\341K\221\364"
+	.string	"cF\262\305\316\305q\024\002\026RS.\222I\023)T\240h!\025\205l\241\002\212\0052j\352\005\022\301\022\226r\221\234B\302\220\222\232B\372\242\357\373\013\347\243\247g\341\361KxA\033\253\332\n/\365\202~;\354\347\312\004\204n\316Q\177\341\2436\352C\245qM\307m\255\260\217\372\3136\374?P\021\340\374\230\350\003e"
+	.string	"nN\330;.\313(V\271\016\263m\324\253\2330\316\334\021a?\361\353<\367\261\213j\324\317\003M\242\006\215\327\"\2476\356\201r\337w\231\347z\224OV%\024\250\366M\250\366\254\261?=\017\332:\310\232\224\t\262\304\306+\261\235\222\032\263I\215\327\244f\033\013\367\2601;l\274\256\303\316\215\205\217\243TE\306n\320\3772\245\216\361\323_G\027\267\314F\356L\213\350'\200\330\003\032+\320\017\331\330M\352"
+	.string	"\215\205\177H\215Ww\330"
+	.string	"\202\255\324\n\372n\313\261\242\016\332I\026\365\261\013l\016\330\317\rI\272\230^\206^\347x\025\0326\322\361I\215\354\366\"u\243\346e\365\353'\261\307\031\331P\177\361\330\340\331\021\200\265\250a(\244\020sF\031\"\021\021iA\324\030p\002\021\252\272n\022 \247-\242\224\220\220\244\344\376\035*Iy\360\023\363\027\032\2229\327\204"
+	.string	"\034\bn\300e\200\303\255`\316\242\277\252\227}\336\020\025\260i\253\256-K\204c\030\005\354$Z`A\252\002\344\024'\r\374}\240\237l$F\377&\321\354\345Yr\230%\273,@{\005\345\274\202\235\204G\304\034\340:\007\314\265]\340\374\257l\f\2377\343\b\317\214/\f\221\335\b\263x\253+@\344\3313\220\360\031\330`\365\314\240@'\231\340\374\217\204P\bM\370V\216\261r\242\330\327\311\242J\345'X=\340\360\005\307c\330\2625\331\330\270o\225i\305\213\210\005tc\205\366\340\242u\317\217|\211"
+	.string	"$\273\361\022\036\251\236\313\013h\225\325\226\025_6\3570RHE\277\200v!`\275dg\256a\3413\013RG\2773\2112\351#+\b\r\254\327z\324)\273\304&\245N-\t\333t\372m\004\333dk\307\343\346\263\220\243\2411\2748^B8\037\311\265O\200 \360\352\325J\317X\311\306\220T@d\375\332Q\312d\221\262\323\244U\335F\002Re(D\205y\265\356C9"
+	.ascii	"#\344#\2407\320\005\263\357=1\316\345\271\t\374\b`\316\313:H"
+	.ascii	"y\350\033\315BcVKh9\247\375\231N\226A\257\241\223\316\235\033"
+	.ascii	"\363\332\003\273\361\347v\202\037"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.17.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`\034\b\315."
+	.string	"*S4\022F`\\N:\233I\277i^E`u\230\324\n\310\304\216e1\024\255\312\244\252\240\347\376\321\0054<\033\207\341\365yZ]\350\267\330\356\245Y\203\345+\004L:#\326\330<\275\261z\034\330\200\246\315J,!d\357$\003\f\001"
+	.ascii	"\001\023\001}/\247\353\006\366\361s\355\203D\316\225\23430\256"
+	.ascii	"\017m`\230\213\321\272\334\0136\223\215X\232\241b\257FX\357\326"
+	.ascii	"\007\363\345oZ\207\243\362\371\272\253\233r\262\027Z\217\335"
+	.ascii	"\300\253\270[\253o\366-\177\236\313"
+	.string	"\325\336\326\300\265w\321:\033\214\347.\260\020wM\026\354\325\233\213.\264\246]\261\231\214\365Z\266\345\345\f\226\002-\213\315p\354RmL^\316N\023g2\212\266\2022\3272\017Y\316`#\336\274\026\255;g\024%\235\031\f\305\032\035\234\023{5\350\004\326\253\367B\353\325\227\321(\332r\346/\f]\234e\017\256\266\022{\265%P\320\352\366\316\261\257\337\262l\311e/g\347\0203\351\225\212\230[\033*bnwO\235\357\364\266WS|\333~\333\215\320\274(\357\330\302\266\256\246\277\032_Q\202a5\322&\276\2748\2570\345M\247\3608>\230\3370q\236wla<~\177\032r\316}\231a:\336\353\273;\331\335\313n\366\027\030\350\315\n\203{\337bY\357v\2656\313\222\233\326\254\325r\337\246\330u\341\255~s\003K'y\243\t\326\356\016W\363\320D\365\311f\217\016\202{s~\313\255\307 B"
+	.string	"\213t}M\t\342X\316\3113\373i\256FD\377\311\325&Q\342\236Yb\275zl\241m\331\227\274\321.p\357\3666\023,\263\373D\212{f\017\270\223\207'\217\013ou;\225\027+\351~\323\030_^\343$\335\301\333O\301\333N\301\333M\301\333L\304%%\b\301\333\016\004\334Fz\331\333\210\350@\360\366\320\341\336AG{\013\205\267\203\301\333@\301\333?\301\333@\341m"
+	.string	"\302\333>\302\333\254\360\366/\300\3555\300m5\350v*\274\215\203\267/\320\355W\370\016\262\2759\025\360r\376\212\352\311vj\234\224\313\375p\177\331\357\374\317~\264?\355g;\333\375\276\231\237\221\372\\\377\224t\256H\221y\335\324\347Z}\342\355Mu;\322n{0[\037\353\325 \374\263\344Y\206\353\362=\3159\347\024\351Bk\020&\342\203\371\007=34]U^\2449\037\311\220w\226\342\025\377\226\224\360\017\177\217\327\212\201H\364`i\246X\305\237\233\320\255\330]\266A\330'WU\234\364\246\371\204S,\241\031=\272Wy\nX\t\027\t1\306\030\232w\226}\f\356:wh+\2048\367\363Vg\227\200\310\241HF\016\365\340"
+	.ascii	"#\341/\373~\230\260\003\3743O\2470\2413SK\353kBrh\253\244\211"
+	.ascii	"\207\376H)\347y\307\246\227\264s&\334\204\207\352\324u\313\344"
+	.ascii	"|m\023&\374\272\033\3310\273\270\273urhV\023\255\314\360\230"
+	.ascii	"z\353\217\326'|\361\241\177\360\304S\336\245\rQ"
+	.string	"\336h+\210>ku\302O\330\200\334\362\207\222\256[(\2573\203\315\231\213\330\247\243\242\225\322\177B\265^u\302\247\273\221WS\t\307\254\231\274Q\2546W#\f\367\321=\336\207c8\032}\313\255\335-\225\326\312=\363@\355\"I\312j(e%\024\205<\026\215\310U\312\210\304H#\025\224\021\211u\305\"\215QPF\027k\021Y\304H#\326\361\330b-\";TAMEUy\220\232\342\020e\304B\032cTM\r\270\2722\026\213YW\277.&Q\035\221VF\343\n\251\251\026U\307\342\260j\n\212jXD^\r\223\026\364\321\312\210\034b\035\217\310!\320\231|\232\n1\004#\034\324a\305.\211\225=\303)\343\354*\r\006\333\203\007\261\021\376\236e\334\205\253lo\3343\203\370lv\344\013w\331\336\020b\307\205\267\266\264^\\qbv@\370\316\237\251\207\201\360e\263\0042\204\201\370\307g\311\003"
+	.ascii	"\036\302}\227}AN\204\201x\310KW\037\353\203\001\340w\351!\302"
+	.ascii	">\370v\326\320\fY\"\b\230\305\3045\265g\213#j\367\243\265\273"
+	.ascii	"\375\3723\253\211o{\203\347\236=\025+i& G|\267\333\260\326\207"
+	.ascii	"\217\2328{A\330\353\320\263z\2429\360\022~\333Y8y\242\334\003"
+	.ascii	"X\210\275\372\352h}"
+	.string	"\2609w\201\335\2606\200\236\250Q<\304\220RH\211\210\214\314h\232\326\200\002\021\252\252z\021\240\251t3\242\260I\245\260\354\006Nz\256R\360\367?\301\272+Q\306\233\356\027N\2706\271\315\024\003\3507csJ\244\025p\n6DnK\033\300\304\210\235\226\273\"R\034\210\017\372\351\300\333\217\301;z#\"YN\303\301\021E(\300\275)\334\362p\262\334\027h\231\233\0277\023\372O\231\t\351I@dk\020-\"\226\203X\332>\306}\2750\234\266\317\212\345\255\006v\346\370MJ/\206\300C\001*k\2261\227\373\322\222\203/T\304\252\371\241\300`\355\002\240\243\2215\236\313\003i\334\212iT^\225?\300\001\364\266E>\373;S\025-V\236'\323|\311\376r\177\022C\025\026\320\360\330\b\306\016\244%\315\230L\232\023F\212\216x\222;\206\366\377\201\250\252if\306\344\217\247j\036\237\034\021\275\3402\006"
+	.string	"R\224!\220\253\207\312\266\333\307o\0132\251\211Y+<"
+	.string	"\356"
+	.string	"t\022\3164\003 \301Xb$"
+	.ascii	"n\250\345}\253A\225Ai\222\315\221\251/4\331\254\347A8#\037@&"
+	.ascii	"dOX\"RC\342\312L\312\b^\332\035\324-\037\022\364K1j"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.18.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`a\002\375\023"
+	.string	"\306$\201H\320\360(\035\330\351\315\002\352<\276\342\235\275^\325\252\\\037`\017\030\205d\277\0310i1\0021mw\034\212\267\r\356'4\354/\254\t\200z\340\224z\030\rdg\202\205uK\020V,\325\003 \233+C\023B\310\2262\245o"
+	.string	"e"
+	.string	"i"
+	.string	"^\372\030b>\210\203\f\250i\316\211\332\035\357\345xK\205\275#\004?O\256\302|\217\232\370\016\003\037hn\036\312\021\233\213\032$\034\245\243\230\271Q\360\243&\323O\206\310\220\230\035\306\214\215\034\231\321\202\351\270\030\365\244\2009'\200\032\006\251\200V\213\251<Q\363}\356ZT\364\223$T\253\271\202'sN\353\254Fs{\334v\n\333'\266J\bsA\330'\220\373\334\341o7x\365w\265w\265\274z\257\326\253?"
+	.ascii	"A\r\333\006\036\333&\215Sf\207c\036yD%\356\363\337\256\366\355"
+	.ascii	"\253\360s_\361\021v\037\353D`\306Ys \304b6\b\357\211<\344\273"
+	.ascii	"'O\340\273\367\343\374a\023\006\260\337\\D\304q\312\230\0045"
+	.ascii	"\335\232\346\034I\356yAx\3170\007H4b\334\333\034\007\350\331"
+	.ascii	"S\204 \036\331\220\222<\\\232\345~\217;\004\236\016\262!=\320"
+	.ascii	"\301\245\271|r\037\310\200\321\033\336\2259d6\340\356z:\231\206"
+	.ascii	"\027\335Yo\335\027\256\256|!\353\211\351\356r\3169\245\023<\334"
+	.ascii	"\323\236Ih(\306\026\323\235\245\332\027Z\364\263\357s\177\006"
+	.ascii	"\"\335Ql\305\235s\212\2739\366(\352\003\257\225\225\352\365B"
+	.ascii	"\001].U*\305\342\002\235*Y\261Z+*\325\204\n)\024TX)\224J\n\312"
+	.ascii	"\n\225j\271P%\007\314ZQ\265P/\026\253\205\372\030\247\370\223"
+	.ascii	"\227\215\211\035\036\352}\365\331,\013\372\231\225\310\306\021"
+	.ascii	"\314\212f21\302(\374V\227\\\337\036\247\005t\306\035ps\354\355"
+	.ascii	"u~XZ\3643O\032y\210\255h\035\022\216\322'%\270 K\003:\310)'\""
+	.ascii	"6 p\002\031\303\362\252tB\303\320\250\230\rs\026\261\275b%j\255"
+	.ascii	"\214\320lr\257\314\250\272]\003-\367IE\330\202\264.\253\253 "
+	.ascii	"\305\2630\217nXY\0357x\257\214\345+X\216}\364B\323\375\315m\345"
+	.ascii	"9\366\340\226\214\327h\374\367\022\354\035m\235{\007\257\210"
+	.ascii	"\263+\272\004\227\313\035\243\356F\204\345\273z|\370\343\334"
+	.ascii	"\357\300\314\300\326Lr\375\336\351\200G^\302z\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\305\013"
+	.string	"FRF9@\257:\360s\330hn\262\275\271\363\024\353B\352\331\350z\271}/\006\357\226p}\354!g\030^\030\3030,\221D8,\256\003m\333\232\366\377\267\277\277\377QRV'\231R6"
+	.string	"7"
+	.string	"6"
+	.ascii	"\316\334\255\031\252fz"
+	.string	"\234\200E\234\236c\372M(v\224\336\222@\031\357k\260\270\331F\357q\260\001\031f\326\3340\0249\230\237\231Dl\200{\357\025}g2\363\204\t\316\362LWy\323\233l\337pQ\3346\354\013?Z=\250\360\241\204'!|\351\340?\006o*\370\223\352Q}\305\313\214\212!xQ\247\336[\215\330>\006\276\023xn\006\\\235ky'%\256\216:%\333CVd\264\216:\253\031$j\027\035u\260\344L\007In:8~\243Wr%\327\262c7\275\226\355 4\210Wgz\227]g\006L\313f\227\f\214\032\310:\205uI6\253\240\3265*\315&)\261\026\215\365T\373\275\367aZ\017\225=QX<^_uo\374T\257\244\370U\257a\363\213\210F,+ \340\002\231*\333<\021\235\262w\233\004\245\315\3354\204\276\004\237\340\001\301.8\241`n6w\337\3027B!\204\366K\255G\340\b\016\340"
+	.ascii	"\034\301\001\034\007\207\003\020\317\226^-\030\263'Z\2310\023"
+	.ascii	"\0220\021aP\276\277\316\033\021\2701\372\032\013n(7n\341\021"
+	.ascii	"7#V|\002"
+	.text
+	.section	.gnu.lto_.refs.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375 Y\355\001"
+	.string	"\322\204\f\021\240'\351\377\003Ly\021[\217h\204\220\274e\222)Z\314\026Z\202\266\314\304P\304\"\003D\002\266\304v\266\333\303PsH\301\354@\373~J+\265\020\002"
+	.ascii	"\376$\207\004\345\t"
+	.text
+	.section	.gnu.lto_.decls.39fa2216aad60a76,"e",@progbits
+	.string	"(\265/\375`\023\035\025\203"
+	.ascii	"\352\317\370-P0T\312I\007\n\355\227\226k\027\367O[=\334CH\212"
+	.ascii	"\365P\025\242\324\314\034\365\213)?x\345[l\351\034\177J\260\370"
+	.ascii	"\333\036x\215\256\275\013\324\256\355N\205\002\343[\360:\234"
+	.ascii	"s\334\024^\013\265\327)\030{'\323\341xI\217\240\232&[\312\024"
+	.ascii	"p\002\307\002\334\002gN\201_^~\232\232:07\240K\324\363\020\365"
+	.ascii	",\306\005\205\316J\365\324\325[\366h\324V2\273N\265\254\315{"
+	.ascii	"oO\033\341\367\005\257\323\363S=\227\255\314\266\005\211\022"
+	.ascii	"^+\333{c(C\250\004-\341\265\034f\211{\273\264@\253\260\036g\341"
+	.ascii	"+\234\307X8\312V8\356|\004Gi2\023\266\302M\330\215\357vlP\246"
+	.ascii	"\367\200\025\226\343;\276\253\332\271M'^\372\356\275????=??5"
+	.ascii	"M[wX9\351\372.'\222\234!\230u\351\273w\245\302x\034\345\273\367"
+	.ascii	"\254\367\376\201?\350\216\245\260\235]\177\334\3335f\300\231"
+	.ascii	"\223\246\251\300{\327\037\002~p\220\260\242\207chW\227c\304\372"
+	.ascii	"\345\327)O\231\251\262A\247\324\351\227s\034e\272\363\335\334"
+	.ascii	"{B\005$s\003|\027\233(<\270pP\177\203\332>3\300\251W\372\260"
+	.ascii	"^P\357Be'\334\306\321\025\374\344l\0043\271\f\322z\327\016\023"
+	.ascii	"\243\004\255\323\223\240\236W\fma!\257\030\376\003\265\231g\270"
+	.ascii	"\303&\206\317@}\005\352\317lk2\321\271?\273N\177^c\265\316\253"
+	.ascii	"sJ\352\224\223\360\031GQp\332\035\210\340\226yv\313\356]up\306"
+	.ascii	"\024\0313\330\351\203T\001\220n\004\037\252g\024C.d\024\303\267"
+	.ascii	"\272\303<\303\024\3143\344\262\025\326\351\364\274l\367\256%"
+	.ascii	"\324&\034\223\262N\277\262\211\241\312<\303\237\261\242.\240"
+	.ascii	"\335\346\357\270\345\331\317I~^\177\236\261\202\344U\370\007"
+	.ascii	"\263#MePF\\\024\301C\204\374|\301\317@\210\200j\360\367\217\033"
+	.ascii	">~\036\373\231\177\016B\354g\027=\376\027\332\026\034\366\363"
+	.ascii	"\327\211=\237\277\335~\226\241\343\212\004\354\265\363w\330\323"
+	.ascii	"\277\233\344\370\257\306\335l\361\374\337\027\303\177\027\377"
+	.ascii	"W\374\007\340\277\002>\240\370\033\355\377\227\237{`\255\237"
+	.ascii	"\300\371\033\311\371o#?g\375l\365s\215\237\243~\246\361\263\322"
+	.ascii	"\317@\374\254\303\317G?\037\177\266\341g\030"
+	.string	"?\277\370y\350g\241\237\211?\313\3603\f?\277\3603\013?;\3603\320\317$\374<\302\177-?\213\360\363\007\377\323\376?\371Y\203\2371\370\017\367\263\005?W\360\363\004??\360s\003?3\3603\315\377\265\237\323\377~\377\267\374\337\373_\366\237\201\377t\377i\n\013\013\013\177\033\344\267T~\001\222\001\314\245\233\304\344{g\254R\367&=i\250z\262\225%\251\213s\233HNI\\\317\233\031I\317\245\033$\007O9\243\\\317 7\265(\364&\255L\206^\275-)5\312d?\234hX\225\323:\264\3431\245\256\323'6O\262\224\b\321i+\251Y\222E\b\263N\237>5\333\323\263'\216E\242\252kK\022\355$\255\306g\227Y\243\304\246U\265\300\r\023\272/\255\366\367Y\2435s\210\bS\006\355\264\243A\3574\232\035mLU:\345\302\302{\331\304\260\357\265xHh\260\370a\261\311\231\035\301"
+	.ascii	",\353vZF\343w\226\344D\rn]\357]ud\304\270\n\301\024\371\273H"
+	.ascii	"\023\3519\273\314\234<\253&\262\300{\257\026h\2473\t\227 dDf"
+	.ascii	"\004\353\002\261\360^O=\t\363:\035r!7O\251\333\004\273\362\345"
+	.ascii	"\331\251\226\036K\306\304KJ\007\001b\323\205\007\026a\247MDs"
+	.ascii	"\006\355\b\260\035^?\032\252\323\345\225\204\217\366\301\266"
+	.ascii	"\346\320\350J\202F\247\267Tc`7Xp\250\271u\332`\274\244\273\234"
+	.ascii	"\0041\005:8\365\270\034\232{\267\352\240\334\344q9\315\365\200"
+	.ascii	"6\2529\262\035\035\326=\372\253y\264\030G\033\254\275\316f\255"
+	.ascii	"\243\254\301\232FC9`G5\027\3305\300Z\210\316\312i\356\334\346"
+	.ascii	"\030\235\232c\365\361\225\223\366\265M\265s\364\026GO\327\\O"
+	.ascii	"i\200\0212EP=\020|\272\341\020}\203\357\330Z\0241\327Ym\325X"
+	.ascii	"S*H\241\232\013\274\367>[\213\243\235\365t\2757J@NZ\023\263\266"
+	.ascii	"a\372\306z\024\207\017\312*\326i\343\bz_]\020\326UD\247\266\341"
+	.ascii	"\324\246j\033\034\365\351\252\267\024\017\236\246\271\336\250"
+	.ascii	"M\034\023\037\235\017\365\3543\324a\237\341[L}\353P\177\327\\"
+	.ascii	"\352[KM\231g\330P\335O\035\365\206j\247\233\346\332P\351\275"
+	.ascii	"H\314*r\230U\310\304\211!\241\r\323\367\r\365-\325\324LD\216"
+	.ascii	"t\251\353\324\311\321fz/5S\317\270\352\303\271z\372\362\222\246"
+	.ascii	"\255\244\376\255T\230N\375\300\262\013#\310jv\205\316\254q=5"
+	.ascii	"a\267%4g\337`!\023\356\334\244\274&(\340\037T\310Ip\240]\241"
+	.ascii	" pE\365\025\332(T\235\221\307\324\327\314n6R\337N\342(\027\236"
+	.ascii	"\305\360\030\006l\016\307\364\314\314n\322!\363\f\305\250)\030"
+	.ascii	"\214\352\303\201W\243\341\336\001h\350\234\324u\235\301\360\f"
+	.ascii	"\245\252V\235\232/8\253-\177j\003l\342\317\017O\307\021k\235"
+	.ascii	"~a$8\312~\347>^\257s\345c\265\034{oV\030h\004\177\020\373q\027"
+	.ascii	"V\313a\2567\312\002A\250\267\236\237\237\231G:\2656\356\205\363"
+	.ascii	"\346\272\254:\265T\217\233\241\263\343\322\232q\232\232\2625"
+	.ascii	"z\2366\313S\023\031\231\316\327[\322_\020\2675\270M/\n\006nF"
+	.ascii	"\312\363\211\252\323\3174\355\223}\262QZ\24035\250\244\006-\324"
+	.ascii	"m\024_M\030\271&\247\227\245%K\243\347i\271l\241\232\343\253"
+	.ascii	">.\254\246[\0323\254\214\215\351\3242\265\237]\203\022\025\322"
+	.ascii	"\251uv\227\212\303j)*.\035\302\315H\235\024\313\264L\2534\\{"
+	.ascii	"&!\025(\023X\230\247\3036o\225\006\261\230:\265I\354&\023\325"
+	.ascii	"\232\023\354\324\"\335\313\262IVD,L\230.\344\002\035\376\335"
+	.ascii	"\036gc\336\2058zK\372\264:m1\355\247\003\245%\214\257\323\026"
+	.ascii	"l\302\033,`\214\330k\302\036\264MG\376\332\326\262\233\250\250"
+	.ascii	"\260g\257vQ\204\2026\300\200i\300\333\346\315\352\002\245\201"
+	.ascii	":\262D\245\323\017\231}\357k\300\236\247\335\363B5\247\223\205"
+	.ascii	"\211\367\367\367\006\214S\023\213\322l\277\206\253\243\361\344"
+	.ascii	"\207D\315\335\024"
+	.string	"s\254\354\342\234\rr\335/\355\245B\3611VcO\345\302\245\371\370\354F\331x\215i\362\031.!r\347\327\345\315\227j]a\355\310\333\333\353:U\t\226J\225\344\213\020mzz-\347E\005\352-\320\022\006\321\244.z\345Jc\031\246\225A\275\005\352\tJ!\353\024\013\273\325\204%\231\221\003\232\027\355<v\353\365J\2510Ej]\3402Zxx-\307U\327\346\331A\275\221\321\274)\035\371\352\3642N*TZ.\004.%U>:8ld!\3427eJ\3271\332\330\225\317\260\nZdK\247\034\355\272\363\311T\t2\266Don\356\006\316\023\261\263\025J\224(-7\263Tv\300\267\034\024\315\017 \\Nf\352\273I;y\267\275\255\343\324{\257\216\022\023\250\267\300[%\345\3637\224w\\\303Y'\225\335]\247\375\244\341\352\252\254\240\301\2751\201!\321\247e\275I\310\221\301u\352\306q\377s"
+	.ascii	"\327\266h1\224\241 \222!\214\364P\337\377\360\336 d\326+\225"
+	.ascii	"t3d\031f\237\037\207"
+	.string	"-\037\360?\275\366\177Oq\275\3144.\177*\2206$\034)\356\357eJ9\243[\314\022\316(\322u\246\335M\225p\2567\307"
+	.string	"7\332u\235\353\223\231>\231}\327\333\334\232\272\315'3\351\\\257\324]\237\314\235\333\234\332q\256HLgtk\212\235\321\347T\211\333\274\314\333D\312\2416\237S\316)\317\251\035g\024i\312\331\334\232\342\273>/\343\301\255[\314\0317\212\204s\357uZ\241\314\233{\221\244.\263J?\335\255\276\247\233u\371\256\310\332u\357\275\227\311\246\307\365\244Y\223\356\2353\310\023\306\214{\365\356\023\004L\016G\244\321HYl\241(ICT\026\227H\344\007'\024%\355a\260\220Q\\\032\361`\004dT\022\235\260!\022B\226P\224\034\316\004p\030,\206\224C@G\244\f\031\310\241\236\342R\210(yD\\.\215CCD\t\202\206\224C"
+	.ascii	"\034\3050\001\303\310x4\276\020\200\350h\374\240(9\344!\022B"
+	.ascii	"\306\250)\026\361\024{0\256\260ST\036-\207\216\224\313\025\004"
+	.ascii	" 2\306\020j\301\310\030\300\322x4\326,\225BK#\036\023PP!\205"
+	.ascii	"\026-\220.\214\212\216\306\345\262\270BqiT\352`\202\007\345\362"
+	.ascii	"\330\202\350h|Q\342CFe\361X,R\017\201\004\fH@\301\0163Eb\221"
+	.ascii	"\biBQy\024\303(\364\002\3470X\224\340B\204\025\200\226\305\""
+	.ascii	"\245\3202\205\320R\310\203\232%\321\201\007\226D\307\242\222"
+	.ascii	"X\224$\022K,\211DJ\344PQ\205%QY$\022*\206\220cTbIT.\2234\207"
+	.ascii	"\301\"\201\032xI,&y0\306\020\"\022\225E\031BE\345\322\210\210"
+	.ascii	"\200\016\254,\276xqT\303p)\324Je\321\306@\"9 \312 c\034\217T"
+	.ascii	"%r)t4\312P\026\22759\314\030\025\t\305x!S\224\354\037@T\274a"
+	.ascii	"H(9<\"\215F\312b\013\035\360\024k \016\031\213\204d\250\313\303"
+	.ascii	"`Q\224\004*J\362\034\231,*\201\226H\244\022\310f\350x\364\301"
+	.ascii	"\262hds|\321\313\242QQ)cD\344A\27142\026\025U(J\336,\211\307"
+	.ascii	"\242\244\314\261(i\227D\t\202\324b\017F\243\324\310\250\250$"
+	.ascii	"\"\022\232\341!\211\034J\227D\n\226G\343\321\314\203\202:H\301"
+	.ascii	"\302\t \250C,d \225\311b\221Xd|qD\016\001\035\215B2\200\206\224"
+	.ascii	"F@,T(\227I\233f\263d\266T1\362#\332r\034 \341\344\205\006\230"
+	.ascii	"6\t\267\224\316\232\t\r4\252\311\021I\200\250osBt\255D\206wp"
+	.ascii	"Z\234\220\330 8Q\206\314\3003\353\302\032\035xa<\216\320\020"
+	.ascii	"3xv\244\313l\024\315\026\0273,22[\004\215\224\324\275U\027\330"
+	.ascii	"\r\366\025\271-B\r\347\007\322\016/G\250=5k_\253\021B\204\020"
+	.ascii	"Bg\332T\365"
+	.string	"F\230\024,KD\317M\331U\226\273\2529\303!=\226\334\240\326\212NJ\037\\\247\353\314[\224/Pv\314\326\350\"\013\"\306\212\305\001az\351u\017\033\006\347\026\267\325i\017\332\271'L>:\265;,\020\204\367\"\331\035myX\260\333\035gV\301\254BgF\217\314\2114\374j>;)\245\264N-\227\345\262^\"0\223\202Md\266\353\326\313J\261Z\"\242L\375\355\226\333\320\206\322 \023\233\303*A\211\266\255\366\251\326\204k\332\350\364\352\312f1\271\023\034S\200\023\224\r\3536\313&JZ\324Y/\261Y\246z\030\2511\304\020\326\212\277\234Md\033,%\271qk\365\364\002\245\353\324V5\234\330\0374\202\200\250\"\3618G\362\244BH\225\214H\322$\255\001\262\n\020\004\343h\244\351\235\007\022 5A\023*\307D\206$I\2411\025\001\f\034\344\301\361\254\216E\364,1hb\210\006\300\234"
+	.string	"\025R\375\n\354\244+\203\255\305;{X(v\340$D\311M\275@\321^@\377:"
+	.string	"\334\245\242\341\330qF\t \376\346\r\370\031uD\302\030\243\230\366i\366\317c\322\244\345\322"
+	.ascii	"\331\270\025\\ \027\345+\307\224\036\033\013.\363\272}\252:\260"
+	.ascii	"\237\267$\353\226V8,&\205>\2059{\030\004\377)\035\032\035U\301"
+	.ascii	"\301\226H\320\315\376\241\r\261F\321\363\220[k\354:\274\251\313"
+	.ascii	"\365\333\243w\265\201\211\022(\351\204\345\214\242\206\221L\024"
+	.ascii	"\334\301p\376\343\322\003\n\260a\217\257\200\013l\330\344\324"
+	.ascii	"\206f\013\325\307\375\211\265\206\212\336\230\037U\t'U(\203\371"
+	.ascii	"t\332\217\323\277m\314\225\333T\251d\265*\372\331\021\332\006"
+	.ascii	"Z\331\221\025\305\177\204\310\325\005gL\301\253\375\022a\030"
+	.ascii	"\235\235\033\376ym\257F\336\0229?\312Lb\355\361\321m\365\f\222"
+	.ascii	"\\\345C\251\251\247\374#\257J_\213\fgI`\273\214\340\\\330\242"
+	.ascii	"\263\323\302\302\310$c\213\247\322\007X\342\351\376\226\026L"
+	.ascii	"\211\322\026\n\024<\213BI\t,Y\360\\CEC\304T,7^BZ\363\200\026"
+	.ascii	"\002\343\264@\307\376\347\334\203S\035\r<\230\362rR\222@e}\f"
+	.ascii	"W<\264\216m\205\375\254aE \345Of\357\2454\025\207]\324a\210E"
+	.ascii	"\200}2\247\220\222\006\006\314]\020\317r\260\335\211\315i\337"
+	.ascii	"\275\263'\004\222\370\352\023V\232\237\0210\\\034ou\323\260E"
+	.ascii	"\371\266\377\315#\200\272\336\326\251\375\ro\360\035K\236\214"
+	.ascii	"`\217\236\215\236y\004\r\212;\007\320t\366c\307\r\261\017\366"
+	.ascii	"#\235\323f\357,kF\335\353D\345>\213t\305\tK\310f\226\311n\340"
+	.ascii	"\207\340\213\013l\006&\247\300m,\177\022?\255\232\342\265\272"
+	.ascii	")or\272\326=\301\242\b\007t\f\303\250\273-\234\316\177 \264\330"
+	.ascii	"\216\363\\8\2006\253\246\004J\327>+\357\237\267\007R\224\003"
+	.ascii	"K\323\312\341B\305\035P\202\305\234\007[\362\325?\254^/\257T"
+	.ascii	"\263E\220j\305\310\214ML'\255\216\002\225k\020\362\363\2150\342"
+	.ascii	"\300\345*\312zmT\330?Tz\355\236\340\260\314j\241\253wU\242\337"
+	.ascii	"5"
+	.string	"\335\363\251\273\205w\306\2258\002=Yi\276\236\f\333,\337\272\\f $_\326YA&M\004\326\321$\0252\241\306\307h\304\273\316.s\241\333\337\241\360v\244\005\262\300>D\024\"\202! \260\257\252\326\262C:\235\201\210\203\2749Gz\310\221\340a\264\326\030\327\311\f\357/S+\242\206]'[\214\365\f\325\273<\003A\n\024\036\b,\230\303Z\343\360\354v\254\202\266A\2711\0031\2144\362z\t,-\300\f\007\373\317>\311`\301\024\206\021\270\241\320\b\214E\203\206dJ\273Rg\351\312x\246\224\022m@dId\320\025G\024S/\027\352\243\207\025\354\001\013\360\371\f\336\377\203\343\347Q\234_\004\2206\204\237\037S\233\246\n$;\247E\354\235\337Hz\215YA\374\251\026\336z\036\251\244b\243@\331z\302\036M\273\026\236\216\232\t\333\353\004\032\2019\217\n\261S\322m\363/\206\033\273\220\347\243"
+	.ascii	"&q\200\335\377\300\252\257C\312\034\302\367,\211X8\002)`!\223"
+	.ascii	"\331\001.y\252\017\373\016-\020(\337\307\236,\372\n\305\f\227"
+	.ascii	"\317j*\230\037\375\271\200\"o\226\203\027\236u\345\310?\301\r"
+	.ascii	"\354\262Q\026-\024\315\032\251\037\372\273.\371\2262H_\005\371"
+	.ascii	"\352\206\200\t\374\332,\273\277\\\2258\325\200\354\002s\302W"
+	.ascii	"\354n\221L\273\337h\314\322\340\325\301\232\003r\211\022\361"
+	.ascii	"\343/\020\306e\210\004\340\2708\222\263\373\356&\252\300\213"
+	.ascii	"i\203\230\2543\315W4\313\032c8"
+	.ascii	"\270\020\276\202I\247\001\220\243\036\315\226NH\370Pm\032\202"
+	.ascii	"\364U!\357D\372\030\034Y\360\021\363\367d\306\251\333\265\310"
+	.ascii	"\206\253\220\353\246\037\256\347\342\337\370s\215\273\303\317"
+	.ascii	"\327\313\320\323\007\330^\034+8\363=\236X\360u9{d\376\303\356"
+	.ascii	"%\231\023*[\372\261\227h\3651\344\316\003U\rE\237\300\016d\027"
+	.ascii	"\032\2570>Fv\313\030\350\251\321\265m\225\003\016G\213\227\351"
+	.ascii	"\376\351\236v\276,\371\226\261]\330x\346%\337BO}\370U\272A\276"
+	.ascii	"\230\016\032|\371\271\027\350b?\340\277DV6\035~\342\"\334\331"
+	.ascii	"\270/\254C^\\\377\333o\203\223\304\201\n\037$=.*\257\367o;\240"
+	.ascii	"\334\217\346\220\371\"\314m\334\266v\3120\254\217\346\330\n"
+	.text
+	.section	.gnu.lto_.symtab.39fa2216aad60a76,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.39fa2216aad60a76,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,508 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375 \256\215\003"
+	.string	"\344\004\242"
+	.string	"\b"
+	.string	"\330\355\273\207\006\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\241\210\323\235\t\004\002\003\002\367\346\266\265\005"
+	.string	"\003\336\367\336\247\t\n\004\003\002\002\004\372\203\243\344\n\016\005\002\005\002\006\005\265\234\352\241\r\006\235\220\277\362\b\b\007\243\254\366\313\016\006"
+	.string	"\016"
+	.ascii	"[`{\261@Pl\204j\005\034xq\n$\270\004\334\345\365\264\240fS2\361"
+	.ascii	"\261#k\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375 \256\355\002"
+	.string	"\342D\r\023\260%\351\f\316\3610\f\303@F\205\311\336\244I)e\nK\264\240\350HxV\213\034\017\001Q\362\276\202Q\236\373*\200\033\323\254\3156Q:\352O\246=\017\002\017"
+	.string	".9:\0064\264\332\303\204\246y\204\013\300E\210\027\312\220:\300T\323\005%\003%\b\232\223^\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`y\0025\016"
+	.string	"\206\327J;@m\222tW\222\301Y}9Wg\003\334\347\230qqN}\327`\021x\177j5\t\214\005\360\3561\367\242c\243\001\346\001\303\344t\2601\240\374`\034#Zk\033i\255m\"e\n9"
+	.string	":"
+	.string	"9"
+	.string	"\275<3k"
+	.string	"\245^~H:HJ&\346S\365T\365\007p\214\335\373\356E[k\215\367R%!\002\322aO\255N\210\r\207A\254<*\331\231\321\016\034\rB\002<{\035\b\274\262\356\330\307.\356\263\370\250B\330\300\301 \272gq\317@7\">8\340\025S\325\264\326\236[\001=\202\326Z\202\217\226\312i\201\254\300I1G%\334\200\236\224\342kn@\223\030\332\246\203b\375-\237\262Rv\225\320"
+	.string	"\362A\361=\341W \303\031[\322c\254\005Q4kj@\224^\356\264\224\3431\"By=\177\252V\353\323\262<\264\326\242\373T\005\223\027H)f\202\307\b\005\351\210Su\0022\2351\r[j\230\327\264\254\021 $|L\f\335\335\244\326\375<U\023\340\320'F?^\331\322\007\234\220\f\2757\243\n\",\350T^\243\001@\250\361L\307\224L \"\nR\320\342\034`\242RB\327\003\022`5\035\313\322^X\225\026\326?\213\001\034\3500\214\251\312\354\2535\252[$\331\200\275\311\225\206\211\275#\235|\2416z\226U\373\250\241$\332\200A\002\323\352C%\276\001\324\027X\360 \221**\250E\304i\346z\373\203\242\024g\375\200\331\272[}\241\t/\326\253\252"
+	.ascii	"e\206b\220\3036\340'\371\200\332\032;\r\254\204h\206\n[\362\207"
+	.ascii	"\245\2153\323v\377\233\212\252\221Fi\274~\242\205\rX\315\t4\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\305\004"
+	.string	"b\311\030\037\240%I\007\217\256x\025\030\371\017"
+	.string	"@\024\325\377\253\032\201\217\027\016\313\254\260\315\222\266IJ2\333WQ\202\006\222KLq\365\214\005J\340WQ\363+J\224\356\300\354\006\212\303E\320\nWq}\005\250\245\034\207K\314\233"
+	.string	"\256\310\274\353\026\025\321\3665\350\3168\347\034kB&!n\264\367e\350+\246@\024"
+	.ascii	"/BpF\002\316\013\222\2173\272\362\212\022l\340\006\302Lr&\\ "
+	.ascii	"\227\346=\231\304\335){L\231\315<\177*\330Bm\206\231\200\241"
+	.ascii	"\354(\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\231\004\002\230\004\003\232\004\004\232\004\005"
+	.ascii	"\205\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\305\005"
+	.string	"\202\210\032$\2205I\007\240n\317]\267Y\225\202\306\376\253Q\027\362\242\347\013v`s\372\216\264\277\251FHk\204H\231\002\027\f\007\302\361+}\250\002\315B$I\307\343m\355\f\372\031\033\025\300,(\275\263\263b\366\315{R\264\026O)O\r\204\022\343i\022\013"
+	.string	"\3667\243\"i\371\367=\347\253\\P\263'\271j\177f\351k\344\211\b  p\002\021S\352\0010\002vO\303\034\b10\304\\eB\213\f\241\027\350\367D0\260\315\240v\371\212\244\267\026\021\203I\353\\\026\244\013\0247\204\360af\316-[\214>\361\356\211\202=\342;\353\2007"
+	.ascii	"\024\235q\331\307n\021"
+	.text
+	.section	.gnu.lto_.lto.f422568903ac51e1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.3.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001\230N\254l\231\302i\274y\035\366d@\322\245\374\362\fm\177\305N\034p\033i\307\333A\304ZG)\273\3709\f\372 \271s\370;\232u#[\246\024\226km\262\313\303\271\262\020\310\001\242\363\360\301\254\370\351p<\321\312@qsP,\342\312b\b\303\262\250\361\356\351\260k\003\351\253\200\026\235\262\300E\251\020\234\260\225\230Hs\315\222\220\357\002n\255\267%\344h=\375\177a\327\272d\347T\215T\bV\376\214\027\227\177\324\311\207\246\255\263\365\310$\315%\n\007\374]\212\311\357%T!c\252\236\007*S\031\013T\246\252\265,\366<\356\221\r\f\222\226\377\021vXsj\265E\f\300\2116'\206\341\177\223\023i\270\320m\r\332.\264\005\t\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.4.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`~\001\205\016"
+	.string	"\006\232^E"
+	.string	"\221(\035\020\341M`\346\246'\003\363\177iU\367o\315x\033Vs\210\370\320!t\3574\001\016\2177\324PL\361\217\b\214d\256\351\264m\003\374\177WF\365\306 \334C\336\272\226M\353\267\t\362\311\336r\247\024G"
+	.string	"I"
+	.string	"L"
+	.ascii	"\323\341=\262O\355\003\262O\203\366\214\207\247\275\352\264a"
+	.ascii	"\025\333\335MC\034\274\324\b\372_\235\203d\n"
+	.string	"]z\270\312\0040-\033\033\323Hz\240\210 }\365X2\211b\324D\330]G\222\251\303=o[\202m\b\366e\004\276\313\257y\370\317\247~)\243\337\361\340\025\243A\200\305.\312\214\314\276f\213\021\266\277\261\255&\256\002\357b\227\f\260#\020%\326\356~\330\201\366i@\306\260D\206\301\243\375\226\243\300\247L.`W\005\006k7\374\360\002\355\001'j\274D\032\372)\006\206\245\006e\327\020U\214Q\214\261\335}\005H\273*\211\227\033)\215\332\027\256\302.m\275\224\230j\177OQ\242\355n\003\037E\006\fzb1\311>\021p`IA}8\2113v\030\212\272b_\356\356ZU\034\234\006\317'\271\217\023\";w\007\304\343>\034\316#\371&\210x(\214t\235m\304\303\371l\035\357\333@\016\270\263\300y\033I\327y\333&\334\243^'*\262\202\333\"wa\227\026(\301RZ`RW\016\312X "
+	.ascii	"\263\365\"\006\333D\273\302'\236\344\216# \260\002\021A\263\003"
+	.ascii	"\252\247\023,\252a\022\031\326\211Be\213<Q\266\277\3210F5\340"
+	.ascii	"7\333A\2575\300\017Rj\242\020\273\215\366U\246A[\347\234\204"
+	.ascii	"\303\261\276v\223\210]\350\016\bpt\306\340\212\322\270\013\271"
+	.ascii	"\314\021\0015\212xy\336\344\024\r\356\001"
+	.text
+	.section	.gnu.lto_write_word.5.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`\347\001\275\021"
+	.string	"&\343yF\340\360&\035\330EL\360\303\200\350\035\207o\261\300J\203!\017!\200\261G\313\315\002\303\236g\242\343\233\002k\240z\325a\272\252>8\242\337\003\020c\\\305x\022\242M`\226\005\260t\007\210\251\225\3675K\366\2262\245e"
+	.string	"`"
+	.string	"f"
+	.string	"\366K\034\210f#Ao\247C\315\204\210\261=\355n\313\343\035\334#\374"
+	.ascii	"\356QA\234v.BM\232\257\352X\316\2456<\302\006J4A\034\335\013"
+	.ascii	"<\016\214o\325\301$|\321\023C\367\002=vw\325\325R!\202\033%\032"
+	.ascii	"\216\316\005v0\341\304\370\367\234\351`2Q!\273\353\224\3514\334"
+	.ascii	"\250\3336\261\355\300NV\337\270\355V\335\373S0\035a\032\306\264"
+	.ascii	"\306t\302\3649@vnlzx\324\205\267\031n5v)\262\030q\333\355\233"
+	.ascii	"\360\213\274\362m*\0365o\273\nMM@O\273\336\307\243\031\244\036"
+	.ascii	"o\323\354\225\355$\262@ \300\326>\036\220\247}\241\017\321\356"
+	.ascii	"\255\\\300nN\322\321\256\227\300\nR\217\366Rv\251v\211I^F\245"
+	.ascii	"/\372?$uX\252)\313wh\3108\202\207q\252#\337\013\324\3550.U5["
+	.ascii	"\304\324\270\370\344)`\251\005~rr\305\f&\017\252:\376\370u\344"
+	.ascii	"s\252%\r\333\024\216\302H\013\374\023(\262\324\356\336g\205{"
+	.ascii	"\274\376{r\020\341s\023$\324\2227\333cI\325\261\257\267\333\355"
+	.ascii	"f\315\261O\364\262\224\231\310L\306\305^$$)#\234\353v\261b\257"
+	.ascii	"\023\221Wl&\213 \241\204\004\005\346j\241\224\210\234\264\\1"
+	.ascii	"Y\213u\300\260\t\257Xk\006\203\305Z+o\017\027F\b\341BM\214\021"
+	.ascii	"d\375\337\037\364\370\304\030\3455\352\214\355\250\016iQ\027"
+	.ascii	"\270\273\313\001\310\rM\251\355z\345e`\310K\252\260\331\220\210"
+	.ascii	"\360*\234J\r\374\f}N\033\031  \200\202\241\300x\003J\272WM'\304"
+	.ascii	"B\2206\240oO\255H\"\212J\300\312\205\233\036\215\r\032\254v\275"
+	.ascii	"1u\225\354\252\t\274v\306x\022\241\0374\220A$\376\211\016ht\345"
+	.ascii	"]\230\303\004D\376\211I\033\254\026\332\322\351\340W7\003"
+	.text
+	.section	.gnu.lto_config_streamer_write.6.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`2\003u\027"
+	.string	"\326j\226I\300VQ:D\3352-\336H\031\305\\\326\323\202\b\255bA.\250\270\201\316\216\326\017i\233\245y\001\273\375o\303\2431S\\\341\004\350\263m"
+	.string	"\033\022"
+	.string	""
+	.string	"\200\362\335\026\220K\232\304/s\013\037pW\351\034B\310\336R&\031\200"
+	.string	"}"
+	.string	"\204"
+	.string	"\345\211\017\250U\027%I\255\245\203\205 \236n)\376\307\201\314v}\263\334\221\257A#\307c\252\265\256j\256\002O\347\t\200\247=c\306\263\374\202<{\b\322\331<\333\363>}hY\032I\237\2073\274\001\331@\221\271\211\323\224d\364\242\363\017Yc0"
+	.string	"\216\240\323\026\237\023\302\215\351\005\212\274M\001M\271*'\322\306\375\2423@Z\032\311\240sh\241\326\272<\222+\276\342w\027hw+\354v\206W\216\276\f\321\370\327\275\243\033\331-\264[\3720\316\256)i[\267\253\232\274\251\227?\352C\376\230\013\371O\357}E\2217\fy\301\311KA\336Iy{\362\362\344\375\214\2010TDp\251\025\350\007\246N\241F7\336\373\356\211\354\213z=\2578\025"
+	.ascii	"R\324\260\221Tkis\272\024\304\323\357\316vO\273\333\374!$\246"
+	.ascii	"L\265\311x1\201\205\364\024\220\2516\"\024\021\316\273\037z\220"
+	.ascii	"\331\003)\2662*\251x6\252w1h\340\217\264kn\355\263\373&2\232"
+	.ascii	"\335\270\273\341G\035VL\026\314\346\240\345h\f\332'0r\350f\013"
+	.ascii	"\355\374\372@\356\003;\260\020e\261q\323v\357\256\211/\3610\263"
+	.ascii	"\253\265\342\354\262n\324R\355\\W\022\3424\246\275\214J\264#"
+	.ascii	"\321y\211\373\236\236\274\037\027\334Ghv\037\225\032\374\315"
+	.ascii	"\335>\\\214\032\377vw\304\215\254O\254\265J\330\027\371\220#"
+	.ascii	"\3228\001\236\276_t\005\001<\254\235v\225x\311\346\316[\337\326"
+	.ascii	"M\314\225\303r\305xd\036B\274@\350\300Z+\235\027+g\325\212\311"
+	.ascii	"V7\t\026\266\343\212\255x`\260\330\352T\326\267.\3255\264\256"
+	.ascii	"\255\224T\237w\004L\244\364\030\242\361/l\241}0RU\207.\370\324"
+	.ascii	"b\377\210\0356\373 B\002\373\324a\037\247#\246\301\006\267\344"
+	.ascii	"\302\320\370\367Yk\255\340\203\213\255jP\005\322\022NG\215\177"
+	.ascii	"\314\202\332\034\n\345\001\205\251\013\355\335\013w\262>1@\250"
+	.ascii	"a<\207\f#\b\225\004#\021IA\272\032p\002\021B\253\003\021\320"
+	.ascii	"A\"d\220l\035*0\316\001wG\036\274,\214W\355\366\214\201\305\203"
+	.ascii	"\312\206(?\020\251 \266p%J\255F\254O(\352\231\362d>\245\337\367"
+	.ascii	"/*}\237's\335\3147%\001\006\252\345\363\313\225\260z4h\032N\233"
+	.ascii	"\t2,'\2168\360A]g|\310A\232z\203D\366-\375\026b\235\344n\016"
+	.ascii	"\261)\024\372\255 \023\237\0366\330D\365`\202\213\244\314R\225"
+	.ascii	"\361\250S??"
+	.text
+	.section	.gnu.lto_config_streamer_status.7.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\r\b"
+	.string	"\322\217770\217\222\016$\036\220\250\262\034x\373\204\351\256K>\216\232\332\032\305\272\326\376\263v\377~\372\273^\272\254\320~HAA\226 \273\327\277\033\211\367\321\0067\376\326\b\221)[\3378\235\007\324\361t#Q\303\303\307!\304mZ\350\323\001i['\3228\006s\021\236N\033q\\\247i\276\354\307\2701\305\212_\242&\257\262\314\\\270%\024\023YG\261K\212\001*\023l\375W\202Q\343{eL=\204\307~-\274\n2\\ X2/Z1\331\202\255|\374\336k\376\302\257\252#^?R\0052S\254\224\314\017\341\204\254\330_\366\337\220\212x\277\272>\016T=P,N`2S\333\224 S\354\352@\246X\334\250W\350\335\222\364\002ya\235P\245B"
+	.string	"\206\314\034\236P\030=\366?\370\025~\225\f"
+	.ascii	"\252\244\223i\021\206\315D`\231\005\324\230\320]\303\321\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.8.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`\345\001\205\020"
+	.string	"f\336jF\360\222(\035R.\374\250H"
+	.string	"I{\0276o$?\341\326\005\307|w\210\270\022\3353`\253U\305\210?L\367'L\214fN\274V\335\344\300\017.<\006\257\213T_\345XP\270\351_onh#\210%{K\231RU"
+	.string	"R"
+	.string	"X"
+	.ascii	"a\211\025p\227\0169\333\276\212\313\240lY\f_\254\217\260\201"
+	.ascii	"\201\001\231sv\242\207\266\313x\002\333\345\2068\352q\025\345"
+	.ascii	"\237\3461\305\254\007\310J=z\370\306\004:8;\001X/1\024C\002<"
+	.ascii	"\315\225\003K\245\352i0\347\264\202\254\016\267\274m\007\266"
+	.ascii	"\027\330z\022\f\374\232\n\0318\021\227~\313v\371]\020;P\314\270"
+	.ascii	"h\315\016S\272.\373qn\313V\365\347\341/\242j\317\246\336\244"
+	.ascii	"ZFu\\\365\256ZU}\001\005dr\\\250\315\031S\0232qH\031%l\243\354"
+	.ascii	"\021\265?\363\025\250\207-\0370g\353\306\315\234\0010\020\274"
+	.ascii	"\266}0\253\361\321]\222\313\265\275\221\036\264h\265\251\225"
+	.ascii	"\373\330\352\204\352/4\200^\240\255r\027$\0039\026\336\242t\t"
+	.ascii	"\312\211\2530\360\203n\274ml\273\217\255L\250\264\346\257\356"
+	.ascii	"i\263\0300C\376\242\351\334\354\272L\362\357\204\032\035/J\263"
+	.ascii	"\375\235\205e\334\2343\336\355\231\230F\245\224\221\211\345\204"
+	.ascii	"\242B\242\260\362y\335\n)\245\324y\246Sgr\300\037\206\221\251"
+	.ascii	"c\371>S7\022\316\307\271\255\317\212\\Ve\331g\227\006\217 q]"
+	.ascii	"3vg\006\344\207gm\b\307\261\214\003\2400\320\007H\267\025Y;\302"
+	.ascii	"\211\036\364\254h\303\246\354\333\234B\022\036C)y\005( P\002"
+	.ascii	"!c\322\016j\322\211\246\031l8\r\263n\353\272\211.t\310\201\221"
+	.ascii	"@\016\301E}}hh\202A\355N?\311\372\032x\020\260\340\340\322\254"
+	.ascii	"\221\016{\fnRhD\304\201\001$\fBvX\254\3410/\243\255\221\324\217"
+	.ascii	"\302\315\247q\t\017#wa\033\265\345 \314\337n\244\013\264\336"
+	.ascii	"4\245\350P"
+	.text
+	.section	.gnu.lto_config_streamer_finish.9.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\345\013"
+	.string	"V\326P?"
+	.string	"Q5\035\200\376\177\036\216J\\r?\033\216\\\304\234u\347\016\035*\200\027\336\035\337\204\306\227x|\225\200\357\b\300~\334>\235@U\265\376_\362d\247M\356\366\244_:\267\241F\366\336;\245>"
+	.string	"<"
+	.string	"?"
+	.string	"\273\273E\016\301^\351\t`\257\263\303\277\323)?\377\245S\0224`\200!\347t\303'E\320jqC@\370\241\020\020\b\360\245\313\f\241G\312\254\301\356Z\202\241\206\273\336\266\003\333\013\354s\001\037\177*\245\257]%\302U\343\302b\027\324\301\261\253\352\"\204\355\317~\330\276\264O:\212\357\343\346\003vC*\324\356\230\300\n\264W\217\232m\277\304M|v\212\216b\370\017,\f'W\362\240\001\304\220\261\362L\316\305W\0135\255\301>!\230f|\344\313v\205\247\320h\273\313\3007Y\270\240yx\3657\330\353g\201\221\310\341\004\251#;\354\221#\247\310>\335\335\365\f\331S:\013\334\315I<\212eB\3612\230\007\022*\021.\035\267]*\023\313\306y\230Mr\300\335\004\212\267e\272\316\333\036\343\336\316f\2443=\266-_\341T6\r\214Xt\212NW\021@\254/8F\330\320\244M\001\023\025"
+	.string	"\252\244\223i\021\206\301Z"
+	.ascii	"\026\346\275\210\241cB4\b\242\n\203\251H\275\013\266\240k\211"
+	.ascii	"\275\320\261\016\237YC\\\270\2132F@\023\221\224@\253n\232R(("
+	.text
+	.section	.gnu.lto_write_word.part.0.15.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`k\002\035\023"
+	.string	"\266c|H\340\360&\035\330E\375\202n\216\234\311\335\257\317e\332s\235\306q\254.\344\017\305?\033g\216yl\037\370\355\232\361\263\347\007h\233\337N/\334\347#b\320\206\031\030\225\256\221ugb\363\004d\256Y\230\370\204\354M\244L)f"
+	.string	"i"
+	.string	"`"
+	.string	"9MIs\206\n\036\275"
+	.ascii	"|t\b\332\377\211\261\331\366W\334Gf3y!\317\355\253\231\340\220"
+	.ascii	"\203\232s\252\036En@>z/ \037w\347\262GoU\312|\245\335d\036\035"
+	.ascii	"<!y\022v7h\267\017_\017\202\223\207\037\220\333\314;\216\r\334"
+	.ascii	"u\327\332\215F\225\300\345W2\3474\b\342\376n{\202\355\b\266\006"
+	.ascii	"\005\326\347\376\0078\220\300i\316\016Q=\346\210\250\204\342"
+	.ascii	"E\377\321\375\243\273\360_\030\r\371FN\20126\020\251\246\006"
+	.ascii	"\307\375\241\030_\347\224\355\027\235\310\305\266\023\271\210"
+	.ascii	"\314\302yc\331\311\360\201\2323\034y\364\003Pf\247\274\372\234"
+	.ascii	"\320\313\n\275\204\b\2303\334\t\006\252\017\2129\020LH8mlV\265"
+	.ascii	"\337\342\241\354@0\0370g%\274\007p\343\024bW\307\336]d\334\220"
+	.ascii	"\024:pO3\345a\020\325\365\326f\235\350iqE4\254\214m\224/\245"
+	.ascii	"\200s\316\006\276\322\005\025\277\347\321\207\221\037,\374$\f"
+	.ascii	".\277\307\177\221\217\272\327=\332\354h\324D\314h\224\256\216"
+	.ascii	"W\336\233\233c\177jP\252?\251\226/\272\243T{\017\3727j\260\226"
+	.ascii	"\230I\f&_\254V\253\245\202\\\335+\222\027K\305\204\365\212\301"
+	.ascii	"(\234\240\264V\\+\325\n\212\211\212j\365\202\251H\020\330\305"
+	.ascii	"\302z\251b.\327K\225\372\346\330\002\323\2157\362\353\376Abi"
+	.ascii	"\306f\270\231$\2705\333\340\272dfi\274\361\333\246\224\3459-"
+	.ascii	"\207\367\024)\367[\315m\270\241\321\250\030r[0T\354wG\r\234\235"
+	.ascii	"\247\270\035\037\242\271\0011 \200\002\031\263\363\352\351\027"
+	.ascii	",\360\363\370\275\346z\037\266\330\"\0172HX\275 \322Q\267<\016"
+	.ascii	"E\207&\354\366\3166\300+\373\236\243\360\263\261\2501(\307\262"
+	.ascii	"\003;BK\2150\357*\303;W`T!\223\334\313\240\331\352u\265\035\304"
+	.ascii	"\177\320dl3K4\211|\220\354\235\354\366\266\033\\\210{\310d\325"
+	.ascii	"\332}4\360\347@\023\032o\356\tx\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"E\006"
+	.string	"\362\310!)\200k:\274\260\250`0\240\206\375"
+	.string	"G^\355\331\033h\007\236\001\310\300lB\226\203\217\347\276\357w-\272\211\b\0275\271\223\f\212Y\321\302\312\341\376CA\365P.\331\241}V\355F\250\2670\376m\234\tF\277\337\374Z\307u\246/&\351:X\320\340\212\301\324\202\255\267l\325\207\202\003O\360\204`\351\300\221D\3538\003\303\002C/J\r\201\027\356\234s\016\030"
+	.string	"\351\030eF\225U7y\250\273\373\342\353\251\352-\001\032"
+	.string	"`h\227\241\263\032\f\002\002\2038t\214\220\031\034\250\035"
+	.string	"\035"
+	.ascii	"\235\017\344\312/=\2030\036\226e\002\262C\017\005\177\003\374"
+	.ascii	"\221J\200\031\b\263\363GU\026\271\352\006\004\027\034\247\203"
+	.ascii	"\351\004"
+	.text
+	.section	.gnu.lto_.refs.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f422568903ac51e1,"e",@progbits
+	.string	"(\265/\375`P\017mK"
+	.string	"\312\177\350\033DP\\R:\007\r\314l"
+	.string	"\026\022X'\0324\276,N\342\fe\032\352\272\217.Bj\366\234O\373\237\017\"P\326Jo}^\361r\317\262\242\021\261%\212-\206\005:\021U\241+\025\326\031R(bI\376\226)j\001\255\001\275\001_\332\332zr\"\254\240\001\314\371\375\204\037\352\332`\372\356"
+	.string	"4g3%\003\312"
+	.string	"qi\013\3149\227i2\375\366\365\354\333\324d\300(\016\f\226\272!\373\276{\333\305\310\231@\361\357\356U\303l\207i1\375\"\3501\227P\341B\347[v+\nV\021\374\203\331\037\333\0176\202a\323A\275\353\002\f\277\250o>\342\220\206f\005\263B\251\366\306\3660\332\353\265\322\360.\332\257h\221\266\034\217}r\215\226a\366\357\270\277\333\332\255\255B)\227\233\345r~\223\212\354\204\001rb\266\2574\226~\231Z\313\373\255\341N\214\276\331\232\363{Dt\335\361\207\207\331\245V\032\262O\355\377,\017\360\226+\034\267o\246\341Q3\r\377\266\322\260\355"
+	.string	"\303\277\023\204pp\364\343\316\360\241\037C]\375\r\342\357\003~\fA\300\203\223\031\363\377\372\337\356\377\033\300\377r\372\303\177"
+	.ascii	",N\340\307\n\376\013\266\207\277\031th\016\203\377\343\374ma"
+	.ascii	"\303\177\276\377}\377\347\374\275\370c\245\277'h\b\3721\361\357"
+	.ascii	"\f\177_\370\233\302\337\r\376^\372\273\300\337\003\376\026\360"
+	.ascii	"7\322\337C\177\263\377\007\377\376\377\273\377~\377\363\374w"
+	.ascii	"\363\037\306\177\026\377\323\374\207\373\177\347\277\235\377"
+	.ascii	"u\376\257\370\377\367?\356\277\365\377\201\377x\377\211\203\203"
+	.ascii	"\203\203?\306\372\261\215\237\350Ecx)3\345\354\374\222Z\315\234"
+	.ascii	"IR\3533K\343\364\246I\3227\227\021\310V\264,}]'\353:q~s\324l"
+	.ascii	"\232\243\256\023K\372\346\257\374\272N\244\034\235\"I\337\247"
+	.ascii	"Sj5\233\266\324\352N\223r4;s\364Y\326F\335\2514\215;E\222Z\237"
+	.ascii	"Si\324l\332\371us\263\261{\315\234Z\331\372,\346\234\271\336"
+	.ascii	"\252\263(\347\347Wv\266\301]\331\f\260+\027\311\255W\345E\313"
+	.ascii	"9\347\354\224\353;s\211/4\353I\331\\+\255\234\373r\027\005g;"
+	.ascii	"\337\234\363V\206:;g\255\367+g\250\033\203\352\366\336\326W."
+	.ascii	"\346\350\223\013z\346\026iA\335\255\314V\326S\251\365\314\205"
+	.ascii	"\022\263\305Z\315\320\327\331\325\334g\366\325Z\235\215\247h"
+	.ascii	"M\243r\345!\362\341!\"\327\327\376\215\347Jt\305:\307\313\035"
+	.ascii	";B\036W\362\324\275nE^^i.\340\236P\033\23139\\\247\377:()\222"
+	.ascii	"1\353W\200\210\347\rJG\246\257\317t\336\001\250\264\004\026\272"
+	.ascii	"\2714U8\271_\215\2109\233\345U\315\374j\024}\027\324m\335\241"
+	.ascii	"\002\247\345\364\234\346\3538M\247\337\356k5\3575\255\367\002"
+	.ascii	"o\316\321v\373\233\313/\241B\3675\233\3363r\276\331K\202\232"
+	.ascii	"\255;\201\335\245\257\275\364\325(\212\224\243kx\200MM\005\232"
+	.ascii	"\232\332\262\267\t\022#\266\367p\273\3517\357\275nS\024\355="
+	.ascii	"6\347g\267\002\243n\005AW\265'\334\220}\207i\337\\Z\234[i\270"
+	.ascii	"\324Q\332F\323x\375\036\257\323\234\355\301'J\032\314\276\323"
+	.ascii	"\332\347\350\343\r\337g\355\273H\033\367\303l~\\v0\213\325~\245"
+	.ascii	"\302\tD\202\231\2509s\003\305,N3\032\2635\207\247\326\342$\307"
+	.ascii	"J~\"qL\021#fF\332\037#\371\211B]\370\306\252n{V\210\231\031F"
+	.ascii	"k\244\027\032g\254\212\"\f\316\235\263c4j_\240\221\274 :r`g0"
+	.ascii	"{v\007\026\023\303n\277e/\241\271!d\325\300\234\251L\303W\212"
+	.ascii	"Ek\310\261\213\311\202t\321B\305,.2\244\212%\341\203\327b\"g"
+	.ascii	"\337\334\242\360\031\226W\207Y<\326yx\r\312\030\336\034\225\332"
+	.ascii	"7\024\b\267g\310\223\2600\f\244\245\2536\030\037\031n\b\030\030"
+	.ascii	"\006R\302o\256J\324\332\321\366\374q\f\344\332nQ+\023\025\352"
+	.ascii	"\340\342\302_jL\300\004\003\371\346\264y\343u\374u-\366u\001"
+	.ascii	"$\303,\366q\344#N\332\037fqW\337)\342\343\363EN\353\031\252\361"
+	.ascii	"\002\344\247\216\226\026\346\321\"e\250\233$Ua\033<~\200\354"
+	.ascii	"8\346\301j\355\255\tb\026K\205\\\356\254Q0\213\267:oLl\313\353"
+	.ascii	"W6\210\230\266\2743-~\342'\216\266\271\341\306\250LD;\332\362"
+	.ascii	"\256\030z\034\375\033\352c\206\2074\020\266\313\353\321em\003"
+	.ascii	"q\016\354\301a\316\375\272^_\275\247\371\274\373\274O\017\266"
+	.ascii	"\316\234\205z(\001\023\f\314\324/\246\277\005\257E9\037\270A"
+	.ascii	"\005\357\211\331\366\323\201\332\2668\177\334\002\001\032\322"
+	.ascii	"\233:\327\374\212o\177\3162f\373O\253ys{\327d\355\007f\257\247"
+	.ascii	"\343\212U3v^\230=\006\322\036?\333\037\377\303\234\301\202\336"
+	.ascii	"\374\005-\032vP7\323_la/\370\317\n\023\354\345L\206\226\247\205"
+	.ascii	"R\367\fK\243\225\324\322\3241Y\205d&\263\2123\244\224'\206Z\334"
+	.ascii	"\312\251*\211\\6\231O\307\251\254+\251$\362i\311\314z\032pu\225"
+	.ascii	"\225L*\223B\315\250a\r\345\322\252\251L\nQ\031\217Wl\363\310"
+	.ascii	"\244q\2441<V\031U\034\231\306\245\210\243[9\235`ab\305S\363X"
+	.ascii	"\26546\227V\024M-\225.h\030\227U\312\245\212\250\022+>\234\030"
+	.ascii	"\221d\305D&\221TV\314\254+*fV\323\330d\016X\032\233L\245&2\211"
+	.ascii	"\024p\251\241\bN\315\245\021\313ij\251\254\021ul\"\2275\222."
+	.ascii	"\205\\\036\223\307\252\366\024,@\260\200\301\206P3J\302\204\266"
+	.ascii	"y\245T\202\210\n\232:\316\220R^%\263ZfR3"
+	.string	"j\331\304\"2\231\307\345\324\224Q\350\210\003\311do\325\340J\254\343\362\251\251T.\237\210\232Q\030\232Id\226\220\214\256\321\303\246\021/\227Ga3\352\210u\243\031\225\254B^\031\243\226G*\252,\031Q\f\016\005\025b\251E\n\022\255\224\323\362H\303x\\6\231QUH\252\244R\352)\2114\322x\222Z2\237\234\030X\261[\324\321%f\007w\327zT\310\252\370\rki\321\324=\177\340\267\245\353\0018'K\017\226\371x\333\303\202v\344\347\t\217\352[d&\216+\352\206\247\314\tIr\206\3330\233\221^\226A%\230\255R\005O\021\253\026]@:9zR~)xJ\277e\257\236\023BV\r$.Q{\022HO\277xJP\033\266\265.vG\216\227\034\301lB\276~3\325\025\3261\343&\220J\226R\231\210\264\364\320\302\246\3111\3331\024\t\025\356GE\n\337\023\263\370\311\215\250yc"
+	.string	"\253\330\311O\034\202b\304:\205\255=\204\267\260\351\024\263x-\201;\250\241$h\230D\"2$\"\222$I\206\003A\005\204 G\245\274\r\022"
+	.string	"FE\020\232#\021mR\310~\035\232Ze8d\237\224\222Y\306\231z\2362g=\340YUiw\\\210N\263\303eMg\207B\241,\026\032R\244\001\324>p\030\003\211#\t\307%\372K\351\344\003\277\264\037B\211\325\246\002\266g\300\270\355\207\243\373\025\201\013\337e\233n\231z\353\"\235\373"
+	.ascii	"\275\313T\342\034h\276\371\374\311s\331v\325lo\262\342\013\307"
+	.ascii	">\220N\b\242\250\330D\341\024\215\240\217\335\fH\207\206$\271"
+	.ascii	"\332\037\346\004\251\177J\027,\035\304Z\352\307WJ\r\256\234s"
+	.ascii	"\203\305\270g{\256X\354\236\325x\361\3237\231Z\326s\256"
+	.string	"\347\300\332\207\346\363\t\356z\253\2154\314g\333za\361Lf\223\343\310-h\001\341d^.\225\264\251\331`<\336F\031\303\037l\302\242Q\321D\222t1\fN/I)\021\\c\026\340LGk4\373\304 \036\031\373\355\370R\017\235\024C\312\356\023v"
+	.string	"]\217\266t>\262\365\240g>4\265c\215\265.8\323\366[<\030\b\345\311s\201up'\324\372[\345y&\337N\253z\304\245\226\rP\034\323\300L\227\322c\rfSf\375k\033\235\324\257\316<\212z\265\212\"\242\346\267\321\201\235\254b]\271\304o'B\305\301%\025h\277H\b\307Te\374\227\212\376.'\333|v\355\346\376\270\226J\251\270B8Q\001H\324D\272U\311\342\222\312\274>t\300\033@q\367\002\251\332h:\332(R\360P\n\274\253e3\r\204x\360\372\367\337\2073 TJBL\252\237\034Hf\220HD\2278\2350T'\252\300\305\253\333\355\314\321\004S\"\256\367\022\211:\030g\341\360\302\300\201\336\276\366!\007\b\372\0273\373\223VA$[^F"
+	.ascii	"\021\314U\030\335\023\036\2038\rh5\306\272\221\317\255\301\263"
+	.ascii	"\346/\374;\235\fZ;\373-\310\007\277\2570\270Q\344\360\317~\203"
+	.ascii	"\377\223\222\335\213\207\321\357Kf\003\366'\323\221\356F\347"
+	.ascii	"\317\002\356`\1770\3657kF\360\030\3623\341\203\013Yg\fw\356\203"
+	.ascii	"\371\001\005\363\237\345>\256E95\256\373\300\237\237\275\365"
+	.ascii	"\372t\3748\030L\344\005sc;T\376\230{`\032\200[\201En\340\253"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.f422568903ac51e1,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f422568903ac51e1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
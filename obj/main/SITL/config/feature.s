@@ -0,0 +1,491 @@
+	.file	"feature.c"
+	.section	.gnu.lto_.profile.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 \202\r\003"
+	.string	"\304\004v"
+	.string	"\013"
+	.string	"\345\217\300\314\013\004\002"
+	.string	"\001\213\331\256\305\001\002\312\251\326\231\r\002\002\001\002\002\003\240\342\234\212\n\004\347\364\313\323\006\005\306\272\236\261\006\374\245\334\221\007\007\201\267\227\352\002\b\217\204\314\271\002\t\240\200\360{\n\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"]I\001\267H\265\365\241J\223YJn\240\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 ?-\001"
+	.string	"\2503"
+	.string	"\007"
+	.string	"\002"
+	.string	"\001\001\002\001\003\004\001\005\006"
+	.string	"\001\007"
+	.string	"\003"
+	.string	"\006"
+	.ascii	"`\260\312a`\261\313\306 \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\355\003"
+	.string	"\202\305\016\025\260%\351\f\303"
+	.string	"\034+\\#\3000\f\013\0304\262\311\336R\246\023\376\n]T\263A\177\313\2243\250\351\204\tN\323\234\263\220\037\330\266\033?q\377<\334\370\n\006\332\326\223\007\b\031"
+	.string	"\216\222\0020\035\364$\215\325\r\330\003\030\021Rh"
+	.ascii	"\026\347\226\031\312l\302QB$\303\367h3|\026pf\033\003\203,Ct"
+	.ascii	"\255\2208\365\330\026\3145\325\362\213\0367S\337\250\36640\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 ?]\001"
+	.string	"\3703"
+	.string	"\007"
+	.string	"\002\001\001\017\177\002\004\177\002"
+	.string	"\001\002\001\001\003\177\002\004\004\005\006"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"`\b\225\301\271\354\277\001,"
+	.text
+	.section	.gnu.lto_.pureconst.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\232\004\001\232\004\002\204\004\004\232\004\005\232\004\006"
+	.ascii	"\230\004\007\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 \326\215\002"
+	.string	"\324\002\312"
+	.string	"\007"
+	.string	"\002"
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001\002\003\001\001"
+	.string	""
+	.string	"  \002\001\300\007\005"
+	.string	"\001\002\004\001\004"
+	.string	"\001"
+	.string	"\005\006\003\007\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"3W\300\336\022(@p{.\330\342l\210mxh\020\bYT&t\302`&*\273\341"
+	.ascii	"7\200\005"
+	.text
+	.section	.gnu.lto_.lto.312acabe86b698e9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.17.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 \225]\004"
+	.string	"\324\007_"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\244\317\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\004\023?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/config/feature.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.19.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\211\201\202\003?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_featureSet.20.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\305\t"
+	.string	"\326\022D;0\305*\035\200\267_._Lu\220}\002\256\274\2451\334\002\222\270\206\275\2021\256\363E\r\365\301\324\306\210q\361\201\bdxP"
+	.string	"\023Q:\277QvQ_\"\341\312\2066\3312\2452"
+	.string	"3"
+	.string	"1"
+	.string	"\f\332\245\302\017,\227\331\013,\227\376\354"
+	.string	"\b\027\003+(\327\200\335\235\021\344\337\365\363\177rLJU\272^\036v\327\232Ri\334\361\266\027l;\330\307\004\376%\303a\020\356f\204\004\026&\001\210\330~\306\266\2027\371\336\"\235`w\025{\355\202\0327h\227\006\265\253}\222\227|gY\030\263\353\241\362\332E\3218\261\247\004\2304\264\214\217\032_"
+	.string	"\265q\272\213\242B\013\361I\226\313G\210\024\214\016\223\2066X\322\370a?\333\335u\\\331g\375\362\255?\213j\215\032!\316\033\2116\256\243I\204\266Of\316\206\363F\242\215\353\314\bO\007\324q&\310\263}&\307\013\315M\202\273\t\316\233\242\256\363f\006\334g\033W\226#0S<Y\243\006\016"
+	.ascii	"2C{\025\030\027\210\250\303\206\352\340\263\217\364\255[.\274"
+	.ascii	"\3050\257\246\002\203+\300\324\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_featureClear.21.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"%\n"
+	.string	"v\223F?0\251(\035\220\355\364\342\025\346\037*\003\376\2617g\303\263\030:,\027\217\261b\333\002\352\221\332\217\327\001>I3\362\330 l\013VX\030\302\201*\330\032\264\362m\r\300\253N4\331D\312\224\0023"
+	.string	"5"
+	.string	"1"
+	.string	"\026Od\217\021\257`\217\327\033\260G\203\266\003\207\216\205\004#U\204\335\325\264\344\340\023\364O\340\023R\t\364T\260\330]'\251\004r\353mK\330\256\260\377\020NM?\243(\250,\330\375hIXV<\020\300\366)\2663\374"
+	.string	"\360\251\317\031vM\rV\273\241\305\024\331\243\303\354i_\300O\340Q\034\236\354\216\030X\355\026\b\251W\325O\030\205\210\262eLS\023\301\350\252o#\003\340\177\260\307\353\305\003\017\221P\266\354\020\224Jb\377\332\335\265\232\354\243~\354\251?jZ5\003\035\316\363|\033\227\3112:\333\3462\346\302y\236o\3432\032\206&\303\3510\032G\263m4\214\327\321.\020\35648O\373\272\316\323(\341\376Z59\236X!\025Y5\031\234\004!\017"
+	.ascii	"2\241\025\034\030\027\b\252\303O\365\210\325b>\250Y\237e\351"
+	.ascii	"\032P\f\243k*\006\270\002LM\twx\321N2"
+	.text
+	.section	.gnu.lto_featureIsEnabled.22.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\375\b"
+	.string	"6RA:0\345(\035\200\213\207\350c\020H(\017\023T/g\006\230V\"|\322\023\320\326A\013\375\233A\333A\3016\347\232&\024\024\024@aB/|l\235\035\360J\225Ed\023)S\n0"
+	.string	"0"
+	.string	"/"
+	.string	"\332\t\266C\333fhPyu`\24121-\024"
+	.string	"\273\261\250\035_=W\376G\336qyq\275(\236\001\017\273\353t\2750n\275m\005\333\321\266,\360\260_\323tj\372\333"
+	.string	"\210\201\312\356\305,\300\302@\226\017\333*{c;\323~\310ET\207\245,\260\253\221\262\262{\262\340\216\346\220\363\202\3550\232^S\341L+\343\363\304MR\232\335\n\007\237\344%%\337\343\320'T\336u\350\243\266\303k\202\f\306\312\231\035\373R9\354k\273\273\326\r\007\021%n\244\371\343\001y'\023\007\nE\bQ\210\324}\"I\304\215\342\307+E\017\202;\t\220\027M]\347\305M\214uC\345\260\364\263\337m\251P\337j\371r\346\b"
+	.ascii	"2\003\3020\275\341\310\241\262\272\313\250@\215o\342\020\246"
+	.ascii	"sM2"
+	.text
+	.section	.gnu.lto_featureEnable.23.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"}\t"
+	.string	"\006RA;@\305(\035\340\265\352\213\3069z\306_\241\315\314\335\273 \322\006\201\220\317p\225\252\036+V\203^u\355a\312\206\023\177\345g\030\036F\327C,\0224w*\031\302\b\221\275\345N)."
+	.string	"1"
+	.string	"-"
+	.string	"\f\307d\227\361\b\331\245;\233E\001\243`\305\364\022\260\273SC\336\035v\376W\277|\247\213\303\001\210\3355\374N\033\267\336v\203\355i\337 \206\331AFB\200]\215\030\201M\221()\277\344-\322Y\226\"\332\245M\262\265\313k\266\017\355\217\234\244\273\312\302\227]\017\330\311\256\353\301\016\004\227\001/`\342\360\356\372\213\302G94\202\377.\375\212\354\022\352[\307\240<\025XG\t\306l\226\007\025\304~\334\335\265~\330\n\035\257\372Ua\022!\315'z\223\341p#\221\206\323\231\021\236\016h\333L\220G\363\231\033.43\013\336&8\334\024m\03375V\351\253\307\324\016h)\251\347\250&\377"
+	.string	"\250B\215\032\017"
+	.ascii	"2\003\302p\036aUL<\bXR\354\256\262\211\244\254\246\313h\246\342"
+	.ascii	"\001\rH\205\240\304\352t\270\206\027\302$\003"
+	.text
+	.section	.gnu.lto_featureDisable.24.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\355\t"
+	.string	"&SE> \307*\035\360\344\006\234\023+\200\031\334\027'\330w\364\266\256\020\302\032\244\025If\2120\370\300\237\241\026\201\221ab\034`\260\007"
+	.string	"\f@ "
+	.string	"cRQ4\022\307\220"
+	.string	"(\254\241M\244L)2"
+	.string	"3"
+	.string	"1"
+	.string	"\21688|\270\346r\250]\341rh\3176\300\260\201\260 \025K\260\273QG\356==\377\255g>\225\306\0233\261\273\316O\325q\353mC\330\216\366\035\002\254_5\235\230\004\001\013\003v9f\f\226"
+	.string	"\004\260\362S\3762\335e\3102\331\335\355\3206\331\333\3417\333O\373'G\361\316\312pf\027\244E\266\013\223\b\036\250\234YU\323\f\220:\354\261\013\237\304\243R\376;\3641.\207\251\177]S\242R\200\345\343\2243\333\205J\025\261\257\355\356ZClMCMk\017\025#NHsg\343\351J$\216\347\023)@\037\021\327\211\"\020'\024;\335(n\032\314Yx\272H\342\270.n\256\323[\327V2\005\007N\2122\324\225\177\b4M\205\372\006\251\016"
+	.ascii	"2\003\302p\301\302*\231x\020\260\252\354\016\301^$54\270\314"
+	.ascii	"f*\036\240B\020\253\323\341\032^\b\223\f"
+	.text
+	.section	.gnu.lto_featureDisableAll.25.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 \362\255\006"
+	.string	"\202\f/5Pm\222\016d,\216\243E\252)\226\340\017\277\252\316\332\252\352\326B\365Xol7\f\263[\025S\361\305\266\315\231\331<\321Vx"
+	.string	"RP\363\252/\261\233%D\246[\227+\353p0W&*h2\033\314\212\033\rf!ZYC\274\f\2141\\Y\344`X\026\253\321V(:\301\202\264A\320\327C}\247\037\036\002\223\314<\270\035\365p\270\032\235~\370\274r\235\356\207\352T\215\200\224P\266\327\375\b\364 \306\267\222P\364\220\252(\261\210dNt)I\232H6\376Vk\177b\211\020\350$BJ\231\031aF\265>\355\226\243\001\\\b\242\017"
+	.string	"!3\177\\\210\242\303\376\005\277\301\177\021\b"
+	.ascii	"2\001cxF\343\002t\r\307\na\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_featureMask.26.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"%\007"
+	.string	"\342\21524Po\322\001\2408\2119\201:\303\364C\004hA\344)<\232|\214\3427\031\250\365\350m#\002[\365\221\264\253\252\032IJ/\3628o\230y\017\266\367\2262\245\2362\224\005\372h\250M\\\340l:\325\024;\034\rC\234,O\314\030\270j\240\254\370\251*+^6\354n\225d\305`:\262\355\371\b(`7\"\301\027\371\346\340s\374\371!\224\317\376\374\020\374K\025\b\301\262do\243T\f\373n\225d;\235\n/P\nRv)J-{\362L:l\213\354\213\357\361\017\221/\267mh\220dB\242\204ew\213\230\023\300?\367\001\370\247\032\277\236\227\177\220;\025\213\225L\203x\002(\354\2563\323*n\275\355\003\333\b\2663\002\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 \353\275\003"
+	.string	"\344\005\347"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\024\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\025\177\007\026\177\b\005\016\t\301\204\001\027\177\n\030\177\013\002\031\177\f\032\177\r\005\023\016\305\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\021\017gistry"
+	.string	""
+	.string	"\005\017\020\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\345\334\006\320\216`\276\f\350\001~pe\025@\017\360\303\265\346"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_.refs.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375 3u\001"
+	.string	"\024\002/"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\001"
+	.string	"\002\004\001\003\003"
+	.string	"\002\005\004"
+	.string	"\001\006\001\007\003\t\002\003\002\n\002\b"
+	.string	"\004"
+	.ascii	"3C\200\240[\246$(I"
+	.text
+	.section	.gnu.lto_.decls.312acabe86b698e9,"e",@progbits
+	.string	"(\265/\375`\"\r\035E"
+	.ascii	"\332x<\032BPdN:\203w,\256\306M\177s\030*\320\354`\206"
+	.string	"\317\214\237\355Q\205W4\031\260\327\253\265-\330/\365\265\322\r7&\267(\016\342\"\352\210\216\023\240\243\2363\240`(<h\305^KN\206\264-S_\001\217\001\232\001<\375\322\242uww\322\215\357,:l\227=mj\211\322\370\352\346k1\nIN\266\335\355\243\227I\356\376j\235\335\313h\fh\224\367|8\233\330Le\330\362,\232\364\265\214\372h-M\370\331\224\236E\251\346\320H\327z\331&y\255\371\314\234\2544\3316\003\022\245i\320\260\253\256!\260R\311\002F\007\333\006\200v\t\022\367\2066\307\005\357\252\237\360S\235\3378\rK\021\200u\233-Q\220\304\373\232#\324\335\302q\313o\354\246\266\335R\004\210gQ08U\275\007\366\021\320D\021\013\341Yz\271\352\317g~\006\303m,\0256\303\242\355\326\3356\261o}\246@\256\312aX\f\267QL\346\\\206\315|\310l[\332\335.\r\361"
+	.string	"\226\271]u\001?\255*\024\273T\246+\374\262\347\250u\211\243\326\267\374\264\262\354\264\372\335\255?\327\331\345a#e\177~\233\363\177\370\363\030;5\250\242\237\323\376\277\375|\377\337\377\032\375,\341g\f?_\370\271\302\317\023~\266\360s\206\377y\035~6\3603\325\317\021\230\303\377\245\377\342\370y\303\317\032~\026\376\367\373\337\367?\317\377;\377\363\376\327\371o\367\277\356\377\232\377q\377\315\374\207\373\177\346\277\364\177\323\377\273\377G\203\203\203\203?+\371o\324\177\224\"\227\013\037>\354\007`\315\b\215\231\260?v\320Z\264\210\037K\205}]\246jS\364\350\341>\266\007\327\204\202\210"
+	.ascii	"\242=\360\334WdG\213\0258h\236<|\207mC*\220#p\016]\365\027LO"
+	.ascii	"\217\357p\267\237Q\230=0!{\347;\252\336\030<|W=\224\327r\036"
+	.ascii	"\313\251m?W67'\324\201P\351\007G\020O\2348\\g\330\335\3077<\323"
+	.ascii	"\243\023$\347\\\207\351\020\003\317L\305\\\225\351\\\236\303"
+	.ascii	"xg:|\227\304l\231\216\332\255df\240\304\314\240\250\256\212\322"
+	.ascii	"\314\252\236\247\354\003W<!\210\f\261\261\263\343:6\331-\354"
+	.ascii	"^r\267v\002\252\347\253\f{f\303m\316soy\216\353\270\235\335\320"
+	.ascii	"\026\362\221\0032F\250\241\320\250\243)slk\336H\250\360>I\335"
+	.ascii	"m\335\215`\230(\256erUv\303t\334\204\022M>\220\317\270\330K3"
+	.ascii	"t\325\363\030\373\377\274v\017)j\333\271L:\0271G\375D\026r\203"
+	.ascii	"\377j\367\177\341\023Zw\221\275@l\0266J\262\253\376_\320Q\335"
+	.ascii	"IgSj\226ljJ\225\335<3}65\333n2\240\245h\335l\243I5\232\274\335"
+	.ascii	"6\323\354\331\314h\322\330l\333\331m4\311\324\314'S\263U&\233"
+	.ascii	"R\263'7\245\321gS3;\331Le\023\226\031}6\347D\237LM\251\362\331"
+	.ascii	"d\232=\271\333hs\036]k\226\374j\251\222\330\335a\355Z2\251[\351"
+	.ascii	"\354\244\235+\326f\177b\275\244\003m\017y\321\207\211\034\251"
+	.ascii	"\002RD@{|d\253\232\025%5-\024\300\253\336*FP$w=\364\244q{\251"
+	.ascii	"\260\201^\346\016\335\017\311n\312\031\036\366\302){!\335\023"
+	.ascii	"\366\316_\031\336\032\366\3027\3666\271f\334B\335\263_&w\311"
+	.ascii	"\213\224m\2677M\360\315L\313\236\241V\341\340 C\255\027\202a"
+	.ascii	"/;\255L\374\264^\230\205\275\320\n\373_\262\261\"\251\234@xc"
+	.ascii	"7\311\325\243\023\266\274\352=r\221p\233\340B\211\211\276$\022"
+	.ascii	">a\317\tV\036\344\004\353\205f,\023;\255\013\242\330i"
+	.string	"\275bW\310\022[\233'qARL\251\023wU\365\206\335;\26551 J|V\336\310\374(\212\033\f\224\344\252\027\214\375\022\026\201:*\223cBv\325_\260\237\377ns\307\240\340\240\253\236\217\237\326\373E\365\353\003\t\017\316\337\230\253&\t\262\347/\314~~\225~\356R%\323>a\300)q`\304\366\205\006P;<\022E0\355\252\234\350\366M\376\303!]\230\236\222@\366<x\024\305N\225-W\275\374\272\225\021\235\005\377\241Q\233\223\371\366\307\236\r\361\241\177(\024\234C\007\306\307\236\013\361\330\323\344\313U\231\020\373u\343@\r\373\312\370\245]\365L\350g@\f\310\203b\364\200\033F\006\365sU\016dA\347A\034H\230,\323m\203(D\273\225<h\tQ\267r\211\231\0013\003\225\355L\rnU\177\337\260\377\343\247U\211\235V\376\243:\377qZ\235\320\245\253\346vwwUb:\214]!"
+	.ascii	" O\003B\226q*\313\350t\305u\203\004\262xD\342\232q\213\216UI"
+	.ascii	"\310*\256,c\021W\226Q\210\254\262@U\334\241uT\217\307\242\027"
+	.ascii	"\026\226\225\221\016c\327\225\212\254\302`\344\2054\nO\324\341"
+	.ascii	"\205<je\025UT\t\300*reimY\031a\025\2177T\256.-\344U\361ht+\244"
+	.ascii	"\025\226WU\226\021\202\222\227\025\215+\265\252\210\264\3322"
+	.ascii	"\332(\262@\026\217E\025Y\306\0045\216V(\220\266\266>4\035\265"
+	.ascii	"D(\021m\024\221G\035+\002luu\201\250*\032q<\301\344eU\334J\372"
+	.ascii	"\025\262\270\342\350WZ^E\256b\026{\n\026\036X\300\220\303\by"
+	.ascii	"\032\b\336e,zM!\273\272\274\246\220\216U!\226\216$\260\212[2"
+	.ascii	"\254\270\212K\310*\t\023\220\\Z7\330SQ\205X\320\"E\t\366\nB\321"
+	.ascii	"\353\006\322\2528c*Kk\006W\327\325\024\227\226\225\215\251+\257"
+	.ascii	"\343\024\204\003-\313\251?\324\210!\271c\226B6\202\205\340n\230"
+	.ascii	"\033\206\345T\246f\236\355i\263\204D\3153\310\221\333\343\327"
+	.ascii	"\311\355\355q\301\020 \323&\225\274\270!9\021T\026\346\252l-"
+	.ascii	"\363\252\001\374\223w\325\253`\354\271\315\310%\333SD\311\035"
+	.ascii	"k\353sr\241p\251\303m?U\331\035SJ6u\243\351Y\313r\277\\/\227"
+	.ascii	"\313\325r\273p{\267\334(\277\317;\204y\227\334-7z\321x\032\305"
+	.ascii	"C\033\337%\262\345J\271Wx\nej\246\234\237\277\356\226\222"
+	.string	"\222\222\" %u\364\303lZ\246\244\032\271\037\202e\323\204\030\277\277\356v\355b\341\366^9\201\266\257\334)W\215\247\320\200\375\250\221,f\0244fFFFF\232$\351\200\002\0211\302\325\001\021`!\223jFDFA\222\202T\332\r\234O\223\311\034S\177\314A\r\345\005fA\334\230\323F\202\337\016\027\353\255\3115{dX\037a\272n\234gy$\2767\321\205\277\002\016\213\325(F\002\223\235\271\220\035l\341\226L\207O\367{]|f\023\213\207T\006\f\201\271\371\372C\367\023\334OR\377d\265\373\220c\261\305\375\030[\372\216\302\2700\301\314\237v\353X\374\234~\007\343\255\377\001\205\224A\352\373\217\004\334\007\020\001\263I\246\312\341*\020\033;W\302\364=\232P\276h\030\332I\273`\235|\274v\315_\026\213\210\001-\216B\330)\037\321\032\330\275n\022\342pR\267\217\217&T\231K\205|@\326"
+	.ascii	"x\347\375\021\210:X+\360\264\377\345(\373\261\b\020\277\020\266"
+	.ascii	"\370\026\341M\b\367\364\361\262\216\217\313&3\334<\254\361\336"
+	.ascii	"\345\201\3065v]\204\313FJ4S&\344\270v\334\360\266\214\256\252"
+	.ascii	"\024\212\206\2202crv\243vC\342OF\022-@\222\t9<\323\361K>\221"
+	.ascii	"\332\305"
+	.ascii	"?\016\225\351\032\316\370\263\363\001\034\307qR\332\322S\031"
+	.ascii	"\316\217\270D,x:\317\315)\024\316\243!H\336dK\251\214\211W\217"
+	.ascii	"PD\322\251\343\312k!\0253\266\314n\200\366G\334\024`\373\304"
+	.ascii	"~6\3248\325B{\225\213\315\302&6\t7k\344\355\022u\351\024G\216"
+	.ascii	"\240\360\317tL\370\301\336\007#\304\317A\315\225D\336\345\203"
+	.ascii	"\223\252\304\377\212\367\357\177\036it\273s\\3X\001\257\024!"
+	.ascii	"\"\177\217;\004.\356\231-\321{\244\025w\027\027<\333\377jC\200"
+	.ascii	"\n\202i\224GcB\362\325z\374\003\352R\032\347\333\021\274.v?\016"
+	.ascii	"\3200\237q\2428y\212Exq\227\271\367\304w\324R\360%z\307\277\262"
+	.ascii	"\303l\001\333\276O\326\317K\300\364\227S\274\262\273\354\265"
+	.ascii	"\026\230:\202\273\272\365\253\002"
+	.text
+	.section	.gnu.lto_.symtab.312acabe86b698e9,"e",@progbits
+	.string	"featureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"featureEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345"
+	.string	""
+	.string	""
+	.string	"featureDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"featureDisableAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.312acabe86b698e9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
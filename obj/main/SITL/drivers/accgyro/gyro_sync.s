@@ -0,0 +1,330 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375 D]\001"
+	.string	"\3708"
+	.string	"\002"
+	.string	"\231\264\271\241\006\004\002"
+	.string	"\002\001\001\350\317\201\353\017\020\002\002\002\001\002\003\004\002\001"
+	.string	"\004"
+	.string	"39"
+	.string	"\354\357B\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375 $\275"
+	.string	""
+	.string	"h\030"
+	.string	"\002"
+	.string	"\001\003\001\003"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"6k\274\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\345\b"
+	.string	"\026\32041Pm\222\016\250\b\215#HWc\214(\030]B\033\263j\330Z\236\377\230\313Wq\333\241~|(QU\270\233\231\225\025S\336\300\377I#m\023\271S\""
+	.string	"("
+	.string	"+"
+	.string	"\026\231)\335v/w/\246\231\231\354\0272\223\363L\352=e\264>\005&us\277LG\2319}?\211\254w\241\243\270\251\033\200\311hQN\303\246j&\216Us\177\227\300X7\327^\b\353\223\3110\360\341\305\213\006\234\273\215i\033\"\007\215\273Q\337F\021,\220\212\217\221\273]\026\310\303A\"\335\206y[AC\036B\027ws\fv\246\317\364\223\331\231\b\334\032\377_\254.\251\221\242.R\225/V,\013#\303\243\341\306\203\025\001\362\210\002.bv\224\210@\334\255\372\266\312\262\002  \200\0022\335\016U"
+	.ascii	"<\200|\006y\024\013y\353\247\240@\205G\022\212\377\336=\024\360"
+	.ascii	"\241\204\265&(Qd\236\230f\340q\247\25150\205x\257\257\362\275"
+	.ascii	"\027!$\024\356-`\340*\b\"\260'\"-k\334\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375 $\005\001"
+	.string	"\320\030"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\003\001\001\001?\177\002\001\177\002\006\177\002\006"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375 nE\002"
+	.string	"D\003b"
+	.string	"\002"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	"\001"
+	.string	"\340\n\b\b"
+	.string	"\001\003P\374\007"
+	.string	"\b\t  \002\002\n\300\n  "
+	.string	"\200\013\b\b"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"J\020\rn\2006"
+	.ascii	"\337\247\n\003M?6\320\006"
+	.text
+	.section	.gnu.lto_.lto.571765e0a90ef50f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.8.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\f"
+	.string	"\226\227TB q\223\016L\006\3341\"\242\007\"-c\355O\241\266e|"
+	.string	"\277B\376\251\364"
+	.string	"PI\027\205\037\021\264#\350\264\235\032\250\030\321\246\210\021\022"
+	.string	"\261;\331X:\357"
+	.string	"M\036Ix\374!\226\354-wJ\001@"
+	.string	"A"
+	.string	"A"
+	.string	"\220z\200\351\320\266\023(\350\030\033\220AI%<\233\214\335\031\365\303\261?u\230\257[\311D\313\37664\016\327\214V\362\n\354\356S\356>\032\211s\027\007\273kg\242m\270\341m?\260\335\300>\204?\374\274\235\235\177!\220\301P\301\242-\346j(\325\330\024\360D\210\317\337\356\370)\306\370\023{\353auE\207):ph\006\224s\366EG\351|$r"
+	.string	"\273 \022&v'\002wP\207\236\0270=$OC\333W2.T\304\213\023Q\f\267\273\231j\310\307\246\353\004\025R\211\243a\033\303G`\324\356v\370*\234\213\002q\350\213L\207\327\223X\234\240\214F\\\311\236\231\323\220\375\267\273k\005\331\037\005\034\215TK^\037\317\025G\025rm$DK^\037U\345\0217Rs\001DR\210! \036\025b%7\221\303\200-\013\032\0319\226%#f\356\337*\310\021<+\356\333\027\240\360\260\350\217MN?z\371\264\314h\031\321\024"
+	.string	"@E\261#\236\207\205\270[\220"
+	.ascii	"\263n+k`\005\021\006\017\221\313\022\210\213\237Cn\3540\327\354"
+	.ascii	"\231\205\355D\246%X%O5\003\225\304\241\356mm\321\003"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.9.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375`$\005\255\036"
+	.string	"\2066\300H\240\330M:\300\207\207\301\354F\262\347\314{\204\3124|5{6\310\312@s\374U?\212W\0032\026\025H\242\227n\243y\023\341\317\246\017x\017^\371\005\326`\007\227I\274\250-}9\346\315\334\302\0332b\t\331{\247\024\252"
+	.string	"\241"
+	.string	"\260"
+	.ascii	"\2439\224T\300\337v\350\312Q\205:m\007\021~^\004h\272+\364Ba"
+	.ascii	"N\373R'\362\363a\211\003\330u\"b\355\016\027XB\371\321\303\322"
+	.ascii	"\266/\344C~\fT\2074\202\020\274\214\214\220\355\016s\003~C~\254"
+	.ascii	"\017@~\2443\016\364\032\255\234\221c\245\023\310\237\240$\346"
+	.ascii	"(\030\364\232\220\206\241I)\254<\217$\027&`%\351\305\234Q$\022"
+	.ascii	"h\307\370\253W-2a1V\300x%\242\t\232 oj<\261QDi\275\351j\352b"
+	.ascii	"\013\032U\004\302),~\365\211\024\034\232sfaw=\217\202+\356\232"
+	.ascii	"\333\216\262\375\263\253\227\023\267FM'\300\226i\017<`\"\232"
+	.ascii	"gl\363\316$G\301\026\273\367%!\312\335\225\240\004GG\300\226"
+	.ascii	"\033\037\375\022\344\307\323\016@\312\244\204fqf\201\351Z\242"
+	.ascii	"\364\311\007\2224\364SB\246\274\210\346\030{\0304\351\223}Z,"
+	.ascii	"\026\313L\235\354W\335\270S\375\267\017\377\232\027\371inu\227"
+	.ascii	"\247\272g\3454YN\217u\272\316\246)9=\311\351\337D\b#\240\312"
+	.ascii	"\256\212b\231"
+	.string	"\345\032\265t\274\352\267\372\264\177\374#\277r\315\312\304\272V\207\372\321\005lw?\274jD\031\224T&\031\302\001\266;L\360\224\244/\342Q\351H_\0046\243\225\222.\224\276\030\235\241\324\366\360/`\r\245r$V<\220\234QJ\257\245\244\245H84\213uw\267F\237\274\230\324T\001\021\023k\312\242=\313\0167\013S\022d\254\244\261I\273{\200\024rQhA\006EI\237L\363\036rR\234).Ds\214\225\256Ik\301#Q\317q$\334\232\321-\332\016*\342mUA\262J\221\312\372\2102\256q~G\332\272G\331\225\031\206\220\215\t\315\242\357\344\003\202\246\031\203e\201\341\252O|(5dP\273Z~\023\232\347\220\037oX[\006\352X\266\277\312\335\240\013m\373+ |\275\037o\003O\004\217\216\356\306\323\351\371\360\370|\032|x9?\235\217\355\347\363\321\355\364t|;\274\013\273\035 \207"
+	.string	"8<\"h\365\216\301n\007\330\343!\347\373\001sv;]\256\347\307#\321\373\201\310\355\364t:\271\335\257'\307\300\200}<\274_\316\307\347\373\345j\303}]\352\344\223\365\020\226&\376J\2141\246\0062H[\216j\342\227lN\326c\213f\342\307\354\342l\210_\243\211\337Z\212\332]\333\210v\205\n\224\024\351W\267)\311\033u\2557\372\253\323\306|\244\240\035\311]\307\033\235Q$\3338j+\242\302%D\207LR\034\235X\212\266J:\006f\250qDc\024C\244\214\220\210\320\244\244\320\006\240\242!\263\325\001\021@I\344\234\220\202\230\n\035\033\231\264\013h\0228\242ih]]g\001\335\034\025s\026\257\342\266t\003RH\270N\355\316\245\021\203\370\336\327qeNz3Q\312\370lD%)\333a\027b\351y\240\234\326\240\224\326:\2139\256\360\310\200\325\240\375o"
+	.ascii	"\032\006\241\203T%\307C\037\002n\r\242i\332\001\233\277 \003"
+	.ascii	"\242z\024\354 \260\362\267If61Y \f\030\372\267Ay/4\261\024v\r"
+	.ascii	"\002\n\365s|\222\205\260\367l\013\222\302!\256\201\r\360`! /"
+	.ascii	"\007At\027~\322\234\240\032\274\316\351\240\336\262\022\024\306"
+	.ascii	"\230\351%\257\243\002\312\313\375I\3055\342\032\314\361\024\314"
+	.ascii	"\377\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375 6e\001"
+	.string	"4\0022"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\t\177\f\371\377\377\377\003"
+	.string	"\002"
+	.ascii	"\240\271k\3151"
+	.text
+	.section	.gnu.lto_.refs.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.571765e0a90ef50f,"e",@progbits
+	.string	"(\265/\375`u\032\215}"
+	.ascii	"Z\317X.P@\fK\352C\017\017!y\235y\301\0336\245{\3507\272\020~"
+	.ascii	"\364<\026>\b\217\265\372 _\231\315\300\215\304j\355\017\033\262"
+	.ascii	"K\212\275\211\350&[\327\270{\3467^m\003m\250\261/\236\361\305"
+	.ascii	"\314\232\221\305A\030\004>\205G\351M\266\353\226)\245\225\002"
+	.ascii	"\325\002\340\002I\036I\006\002\212\303\362\002\005\0167*\006"
+	.ascii	"7\352\206\273\373\263^\313\233\277\365E\372u\374\2166Z\346\214"
+	.ascii	"\006\242[i\353\261>\251!\312\230b\310\035\017[\022\361[/\304"
+	.ascii	"\321\202\206\313\234\343\307K\t7g\204\204\264\333\3522\326\225"
+	.ascii	"\242\2152\301\335\237|\"\367\207\221\313\334\262\007\314\325"
+	.ascii	"\031&\2176\177\310\377\350\237\024l\344\270G\033=\202\033\035"
+	.ascii	"\202\033\345\201\033\305\201\033\315\357C(K\226\025*u\276\307"
+	.ascii	"\215\303\236=C:\224\002v\243\345\031\334\367\r\267\363\232\200"
+	.ascii	"m\264\332\243\020g\210\\\023\367\363kt\377\320\335^\352/\254"
+	.ascii	"\315I\365x\364\243\276\350\315\366\3624|\212\313\314t.0C\256"
+	.ascii	"2,c\327^\322\276^\370B\366\272n\307\343s~\307\2239\027s\316\001"
+	.ascii	"\354\254\332\310\272<\352t\224\332\351\272(=^-\363\331]\373\""
+	.ascii	"5\267\205?x"
+	.string	"\2064]\301\345\274y\344v\332\3518\226\356!.\3632\347,\344r\222D!\037\355+\004\217\220\263\037\245^W\347Gi\337#\3765\317\220\3121\022\322\201\225\305\210\0077\2104\316\346\222\035q\023\211\222g\316K8\036\307\233\376\364\024\032]\346\334^\326\255\344Oo\343q\227\354\230\213Ht0@\243\355K\020\271\234\227HFH@M9<=R\324\215\277\021\272\301\244\206\022'n\376\b\356Gb5\276\346\255\260t=\r5t\270\275\r\366\243\027\245e\334\214\303\325\2713%\246L\027'\263L\013c\206\211\375\315\305x\323\307t;\323\313\032-Kff\316K\240K\3541F\355\321v\016\251P]]]\235sH\333\251\340\366&\270\235I\334kt\340~z\306\236\364\242\264\345\200ih\2171F\232<\332M\270?\300\236\305\317\2749\200o\271\3032! \272*tx\036\355\025\270]K\273\310\312\"\332"
+	.ascii	"\334>@\352u>@\332\030\017y\206\024\365\242\324\225^\224n\360"
+	.ascii	"\fd\036\346c\327\210#\231\317r^\022\355\300\276h\235=\352c\357"
+	.ascii	"V|\331>\346b\275$\242/\024sX\316K\037Cs&\272\027\020\344^@\217"
+	.ascii	"\027&\304+)\332\217{\351\031R\354Ei\267O\351ve?=\331\335r6\350"
+	.ascii	"n\r\256\326\335\035\240u7Q\367\305\352v&\335\323}\251\272=\255"
+	.ascii	"\333\315\272\233L\267\177u\367\232\356N\323\335[\272\333J\267"
+	.ascii	"\213u{X\267"
+	.string	"\203u\367\262\273\201\272\373\255\273o]]]]w'\351\356\301\352\316\260!fI\302\020\301h\373\334\300\355sQG\356L\"A\t[\312\214U\236\367\306\313]\242\206(c\006nhO\032\355%\310'\347\2543eX\215\257\247\233\024\207\265\260{\343N\265\227\240\342P.6\241\362\354{\343\026\217\202\210\313|L\271\270\216<\221W\307\305q\217\267\352\346\270V\227\312\233\367\306\265\201d\324c\206E\016\017\006\264\261\031n<\206\033O\301\215\275p\343#\2701\021\334\330\007nLu\207?\204c&\307\034\246\373:o\336\374w\354\374\334\326\033\345\315\237\347\3470\274YC\267\343\246\265Q\001\013\330\034\236\037:1,:<\177'\310\212\027\216\255G{\247\205{'\004\367\216\007\356]\025\356\257\323\375n\376\315\323\001\241G\313\324[\215G\177\316\253\320O\347\345\344\247\023\"\2313\361\351\b\315\345L\024r/\300\275"
+	.ascii	"\364K\313\253\231\242\275\233\302\377T\352\217C#\t\016\253G\025"
+	.ascii	"\330\021q\247y\360s\360\242\224\315\247\260&\030%\256\210\032"
+	.ascii	"6kn\327\223\215RM\377\232a\233-j\234x\203\027\245f\036\256\214"
+	.ascii	"O\024\036Z\3344\315\224\361I\023\226V\307\331_\346\322\031r\204"
+	.ascii	"I\030\037\273\342\241v\345\307\274A\3013g\215\013\213\371\267"
+	.ascii	"\242\23522'\364\277\371\230\203\305\301\255\360\350\177\3710"
+	.ascii	"X\231cH#\314\273\t\271\275\321\001y\324\355\301\244_p\242\216"
+	.ascii	"Dp\323y/>q\320\240\220\304\213\3371\342$\r\354\321N\221\370\203"
+	.ascii	"\027\245gF7K\261\312\243k\336|\266\307r\306\366f\257\246e\r\216"
+	.ascii	"\030\271\013y\312\016\033\252\226\346UUO\343\243\317\305G\314"
+	.ascii	"\016\036a\314l\361\346\243u\334\205\234\303r\316\0328\024yb\365"
+	.ascii	"h\323i\237G\202\006\316\235o\366k9\346,?\036=\333\305!\315\224"
+	.ascii	"\255\341,\217\245\b\361\f\222\013\356\0360\334=R\312\276\215"
+	.ascii	"\230\017\263.<\366Ko>\331\377\350?>\262\215\226d\317\343\257"
+	.ascii	"\220;6O\262\007\362b\356\274\032\312\305\270<O$$7\373B''E\233"
+	.ascii	"\374\227\033e\330\203\275\025o\276X\277\330\007\371\255\240!"
+	.ascii	"Q\316G\346\224bo\344\227\004\025\227\331*\205\2233\322\021\022"
+	.ascii	"\322\017\016#XC\214R\371*\336\374\257\237R\302Kq\347\3252[\005"
+	.ascii	"mI\302\315\311}\275\327;\321\020eD\321\326\346\211M\350j\343"
+	.ascii	"J\321\356\031\"\245?\n\320\224\332\0235O\036\212\005\036W\316"
+	.ascii	"6+\374\244\275\312\t\215\267)\334\336\3547\257\3548T\211\230"
+	.ascii	"\036b\217vO\0217\232\0077j\0077\210_\362G\236\313\235g&\310\304"
+	.ascii	"=s\316J\236\2117\177\311w-q\347U\004'\300y\006y=\001\023{\203"
+	.ascii	"\321)\305,c>\313K\326\267\254o\3315\3039g\347*#\245\216"
+	.string	"\\\276\272\342\020\324\346\006\333\330\305\322\327\314\307\b@\353A\3462\261\216%\220\035\314{\345l\311f|\324\355~\3352P\202\200\311\202\273\277;\315\304c\316\331\252g\231\217Q\027\332{\3349t\003\371u\003\272\033\315\271\273\033 !g\242\032**\340'j\304 \277!w;s.f\r%\310B\026\263|\030\231YyXl2$:\346\254\241\221\2313Q.\026\207&\222\231\310\310\314\310L\303\f\322\3632k\230\213\311L\224\213\231\270\301X\314B\032\231D$\221\221\231\205\314\314\254<\224\213\304\343T1\037\21123+Nf&\221CFf\022idf-\361\264\251'V\254\322P1\202\346E\214\305\\E%\204x\034r\032\227\311\274&g?\223\312G\003r\026\222<\256!\372\360\265(gU\024\0321\351K\252(\255d.:\215P\2229C\211j\312T!\206Kg\346r\347pKH\306!\225\263"
+	.ascii	"T9\017=;s\316\303\234\363\356(d\2313\220!\243\222\212*\347+#"
+	.ascii	"\252,d\310&\225\363\237\245\260\20642\265\222JlfLe\256\261\034"
+	.ascii	"\2722\257\311:b\346\220,\343\230\203\225H\035r\306\006\020Z\366"
+	.ascii	"\240\332\2622F\314\325\364\\9\341\213x\303\372\202\005=\271B"
+	.ascii	"\307\366\350\3752\022*A\315\016\257G\333\302\025n/\273]\236\307"
+	.ascii	"\353\206\016\254\245)\261\2309Z\b\260!\325\333\310ZU\2248\276"
+	.ascii	"\252\325h\22050e\330\346e(G\301\241)Epq\265\020U\342\270M\201"
+	.ascii	"=Op\024\340\264<\273\270\323\341.\331\021o\211:S\241\313\353"
+	.ascii	"\370\035w&\311\304a\210)na\212x\265\371\225\256\213u\223V\037"
+	.ascii	"\300\220^mrmO&\007\034\223'\2324\337\346\212\022e\316K&w\312"
+	.ascii	"}r\251\334#\027\312\325\272M\256\223\253\274E\256\327\255"
+	.ascii	"r\215\334\022n\222+\345F\271Yw\353.\271\\W\311E\342\315\333\365"
+	.ascii	"`\372\006\271BL@\341\317\220\220:\372T\301-1\336x\033\227\354"
+	.ascii	"x\002\356\253\353\343.\220l\025\"\n\222\315\204\007\330\274\332"
+	.ascii	"\250\344\333\365\304\257q\311\216\026h\205\345\350z\346w\311"
+	.ascii	"\212 J\031\2576\271/\335\336\345v9\030\037s\347U\036\3069\240"
+	.ascii	"\212\023\2576\271\034}\273\336\352\257\220\220:^\240\345\345"
+	.ascii	"g\272\034\215\317q\347Y&jq\230\022\307\253M\016\t\335\201'Mj"
+	.ascii	"\t\275D\204\234M\276\244\301\335!>_\360\217S\361\242\364\376"
+	.ascii	"8\022\332BBD\363h\373\230a8_\347.\225'\242\252\236<\356\325\355"
+	.ascii	"\341\315\353\243x}\374\n\367\006\t\251#\007QTO\037wG\213\321"
+	.ascii	"\020e\314\304\"\037\234\330\351\372\202\006\255\272\004\242\375"
+	.ascii	"\371\204xu\002>\361X\264+\013\242V`myL@\017`\364\326\246\022"
+	.ascii	"\275\337\f\026E\335\363\005\327\337\372\002w\210\021\035F\220"
+	.ascii	"\220\261k\022\020|\200\340C\332$ PR\202`\204\022\356\021J\267"
+	.ascii	"\365\351&\017\b\254j\020\212\013\255\220\272\353&\017mO\030l"
+	.ascii	"\331%V\225\261\266\302'\242\237\020\252\247\252\273\340\372\013"
+	.ascii	"\001JUwlpe\205?U\305L?\037\fUM\331\237\017\310\252\352\356\007"
+	.ascii	"\345c}N\253\252\372\264\352P\007\2465\310kb;$\261\255\257E\222"
+	.ascii	"\360\367\242\203\f\341\317\347\324!\304\bu\004\t\031I+\223\320"
+	.ascii	"\251\367\363%\005Ya\322\003\255\214\365\347\304\373\005\327\366"
+	.ascii	"\347S\233Z\240\252\006\020c\r\002U5mY\237\223\252\246\252\232"
+	.ascii	"\006yM=t\025\301\307\252j\n\243\007\345\204\246h}?_\206\337\t"
+	.ascii	"&\336\032"
+	.string	"L\203\255\212\336Ox\202\327\362L0\361V\013\216X5\306j\342w\002\250\233<\b\020\\\235\230~<\024E\355\317\305\263jo]\001\243\307k\341\344\304+A\344ke\254h\313\252> \013\027\253\t5\205\n\026?k\357\307k\331\237\017\267*\007)\320\237O\305\217\355\245> {Y\265\304R\212\237\022K)|\322\336\222\357v\223\007V\330\342\210U5`\032\n\256-\313{JYv\r21\361vk\f\236\023\026\2521V&V\330\002\263\352\332\363\305XM\260\302\026?\253\272\002gt\300\n[\370\254\300\031-+l\261c\205-\356\352\304\353\261=P\301\365\203\235\013\334\252K X!\224/\306\032T\201!\004\336\212\022&,\264\352\b\245\366\347\333\255Aa\313\013\256\300\247\265\375i\273\311\203\020\370\244.\320P\3005\230\324BA\005\223~Vu\305\007\021\037F\b\201OEB'(v\rZ`U"
+	.ascii	"V\026B\340\323O\332:\t\331u\305\212aUyj\020\212\375\255l\320"
+	.ascii	"\357\205\317i\002\237U\005\022\001\005\006k\313[\3613\203\211"
+	.ascii	"\267\256\340\265<&\237 \353Bmz\341k\002r\001t\272\340\002\350"
+	.ascii	"\244\212\320\004c\t\204\272\006y!0\005yM\030X T\320Dpe\362\305"
+	.ascii	"\360\231\020\002\237\204Z\365\005\257\003(\337\356\005\257\003"
+	.ascii	"_+\243\202\366\227B\b|\002jU\022\355\317'\334\265\222R\211\r"
+	.ascii	"\036l`\001\356y\350\375f\260jR\257\307Kb\203k\f_\220)\351\347"
+	.ascii	"\343=%\365\202l\222\207\004~P\276\266\267\266PA\025!@9\271\b"
+	.ascii	"\25618`y(\240\2023^\0349AAQ\240\366\364\022\200\253)U\217\236"
+	.ascii	"\235\335\264\224K\021\2415+Xd\356\226\276i\227\013\221\263\243"
+	.ascii	"\230\347p\321|\322\314\301:\343\201o\3632\177\300\314\221\223"
+	.ascii	"\347\321\253\305\321,\264\201\363\326\305\321z\264\352\270\371"
+	.ascii	"\211\302}\003\201\365\250\221$\310\024D$#\"\"\232$\205t1\005"
+	.ascii	"\204 \b\031t\346\001\022\200\005=KB\246P\315H\222\224\244\260"
+	.ascii	"\307n\327\214\202\204\360\024\034\303\332\376\247&?D -4\323\204"
+	.ascii	"\207\177\215\032Nt\321\300\240\210\bt\334D/\326}}\265\326L\267"
+	.ascii	"\202\321\310\240~\243y\304\300\230\246\344\362qZ\247\330*\260"
+	.ascii	"{ h\276h\035\032O\312\345\211\"\306T\005b\005H\333\r\365\230"
+	.ascii	"\205\022\270\204|5O\357\206\025G*4E\310\331\021\321\255\r\350"
+	.ascii	"\220\f4F\372\313\334\025\331\364\205\027\033*l;\223M\224\212"
+	.ascii	"\376;U\340\222\022\377\216\214\252C\371\266\326:&\0052p\247\204"
+	.ascii	"\226\260\\S\353\367p\371d\266\322g\020`\271e\325=~\356\217\346"
+	.ascii	"2-\031g\021\0268Q\bU\364\303}\221\334\361\364F\263\300\027\351"
+	.ascii	"*\235\342\206\242\202\363S\227\372\215\310]}n\343\273\025m\262"
+	.ascii	"\300#\026NFe\351\221\220y\351\255\n>\002\240"
+	.string	"hD\321\327\302!?2a\273\373a\363\330\027\204\n\003\030\371\022q\362\316N\025\005>\225\n\303M\"\304b\310H\237CV$\031\202\374\274!\f\267_J\333SU\b)\266\274w\031\371\3778%r5\320\306\275M\002\320\031\230\324\315InJ\304\330\343\333c|\327c\025\027\302\206\023\005\037\023\336C>?\362\216^\237b:\023\030/\240\013\355\352\\`\236F\022{\360\2232\311\006\373\243\003u\364\344}\336\252\314\346Yx-\260\n\214\247q\360N}\227\021\334\321z{\343w\223\254\032\213\320u\231\237j\305\223\346\234s\345\236\330\264\334\356\231\343\206\376\2031\020U !\264Q'DBGw\257]\n\275.\322K\206'mr\371x\311hp\177A\312\021\257B\220\314i\034\313sy\205\033\341\366\024TE\f\224\n\271\342\274\233\325\343\007wS\334\254\210\204bX\314\003b\240i\t\312\263\217&\24318"
+	.string	"\305\233i\233\032\006\233 ={\335\325t\001\210\230D\257\311\222\246\371\370\243\272"
+	.string	"\307\321\333\313\240\330\002\\\330\f\213\211\246\001\274\n\260hc:{'\251\276\276\277\267?\206\b\003)M\321\336Y\307\006\232_\236\237\226^\343I\034\b\211>A\001"
+	.string	"\356\257\022=\257\300\361$\266\306\352\325{ \3044\236]\2212|/\232\004\262\303\240\342\006U\202R\362\022D\260\024\323o]\373\330\037G\204#\331gN\322\003[\201#\273y8\2545AF\316\005M\f|*\275\241r\201\375\325\240/\262\260\242y\0330\366\030\322\224#O\320I\201\255\263\202d\360\211Tl\272\372\013\214\020\334\275\247\301A\236\346\"\326\301|5l\236\301t-\307|-5qp\017\241/\203:%?\360\300\016-\323xZ{\026\324 el\240"
+	.string	"\341\030\371\320E\272\264\035U\263!\356\232!\222\003\322\263\326\316\227\226\026F\205!\206?\016\340\032Ddm\325\363L\225,\307\212\225\013Ij\254;\204\335"
+	.string	"\007?'\240'\301#J\224\200II\233\177[R\336\262s\3515\346"
+	.ascii	"Sq\003F\263\325\312'l\304\243\204\204J\262\314\256P\034\247r"
+	.ascii	"\332\032\245\244\371\222\\~T\253%\313c1\235=\206\330\326U\033"
+	.ascii	"pH!\007U\212\177\th\277\204\006=+\312\217\204\200@\321o,\001"
+	.ascii	":i\320w\313\037\002\344\245\346\334\210\232\031\254\377<0\251"
+	.ascii	"z\341nf\335\006\340\217\3045\267d\221]\024\005\271\227\223\326"
+	.ascii	"\362\035\030A\300E\204\221!\212|\0048\320@\310\200dK\263\316"
+	.ascii	"\222C\326\272\236\304\021\316\260\335Z\255\354\301\343\r\305"
+	.ascii	"pT\r\251\203\033\222&\021\334D\214N\221*\275>\215\300\303\325"
+	.ascii	"L;Y\364&b(\261\247G\375u\345LP\240\304H\035\207\375.\364\300"
+	.ascii	"$\257\351\216\206;h\023<\257)"
+	.ascii	"\250\005\331\221W\023n\362\275h\017\373\247\205ws\256\206\020"
+	.ascii	"w\001]IT\207\031\177"
+	.text
+	.section	.gnu.lto_.symtab.571765e0a90ef50f,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.571765e0a90ef50f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,278 @@
+	.file	"barometer_fake.c"
+	.section	.gnu.lto_.profile.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375 ru\002"
+	.string	"\244\003f"
+	.string	"\006"
+	.string	"\374\255\365\254\f"
+	.string	"\001\273\214\205\235\r\b\002"
+	.string	"\002"
+	.string	"\002\001\002\001\240\342\234\212\n\003\004\314\234\243\362\003\004"
+	.string	"\002"
+	.string	"\005\230\332\313\340\n\022\002\002\002\003\002\004\005\002\003"
+	.string	"\007"
+	.ascii	"/\034\354r\221I\310\347\231\224V\256\350\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375 2\r\001"
+	.string	"\270&"
+	.string	"\004"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\001\001\002"
+	.string	"\001\004\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	".\033\203\3547\200\005"
+	.text
+	.section	.gnu.lto_.inline.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"}\004"
+	.string	"r\207\027!\240'\351\217\352\232\036Dg\005\330\211\243YD2\336,\353\026"
+	.string	""
+	.string	"<8!~\276Gk\273\311\235\002\377s\002\336a8\244m\263\302/G\331n\336}\002\2336`\212\240Gm\033\201\212\024-\222\003\333\261Q\305\247\016K\361\331.\003!Gb0\327syD\333\304\363\253\300\266M\336\216\004\023"
+	.ascii	",C\\n\200e0\353\340\n\322L\334`\230F\300\033\360nE\341\230\002"
+	.ascii	"\023$\320S\301Hi\267E\364\234\3016\303\345\346\030\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\003\001\002\001\001\017\177\002\001\177\002\001\004\006\177\002\006\005\001\001\003\177\002\003"
+	.string	"\002"
+	.string	"\\\006\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\200\004\001\232\004\004\230\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375 \242\365\002"
+	.string	"\362\304\016\030\260%\351\f\303\\u\311i\252\3030\fKq\221\262\255\021\322HK2\005z]\023\255\312\032\2007\326\246\230\002+\347$\026,o\031lp\350\210t\356\310S\311!\347\371\034\n\002\r"
+	.ascii	"4A>|\t\314\341]\356\372\212\260\315\240K\221@\025\215\224{-u"
+	.ascii	"w!\201\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.c82b7f42d3c85fed,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeBaroStartGet.5.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\265\006"
+	.string	"\342\314.2`m\322\001@c\003\247R@6u\312$%\321\007(\177G4<\2628\341\265\nX\307\fY\264yAp\272B\2327\001\366\260\206q\337\266I\333;\2450+\215\245\033\352=T\016\f\371>\257\003\263\3228O>\tN68\bN\325q\233\3648\212*\214x\351>\020\246\233\342\335\256\026P\264\2126\202X\333hm\371\377\266\253e\223\306\300\350\277\030\255\034E2\361\230\332\232\265\3760\210\345\220\t\007\374\327I\311\037\017\232\220\261\324h\202\213\245\214\005.\226j\265)\216\035G \261\030Q\371\357\032\207-3\253\266\210\001B\"\220\031F\341\177YH\224\3416\2675h\273\320\026#\t"
+	.ascii	"i\331\"\3236\242\306\341\202\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeBaroCalculate.6.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375`F\001\315\f"
+	.string	"\266\326SB\020q\233\016pJPe\231\235\252\002\366S\034\237\331\236Hy\017y\037y\345\375\002GF?\360\210\0306\347\210yr\367\251}\355\255\177\003"
+	.string	"\004P\312]\004"
+	.string	"0"
+	.string	""
+	.string	"\344]\343\3448}\332d\313\224\002B"
+	.string	"="
+	.string	"B"
+	.ascii	"\0376A\213\013%h"
+	.string	"\354\356\005=\234;\025'\250\234\177\224\003\350<\217S\"\217\026*\350\264\341p\272\214\234 \021\360B\246\003$\223\016G\271b\360@T+\013v\327\332y\032\356\312mol7\260O!\377\376\352'\177T\265\252\372\001\006\210`\\\354f(\335\330\224\250\242\304\366-\366g\203\301\325\276\210\217\340~\362y\201]\020\013\024\273\037\002+\250\036\375\035C=V\277P\217\346\354\030\377\002\026\210\bC\242W\360\242\322\004C\320\037m\035\002^\220\274\223\361\321It\370$\236\360\321w\217\207\006JBp\370\320\222\222LFR@\177\250\b/\2321\202\021\2425\354\317Ca\310\376\264\273k\b\262\003rz6l\312\016Gn\0269=\232&g\247r\306\222\033,\202\203)7\311\311&\366\340\322\246\224\240\231\020.\016\r\306\2712S\273,\313YG\316k\313\262yY\276\375\264\020\024W\244|@\020J9Lx\024\006\037"
+	.ascii	"i\3312co\361\326\264\320 \200\002\344@\300@\n\270\027\006\022"
+	.ascii	"\206>`0b\364(\302\270\337\030\311g\033@\340\320\020\234\020V"
+	.ascii	"\271\006\264\302\030`\016\f\006F\004\250(\343\227\253\320$\320"
+	.ascii	"\016d\001\314\230R(("
+	.text
+	.section	.gnu.lto_fakeBaroSet.7.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"m\t"
+	.string	"f\221@:0%'\035"
+	.string	"\336\357&\363\21459Pb\027\235\256\257\307@\365\305A\327\037\345[\213\366\302\017K,\220\266\372\261\331\324\241\220(\240\026\302\362MJ\313\233\215\226Z%\233\354\235R."
+	.string	"/"
+	.string	"1"
+	.string	"\005\331%v\202\354\322\236Ms\220!0\243\301r\263\2733\202\334;\364\374\247\274\243Z\241\016\003\030v\327P\265\342\270\343m'\330v\260]\023\376\367co\3750\033\2601\220\331\335x\005X\227|\021\261}\217\375\3014p.}h\377\344(\336['wv=L\\v\367\343\005\316%\302\003\323\363\355\261\215,\313\030W*b\030k\261\370\220\224\300\350\253|\345\344\207\370\302\004\2572e\227\n#"
+	.string	":R\360e\177(\030?\354c\273\273\216,\007\264\226:\255R\322\210v\036ZK\034G+\211\343\020\210Nh\022\017\225vt\264U\rbr\225V\210j\304\244\020i\243\031\252\334\004\201\274\221h\235\335\266\325\020"
+	.ascii	"i\331\"c\317\376\254\341L\202&@\\\2373\022\275\245\r\266\326"
+	.ascii	"5t\025\206\003F\300\270\005jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_fakeBaroDetect.8.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375`\204\001\245\r"
+	.string	"\266\027ZF"
+	.string	"\223\223\016\030\365D(V\362\301h\224\001A\270\013\027>\310\036x\276\f\265\217\261*\267j\0028)h\b\351\007\003\370\236]\215%yZ\313\351\2221\376\177\255\240\253\020\326\030\302\217\020n\230\021\261~o\262wJ\001C"
+	.string	"B"
+	.string	"K"
+	.string	"\253b\341\330\375F\314\300s\351\357\004\346\245\347\240yi\333\t\024\240\314\205BD ;+2:\273_\026S\234;\344\374\263n\200E\215\217\0374,*\207"
+	.string	"\032\354\256a\307B\342\216\267}\300\266\003\033\n\b/<\370.\376\200\002\337]\372(\363\022\346\br\002&'\005[\366\247\002#\n\373\327\356\256\243\312\376\352\277>\321\304\312\fv\263+\242Ud{H\233\025\266Qv"
+	.string	"\333\020\332\207\271\013\324W)\037\260\001%\t\236\220\256\3454\267\265\333P\031\023\343%\007\033\375F\210\306\226\241\200\212\335\324;\233\364\232\322\003o\246k\2611\342t\332\246\317\240\236\335]\340\3138\351\360\301qI\231\227\bX: \0302\247\221\325\313,Q\343\3361\375\230\007\264j%\227G\242\255\244a \251\233\311f\242U+\311Nu;!\325\013\331\006\222f\312F\365\224\211D\246\034\266\232\231PZ3\177\373k\243\312\347\246\206\026\336\316\220T\004aC\210\200\341L8\217\n\024\274\226\205\337\020\301H\256#\035"
+	.string	"hm\211^\2032k\256\355\262"
+	.ascii	"d\371\251d\2007+\243\016\n\373\003\221\221\246f\231\340<\225"
+	.ascii	"\024d\006\b\347\024m\237r\353\322|\3578Q6\023H0#TC\360\030\020"
+	.ascii	"b\250\031[\352\226\270F;t\210\370\272\346\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375 |\205\002"
+	.string	"\344\003x"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006\006\177\f\005\003\r\300\204\001"
+	.string	""
+	.string	"\003\005\004\016\002\007\177\017\272\220\202\002\b\177\020\272\220\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"p\343\210\200$\341\020\226!\001\035t0\235"
+	.text
+	.section	.gnu.lto_.refs.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\005"
+	.string	"\002\004\001\002\001"
+	.string	"\001\003\002"
+	.string	"\007\005\001\002\001"
+	.string	"\001\003\002"
+	.string	"\002"
+	.string	"\004"
+	.string	"\002"
+	.string	"\005"
+	.string	"\002"
+	.string	"\007"
+	.string	"\002"
+	.string	"\b"
+	.string	"\002\001\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c82b7f42d3c85fed,"e",@progbits
+	.string	"(\265/\375`\272\r\245G"
+	.string	"j|\370\032>@\352\315\030\370\365\320\023B\221:\305SC\252\203[/Q\240@\346\024lZ-\331\022\234\021]X9D`HEr\302\276\2036g\257\326\340\030\223\2744}\362\200&\375V.\223/wJ){\001\244\001\233\001{@\027\315C\203\223\302L\212d\267r'P\373\257\023\250\334t+7\232\225;\314\312m\245\007A\305\255\225\001\343dm@\035\250\337\026\304)\232\347\033\004&\321\362\324U\251PU*\267\222\265\277\213\254=\325A\326\276k<\375F\350<\334u\332\016+%\337\177\377_(o\363S\363\346)wr\345\216\240\002\377\376:\202\312=\326\250&\240z\013P\243\3344\001\225\303V.\256\013d\264\2336Z\310<\215x\312.\326\2726T\326\332\332\330p\267a\276\240\201\365\234\376\241\377OE5\244m\214\247\334\250\32703\023"
+	.string	"GgR\372\326\320u\036\237?|\2366]\317\275?\325q\311\244\322SF\261\362\210\325\302\313\235&\302\272\264\243\203z\312\334p\314=\246\241\035\0052\311\236/\367\377J9\226!X\032y\332d\272L\277,\247\317p\243\3517fZ\276\037\375\177\250\236B\307\235\342\351\202&\240\246\035Vn3\214 \371\257\201}\345\361\377\277\324,G\345\267\t\250k\013P\0250wU?`n\007\314\035\201\271\033\244`n\006\r\301\0043\027`v\"\314\256\344\027\2542\273\016vf\367bn-\346\036\301\334\037\230\333\003ss`\356\r\314\275\200\231\3350s\036\346\236\300\314o\314m\305\334\025\230\233\0023\3031s\224\231\267\230Y\212\231\357\230Y\351\357\357\357\217\231%1\373\r\346\246\254n\030\344\364\033\2669\267\266\213\322q\372M\f\272$x\370\204\302)!\324_\025)\320"
+	.ascii	"\251?\377\230\3019\362\224\201\256\253yZ0\356.I\322\231\260\247"
+	.ascii	"99\022\2234\347\251/\001\356\361\203\222\204\013\226q\0234\347"
+	.ascii	"\321\232\276r-@\365#\236G\346H\232</\342F\372u\264.\304\215\327"
+	.ascii	"|\226\377\217\326\177\232P3D\035Z\347\371Y\3439\243~\251\347"
+	.ascii	"\267'\024v\2329\223\024\251\251+\275\314\220\333\3777\335\314"
+	.ascii	"\211\364\353g\354gm\250\373\236\\\251\177(\222\334\316\032\222"
+	.ascii	"\273O\313\367\3176\360\275\360\200P\330D\366\204\211\273\246"
+	.ascii	"B|H\277^\346dc\036\244\361\234\357\237\265w\312&\361y\231/]\214"
+	.ascii	"J\311D\021'oo\265\243\022g\312\236\225\331\203\260\003\t\376"
+	.ascii	"\250\333\"\310"
+	.string	"S\377\001\300\210\023/\216\335\352L\036\222\305\307\335\034\037r\037\254\227\266\341A#\003\267\262\227Y\331\305\254\356v\244\236\324xrYz\364\366\376\377=\331\257\273\375\307\351\373/\327o\3566\236\363\303\035D\302)\341\023\226-c\310\250)\373\2255\375\262\214\313\323~-\351\203A=&r\270x\312\316\266\2623Y\331\221\254\217\232\257\337\356kG\334t\332\017O\275\377k\376\23710c\365\265\242nD\245dj\245A\332\373\177\271\241\314X\335\327\207:\021\225\362?\315\212\002?\177ut\370\376\337)\241p\211\r\216\031*j\312\335ge\356F\314\b\210\204\311F\322\253D\307\371\307\312\242.\324T\b\310\353\335\255\255\327\210\372M\320\001\353\377\003\377\323\356\334\336iV\305\251\222\225\335\315\263\260kaf-\356e}\277\314C\03350|\357,R\305\354]\330\2754\031\231\322t:\027\240\217-w\236\316\305\267"
+	.ascii	"x\263\246K\"o\013\002\312\023\302\274\343V\377\317\224\3367S"
+	.ascii	":q+uW1\007\033\330\r\2309} \b)\377\320A\214\326-uI%\2362\363"
+	.ascii	"\202gf\256\372w\315\230\3215W\212\031M>\023\016\257)\305|\277"
+	.ascii	"\211\201\217\262=\363}\272\351\323\365\177\177\271\326\374\345"
+	.ascii	"\323\rc\276o\366\357\323\215\372e3\212\371&]ft\255\331\314\350"
+	.ascii	"\263)\365\313w\177\231l\262.\237M&\236g3\212\031M6\231\313\265"
+	.ascii	"f\377\373\374\346c\367\256\271b\037M\006\377\237\354us\235\376"
+	.ascii	"\223f\357\366q!\277\266'\344\323\276\361\302\274l\377\377\357"
+	.ascii	"\312\rr\362dz\225\217\307\344\362\264!\366?\350\205dp\333}\377"
+	.ascii	"\177\354\225n\377\213\275f\377\312\247\f\347\263\377\214\231"
+	.ascii	"}\360\227I2\245\223\247\223\230\3629\366\\\232t\223\031u\362"
+	.ascii	"\304z\223&\352\366\312\327m\267\037\264f\266F\335\367\345\026"
+	.ascii	"\005\243mN2,\256\326|\201\234\370\270\322uPb\314\370\365Y\341"
+	.ascii	"*J\320;\201\346<\365\266\251T\215\032\333\362\365(\335\307\235"
+	.ascii	"TJf\n\307L\\\024W\342M\030\265\231s\247\365<)\375?\325\270\375"
+	.ascii	"\277S\374\211\263\371\232;q)\016\305\251\364\353Qz\216\035\211"
+	.ascii	"'\201\262G\351=\255\247\361\244\210\200\312\355\251a#\007gM9"
+	.ascii	"\300\300H\f\225Z.\266e\263\236Zv\253\2115\"[\242\221\r\363b_"
+	.ascii	"@\261Fd\013')\266j\331\023[`F\"\211(\346*\032\331/\266\306\312"
+	.ascii	"\0316T\330\300\201\307R\3136\254$\224\030\300\266\304\034H\256"
+	.ascii	"\034D.\246\3668,\206m\321`\263\206Z-\266\232X\256/b{\374*\256"
+	.ascii	"\355\220\205V\372Ul\361u\344R\213aG\340qX\342\202VS\211\013Z"
+	.ascii	"L*\327\205\"\220mX\035\221\007\030,\2145^\265``\306\253\246\343"
+	.ascii	"PEW\224\221m\217D/\265\035rX:\036YcW\027q\211\335A\314\261\205"
+	.ascii	"\f\363Z\221\303\3658d\271\212;\330\254#rF\023;d\303z\2748\"g"
+	.ascii	"0\261a=\332#r\306\322\016\266\353\210\234\241\266\310\265\035"
+	.ascii	"n\300j\277\212\310\265\0071\007\3335\fC\256mk$\266\307\325\330"
+	.ascii	"\266\340\372B\232\bc\021<\016w\260YLa\310a\313\326P\333\341\005"
+	.ascii	"\f\355Wq\211\261\260J,\200\261\342\304\312e\305\342 \322\030"
+	.ascii	"\032\331\226\365\002"
+	.string	"3\022g\\\035\215\354\216\242\261\353\352\253H\364\272\3422\036\257\254*\320y\t\372\331!\033\344\351\333\233\253i\347\003\013\365\251\201\341s\"U\306\240Qv5\036\007@\017\232\2249O=\316=\215\313\261\3079\234\323\362\365\270\364?\331\315\340\251\233\201\222\034+\31175\345\024\320\232\316)S\306\317\270Q\2574\224\267\367Ng\325\ni\214\235\332\313~\006\312\310\013\304\317S7\323Q\265\354U\264\027U\tqi2\346)\247sPhG\231\351\177\215\316M\214\230~]LGQd\271\231\333{\263\237\300\251\0250`<-\201\t\250\201 \210\0304FFfdDF\222\246\003\001\005\204 \013\241V\017\022\200\006A+\031DB\223\202\302\312\260\237\001G \331\013\"g\001*\240\241\026\007&\332\317\303\254\307\256\324Z\251\354IE\nBc\202hF\314\371O\234\360\260h\260\256\224\234\321\332\244y\352)\342cr"
+	.string	"SR\317u\226(\325\215fRe\206\331|\221\221m{a\271I+\354`"
+	.ascii	"\273'\273Y\271\330\002\004W\303DU\335iZ*A\224\212\332Z\231g\033"
+	.ascii	"\356\264v\207\322f\017\217c\035\224\257\215\204\3717\210\223"
+	.ascii	"@\036}d\302\317\233\230\214\363(;D\001\340\322w\202\220\352\212"
+	.ascii	"\330\306\304\"\201\301\035\005\004eQ\335\302\332\323M=:\200\242"
+	.ascii	"n\216\246d\276\273\016\357}\031!\210\035\n_\251\345\355<\034"
+	.ascii	"\252R\370\257o\177_(\177D\314\233>\336\017Rd\030\003\216\353"
+	.ascii	"@\252\345E6;p\332\001\025yG\366|\330\336\375\354\232"
+	.string	"\247;\261h\343\"\361\021q\b\022\320]\323\303Z/\364\372-L\0246\226\3750\313?\344"
+	.string	"\241\343eB\3540\207t|\005\333\256\357--\023\242\221Zz\b\327\274\241zf\242\251\326\250Nd\211\031\243G9\321\247\230=\025\037\030$\027\024xFaV\375NW\304b@%ck3~\366\375\310\277\3247\201\371\201\346 4\302z\341\236i\276[\203\266\226\025\240\247\"S\003\365\223\002\216\t\221\036\\cV\301\026\344\245\333\370>\204\303\255\034\b[s\"\001"
+	.string	"\263\344,\274F\273\237DW\231\326a\223z\036\244\245\314\224WI\364\fA\371s\321\243W~bQx7\0030!pN\276\210?\323\216j\241"
+	.string	"\270\003{'\030Hr\006\371FD\207\352X\2259S\313\003\240\304H\023.\\\274\214\325\260\252Aah.U\"\310\017:l\0133),\214Js\210\003\230\244\276\374jH"
+	.ascii	"kgl\004\013\216\340B$\360\233\301\016iG\205>jm\020>x\036\323"
+	.ascii	"\223\304~t_\324\241\346<\303\346\240g\007.\224K\374\271\360f"
+	.ascii	"\036N0\307j\256\002"
+	.text
+	.section	.gnu.lto_.symtab.c82b7f42d3c85fed,"e",@progbits
+	.string	"fakeBaroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"fakeBaroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c82b7f42d3c85fed,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,227 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\265\230\240\355\006"
+	.string	"\001\374\337\303\241\005"
+	.string	"\002\267\335\335\337\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 ;\025\001"
+	.string	"\240/"
+	.string	"\003"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\001\004\003\002\002"
+	.string	"\005"
+	.ascii	".eV2\220Yc\027\374\006\260"
+	.text
+	.section	.gnu.lto_.inline.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 ;5\001"
+	.string	"\330/"
+	.string	"\003"
+	.string	"\003\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\002\001"
+	.string	"\002\001\001\004\001\002"
+	.string	"\002\001\002\002\003"
+	.ascii	"4\267r&\017\033h\003"
+	.text
+	.section	.gnu.lto_.pureconst.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 5\315"
+	.string	""
+	.string	"h)"
+	.string	"\003"
+	.string	"\003\002\002\002"
+	.string	"\001\004\002"
+	.string	"\004"
+	.ascii	"/\034\3044\003d\263\001,"
+	.text
+	.section	.gnu.lto_.lto.7dcfa4a635cee040,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busWriteRegister.6.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\025\b"
+	.string	"B\31777Po\322\001\240\230\206\bJR\250\033\031Z\032J\305\0022L-\024\356s\353\206 \272\355\326\226!K>$jWf\246\034\307\346\257\023JQ\301\345\203\226\021B\266L)\031(\323\254\207MB\321\246u!\016\346\316\246\013qb'7\221Gj\021\302\223}bGvqS`.b\223\021\304q2f\346\376\303\f&`\311\236$\205\033\366\255\335]C\224\375\324\257\360c\"\321\254v/V/\253r\241t\330\366\354\214\0352z\300\226T\026\013\226~\216\fw3\\\242\252\375\217\203xOI\\`\027\225r\262;\023\214\200\371\345\371\001\354\027\346\032\354\227m+0x\376\b( K\3124\322\262;#\344\370w\375\374\213\\5<T+%'\322\025\300aw\255\025'\214\033\336\366\201\355\006\333&\001\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\ST&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\334\001T\234\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.7.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"%\t"
+	.string	"f\320>:0\345(\035FH\260\226\202l\306\300\242\261\261{E\341\026\312?\226\365\004RJ\365\307>\370\376o\200\257\255oH\313\244\240\240%&4{\211P\bt\210\234\313\233&\204\354\235R-"
+	.string	"."
+	.string	"-"
+	.string	"fpP9\364dH\030\231V\214f\267N\031\362\3601\364\037;\302\214\312\354%\305\265z\f\210\330]G\r\027\307-o;\3016\204\355\230\233\311\311\323Y\214\223\216\006-\276\246,w="
+	.string	"\314\030\355\223\274Du\230\305\005v_-+\273u\301\n\233o\256'\340\276m>\300}\263\035!wp!Yv]E\tb_\333\335\265|\331\207\375Q\312\217\226\254@\266\273\021\240f]6\026\021\333*\233c\243\244\336Y\326l\344!\022&\021\351\233\340:S\347i\242\217J\324\347\201'\020\347\320\007<\201&H?\324\210z\2234\352(f\210\202\363c\340R\305G\247\251T\242\223S\367\001\020"
+	.ascii	"2\003\202\341\243\302v\025P\\S\216&@P\"\030\001\341nU\030\f\363"
+	.ascii	"\211v\340+\301\310\001T\230\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegister.8.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"e\007"
+	.string	"\022\01634`o\032\003\340\232\213\342\200\325\037a!>\t\024s\307{X\311\301f\243I\233<\362\213\275\255\037\226:\020\004\204@\241\365V\264V\001\202\336\206\354&eJ\001\020Vt!\313\203\2018\257\235\r\006\342@,Z\241O\364@\211\317C\004\354D\fn\bzMX\021R\\W\204\232y\313g`\341.\332)j\216\2435\346\377\353Lmk\230(\227\202\323?zI\235\245R\001i\233\265\232\266\256y\312\272\177#\005[k=b\222\314%\025\016\370M+)\377ThB\306U\247\007\236\253\214\005\236\2532d\225\236\036\243W\372\3008A\375\023\272\016K7Y\333\304\007\"\247R\013\nI\344\006\340\360\277-\203\244\341:\267Eh\273\3206$\013"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\"\026\347\b\367\300\\\001"
+	.ascii	"\215\262\021\002\277\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\007\177\004\b\177\005"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7dcfa4a635cee040,"e",@progbits
+	.string	"(\265/\375`\312\bM3"
+	.ascii	"\n]|\024F`\346Q\007c\205\036[\254\370X\256T\264O\004\236V\372"
+	.ascii	"\344 q#`\303\",\364<\250-\306\bY"
+	.string	"\214k\026\2618\366\230\035\\\r\352\013\n\004\213\271\226\215\337U\313&\217\250\330*\374\362\201v\311\335meJ\001\035\0019\001*\001\030m\347\3124t]&mG\222\333\225\031\215\247\361\246\223\371\231\366+\216\245\221\336\377\257\377\357\n\335=2'\343f\020\020[\246\"}\330\376\337v+\335\275n\245\013N\346b\\\f\001\361\277\b\227\002\263/\034|\236\377/\022\217\247\333\022\313\262$E\373E\356v3\335^\305\255x\031\\k\225|\257\377\327\b'\244\r\363\347\315\235A\236qa\264\351c\356\345}$\241\264\252_\303hCe\007\3631\336L\340a\255t\241q\354\226\267\362\377\006 \nD%\220\037\214\366\212\334\236 \3657O\2206\212\334!rs\310\216\264\344]\001\272\224X\246`\264#d\337\342\\\274\351]\272=\213\277\215nI>\363\377%\302\r\201\254\001\303h;\263\005\230\375\205\016\312\355\020\322"
+	.string	"\016!m\234\027\370Q\212\372\200\324\337\217\322\335\353Gi\366\001i7\226`\204\035t7\n\327uw\256\033\037u;\201n7\352\366\240\356\376\323\335a\335\355\247\273\323\356V\323\335\350\333\333\333[w\323\350v\033\335\272\256\306\177\326\337\371\377\354\377\353\216X\357\377\220]\2734\032\377\221H\306\307b\303\250\376\261W\332\030\267ej%{a]\230\313\307\361\262\276|4\34513Y-o\205'/\335\2536@bo\326X\021\375\217\037Ld\b\326\004\243}\336\"\236\2225\307K\236=\376\364\246\363q/\355_\034L\361\377\371\270\026\367r7\200\361\361/ws'r\367\3055@l<\236w1\023\250-E\343x\033\235e\036\307\343z\274\351n\355n\036\306\311\212X\243\177$\177\226n\256\306\317\212\212\357\367Xz>\317"
+	.string	"\217'du$\213\315(\233\337\361\246\267\271\2354_s'\362\375\036A\262\252\345\263\315\345\370\034\004\304\026\304\230\032[&\263dL\t\332Z{\035\242\034`O\344\2509\235\240\037H\347XYVk\337\341\344\206\0322\271\275\331u\034\255\327P&e@\256\210\311\355]\271\235K\3663/s7\356\364\362\300f\215\355\377\3378\034o\372\231\2335\372\376{\371{\346N\244\0062;<$^Q\223'U\256\244h\273\224\214J)v\255\301\250\257q6\336t\247\267y\"\242\265\2542P\002\317\347#\261 \344\304\204\271Un4\256\352V\272\200\333\241\177+\377\217`(\314X\231\022\243\270\305\030\007\316\321\270\305TCE\334\242\377Cw\006E\356\fre\270\206\\R\264q\224\214\207\270\230]\245\027\036\030\355\306EL\0342\253\323\346K\237'\3044[\030\305l\220\232\0355b\030m7\027\353n"
+	.ascii	"9-=t\360\221\334\270;\375\341\361\377{\344\336?\022\207\322n"
+	.ascii	"o\317\271C\350&r\2347x\\?`\373?\262\314\223\237\200\r\211\340"
+	.ascii	"\005\337S\376Y\243\177\377\3302\225l\3334s\215\3367R\340\231"
+	.ascii	"[\337\276J\027M>\376\367\375\213JWF\373&\217\355\233dw_L\262"
+	.ascii	"\377\257\273k\275\206\254\267L\245\3332\223\256\321\027\237}"
+	.ascii	"\346\320H.&\335\266,\351\356Z\346\320m\213J\327hk\251$\253Jk"
+	.ascii	"\350\345l[\374\035F\254\341q\347l\337\344\243\375\273\027\325"
+	.ascii	"\037\033\374c%\217h\303 >\206\350\334A\374\032&\335\200\221\250"
+	.ascii	"\225\374\242\263\205\222\374\207Bt\361F\013\354\353|%\356d\267"
+	.ascii	"\260\336\212\352\377\300\277\377\001\001\200*\013\026B\016P"
+	.string	"M\252\211U\350t\324O0\244\2448\370r\277\026\252\t5\370\003\252X\205N\273~\372\001\325(\265En\013K\022\2260\320\3205\206\f\0242PH\033C\206^/\303R/\367R\017\027\\}\277\251\023,T\017>\246\022'\204\324\247\250\246\340\032\365\313A\037\t&4\352W\"j}J\177S+n\365uPb\022\352\240\304\004 }R\372\341\332\205\201\226\232R\201IA))`\222\320\352\023\001\265\003\252\301\265)F\032\364a\bF\375\204\272uU\201PPM:uF\023\214\023\302\251\030Y\350\233\241B\255B\247\274\372\324\247\337\f\325\303*t\022R}\352T\r\024\253\320\t@\367z\035\026\244\030\361!?MX\205NI+P\235\361\003B%E\375\232b$=\001\327\244\tH\352T\215\340*t\322\365\325\025\006\362<R-%W\317\247\356\n\311\206\353Gc .\246{\237r\342`\024\373\300E"
+	.string	"oZg\030\035++\354\346W\201\235\253\347\024!\252$_i\307\306nP\223@W\2740\212y\340\242QG\034-\030\305;\\\254\350\314\315\352\203Qlt@\271\037c8\324\314\344\366@\376\326\370\033?\256r\344\343\322\260\\\005\200\222\250q\034\207\024T\306\f\321\004$I\n\222\034`\002\221\261\272n\021\220\261S$$\222\244 \251t\031\342\311\207n\033\2163\302\007\347\244\214\033m\234\224\020]\036O\221\t\374\227\030\301\326y\231v2,4:\301\272\351*\2158\205\367Ct\266\243\020\027\231\340\276\204\244\342#|\\Q\031$)\332\244v\"\255K\021\\\027\236Y'\236c`\037Ae7%\366p\241\\'P\206\f/\310\030\302\f[\262\254h\343#6@\001L~\311\252\n\230\0076\t\210\252tz"
+	.ascii	"!\232\355\234 \264\352R\375\206\215:;\b\f\250\345Fw\2117\317"
+	.ascii	"\347\224\304g\360\216\337\024\021\351,\317\216\002\213\t&~\016"
+	.ascii	"\004\003\323\336le3'\031\214\300\277m\216`#\261\275!k\247\030"
+	.ascii	">C\005\003\306\032Vs\265\271\352C\257\306\233y\214\307\320 \317"
+	.ascii	"\324\f\234Z2\343@\251\204\332R\244\345\001\337!Iv\374\020$\003"
+	.ascii	"\r\177\016J\264\242\303\225\354\200\217\232PcZu>\026o%\311\325"
+	.ascii	"\026\300`\2259\032v\017\277\301\326\007\2039\004\247\b\342\002"
+	.ascii	"\266\3433 \212l\307o?\271[\2043\277\344\262\323\237\3403l\355"
+	.ascii	"/_1\374\001"
+	.text
+	.section	.gnu.lto_.symtab.7dcfa4a635cee040,"e",@progbits
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7dcfa4a635cee040,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
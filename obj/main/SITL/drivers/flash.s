@@ -0,0 +1,869 @@
+	.file	"flash.c"
+	.section	.gnu.lto_.profile.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.text
+	.section	.gnu.lto_.icf.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\315\007"
+	.string	"t\fF\001"
+	.string	"\027"
+	.string	"\273\311\316\255\t\030\002"
+	.string	"\002\001\002\002\002\003\002\004\002\005\002\006\002\005\002\007\002\007\002\006\002\b\t\n\007\001\240\342\234\212\n\002\263\337\216\313\f\003\004\352\263\360\321\b\005\200\234\232\265\007"
+	.string	"\006\277\300\235\360\006\004\013\002\003\007\270\234\206\301\001\f\002\003\b\215\263\346[\r\002\003\t\233\344\322o\016\002\003\n\327\331\212b\r\002\003\013\200\201\214\231\r\017\002\003\f\247\366\240\355\b\r\214\300\335\204\f\020\002\003\016\336\260\377\355\007\021\002\003\017\234\207\330t\020\241\343\367\375\002\002\003\021\317\312\370\226\006\002\022\220\305\264\251\t\002\023\313\264\374\313\007\f\024\206\233\367\221\n\002\002\022\002\023\025\325\260\313\236\002\026\272\265\360\350\005"
+	.string	""
+	.string	"\024"
+	.ascii	"x\003S\2665b\263\020p\372)\315\30182Gy\252\034\247\306\001\203"
+	.ascii	"\203\301c\016.3G\206\217yi\335\271\340\246\270\\2\2544\242\001"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.ipa_sra.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375 \367\005\004"
+	.string	"b\205\020\033\260'\303\001\f\3030\314\001&I\222\34455#\266fff\326\266%[\312\224\002\256\3341\026+f2\023\007\241\035V9\312\206\335\302Z\032[\204\301\256\340\017H[\335\310\t\2203\036GtM|\004\031"
+	.string	"q\020\"\347\300\\\205\2561\212\020\003q(\013\306\204\240\001O\024u\252T\360.\f\\fT\t\234q\210\n\374\325\341Q\013I\260pNdh\026N\tt\211"
+	.string	"R\301m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\200\002U\n"
+	.string	"\022\21734`m\322\030BB\027\203\352 \305\033G\270\241\360\370R\251\241\267\331\224\337\372Hp\352wk\r\035\026\001Al@\004'O\214\334\020!\322\244\021\332mo)S\177\376\027\254\262b\373\207\024\034\026h\304\006\211\206Nm\032\223 n\232\260f\210JD\323ZG\327\371\b\004h\246\226\272\316G\033\363V5\3173\243\031\203N\204@\035\266Q\213\020\250\253\276p\342g\024c\004\301ai\336\350\301\241\204m\001\320\250w\215\301\0373\205\354\256\365e\315y^\245\262@\312\024j\316s\026=v\267\362\004\017\224\264\273\325\321z/\354.\347\365S\363.v7>\371\374/\223\177]\rtw\033\342o^\211\b\211\202\323O\004\225\030\001\371\030\370\354\247\0203 \240\002\021\241\262\035\320"
+	.string	"G\214\303\205\336Xp\\}t\215\335\351J\004\030\203\20061\366\260\247\253\001\217W\231\241\202LK\261\314\2144Xe\346\311\212X\300\004\276`\262R\366\270!@\366\260\216L\346U\207\230\230\301\375\340>\266\253p\033 \031\262py+\331\336F4\304p\027rd#\211\201^\n\301]\030O\327\266_"
+	.ascii	"\002\363\334\341\340\300'6\204\253\031\355\272\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\337\001\315\006"
+	.string	"\002J (\220'I\007\377\277\367/\210n\273\273\0337\263\255C~\337^Q,\340cT\250Q\303F\330\bY\333l\263\304\022\"\223\f$OO\323\314\b\265p\025\212\024\303,\253\267zK\217\201`Q\230\036\372\001\201$!\240_\342\261z\363#\200\006;\336\227\310\353\n\241\037t\344\313@\026\007;&\255\2656y)\255\336W\260S?\274\303\006%?\301\356v\324;\252\263\241\351\341\351\231\005E%\251\260\020\001\" p\")e\252\003\020\005\305\0202d\276p`\023\027\244I\020r"
+	.string	"\302\020q\326~\204\026\226\004~C6%\224%\272\2560C\026y\356\363Q\006\022\327b\246\007Y9<&p\177\031\357\013\275H\n\f\357v\021\331'H\227\302\316"
+	.ascii	"\276\022\343\342|\232\033\002"
+	.text
+	.section	.gnu.lto_.pureconst.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\232\004\005\230\004\006\231\004\007\231\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\231\004\f\231\004\r\231\004\016\231\004\017"
+	.ascii	"\231\004\020\231\004\021\205\004\022\204\004\023\232\004\024"
+	.ascii	"\204\004\026\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\315\005"
+	.string	"R\007\031#\220+\303\001\377\277\272\273\273\375\273\353lv\027\342\377\377\307\243\363\350\254r\327\312\242m\333\326\310m\266\224)o8\035\r{\275\307\310\224c\026U\374\217\021=LL\bw\270\030,\005G\250\f*\201\013T"
+	.ascii	"\n\364\223^\262\357S*\227\270\244\223*\247:#\235\220\366G\347"
+	.ascii	"T\356\350\\\345\215\266\243\333\363\023* 0\203\231mq\216\212"
+	.ascii	"\200\241Q\t\326\0132\270$\221\220.\026\b\214\b\270\230\301\001"
+	.ascii	"\270FWa\230\303\365\354 \376\f\214\027\303\365l\020\376\f\214"
+	.ascii	"\227\303yf\020\376\f\254\027\030\256KP\036\203\353a}\034\366"
+	.ascii	"\265TVx\013\312t2\257\260m(p"
+	.text
+	.section	.gnu.lto_.lto.f646eebe4f79aad6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashDeviceInit.14.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"e\b"
+	.string	"VP;7Po\322\001\300\247\2525l>>\214z\f\007M\016 \005\337\264\fK\213G\226 \310g!\203E\244\315\230\310Z\315\314\324\375\272\356/q\363\235\363\244_m\333\356\235R*"
+	.string	","
+	.string	"*"
+	.string	"\232G\333N\350h\336^9JG\275d\230\254v\353\204\033\337\3766?\300\304\375\001xv\327\2573i\334\360\266\rlwl\247\004\317du\3252S\273\245\030\230]\211(\036\2665{c\373=\373\037\007\321\036bq\201\335\223\312\311nE\360\201|t=\201\346Q~ \365%\231\334%\275\363GN\022\341w<\032\313\242\237QT\274w\207\027\271dI\251\\T\030\220\263+\367 \312~fw\327\360\344\f\226ht)l\f\3424`\037\007\321\304hh\302\242\013sd}\036&\210b\223S\340\013\"D\247\304u\321\351\272\207'C{H\360\302\362=\n"
+	.ascii	"`I\231XpWL\026\036\342\311\004\351\343\333\270\214R4\032rC\230"
+	.ascii	"{\225<"
+	.text
+	.section	.gnu.lto_flashIsReady.15.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\315\b"
+	.string	"\226\020=7@\217\322\001\230\002\360\2176\002i$\325p3\351\025^\3540S\375\277xX\374W\377\325\f\r1\334\226\370\327\370\031\006\302\2204"
+	.string	"[v\202h\002x\251\355&R\246\024,"
+	.string	"+"
+	.string	"."
+	.string	"FH \271\364\317#u\026\210\006\ff\367\213\312z\351Y\362\357z&\342J\361T\246'"
+	.string	"\303\356:=\325\306\255\267m`\373\300\366K\207\276(sx\025hy\2352f\177\246\324\016\373\331\352\312v\032j:3\375L\200\013\313Bl7\025\213\331\025\250\022b\233dk\002\247{(\251P\0258Pj\262\r\361\223\220\266\213\342\370&\030\233\326\032e\016S\t>L\361\222\221\266\273\034\237\344\257\316o\035\332B\224\367\002\366l\036\272N\204C\354\270\317\005\210k\210\022\240N(z\270.n\006\274M|\270X\261m\\\324|\373lu\005\265\340\244\031\326\344G\016\023i\273\001\r"
+	.string	"2\241!\f\314\371\202!\270O\321CeL"
+	.ascii	"\313\017\325(\256\211;#\310\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_flashWaitForReady.16.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"e\n"
+	.string	"\226TJ>0\345(\035\340\341\261=\276\036\344\037\034\310Z\323\200\365\264\202\307\307;\370@m\234\200b\337\364\207\337 \rb8\033\023\260\3653\202\204\206\024O\203\370\026\260q\325A\360\035\310'\233\354\235R7"
+	.string	"7"
+	.string	"8"
+	.string	"\325s\004\356u\373\001\367j\333\020\021(\247^\252\260\356\202\221\310\n\354\226\036u=\365\231\362\017\363\255\005F\200l\251>9\025\273\353I\266Jnz\333\r\266%\3543\004\252IS\354o\273\273\246(\346\036\373\267mz\322\351s\fh\001(\004\354\262j\264\005PoXl\243\354\216\3559\355\273\374\005\365\330\207\007vOf6\273\345\203\035\272\007\263I9:a2BU\266\277\323ht\273\" _\006R\352^'\356u\322\205\025\203\2379u\273\013\362c.\323\341\277^-\216\363\344\253?r\257\247\t\003b\253Y\263\313\342G\"}\026\246\021\034\225>S\201E\237\f1D\302\360\304p\344\361\205\027\336\306\027*y\242P\364>\n\0069F\241g\002\301\320\353\224{s\324\263\242!&\230\033}\371\232\261\333]\235\f\f"
+	.ascii	"2\003\302\260&s\002,\361\024=\260\306\004\260\374P\215\322e\224"
+	.ascii	"\242\306?t\bc\272&\031"
+	.text
+	.section	.gnu.lto_flashEraseSector.17.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\345\t"
+	.string	"\266\323E90\221\322\001 B)\243\364\2140\354\317zL\314;h\253\323\372D\347R\f\276\332\217\271+j\005\006\223\337\236\351\237\021\f\2060\244\316<\036\2245l\n\225\221F6\331;\2453"
+	.string	"3"
+	.string	"6"
+	.string	"\b\334i\301\005\266S\355\001\333\251C\373\346c\311\376%\306\001\303\331\335:I\036^\206\376U\356\021Y\251\313\016\303\356Z\212,\217{\336\366\201m\005\373\006\001rf\217)9G\354k\273\273\236-\373\257_\233\322RJ\177\003\370\240Y\210\331\355\230\345\254\214\316\230t\266/\355\243<%\374+\303\236]\221\230\314\356\230\34019\335\205l\314\224m\210\273\230\270]\r\220\017\303\3608\027j;\225s\300\306\024oAq\273\013\362W\316\002\372\256S[\234\344\305S\377\264\235~\322U\315\311K\025 H\372F\243P\307\242\317\003\030\212p\250\340G\272(}\243*Q\n\231\252\350\003\353\207\300\336\004\351\253\025\236\367\325n\334k;[n"
+	.string	"\221\251\346\312\235\324\346\307\303\234\270]\325\305\r"
+	.ascii	"2\241%\0348.\032\202\253\024=\256\306\004T\226\207T\003\026L"
+	.ascii	"\271\004K\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_flashEraseCompletely.18.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\245\b"
+	.string	"\006\220;8Po\322\001\240\363\241Dj\246i\212\215\212\335\020\300\320\247W\334\252\316\235Ck\204\240\0274\f\315\"\244\204\310[\347\252\021\r\"3\325\255b>\007\004\013\215\336m\313\224\002)"
+	.string	")"
+	.string	","
+	.string	"\2309\333\345\252\216=J\312\305*fw%\3448w\345\374\207<\3403uW\200\204\335\265~\246\214\033\336\266\201\355\003\333/\001\377\036\375m\363x\030I,2)O[\266\252S\270a_\263\360d\253Z\257~\034\370XA\200\331\305h\315,+\252x\330~\336\277\023\205\3064J\260\263-\272Iv\355\226:~\211E\304\205\032m\036\025\022\264X;\311\350\332\335\216?\362\324\204\217zt\305\246\001\376p\0324\217\003\203\324&\210\"4\027\344C\310#\222\237\251IN\2013\b\320\224\022Y6%\246\332k\026\236\024@X\036$Y@/\362\325v\355\006\r"
+	.ascii	"3\241!\fl\371\216\301\272J\321#eL@eyH5\240k8\302\020\376e\\p"
+	.ascii	"\351\026\355|\002"
+	.text
+	.section	.gnu.lto_flashPageProgramBegin.19.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\005\n"
+	.string	"\266\323F< \005)\035 !\210\002*\236\n\302\255\341#m.\256j\355\030\224\r M\026W]\355\307\\Z\325\003\203\311s\341w!\001d"
+	.string	"o\024 \315)+\301|\204Bj\244\221M\366N)3"
+	.string	"4"
+	.string	"6"
+	.string	"\t\334\251\301\007\266S\355\002\333\251C[\366\221d\017c\323\001\003\260\273u\216<\274\f\375\257\334#\262R\227\235\206\335\265\024Y\037\367\274m\004\333\013\366\017\002rf\217)9E\354k\273\273\236-\373\257_\233\322RJ\177\0138\301a\270\331\365\230\005\330\030\255)\351l_\332O\271J\370\227\206=\273!34\273\243\202\0031r\272\003\341\230)\333\021\1771q\273\033 \037\226\341q.\324v*'A\216+\356\202\342v\027\344\263\274\005\364]\247\2768\311\213\247\376i;\375\244+\231\311K\025 H\372F\243P\307\242\017\004\030\222x\250\340G\302(}\243:Q\n\231\252\350\003\353\247\300\036\005\351\253\026\236\367\325n\334k;[v@\211\251\346\312\235\324\346\307\313\234\270]\325\305\r"
+	.ascii	"2\241%\0348.\032\202\253\024=\256\306\004T\226\207T\003\026L"
+	.ascii	"\271\004K\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_flashPageProgramContinue.20.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"-\013"
+	.string	"&\026N= Q\325\030\244( ,\211a\314\232\303\341\323\fr\334\025:\345=\021\260\006\b\2755\022r\005\fI\333\306\306[\200\354\246\026H\021\340\005q\034\342\336\026\247\021\013\360r\223-\267\224)\005:"
+	.string	":"
+	.string	"="
+	.string	"'\271P\375\237\244\t0\313~&pYb\036pY\266ke\370\003q\247^d@q\374\237\361\203;\303\256v\tC\274\021\310\360\301\340\177\2417\332\340F\267E\320VAk\007\001\215\244\326'[\332d[\026,\214\260~\004h\001cA\352\327\320Q\343\033\222E\210\266\216\264\205\237It>uU\310\337\201C\365_\322\211Y\036\260\f[\213\360\210\316&\013\026\360\215p\300\020Am3N\021\001\373/Pj\024\0256X\351sY\302X F5\247>\330\177J\215\362\211\tu\311\262\234\007\332\363\\\226\216R4\203\206)\004;\332\017\004\243\207\326\326\377\007\230\016\004\316Ese\235\314b\2652\301p\231\346\301\344\266\013\205\314f\231\234L\266\231\225\215\233\023\003\325$\\\266\331\321\264mF\276\333z$\265\301j#\024E\005"
+	.string	"e\264\242Mx\205\007\373C\366T\300\030\020"
+	.ascii	"2\241)\0348\\\f\b\204R\3648X&\240\262|\2513\030L\260\346\032"
+	.ascii	"{\f\363\002\201\301\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_flashPageProgramFinish.21.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\245\b"
+	.string	"\006\220;8Po\322\001\240<\001\fY*z\305\301e\372QQ\214O\257\270U\235;\207\326\bA/h\030\232EH\t\221\267\316U#z\266k\366\275Q\336\006\224\021\032\275\333\226)\005)"
+	.string	")"
+	.string	","
+	.string	"\2309\333\345\252\216\375I\313\305Jfw%\3448w\345\374\203<\3403uW\200\204\335\265~\246\214\033\336\266\201\355\003\3330\001\377\036\375m\363x\030I1\037)O[\266\252S\270a_\263\360d\253Z\257~\034HYAx\331\305h\315,+\242x\330~\336?\023\205\3064J\260\263-zIv\355\226:>\211E\304\205\032m\036\025\022\260X\373\310\350\332\335\216/\362\324\204\217zt\305\246\001\376p\0324\217\003\203\324&\210\"4\027\344C\310#\222\237\251IN\2013\b\320\224\022Y6%\246\332k\026\236\024TX\036$Y@\037\362\325v\355\006\r"
+	.ascii	"3\241!\fl\371\216\301\272J\321#eL@eyH5\240k8\302\020\376e\\p"
+	.ascii	"\351\026\355|\002"
+	.text
+	.section	.gnu.lto_flashPageProgram.22.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\344"
+	.string	"\025\f"
+	.string	"\266\227S@0\217\323\030l\215\310\\@\002\324\030\272\035\306\332\3216<S~\351k\022\206v\320\357\036\0339\311\023\026D\033\334\207\252\376c\243?(q0}\302q\267\252\201\320[N.6 I\266\224R\246\024>"
+	.string	"@"
+	.string	"A"
+	.string	"\231C\031\232\371;\260\264\374\333\246\n\244#\002\027\220\034\241\tH\216\315\332\030\336B\334+\243\022\025\321\377\351\201pf\227\325VqF3\361\330a\036\374\257\323L6\270\317m\023\264m\320\332B\255Sl\311(vt\310\206\321\325AW\313"
+	.string	"\242\027\016\\\374\032^d\334%\262\020\321\326\232\266/\245-\240\200\223x\320Z\376o\312\300m.\221\031\345\202\007\374 \321\002\351\330M\332\265\036a\022\001*\334\253\206C\311\363\264\355p\n\216\374I6j\024\030$\310\023\021\311\321=\0030\n\342\023\"\362\377F\275b\226\253>q,\205\351\254M\311\321/\216\314\030\205>\356\245\335<\356}h\r\377\277\017\024\036\235\216\020\353C\242:T\005\347\264\260\252\2420\345\320\360\230\324G\204ibV\005\016VM!\034\nd\342\300\346\244q\240\327\004\013\233:\327\205M\232\355\206\177\240B\030\271|\336H\0018\351\305\007\237Mx\305\224\377\307Z\023"
+	.string	"2\241-\034x\\\f\b\204R\364HY&\240\262|\2513\244L\260\353\032\033`\343YB\001\240B"
+	.ascii	"\34175\005\356\005SS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_flashReadBytes.23.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"U\f"
+	.string	"6WSB \217\223\016\203h\001\001x\310\312\207~1?\021Jh\"P\202\370\320\006 \232\332\001\355\252Y\274\007\263\021\307)\"'\213\277\2516\020@\020\022zA\002\216\234"
+	.string	"\303\2042:\004\303\266\355\336[\356\224\002="
+	.string	"@"
+	.string	"@"
+	.string	"\273i\214@\036\332\366;\334Cf\257\274-\203\351#/BNX\354n\225\371\200x\370. \036\352\310\263\273\314\377\311\037\207\024\024\315D\272\263(\330];\315$r\353m\037\260\355\261\017\022\362&\177|\311\017\217\372\037tv\317\371\227"
+	.string	"\"*<\251\335\n)\027\233\002\236\330`;\2631\266\325\304+-TvW\343\216\333\016\"{I\204\003\330=\241H\260I\337\035%\301\227\335\013\037T6\245k%\234J\355X\bQ\222\355\214\223\030\311]\n\034\177\004\b\003I\362\021\017\235\032\320`\216\213\370\220\273\313\361Q\236r\371$\207v0\335\265\031\017\257\004V\240J.eo$\247\030\354\277\325S\032\036\031\035\326F\304,\221\350\301\2028\247\205\205B\037\213A\033\215\371\331\020U\023\263 \214\260P\3251\372pT lV\233\002\276\032XX\345q]X\205\331\366o\365$5S\322\t\306pQ\241>}\210\233\230r7\027"
+	.string	"2\241-\fl\022\215\001\201x\212\036-\313\004\260|\2503\254L"
+	.string	"\256\211j\023m\\O\377\314\306%\312)\341\"P&"
+	.ascii	"\373`XS!p\327\bm\204\237\316\230\204I\006"
+	.text
+	.section	.gnu.lto_flashFlush.24.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\235\b"
+	.string	"\026\220;8@o\323\001x\r\275\211\001\262\272\352\305\262\b\227\231\f'\220&Z\357<\343u\220F\3521\214R\250\321W\337|\374<\r\t.\270\020;\220PI"
+	.string	"\016\372\266\377\226)\005)"
+	.string	"*"
+	.string	","
+	.string	"\277\314\331/\017A\366*\030\027\251\230\335\235\361\343\334\225\363/r"
+	.string	"\260\324]9\007\273k\005K\032w\274\355\002\333\006\266a\002\233\036\274\364\267\315\345\243\374RdP\236\256\354\260\323\350a_\263\321d\253Z\257\276\024\330`Ah\331\315X\315\254J\256\204\330\016\326\256w\020E\243\257\216/v\266G?\301\254\335\317\343\233T@X'\322\346R\343\200\213\265\227\220\254\335\365\370$GI\370\247KS\004\006u\030\264O\303\302\324\262\320\204(S\230\016\242\317h\2022mv\b\214=\204\262\031\201a\331\274\302\275f\243\311\t\034*/Z8@?\362\324\026\r"
+	.ascii	"2\241!\0348.\030\202\253\024=R\306\004T\226\207T\003\272\206"
+	.ascii	"#\f\341_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_noFlashGeometry.25.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_flashGetGeometry.26.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\005\001%\r"
+	.string	"\206Y[C\020\221\223\016\033\025e\361\332\364\204<\232lu\315V\021Kq\2068\013\356\237\037EW2u\263\323F\215\340AC\327\021\307\222\027\377\340C*\202\240\310 \"\004\bZ8\002B\267\277.%\b!{K\231RH"
+	.string	"F"
+	.string	"I"
+	.string	"\273\036f\357\001\250G\353 \324\243\212\270\366\b55\177{\\\360\342\343:\017\207\220"
+	.string	"K\217\022\005j\266\231\253\013\245B\020\027\030\247M\247\001\"8\301|8\351\331\322\255dV#\273\353\344:\321M\3356\003\333\007\354\177\002\237<\367\350\177\250\307\353I7`\212\201\"\006\224\237\355m\251#\373\372}\337g}\261\235\256\234VMg\246o}\324\260\241 \307n\207\217\307\322\304\031\023\266U\354\313Oq\025*\326\004x#D\033\016 XX\324\004\273\240s-R+\005 \222\241\t\351\346\227f\2048A\035\371\034*\365:\"\334\304\261vC\"~)C'5\301\215\333\333\236'\030\027\031\252#?\205\2726(\341\b\345\016\333\025\276\"\305\332]\021_\346\236\307'\361\350\013\001.\t\201\340!\221\360"
+	.string	"\363d&\030P2\007\330\004\024\022\016V\222y\260\220\001\356P0\3110\013\235N\206]\336\036\256\2768\325'\232\225\351\023MM4N\354n8w\322?`\245\252-\266U=\002\322\025\270\273\033\257|\314]|\254\024"
+	.string	"\n\013M2q\024\363\036h\305W\362\0200\2065\035\202Ih\233\020^\261."
+	.ascii	"b\211)\226\006\n#\314\270f7L\344\343\267\020\241\\\254\356gY"
+	.ascii	"\023\n"
+	.text
+	.section	.gnu.lto_flashConfigurePartitions.27.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\331\t\3753"
+	.string	"\nY\260\023DP^R\007\357K3\240\336\277\275-\367\277\217\243\375\024,\275\\\234\377\327\253\350z:\031]\233\327\332vs6X\220\033\214\242\f\200`\260P\\\007\200x\034\f]\024\005\343\032[3\2625\313\335\366\336R\246\024(\001\025\001.\001\357z\025~.\376]\312\336\254\351\317\374\355\200Tu?-\\\327\306$\300\357\036h\233\334\205\357\352\247\272\320\177\354\247\361\2239\301{\rn\356\315\311\331\273\332\340]g"
+	.ascii	"\277{\374\237\367\335\374\312\367\335\330\035\316W\273\366\317"
+	.ascii	"+\215\252\013v\357-\244\237\030\375\367m\365\035\250\343_*\223"
+	.ascii	"\310\243\261H\034\n\203@\370\367\272\255\316\261\177\360\371"
+	.ascii	"\364\313\337\320\026\364\353\225Q>\331BH{\216\371\273*(-\021"
+	.ascii	"\f\216\225G\336UEY\363\312\307\256\226B\222lT\362\305(\\W&\376"
+	.ascii	"\206\334\376\237[P%?\334\202j\275\360\357\252\264\250Y9\330\302"
+	.ascii	"wUX-\005\252\fD\300\005\275z\270\2650\025\363\372\273*\253V\227"
+	.ascii	"\241\225\371+V\376\275\231gp]\033\323\263\005\275\372\267e\020"
+	.ascii	"\275\026)>\247\332\0374M\334<\365\021X\251\372\312\256+e5[\223"
+	.ascii	"\3664\362m[\200\252oJ\002\354\023\233\360)\225u\253\274\n\223"
+	.ascii	"W|\366h\035\344]\301\372\272\317\316gT\316\277\241\275\267\347"
+	.ascii	"\346\023\372\376\363\356\277\304\335?\270\303j\002,\340\275\245"
+	.ascii	"&\370\343!\271\bj\t{N\367\344%\214\366\244\027\3261\314\330H"
+	.ascii	"\345=\376u\016\343\323$\301{\357\t\376h\376\216\310\377\353]"
+	.ascii	"/b\346o2\365\327}\376r\202\215N\311\240r\326\275\032\225\265"
+	.ascii	"\324\375\177\212KM\033\327N\334\005\274\365=\3000;\200a\366 "
+	.ascii	"\235\035\350G\230}\371o\357\312o{O\352\354\310\2430\273\361\347"
+	.ascii	"\336\213/\367N\ff\037\006\263\013\201\331\203@8;\374{\262\367"
+	.ascii	"\366\227]\377\262\3477\373'\3700;\354\034\021u{\017\311\362m"
+	.ascii	";\227\215\312[\377\337\376\333\376\345\376\347\376\311\376u\177"
+	.ascii	"\177\272\257s\027z\216\257z\013.,9\334\347\374\257r\376f\342"
+	.ascii	"\252~\304e':\246\366o\376p.L\213\275|\233\277[\227\230\313\263"
+	.ascii	"\2717=\0317\240\267\367\3761o\365_\023\023\357\370\252\273R\344"
+	.ascii	"D\307\366\336\302\035\376bv|\030\246v[U7\364\005\035v\f\273\001"
+	.ascii	"\366\342\237\366h\377\245\351\3010\375\236\252\002\ni\243V\001"
+	.ascii	"\016\300\030,K\215\310Q-\3420=\206\213\017\303\0244L\250\245"
+	.ascii	"\035\332\310\241Y\201\277\347\377\372$\332\250QY\177E\215\324"
+	.ascii	"\316X\313\213D\226\205q\251\223\306.\250\245nL\203\217Z\263y"
+	.ascii	"\033<Q;\177\357o/Q\177_6\233\345\003t\360D}\324o\346]\354\265"
+	.ascii	"\214~2\245\231\005k\251\376\002\257Q+\231\355\305y\274\345\263"
+	.ascii	"\361\324\305\313\023\353\353\243\301\b\206\207\345\363|\034\374"
+	.ascii	"\277\230\336w\215\332\305\313\323\362q\257\207i\201^\363\343"
+	.ascii	"\334\215\036\033S\037\255k\357M\341\335\217\363\f\237G\303\005"
+	.ascii	"\275;\217\207\203{\370\220\277\371\341}\267\250\377\372\013\300"
+	.ascii	"\360\314\326\244\035\321\324l\226\357\247\263\331wz\263\376\351"
+	.ascii	"|f*\032\345!\236\316\210|\345r"
+	.string	"\023\235\306\221\271S\367j\251\347\254\317\336\304\236\t\221\276V\230\324_W\202\006\001i\327\3247\207\332\211\342}\035\303l\317\375\304\277A\341FF\n\370\213\306\373\356\353\247~\236\302%\346.\363\333=\033&\2747\3247\367\202Z\250\227P\252\235\224~\212\340%d\257\325R\177\026oP?\035\025\237\027LJKHL\227\271Ddtd\204DT\004\344\3014B:r\225\222\226\212\230(\214\220\230@/z0\003\007Q\r\031B8\224\230:\216\224\214\204\220\216\210l\b\025)\341\020z0\300\223n0\225\204\226\222\222\224\204\204U\2507?\004\245\243\336,\265\324\235\250t\311i\337\021H\013\320N\367VW\311LZ\350\225i\322\201\372\005\357[\243N7\364\254y\310\277U+\236\022\273\374\371\200\210\251\357\331\225\226\267\371\200\362)\265\3243\026\323\322\352n\"_\305T\tV\317\220\2554(@\022@\177\237\346\021"
+	.string	"\332\3107\3518\370 \r@\277Uuq~\240\366YRK\375\r\362\374\314P\177\363\377\362\370\212\273\345o\272\333\373nP\236R\321\213N\255\004\250\245\361B\262\031\341\210J\r\244\235\276\347\201\364\257=\262\254\217I\2354{h\216\305\037\255\331\f\033|R;\237>\331\356\275\2671\251\177\364\273-)j\251\347\217\247\357\222\315\343-YH\020 \331\271d\313?Vd\037l\236!S\345)\245~\270\352\336O\304,<B\240\376\254,\301\237n\265\323\207ZZ\347\265\016\200\304\250\201 \303\230d\212\220\210\210\210&I\322\001\220\002\021)+\333\022\300v-g\035\242\221\3214\205\375c\f\"%\354\206!*$eK\3618a\225pZ$%\324\247I\233\272\350(9\213<\271\004?b\207\235\352\312\242/E\345\001\371\257\017"
+	.string	"\032\254\031\330\260p-\031)\375\226(\210k\310=\030\300+\031H\253\257\265Q\212:\346\342\366\303\220\337'3B\271\3708YG\200\216Q\025\271\342B\352N\234\037\003"
+	.string	"!R\013\262i\266\372\372\235\030\312\235'\350#+\3163\226S[=J\333\265\336\2362'\1770A\364\301\301\340\f@#!\\U\362\341$\362\320\361^u\226\236f\254\255\301\233W\321*\300\315\bP\260\314\321\210\235\"I\216\276`\372\363o\n\211\3017dU\237\355F\t]_l@\373Z<gw\356!2-\214\b\016\024\353\357\347p\371\372OW\221 I9\034\370\b<g\263j@\"~\0245<\221\224\370q\340\275\322\037F\363\251\025|\327\006\341\304\002m\321\375&#[\222\301\226IM\303\204\224V\370H\223\254\213\232\t&\3756\242c\357\251\276[\rJ\204D%\376D\361s\005\310\333+Ow\n\315\254\007\364\2263h;\360\323\205"
+	.string	"\362\233\342\2043t\260^\340\020\206\273\370)\203\025\372K<c3\034\302\013H\331\351\002\373\240\354}FV\031\273\364\235\3419#\246\253\242\026\bV\330"
+	.ascii	"\306\226\246\264\210\317\002\0305"
+	.text
+	.section	.gnu.lto_flashPartitionFindByType.28.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`V\002\r\024"
+	.string	"\266\346\206I\320\360(\035Z\270\r\233z~F+\2324J\016S{\233\325a\352\306\tq\207X1\254\231\224 .\264V\202\252\376\253\024"
+	.string	"wk3\317}\255\016\276\344j\006`S\244\262Y\nS\375(\364\330S\204Y\364\244\221\275\345N)r"
+	.string	"k"
+	.string	"t"
+	.string	"uD`\003\341)\201\371\235\243p1-d\304\241\361hb\021\343\023U\353(z\274"
+	.string	"\3604|"
+	.ascii	"\360to\254\372\034oP\322\256\002\351\\I\363kW\315\260\326\372"
+	.ascii	"\221\213\231$6\t\232\2509}pt\003\227\353\3609\027\244\310\021"
+	.ascii	"\361\221\3130\227\247g\364\336\245L\356&\367=\227E?[\r_\256\346"
+	.ascii	"RURk\265\304\345h\356\360\266s\266\033\330\262%rmd\fA!ym\354"
+	.ascii	"U\370\361W\375\347\246\226\236\347\335;\245\345J\337\343;\037"
+	.ascii	"\242p@\b\252\225\303\224\216\212D\211J\374\347\347]\332\267\357"
+	.ascii	"\343\367\314\362\177h\25703\253\rM@O\265\216\t\302\363\370=f"
+	.ascii	"\361\\\024\326f\302\036\220\357\251\326*rj1<\275\355b\263lKi"
+	.ascii	"\177w\025.\037[&\200z\013\241A\250\006{C\002\007\202\256\316"
+	.ascii	"w\322\331-\335\325\3128d\b*i\256\316\252\225+\343\331\270I)\177"
+	.ascii	"\345>f\207%<\006\214\376\224r\210\206b '~QA\027\242\201\247_"
+	.ascii	"\372S\322\331\375\005\255\300\022\3166\313]Px\017\247\326Jrr"
+	.ascii	"\240\030\203\245Z\253\202\026\367Y\360G\234z\266\"\217;\365W"
+	.ascii	"\300S\272\357}\3468\242\201\253y\221S;\326Z\333\325\331c-/\225"
+	.ascii	"\226\013\346Bi\231\254X^.\024\030}\245`P\2316\031\2310kU\210"
+	.ascii	" \316d\257\0130\231KD\201\265ND\023\331L\034\031\340X\312K&\252"
+	.ascii	"\304b2\221\345\372\265\361W\334A\323\214^\020x\030\177\357+'"
+	.ascii	"\235\335\\\355\234\353\222\227\265%\251Vg\020\037\rw\231\244"
+	.ascii	"\310we\356\"p\367;xL7)\365Yk\255\340\201\357\206\373\236\323"
+	.ascii	"\250##\030\01769%\003) 0\002c\030\265\033\034\202\230\232\201"
+	.ascii	"\374nAV\330u\252`eG\007l\3532Iv\212Pq\342\262-Z!\215,\274\003"
+	.ascii	"\032=5\247a\247U%\326k\260\007\332\222\307\341\304N\264\023\f"
+	.ascii	"\355\031\270\352\253h&\326\372\206nI\360q\242-\031\255\307\335"
+	.ascii	"\215EhV\017tAb\007\021\021\r\316\275Z\363\004"
+	.text
+	.section	.gnu.lto_flashPartitionFindByIndex.29.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\375\f"
+	.string	"\326XZD"
+	.string	"\261&\035\363\324\3738d\351\272]\262\201O|X\332\343)6\202.\221g\024\032!\266\353\t\341CZ\267&\363\346W`d\204t\275\2045@Um\0304\031\373<\313\311\324r\021;\364\325\354\336[\312\224\002G"
+	.string	"A"
+	.string	"I"
+	.string	"$\227\006l1-\242\0201VX<\273[\364v\001\360\017\364"
+	.ascii	"\360Oa^\272\323,\371\246\273"
+	.string	"\020\0310P*\016W\227\340\306\207\225Hur!\026\0324_=S*\225\314\217\310\356:Q\252\226\373\3356\003\333\321>\026=\366fJ}\261\357V]l\247\341g~\347\264j:5\375\317M\214\340\301\341@g\227\245\207\307\316x.D\330&\331!\333\2326\002\005\244\317h\260\356\202\330\321bw\373\360\001\320\237m\237\304K\004\273!&W\201\031\210\331\335\005)\316\252\340\313\374YCA\201\177P\225\265s\302a\321AaL99T\257\017P\334\250\244\016\3734?\341\027\276\2141\330&\217\372\363m\003\377R\001xpz\375\352\005vtN8\255\036)\031\031F%'\3273\tH\004md\002\204\250e\243\013WV\022O\256\021\223H\222i\021\204\2001\n\243,Z\300\260,\206\266\275\272\370\223\262\261R\243\260A\316M\253&\375\022TM\251ER\364\344\364\305+.\321Q\2667\274%\341\243\306\006\023"
+	.ascii	"\037\023\360\324\361z\026\337`C\201\331\222\261\261\341\307\352"
+	.ascii	"\373Y\267\261I\201\363\007\252)\002\200\013Q\326\f\3275q<\023"
+	.ascii	"\272b*D\251j\240\271\024\024"
+	.text
+	.section	.gnu.lto_flashPartitionSet.30.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\007\005] "
+	.string	"\006z\312I\220\026R:\301\273\004\303\250\313\200\201\340\301\017\245/\363\f\275\r\325`\234\213\261:J\fX\274\203\3052%\206w\347\343\275]\211^\306\354\217\025"
+	.string	"\300\004\361\346m\216S\360>8\305\2234\361\346>\234o\326\366\t!r\247\024\264"
+	.string	"\251"
+	.string	"\274"
+	.ascii	"?2\374\361\307\267Z\231\302v\266\233\007\256;o\226\2679o\232"
+	.ascii	"R\373A\204\341\235\200\274\265.%\301\252\365\330\300\013l7=\264"
+	.ascii	"\321~\334Q\237\314R$\005\246\326\272[\035\256\275<\336&\035\036"
+	.ascii	"w\263\325N\263\\:\364qE\027\3071!)\375\206\200\t)\351\266\362"
+	.ascii	"\001U\321\352S\216j\224\001\206\240\005y\220#%Z+q\312\204(}\312"
+	.ascii	"QRi\223TUvd\021=K[\255u\246HTN\020\242&\220\031/\313\nODx\314"
+	.ascii	"\024\207\312\205Bz\235\353\324\250HD\367Z\247]dBU\250\2123Nk"
+	.ascii	"\030j\255\246\304\"\322\235\273m\244\355\017v\351$F\373(D7\307"
+	.ascii	"W\226\0271o\016\273\244\326\335\324\250m\276u\327\034\352\247"
+	.ascii	"\371\361\237\001\360\254\033w\247\337\366\251\333<\251\313\223"
+	.ascii	"z)5\245\324'pJ}\365@\333*\307*\243\314\230*fj5=\353\337\372\247"
+	.ascii	"\276\366\375\253o\371\\\316Y\275\352Y\276Vrx%\307\262{\236\304"
+	.ascii	"\027\232\234\226\234j\255\271*\337\252\347Kb\234%;\\\211\237"
+	.ascii	"t\256\347T\356:0t\254\305\n`XN\033l=v\356\346\217t\316\217\272"
+	.ascii	"\324\360S>\257DG7\2433-[j=2\270\351\fG\233\241~J\232:\204\003"
+	.ascii	"\006\205\245\366\215\004\347\315\357S\223\331\322S\215\002\311"
+	.ascii	"1\036\2655j8k\202\2742\377\344\347:\207\263d\321\325\326\254"
+	.ascii	"n\215\374\344\272=\362\003\240\322nt\031\223r\256\321\002\250"
+	.ascii	"\312\233\335+\224\301qk\344\256\023\267OCre\210\206)k\255\325"
+	.ascii	"\3049no\366Z7\301\200y\021-\t\351\370A\274Q\256\3216k\333 \022"
+	.ascii	"+C4\214\217\345\336\305\200L\2622\"aQ~\002\206\220\201\001;\024"
+	.ascii	"\237\363\246\315\232deE\214\034\353N|\024\230\021O\274\211\357"
+	.ascii	"\310\035\265\326\t7\217\345\022\377\372Y0\253\265J`r/\024\276"
+	.ascii	"\217\233V\001\244'\002\317\2335{\256\227_\300\302\2104\202h\231"
+	.ascii	"=\326\352b7>!/\347\227\243\303\353\335X\370rt~\346OP\250\343"
+	.ascii	"3st|\267 P\330\363y\020\006yB\236\234o\347GX\272\347\300\004"
+	.ascii	"\017/\005\211\035O\320\267\342\027\314\331\351\374x*v\275 \317"
+	.ascii	"\316\201\001\003w|\301\235\020\b\f\356r\307 )\307\020\264B\270"
+	.ascii	"5\032\350H\024\333S\332\251[s\215\354rm\020\347B\263\345\206"
+	.ascii	"0\363\332\265E|\313\210\231\335\3351\273*"
+	.string	"J\263\255\335;\032\220\004\037L\350\013pF%\331\360\326\013$1\2675b\361\271\261\335\342g>\b%~\345\227\300\n\200=\031\"\r\272UN\344\202\363/\335\363(L\213.\250F\331\326\350\363\376\330\251\270\313\367a\236\271\314\025d\250\241(\244\fB\214\021\021!\021\031\211!\035`\002\021*\264:\021\340\255$FZ\222\302\264\033]U\202\314\311p\"n<8\2525\271x\231\306\037K~`\204\324!y%\371^\340\266\355\313\321e\351\273s\275{c%\300N\353\313\365_dX^\316\342\245\353\331\267,oU\246\035\354\f]\rU\316\3241\365\006n9(\261\225\022J\272Q\024\311\311#\"\037\320\3627d\231@\245Z\215\262\223\373%\334\220\254%\326\267FDM\202P\265I\026!\200\366\211D\231\205\255\257sO\331aR\322]T.u\002\370d\215K\320\375\321ji\374\225\0308\223\211i\225!X"
+	.ascii	"e6\301\274%\332\362\f@\213f\207\"M\331\237\337e\326\005\201\016"
+	.ascii	"?\373\363\t\242?\021fE)\237\267\223\276\224@\005"
+	.text
+	.section	.gnu.lto_flashPartitionNames.31.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"m\b"
+	.string	"\244\016\324"
+	.string	""
+	.string	""
+	.string	"v"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\350\351\n}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'5\230\316\006}\276\005\005\001'@\330\315\006}\301\004\005\001'K\230\315\006}\304\003\005\001'V\330\314\006}\307\002\005\001'a\230\314\006}\312'l\330\307\006}\314\001"
+	.string	"?\202\210\2008{3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\nLOGINDEX "
+	.string	"\013/root/repo"
+	.string	"\033./src/main/drivers/flash.c"
+	.string	"\nCONFIG   "
+	.string	"\nFIRMWARE "
+	.string	"\nBBMGMTLASHFSPARTITION"
+	.string	"\nUNKNOWN  "
+	.string	"\016"
+	.string	"D\205\302s\206!\274m\300>\260\037\310\017\354\007\362\003\373\201\374\300~>\363SP\233\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_flashPartitionGetTypeName.32.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"=\013"
+	.string	"&\325M>"
+	.string	"Q&\035T/N=\256T\032\350\334\346\316\347v6eY\217>\205|\210E\016z\310\206\"\004?F\373g\357\237\331\bPUU\257\276w\265d\270\246\264\247\350\006\026j\021\331{\313\224\002:"
+	.string	"<"
+	.string	":"
+	.string	"\236\027\260]B\036`\273\204\251{\217P=\037\364\030Y\311\\1X|\032\016c\001\0173\305\361\215\342\201\031k\366\326\265\364\211T\037\224\335\265\222>\323-o\233\201\355\211}\004\001\276\274l\006\215\006\004\330n\206\216\332\302\220\261\021\266?\266\304\266\252\375\023g}>=\216\354v\250\271\330\235\n\234"
+	.string	"ri \332\366K\334\304\307\336\200\2512=B\2500\274h\273\223\013\273\273\300G\361\027\005\037\304\245-t\364\244K\277\003#+Y\215XH;\224C\213\033+ Dy\273gS\270\201\304\007\327\213\221\332\260'H!\312~\334\3355<9~\376j\r\027M\207\023m\231<\330T\"8\3406\335\245\002\246k\300M\300T$p\226n\303M\b8\243\271t\034'\223\3518\311\334\303\2237\031\"T\300\324\367\266\267\016"
+	.string	"FxX\202\246\204\240(^x\n\017\022\021"
+	.ascii	"^\005\314\323\031)\013\320\214\025!\f\f\2049\215\261sTs|\315"
+	.ascii	"\325\254\304\005\025\236\332c\311\330\203v#)\001\251\252\241"
+	.ascii	"\350RP"
+	.text
+	.section	.gnu.lto_flashInit.33.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\335\013"
+	.string	"&\027TA"
+	.string	"Q5\035\030\341\357\376pb\206M\313\331|\3541\372\270\377\024u\365\201C\222Qp@@q\321\0224\316\277\003&\261\330#\220\362\200\257\377\177\003\032tO\3001@\302\020\361\222\220\372s\243\275S\n>"
+	.string	">"
+	.string	"B"
+	.string	"3v\253\305\225\354\324\365\024\3544\373"
+	.string	"\354\324\266\017`>\006\275\236FG\245\350\320\332\261[\2679\342\240K\220\377\325#(r\310\020I\341\245$\301\356Z\212$\017\367\274\355\002\2661\366\027\004\366#\273\273\236&\323\253\376)Ap*\205@\251\2308\352\216z\360\330\020J\243\204\355\373,\316\362\274\332rBG)\265\273\232\307\326No\177l\315\266\224\366S_\361\271J\303\003\354\232\\\001\033N^\3440V\027A^\244\363\254g7l\214\257q\303\f\375!+w\r\314\300_\377\002\234\234vC\027\375\326]x>\211SW"
+	.string	"\345\305S\037\304.d\220\027M\0011\361\0329\314\320\256\"9E\004\\\307\351x\n4k.\020\300\214\004\316\006~\033\f\335\367`\353t\231\t\233\346\003\267\013\001{\0246\337f\301\363\276M\253\241\233\316\t\210\017!\241)\262"
+	.string	"i7p Wg"
+	.string	"2\276F\321\f\r@\276\305cp\031\214\2734\001\017"
+	.ascii	"a\221\"34\030Ag\027\212\301Z\310\031\t\243S\201\201\020q\224"
+	.ascii	"!\330\256QcB<B\305g^\3051]\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\260\001E\b"
+	.string	"$\013\254\002"
+	.string	""
+	.string	""
+	.string	"\002\033\177/\353\344\246\206\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\013\027\200\204\001"
+	.string	""
+	.string	"\003\005\0310\f\035\r1\002\016\1772\200\200\200\200\004\272\200\202\017\1773\020\1774\021\1775\022\1776\023\1777\024\1778\025\1779\026\177:\027\177;\030\177<\032\177=\377\377\377\377\003\034\177>\340\365\321\330"
+	.string	"\035\177?\036\177@ \177A\005\037B!\177C\001\"\177D\037"
+	.string	""
+	.string	"\200\200\200\001#\177E\004"
+	.string	"\351\216\2513\001\265\001\003\005\027$\004\006u\004\007\b\t\n\013\f\r\016\017\020\346\242\323\303\001\026\030\003\026D\003\026\200\004\001b"
+	.ascii	"* 0\003\231Q73\206\261\313X\211c\266\310!\f\021\344\022F$9\204"
+	.ascii	")q\344\341T4P\237\312\247\311\0245\t\343a9\0032t0r\307\242\307"
+	.ascii	"\3147\026\337\210\360\b\377\306o\370\206o\374\3067|\3037\364"
+	.ascii	"\033\273\037\031\332\b\276\003\343\310x\314X\031"
+	.text
+	.section	.gnu.lto_.refs.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375 \351\265\003"
+	.string	"\302\306\023\034\240'\351\377\377\377\377\377\377\377\377"
+	.string	"\210r\255\337\376\377\377oD\214\276%dK)S\317\361\225\t\247\342\304Fj\237\032Q\256r\326\007\316\376JC\241\b\003$!\301\t"
+	.string	"x\r\313v\2247j3\352\027\375\244<\365Q\ry\031\337\036\375\217\020"
+	.string	"9\023\312\033\302\233g"
+	.ascii	"\030\b\b\003E@9P\030(\002\312\201\302@\021-\205\256\232kT\301"
+	.ascii	"}pK"
+	.text
+	.section	.gnu.lto_.decls.f646eebe4f79aad6,"e",@progbits
+	.string	"(\265/\375`\177'\335\243"
+	.string	"\232\376"
+	.ascii	"8Q0P\322I\007}\013\027Wx3\243G \370\037\367\236\226G\b\201\002"
+	.ascii	"\006~\376}f`\373\377o\370\246\340\235\203\2676\227\357a[\336"
+	.ascii	"\306\013\307(\345\205\202\207\206\351\370D\225\372\342@\256\206"
+	.ascii	"j\266\370<\210\330\345\241LQ\376\311;\242\032\333[\312\024\357"
+	.ascii	"\002u\003\204\003\\M9btS'\203D\t\323\206&\225Kk\236\205\333\322"
+	.ascii	"\277\217ml9\265\256\257\276oc\323\205eE9-M\203\2634v\326\207"
+	.ascii	"wN\303z;TqZ\222\264e\275\346<\336;\353q\022:H\326\263\367\036"
+	.ascii	"\231\027\340a^\240&M\310\021\312\317\236\313RF\363$=\037I\317"
+	.ascii	"=R\237\2722:>\262,=E\317et\254\234\236ym\231\f\243U\247\262+"
+	.ascii	"J\230\312o\213\324^\236\325\334\230\233;9+B\344\316cJ\350\215"
+	.ascii	")\333\262\030F\333\241Zr\241\321\226\303\2601U@\370\305\013O"
+	.ascii	"\336\232T\326\333\331\013\221\314\225\216\266\354\306h6YffB\332"
+	.ascii	"r\027\246\322\320eU\263-oah_^\337\023\312\245:-\261+s~\351HI"
+	.ascii	"\031\321l[\224V\260\246f\233\226g\344\264\234\325\350x\220J,"
+	.ascii	"c\333\3371Z\236RL_\333\343\220\376\214\345JE\033sW\225\226"
+	.string	"\246s\257\0016Kl[\320\264\3452FK\351\254,\207\240Y\351!\223\232\361\326\366\fG\206\025#\300\332\276\205\364\311U\330\354\277A\351\324\230\2201m\017B\312aLe\313K\211X[\026\343)\374<\301cg$\230\3547H\347}\336\300\231\301\021\326V\001\006\372Y\025\351\371\304\257\207O\374\330\311Rv\240\212\034\245\264\365\342/\006\253\311\247\346\r\273\327\371\323omOJm\331\t?\341\347\001\034\345\026d\360j|r\277\356u\366\354\360u\361\351\265}\005i\t\267\233\301u\322\363\001?\356\343\003~\277\373\215\265\252\342\325\326\366\235\336i\346d\240_\312%~?ou\002\r\204@\333\232\363\375\367\3274}\300\337\365\267\\\342\257w]va\230\256\355g\027G<L\375\254\374\271j\005\003\376\300\177\bz \341'\376\312\203\316\317&x\007\f\nU\330\343E\354\177\332\317AW\300\334\242\374\177\373Y"
+	.string	"/\347\371k\027"
+	.string	"W\204\374\227\373\271\304\0304 ?e:\376k\371\331G-\347\2576\376G\177\006*36\343\377\336\317\003<\315\316_\245~\016\240\006\235\277\306\370\371-"
+	.string	"\363\363\376\337\374\325\370w"
+	.ascii	"\177\333\277\373\357\377\314\367s\336\317v?\323\375\f\346g/?"
+	.ascii	"\273\375\314\366\363\225\237\321~.\373\231\354\347\261\237\245"
+	.ascii	"\374\f\345g\347\317]?#\371\231\353g\343\317\310\237\265~&\362"
+	.ascii	"\363\220\237\205\374\034\344g#~.\342\347\341\317/~\006\362\363"
+	.ascii	"\217\237u\370\331\307\317\004\374\354\364s\217\377`\377c\370"
+	.ascii	"\317\345\347\035?[\375,\343\347\344\177\262\377Q~^\372\371\370"
+	.ascii	"\263\020?\007\3613\214\237\201\370\371\207\237}\3709\351\347"
+	.ascii	"\342\177\030~&\376\334\303\317F?\027\375L\364s\001?\347\360\363"
+	.ascii	"\320\317\006\374_\361\177\355?P___\337_c\366\327\020\361\033"
+	.ascii	"\300\027\365\250\323\024\240\273\212`\352\322\266\303\b\275\""
+	.ascii	"K\374\224L\347\r\353%=\222E(\325#\307i\341`\253\307j\364\252"
+	.ascii	"\352\021\344\366\334T\321\343\262j\333|\335\367z;\315\255\027"
+	.ascii	"\203\346\275\307z{\366\356=\3660/\300\274\200U\222Ed\312\317"
+	.ascii	"\276&\307\036\026k\3449\267\244\367\245\346yW\266$on\307k\371"
+	.ascii	"e\225\304Z\033\307\346~\340\325\375b\210\001+C\303|\315$\r\333"
+	.ascii	"=\323G\035*=(\327\335\001\316+\250\035vfn\220\3602\242\325`i"
+	.ascii	"\315\033ue\306\224D\271m\243\225\213\306\227X\333\327@\245t="
+	.ascii	"\327c\370\331d:\356\035\246\305\274\231L\256\301x\216>\027\251"
+	.ascii	"\304\364\"\323p\rV\235f\251\323\233\024\231\006\303`\fe^c\031"
+	.ascii	"\f\212@\337\366p\360\2600\311\244\3665Ji\005\f\364\373\331\272"
+	.ascii	"\364v.\275\355\362\005\202\024ie\354\253\275\274\3314\241cz\322"
+	.ascii	"\326\t\247\210\225\217+\267\023;I\300)%\351\022\025A\032[\020"
+	.ascii	"(\233\215\243\217\037\315\326:\372\b*\033\360\250\256\360\266"
+	.ascii	"\344\250\256\360\330\372\210\030.\255\245\267t[\257\265\032?"
+	.ascii	"\233\215\315\336X:\013\262\331\272\253\317\030\032f\325\302D"
+	.ascii	"\331\332J_\341\2518\252+\274\f\330\332\b\353\361\030\235W\312"
+	.ascii	"\0022TW;JK\220[xlU\321W:\r\210\r1h5\207X\221\034m\321Z\351\327"
+	.ascii	"\244\213\016\265\324)\350\027"
+	.string	"U\027\275\362\202\322N\236\232{\233kZ\315\365\325\316\257-H\264Y\2175YWi*\374\354\262N\276\221t\222\333\013\272\254\237\r\306\320\037\037\\Q\023z\302T\276\330\242Rz\312\031\227\350\275\316\262v\302Tx\220\316\273\264\0313{\333C\201\"\210\3038\303L\361\330\026\373\341H\3061\035\021f\177D\351!\263Awl{[#\275\235Jo\233\322W\276\364\325.\355%\315\204\237\020t\223\267\222\366z\315\321y\235mD\0321(r\351\031\202_\355\353c\b~\257l\251\017\003\375\332J\312M\006\372\231\250M\322C\353\021\351k\217\"[_W\310\025\221\036\302\317\326j g3\235\003\211{oku\021-\204\241a#\324\261E\265\272\331?\250\254EQ\240\300\331\021&f\346g;\bG\245\301\232\321\366\365\230\266\021\267O\232;\365x\325V\226&}\317\245>\370\331?\356\217&\242{\334PFu5"
+	.string	"\212\364l\217\215\211\355\301c\005\031\034emw\340\210A5q\322%\315j\254\233#\306\351\322\245\245o*\351[J\372~\246|\3378\372\206\230\030_\212\364\r\03353\320\240\220\265u\"\231nK\216G[\2413\314\227F\213\t7a,LoPQ\2666\376b\243$C\250\257\217\fe:\357\224\006{TWxf\356\270\316"
+	.ascii	"\245\244\tI\370\242K\232\251\243T0)o\244\240DE\343x\256\211\r"
+	.ascii	"\216\327\234\300\320q\035C\231>\027\t%\311_?\233\261\3435\036"
+	.ascii	"\343\317\275;\372\264.\370\231\211\024g\3415\025L\312\213\204"
+	.ascii	"\342\244\001\344\2273.x\367:\255\232F+\233\331T]\325S\275\354"
+	.ascii	"\253\256\3213\370\331R\255\364F\366\322\203\234\367\"\357\275"
+	.ascii	"(\202X\352\350\266\025\024\325P_h\232tt\2147T?\375\336\276p@"
+	.ascii	"\373\251e`\201\336\273\266NN[\027\251\024\261*\254.8\270\n\246"
+	.ascii	"o\363^-\033*M7\242Vm\252\n\f\2309\263>\271\037^\274T.1\031=Y"
+	.ascii	"i\2648ql\331R\335|\360E\201\244z\334uyuK\323\221\322\213\001"
+	.ascii	"\255\\n\242\262d\251lI\230y\343ae\355\225-\375R\007\007\326\266"
+	.ascii	"\252U-i\256\\\251\\cx\322\256\242\266\300U\251R\321\270h\245"
+	.ascii	"M>\234\216XyE\253B\256Mi[\317\310\312\312\352\230\032;m\211["
+	.ascii	"CBFV\271R\237\253\004\206L\013G\215L\027\"Xbbu\314\003)a\321"
+	.ascii	"\035#\320z0\231\362:f\337\232\300\305\245\313(Q\252\224\037\264"
+	.ascii	"\350\230In\320,\217X\300^\245\334E\2012\351{\362\244BIo\022\224"
+	.ascii	"\216\231$\247LW\034T[(7E\214d=\325yyUgj\274\327\004\027\346\t"
+	.ascii	"\213\324\213\312\250M^\235;ghpv\225\311\333\235\331\024\223\272"
+	.ascii	"\204\017\315i\231\365S#\013\343V\277"
+	.string	"\252\215\233$\274\244\364\334\322K\300\265\213\237\265\353i\026Jy%\270\315Yz\356\342\212\344\374\254H\372\255&y/\025\007T\267J\202\333<I_\217\250F^\267^\267*\027g@\243\311T\236\370\177\367\312U\343\2665dJ\333\333"
+	.string	"I\377\363\357\036\225\367\336\251\032\347U*\351\374\270\206\371\304\277\303\225\031\370o\357E\300\350^\343\035\324.5Rv\264q\005\356k\240\367\"\261\214\037`-\221X3\222O\254kD\0161\376(/\2261\371\274\367\347\"\221\306\021\232\367'\371\274\313\273\344\266\344\353\3042^d\363\376\\\344=*\220Db-\223\317\343\362'\371\304Z\336'\326\365\271\310\243\262\ty\225?\367\211U\346>\233K\237\344\263\271L>\261r03\231w\266\264\203f\305\261\223$\362FA\3358*}\240Ig\363\306\335\313aLW\311\300\2757\232\312\270\343\f6S\202F)!ql\362"
+	.ascii	"PJY\315\213\204&\267\232\367n)\265\270P\030\030\235\320\013\204"
+	.ascii	"\241\306\0357\356\023\323\275\004@\335k\344\013\275\367\032\357"
+	.ascii	"\2756\312\033\316{k\370$\265\240\240\356e\006A\335\033\306*L"
+	.ascii	"\367v\230\030\263e\362\231\325\024\252\002\366\324\2721\234F"
+	.ascii	"\326\272qX\312\364itr\237\356\275l&\325ZR\325a\271\222F}5\365"
+	.ascii	"}\361b\263XQ\36247\246\246-\021\342eMm\207\nMn\256m\nE'\344L"
+	.ascii	"['#\321\234r\345ht~\301[zj\033\305\351\254\321\004\210\016\347"
+	.ascii	"\323\004\023IT;\177JRG\274z\360\263\366\250V=d\367\027\345Qw"
+	.ascii	"P"
+	.string	"1rD\226\266YmH\270\020qK\337^9\030,\354\002f\255\301S\357\315\301DK\250\352\2503\030\314\306G\364\314\021\254\332\254D\360\263\352\2506^oT\034\347\237\224\034\231\264\324\376\267$\rb\240_\375\021I+\r{\325\306c\210\217\364?\"\322\377f\244\177\275\252V_MmV\332V\345\310(C\326\244\355\177\306\264NUe]\362\034\235\327\270A\364m/\311\275\227\212\237u\252J\241\b\352 B\240_\354\362\257P5\252\313\260=\242\204\b\2573\351k\240i\2331\320\017\005\227p\342gu\2522Lp^c\316X\224\216\211w\225J\t\316z\340\274\240d%\251\311\3162D--\253\306`Z\312Q\362b6\326\366u\351\001oA\001\013\244\340\260HL\0014J:*B\n\246\030\022\223R\004pt\224\204\204$D\262)\016\001\203\b\022\177?\b\207-\212B$\233\035\210\200G\266\b$\272"
+	.string	"\272\370\025\203\304b\021\260\b4\032:*\006a\360!\002]\020\261P\004\226P\004\302\360\003\004\320\b\351\204\001`\204`\204\024\\\021T\302\n\234\027x\002\b2A\002\r?'\350\024\203H\304\236\025B\244\036\"p\230\024\364\242\340\020\210\004d\221\036\003\r&\320@\005\0206W\321A\005\035T\360\273\212\016\204\204:\320@(\275\006B\265D\361-X\274\b"
+	.string	"\006#\242\244\036v\210C,\202; \tE`A\024\2030h\303\202(\006bQM\360\005\361\246H|\201\003\364\242!\023C\242\026E\266h\204\004\274!\016!\t\203\305`qH\344\202\017\360\005\214\242-\016\211\212\304\034\037~oAA\001\300\241\034\340\013\0301\334\024\207lR\"\0160\210 \fGDEa\361\2468\244\201\320\020\350\002\221\207EJ$\002\207FF "
+	.string	"\213\301!\rE$\340p\230TTb\005\220\305\220H\005bP\007\0061)\004`\bFGI\302\242\234\"p\bh$\\AX\002h$ta\211C-\234\320S$&\351\220\343\003\320\210\230\244\303\017xd\204D\324\342'\f\366[Pp\364\302EpH\201\013_"
+	.string	"\207)\212B\3410EN\2218\324\003cX\004\272\020\002K(\002Y\344\020\207\200G:\020\3050\0031hs$\024\2060T\003\303\210\b\370\302P\270\242\030$\372Ag(,\026\001a\310\201q\004,\002\217^\270\020\212"
+	.ascii	"$\022\r\201=HA\026\300\020|\200IH\301\"\222P\204\022-\210A\244"
+	.ascii	"\340\212\037\027DC\026\302\241\013@\026D/rZ\020\223\216v\250"
+	.ascii	")\022\207\200EA\037\200#\354\024\207,\270 -\016\251(\"\005\223"
+	.ascii	"l.$$\202\0022\260PBZDA\013\"\321\321\016)\210C\240\017\301\241"
+	.ascii	"Q"
+	.string	"\n\244 \221\213\024ECb\n\n\b \002\2130B0\"\002\016o\232\225\313\212\321\370\221\245\303^A\233\364\001\2619,\216%%\333R\333[\034\277\265ao\324\233\303\257\217\210\335S\333\343p\211\237\245!t[#\007Y5eH\333\033\313\224\321T$\tT[\246['&{U\341t\256\361\311\225\262)\323\242\344\b\336M2O\3448\221\341\244\213]\336^\335ZY\220\301\347\222\034\201;\266\265U\347a\266\235E\247,\325\177\203c\204\307\023I\333\347(\245\237\340\311\325r\331\326*?\327[sOe\332Z\251\247\3510\301\340\371\260Q[\262\336\224\332Z\031\366\211\237_\263P\3479\213!\266\266\227~\b\376\332\317&o\233\316r\360\300\262K\177\033c\n\234\r-2\351q\342\322#\221m\fjV0\313#9\222\334\313<qCS\333\021{\264\307\352\004\302\242\204\312\333\213k{\234 \366\332[\227"
+	.string	"P\246"
+	.string	"\025\025\305a\356\355U>"
+	.string	"\356\225\"\344G4\214\217$pm+_=\336\240QF\211\357\314\231\2327\300\0223:&^\217\030Pe5\211\327\274\032\254\265-#m+\036\203Y\231\022\243\257mE\303Tn\336j\210\0013&\032\255v7\367\232q\300\313I\307\304\213\262CM\254\314\253]5\303f\246K\225\231:\033c\310\261\250\263\206K\224\311\305`5Yg\306\224\235\205\tS\351n\256\262n\202\256\237\225\225V\0241\257tu\256\355\311\225\253su\f\221#h\302\242\267g\211\330\021_\344:\316F\207\222\nSS\203H\250b\0015\210\362\2302C#2\"I\222\2441\322\n\020\006cQ\232\327\226\035\022\340C5\321b\220\031\232\021\021\221$\005Iac\f"
+	.string	"0'\254\316\216\214\017\2263\373\263\332h!\344\277\320\233\316+7a\200\364\017\273R\220\236\024\227\316\021 \001\257\340Rbh\371b\"0\337\331\377\024\212;S\237\017\322\243U\263\"'?\341xQ\372\261\230\037\022\242he\264$\241\246\260'\023[\276Z`\333\032\202\n\2642\222\220\311c9\334sR\b\220\327\004\311x\241"
+	.string	"%\210\254\204\200\205\003\257"
+	.string	"\250\277]\264\333\304\310C\005 \373U\317\272\203\311CJ+Z\367,\025\036\374f/\213I\371g\347\315\016r|@z\255\2243Jo{\003\013B\251gA\337h\306]\304P\317b0C@\371\317\200*>t4\352\236\223`\224\3059w\021R2\221s\230~\350%\363\325\377\237\237\254b\202rL\275\351\013\273\363M\0032!\303\217kU\217\364hQ\211\235\251\307,\3613\221\350\332\354v\205\361\305O!\330\002~\267c\237\354\210\270\204\330\020\266@\340k\343\023\036&\201\264\371\251\347k\257o\373\250-\235\227'\036p\364A\247Sp\253\267?\262YMV\363\321c\375J\300\\\305;\320\237\271M\266\344\245\303gU\336\005_\026\207\fq[#\225c\t\203\375\320\003\t\307~`3@\260\301>"
+	.ascii	"\303X\375\312\035f}\333\207\021\301\224\3200\336o\024\235\022"
+	.ascii	"\352"
+	.string	"v\355\317\210%\231a(\245DV;{\362\030;\232\017\003o\221\225\031G\025\253\354\307\234?"
+	.string	"\2256\005\026\001,o\366\317\247\321\331,:\304\0011\230o\335J=\033\213F\347q\267n\217\253\nq5\234;U\023/\311\240\326\324\034\245\326\256\313\211O\354P^\334\242\332\221\3105\261J\230\257\336\037\216\225\025\354Q%4\360\033\b\344g\350\200(\322\321_\303{m\004\f\341\357\3442\224\236\204\346"
+	.string	"/e+E\276\257\247^\001\200f^\334\207e\264\252\310\271\341\234\365\t\367\205\013\345L\351C\323!\0074h}'\242 2\032\251\005\371^\226\330\270\276.I\246\320\377\263\353\0347\242\274V\027\tH\231\034\022\330h\332,\325T{\020\02522\245\352\206:\321\321\310\2132Y\217-Q\264\254\363@\002\326\311\314Hv\245\315"
+	.string	"z\267\016\361\364\224\244\003\207\033\236\020$\335\bJ\274:\271`\001\323\216x\237K\310\263>@\335=\207\323\226\362\3022\\\331\370\204\317(\336\251\"\324\303'\221\346\321%\362h\221\030\272\242  8\272\357.\366N\251\363x\004\300\201\366\353\242Th^\2248^\002Y\305\207.\026\316\017Lh0\264\307\222_7O:\033\353\301\302\223\242J\207\300\377\345\257jd\251\345\024\037\037\0360b41$\332\300\001O\021\315\352I\204\201\317\023\017\017\360\027P\266\246\2309\004\337\222r\306\200\007j\373\232\3655u\221\b\224\213\024\245\242\301\352\301h\032\260\362\004\216\277\331W\371\355"
+	.string	"\333M\217_\016\"\227\234|GN\276I\256r\0055\272\205\344\n\364\251\025Cl\342\301\265\035\300a\017\326\307\202\344=\3449\t\b\223\343d\370BLx\246\340\211\006cA\247#\254w\t{Uj\203\202`8\224*\320\202\201\365\226\222\021}}\025\031Y`_\264\376\366\303w\260\237V\354\3133\253\373^\0031\030\267"
+	.string	"A\252|\353\320\r\200\217\357\003w\3670\271\314k\233\206\002\253N\031\201E\321\340:\3467\005\275\375/\320\350\254+\2667\006\250\025,\354\213\005\243ucA\"\220<\303C\375\202\266fb\263\254\314\331\274\212^\031\215\271\253yAE\020\005\035v\373a\231\273\3125\310\366\034\272\362\006\252v[\3576\0254i\254\210\377\323\231\001de{\310\3561\276\330]\324Q\35747x>\213r\037\242\020\303@\336\370\354\007\214\352% \273\001\204\313`]\212\221_\002\342\271\343\215\004+\005\021I\234\236\244\023\3679\273>\031)\f1\313\346\203\331\255C_\225aoZ\301\214#\"U\364\264hJ\305\350\251\302\261a\221\231\002\366\252\016`\257\341U\376Q\t7\271\205;\005\037f\367\301\272\221wi\002\3228\333\272\226"
+	.string	"\002 \317\f\317M#\037\351(\213\203\332U\271\211\"$\211\004\356gm)\nO\026A\312\017\326z5U\016\020GD\301\200;\320\375W\024H\002\365\"\366{\261\356'~\220)\234\272\003\304\364\347\357t\371F\210\204\267MR\270X\027c\360\362c\r\204\352\241r\003\236.\"\342hW\342uriH\200\tRw\213\340\b\273E\213j%I\002^\217\2271\213F\231\304\335\257Zn\322\265\347B\342\322\365l\2039\237\202\374\2102\321At\305\241\360L\250\031_|\346\002\177\032kWu\007\373V\224\212U\274\266C\337g\341\365\026"
+	.string	"h\374\031\211\336\005#\031^s7\037\340\372 \200\204\341\232\330U\271zI\331\242\331\313Go`e\270\035\307\0218\344\225\214\350\274*\235\337\276K\242\371\246\362\001='\375\355\347\325\020\032[:1<rk\242\374\227\327\220\243\254\354F\033N\352O\263\313\355_bs\351\r\313\362\256"
+	.ascii	"\324\013\212@\\\376\371\300\372\215u\007\235\016b\357!\370\213"
+	.ascii	"\"\037q\332\234\027\275ci#\330_[\036\305\342M\200\035%bY\376"
+	.ascii	"\271\337b{\212\236\361\351\300\026n\250\371@<\341l\367\375m\351"
+	.ascii	"\025R<Z[\234\236C\312&\242\217\312\317\t`\006\325\021\334\202"
+	.ascii	"\250_`~\"{\366Z\375\233>\177\b0\013H\314\343\344\351\371\343"
+	.ascii	"\371\274\326\336=<y\371t*\216\304\355\025\376\346\321\363k\276"
+	.ascii	"\222>\002\315s\232\330\370a\341\334\237\335\203~\232}8\373\246"
+	.ascii	"\355\026\265\203\t~H\332`\2517\342I\256\205\350B\372A}E\344A"
+	.ascii	"n\246w\2206\377>\310\310\304\256\302\347\255O0; g\\\234\013\225"
+	.ascii	"x\261\357\366\346\033p\236\002N\263\037\005\304\221;\336\334"
+	.ascii	"\353\211\310\251\374~;\"v\305\260W\346/[\277\271\036/\204Od\351"
+	.ascii	"r\230\027\017\373\b\356/\205\207\360\270\276\366\371B\223V"
+	.text
+	.section	.gnu.lto_.symtab.f646eebe4f79aad6,"e",@progbits
+	.string	"flashDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"flashIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"flashWaitForReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"flashEraseSector"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"flashEraseCompletely"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"flashPageProgramBegin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"flashPageProgramContinue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"flashPageProgramFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"flashPageProgram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"flashReadBytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"flashFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"flashGetGeometry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"flashPartitionFindByType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"flashPartitionFindByIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"flashPartitionSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"flashPartitionGetTypeName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"flashInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"flashSitl_detect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f646eebe4f79aad6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,783 @@
+	.file	"flash_sitl.c"
+	.section	.gnu.lto_.profile.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"}\006"
+	.string	"d\t\023\001"
+	.string	"\022"
+	.string	"\373\276\315\223\n\002\002"
+	.string	"\002\001\001\354\301\314\336\005"
+	.string	"\002\253\210\306\306\016"
+	.string	"\003\241\357\364\272\013\002\004\240\342\234\212\n\005\271\315\331\335\f\002\002\003\002\003\006\007\227\326\223\357\b\253\352\346\364\b\020"
+	.string	"\002\001\002\004\002\004\002\005\002\005\003\002\003\t\n\235\263\256\260\003\013\320\204\261\374\b\b\006\f\r\276\232\351\213\004\006\016\225\207\230\325\013\004\017\250\325\371\265\005"
+	.string	"\020\355\243\222\241\n \002\007\002\007\002\b\002\t\n\002\001"
+	.string	"\013\002\001\002\t\002\t\022\361\253\302\312\n"
+	.string	"\030"
+	.ascii	"+\2234\002\224\341\316N\002p\f\254\2646\365\215\b\013?\027\200"
+	.ascii	"e@\334R\303\270\260C\317\330\241\225\255\204v\0013\003\254\234"
+	.ascii	"\217\252\031\200\032\315\016\001\213h\300\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\235\004"
+	.string	"\342\305\017\024\2207\351\272\273\273\333\367\377e\t\261\033\021\273Q\333R\246\024\357\212\341\221,\315\236B@\007\230\362\024u\350!(\321\b\344d\2553X\347\360\217`\235\241N\205\034\261\233.,\376J\304\r\001$ P\002QL\355\016\226\200I"
+	.string	"\342\206\357\006mS\212\032\205\006\0244\234\036k\335\017\027\226fpG\262\n\327\263y\350\276\364o@\357\205\2600\225\027\332\013x\261_Z!p~\004\n\031\311\r\"\234>\2022"
+	.string	"\323\254\215"
+	.ascii	"\261@;vD+C"
+	.text
+	.section	.gnu.lto_.inline.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\303\002}\r"
+	.string	"\206\023=4P\215\322\030\260\025\326\327D\263B\034\025\344\316\026B-\322[ssu\233\300\256\022UijO\310=\263:\252*\243\252\376\023\243h\317\372\321\236\264-\245L\001("
+	.string	"0"
+	.string	"."
+	.string	"\232\252\354\236\376WK\310|\374\\\3261qL\353\031v\267\341u\374\317\023K\214\335\265\274'1\0371\335\335m\177\255\025\0017T\200\017e\310\21142\310\f\351\311\2114\352|\371G\314d\023Y\017\312\025\nE\242\321_\223\2108.d\252$\212\030\330\362\237I,\3631\013\326\355vzT\225\221\362\232\265\272\216\231J\250\036J\2337\231\216\354\356\025J\207\335-\370B\367^WHL>\202\b\316\354\336\356!&\177\324\377\377\246\362+\242\300e\367\020\335K\325@11]\237\345\n\2452\035|t\210x\f\202/\240\375\034\353\243\023\024\020\034\2349\330\031!\327\214\245\305\306EIS\250q\265qDj\204\2460\255\314\001`\2021C\2057\022\340\323i\f\345\035\"\232\300\226[\255\237\001s\004?\3370\266\266\250\004\376\3535\231\302 "
+	.ascii	"bg\352\303t\226\365\246\335c\031\204\023hp\022Ni:\033S\201\216"
+	.ascii	"@\022\221\222\312f\277\026\210\rj\360\231\"\022\243\271\244y"
+	.ascii	"\204\373\030\213*\211\202\205\2639\016\303\231S9h\267\200\237"
+	.ascii	"\017\f\021\242\314Z>\225R\3001,g\334F\266#\215\371\252\225^\300"
+	.ascii	"D\357Y\240TF\304r\242\270\230d\035uXJb\230O\016\013\355\251\224"
+	.ascii	"\202\314l2,\232\227\016&\376[\306\215\ns\342\367:\355\233\177"
+	.ascii	"\345\376\256\333\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\251\005}\023"
+	.string	"\266\031W@\020o\224t"
+	.string	""
+	.string	"\004"
+	.string	"\250r\005"
+	.string	"b\325\\\007A\244\022\252+"
+	.string	""
+	.string	"\253\304\023/\3371\233\265h\240\212D\27032\201\270x\374\023\026T\001\025\2167@\034\337\264\022\364\301\377\255Z\020D\310N29"
+	.string	"<"
+	.string	"F"
+	.string	"\235\367\235\227\227d\311\226\255d\2344\370[\325nl\f\3622[\312'F'\3158[\231L\246=^\2661]\252\273\324\355kgl\237g\373S2\236\321\362\331JI\332I\213$,\037L\3553\272\376\""
+	.string	"<\301Y|\352\025_iQ'\324\251\267\344\345\226,\313\262\233e\227$\305\243x\300y{"
+	.ascii	"\215\267\214\256\321\275J>\311\343%\376\235\325\367\006\271\321"
+	.ascii	"\271x\250\206jGF\236\t'\241\302\036\021o)\274l\n\316\023\244"
+	.ascii	"\3248)\215[\2500\021\260}Kvq7\025\306\201\355E\f\025V\0016\020"
+	.ascii	"\031*L\003\266\327Qa\006`s19\0256lN\300*\276\252\344\3563\017"
+	.ascii	"\265`\351\002\257\020\020i\204\240\026\311\323\341\032\211\\"
+	.ascii	"\037\220("
+	.string	"\344\3718 \342\001y\360H\320\220\320\206\005V\255\317\345bp\201B\204JW\006,]\340\365\001}<#\321\245\201C\311#\372\340\\\004\332\341`B\206\003\243\351d6\230\013\231\016\204\rF\363\240\243\341\210\260)\320\026y\250A\265dfj\244%%\225tp\002\221\242\262z\022@RR\004\245\031\247\020QflD&MI\n5\253\001AYo\013\266\263(\\$SpY\21745\344\235K\240U\273h\263\321\212\300\335u\240#R\245jAhs\375\376\300\230\201O\013\027\231\350pE\227\033\356\260\355\255<1'\213\n\t\233\254\203DdB^\216\365\025d\202<\f\360o\346nn\230{U9C\351dK\304n\320Y\r\353\026E\211\b+C\223Z\243?\2058\350\346\310\030\205\330^yn\326o(\240m\343W\253-O\350E`|\177\240\335\223*\253\245Y\202\2042\350\032\246\347:\327\204i\354"
+	.string	"\001\017\361x\016&\324\240\321\365\215\320\001\345\034\360;\210\206X`d;\37671\032\2078\n\323\273\"\200\337s\021\374\245\364K\260Wp\022\305\3001\226\243'\320k"
+	.ascii	"\013TB\004\264\r\246\256\353{k\213h\361\016\216\\f3\323\265\277"
+	.ascii	"b^\235\205:\214\017\315="
+	.text
+	.section	.gnu.lto_.pureconst.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\232\004\001\200\004\002\200\004\003\230\004\005\230\004\007"
+	.ascii	"\270\004\b\232\004\n\232\004\013\231\004\r\231\004\016\231\004"
+	.ascii	"\017\230\004\020\232\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"=\007"
+	.string	"\"\313#*\200)I\007@6\322\342\301\311\fjM\2452D\212\335e.Hu\301\354\335\022\326\335\b\373\265E\311\016\213\376\205\366\033iR\246C\017\004\211<\314\020$\362,o\240\224\372\365\372^\267\031\037\346fW\314{\002B\227\235v>\312\037\355\204vA\212\23048X\374\f\211qw\304\211F\t\024\245\314^\007\275\243\352N\313\201J\"\n\311Rka\205$p\303\224\2002\027-\343(w,3\225J\311\357\030\315yS\356\224\003H\364f\306\023\"$ `\202Q\352\350\006N\020\326\346\244\\\264\270\005\320\302\250\232\\/u\354\005\362\020r `s\301\374\200\315\027\211+b\036\307\002\367\326\016l"
+	.ascii	"Y\021\343\026\020\251uZH_Tc\331q}\310\376:\236)[\211\211ec\353"
+	.ascii	"\303\r#\213\030\336\262(\003(\002"
+	.text
+	.section	.gnu.lto_.lto.9ad505506360ce78,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashSitl_vTable.26.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375 \376\035\006"
+	.string	"\204\n\304"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\346\303\005\177}\270\346\243\005{y\370\345\343\003wu\270\345\303\005sq\370\344\243\007wo\270\344\303\007mk\370\337\223\007ig\270\337\203\007we\370\336\303\005ic\270\336\323\005a_\370\335\203\005]["
+	.string	"?\202\210\200\330\001YW\305\001U\304\001S\303\001Q\302\001O\301\001M\300\001K\277\001I\276\001G\275\001E\274\001C\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/flash_sitl.c"
+	.string	"\013"
+	.string	"\200\024@\n \005\220\002H\001\244"
+	.string	"R"
+	.ascii	")1I1\223\324\001\300\001"
+	.text
+	.section	.gnu.lto_flashSitl_isReady.28.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\355\b"
+	.string	"\346\321@:@\305(\035\340\245\313]\371\326\026\030\023\036~4e\322\203\200\020\234\021F\232/:\321\232\272]\317\032\261\"uD\177\266bWQp7\221\357"
+	.string	"\216\202\204E(j-\267\2252\2450"
+	.string	"0"
+	.string	"."
+	.string	"\207\266\255\260P\262\351\037\307\352\342\255R%\004v\277\250\0337=M\376EnY\301"
+	.string	"\240b\235\236\027\207\335u\252X\026\267\3366\202m\006\333)\001\351\324\3641\354C\300\201\311\356\352U`\003@\024\017\333%;c;\323>\310CJwU|`\267\245r\262\373%8b\016\375\275"
+	.string	";\304\234"
+	.string	"\013O\271\274|\331\0379I\310\357\360&\202\276\b;L5\030p\201\312\227\261\264'(\362\252kC\206\247'\373;\245j\330\267\354\356Z[\206\032YG#e\236\317\305\235\rh\244u\017\020\035\007\364\211\035\227\2214\316\023#4N(v\270.n4\336$2.\216\266\215\213\231oo\250\032\224zN\275B\r\b"
+	.ascii	"2\003\302\260\214\341\b{Z\322eTL\303\241:\2041]\223\f"
+	.text
+	.section	.gnu.lto_flashSitl_waitForReady.29.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\025\002-\023"
+	.string	"\266e\204I\340\320(\035\3329\031D.\204\320e+&\321;\246\361/Z\037\232\306\355\345Ts\332\255\203\026\321\275r\247\363iz\237\003po\310\374;\036\177M\030\210"
+	.string	"\r\352\3045d\304\f\027\223\022\203|1|b\201\376F6\221;\245o"
+	.string	"h"
+	.string	"r"
+	.string	"s\332Gq\236\330{,|\244V\034\022Q\2559\004\036O\247\316}@xz\272\200\360\324$A\314\262\347phL\245\215\314.\251\326\334\270\036L\247\354!\005w\312\374\230\207!\267\332w\2373\267rR\235\232\203\340\002\236\235\017!7\032\270:\336\221x\253\315\375\356\006t\214\312\031B\267\232O\023J\255\325\323v\313p\233n\373\3056\004{2\b^\234\035N\243\302i\221\367\374"
+	.string	"\376s\213\327\375\037\236\246\3414\030N\257iz\206\323\017p\302!\351F\201\245Zi\226t\324\036]!\342?\277}\237\367 [t\313\201\274EF;\265V\261\305\026Oo\307\374\235E\333?/\2575\f\0363%\316\257\326\334\201S78m\356>\261\353`@T\245u\270pr:%\001\003\032f\017b\265\346m\"\373\240\237~%F(\375J\260\326Z)\31049LhK \347m^1\321S\372\321Tl\300\261"
+	.ascii	"\367\306\342\202\353J\001\2036s\200\033\002t\264>\033:\241\365"
+	.ascii	"\356W\334)\243f3w\3672;fs\311&\032\207\t?v\256\351E\215D9\227"
+	.ascii	"\3741mVk\336\366\375\356\307\325\212z\345\306\330\271r\356\215"
+	.ascii	"}\0051Z\200\b\257\b\036/r\265\"\037\300ZZ*\026\t\003Q\245H\027"
+	.ascii	"\325\n\213\311\251\222\025\214|\245Lx\251\254X\306\227K\345B"
+	.ascii	"\272VF\n\244\nkL\271^c\t\211[\025T\256\021\326j\271F17\373\342"
+	.ascii	"\034\372N\360\206\350/\013\277\273\003_\016oh}YHw\3066]\243\314"
+	.ascii	"\266\f\021\356\215Q+2\322C\362\301\341s\341\023\275(\305\317"
+	.ascii	"\261J\212\372\251\360\024\265\004j\004  @\002C\310R\017D\224"
+	.ascii	"Qh\0304\2672\220\237\351\2221k|lB\354\372U\305\341\204\322\355"
+	.ascii	"J}\274\263\372\003\324\023Z\2440o\037\f\316\336G}Y\017\357b\024"
+	.ascii	"\341\360\331F\277,\355\321\201\204\233\366\257\250\321t\243m"
+	.ascii	"\307\324k/A=\001"
+	.text
+	.section	.gnu.lto_flashSitl_detect.30.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`@\t\2451"
+	.ascii	"\232U0\023EP^R\007\363Z\367\357\307\201\324{\370\026\241\002"
+	.ascii	"\203ajs\034\350\2649\216\333\327\037\236\364\261g\236\021\371"
+	.ascii	"\254\217\273\272p\021B\271\322\001\234\005\220_\3176\214\030"
+	.ascii	"|\036p\\\003\360\211\264\207\250\333\356\275\245L)\031\001\021"
+	.ascii	"\001%\001\n\362\366f\306u\366\224\025C\366j\377Z\336\335\243"
+	.ascii	"\374\327^\352"
+	.string	"\301,\317\026\365Zr\020\251\242\333\351\301Koop\237%\256\376\321\307\022\365j:\326\315\025\335I\025E\246g\324\275\233\022\236\365\f\356\263\300\375\315\234\335\377\354\321\242>\215\307\007\330;\354\013\230\275\243\024\334\350>\353\321'\320>\353\276\200\366Yw\367\n\027\242\034\376(\224\371`gVl\324\275\243F\275\344\341\367\031\366\b\203<@\367\327\262\253\316\260\177\362}\244\277N\201\366\235U\223d}\375\360\247\347\027\224$\353\371B#+\321\254Y$\007\373xV\roO\314\374\\\323km\301\302,y\263&\221\f\374\005\265\001\243s\327\b\3177-\002r`m\376\367s\315\256\225\270\367\016:\255r\273Z\250\242\026\031:\225\253p\216U\335K\377\307\254\311\225\331\227\372\372U\357\325\321\251\341\342\324z\275\032\233]\310\206\316\252\025@^\2240/\375\354\3039\225\363/h\357\355y\351\314z\007\360\356\017t\377"
+	.ascii	"\356n\202p\254\326N5\036S\201\243\343\256Z\250dm\r1\023\265B"
+	.ascii	" \362/W\335v\035\251\322\311\374[O\310\262\374~q\034?Q\253\365"
+	.ascii	"\307Y\203s\037\3725\"\fZ;\270K\223\312\361\347\261\267\270\253"
+	.ascii	"V\302gm\264\266F\301\032\tw\357\355n\002E\376e\326HV\300T\365"
+	.ascii	"\252t2W\251\316PY-\366\371\271\347E]\r\344o{2G\016\337\366"
+	.string	"c\212~\372\034c\341*E\024\335[\270\310\277t\342\273=\230\033\376c\016#F\376\345\263\3761\264v\326Y\341\222\312\361+\351\210\365\320Z\314s\264\005\364G\363\344\336\320\275Q\3459\016 \3530W{'\323~\333s9.\260\333[\371\313#W\331\241\210\234\221\177Y@\277\364\201eT\246U=\245N\272G\223Y\213\271\277\216\3438v\035\346\376i\377?\257\345\275\200g\367\001f\037\006\263\367\360d\027\376\262\007\177\331\201lv\027\230\375\347fo\331\354l\233}\375e\327m\366\314f\177c\n=\352^<\332g\201\316\270J\237T\216\263\336\370A\322U>\265\311\234\202\231\371\227\325\016\371\333\362\017\330\252x\345*\277n\t3\335\275\245z\344+\330\207\377\330\263\016\003\201\231\314\326\t\007\311R9\323*\235\034\346\375\337\226\253\216\030\240y\n\0262\304U\376\332\336T\251\223=\026r|\304`g\007\366\032"
+	.ascii	"5\342*\037\t\374\005#\371\275M\201\262P\177<\024\203\227X8\322"
+	.ascii	"\243\177z\250u\032e\224\251\036\275\262\005\265P\377\027\253"
+	.ascii	";@\375h>\250\333\255g\236\262l*\307\256'5\253\022\232y\2406\002"
+	.ascii	"j\005\314\262'Z\232\034V\335UP\316\221\003\024\016\314\004n\342"
+	.ascii	"*\237\252\370\254\313\347j\004Xu\236h\317\324\346Q\300\242>\317"
+	.ascii	"\372\016\244q\365\361\300\357x\355O\033\255\335\265\371i6\214"
+	.ascii	"\233\352\200+\321\252^\253\375\355\376\216\tv\002\223\301d\355"
+	.ascii	"\263\371\313\222\257\230}\302Sx\030Jk|wX\nL%\377\262\325\004"
+	.ascii	"\244S\230\317\335\245\223^\365R\307\016\260A\206\257\300hB\351"
+	.ascii	"\327\224J'\347\246I\305g\331CEB*\206\020\270\013\020'\206V\b"
+	.ascii	"\225\220!\242H\250D\b\031%V\214(\022\200tlZ"
+	.string	"\":\017\222\003b\207\tHH\250#\322\351\350\307\306\221i\001r\207\322\023O\361\311A\221X\003i\243\211\330\004EDB.)\035\223\2101`0\360\032JF@<HI\031\352)#\217\224p \221\222~~\004\264\004\245\364$\203\306\323q)\311\370\344\204\304\241\344\204d\254\241td2\0369=\031\201\210\336d\003\351d\204jjr2\006\243\373\327\255\303\274M\203%u\033\376\303\355K\237\210n\213\324m\365\207[\037\355\303\335}\264\007I\351)\327\261\356\235\344\203\236\332\272\367\336>Z\314\313\3368\003v{+\237d\262\027\315\372\302\275q\355\033\367\312\345\261\227\316}\001\315[n\271/^\232\314\344\305\203f\261Q\213j\262\330{\027\366B\313,\371\326\275\037\002\233\214\344\305;\362ZP\267%\237\327\273\277y\371id.K\225\274\377}\263\227\211\274o\272\200\311\230\332\367\312i\335_8y\353\225c"
+	.string	"\352\376V\263\220\227\316\263\236\265\340\263\327\316\020:\026\200\253\25010\304\224e\210HDD\222$\205t\220\"\021\263\242\007\021p-T\210dD\223\264\260q\375`\362\036\r\361#\237\220!\272N$\357"
+	.string	"I\214\207@\357\217\357\360\277b\027\317\035\366\253\234\260<H\n\342\365z\363\370\211 N\313\203\035\017\023\026\312\253%J\224\264\303\307z\024k~\245\255O\224N\tnw'\323}8\257#\274D\323!s\370\017\370\357\f\020\226\265Ph\315\006\216O\220\213Y@<\323,\301\230,b\003~V\312\025,XK\032o]\374\277RZl\357\243T\326\321\024\260[\315\325\200\327\374KK"
+	.ascii	"3\376$n$\340\321\025\2167l_\372H\256\001\273\206C\264B\334<\003"
+	.ascii	"}\224\001A\366\006Cd|\001.\224\005\031#\020\331\212oW\220\375"
+	.ascii	"\005\004\267\307\214ezD\201\276\303\307o\227\312P\211|\200R\r"
+	.ascii	"\251\036\356,\247\327\342Kbo\001$,5\307H\3730\236%\334Vc\273"
+	.ascii	"@]5\322h\236\261\311\342\311B\352\215\206\333\330;\006\262\211"
+	.ascii	"\225\272\336\337\203\243E\362\214\2747lre\337C@\b\270\213\036"
+	.ascii	":\242\203\373K\020\375\324P\325\245\031\335V2/\203\200(A\365"
+	.ascii	"\265^I\251\005C,\334\240\251\032K[#\324\226,za\326\340\2707\023"
+	.ascii	"$H\204sH\024)B\r"
+	.text
+	.section	.gnu.lto_flashSitl_eraseSector.31.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\331\0015\022"
+	.string	"V\344|H\340\322&\035\243\027)\221g\020\024\351\322\313\314\273pD\f\247\374@z\276y)\231\030Py\341\257\362t\353{\032\244\240\234\362ze\354}\315\360\366\034=\f{\202\3650\341\363\234V\fS\250\375\n\251[#d\023)S\nd"
+	.string	"b"
+	.string	"i"
+	.ascii	"\023\204`\3149\277K\033\306\376.\377\331\326\3613b\317\211\341"
+	.ascii	"Ns\306\204\207\004\244K\023\356j?\306e\304\216#s\324\2345=\200"
+	.ascii	"\346\034O\f\222.=>@wIzIw\351\230\375\343#\212\351\331\214\260"
+	.ascii	"\361\020\231s\202{\342\261k\314\277\316K\"\215\354\352-\230s"
+	.ascii	"ZE\232\020\367\3366\001\333\nlu\005\005\212nd\272\313\357\327"
+	.ascii	"\342\307\bg\2467\233\324@\207\307t\245\265[^z\321\352\363\202"
+	.ascii	"\210\303\312\354\221\246kc\237\233sNo"
+	.string	"\215-\325(\251>I5\311s\356\221\347\374\337q\376\022\247\366:u\347\251e\247\346\244z9\265r\352\0030\005\3618\220c\316\017\267\"\223H\006\251\260}\237\347=0\337qs\316.\372B\037\212`\t**\035\205\nz\321[\023\020\321\314\312\\\242\273\277\335C]\267\266\205\013z\321_\211\332\312,\227\333\316\305\310\312\275\355h\366\237\337\b\375\033\257\244\364b\252\273\344\266$b\266kJ1\304v\244\373\355\310\336Gm\305\367[\335\345\251\005\321\364f[\365\0321'E6\35340\220\346\234\b|\\\255a\310\202\255V)\217\245j\275\260V,\236U(.\227V\270\222!L\271X\300\020\306zi\301V\240\206V\252\005T\301B\020\305\304\257\r,\030\350\362z\301\300o\234]\347\016\206@\030\001\231-\315\250\365u|\007\203\006))\335\245\332\020\203\234\226dQ\373\032\toO\273BlG\003\324\357y"
+	.ascii	"A/\222\354{^\272a1\032\001\241\255\314\002\364;\307\241B\n  "
+	.ascii	"@\002b\030R;\222\200\036\006L\330\307\211\320#\264\361\214|\223"
+	.ascii	"\006X,\t\246\207\264\326\315[\263XmY\201\270\334\322\252\251"
+	.ascii	"\353\270b.\003\211\217\346\205\017\207\326\020l\341\017\0324"
+	.ascii	"O\004\216&\3564\333\317z\024\227\245\321\321\320\345E\213\311"
+	.text
+	.section	.gnu.lto_flashSitl_eraseCompletely.32.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\264\001\355\020"
+	.string	"F\341rG\340\262(\035b\227[\".\031 \031-\024s\032y\342\261\214CB\231]\350\206\222\345\020\003"
+	.string	"\370Kf\333<\003*-\362\374\325\271_GiX\272CY\254\r\200\035\002Y\350F\036\006\340\330\375\376\2435\2627\2212\245X"
+	.string	"Y"
+	.string	"a"
+	.string	"<'\374\025\307iyh\t7H\217v\213Mz<\311\366\325\276\212\333|\267\271\034\300\2342A;s\206({\242G\207\027 \037E\027\221\217\376\354\240\2074\263\2331\001\303\342\307\234\323\333\022\377\256\237\377\233\217\300\230\331\265[0\347\264\2021!\356\275m\003\266Kl=\ts\316\222\026\256\326\001\232\232G\337E>~K4\237!\033Mo\016\321\313|\370K\216\326\206m\320\203\326\034\033?\036vf\2075\335\031\373\334\234szelN}\342\324&N]\272\355\037\255\272[\265\224\352\270j.\252\227S\353\252\037 \244\007\016\0049\346\004q\0032\177b\250\227\0245\2759\256\334?x\017\204\353"
+	.string	"\315P"
+	.string	"\024\367::l\004\364\341yR\2429i\007\375\235\3138q\204TJ>\332\023(\350An\007\344\360\370\351\2603\213\250\356ow\217\334\265+X\030yy\316ap\360k\214\242\322\203*\371\270;\022\361\325E\301\004\261W\177\361J@c\263\356\342\202(\254U\213\205\225\242\322yE\342Zi\311P0\310T.\025O\026c\261\264b)^\206\226\352\345\255b2\217d\3040\r\254\230\267\002\203\305<RH\373\315\031\370\220\030\022\242m\315\247\365i\274\306g\363\335\230\230\310G\215\001\3560miO\373\227\021\335\232v}\024P\037\247\201\003=X\332\343|T\203\"\034\022\252\355\314r\271\3556\037"
+	.ascii	"2\003\302\260\345\2065\275\301\336\026F\313$\347i\247*[Fu\224"
+	.ascii	"\227!\013\b\006\247\271,!9\3542\254\265\022\341\204\217m\377"
+	.ascii	"\260\252\252\345.k\266Z\356\262>fu\f\320\005\215\013\036\246"
+	.ascii	"\354\0015\210\005\243\315\252ip\222\027\327$\003"
+	.text
+	.section	.gnu.lto_flashSitl_pageProgramBegin.33.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"e\t"
+	.string	"\366\321A9@\217\322\001\233\376\004G\007\252\303\020\334-f_\333\004\2627V\347\t4\034\3427dFe\241\321i@\2657\332\342Q \334\210Fs\251\221\305\237\211g\254\221\330M\366N)."
+	.string	"1"
+	.string	"1"
+	.string	"\230S\356\004\230S\213\366\312G\326n\253\026\006\254ew\353\374\270x)\372/y\006\2252]n\f\273k\211Ji\334\363\266\rl/\330f\t\007\262\335\214\231\313\306(J\210\355kl\313\361$\342_$M`/<6\024\270\323\215vi\277\365\021\361\256\322\007vU\262\223\335\021\301\225;\365\370\202\261\323\264\360\234\366\304MH\334\356&\370\260\n\212"
+	.string	"\026H\ts\232\351H\021\3418\311\231=\232\344\\\331\327vw=U\366_\377\274\353\227\024\340E%a\350\201]\327\331<\3177\362\272\317f\017\007$\372B\207\207\260\003\372\324\020\364F\037\330\325\210\257\003Q=`X9\033\207$<\260\212B!\260j\306\275\266S\345\206Y\r"
+	.ascii	"2C'\025\030<\374iq\355!,\273F\021\303\274 |\246F\301eij4\270"
+	.ascii	"\313\213v\222\001"
+	.text
+	.section	.gnu.lto_flashSitl_pageProgramContinue.34.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\215\003U\032"
+	.string	"\346\262\254I\240\230Q:\020\363M\341\202\311:^\220\271\257Y\021\261<v\217\235\326\352J\312s\236\024,\354Q!N\240\377oR \237\262 \227i\366=\370\330\305\030\r6\246\347\035g\211<\005\312\003\343\325\376\223?\032!\204\020)S\n\225"
+	.string	"\216"
+	.string	"\232"
+	.string	"\366\352\241\256lo\220#\325.\304O \200\351C\343\250i\316Yc\t\344C\004\240\362V\030"
+	.ascii	"0}\220n@\270\332?:\220\332w,\036`N\242\251\2469y5v\221\017\315"
+	.ascii	";\001\361!\371\001\342C\327l)\347\031\315\261hHP\317\312\234"
+	.ascii	"\323\2655<\376~\277\337A\336\rj\355!\270Z\363{O\200\243J\231"
+	.ascii	"\263=\004\307\237\0269X\271\0370\302\224\224\323}W\241\034N\301"
+	.ascii	"\035C\337\373"
+	.string	"\276@\367+sC\327q\302\234\323Z\346^\334\342m\367\330\266`\257R\017\277\252\027Nz\304\270\351\317/*\036G\024\260\266\314\204\276\264\372`D\375\254\315\346\341t\213\354G0\232\222\362\022\331*5\215J=\243R\313\304\234\367\027\270\220\037\346\273_\300\231\356\226\250f\211\352\027Q\355\"\252W\244\272\205T\253TM\216\352\221T\213\241:\034\325\340\250^Q\255\241\372\007VGK\032@\315\331\342\207eF\205N:\316t\373I\276\217\311O\244\315\005\251\324+\"5\347d\360\320\025\224\276\244\342I\346 e\365\320V\021GV\373\336\025\004\211rew\323_\270EV\335\330\230](\312\340\255\025\202\331\326~\207\224\304G\247\016\3169'\330\340\255\215\331\017\351~@3Z\226\365\344\345\024\325\212\333\262J$(\006\224\316\207\025\342CU\201%w{@<pO\264\020~\n\361\241\270\027\2221\3567T\001\361"
+	.ascii	"ww\\+\320\f\234\376\334Zp\357;\350\003\207\322\256\022\324On"
+	.ascii	"\267\310\266\356\356\203\262X\304\215\340\220s\316\007\276\023"
+	.ascii	"\210\021\244\216\205\370P\267\306\306\316/\362\246\024\276\316"
+	.ascii	"/\230\276\204\211\001\262\227\240\341\350\304r\304\027\355u\003"
+	.ascii	"\306`\262\236\330\r\211\3210\00794\031\317\210\022<\257\034\022"
+	.ascii	".\236"
+	.string	"Y\254G6\273q\351\310^'\\\260\031\217\313\001\002\357\240\210\315\\\264\235\235\231k\305\273}\211\374\336- \211\272\"u[\234i\326g\362&\024*\\\320\227\027\210\314\254\314\322\260vf\227JP\026\032\365\2270d\320\2272\373\245\253t;xW\244pks\214>\351Kl\3109o/}%\217\322`o\260\321\2276b\007\017\372\222\265\352\373\021\345\2636\277l\022\226\321\313).\273\332\227=\314\272,\370\024A\250A,\005\tS\306\030\021\222@h(0\3141\200\202\021\262\243\007\021\340I\234\232\366\faU .\341%\250\315\364\232\023\311\001n\255\332\007\022\033\357\245\300C`Uu\373\bq\364\363\350?|\360k1K\306\273\032.\325\366\344\3403\366\013\344\203\227\331\\\033l\325\206k\2137s\364[\027D\333\230_\203\372\211\003\217h\312h\205\277t\277\007\257UaHxp1\211\211\201\354\307\""
+	.ascii	"<\353\006\345-\n\302\005\210V&\341`>\034U\354?\211:\267I\003"
+	.text
+	.section	.gnu.lto_flashSitl_pageProgramFinish.35.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375 \367\265\006"
+	.string	"\362L/3pk\322\001\220\376v\367"
+	.string	"\n\230\3450|\b\177C\360/\333BI\036Y\212\365i\243\347\313F\332$\325\252*r\t,\366%\007c\317@M\232\264\275S\nVum\254\013FjEe4W\206\220\220Y2\230\314\240\265\271\340%\027.\213BV0K\252R\214\301\202\251\3010\230S\274\337\326\212\303{h#\307=Pk\311\377\367m\255\233:>(\215?bD\344\036\021\007\305\324\326\256u\205-4_48\340\337B\033\177,hR\0345z`\342\210b\201\211\243jm\210\343\304%\020\bDF\350\177>\tkvZm\f\003t<\034;\351\340\177]\307\363q\237\333\022\2645h\373\t\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_flashSitl_pageProgram.36.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\245\f"
+	.string	"&\330WD\020\2176\035\300\310(\254\004\275^\351'^\336\234b@7e#\224\fL\375\231@\214<p[\350G\034\343P`C\210~\257{\377nC"
+	.string	"\005\362\221I\310\205\302\272\337nA]\007\257A\213nd\357\275S\nB"
+	.string	"G"
+	.string	"B"
+	.string	" \300\237|<\300n\311\005\313n\270q\265N\035~"
+	.string	"uj]"
+	.string	"uj\320\206\361\260d+\222\027\025F\270\354n\225\034\016>\202\376W\256A\032\001y\254\024\354\256#i\004\303-o\273\200m\006\3667\002\321\272\\ZpZv/\274\314\330\023U\341\301\366\375\0227q\234\204\035\264\\\2476\207}\235\376\262=U\274\"\005\313\356n\274@\246H \220Y\021\021&\tb\370\020\340Q<ffE6X@`\235j\346\243}\223\007\322\016q\361$\177\345\030\0231N\024$\210\245\274\311\021\216\302\003@\311\356\036\360OL\360\374\016\037\324\351M7\240\201\305\207\f\243\370b\207!Q\222\330\237\273\273\226%\373*?}\312?\217\362\313\237\374\001\237\017\202H\003Q\330\207e\323\363\264.\313\260J\353l\035Z\346\251\334\341\200\276\315{\360\3610\220\247z\235\326\261uY\025mX\250v:\257r4\3466\264\256~\034\327\325+\034}\256,\271\201\214\323H\206\030\023\251\2342\006\024"
+	.string	"2\241\351h`\305\003\016\233\020\332e6\320\200<\013\3321\367yU\256\253\213@Y\001\n\303\260$\204"
+	.ascii	"\302gj\024\\\226\246F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_flashSitl_readBytes.37.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`%\001\225\r"
+	.string	"\306Y\\C\020\257&\035\203%\017@ \372.\b\351\340.\326_\242\227\001V\236\350K\001\335\245\340\202\377\340\030\026Q\257\212,"
+	.string	"\254rO\275\221[\t"
+	.string	"@\211\324\r\021\334\314\t\250\240,\007\353\332\266\021\262\311\2262\245H"
+	.string	"J"
+	.string	"C"
+	.ascii	">\210\207\350\354\031\370q\360\256\223\027\023F\260\330\335l"
+	.ascii	"\343\032\361\026\274\200xK7\274;\324\354|\216g:\304R\256\220"
+	.ascii	"\200"
+	.string	"\212\211\224\216g\0025V,)\256z\242x\247\314\313cw\235(/\303m\3356\002\333\n\354[\b\020\246\323J\037\003\300\207UV\263\213\241\306\305\322X%<\330\356\354\216m\030\343\231\026\231\335\345p\002\205\2010 cO/\035\016d\336\245\004f\354\211\205\202\201\247}\021o\351\376Ex\200\335\324\t\231\335\217\303\031v\313\037f;&\260\223\033\345(\246\rB\362\250\324+I\254X\255\250G\342\365\343\005\305)[\030\313\370\222\030\325~\300\345Q\327\253\376\013(\036\315\211\232\354\317\224\252\301>\\M\331\207\3719\217\3717w\371\261\177\177\204\351 %\006\"\332(nZ(4\362\0219N\333@ \317\245}D$\032(t\371\3231*\211\270\005 \234g\024\312\270M#\021m\240LD\344\t\311>\033\227ul\230\344@\333\262\022\211\264e\235o\257)_\365\315\212\n\225,pk*\324\nj\017\t\032\031"
+	.ascii	"a\b8\323aC\013E\206\275I5\267jq\340\345u\357\360\260\212\013"
+	.ascii	"\343\035\254\355\273\261\321\253r\340\"\260\242\253\302`\030"
+	.ascii	"\320\320\222\220%\030!P\341\340n$\325`\213\3204\006\005\005"
+	.text
+	.section	.gnu.lto_flashSitl_flush.38.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\305\b"
+	.string	"6\021?80\217\323\001\204\364\256\317$%\3170P\213\334 \325\267\301\262\313\337\031\216b\345\277\261g\034\354\313\035\275\237\031\241IKA\001\206\007\274\303\240\365\204)\f\323\2046\331;\245,"
+	.string	"."
+	.string	"."
+	.string	"\331\005\256S\2036\312\307\323b&R\205\210jw\3534\035\274\004\375\177\034@\034\205\227X\302\356Z\212\243\213{\3366\201\355\003\333%\001\273\273\236%[J\337\372\240T*\b\253]\213U\313\236P\022\216\213\355K\373\035O\201\367\220x\300n\311ddw4p\315N=~\340:\r\023\316d\301\263\207\353\323\376>\362\2421\0243\264\017\362\220\b\177\303\020!y\361\324\017]\247\2374\343DJa\210\344\312\036C95\354[\001\233\306\201\266\r\007\263\226\351x\270Oa\341\323t8\365\3636\020\347mj\003\247a\250\232\367\325\f\306\235\303\346UO\327y\3652\356\255\235%[+(\226\024\321\f\t"
+	.ascii	"2C\363\f\f\217zC\023v\301\220K\260\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_flashSitl_getGeometry.39.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\315\b"
+	.string	"6P=:@\305(\035\340\345\re~\254\376`/f\330r\201\025<\320\331\013\334\032\253#\370_\365\365\244\350\323\005\205D\177\222F\253(\242\354\310a"
+	.string	"G\201\266c\n\256\022K6\331;\245)"
+	.string	"/"
+	.string	"+"
+	.string	""
+	.string	"v+u=A\366\251} \373\224\032/=\226\374\213\034\363\370x\205(\323\243%aw\035CT\352\226\267m`\233c\333\025*(\b+\273\027\257"
+	.string	"{2]\035\266I\366\305v\214g\2152\002K\321\2620\331\255\007\246\332\247m\037\344!$\2272u\225\nH\341\250(\tr\302~\013\304\204\366\303I \264\335\345\214HD\024\2546>\375Q\366\031\345C\214S|\331\325\024e\206}l\245\312\361\254\377\030&\334\326\2118\317\307\342m\003\nu\240\302\002\330\001}(\370q\242\356\363\320\206\256\303@\267\017\244\033\215=\007\356\243!\317\373\350\245\356\261\225*K\315)\f"
+	.ascii	".\023Z'F\206\303\363\274\024c\272\351Y\346\032\0161\201M\032"
+	.ascii	"\343\016A\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_flashSitl_readBytes.part.0.56.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`.\003M\027"
+	.string	"6\253\225F\260\032Q:\3246\205l\357\310GL\fZV\255\343YtC\246\276,\313E\025\374\343<^\357T\355\333T\275\235\325\312\213\206^\276Q\277\354\037\350\317B\372?\334QF\202\243\215\3670\315\034\375\237\020\262\267\224)\005~"
+	.string	"\201"
+	.string	"\177"
+	.ascii	"\252\0272\273\317M\001\334L\201\302\252\366\203\034G\273\317"
+	.ascii	"\315c\346\344\221\242\233\023\327\340\322)\360\3228\320\376\217"
+	.ascii	"\031\n\333~\217\373\240\331E"
+	.string	"\021g\343\366\2218\312\371\3412\347L]\242N\300\273\214\037\340]n\215\323.\343\252G\363U\347&\3422B\217\224h\201\307\025\235\233\212o<\300\363\242\313\351f\213('Sr\236\273\232\270\325T\005\334\373&\3149\r\256\270\277\333\306`\373\202\275\037\002\337\205n\357D\267|\320\037\377\363\257\247\326\013\371/`@\202\026s\236\330y\231;RI\216\023\375B\367\223\034\211\257\344E6\021\r)\030R\200\"\315\031\343\213\316\002x)\244\223\031e\323\311>S\314\227\240Q\343\004\2269q\f.]\001\314\335\317\315l\223M\263M\226\372\240\231\345\021\027\005\321\3159)D=\220\021\233h\304\246@\200i\033rC\302\352\177f\270y[=\021Y\f0m2J@\b\340\222\266\324\223\344[0\246\212\267r\277\215P\005gKMw\336.\310\341\350\250\351\316q\345\276\350\322\210\307.\347\350F0v@Q}\250\370"
+	.string	"\232\033\303{%\021e\366\354\316\360\256\256\314\020(65\262\235\341Md\b\354\327\231l0`e\316\371`I\b\016>\216K\377\306\273\324}\356\013\206\212\364"
+	.string	"\031\241;\335\031^\357q.\217O\007\372\001D5\f\2506Eu\351S\223\036t\203\236:+\225\312\250TCM\206\016\341\214\007\013]\256\0172^,\026\302Z\255\325\027\262^ \302\226\3533\313\301L\315+\246\322\020[\315\270R1X\b\342\005k\245:\274V\034R,X,\345"
+	.string	"e\032\017!,UCC\003K\231\276<\366\240\005H$\355dq\261\f~Z\023\266O\353\t#\266\346\2251JZ\230\005\260\266j\245\327\261i\007gE\330\264\245\205\331\370\203\263\303\264\3179\362\235\374\211\215\217\303\254P\257\023z\227\245%\261\bD\250a4\307\0303B\024\215\210\004\231M\013\007\220\24293n\021\220\315t\235\3753]"
+	.ascii	"\314\035\016\224\226\310\005'B\327/\002\006\211r Q\244\227V\206"
+	.ascii	"\263\037\177_\203\220\362D\"\362\243\345\002\3762d\274i\204\034"
+	.ascii	"\345m\025[^\317\264\316\3228\316\322a\203\241=\240\256\347\206"
+	.ascii	"\330l\201lG\214\235H5\360\313r\303\342\377)H\211\024|\177\251"
+	.ascii	"f*\23152\314:\247j6\232\372\262d{\300g #\252\275:T>\320LS\244"
+	.ascii	"\227`?"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`t\003\245\017"
+	.string	"\344\026p\004"
+	.string	""
+	.string	""
+	.string	"\002!\177!\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006#\177\"'\177#&\177$\005\026%\200\204\001"
+	.string	""
+	.string	"\003\002\034\177&\005\027'\035\177(\252\333\3426\"\177)\360\372\2508\005\030\017$\177*\002 \177+\005\031\021\037\177,8\177-\271\200\202\202\200 %\177.\036\177/\377\377\377\377\003\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005/0\005\0321\201"
+	.string	"\001)\1772\037"
+	.string	""
+	.string	"\200\200\200\001+\1773-\1774*\1775,\1776(\17776\17785\17790\177:3\177;4\177<2\177=1\177>.\177?\003\003\023D\003\005\024$\003\007\024\312\302\353\343\003\001\244\001\003\007\025\330\244\235\311\003\001\344\001\003\007\204\006\003\b\007\"\003\b\026\204\013\003\b\024\244\013\003\n\bB\003\013\007\"\003\013\027\244\001\003\013\026\304\001\003\013\304\006\003\r\r\006\003\r\006\003\r\344\006\003\016\030\310\377\241\372\001\001\204\007\003\017\017\016\240\341\365\321\002\001b\003\020 \003\001$\003\020\033\210\245\373\206\001\001\204\001\003\020\037\370\332\204\371\002\020\036\304\257\256\226\001\001\244\006\003\020\033\373\335\267\377"
+	.string	"\020\034\244\007\003\020\035\375\374\314\371\001\001\304\204\n\003\020\033\364\230\276\030\020\027\205\262\307\360"
+	.string	"\001\204\017\003\020\032\244\304\017\003\020\031\211\344\216\341\001\001\344\204\022"
+	.string	"@\250A\020b['#R\330\202B\032\003\300\002)*\322\001\021\360\030u\310\220HB\221\260\354\001\032\344\006\357i\354\247\002\tP\223\004\r\240\fLe\247\350si-\250\331\035\345\352ux|\227|\024\202\016\302Uy\224>\031\377\334\305O\\w+t"
+	.string	">\353Y\2462\252A\341\210\256\260tIA\367\322\206b\212\\\221\0047$\345k\370*"
+	.ascii	"u\373\013\361\236 d\037\215\205f\006\225.\255,\350\245/X\005"
+	.text
+	.section	.gnu.lto_.refs.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375 \205\365\002"
+	.string	"R\210\026\032\220\245I\007\377\377\377\377\227\263\233\262\202\376\215\276m#\322\324z\267\275\245L\001\267I\253F\331\242\367\364(\321\241\312\031@\351\005\324\t\246/\351\005\306\223}b\374\244\257t\300ll\204#\307\r\324\317>\352\343\370\241n\366\251\007\307\027\323k\027\265\271\t\336{\340\264\213\177@"
+	.text
+	.section	.gnu.lto_.decls.9ad505506360ce78,"e",@progbits
+	.string	"(\265/\375`\312;]\372"
+	.ascii	"\252\203\331UX \016\245\244\016\376\273\253\262\273U\267s\363"
+	.ascii	"\377\273\367Ew\364k)\311\206\310;6s\243g\352r\277\352\2319f\337"
+	.ascii	"G\344(\302\246\210\205\001\006p2\256ls\267\317\030\303\345\355"
+	.ascii	"\263lB\035E\201\022\273\322\247a\205es\302\266\f<|\354.\377\177"
+	.ascii	"P\266\275\245L2\005\311\004T\005b\005\3323TF\375\034\217u\241"
+	.ascii	"\256\366:v\214\032\004lG\362\251_\260]M\365\334\304q\025S\227"
+	.ascii	"\244\211\363\352\255|L\242B\200\230\332\363\013}\227W\206Y5t"
+	.ascii	"\344\244\352k\300\fq\"3\242\244=\023\315\220\321\022\304\251"
+	.ascii	"\r\350e|\214\230\031kh\271G;\256\242\357\323\233~\251oq\241\236"
+	.ascii	"\366.\324e\222s{\301\210\371|\245\261i\177\301\3654\325\261\232"
+	.ascii	"\276LlD_\347\225Q=\320\3111\260f\023\023\006\322\2322\304\351"
+	.ascii	"RT$\343i\205\247\345\033dI\250%\245\364\2116\005\311+%=\333\021"
+	.ascii	"!\236\317\257\342\217.\224\203G\302\310\036\273\371rE\307\025"
+	.ascii	"<\250\366\313\201z\367.\007)\036\205\357\307\006\326\320\347"
+	.ascii	"?\221\214i\313\352\222rj\277\315'\272U\036\b\305\b\354\220\230"
+	.ascii	"\354|\300!1\331\021] 7\254\371f\364A\277\374\242\037z\241\013"
+	.ascii	"}\242;\305/\225[\227|\242;v\347\356\232WF{\022%\272tW\312=\341"
+	.ascii	"\206\304dG\202\373\345\341.\002\tOt\271\356\023\006\351\334E"
+	.ascii	"\"\320!1\275\360h%\221\300\344\237\231|\325\3344\230\332\347"
+	.ascii	"M\\\350+\037\351w\353:\203\354\275_\371;\337\023EMy\355~\337"
+	.ascii	"\265\244\013;\tM\213r\340\300\322\302\353K\212\232?y\211\364"
+	.ascii	"\242\220\230\236\007#i\307>z\357B\177\373\214so\232\337\327\312"
+	.ascii	"\275r\327\222\234\373D\t\206 1e\300A\213\345\251\361\310\331"
+	.ascii	"\375^\3213\201\256i\310\347<\226\257\241-.4\215w\357Z\336\200"
+	.ascii	"\366\034T\373\377\320\376N\355\257\245q\210\257\322\356W\312"
+	.ascii	"\215\342B\265\342\255\210\023;}\331p\372\354\027\312\215\272"
+	.ascii	"\357\275\267\224\2600\001\245\375\227\264\334\214J\024%z\364"
+	.ascii	"\331\037H\373%;"
+	.string	"r\321`\322\275\237\322\230?\214\\\264&\022'\027\356\266]\267\033w\237\\\350}\273J\374\022\271b\236\235{'\367\336>\302}\273H\356\332]\203\001\001#h\367\313\235F\355\2065\325Fp\277[Kn\223\273\3465\001\261$\321\275\235~\233\3564\367\355\246\335\260\r~\366\216r\022\200\024]\221\n\273\275\235\0348\314p\340\300\201\303}\342|r\002&_&j\223\322\315\204\021}\331<\367xz\301;GG\206\004\321~\233Ib\204\254\230\333\371\354\267\206\366;\245\3756i\277'\264_\245\276e\327\354B=\270g~\213\\2Ow\234\333\3712\364\276\272>\373\013\264_\017T\274\267w=P=G_\270\031\324\037\241\357\323\315\240\002\340\312\250\027\354\006\271\320\rw\210_\257\373\345\277\244s?\367v\306\374\332\2444y}\366\023h\025\2426\tN\202\366\273A\275\033T\357@k\270\031\324\274v3\250\016"
+	.string	"}\237\177\273n\013~\237\267\207\213@\202\273$wso\347}\346\275w\356\355"
+	.string	"\346\336\016R2\032;]jv\030\355\257\357\276\031\324\013WF\325p\265\334o\326mn\300J\241\247\355\265\267\023\303\213\2256\036\254\317\356\274\031T}eTw\374\303\030\230\273\334\361\313\340\353\356>\367\214\344\376\304=\377\271\347\025\356\267\254k\306]\3343\227\373}\342-\356\331\312\337=\243\320p5p\277\002\330 \004U\356\027\306S\367\\\324\004\001^"
+	.ascii	"\367\234\343[p\345Rq=\327\340\236\263\360\334oK\023wws'\376\346"
+	.ascii	"\356pm.\356.w\347\344\376V\b`\347\376"
+	.string	"U\352\334\177\212\024\367\007r\377(\356\017\345}D\335?\213\316\375\205\314\271\337-39\367\317\341\376qp\377\366\304\3351\360\241\273\223\340\272\271_g\020\005\367\374C\207\211\007l)`p\3172\226\270\277\n\224\270\373\b\274\313\335Y\334\263\224\373\263\270?\214\373\247\356\377\342\376\332\375\177\356\357s\177\325\375[\334?\306\375]\334\377\346\336\335\272Kw\337.\333U\273f\330\335\t\340\236\307\334\177\315\375\317\334\037\352\376?\334\277\351\376X\356\037\303\375Y\270\177\222\373\007\271\277\013\334\237\204\373\033\335\277\350\376B\367g\335?\350\376(p\177\240\373\233\300\375I\340\376\"p\377\020\270\177\n\356\217\202\373w\300\3757\340\376\031p\377\013\270\377\t\356_\001\367\307\340\356g\356\316\304\375\006\271{\022\367\227\200\373\305\300\375#\340~1\340\376\017p\377\020\356\377\301\375=\270\377\007\356\357\201\373\033\300\375;p\177\r\356\367"
+	.string	"\356\376\001w\037\342\376\030\270_\250\373\025\342~\207\334\257\220\373\345\300\375n\340~g\334\357"
+	.ascii	"\334o\006\356W\306\335\233\356\016\001wOs\367\230\275\275\275"
+	.ascii	"=w5\204\373\317\004w\020\034\020RR\371\3511\354=u\205\351\302"
+	.ascii	"\025\365\244\215\276\324R\370\205\346\024\371i\203s\243h\031"
+	.ascii	"B\204mi\267\227\313\017X\344\230(\320\355\362u\224\325T\321d"
+	.ascii	"*\3350*-f^\312H{\307h\001HP[bL\271);\345\025\027\232\227rR~\261"
+	.ascii	"\212AE\205%{\013\234\366\226#\332[\306\264\267\200io\321\322"
+	.ascii	"\336RC\237x\363ib\343Od#\244\"]B>;\223w\356\n\316\305g)\270\212"
+	.ascii	"\0363\f\237\r!\301L\202\220\230\354\3540\036\210<$&\273(8z%z"
+	.ascii	"%'\213\272\210\242m\030\356\347H\023|\004\210\031\207\243P\360"
+	.ascii	"\221\275\334\203\321\360\021\036!$&\273\034\224\213\262\211L"
+	.ascii	"\224\1772PVf\237,\224\227y\350Bs\317\215:\316\303z\034n\321\316"
+	.ascii	"\222\253\231d\346aiV\371a\261\347\231'\357\250l\315\246\265\274"
+	.ascii	"\223\221ek\233\212\2343G\301\361\343\224\367U2\243\205'G\242"
+	.ascii	"t\3524\303\273{84\035M+\216\357~\316K*\332\262T\245\216\245\007"
+	.ascii	"Ll\217\212\343\272\373|A\341v\206\365\031Oi\031\322\336\202\324"
+	.ascii	"\316\002%J\347\362\302\254Gh\3161\235\213\n\240\347\335g,\207"
+	.ascii	"\215`\240!Fv\3340\025IQ\336\335\032\334\333\217\n\334\030\215"
+	.ascii	"'\216\337d\360\300\226\237\261\0336\362\202\302(\211\322g\354"
+	.ascii	"$\210v\226\035L\330`\356\322\212\244\2268f;\322\035\261\370\214"
+	.ascii	"\225`#>\251\2600\032\237\361\332\257\031\245x\372\214\223|\323"
+	.ascii	"\336\335\336\263\306\021\265\374cT\007\227\346Xm\016&\271\214"
+	.ascii	"Bb#w\313\267=\030g\330\254H\034\225\024e\216\315\234\314e\003"
+	.ascii	"_\217\032\222*\237\361\0306\242\347\306\214j\030\301dB\212\220"
+	.ascii	"\330\376D\320\230\f\037\270\310\235\242O\200\321\210\373\214"
+	.ascii	"\305nX\276\312\332\361\365\031\023y\245\227!\033;?>;\025'\313"
+	.ascii	"*\210d\035\371\354,NC.[\332\205\266c\007\312\025\002\035Z\263"
+	.ascii	"\005\236b\251:\013;B\203\302Ra{\321\346\r|\005\223tn#\037\330"
+	.ascii	"\031\332\023\325\217*l#\311\f\\c\207\033\016\234\203\207\032"
+	.ascii	"\346\3022\234\354\306\033\026\336\021\204&\353\205\225*,;#\230"
+	.ascii	"\013\263\300M;7>X\351\250\302\262\333\302Ap\017\374\205\301\260"
+	.ascii	"\020\354\304<p\013\370\007\366\302@\260\017\374\304]\027\212"
+	.ascii	"\271p\323\337\006\326\362\231\027/\244J\251\n\213\013\033a\025"
+	.ascii	"\033\360(\367>\341\200\034JUXv\\\030\006\216\341\243"
+	.ascii	"\361U\205\365;3{\333\241!\377\366\317\211\366\337\232\216tj\206"
+	.ascii	"\213 3\355?\"\230\005\f\326\265\314\373\241\375\307\303\312E"
+	.ascii	"\213\305r\007\016\355?\032\314'\022\272jr\241\375\347\2441\r"
+	.ascii	"\034\005B\303:\322\376+\322\376Sb\252\005\f\231\372\372\354\277"
+	.ascii	"\255]\333i\327Q\027\2767 \312\"L\264\3533\035\345\037fp\271\370"
+	.ascii	"\354\032\252]?\265\353\246v}\245}\204$\274\204\005\0033a\247"
+	.ascii	"\013\305Mx\005n\302H8E\213\013\263\275\350\f\207\273\244S:S\263"
+	.ascii	"\373\350\264\222JD\025\244l\323\356K\242\335W\246\3357D;V\341"
+	.ascii	"\216\213\360\022\247py\312Q\247\270\242\317\030\205\273h\001"
+	.ascii	"QI\323\322\267\b\215\343\0238\314\210\211\274\031\372\316`\""
+	.ascii	"W\313e8\270\220CB/<\310\235%,\204\203\220\326\362\254>c \026"
+	.ascii	"\243%Q#\237\335\367B\373\b4\236I$\325d\361\344d0\311\013;)\345"
+	.ascii	"\305l\342d0\277\275\243\340\230C\222\242e@@\300^\b\333R\022<"
+	.ascii	"\0337\036\007[\026\017%V\200\354=\324\311\356\232\027\005\330"
+	.ascii	"\224\242X\371R\036\357\355\360\017\336y*_\345\351\276\356\365"
+	.ascii	"p\022ol\342\357>\n\356\371\350\347\275\334[\301<\177\005#\037"
+	.ascii	"\312\317\375\024\354s\241\277\3671\374\333\336\211\317\334\346"
+	.ascii	"\332]4\353\367\376\313\003\354\f\323@]Mhio\246\204z\341r<\302"
+	.ascii	"\210\020\035A\222\007\203\352g\360he5\177\253\213\212y\311\274"
+	.ascii	"f~\2609\331`\341w\370H\351\2102\231{\250\250\237\352\332\212"
+	.ascii	"\206\211=YP\227\320\022\2737r\366f!L,\177&\244~\242\357\334{"
+	.ascii	"\256\377\201\235L\237\017\036\026Q\2667\203Ab\330\273\005\035"
+	.ascii	"so\347\243\355\275\332\233m\300\243\264\300\r\275\275w{\270\273"
+	.ascii	"\226\264\267\221\006\0350\252\360\3400\303!e2\343n\314\001\331"
+	.ascii	"\037.\t\203\346\242\214\350\363?\241\221i\001K\323\253\372,\323"
+	.ascii	"\246_\256\231\232D\273*\246]mA\273\232C\273\nC\273\272\244]\025"
+	.ascii	"\322\236\356\351\020\244hO\233hw\222i3\037\024`a\005\234\227"
+	.ascii	"\366\260+CVdGH\221$\237\277\310\217m\361$\031iiO\257\264\247"
+	.ascii	"4\264\257\245.\264\247M:\210\307\034\231\202\353\371\354\251"
+	.ascii	"\n\355\351\217\366h\326\323\236\347\264\377\017\037(\330\002"
+	.ascii	"X!\311\263\367\371\237\337\202\277\217\357\332\357\343\303\323"
+	.ascii	"\336;\357#&o\357\235\230{;\270\267\203\274C\252\n\210\232=?\321"
+	.ascii	"44\376=\\\346n\341q\225%\32137\303\026\217+feF\365y\356\265\\"
+	.ascii	"\203\227\347\321QW\221]cV]N\226\345\256d\214}N{8\031vzBB\344"
+	.ascii	"s\312\025\225bu%\304o8\307\300>\247[\236\356\023>Ua;ER=ae;v\244"
+	.ascii	"\315\253\343\255\306\022+\255kCk\222\345i\323=f\205\013\243\344"
+	.ascii	"\216\0313R,\234\347\262\221\027\234<p<\2300f)Lx\335\360\024\313"
+	.ascii	"\323\034RN\255\274\317)\013i\213t\006S^\017\216t\312\253\b\032"
+	.ascii	"\3649\275J\241Z\216\236L\254R\024\276#D\365\374\354\035\364`"
+	.ascii	"\004A\3619\255\221\332\3705(\273\036fU\013\221\252!p\314\264"
+	.ascii	"*%\322\"\210\t\006\362\2259\233\364h\370\240fT\235X\272-\371"
+	.ascii	"T\271\001\005\225\306\310>\327\271\223\236\220Pht|]Y\372  q*"
+	.ascii	"\242<\215\341)\025\313\021\030\313\270\317\351\213\024F\252$"
+	.ascii	"\342d\007\364\263\213tJk\t\254G\206N[\244P-\360\314\240>\247"
+	.ascii	"RL\315*'HZ,\271/\245,n\217]\224\201\022rK\314\016S!\262\264\223"
+	.ascii	":y\312\202\213\205\275\374\2346e\274\036\035Rf)SL\016\274\240"
+	.ascii	"\266\224)]\021\223\225bj\006\021<\034*R\350!O\213\322\2414)F"
+	.ascii	"ho\241\215\223\333)\215\t\023D\027\345\342\204\247I\236\"\021"
+	.ascii	"\247|\370\370\234\036\371\245\222\342C\251\"U\332\210\013r\345"
+	.ascii	"s\232\002\204\246;\250<\024\016c\t\r\034\237\377:\231\232\032"
+	.ascii	"\r\211\341h\372\234.\235\356%\b\027\f&\"\fC{\236\362\354\245"
+	.ascii	"A\270\315e#{\354\"\337\020\264\027jv[\231\264\241\205+\210KI"
+	.ascii	"j\302\323 O\201D \301\3454\026\013m;\237\323\037O\225IG\304\242"
+	.ascii	">\251\322\375\307b\345\342\231cN;\b\272\307\221\221\321\347\264"
+	.ascii	"\307\345\256\344\204\240|N\223N\346\222\344"
+	.string	"\304\356\305O!\221b\343\371\234\"=\335q\377\375\304\234\\D\265i\367t\003i[\301T\242\375\002\232\235\333e\275\020\356\366\361\361\365\345{;\323B\221\363<\353\3350\244\013,\261\317N%\343\301h\3518B\221\215\222\252\342Xl]DJ\210\005+9\311\245\351\211\222\022 S\246\344\272\031\275\265\276\250\242\271L,FY\246\342\271.\263m\265\271YA\201\222\243$@\005\324\226\230\246\262\347d\316\251x\216\222\237\230\tX\023\270\317~!\206v8\270L7\363\204\204\022B\216\245\250\245\335\336I\033bVD\327l\3449\317t\251U\226V\335\347,\347rxh\t\r\3729\307\375\324\0135\315\2201w\332\257\216\233\235\370\205f'\371\311\357C\025(\246\017`\234\340\272Pd\2674\032\327\365\023\247=&\255I\023,\204\225O;P!\310\224\256,\331\355m\366\001\313\231\022\212+<\330\234\r\337\351\2757"
+	.string	"r$m`yB\261\320\342\263\307\320H\222\225$\301f\352\336\327\371T\264\\[\303f\277\237\366f\372~\364\\\211\306(i\207\271r\344\b\246SrKK\303j2\230\320\2633\314\246\267\034\023\253\254\f\277}83Z\"#\303uwo+%0<cc\371\311U\205\b\021|w\3672\004\033P\232@\363\220W\232\261\341\374\300_\316\204\b\301jwo)J^\276\300\3002\317\335[\212\003\250X}}a5\215\334\033ya\3634qc\356\244\024\033\374\005I{n!\373\370\201\351\356^\356\235\264\221P>\224q%-7\270K\236vw\277\352\336Y\356\275O\244\316\275\344q\361\233\336\273\301\375\345\342[\200\275"
+	.ascii	"\035\347\346\201\306M\321VCvV|\336\356k{'\243\220\020\2102JF"
+	.ascii	"!)\237Q\033\231\254\201\304\260\334QH\345so\f;\231DN\340icP>"
+	.ascii	"\267\321\356Ybt\2673\n\271\223O\033\303N\356\035\r\312d\224\221"
+	.ascii	"\362\271c\204A\371\2142\332\317\250}a'w\226?\311\275\304\260"
+	.ascii	"\237QP\366\363\311\350\202\362\371d\244|F\351\270Y?N\222P\b\211"
+	.ascii	"{\261t\241(\223\233h\210igyaM\351|\332n{_/\023{Y\200\275\231"
+	.ascii	"\236\226n;H7\214g\215\210'\310\316\323\315`\210G\352i'\327\224"
+	.ascii	"WO{_\361\334\354\241\017H\347\332\246\272k\310\026L[\310\304"
+	.ascii	"\336\003\030\332\033y\367\332\336\033\271\367\366-\231\234{/"
+	.ascii	"]P2\207\206\366N\232\031\332LH\"&\366~\257\2670#\345S\352\211"
+	.ascii	"\206\210\217's\3738\221\227\271\335\242\226\372\211\344\332B"
+	.ascii	"R4\323\bE\224\317\271\213\245\005Z\021)P\355\271\207{vf.\226"
+	.ascii	"%7\"\250\317\327\355fP9h\322x\336JY8R\242\361\3313\017\367\334"
+	.ascii	"\314Z-?K\354R|\276\033\354\240\361\234\345\213\001\245%\343\263"
+	.ascii	"\006YG\306\362\365\330E\367>\277\362fP;\340A\343\231\005\315"
+	.ascii	"\2456\226\374\354\031G\276R\367\252\246\b}\366\260\233Ae\271"
+	.ascii	"2j\266A\343\371F2\005\220\032\237"
+	.string	"\177\231\231\253p\236\2236\251\317\277i\320x\256\361b\366\"\372\231"
+	.string	"yF\226qU\354(\023\237o\022\025\215\347\030\277\257\273\251\262\317\030d\030\356y*\277pY\262\023#\306\347\353u3\250\031\\\031\025\027\321xv\3412c'z\224\005%\216:%\264\354\261%\nqK\f\332\020\331\234\242M\312\266\300 Q\307\330\332\374r\200885\355QH\324a\217\305a0\265\361\265@\034c\321F\265i\211Bc\216\332\n\211'\224\310\t\372M\207\021D\241\261=\006`8\324!\022\213D\337\n\212\306\233\266H\364\331"
+	.string	"\331an\331#\016\213\243\266+\260\032\210\031\036k\210\305 \233\201\022\300![\023\200\017 \216EcP\210\243\375\246\003\021\210\203\343\341X\342\230\200 \261\304\021'm\375\246CQX\323\0363\030\215lM\220m\331\232\0132!th\215\300\234\016\031p\020\200c\nCaKL\241\304QG\004\206\022\306\"\016\233\201\230\f\032\254\303V\210\302"
+	.string	"<(4\262Dv\204\366\017 @"
+	.string	"\021b\005\237\207`@\b\f\bA\365\020\f\240\241a"
+	.ascii	"\b\032\355 h\260\213\373M\007\f|\340\004\024<\264-Q\247\030L"
+	.ascii	"\217\353\3131\205\341\357\230\202o\b$ad[\342\t\254\n\302\234"
+	.ascii	"\343K"
+	.string	"\211 \221m\201\030\310\201i\331\021-G\241\257D\r\220\365\200\261hB+\004\256\300\245\245\304\220m\331a\016NQ\002\354\021hdc\210\302\021l\t\027X\035\242\260%\026% ss\024\022\205&`\300\001\032G\024\215\034h\2719\352\fm\322#\333\226(\341\3477\035hZ`{\314$\330\232\325W$\n\327\237\nD\341\220\270\266G\335\256\253\326\321i\327\325W#\034\261\266G5\204v%\301\326\254\253\217\004[c\\[T`i\327\226\030Ta(b]Y\216\"\326\366\370\303\021\266\300\265=\342\370M\207\006\004\331\234\243nW\026G\330\256\253\016\262\307\225D\253\006\331#q%\321\372p\204mpm\217\276v\035A,\016\217\353p\b\f\036K\034\327\025C\rK\302\310\036Y\343\032\024!\034\216X\327\013\331o:\264A\035c{\364pdsJ\264\036\216\255P\204\007\035\342\b\020V\320!\n\207 |"
+	.string	"\261\202\b\261\202\007\266Fg\030$\n=\030\217:\036\024 B\r{\324!\352\254Z5\2669.5@\326\bcls^V`\243\343b\243#\242\345\205=\002E\2549:*\004\201\"bj\210\354\312\222"
+	.string	"\036]\216FV\005#\020g\325D!\360&\270\252E\";\024\332\254>\021\216#\200C\233\325\327\256\276\232aqm!\342\350\f\213\301\325\250\023\\[Z\366\330\222Xa\214\300\233`\266\321\021\321\032\2137\307\365\327\256,*\004\213\303\017 \326_\313\036ml\212\253\257\245%\021dk\212\301U\277"
+	.string	"[`\315\312\326\bW\260\262P"
+	.string	"\003'\230\260n\340\204U\267G\341\360\305FG\304zd\215,k\264Y]\332\225e\201\360\250\222P\003\314YWuM\3335\204\257m\327\r\304\260+[S\314@\361\004\031\266\246\210\223\217\353\006N\030\346\340\bW\r\355QGD\013\t\266\346\250#Be\2075D\340\215Z\024\376qe\203B\022\354\004V\020\260C\021\300\017\220P[\277\351\240\201\027sX\243\207\266X4zha\327\0266\247\304\007~\307\265\0021\355\372r\364\351#\013\313\002!\nC`[l\177\355\n\202\306Xl\203,\nF\226\003Gv\0040\007\246\204\261eq\212\354\b\335\256\"\214\320\022\205:\332ih$\240!\005\rT@\007;\f[\341q\265\361p4\262$\204\306\032\017D!\020\307C\320x\364\320\201"
+	.string	"\307#k\254\251\211"
+	.string	"\333\n\215!h\211\254\321\250\023\224\2719\002\207&\260#\214@\f\034\205.\303b\261\2045-q\324)\201-\241f\250S\f\266\270\273\372\343*\220\247HQ\216\240V|V}Te\016&\220'\237\345\346\254\342\304x|V{T\02310\230_cN\347\321\030\273+\27375\231\344#\312\302\233Ry\356\\\235\t\035A;*rk\316D\217\317r,6T\2748\372\234\351\276\242\364\366\262\236\330\r&\272\317\251^\252\227\353\356^\332\200\302"
+	.string	"G\336\223\024\244\270A\205\227a\344\247'\026N\356\362\f\325\210\006\023&VR\026\037\315\332xv\231\t\266\026\365\252\363\264\212\247TO\220\312(T\262\016U(.H\317\224\0301A\232L3\244\244A0k[{TQ2\217\227\274)vV\240\374\270O\360x\020E\233.\315\036uNt\320\230\026\246\342\234\314\245g?\271+@V\310\345\036z\212\215\205\216\270\024\013\346*\b\036\026\\\306\321\322\263T\353I\337\322\265\2630\270\272\317i[\352\344B\235,us>a\2208is\263\241W\360\355\355\355\355\271\247Mr\3353\316\212\2363Fm\223r{\302\226\237=+\350\240\244K\242\260\020\362Y\3629\315\323\322\265\333c\027\231"
+	.ascii	"\355F\035\026\013\226\035\n$G<]\3634\211\236\321\320\033\022"
+	.ascii	"\265\224)\206y%\nD\0265D\324\364\33118\n\363T,,=\323\211Q\205"
+	.ascii	"\205\305\242\324\364\371a\304\3233O\315H\370\251k\241l\214\210"
+	.ascii	"U\223\224\314\311|B\224\364X)\242\026\304NYd,\233=1Y\244c\270"
+	.ascii	"\331F\245\n\221\266/O\301\276R\2503\261 -\325x\245%DyB<\205\222"
+	.ascii	"e\247\317V\326\3474\b\0205\036\236:y\244?\356R\324\322\347\203"
+	.ascii	"\244\352\211\017O\177\270\343U\351H\3629m\301\345\220D\235\210"
+	.ascii	"\3629}\376T\205\t\250\363\262\343\221D\341b\2149\245H\204$I\223"
+	.ascii	"\306c\025@`P\\,\230\315\262\\\017\023\300\223\350\243\201$)\031"
+	.ascii	"S5#II\212\n\245\2151S\304[\007\337\263\220\202[\005\002\274\343"
+	.ascii	"\207:\236g\242\210\0337\t\322\2774<\263,\264\311"
+	.string	"\003{\207V\240\300\376aOPR\016\361U\261\263\022O\334[\334^G\216~\261Y\367\221\333\304\274`\320\364A\317\"U\317`\216-\374\032\221\367\366\303B\271R7\r\022\224!\036\254=\371\355N\332\256\326I\370z8\344\017\325\212%n4Sh3\217\243\206\001N\351@D\303\f\277\t\367\242\260\\M\374c\037K\357w\315\021\021o\205d\241\n\213{\241\355\257x\347\324\255\266\2135\303/\006\324\342\022\321\322\220\375B\240\244v\371\"\305\323\373\275t\217\267\364\022x\373\323i\210\325\222[6\376\240\321\242\215R\355_M\274Y\227\004\227j\370\303\223\343x\316\357\205Qy\\d\033\203\222\220\020\322P+63EW4\333\363\265pb:\002\273\261tDh\305O\353\006\252\326\004MP\022\001\006@78\334]x\275$v\016e^`\tM\225\021\313-\342\234\017;\251)8^\310z\223\310\007:\275\350"
+	.ascii	"\271a7\267RQ^\206O\207\206U\366\372\003\330\255\373X]p=p\231"
+	.ascii	"\220\374\027.{#F\326\022\310\343\273\212\323P\35362\242\3707"
+	.ascii	"RB.9W!f\013\"\232\224\033D\\L\220\321\213\333\267\256\005p)\217"
+	.ascii	"G\351\226\253\236H\247\020\342\365\203\357SY~>\300b\216(7\026"
+	.ascii	"PU\337q\343J\310N\244ZS\031\346Ak\307\350\217\033\343p-D\260"
+	.ascii	"*\275\346\330\233\020\235\256\346{\314\355\253\350\334ed\366"
+	.ascii	"4gb\231y\340\217\255\002\206\313\236\357\303\005F\342@\352P`"
+	.string	"\024j!\372E\b\037\240\021\354?na@rR\3403\0310\204p"
+	.string	"4\031#\"\216a\274\350#A\322\231\302\256\026.\264r\242\007-\343#\244.\254\356JZr\004\006\002\354\340=,\312bd\340^Y<\340\266\023v\366\345e\201nn9b\253\310\016I\222;\211"
+	.string	"\3708\360\272v\230g\330!\264W\250\344\216"
+	.string	"\022\365r\265\230:/\376\204H\202\300\240t\024\324`\325d\013J\036?\337"
+	.string	"\373\001\223?\234O!\274\311\242\001\256\255\251\263\345D`"
+	.string	"\\\b\024\201P\234GuH\217P\264\322\330;\374\240\347\202\300/\n\344\350\363\225\226\024b\302\204(\333\202\234\357\030A2\243OC\276\331\332\243$\260\320F\n\030<"
+	.string	"\217\235\330\021\216%]\276\304\353L,\030\343\322)m2\206\213>\260\264\304UL7/\300\342;\013\016\3427=\300\376HAV\311[\362\333\312\374*|\331\261?0\276\27611p\233\006\275+\253[\264\205\361\027(\273h,\0172\353\241\356\f`\\`\277\033\360\345\355\024\367\201\263\340E\321\366\252\232\355x\305hR\375\334\363]\201P\200\202\260\032\001\315\347\346\200@~I\266\232~\352H\272\033\347\314^\364\353X9\313T<\337\022\235\034\252\327\363'?\276\367\\\332\207\036\331\037\364\266\304\251\016\244\335\325\377\032=\274mF\234\205\004\355\t\340\312F\374\016\224\365.\326'"
+	.ascii	"\027\020n"
+	.string	"\036\001\260k\017\225\034d\315l\315L\006\206\243m\226\253F\\nc\205\370\323\260\227\021\233\030\032\371\246\233\343`\200\312{h\240\323\211x\346#\306t/|\210\2001y\2377\t\373\3144\243W\005\262\373AX\b\215r\374\347\177;\273\036A\350\t\236\344\225\345d\374\243\254B\346\307z\246m\037 5\204\023\231\264_\237\023\223\271\265H\n#\002oYv6B\r\263V\314w\347\016Y\210!\030[G\320)\246\212\325\324\253M\351L#\0275\n`\341}\371\261G-\360\035\264H_kS\001\n\355\237\341\323\235\320\250\256\370\2600\347\r(\272\367\210wr\217\022\240\013\346\235\256&*I\020\262\332\006D\177\216\320-\031\377\306yH\253\330\"\212\271Rf\251+\177W5\214\232\373\246;\3147\016\300\354\021\314[\013\036#\f\302\224\002\203M\2605\305\2268\262\317\024Nl\317\0269(\231\036\343\021\247\030>"
+	.string	".\210\200 \265\005O\374\017\327\b\372%#>\213\020\307\025\262\b\025\264\345\017\201\270\f\236\bf\030"
+	.string	"1\360`\r>\317\001\215\024\035\216o\215\374\230A8\327\230\b\260\221\033P\223\247%<p\243\"~2\237%\031b\033\250?G`\240\304\005\271\331>\221\311#A\346\241\341\343\037\242\017\201\030'\244\204\364=\003l\302y\357l"
+	.ascii	"\023\362Xd\304\231V|\310\337\\b7\243\324\201\202\377\227.f\236"
+	.ascii	"C\006i^\006\203\206\214\351\357uo\256\304\211\221\356\244z\304"
+	.ascii	"\223\266\177\377!B\r\246>\353\034\\\"K\317\371\253\3216@\325"
+	.ascii	"\301\1774\204("
+	.string	"+\375\026q\261\233BM\352\351\002g\037\340)\247\244\n[<\305>\232\276f.\373&\225\217\221\250\033C\371j\247\034\234kY9A\237~\240S\247O[\227\271\257k\252y\361\351\375\225\017\263\342O\336%\330\314\310\177A\262\216\271\373\277\272\\\025<a\005\257\260g\332\230\214n\n\307\374\221\037\024\330T\324\241\3372\321\3753\003\305@^\362\261\004}\330\364@\275\236\265\362\366M\351\005\266 A\351\210\257\360\307(8U\302X\266\327\371\215\033,Z>@\324w\245\223P\215*\351\352\346lMa\023\026\332\023\3727\265\304\302\260\2126\023\3571$\221A\361k3$\264_m\336\002\035\233x\214e\315\360S\251V\331\330\342\361\331\323|\362\275\352\360-\340l\300J\361\205\214\341\327;\373\2342+\372\257\313\336\"j{\245\352\320\347\373\373\001\337c2\370\356{\030Q,txq\005\315\350}\344\020\230\230\331"
+	.string	"0y\224\004\303\370]\343L7\032Z?\232\005\020\013\260h\027C\\\353\370:\306\232L\221z$\003\313+\351\224\024\f\212y"
+	.string	"<G\352\036+\244\341\022\262(\253>\264n\323\207\002\016\324\235\253\tU\260=\210\266\344\244\226I<\215 \253\013\334V\323\231\223\315\226N\331\216\263\357s\277DPb\220\001\272\221A\230$\231\026Kt\240\013:\372\253\305\254\333\325\355\366F\013\330\247\251\354Q\tc\254\352\237\323A\032\037\261\341\260\256\023\321\255k\237\262\365\003j\370r\002\215<\244\tS\232\360T\3716\243n\013\246j]}\234\364\321z\247\240M\351\275\n\024\250\020\205\344\342\035\315\323\322\034p\207\332g.\2334\230\233\352\222\026Y\361\027\372\006\001\221\002\245z\b}\360X\236v\364\017\024\225\371-\200\315I\305\271\374\314\247\306\fCFp\316,\373\b\016\331"
+	.string	"W\026\352Q\257\243I\253\320\254<.\013\276\253^\326\210\036\275!\345xH\274\240\006Nu\245\201\327\b~O:\017Phd\201\252\343J\361?LL\207\315\310\f\336\300\272\r\236<\270a\361\320\226CJ\300\201\245\360\035q\236\031\342f\030\253\357\036\362O\334- v\022\351\243\237a\314\377g\277\205\262Q\326)\266\346\373\302\274\035\313S\215b\214\207\007\035\270\252\250\273\314/\f0\372Y\\\217\307 \275\267\220\343d\350=\362O\304?\256\277\361\221\341\336\305m(\342*\313\250j\257\336~\2725OA\352w\212\242\005\252\367\263\035\222\002,\343\374\276\257\304\252\333E\f\3028\253\243\201\373\263\""
+	.string	"\264Q\271\256\033tZ\224\233\221\005\370\360\334\363o\212@\265h;\001\037\026\213\246H\024&B-\247hdK\347CY\336\t)\316\346<\376\325*bs\252\2679\205J"
+	.string	"\340\327\246\021\r\006\205\265V\027\253Vp\233d\037\006\001\365d\204^\327OFm[\250\f\\\025\220\032\t!\f\271h\020\362\214\3275>\024d\311\361\264\305T9\317\fG\003\220\220\316\020\230\204\335WJY\340R\340\322/\204\003K\272\315\251;o:;>\235\310\3150\315\302\342\357W\301F\264\242\313\255\266\333-\324E\241\255\336f\256\335\313\327\322\2006\342\350\230\262A$/\325\206\350\355\267\376\207\221\343p\312c\3209\342\021h\251\234\331rp\273\3510\220\305v\263\f'\342\0248\035\\\217g\301\225uG\342X\n\250\3738\375\263\262t\316\333I\371+\372=\\{\344\2668\312\215s~\245{;\351\230(x\016L\333\342\313\337\350q\217\3124\302\346\030\323>\212\327k\360\227\020\361\201\325f\240\245\007\037Z\267\343?"
+	.string	",\354$\243\351\327\272arZ{f\227\335\347\037G\217\204n\222\237\237\031\221\233\365\017\367!\357\300n\3526\340\335F+\177NN'\3336\224\005\353\274\300=\361\030\305\207r\021';\261c\205@Z\177>_\273\373\315\267%\254\005\232\333\234X\343\337\262\203\330\221\263\264n[\373\244\301\016={\323\253\361\377\025\026\311\030V\3641L\374'\364Tu\243\220\237R\324\257:Wa\315\322\254\252\340"
+	.ascii	"\242\027\351w\312\330\363\300H\336\025\301\206\006F%_#\363\365"
+	.ascii	"\303\251\304'\3636\024?\301\373\273\331\375\230s\277I13\240\355"
+	.ascii	"\t\357\201\206\016>\356}\360{Ww\324~\372\222\207\365\303\204"
+	.ascii	"\017\204\377\267\023w\223:\350\004\034I>\221\355\252:)\307\320"
+	.ascii	"\001\376\235\277\025"
+	.ascii	"\275\311\3117\216\037o\243&\277\033\217\032\237Wk\311\240\247"
+	.ascii	"\247+"
+	.text
+	.section	.gnu.lto_.symtab.9ad505506360ce78,"e",@progbits
+	.string	"flashSitl_detect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"flashSitl_vTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"msync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"sitlLatencyNext"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"sitlLatencyInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"mmap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"ftruncate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"fstat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"open"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9ad505506360ce78,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
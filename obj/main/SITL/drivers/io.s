@@ -0,0 +1,850 @@
+	.file	"io.c"
+	.section	.gnu.lto_.profile.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\325\005"
+	.string	"\264\b\016\001"
+	.string	"\026"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\006\002\007\002\006\020\311\256\332\347\002\002\021\324\314\220\352\001\022\345\231\261\200\017\023\234\253\215\342\007"
+	.string	"\024\025\240\342\234\212\n"
+	.string	"\023"
+	.string	"#3\034\234qiMf\333\302+"
+	.ascii	"\234\001G\261y*'\201\226(Sc\020\303U\260\317e\263\247\306\003"
+	.ascii	"[\\\3662g{\032\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375 \273%\003"
+	.string	"D\003\257"
+	.string	"\025"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022\001\003\023"
+	.string	"\001\024\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\026"
+	.string	" \006\b8\347\300\034\005\020p\314\031 \260\325\213\335@\004\304\200\340"
+	.ascii	"\307`r\003V\30080\030\030\002\306\201\301T\246\275\004\267\201"
+	.ascii	"6"
+	.text
+	.section	.gnu.lto_.inline.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\343\006\345\016"
+	.string	"\026\022?7@\305(\035\347\332\301\005X\fIK\216Z\244\303\217\002\313\275.\031\321Y\003\f\227h\304z\013\262.\337\206\237\322\030Q\024\005\br\0046\241\255\221\330n\233H)S\n)"
+	.string	"2"
+	.string	"5"
+	.ascii	"X:X}\220\222\210J\243g\335\250/\353\364\344\327V\277\274\357"
+	.ascii	"o\272\276\235\316~\200\020B\330i\177K\b!T\373\300\026U\353+\244"
+	.ascii	"DEF\tf\354\362,N\300\370\377\311\026i%\242\034\317\356:}W\363"
+	.ascii	"n9b\242\232\270\234\2539\267\243\001R,:\356\347m/,\177\006\027"
+	.ascii	"\240\244\270\370\210\300<\212:Q!e\034\220\321\366\3553\346\360"
+	.ascii	"\220\343\365\244w\343\375\254\206e\371/\270,\033\356F$\rV\346"
+	.ascii	"L\243\331\023*\004\305y\200\240X/6\3304\306\330\332t\2141^.@"
+	.ascii	"\360\246\016\200)\224\272\230\300\3669jL\336:\320y\347%S(\345"
+	.ascii	"\254\345:\323\007\345jE\264a\261@b\2501Ud\214\304\202\024\024"
+	.ascii	"*\313\001\300\"\231)\232\007\022\300\203\025\304\241\220b\004"
+	.ascii	")&xB\211H\242\222H\242\250\202\344\001Z\311d@\236\316\b\224\026"
+	.ascii	"|\333\226\315\0327\356\377\f~\352;9\301\222oX5$[\316\306\321"
+	.ascii	"\223\001\t\200\246\233\241\236\304\321\002\322\376>\373v+\246"
+	.ascii	"\205\t4\020\336\364\300(\321\220\243T\227\364\205y\330\031\302"
+	.ascii	"\261\331jw\366\\\236\032v\307%\226\224x\321\352\322\321w4O|\004"
+	.ascii	"\273\276\3621\177X\300\261\r\032\302\"K2\003\nj&\247B<g\241z"
+	.ascii	"\033\232\022\324\032\272)\nM\230\036k\332\003N D\203\006v@B\210"
+	.ascii	"\035\376\306\326\267dS2\252\3538f,\255\346\344t?zW\300\273J\226"
+	.ascii	"\345\336\242\222\033/\243!7\272\037\307+F\031\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375 \357\355\003"
+	.string	"\"\206\024\037\240'\351\377\340\377`\031\376\377_\373\377\277\371\357\265l\366\377?\351f{\355\177\322\310\226I\006L%\037A\036\f\005\202\322K\024\177%%\031 =\353\245/bV\362\005\201\031\277\030\260 \276\240^M\363a\370a&\213\216S\265\262~\353\3253\301F\021"
+	.ascii	"1\207\200q\201\032M\324-0Ne\260\232\203\0365D\240\230%J\231\227"
+	.ascii	" \300\0200Ne0\234CP\031k\003X"
+	.text
+	.section	.gnu.lto_.pureconst.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375 D\335\001"
+	.string	"B\304\r\026\240\2531?\360Os\377\377\273\376\257M\3234M\3234q\334\254\f.\311*r\310\037\317\361\032\217\361\026O\361\022G\\\207\033^8\341\203\353\202\007\016\270l23*"
+	.text
+	.section	.gnu.lto_.ipa_modref.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`p\001\375\005"
+	.ascii	"\"\307\025\035\240'\351\377\347J\374\377\277\253\316\377\327"
+	.ascii	"\377\2738Ik\275\3667YK\333\266\326\232\224)\2476\b92\217\026"
+	.ascii	"\322\276\212\210\013\205\027J{S&\fB\007J\"\342M\024\251\202g"
+	.ascii	"\312\227v+\217\001\236\002\034\003\023\244\2162\314\276\323\357"
+	.ascii	"{\316\253\334\312\37782\335C/ \320\002\0212\362\201\271\261."
+	.ascii	"\204=\262\272,2\005\002g\325%\343\271\3731:X\345\223wM\367\210"
+	.ascii	"\030\f@l\230\n\006\026\027 \334\002\023S\020kF\035F/\017\233"
+	.ascii	";'M\272\2554\0068\227\211\024K\324\027\350\2055,\211\021\374"
+	.ascii	"\336\306b8\334\323\320^9ke|1\307\202Q\267\367\230\305\342\242"
+	.ascii	"\273\001"
+	.text
+	.section	.gnu.lto_.lto.9e5597f8c0f7eed2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.3.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\002\r/4Pm\222\016$\243\252B\304\022\212\242C-,\312\021_\016\200\323\316U\230\231\335\r@\007\226\340]\262\327UU\325U\025\375\356a\246\371z\035\373\273YBd\n\257bw8\257r\037\350\201\250\340\202k\250\024\030\\\007~\034g\363s\360@\367\360\036t\232\230m\327\215@\242M|\f\261\226\361\275d\273\276\245\266\rc\2412p\222Y\321\302\222)\223I\307\337\037\364\232\237\261\226\"\n\220yq\224dF\204\r2\235\376\373Q\020\320\326&n\220(\021\022\212\221\225\314\350\216\025\240:e\032@uj\032\265\312\254\333\220^<0PD\243P\031&!3g\242\021\251\267\376\005\377\301\177\021\007"
+	.ascii	"u\bX\347\220\255\302q\r\017\303\204\"\374\314hj\347\023"
+	.text
+	.section	.gnu.lto_IO_GPIO.4.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\275\007"
+	.string	"\302N56Po\322\001 ;\023\035a\373\205\351\203\235V\023\004\211\220Rh\256\350\214E>\312\007\002}r\006\2204\206\230\231F\024\243\213\334\331\354\363\036\013\226H\333D\356\224\002\322z\356p\244\025\261\313#a]\f\321\301Zh\210\235\013\213\234\215\345\203\347\212\020R^Q3\265O\253\233*\201\246 \333\330K\"\252]\214\004\237\244b\242\3728\364)4\303i\257\263'\350)\207\375iu\263\236\373\337D\205\260\ft\273\032\335\313\256\300\022\210\355\217\255\261\375\3369\213\003\354n$\225\335\211`\203\352\320\266/r\322\307\331fz\214\250\026\224\214\023\227\335\031=/\2009\254\036\2009\324\216g\177\231\377\221O\245\215\224\220\350\342\217R\330]\277\220ht\353m\027\330>\260m\022\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_IO_Pin.5.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\335\007"
+	.string	"\"\01766Po\322\001 \233\256\025`h?\033\306/\213\251\001\tdO{st\306\"\037\3011\360\3772#\2200\003TUD\024\243\213\334\271 q^\303!\215l\262eJ\001\361Rw8\361\202\230\364T\\\362\001F\\\016\020\260#1\310)p\224\360H8\021\243\204\233\271\335\316\035l\356c\033\373\n\205\265\273\301\340\2230,,\222?\377\302\001\2146=\331\363\243.\304>\265Nd\367\371+\245)\301\030\304\354v\234f\366\345\231Llg\366\306\266\252\375\321S\262\317\214\013\354\212JJ\273s\301\t\326\237\247e\333?9JfM\347\210GEr\341`\221\331\2350\340\004\325\237~\240\372s\"\327\256\232\177\225S&\220\023(\244q\3254\354\256\025\024\372\270\335m#\330V\260\335\022\f"
+	.ascii	"2\003\302\260\2268\0343\203\031c\273k8\307\0046i\214\016L\020"
+	.ascii	"p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.6.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\b\001-\r"
+	.string	"\306\031ZB\020\221\223\016\370~\036\235G\020\264B\342\332w\255\320W\360\261\305\021\034t\217\313\032\007\220D\233\2630\313V\034u\025\024\025\3565\036\t"
+	.string	""
+	.string	"P\301\003\005J\360\324\255\225r\214\264\024\033!dK)S\nH"
+	.string	"C"
+	.string	"I"
+	.string	"(\256\262\331&\355Bp\367 \303\344\305\306\356b\006>\200\372\323\013\240\376\022\304\267k\342\346W\270\236FJ\351\204\313\360\324\0060\034\t"
+	.string	"\034H\017\314\260x\313Q\304\205\020+\217\3355\236p\030\356w\333\016l+\260o!\326CW\357\376\247hMt&\032\023\375MUC\246"
+	.string	"\214]\224\023\315\306<\027#|\227\223F\256\302O\206\306\304\356^#\366\365\315\276\320\376\312Y\266w$\017\260;:\321b\267[\340\004\326\237;\313\266\037\211\251\246\222\r <\271\312\347[\256*)%\223\232\223\034\362\025\231\265\033b\340\227D&\370\"\376|\017\365W\345IG\300\315\270\261\362\301S\346x!\352\220&\241^j@)\341\022#\2048\354\016\204\371\301\276n\216lE\007Y\007\375\301\311:\230G\003\241\320\321 `\021:\017B\260\017\315\203q\b8\223"
+	.string	"\242a\"Y\246a\227mw\237\353\346\310\031\303r!\255\r\207\0243\310\271\246\310\266\246=>\t\322L+\337q\233(\314\314\352\245\244f\273a\250\007\026"
+	.ascii	"\237\033\307\026\201=\266W\017M\263\n\2774\315\245)+\240\341"
+	.ascii	"\321\025^,\031X+\271\220\007\334\030l\312tP\226\274\232\036\031"
+	.ascii	"#Ae\016\332\215\244\004\224\252\006\232KA\001"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.7.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`4\001E\016"
+	.string	"\306\332^C\020\221\223\016\275\212Alq$lN\377[9t\303\204\243|\254\353+\\\256\374\217\006e\205\373\273\275\270]\2538\2069\037\301\250\212#~\001"
+	.string	"\240\b<\243\200\240\203\354,\304!\245XD\204\354\275\245L)K"
+	.string	"I"
+	.string	"L"
+	.string	"v\352u#\270\203\230\t\235p\354nf\340\003\342\341\273\200x\250\"\276\375in\276\351o\205dC\304e\370\373\r\022J\304m\270\276\0060\234\n"
+	.ascii	"\356\363"
+	.string	"\016\310\274\370\3519\342@\231\227\203\335u\2128\r7\274\355\007\266\025\330W\t\351\367\322\372\356O\217k\025S`\306nJk\265*\030\243\204\377rT\311W\030\306\254Vv\367*~\"y\n\253\211EbkJl\3157[\223\366[\356\262\2753y\200\335\022\013\030\273\335\002'\300\016\335a\266\375\023g\331\002\372R'\035>\331\262\352\323\237\376XH\250\020\353(K\270\013\021l\027\304\300o\201A\363IT\320\243\216\200\253\221\243\305\223-\335!c\364Am\022S9\244\230x\241\001J\035v\367I\ra\377\255\226\354\230\306b\372\202\351\b\323\020\006\032'\r\262\3218\331H'\344\002\247\023!\233\300\201 \222\201tF\262\r\001k\024B:\231\005M\353d\232\316\363\267Z\262\252\\P\364\362\360\200B&7\307td\033\323\233~\224\320\214\312\243\237\027\365\322\177\334\251\b5\352u:am7L|\n\003\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\276\305\022\2351\021\007X9\342\3254\312\030\t*s\320n$%"
+	.ascii	" \315\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.8.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`4\001%\016"
+	.string	"\346\032_C"
+	.string	"\261&\035\213\f\344\300\330\271\210\374\316\353)\320&\021C\341Ok,{U\353\"\373hJ\240:\267\216i=\302\021\r\006\020&"
+	.string	"\370\013"
+	.string	""
+	.string	"\005P\370\277\307@\326N\320z\220\321F\232\220\275\267\224)\005L"
+	.string	"J"
+	.string	"L"
+	.ascii	"\232}z\034\313\366\025\r']\215\335\275\n|@<|\027\020\017u\304"
+	.ascii	"\265?M\315\237\371sa\2011\3322\374\235\206\212i\264q\270\276"
+	.ascii	"\0066[\013\200-\364"
+	.string	"\f\340\260x\367$m\242\314\312\301\356:G\333\206\033\336\366\003\333\n\354\267\004\020\246\337K\353\271?;<<\334$h\261\233\222\312Y\024|Q\302\257\271\211\344)\for\216\342\335\310i\2544\235\313\356\216\330\035\022\273s\315\356\244\375\230\313h\347J\036`\267\004\343b\227[`\004\326\2419\313\266\177\342/\001\357d\002\"\224)\253>}\367\367\242b:\311q\223%|E\210\265+b\340\253\300\200\371$*\350M?\260\315\260\021\003\312\224\342\210A\022\241.\211\251\037RL\324\310\020\345\r\233\013\245\256\330\177\273\273\326\222\035\323VLW0\035a:\330'\375\341\301>\227H\006r\341\223E\270&| \204\\\037\231\310\345!`\214\002HvY\300\260\354\352p\240k\311\212\222A\321\252#\004\fNzn)\311\266\245\237\371QF\035P \r\275\250\225\336\343>E\250Q\253\316$\207v\333\304\247P\003\033"
+	.ascii	";\023p\325A\206\021\206\307V\350\241iV\341\227\2469M\2159f\027"
+	.ascii	"cY\002]G\367z\261$e\255\324.\204N\230\026\2025<\t\3219~\345\210"
+	.ascii	"W\323(c$\250\314A\273\221\224\2004\307\243\271\024\024"
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.9.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\325\f"
+	.string	"v\031YB\020s\223\016\333\037\323\2430?\200\205\330z>&\204\221\346\243\262\366\310\245'\213\007\300\325\276c\323\324\020\272\313#,\340\224\214\002&\001"
+	.string	""
+	.string	"\"\bCD)\317}\327G\2705"
+	.string	"\342!d\357-eJ\001H"
+	.string	"A"
+	.string	"G"
+	.string	")\256B\263_^G\202\273\n\007\224\026=v\327\312\334@<|/\020\017u\304\265?M\315?\371\203\260R\343\303\245\\_\004\030\016\305"
+	.string	"n{\tt\300\370\350\t\342<\231S\310\356:?\234\207\033\336\266\004\333\r\354s\0020\035\337\375\357\245\365\245S\323\247\002\260\334`P\332\355P\002\2626\340\f\023\266\357\267\234dr\026\236x\304\250L\354\352\232]\331~\332\027}\205\366\216s\002\273!\026\031\273\235\003/\240\016\335Q\266\375\361\237\324\214GO\034\365\372\321s\005\006%\310I&\371\013\214\332\365<\360]\224`\360K\034\372\233x\030\365\244+\340v\370\020u\262\24414@\"\324\234\370\364C\n\216\226\034\236\374aw[\252\212\375\267\032\262_z\n\330\225\026\321`\227\265\311FJ\256\214\202e\341\232@b\211d\033Ks\300\330\205\221\314\312\200a\231Uu\235k\310\032\\D:\351G\007\020\302\005Dj\256\n\262\255\352\220\216n/\025\301\375\022'}\314\206\023[\226, \257\366U!\023"
+	.ascii	")\023p\234\216\237\330\336\277\241K\232Z\032\b<\032B\213 ~\023"
+	.ascii	"\222k\270\255M\300\240aZ\210\3535tE&\036\334\215\244\032\214"
+	.ascii	"J\307\225VA\001"
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.10.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`$\001\005\016"
+	.string	"f\032^C"
+	.string	"\223\223\016\333\245\257!`}i\007|\204\263\334\242\006\202\324ao\nc\026\210 \274~\0206\221\373\240\333>\022\3011>\352\234\n7\002\252\252z\3257*\b\306\274\035\203"
+	.string	"\265\325c\3477\262\311\2262\245J"
+	.string	"J"
+	.string	"K"
+	.string	"\266\201\036\211\356\246\226\225\257\307\356^\237\027\210\257\340\t\304W:\342\333\241\346\346?\346\360\245\004\212\353T\016\033\270\330\340:\226+tp\323\245\020\320\211 \002\0350\376=I\335(\323z\260\273N\256\373pW\267\r\301\266\210}S\020\246\365\336\237\035"
+	.string	"47DR\273\036R@\026\247\2429\341\317\034\205\362\026\266x\3048\213\177'\227\261\312\320x\331\335\023\333\203b{\276\331\236\264\177\372\212\355^\312\007\354\226`d\354z\013\254\240\363\312^\307\266\257\3420\233\003\352\177\023\260x\256\322\317HU\254\n]nV\202\034e\n\177Q\322\331\0351\360]h\310|\023\027\364\250'\350v\3708\2052\24595H\"\324)1\025\004\013\216\231\034\243\374a{\242T\223}\270Z\262c\332\212\351\030\323U\225\016\031\226\036\001e\330e\242\221d\3004\tW\005,B\3115\242\231\\ \003\316,\220h\027\206,\323.\217\027:\\-yC\315I\243\376{H\210\232\226\004\335R\222mK\037\363w\340f\340\204T\004+=p\333\304\250\317\341\200B\224)\007H\030\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023\"v\017\021Z\002\3219~\345"
+	.ascii	"\210W\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.11.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`$\001\365\r"
+	.string	"&\232]C\360\224\223\016hg2B8x\264\375\376\222\350`c\005\202\326e\005C\rs\235\006\013\243\030\233\215\306\273\355#\021|\312\202\241e\241#'\213\303B\033\340\250L\225\226R\034\310@\374s\3477\262\311\2262\245J"
+	.string	"I"
+	.string	"K"
+	.ascii	"6\320;\321\275\224\302\345\033\262\273W\311\013\304W\360\004"
+	.ascii	"\342+5\361\355Ps\363/s\350\002\005\016\327\265\034>\200\341\301"
+	.ascii	"u/W\b\001\325"
+	.string	"\265\020\320\205 \202 5\376=G\235(\323\212\260\273N\256\013qW\267-\301\366\002\373\245i\b\323z\357\317\016\200\035=\030\374\330\005\2212\2627\025\216\025>\315O+\227aK\210\215\307\370\247\362\031\353L\016\025\333\263b{\276\331\236\264o:\214\355\036\313\007\354\222bn\354z\r\254\240\363\312^\307\266\377\3421\233\035P\375\257\002\026\317UZ\"\322\026\253B\030\224\313\221\237l\3414P:\273\"\007\376\f\016\231\257\"\203\376\364\004\035\016\021\023(S\232\243cTB\315\022SE\274\370\240\001\"\312\"\266\027J-\331\207\253$;\246\255\230\2161]U\001\031\2266\371d\330\225\242\235l\3004\n\327\005l\002\312e\242\245\\\037\003\3160\234h\227\206,\323.\217\007:\\%\271C\215I\243\376;\t\211\232\021\371\271\245#\333\226^\346\377\300\241n@\032\202\225\036\270mb\324\347x`\021\312\224\003d\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\330<\t\321\031\023q\200"
+	.ascii	"\225#^M\237\214\221\2402\007\355FR\002i^\272\322*("
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.12.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375 \373\245\006"
+	.string	"\002M.3Pm\222\016d\254\210\346h \216YE\265\362\334\340\302\253\251\r\304\313\003m\013\240\006\226\340]\262\327EUUWUT\356\006M\002p\351~\333Z#D\246\217bc.\217r\032\230\231\240\240\203\203\240\032\036\034\006j\334\205\340\027\221\201N\342=\350,\321\242\326\304\332\346\343\206\265\215o\224\215\363\215m\033\003(T\2220\222\231qb\222$\222H\307\337\277z\313\317\330\027\244!U#E\00329\036PfT\370\240R\351X\371\357G=\325V\0249\256\351\343q\361\teFg\320\201\251RT\201\251R\353\324*\263.\300UQFY\310\314\031\306\245\321[\377\202\037\341\357\004\t"
+	.ascii	"2\003\202a\243\302r\025\216k\330\220\2308\340\204\221j\345\n"
+	.ascii	"%\017"
+	.text
+	.section	.gnu.lto_IORead.13.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`j\001%\017"
+	.string	"V]gF\360\260(\035bF\\a\261h\376z\016\227\216\232\242n\265a\274\311\353\315\026*\313\t;~\272\242\007\373R\277+N\264@h\207\376\354\325\013l\340\031\022.\220q\327GW\213\2611\247\256`\313%\237\354-eJ\001U"
+	.string	"M"
+	.string	"U"
+	.string	"/\030\026\273\237\002'\340\036\375\235\300\366\310}\300\366h\333\013\032\234\214\372\367\322r\330\013\326L\307\356\327)\210\243\0165Q\376\205C\0132\264\225\326\206+d0\002\203\212"
+	.string	"-\025\f\345\344\020\361\232'Kk\225\371\031\331]\347JK\303\035o\333\201m\020\3736\002\3722\350\223\346\266\364\347\261?:\rcZc:c\372"
+	.string	"\n\324pu\200\315\320\235o[zj\013#\266\220\261}\377\3463\224\177F\360\202\342\333\\\226\362\317\007\\t\\3\273\033J\261C\217i\237\354\220\355L\3733\2479=\246\362\217\335\206\360\025$\234~V\263\350)F\">\n\023\t\334\356>\346\3217m\217W\022.\227\231\364\234\t\334\356J\304?qR\342\307x\333\343G/{\302d\320q\321\304R\331\243\037B\334\360\250U\266\250\257\371\207M\t\0177b\360\254\222\207\375\251Ra\366\341\356\256\003\036)-\n\361H\235\2514\252@*E\350(\220HJ:Q\311\324\205\030\260g2*u'\236W\352B_\352p\365e\001\263\035,\232\202\036\310\240\201CK\037\265Ae\261\r\325#)UA\205\2156U\220\236\345\"\365\252\2528X\034T\331cN\023$U3\261\203\323c\026\033"
+	.string	""
+	.ascii	"\033Zd\201\316-4\263\355\030\232>c\356\002\313\200P\256\320\004"
+	.ascii	"\366v\201\264V\264\265\025\260\247\304\262L\004p\020\251\211"
+	.ascii	"f\260\214k\324\006L@\240B\001\272C\235&\224\375\346\225=R\225"
+	.ascii	"Cs\251="
+	.text
+	.section	.gnu.lto_IOWrite.14.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\304\001\265\020"
+	.string	"\366\337oF\340\322&\035\227\020\344s\224`;\300S\267\247Y.O;&\3530\212\220\327W\213\017\005\322E\353\360\020\200\2438L\2342\241\306\025\336'<\302\030c\214OPoq\274\353\301\300&\017\322\242\200}b7\331R\246\024["
+	.string	"W"
+	.string	"_"
+	.ascii	")\202v\277\0056\331\256\371;\201xm\273\200x\315*\033\310?\235"
+	.ascii	"=P\322\006\240!\273\333\351\211\253\0365\250\251\3623<\236X\""
+	.ascii	"\256\2058\034a\331\300\003\273\313\2614\244\302\006.8\320\030"
+	.ascii	"a\255 \027C\b\213\373<sX7\231&\225\335u\342\260>\334\246\333"
+	.ascii	"^\261"
+	.string	"\255\300\316\223\337/bJo\207\375Q\3230\246U\323\251\351\0030\260\323\032\361RR\242o=,!m\016\315\206\n\333\367a|\026\363\037\027\360\021cs\261\313d\376c\215\204\253\305s\315\226\261\271k\311\331\326\264\0318P\375\233)\271\321\020\317P\202\247}\236\367\250\016\2439\311\256+\251\260\307\r\322*\227\240\246\257\274\320P\211\026P]3QDS)\366\343\2447\001q#F4S\372\314\022>\303\333vmR|\031)\n\376\216K\274v\322\317\236(: \265z`5\271\244&V\310\212\32441\352}N\342\363B\207\321\216\"\233<\262\277U\352\313>\334\335\265\272\354-}z\336\204Dyi\026\024\224\327\301\244Z0x\251\b\335\213\267\342\322\261\244`:\224\022\243*\264\244\272\013(T\252\343\276\232\303U\251\321U\324\227\023\006\270qD\356HO\0165\307V\265\037\\\b\302\266\273)~\320\313\312"
+	.ascii	"\235\335\265\020\257e\022N\220TE\020\223\231\3455Z6\275\214G"
+	.ascii	"\253\007\006\365\032# `\002!r\354\001r\250\261\020h\204\020~"
+	.ascii	"d\227U\233X\017Gho\260\326y\327\210\007\253\332\213\0208Hr\263"
+	.ascii	"\rJf<\033\333\302\002\033\"+\236\272\330qh\300\026\216(\033\304"
+	.ascii	"\020\215\323:\274\211\307\364\rX\253\200\021\244\323\005i\357"
+	.ascii	"J]\257U{"
+	.text
+	.section	.gnu.lto_IOHi.15.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"6XWC q\223\016\223\330\307\274\301\302E\002xv#BJH\013\262\216\252\024q\343\341X\306\307?T\217;\264\315\243\030\305\302G\205\"\"\333Z"
+	.string	" \001\005Z\300\024\004\035i"
+	.string	"x7\2021\202\264\275\211\224)\005C"
+	.string	"B"
+	.string	"E"
+	.string	"/\020\017\255\017\210\207\346l\033\367L{\025\022\026>\034\273\213i\210s\25749\037@W\341\025\207k\225"
+	.string	"\305\005\226"
+	.string	"\035\251\272V^N\034\365\304\320\22523\236\335u\212t\033nx\333\013l\037\260O\022\360\247_\253\364-\001\035d(x\331\325\020\003\2631\340\213\022~\312\277\217{N\032\037\366U<\005r\317\231\221\226\353\320\006\261\257\303\274l?\355\247\370\t\367S\3105\273%&\027\273\036\002o\254C{\001\r\316\"\213\372\357\232\0320\236\262\203\257xX\273\245\216\277\202\202\346\217\210\020\017\241>\365\024\221\001\346\303\311i\2241\n\302D\212\213:$\252z A\241\270\2242\207\355\221RM\354W\273\273\326\022;\246#L\007Z\226\006q\264\f\023m\241\t\331\306"
+	.string	"{\220}<0\320&\3028\006\254A\bm\230\004M\333\260\313\033\3353RR\245&j\177\336\002d\355n\307g\331B\004L\273+\212\207\251C\344\006\324\353Q\337\214\264\240\314P\331\3619\033"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 A\303`!R\263\272\"\256\345\247\304\233R\250="
+	.text
+	.section	.gnu.lto_IOLo.16.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\025\001\025\r"
+	.string	"6\330VC"
+	.string	"\2216\035\323d\032\361\307D^\0046{\345\241\272\241\2376\311\036WrO\350H\031\213E\365.\303\363\031E\300\r,N\353"
+	.string	"\306>\250\252\252\032\357\001\260E"
+	.string	")\367\177\347\230\033\016\026\261\273\233\224)\005C"
+	.string	"A"
+	.string	"C"
+	.string	"'\020\017\253\013\210\207\336l\032\367F\373\225S\205\357\306\356^\372\341\333)\315\315\357\350(\234\332p\245\020\224\260p\002\320q\224\305\362B\342\245\347\205N\224\231\361\330]'I\247\341\206\267\255\300\266\001\373\035\002\360\244_\251\364\253"
+	.string	"-`$x\331\315\020\003\263/ \013\021\276\312\277\220{N\031!\366O\334$r\317\031\316\305:\264El\3530-\333O\373&\216\262\2354r\315\256\311h\305\256w\300\233\352\320^Q\377]3\303\305Mnp\026\220jW\324\361QL\310\374\020\020\342!\324\233\236 0\300\224\240\220B\031\243\036F\250\264\250G\242\352KO\016%\245\224\026Q\342\260=.\365\304>\265\273k5\261c:\302t\031\226\366p2\354\002i\037\t\230\266\340r\200}\200\\\036\rtq\n8{\360\321\256\bY\246]\226\027\272GH9JO\324\376\270\nO\265\273\035\377\244}\006\214v\027\024\017\323\006I\r\250\337p.)1Vr|f\360\024X\033"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\274&\306"
+	.ascii	"\215\303\200\253\030\325\334\323f1f\005 \360h\bR\b,\\\003\225"
+	.ascii	"\020\032\250P\204\242\2413H\3200X\210\324\254\256\210k\371)\361"
+	.ascii	"\246\024j\017"
+	.text
+	.section	.gnu.lto_IOToggle.17.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\f\0025\022"
+	.string	"\346\341wH\340\322&\035\252i\244\314\0069\013\020`j\252\304h\363\250\265I\373\240\303R\375>)\300r(T\264S5q\212F\273\004Y\300\021\235\240\202N\031c\2141\206\2416\307#\276!\340p1\351\232>\032\215\020\262\211\334)\005`"
+	.string	"^"
+	.string	"f"
+	.ascii	"\207\311\\d\267\345j\261;6\260\002\357\323\343\tp\237\336\005"
+	.ascii	"p\237N\3317>\356\354g6V?I\273\013\252\316S\347\346\2462\345\317"
+	.ascii	"\234\003\021A|~\370\026\"b\330Fv\367\023k\244n\016Td\b\n\021"
+	.ascii	"U\333G\333\201\342\262\313\033\321F\312\316dw-5\210\036\356\356"
+	.ascii	"\266Ol\223\330\222% &N\332{\f\366\317\307n\235\322rJ\037@\002"
+	.ascii	"\027+\204\316\r=\032\227CmicL\"\023\217\375\366\375\025\247\275"
+	.ascii	"\334\307\007ZI,\236\027\373?\007\262?\303\334\307\005h|\3320"
+	.ascii	"\366\367)/\363g\217\357I=\026\343\315t\360f3%\034\273#\203O/"
+	.ascii	"\360>G\266K\373<\177\245\002*Y;QL\211?D\001\305\333]\026\356"
+	.ascii	"\363\322\325Jb\275`4\247\\h\002\210\2366\203\365\202y\332!0\362"
+	.ascii	"!;\232\3758\220O\017R\361vkJ|\026.+\276+\324\003]\226\330\260"
+	.ascii	"\304z\301hdMI\234\360AR\315\261\f7\365\262\213\364(\311\310a"
+	.ascii	"\204T#{\330\243Jj\216\375mw\327\332\262;\351*-'+[x\222F!\tO`"
+	.ascii	"\013*\345\302\t%\001\254p:Y\001QP- \211\001\207\026RP\240K\030"
+	.ascii	"\242\300o\244\371\266\332\262\t\215\2528\315\261I\304j\266\231"
+	.ascii	"\264\233)\255\204\264S\325\033[\325\206\360\027\003v\246\016"
+	.ascii	"\027<pf\200\273\210\353\324\244\017h5\233%\325\207`\214H\261"
+	.ascii	"\305pR#\310jtz\225\252E+\234) P\002Q\006\3176b\350\333c\374|"
+	.ascii	"\311L\332N\336\3408\231\372X1o%\303\240kC\242\370+\022\243\006"
+	.ascii	"tj\364\303x\225\315&\301\030)mP\231\361j\\k\273N4\205\322N\\"
+	.ascii	"1c\r\243\206\201#\003\216\204\003\204\0064T\360\341O\242\334"
+	.ascii	"\030\303+\362(\025\300K\212t\001\355]\252\353\265s\017"
+	.text
+	.section	.gnu.lto_IOInit.18.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"%\f"
+	.string	"\006\326QF\020\255(\035`\330&\264\242#s\023(\262\351M\355\037k\276vY<\327\317\347\215\342VHI']\377\210m\315\243h,\321\350\220\307\261\027"
+	.string	""
+	.string	"\201&\354\216\310\334\340\013N\024\020\207\235\\<B\"\331{\357\224\002="
+	.string	"="
+	.string	"="
+	.string	"\257\016\355\020\037W{\030\203\231\327\210\335\345f\202\207\247S\206~\205(s:\340\223\216@\240\301p!\236\350\006&\342\301_\227"
+	.string	"D\224\224\023\236\335\265\254\021\005\334\365\266Klw\354\243\004\035\352\206\006\266\277\261M\245-\322\t\357\032y\356\032"
+	.string	"\021\"\307S\b\337\"\231b\367@\206\217\355\265\203^\332\227\360\t\341Y\245c\354\246\024h\330\035A\354\261\275z\374\206\366\272]C\013\253\335\375\202W\277E{\255)\016\021\n\230\344l\"p\340\212M\22749\t\250>T\210\241d\t{<\311\251\262Oww=S\366]\277\366\326O\317\372\345\226!\363`2\333\r0\223m0\035(\344U\260\013\275|\365\363\244?\234\317\343D`\347\342\201 .\344\235\244p\037P\304q8\374\251t \307\362} \267\031M\367\230\346\211j\323\376~aD\202N{\3450\322\266\273$\276\205\030\221E\030"
+	.ascii	"2\003\302\260\311\302\326\021\210`{\301\3202\230\001\344\246"
+	.ascii	"\251+\240\341\321\025P,IX+\215\013C}\030\fsI\b\026\204\317\324"
+	.ascii	"(\270,M\215\026w\371\251\366\246hj\017"
+	.text
+	.section	.gnu.lto_IORelease.19.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\265\t"
+	.string	"\246\221B<\020%)\035"
+	.string	"\004\272[7&\032\001\363\005\257>&\212\231t\236j\364@ R,\232\335\372+\366\326A\226>/\024\266\004"
+	.string	"@A\300n\t\240\033\021"
+	.string	"\201\216\216.\353\311\336{\247\0240"
+	.string	"1"
+	.string	"1"
+	.string	"\273[\245\311\277O\031?_"
+	.string	"\324\370\f\271\234\013-\0346\004\340j\206d4\226\307<z\200\254\030\003H\273\353\330\001\202\334\364\266\033l'\330\246\0057\273\037\265"
+	.string	"\253CsTB\266\037\355\277\034\346;,\365\202\335V\n\316n\250`\004\320\251\303\033l\247\240\213\266S\177v\317\303\327^V\263A\363\023\257\335=\312\251\237\261\235\322\026\217\213\217*\326$\311\312\314L:\265E)Rr\022\233\261\""
+	.string	";\\E\351\262?ww-[\366a\177\244\242\221\035\207\035\027]\032u\\=y&\013\316\203\250\022\334CD-y\247::p7a\362*E\327y5\024\252NR\311\325\224.\324fW<\206\002\355.\203/\203q1\020\020"
+	.ascii	"2\003\3020\301\302N\021\210\030;\002\204V\200\300\243!\214\b"
+	.ascii	"\2623!\025\314\273\004\320\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_IOGetOwner.20.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\375\n"
+	.string	"f\324KB m\225\016\227\323\200#5\016Pp`\303h\237\330#\262\311j|\355'\262#L\b>Hm\033\030\353i\177P\f2\002\330&@\b\275\235\t\200`3\262\217\024M\343\372\355s\213J4\331[\356\224\0028"
+	.string	"8"
+	.string	":"
+	.string	"\225k`\227\361\024\354R%\334{T\350\371\t\036GV/\320'\272\306\217\f\013V\030\237'NT$0\374t\030\372>\020V\\v\327\020\3645\270\345m\207\330\356\260_\t\" v\031\274P\254\b\371\301\202\355\333\346\330\023\333\020\3327\235\003\347s\363\214]\222\212\265;=\314\221]zf\266}\r\337\300\261\027\347\204\357\202B\b\005\251\022\273S\013\232\247\bd\273\037\020\037\205\300@\266\273\257p\351\037P)r\2310u\340K!\\@\265\324\033\f\252\203\b\256\016\255\017<aO\017\324\222\375\270Jr\374\374\241\241/)\254\021\001\334\006\215\261p\233\246\3512\005\266\256D\013\260\221"
+	.string	"\3200\235F\263l\230\023\220\351\264\001\034\327i\223\331y\\%\371\245Q\n\215\372\323-\036\214<@\337\303\256!\365\245\243\236\250%\007\021"
+	.ascii	"A\204n\211\030U\004\370\205\315i\265\3413&A\303\243+\234X25+"
+	.ascii	"\271\220\003\215\341\321\224\035\320\004 %\240T5\320\\\n\n"
+	.text
+	.section	.gnu.lto_IOIsFreeOrPreinit.21.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"\265\f"
+	.string	"\026\031YB"
+	.string	"\223\223\016\273\255z\222\307a\264\025h\362\243\025\302\267\222u\374\224\257\337h\230>\222\205\036\256J\027\303\236\326\017:\243\362\347&j\004TU\357\257\376\031,@#\177\257\032\375oC(\204\354\275\245L)H"
+	.string	"C"
+	.string	"G"
+	.ascii	"\325\003\304C\333F\240\200\343\316\273\020+\027a\203{\251\331"
+	.ascii	"\355.\005\361\316\237f\307\267"
+	.string	"\360\007C&\027\031\027\240\320\365%0q\341\005\bh{V\013\232\022/=U@\237LJdw\235\031@\032nx\333\rl\033\260o\022\351x\322\017\235\326\364\253w`\251\301\361\200\306\356\312\311\307\326\2001$l\337W\361\022\312;S2v\234\330]\013\305\266\316\261-\333\231\366[\216\202sR\312\001\354\212Zb\354v\007\\\240:tw\001\3610\224^\237\342\004r\320l201[\236\236\216J\316\316\302\244\332\375,\360_N6\376\210C\237B<\214\nC&\036$O\236\324\003\313\212\031uJ\204\272\341\203\311e\346\223=\354nK\035\331\177\273\273V\221\375\322\324\013\031\226\036\t\311\260k\243\221T\300\264\b\227\004\fB\3115\242m\256\220\001\316&\220h\327I\226i\227\325y\256\"\177\304\341\207F}\351\0160\314\340`\344aN\251\212mU\213xts\352UUop!\006\251O\007\367\222\030\022"
+	.ascii	"*\013\370e\230\002B\314\274Z\316`\035\336Q\256\354\201\256\243"
+	.ascii	"{\271XB7+\305\005\237\271vAm\362\272*Y\314:T\251S\324\252="
+	.text
+	.section	.gnu.lto_IOInitGlobal.25.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"M\n"
+	.string	"\306\322D<0\305*\035"
+	.string	"\366\251s\317\245\324\022\226\032\fl\226\031\313\241-*\263]\244\001j\262\303Gck\031\206m(\200\023\030\372\310\210Hb\344\200w|S\316\224\227C\021Ad\357\275S\n2"
+	.string	"3"
+	.string	"2"
+	.string	">E\203:B\354\365\201\240\323i\331\335\001pbZ\342\b\024\305\271z\3746H\227\017\257"
+	.string	"3\371@\322#E\263\273\216\037xqg\267\275\331\306\330\237\001\324O\375\303\273\352\242\201,4\326+C\300n\2109u\202vjyAv:O\220\235\276b\317\016\360\360\264o\235(D\006\354n\225\030\236\247\364N\247\214^rt\311.Y)\216\220\023\211\b\233\273\273\363R\232\354P\024\343\356\202,K\366U\367\351\001\254$\242\265[Q\200\300\272\350\210\306U\267\277\272\207\037\272\362\237\216\353Lo2\334V=\035\007b\353\032\352\303\306\340P7\235\247f\f\314u8]\375p\\W+a\350\262\204\272F\022s\205\244\310T\232\274"
+	.string	"@\376\227\214v\304\203\374\001\025"
+	.string	"2\003\3769\006\324\201\030QX\037C\354&8\270\222i/\314b`\256\\\356\351F\202\320'\270U^\204"
+	.ascii	"r\203[e\247e?G\2119\274s\315'"
+	.text
+	.section	.gnu.lto_IOGetByTag.26.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375 \357\205\006"
+	.string	"\242\314-3Pm\222\016$\0012f,\226"
+	.string	"\272\311@H\326F\017\033\340s\213\034\354\366bS\026K\205\367d\377\314\3144w\272H+b\326\r\251\361\354h\033\233\310\024\r\233\017\316\321TT\363\270N\004\345\030\332\003\265qh\034\347i\232\314\025D\307\265OU\271\206y\331kbH\361\017\304p\343\013\220\250\361\035\265\305\262\244J\312\004I\346E\313J\242H'\036\277\365\230\037\331'(X\035I\214\231\031\037&\231\017a\203K\245\377\2024\304\372\312\274\016QKD*FT2_\373\225`\252t\351\300T\t9z\225]W \004*\013X\310\314\231EH\324\261\177\301\177\360c\004\b"
+	.ascii	"2\003\202a\243\302v\025\216k\270\005\013\207\334\020\346^%\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`C\001\265\005"
+	.string	"\322G\036)\200k\206\003&2K\200l0\216\3304(G\362`\006f"
+	.string	"r\205\304\266ms\035\326MB\"\201\304\266m\326M\2046\3312\275,\031\303(E!\216G\253d\333\366\033e\366b\333\030\202\230\215\272\334IsN\3202W9\243\214MVHNDF@><6|\027\034\023\032\017\030\013\274\003\335"
+	.string	"\356k\333Z\\iS\331\323f~\332[P'Ns\316\211-\245\266\222&\032"
+	.ascii	"\240\b\256]K0D \032\213\273j|\321\003 \034|\003|\003|\003|\003"
+	.ascii	"|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003"
+	.ascii	"|\003\374h\3339\006"
+	.text
+	.section	.gnu.lto_.refs.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9e5597f8c0f7eed2,"e",@progbits
+	.string	"(\265/\375`\337\023\245Y"
+	.ascii	"j\223\204 S0RBJ\007\016\217\233rq\025\372\330\302\340\365\240"
+	.ascii	"t\207CKu0\230Oo\f|\207\003\357\323\363~\372\027\2079\037m\341"
+	.ascii	"\230\201\363/\363\377\356R\307\300\270\351\230\361\200\317\036"
+	.ascii	"\261\256\t\242a&Y)\200\220\236?\036y\263\353%=(H\311\223\266"
+	.ascii	"e\n\236\001\365\001\020\002pO\"XW\375\013\354\344\252\227\324"
+	.ascii	"\006\330\334!\005\355\252_\201\375\271\0076\266\251G\004\310"
+	.ascii	"U\177f\373Y\tk\361\032\360\271$\355\261\356V\347\346\313\030"
+	.ascii	"\251\255\253\262\332\0162\314\226\333U_\002{\346\022\023\323"
+	.ascii	"\204\3178\215\315x\312h?\223q\331\325\266\333\254\273\317Z-\037"
+	.ascii	"o1\341\260\033gN;\177\364eu\267\177\340\3679\243\361\030\207"
+	.ascii	"\211\300\321=\025E\223\267T\205o\257\273=\261s\342\304\t\366"
+	.ascii	"\r\314,:\243^\002\226\233C\2549?\354}"
+	.string	"X\356b/\236\3620\330y\ts]\306\331\366\264\273\305\221\241\353\342c\354\252\347a\377\177\035\207J\377\\\310\236yV\034\346Y\177Y\022\034bU\3458\304\372\226C\254,\003\260\252\377\235\341\374\337h\233\322\0057\372\276\376\027\206\377w\377\263\\\346\277.\240\201%\377\233\375\230\220\300s\376[\364\277\211\320A\374\267\310dM\347\277\035hP\002\203\337\374\327\202\237E\b!\001\023\267\371/\005\"$8\315\177\177\204\376\203\360\231\377\372\374\307\362)\n\374\337\"\374\357\001\300\377\022\3603\b?\303\370\371\305\317@?c\360\363\005?W\3603\005?G\360\363\317\317\017\374\334\363\363\211\237\023\370\271\304\317$~6\340g\021?\027\360\363\316\317\001\374\234\363s\315\377/\377\301\376\253\375\347\3623\360\377\225\377O~\346\377\177\377\373\376\213\371\037\346\377\336\1770\377\275\374_\373\257\367\277\313\377\274\377l\377\027\370\037\345\277"
+	.string	"\177\177\177\177\277z\344\277\303\337\346,(<[)\364\331J\2319\355\2242\273\333h\316s\254\311\344\347t*\372\234J\243:\355lfO\2335\260Ni\364\t'\215\346<\247\315\350\3239\025\325\241\301\n\b\037\0161^[\354\303\323\331MLQMh\216\334\263\225\266]7\217\331hh\211\356()\324\256\311\203\323\220\344\232\220\314\232R\002\230\220\250\244\355\224{\032\221v\033A\222\321L\0200[\271\016\302r\314\252\250^\262\321]"
+	.ascii	"S7\223[\256\273\231\335-\204F\265\335=r\236YLL\335O;L\035\305"
+	.ascii	"T\263\321}\307\256\244E\237S*\251\217Z\3304\253o\264L\316j\273"
+	.ascii	")(;ev\365Rws\0276+\232#\357^$u\207\224\037Xtlk\003\346\006\227"
+	.ascii	"\334Uo_\376\273\314\337\34615\316\333jw\223\371\200\033\346\003"
+	.ascii	"\202mW\315\257U=\313\261\347\351\265p\337\357T\034\340vlEi[\232"
+	.ascii	"4)2\035-\327-\301Q\205\031\201\323\356`\252\332\003S\023\267"
+	.ascii	"d6vU.;\30163!c_\234\004\277\336\2224\275\360\330\204\241C:\242"
+	.ascii	"g\302\311\306D\253K\2360\211\r@\244W\345\322:k\2320\211\370`"
+	.ascii	"c\357X\216\347D =\201\234\220\341\375\016\374\360\035\3271\026"
+	.ascii	"\226{\232 \211\331\026\326\302Y\030\217\247|\307?\234\2530\335"
+	.ascii	"w\332ngw\337q\033Ca\271\261\026oL\360\272[\276\343(\034w\323"
+	.ascii	"l\033:A\231\322\033\316\fP;|\315\250l\307Vx:\202\257\334\201"
+	.ascii	"\237\003\231^\255e3\006\311\030\276+\366<b\345?\036\261\236\201"
+	.ascii	"\260\274\3034\314Q\001\242\365\371Pb5\2320\323,\251\253N\331"
+	.ascii	"\207\277\355nn\"R#J\017\226\341X\nOM\360\224\263\033\277=\330"
+	.ascii	"l\273\2758\370\221}]\365\034e\317&V\340\337\037\233X\317Ll\016"
+	.ascii	"\207X/\003\260\362\223\231W\275\232\004\006\026\344\nt\211\017"
+	.ascii	"[\366\272\272\356\027\210\226\226\005q\303\013Fa\031\213z\375"
+	.ascii	"~1\024\005\230H\227h\341\342\2622\246NA\363\303\232C\202\344"
+	.ascii	"nY\301r\322;Rc\245\346V\245\365\273%\323\027\244\371u\325\253"
+	.ascii	"\204\375f\346x\304\365Uo\022\206\002\264\343\321\325\207%H\365"
+	.ascii	"%\013\032\034\017<h\231)\343\253\342\306\246\203\016\267\b[\327"
+	.ascii	"\004\347\352\212\006\2513\"Dn\021~j`\335\225\223\336\221UJSu"
+	.ascii	"\345\360[\204\006\215\312\252\006\231\020!w\b\013\346\347\244"
+	.ascii	"\267\307Pv\360\023\303\372\035\362\273\250V\323\310U\357\025"
+	.ascii	"\016\237\333\020!\267k\222\234\330\244\272\254\254\356\r@\315"
+	.ascii	"?\342\234\364\366\204ZrP\242\013\362{\303\355\231\24491&`\222"
+	.ascii	"\252\252k\303\355\016\003C\202w\241\336\326\236\374\370\265!"
+	.ascii	"\f\310\366\204\256\307\325\324\024\016\30208% PR\251\024gy\352"
+	.ascii	"\311p\325\003qHI\335' fS0:F\2065\276\250\250*O\032\244\2660\036"
+	.ascii	"v=z\334'\240\234F\232\343\313\262!3\242\264\245\266c\307}\222"
+	.ascii	"ih\367\023\005TX\356[\234\337\020\036\277Oo\343:\2761o^NNWG\330"
+	.ascii	"\027\034\260i\310\224\316\361\253#\016\207\313\225\270\246\222"
+	.ascii	"\246\246\013\005\321\322\356,\241\330\334\031^?=\361\004\271"
+	.ascii	"\310\340%)\206_(\317\321x\251E\225\024a\177k\\\0337\356\022\313"
+	.ascii	"\354f\266\035\303\372E\346\244\267\327OQ<"
+	.string	"7G\254\370`\272\317\337\245\253T\323\255\325\335\"\202ra\322\222\\\365&1a\211\321\342\"\364\202\244J\f\027\007\377\020|\303qfu\325{a?\231\033I\177SW\375\315\301\376\376k7\241\335\355\024l\033\212T\263\376|\0162\363\3746\f\344\022\335\b\330uWY\351\261E\320\232P'\321?\322\315\324\351\266\241\317\351\024\363\tF%\252\323v\r\003\364\264\252\237\355TT\225\366\355\266\271\235S\321+$\2252\226I\244\220\204!\243\221\272<B&\211\202-\030\021\025\221\307\245\3211\205\021\212E\233\243\265hH\210\005\026FC#$\215\\\324,\217\310\243Q\tCI4\032\225\031\034\r\211C\235\245\321\005q8c<\0322\032\311,\217\310\241QQQR\2108d\223/\210C\365\bD\034\252\306\345Q\351\001q(\2141d\f\"\016W#\362\370\242F\007y\324\241\021c\210<\332\200\340\2408\024\372"
+	.string	"\203\"q("
+	.ascii	"\215\030\303\2452\t\343\006y\204Q$\016\205'B\261Cd\f*\022\207"
+	.ascii	"\353\211\216J#\322X\304\036\202\024\f\244PACx\025+\032X\321\300"
+	.ascii	"z\025+||V\244\360a\237\302\007\270,\026\r\t%\217B\243d\222E1"
+	.ascii	"\270,\022\207\352\3622P\030\3158\341X\034\261,\252\020\3220\306"
+	.ascii	"@\036\203GE\"cP\362(L\036g\024\251\313b\n\037\344q\006\320X$"
+	.ascii	"\032\211\224)$\217\214J\034\245\021\271B2H\202\261\205q\006\013"
+	.ascii	"BE\342\020\206\213\232\313@\361Bh\310A\317\322X\244\034Z\222"
+	.ascii	"xr\206Q\331\263L&\225=4AA,\200A-\206\300\240\026D\340\262\350"
+	.ascii	"\300\003K\3441\005\366>>\027\220\350`\003\027,\021\212\344\261"
+	.ascii	"\347HiT\341\250\214\321\203<\016\235\320C\244<\352A1@P\020\007"
+	.ascii	",\324\267\300\244,\277<\270\267\245\027\272&W\275k\277P\326\356"
+	.ascii	"\233\n\327\215\324@\213d\327\317(\036\033\261\275=?\267\3377"
+	.ascii	"\325I:m\236\244\260/HW\275N~\237\3742\302\272*Q\274\274\330\333"
+	.ascii	"\303o\033T\016,F\266\330\254\340\246\344\361\300^\r\302\376\367"
+	.ascii	"lz\317n\332\f4"
+	.string	"\203!Px\r}Z"
+	.string	"(Ojw\325\337\2643\230\032\351"
+	.string	"+\024\225%E\256\352\343\363\213v"
+	.string	"V\350S\3338\314\305\327\365d\252\254\354\232m\341\312\002Nm\335@v\231\374\232\261\337\215\016\250\020+\316\265.OH\025\0171\261;\306O4+'\275\275\265\006\334\222\262\253\3361*F\260\312\002\201\236\250\341\250\"\214\"\021\021\021\021\221$I\322\001a\005\204 \007!\323:\022\200%!R\034\205d\204&hRV\245\036\303\001\206\020o\244\343(Hp+\2300-_N\365\005~\366\277\272\314\336b\370\213\327\201$\001\357\302d\330 '\335U[\317\032\310"
+	.ascii	"\005\2537\345\330\327\275(\001\201\017\273\345\210n\351eAI1O"
+	.ascii	" \333\367\024%\036\233\272b\372\322H\033\376b\361\214\217\224"
+	.ascii	"A\265q9\311\020\021\021\252Y\211\301T|g\250d\":\276\235AjL\026"
+	.ascii	"\244.TP3U\020\324\236\316\001{\3166\267\225\341I\213\204\205"
+	.ascii	"\326x\364\257\311\037zb,\347\246\323/\024\250\031\200 \244\251"
+	.ascii	"\364\330\212]\344\221`\224\206s\251\250\30288\364\352\002\030"
+	.ascii	"j\357\240m2\216,eg\216\327,\002!\3104\277 r\020\340j\340E^\255"
+	.ascii	"x\311\336h\234\024*\350\256\321\037\034\317\334.\266\371\035"
+	.ascii	"\216\342X\t\253\353\275\002\316L\302N\365-\330\272\332eIP\272"
+	.ascii	"eX\2663R\222\034s\\\337\30367\340\270N\224\364\335\216\204\275"
+	.ascii	"\304k?\203\017\300\210\271[S\024\230\257\toa\373\224x\365V\232"
+	.ascii	"p\263\241u\300`\317\364\277\263\322<>\257\255\232\325lT\024\305"
+	.ascii	"5@U\017\035\263\205\366A=\355\276_&d:y\300w\320\254C+\247D\336"
+	.ascii	"e\240P\310O\221\004\222\232\337\025\024\224H\256\231R\223\324"
+	.ascii	"\342\016\021\351Xjk\200\265Q\036\233\002'"
+	.string	"YN^W\300\315@\240\004$\2254Is\365\323\250\374\263\235\231\326\177\3025\246\221\232K\\\363\305r/\246\230\030\273O\254>\344\355\223\236)\233\241\325`\205.\317\n \317\261\036x\225\035\274\361O\311\275\225o\004\003\037\"\017u\246\316IE\277\276C\013\301 G\210\022\311\351\310{\261\373W\221Hh5#s\263\005#fO\271{\033M\030D\374\006\205\342N\r(\224\201\231\246\0317~\024\254\357Q\2362[\222\004\344/\177\207\224\001\303\312\214\027F\242\271\\\247Q\226\313\321\215\267\365v\220\020_\002\341L`\227\021\241\376BoL\344{\366\277\273\300{\235\237\367\"\006\245\013\310\262\233p\226\333\244P`W\337k$\030\200\374\035\227{_-}\372\034\213\362\034\301\r\024Sg\016\335\b,\276;1kw;\034\321=x4\340\307\265\337\316{g36\307\351\332\234\255\201E\270\324'\307G)/\322"
+	.string	"\275I/\t\267"
+	.string	"\377\322\266"
+	.ascii	"\317L}\270\204\243\355\356u\305L F\301c\t\037{\225\236\221\025"
+	.ascii	"p\260\035\367S>\200\376\204\377P\272\237?8\237\025\013\022\031"
+	.ascii	"}\3208a9&\373X$\376\260\021{\305\2764.\021\007\266\241\017\021"
+	.ascii	"l\032\242\031,\373_:[2\264\370\n\363\232\306\234\276\214\375"
+	.ascii	"\246\007\350\210\001\267\3377\305?\330$q\324\277\343\346\232"
+	.ascii	"~\273f\227\337\241\277T+84?X\274\n"
+	.text
+	.section	.gnu.lto_.symtab.9e5597f8c0f7eed2,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"IOIsFreeOrPreinit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9e5597f8c0f7eed2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
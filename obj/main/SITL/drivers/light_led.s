@@ -0,0 +1,491 @@
+	.file	"light_led.c"
+	.section	.gnu.lto_.profile.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375 |\375\002"
+	.string	"\244\004p"
+	.string	"\t"
+	.string	"\366\254\342\276\002\b\002"
+	.string	"\002\001\001\251\245\204\311\n\f\002"
+	.string	"\002\002\002"
+	.string	"\002\002\003\002\004\352\263\360\321\b\003\240\342\234\212\n\004\275\375\215\235\005\005\237\326\324\323\t\004\002"
+	.string	"\002"
+	.string	"\006\212\302\222\270\005\007\b\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"I\211i*|\241\356\332\225\226\273\376\216\247\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375 O\315\001"
+	.string	"D\002C"
+	.string	"\004"
+	.string	"\001\001\001\001\001\002\005\002"
+	.string	"\003\001\001"
+	.string	""
+	.string	"\004\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\005\002"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"4\205\230*5)\013`\007:l\331\360\262\034\f\332"
+	.text
+	.section	.gnu.lto_.inline.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"]\006"
+	.string	"rJ!)\200)I\007s)<\\\366`\346\2224e\n\252\253"
+	.string	"\200\213`Qk"
+	.string	"\273\213\313\2202$\362_h\355j\244\265\275\245L\001\237\236\231Z^\032\221^0pc\316\222\374\250d\003Q!\204(\250\t\264\371(\305\335\t\234\fPG\225wT9\250\t;=L\317\365\f0~z\372d\352\3556\330\224\303]\004\375\243*\036 $\0306A\235\224s\"t\201A!\2021\377{\235\3057\265>\235\272\273Co\323 \034"
+	.ascii	"G\233\001\207  \220\226\032\270n\213cR\234P\241\255\226@g\013"
+	.ascii	"6\210\341\2640\002wfh\201%$\205;\254\226\2351na\356\3439\256"
+	.ascii	"+\254\fa\275Tju\254O\231f\351\327eU\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375 \274\005\003"
+	.string	"2\205\016\026\300%\035\377\277\013\370\375\177\377\365\377\277\006\255\031\327\366\336[&\031\344\023\320\263^\360-\243Kq\277t\036\366\303\372\\\365`4r\341\222W\"\234\310$\265\234\377\336<\211D\016"
+	.string	"0\013\300sI\341"
+	.ascii	"A\367\336\241\007XEN\370@i\200v\203\022\372y\001L\242!\223\274"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\231\004\004\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375 ou\002"
+	.string	"D\003c"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\t"
+	.string	"\001"
+	.string	""
+	.string	"\001\b   "
+	.string	"\001\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\n\002\013"
+	.string	"\001\002\f"
+	.string	"\004\001\274\001\005\002\274\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"9\203p\001n\350\n8HQ\267\374\264\244r\030\3058\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.c9b09c8744a13a4c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statusLedConfig_Registry.11.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375 \232m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\237\210\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\304\007us\250\327\006uq"
+	.string	"\005\001\006'\001\004\371\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/light_led.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_statusLedConfig.14.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\315\n"
+	.string	"\226\223IB\020\3478\035 \264\307w\302&"
+	.string	"\317@x\306\355m\017\373\315W\3453\354V;\021"
+	.string	"y\312\345\221\177\304\336\323\302:\274\202\335\345\265\036\031"
+	.string	"\240\0210SBP}\003\261\f\2104`c\372\330D\310N)4"
+	.string	"6"
+	.string	"6"
+	.string	"!\213<\367\234~\341\273\347\271\302w\317\247}\200a\344\200\200\253\306\266\273 \227\362\363\365\364\037s\203\027\214\365\332\241\330]\327\027\314\344\346n\373\301\366\204\375S\367:\032z\"K\320\2527;eU\016\305~\267\273k\016\265?\373k\207#q\325@\265\335\222\333\202-\340\tX\371\330~\265/;\314\371\331\352\t\273\250\201"
+	.string	"\273i\366\313\317\3468\200\322\3457\317\301\251\367\200\317v\232\333\016\275fc\321\362r\325g\033\3424UClw%l\217\317|xv7\342\236/\003\022\002\212\251\334\363W_&1#5V\224\302\213Re\216\314\022\301$Q)Da\230'\223\210\002K2\354\020\311\022\230\022G\032 \211,A\221\203\307\215\220\004\315q$\301O\272\357\226C\335\261\254\002\004-N$\023"
+	.ascii	"2\241\237/0<xd\027\304\241\273^q\002\306\355J\325j09\\\t\fq\225"
+	.ascii	"\032\374:\017\310\204f0\357\022@\263\232\022\356\360\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_ledInit.15.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375`\360\002\205\026"
+	.string	"\306\351\220H\300XM:$\210&\206Y\005\356\213\223\366\\Y\\\215\246\276y\203\377\020\005\"W\312'\344\362\240\261\326dg\016\301.Q\221\264\321q\262\324QU\b\274(LC\207\350Dh\267hCx\216\n,\276'\204\220\275\245L2|"
+	.string	"r"
+	.string	"|"
+	.ascii	"\261\327\204N\240;\351\007\220n\033\215\326|\237j\373K\367\371"
+	.ascii	"\275@\367\2511\325(\267-\365o\343\221\216+\335\035\262\013\345"
+	.ascii	"K\333\325\333\330?\257\233\2227\246\367nn<\201\212!\343L\374"
+	.ascii	"']\230\220\240\311\006\2134#ZO\006\212w'>\001\314N\\J\231)NV"
+	.ascii	"\004\314\212\344\313\b\030c\313L\266|\246\313\320\244\2143\024"
+	.ascii	"_\357\246\273"
+	.string	"u\307Y\211+xU]\241\252\020T\031\fs\237F*\372\341\270\327\327-s\240oR\005}/>\365B\f\312h\242Q\033\332(U\233\270\254\244\372ww+'\251\246^\373\003\374v\005\345\352\307\253\336\256v\273:\345\252\344U\336\325\335\325\277tB\226\300$\351\036\021\225\245\225\314\\\214\337\256z\233\236\t\307s\304~\323\247O$\361\341n\"\246t\367\314\247>\370>c\344[T\365\253\372\032\267\021\222U-\\\330\217\032c\304\242v\354\361\241\374=\335\344\216o\304\202h\243\024\344\311\237\221\002w\004%9\bN\252Iw\333\350\235\236\303\240\031rr\240\270,\263\252\316\316~\224\034#cQ\227\2315\320\242\216\240\024\352\210\211\032r\325-\273nNd\213\305\347>V\n\226\272e6\252<\357\301\372<\260\264|\246/\300\201\243\221\343\356\026\231\225X\277\343<z\364/\364\247\265\037[\335\003\254\363\2608"
+	.string	"\265\"\250V\023^A0\035\330k\200\356\324\250V>\033`\035xX>\341\313\265\002\301r\251B \226\316O\270\343z\2055\b\264\345a\345\na\255\226+l\261\3659\351\306\277\246'%CL\364\261\222zF\272\024\263\223\2359\310H4\007\371\265\313\356n\217\301ANq\b\232\224\355\302#\301I592\235|\\\251\262b\213':\246\201\235\371\307\252\022(\024\261\250Ep>\"\037\277G\221\034\314z<_\241\013< `\002\031:\254\007\342\200\377c\360\355q2\310.XM\251o\253\004\312\351\354\336\032\305:\327\034\267\364eM\345\353\203]\244\017\035q\325\306woi\220\240K\206\313\005\3041\261\326U\253\324\213\346\024\330\273\tc@p}\213\242u\373lq5\254Y\340\354\214\270\023\247#VJpl\267Hf\305\350\355g\235\345\r\001]\3305"
+	.ascii	"\025\341\335Y6\326\254\350\367^f\b\320\266AK\324\352!FI\007\331"
+	.ascii	"T\343\373Z\247}O"
+	.text
+	.section	.gnu.lto_ledToggle.16.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\225\b"
+	.string	"v\021>6P\217\032\003 [\374J\206\n\200\322\200w\361\001\324\"AeNF\2613\202\220\253\351\200\365\006SH>6\231\250\323\270M0\242\312\004kyNj\004m\271\245L),"
+	.string	"-"
+	.string	"-"
+	.string	"\022s@fY\257\205\361\n\344f\2454Pd\376\317\370a\317\320\253]b\355;\225\f\001\022\376\027~'\0167\272mA\333\203\266,\001\177#\252\265\312\216\020\3262ky\031\210\3717^3w\311V\310\246\255a\353\021\223xVU\245\332\337\221J\371o\320\216\306\222c\201\314\001\334\004\364WNF,\265\355\205Y\"\315\177\204\332\304'\024u\312\262\026$\350\317\262&e\226\216\013+\"-\023|\265\253\022\214\036\255\261?\237-\024\353\351|\266\020\303\350\301\001\024\232\242n\253"
+	.string	"u\237\031\001j\200\230\236N4;\004\345$\266n\2168\256\233\233\325\215=\242\252\340\3422E\214j\320\261\r\b"
+	.ascii	"3\241\303/F\361\031L\300\250KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_ledSet.17.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375`\250\001m\020"
+	.string	"f\341pE"
+	.string	"\261&\035\177\352\234X\330\272\345\273\027\"<=\f!1\017\376\t\356\241k\332&\324j\342`-5k\3007@b\024\035i\356h\fN\377_\332u2h\302\022\303l\212\246u\354\351\215\272\021ido)S\nY"
+	.string	"Y"
+	.string	"^"
+	.string	"\217~\332\267\271\t\324o\334\302\332.\207\020:\273\033b\221\354q\364\001\330#|"
+	.string	"\354\321([\306=\020\373\027\tV\316\317\356n\372\341\250G\250\211\362A%Z\313\225z\2149\f\271b\256"
+	.string	"\\.p\264\273\177=_\\\253LP\311\356:[\256\f7v\333\fl'\260S\024pw\327Jc\337\373E\307\271=~\363\207\236\326b:{\032\224i\354\351\3704|Za:\237\376\207h\306\006\r\035J\350\013oa\276\033\333\023wD\034\347\267\377\227;l\343P\030\245\274\205Q0\303c\363\263\353\201<\232\304#$\250{-\004\356\243c\303\263\353\205x$\0131SmG\225\037\214\230\202\364\230\206\260vV\371%\364\320\250\220\306swS\372\026L\244\021\203\317+\206K\3260\310\241z\350q\260X\250^\241\236%\263\312\317\251\252g\345P=\347'L~\215'\234\362\255\023\366\230j"
+	.string	"\206\214*?\207\364\300\257\025f\\\\\270\261\312\317\366R\251\036\354\007$n\245\343XTJ\231\212)I\034\212\332D\204\304\2414XypRB\331N\035\307R\352H\233J\311A\312f\322\2356\221\0026I\340\272m\305d\352\266\016o\017Wi\234\020\244\002F\254\320\250\232\276,\260\321\243\322\225?R\323Lm\023.\337\362\310\202\246 \\\305I\266\273\b|\024OQ\362k\036\035!%\005{\034"
+	.ascii	"@\205\006D\304\nh\214\177\004\241\262Lu\246\204R\247K[X\2028"
+	.ascii	"P\327\347*\301}a\013\217\005d\315\2160\367\226\272j\246Y\336"
+	.ascii	"\271\320\324\241mE!\377\264\373=\033\fN<0\312S5\206:\275\265"
+	.ascii	"\245\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\315\005"
+	.string	"\202\310 )p\213:\251\372c\235\373\231\351\364\\1\327\265\212\215sEc\300\350n\225\256\372\353\002\327?\331\232\221\255M|\373\315\335R\n\226\306)\023U$%\313t\t\350\b.\257\271=\234\n\206\2724\350WP\217\240\333@\271\357\256}\370|\332\335\2427M\213]`\332\221\020\362h\200\214p\001:\020\3768\341\250hSm5\315\240\254\232\322\376\270\2305\367\227b\220$s\261\325\336P\036\355\356ZzA\266\257\b\026"
+	.string	"M\233G\300\032\032\f\315eP\240\036"
+	.string	"\034"
+	.ascii	"\034>@:\\\nz\202\341\022\202=\264`a\200\002\204\201\341\026A"
+	.ascii	"\022\026L\320\016(\003\346\\k\342\001"
+	.text
+	.section	.gnu.lto_.refs.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\004\001\001\002\002"
+	.string	"\001\003\007"
+	.string	""
+	.string	"\003\f"
+	.string	"\001\003\016"
+	.string	"\001\004"
+	.string	"\003\001"
+	.string	"\002\005"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\013"
+	.string	"\003\006\002\007\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c9b09c8744a13a4c,"e",@progbits
+	.string	"(\265/\375`\374\020uV"
+	.ascii	"j\227(!R@\022&\r\007\371}\324\365d\016:$\204\261[n\377\324\337"
+	.ascii	"QY\323\177\230\032\215\317Ej\217\237\035\240-\002\362!\310\331"
+	.ascii	"D8q\353\252\243Px\213t\024P6g\207\277\304\272Tq\337\375\030m"
+	.ascii	"\325\227\"\017\273\301\245\253?Su\377\373\375\233H\231\002\275"
+	.ascii	"\001\373\001\002\002\373e\235<M\373\005\355F\356\226\360\331"
+	.ascii	"-q\203\245\006$X\212~\231\352\312\023\025e\204\351\3266W\006"
+	.ascii	"\254\031\335\262k\313\306\303\344\221\231qn5\037\267\\~\306\b"
+	.ascii	"[\017'?\324\025\332 -\217"
+	.string	"\343\343W\016[\262\250\255\017 >\346\326\025\022&\r\030F\377\305\262ih\023\266\2542\214^\021\342\201\252\332\222\204\321\257\r\365\f\374\275\263]\227\212\317\256\033\371d\253\273\315\026m\233{\266c\337*k\345\273~\237\374\275\177\201\006\366lu\3302\021L\335@\252x^\3144\353\326t\257CBC,\222G\232\244d=A,\t\242\216\321\207\240~\003\225\304\206H\321\007\324/\225\177\241\354\223\025;\241\273\251\273\005\330\261)3&\f\243\013\266a\333\034\261S\276@\003\337\035\243\264W\367\312C{\264\321p\204\321\367\324\257\224\007\200\354\006\236\243\376\271#\322\375\352}\243\004\245\312\251\265y;35'6\2142\253\273\rJ\2056\204\223\177\233\254\327\210]\362\006\263\305\272W \336\332\003*\b\243_7D\252nP\372/\t)(\375~~\316\371W\204$\235\177\213\220\3765B\241n_\034\375\353\333\023\326"
+	.ascii	"%\021\377\306\375/\373O\366\177\312\377\263\377bW\377\365\362"
+	.ascii	"\357\212\177#\370\027\202\177\037\370\327\201\177[\374+\301\036"
+	.ascii	"\360/\003\377\252X\023\376\363~\206\341\337\022\376\035\341_"
+	.ascii	"\030\377z\360\257\006\377\272\370\267\202\177'\370\027\375\377"
+	.ascii	"\374_\367\237\356\277\232\377rl\377\261\374\277\362_\314\177"
+	.ascii	"/\377a\374w\373\337\366?\313\177\265\377i\377\275\376\027\360"
+	.ascii	"\237\313\377\364\371|>\377M\373Y\351\357\321\nm\332\354S];j\301"
+	.ascii	"\264$\220B\022\027\304\367\311uj\306\270\216\005\345q\326\244"
+	.ascii	"\r\211\372o]s\353\266\355&\2112\021\223k\245\022\305\271\210"
+	.ascii	"\372\375a\227\256\271t[\266kGy@%jmM+W\024\347*\365\273e)\032"
+	.ascii	"4\253\346\355)j\255k\367\344D\326\346\303W\315\016\225\030\017"
+	.ascii	"\317\271\2368/\035\236sixj\313\025m\315\311aUU\204\3213\017\365"
+	.ascii	";f\311|\313\274\314\312\355T\357\314t\211Z[\323SS'\324\272\272"
+	.ascii	"':\036\276r?\303\323\355\325\335\"\322!J|h1z\037\366\314\377"
+	.ascii	"\234\364\006\223\035\234\234\211\3331\242c\251\345\n\357G\r'"
+	.ascii	"h\2146\327\314\216\351\354\330\322\325\344\242\236\377\264\221"
+	.ascii	"\312\356\316q\263\266\222\211\347{\263{\342\357\331\335\"\360"
+	.ascii	"\037\355\335\210\254n*\2709\025\2072\344\017&\321\357\352>\002"
+	.ascii	"\365\332\312d\330\3251)\345\313\022h\355\031\004\350\260 \235"
+	.ascii	"\\\257\226(\263\271\327\336n\272Z\256\220\\\231\312\344\312<"
+	.ascii	"\376t\023\363\330\275.\177\222b\310\343&\303\256\226\3110\346"
+	.ascii	"\022\250\233\372\330a\310\031\324&\3462\311\306\\\376$\303\220"
+	.ascii	"\313d\323\325\022H\nnH\f6\236D9\262^\222M\215\003\212\n\251\374"
+	.ascii	"q&Wf\303u\257\230S+\021\350\246b*\341\220Rk\306\344\304\301d"
+	.ascii	"\005\311\334\265\273\007\200b\302bv\2233\231\204\331\235\204"
+	.ascii	")FC\2518\256\316&\262\316c\020\252\276\341\324M@\257\335P\335"
+	.ascii	"\307mgw\037\273\033GI\265v\313\360\223\334\202\202\352\236\022"
+	.ascii	"\202j\252\343\231S7\213\2211[&\303\260\230\275\263f\330V\327"
+	.ascii	"X\217\273\325pWJ5\354\370\3257\272{\323\250[K\035h\030]1:lI\033"
+	.ascii	"\216\bQ\027\314\206\331\346\356p4\n\263\303\272\327\236\035\262"
+	.ascii	"G[\331\211\224\367|>\237{\"\335/\274^\366\355\001>|a1\312b\313"
+	.ascii	"\306\325\006J\026OA\241n\210\242\203\271\311\213S\343\221F\210"
+	.ascii	"z\324\007\030\030]N\225': \030=\332\364\365m\362\327\246\355"
+	.ascii	"O7\226\225Y+\247P\250uQZ\224q\352w\311\262\323\331\3076\331\211"
+	.ascii	"\241\b}\255G\037\266'T(p\270\250v\210b\364\t[I\323\203\027\247"
+	.ascii	"\372\365\002\302\3142U3\260\225\027\031\"lDI\227\365\372{Wl\345"
+	.ascii	"s\004\352\0162f+\007v\302^\314\204\273\270\3116y\tk\235e\340"
+	.ascii	"\037\027b,^\302A8k\235Y\024x\3011\325\022\256\201\271\3269\365"
+	.ascii	"\323Md<\310u\367\320\320\320\220\320\320\220\316\323\225\263"
+	.ascii	"\312\007\005\3628\021L\311\f\236\304\311u\257\3779\t+\331&s]"
+	.ascii	"hm.>\3028\254sj\355\034$\234\001\3225\300P\017\0320p?R\034n\360"
+	.ascii	"\261\262\016I"
+	.string	"\303(\333\2003%\305\205\306\212d\233\274\245\372\320uV\027\267\223\245\b\226\023\365\273\034\324\357\212\024Q\303\310U\271\005Q\277c\252L\003\013\331\246\t\036\362\375b\254\337 \327^\331H\033*`R\352\327D\272{>\327D\372]\016\365g\367\244~GC\375\231\311V7aksnV[\366\326v\203\211\321\357\216\352\317\006\245$N\360`)\236\372sxL\314\204T\241S\317=:(\322\245\n\243\350\036K\312:\316;\376\034\346\202d\013jN=/9\307\237\343\003w\204\312\227\031\365\254\274\251\362\234\363\301(G\251N\354fB\247\212\314\212\243~\266\301O\214\343\205g\233\037\030\345\033\fu\306\30114\343P\301\354F2\016\036\233n$o\267\304n\t\224\t\026\222\261\024=oQ\017\267!\322\236\rJ\271F\357\234\334qS\223\203\302(\317\312G>r\323O3\275-\331\322\231\333\001\346\203\231\316M"
+	.string	"P\221\251a\224\221\307\262\\gE\314\354\027\236\247\034W\200,\t?c\220(\202Q\021\216Q\221\n<\2021\303\002\343\017\003\243\"\035\243\242\3641R\f\203BF\3370\250cT\344\001\006FE<3\226\206."
+	.string	"P\341g,\316x\021\200\3611R"
+	.string	"\227\210\200KAHB\031;\302\024\230xS\364\361\030}B\340\322\215\020\270\2643\372V\364\324\337\013\301\"Z,\376\210IIG83\226\206H(\321\270\264K\372\t\201A\245#\234\244_Q\006*\034\006\215H\277\"\316\211>\340R\212\036\342Q\f$t\006\321X\f\002\177 \370\204\214\277\027I?\245\364\247\004\004\016a$\375\224r\212I?%\224\307\030\024\026%\375\224p\216\344\023^`\374\025\177 "
+	.ascii	"\227\0068R\220\370\023\376\200\352U\254H`\005\013\027p\316\242"
+	.ascii	"\205\002-\024H\317\242E\257\327bEO\375\212\336\356\347#\376\204"
+	.ascii	"-\030\375\220\2102\206\305\037\221\2474\034Z\340\2731\372\214"
+	.ascii	"\212P\343c\034\360\341\322\217Hd\034\016\211D;F\037\013\2430"
+	.ascii	"(\003G8\f\n\2039E\0370\230\202p\350\"\351\307AQ\206\361\310X"
+	.ascii	"\0042\372p\336\353\271 \021B\007\030\250H)\222~J>c\f`P\211\250"
+	.ascii	"H\374\261\020$&\021\t\203G*\020!\021\213D)\f(\002\217`\f\203"
+	.ascii	"\251\230\266\260\247*_\214\256>\251\022\255\032ga\264\350\224"
+	.ascii	"\201I\033\002f\214\267F#\314\22573\036($5h|\341\264\236\253g"
+	.ascii	"\223\f\243\354\354\241\246\f\027F\247,\224\r\256\254.+g\303\323"
+	.ascii	"\315\212\321\2655n\333\342)Dh\240c;\267\361\226^\310$\2142\227"
+	.ascii	"e\343"
+	.ascii	"\325mA\242\025FM\215\265|\340|C\353B\247\27091\263\234\265\374"
+	.ascii	"\314N\031V\026\r\266\234\032O\317+644N[\337\320\272\204\324\305"
+	.ascii	"p\345\234\306\346\263C\2515F,\025\203F+\310\231\025+l\366\242"
+	.ascii	"\337\320\272|\340\320\326P);\233\345\260!\202\004c\224\311t\336"
+	.ascii	"\244\2724\243\254\303\302\355\340\244\276\330\224a\2511S6\246"
+	.ascii	"^\212\024\036\333(\035%t\305\371\206\266\246{\352\304N\225\254"
+	.ascii	"\247\021\246r\036K\305\004\201@\250\201,\206\224E#\"#\"\"I\223"
+	.ascii	"ta\005\204\030\007)\264\016\021P1\223HfD\223\244P\3328/\030\335"
+	.ascii	"\330\343\212\275\205\206@\3209\356c;\355d\330"
+	.string	"\2478\237\223\366f\320M\335\006}\b\220\n\337\242\315_\365\356{\005\260\344\331\244\364\301je>Ck\232o\030\301i\216(\310W\202\f\221Q8D\003\224\301r\234\302wIa\367D\302\200}&\026\337@vg\244\242\245\362\200P=\360\320g\231\032\fPSEl8%W\334\002WH>\220k1\204\312\240A\2468A\250V\313\221\352\252\362#\025\2448\233\245\227\221y\256g8\227\320\260\003:\337\257\241f\224.\375\354w\016\034\232\305\357<\b\376\020g\264\376\300\364\302ia~v\237~\273e\243hn\"\232\017\275\211K#-,qj\376\021}\204\221v\"!\304\307\013\376\276\335#XZ:\375\020|C\247\206\3642G\375\330B\242\r\237C\207\\I\261J\030!Ps\273\270\024~\361\b\377x\201.\340\371\300\300\300\333O\271\367\356\234w K\364}\360\237\372Ov\357e\306\223\375\354\356Vb"
+	.string	"\025\345\350Xx\013\236\354I\241\016\274vr\276e\370G\305\224`\216\267F\3743v2\031\242W\r\221\2452n\013\f\242G\n\341\201\251\252)\351l\302\201\243@c\313hF%\004\237[_\301i&f\025ad\304\340D\220gr\325Z\255\356\236\2717h0\346\276\261\212\212\347\315\210\271W\311X\236NT\272\fx\340\311DGS`\215H`\003\312@\331\312\267%Nn\377\246\370\265\270,\302lN\202Df~\\<\357\306\022\230\323\370\bAt\233r\223LNv* ptQ\002r\2654i\373tG\235X\035\247\3003\271\251f\\\212\242\310\305\340\177y"
+	.ascii	"\260[\374\241\t\345\346\020\216\356UalW\317\276\b\3409\305\312"
+	.ascii	"\226\264\367\256\\J\250\202\327\030\202\367\366y \003W\227\331"
+	.ascii	"\032\022\034^\264g\204\361k\312\363\257\013_\016\236,\004\225"
+	.ascii	"3\224\352\2529\036\341\344B7\350S\036\243\217[\277\267xjD\364"
+	.ascii	"\247\213\273\3755\204~\341\006\006\033\314S\\\264\306\226\317"
+	.ascii	"\321\177\200\377\232=\320\350\213\355\037\266\226\271}\274\345"
+	.ascii	"{\375\234\357\236\325k\023\257\371eX+\361\217\200\373\0021\207"
+	.ascii	"\333[f\035:]8\300U\262\361\244\n"
+	.text
+	.section	.gnu.lto_.symtab.c9b09c8744a13a4c,"e",@progbits
+	.string	"pgResetFn_statusLedConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"ledToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"ledSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"statusLedConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"statusLedConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c9b09c8744a13a4c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
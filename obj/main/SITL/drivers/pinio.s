@@ -0,0 +1,367 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375 Q\255\001"
+	.string	"\204\002E"
+	.string	"\003"
+	.string	"\371\205\330\245\r\020\002"
+	.string	"\002\001\002\002\003\004\002\003\001\240\342\234\212\n\002\241\251\226R\b\004\002\003\002\002\002\003"
+	.string	"\004"
+	.ascii	"?\213\n\216\333\025\272\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375 .\345"
+	.string	""
+	.string	"\220\""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\002\002\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"B\221\221\333g\003X"
+	.text
+	.section	.gnu.lto_.inline.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375 \260\375\003"
+	.string	"\262\307\031$\200K\322\001\fP\035\220\f\342\312\205\230\205-d!\0047\007[\n\314\320\231"
+	.string	"\310\024\003\372\375\373\261\021)S\277\356u\317\316P57I\202{\2412\306X\340\243n&\221\214A\375\200rNE\0337I\207\373:\256\236\005\207\277\256\317G\255\343\223\320o\244 \216\312e\360\2136\013F\222\350\223\241\332Di\210\357\217\b"
+	.string	"z\ba @Q\304@\2007\313d\331\376P\326m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375 \301\325\002"
+	.string	"B\204\r\030\260%\351\f\303\200\234K\222S\f\206\301\r\324Q\217\002d\267\335dJ\001\3724f\204\231\3417\017L\223zR{l)\027U\023\217\324\214\216\323Y\367\f\336\t\b\r"
+	.string	"0\005\225\027"
+	.ascii	"\236\262\b\274\023\250\272\251\202\321\274\022\310\254)$d\022"
+	.ascii	"\003\216+\246l0\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375 S\375\001"
+	.string	"\364\002G"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\b"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177"
+	.string	"\001\002\t"
+	.string	"\002\002\007\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	"\002\002\274\006\001\002\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"1\003\320)@U\334\240\254\n\2036"
+	.text
+	.section	.gnu.lto_.lto.8778174921eb2c03,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioInit.9.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375`\266\005\235\""
+	.string	"\026|\326G\200\332U\007\277A\376\032`\005\334\364\311D\254\202\237d\374\2604V$\236\213\363\332f>\007&\374\\T\321\352K\360\024\212\237\270\330\rq\364\215\211\246\265\321\342\347\374\272\245\340\001\003\232Y$\321\316\317M\366\226)\245\024\304"
+	.string	"\264"
+	.string	"\302"
+	.ascii	"k\247\234l\037\265\323\265\005\250\235\262\217\331L\001&\\\026"
+	.ascii	"!\227\233{\257\356\207\260m\233l\326q_\357\350\344\340n\266\332"
+	.ascii	"JSS\373\356\343\326j'z)\301H!\376z\307\342\236VR\355\034\376"
+	.ascii	"\260\022\266\226\\GH\321\3309\270\333\261\330\243m\226\301X\020"
+	.ascii	"\262v\016yX\003F\346S'\031Jy\rN\325\261\030\325++8\026\241\232"
+	.ascii	"fubL9\3329\204\262<Tfg\204\256Z\237\261 d7b\223}`d>\261\002\347"
+	.ascii	"0\312S\n]\316\034\213>\332Z\241\247\225\224\016\221\311\n\210"
+	.ascii	"\242\362\354e\273\rb\320\277\267\332\303\260\\\225\035\213\306"
+	.ascii	"vZ\205{/\273\023\261\330\314\323\314\235cf\n\314)\210\316Ex\006"
+	.ascii	"\364(\213\236\342b\002\325\275A\"f^K\201\261\336\033\034\212"
+	.ascii	"R\"I(L\221N\271i|/{\300"
+	.string	"\023\250\021\013\f\350\321\217\242\362\254\372G2'\177\376SO\253\250*\374S\314@\335\325\334\323Y\335\001\336\231\247\225\315\266\324\271\366\316k\352L{g\325:\247\357l\337\371\255\263\277s\347\236\207p\351#vo\216(\234\333L\301\216tW\267\222\271\271\270\227]J\271\037\023\311\275I\242\265\223\334[|\353\224\331I?\361\265\222\303\354\205r\341j\013\364\336\033\324)\017\255\235\346l\337\230\271\235\271\257\032\313\327Y4\032\300\275S^_\367&!\360\203g@.#\0260\177\326\327\240U\006\326\r\344&!\203\336\344u\320\036\247f\300\203\272\303\007\031m\232L\377[\tx\b\021\215L\323\f\376\257@\2314Zh2T\332\367Q\311T\237\366\351\216\245\360l\245\272\303{\257\203\326\322\374y\034\036\313j:S\037\331\bT\236\365\311\321F\240\252\317\363\354B\250\245+#\032\220h0\023\t\250\324\347\260\204\t\030"
+	.string	"O\177\250O\250=\317\214\302\310\333\211sM\377c\373\351\267W\367\221\372o\277\233\214K\036e\333\377\327\272\304\204gnd>i\245\2174\336?6\233A\255\240\261\217d%\265\347\333\371F)&\350f\214s\177\346]\013o\247\236\317\005\377\307\375\376\001\274\235\357z\305N\005\022\257\350\306F\021x;\244\335\013]R\357h\306\256\227B\207\264C\341Bg\324K\322E8\300\274\027G=]\f\036\257\247\273%\357Wk\365\005+$eP\340/}\355<\222iZr\200\376\307xP\333\336\0067\207\251\266\357,\345\230\240\233\265\275\367^\035\241\266=\320c\031Q\202\351\362\034&\315F\351gM\321"
+	.string	"5\270/F\037P@\217\342\312\2409\003]\372\2324\231\214\314\030\0177\224\030\257\232\210\216\0338n\217\364\202\325a\300<kU\\1\252\200\224A\333\202\312\354\323j\247\205\004T\367\336\241\261\242\2370\367^\242.\335\304\300\0316x;mP;\255\215m\271Q\003\364\350\232e\215*\233X\327\276\267~\355\273\2140s\250a<\246\fD\206FDd$I\223\306\200\002\221\251\262z\020X\2504M\322\030!Ry\236\375\206\274R\265P\326 t\267\303q\033\221|\212\005\271\301\336\204\314,\2414\376j\362\221P\373\213\221W\202\273U\020\341z6x\377\374\020\235\370-'2\220\202&\272\321\233A\354.\352B{f"
+	.ascii	"f{\261\212\n\222f\n\207`D\360UI\240b\277\375\323\210\364\026"
+	.ascii	"C\265pL(\203\217\263\367W\246\252\260\035\214\3711\246\255ij"
+	.ascii	"@q\013<\300a\301\354\207\027\341\036\323D\331u{\244\223\343M"
+	.ascii	"\356\270bF\247\310W\232H\313^\346;\217D^}\f\020\337\322u\363"
+	.ascii	"\236M0Y\303I\372\272c\257\312p\302l\030\335E\017\327\341\f\341"
+	.ascii	"\264\005\267\032n\026UI\t>\006\236fuW\306;'\306S\037\3018xQ\343"
+	.ascii	"9\321Rq\001\3651\210\326j\322H\251\2270\177"
+	.text
+	.section	.gnu.lto_pinioSet.10.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375`\303\0015\020"
+	.string	"\326\336mG\340\222*\035\222S\344\301\325\031`\252\3468\271f\"\t\375\021\250\225CZ\242\2167.\020\300\025gu`t\324^\001\\\333Vn\b\3474\032\302\0303\024\200\230\007:yi\t\n\252t\231\206\020m\305\306F\210\334)\005X"
+	.string	"T"
+	.string	"["
+	.string	"/T\247\031gp\367\204\212\231\3355q\202\316\277\317\005p\376y\017\300\371g\225\375\343\245lo#\321\212\321\355n\250)\256\272\247S\345\337v\320\365Z\335\363p\365><r-\222W\213g"
+	.string	"V\302\346\266O\016/\326\234\"\021v\327\323\365\352p\177\267=\3016\004{\236\004\336\356\256\025f\277v\203/\377\316i\277\210N{\237\3269=\347\364G"
+	.string	"\264x\031\201\342E{\224\353\262\023\262\271\017\007\213\327~\373\267\331c\273\226\372\254\312u\t\205\320\315t\273\245\202\177n\340\320\211\352e\212\300\203"
+	.string	"\231\351\330-M\314\240\363\317\237\366g\017\240\252\206D\334ZC~cb'\243\0323\250S+\330|\264\314\033\333+\257\221Z@\203t`\306T\317\212\006\246\243WPo\243\365\201e\3622)\220lw\035\330\036]\006\tA\315\356>\210y\f\223\277\342\2371\240\346]\377|\024\347\337\325\003\343fCc\231;\273\\M\215\331\017\342\t\345D\001%\212:\"rj\020UD\343\347\024\0209\212\306Qh*\211\031\306\222J(\032QV\302\224\222)\004\02509\022K\341\211$K\241\247\334{\2530\t;r,\312\3624\206K\225\310hH\003r\200.p0 H\246\252\247\266ha\336\345\317\006]\331\036?sa\244\346F*\271\341)\030\036"
+	.string	"3C\357\220\3009\273ehwF\326\200e\026\001z\300\270M\210\236\tl"
+	.string	"\355\300\020b\310Q\2068%\243cnB"
+	.ascii	"\333\201!\224\220\005\n\361\b!Fm\006\222\270&\326\341\032E\r"
+	.ascii	"\377\214\373=\017\212kn*q\246\024\n\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"U\005"
+	.string	"b\t$.p\307\351\305\0274\na\213\022L\n$\017J\357#\\S-\335\304\234\360\365\017\377?\377\377\377\337\276\266>C$\"\"\222\021\022!r\247\024\376\367+`B\001)\346\005\360g,\222I:\251\357N\b\210t\217s\342n\003\016d\001rN\332\027\007\b\004\2173\342\036/\005\225N\344t<\267\001\26038\025\232%\224Bh\225\351\205\251\365\335\265\031\341\245\330\237\335]K\247\230\366\265\255$\310v|\354\306V\333\243\334\240f\363(=D\333o\004\t"
+	.string	"\240\036"
+	.string	"\034"
+	.string	"\034"
+	.ascii	"\034>\201|\265\364\247`\270\354\235tJ\017"
+	.text
+	.section	.gnu.lto_.refs.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\001\026"
+	.string	"\001\001\030"
+	.string	"\001\001\031"
+	.string	"\001\001\033"
+	.string	"\001\001\034"
+	.string	"\004\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\001\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8778174921eb2c03,"e",@progbits
+	.string	"(\265/\375`g\013\005="
+	.string	"*kp\027EP\036V\007e\240=\242\034\201\274R3\272\240\245\263z\271\006\334A\013\324\274P\"\215e\030\035\205&\216[\300Qg*\005\016\2213\n"
+	.string	"\241\212S,$\027"
+	.string	"\030\301m\300\r\024\2311\026W\355\037?\322\312\224\002@\001[\001i\001]a\244\340\334\366Z\207\240\314=cpnd\273\346^\274\352l\316\245\375\375\267jx\035\215\250\367?-\033\373\377\366+\335B6Os5\004\313\377)W\260K\256\352\206\347\377\221\224\224|vt\316,}Y\255\013\360\356\313\253\344\n\3543\245\317\036\234{\330\366\207\266\231\332v\264n\307\342W\334\272\342\237\372\377\004\204\322\324\241\271\341\354Y\234\352\325\004\276\2453l\350^\362\354\313\376\337`\336*\003\266\004\347\256\320\266ki"
+	.string	"h~C\267mg=\201\317\315\204\355gG\276g\364\375\240\007$_Tp\356\3416\373\221o\201\013\260\322\355U\274,A\257i\345\276\365\3775\n\276[\316/\234\373u\001\276\326\217|\335\216`B\303\bv\343^w\317\265\232\356fS\347\300\244n\317\022\272\035Bw\253u{\204n?z\320\335\327n'\340\240\333\031t\367Z\2677p\005\b\036t;^\267'\350v\244n\017\320\355D\335\016\324\355?\335\356\335\235\327\335z\272\333Lw\267\351\356\266\356~\353n9\335\215\242\273\355\272\333Mw\207\351n\267\356.\353\356"
+	.ascii	"\335=\246\273{\331l6\333\355M\335\256\354\016\342\nw\246V\034"
+	.ascii	"\332d\376\225S\252|\026a\233\257\373t\377n\315\361\317\006\377"
+	.ascii	"R\367I\247\374\341^\226\330\253\345U\351~\001\347\322\313}&\266"
+	.ascii	"\t\305\375\207\262|\361N\246\344\213}1\307&\277\244o\225\343"
+	.ascii	"\337\300\277\377\316\377\244?\366\377\223\377\017\364\224\276"
+	.ascii	"\377A\212\232cN\347\177\024\311\371\322$[\216\177lm\343\005\332"
+	.ascii	"\244z\271B\266*u\354\253\336\244\217=\335\364\331R\223fo\365"
+	.ascii	"\377N\247\035\203f\315\301\331\345\b\221i6Y\022\327\372\235\303"
+	.ascii	"\361\252\307\351|\346\276\300\236r\253\314Z\222/\230\315f\263"
+	.ascii	"\236\364\246\337$\315\244\304\341\334\355v\355npW\031\252/\234"
+	.ascii	"\305\370\030o\363s\377\231Cmp[Tp\256\003\262\223\332Y\271\264"
+	.ascii	"\355ee\3224t\013\347\\\316\261\216\215\276\217\305\304e\215\323"
+	.ascii	"9\033\257\372\234\237iG\343i\032\351\375\277\222\311\260\301"
+	.ascii	"\347\\\215\303\021%\337\357\221\341\312\243\f\317\377\253\244"
+	.ascii	"\204\244\364+B\305zms{X\353\357\002|E\016\244m\257\366\0337\323"
+	.ascii	"w\031\t\231-+8\267k\265\355\320\266\275\331\266\325\005\370\362"
+	.ascii	"\277~\024\007\007T\345\315\313\212\263\303a\177\3630\355p\016"
+	.ascii	"\346\307t\270\374\257tg@\344\316\340\007\214\022e\026_nW~iw\233"
+	.ascii	"\020szt?\314\362\272\374x\331\261[\253\323\241\003_\r\031J\013"
+	.ascii	"\313\"q6\276\362\261\3013\363\302\031[9v(\n\037,a\230Gv:9\313"
+	.ascii	"\302;\202o\336|\320\221k\033\263UUa*/z\227k\254\306zS\272\342"
+	.ascii	"\256-^6^b*$\267\267\306\231\365F\366\037M\312vD\254B0\2631\325"
+	.ascii	"\232W\030\0256\250jGv\272\244O\037\234l\377\337\263p\001\325"
+	.ascii	"^\266-\370\033'\003H\325\354\340\354\331\006\343Q\330\216\330"
+	.ascii	"\301\375v`\271\r\001\313\253z\236\273\tjf\271\2658\377|Rh\034"
+	.ascii	"m\333\351x\035<\327\343\321\357\331\305E\243I\276\3515-.O\273"
+	.ascii	"\236\276\373\375\227\375?\202\241\271(\231\017\234\033\317\361"
+	.ascii	"tw\020>\263\004\355\f\217\337"
+	.string	"i\355\214\261#\247\355\315w\310\246\310\341\\u;\316\005\210\007&\255\342\334\370\252m\334\355{\345\363\377\261~\336\177.\177\355?\016\364\2367\350\356\374\017\345\237H\235:\355\2235\245\020\234\273{\3017\331\177\322\350\337\1776\251\323dS\013\032\250\321\373]\004\236\372\365\315w\n\315\356\343\177\337\2379\205\316h\276\356\263\371\272\311\242g\272\311\377\027Z\324\264*\223\336\244N\241M\252\0135z\346'\237\252\354j\231.\264I\306\205\0265\251Jh\2239\205\032\r\251c\344NGDd\361\250\302i\b\024\305\002\005\216\017Hb\b\247\241\220\323\320\207\024r\032\226\b\3414\374\025E8\rs\277\270`,\"\031G8\r3\222x\242\375!\213R\303\240\206*\036\211R\304\250\266\2318X\340\320t\003\250\233:`\350\200\301\327M\035\204\302\016\034\204ms\020\366\210OG\242\224\r'\"\324\221\206q\212x\f\"\373"
+	.ascii	"\021\311\0029\3653\365D\214QDJ\3210A\204|r\032fc\021\267 \"\217"
+	.ascii	"\304\032R\305\026\206\321\370\341\351\007\331/\242d\fh\243\f"
+	.ascii	"\342q\ti4\036\227\206\220OMH\251\"\r (\337\324ST\321\205\224"
+	.ascii	"\021\004\020\371\004\324B!\210\005)H\204h\241.\030\213RE\031"
+	.ascii	"KSGb\215\342\261\305\222T\221E\214%\250\343\324\322\005\003Q"
+	.ascii	",P\030\213?G\270\210\250;\322\314\304\256\202b\250\326\270\205"
+	.ascii	"Q\t\255\251\371bD\255\b\020+\216\230\227\353\257G\017$.\230\326"
+	.ascii	"\317\311\244\212\n\177\341(p\232\255\266\301\031O\333&9\352^"
+	.ascii	"w\352\210\022\2063v\231\334\177%&\202\273\032\273\375b7\230\027"
+	.ascii	"tg\200\237\\\263\372\370r\220 \230\213G\326\033\031\336\"\006"
+	.ascii	"\226\007K\033s\005\241eJ(8c!\216\r\356\211c\222d\317\326\026"
+	.ascii	"\216J\213\354\341\361\243q\324\261DZ\317$uV\037\2339I\276\342"
+	.ascii	"<\237X+JD\327\206\007-\253\261VP\236\2302\013\316\030\313\261"
+	.ascii	"Bi~\230y\2341\324\003\200\345\250q(\207\2245#C#\"\222$I:\240"
+	.ascii	"\002\021!+\326\001\021\260-\223HJ\222,\007\333\001T\214\355\016"
+	.ascii	"\210\021\301Jh\202\250^\016\007PTTR\377,*\223B\233\370\200xB"
+	.ascii	"\271\305\340\020M\317\335nM_\260\267\225J\f\373X<c\016\372A\370"
+	.ascii	"=z\360R\255\016`*\214\267\003\323\217T8\302\t\362\243\301\263"
+	.ascii	"\205\021 \r\206m(Z\0057\331\314&Sr\002\253z\301x`S\211~\335\035"
+	.ascii	"=z\304|F\310\252m\nK\234\256\222\026\3549g\273\223v\266\001\325"
+	.ascii	"O\344\356\226\357\303N*\r\322\332H\322\r6y^(\315\300|EJ\323L"
+	.ascii	"uX\374\356\230\341\353\305<\021\270&\232I\"\f\373h\025\004@h"
+	.ascii	"K\375I\207E#J!q\251G8\247\322H\004\216h\333$us\367}\0371x\300"
+	.ascii	")\222\240\003$`]\rn\363'\260\262\331\355\252\200\331\2133\232"
+	.ascii	"\316\222\240\241\364\362\022\233\244\2270/ech\304\304/)X\251"
+	.ascii	"\226\321M\004\244\"\371\236\214r\233\307Q\274W\005\023v6\221"
+	.ascii	"\201\271\237\221\253\036\rN\324\326\307\024``B\276\n*\241\300"
+	.ascii	"\332%\311,F5\n\361\002\342p\204\300yH\bH\177\220>\253\220\263"
+	.ascii	"s\220\016\372\301\037\301\271\207\037~\373\342\347\331'5\rh\254"
+	.ascii	"\271\251\005hJM\034R\343+\215-_\247GF\261\311\373\200\375\272"
+	.ascii	"wN\243\022A\024\247\366hR\206\240T\004\257\2008\334\266y\022"
+	.ascii	"\271\221\302m#\357\264\355V\204?\367%\036\323\340G\223\025\241"
+	.ascii	"\035\305\212xC`G\354_\313\333j \256\251\234\177\237)\300Uj\213"
+	.ascii	"\267\004\020\277GT\001"
+	.text
+	.section	.gnu.lto_.symtab.8778174921eb2c03,"e",@progbits
+	.string	"pinioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8778174921eb2c03,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
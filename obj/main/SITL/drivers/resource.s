@@ -0,0 +1,202 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\204\361\352\236\b"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.3.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375`\201\013\3054"
+	.ascii	"\332[h\02480jm\01603#A#\201\366O\200\231\231\031OU\215\243\347"
+	.ascii	"\342\236\005\311\335\373w8\275go\216D\324M\335\216\375\333\336"
+	.ascii	"vH\023\021\214\330\3147`YmbwJ24\001H\0015\001zC\027\243\267\265"
+	.ascii	"m\327\034^\313\322\335\314;\333u\007\330\350n\246\207\257r\364"
+	.ascii	"7\330$\263]\177x)J\177\213M\257\177\222\364C\260)e\273\366=\023"
+	.ascii	"5?\024\233 \222\f\035\021\274\236\357\263\332\256\277\3765:\242"
+	.ascii	"\270=\337\017\265]\203=\0212\207\203a\234\357\323m\327!~\315"
+	.ascii	"\314\341\342\270\355ZD\254\245'\202\tm\327a\256\216\236(\306"
+	.ascii	"\371>\240\355z\304*3w\204<\337\317\263]\223@\265tG%J\235\371"
+	.ascii	"#x\306\371\376\231\355\332\204\250\245?\212_\313v}\342\223\232"
+	.ascii	"\307\301O\266k\024\234\222\036W\343|?E\246\245\313\265\332\256"
+	.ascii	"UX\262\341r\361\215\363uL"
+	.string	"\333\365\212I8|\016F;_\207\333\256Y\314\355\360\271\230\307\371\272\235?\220\224N\007\3778_g\003(n\351t\361\227@\215\226^\007O\021\244h\351u\376\262!Z\372\244e[!5\237\024\343p{[:&X\306\033\333\3221\305\355 @K\317\004\267 \324g\351\231b \347k\242\220#\340\271\316\256G\255\267\205\022\252.\260\326\326^W\342:\310\371\376v\235M`\316[!\002\256\036\326\307\372Y\346\2329$\314,b\0321\217\230HL%\346\022\263\211\351\304\204bF1\247\230TL+\"L8\004\312 ^C2\204E6\257\244\020`\261\363\345\361\331U\316 \304/\345,\002,g\2736\237\230E\210\327l\327;\223\211\231\004\230\247\223\234I\210y\346{v\001\346i9\002\036\021\345\2058\212)D\211\201\267%+\211!\356\275Rf\200Qm\327\\\254\214\031\342N\333uW*\343\326u\3335"
+	.string	"Sf;\226\333\256\003\2142\363"
+	.ascii	"k\001\240T\017z@'\265\017\232\316vM@\323\361\203.p)\351\005\217"
+	.ascii	"\331\256\rPRz\305\007\350\224>\re\273F\020)\351\323G\266\353"
+	.ascii	"\004rI\021\262\266k\005\216\216\"Tm\327\013\026\031\303>m\327"
+	.ascii	"\f\340\324\260\261\363\335\315m\327\r\f)G\354\030m\327\016\006"
+	.ascii	"%G\304\017\332\222$\340\335\237\355\032B\240#\211\b~\214)$\354"
+	.ascii	"9\246\210w\023\360\030U\300Y\266k\nu\214*v\025\344\fW\354\204"
+	.ascii	"l\327\026\336\234\255\210am\327\027\330\250\261\200Im\327\030"
+	.ascii	"\322\034Y\304\234\266\353\fo\346\314\331\314K\333\365\036\223"
+	.ascii	"t\2668\322v\255\001\214\322\333`E\333\003\304\024\371#\n\021"
+	.ascii	"da\332\"]\342\017\t\002D\030\030\212\"\313\330\004yL\210n}}}"
+	.ascii	"}\265\350\027\210/\260U\355\312!V\025l\f\210T\213\255\261+\317"
+	.ascii	"\360J\316HS\242\361H\246\371x\244%}\330H\243\341\313a\343\f\207"
+	.ascii	"oF\032\017\237W\204\214\246#\231\346\353\201\206\226\346\343"
+	.ascii	"\312-\n6\006D\252\305\326\310\225}\217\363q?\376\307\003\271"
+	.ascii	" os7\037\344\204\334\220\037r8O\344\213\234\221;\362G.\347\261"
+	.ascii	"GrIN\347uN\311+\371%\307\344\232|\223wrO\016\312C\371('\345\246"
+	.ascii	"\374\224\247rU\316\312[\371+\207\345\262|\326\013\371!_\344\215"
+	.ascii	"\374\221G\362J~\3117y'\017\345\243\374\224\247\362V\376\312c"
+	.ascii	"\371,\277\345\271\274\227\377\362a^\314\223\3712\177\346\321"
+	.ascii	"\274\232_\363m\336\315\303\3718?\347\351\274\235\277\363y^\317"
+	.ascii	"\363\371>\377\347\001\275\240g{\267\177{B_\350\017=\242O\364"
+	.ascii	"\212\236\3217\372G\037\367\361CzI?\367u?\351+\275\245\307\364"
+	.ascii	"\231~\323szO\377\351C\275\250'\365\245\376\324\243zU\277\352"
+	.ascii	"[}9M\331\026:\017a\024wyX,\3562\273\272\353\220\227\327\027l"
+	.ascii	"\332\362v\031\r\376v\331u\177@\226%C\335\262\364\314j\333\262"
+	.ascii	"H4\370\333\312en\031\213\354e12`\032\024\023SY7@^]\240)\222\375"
+	.ascii	"\021\327\226+\017S\267=\266Zy\fm\317\274\266\252\332\256\303"
+	.ascii	"\255,D\177\301\026\211\202\251g\356\005\331\037\032l\003\270"
+	.ascii	"h\177\302\026[\271E\317\334\242g\260]\265r\333\313\255\326Ql"
+	.ascii	"e\177\300\036\200\fl\311v\331ES7\rre6-\246)P+\007\333u\227\317"
+	.ascii	"\314\246.\233\276 \252[\271\250\262"
+	.string	"n\213\f\246\302\336Zl\211?\326\355\312l\nc-\366r\213j\345\237\373\013n\225\271/\316\334\242\310\266\375\025\207+\312\225\305\310\204Ed\031\013 \013\177*\233\266h\233\366\262pe]\342\212\"\177l:\374\241\002r\221l\250\272\274\314\246A\242\332\"\025#\376\330\256\254\225W\225\250\026y\231\250\026\221h;D\002[\262\256\274\242\303]\016\022U`0\025reW%\252)[<\263\352\226\245]e\356\201\034\200\350\250A0\342\254v\"\024\024$)I\2265\340\242\241!\326\001\02082L4[\f\r\004\324\305-\333\272\016\255)\342\250-I\037\t\330\205\352\312\272,R\344XA@\225\024\257<\354\nO/urc\301U\2462\365\252\354\320\023\227\241\n\360\225\336\b&\245\276T\0361\271*\224r\202s\250t\270Q\365T\341\2137\234\334]\204\251\345\223I\345s]\035\330\262\030x'\325\230{\222"
+	.ascii	"r\307|\307\240\232\230\266\373a\361|;u\350z\204\204\360\230Z"
+	.ascii	"\343\306\373ao\276'\202\241\224\"\3543\360\300\215\363\346B1"
+	.ascii	"\337\357O\314\335\355C\253\013\251\217\2269\307:\262\037~\031"
+	.ascii	"\022c\305\"6Up\314\343\203\321G\t \366\234P\227\236\036\024\373"
+	.ascii	"oM_\320\312q\303\210Uj`\252\270\\\013\250\304\351\360\326\222"
+	.ascii	"\247Vra\331\202<\333\207\362D\243\317\225\020\323\\G\350\257"
+	.ascii	"\337Xv\t\361\177\210$\207Z\r\034\325\306\202_\217\r\204\367\257"
+	.ascii	"\361c\305\377\260\346\333\212\212m\250\266\325\315\251a\t\372"
+	.ascii	"\217s,\006\311)\013\b}\0230\346\246z\352\037\273\363\303\301"
+	.ascii	"\337\323\035\376uy\t'\022\177\311]\t\240\203\371s\227\332y{\031"
+	.ascii	"\251!;\203y\271X\243\213\211u\253}\031\033p\t\210L|\3201.\302"
+	.ascii	"\212\270\337\303\314\253K\n\266N\260u\342\250\027\336\353|\247"
+	.ascii	"p\376\252\354\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"(\265/\375`\372\006E\""
+	.string	"\n@x\rH\220VN:>\370\375\206\213\343\210\002\350\313H\177\001\303\354\265b\f\232\303\366\021G=\205\205\254\350\21759\214\316\314\204\227B\002\030\325\302\2525\030I'\351&"
+	.string	"\314\302\234\204;\013\226&\023\331\264iE\226v\322\2562\245\242"
+	.string	"\316"
+	.string	"\314"
+	.ascii	"\307z\226\257\365\037~\020\301-8=\352U\255\365Z\020\222j\315"
+	.ascii	"\271VO\256\326\234\336\237\340O@\253\224\246\220&5\004\335\213"
+	.ascii	"\247\357\303\276\361=|&\220Q\261\036k\255=\036\032\325\214\250"
+	.ascii	"\245\326!\355\035\2369\253\021,\243SP\374\317\244D\3563\275:"
+	.ascii	"\333\\\366\t\330\237\261\357\263/\300~\317>\317>\214\375\027"
+	.ascii	"\373\246}\027\313\331\216\263\375f\333\315\366\232\355)\266\241"
+	.ascii	"\330~b;\3156\023\333g\266\223\330V\222\331\036\263\rf\373\313"
+	.ascii	"\366\001\373G\266\201\330\276\355\244\355].\227K\333C\266kl\263"
+	.ascii	"JIv\3062\271\034KO\343?s\006\311\351\227\271\220\3021Z\372\273"
+	.ascii	"\357\210\322\3058|C.\365\225\366\215<\031\003E$T\266\324\307"
+	.ascii	"\377\314\027\343\351\027\351)\021\342&E\204L\267\202\307x\264"
+	.ascii	"\324'\263/\3661\031$\033KLKm\366\237"
+	.string	"\031\343u\372C\\\216\222/\242\302\300b\214?BTK}0\373^\377\272V\206\007\304\247\030KM\344?sw\237\371\256\323\027b\342\030\306U-\205y\216\337\212\307\255\016\344eX\253\n\007l\304\033U\340*\020\022\003\035\025$\2630.\235\312F,\356\214\206Av,\365\221\366\257\256\343[1I\265\356\324Z\t\360\346t\224OK\355o\375\3302$&\025\003\364\254\206\232d\024\257^\276\342n\020-\r:\272\3452\354i)oq\266R7\264#BK\275\325\276\224/\227t\2619-\225\200\345\364\263\254\216\246!\324\234\234\214\233\023\245\313\331\307\362\270\035s\270\003\203j\251\203\377L\023\356\364\257\264\250\005}\021-u\261\362\306\342\005S\317R\377\315~\333\335~\274t9A\255-E\300v\372U&D-U-m\241\262\206!\250\306\222\245\376\232V\206Z\2173P\224-\275\224\323\237b \210\330\327R"
+	.string	"Q\240\250\261\240j[\352C\261\217\366'<#Ld>K\237\324\344\364\235\354\270\222sSK}ji<\034Eb\307\245~\232}$g\222\205\225\203\266\364N\377\231G;\375%\272,c>OK\007(9\253bZ2\261\324?\263o\3666`\233\017A!\020\204\215\215\020\270\023\322l\250\241>O\n\b.X\250\240\253i\020\254\021\206\260\271\t\n\2017\302\240\b\016B\r@\017\034h:"
+	.ascii	"k"
+	.string	"\2047\300\006\005n\202\035h,\b\203\036F\330\300\330^\243\242\264,\345\326Ro\221}\270]\321u\004\253i\351\202\266\323KD\227\336~l\f\tU\263\246\263\245^!{sV\305\022[\030MY\352\265\377\314Mqz\203v\352\230L\002\3754a!\211\226z\177\354M\261>$\226sV\226Z\355?SF\354\364\022\221\214\255\361@\321\263\343\001R\362,\365\366\330\357\332\023\313\2516\342R{\0319\275\303\335\316\020RjMl\t%\240&[\302\336\235\345I\026Q\022\267\324p\377\231\275\373\314\3159\275\001}\25018E\f%\216\223 Z\222\024\244\332\320\002\221\300l\334\021\200\031\223\"t\031\335\372\031\311\326\274\362\341\037\311}\r*\364\f\n\244\037\211\034B\337\331,\212\374\257\344\364\013\263\316\257.\206\fH\237\244\245\221:z\245T`\227\221\362\032\003\233)3\363PS\025\317\003\254\256\026\317\331 \351"
+	.ascii	"`\324\375Y'\313\203l\217\222\240\320C\0322KI75\330@\006\2260"
+	.ascii	"\b\002d/\357\270TQF\353\333b\026DQr\231G5>83r\254\324 H\271\205"
+	.ascii	"\341SZ8\271\202\236\325xarZ7iWY\352\030!\026\2139zV>,)e\013\213"
+	.ascii	"l\216*[ch\031>]\263\005\373F\207\204^B!\262\357\367L%\0075\207"
+	.ascii	"\222i\030h\241U\2359\304b!\267\n\345q\b\201,\304\271U\235%\377"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symtab.bad99ae4ecb8d9e0,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bad99ae4ecb8d9e0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,663 @@
+	.file	"sdcard.c"
+	.section	.gnu.lto_.profile.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375 \026\261"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.text
+	.section	.gnu.lto_.icf.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375 \316\255\004"
+	.string	"T\007\302"
+	.string	"\016"
+	.string	"\361\276\365\232\002\004\002"
+	.string	"\002\001\001\240\342\234\212\n\002\376\325\313\252\007\003\205\202\223\224\r\002\002\001\004\354\301\314\336\005"
+	.string	"\005\266\220\327\256\013\b\002\003\002\004\002\005\006\002\007\006\b\266\335\207\245\005\b\002\007\t\276\356\274\271\007\t\002\007\n\226\237\371\262\t\n\002\007\013\324\274\303\350\007\013\002\007\f\246\376\330\233\013\r\272\313\311\210\006\016\352\374\247\204\b\f\002\007"
+	.string	"\r"
+	.ascii	"`\024P\n(\007\214\003\306\2219\016\317\224\002_2\227\233\314"
+	.ascii	"QpV\332\205\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375 \266\355\002"
+	.string	"\202\204\r\026\260%\351\fS\312\3030\fC!\331\022\322Z#\255\265\275eJ\001N\022`\312aL\337\212\351\326\022\024\255\344\n\274\207:\027\241\231\2750\341\361\232$\355\326\342 \017"
+	.string	" \004\025\2270\001\343\325?pEP\245gFQ9]iq\224"
+	.ascii	"\226\200\221\325<J\334\\ \033\300\002"
+	.text
+	.section	.gnu.lto_.inline.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`~\001\275\007"
+	.string	"B\214)/`M\222\0160TV:\016\232\307\n\002\253\016N\036~\273\013e\372\353F\370\370\377\024\0038U"
+	.string	"\020\004\301lmk#m#\t\255\221-w\nK\317-\242@dPd\240!\200\247J\300)IfB?O\325\372\007\330\337\205m\026\320\374\257\027AG$80\235M\025\223\231\315e\267\340B@L4Xs\005o\275\257 \236\201#U\341f\036\"0(7\f\231\331\360\370z\252\356\240\227\222\223\017\t\001-\025\016\026m\274\357\335\326\375T\365\217\360R\315\314t\236B\217\215\216\t\326\277\204^\\D,\322Gw!  \220\002!\261\342\003\200\302"
+	.string	"s*T"
+	.string	"\206\256\321\016\227\2155Z\366\236\006bF\251\017A\355\342\274\030\027EN.g3\366\"\021\364a"
+	.string	"@\365Y\327\365\373\036L\254\035\032\212"
+	.ascii	"(\r\3067\262R\277\316\370\t0\214\017\367}E\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\r\005"
+	.string	"\262\307\026\036\260'\215\001\f\266\004\002\017\206\"8\263\3210\212T\376\300\242\350\356\326\204\340\266r\313\224\002\242S\013\004t\n\022\225\344+\200NSg\177\246!\245\224F\224\032Q\037j\245\276\361o\b:e\224\342\224gf\265y\200\225\276\231e\251_\034\217\236\270\364\312\034n\216\325\324\201?\002\033"
+	.string	"/\231\350\rp\267"
+	.string	"\223b&_U\f\b_\261\331\303\216u\341\256U9"
+	.ascii	"\002\317t\303\301\234\177+\037\034\2639B\035\003[Q\270\004\344"
+	.ascii	"\301\305rB$O\241K\263\346\347\0050\211.\223\260\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\002\230\004\003\230\004\004\200\004\005\231\004\b\231"
+	.ascii	"\004\t\231\004\n\231\004\013\231\004\f\231\004\r\231\004\016"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\315\003"
+	.string	"\262\204\017\031\240)\035\377\377\377\377\377\377Y\306\261\366\277\375\177\314\222f\215i\333\2262\005\377\317\310`\013*\036\302\031\276\2510\231\362\245S\225\253\266\3664\347\254\\\351\005%\220\264W\244\374(_S\n\032"
+	.ascii	"\300\023\260\034X\f\f\002\374\201\201\001/`\270=}v\332\025\325"
+	.ascii	"b\346\037\327\345 \254\3556 \346>\254\233\2047\226B\004\226\001"
+	.ascii	"Bj\036\200pw\216\001\001\027`\b"
+	.text
+	.section	.gnu.lto_.lto.474b1be973bec565,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sdcardInsertionDetectDeinit.15.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"}\n"
+	.string	"\026\223GA0\311h8(\304ql\253{\2412!\024\217\247\212_\307v\241r\324}\222\300\022\334:B\273"
+	.string	"f\311\022;4\004m1\013\324\\\033\300\301\200d\024Q\341\321bO\325\t\312\203_\223\275\267\224)\0055"
+	.string	"3"
+	.string	"6"
+	.string	"\261\t\273\333\251\314O\3274O\376[g\020\307\360Z\313U\233x\300 "
+	.string	"\304\250\322*^`\016\274\365D\031S\231\233\214\335u\212#\313\275\335\366\206\355\013\373\026\001\3427\337\304}\273\252\004\004,\027*g\366+L\215\261\257\255\256\354\247\363\351o8\001\r\"f\273+\263\n+\333\024\324\330>\307';\302_3{\230\312I\261\002\251O\340\322\220\235\373$\356j{ y\321\016\006"
+	.string	"\310L4\314\321A\312\002u\211\273r\300 \250\222\202m\360\004J\013\273\213\341\017\270k\304\247\371f\022S>\006yB\337\007\024\002;\360\023\211\214\276P\3471\372\220:\320\007v\036\t{\037\242\257\013\361\274\257\343\274\366\332\352\312\032,\031JS\332Cv\236jw\214\362\242)J4\f\022"
+	.string	"3\241S(\206\217\241h\277\327\031Z"
+	.ascii	"B`\273cH\235\032d\300A(L\264\034,t\rG\301\204\177\031W\\\272"
+	.ascii	"\251\332\231\242)("
+	.text
+	.section	.gnu.lto_sdcardInsertionDetectInit.16.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\215\n"
+	.string	"\026\023HA0\311h8(\304ql\253{\241\362\302\345\220\241x\361\353\330\362\370\260S'\f\226\3406\205v\001\314\222%vh\b\332b\026\250\2716\200\203\001\311(\242\302\243\305\236\252\364 \200\207\266{o)S\n5"
+	.string	"4"
+	.string	"7"
+	.string	"\260\n\273\333\251\314O\3274O\376Yo\020\307\360\032\313U\233\210\340@@\304\250\322*\\`\020\234\365D\031S\231\232\214\335u\212\343\312\275\335\366\206\355\013\373\026\001\3427\337\304}\273*\205\005\003Z\250\234\331\25605\306\276\266\272\262\237\316\247\257\341\032<\340\314vUf\027V\266%\b`\373\033\237\354\tw\315\354_/'\0010\003\251g\320\342\220\235sN\342\256\266\007\222\027\375p@\201\314D\303\034!\244\304\324%\356\312\361\222\240J\013\266\301\027(1\354.\206O\340\255\021\037\3007\223\230\362\001\006yB\337\007\024\002;\360\023\211\214\276P\3471\372\220:\320\007v\036\t{\037\242\257\013\361\274\257\333\270\366\332\352\312\0321\031JS\032Dv\236jw\214\362\242)J4\f\022"
+	.string	"3\241S(\206\217\241h\277\327\031Z"
+	.ascii	"B`\273cH\235\032d\300A(L\264\034,t\rG\301\204\177\031W\\\272"
+	.ascii	"\251\332\231\242)("
+	.text
+	.section	.gnu.lto_sdcard_isInserted.17.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`#\001]\r"
+	.string	"\346\231\\C"
+	.string	"\221(\035s\024\323\032\322\364\341c4\376\204\211\231\323\373Dtm\230\376M\307t\260'\342\021:\340\177k\350\001a(\002\203u\354\274\225^UUUB\350'&Z;'\017\254\323\361\330\217do)S\nJ"
+	.string	"E"
+	.string	"K"
+	.string	"\0161pb\356\337\206\322O-\235\313\214\335\017S\r\347\036\241&\347\177u\030\302\264\202\344\201\036U\016=vW\343\215R\341"
+	.string	"\0300\0376\236\004H\300\224!\305W\317\024O\224\311\221`w\235$\317\302}\335\266\002\333\005\354S\b\276\311\365x\325\030\230\026\022\241l\331\037(\025e\037\256\262\330W\335\321i\350\264:\235\231>\200M\n\203\351$Bc|[j\331XVT\301\341\252\337>\361W\326\\\305y\200\276-\205\254\260P}<\372#\363\030\251P\021\254\264\272\013\241l}B\fJ\nr\227\252\3669\n\316E5zp\321\221W{$\313\223R\003\240\324`\215\024\224\336\213\n-TQ\376v]\027\234\2201J\032\266\037\334\304\226\331\335\003~\211\177%~\352\321\021L\362\244\307$\fJ6\217v\231\003\322\321D8\235\r\3334\017\204\217\326\301\032|DF0\216\266a \002\2349\360h\030I\226i\230\346\333\303U\026\277\003\210\033\020j\207h\325\275h\352u\032\321\275\344\317]QSlG\335t*\254\220\212\242\242l\007\025"
+	.string	"f\204\036\344\206\002i\326\202\006\201~\200$\024\354\013\371\224\201\027\212&\235f\304vM\224\247\305&\231"
+	.ascii	"\211\":TD\340G\220\320\350U\352+m\263\326\t\005"
+	.text
+	.section	.gnu.lto_sdcard_preInit.19.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375 \362\205\006"
+	.string	"\242\314-1pm\032\003\240{\375 e\313\372|J\261.J\312\3230T-\231n\022\002\242R\241\205e\272\225\321\377_\243O1ki\335\202\"62i\245L)\016S\003\007\276\250/#E\315\223(G\305\215\304\024%\307\2314\017\356E\312e\n\n!6\321E@\030\035f\336\254\352\001\005\253hgg1\214\326"
+	.string	"\377_V\265\313\022:1(\371/VTn\322B\033\230\266^\2559\334!\3551a\201\277\"\021\371\247B\023.n\235&\210\334.\036\210\334*[\024O\215\033d\304\"$\345\277c\031\226^\262\366\207\003<\237\216\227\205\341\177\227\347\003r\231\333\"\264]h\013\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sdcard_init.20.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\204\001\315\017"
+	.string	"v\035kG\340\262(\035P\262\b/&\362u\207hz\211\240\f\006_\326\353\0049]\304\252\0061P\235=s\024\240\270\267V\317r\003\331\364c\025\005z\033\355`\n!\3069\362X\271|\007\020c\234\335A\351\365H#d\313\235RY"
+	.string	"P"
+	.string	"Z"
+	.ascii	"\366\216\323d\373Z\016\r4;\273\373\351\207\247\336qSe\312\227"
+	.ascii	".\030\254\034\333\250z\367rn\202\300\330\334Bc\206y\340&\303"
+	.ascii	"\0014\256\310y\022'\340\242\251\345\330F\227\353\f\261\341A\007"
+	.ascii	"hdM\003\257\032.\241\261%\345g\301\356Z\212\243\353\376\334\266"
+	.ascii	"\311v\002\3734\002\276Jw\356:\302"
+	.string	"\"\34253[\311\036\233\246\222\032\263?ww\2550\373\263\3773\245U\245\245\224>\200\006\273\303c@\316.K\217\217\305\341nB\200l_\332\037\361\231\324g*\017\260\013\233\341b\227\206\300#\3369\323\036\322\235\363\016\322\235s*\372\240\206c\205Tu\331\360l\230\032\263\n\224\210lwu\321\257\271\255\344\b(y\021\325\2358\n\224\037c\023(/\202\3359\0072\031\342\213'\333\226\335-\300\240eGG%\177\034\204\370\302Q\215Y\217\241\273\n\250\335h\311\036\266%\334\304\311\333m\225\370%R(x1\347\002'%\b(\240\250\263\210d\024\232\210F\247\357\024\222*\224\302\321\207R21}\242\360\364\221\210\030L!\205\337\004\020\f?\020m?Wa\2361\226Gg\245\254.$}R\367Q\253ZA\207\025U\331>y\013\013\336\356\226\3705\027J\252\334\r\013\036y\223\201y\301i\314).\003\035"
+	.ascii	"3\241a(\006\210\003\3032\001\254\021\265=\0307*\267\366\252\314"
+	.ascii	"\006\254W\n\316\340\354\b\263\305\n\230\323)\206\321\330\027"
+	.ascii	"\321\256D\013\\\177\353\022:\216o\246f\026\026\200\353bW\263"
+	.ascii	"\032\r\334%SI_\204by.\005\005"
+	.text
+	.section	.gnu.lto_sdcard_readBlock.21.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\275\f"
+	.string	"F\230XD"
+	.string	"\2216\035\330\372\277f\215\025\3705.\234\032\353;\013Vi!\250\001\214D\032A\337\340b\264y\252\370\243i\253ZTo\206\247&\244\177W!~\367\r\204&"
+	.string	"W\260\342s\206\025\021\337\272\331\335M\356\224\002D"
+	.string	"H"
+	.string	"@"
+	.string	"\327\256\206\225\025\273\341\001\033\260.;\0270/\253\007\230\227\266\215 \001h\323\303\016%GI!)Ac7\304\224\303M\217&\377&^\201H\211\20129=b\030\354\256#\312\344\302\255\267M\3006\004\373\036\001\363,\277|\352\257ft\224\321\317dZ\300(\340b\267\344\245\306\276\220,>\330\006m\215\355\022Rmvd\203\f\007U\213\204\001\233\035!\261\262@\303\217"
+	.string	"\317B\341"
+	.string	"vOf|\254K\207V\214\366C\\\004\370T\210\003\227*\310@\242'\333\243\253\370\254\335\375\370)*pX*\245y\031\365J\375\304Q\224|\025w\037\361\250K\377c^^9\0360\210\304\027;<EE\261_\355\356ZOlG_w\3711o\371\003\031H\326`c\244e \022)\323,\217\013\205J\2409\201\333:\036\214\264\216\004\312X\363l^\246m\037\366y\\\004\221\267a\035\242\214\003\323\274\017\363p\334yp\036\006\322u\036\246\t\367\276\264#\242\026\254\211\030\235*\265RG\r\024"
+	.ascii	"\005\013E\231\001a\230\001v\272g\231\020\312\270\206j?\270\320"
+	.ascii	"`\315\3023\230\bF@\270\2400\030\006T\b \374\246\246\300=\204"
+	.ascii	"\2519\246k\222\001"
+	.text
+	.section	.gnu.lto_sdcard_beginWriteBlocks.22.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\245\n"
+	.string	"\026TJA0\247*\035P\034W5T\230\207.\260'\260\212_\214\277i\240\247\311\366dW3\317\250\343\264\017]\325\035\327\0209F\314PF\244\320R`\206Gi\200\264\206X>N\204\342\243O\b\331{\357\224\0027"
+	.string	"6"
+	.string	"7"
+	.string	">\200\0078\031EG\024\026\202\013\366Q\240\301\356\330i\276\240\275\322+h\257\363\344\250K\224\177\001\247+*\007V\254\324\345\346\331]\313\025+\344\236\267\335`\333c\237!\266\364\366\361\257\217\375\224J\313)}\356\302`\301F\266\0132{\260\nj\002\230\355\223\215\261G\023M\330\016\223\221\216\224\217\231l\331-q\200`wt\360\206{\265\035rn\363\201\304c\246l\203\227ep\273\333\361\rl\\p\257\222\366*\247%\366\001'P\362_\026I\362\253W\237\244\275~fRDTrf\217)9]\366\351\316\226\003#\021\t\204\320"
+	.string	"}\242\210\t\017\244\220\270\330\343|\341\307\373\304N\fA\030\241\360\353D\241OE\347\205b\307\311\030\264"
+	.string	"\205\335\b\004\303\0163\356\351\316\32665\252\311a\213\254\223N\007\017"
+	.ascii	"\3442Pfh\253\201\263\266(n\023B\250\340\032\352>\327\360\346"
+	.ascii	",\312\304\004\bL\004#\200\n\030\374\314cj'\031"
+	.text
+	.section	.gnu.lto_sdcard_writeBlock.23.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\235\f"
+	.string	"f\227UC \217\223\016#ln\t "
+	.string	"\270\302\222\376\342\217\324#\021\222z\001\352H\201\250\212\200\213B\3066D_5\304\3053\202\365\362\t\221\b\340@a\204\247)"
+	.string	"P\355@n1\375\030\3166\"m\357-wJ\001@"
+	.string	"E"
+	.string	">"
+	.string	")v;\003\326\240\036m\373 \256\022\262\bv\033J\001L*&#^\354vV\306\007\310Gx\001\362Q5\\\364'\362O\342\360C\007\027\244\322\350\017\223`w\375H\245\n\267\336v\001\333\r\354\317?\346,\277\374\312\037\177\372\241|~\361\371\231L\f\026\032-vO^`\354\212\250\302\203\355\220\255\261[F\340fKL'\013 \013\004\027\004\332=D\350+\022\bl\266D\304\005\216\216\362{?\215\270\332\315\340\022\032\025\252\237Vz"
+	.string	"\203\211\216l{\216\202\243v\227\303?1\341\203J\001\311\307\247\325\351%n\002\344\247x\013y'=\372!\362\361\312\341`\201\344\275\330\335\350\251\311>\\E\261\375\\\275%\227\310\245"
+	.string	"\200\007\273:\237\317\205QS\353\350"
+	.string	"ud\004-\003a\340\301\266O'cl#\233\027\226q\0267\265\007\0363\263@<\256\017\013\233\234\265\301\361\346@\233\226\310\266MK\323\355\341*J\245\031$J\301\232\207Q\031\030"
+	.ascii	"\005\013E\231\241\265\006.\320F\371Y!\204\n\256\241\356s\r?\205"
+	.ascii	"\r\250\265P\316`\030\f\003A\200Bp\031\030\001*.\020\036\fk*\004"
+	.ascii	"\356\026\241M\360\323\031\2230\311"
+	.text
+	.section	.gnu.lto_sdcard_poll.24.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\235\n"
+	.string	"&\224JA0\247*\035Ph\3776\310\353\304>\030^\373u\252\367?pb\321\024\271\321\321\250L\314%\024\304\376\377\347\260\330\216\rr\203\206\016TR:\t\307&(\021\f\005-\265\360\263\210\302\304\022\"eJ\0019"
+	.string	"6"
+	.string	"8"
+	.string	"/\001\037"
+	.string	"ls\222\337\226\\<\267*\372\245s\235\251\244)\0300\206|\271\205\026\201\022aDq\23126r\331U5\236T\275\315\234\323\232\032Yww\333\022\266\035\354'\004\335\367\2627\260J\024\021\223\336l\262\244\373\262\317\315u\331V{V\357\252U\325\277P\200\330\030d\016\314\271\272=\230\b:\003'\266I6\306\017\020$\213'MV\017\334E\255\353\355\004\311iK\2663\256\322\021\341\223\036\341e\316y\330;]o\245l0\3232\326*\260\036Y\276\025\264\005(u`?\345\263\221\017\363\206H\237z\347\213,\017\356h< \247\343\t\277\020\374p\200@\317w\001\342X|\0350\3744\f\016a|\300O#\024\002?\f9\317\315u\331KP\013PS_\264\\v\205\365vWe{\327\033\323\236\002\016"
+	.ascii	"}\204\216\025\341\013\266\267\020:lY\027\036\032\261b\342\260"
+	.ascii	"\240\0139\034f\245\r\226\3075G\225\016E\255\202\002"
+	.text
+	.section	.gnu.lto_sdcard_isFunctional.25.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\235\n"
+	.string	"V\024KA0\247*\035Ph\277[\315?\332-\273\032\213[\335\352\347\025/\026M\221\033\035\215\312\304\234(\352{\331P\016\213\355\330 7h\350@\345\341\220pl\202\022\301\004\303K-\374,\2420\261\204H\231R9"
+	.string	"7"
+	.string	"9"
+	.string	"o)\020\031`\233\263\374\366\344\342\271U\321'\235\353J\265qV\200\034\371r\f+\003\262\004\322\304A\310^%\207]Q\344\250\352i\346\234\326\023\251\272\273\333\256\260\375`_!\226w\337\303\356\240j\360\200\244\2447\273$\351\266\354ssY\266\325\236\325\273jU\365/\027\245\315A\304l\316\324-\302\\\320%H\261=\2621\226\230\030Y|\211\222\n\334E\255\353\255\205\311\270$\333\034\007"
+	.string	"B\341\227!\341e\316y\327;]/@M%\246\262\327\n\301n\313\027Y\276\030\002h&\205`\177\3451\221\357\262GH\177z\347\207\002\346d:\340\206\323\t\277\020\364||\300\316\247\361\331d|\0340\3742\r\006mx\300\257\003\004\002?L9\317\315e\331c@#p@}\321r\330\027\326\333]\224\355]kJ;\006\r"
+	.ascii	"}\204\216\025\341\013\266\267\020:l\255k\304\223\344\007\261"
+	.ascii	"]\023\341\260\320m\210<\356:\252j(\272\024\024"
+	.text
+	.section	.gnu.lto_sdcard_isInitialized.26.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\305\007"
+	.string	"\"\31755P\215\322\001$\307#*\241\352z\254)\325\253\375\342\314EY\351\271\325\354\327_\317.\306\230&\334\341\215)33HB\272\357\240\213r\306PE\030\331D\312\224\002\3160-R2\215\203\\\254@X\242\006\027,\024\005\230E\016b\023o\f\225\b\035\266-\302\253\333S\253\241\247\002\034\355\330J\247>E\260\350\350\306v\303;\"\254\335=\360;\t\316\032a\252\277\324\200\3229^\302\370#?\\\362\236?\377R\375]'\031\025\234<\331\335&Ud\237Z\r\331N?Mg\246_]#!\330i\367s*Y\220\367A\262\235\261/\027\030d\254y\207\361\271Hd\302\203d\267\203zq\315S\343\177\343\224\006\311\344\001m\236"
+	.string	"\t\273\353\364\200(n\275\355\001\333\004\266M\001\013"
+	.ascii	"2CK\r\\\221\305sL\\\241\202k\250\373\\\303wF\274%\004\tw\316"
+	.ascii	"\324\316'"
+	.text
+	.section	.gnu.lto_sdcard_getMetadata.27.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"m\b"
+	.string	"\026\020;8@\305(\035"
+	.string	"\272\337\030\3455A\030\313F\023I\"\027\233c\205\341\260\003\020\201\331z\365\270\203\r\246,^e*\253\242\350\210\276\273\025\002\026>\304U\200\b#\233H\231R)"
+	.string	"+"
+	.string	","
+	.string	""
+	.string	"v\343s|\001v\227\235"
+	.string	"\273S\215\207\236!\377 \277:V+%\223\350\031\300\260\273\316\222\351t\353m#\330N\260}\022\242\324\224\375k\025e;\3554\235\231>\246\261R\236\312\356E\213\265(\316de\033dk\276\307?@\016\031\304\215\323@*\200EI\013\031$\025\331\2068\tE\266\273\n\376H\305\226\251>\330]\252@\310E\036?\276\312\022\236|\351\316\367`wW\013\007\306([v\f\316\\4\020\223\321lo\203\233\t\016\324<\007\016\246\341e\340\366.\026w\0366\360Et:\360iq\177\255\242\234\036\214\224\344,\235\3524\013"
+	.ascii	"2CK\r\\\221\305\257L\\\241\202k\250\373\\\303gG<-\004!\356\212"
+	.ascii	"\251\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\017\001\235\006"
+	.string	"\204\b\013\002"
+	.string	""
+	.string	""
+	.string	"\002\017\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\005\016 \201\204\001\020\177!\002\021\177\"\002\023\177#\024\177$\005\022%\005\037& \025\177'\026\177(\027\177)\030\177*\002\031\177+\032\177,\002\033\177-\001\035\177.\377\037"
+	.string	""
+	.string	"\200\200\200\001\034\177/\036\1770\003"
+	.string	"\020\331\214\342\221\002\001d\003"
+	.string	"\017\244\001\003\002\002\003\021\004\005\321\231\263\346\002\001\225\006\004\bu\004\t\n\013\001\004\f\r\016"
+	.string	"\037"
+	.string	" KR\344\266\224A*\037 \214E\034\312\f\nr\003[\340,D\313\360A=|\200\374\320R *\030.{S\321\031\35012\037\001\364"
+	.string	"\337"
+	.string	"\337\200\037sX\302\206a"
+	.ascii	"z\354\374\bW4\0014\210\342\322\256s\f"
+	.text
+	.section	.gnu.lto_.refs.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375 [\035\002"
+	.string	"\024\003W"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001\004"
+	.string	"\002\002\003\003\005\001\006\004"
+	.string	"\002\007\004"
+	.string	""
+	.string	"\006\005"
+	.string	"\001\b"
+	.string	"\006\001"
+	.string	"\001\t\n\013\f\r\016"
+	.string	"\006\001"
+	.string	""
+	.string	"\007"
+	.ascii	"@\004\334\201\306\200\b)\267\001\271Z\224%"
+	.text
+	.section	.gnu.lto_.decls.474b1be973bec565,"e",@progbits
+	.string	"(\265/\375`\276 e\220"
+	.string	"*\345\3142Q0\220J\352[\017\312\034\217ExL\327\273\314\361\367(o"
+	.string	"r\275\020/\202\215_QU|\0264\201\244\200U\313\242\350C\310\244q"
+	.string	"X\323[y\307\343qK\273\230\003\214\312\220\001\271"
+	.ascii	"`\016F\253>\022\032\226\334j3\"\314\025\227\277\311\226)\245"
+	.ascii	"\274\002\026\0031\003\312O>\221G\277\350s\373\324\317z\205\346"
+	.ascii	"\254\364\271\t,\370\"O\343M|\252\204\201\222\255*\005_\344u\336"
+	.ascii	"\326\263\311\371\251E\2253\264\335\354\213\234\316\327zIhfb\300"
+	.ascii	"D\307S\\\316P\023:&L\230@\321\243\031C\304\332\217\005\367{\341"
+	.ascii	"\376,\334o\205\373\201`\t\034M\267\273\371\233\237Y!g%O\254\254"
+	.ascii	"\311\217_=\316\345\332\317\270\231\354g*p\236\311\231\3139\231"
+	.ascii	"\343\236\200{\002\253\022(\"P\330\265\377\211\235m\247\275\314"
+	.ascii	"\332\243L\r#9p\t\037\301\356<\004\213b\214\223\361h\t\257\266"
+	.ascii	"\263\271Y\333(\241Yj\003\306\315\351\353\327~$\334^\202\315\361"
+	.ascii	"\022l{\035^\235\212\333\255`\007\343i\036m\300\325\332\2758Z"
+	.ascii	"\357\222\320\f}\2514O\242\277\266\203\341\366\006\330[W\347\r"
+	.ascii	"\260\355Z\370=\004\373\001\tv\035\017\301J\340!X\004|\004\253"
+	.ascii	"se0E\211\374\272\305\243\316\305\257\264C\233\202\356\035.\216"
+	.ascii	"\305\265\220 \312\371\207S\257K\212\021\216\270\234\263\216\t"
+	.ascii	"v\311\n\315h]\333\265x\025o\262B\316`9g\001\256\r\260h\325\257"
+	.ascii	"\236\303N{\226\016\3012\225\2409\207\245\223\243\361\365k\316"
+	.ascii	"\f\270]\300\035\204=\373\b\366\003\264\035\301\272\330{\230K"
+	.ascii	"i\027s0\236\322\305\326\234\223\356\t\364\334\023\330Y\031\222"
+	.ascii	"\214\262k\373p\257\300=\246\346#\330\366h\213q'cV).9\264~\355"
+	.ascii	"\017p\247\300\016u.\217\032\340\322\236\300\202\276\310\256\234"
+	.ascii	"\22534\007\207.\t\035\232_{\002\334\336\325\001<\263\005\215"
+	.ascii	"\203\333\r`\275\316\r`\373qO\265\272}\211g\265\230\273<r\346"
+	.ascii	"\257\234\241 \036\311u\225\345\327\206\372\b\026{\b\266\333\225"
+	.ascii	"\272\375ii\f\221\347\225!7Xy\321\355;|l\272o\261\333y\030\311"
+	.ascii	"`\350v&\030.t\367M\367\245\241\333\2355L\201\352v\032N+tN\367"
+	.ascii	"]\352\357\276:\272\275\202nOc\343u_\034_\315n/\013\323\355h\324"
+	.ascii	"nO\261\326\335@\335\353\2763\272]\255\333"
+	.string	"\275t\273Y\267c\351\366+\335n\245\333\253t;Y\267S\351\366)\335>\326\355b\335\016\326\355Q\272\035J\267\177u\273W\267K\273}\251\333}\272\335\330\3550\272\275\206n?\352v\037\335\016\354\356\260\356v\322\355[\335\336@\267\033\320\335\325ng\322\355E\272\235\203n\237\352\366!\335\216C\267Ku{T\267\013\351\366\037\335\036\244\333\201t{\260\333;\350v\236nW\321\335Y\335\275\323\335[\272\033\247\256\256\256\256\373>\320\275\243\321\255c&\353\362\255\360\334\340\232\302~m\270\033\303\303\330\262\310\0167\306-z\222\352\242\361\253\022\272\3132\367L2\203\243\227\350&\273;G\231\031\271R\303]\303\005w\337\\\347Ay%\212\231\247\353\2573\3622\307\364\353\247\231C\023E.\216\345Re6\305L\177\234\2073Sp@\376\372e\274\315\006\215\211\232v\344\255\337\255I.\215\214'\323\357\366;\340\330"
+	.string	"+\223\374\352\267\365\250S\346\274vT\307x\333\315\216\253\250\242__\314?\3318\371b\252\373\365\331>\310\3154\222[53p\263ip\263kji\033\354p\344\243\341\372\323\\\314\246\310\021\250\243*_\274\3344o[3~E\203\336P\375\310\202\243\t\356\207\022\345\303v\314\036\313g\331R\365\255,TO\304\316~\372[^\207\357\362e\317\345\265x\364\315\336J\377\025\037\353\025M\354\303\300\252R\236\f+J\365\355\313\354\253\3345\247\233\022\254\234\241&j\334\346\320\312"
+	.ascii	"X\275>\207\2661eX'nv\007\346\261G\270\331\"\374c?\305\243:O%"
+	.ascii	"\307\273\020%5\321\341\032r\235\353\260\2753\203{\267\366`k\216"
+	.ascii	"2\037S\277\366\356\f\367\216\f\353\370\b\266wP\334;#\270\373"
+	.ascii	"\235x\355\242Z\224$\177\365j\342b5K\256@}I\323\300\314Y\275}"
+	.ascii	"\216#\316)\231\372\024\307\304\267\222To\034\231\232\275\016"
+	.ascii	"oR\301\221<\3678\216PQ\237\342\336\352\231~\nI\242\b4\351\233"
+	.ascii	"6\036\250\312L\254\334\313\277H\020-s\222G\211\253\267r+^v\241"
+	.ascii	"T6P\240\244\2526x\333\345bb'Q'\035\372\255\274\313#e\033(\252"
+	.ascii	"\234\324\2478\253W\312\311&\212\"S\352S\034\327/\371\252\357"
+	.ascii	"z%\217\365Y\017\375$\317\344\243\277\365W\257\345\321\267z#\375"
+	.ascii	"G\036\311\023+\217\342b>U\312\310\266\005\256\230T\023\275\252"
+	.ascii	"/Q\272\016Xk\252;!\270)h\372 $\210\226=XtY;\252\324\215M\275"
+	.ascii	"\020*sU\252/\362D~\310\343\340\321\237\352~\033\277\324:YS\037"
+	.ascii	"\205\206j\352\245\376\311\247J\320l\343F\212\223Z\202L\031\225"
+	.ascii	"\267\366.\343^\341p\257\324\007\342_V7\244Np{"
+	.string	"\364\177\274\217^\225\"+Fz\364\373\3501\274L\242GF\313\013\314\257\357|(3I\264\252\374\372\317\207Jy\216Q\361\370\033\274\r\247\356\f\224\344\257\357\364O\2747\2504\371\237\274\tZ\331\021\321\257\r\347m\254Y\215\2713\277\366\n\004\367\312\204{\235\201?\3372\270\357\032\356{\206\373V\301}\241\270\257\020\214\200\207`\237\311s{.\225v\340\257\321k\227\023\347&s\224I\301\201\217t0\034[\030\332\257}\225\270}L\214\267\371\364\213'+Ju\207\356\235/r8G\343S\245\025\311\223\252\207\001\243\262\200\032\206\366\305\327|\032D\203,)\325Gz\223\336\315\371)\207\030/\343\227?\343i\274\321\007p\037\367T5b>\210T]p\242>\3713\177\346\353DX\251\241\222\335\322\306\332\243w\354\376\270Kg\266\201\001\231\222\003\367G\031\327Y\226X\364\212] ,\323\306\b*\207jf\346\340"
+	.string	"\216{\033sE\004\211\274\314\017\231\b-\f\325\256\006\227\245(\277&%]\346\022\036M%v]U4\304~\205\002\345\323D\\5\247\350\342n\020i\324\027\247\257\257+u\245\f\242OU\336\rRX\240~\355\033\"\257\366\350\365\272P"
+	.string	"\230\035D\215\252\231\251\344@\r\025\024\033\321\034\356\313u\273\372F;z\2458\347\254S\344l\212..+)\225\300\3241:\033\244\273.H\246\240\374\3326\321v6'\2319g\033;hf\022\361\332w\356%\272q\374\272\002\335\275v\233\230!\347$\226 o\370\210\224\344\016\004r\357\2469+\237H\r\236M\345S\307R\372\314H\345\024\022\0043?\221Ki\316 \262R\211\344qf\020Kin\346\242.M\317\320'2+\235\031DV\346$\002K\345\263\271\224&\233 \226\322g3K\237\371CV&\2313\224\231\t\"K\237mY\352l~XJ\235\315\245\364\031\345PfHY\331\270\022\304\207\224\237-\2259\t\251)\311\3740]B\235Y-g\377\212\221\231\n\344\334\344d\252%u\370\030\3214\211\b,\351\034"
+	.ascii	"\211\b\312\231\225\323%\022g\316H\210~2R\005H\3504\013\361)\262"
+	.ascii	"GS>\212\2213\001H9#=Os\316\310\234s"
+	.ascii	"\r\263\t\2323\323\207%\025\022R\316J:H\271\t9%F\316\377E\035"
+	.ascii	"k.\245P\316\235)^R\252,\003\212t\252\254\366db)\222+\037\271"
+	.ascii	"a\252\346\215\035~EaK\324\226\273u\231\364\300\302\245\374U\271"
+	.ascii	"\013\323\222E\201\225V\365\352\311\260\236T\221|\330\026U\025"
+	.ascii	"\023\254{\344\311zHh\256Q3\003\031\305\224u\223\334%W\311\325"
+	.ascii	"\362\350\305\272\311v\023&xXNVM\336\332x\0167v\303\215\327pc"
+	.ascii	"\035p\343+\267\310\r\227e\221)\257K\005\275\221\321\224%\307"
+	.ascii	"\324e\342)\261!\007\326\020\265\336\033\327\025\0318\274\341"
+	.ascii	"$y\262\324\224z\271\336\017\262.gT\316"
+	.string	"\241\002\306LT\bRM\222\020dX\020 7T\346\rC~\375!\345Q\227\366\253\017\234\250',\243+\334\335\367\206\013u\235\267\351>\357\216\313\343>]'\217\336\036\327F\337\033\327\0060a\376\rE\f\246M\r42U\26237g0F}Zc^\034\227i\013y\221|\252\364!+\243l7\3516%\320\242\242\276\332\003[\267\307\303\275\034\024\006ZS\235\265J\254\254H\004\323\222\315\222\\\022\036w\351*=[\023\242$J:\360\r(6\220\035\335dE\241\313\034\237{c\344\300\340z\340\025\372\205q\340\313\344R\365\254\321\2279\303\223%VFWFme\2776\216\201t\217V\271!WK\227F\337#\343\322\331\331\257W\3065b\032\341\241e\324wF\222\022 R\320\240\331LY\345\003\301_+\002\213\036\226E\017\333?\021\020\205>\242\360\206EO\b\036\260\350\341\001\035\205-x\301\026\304"
+	.string	"l\003[\236bk\034\366\024\320@a\261\035\266>\270+\270"
+	.string	"\202\013P\300\250i\024)$H!\001\333(R\354\354\244\270`\007\367\005;\267\177\"\020\n\031}\306!\027:E\334\002\260\005&\032\205B#q\205\315Q\210\370\013\342\201q\304\255\257\330\016a`\321\002\213CDc[\3149\036[\037\037"
+	.string	"F\337\b%\264\305\336q(\fA(d\354\035\205C\341\257-\372\206B\237\326\205\257\365\031\207\004\200\001\004\020\020Q\310\007\364\033\016u\020\"\330\312 \004\372\t\217\302a\217Q\350\023q\354\037\037!\001Z_\033$\256\340\265Ab\320j\364\371\b_\f\211*z\277 \236\3268\304\262-P\370B\033d}~#\370\374F \nk|~#\034\201-P\333BH\370\003\304\001\240\330\n_\b\217\3036\330\363\013\n\342\034\201\204\202\204\276\004\212\355\213\027C.X\02770\332\340\260\247\205\341\320\017\360\006\350S\321\036[ \241 \242\n\237\002\255/"
+	.string	"\374;\376xZ"
+	.string	"\376\\"
+	.ascii	"\001\375\200<\026>Cap"
+	.string	"\330\n}h\203\204#\034\213\277c\213_\261\025\"\002p\034\016\021U\264\305! \341\357\005oH\024\326\304p\024\002\177B?\025?>\302\037\336\021F\013B\210V\204\366(,\232 <\002\r\005\005\320\372Z\340\264\307\337\321\270;\366O\004$~\216C\342\212\034\243o\305\007c\013@\"\320\006ACC\033\236\236\240\226\270\343\351)\266\305\241#\360\367bh\370\013\352\025\177?\300\265\r\372\201\340\341\350\233\200\002\240\237\260\330\266\300)\022Y\370\025\211C\341\212!Qh\024\276\320\212 \342\350\273`\007\027\177\355\tCAbQ\250\367;\266A\270\177\202\303\337\321\350c\240\211Bm\361\304\221H,\236\360\360;\376\202\353\321\307\323B\205\207\240\021x\203-\220\213\337\260\255\001\"\0227\360\355\202\355\261\330\2760\354\031\022\205A\020G\037\213\236u(\f\341\bl\217-\017\316\321\207\3428\024\016\325\364\316\216\n\004H"
+	.string	"\301\003\f\214 X\374\001\203\306\023\306b\373\202\260\030<1\024\376\202N"
+	.string	"\213\306\023\021\024"
+	.ascii	"\324\016\207\277\037\025\277\240\340\r\231;\346\006\0176\352"
+	.ascii	"\257G\370"
+	.string	")\311\251J\314U\273I\342f\220\261\231i)\372B\026\306\013\017\211\210\214\"*T\n\t\321\227_\301\200\271j\"\246\360\270b\212\333!m\001\213\272i}\325n\214\320\234 }\331\3100\252{\376\332\036\212\246\323\353\245\005\362\212\t\253\247F%\356\311E\353\353eNH2\372\353\355\342_7h:t\310\277\336\263k\344\252\351\340\232\363&;\2502lR\350pg\311r\315\274+\327\320!;\273b*\341!J\220:\251[\326\327\214M\203\343\202\372\365r\361\257\2524[A\266\254HF\272n\374z\265\344\210\271\202\303M\013\356\2330|q\\\034w\tMU\256\210*\006\0300*\234\365\234L\232hkk)\024\231\242\303b\315|\3119=\365\251Y\206K\232k\277~\230\017\363n_\262\236@\365\360\372\365\341>\202\252\250r\321@\t\002\235A\204Hdf$I\222\016\242\n\020\004Cq\036\310\230\007\022"
+	.string	"\024I\221:\251\310\314\210\210$I\222\375X\003+\341VH7\276o\200O\262z\\\210\351\266\312\275WP\212y\006\272"
+	.string	"\337\206\272I\274\367O\177\342%\342\255\355\016\210H\277\345e\352\262>j\373\017\274\177%=\345.b`\312-E\202\264\231\304XC\362f\276\023\304\257F\305P\022\371\024<h;3`x\032F\211V\256\317\243\210\207\342\333\272\245a/\027\234r5=B\214)\\\343Z\310\354Kg\261cd9\273\243\264$:\276\244\301\277\273\216<B\3334\347J\"\276\335\366OIw\340\326\007\214w\004HAu\025\332\361hr;xw\353\323*\376\272\235\364\206\300\016\341\200\354\206\353\270\316\350FF\006K\3510QTc\003x\351\r\323\361\221\006\033\017MC]P\002\004-\245uH\214\223Kf\314\024\271q@^\031\224\263*C3\237{\"\325}n\273\002_\351\341\374\350\263o\226\177\005Xm\3752\356"
+	.string	"+\240\t=\224\214\026\256\337\273A=X\3204+\\\230\362f\322\001\222\242\002>\261\0245\247Qx\366\025\034:\246A\233\3464\237)\243\300\246\356JQ@\031\355_i\002\247XE\374\265&\353\300\002\020n+m)\301\004!4\276yC\325\361\244\351\306 \307_\235ip\247\255hx|^\335w\013\236[\343E\007\352* \370\223\255\n\235\004\314\241\203\320\331:\215;\216"
+	.string	"\350\311\341\2514M@\300\364\362\3461\001\351\302\255\016\035g\tg\312\304\361\017\353\272\302\302\277~2\204\320\345\352\276\264\241\252\241:\034\321\016\244q\202\3001H3=\n\322\321%\357\254\272s\354\236\003\265$\2100)/\233\306\353\223\314\311\252\320<\311\242\025\317@\237Y\200\326Tt\262\256s\020\204\227R06\016o\254\215\004.r\344\273\371/,fV\356\022l0~\244<2%\240\236\036]b"
+	.string	"\211\260\253\316\353\325\335\262p\361;\356]\213i\340\032@\347\316lWO\350+\273\321\324\003\315\312\310;\322\\\365\016T\333\367\372,\243\366_\004\020\313\\\211;\247n\240\262\233\220\215\"*x\251\f\203\257g\006YD\317\221\351\317\330\241\204\354r\030\214\006Wd\220\205\b3\tK\263\343\236\217\2461\316\204\302\363\277[\001\350\213\013d\004.1"
+	.string	"\361\273RD\273\2325R\231/\360&\357zU\330J\001\t\232q\313\275\333\201\205"
+	.ascii	"[\033\307\337]\306\351\251\204FuA\302\356\007\364O6\322\371\273"
+	.ascii	"q\327%q\340\345\325\032`\235\306\377\211\321\231\327\241\244"
+	.ascii	"\221jl\323\211\376\2300s\251p\005\023\200\326\244\312nc\375"
+	.string	"\331@\341\035\305\271\b\272%B]\222+94\034A^\301I\005~\315\006\256B\243e\233(\307u\003\240y`\210\226\262>th\\\336\246;\274\005\356{\227\005\360\313Wo+\361\021\215\320\264\266Q9\034Db$f\013\317\376Dv\211\362\037&~\304F\345\372I}h\361\211\326\270\323p\257\026\353g\242\001\242\234\361\264+\006\273\223\347\360\262\017\"F\016\207\356\016%\226\037\341\334\244\002\":\312\202\255^\260\314\225\t\371\222}\221\257\264\t&>\323\362\227|\b\231X\374K(\031\301m\345\261,8\031\214\304\311\013\371\333\347"
+	.string	">v\"\233\320\207`\256\023\233\002\332\322\271T&h~\r\374H\217&TG\t\2209\257\355\252\262 \0266\251\203`m\315\215\224\217\264\343\202\321#\356\240\222\360\355\217i\216\\A\025\250\224\202Go\276\345\252[\265:\006[\260\244\335\214\332\222W\360_\0035\214.c\0048\276\317!\260\323&\253@\332\353\027t\347\024\341\311S\256\277p\234\340\332\262\233\"\321E\366\202c\235\373\345\330t\257\032\274\333\2508\020N_\304*\020\207\002w\326\253\342\t\b\001"
+	.string	"\224\200{]e\214\323\001\337B&\346\217<2\336\276\321p\224\206\351(\257\206\177\330`\351}"
+	.string	";s\314(\255\"\347\204\027\230\003k\353\241z\343\"]\036 \324\177w\347\022c\221(U\231\274q\207\372[\006\027z\343\227\300\201m&\372\344V\331\312\246o\244\230\240\\\340\007\255"
+	.string	"w\357\036\273\354\327\007\200!bB\340\3318^o\364\016\367G\340\300\034\353\320Ln\357\370\037yz*\262Rd\340U\bV\"\b\023\343#\272\177V\370\035m\035\361O\367$\216\225\352\002\301|ER\222\371zg\034\355\025\213\221)yE\034{\302\214\201"
+	.string	"S\352p\217\f\361\377\336\237\006"
+	.ascii	"\316R=\206W\360\233T>p{\021B7\243\"\352\262\210\202\327g/\\\""
+	.ascii	"\341~\367$\021\217\304\375\241\234~\367\212\337\021\354\340\234"
+	.ascii	"\276F\361\305l\ndB=\221\230\226\253%\207AB\363\352\272\205w\204"
+	.ascii	"\253\306?\034\303\247\207n\237\207x\320X4\216\225x\3029j\262"
+	.ascii	"W~\342\034\332\036J\235\3150<\034\264\356\261\321\376\374\314"
+	.ascii	"J\035&K\261w&\241\273\241\327cw[pF\360\240\261y<\363\224\330"
+	.ascii	"\267\002"
+	.text
+	.section	.gnu.lto_.symtab.474b1be973bec565,"e",@progbits
+	.string	"sdcardInsertionDetectDeinit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"sdcard"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"sdcardInsertionDetectInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"sdcard_isInserted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"sdcard_preInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"sdcard_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"sdcardVTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"sdcard_readBlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"sdcard_beginWriteBlocks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"sdcard_writeBlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"sdcard_poll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"sdcard_isFunctional"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"sdcard_isInitialized"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"sdcard_getMetadata"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"sdcardSitlVTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.474b1be973bec565,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
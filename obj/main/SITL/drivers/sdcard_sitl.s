@@ -0,0 +1,769 @@
+	.file	"sdcard_sitl.c"
+	.section	.gnu.lto_.profile.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"5\007"
+	.string	"\324\th\001"
+	.string	"\020"
+	.string	"\354\301\314\336\005"
+	.string	"\001\203\332\333\334\002\n\002"
+	.string	"\002\001\002\002"
+	.string	"\002\001\003\231\303\301\271\n\016\003\004"
+	.string	"\002\001\004\236\261\333\245\002\002\005\372\330\3009\006\256\277\364\252\001"
+	.string	"\007\240\266\263\351\n*\005\002\005\006\002\006\004"
+	.string	"\002\001\b\353\252\315\223\t\t\240\342\234\212\n\n\311\334\321\374\005\004\002\007\013\315\260\337b\f\006\002\006\f\r\223\304\327\311\013\f\002"
+	.string	"\002\001\016\322\235\250\213\013\004\002\b\002\b\002\t\002\t\020\200\327\255\214\002\030\n\002\t\002\002\001\002\013"
+	.string	"\002\001\021\234\223\266\351\004"
+	.string	"  \200\202RFvz13`\022"
+	.string	"X"
+	.ascii	"!\365h\363\233\200\2721#\0303\313lm\373\021c\013@\t\200*\005"
+	.ascii	"5\306\274\21159C\313\016Cw\254\023@1\206\017x\204*O\233\026\207"
+	.ascii	"|\317\314Q\3727\254\230C"
+	.text
+	.section	.gnu.lto_.ipa_sra.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375 \270\325\002"
+	.string	"r\204\f\025\260%i\f\f\0038\f\3030d\222\255\265\002&\255mId\n_d\031e0\236\036\302L\223e\004\200q\013\325%K\354\260\263\263\035\022Yj`!\020"
+	.ascii	"9\322]\017\273`9Wf\363\002\322\326nXDE\364S7@\343\3145<\345\007"
+	.ascii	"\260\024\350\004d\277\001,"
+	.text
+	.section	.gnu.lto_.inline.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\250\001\225\n"
+	.string	"\222\31646@s\322\030s\240\200njI>\\\376\345+q\334\244\310#\\\\e\005\307\2542\226a$\326\252\255\235\254\001UU\024\305$\241\237vO\266\251V\304\210\335R\312\024\377k*(%:\231\026\301f\320\344@\034d\fx\321+i*\3138\312w\202\242\324\300\\\250\212\345\246\26308A\\/\"\005\213>\367\264\037\020\302\221\302v\250a5BJV\262\215\230pu"
+	.string	"\203\346bN\372\2044\271\370sq.n\330\357\260#1\034\030\b\2726\036.8\223\374\301<\246\247\237'\317\357o\265\254X\002\272N\313\212\265\275\331%}xu\230<\224V\250\244\274\006\366\32743\205i\272\220z\242tg\343d\206t\276b\317"
+	.ascii	"!T\275~\232\024B\b\367\265\225\"8 \200\"14|\351\211x\207k\025"
+	.ascii	":\032D\222`T\200\217\003j\0058\320\032\270\346\022\"!>\001\n"
+	.ascii	"nd\356\244]\207\255=\254Q8\350\034\240\t\203\355]\227\257\026"
+	.ascii	"\234\230\347\206l\261\3272\004\320\306}\331\235\207\001\346\333"
+	.ascii	"d%\356\306hF \215\231\306h\225\370\031\202ZL8\266\262\340H!\217"
+	.ascii	"Iv2\n\307\025\373m\211\267q3\302\255\003\357\3244\330\032.\307"
+	.ascii	"\030\005w\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\231\002-\r"
+	.string	"\026\324D7@\255\322\001\234c8\374\260\037o\364\234X\235v\025E\2646#\326[S\203y\307H\354\352\342.L\236\242\202\374\022\364?\001b\032\266\217\372kkB\336\333ho\231R."
+	.string	"1"
+	.string	"5"
+	.string	"_\250\265\256\300\016a\020vT\\\233\256\351a\314\207\261\333\322\006\260\243m\261\341R\315\353\377\303\227-\315\226n\376}f\355\337\231U\3663\bK!\273kO\363\221_\344\017\371\276\245\220B(\263\375f\257\331\375\310\320\233\342o\212{\273V`\337\032c\373\362O\272\251\265\326\237\342J\373N\211\033\004\366\356}\022\027B\213d\367\321^l\220\235\007\232\303\271Q~\360\345(\271\211\203\017b\210\210\275\307-\t\267J\274\345\305\201\365\006L\310nj\357\261\237\344{\323\276l\254\316T\230\\\307\3525=\033\267\245Z\254\002\233@\017\f\245\317\b\025\222\370\200B$\324\250$\"q|\201\261B\300\370\242\275:\332\314\340\\\255\331\332\230\033\307Z\245,\346i\323H\251\266WE= P\242a\356\252\003[Q\036(C\241C\364!l\256Z^\247\224\211\223\200\320\273O\205\200!\256\367\025\354\006X%\214\023)\202"
+	.ascii	"V \"\202\335\245\004Y\226\022G\265\210?fF\006\r-\233@W\002\354"
+	.ascii	"l\261\366\332\257m\370E\303\020\360\352\200m\206\027w\334\363"
+	.ascii	"\203\005\333l\374X\016\0164'\330\210\253\342\021\272\216D\323"
+	.ascii	"\303\0201p\0214\007XP*\200qS\033\036\324vQ\f\200\005\025.00\034"
+	.ascii	"\244\241>\035\252\271\003\rc\027\016"
+	.text
+	.section	.gnu.lto_.pureconst.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\200\004\001\230\004\003\230\004\004\204\004\005\204\004\006"
+	.ascii	"\200\004\007\230\004\n\230\004\013\230\004\r\230\004\016\230"
+	.ascii	"\005\020\232\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\205\004"
+	.ascii	"\342\205\020\026pU\r\007\374\241\323\237\"\003\241?\226\310\203"
+	.ascii	"\321\224\201\273I\231\0023\200\300\222V\370m\215\177\345\217"
+	.ascii	"\021\263\276b2\354\312]g+oG\370\323\217\212N\206x~.\256N\244"
+	.ascii	"\375(y\271:x6\001! \200\"\232K\017-\305\031\t\272\201\343!\253"
+	.ascii	"#q\265\200#\301\350\022\0313\2207{\017\353B&B#\370yc\305$8T\376"
+	.ascii	"\250\304[\302\240}\321J\3662)o\312\323\260\360\343\354\226\025"
+	.ascii	"!W\026\\\230\250\016\342\254\207[\004"
+	.text
+	.section	.gnu.lto_.lto.94099c47f3c84451,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sdcardSitl_preInit.29.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375 \365\255\006"
+	.string	"\322\f/2pO\032\003d\003aE\035\004:u2g\237mZ\b\236\222\261\215L\370\217\224B#\240#DJR\377\037{\030$\273\263\243O\206\343\215&\233\224)\005\0221\202C\301\25003\321\211\025\304$5p\252^%7\026QN\217\0235\024\017\312\352e\022JUl\344\353P\224|\230y\267\253\b\030-\243\235\036\326>Z\003\374\177\333\325\262\001\215\003\226\237\343\305\345*.E\004\323\326\254\365\210I,\227\\\230\340\277B(\377\\(\203d\327i\203\310NrAdW\253\ry\206\334ae\343\244\345\377k \266\314\254\332&\026\370\200<f\001\017\377\313> \017\267\271\255B\333\206\266\035\001\b"
+	.string	"2\003&j\006.\234\301\270K"
+	.ascii	"\315j\312\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_sdcardSitl_init.30.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`t\004\375\036"
+	.string	"\326w\307Gp\\N:\377R\246\333\274\\\332\323\037\213\225\253\355v\234\327\224B\364\326F\340@\317\243F\357;\374m'3{d\365\033\264\326\236\366\320h\212\260\b\261OT\315\345\302\243\365\215w\244>y\032z\241\210%\233\354\235d\256"
+	.string	"\247"
+	.string	"\267"
+	.ascii	"W\240b\315\315\030:\026\r2\333X\326\311jWK\330\243\374\335\177"
+	.ascii	"\262u\207r3\374(.\314\214\205\314E\022Xgcq9[\375\374v\020\372"
+	.ascii	"\313\223oU\2210\022\370d)3!\026^\273?v2\374\262\030\037\220s"
+	.ascii	"\227\232\263\234\221\022z\002\372\333\310\0378\177\321\0278\177"
+	.ascii	"\033w\2639\362+c\230C\225\214\3139\367l\220\343\237\327\264\025"
+	.ascii	"\367\213?\323c\216_4\307MsA\327\226\234\236\343\224\271\363\242"
+	.ascii	"F\245;JUk\366\254\252\204\365\034\243L\037\267#Y\236|\235q\224"
+	.ascii	"\2525\307!\347\3345=\336x\347\336\335\300\356\256\3526[\004="
+	.ascii	"\302\250>mk\213-%\rG\r\323\264Ob\226\346@\275\362\311\022h\316"
+	.ascii	"\271\333\304\211\372\324\264N\\S\266\370*G*-\316Z\257\037\344"
+	.ascii	"\230\2657d\276H\3259}\333?{\226\346\322\007k\024\215\326hm\351"
+	.ascii	"\233O\255o.\347\225\267\342Cs6>MB\215C\274\337n\240\222\025\240"
+	.ascii	"\274R\233\262\305\356/\235\335\301SY\n\300\226s\256\320\227\362"
+	.ascii	")M}\260\337\026:\325\247N\311\023\330RGk\f\016\252.\273\221\305"
+	.ascii	"j\275\272o\227\313\345\262mW\367Y\033\275\265s\267\366yk_\263"
+	.ascii	"\266y\344o_\366W\263v\331\210q\240\306\313p{\033\254C\210\263"
+	.ascii	"2\034\3638\177\001d\271\315\330\201\332n\334\343mx\013\301Wc"
+	.ascii	"\037_\203\201\004`\373U\363\364-gQk\355P\3351\363A\234\247\315"
+	.ascii	"\331k\306\330$\252.O\313S\344\n\023\t\325\300\333\313\371\363"
+	.ascii	"\376\031\034\244\226\271\031,\004\017\271\360n#\202\303\224\250"
+	.ascii	"\031m\261yk\330\310\003\214\0045\022\305`14g\250\247}0\017\203"
+	.ascii	"\225`&X\f\213a2\354\244*\215\250M\331b/\250\327^\3714\037\205"
+	.ascii	"\257+\337E\250\347\253\003j\024\301\373\355\366@T\237\266\216"
+	.ascii	"\313\330\037\236\004\201^k\261h\214i\221\225}\211W\232\267\233"
+	.ascii	"\240v]tDdt\333\204P\210\016GAEHC$\202\204\206\214\220\212\216"
+	.ascii	"\210\214\f4\200\037\223\203\235\206\035\360E\220\270\213\300"
+	.ascii	"#:\340\355~\300\237O\310\264Cq\242A+5\005\201tO\304*\024dA\344"
+	.ascii	"Q\n\246X!L:;\t\210\351)HD\372\r}I?b\2178\004\266\b\016\177\275"
+	.ascii	"\025A_S/iH\354\0011h!\013\340\260\367$\024\016{:d\276\231mWs"
+	.ascii	"\200\262Q7s\316\371ta\346\374cC\033(\025j\251\026!T}\305\275"
+	.ascii	"\033W}y\347>A\303[6N\007o\315\371P\305\2455\006\367\343\253\263"
+	.ascii	"\033\037\037\007_\301\311\035\261\304\301\375\355pX\207y\260"
+	.ascii	"+\377\006gE`\313\001V\250a\034\007\025t\204$\220\021\231\221"
+	.ascii	"\202&\035p\002\021)<\036\020pX\322\024\306\200\215\351{\332P"
+	.ascii	"\202\355X\340S\263*t\004Q\007u\262\202c\363wH\r\376s;\344\305"
+	.ascii	"\317\n\2016\035\372o\023\352\270\213\320\326\311\3208\253\032"
+	.ascii	"n\234\0052\367\332F\303NC\027\352\007\b\346\007Tj\243{\020Js"
+	.ascii	"\342\214\221\027\352\nP\203\b\224\255\372|E\247\212\252\256\273"
+	.ascii	"J;\377\300;\315\273\274\217g#\3574Vc\016\377\214\225\331\272"
+	.ascii	"\001\345\265\t\246q\340\2477\2360\211\007\373t\357\262q\371r"
+	.ascii	"\377\341\215\013B\2648U\002\023\364\315\306\353\031_4\261\020"
+	.ascii	"\320\371G\361\207<\244\025\266Q\207\251\002"
+	.text
+	.section	.gnu.lto_sdcardSitl_poll.33.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\215\013"
+	.string	"FUOA Q\224\016p\006\301\202\t\213s\312B\300@\214\b#\302\240Zd\317P\325\221\203\361\214\272c\235\313o\263m;F\003\006c&\370\372\n\020A\220\005`L\341\336B$\n,\263i\215\354-eJ\001<"
+	.string	"<"
+	.string	">"
+	.string	"$F\346\364\344v\270\366\bW5\237\322\205\036'\245\303\r\021a\321\242DW\372\302\002\246\024\032*\335\b\006Xq\210q\216+\206nS\225\\\346\234V\256\313p[\267\255\300\266\264\177 \334\243\377\261\036\277)\222\312\324\341!\322\317\3666]\224\375\375\276\317\206\367d[\035\325\237,"
+	.string	"1\022\""
+	.string	"\305\234\244\357\306\\\021O|\260\r\262+6\200"
+	.string	"d\355^\212$\331^X\b3R\324\356\\zNw7\244&h\2546\300Ee\226\035\341\037\031"
+	.string	"\027#\342J$\304\214{\340L*\326\232\365m\360\001c\2445lK\270\bm2\347L\340w\334\203\202\257zt\205\217>\316X\034x8\031\003\r\206\311h2\231a\233\t\034L#\037p0\035\231\3012i\031\340\013\302\006\223\236\353\302d\305\023}O6\204\272\3478\001\031  {\357q/\330\216\353\213h78\347\f\023"
+	.ascii	"\026\023p\234\232\007\256\b\332\024\304\204\003\341\"\020\027"
+	.ascii	"\tR\303W\025{\203\217\205Nf}.\310\346\335\354\260\bp\362n^-\325"
+	.ascii	"\020E\227\202\002"
+	.text
+	.section	.gnu.lto_sdcardSitl_writeBlock.34.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\234\003\265\031"
+	.string	"\246\260\251G\260\230M:p(l6LQ\327Z\254\203\311\306M\355\245B8Cq\231\253m\3453\003Ex\276\201\271\351\210\033\006\321\227\342\320l+\236\205\366\005\366\275I\347I\033\024\370\037\3373\n\236#\035J\243\021\262\t\221;\245\231"
+	.string	"\210"
+	.string	"\226"
+	.ascii	"E\210n\204\004\001\233\212\024\365\324\200'z\316C\335\374\252"
+	.ascii	"\325\251\214R+/\201\027\210\007m\373A.\204\310E\037\317\206."
+	.ascii	"@\222\216\034\022\256Zy\263\003\227\321\203\337\005\320\203["
+	.ascii	"\343E\177\211!\005\277\235E\276\316\350\257\343\232.\326$A\t"
+	.ascii	"\343\304\324\364\3603\260\304F\357Y)"
+	.string	"X|:?\256`\\\352\263\204.7\351\212\2031\235R\322\374b:\245Q\2074\367C\360\002K\305\250;\372d\275\031`.u\235\254\024Ms\206\016j\255\236K:\246\273\346\266[\330\276`\257\213\244Xke\3407\271\023\232\377t\3205\016\363K\007}\016\364\340\270\237\372\304aB\310\213!P\270Y\332\274\243\271;\373[\226e\351\245a\217\3239\343\264l\234\306y\222\377\346G~\233\033\371c\207\372a5\323\243\247Eq:|MSq\032\024\247\277pz\351\364\t\214V=\004fjEQ\236\251X@\252\035\376\222O\r]\211\327\351\212\253\326:\016\331\343\301\333D\366h'\271}6\025i\207C\302wDD\371`y\0174\266tm\013\027\346\227\302=\220[#\373V\216e*\376\2231\270\312U\364 \335\027\013\\\275\261\350\267\340\336\211R\017\330~\373\026O]rip\263\244\273\273Q;\303\257n"
+	.ascii	"\274X\275\266\256p\215a\242\305\344\003\334\235a\273\273]QZ\326"
+	.ascii	"\360\252\333\224\335[}\271\267\266fP}\273\213\362qea\242\276"
+	.ascii	" \315\256)\205L/\306\332\207\346\354"
+	.string	"\245~S$GOL\026-\244\331e\331\342l\316>\247B\224\355\277\223t\\\234\005\321\344\250\216f\351Oy\347O\002\244\020\t\001\326\201F\362\374\374\2204\321V\333\260a\210\207\216\250\365|\210\320\201\006\364\303Sc\232\202\037!\237\240\235\036\033I\353\t\232\005\331j!|l=\263\017>\244\207\031\315\0264S\240c \0205\333L\b\b\3106\033y\270\177\342\027C\231p_D/\365W\214\253\023\363/\242\342\226\260-\256\035\340\366\350\253\265\326W\201y\2636\033[\330\332\022&\314/}\3035\222\361\343\306\tqwPn\357|\013\251\005\314\352\002d\f\256\312\263z\\\316\203\b\020\246pw\024h\270<\003&\270_}\205A\2501L\004\211C\246dD((Ja\322\001\220\002\221\"\343\r\020P\310F\233j1\n\257\240&\255X\223ML\275%\254\243\217A4+\243\235\251\030H*U\327z 8"
+	.ascii	"\006g\225\200\326\"\260\003\216r\250\020A\312b\307\003v_\310"
+	.ascii	"\341\254I\311\257\215\363vz=\3027\227\240\3608\360\220\345\221"
+	.ascii	"Y\370\240\2471\253\0162+\300r\316\210{<\206\004X\266\274\265"
+	.ascii	"\027\212\013\"\357U\264\312M\200K\362dG[\372\376\370U-C\005"
+	.text
+	.section	.gnu.lto_sdcardSitl_beginWriteBlocks.35.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\276\002\r\025"
+	.string	"v\346\211J\260\022R:\343Po\235\274\2032:M\022u<J3\250v\350\336\027\320\312\033\261X_iIJ\376\204\330oZ}\207x\255u\037o\243\236\345\215\235\235\255[H\033\237\300w\035sz\242}\320\316h\237\332O\b![\356\224\002y"
+	.string	"j"
+	.string	"x"
+	.string	"\376\320\211`\334\243\302\020\300"
+	.ascii	"3S?\025V\265\ng$\037\031/\322\013\030/.\210\367\336*\311Q\244"
+	.ascii	";{~\205\267\310"
+	.string	"\223\006?\fT>8;/K|ptN\306\200?JRk5q\2433\307\r\027-P:\022\365\363#\006\224\241\005z\240r^\300\231\271\224\244F\325\316\013\030C\t\004/H\335\350%8nv\346$Oj\255\2364@\234\333u\333\037l3\260\247\213\247\271\350\343\306\213\344>\3513\310\206\250'E\221o\016ma\314\334\240}Z\027\310&\247e\344t\214\234\206]\370\273^\364\227\3434)N\257\247'\235\276H,'\312\244\252V\rC\254zCl\"\341#=\351\345G^\237*\253Z\353\353\305~]\274\rc\277l!\n\005s\276\210GE\252\314\217\rS\255B\003>P^\264\035\0358\fG\327\332\266\317\220\001$K\b\217oc\360d;\230ZGYB<\227:Q\242F\334\240\313\375\356\225#\034\006\357\305\3674x\334OXBYt\203K'w\300\024\322\234q\022R\332\r\372\022F\331\336\350"
+	.ascii	"\214\206\242\202\344\350!3\257\034[\330\312\366\277\2342\266"
+	.ascii	"\247\337\215\344\302V\034\362k\212\231C?\311\267\267\330\225"
+	.ascii	"\265\326\004\376\212\263H\361G\\\364\nn\006.,;\334\002\n\266"
+	.ascii	"\032\213\203\024\032N\005\202\3134\023\025\227\233\356A-\207"
+	.ascii	"B\253\351f\272\234m\302-W\233\261\334PVf\264\234nfRb\\\213-7"
+	.ascii	"s\301\341r\263\227\320wZ\027\310-T=\345|o\274\321[\036ld\230"
+	.ascii	"\177o\234\236\353\023\337\306\2646\350I^\351\b\202\306/}\267"
+	.ascii	"\306\336\265o\177\332\301\234FD\350\370\346\220\226\033\234>"
+	.ascii	"\037P:\310\0052ot\355\0063 p\002\021:<\007\351\006RZh\306\025"
+	.ascii	"#\345\020\023\326\316\024\002]\232H%\007\032_\032\343$\315L\332"
+	.ascii	"2f\355~\302\231@\266$q\217\212\262\341\200\260\234\313$;Uc\233"
+	.ascii	"\313;\301\"dq1\032\212\201\004j<\024\277\270\342;\310\274a\334"
+	.ascii	"D\335\027[m\274`\320\316\241\316\b\343\034\006:4\344\315Q\240"
+	.ascii	"h\324q\3261e\035\327\352\244e\220o\250\342\235\001"
+	.text
+	.section	.gnu.lto_sdcardSitl_readBlock.36.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\320\002m\024"
+	.string	"\366\345\207J\300RRc\340\2536\373\355\344S\t-\376\320\247&\033*\017\342\177\274H\240B\350\360\034\241\201\352\016\321\265\017r\225\273@\376e\314\340\253\261\231\025\207)\n\234!\001\270H\315\277\202UP\030\360 \021T\026\337h\357-eJ\001q"
+	.string	"j"
+	.string	"x"
+	.ascii	"\265\013\315\234u\257N\320\001y\321<\262V\373>\377\251\035\210"
+	.ascii	"\346\220{E4\275\270\227\207\300\t\310\213\004n2^\f\037`\274h"
+	.ascii	"\333\n\026\324l;o\307\006$\327!\227b\352^\236iI\334\366\320V"
+	.ascii	"\233\277\341\241=\301\364\003\372t7\267\341\201\034\247\233R"
+	.ascii	"w\013M\240v9\336{\375\240\303\325\n\202r\357u\255\321\201\270"
+	.ascii	"\305\333\226`\233\202m\r\004\177\261\367\275\226\360\340\223"
+	.ascii	"\363\003DS\2036\357V\355\b\373\341\275\367\332\352\330\256f\271"
+	.ascii	"z\345\352\222\027\375#'\372E\016\364\223\027\372\307\261:t\365"
+	.ascii	"\001\310\334\251\035\rt\334k\023\254\272O\"\022\217\355\373+"
+	.ascii	"\356\213\271\n\333]\017\305\275\267\214\261\313\213\267kvi\027"
+	.ascii	"\321\302\325\305\355~\244\204D2\002V\0277\324\364\300\362\036"
+	.ascii	"\024\207\222y\252\021\362S\242\"\255\255r\0324\247\031\345M\251"
+	.ascii	"g\264\366y\0313\003v\214>\206\213$\352\"S\310P\022\025\316i\243"
+	.ascii	"}\341I4\222(\030)8U9>R\365\250\007T\bk\333\310\262\357\235\025"
+	.ascii	"\364\013\342\361\303\201\253>\274\262%\226e\237\273!W\366\341"
+	.ascii	"achK\254\370#\207t\253A\337\347\327]\300\310{/\003\237\305[\264"
+	.ascii	"\370&.Z\366R_s\321\001'\314\ta\004\206\236+\261\330\211\222\251"
+	.ascii	"\213\205%fe\324\340j\271L\200\241\262\330\212\210\321\223\030"
+	.ascii	"\314k\246\322JO\26453g\251+\303+m\231.\257\263\305D\323\231y"
+	.ascii	"R\3002\f\256\324\204\221\311R\263\344\321\334\352x\004\362\364"
+	.ascii	"\214\354o\033\337{\004\240M\317\250\376\350\267\034\254Qh\354"
+	.ascii	"-\024\017\033\355\327\243`@q\2674%5b\355\n\277A\263\361+wK=\""
+	.ascii	"\326\266\0203 \020#\221S\017\n\201\342b\001Gu\\YBE\357\336\245"
+	.ascii	"4\fGh]\2421\0063\207 \t\3016\346\020$!\330\306\034BI\266\004"
+	.ascii	"\335~f\325\260\026{\224\317V\314E\210\236,\376Jp\357L;\304\022"
+	.ascii	"r\304\220\371@\0302\004\311\230\030\026I\210\204z2\321\310p\025"
+	.ascii	"n\030\030\302\3417S\275\2470\306\241.\247\350b{"
+	.text
+	.section	.gnu.lto_sdcardSitl_isFunctional.37.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"]\007"
+	.string	"\242N45`m\322\001Hl\tD\315"
+	.string	"'\312A\211\345\373\260\253#\n\350\211\246\003k\026\035\313\252\355\026\003\276\307-\255\020\004\363Z\025:\342y\020\334bX\263\204H\231R\2662\013\034,*\\Pc]\361E\270\211\300\340\365\0320\r\303\263`|\231\001g\016\033\3708Y\006\037\246\333S\253$U\001\220\206\354\307\312UU?\266\220\220\037\336\021/\273{\340s\334\004\341c\274\262D'\317\275\362;\225W\327\200\013\023(Ov\367I\245\260O\355\356ZI\266\323\232\351S"
+	.string	"($\b\"\273\242S\312\216T \032\266=6\306\005\006\036k\357,D\226mc\3638\331\355\236V\\{j\376K\247LJ%\334\350\363\264$\354\256\223\033M\334z\333\004\266\237\355\214\b"
+	.ascii	"2\241c\037\030\302\004;T\241\3145z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_sdcardSitl_isInitialized.38.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"]\007"
+	.string	"\242N45`m\322\001@_\002\234\320MQ\013\311\215\253\302\372\2515"
+	.string	"Y8\354\300\232E\307\262j\273\305\200\357qK+\004\301TV\205\216x\036D\340\024\326,!R\246\024\2660\013\033,*\\0c]\361E\250\211\300\340\365\032\260\f\303\263`|\230\001g\016\032\3706Y\006\337\245\333S\253#U\201\217\202\254\217\224\253\252\202l$\220\037n\212\226\335=\360;^\202\3603^Y\202\223\347^\371\034\312\253k"
+	.string	"F\351\223'\273\363\244V\330\247vw\255#\333i\315\364)"
+	.string	"\n\022\204\217\335\320\351dG*\221\r\333\035\373\342\002\203\216\265w\027\241\312f\332<Lv\273\247\026\327\236\232\177\216S%\244\020N\344yV\022v\327\311\211&n\275m\002\333\317\266F\b"
+	.ascii	"2\241c\037\030\302\004;T\241\3145z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_sdcardSitl_getMetadata.39.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"E\007"
+	.string	"\342M36`m\322\001\300\216r\311\t\rY\252q\326ad%\233\002\245\253\220#\230\326P\357\221F\273\305\200\357qK+\004\301T\2263\206\371\230\215\355\332\320\215l\262wJ\001\2664\r\035L2\\qc]Re\344L`\361\322\007l\343\240V\224\2529p\006\301\211\332\311\262\250\230\271\027\211\b0\355\206\276\331\362!\022\031\224\335M8\364A>)\374\215CWx\334\267C\337S\035\032\204\236\205=A\356i\330\247\366e\330N"
+	.string	"\343D!e\367\242\205eM`\t\207\355\217\215\361=~\372X+\230&\322\200\210D4\262\262;\325\363\231\352\020\340\004\325\341+]\273\323\374\177\234\3528\251l#\320\335eaw\355\266\021\351~\267\215`[m\227\002\t"
+	.ascii	"2\003\302p\025a\261\f\001\272\206W#\232\026\202\020w\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_sdcardSitlVTable.40.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375 \324-\005"
+	.string	"\344\b\231"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\202\200\200\374\342\303\374S\177}\230\374\003{y\330\367\003{w\230\367\003{u\330\366\003sq\230\366\003om\330\365\003ki\230\365\003ge\330\364\003ca"
+	.string	"?\202\210\200\310\001_]\303\001[\302\001Y\301\001W\300\001U\277\001S\276\001Q\275\001O\274\001M\273\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/drivers/sdcard_sitl.c"
+	.string	"\t"
+	.ascii	"\200h@4 \032\020\r\210\006D\303$\232L\242\006P\004"
+	.text
+	.section	.gnu.lto_sdcardSitl_poll.part.0.57.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`1\tE."
+	.string	"\nO\024\021F\200\234\316p\237*\207-\251Z=\306.\2602\027\312o\260s\021\310\";\027\262\307E\223\274\340`0\376B\254\022\310osQD\217\261f1\326\364;\321T\317\212K\366\364>|[L\020\0335\262\367\356&\245L\001\004\001\345"
+	.string	""
+	.ascii	"\001XK8\252\227y\205\310>\331(\034\326\025-I\246J\231-\370_L"
+	.ascii	"\340rK.\332B\021\302\212[\223O\326\t\261\350\311L\305\232\260"
+	.ascii	"\242-X\363&\273X'\3045S\261N2\035i\311\006k\376A\332d\317\\l"
+	.ascii	"\331\205l\234Y\223.\276L\326\354\305\226\035\b\271v\251\252\372"
+	.ascii	"\242\277J\030\277\357\217\361\373\326\334%\207`\004#\353\377"
+	.ascii	"!\030\3058q\315\220Xh\324[\321\311\234\252\232\005\327\354 K"
+	.ascii	"\\\340O'\307\327\343\245\350i\356\232w\210_\2562>-\020=\3020"
+	.ascii	"\005\246\306\007\r\036\373\3239\333\3019]\353\323\321\305="
+	.string	"\256\345q\215emq*&Kk\225[`,ke\264\200\017\032\353\236=#\2165\177F\252]\221\252\252>\343\024\357v>[R\332VL\326\272c\320v\204k\321\226\255\214R\334\305\2361\352\004\002S\013[\037Yks\317\356\240G\252\252~\241\220{\236\375\227\300\177\t\177\232\026lH[\005\271&\030n\tj\342\320\225\355vx~\031\002\335\274\230a\352\310\330@\361\362\213eQ9\266'\256{\357\202\251\201i\351>\236\313\267\013\272\305\353\\\245N\311(\242z\251\t\262|\325\016\227\232;<\261\244H5+\345\240\362@K\222\255\225\377p?sO\273\376\233\366\037\006\034W\251\t|^R\034\347\177\322R\031\246\252\252F\370J\331)J_\2615\277T\202\267j\315o\211s\315\355U.\207a\261\255\3122(^r\037\337;\333\313\345\222\356\375\365\237?\340|\242\363\005\234?t\362\205P~\020\217\037"
+	.ascii	"\345\003\350\361\201N\376\017\312\367A\371=(\237\007\345\357"
+	.ascii	"\240|\240\217\377\363\361ux\374\034\224\357\343\361{(\237\327"
+	.ascii	"\343\247)\0375\371'\217o\246\374]\312o\224\317'\177\023 \b\003"
+	.ascii	"\256\252\032\346\330\02350\265\260\264\217\377\265N7\235}9Cq"
+	.ascii	"\024\361\b1\tQ\tQ\311\271\346\257\211\204h\031\340\237\270\204"
+	.ascii	"\250\344\255\322\351_\224\032lQ[v\225\373\301\212J\027\207\366"
+	.ascii	"\361l\366\232w_\2463\247\255\376\"\346uN\373\372[\341|\332\017"
+	.ascii	"\261u\3026\222\231\203\203d\032i\233{\343;A,\035S\0209\207\204"
+	.ascii	"Z)C\326\246\327<\nkps\246\205\023m\013o\027\226\215P\350JlM\256"
+	.ascii	"AZp\225\\\223r\274n#\031\272\336\267Y\262\026\267\353\3433\234"
+	.ascii	"i\21783#\305n\276h\307\260i2\034@\273\210\205C\002\272\241I\033"
+	.ascii	"\355\n\271*\313\206x\327;u5\234f\237\375o\350\300[\205vQ\261"
+	.ascii	"\237\376u\333\267\253}\305\356\341Y\236\345\\\363\354\337\233"
+	.ascii	"\026\210mc2\"\203\204`L\033\275\251\373/g\367\256\027\r\325X"
+	.ascii	"\024/\317\335\0354\245\030\347\017\261a\204\013\306\355\"6NN"
+	.ascii	"KJJ,\234\320+98\261\302\204S\022\211\246\241\022\t\247\240S\323"
+	.ascii	"R\013\023M$\202(L\f\231\202JMNA\007\005\236B\305RSpE\212\024"
+	.ascii	"MA\337\356\324\376z\261\312\217\250\007\264\325\377\001\375#"
+	.ascii	"\250\216\002\n\350\241&\352-\332\330\261B-\240wm\205z\250\315"
+	.ascii	"\272\342\225(\263'\361\220a*&\324k\266\f6#\271*\323\366G;\265"
+	.ascii	"\217\007\320\001:\250\027(\004\013Ar\220 \020|d\n\"\277~4\357"
+	.ascii	"\002\367\360\342\001`\353JlU\352\370v-\225;n\025\253\364\322"
+	.ascii	"\035\236?m\025\267@g\307\300]g\027\301:\230\013\250\367\354\247"
+	.ascii	"\377$\326\032\002\335r\004\020\242\225\323G_\177qq}\372\007\344"
+	.ascii	"\206\r\237F\305H\351\3654\r\343\256\360\344\351\236\336\325\021"
+	.ascii	"\341+a:\203\247\031J\227\262\235\266\022\002\271Um\225\034p\271"
+	.ascii	"\\.wz\221 \333P\255Q\n\324\300\324x+<\201\335t"
+	.string	"f\346D#L%Ly\n\330\001\200\276\250\2014\004\021SjfFR\220\222$\215\001\220\002\221\241+\316\001\021@1DL\315H&\315\001$\b\300#\255\303\216l9\331nl*,\211D:\226\222\253\007\206[/X\210\212\230\354\001\251\254q\370\200\330\367\247\255ra\353\223,\337\034W\352\257v\2234`X.\020\214\2100\004\370Lf\r\n\251\2537\017\224/E\0365 4!\301\272\0047r\300\035\240?'\347\314~\243L\360\232(\023\267M\244\333\247\302\266\350yE\271l^\317\032N\340}S0\356\266\277V\br\r\034h\007\261\272\n1&\330?8\035\031\302\301\23537\276\256\372\363\337w\356&-\315 \20797\033\261j\035\3573\224\334K\037I\332\270 \255\375\312\266\001\211w\021\366\303p\277\245\270\n\267\223\235\346U\242_\345\f\303\316\326\257\204+\022Op\371\306\326^\027\260\352\311\216"
+	.ascii	"8L\271\r\360]\025![\327duFb<\251\006\352A\330\202N\362C,\205"
+	.ascii	"<G\b@`\033\006\343\203uw\001?\323\006\342\377A7\233S'#[\035\024"
+	.ascii	"\347\263\225\001\332\"\276\264\273\310Jq\213\235#\354Z\370\203"
+	.ascii	"\207\224m\333\341\340G,\274E\203\226\202\353\314!\227\r\202\330"
+	.ascii	"s-\303X\210\206\227U\200\272\252\263\351\301X\001\213\346\f "
+	.ascii	"b>e\205E\257r\206\352W\343\355\217\001\345JT\030\316xW\261g\307"
+	.ascii	"K\003"
+	.text
+	.section	.gnu.lto_sdcardSitl_writeBlock.part.0.58.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`M\003U\026"
+	.string	"\326\350\217I\300RRc\342U\377\240JL\205\373\250\362Iy&\3066:Fhp\302!\226\353@`8Yv\300\333\323\331\352\227dId\205\035i\026)Z\251\255\224\205\212\315<\320I?\244\235\004%d\222?\355\005u\267\335{K\231Rv"
+	.string	"z"
+	.string	"}"
+	.ascii	"G\005d=\323/\275\035H\245/\345<\005N\211\310\035.\r%"
+	.string	"HO\333\372\364I>2\275(\266\365I>\303\356%\036\245\356MQ^\332\300\371\322>\322\257\307\266\217\342G9\006\222i\321gD\003\211\035&\256{S\331\313\223\0070_\222'1_\332\021\007\336V\022\350W\324'x{\343\311\"\"*\324\307\303\353\310\311W\313\275\327\347\207\273\274m\026\3330\2665\021\306\023P\3022\n!\254\307j\203l\311\223\327\002\331 \325\260\263\372<\253_\260j\363\254.\017\365\223w\372\355\323\277\236\351?\311\b\213\217{y\216>\356O9Ub\312*+?\333\234\004\323\"\317{\204\256\216\270\3560-\240\262\302\263\315\323\"\017\002\020WG\367U\\\212\367([\"\025\327\275\227w\337\370\263cv\216\035\203zz\362\221\"w\030$\364R\326;5\365\312\246^\365Q\307\232\235\367\n\217\3729\256\203A\203Y=:3_\034\324\243\246\375\211\237\241\r\272\244\332\017 \324\243\245\025"
+	.string	"\265\202\206\216\r\372u\030\323\216p\0340!W7J\242V\021\017\322\332\022n\303gU#F\314\352\262\326\236\360\031=\031U0\253,\243jm\n\217\341\203\361\"&\304\352\272\265cN\205cR\264iwQ\013\271\272\367\036`\361\0267\177\350\245+\340\352\321\227>\316|\371\264\033\332\002"
+	.ascii	"45\232L.G\253\235\273\333\314LO\306\314p\263\325\314hj\272\234"
+	.ascii	"\f\210k)\271\033\034/\306\266\243\325l<\031ow\303\200\333\331"
+	.ascii	"d58\232\005Ym\307\223\245\f\260\356\302m'\273\321\351v\262\230"
+	.ascii	"\355z\013\344\033\177nU\021U\037h\302,\007\3330\353\026\241\325"
+	.ascii	"\261\2656\310\366i}\255o\001\221\374!\003\223\\\\\214\350\216"
+	.ascii	"\227-\355i\311\036\033D\350\324\243M\373\262\337\371a\022D\250"
+	.ascii	"AT\204\230B\202\nDf$\2116I\033\360\"\251\232<\021\200\265T%\225"
+	.ascii	"\350v\016\205j\264=`\353\224x\305\006:\303\031\244\341\027\272"
+	.ascii	"\034\213\024\\\246\352\274.\366r\r\022\235\212\034_-\3048\356"
+	.ascii	"\271B\240\357\002\222\205\f\237\264P\265\266\257\254\273\022"
+	.ascii	"\331M\033(E\024\325M\265\361B=\207\345q\331\305\\\200Wz\302\234"
+	.ascii	"/\237\205\031{wR\243/\256c\213\373\336j\315\036\342Y'\354|$\032"
+	.ascii	"y\300\207\210)"
+	.text
+	.section	.gnu.lto_sdcardSitl_init.part.0.59.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`\247\001\265\017"
+	.string	"\266\334gG\360\2208\0358\231\2301L\226,2`W1\250\216)\354\325\360\022\272\037\313\315\2771\350p(u\017A\303\224\267\341p\b\331\bu\355G#\031\337\300g`\372\254\315\207{\242`W\323\200<\024\305\026\024\376n{\247\024O"
+	.string	"U"
+	.string	"S"
+	.string	"\217A^F\211\266\254rQ\026X\262\225\232\335U\203W?\330^9\373\003\233\327\257n`\363z\030\266O+\2236\216\227)\373\241\003\304\253fw\273W\252\342\344\351\324H\037u\352A\242\304g\201k"
+	.ascii	"@v\327\233\211\273\3366\004\333$\373;\002u\001\013\001\255\335"
+	.ascii	"\021\263\035\233\242\322\264x\354\177\375\260"
+	.string	"S\373\366g\234|\032\217=\306\235\362\004\203\031\321`F\020\f\330\017.+d\037\333\353\353\364\027\022\016E`\327\205B\266[\322i\277\345.\344_Hh\210\325f^\224\016^\035a{u\271\275t\347\325,\001'\023\036;'G\313\234\371\260\033+\260\245'\0160/s\232OB\212hKy2\227\201\267\321R\331M]\245aKU\360\274\216\302y\225\271\024E\331\257\361\031\016\276\2127\214\363\252W\177\244\217\371<!\302E\213\205e2g\223\242\230j\327\226\272\354:\375\026\215\300O\307\036\236\221\201\207#}\245\220\013M\\\350\023\001A!\034\206\013\t(\200\245\221#\002CH\241\2671\215\323\336G\304\004\216\031B\"\310\013\215\335(~\035@1\324\221@\320\250\363\304\261\373(pX\372\304\316\024\206b\327\261=O]\0061\241\036(E\261]\242\355\006% \220\202)+\333\204\215q6-\2507\242\317"
+	.ascii	"\257>bz?\0027\266\375\346\354h\225D5\314\033N\340\022\273#\244"
+	.ascii	"\256\203\341\243q\311\020\235\371\213\004\234\231\325X\267\253"
+	.ascii	"\314e'\263\367\304\267\001\326e6)E\r\320\222\242``h\356n\224"
+	.ascii	"\242\337E\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`)\002-\013"
+	.string	"\204\020%\003"
+	.string	""
+	.string	""
+	.string	"\002\035\177\"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006#\177#\005)\030 $\177$\002%\177%&\177&\002'\177'9\177(\371\377\377\377\003\271\200\202\202\200\005\032)\200\204\001"
+	.string	""
+	.string	"\003\005\033*\002!\177+\373:\177,\034\022\002\"\177-\377;\177.0/\002\036\1770\005(1\201"
+	.string	"\001*\1772\037"
+	.string	""
+	.string	"\200\200\200\002+\1773-\1774,\17751\17764\17773\17782\1779/\177:.\177;\003\007\023\326\252\325\252\001\001\204\013\003\007\022\304\006\004\007\370\356\335;\001\365\023\004\007\360\335\273\367"
+	.string	"\001\325\n\003\n\007\235\341\365\321\002\001\202\001\003\013\024\344\001\003\013\023\304\001\003\r\025\240\244\007\003\r\013\216\251\266\241\001\001\242\n\003\016\026D\003\020\033\003\032\370\332\204\371\002\001\244\001\003\020\016\216\225\332\307\002\001\342\001\003\020\031\362\352\245\270\001\001\244\006\003\020\030\304\006\003\020\027\344\006"
+	.ascii	"* \340\002\251)\326\001\030Z\326|\025\3270\020\237Er\213\341"
+	.ascii	"\320+\221\361\370\240\326\003p\004\007p\004\007\340\b\016\340"
+	.ascii	"x\030^W\305I9F\240\320!\002\342\251\244q\200S\017@\24510q\013"
+	.ascii	"8#\355\006\036\271\346'\025\006}\202\3375ae`j2\035d@X\007\035"
+	.ascii	"x'"
+	.text
+	.section	.gnu.lto_.refs.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\275\004"
+	.string	"r\215\034\020p\234\2311|\362gL\335\025\337\006\246\276l\031*\247\223\333\3157\372\331\003L\302\347\340S\360\031x\033\263h=\315s\004\234\317\247\363\311,\033\305\306N\305l\372\320\347\267(Q\333\310\nY\037\253ce\254\213O\305\232\370D\254\207O\303Z`\032X\235\265Y\227\225-]kZ\223U\301{%%\347\262N\345C\312\346\263}\262O\265\336^\322k\004\r"
+	.ascii	"C\t\024-\270 .\346h\254\326\320tKh\224\2059/\267G5\006D\006e"
+	.ascii	"\254\347=\322\232y"
+	.text
+	.section	.gnu.lto_.decls.94099c47f3c84451,"e",@progbits
+	.string	"(\265/\375`t>}\f\001\332\232-[W \fA<\035\027\274\243\306\250\250\202\374\016f\233.G\241\220\205\0251Vuu\317\001\367+WR\231\202\242\330#\272\tNaxI0\310\b`o\351\221\306\315.x\223 :\206a\301'\355\316H\304\324\344#;\221}\242\343\362\230\337"
+	.string	"*\2550R\331\366\226R\312\024\035\005\237\005\311\005QM\r:\336\241LT\324AU\367a\205\311p\020\r;\316\256\323\304\201\007.\222\255\260\033\226\323oTe\354\351\306t\005\326\323]O\016\344\353\305\334g+L\227\205z\321\210*\250\235\224\317*\037u\035\242\021:\342\354\244|]\271G\256\312^\031+KsV~\363U\336\312_\231+\363\310Z\370\315Vy\3523U\336!\344\037\233Y\3413\254\206\343\216z3\317"
+	.ascii	"<\236v\033\f\253\224\220y\r`\013\247j\024\377\017\2262\r\r;\316"
+	.ascii	"\022R\301,\245!\203kQ\271F\032\3404\353\310R9G\306\201\337\242"
+	.ascii	"\214\3642YQ\331\306_4*\337\310L8\356\350\355E+fP;\016xpv-\373"
+	.ascii	"\325\036\376\333\217\377\306\3133p\230\225\021X\031\177\374f"
+	.ascii	"\031\031j8\244gm*\306g\250\277k\351\032\206xZ?\350\362\316\320"
+	.ascii	"\3744\345JkH\336\331)\277fNgU<7e\030X\317e\320oL'\357\374\"3"
+	.ascii	"\265Dy\n\354y"
+	.string	"\343\261<\007\007\264\223\367\357a\275\377WY\217\f\001\372\345\375\033\007\377\r\203\377\026\342\271\353?\376\372\216\277\246\343\257\333\370k\037\374u\024\337\200c\326\374l\201\342\344<\202\362\327I<H\206\3579\t2\227\367\353\024\374\361\032\236b=\034\027F\"\213l\n\345\177&\373`)\030\020\307\035\355\035bS\214W\026\rq\027\244\216\t~\202\343h8 \313l\232u\360\330P\367\316\304\026\315\316\234\"\377d\240\254\"\367\344\235\314\203\337\354\223\233\217\223`%\277\337\336yp \210\020\331\007\013\3421\034w$\002\026\327\264\3677\373\344\216\365\206*\275;iE{\177\037{e\037<\210\237\fu\336\376\024a\313\205\224\257\367w\003\231\r6\330`D\f\"\037\n\366\3477\376\231\214\177\356\342\237{\360\3178\370\007\f\370\217\243\340=\374'\202\336yZ\204\300\371\220\2217\356\303~\217\3770_\307\177 @\377^"
+	.string	"{\327y\301\030\003\2141\330XORc\353\376<\203\343\256\231\307Sv\f)CSJ\234\003\316\260\2528f\035\2013\254\034p\236\n\317\333\301T\350\240\274\b\313\373s\021\377\314\303\037\343\361\307n\034\333\341&\370\325"
+	.string	";y\274\004\327\275\252\363\3667\337\b\024\373\312\3731\032\177\254\301\252\007\007\261\006\353c/\236q\314z\341\212c\031\034\263~\3001\253\214F\221\364%\225\367\343\027#\301F\036\277\377\301\377\f\022\374\206[\320\260\323\273\214\027C\257\2651\030|\275w\231\rV$\253\271\237\275\037\267\360\217\331p\033\036\023A\357e\275w\013tQ\331WU\336\030n\346\361\221\230\365y\364\366\227U\260OEX\336/X\207\377\t\376K\216;\316\260^xG\220a\305j\031\247\341!\217\3250Z\013\017V\333\275\353`\214\301\020c\f\324\265\034:_\353~#\177\023\370\237-\301\031\326\307\357?\301e\177\267o\274\265\320\312\373K\340\337"
+	.string	"\216\201\3400\374^\200\305\036D\210\327M\257\236\325\373\373\342\"x%\370\227\367'\200?\276`\305\203\370\202\365;\340\037\207\301\376q\017\234\205\277\264\023\b\332\303z\177a\324/7,\235\274\261\026\336\302/\376\372\307]\330\353\267\027\264\203\365\376\272h\235\026pfyo\300\031\326\215c\326\307\\\217A\256\207\370\314\037sX_0\207\365_\234a\3458f\375\317m\272"
+	.string	"/\377*\276\322\031X '\203\377\335DO\351\r\377\330"
+	.string	"R\232"
+	.ascii	"\035\370\307\007\320\003@\300\377F\373\317J\377\031\306\177^"
+	.ascii	"\372\317G\377\231\351?\273\370\317/\376s\322\177F\372\317N\331"
+	.ascii	"\210h(\250\305\377\007\340_\235\200\006\200X\b\264\370\377\276"
+	.ascii	"\372\307\036\376\361\207\177\334\301?\346\340\037\213\360\217"
+	.ascii	"=\360\212\371\337T&\374o\250\377\314T\361\237\243\376\363\227"
+	.ascii	"\266`\304{Y\340_W\200\201\377\327\360\277\231\374g\017\240`\371"
+	.ascii	"\337f\377\370\001\377\230\001\377\367\257)\370\3271:\001\377"
+	.ascii	"\330\345?\323\375\343\022h\f\377\271\311\277\206\311\002\320"
+	.ascii	"\027\364\313\277\036\376\353\026\315\362\217\343"
+	.string	"\376\361\t\364\312\177\016\324*z\377k\256\205\377x\001z\375\177\r\376\337\003H>\204\377\035\370\371\177\263\370\327\352\177\026\374\317P\376\263\223\377\\\367\237\335\3763\330\177\306\372\317T\3779\372\237\237\376\263\t\376\263\316\177\356\377\331\375\3179\377\271\346?#\377\363\b\376\263\315\1776\376\347\020\374\347\017\374g\016\374g\023\3763\005\376\261\324\377\247\375\347\007\374?\n\377\370\302\177V\300\177n\300?\026\372\177\277\377\034\302\177N\300\177\026\361\2375\370\317\030\374\347\f\376\263\206\177\234\301?6\341\037k\360\217/\370\317\303\377\317\373\307\323\177\214\367\217\357\376q\364\037\223\360\217'\360\377'\374c\t\374\343\b\374c\022\377x\204\377\377\372\177\021\376\337\310\377\017\007\007\007\007\377\325\030\377,\031\376;\334\b\034\260\370\325\251\340\221w\007\214\3300\262B\232\205\224\262\226\254xX\345\030E\272x\362\256R\203\270e\275\364\360\377"
+	.string	"\207\3264J\003J\305\2466\264\024\256\350\215-\251]C\003\246hN\221\356\350\236\332:\366\016\374n\251\235\343q\213\364\205\025Q\313\376\341\034\377\341\020\376C2\376\303.\376C\036\374\207Q\3747\215\377-c\317"
+	.string	"\001TcF\336\317\2063\254,1f~C\255R\347\037V\336+ON8Q\264\354\362\376\355\364\277\241\273)?I\332\262\2217\236\342\f\353"
+	.ascii	"p\314\272\231f~\303\370\230\341U\363ET\336\027\354\347\273\237"
+	.ascii	"{\211\303\333\215X\202\350\320\223\362\365\347\223\003\245\027"
+	.ascii	"=!\235\210 \177\354U\324#\213(+\312\002\353\325\320\332-\266"
+	.ascii	"\002\\4\335\371\361\035m\244\235\264]\340w\267\330+\266\013\225"
+	.ascii	"\215\032{+\373]\212\360w\021\343\357\302\305\337\205\007\177"
+	.ascii	"\227\032\374]\226\206\266P`\024\256\024y\357\2407*\243\215E\336"
+	.ascii	"\357\022\304??\211\242\245\314l\347\356{\307\3104\020\377h\213"
+	.ascii	"B\021\022\335*\366\317\356\331)6\320F\261}6\017~\267S\013\276"
+	.ascii	"\036\304k\277\353\246h)XeS>\r(%\233\356\351m\247\016\304c\303"
+	.ascii	"\346\333\207\2045\232\352\3346\020B\001\234\203\303\260\267N"
+	.ascii	"K\336\235\224\235%\2739\307[Z\206\360o\t\302u\237\366\303\257"
+	.ascii	"\214\376\223\333\021Z\372\301O\320\007\261\314\372-\\\374[t\350"
+	.ascii	"\275\335\002\016**\357o\251\301\277E\211\177\213\223?\213_\236"
+	.ascii	"\363\205\301<Re^\323\177\333E\252\272\232xr\037\360\334\262|"
+	.ascii	"h R\335\007\017\261\"^\032\354lp\232\245\246\327\206<o'\022\222"
+	.ascii	"\265\025\351\252\261\025\345[;\323i-\004\321fXK\246lD4\333\326"
+	.ascii	"\333T\313\351\262_\233\262k\323F\312\242o3\372\266\242|fZN\277"
+	.ascii	"zKg\n\004\252\253\255(_\234~\242\347\264\235v\242\3574\022\335"
+	.ascii	"\202\246\323K4\023\335D\327i%:\t~\265\234\206\373|D\037y\231"
+	.ascii	"\260\274'E%\247\247\264U/\022\201\007\322V\224ON\213i2a\016\261"
+	.ascii	"\255\250J\033\233\035\326\206\255\322"
+	.string	"Y\276\370\263d\271\2512p@\251\330\301\237%\207.\242\311\276\236\200O\374Y\222\206\264h\301xb\021\361gI\201\226\205\200v\274\310\373Y\232\374W\374\270\026\242\247?nR=\376+M\370\257$\321c\n0\223!\366\306\177e\b\377\225\262\037B\2731\347\220\227\377J\025\377z\020ptA\345\375+6\370\257@\371\257\034\361_y\362\377\340J\367\220\322\320\322\\\370\325[:K\346\355\275Loi\251\256b\201j\213b\223\331"
+	.ascii	"?\361\220\332\326\375*d\034k\025\252\241\302\351\305_\245\007"
+	.ascii	"\177\025*\376*7\370k+]\325\002\335S&'Cy\353\035\337\242\365\263"
+	.ascii	"g\004\211\343%3\257\251\364\031\021\037@'\377\327:\242;M\235"
+	.ascii	"\244\034\225r\021\007H\225\267\216Z!\222\233\022\311\373Uv\370"
+	.ascii	"\177\340\226\341\204\236\262\306\202\374\332\220\347B\347y\n"
+	.ascii	"\213\352\024\277\326$:\345h\032\370C\005%\357\315%Mw\376\216"
+	.ascii	"\264\220\345\346z\024\365\364Q\351\247,\345\327p\\X\004\346\220"
+	.ascii	"\246\377\372\251qh\027\032\206^\3229\264\f\215\244\225\264\221"
+	.ascii	"N\322M\232\206\216\241mh&\335B\327\320+4T\023\351\027z\206v\322"
+	.ascii	"P\232\205.\322G\372\006~\365S.\362\372G\253\310\342\361\233."
+	.ascii	"\321OYO\003\375\236\361\237\257\027Et\317\202\316!\377dk\312"
+	.ascii	"'4\235\323\001\\#\222\333v\264\2260\311Np\334\321\205\316\363"
+	.ascii	"U#\232'\003d\216)\037\231\313u(\236\256f\234wY\210YV\373\342"
+	.ascii	"\232\372\350\313\200*\276\200|\370\242\275\277fy0\013\216\360"
+	.ascii	"y\252\370<\245\230\346'\377y\211~\312wy\252\337\250\360\307\016"
+	.ascii	"\f6\024Yp\330\204\351=\006^\364\003\375\244\233YP\303\216\223"
+	.ascii	"\204\251\300\351\230~\322@z\250\023m\270\252!\303JM\202\303O"
+	.ascii	"M\204\375z\350?\223\345\262\241\033T\021\241\274u\320\314k!\026"
+	.ascii	"2#\201Ry\307xq\227\227\215\367\340\317\243\370\363&\376\334\210"
+	.ascii	"?\347\341/\224\302_\270\204\277\320\b\177\241\031\177a\027\177"
+	.ascii	"\241\016.\210\377\"`\245\324$\006\340\037\327\t2\244\205\277"
+	.ascii	"\354\307\302\265sD\224\367\013\221\370\013\237\374\205)\370\013"
+	.ascii	"\233\374\327>\036\345_\340d4\351\311\343\277*\341\277\266\361"
+	.ascii	"_\307\370\347i\326\n<;\203y\317\314|\306\373\030\314\365\327"
+	.ascii	"U\344\34528\303\332$\215\212\255F\336\177\227\355Z\004\340\002"
+	.ascii	"\326\242\305W\025\377U*f\315I\262\022\374\376[\246\37322,\036"
+	.ascii	"(~\202\376o\353\257/\344\220\274HiA\311\213$\307\t\223L\203\374"
+	.ascii	"\344\375+\021\377\325\311\361\023\356M\377\004\265\250{\313F"
+	.ascii	"\206fLkD\374\370\253x<\263\261\2241\321\375\260\345\"\377\337"
+	.ascii	"_p\304\271I\351\370\253l\034C\311x>\313h\370}#9\355\207i(\304"
+	.ascii	"\214\344\375*\030\377\023\3407\262\276\252\305q\224\007\307P"
+	.ascii	"\234a"
+	.string	"\245\340\025\303j\302\036D\236\302\302\336\310\236Z\343i\002\"c}\321\374\202\374`R\301\334\242\034\361\301\301\245\217nG\232w\035\035\240\325^nA\005%\342\003\377\270\232\032Q\305ye\027x\f\004\252n'\345\013\314,\250\242vR\276l\225\223r\315;?\275\207\226\244\323\344U']V\375\231\267j\247Jy\317\325\023\233\032\366\302\343O\005]\336\237\301\350\355\325\2707\265N\323\265\364\246W\037\022\232\271\325\361\361u\347\021\007\226.\025]H\346^\255{\225\016D\210\177\302\245Vt:y\253J^e;\202K\233&Q\331\250\240\300x\344\375\036p\257\026DDy\253ry\307\023\240\274\274U$\277\326rT\3077CM\037y\232\333\311[=\362j\013iLPNQ\340\306\350\224\242x\374)X\362\343\207\352\246\001\361\333\217\240\315\274\031\036vSiC\266\025>aB^u{\265\rD\210_{z\265"
+	.string	"\363V\327\324\"*\033\216%\300\2368\256\022\361 \277\360k\002<\243!\227\243JM\035\0226$DE\033W\321\324\264\026`I\004\323\270j\246\236\351"
+	.string	"\325"
+	.string	"\313;\343_[\277\303\007\322(3\312[\035S\203\344\270&\276\23622\0264)\263&e*\231\212\026CE\0226\035U\344}\021(\326\204C\252\350\271\262$\t\305\2240\025H\217\0252p\274/*h\177U,\306\262\262T0\031hS\017\0035;\271,>\254\304\nZ\366\276\n\366\352\327~j\376\365\360RqH\371\224\240tm"
+	.ascii	"\211U\023\005>4\030b\005\321)\222\267\312\365k*\f!0\324\362V"
+	.ascii	"\267\036\357\231x\365\345\255jmU}\225\212\205/\274;L\304\242"
+	.ascii	"B\2736-#\365\352U,\254'lBI\323T\351P\353\252\205\221*Uy\020\035"
+	.ascii	"I9Q\352|\310\023\220\225j\265W\274`\202\204$jjJ\245\222\2016"
+	.ascii	"\363\020\300\202\357\r\326\335\345M\345\245\223\220)i\002\305"
+	.ascii	"\037\352U(5\212\275\372\020Fs\223\313\222\366~\304\341\305\005"
+	.ascii	"\324\307.\327x5\372j\016\020!T)\2560\030ny\253QYH\375,\357\247"
+	.ascii	"\300\207\277zC\305\321$\t\031\221A\376\252\r\341\034\f$\271\274"
+	.ascii	"?\307\370i\240R\371\264\t\311[\245\361k\177{1\362Vg\374\023\027"
+	.ascii	"H\270\270\362Ved5\225\260\033xmy\017O\275jdQ\370\343+\254\362"
+	.ascii	"<~U\036\365IeC`\363\210\003\226(`M\216\344\355\344b\203I\372"
+	.ascii	"\243\204/\251P\365\205\212\244\302P\217T&UIM\302\257\332\244"
+	.ascii	"\262x\265G\365A\241B\005\032\232\303\033R\237\f8\263\223J\347"
+	.ascii	"R<\355\244|-T\027\\Dj\221\023#u\305\007\255\242\037\325\331\001"
+	.ascii	"\227\332\244\006\251BO\"h\305\331Ie6\330UB\340z(\330\377\252"
+	.ascii	"\213$*H}WMi\374c\276V\354\261\267*\247\035E\202\273/\007\017"
+	.ascii	"$\032\3176\026\036\"dS\362\376\030\027Bi\353[\325\021\264A\240"
+	.ascii	"\035e\251/\020\305\023\376\030\220\360\307\020\304\371\006\001"
+	.ascii	"= ()\337o\030\206\031\374_\325QutT;\241:M#\326\222\246\322\370"
+	.ascii	"zg\343`\245\r\311H0\357\307\3603e\017NQ\273\332U\271\035Qcy\363"
+	.ascii	"\361mA\336\224j\n\374-\310DB\202$\357\r\270\303\236SMZ\177,g"
+	.ascii	"N\035z\177\333\217"
+	.string	"\351\206\227\212*\265\r\320I\250o\347\3206\216L\361\360\343\0173w\267\367\356v\024<\274\035\005\367\347\032\032\224\337Q6\232KQ\231\024\235\274\267^\336\024&\b\177\230\250\223w;\331^\332IB\232\335\264?_\016\036f\211\177\007\274\355\360\273\355~\215\204\276s\020=;\007\017\263\202n/\241\333ok\357\370\205\016=\353\352\366\033\356O-\"\030\036\376\027\236\304}\334N\222\243\3024\024e\323~\264\"\311\236\313N|\354\\\315m9\243\261\025j+Y_\257s#\311\315\273\276\262=\"G\216\344]\3202bd\277\221\320{W\241IO*\375\275\337o*:\250\236\200\240\206\f\331my\037\362\272\330~\267a\265\237$\200Iy\357\"XoE\211\207\215\236\2747\221\314\004$,i0\357\275\226i\350\256B\207\353\302\263\254l\247\341\243\336\214\262\001\356)\344w\332Fc\361C\303\321\314{\237\r\355\320"
+	.ascii	"\177\360\231\355 Xo.\311\256\356\345\215\377\376\332`\277}\274"
+	.ascii	"\217=\306{\3579\320\216Vp\330c%\020\353\261\267\303Tx\374\344"
+	.ascii	"\301\205m BX3\314v\320\367#<C\366\017-\330\002eo)\210"
+	.string	"\030\377\317\377k\327y\366\336\213\324\267?wZ\036\253\030s\370w\301\032g\360\337"
+	.string	"\022\275\357L\211\213\302\251\314t\2246\364W\343z\347qj:\300\211\210\307\311\205\023\314\2517y\242\2320\317\356\324t\202\365\016\323yx\232$\240\035\306\t\326\211z\217\034\021\356\257S\263\363@;L\347\351:\033\234<NDN0\035\"\030'\230\023Q\007s\352\027:\217\3163\005O\177\302t0\247\274\016\006%\272\340\004\203\0229\301\234\2660[\212\2774#)q3\234\340.'O\027\nZ\322y^\210s\276\320\276\244w\034\346\323\237\031\364\276\004}.\321q\201\317v\342\204v\312t\240"
+	.string	"\b\332y\202v\2368\347\016h\357;vlz\020\b\3157\256\327\300q\315\030K\035\310\247\367"
+	.string	"\004\365\336\304=\256\367\336\354\275\013\237Ko\357I\027\234\321\240\240\336\217d\202\372R\023\315\247\367\034fwF\344\004{\202\316\240\375"
+	.ascii	"\213v\024o\023;\201\240=\332\2278=9X\263\253\003A"
+	.string	"\341Q\"#\275\274w\327J\f\267!P\224\370\357\367\177om\256\325\254G\226Q\336\371\2113\254\031d\315\374\326R\355\354\240\314\345\215\001\216Y\2576\226vB{\221\001z@\355\216\002E\226\005#\2615\201yd\221n\262H\223lq\224\233\005&\002h\324\267\351P\223<.]\246\n\312\245\215\253L\ni\210-r\273-\363\246\275Y\221\310\234dR\231\024\272\304\233\245\222f\245q\223\307%\016\215\020D\0073\313\215\263\276\200 \202\251\\\026\2177\334e\036\2239\025\270,S\310d\266\305\"q\005\321\301\214\n\033Gu\207Lv\310r\301\002\030\226\030\0244\240<\032]f\206\345\2625\272\314\325=&\217\031T\320\300\314@\233<\"\215\304\226D\214Q\002m\r\361\346(|\371\320\301]\022q: \221J\034\267\255\251\300\330\222\340\210$\036e\220\304d\216\004\230G\013(hYf\216\005\311cMkB"
+	.string	"\3561Y\242]\342\260H\367x\002\206/\036\227m\262\255\341\017\202\b\017D\214XA\370#B\370\020\302\207\365G\20403\023\202\210\031\376\"f\364\352\036q\230,3\307\204\207\032\034\231%O\0361p\304a\016S(\236\300\225\314\343\221\251,A\305\305Q\022oH\254\340\362/vp+\200B\211\023<\270m\315\222\350\026U&\353\302\314"
+	.ascii	"R\205\231"
+	.string	"\001!\222xb\331\272\311\022m\nG\034\246\013\013\305d\353\022+\320\342\276M\207\032\034\013\332\022Z6\223\2559\322$\225#\f\2117$Zf\316\272\266\305\343\211\326\270\326\020Q\250!\242\240<\nk\210(\270\305\026\331\236\200s\264)\272`X\266G\232\243\233l\215%\2107F\227\267\3510\263O\264FV\250L\036Y\225\024\222Gd\222u\231\334eY\236\223\343\262\254\320x\254a]\346\372\301eO\264F\226\025\236h\215K\226%\205\025\227u\223\305\024\220&Xv\205\311\272L\225\233\243Kd]\346\315\333tX@\261\305ar\227mo\216.\313\362b\313dO\270k\261e&\331\023\256\360\346\350\026Y\227)t\331\232\244\022\311d\221Hb\221\311\002\223ea\214\355\211e\313l\227l\321\304\021Y\303\262\027\366\333tp\2139K\227\351\201\331\342\260\340z`\272G\023\036r\2225\036\254\220\223<\"="
+	.string	"A\004+b\304\n\036Zc\016\262\230<zX2s<$"
+	.ascii	"\204\261e\346$sX\276.]\234\026#\261]\016\227.\216\213\n49-49"
+	.ascii	"&X\\Z&\321\004\213\223\363bL\266l{\202\310la.\333\024\226\304"
+	.ascii	"\033\226'\217D\233\"\273*\223-\362H\303\nA0k\210H\032V\350\262"
+	.ascii	"B#R\311\262$or\220\312\"\273\314)\262,n\313tO\260C\232\034\023"
+	.ascii	"\356Ri\303dU\\v\005\004\021\254\212\3332ih\224\254\220\305=Q"
+	.ascii	"l\215\312\"\313]\330\326xT\201]\211@\005JH\200\275@\t\226\273"
+	.ascii	"\314#\322\205&\307\004\313l\227m\273\244a[\\\266%\301\221\271"
+	.ascii	"\2060\022qXvm\215\312\033Vu\22187G\026\203eKC\223cb5\261\262"
+	.ascii	"BkL\226H!\231cS\\)\262#\264n\213\304\271Q\216\300f\320\262\025"
+	.ascii	"p\242K$\221B\221h\002\211$\026[.P\223<\032\223-\316\205\366\346"
+	.ascii	"\210\202\273$\272'\020\227-\216\022\203\233\314Q\216\320.s\220"
+	.ascii	"G\"MKRy\024\262\340\036\213D\034\342\b65G\233\026w\205\326\002"
+	.ascii	"1\255\t\255{\\n\340\350\"sn*h\331\023\\Z\227\3502U\367m:h\260"
+	.ascii	"q\223\312\022^\230l\t\027\230)\024\225H\b\334\344$UH\224\270"
+	.ascii	"i\225*\211\022\313v\231\343\026\21149I\342\315pI\264)\356\366"
+	.ascii	"\206h\001\026\227\005\361\001\222x\\\266'\270,\225# .\225\311"
+	.ascii	"c\tI\345\221y<\321\232@\201\313\212\230\341Kb\313\201\034\243"
+	.ascii	"r\2113$\272\355\r\177\233\016\306%\321\230$\272\007x%N\273\364"
+	.ascii	"\340*\225K\017,D\227h\334.K\342\204\021X\214\314\2426\266H\023"
+	.ascii	"\304d+D*\225\020`Uc\353.\333\023\311\022I\345\321\b\343\262\027"
+	.ascii	"(\261\223G\f\270\305\326mI\270\270\354\b7y\314\021\"\333d\222"
+	.ascii	"h3\002\361\306\270\36233#l\310\200\005&\300\213\035\220\356\221"
+	.ascii	"\311\032\227\304\242\221\351\201\271lO\034\227F\017\311#\361"
+	.ascii	"\306Cq\311\364\320aC\f\267\341\216\262?\351\223\212\245\246M"
+	.ascii	"-\3419"
+	.string	"m/\225\036%\274\274&\225\n\006\020\n\271\025\252F\207\364\362\236\344\275*\255J+S\356P OX\323\365\305\257L3\250z|\344\275.\345'+\"tfj?EjL\201\374\177MZ\221\214\232\234\330\345\035\304\231\204^T\035\251`;\274|\232\344\275\266X[\3547\022\232!\3202\334\361\225\305\005*G}0\216V`@\226\272\037obFj]\034\327`\215\"=\264$iG\224\225h\211H\354m}:\231\366\350\177B\277\016\275\252\307\244\351\324\013\332/\221>%/ (/eYK8T\250}\213!\321x\372Q\005U\236\b\216)\245\240\321\3225d\264cu\256=\335\245\355\254\211\224\025\305\306Z\271\261cGI\336k\377_\373\332\003\002\267\273\251tE\312gtd\325\371\265\347W\236\035H\024d\267\2636\243\202\323\2375\026\247 \241\027j{\257N\331S\005sl4\231\222\256 e\241"
+	.string	"\362\367\252\340\253\201!RH\361\001\250\206F\245D\365\3735a\020$=}}\377V\306\347\354\343\333l\320(\f\225O\303\321\355M\221\362*\\\021\n\251\263\026\206\236z\316\236\322\322T(\033\305\325XV1\346\204\305\335\253P^\325[\201\243\361t\222\267:U\3638Z\035\226\020<u\210V\022YO\336j\0215-\306\037[S\336YRuG\362f\302Du\002"
+	.string	"\244\205M\250C\303\323\221H\333R\2141\205jfD\322&\215\001\223\024@P`T,\031\017v\305\036\023\200Rh\224\221\244I\031C3#\"\005IR\217\3120\006\021#XE7\206\0210\031\253]y\0317#\265\374\002a\316\002\027\326\242\006\233\243E\303\306\025w\341RX5\2746\264\2213Mm\3263"
+	.ascii	"=\263\213\327\356\324\005\206\255=\2621P\3378H\2517U9\273\205"
+	.ascii	"\207j\350\b\305\242Z\350\237\350@:\3632]N\032\207\326\303\271"
+	.ascii	"\222#\2750l\230BW\r\231"
+	.string	"\322\253\276|9s\343"
+	.ascii	"\262;\214\315\322\002\332\270eL\216r\212\222\362\250\305\344"
+	.ascii	"\013\017\332\212\311\212\030w\032\021\344yq\331gu\271\310\024"
+	.ascii	";\270R\276@y\234\330\332"
+	.string	"(d\f\202\207SFc\277\314\222\036\355>+\243\022XL\r\210]\n\r\301\b\334\213\b\034d\021x\333\201\263\340\216\361\026\266r\004<\344\260b2\2344\205\\\245\302n\216\2708\221\210\275\344U\360^\251]i\352q\031!\240\317\352c]\267\277\f\346\006r\353z&\311=a\026\306\313\024\262\321\206\003\346\221r]k\213\021HZiH\341\007UzX\322\226\304\344\353\323\323\341\342\357\263\352\002\240c\363m[\214\3216BN9\375\330\2444\256x\266\367\2618[\033\226\271\004\251\017\251\300\271yd\241\250\247\267\b8x?\220V\276\016H\313\2479\201\241s\356\271\215\267\357n\226!\027(\251\007\202\023\271\347\327\364\202{A'8\376o.\331\201\374\037(\247\204\302/@;\242M/G\016\003B\024m\275\241\r9\324\353QL#\r\270\265\350\307e\307E\331Ou\001k\355.\303\270\027|/a.\252"
+	.ascii	"-\210{{\235\346\215\240/X\317\342\"\370) \242\230o}\307R\350"
+	.ascii	"3\350Q7\227\"\021I&\321D\312\365eV)#\314\221\b\207\006o\356\002"
+	.ascii	"\f&\225\201S?\276\007=Q\031\351\235\251\376\330\331[\001\001"
+	.ascii	"\006\261qF\321G\230I\032S\264nch\360\\\306\265\026\030@\252G"
+	.ascii	"\236S\251z\274\315/&"
+	.string	"E\255\342\316C\265\200S\272\232B\307\203O\335k\321{\003\361\344\262\221\205\205\222\017l\032{\356\252N?i:\214\033\"\t\340\343\2422\252\t\201\006$}Dm;\211=\314%\251\211\201\255\313\037}\260\374\013\005\363\351R|@\200a:@E0\020\372k\232\333:\r\027bl\2064!\315#\375\256\300\371]\364o\027\256\256\\\031\24561\333\206\210c/\350\325\007B*O\230\355\2452_\246\236}nU\271\251\377l_s\322\260R9\002\236\001\264\373\227\t\331\214\"\320\2160\266\223\342\370L\320\327`D\230(Y\021S\232\r\002\345M\225Z\261|d\002\363\305\360\242\254{$\257\312\177\020\332\357(\300\\\245\303\247\245g\n\261\263\343\3528\335m\177\rer\214\te?\344\305z\334\017<\244`\230|-\364m\326\002\255\203\"\334\263\224(#\025\037^\222h\224\016=\343\223\301V'\271\230\353\343^"
+	.string	"e\021\225\223\206\b\214c\317\377\2257\242\343n\306\227\313t;\210\rGsAR=\n\177\203\207\026\350\034\247+\236\230\251\220\257B4\331\304\033$<|\231%\215$V\256^|\260_!l\r\304\356q\003\353\307\313\362\025|LdNF\314\314\213KHV\377\030\026A6Q\240\322\316 \241\360\355\n6\273R\334B\366\210\222g\316@\001\215]\250\334a\"lgI\336\346y\f\226\n\330\213\277\223\\\221\342'\304\30600B\3403\f\234_d\257\021 \353\001\226\220>\257\324FN\324\003Bz\243UO\037\212%\240\270\020!\tL\210`V"
+	.string	"\247`\374\302X\240\020\216\234\027\n\237Rn\025\016,\341\312h\335\272\037V\313S\216\253]\001\321z\340c&\351\214\264\255\323\177\246\360\235\277\030\223\f\252\373\260\016\333\3714\325\021\004\325~\n\225t\320X\202\304`\b\360Y\317\274\257c\354H\300|\343V\223pg\310\234\235\204\274n[\341\335%\262\233B7L\003\\q\001H\304\313p\277\203r]V\305\006\201\356\3432\2347\322\356\375\244"
+	.string	"\254c\315+:\177O\241\020\354\013\363;\260\267-!\"\364\002\310B0\241\002\255\234]H\220z@(\243z!\004A\326\334\350\003s\234"
+	.string	"\266\361\220\233K\222\271\026\013wP\233\332.\0205\210\371z"
+	.string	"\bU\357\260\003\304\243\036\221\02660\225\354&{T\260\272\272h\277\343<F\334\333/\262\212S\374\252\200\204\016]\226\220\311D\271<8\20120E\361\324r\211\031\303\210\"\242f;\272\252K\264\021-\3563\272\253B\026\234\3300:\225"
+	.string	"\273\360P\343\271\245\317\237\t\343G\362\275\2006H\022\335\371\"\027\022\353\202M\326\254\255YZ\262\341kB\263\350\037^\252\030dc\226ys\"\027\007\276=\324\021x\331\251$\307\022o\266\341\332\320\360H\334d=\002\\\364\234R\227\244\343\"D\020\232;|\002\271\005\202\226\247\236\f(\216]\026Q\007+\216\341%\273\224\177\221j"
+	.ascii	"\372j?tZ\265\251\232g^\017;\364mI\277\232\2411~\264\305\241\332"
+	.ascii	"\3733\312\257\016{F\303\242f(ar\233\177\210\224\240+\352+E\217"
+	.ascii	"Wnl\256\002M\301\225\356\356\217@\277n\031\f\005D\345\373\001"
+	.ascii	"\"\t\370\267XU#\257$\355\027\300\354\273\245\300?\261\204\257"
+	.ascii	"ZT\t\335\327\310\214\035\204.r\n\tnm>\373\371r\237\266I\260Y"
+	.ascii	"\022\0314(\315\2109h#\340\322\361\352\275\377\025\003E(\t}\210"
+	.ascii	"\331\023\001\300\213\022\351\022`$\332\363\311T\231?\325\212"
+	.ascii	"\226W\004\355\305\312<4\001E5\336\372\350\275\323.\3644c\336"
+	.ascii	"9C\333\223\016\210\352b\220v\375\306\027\200\245&<\177\252\030"
+	.ascii	"tOy\004~\365=\261p\"\213I5\324\314]@\213\354\252\304\364\353"
+	.ascii	"\220\017\326T\017$\200\003\212\320-9\217!G\215%\334\206\366p"
+	.ascii	"|[\224k\352\302Q>\254\t\254+\260.\266\230\013p\2248\231[di\225"
+	.ascii	"l\357\r2\277w\307\326\344D\361\024\0276(l~\303\032\310y\250t"
+	.ascii	"}K}C"
+	.string	"\024\273\324\312p\210\263O\230'\351\334\370\370'T\242V0\221J\366\357\230\351\003o\353\305\213\202\rV\f\370\363\017.\215\357\342T\273\234_,|L\200y\304kt\334a\346\202o\224\225\030\336\201Nh\265\343\274|\216I>\377\243e\300H\300d`\263\256\013t\344\244\001R\311\f\333\3528@\345`z;\277k=\226\360\323Kd\035.\333\004V\374\002\f\275;{\240\260XiP\"+hS\200\264W\217\276J\020{K\314\336Hg\360\003\234\202%\352\236\016\261\rs\007\307^\227\230S\274\306\236\320k\314\261\007\004\203\b\\E8\267}\nY\r\220\220\324^\374\022\335\323On2\021\265 \035\016`o\247r\026\330 \b)[\037\220q\224\023r\267\350\231\020bu\366-\266\244\361n\301\241\"\005x\350\203\260\3647\347\007\005\354\366*\005\316\247i1\353)\246\323\260\371\177\222\302\324\025m\363L\025\t"
+	.string	"\272\223"
+	.string	"\375\370\262\225\002Qr\b$\031\211\rnk\210\316L\350IUS_\351\374\212\222\\\303,\342q\362NZ\275\270\t\332"
+	.string	"\303\373z7\377\212\247\317\354\321\002w\361\321\344\342\354\214S\317"
+	.string	"\337\032H:\375\330\177\303{ RIu\036\236\254\362\005]?\032\246\207\233\"\214\204\360\025\362\303\f\032\006\364\313\324\312\2017\025\266\276ML\fn(\t\302\340yf\302/'\277s\230\313\017\376V\347\277\214G\320\3302\036q"
+	.ascii	"\260\356\371\331\265\323$\373\342\373\342\352\210N\266\314\001"
+	.ascii	"&NV\016\025~p\215\246\022$\315HJ \353C\254RFVm\225Z\241\375\262"
+	.ascii	"*\370]#3%\027\303\213\n\030\350\327Y\353d\352\343\363\271q\037"
+	.ascii	"p\240\311\3618\370\004\233\006/\3612\"\206\225i\207n\016hCv\265"
+	.ascii	"\027\321k%J\241\347\361@\270s\274J\226\300"
+	.ascii	"\371\356\237\341\205\316s\232\f\"@\345zJ\256\371T\f.R;^\344%"
+	.ascii	"\2110\312\310\306\300\225\351\345CQ\310\357\006\257N\272\232"
+	.ascii	"\253w\342\021\200\311h4\231\\k\354\032eB!2\307(=7\247(l\341e"
+	.ascii	"\220\203\344\333V\344c\307b\237\276T\305\355\0247/[\327\274\221"
+	.ascii	"\271Y24Z\314\322\035&%\304\233D\200\200\237 1\262\275H\030.\325"
+	.ascii	"!\\\204\t\001$\236\230>d:\325\360B`GJ\315\220\274/~\345\232\302"
+	.ascii	"l\233\323U\342\002"
+	.string	"\246\2204\313\204G/\342[\375v\265\320\331\231z\2730\275[\216*Z(\372y\226\235\024\263\030\221\177t\271\230X\n\230\235\tB\305[\032.\212{\200\212O\247rL\340H\250G\251\034\264\235\3536\354\327,P\204c\272\371[\022x\3257\314L~Z\317\222\243\340\220\314\353\3644O_\3764\277\344\\\200\311^;\326\267\200\331X@\271:\232\345V\302X\032\315\326\316)O\"\272n\347J\2705\2717\004\202\3518\327Y\020\244\210N]<\n\244Z) \372\006\003\342\004\037A\361\n\342\242\204\273\210B\030\305{\261/\204\030j\232a\340C\267\311}\242\363\247\310M$\257\362\363\313\344\252\223w\006\374\242f\n\360\377\364\\\361%6UX]\343\031\312\035\240q\013J\337\t\037]\262}\231\033\364\210\177\241czO\316Q\271\367\365\252\306\017\223\017\034\217\261\355\357\314-r\017\350l\355x\244\231\260[z"
+	.string	"\366j\226\017\022\366\244\023=d=H\237\244,\246\371\034\364\327\272x\211\240+R\236e\353d\314S\026/\3157\022w\262\227\341\016\n\333>z\2376\272\356\003}'\356\r\342y\332\357Yd\315\255\217\303*\265{\027\370%"
+	.ascii	"\372\216\342;\346\226\325\037\245\235\324\277v\270\322\233\016"
+	.ascii	"\337\351\374\007\264o\374\252.\317\203\216\340\362\272\177Q\375"
+	.ascii	"h\276\035\261\317\321\275\3552s\366\336\335\200\331\001\n\002"
+	.ascii	"\377W\035\037?\261\007\215}\013S\247{5\177\260l\354\306\351\035"
+	.ascii	"l^Oy\257\372=}\357\306\315\323\215\275\264\023q\363B\336\t\361"
+	.ascii	"\305\273\371\364\022\345\252\372\026\247)\347\357\235,\267G\242"
+	.ascii	";f\303\241E\272\224\017H\314\3339]\001"
+	.text
+	.section	.gnu.lto_.symtab.94099c47f3c84451,"e",@progbits
+	.string	"sdcardSitlVTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"sdcard"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"pread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"sitlLatencyNext"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"pwrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"sitlLatencyInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"fstat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"open"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.94099c47f3c84451,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
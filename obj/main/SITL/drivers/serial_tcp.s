@@ -0,0 +1,952 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`&\0015\t"
+	.string	"BL/4`O\322\030\224U\315\023\237W\245B\371R\001\013\017\217\276\344\263\372\315S}^4\363c\002\b\202 \b\002\001\2569j\322\335\b\331\204\020\262\367\336d\313\264wm\247\256W\214\272"
+	.string	"I\240\251\264\372\230\300Xl\276\nfD\007\330\244\222}h\\t\337`\357\355\375\242\007P\031\224Qf-!F\021\013\325\343\314\320CK\fem]]\rx\\N\246G\021(V2\246\334\t\211\032\007\271S\303\307\021R(\211\356i\367\204/eC\244\003\272\3279\3630\370H\222D\204\361\362&\017\003K\303\306#\224\322|\312\245;\002\031($\036\337\341\273\364\376\366w\267\353#\250"
+	.string	"\215\264\332\006\b. P\0022\253n\003a\241aZ\026P"
+	.string	"t\002\006`\257_\024A\036y\305-\250\200\200\312\372\260d\331\251\201\205\241\235\353\n\266lkACH<\270\210\030\002\204\210\261\024T\356.\026\367{R\023#\200u\237\002\213,\340A"
+	.ascii	"\302\252/\300\022D\016`^s\213\246\355R\201\355\271\344d\266\365"
+	.ascii	"\324\252'@\341\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\355\004"
+	.string	"b\006\023\033\240'\351\377\377\377\347WUU\215\375\212\323o\377\377\336\376o\275-id\313\224\002\356.\035\326\220\250q\374\3620[\366\005Gg@\n\016(I\221"
+	.ascii	"\032a$S\354Z(K\214>;\263Qd\177\r\271\355\247\352*\207\330K\360"
+	.ascii	"F$ \240\202\261\231\353\230B|\303R\026n\324@\252\004N\006\226"
+	.ascii	"A3\307u\b\366\026\355\263,\303\265\226\231L\r\004\370\261e\245"
+	.ascii	"i\237\221\013\030]X1\370\275\202\214\342\013\0063\212\242p\244"
+	.ascii	"\261\331\210\2531\314\352Z\330\214\345\201\314\2129\004"
+	.text
+	.section	.gnu.lto_.inline.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`6\004\035\022"
+	.string	"\006XSB"
+	.string	"\221&\3518\025~\334\370\360\367\3219\256\3561.\2262\3414\312\354\214\215\314\243\302!\305q\300\360\006\240\024\235\372\377\267"
+	.string	"\365B\240\337U+\200\241\3713\017L\3778\033\215l\3274\232n\215\020\271S:"
+	.string	"@"
+	.string	"F"
+	.ascii	"\243\314EG\214\026\007\334\357\212\234\"v4)\207\0228R\254\342"
+	.ascii	"~H\377\207T\375!\326\373]\006x\357\326\314L\353C\265\221\231"
+	.ascii	"\236w\0027\200\3428\212\234\213\314\354\274\346\312@\231\031"
+	.ascii	"\262\207\246\335\353\232\220\231\025\376\272'\367\210K\267\033"
+	.ascii	"E]\311L\220\255A\275\200J\231\262\017\271\222)\345\004\201\021"
+	.ascii	"*/P\020\\a\263\227i\177\314\341\3735\325\326\324\n\02024\316"
+	.string	"D\215\227c\013r\032\341\222R\300=P\201\305)\204\034\032\\F%g\177\203\366qsc;J'*\233\322\211\007\001\356\206)\005U\340L\346\344\021\031\344\372\355\261|\300\fr(\034\324Bfn\276>\036T\226\314\314H`\002\177\241\2503^Z:`o\342VH\304\320\b\320>h\b\030\030X\220\274\301\036\244yb2sd\221\267\365\224\231\025vPD\272q\201\325\251\204;\206\334\206\021\312\351Z\373Cz\277PQ\251\f\037\006\254\275\275p\250q\305!\222\251 \205Ia\2265`\002!#f\346\001\022 \225=B)\222fdF\224\226[\030\346,\f.J\005<\204\3672\220d\220fS\210\336\220\302\215\231x\253\007j}Kk\362\"\251\245\b\033\007s6$\237!\342\244b<\272\372\214^P\266[[(\271\307\376\002\003<vy1\321h]a\rr\273\016l\rPz\037OY[\261\354\""
+	.string	"\353'\346\376A\366#"
+	.string	"\242Q\235\373\270\247\265\024\025"
+	.string	"\252>(k"
+	.string	"\362`\262\024N\327\335\001\306Z\316+\237\313\364%\223Q\222\263\244\320\274x\330\360\307I\200\216<\301C\367:M\006\217\b\250@"
+	.ascii	"\356\035h\0178\377+\217y\342u\022\373!\023a\373ti\t\336\023\025"
+	.ascii	"\347\316\310\273\007\315Z67\b\337\222\322\016\f\354T\247?\246"
+	.ascii	"\200b&\013\230\367\254\237S\347T&}\204\234\353\002]<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`t\006\315\023"
+	.string	"VYZB0\217\222\016\300"
+	.string	"C!#\271\030Q\322\256\325\232`8\030X\3024\203a\363\032\242\246\335\006\331\021`\211\235K\024\317\250.\302\303\223\316/\241t\204\030\252\357v\260`\032|\362\207\371F\233\354F\266L)@"
+	.string	"G"
+	.string	"H"
+	.string	"\277H\210\373\005,\221\354\217\216@%\211\034\204\215\256\353\272?\305\017\363\222\310\031\210\032\335\247\273\361\253\372u\335\375\272\357M\340o\002\365\024\"\367\352\331\253\322\310\227F\267\345\325\357\267\206a\330\360%\020\306TOI\330.\036c\2635Fl\233\b\005\0225M\313\342_\361\005\231L\314,\212\310\375\245z-~\337\304H[\030\250'\266(\331\353U\021\271\224\352A\233s\225V\332\177c@h\210>U)'\227m+\241\337\032\022XZ\024\307\242f\004\021\245\2022\301B\206\224\n#+\035\326\350rH\370\3778\364\201\256\007\001\257\244O\377\376\001\336\177\034\3506\320\255t\013\3502\320\325\350\206t\207\002\354"
+	.string	"\366\037"
+	.ascii	"\017\231\021\257\007t\337?y\037\226\02659\23163\r\013\261\\Y"
+	.ascii	"\246\261\314\016\327\t\310\005\222\223\225\016\313\215u}\300"
+	.ascii	"<\035\314\203\325\271@\236\316\344\200\201\250|L\221\031\302"
+	.ascii	"2l\272\\!\321\206\211\001\345\303\022\201\345fc]\036\254\323"
+	.ascii	"2'Hk\231\"j\206@\332gZ\031\026v\250QI\243\324\214\210$)H\262"
+	.ascii	"\214\001\200\002\221\252\232\362\022\340\341A\212\303(\222\001"
+	.ascii	"\031a\246FDDaY%-=Z\223\024k\371\302\357|E\275+\334\315\310\352"
+	.ascii	"\225\0321\n\242^aC\222\371R\357\207\020\242\300\2527\0246\307"
+	.ascii	"4\233o\021-\270G7k)\242$-\324\354\264~r\252\300\205Z8\230\202"
+	.ascii	"?\0060\2046t\341^\007Px\253h\243\253?\314\330?/.\025\301\341"
+	.ascii	"\306l\234\263*[\260o\315\243\314P\263\ne\332\202\231\341At\304"
+	.ascii	"\334\377\301n\373\272\242\373T\244\354!\262\027\264\030\335\252"
+	.ascii	"[\266i\326\251r\b\026ZV\361N&\261\276&Dq\205\b\003\326:C<\352"
+	.ascii	"\267de\004\254\025<\026\265\357\311\321\033\306@`>\201b\330G"
+	.ascii	"\260x{d\200\345\250\313\243\034pIHWhai\216\316\254\204F\016\321"
+	.ascii	"[\345\301\326\341\235s\243U\256\306\276\323\217Ij\333z\357\231"
+	.ascii	"6\332A\036:\344\nIT\275\202\200="
+	.text
+	.section	.gnu.lto_.pureconst.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\005\002\232\005\005\232\005\006\231\004\007\231\004\b\231"
+	.ascii	"\004\t\231\004\n\232\004\013\232\004\f\204\004\r\232\004\020"
+	.ascii	"\231\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\214\001\005\t"
+	.ascii	"RM%'\220'I\007\277_\001\277\360\317\216\334\231\314\314\314\354"
+	.ascii	"\004\241f\255\301\177\261f\240\2656\264\0256\"B\315\022\333\266"
+	.ascii	"\224)\247grh6\203\364\274\343\265\340g\022:\021:\025\235\007"
+	.ascii	"\235K\347\242s\241\211\227\201#\r\321R\023H\337\331#\340'\300"
+	.ascii	"Z\312\035\037\253/\312\304\337\325\364\316\"\307f\224\351'\304"
+	.ascii	"\"\242'2\303\020\362\340\250\242\020\222\254\240\332dx\312U\247"
+	.ascii	"S\356\224+4\371\tu>\235\216\332\252|6\312\033\235\252k\316\025"
+	.ascii	"\345\214\332\337p\202\033\005= \200\002\231\252\263\0039\211"
+	.ascii	"?\021x\366\302&\225\354\177\251\352\013\355<X\377;\236v\362\227"
+	.ascii	"-\202$\204\242\031<\310\200\035\236%\330\213\003\311\301\204"
+	.ascii	"\201&v\211\366\033\002\340\002\336\222\305\315\331Y\230\035\t"
+	.ascii	"\262od\253\201\245\317;HX \210\260\207\021\264R\270J\215X\fc"
+	.ascii	"\211\021\262\036\323\215\344\325\256\254\307Dq\003\310\251\035"
+	.ascii	"\3637\370\013\234\307:\007\277\"\366\231\244\212\305\244\rm\""
+	.ascii	"0\206\306Q\357\251\306\2642\004"
+	.text
+	.section	.gnu.lto_.lto.7cfa6c9cb4288c23,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.16.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375 \322U\005"
+	.string	"\004\t\230"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}{yw\212\001\202\200\200\374\342\303\315\204\013usq\274\236\344\244/om\270\314\344\007ki\370\307\224\tkg\270\307\204\007ec"
+	.string	"?\202\210\200\340\001a_\305\001]\304\001[\303\001Y\302\001W\301\001U\300\001S\277\001Q\276\001O\275\001M\274\001K\273\001I\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\013"
+	.string	"\200\224\230\244\310$\006\352\312\031\017\202\201\023\320\016\bK\to"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_tcpIsStart.20.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030@\214\304(NR\310\214aM\300J\262\233\207\235\376\001\230\326\254u\252\263{\r\276\227$\325\020\004D\222\341U=\"$\245V+\261R\312\024ORf\322$,`*G]\355r\224C\345\024ZC\205ah\223\273\232t\331\312P\256i,\3135K\266\250\240\324\213G!\0369\260\343\215\031?l\0221\214\306\r"
+	.string	"F\251\002\026\236\f}\326I\275x\254\254\202\376<5K\220\344d\227\"\224\262#Q\210\306\317y\313\006\007\234\337@\204\232\210Hx\240\354fM1\360a\276\0217\220\340\003\004\373t0\003\020v\367\304>\025\270\342_\360K\377D\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_onData.21.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\026\325KA0\307(\035\020\335\036\225\374\334y\275\301\246\250uSk\025\277\327Z\344\024\252\350\272P\301\032lt\267}\354\304\024}\250M\030\273\246-3\303C\227\346\020\221\226_^{\222\205\034P\331\354&{\247\0247"
+	.string	"9"
+	.string	";"
+	.string	"\260\335Ja\272}\272\236!\363\271}!\363\351\320n\360\272Z\f\005%\002\036\354.\225+\017\037C\377\256'\240R\245G\rgw\035Q)\224[\336\366\203m\013\373\032\001\365\236o\375\232\026\035e\36453v\340,\003\273'\263\b+\233\004Z^\177;\364]\346l\327\021\316\311$\003\266\300\301n\235\370t\305\366h\037\3461\341[\244+\354\252^\001$\262d\333\373Kd\213\262!\001\310\007\270@D\020q9Y/\006\037\300\f\266\335\275\360\001\214B V,\237>)\3639\245\204\013\204\226)\316\354Z\212R\305\276\266\273k\251\262\037\340\273\333\263\tyD\033\036\235\317\327\201\024\374\272\321\347\343\240\037\237\016\210z>\220n\034\354\205\272\217\212<\357\243\\\335k+U\2361\231I\236\314\305\313(\247\264;@\361(s)\001\020"
+	.ascii	"3\241\t\037c`\013\257\204}\217\312\004\251l\240\334\243\210\326"
+	.ascii	"t\202\251\t\"]\263'&HD\221\315S\247\3075\274\020&\031"
+	.text
+	.section	.gnu.lto_onClose.22.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`n\002\375\022"
+	.string	"6\243{H\340\320(\035\333)9\222M\256\f\306\017\253\203nM\377\275p\354\327\001Y#.\207\346\230\230\226R\032\347\306\327\036\250\026\265\356?`~\327\023n\3267\342\021\342\r\343y\360|\260\210\2342\263\200\230\267f\244\355\275\245L2d"
+	.string	"\\"
+	.string	"j"
+	.ascii	"\372\241\252a\214I\214\303\203\237\034B\335\341\201KM\340}U_"
+	.ascii	"\273\355\365\233\314\001t\343\250\370\351\016\021\350\347]jx"
+	.ascii	"\001\363\322{\310\274\324\227j\320C\235.\t\262I1\324\335\037"
+	.ascii	"\207\370\353\221\367\245\037\231\220d3\330#\210\263iF\023E\272"
+	.ascii	"\373<\337\016\263\330"
+	.string	"\356\310\244\273ue\263\017Wyu\240\272@\001\362<k&\324\345(\024\207\327\335\013\364\270\324\352\244\263s\251\227\231\227&^\\\215f\273\315\354N5\204-\347\250>vw+\343\250>\274\232~\373Ax\2654Z%\305U/\256\216\346\352\214\253R\256\306\270\312\274\272\274\372\220/G\244{\317\216n\017\273\036\235\223/F<\374U\177\236]s\331\211W\243\300\200*\n\205\275Lc\3370L\3650\016\244A\277\243\025R\366\262\224yIb\322\315\310G\354\365L\036\361mT\356be\362\352\"K^\\\r\237\242\031\226\267pE\346\034M\304\215Y\332b6|\212\256\232\252\250\263P\025\250\r\351\226W\360e:x\267;8\317\313K\243\206\026\263p\037\260\247\345\202\0273\037ZJ\235FR'\221\022\327i\202\004\006(*'\020\032\244\004h]uE\221\274\240`V0\260\200,U\353k\261T\033@V\352\313"
+	.string	"\262\270|(V\353#\021\321\325\213\212\365\301\254V\254\357#\354\307f\034\375rDB3\034\213\234\343\2323\\ $\267\022\272\355n\030+8K\334\202\273A\263<d\200%&`#\272\rXf\311\036\377\304cD8\t\332N\007. `\002\021aU\036\223\320\345\214\361,\230u;2\032\353\277\320\220\275\364e|\335\222\2754\262PQ\005\274\213\227\237l\244n\271\017\213"
+	.ascii	"\366\274L \321\n.\331\223y\"\266\244\2617\366\303\t]\307HR\022"
+	.ascii	"h`UFx\243!\035uq3\233I\253\034o\023\320h\001o\326D\215k\020\024"
+	.ascii	"\362\350\351Y\3131,\270\334S7?L8"
+	.text
+	.section	.gnu.lto_onAccept.23.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\251\004-\034"
+	.string	"v\361\257H\240\230Q:\300;\312\020\227\230\317\370\300]\346C\242 \345<\210\301\376\004\345\365jm\005|\004\311!\360\377\316\203yf\277/\006\373e\023\361\220tz\300\203.\255\322Wu,\370M\236\257\261\"\177\260\377\023B6\2212\311\224"
+	.string	"\213"
+	.string	"\245"
+	.string	"#/7\357\r\214B\264\324l\335J\261\326\030E6\325\212N\371q\342\277\373\037Y\330\356\022Y\274*\311p\001\221^h\325JLp\272\f\314\363\356\213<\352\374\260\305wjub\"\245V\242\202\255\231\247K|\017yj\036"
+	.ascii	"y\272\347.\231\023\237\352\203\342\222\2224\265\326Z\357\370"
+	.ascii	"y:6\237\373W\320wZ\343c\007\251\220\3000\t\326x\217@\302,4b\301"
+	.ascii	"\244\261\207K\2161?r\206\021Db.%\324Z\227\201\301\031_\362\273"
+	.ascii	"\313awI\354\216W\001|\340\020yJ\266\313\006\355c\323)!\022\027"
+	.ascii	"\267{\354/\021}\211\255\273\213\b{\f\337\334,\345\205\252\315"
+	.ascii	"\355TFSA8\223\005y\372n \223\323\226x\222\3152k\255\016\366R"
+	.ascii	"\035N\314\236j\255\207:\335\267 O}\372\211\351\2060j\370\343"
+	.ascii	"\342.\321\307\255c\367cm\247\335\023\277>\037\376=%/\217\311"
+	.ascii	"\273S\362\352\230\2749%o\254\344\305!yoF^\330\310\373\242\274"
+	.ascii	"\256\222\327l\336\222\344%G^:\362\216\224\267\003Q\247\021\236"
+	.ascii	"\032b\345\242}\213\323\273\023\376e\367,\240\231\037\027\257"
+	.ascii	"v8M}O\210\fi\247\035\326\205B\005S)\350\347\364f\2546\266\334"
+	.ascii	"\274\032\346\352\227\026\233\253\205\230\256~H,F\037\232\250"
+	.ascii	"\200f\270\352\f\027\034#\0016{\327\302\205\244\305p+\273\033"
+	.ascii	",\037,\263;8\245\346>\200B\253\276\021Y\366\b)1I\274\206\212"
+	.ascii	"Q\331\003\230\200\b\243\276\201\334\325\360\252\rMq(I\263\345"
+	.ascii	"\303\334\264\217\344Q<\034\210\020\252V\245\003"
+	.string	"A\230J\r~vC\210\340\003W\266\324\276\3357\271\223\336\036j\205\206\002\373*\232\321\212f\262\007B *d\020\021`_E3\031-\305\254C\320\004\017\262\234N\226\323\341\216l\267\\Ng\223\255\270e(\320\373\355k[\200\302v4d\202\b\307\273\365j=\336M\005\216WT\313\341\210N\324l\274^m\201lu(n\274\332\221N\307\253\301\210\365\022~\215D\201x\207\007\345A\303\263\025a\247\037\245\t\210s\372H\316\036\347\017\263\326\337\201\345\267\n\251\023\344\024\262Tf\307\002t\332\225\265Y\020\260r\372P\256\314x\253\256\265\261\244Z\177\bbCN\".\332\027f\307X\002b}(M\303\003L\373\031X\250A$'\231S\252FD\224\024$M:\220\002\221\261\252\036\021 \261R\016\252\2312\233\003V\231\025\343\221\361\227\310\224\237\366]\177t\353s\\A\r5Ha\301A\360C|\215\017"
+	.string	"\253^\326\346\204V\"\230\303\276 p/\234\313\033\320,6\013\213\006\272\370\305\317&\360\027y\216\201o\210\207\330f\334\243\245:\352\023+\240\300\257\352\351nt\027(q\203\315\"&\002\233\206\037r\212\256\333\b*'\302\211\263\230\225M\005<\363\260%~\215\206\033;y)1\233\244\220\263/\300)\236b\257\237\322"
+	.ascii	"s]\376\037\220\300\245\231\251\250 \"\347[\302-\2558rdD\237G"
+	.ascii	"\367\005\365lG\321C\321\261\324"
+	.text
+	.section	.gnu.lto_tcpReconfigure.24.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\254\007\375)"
+	.string	"ZJh\020C`\346M:\201h\016;\373c{\335\022\207.]q\221\237m\212\3257(\033\215\204\205(Fc\234\271B\004)\211\314\206\220\201\2579\236.~\317\002\372s\275o\036~>\004\202\202\334\335\2324B\310\2262\005\346"
+	.string	"\340"
+	.ascii	"\003\001\375\337\331O\315\276\257\373(\332?\273o\236}k\366\333"
+	.ascii	"\366Y\202\206+\206\364\234\342\356\005\262\247\350\322\235rV"
+	.ascii	"\376\353\370\203\377\273\177f\3431:\230\314\347\376\273\267I"
+	.ascii	"\0375\367\336\251?H\371TMNB\233\327VF\272\367\311\0345\367\262"
+	.ascii	"M}\230\362\371\377\234\306j:\2762\261\235\005\001\332\235y\225"
+	.ascii	"1t/\333\360l\254\204\362\231r\022\312\247\205\302+\033\t\203"
+	.ascii	"\300_\352CO\323\366z\346b\2431\026\002\305\3068X\027\226\304"
+	.ascii	"T\263\204!i \327\261\263\373\035\211\312\022f\244S\237\325\233"
+	.ascii	"\343\344\016N\254\b\243\246\204\27421\\\027Ff\006\201\324\215"
+	.ascii	"I\366\311]el\236\\m\220wpbclM\005K9cGb<L%;N\372p\033\367\227"
+	.ascii	"\030\262\333\267\341\336\373V\212\005\341\037\361\377"
+	.string	"8\377\337~t/\226\353\302\0346/\2505\373\0026\235\372\034\002\265\366\0271\242YiZ9-!\236\362/\301kNPP\263\252\2410pv\357e\264\325B8\262\247$\322k\b\331arZ3\266cu\334\332\314\244n\313n\234F\005\323-\321\356M\262rE\232\224 \305\202\252Yy\225\207\345\372\031\216\321\3308\243\275\212HD\371lk\305\346\016\221q\025\345\222\316~\013e\333\242m\317\216F\264\256\361\333Vz\357\265p.\303f^\234\321\370|1F\263\222\317s\f\224O\266i?\316\226a\344\272z\357g\343jk\366\263y\357\275\267O~^c\216b2\314\352\373Pf\377\351\327w\372\365\233~}&\263\277\364\353\017\370\365\225~}\001\335OJ\373\001\272\217\224\366\001\244\375#_\337\310\354\013\273\037D\373\300\016\026\311B(\003\224\\\"{\357\025:\312\262\333*d\035\222\336\333\305\312\346\317\241"
+	.ascii	"\212\254F\274,\327\027\031\033o\t\017\200e?p\326 4\003.[\225"
+	.ascii	"\364\033\027\272#&\234\310\350\247A\377\253\331\n\245Yyds\244"
+	.ascii	"\205\035\312C\032\243p!\243]\323\307\213\221\375\327)Lh\245\302"
+	.ascii	"\312@\2525\262\024\222\354y-Z\261\240\377j\205\003\255X\030\200"
+	.ascii	"y9\303\377\252\205\363\266\254\002\260-|\370\317\326\022\236"
+	.ascii	"\237\f`hK\265A\314[\350Y\017\357\331Z\271\254]\326.(\237\005"
+	.ascii	"\300\316\226j\203\362\314\231\325\001\203wF)>\205w\2040\202\300"
+	.ascii	"7\016\310$J\376~\314\206\323_\235\365\013\323I\255\025\243\203"
+	.ascii	"\274\203+B\266DOz>K\322\326|\007\032\225\263\206Y\305\244\311"
+	.ascii	"\022R?\207\016I8>\373#c7Y\237K\317g\203\362\211Za\033\0364G\b"
+	.ascii	"\364\357\341\003\312\312\323\332;]z\034\312C\006\007FE\0358P"
+	.ascii	"\013\201\t\022\034N\250G\243\013U\013\201j5\243\330\242\211\304"
+	.ascii	"\323\201V\b\324)\325\212xU\244r\241\336 fi\311"
+	.string	"PS\230x:0\312\212\210\243xEU\314*\316(\252[VT\304\343\025\225\212UT\263\216F\032\005\254\212\215\305\257j@\243*\213\305\025U\361H\304\032b\035\2115\212G\253\341\214\"\225\214a\325\021k\330@\275\221\006\3618\3142\032\217\303 \333e\363\332'\367\331\201y\213\363q\034s\033\203@\242y\305\231Q\026\312~\375\207\262\337\320e\221FM\326I\310\312\205L\223l&\305\347S\330\223\017f\262N\335\203\231l\023\223\235\2407H\250\344\326`+\017\2574\311_R|.y\365\327\222\375\221\r\260\234\\\"\023\240\002\254\222\231%R\200\215`\007\020\362\356m\321\005I\221\323\013&\331\026mz04\020\311\236\327/4\300\217\025H\2632\311\366\016\243\020\017*\200\375Mq\251\001\200\211\250!<\003%ddF&\210\202$),t\240\"!\262\232\007\0210-c\020Y\230 \005I2\254\001X"
+	.string	"M\311\307\244\361]I[C\322$.\351IZm\201/\300\274\243'k\205\215\340x\310\245\244\021\030\033\3670\207X\314\306\032>\024O\350\211\n\261\020\002\331aj\3079"
+	.string	"\203]\205J=\032\327\241\235\202|\261?\210\213\277\254L\372\300\317\213\007\330\013\372?"
+	.string	"\247\316\272\rs\216m:\363\304[M\242\254\212\274\003P3\311X\2600\340A\177:L\2764\310\005"
+	.string	"j9\326\023%\265\305\001i\265\250f\321\354\210Y\265.R9\022\f\224\375^\211\363\243\344(\301*\365=\260w\373\360H\237\336\200\033\316/\355\276\332a\021\177\243\217\373\325i"
+	.ascii	"\352)\347BYR\360\235\242\352\277\322\034Zh\342\236^\203\237n"
+	.ascii	"'\037\025\2215v\332\345N\t\213\352\362\013\255\355\272|)\374"
+	.ascii	"'\257\361S[\345\321`A\202\325\274CI\226Y\324A\200|\301\237g9"
+	.ascii	"dW\200\021\240\354L\236\002\243\bY\177"
+	.text
+	.section	.gnu.lto_serTcpOpen.25.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\226\005%\035"
+	.string	"\226r\266G\220\234Qc$\342\r\225\274\347~\352\255;\006<\356?\346\310\177\316X\241\224\353\313x\262\253\006p\035\202\264\027\227O\226V\326UuL\254x\323\263\325\253r\277o!\031'\177\363\334\377\r\3328oA\310\336[\312\224\002\235"
+	.string	"\226"
+	.string	"\251"
+	.string	"W\270\243\352\203\371\344\256\231\200+t\302a\301\326\037_|\300\275K_V\367\032!XB\354\247k\265\257\344K\210n4\226q\356URbu\357\205`Z\354'\217i\333?r$D\376\315\214\305$\230V\327Q\023\345\275F\232\2157\200\376\214\235"
+	.ascii	"\372\323\362\370\357\350i\332\372\363\213\216\036\261\202\247"
+	.ascii	"-\263\324\342\222\032\022o\232\025\254\034\263t\206F\346\311"
+	.ascii	"\224$G\316PX\255I\240\206\230-\235\241\320|\020fh\343T\257H\303"
+	.ascii	"`\255\260\013\367^\327t\230t\303n;\310\266\315>\221\004V\207"
+	.ascii	"r\363}\374t\n\\}\372\323\307\241?\253\225\240cKJ\254[]d@\261"
+	.ascii	"\037Bo\177\234\262\b+\033\303\354\355\251\316`\350&\310\025\365"
+	.ascii	"\006X\227\266\261\250Z&\373\346\265K\366\245\376\235C\375\t\356"
+	.ascii	"\344\237\375\351?\360\343_\340S\267\354\306\037\346\352SVm\312"
+	.ascii	"\252m\254\272\342T\177A\017\020e\031\005j\356\235\261ls\271\234"
+	.ascii	"W?>\365\333D>\225slO\345~a\320\300I\203c\310\334kt\360\323?1"
+	.ascii	"\230\024\013&\035&P'\274\236\023\312g\n\bO\363[\202\246\2429"
+	.ascii	"\023\264S\304p3\031v\222V\327"
+	.string	"#*%v\335\336p2cdJ\016\017\003\006\246\024e\244\303\277$=|\313\213\322\353\\n\203\270\226/\313b\245f|\250\035\342[|\f\222Z\024$\003$A\031\361:\026\037\004\305{a<\365\255\374\212\b\223\204\017\372\324\247\347U|t\212v\211S9\021\273\367N\230\242\302f\213\367\336\363\370\344\304%E\004\326e}\202$\304x\236\210\327\024\023\3639Tfg3\276\234\276\f\2500[\255\215\242V\237\312,\217\221-\262\037%\007\340\251m\335\257l\r\222\367^\n\001\274\363V\344p=]\016v\003\312\r\231\267^m\004\220\257\366\023\253\365j\032t\202l\265\037!\241Z\006\027;\031\020\256\332\026Ag\353\241\020\252\341v7\036\215\267\273\265\300\355\200h+p\265!\232m\307\243E\340qNw\333\321z\271\334\216\226c\2747\257]2\272\343\353\by\3128h-\243\220\246\377CO\213d\373\264\276"
+	.string	"\264At\347GEb\221^IiJ\020\244\306\360\035e!\327\314\204T#\236\360TB6\035\030R\201\356\252E\307\25257\n\024\371\362\305\033`U\323\r\263\351m\276\326\374\216\\iZ]\017dJ\264\326\376%\tg\250QL\307 \"\231!E)H\222\341\340\"\021+n\003\021P\255BH\031\211\202\262dh7\354\255fK\316w\177\026!\305\n\262\221U\271\341X\324\241,A\332Zp\355\336=x\217]\267\315Ma\177\205#\220\007uT\317\234B\333\234B\233\316\320\025"
+	.string	"\2145\317\202FB\247\0261\366w\007\025\347\315\375H0&9bt\215\r\223\210\351\317\232\236\247\302x/\020\r{\372\032\360\n$Z9\005<6\366\244W\346\034l\362\353\213\203R-\273|s\234\206\270\327\b\311\234\267\346f\371{)\245dR\375\310L\375:(Q\225?\357\320 _\215z;"
+	.ascii	"\t\006>1\350C$\211d6\251\255\325y\016\305\004F\317\271\n"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.26.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\361\001\305\020"
+	.string	"6\037nE\360\262&\035P'\335\021\260\177xGY\270s\306\345?\rN\233\316i"
+	.string	"l\307\305\314g\330\232Q\263\266\r\241\315\203]9j\001WvR\265\260uX\234<\306\344;Y\361\376\034\327\260st\254\222F\366\2262\245V"
+	.string	"T"
+	.string	"^"
+	.string	"7tv?\004\346\264G\177\232m\037\305S\250\330\203\037\314+\213\225\330\020\333\261\373q\241\213d\217\360\001\262G\035q\357\021jz\376\247\004\322\310\344\270^\252\307\226C\320\253\345\032\362j\301\320\356\336\346\311\362be~Jv\327\351zy\270\263\333v`{\201\235\r\002\361\n\212\311q\205Xe\217\375\251R_\354\303U\027{\003\375\373?\257\2713\230\2160\raZa:5}\220\rD\r\003:v9\364\370X\236\b\303\304k~[\305\267\361\346\327x\232\252\203v\023\243\301\261\373\035x\264\002-\323>\354*T\376e8\200]\227\003tD\240~V4x\300VP_6e\020\263\2632\303\312\335U\251\276X55\202\315N+{\330\026\335\2057\322\242\200\352\b\t\230\273\263\360\004\300\330\243\343L"
+	.string	"I\215\253\031'`[^m\n'y\227C-U\331\277\301\2206\\\266\351+,h\273\233 \206\202\""
+	.ascii	"#\363\350\247d\017\251R\212\251\213\243\256$J\241J$\315\035\t"
+	.ascii	"J\2272\251 \"\235F(\016u\032] \235$p%\222\350\204\353N(\216$"
+	.ascii	"d\023\312\350\304\245L\246\023\267}{u\361\203\030\020\244\032"
+	.ascii	"d\300t\323LYlg\032\302\362\201g\245,\b\211\323\303\323RU\214"
+	.ascii	"\n\322\377X\231\201\232\032\025\346X\021\3012\371\013/' p\002"
+	.ascii	"!\302\343\001I\002\366?\374\362B\244\031\321\340\005\341<z\371"
+	.ascii	"\017BW0\216x!x\210\217\341\231'I\362h\303\013\341\3349\351>g"
+	.ascii	"\240\255\222\337\342d.\210\306\035)\034\372\276\241\031\207?"
+	.ascii	"$\b\030\267\232\200\324\202\341\274\230\317s\333\035\224\200"
+	.ascii	"\322\343<k\214\237\336\332W\006"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.27.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\206\002m\023"
+	.string	"\006d\177H\340\320(\035\330\003\327\35580_\244W\211\004\213\267\250\261IR;h\235\363\310e\310QK,E\356\366\377\255!UP\262\342*\177\342aL\337\003\b\002!Z\343t\304g>\030\031^\345\245`\274v\343\210%{K)Sf"
+	.string	"e"
+	.string	"n"
+	.string	"\n\274\335_mZ\342EG\013\032\240{F\006O\367\210\340\237\247\363\243\367\377:BI\274\\\224#\315\254\303\351\\\300\331\350\036?\223\022\350tJ\025\320\351\344\016*\352\224\274\342UT\"C|`!\233\265t\306\250\364\230\305(\227f0i\352n\305\351\302\314^\273\242\222\356\376\312f\032\364\235\3767\371\337\340\337\026\001\006hjt^)t:\225=lvd\033\\\233\373\307\3262\355W\331<\363\353M_\"}\350\250\332\2418zO\356Er\337\311\375\224{)\367,\367\313{\005\031\375\300\030\031\352\306\220\313\321A\263\007\204\336Tqt\377\227\353\215\342>\302\021M0\220\206\321vj\013\364&z\255\f^\016\016\210F\367x@\347\003\035\034\206n\330\346\344\017\336\027\261\232\344\345\311\323'&\363:\321\025bHO\001\311\242\333\214\0336\227d\032\211\035\330"
+	.ascii	"\305j\257\355\356\0263\355\314\313(7@\260\305\361\377\244<\342"
+	.ascii	"\310\216\b\363\210\007\333Q\232B\034@\363\203\252\023\201\264"
+	.ascii	"<]B\"l\243U\376%\254\254\312n\202q\353\327\023.\033C\366\253"
+	.ascii	"\324\304\004\257\273\023\344\250\254\002)\340\312\004\f\031\254"
+	.ascii	"@\226\013J\007\210b9\261V,)\357(\222\026\024\353D\345\224\n\301"
+	.ascii	"\325\267\n\301\n\2510\345cI\235V>T\270\372HLW\265\200\341\307"
+	.ascii	"R\251\302o4\266\312\346\231?\370\221\037\2545.lLb\217a\376\227"
+	.ascii	"\270\004\343\023\344\342\027\204E\241\"\b\306\255\003\310\345"
+	.ascii	"r9\025;\021\227Xk\304d<\356X\304\235P\254\366#\212\370\204t\034"
+	.ascii	"0 \240\002\2419\333\001_'\364\240i=\261\216\274\220\321\303\352"
+	.ascii	"\274Y;\035\006\216X\"\016\003?c\254\315O\355\245\t\347\276\""
+	.ascii	"x\200\217\341\231'm\362lC\205p\356\004\351\036g\240V\221\337"
+	.ascii	"\"d.\030\215%R(\364\026\206f\016\017\22288\016(\305\261\033\242"
+	.ascii	"\246K\036\265\226C1_\347kw\320\002\312\216\363\2561\352\364\326"
+	.ascii	"\2322"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.28.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\022\001\005\r"
+	.string	"V\230XC o\224\016@\270Lg\306XZ\003"
+	.string	"~\303\\9\320V\263!(\252\227\316\005\271a!\305\275\375c\375\272\"\374\207e\355NT\2204\021\244$\030\020\200\221\364:\337l\004\032[\025k\203H,!R\246\024C"
+	.string	"@"
+	.string	"J"
+	.string	"\001vGZ\244\330\215\b\f\265c\216\037p9\246]\300\345\230mopF&=\252PO\271"
+	.string	"9\231\261\033\241~8\351I\362o\362K\304J\305)\244\364\314\032\354\256\363\024\242\341\326\3336`\233\201}\017\001\366\257\335]\353\210\375xgg\375\327\225\326+\235\232\276F\001\030\"\035R/t%.\252\205e[\230\312\352\361\267G\276\2111~$iJqQ\033+\024\222\003\307\254@\313\264O\362\222\321Y\027\036\033'e\243\312\001\301r\347%\266\214\312\346\216\"\201@\352\002\016+DJX\230\274\332\023<\371\2235\030\264d\377\304#Y\234l\320IT\320v7\301\210\216/\243\nq\314\267p9v}\300bZ1\261\341#[\354XJM\005\036\242\220\307\301\327e\334\366\351\210\276O\247y\333\2046\021\007\205N\347q\037\374<\256\243\363\"\300O\327\361\300\315\373\340FcP\210\363\240\b\004\362 &\356\355L\001d\220\321\372P\023\204L\211\321RM\315\364(@TL\034?\021\030"
+	.ascii	"2\003\3020\273\t\023R \254I\301,\017\204\202\202\201#\246\222"
+	.ascii	"\376\343L\024\254\002~\215 \236\t\321xF\212\t\r\367\205\361\256"
+	.ascii	"\331\027\013\333\211LM\260J\236j\306$L2"
+	.text
+	.section	.gnu.lto_tcpRead.29.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`M\002\025\022"
+	.string	"vavG\320\322(\035\223h\302\036(h\351\227D&\304\263.!O\225\353\322E\262\321K\032\301B\220\032\243n\370\317\352APp\355\300~Be\2038\214\355`\006\271\032/b:"
+	.string	"\370\206\275\221\220C\352\024\262\331O6\2212\245^"
+	.string	"Y"
+	.string	"e"
+	.string	"_q\0263\307m\270\200]\235\0265v\303\004\376L\217\016O\300{4}\200\367h\333\n\026\314\030\366\260\007\307\333I\262\021\032\262\033~\312s\330c\247\t\363K+\235\355\346\203V\213=\346\274\033\251\345\\Oj\263.ew\017\364\274\251\3112K+\273\353\244\325>\334\336m\263\330v`\347\211.\254\002=?\217\376\005\357\361:b\303A\013A\2239;\214\245\356\330\357vw\255:\366\303\273\344\270\037@L\227b\332\353\322\321Kw1\255]:5\375"
+	.ascii	"'*x|\271]\234\\\221=\212E%\036\376\366\214\017d\022?\204\231"
+	.ascii	"\326Di\210\247\003\220\335\020\301\243\033\2302\355%=\371\374"
+	.ascii	"(O\325S\016\266\0375#d'zA \361\037_\306{,\321\013\335\210p\221"
+	.ascii	"9w\232\032U\215jP\3102g\325No\223\024\3414P*=3@\003\252*>8\267"
+	.ascii	"\\\206\f\n\222\235z\f\320\004)5\202\200q\303\231\344\325\246"
+	.ascii	"\260\312\323\2342\323\230}\241\f\211D\263-\374\305\213iw\031"
+	.ascii	"\004\005\025\300T\2010\251\227\013fe2x\212\001_-.\251UK\345\372"
+	.ascii	"\\-\025\206Uk\302\007\263J\275|`\313\365\235R\314\212Q\265\276"
+	.ascii	"\027\213\325\372H\302}\267\252S\242'\036nG4*cI\242\024G3\215"
+	.ascii	"EOu\344\320p\033\242\005\351\216\362\214P(7Lz\f\331\204\344\356"
+	.ascii	"\306Tw\\RO%\004\355\230%\021\333\017^\204:\3318\020, \220\002"
+	.ascii	"\231\251\354\001B\241u\013,\023\256y\037\245\331p\360\022\b\026"
+	.ascii	"X\206@Q\01636\256Hp\025\302\271\317\n\371\221\304C\b\027\362"
+	.ascii	"\271y\210X\371\024\206\021\f\265e\003N\210&\0275\244{\316@XE"
+	.ascii	"\216\013\322\\\320\032\223\245\250\351\351\267\315\370c\210\205"
+	.ascii	"\215a\262\363\326\214\034\226o\345\306\336\333Z\243\007"
+	.text
+	.section	.gnu.lto_tcpWrite.30.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\210\002\255\022"
+	.string	"\366axH\320TQ:X)\206\020t\031\260\026z\360eT\232\324\036\030#\r\030`k:.,\\qO\234>\374\327uI\207\372\223W\341\030(O\341@-\201\303\027O\240<\271B\202N\220\306\336\257\331n\2561B\366&R\312\024_"
+	.string	"\\"
+	.string	"h"
+	.string	"\3354B\ft\177\205\241:0\255\205\320"
+	.string	"\3355:?\335#\202\177\236\312\217*`\252\364\364d\252<\354\037\242\343Mk\317\t\031\236\242\356\3768\205\302Tr\274\260k\267\002@\244\305T\316(7\242\315(\227h3\316\324\335\032CW\004M\266\333\255t\367W\244\221\320O\375\017\341\277\312\277D\002W\036\017k\023\377\225\316\330\340u\367\202\035\r-\006nrZS\245\362\310E\220X\002fo\377\030[\266\371\225\353\356>\327\374:\252\222\264\246:\232{o\356\273\271\237r/\273=7\367,\367\313\355\365\244\204\344\207JO\367\210\233\222\036\2229T\374W\223\377\274\177\002\0050\035A\234\003\227\240;\300\223\216\003\036\237pT\3019\271c&\212\241\221\341"
+	.ascii	"Q~H\223\245\f\350\b\211\257>\257\t\003l\335(4\347\3722U\236p"
+	.ascii	"L\310\330\3339^\226\274BbV\310\366"
+	.string	"vf\216Uf\t\005\275\001\246\330l\020\2601\247\004\251\275\202\326x)\335\374,J\003\305\313\274\003\324\242VZ\345_\205aU\274i\306\261\007\031R\253J\261P/\027k\345=urI\275X8\240V\241\312\365\271BU\207Ux\341c\255P-_*t}'\323[.\252\360{\265Z\341g2\266r\315\033$\031\202a\331\013\354\210\177\007\017JE\021\326\207hh\3061\331\261\217\036\037^\364\210E8\26698y\200(A\244\016H\020\013#\333\3351f\233{\334\261\205\035\241\331\"\371\0033 \300\002\021\242\344\001c\300\002\206(ZTS\364\r\306\311~\323v~\220\021\245\035\204qU\264QG\360\023\370a\230\305}\330\243\344\275%\212)X\205\360\271Y\210(\270?-\317\342>,\004!\323\335\006\224\0208x\222\272W\033\350Z\363[D\346\362\321X\221b\241\022\033\314\203\004\353\230\021Q\017\326\334"
+	.ascii	"\037%t\211\006|^n\234{[K\365"
+	.text
+	.section	.gnu.lto_tcpDataOut.31.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"}\n"
+	.string	"\246\323HA0\247*\035P\254\303aq\225?v[U\324}-\335\355\305\343\346\340-\356\240+\263\302\242\2353B[\303X\202g\037\001\024\003\b\021\241\006\003\003\344A\\\361JG0\220\016:Q\004\021\262\367N)6"
+	.string	"5"
+	.string	"6"
+	.string	"\373\227\213c"
+	.string	"lw\353,yx:e\350'\210\242\323-\344\223:\210\020@\240 \222\350e\001\n\311]\227\035bI\312Jfw-M\"\310\235\335\366\204\355\b\373[o\375TJ_\013}\300\036H\274v=b\0216Av\340\304b\373\322\376\352\254\360\255\320\027vQ+\003\273\343\203\353\366\314\343\031\264g\333/\3323\207\266\203\217\252R\201\200\002\f\346L\331\006i\237\025\001\032\224$\004\333\032\007"
+	.string	"\202\360S>\033\333\356\336\344\231\037\322\236}\216\234T'Vk$c\366(\2223e\237\356\356z\242\354\035\267\321x\300\215\267\231\303t8\017\305\205\306\373:\260\202_\367\361>\213\272\3614\030\225\373\300\212i0\247\323}\325\303\341|\3252\3563\243I\242\025I\247\rf\310\233L\247(\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\tm\365\t\231\347\020@+\304"
+	.ascii	"\237\t_`\312%\330f5E\334\345\246\332\243\201\251="
+	.text
+	.section	.gnu.lto_tcpDataIn.32.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\271\003\r\031"
+	.string	"\006.\240H\260XQ:\360\n\t\206\024\034\033\333\005(g)1l\267-\357\204\316\261\020\007\277\213:jx\\\203\305:\360\022\337\214\212\206\323o:\311\317\302\343O\341-\310\266\341\362\276|P\013\223\272\2323\344m#\204\354-eJ\001\207"
+	.string	"\201"
+	.string	"\224"
+	.string	"Jl\256\366{\334G\355\273\023\0270\347\020\217\2459y4v\205\227\346\275\365]\206\207\371.]\263\247\234G4\237$\005\005R\2269\247kk\030\354\365z\275G\336\235\322\332\303\024(\343j\315W\245%\267\334\316\303\b\372\250\300\361&+\\D\233(*LG\272\342r6M}@/\016\006]\252rA\217\254\234O\234\231s\256r=\272Gz\204'Y\252\314"
+	.string	"zq\005!\3149\255\267\034\320\255\272m!\333\017\354]\n=\273c\037\b\t\205\272\331\262+y\b\347\234\f\2222\2008@t\343\304w\371U\355\260\334Z\360h\317\346\355\350\352\354\333\020EQ\361\016\3312?\272[?\372c\316\373a\276\373\003\260^\316\273W?\272U\237:\365\251\303O\r\206\352O\252%\250\216\237z\245Z\243\372\005\006\264`\342\340\311\234*z[\346\223d\312a\373+\333[t\243\332\217\334\344\324\2343\246,\3159i\334 \274\234\211\3123\021I"
+	.string	"\320\350\262\343\n\317\235H)R\212\253sj\303\235\031-\351\321(\333\024~\344\265\300\bMj\027\330\370_\037\270\341\306\246\037!\233\323\213@\021"
+	.string	"\340J#.Zv\337\372Dt*\030\200\232S\206\b\244\233\225\2423m\260\020\372&\276\313o\277&\034\214\270\272rW\310n\334\243\350r\341K/\004PC\016@\355\"\200\2623\206\013\021\021Cdkx\220\233\027\335\030\033;\005\177Y\231=\222\037N?:l\233\344\344\223\333\325\331f\351\327\216q\320\337<\023\261\0222Z\354"
+	.ascii	"\323\030\f\347F\207\206#\013\r\253\t\001\323\321\360\341F6\213"
+	.ascii	"\321\\\264Yl\204l\266\301\205#\273\001\341\202\315h\256\232\031"
+	.ascii	"\347\204\210\315\\:993\327\2127\277C\023\202\236x\326&\341HW"
+	.ascii	"1\261x\352\331\235Pc\326\240jY\213\263\302\254#\270\332\227\305"
+	.ascii	"%8kgFQj\316\332\326\376G\310\026\347\2343\265:\253l\355c\364"
+	.ascii	"R\304\326\252\026\247RfwG\017G\224\331\325\342\354\203\3416a"
+	.ascii	"r\240\037XnV\344\352\374\372\224\274\b\004I\250\021\360\224B"
+	.ascii	"P)\"\023\020\005\022\314h\332b\220\002\031\252\353\006\021`A"
+	.ascii	"c\205Ar\3372*\036\326\201\216\0201y'\205\205U-/\266d\354\033"
+	.ascii	"\267\006Q\264\327\235\344p\255\301\265\225\324G\\<\351\251V\242"
+	.ascii	"\366!\222\243\222)\203\324\005\277\205\030\231\276\3240\353!"
+	.ascii	"\033S\\\344\321t>\214\376=\320,\340;\265j\210[\207\357\024_\325"
+	.ascii	"`\2216\211\351\307\222\225/`\214\257\233A,\244\035\360-\240?"
+	.ascii	"=ZI8\365\351\034\360j\360A7x\321\317\365d%\207\374\233\316\024"
+	.ascii	"SH\323"
+	.text
+	.section	.gnu.lto_tcpDataOut.part.0.47.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`*\0055\035"
+	.string	"\226\262\260I\260\226Q:4L8N\372\3129O\211t\333\300$\271\302\313\2308!\275\2371\016\264;\236\324\021#\206c_Z\226S\233\rX\336B\2756\254\315\364\377`\013\327)\376!\302\016\375*\253!\0077\033:>!d\023\271S\n\223"
+	.string	"\216"
+	.string	"\241"
+	.ascii	"\357\341,\036\244_eB\240\303\210\317\347\324\013\310S\236\360"
+	.ascii	"\3459\3773z\224n\366\253)\226<\247}\035\207\332=J\367\233Z\233"
+	.ascii	"|W\265\376\016\234\232F\236\372w\035\361\224\274L<\265\237\303"
+	.ascii	"\266\321\222w\366\225"
+	.string	"\377\236\352}D)\365\b\326Zi\247\033\343\273\217\"\rw\222;\277\304\307\021\250\326:\303\304\342\342\212\323$\0233\234=&\025\337\260@\026\254/1&\244P\007\305\214\336\253>O0\361\346\30499\002\325Z\375\243\026\267\353\266G\330v`S[\247s_\365\002>&\275\025G\263\314\\'/\371\260n\223\035N\347\214\3232:\215#N\337\320i\233O\3355\341t,\234\206\205\3234\343\364\213N\317\210\323.:M\336\352\036\303i1\234\246\341t\030N\357N\317\377\376\357\310\030\370jEQfL}A\211\320\370\217\177\352\267\372\332\367\203\034\210/\304/+\006\276\240/\370\035\367w\030\371>^\345\327\017*\335\364\241\322\205\265\305\257\246\200\340\243\362\005k\3755 O\247\214\274\344K\235\307.3\373Z;\202\204$O\270\023\020\344ki\264\\K\356\314R%I7x\256\235EQ\"sD\341L\212\022"
+	.string	"\227\224?@ra6\266p@\211;\356\255(\221\t\227\256\2704+\251\006\257\302\223\324v\236\220\224"
+	.string	"\236\350^\310{\244\246\204\331\377IL\226\253]'\207\273\213A*\t\322\024c\333\302\217\324z\200F\312\001\300p{\264\354\013/R\313\261\203\236U\302v)OJ\030(\330\234kk\270\315\367\314\203\264%\354\023\0211\201\265\326\367l\016\307\362 \340\251\326\252\340\212\304\220/\343\324\327\211\001\271s\020*\332PR[)\024D\224\023\272\221.\177>\224D\265\016A7\234-G\313\341l!n\270\f4\241[\220\007Z\211\313\321~x<\364\301\206\243\021\r\r\341h\257\207u\233\ft\264\274\361\301m\016\301j\222\263\301Z\fL\271Y\275-^j\004\200]\312\035`\316\272l`\301!\316f\315\342\254L\213\354fm\026\347\006\357fgJ\260\024%\270R\376\330,\f\306\025\352\363\232\235\271\340\"E%\2665{+\330\322llC/[5Z\225\322"
+	.string	"liZ\265"
+	.string	"\300R\207\246\207g%\fT\270N\256\211Q\240\224\260\361\311V\260\313l\216\033h\250q4D\241B%\024FJR\222\244\003\200\002\231\231\243\333\022`\325\031J;\247D\242\253\373\177\006\364\244\207\n\362\300\264>-\231\303ij\274\013%\033\271\350|2\235<\260\264\231\241\312B\2000\324\316\235/\0258}\n4{\"\305V?+\332\305\254g7\347\245\203\260\351=<\bwA\n\205\033n\3463\266\036\033.5\220\340\343\307\274\037\220\325m\207j=\277\375\357\025"
+	.ascii	"\030c\205\350i\0263\347\363\205\203;\374\261\224\237d\224\341"
+	.ascii	"\347\206\235\003\322K2u\324*\200\216E\372\357\366)\356\214h\236"
+	.ascii	"\303\b\033\377\2407\366\215\317\b\200\2672J\001\310=\002\222"
+	.ascii	"\t\262;\034~n\274\215,\254\255\304<`s!\025EG\0047MDk+\263\267"
+	.ascii	"\006\213\004R\275\273\351\006\205.M\243S\006\304i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`\236\003\275\017"
+	.string	"\266\027\\E"
+	.string	"s\224\016H\310N@\016\204\004\260\366\002\222\034\347\325\237\341_\303\333\342y\262T\311\030\b\"\212\245\377\377~U\325\376\377\307\374\3777~\267\272\273;N\024\304\322c\240\377\335\020i\326\221#Bhs\333$\245\fJ"
+	.string	"M"
+	.string	"H"
+	.ascii	"\361\202'Z\350\321\251B\233\250L\317k\361\322\322\f(4\311\324"
+	.ascii	")\023\032\205=\325\r\t}\302\322\037.u\210#l\361\252\373\301@"
+	.ascii	"\320N/\017Z"
+	.string	"\204\302\001\200\250\252\327\364<\225\213j\253\3528\255f\3169W\032\304\252\252\201\021\374\005\227c\206\254f\214\370\373\355\332`\021\303\307\t_\2426\375\211^`\242\023\224h\005$\372\300\210F \242\003\204h\001 z\345C\017\360\320\004\272.\320\241\r\354<M\325R\021\016\315\262\246T\213\265\241UT\032\232\343\f]b\f\235\037J|\006\212\307\302-^\242R\342\257/>\364m\341\252\220\032;\202l|\re\302\347\200\037>\347\003\3617\340\356\f\017\0322!>\006n|\031n\003\034DT\210\330\305\013\031@F\374+\334\370\327\267-=`\\D\001\232\201kJ\265X$\355\035\247]\312t<\236w\234\347)\226W`\216\037Y\207gV+b\270\344\035\367\355\246Z,U)\373&$e\227(\f\373\222\220\\\202##\277B\222|\307\311\257\247]\347\200\341'~\023J\250Q \303RJ\024\244Me7"
+	.ascii	"\003)\242\352\021`\024\322)\205\242\242\330\221y\032{\232\004"
+	.ascii	"\005]\277a\225\221\004\202\237\252\212\033\373k\364HZD\327\233"
+	.ascii	"\315\367\r\376J\352\365\343\231\317\024\205\204\370\363\373F"
+	.ascii	"q\260\267u\245\035T\212\3408KS\236\3038i\365\201?T\322%QYo<\275"
+	.ascii	"\356 -\310Y\232GuU\277C\036,%\300\213\030\361\013t\331\316@\302"
+	.ascii	"\036\247!\3038f\203\nF,\244\006"
+	.text
+	.section	.gnu.lto_.refs.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375 _5\002"
+	.string	"\262\205\017\024p\265\352\374\377\177\350\245u\374E4;\216=\367\267[\312\024\243\246\n=e]e\263\372\021\035:\311\212\267;\300\364\202\177x!\013\370\001~+\3758n\020\316\370\211\177w\321\212\317\177\020\001"
+	.ascii	"\r\212\022"
+	.text
+	.section	.gnu.lto_.decls.7cfa6c9cb4288c23,"e",@progbits
+	.string	"(\265/\375`Z?\255\017\001\272\322\031eW \fQ9\351~}\317\257\236g)\236'z\026pild\204\201\247\340\257#N\230\"w\034\274\017Q\275\221\242\357:e XN\316#/\275c\001\335D\202\037\230\346\20703\003D\323HE\316\362\035d\213\r\215\213\315\016\316\325\375\301\371\372\177F\357F\310&r\247\205\005H\006f\006\227-\353\212\261o\013i\027lR\203\036\262\366\354\274Y\362\306\256\357/\017|\253\301i\363\254\006g\003\tz\007\351\261\322\205\314\352\213\363\002\025\276\226\325\002\2358u\366\347\314!\253\201/X\355\317\371\033\003\377:\341\013\310\354\317\331G\fz\260x\034\215\351\373\022\017\327Y\273rEb"
+	.ascii	"\351\t\016G\353\350\0346\331To*{\327R\"\224\214$\220\234\340"
+	.ascii	"\250\372\306\267\364\220\240\272\030\251\3139s\300\200\003\207"
+	.ascii	"\033\245G\232\016|_z\341w\013\027\030X\266\036\025 \"\266B-i"
+	.ascii	")\373\246\2312@b*\001m\f\256i\353\211\311\030\247\r\226-L\004"
+	.ascii	"\262\255\226j\243\222\265\245\372\005\006<Gk6\202\230\242\326"
+	.ascii	"U\227s\376\337Sm\243a4\215\226\3213\272F\307\260\311\226\352"
+	.ascii	"(\016\0348d0\243@\251\263\263\340\276\361\360\233\016\277\337"
+	.ascii	"\360\233\f~s\301\357,\370]\005\277\223\370\203\005:\227\212j"
+	.ascii	"\300@\365}\027\301\377;\251Y\330d+u\276\245b\361\306l^\037\361"
+	.ascii	"\024+\310\031\313\r\031\244\324H}d\331\246\326,eg\274YYS\227"
+	.ascii	"\363\232\201\003\207\262\n\0326P\316{\273\006\377}\324\305\234"
+	.ascii	"7\\9\336t\261s\327\220&\254\276\267j\370\366\n\276\035\3036["
+	.ascii	"\240\363\026\n\376\255\233[\273\337\316Y:\033v\002\006SJ\213"
+	.ascii	"\265\245\276\266M\320\255\233\237\3238\265\346\260\234sO\311"
+	.ascii	"\242G\223T_\016\354\317y\333\205o\223\340^-\320\271\301\376\234"
+	.ascii	"\030\262\3759\355\232\266qV\356v\215\205;\210\020\327I\312[9"
+	.ascii	"\257v\315\315\371\310\332\rx\254\335\300<\023r\364u\336[-|\313"
+	.ascii	"\003[46\215Mr`\335"
+	.string	"n\333\254\231\233Gk^s^{\032\b\236\224\257\276\267T\370\226\203\263\314\313\263\034\234\267R\330\307\002\235m\177\316\223Y\240\023\303\321\376\234g\263@\347o\305p\200\223\256\210m\365\375m\0300\326kk\255G_\373%C\217J\276\343\352{\273\204\203\260\334M\n\\\316\353\223)v\254k\354\267kV\315z\261i\226\213e\263[l\322v\371m\026\253\345\031\326\234\223\250\\\261fdS\032\360\007\235\375\214\307\227\263U\030\262\001\277\355\372\255\023\273\332.\026\355g<I>9\311\205*p9\347'^VJ\006HL$\020\241\002\227\363z\273\365[*]l\025kV\256Z9c\365\260\340\213\0320\032u9\257\0348d\340\300\201\003\007\016\266\313\223\222+>\367$\300\345j\201N\021\366\347|\b\360M\300/\001\377\326\254\314\2141\225\366\205G\207\321\314]\337\3776i\311\254\2255g\350\265\t\fH\337W"
+	.string	"\377\001\330gL\254\247I\214\254 \353V\316\271\307WfwDF\337\207\300\267I+\305\206\215\200\344\006\232\2766\212\005\273\r\263P\016\"\304\313\242W\336\3129\3330\017\2169\037\331\260\236\273\234\217z\254\335\300\332\r.\223\253!S\316\373\017\370\366\353?`r\210\367\360\033k\260?\247\006\013t^\373s~\260?\347o\271~\333\304n\335\255dj:\346\260\234\327\n\272\370$IZ\337\257\026\350\304\366\347,y\022@\202\020Tx\231%\301\266\360D"
+	.string	"4U\361\fl\013\317\360\233\036\370\333\251D\300\tZ8\376M\r\376v*\021p\002\n\022\250\360\022-\302\003\360\233#2\360[`z\016\232\204\026\277\3407\177P\204\360\270\236\023P\250\300\"\307\216\300\242\245y\200\337\252\260-4\t\215t\013~\263\367\333\241\337\n\375V\004\277\375\375\266\004\277%\301oW\3746-\372\355\207\337\236\360\333\021\374\026\305oQ\370-\372[\340\337\021\260&X\370-\321\337'(\r\240\243,\300_n`[\260\023\270q\005\374\246\003\376RCI\200\344\177\261r"
+	.string	"\"X\341\357\263R\203\337\232\200hUd\360\367\257\024@\031\200\277\335\376.A\211\301oU\370\255\206\236+3X3\235\202s\360\277\314\204\266n\241\002\377\265\2432\202\022\303\337n\312\013\3766+\201~k\2027%"
+	.ascii	"\376\243=\356\347o\341\313\030\360\337$\177s\375\245\005\277"
+	.ascii	"\005++\370\333\310\210\370[\023\330\341\tl\333\343\022p\f\376"
+	.ascii	"\033\346o\037\245\317\377\264\377j\377\275\374\377R\002\314u"
+	.ascii	"\376[\346\357bK\335\337D\300\337\037\374\355\301\337\016\370"
+	.ascii	";\304\337\036\376\016\372\033\304\337\035\376\026\361\367\003"
+	.ascii	"\376\376\3607\004\376\216\300\002\376FB\300\006\177\227\031\374"
+	.ascii	"}\301\337\025\374\335\373-\336o_\370\237\301o\216\360\227=\177"
+	.ascii	"\351\373\313\363\357\274\277\355\376\246\373\373\355o/\177g\371"
+	.ascii	"\373\312\337U\376\206\362w\327\337?\376\306\372\373\351o\253"
+	.ascii	"\277\217\177\337\370[\352o\250\277[\374\275\3647\213\277\221"
+	.ascii	"\376.\376\235\202\277[\370\333\350o\020~\233\346\177\334\177"
+	.ascii	"\267\337\266\375\366\004\377\277\374\326\303oI\374\326\204\337"
+	.ascii	"\206\360\333\t\374M\374\333\004\177\013\377.\301\337\277\277"
+	.ascii	"G\360\267\b\376\213\375\335\201\2775\3607\t\277\005\373{\204"
+	.ascii	"\277E\370;\204\377e\377K\374\017\373O\364\267\005\376\256\300"
+	.ascii	"\337\024\370{\002\177K\340\267$\374\026\356\267j~\373\366\337"
+	.ascii	"\204\337\272\375\326\314o\363oS\360[\024\374\266\205\377a\376"
+	.ascii	"\203\371\277\365\237\304\377\265\377>yyyy\177\257\307\217\223"
+	.ascii	"\376\017\003\bZ\262v\340L\341\271\300\005\353wG'uv\204\tr\225"
+	.ascii	"\003\005\377\327\352V\201 \203t\272\307\337\252F\306H\363\312"
+	.ascii	"\312a\202\237\323\003\3777\307\305\201\333\234\305hso\374\342"
+	.ascii	"\260kv\310f\374\250rm\350\254\305\374vm\334\032\2765i\320$\361"
+	.ascii	" \335@\362h\2421c\247\n\025\021\0362~g\024Yp\301\353{c\224s="
+	.ascii	"h\234\2205\032KOJ\013YT\337\347$IE\345<\211j*3\376F]\245/@\260"
+	.ascii	"\364\275P8P\276\\\344\365"
+	.string	"\275.\356\223\034\f5\307\247\353\244c\003\b]\332m\372u\352\034\371ER\337\373\342n>\244\212r}?w\235\024\231\312\302\211\303\377eZ\3329\0035g\247\364\273\304s%\246\006\331\367\262 \323\204V\325\367\346\233\324&\306\213-I\027\251$\2224\305\342\036\375\"\365\340\256H\331\352{\213=+]\324\322\364\375\234\357\354\002u\347&\314\033\274^\232,\245\257\273\227x=g\334\254\212\364-\355\314.\252\243\276\245\233\253\231{s\254\353\373\271\237\375\367]\031eM\270\364=\216\032\376\313\272\362\005\234\035o[\220%\335\313\027p\262n\024\267\372~\256\234\373\357\363\261\321\321\205\315\261A{Z\003\222\346\332\020\303\222&\327j:T;l\224\351{\034+\370/\343\372\344j\363\206\016nC\0332HJ\324X);7\242X\245ys\343\361j\222cJ\232\227n'\344\034V\022\221\242\204\327\267D\023\3642\315"
+	.ascii	"\250\234\225\365\355\2351\263\203T<\262a\246m\207\006\333]\221"
+	.ascii	"\276ep\242\300\300e\351{\234)\330I\252\224!B\311\350{\272\332"
+	.ascii	":b\361\2630\244\027\032$r*\211\013 AJ\027l\300m\331\315\240Q"
+	.ascii	"\332h\322\325\006H\271\245\034\3623\313"
+	.ascii	"\0266B\230\032p\245\224rLIV\242\225g%\231\322KiVb)\307\312+\245"
+	.ascii	"Z\371\245\344R\206)\265\224VJ0%\2252\255\234Rf)\331\312\265\262"
+	.ascii	"KY\245\024+\313J16Yn)\241^~\225\311'\\n\340\216\345\226\362\007"
+	.ascii	"\007\345J\206]|\345Xb\2450\225JMw\353\322\"\362\004\327\344\316"
+	.ascii	"\351\251\214B\342:V\225X\226m\312''}\371@Z3>2\204\241\202\313"
+	.ascii	"9\317\270Q\352\020\241d\364-]-\201\013z\362V"
+	.string	"*-\225/\276\234\300\225ZEJ$_M[N\352\220J\254\224\253\026p9\257/w\374\345\361\007\021\242\334Rf\225=\312\025\331\213\202\244c\265R\324 \223\224[J&V\n^yTn)\241\224a\226m*\347(\rK|\020\301R\227s6\305\004qs\005\204\373\227`/\303\376\022\251L\262a<j;\264<\365-\243\004\275\004\373O\216\330\032\336\220\276?-\360\316j\201N\213f\177\316\343\034\341\373\346\360}m\370>5|\237\030\276\217\013\3377\004\337g\205\357\233\201\357c\302\307u\370\030\r\222#\370\210\n\026/GJ#9N\220\246\242\372\036\263\341c-\370\230\f\237-\f\037\257X\310\271d\241a\321\367X\t>\016\202\017g\177\316\343#>\216\302\177\311\343e\017\033v\002\206\025IHy}\203\202^\362\370\217ub\367DK\337\343%\234\301\002a]Y\263\"h>\222\177+\255\376_G"
+	.string	";\311\0313\276\372\276w\207\337\243\3036\333\237\263\304Q\346\260\311o)\251~\216\2111I\352\373^\032\234\202\374-\347{b\360_\332\250\321C\347e\314Z\243\234\352\211\201\243\342\242\357{h\370=+\330\032e\2241J\027N3\312\2241J\030V\250\316\262\364}\357\t~\017\t\376\313\250\3228FE\306Ei,\241z\202\260\251)\351\373\236\020\374\236\016l{R\270d*[\330\344\327J\027_{x\314\226\244\254\365}\357\005\276\375\332\231\002\373\265\363\275$l\3177\330\036-\320\t"
+	.ascii	"\373s\332\265,j\320\263\316p\302*\363\232&Y\256\302\362\254Y"
+	.ascii	"OFrn\314\233\306Sk\0032\327\267\357J,cjT}\177\262\301=\327H\332"
+	.ascii	"\315\trG\226\030\034\217\037\255e\331\246.\023)pm\325W]uD\005"
+	.ascii	"\311f\316\276\320U\305\034\037ltY\352\3064\\#-\333\024\bL\322"
+	.ascii	"\350Z\256\331\364\013]\327k\332M\267\351\270\266\263\311\236"
+	.ascii	"\373\373\255\325X2sV\215]c\331\246@ b\245\314o\311\314\3313\366"
+	.ascii	"\255'\266\266U\3175\026\2261\"s]\244\265x\212k.\366|d\272,u\031"
+	.ascii	"h\260\2603s\301\375I\206m\223l\201N\fH\373s\2469\217p\344-\365"
+	.ascii	"\375\371\205\223,i'\"\224\214>\250/\037pk\224\034\310.(TH\333"
+	.ascii	"\265\352h\"?\210\020\335\245\327\032Y\256\310\036\330U\220\""
+	.ascii	"6\306\374AT\232\254|b\304S\3024\301Q\031{:\3534\021JF\037\f\244"
+	.ascii	"\026\235D\311\335D(\031}Ja~L\351\344U\rd\316+\030\216']\372G"
+	.ascii	"K\021\241d\364\275\bs\243\3134\230F\323mm\246\3174[{i2\375\245"
+	.ascii	"\271\264\230\036\323[:\214Mv\227V{\033\351#b\235,\237\0301\330"
+	.ascii	"\327T\227.k,\226-,\037Ii\320B\312\341\250\313y\355\361`\322\003"
+	.ascii	"O\303\375y\003\377|\302\177\247\241\205=Isf\275D\312X\031\242"
+	.ascii	"\245\263\234]az\250\365\275\211\207o\322\231\365\225\236\027"
+	.ascii	"\234\330\220AcF\246\255\350\030\221\202r\241\357M\264\256\362"
+	.ascii	"\353u\334)\217fp\261\322\367&\031\276\t\206o2\3017\205\340\277"
+	.ascii	"\245t\030r\210\227\033[\217\316\233&a\252\372\336<\342\2330\360"
+	.ascii	"M%\334O\332\313&7\364\327}IkN\346\274\366\370\310\310\345\b\353"
+	.ascii	"\373\213\207o7\234=yyyyv\303\371\013\327]\227\305\225+=\372\376"
+	.ascii	"ji\256\336:\301p\345(}\377n\362\336\372\233N\316\240GH\225/X"
+	.ascii	"}\233\211}\313\253\262\345\254\357\347\356\366\337\227\243\345"
+	.ascii	"\307U\227\276\277c\370\227\013\177U\202\315\325\002\235G\033"
+	.ascii	"\202O\326A\336Z\177\367h\037\215\fy\t\354\213\252\264\262\003"
+	.ascii	"\rF\026kv\006,\r\214\02022\363\212\365Y\221\302t!w\242\230\310"
+	.ascii	"Q\231\335\274\302\305\006%I_\263\314\232\345\250i\2411\245'\007"
+	.ascii	"\030\230Y%\003\316\\_@\340r\236\332\200\003f$B\345f\225*bvT}"
+	.ascii	"\3151k\206\027\227\347\244\257)\3663\"J\240\264\372\232a\346"
+	.ascii	"\224-PN^}M)k.\270\221Q\325\367=P\370\315\272\232P\254W\206\262"
+	.ascii	"W=\226\272z\362\264\310\0251\2237\241\234U\211i\242\326\327\374"
+	.ascii	"\262f@\322\360\332\3645\275\354\230N\217\026E\304\3645\237\374"
+	.ascii	"\254\267\326\345J\007\234\031\344A\314\256\362\316\256y\352X"
+	.ascii	"\214\013Jbfj\003\017Z\f\2450\"7\273nr\201\b\361\263\253\225\353"
+	.ascii	"\256\257\271\304lbn\375>3\b\216;\026}\317\323\206M&\035\344p"
+	.ascii	"Su\327\367\246\221\036`\204\034\351{3\211\251\344\367\355\204"
+	.ascii	"AUy\321\367<_\260y\304D2#)\346M\337\363\250a\263\210i\344\250"
+	.ascii	"\311G\262o\333\237\235\357\200\327c\fF_\323\005S\213\255\252"
+	.ascii	"\216EN\331\020+h\220\346\020\263\f\353\205\2302Z\326\034x}o\n"
+	.ascii	"\251\n2D\252\257\261\315\306\322\013}\317c\226\225e\376hA\013"
+	.ascii	"\f\235\222\2345\306(K>n\376\b\223{!G_\263\307\265{r\214q\245"
+	.ascii	"\257\311\343z\3558i\035\201\205"
+	.string	"aa] 8\203\034\316\325\027\031S\337\3638\301\267K\254iu\2334\255\356\226\217)\347\030\017\210*\213\261\200\363\034\301\277\231\303&\315\034\346\221\2045\027q\304\236\230\307\337\2442u4\236\316\321I\226\331\215\2769h\331\002\235\266I\266?\347y\262b\3040o\200\300\225\303F\016\311e\332\270y\243\234[\023\363e\354k\326\370\231\233\261-\253\276\346T;\351\361q\206\tS_\223\306\335\222\260\264\326\372\2323:\271Ee\226\326\327\224a\355\310\310\264h\2622\212\21717\242\242L)\022,\2208\036+$YL\237\273)\345\323*r\325\324\367<\306\027&\324\013\363\351\314\331\256G(c\2362nhj2\237l6\346<%\0010'pyjj\203\316\334\214\035L}\177\323\351\346\3230\354\013\306\265\363\212\242\322\325\367<,\360w\344Z\264\270U\007\360\362\005\377\230\312r\352\373\0354\346\222\271tq"
+	.string	"\200\213i$N\215[\337\357\230a\223\205\311\342\356\360\311Hc\306\220yjj\203o\b\022),}\277\323e\"\231HwG\334\206\263\262\251\r'8[\223\327\367;<\360\355\032k\026\223f\321\256\311\220K4_\300\320)\311\306u\001\337\241\312\313+\3352\254Y\252\367\242\f\f]]6\032\027\360\235\027\370\205\027.\336T.\256a\300\221\342\335/\336\265;\223`\2209\322\367\326];\036/clmvn0\f\274'2m\372\256,\266\360\302\324F\347\016\377w.y\347J3%\323\361\250J\304Y\21528\352rF["
+	.string	"NZ\r\030o\372^\307\013\226\223+s\246:\203D\303qqB\276\350\220\341\377\272\375\302\375\367\355\252i7\033]p\026\350\034@\232\240_7\236%\305\034.\364\325"
+	.ascii	"\315=C%\013\326\216\276\327\314\232\3149c`\337r\330"
+	.string	"\235\365\275\316\026\356\033b\267\355\222\261\311[f\3159y\313\330\272;\206\247\270\346\250\017St\246P--\235\367\277b~\307$\253\364\370\001\327\367\206\t\372\025\003\002\020,&}K/\277`\376\313v\277\370\252\310V*}-\232\005:\005`\177\316\333%\350\327\213\216\\[rI\337"
+	.string	"$/\2275+UhO\372\376b\271g\277Y\236\345\256\341\234sq\315P\275!q`\350\352\362\224q\303\177\325~\327\312\037Ra]i;\304\256\220\244]4\2600x:\354\227\267& n\256\226\333'-\026k}\257#\205\377\333\367\177\346#c\316Y\312\\\263\021I\347\374\355\255i\355\206\177\307\226\266"
+	.ascii	"\377\357E\224\260f\244$V\316\331\262\301E\254\034\335\320\220"
+	.ascii	"\377\177C\316E\233s62%\255\212\0250%\2172\023\024\266\250\n\230"
+	.ascii	"\222VQLk"
+	.string	"\256\302\220\223X\231i=\026\357\261\230s.v^s\222UTN:\026\213\230\326l\314\353\261\350\223\223\242|\230\326\243\"S\322*\3122%\217QL\311cT\0059)\027s\322Q\025N:F1m9F\3710%\217\242\230\222\254\242\354z\314\366\313\225\325\252\250\224\223G;9\347\246\025Y\324\311\371\310\230\213`\332)[\3019e\252l\331\226\254X9\347bX\333\325\321\267\"e6&#G\024J9\267e'\017\212\266\270\346\234\2272R\321\346\254\264\032sF:\2360\225s\316G+f\311\230wr\322Q\023\322\325QG\t\351\270\224\215T\331\234s\216bJ^\035\203\312\242$\221\031i-Z\246\246cF\3466+#N\026\255\334N\022\310T\023\331\357\225\377\226]3\0350G?~\364\265a\026\350\304\300J\320/\231\316\025)/-}3\210\375V\371\357\330\245rZi\262\005\243o\033-\320Y"
+	.string	"\373s\336)A\277b\346\2313ra\372np\245Te\331q!\365\275Q\312\024\344\345\345\345\335\345|t\243\364\r\273`\277Q\336\323kS\302ttBq\263msJZ\311\2570\253\"j\372\342\2741Xo^\310\016\303\245\t\351I\225\265\315\314/5&GN\232\253\r\024\034E\272\270\226T\215\031\303\265\2454\226\245\251\357\272\203dsW\243\357\355q\203\250]\335,\021JF\237\013$.:\256\025\bM\340\344p\324\265)\337\270A^\027\312:\274\274\313T\256)\353\226\220\356n\222{\344*\271H.\362\022\271E\356\220\273\3442\271Z\267\211M^#\235\345\245\326\025\362d\352\346H\003\327\005\343\322`\223\303Q\307\343fYih\262\312\341\250kq\245$"
+	.string	"'\207C\3115r\251nR\006HL\371\250\352\003\327\021\2638\002\333\n\300}N\035>\363\r\002\204g\216*I\326\217_ xL\335]\213\276\327G\003\301B\243H#\315+\2724V\322\340\347\004\251\n\034\252\220\202\220\220(\005!!Q\320\b"
+	.ascii	")QH$\204\243\032\t\323\024\300\022h\020\250\022\001\215L\240"
+	.ascii	"h\017Q5*:a\036E\007\f*0\bD-8\212\016*1(\0242O\374"
+	.string	"R\242\253\202p\210B\025\006{A!P\375\t\t\211Pap8LQ\324G\2054\310\263\302\217(\025A\270\0015%\366\354\f\323\022\206\206~>+F\b\246*\021H\264CDd\024\f\n\203=\365\227b(<q\236P\203\300a\321\211^p\204\257HH\305EB\252\217hB\221\220\312\023L\213H\024\t\225\030\246D\034\342\210\"!\025\007\347C\007u\370+\352\240\032\221\370\251?\021\212\204\324\n\206~\275\"\241\022D`\2064\035b\240\304\0171UW\270@\221\220z\201:\374\251&\024\t\251x(e\001H\364\003\252\300\340\b\013\322\241\021\n\300\023A\241P\332\201\"!\225\347(:\b\201C*\021h8L\207T\342\371S\177\"\004\205gJ\024\022\205\020\024\366Tt\250\252\277\237\013\251E\251\220\220\005\202B|!\3400\r\246(\340{\360A\007\037\210X\321\033\n\2469(\004\201*\360\007\202\025\035"
+	.string	"@\232\0161\260\242\004\321O\025\226\030\372\341\230P\301\njQ\212\021T`\nb\3607,a\002\021(\200\224\3303\021B\252\376T\023\322 \260\004\242\241\032\202\232\022-0\021\302\005\324\224\270s\302\350\0028U\201C\020\004\201(\244&\356Qt\030\241\204\021\030p"
+	.string	"\210\241\224h\0244B\3619T\213R\342\317\004\317P-\332Q\201C\025t\206\202)z\302\310DJ\374\231\330I\211?\023h\221Q\nB?\023(\211\021h\317P0ES\025?\"Jb\004\252C\034\246)\f\177)P\034\004\376P\b\241\2470\230\022\001O\240=\020D\024~D'\320\236\212\366\206\210\204hN0\205\021\221P\b\035\032\t\2419)\221\211\237\252\002\3459adB\035\nQ\020Q\237\212\222\030\201\342\230*\352\301\007'N\bQ\324\247\246\304\023'\204h\217\304\b4GU!\224\016\t\205PLb\004\272\223\016\001U@qF(a\004\006P\022#P\254\022\201D;'\214L\240\304t\230\246\303\023\250\216\212\246,"
+	.string	"\211g\210\241_\021\212\236\351\2200\005j\252\250:\024r\240HH\365\035\205\206!`\253G\321!\203a\n<\001T\203\351\020\020\207\210\352|@\035\n9\340\223\022\231\370\225Pq\246h:$\324\200:\024\026\341\244C\302\0247EI\250Ca\321\0161(\004\252E\302^\252\376:0d\3643\201S\026\200&\250D\300_\t\235\241_J\202\212\202h"
+	.ascii	"\021\360WBg\250r U\001L\205\322\016d\300\371\251?\021R\020\372"
+	.ascii	"\231 \"\372\205\260b\310\243\016\205Ew\210UT\204\032\004\032"
+	.ascii	"\365\206\351\211\023F\027X\241b\025\303\224x\203A\241\320UO\265"
+	.ascii	"'\210\002\220\350\207\242\275\243\350\240\n\031\rU\"\b\"\272"
+	.ascii	"\"U\215RT\220\202\220\220\bEO5h$\024B\321\3360\r\252 D\321\036"
+	.ascii	"q\230\022\215\202(\212\207\202\300\024P\364$\006"
+	.string	"\201ED\024\355\005\205@\"\220(EQ\237\212\252D \221\317Qt \246E+\250\035\f\245\303\037\nb\007\036\210*\320\204\007\243 \n\035\2540\n\002\211:\360\340\003\364\003\021+<\244CFDBA\240\207!\321\310\303\003\324\025i\220\350\027\034\246j\020\210\016\375\322!\n\265\bE1\250H\207E(z\252D \021\212\236?\3657\204\242g\312\002\220\210\242g\nB\302\022V\fO\"\241\360\002\2509\224\252Bi0(\024\362\251\350\007Aj\020h\204\325\240\2210\0045\230\002\211\204r\324`\252b\004\234\243\3500\364[a\310\303\320o\005\023@\"\017\0350\\X\224\016=\250B\341\320CN\312\002\220x\323\242\025\324\373S\177CF&\361L\361K\207\252\t\350\320o\205\241\234T\025\246H\207'\n\304\024\345\360\207B\350>((\004\r\036\330@\006\260P\207\"!\025%\372\001\207)\321\003q\230\252"
+	.ascii	"\016\207<\004\201\277\024\036\204\206D\017\035\b\360S\177C\367"
+	.ascii	"\377\311\343\204:\243\206\254\313z\352qc\223td\307\251\324kr"
+	.ascii	"\221L\202u\361v\264\270%\361\270:\342\260\311\362*c\325Z<dC\342"
+	.ascii	"bT\335*7K\233\033^\307{\345x\324Q\346\324\001%[\037^:\336\234"
+	.ascii	"TY\332\2109R$\307\005\303BM\036\223u\252\314\233\270\363\206"
+	.ascii	"\351\345\214\234\030\322i\303|\333\221\221\006K\227\263\206I"
+	.ascii	"\207C\005F\226\245s"
+	.ascii	"\312\254\222\304\305\233\326I\303\264\313F~X\231a^9\213VfXd\334"
+	.ascii	"\314S2\362&#\306\205+b\303u\006F\031\326f\303\b\233S\252\313"
+	.ascii	"\310\230\235\222(\363\207\207'UH\372\236/\316\027'\024\023\354"
+	.ascii	"\246\313\370\346|\372\t\345\263\203R\314\322\367t\262f\030\352"
+	.ascii	"\300\324\365=\233|\334\234L?[\234L\247\022\215\037VD\224\bY3"
+	.ascii	"\223\243\314Y\374yt\026O%-&=\327\304E\224\023\351\247\322O\026"
+	.ascii	"=iO^\334\350\3733\351\214\261MT\032\0373<<3o\t\322\342m\2112"
+	.ascii	"\276\271\231g\007\307&\256\357\347\254\031N\022\0322\037}\357"
+	.ascii	"\003VWg\332}q\3510%\361@\342\346\246]\225\262(\261\276f\033k"
+	.ascii	"\346#C\313<\312\2224\255Q\351{\237$p\177\234Iw\217rF\372\260"
+	.ascii	"\"\265\345<\265\301\316\240zq\206\315M\272\233s B\374\254\256"
+	.ascii	"\305\025\216\276\177K\3412\307\325\327\224\263cF\312"
+	.string	"\314\352\326\374\367\r\035]\331q\267\277\245\025\221\216\364\275\017\017|\237\252/7\303|1\337^&e*\034=\030jVD\3522\323\324\206\036\265\254\261<47\337n\272\201\b\3613\253\245\3704\245\357\31548Ev$\223\364}\007\377}\330kFTT_\263\214y\246\007G\332\335\2153fz\250v<\265\3651\233_tqa\332>g\222iB\205t#c\2169\372\302\265\344\232\301\240\347$\307\213\334\367b\216\301\016\2318(h\372\232`\350\320nvA3\275X\257\f\325\363\221\226g\254\313L86\350\220a\"E\313\013\226,&+\\\372\232[nr\371}]Vg#J\337\367\250aS\355\346\332\357\363I-\r9\303\277\231\366\373J\250+\026d}\337C\005\277g\353\354\314\314\362\301\006\204b\250\243!TjX4\204(\212\346\0202\006\231\2221N:C\026@0@D,\026\n\253\254\017\023"
+	.ascii	"\205\214\213T\251\256E\216\031\231\021\021\221\024\224\244(\225"
+	.ascii	"\306V\207F_\210>_\320\357\360x\343\213\201p`\307\320\353@\231"
+	.ascii	"\005c\037\260\346\276\263\221'H\234im\302\b{\204\177\317.\253"
+	.ascii	"G\267F\201J\223\323 \351\245\247\345\255\202^d\362\344I#;C\245"
+	.ascii	"\254\272\257\002\375\347h\0044w\365\336\204\350\241\264\313\334"
+	.ascii	"\016\257\n]P\351\277\016(\b@\230\335\323\001|W\002\205g\307\211"
+	.ascii	"\206d\223\r\022%\031N,p\322\235\261`\242V-\226*P\214\021\004"
+	.ascii	"o\001*\226I\322\024`\005\316mi\201Q\216|\206jA8+"
+	.string	"\301\016\"\310M~\002\235\205\037\340~\327\270\313E\220\233\026\244\222\355\257\035EA|)~\203/\236\006G\340\026\215u\333\025\251Z;\212=SH\316=U(\344\300\226\333!\325\023\322RR\361A\255\244\371\254\004$9*\236aD\346\2542\006\214\336\304*\036\035\323G\234\032M\221\214#\005h\016WN\223C\350r\001\005w)\tMk\003\364H96\241\334R<\013\213\313:\325LM\317l$\335@~\365\r)\310\221`/\234sQ\361\203(\257Eq\311\3612>\335\347\257wq\306\275\270paK-\330 \357\365q5\fZG\364\"q\221lQ]ci^\321\276<\237B<\340\371\034-\260\032\241(\3735\201\367\245\305\277\327mp\205%oq\205\340\033Az\230:M/\300c\013\203\365\240\002\004\355XSd\371\237\r`\004\371\211\224\274NOU\205\273\344^5\2778D\3232\0318\0200"
+	.string	"\002V\237\356}C\f\265\376_\236U+\336\330\202\023P\351p\t\214\306\"g\302\333|q\377H\210\225\376\354\347\004\354$\344\320kN\226\212\215\311\027`8\372g\214|.\006\360A#\236C\264\253\300x/\342\027\304\237\363\215:\304{D\361\321\344L\254?\270HH\002\220\313\017\225Z\201}\213\013\355\334\320_:\003\216\322\230\203\177\\Rm\234\017\334\300\222\332\"b\343%\311\244%\215x\351\002:;\027\333\250\316\037\277\307\002v\374\025Q\321\331A8\230sL\220\224\220\271\037glx\007\\M\2341\252\331\267<\260ub-\0261\241\033Z\257P\001\371\237\312\336\333WQ\322\274\271\2125G\026\315\247|\022\304\b\345\200\035\241\032\224\212t\237A\220\224h\346\262\242\257d\256\02225e\321\323jP\266\215Bs\302\023\313B\344"
+	.string	"\376\276\210c\222\3439)\311\333\365$S\361&\322\203I\352`\f\314\332\347\025sye\253\230M\3626M\314\017\331\202\f\240c\353\005\3439\t\201;\\\330\234\206\274\035\247c\356\354\236\303_*`W\256Q \235\237q\317\n\036B\327\313\ru\022\215\034\301:\336X\332\211cY\267\3437\206ax`\205L\322\321Jm\346f\323\244\347i\357\325B;\354\256\313\342\300L\206\254\206\212V\231\274\334\276A\230\316\001"
+	.string	"\266\335\33442z\002o\274\306\023\340\312\005\257\213\3076\001\274\004qBg%\037\347\031\234eqb\331\216B\277\256\355\225\304\264H\013\241\274y\224Wjh\257\305\250]9c\205\211\251\225\251\307\023\306\365\264\357\331\314\bJ\036J.c0~J\234\b2\371\253\026\230 ?\022)(\363\002~\310[>\350J\326\t\334t\345\252T\030\nnv}E\376\267\216^\021o}c\327\330A\272\244\331h\256\304\350\002a\362 \006j%C\366\004\323z\332F\370c\375\345\205\244\224e^\225\226\220\311\"\013Z,:\r\312\306^\241\224\026=\320\326\240\033P\0133\220E\341F\335\236:x\277\241rm\303\303I\313\320\370\337!\302\230\314=#\366\325Q;\t\342\204\222\213\262uy\025\034\222\272K\316\221D\"\240\372\305/+8\3358%"
+	.string	"\227\bJ_N\245 =}\306\301\304\261h~\021\036\337\035\370G\373>\363\335\005\231\213:->\006\003\252\037_\230\"\032\367\316\0216\006\005NC\321J\232T\020\217\001Kv\343\346:\223\354\005^+\031\004[\322\332\305b\352=\353,\232\r>\026\375\343Y=5\222\r0A\"\351\220cy^\275\237i\246\311ol\371\004|e\2767\302\t\360\220\253\302\007\017\333\255\210I\201\023{@\201\031\245\213\262\227\234*\020\371\210+\265Z\325\272\206\n\200\237Q=\311\262\2606\200\031t\227\306\t\370B\233_W\243*{\250"
+	.string	"\356\217\004oxPjE4\022\327\007gm `-B\2279\314\002\355\206o\372\004\305\260\200mr\377\033_\351\225z\230~'\023v\236\341X\366\230n\331\356M]\375\316"
+	.string	"\3113\330R"
+	.string	"\212&6\350\226\334\017\251\"e\274\327\275sVG\313\365^cO2*(\226\313\344\204\230\341>U1\347\3075"
+	.ascii	"\024\310\235\200\311\003r\303\267\372\201M\266\333G\360\353\362"
+	.ascii	"\365\0276~|\274\301\362\217%\271\257\020\252\025\323\033p\211"
+	.ascii	"\215\t\307Y\271HY\277\352}g\351\2025\205\334\0200Q\254\260\335"
+	.ascii	"\2129\252X4_\320\262\016]\032\260\346(\224\234\314\363\311\337"
+	.ascii	"\272\311\356\301#\030}\351,\223Kg\307\001\032y\034\367\372\360"
+	.ascii	"\222\203++`\316\225'\341p\004\346\314\257\321\026\320\225\365"
+	.ascii	"C\273\\/S\007j\253\026\\\242\306\236\313\276m\234@\025IQ\325"
+	.ascii	"[\201I\236\364\211\207@\221\203!\320\276\200\020)\211\203n\352"
+	.ascii	"-\307I\321\365.\230}\223\002\350Lz\006N!6\001\253\033\342\305"
+	.ascii	"\003T&i\271\321\325\265/1\r\337\021\210"
+	.string	"R\227s\210\304\313\364\332\242.\020O\"\031\216\003\035\366\341A\242v\315\001\245\340\274\271\001\247Wg\3302]\034\r\233n\231\002\025\332eb\032T\036\337q/\300\327T>\246\017;\017\016\372\301\006\367\262\301\362\026\377\240\351\021\022\370EH\363\221q[\025;\325Qr\230E\374\255\334\001`\253i\\6L,\302\023S\254r6w4\020\002\036\005\336\263\267\030\322\327\327\232Ta\223\320?\260_K\233\311\324\257w\371\335\263N`\271\r%y5\250<\254\225\361\222\206\364\275\203\227B\271(^N2\202\325\256\004O"
+	.string	"\304iZ\350\016,\257\032\276e\356t\350+O\035\343\016\366\256\335\206\001A\213\262\324\310\2726\3173\215'\005T\361f\027\020HP)\354\327\203\225)T\217\241\322\230/\034%\360\366X\206eDA\216\201\243~j\230\270\227P$\203\260\007\"\307%\240\330e\272\370\362 \353\236S\302\262}\\MW\220T6\227\311\250v!\037|\372Qf\313"
+	.string	"\231\364w\230\336\336\025\204z0\032\242'\373\272\344\177\356\001:\036C\236h\371\353~\036\330p"
+	.ascii	"ln.\377\275"
+	.string	"\375@\\g\206\206[\242\213AY\225Q!z\364n\350\3358\357\024{\t\031\353\364)\022S(7F\254\210\206\257k\362\007@a\2426c(\300~T\r[()\312\221\230\257hc\376F\005\374\310\256\f\022e1GW\375\214Nj\264\373\346\255:\304\240\227\316\365\301 \366\346/\302\230\236\003\370\020\265y\271,9*J@*\206\311g\353\271\300\241\003\006\315\300Q\033\242{({i\235\304\207\375[F\272V\347\203B\363+8vlJ\277)g\2228`\177\032\357_\374\b\347\215\270G\325w\032\366u\267\266\001~c\212\007\312f\271\231\201\201\375\177\326\272\202u\027\231;\360\374W\355\360^\342\227a\266\n\177%\366K\f\n\203Jy\225\007\344T\236J\357\177\202\230\352\357w\2728\365\242\372\366T\177y\217\216\237D\227{\t\266\310!\267n\006\303\343\234\257\243\346\206\365\256m\377\266b\266\203Y\367\013"
+	.ascii	"m\267\261[\377kK\013i\200\341}\312\3545\375YB>\311\331\377\013"
+	.ascii	"\265'A\034\002m\016-\3230y9\177BX1\352\245\235SV\330m\313\373"
+	.ascii	"\221\317\325\364K\370\2138\377@\200\306\317\273\216\357b<v\013"
+	.ascii	"N\344\016+'E\237\217\275QzR\276U\300\361\222\306\377\005oU\335"
+	.ascii	"\241\367i\300\353<\203\346\037dg\375\313f\275c\362\207\341\366"
+	.ascii	"\371/+L\2279\204x6\361\227\0033\376B\027\323\016\372\236\272"
+	.ascii	"?S\247+"
+	.text
+	.section	.gnu.lto_.symtab.7cfa6c9cb4288c23,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7cfa6c9cb4288c23,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
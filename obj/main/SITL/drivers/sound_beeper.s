@@ -0,0 +1,219 @@
+	.file	"sound_beeper.c"
+	.section	.gnu.lto_.profile.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\354\301\314\336\005"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.string	"(\201o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.11c0b41c79cbafd3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_systemBeep.11.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 \344U\006"
+	.string	"\262K,2pM\322\030\240\237\177}\370\243U!\250\375\263\202\375\233\216\343BH7\363\314\217\233\266\035\250\224lx\374\377\334Wk6~'\004\2540\236\025A{\313\024U\025\257\370<I\022Z \214x\240\256\211\210=LB\nKR\357\262 *o\222\330\223\016\216\026(\237D\214\362A\331\252\333\030X\270\213\317.\315m\274\002\254\333|\253`:\005\235\335\214\024\224\035yB:~\205\376\326~\201a*\247\"R\023\022\216\310n\226\260\202\200>\317/\2110\b@0\037'\273\373\034\207NmsU\017\035\310h.\332\002\034v\367\226\321h\350N\177\204\277\341\237\001\b"
+	.ascii	"3\003\316\231\321\341\313]\303\201C\030%59\334\341E;\311"
+	.text
+	.section	.gnu.lto_systemBeepToggle.12.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 \305m\005"
+	.string	"\242\t%.pU\323\001"
+	.string	"\345\301\212\261\376\036=~\261N\331\277\245HF4l\363j\264K{q\251m;TU\370\333`c\233\254\001\256\3306\312-S\247\246:\2619!\216\352\242\320LfuV\254Z\311\313zH$U39)N\261Y\345\204\322*%\260\227\277\204\205/?\270E\346\374+h\376\376\310\031.<\204\335\232\001\201\026\rB\236\377+]\373G\b\214\001\200\003\005t\267\344\316j\033\265\357~\266\320y\333FB\243\273\037;o\263\347\375\277\370\317\370\037\t\b"
+	.ascii	"3\003\316\231!\340\313]\303\273B\030/C\204\313\261h'\031"
+	.text
+	.section	.gnu.lto_beeperInit.13.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 \371\305\006"
+	.string	"\022\315/2pO\032\003$\nK\335Q\026(F'\343\321g\233\356\307\304\261\026\221\t=\266R\021\315w\323\222i\375\377{\304\036\331\205\357T\034\316\033m7)S\n\021\025\204\025)\251\224F\302\016\204\017\r\034\213\"^\357\222\260\242\222\234gU\016\022\217\222\327\323 4v\240|\0231\312\227\231\267\313zp\3410\332\351i\316\2435\300\377\327em\333\210\204\\\f^\376\215\030\230\263D*!\231\266n\255GL\202\271\304\302\003\177\266\222\362O\205.L\216:] 9\232L 9*\326\266x\202\334'\032\031(\241\377\317}\030s\303j\233X\340\003\362\270\0050\374o\373\2008\\\347\266\tm7m;\002\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\f\177\003\r\177\004"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.11c0b41c79cbafd3,"e",@progbits
+	.string	"(\265/\375`:\005\365#"
+	.string	"\352C\b\017E\200\236QcMbc\362\037\354\273\032Ju=V=+\332\020\201E?\032\3614\266\"\230x<\354\260\013\005\254N\3354\240\306;\034\325'CW\226\371X\216\223\346\013\036\376nP)u\215\317\337\255\233\273m\231\002\320"
+	.string	"\325"
+	.string	"\327"
+	.ascii	"Q?\221!\003\302\310t\t\361\363\267GGG\007\216jW/\023E\310\274"
+	.ascii	"c.\231{\204p\313\370b\271\\\246\001\333\267%\023@\\\270J\323"
+	.ascii	"2P_\b\347,\231\274\020N\367P\n\267\350</\201\323'\276\230?\330"
+	.ascii	" qR\2326\201z\004j\017\350\315r\265\334\243"
+	.string	"\321\3452S\261\f\b\020hJ\240?\245\351\f\250\002,Gr\001\324\327\350\274\311kt\032Em\267\350,/\201\263\301-:\335\336\242\023\275\004\316\253U\336\254\273\345\253u\253\270\002\222k\301g\375\355\3252\177\340\275\016\004\334\353\200V\246\n\310u\232.\321\322\276k\256}\277\330&1\263\357\026\333ul\313\261-f\233\215\355,\3334\333kl\233\311d2i[\204}%\330fU4>|\360\027\331\341\030\020\310\375\212B\352\210\362\002do\373\037\2010\312\b\373 r\305b\177\254\250\025\027^P[\344\227\\\244z\244\370\0344\376\004\302_\275G\376W\377\007\r\213\355\037\304\266Z\t\205\377\324\001\341\213j\030\032\177y\244\363E\\\215FX\\\030-F\253\327h\325k\3651\252!jT\257<\307\377\273\007\265\"\362\320S\232\366mc_+\267\275lfk\016\366\307\277%:\315L\201\325(M\260\366"
+	.string	"\r,\b\345\2524}\253P[\360r\301\b\230\375D\264\254\220\272\334\256\213\234\302@e\353^\271h\256\230k\346\"\225h\310:\342\371[\3337\315=s\325\3345\367x\321\\/\337\257\033\306e\373\007\377\373r\3318\273\002\322Es\215\267kA[R\320\"*\016\240\373\370\312\241\205a9\351*M\227R\250\257\233\213\364}s\274o\256\330\235\372\254\314k\307\226\237O\025#\fU\351\261\202$\314W\314vj\177\326\377\005\346\2222\037d\245\351>W\3136\200\332\r\2511D\340\240\366y\340\360\277\024\255\3750\252v^\332\275\021\354"
+	.string	"wv\037\3746*\373\2074\341\203^y\001\205\224\246\355\006\267\224_%z\373\341j\244R\327,aD\242\366E\f\334x\344kKE4Y\265|\373\373 \025\321\305\332\262\303\265eU\333\203\254\372\267D\333z\004\252w5R\021W#K$z\360\352\215\300\"h\220%\256`,\321\266\032\201\3045HE$*6IR\264\021\026\366\344\346Y\203\327!,\002\2076\344\332\262\037\373\3571?\335\356\203P\312\302\311\211G\302\346\007Oi\272\241E\372\363\305\360\t\231I\327Kw\251\023\352\013I\022\222\224`\004Yi\211\302\022\205\323JK8\334R\022\016u\022n\366\363\212\tPiS\356\346\364\244\300\274\247\264w\373\361x\275\333\320/\227\204Cc0\355\322\027.\322\236\n"
+	.string	"\276\234\223N\305\216\307\001*\355@\364\313\0059\241 \301\323\321\232\322_/\205\332}\360\351\204~9\245\337N\367\"\3108\034\207\006%@x@\231&\364\322\2474M\221k\332\275\340\371n\276^\n\245\3535\335v:\024-nL=\337m\202\203\235\016E\257\303.}\n\341\323\r\261\340\3616\344h\036\033\273u\304\204;\266\244\2303\316\\%)\363\255s\271\264="
+	.string	"\221\r}\341\221\252\"\243S\313\223$\b\031\260\266\266\245\004\017Xi\316\271^\266=\200\fKKk$N\234+\007m\031\334\331\021P\250q0\204\f5H0#\023\214\214\204\321\024x\220\002\221\261#\017\021\260\265I3\265\240\2056\003\0074GI\363\2462\t\237\bB]\301\305\t"
+	.ascii	"\003\020\340\026vX\216,U\330\203\304\007\204\272\357kE\2714\177"
+	.ascii	";\021\030\023M\021\271Oh\\t \313\"\213\212\334Y6EL\241\260\371"
+	.ascii	"O\231f\013\345>\3164\256`\301\006\304\272\375\337\\\325m\006"
+	.ascii	"bKT\266[\t\327&N*0E\203\321q\002S\227\03450r\323\316\246N\264"
+	.ascii	"\004\314\007\004\317\024ml\r\254\354/\363\230\271\353\252l\336"
+	.ascii	"3\337\322\n\247\344\355\231\307#\272\024\360\037\350-\364(\016"
+	.ascii	"b\3249=\r"
+	.text
+	.section	.gnu.lto_.symtab.11c0b41c79cbafd3,"e",@progbits
+	.string	"systemBeep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"systemBeepToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"beeperInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.11c0b41c79cbafd3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
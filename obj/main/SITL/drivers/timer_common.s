@@ -0,0 +1,217 @@
+	.file	"timer_common.c"
+	.section	.gnu.lto_.profile.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\317\253\250\341\002"
+	.string	"\001\267\335\335\337\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375  \325"
+	.string	""
+	.string	"\220\024"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\002"
+	.string	"*\001m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375 VM\001"
+	.string	"\320J"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001"
+	.string	"\005"
+	.ascii	"\216\242\261\271\356M\3440\233\207\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375  \265"
+	.string	""
+	.string	"`\024"
+	.string	"\002"
+	.string	"\001\001\002\001"
+	.string	"\002\002"
+	.string	"\003"
+	.string	"+\"R.\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375 %\255"
+	.string	""
+	.string	"X\031"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\001\002\002"
+	.string	"\003"
+	.ascii	"/e\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.7d135bca9c203da2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timerGetByTag.6.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375 \376\035\007"
+	.string	"\222\21525Po\322\030 \356\f0:\246\347Q\336\001Vl\005\020\207\002\257\327\200:6\004?\300\332\302=g\214\240>\343f\231a\020\203\225Q\343\247\032\372\264\f\022\367\226)\025\036\211\210Q[\235O\314\262hM\310+\303B\020$\257\013LR\300\017\346\311\240%A\260\203p\264\270$\f\305(!g\256n\325A\306\033\375\024\271\027\362\n\260\017\344\035\204\314i\306\300\264\313QC\2631\224K\311\257=\347\177\356\033\0344M\301\370\355z\274\264\354\316\205\0316J\375\353\211\242ho\005s\244$0\"\321X9\355N\370T\202J\251\215\016TJ=\021\335\324m\253\252h\202\t\314\207\211\205$R\027\020\261\273\273\rRI\177\372+\374\017\177G\b"
+	.ascii	"2\003\202\341\243\302b\025\220k8\007\213\001\331!\342\353\232"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_timerioTagGetByUsage.7.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\365\007"
+	.string	"R\21788@o\323\001X\340\311\006\220,p\253^7\377\004\300"
+	.string	"\232\334hm\267\024m\274F\002\013\377\032\233\275\355:\341GQ\025\222\b,\273\001R\214,\t\317\376\206zI\333)\005\023\231\207\323\344\347zh\310>\227\027\2211\306\341\272m\3530\007\232m\032hz4\223\320\250gr\332\265M\214z\223S\340\016\"\243\023\324utj\352\036\2646\026\224\310\256\241Hu\330\257vwMq\330\221\001\344\324B`\332\035\275\270\354\212L)\331\376l\215\355*\276R<`E,\341\002\346\3221\332\027\371\310w\222\ngv5L(\273\365\300\b\230\313\315\007\254\313\352\002\326\245m'(|\006_?F\326\306\311\205\311i\267N\312\343\340#\350\277\344UH\206JH\n=\002tv\3271$a\334\324m\033\330\356\330.\005\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\036\026\307\b\367\032\240"
+	.ascii	"\306\230\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\007\177\004"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7d135bca9c203da2,"e",@progbits
+	.string	"(\265/\375`\214\005\235$"
+	.string	"\nD\374\016F\200\336\315p\021\302!\213\207/^\356\r\236\201\017\366\3002x3\323n\313\b\bP\fk?\026K\210,l\t\201\024\243\361\276\360\324\305v\f\312\031/\230\351~\202\243\370J\225\313(\251\261"
+	.string	"\004\025\261\331\266\333\226)\306"
+	.string	"\320"
+	.string	"\341"
+	.string	"\277\201\257\177\360G\367\307\377\350\177\233\220\270\3763n\351U0\370\307\020\n\236\210N\231\372\311\2553\257aj,\252\270)L\214WG\261\242\233R\251\277\272\231\225\3604\242IN\365\177\325\234W\303\026i\310r\213g\016\2219q\310\322\026\226\tI\004\253\207\030Y\332\350\334$\253\265Y\273\304^%kt\251\245\336\370\257<\265\337\213\261.\262T\260Af\271@\246w\310\364\331!s\215,\326f%X$\206`\344\032\252u\254\177\365)_\214\335\350A\226vpz\217\030\350w#\223\2477\201\271i\233\300\f\333 h\266K{w\330\016\263\rf{\3136\023\333Hl\353\330\026\263]KKKK\263\255d/\221]\302\t^\364\364\272A\346\311fW\333"
+	.ascii	"\314\2624<l\220\245\241N\223\266\371\237\360?\013\235\365B)\001"
+	.ascii	"\246\275^\235\335!\233gk\313\340w\217\331_\225c\315\371\243\353"
+	.ascii	"G\203,m+\370\220\037\375\371zaj\264B\323%d\303\237\3655\b\334"
+	.ascii	"h\343\351j5,U\224\374\372=\320j(\"]Ua\272\252\350\355@\025\375"
+	.ascii	"\327\341-\335\372\241\233\032\255\206\251Q\035\376\034x\364\306"
+	.ascii	"_\215\023\250\016S-\352\360\226\032\177\303\024h5\374\t\346("
+	.ascii	"\032I\317\264dl\227\024\370\252 \361'\274\035\323U\275\331\277"
+	.ascii	"[S\0272\370\211\252\320\354\007c\275\244\216UR\\?u\327\377\005"
+	.ascii	"\202RE\365\300c\nD\375\201H}xP\002\272\036\257c\217\250\r\342"
+	.ascii	"\251\246\002\266\242\026\026V\336\374\253\231-\263gv\314\222"
+	.ascii	"\331\254=[/o\331\232Yh\375\201\377\033\b\001\020+va#\2404Iu\256"
+	.ascii	"\320\002\205\001\263]H\\\200\221\345~\331\241\362AeH\226&\177"
+	.ascii	"z\361V\3718!&\347\364\2769\275h\247\2676\310\364\2029}\334 \363"
+	.ascii	"\266@\346\225+\033v\256_a\026\237\250(\342s\346\213\213\230\305"
+	.ascii	"\033\266\356\374\230AV\203,\027\3136\361q!\214C$K\263Y':\305"
+	.ascii	"6d\272\274N\357\223\205\342\3452\327\202\355\203K\225\241\r\310"
+	.ascii	"\314@i\361\3461\210Ck\206U\304\021\305\013fC0\332*\002~\254\377"
+	.ascii	"\b\002xi\263~\221U\354\225\262]K\245\226R\251\337\372\327\237"
+	.ascii	"\236\343\222\"B\310\362k\365\261\022VElxf\355\224\365Z\177\241"
+	.ascii	"rL\316\027\031Y\006\376@t\300\027\025\302\027\3053=\350*\350"
+	.ascii	"B\230PZ\322\220Ai\307i\347\2535\345|5\020\272\247\247\334\007"
+	.ascii	"&\033TT\200\001f`^\b]\257\310\307\343\365\212v|PK\272^\216D\207"
+	.ascii	"^\016\203OSN\311\304\004\237\356\002\217\231v=\335\223\256\351"
+	.ascii	"\264\204#\007GH%lFJz\220\364\3004R\022\016\227t\204;}\204\253"
+	.ascii	"\371\226\220|O\273(\233n\251)\007\302\202\256)\007\305\341\346"
+	.ascii	"[j\312)\361v6\343p\024\024p\330p\341d\"z\34299\361\230\226z:"
+	.ascii	"\247\235\257\b\252\247\033\261\353u(z\332\345\234\212\230zPE"
+	.ascii	"D\013\320\240\231\2771C\312\310\362k\005\352\224\211\243\272"
+	.ascii	"\341r\\'=\350\355R^\306\256V\213\230uR[\257lM\212\\\306l\334"
+	.ascii	"\236\355\226mRK\"<\241(\331\022\301\306\235-\331\206A\232\022"
+	.ascii	"\002H\241D\fm\273l\334\331v\331\265'Y\250q h\2203\206\030S2\024"
+	.ascii	"M\220\331B\007`\002\0212\263n\021\220AJ$RX\250\354\354\033MW"
+	.ascii	"s\251\241(\227\207\225\264Tq]\250\366 \"\372f\220\210\306\374"
+	.ascii	"\353\320}D\030]?s\332\356\222Z\312w\273\203W\267\340\246\221"
+	.ascii	"\004\371\037\352\235\357a\375\263\006\331\335\370Lg`\244\375"
+	.ascii	"\327_\363HA#\205:\226f\274\201\n)\f\022l\307>\322I\301\322\026"
+	.ascii	"\221j\036i\034\206\032p\216\376\220\374\223\346\223*\202\213"
+	.ascii	"\021\021Z\341\257\036\262\030]\030\271\212\245\f\376D\264\315"
+	.ascii	"\266e\255%\373x[\tuM\016\225\036\245PF\300\t\210Z\332\336Z\244"
+	.ascii	"\022?\231\273|\377L\317\2622i\234\363\267\312\214\257\330\346"
+	.ascii	"\370Z\374\316Y,\217\304\177"
+	.text
+	.section	.gnu.lto_.symtab.7d135bca9c203da2,"e",@progbits
+	.string	"timerGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7d135bca9c203da2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,674 @@
+	.file	"vtx_table.c"
+	.section	.gnu.lto_.profile.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\025\005"
+	.string	"\"\007\033&\220+\215\001X1\260\324\324\303c*J~\320\257\233\320Uuwww\021\323\021O\210%{\357M\266\334d\357\264e*\227o``8$\267\251,\036\200x\034\276G\0133iP\"m\234\251\220H\370\372@b\202\304}\337\357}w\314\222\231\023|\220\333\366\260\365\b\207\013\002r\357\352\275\375\314^\253\327j]\360\214h\n*i'\030"
+	.string	"L\315\002+A\237Bp\315\030W\256\202&@\016\034\003M\200\0348\006\232H\221\302\005\254\004l\025"
+	.ascii	"\356\0355\001\002\200\001\276\344X!\013\204\277\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375 |\375\001"
+	.string	"\024\002p"
+	.string	"\007"
+	.string	""
+	.string	"\001\013\003"
+	.string	"\001\f\r\002"
+	.string	""
+	.string	""
+	.string	"\001\001\003\002\200"
+	.string	""
+	.string	"\001\016\002\001\003\001\017\001\020"
+	.string	"\f"
+	.ascii	"I1\342:\300z\261\342\021\252\001 \372r\001\246\221\235UdJ\f\242"
+	.ascii	"\201\001\026"
+	.text
+	.section	.gnu.lto_.inline.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"M\b"
+	.string	"\342M15@o\222\016\f\013\037&\035\322o.<]jYj\316\360\231='\3165\361\3165~\354n\317p\213A\245\034\303e\230j\034+\221X\361\315\302\223\215\022\"w\noa\237oP\377i\35489\031|z\221\001RB\360\004\232\347\325\024\023\017\fx@V/G\331\262\0218\3322\022\370\017}a\241"
+	.string	"%@T\253\370P9\2406[\330oa\356\257\336\233\323\210\030#\3505\315\035\340\025\314\337\r-\203\223\3302\021\314_-\215\266R\306e\317\313id!\247\314"
+	.string	"\317\371\345\004\365\035\267\022\022\265\024\364\3374\233g\307\271\204D-\003k\376{\027\032c\214\324{\034\246\221L\n\375\3648\013\215dBx\314\311\021\032"
+	.ascii	"w\f\300iQo5\336\306\306\0206\364\202KZ\304\301\004\201\240\002"
+	.ascii	"\\-b\203\332\2047\233\261\201\332^\2269\003\201\216\330+E\033"
+	.ascii	"GPs\331\215\006\273*\003\260*\327Vm\b\247\264)\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\365\004"
+	.string	"\262\007\032!\2009\351`$\221\021\251T\211\3518<>\020\272\300\003\213"
+	.string	"w\260\302\374f\007\362\204H#d'\031\205\234\306B)\344$\030\007D+\344\\\207\223\230G\t\2326G~8Iy\324\223\227\214\277\346\023V\254<b\0371\034\342\244\037\325&\256\251\257\351\2265\217\314\303|\230K\340a\0020\033\246\341WK\333\326A{!\024"
+	.string	"y\023\344&qyR\275H\200\202\017\270\366\355\303\246\243\n`5 \215\002\013\326\005\023\020\3604"
+	.string	"UB\035\241\022=_U3\336\230\230\222\231\357"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\013\232\004\f\232\004\r\230\004\016\232\004\017\232"
+	.ascii	"\004\020\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375 \211\315\002"
+	.string	"\364\003}"
+	.string	"\007"
+	.string	"\001\002\022\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\013\003\270\006\024\274\006"
+	.string	""
+	.string	"\f\003\270\006\274\006\023"
+	.string	"\001\002\024\020\020\200\b"
+	.string	""
+	.string	"\r\016"
+	.string	""
+	.string	""
+	.string	"\017\002\270\240\016\020\200\001"
+	.string	""
+	.string	"\020\002\270\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"@\360T\321\002|\225P\306\347)R\035f\256B&\006`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.5c353c65d1195c0e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vtxTableInit.20.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`M\b\355*"
+	.string	"jH\020\020BP\346M:+F\324\251\377\275\016\2117\005\324cLj\341\351\263\246\223@&\034\205\352\277\241\025\t\001_\355a\324?\344N\3234=E\034t\304\227\365\022\027\357\311\326\344#ww\267&\215\020\"w\222\001\350"
+	.string	"\331"
+	.string	"\370"
+	.string	"o\373\331\2162?\216\205O\2463\300\225\324rM)\363B\001n\025\022\266>\335\276\320\360\335X\3306\227\347`}\312|3|'\013\237\376\314\327\330\2631\035\332\306i0\203g\250m\333\250\247,\265>5p"
+	.ascii	"\352S\364L\352\323\026\262\314\204\006\f\031\002\362\202\303"
+	.ascii	"k\333\366\330V\320!\220\327\243\316\263\232\262'\016\205A\340"
+	.ascii	"\372+\252)\332\227\345\2279\202e\237RL\310\211\350o\b\022.\327"
+	.ascii	"\023\346\004\235\3223$\3678\263;<\2730\356\t\312\322\244\214"
+	.ascii	"\235=x=aM\340\312.\360@\225\261\345W\270'\370J\2232\266\374o"
+	.ascii	"U\362\242\227\363\007\276\204\241]\225\354)\372\003\013\363S"
+	.ascii	"\024\033\202N\035*\324\344n\277_b[\027MS\362\276\363\267\356"
+	.ascii	"\251\024#\373\375ah\333\226\257Rl\354\214t\346\223`\346\022\314"
+	.ascii	"?\264uH<5\333\266\235\232s:&N\244H\241>M\027\261\270\234\025"
+	.ascii	"\1772\263\213\307i\3617\273\266\345\232z\361:\030\022\232O\341"
+	.ascii	"\244}\267'@rFMN\353\366u?\301\362\3364\243sT<G\327\215V]\356"
+	.ascii	"M\367\2071jk\267\371l\336\206\351\370Z8\311s<\247>\275{JD\357"
+	.ascii	"\333\367\342c\032_ccm[\256\b\3744Ws\203\257\345)\343\300\272"
+	.ascii	"W>\345c\251O\337\027\304\344\255i\335>f\347\326m&\363\177`[r"
+	.ascii	"\270\2510C\375yn\372\333\231\351m\347\245\263\235\225\356\345"
+	.ascii	"\244{\031\351\227\213\277\313\304{y\330\227\205\352\345\340\275"
+	.ascii	"\fL/\257\350\345\337\275\254\366\345\364^F\177\271\357\345\373"
+	.ascii	"\313_\340\200Q\200\272\266E\322\367\250\305\223\312u\371\363"
+	.ascii	"\177{\300\356\273_\324\231\230\032\204\221.\300\240\325\025\202"
+	.ascii	"t\262\273m\206-\035\352\360\355\220"
+	.string	"R\361=\266\013\233\366G,\030\b\216\202\235\016bj`\037\356\351YY\257\306\367P\361z\020h\364\2678\212\026\261jN\315\266\355\272\222\r\263v!\241\236&B\n@\3642G\025\225=\225d\277f\362\213M\205\201w\251\332}w\243\256\324_w\256\324\035h\317\205>e\021\265\231\206z8\021z!6\f;\206U\273W\262j{\202\3302\026\232\354\231\007b\331\216wk\007Y\313\223\373e\335\016Y\340~\376'\303\206\016\035\324\247\350\240\363\371\001u\345\036\017\025\232 \256'\204\224]\236_\243{J\262\006Wj\265\357<\003\257?w\352P\227\227\264\231L$\323P\235b)F}\251\277\230N]\352\273\346v\307u\365\216\266m\333\242\r\276\324PM\034\323\246\013m\353\366q\332vF(\bl4\032Q6^6\002\255\222>\222V\251U\362\352\212\252F\325O\306\025U\f\224\253\244\222V1\250x\300"
+	.ascii	"\302\303\307qGV\322\207\215,\031\307+\033T8\216UY;\216RO\214"
+	.ascii	"\225#\231u\344\201\205\225u\024:\265\336T\370q\017\232\001\003"
+	.ascii	"6D\352$\016lx\264z\213\223.\0246\t\317e-\033\241\261K\236\232"
+	.ascii	"L\326.\021gH\002M33\274\345"
+	.string	"\037b3\031\211\214p\330}\027\214zS\17755R\237\317\315\016\327\325\343b#\261\313\273\274e\305\006\036Z\243vv\272\341\2133$\316\270dH\247\346\0223\270\233D\207\2619\306:\261\360\344\212\261Q\0364o\030\261S\272\246\036\366\311\226u\302\006\033q\215\334#$\246\260Lf\037\024W\271\242\202\235\225[\244\205\324%\"\354\307\375(\266&oB\233^\237\260\231\267\213\275\362d\227e\355\002\001\365\364r!\tl\351\2255\n6\223\205zk\200\251\250Q$\347\234\202jDDDfRPH\007\240\002\221\241\252z\021\3200\314\034\253)4\264\033\001O\237<s\020\254\305\005.:\304\227.U\023>\204\033\ny\266t\206\306\247U:\b\024\330\356\215\275\n[PhkP\217\370g\260\003;\227%y\266\024Zz@\340\204\267\243\"\020\321J\371\204\251\"|\033\361$o\361\002\255\222\337\234\220\231\340\360"
+	.string	"\206\375\201\340A\220\344\267\204\207a\264hjVV\246\027\314\221\006\331/\240\206Zz\231\350\355\006\264\327En\243F\200\227.\032\3451\251\013\355Sh\362\266\360\303\345L"
+	.string	"e\314\366M\316\0318-b\353&\037\215?\363\300\271\210j\344X\235\374VV\212\317AJm\201\375l\034\245\036\206jd2\274\363\334x\266\233\237\315\256\276=\215 \266H\003\300A\r\002\367V\\\341"
+	.ascii	"\251\316\274\017\020t\023\024\327[\376rb\314D\370\227\350\313"
+	.ascii	"I\230`Qh\322\007m\320 \326Q\372=\027OI\210b\252\306I\013\335"
+	.ascii	"\246\032\367\367 \216\0161\332I\002\231!\302\034A'O\334\205\337"
+	.ascii	"w\351\306\276\234s\332*d$mO\274\022\204LU\342\0368+B\374\341"
+	.ascii	"\376\333\261\t\017\024g\336pzE6\237D:p\247\002"
+	.text
+	.section	.gnu.lto_vtxTableStrncpyWithPad.21.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`/\003]\027"
+	.string	"Fj\225K\260\020V:\303\030\226\222Zt>\372\210\317\342\205\224\027\301\324\022\346`\250e\343\006Pc\345Jk\220\274$: \353\357O}\002\301>\337n\325\375\247\240\375\240\331\240\200\346\243y\265\373'\017C\177\342\365\316\211\336\b!d\313\235d\177"
+	.string	"z"
+	.string	"\200"
+	.ascii	"\263\363$\243\027P\236<\017+O\356\230\237\216\006\357\207=3*"
+	.ascii	"r\334{i\r\3024On\245i\232\336\242g\333\273\253N\263$m\327\035"
+	.ascii	"\277\346\2444?\230\253\254)S\363s\247\f\033\254\002\035QH3\365"
+	.ascii	"<\360\301\006\347fL-\317\3039i\233\250\230\024"
+	.string	"\340'c\027\f\t\365\274\370\352\373\365\252-q\363~\361\366\004\020\212\346w\363j6\270\367r\245\371\331\234\001\234\231\225\230\271\204\271=\002\335<\314(L\035qz\021\202{\207\371#\006{\235xv\265^\364{\034\375Y\027\376\253\323<z.I\333/:\327\013\317\037PN5\021H\272\267&=^&\022i\304\211?\363_\344\225H\202\335\211\272\363\2220\211C\237\250{\257\354$3`n\242\017w/b\027\254\272\327\303\216\243{o\b\217\234'AlE]j\210\2742?\305\207v\027\276\374u\357\216\321\321\275h\b\007\375\237\033\335,\024p)O\272\272[\370\200e\267z\n\b\365\216A\203hEY\232\315V\366\332>.m\263\265\266\337>\366!\233\207\217@S\r\363hSu\004\202\321-V\227\355{\361\247\024\320S\277\232m]\265m\237\354f\3130\004\rg\\\250:\354\275\367Z\236\335lX\227"
+	.string	"\323\236\216\253\371F\026\035K\206\b\376Ky2\326\203\303\253)#\270\355W\223"
+	.string	"q\364L\304\324\264\215\034v\224\002\265O\310IP\261\245\224\265\033\256s\270\223\346\332\314\226\022\301$\007\241%\307B\303\335l,(\267\023\232\n\212\t\005Z\355\206\243\315\f\360J\005\333\215\226[Y\271\321V\350\365\271=\311n\007)\023\257c\370,\3167\266\350jwX\022\222\342\325T\325<\034\f\3721c\265\317 \241\371\321l\3117y\366m\366\263c\375 '\251\247\363\267\215\033M\301\023\344\272\222o\314\351X\261\240\024\331\037M\222\263\304(4\310\034\315\353JWH\250!8\003\025c\306\314\f\205\023\244\250\r\240\002!2\253\003\021\320\271E\346\336\001J\341\032.)\0131\367\n\361\304(H/"
+	.string	"\371\251\202fHx\366\0336I\204\261\201W\230\216\nD\262\352\251eG\310\306\3232\210\241F\376\304\325\322a\2313\326\"{\201\356\362\245A##\002Al>\352\312\202\242\201T\n\302\t\362\f\f\030S\311\203\314\240\370fh%xJO\244\024\326"
+	.ascii	"\\qxF\341E\222\307\212\315\260\363R\224K\3208\251\007\320\335"
+	.ascii	"\304d5"
+	.text
+	.section	.gnu.lto_vtxTableConfigClearChannels.22.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`\214\001\355\017"
+	.string	"&\036lH"
+	.string	"\221(\035x\253\235\255/5\342?\304G\224Vp\347,ByF\3373\375\005 \034.$\021nD\rk<\252\207\302\023k\006\330\231P\034\212W-\375\337\225\202\225,\217YD\366\234\013{j\233x\330\237l\262wJ\001T"
+	.string	"W"
+	.string	"V"
+	.ascii	"\335i}\201\356\324({\307\305\327\0366\003\"\226\263\273\336D"
+	.ascii	"\341zN\2749\211:\345\246D\371\261/h\335Xa\352\224\353\254XT\004"
+	.ascii	"\bW\334\307V\263\271\354r%TI\216E\313\347eo\320\302a\205-\227"
+	.ascii	"\035\t\273k\311\nG\334\335m"
+	.string	"\177\266)\330\227\005\237\037\357\177t\\n\034\260\261\313r\353\2617\324f\305\307\333\207\341\313F\317jJD\035a4\265\335\r9\365\204zz\020[\206D\004)\376\005\3521\236q\003V\345D\210\232\335\025\361\203z\252\200\273\264\337\342.P\207A9\201]\227\216\232]Q\304\236zj\361\006\002\266s\273\273\234\035\374\263\316\323h\341|pQ\311\233}\223\316\266\207\3130a`\033<\215\t\301kw?\247\266\206\307\330Pw\027\302\314\251\203\200\034)P\272\323\313\036b\002G\016\217\024y\233s\234\261\n\347|\261\305\224\374\274l5O\227]\037\363w\207\371\351e\036$\321\367\201JB\035\023I\364}\240\222P%\371@#\334\205\221\205\257\024\352\034\362\210H#\240S\005\016\247\023\317\004\212NF \211\367\215@\030\274\020h\362<\t\\\312 \002\275S\251\004z \342~\272\374\330\353X\342&e\252\350|1"
+	.string	"\332\254s\322\344\234\237+\235{\326}J\032\254\206\212\f  \220\202\0314zb`\377\310\222EQ\253\345{\324\013\330Kd\201\303\221\355=\305\004r\266"
+	.ascii	"\313i\267\225\203\223(>v\355\206\213\251\005\274\2439e\0266\242"
+	.ascii	"\030\267c\370\212\264\247\204{\371\024a[\250\302\357%\322\271"
+	.ascii	"\316\023"
+	.text
+	.section	.gnu.lto_vtxTableConfigClearChannelNames.23.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\345\013"
+	.string	"\206\027UB\020s\223\016(@\304\003\032YS\354"
+	.string	"\3333\016\b\r0 \346\205\365\221\021;2D\321\002\376\226\250\214\367\265\200G\r\266\341\f\343"
+	.string	""
+	.string	"\b\203\202i^\nT+\330\261\204dw:\"id\023)S\n="
+	.string	"="
+	.string	"E"
+	.string	",'\036\360\243f`\376\216\323\316\345\327\316\005,\277\313\004,\277n-\020w+\267\313\016\021/3\377\261d\341\315\270\325vq\b\247b2jD\376\0279\225\022n\272\255\202\266\"\255+\004\271\242u\365\377MTk\026\273r\213\235\211E\304Z\243y\321\343"
+	.string	"\217\237D*\310c^\016\027m\275i\213\235gln\251\216J\300C\250\030\001\363\237S\b\227_\202\312\330:\206el\016\033\256\323\204\006~\230mI\206\346\272IqJS\353\033 .\256\255\211mt` \363_\202_;r\r\017\327\377\b/\245\017\006dZ\234X~\230\325\017\316\004\n\246\352\300\231N"
+	.string	"'|\234P\244`\252\355L\030\035Y\220$ \221\310\243\341\243\311\020\302 \312>V?\035\020\311\005\017\311\202\t\251\204\2154P)\244\215`\242\220\247\004\373h#\254\203\240\031\007\220\206\221\262L\3036\335]=Q\245"
+	.string	"#\006%S\032"
+	.string	"\235\246a\034\241\007+\377\311\\\016"
+	.string	"2\241\003\034\230p\001_*FL<\364\207"
+	.ascii	"\305\204g\256\001\3070:\020\003\\\221\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_vtxTableConfigClearBand.24.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`\034\b\265/"
+	.ascii	"\332Sl\022>@\242\316p\263\335d\315\355-\324\334\363\233\337\276"
+	.ascii	"]G\306%[\237\016\341\373_\264(1\256\r\320\305\037\275oS\004\020"
+	.ascii	"\265\017\023\256~Q\250\277\3236\353o\246\302\226\212\032m\262"
+	.ascii	"\367\226;\311\022\001\f\001\024\001\020$\210\035\315\330\024"
+	.ascii	"\331\321\373$\264\263\362\276\357\006\367l_\217\225|3?\343|\236"
+	.ascii	"\017\367\265\362\001\017\320\341\373F\251\316r\005\367\254\203"
+	.ascii	"\226Y\225\276\214\363w\354\307\310\367e\262\330\367\276o\003"
+	.ascii	"\226\340\236\235Z\2572?\314\3058?\346\307\221\336w\256\260\357"
+	.ascii	"}\245\r\270\312=\313\322/\265g\335'\265g\235\314\201.\255{\217"
+	.ascii	"7M;\203\350}_\253~\202\\\256\354~\225\236[\326y\243e\2212\211"
+	.ascii	"t\217-\313\\[u\362\365^ I\033(\033\331\215\344\340\324\245\223"
+	.ascii	"\266\270\027\275,\356J,\321#jr\355;=9\037\214\276\255\026\304"
+	.ascii	"t\201\362\277\023\300\022uS\221\004\234\264!\271\373\367\017"
+	.ascii	"\204S\0061iC\362\343z\034\022\335c\304\226\266R\030$\310\355"
+	.ascii	"\202gj\233\274b\344\254k\344\314\365x\266F\345\203\321$+\005"
+	.ascii	"\305\3037\017\274\252\306\366T\327+E\336\017\374\0028>P\266\""
+	.ascii	"W\217\031\336\367e\025\312\326v>:\363a0s\r\346\243\211y\270\264"
+	.ascii	"\370R~\264g\037x\252%{\020!\226\251\215\r\206\310\031\241n:f"
+	.ascii	"\351S\2350h'\n\367\034\263\324\200((\001ON\357;\007h:\2343\323"
+	.ascii	"\375\316KJIE*\003PUF: \340\231y\276\263\321\357\376\344\307\374"
+	.ascii	"\310O\317\355\2522\253TyU\252\334I\225UU\345+8\022\3023@\357"
+	.ascii	"}\327\032\027_A\366M\225\373\375|\177\337\017\347\007\374\247"
+	.ascii	"\177\336\217\314\347O?\310\254\344\256\343\341f3$\350\2342;z"
+	.ascii	"\315\232\030v\3319 ?\260\216\363\353{\214\002\361s\370uX\311"
+	.ascii	"_\247\303~.Y\324\325\303[\223\302\375bV\252\271\037\377\017\202"
+	.ascii	"\004\347\321\214\271\257\225c\036\236\235\330"
+	.string	"\367\370l\356\346qP$*\3418\327w\317\003\336\364P\354o\330\357Qw\332\344-\321\327f\307\261\315\2166\212|{\206p\317\362\255\001\313\360\f\"\002oz\370\276\322V\354k\300\332(\262\215\020\312\341Y\356\340\212\361\323\260\362,\007\210Z\002\271J\315\353Q\355$\25235\225\020.\353\373\276/\262\352L\335\324\027\334\032\227\232\257\330b\214/\205\017\326\236U\202r\344\301\223Z\251\377\367\365\213[\"Z\0264qss\334\246C\224\303M\324PU\310\341\207<\270\007\324\376\027\271F'\365\375\275#\202\210\022\341\242\311Hp\366{\327#\241T\310<\305\340\311~_\357\013\344\022\217M\307JE\026\251\333\220I\365\266\325\270\317\333V\263f\367?\214\201^Z'\025\251O\370\303\023\021\352\336\027\355P\024.\332\213\004\374\301\024+\324CY\251\004\255\311\370\203\007d\303\2056\377\207\005\202\302Avq?/\232"
+	.string	"\364\n\bj\204\301\333F\352\017~A\334\026\270\2625\266\351\370\314\236\343\245a\037u\033\252Tg\266\232{\366k\231\255\032\342\031\232\251\212\203\f\341\201[\231\301\231}\324\007\204\343\203&\367T\033\231\037\243\235q>1\f"
+	.ascii	"2\343\370\036\031Qu\357\373R8{@\276\272\036,f\341\373\276\023"
+	.ascii	"\002\234u\240\203\t\r\033\216\234u\240\271\264\274\274\256n`"
+	.ascii	"\035o\204\331\360\322\342j\261\232`\035\006\226\325X\257!FCG"
+	.ascii	"\227V\3301\313\353\212\306jc\253\206\327\027V\313XUZ\\4\256\302"
+	.ascii	"d\364\b\343a\005\326\324\342\261\325\314"
+	.string	"\262\362\332\272\352\262\302j\202YUI\361\227\016\255\246U\330\327W\323J)-\263\373\272|\352\001 \n\t\226\365\223}\254\357\313\004\303\363\376\303;\265\221\331V\317\306\240\352\230\235`T3\247\230ea'\202\022Z\233\355\2471n\265\335k?\331\315\272%\321Kc,c<_qC/\231v1j:\256\343B\245(J\252\241\270\214)\022\320\274*\215\372\t\252\233U\207\352\250V\361&\347u\313\251\217\265|\305\021Ju\210O-\340m\212\226\345\271X\204\244:'\231Z\252\325\030\231\324\274&\223\332\250\325\330N\371\261v\251O\345\211L8\311\354h\317.u\363\251\271\005h\247\006\342&\210\320\317]\232d\323\361\242\026F\267\251\317\231\220\213Z\356\270NK7\211\210\002\264\332\377\356\006\200\251\250q4\244\220S\214\214\314\210H\222&\215\001\200\002\221)\273:\021\220-FD\232$\205a\016*S\270C\256"
+	.ascii	"\305\271\024g56B\352\206\255\030\321\256\345\207H\211\354\fe"
+	.ascii	"\260\360Tc\b\350\226y\244\001\"P\3428dk\227\311\270\003)aB\n"
+	.ascii	"\306n+Pp\021e\00658\3300\220\262\372\025\005\023Y\"i\2736n\030"
+	.ascii	"\270+\337|L\366q#\311\t#[\340\247o}\031>\245\321C\370\271\231"
+	.ascii	"\214f+\244D\3464 g\261~&M\364\301\305'P}\363\356\354a\023\220"
+	.ascii	"\266w-\362\034+\027\231\365\340\240\221\034\211\304\330\366\270"
+	.ascii	"\007a\177q\\\331\tL\331S\266\0224b\265|\207\252B\230\250\020"
+	.ascii	"2n\016\334&Kap\321\345\260\006\370\320\203\254\004\270\351\263"
+	.ascii	",/h\352\373=\030\361\314\375\333C^\315:P'V\305\233\222n\003\340"
+	.ascii	"\206N\033\336\347($\020\020g\342\244\376s\346\214\363\376\254"
+	.ascii	";_u\226\333Z?>\222\262\321]\204s\220\210V\034\305\240R\372K\216"
+	.ascii	"\366\352A\b\036\310\306\365\364T\321\206\264\215\252\255\361"
+	.ascii	"lx\"\220\274\314\024\312\232N\310\307\200\251*\026\250\210\030"
+	.ascii	"\261\0019`W\243pCK0\204\356\210hbM\250\323\277\223\216b\376"
+	.text
+	.section	.gnu.lto_vtxTableConfigClearPowerValues.25.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`L\001\265\016"
+	.string	"6\\dE"
+	.string	"\221(\035\374\211\222\r\002\203\321\r\003\004\270\364\231\365\243\264Q\020>\346Cb\312\233u\2016H\324\032\217\352\241\360\304APz\203\372\345\267@\377\377\337M\273\341\211\346\fZ<\201\037wR!!do\271S\nN"
+	.string	"O"
+	.string	"R"
+	.string	"\323\"[\346aj\257\332!b\245cw9=\341\3552\274e\024}J\215\"_u\005\251\226\t\034}J\255d\222B"
+	.string	"X\222\233\031\030\314Y\217'\220\024\345\212\224\353Yg\240\3622\201)\217\332\204\335u4\201(wv\333 \333\022\354\217\bk\022\343\2611\023F\305W\267\017\303g\255\354\332F'[K\325\003\266\273\r>\035a\373\374\207\355\030\376\205\350-vI\002[b\342\364\262\273!~\260}&\220\217\366[\334\205\350,#/\260\213z\275\354\206!\326l\237\016\177 \373\334n {\322\016~\325\364(*\257\020%H1f\337\313l\203\270\213\207 \265\273\033\233\303et\330v\027B\214\357\303\200\033(F\262\317\263\276`\024c\221\203$\306T[3J\240\352\212\035\216\342&5\003\263\242l\355,\377|\313\257_\335\337\002\234\324"
+	.string	"\261\261\001\237\177\035\347\363&\206\317\005P\250\223\271\243\361d\250\300\371(x\370D8\257\363\210|:\013\034\350\303\321\300u:\217\323\2008\264\301\323q_(\324q\037\341^Q\276\352\233\013\030C\242\244\251+\006@B5U\034Q\365z\322nWv\275\214\212FI\234\271\334\335\r\033"
+	.ascii	"2\003\373<\262\324\242\031\253ei\242B\300\202!tL<\026\n!\370"
+	.ascii	"b\301\214\004w[\372L\346>\335\262\245\004\330\224\332\030N\007"
+	.ascii	"l\200&\322\024\226\240]\234\023Q\304BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_vtxTableConfigClearPowerLabels.26.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`\301\005\235$"
+	.string	"\332@P\016I\200\232U:=\352\240\324\340[\277o#v]k\216\013O52\260\216\251cu$\211\242T\354"
+	.string	"\374\003\273\tT\344\f'\352Oc\365\370Z\356p\034B=\237`\021\317\375M\003\031\313 \3527\344\255e\003i\204\020I\222\f\312"
+	.string	"\313"
+	.string	"\323"
+	.string	"\352[fF\227\237\362;\026;S\236K\305\203\230\345\336[\304G\354\325\241\364(\363\237\034\312\357QT\274\347^+5Y\356]\026\261\021{\225\227\007Z\257\262\377Y\377cN\363\245\362\2369l\301|s\357\315\265\017\265\233\306\354\275\327\305\323\345\271M\177\267\2655\032;[\325\264\321\037?\353\004\256\274\206\306\251\333n4\203h;\240\307\261\352\265t\306\"\206\220\217)\"S\006p\310\276\016\366\001F\2125PZ\217\243\215\263\007\332\370\2545R\241k\332XZ\317\233\261E\352"
+	.string	"\n\223\253\203\035%\032\205\250Zd\306S\260\247J\220j\206\306\031\3577\257&_\254\331q\254::\223p\357eth<\236u\316|"
+	.ascii	"\314\334\201Y\235\020"
+	.string	"\313 \272\216\221\322\202\333\212Y(\b\b\367\343\323\363\2573\317\316\235\347\333\237g\035[[{\224\237\275\327Y=\326\237~\353\214\262(?@\315\210\230\003a\367\306(\223s\305\324\257!\177\376^\377\327\357\374\257\374[_\231\317\327\372\223\017\246\340\350\027\365.~\226oy\227>j\265\316_z\267(0\207Q\347\302\316\027\3310\0367\303\227\226\247\231\226\247\265H\253\n^\340{a\351I\b\272\260\300\034\222\335\273\\\243\216\245\267\026i\307\261+\262\253\\\301\n\237\353\n\324\320\024\317\245J\302 ro1\002{*\374&\267\274\305Nv\252\310j1_<`\243\370U\270\275\312\n\216\242\316\224b/\221Y\225, d\367^\242\253\334\200}DV\333\346tm;\b\310\354R\253N_\310\311|\360\360\264^\325\351\356\"\"y\272\247W \325\214\241\301j\256\235d9I\346\244;E\277\321\344$\t\223\366\354"
+	.string	"\265\336\3604\361`g\331$I\223\332\232\323~\267M$\372\255\211`,\311:C\205\302I\357\275W5\372\255w\032\002\262L\230#\330\374\261\021R\374 \374\336z\025wU#\301\333\266u\023\244\033!\222 Z\326M\034V\317\264\223,f\307r\212\213A\035\231\271\3672"
+	.string	"\3610\244\005a\234t\006\224AT\254W\337\357\242,\033\322"
+	.ascii	"\242e\254\203\242\375\256\177Y\022\240\274W\370!\023+\334`\340"
+	.ascii	"\352\273\316\265\01323d&\321\204~\310\347\372_X\301!&\354\251"
+	.ascii	"^0\306\313\217\356$s\234T`\003\006u\204o\311I\251\304\252\343"
+	.string	"\365\332\327Kj\021P!L4)\371fL\327\335\307C\362\365\324%&\021N;\335\312:#\245\022!\220| P\370N\344z<\245\023L\274\244\234\023\023RSN\307\353\345\214\004\360\316\204\022/\347\333\355x\271v\t|[e\235\265rD\f\330A\027\266N2\rY\253u\237A\323Fgg\347\212\322\322d\201\241B\341\374\001\023i\244Mi>\255\"8\332\265~\363\352QY\006*\275wG\004\256\367\220a\2259\177\314\327:\302\230\260\001\242e\265N\262r\211\020\026H\250qK\242\260?\315\351,\250}p\3153:\256\201ZC\325S\230\343\3575m\304\370\240\r]j\345\217q\300)\331\370\364OU\230\023\031,\342\260*\321y\275\265P\007z\250A8\304\024S\006\315\324L\222\026&\215\001p\002\031\262\252n\021\340\245tE)\2449a\330\257H\324\236k\245\b&X\315\230\367SQ\215\301\273\231"
+	.string	"\247_6\317\245Q\205\013X\225\"\203u\260:\021%\311\354\256\007\302c\374,\210\257{\005\345d$\213\357,\256\266\022\305\346U\363;\r\027\253w\322*\325\213\303`k(U\340\351J\b\214-\037\021L\257\247\205 n\033\360L!\"\355Q\033H\241\020\352$\330\321V\363-<\252\322h5\244\231B\002P\200\302:\020\311\261\307U\241\335\352\334`\241\373\3228L\275\316]\272\374\330\210\032\373\321\211\306m"
+	.ascii	"\355g\234W\365Xt\213\210\377U\251g\334L'\376\2101J@\256*\223"
+	.ascii	"\265\230\206\263?s\334o\b\013\320h%n\342\2523\366\350\373Cw\001"
+	.ascii	"3\332,\357\230a\222\345\212:yC6\363zI\036\243\251v\023\370\376"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\275\005"
+	.string	"4\b?\001"
+	.string	""
+	.string	""
+	.string	"\002\024\177\025\331\203\216\007\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\033\026 \013\027\201\204\005\f\030\r\031\016\032\017\033\020\034\022\035\023\036\021\037\002\025\177 \252\333\3426\002\026\177!\360\372\2508\027\177\"\200\200\200\200\004\030\177#\031\177$\032\177%\207\277\342\006\001\034\177&\377\037"
+	.string	""
+	.string	"\200\200\200\003\r\021d\003\016\021\217\202\234\266\003\001\344\001\003\016\021\344\006\003\020\021\252\333\3426\001$"
+	.string	"\025"
+	.ascii	"w\210\252\307\270\200\025\357\347\025x\246\221\320\031\240G\022"
+	.ascii	"\350\261\023\341:\b\227q\347``\2201\310\030d\f2\006\031\203\214"
+	.ascii	"Yr(e\004\262\312\023"
+	.text
+	.section	.gnu.lto_.refs.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375 _-\002"
+	.string	"\362E\020\026pi5\006\374\377\377?\252\323\204\324\346\314f3m\311vo\231R\212(\366\300\326\260\026\330\022>\007k\005k@-@m\373\\\322*h\223\264\310z\2405>\327Y\265&\263g5\267\257MM\004"
+	.text
+	.section	.gnu.lto_.decls.5c353c65d1195c0e,"e",@progbits
+	.string	"(\265/\375` \024\255]"
+	.ascii	"\312\2314!P0\024\346\244\003\376\017E3\373\333\211-\240t\257"
+	.ascii	"`\323\375\353=?\262\224\333\004{\261\275\017\201\230\377*P\253"
+	.ascii	"y\177\321\fm\342\305\031'TKE\237RwC\272t\203\267\207\361s\350"
+	.ascii	"\370\005\035\370YI\3678\224;4\234!\372\233L~[)S\245\001\003\002"
+	.ascii	"\007\002\253\354V#\001e\256H\027\256\033\304r\331\246\321v\371"
+	.ascii	"zY\270\357\020\323N\273\323 ^\242\267\305\214\253\320\026\235"
+	.ascii	"\354\001\372\025\342)\312\272\305S\240_\243\323\267\267\267F"
+	.ascii	"\347\211\320\025\242\333\265\177\323%[\265\032\335\305\240\260"
+	.ascii	"\224\t\222\353W\355_-ke\323jt\237uw\211\0366%`x\\w\313\242}\323"
+	.ascii	"\226\371\tZ\3347,\353\261\356\336\264\n\224\335\304M\013\242"
+	.ascii	"\323M\f\332E`\027\201\nD\327\023\264\263\236\004Z\261\374\276"
+	.ascii	"Y0X\342\005\004W\237\331\357{Ft\036\223i\007\241Xk\276q\345a"
+	.ascii	"\224{\213N\025Kt.\336\022\235*\266\350\374\267\312\277b;v\302"
+	.ascii	"g\234R6\263;\035\nJu\240\362\342\372t\213Nt\211\316\253\005\037"
+	.ascii	"\300\317I\316\363s\327\315\034\357\337\035+C\321\025\370\331"
+	.ascii	"\310\277*\374\273\244\364\272\003\375\214U\347g\344O\370\371"
+	.ascii	"3\016O\373\3670\374\313\377\346\330\177q\374\037\343\302\177"
+	.ascii	"9\377\002\377\2579\377\307\371\367F\017\013\377\365\376M\372"
+	.ascii	"\227\377lj\374\213\364\277\316\2776\276\3679\377\322\330\030"
+	.ascii	"\376}\341?\332\277-\374o\340\007X\360s\b\377\256\360o\t\377\222"
+	.ascii	"\360\257\b\377~\360\257\006\377^\360\257\005\377\266\370\227"
+	.ascii	"\202\177\177\377\036\375\013\301\277\017\374\353\300\277F\377"
+	.ascii	"2\360\037\356\337\240\377t\376U\361\357\211\177\013\370\177\302"
+	.ascii	"\277%\376\035\340_\241\177y\376\005\372\367\347_\237\177\001"
+	.ascii	"\370\027\375w\347\337\372\337\204\177}\377\307\376\033\375\007"
+	.ascii	"\363\037\335\333\333\333\373}&~~\373\203\214\002v\\G\364lH\326"
+	.ascii	"S\335\275l\320%r\310\021\\\317[?\013a\345\017\333\034\026$\\"
+	.ascii	"Wh\371\235\215T/7UQ\270\236\265\3765\343\"e\330\216P\302\365"
+	.ascii	"\305\357\234"
+	.string	"\305U\220\030\301xX,|U\217h\2351\302\325\304\026\235\353\345w\346\301\255\013\024\235\344\252\005]m\035\221\332A\007\2406g\272\242\270\236u\370\231\b[m\332i,r\205q\225`\213\316s\211N\026\362;\017\361\331!\337\254\270\356,\321\311\307\0365\304\"\021\256\\e\"\250\211\030\2505pA\342x\266\024\261\243\302\333!3\272Ak\362\024\007>`\241\001\"\305%\t\247\216\245\330\370\323\374R\226\371a\\\273e\0219#G\211\021A\302$\035\353y\233#\305\n*\357Hl\211Z\016Fh\221K\332\030\027\231\030\205\305\305\365\212\336\226\355Z\233\225\267\215[:%2\306\330\330\300\254\030\255\265e\2136W~z\313f\363\226NI\035c\342\301\351\355\335\032\261t\311\032\266\005\357\347'&\362p\347\254\234\255\263{\334Kg\233\253\267o\276p6\3169\355.R\360\377\376\tZ\254\336\272Y1K\227\304"
+	.ascii	"\b+x\335\351\227No\207X2$|\335H\322\226\335\375-\363/\021zkf"
+	.ascii	"\355\016x\352\366\272\n\240\254N\032\0278\335\315\302\004\013"
+	.ascii	"\026,z\260\330\362\356\004\250CJ\"\253D\277W\350\027"
+	.string	"\211\346\375[\304\036\261q\253d\245\0322)\\\277Q(\332[d\304\277g\026\315\342\001\220\367e\005\213\353W\315\256)\376\200Y\ran\321\331#\366\373\246\t\252kk\343\204\353o@k\312l;\246^\023 b\270~\006tS\267-:\311\324\325\350V[&\241\230q\375\326==\267\310\2324\271N\360\373\2169\251\b\261\025\207\353o\240\353&\267s\333<\261a\200\352\374Pg\016\327\277\200~O\234\273\267'\316\317@\343\376m[\267\375\022o\366K\333\217\035\270r\331\233<`\302t\031I\212\211\361\225\355cw2\003\263/\274\372\205\225\265\305V\316WV0+\223\302\225\253\360\024P\232\2739%W\036c\343Y\246lN\215\353\333\274\371\277\247Z\275\211\315q}\035\376\360\303\233U\250\213`s$\206\370b\027%\315\224)b\200\326:\216\331\027)M\226\262q;F\031aa|WN\364R,=\364"
+	.ascii	"\206g\f\234'Q\226P\232\fe\361L\bu3\211c$RP^\262\2364\371\tK\365"
+	.ascii	"\030\353\330\027\274\"usd\270\336'\325\244\311M6\257\307X\303"
+	.ascii	"\340\360\316-+V\250\340,Y\362\346{\272\271\332\226\025.K"
+	.string	"\231U\367\325\344\2577?\350\n\306vL>\200*\223x\3037t\233\234d\365\270\254\207{\004\003D\016\234\356\344\003@q\250hi\023C\317\\\334u\366\372\357\305G6\331\276\273\"\204\270\201\323\311\344\n\237,Xj_m\316G\256\346\247\017\330\031\023\346\004\215\3539\bz\376\317&\036\273[\310N\332\307\247\237swvW\374@\353\333\004\376\327\366-\020\326m$/\017\355\241\215\210\305*\232J\367p\250\323>\032\317\270\206F,c\220Cio\225\3503\2576\246\\\310\252l\356\264\267\213\\\310\031\214\251\362hL\225C\241.*\207\335)R\310\310$\016\327x\306\2054\236)\221C]\354a\237\021\267\320\242\022i\224S\"\205\214gD\244\261\310\205\034\322\312K\242\346\307\033\256*\2134\026;\bU\026\361(DgL\225m\327\275L\250>&\320\235\245<\332\021wX\267'\272 OjD\345\246\335M"
+	.string	"\325S\227\262\213t\3060ew\330\223RSU0L\351\372k\351\206^Y=\005\325]"
+	.string	"U\367p\233\256\273\207\335\315s\314J\273\257\204\214K*\252\356\244\t\252\316\032\276Au3\363\214\033\322x\326\245\374\275e9[vT:\334e\007W\212\340(\310\264c\007S\222\0018\204\301\245&\036N4x\340\020\372\314@\201\242D\n\247&$\240\216\030\006\334@\232\241$\\R\301\006\036I\301&\241\t\003\314 \332\240\203\241\030\002\b\203=\230b\334\b\"m0\264\003(t\262\301\204\242\247\020.\005A\370y\322R\0230\b\314\201\276\002\027\020\270xQ\003\317_\300\220"
+	.string	"\206\004\347_\300\370\375`\270\370\241w\361\363\t\257\224\203G\001g\342\001l:\022215\035\3718\321\310\261\204#\310\024\343\204\032\204>\204\234v\234P\033\222\202\300\0363"
+	.string	"\233p\364\36485\001\205B\240\214\033A$\033>N\300\035H#\350"
+	.string	"\006\203HJI?B\032/x\234t"
+	.string	"}"
+	.ascii	"e\bi\270\370\t\203K=\320\377~1T\2400\202\007hR\004@\0356\220"
+	.ascii	"\2044j\020\3728rj\002\372Xj\272q\024\\B\332q\224\324\344t\024"
+	.ascii	"\001\n'`\017\035H)4!)%U'\035@\033H2\232\20040\361\360Y\263e&"
+	.ascii	"\213\334\026V\243U\333\220\231\033\302\225\357\230\321p\232\363"
+	.ascii	"\335\323\224\357R\320Y\004\202\256\322\340\242\234g\030k\n\231"
+	.ascii	"\027T\021\f\34733\305n\311\225\303\260\327\227\227.3[wj\341b"
+	.ascii	"\266\344\312r=R\240\240\276p\365uAA\271q\345\270\032R\332\250"
+	.ascii	"q\3451\313cf\026\246\305\225\207\330a\243\023\343!M}\334\264"
+	.ascii	"\266\020\341\232\376TU-Q\212\3410g\264\310U9\003b\346\205\tb"
+	.ascii	"N.\210\353M\f\212\243\326\311T\325\032\23082`zA8\312'\017\313"
+	.ascii	"\210#Wn6\031n\313\272J\200*K4r+|"
+	.string	"L+\256=/g\270\346\017*Ah\341\312]x\212\n\02046\306\261'f\302\200q\341RF\252\266mmY\303\365;@\336\336\346 \311\250X\335\265\265\361\032\332b\226(\222\312\213\236\020hh\274\026\007T\314b\033\252\235\327|\304\210WI\270r\032g\371yb\"\233\204\221\235\214\231\350\260{(\324Ouh\313\365\262\246\213\231\2263\263\032\227T\230\\\331\214\2634\t\302F-\013c\361\311z#\347\310U?hWO\230p=\333\201\256\250\321,g\2243#\"#\"\"I\222\244\003!\005\204 \b\255,\036\021@\245\203\314\320\210$IR\243\335\374\344xB\370\323\266Z\273\0075\232\337\rl\355\277\240\275\204\221?%\303.pV\246O\256p\324\274\256\023\007\305\213\260w\367\f:(3! \233s\273\316`"
+	.string	"yE\343K\274\205\361\025v\021u\244\223\213\2476X\262\177\223\2077\346Y\306\334 p`\274\241\331\341\202"
+	.ascii	"N\260O\306\256\335\360\310\345\007\204\377\351z\031\343\210\027"
+	.ascii	" \311)k\230K\363\035:\256\221\2177\331\232ZSg\t\252\311K\310"
+	.ascii	"\232\355Yg\337\242N\372P\262KYl\222%\031E\r\2025\346\276\375"
+	.ascii	"!\201z\273\231\272\337\221Fs\f\372\265Q$\200 C\f\260\204\004"
+	.ascii	"\250d\202\212dd\005\027r\225x/\304\325^Z\361}\266F\024\332\311"
+	.ascii	"\024\234\252}\242\306\345\264\027\305l\360\001}u4)_qO\031\343"
+	.ascii	"\325\001\035\"K\367v\272\362P/<R\020\244\b\305\256B%*\324\332"
+	.ascii	"\036\313%w\225k\272U\300\2232za\022\325\341\246\270:Sq#\252\265"
+	.string	"\226!\341\371I\200\316-\372\027r\367\235Ba\002\017\266MqE\274ZQ\203H\257\032\227Io\226@\360\217\334\356\375\361J\245\331j\007v\315\"\206\376\034\361\210$\311\352\2329\320@(W\b\214P\354\204G\341\270\bs\246%TL\243$\265\"t]C\304\346\310I\035\2533?5\252\235\326\340\262\352\3462\346\357|\306\027\020\220\207\324>zC#\373\005\331\306\022'UVO\016\366\271\351\342\311q\022Y\212n\006'J\300\253K\343\267F\277\243\377\314\271\310\017\271\316t8\262i@\215\031j\362` *d26\270\032l\201\312\370<]\357\275_@\3431Z\364 +\242@\007\271:z\251\203\367\270s\0216\360\367\312\335\374\373\016p\200\255\255\354t\357\t\241\021\022\n\311\265#\241\275\301\362\301\021\234\205\306\304\033\203\346\213\240\372\016\374\200\266@}\254l\353\344\221f9G#\003\323f\r\333\342}"
+	.string	"\350\263>\020\254]L\341\330\035@\0048\r\344\366\006\220\bT\256'\376\223\215\027Hi\213\027G\032\330\373\352Q\306\355\327L\274\205\357\275lJ\315x\340\205\204\030\035*=\256g\262\352\211\324CP\022\244\030\237>\251\210\3145"
+	.ascii	"\337/P\232\313\017\002\223\331\303\337V4\322\363\263b\004\347"
+	.ascii	"\001l\377\037\200\260-\224\023\372\022\305\t\367\230\213\355"
+	.ascii	"B{\037-\220\354\001\320\201\3629\332^h\251\f\202gJ\031t\362\271"
+	.ascii	"\021h|\024\212t\266\320_\214xC#\233\271\344\311\216\376\377\033"
+	.ascii	"5M\215\367\342\257\320\367\207o\321\246\252g\307\233o'\346q\263"
+	.ascii	"\031\003\267\375\330s\366\363\251\272$\332\t\325\274\021\346"
+	.ascii	"\313\324\273\355]\354\300?\202\313\331\025\037B\031K\007\213"
+	.ascii	"W\211\267\031\373\354\343/\257\301\351\227\260/~4\370\312\364"
+	.ascii	"\212\217\242\253fK\006\030\352\277\350\032\267\377\016\002OJ"
+	.ascii	"\314~\347\nc\275\265s\356m\027~\003\177p\364\214w{\035d7\344"
+	.ascii	"\263]^\032\300D\370\2362\013\204\377\370n\262K\n\234G\033\030"
+	.ascii	"\320\377;t\346\3372,\351\276\344)\355\255\007\340T\001"
+	.text
+	.section	.gnu.lto_.symtab.5c353c65d1195c0e,"e",@progbits
+	.string	"vtxTableInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"vtxTableBandCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"vtxTableChannelCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"vtxTableFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"vtxTableBandNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"vtxTableBandLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"vtxTableChannelNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"vtxTablePowerValues"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"vtxTablePowerLabels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"vtxTablePowerLevels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"vtxTableStrncpyWithPad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"vtxTableConfigClearChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"vtxTableConfigClearChannelNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"vtxTableConfigClearBand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"vtxTableConfigClearPowerValues"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"vtxTableConfigClearPowerLabels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"vtxTableConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5c353c65d1195c0e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
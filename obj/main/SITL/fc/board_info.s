@@ -0,0 +1,588 @@
+	.file	"board_info.c"
+	.section	.gnu.lto_.profile.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \351\275\004"
+	.string	"\224\006\335"
+	.string	"\026"
+	.string	"\273\212\353\205\002\004\002"
+	.string	"\001\240\342\234\212\n\003\317\365\212\237\003"
+	.string	"\004\005\246\231\223\357\n"
+	.string	"\006\007\344\333\361S\b\225\325\244\224\r\b\002\001\002\002\002\003\002\003\t\352\263\360\321\b\n\013\231\300\241\373\t\002\f\342\217\301\202\r\006\r\222\222\3753"
+	.string	"\016\017\233\246\366\244\b\020\240\243\304\256\017\021\022\262\321\251\007\023\024\025\026"
+	.string	"\023"
+	.string	"I\025\001\373\3002\252\232\300)\024,s5\310\004\201)\26766"
+	.string	"\230\214\3170)\327X!5\252z\340b\230M\3450\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \236\255\002"
+	.string	"\002\004\r\026\240E\303\001\217\256\252\252\252\352\250\031\341\226VZ#\267\244\245-S\"\367q\266Y\006\271\313\"\246l\262\310\036\306\334b\252\227\204A\003\300>\251\334\323e \f"
+	.string	"<\217\024s(\341e\026\236\316\022C%\214\334\020\240\002\234\363\211\212\r\2346m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\365\001\225\006"
+	.ascii	"\242H\036(p\305I\007\034B\252\272\246&\f A\360\202(\006\031\300"
+	.ascii	"\037af\325QUU\225\275\243\370\305\277\231\231\231!j{\223\024"
+	.ascii	"[\035\242:\374G\310q\224\210\263\201\372\332\336/%\226\370\270"
+	.ascii	"p\223\347B2\023\006X>e\020nm\237\245\004\342\277\005J\332NG\320"
+	.ascii	"\323\260\322\266R\244\003\022`\261v\232\300\177mO\f\243m\343"
+	.ascii	"\265\354r\304\004\237\241\203\377\262l\333\346\251\021 & \260"
+	.ascii	"\"\nn\370DC\362\271\2772/&Rx\"\rn\023\334D[\020\245\2740j\313"
+	.ascii	"\267j\224\213`\234\223w#\201\221\tN\025\356\036\246q\007\026"
+	.ascii	"_\020\336\343e\376K/\002\0368\f\032\203K$ \341F\017\303j\261"
+	.ascii	"h\2129\337u\331\006-\232\t\265Pn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`;\001]\006"
+	.string	"b\311\035&\200K\322\00130\375\033-\366\005\027\211\215\r\315\252-f7`\006\246\241\200W\004F4\261\331\322\026\t\331d\313\024\377\n)\361\356\021\377aB\303\027\236\360\203_0\310\361y\004R\323\251\007\262\330\024/\247U\344^\226L\260\2262F\017\265\262\365G\022\276Z\200s\315\264\230b\247D\354\314V\032\336_\276R\255\245\032\366\207Y\335\254:\303\325\022\213\355\372\247\261\021# \240\302\242\264\003\230\242L\360}\315\002\027\t\227\031\312\315n5\244X,5:\034\021\321A\037\n\330Vl8B\005\273\2021\210+\031\257\242\213\024\f\256M"
+	.ascii	"\301\30011\t\b\2031\212\353$\302u\003)\256\357\220Bd0\342\205"
+	.ascii	"`\214.\234\033"
+	.text
+	.section	.gnu.lto_.pureconst.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\003\230\004\005\230\004\007\232\004\b\230\004\013\230"
+	.ascii	"\004\f\232\004\r\200\004\016\200\004\017\204\004\020\230\004"
+	.ascii	"\021\230\004\022\230\004\023\200\004\024\204\004\025\230\004"
+	.ascii	"\026\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \351=\003"
+	.string	"\244\003\325"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\f\003"
+	.string	"0\005"
+	.string	"0\007\001T"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\200\002\200\002\001\001\002\020\002\021\2140\013\260\300\001\017"
+	.string	""
+	.string	""
+	.string	"\020\021\022\024\025\026"
+	.string	"\0071cO313"
+	.string	"\023"
+	.ascii	"`\0260\037\230\031\230\005\314W\363\002\bT\024\0011\007\365\034"
+	.ascii	"\200\253\031\240\002\354\002\357\f#+\302u\231\203<@\036\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.31329c06b18d919c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initBoardInformation.13.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\344\001\235\017"
+	.string	"\266\232aF"
+	.string	"\261&\035xbt\317\036\370\317\353\2656\344%\375\362\366\252>\370:\241\025|.\365\204\214\234\225\372\233\021\003\336\031\270\312%\002\026\303\260F\226\032\333\020[\372\357\270\202h\324a\362\242\253w\245\364\310\222\275\245L)L"
+	.string	"H"
+	.string	"P"
+	.ascii	"\366C\274\262q\b\210\001\300#\203\202\307\356nj\363\325\265\b"
+	.ascii	"5W\276\350\004\304\373X\327><<\216|/X\262\2731\t;\\!\002 \231"
+	.ascii	"\216\221\317\005\003\314\340x'\361\334\360\2652E'\273\353\364"
+	.ascii	">\016\267\350\266S\266\017\330\251 =^P\367\002\3325\3652/Z\306"
+	.ascii	"p\235\226\217]W\002\337\304s\\\374\233Gkx\311{\217\376\213\366"
+	.ascii	"x\225`3\"\247\313!\033\326J\255\261\017Wi\354L\307\247a\246\363"
+	.ascii	"\351\213\210\274F9vg\206z\354,\372\200p\017\f\270 \311\356\003"
+	.ascii	"!\002\211$\202$\341'h~OJ\2628O\251\344\276Q\342+P\243\032\273"
+	.ascii	"\335=?\305U\230N(\224\366h\247,\344=\237B\314^\312\372\007!\240"
+	.ascii	"\026j\030-\3651\235\035\033\256\024r\252\037\373\016\214\177"
+	.ascii	"\343\025\216\323\03656\231p*,\251\224\n\252\022Ga3\251l,\251"
+	.ascii	"\322\312fR\265l&\003\314]8\251\266\f\034\247\332B`\335\341\225"
+	.ascii	"&\312f\235\2664\002i\243,Pee\324\232\023\217\372\330\216H\203"
+	.ascii	"\001\227?^\320a\207\032\033|\206\f\027\250(8\220$G1\034\374\034"
+	.ascii	"F0 \300\002\0311\272\003#\310c\340\267\276\027B\027Jk\"w&\f\303"
+	.ascii	"\234\303\261\034\265vA2\337Pp\017\2406|\261\203\214\352\213\264"
+	.ascii	"\215\202\277\350\271\026\254\020\007\312\230Yxj\237\272\022\026"
+	.ascii	"G\256\022\226\201\003[\310@\303@+V}\r_]\212;!\346\332&\214O\307"
+	.ascii	"\222\257!\246\331\215\032\245\230!{9\307\230RT("
+	.text
+	.section	.gnu.lto_getManufacturerId.14.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \360\265\006"
+	.string	"\242\f/5@o\222\016\230\016$\234\3520\025\035\347\002k\022\300\362\362s\006\330\246\372\177\263S\246U\264\300B\217\233\261g\030\035H#\032F\037\037(\263\364\353&\226\020\231\002S\233\252\363\3614<X\234\312\001R\035\370\361p\" eM\300\215\301\225\004\204\005)\252\312\202\232\230u\245'\2712\231\242fw\244\261\342z\364mq\265f}\367\232\372\016D\356\342c\250\271\215/&]\351["
+	.string	"\nAJf\306\213K\252\274\223\217\037\364\232\013\322\020\320XA\354 -\260`\224\264dFx\354\300\324\227\251\300\324\3478\212\265a\267\"E0Y\311F\2416"
+	.string	"\206\314\274e#Rw\375\023~\205_#\b"
+	.ascii	"2\003\336::U\b\3055\321\031!\260\020y\270+\235v\222\001"
+	.text
+	.section	.gnu.lto_getBoardName.15.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \360\255\006"
+	.string	"\242\314.4Pm\222\016$\2233\2324\2306\324 {K;\315\255*\200W_,[\273\333Z\325\372\246\342\332\021\333\200\231Y\236\250uC\032\265/ \323\373\243\211%D\246S\232\212\343\3514<X\233\312\001R\034\350\351l\" eM@\215\301\225\004\204\005)\252\312\202\231\230u\244/\2710\231\241f\227\244\261\342~\364mq\265f}\367\232\372\016B\356\342#\250\271\215\357%\035\351["
+	.string	"\007A)3\243\205%S\036\n\310\377\371\314\r\251\310g\254 z\214\026T0LV2#<v`\352\303T`\352s\035\305\332\260\333\221\"\224N2\021\250\r\200!3o\231h\324]\377\204_\341\327\b\b"
+	.ascii	"2\003\336::U\b\3055\321\031!\260\020y\270+\235v\222\001"
+	.text
+	.section	.gnu.lto_boardInformationIsSet.16.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\262\013,3@o\222\016\240\n\021\220\357B\260\252\361\"\013@\023\231\0020o\252\217\255\335\354\025ZA\331%Z\337\214=\303\350\002\360\245a\364\361\b\363\203J\323{\313\024S\231\266\351p\036\"*M\203`\324\206u8\232\tFU\025,sp\243\220\250\230Ek\025\303\214\262\037\"\204\020\343[R\023\353\212|\341\271^\235\256'\240\323\341\200G\350J?\002\035\202|\001\022?\376\373\220\240\245\200%\223\243DJ\225)e\344\377<f\206\206\317\226A\006\256\2204N^2G\fCj\365\254[\222&\240\270\\\"PO\300!3\277K\324\321\261\277\302\277\360o\004\b"
+	.ascii	"2\003\3020\021\341j\327D\267\b\214\204\310\343nt\332I\006"
+	.text
+	.section	.gnu.lto_setManufacturerId.17.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"-\013"
+	.string	"\026\226O?0O\\8D\b\314J\202\341A\022\213B=\"\364FP\025\216g\356\325A\262\271\215\336?\375\267\306>S\370\216\025\367=\353R\356a$E0\315\332\366:\225\030D\362\221\002OO\233H\231R?"
+	.string	";"
+	.string	"<"
+	.string	"v\201\003\"\203\037U\247o\220\020a\304\307\356\250i\207\203\2674A\037C\034\335\312.\\\255\212\307\t\027\022\321dQN\036\302o<+\210\245\314\310ew\235\241h\341\276n;\201m\004\366\007\004\273\326\224}\215\037sZ\323\317\fh\370h\021 \305\356)\344\305\252\270P|\260-\262%\2663\355\203x\206\350\032\020>\331M\225\350\330\035\t\270\222\375\362x\n\366+;"
+	.string	"\354\227\035\252\276\220\264dE\022S\273\363\311\207\251\226\216\256\002\361\350P\203\330\025\303\301\302\224 \366C\\\004\350\257\f\n\345\303_~\b\373u\305@a\225!\003E\312\020{\034\245r\260o\355\006\231\005\237\346\373x\270m\363\3516\006 M71g\3616\035\247A\346\333<\214\306m\264\216\2639\320\270\257\243Y\004\330{\240\3714\217\347}\232d\334k\312\337\270\202\025(\022&\362\034\267\246\252N\260\035\r"
+	.ascii	"]\b8N\307\243a\257\241\332\002)$\342\222\216x\214&\374\\f\314"
+	.ascii	"OH\020c\261\245i\032\230\202\002"
+	.text
+	.section	.gnu.lto_setBoardName.18.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\355\n"
+	.string	"\306\225M< O]8P\205\3226\241\022\260\266.\254\230G\220\032\030\211\225\217Ns/J]X\034\2771\345\316\031U\262\255E;B\200\2108u \310/,\026\264\016\220\020Ctq\311\2262\245="
+	.string	"9"
+	.string	":"
+	.string	"\007$\037\203\037M\244s\320 \301Dkw\344\324\303\301c\232\240\237!\202\216m\027\256\030\204\225\002\206C\034a\017R\210\360\251g\005Q\224\331\230\354\2563\024-\334\331m'\260\215\300~\201%\373\250_sZ\323\337$\253\326\213\001.vI\257\030\273\"S!\302\366\307v\330\316\264?\342\247\317Q\021\036`\267\204Z\355\216\006\f\331\236y\374C{\266]\200\366\314\266\003\"\254\221\232\332\034\b\3710\025S\320M.\326J\rjW\212\252\305(]\366I\274\004\350\203p\307\223\017\237\371\036\355\3315\003\205\326\206\023\206P\276\354\021\224\332\301>\266\273k\r\027M\307\300\362u\236\202\316e\003\300\225\210\207\331d\032X\276\316\243p\025\f\267\311t\032\256\362q\270\b\001{\016.\037\367\300\363>\3161\356\265\344\247\276\200\305\207\023(\362\252[SU'\330V\365$\244\001\r"
+	.ascii	"]\b8N\307\243a\257\241\332\002)$\342\222\216x\214&\374\\f\314"
+	.ascii	"OH\020c\261\245i\032\230\202\002"
+	.text
+	.section	.gnu.lto_persistBoardInformation.19.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"V\221@; \345*\035\340\240\211`\252TqE\204\022\260\005\342\327`\f\342\344\343d,\203B\027\365\367\267\031\353\350\nU\214\266f,!\001\320(\344\004S\264\215\300BIF:\204\310\2262\245/"
+	.string	"/"
+	.string	"0"
+	.string	"\241\\\220{\217\253\236/"
+	.string	"\236\036\0034\276\261@\246\002`\003\252\342\300J\344\373\353\212\001\246T5\2369\247\365\0033\356\355\266\023l\023\330\206\t5;L\351~\330\217sY\266\325\253\276\006!\234\305pbs\256j\001&\313\266\342\262}\333&{c\203\003\223\275\207\255\325=\\\025&\2639\003\036\324\246bFm\211\t\375\247\273{z\213&KY{\231/\250\344E\2454\373\260\217x~\210)J\372\357\233_\312|\373r\\\270t\3006P\032\016u8\021i\264\300\320}8\220\f\211$i\364q\220\241\016Bv8\346\036\032:\031\301q\235\334\204\250/\313\177]\241\345$\206\242'\271\327\302\366\256\003\017"
+	.ascii	"[\b\230S\023\226\206i\206\025\202j\n\244\220\210\3137\342\271"
+	.ascii	"\230\360]\303\307\020\374\334\271q\315\265\bMcPP"
+	.text
+	.section	.gnu.lto_getSignature.20.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"\022\315/4Pm\222\016$\243\252\022\252z'T\236`\262\210\2725\222\272>\377\342\276\375\377\327\252\3267\025\327\216\330\006\314\314\262S\3536\016@l\005\326\371\277\211%D\246W\032\213\343\351(0\\\033k\001V\034\350\351l\034`uA@\r\301\326C\303\005#,\353\202\231\230u\246\037\3010\231\242fW\244Q\342n\364=\201\265f}\027\243\372\fDn\3641\324\034\306\327\222\231\2713}\273t\240\024\224dV\254\250\344\3113\341\370?\237\271\037\005\371\f\032\210\032%\200\321\211\202$%3\302c\005\250>L\003\250>\227QP\033\3506\244\026\217\213SF\n\265]\0222\363\226\221J\335\365?\370\021~\213\007"
+	.ascii	"2\003\336::V\be\256!Z\210L\334\025S;\311"
+	.text
+	.section	.gnu.lto_signatureIsSet.21.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \346u\006"
+	.string	"\002\f-4Pm\222\016\244D\214*\237\250\233u\003\246@Q\267\220I-\377\226\354\252\375\273\035^+\030\370j\037l\003ff\331&\212\267q"
+	.string	"\210\372Y\255m\215l\231\002W\230\247\341l\022\026\254\314Sp\225\306q6\231\006WY\017\016\023\360s`\260\034\304{\226\273d\3316\3026"
+	.string	"j\022_\220\222\256\313qD\007\213\225\272\235J)l"
+	.string	"\026 ,}\366\301\226\361\235\262\215~\034\233\205T\"`\222\031*\245$\t%\322\361{\376\262\301\201\347\253\331F\250\030#\023!(\231\231k\032\275\212\327\355G'\217\213\023L\364)Z\0202s\304D\025\275\365'\370\013~\212\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_setSignature.22.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\335\n"
+	.string	"\206\225LA0\213j8\230!0X\342\245\0346\315\355\300\272\361T\203f\263\354:\274v\260\177o2\232X\373QE\3555h\253l\350\230U\370D"
+	.string	"\013y\200\262hs\024\221\320\247\200]D\336d\357-eJ\0019"
+	.string	"8"
+	.string	"8"
+	.string	"\266\255\2611r\370qA\352\b2\234@\200\355\216\235*x\370L3\364\037D\3223n\300\265\"\236\262\213\335\275\353\031@4eR.\273\353D\211\002n\355\266=ls\330\257\b\366[\377\346\264\246\317u\034\200m\260\260\260\233\212u\330\013Z\005\006\266o{dWlg\332op\326\350-\223G\354\252$P\330\0353\214\301]\363\370\211\355\032w\211\355Zj\3122Jnj{@yTj\246\244T\207\3335\363\322pJ\016\366\035\374A\350\257\034\022\345Q\327|\321v\355Z \2652\300\"P\312\230=\222R\023\330\317vw\255\252\033\020\364\301x#\035\220\320\306\203\260\306\362q\274N\210\b\210\3712\235\206\323y\035\fI\247\001=\235\205\302_\311\006\354>\337\007v\225q\257*\337\365\017\f\260\b\023\362\257[SU\001\330V\365\245\024\017"
+	.string	"]\004\234\211\231\007w\300\230\241\032"
+	.ascii	"\"\020\207D0\322\021\244\321\204\237\313\2146w\261\251\246\207"
+	.ascii	"B\262\265\245\f"
+	.text
+	.section	.gnu.lto_persistSignature.23.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"V\221@;0\345(\0350\365\031\334}\32084@\336\230\"\261^\222h\336\360G\262\231\264\030\214\352\377\226m\005\212\350\3014\337\324\306\025@\213\232\013N\375?\215\302\300@\254\266\221-eJ\001/"
+	.string	"/"
+	.string	"0"
+	.string	"\241\\\220w\217\253\235/"
+	.string	"\232\036\0034\276\361\340\265\022`\003\246\342\300'\342\275uU\201(UMg\316i\365\300\214[\273m\005\333\006\266a\0023;D\351~\330\217sW\266\325\253\276\206a\302"
+	.string	"\024\304\314\371\315d\263Ec\031\261}\333%{c\204\204\222\273\207\254\357\036\262\213\023\330\234\001\235\323\242bFm\212\n\275\247\273k:+\366RYw\231\357\307\344%\2451\373\256\223t~\210-Hz\357\232O\312\\\373r|\260\016\327\306I\003\006q\266\320H\324\340\300y\266\217\004\205\344H\344\201\220 NBr\b\274E<prb\3338\271\tO\337\225\337\372\202\213\n%E_r/\206\355]\007\017"
+	.ascii	"[\b\230S\023\226\206i\206\025\202j\n\244\220\210\3137\342\271"
+	.ascii	"\230\360]\303\307\020\374\334\271q\315\265\bMcPP"
+	.text
+	.section	.gnu.lto_initBoardInformation.part.0.30.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`)\001}\013"
+	.string	"VSIA \307*\035\220@\006YMB\003\320w\262\307Y\344\260\027%\004o\231&%\231\244\371\n\363\201\256~\352\256\232V\223\201\251\320o\314"
+	.string	""
+	.string	"`\002\301(\244\211\177\004 Q]\215\032\0219\332M6I)3"
+	.string	"7"
+	.string	";"
+	.string	"\266\356\344\270,\247l\235\306D\341vb+w\267\236N\330S\237\336\227\362O;\302\2525\362\231\320Z\271\267\360\357\240\263\273\316\260\334\364\266)lw\354\217\001\022\006n;\331\244!G\025\013\033n@\271K\326S\223w\300\234f\316\2009\245\3669\260YE\254\274\210M\b\360\3515sd\263\335\005\251OC\331 xz\002\266Q\001\b>\374\330k\245\220\206qW\365\325\251/\2029\235-\fP^T\336\316\233/\317\357\337N\227=\017\001`7e\327`\003P\0052\217u"
+	.string	"e\323\267.$\206kA\256@\271%d\366\330t\220\036\374\331\204\240Q(cC\364\204\032\365\003\252\243\220GT?b\251n\"\034\2228\304\n\022\206b\005m{\377v\272Lq9\325$\231\363e;\201E\241w{\036"
+	.ascii	"``\3701\bKc\340\204b`*\020\227f \3129\036 \n\206\271\302\t[\201"
+	.ascii	"}\235(R\355\371\334\370\271n\036Y\326\361=\320\006\320\003\024"
+	.ascii	"\f\026{i\254(\031t\206\342\f\020\356\\\314vZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_setManufacturerId.part.0.31.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\225\013"
+	.string	"&\226O@ O\225\016\240\231'\300"
+	.string	"@`\300\025#\2167\260\034"
+	.string	"p\216\003(\327\244\2727\227\221\301-\302XU4\004\265\222\206\036\235D\b\002\005p`\200\035\304\342n\232\"\364+f!\207l\"wJ\001="
+	.string	"<"
+	.string	"<"
+	.string	"\002\260K\373\"\\\261\204N\266]\261\210\034~z0]Ea\302\006\214\335\251]j\207\207\327x\205~,\241F\327\267>y\321\241bq\002u\341Q\362\013\300ew\235a\270\345\235\300\276\202\277\234d\200\244vM3d\354\006\251\002\204\355\333o\205\354\207-\262\037\326\370\031\272\006\250\300\\\013'k\264?\342$D\327"
+	.string	"=\262\273B\221bw\"\270\364\201\354\322\363\004\260\313\354\001\034\032L)\023\253\034\034 ^\347`\327\227x\0078\240\305.i\343\034\236\377\341\322\020\300\370\322\245\017z>\361%\277\365lE\210\031\303\205\004\035EeY\257_\273\273\326\225\355\350\370\371\230\005_\346\363t\270M\343\3516\006\237L\0271G\3614\335\246\001\346\333<\007\032\247\321\272\315\306\321\270\017\324(\006\354=\310|Z\307\363>\355\361ku%\211\177\210E\255\240\276\2204\202U\225e\033\022\023"
+	.ascii	"=1\244(\260\211q\016\037\270\3440\317\320`V\346\006@\036\030"
+	.ascii	"Q\256\200H\b\235\363\016\355\264Ps\030u\006\222\324\3005\357"
+	.ascii	"[iu\314\301\001"
+	.text
+	.section	.gnu.lto_setBoardName.part.0.32.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\215\013"
+	.string	"6\326OB0M\225\016\300b\361\017\037\f\203\264&\264|\315\204\251zB\211\257y`\215\251\336{\361\266\037c\253\030\f\274Yu\001m\244\017UM\031\231\231>&\n\213\352\f,\212\215Cx\034\r\211d\023\271S\n="
+	.string	":"
+	.string	";"
+	.string	"\337\340\013f\224\262\355\013\206d\361\243\005\324)D`\020S\261;v\237Z\341\342Uj\242/O\252\322\365\260WR\220(q\002\204\352\301\345\344\332Efw\315A\270\347m\003\260\035b?@\253]T\013\026+a\212\310`\373\366a#;b\223\354\210U~\034\375%\352\030\327A\312*\355s\270\213\364\227\350\032\273,W\210\335\021\344\323\037\334\247\307sl\237\3347\266O;:\301\030\222\362\317v}\207{\b)(vM\261\313>\377\302\247\017\204\362\247O?L\020\222?\371\260s&4\314V\314\026hIj\313\252]\333\335\265\262lK\313\217\377g\005\203$\234\2177`\003z\237\200\020\007\224a\215\345\353\200<\0046\240\367\025\3504\235\016\344\361>\235\006\f;\213\207?\003\034\260C\360}`\027\271\266\312\232\310_\334\2446PgL\252\300\252\332\262-\221\215@\255>l\022"
+	.ascii	"=1\244(\260\211q\016\037\270\3440\317\320`V\346\006@\036\030"
+	.ascii	"Q\256\200H\b\235\363\016\355\264Ps\030u\006\222\324\3005\357"
+	.ascii	"\277\266\214\001"
+	.text
+	.section	.gnu.lto_persistBoardInformation.part.0.36.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\323\001\365\017"
+	.string	"V\333eH\340\262(\035`\275\344\241\224\t\033X\277\221Y\335\263\252*5\216\360\245q]\377\025Bp\fA2-\231\361\177=]\340,Y\207\245\352\334\237,\004\004\023f\214\024Q\326\331\311f(\007\030\244I\222\362{\213d\023\271S\nJ"
+	.string	"U"
+	.string	"W"
+	.ascii	"\265\335\025\251ok\331\";\306\026}\376\204OJ-\031\333>)\305\330"
+	.ascii	"\365\033m\366\032\034\r,v\2737\360SE\334u\225\236\313\227\262"
+	.ascii	"\361u\275\355&@zj|\340F\017\227$\367DL\273\353\320\207{\3366"
+	.ascii	"\003\333&[6\b\267=\324\223C\003\364\223A_Ro\254\336\275U\033"
+	.ascii	"\333\322\0271\22112\263;\013\032\2624\363\006\216\224Y\3212\313"
+	.ascii	"\024\333\200\301\303\201\330\241\330\355\205[\202\024W\001c\026"
+	.ascii	"\201\033\255\203\213\t\033%|{\311\367\031z\200\357S\355\353\250"
+	.ascii	"\253=\267c\230\353x\216\271(\237\r\341:\024\003>\273\253\300"
+	.ascii	"\357\361\\\n\353\373\004@BW\013\002\223A\036I\001<\302\022m\307"
+	.ascii	"wP\2470\324\021\342x\016\024\202Q\013!<#\351=\365]\3475T\013"
+	.ascii	"|va3N\203\202\3521T0\216\023\375\021\237va\311\313>\017\334?"
+	.ascii	"\276\027\013\3622\007\236@\222\3202\300!I\\aI\245\250\254Nb\004"
+	.ascii	"0\\\001YR'\025\030\256^@R\001\213-\250\025XA\024W\240\350\336"
+	.ascii	"\252\r\211\374]\337\225\203\332\004\323\230\365\336\356\256\352"
+	.ascii	"\215\355\021\027\343l\346\305j\b\227H\333\301\003\225\034\036"
+	.ascii	"\240\237\230\276\374\007- \220\"JT\363\f\234\227\2250\031\016"
+	.ascii	"L\242\231lH*2\3101\206\2345Y&e\340\310e\322@\222\321\032B\342"
+	.ascii	"`\037$#\343\3455#?\311\215\2707k ,\315\275\020$\257#\374\030"
+	.ascii	"\007\016\2726\235|\331]{\027\313\022\220\304U\361r\0015ru\004"
+	.ascii	"\233\303m\325s\251\017/1E\301\375\327\2321"
+	.text
+	.section	.gnu.lto_setSignature.part.0.37.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"5\013"
+	.string	"\306UNA kL:\270\343\306`\310\004\002K\200\377\337[\013\263B\310\021;\311\252\004\346{[.\251m\305/\n\302\202\354P\033\024\321\302\027\200*\001\204\266\rf\264\006\005\262e\320\225~G\331A6\221;\245;"
+	.string	"9"
+	.string	";"
+	.string	"\276`H*\333\276`J\026?\302Rom(P\373\260;z\237\332\340\342Ur\242/Q+\002\327\317^\341\340\241e\263\260BpI9\027\221\331]G\022\334\363\2669lo\330\267\004\267\020\273`fp`\373\366g$[b\227l\211U~$]6\272\030\367\200\312*\355Cx\204\322e\243O\354\272*`\330\0355>\235\021\371\364x\213\3563r\212\356\323\376\203\032R,\n\253\f\354\323\006\200~\314\247\275&\300\217]\302'T\001\3335\035\365\351\213\272\317U\207\223\355\202\002\223\274I}Y\271s\273\273V\227mi\371\361\377\254\200\230\260vS\001\2340\004\322|!\236\016\021\347\223\360\306\002v>\217\007H\250\001?\274M\307\373<\032"
+	.string	"\336&\374x\026\f\203\0018\241\007\002\301\320\223\234[u\371\263S\344/vR\r\2503&=YU_\266'\023\002\020"
+	.ascii	"=1\bQ\324\033C$\021g\263_\220\200<0\242\\\001\221\020:\347\035"
+	.ascii	"\332i\241\3460\352\f$\251\201k\336\177m\031\003"
+	.text
+	.section	.gnu.lto_persistSignature.part.0.39.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`.\001\275\r"
+	.string	"F\330YE"
+	.string	"\257(\0350\021h\340GZ\240J\226x\374\273\357\201s\234\315\250%\237v\030\217\357\276\326C\274[\325\366\321Z\004\n\3038\036X|\264\250\255\252\252\252\200~\330\347\241y\244\335(x\367\315\341l%\233\310\235RA"
+	.string	"I"
+	.string	"H"
+	.ascii	"6\210\255}~\204? S\210m\177@ \016/\246\254^Rc\301\304kW\334>"
+	.ascii	"\025"
+	.string	"\345\341Ub\241/U\254\323\365\255#x\001S2\343be\270\354\034\003\300\355\2567\032\356y\333\rls\366Q\002\266\245\237%\330\300\031\331]\2155K2Y\200\220!.&\203\\\352B\005\314\345\241\005\211\327R\020\025\224x\313\207\301\002b\212H\207\b\231\020\026? \373\334\\@\366)\355\253\310\313\212?\316\342y\032_\273\253I\277e\262\265\026\311\220\304p\221\322\223\177Rf\217\276\202t\200fw\031\3701WQ\232`\366\251\265\274\254\300H\021\301W9\213\206\267\200f\027\005\363\023\035\276\212=@y\325\247?!\373d\215.31\035Pr\224zb\305\216\255\232\004\206\340!q\020p\347\36126J\016D_\310{\260u\031\333F)\244\261u\237\307\3461`\217c\364m\022<\357\333\264c\253&~\353\035\371\207\331\025\203\232Ci\312\252zb\233\343\342\260\032A\261\372\301\001\244\035\352\344U\001\037"
+	.string	"`\340\374X\371~\270\273\0335n!&\314\314.*\210\254\366\2742 \247Ui\206]\320p"
+	.ascii	"Q0\314\025.\330\004B\347\211Tq>#~\306\315s\013\206Me\261[@H0"
+	.ascii	"\303\341\fUs.u\206\227\324\0245\357\277\266\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\211\001=\b"
+	.string	"\242\013+/\2009\351\034\032\370\314U4\322\235\271\216\370\345\306\237\270\007s.\242]\314X\"\332\002}b\343\021[\333D\255\251\375\217\270\021\373m[)e\n\206\231\230\215&\343D\013S\001\240\366\254\310\302\205,d\316\276\007\3276\251t\260\266\017\215T\263M\214\244\310\304l4\031\307\326\276\335XE[\332h8%/w\357\021\303\241\205O\024.\231\376H\217X\016Ix\201\"\234\340\340\016j\360\247\225Fa\213\252,\334\0074\372E\231"
+	.ascii	"\364IW\300\344\022D\253\254\2653\342B\342,\333S\244\250\211\n"
+	.ascii	"\373vF\225\216\030c|nQ\333*\021( \360\002\261\241\355\212\200"
+	.ascii	"Kp\213\220\346A\032\324\312e\2143\314G\202\366\005\325\313XK"
+	.ascii	"b\2525\375N\215\301}h\367s?\347s|\356\347~N\277\357\b[\343Px"
+	.ascii	"\006\342\030=\225n\324@\313!\204\201\027\235\243D\326\350\035"
+	.ascii	"\304T\344\006\f]I\f\267\006\033\033\313"
+	.text
+	.section	.gnu.lto_.refs.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375 \243%\003"
+	.string	"\222\207\022\026\260\2515\f\3030\f\303RkF\266f\204\354&[\356-SJ\001\345\022ca.)LO \016\006S\251@p`oZ\256\300d\266\317\375\371\001$e\261\344:\3379\207|\310qF\001"
+	.string	"\022\363\214\230\307\306\274\324\256\032\001\t"
+	.ascii	"@\036\034\003M\244\304l\3410C\231\313V\366v6&\327\351\004"
+	.text
+	.section	.gnu.lto_.decls.31329c06b18d919c,"e",@progbits
+	.string	"(\265/\375`\224\023\345W"
+	.ascii	"Z\213\304\036R@\022&\r\007\372\307\324\360\374\006=r\2372\326"
+	.ascii	"\177\346 \312P\242Y\377\031J~\217\262\375V\241\344\210Y\330\345"
+	.ascii	"\226"
+	.string	"13\202\024v\367\316\n\266o\351\032\211h\212\273\373O\314\352\350\2568\252\371+\272\241\036\273k\002\332s\232<\021\332\226\244\333J\231\002\222\001\325\001\341\001i\377b\331*\301*l^9p\272hA_-)\025\031&$\234\246+\250\275=\373wl\311ve\241[\331\335#\204_^H7N\367J\320\327l\307\307l\256\215\243\246\301B\203\020N\003 A\335\252\345\361\361\354\216\317\200\335\361\371`\240~ly|\373\265<,\264g\303V\034a\232&i\3548=\013\365\013\366\021m\275\342\001\250\337\036\337\336m\217\357?\325\001\264\345\221\322\323\253\016\316\372\244\203\212\323\177\243\374\233\265Z\273\362\226K\316\006\353\345\252\263J#bR8](\273\365]\367\311\037Xq\336QJku\367\256\0218\273\221\273\342\234\351F\342\354\236\330=\221:y\032\t\363\245g\365\353\362\370\324\335\361\265\235\200B\347\347\rT"
+	.string	"\376\f\324\013KA\304\317\026\350\034`\363\363"
+	.string	"{\302\232\360/\t5?\013Q\2248\241\301\277<\"4\360\243\302\377\036B@\341_\023 \364\374~\246@'\307\346\2039\365\347\022\351\317/\024\030\241\367\363\007\377\246\353\301\333\376u\261\035l\213\315"
+	.string	"\003\270\377eL\274\347g\233\177/\370\367\304\277\"\376\375\371\227\201\177{\376\315\3717\370\357\002\377*\360o\002\377\242\370\227\200\177K\374K\342\337\336\277#\376\325\371W\370\357\357_\337\377/\377\315\3747\373\257\345\377\335\3774\377\321\374\267\373_\367\237\314\177!\376\207\371O\367\177\356?\020\377\343\376G\371\277\376W\340\277\332\177"
+	.ascii	"\356\356\356\356~\036\332\317T\377\215\032\307\234V6\345,W\344"
+	.ascii	"q\3315\325\264\313.g\223N+\373\330J\244\224\252t6-\327\234M9"
+	.ascii	"\313.d\323R9\325\264\275:{\271\\Y\247\216I\335\205\024v\367\322"
+	.ascii	"ju\fv#\231}lc\035=E\247\243\177\364F\233\254T\335\335}\004\213"
+	.ascii	"{:\201k\262\243\313+\247\214\244\356\270\326\021\301q\217kw\337"
+	.ascii	"\350\344q\273\223Vfw\322\311B\323\271n7\230-l%r)\371t\006\223"
+	.ascii	"\222\316\033}%\265M\313\256\2473\210\354\253\313\252\223\353"
+	.ascii	"q\255:n\212\251v\035W\214\260kHs\211\323-\322\244\003\024\247"
+	.ascii	"sX\240Qd\320|\241\213f\355VJ\037SH\313QV\327\335T!\334\201\214"
+	.ascii	"Rf\313\031; \020Qnd\234\232!\241&\207@s\204l\210:^\216'c\254"
+	.ascii	"p"
+	.string	"\032db\032\342,\203\262N7r\313j\305\354\230\205^m\2058\316M\331\r\250Z\230\372\031\366jA\234\335`\331p\006\226\005\272Y6mW\206\242\244\205\325L\246\212\177\351\346\262\234r\330a\325\002\222\331)\341\001F\356\227\205\345\t\306\351\312\361~Y \276r\353%\250\\\271tO\334\354\236\350\235\021Ar\371\322o\325\017o\251\035\017JV\214\312N\331h\263\002'U\350\272\327C\360\266Y6M\254\312\333\226\355\331F\233\351\025\025\272\356\356\262q\353\303\302\255\333B\367m\243_.\333\366]\273\225\020\374Ao\273\266[nx\335\310)V\335\375\345\372\267\353\177`\305\276\255\327N1\221\354\376\001\265\323f\026\326\243\256{M\221\"\005\211\024)l\270\204\201E\005S^ty|\025\274\240~\267\374ke\325v\212PL\007(T\234.[\320\267\007!Z\020:N\013\240\241rorbi\340Tv\322"
+	.string	"C\231\221:\323\244\246\252\215\210\022Ny\177\346\343%\314\244\307%\352\251\344\224\311\272\301\222\036_8e%K\307\204\004\023\206\f\257\207g\227$\247\214\344\234\344\007\002\313~"
+	.ascii	"\231\342#?\360\027\346C\017\2534\365i\231Z\244\bCu\320k7\\f["
+	.ascii	"A\270\206\f\341\035j\222V\324'()w;\fa\303\364\006\367\\\242\n"
+	.ascii	"\021\302P\300n/g\224\264\352J\b\241\312r\006\t\302\353\3761g"
+	.ascii	"%\264\n\003\004j\207JE\305@\324\236\300\213\017\037\037\2204"
+	.ascii	"\037l@\350xgKU\3528}zt\362\224\223\241\244\244\030\352\214\260"
+	.ascii	"\351\243\357\350\324\363\320z\360\217\036\f\345\303\007C\031"
+	.ascii	"\261\351rEF\t\005<\222\344\271\264\252\347I\251^^\004@\225\264"
+	.ascii	"\260\226\nt\251\254\334\256\315\304\342\tsU\261\203m\330\301"
+	.ascii	"ONN\374\364\203\222\026\226OjJ\024\017\036\347'\036O\274\254"
+	.ascii	"\ra\363dsc\343\364<'\365\274V\231\270\211\211\227\230L^\352\342"
+	.ascii	"CI\013+u\362lrC\214z\336\242\342`\0358x)\307s\360\222z\354>\256"
+	.ascii	"\315\264O\034j\034\232$1\254t^Z\271\237[\330\027!\226\016\207"
+	.ascii	"\211\235\222\017T\324\363\325\032\024\270L\307\302\350\232\311"
+	.ascii	"T\221\344\244$\333"
+	.string	"\3609\231\230\335d\372\234\217\214<+\241\254d\033\333\314\356f\363\344\304\224\264\352\272\331\364\341\255nXON\331\306\301\004\333D\257\355\252H\030\247\347(\365\234T\177\376}\3355\364\326f&\203\337\336\256\317/\\\336\242\340\025\020\327\035U5FMb\005\331\343\006\264O\367\221\271\354\232:\352,\273\220\275\364\2126\351,\327\226\032\321]T\275\\\235\307\324y\344^[9\325\324J\347\261\306rmf\257\316\303\031-\b\031\221B\260\271\214\037\"bQ\321x\0044t\001i\306\020\261\b\250x\204\004$b\306\f$\"\321\210\370{\301\250(\303hD\374\305\020\032\316Hc\2501D,\032\217~7\306\341\213#\027<DA\"\235\234\021GEG\305a\r\002^\004\207G;:!\030\207G$\002p\340\307X\024\252\361\323\302XD,\032\340CE\305!qH\244>\002\t\032\220\200\005\f?\032C\343Q\f/"
+	.ascii	"0\032a\fe(:\362}\200\031FF-`\364.\343\207\250\206\210\033\325"
+	.ascii	"\030\026\201\214FFE \233#\030DE1\210F\032\b\201.\270(\016\t\305"
+	.ascii	"@\"\n\321\270\031\322\020\022\001h\034\276 \032\025\031\205h"
+	.ascii	"\024\215b\020]\354\030a\2600\022\213\220~\017\n\322\300\200\022"
+	.ascii	"D\340@\035\3721\212A,\202\341BQ\310\250\005\240\241\030@\304"
+	.ascii	"\"!\032@C\305#\240\037\001\214\303\027\303\"\222Q\210HTt\024"
+	.ascii	",\n\311\030J\217\200\263\235=5$p^\234j\321\302k\300\234N\302"
+	.ascii	")\215\255\261Z\026\327\025T-\215\210X\324\210\231\025\242H\234"
+	.ascii	"j`\264\236\337\231\272\247(Y\030\213\r\2301$a\224\351\232\020"
+	.ascii	".&N\307\306\330\fx\374\2415\235|\314\370\312\030\331\220\273"
+	.ascii	"+\\\206sV\025\375bf\rf%A\313\201\323\223m\364?N\322\027\261^"
+	.ascii	"\222\025~\002\306%a\313Qe\013\233\326\030\030*P-\202X\002\"\306"
+	.ascii	"K>\247%\314\252)6R\350\rU\317\260\273\032\03644\347\300\316\320"
+	.ascii	"\032;\263.n\234\362\027\363P\363\024\213FW\216j\025\251\342\224"
+	.ascii	"\273\330\353k\n\307\030\247s\314\2328\034n\224\341\342\276\261"
+	.ascii	"\023#\302E\312\246\331\300}\255A\243\360V\317\314ify\266:_\335"
+	.ascii	"\212\267xdv\355\246\363\030\206\305\331\022\016J]/\233>\3022"
+	.ascii	"W\350j\300:o\235\241<\260\202\231\340l5\031\323\304)?\371\n\021"
+	.ascii	"\363\265\314b\255#\001\201\262\250\261@\205\2243\"\"\"\"\"I\222"
+	.ascii	"\244\003"
+	.string	"1\005\204(\006\255\264\016\021\020%\303j\210D\222$\311p\266\340@\251V\376\335g\373\251\253c<8.\352G~c\324=\370\215\265\374c\331I\240\026$\254<_\031\031\306H\272\335Y\332\213\330\033O\221\3713\316\016WN\361K=)\273\3678Ow\237w\260\267\300\250p\0168\327\270S\232\027\256\266\237\230\007\202\r\335\244P\323XGC\300'\343m\321\021\276C\207c\340\356"
+	.string	"z\003`\002Jv\362\024\024\227\022\351\321  \241=C\237N\352=Gbm\375\004\336\305%\247\263\030\361a\027\336\377\343\355\351]\300\2027\300\370j7\016J]#N\t=\224\323\021a\222\221\224c\351\361@O'\265\337\351SL\247k)+\224\253\205W\322\205\n\004\375M\240\252\366&`6t\263\220\0357\030\303\275\334\026\300\211Z0="
+	.string	"zY:\367\356\n\017\206\222O\230\023"
+	.string	"\001\350ES\"2\221o\b\234\f\361\260X\347\272\323\003\342\212\f\3005\022JX\2453\253o\311.\364X\t@\202]\037\325\362\006M\260\374\233Z\3352\271\227\252l\177\304\227\271\211u8\3152\016:\322\323\330\022]\367f2(F`_Y\246\346]\030\353\213\235\326\330\036P\363.L\316\216\2126\006u\200\232\343&S:{#\200\nPi\202#!\225*\240%\013\237\325\357\366\232\261\367xD#O\215\2760\256\333\365\017@\344A\221\274\246\351\361\227\336t,3}\215xN1E\005\353\227\3018(!\024\001i\240,9\262|\n\200w\226t\370\221/Q\372\001\222/\352\252\203\362Z\nZsO\206\265\374d\035 \203\365\321\212\310\342\003\036Q\316!\302JA\272^\020\366i\345\242\356\261Q]\202v@\3604<\036\3228\013\344\234+"
+	.string	"\"\251K\337\205\307\353\237\261\241S1\301\326\f\001\337\215\303\364\200\242\363\3008\020\022\237\237\277\031?\203\2724C\f\220*\316\366\037=\334\331\244\217\204\373\265\200;"
+	.string	"\366\021\274\265\235\004\211\302h\177\315\304\325/4\364@s\321L\"H\342"
+	.string	"\204\032!}\232\231\303"
+	.ascii	"\214q\030\321\023J\300<\257\366\345p2\2465\022x\013\353\361\002"
+	.ascii	"\nYPE\241\f\255\354h*\233\226\023O\023\006\360\2544\225\360W"
+	.ascii	"\360A\005\017\340\273I\224\022\371OU\3644\270\035(\207\023\177"
+	.ascii	"T\323\327\227b\022(\332\376\276\336t\374\256-\206f\301\003n\211"
+	.ascii	"\223g\375'v\037Z\342\361\020w$a\2710\371!\226?\324\362%\261\303"
+	.ascii	"\211\216}\265!8\336\rz!\013\267O\256\037\006\030q>o<75\023\357"
+	.ascii	"\213\370t\306\267\013V\256\236,pR\203\327\007><\366\216s\213"
+	.ascii	"\3660\200I\263\036\334n\357}\331Q\300\017=\006\030\320\035\224"
+	.ascii	"\324\256hO\177\307n\303\007+\003oYVl\267\230'\256\352\017\332"
+	.ascii	"ap\267\334;\273\307\347\364j~^x9\304\365\235g\344\025v\363\207"
+	.ascii	"\211P\227\020=\305<\367\177\3065\301\355\306\237\352W\356\264"
+	.ascii	"\342\321sS\\=;D\273\350\002\307\252m\276\205\376\252"
+	.text
+	.section	.gnu.lto_.symtab.31329c06b18d919c,"e",@progbits
+	.string	"initBoardInformation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"boardConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.31329c06b18d919c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
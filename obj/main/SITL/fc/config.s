@@ -0,0 +1,2255 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`U\001\345\n"
+	.string	"\204\020I\002"
+	.string	"\""
+	.string	"\367\207\374\251\r\f\002"
+	.string	"\002\001"
+	.string	"\002\003\002\004\002\003\001\240\342\234\212\n\003\006\321\211\300\200\002\002\007\350\223\272\372\005\b\264\215\316\215\n\002\002\004\002\005\n\262\374\202\245\005"
+	.string	"\013\313\347\306\245\b:\002\004\002\006"
+	.string	"\007\b\002\t\005\002\n\002\013\004\001\002\002\002\016\273\203\325\342\t\017\266\306\237FR\002"
+	.string	"\002\r\002\016\002\r"
+	.string	"\002\017\020\002\021\002\022\002\023\024\025\026\027\270\211\201\331\n\002\002\027\002\027\030\031\252\374\357\352\r"
+	.string	"\032\373\323\226\350\001"
+	.string	"\033\276\275\245\370\013"
+	.string	"\034\346\363\305\361\007"
+	.string	"\035\217\375\217h"
+	.string	"\036\312\302\204\263\006"
+	.string	"\037\232\275\315,"
+	.string	" \236\376\250\313\b!\350\300\306\254\005\"\231\201\201\232\001\004#\365\336\333\371\r\b\002\030\002\024\031\002\031$\307\276\344\257\003"
+	.string	"%\261\340\353\213\002&\352\263\360\321\b'(\230\225\332\336\004)\341\240\310\330\001*+\240\301\276\347\017,\260\314\343\322\006-.\240\342\234\212\n"
+	.ascii	"& p\202\203C\354E\371F{?\2035\266\266\245\225A\004>\035\031\303"
+	.ascii	"\225\032\260\301\263D\206}\223\302\003\206\001\262\023\330\342"
+	.ascii	">.6\223\001y\356\026\363\035\367\322\264\004a#`\360\002\341\334"
+	.ascii	"Uh\332\314;[\326\035\331\022\250\212-\271\032\201\277\251\340"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\003"
+	.string	"\"\204\n\013\260x9\214\341\377\037(KR\006\316k\327\232\025\365\323\2246\332!\037go\230\005\234\213\362\311\036\0051\207)\314`E\334\b\035"
+	.string	"4I\340^8\224\007\207*\215=\365\034\213H\323\200#\304\005A\2031X\b\332$\006Bz^\350\212"
+	.string	"n"
+	.ascii	"\334\313I\"\246\001\251tU\b\"\327\301S\376\254\232@\211\3733"
+	.ascii	"@9J40\004"
+	.text
+	.section	.gnu.lto_.inline.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\347\004\335\r"
+	.string	"R\01777 \221\222\016\360\344\251\272 \224\215\032\266P4\020/\001\242\f[\230\n\335n(_\366\n0Y,\244\231\001!X\200\004@X\253\365\374\\c\2006\023\376\321~\333\233\244C\2402\366\360c\356p\312Z\255\226\243\262\222!\213\3007s\331"
+	.ascii	")\335\260m\333\004\266\330\310^]n?\t\337\223\340Hh1\336\230\300"
+	.ascii	"p\002fXP\370\227\320a\005\236|\260\314>#\224\\\007\257\266\235"
+	.ascii	"\r\022\326\026`\322k\265\365<J!L\333\317\005\357\211r\223k\205"
+	.ascii	",\231\020\032\234Ye\r\215\244\205\036\017`p\237\312\016\021\r"
+	.ascii	"\332\343\300O\025\226\240\344\214\374r\350\242-\353Q\240\217"
+	.ascii	"\347\204\330\3456\367\373C\bz\233\\\233\\\370\213\022\307\016"
+	.ascii	"\333\226{\212\214\265\025\300\177\252Li;z\202;1\001]\250\021"
+	.ascii	"2\"\t\306&\245\2351P\2421EY\036\022\300\3430\212b\b\224H@\244"
+	.ascii	"\220(\220\260\002J\n\2624\314\001f\340\344ie\314.\037\225\212"
+	.ascii	"\370\326\307I\021y\007\025k\210\353\310\323\367pT\330(\316(\305"
+	.ascii	"\302 *\342Q\226\347D91\325k\034hh\330\347\336\246\207\351\203"
+	.ascii	"}\3345\312S\332\301\f\311\323\033\323l\361\361\235\2228RN!\374"
+	.ascii	"t\251M\345\363R\025\342\266\353`\f\"\307\025\"~\034\347\2464"
+	.ascii	"NlY\250z\263\266\346\024\276\023r\033\360h\311\f\034)$(\022\335"
+	.ascii	"\243L'\215I\344\203o[)N\235\255\3418\230[\323VM\030\006;\355"
+	.ascii	"\365\360~%\300\204\013\312\271\367~*\206\240\343\265\361\276"
+	.ascii	"g\033\213\357\226\357\241\306\360\005_\004R\305?\314\257V@\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\260\003\305\f"
+	.string	"R\317..`m\322\03009\004\tq\264\315*\370Q\304MA\360~\032l\033+\b\202`\223\260"
+	.string	"\360o\321v\243su\322no\220[\357\266\211L)\352\202\2666\273X\n\332\341\334\231\345\231uG\230c\321o4A5\b\007\031\231\272\316}o\320P\240b\324\031&\340<\360\306k|+q\233\213f\032L\344G\276\323\343\243c\222\007\001\201\244\320\207\364i\036\237\026:d\ne\306\261\3162M\323\244T\245\362\227\213\246i\224\224\256\265km\207u\247\226"
+	.ascii	"\025@+J\321\345\263S\266g\275g\335N\334\030g<\270\205\020\021"
+	.ascii	"7\305\023\265%\353It\272\3214\255$W\322\252T\001UEj\250\321\301"
+	.ascii	"+M\212\222Jsp\002\021SF\036\021\240\224\223\322(V&M1k9\004\312"
+	.ascii	"@*}\003\316'\352S\331\360\241l\243o\346\324\035\316\251\017\241"
+	.ascii	"\373.\310\314\343\025\374\217\223\017\237\rL8\316+\372\322\321"
+	.ascii	"\340Q\327\211\f\\\211\341\225\365\203t|\263H\326cQ\\\204\347"
+	.ascii	"J\335\232g\007\342\006\002E\316U\225\362\214\370@\266U\260\202"
+	.ascii	"\237H\253\275\030\330\265\027\205|\005\311\200L\307.\2003Ub\250"
+	.ascii	"\206!\013\210Zn*9\354\366\244\372\275q4M\031\371\323&\210@M\331"
+	.ascii	"\\)\222\"\351\346vR+\371%gBN\260\007\373\003\027Q\013\272\267"
+	.ascii	"\204\357Gls\325\206\261_p3\325\312\235J\305\243-2S`\210z\030"
+	.ascii	"V\223}\352Y0\333\217\002\253q\326\220\357\001"
+	.text
+	.section	.gnu.lto_.pureconst.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 G\025\002"
+	.string	"r\204\017\032\240\3250\006\377s\376\224\002\004"
+	.string	"\300\013p\356m\333\266m\327\270\234\267S&\003\036\300/\005\226\205\312)or\311#\207\374q\307\033g|qE\002\342\340p\303+<\302\033\334\0223\013\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\315\006"
+	.string	"\002\311\033%\200\307\225\003+\203\031\230\201\031\230\201\271#$\"DDDDD$Y\327\332\377\366\367\271=\332}\266\221\226d\n\252\244\331\353y\275\260\303\260h3\212\271h\261\"\305\211\022#B\242\367\036V\216\316zZ\273\212zR;\205g\302\016\341y\2603\370i\0248\202\335\264\033x\n\354\002F0\026"
+	.ascii	"\317I\361,\341\244\035\364\204v\233\017:\\C1 \260\002\232*\363"
+	.ascii	"I\272D\033\360\031\245\035\312G\006\34671\260\004\356<\331\214"
+	.ascii	"\204\217f\017\274a\254\201'8\301\020,\301A0E\320%\342\314\260"
+	.ascii	"\213\301\2276\214\313\236#\250\200\250\373\217\312\221\225\374"
+	.ascii	"\033\322sA\"\"\001\332\003>q\234\331Q\307\327\035`\315\300\342"
+	.ascii	"'0\240\024\247\340\306\260;\302\036K\300\305\034\002"
+	.text
+	.section	.gnu.lto_.lto.eef8e8b12ba3aac1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.120.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \222E\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\327\221\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\"\257 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pilotConfig.122.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\340\030"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200\020}{\274\001y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\243\f\240\b"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.126.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007b"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\336\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\020\222\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.128.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 Qe\002"
+	.string	"\024\004>"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001\006\035\001"
+	.string	"\005\001'\002\206\b\177\005\001?\202\210\200\320\001}{\273\001y\273\001w\273\001u\276\001s\273\001q\275\001o\274\001m\273\001k\273\001i\273\001"
+	.string	"\005SITL"
+	.string	"\003"
+	.string	")\"\300\274\177"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.129.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \357\265\006"
+	.string	"\222\f/5Pm\222\016\244\034\021\252|\242n\3266\376U\225\335B&\265\374W\273 7\264\333\321\206\3369\025_<\226\310\314\234\313\254\274\225\260\301\021x\031\255\265O\266L\001S\233\206\016\307SQ\217\342<Og\301\341Q\326\347m\004\256\036\030\254\007QU\326\323lX]iG\2009\321\377\251H\004@fE\302\r\251&q=:=\001\302f\235.\b\323\t]\200\206a\313o\"t\033\337K\272\322\217\243\313h'\003(\231\243\026\2264\231H>\376\320k>@\b}u\353\030a4J,FV2\267\3478z\025\257[\220^R2T2\022E1\243\220\231cF\272\350\256\277\301_\360c\004\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.131.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \357\265\006"
+	.string	"\222\f/5@o\222\016\230N$\371\231\217\tp/\246\244#\035"
+	.string	",\376mw\271\220\333\330\354YG\313i\201\027Ta\212\242\270V\340\360\246\030\2362\300\f[k\237l\231\002S\233\206\016\307SQ\217\342<Og\301\341Q\326\347m\004\256\036\030\254\007QU\326\323hX]iG\2009\321\377\351H\004@fE\302\r\251\210\304\365\350\364\004\b\233u\272 L't\001\"\030n\257\211\320m|/\351J?\216.\243\2022\260e\216\266\226<\231L>\376\320k>@\b}U\353\030a4R,HX2\265\3478z\025\257[\220^V2J2\022E1\243\220\231cF\272\350\256\277\301_\360c\004\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.132.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \375\005\007"
+	.string	"r\21516@o\222\016"
+	.string	"\302[\310\211\255.~\234B\305$\301\213\001\222\337\307;\003zC\335\036\315 9-\360\202*LQ\024\327\302\013\nb\303\211M>\310l\023K\266L\001W\034\007O\347cU\260\352\300\217\207\341\001V\027\br\n\266 \032.\030aY\027\334lY]iw\220\271\321\017\352\211\004@\214\026\n\327\244\333\304\005\351\233\"\224\325\372n\210\352K\027P\222\345\351\267Q:\216o&\272\322\237\247\323\230X\fZb\3048\231\342\312S\t\371E\277\271\"\035\021\215\345\366\221A\241\304\\\244\300\304\270A\201\022P}\331\001\252\317y\024kb\267$\315\274l\270h\244\212\246f!\306xj$\215\356\372'\374\b\177G\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_resetConfigs.133.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \320\205\005"
+	.string	"\222J&+pm:\240{\375Hs\331\340j\375EKh\340\205a=\357O\370<1\354\227!n\315\377]\\]\270\335\201\004\3173Q\313-S\247V\003\273\262J'\275f\206-\034\223j\220i\025^\037\fmFj\325f\025\3662\250\340\214\025\356\316\362\227P\344z\227\"\315\3301\367\207\234\344\316\277\200\356\3563\3703aSB\214\2721)T\217\001\022\350\377V\337~\323\206\237^\361b\021O\335=\331\263\333\312\355\273\241\035x\037\267R\220\350\356K\357\313\354y\377\033\376\037\376O\002\007"
+	.ascii	"3\003n:\203*\\G\227\361/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_activateConfig.134.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\237\002\325\023"
+	.string	"VbzH\300\324M:\251\363\206\024\203\274\235\335\026<U\341\026\373\260\232\035j\217I\304\210\001\367\376\264\232\334^\"\367\333\266\207\355\213\036\344e\316\331\314\002\200\252N\006\201\225\340\231\r>\245\311\340/\377\357@L\221\232%\233H\231R]"
+	.string	"]"
+	.string	"q"
+	.string	"\240\372\213\352\375\324\272\352\253\264J"
+	.string	"A\3404\347\210\252%\263\027\233\216l\337Gz\322\316u^\365L\035\367\234\255s\032\266\300$c\316\251c\357\330\255\307\267,\355#\327\r\315UP\212\332R\2229g\270B\227W\351\377v"
+	.string	"\266\036\331u\365`\316i\265\365\370\334{\333\005l;\260WA5\252\347\314\341;\033)\373\334\303\237\251"
+	.string	"\272k\277`\3646\257\360\254\314\272\273\257Q\315\016\003\277\272,5\0354\313|\t\306\232\223g\201\257\364\032\037\374\242G\323\304\364\266\030\370\370m\371\360\224\340fZe\353h\272A\366\277\271@\366\252S\242\032\005T\237D5k\245^E5\270\352\030\022\206\214!g\334F\300G[\336$RT\217G\346\236 \364 \240\337\332\021$8}\253;x\240\230i\325\204\246\026\023\334"
+	.string	"\265)T\370\355&\273[\217\2662\237\254\237\343M8~\221/\270\270\344n"
+	.string	"\311\224\022\324.*\3518p>\336\220\r\303\2312|D\206\346\234\fn\234\247a\303\313\013\370x\262Oz$\261BJ\004\324\356D\312\242\354\362\002\236qy\200\331\2049320\020*~\271d`15\261W\370\212\tk`\035h\302\327\rN\350\022\340\230\r\314M\230\023\213\335\204-\335\354\337\\\240\026\023\275\331\322\234@\301e\255-U\310\237\225\020+\363jY,\016%\203\212\254\326E\204\213\013.\213\320\207\004\271\020I\324B\032\351m\322\b|\214\333\300\305\323\221\324\001\365\177\310\027>\376\024@\250aDe\214S\310hFQK\324\032p\002\241\232+\017\020H\311H\223\fk]\257\343\372\271?\027\206I\304\264\016QVY\231\337\226\211\314U\302d\203= S\351Q\rh"
+	.ascii	"A<>\253\\Qv\002ZY;\215\241\360\023ES:l\343\2730pd\371\n\214\344"
+	.ascii	"\020\035'\204\373\034\026\373\3324Gi\021\307\b\241\344\034\334"
+	.ascii	"G\b\006XS\r\362\272\221\304\344KE\021\320\0309\t\361W\260\350"
+	.ascii	"\200\326\024\302\034w\361?\301\240\376\005]j"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.135.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`f#\265\211"
+	.ascii	"Z\323l/J \316\342\031\003CN\273%^4\026\\\027\rP \230M\003 8}"
+	.ascii	"%\027\226\363\366\001\220S|\237\350Y)UFn4O"
+	.string	"2\377\017\025d78\210\315\350\357\213\325\316\241i^\3219B\241\2033\214\277\0069Y\271eJ)\005\353\002\256\002\353\002I#\210X\270\371\366\222\226W\\K\2731p\214Q\313NN\357\374\360\326`T\367\374\370\220\364\371\t\"\001\241\261\360w\021|dn9\356:\316\351$]\022\004luO\313Nr\b-\307\037U\363\310#\264\034\017y\025B\333~\032\256\251\234\023\327U\334\266B\202\021V\334\333\325\300\023?\246e'\215\326nk7\267\337LX_$qo\021+\264\302\266\307\367\215;\321I.\261\354$\3075\020\333\311eo`;\311\314.\263\231\216\233\276J\251\026!s\217\357\3736\237\314\350\347\347\207/\013Sa\360\367\032\327,B\3516{a>\336\343.\254\307\\x\013\3471\036\337\261\026\266\343,\214\205\353\230\216\257\360\034\3131\225\255p\025\216\223\021\003F\024\324\323\013\027-\234X4\255"
+	.string	"@\005Ss)\005\212\023&\224\222\220J\034\221\030!\"\204\021\210\017\036\212\210:\f\t\005q"
+	.string	"\372\331\240!\203O\017\317\216N\016\023g\251d\223\353\273\313\255\234\201\243\325u\325\354e} \217\317\242\250\363l\215B\234:\363=i\3363k\356b\246\267\0325q\342\314e52[\215\302\2249o\031\361\2449oU!*\026\326\214W\024u\206q\210:\241\316wQ1\260f-EQ\347\223\n\346l\367e\230\3049\013\026%\315u\206_G\350\f\277\2108_1\374J\301y\216C\3249\004\211\263\334\352\363\276o\021\323\240\2263\365\347\320\212\217\330Vs\225#\0347\210\002\207\250\363\004\227\021\271>\243\316,\217\361\006\260\215\303p\323Q\375\303MC\255&"
+	.string	"\337\244q\261\361\2475l\374\005d\273\200|\364\026\213\355\264h\306Y\224\351\2462d|\005\f\r"
+	.string	"\f\212\256\"\261\231\016\271\022\253\336$\354\245AO!\350(\276\370\t\302C\256@7A\b\350J\177\235\364\347\347H\177\324</\201\327GxwNb]\001\344\361\331\207\\x\253\316\032!\210M\325\342#V\037\273\225\251\211\213`R$K\207X}\260\254Lnn\244\234\301\244H]\203\200\353\017p|o\356\241\256\213\332\232h=j[;t\230B\305\207\330Z\210-\bm\3159\2345\320\331\023\3771\353\rfuN\\\203g\351\fe\355\2636\221\351R\222c\304\214\230N\343\232z\317!WY\230\363@{g\365"
+	.ascii	"f0\212\210\347\022\273N\343\002s\235\325\004\364\213\n}\310\005"
+	.ascii	"]\201\f\305\310\244q==\347\253\231\253\tF.i:\215\353k\005\"r"
+	.ascii	"\246\325\324\016q\310\245\304qBD\213$\351e\032\027\022W\nq\366"
+	.ascii	"H"
+	.string	"'W\024b\324\224lH\242ELN\027\020_y\272\202\344ta\371\037r%Y\215\336\367mj\373V\227\323]9\343}_v\255\256\"\315S\315\254L\301\314[\314E\321n\227N\325\277\3325\327\310Q\365}_\346\177\221H\266\267U\n\021\271\235\227r\233\300R\275+\366r\214\013T\307\365bq^\307\n\216\304\365Z\372\021\367r\223|\271``l'q>i\345\r\344\033\223{\273KXfW\314\225zkQ\275\273@\030\007\311\230\203\302{\316\213\270jOt\330U\346:\361\326b\035\2733K kK\230\032\260\312\357*T\f\321\200QT\362\276\342C\\5\007\322\303\243f\265\275\357\217\326b\337r\024\\4\206\342\252\271\253\346Fq\245xk)\177g\213\260\020\353\257p\204\\\210\007\311\321s\\k\\\262\357\207\324D,_\303\346XR-Wu\247K\245\305\324\257\374\207\353\266\272p\001\260\255\025"
+	.string	"\333I\366[.Q\371\322\030:)@GJ\201xs\003\310M\362\225\207\215\220lPO\261k\246HT!s\034i\003mk\354D6M\222/\345\346\200]\337\025\251\211\004t\032\003d8\336`\321\270\276\214\262f\267\030\327\326\227\262\024\373oEUd\256\321g\244@L\337\027\313\211\231[\271f\274\001T}_,\027fzQ\201\225\001\034,\016\266\223\377\312\303E6\035\257B\306\177){'\261\376:\250\203X\276\206{\"##\023;\211\315\361\376"
+	.ascii	"<Y\f\002uz$\367\347x\277\023\362\206\037h\305\251\345\373\276"
+	.ascii	"N\334\325N\214\200\333\254\223,A\016o\255Nr\347`;\331_u\204\f"
+	.ascii	"\324\355\355\207G2\3079\375\245\314-\204V\245\220\177\214\271"
+	.ascii	"\241\375l\257\376\341\226\320o\315Tm\2459\007\r\030QP\375\327"
+	.ascii	"\374\324{\315/"
+	.string	"\232\256\331\205\217s\013\246\263\223\2173\013\037\347&\246\363\n\246\263\212\035g&\245s\263\351\232\227\230\316)v\234Q(\235O0\235M\3548+)\235\223\372\257\031\211\351\\B\351|\304t&\301t\036\301t\026\301t\016\301t6j\301f\020L\347\017Lg\017]\330\\\304t&b:\017\3618\013)\235\203x\2349(\235\201\224\316?J\347\r=\316\032\224\316\031x\234}x\234{x\234yx\234wv\234ur\234st\234\2319\3168\r\246y\311tV*\235Y\245s\022\307yU:\377\322\331\225\316\335a2\306\240O\351\335\217\211{\211D\266y\013\223zh\r\246\273\260[\260\373\257{\257\233\256\373\255\333J/\231\233}\264\030\336\001\202\270\026\206\021\231/*\360\261\355\220\237o\316\020\206,B\376\2756k\203t\211\213\214\353\242_ \377\336\342\032\340\004w\325\026\325G\364\302\001\\+\336\270,6"
+	.ascii	"\210\330\022\361=\217*|\256\342N@\303\024\342u\274\220\016\361"
+	.ascii	"=\214\315\337b\353\001T\302\267d\364<\214>'l\215<K\361\341\177"
+	.ascii	"\242\357\373\341\231^\317\214C\352Px\370\0351K\017\317B\272w"
+	.ascii	"\t\244\236 \372\177\241\211\276\317\260\200\365Wm\342\245\354"
+	.ascii	")\364\320\353\240*\352p\216sk\341\274\265\206~'\357\217\002g"
+	.ascii	"n\251\355\234\347\361\025:\377J\351\245\177\325:\036M\337\367"
+	.ascii	"\375\267\245\373P\215\334q.>&}\241\320\353\244a\3616\355]\013"
+	.ascii	"N\331\264]\332\313\032\241o\3012\244\240G\251\017S5m\227\240"
+	.ascii	"j\232\240WR\027K\274\264\212\246u$\021C\016\2302kN\305O\315\321"
+	.ascii	"KY9\246\333;\226\303[Q\005\355|\261\275[\232\341\360J12\2202"
+	.ascii	"\334(/lU\003e\221\304Kym)\026\350uP\023\363<Q\312C\265\345\342"
+	.ascii	"\325\266K\320T\214\217i\371\372\332\277?\266\223@\337\324FR\033"
+	.ascii	"\3036\242\256\225\232\204\350\347\363\232a\351]\374\026#\306"
+	.ascii	"\300\206oA\"E\200i\027\337\317\357\272N\252\300\226\027\342\245"
+	.ascii	"\334|\235\002\020DC\237\327\"\032\377\342\267|\nU\361\333\307"
+	.ascii	"\246\250\340\306\350\245\235\304\276\370\206~\003R\211t\020\324"
+	.ascii	">4\034\353+$\244\">6\226\341\033\263\370\341\245\374\363\033"
+	.ascii	"\276\243\201.8\325}\325/\255`\357\265\204\036\330\032\376\363"
+	.ascii	"\017\360\357\347\273\017\005\357\233Z\2522\267`\334K\033&\001"
+	.ascii	"(\013\311\366\343\333\333\3609]\020\331\364:\320I\236\240\207"
+	.ascii	"\016|\215\323\246\346\r\221\2135\215\".d\262l\311\243\n>6\256"
+	.ascii	"\230;\034$ru\242\324/\035\226\335&\262\032\306\270]\233h\003"
+	.ascii	"\254j\227\005\213\206\177\301!"
+	.ascii	"+M7e\003\254M\313\22594}\217\215N\212h\324\b}\032jb\020bO\261"
+	.ascii	"\031`\360*S6\300\326\356\342\3402\374\367%\341\360R(\3556\305"
+	.ascii	"k\243\322c\204\017\310\347{\336\212:X\306\331Z\307\237\202\215"
+	.ascii	"mY\223\342\363\275W\266\350QZG\033`cy.\250\365\374\357\375\275"
+	.ascii	"\375\274\264ud[`\344\202v\266\243\206\267\326H\202.\272e\303"
+	.ascii	"K\231\347w\336\212J\210\345k\316\270Y\353\370a]\2344\341\371"
+	.ascii	"\316KD\343\323\326\321\306\223\f\264\255\365\230y8Y\253f\035"
+	.ascii	"\2126:\331\332\336\367\225:\223\026\262e\323\272i#\331N\356\374"
+	.ascii	"Q\231\213\327\371'6B!o\030K\nsa\032^\312\316\343b\355>.\326]"
+	.ascii	"\3278fh\240=\334I\354\322oqg\220\341\375\266\353\004\342\n\261"
+	.ascii	"\340L!$\243\2131\023\305GIS\275\bO4j\242\217\026\243\225\236"
+	.ascii	"$\235\363BO2\252\"\013a\237\244\316A\362@9\363\231\335-w\210"
+	.ascii	"\021\326_\021\361g\214\301\222\217\035\026\364\340\200\002*\253"
+	.ascii	"&\325\020c\260dA\225\007\315\0170\270\240j\003\036B\214\301\222"
+	.ascii	"\217f\217*\037U\"T\260V\365\016\013z\334\260\332!B\025\0078\033"
+	.ascii	"TPe\265\003\207\017\017.\300a\252\245\013\252"
+	.string	"xt\320\203\252I\305\243\331AU\005\0344\251\254|4\227\202\270\207\007;\254\232\037\364\350a\325\314\211\373\321?\306I7\\\220\214?\336I\344\357\373\022\245\275DJ\210\212\f\35151\370\350-\247\274i\035\212\254o\f\034\007\230\025\244W(\243\251\315\354\243\002\001b#):\320^\317\253\002\313\207\361[0\276\337\326\367}\337\007^\3320\276\275\276\021{m\023\030)\346@\213\307\021\330fep\326\002\340_\213\337\221\212a{\301\214\227\031\016\247\367\267\246gn\235N\337Q\032\262\221H]\003/\345\327k\026\211@\336K\233\205\342\314\214o\217\305'\347\302@\276\241\251\206q1\320f\261Mo%\344\271\264YIgSh\333\030f\027\353\267\264[+\320\2314N\305\307\373\274v\b\221\266\313\b\333\311\246\3570}\004$\f\333\333\217\331\362\266d\201\227\262'p\242\033\261\227\220R\336\3348\321\313\337\342V"
+	.string	"\004\177;\2576\t\217\227\300\004VX\271\262[\260\260v\211\267\326\212\007!\312\215(w\024\004T\274Oq2*P\360\002\245\020K\312\260\225\024k\364\217\347\365\200\242\217\212\212Q\370\245\212\215\250\357\037\337O\277\274 P'U\354\351\246l\230M\3010\273\320\2772\027\365L\377\344\327\327<a\016J\215\001\f\033\307\r\n\324"
+	.ascii	"\027\353\242\036?/\256\003\024\273\371H\220I2)A\f`\322\315\037"
+	.ascii	"\"\213,`\255\233_\203L\r\325J\363\223{\221\004\244H\301f\200"
+	.ascii	"\301VR\244\341>\257\001\200x(\250\2716\204\177\002@\275\373\375"
+	.ascii	"\304\203k\035\233\246S\376\315\2555\264AVX\310\3542\3716*\336"
+	.ascii	"\314\307v\222E\025\352Q\374S\036]\223\033\335!\215\030\203\215"
+	.ascii	"\343\006\366f\206\2135\210"
+	.string	"\fp^i\002\360\177\222\251\315h)\366\304\327 C\243*\276\020\345\304'\345\322\260\3110a\242\207\030\351\213\001\330J\212Q%<\257PH\377\364\364\036\2552\225\266\201\361\364%|?\357\322ZG\026\323\024\017\245\2056\202h\177\266\267\370\350P\244o\326:6U\337I+\210\364MZC\033L\036\2770\273f_\366S\247i\343\323+\375\323\235\232gz\363t\213z\001\3308n_\203O.\326H>M\262\340\240Z\212MzgB\366R\251\345\373b\215%}\263\354\355\251\204\006N\332'\336Z%\276\352+\016\222\361E\213\366K\246<LY\030#\363\330\350\342\350u\264P\036:\265\374\347\203\265jQZ)R\330N\036\375\023\223\026\240n-\256^=)N$\200\220x\r.\260\270\3223\3224\"k\304k\b\202\357\250\0029%\316\242\216\251\231\021\021I\n\222\2441\242\013\020\206\002aXK\352\001\022"
+	.string	"$5\310\263\320\241\232\221\022\025:\254\227\253\367$3\372\026x\322\227q/\305\271\270s\277\340.Lk\240A\fl\234B\315N+\274mP"
+	.string	"\202\300\302\017\343y_\200\223L\267\201lg\352\345F\315\251\322\027G\200}\354\255\261^lE0\355'\345\221M\356\342\177-p,\255Lu\310\271\004\2732'\244\264\030\216l\251fd\370@\265Y\027'\330[\231>H9\330<\365<\210\352\030S\032\260:\255_\221\3739;G\241\365j\367+"
+	.ascii	"\233*\253\366\274%\275:\225\354\276\207\302}\3350\037\006\304"
+	.ascii	"q\227\003\220\326\025\037\022\370\367-\231o\007\357\256\203\214"
+	.ascii	"\032g\031\016h?zg\211\216+\223\261\245$\275\3058\307n\031\362"
+	.ascii	"\023kQ\256\310MB@\223\375\220\355_\nJ\271\024\031Y\013\235\201"
+	.ascii	"\232\031\023\222\033\240\352\024\250\023\032\326\305h\f\202U"
+	.ascii	"\245{\004'q\300\350\360h\250S6\246a#\240\f\231\362xoR\250kff"
+	.ascii	"\236\302\300\350\024\324a\021\357\335v`\335\340K\325\3323\220"
+	.ascii	"\315Gv\205p>\222M\017\\T\001\314Y\265\\\247\242\202AlYe\023\t"
+	.ascii	"\272\274\253\rQ\345\023s\202;k\315Z\320\002\034\241\353\b\"\274"
+	.ascii	"\342Hbw\235\203sK\271\230\364\013\335\342\377\350\200\232\016"
+	.ascii	"4\367\261>:\262\365m?\334\200[\370\032\201\326\267|#L`\203E\245"
+	.ascii	"\240\247\\\206\340\260\214"
+	.string	"\212:\306Bj\370\001c\027\223\234P\035\33355z\b\200kld\303\2414\352\222\0024\362N\320{\232\323\366\326Kr\240\242\\\"B%\343Djp\217\315\324\300\206\323\370\223b\026l@.\207B\327\314\342[\322`\333\332s\353s\235R\"*\320=I\3563$\332\204\022\023\230\026e\334Q\223\241O\334?\353:\2229\342\351\254\226$\207\226N\027\274\\\026\"&\t\200\224\013\327A<8\314a\215t\220\023\210\271\273/xY\267\b\372\376t\371\227\237x(!F0bsp\26726J\372&Xu\200\006\314.E\312\031b\330\030#\335\366\236\332\330\367[\354\230\306\360\032{\351\b\023\320\251|\361]\244\221\025\344o\244\223\340\355\200\201/\263\004\007\300\f\350\342\352\257\343\320\221\272\032I\323\335\336g\251H\257\365\256@\306{\206S\361\311\333\2041\273\244\253\321\267\331\177\374\3251\027\225\320\243$?a"
+	.string	"?J\320\333\3359\207c\242F>\035T \313\017\342\027NG\250by5PM\307X\317W\221\2346\n\244By\366\243\035\002\231k\365AX\377\265\375\207\352\306\345\300xM\336Pk\\\313\021\\\001>\026\363<\025m\335\216\232\256\004Fts\245\306\334*\022.\255\306\216\f\037Ms\225\220atfx\304\\`\254<\002D\354l\253\027"
+	.string	"\353\206\361\261~R=w\225\300\241\254\031B\346F\335\007\226\213\001nx\253\327`"
+	.ascii	"\302/\311`\311\2758o)\201\025hc\bV-\003\271\365m\3128\006\033"
+	.ascii	")\221\252\326\262\251v\233\252\364\b\360Z^\257D\330\252\301\362"
+	.ascii	"#\364\247$\337\321X\007U\304\310)D\341l\330\335h_\234\307\372"
+	.ascii	"\263\253\332\265\001bD!\231\340n\230\2342\257-4`$\022\0078L\255"
+	.ascii	"\337\205*S4\031\301\b\204\247\313\002o\324\374\325\200]t\202"
+	.ascii	"B\353\322\017e\032\341Yq\352\001\024w\017\306Y\241p\332_\274"
+	.ascii	"\021\335:\013\331\036\304\035\213D.sb\031\026\033R"
+	.string	"+iu3c\373\324X\240u|#S\030c\331\255g\334\273\203?Xr`\003[\306L\270J\316"
+	.string	"\213\227\201\3361\006L\"\270Z\213\367W\230\246\342;&\352\2354\231L\017\r\377\245\304V\213\206=\362\006\264\344.\254\316.\017\367/RG\364h\202\300\232B\313.\021\316x\016c\351\307\340\252%\020\263Yv\216\207D\324\334\312M\001\303+\247\252v.'\272\213f*a\334)\215\252u\330\030\375\213\024\272\300\001\200\027\257\367\256\r\301\013\360\245),\367$\210\030\307s\274\007\305\364\227\214USMv\032\210C)"
+	.string	"\001\242\362-e\255}5\212=\371;\034Z\346R\335\313S,\367\216'\334.\236\r\"\201_\353\266\200mu\243\341M\250\341\334\022\005\270\027\357\305(\004\272`\336\223\303\274\231\246\325\357\2632\310@\324\275t\341\370\273\376\364\0039\237\221\300V\341\201d\305\321O\335)\375\206\030"
+	.ascii	"\024\350\347,\005Is\264\361\277\256YX\005\026\361#(f\234\367"
+	.ascii	"\021\307a\313@\207Q\251\030\021KF-3t\347\220\234\235\374\211"
+	.ascii	"$J\376=\023\246%\037k\215Q\343\222\311\254\322\r\377\256v\212"
+	.ascii	"\347D\020\367\2021\230r\251\255\204c\257r\210\305\350R\034\206"
+	.ascii	"\334a&\205K\024o8\221T\f\232\206@\025Lj\272\"e\361}\233\353J"
+	.ascii	"T\3451-\305r\343\351\003\001S\351\332m\210\\-\355\335\265\207"
+	.ascii	"\356\242\005*\353\277\030W;\365\320\314\033 [=#:*Jy)\215\\\250"
+	.ascii	"\332\341\300\210r\322\002"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.136.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\352\017\235L"
+	.string	"Z~\030\034: \244N\007%\277\227\263\366;)kM\001IxTTg,\347q\264q\341\212e\216\301\274\355[Pa\254\362\025.\300*\254\330O\020\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\202\006{\2264\231R\n\257\001\227\001\261\001i\334\t\335\261\336v{\267\317q7N\307\207\317\351\007y9\3478\355r\032@x\235\021\315s\\\016B\310K\035\016\027\316\0335\317K\362\363\371\342%\312\241\234s\f\327G\267sM\373b;\331x\342\353\212?\232\332\356r\223\022>/\325C9c]\270\316lz\207j\235L\273\2324A\350\230\336\252\223\202\2239cI\270\207\216\330\355\354!~\246)(\331\3632n\246[\210\223i\025\212\215v\2029g!\335C\272\235\316\\z\241\033\266\023\333\213\313\214\306\371\372\364\3700\270.\350\203\257\023\366b\027\0346\357\265}\2204\n\"pf\017p\235\331\345R\2553\227\016\325:\263\337\356H\307\346e_\034$gf2\347\f\206\261\370\353ZYXWVUTSRQPONMLK\320\247S\251\351&\265\314%\376\267=i\003"
+	.ascii	"+\241\303G5tm\2565\350Y\203\202\217\025\350W\201\206c\336\252"
+	.ascii	"\n\020\316\337S\001\372\024\227\227\002\364\243n\371\250.{\017"
+	.ascii	"\365\364z\356\364D\325\262\354\352r\244f\371&W\262O\021Q\225"
+	.ascii	"%y\316\344G\315k/G\352\224_Z: 2)\305\035\251y\313g\245\234\037"
+	.ascii	"\367\243\332=\224\301`\3373iC\b\274\2716\202\224U\226\324\271"
+	.ascii	"3J]+\245\205Q\317\253P\245`%(\336\\\036\260\303\303\304\035\251"
+	.ascii	"P\226R|\360\b\271\241{\371Q\255\357zUYR\365$GjU\356['\316\214"
+	.ascii	"#\362K&\216\227\350\340\226]9g7\364\237\243{\373O\332\220s\356"
+	.ascii	"\237\322-\361\336\362\356\337\352n-\335KS\001\271/\220/\337e"
+	.ascii	"\003\316;\270\217\324\345\343\336\276'b\366zq\367x\264\316l\342"
+	.ascii	"\001\220\204\002\276\373\025\363\002\276O]\354\201\034\3534\276"
+	.ascii	"\3416%|\315z\367\033\370no\341\267\tV\025\377$\335\337\302\266"
+	.ascii	"\373\035\364Ho\241V\240G\016\211\203\007\020 \b\253\211\223\222"
+	.ascii	"\316ej\247\247\351hm\022\026;\204\024\341\224h\223IxF5\021\320"
+	.ascii	"e\264(N\025\361/\251\305L,v\250g\204+J\324\342\013%\374\220!"
+	.ascii	"&\236Q=C\331\342\253\037/D\310\345T\313L2\227\030\237pA\220K"
+	.ascii	"\024\376\b\b"
+	.string	"\343\031\3252\200K|U\321\366Q\261\345\b\025\223\375\223\364l6\373\b\343\353c\307b\207{\340\276\262\273Yx\343\236\307\032 \333\205\347\371\341\346\f\027\241\375\216\343\201\321\276\347\314\226A\343}J\243u\246c\005\205\222v\203\204n\237\355\306\276=\276v;\316f\263\224\215\255t7\277;4\2779<\27738}ch\372\266\340\212\336\025<\2157\205\347\267\004g\364\216\340o\274!|\005p\2547\200\346\267W\363\273\253\371\315\365\374\336\202~ke9\2417\026\364\373\352\371m\325\374\256\202~SA\277\247\236\337R\315\357(\367\033\212\351\373i\351\333\t\372\335\324\374fz~/5\277\241\316\357\247\322\267\263\371\255\344\374n*}\273\315\357$\367\273u\277\231\356\367\322\375\306\356\367\273\337\016\302\025\375\330I\351B\b?b\263\222\354\243\334\310|\323\305\031\335\337\270+\272\007\316|dM\244\244\202\302cT\020"
+	.string	"|\225|\005\3129\377\3714\221\005\f5E\001?a\013\330\343$+\340'\\\201\356\303\374x\305<0\357\365\021\003}\251\200}\321E\320\261\262\001$t\302\0240\376#\027)\3027\341\356\267\311\373\244\365\251\023\356\202\303m\375\205{\321\277\t\273\032\177\201W\315\306\331y\373,6\347<\205\257\375]\034\212\237\204R\216\326B\003\030\262\t<\314\003\367\225QNY\270\227OX\370\013\3175Z\313\204\305\016\005\301}\245\365\271\240imy\257T{L\004\372\330\360\331\rB\261U~^/\366\204\376+\217\345\215\262\254{\247\264SZgba\177\343O~\2620\220\336\340\3769\3476'\253\034\246H7t\257\213\263rY\352E\217\314{#\324P"
+	.string	"8"
+	.string	"\236k\327j;`\234\007\212;\340\376i\"\267\317Ry;4\256@\375\342}\335{\325\312sf\177\224\227\362by\263\274z\357\323W\257u&\024\263U#\233\334\274L\035\2536v\031?D@L\370\332J\036m\2378\307!$\334W>\331\361\304\t\234\370\321\364\241\353\3076\204wK\370\332\355\2233\317^\3647#Q\032\003\265O\2348{\321\361\006\221\301\n\242\212k\022\251\324\213\016\351\306\2441wk\310f\001\301\345\354\026"
+	.string	""
+	.string	"\236\353JWz:4\252\022vC_\332\251\356\241|#\336\033\226P9\027c\324\370\304\327#\336\325\366\220\2640j\221\343D\322\237\244#\335\347\037_\276\233\366\317ud\225\034:J\376ni\235\371\323l\340\213tw\244\233s\233\333\371]\275c\001\216\350\031\330\332\016\035\321\0369\252z\307\002\265\035kae`f\322\2622\351\330U\231\324\214\354\203\232\032\331\2304-\005\216h\n\263h\331\023YYt\355L*5\201#z\346\f\273\361dka+\306\324@"
+	.string	"\t+S\"+\213\266\320a\026\355qV\026\246\3664\223F\327\306\242ikjd+\310\326\302p\234\271H\223\256I\313\246zl\201\216h\0163\351\030\330X\0160\263hX\031\330X\232\032\330\002\252\226\236\221\245\201\255I\245i`N\254\233/3\266\322\206\356\236\t\244R\036r\303o\215\001\367\357\371\306\032\355{\315\246\210m\321\"3."
+	.ascii	"\321\242\303G5\211\020?O\215eb\336\364u{<l\215\226\177\362r\316"
+	.ascii	"\023\354\374\0356J6Gl\220\330 \265\316\304\200\035\321W|\341"
+	.ascii	"\202e\304\242\306\t\007\234\001\343D\271Hf\350\314\341\200\335"
+	.ascii	"\214\177\245\222=\273A-|Mt\3068m\254\217\177Y\216\326z\261e\337"
+	.ascii	"M\033/l\303\n\210R\303\333K\344}\332\005\036\237`\341+\233\267"
+	.ascii	"\220k\215\325\317\244\344\025\2766\323\321\332.,&\367h\320\334"
+	.ascii	"?\363\210\257\221\271\027\t"
+	.string	"\222\326\231]\002\020)\336-\255\270p\231\267\220\353\320\247\362L\023\341*\314\205\275\2167\033\365\2616\222\200#,\031Y\025\017\037\021\023\370\022\226\200\373\343\0305y3\266[x\t;\035_\216\321\2433\330\350\214\244\026\336\322C\205\277\260\026v9\356\n\302\263\032\252\302\327\206\200\27706d\243\350P\317\025\246\302\020\360\027\262\302W\370\252\n[\r>\366\013\253\260\353\201$\f\200\2470\025\3668?)<\205[3q\207\242\260\024v\271H\203\202Q\330\341\004\201I\250\2210$\225RffDD\222\024\244\220\016Q\005\304 f\241\254\007\021P\261Sj\214$*4\007\034\351m\366\242\202n\356\214\035;\216x\221G)\335b\216P\305\026\332\334\267P3\360#A\004\275PRMf>8\311v\244^\344\264\350\221g\347\275ZM\242Y\260\315:\221\256(\251u\021\244i\025\242\321\212;\202\001\244o\016\236\255"
+	.string	"7\2224u\233"
+	.ascii	"\212oX\022|\001\214;\231\375\270\253\222\216\fk]\204s\212i\351"
+	.ascii	"\f\266\313\353\320\343}\336,\320By\021\222P\345\310{l\267}\355"
+	.ascii	"\016\035\355\276\375q\327\325\333\341\002\371]\352\374\020\315"
+	.ascii	"\221A\312\240\210\327/=\261"
+	.string	"H\364\266\261\223n\375\303\207kaP\235\332%\245x\256r\314\f\374\315\023\f\201\215\206l\306\302\f<5\246\211\302<\223\302J\314\314\334\374\222\255\037\206\267\017\361\302lu\230\030\021\211\270\340\200\216\365\234V/J\376\3750g\036U\025x\0240\3179\013\220\225Vu\262>W\tK\221t\022w\026\352\032V\017\210\223Pa\024\331\237\345@\214\021|`u\306\223"
+	.ascii	"wg\206\r\317\306\350\376&\200\\\312\\\203V\215\032K\253\3104"
+	.ascii	":O\356`&R\357J\323\345\001P\247\342W\032\270R\346(\317\255\352"
+	.ascii	"%\346\302Z\201U?\375\372\360\215\370\301\203\251\254\257>_\003"
+	.ascii	"\214m8\005\336\313\310\237Z\307\2402\202\321\346y\313\201\335"
+	.ascii	"\bc@>4\212\264\036\2510G.\311\007\307E\361%rF\003\313\021\230"
+	.ascii	"\262\035Kq\032\215\231\301\262\205\214\354v|\001<!\306\334|\034"
+	.ascii	"\221\t\326\245\034\"\003\243\306_xO\037=\260^F:\213\267\f\374"
+	.ascii	" \367\r\035s\357\370\261\230\371\252\364\\\211\bn+&\232n)\206"
+	.ascii	"\b\214\302\366\251P\245|\002\361\212\345\357\302\347\320\203"
+	.ascii	"=\326e\330\231\235<*\347\026P\275/\317\360\347G@\331w3\230c\237"
+	.ascii	"\203\263\366\027w\225\b\340\222\353\313\217\350A#;\306[\004\316"
+	.ascii	"\020\272\322t\\\023\023\304SaE\203Zl\256\2472\020\367\361\266"
+	.ascii	"\270\236\307\221\234oZ\311\030\234\350\314\241;N\007\005\223"
+	.ascii	"\234\022\312o\254\361\334\375`Mn3\304,;o\034<\263\323\235\357"
+	.ascii	"\2339\026\346l=HFt,\256m\226\0160V\371m\001\301\327\335lo\345"
+	.ascii	"HC\317\257\327\304\t\336E\232\337U\002\020\313\316\350\306\266"
+	.ascii	"D\371'\233|P\001"
+	.text
+	.section	.gnu.lto_readEEPROM.137.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"\255\b"
+	.string	"R\21798@\215\323\001pKjnt\225\330.\023TSq"
+	.string	"I\263\300\334\333\230\371\357<f3B\346,j{u\001x\310\\\024\345\024\027M\300\004\002\361\226\bm\323;H\333;\245\333\246\241\024\264a\246\031Ng\363\311\350\244\233\371\3514x&\325\266\231\031p\366\240\321&D\226i\363R\367\222d\311\207\251\224pBz\016(\017\247$\314\fR$!\026\355\r\024\377YR\340dZ+\332\021\022\361\237\343\251CD\005\305\223\235]\273(3\354[+I\366\301\333\262\020\254<N>J(\231\252+ZYmx\215p\034\374\355\220o\362\345 W\320\325\025\001`XT\360\340\2271\226_NP\b\231{\335\020\005\224L(@T\273uJ\215s\217\234\177\323\031\274\213\220o\324=b\013\273\353\370\215*ny\333\030\333\b\266U\001\022"
+	.ascii	"2\001\3578c\372\002\301=0\030(A\363\016\240\253\324\0218m}s\b"
+	.ascii	"\327\304),\210\033\002\\\024\375\241\202\207;gj\347\023"
+	.text
+	.section	.gnu.lto_ValidateAndWriteConfigToEEPROM.138.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\005\t"
+	.string	"\026\020>: \221\323\001\363:\237\220\020F:y$@\032p\310\026W\3049\031\002`\271\200\016\r5j\006\312\252\252Q\372A(\004\024\020N\217 M\326\016\320\205\266\243K\037J\374\336)\005*"
+	.string	"-"
+	.string	"0"
+	.string	"\317\034\3322\037\214\025\025Fj2Vhv\267\322\217\207\237\241\377\223\013\214\244\370\331a\330]\317\221\334\270\351m\027\330N\260\375\n\324\303>\300\356\256\251\312\356\220LR\032\344;bvS1\233me.!\266\357\261=\247\215\260\020~\005~>S\256`v\313\003\033\004\004\034?\345*\240\017b\tn~|\346s\234g\017\034-%\257\323\214u$\024$\221Ot\323\312\246mq1?z\262\240\260`.\024\025\355R\234\001\021\233W\321`\332\276\001k \321(T\352\264\252\205ji\004\301U\315\373*\210\300\335\304\346US\327y\325S\356\251\312\341\205\005s\235(\312>\030\017"
+	.string	"\201)e&4\304\217\343\323\234\006M"
+	.ascii	">P\f\334\006J\320\274\361\246mw\031\257\244\306\201;\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_writeEEPROM.139.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \331\035\006"
+	.string	"\342J*4`\247\246\003"
+	.string	"\225\263\207\004CV\035r\030\272\316g\r\253\036\r\344\367\177\b%f\033q\230m\211\235gc\334\007\301\004\003\016\2559b@@\025\323Z\271e\n\247U\345\262\260J'\265&vM.\223f\231Y1^1\224ljj\315&\005\366\362'\tM\243\330a\317YB\366\337p\344r\227\007\341h\024?\274\375\340&\371\364/\242\371\373\331\242\320\211\274\025@\350\356\036\034z!\2210\360\177\251k?\303\202\001\335 (\205\f\032\272{2\300j+\265\357\026\354\202\363\266\225\212Hw_r\036i\317\373\337\361\377\361\037\024\b"
+	.ascii	"3\003\236:C^\270\3175|.\204\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_writeEEPROMWithFeatures.140.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\205\b"
+	.string	"\006P<80\217\323\001D\231\205\360\007P!\220\371c*\326#\037>\267)8\324&'\325\301A\330'x\214\025\321\375\031\021\035\f,\266\244\030\206<<\256\361\004M\201O\215\310\235R)"
+	.string	"."
+	.string	"*"
+	.string	"\227A;\345\243\306\022xpL\210\264\354\356\324\214\203\227\240\377\220k\304Rx\211Q\330]K\261Tq\353m\033\330\316l\243\002W\314\303B\242(}Ce\227\364\342\262\251\313\244cc\373\322\376\307A\300\237 \254\331\275 )\331\035\023|\220\371Up\001\354\227\365"
+	.string	"\354\001\b\267?\335\nF\252\332\237\310\203\222\222\320\320\226\264\035\036\344E\313\221\223\324J5\322\320\036C\251\030\366\255\335]\253\311\376\351\001\337\346\211B\234\215\313X\313\030:\034\250\323\246\306MP\207\363\231\232\367\315l\300]\303\346\315P\327ys3\356\255U\223\027P\026+U\204\216\f \003\013"
+	.ascii	"2\241\267/0\\\004p\302fsi.\007\200\345b-\261\232\002\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_resetEEPROM.141.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\305\007"
+	.string	"R\31647@o\323\001x9\325r{\025\bI\346y\222J\331M\262\024\036\376\372\322:\264\032\262\204\370f\304\250.\352\005%Lg<\274\206\327\003vH\255$@\350\343&r\247\024\2662\016\033\rgZ\322\322H\316\206\001BZWGf\b<#\032.)1\347%+\357sjU\344"
+	.string	"\225\r\323G5O\200R\350\303@\204\333\235\211\321\025J\373\235,43\005\375\216\242\002~\363\273/\234\204ZN\232f\266\247A\355\260O\255\212\354\370\240\001\302\340\016\302\262\013zqYSD\t\261}\237\344\235\347$\017p\244\214\354n\365h{\354\352\361\2251{\345\336\307\026\210\220.J\276\335\225\352q\354\020\363?\272\300\306e\207\230\204\3355\334\270\214[o\333\300\366\201m\223\r"
+	.ascii	"2\241\247/0.\270S\201\237:\"U\343\325)\236k8\366\020oP\321/\367"
+	.ascii	"\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.142.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\325\007"
+	.string	"B\31646@\217\322\001\360\037r\034\270>>\374\375\240|\250\301\315\233\322K\310\306\2006\256\374\026r3bJ\360\231\316\342\207axg\017\270\345e\270Z/\230\226\265\266\245L)\2668\016\037\017\350\262\240\345\201\240\317\302\003\264\260\020\344\024\370\202h\300`\304uap\303\215\336\031\251\3664i\207$\362\233\365+\215\027\225*\312\257\310\\\031DNH\271\362K{\202\"\277]\237:\201\n\305\324i*\2629-\025e\377\255\236\354\247\237\021"
+	.string	"I\211\357X\331\275xq\331\016S\342a\373\033g\266\3129\2165\370 )\215\260\354.\324\215g\177\232\231\037\020E\177"
+	.string	"\031\327wp2\265\fD\355!\230t\245\247\236\026\221\224\251\351\354\256s\213\0307\346\266\025l'\330\016\t\016"
+	.ascii	"2\003\302\360\035\302V\rT\205\275@5\217\325\035\227A<\327p\273"
+	.ascii	"\020\374e\\q\351\232j\232\006\246\240"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.143.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\"L.4`m\322\030"
+	.string	"\343\006\032\271\273\272\037\200\301kb\262cj\215h\372\332\3657M\360w\004\201\361\023\314"
+	.string	"\003%\b\202"
+	.string	"G\326\272d\f\247\357\2175+\245L\001O\033\205\016\347\363&7q\334\247\203\260\340&\312\301m\004~\f\t\224{x\217r\232lQE\001&$\032\205\202\316\274\006\317H\303\344CD`H[\332@j\255i\200/1\221x\235\"%[\312V\241\326gVj\306\243eU\364\027\317H\350\002\303\016\224\335\320\212\312j\227\221\307\217\232\253?\301lc\007>H\026!\245\335u\252\201\025f5\"\bf.\314\302\0048\330\335\363\3020p\305\237\340/\3709\002\f"
+	.ascii	"3\001c8c\360\356$\325\230\346\016\246\266\b\347z.\344s\301\216"
+	.ascii	"\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_setConfigDirty.144.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \351u\006"
+	.string	"\342\013-3PO\323\001\240\210\020\201\340\322\227\350a\370\340\221\360\b\372\020\200\rA\263\2024B\354#8\026\335\036\03503\256\242\252zq\256RA\277l\333v\357\224\002\246OB\004I\225N\nM):X\230tj\230O\200+\003\3024\035j\235\246\323\355#g`\342\271xX\204\360O5~\310E(?\303\017\025|v\351W\315\245\344(\361\250"
+	.string	"a\301\340gw\027\214\026\3661\0339;*\234h\022\3335Vv\265\357eQ$\311\206\355;\266l\225w\030+\320\221\0221\322\262\2733^\334:\264\374\177\034 \333\256\303L\301\356\032f\333\304\035o{\3006\201m\212\b"
+	.ascii	"3\001\0178C\\|\241k\370\\\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_isConfigDirty.145.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016\244\204\252J\304\342\312ZE\030\036\242a\024\255F\373P\nk\366\357vx\255`*\276x,\221\231l\234i\3013y\245\002\261C\343\026\367\226)O\027\210\fFCMm\3024M\306!\242M\325D\273\030LI<T\215\202\242\252f\311\262\030:<\360\340\347\033R\021\353z\\\261\271^\225\356&\240\322\341\200\206\347F\237u\0167\276"
+	.string	"\211\241\377>$\030\271\300*2\311\004\215V\022E*\021\375\234\267\254\260\300\331j\326\001*\370P\261 I\311\314\032r\324\352Y\267 m\370\210N.\254\323\023`\310\314\357\3022:\366O\370\021~\214\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_changePidProfileFromCellCount.146.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\177\004M "
+	.string	"V\374\324I\220XN:\201\242B_\325<Fw*\370t\204\\v,z\370\b\270\232z\303\366tx\022\232\222\223\2267\364\371\310y^\356\215\372\366O\\EC<\013(\020\300\200\352%\2710q\002$\252a\252\255\255YB\b!R&\031\304"
+	.string	"\255"
+	.string	"\304"
+	.string	"7w\227y\327\301\003\244\203\261\330\256\265\n\231\244V#\203=\220\336\\\244]\266\033sT\237\2177'\"aj\255\277\306\2619F:o\247\313\341R\3644\313f\244}\256\230t\236U\024\325we\316\227\230&W#R\2258cM;\316E\264\301:5\342\324\217g\250b\023\347\n\334\210\252q\034\201Z+\rN\257D\343h\231\223v\245\245Wt*q\252\2202\316E\224\342\263\224"
+	.ascii	"\304KG\2578,[\214\314\311\271\210Sl\nu\301h\263\212\252\361\262"
+	.ascii	"LP\205\224\321+2\2255iWZ\336\245\003#E\263^q\251\344\371`\343"
+	.ascii	"\372\361\005\270\210T\314\350\204Z\353\362S1\352\333\373\356"
+	.ascii	"\202\331]\022\273%\200\225g_\266\242D\252\205\342\274\311\215"
+	.ascii	"\013\373\330\311P\354\265vH\310\177\272\271\027\2367\337?\276"
+	.ascii	"\35425\344KJ\211\223\273\306%\356,,u\255\270\215\265\353c\336"
+	.ascii	"\033\233\203\3755437~e.\366\355\241\274<\224w\307\274:\2237\307"
+	.ascii	"\2748\346M\231\027e\336\363\3445\231\267d\3366y\271\344=\016"
+	.ascii	"oM\253\370\255d\2551\222c\352\024\363l\353\306_\354\274\373U"
+	.ascii	"\361!\033a\212L\367\013\371qub:a\272\\p\251\325X"
+	.string	"!\275\271\017{\020\244\033\027\3555\252\276E\225\256\027\\j\255\nnn\203\364&\201\327\2347\313\0078\003:g\257w\035\340\370\225\304i8s\315_\376\343\307VR\332Y\373\363Z\220#3\320\306Z\005\237i\263\007r\313\021\331eTXh\247\256\3136\312\265\216\211\006\\\032\022\254\n\354Dv\205\276d\003\017\260\352\262\264\003\254\326\nA\311\3178t\360\360\341\274\231k\004:\302z\215k\364\312+\351\364\326T\326\304\312\314\264m\372^\030\034\355\264}P\206g\013~6\332\250\227a\325\022'\327\354\023\304\221\204Hke\342\331\037\271Y\317\002}\370O>\347M\263\35755\366\025\306\243\366D\253\354\254\r\236\334\273\033?{\313*\322\235\265ew\2138bab1[\323e\237V\234\336\270\273\357\364\266@7\022Lk\r\033\2643\"X\364;\n\002\n\n\371\212v)|F\020Y\360\021\n\376\b\2152"
+	.string	"\021\005\203\200G=C\002\216\210N\b)\b\t\371"
+	.ascii	"q\013\334\001\n\376\020\t\201?\340\317\217(\3303\364\003\032"
+	.ascii	"\231\370\355\334\254\260\310"
+	.string	"\307\350w$\024\032\375tF\245OP\352%\"\017\207oz\367\002\006\376\023M\0216'S\230:i\237\374\242\2354}\323\250\324\022'm\220MJv\271\231\316\031\272\3010qM\323P4\006\222\240\3608Jab1<t%N\246wcmQ\312\235\3174\324\315\320\355\r\347k\231a\233Yi\323\275\206\3525\257\177\345\230\305l^\333\034\275\300\224\365\370g\r\335\314R\\o\211\316\264LC\355\366u\316]\373\232\275\f\317\376O\250a\030\b!\345\214B##\321\bi\322\034P\0021\nZy\020xg\222\346\307\222( *\201j(\207\313\363\370\314R\321[\t\246\324b\236\264\272\366\224\311\035r\275_\265\2317<(14_6\002\230\353+\324?\304\230\021\241_\016x\230|7(\341\363\201\3146\230Y\001c\346\201\n\300\203!dM\213^\240>\217\334F\300\326\220\323gMn\341\f/\222O\232"
+	.ascii	"\265\340\250\365\222*\214\257\bcHW\262DBh\016\370@\035#\264\224"
+	.ascii	"\320\317\253B\021\255!\216\230\265\b\007\023\275\366t\216\304"
+	.ascii	"b\021\236Bd\313H\272go\005\252fR$x\177"
+	.text
+	.section	.gnu.lto_changePidProfile.147.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\273\001e\021"
+	.string	"\326\337sI\320\322(\035\212\374\276c$\324 \321\340\241\363\310E"
+	.string	"\301\013\276\006\\:\351<'#1\333}9\017>\270?\372\313h\2557\016K\036g\326O0\202\266\272\370\202\335,\027\350L\351\222\243\250\317(`\242x\234O\210\224)\005["
+	.string	"Z"
+	.string	"c"
+	.string	"\216\261\277{\377l\253\332'\016`\267\311x\347\274\351\271\315I\232x\201\310=\303l\035'k\263dG\207FF\2209'\270,\016{\267\n\363\317\363"
+	.string	"#-\366\256\304\267kPd\343\307"
+	.ascii	"\332\254+P\323b<\317\025\004M\246\n@\302\234\323:\322F\334\336"
+	.ascii	"mO\260]\301\326\003\001\372\261\245t\3577\033\334\013\0243\232"
+	.ascii	"\364\332Q\321m/S\352vc\270\\\211\233\351\221M\312tW\330\357\346"
+	.ascii	"\342\330%\365\247j\323m\177\247j\365\324\027\2606\034\263\035"
+	.ascii	"\027\233#gM\022\322$\362n\350\330\276\337\3632\3461\034\241&"
+	.ascii	"\347\3066\347<y\037\033\3460|b\203\203qjZ[\003\212~\364y\376"
+	.ascii	"\020?@nB\212f\033\363\267\376\320o.~\2167\240P>W\300\303\250"
+	.ascii	"\314\005\365xy!\227N\2506rx\215T\227\003B\320i\254ZaX\272\367"
+	.ascii	"\355\313{$R\370\020\221\013:a\332\373\234\001\315\250\314\001"
+	.ascii	"\r\351\326\356\360\0312\bjs\316\007\376\317\201V\374\234{\026"
+	.ascii	"[\002N9\251B\026\360%\245\025\252\224xX\251\\\024V*!K|YP\205"
+	.ascii	",\004\234:\265B\226KL\201)\026\350\nQ+`\352\345\002\236H,\262"
+	.ascii	"\254^\340\213(\276\300\217\234\371\342Xd\207\t\242\231\225yD"
+	.ascii	"u\355\013(\tf\033\363W\327\204f\310\227D\205m\350\303\215L\223"
+	.ascii	":\003jc\310\340B\"\222m\314#\001% P\202A\312\316\016\265\304"
+	.ascii	"P\264X\251\031a,\177\244\255\007$\322\034b\220\275+\360\366\240"
+	.ascii	"K!\271\235\205\306v3\246\316\340c\023VK>\360fy\225\223\246\t"
+	.ascii	"'\322\370]\221\0300\252\r\306\304\212\027{\360\240M@16j\204\357"
+	.ascii	"\016\355\250V\234\354\334\274\235)Z\206\002"
+	.text
+	.section	.gnu.lto_isSystemConfigured.148.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \306\305\005"
+	.string	"\004\nm"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\354\233\266\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\314\267\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\357\274\001\221\216\217\266o\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\b"
+	.ascii	"W\b\230\347\220\255\202w\r\027\214\030M\210\034\356\034\254\235"
+	.ascii	"e"
+	.text
+	.section	.gnu.lto_setRebootRequired.149.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"b\21515`m\322\001\260\001\227X\020o\370\316qO\352]#q\376o\303A\372\272v\035\226\240\236\035\212\240~\252\302\264\3050\f\006\001\331\3764\f\007\377O\310&[\246\024\216\226\004\314%##\214\027\230\301\034(\300xi\240E\300r\001\341\202\fR^\320\332\366\323\272\017@I\310\250\343 \\\3515\224\335\340\240\237V\220\225U1\211p\231\377\r\345\207\336\261\3613\374\300\321\317?\237C\375=\217\021R\005\307IGK\366\226\251\263\260?\255\373\330\223\024y&\264\207Pv=%\322\216\236\bd\373\2261\233\344\033\306\016h\210H|\244\354.t\027\307\256\230\377\215\007L-\273V\006\273k\235\032\305\355n\233\300v\201mP\t"
+	.ascii	"3C\347\004F\374\371\356\030\013]\303\347B\030/C\200K\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_getRebootRequired.150.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016\260\2468M\214\345\tT-o&\355\374\255\271P\273\225\302\232\375\273\035^+\230\212/\036Kd&\033gZ\360L^\251@\354\320\270\305\275e\nO\027\210\fFCMm\3024M\306!\242M\325D\273\030LI<T\215\202\242\252f\311\262\030:<\360\340\347\033R\221u;\256\330\\\257Jw\023P\351p \303s\243\317:\207\032_\200\304\320\177\037\022\250\214`\025\231d\202F+Y\"\221x\374\234\267\254\260\300\331j\306\001*\3708\261\020I\311\314\032n\324\352Y\267 m\370\210P.\254\323\023`\310\314\357\3020:\366O\370\021\376\213\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_CSWTCH.52.231.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.part.0.265.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"\275\t"
+	.string	"FP=:0\345(\035"
+	.string	"."
+	.string	"m\007\206IsV\211ZP\334\206\037\026T\377\247`\3020T\210_\t\266=\3201,\030s\236a\n\b\034\204C\350\320\316\203\013\304D\210\202\361\311\226;\245*"
+	.string	","
+	.string	"."
+	.string	"/\035.\341\356\316cJ\362\356\032e\347\307\257\344]\017^\301\304\365\225@\036\r.\003:\273k\201\220\033\273\355\006\333\013\366\023\0021'>\313Y\242\267\3702\241idw\277:\030\372\212\tDfPv7$\272\2572\262\263\354\330Sl\217>\334\3314_\225,\202*>\270Y\200whm\370\342P\317\233\350\26324\342?\237\365\007\230S\315\213\244^\324\224U^\256\242lL\252\\\005\246]\217"
+	.string	""
+	.string	"\366\204\005\3268\022\037\017h\323\246\346\231\240\017\004\305\324\270\213\3119\360V\021\301M\214m\343ff;^\256\242\334\331P\222j\312\006'6\255S8\020\031\036\032"
+	.ascii	"5+0~5\025H\203\303P52\225\234\350\274\017\020\005\303\\\341\264"
+	.ascii	",n\026\361\210\020\264%d\251\306W.\333\231bf\343E\311\320\031"
+	.ascii	"\312f\336N\013\300\265w\024\226\231\315?\241\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\276\t]\036"
+	.string	"F\260\252>`\252I:N\345\315\327\370\204\260\025\277dP\255\241\363\327$\374O\221P]w`\"\202Z\275s\222\030{\326-,,\346[\252\245\216/\322\250O\031\021#\035\336\005\360\332(\335\206$I2\231"
+	.string	"\226"
+	.string	"\230"
+	.ascii	"\353\250>\222\342\242?\245E\237\n\213\276\224\025\375(*\372h"
+	.ascii	")\372PP\364\237\234\350;\031M\364\233\224\350/\251ei\222\350"
+	.ascii	"q\311\310u\304N\022\321g2\2068\034\020\177\363\341n\200o\343"
+	.ascii	"\341c:\\\f\207\257\rXs[\264\241\237d\254\032\336(\303\275\350"
+	.ascii	"\270\336E\307\305bQ\023\206\276\222\013}\242\205c\321U\350\233"
+	.ascii	"\024\372G"
+	.string	"\306\262\262M\350\237\215[\3273\365<\301\255T@\353_n\236e\355&\335\356\356jYV;\273\275K(\312\237j\255\025\253\217d\334]\036[\375\266\237\365\303\274\366\301t\177\217\221~Z\221\376I\244OfH\277\214\220\276\231 \3754@\372j~\364\321\370\350\257\351\321W3\353\263)\353\237!\353k\341\321\337\262\243\237EG?\316X\237K\216\276\034\034\3759b}:a\375:7\372vl\364\331\206\375;\257\265\356Z\025\301\372x\376\265\227\274\326R\215\315$\334\271\256\345\244\333\rBfVvcHc;\351v\273\314\272\274\314\276\312\276\310f\fw \330\233\304\031\257:\031\375+1\226\222\016F\337\312\213~\225\351\003lA\264o$\017\317_\025\325\322\257\244'q`\347\307C\211\340\322\263\215\344\032e\217\344\252\364O\230\334D\n\222\034\225~d\004IN\220\344^\372':h\350\302\221\314CQ\022"
+	.ascii	"\261N\332\362!\031*\335>$\203\231=\366\241\337\266ZkV\217\243"
+	.ascii	"\320o#9=a\264z\314;\265z|\205\305\343\036\232`\231w*X\346\231"
+	.ascii	"\013\226\241R\006\313Ph\203e\250\323\301\362.}\260\274C!,\357"
+	.ascii	"\316\b\3137%,'\351\363A\322\207#\366Q\263\377v\244\357V\006+"
+	.ascii	"w\200\311\362\002\024\021\r\001\r\360\016\005\362SB@>\372\237"
+	.ascii	"\231\223$\267\205\200\203\254~VV,\374\347\322\212qRU\202\252"
+	.ascii	"X\270TT|\205E\345\233z\233\n4\305@\037\001\376\371\343\227?\026"
+	.ascii	"\376\230\013\320\217\257~R|\301'\305\302\225\342\233\353\307"
+	.ascii	"\307^\033\347c\256\375\343c \351\343\2771S\364\\3S\364T3S\364"
+	.ascii	"Tc\246I\203\351?\007\022\2265f\314\257\246Jhq\023\266H"
+	.string	"\376\030\223\302\305\234CN\037\250\216\324\215\344\261t\354\0343\305P\2613\rC\203$\207\231\303\200\256\250Q\034\b\232j\024&)H\2461\020\003\231!N\007\021`$\311\224c\242\021\021\021\021J=$\233\230\311\362\233\200\271`#\004(&\225#\200b7\300\020\36631\344\301OG\235\257\203\r\260H\312\331\263\331\f\346\366\330$G\225\227b\027\355\207\266\243\312G\262\307\343\240\360\303Q\336\366eAX\336\241\271/r\355\361\321V-\345e\262\242\362\212\225\033a\214\004\323n\200\017\371\302\371\222\306\004\273~\327\207\202\251Y\325\364\030\3725\2237Bn\261\013\345R\271T*\225J(}\312:\226o%U\025\005T\004\225\327)7\272-\277\256\3438\216\3438\216\3438\216\3438\216\3438\216\031\276\216\375I8\214\024\006\024\002P\327B\353`\306\300C\231\264\277V\352\301i\236\251\026\201|3B^F\001\216"
+	.string	"G\201U=\020G\263\263\221\236c"
+	.ascii	"\346\221,\233\356,\203\336\232\226\373\361\252\357\372\013\341"
+	.ascii	"\240\273\022\t\356G\017\240DG+A/r\212\246\021a\312\233\235A\351"
+	.ascii	"\252\237/\376\006\276\n"
+	.text
+	.section	.gnu.lto_.refs.eef8e8b12ba3aac1,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"e\t"
+	.string	"\306\327A7@m\2224\006\017\257\262@\024\271\021\340J\272^\027VEq#\027EQ\024EQT\333\253L\026\365+\376\210O\377O\312\265\372\377\366[\263\337\304\0201\373\233m[\246-"
+	.string	"4"
+	.string	"/"
+	.string	"i/\226\265\244S\332\2124JW\322R\244\237\364$m\245\227\002\020ph\2052\212\305x\276x\306Ljr\2568K\251\372\354\355\312\243\020\031M\275h\252\005f\323\305\025\231\021f)\231\237\314\303\274\210\354\301\331\035\252\346\260AC\006\f\373\005\313\226Xn\220f\200\226\004\035\202\376\260x\003\275Ic\002 2\366\207\214[@\273\002\032\002\372\001Z\007\350\022\364\202Z\222ZA=R+R\207\324\202\324\037\265\036uG\315Q\273Q\017\2507\030k0\016\017T\202\032)\004\216\201\022\251U\210s \013\354@\366\261\226\232\342\364p>\316N\252\326\326\341\334&\307n3\002\373l\026`7A\202\306\213\240\361\023&J\220\030!\242v\210\016"
+	.ascii	"O\\\361P\302A0\020\322\022\3073\030J\300\b\b\004B@\\+\330\007"
+	.ascii	"1\021S\016\243X\252\f"
+	.text
+	.section	.gnu.lto_.decls.eef8e8b12ba3aac1,"e",@progbits
+	.ascii	"(\265/\375`\263x\205\347\001Z\030[\255U \fY:\215\001\354e\375"
+	.ascii	"\245\205\025z\320\304^\366\330c\203D\304\260\207&3\272\366\371"
+	.ascii	"\316\027\246\273\217z\212\2253O\366\320f\271\243 `\364[Kd\364"
+	.ascii	"2\233\347a\243a\363XX\374\354Rt8HV\303,\225pZ\221\306\343\f1"
+	.ascii	"\253M\356nrK\231\002{\t\366\n\036\013mL\243&j\004M\362\364\344"
+	.ascii	"G\231\240f\350\031\332\004EC\227\240J\256\023m\242cmC\330\346"
+	.ascii	"\210D\301\"6F\212\021\332D\303zLi\242E\232\230Fxc\305F\306\336"
+	.ascii	"\336M`\r,,7\240\374\243dG\223 \371\300\316\240\261\236\242h\340"
+	.ascii	"\214\226e\032\\\276\302p\276O\226F\217\030\035%\263@\312\225"
+	.ascii	"7\234\325+\224\336\347J\337\247I\277'O\277\007\214~O\025\375"
+	.ascii	"\036\247~\217\021\375\036/\375\236\034\372=P\372<q\364y\236\372"
+	.ascii	"<a\364y\260\350\037\355\301\201~\202c3\343\361\225\271\240\225"
+	.ascii	"\001\202\363\177t\007\352u\235\350\027\332u\354\274q\307\315"
+	.ascii	"\275\323\346\320/\224+\n\372\205\352\300V\267\316\307\316.\254"
+	.ascii	"\304T\361\364\0211{\222\346\363|\351\363\300\320\337Y\243\177"
+	.ascii	"4\307V\f\256,68\377\350\026\212Cg\013\032\223\031\316\250\226"
+	.ascii	":v\343\216\r\347\357\200\321\027\001\026\365$[bg\006wa\0376\230"
+	.ascii	"mhe\236FV\344\230sF\344<\311\224\334\221\231\241a\366\310z\336"
+	.ascii	"\347}\263\245\213\307\215\347\215\023\307|^8Z.\337\323\224\253"
+	.ascii	"\033`\317\260\2619\317.\257\255!.\236\370\nc\225\341\025,\244"
+	.ascii	"\254%I\303\304\021\204y\371`\254\221\235\235y\3366wo\205\234"
+	.ascii	"\023\031f\314(YaL\276(4f\333\017\2540\"Pk3\2240\257h$\301N5\220"
+	.ascii	"<\215\356p\023\374\2066\335\032\340D\367\f;\022\007\2071_<\271"
+	.ascii	"|8A\262\367\354\022\242&u\245%\344\362\275\200\302\304W9~\\>"
+	.ascii	"\251%\317\313\207\357n\037n\362a\002\332\373\213\ns\357}\021"
+	.ascii	"?\276\302:r0/\237\213(OL\006\217A\235\320\030(\025Z\205\237\350"
+	.ascii	"\024\n\205\305\340:\234\006\263AW\240\033\257\301`\320&,\007"
+	.ascii	"\307\301|\250\013<\2072\241R\270\r\312\002\227\301xX\017\253"
+	.ascii	"Aa`.\330\fj\205^\2416p\037\376\202\275\340<\364\006F\203\367"
+	.ascii	"\320\027x\016\266C\243P\032\370\r\016\203\335\240-\320\031\250"
+	.ascii	"\f\364\t\315B\2610\034|\006\323\2415p\227\353\304w\030\313q\026"
+	.ascii	"\034\027&\006\203\331V\205\013S\316\217\273\276\264\236\370j"
+	.ascii	"\013\310\363>\361\035\326\202\345\320&\363\0045.\317-\377}^6"
+	.ascii	"sL\274\377\362\265h\303deo\236\227/\306\2123\034V\244\357\211"
+	.ascii	"\005\b\0253.H\230)\346\345\203\372b\203\303V>M@\373\311i\356"
+	.ascii	"\312\226'\356\272\303;\276p<\315~|u\207m\250\211=\367n\022y@"
+	.ascii	"\311\334r0\335\235\177\274\345X\356\277k.\336\205\343\0012\343"
+	.ascii	"\212\016\347\253\304\350x\313\217\035\225\2740\234\277\023\247"
+	.ascii	"\325\347\035J?\347\n\245\337a\323\3371\323\337\t\242\277\243"
+	.ascii	"\245\277\343B\3778\355\370\355\307M\314\004\273].\240\f-U\246"
+	.ascii	"\340L\205\b\235\363b\312\031\316\337i\322\377q\033f\303Rp\224"
+	.ascii	"\353\304S\360\332q\bN\256\032\332d\252O\274|<\361\024\f\005["
+	.ascii	"\241M7\335\302\t\344\251v\325|\230\200\266\223\335\017\021x\n"
+	.ascii	"~r\325|\230\232\233J\304\0322\"e{7\177?\260\360\354t\362u\306"
+	.ascii	"\350\353\324\351\353t\321\327\231\323\327\331\242\261\323\350"
+	.ascii	"8-\357pCE\004\347\254\203E\337\347\035J-\270B\351u\322\364u\204"
+	.ascii	"\350\353p\351\353X\351\353l}\340S\0378\247\017tj\016\300\"\372"
+	.ascii	"@-}`\013}\235\247\257\305\350\353+\372:M_\007\321\036\\\241\364"
+	.ascii	"\232K_\313\320W\373\364\3253\372j\026}\225\211\276:D_\345\241"
+	.ascii	"\257\312\320WW\350\247n\364\233W(}Z\247\237\276\351\247M\375"
+	.ascii	"\024L?\325\241\237B\351\377\236\372\277.\372\2774\375_\021\375"
+	.ascii	"\237\016\375\237\013\375\354F?\333\351\273]\241\364y\212\306"
+	.ascii	"S\230\352:9\300U\307\373\316\375\327\324\334\315\275\233?8\210"
+	.ascii	"\034(N\234\237\325\364/\007)\332\327w9H\237\231\372yK?3\351\243"
+	.ascii	"e\364\321,\372h\231>\372\245\217V\351\273\305\321\217\273C)n"
+	.ascii	"\372\357\234\273\345\252\261b6\234\340\214\267\3211\223\033\026"
+	.ascii	"\026qp\306n4z\205\322\327\335\241\364\370\214~\335\025J\217\271"
+	.ascii	"\350\343(\372\346]7\327It\365~\356\027\247)-\234\217\235\272"
+	.ascii	"\004\373\022\245\357\273D\351q\020}\034C\177\355\016\245\300"
+	.ascii	"+\224\376y\325\\2;A\354\260\270\301\371\"\350\342\332\256t\211"
+	.ascii	"\3232\207%\013\227-rrs\\\266\3747\314\025s\307\\\273{w\317\\"
+	.ascii	"4\327\314-s\301\3344\327y\311\334\272_/\367\313o\363w\r\n\031"
+	.ascii	"'O\3120\227\240]5\037t\357-3\314\275\233\017\3417\372?\b\341"
+	.ascii	"\222\271]\256\332\255\3032@\022-\317\275\233\277Q~#2W\312\265"
+	.ascii	"\262\301i\357\246\254\fvr\250\316\366\366\336\036\210<x\360\340"
+	.ascii	"\301\303\316\213\274\0324\210\362\335w(\005\272B\351/\235\376"
+	.ascii	"\245\242\177\317\364/\021\r\324\245\211\356P\372\033\2459\334"
+	.ascii	"\241\364$\320\035\356Pz$\375_*\277V\376\313v\333.\334\007\366"
+	.ascii	"~\332{gH\241\236\272\306p\276o\267\312/\334u\333\027\016\004"
+	.ascii	"\256\275\233"
+	.string	".\334O\234\275\233~\356\305\340^\fr\022/\261(i\276\t}\247\030\375R\021J\253\260\232{m\357\375\203\222\261z\233\201\363\357\n\245'\241=\270Ciz\205\322\021\356Pz\b\350\223\271C\351\025\240\377\274C\351m^&\327Y\301M\373\007!\034ej\262\315\366n\376\364\314A2\207\017\347\217\240\177\233<\303\227\035\302\211\364o\005\351\355\273\025\244\307\372{w(Ur\315*@\241\242\270\366\332\336\315\240\237&\r\251\0358\277y\207R}\205\322\037\035\252\360B\341\367W\177?\312\304\331\342\3172~\024\002^\230\240\225\340G\317\360\257\212\340\317RTer\033N\364\253J\024I\256C\257\361\031\350\236v\n~\025\005\006\261\302\217A\240E\220~\264L\356Gyd(\327\371\325\341\217\232\310Z0@\\\377j\003~tx\340\257\0063\022jB\013\005\333\300\217\342\310_\252\nxNvBMd-t\353"
+	.ascii	"\350\220\007\224\025=v~u\002\277\273]\336\242\345\277L~\314\001"
+	.ascii	"\356\200)\370q\006yD\334\177\331\374X\350\0029\313\177\365~\234"
+	.ascii	"\377\273\367_\276\037\253\367\371\343\364GKd,\250\0036\360_\002"
+	.ascii	"\031~\274\301\003\220\257\374\031n\001o\300\237\276\301p~\254"
+	.ascii	"\367g)?\212\365\2436~4\353\317m\031\003l\177\346\300\217\361"
+	.ascii	"\242\374\367\305\177!\360c\265\037\345\001\345\307M~\034\367"
+	.ascii	"\243\036\310k&\320\021\\\347\177\223\374w\355\354\277m\177vr"
+	.ascii	"\037\360\337\t\374w\351\277#\376\213\374\357\375o\323\177\275"
+	.ascii	"\377Z\3757\371\337\341\177=\360_\020\374\027(\227\370\321\005"
+	.ascii	"\250\375\031\004i?\246\201\231\262\363\317!\370Q\0064\371s\n"
+	.ascii	"&\177&\301\217&@\001\315\037s\340G\243~T*\243\375X\001?N\300"
+	.ascii	"\237\227\374\230\004\250\037u\221\317~l\224\201l\366\343\347"
+	.ascii	"\377\f\377\003\300\342\307&0\005\376s\240$\217\375y\310\237\303"
+	.ascii	"~\234\365\022\374*\360\317\032\004\371"
+	.string	"o\327\365\372\321\td \035\374\371\207\217?\207\030@\217?\023"
+	.ascii	"5\241u\267\320b\346\201\343\353?\230\007\340%\276\341\317;\376"
+	.ascii	"\334\365\017\376\364\311\217\232\320\372Q\025i\336\177\237\344"
+	.ascii	"\033\027\350\356\277\235rL\316ZCp\365O\355\376\203\371\037\346"
+	.ascii	"\277\230\377_\376\243\371o\346\177\231\377d\376\333\375\277\373"
+	.ascii	"\321*\377\341\376\363\374j\017t\31562\326\377\237_\325\373\263"
+	.ascii	"\317\237\201\376l\341\317;\377\363\2579\370Q\274\037\335\373"
+	.ascii	"Q\275\037\315\373Q6?\352\346G\341\374\331\202\032?Z\367\243k"
+	.ascii	"~\364\371g\241?\323\370\377\363\353\001\374y\306\237\255\376"
+	.ascii	"L\365g\251?\303\370\263\213?\267\370\363\212?;\375\231\351\317"
+	.ascii	"%\370\363\322\237\331?\257\360g\244?\257\177\036\3769\370\347"
+	.ascii	"\016\3749\003\177\256\300\237)\360g\b\374\231\204?'\340\317\b"
+	.ascii	"\370\263\001\376L\200?\217\360g\243?\207\3703\210?s\360\347\r"
+	.ascii	"\376\314\341\317\026\374\231\202?\013\375\250\234\037\345\373"
+	.ascii	"Q\270\037u\376(\223\037E\373\321\263\037U\362\243H~\324\310\217"
+	.ascii	"\026\371\321!?\352\365\243b?\n\366\243?~\264\307\217\356\370"
+	.ascii	"Q\256\037\335\372\321\254\037\215\361\243U?:\365\243/~\224\305"
+	.ascii	"\217>\375h\323\217\356\037%\301\217\216\340GU\374h\212\037=\361"
+	.ascii	"\243\312\037\r\301\217\036\177\324\370\243 \370\321\365G\207"
+	.ascii	"?\372\377\032\177\034\347G=\360_\255\037K\375\330\306\217r\340"
+	.ascii	"G7\360\243\031\370/\320\217^\340G+\360c\r~\264\304\217\222\370"
+	.ascii	"Q\n\374\350\004~4\205\037\205\300\217:\340\307 ~\264\001?\312"
+	.ascii	"\200\037\343\375\350\002~T\001?j\341G\215~4\304\377\264\037\275"
+	.ascii	"?\356\373\361\234\037\313\371q\335\177q\3748\353\307-~\354\364"
+	.ascii	"\343\341\217\205?&\361\343\023~\034\302\217;\374O\341\307\033"
+	.ascii	"\374\230\350\307\027~\f\374\357\224\377\362\370\357\327\177\267"
+	.ascii	"\376\247\371o\366\037\352\277\334\377\r}}}}\277N\211\177\303"
+	.ascii	"\005\277\n\036\004APi]UPi]VAPiMVP\233k\003A5wT\355f\027S\020"
+	.ascii	"\214\264&\253\235\306e\025\264\323\272\254\240\304\360\351\320"
+	.ascii	"@'\304\353\306\335S\021\263\353\005\352iOIi5U\001\325A5\2716"
+	.ascii	"\231\275\357\032\213]\265\353\366\006\300\336Z\\Ud\232j\\7\247"
+	.ascii	"\272)\247\266&\256\333\334{k\220r\362\342\332OuLw\327A\215q\355"
+	.ascii	"=\346\224\264\245\366\336\033\004\246f\335\376q\353\230vh\355"
+	.ascii	"(\026{O\260\233{K\355\315tw\335\336\233i\357\255Vi5\367\316\002"
+	.ascii	"\202bJI\355\215E$\265\265\230\336X\354\215\327\314\270YA\245"
+	.ascii	"yq\031\2759Ic\356\026M\246\013\025\305\265\231\233LW\225Ncb\262"
+	.ascii	"\243\366\336\227\215fZ]\341\341\234v\371\241q\346\213\r\316\337"
+	.ascii	"@\016\327H\262\306\b\316\251\234\017UX\2169\234\277\001\025\235"
+	.ascii	"jA2\346\225\004\347o\300D\247Y\330\2708\341p\376\006F\232;u["
+	.ascii	"\202\274\3019\265\0226\306\027\005\347o\340\243\271\343\266\005"
+	.ascii	"E\006\316\351\233\216\326\333\334\035\316\337 K\247T\200e`W="
+	.ascii	"p\276\006}:\225\322\263$J\233\260g\224\224M\333\275\371\222\223"
+	.ascii	"\213\262\201b\330\340X\303\371:\323'i\363V\335\275\331\302\250"
+	.ascii	"zL\274\254y\222\252\371\270\201\221\227\005\347k@D\247i\035\322"
+	.ascii	"&\300\247f3m\357\346\317\005,\262)\234\257\301\017&M\314\325"
+	.ascii	"$\316\n\234\321\210.\215.]pp\276\006Y\351Yj$=\2022\251\222\300"
+	.ascii	"\n,%\251Y\272\344:\323\263\224\354iY\212\344\371\362\245gi\021"
+	.string	"\033\351Y\232\004\316K\214\210\216\031;8<t\276\006.t\312u\207\322\203\271B\3513\200\243\323#\377\345K\307~Yx\203/9z8?\2034:\335w(}\006q\372O\207\374:\323!\251\330\210\2737\025'\216\347\336X\037t\276\200\200\365\341\374\f\316\364\2372S\261\273\315\320p\203s\230Z\204l\253\f\347g\320C\377O\205\244>R \351\2174\310u\246`i\215\247X\327\tXj#\355\261a\305\336]H\322\261\250#\317=\260\224\006\266\332\260bo\256\255Tk\213\214\034f#e6S\260t\306U\333\340\264\367\026\216t+\352\310s\017,uJ\2576\254\330\273IIJ\204H\215\013\354\311\223yh\340\221\023\023e\343\374\f\256\364\216\324\353:\323\257T\253E\332\2056\3354\025/\027\317\364+}Jo\3704\001\355'/(\346\336[\203\007\017:x@\262\322\254\203\250\247\007\227\221\0348\037"
+	.string	"|\372wn-\016W\272u\235i\216\024GZ\232#CA\347Bp\023u\344\271\207\276I\343\362L\363\001\220\246\017"
+	.string	"\246\376\323\254\2477\320\271\313\2653\354\\\325\225\261\201\363\007FO\263\3222+:\336\340|"
+	.string	"\340\320>W(="
+	.ascii	"Z\350c\020G\037\0035\372\030|\32114\244aa\340\\\301\371\030\264"
+	.ascii	"\351\026\351\324\255\363\221\347\310=\255R\252\353L\253R\026"
+	.string	"iU\372\224\256\360\371\355\335\264\205\271\367\366\240\301\303N\216\035V.\322,\265\247\305\215\r\347c@D\377\316\255Ia\262\241s>\277\275\271\246\2440\322\250\324\305u\246/R\250\364E\206\202\316]\254( qe{o7\3177kt>\207=}\016k\3649\310\351t\305\321\271\253\306\260\302\244\n\316\347\220E\237\003\025\375\247M)\323O\017\272.R\232O\333\315V\272\211z\316\304\341\322\245/\207)\301\342\265\206\363\377\233#\247\270c\b\022\234\343\350\240\321\222D\f\347s0\242/\342\371c\343\363\004\264\237\274\2700\337\374\324t\331\373\351\375\334\374\340\374\370\256\363\367\346\327&\313\311\373\261A\231T\351'^e\236\2777\277/\2770^d\236o~b~i\320&S\303p\242K\2357\354\244\360\344s\020\242\317!\306\232\037\036\220+\313\331\204\3639\274X\303\301I\377\0026w<4\232\254\241\201\363/"
+	.ascii	"s\346g\346:\177h~d\232e\2640\321\374\306\024\300i\316X\331\317"
+	.ascii	"Yv\325\227\346_\320D\377\202\"\372\027\374\320\277\300\353\007"
+	.ascii	"&\016\335\230!8\377\202\032?\273\013\244\364\377\363r%N\0343"
+	.ascii	"\234y"
+	.string	"\3341\177\250\375\334~V~r\277\346\017\313o\313o\356\027\367s\376\352~L~i?\272\037\334\217\313\317\311/\313\357\311\357\312/\312\357\3557\345\247\345\307\366\203\362[\373Q\371U\371\265\375\232\374\244\\\347\257\313\357\354\277%?\264 tX\274\366\230\230,G\034\262\2567K\212\\5*q;\356\336\255\3032@\231\232'\230\0168qbr\317\025[r\200\224Ea\016\321\202\311p\3141\"C\221\260\021\021\361\353\362S\3623\363A\367\336\201\206\207\004\212\223\261\2536e\216\271\345idD\312\021\024I\3333l\356\351E\210V\237\2173[\276\3220\223\254\375\272\374z(\300\f\315\257\313\217K\025+\242\207G\004l\022V\003m\001\031?\357PZt\205\322[\220F\377\314\256\232Z\244o\n\017\347[@F\337\002,\372\026\244\351[\200D\337\002,\375\n\372\364+\270\323\257\340M\277\2024\375\n\220\350W"
+	.string	"\246_A\017\375\n\266\364+\230\241_\301\n\375\rw\372\033\256\350oh\242\277\341\207\376\006\034\372\033\254\36470\351SpF\237\002:}\n\244\350SPD\237\002\031\372\023\304\321\237"
+	.ascii	"\214\376\004O\364'\b\323\237@\206\376\1777~YYx8\230\340l"
+	.ascii	"#\325R\365\034\203\363'`\322\377\1774~3~W\277\030\277\032?\031"
+	.ascii	"\327\371\303\372U\345\037\326/\3527\2052\251\322TV@9YE1]\300"
+	.ascii	"\370a\375\250\360^\274`\376\260~0(p%\366#FoM\213O\276\2067}\r"
+	.ascii	"K\3645\f\321?\251\233\366\344\007\037\316\327\220\245\257\201"
+	.ascii	"J\237H\216>\321\031}\"+\372\377A\375Z\\\261\272[\203\363o\305"
+	.ascii	"\217\305u\376Z|\367\354|\271\2555\341\234b\357\275\357\257\244"
+	.ascii	"\352\257\244\377\357\211\017\250e\005oK\314\217\274\254wC\004"
+	.ascii	"\231\034\3140@\344\224\311h\354\266\274d\276<&nMn\343\244\305"
+	.ascii	"\227\357\3623\006\bE\340\274\346\354\375\366\317)\317\3711\345"
+	.ascii	"\276\034'\313\3715]g\346\313{\317o2\234\347\346N\363\252\234"
+	.ascii	"\314\261\220/\327\035J/\\\241\364DE\354\262\033\2571.\0348\237"
+	.ascii	"\350K\237H\013/\263\321`jsNp>\221\025\036\021T\232\254\006i\f"
+	.ascii	"J\223\2754w\332L>\363\003\243\345\311\025\234\237\201N\233\311"
+	.ascii	"\200E?CS?\203\017\375\f4\3643<\201\261\263\373\342\005\230\266"
+	.ascii	"\203\311\205\227:\354\225\345\211\025\234\351\360\031\023T\036"
+	.ascii	"\316\307\240\247\3472\226,7\002\213*\340\224\227\334s.[Q\322"
+	.ascii	"\345\306\315^\227\314\345:\363\\\276B\244\271\240P\261\245\371"
+	.ascii	"\317r[\342\340xQ\206\263\026 \017\036c6\316\3070%.g\311S\250"
+	.ascii	"\366\017\234\217\201\211>\0063}\fb\372\030\270\364\237\341\252"
+	.ascii	"\004!\323#\f\316\177\256\222\337\306\330\362\216\340|\326l\253"
+	.ascii	"\002\367\224\302\371\"\242Pe)\271-O\311n\327\231\251d%\271\271"
+	.ascii	"w[\034\024,9l\247\342\363\004\264a8e1\315\250\344\265SA\231T"
+	.ascii	"a`ag\343\271\367\306\\\262\272D\351\344c\320\322\307p\245\217"
+	.ascii	"aJ\037\003\224\376\363\023'=p\320\370\210\340\374\377Y\215\207"
+	.ascii	"\253j?\341\215)\243\206s\032Q\352\303\r\224\023\316\307\260\365"
+	.ascii	"\377\334\314Lr\223\353\314\316\214\204HD\2313\223\001y\232eg"
+	.ascii	"N\222\32168A\355&/\r\214\f\321\223\261\347\301\207+\r\2240:\377"
+	.ascii	"\031m\tZe\016\336\032\234\317\232\351\230\017<8\234?\304F\377"
+	.ascii	"\277\316l\226\22547\021\276*\363#\r\316\037\022\243?T\247?\024"
+	.ascii	"\247?$E\177(\355\310\030O\227(xg8\377\316\001Ab$\027\311D\256"
+	.ascii	"3\217\345!\277Ar\230\006dLz2\366\3062\323\310\032=\031\036~Y"
+	.ascii	"v0)\323\371CG\364\207\204\350\034\2063X\026{\016\313B\376A\b"
+	.ascii	"\347y\312ay\357\246{1\360\271\027\203\337\025\260&g\232?\304"
+	.ascii	"C\177(\206\376\0058\372\317?|\250K\244l@\341\234}\374\271\307"
+	.ascii	"\225s*\030\323\255\331\332\303\231'\363\310_h\334\362\316pn\256"
+	.ascii	"\355\275\211t\324\326\336Z\340|\021YY\013eR\245\243\364\b\362"
+	.ascii	"\354\312;\2563{e\034\317\315\354\225\267\262\216[\267\266\233"
+	.ascii	"\2564\310k\"\306\215\310CO\224=>\032i\316\221\271~`\200\265\b"
+	.ascii	"\202\363/\230\351\034\027\206\350_\320\322\371\006\216\241\006"
+	.ascii	"\304\005\316\277P\245\177\301\205\376\263\r\254\237sK\222&\234"
+	.ascii	"3\215\\\343:3\326s\023\256\235\266w\263\007m\242\301\205\n\316"
+	.ascii	"\277\035\322\237\276\276\276\276\333!\375\363\214l\005t\342J"
+	.ascii	"\302\207\363EL}\235\311V9J\355N\n\r3W\345\253\034#\313\270\316"
+	.ascii	"l\225\251~\331n\333S\\\266\31206\323\032\020\270x!#\362c\273"
+	.ascii	"\261\247t\362\205\344\350\013\235\321\027r\323\027\022\323\027"
+	.ascii	"\202\241\377\374\"/\265{\242u\005\3471H\274|Ac\032\2019\303d"
+	.ascii	"V\272\\qr)\023Vg\007\305\013]\033\223\214\030\023\215\035\020"
+	.ascii	"/\\\250\270y\351\"\345i\267\204IV\205\214Y\\\334S\016\226\271"
+	.ascii	"\247\031!\327K\0268:\346\034\364\211\362\241n2\213\274\002}\203"
+	.ascii	"\352\241p\320>TNn\312N(^\206B\343\344\026\350\032\224Mv\221\231"
+	.ascii	"\362\023\272\207\266\311\373:\321<\364\356h\032T\r\232\207\236"
+	.ascii	"\361\n\"&\311\323\013:\347\265\366\334{"
+	.string	"\033\2051c\222\345\241o\330\312\247\251\271\253\016\020\203\314\255l\357\346\332W\026)\0202n\336\241\264\303\025Jo\301N\337B\023}\013D\364-p\351[\210\241o\201\205~\220\033\375\2400\372An\372Ad\372A]\372A.\364\201\336\350\003\235\321\007\322\242\017\344D\037hL\243Z\320-\327\251\001\225\303\363\341d\205\363\201\204h\022\354}5\244\267\257\357jH\017dC\037\210I\377\347N\377G\213\376\017\024\375\237!\372?_\372?2\364}\344\350\037\245\302V\206\007#\n\347\213\020\262\366D\331P04\rm\272\001\331\234h\317\275\267\027\224\r\365\341\325\206\266\241P\320(\350\032:\005\225r\235(\033\252v\324\t\372$\016H\224\266\037lL/lh\020$Vz?J\314\030!\363\311\327\355\016\245\023X\321N\242\\\005\f\2208\234\357\343\324\277q\314\270\013\030\233\021 \017uKH\215\273\0348\003w"
+	.string	"w\340P\253\f@\006pk\013\330u\013Mf\035\260dt\370\2019\016\354\002\352\250\362\243\257\fP\007\220K\347\252\214\332\225\337\017\276\253\266+\377\201y\306\233\022.8\177"
+	.string	"L\372\007\342H\3552\024\033>\274\264\322*;\242\266\f\301\271\311CE\025\204++\235\242\263\231\246d\261\241\302\365\360}\335]\301\322[h-\332\214\324\320W9h\340\231\341\f\274\002^\001g0\247\364b\374\216\304xS\003\3128p\306\355\363\2426\327V\244k\005\033*VV*\222\245\0272\"\3078[\232p\276\bK\250\250\016\340EOFY\224,\346\027\316\027\001LJJE\242\322\230\302\333\362\243c\303\275\221\003\003\006\234)3n{|j\274\354p~\bb\200.\200.R;\254t\310\026\f'\316\017\301\212\006\266"
+	.string	"\266P{\\\2103e\306m\357f\261\261\006\007\347\207"
+	.string	"\005\270\002\270\302\247jj\f\363\314\206\030\023\316\017\241\b\320\t\350D\202)3neiX_t8\037\2048@& SjG\304\305\344\306'\306\324\030\346\336\n\0323\300p>\bp||\272\357B\026'1\"{TctP\346\\\367\375\330\264\300M\221\203\317\250\251\001FN\0340t8\314\264\2171*\020\320\332\274\215~s\233l*\"-WbD\366|\342$i\222f\357\372\r\032\344\305Y\224\336\177 \360F\325\0310zn\214i\31784\r\365\325\006+/%\353\241\301\"\311\023\234\017\202\217\273;\215G\304\305\204\007B\226\"bDz\200\314\bk\241\323\\\343\255\351\321\203\361&f\3153\317\265\301\bcc\363|\315\321\242F\315\257\212\202;\250\324\t\217\024/N\244\340|\020\256\312\224\321g*"
+	.ascii	"'F\244\207J\\\r93\327g\222x\275\331\230\372\017\fZ\301$\206\363"
+	.ascii	"Ah\0323F\006\016\343e\b\316\027\321&L\030\265\307M2\325#\353"
+	.ascii	"\253\354\305\023\234/\202\316\213\027\035c\352\210\2252\0364"
+	.ascii	"8_\316\276\\\333\365\344\251\325-\0211\205\216Ns\241@\2219cA"
+	.ascii	"hP\261\003\223\223\323\\\210\364>\373\212z\376`1\003\204\314"
+	.ascii	"\3345\227\034\366\343dD\210\024\021RY\236Ek\271M6\025\005\340"
+	.ascii	"\346\214\245a\232o\302\304]ky\034$hNp~\336\217\315\177`O\331"
+	.ascii	"]\030\0338\377\0035pp\372\n\215\251#V(\240W\003\215\266r"
+	.ascii	"}\345\003\247\024)\372\215\210\213\251\215\007hxdnw\305\n$T\372"
+	.ascii	"M\273\371\360\250\242V\246\3354\025\036^a`=[\326\274y\302YO\311"
+	.ascii	"8\240l\ti\203\363?\020\342\274\206\342\324l\252\025\242\355\364"
+	.ascii	"\264\267~\b\361M\211\355\355m(\255\016H<r\314E\271f\233K\373"
+	.ascii	"\324\334\272\256\221)H\242\340\254\237\\\257\375@uL\030\271&"
+	.ascii	"8\337\250\215\326j\327N~\340\357\306\325\2311\234o\244F\377:"
+	.ascii	"\355\007\362\370\230\353\202\207\363\215\312\350\033}\321L\230"
+	.ascii	"\370\310\220:3'\313!b\243\017\347\033e\271h\027M\335\2323\025"
+	.ascii	"dK\031\027\226*_p"
+	.string	"^\262\204\306\024\020\267\2367Oz0\337\230\231\335\261\251\036Y\332E\2252o8\337\003+I\222T\231\362\212\333\tS\246\226\003\347{\260U\344Et\331m\262\251\226odD\312\360\266|\355 \273.\003\202\345\355\001\321G\272d\305 sD\033!3c*\f\325B\341\356,\013\316z\fcA\267\200\305\261\301\371\036\320\0302d\247L\252\017/\nT\235\0273bbj\f\2519e\277\254*.e\226\374\370\017\rv\201\232X\035xf\374(\023\242\205\\\307\371\241%\005\347\347\351 \377\201*\2224U?\202h O5gM\2345\220\224\205\0065F]\226\026?z\364H\355n\223M\225>\243\216<\313\366\306\352\240#e\225\004\006\316\017\221\245\273t\227\376\"\342br\223\022\221\202\023coo\254\016\350S\027\034_p\376\365\216\353\257c2|:\336p\326^\330\352?\320\007\007\224\262\031m\270\270\264"
+	.ascii	"\237n<\254p~\221\235\3765\216_\343\320[\016\240\332a\372p\243"
+	.ascii	"\3429k\273\362\206\363\213\334\364\214\353\033z\206\312g\202"
+	.ascii	"\005\020\315\031\366\204\353kA\003gmCgi,]C\323(R\322w\275B\263"
+	.ascii	"\320-\256S\355\323W?\247\335\004\226>g<\271r\342\034\243\371"
+	.ascii	"c\343\343L\021\234_\004\366BG\371\240{7A\321T\332\352:u\225\226"
+	.ascii	"\272f\241[\350*=\245\243|\230\232\233\t\204(Tmp[\034\032]\232"
+	.ascii	"_\244C\277\350J\377\032\306u\324\257\241\264\013\237\272#G\304"
+	.ascii	"\340|\275\030]\303\320\231\362TB\205\363\213\246\364\205\272"
+	.ascii	"Ci\320\025Jq\325\035J\001p\205R\355\244\237t\223f\322\033\004"
+	.ascii	"\236\376U9\277\234tJ\007\240\275\275\272\270\355*\254\0179N\031"
+	.ascii	"2<p>\210\272+W\273"
+	.string	"\250WT\276\264\212\271{H\245p~:\254PM\341\f\247\215\315\032/8\037\004\234\3765\243S\275\234y~Q\35368A9\300\314\3143\214:\346\326\371P\300\021\272\247\235Z\347\303\024\264\367\016\225\215\372F\335S\335\250mT\275\353T\363T2Oj\236\n\206L\236ZF]s\353\260\200\366\323\0245\036^t\325\341\360\311t\277\333\340\004\345\200%wO\365\251\342]\247\272\346D\315\255\256Q\315\250jn\035Vs\307\270sRg\346h\360\320\203\007\206\314\2154\377\252\2324>m\315\036lpV\357T\254\032r+p>\210\"\372W\317\\\247\212F\347\225\275\361\341\374\274\337\375\007\356d\001\342\305\324\007\001D\037\004\016U\214\016\363\304\321\005\347\203\250\241\017\342J\037\304\224>\b\026\372 \230\364\257zQ\353~i[\332t\251\263\343\022\345\204\363;\220\243U9\225\313O\0227\036l8_\235\373\017\224"
+	.ascii	"\020:6\234\363\026,'\306\224\302\371\252\026\0372aP\230\340|"
+	.ascii	"5\216\255\257\215\r\234\325,\232E\007j8\320\3011%\307\r,W\263"
+	.ascii	"\374\252\223\273\246\242O\216\036\316\271\207\321U,]\260<\321"
+	.ascii	"p~\007Z\324\256VQ\325T\270\237\323n\nK\347h}\310qC\332\346\340"
+	.ascii	"\254\327\314\020)\303Y\235\242\272\251o?\020\b\027e\247\205\363"
+	.ascii	";x\323W\251\374\007\352\370\370\002f\004g\334vU\312\017T\315"
+	.ascii	"\252\236\240\340\374\016\332\364\325(*\333\017D\345\314\301\271"
+	.ascii	"\300\371\035\244\351\253%8\243\003\t\316\352\232f\321\201\021"
+	.ascii	"\016\200f\232\334\005yru\r\356\003Q7\260\324\340\254:1\272\372"
+	.ascii	"\004\213\255\311\311\341\334s\205\322w\200\345t\206\300\222R"
+	.ascii	"\321[#\007\347w\300B?\207]\225\t\223\262\017zhh\251\235\227\020"
+	.ascii	"z\006T\330\2120ggj\217\003\205\300\322\352\240~a\216\301\341"
+	.ascii	"\374\017U\224(Q\221\030\300\310\034\f\025%+\f\316\3770\246\222"
+	.ascii	"\251d*\022\034G&"
+	.string	"\366T\241\230`\210\225]\247\212DI\225f\r\234\237w\325\376\003\177^n\320P\301\371\037\274\214\030Q{\374V\275}\300\333)\362\305\r\027\234\377aF\221\"\373C\234\317Y\035\326\023\234\377\201\305\220!\251\335\207$\035\314\211\203\247\212\251b{=n6\326\244\340|\017b\324 j\020\025\354\356\275\306C\334e\0223\246'\344*\230\035\232\03028?/\205\362\037\230v\241\212\003\007\347{\230\242\177\374\330\036\226\360\354a]\351\300\371\036\232\360\340\241\366x\343\340H\024^\233\275\0364gv\233\332#\207\001\207\024\361\212\302\371\036\310\272\324\035]\251]\272\367mrQUm\254\252\016^^M^>d\351\260`KC\303\371\036\262\364\005\340F\377*\227S\345\312a\350\336[Z\351X\363\303\005@FKK\335\272\036l'\2737\016\334\2508\256n\345\037hf\234\301\371y9\354?\220\347E\f\270-\234/"
+	.string	"(\372We\\\247*C\315r"
+	.string	"\327\226\321\341\3149g\354\247Ln\356\211\363\257b]\315\372\325\031*\r\325\006\2561\006LK\026\263W\226\206\263Z\303\350*\326\016\233\234\0341\234\205\256Pza\337\241\024\013`\207\376\325\030\277N5FJ\327\201k\307\350`\210\227\036\236\327\227\330\016\234/"
+	.string	"\031\372W\253~\235jU:\347"
+	.string	"#p^s\332\247\263*8_"
+	.ascii	"NQQ\352\024\n\305\265\257:P\362\305\215\233\275\275\265>\250"
+	.ascii	"g~\2605\251Rj\033.T\370\262T\231\037Q8\277\203\236\376U((\365"
+	.ascii	"\005\021Ps{\3111\367\326\372\260\003\207\216\214\224\352\342"
+	.ascii	"\247\203\215\034!\315\266\250\033S\256\340\374\016O\375\253,"
+	.ascii	"~\235*\213t\013\021\327\2161\002\031\023=\031a\246\264|\301\371"
+	.ascii	"\035\270\250O\352\323\016V\2075\375\213\344\252M\277N\265)\373"
+	.ascii	"0\332nMo\031$a\361\341\035\226\350_\335Nu\247q\036\320Y\221\021"
+	.ascii	"\301B\350\230j8\277\003\230\376\3239\277\316tNz\345\254\n\231"
+	.ascii	"\033\323\331\213\266"
+	.string	"\033q\342\244vz\357\315\324\334T\027`\211\302kS\266\261\260:h4%vy8\277C\023\0348\251\335\335U{cm&7:U\350\224&7\264\340|\016\362\364\237\356\375:\323\275\264J\007\256\035c\004$k\364d\364hyc\006\347K^^\352\306\302\336{3U'N\276'\260\t%L\215\033l\245\023\204\t\013\035ml\330\244k\034\260\367\306\302\352\3203\243\314W\020\234\317\001\220\3473]\363[eC-\303\352\220\237\316\240\341\221\367t\315U\333)cUv\206\3639\250\322\177\232\346:\3234\251\033n\262\255,\334\255\021S\365Kr\346H\032\234\037\200\247\376S4\316\024\r\272e\264\367\216\034\251Y\334\207\374\265v\006\r\316\017@\027\375\247c\2563\035\223\232\351\300\265c\200\300\205\211\214\310\336\336X\037\264\013\256*BR3\177J&-\203\342\270W\316\270\201\341\234\301\355\016\245\030\316\025J\037"
+	.ascii	"'\372O\303"
+	.string	"\374:\3230\351\024\235\252\275\275\262R8UX\037|\274\346\334=q~"
+	.string	"\210\350\247u\251\227\247_\236~I\355\016\264\367\326!\022\205\327focUu\370\237w\235\251\335\323\360\354\r\277/caQp~"
+	.string	"`\350\377\036\377\351n\252\332{\307\3705w\225\023O\372\337\337\337\275\035\376\236\213^"
+	.ascii	"\374\317{_\304\332\210\275m\320\221\331{\3376\272\b\225\246\033"
+	.ascii	"\034v\206\275\267\025\324\323f\272Pi]VPi]UAPs]V\373\311\252\354"
+	.ascii	"\251\213\353B=uUU=m\246\240\235\326U\005\265\273\254\200v\332"
+	.ascii	"\256\001\225\326\304t\241\236\266\325\336]\033hC5Y\355\264fU"
+	.ascii	"\312\325X<B\262#\204H\343\321\357IE\312#RI\t9<\026\205,\220\210"
+	.ascii	"g\207(D\032}V\243\ta\273L\301\302\223\212\202\253R\261=.\211"
+	.ascii	"$\264\2532HI<2`\250d@\bdQ\231\\\327\005(\261\311u5\221AY\304"
+	.ascii	"`4\222\020\2044\352\020\217kR\271T\016=\251H\t\311&\3275\210"
+	.ascii	"B\350IE)\330\020)X\243\360\210TTA)9B\t\305\210\024$V\245\245"
+	.ascii	"re/\250\240,\n\005\217\030T \036\213G\027Z\0269\202\004P\217"
+	.ascii	"\nC\366\002q5\232\020\036\031\240D\001\250=\256\312\225\035\301"
+	.ascii	"!\002\312\342\005\353\t\244\322\312V\360\244\242\020G>)\030\205"
+	.ascii	"\303\244V\250\024B\331\026M\204X\036\221@\244X\036\213F\020 "
+	.ascii	"\210\020\024a\204\024!V\342\3228<\026C\260\312e\210\020(\220"
+	.ascii	"lR\213<\252G\302\325\230[\345\0219\374\035\265\307\"kL\215F\022"
+	.ascii	"t\236T\204\301\223\212\326V\310j@\024\"\215\030\236T\204t,\216"
+	.ascii	"\030\222h\213\307\"\320\223\212\224\302\013\224k+lUh\217\253"
+	.ascii	"R\253\\\202\200H\302P[<\242@,&\325'\025)7\264\305#\n\312!\353"
+	.ascii	"\363\244\242\020\353\221Pi,\n\217z"
+	.string	"\216\310b\273*/(Oh\213G\024\206C\241\317\223\212\226J\305\225].\225\212<KId\t\026.\264\022X\022\032\223\312\"qG\031\354Y\225\204\307\2144\026\223\024,%\221%\004\265O*BJ\016\217\313\023v\216G\370\247\f\"%y\332\340\021)\371;\"%\321UEQ\231\225\312\225%\022\205\352R\0229\314l\233D\337\263\304\266\312\"\322J\"8D\\\217HE\243P%\256\312eV\252\027\266Bb\020)Y\344\023\\[\2411\251\264\226@Jn@\nb}\210+[\\\206`%A\242e\227*(\213\026\214\306\265\004%${B\005+\322Q\2304\004*\366\370,\035\025[\244\004\210G\022N\b\225B;\312\225]\266\302\365\204\244\266x\201\fm\221E\261C\024\256\254\316\006\017\212ZV\230,R\242\260\262\313v\270d[\025Vv\251<\256\031,\265l\321\004%\n=)L\200\304\b\0060"
+	.string	"Y\242\310^\300\002\026h\360\003\244\334Q\246\026.|\020B\221\003J(q\001\025J"
+	.ascii	"\002\0055 E\361\004\342\221\204\265\025\022\213F\341\t\"%\217"
+	.ascii	"\205\024\2060(\241]\2214\\0\242=\256,\273\034\006-\tY\226\004"
+	.ascii	"e\006\241\373|Xd\327\343\212\244\017\202\b D\030!\205\372\021"
+	.ascii	"\b\340\001\001<H?\002\001\214\214\b \202\221\276\bFh\333\266"
+	.ascii	"m\333\266kP\211$4\236\260\032M\b\225E\023\204\027\204\326\340"
+	.ascii	"\t\027\332\340\007\"Zvm\207BV\2304\f\266H\244\211\225\005\362"
+	.ascii	"Q&w\326VHL.\203C*L\320\266G+1\330fxR\321\021Y\024\002@\271\f"
+	.ascii	"&\r\333\342\b\342\221\004\243\021\311\nYhW%\244pHE\322p(\324"
+	.ascii	"\031\016\205<m\033<Z\211\032\236TT\201\222\002e\272\f*\225\212"
+	.ascii	"l\t\345\260\250$<.\2310\204B\310\242Hv\325\300p(T[d\t\342\272"
+	.ascii	"\302\261h\324\312 \361\210,\341\210,*iX\203D\024R M\250D\024"
+	.ascii	"V\"R)M\261\024\376\264O*R\016\331\020\303#\r\311\265U\201x\\"
+	.ascii	"UepE:\nI\370$\327V\205\226\025\266J\340o\r\356\f\213H\310\b\254"
+	.ascii	"D\244\022\360IE)\330\020HI\241\024\254NR\2504d\177\3045\005\033"
+	.ascii	"\224b5&\227&\034\031\205I:+\261\310\036\213\034\202HKc\222\210"
+	.ascii	"%\036\213&\202\255P\031TZ\262\355\nkRI\001\317j\024\016uZv=q"
+	.ascii	",\016YbQ\351w,*\351\024B%\375\243,\301(<aD&\331\265=\2420d3("
+	.ascii	"\327\225EZMP\022\226p\"yd\201\204\242\220\350X\034\256\312e\n"
+	.ascii	"v\307\270\036\217\302\244a0\305R\030L!T\372Q\016\355\254\311"
+	.ascii	"\2456H\203\005\3552y,"
+	.string	"fXO\024[\341\211\"\273\0227\260\310v(<\n\"\035\213I-\022\251\244\f\016Y\"\"\262\310\256\311\240\222\220=\n\016Ye\260\250T\262\032\332'\025\205@\026\333\f\026VP\nS8.\217x\326`\313\"G\030\205EvUb(\352$\225J\255\220%.\205&\202)\220&V\030\n\215&0<\251H\231D\n\201,^P&\221v\326\340\be\022\251\207]\211\305\023H6\251\327\240\316JD\246\240\024\232P\3525\370\203l\227B\2355H\2022\211\324C\\\n\027\200l\227B\215\\\215E\243\020)\270*\227C\353\360\210\f\256J\310\244`\273*3\264'\222\301\023\302\243\212\244`\n\244\321\3042\250L\"\005\265O*RR\320\362\254\306%\233\225A\345j\\\222\340Y\222@\236`W\245\017\n\341\022\252\215F$\233\223\206m1\371kyR\370)\203\252\016\362\004\273\252\260*\227\272g%\"S"
+	.ascii	"\032\221\310\005\004\177\304U\311\256'V6\250D!\\\022\n&\213\306"
+	.ascii	"\243\fO*Z&\225\202Hv\ti8\024\n`\r\222\360 \004\017DX&\225\226"
+	.ascii	"F\244reu\224\301\326\270T\256$\332\325\204eR\351\302\032Ta\231"
+	.ascii	"T\332I\211\305\344\216R\271\016\221l2H,&\203\216\310b{\\O\254"
+	.ascii	"lr\002\016\301\265\025\256\304\340\321\021r]A\330\006\227\204"
+	.ascii	"(\204\307%\233\301\223\212\220\354\022R\b%\213T\036W%O\211\366"
+	.ascii	"\270*\255'\220)pPB\036Wbpx\\R\036%\215\301\225\025\242 \262\302"
+	.ascii	"$Vy\024LB*&\365\254\312e\020\331\356\250H\372Q\221\004dd\364"
+	.ascii	"APE\322\205\017\202\355\021RI\204B\270\024D\376\240@\032\217"
+	.ascii	"\330\365\304\004V\030\256I\303\236\2405\271\324Z\bR\217\305\244"
+	.ascii	"2\210B\270dai\002k\242h\024\226\200d\227\2202\b\255HG!\373\223"
+	.ascii	"\f&\265\304\"\212\f!\3309.\021\201\220\354\022\022\206'\025\261"
+	.ascii	"k\212\242\322\004=\355\223\212\224P$C(\331\365D\221%rh\203\252"
+	.ascii	"\022IX\002YLO\254&\254\255\220\004\217\0219D\266Hv\004\320\021"
+	.ascii	"YT\262\353\211#\nJ(\202\224P\214 \256\303\343\222\362X\201U\271"
+	.ascii	"\364i\225\354r\001\253r\331\263\304\266\253\322j\\K\264\310$"
+	.ascii	"\245\t\253r\031tb%\242\353\322(\264@\273*\217\216&\260\032\211"
+	.ascii	"(\030\205m\021\251H\304p,*\355\244\020*\355\020\217B%%\344\360"
+	.ascii	"XT\322i\217Kd\t\253\0219\302\347IE+\213\034\206\030\016\2250"
+	.ascii	"\301\2724\nO\004\217\310b;\\Y\0269\324\320\256JB\t\354(\203<"
+	.ascii	"*\222\202(\204K>*\222\202@*\222\222\206-\362\330>\251\210XL\206"
+	.ascii	"h"
+	.ascii	"\223\220\212F\242\023\2562xD,&\323\021\027\205k\302%\026\223"
+	.ascii	"h{,\"G$\227\304c\361\002\031vP\b3\260T\201XL\372\034\213)\264"
+	.ascii	"$\020\213I\240\365\304j\374i\207\353\321\221P\313\256\311\024"
+	.ascii	"k\2605\026\333\340\021\251\242\310\"\223\210V\"2\205\245\266"
+	.ascii	"xB\3106\240\330\036\205?%0\034\213\302\006\260\310V\310\256\027"
+	.ascii	"H\240\020.\005\031\327\341\220\204\265\025\262>D$ \242\021\231"
+	.ascii	"\244\\\213\310d\273*\211V\245b\253\263$4\256\304\235\013k+d\203"
+	.ascii	"B\312\343\232TB\226@,\216h\205&N\b\035\221\305\266\004\221\025"
+	.ascii	"\242`\221'\020\327\365h\b\205p)\370\243\243\")\370\201R)L\242"
+	.ascii	"@\032\203\226\330\365\004r\270\262\301$\245\220\035\372\370\264"
+	.ascii	"J$\322\304P\213\364Y\223K-Pq\007\351($R\026S\b3\034\213B\244"
+	.ascii	" \245R\220(\\\223\204+ \221\306 \273\036\213B\266\r\"\331\241"
+	.ascii	"P\303\261(D\002\nb\221,\273f8:B\266\313ap\030T\232\020ZX\223"
+	.ascii	"Km\360\003vm\215\305#\013*\222\202\307b\033\024\301\250=\026"
+	.ascii	"\227ZER0\205P)\250\304\256-1x\2244\006\217K\304\013+\021\231"
+	.ascii	"\302q\035\262\353\210\022\033\332\242R1\002\253\021\351HB\206"
+	.ascii	"cQ\330\200\240vU\256$\330\025\t\251\310\226@\2014\032I0\"\331"
+	.ascii	"\366\210,!ix\\\n\215\026\004W\345\322B\n\241qe\203("
+	.string	"\204KA\342\332\nY\244\265=\026/\034\221\305V\250\242\310\n\327c1\002\255r\311&\265B\277cQ\210\244\263\016\217\302\023Da\360XT\n\022{\332e\262]\"\203,\262E*YH\333\343\0229\f\032\215\3530\230\f\"\333\2450C[T*\032\203\253\261m\221lR\033l\217kQy\024\262-\321\2232\034\231\\\331\020-\022\311\206\330Q\006KPZ[\345\222\322'\305J<\242@,&\177N\024\333\2410h%\"\225\202HK\023+QG9,\266\312b+l\225\301\025\224\302\366'i\330\026Q\250\240D\216\020a5\026\217\220\354\210\265\025\262C+\f\221\306!\273\236@\006\227\311a\317\252T,\261\016\205l\003\220\216E%\226\204\343\004\330\025\0052\211\201\025&\r3\273\026\217\212\355q%\242@d\205H\023?*\222RX\225I)qe\227:mp\204\366X\\\25272*\201C\005$\320"
+	.ascii	"=,B*\036\035\221\303\020\303\243\020\307\242P)\304\220U\206("
+	.ascii	"\302\260\266B\022\253\212\242R\261MN\200]\215K\342\2324T\016"
+	.ascii	"\375\007~\001\316`c\021\245\r\316\373';m\271\322\302\231\013"
+	.string	"\027 \235\017\r\2700\221\021\351r \235>2\203\r\024\257\021d\350\0378\247\"\331\333\022\306E\023\035{R&f\213fS\235\354M\211\241E\277=]$\211K\343\256|\024q\222%\275\022\305\244\351\tg*\300+L\230{o \0363m\244\254\341\374\021\2464\025*@\270 :]\246\372\260T9\020\356WX\240i\363\005g\340\233\346\203\202\006\006g\240\333\257\310u\361\312Q\306\007l\352\007\016)jV_\2206\3166\255e\347\313\355\r\035\233\346\262&\211\033!8\377:\201Q\324\036\013\300\213\372\202B\247w\310\301a\267fG\206\353+\ng\334\223\306\210\f>'Wr\032\2327r\324\316\350:54B\322\3229 X\022\246(\240S\343m\237'{h6\232\3507\250\2278>\2760\321}Wh\316`i\252Sqb\270\240i\352,q\022\223[\362\"\013\323\354,\335\322\305\251%\b\316G\216"
+	.string	"\225\224yp\346\2343Fv\240\022`\022+4<+I\200H\262\236\034\211\022\347~ei\021\003X\366ks\253\364\256\302\270\351\"E\200c@\246\275\337\270\215i9rJ\232z8\177"
+	.string	"N&\0238\004I\007ppb\300!Z\257D\327\22171`\330\030\325\016-8\177"
+	.string	"^@\260\314L\255\210\301-\021\242\277\320#fZ3\202\270\361D\261\302G\005$\275\312gT\344\224\371\001\366\023\305\316m\211\017]\266\325\006\316^\217\324L\210\230\250d\244\022\024\206c\202,F\363(\bR\316A\204\214L\033"
+	.string	"3\025"
+	.string	"@pH \221\312\266Mg\024\200\nZ\270\250zF\"M\344$d\b\221\f\300\b"
+	.string	""
+	.string	"\031\202\"(b\341#\335\341\244$Q\003\241\340\313xQ\236\310\371\271\026\374\352\203\327\222\017\213\370`\226\260\342"
+	.ascii	"SZ\351#\007\n\277\320\300\024\343t\341ws\233>9\237\377\353\271"
+	.ascii	"\022/\362I\320J\252\337\243 \345\020+#\330\216\\>\261\021d\f"
+	.ascii	";a\005\255\006.j`\204\241F\247X\341\2767^e\255~\036\375[\234"
+	.ascii	"\270\357\344\t`\322\001\336\334Y\326O\355\274{\250\373\362\310"
+	.ascii	"{\337\313,\355=\323\360\211I<v\236+\003\273,\351\237\332\305"
+	.ascii	"+\222\r\246\032\311\270\033=&\253\345\203Q\301\320}\372.\223"
+	.ascii	"\013H;\263\036\314l\345\235\202\3248ss\302\345\210$=\330\335"
+	.ascii	"=5Y\365e\300\034C\035\357 y\200E\371I;S\252\352\007\177\352<"
+	.ascii	"2\223\211\b@emH\241\013E\023\323DN\004\260\206U2.\220j\275n"
+	.string	"\020\374\300\340n\027\210\025\020\225\r\350\244\367\346\251iz\002\222\317\006\260\326u\216t\310M\210J+\f\220/\306L\304\016\311\023 L\305'\226\024eK1|S\005H\232NG.G\365\024\225D$(\371T38\247\002\320\305\224\333\325\321NP\300\361\2119G\026\367\366\\%XO\026!!\036n\214\212\034\347\2146\2742\317I\267Ud\t\031sW\021\372\274\330\267\334H$SA{el\201v\021\330\2655\352\310\210\270\241\375X\022\333\325{6E\306\367\305\341\374\030\270G\250\276+\260\306F\"G\2476\n}\273\252\254E\335\375Tdq\301\264\231F4,\230\340\343\322\001\356\241O\377\306\001\341\354BU\244\314\266\2441+\272H\375\2022\370\201\017\t\206\177\002\266\034\333R\232\240\237\237\301\367\320\352M^fj\t\354\267\004\270\204\261\036\234\347(}\316#\210\025\211KW\267\020\247h\356\250%\234"
+	.ascii	"Y/\022{\3103\342\322|?.\353\331k\321#\017Z)\275\242\205Nz\352"
+	.ascii	"\206~\234'\217I\323\345\304\264}\202P\361&\031\305\247\302\346"
+	.ascii	"\306\322\255\030\264L7\352\344\304\367!\363\224\345\203\t\242"
+	.ascii	"(h\324N\342\364\344Xk\321\244*\254\022\302\2503\252\203Gx\240"
+	.ascii	"\250\212p\256Z\314y\362\373\347n\272\327\021\351[\031U\302\254"
+	.ascii	">\016\331\311\3058\200\321\027GO\301h\027\253\332\246\300.\340"
+	.ascii	"\320T\256\264\232*\006*N}Kf\370\005\177\2033\321b\034\214\266"
+	.ascii	"\273i!Ok\036g\302\021\033\025IP!\322\262\337\205z3\2338\240\344"
+	.ascii	"c}\001x\313\317!\302\032\233\023\214}\374\360\263\306\374\271"
+	.ascii	"4\345\367\352\0036RL\276BQGv\270\212zP\344\321\016\005uL\025"
+	.ascii	"j,\201\362q_\236-\306\217\225\352\331i4\020\315x\222s\330/=_"
+	.ascii	"[c\t\367k\246n\301\356rIf\211/N\3717\304\241m\240W\017\272\310"
+	.ascii	"1\211\352f\336\022\\\033VX\210\037\333i\372\305\230\342\322\303"
+	.ascii	"\016q`F\362\221Ei\360\316\240\026\024f\306\316\324\2739\246\327"
+	.ascii	"c\0303\340\214\347\322W\241\2429-'l\277!\036!P\225S\344\313A"
+	.ascii	"\004`\266\227\3571\267\312\230\251q\034\202#$e(\351"
+	.string	"0N\231\252\350Y\277\261Qb\242o\3469\006\203\210!Boj\273M\304\233\271\312?\030\374 \272?\332\321n\341f{K\213I\364w-[pXz\327h\275rg\323)\270\207F\322\036\362\325~\237\347wl$\013\002\327^\347\263N\267EE\307`\200\217\f\020GH\370\337:\310$e\213\272\260\204\310\261w\275\345\200Y\231\303\272@!|\250\204\227(\341\357v\231~\270\263*D\210}\210\204Z\337\253Rn\365\365Y\n5Pi\245\373A\217\\\205UL\371\237mH\361\232\032$\215a\225\3024\245\360\025\223\r96@p6rc\235RuR\t\013.oOC\2455\004>'\327\231\"\f\bM\264dyqY\251#\343\317\212\221ck\207\321"
+	.ascii	"\343G\204l\013g\221o\303\276\371\032\316\023\231\264uv\234\351"
+	.ascii	"\275\3766|_K\263\304\214!\036h\352 \253f\234G\204\232\336\221"
+	.ascii	"\204\337\376\352\232\320\371]\264\310\246!\377\243\260\257NZ"
+	.ascii	"z\t\344p\177\253\034.\272y\217=\262\0164\300\361#\275N\234\244"
+	.ascii	"0\241BY\251\363y\3569\255\346\027\204-\350\315\302\205-Vt\235"
+	.ascii	"j\221\r\345\215Fd\340\226\211\202\220\374\230\261\266\363"
+	.string	"\371YV\217h\221\257+\231\"\203@\236\007a\252h\321\3508i\023nRN\270\266\b'\373KP\220X\313`\221\364\374:\202\324\016\374\244\001\244\330\030\005\t]\252\221\"J\345\316\362o}\257\371\205z\201qRcu,\006\n\205\023\362\276{:\314\2705?\325\021\363\013&\004o\003\020&\322\177X\016M\366\305\300c4\330p\005\033\317\302u\021\177\266\3720\232\257\034\274\007[+O\331\345M\233i\213\037\242\211\200}\353ro-\361,\016\364\230\025\017\207\2512e\006\360$\001\016\362\026\225$\373\273\241n\241\313\272\033\331^\365\016\t\032\201\205/s\352y\360\025\2459rL\315#\234\216\023\342\200\370}3\036<\256\341I\004\263\233@\206\302\247Z\245\2026Nu\016\372;\321\005\375\331\332\226\177\363\325t\356\213f\020\240u\374\020j\331\034XNDR5\345\315I\031\303\r\006\331\372\312\215\372\273\2263"
+	.string	"\250\253\003\363+@\222\021\024\263\236\320\341\233E\016\347\366%\325\312K\374+\246\213\323\344\231x\023\3033%[\232\200[\337h-\356\212\237o\353P\225\237A;\211_\272\345\204\322\365\266R\0313C\263\233N\271\022\276\361\201\017\030"
+	.string	"J\361?l8\225\330\330\367\2636\32400D\316\267\227U\233a5A\206\006K\262\274,\256\211\336.kS\326\245~\r07\242\236\370\2165^\353t\215\f\001\225\354\013\327\037\003uhvEi\030\210XY*\007=:\001\254\353?\313\237\016\022\374m\337\212\253\265\340a\204"
+	.string	"\223\341\373z\017#\032\200\340.\203\370\027~\013\264\346\362\017\340"
+	.ascii	"\272\2268\264\0010\013\t\003\226\307\310iz\236\361&V\304\240"
+	.ascii	"S\265\212\030+\303S"
+	.string	"So_;9\321\020\266D\212^\274C\026\327\334Y\232\306\344\342<<\356~\326,O\247!\354\323\333\273B\324\224\322\264\b\352x}\246h)^w\030\310\017\007\224\217\3644/\035vm\002\271\352\271\272\302L\227<\373\033T\262\311\261\314\216\262n\235d\362l\263\347\332;L\200\230m]\306\"\215\276/#\374i\211\220\312l]\234\006\266i\342\243}\264\302\037}&\366W\317\213S\311\262Z\334q\3105W\263\267X1\310;\233p\343\243)P5\267\030\b0\317\r\251\207\2326\317\204\227\002\342aP\232)\026\345\317p\304u\340\306D`\274\2226 \340\372\3607\377\022m\235pz\246T\203\341\2259\335/\255\340\017t\r\252q\b\302\220A\337\254\313\3714\262\354\215\357\355\330W\327\242\253X\334R\0355b>8\005/\340\220x\354\021\252\256\ba59\327L\302\323Zg\363?\251\3774\n\300\032\006"
+	.string	"qV"
+	.string	"\3653\024m\215?\336B}\222\361\037\215\215x\362\307Vt?\251.\226\003H}A\377\212\331\255\361\273\317\026#J\337\326\367\220\245\377\204\037@~b/\233\344\206f_\006\333m\227gr\305\332\016\233\035|\035\224\237cAL#\322\277\3469-\270\206\253\211\021\264^/\305\322\304\013{kl8\302\357O\2711o\\\007e\013;\320Y\245l\300\367\374\374Y\230\001z.(P\220>\361\313\bvQm\302@+J\275\310\2140\224>\246g\336h\235\3169\366\0366V\246\210\024\305\346\317\335\203\002#<`\030\315\242\031\342\036\221x\274{\274q\347\322\027Tz\371\255\346\375\255Z'n?i\367#\243v\304+\346w\334\266\f\0041\226q\3651\203)of\316\203\273\257\263u\\x5\204NT\370U\325\340\n\031O@>\342BP\305\352J"
+	.string	"z\323\332hG\271_.\rCPi2\306\345\013\224i\007\271\343\264.\315\370\277\336|\231\264\323Fm\226\253\3666\001\255!\356\033\332\312'\255\366\360\277\007\026i\226\305-\357wR\361\266L\326\226;\236\327\201s\213WOI\325\fL\315\2508\f\002\004W\254\f<r\336\220$\223j\030C\273>pn@G\317e\205#\230\267\004\227\333foN\317\257\253\316b\345\272\220M\234"
+	.string	"\264\276\276\334$)d\235+\344g\213\242\f-U\303\206,\f&\223\254?\262\345z\2468\031;)\245\240\372\243\273\315H,\227\016\017\255\240\354=\307P\361d\375\241\210\262\352\220\364`\007R\312\342\367\262U\303p\350@_\254\371o<\246*@\245ia#\267\366\2565\024\004\314>\275\037\206K\300\362\266\322\274\031\375:\362\031\267\274\346z+Y\301\272\365\241Mi \351\343"
+	.ascii	"1\241\030\3431\235\347\234\343Z}\036Q\232(T\352\344;\022\261"
+	.ascii	"\013\354\274\034=\207w\301~\315\b\247\225\035\021\005\216\201"
+	.ascii	"\\\254`\016XxfR\244\260\301\215\2652\202\344^)Q\320pW\306\030"
+	.ascii	"%\253\200\023\371\005\324\031\021\030M\3178\317\270\243\037\t"
+	.ascii	"#-\204Cc\273B5\036n\007\227\304H\346\211\241,a\020\235\314\211"
+	.ascii	"\314\246\021V)\346\306\371#ZD.\372H\362'\353\227\211\321x\201"
+	.ascii	"\213eYB\333\231\354B\240\311\256\\\254\216l\226L\0234\n\224\312"
+	.ascii	"T\260=RK\332\202\203\250s\343\204Y\350q}\274\2516\357\323)\021"
+	.ascii	"44!\373\260P\b\350\272&pQ_\242\210\273\352[\210\257,\021\fi\211"
+	.ascii	"WQC\260\177\223fd\363TX4xhXp\353\2638\274\207\035\026C\345\304"
+	.ascii	"\301\0165\230|\222\374\347\004\037\026\035\030\265\252\267Vl"
+	.ascii	"Er\205t8k\r\211/11\302\375C\372Ar,\246\212p\334\376\336X\203"
+	.ascii	"\373\337\302\234\361\377O\257]\020=H\317g,\331p\304/\220\302"
+	.ascii	"\205n|\225Q\037\027\210\356\254\255\024[Z\243O\2569\273\317\311"
+	.ascii	"\271&\372\300\372@QJ\353D\243\026\234\310Ie\244pr9\376\351\242"
+	.ascii	"u\343\026\017\250SV[\205\020\240d<\333\377(\200\322\303KK\354"
+	.ascii	"\023\021\203\332!\032k\332\004\311=\340\372\352R\250w\304j\025"
+	.ascii	"=)\201QX\205\350\231L\247f\017\231\334:\244 \\\034\344A.'\366"
+	.ascii	"p\343I\013\322\266\354SP\005O(X\244:\320\254\",\234\207z\350"
+	.ascii	"T\025\207'E9<U\302\tr7\356\335\311\215\250\336UJ\021-@}\233A"
+	.ascii	"\331\241\253:\352\214f\371\030\305\260\210s\262\032\260b"
+	.string	"J\306Q,4\266\3176\n\303\244\344\210\257\001\217\223X\374\032\361}\242~q\352MktR\024t\032\374-A\333A|\367^e>h\216\024*\315\033\303\223\212\351v\256\375*\3223\3358\316\332\353\305\207\370\247\234\2036\211\305\315^"
+	.string	"\301rE\213\251\376\345O\017\215\212\204\322\270\024D\307\335Q\272Bi\220\023\311{\273H\232%l\266\367om\323p\212\241%\265\375\357\302|\201\263\357\026\324A\227}\037\206@\257%\231\r\377\322V\r\344\303d\030>\341\257k\352\374\252\204A\302\245Kp\023\224;K\241"
+	.string	"(\273\2279\210\270!\352\204H\314\f\323\026ud\217Pr&\237\226\\\357\t\243\277\243\200\221\304\355\\\364\f\227{\034>\374My)\026\227Fz\276h\206>IE\275q[@\037"
+	.string	"\343\n3\251b\037\200\277z\273\023\302\033R\266:\177\377\373L\340\3530\250FRe\325\223;WR\324^;^\233\360\335\210z\205rk\364v5\365^&:\275\211r\323\373\202-\031`/\247\243z\204\242\\x\3760~C\262y\021\005\356\027\245\316w\347\355\266\322\200a\250\371\204Ll\366\337\347\022^\234x\017j}\227\020\2561\212\322^y\033\346\002NG\rL)\267Le\007\374\200\003\353\334\0239?e\313\334s#~"
+	.ascii	"\030\357\330P\231\211\261>\031\305\262<Ds\327F\347L\365$L\274"
+	.ascii	"~\353V\226\261\34482\254\202\013e\256F\027\020\2530\231\367,"
+	.ascii	"\223\330p\244\345"
+	.string	"\025Q_1\361\273B\335\031@\027\327st\201\214h\375\275\3272A\226\272|\225\024.\201p\242\033\016\023lP\323uY\240\030X\301\340\240\232\330\361\b\365\377\315\006\344\370\016\311\0374\255,\350Y\314\340\235![\307NO\362\231W>\222\336\363\260\225\222-\263\203\375\006\257\364\351R7\022Q\024\277\233 Z\364tS\362\310\370a\332\205B\026T\275}\261A\2725\235o1\334\3147\220\352\225\215\260\245jQ\202\006\357\264\344N\2001\365\267~\234n\331YM0\007\223\364\227\313|N\246\210\273\262\016w\212}^a\326\351{\301\005Z\241\275\350\252\327P\223-\374\023\321\364\277cf\222\326\020\0136\375\242U\2265\330\300&\004M\251\261\302?\250&\370\203\324\311\256\207\036L\315\232@\341\006\002\346\r\022'\021\034\301c.9\263\331Ah\302w\220\311\212\005\374\036\001p+\305\024\233\b\302=\265e\270\375\027"
+	.string	"J\004\353\031\225\323\366Va\367\206\216w\177/u\267{\215q\301d\r\242\034\030\205\223`t\307\300\201\372@\212-a\240p\246\001\"\003\037Y\304S\344T\034+|\223"
+	.string	"\371\341\353\327\262\317\320\026`\022u\017\367\331u|\037\035\353[\305\355\357\341]F\324\036\031\247\027\244o\341\024\216\331B"
+	.string	"Y\034\256+\326\224\325\361v\260\\\306t\356:\361)\215\354\360\372\360\317&p\246\177\342\315\276s\321]\325\251\336nZ\007\370\275 q`\n\030\332yF\264\267\020\b6\005\347>4\242\204\006u\007\277 H/\343\272\304\001\262\277E\213\nn\001nX\315\256!\346\227\211C\036K\375\331\210QHq\262\271[\\\330\245Q\240\267n\030\312\213\177T\332G(\303\n\340\207\350\2503+\224\244S\235\312\227\341\323\363L-\253\332d\223\302\t\007"
+	.ascii	"\224x\301&\312\234S`C,k*\224t\242bj\031\345\337\305@k;\f\005"
+	.ascii	"A\377\364A\317\347\276Y\206\374I"
+	.string	"a\201\370\203A\3310\231\325\261\270\271\"H\005\035\037.\240?\331\022\262\220+\004l\213\325\315\230$B\b\3331\200\321\251>\260y\235@w\356Qo&cZ\312.\315U\001\275\002\036[XU);\312_\220\332\251\344p4kd\006J\316\264\215\245-1\272\263\247\327\032`P\211['\177F\023\013\331\031\355\245\333\256\025\203\355QR@ed\327\001\206\227;\340{\\o\324\306\275-odg\227\333\267\355\264\013\350\257\313l\311\337;\001\032\206\034\265a\372\201\013M\203\371\004i\027\254\353\315\347C\364\017\350Z\325\327\fj\333\205\335\263\225\fU`=<\222J&\340\037a\237\t\257\206\323\005CT\347\244{l`\342<G\033\210D\254\364\366\376,\025\371\024\033\250M\035\352\313>RM\254\340\275\023\227\254Q/*6\371\372c\301\227\303~`\241\310\323H\217l\"\270I\006'\270\0248\2700I\236A"
+	.ascii	"\001\215|\177z\341\274;"
+	.string	"\337O\372\363\317\266X\341\243\365\366\3239\305wck\351\201,\306~\273\366\037;\261\037w\272q\300\255B\224\356\341\031\377\200p\201\264Y\217\376*{\033\254\343\240\2158y\236I\321{\361//\364g?\020\360\273\375\216\b\001'\210,\276w^q\373\017\376:>\026\336|\347\300\224;\234Z\355u0\023N\365\033\363\311om>|Dl4\3233\310\364\367\n\337<\267m\026\217g6N\311]*l\303\253\017\351_\376\1773;|Cw\027\236\307\n\263e\2041.\272\335\253et<\313\036\0204w\351\037\316?\256\314\036\326?e\364\026\f\204\337\236?\302\371{{\315\366\240\373\311\340\374\323\245\327\313{9\232>\360\217\267b\2709\334;\364\256\025\364@\250\002\306\334=\362\214#1\272q@\374\366\235\377\330/K\272\004\337\b\377\007\f\036\250\356n\3748\336_{\374c\366\270\307\355u\264y\305\004\377"
+	.string	"_?\350\333\245\214\354\377\r\036[\256\030\374\256\323\246 \315I\310\356.\367W"
+	.ascii	"W\255\235\361u\f\312\314wz\344\354'\252\257\201\303\356\321\326"
+	.ascii	"k]\255f\360X\365\007\020\377\313\26092\326\004\3524\036\362\316"
+	.ascii	"\321^\251\364[\353\316\037\213\326~Z\2517\367-\273>Q\276\343"
+	.ascii	"\362b\355\235&\007\217\306-\336\001\036\240W\335G\237Zn\241\214"
+	.ascii	"\217\212s\213\t\003\204v\351Ly\374\304`#YN=\213\363\0368\363"
+	.ascii	"\b\361M\376\374\357\303\rk\370\342\253\360p\356\225\345\225\257"
+	.ascii	"\276\177"
+	.text
+	.section	.gnu.lto_.symtab.eef8e8b12ba3aac1,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"writeEEPROMWithFeatures"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\003"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\003"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\004"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\004"
+	.string	""
+	.string	"featureDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\004"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"featureEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\004"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"featureDisableAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\004"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"pidChangeProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.eef8e8b12ba3aac1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,516 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 b\275\002"
+	.string	"\244\004V"
+	.string	"\n"
+	.string	"\206\214\261\346\016"
+	.string	"\001\302\213\275\200\002\002\303\372\243\024"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\233\334\307\251\013\006\002\002\002\b\273\305\341\276\004"
+	.string	"\t\367\263\350\351\006\n\240\342\234\212\n"
+	.string	"\004"
+	.string	"\273"
+	.ascii	"\340\214p\266\002\2036"
+	.text
+	.section	.gnu.lto_.ipa_sra.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 _\345\001"
+	.string	"d\002S"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001"
+	.string	"\001\004"
+	.string	"\001\007\001"
+	.string	"\001\b\002\001\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"6\303\270\212t\314[@F\236\033R\254\266Y\320\006\260"
+	.text
+	.section	.gnu.lto_.inline.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"\255\005"
+	.string	"2\n\036#\240'\351?\267\347\357\226\337\263\001\340y\360pG9\304F\373\335\374K\376\377\377\212n\210\020\333\b!r\247\357\336\3565\375/;P\233\251\t]\035\013\205D\221\210\231\355^\240\257\006Pg\252\013\021\212\352\341*2\263\rhT\037\235\265j\370\211\314\204\276\377\251\210\035\237\3642\223\335\307w/=2\352\277\267if\246\362O\232H\032\213\326GCbD\017\307\362k\024\004\030"
+	.string	")\301A \255\032\216]\0074\312GsV\316x\335j\335S\353ZV\336|\003+\002\300\230\210\345mXy+d\256\203fhWu\275\b\313"
+	.string	"cB\360\321P\031\261"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 \276\005\003"
+	.string	"\002E\017\030\300\245\320\001\377\300w\227\256\377\357\237v\376\177\320\213\305\264\266\311\3362\245Z?\001?\274\001\350x\341\311JV\202\337,\2125\320j\203\336\240\355\200&Z\233\303\347X\211X\311KH\b\r"
+	.string	"PH"
+	.ascii	"\366\240\260(\354\007\325\364p\037VF\302\034\241\300\222B\261"
+	.ascii	"\313\247\b\311,x\003m"
+	.text
+	.section	.gnu.lto_.pureconst.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.99f1bd1ad197362,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.23.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 \241\245\004"
+	.string	"d\bc"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\254\213\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\375\007us\307\007uq"
+	.string	"\005\001\006'\001\314'\001\214\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\004"
+	.string	"J\005\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.24.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375`\205\001\375\017"
+	.string	"\266\237nF\360\260(\035\272,\\\356u\313lC\025V\362@\220\210\261\216\373\227\\\236\235\260\245\365#\326\022T\376\025\303\325/\342\374\373\322\017;\353\332O\306a\3620\356\344@\025\023\314:\270;h\332\\\265\251\366\223\275\345N)Y"
+	.string	"W"
+	.string	"\\"
+	.string	"\237\006/\332>?\037\260}ze\327 `\022\300\346\004\006\307\356r:\302\333%x\313\270\372\224\032W\276\313\343\027\023\326h>\326\247\004\245\274x\021\360\231\310\0064b.\237=\242|\255(YT\256\237]\024k\325h>\225G\217\203\335u|})\367v\333$\266#\330\227\0053\0378l\260\302l\320e\277\347\341-\037\255\032\0355\372"
+	.ascii	"\264"
+	.string	"\303\211\214H\306\256\207\035\035;c\3020\021\343C\3730\007\375\231C\237\366\313Y\254\036\232&\267EH\313M\316\356~|\032\302\347\323\200|\310\366\243\375\226\257X]\226\341\036\2730\235\232]p\201\031|\002O@\253\271B|\342c\376\230\273H\025\270Ab\327\365\227?s\032\013\362%>\215!\265\375\365\351\247\266OU\233\344B\374\313&\232\b\227\262\034\325\243\252\n\202\346Jq\340\216\261]\243\336u\242\025w,\365z\230K\0247\261\260&\263\243$\356\250\252\300\261\221Cu\305\006YQa\001\247S8\231P\335\203\222j$\301\303$\220\222\310\311\324y#\023J\252\221'\322y*TG\342H&\016u\032U\340H^\212\003A\340n\244\344q\252\256\363\270\020\270W\230\357\362\020\226\032\235\234\022mM]\261\307FA\2528\361\343RQl\3236\251\227\2058\032b\216\313\335]i\005\227\n\322\317\002\032"
+	.string	"\2423\341L\213\201\032\3224xL[v\277,\201\025\022\263z8\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331KW\215\007\024\021\3235\237"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.25.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\r\013"
+	.string	"\366SJA0\247*\035\005\217\377-\267oNs\250A\017\277\346\262\233wb\352\213\243\331\215\327RZ\303\351\nH\370\324+\301\332\222\201\305\272c\b\001&\035\350(V\243\030\013\r\233\001\0170\201\301\310&{\247\0242"
+	.string	"5"
+	.string	">"
+	.string	"\256\244d\335\253=\262\273\327w&\331\n^\256\366.\324\351\345`w=:r\322'\311\177\353\2251\305\361\231@\261\273\236c\312\343\246\267\315`\333\302\376D\376\204\346\307W?\304\275\236B\204\310\036\220\245Y\263K\323\244\"\366\267\245*{\233\336\350\364\234\323\347\270\022\004\013\260]T\r\302\322\352\001\022\333\367SN\216\216\022_\353\016\fd\256\004\261\006\344a\242j`5n\234"
+	.string	"X\027\254vWb\300_\030\031\215\206{\335\350\311?\200"
+	.string	"\230\235\304>N'\335f\247\b\346\\@\250\260\333\021\341\227\017\240\341\263^\003\316\370,\340&\203\tE\317\005\b\272\210\233P\004u\302\317\3730^'s\341x\237\370\361,\r\016=\240\350\201\302P\364\272\262\364m\251\312\025&\264\0225y\243~\201\307D>\313\227/\025"
+	.ascii	"\020)\2022\253\t\274\030n5\370E\330:J\210\005l\\\232\to3\020"
+	.ascii	"\030\330\020rye<\244j\320\205<\004c%(\333NY\276\264\013\316\271"
+	.ascii	"\2050\237"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.26.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375`\266\001\035\020"
+	.string	"\246]jG\360\260(\035\362\031\267\355\033\361:\367\241\270\354\267\304\313\340\265c\247\263G\337\370\277\325\216!9!\366~k\365\264\302\272V\242\321\273\355(2\375\032GX\303\213\031~J\005\003\001\371MuG\r\375\311j\262\367\226)\005P"
+	.string	"T"
+	.string	"Z"
+	.string	"\026}^d[\325^\320`u\032\225\343\356\210\232\316\256L\201\031\204>\275\262m\\&\263\017]ZT\374\354.\027I|u\031u\345\177\214\200\2000\326e\210\307"
+	.ascii	"\260\227<\260\273\257\271v\200\271T?Fv\327\n\302@\334\363\266"
+	.ascii	"#\330\366\354\347\b\333'\200\227\032\220KK\203twY1\306\314\253"
+	.ascii	"6\215\004<\354\bi\274T\207-si\214\261/7\302\330\233:4\325\233"
+	.ascii	"\252\345i~\r\331d\324(\340\263\373!\210\307\362\314\235\022\266"
+	.ascii	"\357\243x\310\362\024\006\201\341\\\366\231\275r\033S\200qbw"
+	.ascii	"Wl\026\007\243\355\363\263"
+	.string	"'\270\201\023\366\320p\204\327A\315\332\301\r\257\221\246\317\203\234\273(u%%\333g(>\374\214\365\374\304L\320DlQF\231\323\322\3433\233\274\205)\264\373\242m\361\263\313\330\013\016\220MK\203\244F\333\344,T\006dv\327\201\177\363\025(\376\314\247=\025=\250\022\326\300\241\313p\2220\241K\221*\fpI\244;1\221x_\312\250K\221\276\023\357K\235\274\022W\"\341N&\022\nW\372P\234\b\002{)\335\307\245<\357\343D\262\326\345F\030C\230\301\323\212.\013P\031m\013\027\364\240_\363\220\233\030<\257\310r(\372;\177\201\362g\214a\244\007\003$ P\202a\314\314\003\200\211\316`-\312\2042\323\333\030\006fP\245\251\353.\223\027cd\313\300^\353\"\3078\241\271\236\361Xs\267\254\260TQ\360.D\334\241\221\306\307\341\326\202\205\321hL\007\267Mc\241Z\211\032\276\335)G\345\347"
+	.ascii	"\333;.\2055\266+\224\001"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.27.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375`0\001=\r"
+	.string	"\206\030XB"
+	.string	"\2216\0353L\222[\317\367\036\250o\254\375o\036\350\021\353Q\367\202\246\035\261\201^\200\034\330\326\274\203#E\023\202\307\202\306\226\224\3355k\235b\224~\031L9\256;\203\304\254 Y\354M\266\224)\005D"
+	.string	"A"
+	.string	"C"
+	.string	"v\214\223H\354WLt+d\354\256\245#\376\371\0045?>\225\301\210<\320'\216\017\207\320\243\245\324\025\030\211\230Qy$\251"
+	.string	"\274\022\350\261\273Wyj\360\270L*\263\273N\221\347\341\216\267\035\3016\005\373\233>\\\035\331\231\306<\345\247\216\362\307LCM\253\246S\323\257 \n\027\004Xv9|6\2664\2658a\373\225\235\342y\200\345\\J8\310\264\021(\370\034\305c\335\r\321\302bW\305\001'\340\370\344O\n2\245P\251\250\030uv7B\371\371\245\303\367\002R\032u\300\006\227\334]\220\352\211\355\fQu\302\n\f\222\244\341\324\253\352\304\322\2018\351\224\246\nx\231\356\211Q\25771\371\272\024\\~6\211K=q\227\326\351\300\200m8\r\036`\233\006\302\202\255\263\351\360\365\201\211\204\200d\332\210\004l\323h\"\231\266q\262\313\272@,N\210\246\202ui\035\353\303\200\263\021L\263\266,\323\254\212\024:\\\035\231A\215RH\271)&\264\205\013y\221\257\362LI\034"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\271\206\033\314\002,\302\030\2400\030\246\317\300\301]\002"
+	.ascii	"\006\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto__reset_template_45.0.29.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 \241u\004"
+	.string	"2\310\036(pm\032\003\360\256\257\203\242\001\036\035"
+	.string	""
+	.string	"@\357\b\261\006\002\201@\240\020\260\252\007\357:\313\336\277a9\323E\t\266L2\030\206\301\314\204\327u\301L\3157\2129\213=\214?\215=\307\240\307\037\344Pd\221\344\321d\217\262W\371\263\\>i\334fe*"
+	.string	"\3047\323\215\357!P\3124]uw\356\022w\b\214A\3436\353\325\013\324; \035\251\367+\352\315\250\3067\t\231\251\t\006"
+	.string	")\342a\036\202\306\236\222,\241B\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.37.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375`P\002\235\021"
+	.string	"\326\237qH\340\322&\035\242!\030\272Q)\221a\271!e\303P\037:`\307\350\030 8,\\\316\330f\247AX\3475d,\347\305\033\022\354\361|\001@\222`b\274g\bD\034m\213\0259\0075\343g\031\2037\247V\311&r\247\024V"
+	.string	"a"
+	.string	"`"
+	.string	"\023T~\307%\250\326u^>\256\314\214U\332%(\327u^\254\273(\212\206v{\034|\332\304\364i\037\307vk\306.\233\307G\331~\306\"\306\247\266\273\335\247\246\270\353*7\227\377\331\003\304h^\327\020\032\021\227\"\337"
+	.ascii	"\234\354\256M#\356y\333(\333 l\t\023\3776"
+	.string	"\245U\245\345y\376\207\024\350rve\226\224\266f\022\265\2203A-\267\234\300>t\330\202L$\345\324\226\303\330\300\266\017t\032.nI0\312B\210(-\305\274\250\355\216\335\247\307#\340>M7\300\371\264\003\262\373\374\307\345=6y\031\311\330]\027\351\317Z\366\351\3043\216/'\2600\035+\002\263\233v\304\250\371\221\344A_>\3558h\266\370\03368=m\323\251\237\235\301\313\b\2064#\310\317\211Z\246\220,\266\3415Vf\017\331\356>\020\372\020\350\253\370t\006\226|\214\305}\252\376\347\023\006R\r\247\004\020\211\253T\316\305\211\0341A`\344\222\324\033\353\366m\325\306\236\322\234J\317\357\004\276\340\205\254\021\r\037\312J\002\205OLU\200 \262PF\354\221|*\252\0240d\261\360\211\251P\005\f\305\025\350u^J\267R\245V:/du$\013\f\262|a'\202`\330\235l\313o\2536\216"
+	.string	"\344\bFa\2527\266\007H\333\3738\037G0}Y\200Tp\027q\252\234\332*\f\3621?0 p\002\231F\354<$\360\352aXw\323\300\027\t\214\202YOi}(\333 dq\231Lt8\265\374\231\267\330e\320<\223\325\345\006F\355\217\350\f3\206\243\245\201V\235\310\342\\\304\217{\354\007\367\206,CI\323e\026\232\357\306\206$&x\222\332"
+	.ascii	";[\306\024KB-VSx\233\267\336\002\320^\244\234\342\351\327\342"
+	.ascii	"1"
+	.text
+	.section	.gnu.lto_.symbol_nodes.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"m\006"
+	.string	"\004\nD\001"
+	.string	""
+	.string	""
+	.string	"\002\030\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\035\006\200\204\001"
+	.string	""
+	.string	"\003\002%\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\024\013\201"
+	.string	"\002\031\177\f\272\200\036\r\023\016\032\177\017\002\033\177\020\027\021\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\025\022\001\034\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\001 \177\024\037\177\025\003"
+	.string	"\013\372\363\352\266\003\001\204\001\003\002\304\001\003\002\013\244\001\003\007\r\344\001\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\021"
+	.ascii	"`h\327\320\250&\373\240\036|\300\203\236`x~\363\0302\004a\315"
+	.ascii	"p\020@\007px\251\300G\03008\315\250\360O\bU\006"
+	.text
+	.section	.gnu.lto_.refs.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\t\002\003\002\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.99f1bd1ad197362,"e",@progbits
+	.string	"(\265/\375`\217\027%s"
+	.ascii	"Z\302\260*T0RBJ\007\252F\362V\201\331*\333\f\002\206\221\007"
+	.ascii	"\245\006\371SQ\222\353&\2368M\330\374!1\021mim\263,\376\313\361"
+	.ascii	"\343|#r\254\2529k\271\325\016\346&\346>*\004\240\252\254\210"
+	.ascii	"\b\302\264\302\274S\024\252,\221\242\251\304\341\2062[\t\221"
+	.ascii	"2\005D\002\227\002\257\002l\221\036ds*\032\247\336\331`\324\367"
+	.ascii	"\232\372\006S\317k\206`\345\217\232\033\326\f\351\224\203`!x"
+	.ascii	"l\001\226;\253a-\307)2/\263\273\334D\031\353\364\215\203z^@\207"
+	.ascii	"\316\315\361\002:Vct\216K\263\362\324\246\323\356-\365\215\245"
+	.ascii	"\346\224\231\341\267\235./V\202\350\364\021l\271rV\305\355\n"
+	.ascii	"\026-V|h\313\302\306\246\245-\313\017\f\206\201`/\f\307c\230"
+	.ascii	"\f\213\3410\374\205\313\360\030\277\261\363\314\205\273\234\231"
+	.ascii	"\347\262(od;\204\361j\342\204\241\370\240\367^\211\361R\001\201"
+	.ascii	"\n~c7\206\302\316d\005K\260<\357e\236\315~\2437\346\201{\030"
+	.ascii	"\341to\321\006\001"
+	.string	"\276\3540E\b\271{o\003D\r\354\320\210\343\261\203(\345\313C: &\243\236\265\250g3\365\354D\005*\242\022\365PKp\r\325D\253\236{\370Y\n\2371\225\026\3565\336{\005\320\035\215\313\257NY\215\327\316T8\3552\025\t\224\367\026\231\312O\233{\213?\314\0070\037\220.\311*b\246K\037T\031\315\350<EH\207L2\357\017\3726\245\246\243S\034\236\232\202\207t:\026\322\261@A\375\233\013\365O\036\3221\223\237\360\030\tn\036\002\025G\211b7\354^\346O\317\033\035\336\260\351\364\034\250g\261\033P\274*N\244\236I\350x\216I\350\336\352\345x\210\311\317`\034F\002=B)o\331\275\314\240\037\346\216(\255N\317\344!\235\312B\272\237/\330\"\001\303\317??\003\375,\3643\321\317=?\017\375\034\364\263\210\237\003\370y\200\237\001\370\331\347g\002\370\377\020?\363\374\017\372;\205\237W"
+	.ascii	"\371Y\353\273\277=\3601\342C\177Oq\005\367\2424\341\377\210\237"
+	.ascii	"\261\016\3647\361g\252\237O\350\370\257\302s\376.\341\347\340"
+	.ascii	"\317L?\267?\263?\013\177\036\376,C\216\237W\370Y\351\347%\034"
+	.ascii	"\377\177\376>\363\363\215\237\221?K\375\f\343\347\031~\236\340"
+	.ascii	"\347\017~\336\340g\r~\306\340g\013~f\3613\003?\027\375\374\300"
+	.ascii	"\317\016\374L\342\177\363g\003~.\340\177\231\377a\377E\374g\373"
+	.ascii	"\257\316\315\315\315\375\235\342O\273\376 \2557\2114\201\003"
+	.ascii	"\016\255D%\022!q\242A)\201\222\344\255$\375\302\206\306\224N"
+	.ascii	"\373\253\221\350\2141\303\266v$+\b2S:%S\217\303\245v\221\236"
+	.ascii	"&fj\210\364P\377&2D'\246\025\206u\340\366\361\026\322]=\004\203"
+	.ascii	"\031G\234\257\266\347E\3468Q\3054:m\271Rvz\234'\365\275\354\254"
+	.ascii	"\267\326\265:\210\312\2746X\212\022\210\033r7\2314\2613\243\207"
+	.ascii	"\233\033\256w\220\227\341\271#pd\204\235\035\351\364q\275\205"
+	.ascii	"s\206\253\006r\013\bW\335 \343\251j'\2061\r\230N\307\372G\037"
+	.ascii	"\233t\02512\246\376\375\353n\021y\357\275\201\303\274H'\2363"
+	.ascii	"\016\263\211\277\207QF\340\177z\321\237\210\206{\211;p\251Q\217"
+	.ascii	"L)R\275\304=\216\363^\343\222\210\301r\312\270\344ql./\321H\204"
+	.ascii	"\030\204\274K\342\261yo\3205\032\211\033(o\320\261y\247n\214"
+	.ascii	".S|\231K\3425*o\3205\336b\211\243q9ul\026\247\202\216\315\345"
+	.ascii	"\324m./\3205\026\2213\214\027\031t\233\3133\267\251\234\002:"
+	.ascii	"6\225S\307\3462\311fG/I\246\310\270\262j0\227\243\361JEU\025"
+	.ascii	"\221@\316#Sy\337\356\345\262\247\213D\340\336*%\362"
+	.string	"\255\310\203\323\234\234RNgE%3\357\275\003D9e)\257\321y\374R\336\373\345\224t\243$ 2\2357\b;\211ZU\027\352\351^\002\242\356%\362u\336{\211\367\336\035\262\212y\257\r@G\257\250\250{\223DQ\267\212\250\366to\227\211I\233:6\263\224FjdM\257+\203Id\257\373\266D\252M\342\223\013\225F\365\232\302\201\246\323\2473Tf\030\217\r\033]J\254\253\206#\373\242\322Wm\245\243\346\253\313F\247UD:`D\240\260\305\251\217@F\026c\027\213c\274\330\f\321\310\236\352\034\335\243\245zG\337h\036\255\243mh\034m\243\251x\254\223}|\317h\032\357'\021\216\254\223\354\206\207`'\027\006af\236\235l\247..!\323IN\303k\330\311\225\206\255yj\211\301ox\256\214W\030\0326\317g'\273FG\2613\231~\265y\336{\373)\202\237\271t\222\3330\024\037\"\263"
+	.ascii	"\271\253\264\034\356e6\320s\246\352\313\220\021\351;\352\347"
+	.ascii	"3\374d*<Bt\340\330\322)\203\031\275\241~\274L\211#\322\351\321"
+	.ascii	"\246\332H\036\322!\200z\251G\271\324\243X\352\321\034\352Q(\365"
+	.ascii	"h\214.\376}9\013C\t^Q\250\230\371\023)\367%'f\007*%\005\306\006"
+	.ascii	"\210\016&\273$\311%Xr\004I\223\bQ\225\246\323\0337\272\354\250"
+	.ascii	"\361^\261y\355\216PQ\313\201\215z$\212l&\213\371\3302\241\316"
+	.ascii	"X\013\243fE}\233\243\267\r*\205z\341\271D\261kc'E\207\2547r\367"
+	.ascii	"\2304\341S\303\314\362\007*\343\250\324\321(\bT\034\016\b\204"
+	.ascii	"\214\254S\024\352\034$\r\331\221\006Z\303\b\231\2637JTt\306\003"
+	.ascii	"Vk|\2649ru\271\001I\247\215>\035\256\243\326\220Xu\212\306\270"
+	.ascii	"\231\236\263'\\U\250\021u\313\362\342\324)JD\213<v6\324\351>"
+	.ascii	"k2\242\260y\251\257\201\317\246\3537\357\271?'g\355\352\307\222"
+	.ascii	"\313\315\237\2633\003C\345\325\351\325,\365j\325\2325\315\344"
+	.ascii	"\003\240{\177`\245\351\300\272\240\260\274Q\315\336Wx\254\315"
+	.ascii	"Z\016=&/\216\013j\334\252\023\t\370\320\262\321\251\020}\226"
+	.ascii	"\346\f\2273\3529LK\273\215yn\351\26601]\372K\222-O#g\267\371"
+	.ascii	"\020\203\356\325\n\363\354 :\256\323\364\231V\303c\215\246\177"
+	.ascii	"xc\351,'\322\202\246\271\2745\033\232\006\323e\330\231\004\272"
+	.ascii	"F43:4\226N+\237T\313\341F8\035?h\002\367\204k3<\326eN\304\274"
+	.ascii	"Fe\032\210&\303\316$\017\3167k\344\006h\240\007\315\2277*\035"
+	.ascii	"\2311>g\314\2554\235\266\230]\222\007[\f\2657\036\3530j\\\016"
+	.ascii	"j\207\333\361AH\026\232\372]\231\372\035\230\332^\324\037\236"
+	.ascii	"VnH\324\357\214\250\337\rQ\277\323R\277\303r\3536\234f\0265n"
+	.ascii	"m\f\305K\033\224\023\225Z\202\311C:\023=\264\225\366\341\317"
+	.ascii	"\371Y\222\006D\n\016\365]%\004![\244t\232\362\253\350z\355M\345"
+	.ascii	"\317i\266\"^QR\352;\255\325\376\034\2377\"Q\236t\372\335\024"
+	.ascii	")sjzt\332h\352\223Nn\001\035+4,\252N\337h\177\363\300e0\346\334"
+	.ascii	"\b\321i\017\013\351Z\212\321\373l\307\315\312\323I\247<:62\262"
+	.ascii	".S\357\021f\217\217'Cz\207w\031\330\032\223\007C\021k6\373\212"
+	.ascii	"\210yo\354Dq^9\241\333\201\346\026\206K\354<\326b\355\305b\227"
+	.ascii	"\310\002\334\215+\271{\223't\260\330\274\371\322\351u9\2348i"
+	.ascii	"\246J$2\362lg\034\023\253\307\275\231]\276\210\230\271Y\302c"
+	.ascii	"\275\244\231\344\034\357\235:1\346\"\223'vH\266"
+	.string	"\256t\361\2247\223\277\301:\254\255\3220\034\320\216t\312\343<\303i3\3229\030i%\272{\231\251\264\201\fJ\301\240\006<\234U\311\205^\313\344\202\200\026>\366\347I(|l\221\357\005\022\3607\034\256\276 ;\202\217\204\366\007\374\001\001\177l;,Z\217\230\224|\300_\021;d*\022\241\244\304\004\004\006\201\273\226\247\223!\b\334\275\350\255Ji\223\320\267\264.\351\232\204\301\026\302\"$\241\220\017\310\264\003|\3218C\036O\313\003\"\tq\200HBt\205\361\033\246\303\341\312\036\035\365vM\302\240/e[!z\264\002\221~J\275\335\321:dJ\201\301_\353[\207\273\263<$!\212\236&\266\035\376\220V\022F\254H\300^\222\217\250\005\256,\313\344\033@\350\250\027T\022\321\324c\331\fJ\340\031 \"\005\212\226\355\tQ\264h\022\006}$Z"
+	.string	"\356\033\362\200\035\220\200$$q\337\217]\201+\222z\tV<\260\202\305\f\273\263\240 \005\005)tgA\201\221\021\005+\214\324\2570BS\240P!\201\222pimy\355:\\Y^"
+	.string	"\355\223\024X\227z!\b\2618\372\271`\223\332\035\0136\251U\207C\037\273\013\ng\340\300\307\352\2068\033\2000\002\233d\002\260\351(\247\005\376\202\302\027z+\353\002\257'l}VaS+\324\002W\037\273\nyJm\033d\223Z\021-o\205\221\332\376\226~J<\235\365(\350\242'lwOB\201\364{!\300\203\302\225-j\203A\266hg\310k\261\264\266\303\246\241\317\f\353\021\020\204\243\237\360'\206_\353\353\005\255G\301%\036\022\223\013\353\221\316\320\367k\207\277\266\327\016y/\f{\355O\222\257\375\311P\30208\302\212\021\206^\360\005\225|\354\032C\220\307$\364\365\254K?\023V_\217\365"
+	.string	"\t\370[b3"
+	.string	"\212\300\2562\004\205\"\330^\222/e\327\337\213_\013\\\217@8b{A\027~`$\271X\207I\272\243\225eB\372\275"
+	.string	"\006}:-\217E\013\3741\355nd\324\242\304\t!x\240\372P\254J\277\027AV\310[\333\036\253\024d[`\320W\344{Q\004\374\365\226\212|\354\260\bE\002k\333#a\205\361[\372\265B\021\330U\211\351hM\362\r\207\270\230i\224\036\\Y[Jr\322H5a\353\024\375\321\250\026\n\344\350\0174\353\020\2508\217\221\211\376H\371"
+	.string	"\037\346\003p\252\334P\034\323\245\317\001\262,\223\313\362\303\f\037\355\245s\211h>t\212Z\241V(V\016\021\2006sWir7\231\303\304\217^\035\305\352-\037!Jx\224UIu\250\201\265u\372\234\032\352\217R\035\255\372A\263\303\007U\247h\017\324\006%^fa\306\016W\346\b\231\265&\235\242<\320\344\271\002\201\301\250\2214\246\0303#2\"\"2\222$I\007\341\004\204 (\245t\346\001\022\20055\222)\210ddd&\005\005\225\302\306\001\220a..\300\207N\270\241\317P\364\203\310m\013B\004\241L\235\254w\2211\252\375\303\037\343\"Y\005S\031!{{$?4\352\300\356\203W9\261\315,P\377=\301\256o\177i\022t\021\342d\221\234\301\006:"
+	.string	"\204\242\240\341\023\341\255\234\353\235R7\336\020\241\330\375\033&\357\312\0132\371\030\266\032\277\372>\357\002\337\302oK7p\372Z&wAxp\"\002\"\271\030\241\304\254\205\353b\r\030\302\205\027\363\342\372\311M\004\274):e=fz!\205\021\372!\355\263\030\310\221\350\360\340\315nr\200\257\327,\342\2351j\223-K\302\222\013W\331\350\323\320\265\367\n\224~\025F\005\331\334L\031(\243/\026\300\001\007\234\227\020|2s'XsO\034\351N\216\035\336@\243`\202\2735Bb\004q\035\362\317}\342\226NfcP\257M\222\026\344g2\337\226Yp-\243,\247\241\336\232\032/\201\b\250\037s\367\205\230"
+	.ascii	"\3216`H\203\266@\027\004\021\207\253bh\026S4\037<\333\032S\346"
+	.ascii	"cr\243y\264\212\320\334\372t \337Nw\007\275\243iZ{\360\273N3"
+	.ascii	"|\364L\007}V\271\326_\235\017c \247\310\210\3025\033AR\221\303"
+	.ascii	"d\rqfSPh\346\343v`\206\356~:\200\267\013\375R\007\207Y;Q\234"
+	.ascii	"\305r\320\200Q\201\271\025q\t]\210\323\274s\3230\311\343M\276"
+	.ascii	"\277\024p\231\006\3143\221l\264\177\025O"
+	.string	"\322\340\003\226\337\031l@\f\206\"2\302\242(RZ\230\032hI\345\026\262\367\306\232M\336?\017y$S\013;\240\\\354\232 \256\317U\227L\f\353#\317\264\237\362\201\330\005\326V\037\325B`\344\301\026M\006\306\005\335[U\303,\232\231\353)\373\262>\306\205\016\312\235\316\203=<\036\361iP3\177=EK\352\236<\236y.\205\213c\220\006h@>>\f\0310\275f^hW#y-k\367\207\336\\\266{\201E\001\025\357\032\021cF$S\217 \231\017\363\0204(r6\200\314\325\2770U\022kC'\n\224\265\301&\304[;\212\021=0\316\311\367\355\352\302\376j*,y\314j\221\236\236\243\324%\342\233\323\177\354|\226\025\376\t\307\362\251Q\200h\353\371\006\233\206\031\\\003\314u>\035\223\b\355~\204\246\323[\227\334\324\001@P\024\366\356\275\342$\235\374#\316rIPj\004oW\201\375>"
+	.string	"$\247]\020Y\233Bd\024\004\330\257\"\234>\354V^\327x\256\243:U\356[\302\035\250\211\f\317\024\246Q0\313\244\0173qt\367\203\031\353\376\023)jo-G\206\244N\322\335\231\307\033\336\242\356Q:\366=\310\rBY\021 \262\257y\232\234#\247Y\355?\201H:\327Dn6\223R\362\230\264\247\377\262\301k\350\236\340\3210`\021aN\370j3`M\310`-\367K6\267[\333\030\240\366\316\266#+\256\033\364<\201_\2639\216a\2629\320\200\246>\021\236.t\251q\2305 \\o\334\325dyt\023K<\2777\022y\316\234\322\305\226\002\334"
+	.ascii	"\246`\276[\303\ts\003\324E\376?\003=&\372\212_O7\336W\262\211"
+	.ascii	"?2)_\242Gy&\201=\361$:\024\036\036\360%\2752\r\034\036b@\343"
+	.ascii	"\003\341\214\271\271\325\330\223\223\317\243\352^!/\244@\003"
+	.ascii	"\312$\255\023\332\373a\250\250\001"
+	.text
+	.section	.gnu.lto_.symtab.99f1bd1ad197362,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"rcChangeProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.99f1bd1ad197362,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3498 @@
+	.file	"core.c"
+	.section	.gnu.lto_.profile.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\024\0045\024"
+	.string	"\004\030\b\005"
+	.string	"<"
+	.string	"\336\224\344V\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\231\357\210\200\005"
+	.string	"\n\201\235\343\220\005\b\001\002\006\002\001\002\007\r\312\246\231\203\001\024\b\002\t\n\002\n\002\001\002\013\002\002\t\017\240\342\234\212\n\023\240\211\225\311\t\022\002\001\002\f\001\002\r\002\001\002\016\025\026\033\243\262\274\213\017"
+	.string	"\034\250\200\234\374\004"
+	.string	"\035\235\377\255\301\t\004\037\267\372\245\305\017\"\017\002\017\002\020\001\021\b\002\b !\"#%&'(\233\304\365\321\002\002\002\017\002\017)\214\233\312\236\002\002*\347\342\342\300\001\f\001\002\022"
+	.string	"\002"
+	.string	"+-\301\220\255\270\0060\t\001\002\023"
+	.string	"\002\024\002\025\002\b\002\002\t/02\311\202\342\200\017\r3\376\336\373\325\016\n4\364\355\322\327\017\026\002\024\002\026\027\002\027\002"
+	.string	"\002\030\01379\266\213\316\245\007\n\022;\266\231\367\251\004\030<\315\347\335\233\n"
+	.string	"=\304\306\257\225\005\f\001\002\016\001\002\016>\305\315\211\206\b\246\001\005\004\002\023\031\002\031\001\001\002\001?@BC\234\361\365\241\r"
+	.string	"D\350\300\306\254\005E\234\346\300\362\007"
+	.string	"F\312\336\235\231\b"
+	.string	"G\343\217\360H\002\002\tHIJ\354\206\342\366\006\002K\342\201\222\246\004LM\252\257\370\340\n\002N\202\321\330\342\013O\374\202\331\242\rPQR\264\264\266\260\rS\240\342\234\212\n"
+	.string	"\200\206\250\0016!\222)%\005\2514\006`\00224e\266\001\021\360T\204,\323h\3313\371\0055\022\306"
+	.string	"\\\335\030\3235\352\3263h\263\370\3669\377u\336Q\301b\323\257\371q\300\241G.\256y\005H\351[\374"
+	.string	"\265M\"\351|\225\375v\344i\034O\203\352\317q\270\360\331\324\264\210\332\\\002\336pLK\260r\343\226\322/\007D\234O\\\207\266\352\256@\344%\205\312\037Q\372\370AuB\356\031\254\211d\273\351\035qQ\036)\022#k\304\036\f\323\312\337\316\2207\261&4Dj\333\003\367\bcP=\350\260Q\032\217\255G\035\036\276qQ[*\363E\323a3^w\271(\257\232q,"
+	.ascii	"G\264\203\340\337;\357\254\307\271\253\213\2267q?\256\361\341"
+	.ascii	"\3300\346\003\037\341\fX\334\245EG4\026\035\223\341\335qZ\374"
+	.ascii	"\032\b!F\207,\330\237\021\232K\177\352;\330&x\314ov\326\230i"
+	.ascii	"*\206\217Uf\321\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`}\001\205\006"
+	.string	"\242\206\022\031Po\322\00103\263.\034PgF;\225\b\r\200\340\305a\310\357\222;\245N\313V&eN\246D\377#\020\255\367\230\216r6\366\037c\261b&t\304\036\326\260\027\334\t\016\004\033\330\023 \202\336\247v\374F'\263&\353\022L\250\360\222\250\320f\200\0029H\254\003\020@f\244\210\2700\007@\261-\177\315\211\3447\024+\336m\30641+\022\006C\177h\230"
+	.ascii	"\013\330D\204\324\re\305P5\247\\\241}\204|\232D\221\252z\245"
+	.ascii	"\020\304\357>\345\321LBl(\242%ty\r\325&\214\244\212\352\\8\230"
+	.ascii	"\310\321\326\206X\t}\236\375\251R\377\367\224\035\360\326\021"
+	.ascii	"T\326\302%\234\004@\037\373\025\373-\264\f\206\266\2505\376\257"
+	.ascii	"X\201\r"
+	.text
+	.section	.gnu.lto_.inline.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`N\n\235\033"
+	.string	"\326[kH\260\226\325p\2228."
+	.string	"\324\001\356\273\345\370\204.P\2048*UeG\222\316\222\207#\017\302\001\254\013\224\261\321cd\235\237\235\r\360m[\203\323\005\264\337\016\t\230O\206Vk\275\222\254\224\177\026\227\230\246\326\276\307\226R\246U"
+	.string	"T"
+	.string	"\\"
+	.ascii	"j\263;\273\032C4\367\001\255\332\223\323v{\300OA\034\333\204"
+	.ascii	"\007Hi\253\366/\221\263G\304\222\355\314H\347&\346)\325\2728"
+	.ascii	"\207\n\032\020\313\376\032[)C4\240\002\007\240\372\177\205\367"
+	.ascii	"[nw7\371\277\370\007\361\367C\263\277\302\2307\f\332a\360\303"
+	.ascii	"\\\225!wps{GN\211\005[\240\013!N/_0C\355\215\3350\bu\005'vK\036"
+	.ascii	"/\003\343\242\237&\243\021\373\263\214\203\347\260w\335a\356"
+	.ascii	"\332\241\027D\026\253\233\211k\212\371\213\201_St\267\371\277"
+	.ascii	"\270\247\273U\356\242z\235\221\177l\215\264\210\302Cy\366\017"
+	.ascii	"G>\246\245\n\307\340\242\256\355\0131\026\022\372\2003|D\350"
+	.ascii	"\003\256n!\005\204iEp%c\311\311\006\202S\300\321\335\036^\234"
+	.ascii	"\324\335\t.\241\247\273Yzt\233\002\036\341We\237]\020(2=\233"
+	.ascii	"\322\214\003\207\240\343Kp\021\007g.l\235\b\345\360\224\247\205"
+	.ascii	"e\213"
+	.string	"\204\211\020\351\304\027\021b_\003\342\303;F\221#\326\"%I:\033\274\303\213\303[\265\332\r\371\227L#\307\013\256\024\247\024=\021\370\006\232\3534\320t\034G\023KD\374\335\306\243^n\016\371\313\370\304\371\370\215KF\0350tZC\266,\212\357\331\206\213:8\037V\362\031\2665\331\rI\004\200\325\250A\"\022\231!-Hj\2441@B\203TU\325\003\022`\301p\006K)\020UJ9T2\0256eU\316\001ph\021\315\270\336|\370\264d\214Ni\240!\215\364\234\214j\356I\352\216\342\361\307E\255\022\2551:\205\226A\324\222Y[\036\347\245\231\346\021o\302\341\3508\234\211\340H[\r \017\255\362Ev\254>\233\352!X\350\001\201r\022-3/\367D\332\350\2537jL\202B\373\306\363i{\254:\024\177+Z\220,,d\033\337w\312\371w\204AhRs\001\02774\360rV\372\367\333"
+	.ascii	"Z\0226\326\207\223\357 \016\223?\342\323j\2311\222Y\2614:F\013"
+	.ascii	"d\222\004\tQg\361z\374\336\360f\340\333Z\267\034\305.N\261\267"
+	.ascii	"\fN\206K{\253/\220;\030\036\370wN\253\3320\376dO\006\241\234"
+	.ascii	"|1\n2\375EH\320\323)H\021\304ktP\207\215rh\033'\026\246\202\314"
+	.ascii	"\237\f\274j\261\306\317\257\222\273`\270\341Is\350\210w\332\367"
+	.ascii	"\216\225<\006\034R)\234\257B\220\301\206:\264\352\200\026\003"
+	.ascii	"\200\254\220f\265\224\355\306\211\022\2047>R\334\354\350A\343"
+	.ascii	"`\207\314ii>w\222\034\016\376\016v7\017y\023\364.\302k.\232\221"
+	.ascii	"\212\021\275\337\343\263\331\374\356\210\207\246\377\225\361"
+	.ascii	"\364\026<,\360\271;\004\376\333\346|/V\024=\375\033\261vw\364"
+	.ascii	"\276\343$\334\r\310\231\360\312xy\345`l\305\334=\001\273\t\337"
+	.ascii	"\214\2047~\262\332Lt\222*\230\263\357\244\234\177\255-Q\301\243"
+	.ascii	"P> H\203\tH\007\206r\002(\327\212\331\204\311\246\033\217\274"
+	.ascii	"v3\371\032\323\325\3150\1775qO"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\233\t\355\030"
+	.string	"6\231Q=@O\223\016\223\f\3403\023\006\260\260Ea\2419\342g\177'\3130\214q/\340\316\3030\f\303\273\240[\254\217\223!\357\030\213\341fbQ7K\372\357\023\336\275\375'\266\255$\233\244\224\002;"
+	.string	"D"
+	.string	"B"
+	.ascii	"~\251\301\277\355\f\236&c\231\351\227\306`\347\f\342?Fc\371W"
+	.ascii	"\f[k-\212J\335\267'\224\317\347\363\361\3107\312Rk\316\374\316"
+	.ascii	"HZ7\316\304\215\343N\374\362okU\252\020\257\247C\035B6\201\266"
+	.ascii	"\001\332\002h;\032E\033\033\206\033\270\2611\030\277\204!\231"
+	.ascii	"/\027\027\026\270\251,\3021\306r8\306\214eF\206_\302\220hY\356"
+	.ascii	"\203s\036,\026\277\354p]\034b4\366\r\376\377\252\n\355(\240\346"
+	.ascii	"\345\tk\362\377\005\2735\013\204M\370\237\246+\363`FP(%Z\033"
+	.ascii	"\202\344O1p\b/PP%h\235\313D\320\036(\006\206\201\313\227\254"
+	.ascii	"/y7\360\333\002\355[x\b\232<\036`\001~m)\264\023Z\tm\204\026"
+	.ascii	"B+\225G\"\257\324\203\354\2673\255\203\266\0361F\3474488\352"
+	.ascii	"\026\376\237s,\374$I\"\361K\257\360\337\232\n_\003A$\234}d\037"
+	.ascii	"N\341\267N\307\231\274\205|\201\005\250AaV5I2l\006\201\005\204"
+	.ascii	"0\307\034;\017\022\240Q\222\222\346\b\"L\251\032\231i*\331\231"
+	.ascii	"\003\024\321\036\265\273R\251\245yoZ\315\260\374I\255V V9\234"
+	.ascii	"W\216\222Wl\251s\b\351\023th\276\366&Aj\361\220\254\315\213Q"
+	.ascii	"\237\037Gu',x\350H\202\036HY\320\344\270\004\313Q\034\"\346."
+	.ascii	"\323]\373Q\262\016d\271\375\"pD\274l\217x\362K?\243\315\211d"
+	.ascii	"\\\251\266*\215\214\317r\275F\006i\261\003\250\264\013\315$\007"
+	.ascii	"\n\203\215\245+\234R\300p\241D)\256\222`\221\027O\005)\006'\273"
+	.ascii	"`\2107\307?\235\340\2327\375Ds\b\271\025^o`\001*\301\330{U\224"
+	.ascii	"au\nt\027~\005\022Q*\371!ZI.\333\335\277\336\300<v\305\250\360"
+	.ascii	"\354\201PV\261\330\300\352\306/\\ x*\205\204\246\204\354\266"
+	.ascii	"\306\227\027\027a\345\372\213\322\"\032\264\204\276\232j\231"
+	.ascii	"\210\305\034kp)w\f\301\030$\020\322T\355\206\274s\304\274\031"
+	.ascii	"\326k\r\216\337\003\200\276&\203\265\345\fGg@\252\221\207\263"
+	.ascii	"\301\317\326\327D\242\022\330\017\307Fx\242=\213\013n\225\315"
+	.ascii	"\301_\362\215\016=\005\312\343j\n8\023\006\342\037\352\313\031"
+	.ascii	"T\222\261\302'\375N\334\22504\256\265\301\366\267\274\336\211"
+	.ascii	"\026Wt'XdW\261S\250%\3419\3625\201$\345\321i\257C{0g\034\345"
+	.ascii	"\234\332c\025\32710\237Dp\001\203\371\313\345\304\214\206\b\316"
+	.ascii	"\222'\227\204\016x\307\310\017\346\203\207\036\272)8\0312\221"
+	.ascii	"N\210\206\240\345\013P\202\204\335\323(\300\334\b\315\273\300"
+	.ascii	"\342\354M\202,\276#\326\023\340\351\301\261\335\202\001\236\210"
+	.ascii	"\227#\212'\243\332a\212\013\261\225\001"
+	.text
+	.section	.gnu.lto_.pureconst.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 b\205\002"
+	.string	"\"\006\023\034\200k\032\003'\214f\240\223\240m\256\341\314\230\031!\201\242\007\313\375_tX\262\222\001\236\304#\036\304{x\016o8\303\027\236\302\023.\204\037\334\340\025\234\340\032\270\300\003\016\360\311%\217\\9\344\217;\336\270\030_\\qSf6\t"
+	.text
+	.section	.gnu.lto_.ipa_modref.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`)\001%\007"
+	.string	"\262\211\033!\200M\206\003\210\310\210\214\310\210L\307\205\021 ?\260\354\310[\326\210\330\377\217\331\021\313A|\333R\246\377\317W\376>\236\357\314\3717\032f0\377eK\265*\007@\244LH\327/\bq\342$\337:\037\345\216\310\257\212\312#G5\312o?;\3744\260r\346\n\317\350\\t*\312\251\316V\236(\200\204\007?\247\362\251S*\227\332'\342\2622 P\0022f\306\003\343 \3126\217\250v\334`\207\352\030>\013l\341\030g\310\374nk4~\027T\262\274~\204+t\n/\252\214he\244\201\206\262  \004e\231\334\231\221\301\3038\312\020l;\372.\350\354i\225"
+	.ascii	"].m\213\330\257$Y\200'4\020\210\301\034\272Q8\001\037\324q\237"
+	.ascii	";\354{\337A\026\nitF\253\t\343\001j\"\334\342\016\001"
+	.text
+	.section	.gnu.lto_.lto.d29c63c66af31638,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdLaunchControlModeNames.127.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bX"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\350\254\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'*\206\b{\370\345Ry\276'5\206\bw\230\345\002u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.131.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \217%\004"
+	.string	"d\007`"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\203\354\202\031\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\337\030us\355\007uq"
+	.string	"\005\001\006'\001\004'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.133.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_isCalibrating.134.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\246\001\035\017"
+	.string	"\366\032aD\020\221\223\016;\372\204\273^\21465I\274o\332\255\257Ft)$D\343"
+	.string	"\024\305\267G\001\177\276qDA\266\221\334\202\377\256\026X\264G2"
+	.string	"Z!\021U@\205\276\254In"
+	.string	"\242\3752f\311\336dK\231RO"
+	.string	"J"
+	.string	"N"
+	.ascii	"\233KF\013\256j\376\366\215\3744\370V4 PV~}\244rY\342D\245\323"
+	.ascii	"H\322\251\305\361HF\024\302\002\037dR8\036\007?f\204\320q\032"
+	.ascii	"'+\272\001<\016\016\230s\276\345Z\342\221T\345g\316i-y(7\200"
+	.ascii	"\333f\261M\300\376\213\326\260A_\372\276\345W\215\030\246\035"
+	.ascii	")n7\033\265\351~\366\341\\uG\325\227\325\322\352h\265e5T_@h\326"
+	.ascii	"\320x`\3464Y\361\2302,\027#l\213\330\034#H b\355\250\223\211"
+	.ascii	"\034\231\351V\324\314\211\302V\304\265\007(B\342\376\004\324"
+	.ascii	"\027\231\024\227hm\006\265\226\201\211\333\355\207\341\222\342"
+	.ascii	"d\301]\340a%!\244/\301\2150CbG\212\264\233\367\244J\265\200\177"
+	.ascii	"\271\356U\033\265\263\220\276\244\373\016&\322n\3279\347\266"
+	.ascii	"\326\342\367\201\n\034\234\252\034\025\036Ct\006y@D\031\b\003"
+	.ascii	"A\300(\2048\230\200\201D\0260\317\207\263\n \"\354B\226\2110"
+	.ascii	"\016j~Y\334\371V]\314\325Q`#\007L\314\376Z\224\226\353\317hI"
+	.ascii	"\233\375\254\321\300U\036\370\265%\366\265\235}\327c\244\253"
+	.ascii	"\353\332\357\312\201\305\r\0232\256\006( \220\202)\271\362\t"
+	.ascii	"\005<s\274\220\302\233\013\034\232lWb\r\341`\330\304^\2140\333"
+	.ascii	"\275-\365=\221\233y\371m\261o\255\266k[\314\306t\002\003v\206"
+	.ascii	"\020\216P\274\211\017\n\221 \243\355\327\222d\204\274\275\005"
+	.ascii	"\265\2167\216\273\241\253\215Q\223\247\225o\235c\266\001\324"
+	.ascii	"\265M\240e"
+	.text
+	.section	.gnu.lto_canUseLaunchControl.135.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`3\002\365\021"
+	.string	"\306\240uH\340\360&\035XX\017\364(\206\240{C\020\355(\335Hx\235\002\321\346"
+	.string	"\b^\023|'8\035\2475e<\317\276\355I\356\253L]\240f=\202{\230\260\016\340\250\007,[\214\027\360\230<\354?\325~B\310&[\312\224\002c"
+	.string	"W"
+	.string	"e"
+	.string	"20\023Ls\332\302\3359\353\037\237\327I.\256\262\374\326?bIN\214\f\"3>\330\270O\315\215~/\033\365@\331\313\247f\246\335I\006\213$s\316#\325\314T^P\35617\217'PfA7\226,\261\320\001\312^Q\204\246'\366\237\253\214\314\245\332\235\3149\2551\031\206\373t\333A\266\007\330\232 k\205\315\\\007z\220\213\017\302\025^\364\261s\376\213<\367\355\341@\"\007h\026\243=l[K\227f?\3169\247W\307V5\312\352o\325\236\325\235\325\322j\316\352h\365\252\372\002\\nL8\020$\315I\323c\307\274q-B\330\206\261O.`"
+	.string	"\306\254\333xh\276\023\227\341\301\265\255\1776'^t\\"
+	.ascii	"\ry\003i\253\244\3641n\001\314\214@\3254\324\344\322\204\036"
+	.ascii	"A\224\300\035H\273\345\201>\026\027\234\351p{m\353\300\355F\215"
+	.ascii	"[\332\227\307\021\f\027\221%wY\206j|j\253&\350c\273`\021\316"
+	.ascii	"\315\265\255\3634-\255X\217H\324\376\347\036\322\220\322K\233"
+	.ascii	"\034\362\021\371E\005N\231\254\254T\2510\305\022FhQ\201\020\246"
+	.ascii	"V.\241\211\210U\022VV!\005\225j\025\236l\363q\256\216e\022\016"
+	.ascii	"\221Q\274\320\377s\005I\033\210\214\276\237%\277\225\261\375"
+	.ascii	"\255Ob\326\365\2614\243HoY\206\224|\024O\201\262 %E\236\363\266"
+	.ascii	";RQB\346\230\271\276\216dv\013\026\325@h\210\200yr\267\207\201"
+	.ascii	"\334- \300\002\231\251\252\007\305\b\355<\tO\364M<&\030\345\001"
+	.ascii	"wm\242\230\006/\rdf\330\206\017\372\225w~Y)\223\354s\013 \301"
+	.ascii	".\373c B-cg&\326P\227\201\215\240\203\034M\260\2519\024\330\310"
+	.ascii	"B\366\021o\316\270E.\275\217tq\001\231o\222\206\336a2\332^\212"
+	.ascii	"iXG\365\262\252L\354\001"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.136.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \341\025\006"
+	.string	"\362\312)3`k\323\001Pe7::-\255\3350\n\251P\220p\3533\3524\213\265 \215\007\307u\255\336hr\013\340"
+	.string	"\013"
+	.string	"\034\234\025\216\034\226B\006\375\344\357\235R\236\221T\351\2243#\0014\230\215\234U@F\022\323"
+	.string	"\251\312\001J\253\204\264}\314.\026]\025\013L\271\377p\bs>\203\t\274\301[w|o\217;\017\006\347iT\360\2635\nF\004\373\216\215\231\035#\025\027\025\212\335\353\333\330\316\231h\260}\310\223\235qMa/\261`\020\341\355\256\214\t\237\016'\377\016\207X\030u\370Xv\327\320\302\016\356\370\211\355+\t"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270tc\266\266\353"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_updateArmingStatus.137.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"-\t"
+	.string	"v\221?9@\305(\035`\255\376\217\230\244\310\034\337\273\307E\203\325\020\177=8'f)#\246\374\224\362\233\352\270\241S\004\200a!\207a\346A\261\223\316\320'\311\331\221\355\223M\244L)."
+	.string	"."
+	.string	"/"
+	.string	"\357\374\322\354\370G]\300\373<\277*\025\327\353\"2y\003_w\025\254B"
+	.string	"\034\365\234\370@\231\224\203\335uz\037\305\035o\033\3016\201m\222\252.\025\303\276\206a8\300J\262\237\216O\037\373\td\235\030\204\273\242P\300\202Qd\303\366-\356\330&W\225\366\037\246\220\007kw3\315\b/\265V j\f\026\365\250WF:J@\331\362\217\301\256Q\235\241Q\367\3249\"|\rKp\362\336\243\317\301\036\257\031\013\360\"5\372dh\007\3262\032n\3232M!kXH`\3104n\223e.\336\0344\\\366\260m\\fQ}~\255\222\034O`\200\325G\273kw\367\242\244\275\201\310{V\365\004\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.138.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`|\002\215\023"
+	.string	"\366\242|H\320\362&\035V^\343Q\334\362{5e\236)*\003\252\253\200\237\252\017\250b\262V\230\016Z\226\031M\263\250q{\251y\t!\353\001d\375\220\240\t\342\311\021H\216\227\020\367\n;\244r\322\330z\203\366\020i\233l)S\nk"
+	.string	"\\"
+	.string	"j"
+	.string	"\363@2f/\230\346\234\254E\361\230\203\037Jzq5\306?\317\301\220&s\360\261\233\177\007T\324\324\024es\031Ip\350f\006l&\232R\264\020\352\305\225\216\023<Lp\214H\244h 4\212\320f\221d\316\231\242\315\350F\023%! ?\252\271\211+\232\235\360<W\0214\231*\252\301\234\323\032\322F\334"
+	.string	"n\373f\033\201\255\270\347\371w\364\263cF\235\374\217\310\257j\255\263\232\354\271\367\274\370:\376"
+	.ascii	"\243\017\357\3710\362\336\367d\007\207\223\253\305tg\373\310"
+	.ascii	"to\366w\267\333\355\2746\373j\225\252\301U\177W\243\256\226\252"
+	.ascii	"\366\256\216W_\300\205r\230|\250\004\315I\263\0232u\336\215\024"
+	.ascii	"\266\237r\214\235t\037\\\272\036+\274\275Y\277\"Q\253-,<\250"
+	.ascii	"\006j\027 \365\304<\224c\201\213+R.\314\276p\240\225o\316\231"
+	.ascii	"\004\376\214\323`\361u\356\271\345r\311{r\031\354,\341\344z\274"
+	.ascii	"\365a<F\206\026\027\027yo\211@\265_\035\364\241\267\005lnt\262"
+	.ascii	"\225q\334\237\207?>\344/\362\033W\305(\307\254&;\316I\311\306"
+	.ascii	"zD\2526n\235\270`\257\026\253\205\201\265\241\205E\003\253\005"
+	.ascii	"{a\235\254\374\342\340\202\261<\274^0V\312'\3668\327V\241\204"
+	.ascii	".\266\2628\347\234\240\203]\231\257D\202\013\373A\322\275D~\013"
+	.ascii	"n|\"\240\366\003\b\372\360[U\321S\004\227\213\234&\245\243H\177"
+	.ascii	"\350D(\022RR\344=\360\026\204i)\206Z\251=\201\202>\264HQn@\216"
+	.ascii	"\217Mn\200$\005\0016 \220\002\031\251;\017\323C\317J\340\273"
+	.ascii	"\256|\250\313\352\202\313\225\276\243\213r\001(\263\263\213\304"
+	.ascii	"2\272\021\340\335\304M#\227s\250\200\245dX\276j\324\217f\205"
+	.ascii	"\204&YPk\f\305z\\\313#\323v\021d\321\225\230\264\256\3261\320"
+	.ascii	"\222\222-f\333\304\031\206\314] \276yP\261\325\204XM@\201\271"
+	.ascii	"\232\265o\330\206\271\031b \037\243v|1\315Y\270\225\013\246\252"
+	.ascii	"\355\370\332\007\005"
+	.text
+	.section	.gnu.lto_tryArm.139.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\367\003\325\032"
+	.string	"\226\357\247I\260XQ:\360\245\324e!_\320\202\b\373pU<\242i\007\354\3743+8\320'oT\351\031mD\224\302\353\037\247\254|n\226\272\307i)\037*((O\bpO\370\024l\005\225U\003C\236\037\b\374&qo\"e\222\001\224"
+	.string	"\210"
+	.string	"\226"
+	.string	"O\272\322\212\007W"
+	.ascii	"\021\242_\260\326J~\356\256\330%?Erk\273].\334Q\277\344E\216"
+	.ascii	")L\255\025\326E\257\235\206d\255\306\031:\305\346\332\236\305"
+	.ascii	"\003:MN\016!\337I\251\235\357hg\203YN9R\273\032\274\272\315\367"
+	.ascii	"Q,@4Tu\251]O|U)s/\362\234\243\235\217g\216v4b\360rLg|\332\360"
+	.ascii	"X|\251\005\2132\336b\202\251'T6<\234\350\n2\322\035\351\354\202"
+	.ascii	"wc\236\321\251\265.\353xB\337\232\357n\271\273\017v;JJH\214\265"
+	.ascii	"\342\032\354\221<I\317\236\307\347\316N\360u'\350'\367\221\316"
+	.ascii	">\202\b\371%)\331x\270+\274q\003w\337\303\341p\270M\264Kyo\232"
+	.ascii	"\327"
+	.string	"\365\246o\253yk(/\213\362\256&\357(\362\322\346\235\"o7/7\357\007@\340\362\363\365\200\321X\2045h8\246\226\023\212\2177\375NK\356\217\234\251\366\246\205z\341\204\225\227\241\314\224\240\202\31750~\276\356\242\237\342\001\320\007/\374\222\212\007w\006\311\242b7U\026\352\302>\355\023\375\274\322\017\bEe\371\005\301\330x\270Z\f\035\216t\235[\221\224+Nc\003\241\374\343\227'\237\375\250\331/r\004:\230T\365l<\344(\026A?fR\320\276\341]\r\033\370\272\036\265D\021VM\335\032\210\006\340\375\022\207\016=qh\315(\365\343PW\327\364r\256w{\223;\361\260\347\261\037b1\372\351\352/\235\215n\224\277\244\236h\303\013\276+\033\301\327-\r\225\241\022\327@\337!f\312I7pIPn\020F\266\340X\314\356\362<>\263\237\230,C\bY\t\020\261\037\236\t#|xzh\261"
+	.string	"\273\303@F\233\355\300vD\300|xb=\260\035\332\017\214\201kg&d4\030\212\331\214\006#\205\266\353\330\372&\326Z+\215\001\276\351\335\332\220\032\222\323/\303\212\225\262\3257\275\254\373\322j)\262\210\212"
+	.string	"\016!\021\331\300V\263\3729\312Z\322>\261\232,\242\032\322{\361\252w#H\240\327\265\3725\366\252'S\256\f\016\357R\250\300\327\215}\247\337h(\252tPz\001\302j \324i\323,\320*28\024|O\345\001U\250a\034E\025S\314\314H0\022\244\202\244\205\003\200\002\021\2713\017\020H\350f[h\f\362\240>.[\302\232\310\327\362\250\220%\366\311\016\376\\\256\214 \030\035C\225\375\0329\003\032\017*\022\223\307\001\"\210\236\305\206o3\275\337\317\345\203\252!\272\251\303(\211"
+	.ascii	"N\017\240\367\247\353#\216\222B\3074,\331\236\276\342\326\211"
+	.ascii	"H\377\333)\373\376\177\273\223\354\305\374\244\220\017\306w\232"
+	.ascii	"!\253\372^\013Tnt\272\214-#\354%&\204\017'\212.\211\200\221\201"
+	.ascii	"\275\031\321\361c\033&L\205\332\355\n\334i\t\341\305\356B\b@"
+	.ascii	"\t4,8:,\276my\275,\344)V\250\001"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.145.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`M\001\325\f"
+	.string	"&\225M? O\225\016\300\022\310"
+	.string	"|\301\030,4D\201\255'\366'\036\304\236P\374\3208<jVNT&\374F\330\261)3\243D}\374c\r"
+	.string	"\fT`"
+	.string	"`\201\bP\002w\240\372\t![\312\224\0028"
+	.string	":"
+	.string	"@"
+	.string	"\273\232f8\347\330eAM\216\217M"
+	.ascii	"|\321;v\031\"\272\025!\213\020\022\006\210\242\253\200\370\201"
+	.ascii	"\005v\367\037\236\023\242'\023\233\354\256\363\213\026n\310m"
+	.ascii	"cl\033\260\337!\327\\\267\256\032U&\322i\324\311\017\033\345"
+	.ascii	"\245\226\354\303U\f\366\323\360\351|\372\031\305D\250B\274\004"
+	.ascii	"\027\273\241\217\031\273\262Jp\260\375\314\034\273\305Q\032\226"
+	.ascii	"\200\007\n\240\02016)\025\f\250# \213\357E*\324\203.\210h\220"
+	.ascii	"+H\247\021\324\3227\027\207\203,\245BA\002\341\361\215\247\256"
+	.ascii	"1\"a\362\310\335\365\324\233\353J\341P\361I\031\366O\327\330"
+	.ascii	"\370\033\374@\223\377n9\336$\225\216\333\264\r\201\206\261\034"
+	.ascii	"\270h[\227\321$\003\314)\250t\032\003\216\353\264\f\265\3578"
+	.ascii	"\261\352\250\007b\221\214\334r\331\t.O\321\261\261\372\354\005"
+	.ascii	"I{A&\377Y\325\273\245%\250\032- \220\202\241\271\365b@0\334U"
+	.ascii	"X\240(\3574\226\322\275\260\n\360\210E\221\357\330\211\346\334"
+	.ascii	"lam\2211X\300\016p\266fP\006\332\325\030-\024\022,\002uc2\346"
+	.ascii	"8/\023\236=\036Cp9\274HU\030W\334\017\320\016\377\335\360\357"
+	.ascii	"q\007\362K\036\225\250\353W_\222\235\355\r\220\267]F\017"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.146.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`f\0045\031"
+	.string	"f\352\225K\260\022R:r\251\264\013\321yG\024N#\345i\001\257\331n\016\242\344\245\0367\024\353\372<B8Ra\313\366\262\266\177\304\037p\332\322O\370\276\335\242\366\245\336\305a\357Q\376\322\316\237C.\371\353\"W\373l\226\220M\210\224I\006\206"
+	.string	"p"
+	.string	"\201"
+	.string	"\265\346\nH\2651B\231\330\335\233;\263K%\200\246\326\020\234\020\312-\rk\255\261&\361\231\207\300^.\263\305*I:\212\3153{\226nW{\b\214\307/\237\021\354\"SJ~n|n\226\374\334\360\274\265\303\254!\033\036\035.q\330\364\224\f\331\234L\346\234\346@\360(\232T=\371\030\251)\2413w4,\232;\0347l\227\023\t\324Z_t\016\261\2731\223)\265\326e\335\356\346\013\340\273\037\331]\003\273b\201\375\242\267P\374$\224[\244\227s\347\355J_\221\001f6\243\037\271Q\202\347Zk\255W\206\276[~S8\376\261{\243\037\311\354\205\226C\f_\367q\037C?\276{\267D\3043:m|\265\233t\343\366\355^\254\r\264\313\274\"\314\373:\257\353\274\346y[\347e\235\267\024y\311\221\2272\357(\362\212\315\333\314\313\347\375"
+	.ascii	"\031N\215\210\335u=j\270\256\221\355\213\361\2353\212\350\300"
+	.ascii	"U\350\036\306\237T\036\254\254\320\217\036N\031C!m\337\036\351"
+	.ascii	"e\303\250~S\001x\017\201\356F\220\300\327\225M\"\365p]k\023^"
+	.ascii	"\024\316\330\276%[l\327\317\017\210\343\037K\233\234p'\ne\255"
+	.ascii	"8\224\275\213\277\250`\201\205\205~\244}\035AG\335b?\027\304"
+	.ascii	"\266{\362\026\262\262\326\232`\317\364&\227\275\320\307\305\360"
+	.ascii	"\362B?v\337)\be\343+\276HBE\002+;q\241\315d1\331\205\230\206"
+	.ascii	"\027\026\230\230\214\026\023;\031\331\331\006\027Z\254\303lF"
+	.ascii	"\213\231I\2667\020\003\235\236U\225\255o!\355\223:\217\005JL"
+	.ascii	"=\236\n\241\215\257v\034\235RCX\373X|4S\374\202\277\277z\314"
+	.ascii	"\361\3527\005_\256\376p\303\325cmi\3103:]\227\241\300\367\234"
+	.ascii	"\300\241\320l\037\324\243\216s\002\211\204\233Tkm\231\315T4\032"
+	.ascii	"\230\035\013b\265\2326\303A\253\025\2345\254\266du\313\213\325"
+	.ascii	".\246\234\236UUf\250q<d\221r\202*)H\212R\351\240\002\03113\017"
+	.ascii	"\020Xd4b\230\326C\271\t\223\322\273\236\317I\tC\304#\322\363"
+	.ascii	"\016t\310\220\b\0319\305\274\2372\204EPiE!\310\200z\323\330\362"
+	.ascii	"\022\035\301\240\220\205\272J\302h{\230\206g\274\373\207ji-\256"
+	.ascii	"\245SH\300\203\031&\217\354i\217\323\223Hb\364k\025\265\252\016"
+	.ascii	"\257\202/\350\326\373,\251\332E\021\271\343\261\242\331j+\257"
+	.ascii	"\002i\202\272\345\370|\373~t$\321ZF\016\312\262g\227\202\255"
+	.ascii	"\216\031)\226!\374\013\n\347S\360A4\230\332\364)\364\356]Z\270"
+	.ascii	">\275\360\316\253\353\230\351\307xs S;\036\245l\261{d@\326oG"
+	.ascii	"\037(q\001<+Zq3\375\017"
+	.text
+	.section	.gnu.lto_updateMagHold.147.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\364\005\305#"
+	.string	"j@\274\rH\220VN:\305x\300\246(\377\227\320`\246\021\376\237\210\230O\331\202\006\303!'#\177=q\3303\353\212\215]\357\204\344=\310p& \201'\256 \001i\200\333"
+	.string	"\200\026\242\334qa\246\373\377\377\233Y#vo\"e\222\001\276"
+	.string	"\273"
+	.string	"\315"
+	.string	"\223\3677y}\315\333\233\274\274\311[\222\274\273\311KI\336I\362\222\315\333\314\313\314{\001?\261+XG\301\245V\025u`\352\332Dr\343e\337}\217\375q}{\037'\023\276,\352\265\252^j+G\223\271Z\353\200\317-*?i\236C?\3717\364\363\276\025\356\306\375\330Uyr\240\025\205t\251\265\006\333\306\205\217\371\371z\274rG'\331,\334\357\224xUXR\217\331)\375b\334\027C\213{Y\347\275\b"
+	.string	"\266\"\213\313"
+	.ascii	"3X\030\2773\036\213L]|\312`\021\217'\230\364aQqOY\001\203\004"
+	.ascii	"Pk\375\330\331\nk\212y\247Tk]\256\302b\361\225\371\356\306\355"
+	.ascii	".\322\356L\022o\265\326\002h/\202!\203\006\r\364\223\354\037"
+	.ascii	"?q\030\257\204\221\235<\022\355\365\307\336\0033\203#\217D\273"
+	.ascii	"{\275\\4N}\310\211l\330\177\355\022\023\023\375\354F\340e\034"
+	.ascii	"r\335\271\326*\325\315\265i\237\333\222\252\326!\0217\00735*"
+	.ascii	"\376\262o\356\243\021\273\f\271\356@.d\323\312Z\353\201\275\331"
+	.ascii	"\203|\330\177}n\023\b~\325\347\036\304.i\021F7/H\206\\\267{\234"
+	.ascii	"\342\346\332=Y{k\367h\307kTD4T\362\n\005\275\354\013$y\201H\336"
+	.ascii	"\037\346\365a\336\236\222\227\247\344\335)yuv\2749<^\234\222"
+	.ascii	"\367f\307k3yk&/\315\344\235\241\2742\2237&3]\323'\202\0055\215"
+	.ascii	"P\317\364\216\306\225\034\331k.\346\365\326\376\370\2678\323"
+	.ascii	"*\262+\352%)\260\203\332jGP\231\376\f3\270mp5\007e\255T\005\366"
+	.ascii	"N\376\344\001\204\b\021\350\247L?\313\030\347\205l\310ueL\027"
+	.ascii	"u\030\343K\320_\307\364\2112\200\375\353\276b+\322\rw\315\265"
+	.ascii	"T\253\306$j\2343\255\024\344P\003\333\352:\036E\201rfQ\250\370"
+	.ascii	"\313\351\372\232\210\337^\202\362\332\327=\032WL\2102\246\366"
+	.ascii	"Xk\235&\320\036E\207\272\177\234\271\231\251\361z\250\031\255"
+	.ascii	"HW6m^\237\210c\327e\222+\211\2220\201_5\201~\356\232g\234M\373"
+	.ascii	"E\272\336{(\331\263i\033Ql\212\302\215D\021\350\332\265\360\264"
+	.ascii	"\013E\001\036\232:\364.%1A=-\005\227<\004C4mp\n.A\215\b&\345"
+	.ascii	"\354\223\b&\250 \211\247'\250\240\3578<Y{kK6&k\303\236\212\001"
+	.ascii	"\352-?\362\237\006jF\323\022u\224\345B\020\226\237i4n\t\353\237"
+	.ascii	"O\313m\332NW\334\253\262\364\364\333\207\247{\272\333\210sA;"
+	.ascii	"\315\323<a\210b:}\323;MB!\202\345\264\316\nu\334\212\202\237"
+	.ascii	"\271\035N\270#\301\333\347\256\220\307\253\b\303\312\267\n\302"
+	.ascii	"1\003]\265\326\1779}\227\320\317\234\376\231\027\331\220\312"
+	.ascii	"\333\234\204>\204e\3022\372\211\323\006\274\214G}\3236lWuE:_"
+	.ascii	"s-\363\222\216C\324\212R\022\270\020\220\032\225Y\312\003\251"
+	.ascii	"M\033I\371\232\202\005\f\030\320O\233\2062\312\205\031k\372\210"
+	.ascii	"\246\003\200\200\250a$%\231B\206\231\031\251\240\005\005\205"
+	.ascii	"V\003\220\002!\0213z\020pF\303IcC\324\003\007\364?e\022\3606"
+	.ascii	"!\356(\003 \224\237~\263\267\264\266\020n2;\262\211;\300\351"
+	.ascii	"v|A\323N\313H\022\221\266\016+\267\341\316\371\214\332O\302."
+	.ascii	"t\301\226v\243L=R=uZJr\266\004k\271Y#u\250\214,lq\t\224\030\031"
+	.ascii	"\321+\024\305\331H.\247\215e\315)\243n\313\350\231\316\315Lu"
+	.ascii	":\204\311z\326\006\030\r\227\335\206Te\226\304\371b\251r\230"
+	.ascii	"w\013'\206cPC.\326C\017\021qn\213LL\224\001\207u\225\301\243"
+	.ascii	"\221\271\301\214\360\"K\333\264\037\355j,}\241\302\026\376X\344"
+	.ascii	"\333\"\333k\002\007\002n\221\306\"\207\247\r\220\270\355!J\201"
+	.ascii	"\016\205'oY\240\257b\336\300t\0039@u\0306>?\304\256\377\026\330"
+	.ascii	"\001\304\354\203,\311\017\342\374\244=\357\220\332\002f\0245"
+	.ascii	"z\243\006"
+	.text
+	.section	.gnu.lto_areSticksActive.148.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\024\005m!"
+	.string	"6~\326G\240ZQ:\304\317p]k\020(\032[\316\007\002\357\216K\342\303\002\322\240\366Q\364\253\235\333bMYa\363\277\206\272\246\344\332\370\212g\004:\240g\307\203\027\347\220%\217\270\340\242r\333\333`\337\376o\204\020B\322N2\307"
+	.string	"\257"
+	.string	"\304"
+	.string	"\226Z+W`\265\f8B\032nj\255\nL\256\204\323\244\001\373\224&G\367\224&\275\373b\367E\275\204h_+\023\223*\265\016\031,\202\323$\204\b/\266\310C!I4!\322Q\021N\255C\333\203\354=\016\2751ZdY\f\366r\265N\263$\307\323\2425\f\313\306\035\246\321A\217\306\200"
+	.string	"y\0306V`\222d\210\305(\355\030?E\245\205\211\276\016\270t\344\240-\323\202\017\240\016\237b\224\202PJK\324\224\375\216F\003E\037\200R\322A\313\033&]\277\033\036\307\007U=\350\310~1F\331\323U\317E\323\031?#zO\231\374\261\024fI\034\037@\036\246\246\205Z\353R\244\037\320;\363\256g\273{aw\204\n{BG\215dr\255+M\002\275\025\305\243Y\233\245I\tp\274\323R\257UI\273\213N\360f\n\022b\032#*\347\265V\030\277\323\356\260Gm#\251\b\322\276i\267\346%\266PP\001\223.\220I\227\300\322\3751\351\006\260\023\257\217\245\274\264\323\3559]"
+	.string	"\247\313s\272;\247;;]\331\351\306N\027v\272\257\323u\235n\353t\317\3235O\267,\351\222\247;\222tO\322\245#]\033 \301%\251\306\317KW\265&e\315\251a\310+F\354\304\2262\335\365\256\211\353\242\023\"W_u\321$\254\341\246\326!\205\323Q\353\251}\231\\7\361\360EA?V\354\257\313N"
+	.string	"\313\247\004\366\330\205\254fU`\007\302\362=\365\310\270\376\372"
+	.string	":>(\363\255\273.\340\213\357\251\374\370\326\177\306\004\257|O\2750\265\326\363N{~\274}\230/\177\006\270\371\362\013\371\362\326`-\034N+g\361"
+	.ascii	"\"D\210\322$y\006i\242x\343\037\304rT\307\303Z\253y\247\245O"
+	.ascii	"\216\200\031\201\036\3403L3fQ\376;"
+	.string	"\"\230\303\301a\026%\375o\037S\217f\255O?\2269\252\303\243Y\033lE\304Yk\235\260\256r\225\0217\034\2564\351w\bR\305\271\302\243YcY\302TTx\215\220)\004\376\223\206\016\351RlC\346,E\205\237\240\251\325H\302\032\212\243\230X\0231\031\260\025\271\026#\306\241\334\211\034\206!\024\270\333\016\227\301\304-7\264\202go\rp;\335\315v#aC\221\033q\302v\333\255\2605\360Y]\n\334\3166\244\323\355l\257!\317oZ3\361\271FH\204\252*\266.*]t\213\210p\bU\325\313.*\177~\276\026x\357\311\356\2641%\260\332\257\206*0\215\201i\247E\210j\214\250\034\217\265\326\032[`\332k\367\224?\214Y:C\325\270\261\022\007v\247\255\371\204`\\\005N{r\204MkMT\326|\302\2503\350A>a\215r\311\230\250\364\371\f\241\373\374RT~\020\257x\257\236\027"
+	.string	"p\236\367\264X\232\035\300\205\260\266x\347<\343g\337ymL\260\215\203Y\024\321\313\354B\304\340\231\226\354\001`\250a$\306\bt\310\214\005\"2a\n\222f\fp\002\241\261\3329\020P\307\210S\030\016\252^\257\247E\007\t\201Fn2\234*o\226E\306\r\035\210b\312\321\244\327\177,\362\375\320\310;\t\341\313(\203g\200\fM3\003P\003z\021v\222:E\304\003\037\355rP\260\232\300\351\342\207\321JO(\3243\246m!c\321\301%\211\304\301\034\020\b"
+	.ascii	"\367^\204.\216W\371\353\016\316\250$j\344\001`\346\336=\357\\"
+	.ascii	"TO\324nHav\300\177\224\363\360\324\203\333\354n0\252\b\355\002"
+	.ascii	"\215\032/Pn\304\2748\350\bJ^r_\332&@d\002=\317\354\350p-{2\237"
+	.ascii	"f\013F|q\302\362K\210\370\211\030\261.\026\325\311#\324\307c"
+	.ascii	"\235\260e\250"
+	.text
+	.section	.gnu.lto_runawayTakeoffTemporaryDisable.149.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\325\007"
+	.string	"\262\01787Po\322\001 \316P\313\327\277\036\027\205 \022oH\277\206\"~\003*![\335\032r\330\203\"\302l\375O 'f\0267m\035V\025_%\200\002\306\206m+eJ\001\021\327\247!\3738\\ \317\203e\254\223m\032\0261\2108\341\271$\"\266\201b\207\300\032E\266\305\nM\333\242\365\3555\253'sZfR#%\371\352\177'\271\360?l\021\312w\207~hs\370\016ft\203M\352u\200\305\244*\251\220re\177\242T\016\373\232\335]\353\311>\352OM\037\n\250N\274\233\\v3V2\233\202) \266o\331\316\264\025\026\270\2430\254\273\033+(\273_\202\0218\207\346\354\227\177\036[\020\"R2\211\331\335\250\035\347\236\234\377\221\007t\236\350\t\300\260\273\316\316\323\270\365\266\017lG\333%\001\b"
+	.ascii	"2\241\217/\260q\361\324\f\354.\243\250\324dp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.150.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\003\006m$"
+	.string	":Cx\016G\220\332M:\2068\031\020*%\3511\322\254j\226\002\375\300\275\n\323\213Qg\256\221\022?EX\200qx\033\002\260RF\352\234\264\230D\022\t\004\325&\222cF\246\001'\260\253\260\334S\201\332\326\356\321\b\355\226\266L\001\324"
+	.string	"\276"
+	.string	"\331"
+	.ascii	"7\3334\017\235\266\331\246Irz\034\247k\343\364\351\364\254M\357"
+	.ascii	"\201\\Q\206\326n\261\251\225F\321N\rC\313\204l\222\365\212\355"
+	.ascii	"\320\306y\305\206\231A\2208g\205\215[\272\266\013/\230q\233\244"
+	.ascii	"\305\326\262\252\2003dJ\233Z\207MK\275d[j\004\t\\\230j\b\306"
+	.ascii	"\0137\275!Q\256"
+	.string	"\230\314\251\265\372\356c\251v\247\313\341n<6r\244\265O*/\331@\002p\007\030,\255\027\273\323\341\3201s[\023\267U\302\275\325\230\332X\211\263gY8j<\032A\260\026l\223\276\262rL\236$\233\360\306$\311\006<j\bw\274*'=\303i\301\230\265\257\235\226\325\374YV\260\326\253\265.\330\316\030Z\3009\311\006\265VO,\255\032\353\236\265\227\332~`S\257\034\346b\325\276f\320\210\354\367\304\370{\030Cc5\353\330g\366\352v\030m\250\250\271X\377\202\355\217\023\264!a\254\376\302\244\231\240\013}\214\323Se\235e\234\017\272g\t\0078\213\336\317\317\264\253;\366\323.\001a\253\265.\360*\3311\021^ KMBj.\326R\257\324\270t\277\302 \032\235\262\252Y\264\207\300\371.{_,\026\213~\017\333\323\006|NML\233d\275DN+\215\323\004\306\351$:\335\243\323\003\350\264"
+	.string	":\215D\247\217l\323Ft\272\210N\023\321\351!:\035\200N\013\321i\036\235\016\242\323"
+	.string	"\3504\020\235\376\241\323>t\272\207N\357\350\264\216N\347\3504\216N\007GTbk\346\305\350\253%H\244\023&V,\026y\212\316D\364\241\027\375\210X\036Qq\203w\242;\231\225B\252\255"
+	.ascii	"\037\3724+\277\200\263\030\340#\200\302&>\265V\033\357\033d\354"
+	.ascii	"\013"
+	.string	"\357F\\:\212\344\317\233>\245\370|\367\237\037\251)\217\364\334\347\005\244,\223\3559\022\031\335w7\"\226_\267\347\256\373\250\246\364\262]\350\271\003q\351\220Sz\001\307wY\350\270\377\306\274\334n;\356\224X\ny~s\260[\"h\341\371.\371\021F\336\366\205\260X\"\224\355\025\t\023(P\030\227\222\337\255\340\032\017k\255\364]\2660\216\3770v\306\256\260T,\330j\265R\340\225\262S.`\310\220a\\:\236EP\r\235\260\252Y\254\265\326\332\273\236l\355\037\202&o5\214\366\206\016\361t\"\004\212\016R\276\022SRRSPE(\242~7\324S\324o\n\312\007\365\301WBD\007)\037\324\357\204\357\211\347)\023Q?\037\212\251\251\237\0177\254\332Z}\017\217b\245\316\367\021I\231\261\351Ad`3lL\037\301\212\334\234\276#3\262\206\364\266\030\227\036\303\266\201\367\252\016\364\322\r\234\004\356"
+	.string	"su\247V\235\356\373\215kG\223\362\315R\2356Vt\357\252\262JO1\206\346\314\202\030\245oVP\216\021?!\212\341\312\021x\212\205\262\004>\207h]l\244QB\206{\327>\007\f\032AnI\377\255\223M:\b."
+	.string	"\356\364 qlL\223\246\005:\200{\226qz\007\372\016W\251\314\f\312\025\031\234\001\027\360\3367\255<r4\340D\304\322k\271,\322\005\234L;\272\320\221^K+\275\214\036r\250a$\344\020s\312\214I \"\222$i\306\260\002\2211\"z\020`dT\2335\357\231y\3551p\261\002\242\346\230\254\201%\204\245\016\030\237\252\332\273cv\007\322\375`X\346\217>\231\035\257\345\345\021KOJ\376\"\261W\230\326\216\254\013\376\217\344\003!'\005\20470\251\"W\362sf\251\261c\201\004\226\372\201\205%\336\261\307K$x#u\034\340U\223"
+	.string	"\342\222\021\003\bm\t\303\177\202!\3761M\314Ko4\035\210\236\003\264\020\332F\210\301\r\357\350\345qR\243\315\203\300#\363A'*\240a\340\226\241g }"
+	.ascii	"zq\364%n\376\254\2135LC\005Un\337g~\215\320\253m\365\f^pU\363"
+	.ascii	"\207\b4\274\237M\244\214\n7>X;\303k+\r\212\342\236X(\321\210"
+	.ascii	"\363*\006\303\210}\355\205\033\265Q\372Qt*"
+	.text
+	.section	.gnu.lto_calculateThrottlePercentAbs.151.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\245\007"
+	.string	"\202\21656PU\322\001#]\002PW\255\323\303\236\254\210\245:G\307\220\275\326\350\310D\257\326\b\022\257e\301@\005\266\300f\353k$D\305\373\270\367\374\036%\032\203l)S\n\033\020\351\353\003\312\260+^\022\261b\"\202\"^\331E\374\030\030\263"
+	.string	"e\021\003\303\262h}{\373\372\322\341\rI\244#C\275\"\320x\344\2102e\200\26434\362\034\324\233\356\360B\032\351f\177[\352\211}\270jb\337\273\241\246_\r\224\250t'I\355\212\244t\026U\311\254\334\273}\030\337d\353\036G\301\242\226 \244\305\005\244fw\025^\331#\360\352v\310\266\274\300\020\262v\320\261\331xXv>N8\273_T\224kO\315\177\351\0173)1\\\267=\003\032v\327\311u#\267>\301\366)\n"
+	.ascii	"2\003\3020YB\330\256\211\222\230 \272 _\212r\270\313\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_isAirmodeActivated.153.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\302\213+2`M\222\016\300\016"
+	.string	"\005\024\271\253\3046\321\262b\b\020\334f!\212\314Xk7\326\307\261\365\322u\273\002\200K\220\327U\201\366`\305\321\261q\323{\313\024G\226\313$E-zh\022\020\016\021-\232(\232\305`i\3422\265\nI\232Z\005\313\342\347\360`\203\234\257HG\250\353\261\005\346Z\025\272\230\200B\207\003\032\233\313\036\323\034n|\001\022?\377}H\300\201a\365:\311\364d)i\002\225|\374\231\257\254\260\220\231*vy\n@:\027$(\231X\303\216R=\3526\244\r\234+\253,MO\200!3\277\312\312\350\330?\341G\370;\001\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_processRx.154.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`X\001u\016"
+	.string	"F\033bE"
+	.string	"\2216\035\340\321\261R\371\257\322\335\334\363h\027\001\2064\343Qix\230@\ri\315V\202=\213U\377G\230\222\377p\230W\311t\3677j\265\001"
+	.string	"X\021\201\313\375"
+	.string	"[\022\\}\345\023t\331\177k[\312\224\002Q"
+	.string	"I"
+	.string	"N"
+	.string	"'L\005XRJ/:\346\f\2655q\357\232\313\222\253\236\017"
+	.string	",\271\306\300\257\020\267\260\f\344\240R*P\321\310\221\201'\262cR\361a IW\"8\245\2540p$=7\304\322QW\024\260\244\252\001\231sZ?\360\303\275\271\355\3166\003\373(\002\366w\034\307\031\357\311\331[~\216\325\322\352U_\200\007\302\204\002>\005\314\234\246q\307\024\255\230\025\333\"\033\263\255j\277\305]\210\336\262\301\2349K\260\2301g\270\300\t6\267<\357\\\267\344\t\\\267l\273\201\003\221\275\207\001#\302\223\265\333y\250O\341\262A\025\364\337\356U\251\225\350\230\030\"\246\\\025\227+G=\363\334e_\b\351?\335"
+	.string	"0l\254\270\f\211\361e\355]_\t/R$\225\261\245\234\2653h\320\177\337\243~\017'5\304\225\212\264%v8\322U\t!\b\037\021\320\003\222\221O\327a\330<\274}|:n\323\266\t\332\b(DD\333\272\220\366\3211g\341\323i$\034\327iXhrye{\3247;XV`d\350].\267\203m\271\0061\331\221\234sNM\204l\3455@\355\220M\377\3718R3\342\350@\033"
+	.ascii	"6\023\020\3520CVd8\200\031\273 \305\317X\003|AL[W9\r\340\200"
+	.ascii	"\025\2639\020\016\306\260\025a`\213\253\335\310\301\226.\243"
+	.ascii	"p\025\265\3740\0054\026[MG!F\022j\300\275\243\262y\006"
+	.text
+	.section	.gnu.lto_subTaskPidController.155.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\253\fu;"
+	.string	":e\020\026BP\246N\007\245\320\376]\025"
+	.string	""
+	.string	",b\204\021\325[\215\n\312\3340\267\245#\347\2647\254\254F\rF\270C\020\024l\222>7\t\361\204\204\244\204\212\357A`(\351\277\221\263<&2jd\357\235RJ\001P\0012\001Q\001\251\263\020\350\\\364s\016\376\234\201?\347\337\352\274\246\316\352\352\234\256\316\257:{\352\334\027\232\215\317\f\007Z\367\375\271\327\254\355\273rT2oM\327]\327W:\312\302\272\0304\364\346\300l\321\311\350\233\343v\215&sj"
+	.string	"\335KG\240U\316\002\2663w\225\266\302\266\334\f\016\336\313\326F\314\275t\006\030"
+	.string	"\260\325c\023\327V\323fZ[e\226\331O\221\354\206%\230\363\302\264\323\273\367\"\037I\263}eu\254\2422NIEA\025\237\234\210MLKJIHGFCaQ\020\370[\325\364\235\345\376=\210v\260\211\026\326WV]\270\370qKWm\231s\252.m\354b\305\247\252\264T:`\315MZ\337\235UI\211s\212\360\351h[\301\235Q\361((\253\342\024)\376\364{\300\226cJ;\2751qb\223\033\223\222%\276\024\247\324\226\004M\342HGkpgN7\202;\023rw\346\364a:"
+	.string	"\320\030CD3&\315\276;\013\342B ^$\367\303\203>\034\bw\246\346\277\2733\271\364x\357e\372\312\243\32522O\323\372S\004dzA\216\320\306\322!\037\263NG\333m\240-\335\177\017\356\275\354M\264\034\315X\315\3547\230\231\003s\321\225\355\326*\263q,\025\226\312\332\352j\247)(\370E\300\377}\360\033\300\003\277\327\377}\321\216\231H\314\333\365W\275v\214\034\365\237\254\305\334K\364Y\217\304\334\363\343\3341V"
+	.string	"o\203\265\264\372(\312\250\037\302I(\316\312\323\377f\347Vf\b\022\022\374\177\372\006\312\232,\275\375O\305\264sF\327z\177f\n[G\262\017cn/\375\345\205\005\f\030\326V\375\253\376\370(\272\3263o\350\340\335d\001m\0249c\037\306Dg\006!\302\273\231\340\325<\255\0239\313\017K\227\234\231\204\t\357f\326\367\231!\313\017k\306#Fn\310\377\223\325\346Z\373OD\361\306\234\217\271\355:\013\027\267\033wyy7[\345\366Z[\355W\235$\252\262fEM\314[f\272\245\377\223\271\277m\333\226\337\bs\352\334\240\345\272\265\232\2569AV\352\214\354\272f"
+	.string	"\2513\026\320\371*\350l\265:\037S\347\252\325\231ju6\016\235\247\206\316RC\347(\2413\224\320\271(t~\022:;\t\235\211B\347\246\"g\246\240\363R\320Y)\350\234\024tF\n:\037\245\316F\251\3630\210\224\255w3\352}\f\233\2164\355\246-A=\214\342C\275\177q\261\326\303\374z\363\231\265\325\342w\020(\226\270F\323d*==\f\247\177z\377\322\307a\002\344)\320\207\330e\025\237\323\367\232\263\335\223sK3K\372'\207i\036\3344v\257\030\026\361\223\3218MO\374FT\246'\346mX\347q\230"
+	.ascii	"\n\f\261K*B]\210%c\2625j\254\2556}\007q\266qriK\246\206dce\372"
+	.ascii	"\341\035\006f,\232w\223\351W*\316\\\274\2409Z\372g\242\300"
+	.string	"\231\331\035l\017\357\346\322\367\233\216\263\2243RB\340I-cef\201\260B\274\233J\337\200\332=\265\310\236\272aR\037g\322^\322\275W\370O\274F\332C\204}\"\375\002'\2428\265\242\257\365\250\361t\236\257\"\354\363\271\266z\364\013\234}Lw\357\r\262m\253\321\243@\322u\3306\340\275c\n\270\357\232\016\253d\t\373\366\266\266j\364%\234}qr\367\336\013\374\347\233np'\212\227\324\306u\370\r\3428\031~\322\231\267\327?\343\212\374\2166\360.\252\247\333\270\n\037\371\354L\265\245\267m\330'^\302\037\341\314\213[\213\236\231\r\364\032\026\n\022z\357]\300\235\246\325\260Q8^_)<\200%\271\300\\\004]x\251\350\212!\001,\311\005\326a\302\226\006\023\035(d\330\302\260\345\301\311\305\007\257\257\024\036\300Vx%\223/\272\214\270\353\200W\222E\027\262\013\005rE\n\256/dW\322\005\362"
+	.ascii	"\221Y\264\360J\"\301X\260H\"\205tb\235\3367\302\025z\210\331"
+	.ascii	"\003$\366\313\253\177B[I\022\253'c\367vd$G\334\232\034bS\205"
+	.ascii	"e\004\353[@\317\304\261\345\200\232\321#t\350\362\345\241\272"
+	.ascii	"z\037\342,\3325\005\375\325\367\361\255\276\231f\204\034\277"
+	.ascii	"\357\264\251\031{t\325?\031,\355\324?\233\205\2622s\001\377\301"
+	.ascii	"Bq\340>\032\013\264{M\2212)\253\346Z\253\036\206\363\250\372"
+	.ascii	"\026\3200qjQ\377\344N\353\037P0R\b\211y\3334\356\037\250\013"
+	.ascii	"\316\254\304S\356i6\270-?\266\362\317\312\254\f\244\034\344\\"
+	.ascii	"\330\234p\231[\243\250\365\306W\005a\231\213\272\031s\276'\252"
+	.ascii	"7S\2774\005\245\\\364z\306\252\365TO\365\244\221W\266\266\364"
+	.ascii	"\366P\335\016\247\236\261\032\277\331\242x\336t\0333\224\205"
+	.ascii	"\224y\336Me\336\332\252\361\033\016\232\345\363\306\332\210Y"
+	.ascii	"S\337G:\321T\017\006yh\232\376\311N\326R\337G\bH\275\343\261"
+	.ascii	"\355x\323\002\207\351\237\214\324\312\2755\352aD\341D\360\002"
+	.string	"\315\254\f\200\373\250\201,$\221ShFFD\222\024$i\f\260\002\021\241*n\003\021\3604\207$\253!I\241^\313\034CY\271\"\322A\217\335j\027}\243x\371\214\250Q8z\311\005\b\007\032p\241\222\267Xwf^\301\026\253p\224\205\301\216\245a(y\312\255z\023\240yQ\350\302\033\201\272e\252\317\017\007\001\221\363\n\257\302m\036\361\265v\377(\302\034\034\207'V\303\225k\302F\024\363Qd\250l\365du\bX\321u\254/8\323\220\022W.\342.\b\024\024\004\033Y\025,\037\022\202\351[AR3\026]\343\356\353\003\342\335\b\026J\344z\317ws ?\272\335\364\035\006\314:\350\306Q\306\200\n\241\270@F\233\217\265\207\365\303\333a%\246m\220\356g>R\375\304u\234\360\356\225D\370Fl\227\216}\325\252\242)\262\\\354\234\224(r\324C\024\r\030\021\035\225\225kHQa\2206\370P"
+	.string	"\025\224\271\324Y\033\323\331\310\272\324\361K\217\276S@\355\b\251\237\243\035\244Wgc.\023m\2601\f\023\017\323|U^\262\036\260\304\021\305\001\367[\305\346Y\335\221\352E\360u\027\344\366$\240\027\327B6\272k\312\254\036\335\025_7\370ef\004m\322\f)?^w\366\222\331\211g\3572\005\330\035\006~\227\322\221\200\370\212\273\007\177\327\300\304\357\300:\006c\026Cy\307\212\346\031\220\001\025\200NDH\252\356\246/v\325\254\001\334\302\333~\310\242\007\3172\301\345~\307+\3562\223\017\341\331\313\005\363\351\0266\311\236Qe7S\355\207@\237\320\22450No\3443\243\252q"
+	.ascii	"\331'\365H\271\346X\353\0377R\251\225\350\307\360\2170\025\355"
+	.ascii	"\243\017\210B\234\320\343p\304\250|{c@\361hZ\026\376\375\034"
+	.ascii	"\260|L)\227\032"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.156.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\337\003U\033"
+	.string	"\206r\262I\260\226Q:4\242\277\017>\215\336(\335;\347\317\030Uc\003w\3318\336\3656\337\002\022\023{\026\326\024\355\377\263\234\260e\210\343u\376\276>@O\261\3665_\034\377\205\321\313\364R\276W\032\260\215\201\376O\b\331\204H)S\237"
+	.string	"\221"
+	.string	"\234"
+	.ascii	"W\265\376\032\254\370\007"
+	.string	"\344\362\277F\326\311\334'\025/k\3051e\252\326\237\203' W\264Y\032\272b\270\002\350\2127\377-\004\210j.\002\325\221\242(\254Zk\254u\254\271\256VI\216T\f\233\315\357H\001\270\345y\224[\327\322\266\266\212\321\322\201 F4\270<\200\003Ii\311 FI<V1R\nmj\255ELe\254\0302\270\242\3622s\264\"\244\201\321\343$\3420\306v\b\201\b\253\306\314\021/|\205)\262\262\300e\027G;\346\221B\255\365|\036!\355_\373\177\311\377\237\277w\004\341\f\377\264\021\274'\254\331\2527#\270\353\334\261L=\335\350\366]\334\032\335\016\001\264\342q\230\177\2436I\355\313\343$l\274\347\212_\033]q\273\003\323\225\246$\035g\375\277\035\267\357\337\260v\216\177\237v\013\354o_\003[\250\275\f\311\177\215|\327\310o\215\374\222\362\311\220?R>\245|1\344\207!\277E>\207\3745"
+	.string	"+\242\005i_(\251\025F\226\230\032\024\233\370\330\337.\324\"Y\340]PC,\260\250\244:\374RlE\252\333\342\007\025\223M\3647\213\230N6D\235{M\213M\333\301\212\037;\316\022[\004\323\213R\332p\201\376+\340\034\t\362\2368\021a\"\333\367\325\241a\357\016`\226\347,\024\035\262V\236\204\257\223}\262\363\345\261\3421\360\360\264\002\253'\035gq\25557\266\3575\332S\032\272\027pQ\242\003\370\227\371\360\236_\251\236\220e\ns5%\266\3575K\224\236\032\326"
+	.string	"N%\033\374\035\2422\355\342GA\271C"
+	.string	"\263\300\230\334!\372\177"
+	.ascii	"\301{r\257T\017H\220\327\271\007\340\377\007\210\367\254\351"
+	.ascii	"\221\252\267\0244[\255\007w\003\302\t\225B\264\022\263!\034\334"
+	.ascii	"\r\b'\223\345\310d98\0328l\260\340#\373\271\260\263\341G\246"
+	.ascii	"\223a\207g\247\007\201\220\017\315V\353\301\231\240\335n(f2\237"
+	.ascii	"\335\320nA\263\330LD\314D\r\310\026\233\335\204b74\017:A\273"
+	.ascii	"\305pAA\267\230\353\247\333\316\361\262W\025\324\365\316\365"
+	.ascii	"\352\3777K\305\364\021c\252\265N\370Vm\320\004b\n1\207\230C\350"
+	.ascii	"\212\364\312\331\305\325\257V\227\355\352\225\351V/\331e\023"
+	.ascii	"\210*\032\243\343,\262\267\352\306\256s\333j\237\222\035[\204"
+	.ascii	"\224\261=0}iJJ\300\264\351\232\001E\250q \342\224R\214\261@\242"
+	.ascii	"\221\221$M\033\220\002\031\251:\017\020P\350\264\325\001\323"
+	.ascii	"\371\035\321 \273G\324\317F\361\020\223\226l\246\333\204\002"
+	.ascii	"\367.\313w{`}5?4\006\273\220us\r\262\250\025\220\032\013z\252"
+	.ascii	"\253U\354\034\222\024\0048\266N!\323C4\356\370\346\343\275(s"
+	.ascii	"\017,\310B\016v\322\354:\\9\300lCCnhO\270s\265E\357\2627\370"
+	.ascii	"\325\320\005,h|\262H\212\206}\204\004'\246\007$e\027\023\353"
+	.ascii	"w\237o\224Kg\177es\342\334\365\266\234\f\234b\305\037"
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.157.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"5\007"
+	.string	"\"N34`o\032\003\304\025\025\214\303{\021\320\271#\345\224\304\356\002Y\273z\321\221\261\207\322C\242;{\340\3362xl\005\021\b\264g\025\335"
+	.string	"D\303\020\221\275\245L)\036\007\213\263i\370t\2549%\244@\245\306\232\227\214\022\"v6\017\234(\247'j2\275\"\254\031?\3275#\206\273\247\303Q+\216\255\263\200\240N\257\235\240x\326\232\240Q\352@0k\271\354\301\215\326\323\377\027\216ZH\220\202!r\b\345\017\225Z\336Q&\036\230\266~\255?\f\2029\244\242\325\237qB\362s\nE\b0e\340\314\305\324\344\201\213\251b\255\2129\322\013JX.FV\376G\330a\314\017\253-\342J\3332?"
+	.string	"\206\377}\332&r\241\333\036\264]hK\n\b"
+	.ascii	"2\241Y/\260\270\340\004\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.158.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\361\005\265#"
+	.string	"\306?\340I\200\030R:\263\335\201\303\271\375\013`\242\356m\f\272\327\025\2638\212\f\365\370|\177\315i\351\233\263\271\241\"\373\215\330\006\264!5\335\036\367\247lA\020s\034)\037\302\217\325\032\007!\367S\242\324\346\240\337J>\331D\312$\003\311"
+	.string	"\270"
+	.string	"\315"
+	.string	"\037\362\272\373\335\023\331\247\355\016\215m\t\366\001}\375\203\\\310\225\273\033bE\302mi\242\215\303Y\b3M{\260\024\033[J\206x\372\225\276\304\330\222F[\232&\213^\367"
+	.string	"z\336\375\217\227\ro&bsi\352\342\211Z\232&\215V"
+	.ascii	"\372*t\336\371j\236\347|\335\341n\027\240\254\364*\301r\253\250"
+	.ascii	"tK\323\324\327a\037^\227Cqg5\233\207\373+\2373z]]\227\342\271"
+	.ascii	"_\351J1t\243\013\214\321!\027_\307\343L\003mK\304\374J\327\321"
+	.ascii	"\344q\3250\026\371D\361\252\265\363\312bS\347\205\342m\"\310"
+	.ascii	"rSq\3435\302\254)S\304r\345y\313\213\310\214c\220\246\351\262"
+	.ascii	"\321\353\353\273\373\356\332\330\335\254\335J\026Wr5+\020\030"
+	.ascii	"0\234\257\334\207\"\206\204\214\016\357:=\361\215\275~\332w\266"
+	.ascii	" Y\260\021\373j\265\250\231\265\350\003\317w\006![Fp\231\335"
+	.ascii	"\033\371\021\340~\306\0067\360\215\257\373\r\347\353\273\336"
+	.ascii	"@\302cE\331\021\213\323\354&\257\270a\354\336L\373\305\356\223"
+	.ascii	"\337\242\233\375\003~\366%:\332W\250\027\364!\337\037\034\257"
+	.ascii	"\017\312\313Cy{P^\236\223w\247\362\352\234\2749'/\316\216\367"
+	.ascii	"\346\344\2659ykt\274\273\312\253\313\361\346p\274(\312\213Cy"
+	.ascii	"\317\223\267\242\274&\216\267O^\256\274G\360\260\034\\'\276~"
+	.ascii	"\324\222\246\\i\316\244l\225\211\215\243\335\344'\377\263\007"
+	.ascii	"E}zAFa#\262M\233\037\3568w\207=\206>\210\272\246m\332Hk\214X"
+	.ascii	"\323\246\025\244\223!\336\365\200\336\035\002i\3007\256PV_\255"
+	.ascii	"\256wmT|[\007\317\002T\260\307\022\005\001M\323\3643\244\316"
+	.ascii	"W]\347\314\260\254\374\212T\004$\244\3635\327\377!\266\006\200"
+	.ascii	"w\223\224\370F\242\256d\220\3133\250y\013\262\214\311\222\r\255"
+	.ascii	"\326+\037\340\013\2221}\264\021\304\212\331k)\377\022K\322\343"
+	.ascii	"\210\366\356\036\035\312\023^3~\3015z\266\331\270~\355\263_|"
+	.ascii	"\303rB\241v\356h6\017\f\260*\305\267n&_c\302\211\221\246\351"
+	.ascii	"\202\375\362M\232\3663^\267\302\205\013\3375\343\027\241\356"
+	.ascii	"\326)\301\234\024\337\270{-\324\255\324\032#\006A)\250\337SU"
+	.ascii	"T\360A\016Un\t\202\005$ \252`\024\320\312A\225\360\251\212\351"
+	.ascii	"\3274\341\327\244\344\264\244\364SJrb\212 \001)\t\351\327\243"
+	.ascii	"j\nJA\375\252:\004\205\302\017@\233\005\036\005\205S@\037P\203"
+	.ascii	"\257\003\324\223\224\017(\244\362\035\361v\312CP\350\253\232"
+	.ascii	"\232\022\372v\311\364f\332/6\027\246\203\r\253\211:\0377&\337"
+	.ascii	"\2303\013\257}z\232\247y?\335\263\323<\r\244\334\351WiA\354\253"
+	.ascii	"\347\246\\\2475\204\321\351z\226\004\313\2122\"\316\351Z\324"
+	.ascii	"8\235\203\323\365\t\022MX\001\244\031\264H\306\220\306\213 \301"
+	.ascii	"<F\23165\\\303X\037#8\272\324\240s\031\311\250\230{\253\363i"
+	.ascii	"?\n#do\335\353\237\336\332\205:o:\203\020.\004xwH6\304\3017\336"
+	.ascii	"\364\213 \275\004t\250q0\345\220S\246fD\202HAZ\220t\220\002\221"
+	.ascii	"1#\017\021`\265s\252j\2135\003\324\205TCk\226\035:\032\251N\023"
+	.ascii	"\004\301[\220\345\006/\t\251\317X\252\333\306\033\253|\244\224"
+	.ascii	"\023Q\340\276\203\215\235\320\024\325gh\342?\220H\345\r\274\022"
+	.ascii	"j\304\374\0033#\325\350\210\221\366\311\350\"?\"\025\257\215"
+	.ascii	"\370\224\247k]\034N\256\304qq\317\375\177\236\362\245'\n-\230"
+	.ascii	"\310\320\355@\n^M\356\311\235\213\243\022\361\254Fu\240\223\307"
+	.ascii	"d\230RW\313\242\033@\217\343\033>}\377\263\01649\b\216y\220}"
+	.ascii	"G\310\246\316\021\016s\201p\246\202c\350N\323~T\305\330\236\211"
+	.ascii	"k\234R\f\030\306\277\367\3178\263\003\254\201u\016B\314n\204"
+	.ascii	"\300\324$\024\323\025\201\326]Q\254\207\355\341\326\024\201\251"
+	.ascii	"f\251\221X\246\2777\310\245[\004\305\003}\005k|\360\017"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.159.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`B\003=\030"
+	.string	"&,\235G\260\032Q:p\031\345\322)\207\264=\324\217P\033\362UR\264M\030\374\022\250\3000t\242\332S\322D\377\267I3\256\356\217\035{\365\267Gn\205M\177\237\377\366#\207\r:\364\333t\374\306\234G\213\204\220\275\211\2242\005\212"
+	.string	"y"
+	.string	"\214"
+	.string	"\233d\215\310=b\361\261V\035IUj-q~@\334\251\332\024\335\t."
+	.ascii	"\272\363\344?&\200O\2659\270\322\345\207\t\232Z\353\252\207\226"
+	.ascii	"\\\233Q\f\351\004\233\311o(a\324\355lkS@\007\257\306\216\240"
+	.ascii	"\212\213\357\207@P\2164[\004D\203\305-\002\232\301!\375\341\t"
+	.ascii	"\246\276\354\020s\263k\001.\300\321%\306i\347\303\340i\227\343"
+	.ascii	"\006\003T\003T\325Zw\311\362\213\035\2169\224Pk=\353v\274\375"
+	.ascii	"i\377\227\377_\177#\b;\271q\226\224n\374[\256\265\332\372*\350"
+	.ascii	"v\210\036S\216\233~\303\277l\004\257n{\221\206\274\234\370/\301"
+	.ascii	"\303\253C5\3752d\305\207k\333_\342\270\205\376\005k\007\375["
+	.ascii	"\356Q\"\177\024\371b\310\017C>\235\374I\371\340\3447\310\347"
+	.ascii	"\346/\200\324\016 \274\275A\246V\030?5\3257\225\202l\271\373"
+	.ascii	"\357.\371\351\177\271b+\257\256\013!W\302\224\251\265d\260\363"
+	.ascii	"\r\304\345?Id"
+	.string	"zL\347R\306\310\226\260E\303\336\242\336R\216\233\224\254\026,\233e\002\253B\005\2723\354\375\371\350'9\200\246P\001}\346X\214\216\364\230-\264-J{y\364\230~\013[\245Ee\223.\270^/\272\223\366\316\360\241&\315\321\215\177\013\266\320gw3Q\317K\216\233\016\366\314\260Rt\304Zs\017\276P6\n\207\016\036<\3642Y:\342\356\336\23757\376\375\177\316>\371 \326Z!|\233\254\023\020_ ;\277\003\233_\030\r=2\0231\025\254\032\rV\323\241\200a\202\313\365b\355\2604\354\350X\300\320r\2656\f\350\341 \343!\261\241vBF\243\245\210\241\036\313\221\321f\261UL\304\352\004\t\030\317*F\353Y\345\244>C!\243\255j\263\031mu*o\013\326\016\372Hd\303wk\334\023\360\330\274\344\020\372\223D\310\"*\237\266\035\325b\217\215\323B\b\216\177bO$\"\032F\024\020\311"
+	.ascii	"m\f\360O\"!\215xu_\244\241\237\017\327\266\001J\266\037\243\310"
+	.ascii	"If\"X1\343D\274\231\274B\250\201,\245\020\203dF&\244\t4\205-"
+	.ascii	"\006\220\002\231\301\352\006\020X\311(-\035C\364\267>\027\236"
+	.ascii	"\253c\026\310\271<\216Fq\326.\200D\260\023\250\304\341\020\226"
+	.ascii	"%\362%f\361\256\023\245*\n2gh\336\315\370\313\310)\336\376\330"
+	.ascii	"=a\235\030\021B\326g\313\2661\026\026\270\305o\036\260\257'\274"
+	.ascii	"Y\264\376d\227\307I|\005Z\376\265\310w4\270\265\342X\370I\t\347"
+	.ascii	"Q\006\346\274\030[\277z.\n?iJ\275Vi\213\222XK\215\354\251\001"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.160.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\"\004M\033"
+	.string	"6\262\256I\240\232M:\034\2471]\342\210\022\202\036t\233\205&5\356\252\004\030\316\321\312o\344\3401\375\032\200@\307\215\332F\347\200,\217#\352+\255\016\352\317\365\256Gw<\364\nj\333\007/\334\337\332_m\350F\215\220\275\211\224I\006\227"
+	.string	"\213"
+	.string	"\232"
+	.string	"UA\016|\363\243\026\266\273@\026\257K\365.\204X5e\325\nT\360\271\r\306\363\356\223\\\ty\250\026\373\252U\207\223\251Z\201;[`\374\034p\032\375\f\017\200~.\271+\346\300\246*\300\312\247$\245Uk\255u\217\223\037E:\303fr\377\250\277\312\236\356#\001\035K\276\213\337\022\303\247\304\224\306g\230 \213\212\214\254\227\024\322`"
+	.ascii	")\2218\224\361\016\035 i\325\220\365xa\214K\251\313\243\316/"
+	.ascii	"z;fQB\255u\271\354-}_\337\335\030\273\333\263\033F\b\364M\202"
+	.ascii	"\t\026\217\271v/\365&A\373\247\r!\304/?\367B\364\363\375\341"
+	.ascii	"w\345\210\357\210\273v\306:\275{\303\361\313E\360\313\022\344"
+	.ascii	"\265nc\274;T\202_\3464\245\372Q\005w\255\333\005\356\270\231"
+	.ascii	"v\037\326Z\3536\217\335C\375:\007~s&/\316\344\275\021ym^\274"
+	.ascii	"3\221W6\362\326\204\274\261\311\013\233\2744!\357k\362\216\223"
+	.ascii	"W\024y)\345\235\2247\244\274=y9\344\275\001\032\2210K\367A\245"
+	.ascii	"V\030]fjp\006]\266\250\0213G\270\220\374\264\202\274\326\221"
+	.ascii	"J\376\344W\346M\\YS\323Fa=\202\246\305\206u_%U\275\232f\311\255"
+	.ascii	"L\030k\345=\330W\271\025\005\013<<\364\363\325\013\260\240\306"
+	.ascii	"\256z9\346\267Q\261\307~\322\215\375\224S\261\255\270p\201~\212"
+	.ascii	"\235\373a\ti\357\356\202K\351\2515\325Z!\354\241<\212\317\376"
+	.ascii	"\351s7\374\374\320OzU\216\231M\303\356\236\375$!;\356Z\235\016"
+	.ascii	"\373\334\3359RJgh\274\353\001\004\277\344~\226\034\273\326}\277"
+	.ascii	"LA\345\350f\332\371\240E8\023\267\025\024\214r\"\214~4\370\370"
+	.ascii	"`\020\252`\323 \364\303\223\301\326c\003\nP\304\001wb\b\310\b"
+	.ascii	"\005.\227Sq\253\331\033\003\\\216\350V\273\221\250\241\030\022"
+	.ascii	"q\242v\313\025\325\030\320\226(\005.W3\"\"\312\325`\300\2437"
+	.ascii	"\217}9\341\b\036\365nk\214\323\342\311\035Ld\217\001H\255\333"
+	.ascii	"\234\276i\234\336\271\351p\313\311\306h\263s,0\263\266\371\325"
+	.ascii	"\275\220>\366OK:\221?\310\037\364s\326@\277\253-\237\214K\317"
+	.ascii	"lKM\313\232\255\0160\200\223C\350.I\204,\302/k\232\2658\315\020"
+	.ascii	"\377 \032\353\021Xb\335\341\027N\250\241,\004\021qfHd\002\221"
+	.ascii	"\231\024$9\220\002\221\241\262\033\02105\225\310\250\206\355"
+	.ascii	"#\207d\277\006>V\346\035~u\272-&/\244\316n\034h\376\273\024\355"
+	.ascii	"DL\326>f\302\204\0056\321\321\037\232\247[\200\344N\327@t?\027"
+	.ascii	"\027\227 \032iCyC\214&$\232\207\210?4]<\253G\2013[K\017\306\030"
+	.ascii	" \242\303\213\216\361\333LQCY\210\246R\374ma\226amk\302h\360"
+	.ascii	"}\2406\177Lk\332\177\206\n\3665\237\326\216\256\271_-\r\\\312"
+	.ascii	"\346\021(\334\n%\220\024\371D ^\207\004\222\240\363\346)\274"
+	.ascii	"\370\003"
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashActive.161.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \342U\006"
+	.string	"\302\013,3Pm\222\016$\243\252\222-\212\233u\001\200; \215\221\346\326\366\323\217o\330\277\333\341\265\202\033A\330BT\225\005\021+o\005\bj)\325+N\263{\313\024S\230\214UQ\215bh\017\r\013\016\215\262\"\032\346r\005\221\261\232DUYm\312\262\030:$\350 \3057\244\"\327\355xBs\305*]\r@\245C\201\214\316\215>\343\034j|-\211\241\377>\274|\\\200*2\311\364\214V2E\"\361\3707?}\200\260\371j\306\341\031(9\261\030Q\311\314\032n\364\352]\267 U\250\020\241`\037N/ !3?\354\003\352\330\337\340/\3701\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.162.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \360\215\006"
+	.string	"\242\314-2`m\322\001@\203\300\2201d\f\377\203a\257A@\020C\nCF\005C\232\265\036F\253\331\351k\266\303\204\343\020E\266\310\327\226\0245\302F6\2212\245v\027\f|\256\271\204\306\240\200\260\320\034th\027\311\257\001\003\333\303{\260U\254\275zR-\223F\330\377\270\025\375\217!2y\352\314\317Dg\251"
+	.string	"\024S^\266\265I\265\260\017\255zl\247S\245\215O\347\030\327\356\304u\262%LD\303\266\306\256\370\034\357\3208\036p\246\212`\204D\002\304d\327j\226K\321\031\364\200\350L/\036\237\321\277\307\r8\031!T\265yR\nv\327IU\235[o{\300\266\200\355\212\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_isTryingToArm.163.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \366\255\006"
+	.string	"\302L.4Pm\222\016$\223\346!\t\314\3061\240jP\352WDc%u\377\373\376\354\333\277\033\264.\276\021\204\005c\032YD\321}\251\215"
+	.string	"+\245\016\215iv\023\231\002?\313\245\242\236{\r\016\302\201\341\301\275J\302Y*S\021\227\312MPT\345(X\026A\210\004\032\334|\320\"b9\331\246\033\345\230t3\2468k\275:\3353\200NE\201\nM+=\226i\030\372N\022A\177\033[\273\223\312\310\343SQHf\247T\222 \323\207\306\217y\312\b\t\230\255b\030\235\001\222\b\247\203$\023sxQ\253\315\272\035u!$\032\271<\231\266"
+	.string	"\205\314\274]\236O\307\376\006\177\301o\021\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_resetTryingToArm.164.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"bK*1`K\324\001X\377@P\n\324V\241\244\003(W\331\232\2320\260[\255\243Q\017\214W4p\235\214tH`t\005\262E\233\242\203\252\245\377\311\337;\245\236\017T\351\224s@\032\020\b\024\310Y\021\344\343\230\036@U&PZe\243\355\343\305HttS\\p\345\276\3053s\376\204\025\274\301S_|o\221/\001\021\037\024\034\023\374lM\202\321\301>dw\327\361\262\243\223iX\3070v\033>\217\355\226\f\314\366\033G\366\3065\210\235p\036\303\205\267\2732><:\214\374W\234\241*\351P\002\260\273\206Te\335\361\024\333V\b"
+	.ascii	"3\001\0078\003V|\241]\306\277\214\013.\335\230\255\355:-"
+	.text
+	.section	.gnu.lto_isLaunchControlActive.165.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375 \365\245\006"
+	.string	"\242L.4Pm\222\016\244\005\212 \202\372X\352h\302U\"\234r\220\225\261\033\373\263o\377n\031j\255\340F\020\026\2141c\021E\367\255"
+	.string	"A-\245\216j\255\375Md\n\277\214\306\252\236{\n\256a!\201\301=\353\301e0W\016\032\313AT\225\345.YvD\201\017\202n7\225\"bC&P9\332\261\271\031GpZ\261R\227S)U\004\230\370\264\323g\236\206\026_Jb\305\337\306\326.\005#\"Aj\211$St2\311\020\312T\372;\177\271\300\240\363\325\fC\024"
+	.string	"r\022\362(\311\314\034^\364j\273n7\2120\242\361\201\215<m\226\203\314\274a#R\307\376\004\377\300O\021\t"
+	.ascii	"2\003\3020S\270\033\241,qML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.272.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\253\021\245L"
+	.string	"\352u\274\032@0bR\007\247\017\3229)\312~\024\341\033\264B\3648\244\325\026\376W\265IB\323H\365\246\244NNU\003\2200"
+	.string	"EG\b=B\037\375w|\224\331\2553s\367\342@\230\221\255Y\262\367\2262\245\246\001u\001\233\001_\306\215td\310D\301\005\302y\341\032><\306\271\016\354x18|\214\353\200\374bp4\301\344f\261\022\3303p\201\363,\367|\330\255\206\217\325\361q\236\200\b\035/\363<\033_\177\354\016w\243\361\341\177s\367\035c.\273\373y9\265\371\315\264\205\321\005\316\363\f}x\247\275\374\f\026(H\200\340\200\201\002\\\004\006@\267\004\004x\002\320rfa]YUQM5\245\242\240\236\234\232\230\226\224\222\230HGK\243\"e\022y4\026\211Ca\f\277[7\220\375\205\021\250\366\fY\311\300\236\201\340/P\300\375\004\201\1774\202\003~"
+	.string	"\265\201\007zrp\\\2642?_\340\257\217\346\372\343\243\t\374\371\351\001{\036\272\247Oo\355\321\321\002\370t"
+	.ascii	":\377\334\233\243\001\354\351i-9\357\314\223\243\263\362\356"
+	.ascii	"4\226\235\037;cv\372\252\356\255\352\326\350*\252\342Z\033 \264"
+	.ascii	"25?\225\006\215n\2469\243\245\324\204\321QPq\377\204\205\323"
+	.ascii	"NMo\317\004\346\213^R\022\256\005\001\204V\346\345\223\256\264"
+	.ascii	"i\346\025+\032\351\210\355\227U\250h\243\242\265W\332\031S{\233"
+	.ascii	"\330\237r\033{\242\223\302\bhef\217\234:\272\331\031k\242\215"
+	.ascii	"N\230\350\242\007\354\0368.Z\231\223'*\321C;cK\334\306\222h\241"
+	.ascii	"\333\330\222\2679\317\363\227\t\323\361\273\215\231\r!\363\241"
+	.ascii	"am%3\362\257\221\254\252\367\013`\333\246P\222\254\307\313\024"
+	.ascii	"k\263>\366u\0202\252\326\313o \2140\317\263?\217C\357\016\336"
+	.ascii	"\375}\272{\230;\0220\361\026\n\367\274\303\211\341\035o'\235"
+	.ascii	"\017\267w\303\373\303\022\271kx\355\206\341<W\021\370\323\371"
+	.ascii	">\016\376l\017{\207\017\372\255\037\342\207\337\375z\374\342"
+	.ascii	"x\350\2563\265\273\210\021\372\255{\307og\257&\270\275\333\373"
+	.ascii	"\352\356\316Xo\351\034\237\252\026\364w~g\374[\357\227PX\022"
+	.ascii	"\252\356\372R\273\2230\241\337\372\373\206!9\356\226\272\301"
+	.ascii	"\364\276\372n\360\273\333\355\016\372\226\342\376j\327z\265;"
+	.ascii	"_\355YH\355XH\355WH\355V\257\366\252W;\225Q\373TQ{\363\250]\352"
+	.ascii	"\325\036\365j\2072j\177*jw:joz\2653\275\332\227\216\332\225\216"
+	.ascii	"\332\223^\355\314W;\322\253\375H\251}\371j7:j/:jW&\265'_\355"
+	.ascii	"\310W\373\361\325n|\265\027\237\356\235\370j\037\032\265\013"
+	.ascii	"\221\332c\244v\370\250\3755j\337F\355\272\250\375\243\3178\245"
+	.ascii	"\331<\213u\021\315g0\336\225\247\373\037\363_\367\237\346\363"
+	.ascii	"`\350p\030Krje\302@\200al\262Q\032\036\205\362\340\212\346\315"
+	.ascii	"\016\237\021\201\372\243\307\273\006\314\026.p\256\312=\035\357"
+	.ascii	"\335\324\360\031\373G\017\036hTx\300\370\310B\037v\271g\306\017"
+	.ascii	"\017\377(~X\350\376N\343\357\334A\332_\215\277\363\flR\314\340"
+	.ascii	"\374\317\250y\273\2725_k\276\356\362.\244A\363\205\346\353\301"
+	.ascii	"]\340\202\227\3738\377\271\325\rV\305\344\227[j\335\0216TC<\276"
+	.ascii	"++z\363\324\276j\352+\025\005\337\207\212\223\266R\022\262\244"
+	.ascii	"\r\301\017\320\022\260&M\346~4m\344\231\033\toO\niK\237\210 "
+	.ascii	"\355e\236\266\032U\206\007\325\f\363td\344h/\341\264\324\r\346"
+	.ascii	"4\204KS\221\026-\323\235\227\221\304\313-\235\243\343\332\252"
+	.ascii	"\203\310H\224\310L\230\304\017/7\361\316\232%\035\266\\Re\214"
+	.ascii	"\231<%=\343!QK2\332\332\217\223\321\3760gL\250\270h\030h\316"
+	.ascii	"o\370P\261r\027m\327aI\250z\326`\262\223'2\024\031J\374\260r"
+	.ascii	"\013\245\320}A\032L\244\255\376\321|h\371r\2248) M^\323oMne\240"
+	.ascii	"\226j\024\370\312@EE\311\273\276W\"\2674F\356\307\376\017\271"
+	.ascii	"\343\323V\273I\342\036\004k!\304E\376\366\335-\2641r+\304\347"
+	.ascii	"x|?\177\334\217\344\254j`\016\032\232q_\375\377\236\270\241f"
+	.ascii	"\207\236\324\271\026*\016\277B\025\244\2737\242\2224zD\343\376"
+	.ascii	"DsZ\332_\276\022\273\313Yd-\372\255\306}%\326\305i\333Eo\210"
+	.ascii	"#&n\n\373\375\r\326K\232\260\270\265`\237-\305\315\301\354\216"
+	.ascii	"\0316\t\017\335\355B\334_\346\213g\334-w\033\357\253\236\037"
+	.ascii	"Viw\371M\306\352\267\016\367\r.\033\356\326\377+\366\307\363"
+	.ascii	"y\276\374\331\\\016#AB\37401\n\036/\2036\034"
+	.string	"\245\337\371+\304\356\0260\350\267z\322nP[M\240\375\243\345\335W\341\336\373\230g\256/\276bK\005\213\0241\242]J\276b\213\306\213\250\324+F\264\313D\227\364)*\305a\241\210\342\205\227WT\272\002\004\ni4\206\n\026\311\033\036P\3308\261\"v\321ub\302\r\017^Q\013^4j\264@z\327\026\ni\264\013\332\225\002\032\203\305\t\030\320.)\r\350\026\323\2432PH\241^\321\250\024j\374w\336RB\fjyl*\003\300)\241c\226\273\340\317\224P \005\026\004M\te\373\364<\317`\t\264\266T+\313\247\245\276\363<\317\b\364[\026\216\235\032\230\276\003\316\375\\\234[)\353\346\001\327\312\272\006\222\330,\263\200s\201\254=\315\332\314#a\264U\005u\263\035\327\276\372\363\261\236\260\035\272\332V\033\253\b\265\312\0303q\bT\355\034SCU[\231\375\362\003\\.\t\313\021'Z\250\200"
+	.string	"\377\334,m\317\347_Q\355)\325F\312*\331\232\332/\230\250\271\247\266\220\257\271\257\262F\264Td \023@\001z\312K\371M\271\032K\233\2762=4\035\234v\247\335\370a\251\215\274\222\341\306\0010\233S$"
+	.ascii	"\227\032\b\3103j\277 3j\353\265,3w[\005\260\257\256\235\317O"
+	.ascii	"\242A\024v\227\025\340\255v\020\250\375\200\255\312\034\037\b"
+	.ascii	"\2729\277L\355!\207\351\267Bm\r\345\311\226\273\325\202S'J\037"
+	.ascii	"\347\336?\355\3473\347\247\034\354\366u\337\031;\355\247\035"
+	.ascii	"\017:m\371\214\232\265!n\332\f\322\004\001\321W\035EK\221\203"
+	.ascii	"\310Bd1\261\370\341\246\375v\257\365\322\376\314\260XLL[ID\320"
+	.ascii	"\225\033>\253%\251\245]\303\t\033\3566\201\205\250\2014\206\221"
+	.ascii	"3#\"\"\222$\005)\f\007a\005\304 \347\034=\017\021\360 \203\030"
+	.ascii	"\331LRP\310p S#b\234C\260\n\245\213\305\225\344\"a&\352\247\277"
+	.ascii	"\340\"\032\001T\332\222\350\005\237\240\007\254'\371\r3\242\204"
+	.ascii	"\311\262\234\b\277\242\003\016\365\375A\237#\210\2023\210\233"
+	.ascii	"\037.\271\031\311-\331c\325g\024\320g\363\\W\274\354\200p \365"
+	.ascii	"S^\257~@c$\261|\356\224E\214\343\353\021\fMBt\211\264%\317\260"
+	.ascii	"FZ\033\360\202\364E\022Fw\307\226\330\371\220\365^\342e\245v"
+	.ascii	"\3147g\005n\230\2350\367\204m\3769\002\275\204\036&\314\346w"
+	.ascii	"\270\3274sF^\222]\247Mg\261C\030g\303\316B\006\263\372Y\035$"
+	.ascii	"UL\326~ELNC\025%\352\207\017\225\204]\273\033S\2023\001F\357"
+	.ascii	"\032i\237[\026\260~x\237\373\221\300\t}\373\005I\362\263}Cp\201"
+	.ascii	"\201\3052f9\253t\335q\375Xs\001\272\022\"a*e`\267C@"
+	.string	"\017O\304\3545\223\254\030\325\244\027\275a\224^\037e>q\177\243$\374\374'6\002o\252\323_\3275\322\265\321@i\320>\0226\362\001\013af\210\250\343q6\334\032\324\271\250g\340,\330r;\220PQ\311\002\263$P\302\375d\320\"\231J\345\354\\h\244\231\310\032\021A\311>t\2131 \013\361\371&\225\314K\037\300\215\bN\006l\257\210\320\241\333\241\361\224\036\001\317k\221\027\017\351\033\227\201H\204\322\3370\317\252\003\004\004\236\016Jf\375\030\212\212\365qp;\251\220\2018\261\261\006\020\255V"
+	.string	"\310=\f\232i\333\274P_W\355\366\034\337"
+	.string	"\327\325Y@by\341\272\275\3057\375\273\202\005@<u\"P\213\035#\nP\222I\265\276\200u\312a\256A\224\273P\0223\005\250|\212\030\321\r\363\217\206m\351\310<\205\200W\234\225D1.\372\337O\023\030O*\036\212\313\207\n3\216`\005\206\207\313q|\215.\217\256\\T\215\344\321\020S\367\230\024}\344P0#s\352a\237\202\020\222\t\306\001\021\027\220W\334\346ng^\031\267\352/\\\350\312\342\006\261\023.;\264\370\304\200\336u\250\b\225\377\305\365\032\b\313\177\262t\245N\3509J\376Q\324PG\230\202\334\354\313\317\302!\350\264\305\254N\310N\245}\n\264\242\023\345~<\265\260'(\034\310D\316\302\301\005."
+	.string	"\202\205c\2521h\371\277\336\363~`\274,7\355\2609\323CS\027\220\0220\345@\002\r"
+	.ascii	"Su\233\241\301\373\374\320\016\233c\212upE]P\252\200\2221\200"
+	.ascii	"\345\2628\325\032|\304S\351\233\373\343d\315\207\314\001F\\\343"
+	.ascii	"\260\263\316\022+\306\205\267\237\363sy\244,\356\250"
+	.text
+	.section	.gnu.lto_disarm.part.0.276.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"u\n"
+	.string	"\346\021C: \261\322\001$\004\005\f\204`a\300\212\217\241\301\024\306\322\314b\224\350G\3061n\256\346ne\027Q \024\347\027\271\003\205\211\302\001\207c<\001\004\274\343\334\021\337>!\222\244\024/"
+	.string	"1"
+	.string	"7"
+	.string	"+\373\346em\017\363\322\341\242\333\335yPM\276\272z\337\312\377\355"
+	.string	"\257\030\353\032\020\013\2717\360\3173\332]\177Dn\360\266\025l/\330g\b)\243\n\312\032HC\212\r\211n\267\234\007]>\3249\3709A\347\240\332\007!\3248u\234\025w\202#\263\355n\250\376Me\207\341\301\253\330V\301\034\036\357\373\251ccdx\177\0314\263\313\271\224\345)\315\372\375[\235\331\232\360\022\220\355~\354r\266\004\224A\361`-*\243F-\017\216/\206\246\264\351\326U\036\254\234%\206\020i\214%\t\2214Q2\260(2\221\2438\305\207Y\021A\242\230\"y\232\242\220G\013\0239/\306\221\234\241m\357\337\352\314\016#\271\rmYUi\266\003\032"
+	.ascii	",\205+\307\312\023\215\206\013r\256\006\006\344\201\021\256\030"
+	.ascii	"AV\020\352$\221j\317\347\306\317u\363\310\362\210\357A\273.\200"
+	.ascii	"\313d\255(\031:C\331\314\333i\001\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.278.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\375\006"
+	.string	"rL-3Pm\222\016$\2030\364\235e\334l\360z\336Id\200{c\342\007\366\016\360\260\273aU\353\273\021\204-DUUD5k\201\250b\006g?~B6\221)O\230LEMoJx\f\n\b\013o\252\034\036f`\252!S\275\007\212\252\236\364\263\266\304\316\227\221\211h\002)\020=\277cR!,\037!\301z\335\223\021HT\201\033\206\236\261\265%v\036\333\007$\200#\023cE%;\\I\3107\244yI\252+\350\327dl=JG>\222\340saA\222\222\231\257\016=j\025Y\263\356\305\331\024\033*\2738\032e\002m"
+	.string	"\007\231\371e\243\273\376\006\177\301/\022\020"
+	.ascii	"=\023\030\0278G\021\007\210\202a\256p\032&.\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k\317\005u\314v\236P\306"
+	.text
+	.section	.gnu.lto_tryArm.part.0.310.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\362\007\335,"
+	.string	"\232K\300\020Gp\\N:5D\201t\206\302\277\225JN"
+	.string	"1\264\210#\0220\002:\307%\230\205\376\207Q\036\315\267\355\217\f\026_\003\2108eN]h\3304\013\2146\320d;Q@\016\234\202\354O\034\237iK\244I#\322\266L2\364"
+	.string	"\346"
+	.string	"\372"
+	.string	"X8C\231\027\225\233\361\325\322\236~\305\005#\253\334\312\372+.\006\030\317n\325\2128+dt\367\236-\270\311\007\320\233\003.t\336\344\035\350|\031\363\213\2331"
+	.ascii	"&c\374(G\213q36\231\300\305\340C\371\231\214\233\361\020\224"
+	.ascii	"!I\262{\257\214\223_\366\304\254\2527\377\204\231\237\220\274"
+	.ascii	"2\313\375\314\353>\213\215\251)t\367\336\340M\333\365\365=<\300"
+	.ascii	"\235\237\232\372\320\336i\362l\373\254|\250\367\224\235\300\226"
+	.ascii	"\225\327yzF\300\235\024\214\254\315\226\325\217\377\302\220="
+	.ascii	"Z\365\021\206\344\321)\031drG\373\blYi\035%\203\324\272\332\t"
+	.ascii	"\204!\263\272\327\307*\254\237SRm\362\024$\301\\\001\307\bY\303"
+	.ascii	"\003V\031y\003\356\275jUT[\236\202\345\032\034\265j\212'D\205"
+	.ascii	"\344x\2657\216\252b\367\317}zF\367^>\361\353\374s\346\037`f"
+	.string	"!s\017)c^\274\207\271\265m\026\324\314!D\364\217\326^\f\310\275\344,\267X\313\305\314,\316\266C\2648c\313a\376\227\203a\3017\302#\220\372G\244\363f[\"\261\261dY\026\261\357\230\247\231\205J\375\343\355\325\236\216iC\326-\213\026\252-\027[\237\363\256\035\302\2346\013\245\315Ai3P\257\371\347\327\354\2436\367\250\315<j3\020m\336I\233\177j\263\2326\247i\263\257\327\214\246\315\275\264\371\3645\233h3\257\327l{\315\375\264\363\213\202sx\222\367R\335\331] &\027\260\247\375\\\336Cg^VH\267'v2*\316\210\342a\201S\222\321]\343\331\202\266{y\301NvF\0241\310\004\256+R\311\340M>C\017\304|>\227.\254\256=}\215\325-\334\206B!\321405\313{\257\003T\013\026\266X\001mRoV\265=\226\327&\225,\256}\316\352\336\313\234\300x/\321"
+	.ascii	"\320\362\330K\205\355X\240\035z#\265\374\331\035\373\251:\304"
+	.ascii	"\276\003;\235U\tz\257\021\002\177\316\355\326%|#7ym\262\212\255"
+	.ascii	"b\347\315\237}\360ev\253\332_\311q\223Z\022\373nu\"\342\367\346"
+	.ascii	"DY\264P\276\224\216w\242\323gS\3737>\333\353\312\322(Z\240\003"
+	.ascii	"|-;\231W(\024\372G\324\002\337\226(\215\026\212\0054\263\205"
+	.ascii	"\013\375#_\355\350\2316\312\272\345\202/\257\345\b\254\334\340"
+	.ascii	"\222ds=+\367\243\033\242\363\264=\013Cm\352\252\330w\314\217"
+	.ascii	"\273\232#\f\0324\2347Ok\242\221\342\244g\271\276\341D\343\243"
+	.ascii	"b76\027!\313\325r~\303i\332o\225\271\231\r\034<x8o\232\326G%"
+	.ascii	"N]\233\035P>L\313\305\340<\373#\202\226F\3711\334\006\202\331"
+	.ascii	"\230\315\236-\215=\263\225\005\214\242\310)E\323\260\005S\223"
+	.ascii	"\020I8\f\300\324\344\224\244\324\241\204R\n\022INK\025N0-\251"
+	.ascii	"\030&\0059\201PR\261\364\241\005\223\322p\350B\270\303\302\""
+	.ascii	"\245a\2230(4\021dZJR\021\024\016\235\202EB\334\264Bi\030l\321"
+	.ascii	"\3244\f\252\314\3347\"\332b\217\217\"\026\233\261\326:\217(7"
+	.ascii	"9\2729\342\372uf\255_S\353\221*rcs\002h\\\020\243\204\307\004"
+	.ascii	"\212\311\2414\002\207\004\330)\215]#\013\356jGB\237_oP\255UA"
+	.ascii	"oujk\272z\374,\027\363~t\n\331\216C{\3435G\3438B\357\275\020"
+	.ascii	"\270m\364\215U\007\326\252\245u\336\024\262\017\322\230\021\373"
+	.ascii	"\356\214\032\0349T\2423\310\267\325':\201l\220\345\236\312\352"
+	.ascii	"\031G<\200l\317-L\235[\024U\222\364\247A\377~\375\021d\025\322"
+	.ascii	"?\376X\340\333\033\256\013b\224]\344\266.f\353\36226\347c\271"
+	.ascii	"oC\255_k\221\365\310\221\263\307\372\330\016\200\266\250\201"
+	.ascii	",%\025Ch\206D$I\n\222\306\200\002\021\252\262n\021\2205\205'"
+	.ascii	"\205\264\031\nW"
+	.string	"-o\243\210\204\332\302\334\336\371A%\376\360\243\005,\313}U\250:X\\<\362\223\225\036\020\311KO\244\302\177\001\366D\352\033\256\207R\005hBu\024D\375\267\t\366h_\177\342eX\254\b\261\265\372\345\275-N\032~\262N\"\230\024e\025\326HXf\260m\254\032\370\036\326\027[o\324?S\262\r <qg\370y\255\311\351 H'\r\304\03042yz\351P\324\233\277o(y\350\312iLq6To'\256\037\"\200^\216\2249\tR\232\"\t9\020\235Z\027qq\211\007\360\335\312\270\212\300p\f\343\003\t\375\2342n\020@\367\0324\006x\b&k\267\300\356{\\\0167\363V\344y\025.\204qb*i\026\tg\3517\030\377\302\327\350p\237m\\\352\321\237\nj\263E\t>\237\323\204M\224\016\346;\354\024q\267T\t\247\b\2010\026\252\307\020\215W\177\251\264\357t$\202\274\333\204/"
+	.ascii	"\013\360e\277t5\t\316\272u\032\360pLnW\217}\021\250\207\254u"
+	.ascii	"\315\202R\"RX\206\307|\372\3008\267\260\266\224J#P\204\351.\357"
+	.ascii	"\335a\300>\222\316,\211\220O\2142\232\021\330t\224\265\331&\177"
+	.ascii	"\246`*"
+	.text
+	.section	.gnu.lto_processRx.part.0.318.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`o9\r\337"
+	.ascii	"\272N\231JG\020\020\246\355\214\001kM\020g\246Bm\321zp\213 \213"
+	.ascii	"\227\004\203?#\210n\274\310\365\rAh\316\0245\022\232"
+	.string	"O\210\334\325f2\333\370\331>\320\313lt\303\035\365\356o\037\353HF\006\375$\242?\263\021\262SJ)\212\0048\004\277\004\034\204xHuH\245|\303f\230\001\023\346\013\020\237=T{\250\204\376\326\036\251\177\314y\360\250\215j\357\373\336\351\301\246\026\344\336\020\305.\366_\353q\007r\020 \036(\036(\226\265l7\001:\303\334\204\355,s\020;\r:1\007\325i>\356>\016\242\003$/Nv\254m\0167\035\016\002\322{O\3127\354\215\"\216\300r\026\327\366\370\276ok\001\201j=\246\020\215\263(\244\365\370\345\370\360\214\265E\265\036\007E\001%\307\332,\f\262T\353\361\020\t\216gcmB\334g\226p\317u]\257\3516\235\307Axw\"\334\211\320/\330\333Z\207e\356\016\225\330\261\241bCU\341\017-\016\0045i\212\244)\362\363\207\206\207\001\035\232#\214\346\b\322U\334\373\025$]\363\270"
+	.string	"P\237\320W({\365\025\212\024\215{\273\\,|xm)z\311-\200\234\314A\374\336qK\032.\2112\356\375\362\342w\346v\3537g\303%a\n\357k\246\206\367\276q+z\311$\200z\211\324\035\334^*{\203\333K\346f\343\026/\226x\275o\034\0233s\213\027N\206v\334Y\027\2072dYs\217\357\033\307\324\313\337\322\320\356(\r\245\301\372\253\275\272\253\237\264\223n\322\\\275\325Z\315\244\263\032\253\247}\325\322\266\352h\277\274\345I\356\303\222\034\311\220\254\345Gv\344Ff\344EV\344DF\344C6d>\274\207\365p!\347aB\036dA\016d@\306\303\177|\207\355p\226\261\354\307}\314\307u\230\016\357\361\034\226\303q\030\016\277a7\254\307y\214\307w\334\206\355\230\r\257a5\234\206\353\230\216\321\360\034\237\300W>\303r\034G\003\201\003f\030P"
+	.string	"\0012b\300x1\200\213\026\002\260`ZZ\241\"\005\212"
+	.string	"N(\231(Ab\204\210$\244\243\246QQ\b&\b\242\017\036:p\330\240!\003\206!\241\013\026\202*P"
+	.ascii	"\372q\227\312\367\226\002\345\216vG\371\251\221A\005\\\032\272"
+	.ascii	"/\335P\274t\203y\371\342\322\305\333\353\254\273\353\214\314"
+	.ascii	"\373\311\331\230\267\223+\335M\304\256xsM\305\246T\357-\255%"
+	.ascii	"\222[\237\252\225n&V\252xgM\255L\303\274\261\272\246]N\274\257"
+	.ascii	"\246M\246O\274\245\323&S.o+\237N\255L\267\274\243U\255\356w\252"
+	.ascii	"\345a\253t1}\024+2\223n\225\026 \263\360L\2318O\366\231l\226"
+	.ascii	"\354#\351\034\031\331\f\031"
+	.string	"\t\351\254\215\324:?:>67>\362qf4\334\343\274\250\250\2479QO\036g\304BB\347\303HC\354\2403\037\277\346=~}\316z\374\370\234\013\363\324i&\244\263\347<(8\2479pN\033g\300;;g<wl\234\377\3264\337\031\261\246\331N\232\346l\232:g,\234\263\237\232>\2677g\276\266\346:ml\316t\332\326\234\367\254\315s\254j\316r\322\232\343\244\211\231I\3018\303y\343\006\315\213\263^^\027.\316xwhd\316m\354\224*\254|YwQ\314\260\2405\263\271\"\346\274\346\n\325Y\315\230\025\3474gU\234\353\302\234\351\272\234\321x(2\223>q\236\363`&u\342|\302\227&\316\327/\312)fR.\3473\034\3448\316\203\231t\253\310L\312\304il\035\001\255I?@\031\305\f\313V\317\220t\003\212\314\244[\221^@\037H'@\306\243\3070l\030\206y|\374\305"
+	.string	"Z=\356\242\260[\024\346q\001\264\315B\0338\350L\330^\272\343\205\035\343\345\347+\b\373\\\305O\215\024u\032E\235@:\036"
+	.ascii	"_\237\340\233\343Jwm\342\256\215\227\260k\022v}\330\370\2105"
+	.ascii	"-b\215\032OJ\343Hu~\004\347\315=\2437/rk\363\020\211{\31456\007"
+	.ascii	"a\r\354\244;^lN4\306K\315?\244\271\0070\336a\017\232s\330\363"
+	.ascii	"\3057\354\361\342\0322`\350\322Cgd.\244D\252\223\315:\312B\246"
+	.ascii	"\3551^c~\201\313\025\267p\307\213K\347u\322\030/1\017\372\251"
+	.ascii	"Q!\311\f\214\332\024\250c\274\2528\220\262\203\035,zP\214\361"
+	.ascii	"E\3511^a\376\023\364\225\345\356\035/+J\244\367}\261|\351[_R"
+	.ascii	"Z\031$\364u\345\257Dq\230\327(\3645Uv\350\002\263\325y\355\\"
+	.ascii	"_Rw\r\335R~j\274\357\313\030\252h\315=\245\231\203\346\230\373"
+	.ascii	"e^\321\f?\236\216\334_\036p{y\341)\274Y\2759\334\003O\3553\362"
+	.ascii	"\031\351\366\322\302\377\330\221\223\035sK\300U4\363s\013\215"
+	.ascii	"b\263W\037uS(\346\216\020\230v\377'\275\234\241{s!\350\375\316"
+	.ascii	"5\017[\320\257 \fs9\323..\026Dp\377\211\234\260\311)\376\021"
+	.ascii	"^9d\320W\325~\344\344d\031k[|/g\350\356*|\325e/\301\313@\245"
+	.ascii	"\320\351\324\355e{Y1T[D1\306\007\205\302W\271\302/\177\352\212"
+	.ascii	"e\206f\371\030*\240\367\275\202\301\036\306\305@\265\270\277"
+	.ascii	"\364\222\241\\P'N\334^V\370.\301\n\037\355\233\225o\337\270\251"
+	.ascii	"i\001\372jC\245\270\356\377\3337o\267\333>?F.\005\n\211\335F"
+	.ascii	".\320Sx\366\2540\251o\231\275\213{\261\321\005\375\372\372%."
+	.ascii	"aV\276\335n\267\220nY\377|\017(?\337y\335M\320\324\211\323\036"
+	.ascii	"\262k\361-P)\334_\030J\005Z\305{\013Z\305\355\245\373\235m\245"
+	.ascii	"D\276\2621\2670\345/\277\t\210\005i\345[n\341\334|\320+P2\357"
+	.ascii	"-\345w_g\260C\223\367j\017\231\260@\253\336[\377\313\301B\262"
+	.ascii	"\254\364\243[\240h'\n\251Y\3512\205\027(Z]!\225l\214\254\341"
+	.ascii	"\030%\324\365w>\327<'\234\031*\006J\306{\313\277\341\312\244"
+	.ascii	"\037\345\357>"
+	.string	"\203<d\363_e\0263%\256\223\270\375\037\215\343\345\352w\345\220\\\302\373\231\241f\240V\357-\356\274\256\200f\357\325\036^}\324\277\312\337R\372\267\333-#\177\026\346\256'N\232pmi\02597\223,\254);\367\025;\267\224\235\333\212\351\334Q\246s\277\354\fe\347'\323\331\311\316#\260\363\022vV\222\344\234$\311\031\t;\0379r6r\344\\$\311\271*\311\231\212\235\247\330Y\004v\016\201\351,\305t&\302t\216b\347!I\316B\222\234AHr\206Jr\016\322'4\003a\347\037I\316OI\316>\330\331\211\235{\260s\223\b\347\017\330\231\007\323\331\003v\336\301\316:\232\316\035\2603\007\354\274A\323Y\203\246s\006\354\214A\222s\216$g\034\354|\203\235/`:\333`:[\300\316\0250\235)`:O\320t\315\022 9G\200\344\fA\221\363\003Lg\007\330\271\001\2463\003!\234\003"
+	.string	"\302y\001\246\263\002!\234\001\300tN\200\351\\\203\351L\343\310\031\201\246\363\001M\347\031Mg\003\232\316\0050\235\t8r\226\321t\216\321t\206\301t~\321t\036\240\351\354\242\351\334\242\351,@\323\231E\323\231\251\310y\251\310y\205\212\246s\212\2463\212\246s"
+	.ascii	"M\347\023J-\331l\242\351\\\242\351L\302\310y\204\221\263\b#\347"
+	.ascii	"$#g$#\347##\347&;\0335\237\346\242\"\347\020E\316\314\""
+	.string	"g\020\215\330L\304\316\037\330\331\003\323\271\003\323\231\003;o`g\r\354\234\201\351\214\201\351<\304t\026b:_\b\341l\201\235\203\230\316\025\230\316\024\230\316@\354\374\003\302\331%rV6^\363\263\263w\\w{\231\022N\315\320\330\373vm%\337\262\245^Z\343u\333u\253\351\246\353>\241\033\260\033\261\233O\267d\373U\213A\225o\330\364\377\270<\266\25191\224h\372\200i\203mjVl E\343\316\272\200\260\r\027\013\331a[\363u\330\r(\276\341\002\313\026\2255)\f\207\0073\234\n\200iS\336\200\345"
+	.ascii	"\313!\204s\300\230\323BId\257\367\352}\302\031 ]\305\235}\275"
+	.ascii	")\2328\003e\334\331\227\021?\260I\246^6\331 \2127@\240\232\006"
+	.ascii	",\212\023\305\235\201yi-\341\016\224oX\334\031Xc\341\362\330"
+	.ascii	"\366\370^\305\245\340,g\"\305\035<\223\251\025\t\006H\333\272"
+	.ascii	"\3068\016\210\210\271\331\255Z\217}\352W.u\251a\234\335$w\030"
+	.ascii	"\252\236\307\355$\343\240\032\252=\366\221\\\322\221;X\333\220"
+	.ascii	"\316\216\334\201d\025\367z\005]\335\352\332\036\335\200z\211"
+	.ascii	"\301{\203\313\330\215<Z\221C\310\231\303\203YH+2\323Y\3531\354"
+	.ascii	"\304O.\017t\324\303\022y\032'\370?\350\323\tt:E\214\217Z\227"
+	.ascii	"\017*\232\251\340\307'\301W9\203\357\367\306\253_6\311\363\353"
+	.ascii	")\227\301\323@\232#\214\340\210+\301/\345\002\005Y\244\321\203"
+	.ascii	"`\031\r\374\263\003%\313\003\030\374\324\023\2033Z\352\034\370"
+	.ascii	"*\267\222\233\343m%\027\307\347\370\275\247\263C\312\223\n\025"
+	.ascii	"\267\2278~\004\261@-\033@\264\006n\374\217\033U\262R\nU\324\320"
+	.ascii	"a\340\002\244\367\202\357AE*\331\020\207f\366\002`c\257-x\033"
+	.ascii	"\377\306\202\237\022\003\264\206mY\240\202\377\341u\272\202\357"
+	.ascii	"\254\"\024\005(\230\340)\310\233\340u\210"
+	.string	"\341\261\206E\360\022\274\003b\371\345\365\"\330\t\b>\202\007\036\202\007\001\007\353\320\201\177\340\273\312\267y6o\367\244^y\222\221\271\275t\340\233O\f\253}\213\004\300W\353Z\215\2346\t|\225.L,\216\020\230,k5\032x\013`\244\\\251\237X\252\317-\336[\r\274KF\343\332\fp\371\353\"\003r\001\370\216\"\006G\213\300\267\365\002p\013|{\211\335Y\017x\016&\232\311:\273\226g\023\263S[,\342\253[\234\361U\005~\371\256\345\352\207\366\326'\344\323Q\2017\003\200o6\\\344L\273\322\f\220\303\003'Y@\0025>\201/S\343u\210\321Y\265\004\220\031#\343\363\360l\211\361U+\035\346\231v@\332\t\375%\313\332\024\0304\336\b\032\r\345\241\330\tVH\276(e^ \340\245\313\001\217\300\225\236\361\007|\n@\2545\003\276\200\237qf5@\t\227\207]\034\340\373\013\370\036\034\200"
+	.string	"G\027]\315\322\202"
+	.string	"3\002\036\tu\322*\200\214g\346\245/#\213\3612\236\b0\211\013\343c|c\255\211\301\370\006$\fc!\245_\374\362\013[\310\364\325g\232\373U\236i4\370\251|\330S\f\231g\231g\0314g\213\211\211Y\226\276\312Im\303}\361\255\245\313G\261a\006\372\365\342\221P%\265aVy\214vV\f\360SWB\260\001>\204d\025\025_\365\202\013CuT[L\341\342\237X\267\022[\274"
+	.string	"\357\242\211\265E\0366\f\213\357\027\340;\217u\357\013\n\026\337f[,R\310a\277(\025\307\314\t\300\204g\322kT\303\307E\253\023_e\022h\"\333\230P\372\017X\221c%L\274\212\347b2[z\246\357\237\301\025\277\244\342W\374\321\\\326$\212\017\340S|c\215I}\373S+\n\245\030D\277\023\337\037\300\367\266\225e"
+	.ascii	"\021\2518\242\t#\365\355KO<\016\252\241\322W\333\304+\275\006"
+	.ascii	",n\202X\223R\023j\232\312\3653d\373\367\351\366bk\342uP\365h"
+	.ascii	"\337J\364Q\243\n\222p\354\022\337fW\302\310\022\337}z\251F\025"
+	.ascii	"\264\216\370*k\033\217\212\325\212\021\211\225\021\321I\\\022"
+	.ascii	"\337c\256\204\214\336\230\004\356)'\347\366\222\304_\210\366"
+	.ascii	"=\262P\313\2234B\304\217H\344\273\025n\307\021\017E|\227@\355"
+	.ascii	"\323r\026\021\016R\022\322'\355\341\273\025\203*\\O!\322\267"
+	.ascii	"\t\324\276\226\373\353r\364U\276\353:\026\272z_\253\021G\337"
+	.ascii	"Z\256|\315?z\337\203\365x\365A\276[:c^\341\202\317\271\0222z"
+	.ascii	"\311\016\350\201O\272g\232\347\232\347\032\267\227\315o5*\337"
+	.ascii	"K\321\274i~\225\213~\371\027\264\\\261\237\2275id\364\037\270"
+	.ascii	"\201\0175\303\271{\346yo\031}k\313\256>j\302\264K\321W\231\350"
+	.ascii	"\227\277\214\366\375]\261!\276\350*H"
+	.string	"\267\206\371!\276\033[\271\346e\257\314\0264\213\336\f\307\005\361\314o\2541D\017\342?\\\327\266Y\223V\276u\343X\252\031\203~D\337\211\255l\244\312\261\276)\365l\271\ta\355\177\013\201\206rX\346\207\1770P>|\367a\245o <\344p\f\375\224\263\367\254\343\275\345\341;\260\273\013\213\021O{\270\304Rx\206\250\003P\340\225\020C\033\271\034\276\303\034\033}\320/\016?Em\243\305\360\276\357\207\rq\260\033^\006\265\215\365h\273\335z\320\360\306\216\006-\215\355v\333!\303\377\320\203>\377\240\323\f/\203jg\235\344\320T.\206\377q\315\363\004\364;;o\363\024|\022>\013\013\335^bx\017\250l\264o\221\033\276\352h=\004t\307\277\264\320\017\255\021\372\245\035\276\354\230\233\243\006\237k\027\233}<L\300SD~\211\322&J\006\026\322\210\341\001\357~\032\272\314O\304\247\342`\241b\366*"
+	.string	"\3069\210Cm\303\275\360S\327<OF?c\003\350}_\030\354r\001\034d\t\311\024\023\220\0206\004\251j\212\342 K>\240B \342 KOQPULD\244\242\242\244\234@p\220%*'\036NSLNE\034di\352\t\tT\024\0233\311T\325S\324\323\220'\034USR\026\370x\232j\nr\203\310\023\210\247\252\246\246'\037CG\244\206`\250\202\212\202\222"
+	.ascii	"\207\017\250(\fUA\200@\ra\340iH\217\246\252\033D\240\204\220"
+	.ascii	"\360p\252\"UMU7\204\252\210<9M=Y\3604\244\252Jj*H\325\320\223"
+	.ascii	"\021\250*\247\004\206HMU\021\221R "
+	.string	"\210\023\221\"MC6P\345H\3224\344i\201\250\251&*\250\005\244\252\2124ex\362!5\001\021)%PSR\016<Q\345 \322\344\224\201*\307S\024\024\216*\"OSSE\234.\260\323\322\323\224\224\023\223\323\017&\"PMQLNSTLK\035X*\204\247)\246*)\251)\246\240\317\302z\032J\327su=\327\260zi\0240\025M#\313\021L\177\245\350~\362\\\\\225|\262\005\312^\2039\371\207l'_M\200\232\374g'\031\263^\037&\373\262Wd\272\213\353]\013\027(\031\256W\016N\326\311J\237|\225\275\233\244h\032Y\214c\315\245\242\233\311smi}o!j\275\016\2628\332f\342\005\032\rz\235\314\351&Y\377\220\235\205\327\\X\377\220%\260\306\262\030\275\264\207\333\336*+$\233C{\202\245!\276M\310\306\267\326\022\f36\371\270\230\006Ekt\212\201\242\t\321a\313"
+	.ascii	"\037\031\233\311\364\025\370\233~\020\242\343\343\230[\337 \037"
+	.ascii	"\301\316\272zW\332q\222\351\253\357\022\306$\265k\300\242"
+	.ascii	"\203\215%}\017\201-\375 k\331\226\025\231\236\266\325\017\255"
+	.ascii	"\325\351\266\372\037\306\262C\264\303h_u\324I\236h_\277\337{"
+	.ascii	"\270\204Y\371\266\245\320\037Z\033r\226\201\276O\273\321\350"
+	.ascii	"\260\257\366\360\256\255\236@\357\363\227\370utNNb[\340\\\277"
+	.ascii	"B\377\366air}\320\2572PS\271N\247\031\345\033\245\236\322\215"
+	.ascii	"\323\312\346tss{\351|\035c\214\326\347\335\222\267\254\363\255"
+	.ascii	"\213d\033a\204\345\b\337u\221\326%_\365\nK\304\006\335\240Q\262"
+	.ascii	"\344\333\fn\311{]$5+M\242\204\202\222_\022\206d.R\312\021\216"
+	.ascii	"\333\032I\302q\255\344\"\371$g\220`\255E\216(\217\274\022\310"
+	.ascii	"\252\022 \031y\222/\n\033\225\221ge\233\322\355\231&\347\274"
+	.ascii	"^\335\n\r\302-\362F\376\355\260\326\244\3169\245\365\231\346"
+	.ascii	"\244S\2529\323\230\030|\337\027F/Yi\202\322\214s\215\323\316"
+	.ascii	"y\347\274s{Y\344[mL\216\022\262/{\305o\024\343\030\247\252(\230"
+	.ascii	"]\t\225\\\252\257\022C\365=e,\2166\212\245\360*\302Wy\352\247"
+	.ascii	"~\352{\020r/\353!\210\360\335\b$\302\367\227T\b\337C\311\325"
+	.ascii	"!|\327A\302!\"\365]:\262m\270Q/\365AWB\307\2540\3516\212H\205"
+	.ascii	"7e\033\271QOD\251%\352c\020\016\031R4\344\033\017\222M\b\267"
+	.ascii	"\361\"k%%\200@\305\207\360\224\355t\003\307)\007\222,;\235\204"
+	.ascii	"\022\242\344\202\360B\304@\370 \022\026\303\214\271\005\251\342"
+	.ascii	"\210}\0028i\007\210\357\225@\243\363\376\200\362Vr\203<\324\224"
+	.ascii	" \377\274\302\350\350\006\321JT\354\351\253\\\301\023G;\212\177"
+	.ascii	"`||\225}\260\251\311\272\353\341&t\353ak\223u\327\344e\r\344"
+	.ascii	"\271~\370\217?\362\226\355\343\244\364jf\347\236\323\216\243"
+	.ascii	"5\013\267\335\366\351\321\004\346\335\316>\254\323\216#\231,"
+	.ascii	"\r0[W>x\276~J\274\022\266\222\353\343\237\224N|\374\017\"\237"
+	.ascii	"l\303m\267\223<\234\376\033\237\270\267\023\320ev\n:\t\275\267"
+	.ascii	"\234\336\205Rv\345\036\364x_s\026\366\370&S\266\243\351{t\323"
+	.ascii	"_\310\262\306i\017uh\371\007\317\3544t\"\"\261\362J9\205\262"
+	.ascii	"9\025\235\214NF\267\227\037|\213+X-\231\016x|wy\310\346\361;"
+	.ascii	"\312\2568\360\340{\\\t\273(\2436\234\216\320/\017\376\277\366"
+	.ascii	"<\216\2719\265\215"
+	.string	"u\"7\210\204\242\301\321`\307\367P\356x#z\031|5\352\314\316\355\263\321-+\305@\307\3678\322\361\215\327H&G\007\217\336\301w\224+t\223n{cp\2245^\231\253k\204\322\301M\355\006\007\337o\212\034\374OTO\031\313q\351]\200\370\024\333>>`{\235b\237,=\033'\236\300\221\240\370g\001\037I)VJX\301\006y\n7x\016\304\034\255a\032<\341\303\331J\224\340\3735\370.A\254Q*\210\206\002\023\004\027\235YZ\001\204\344\2503\202T\351\200\244&%R3#\"\222$I:\263\025@@`P0\235\255r\317\007\023@\r)sQA\226R\347FHR\220\244\2601\007\230\221\306V\273\\\264T\203b\232s\202\253\353\364\232\034Y\210\021\203\373J\020\235\367\373\211\004\221P\256\333\274\230\017\276,\006\260>\332\371o\013\327\255\300\002?\313\212\316\272\222J\344$\215\177\n\377:"
+	.string	"\002Q\213\016\240w\356\017\315\335h\354\326\013\306\2148pv\025H\326\334\307tF\275_\246;\205hP/\021'v\210q\026\364\217\354\237`\006\341\030\306p\nhA\363;\005y%\301\204L\355\256\337C{\212\265\tI\227\222\357?=s\207\235\t\244PI\344<1\276v\357zDI\370l|i\004\3729\213\303\234\274\346\354\214\245\341\031\225!\354\rf$\215\367\304t\017\205\016\0034|D\033\366w\3506#2\240\204\020#p)"
+	.string	"3\373F\t\332\nH\315\252:\343\265\214{{\333\032\270\242r:\tw\321CXb\354\322`\355Q\220\334\013i\\\025[)\345\272\032\332\206\004A\"\242\265\263\244\370\333F\021\357\315D\232j\262\030\375d;\337\t\276B\311\254'\025\270s\355i\t\203\002\217\356?\313&\036\025\336\0368 \005\032\274\375/\016\253\240\263\005\264\303\013\023\365\254\326<\345b\352(wG\213Q\333\236\204\3674\335\353myS~\355N\300I\222*8\317\273j\340\205\304\317\323/y:\002W\247^O\301\243\023*\250\273"
+	.ascii	" \367B\3524J\255D\345\326\341+E\264\261\315\t\377\200R]2\277"
+	.ascii	"\237(\271\305yNY\035$\215\340:J\027\036\301+\202=\324\216\037"
+	.ascii	"D\270\024\317\215\b\233\375\304\031\221J`\241\237+\360\203\026"
+	.ascii	"\024\354\216\r\322\262\233\201\2515h\251/\250\210-B:0\333\316"
+	.ascii	"\031\346\220\2440\327\276\033\307P\201\304m\330N\302\335z\021"
+	.ascii	"\333 \213U6.\316\026\366\307\251x\216\223\375\224\234\311"
+	.string	"\013Q\352\265O7\310r{,7\212*)\331>w;\354\217\302\266\267J\310\277\021\223\026\366\276\034tB\273G\315\002\231\336W\213Q\222\207Y\200\327_\261\241N^\302\336\327\0256\001X\261\321\n&\251\305\226\213A\376\274X\003875\013eD\273\032\361\022\211\300\205\242\222\207%NO*\234\2174[\222ggSa\027\216q>O\270E\320\275\257\226e=[\020w5\357G\r\363@\310\246\273b\355<|jt\276aTe\2757\200\0232~\030\364\234\313\271\326\340q\037\334fkL\237Em\263\3251\"\242=I\334w\214\370\243\310\261\375\232\215Q\004UV\f\365\250\037\234\356R\352g\216\323\365\363\001'm\325\020M\250\177+T\275\007=\227\271=\275\r\323)U\001O\034\024\244\217y\275X\250\257\241\242I\200\301M\t\252\373\347_\261?\342\300/:\332\301x\250\276\372\221]\373\273\241\257I/"
+	.string	"Y\277\317\365"
+	.string	"l;t\316V\240k\334\237\250jXnA=!r}X\374\260\004\2562\215p\277c\347_\300\304\263\276E4\230\370\371S\t\326\330>ORO\243\320.\322\2234wE\272\r\bm6H\024\020\303\261J\200\352\013\033\221\300\377L\226\240\232\302\375Z\005\231F\030\315\263\345\345\325\211\002(\002Y<\202\020\274lC\252s\271\250\275\004\035R\033\367\247u\020"
+	.string	"\365\205"
+	.string	"a\253\256\201\276\327Q\210d\364T\006\351\200\314\251)uT\260a\363\342\331\016+\266\003\\D\006X\bI0\340\306\013\230\036\364\252I\274B\002$\347\037\337\320#\210zz\001\022\313tw-M\371\313n\377cA\311\271#\264\354\306PQ\203j\024\340\037\314\036!\247~\347{\371\257\215\333#Y\346a\324\240\247\221\236\314\230\374\312C\275\334]\367Kt\274\321\264\030\f\233\342\362-e3\230\316S\365\261T\321\357h\022pm\310k{\215v\330\330\013\023\204+\232\217\r\324CZ\272\206\254'\221\rQ\303\265\352d\333\037\206\3324f\""
+	.string	"'\013<\2603\242i:\222\375wJ\235\r\3637,cJ0d\037\366 \020=g\027\250\017\215\034q\205Z\027}\026]6\2469\355\360D\245DB\013aB\t\361\026\205\242Q\007\021\b\2626\230\340\207\017\232m\244\371?\bk\346\342\373\210\016\025\245I\335\330ROuQ\361\034\366\242\017l\177\016\271\207\225\364\305\271\270l\336\342\367.F\236\b\374i\352RK\006\024\024"
+	.ascii	"\256\001\200\264\270\314'mQ"
+	.string	"K\204\217\301\177 \240'"
+	.string	"\235\3557\364\231\nWX\313\254F\236\003\220k\023\276`\321js\344f\200\025\202[\322\2741,n\210r\300|G}h\002\245\273!\022\023HX<\334Z&\377\002\347\023\260\364lj\b\266\272\007\225t\365\227\224\030z\215\333b3\211+R\017\240P\3130\273\307\230\223p7\316\3628\032\245\364\222\316\0247\275\317\241!$\317\201\373\022e\035D\223\t\2238|\241dN`*\371]d\336\004\252\363\300\225\256'\245\225\241\342\243~\fxb"
+	.ascii	"V\001\210\322@\033Ww\261\350\210r\345sc(\242Aar'cd&\360'\240"
+	.ascii	"\241s\272l\0331\211\354\033\234\361-\261|\262\257\310\374Dl\237"
+	.ascii	"C\003$\354p*\374>B:\255QO*PZK\247$\354nX\224Au\377T\b!w\342\253"
+	.ascii	"|0\0139HG\367\344\030\201\013\260z\324X\217\375\354\022\037\326"
+	.ascii	"\2048jO\340\233vIm\324\023e\370\362\036\237(\325\363V\240h\246"
+	.ascii	"\332\334\244\275~\266v\374\304\003"
+	.string	" \273\013X\246#\226V\304\237`\245\r\016{\016\366\263\233\r7\252\241\250\207\3665\325\332\007\350\357\033\365Pk\004T\221c\306\026\354$\363#o\311\304sw\263A\320\352\250\214\317\330\210\216\250P\026t\361.9P\276p\001#~\225\252\322\262\245\023hJ'\276\025\247\344D\370\213\335\331\247\210E\375\257\262?\027?\227\021$\216D_\203\277\204%\321\240<\261\302\235\371)\027*\307\207\220\307.\254\322\303\361\254\337\235M\345tq\273\003d\021\367\312\332\311eh\275\273\342P\256\005n]G\r8s\372\020\351\215V\022\352K?q\263\234\204C3\315\344\374;\201\217H\222\222\230\377&\001\230\020\030<u{w\262\316=\307G\307\220O\210r8\300\254H\347h\241T\326D\220.\307\247H\270\313#\3472\247\272\2154\251\351\346\2510\200+\374\345y.*\223p+\3360KG\2553\"\274\310\031\2424^"
+	.string	"\233\032\205\302m\020\301\216\274\f$\223:P\312\3754\353\377\322\362{\003N\323qj\215\3206\347\022\252\363:x\355\201\tG=\331E4Z\201\t\235d\340v\310\272\300\316[v\264\3575_\246\371Z\221\301v\257@\265[r?\004C\242\035\021\242\221\262\"\377\312\310\365+\350\314\013\034\240\202{\221\336F\230\227F\270D\364x?\211\2169\213E\344\242z\227\353\240iE\342\341`\207\251\237\254\210b\320\273\026\322YU\320B\341+n\306O\230"
+	.string	";uE\005d\304g}\354k\274\202o"
+	.ascii	"<<\322\307X\237\314\212YT:\210\032\330\215\262\211boS$A'W\235"
+	.ascii	"\303&\261>~\3364\204M\220\331\273\335\271\214LbK\372\301\212"
+	.ascii	"EUuZ\303\361+\024\306\236\315%i\035\335\265DV\200`\324\\\340"
+	.ascii	"\247\003\005K\235>\210\233\243\332\\r}-k\375EX\305U\026pa"
+	.string	"\312\273>&\376'I\2053\277\035\230\244\243l\035\326\340\227z\377Q\344\262\313\266\276\004M\366W\034\234O\375s2\357q\262z\346\273\314lue\r\1775\211\345<\242\333\343C\213\314\372\005\275N\025\275\246\304\275Vi,d6\223\374\205\350\316J\375\305,<I\304?\016\022hH\333\177\017\034'\276\200\257ql\326aho\352s\263\212\211\255\362\335sgI\366S\001\325\032\245\353\277\324\226\361\212GB\272E\372\024Y\321\225\321?\257&)\001\325E\326\n\317\027h\255wt\225\301\037'\026\034\013\312&\370H\331\3752\310\304v\007\246`(\375\202)\201\027\034\321X\230p\024_\250$\355;gI;\025d\027\013}c\246\200\323Q\236\331\017\351=\347\005F\031\267dj\215a\330Y'P\030\341[\250\222R\275\2301S\227\246\206\205%VZS\343\215\007Q\222\n\203\002\377\270\242l-\226\3564eR"
+	.string	"\026LcW\235dr\306\237i\007\233\213)\356\266\371\251\352~\177\321\037@ae\020\353q\247<c\252m\212\230\316\355\360\002\341\033f\037\222aw\276\307\361\255\330p\214\374E\b\203\342F\250\354\342\354\210\312\323\244\330\f\206t\005\347\2241\034=\227[\337\276\312\3576T\306\203]u"
+	.ascii	"\244)\336\325\007]v\304/\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\205\026]H"
+	.string	"\232qT\030:0\346M:\233\313D\263\035&MQ\232%WWt\250V\003\226\264~\325\267\204!5$\213\037\377DW]U,\270\254\367\300~"
+	.string	"\002\356ig\252s\2311x#\364v$I;|\001p\001z\001f_2J\305K~\241.\371p\270\344\007n\311?\245%\337/K> \226\374@W\362\005\241\345\003\262\222\337\366u]1>\276J~\332\317p\037\025\3744;\331\331\257B\214\235\214%A\362\243G\331\313\204\030\343H\202C,\311\016$;\306l\3640\302"
+	.ascii	"\2375{\362fB\262|7_\363\333\234\337fJ\376RJ>\233(/%\204\222\277"
+	.ascii	"\346"
+	.string	"I>\232@'\371e\232\344\223a\222/\006]r=\241\222oJ\362LH>F\3307\226\321\266#\371a\214\344\2039\230-jhE\362\225(\221\277C\362\317\240B\036)\b\026\005\344\217\204?\356H\350#\377K\217\374.<\362\257\240;N'\206\005u\340@a\216\217\302\221o\006\275\3617\033\370O\370\254\221\217F#\337\n:#\277\n*\003\237\212\201\001a`S/\256\310\005\366k\201I\261\300\203+p)\241\212\214\362I\3619hr\375\203\"\377\354DF\303\240&2\252DK\234\020\211\017\032q=\"\376&\304\361\200\300\243>\374\017\2025\231d\373\371|\nz\310(\027\264\303!\t9\240\311\r\257\023\366\252\001%\313\360K\030\362\323\240\027.h\341\244\204j\276\0324,\237\nZ\341Z(<\313\204o\001;\027\toF\270$\004\020N\347,\331\203c\021b\214\207k2\271\372\3018c\f\307\345"
+	.string	"\326u]\035\344{A1\306Yd\001\357\215\245\314|\302wi\367"
+	.ascii	"\322\272\307@\336?\310{\t\215V8\"\355\261\342>\255\030/m\"\356"
+	.ascii	"\377)\216\227'n\246]\204=\206K\373\203\toJ\273\210^\332E^Oi\217"
+	.ascii	"\261\237\322\036\003\225v\312b]]\271\230\214}\325\376i\200|\217"
+	.ascii	"p&c[\275\232\214m\345Z\265r\306\256z\253\354\214]t\347\2148\222"
+	.ascii	"\244LL\261c\274Gmkp\235\261\253X\271b\027\335bk\251\330E\366"
+	.ascii	"[\221\310\346`\272bo\270T\234+\366\260=\332F\247\024\204'Q\365"
+	.ascii	"\337\277)\250O\332\333w\032 \037$L\211\252\305\216\256\353J\206"
+	.ascii	"+QuW\034U\023\337\341{\2574tJ\334\304\315(\377oQ\276)E\371}\211"
+	.ascii	"\362'!\312\027\305\314\017u(\237\357-\177\317\315\007e(\377\223"
+	.ascii	"[\276\247B\371NB\371\235\006"
+	.string	"\345\347\265\345\343\t\312\347\024(\377\016P\276\335\237|M~\3621\365\311\267\304\226?\307'_nO~%=\371\224\326\362\343\362d\364\fO\376\241;\371\214\354\3447R\313\207\253\223?H'\3779'\243\253\234|\2678\371\206\322\362\027\301\311O\364&\037\221\233|f\233/\247M\276\273\314\367\303&\277\317\232|65\371|\322\344\307A\223\277\347L\376\232\231\374<e\362\357\220\311\2673&_ML~\2350\031-\003\223QV\231\321\215\256\271\367\302\356\265j\243|\234\356\027\265Q\266W\251\376\213\236\333!\334\f\033\324\f\353;\303\272\370\026Y9\260&\272\304v\020\254\207I\007`}7\016\254\337\202\265\030\330\033\364p\371\037h\320V,\340W\027\337\300\257.\266w_\247\276\232\270\374\341\304\3351\217__}\273\364\253\305\004\277\372\270\364BbI\253\025\214\207l\255\366`\177q\370\017i\207Y\207\377\220"
+	.ascii	"\224\253\022\377!;u\217\0231\212\303y\310c*k\303|\310\306r/l"
+	.ascii	"\243\347\206\235\310&\272\303W\016\331\303.\205\354\233B\316"
+	.ascii	"![\f\331E;-\257.\336y5\361\355\363jb{\2555\204Z\354\347\325w"
+	.ascii	"\353\274\034\245\013\272\253\356\330On\035\233\370\206:v\221"
+	.ascii	"\355t\354\252V\324\261\257\336Q\307\306r\036\027y\202s\006\357"
+	.ascii	"\035\321+c\362\224{\307&\340\222:\0329\3359\033\272|[=d\217\265"
+	.ascii	"\006f\r;\267\372\315\255>{i"
+	.string	"\253\273\366\016\354iu\327\3317\355\241\373\b\231\366\326\210\254 \321\345\224j\361\261\315\341fJEF\321\\\225{\007t\313\245\025{\001y\374\234xS\332WW\235\2276\026\213\325\246\355\237\276\004\330\367\0347f%\002YY\3137U\332Y\257\001\3667\320vJ\333\300\313\305^A\235\271\225\253\375\313\032\205y\304\345\276\217\254\243c\373\276\224v\216VG\353L[\307\313#\030\0133\373\312\265b/f\t\206\231]\2254\332!1\263\213nE\314\354\267\230\331\033>\0063\273\0133\037\006\037\352aR\265\363\302o8\322\2423+n\342\267\026\373\001\331<\337\260\023\277u\027\030\374\326\t\302\260\241\356z\252-\306\350\253\332o\363\234L\355{R\355\347\251=L\206\251=\354\303|*\226\244\207\307\356\252]\320W)\324\325[\2466\035%\234\362\254\332Y\257\201\226\313\355(\03739\024\324\376\262\275\231\332o\363\376"
+	.ascii	"\035\"Rr^\366Z|lrjj\337\316\373\273\275A\204/-_\254\243\363R"
+	.ascii	"\373k\357\0258\375\330\332\007(\353\364\207=\202\263H\007\304"
+	.ascii	"~\200\240>\247\302\266\271?S\373m\257s\251\366\007\271\201\257"
+	.ascii	"\242\366\355Z8\334do%\360\356\375\217\246\3669\265G\361\334["
+	.ascii	"PCC\203\367\036\035\364|\n:[=\3668T\031\2623\307\002\252}k\331"
+	.ascii	"4\250\351X\332,j\177\357\375(\227\375\357\347\376\275\200o \333"
+	.ascii	"\0367G\021\352\373\025\367\203\357Q\334l\217\007\351\224\200"
+	.ascii	"\260(\265\377|\277 O\322!\274\327t\257\250\215.\337\3016\357"
+	.ascii	"/*\020\247\267ca\005\337\270p\336c\276:|d\270\223\332\250\234"
+	.string	"\366\n\320\222ks^-\354\013l*\325\347nQ\033U{\317\005\350\327v.\355\333N\234\332h\236.j\201\245\250q\034\350\2744\"\"\222\202$I\007q\005\2049\307\\\231\007\021\300$G\031\231\021\221\030\221\021\321\003\303Pk\351\366;\266\200%\250q\342 \264\256P@|\301 {\357{Y\323\347\t\364F\221'\016\361\202\036y0Z>%nc\023*\216H(\335n< u\225(Y\354\350\306K\237\331\371O\302\214\322\016\217\007\275Q14\2262\350\237b\3526\331G\205\223\027\252\242H\025D\226,J3\211\200@\2714l\333\025\362\275\003\367\361b\205\221\037@zg\020\274r\370\213\204hP\367\3256\310\013\215\374\344\360\246\267\326aa\203\223\305m\200\007\030EE`\345\025\030\345\373\256\271\302U\335\322\201\277\273\002\210\356\360F\316\bw\343;x\326F_\370\030\b\363\222\304\354\\+'\013\226"
+	.string	"\f\324h"
+	.string	"\333[\r5\034~\335\032\036P\372\202\377\200\344&\200\316\024\325\356]\3530(\304\232\013Z\231\211\345\035\265\224\206M\2064\023\263\254\030\347+c.\211.\243\334\300}0j\325\270;GhHDQ\204\243\bm\024_\007\031{]\177@U\0369B\260P\263vo\177\203\251k\002\0315\370;\317\215bh\237\303\273\303\344<\342c\016A\227U6\240C\272\250Y\253\035:\214`\256\304mX\221\322h\210pO\025}\342\277\235\223>\214-w#\202\363\304\324\215\205\005\307"
+	.string	"r\260\270\b\260\362\372C\241\031#\037\214\003j\202\271\365\315KnvP\205\366w\005\263"
+	.ascii	"\324\226-\224\375\004\240{\206\273\231\306?\360\"\027\246\334"
+	.ascii	"\032l\007\212\303"
+	.ascii	"\204r&\216?\354\345\346\353\032\031\005\f\331\r\266+/+C\004\026"
+	.ascii	"\004\220\223\026\261\324\220*\205K5\035\371$\001|D\031\363\336"
+	.ascii	"Fk\006\272y\247N=\342?\241G\374Be#1\344\031\313\331\332\002\007"
+	.ascii	"cv\303\324\346\373\003w\337-\245\260#\022\fg\201w\211\242\220"
+	.ascii	"\377|\225B)\260a\336\fIC\221h\024\222\206\"\321($\rE\242QH\032"
+	.ascii	"\212D\243\2204\024\211F!i(\022\215B\322P$\032\205\244\241H4\n"
+	.ascii	"IC\221h\024\222\206\"\321($\rEB\003gTg\265\376\334\020\354/G"
+	.ascii	"E\034\334\352\364\345{\026\347\215\373wb\333\266\335\024\315"
+	.ascii	"\r\352`\016L\230\036\b/\323_\353Q\2064\311B\200\326\261\206L"
+	.ascii	"\004E[_O.\254\021\303\017x\351x\337_\300\352\302kIV\002\362\340"
+	.ascii	"pf1<\274\220\377\307v.\334cd\365\f\342t\034\375$,\237W\303\037"
+	.ascii	"bFoC\223\243\374\266\235\244\bjk\225\002\265\373\274L\022\246"
+	.ascii	"\201mO\374\331\232\305\177\324\273i\031\210\007\332T\220\004"
+	.ascii	"\226\032`\234W\034\324\252\300\260=H\031\\\264\\\216\306|Q\320"
+	.ascii	"\242\202@[Ky\330.\032\220\274\300\\\005"
+	.text
+	.section	.gnu.lto_.refs.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`\006\003U\025"
+	.string	"\306r\215A\340\026\2519H\250I\364-\035X\206!\005h\25380(ng\001T1+e\314\ba\2141\306\030c\f\276\030\t;\005<\030$\221\235\021\200\rx\n\005\251}##\210\366K\324\f\264\022\273e\nr"
+	.string	"z"
+	.string	"}"
+	.string	"\334\313\342\356d^\025\367\246\270Q\2627EvIf\256U"
+	.string	"\313.\346\367\n\303\035#v\020l\036\356\233\227g\257a\256w\305u\252\365\222\\\266\234\336\254\336Yw\013\353n\345U\255\336\023\313\246\325;Z\371uU\247**\237R\227F\217DQ\2430)o"
+	.ascii	"\323\013\343~\231v\225\336\026\351m1\315R\272{\257\212\364\246"
+	.ascii	"\214.\211\026q\277w\367\210\013\233z\036\305\374x\036@5\275\227"
+	.ascii	"\364\036\245\274\"\323\373"
+	.string	"L\r\220\272f^\227\031\024\367\b\266@i\0322\206\272\303\240\275_\254\336.hg\261z\203\272\031\320^ \332\353C\333v;\347\266\315m\231\235cZ\007\3209f\373\365\272e\365\252t\233X\004^v\255\027U;\245\266)\347%q\017\247\364qo\3367\363l^\002\264\267V\363\346\320\2744\003bf^\230\331\373\202\355\022C\341\376\304I\023&I\220\0341Rd\210\020 ?h\336>j\336=v\350\320y\343\250\271\r\032\266\317\2101DCs\027\267\013\335^p\373\200\355\332k\234\235mZ\327\350<\300\266\214;\306\332\025\264K\320\333\022\364\262d\320\306Zl\001\243U\261S\243O\261\237\350\202Rn\347)xI?s?\023\214\276\254^\226\356T\355\023\020\002\322\232\317\213\323\363\r\317;c\035\363\372\3653\312'\327\340\336\340\332\340(\210>\331\tO\302\373dFx_N\b\357k}\360\302\254^"
+	.string	"/\307V\257\253\273\263\255:\364\246\016\215Z\275\242\256\203\323\027\264\301\313\205"
+	.string	"\361a\213\227\363\320a\213\271\r\334\334\205\324\317\311\022\237\367)\351\371!!\022\204G\216\031.\262\370\255"
+	.ascii	"\372\251H\201\342\204\211\022\205~$f\357\033!\242\320\373B\314"
+	.ascii	"~ <\274~\0344\300~\0310\310\336w\201\365\263 \373U\220\275\243"
+	.ascii	"\260\0063 \200\"cD\273\001F\022\001\n\306\333\363^\342\372\321"
+	.ascii	"er\262Rj\217e\300\025\3146M\353(\254p\022\333\245H\312\227\304"
+	.ascii	"n\005\261VF\314Mv4\206Iv\032\263\311i7$\306\340&\332\371\254"
+	.ascii	"1\263MM\330\274h\225\335\326\260\037\324\300\264\3007\365\003"
+	.ascii	"f\361u[\235\030C\030f\346\355\021\213\0063\004\"~\023\211\021"
+	.ascii	"\327J\254\303R\003\223\002"
+	.text
+	.section	.gnu.lto_.decls.d29c63c66af31638,"e",@progbits
+	.string	"(\265/\375`[\213]4\002\332\214G\310S\020(e\3514\006=\366d6\346\247\374\336\265#\262\261\fK]\360\016\326\013\305%v\3421y2\032\266\210:\277&\306\270\271\320\320\030\254\205\255yQ\024"
+	.string	""
+	.string	"\341V\221"
+	.ascii	"\t\"`(\020\004A\206\\>\237\026GQTtaWfU\255\311\275\267\334r\247"
+	.ascii	"\336\n\274\f\031\r\027<}\324\367\204\355\367<\331\357\301\332"
+	.ascii	"\357\221\332\357A\332?Z\004\305B\205\240O\2047\332\316\310\262"
+	.ascii	"v\202\n\316 \243\222\365y\002\367\177\224\t\272\004\325B\231"
+	.ascii	"\347\030\332\004Er4\311I\367\234E\004m\202*1b\344l\3231\342\211"
+	.ascii	"\221\350\2120\321&\350\221\021zC\244\266\342\270\t\364\341\303"
+	.ascii	"\207\017i\221)=\272\241>\017\230\255\272\355\363\260\355\363"
+	.ascii	"\254\355\363\244m\224\210\210\243Et\0205NL\262\326f\373\314;"
+	.ascii	"\177\324\nN\037\365<]\373<B\366yv\354\363\320\330\337a\263\277"
+	.ascii	"s\267\277\263\266\277Ce\177\007\311\376\216\324\376\216\321\276"
+	.ascii	"\016\232}\235\271}\235\262}\235\256}\035\254\r\302\351\243^g"
+	.ascii	"\307\276N\323~\316\337~\216\230\375\234.\3739R\366s\262\366s"
+	.ascii	"\252\366s\232\366q\006\367q\362\366\233\247\217z\034\267}\234"
+	.ascii	"\261}\034\256}\234!\3738<\366q\216\366o\356\366o\330\366o\272"
+	.ascii	"\366o\220\354\337\360\330\277A\332\037\346\355\017\343\366\315"
+	.ascii	"N\037\365\303,\373C\255\375!\220\375a\322\276\260\314\276\320"
+	.ascii	"m_(e_Hd_hc\177\017\356?\233y>\363\263\355U\242\343J\326'\027"
+	.ascii	"\021\317fP\2635\030\201Y\177\377\355\3573\373s\247\217\372=\267"
+	.ascii	"\277\271\354o'\373\273\307\376\363\334\263\230?\313\235r\271"
+	.ascii	"N\0038Fp\330\370\222u\016\223\351\236\3532\230\\'BU\034\037\345"
+	.ascii	"\272\235\3008>\3329O\f\316\023\003\315u\245DL\325\3379\3669\267"
+	.ascii	"CW\326\227$\353"
+	.string	"o\032[\230\341\336XLMu\271=\277\225\235U:6\302\266vd\235\245\210xv;!+\bW\233\207\234\2771H[Y\377\231mm\207\024\240\225\254\177\366}\t\242e/Y-\247\235cy-w\371\251&\237\241\255e+V\332\344\345\265\034\226\315\320\246Y\003\254\004\346\243\265\\\345l\023\301+o\260\313\357\203N\221\300\254\032C}\306\347\217\372\025\314.\003:\373\262\226\bf\375\325l\177\004\226\223\017m\232\355\030X\312l\311Z\262\030\332d\nc\f9\363g.y,\223\235cyK\316\362\fv\242\211\330\222\257\304GF%\2641\003\354J\237|\210\221\333Z,\313\330SI5\244\262\376Jd\177\315\261\277\302\330W\377\366\325\276\215\023f_5\333W\2314\273p\344\304\364\250d\375\223\f\312\331\2066\231+\226\253(y^\231J\236r\216\345\256\314\365,\3454\363s\204\255\323\353\234\233\212\215\322l"
+	.string	"%\326\223\363\353\312Q\3166\035\243f\3544B\236\236\334V\0347?"
+	.ascii	"}\370\220z\tRekk\364\364Q\257\312\330O\007\367S\274\375\024m"
+	.ascii	"\377\371\211Z`\340\224\254\323N4f\374b\370\363\216\214\225\213"
+	.ascii	"df\306\221\263\262\222\274$#\311S\331I\226\312:r\223L$3\311<"
+	.string	"\362\221\334#\033\311?\262\220|\225\223\344\252L\225}\344 yH\006\222sd\253s,k\345\250g\033\371\306sS\r\233/b\306\3701\323\276\0042\323\316\272\277|\204TF\306\356,s\316M\235\260\205&/\216\343\237S\002\343\230q\334L;\303\260!#\370\226w\246\235qm\316?;f\0347Ed\032b#\374\247\232\370lkc\272\235og\233\340\351\366\213\230\221e\2141\325\030\2611Ed\255\334\224\241t\3208\016\342\305\214\343XD\256\241\205)\"'\221\345\221\375\247\232A\267\254\364\213\3100\270\210\3101\262\214-tm\340\344\376S\r\240\034\023\355?\323N\265\301\276\377T\263\006\317\314\231\263M\007\215c\2523L\021\231\351l;\347\246N\340\3122\"k\235y'\3379G\004\001S\312\344\305q\363\347\224\377L\373C\030!k\235sg[\t0\342x\n\027 \252\304\017\317\213_\0347?|"
+	.ascii	"\372 \374J\222\303+\001:\347\235?j\020\221\235\241\3324\020o"
+	.ascii	"X\265\006\233\364\262\316N\"\236\237*\340\242\326%\353\365\364"
+	.ascii	"Q\237Z\355\247O\373Zp_\357\355\353\263\235\227\264T\034V\222"
+	.ascii	"\254\257\305\366\365\222}\375c\337\356\374Q\257\221\366Q5\373"
+	.ascii	"~\347\217z\024o\037\375\262\217\266\355\243f\373(\226}\024\312"
+	.ascii	">\372c\037\215\261\237\371\366\363\333~.\333<\247\217\372\274"
+	.ascii	"\363G=\323\234z\347X\007\347^s'g\265\321b%\353\347+\373g\007"
+	.ascii	"*:8xv\240>s\355g#\373\371\306\006\212\341\274;\307\200N\2740"
+	.ascii	"HM=\262~f\332!\210O \365\203'\220\372l\264/@\263=\250m\020\236"
+	.ascii	"\354\022\316\037\365'\325\376\tc?\313\371\243\336\3357;\177\324"
+	.ascii	"\233\330g;\177\324s"
+	.string	"\355\364r\216Qp\262=\204\021\216\032}\355\344\bF\021\004\314\372*\354\237\024\250\347\340I\201\372\240}\301\351\243~\356\374Q\377\363\254\203\235\20466\245\213\331\331\254\212\322&\354\247\331\177^9\261\234egU\034'\305q\274\341T:\303\304&\3533\313\251\345\034\343pn\371\311\345${z\324\214\233q\034\357\234zD\220\240\262\3469\177\324|\372\250\347`\377\024\373\216U<\302\367\006A\034\237\034\324sp\360\344\240\346\252\363G\335\340\364QO0\021?\303|\324\247\251f\234%\216\343\035\035\250(abY\367\234>\352\177Z\341\260B\351\362C\310\027\005;M)\246 Y\377g\225\377\224rN9\275\320\245\032Uq\2268n\366\254R\326\256\262d}z\345\263\353l\376\364:\251<\204\021\216\223\024O\211\343\346\351\245\343\370\350<1\3209O\fR5$GVT\375\274\337<\177\324}\372\250h\214\223"
+	.string	"\232\001\332\307\237\317R\003H\375\271,-\300SzB\336\3224P\252\224"
+	.ascii	"\277\216\321\201\216\005_\277V\372O2:\273\177V\033C\223\251\t"
+	.ascii	"\177^\321!\017\351\243?oI\007\360\237k^\263sD\n\037\350@X\213"
+	.ascii	"\f\345?\007"
+	.string	"@\016\320b\322\022\376\224\204_7\021\341\377^\032\302\217\002I?\370\323\0160\370\323\t~\315%\345\360\201$\277\n\250\035\220O\374(\002R\t~\264\203f\341G\013@\200l\301\257\271h\006\350+Z\005\224\0044\310D\026@\027\207?\335\"\034\340W]\020\024H\201\3764\202\016 \220\351\264d\020\362\005\331.\373i\020\332\203\0162\007\r)\317\2573\370\265\006\177\272s\016Rt\220\352\374)\316\237\016\377t\377i\376\337\245\003\177\264\207\001\277\252\301\237\277h5\177\026\300\273\326\022?\326\003\374(\th\217\001d\256\021~tC\216\020\025h'\177>\353\373\321\r\234\330\200N\223\001\3578`\303q\020\376U\203\241\3069#\360\347\266k\276\377$\200\027\275\367\237\036t\345\300\364\357\327\031\264\2065a\022\374z\202_\353\375'\230\377,\273Is\n\256\377\340W\323?\323iq\372\237\376\253\005\031\360\016=f"
+	.ascii	"\005|\327=\370U5\315\301\237\303\362\364\230v\001\315\237\225"
+	.ascii	"\177n\361g\027?z\001\035\342\327 \234IA\013\240\002\023\310C"
+	.ascii	".h3?\332\341d\250P\353?\177\225\371u\006\3602\340\335\257\327"
+	.ascii	"\030\256\350\017\200:\350p\345\204\212\225\351"
+	.ascii	"\264\226\016\330y \303\257\376\375h\bP\246u\202\037e\241\311"
+	.ascii	"\374Z\314\177\274\263\375\210\370\317\n2\b9N\323\235\003\035"
+	.ascii	"\346?\333\361\376c\360\253h~\264\002W\1775\206\377\254 ?\375"
+	.ascii	"9\352\034\244@\225`\376S\311\177:\371O\270\377|\362\237e\347"
+	.ascii	"`\276\361k\270?\277\3517\355\366g\243?/\375\371\350G\213\272"
+	.ascii	"-\303\220;\360\024\232\355?\220\003\320\f\250T\276\247\263\234"
+	.ascii	"\036h\265\233\215\341\340@\377;\344\272T\313\257K\374YK\032\032"
+	.ascii	"\2001]\317\371U\t\374\350\022M\237uI\3465a\3725\373\363\005\030"
+	.ascii	"\350\262\377)\272F\374\007\300\257\ni\n\310\336\365\246>\221"
+	.ascii	"1\360g\342\257\271\374\350\003\364\226?s\351\261\037\325!\226"
+	.ascii	"\255\374\357\340\177\207W\360\253\017\3703\235\326\222\355:|"
+	.ascii	"\377*\006\317\277\212\343\377\236\316\"\200?_\301\362\243}\177"
+	.ascii	"\246\242\257\350\234\355\312\177\016\376w\370\321\240\b~\025"
+	.ascii	"\003?\352\227\327\374\372\277\016\373Q\300?{i\260\354\207\363"
+	.ascii	"\247i~\264\311\217j\375(\224\257\034\370\321\266\037\375\362"
+	.ascii	"\243r?\n\367\243n?\032\367\243`\310\374\332\312\217b\371Q\266"
+	.ascii	"\037\365\362\243[\277\376\372\277\363\257a?\212\346\327U~\335"
+	.ascii	"\374u\327\257\251\374\232\353\327Q\376\257\377\n\346\327[\277"
+	.ascii	"~\362k\346\257\223\374\372\310\257\215\374\232\310\257\205\374"
+	.ascii	":\310\257\255~]\365k\252_\353\370u\216_\333\3705\324\257i\374"
+	.ascii	"Z\306\257c\374Z\351\327H\277\016\301\257?\360\353\016\374\372"
+	.ascii	"\305\257"
+	.string	"[\374\272\350\327\313_'\177M\364\353\342\257\331_\023\177\035\201_\237\370\265\211_;\340\327,\374\232\001\277V\341\327)\374\032\205_#\340\327\006\370\365\t\2776\341\327%\374z\304\257E\374\032\304\257=\370u\007\277\326\340\327\025\374z\202_G\360k\r\277\316\360k\236_\353\374\032\347\327\303_\357_\247\277\376\217\n\376h\340\217\372\375\250\232\037\325\373\321\274\037%\363\243b~4\314\217n\375(\220\037\375\361\243=~t\307\217\346\370Q\034?\n\365\243N?\352\201\037e\372\321\031?\032\343G\223~\364\350GC\360\243\037\370\321\026?\n\377\250\362G\217?\272\201\037\035\372\321\025?j\374Q\r\374h\006~\024\304\217\216\370\321\013\374h\005~t\002?\032\201\037=\361\243&~\224\205\037\355\340Gy~\224\001?\252\302\217\246\360\243(\374(\211\037-\300\217\022\340G\007\360\243$\374\250\b?\n\302\217\006\375h"
+	.string	"~\324\303\217n\360\243\031\374h\005?\332\341G%\370\321\r?\372\363\243=?\232\363\2437?*\374\321\365G\365\217\346\037\375\237\005\377\034\370g\277?\367\375y\357\317i\376\214\346\317e\376|\367g\273?\217\371s\335\237\277\3749\356\317o\377\035\360g\030\376\247\370\317\n\374\271\355\317^\376\254\366\347\264\377d\377\313\376w\375\337\373\363\331\237\313\376\274\345\317Z\376|\345\317a\177\376\372\263\327\237\251\374g\3733\327\237\267\376,\365g\031\177\356\300\237_\374o\341\317/\374Y\003\177v\341\317%\374G\361g\021\376\234\301\237'\370O\301\377\034\374O\013\374\347\004\376S\002\377y\200\377\034\341\177\227\377f\377\277\376W\371\337\374\317\345\377\333\177\r\006\007\007\007\377\fK\277\005"
+	.string	"\370+@\025\372\034x\331\277\nw\216\251p\372O\205\2528\252\204=a\033\033\036_\262>\007e\252\233\352&\001-\016\220\260\261y\261\301\001TZ\232\272\346\241*\216\002\341K\324\020\251#_\230aY\253jcqV\320\262>\007J\373"
+	.string	"\340;;[\377\254"
+	.string	"\340\313\376U\2621\225L\325Qr\266\327\303oFsI^\326jY\006\336\270\262>"
+	.string	"\310\366\001\260\265\177u\313\026-"
+	.string	"\f\331bbi\335\216mh\036c5\232d}"
+	.ascii	"\330\310\222%\225\242\2331\224\004\256\310\270m\001^\271\222"
+	.ascii	"J\321<q\022\326\026\363\313\276\372u\252``j`\373g*E\375U\257"
+	.ascii	"\237c\252\227ZE\205\252\330\206\007/L\316D\345(RQ|Y\253M\246"
+	.ascii	"\257<\036Y\177\003&\373\033dm*T\2566\210\332\277*EJ*E\205\370"
+	.ascii	"(j\003\264\rd\354\253PN5J\224tN\205\370\310\206\b^\3664P\263"
+	.ascii	"\177\246s\352A\234\352\223'WS!>\202\002A\315J\f\342\032\3341"
+	.ascii	"Q\2330\321\322\352be\007\314\f\311^\326\327\200n_\0035&\363\344"
+	.ascii	"\363Put\264\001\024+\373\212\215J)\353k\020\266\223$I\375v\254"
+	.ascii	"!\215\026\0317?\030C\224\314\262\276\006K\214"
+	.string	"\250G\214\250YjVZ\267\215\240\246<\234{E\006\313\262\276\0063\3663\200\023\242\022\0212d\b\207(H\331G\240\240X\326\317@m?\003,\373W\203\374\034S\203\244r&\3168&\303\342\312\373\213a\025%\353g\260\244\252J\265\002\252:::\241-\312\353\311+\013\325\240\n\004\313\021)b\262~\006V\373\0314\355_\245R\251N\2764)\256*rsVC\311V\2301l9\262>\006h\373W{\3648\333\200\252\214\364.\360\322\302[K\313\254\344X\222\3651\310\242\343\017a\004\025J\335qz\351x*6\332\273\340\217\356k\037\003.5G\216\323\013(6J\003\002\032\032\006@l\330Pq\234_\261\321\215\2313\256\263\341\017@\301\272\254\325\033]b|I\262>\006Q\373\027\b:\251PNi\235\032\307g\263\312\351)\236z\362\240>\251Oi\3356\002\352\233\232\362\240\203\226DHT\326\277"
+	.ascii	"o\377\202.LL\350 \320W\034\265\243\344\210\353L\214\355(\317"
+	.ascii	"\213\3069\246\322H\233*T\035Em\260\307d\210\224N\217\030L\200"
+	.ascii	"Y\377\002$\373We\214\2512\362[\376\212\243\2061\220\004\325\370"
+	.ascii	"-\341\nC"
+	.string	"\312\372\027\f\331\277\nCERc\244M\004\310\210c\253(C-\244&\210_\340\264oA\337\376\325$5)\206\rA5\272\r\2321E\272\250G\352\321\022-\013\272\366\257\306?\307\3248u\203@\325`\027\316\327\335\237X\326\267 k\377\251\340X*\230\262\001U\305Q%@i\352\311\211ij\0133\305\206M\032x\2368\216\221\342\230\312\307P\212\225\024\360i\240\316\024\265\274\277\254\337\227J\371/$\252\031\361\313\372\026\304X\263&\365;\3438\216\247b\2434 \274\355\221q\363{\352wz\t\227h]\325\370\353\353S\241\220\324!H\314(Y\277\202\265\275\275sp\217\214\333\026\326^\r\271\254_\0013M\232\323\013(6\352S\241l\b\215H\3411\263~\0056\366S3g\212\346\034K\321\234|i\034W\355P\241\256\322)\034D\242d}\n\004\367\317\223O\375\3232?\307\3222\251\232\207\2528*"
+	.ascii	"K\252\360\004\375\342x\nDz\205\245$H\326\247\340\314\376\323"
+	.ascii	"\273\261\364\3564\313_\261\321\b{g\370\266\342x\nD\316\2233\035"
+	.ascii	"VY\237\002\264\375\247vvg\333\371\025;\re \341\255\371\3051\033"
+	.ascii	"\210\0355O|de}\n\206\354\237^g:\346\017a\204s,\035sz\235\315"
+	.ascii	"\330\351g\220\216\214\233_\374\304\006\342f\315\216\270\270\254"
+	.ascii	"O\001\215\375\024L\032\346)\335XJ\227\326\3558\216\215\232\261"
+	.ascii	"\223\212\303\n\031\267\255x\352\311\303\377\276s,\255\373\031"
+	.ascii	"\234\270C\032\246I\022\261\254\337am\377g|\364\024\307qT\332"
+	.ascii	"\214\237\220p\324\377\374\231\236\247\207?\347D\317\f\376\353"
+	.ascii	"8\376\013\0074\343\030[\232\304q|"
+	.ascii	"\362m\255\262#\036\027\304\351\\\034'Y\031!\300\n*\311*\307\022"
+	.ascii	"\230\025T\317\022\230Ul\224\224\304\250\347)\2662Z\002\213\343"
+	.ascii	"\236\244$#"
+	.string	"\024\252\240\226\300\216\342\236%\260\030*V\n\003u\306M+\2438\251*\356\211\223\342\243\030\254\n\352\202\245$+\250%\260#\250\236%0+\250\030\314*\346\211\223\216\236d$\305O=1\230U\232\030\254\n\212g\t\254\nj\t\314\312\3574C\203.0\007\226&J\232N\250\245\244\270\211\251\307\321\023\317\334R\263*\266\213\3433\013\214\370)\236\213\343\f\342\270G\325\223\335Q\216\323\fi\256\ti\313Q\325\331\214\343\230\003\023\322UU\2344gt\306sKM\252\342\270\t\322P\314\024\307q,\202Qs..r\316\031\005\351\021\327\200\021\307\022\304\3158f\212c\2433\236\213\343\330(\216\343\365\251G3\216w\360,1\231\230\342x\n\210)\356a\324\005F\034\347,wfPK`WU\"\272\\\001c\3061\232F\347R\215\252\230\031\333Y=m0\243*q\2158\216\317\275\315\204\262\241\227~Y\257"
+	.string	"\273`\311\372\035z\3544nE\302e-/\353w\240\261\337r\374\200P\245e\375\t\374v\332\226o\214\252`\261e\375\t\356v\352E\215\322\344\212+\353O"
+	.string	"\267\2337fTZnd\235\246\355H\341a\355e\375\t\272tI\317Z\350\031q\273\322\205,-\303aj\303\"&\353O\320\204l,\335\222\271H\211\331\312\372\023\364\030\313\222j\3119h0\211\312\372\0238eij\230\202\322\2245X\032\266\351\376\260\336\330\200UI\277\206f|a\370\360\252x\355\b\307\354\371\310\022&\245\"\254\332a\345(\353K\340\266\323)\036R\256\346\016\316\221\024\031\230\254/A\227\375\247Q\266\262\231+M\320\262\376\323-(C\276&YNY?\031JI\022\366\226\365%\240\262?\"\210\031 \371\214\016\032\307GxL\036\251\2214+M\222j\245DRfz$]\222*I\233\244H\322\"\251\223s,e\222b=\025\222\016y\226\373aFD\312$\365\201&/e\222V\3453\347\334\224\346*\223\307$\325\221\3568\347\210\350)l\362\254\250\246"
+	.ascii	"S&\371K\026s\316M\351&\201yW)\223\264\307\252\004\211I^N\232"
+	.ascii	"\036uG:\350\374t\376\250\031\234>\352%H\332\347\020\270\317a"
+	.ascii	"o\237\203\335>\207\271}\016m\373\034\320\3669h\331\347\300\265"
+	.ascii	"\317A\310>\007\247\275\203o\207\017\t\233#Y\237C\322>P\340\376"
+	.ascii	"\323\034\251\324M\230\224,1)\216\364F\032\225\332H\241\316\261"
+	.ascii	"T*}\272V:\305\374\244\201\306\304\353\311\257\306\016f\323\024"
+	.ascii	"\223iD*\225:u\321\363z\362\373\260\212=!\003\004G\037(\206}\240"
+	.ascii	"\271} \264}\240*\373@G\366\201r\354?\235\221.\2111\367\310\262"
+	.ascii	"\326mR$\235#\2368NR&OF\032\343\034K\227\236.\245J)\214s\216\210"
+	.ascii	"\346\222\313\213\343\370\003\207\017Z\314\357\312MMa\374,;\327"
+	.ascii	"\250\264*gY\037\310\306\376I6x\307L\217\322\244\324\350\034K"
+	.ascii	"\221\256\005\3172\2354\216\253\360\230)R\032\237eC$Q\203|@\037"
+	.ascii	">\274]X\200[\177C\337\376\0064\373\033"
+	.string	"\360\3667\324\355_\007\002\2521~\200}\321\200/\313Uq\274%\216\343\r[F_\0336Y\377\232\315\237\036\033R\366%k\375\367k3\372\214\366\313|N\214\232Y\257\331J\354d\260e\375\rk;\215\356\323{\232O\353\235cZ\215F\203\246d\006\231\254%#1d0\325\240G^FCiP\215\316{\031Z\345)\002\030dj\344\305q\f\204\223\246G\235\034\216\376\206\263\375\r`\033\235;\177\324\023t\031;\244*.\300\254?B\f^\036\231\235\2463\223WW\206IF\337\351\0304\3369\246\355\364\0302\332N\207\301@\230!R[\351\030\217\270i\250\277ak\177\203\220\375\r4\366#\270\333\217\340\312\3765\030\035\307\006\306\225\2166?3l:N{\221\323_\364\234\206;\307t\234~\213\323n'\237\316Q3~Z\271\350\355\365\360\213\343fN\303\222\013\034\352G\200c?\002\246\375\b`\354\377"
+	.string	"\356\377\250YK\023\366\215\231\272\313Z\247\351.\275\005\255\362\304"
+	.ascii	"\272-\032M\233\3513\335E\253\235c:Ms\271&\323e:Ms\261\345\365"
+	.ascii	"M!cR\341\242\323\264\224\262\274\017(Hii\341\350\263\352\374"
+	.ascii	"Q5\234>\352\177\352"
+	.string	"\306t\22111\265\254\377\263\266\377\353,\032\213\326r\216i1\035\246G\200uM\271\242\255\350$\361\304IWY\230q\034\213\320b\332K[9\347\262\304GP\"@\321;\023\345\027\3071\320\207\017\037p\320\246\350\371\330\372?R\366\177\220\354\377\024\331\272\251\253\234cW\323_\302\244f\fV\304\213Q\221\254\377\003d\273\210\3438>\257\246\256WS\377\343c\377G\307\376\017\323\376O\274\257\001p_\003\337\376u\224\255\324\212\033\327Q\326\372\211\206r\216\351\255\037%r\222\271\376\252\212\301\342\270\231\203\036I\305\225e\375\323\203\2723888xzP\177\355$\211\031<#\243\254?\302H\021&\031\"YL\272!aGD\350$:\210\222<8,\245$B\220,\321L\255D3\321Z\032\211nr\216\351$:\353\372\310\331\247\223\350\"F\362\342\270\271\202\235\241\321\205G\353\234>\3525\320\355kH\333\327"
+	.ascii	"\266\257\201k_\203\220}\r;\36650\355\373\264\271\262B\307\312"
+	.ascii	"\250Le\375_Wi \347\230\266\322?\316f\374\021Tb\250\214\240\255"
+	.ascii	"\264\017\t\204\361z\302\221BEm\206\252\357\323e\337G\312\276"
+	.ascii	"O\221\036\032\307M\026\335\232\232\254?\242\211\215nI\216\314"
+	.ascii	"\f812\342\314\320pc\352(mC\337\320Oz\207\236\322:t\016-\245\241"
+	.ascii	"4\217sL\343\320NgVB\352;\272cj\034\232\251M\204\306\241\223t"
+	.ascii	"\f\035\243fl\244\216\351q\235\371\305q\ft3\243/\207\024\220\276"
+	.ascii	"\317\321~\006\275\375\fs\373\031\324\3663\204\355gP\262\237\001"
+	.ascii	"\310~\206\031\373\3270\256c<\327\251KIVM\262\326J\"\256a\330"
+	.ascii	"Au\301\221u\312f\277go\277\307n\277\347l\377:\036D\233r\023\313"
+	.ascii	"\372G\007Q\263\273>;\262\254?\302F\215\274+\272;t\tm\322\301"
+	.ascii	"\244\013\022C\236\b\2567&\217*3@\3120\321%\246\035q\331\316m"
+	.ascii	"\251F\030\217|\227\361\330\230q1\264\335e4d\177\250\021\222<"
+	.ascii	"\364\306\016\301<\031Tp9d\344\375\tn\301\345qQ\372q\206\211\""
+	.ascii	"e1\357r_\026+\274\274\270L\346,\243\364\326\227\331La\202A\343"
+	.ascii	"$\314;5^KNXSS\246\226\362\2242\240\024\346_ \227[n\023%\317\f"
+	.ascii	"\035\202BA\233f\013@\372\222\207\336\350\021\230wCjF\036\f\""
+	.ascii	"L*\277<t)*\214)\377\241GG\362]\346\323\302\374C\225\212\344\273"
+	.ascii	"\274\246+/\337\241f\271L>\243c\304\023\307Xe\3148\216\377\320"
+	.ascii	"\030?\362]\336\023\313C\307P1t\f\332\207\352\241{(\032\232\006"
+	.ascii	"\305C\265\240V\320.\350\032j\207\322\241i(\026T\f:\207~A\345"
+	.ascii	"\3202\250\027Z\207\346\241^\320\030\320-\250\032\352\206\236"
+	.ascii	"\241g\320&\312\005\345C\325\240\201h\0304\f\005C\331PA\264\f"
+	.ascii	"}C\315\240`\320+(\032\364\017\205C\263\240m\350\035"
+	.string	"\352\207\256A\311\240mP@4\016%C\277P6h\225s\f5C\247\034\245\202v\335@q\320`\322m\305\241K(\215\036\371\017M2\222\227\343P\263\374%\213A\233\314\024\302\342\362\314\3749n\f\\\276\313i\266\234i>\376\362]\366S\242\202\336\3201\230'\346\311\211I\006JL\023\363\316,\353a\215E9\371t\216x\342$$8\246\031*\305-\017]B\315\320\031X>\362\362\037j\226\007\303\224\344\305q\023\b\205b\366\303\350\214\365\232w\376\250\001Y\277"
+	.string	"[B?\241\2370\360|z2"
+	.string	"\2223\2563\241\020pG\233*g\031P\310&\210\0211J\324\033\303\25553(\177\332I\250D\216\t^\326/@\326\376\205k\346t\254\234\330\224Q#|\022FE\345L\237\333\nyM1>69+mYyo\363\220q&\215\021\275\264\271\265\234\231\243\221f\017\031\203!\306\227\267\327\272d\260\325\241Y\022\243\351\212:\263\206\332 \242u\305\314VB\227\236\244\371*\263\277\f\261\314tq\302\013T\005\365\302\272\334\355\245\035\031Tg"
+	.ascii	"cP\0037\020!l\222\354\3245Qc\306(e-\034\223\205b\204d.\034\363"
+	.ascii	"\246p\214\005\201;\347\211\301\316\21616&j]*\327\214\002\226"
+	.ascii	"\225\265PN('\f\363\fYC9\247;3\277x\352\206\207_\b\346\3020j)"
+	.ascii	"\2142|a\262\026\316]\rP\213W]\326\302/\353\233\334\325\217\002"
+	.ascii	"\300\330:\352\223#1\272d8\270\034\206*\315\334\333Y\246\261\226"
+	.ascii	"\220Iq\253\373\340'\344+k\241\027!\333\205m\027\266ea\033:8\250"
+	.ascii	"R\251\303\242\256\245j;H\033\037tj`\303+P\360\262\244\251|~n"
+	.ascii	"bd4\247\340\2559:3\2033\345K\rU\227\275\227\217\3440\363\303"
+	.ascii	"L\265R\243\2001\271\",\333Tp8\232L\262vr\312\252\342\242\232"
+	.ascii	"51\203eeK*\005\356+pml\307i\027$\n\r\261\264Nk\321A\344J\313"
+	.ascii	"\311\227C\tp,\313\336\302\242&\r\227\232#Y\377\034\023^I\375"
+	.ascii	"\022\240W\003+,p\307\256\n\253\006\230\030\034\2614@'+\353\326"
+	.ascii	"\2210vV"
+	.string	"_Ut_]\234\ra\363\302*\177v:\301\210!\323#\2225\232D\304\205\315LE\310\222\021\257.\245'8\245)\027v\375B*'\334\240\022\276\032Y\017O\0375\313\211\270pJ\322\r\261$R\204\\d\256\300i\311Z\310\365k\245S\f\016Y\\\230\220\254\267\266\322\300UM[\024\244\251\254\177\002\240\220\211\220\211\360\211\217\033\271\032J\266\250\340\306\220\021j]\370D\350\204\212.\311\224\254\205Mv\274\364\3750\313\372'\240\331\357K\321\376\0137\ff\305\310\372'\310\t\231BfZ'\305\004\b\247\323\336\240De\375\023\304\204I\204I\324@+g\370z\364\254\250e\375\023\260\204G\204G\354\232\3204\331\3321\243\303r\225\365O\320!4\"4\262\367\376\216\206H\245[H6\326d\375\023\216\204D\204D~\314\232\262\334\374\370\270\fz\311\372\004\230\023\n\021\nia5D\n\256\n\2171Y\237"
+	.string	"Z\202\004qsz\"\350\005HG\225\365\t\300Dh%\264J\353\004\235\270\314\266P*I^\266d}\023\002\253\252\322:9\247'\202]2p|\311\372&p\ty\by\b\251\200\252\214\324\334\270\325P\262\265\212\345U\271\022\372\270\220J\r[\262#-ka\217\024-\212\231\030\262L\310\022\352\020\352\020\346\020d\226\3710A\207\020\207\020\2070\207\027\032\336\232^\263f\004\207P\352\302\034\331\210Z\331\\j\206gE#L\3267aIhCh\203\351d\305\364\313oMe]\32601\t\241\326\234\222\310\355(*q\324\323\205P\303&@'aB'5/:'aS\225(O\262d-lJ\261\206]YJ\226d\375\001|\ti\bi\244ulnl\241eP\322\276d\375\001 \021\312\020\312X\177P@\317\353\311\310J\2153Y\177"
+	.string	"8\2041\2041\322\272\250&2[\372\n\340\332\223\254?\200\030B%\241\022\031\"\314*=\232\244\371\023\032\t\215\204H\347W\354T\0245D\252\006\222\2307\341\321\205H90\266\200-\341\362_\270S\205\310UV\326/\201npp\357}@o\210\224\220+p\352-\353\227p\326\246MZw\3624\221\350\2660w|\3308\013\313\372%t\001\002\246u@UFjV)'+\246\016\337\327\222%Y\277\004!\177\177TNVL?\034&ih<\366\326\254\261\300\336\031>\224\352\013Z\223\254/"
+	.string	"\273\335\267\373R\021L\366zl\241oa\002\333\262\276"
+	.string	"\332\322\244\331{@UFj\206OL\200pY\313.\215\027\275\357=]\244\f\016\274\323kF\024\032\030\0324\251_\024\023 \234\037N\0274 TY_"
+	.string	"Ub\276\361\304l3>e\200b\244\244\230\252\307\272\244\211\r\323/^\352\341!e\273!\246\314\267\231\253\355\360\300\202J\3321|\337\375\302\225\214\230\267\257\254/\200xo2\337v\2770\345a\003\257I\326'\001p\377{\314/\304!\002'\247\227\365I\350\333'!\r\035\235\312\267N5\221\331\332\332\021\323r\345+\353\223 \007\006L\032\030f\220o+g\251\202\232\221\365I\310\302\306\266\277"
+	.string	"}\371\032\"\345\267\203F\307\026\231\334\367\0270[Y\332d\275\333v\334\177\3416\213\301\rL\334\206\263\303\321\224$\353\375\006\264\202\031*^\262>\tR\266\033:\345\377\335\220\260\355\221\200$-m\257\355\0302\231"
+	.string	"\341\374T\2643<\250\324\276\327N>\335\305\347EI\355\277P\343\350\"%.\353\223@uv\226\326\035\355\365\310yB\345\243\231\365Ip23K\353\016Te\264\207\352`\"\346#\353\223`DFV\327\204\246I\021-\r/\353\217\360e\313\226\264.\356\350L\224\252\306Jm-\353\217\200EL\f\312\331 \037\024\335\023\251\254?\002\221,Y\322\2725QC\244\242\276~\360e\375\021p\\\271\222\372\001U\031\365\255\202Lln\fo8\201\253\221\365GH\372\372\332`\353S\023\231\255\255\274cO\316\210\225o\260\241 \2144cb\377\205 \334e%\021\323lr1U#H\315\253\254/BZW\327\026\323\t\336\327\\\326\027\341k\312\224\264NM\023]T\276\242\367F$\353\213"
+	.string	"\305\3055\342\no\r=B\027{\311\372\"\304\333\311v\262\267\242\232\274\244p\274\330\204\241\262\241|o\355'#\316\264\264V5@UF}C)&67\262\244\312\350\262\376\210%H\220\354%@UFz\036\332\302x=\t\327\344j\024Y\262\231<\230[\244d\275\225\f\222\241\363\312\372#\252\366N2b)+\013\to\315/}\022\325%,\353\207\240f\027\331E4\264]\235\341\363s\302\304\226\365C\b\203\205\265\207"
+	.ascii	"i\331\300[\033N\301\221\331\t\371\036r\016\202\t\203\273\242"
+	.ascii	"e\245\264\227\365C \253\252\332WOz\b\033*wW\333\352OGU\233\r"
+	.ascii	"\304\210\205%-\353\207\020\266\037B\227\017\037\233\n\250\312"
+	.ascii	"H\257\004--\2745\264\006\216\264&TW\316\310}q#25\265y4\365\344"
+	.ascii	"\204:\250\370\300\333\361\315c\230&\346cf\275u\234u\314x\357"
+	.ascii	"\207\224T\352\007\264c*X;\362v\302\320q\361\253q\343\006\n\346"
+	.ascii	"`\327\026N\017\271X.\353\207\020GE\245u\347"
+	.ascii	"W\354\004\3445\247'\347\207\223\003F\025*\276\247\247u\207\207"
+	.ascii	"\300\235C+\212\214\254/\302LS\223\206\267(\257'\277\263\n\021"
+	.ascii	"4dk5j\244uG\223b\2526f\22580q\326\027\241e\306\214\264\016\250"
+	.ascii	"\n-\323\224\345\306\246&\246T\227\365E\004\211\021c/\001U\031"
+	.ascii	"\245\361@\252\311\b\223\235\035G\304 \355\245\264y\007eN\311"
+	.ascii	"\337\321\321V:\277b'\016lMB\330\370\305\361\224\007\025lI\314"
+	.ascii	"N\372V:\216V\236\222R\326\033)\265\362_\210\343\345\016\210\027"
+	.ascii	"\be;\336\361)\330t\325\265^\005\306!e}\020p\b\n\252gL\203i\372"
+	.ascii	"\357G\224\033ml\330\254\201\347W\354\004\001$\2745\224K\306\230"
+	.ascii	"\037\200_\003s\372\302\346\272\232\377\205\252\234S \233.~~\251"
+	.ascii	"\337\360\006\023 \334\306\362$\205+\353\207\350\261\371\370V"
+	.ascii	"5\347W\354\264\3721\261\271\261\025\307S\036t\350\204\314\240"
+	.ascii	"\321\367U\315\016\222\223#\\\272\376\013s\266\314\210\321\221"
+	.ascii	"\365\203\362\366\277\352\255z\032\324p\366\246p\001R\027\303"
+	.ascii	"9\266\306\260\346\r\237\032\240\244%\017\320"
+	.string	"\013\227(hp\216\b:\345hN-q\351\312z=\363\257w+\336j\006\347C\032\035lf\3262Rn\b9\322\234\022\307\361\216\260\013\240\023\034Y\237\315\363G\005:}\324\007\211\221!\203\345\206\323\264\213\222\365\203\216\354\177\255[\353V1\231'N\272\2223\213\237\246@\354*n\177[\262\206\002$\334BbcH\326\017\252\301\365\325\312\n\266\206\235c+\327\032F\004R|4\266\301\033\022z\025\027$-k0\315\274e/\r\230\254\377\301\340\3769\345\312\232\005/O\313\212\245\003\322\222\nS\356\266\254d\347\034\021\004<\371\"\266b\3211\352\211\343 \253\333:\267~Y\343\326\267U\356\034[\341\326\262\257`kX\022\331\n\267\216\331\301\255f+\33397\305\023'\221}\030\316\260\232\363\241\243\257\334L\007\244%\025\272\314\344\255^\326\266sle;P3\216\263\254lk\227u\255\003\322R|d5"
+	.string	"8&4O8|\310\321\253\263\343\241\352\177]S\323\331\322\034\262\227\365\232\266N\345xS\312\372\037|\331\377zv\216\255h}[]"
+	.string	"\263~\337\315\374\027\336x1r\005\267\377\301\332\376\007Z\366\312e\213\311\363!\227\365?\260\262\377\201\327\376\007\\\373\0370\331\377"
+	.string	"\311\376\327,+\02607>9,tq5\220\262\376\007Evn\236?\252\207\323G]\233\353\327\016\227\231\220\261\254\277V\371/t\200\221/cYk\257\374\246\204\311\224\365\327.\035\273$Z\252d\375\225\312\330 \237\216\254\327)\033\306\007<:\030\372 \373\301C\312\327)\377\032$+\3010\330fM\326\031L\304W)7rky^Y?"
+	.string	"\177\373g\224s\275\372\312\\\257\326-\017SG7<\274\365"
+	.string	"\241g\334\035\005\311\032J\023\f\215\371\343)\353\007@n\377_\235\254M\316\261\365\311\312\004l}\262j\211\215X\237\254K\006\020\3054\206\3517\310d\n\026U?"
+	.ascii	"I\366\003`c\037\304\337^\217\254IV%\277P\210V\203\256G\326\007"
+	.ascii	"\221f\177E\362_8$\022\006\211\223\254\363y5u5\3625\353\027\256"
+	.ascii	"S\236\222\264d}\020e\366W\"k\221_\210\266\201C\223\221\365A\324"
+	.ascii	"\355\257C\376\013C\200\007$J\326\253\220\r\003\204Z\007\302\273"
+	.ascii	"/3YY\377+\326W!\271\006\217)4Y\257AD|\305\312J\262\274\275e\235"
+	.ascii	"s\372\250\007qd\257@V \251\237p\370\005\007\210\035\b)*\252\365"
+	.ascii	"G\216\253\342\230\271\262\251\371\345\341\\\251\032c\366#'LT"
+	.ascii	"\fq\326\007\241\324\243\307\312\024\247\245\327\220d\300\255"
+	.ascii	"\321\241c\335\221\253\354\324\344\362r\334x\260\321\332\221J"
+	.ascii	"\321e\326\006\003\263\376\007\272\0349R\277\341\333\252\305\215"
+	.ascii	"\355,\353\177\310\262\277F\235\353\2155j\305\2216\3178*>e4Q\333"
+	.ascii	"\221\367\001\312\376\207 \373g\332T\241\240\326\f\321n\324\310"
+	.ascii	"\356\342\262\376\207\033\253\323\352\224\006\016\177\\)9[s\225"
+	.ascii	"\365=\360[k\2545V\246.hd\334\374r\302\272\204\301}e\362B\325"
+	.ascii	"\254Q\005f}\017\304\2542V\031"
+	.string	"\353\214\363\034\351P\275\350\310\270\371\235\3147\034]\326\031m71@mQ\311\372\036h\201\021C\313\203$\373\036@\355\177MZ\223\322-t\251\352\350J\204%6\230\344\255k\220\316\340\310\372\036\326\254Fm\326\243\323\013\001HqLEDU\263\021\303\276\207\266\375\253\203\203\247\027\032\307T=\324.Z\036\256\374\251m\376\324@6l\324\3003~B\333\213\n\263\343\313Z\r\024\n\302A\331\341a\312\276\207,5j\3245\027\304q\f#v1\247\265%\357\353\251HS\326\352\2322\273\254\217\314,\353{\210\322\323S\371\240h\r\301<Ik\332;\307T\276T\312Y3\307\336\2313j\236\260O]r\005%M\334\222\254\177\025\3159\246\346\345\250\351x\302#\353\367\235m\377\205\351\225\2322te\312\310\325\020\344Z\347\272\316\364\310\372\035\204\335\335\rs\354u\220d\377\252\335\3171\325.\205\003\252\212m\004"
+	.ascii	"-\214\327\223\316C\343\212\263~\007Rc\306\234e\036\342#\243\r"
+	.ascii	"\320\256\246@\254q\\\262\312\262~"
+	.string	"\007Ma\302\250u\371+6\332);\032\344\333a\004e\250\311Z\245\3430,\033\233\202\312\372\034\370\355s\200fnN\003\252Pu\264\244\004)\353\336Q\032\036Y\237\0031\252\234*\227\326\251Qu\240\001\306\370\363\221\003\037\nj\211\\XIT\024n\341\r\216\016\316\207\202\226C0K\024\002\231$\"J\026\221.\373\n\223\357\013\241!Ll\211\\\370\246%rS\260\360\261E\341\205%\233\002n\205x\336VI\324\2460\262\355\211\344\373B\310'\005$\t\027'6P&\223,\334\034Y\027v\221+\240(\276\021,\3417i\242\205\331b\362x$\021\301\207\202`\237\017\005\021\225K\242\020\312%\321\022~Q\264K\266=\266'P(\227D\033\274\260dS\264\257\216\261'\205\226\247\345\371P\020K\\\302\310\226\b^\026m\300HB\303\2625&[\320\260\334\320\026\221\355\321E\221ct\2259?Do\013\257"
+	.ascii	"\267(\214\256\222\307g\303\207\202BP \204t\337$\354\"\223-,W"
+	.ascii	"hW\260\313\243\313\256\320\260\002\n\024'\206\311\367\205\220"
+	.ascii	"\006!\244\213D\026\235x\335\024\226\256\006\037\nZ\n!\335\027"
+	.ascii	"^\206h\215E\307\"\322\r\361.\213Blh\221|\207\340$r]\301\266G"
+	.ascii	"\r/\221\311b\272\\\261\002]*\3336\001\022\310@\"\371\276X@\021"
+	.ascii	"\221\373\003+Qha\366\304R\005\211\344\373BHgh\351\"\335\024t"
+	.ascii	"\212+\"X*\211-Qr\210\210\302\304\0026\300-\212\007\264\355\273"
+	.ascii	"\302\310\266* \223.\362ma\266\b\002EDn\005\260\213\\!E\362-\222"
+	.ascii	"0\272\312\f<\037\n\n\221tU\250<=\037\nz\2230[t\215Hw\031\"\351"
+	.ascii	"\016-\331c\n\306\226\005!\244\213|\331\026;\306\245\313\363\241"
+	.ascii	"\240\020\313\025\332\267\bf\333\025<0\262]\266\257\t#r\351^\320"
+	.ascii	"\022y6\364\034Y\244\220\213B\b\351\262p\333b{b\271\202\213\327"
+	.ascii	"\007Y\344\003\023\227-,\335\343\321%R\205~\332\243\n6\205\013"
+	.ascii	"\227h\277\255\013\267\205\245\233a\231d\361\266(Z\330}[\334,"
+	.ascii	"\223o"
+	.string	"\321%R\337d\n\313\027\212\356\322\205\245\033\301\322uA\242\005K\001\270]\266\357\207\202Z\"\027>\026_\224\200[\241\235\017\005\235\310\371P\320\333\302-Q\362eUX\300&"
+	.ascii	"\231t\331\fV(\026Y\240\365CA\311\367\205P\210e\013\267G%Q\262"
+	.ascii	"\0042\231|_,`\351r\370P\320\262\370\206(\256P@\004VHQ\202\004"
+	.ascii	"Q\001(<\240\005b\211\023D\024+\364\264h\035\300\302,\n\0238\261"
+	.ascii	"to\226\306d\013\306e\222\303\013e\262\004\005\026\300\037\n\022"
+	.ascii	"R\206\020R\026\221E)\334 W\344tI\024R\342\300D\244\2202E\n)\321"
+	.ascii	"\026\006w\251\227\313\3665\032\331\365\2052Y\324/\254D\237"
+	.string	"\363\342\205\227\256P{\002\003\370CEG\226\305\222(A\221\203\261E\n\271Gv5\266\313\"\275\\\317\302\254\221(\244\f\322A&]\270\330\276o\262\304QI\324\246\020Rzh\227\356\017O\212\245\233\303\002\334\n\371\244\260t%\340\021\021\364\2660\262(Y\302\350*3 ]\266\205\345\233\\\"[\024\307c\322\304\004$\226n\206\245\n\022\023H\020B\220\261=\252`\221\nx\361\302-Q{lS\300o\322\204\261}\331\241e\207\022\034rF\004!\037\360\266\312\266M\300\216q\271BkL\022\275.\233A\350\342\004O\361\310\026\201*X\276Pta\024\355\313\356|(\310=\026C\270\307\2421\331\202{,\256\313VE\021\212\b6\020\2550q\371\266\307\"\005\374\264\306\"\330\205av\277B\3431\251\202\020\333B\016\013\263(\030]\345\372\342\350\276\354\233T\022\265)00\276Pl\207J\300<o{\324"
+	.ascii	"\377\244@\001^"
+	.string	"\262G\036\237\245\013\033\226.\030[\230=\026\021\025\025\213$&X\272\200B\nXE&\227l{\302H\002^\262G \230\304\316@\364\222H\246\020B\272/^\370\206\304\213\027\316\331a\241]\272\200d\213>\034$M\274Pt\217F$;\364\201\232\363\003\373|(\b\003#\233d\241\025b\337\226\005\013\004\263\360r\230\212\020\344\342\204\221\035Z\207\226\354[\342m\341\025$\336\226\305\003\224\356q\005\020\354\223\001\204 \370e\225A\313\"\230\205Qp0\001#\333\367-*\366\264D.\254L&Y0\272&\340V\350e\341\236t\003\bA-\221\233bY\224tY\264\257\222\303\207\202\204\212T\264\306\020\306\243[\244\202CkL\266 t\341M\302\311\0262d0\"Y\"\242d\211\342\211\027\226l\n\025EK\036!\344\322\315!J\276&\024\240\200$\334\262`Qd\320\"\223(\300\310\226\250}\213\226l\333\002"
+	.string	":\220\020B\0265\240\330q\361\2620\213B\361U\211-\221\013#\213\336\020\305\0257\306\226\350%Q,\222\230\340\305\240\366\375yU\270G\266\004r\205\026f\215\312\242\n^t\337\026\331\n\355\213@\302\007$\224\340b}\t&\200`\002\b\352K0A\204\b\023H\020\261O\202\bT\003\f\303pK4\256\360\302\222M\261\24284&[\350i\211-\314\302(\334\243\253\202\205Q\030]\345\206\226\250l[\0258-q)\304\036Sh\217*\330\245\213\202\206\226\330\252H\276&\226BH\227\310\205u`b\b#Z\242q\005\027I\025+L\\\272\320\022\271\360\206?\024tL\276\360\006-\314\236\360)\301\350\266\360\016\301k\tI\245\013\005\274C\360\036.[\230=Q|\327\244\322\205\002\212\257\272la\366MQX\301\304;\224\002\371\302(|\201m_\025DV\tG"
+	.ascii	"\263-\260Jx]\026\337\f\273\005\373\002\247\247\025\202\227\354"
+	.ascii	"\n\242\361\230\034\"\302GVC\013\366\205\206\026\354\213~(\250"
+	.ascii	"\210\310=\036\223\257\036*\302\2562m\301\276@\227m\321\221e\241"
+	.ascii	"\302DE(\320\245\353\202\204\321U\346\030]\345\rQ\022\331\032"
+	.ascii	"\211\313e[L\276J\242\321U\366 \223.\214lY\264\257R\202\013Z\230"
+	.ascii	"m\215\304\025+\222\355\013,L|\301\266`\221E\257\006\037\n\262"
+	.ascii	" \251\342\205\"{T\301\223ta\366%"
+	.string	"*\327\266\350\262h\215j\261\310\022\215o\262\330\276\303\326\230$\322K\"\013\263( \223.\\tL\242X*\205z\340\017\005-\225B!\222.Q\t\370\310\246Kb1\311\302R)\224\003\263G\024&\2060\002F\272+2yD\207\216G\324\330\266J\0247\355\362-J\2260\"\213\222\257\020\2162i\034\3220\213\202\250\b\251\2420\202\247E\362\2503$\344\016\355\030G\034\331\027.j\221B\242q\204\021\311\2520\262\255\321\247E\362x3$\344\016\021\215#p\214#\214\355r\347CA\313\342\333\201\325!zY\"\274|\335\025Dd\222xd\213\304\344\373B\350\207\350e\227\256\261\347CA!\212\033\210Zx\371b\251\343\2425\"W\330a\341\302E\266\2475&\211\206\313\242\013/]\230\205\227\304\027\226,\2743T\204\335\026(\226I\023$\2640\373\376\274PL\036\213E\312bNK\344\246h\213\354\273"
+	.ascii	"!\244K\364\222@>\340m[$\225\021\274\255\273\302\205\221\255q"
+	.ascii	"\005\343\313&U\354\3000\324B\273\034R\215\355[T\034\2660{\242"
+	.ascii	"\205\301%ra\345\003\336\366Xdl\207\212\313\237%\321\204\321U"
+	.ascii	"\342\3000\324\202}\241\003\303\020\221\007\206\241\241\"\234"
+	.ascii	"D\302\037\n2\272J\240\024\316%q\205\321U\252&\316\025N\024N\243"
+	.ascii	"\253Da\244\2334\241,2\"]\tl\270i\301R\240\b\205\321U\352 \335"
+	.ascii	"\026`\022FW\311\323\262h\217;p\261]\261\302\2475&\211\210\360"
+	.ascii	"\333*]\264D\370\350\302Dd\022\006\367M\016\001\265\306d\013/"
+	.ascii	"`\227\005\373.\300\205\221\354N\004H\227]\300\233\204\331\267"
+	.ascii	"\325p\242"
+	.string	"\005\373\242\347\330\026\213$Z\230}u\214B<nR\t\267K\240\226\310\205\207/\330ck\274\321\320\302\354K\364Y\"[%Q\262\204\3215\001\263*X\370 \223.\234\302\330\266+~Z\260/\210;C\030\206\210!\364\274x[\026\311b\373\022ut\226\311\244\212\0378\251\323*_\300<\356\215\020\222\005\332\200tY\241\236%\021\321\310\266C\354\013\311\344\221\370\266H\227}ab\362-\262\034\220.+\304\323\263\241H\\\252`3\204\360\266\360\321]\221\001\206!\"\322\205a\210\350ma#\362\205QCkL\266\320c\"E\007\330%rY\330\200t\331\005\234x[!!\367M\321\"y<\2228&_\030\231,1TD\026\261\307\n\210\355\262(\203\013\366\330\276\304\026\354\013\242\261\205\331W\250\205\221\256\006\030\334\227m\221.\013\360\262\350\035\202}R\244\313\n\r\333\"\222ead\211H\227\210h\314\311"
+	.ascii	"#\213\222E\342\361\330\026\211\033`\227\310=\022\333#\f'\337"
+	.ascii	"!\230\b#[w\211d_\030\350e\207\212\272%b\035\320\036\335\025\311"
+	.ascii	"Wy\363\241\240\345\0049\360\207\202\340\"%\\\224$\022\265P\206"
+	.ascii	"X\276-\013\3675^\260TY\264(,\217E&\336\026F\266%xZ\230=A\324"
+	.ascii	"\302\004\016\213\326\210r\240}W\020\227KV\331\"y$fH\262x\333"
+	.ascii	"%\321\330\022\275,\262\210\350\276p\017\374\2620\n!\244k|\331"
+	.ascii	"\026o2\005\n>\024\024\002\036\022r\217+$\310i]\270DBc\273|[\026"
+	.ascii	"\355K\\\266`_\370\300\310\266\370\266J\342\233\204\223DD\245"
+	.ascii	"{\\1\264d\337\342\206\017\005\271xC\b)}\236"
+	.ascii	"T\266o\b8\231|C\334,\211B\356\nd\262\204\213w\250d\211\212o\372"
+	.ascii	"\266F\227E\362U\032[\027\357\221u\337v\331\343\242=*\213PXqd"
+	.ascii	"\207\206\255\321}\337\226E\222\210t/\200\211\253\020\233\"\351"
+	.ascii	"\022\205\212\216J\240\036\270]\266\257\021\351\252 \302\354\222"
+	.ascii	"HT\364\302/\264\312\345\0048\355\221-\016\341\267e\201t\213\257"
+	.ascii	"\321%J\221.\321~\241\330\016\025]\260D{gY\342\310\262@&]\230"
+	.ascii	"=&\225o\013#W(\276\033\226m\373\n\265(\264G!$\t\"\266\004\013"
+	.ascii	"\345\212\f\306crh\331\276C)Z\230e\341\302E\022\2551\331\302\353"
+	.ascii	"\262@H\267h\027\333e\021\321\005KDt\361\336\034[$\222\035*\022"
+	.ascii	"]\024\261D\027,\321\316\362M\276o\373\243\302\355r\305\212\344"
+	.ascii	"M\253|\001\367pX\261\"\t\027\025+X\272.X\242P\221\212\326\b\027"
+	.ascii	")\221\356\206V\371\002&\266,\\\230e\341\276\255\261\303\233\204"
+	.ascii	"\213\354\nb\022.b\211BHw\bN&\211\226\304\342\013\004\023K\200"
+	.ascii	"\221n\321jL\272o\253$\256P\036\211-\021\373\256 \026\337%\321"
+	.ascii	"]._\0160\221\004\0210"
+	.string	"\322]/BD\211\013\\p\300\002v1\250}\223\305\020\305\025!\220.K\024\242\370.C\004i8&\223\t \246\377\207^T8S[\202\274u\tsH\371\230\303AE\b5\226vFm8e\3751l\223D\316o(E\315\213\033\223'\306%Dj{\222G\026e\270u'\344LG\032\005\207R\033\224'S\203a\266p\260\222\340\366\206N\206M\250\350\376b\310\372&\f\220$#J\224\f\231\354}0\305Iok\270\344C&;wC\324\334\262\0362\3210\202H\326\030\340hXdXd\210\244\207\bK\252\360\004\221\034\331S\216\360\340q$\013\n\0240tF\3224\240/-*#9\n\247\312\216\317\356\357\352j8\304\207\207!BV6kv]\204`\355\030\321\321&J\020UM\355b\323\246)\210\036\223\256\261\021\026\006\315\320\307\320\307\020\b\025\bP\232zr@\252\3245S\300\216T\375\270"
+	.string	"\027\f3T\251\027+n1\2502\227\206\302D\343J\326/"
+	.string	"\335n\232\0016i\341\241V\211\265\352\232pMQk\032\352\030N!\3618\262c%\210\245%\353a\3240j(\245\227\001\232\263\275\036~R8\316|\304Ip\3340AF\311\317\206Z6T\032\004\354aC\277\251QR\312`e\375\002\244\355\177\b\245\342\030\306Fd^\206O\373\n}+s\002e\3504l\002\3042\243\266\263\3341\331\0322\rkH\201A\323\246\231F0\313\331\220\306pF\2221H\256\262\276\201!\004\320/\353a\322\223\206K\033$\3051\214\330\205 \226\226\274\341\3220F\006\262'\310e\030c\bC\250g5\007\250\002\311Q\022s\2025T\322?V&{lzY\277"
+	.string	"X\266\240\340\360\210H"
+	.string	"\274Xy=\r\217\206F\331\006X\233\220\241\3210V\361\306\270\f\031L\343\204T\226\304Q\006uVz\346\214\307\222\212>\2504D\322\025&T\242$\3072%H9\305\03035\245\t"
+	.string	"\303\025"
+	.string	"0P8\032\022K\266al\024\200\fZ\312\246x@\037\353aR2\245\020\214"
+	.string	""
+	.string	"\b"
+	.string	"\020"
+	.string	"\320"
+	.string	"\377\n\215\237\270b!\016\300\245}Vr\372~D\254\355\357}\324\342S\261\003\2038\354u\024\fQ\\'<\340H\241\237\220\241\211\262!x\230\205<2P\324m\234,\334\313\312\340\036&\334\002\325\222\243\222\215\310\244C\235BA\217\200\357E\241Q%\220vJ\234A\254\322T4\017k\334k\002\363\367%*"
+	.string	"Z^p,\254\n\341\013\231\\\3118\217\021\323Z\235!\375Z\024\207\307-\200R\302\307k\025^\033\"\204\374\021RsX\326~\323\257`\361\315\240$\372Ues\370/"
+	.string	"LL\021Eno\220\353\221.\210\247\247\246-8L\230!.%`gB\331\024U\276\350\206\210t,AuZ)3\2340zn+}\305\303\333'O\206\241\004:`{R\"T\001C\346\"q\027\340a.10\212\035\"k\210\250\276\022\203\365\310\340us\325rS\323ZO\202\274K\b\224\336 ZAY\235\260Q"
+	.string	"\022\376nSR\252C\226\277\316"
+	.string	"6\255\001\223\002e"
+	.string	"\326"
+	.string	",\177\235 \227@`\033\206a\241\273%\366N\325O\272O\230\260\272'\177\b_w\360~\0218\212\351a)V\006\266\275\337\234\\\373\307\312\243\204\276\354,\315\0256\246\321\214ERA\204\017\bu\223\365X\251\364j\263\202\240\020d\023G"
+	.string	"\275\252\241\347\222\265n\0237\237]\020\252\037\201_,\314\260\016\223\214\253\231\"JfQ\005\331B\266\036j\325\361\3654x\201\270\202\330!d\340BTl\371H\2566\024\030`\223\007\200\225\202\234\024hH\311\354!\345\317\0379n=d\006\345g\005\210\247\276\232\256\016C8Z\203\361\311*H\007\310v\251+\242x\360\322\340\335"
+	.string	"\256\3162\220G\371\224\257\327M\311R\257\260\343vV\216\277\333\037\260\fc\207\357I/\222'\245i\272\"\345N\222(\351\266\177\214\240\323\020\213\023\035\273C\017\314<6\b\030\016/\205&X\\J\347\231B+q\2607\247\243\036\325EI5\304S\363\263U8\024\210\2324\bKO\230A\332I\213\375\350\025/\tK;j\336\371\240B\364|E\247\r\273v5\250c\005\247\315\317I\306\001KAj\222\346\216w\2362\035\0358~\254\276\006\b\305(P\337\007r\374\226e\243O\266|\330\177\363"
+	.string	"C\361\332\300F\235\210J\303\245\237\364\336>\031\350\036J(v\304v)\210o=/\231\307\271`d\265B\360/\341I$i\027s\036\0022\273)\341\223jTDq\005:\365\224\230P0\231\"\341\261\240\245\222s\022#)#!\032\233v\342C\256\212\375\313rWWLz\300_?\373Z\342\036+\360;}\347\r\020\b<\177\036\337\235\007\r{\003\201\030o\330\307\301\357\254R\303o\201$\3505\350\310\234t\217\005\327p&\307+(\210\255\003\351A\243\245%\200B\036\221B\004\030?U\025b\201y\240\261,\301\255\216"
+	.string	"K\353\017\026V\017tI\242fP]Xk\243\260\314@4\272S\025\311\227\335|Je8\254\017\242\017\242\314\271D\373\210\024+Q\261\300C\004\371Ql\2233\301\0039\300\214b\366A\316\257\\\277\372\346i\365\242c\322w\201\037\243\301]k[W\rR\006\370\225\177\273\"\273\021\022i0\211\274-\342\215\252\331\321Pg\364;\225#\324E\t\006\035\377\355\031mfFN\373<\030i\377\257C}\004\325\016\374/s\304\317+6\302u\267[8\375\262\214\315\307;\327\374P\331\020\007i@5_\035\271\306#\354\006H\307\313J\2713\303\371\244j\335E\226\356\bW\225f5L1M#\303\227s\330\350]\304\325\210e\364\006\031p\300"
+	.string	"\300\252:\002\rH\330\002\244(N)<\005\033\230;\016#\270\032\271&\001)rr"
+	.ascii	"\245=\336\254\247\372\336|\331(/\346#\217\2226r\332x_\251'\003"
+	.ascii	"\337\365\246\243<\032\246\227\214\255\271\203\021\305\254\343"
+	.ascii	"\242\217\215\314\371\241\213\367\257\324\237\352\210nu\205\211"
+	.ascii	"\0334T?_\252V\302\216\276\314+\315\374\353\357\346\234\022\226"
+	.ascii	"\347\306F\345n\244\244\331,\335\213\365\300\004G\216\365\237"
+	.ascii	"^\2067"
+	.string	"\265\247\256\256\002\271\365\235\245\232\261\267\332\373\340\363\353\r\345o)\227\234\235m\300r\034\261\310\233\310\273\003\264\325\017v\200\316\034\241\335<\344N$\030\311T\346\022H\270/\205g\344*\363/\3579\236\036L8AH\255\234\033,\345\323\277\275\346\350w\033\310a\333J@S\314\347<\256Mq\230\362R\300\205^i"
+	.string	"\244h\242\376\320e\235\025t@\264\201\331v\235s\021K\345R\2734\254P\314\272\232A\035h\246\361\301\\(\262uHt\032\246*\303\353g\301\356\006L\351l\"\253\205nX\035\206\324\322\376\375\316\217k0\315\260\223\200\006\027Ij-]\205c\315\2555\323n\030\304\245wA"
+	.string	"\201'\362B\034"
+	.string	"\236\246m9J\032ZA\224\022h]\314\200P\211\323\261\263\213\310\367X\2463\257\355pY\207\256%\320\3654\325p\016\213\305lK|\367yTW\033/%\020TW\t\264\313\323VRo\007\262\321F\207\316\346\354\366\301\227\234\314\351\017:t!\027\277\3520p\006\314\350\021ig\355\027c\302NW@\352\362u\3767\005\341\356P\350$\250\001?\226\2121w8\262\264\262J2\n`\215-\be\366CO\316|U\213\344~\312Tg\036\034p\350\212.\303\307\037\375\234k\333\022\034\224ez[\025\340H\003\323\211\363g\303\352\211f_\366\331\003:\033Kl\357\177\322<h\332\331\270\304"
+	.string	"t\355e:\361\006\270-\034(-\235Z\350\362>\344\212\244\377\261\r\206\271\"E\032v\021S\314,vC\255\361\013\3547l\231"
+	.string	"\363\260\022\220D"
+	.string	"\211\001\nTo\027\3252J\271\365\363\253\005\255\331\265\235}\226\275\243\306rj\200k\315e\322\277 ^j'i\225\205\272\200\206\235/\313w\272\002)\201\332\225\316Tq\210Q|!\357\031\302\033J\021P \300\355W\211W\240l%x\321p\260]u\221\r\323\211-4\327\375x\020$\213C\227,M?\243\276\304od9\217?\224$d$\027o\177m\351\241\004{\331C\r\351eB\366\036\261\373y\211e\265\037\007d|\331\0070\255I\224<4#fG\004\232\250\211Y\341\001m\b\233\016\300\332\225r\fZ\326\327\324\020\206\026\352\332f\r"
+	.string	"U\242\220\002*\255\316\272\326{\306o\221\205\333\364\257?\263\336\265\326DJ\277F\221\037j\320\256Y\337\305\030G\310j\023\365;\207\317;\204\tN9L\"D\255\030\001\222\356\006u\344j8f\255\372\310\241\265\235\301\022\230\346\303\005\"y\267\313\226F\b\216\r\035\t\221E\206\246\237\3527\202\360\317|\351\244\304\327\377\265w\027\211\241\2023h\333\3568xQpJk\333Bs<\3267\224\r\352\214\351\3474\252Sm^\034\324\231\302a\203\334\022\324\251w\216\027\3032\0365\305UQ7\307\257K\204\305IQE\310\204K\254F3\3044\200\365\351h\272G\226YO\205wB\030k\223i\002\353\001Z\256\300\357\3109$\307.I\360z\t\231F\350\271"
+	.string	"!X\b\253<\205\355\361e_F\013\314\033v\300\352\332\223\364{\"\232\333\334QM\250\006\016\324\366_\016\217\224\232\005\315\023)\217&r\346\274ZB\375\024\202\017\241\331+\214F>Nz\324\202\353\032V\325\345\310}(\237\352oi\371W_\360n\214W\202,\032t\233\271\331m\362\2013u\214\222M\356'\347?\321\356\022\336~8Xn\327\363\361\241s\013\204\311<\034\021vs\362\"B~\255+\013:\026\214\306\334\240\362\310"
+	.string	"\337\241\221n\201\320\361\326\375\340h)T\304\377\0021\274F\004/P\035L\203\307\020\244\321\241\255\252\020O\023\221\374\013\233\032+Q2\256{#\211sW{\251\270\204\210W\277\203{\362\257\216\n\250\2006@H\343~i6\351\004V9\317\201\375\232\240\037\312\242\256\311|\3227"
+	.string	"\332m\2071\345>\374\362_\307J\230\276\253utsp\313H\2647\246\260\337\352N\360D\353\002\264\207?\212\016Y\243\261\253\230G\330@ln\327}~\224\357\177\277\352X\367\017\3012\212f"
+	.string	"\035\n(\310X\363\005\f\332\237\356\366\264:7\rf@\234Gi\264k\332Rn\301\233Lb\b\006\221<\252\214 !\362j\\\331\245.B\205\250U\3370\005\004\2515~\"\021\375,\304)\240\315#\311\242\223\314f\364\312\0175\370P\242Hza\335\r\303+G*\rh\212\004\307\036\361\317\r\313\037@\032TQ\255\346DqQ\340\317_\353\3007_"
+	.ascii	"\204\250\365\3726\232\031\032]\332\2731\036+E\364\347\001&\031"
+	.ascii	"3\017\250\235\024c\007s\271\306\316\306\347\262\030\252>B\320"
+	.ascii	"v\026\353]\352\327\302\264mz\372\372$z\203\217y\243\037+\306"
+	.ascii	"\316l\312\271\271y\ngD\\f;\347Wk\314\177\223\310\322\024\362"
+	.ascii	"\265\3577\212\352\304:\274\317\276\033R9\332\006h\273\212\331"
+	.ascii	"\025\237n\343\245\270\333\227\021\334uF\003|\304\320GG\307\304"
+	.ascii	"\265q\300\205\223D#aiV\277\330n\301\301\226\004~\272X\333@\263"
+	.ascii	"\250\231\236uW\274\265\202P\344#\023,\2062\026:\016\253{\334"
+	.ascii	"\002\351u\213\022\033\023\200b\002\303"
+	.string	"\267k\313\210g\206Nb\331\n\351JqXsy\360\270\3118\210\016#\362je\374\226\320Z=&tOI\346\313\206\203\306q\325\362\357h\347j3\321\265o\237\234\331\323\235\037\260\003\3559dh\027\371\2575\374{\343\002\255\316\327\003[\306ck\235\032:a\237_\325\323\242\r\341%\336\266\020\263\006\343b;!Vk}\027\024\327\267\007\022\332\031>\023\252\272)\312\331\f\344Ip-\24075\265\202\367\373\013\251\212_Q\364f\257\030HC/\013?\370h\016\271_\255\261\352L\356l\025\\\321$R\277\2503`\333QgaL\216\323\f\200T^\351\306\032V\260h\004\277\252\261M\033h]\305\204\207Q\316\207\354\032\321\322Nr\301YfSp\256+\336\371\275\351\004BC\377\260ZZ\357\311\225i\244\304d\251\365\206\231i\034a\350C=\b\321\210\362\007\202\350\313(\214\275^\251\3665\002\n\240\254\027"
+	.string	"\300\310\264\323\266ye\224\003\007FCw\266S\262\314U\n\r\336\030\323Gt\006\207G\336\006\200\037\r\312i\245\214\027\033\201\353\bK*\220#\221E\213GR\002\271\2739\254_\210{ \240\201CF\277\202\007(\300v\027L\305\2545\316\362\n\232\270\272\232vo\345\fC\225Z;\223)?\210HF\367\352\247x!\316Q\255\332\"M\251\264\377\210\234j\ra\230,"
+	.string	"\370\336\206\305\267\253\301\317\336]\231r\231\302/\366\201\355\354P\003^N\"\362\357@[&o\316\223r\267\257\300\021\321\355b\033\bff?\224\227[(\325u\334\306@2\333,T6:W\223\rOs\334=\371\334O!Z\271#{\353\031B\236*\250\312\234ZV\213H\244\270\267*\252\307bER\257\254^p\320\362\352\271\302\214M1k\036\221?\304x0"
+	.string	"\236\fku\313t\370\376\252;\334z\375\0257\225\322\335/t\371A\353\306\254\227\325\345\032[\227\\\301;\222\030qW?\327G\223\363 \312\352!l\357\200^\334\270[\343\360\272\234\246%\215\216\306\2145\352\224\312\261\244$\272{%S\016\370R\203\211h\027H\372\037\252\261\300R\254\037\365&\024\265\230\242\201\365.\212N\315i\3207\254\265\207"
+	.ascii	".\270\006\260\033\363k\242\035"
+	.string	"\273[\351p\340\256\311\340\357n\373\244f\272\032%\265\314\020E\246\353\232\232*o\351\243.\002\213\007x(\320\353\\\213\233\372\235\230:\367\232\212qTy\272mM\301\001{v\274H\004\264A*\267\253,aAQuR\310~b\274\035\304u\341\204\332A\320Z\341T\361\360\327\202:~\342\215L\374\3136\236\305*\214I"
+	.ascii	"\372a\232\013\342d\017\210\340\211\344*\b\301\355\234G\177\310"
+	.ascii	"\251\317\366J\341\350\003\002i#\225\212\334=\220~1L\325{O\225"
+	.ascii	"\223OP\204\305\273jB/\006\346#\371l\037\030\267\356\2745\306"
+	.ascii	"\035\376b\365\216\340\036\364\220*\266aU\333\325\251/\216Hhn"
+	.ascii	"\n\215g\200\0205"
+	.string	"%r\230ZT\223,\261\367<\3146ME\326\376DMt\226^\201\r\246p\027\255R\371\\S\177\3545\377\247{\227l\271\302=#\241\006D~x=\223\302\3263 \306\356\345\304=\306\332\2124\205k\3264\227\214\224\276\231\217\201J#\241}2\263\024ro\016Dg\320\327a\037A2\003\273\236\344\023\003\215=v\244f\027\237Y\236\303>]\263\b\362K\032D\034\320_k\377\263\201_O8\350\235\017-Zj\270\031`f\230\250\254|\230\233ao\350D)1\023BF\201\231\250\216q\342\203.HO\357\200~0\306\352\035\0366\031\245=},\311\324\315| C\037~\336\374@O\366\321\351\234\325\273\022\017\261\216e\276?m=S\305\215\205\371,G\254\331\315\360\2542\305\3346\024W\255-\277\365\377\261q\330\346\373\027u\305\216Z4\323\036\325!\016\277\275\226\310\222\025\016\f\313@vC\335\372t"
+	.string	"'\013\n\201`\377^+\253D\343\376\033\022}\n\016`\331o\272\245XJ\030\035\260\017\341(\362\004"
+	.ascii	"\235\371\300\033\n\354\355\232\246s\003\342I\312\001\313\226"
+	.ascii	"\234\343L<7\tPw\331\303\030O\357\200\003\023>\240\260\2208T@"
+	.ascii	"\352F\241\021\025)\365\300\027\240eo\310\227\216\007HS.\0237"
+	.ascii	"\022\266\344\240\301\202\217\031\325\2328q\300\r\312\030/\263"
+	.ascii	"\254\345\373\277\272\323\261c\256+\025|p\272\366\300!\020\024"
+	.ascii	"=\254\2214$\322);\363\205M\321\326\b\255P\346\306C\342P\241D"
+	.ascii	"6k\316\017}\375^m\2747\266\177\246w\265\256\362\343@X\213\210"
+	.ascii	",R\\\362\220\nir\300\002\274M}\244\354\226\231K\247\317\210\343"
+	.ascii	"\370\346\335\025\227\361\3768\220?\245\252\205\203\260\3076\224"
+	.ascii	"\326\242~\022\252\2149\215\f\324'<\036ShPv\205Rk\025<\n\001\324"
+	.ascii	"_7(!U\024@\200\325\036\216B\235D\366\017MH\260r\316\2643\224"
+	.ascii	"/#\270s\257\265pFBV\250+=\377r\324\200\305\324\324\020\211f\326"
+	.ascii	"\227~M\362zg\271]{\213\024\327f\037GA\315\270\273e-\325}S\245"
+	.ascii	"\375\372\211\031\224\257\201\262x\232U\252\331\036Q\306YY>m\363"
+	.ascii	"g\273\262\344\252F\223\245\236\001f,l"
+	.string	"\232b\321,\244\2044\246\332@\360\037\354\033\347\254\024gD\034}\032\030\343i6r\363\r(\361\337\003\037F\257e\337\341\373\234\354\204\363\033\177\033e\2012\265?\361\252-a\304FB\241\275\342\006s3Q\016\240?\212\3062\374\200>\276\005\264\202\352\317\020\240d\275\205QY\r\004Y\202\016\034\370$\353\355\365m\275`\276\331\366%\t<\355\217\356n--B\221x^\277k\\HT\034\337\017\t\321r\233E\017\335bq\371\025\301\363\016a\224\001\323\320\227mp\314\251\006\264j\023\317\351\025\262T]\317!I$\346\234i\3412\362\311\351q\2733\006l>\330\355\240z7\333\242o]k\320\222\006k\377jv,\003f\271(\226\352\273@\212\211\2346\344\363\354\311\033\177\341(b\321\303\t!+C0l\230&\3750}C\247D\336\264GS\337\357p\354V\\\236\306V\177\003\317\025\002\360opu\013"
+	.string	"R-\302\312f{s\337\n\315\005~\"h\323\336Qf\362k\361\342aJ\323\326\264\227i\\;\234\b?\2776\355\017I.Y|\361\346\003\t\205\224\257\271\271"
+	.ascii	"\203\200L\261\345\"\370q\214\336\320n/fj\203\362P0\244=\347_"
+	.ascii	"\023\372oQ\303=\363\030-5\026\250\036K\031$T\207R\365\367\016"
+	.ascii	"\266H\244i\016z\243\264\306\r\371\337\034\311:o\236\257\247\005"
+	.ascii	"\230\034\313\f\224\225\205\322\035P\330\347\322\307\215\304\351"
+	.ascii	"\310\333\270\027\340\342?\f{\3541>2\2633\032\266\236\030\021"
+	.ascii	">\f\201dS\b\270+\215+L!\2034\300S\277\030\256\224\370\341^M\032"
+	.ascii	"\251\342:\313\252\263\273@dE\336\311\217\325^\342\006\234\002"
+	.ascii	"\032T\232\\\020=\375\231\017t;\261i3}\363\203\241\324\307\350"
+	.ascii	"\3452w&J,\322\205\033\244\375\210Q\336c\rq\245\260\325Q\244\257"
+	.ascii	"\2371\276\313\214\270\261\253\275p\355\267\033j\267\f\250\353"
+	.ascii	"I\013\301\267\333\257\216;\356\376\355\321\006\f\\\267>\264q"
+	.ascii	"\b\036eV|\270(/\316d\3429\026\336\373\305\241\246\327~\357x\363"
+	.ascii	"\246_\200\245\237\353\372\007b\267m\030O\370\334>\306\216[\006"
+	.ascii	"\006\3717\022\002\216\026\367\373(e\375\241.\215\356\323_\371"
+	.ascii	"P\007\327*\177\375\331\253\363\370\357"
+	.string	"\310g\300.6\\p\275\201\370\003\177~\021\370\257Qq/U\316@\354\241\303\267\223\200M\326\351\347\353\311\226\224'\346o]\367\210\240\213`f\207\347\035j\312\370\340\277h\374\320\365\361f\336\233\246\237\274\335q_u\306\250EC\224\355\267\322\251+\016N\206qD\335\271\306\263\203s\245\363\3778y\303\343\201\276\347\212\347\201\2529\252\277)\364nv\221\321;+\375\3170\027\303`\031j\376\206z\237/\355\370\272\367\221\3319\365O(?\3334\221\203P^\347\034gK>P\303\377G\304z\253\343\226\333\037\262\3679\202\247\006\3209\003M\017i\242\027\030\374\245\356vk\3147\322\\T\205\255#\244\363\221]Y\3728%\263\247\271\f\017\237\245:]\031\002\331\275Rf\213\341\237\350\213/\247\2727\214p\027\353\223[\\N\352\203\006\370\360~\002\272{\271'B\3303J&\371\371\254\3155$>D\226\227\302"
+	.string	"\335V*\016\320\347\377},\360\3601d\177pl\030\214x\367\016\203A\017p\270\356,Vd\035K^_\230\340\203\007l(\337\313L\317\353\372\276vx\202\334\025\341l\311\203\317@\326\026\222/&\303\222\352\343\034\261\301\366\316\253\310/\237\334\276\244\031\327\377t\177\002\004u\210\347\351\017GX\272HHy\257>n\222z\330\177\030\253F\177\0247\030\\$\331 \364\335\201\276\300p\017\331\036H)\347\242_\226k\304;G~\334\312dw\210<\017\331\030\214n\365\021\201\027\2277"
+	.string	"\361\310\\\002\370\262\342\003\340N\2575\370\341\271\023\205\317\277\375\342\356R\343F\037Z|\376\003\265#\3755@l[\215\323\323G\211\247r\231\315)?Y4\2305\237@\226U\371<\216\202eQ~\263\235v;\343\213\3279\023[txz8\252Z\364\242\311s\334\200k\370\213 \212\211\272\375\223\271-\033\353\260\3362\302_\350s\nyf\237\265\340,\366\261\242\376\206A\r6\031\n\377^\305n\232\302\032\204G\274\031\205\237\"\304\226\310\320\360\334:\3451l\257\345\274"
+	.ascii	"\364\033~;\223\313~=\024\342\203\260s\243\370E\270\027\304\367"
+	.ascii	"\274Xc\274\257k\361\362,\036\017\217\017o"
+	.ascii	"l\222\262\344~\270\3712\214\247\206\246{g\357\030\005\341\231"
+	.ascii	"\307\304\322_\327\233+u\357\362,{\234\303>\021\257R\361\326\366"
+	.ascii	"\277\244v_\367\266\200|#\205[\230\243\222\027~\272\221\005WQ"
+	.ascii	"b\261\225\337\364\b\366\017"
+	.text
+	.section	.gnu.lto_.symtab.d29c63c66af31638,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"canUseLaunchControl"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"updateMagHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"areSticksActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"osdLaunchControlModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"timingsRecord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"getCycleCounter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\004"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\004"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"imuUpdateGyroAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\004"
+	.string	""
+	.string	"statsOnLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\004"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d29c63c66af31638,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,244 @@
+	.file	"hardfaults.c"
+	.section	.gnu.lto_.profile.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\223\344\350\214\003\002\002"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 @\335\001"
+	.string	"\024\0034"
+	.string	"\001"
+	.string	""
+	.string	"\t\372\341\240\227\002m\001"
+	.string	""
+	.string	"\002\b\200\200\200\200\002e"
+	.string	""
+	.string	"\004"
+	.string	"\201\200\200\200~\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\001\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"hJ\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002\002\006}\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 \030\225"
+	.string	""
+	.string	"P\f"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.caed047e94f75af,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_HardFault_Handler.18.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"=\n"
+	.string	"\366\022E: \261\322\001\037\202\242\033\032\211\t\240\027|Hj\342\252\206G\362\b\377\027\200\212\327-V\\\333\266\021&\f\305\306\271\027E\300\200\202\3203\260\007\020)Xf\253O\266\377\226)\0053"
+	.string	"5"
+	.string	"3"
+	.string	"\246\253zG\247\\\225o\300\361\016@\3548\025\370\334\270\334 \264F\217"
+	.string	"\261\265\361\340\\.?\371^\210\341n\227Pk\365\276\304\214\233s\333!\333\005\3667\0373X\305\346l\332je\210\375i!\243b\031\263\277\336\257\317Y\240\2153\004\271Z1r4\3256[Ll\277c\225\035s\332H}\255\306\2652\326Z=)\022\265\322\331\255]:\355_\366\260\200\330B\271zH\"\223)_\031\252\301\260\026\347y\024\275\\y\027,\374\354((\277\304\024\251\375\353\323O\321\317\313\027\rY\026}J\246\210\023h\304"
+	.string	"\202\034<\321\310\223x"
+	.string	"\221<\021X\362>\003\376&\032@\317\364}\240\327\261/c\356d\314vg\017\016Am\322\247p\033o,\271\372\277\2515\023"
+	.ascii	"G\b\232Q\271@\265\035X\203:\274{(YpZ\205\205x\260\206R\033g\306"
+	.ascii	">[Zy\301\"\310\fn?K#-\242\233\272cJ\241\240"
+	.text
+	.section	.gnu.lto_.symbol_nodes.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 o\225\002"
+	.string	"\202\304\020\036\2405\351\017V5s\344|\341\213\201sH\264&\354\355\377\377\037e8\326v\031!{\313\024\023@\324\266\265\261!\231\200\300\266tF\265}\344\200\356\340\237X\221~.\035\374}\341ar\f\204:\242\376\225\004"
+	.ascii	"\240\206OVF\211\213\f\224\001"
+	.text
+	.section	.gnu.lto_.refs.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.caed047e94f75af,"e",@progbits
+	.string	"(\265/\375`\330\003U\035"
+	.string	"\266x\310I\240\230Uc\201\030\006\2748B\353.1\362d\376E\2603\267\343\fO\367"
+	.string	"-H\033K\346\027M4~qm\355.\207\354\375\337N\376\263-\310;\\\215\002_Sz*\n\332\264\261\005\374\342xX\203uJ3|\237l\231\002\243"
+	.string	"\256"
+	.string	"\264"
+	.ascii	"\277\022,m\022\n\377\244\035\341\227\320)\243\2774ra2L[\246\265"
+	.ascii	"6U\244m\272\t\026\275M\277\"\252f\213\026\177\364\377\2121\233"
+	.ascii	"\206+\302\224\256\033\344\n\271E\331\215\362\035r[\333\004\331"
+	.ascii	"\267?\233s\253a\304I\351\352\271:/W\002\323\227u\016\361\017"
+	.ascii	"\\\232\276\262W\316\225\275\354\013\304\276?.\024O+=Zo\374\331"
+	.ascii	"X\016\353BH\243t\231\275:/\363\016hbe\333\b\305\366\222'\266"
+	.ascii	"\017\334\330w\205\355*\333T\266\245l\037m\267\266\241l\277lO"
+	.ascii	"\261]&\223\311\244\355\016\266\263\354\326.?\3121\306\354!\365"
+	.ascii	"\213Q\272l\367|\366\t\253\372\340o\030\003\221\266*\214\brx\342"
+	.ascii	"?5\226\262\177\004V}\220]Q\330\251\020\3254\370Sao\217\246_\337"
+	.ascii	"\223\266?\025g\211\303X\312\022\207iK\034\302\322vE\377uxU\366"
+	.ascii	"\207\246A\342\013X\332\376\206o\211h,mu\360\bR\342I\213\013&"
+	.ascii	"\r\036I\270\364Sa\310\224]\177\365_\243\321U\004\377\322\252"
+	.ascii	"^\375^\\&@$\0220\311o\275\354\177\002B \323\372 2uZ\177'`\356"
+	.ascii	"B\007(\213\374\215\213Di,\375\310\350/p\366\027\376\350=\362"
+	.ascii	"?\372\277F]b\003Q\314\251\251K\265\263\266\274@\2418S\346O\222"
+	.ascii	"\t\330\362\305\212\322m\342K\005\200K\211\243\261"
+	.string	"t\031\353\022\261m#@Jq\250\345\311\264/\222[\274H\256\324\215z\212\fF\024,\312\374V\nl\236\203L[\272n\222\253\344\026y\356\222\026\032u(\234,\037YfJ\227\257\222\351\313\363\272\311\313\363\362E2}\213\\#\276\306[\274\306{4\354?\360\237q\005B\021\313\204\2142Oz\222\231W\234f<a\371\036\355\006\017\374\345\346\207\372\177\200\006\213\323\216#\245\313\033\314\322~\375\247\376WA\303^\005\336\370\322\334+\263qn\353\"\260\355\372m\267\274<\316\315z\270\021\272\"\332\231\363\240#\032\362\365x'\357\302\007\336\351\003\340\334\214\346\353\341D\350z7\0226\"\334\215\306\271\331\251\333\351t\316\240\237s\247\013Q\203;m\247\206\"\334\351#\341\013`\003\346}\300\365h'\217\327\243\005\350\341\210n;\233\205 \n\267\236\315B\314B\272\036n\207\363`\332\201\317\002\237\237\0215\376\001b"
+	.ascii	"\304\340\345\037\240Z\r\310\247f\332\247\326:\203|\027pE\272"
+	.ascii	"\323t\255&\241\207\003\206\n\246\320\314w\022\205\260\r\335z"
+	.ascii	"\266\034Mh\210\266\323\331\212hB=\037mV\300\366\215B\205\303"
+	.ascii	"f\371\350but\035a\330`\202r\245\312,U\216\200\245\253\252\352"
+	.ascii	"\036w\326V\226d\212\244\2472\271\003\210#7 `\002\0211\253:\311"
+	.ascii	"\254\\\260\270_\270o.\267s\343\356\b3v\002\250\027\254,@\253"
+	.ascii	"*4&Qp\213\250\335\032\243O\305\276j\255\026\t\341\224d\265\264"
+	.ascii	"\027\302\fq\331\200}\235\254\206\204\366}X\0169\205\003\223\001"
+	.ascii	"3\261\022\267h\346\200>M3\252}\265\r+\f4m \351TX\263l\007d\326"
+	.ascii	",ys\343\266Sr\217\322\357f\\\355\nd\327\277\320\376\332\356\320"
+	.ascii	"\206\213\254\017\263\036/\353\334,@\001"
+	.text
+	.section	.gnu.lto_.symtab.caed047e94f75af,"e",@progbits
+	.string	"HardFault_Handler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.caed047e94f75af,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
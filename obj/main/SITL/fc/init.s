@@ -0,0 +1,1676 @@
+	.file	"init.c"
+	.section	.gnu.lto_.profile.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375 v]\002"
+	.string	"t\003j"
+	.string	"\003"
+	.string	"\233\364\343\336\006"
+	.string	"\001\254\334\256\202\f*\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002\006\002"
+	.string	"\002\007\002\b\002\t"
+	.string	"\002\002"
+	.string	"\003\352\263\360\321\b"
+	.string	"\007"
+	.string	"E\365"
+	.ascii	"\315\301\013\202\322\277\222\331\\\001\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375 \220=\001"
+	.string	"p\204"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\n"
+	.string	"1\t\324$"
+	.string	"\001\264ph\252\270\235H"
+	.ascii	"\n;\367\316\221\002\003,"
+	.text
+	.section	.gnu.lto_.inline.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375`\f\001\215\005"
+	.string	"\302D\021\036\220E\351\227\357\016\254m\302q\312\372X\203B\277M\242\353\372\377\377\007j\217_\373\211\334)#\002k\254\375\372\217\200\254}\306\272\202\377\204B\251\232\002\f\377\026\002\250':\350{\016\337\264u.a\333\256\347<. P\002A\016\232\007%\007\300%\220\021\207\027\t\335"
+	.ascii	"\211E\210\206x\220\240 \242\004\fp\203{\013>\032\364\337@\276"
+	.ascii	"\242E:`\017 \327\031v\005\274\035\216p\221\321\001\367\205\""
+	.ascii	"\261\b\224\023p\257O\3041\n`\020\313\240\224\303\323\306\341"
+	.ascii	"\205\334\003\316\267s\244$ \001\210\035\230\t&\362\264\315\356"
+	.ascii	"\0019\254y\255\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375`\275\001\205\t"
+	.string	"\002M*/pK\222\016\374\257\242\335\3348\032T\f"
+	.string	"\f\374\353\325\360\021\3617\225\031?\306Z\003\2511\2443\260\271\242\006\377\016\375=\254\331\335\b\221I\006t\210\260\\\034\307\231\"W\346\361`|\240\0069Da\201A2G\216\006\214\242!\306\266\\\371z\232r\234r\275\223\311T\323$5<@\\A{\271.\222]0\341\017\t\276\301\t\212\236\261\243J\202\252\016T\265R\271\"#\320\332\320\323\2366t\307s\334\311\002\330\230{\314uf\nPURi\224fn\210p\273\26447\327W\264\332+\232\253mq-\311I\226GV#A\250\361T\210\214\212I!\323\032\220\002\t\216U\017\021\260X)8f\223r5\007\321\375\203\363\264\376\203\354#\357\002\027Qs\230\346PQ.\346\336#W\201\256<\246\031M\306Q{\b+\244iE"
+	.ascii	"\202\205\212\222w\272\241\004\003Q;~\352@h&\342\374\314\002:"
+	.ascii	"p\032T\377\274\264ST\370kq\312\352gB4\366\013j@*\376\315\256"
+	.ascii	"\316\230\356\342\356Q\352s\266\247?k\324\321'\360|j\334b\302"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_.pureconst.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.21766d59f9e1f6ec,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.158.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375 \273\335\004"
+	.string	"\222\b (\200k:\300\234:\035\017\200<\032\324\001#{\350\016\361\217\355\315\016\r{\370G2\211\025VD\365x\200\r\337\"\271S\n\216\240*JQ#\205J\021\261\320\210r(D\360\304HPZM\023\245\317\266O\255\360H\210\275]0+\366\001\233\232\r\033\023\217\003}\273\222\257\263\233\200\006c\373\217-\273\373v\331s]\204\363vW\323r\353\320\362\237\371"
+	.string	"\313\256C\301aw\r\261\214r\347\r\266c\t"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K7fk\273N\013"
+	.text
+	.section	.gnu.lto_init.159.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375`Z\021US"
+	.string	"J\2060\036R@\324i\215\001\347\376\352\207\250=\314\241a\017y\221}\365\313\217om\334\273?H"
+	.ascii	"\f\346\375(p_`pY; \017+\245\312\273\036\232ba\377\177\\\310\242"
+	.ascii	"\231W\3315\315a\3242\207 \"\373\016\255\316\034\210\"bgU\265"
+	.ascii	"d4\"\222\244\224R\302\001\262\001\322\001>\347\027\237\263\313"
+	.ascii	"\352\334\262:\257\356\354kqfY\235{>g\236;\253\253s\272:\357V"
+	.ascii	"\347\3679\273;7\n\035\307\203J\nk"
+	.string	"\353\343\234\257S\235\021\3573%\322\325B\272\233\335\316~\346f\356\037\334j\274\342\3209\270-\204\215\364\030\235o\222g\246\204\276\r\364:\355\331\225\320?8\370\003\225\324Q\377`\034*P&D\035!\312\251\345\240\032CZ\343A5\226B\377`\237rm\216W\350\037\374l=4\241\032\3535Y\227\361\232b\001\267\235,\364$9_\247\024i<\370\364:\345\036k\246\333M\266G\311\371\"\035p\362\034\233{_'\212N9\200^\2471\375S;\365\246Q;e\227Y\210vf\275\r\004\307\361l\356}\337\340c\261\257w\316\346\031w\033\310\263\243\223\203sc\363\253\241\231\221\211\201yqiY},=\236\232\356\336]n\336\317\t)\"\314\342pH&5\220\331<\273\004\226\346\244\372\r\311\334\265X9\376\320ec\276\243#\3269a`\216#\346\303o\272\332\246\213\006\377qu\rW\016\247\331\245M\212"
+	.ascii	"\3517\344\326\256\201\0319\300ZM\313gfx\302\3212j\235\336PB\307"
+	.ascii	"\2426\236ptLV\303dU\371\013\357\307\306\023U\273Lu\313\033rJ"
+	.ascii	"\007R\312\327]\001P6\"Z\007\222j\367s\242\241\351\r\251t\037"
+	.ascii	"\215f\331\025@\245DF\277!i\354~Kn\004\321emB\0072\312{&l<A5\357"
+	.ascii	"\r\t\005#ytU\206N],\371\316\370\222\\\362"
+	.string	"_\223\305]\317\373\276]\326\016Cr\311\235\367\363\276/{S\362\251\231D3\273\001\314|\205\031f\200}D[\245-\242\215\266Q\265\323\237\177&C\300\232J^\327^\021\352\360xB\340,\317\334\326\271I\275g)v\264\210\236s\227\216.\023\223\332i\357yhB\242\315\006\334m\367\005\225\367\314\256\223\233\354Y\372$V\237\367\007\034\217`\300\331\331n\f*\263;\303\215\362nR\277\255\330\236Qh\n\357 -\347Zy\216\\\234Y\323\330\373*Ii\250;\345V\271VV\356\rwy3\304\323\370IX?&2\nM\241h\321m\265\023\227\253\367\276F\006\270\343\272\211\3335\201\332i\372\017,\233P1\233\273\007\242\233\206\350\006\252\377\273\357\243\214\242\3271\367\222~s\275\270s\260\273\303\375\362nr\277\324N\377S\031C\242PJ^\247\272=\204-D\276\236E\002\224\244\311\245\277d\024\355\3773"
+	.ascii	"\340is\233\332?\272\007W\254\367\276.\272\311e\366\\80@\247\334"
+	.ascii	"m.Y#\351$\020p\347\350\224%\230 \3455Ga\n*\360n\362o$5\\|\022"
+	.ascii	"\257lX0\354~i\244\373;\354\202~\244\032\305O\352\033\033C\244"
+	.ascii	"\376\227\314\202\252\300\343\\\305\231=1\272\225\f\234\310\024"
+	.ascii	"\2163o\320\201w\223\002\337\314d\rQ\350\0073OO\020\\\350\034"
+	.ascii	"4\204\246\b0>\2362\316L\202\320\273\211k\256 \243\320\342'1;"
+	.ascii	"\213\376K\346\3669\223\362\301\177\305\214\024\301O;\233\025"
+	.ascii	"h!\315'Lt\263\271gu.\261:\223X\235\201\2533\317\352\274\363\342"
+	.ascii	"\254\263:\347\2703\216;\337\270\263\215\213\363ou\256Y\235i\334"
+	.ascii	"y\306\235eV\347\230\325\031&4\277d\336\023\031\244\377'1(\372"
+	.ascii	"\304\3038\361\335\354\335\373\276\357\214\001}\342\221\276\205"
+	.ascii	"(\267b\034\032U\361\205\247hVNef\247\260U\324\272]@\023C>;\213"
+	.ascii	"\375lapAd~i\364\006\342d,]\032\244\352L\214\351M6\312^a\351X"
+	.ascii	":\225\255k\223\034\355\013\032\205\266\336h\036\3262\245UWK"
+	.string	".\370p\260v\351\33021\2510\332\027vpbB\026\223\202\263\363hc\354hc\230\321F)\333)&b0\277d\233*\233\3574&=\254x\334\320\261\\\361T\344?\255v\213\035\207o\t\265\\mW\227\332\351\357q\352\220@y\t\t\200\243{\326`y\003U\232\257\271\242y\016\240\350\300^Vxw\373\325\243\005K\203s{\032]T\2707\033Q\273[\246\312\334\222\265e\336\004\256\355\271\224\276\360\241J\313/y\346\207f3\377\2026\345\344\222{\261\376\222\273\254-\210\242u\\c\341fU\336\365z\336\304\303\220\3019\223y\027\027S#x\2479\215V-\rReF\006\345Qm\220\034Z55u\255eS\247\3369h[\304\255F\024\032\3432v\rTa>\306\2230\237\312\240\004\f\352\003w\371\227gwj\217 \3400\264q-\222\266\315\304\277|\037\217hy\227\r\334\332%\336M-\277"
+	.ascii	"\r\267g\361\223|\277\204q\022\226\305\362W\334\\E\204\340E\360"
+	.ascii	"+\024\031\242\376|\317\303\330\265\313\245\256\257\302\314\211"
+	.ascii	"\321\255\3009\223\313\005\344\026\b\177\321\306\335d\321\371"
+	.ascii	"q}\236\r:\2005{N|\251\235\"\200\027\335\330B\211\322J\221\242"
+	.ascii	"v\032\301\2476\254\361|\257\202\001\357y}\337\222D\354i\344V"
+	.ascii	"\256\353\332)\0034\241\013<\344\0234\024\002\005\021\203,Z\f"
+	.ascii	"\021\205E+\202,Z\330\034\021\335\360\220\217\nG*rx\310\347\210"
+	.ascii	"\310\210\250E\220E\013\033\036\3629\301H\250\004#\026DE\302\240"
+	.ascii	"\241\360HE\2208<\"\032\t\021\003\340!\237\"!\321P\210\030$\016"
+	.ascii	"\205P \032\006\3610\006\036T\320AJ\324D\242\020\020\020R\007"
+	.ascii	"AB\241\341*D,B\322@\250(\210\210\205\201|N 2\"\n\002\255\b\032"
+	.ascii	"\021\tK\b\002\r\211A\237\037\037\265\020\032\006O8:\032\006W"
+	.ascii	"\247R\377\025\367\246\264=\225\276\310%\376\305\333@\225\304"
+	.ascii	"\227\370%\022\317\201"
+	.string	"T\225\027\210\254\360\335Kl>\215ND\037I\345;\027\003\310\214\032Q(\360\351z\rTy\036h\205\215\201\3479\220Z\213\316\340\305p\316A\213Q\302\243f\247)Y\254+5\314A\215^\216\242\231\331*\326j\307\323\b\374%\r\376\310f#K\026K\312\324\223\345\313\207(\317/9\335q\250K\331\371\021\224L\242\254\226\224\030\317\235_\272^*\024\327K\200\254\367}\237\204)}\230\243\342S;2\351l\275\240\025Q\203\226\267\231\307\261\314\224\253\353(\204I\027\353eD\345i\334!\024b\3123\225\332Q\225\303\366Pu~h\366\344\313\227\260=\334\374\311\202\211\261L\246\332\251\316\243\240T\002\206\363K\366\034\226\314\225\270\\=O\342ml\031k\306\236\261gj\2479?T\036\211\002\251\202Tz\337\340G\330\265\264j\td\312\210\357\300\346\240\306\256\255\261\261E\246@\2437F\344lpz8\257\366"
+	.string	"\235\373\261G\204P\276\236\305\232\233\276\371\026\2646d\024\212\204J\233\220\354\355\244\367\231\343\300\302\371\217\310\220\263(i\036\204u[\302\302\301\001\301\306%y\032\235\350"
+	.ascii	"E\310\202\310\263\310F\361\241\211A\003\201\202\250\201$F\025"
+	.ascii	"ChDDF$I\222\f\007\221\005\204 %\0354\017\021 -u\256f\222\024"
+	.ascii	"\n\313\001R\372:\343\300ag\357\250\377]\364\335\007\276\367\301"
+	.ascii	"\375"
+	.string	"T\310\026\207\025M\323"
+	.ascii	"\330\301\255\331j\202\233\327\215f\232\305\307\325\241\357\356"
+	.ascii	":3t\034\214\357=\251\031\321<5\2439\3734\316\365\003\036\030"
+	.ascii	"\242!s\322vf\341nx\322\302\321S#V$1\t\017\254\251dL\331\260C"
+	.ascii	"\220xc\316\033)8\373\310\351R\247\204`8\227\214\302\321\225\221"
+	.ascii	"\203pA\t\024:\242\020\\\356P\370\2139\301#2\t\326\006\311m\007"
+	.ascii	"A\003\300l1\262M-\244p\257\357\315l\240\237\276\211\225\354~"
+	.ascii	"\202:\356\217gk\231,\215\203\2250\211\214Y\373\024\037\377z\023"
+	.ascii	"~\n\211\2145\274{\t\177\337\213\317t\341\304\314'\343\263\233"
+	.ascii	"\b\227#\354\364y\372\327"
+	.string	"FiN\207o\274q6\215f;V\250\b\013\3045\233\323\363o\304\036\227\262^  8 \230'\22269\341\024\tjPin\204\217\035s0\343\352\227\237I\f<v\027\036\345\030\221\233\353\b\256s\262p\003\021\2650C|\"\371\275\013\212\270Gf\002w\001\351s1,\315\374\354\032\255)\245\347\007'\254o\347\266\371\350\323\237\337\274\342\350\b\360[\206\236D\217\fLc*\254\320\274@\343xV7T\347\"\304$\th\316\254T\301P~\"E\f\3416ZD\250\b12=*f\200*\313\246\361\264\034jC\016L\303\"\r\331%\302\324\307\247\300\004\327\311\314\200\326wUOX\250\t\211\275\335[#\320\300\260\212\255\274\364\360\325\007\n`9pB9\2761!\326/\303pT =(\3237\275\241\202\306\022b\266Pn(EA\242u\017Wa;\214\241\036\323p^\210\256\334\334\t\303\252\006\272"
+	.string	"\237\212\253=a\236\260I\363\006\323\315?\030\354q\234\367\357\220\221s%{\024\356+T#\255\200\321"
+	.string	"\374ZT\376:\b\217T\370(\356\tG\355M<\330\332W\332\333\252\370\005\336\022i_\022\374\2506\365\254E\273\177\234\212E\276\254;8\242\035t\300C\020\313\373:\261\356\262\240\031\253\255\330$\304\220u?\323\225\330\355\\L\020H\225\nd\351\207\231\2503K\230:\375%\n\223L\022\020\013\363\252/:\306\030\302\233\274\206Q\255\316\0347\350\357\001@!%\302\220\301\020\301G9\227\252u\177L"
+	.ascii	"\371\3550\377'\341\313f\225\211\350\021\236\217\235\353M\266"
+	.ascii	"jsp?\300~nSf\314\234\345V\013\272@\314\220\245\027\214O\212\364"
+	.ascii	"P=Z\342\032\030\224<\265D\250)<{U:_p\262q{\227\316\246\222\261"
+	.ascii	"3\366&\317\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375`\220\b\205\026"
+	.string	"6*\220G\200\230J\032\003P\221_F\251\376K\332w]\255hU\215\266T\\\236\312\340\001'>\f\323m\303).\351\314\237\004\224\331\354\270\344d\240\374\377\377\377\377\373\251ZUUUUUU5\025\321\263\276\310\026\205\215\035\023\t\202"
+	.string	"z"
+	.string	"{"
+	.ascii	"zV{\222\252}\217jW2\265/\221\332\371\242v&P{\223\247\335\211"
+	.ascii	"\323\376\244i\207\302\264GY\332\247(\355T\222\366*H{\333\311"
+	.ascii	"\262dY\022\307\034\355}\033-%\270\227\242\273\f\230\213\315["
+	.ascii	"\b\234\026\370\017g-D\273\t\3172\364\025\235\261\b\375\245g\277"
+	.ascii	"\240ql\302\001\375\002X\226\245\327p+\300\2459\263\266\237\375"
+	.ascii	"L\206E\231[YnY\356\225\r \231L&}v\0302eY\322\264\b\327\257=F"
+	.ascii	"q\227\221bG\363\332g\240\330\317\023;\r\023{\215\022{\032\211"
+	.ascii	"\335\306\210\375\206\210=G\210]\007\210}\307\207\235\207\207"
+	.ascii	"\275G\207\335\007\207\375\307\206}M\303\016$\303\316\206a\017"
+	.ascii	"ra\027ba\037Ra'Ba/2a7\"a?\022aG\002a\177{\260\3039\330\343\272"
+	.ascii	"v\271\006;\312`\237[\260\323)\330\353\270v\273\255\375Nk\307"
+	.ascii	"\313\332\363\260v\265\253=\303\364\351:D\241\256\3033\352:4\245"
+	.ascii	"\256<\350\324u\007\305\271\356\234\003\311\374\302P]\205\351"
+	.ascii	"6j`\310\252\256\302\323\352*4\257\2569)\326\365&\315\272\336"
+	.ascii	"\230ZW\233\232t\353Z\203r]\203o\327\340\031t\r\232pW\001i\334"
+	.ascii	"5\300yQ\237\035\230R\356:\223\036\344KsQ\242\327\231s!\332\236"
+	.ascii	"Y9w=\245\273\216\326]"
+	.string	"?\355\256\233wW\025x\327\256\274kP\251\027%2\275\271\"Q\234+\3624pE\2329\327\025\302\3531=p=\242:\327\343\271s=\362\\\307\322i\330\374\304\364\\\307L\004W1tx\025;\211W1s\240\331\332Y\202kX\352s\rC\177\256a'\320\025,\005\023\272\202\231\306t\350jD\211\256\306\263\350j4\215\256_\351\321\365\013E\272\026\321+\237\333\337]\322\265x*]\213\346\322\225\2302]\211h\323\225h:]\003\200\204\250\021 \b\210\207\025\224\235i\f`\203\266Ic\0210hF\b\021N\304#>\2439%xu\354\036\226\353\326\030\335K\333\346\320\360\244\306\021\334w{\352\032\302\025\215\276\337\216X\327\252\362&M\323)\353C\213a\355\215\361\257\207\241D~\311z\212\332\361\t\251\300k\214\337\f\002!B\202\204\b\021\"$H\210\020!B\202\204\b\021\"$\306\377^p\337\250\266"
+	.string	""
+	.ascii	"\366;\327\237w\317\273w\356\323\257\267\267\nP\373\301\237\327"
+	.ascii	"\257\006"
+	.text
+	.section	.gnu.lto_.refs.21766d59f9e1f6ec,"e",@progbits
+	.string	"(\265/\375 \220\245\003"
+	.string	"\302\310\032&\2209\303\032\313N|\212\237\342\336\356\356 vww\007\3660X\004\200\\\2015\263w\367\222^jd\2675)e\n\237\270Z\342\036!\325\020\322\037\230;@u\003C\364\005\350\n\021;\341\261\021 \366\301\303\0268\226\300\361\300U\201;\240a\001\256^nKc+\315\023cJ\363\204Y\262\260\222\242F6t\365\271\035\263\232n\020\001"
+	.ascii	"*\027\204("
+	.text
+	.section	.gnu.lto_.decls.21766d59f9e1f6ec,"e",@progbits
+	.ascii	"(\265/\375`\323V\315k\001*Z\252\204W \fY:\215\001Z\353\244j\031"
+	.ascii	"gx-tQ\252>\311\237\242\346\020\3079\330\243\376\034\343\035\016"
+	.ascii	"9*\3306*\203\237\360\342\315\254u\020\370tl\315e\233\360k:\256"
+	.ascii	"?\007>u\345\224\242\340\267\213\274\246\341\017\231\245RQ\365"
+	.ascii	"\024\336(.fZ\223mo)\245L\001?\0070\b\327\bP\354\244\272\244\234"
+	.ascii	"\341\202\242+-J\r4\031LU8\f\301Xo\311;\207\207\\21\222{\037/"
+	.ascii	"\034\036r\267\bi\300D\326f\030\355\316\275\244\r2\337\306\002"
+	.ascii	"\231\357y\323\357A\323\357\001\323\357\341\322\357\271\322?\226"
+	.ascii	":\201\241\360\013\213u\243bJ[\332\315.\204p\033\023iGn~\017\225"
+	.ascii	"\376\217Y`+|\205WX$n\201S\374R\341H\342\026X\205\216\344T\\\216"
+	.ascii	".\334\002W\031\313( H\0314\311\273\275\217e\216+\2728\234|\236"
+	.ascii	"3\372<d\364y\346\364y\344\364y\300h\214b\303\261T\336:#\005\344"
+	.ascii	"\346\314E\333\244\r2\003`\201\314\363\270\351\363\024\321\347"
+	.ascii	"\361\241\317\203\245\317#\245\277\223\247\277#\247\277\323\246"
+	.ascii	"5"
+	.string	"\260@\346w\306\364w\270\364w\254\364w\232\364u\354\364u\266\350\353\270\351\353\200i\004X \363:>\364u\264\364uP\350\347\250\321\317\351\242\237\263\246\237s\324\317\031\242\237\243\245\237\243B?\307I\377h\201\314\343\220\321\307\301\242\217\243\246\217cD\037\247K\037\207\205\376M\236\376\315\234\376\215\233\376\315\230\376M\227\376\315\225\376\215\223\276\246\323_\263@\346\265\025}m\246\257W\320\327-\364\265Q\277GF\277\267\246\337;\242\337\303\241\337S\241/\205\355\267\355\266L\365\321\"\311\315wo\370e[\2032\002\357\346\367P\350\367\230\364\261X \363\246\235\276\251E_\263\273\304\"\205\356Y\217\325\302\204\002\306\3157\251\350\024l+d>\317\n\2317\221\372\246\016\375_2\261;\246\243cE\212+7\333\"\033~\311z\342\324\354z\334|S\206\276\231\r2o,\220\371$\222\3535'g4\336|\016Br"
+	.string	"\341b\362\243lG\362\356\360\272<j\370H\336\036>z\030\351r\342\321U\344\202\335\257k\344\036\271Dn\230E^\257;\344w\005\233d\203\327\r\322\001,\272*\257\275\217=\2621'\330|2\217\0052_&\365\313,\372%\233~\251D\277\f\242_\336\320/]\350\257\331 \363\245\t},\227\353F\366\242;\001u\3639<]'|\\\323$\220f\367\306-q\261\360q\355\006\r\211$i\344\267Y\356\r\233\307$yq\334\032\327\306\335\272:n\016\213\2747.\215\337\254\253\365+e\304\031\023\343u\342Y\362\331ML6\313\215K\342:\361,\035\367T\017\271\304\252\256\247H\230!Dx\262]\263A&"
+	.ascii	"\360\364\f\241\334\266E\207\224\233\237\345\364\255\024(&]0."
+	.ascii	"\325\265\3421\372\354&%j]{\357\3777\306\275\272-\256\214\373"
+	.ascii	"\342\272\270,,\362\302\270S\367\2707\223\267(\264*(\316\240\234"
+	.ascii	"\260e<F\237\315\344\245\311\205qM\334HK^\030W\352:Y,8\366\222"
+	.ascii	"\261\001i\246\272\b\271\333\373x\303\342\352j\315'\3777\305\257"
+	.ascii	"\325]A\202\215A_5AY\335|Ud++5z\334\374<\246o\325\206\337\024"
+	.ascii	"\001h\362\204\355\346\236\0052\237\213\350g\035\3729\206~\206"
+	.ascii	"\322\307j\364\261\234>\266\242\217\321\364\261\022}\334\245\217"
+	.ascii	"\267\364\361"
+	.string	"\225\276K\227\311\"?\270M\277\333Vy\271t\334\307\275\217=\227\213\315\022\344\315\307R\372\366\003\023\347\345\331\017\314\343&}\355\364o\333|\240\233\334\320\214\334\374[6kt\340\316\350\216\334|[%i\313\360\261\253\247D\353+\211g\325\3304\026i\327X4\267w\366\r\2042\266\216\307x\334R\246\226\227U\335\035\2075\366\314\306q>\254\352\274\366>j\020\322\240\241\214\262%\346\2453\266@\346/\023\375;\246m\335\265f\254\335m\235\245{\002@\270N\223\255\313v\003\036k7(\237\360XB\232\371\327\210\376\305\241\177\247\364o\311\330/9\\qP\316\334|\016W\2440y\002'eJ\025(Q\254\274Q\241R\305\312\333o\271\330.\326\213\215\263sV\316\212\261a,\030\273\305\216\261H\373\305b\271\315b\265\334\036o\315\226|I\242\004LW\030\022[\306\203\367\226\021\246k\357\343A\3707\374\t"
+	.string	"\301~\261p\266\314b\271\212"
+	.string	"\330\224\344\336\307\333\263\177\303\027\333\304:\301\200i\357%\027\030\342\360\244\276\356\366\336\032\2044h\320\240AC\216\t;\026VB\331n\033d\372X \363\326\212\276m\242o\213\350\333.\355\203\245\205l\220ykBk`\203\314\237@g\260A\346Q\375[\265['\277E\263L\254\033\t\366n\332{c0\237\232\262\204\334l\331l\333\255\233]\333\326M\001X{/Y\267\036\274\275\227z\254\335\300\332\r2\230\226\21733\237\004\332\246m\270U\0032\247\256\216\333l\357\335\203\277P\261\255\270\271\264@\346;h\004\330 \323\264@f\003l\220\371\"\375/6\310\374\004\364\2236\310\264G+f\221\031X\262'"
+	.string	"\204c\343\3306\262\367\261g\247\315W\23357\177\001\372v\354\030\2626\b\027\322\267\031\2306\317f`\376\352\337\331 \363\267G~[\304\032\311"
+	.string	"?Aam\263\275\217?=G\253\250\255\233\177\264A\246\266@\346\177\217\224\025Ak\303l\377M\303k\377\215r\005\253\225?N\373\357\016n\362\3331\377\365\302L\302\374\027\003\214\206\317\376;w\246\315\177E\300K\260\031\306\372\277$(\371q\317\1775\200\223\224\375\270\202\377\206"
+	.string	"\223!\005\360\3431\261\037\017\340\003\004\034\355\226{\374/\016F\362c\006\374\367C\330\217\037@\201\3772\341#FL\370q\021\260\037w\370\372\255\005\277\315`#\360_ \330\353\267\035\374\230\310\177G\200`\205\377w\377\355\201\207\374x\004\377\035\022\362\3372\377\025"
+	.ascii	"\016\362c\364\277W\030\310\217\037\007\377\345\307]\377}\361"
+	.ascii	"\237\f\373\330?\356\361\303\343\307L\034\354\370q\211\250\253"
+	.ascii	"\305\365[\272\337\306\375\270\003\3771\370\217\302\217u\374\370"
+	.ascii	"\306\217\267~L\343\3070~\314\342\307*\376\233\371m>\330_\232"
+	.ascii	"p\373\227E?\246\372\261\324\217\243~|\342\307%~L\342\307N?f\372"
+	.ascii	"\261\361\307%\370q\360\307F?\366\3758\004?>\341\307\033\370q"
+	.ascii	"\006~\\\201\037\213\360\343\b\374\370\001?n\300\2179\374x\303"
+	.ascii	"\217\013\360\343\017~\354\301\217\007\360c\r~l\301\2171\374\330"
+	.ascii	"\347\3077?.\177\214\177l\377\233\367\337\273\377\236\371o\335"
+	.ascii	"\177\351\376;\367_\271\377n\371\257\226\377b\371\357\224\377"
+	.ascii	"F\371\357\223\377\272\375W\355\277h\377]\362_%\377-\373/\362"
+	.ascii	"\277b\377=\362\337\"\377\375\372\357\220\377\006\371\257\217"
+	.ascii	"\377r\3757\307\177m\374w\353\2773\376\353\363_\031\377\205\361"
+	.ascii	"\337\026\377\035\372\257\211\377\226\370/\211\3776\375\367\303"
+	.ascii	"\177\213\377U\377\233\364_\021\374\267\303\177I\370\357\b\377"
+	.ascii	"\025\300\1773\370\357\317\177y\376\213\363\337\336o\315\374\226"
+	.ascii	"\314o\267\374v\002\277\325\360\237\315\177\274\377c\376\033\371"
+	.ascii	"\017\374O\345?\316\313\313\313\373\363\325\037D\367K\300\001"
+	.ascii	"\001V\220D\360\356\366\224\024\003\350t\2012$\354\346_\320B\337"
+	.ascii	"\3322\323\206\r%-\"x^\373\352*\303M\2221"
+	.ascii	"nZn\376\005*\364K\032e\326K-d"
+	.string	"\251Un\351\275\267\361\270\245\204\254\304\021\301\273\333W02X3Yncv\026Yn}\214\316\306\240\324\"\244\307\331\315\007\300\030\375\333\337\337\334KS{\357\252\362\270\247\230t\314\337\336\226\326f\370w,\266\034\374\317\370HF\307=b\256n\357m\353t\020\265\245\0277\377\327`\377\177\206\275\215v\357=\365D\226e\374y\"[\332OeX\250~\236\310\262\250\236\216\233\006\206M\266\265\237\216X\306\214e\334{\033\357>\356\246,\252\335\204eLz:\356\251}\3042\372\354&*\237\247\343\222\361\211,\213\312>\221aQ=\221aQ\375\354\246m\334MK4t\023\026\325S\025,*\237'\262%\252\247\246,*{\304\3326\213\3331\3138b\223-\355\354\275\241\216]F\235\275\227\246\266Q\313\215\332Y\311\250-c[,_\307-\241\275\267\321\354\213\026\326\315\221icy\022\202\025\034\261\367\227\035\245"
+	.string	"\2435\036\367\336$6\223\321\356=\3428\2657\023\026\t\256\366\336\033\313n!1\265wv\323\022\024\223\026\226\316\b&,\022[\b\r\273\367\336TOdZX\033\330\222\220um\246\243\321>Aa\355\256\375%kJ\223\031\217\326\314\016\031\327\025\324\315%\326o\323,\2244+e6J\031\245\214\022\206\035\333\306\021\314I%qf\254i\263\345\346\003`I\f\0308\333\230\026\345\346\362\305N\330Y]\217\233\017"
+	.string	"0\375\227P\267\310\022\252l\201"
+	.string	"\273w\032Rm\311\n\206\232\233\257x`dA\222u\363\001\200CEiU\256\260\310\222EYu\333\003E9\245\205\266\201\252\234\322:\263YJ\026e\212r\312b\271\332\233J\001_H +\350D\001\231\241\246\363-`\243o\201\234\276\005q\372/\245^N\375e\324\355\321\324\003\204\005\326\331\315Wl\303K\251\234&\025g=n\276\005T4\216\005d\307\2351CT\254\271\371/K\334\"\313\022%\211;\266\2159H5\253\272\273)i\214\250\271\371\026\374\320\177Y\222\330\202z\373qs9\002\007\006[\225\271\233o\201\226\376\363\335]\331d\001\275\233\350\2200M\031;\273\271d\3521\363\204\366\345\346[P\245\377\227;\347\225F\213,\2272\033<0#m\362\032\236\233r)\247\311kx\232\202\334"
+	.ascii	"\323\240\277\352\254\210\351|!-\372Bl\372Be\177\222\325\344\210"
+	.ascii	"b\314q\363\205\216\350\013u\351\013\271\260\313gp\316\274\250"
+	.ascii	"\b\273\371BPvG\375\266\343J\006\335-2\323\345d\007\2737Z\231"
+	.ascii	"\t\235\2610i\316n>\2064e\222E\311\343\331\315dr\214b5\244\334"
+	.ascii	"|\fr\3726\211\2256\3110yL\026\223\345,2\317\345/\033\362\\\206"
+	.ascii	"c\223\347n\211\354\005\037\327.\200\304\013\313s\031\f\022\272"
+	.ascii	"6aw{\037yr\340qA\341\344c\370\241\217AKw\261\343\372\321\346"
+	.ascii	"\346c\250\322\347\200E\211\230\270Ku\255\360\261\353\206\304"
+	.ascii	"\2151[\262\226\314\305\"s\\\316rs\\\276\302f\255\234\212\301"
+	.ascii	"\005N\347c0\352W\220\324\257 N\277\2025\375\n\302\364\237\333"
+	.ascii	"\220\271-S\021\322\333\254\212YI\325\004\252\351\34673\214\345"
+	.ascii	"\251\312\276\371\025tE\311R,2O\311O\314\334\262\023\036\274w"
+	.ascii	"\226\221\256)\031J\033\035\235\006S\214\231,Lf~\005U\372\025"
+	.ascii	"4i'w\005N\034\230%n7?\250\215~\220\234\376\263\0312\233\3455"
+	.ascii	"!\275\311\350\220\3444=\330r\334\254v\343\305l\f\305\315\017"
+	.ascii	"zkb\2219-/\271=\236CZ>\313Lx\214\307M\325\27316f\352n\357-\244"
+	.ascii	"a'\315\324f\313\371\317h\317Ll\031\t6\206\2351N\216<n\266w\033"
+	.ascii	"\236\321\"\300\265\005v\363\203\204\350\007i\351\007E%\331\300"
+	.ascii	"\032J\234\334\374"
+	.string	"\240&\375g\032\267\310L#\223\331)\2737\032\227\030=4bY\312\334\214\264VpYjn\376\005;-\226md#Xl*\003NW\311\214$\037\363\230Ef\261|\3449+k\245e\261\274\325B,\207\271H\342\204\211ScC\347_\330\242\177\341\211\316\271F.r=\250\301\006\315\315`\346\224\251\244\227\233\177aL\377\317D\362\nYH\016\222\275\362\020\213\314_\371\307W\326\221}`\261)\255\346\364\224\334{\377\272\001\201\352\352q\343D\376\312]8L\344\257\234\203\255*NHO\0274fSx\362/T\351\003\345\351\003\321\345\036\226LI\21657\037\210\212\316\\y\207Ef\036\337;95\326\314\226n\016\261\367\336\366O\314\336\237\230\007Z\323\007\n\323\007\332\241\017\264B\037\250\2046\267\r2o\301\2146\261l\220\371-\026\310\274\205+:C\236q\323t<\222\355}\354\271pE\004\305\315\267"
+	.ascii	"E\3779\0052\247\3101\204\364n\252\202f\246\225EM\335\f\343\226"
+	.ascii	"\350*\303v\363-\230\351\333*,l\231\031\207\025wEX\327\336\307"
+	.ascii	"|\225U\330\262\336\r\272 mw\371En\221]Xd\276\312VB\246\224\034"
+	.ascii	"\231':\337\202\226\276\205\025\372\026\244\364-8\351\377\320"
+	.ascii	"\351?We\252+cl\312\334\234\247.\232,RU\307\033\2665CV@\335\""
+	.ascii	"3TFa\001\275\233\340\340\222{_\031`g\r\n\274\267\233s\324\315"
+	.ascii	"\213:1a7\377'N\377G-\233\320qijP\271\371?`:\227x~\312Li\304\324"
+	.ascii	"\225\335|\373\246\246If\302]\360\031\213\305l\004'T\222h\246"
+	.ascii	"\244I\353\312#\262S\336\271)\223\310K\331\210\363,23a6\307m\356"
+	.ascii	"\216\3475w\005\223/\027\315b\271\212\200\027\032\224\273\314"
+	.ascii	"\204\361\300dq\251\360\332\373\3303\203\027g\305B\326\261@\346"
+	.ascii	"\177R\350\377@\351\373\264\321\367I\352\373X\321\367Q\323\367"
+	.ascii	"!\323\330N\247\314\2303L7\337\207\210\376q\235\231\022\371\006"
+	.ascii	"\266t3.\203\351,\022\233\3711\n+\345y\fk\223\355}\334\301KVV"
+	.ascii	"\324n\276\315`\366\344\345\345\345\331\f\346\217\223X\214\232"
+	.ascii	"\021Z-\276\334\275yI\203\305\340.j\222{\037\347\360\030L\006"
+	.ascii	"\313Y$\026\203\303`1\030L\216\242\313\202\363\272Nj\300\341\341"
+	.ascii	"\344\373\214\320\357i\243\337\203F\277G\214~\217\027\375c.[\334"
+	.ascii	"\256\336\316n\376\361\026<\244\027\306\356K\332\315\347p\007"
+	.ascii	"\225<+\021\306L\013\023`\222\033fP\351\252\2027\233$^\302#\264"
+	.ascii	"\346\360\022\t1]t.\222\367\310\344m\256L\331\21345)]M\246\244"
+	.ascii	"9Ic\322\205G2\315\315k\223\274swL\r\031=\360J$\341\342\274z<"
+	.ascii	"ib\3464\246\353\013WW\332\233\031^\302OrJ.\232\023\225$W\214"
+	.ascii	"t\235q\351\321\225F\005\t\223\272\253d\0326OfX\212t\301e\001"
+	.ascii	"\273nZ\276\222\033\206\340(\f\003\037\327J`\272\222Lc\304K\263"
+	.ascii	"\306DR\016G\222\246\273\344\034\232\262(8/;\322\246,\351\202"
+	.ascii	"\013\223\343\246U\tK\246\341!w\355\266\355\032pbf\234I\251q\206"
+	.ascii	"\273\260\017\214\206\337p\024,\005{a(x\r\367\3008\360\n\270\b"
+	.ascii	"n\202\315\360\027\336\201\317p\031&\303H\314\206\267\360\022"
+	.ascii	"\374\004\033\301i\370\007\006\303H0\021\354\206k` x\n\246\202"
+	.ascii	"\263`%X\007\316\201\217\3408,\004\037q\033N\202\271\260\023\f"
+	.ascii	"\207\3050\017\034\206\325\260\025\\\0053\301Z0\026<\206\203\340"
+	.ascii	"\033\370\n\266a\221x\b\246"
+	.string	"q\234\205\265\322\2509\021\303J\327\235K\302H^80:\222G<\344\"o\031>v\221Pf%y\217I\252t\335\261\377\246Aa\202\227\206`\24647\315\312\221\233\346\266\311K\006e\300L\266\036\3076\247\336W\031\344\370E\306u\3631gM\306\022\025D\314\267\233\253(^\\+\3700\341\220S\270\206\230Wl\n\033,\246\204\320\365|\301\252\001\025\244lae\303\n\262\007\244\013\334\225.$7\037u\244\244\270\260\272l\331\215\263\002\305\324\363QbyIReI\217\236\361\006\013\257\212\b\017S\213\002tP5n\276E\366v\224[KZ\340\320\2729G\216\236\216\034\032|\231\001\262\302\235\216-=$1\\\214\305\331\260\321\273a\315\334"
+	.ascii	"\273\272!\246\303\325\242\356\212\023-\255\336\026\035\007^\350"
+	.ascii	"\306Lm\231(\304h\211\202\243L\206\214\036\215%::\032X$r\224\225"
+	.ascii	"\351a\365f\3503T\316\224yC\343\365\005\367\325\242E\017\306-"
+	.ascii	",\355\315\264\267\214\031\035\270\265\305\t\201\321{A\245\310"
+	.ascii	"\021M\357E\317\305\316\226+1\214 5\016!R-vXY\365X@\240\004\220"
+	.ascii	" m,J0j\316H\331q\363\r\200\245{)R\364T\330\251\251\275\257\266"
+	.ascii	"\261\314\004\270\264p\251\270\333W*2\364T"
+	.string	"\224pj\222@E\335|\003\244\350Q\365\250\312\255(\"k7$\276\030\251\272\371\032\256\364\244zR+\224\031!%\220(Kb7_\203\223^T/\252\334\302\201\022\025\344\214\027\"<z\334|\r=z'z'\326H%\275\260\216%j\212\334|\rZ\275\022\275\022\310\247d\026\222\242\t\213\233\257a\004\t\022\246\226\020\026\016\303F*yW\304\254\b\211\233_\2005=\247\236\223\020\\T\2176w\272L\025\023dn~\001\316zL=&S\353\302]\024\227\214\273#]h\332n~\001\252\304\334\244\023\3233\3660\261{_m\246\246-\003F\257L\324\215\272\273\375t\225\001\247\311\022\231Q\315{\306\367v\002@\370\023\035\003\207\211\"7\233y\2679\314$y\272\371&\033\263\315\177s\363C\f\22367?\003\2356\361\016\360\377\346\306PC\003\357\346\233kph\3411\344\346k\377\3044\323\230wK\224"
+	.string	"iq\263\211\306\274\303RKc\312\334\345\251\236\"*l\3548\363\377\006\303i\3051\335l\2321\353,\362TL\273\037{x\332H,\241r\3633\310\351\333S1S`O\3054\2237\313\37479aOF\304\335\374\fq\332\034s\223\314\177cm\240\300\242\345\346g\200\323\2779\367\337\350\224\331a\245\343\346g\230\242\237\241I\230\207)\267\354X"
+	.ascii	"\360\244\222M\\.\304n~\006\261/_R0\321\325y\365\324\352lH\271"
+	.ascii	"\371\031\210d\311bv\201\022\225\365vC\004\rM\230\311\345f\027"
+	.ascii	"\363\r)c\214\271\005G\314nH\233\271\305\214\213:\262\324v\245"
+	.ascii	"3c\316-\313\324RV9\201\"Sw\36334U\251b^\351\300X\334\21434\340"
+	.ascii	"n^Q\363\n\213r\263i\305\326\2351\231A\346\343\377\315\217\223"
+	.ascii	"\321\307\315\377 \315\223?1\337\254\317\221)\216LW\356\"eL\223"
+	.ascii	")7\337\360\2162\242\244\264a\023ev\263\031\245G\210\324\326\224"
+	.ascii	"\233\377\301\234\t\305\2361\235\370p\013\213ss+\267\220i\254"
+	.ascii	"\352\356\254\327\036\033s\363?H[[3\331L-0Vu&\221\030P\244\260"
+	.ascii	"\225\345\200\241\362:r\363?8*Qb\246\241`\3378\243\333\225&7\323"
+	.ascii	"p\230`!\313\273\331\\b2\301Qsq\374\301\304Ds\322\346\3054\203"
+	.ascii	"'F\231 H\314\263;%\325\365\342\356f\323\354:\305X\342\265\242"
+	.ascii	"\354\377M\251uF\214Z\220\262\262rk\004=W\352d\334\270\371\037"
+	.ascii	"l\205\205\231\310%Z7\300\356\252\246\202\214\335D\366XyY1DL\343"
+	.ascii	"0\256`\023;2\251\362\352\201\244d\nC{\242\344f$\231M\212\036"
+	.ascii	"R\210\334\374\017\250\214\030I\202B\343\345\205i\330\251E\275"
+	.ascii	"\201\201\231ZZ_R\311;m\006\352\312\351\346\023@\311\220!\246"
+	.ascii	"\027\030\224\031!:Nd\362\240\020\271\351\225\335\2404Qq\263\271"
+	.ascii	"BFs\306.\231\343OV\260\025\261r\363\t\340\302\fb\006\211;!\225"
+	.ascii	"\314ASqd\307\315'\200\221\213\313\374\241\304\206&\211\351\336"
+	.ascii	"jlu\335\374q\303\303\356N\207\217\0348\027U_|\364(\277\254@\321"
+	.ascii	"c\207\311\243h\356H\224\233\357A\235\336\201i\3407\036R\314"
+	.string	"\210\311\221\203\001LyW^8QT`'\254\334\270QnY\237#\023\027\034]F [\344n\276\007m5^\243\334\022\322\373H\331\214$\031\252\032$n\276\007G\262\262L\255\013nYm\302\356\264\3045\271\273\251u\363#\210\026\324\315\367@\307\213\027&V\n\246\272\b\321\306\246\262\0253nb\231,\326h\305\220\361\377&\307\f\023\021\034\246\f3\206\020:0;\272\354 \245\322\220\200\221\263\304\275q1\273\371\036\304h\321\242\003Um\302J\035fZ~\334|\017\240\252\252L\026VP^\326F\230\222\212\263\272\311\202\207\013\232,RV\230_\336\262\352V\250\310\262\343\t\251\251\324|\275\231)\362\023\273\0320\222\334\374\016\272\230'\314\023\346\324\b\240\272x\335\234\300\202\205\213)us\252\207\206\022\032m&\n\0356kJ\240L\024f\324\016$J\266\324\302\230\370\210aB\345%\345RY\013\343\315\357"
+	.string	"\211I\302$a\226\b\001\025w\305\003f\f\234\013\363\351f\t\2340NK\314\224\374\277\341y\023\243\332r\363;\220a:\231NN\240\264\2700U\310\3003q\363\007\300\306d2\231\312\2556PHd\364|Y\001\345\345\346\017\340\212i4\215='Pa*\226\232\fy\272\371\003\020\242\346j\312<;\266\245N"
+	.string	"\005\206\307\346K\013L\233\227y*\235\22076\271\355\211\r\216M\211g#\207\330U\026\263\"\f\306\232|d\307j\004\230\222\233?"
+	.ascii	"\253\273\273\336\024\024\221\244W/\314\331\222\326\315\347@\356"
+	.ascii	"\314\231r+g\nj\0058\2578\2460+\326\352\352r\200@\0059\303s\007"
+	.ascii	"\246K\307\315\347 \b\0312%\235\020\226\321\316\254\202\002RE"
+	.ascii	"\007\211\032-G\312\274\244\263+\303\022\226\374\177c\302I\341"
+	.ascii	"\251\271y\306M\02731"
+	.string	"\314n>\007Nss\345\226\020\226\361\214y\007\345\303\352\016\273\250+\321u\3637x\322\245K)\027\004\005\212\213\356n\207\n\bX\2220/\345l\335N\233\223.u`v\342\354\326\252\300|i\343\304\004\025\f\363\255\t\030-^\262\325M\232\"Rkn\376\006>\266l)\267\314+(\035U\306\210Q\245\271\371\033\230\320\242\305\005\224\r(;WnY\336n\276\006I*TJ,j\240l@\321\261\021f\205%W^bA\301\222\"+\334|\273\022\356\377\315\r\021\023e\254\300Y\261(\300n\250\345\250\377\307\275\341\232\234\334\\\005\2639n\0353v0\232\334|\r\224L\231bV\201\322\232\302d\266|\311\335|\rTD\211\262!+\013n\214\n;\247\233\257\001\211'O@\320\312\273\262\260T\243\353\346\013\200\t\033[\351\266\001\2465m7\310\2272Q\332^\272\345\034bV\310\331:\023Un2n\276"
+	.ascii	"`4iR\252m`Bs\307\242\214\005\217\264\227j\330\212\216 d7\337"
+	.ascii	"\356:\375\277\311H\202\\\331\270\371\001\210CC\003\343v"
+	.ascii	"\306Jo\231\261f\345\346\007`\205%KR\244\240\2533\247\020\251"
+	.ascii	"\303\272\371\001\220R\242\004\20482m<aic\344\270\224\225\225"
+	.ascii	"[BXXNk\214\f{\306\212\331\006C\"c\254u\021\2623'\307c\206\016"
+	.ascii	"$HJ1;\266\24580uy\363\332\373*C\271B\025[\331\361\245\230\315"
+	.ascii	"\313RV\345\346\333\345\023\377ot\202d9\231\271\371\031\\\225"
+	.ascii	"G\216\224[vlKY%)\302d\230\300\0139\0267\037\003\273\"El\231\020"
+	.ascii	"\226\221N\003$A\272\274\225jH\026?n>\006g\372/\211 K\"\345\327"
+	.ascii	"\035\333F\036\037mYpw&\216?\2227\227^#\240\002v\3631\370\322"
+	.ascii	"\307@K\377\345\220r\b\336\"4\266\253T\270\223J\366\234IY\242"
+	.ascii	"\322\177"
+	.string	"\371\343\026Y\376(\203d\300\332):\210\202EW\225\206D\326\327\315%\220\036\217&P\2227\037\203\255\177A\030\375\227<J\036\245\017k\304\252\356\216\013\212)Zn.{|\t\321\002\273\371\027T\321\277`\211\376K..[f\307\266\024\016\211\024E\302\356\366\226b\200\314\206L\227\0347\377\202\032\372\345\r[\346@\2269l\231\3206\226\351 =<<9:9:DC\"\022\022\361\307\201\321:L\325$\2375\035\026\245\302\323\003QX\302\232\016\2134P\244\223\016S\234\237\222\272\236\200\252J\305!\212\001\360DU\234\007\207\210F\303\324\3673BR\211F\303\"$\242\232\204\242>`*<=\340\201bz\341\301\241\342\3210U\327\"\021\nT\022\376\206)\221ZT\"\302 \024*\r\207\304ao\365\241*\244E\023\004Q\r\256\304a\317\350D\205\031U\225\222r\022\322\017-\236\277\241\272\026sL\320"
+	.string	"\007:T\240\002+ZD\325\233\007\207V\365T\362\241\252\322\252\236J>E\234\013+z\264\263\246\303\"\035\265\003\017\005\326t\230Z(\246\3023]\323a\n$\256J!\374"
+	.string	"QU\351\204bj\341\301!\022\320\365\374\245\300a\332\243\212(!DJ\002p\030\002\272\236\300Tx~\020Z\201iR\257\270\246\303\242\337\357\344\301\321"
+	.ascii	"\252*]8\341h\230\026;\240\242!R\023\212\251\2055\035\026\351"
+	.ascii	"\254\351\260\210\204\342\r1]\323a\221\316\203C(R\272\2128\205"
+	.ascii	"(\260|pH\t)UBJ{\017\016%\025\221z\276\244\"\022QR\021\251\350"
+	.ascii	"\204\244\"\322\316\203C\251\360G\224\n\177k:,J\205\277\336\203"
+	.ascii	"CD\250\321Y\024\246\247\221J\024B\005R\315\007\207\212IG\027"
+	.ascii	"\222\216z\017\016\021\001\213E\250\252\264\236\250\221\317\203"
+	.ascii	"C\033\254\351\260(\035\026\335<8T4\"\246BF9k:$\246\253\212\026"
+	.ascii	"\207E\026`\220\363\340\320o(\242x\022\021S\002\254\3510\365\025"
+	.ascii	"\215\326"
+	.string	"\323\350\314Y\323a\221\316\203CCbzr\360\373\235\030\036\034\"\252\"\216\210\252\210\243\013\017\016\251\350\212\"\021\325\"*\374\211\020a\350!\025\236\"\254\350\tD\365\364 \364\340\020*\364p\256\276\020\353\007\001\b=\234(\204X?\350<8\244\242H\351\212\363\340\220\b\025]\327\323C\316\203CH\347\317GDL3X\323a\021\360\247\352\230\200\n=\234\303\n \201H\352\001\206\260\242\305\237\007\207\212)\024\317\225\350g\264\246\303\242b\n\305\023\205\237Q\216\017EJ\327\241\222J\3643Z\317\265\210\263\006uX\207\250\252*\375~\326\240\325\302\203CGJ\036P \021P\230*y@\201D\023n\320\365\\O\310Y\323a\232\037\224\302\357\364\220D$b\240XD\177D5\251\347\277TE\207\350\221\276\002\026p\200\0054 D\017h]\177\324\235\342O\b\024Bp`\230>8t\022\025Ubq\210\026;"
+	.string	"q\212\300)\372\b\205D5\247WDQ\365\b\035!\370[\323$\235u\210\"\r\217Ra\bA\250\252$LO\243\035\013\353\203C\305\013V\365\\O8\032\246\277\fv\326\242P\251\203\212\256CT\004\035\023\240\252\221\005\342\007\025-\372\200(\222z\016\225|\251\272\376\254fq\247\264\260>8\024\202\350\201\350(\311\002`\321:D\207'\222\212&\345\024}(@L\207iR\320\352+\232\200\"\245\253^Ut\375\235\352\031\374\371V\"\321\003\252\372\024y\326\007\207\210\210\351j!\205\342i\302\220\230\256\277\241\222\221\016\352[Ub\207\nR\234\244\"R1\351\350g=U\240\322\351\301WAqU\211I9*\004}\350z\002\223\224|A\3023U\321\"\320\352K"
+	.string	"\207\365\301!\242\243\244\nN"
+	.string	"\236J&\330)\356\034\235(\024\177\345\biR\361&X<\205F\026\326\023\200P_\361\350\024\222\200\n=\234\305t\204\363\302\203CDGI\030xN\244\021\320\242\222yt\242\260st\242\260\376P!zBR\032\374\355"
+	.string	"\321u\375\241+:\002P=\177\026N$\340\216\020\035\016\317\240\b'\022\020\007\365\241@\242\t@\365\374\001\213:\017\016\t \004\321C\n\277S\350\301\207\230\256\247\352K\352\241\277\364\003\n4\177\277\323\007T\211?T\305A\201D\244\\\364\351\250\020\364\2018E\360\250\020\364\371\250\020\f\376V\342p}p\b\230&\t\221`\213>#`\232dv\260Ev\004\013L\223\360:L\211\035\222\224\200\303\364\003\030r@\234 P:\001\230&\361\fS\023\326\020\200i\222\017\372\001\025\366\254?\324\310\bhU\321\244\020\250o\025\246\253oHT!U\211A!\024H4A\304\232~8\325\022\322ux\366\240P\3010=KP\211\353\251\242\0278"
+	.string	"\342\024\361#D\177\277\020\320\365Ty\200G>@!1XDSb\322\212\026\205P\244t\305\021q\nQ`\316\005t=U\037Pq\210&!\021E"
+	.string	"\246\035\326\323\303\007\240!1]Q"
+	.string	"\252'\b\225H\002\020E\215\202@\234\"|=8*\004}\t(\026\317$\020D\341\217\b\025\375@\374\241\252\217\207g-\022\211\036\202V\"\017\232$b\365Is\216\206\247P1\rqb\030\246\347\321O\021\311\007<\321\340\231\002\221(\364\251\3500=\325\325GT\177\247\005\303\364<\362\371Q\211\252\212b02\"\256J?_\321\303i\001M\022\261\372\022\240\242\25305\262\240B\3207LU\b\372B\234H>$\025]\201>\243$\241o(\002x\001\005\022M\350\200\002\006k\212\224b"
+	.string	"\025\036\rC\3000L\317\022~V\264\210r@E\217\216R\025\005\020D\2410\004\021\202\277\241\322)\f\200\017-*Y\bq\nQ\325\007\342\024\341\003\242\353\251\036\241\3530\2750$\246\353\251B\252\236\3500\305\300ZTR\203+P9L\317#\034\3647<?"
+	.string	"O\3370E\362\001w,\230\353P\211\370\363\t\205\350\317\347#\256J'\006\337:D\323\342\360TW!\024\351\314@R\316\203CE!Q]\207\304\237\357\247\022\375\2140\030\201\203\017\b\242\220'x\224\006{\200\034\204\247\272*\241\303\033\037\220\003pxz"
+	.string	"\236(\020\b\004Q\230\023<J\203> \2075EJ\205:@\016@\264\330\263\263>8\264*%\255JD\037\022\210$\242\242\212~HU\240\006\253\257W<:Q \246\346\007t\004t=9\240#$\376\210+Q\355\3403$\246E\025\3750,B\002\361\203\004\242\003\020\375\rE\024\207\035@\213J<kQU\242"
+	.ascii	"ZT\332\021\241\256(\022*DQX\211\301\342"
+	.string	"\bhQ\351\347\003\n\304\250\222\360\364\300\212\026\215\2144\200\n\201E\302sM\217R`\005\303\024)\007\025\256+Q\r\256!N\244\234\325\267\200\r\3530U\322\300\341\211\204D\374\rS$\234u\250D\024\001\025\022;\360<8D\264\006\217R!"
+	.string	"vP \321\004\025\r\221\"\335\b\211D\n\370J ZT\321\017\250\352+\2028E"
+	.string	"\255C\364\247\242I>\225\270\022\221|I\251\320(X<\325\037\206\007\2070\234\230\204\252D+\221\250\022\345\024}\" \241kQD\221'\004\n\034\026\001\323\244\236\017\351\372;\177P \021\311w\244\344\001\005\342\024\177\351ZL\327s-\372R(\236kO\360\267\246 N(\022;,"
+	.ascii	"\025\246FD\265\003\272\236jP\n?\242\360\247\242\037\210>\245"
+	.ascii	"\244\337\016\212\224\242\200\376N\265\204\243a\212\244\2060\324"
+	.ascii	"\200\212\202 &U\240\236\301_V\321\324(]\207(\260\b\250\236D\017"
+	.ascii	"=*\004M@\213A\023\210\252JG\251\321\220\370\303Y}\rX\207\251"
+	.ascii	"R\357\0336\210\240A\0072P\202\376\r\255\3510%\372\031\021\r\323"
+	.ascii	"\023\211\350\247\026\211\206.\240\353\311\001T\205\024)]\223"
+	.ascii	"4\240\242B% \032\374\025\203\376\367\332\334\356\016\026s3\330"
+	.ascii	"J\265\362\t\232\021\307\032\026'U\206d\335|$"
+	.string	"\001c\212U\032\212\034\2551#\213&_=B\346j \231\304\330y\253\241\344\rM\216\247\310\021\0221\3162\331\305\032\303sZR\346\355\3541;\272\314J\354\034\333|\311)Y3\331T\201\341\224d\312\314\026\220\2622*e\224\026<\312\310X\364\200\224\261bB\346\272\214\026ec\304\230\211\325c\204\f\236\234\330\217+\243N\315\335Q\214\007m\304Y\035\022\257\034\026wl`\302\232|\034Y\241\345\b\262F\025\033\027#\345\211\341\326\213\035E\322\024P\266#\206{\250\003\302$rLWR\312Q\205\314\020\221\210\266I\007c\026@@`D\"\217\226U\265\007\023\300\003\215+\305q$'\235\243\221$Ij\fc\373(\273(UK7\2238HF\261Egsm1\346\263\004\322m\3606\033\363/\366:\r\240\\\224\024D\002T\336%\177\367\373!\001\212\200\210\307%\005\007\312H\201\\\321]\234\207\2507"
+	.string	"\0200e\2526&\326L\241T\247(\364\013\305\r%\320i\325n#\253\371s\335\222]\244\003\361\007\365\271\317L*\027Sp\266>f\232\304\013\023\031\266\024\230|\204m\204L\203'\243q\313N\340\004\016\266:\264Nt\3007\247e\234\220\317\027\204\311\330\274v;s\035CL\203E\025\254R\353\330\315\354"
+	.ascii	"\035\213\3555\030|<\274\303|\364\273\340k\253\272.|\232\307\307"
+	.ascii	"\b\0246\210\266\233\324\257j;'B\260\361\312\035\203\246a\f\331"
+	.ascii	"\324\245f\344\254\\\222\376\304\b/\304I\234\005\372\024\001w"
+	.ascii	"\223\340\023?md\351K\224\260\2011W\020\215M\223\f\315[\0240]"
+	.ascii	"\232\331\032+1\310uED\371\206nB\373\324\206a\257\323\216#\004"
+	.ascii	"\376U\300sogb\374\307\302\271\367\200ey\017t\315\262y\033\375"
+	.ascii	"\357+{l\021\260>6\366\002-\303\304\363\007\017W\034\254I\256"
+	.ascii	"z&w\357\031\214\312\376\273\203 \t\264\3474X\253\366\021g>$4"
+	.ascii	"\257Izoo\362\315m\n\215b\207\260\310\023U\254-b\321zwA\246f\261"
+	.ascii	"y\303F\346\016\343\032\t=\2034\005O\254\262#7\373E\263\223\344"
+	.ascii	"K0\214\nH\324$/5\234 \244\223T\322:e\224\235\216\n\277\312\341"
+	.ascii	"\203Q;'>\223th\021k\342\006\305\351\211\256\2006\2352\306\303"
+	.ascii	"\315\251e\243\323\262\273O\362hR9d*\252\320\"\346\365\225\241"
+	.ascii	"\204\306\353\003\242\007q}w\272i\037\251\315\243x\366\332\331"
+	.ascii	"\2542z\374\362(\375A\0135\347\346dp\254\363\034o\253HT\322\301"
+	.ascii	"\310\322\312\0364a\270.)j\262\330\025\037\206$\270\363\020{\032"
+	.ascii	"\340\\\307\340\203\252\311f\277Ht\036\004P\337\241\215t\206\253"
+	.ascii	"3>\235\336C\345\262\212\302*\2148\235\037\2265P\314/d\361\007"
+	.ascii	"_\276\204\340\352\034\373\341\004\317rs\275\341\300Hj(Ke\245"
+	.ascii	"a\277\215\341\257p\354%\365.\204\261\212\362<\211\035`\033\346"
+	.ascii	"u\027J\276\335\204\245\330]\fux\027\246K\0018\006?}D\241v@*\226"
+	.ascii	"C=\276,\020r[h\246\016\007\300<Jy\377\366;\241\214\342\016\261"
+	.ascii	"\326IQ&4\244\224u"
+	.string	"8\3054%\b\226w!\312Q\247\007\013\002,\222\323\346A\236N\206\225\304\354\315\371T\r\317G\312\371\300\323\n\306\020\201\215N\007\206(C\310\304\247\346p\2142\221Hy\330\300\030\367\300\270\302+c\210|\222\335\3154\265^::4\255\327\006\354\217\232\3527\300v\242Y=$\3759q\246\237\217S\345\371Q\222\215\314:G\377\312\202\177\217\231\200\337,7\307\027\205\275\016N\273\265ZF\202\342\277\027>\352\315\206n\322\033[)\225\224\020\362W\226\210L\324]\226\353q(\255>\261\317G~\017f\"a\304\025\264W\033\024\216i\232u\222e\315|\3065\236s\334I\277\351t\320s\346\370\266\343\211\206\333\240!\354\007\257\340\252\350\217#Q\022\311\316\220 \316s\312\215d\225\\k\230Rj`\253\214\205X)\232*N\357+\367R7\216*\323\034g\242\276\350\377E\326\322\017i\314&\242\326k\331i:"
+	.string	"1\326\262\374TS "
+	.string	"a\027\215\315\024\351\246\030\273\357v\\\212\020\311\357\006}\322K\247\003jX\247\223d\216beh6\2105\004!\023\020b\235N3B0\031\345\301\252W^\212\344\240\027\006>\256{kY\257\257\355;e\016\2116"
+	.string	"\313\214>5\363\325\217\331\007`\327\021$k\256\372,\203e\345w=)\001\017\214~,\256UD\036\026\222\244\332q\"AV1-\365\207\202f\2670|6\332\035\374\3244\024%E\277\322i\204\016\216\251\263y\211\177\365\ri\304<\361\342\b\201H2\344\273,\316\271v\372\021\2704\315\033\200\253SZ1\331\367\352\250;v5C^]\020md\264\025\266Tyw\314\036K\327\322\261\177\304=\262a\201\327\236\"\300\246\366\307\020\030\316\233\003\f\256\376\346\206O\376\005}JAN5\225\347\270\030\224\313U-\320\200==\342\354\312\372%\256*\360C~Z)^\336\3400\"\265\333\312\214\230\273E\250\310\370\030\032\024\267I\036=\202 \355\r\004o\346\264\020\032\226M\020\t\223\316w\261\013\247\303\377\002'\311\001q\261\306L\334\246$8\036,\257\223\262\215)T\332"
+	.string	"5\031~\341:\027\320\3140\277\331I\032~v\235\333\337hM\242j\357\326rP\340\216C\016\254\273\341\233:'\304\374\036c\341\221g\214\260r\020^\207\231<\206\377\246\311\274g\244\333i\316\357\251eC 4@9\315\276uJT*\322n\217\210O\"\031\252\232\022_\253\233\210\320:\264\2533J\263\354\004\345N\017*\274\270$\031K\r"
+	.string	"@\b\004\353\007\335\035\251\230l\265_/\300"
+	.ascii	"\316\347\2559\263\242\007\346\211dR\260\020\271G\364\306\323"
+	.ascii	"\021*)\002\253\224s\232-&>\354\314\222\272\016\030K\361\006Z"
+	.ascii	"\247~\331)\034\334?\235\023\250\023L[\245\370\261\326a\264x3"
+	.ascii	"=uX\033\376N\235\231X\240\336\016$(py\376\311\202Diz\331\336"
+	.ascii	"\374t\033\334\241\212l\230\312\001\n\267"
+	.string	":\0048\233\367\357\221\b"
+	.string	"yz\343\336\350=\0356\271\365;\321\323\f\030\356\231`\353\231\036a\323Q9\347\317<\f\215\222\374a\020\260\022\217M+\217\271`\363e41J\241\301?\317i\307F\317\013\245U\034*\226l\242@\217\226\002_\250\212'\305\305O\343\013\227\261\370\345D \236\021\033R`g\2252\t{\372\251\354\346?4\257\347\264?g\275,\322\342\311>D"
+	.string	""
+	.string	"9\255\362\217|\236tZ\201\004\005.\317\377e)\213\317\225\f\251au\326\036V\226\327o%\257\357D\320\034`F5O"
+	.string	"Q\350(\320\371\340\023\267K\323\354)\277'\263|\3362\222{?\f\326[\270\234\n\240i\342\203\346\270$\277\2146\037\b<\217\337\177\022%-\034wmHnO\2623\302?e\177Z\203\221\231&\367\177\363\362\217\276\231V\231\033\274\320\314\212\304\377&}\356O\353L2\217C\211\317\036\026\202n\350\036\351\311$\350\024\221\323\007\256V\031fZ\3335[bZ\363\335\325\265\361\241w\351\025\326\266\314\360%\021KH\210\236\b\032\237\345\340\007\\A\250\230k\3644\200fL\216\211\321\025\t\027}\241'\234\t\"U4\016\330EMI\316.~\310\204~U\200s\337\322\265i\314e\355\f\332k^\004v4\032\307\221\332\b'l?\006c\301I\017\212Z\377\216\025C\366\025P\312f\3036\226\021l\324qv\237\205\314\270\361\355\237\377I\311)\013\002\332\210/\341\330\362\274\251\3000\032\271uM\t #\346\177"
+	.string	"0>@\221OY\255\345\224\250\313\"\3168\315n\036C\202\343\035r\343;\177^\022\303M;V@H\352\373\350 Iy\211\004\330\033R\200L\345\217\333\324\350W\007$\221\257e\007\266"
+	.string	"\003\361\031(\232;!\252h\007\344nE\222\265\250s\357\377\315\233\t\007IMA\264\344\232\364U\221\214*\251\353h'Xt\217U\371*\353.\273?\255\365\003\354\277\254\235R<t["
+	.string	"a\312T\301\225\330\264\026\207i;\367\370b\340\034\t$\361\276*\003\317\203y\236\353\020\213\206D\201\332WsT&A\216b;\254\016\315[W\205/\263\321\307a\222\031\272\204\277\323\307\212\226\203\030\354\225\204\243>\261rY{hp\021\232un_W\322\245\3336\340\377SO\252\225?R\370\251\331t\216\237\217\nB\311OJ,\330\\D%H\351\215C*a\210Y\001\317lT\236c\302fI._\205@,O\305`)Sa\275"
+	.string	"8\031\023\225\333\272ZF\214\312\b\213\236\242\265\370\350\203&\202L\334!{\263\272\300\255\247\022\031/w{\f\367\005\361\244\330\t\027\215\001\224\253\200\260\370y8\240\026\257\214\213t\003e4j\341\353\277<a\333#!L\307uu\352Is8\245\036\260\211h\200\252\032\275.W\303Iq-VJ:\346\306\373\201,\311\201\035\031\002? i\212v\200F\215\f=8\325\264:\217\2623O\312\210-nk+N\272D\364\362\351z\344Mc\3224\327t'\020\026\263|\321c.5X(\333\271=\037D\272\343\362[\334i\236en@\264\323\035\214\245\004[\304\023\222Y\004\227\270\346\332\376\246\007'C\231\n\024\020\352\316K\216"
+	.string	"\264(g\305\247\206\031O\327_@\237@\027V\264\346\327\367~\324l\235/bGQ\253\033e\266iI\037\272\020-T\340Qg\223)\331\rQ{\231|/\200\246\020\277B\325\2652\375\340@u\202\260qH\265h\n\257F\210\260\307#\231Po\0305\355\007\312\t\372\307D\375\250\254B\356\316\322\324\222Y\360\265\351"
+	.string	"\266\374\367\200cq\r\370!\3502\323\206\364\fx\353\374\313\033N\255\026\315s\024\354\375\373Af:\2438K\2338\337\376\375\356V\207\207r\251T\246<\366:?u\2469\307\336\t\340O\316%[\217\345"
+	.string	"4\261\335\t\026!!u-\254M\264\304-\206\251\250V\310\006\207\2773\306\277,\353\370\021\220)\372\335\032Y\353\254.\340_\342\266\032\371\251 \032\265BA'\243\266\n\305\205\251V\027\016\230\r\206~Z\242o\253z\224\211e!z`6\372\250e\241\254\222\300%k\303\024)s\300\250\345(\245\306\\\177\033.\376=\362.;\032\274\202\230\352n\217r[\204C\271"
+	.string	"\341!\003)o\210\377\372k\272\341Y\353\351q,\273\373\013\244\257\200\240NU\241!\220}3%\300\370{\004\332\243\0037\336\364\354\310:\306\322\022\031O\024Zbo\320e\316U9I\203!\374\313\264nU/(_\245\006\354\205\013e\341Z\303\373HGoP_Y?\271\240\006*\223N\276\006\254\035x\277K\230\033\342$A"
+	.string	"\234@+\363<\272 Z\t\351\250T\210\257\007\377\203d8\024\302\310\232\202V\303\350\222"
+	.string	",\347'jA\211\\,\007\266\030p\013\244\302b\226\233\211=\366\253Oo`\210\215\233\230SEH\253\250h\200W&\rx\370k\206\202F{\241\336\tI\373 \027\021\007\204\347J\260\217t\341$\344\003\255Eo\276\343\330\200\233\251\220\304\226\013\262\003\335X\034\324\376\027<\2547$\312\321\f\377\220\234h\247\211\b\330aO\301Jt\353\026\367\034QrL\026\255yw\0211\374<\267\260\216\353\027x\367\267\026\330"
+	.ascii	"\254\257G\254\007\220/\253\267\331\001\210,\237\247\006T%A\350"
+	.ascii	"\261#\007j\227\244\270\330\256\257O\276\247K\254Z\025\016\322"
+	.ascii	"g\223\304\326J\213\326,|\343\367\325z\273\342&;\242\277\201r"
+	.ascii	"\017.\372\257\202n<\271X!\356\202X\342y\\7\177<\271\273w\265"
+	.ascii	"\250?\303\367X\363\336\243o\2711V\376\003X\372\033\346f\231\353"
+	.ascii	"\321\374\330\376\240\246{0Nk\372vf\032\227a\342<\253\277\265"
+	.ascii	"z]\302\361Ta\317\3137|uR\230)\235\177\b/pF\250\177u\335\007\254"
+	.ascii	"Y\244\350\235\320m\324\263\236\207'\273\365zj\332\313\205}\243"
+	.ascii	"j3z\230\"\260E\351\247\235\017\020\357\0252\213\250\336?\374"
+	.ascii	"_\257\303\313fOy\362\255\016\327\251\255V\244\227\361\027(\356"
+	.ascii	"c\347q'\267\213~<o\262\0278n]\001"
+	.text
+	.section	.gnu.lto_.symtab.21766d59f9e1f6ec,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"serialPinConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"flashConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"sdcardConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"vtxTableInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"afatfs_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"sdcard_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"sdcardInsertionDetectInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"flashfsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"flashInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"sensorsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"initBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.21766d59f9e1f6ec,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2377 @@
+	.file	"rc.c"
+	.section	.gnu.lto_.profile.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.text
+	.section	.gnu.lto_.icf.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\372\004\r\026"
+	.string	"6\231bI\320Tm:R\227Z\021\343\226\rW\007\261xgY\226\013\202S3\353\007\365C{+\250\243\2416M\220L\341\006Wx\301\001\3650J=\214RA|%A\336J\202\301\323k\337\264\233\bw\236\232\b\331\273\335D\310Nr\007F"
+	.string	"Q"
+	.string	"P"
+	.string	"\337\355\275{7q\213ghF\327]\353~\271\367\275\226Q\343\022\303\331M\273\035N,\023\031\376}\277\177{\355\3313\354\365\327\353\303>Y\314\\\027\265j\251\352\346#\264\223\342\357\323\323o\230\207\211\325C!P\254\025;\037\004\004"
+	.ascii	"\240\222\202\177\361\357\375}\370\360\371\331\336F\270trV2%\224"
+	.ascii	"\232\005\261\316\"&i\204[' C'\345\205q\270\301\221!\251w\"I\017"
+	.ascii	"\212Q\30437At\302\355\006\220\352'\327W\223\367K\033\003\211"
+	.ascii	"\216\022\"\360\373\336\242_0@(\032\007\r\030,P\320o\320\336\332"
+	.ascii	"\227\225\354\261a\354\022!?,\t\312\223/\337\3170\233\020>p\020"
+	.ascii	"\034(\237A\223K\325\230N\003\365\333U\035\201i)`\311\334Y<x\361"
+	.ascii	"c_\274]\301B9>F\b\320\256\307\210\037A\003(~A\005\264|\376H\244"
+	.ascii	"D\320h\240\232\213\022\03452\230x0Zr\264\300\220\362~xW\020y"
+	.ascii	"Y]X\371\335\301b\303d\341\230\n\0326C*`\\\312\205\207\030\n\023"
+	.ascii	"$\\\245\322+\312\333$\275Oz\316\037\275G\266\236\374~Cw\2028"
+	.ascii	"\361<\310\317c\366\"\200\253\250\36151\221\031),h\032\003p\202"
+	.ascii	")\252\252m\021 M\203\254\031M\222\f\233\001)\230\303\\\204\027"
+	.ascii	"\022W\262<T\343\336\241\3122y\200\"]Q%\255\232\206l\3513j\267"
+	.ascii	"\346\240\347\335h\231\261\006!0\313\335\026\004)A$\231\275\007"
+	.ascii	"\321q\031\216\326\370\321^\277\320\260\324U\222\"\234Cl\217\233"
+	.ascii	"\033]M\327Y\323R\331\210\322\307n\026T!*\360\357~\250_\013\316"
+	.ascii	"\225\003\276a\370\352<v;\327w\271\037\346\366\277\260o\272\276"
+	.ascii	"\342c\347K\372\236L\2773Q\241~'\362\224\211\355\2321N\345\227"
+	.ascii	"\331\376\r\255E{\227\241\222\250\f\366\334\037\325-h\360\236"
+	.ascii	"\321\363\273\253\202K%F\204\017\257DN\271\276\310\0336\006\334"
+	.ascii	"=/\333\274\377\222\005\324\376\373O\346y\3323\3305 ~\344\227"
+	.ascii	"\263\220{M\354HL^p`\247\377\310\317\342\250\200t\366\237\"\316"
+	.ascii	"\032]\254\361\032a\001\265\347\353\323S\251\016G\256\307\004"
+	.ascii	"\36764\220\005\0347\364\236\234\307w\r\267Iy?\206\314\374\207"
+	.ascii	"\232A\016t\"\322\347I\021b0w$\377\246\322\337\255Q\363\222\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\r\005"
+	.ascii	"\002\207\022\026p\331r\374\375\377\177K\270\354U\221\247\037"
+	.ascii	"\225\"\247W\331R\246\024\316\314\304\314\313\226+\223\262\023"
+	.ascii	"%\221!\36319\266\341/c/\244z{\212y0\024F\330\201\324\331\350"
+	.ascii	"\275@\003\003v\364\365\273\022\232\036}g\232\023\341\232( \260"
+	.ascii	"\202\261\272mo\004\017tY&P\0349\271\260\314\317\2542+\226ATR"
+	.ascii	"\353`\335Q.\002~\013\336c\305\t\336\200\341?\263\024\003\312"
+	.ascii	"6\177\003\207\361\347<\036W\032\f\337\347d^\315A\023\030{\331"
+	.ascii	"\314\037\246E\\\342\r\332d!Il$\032\030\002"
+	.text
+	.section	.gnu.lto_.inline.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`G\t\375\""
+	.string	"\346p\244H\260XQ\032\003\301\300\202e\276\320)r\355.*\031a\251.\264Z\031\316\2644a\342b\234^@\235\241\262\374\374\331Ca\302`\237\r\304)\375!\375\341\002{>\026*\223\256}\005H(c\234.[\264\362m\333[\356\024\214"
+	.string	"\215"
+	.string	"\215"
+	.string	"[[P}i=\210\215\"\203G\306\006\340\360oV\016\221\264\025\341$i\033b\227M)\025\260h;B\266\226 &\022\022\n\026\265a\343F\002-\272n\243\250(m\201\345h\352\225\271\315\177\266ry\245\251Wf6\005Z\036\221oH'\212\31074{\206\213u\307Z+\016\335\347\217\315[\263\317\036\236\023\242\323\305\271\257\270\265\326\312\372\237\351\224Dj\005\317\352o\260R\3768+\367g\260\362\371\004\332\"%-F\036\374\202_\030\002U\234\370b,\365\002q&@p@\267\332\346\327-\320@\315\364\246\346\334.{\267\301\320\304\267~\333Jy\223'|\260lKB\322'P\225]`\334H\245\344\t\214\316\316c\254\262B["
+	.ascii	"l\216\033\345O\263\2739i\374\232v\360\324\246\223\321o\210\204"
+	.ascii	"c[\377\331\244\027T8\346\273\262\3763\213\200 \301\261ze}u\263"
+	.ascii	"\022\235\221\222\347\234\223\363\346\320)}i\370\206o\350a\243"
+	.ascii	"tD5\221\357,.\260\3261\366\356\274>1\344.\300\371\212\212\351"
+	.ascii	"\bJm\007\272\327\213Kg\353[\270\260)c4F\307\215a\335g2\0351\231"
+	.ascii	"Z\275a}=\354\024\243\337\223\234\322:\315QJ}\346|\351\326\227"
+	.ascii	"\312:\355\241\264\347\346\233\252\233f~MJ6\0174\177S\214\200"
+	.ascii	"t\220\375|\346J\232;\240\351\335\\O\346\265)\211H\333\216\370"
+	.ascii	"W\322\334\005\234\313\023=v=\203\246\024/\210\357\251m\262F\037"
+	.ascii	"\300\322\tA\316V\304t\271\233.zd\302\274\246\235\342i\312\212"
+	.ascii	"\024ic\017\013)i9\342\232\347_\r\013K\252U\310\365NnVUU\201\341"
+	.ascii	"\302\253\"\244B\320\\B\202\244\002\347"
+	.string	"\f\213A^\020Y\026\306\215\037\026\006\226'C[\344\303\222\021\372\301DBMA\276\262,\215\271\201\333\037A\266\004u\236\360\362\r\2325\262,\241\261\275\335K\027^\221\364\035!Xk\035\260\333\245Z+l\b%\026\275\354!8\334\003\3347\354\334\316M\337\220\215 K\266\2703V\020-\265^\331\013\013)]!LGP\001^7\3050\035A\021\0200M\235\327\306y-8g\257\200\327\250\021=\305L\r\215H\222\222$\255\001p\002\031\232\032\353\001\022`T%\307\263L935RP\224$\225i7 \316\001\213\332[%\305\362x\213\354\221\243\327\201\234\n\355Z-\347\217\023\216\224\232\272\261\235\237bs\330\254\375\3604X\264D\341mWU3${\317\306\257Z\252f\201\367B\354\364\271\035\324\036\275\026\031\035b6U\325\033\2104\240\321\241\r\005d\300\212.6\\\020\331I`\213\202\231\003\237\231"
+	.string	"\373\021\357\262\301\217\265\245\224\263\314Q\340d\tH\343\310\213\222M\247\037K\261\036\"61\261%(#1\230\031\270\354\361\300\225\201\235\364f\363@W\261 A\350\251\004+N{g\213F\034 l\375\316\226n\332d\332#\0347\330\016\347\323\271\340\001\355\b\223F\022\002F\202\232\260x\213J\356:\211d\252\013W\347\177oD\235\370\213\3213qD\370/\0073\356g\261I\256b\372+\024\353\301\267\237\336,34\325\263\327\001\031bZ\230\244\341\264\252z\310\230\251\377\375\203H3\b\331\330sIi\210\031\027\357\274^\rp\265D\f\277\316\210\017gX2l\"Vw(\326\207\263\272\202\003\255\203/\027Nz\366\204\227\214\315\217\311\2446$\340\332]"
+	.string	"\332p#\340\360\262\257\343<kEt9ku\345,y\206nG3\321\375g\252u\215\001x\303[\315=A0\224g\024P{\f\240;\\\033Z\032W\350\354\350\310"
+	.ascii	"\205\316\374\022\247b\215\350`\r\\m:\360U\306\220gA7t|Y\270\306"
+	.ascii	"F*\254\266\342\237\345\021u8\357jp\004\262\225\3442\305-\023"
+	.ascii	"\032\321\300\032r\037L\212\021\264\201\314]=\034\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`|\003\365\013"
+	.string	"2\016./\200K\322\0013\020\362 \3423\203H/E\261\030\325\374\rl\340\0301B\332vh\213Z\006D\332\342\372\223:\341b?\332"
+	.ascii	"k\355)wJ)m)\332\211V\"\343\205\210\036Z\207\266\301\036\376\033"
+	.ascii	"bd\314\223\321\3318\2337\235\027\031\206\214\237\307\311\261"
+	.ascii	"\276\320\221%\371\306\212KW\307Ph\245\366d\t,Zh\020\373\303\224"
+	.ascii	"\367\336\323,[\263\356\346\355\347U\365\336\031\346\202\320J"
+	.ascii	"[@0\320\004\332\200\350\211y\266\007\240\220\203\234\263c\375"
+	.ascii	"\"v\3557\234\323\260\374\227\211\344\235<)\366%P6\215S\215\223"
+	.ascii	"\333&\256\366T6\252\037<-O\203g\204m\325J\321\"Z\250qE5\2451"
+	.ascii	"J\2455`\002\221rH\017\022\2401Z\n\204A)\235\023\n\222\202\202"
+	.ascii	"\224\332\331\f\227>8\211\325\313\257\201\177\036\r\313M\\K\302"
+	.ascii	"9\215w\271\375\264\314\204\310\312\311\361\321\b\375\352\350"
+	.ascii	"\355\201dP\001\246B\373\234\033y\r\212\271\323\023\304\022\325"
+	.ascii	"\373\264\203\322I\023\200\245\232Y\016Z\356T\226\216\031\335"
+	.ascii	"\376?p\235\334xd\326Qj|\325\350\013-\225\f\376\233[\252\330\217"
+	.ascii	"\224;\304Z%w~\323@\347R\034\251^&\323,A\031\331\253\204\356\345"
+	.ascii	"\207\362\203\313\004\037T\215\307\216\312?\004\3502\002\363\276"
+	.ascii	"\207'wd\300W\253@@\225\241Hsn\330\324S\177\317\032aW@\225se"
+	.text
+	.section	.gnu.lto_.pureconst.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375 _\215\002"
+	.string	"\362E\023\032p/\244\003\374\353`\274\372?\377\357\311\276\375\367\251\217c\277\f}\034\322y\007S\263e&\346^\256eV.\3454\271\222\033\231\220\357\3619\276\306\306\330\026\367L\305LL\304<\\\303V\270\204\323\340\023\234\036\005F\200Q\235\252\332\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`p\002\305\013"
+	.string	"\266\2213.`m2\0340\030tQ\005ES\360\021\322\033D\006\260\2019Q\217\224X\350\215\255H\374jDW\300\021\304u\311f\264\211&\372\267-e\n%"
+	.string	"'"
+	.string	")"
+	.string	"[\355\230r\203\350IJ\224@\342\351\304*\217\350\264\224C\360\217\264\316\207\316\226\267\375\241\016\324\201^\273r\343\b\244\332+X\312\004\204\003>V\346\334\nnE\347\245\374\222\351\244\350\244\224S\n\360K@8\360\277\337\023\355p\2779\003\345\225\3037|\314\313\252\221\2152\374\347\217\364&'\320\241>\363i\222\332\227\207\013\357\234\3441w. d\336\251\362\253\254\002_\255FV\236=5\031\3543:\251NN\347\246|\323\031\225G\235\030\027\235\026\345Y5\235`\336\302\312\261+K\250!I\204\021)iI9m@\002b\020\302\363\021\260\215\202\216\r)\243\260\240T\254\033\331\t\r\326K4\265\245\nP\275\240d\241J\033\363\206\264\323W\306\317S\034V\321\272\255\243\037\252\032\"\244\037\307\324\tGQ\024$\006\r\310u \006jP\263\016\355\307"
+	.ascii	"hC'\026\226Cg+Lm\235\020f>\335\215\273Ac\002L\257\255\257\304"
+	.ascii	"\250\ns\230u6\215H\177V\365a\r\021\b?\342Y\241\335\203\337\334"
+	.ascii	"\374B\211>\211\276'\3149R\300lz=\357\226\322\363\027\347\360"
+	.ascii	"\347\005?\271\t\252\327\247+:\320\003"
+	.text
+	.section	.gnu.lto_.lto.56625491ce8ba9b8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getSetpointRate.67.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230\365\020\033ES\352"
+	.string	"o\241^\201&\240"
+	.string	"D\003\351S\271\320\276\035C5jh\350i\235\3120\f\004FW\003\244\030+\235\244\276Ed\357-S\n\037\017D\347\365\342\\Y\274\022\342\202\247\243\020\257\354\0239\232b\f\bYl\300\260,fP\367\273#9\267\0219\211\b\2034u\371oP{\370\303\241.\031\366\001\224\336\fk\220\303\250D\271jQ\241t\030\255\337\035\251\315\254\363\311\316g\225\234\b\244\374\024\253\226\233@\325F[\255\315\264u\372T\222b\376\013\323\310\377\202\016\\\f\333\326&shm\352\2414JF)M\204\260\374\217\033\007X\206\317\032\313\320eXsj\265;\374T,V\266Q\310\tp\360\277\271\215*\\g\202\266\"\001\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflection.68.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655P\215\322\001dV\321$\224\024\364\302\233\020\367\315f\306\001X n\330E\241\264\177\032'\306\260\004\177CH\252\252\312\250k\306\215a\313p\336zcd\357-S\n\037\017D\347\365\342\\Y\274\022\342\202\247\243\020\257\354\0239\232b\f\bYl\300\260,fP\367\273#9\267\0219\211\b\2074u\371oP\177\030\304\241.\031\366\001\224\336\fk\220\303\250D\331\322\242B\3510Z\277;R\233Y\347\223\235\317Z\245\b\230\374\024-,G\201\252\215\266Z\233i\353\364\251%\305\374\027&\222\377\005\035\270\030\266\255M\356\320\332\324Ci\224\254\3021!\262\372\0377\016\260\f\2375\226\241\313\260\346\324j{\370\255X\234l\243\220\023\340\340\177s\033U\270\316\004mG\002\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.69.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\235\007"
+	.string	"\362\21644`m\322\001\300I\247c\206\336\357^\306\237\200\007\021\033p\267q\276\033.\370f\275^S\007\324\371]:\245A\220\261\301\276\363\233\366?@\003k\333\366\3362\245\240\317\203\347\265\352TW\254\020\242\302\307\223\020\253\013\024;\233Z\013\007Wd\260\254+j\266\373\335\231\234\343\214\\\004\204?\212\302\374/\250;\354\321P\237\f\353\020Jg\206u\310eHF\231j7Q:\213\326\357\316\324f\326Y\263\363]J'\001\251\177\"\265r\023H\222\321\026k5m\235\326Z\322\314_\241\215\374'\250"
+	.string	"\306\260m\255\341\r\254E\275\r\343d\024M\002D\345\177\344\030\300b\370\274\261\030\272\013cN\2546\207_\nEHF\0229/\006\377\233\031\251\344:\017\264\025\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.70.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375 \360\205\006"
+	.string	"\242\214-3Pm\222\016$\223\203\210\204\252\244\225T\206\257)\3466>\334\201\345\250\027\313\326\336\024Z\301\215\240X\210\252\252\210\0328\303\363@z\376\375\320\032id\313\024S\030\312z\324\301S@(Hx\224\305\3600\226\253\005\003\3535T\225\365*Y\266u\260]4\355\341\333\321l\320\365\354\360\007\213\325\335?R\0356\312\204\006C\237e\260U|\243l\235/\216m\342\210\004\220dF\204N2\304\201`\374\327W\256F7\256\007E\331\205\247#\037\020\036&\231\371.\005\220\352\242Z\244\272f\321\253x\335r4\312\340\224`\233Lq\"\310\314\021\333H\364\326\177\340\027\370)\002\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.74.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\335\006\225&"
+	.string	"\332D\b\017J\220\232Q:\004\361\226\225m\177\020\214\031k\341\373\362.\205\375\2745\007\206<\225\204b\343\003I\030z\036\321\266\356\344\323\323\263\376\275\266=c;\257"
+	.string	"\210\023p\235\314yw-\254\215\212lj/+\213X\263\204\020B\210\334I\006\335"
+	.string	"\306"
+	.string	"\336"
+	.string	".vL}HY0\313\236\204\257\3052%.\202P\301\r\351M\373\253g\261\f\213\2136\340\354\006e\324\230\322\200\204\213i\214\244\235\325+\007\362\336\353\340&W\350*\027\345\354\006\177M\020\354\220\213P\274\030\357\275B\274\340\366G`\260z\357\023\321x/P\210\177\322\233\314\314'\362\"G\314\305r(\224\272\327\f\244\2533\367\336\233\355\264\363fy\235\363f\377\370\321e15EO\263l{\304G+"
+	.string	"U5\261\352\242\245\024\3432\237\247\245\034\217\305d@AjB\363\264\324t\025GZ6p\232b\343Y\222\230J\032\226\036`n\274\017UR\223E\263$\345@\262\347\215\233\253\f[\332x\343(\001K\333\275\367Y\267A\245\237\265h\205{/[\032JKg\2333\363\221\231\217\230\317\033@\033\226\341OtB\302{\357\004\346\022wr\"\275\367F\350z\201\"H(\265\342\274i[(\352\370\343\271V\360\245x\307\263\247\301;o\276\325\247\253!L>\233d\036\376lC1\277\274\367^n\037\314A\337:'\260\226\201~|l\b^\365\037\270\222s\317\207\277\201\037\371\013\034\311\231\347X\347\332\207\347\001\326\362\216\265L\263\226\005X\313:\250\345"
+	.string	"\247\345\034kyf-\003\260\226q\254\345\033\324\262\315iYf-\307\254e\325ZN\255e\324Z>\255e\323Z.Q\313}Z\266\246\345+\2105\301\302\240xo\215d\232{\305<\002\371\326\257\344G\362c\275d>\177\311\215\3142f\361\"\017}\335{\211[\001\265\016By\216\227\356\301\027\356[rZ\266D\0342\353\237Z\017\350Y\337)\312\312J\365;m\r\240}\332^\255N?\233\374bR\346J\212\323"
+	.string	"\272\273nik\034\223)\252\270N\375\314\206\342k]\235bBl\004\315\2455\320\003:\310\314If5\033Z\254\252"
+	.ascii	"m\330M\333\372TV*\233\276i\024lE\312\332\246\217\264\306g\223"
+	.ascii	"Tt\022r\2372\364%\353g](K\026\232c\031\353\264\021\264\365Z\235"
+	.ascii	"\324\216uO\327J\305\305[\265{\324\254S=\215v\332\004\300\f\364"
+	.ascii	"\331h\227[g\327\250\034\350\003m\366\235\b\273\254T\277\342{"
+	.ascii	"|\251\032^\246\220L\222\001\336\353\003*\273\247-\330J\365\263"
+	.ascii	"I\356.\273\006\266\"mw_\353f\032\241\025\2445\366\336\033\243"
+	.ascii	"u\247m\021V^\002lb\250\310\204\021nw#\342\355v\274\034\201\036"
+	.ascii	"\317(\207#\321\323\251X\321\201\247\242\205\316\314\365N\235"
+	.ascii	"\021\216\203.E\t\"\234Z$\302\302\r\211\021D\270\335\216w!\327"
+	.ascii	"\213\025\235h\201+97\224\353\335r$nD'p\273[\256Wt\033\322a\236"
+	.ascii	"\n]\357f\304\343\365n\262\241\357\345m\037|\342U)\2560\261\240"
+	.ascii	"N\301u\344\374i\036\236\024\331\225\204\006\351\353\237\254\241"
+	.ascii	"8\304\252\3564\b.\351\215WyD\031\216\001\202\002%\350\237\016"
+	.ascii	"j\017Qf\200\022\004\035\211V]\260\244\304\032\212\233\030\021"
+	.ascii	"\"T\333\0073[ Z\367\334\bb5\005h\303.\fC\032\323\206\302\302"
+	.ascii	"\271\361\226\351\206\224\216/Zh;m\202\thZ_\247\005\364\003\264"
+	.ascii	"N\363\224Y\221>\233\344\234\016\320'\036\3031J\f\322\032\037"
+	.ascii	"\312\203\313\311\364\351\024L\326\224\266\016~\250a0\004\021"
+	.ascii	"B\206\231\022\031\221\2440\205t\220\002\03112z\021@)e\210\210"
+	.ascii	"\266\244(\351\332m\224\025\372%\205\345[uE\013\031\370ld\t\311"
+	.ascii	"\351\247\271N\245\235\267\203\326K\225\rb\245\340\361c\2421\200"
+	.ascii	"+L\022\240\017\3500Y\\\217\30651>\026a\203-\305\261|A\320\225"
+	.ascii	"[\177'I\026,\334E\2660l\206\323xDZ^\225\273\220\231o]\032\255"
+	.ascii	"Q}\027\270\030\262\361\261\364\276/\272\376\275,\034\017\217"
+	.ascii	"\246u\342YA\022\027\\\016\023\374)\006y\377I\034\313A\330\366"
+	.ascii	"\221\0270\342,\321\213i\336\302\210A\030\205O\213\236\261\323"
+	.ascii	"\035\326B\313\320\026\024\3351\240G\356\024\300+\357\367,\222"
+	.ascii	"\313\367zDp\231\260,\3765\b\252/\330\207t\263\311Ou\361sKD\250"
+	.ascii	"P\324\f\364HN\362\203\303\323.z{~\r24:\007k\267\346+M\361\245"
+	.ascii	"4\227L\0167\275\034\320f\320\266E\2403BD!\035[\374\250"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.75.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\357\002\265\024"
+	.string	"f&\206I\260\224U:\370\240\231\353\0042\262?|\253/\322\3118\251\336\2213\177\344f\322\204j\017\257\305\2230\3423\3429\244\334D\264\002I+=\177\320\271\322\217\275\005\313\363\334\336\227\213\303sC\271\360\352}\307\326\304\022B\244L)p"
+	.string	"b"
+	.string	"x"
+	.ascii	"A\243l\003\035T\332\210p\355\216z\220\346\234\t"
+	.string	">\332e\177\035D\326\004\241#\261@}\016\342\001Dh\316\311\342\003\327\373|\260i\316\0238\204\346\274a1\201\362\243m?\306e\340\354 \321\267\323\373Q\017'Xd\316\t\033\360\026\371Q<\n\371qW\034w\305\371\017^\204\321\302\007/\307\346Zr\231sZy9:\367\336\266\001\333\024\354\245\t<\031\362\343w\365\333\2214\"\247C\333g\243\253\302\27687\205\375\372\357W9\360N\271\357v\335\367\267\356\363\003P\365\211\252MT\315R\365jT\253T\235Ru\t\251F\215\352\223\252M\252.U]R5\251\352Q\325\"\251\336Q\255\242\372\001NFz \0202g\210\341\221i4\n]\034\370\3338?(!\355\300\037\263\347xpZ\005:DI\302\234i]\253\301rM\273@\273\022(\202\374|\021\206\303!\245-\367;\036r\305-\361\350\202n\275\2313W`\\rW\210\354^\264\266\265\343\n"
+	.ascii	"\332\361\350t\350]q_E;$\335\335\343$\311\351\320\302o\320\376"
+	.ascii	"\2633\347t`\303\334F\206r\316\311\240\206\207\032\204\235^"
+	.string	"\r\371Q\367?,\204\237q\0325~\3176\031}3\232X\205\231\006ZL\3144sAB\352\005CL\254V\263M\220\335N30\034b\242e-\262\033L\366\002\213\201\211\325`\262\333\f\254\005\305\266\r\263\033\214\306f\273\301P\276y\373\265*^\222QnuN\331\223}\355\221\230\354\311\212A\326\232\354\212\312\256\226\265dP\265\253%\207vH:h'\222}\350C\252m\240S\324#\314\231(S\233\262/rm\311\246\366\250-\331W\360\264\0016 \240\002\231\262\352\006a/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BBpOt\332H\274\215S}\220\007\021\3339\304\n{\206\025D\260\306\343"
+	.ascii	"\006\024~yL\355\"\003"
+	.text
+	.section	.gnu.lto_applyKissRates.76.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\334\005\275!"
+	.string	"F|\323K\240\024R:\224G\316\367\2376|\343\207\261\210VG\273\247\324\373\200\227\307\266y?\307\031\302\201\342a:\217n\376\371IB\275\273\034\fmO\036\301j1;\274\026\326o\003#\217? o\213\3038\265YX\377h\204\020B\266\224)\300"
+	.string	"\241"
+	.string	"\306"
+	.ascii	"\314\365\332V\221R\024\227\322\202\326\217<B\227\273\204\204"
+	.ascii	"c*\002\326\217\252\b\023\2705\351\245\274\367\026\340\363?\326"
+	.ascii	"\252\310t\271KA\022\b\272\370\343\217\260\257{\357\201\017\340"
+	.ascii	"\346\032!N\273\327\305\326\327\275\302\003\017\240\362\371\377"
+	.ascii	"<\203i\030\375G\263(E\344\244\215\244,)\367\336\034\017\317\240"
+	.ascii	"|\232\034\203\362ia\260\021\253)z\232\266\215\316\351\017\027"
+	.ascii	"\367X\221]\221u\rE\260\372\342\202\311\211\323$FW#\003\2402\341"
+	.ascii	"\324g\027g u\rQ\260y\033\nM\236{om\210\324\326$\260\"\354\304"
+	.ascii	"m\0304g\306^,a/\356\245!Rw\372s\357}+\r\231\3704\376\237\342"
+	.ascii	"\377\321\177V\005m\031$A\362\027\353 :\023\337\3635+\371P>\331"
+	.ascii	"\332\220F\314\234\216z\371\027\203l^\033\365\263y-\324\337\375"
+	.ascii	"\035\306\342\353p\2219\207\265\3708\335\277a+f\033\336\342\327"
+	.ascii	"p\rf\232\356\343\272?\323}\231\356\307\244}\030\264\377\322}"
+	.ascii	"\227\356\267t\377\326}[\367Y\272_\353\376J\367"
+	.string	"i\335W\273\237\246}\024\355\237\3357\323\276E\373}\366\231\24765f\340\306\275%\226S\256\330\211\214\301X\314Z\314[l\1776\236O\2160\016\366\372k\367\300]\247!\223R<\3745>\3737:g\361\215/\266}$A\266X\233u\26169\326\0257\333bo\312jn\026'\310:UcY\254\315\322\224\261X\224J\216\315\2615\3132\210d78\226\271\270\207*yE\246\005$x\332(\226:S~\231\307\377\335C\2639MUWa\302>k\035ec-\254\215\322\272\261\027\253bOVE\204\b\373\3544\373#\367\2125\231\254SA\325\322,\333\330\324\252\226Q\233Z\232\262\323\242`<^\262\343\037\234\224:\355\002\246\244\031\362\310/\224X\025\357\033,\227P\204\367\036\365\230\266\306v\216\225*\330\313[kZ\232\344\252lk-'U\371!p\017\036\003$\367^\005\177\006\346\021\244\336{\023\354"
+	.string	"\261!\001\022\"\021\312g\327\340\003\3240\244\353\345\204|\275\236og\003\304\353\360#z\260\373\251@\336\220N\002\0178\241\210C\213\004 0h\303\rx\301\201\r\b\203\220\256\327\363=\330\375V\200A\037t\346w>\273_n\007\224\023\n\322\365r\273\0370\347\023s\037\007\336/7\344\363\375r\265\342\021\233\327B\275\302\232\342,\205#(\316X\214R\342\374\221\315\304\240vvT%\230\322Lyd\203jj\241n>5U]\tAm\324+\254\346\212\245p\204\275\230\306\002\314\3307v\351\377r\310\223\230"
+	.string	"6r;5\021\237\256\212\234\341f,\3166\225\225J\307\342\330\031\313U\210NV\252`p\204\n\261&2V\307r\220\030\353be`l\214\325\311z\2610Dx\355C\307cm\fm\250a4\303\024bJ\325\214HA\223B\245\003\220\002\221\271\252\016\021@\251uhJ\242\242ja\r\272\271\305x\225\201'|\177;\250\317r\004;`\360\017\240\337\320\033\224\356\356w\273\274+\261L\272\233~{\232\212Q(@C{\002\210\336\262\321\264\373\330X\344p\304\335\272@\201\214\204\255\336\274\355\022\226\231}\244\353\227\202\346\207\315\347\027\3460\007\374\030<\301\332F\250\253\264\330\310&\231E\360.\263\022l\360gt\033\222\321"
+	.ascii	"\300\271\216\234k\177\375\177\213\r\240\345\027`\211\267\206"
+	.ascii	"G\367\205\321\023\351,M-\2470,\321\034$Y\224\364\213\274Ev\177"
+	.ascii	"\260t\211\007\341\250\3576\262\251X'\301\255\300(\346\274l\262"
+	.ascii	"\033\016\374\216\333\026\036\032\300 \307\007v\r\345ME\200\257"
+	.ascii	"\022\254\336\247\356\032\356y\371\351%\357\017"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.77.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\b\004M\034"
+	.string	"6\364\266G\240\234Mc\004\001\372\344\213~i\254\316\276\232\304#\311c[\"\351\303\204cn\034\250L\364:\244 \362\264\357n\313\276\225\004@\216hQ\236\246Q\322\235\034\257\002\361\277\202\202\315Y\267 \200\340M\310\336[n)S\n\230"
+	.string	"\224"
+	.string	"\254"
+	.ascii	"\301\027E\277\260\007\207z\224=s\214?y\002\017%\244%\367\336"
+	.ascii	"Y\f{vK\357\344\231m\240\205\245P\r\001\275--^\367\336\006\267"
+	.ascii	"VP\336\332>\265\277\344L\347\233|\345\330\275@\204S\356\275\016"
+	.ascii	"\214\240\274=\360\332x+>\300x\353\323&s`\322%\177X\210\244\316"
+	.ascii	"\334{\315:\344\347G+Vz\372wz\314g$\3641\307m\317I\006\025eF8"
+	.ascii	"^E\006HZp\330\030\361\304\232V\0201\217:-2\032\242\224\254p\357"
+	.ascii	"5\365\031\331\270\311\333\306\3316a\213fk\226\216v\302\363f\354"
+	.ascii	"\310\272\2460\034z\r\335\273K\360zS\037\3263\302\243\303\022"
+	.ascii	"\227bay\357\225\340Cy\024\036_\351\326'p\364>\334x\373z'_P\025"
+	.ascii	"\006V\265\243C\033\310\243\365g_\274U\210-R\327\016\274i\017"
+	.ascii	"\3368\237\272o\336\364\333\310\250g1j\231H\035\023"
+	.string	"\251K\221\232<\365XR[\222Z\034\251\253\245\246\"\365\t\030H\202\304\343\227\245r\001/\215\241\232\233e\253\212<\370O\375\300W\373\366\237\374&w2E\264\225\206By\033_\"Yi\265\254\246\2752<JeF\353G\255?\323\242N\217r(\351\240\322\005k\210\2421Yc\365\275\257\261\222\265^\365\274l\035\353\211\326p\271@\255\214\341Z\031\"d\265\320@\203]+\306[[\251\025\230\252-\307Z\261\241\003\275\257C\275\323E**R`\003(N\275\2516\325\265\322\352\216\217^\025\262\375\341Y@\224\367\016E\360\261\300\bQ*\261\030ok\2155\275\312\255\260\360\225,bgg\274\245\225\354\022\265t\204se\241\201$\253\021\344\327p\351\b\247\232azgnj\225\205\002\272\246\234\212\204\355v\033o\311\247F\221\003\204\"\310\2263}t\271\234\356V@\006TB\247\307\204\217-\227\323Y\270\375"
+	.ascii	"\340\t\262y\340Iq\302\307\026\003\302\271\260\211\276\345\334"
+	.ascii	"~\314[\217\351\203\263\345\314\333\017\220\231\023\300:\025<"
+	.ascii	"?f\220N\367c\316\200\273\213\267\n1\207\036Y\273\312\033gc\316"
+	.ascii	"#\020\222\302\\\314\211\344\\:\225\234J|_;:4\255\316\314\033"
+	.ascii	"A(\256 \326\216\016\177\">\244,[\177\026\361\245\2261\037W\200"
+	.ascii	"_\2044Vk\265\250\374\3114\312j\017\024\030\237\353]'\323\311"
+	.ascii	"D\207\336\2473\336\312\252\205\n\202\035\325\266,\244y!a\013"
+	.ascii	"\267;]\001O\n\212\353IP\250!0\306\230C\n\r\225(CAa\261\001\200"
+	.ascii	"\002\231\241[\017\020pv\2334\006_d\360\2609N\331Z\202\236\231"
+	.ascii	"`v\025\220\300\347\336)\233\324Iz\032\0235\347\212|\222\317("
+	.ascii	"\323'\206\264j\252(\302\232\n\375lU\234\0210\201\342\r\211\332"
+	.ascii	"\254\376\357\0363\032`\301C\177\366\222\232%\241V\305u\250\354"
+	.ascii	"\231N\250\210\034&N@|\374\366\305\336\037\262\005\276W\371\005"
+	.ascii	"\303\257\365o\341\300\312\275q\\\204\350*\234\340F\367\271\030"
+	.ascii	"u7\362\364m\2550S[\315\215\353\252\343\340\257`D\025\210~\016"
+	.ascii	"\263\b\rJT\246\006\244T"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.78.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\022\004\335\030"
+	.string	"\206.\235E\260\032Q:\270\232\247Q\302|\272\306\221\310L\024\003\233\253\215\342\324l\236\013\035\376\363\"\212s_\375\217U\036\272\271:O?|\220\356\004\376;A!\355s:\267\2436w\006U-\364Q\325B\177#\222H\231R\207"
+	.string	"u"
+	.string	"\222"
+	.ascii	"~Oji\212\2020F\024\2751q\267I:\236\373u\327\314|\256\375\013"
+	.ascii	"y\221Q:\207\256\232*\226\270\341\030\032p\372\372@\036\344\347"
+	.ascii	"9\207'\240\024,\233\225\034]b\214\005\276\016p\372\272\276\003"
+	.ascii	"~\277\257\300\257\177l.\327\325\210&\032-nFab\214/\245\361\237"
+	.ascii	"\177\232?\376\213>\203\013\002\372\267\342\372\271\236\354n\251"
+	.ascii	"\240\332\327\022z\301{\321\263D\020-\323\324 \306\350\304\005"
+	.ascii	"\251\270\367\266\035\330&`\177,\002\376\321\213T\360o\230\304"
+	.ascii	"\205\013\3407U\200\215\026\306p\243\f\247\030k\b\374!'\262\301"
+	.ascii	"\277\361u\314C\036\367\365=\200\337+*I\310\313\315\262g\353h"
+	.ascii	"\2513\354\1771\306h\025\262\237\273]\327\335\255M\363l\232\265"
+	.ascii	"\351\235M\353lz\265\351\234M\343lZ\265\351\233M\2476m\263\351"
+	.ascii	"\232M\243\3004\315\227\236\331\364i\323\246M\203`z7\375mZ\277"
+	.ascii	"t~\031\353R\335\261\244G\322,{\006\356\304a\253F\2141\201\317"
+	.ascii	"\344M D\220 \001\374\266Tw(\341%}6JD\030)\217\253Q{\202\rJkh"
+	.ascii	"\0245\2434\372[\231$$3\212\222\241\324#wR\037\351\241\303\021"
+	.ascii	"F2R\024\334\222*Mj\373\300\362\270\223\272j\nd\207?A\306\004"
+	.ascii	"\214h\006\275\036\230Z\214\263\036PMz\033\021-{^\0055\267\330"
+	.ascii	"\272\254\236\207\217\360V\346j\344)|\034\341\226.&F\257\210\352"
+	.ascii	"\214\324+\205!Xj)\306\001\0324\304d_\b\037\021j\330\001\230\354"
+	.ascii	"\005\263\360\342\200\301g\303\013&\373\360:\260r\254C\005\331"
+	.ascii	"\013D,&{\241t\263\177Q\205\374\300\313n\246"
+	.string	"4\177\252%K\016\031\325\217G\225\245:\312\243z\304\346\202\246R\226\232\242\330\210R\252\243\037\372qd#\332Q+\016u\252\274\350+#\334\322Lh\245;\n\202\241e\217\267\213\221U\213q\326\223\243+u\332\276\340\350\215\346\250*\331\206\\\252R\034**]`\243\245)\275\331\245\024%c\t\017\312\2458\004p%J\336J\340\003F\250Q,\346\024RH\261\241\244\260$-\264\030\240\002\021\2619;\02101c\214\211\220*I=\032\003\323i\223\324\250\344h\353?\317\264\375D\345\006\202\250q\r\034\236\253\201\275\277CO#\fL9\035L:\321\335\320)\003\\\016\266\323\215\365\217 8e\007\265\325\240\331W\321\252\220Kd9*\240\020\272\323\"\323Z\216R\005f\301\251\257\274\251g\304w\356+\207\320\352\274\n\226\322\262\203;{\"d\264Y\260Qk\272p\355\270\305\202p\"!\305\177\213\r\025~"
+	.ascii	",\byqF\345\344T\310\024\222\376\001"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.79.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\343\005m#"
+	.string	"*A\360\rE\220\234M:\204V\365-\356\206$Q$\016\020\002\347\250\221X\352\204\267m\311FHeHK\2656m\363y\"\276\025H\220\221\213}\205I\210\\\273h\325'2y\351\027\006r\352\177\337AH\255I#\322\244L)\310"
+	.string	"\266"
+	.string	"\321"
+	.ascii	"\277r,\317b\227\206\361+\256\021i\363d\316Y^\264a\330\345E=\225"
+	.ascii	"\013]V\371\027\357Vd\220TW$\026\262-\022\310\213H\264 \rrv!\201"
+	.ascii	"dbfsN\005\027\335\200T\265\337"
+	.string	"u)\274{\325\2608\247\220\262.s\006\031X\211\274(\364\242\361\242~h\274h\236]\366\340\221Y3\342e%\3043\347\314\255\221\363^\336ldm\024i\253<\2776\301\006\304\242z\231t\253M\030\242\003\310mi\256~p]\371P\222\226@Kl\307\323\\\001\241\025\241!\022\347\302'q]ei\255\307G\253\237\212<N\273a\361\370\006aU\321\220\346\234\027^q`\371Tk\023\346\234V \226\216\373\347\266\273l\253\260E\256\016\240H\363$F\273\204\223\036\270{\341K!y\272\3441\253Z*\023\001\355\263\234\026%I\030'w\256\234\031X\257\271\277\214\272S]d_\003{>V}z:t\315\315\231\306\002\373\275W\327\231_\024\237\016\355\240Ow\313>mn\021\246\007\357\245U+\255:\351Vn\003\367\372\013\254\372\250T\023(\325F\252\036@\252\005\250\272(HM\004\244\036\272\251\003\224j"
+	.string	"\245Z\350G\215Su\220\252\201~\324?\252.U}+\3256RM\336\3245R=\222j\361\246\246\331\324\253j%\325O\200\033\203&\302p\316\034\303=sL\004c\362\340o\3455\035\225f\337\016[\023\376\314L\\\016\0062\016nm`p\202\326\201\2232(Y5\005w\263v\342\3409\033w\313JK\332+\311cf\225\366hq"
+	.ascii	"m\271FZj\276\316\374\254\355\025o\203\341\300\2215g\223\341\205"
+	.ascii	"\006\r\243m\177V\024\376\314\224\233\346\300:\267-\367?-\337"
+	.ascii	"\231\217\371\213\224\303\0346^\274\355\022\222\246\2271\027\b"
+	.ascii	">\231\213m\2609t\320\003;\214\027m\013\344\204,\017XO\2074\221"
+	.ascii	"\334\244\3252V}zb\\\220`"
+	.string	"j\253aJ\033Wi\277\340\342\216\253e~}|\376\360/5\3109\347\003?,\006\bR\t\213\361\242\2706\257\336\275\034\214\205\257\304!D\350\201\027}\021\3735o\262z:\274\3169\251v\267\254\033w\277\344\013N\225\352\tN\321$\225b\312I\227k\021\245\323E=\035Im\300\235\200\202r\361\341D\013'\235.\252\302\323.\bj\312\311C\n)\250\035\n(\0173v@~jz\332\345\236P\344Z\250p\322\345\236vR\271\246!G\271\200\332\345\246\242\242v\2712\330\373\026\341@f\254\267\276\322\\\256\270\260\261\252\245\272))\201\265yRxS\364@#\231\313}7\200\214MK\030\016\313\252\346\354!0Z\002\373\037\327\2005\332\313\371\231\t\330\001{\n?\033!`qv\316\240x\031\214\215\034Ml\273e\246-\332\335\227\330\321\026\355\205\327 |\210\226ii\211\366Z~A\217\224\341O\317\227"
+	.string	"\265\306\310\335\362oa\034Z\023_o\354\n\247ca\304\320\234"
+	.string	"[#2\007J\026\200]2#\264\266\005\260\3775\301\255Pr\250a8\004\rC\246L$\030I\213\322\214\001\200\002\0311\263\016\020XV3%\351\304\344p\320Uc\352u|\2767\274~\246\f\205J\271\r\005\034[\365\r<\351+\037?\227\306\203\354~89\206\227D\227\325\212\025\033\310\032\357d\321\350xt\3122\020h\276\376Gr\253w\037\030\274\221\177\304\312(c3\006I}"
+	.ascii	"\234E\262\302AC(\302\256#\320\274\203a\005\024\350\263\231C\357"
+	.ascii	"\206@y\t\307\253\302)\001\255B*\366\376L\257?T^c\260\013\226"
+	.ascii	"\371!\214j\326\211hf\033Vj\332\n)l\2333\221\\\327K4%\241g2\205"
+	.ascii	"K\225F\322\205D\360tfM\335\030\315G\022\2154\302\216\263!\"Y"
+	.ascii	"\325\303\036\221\230\303\275\265\027\235\007,}\302QR'\247\316"
+	.ascii	"\344\003\270\377\342\221P\036/\375\251\217}\205\017Rm\024S\001"
+	.text
+	.section	.gnu.lto_processRcInterpolation.80.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`4\f\315="
+	.string	"Zi\020\027A@\242N\007\352\373\177\376\365\355\177\367\013~\256\305\205\035\352\330\377\262(\367\247d\236\032\310\330\310\313\370\346SR\"4\027\374\250\376\3018\246\023\026\340J"
+	.ascii	"\034#\022\021\021\305\215\226\032m\262\367N2\245a\001G\001`\001"
+	.ascii	"\275\026s\177\233\3335\020\325\245\321\232\306\261\216\352\237"
+	.ascii	"x\220\375k\342z\356s\356w\316\3465\177n\273\275\333\255\264\357"
+	.ascii	"5\262=\317\257\324p\275\016t\305\314\334-Y\222\320\211\343X\313"
+	.ascii	"u6j\365\356\032\355t\216\327\310\366:\267\253\341w4\334\270\213"
+	.ascii	"K6M<\340:\033\344F\255\263\331\211Zg}\016vc'\305)\022*\2358\276"
+	.ascii	"\263r\266\001\270\316v#PP\243a\277k\323\321N\347\220\351\361"
+	.ascii	"\211\343\273\345#A\352\325\327;\357\344\303\336\304\264\244\224"
+	.ascii	"\204tdT\344D4$\024\004\244L\276\310\243\321-\266\354\372\031"
+	.ascii	"n\247\3227\347y&\346Ms\3164W%/e9W\222z\222\034\236\222\214\324"
+	.ascii	"\304\217\230\270\021\223%\271\310\231M\334i]\222\256St\231h\350"
+	.ascii	"\315\205\336\334rP\233\003\255\005\324\314\360p5fm\253Q\032#"
+	.ascii	"r\034\217HV\256oa\034\020Wc\246\266&H\343+\364= 9Y\334:\2026"
+	.ascii	"\304_\25154!\216\024\022$\037\213[{^\225\344\311\032\332\020"
+	.ascii	"7\302\231\245e7\211\024\234\0314\027\333\fylqk\225\3032\347y"
+	.ascii	"\366\303W\033\307\263\261\326(I\340\233\363_\215\031\2255*\216"
+	.ascii	"c\307\363\\v\326\314\271\270\025\307q\347\347\031\232\367\223"
+	.ascii	"w\347\007\335m\241\373\330\026p\315\\\355\365\331\177A2*\263"
+	.ascii	"?8\2311\353;\236[\261\231\"\326y\361\336b\213n\234F\373\037\341"
+	.ascii	"_\320\251\326\364@\007C\243]I\203\b\021\242u\366?\311\266'\205"
+	.ascii	"2s\265\235\213\017\371\030\024\313\211\016\f\323\334\326\217"
+	.ascii	"\376\265\177\351\303u\n\375\374\214c\277\366.}\350fwj\235-s\022"
+	.ascii	"\307q\225\367u\367\341\332'&\216\305\\\255\017;?\343\033iN\342"
+	.ascii	"\"q\325\373\327cp,S}\311t\013\237\377h\217h\375M\344\301\031"
+	.ascii	"\313}\272[\204k\031\341\306\361\330\202v,\236\205D\273\022g\273"
+	.ascii	"\004W\366\247\263\355\\\317B\271\"\255c\346j\367]3\177\264\333"
+	.ascii	"s\031\035?\352\364\263uc\240\240\025\001\202\353yg-}\316\033"
+	.ascii	"\313\357\274\257\216\271\r\264\271\255\336\334\005\336\334Uo"
+	.ascii	"n\002\310\334T\310\334\003\220\271\247\220\271\005\264\271\003"
+	.ascii	"\034s\0038\346\226R\346\216R\346\206:\346~:\346vJ\346nzs3!s/"
+	.ascii	"\025s+\025s'\035s#%s\037\275\271\215\332\334Eon\2427\367\320"
+	.ascii	"\233[\350\315\035\364\346\006B\346V\"s'\221\271\33767\362\230"
+	.ascii	"\373h\314m4\346v\215\271\213n\356\266\230\233msH\237DHF\255\312"
+	.ascii	"F\337\r7\201\237\264\376<\372\250\261\027\353>\210F\357\3237"
+	.ascii	"\256\034t\003\004r\270-z_\313{3\226\373\350\211\203\351\212\250"
+	.ascii	"\240\230\221B\225\037\355\003Z^\n\317\3021Zy\326\227\255\336"
+	.ascii	"\201m\326\347C1\210uw\222\006<\353)|\013\325\022\306\251\326"
+	.ascii	"\314\325\374\022\375\235\366\203rc'\006\333\367\2643\364BO\364"
+	.ascii	"L\202N2\307\037z&C'\235\240\007z\241/&:\2354\351\314\231\001"
+	.ascii	"K\203\336\001\335\376\230\271\n\253\271a\373\271q\0347h\217\343"
+	.ascii	"r\340(\360\024X*m\235\005\372$ \030\351_\037\344G\255\\\371\016"
+	.ascii	"g\300\223\257|'\203f\375\373\311w'\265\231\253\215\374\367\235"
+	.ascii	"\214\312t\343o`\270\nL\007\323\265\316\"\337\367|\n0\020\317"
+	.ascii	"\361\370\355\204^\b\333\301\220 \341i\307\370\307_\363\220Q\335"
+	.ascii	"/\276\361\335)\247\306\327L\250p\341B\353\254\373F\350\325\027"
+	.ascii	"\337\315h\231\222Q\255\236\330\251\032i\264W\357\200\255\352"
+	.ascii	"\rf\ra\242\373\321\366<;\270\264Z\357gzX\b\357\206g\\\326\b\177"
+	.ascii	"\365e`m\373a.\350g\3002l\330\320:\333\376\003\372!\372)*\345"
+	.ascii	"n\016\035\262?\265\376\351O:\330|\261v>\177\377\342\006\333\217"
+	.ascii	"\206q\366!\274;\003+\274\276\276\270Rt\025\275^"
+	.string	"pyH\341\302+\f\205\227\007\031a\311\025^__\\)&\234\360z\301u\242\005\fewau\205-\273P,\277Tp\261Xv\205\271Xb\0215X\013\257\260\345\0130\260\260%\362\216\351\317\266|\345\216*\203\314o6\375\221\334\006\3331p\203\244\003\331\f<\020\240\241\267\036f\337\032\023\236\273x\252\207JY\315{E\312C|\371eV\217\"\257Y={\305\020\021\232g\311\361\224\241\032Q\3129\274\210\221M\016\025<|\222>\332\n\310\034ax#\020\247~)k\034\3071\322G\035n\261\036\303\267d\370\246GA\332\017\252-\003\361:>4\005\036\332~\003\332\362\217\252'\360\005\2765t\2525{\264\237\233yT\275\353\271\3751\241d\264|F\340\215W\b\235\2570.\315\210j\300SM\275\200\037\200\365S\001^@\326\021\340Y@6\210\320O\343+\204+\362.\214K\353\342\364l\r\333\265"
+	.string	">,\357\f\016"
+	.string	"od\203\206H\352\237Q/\365\325\252w\265P\037\365\356T{z(\302L\366\364F@AD\2503{\210\3713\344t\225m\344\261\246wb\372\246w\347\231\245g\372\244D'\035\245_z\247j\223^\351\335)\227\305\222\336\t\337@\205|\217\027=\201h\233 \244\257\302vZm\211N\205\221\270\301ooG\037\200\370\250\201$\007\221C\210hD$I\222Bk\240\002\221)\242\252\003\021 )d\220\021M\222v\003BhW\214\377\350lX\337\b\271Kp\376\230\004\326Pb9T\221\026m\344\3004\3369\224\213\272u\226\021"
+	.string	"\231L\202 \257\316\373\367"
+	.string	"\206\r\017j\007-H\033\347\fd\360x}\346\002)N0\021@~v\212\226B\3337\035\246\202\027\316\345y\312\013\t\023\360Sn\343\332\257 \210,\270\017\212zr\f\3466+(\304+-\353\206\264\301M,!l \373 \313\357\342\362\261\205\250\021\217\301\203\217<\217\371\373wb\217\374\227m<X\217\273\270$\2009YK\3477o\214o\272\255`o\254\r\f\224\001\007\006\334:\212K\330\214(5\211f\3255@0\236/\210\007#-`\237\224\237\264If\267\217\246"
+	.string	"\266\265\316\344\004\237\007\226\275]\313\322\276\221\206\364dY\023\017\322\256\301J\020\030\245\246\345\323n\266j>^\203\306\025\bs\314\326\031\325\241H\321j\231\3427\001F\263.\326\224\201\367\300^;\340\223\267\017\2517)\303\254zs\366\275\317\217"
+	.ascii	"\350gO6\211\276\371\207\220\202r\334x\022x\t/\321\265C.\301N"
+	.ascii	"j\335B\205\214E\202E\247\265\322U\311&\271\211\230\346\\N\215"
+	.ascii	"(oI\002\210\200\253)\263\342\r@\007&\274\251F\037\340\020\207"
+	.ascii	"P@\023\202 \316\312\215\317s9T\224\f\263j\226\365\311\036A\354"
+	.ascii	"A\235\302nGm\310\260\n\3169\022\032\340\231\247\327d\024!\251"
+	.ascii	"T./\355y\337\006f\225I=\202#\364B`\323\367\261{E\022z\307\264"
+	.ascii	"m}8\363\3111\034\213S\035\027\253W7\243@\323\344!\221c\252t\351"
+	.ascii	"\251\241\261\216R\253#Z\246\333k\350\031\247\252\367\371qsS1"
+	.ascii	"\252=\367\232{\2637\002\311\250\0305"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.81.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\335\f"
+	.string	"\266\230YC"
+	.string	"\2614\035;_2\240\3466VZ\374\272b\201\214c\374SF\201+\323\330\fM\320\246\301:l49\370\035\"D\264\202{\022B\257\204OZ\300\025\300,\037\023<\035so\274\3233\236Q\023\262\245L)F"
+	.string	"F"
+	.string	"A"
+	.ascii	"1\236]\003#\212\357/pTZ\330\330\335\353\300\007P\237\340?\250"
+	.ascii	"O\372r\357P\323\363"
+	.string	"\001|\241C\213t\205\005Xd\220\002|)0\301\315\t\234\227\236+\237(\263\362\354\256s\364\211\270\247\333~`\033\202}\013\001?|Z/\363\347\323\357\020 \335D\250\261\033\"\007\307\332L0V\330\366\354\016{\246\303=VD#\005\215\203\005\r\274G\017\217\006H\304\230\030\2731\304\f\236\227q\215;\273&\\\320\354n\210\021X\237l\3730\017\366\240\250\bRY\251j\252}\262\201\372\310\322\227\356\371\240!C\255\264\232T\325\251\222\003%sR\305\210\305F\325\305 O\035\361\002S\232\221\2227\354\030Ju\261\017W[\354\247\255\247\253\307\177\372L\334\326e\330\b\b\244\225d\350\266\3553a\353N0\001\n:\023\005U\320>$\024\264\017\306\215p\220\200A\003\346\341L$\343\256\354\302UB\202}\256\214\003]\"\037\336L4\356\352\266\215\273:\342^[\374\322;%X\200H\220[-\275\256h\023"
+	.ascii	"y\b8\323a6\0135\306^\203\320\334\213\370\242\216\343\246\027"
+	.ascii	"\226M\256\341\206\265\200I\023\n\250\003\367\366I!\250\320\n"
+	.ascii	"\24026\3254\rLA\001"
+	.text
+	.section	.gnu.lto_rcSmoothingRxRateValid.82.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\245\b"
+	.string	"F\221>7@\217\322\001\t\222h8u\210\037\r\356$6\035\375o\230\2342X\025\262\202\265z\033\214\332+\034W!!\224\300au\255\300\341\005#\306\021}\277]\264\204\020)S\n."
+	.string	"/"
+	.string	"*"
+	.string	"\266\023\024J6\335\353`a\\*T%\260]\017*\307MO\223\177\222k )&\253\326\351\211a\330]\347\252eq\353m\037\330^\260\375\n\337\n>X\032\276]\326\367\262+\332\313\303v\311\316\330\316\264/\362\221\322]Fq\300n\206\312\311\356\"\330"
+	.string	"\340\332\346\004\333\265\354\232\355\232\003[j\246W\205\b|\037\354\342\244\355\232z\n\214T~V\275^\025C\345g{\247\324\r\373\331\356\256U\303\331]\277j:5\035\335\310\323q\020u\361\323u&:#P\027\243\0047`\216\303E\310} \350\301\003\001\271(\202\034\215C\021]\204\243P(\302\214\267w\246\033\224\246\234\261\226\223\002\b"
+	.ascii	"2\003\302\260T\270\033\233\226t\031\245\250\361P\035\302\230"
+	.ascii	"\256I\006"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.83.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\007\016mA"
+	.string	"\352nP\030B@\244N\007\013$V\235\030\202\262\252A>\213^*\200\016\255\300+\274\217i\251\025\240"
+	.ascii	"`q\006\355P/x\277\003\366\002\325E\"Tx\250\337\3138\023I\223"
+	.ascii	"\335Q\"\250\250\326Kz\223\275w\222)\005x\001T\001t\001\016\246"
+	.ascii	"]\217LS\335\261\250\213'\306\n\227\233\367\026R\377x\030\307"
+	.ascii	"\353~\333\206\203i\244]\037+q\034\2776\272_g\337\273\370]\277"
+	.ascii	"^\334\016\366/7\334\261\350\022\372\244H\2368\216\031\270\316"
+	.ascii	">\255u\276\005v.bn\\\306}\212\221\346\211\343:\246\263]\300u"
+	.ascii	"\226({\356v:\317\002\373\024\207'\343X\311\2372q\\\207\325\002"
+	.ascii	"\\g\273\316\225\255\263\256\033\265\3166\334}\307\353\244\261"
+	.ascii	"\323!\362\264\373\023\307q\363\231\364\352k\235wQ\206\275\211"
+	.ascii	"iI)\ti\251<2*J\022\r\t!\217\257\261\350\022[v\375\f\267\023\273"
+	.ascii	"\212\320\2641obZ\237\326\370=\375/J\267:))R\365\270(\226\274"
+	.ascii	"D\347J\253U\0363}<.zeU\366\220\002\365\273\271\234d\305\221\340"
+	.ascii	"|\271.\375E\341V)<)Y\031%\037Y\201\222\215\326c\240\234\020\377"
+	.ascii	"\213>Y\021\260\345\005\262\345\242%>\234x\222hHZ$\013\021\273"
+	.ascii	"\220\304.$>\232\370\221\310_tH~\333\326'\250\277\250[6\376E\233"
+	.ascii	"\304E\205\344\242\236C\305E\237\360H{f\327\311\2348qU\376E\327"
+	.ascii	"V+76@\236\2715\246\005qV\315\327u\311\215\r\020\241\264\263U"
+	.ascii	"\nN\222:\236g\226_(\315\271>\305q\354w\236\321\322"
+	.string	"\312r&v\305q\334\031\232\346\303\033\200wgew7\350>J\003M\246\353\263\317\016z\032\202\3605\353\217P\243V\247\\}|\372\376\337\332\253\3757\321\205\320,\003\352\356\020\216\306\313\375g\001\251-\302\317\210\271q\034o\265S\341x\304\324 \024\034\255\263]\377\200|sS=w\266\3411\022w;8<Tc\026\307dQ\371\033|\036\343\214+\313\207\355\237\337\235y\334\214\357\221h\207\322%\276\262C\277Zg\375\3373\275\352\032Y>\354\256+\313\377\026\bNPJ\277\222n77\0077\367\0067\267\0067w\006dn\013\025(8\027\357.\237\272;\360/\336\r\266\334\334\t\336\334Znn\004o\356\003nn\003\304\334\005\334\334Md\356,cn\2547\367\225\233\233\351\346\2662\346\256rsS\021sO!s\023 \346\226:\346\036\320\346\216zs\013`sC\035s?\265\271\235\336\334\001\330\334"
+	.ascii	"\214\271\233\216\271\231\332\334Kmn\2457w\32217R\233{\331\346"
+	.ascii	"V\276\271\217\214\271\215\212\271\213\334\334I77\221\233{\210"
+	.ascii	"\230[\310\311x#\215\271\217o\356\367\315mts\027\335\334\2561"
+	.ascii	"7\261\230\273us\263\304\334+1\367\267\2713\233\333; \375\201"
+	.ascii	"\343\345'\216{\034\n\212\375\330=8'\343\316\305\375\213\177\267"
+	.ascii	"w\007\357v\b\247\331\t\340\211T\301"
+	.string	"\352\332PS6k\372\227\212\340\234\221\270j\331\307&\264\364Lp9\006s\273C\270\212\2631\344c\372$\245\245\244W\n\224\364\016\316\344 \247\362\362\221\344`*\331\241-f\244\375\017\030\227\024\352\303\375\300U\234O\032\307\361\002g\273\3419\357\003cq6\017\351\211Th\020\250\334\340\225\337\rky\220\035\272\374\247\263\037\353\243W\376\333q\346\341#v\364\\go\216\3776\350F\357zX\030\375K\305Mu\352J\343h\034\307U\3133U\277\261<(\357\375\267v\027m\321\373\022;\036\212\276\b\330fn\352y\201rk\306\344;\222+'\372\344\373sm\353\207\236\350\335i(\364C\357O\3039N\307\013\202\204\354P\t\255\263B\357z.\245\306\246\272\366ly\201S\212,\332\343\377\236\t.\310\342\230$C\350U\3256:\327ez\257-\323\221\217\326\336uc\336\201rle\210]\377\276\211.s"
+	.string	"\305\336\207\213B\347\226e\332\256k\006\013h:\236z\317t\r\217\326m\3748b.\222C\367hx\343\373\2353\251\324.\202w\206,Sf\337\375\342\267\347]\300\320:4\303\267?6 \016\217oez\361=\317\223\\\260l\341\023\307\215\006\367kjs\320\251\322\342\027\247\304w\337\237\206\036\332\366\211{e\034\274\215\207\366\335O+\374\303\211\234\"E\030\215\032\020N\264\b+\226\240Q\"\002\330\213\025*h\204\205\271\230\201\354\257\254/\031\315\257\024\315\027+J\270h~\311\230\321\3142\3520\030(d4i\204\205\311h\276ud^\365#\373\262&\0059\301\017X\315\354\307Z\353\023\374\2017}OC*9\277)S\205\327\372\034qZO\244\n\252N\367\370\266PY\322\312\3157\360\b\330\340\266'\347\217\365\201G"
+	.string	"'v\340\023\020\026x\003\357c`\"9\212W\201w7\204S\013\337\034s\350(\332\254\267\360\235\237ke\371\320\t|$\353\271\n\005Q\255y\253*a\275\t)\013,\270\244\345\206w<%\3239\\\375\022\016\177\205\365\326\247L\360\316\020\211\352\255\236\371\355x\033\212\330\336\234,\231\357x9IS\267\244}\314/V\275U\325\373so\352\251\276\005|\032\202\310F\274\246>\306Y\237"
+	.string	"t\252u\224\016\037i\t\374O\341\"\231\b|\204\300{^\223\243\177K\343Ro\002N\222\333\244\236-,\254\276e6'i\205\250\302\3029\243\177k\327s\346\234$\205\357\225\210\374\255Gkj\273\365~\307\335\327\242+\337z\n\357tk\356\234ne\3710'\241>\352\0070Q\003\363/@\340*\336\346\007u\300'\331\021\360Qi\002\336\357\364\200z\266N\2325\"f\006\360N\377\364\004\216\342\334\001\346v\203\031m0C\371\006\237>\251M\200w\312:\304\002\004\201\006\250a(%\025ejD$H\222$\031\326a\005\304\030\346 4\037\021"
+	.ascii	"\245T"
+	.string	"\016\325\220$)p=\003\002\261\274\233\252\253M\205}\306\023K\026g\357;\020F\n$'\230\2561\277\334)\003\210\026\354\225\rD\001\235\033%1\355\263\211\206\002/\243\342\333\357\216h\352\272i\216T\n|Q\265\360E\020\225\033<\207\004\227K\256\305\277\365\"\355\247\234\334\266\217\357\353\230\364|\313-\354i\246iIjY\364)\246aCb\033\311T\n\n\n\371\220\fl\302\035*zi\300\362\322\b\361\221!\212\217\327\327A\262F\300\245!\2451z=$\375r\236Tj@$\245\257L\266\205\031\030\214\274B2\327H\321\363&|\310O\264t\002g\037oq\037\367\002*lR\252\250\250\2111\251R\301\032x\207\255\246\306c\325.\256\252\371\343K\n\261\226\331\207C\363F\313\022b\230\326\363\374\221Y\277\320/\0375/rm%82\223\211\245V+\306\034\021/1\372\2400\202$Tb,\263\377\024"
+	.string	""
+	.string	"\226\025\366`\r\206\233yi\206\335\357\377H\371Aj[\223\244\216\035\221K\220\2509\352\f\212\273\245\2101\022\310uq\255uB\3603b;=\222\373}\344\245PT\022\r\210X\tt\203t"
+	.string	"\357\2772<\006 \205z\317\217\312?8\200H\\\364\360Hkk\234!39cH\375}\356\236"
+	.string	"\016\262\274.\223\333\013\240\206\220\240\276\237\020zH\022N"
+	.ascii	"\210\200\341\274\261\313\303T\345\3501\316\375\227#\2214\236"
+	.ascii	"e\244\230\327\333i\035@\365(\301\252r"
+	.ascii	"\007\231\001\002\343\037\360\243\320\205\254\025:\342\315\\\205"
+	.ascii	"\365\266\250\ryC-\310\234i\205J=G\206([\360\3763\326\b\034\206"
+	.ascii	"C\365\032D\b\352\235\017\034\206\f1-\224Dy\001\025GH\036dWp\364"
+	.ascii	"2G!4\347\252{\256\b\321d\006\367=\t\354\235[\231m?z\026\017{"
+	.ascii	"\350(`\025[e\211\200lE\247\006"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.84.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"}\n"
+	.string	"\346\222E; \261\322\001\247(\340R"
+	.string	"\270 ~\030\265\375?\023L\225\020\206\3172D\007JJ\206\355\307\\\362oA#S\241\0321\016"
+	.string	"\216V"
+	.string	"\261\260\017\374\n\033\024\344\270\375$\210\354\224\0020"
+	.string	"2"
+	.string	"8"
+	.string	".?\002\377}.\002\377\231\264k^\322\36649\0308sw\253\367q\362\224\364_r\020,\346:\365\034\354\256),\246q{\267M\262]\355O\004\247]\272\250\347a\277\263\273kof\377\366S\317cJ\323f\341\334\3158qV\367\311\200\204l\237\332\267\235\204\374\255\365\200\335\331\r\314nY\340\201\317\277*\320\026\337\242b\331\300\215\354\bn\257\276\342\031\025\220H\212\271\313\331\246$;\342(\316\t\320l\211\237P|v\327\300\244\302bD\253\375\363[\340\277\204\220\016\231\315|\321&\226\t\301!uz`\211\"j\005\340\260\024\2165l\250\251\223\tU\303qUK\"\213\020\fce\211\342XC\345\276\263\336\314\n\034\272\227wa\243\376\242r\251\311l\336y>\026"
+	.string	"2\241\267/0.\216V\227`\2736(\254\f\033Y\211\004\333\265Z\244\016\354"
+	.ascii	"|\267\252&\204\253.6c\354!=+\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.85.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\365\005\215!"
+	.string	"v>\324I\240\326Q:\305\370\004\247\270\342\035\221\037\241\025\336\261\350'M\350(h\364\"\234\3565\247\213)\037e\314\346o\277LEKjX;\376\026\216\007[\300\237\274\005!mH\267\217t\254\f\217F\2275\334\207u\315\022B\344N)\272"
+	.string	"\260"
+	.string	"\312"
+	.ascii	"\367\341\017\361\314\017r!M\277Zz\025\326\327-0Np"
+	.string	"\325Z\034\272\351\005\262\2334\372\037?v\270\017\357T\026\216Z\353\254\203=\273\271v\223=\263\275\305\363hz\017'KZ\005\256pa\244\326Z\300\006d7o%\245\366\255\276\243\351D\246\036Z\005\032A\030\251\265X\300@\262\233.\336v\336\224]\347\274i\333\007\0204\331\367b\325\210\330\226\t\250\037_\265\026q\333\342\276\237f\271\324\347;\375\\/YT\256\\IM\335,\007\f\235\224\260\221\n\2266)+\264|\240e\211\257\215\324Sy\253\265\336x\032%\005\2444VTk5\025J\221\270c\267\255\301v\221}*\b\345\236XL\210\273J\222\\\330E\367\273\373\340\360\211\2069\300\322-\261\202\\>\372\021#}\252\354\335\215d\220\325Z\023 !\360lU/\230\316\233_+\032X\206;\210?\032f\027\237\350\262\260_\326Z\253\227Jh\251\203N\344\006Z\352\333R\377\374\352\366y\217?\300\211?"
+	.ascii	"S\363,\365\316R\333d\324\265\223Z\347\244\316Yj\234\223\232v"
+	.ascii	"R\337,\265\315I]sR\323,\365\314\32431j\231\245\226\305\250cK"
+	.ascii	"}.\265\271\324\345I\275'5=\251?\364%\365\213\313\016Y\353\210"
+	.ascii	"015\212\211D\306\211\374W\307\272\375h\025\030\002\305\2144\233"
+	.ascii	"\275Y\001XA\256\237\265I\221\024"
+	.string	"v}\353\267\375\241\331\335\232}p\306li\266\347I\220Khg\r\276\264\226\b\273\302\302\202VhM\241L<\206p\030\305\\\026\246{\200&GR\004\255\335\311sg\243v\326\334\236\032-\214P\2004LY.\013Jk\255N\273T\366\2353K\243\303\250\005\244alWx\026\237\354\310c\341\331\026\230\350\2057gv\226\245$\207\314Z\251\022\2642\262\r\332\007\275\200V\226;\225)@{,0\304\330FY\202r\333\330\336\370\032\026\024\330\357\334\333>\350\305g\317\305\215\201\002\323\375\311\322\3078\271\227\317~\310\313\033YEr\020\315m\342$\023\002/\327\3342\031\034>\031}\211\223Y\0019\0134I\202\021o\027\301\210\227\3535\360\320\253\311)\345\030\034m\330aPBB\342%\325XG\244\353\341t\027p\033v9\036N\327K\302\021\351\030\211\203Q\017\247\204\204\324\303\315\212\277\227u\251|n\311"
+	.string	"\202,\257\365\033\357`\013\006\020\244\371\373N\236\215\262\315\263.\372\355\323i\353\0166\346\001\215\027C+\257\245\363G\347\036f\t\314\324\017\034^C\377\321F\377\342\244\027\031\033>\276\274~H\3334\350G\037\275\313\217\336\275+\203\255\312\307S!4T\f\255\276lkK8\227\2232\236\332\332\326|\002\005V\243:kO\240p^X\333\033p\235\234\263\264\325\331\007\233\340l\316\232[D/\027gcH\264\240\004\2077[\263\001f\250A(\007\221q\204!\031\032\005I\222d8\240\"\221\263\321\003\021\260\251\023\020\021\215\244(\205\354\006\303\360\331\216\214\241\320H\264\025\322\362<\220\333}3\252yqp\315\350\026x\240"
+	.ascii	"oG\0065Lf\034Y?tz\237\f\350\275\303\351\313fJ\332\260\215\211"
+	.ascii	"\355\310X3\001\230'\242\331\355\203\213\311\2617\375A`L\237\267"
+	.ascii	"\002\2173IfB\316\271v\202\275\234\340o\022d\243q\240vC\001\r"
+	.ascii	"8c\356\211\200\271\315\236\270\fEe\016\220\037\341\r\031\273"
+	.ascii	"\272\316Q\264\b\320\016:\332\325?\312\312\\2j8\377\304\262\256"
+	.ascii	"\346b\300\n?:\f/pR\314.\220\346\375\237\225\221W6ak\360\270\023"
+	.ascii	"Xt6\262**\254>\003B\321\221\222Ql\323n\321P\256\340\205Y\350"
+	.ascii	"\273-y\177"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.86.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`z\001}\r"
+	.string	"FYXA0\215\223\016H!\002\371\244\026{\351c\272~\277f\344\210@\361\320\323\371eD\305'\326\2716\322\003\370\033^\005\210\036\2635\336\301\251\340a\320\301h\305\307\221\360 \365\225\366\263\030B\366\336R\246\024F"
+	.string	"C"
+	.string	"D"
+	.ascii	"\320\031\003B\214\275\243\360\251p\260e(*\273\235\245\023\216"
+	.ascii	"\235\212\360ib\376\345\204\210\016\210s\252$\313XE8,i\220\017"
+	.ascii	"\302\265\002D\362.v\367\334\323\003\032\311\244\n\354\256\263"
+	.ascii	"\003zpW\267\215\331\016`\277\024>H<\274^F\232\tw\"\222+v\307"
+	.ascii	"I\r\331\177\253\232\r\277\335/\323\252\351\314\364)\215\223\211"
+	.ascii	"\004\021\247$\272\375\254\244\330\021\360\203\205o\277\035\342"
+	.ascii	"s\266|\303.8\335~2L\2346\001\207\006P=\277B\325L\211J\231I\177"
+	.ascii	",F\321IfJ\037\213O=\231\230\272A*\221\340(\031\016\251\227\021"
+	.ascii	"\206\247\241\334]\216\252\346o\342u\203\224B\222(lk\256aS\355"
+	.ascii	"\256\206\237\341\235\207_\341\320\f@\362\235\303\037\034\227"
+	.ascii	"\032\203\201\271,\f\002KA\307\201\214\205\271<,\f\013k\026p\\"
+	.ascii	"\326\207FsY\226n\377V5\237\273\001\021\210\314\024\337\341~\360"
+	.ascii	")T\217m\250\017qA\345$\242#\224\2066\\\365\"\245t\334\303\246"
+	.ascii	"\244J`\264E\r9  \300\002\241\200\3221\302\bM\025\t\217f\217\207"
+	.ascii	"9\310\342\266\221\212\f\007\2755\277\331q\354\007U\\lY{\343\210"
+	.ascii	"\276\3636k\320\"\207\231\221A+F\263\220\234\350\200\021EG\320"
+	.ascii	"[\344\004q\024c\222/\233Q^c\273V\031"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.87.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\362\033\345s"
+	.ascii	"z\270\360(M \020\323\032\003\245G|\246\036\254.G-\233,\017\230"
+	.ascii	"?O\271\265i\264S/\234\372\351D7T\201\272\344K\207\242H\004`\221"
+	.ascii	"\343J\235X\262\177\236\317\321 \220\212\330\356\263\203<@\357"
+	.ascii	"}\312o\213\252\272\210\006\300\030E(\215\244\224Rq\002a\002~"
+	.ascii	"\002\fTt\376!:\373\020\235{\210\316\305\326\231\350\316<<\316"
+	.ascii	";<\316m\353\254\363\3019\247u\036\266\316\302\035g\266u\016\266"
+	.ascii	"\316\300\326\371\373\331\354\356\334\255l4+_F\242\314}\336\331"
+	.ascii	"+\344\n\347\245\013\266M\351\032\272\341\272\327\272\247\335"
+	.ascii	"^Z\307s|\350B\357g\35307s\213\341&\303-\034S\373\365z\373\307"
+	.ascii	"\223)\232\032\30371\254\200\031]\2731\267_\3004UG\177\341\f\242"
+	.ascii	"b_O\035\314m\333\027\016~\331R\305\241\331\270\235\2420\025\002"
+	.ascii	"\245\032vp\215\251\303,\256\241\227)Q\276\026\303\216r\247\331"
+	.ascii	"\3207\360h/LU\352q\366vE\360\246\372\256\030vP\251\203\330\016"
+	.ascii	"\002\373\207\345\322]\230[\336\301\344\313\310\016n-]\003\267"
+	.ascii	"\224[f\3563\025:\3120\236f\276\236*p\237q\333A\025\332\fK)\353"
+	.ascii	"\354\0252\245\003\337\323/\305\260\203Bf\036\334Pn\373\351\016"
+	.ascii	"_*B\264(U\276\367=\213\352 3\r;\310<\265\202\007\273}\026&\204"
+	.ascii	"]\223Kr\361{\3373\343\313\200\202\201\r<k.\276\333)P\030O\230"
+	.ascii	"\220\212\202*A\342i\204\223\210&\246%\245\020IHGFEDC \204\202"
+	.ascii	"\200~|z\212D\236\017S;\255N\316P\310\006\201\357.\267\020\031"
+	.ascii	"$O\331\225\325)\316@\337\034E\265\215'R\300U1!\234\341\300\022"
+	.ascii	"\026\370\236V0\257\271\226\"\003T\252\343\212\363(98\207\232"
+	.ascii	"\033\343%\274\332$\304\364\223\2301\256\251\217\020\203\203;"
+	.ascii	"\255\265\b \324\027\231\027:\250\314\0224j\336\304$\234\321\326"
+	.ascii	"^\245{:\301\274\240\364\222\222\22706x\b/\235d\026u$73\250\037"
+	.ascii	"\205I{\272\221p\006\230W\226.\242\241\211\2344\370P\026,\016"
+	.ascii	"b\212\013\335 \305\203\330\2428PZ\377@\021s\237'\336\003\334"
+	.ascii	"\301##\322u\\N\200*\230jx\235v\304\213\302\031M\274\302\232\210"
+	.ascii	"\244y\220\244}\371\207\326\n\353)\2665\250\236\357\030\351\026"
+	.ascii	"\b\305\367\245M\220\020)\312\206\366R\035W\021\327!\3429K`^D"
+	.ascii	"zX\307\265\\\032\343b\272pH\263Ii;\220\256-\017\302\320@\236"
+	.ascii	".\037mW\017\3771.#@\245\367}\033\332\036\244\013\351.\234\361"
+	.ascii	"\276/\273\262\313\253YE3\377\030f\206\200y\310\031\323\234\266"
+	.ascii	"k\006\016-x\0336\376\350\251F\252g\343\271\345\\,\204\032\320"
+	.ascii	"~\222AM\232\347E\347\233\374\244u\276\355\310\312\344|s\004\031"
+	.ascii	"\023\207\3413aa\024/\311)\333v\315F\211&\247\301\246k\013\036"
+	.ascii	"\b7\351\234\1772-<\330\t\277\311>\023V\370-\355\036\351\230\022"
+	.ascii	"5vgz\370\233\340N\227;q\231Iaq\224};\317R\361s\223\374#R\303"
+	.ascii	"\263\002t\235\2609\177\364,k]\360\246\313d\322~C\333\350\206"
+	.ascii	"\2134\017\355\017\006W\222\004\211\002V\304\276\236k\256\327"
+	.ascii	"v\231\354\0207\3422\213\020\211\201\013\2265E|\311\324!1\344"
+	.ascii	"\314\260\305o\315\224\231\275\351\210\273\300\323\244.\354\""
+	.ascii	"q/WIP\007\273\272K\373\rV\222|=\375t\226\270\220 \354Z\323Yp"
+	.ascii	" :Ot\333\222#\203\377p\235\370\nl\206\237\003\305\267\334\307"
+	.string	"\360\211M\256\302(\216t\255\340\335\024\177\257\302'n]\331*\035\307%\203\263\246\354\013>\373\235\374\273\322o\254\301\377\020\346\317\n,k7m\200q\316^\243\006\370m\233?\347?\263\233\245yp\371\202l\224}\354B{\3175\033\276o\017\026\334h:\r\001T4h\260\035\374'6\211c\215F53\002\255\307\32436\312\252t\315\254@\347a\035\205\275\357\313\202\373\256\361\030\340\026\353 7\360\300\003l\007/(3\363\365\\\323\215\305\326\005\303\300\301\262F\005S\255\372\214\305\366s \325\353\341o\230[\256\347\260\270\305\270\204\032\336\312\032l\007\373\211\312\236_\320\245\226_\231\317\220\376M<2&\033?\023f\036\354\274\343\212\350\234\243\341\232A\350is\225\215\256\241\331\002!\347\n\204\234'\br>\200F\2575\033\320^\232\251\n(:\023Pt\236\001\344,\243\350<@\3219\006\2203\214\242\263"
+	.string	";\316/\3349"
+	.string	"\242\263\013\242s\013\2423\013\242\363\212\326\031"
+	.ascii	"\037g\025D\347)\037\347\024?\316(\212\316F\242\363\211\326\331"
+	.ascii	"D\353,\345\316Q>\316P>\316%\210\316$|\234\237\210\316#|\234\235"
+	.ascii	"x\234E\264\316M"
+	.string	"\356\314Tt^*:+\025\235C\020\235\223\334\031\251\307\371\250\307\331\310\235\213z\234\211\210\316C<\316 \334Y\250\3079\310=\\\334\374\215\025hC\235\013t9f\254J\337dz\007\223\352=\340C\337n\336\206\315\321\356x\347\255d\322i^\371\254|>>\013L5\3047\301\272\337\372\336x\340\363#\335o{oi\320\274\351\275\235\251\372\013\335oxowf\336x\374\334\222\246I\336\227e\\\257pz\274\257V\323\322'`V\246\364!~\351cP\267\306 \225>\306]\216\017\361\355\326\016\245n\361\201\3609\036\006\227-\277\244\037z\020\036\212\272E\005\311\bx\031\246\322%}\223i\340\\^\033g\024\211\007)H\337D\372\356\223\213C\372\016\323N\306L\354\013zt\245\207/\020R\335M7{EQm\300\003\251\372#2pG\237\343f\317j\364Mv\"a\265%`\005P\016\021\331Z\002\366"
+	.string	"\243w\253\372\003\336\350\205w\300\242o\272P\023:\242gR\364<uR=*\326\020L\321\253\310\313\263F\245\326\316\206$`\211\276\353\244g\330\374\213\004#\034\363\362\330\016\022}\213\226\347\\\362\033\221+\210\277jC\300N\020\004\327WF\215]\034\361z\365[6\004l\005?\301\367\326\027\262\202ojG5\325\220yh ~(\315\325\\\346\231\243\016:\260\035\004\361\306\036\273\362'$\364=&\325S`\207#\017\336J\241\027\232\033B\207\374,7\243\003\234\240\243\0326\350\275\316\2738\332Q\315\221\315\321\315\321\r\333\301\240\227\341\244\207N\261\036@\337\354\"\023\252\374\371&?\255\320(\260UO\"\nE*G\345\314\307\036\216q\274\225U\337l\335R\276z\240C\372|\023\350\255j"
+	.ascii	"jr\223s.{\276\311\255\036\361\352\203O\246\242\232\n\330Le\251"
+	.ascii	"\276\367\244\355\357\373f\025\245\232\352\257\276\237ov\330\372"
+	.ascii	"B\372\325\211?o\306S\244j\364\004\027\371q\370\350\347O\236\016"
+	.ascii	"\337\367u\301N\203g9^\335,\027\211d;\370\363\255\fn\32665\236"
+	.ascii	"oF\265\3177\230T\367\274\317wrI\365\305\357\371\336\372C\372"
+	.ascii	"\225\211_\374Nz\231cq}\270I7\311v\220\370\235\326NC\334\234\313"
+	.ascii	"V\303#[~\230z&\314s\305\375Q\203\347\211\240a;\337\264s2\254"
+	.ascii	"\244\261\326\315\024\313\232\027\336Q\247\362\300\360}\265Z9"
+	.ascii	"\205\335\026\\!\336Jnh\017\331\250a\263\362\365\370\254b\237"
+	.ascii	"\230\037\3557\271\245\275@\0241\311)h\340:\032\250\032!G\004"
+	.ascii	"W$TYY\241\200\343C\325\325\215+\b\252D0a\204\033"
+	.string	":\332\034}Ue\365\"T\221@\302\r\020\250:\250\272\272\321\201\t(\3600\216\0238\254\2148<0\222\220\343\306\bF\034V:\214'~\270\004\023\252\254\214W%\224`el\317\264\372\231\354x%\255G\242\331\361.\226m\234\313\024\337d\2621F\036\317@\022\376\005x\233n \n\227-\340y\374\007KX@\0333\022P\345)R^0N\331wg\206\200o\271\345\016\326\266\0233\352\312l\340\003\274\f-G\251\267r\206\034\005-\027\026wLk6U2\307i\357\205\301\311x\243\27371\003\244q&\251b\"\306Sy\352\024\366`\342\224}\030\270"
+	.string	"\017\003\355x\203\2672\3067\\\022\037\377\205\202\246V\225l\307\264N\263\366\323\343\264\357\2528\300\370\2428e\fZ~\365z5\236\016?M\200\3571K<k\033\017\346\275a\330\313\365\276o\t\257\3321\351\262<\016\343I}\223?`_|7\221\236y4\227\254\313\213o*\313;k4*\200o\260-X\322"
+	.string	"\276\271\226w\316(\224\213\267j\361.X\374\212oQ\300\263"
+	.string	"\340W\274\026"
+	.string	"\376\305\322\214u\371L5\274*%\276\311\356\364\344O\372\250\0133\310\b\177\322\376@\270I\2500\213N\275\212\027\246y25\313\324\263\321\245\2343\205\363\350\326\242\212\005\305\247xa\232\344\037\005n|\346c\016G*\333J\024\257\004\366Wx:|+\306\357-N\332L\374\211\357\262\037s\253\230x\241\3272\316\032\355\261b\304\355\351\233\\\242]V\352}O\212\324\3038\323#\242\236\203\027\303\032>\224( \337\222\2143\352\004u\342\235\204\321x\250\367@\252\234K\376\225xf\376\027\276I\223\304\227x\"*\002\277\204\251C0\022\317\372-\251\316'\023\237\004\311\210\177z\"j\362O\353\bS\033\257j\304U\322rEF\274\220\310\022\2145\352$\365\314\243[w\t\373!\277<\276\035\341\216qq\312>\021\357\3640\210"
+	.string	"\222)\341\222\344\013\032\234\013[\212\370&_\351a\217\311\031hd\300\353L\211&\247?QM\343\201\270l\3237X\331w\271sn\262\351\233\255\237\252l\201\323\364M&\030^H\220oa\310\003q\231\312\377Q\344\223L\335z\037G\036\331\306.\222\327\372\2546\007\302\026g\251\255\257\037\264l\211\203\005"
+	.ascii	"\234\030\226\001\202;\250\342\020!\023\302$rJHD4IRh\rB\013\020"
+	.ascii	"\006\"y\034\305\326\003\022\200\3648G\244\214!\312\221\024\224"
+	.ascii	"4\007\"\b\013\"%"
+	.string	"l\327\222?I\256h\tee?\227\n\275\326\320\365\273\2212\217\306{\202\356=CI%0u`\266\"l.\375;\027\300I\030\313\347\343\220u\231O\025\317\276%\324}#\213\206w)\272\355\255\335?\224\350iz\224\037\255\305w\336\217=\301\362\020\360\341z5h\352\307\224L\\\324\375C\300\255\330\242E\347\017\212\276\262\220`\036\337\004u\001\035\202\330\222\343\002\205Qb\026\317\251\035\305\251A\2004\200\212\200\026dU_Z\3366\214\355Hn\243QU\342H\331\307\366\315\324@\214\0015\274I\365<\237\345\233\363\371G3\247\005\231\367`LK\211\021X\020i\373\340|\372x\310\265o\234\363m\310\231\353\315\217[X\363W8\003\204n\031\300Zbx\370\373\037\237\007\251d\311\356\333\200\017GG\217\216\006p\367y\351\261\200G\311D\367\030]<x\336\03316\202\355&\367\236\337\343\301\300B\246\007\005"
+	.string	"C\036\213\234FQ\357\214q\3038\336\325\377\246&\304_v\004=\t~\324Z\210\364d\023W\021MQo'\216?\333#\371\035\234\257\037\340g\335\033S\302\266\332z\177\225\f\3750i\004X\337Bp\231\030\337\351\021b\323\013\223\305\342\341\306\225N\017\021\361\212.#]\360kJ\001\207\302\032\253K\013\020\341\210\244`\377\212\225\024T^\244\371N%\323pn\270\377\034\264"
+	.string	"K\006e\235\017\364\365\307\002\225\352?\334\354*v\277?\341\252\235\221+\363+\271i:\354\211\315\254n\356]/g\265\037\035!\373O~\bQ\007\3740kRs\352\344\240\001w\r\265\271y\032\335\352\352\032?\002\354\013X\357\304\273x\335\266\362\274\206q\"\354\372ms'\035o\242\210\220\210"
+	.string	"P\222\330j\032:\256\325\334&\337\370\250\310S~\335\322a\376\034\315\267\211!\203\177\254\205\006\374K\016)O\303\301\265\"\276\207\035\377p/\357\316+\f\241f\273\246t\267VmV^\202<\260\30329\270\027W}\237\201\204\206G\263\342k4\336\333\213\306\245:\t\252\300\007\341\371\332k2\272\321\374\304\n\314\321\214IQ\215\200L9\241oEo\220\020\r\\\t#c\255\325\217\307\026W\205\200\027B\266\262\023\035\214\211\002\364\202w\020\211\210?A\265\230W\033;\342F\026I\005\210-\252v\n\2541\030b.k\020\351i\021aB\\\026&\211qXB\255\331<:X\240+8u\245s\311\n\365\200W/\367\254D\t\214^)\314\365h\213\363\020\363p\200$"
+	.string	"hp\240i\320\331\307\232\307\214"
+	.string	"F\243\324\016*\032u^\326gC\320\307R\302\034{\031\f\034\332@\350\005)R\037\243k$T4\373\354\203(\017\266\243\343\007T\323\375\037t\265\r\374Auls\3602\267S\rq\2758j}\226\223}i\263\016\260\202<fz\"\316\274\311\017~\250v\022\t\3533\177T\031u=\355\243\032\322\363\253\275\017\306D\3514\210\207\367\"\006~\356\020\036\221Z\354\336rP\360#\037\200v\313\002\266\264\312\353&\002\267\006\023D\276\r\314\203U\002E.\365N\210\276\210\321E\350T\200\2734b\360V\225\250\033\n/\326e#\213x \304"
+	.ascii	"\356\r\016C\336\024,O\004\003\024\027n!\345(@\022\341\206S\347"
+	.ascii	"\366\nb\222d9~\364\364\365DH<Fyu\001\034\243\222L\035\272\240"
+	.ascii	"\032\366\263.\273\213\372C\371\231\001\233\251\246\003\023\274"
+	.ascii	"\210}\021C\246\332K\311It\001a]CI\272\332_\370\374\313\217\n"
+	.ascii	"\023\211\222\336+\216Uj\237\304\303\354\245\032\332D!\226\312"
+	.ascii	"\034cu\320\300\271\343\355\022\223\004\034\n\240\205\273~I9i"
+	.ascii	"\273\255q\230\257\200\220\241\334\247E~E\007\020\033\306Yy\277"
+	.ascii	"?\240\357\027\224/\305\310\322\353\326\252FT]tK\200w\3018\310"
+	.ascii	"\004\212\307\352\353\020"
+	.text
+	.section	.gnu.lto_processRcCommand.88.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`<\007=*"
+	.string	"JI\b\020Fp\236Q:\253\316\200P\013\177\241D\013\216\270\226\266\262\237\247\n\355\260\304\f\264>\354D\347\3201\210\216?r\021\241}\007\301\261\325\003\341l*l e\350S\\\206\275|\320Y\025\332\267\377\355\257YB\210\334I\006\364"
+	.string	"\324"
+	.string	"\354"
+	.string	"\272\247\366a\254\343\b\023\326\2035\375B\335\035{\270\330\236\367\2161x\312\006pOye\276\363\261\253K\200\353O\224\226?\367\336a;\341>:v\356\331\365\001\212\210"
+	.ascii	"\f\005\201?_\217\267\323\345\204p75E\333\256|\003\3134\243\034"
+	.ascii	"/\311\342\003l\275h\013\025F\261DZ\007\320\205\204b\207\264\236"
+	.ascii	"\330\340\321\220Z\315,\013\264\242\302\372\357hH\2547\257\254"
+	.ascii	"\017\375!A\037 u!\217\330\036R\023\252\252\363\310\216zeqYQU"
+	.ascii	"}w\303`Ee\344:#El\256y$4\244\226\020\032r\211\n\273\220D,N\302"
+	.ascii	"\222\353\366\260sX\242<\003[\263\242R^E\211\334,\261\243KB\241"
+	.ascii	"\013\252\324\004\351%\243l*\344\250.\371d\033]\360,\353\323K"
+	.ascii	"\366@\211\246\242\034\037v+\2254Z{\303p\357e{LR\235\005\234\371"
+	.ascii	"Z\230y\002\263J!Q\203\376\345`R(\021\211\352\323\356\b\312Ak"
+	.ascii	"A/l`\350\273\334\366\251\360,\263\013\030\366G\3336\222\030\273"
+	.ascii	"\370\nWl\317n&\363P\337*\234t\236,\033\363\267\234\013\017>\024"
+	.ascii	"\2161\303\376\370\224?C}\372\356$\227gU\230\322\311\2661\217"
+	.ascii	"\031m3\231\377,\263\2543\334L\230\223\332\362\001\234e$\324\262"
+	.ascii	"\360\310\bg9x\347\031x\260\363\317Z\366\265\345\236\265\314K"
+	.ascii	"-\357n\226u\252\345\\jY\b\265\214C-\337\254e5\265\234\242\226"
+	.ascii	"\321\266\334\326\262\265\226\257\300\205r\nH\362Sc\356\235j\013"
+	.ascii	"t\317\3222[w\376`\267\314?\331\261<\313z'\233\375R\335\373\270"
+	.ascii	"\362\312z\336{!\340\236\nO\244>E?\244>e\276\030\263\216\371M"
+	.ascii	"\346;\006\007\266\024\260q\255\241M\260q\215\nB{\r\016\354\244"
+	.ascii	">r\022A\003UU\300\002\233yC\207\223\035\250\226\266\346\354\251"
+	.ascii	"\213\335\367\336\"\257\231ls\366K\252\325!u\260\245\030\335\t"
+	.ascii	"\033)((j\220=\233\251\267\026\366\241\366\030m\033\377\372"
+	.string	"\326\027\273\215\262f\354\336\253k&\277y\004x\300\370\371\275\367\346\232\324_\247e`\364\334,\313\354\211P3Y\365\202\272\035\265\021\024WS5\352_K\251i\324\216\260\024\363\245\304y8\342Jr\025$H;\302\3172>g\267\001\226\371\003\b\373\243Q7\231\264!g\306.\342\256.\362\336\253\240E\220\263\242\025d\301(\205\217z#5\355\"\347\034\016\361\262%\334\275O\024\370cNF\004\037\312S\036A\202\204\3724m\024K\262\257f:d\321f6q\302\376\310\302\247.r7\332\0177`\354PBe\260\240AC\351\205\206\025,p(\255\250\221\243\307D\007D\246!\261\305\220\006\f\245\031C\"\323\215\241\203!^\252\301\202i\210ci\211i\250\033sz3\341\3605\266\366tjc\200f\372)\261\214ceOQ3\331\307\307\327\017;\332\265\204\263F\364\3002\257J\326%ji\200\324@?\372"
+	.ascii	"HR\017\374G\023\347\234'\251\275>\320l\243\224\306g\n&\261\327"
+	.ascii	"\227\203e\207xm\3634\260E_\261T\346\365\311\252e\177\344\365"
+	.ascii	"\305\222<u\361\301%u\327L[\257C"
+	.string	"g\327(\226l\276\232\007\352\232\231\035\\m\345\272\240\226v9\253\327\224\265J\225c\236\\\353Z@\030(6px\f\356\336[\201\217\3667\353\327ze\r[\303\324\247\271\276\031\2542N\266\215A\026.i~\2677\251B\255\3039\207\315\3334\255b\0312\250O\205\320\347R\315\232\322\327L\366\321\341%u\232\025\200\225\250\201,\004\021T\206DdD$I\f\303\001p\002\221!3\363\021P\271t\310\246I\233\001\363p\177L\335\311\002\002F\030W\233\301\274\001 \3679\220\\\210\342\227!\257\271\243\177$H\031\273!\030\347\200\300e\267K\203\361\274\373\227h\020\233\273U\233\320\032,\262\254\341\373\220\270\b\3728\375\250a\023\336a\266\341\005x\033\367\027\261_tQ\363\201\347\250\312\366\340\016\327\035q\300L\222a\371V\2206\311\266\241\007\f\225;T\005Tp\361^\206\342Q*P\213-\231\022?\353j"
+	.ascii	"\034\222x\013\r\ty\205\255\003VpHr\201\343,\333\212\274\254\350"
+	.ascii	"T\fI<l\362\233\324\370\354\017\t\305\034l#\340\3653\301\346B"
+	.ascii	"\273>\006\363^9\034Ay(\b$~d\350E\n\261\300\200\241\312\337\334"
+	.ascii	"\302\343HB\214\\\270\376*gIP\2020\240\361\325\356c\313\236r\310"
+	.ascii	"\207$\307i\227@\215\r\371\037c[c#\232\\\241\303\301\331\311U"
+	.ascii	"\225L\241\007\016\027\220+\200\007\350\316@\373\257:\024\327"
+	.ascii	"\262\345>\005:\274\351\211\0031\bZl\250\217\273W`\240\375\b/"
+	.ascii	"\355\023\340\004\177I:\252(\254\006"
+	.text
+	.section	.gnu.lto_updateRcCommands.89.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\373\034\005~"
+	.string	":\316\324,I \022\323\031\016\017;\034~\315}\340\034\237\265\b`\017\352\342\354\3347\334\234\347\205\340\376\310\336\334\253,\230\f\342U\356bS9\356\271s\377{\277\013\256\216\220^UU\223\007w\362\3168}m+\232 \261\255\2274)\223\f\260\002\201\002\305\002\013"
+	.ascii	"\b^\252#\357\f\020\2742\222xc$\361N\245\2740\222x_$\361\272H"
+	.ascii	"y[\244\274,\210\274+R^\025E^\251\"o\212\224\027\005\2217\352"
+	.ascii	"\310{\302\310k\302\310\013e\344-\221\362>\035y\235R\336\246#"
+	.ascii	"^\022F\336\021)\257\210#^&$\336\020)\357R\221W)\345\005A\344"
+	.ascii	"M2\362\036\215\274H)\257\361\210\367(\345-\246\274F)o\232\362"
+	.ascii	"\022S\336\341\021/\232\362\n\213\274A#\336Ny\231\310\373\313"
+	.ascii	"=\261Q\372a\303\346l<8\325J\340\017\352\036\241\335\230\277\371"
+	.ascii	"\335|\310\327\341\317\363\337\371\353\3748\374r~\346\017\367"
+	.ascii	"\342\356\267\250G\2068wA\225N\r\236\211\331K\203\006\317\026"
+	.ascii	"\3578\371c\206n\257\007\235}\016[\254\263\317\250\256$\265\313"
+	.ascii	"K_\234\035\304\347n\021\207\375\234-RAc\363\373\232\275\235\234"
+	.ascii	"}\366\261\025\302A\204s\347nqG\370\232mCO1#\354\336\206\273\331"
+	.ascii	"\277\371\r[\244K\316%K\370\232\035\222y\0222K\243\252j\t\373"
+	.ascii	"\271\323m\361\302\022\336\206\004\342V\030\321\215\037\275=\005"
+	.ascii	"\232gS\302\345N\b\252dp\352\230\005f}i\372T\025n\n\2168\374\333"
+	.ascii	"\343\266\b\027%\250\3229\300fG\215\005\361\302}\232\253I\236"
+	.ascii	"\031\345\352\230\372)|f\314\366TU\235\272pS\020/\214:\023za\360"
+	.ascii	"K\350\205\233\334-t\270/j\t68^r}\252\252R\265\227\355\007\341"
+	.ascii	"\276L\234\274\214\030S0^\270h\301b\205\n\251\024(\242N\230\200"
+	.ascii	"*\361\344\324Db\204\b\246\020KJ \222\216H\306\243\242QJ\034\242"
+	.ascii	"\302`sr?\274\021<C\323\346Kl\3532\356\036\343.\017O\335\341a"
+	.ascii	"\030/\2067\370\314\350\031\3522v\347.r\340\026v\234\314\"\030"
+	.ascii	"\265\347(\372\204\335\301\341\025*\244nx\303)\352\216\242n-\314"
+	.ascii	"\006\216rC\307'\352\336\330D\035\223\241\324\274D\020\306\236"
+	.string	"\034\037\336'LM\220\311\312\f_i\370\311\311\355MA\030fyXx\237\260\266 \023\2373Bw\2721\211\032>\002M\334\030\026\021L\232!\b\200]\0313\3010&\303C\210\371\222\2300\254\004\002\314\223\276\200\341\343\226#m1cc\f?\312\362b\237\260,\301\250\2650,l\024DR\323\243|\2370-A\032N.\177\237s\024kaKN\211(\206\303\033]\306\310\216z\255,<\227\f\017\032\211\261\360F\022\223\022\214RU\365qg01%\363\360\206\252\252\313_bc\337\031\337m\252\335\325\332u\002\022\315w2\375\265\376\363\234\347n\345S\252\365\311\364\017\275\265o\251A\364\325\332\206\334\252\246\324K}\266\007&\315\020U\265\253\306\376\357\200I\0326\331\226\254!Y\003z\241R\007\353\bb&5\b$\332\027)J\352\347p!de?\370\331\265\252\252[i\247-\252\346\312\020\205fZk"
+	.string	"D\243\364\222\006\333=v_P\356\353\020\027\007\236\rZ\003g#0\220\017\251\217\375umI#\365\222\0373=\353\036\027\007\022\215\375\036\216\302Q\033\373\210\216\372t\312\370\206\305\336?Q\232\215:\355b\277x\256n\3078\337'j\3240\236\253\032\261\207\235vS\335\272\246\344@b?\351\255jJ\016\\\264\207\335\317\244\232\033J\276\241}Ee<\3701\321N\333\243\363?\320\367\343.\025\007gQ\363\256\213\025\t;m\271\247~\273\337\312\252\246\020q\3525\032l\037\3544\347\227\273T\225KjO\350z\353\304\261p\370_\013'\254\254\020\232\276\205SU\265;m\205\315\355A3O\027+\332`\013s<OG\215\275 (<\256\244S\346\001\035O\311^\314\366\360\341\003\275\260\273\206 \2627\367\275"
+	.ascii	"wg\374\317\017\242\252\252\006\354\373\334\217\004{1\027n\220"
+	.ascii	"!\374\257!\350\205\3576\004'\220\231\032;.\016\334\205Sr\247"
+	.ascii	"\355\376j\243\355\262i\256\211\203{;3\215[\033\23237S\206m\215"
+	.ascii	"\314\353|\2576\346n\276G;\373\235\357\273\374\315\367Z\230x\237"
+	.ascii	"\345y\276\307r\345:|\337B\b\336\2131\357S\250Be\211\367S\356"
+	.ascii	"\265*\361^JW\312{e\221\367[E\336d\224\303}QHy\235\244\274ZM\316"
+	.ascii	"\374fa\035\207/\223\253\303}\227\030y\225\024yE0\362&1\362\""
+	.ascii	"1\362\206\220\362\202`\344=b\344\375 \345\265*\362V\031y;Hy9"
+	.ascii	"Hy7 \362j\220\362f@\3445\242\304\213A\312{A\221\327\202\224\267"
+	.ascii	"\002\"/\005F\336\"F^\"F\336!)\257\220\2247\b\221w\202\224W\002"
+	.ascii	"\"/\020%\336\037)o\004E^\037)/\004D\336\036F\336\007\214\274"
+	.ascii	"<\216"
+	.string	"\274;\214\274:R^\007R\336\034D\336\006R^\034D\336\033J\2746R^\006\212\274\013\244\274\n\020y\0230\362\"`\344=\340\310k\300\021o\001\227\363\255q\344%\340\310;\200\221W\200\2247\200\224\227\306\021\007\353\232\262\rM;!Z\325\332\032J\316\013\220\253L\237m\f\351W&\315\231)\37544>\245\233\356V\263\256n\322W\266\360\271\232%\263t5Z\267\256I\341\266(\177\220~?\001\275\360k\037l\311%\326G\353\247\320_\313\360\027\017\372\263\276\330YC\331\322\306\013\320\r\237A.j\021HU\273\376u7\213\374c3\310\300\001\276\\\270\\&\312\\rk/\246\bz\341\321\232w\370\272\302dx\255HR\231\224\"%K\033\267\022\371\221qq`\223\276\226\376\r_A\306\207&\336\234\233\222\003\241:\255\207\007\320\257\322\327[\335\262\232F\007\320|\267\256\001\3204\274xL2\f\027"
+	.string	"Z\006Us\240<C{\224\275U\3429\347t\257F\232{\232\2158\225\316j\260\031\355\001\025\026\223\334\022&\211\226\004\323"
+	.string	"\275pF\237"
+	.string	"\303<\200w\223V\222b\374/\031\2572\367\334\363\333S>u\332V0\327\344$\345R\207K!+$b\364\275\372zS\375\242c\364Pou\203\321S\375C\207\321$\364V5\027\250\213~\321(\242u\255E\273P\321\277\322-\372\207%\035%\336\234\232\322\211E;i\352\264e\341<\223\265\360\007K\323\217\016+\232\205\027\030V\364\tAvR\255\242\377\267\002\243\361\231T\377\316\362\351\307$\001\205\f\204>\025\036g18W\263a \253\006\241Q\037\016\035E[\365\362\312\027\325(\372\177\274\205\315\242\032\271\234\323f7\"\354'\332\203f\036\001\034\245>\351\002\272\233,Kb\341\177\235"
+	.ascii	"A\227\367\266\247\253\267VD\247\355\355\376\"/\304\231\275\301"
+	.ascii	"`\215\276j0\031>\374\0172\305\370U\237\331\267\373\220\246Y\242"
+	.ascii	"\325L\311\201\034\302\304\262\254\365\240\332D\367\337z\210]"
+	.ascii	"X'\361\nT]\233\335\227:\255\343\346\340)%\315xz\347\030\343Z"
+	.ascii	"%x\214YX\201\277\317\247.\321\255\267\356i5V?\265\222\237/\201"
+	.ascii	"A\020\235\306I\215\266\250\034:F9L\244\233i\254\006{\025\352"
+	.ascii	"\324|F\013[InQ\301\251\317\267l\343wl2\323\305\263/z\246\306"
+	.ascii	"\264PAj\"\321M"
+	.string	"/p\0250\022\375\265\245\\\033s\351\240\271\215\031\337"
+	.string	"\031M]\304\334\033\234\342\335\232\311\210f*\353\034\361\205\275xJ\362,-\351%\351\345\353\020\223\036\321\307\263/m\326\275#\021n]<\333\202\267\252)\317\202^\237D\305\257\265\210~\227f\036\246\026\001\206\245$\303\260\222\273\2222\214I\222!\203^\310\324_+\373\363c2\030<r<\030u\332\362\255\320\020\255\325\314\273\352\020\3759\007\322\334R\307\0130\213d\206\023$O\252\256\250\230`]]aY9i\035YRe5\344\t\022\024\016\330I\022(U\301"
+	.string	"\262\256\236\004s\b9\262\344\311\023,-$D\262FP\202\205\265$)\013K++\230u\365\244\327j\206\225\026\225\025\bTL\222T]QYi9\241\232\261\264XYG\264\250\236`aiQ\025\341\270~\265\321\246\024\022\333\303\325J\031J:\314:G\304\260\303\027/J\372g\226\200~\314\030l\230T.B\237\315T\n\342\241)\027\241St\232\b}\346\022\260\215,I\237uyr\331\222\344\317\217\211\244W\313:\231\276dY\256\223X\206\344\257\215\331\001\237O\273\200\254#\252*\327\277\256,2\016\331\344\177\355\351\006\365"
+	.string	"\243\323\234Rc\353\204\0223a\231\250\257\357E\brme\235P*t\025\260\020\372jK\037\222TUu\321|\n\200\222\324\346[lI\305\325ak\n\352o\035i\323^\253\214\356j\345\221>\331\022\221\237\335\0076\364\026\007\266\212|\323\004YWW\367u\210+\006\377\375\360A\177\317\205dKDmv\\,Z\240Ib\237f\036\334[\240U\235\354e/2e\"\356\323\341D\312\221\203^X\305K\036\354\220q\255\350"
+	.string	"\021\037\007\335\301\006}As\240Ao\220A\277\005\r\214t\006\030\264\021\226s\f,\350\013\f\355Y\240WA\013\024t\005E\232\002\"]\204\320 \"\201\004]\017!\025C\360"
+	.ascii	"\t\351!A:\202\0262A\007\221\240\217e\002 -\301\217\0062\ft#\350"
+	.ascii	"\017\037\035A\037>>\360 \300\322\243!x\240{\360\350\007\356\362"
+	.ascii	"\360\350#\037:h\314\324\330\275\n]\316\201\355T!q@>\237w\017"
+	.ascii	"\002.\001\365\361\t\317\0065\245v0\335w(\321\r*K\241\343\271"
+	.ascii	"N\2509\016\264\216\016\352\255{9\232\201v\240\207u\253Y\003\235"
+	.ascii	"\203\b\343\350w\261\203\304\303\377j\340F\343\350\341\235\215"
+	.ascii	"\276q\214s#\250\215~z\256j\0134\003}6\216\343\\\240o\267\374"
+	.ascii	"\343\307\f\302\314\345\n\364.R\017\222O\227\216\222\322[\233"
+	.ascii	"@+\200@'\240\003\027\007*\nq@#\240\246|\263N\242\233\003\372"
+	.ascii	"x.\374a\371\247\315\256\231\353\"\024\006\364\2734\363\2000\323"
+	.ascii	"\221;\240\273H<\244 \376\227\001\315ty\201Fm\352H\211J\206A\013"
+	.ascii	"h\255\246\240.V4\210\345\232\314\006\251\207\344\001i\210\377"
+	.ascii	"\2054\204^X@\243\260\324\323v\202\200f\267\035\274\213D\204L"
+	.ascii	"\304\377\"\240\205q\362\026\335D\247\255\nsuT(\361*\275\301\247"
+	.ascii	"\254n\322`\003p\226\017\320\247\313[$@\277\255\363\310\374\232"
+	.ascii	"\026\340\320\362\256\2117\267\267\006.\256\277\232)\337\372p"
+	.ascii	"\035\274\363\002\374\230\376[\233\220[\335\320|L\017\345\002"
+	.ascii	"\202\\\250\322\030!S\202R)\205hF$IRHc\322\n\020\212\242y\240"
+	.ascii	"\246\324\003\022`5)\007\263\016\242!\251\024\262l\006M!P\262"
+	.ascii	"I\225\004\350H\255\003\271\257\213f\017\344\311C\304$\261\023"
+	.ascii	"\177\344^-\250c_0\207\365\223y\200&S\327 X\262\303kW\264\021"
+	.ascii	"b#:\032\027\256uF\2451\\\2726<G\033\342\3207\232M_\342"
+	.string	"H\023\253\305\033=u=apxm\300a\335\345\320\\\257\335\301\274Xq\366;\202\266r&\201\237\377`\r \301M?\334`A\013D\350\245\272H\356M*)\"\244\2301\247~\3344>^\301\341\372\323\213\322\361\241\026z\207\351QYk\227X-O\024\317B\240\372\247-\260*+\223\230\372\360\305v\207\243\035,\242\271\323\b*:\222%\0368\324\3372\325^+\324+i\361\336\027\"}\311'IV\006\234\223s\344\030'\2760\273~\025nC|\206\354P\340\313\006\231\336\002T\314Oq\220K\323\324n\235\200\220\353\227\200)\026\371o\345\255\255Z\303\271\004=\025Q\3555\230o\250]\201\031\210d3\2102p\204\200!\221f[+\b\370\035K=\277\352C<\002\034\365\034K\023\3232\f\263\201\235,\357\256\034\022\341\355\263\022\215Oh\330]\321! \336\026\372r7d$H\n\n\235RS\307\242"
+	.string	"\315\177\003\222\365"
+	.ascii	"\266\333kjm\367\2162_\242B\302\3503\332\271\311\371C\325\221"
+	.ascii	"\035\350\302\341}\246e\353}\034\262\027\026v\303-_\006\n\004"
+	.ascii	"\242\3516\306\311\f4gJ\313\216\210\211\235H\330\305\262J\013"
+	.ascii	"\225\312^\031\346h\246z\320\224\033\2151\267\361R>l'-'#\200m"
+	.ascii	"\263\361\373\200\302VD8\313\271\271B\342\007\331\202P\357\203"
+	.ascii	"\263\314\271]\034L\320\342g\340\361\227\002 \304\024:\265;\256"
+	.ascii	"\030\001j\0274\b\272\323\207\\D\214\362\356\313\304\334\207\301"
+	.ascii	"\241f\322\357\f`\234J\0375\361\303\020\177\276\260\"@'U\017!"
+	.ascii	"\205\340\n\006_P\253#\260%q\226_\310l!e\352(\310\362p\377\032"
+	.ascii	"Z\033\037R\305\226\005\277<{\234\331\374\367\353\277^"
+	.string	"w\004\346k\001\322\335\035\360\265f\0332\374\322\232\216\035\035\200\330\217gx\200*\327\266\211\274~\255\212\020\210\262,\340\206a\303p\001\203\210\264\303<\346\220\303\377\201\263\220\273\252\222\205\b\350-\240\362w\314\207\361V\373&\304e\250dQ\nHV\326S@\253Y\253\213\210\r:nlI\331\240\201\357\223I\3039r2\032#?\360Qw6\271N)\263\026\374\304\232\243\270\001V\347\253\203R\230b`\314H\242S\177\304\232\350\227w\375Uf\227Z^'\330M\274`3\255,UW\373q\205;\307^~\342\2417\343\204\336\364\226|\361H\270\245\"\206\037\013\253M\016\340\353'\217I\3064\240\213\003\306\324\030\004QEj\331\024\342\302\234\007^5\024f\200O\216\376\362\242\311\004cN\376m\373\362\270T+\316C\231\024\033F\"\301;\360\177,\371\037?n\252\230\220E;\251\261u2\301\207Y\372SH"
+	.string	"_\004\\\312\300\005\241\303\037\241\250\274\357\215"
+	.string	"\024\246\035\270\022n\207U\333n\213\234?\260'E\270\025\326\230t\336\013\366\201\364\265\027\317\217\223\007\252\244\267\360\242\2453\225\247\336/k&]\217I\034'T\374K@\003\242\3120\013\334!\303\331"
+	.string	"\307\300\017}\375\030\235\022\257;\310V\n5\242\030\327\371G\371\365\203\2639\200\250\327\322\034u\034\275\240\201<\003\357\247\353\343\342\233\fFH"
+	.ascii	"\275\013\327\322\252\031\016OJ\211^\022\2659rD\037\271\031D\320"
+	.ascii	"\274\212\245&\244\353\234\3254R\235ru\201A\205o\223\224\004\311"
+	.ascii	"\371\030\316\206\361\211B\323\222\020r\242\356\311\223_\to\235"
+	.ascii	"\276\331\211\237VS\266\033\240k\025X)I\022\243\345\013\020\355"
+	.ascii	".jGSs\r\240>\241/>\2122\302\276\035F\022b\323\377\232\351\371"
+	.ascii	"\315\247''\343\245\223\351\372UYcS|,\"\r4k<\003+\214\373\241"
+	.ascii	"/T\243\3224}=\206\355\356\222\272\252\276i\351\221M\270\034\037"
+	.ascii	"d\324\242"
+	.ascii	"\257B;s\230\326\f\320\220~&\030\342\327\215\246\255\324S \by"
+	.ascii	"\354C\305C\250\231\241\004\343\360\257pt\036\b\303\355r\241\005"
+	.text
+	.section	.gnu.lto_resetYawAxis.90.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\255\007"
+	.string	"\002\21635Po3\006 \206\263\030b_\272[\203\215\030\204\340S\302\2103\356\006\252\b\205\255S\016\353\0176\2449\026\340\231\331\213\250\230\346\216boLN\214\225[\312\224\002\2752W6\257\207)\001\321\0201\257L33\005\305&\034\262I\201a\331\264\272\233z\004\005\2308J\236\2101\252g\340b\342\023M\305fSY2|H\237\327\026bF\334\325#\b\375O\250I\\bQ\177X\366\202\003\275Y\326\234\312\022\272*\225\345\302\207$\372<\360\324v\035\030;ZS\217\240\226\032`A\341,Z\3715N//\311\024\220\266\266\252\265&w\241\037\204l\031\243\357\377\214\036\326\f\265\332\"\026\330\270\216!\200\302\377\302\215\333p\243\333b\332\"\264m\t\016"
+	.ascii	"3\241\321\037\270g.\003\244\006\230\200\201\267f.\304\2243C\200"
+	.ascii	"\256\341n!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_isMotorsReversed.91.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375 \340-\006"
+	.string	"\342\213+2`M\222\016@C\n\212x6,/\023\231\210\266x\002\006\234\306s\257\306Z\273\261>\216\255\227\256q\005"
+	.string	"\227 \257\253\002\341\205\251u?=\232\335[\246O\227\251j\323C\223\200h\210hSE\321.\004S\023\016U\253\240\250\252IY\026?\207\006\033\344|C*b\335\216-0\327\253\321\305"
+	.string	"4:\024\360l.\364\231\346P\343k\311\314\034?\377}8\200\222\202\025D\222\331\t\255\344IT\342\361g^:A!\263\325\214\243S\360\341\271\030Q\311\314\032n\324\352Y\267 e\340\200L.L\323\013X\310\314\357\3022:\366G\370\017~\214\007"
+	.ascii	"2\001\0238#(\016%\256\321K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_buildRcRuntime.92.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`N\006\005&"
+	.string	"\372E$\017Ep\336M:7\200\022\214E\210\246k\302\320\375$b\217\202<8\200\001\331\005\253\356\216\302\240\263\375\201\233\025fjEN(h\352\200\341\"\265\201\202\314\241,\301\021\016\313\210g\037\353\210\335\335\032!d\023)\223\f\335"
+	.string	"\315"
+	.string	"\344"
+	.ascii	"\306\325\235\356\311\216\345\367\262M{\315\252\317\301\207X\304"
+	.ascii	"N\2555\302\351r8O\017\220\327\355.\027m\364\206*\220L\013\302"
+	.ascii	"y\367a\257\362\273\330\215\023\325\332E\346K\255\305\t\233\340"
+	.ascii	"<"
+	.string	"\335\342\217\312\323\363E\345\351\376v\353\364pT*\013D\255\2532>\265V_'\331\335\311\342\367\344\337y;]\016w\232%%\233\177{\245*^\204C\252\363\274\3542p\201\242\033\373\271\206h\345\016W\226\326sD\316\265cHy\304$\255\311\"\340\332!\244q$y\374c\345iv\004!7\b\201c7Z\361\211$\013\310\315\037/\203\206WA\246=N\222I[j<\202\2068\310\005h\216\3149\332\031k\b\344\276\361&\210E\356pe\0019\233\036j\255\313\302a\3267\350\273/w\027\304.\355\023``\234\265\0021\354\277|p:\235\330(O\2733\300\021\313\235F\371\346~0\212\025\277m\257\337G{\t+\260,WnU\374\326c\276t\345\350\366\332-Rq\203'e\364lw\3552P\360\263\257\322\305~\003/\376\005\222n\366Ez\331\267W\362\n8y\003P\336#\312kDy\213L^"
+	.string	"&/\221\311;d\362\n\231\274A&/\317\344\335\231\274:\2237g\362\342J\336\323\3445)oIy)\345%K\336\246\274Ly\337\200\247\307\311\360S\366\324\252\343\rPe\243a\236\334\354?\373\313\336\273Y\366Z\216\266\272-\347\362\373Y\215Wa=U\030Q\211\207\363t\210+\\\370\335l\3525X\247\272\210K\354\324Z\354p\376\312>S\002\364\356\206\370\032\213\005Jj\255\032v[\\m\351\254\265b(\343\201\311H\311\215\243\020\317Q\0070\337\234Fi\324G-\340\b\330[Q\227m\324\007\320E\215Tv\345F\324"
+	.string	"\232\002\233 \330P\233M\324H\307`\024\241\316\365P\027X\013n\005\365\256\205z\002Z\020\214\327\274\016Jj^O8^\271\351\032\327\273\216\260f\266\331\272\226\220\026\214\202\333\2642\327It\316\306\275\270\230\263?g\211\230R\233\215t|\227\223]\266\013+\260=l\266\327\307\324\204\311)\273k\205\214G1RA\033\031\217[\375O\225H\215\025\346R\310\324\200\354\207v\357\232O\225\n\332T\003v&\370e\305>\346\270\321\"\333kk\224J\335ckM\310\314"
+	.ascii	"\331\317\322Vj\016D67m\222M\360\253\233\354_\271\3556=2\234\244"
+	.ascii	"z\352M\177\321\344\342\t\n\004\223T\013\0221\240\242\244\236"
+	.ascii	"\240\226\210\230\234\232\244\236hD\231\273Da)\312\267\344\302"
+	.ascii	"\367\324\324\302\311\267\0245\303G\241h\241d0E\371\244\240\240"
+	.ascii	"\242|\272b}w\355\331&\205\255\252\255\372\360F\330ik"
+	.string	"s\007mAv%\350\204yQs\007mC\335\t\024\006\336\324Zu\341n\212\307Q!t\204J\233\320\007\232?\351a\243\342@<\035y\334r\355\345f\377\206\317\326\354\331l\235\363'P\236\232}U#\365A\232\335\2553\300\f\220Z\251\276\365\033\251D*_\265\326\007:#@v\333\335\025g\023\320\037;\017Y\013\"V\305o|p\355\265f\034\223Aw\034\216\360^c\365\026\334Q{#\213\003d?'k\255\365l\257=\332\257\303x4Sv/I\221:\251\261v%\274\327\f\372\306\213 \013p\2501D\343\210B\210\031\032\231 #\205i\326\200\002\231\262\"7\0210Ek\212(HR\312pb\21457\005\330G\226c\242\\\371g\016\230C\255\224%\220m\003Rp0&K\254\035\026\to\3351\303&\242\323\277g-\204\262\352\004\016H\300\004\022\313\220P\026\233L\240d\035\210\374\356\027\303\272"
+	.ascii	"\231\225\331\366p@\335:T\371\016\f\0375\002\210\3617<\313\332"
+	.ascii	",\366\237\004{ J\031Ao\216\260\363crAx?\022\253\221\372\277F"
+	.ascii	"/a\314\016\214\003\3034\242Q\270\f\017E_BbG\025\203\330?\261"
+	.ascii	"\241\312?Yu,9\017\223B\037~\375\214x\316<\013xU@o\266\206p)\323"
+	.ascii	"\001\013\366(\242\237\031\324\205i\265u\177L\023\001\252.C\340"
+	.ascii	"\035v\266\003\0202aj\302\024\372\341\201\360\001J\333\224\324"
+	.ascii	"\006g\223-\343\223u\323\244t*"
+	.text
+	.section	.gnu.lto_rcChangeProfile.93.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\315\t"
+	.string	"\326\322D< \005)\035g\202D\027\024)i"
+	.string	"\253\240\315z\020]\021\212\301\345$\340fB`1Z\303J\350\252E\345~K+\t\246\006 *\204\020\203\007@\025f\201\b1]\033*\371[\246\0241"
+	.string	"2"
+	.string	"4"
+	.string	";\202\002\263;6X\301\363\315\240]\363\361\265\t'2,\031\200\335\345d\311\301+\350_\374@\330R]\005$v\327\032\266Bny\333\013\266#\354?,\"\2155`\2455{T\251$\261\317Y\351\262\037\373\245T\253\252\337!\270qi]\234\331\005\251\005\330\331\026cb\373\037\333\252\266\303\003\370\230\207\345\006~\313e\027>\314\245\251\017g\347\333\005\2046_\3418\240\tmw\\%\203\341\265\273\020)\037O>\354\2335R\372\360\233\237\352|S\251/\241\210\224\227\005\001\033\236\205i\302#\215D\363\243\360P\241\n\322\374P\246\331!\270\003u\037\327\2118\323(T\342\272\357\304\201\f<1\274\217C\315\371q\237q\317Y\351\362\320\304\331J~Xe\r"
+	.ascii	"3Cw\r\034\327\334Xj\321\211~\227fU6\327\215\271\226\013\371\007"
+	.ascii	"\306>\225\032\007\356\334\242\235O"
+	.text
+	.section	.gnu.lto_initRcProcessing.94.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\263\005e "
+	.string	"6\270\305E\200\336Mc\213\323\217\257\346\342YD|\315j0hD\361a\037\b\027\377$v97\026\324\223\361\364:\022\211\030\377`4\363\214{m\030\221\325\304X\024\177\030\027\006\350-\334ed\033\004K\2336\331{K\231R\255"
+	.string	"\250"
+	.string	"\267"
+	.ascii	"9\324\252\310\330\334{\035\274\264\202\363%\202\0270_\222\037"
+	.ascii	"`\322\260\177ub\215C1\232\246\341^\3325l\334\313\212s\3176{Q"
+	.ascii	"\352"
+	.string	"\366T\215!m\251\335{s\366\210\315\223\305\233\254\275\343\320\333i3K\322\326\236OBu\301\001\006}\307\325\364h\202'\341\220\337\254~\226\031\362h\363$L\177>\t\231nC\203An\n\031r\204\006\221\376\224\304d\242`H\300\234\340))5K\362&\324\022\005@\020\007)\241L\t\326\265^w\004\177\225d\242t{\255\227P\3040`P\351\325F\341\336\353\n\f\n\357\235\333.\263\235\301.y\001\007\032\001\016\353\263\237e\306\216\277\204\036\\9\026\335\020\212z \n\363\345\355\265N6I\321\262\320\234\353U\210\354\327\030\360\\\266\212{\255\260gc\367\336\tT\336\325\302\237z\351\035\214z \f\363%\217=\327\031\024\301\352\232\342\265dT\217\366\t\231\0339\326F\331\305_\265F\272\200\360\310ak\304\266\325>=f5\317\263n\224\254\276\221\325'Ym#\253M\262\232,\253-Y]m\365\r"
+	.string	"8b%x\342\327\275>\216t\256X\271e\311\263~\373~\361\\4\276\345\b)\332\241\370Z\217r)\275g\031\354Wx\037\2767\371\007\314\227w\272C\035T\327\3516@\3437\235R7\351\026o\003\234\023R\255c\273wu3d^\246\207U\301\202\005[\"\2453$\376\202\351\217\271\330\005\f\0324X\235LK\341\250\275\361\261~\230\213\341\340O\271\203\007\017k@#\361`f\020\220\361/B\013\244\274\370\330\023\277\001\352\352\f\270T\255\265\020\220\352\370\303\273\2008\357\275!\301\347r\260\020\"F\2140_V{\253\227KiZ\034\242Q=\2266\31260\266\307Z\262\352\340\250\335a0\023\265'f\221\335\250rN\336{/\351\007Gm\217\r"
+	.ascii	"E\f;j\372\325\243\005T\036{k\2230Q\003N\0214\304\202\350\304"
+	.ascii	"\216\367\302\304P\221\020\217\305\216W\344b\247\373!\272uA:^"
+	.ascii	"Nw\"\347\202H\250EN\307\213\221\013\032\340\335\213!^\256h\267"
+	.ascii	"\343\345pE\243\243\033\257\304\214\354\317?\363\327\265#\334"
+	.ascii	"\317\260ge\255\317os \243\223)\324\326\037\0258o\016dLo\267\352"
+	.ascii	"3\376\264\267\343im\020\331"
+	.string	"\032;\220\361\307\217\027\327\357\264\331\265\003\215h7\255\315\036Ii\216im\244\307!\223\232\003\235\315\351a\362%\211\355T\013@\006+\314\354;\243\230\257\256\3550\255\351b\332(\037\315O#{\030}7v(\204\352:\235\371lj\034\252{\327\370e\257ZK\343\223\331\354\2747u\250A0\250\030DhFdF\332\244\322\030\220\002\2311*z\02105\204\214H\224\032\007K\342\245\3131:\322\362\374KW\266\340(@\212\007\347\251\003\237^\\\007=\3018\235\260\013\0325C\334h\301\004\243\301H\177Z\366\264\320\350q\300\373\243N\363\0067\0367\223E\327\t\363%\364\310\016\325\305\025*\371\260\267zt\320\220\207\f\337x M\023\331J\222\300\037\241\304\323$\376\266\270\253\314T\272\221G\212J\252J\347\244I1~\224\214v\221s\273\232\251\300\036\236\340\016`\307l\354\247 \005\317\372\020\022\017.\233"
+	.ascii	"1%\376(\300\345Y\234\2027\251x\004^\333\033\313\343\360\204\276"
+	.ascii	"\371w\314E\b\257\224\310\371\232q\026BW\261\264\322\f\033.\277"
+	.ascii	"\377\253r@\036\342G\223\274\"\350 \324\252\351\230\224\351/\377"
+	.ascii	"d\364\t\367#\246\364 \371\231\214\376\007"
+	.text
+	.section	.gnu.lto_rcSmoothingIsEnabled.95.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"m\n"
+	.string	"\306\223F>0\211*\035t\304\223X\254LM,Q\004\2442'9\305\020\030K\305\230v*FV\0204!\201^"
+	.string	"4\316\037TZt^E#E\221\r4q\325c\212\021z\2668\375\021\331D\312\224\0024"
+	.string	"4"
+	.string	"6"
+	.string	"\033f\n\340\235\307K\263\343C,\023\336\212\005\002=\217\221\217_\035\022\360K\235\200\336E\331\335\017x\206\300/\023b\331]'\b\364\270\261\333\246\260\315`\037\"-;\364RK\366\257\335]+\311v:jZ3\235\231>69="
+	.string	"\277J\260+jIX\006Q\201"
+	.string	"\333\034[\342\207\b\216;\017M\242\005\224\351\203"
+	.string	"\302\006\244\360\211\271\352@\352e\304\312\335\365\2503\330U\r48\251\034|\031\301\366\366\002\231\310\356'\341\023xJ\343\007x4\307&\017z\3647\330\343\3652Z\200Ju\031\326*\032\227i\027Y\006F\005&\3238MVQ\360\246a\301e\033\333\306e\222\260\273\222\234\332\360\274\034\256\032\262\035\225\322\251g\325\250\377L\350\262\205E-\371\327K\003\023"
+	.ascii	"K\b\230P\307;Y\031&\204\001\206\001\316\300v\233 5@M\301\007"
+	.ascii	"\374a\235r\341\006\030\313\302\265\207\025>U\r\252\231\267\245"
+	.ascii	"\351M(e"
+	.text
+	.section	.gnu.lto_getRcSmoothingData.96.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"\202\214-3`M\222\016@\203"
+	.string	"7Ph"
+	.string	"\327z\200\341P"
+	.string	"\300Lv;-\023\035\333l\3028\307}\227\256q\005"
+	.string	"\227`\342\250@x\001\002CXm\224\fBd\nK\031\211z\022\303{hPpx\022\025\3612\230'\210\005\352IL\023\365.1[\002\243\314\252\326%i\234\270\235\272) \253Uw!TGP5\316\307\rk\035_\200\314\314\033\3073\001O\347\352\007%\023\243\205%S\334\211\347\327\374\345\206TD3l\027\025\325\306\301\007\210\205\311Jf|\307\016@uQ1P]\363(,\203\267#M\340|T\254kS\026\200\220\2313\353\312\350\255\277\301_\360k\004\b"
+	.ascii	"2\003\302\260\021a\203\205P\352\032\262\205\310\305]1\265\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.97.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"=\013"
+	.string	"\206\225M?\020Q\234\016;B@z<_g\003\320)\007\365\374H5\024\320E\217\276\037\b\2750\247\230\341\024)\375\234A\321W?\322'\210\""
+	.string	""
+	.string	"P\0041\331\031\0061\204\346\027C\337\236\354-eJ\001="
+	.string	":"
+	.string	";"
+	.string	"\217P3\363O:\025cKq\242\3630<R\034\016%^\0068\331\335\210\307\245B\002.:\320\220x\033<\360a\261\341\244g\307\3432\0014\330]g\347i\270\247\333v`\333\200\375\005\001\005dthY\262\277-5d\037\256\202l\247\243\246\325\351\314\364'8Bq\0305v=%\034\013\022W\210\260\275\261#V\300`\343\354\237\3103`\344\3011qc\367\253\324\303\263SJx\211\214\332\335\212O\342\037\226\t\227\313\364\230\372\026\037\362!\272\017\210\0363]\003\274\370\230\301e\210\355\353\036\030j\227\253\370#\336\221\361A<\372\202&\337=\372\232\351\361\032\266(\026VY\021*\n\226\007\227\312\3022\025E\200\257\n\020\260\312\302uaU\344\323\256 \247\"x\302\004W\355\330\216:\321t\263j\324srhY\232\242\206\374\253(\304\206\n\250 g\001\022"
+	.ascii	"K\b\230P\307s\262R\2370\\`*\214\006\205\224\300\004X=a\240\367"
+	.ascii	"`\241k8\340\210\0220\221\201\337s\204\366\253B\322k\013\024"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.part.0.162.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\031\003\355\026"
+	.string	"\206j\223I\300\224Q:x*\320\016RA\374#\360\017\240,\021\215\323\375\270\350/\355c\t\242\241\27098`\362\276f\300\247\230\361\267\nfNW\373\313\001\320W}KA\333\240V\212\252w[<\201\345\314\226\245\370\263\377\023B\344N)x"
+	.string	"{"
+	.string	"\177"
+	.ascii	"+vN\016\330@\242\230\261K&\230\363\344Ul\217\3479\257\302OV\355"
+	.ascii	"\0321\371v\367\300C\273\244\036\332O\201\343\331\366O\034E\316"
+	.ascii	"~\002\311\017\275\273\370\361\263tdw_\017[\316\">\004\257\">"
+	.ascii	"T\017\317=\004u\2129\237\347!J\006\364\225F\200z\032\016N\240"
+	.ascii	"^\206k\253\247\003[v\367\276\317\240\236\317\234)\027Q2\273\353"
+	.ascii	"\324\320\215\272m\b\266#\330J\023\323\255\023\2268\275\272\322"
+	.ascii	"o\242z\323\235\022\247Q'\177\361\345\035\212\323\340\234\326"
+	.ascii	"9=\317\342\177\n\213K\215]\241_\222-\ne\214x\3717}\332\367_\334"
+	.ascii	"\205\037\343>\257J\247\233\323-\b\204\220\232\324\303&\234[t"
+	.ascii	"\344\206\340\301p\231\342\341\001\370\341qd\310\356\032xh\006"
+	.ascii	"L\367\231p\366\312\316\331+\026K:K:w\255\317\r\021>\005J\206"
+	.ascii	"\211\301\255\020o\227\204\211\311=\007AE\262\233t\230(Z)Kg\016"
+	.ascii	"\225\252t\245\026\312\035\237\273\313\243\212\344\357\210&*\300"
+	.ascii	"\203\020\245\036\272\211\304)\rU\2454e\271KB\251\313\027\271"
+	.ascii	"\260[ \245W\262\243!"
+	.string	"*JO\244l\341\362\035|\254 \327\013~\277\"\272\335\036\002\240\206:\201\354\222TA\r\020c7d\252q\334O\242\352w$|\346\317\327\251\367=Lr\372\375,\351\231\277\251HV\361\340\352\221]s\032\005\025\264\321\026\203\315\260llF\333-&\322F[\f6S\253\311p&\330\306qV3\332n\260\025\004\266\034\255=\220\315n\034\310f0\332L\205\006\022(\300\\\216\275\304h\257\230\315\013\347\0066{\305h\265\327\213\212\307\034\031\355e\033G\332k\036\\=\362}Wq \n\002\242\250\313.\265L\217\372\204\212\344\227 rR\226\236hh\252\364D\203l\220i\325\310-E\321\377,1\231'j\317F\361@-]\301\240\304\206Ny\254\001? p\002\231b\343\006\221bb\271\f\302\354PI\003\237\361\364\220Q\f\233x\027d\bT~\215\023 yD\217\341\222\017'$)\264\300\345\fW\272"
+	.string	"\264\230\262%'\017F8\304\200\2201\224$\016\210\033\035\230"
+	.ascii	"a\006\341\313\360\037\360\254\001\374\223\303\326U\230;\366E"
+	.ascii	"\364\274\340\216$\350:\302\3744d\003\354\332b\372\233om\352\243"
+	.ascii	"\025x\334\355\356\226\350\006\347\305`a\210\223\243M\320~\253"
+	.ascii	"-\b\322\032\035\247y\312\272\365\3320\006"
+	.text
+	.section	.gnu.lto_initRcProcessing.part.0.197.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`\316\002\035\024"
+	.string	"&\341yI\3200'\035\370\234\004\007\206\027\364\022 \343~A_r\362@\2278y\242\301\206\206\330^\005\220\2039\361\035bi\371\267\303\006\225\211*\303\262\374bq\003{\021\341$\207\200\030\202\223\t\312\t\254\225C\f\210\251\266M\366N)^"
+	.string	"d"
+	.string	"j"
+	.ascii	"\256\323n\225\320n\004\263ZZ\211\203\242\332%\027\274\272\300"
+	.ascii	"G\223\271\316\024|r\200\236\237\253\331 \370\372\022\266k9\266"
+	.ascii	"\3317N\022\255\bn\352\006E\271\273\341+\375p\333\351\364l\276"
+	.ascii	"\201$\0357\235\231\323\347\016!(\211\306M\207\303g\200{\037\017"
+	.ascii	"v\327\037\317]o\273\201m\r\366\334\021$\211]\274I\306\242\bI"
+	.ascii	"\264\343\240C\215\262\334%\303W\223\237\237\342-\\\316\302-\037"
+	.ascii	"\034_bR\252y\304\206\\\235\234\347|%\253x\222\355+\354\364\335"
+	.ascii	"\331\343\2248\033T\273k\362\275\216|\300\352\325;\310\312\345"
+	.ascii	"\345:\233\370\360\030\341\223?A\273\316G\002\340\037\271UR\273"
+	.ascii	"\021\314\267E\037O\270)\222\3277<5sg\037\352Q0>\b\277`\3637\330"
+	.ascii	"\352\365\364\302\017\023\211\036\232\271\213\361\001\255\202"
+	.ascii	"\327\004U\"\244ff\217I\207L\275{K\205lpz\202\323\257\363\007"
+	.ascii	"A\324\356\206\035\217\005\252M"
+	.string	"!\276\004C\305\305*\340\317\356\246\310\211\345\305,\024\007\003\215\007\006A\267\fO?\372\213\232Eo{H\242\235#\351H\023\345\332\004Na\265Tx\315N\306\003Na\305\214!\254%\205\005\213\241\310DWH\3541/\013\262\b\257\225\030\2128Jx\315N&\254\210\343L&\272B\354b\271\306\320\205\022\312b',\241k|\tY \026[^c8\023\3051\004\357-\025\362W\225\223\242\24153\310)`yp%\325\222\247t\310\366\2442~\253\372N`u:\351\003H\250\241D\303\004\312(E\321\310\004\205I5\006\220\002\221B\243\003\021 \252\262\t3\312\336\001\330x\311xr\354D!9\365ltU:A\224\035\274:\236\022\234\241\210\025z\264J*\025\250\324?|!e\021\002\206t\036\354k\250\202\337w$\357\314<\364\326\217\013>z\370kt\026\312\302\031\r\321\305\200\352b#\3225&\346"
+	.ascii	"\2568\013\274R\224\211\300\027\301\203\236 .,q\306\3203\242\256"
+	.ascii	"u\210[#M\300qp\241HR\003f\256i\013P\205\216P\337\376\226\347"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`M\b\345\036"
+	.string	"\2463\271>P\350\312p\231\233\334\301\321\316J\265e3\262\302\tQ\257\364\031\336\035\213n\001\234\247\026\374\006\273\255C\362\346\224\211"
+	.string	""
+	.string	""
+	.string	"HK&\016LJ\200\252\211>|9E@\n\036\315\216r\313\024\245"
+	.string	"\242"
+	.string	"\254"
+	.ascii	"\375<A\372x\200\364\347\312\037'\344\343\203\314\036\347\343"
+	.ascii	"\361@\346\216\257\246\216\253\231e\036\330\026E9\372r82\2307"
+	.ascii	"\372sl\364\333j\364\217%\n\207F\237\255\374\325\214\3131e\364"
+	.ascii	"\266\241i\252\306\350-\203\261\\\346\213\245\342b\263Z\374\020"
+	.ascii	"\213~\\\271b\261Tl\232b\257P\364\357\224\347Y\036\340\211\376"
+	.ascii	"\236\322\304\r\231%^\210\304\205\021w\023!e\362\277*\032\002"
+	.ascii	"\203\t\342\202\226\3204E\337|\350\333)=\364\341\312\016\375:"
+	.ascii	"\f8|\317\374_\246jp\376\376\343\302V\tEQtC\377\255\374\017@D"
+	.ascii	"\227\224\245\377\bK?\360J\1770\254\017\t\254\237\310J\037\321"
+	.ascii	"W\337\317\253\257\250J\177QW\237\021W\277\321V\037\020\225~\237"
+	.ascii	"V\257VV\357\226\332\213.\212\242\377\202I\213\325\253n\332\377"
+	.ascii	"s\325\327[\264\357\247\354\025\233\262Y\350\214ymI\351\367)\243"
+	.ascii	"\034iZ\365\371T\365\363\240\364\365LX\260'\032\234,\226&{\305"
+	.ascii	"d\262]\346.\351\343\225J>i\315\350\314\352\222\364\357J$\027"
+	.ascii	"<rG\246\221\003\232E\376w>429\"}\273!\375\272R\302\327L\252>"
+	.ascii	"\335T?Y~\360LP\032!\001\352\226k\037\244\343\031r\002\365y\206"
+	.ascii	"\f\225n\201Ew\\\347\220\237\214\273GB`\252u\037\240\351\245\235"
+	.ascii	"\316\311S\353>\310\023\023\370\267\223y\254\355\023\231\0303"
+	.ascii	"\341\311\t\326:'#8\302\235,<\3329Y\250B\031\357\234\374"
+	.string	"\264n\221\f\216\357q'3\255m\0036oI\341\311\233n\231\246\353\213\236\320\001\001=3\311#+\034\"3s\267(fR\221Bf:\2669\361\222\272+\bf\222\333\3478\261P\205Z\367vY`j\316\326\304k\\%\364\330\304KcJJ]z\253\220\365zq\351\375\332\322kEKo\330X?\222X\007'\260\267\007\326\340\2411 \305;\226\335\024b$8@\2127M\335\253\325\025y\321\316\316\030\227\314\272f\230>\266\337\025\267l\265+r\033\227\323\264\006\177Wd\253u\003 \355\262\236,r\025^\221\253\214SS\352\256\236\"G\035w\213,Lw\t\322\027\240\0231\302\227=bO\022Y\300\3362\212\242WJDf*\333\373\315\375\351E\021yio-`\265\371\033\022y\367\366\351M0N\023\221{,\2052\202~\247#\362\2221\312\ry\307\250sC\266R\327\251\215\027\273#\207\\$]"
+	.string	"k\3409d\252\265U\220\034\004a\310Q\001\200\202\250A\f\204\222\245\2210\222\242\224\024s\300\002\251\241\342\034\021\240\034*\215!$\020\021\221hLD\036\217"
+	.string	"\007w\354\357.\326S\355\300^\212\363\352\\\024\274bH\006\235goR{$\270\351__\324o\263\243\213\312\301{\267G\275J\352\274\205\254\322d2\255\350gh\275\351\0057K\002\321\214\313\276\321<\307<\246s\216\361\234\346\034\3463\333\300\177T\244I\0161KS\313\372\246\322\360\003\312g\305_/*\2210"
+	.ascii	"\302Nd\320\371e{\342u\005\372\270\216\320\305\032\262\326:N\251"
+	.ascii	"\n\223}Yc\376\013P2AvBc\004U\224x\275\002\201\365\224@\363I\263"
+	.ascii	"0j\021\207\365\241\034\306\367\007\244vQ\345&,q,\276hX\232hb"
+	.ascii	"p\001Y\203v\322\330\232\210\265\326\213\256-\330\226\361\310"
+	.ascii	"\027\032\310\301./\007$c\312\232A\260\223A\316\310Z\251"
+	.text
+	.section	.gnu.lto_.refs.56625491ce8ba9b8,"e",@progbits
+	.string	"(\265/\375`5\003\345\024"
+	.string	"\226q\213G\320TQ\206\003\004\200{\213\317\341o\017\362?E\322\004.\360\006v\320\370\322YN\264t0\371\233A\256f\220\253\031\344j\006Yj%\013\202@q(\372\322$\225\215o\017]u\371\253\375m\345\257\366Y\373\244\221-Sn"
+	.string	"p"
+	.string	"\205"
+	.ascii	"r\366(\331\223\344{\261\225\224\2532\254wtJ\257h\224\336\357"
+	.ascii	"W\017\205=\206\273\342\261\257\277\276\316j\275d}\352{\260\325"
+	.ascii	"K\362?V\017\255z\\}\345\252\3230\324\207\251w\201\177\002vV\252"
+	.ascii	"K\260\247\300\007\2757\241~\204\332\244\364K\027o\211\361\332"
+	.ascii	"\361\324\335"
+	.string	"2uYz\325\327\277\276\210\364\336\250w\242^\357\020\251\213\275\375~\210&\263\237\314\336\232\2355\373jv)_5;(\0375\273\211\374\323\234\035\315.\232=4{g\353\265\035`\026\213\346\207\346w\036\323-\3470\275f\366\267\331\273\302\357l\227\320\2570\365U\320\376\024\245\037\005\255\037\344\365M\260\364K\324\276\207\345u\302\307\241\375\r\255\343hOc\3521\261\2071\365\026\357k\245\227\325:\214\345S\274?\t\277E\353\001\357\342\365\231\315\243\310\017s\357R\351#\225\336\345\256\271\035#\3530\270\237\311\227\231\372\312\367\260\322\203\262iL7\302\017\204\007\016|\030x\275\013f\274\nd\276\t\020(\t\377$H\216\024\221\371\211\b\t\002\344\207\217\036<v\350\210\3759p\334\260Q\203\306\f\0311f|\030/\\\264\230s\316\374'f\372@\363{f~'\3667\263\307\335\376&\323m\336\277\204\337\"{"
+	.ascii	"\263\327f\234v\353\260\331_\263\273\002\337\315\003\361\316h"
+	.ascii	"\240w\262@\374\025vW\330[\341\257\302\256\n\037\f\373I\276)\354"
+	.ascii	"%R\377x\342\243\236/\2018\300\344\216\324#O\024\020/\316;=~\325"
+	.ascii	"\2117\310\004\211\021\"B\200\310\371~\310\211\327C\007\016\033"
+	.ascii	"4d\310\351\305p\001\367\265P\201\302\004\234^\t?\362\353\343"
+	.ascii	"}\033\340x\375%\322\373\215\334\374C<\322\037\224\373\201\344"
+	.ascii	"\363\344\376\306\3539\357q^\267\331\374\213MC\250\021pN$I\"\231"
+	.ascii	"\211\n\nJ\332\006\340\"\252\031;\020\350\013\233\001s\024\271"
+	.ascii	"u\374\002v\233\212G(\335\274\237xk:\330`\\w\331\036,\"z\305R"
+	.ascii	"\363\304TB\024\r\220\201\303\006$\304\363P\302d\002\342\202|"
+	.ascii	"\t:\036k\222I\361\020\333\324\304\212}\221vW\247\211?@\021_\026"
+	.ascii	"/\2350\352\\A\363R\001\234\275\244"
+	.text
+	.section	.gnu.lto_.decls.56625491ce8ba9b8,"e",@progbits
+	.ascii	"(\265/\375`\265n\365\304\001j\336\356\240T Ja:\215\001\3003\371"
+	.ascii	"\t8\031\363\232\314\246\276(7\207A\352=q\311|\342oT8l\f\027N"
+	.ascii	"N\304\312\367\235\254\337\235\017Dj\300lk\332\266\030\256\353"
+	.ascii	"Nw\\\305jp\355\357\373\276\353rV\001\201\3040\f#\300e\316=t="
+	.ascii	"\344\336[J)S\231\b\031\n\204\nK\277~2\221<XPn\276P\026m\223\026"
+	.ascii	"\311\254\300\036\231\027z\242/\324C_\350J?\350\217~\020\035\375"
+	.ascii	"\2407\375\2405\375\240\243~\220Q?H\206>\020\036} 6\372@b\364"
+	.ascii	"\201\314\364\201\236\350\003mi\020\354\221y\240+}\240\242\276"
+	.ascii	"\236\243\257\335\364\365\231\276n\242\257\203\350\353\034\372"
+	.ascii	"\272\250"
+	.string	"\177\326\351\237q\372H{d\376\364\242\177\222\351\237L\364O\037\372\247\r}\323N\337|\3237\271\350\233O\364M\243\276iC\277\314\243_\306\351\303\261H\346\3136\3756{d\276\274\242_\026\321/u\350g=:\304\032\375\354E\227`\221\314\347&\372\231K?\303\320o\253\323w\233\243\217c\320\207\263G\346\357,\222y,F\037#\365\235r\251\330\263\244[\205\r\225\215\0377\037[\321!\3306\311|\236M2\217\207\350c+\375\344\223\343\251\207\313\031.\373\205f\215\022'M\314\210\3145\271\031O\210jM\020#\223%,\266\266\310\226\\\2435\356\335\201(\007\032\230\017%\036\316*`\204\024I\322\201\256\022\303E\f\t\017\"3\252c\217#F\336\364H\371s\363\177\215\024\031\252\363R\345\315\315_H\023\311\235;Bn\376\355\243\377\337\256\353e\317.\221\253\365\273u{<)\204\177\211\310\215qy\224"
+	.ascii	"#\013hF\034\232\344\022\221\353\343\016\261pGv\006i\264\216`"
+	.ascii	"{\357$\021\"\256\223\264\031y\314\374\337\037\277C\376\373\342"
+	.ascii	"\302\270F\374\226%\347\305\315\027\310\rb\317<\\!\273\310\326"
+	.ascii	"\035\241\272q\363/\234\006\301\336\326\203i\363\362\254\007\363"
+	.ascii	"r-\375\376({\240\031\242\344f!6}\267E2Ad\321\377\345\261C\247"
+	.ascii	"\271z\322\347\346\253\343\026\253\354\261\272\371\227\212\376"
+	.ascii	"/\016{vs\234mh\177\030\232\222CI\230\233\357\325\275\361\037"
+	.ascii	"\310\206\375\220+\273\371\332\270X\366\354dn\026P\025r\237\355"
+	.ascii	"\275\2132\025\030rSn"
+	.string	"\376\205\242\245\366\336\333\236\214y\346\345\345\345\331\2231o\r\240\233%\207\216\317\315\267\2734\376\003\235m\272\214I\316\316v\255~e\334\031\317f\306\342q\357mTb\271\321\343v3\b\213df{d\376.\321\277C\264EZ$3\251\352R\235dW=\254n\236\262e\316v\357\032\272 w7\017\331#\363\277\305\273\315\030B\316\326\374\371\335\277%\263yg\273\306\275\273\354\275;h\031v~\366\334l\267E2\255\333\322\355\037\003(!\022\346\207\202\"$\217+\"}\370\\:iR\304\334\374[>v\017\266\252a\334Z\366Fj\b\302#E\t\326\315xIAW\232\240\241\271\371\367J?\00488G3o\026\r\021\336{J\316\321\222\205\301\373-\035[\307\322\331<V\216\275c\355X<\266\316\352\261I;\307\336\3313kgc\270ec\343~\221{W\215\235\2413\346_\272\265\263dl\233\205;\242"
+	.string	"1;\311\265\177\311\316\246\261h,\334V\016\233cg\267X0\026\356H\026\333c\325\324\304)\003C\235\243\030\322\246Y\270-\003\204\361I\356\215\274\035\373-\231\235mc\343X\270\255,\245Or\357\375\021\376\24556\215\b\357\035d\356\2707\362!\374\226\354'1\202\265\263bl\332\007\252\275\203"
+	.ascii	"\251\200j\216\r\274\273\275\221\"D\210H\022\221\201\356G\233"
+	.ascii	"%\037\362o\345n\343\374\026\213\035\263sCIv\344Xs\263}c\341\334"
+	.ascii	"\316Y7\333\316\211`\334{\312\316\025\365\331{\252\310\332\013"
+	.ascii	"\254\275"
+	.string	" \207y9\331b\346[\030\264\275\262t+W\024\307f\327\344\346[.\372fY$\023\003{d\336V\321\267N\364m\021}\313\245os\350\333\032h~\353f\315\3304\r\250Nz\244\335|\013C'Y$\023\333#\363\036\320\207\263H\346\237\364\223\026\311|\005\364M\320\277\355\242\305\256\3316k\334\273j\357\335\241\b\017\223=Kn\266^\354\027{\326\201e\273\345b\325^N!7rod\321U\342g-\313\315\037\200\276\355\300\304yy\266\003\323rY\272\355\362\333+V\354\310\314\332Bn-{\357\"\334V\006F\237\233\257=2\257\244A\260H\246\211d\3322kf\317(\260h'1\302q\321l\213\355\215,\312\360\307\312\037>7\237\003}\233\345E]{\204\007\351[\nL\233g)0\1775\220=2\215\354\221y-\026\311<\322\"\231\332\036\231\377\220\253\376<\225w~\341\307*\020\375f\217_"
+	.string	"\005\363\306\177Ap\255\3022\374g\324\265\342\300\177\223\342\360\224\377np\272\240\302=\321,\0070`(y\375q\006\231\370=M\262\372[\245\314\001\334\200\377\033\374\246\326o9\300H\362\323oA@\273\320\1776 \007\177\213\301\355\374\326\002\013\342r\376\353\371o\334\223\224(a\rL\024x\310iB\310\231\200?\037\271\360\337,\377M\373/Z\336\300\217w"
+	.string	"\221"
+	.string	"\370g\013\234\302\376\233\227\233~<\005\201\314\364\333\013\376\374\273D\376\373\225;\360\3757\202\313\365\347\025\377\355q\265\374d\364\277B\377\345\363:\377\321\352\376\263]\033X\267\300\377\r7\311\335\340\016H\312IY\003\177\356\345\013\374\267\256\224\373/]\256@\016\372\357\034\n\374\227CP\236"
+	.string	"\006\262\004\376KA\210\263A\340\306\035\355K\377\331\301\217\373\344\b\374\331f\025\326\202\020\344\026\376\234\002OA \233,H\345\007\334\016t@\272\023|\260\032@\320\301\275\273\200\002>\334\260\221\035\360\343\016\340\027\350\177\n\375wjN\001TC\377y\376\267x\347\256\b\034\260\251\330\021\374\247\375\257\b\377%a\204\377\222\370/\325\177K\270V\017\372M=?\356\340\307n\177^\341\307oY\205\377\276\370o\b\376k\302\177\247\376\353\302\315\217\347\376\334\200\344\217\357\376\314\200\377\252\377\365\300\177\211?\266\313(.\bn\361\277U\367\205\377~\240\003\377\215q\025\360\347\024\376spOtp\345\256\325K\370\315;\177^\200\232\177S\356\307'\362\t*~\376&V6\221M\370q\207\fB.\361\343_V\300\217W`29\001\377\255 #\340\277I\027\350"
+	.ascii	";e\340\203\337\034\373\361\330\217\311\376|\200\337\226\375\266"
+	.ascii	"\211\265\300\272Y.X\0046\373\357\233l\200?\027 \311\202\341 "
+	.ascii	"\227\360\3376W\201C\374\317\3407!\220\366\343\265?\223\370\217"
+	.ascii	"v9\354\311K\377p\244\337L\261\207\243e\020~\214\224\374\337f"
+	.ascii	"9\374\026\203?\217\370\355\006?>\302\032p\206\244\377\037\276"
+	.ascii	"\207\203\2538\007\277\331\341\177\236\263\350E\277)\364\377\316"
+	.ascii	"\377<\247\373\177\346?\336\371|\310J\377\225ks\243\337\304w\300"
+	.ascii	"\361oF\321 \001&E*\220\374\366Z|\025?N\361\337\374\315\257?\207"
+	.ascii	"\3703\006\177\006\361\347\t\376\314\341\317\031\376,\364\347"
+	.ascii	"\363\317\371\317\367\307~~|\367\343<?\246\373\361\334\217\337"
+	.ascii	"\374X\315\217\335~\\\346\307b~\274\366c\265\037g\3711\331\217"
+	.ascii	"\303~\f\366\343)?\216\362c'?n\300\217\223\374\370\353\307C~,"
+	.ascii	"\344\307@~\314\365\343\036?\326\372o"
+	.ascii	"\335\217w\3748\307\217o\374\330\306\217i\374\330\352\307/~L\365"
+	.ascii	"\343\375\343\016\374\330\305\217\325\037\243\360c\341\217]\370"
+	.ascii	"\261\323\217\323\037\257\370\261\006~\234\201\037_\340\307\025"
+	.ascii	"\370\261\004~\254\342\307)~\354\200\037\253\360\343\024~\254"
+	.ascii	"\200\037\033\340\307%\374X\204\037\223\3701\b?\376\340\307\""
+	.ascii	"~\034\342\307\032\374\330\303\217;\374\030\351\307G?\326\360"
+	.ascii	"\343\242\037g\370\261\320\217\317\037\227?\306?\266\377\265\373"
+	.ascii	"o\336\177\225\374\027\311\177\375\374\227\317\177\367\374\327"
+	.ascii	"\306\177\357\376\033\343\2670\374\317\373m\327o\221~;\342\267"
+	.ascii	"\037\374\326\202\337z\360\333\373\037\357\277y\376;\347\277s"
+	.ascii	"\377}\363\337\024\376\243\375w\203\377l\377?\374W\361\337\001"
+	.ascii	"\377\225\373o\233\377\306\375\227\315\177\325\376K\366\337%\377"
+	.ascii	"M\362_ \377\305\372/\215\377\316\370\257\214\377Z\3757\304\177"
+	.ascii	";\370/\006\277u\373\337\302o\301\3746\314oA\370\255\322o\003"
+	.ascii	"\360[\021\277\005\300o9\370m\210\337v\360[\374\333\377_\341\377"
+	.ascii	"\236\377}\376\363\371\317\365\037\315\177\013\362\362\362\362"
+	.ascii	"~\242\024\376\016\035~\006\234\bv/\353^\247d#\245\311\226\233"
+	.ascii	"?A\231\376o\177\177sOe\355\275q\224\310\235E5d\376\366\266\264"
+	.ascii	"6\304\237\301b\213\301\377\274\267\320\003{\303\320c\334{[<:"
+	.ascii	"\n\333\024\027\210]\302\355]\325UT@\327\215\252.-\253\263\256"
+	.ascii	"\033\032\254\316\272v\261\252IQC\326\356*Z\235\355\255\241\252"
+	.ascii	"\252x\202qk\260:\3337\366\01367\354Fv\025w\225qk\330U{\n\204"
+	.ascii	"UU\327\r\253\263\251\033\032\254\316\272n\354\263\256m\264\253"
+	.ascii	"\246\262dT\355,\r\373\254\213n\237\031o\030Y\235\031oX\235u\325"
+	.ascii	"\261Zh\\\201\302#\217\221\211\034[fU\265m\\\375\230\3122\202"
+	.ascii	"\263B\0327\234\275\255\026\030;k\303\355\215\301\336?\214Yp\246"
+	.ascii	"\264l\033\025\234\r\252.SF\213\334{{\270\242\3622\356*\270\242"
+	.ascii	"\335pVR\214{K\241r\332W{\357-B\021\t\267\221X\270\"\221\037\273"
+	.ascii	"\006\214\275%\330\310\275\257\366.\332\r\267\367.\356\275\317"
+	.ascii	"\254\037\310\275}\030Y\035\257\256\366\336J\272\332?\212``\354"
+	.ascii	"}\265\304i\273au\346e\\\002\223vv\3341\220EkU\303\270\217\033"
+	.ascii	"NW\226>+\226\355\032{o{G\037o\344\250\253Q\316\0012\372\3102"
+	.ascii	"u\363'\250*\345\314\335\236\225s\245U\n\310],\242B\242u\274\333"
+	.ascii	"YY\036\\\002<\372\r\222\303V\025\0337_\0029\272l(\016\036/Z\220"
+	.ascii	"gj\336\270\201s3R\f\013K\2111.\215\222\2702yn~\bd\334\326\330"
+	.ascii	"\300\2449\266\275\231\t#\346\214\231\362L\211\246\204\241\214"
+	.ascii	"\241\\S\302\225j\312\267\322\255dc\317\3124e\0316.p\266\314\255"
+	.ascii	"\225i\3121f\222Ke\232\262K\371\205\250\210\334E\223\313\035*"
+	.ascii	"e\204f\330i\361H\312\227\340L_\002)\372\022t\351K\240\245/A\f"
+	.ascii	"}\017t\372\036\342\364=t\321\177\351\345\345\027\323\252\252"
+	.ascii	"K\312\315\245\326\322K/pn\200\331q\363=\210\351{\230\242\357"
+	.ascii	"!"
+	.string	"\211\276\007\035\372/\265\224hj\252\234\301\273\371wF\231\217\243\331\331\210\252\2146\r\252\036\307\362\254T+\323\354Y\211Vf\021+\321Jd\224(F\352\356D\024My1A\242\363\223\354\350'\321\321O\222\243\2374\207\005\214\216\234b\361\346\207 \005\311q\006\024%kO\226$\301\312&N\23449\036\231\224W\312\260\322J)V\216\225UJ2{V\202\225S^R\261c\324J\2602\212m#\232B\356\254\btA\t\003\333\033y\236\325\241\001\306(\023\331#\363In\372Ik\372IV\364\223\234\350'q\351'a\351'M\351w\250c\262\204\314\327\030\r$rO\034\226\236RI\231\204\253\354\017\334\315H\220\031\276\264)\333r\363;\254\321\377K#\345WY\304\236\225G\312!G\312\256\222\210Z\026.c\217\344\b\345\221RH\327\037\034f\0224\"|t\016Qz!\213\206\246x|\211\341\346w"
+	.string	"\323\357\320D\277\003\227~\207\034\372\035\254\364_\006)\201\b\241]Q\"w\363\377\362G\311U\366(}\224[\366\254\004R\362x\251u\265\334\336\310E4\020\003\005J\330\035\016\037G\035[\307\034%\220r\207\210s\013\2257C\206ri\217\314G`\247\037\301\034\375\b\326\350G\340E?\0020\375\b\274\364_f\225X\026i\264\342\307\306K\254_\243}Q\347j\317\315\345\325\322K\033D7\254\240m\271YCY\243,\236c6\017\032e3\262Z\2263aS7\377\245\214\227V\345\037\270\253}s\031\003\217\314N\306\315\217"
+	.ascii	"K'Q\3625c,-\257\341\262,\315\226eOY\314L\262\025\\\226\225\342"
+	.ascii	"KF^\"\366'/\t\373\262\342S\302(\253\312\251\274\247\244*w\356"
+	.ascii	"\223\377\224/\262\237\234g\317\312b\316\363\254'\337U\345\261"
+	.ascii	"\262\230\311r\026\\\226\245\303\304\371Y\262\313E0\362x\246y"
+	.ascii	"\335%\363\030\032\237\262\230\271d<\270,\353\001Y\360\362\330"
+	.ascii	"Y\237dNR\0263\036\215\274\244,\346+{\252X\002\226:\244\315\343"
+	.ascii	"\322\244\214\004\371H{\264\020\322\"\231\026\314\036\231Gr\243"
+	.ascii	"\2174Fg<\177\036\313[\362\235[~\331#F\355\346:\017AX\344\344"
+	.ascii	"\211\335|\244+:\231\277\3442\270,\013h\206\227\234\244\235Lg"
+	.ascii	"\317r2\303\220\223\331-\327\3318@\030\363 \342\376\231\321u\306"
+	.ascii	"\314t\264\227$^Un>\322\022\255\306-i\311\320p\265\211\235!3\263"
+	.ascii	"\364\346v\334b\243\306L\022\216\212%3S\306Lr\357\235\346J\033"
+	.ascii	"\234\354&\307\311r\262\\\236\313sr\\~c\317r\233\034\303s\227"
+	.ascii	"\354\345yF\233\274\306\036\311\334\222{o\241\2556+8\034\362\221"
+	.ascii	"\220\350#\371\320G\322\322G\322\241\217tC\037\311\206>\022\r"
+	.ascii	"}$+}\244\027\372HS\372\034\354\3649\244\321d\222\"\360\206L\353"
+	.ascii	"\346sh\323\2773\300\234\215\bho\267\261c\230\314v6\242*\344^"
+	.ascii	"b\2761\213s\273\333{\377\317c\262\030{\226\303\344\266g\344\026"
+	.ascii	"!\"\t\310\312\0200\030f>\007(\372\034\212\350s0\352s\340\241"
+	.ascii	"\257\321\"\231\032\330#\363\034\2604\320\266H\246Z\326RZ\251"
+	.ascii	"\373\372\221G\355\310\215\376\221\030\375#\262lf^Q\331s7\377"
+	.ascii	"\310\2503\226\214\264g\271\354\373lod\006<\305\343\215\355\346"
+	.ascii	"\333\020fQ\b\363G4\264\315\262G\3467\334\321\337`F\177C\232\006"
+	.ascii	"3\343\224\301q\335\374\rI\364\255X\0235NN\006\227e\3514\257\267"
+	.ascii	"\344R\226\222\241\254IN\311U2\225\034\305\236e)\371I\316R\362"
+	.ascii	"\361l\026N\313~Q\026\200+fP\302\356\366\336@=\342xi\005\345o"
+	.ascii	"\220\241\257\201\216\276\2069}\rq\372\032\326\350k(\243\255\261"
+	.ascii	"\213\266\307\214$D\006<7T`7\377\371H\221+e\274\264\334\234\213"
+	.ascii	"\334\374\225\215<\027\311DNb\204\017U\345\"y\357)k/ \262\366"
+	.ascii	"\202\222\f\223\251,f\276\2064\375g/2}\372\210\335|\253\326\206"
+	.ascii	"\316\233\034#\343\310<2\220<\225\267\362\217\034$\373\310/rW"
+	.ascii	"\246\3120\362\220\274#\013\311V\271G\226\221\265r\215\234#ge"
+	.ascii	"\256|\225i\344\031\371F\326\221m\344\252\214e\317\262\021\347"
+	.ascii	"=\357\\\264dsk\2161\334\215\275\3659\302-"
+	.string	"\321\261\261\271`\026n\313"
+	.ascii	"`v\304\344\274\035\327\330\264=I:h\222ei\374\300\271\263iA\266"
+	.ascii	"\034\367F\332\331Bc\323\376,\351\301y\270\034\223n\307\275\221"
+	.ascii	"\331\210\371\340?Dxo\"X\216xkc\352l\332\027\265:g\222Kw"
+	.string	"\274,\341\301y\272$-\331\2344q\324\034\317\344%-\231\0339f\342\366hIne#\226\233Cb\204l\304jl\032Q\021\271\261N'P\224\214I\0022k\242\205\305\204|\223\026\311T2\242\361\2374\r\234Q\362l\324\335\214\373,\035\373\251\300\013\03107\237\366\310\274\206!\372\032\260\364\215\374\350\033\325\351\033\201\321\330.\363x\373jr\363\215\326\364\215\216\372FA\364\215\246\364\213\354\364\213\342\350\027\251\321/r\323/b\323/J\323/\242\242_\024D\277\b\206>\321\035}\2423\372D_\364\211\314\364\211\240\350\023\375\320'\312\322\317\360G?C\033\375\fh\372\031\230\350g\330\241?t\247?\264F\177\bM\377\330\214[^C\023\262\311`\030\256\321\032\255\376h\355\270\371\"-\222\031\302\036\231x\314\3221\031!.h\3748\271\371\b\213\t#f\353\314\226\233\177\034\006{\305\261\203\363\345\346\207"
+	.ascii	"\247Fr\353..\316[\\\217\343\032\336\\r\t_\2419&\375$\267\354"
+	.ascii	"\350l\335<s\216ol|@\261r\346-\006\256\344\230\333\021J\230\031"
+	.ascii	"1\344\2272L\222sv\376$\337\324\004I\316\221\221\364\"F\016\254"
+	.ascii	"\354\277bf^\216[x\342\352\270)9\212\255iIn\351\221\003E\312\005"
+	.ascii	"{\201\346\213\330\021\215L\223\243\330\026,om\276\266\304\350"
+	.ascii	"X%\331\332\256\034\275\200\t\273X\302X\361\272}\360\f\214lC\201"
+	.ascii	"jMr\216\256\317\234\234\031#\2409r\274s\227|{\203v\345\005\206"
+	.ascii	"%bjkG/g\220\\1.dI1\354u\311,\032\242\242\321\336_l\307\275\267"
+	.ascii	"\2274B\216{#\305\322\266$q\020\f\004[\301Z0\032N\303E\360\031"
+	.ascii	"&\303?0\017L\004#\301W0\025l\004\373\300`8\n\206\202\237`,\030"
+	.ascii	"\007\256\202\263\340$X\f\013\301G0\023\374\205\313p\016l\304"
+	.ascii	"jx\r\263\341)x\013ka%\030\f\356\302M0\022K\301=\260\031\356\202"
+	.ascii	"\235`.\274\004\217a.x\013\016\303m\370\013>\342!x\007\366\202"
+	.ascii	"u\3303\354\205\261\216\263\360\215;\027\207\006\215\267\373\006"
+	.ascii	"\367#y\275\230I\222\204\202\275l\033\033\007#\217'\320\336\222"
+	.ascii	"f\376\013%J\232\343\025\313\322\345\312\177\267\352\360\222W"
+	.ascii	"\354vy1v\274s\267N^R\213\034\326\321\215\234\215\243\330\331"
+	.ascii	"\027\227\032\266\215h\312hWQ\245\361\3026\316$\367F\3367\257"
+	.ascii	"\273\346\013\310\365\342u\307\2409I\356\215L\302U\332\204\024"
+	.ascii	"\355\316\347\037{d~\bL\177\b\211\376\320\226\376\220\f}\241<"
+	.ascii	"\032\317\370\357\236\313\007\313\260@:\314\204\371r\263\025\376"
+	.ascii	"3\343\313\330\315\027\262\243\377\343\027\270\n\303\300T\366"
+	.ascii	"\f\307\300\305\337\021\362l\032F\036O5\257#w\006\216\201\247"
+	.ascii	"l\033F\266\351\030Y\222"
+	.string	"\250\335?6\215\250h\264\251\342\220,\341\030x\357\"\235\bQ\350\310\322\334\355\215L\022!B\204\210\022\311V]\\P\276\320\030}!/\372B\\\364\205\326\364\205\324\364\225\021b\322\356\276\3400\313_O\276\\)3\345\364Z\0358\032\3102\034\304\250\321\206\305\266\231Z/\370p!;\311\212\210l\361Y\033;\263\3001~\325\270Y\207\351+\327b\327bW\213\341\274<s\254\215\232\231\265\024-E\203]\343\0269'\311*\327`dJ\030s\360\260\271YS9\031>kX\332\334\254\247\234\314\211F\215\227\220\017\270\350_G9\325\202\326\362\350\346@)\371h\"~\200\304\351'iqo5\250nF\342\tC\223\274Y'\321It\023\233\225U'\202\231\034F\352\356\256\231\\7\241\222\205\016\230\233\365\222\263\225}\201as\263V\362\001\222\b\021}$\311X\274\023\2001\263?8\360\214\255.\\G\214x"
+	.string	"\233\333\332\210.\222CF\030\026$Ejpz|\350\257r\b\035\fBb\334\374\017\226tu\235T\307\2538b\027\215\r60~\200"
+	.string	"\321Fk\204\244\222cr\0242\206\3211G\310\265Q\3678\235\330!\341\334\254\203"
+	.string	"\225\255\351q\345\346:\036<4W\222\261H\247\001\231,F\352\3544\241\361\304\3075\3275\n\311\241\273\022w\263\326\322=\356\232!h\226\350-\271\035:\242\334\374"
+	.ascii	"\304\321\267\273F<K\212pX\307\322:\222\214\305<f\237+7A\356\362"
+	.ascii	"\350\340\372\350\034\327:\352\\\221\233"
+	.string	"SD\343\200!%\007\232\306\241o\350\230\201\007\313n\343\2709f\234\350\2542K\227<\271\244\326\325\325Ie\3156\226\213\033di\300\376\270)C\347\346\007\240\250eh\031\232\306yw\205%\bQ\\\221\0314\364\214k\032TS\226x\271\371v%\235\377@\031\300\350\310\365 \003\003\206\216\221d,\322\001 \353\352\n\036#{\306\342\350\030%\036^\017\243\237(\272JW\235TI\306\242\235\220\216\2147\345\312\355\346{ $/OOA\211s\003#\3723\207f\353\342\365T\020Z\237\25797\353\355A\326\236=\247\237*]qnwBT\304\274\001\323\347\247\237!\253)\273\261\233O>\247\234\327\332\034\017>ww']\222\336cY\314$\367\336\n!d\344\207\033\033t\356\3349\363$\351=\026\347\226\0243\306\006\317\356g\036\266<\004N\017#7\237x\316\366\245\f\216\2225r.\347\244\263f\033\253"
+	.string	"]qn`a\340\334\200K\376\244\003\373\303e\307\315\347\234\323\316P\216!wlv\352\340'Llh\221\271vW\352P\321\311m\227\216\r;}D\254\315\315\235o\230\034\265\332\226\037\\7_\304\024\270\303\235o\254\331\306\022\300T\234\033\330\336[!\234x\324\325p\363\363M\221Y\2153x7\237lN9\030d`\361#w\266\001C\344\310\024\235\241>\\uo\316\270\034\003\226\322\025\006w\363\031\303\331\334\314\274$M\271\213\020r\346\314\251\306\032!\251\336\\9f\3303\265\246\346\355\247\232?uZS7\237il\233\016\273;\"\345\346\023M\220\034;h\302\210\230rs3\217\350)#Ks\362 \242\345K\034\231\237\314Y\346\270j\007\361A\304\243F]\030\214\347E\212\2142\266-HI\031\214!7\037"
+	.string	"a\270\374\004\303\345\024s\216I\332TU;\b\222#>WJt\334m\253\037!\232\212\bI\023\346\247\2304f\036Z[\327\311\366\263\355\007:\337\310\2411\273\371"
+	.string	"\360\241O/?\277\374@%W\0169Rn>"
+	.string	"v\350\377\354\362\003\r\035I\243\246\356\346\003"
+	.string	"K\037"
+	.ascii	"Vkk\247\2325BR\305\345\035\367\336\n\241\213e:\244\370AC;\325"
+	.ascii	">`\2113RW\001\263&ui?\325\330\254Z\234\030\304\324!\221g\226"
+	.ascii	"$c\321\316\304qU\344\f\226=l\306N\263\237Y2\330\241\301\221\335"
+	.ascii	"|\273\263\354?\220\251\006\253\317\236\020g\247\230\330If\315"
+	.ascii	"6V\222\335\220\255\020C3\354\370y\033\373I&v\326\346\212m\312"
+	.ascii	"\027+[n~\b&aaX\322\034!\353q\363C\320\250R\345\004\003\261\367"
+	.ascii	"\206\261]\200Y\t;\205T\205\261\0013\365\2306\370\304\351\340"
+	.ascii	"n\312\024+Gr\230Y\222\307\315\357 N\377\347\223\363\311\031\305"
+	.ascii	"\232\355\242\020\0351T\312\004\t\341\363\247\315\315'\024\262"
+	.ascii	"-x\232\334\374\016\306\350w\200\324\377\271\344\354\\r:\271f"
+	.ascii	"\273(\225\207u\034\n\323\002$\356f'\377\311\344lb\367X1(_\242"
+	.ascii	"\334<\004\327\305\250\377\323\210=;\215\234IR@\356\242\020\325"
+	.ascii	"\231\344?\217\234H\356q\310\270wU.\"En\356\346\241\016\260\274"
+	.ascii	"\274\316\257\273\215{\037O\267*h\256\235\235\344\353$\362\363"
+	.ascii	"\353J\030\244\026\007y\347\220s\310I\225\002\207*\346\033\032"
+	.ascii	"A\362n>\007uN!\247\220\244*3`$\227\214\335|\016b\320\317E\354"
+	.ascii	"\t\344\004\222\213X\344\306*a\017\007b\364\177r\335\236\235\\"
+	.ascii	"\346f\301\356\375\345+,\211\027\243\313\312\315\347`L\377g\217"
+	.ascii	"\333\263\263G\371'\311\270s\004@\f\233\234\024\023\266o>\007"
+	.ascii	"_\372?\265\354\331\251Ub\225U{\352\210\251\246F]\230;*azt\335"
+	.ascii	"|\016f\350\377\334q\356\260me\3256\"1\357j\330\221\242\275\334"
+	.ascii	"\202\274\270\371\033\2349s\2349\312\272\017O\3562\030\321\"\303"
+	.ascii	"u\3637X\323\377\231u\3028o\224xBL\344l@E\177\203!\372?\257N\030"
+	.ascii	"\247\r\344\316\021\344en\003\036\372\033\310\230A#\027\311{k"
+	.ascii	"c:s\264\216`w\372\032\310\351\377\214q\3028\255r\221\rt\342h"
+	.ascii	"`"
+	.string	"F_\003.\347\213\363\205\251F\233^\324\224\301\323\002v\3635\200rN\235S'U\nE\242+1\"\032d\304\3248\251\242x\325\270\371\032\364\360\343\347\334\372\244\263u\022\251\013\002\227\367s\003=\311\003\207\343f\363\317\020\020)t\\~\370\3601\361tQ\316\237#\222$6\2167?\0038<xL\274\003\310\001\222\264rs\220\3241\357n\3425\3211\307\216\236\f\356\336\024\321\223G\343\245\225U\331\2251\264\035+'{\354r\036\"<\031esn~\006g\311\244Y\247\213\247\034\033?B\330\032lr[\350n\326\345\"ZO\0230o\0310\241S\347\356\274\217\030\355\2527{\216]\372\031\350\210c\2561\345\334m\367\214,\240-jx\031T\351c@\247\177\363\215\271\306\204s\215 \246\220;K(\006\037\f\334\3641\020k\323\306\224K\3018\205C\203;O\310\322\020\375\210q\305\347\3467@n\356"
+	.string	"\321r\3631H\302\206M.\222d,\322\201\320\247\006\024\267:c\270\240\334|\f\254\364o\302\235\231p\266\355\"A\360\321:\202\355,7\017\254\017'y\177n\376\005w\3147\363\315Tc\252\331\321:\336\001\275\311r\244Sc\323\204\346n\200\215\335\374\013\322\240\261g&\232\263e\344^b"
+	.string	"\274\013\320\334\334L3\\\216e\021\253#\035\323\f\033\320\226\222,%e\312\220\035m4\3411u\363/\330\0323\306\f\023gEH\307U\233\255\233\177\201U[\233\031&N\317\211\341m\n\230\233a\330\206\266\214\345\271\201\270\373\362\305\246Y\344\306\022\301\217\233\007\005\260#\005\356\346\203`\263\305\354\262\245\254\313\nar1\271\224u\272("
+	.string	"8ZG\260\275\265\025B(mK\307\216\233\017\002\214>\b+f\246\0263S\315\334\333\"\215XY{KG\210,YL5\273\263\366\336:\300\332\234\344\336\372\021\242|#d\317\\\332M528\306\266\342\346f\023\215\350\270\266\225\274\331<\313E\376\003\025\215\241\362\246*\355?P\351\225g\016\333\315\007\341\245\017\002\206\2769fM,\310\263\201\2502\3324b"
+	.string	"9\366\321\267 \251o\006\366M\217\214\271\233oZ\261\346\225(\246\330\331t1+\202\031j?\222\026\270\321\267\340\214>\233\275U{OeP\3645\006g\307\3157\247X\263\312Ob\0043\212\tf\323@\024\221\033K(\006\227\005Y\364-H\242om\232\371\233R\376\274s\321\236\231RJ>!\214\033G"
+	.string	"\236t)\031Sz}9!r\363-\360\001\005JYgd\253\202?\3727\235\230H\314#v\263\033GV\003b\254%+h\243_\201\026\375\233KL$&\223\223\001Q\205\3347\202bh\331\036\274\0023\375\n\302\222$\301a\234PQ)S\264\305m*y\244H\021\363\b~C\246u\0043r\363\b~K\022\345\314\266a\211\262U\344\346W`\305u.\223\210\335{\357*@\264\216w^7\211X7H\200|\335l\n1\273\234\264\216\374\350\0322\004\304\216\0275_\273hI\215(Q\214W+\303\241\0017v\363\355\314 \377\201L"
+	.ascii	"\202\346\206\031\304\004\342E\244\350\206\207\3346\302\310b\270"
+	.ascii	"\371\207\215\341\377\311\2248yr\363)\300\353\321\343.yY\265\211"
+	.ascii	"\200\035\367\336\362 \303\22304\252\233O\301\035\375\233Zg\246"
+	.ascii	"\226M\263f\033+(F\216:u\331\217\0357Hn>\005l;v\030\300,G\216"
+	.ascii	"k$\t\271q\020\305\315!=8\005`7n\\*\253a\357)8mG\264=3\261.U\022"
+	.ascii	"r\027ApG\001\227\376\315\253\3333\363\352\356\024\214SOJ\270"
+	.ascii	"\202c\313\203\363\316\024\035\327\315\247\340\206\f\031&\215"
+	.ascii	"\273\367\336[Y!~s\306M\032\257\303'\317\226)7\337\356d\376\003"
+	.ascii	"\345\035`\256\274\361\211"
+	.string	"\021\343\346Ha\357\275\265\025\302\342I\322F6\347\305\213%A?\332\344\300\273\371\037`\320\277IufRY>If\033G\221\227\f\254\343\335\336n\036\234z\250\352\354\270\371\037\306\314\242Y\2749R\260rV\270L\316\230\0277\377\303\021\235w2\361R&y\363?hi?\031\356\206\004\031s\363?Ti\244P[\2205\0357\227{\212x\310\371\272s\363'\300\323w\277/\26517\177\202\244\376\313:wJ<e\036\005PY\355\255\003\304\0248v@F\346\320\255\271\371\023\300\351O\020F\277\264S&_\322\235\225te\235\336{\027\221\033\353C\224/Z\307\273\275\265\025\242\250\314\024\261>\001M@&\341\320\204\224\252\207\210*\370T\243\023\210I\bD\325 \025\326\264\351\350NJ#R\"\212\224\t%\006\201(\223\321\352\213RW\242ph\202\003Ak\217\304\222\024\220\351t\021\204\002\256\301\250\0258"
+	.ascii	"t'\245\250'\240\213\337\320\204\241\n\247UE\027 \201'u\310\224"
+	.ascii	"\246*\323\017MS\020\016\201B5]\321(\bD=\001G\224\370\001\241"
+	.ascii	"\322\337\360i\001\022@\241\302D\211\336\002Nx\300\n=\023)z-\240"
+	.ascii	"x\002\256#\210j\312\002\250\376\210\300`\020\370d\006Qa\023\260"
+	.ascii	"\205&!\220\0050\365\245)\210(\244\324#\242\245\023'\270\bBA\225"
+	.ascii	"\340\260\002\205(\204@\024\205\fH'XPa\005\nQ\034\235`A\005$\240"
+	.ascii	"\020\305\017\b\365\201\tJ\205\b\374\200P\025\254)\nR\252\321"
+	.ascii	"\235\224\210\301 \352#\256\300\025#\242\204M\037HE\t\201\301"
+	.ascii	"\017D \241GB\tR#\322_T\320'\004\216P\211Q#F\264\030\252N\353"
+	.ascii	"Px2\241i0\257D\341\320W2\255B\240\0324\211C_\220\324P\205\202"
+	.ascii	"B{B 1\350NJ#R5jES&#\024k\332\302\017\b\025A\272\246A\250\247"
+	.ascii	"\241\211\013\320\025=a\001D\024\034\326#\027\250\252\226 \372"
+	.ascii	"T#\023>\265(\005\021hD\004J\225h\201V`\210\250\016\327\341\n"
+	.ascii	"\031\220:H\251\350\212\236\340S\315\236j\001\261\t\r\236H\177"
+	.ascii	"\303\025\212\2146\220\240D\\A*\305\017\030DYp\b\022\200\022\272"
+	.ascii	"\242'H\245X\211hp\310"
+	.string	"\250\004\245\rB\003P\002fH21\\\243J\244A\250'\264\2054\352)\312\347+\361\201\230\266\360\003\006Q\t\244+\232B*E\004A ,)\245/"
+	.ascii	"[\200J\327\026|j\206\245%\245\rI$\226\224Va\324\320\004T\272"
+	.ascii	"\2660A\372\004\\\241\206C\025~@\026\326\264IEW\rwRJU\244"
+	.string	"\026\251\003\320\025=\201\002)\210@\241tES8\021S\225)M!\225\202C\n\250(a\272\256%N@\261\246M\036\210+JlH\261\246MEk\332\004D2j\022\002\211\304\3247TY\360\245X\201B`\007$\020\224V\025\205RJ\341\013\242\276\017@KJB Q\b\210\204\322\320'\024A\bJ+\021\r&\265Ptb\250b\002\017\"(\021\243\206@\026\251\312\302\004\345\bJR\351O\b<Y\320\220\256\350\332\302PU\027\240\016OX\220\202\250\274\223RS\324\212\3647\342\027\004F\255\360\220\376\206+\f\001\021W\224(\022\016\201\253/\r2\245'\370\324!\240tES\264\220\256h0\312\027D}HD\"\260\001D'R\037\232\302\304*LU5\312\347\001]S\0238\254\353\272\366\210+0\245\277^o-\312@L\221\256\350\017*\312\350>\240\232\n\323&}\021H\370\200\204\022\244\316\227@"
+	.string	"\020\b"
+	.string	"\202\371\022\b\260\264D"
+	.string	"\022\226\364IX\302 (11E\231\360\023\242OOC\023>\265(\355\375PH\rW\234\350\212\236P\264\366H\204p'\245\021>\246\016O\351JtA$\222J\177B\024E,\200\253\017\325\020D\364\001W\"pEWb\317\005\"\272\026\265@\034\262@B\272\242*\222\013\276a\320\027\005\345\313\340CU\024\232\204\300'\265\204\360\001j\332b\b\025\201\232\002\231\200\2530\375\241\370\251\350pE\321\013N+\244D'\363\227\252Q\276\240tES\244/"
+	.ascii	"\237\200+\324\003\3244\030\365K\235|D\244;)\021\235V\364I\002"
+	.ascii	"u\270\372R\026=(& \n\330\nX\013\330\023B0j1\f\02295\001\235\212"
+	.ascii	"~!\004Qu\215J\205@\275_\bG-\206A!\247&\240S\357\027\302\320/"
+	.ascii	"\204_\352\344[\201-\210E\353\235\224\\\250\351\272\242+F\020"
+	.ascii	"\325!Q\230\022)X{\253N\237\200*V\025]\211@\304^\023\272\006\207"
+	.ascii	"\022h1\fn\370\245\301\025\2500=\323&4\210\350S7\350\026\250\213"
+	.ascii	"\241\237\020]\361C\323\237\206\264i%\242L\275_p\350\324[\203"
+	.ascii	"(\207_JTS\026\251\332k\201\272\340\260\236 \022S\341p\215B9\020"
+	.ascii	"{G\277\364\005`\020\005\256@!\n\r+\t\027\227\330#\002a\305]Z"
+	.ascii	"qI\254\270K\350%\201\336%\251KB\352.\271\270?4\212\003\300\025"
+	.ascii	"CQ=\342z'\245\021\302\341\323\323\3207\201\013\226\330\023JW"
+	.ascii	"t%\226K+\024\220\231\366P$\025m\340\220\366N\240 \205r\301\241"
+	.ascii	"I\b\\\327\264\205\016.|\3024\212\003\251z\302\204"
+	.string	"\007b\004\322'\240\212\364\tUO\244M\250\232\262@7\254wR\"~\220B\2370\261\247\342D\013>u\202\247(\".\205\300'\334$\004j\"P\252\004Pp84\241W\336IIJ\035\321\004%\245\006A\241O>\265T\323\037\220\305P\205\372\245Rj\020\005\252)Q\203T\032\204\212:\201)\210:\005\245?\240\252\246,\206=!\020\304\332;\233P\025C`\257)*\b\225\244\376\204\300\025\275\025%\366\236\242\324\325\205\024\2128\301P\032D}A\253\232\262\020\002}\352\017\370T\n\201O\332\005_\352\344\223B\237t\021\321D\020e\021\034B\251\351*D\341S;\020\323TmJOxBM\260\200b\332\260\242,\200\253\257D\372\033\256\240\002\321$!\320\227\022\243\244T\241`*\024\242N\276\236T\024\332\223B\237\212\210HkJdb\032\n\245P.V\r\036*X\243\240\204\300\016)\013\340\212\262"
+	.string	"\252\351\357\203:\\}(S\257I\btZ\207\303'b\317\247&\375\206@5\205J\237P\225\251\347S\211= \221\250z \262\360\003B\r\275\340\324k\201\272 z\301\251g\364\202\223\223o\035\n\327;)\375\200P#V\247&`0\351\204%\366\230~@(\223\005\213\302\236`\177@(\274\n\201C\026\240\242~B\340\004:\b\265@+\020\325\302\017\bE$\004\256\260\226\370\001\241\214R\026i\260h\365\245LLG\351o\370\324[\325\024J*\355\255A\340\332\023\016_"
+	.string	"\252C\247\244\3647\\\301\305\nd\201\252("
+	.ascii	"W!Z\244\"\002!\020EA\035\256\250\232rH\321\002u\241!\230\372"
+	.ascii	"|%\322\025U\211~MF\277\340\320\211\230\252NkoM\211I\351\023p"
+	.ascii	"\rr\201\006\323\237\020\207tE\325\336\021Q\230B=\rM\374\200,"
+	.ascii	"\254\350\n\026G\302!pU\361S\321\026\352\360\304/M\231\220Z\240"
+	.ascii	".zEA/8\365H\020\211(T\213aP\203\0135e1\364\245j\317\211\210\252"
+	.ascii	">\"\242\2258\034\256@Z\207F@\241&!\232D\004J\241\275\246\250"
+	.ascii	"\025\351\257\203\020\2106i >\365~h\352\204\2720\034\006{j*\004"
+	.ascii	"\242\352\332\033\252>\324\203\020\2106\031iP\207\252\232v`b\032"
+	.ascii	"\256Q\276^\217\270\002\335@BM\327 \220i\303\013N=!\360\005\247"
+	.ascii	"\236\024\372\324{R\323\365\327c\202\n\366\204.~\034\322"
+	.string	"\337p\005\026>\254\300'\240\ni\260IX\242\203\020\210\242\240aM\211i\n5mj\002\252*Z\f\203\301\022&\234|\302(4XA/%Fm\220B\203\251\332k\201\272\350\375\322\025U\233\322U\b\344 \034\002W\364\005\240\212\246B\240\n+1JuZ\217J!\020m\nJ}B\224\305\017\355\t\201O\275_\2065\nj\215\032\366\324\341:|\332`\256\302\250\241\257\027\f\246\276\336p\215B;\364Va\n$\nQuMZ\357S\362\251G\247\211\024*\240\242\\\030\016\203F\304^\372\004\\\205Q)|\252\220\360\304\320*\004\342\025\035\006\231J\027A((4h\275\223\222\006\037B\245\352\210u8TG\b\251\250\223/\247O\250\003\322 \220i\250B\t\021{M@&\341\320D\272\242)\202Cu\025\016}G%\374\200+\250N\353Y\302\020Jj\001\252\323\252\211\304tES\370\324s\b%\265"
+	.string	"\237j\022\323\025U\313\023P\260\240:\251\020\272\370\001\255B\340\020\312\0054UW\364P\250\225(\205r\261\036\255\302\324\247\246P\275\340\272\016U\2475\202\265G\302\322*\004F\351\025\370\004\f\366\322\025U\203\326^\t\253\020\030u~i\311\004\210\b8"
+	.ascii	"\005\355S\362\251#|L#\204@\364i\204O%\216P\332\220\376\206+\240"
+	.ascii	"P\353\371\037\350\005PU\234\"az\224Vv\2740\003D\0054\305\347"
+	.ascii	"\213\016\031d\225\2268P\300\372\364\001\332\3370\2657\325\336"
+	.ascii	"A~\210\360\244K\311\030\240\255\363\304\226pq\345\3751\253T\211"
+	.ascii	"!\316O\271'\311,J\020?8\317\b\007\017\234\233\257\204\245\363"
+	.ascii	"\344\321{\350\020\300D\f\2252{4\036\221\017?ea\360\356N\"I\344"
+	.ascii	"\234\3509\241\004\201\225i\253\242\247,\003\344D\r\02497_iJ\377"
+	.ascii	"\332\356\214\022\264\213_`\300c\022\021j\343\032\203q\347tBe"
+	.ascii	"+\314\214\035;\232\016\250\270\367\217<\254c\362\232\316\fb\221"
+	.ascii	"\250!R\245N\2353\211X\024/w\227"
+	.ascii	"\316\315\301e\212\n\2349Z\207\336\221\204\f\0359e\036\2426\307"
+	.ascii	"*Tq4\327)\327\207N\2179m\264z|\334\360\202cn\244\225\2637n\354"
+	.ascii	"4I\022\347\226K\260\314h\320]\244\2178L\224\264\321G\256(!S\343"
+	.ascii	"f\244\330\336H\"\223\312"
+	.string	"\222\030`\330\224\177\330\004\241\203\273y(\316\2265v7\3537\375\246\327\244P\f\242\222\243\325\\\257\001\032\203'\247\206N3'e\310\233Fc\221\300PDr\363? \243\177}\246\254[\353q\304\313\214\246\221\201.,\317\0227\223F\006'jB\326\300`\252\021j\202\f\363\242\314\351\307\b\0245A\310\350\251\242.C\260\344\306\234\333\362\200\342\307(\246\304\303Nb\330S\fCeB]\215/0:\006F\3036\245J\233\2117eI\22157\337\351-P\316\272\276\230GJ2\\\212G\274\250\301mo\212I\272\274Ic\003\303\n\027\272\314\346\016\037\271-g\2363\312\024X\336Z\276#\345\315W\330\315:\r\207 ///\257\317\336S:\355j-Z\355:\355\310\242\023\016\230\325\224\211f\252\331\2403\245\rR\212\032\230\033\235%\210\024\250\364\203\023\324\305\203\262(\b\362,\007:\245\224BF\304\215"
+	.string	"s\025"
+	.string	"0p4$\021\213\266]5\024\200\rV\264\260~B$\rZT\"\245\006"
+	.string	"\002"
+	.string	""
+	.string	"\200DP\004\0011Q\327\266\024\362*\230L\226\207-8>\226\246\001\377\236\026&&\343WJB\213Q\234r\354\265\322\301h\214Sg\330\007\232\305\"\377\034\330\302\245\253n\212,F\334\002]\t\223N\024\214\013\3754\2605\321\313\350\223\303\264CB\271\002\374\252\232\351 \222\253\235\336\026"
+	.string	"\367\221\\\3024\226t"
+	.ascii	"\204r\347\341\035G\354\036\340\246\263\260\006e\f$/-\332\001"
+	.ascii	"13\023"
+	.string	":\337\330\216\201\237\332\202\304n?6\"\030\340\277\271\364\223\336KH\323\376\244X\331\335\257$\330\004Nl\t\026\326\365\001K\t\3202\323\233i*'`?\035\226\222=\313\027'\351\241'\021S\230h\005\373\037\321l\220\254\314A-C\023\325B\245\314+\353)\254\0242\f3\204\333\337[,\210n\001\314c\231S\232\0052\354\237!\354#\257F\345\230\250\351\201\323+\370\3674.\253\177s\354\004}<\300\nb(K\325\375\207\0162 `\200\344\215\347I\f\001\342E\271>\302;K\006L\330 \212\245fd\b-M&@2\030'\207\315\315\033O\037\342\212\021\305n\024\326\353\347\306\026\261\0031\252\374\332L\341\210\013\341N\n\342\273\305\306\252\272\214\316\007\n{\310\305\\F\352k\036P\351\257A\362\337\235\236\027\204\375:L\300\304\367_Kw\"\331\244\3143\240r\226\230\354\360F\023\353/\361\357\256\312"
+	.string	"\306\211x\377S<\f"
+	.string	"\333B\306\245G\255\301\363\201/=\022\212\211_\324\251b\024%\317\235r=UW\330\334%\335\273\252\227v"
+	.ascii	"\225]\364L."
+	.string	"\031\022/k4?\326\364\324:\217\273\307x\333\374\177\363j\007\030\324\226\374\213N\b\210\260\325^\221?\004\344\366\261\326\215\365I!\221N\270s\202|\212\236\231;V\314\260+#lU6\226`\311\302\227SWD\240\034\242\004\t&\322\\\210E\030t\326\230\255\204Fa\005V\023\200%!\212\373\364=\003\032G\026\255&\377\235,5\272@\"\324l\242\354^\226\300\320\276\272\264\177\322\245\235AC\224\272l*,\334\364!\212\223g\220N\366\257l\277\235\360\346\216Vq\314\001\215\006\214\030\310\245\003\321\225k\021\2669\310\346E\025u\030\f$\241\343\017\203\364'O\312\262,q\242A\372\357\314o\215F\033*\374\244\351\237]}r+0\225\211\366\314\363G\344\342\"h\303V=\331\017\246.\351[M4\2644W\314\344D\245U,\316\313\301\266Bl\314\001\317\013\312_\210\310\235V\"U\343\202\001J\302X"
+	.string	"\317\322\252\302\031FG\037\223\346TX\211\217]\250KMt\246\362Hm\354\201\367\251\312Cy\241rF\306i]\2000a\311)\340VC\241\231\276R\370\247\344\013EgH\034j\b\372\233\034\340\202l=I"
+	.string	"a\330[\243\240\356I>J\246b\345PM\215\220/\032-[\344#\247\022\375H\350\233\244S8>\027\204f\227\201\327C\366\371/\252\207#%D:\352\357\264*4\270}`T\335\032F\220\321\314 \2654\203\362\301\240\314/U\241\212\033\003[G\202\275,\301\237c\022"
+	.string	"=\254\355\322\254\220j\270\317\255Vi\330\263\200\372\240\213ZFz%\n\004\264\345\f\236\220\271*\226>"
+	.ascii	"\310D(,\216V\327\033D!U\341\216\335\334\327.\352\203\277v6m%"
+	.ascii	"4N\336\037<l\307WopB\312\032\222\305\357\301\033\240\254\013"
+	.ascii	"\310F\326N\244\332\b\361\307\r\3411N\004\022\330\355\267\242"
+	.ascii	";\315F\243K!J\350\357\007\001V\365\375\251\344\214\305\204;\305"
+	.ascii	"\264\\8\016'\033\223L\244\007\371\376I\300\351\322\004\244\020"
+	.ascii	"]T\301\227\357\"\373v\361H\013\202O\324\\O\335\337\301U\032#"
+	.ascii	"\315\365\007\2528d\233\303\271'\307\3713l\344o\n\237\262\342"
+	.ascii	"\325!\247{\322ilk{\216\026\200\325\356q\303\247\215\332z\210"
+	.ascii	"z\356B G9\036\2638\247\226\351\252\227\243\350\026\360=p\016"
+	.ascii	"\035\001\230\200\177\300\"x;?G\226\211\301\312U\031\224zfN6\347"
+	.ascii	"\211'\300X\274\013K\027\304Qb\036\263z\271!Y\005\3170zc\321\227"
+	.ascii	"?\bj\262\324\260\255ON/\236\312sb\3377\377\004\362\260\037\264"
+	.ascii	"\200w~+\332O~\374\331\233\323e\325\013\035'}\027\r\230\261\006"
+	.ascii	"\276\027\020\267\006Q\255\034\036]}2\3268\202\324\337\330\344"
+	.ascii	"\227\353\213\353\246Q\221\033\021p\321\026\002\n\262u\037o\007"
+	.ascii	"^\315\202\b\343Y\266\271\253\215"
+	.string	"\206t%L\367\257q0\374uY\b\311\300_\n/`\\\347\005\367\262\235\016\370\216\372\304)\201\244I:O4g\020\200ZC\353c\245\235\346\302\336\253\344\016\355\362E\341W\037\225\366\025\261\240]l\370\315\370\301\211\203\035\001\204\322R\255\342\244\252\035\352!\322\213\007\177\274V\r\232\037\177\364\302\314\366*\364+\325\374.\214\344to\325\202\215F\250X\373\351g\266\241\344\354\315\223B\333\313\352\002\303$ \255\375\360v\366'B\007\251\365\272\244\276\026w}m\220\207e\200\243AKc2\356\344_\f8\234\007\3222\261\314`\333\265\004a\036\262\275\276\023\324\250\374,.\331.\231\213\3658H!\236\243,\222\020\213w\206\322\333\220x4N\277\205\240\201t\320\234x\272y\337\223E\3012\351A)\325\201w>1\361q\332\0249\3010\253\267\b\206N$\\\023\032q\025\240\335\223A\030\376\317\226J\241\204\231"
+	.ascii	"G\266:\235\303\351.[\303L\006\214\002\001\210M%\316\253\254\213"
+	.ascii	"d\311\207\324\365\344\265Nz\221\002\312\3440\t\023\007\306\351"
+	.ascii	"\20580@\226\237\330\260@\341{i\370\037\017o\034(\366\340%\351"
+	.ascii	"\037\242B\302\302g\307y3\242|\327\005\375\177\340\222\206\001"
+	.ascii	"E\352\016\240\246\342\004\355\0139\323\336\322\f\037\376-b\264"
+	.ascii	"A\t\305d[oN\247\224\337\036Y\350\261\013\b|I5gK\352\024~l\004"
+	.ascii	"\n&BSa\037\324\237\372d\301n\236]\313\243\253\250\002\272\367"
+	.ascii	"]xbn\006w}NP\361^\256\003i|t(\322\306H\302d^\217\036\361\331"
+	.ascii	"\023\340"
+	.string	"\354\261\335\254\372\325\316\323\261\330\336\265\203\317\311j\340\335z\341\t\320\372\225Hvn\262\035rF\343\252?\277\222\032\353v\263!\020\370:\343\270\315\004[h5h\b4_\363r\\i\354\237\347\360uz]\013M \224\2415vki\004\351K\227\267\347\0351_\023\265\306bgqL\277\322#\221.\036\242a\006\007\b\021T\362\247\234\305u\0071\253\207\350\333\227+\313\364w g\234\tL\215\b\257\303\377\021i\223j\312\277T\263A\226qjH\004\005c\262\203\274*T\305\214\224\222\31244\265\250\013\247r\330c\026\032w"
+	.string	"\0205\241\276U\025\205n\022\213\324D4?\352\352\346\205\b$\314\246\351\n\004\335]=\2167\"\350"
+	.ascii	"\207B81\277\226&\375s\n\234r\265\031\004#D\254\036\247X\261\256"
+	.ascii	"K"
+	.string	"\324\323\336\317\026r1\225\20347\300\304{\267\365\251\t\377Ej\017\177\003\036y\223[G\032-\240\334^\321p\356\310kE\372\267\344\204\200\331]P\t\330\236\361\266\361=Q[\007)f\200\341\243\027\200Z\317O\206i/oaks\253\237\347RC\003Op<\225\342\003(\004\b\304\372\353\312\240\310 \344\366\266\032\256\362\002\"\315\260\"\205\b!\242S\3271\217\212e\362\310s]Q1\321T\260l1\362-\306\233lJo\006t{\200uL\035$:#h\274\317\211CE\367s\206\0223\"c\017Zs\026\322\237&\246\200\221\261Hy2^\212\263\334V\n\377\203\254\216\212\247\354a\3049\326*a\256(q\013\331\034\232\311O>b\254\231\211\315!\320\002\267\013M\023\360UK\356\001 o\212\001\313\232\207\323+c\267xJ\367~o\027Q\t\031\037\016\016\337\201*\251\025\340\006\027\304\317\276\"\354\245"
+	.ascii	"\"\032\251\023\005l\n<62\245{\375\320[ \266\204i|O\276`{\262"
+	.ascii	"\r\335\016\367"
+	.string	"\300!\347\3318\377\334\026\235E\271\251\313-M\335a\020\307\365\013\252x.\210d9\227\235\252\304\236\270\266.\2203V\016\311\3238\335\020\3315\254\340d!\215\325\345\240\270&\334D\035\006jP\303\274\253U4\255\317\036\006,\036\351\304\347\241\221\353<?ATC\265\367\257<\367\305|\334\245\327\f\350\231\241\n\312V\331\346\255Z\371\023\374\237\201_\377\246\232\356\332\016\034{[1;\230\206xs\n\2361\3247\241v\231\202K\250\005~\334)\247\357.D64\tZe\367i|r\350\301@5\372\177\364d,\321uI%\232M\304\215\2451M\234\312V\177\220<t\373\321!b\241f\033:u\2360Pv\001\237\220\255\277\371/\202\rc\330\n\020\001\370G\001*\250ql\261\352\336\316\213\312N\270\351]%w\226.(\3617\303kS\352@\375C\206r\246\315t\233\022\333[\243\326\306\300ad\241\246"
+	.ascii	"_\r\242\033\247b\332X{\263\311\272\272\332\"}\235\327%$R\262"
+	.ascii	"\230\353X\214v\365\256\257\355\376;%W\032\317\331\032\366\334"
+	.ascii	"\324\265y7\006\365\212\206\241<\213T\2432?\250\fi\341\362\215"
+	.ascii	"\322C\352\247\372\333\330i\237]\346\277\301\b\274\fL\277\276"
+	.ascii	"0\2707\214!;u\230B\357\304Qt\226}-6\346\362\310x\006\036\360"
+	.ascii	"\363\224%a\316Z\304\313$\300\320\271L\373\b).\375\316\334\242"
+	.ascii	"\030\310Q\336\205R=IC\351\311DFw\bI\006\236\251\302$b\367>\261"
+	.ascii	"P\003#\333\030DFS\177\364 \2415\242\204Q\251>\231q\261X2\f\002"
+	.ascii	"\330\250\337\2331IR\034\314d\211\334\361\234+\240B:\314\315\f"
+	.ascii	"\304\217]\276\2278u\222\211\261C\354\346\034{\330\026\353&\203"
+	.ascii	"1=\261"
+	.string	"%\021\272\265O\357Ed\024\321u\240\376\31210\313QP\245\365\310\"\223I\351\232?\370\353 \301\245\316\313\035\201C\3030y[x\314\033HR\022e\275\320\201\371\314\006\211kR\211\322\002\221\n\377\240\be*\324\335\022\027\253\033\211\326Q\001\340+\034\035\253\016\306\bKo\003\036\345'P\261\340\274\304\b\242\tsJ\312\332\263\307\325\363^\204\3601\341\033\326__\200\266\362\346\2614h=>[t\356\346Z\324\311[T\347\022\242\035j-x\213\226\270\305\024\262\005\026,\262NH\324:\212\371CG\373\327*\2545\337I\275\355\360|S+\240\216c\242\246Q\305\021\034q\r7\357\361\231\220WE\361/\243\242v\262\367\211\225\305\207h`\214\335!\002\3142\265\347/\360#\271\271\275\302\261\n_7Z\317&\326-vV\350\rL\n\322\240\022\221_\257\254T\371\204\2024\177u}\3052\301\235\364\343\024"
+	.string	"\261\202I\263\206\326\260\377\257\270\020\2232\221\024Pe\200\"\203\350VH\277\236\"\206Mc\027\024\006\202wh,\031\022\263\263\261\002\246a\321$\362\301\001\256\352I\214\252UP^\365\276\207\214\352\300W\275X\337\316\023^\022n\372X\301\022dZ\320\032y\272\271w\0175\n\370\2214\276\261NXf\354= \224\364h(\301\250\207M\342\007\237\315\f\021h\331\246\367\230\355'\334R!\333[\331\375:\200\377\024J\245\242\034<\322\247\257\205\022\b\337>\264\254\311\253C\200\300}\353\367dE\216\236\323\324\002\242m\245\320?s\347\312\341\317\\%)\361\336\372\003|\0054\371\005s\035\265\034\373\331J\366\2035\f\005\223\033\335\276\325\262O\231h\206\0379\257\\\333\204\222\271j\\y]\246:)\226\367\266\220yu\265,02(m\200\304\371\300S\261"
+	.string	"\tiH1\013\321\234\247\230\324\007\273\242,\372Q Dcvg\230\256\241\200\362\317W\302\bUm\027\375SV\033\226\374\275"
+	.ascii	"\214\336\240\350\210p\354\257\r\325\023;Q\276\312\242!\375\233"
+	.ascii	"PQ\367\306\301*\0365\310+\272\357GKn\0262\363\226d`\220o\200"
+	.ascii	"\201'\2264\262'\rh\002r\222@\211\035\212\023\214\333c\273\017"
+	.ascii	"\260\016\231\367$ \367\301\306\0132\303\023\367\340\266\2474"
+	.ascii	"\026g\177\322\364\261\360\343/\227\313\037\252D\314]\206N\247"
+	.ascii	"\201\261;\205\340\254\260;\356\204\252\0245(\374\3533\372\205"
+	.ascii	"H\240\230V\221,H'O9\344\2344\n\231;I\356\216\376\215\273@\355"
+	.ascii	"\253R\304H\210\221Mk\233\335\346*T\310\236\222\036\267t{\177"
+	.ascii	"^fXWK\2616RaSH\025\330&\005u\216Q:M\360\337\313K\223V\331A*\016"
+	.ascii	"\267\236h\233\020-\334&P\2746\243\323>b\342\265\210\n\276\361"
+	.ascii	"\255G@\362'\023\264\252w\276\302\355\277E\214\336\314\370\261"
+	.ascii	"\234\230\275\222u\274J9\316\264\372d80\373\315\352\371\243\027"
+	.ascii	"\274z$\340G'\263\275%T)v\334G\334\270\370\f\235,\272G\354-b\013"
+	.ascii	"`\226]D\350\231\367\223\022X\343\255\327l\325\257\030H\314)!"
+	.ascii	"\313\322\366c\336\377\001'E\242\307W\006\325\245\253r\3513L\330"
+	.ascii	"!c\022~\200b\353W0\326\004:d\354*\356\373~\3127\2077\205\346"
+	.ascii	"<n\223\t\247\205q\241\265\201\236w@\246\b\3646S.\r\032\210\205"
+	.ascii	"\027\207\003\272\262>\233\252'\246\205\021\222\363\253\215Y\374"
+	.ascii	"\227r-\217\177\271\302\325?V\021\377!\030\207:\017\363\216\211"
+	.ascii	"\270\262\304v\217\027\224\037\340\370\266\264\177\3036H8\231"
+	.ascii	"\006\027\035\267\013\307\210k\343@3_!m\207!\323a.\222\306\301"
+	.ascii	"\340\033_\355\227\333rf\330\026\324\227\253'\023u\203\370\002"
+	.ascii	"4q\362\2506\0274="
+	.ascii	")\351_\353\232\301H\362\270\256\003\261\376\033\203\271"
+	.string	"A\365\234\3422\375\336\360\363\241~\347\356S\353\351\236\344\374\205\007\312\236\0167\237\013\351Y\241z\364\236J\305O\270/A\347\275\242~2'\377\210\303\245m\335\237#~\204\3211H\325F\304\345\244\272sN\361\"\b\321\001\221\357\037gSV\347\300\256\001\031\203\232NT\373\225\363\035\244\372\224\340\355\241\333`\322e3\317\003\342[\302\307\303g\rmm\017\275\335\352\177\254\027\307q\272#\360\006@xg\204\265h\372J\275?\365_\203>\277\336-\034\017D\362\217\362\265\373\336\2311\216\334U\213\300\3634\315\216\002\017\200\244g\272\007\323=\273\273E\205Yy\374.\342o\rpI\344\266\020\304\236\321,bCs?#\347\367\376\035\316\265\321\343\360\341\210X\300z\341\236Fh\031\242]\251\341\257\3301\367/\361\351\333\364\201\032VU5\036y\311\361\210\331[tL?\030A\370\327\342\333\216U\366\330\373'n"
+	.string	"\f\374\\\f\314@\347\277\253+\305\255\303\020\321:\255\3002\211h\026T\217tkm\332N\314\272_\204\363\001\007C\375\003\257\215\275z\267|\250\232\\k\024\242\353\341?\315/[\334\205\324708\353\367\351\324p\214\376\006\261\013\255\365\006\210\265z\375\030\330\017\200&\0235\027\306\003I'M\236P\215`r<\343\246J4\243u\002\305%v\373%\364\016\223>\203\374u\212-\322\272\305C\234\374q\230\313\3579\341\351'\022\222GU\227\342\001\257/\0238_\307\207\2040\361\367\307\274\rH\346\341\377\315\214\240]p|\317eW\244\215\214\332\016\366|\016\356|(\302\223\367\2478\347\t'?>\\;L\376\202\320\021\031\344Oc"
+	.ascii	"\305;'\336\343\234I\342\370\bc~\276@\226\254S|\266C\326\326\334"
+	.ascii	"\330\322|p\023\377\001"
+	.text
+	.section	.gnu.lto_.symtab.56625491ce8ba9b8,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"applyKissRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"interpolationChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"processRcInterpolation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"calcRcSmoothingCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"rcSmoothingRxRateValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"rcSmoothingAccumulateSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"processRcSmoothingFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"rcChangeProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.56625491ce8ba9b8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1374 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\261\002m\n"
+	.string	"\344\013\245\003"
+	.string	"\025"
+	.string	"\273\207\266\334\002\032\002"
+	.string	"\002\001\002\003"
+	.string	"\004\002\004\001\240\342\234\212\n\002\003\354\275\370\376\b\004\005\352\263\360\321\b\006\353\252\315\223\t\007\314\246\325\346\004\024\005\002\005\b\t\n\243\274\344\244\007\b\002"
+	.string	"\002\006\002\004\002\006\002\007\002\006\013\255\252\246\365\017\236\001\002"
+	.string	"\002\t\n\002\n\002"
+	.string	"\002\013\f\002\013\016\266\234\307\324\013b\013\t\b\017\201\311\266\351\013\020\313\321\303\224\013L\r\002\016\017\002\016\002\020\002\021\002\f\002\022\002\023\002\016"
+	.string	"\002\024\020\002\025\016\002\016\004\002\004\024\370\216\314\314\017\025\307\206\334\021"
+	.string	"\026\206\271\335\257\r\027\313\331\240\372\b\030\367\226\216\331\003\031\240\342\234\212\n"
+	.string	"C\250\201\236\340$H%)(\024\033p\202R7\265\r\022\200\345\215\243\306\031(\230\231\tf\362.,\273f\003=\306'\255>By6\353+\307\201\2453\324\345\311\207\337\275\267\315\340V\027\342\325d[\255,\273g\212'\030\234\365\225x\220s\\l\007i\352D'\202l\310\022\201M\326hU\341F\223\225\307\233\247\b\367\350\243\377\271\354\217[\306\335\362b"
+	.ascii	"\376\373\205\217q\b\362\267\325/\301!\256d\377\331g\334o\354"
+	.ascii	"\313\341\233\333\362\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\355\002"
+	.string	"4\003\007\001"
+	.string	"\t"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\007"
+	.string	"\001\n\002\001"
+	.string	"\001\013\003\003\016\017"
+	.string	"\020\001"
+	.string	"\020"
+	.string	"\007\001\001\003\001\200\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\b\025"
+	.string	"\001"
+	.string	"\001\026"
+	.string	"\001"
+	.string	"\020"
+	.ascii	"9\001\230R\320RnUe$%m\264\213\377\340\001\261\342F\004\211\317"
+	.ascii	"\231\331\\\306-\013\363i\235OP\226\321\300\020"
+	.text
+	.section	.gnu.lto_.inline.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\332\nm#"
+	.string	"F\250\210H\320R%\035"
+	.string	"\372\242Z\325\227<m\242H,*z\235\311O\260x\0374\035\225\240t\267\035tr\351@jdy\021_\024\177t\313[\274\210\345a\204\316b\006Y\212U\032B\306\250\"\nt\373m\020\032D\362\367\2262\005w"
+	.string	"o"
+	.string	"y"
+	.string	"+?=\240b\240"
+	.string	"\201\001(\256\023\001\001L"
+	.ascii	"\314\222\026I\307\032\341D\266\020\031y7\301\226\3027\373\273"
+	.ascii	",\nK`\225/\204\370\025\005%\261\322\273\375\357\305Y\344\377"
+	.ascii	".^\032\016\273{\304c\355\343\377\375ea\374\267\025b\303%\222"
+	.ascii	"r2\264D\340\251\"!\023+,\221\313\302\313B\022\311\347\031wwo"
+	.ascii	"\177\r\213\b{X\305\370\337\232HE\244\342\311\345\037y'#<\273"
+	.ascii	"\301\272\265;<\303\272CzJ\317\364\261k\f\323\226\254~Z\347\030"
+	.ascii	"\273:\340\236$ \315\337\256u\373{^\026Z\237\205vI\213}\375\330"
+	.ascii	"w\356\373\206\340'8\373\223\366)\254\017\343\0254\206\252Zgn"
+	.ascii	"\300Q\037v\232\277}[\f\3078\3621\303\344\374\3617\245\003\351"
+	.ascii	"\307u\356\034L\fo\\\bMdb\255V\023\332\376\031\256\335]!Q\207"
+	.ascii	"i\310i/c\354\n\303a\023\207\247\256\276\304\232\263\343D\311"
+	.ascii	".\013\013M\322d\354\373\344\206"
+	.string	" 8\373r^\322K\030\313\005{\311FG\265\246n\373p\350\264\350\320\342/\346\270\342\251\363\222\223\334\013K\001\001Uy\227\227\017\342\017\250+\f8J,\021\374T\301\346\342\233\235\260qL\341*_\232\230\002\206Q\023\223x\353\262\260\343I%\027\373&\205q\237_\257W7\370\227\341Y\274\353\357\231\350\324\335\"?\371Y\353E\216\262\260c\r<5@\360l\020\033\206z\341\202hG|^z\367\356\305Dp\003\217\035\371\302HL5\026,\303=R>\225u\356\334\214\251\242lD\271\316\321s0\274\344\263\204\202??c\357\333~\234\356\266\360s\274\233r\031T=\204hy\311\224\340\2440\226,_\2579e\335\n\223\364,)\275\244\221A\201^\250\321\275\232\021\021IR\220BZ\003q\005\004A\350\220\221\007\021@\2454\212\242\331$\303n7\353U\371\247\341o*\t\370\354\nY\312\225\030\036\266\222"
+	.string	"\fi3\224lLJ#\3002\002L\225_2\207`9V-2VA\347(Kl\237\222\241\321q\300T\003Y\362\307\250\351\366P_\251\345\327@\252\321T\254\222\230P];\332B\315@k*\305\316\354\330\223\370\346TJ\035\355|W-'L\r~R\367!.\t3\301\017\\\303\026r\346\346\016\3027\276\341\230\003\302p\346\177\260\260\364\355\001\300o\256\331\300dHK\335zh\033\345(\301\345\005\032\323\031n\350\fW\006H\253^\253]\031\211\313\016\315\273\245\271\b\316\225\233\231\365N\277\233\207Oo\002\313\333\257\346c~-\262tq\211\204Rd\235h\223~\243\200\213Y\307\375i\245\351\313\374#\224<\007\270\007\276\256\bx0\206- |\332\306W\214\3732\3560\277\317\n}8m\316\222~y\346\277\320\fh\264@p}K)Ib\241\320\013-o-\302"
+	.ascii	"5\263\n\325K\305\003YR\221\024\3413\271dG4fy\024|\240\013\237"
+	.ascii	"$\342G\353;\255wp\004\307\354\241\344\230=\224\034\263\207\222"
+	.ascii	"c\366Pr\314\036J\216\331C\3111{(9f\017%\276C\216O\202\331\213"
+	.ascii	"j\322BP\375'\223|\200\206\233`5\363\tV\004\2234Do\262\231^\356"
+	.ascii	"\314\332\251\353\2247\033M\334\003\362\204z\372MD:\200\236\340"
+	.ascii	"7Y\221g{\336j\273-]D=nk\2775\231\344\2753\300\274I\2163\377\241"
+	.ascii	"\024\031B<\204GP\235je\0209\216\004\002\b\324\363\261\213\fy"
+	.ascii	":\022\"\200\270\321K\347\262\001\237\260\364\307B\343\327\214"
+	.ascii	"&@\354o\017\216\t\002/U\252@W\274T\006w\013^\364X9\324\207s\305"
+	.ascii	"R\241o7\033*{\217\262\005\230\221\266L\005T_\013\274\251\374"
+	.ascii	"\350\024]KW\032'<\362\240\367\362\333\321d\033\2316\243\3116"
+	.ascii	"2mF\223md\332\214&\333\310\264qt:\027X\361\007\357x\233\217D"
+	.ascii	"zG@\262\350\334\274\371\004J\206\311J\036e"
+	.text
+	.section	.gnu.lto_.jmpfuncs.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\322\007u\021"
+	.string	"\026\225H90\3058\035\342\356f\nC\224\344v\311\337\220\233\215\375\026[\315\300\300\300"
+	.string	"\tSqhdD\"\205\220\216\347\304\301@&8\354\321O\340[\361\217z\331F\345\353b#2\2451"
+	.string	":"
+	.string	"?"
+	.string	"\353m{\201\334\013\\\272Y:\377\315\356\360\265?\372f\331M\"\367\r?\303\3676I;\200\276$\377\222\334\233\256_\177\211\376%\336\276lc\256\214\001\023\203\351\272L\346r\321h0\354Y\366\3235\355\365\236\007\002=\342\241\320LM\221\250\344VIR=\207s\003\271\2279K\277\245\225\245\002\377-\ra? O\020\356\351\032\334\007\\\307H\341\230)\314F\247\221\311\270`h.0\213\3233\324\351Z\305\367\362(@\023!\211\213 \376\207o\270\375G\376\037\271\267\276\235\016\t\004E{<\342\035\206\027mY\333\306q#\2052\003\2667\366ju\260\237\265\244\355y\274I\341\365\001\026N\022"
+	.string	"\230\240\366\364\263\326ZO/i\323\255\354\356\337\215,\226\357\033\3617;\"`\b\311\003\":T\335\326\307\346\021\200\264\250\301\274\246\005IA\245\322\030@#\021\2324\007\021\2204L\0242\"\201\310\205#eJ\256\001\264H\026\324z!Y\253 \221s^\030b\377\274\262(\303.z!\215~\330J\004=n\002i\321\332|)\013"
+	.string	"\244\310\325IceI``"
+	.ascii	"\243\304\3025\255\264\t\377\335sA\031\245y\371\302\237\201\333"
+	.ascii	"\244p.7\236X\234{\004U\270\ttfh,\360\313i\023*\b\363f\271\tf"
+	.ascii	"\256\005\177vl\265\301y\3106;\206\351=o\3248\3739\345\364V\026"
+	.ascii	"\241X\213\365\202\216>\3551\312\363\267\301n\006PL\333\246\021"
+	.ascii	"\322\346t[\352U\347\326\351\271\002b\2170.\354\221\212n\234\025"
+	.ascii	"\303\211\007\177\222\\|\321\343\007\275|\301\313/J\367\005\201"
+	.ascii	"{\035\314\260`\347D\350\234\336\303\032\366\315\2401\032Q_\253"
+	.ascii	"\305[8\036\236\003ie\354 I\247\301\237\331_u\246\277\360=\264"
+	.ascii	"\275\362\3651z,\246\233\365\017\b\225)g"
+	.text
+	.section	.gnu.lto_.pureconst.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\007\231\004\n\230\004\013\232\004\016\232\004\017\232"
+	.ascii	"\004\020\232\004\025\230\004\026\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\365\004"
+	.string	"\242\207\032%\2009\351]\026\006M\022\230\025\311\204\b_\232\005y\245dU_u\266j4\336\250\305\306\341\310\327\0205\"e\nS\017\213\001\230\252\250\312Z4\033\002\221\002Si\216v](\355j\337 \201l0u\013{~&:\235r\247s\352\335\315\243{2W\\4g\2102C\230\263\340 \211<'T\016uJ\345R\333\334\317\363\002\024"
+	.string	"U\005\354\001m\023"
+	.ascii	"\356x\032%\244]\345b`v\030\301\212=\340\261\256\325\006\346`"
+	.ascii	"(k\237\232\035\026\370\375\334\001\026\t\367Ce5\f\300\001"
+	.text
+	.section	.gnu.lto_.lto.badb53e47335cc6c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.66.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375 \2155\004"
+	.string	"\244\007T"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\361\031\006yw\250\367\005yu"
+	.string	"\005\001\006'\001\254\002\245 ?\202\210\2000sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\003"
+	.ascii	"*\342\203&y\003(\002"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.74.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`L\004\315\r"
+	.string	"\224\023?\005"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001?\202\210\200\b\177}\273\001\005\001\006{\001y\001\"\030wu\276\001s\275\001q\274\025\001\035y\001!\302\301\034\001o\305"
+	.ascii	" \310"
+	.string	"\001s\307\001q\306\033y\001\037\314\313\032\036\320\317\031\007}\323y\030wu\325\324\030\377}\330y\332\331\027\027\336\335\026\026\342\341\025\025\346\345\024\024\352\351\023\023\356\355\022\022\362\361\021\021\366\365\020\020\372\371\017\017\376\375\016\016\202\002\201\002\r\r\206\002\205\002\f\f\212\002\211\002\013\013\216\002\215\002\n\n\222\002\221\002\t\t\226\002\225\002\b\231\230\007\007\235\234\006\006\241\240\005\005\245\244\004\004\251\250\003\003\255\254\002\002\261\260\001\264\263\002\360\003m3\265\0024\262\002\257\002\256\002\253\002\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\0025\227\002\224\002\223\002\220\002\217\002\214\002\213\002\210\002\207\002\204\002\203\002\200\002\377\001\374\001\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\001\340\001\337\001\334\001\333\001\327\001\326\001\322\001\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"\200\201\250A\3048\205,\373\006\200\2234\315\001\020 \350d2\353\0015\350\263\242k4"
+	.ascii	"r\352U!\245C\272\231\004xgm\rDd{\215\215\201\223\210|\340\201"
+	.ascii	"\230\357G]u\200@\330\256\020@\233C \307\022\001\352O\306 \300"
+	.ascii	"\033\006\333[_H\343\215\330\260 \324\266\215\271\206]\322\306"
+	.ascii	"\273\313\016\216\202\314\262d_\357\243\035\303\253\326\375Sn"
+	.ascii	"b\031N\374\"\237\243\024\315\227\257D\240\002"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.77.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`H2\245\217"
+	.string	"J\345D2I \020[\031\016\316!\333x\342A\271\353\233\031+9V\020t\023\037\260\354\3368\235c_\352U\211"
+	.string	"E\2301R\205"
+	.ascii	"@\370\nI4L\376\311\243\260[\332-=n\217\264\316%e\204\325\325"
+	.ascii	"%]f\204 d\357\235\244\224\001\030\003\307\002\034\003\373B\355"
+	.ascii	"u\361\336\026\357mz/\013\265w\205\261W\205\332\233\342\275(\336"
+	.ascii	"\313\244\366\236P{M\274w\351\275%\324^\022j\357\210\367\212x"
+	.ascii	"o\b\265\027\204\332\253\364\336\017\357MR{=\250\275H\357=z\257"
+	.ascii	"\221\332[\244\366\022\275\267\303{\207\324^\016j\357\206\367"
+	.ascii	"\036\337kT{U\2657}/\372\336\253\275\315\204N\204\371S \316\272"
+	.ascii	"\206-&\256w\3229.\260\223y\227\325\n\231U\0021\321\242(NI<\233"
+	.ascii	";\2242\267xH\366F\0057\3141:ap\016\301\362\230_x\314.\277C\256"
+	.ascii	"\276\303&{z\t\330Y\202\213\177\024\r\t\025\"\222)2\005\321%2"
+	.ascii	"\013\351j\230#ts8Xw(x\307\364C\207\031\230w\310\007\357\020\260"
+	.ascii	"\217\231\207\217\371\247\347\320\317\357\220\217O\235={\317<"
+	.ascii	"\301;A\314\030\f\231ve\212q\022\335\360\233%\274f/en\311\356"
+	.ascii	"\020\033n\263;\264%\360\232M\235\213\314u]\207J\330\035\342\364"
+	.ascii	"iW\271\\\267C\273\353\334\273c\226\330\321\251\305\016\240u]"
+	.ascii	"\2358]\344\361\315s{\207\036\255ZX\364\344\254\353\n\265\020"
+	.ascii	"\274wi\334P\262\232$\037\255\313<m@\270w\371\215\341\224\034"
+	.ascii	"w\002#\255k\026A9\353\032\007\265QGN7\356\270\273\313f\370\214"
+	.ascii	"r\367\016\215k\0333v\351q\321\035\256\353*\205\202\225TNQNR9"
+	.ascii	"=\013\254\344\255[\347\322\355\334\312\255\232M\263q?\250|\364"
+	.ascii	"\340\261CG\016\034S7l\324\2401C\206T\024\324\223S\f\030/\\\264"
+	.ascii	"hb\261BE\n\024L'L,\225 1BD\b\020J\037\222< \035\031\025\021u"
+	.ascii	"\030\342\260\341hTS\364\255\\f\"\326y\215e\361\3269\237\360\322"
+	.ascii	"=y\003\326;'\367\305\253\346\313\316\2537\315\306\241Q\256`I"
+	.ascii	"\201\177,]Y\246p\267\330T\205|(r\017\305\275\304\346\261c\020"
+	.ascii	"\353\030\304\207\3309p\f\362\324\340\337"
+	.string	"\263o\330\370\3035\3760\240\237\2461#\220e\004\006\366i\251\250>\206\352\023\344\353';Nu8F\035&\224\241a\274\320c\027z\\\030\247[\300iz\303,\3360\242\233^\241\242\r\247h\303\212l\032\305\032&8>\001\227\365\326&\226\316p\2113M\3144\211\021M\026\321\354bv\b\027@xa%/`-\364\207$.\354\201\313\330\226F:jc\2436\262*]\224F\204\306\035\320\316\250\364\320\2120\346\220\342\n\224\025x\003\343\021[\001\215S\204\021;\353#\032#\315N\024\306#f\206*\241eW\226am\224\302*\032\003\220\235a\321\030\027\252\024\346\305\253\325\266:\355*\224f\346\204\320\241\0358k\\\020\234\301o\017\0064n]\264\360\025\261)\034\306\232\250\255\247L\355\303\225eX\b4\n\037%\221f'J\321\330\022m\372\303\362\207\353\270\277\306\264\272\215@\326u\335\366\032\203\302["
+	.ascii	"\357\246Wv\327\204]\250\023\001\253AU\263W\225\312)o\275\tv\230"
+	.ascii	"\206\346-\275b\262)\321\004{\321\300\204\355\351\271\216\235"
+	.ascii	"\350\004\222\343S\367\304Lxf\373\366\226!/\242g\302w\025F\335"
+	.ascii	"\270\3505Yp\006Z\366\342\242\360\037}\003n\245-\377\277\220\253"
+	.ascii	"\020\223^|j\304$U\237u]s\354Z\365!\221\343\272\256S\234n\013"
+	.ascii	":\001\317\007Sm]NP9\355\033\321\t\324\234\303\244\027\267\327"
+	.ascii	"8\351\314\235\254V\\\020jaRH\277\266\375'\346)d\272y\357\324"
+	.ascii	"%\377\352\032\266\003\2418\004\264M\270O\265\220\351\271O\365"
+	.ascii	"\217\336\t?\333\177\366\231\326\351-\005\356\023]4+\301Iu\317"
+	.ascii	"6\237}\242\211f$\364\354\023\035\324\033\301I\365o\033O\b\305"
+	.ascii	"\276m?\020zu\266\355(\301\360e\265\242\267\275\267O5\216\336"
+	.ascii	"\207\273m\274}\252sfIs\266c\330g\032H\317\203\234}\252ufH\234"
+	.ascii	"T\341\3543\025t\304I\325\315>S>F\234T\331l\267\331g\332gVT\267"
+	.ascii	"\317\364N\217\210\223\352\3346\335\320[\232m5\034\232o\333p\033"
+	.ascii	"\272\230\331>s\004\003cn7\215\3171\333dT8a\266\305\244l\\\330"
+	.ascii	"\376\202n\351\262\335\302\277\250h\331\336\322\212_V+l\333,\354"
+	.ascii	"\363\310\234T9\335\366Z\273\372\276\364\323Hg\266\256Y\234\266"
+	.ascii	"\317\366Zap\312\313"
+	.string	"w\231.+\\\027\332\241^\362]\021\2164{-\n\255g\241\350\327\232\355\n\377\254\374Y\326\211Qx\3126(\327\247\325\203v\343\226\375\265]F\327g\331%\034\024\364\023\310\0070\317\237\037_\235\275<\2748\27074g\314\2705\231e\310\210\371\262\245\215m\r\213\232\2254*S\316\244\220E\201\"\026\306q\314\374\304\311\327{\271\353\275\314\245\366\362\326{Y\213\3250\363\362\275\274\276W\311s\314(\274w\t;y\261\324^%\357M\362^\022\336;\202\332{e\354Er\354=\362^#\357\025\341\275!\034{\213\030{A8\366~\360^\017\336K\344\275\035\034{\255\214\275\034\034{\253\336\273\301{5xo\006\307^\f\214\275\027\250\275\026\274\267\202\367\"\325^\n\324\336\t\336;\344\275\022\2747\002\265\027\002c\357\003j\257\003\357m\340\275\f\274w\001\265W\001co\002j/\002\357=\340\275\006\274\267"
+	.string	"\265\227"
+	.string	"c\357"
+	.string	"j\257"
+	.ascii	"\357\025\362\336 \357\r@\355\005\300\330\013D\355\375\361^\252"
+	.ascii	"\367\372xo\017\265\227\207\261w\207\332\253\343\2759\336\213"
+	.ascii	"\343\275Sj\357\rc\257\r\265\267\306{i\274w\306{e\250\275R\306"
+	.ascii	"\336(\265\027\352\275O\357uzo\f\265\027\206\261\0031\312\020"
+	.ascii	".\022E\243R\346L\370\343+\240g\250\231\027\327\177\340\271Yr"
+	.ascii	"\3718\357\235\007{\334\007\217\367\020\203\226\241dh\024/\036"
+	.ascii	"(\224\035'r\326!\272\331\311\201\361\242\353I\205.\310\024.\022"
+	.ascii	"}\202\202\2219\027\352\370\027\352\205v\225u]\207\223n\331\205"
+	.ascii	"\343\\\347\\\303\324q\334\370\324\030\224\013\335B\233\224\335"
+	.ascii	"@\2276N\344\234C\244\323\342M\241\277&'?bD\026b"
+	.string	"\030q\221_,$\346\214X\343\211I(B\203\2568y\215\273D'3\316|gA2>C\3522\306\374P\220\341\025\251@Q'\242Kl\232\225Asg\205\n\261{`\305\024_Xq\221\0074\370\345\254\b%\230|\372\243l2\371\021;T\241\234\230\f\354t\366;\023\212q'\030\217\021\230d\272>}\370x\201q\246\013\004|q\"\272\302\246\231\035\n\030\004e1A\271Q\326\211-Y\213\374\337\235-\357,\027\357KB\361)\233Lv\\\334\375\221\203\302k\232\316\177\347E\026oZq\026\3122\337K\262\263MO\331\354\2414\363<%\232\343)\335\224p$\250\234\2568;\265\2741y\f\247C\302r\227\005 H\020\225S\025'\242\373\3234{\241y\307\304\022\331\323&%\332\232,\362q\340\264\275\233\244\270\033\030\310\236b\rP.\317\231\f\3059\317{\311t\024'\316\324\206g\263\346\304\215\306"
+	.ascii	"6\347\200i\212\221\030!\345E]\"\326\272\026\3719\271\265w\227"
+	.ascii	"\211\247\211"
+	.ascii	"\223r\023c\374\226\200g)Kg\3007W\211/\221x\211\267\244\0174$"
+	.ascii	"n4\246oM\b\247\037\020g'\002S\262\002\266\3107\231V\336`#N&\311"
+	.ascii	"b\314\331G\320\341\3619\237\2118\363y\177\205\270\b\020\017!"
+	.string	"&\351C\200\207\001q\2431x\3159^\306X\371\220D\345\037\3630el\221\367\322\302\330R\357\032\200@\007<\270;\313g\255\322\267P\271\022\214\2738\313\3003\225\017\347\300wX\322?xx\222\002oK\036=\234\210\016\016\342\033\0271qHGi_\"3\212B\266\310g\301B\206t5+Hwn\344\374\234\323\256\002\037\235\375\274U0\372Q\321\215\322\222ThE7\242s\323\234\241\250\017\2364Dj/q\326!\354l\221?3\013{\237\021\275,\331D\246v\"\272\271\245\023\263\340Ym\365t8\013\276\245\f\275\003\207\017=\035J\222\252\215\201\217q\270\321\334\"\342\034&m\314u,A\0259\210\200\262Zq\350k\034\260\234\004Z\0073\032\3746|\355L\230\277\320\026y0'h\033\356\365\256\rz\024\227\203g,=\210\217\347\301\367\024\343\217\352\215P\347JR}kJ\275\021\235D\3049L"
+	.string	"\231Y \026\222s\374\332\346a^\"\341q\373\253!O\240V\0172\206hf\373\b\206@\335V\223`\202\364Yk\354\302\226E\375\332\262\005*o\235\003\271\031Zm\221\317\262\340\270\256ZS\333\213_1\330\013B\224\022\020\260\252\216H!\271:r\344\312\212\004\221%F\252\206\224@\004\311\261\n\313\b\221\016R$WE\260\254\220,\031\300\303\007E<@r\025\204\bV\325\003F\256\222`!\271\262BZ\253(%XH\210\034\301R\262$\204\016\2524\260J\"e\345\201\024\222\"UG\244\254\222(\221\212b\332\253\021\210$\221\302\272\272J\"5\024\307\204\237eY\013\341\033\032\305\354\267g"
+	.string	"#g\277\262 \033\234\371\234@\206\234\353\260\3718\340\274\347\334!\344\234g\210#\3079\217\315\306\323\371\016o\006\257\347\273\255(\326:\333\031:1\327\331\256\354\005w\235\341\266\232\330\311\031\r\233\n\026;\233\331bb(\347&\333\022\223\235\313\340\215`)\3471N\020|v\026\203\227\304T\316b\266\216\252\030\022\261\332\271J\031\007\306r\006\203\366\304\310l\307\372\327\356b\275(\r\314\035&_*\271\020\002B\004\324Xx\201|qq\321\f\001\003\030y\2107\002\304\275Yd\212F%\356\374F\311W0r%Pl\213x7B\302\031\357\334f\204\223p\365\021ZH\315\222\307+J\270\343\3257\244eH>d\270x\307O\216\220 \033\034\205]"
+	.string	"pv\213L\241\214\301\235\355\216<L\t\346\251\355I\n\346e\203\037!\243\270L\362\rDx\222s\234\020.B\221\207\220~)\301P\365I\275\322./EN\225r\201\360!\303DD3\032\374V"
+	.ascii	"\200\f9\323\335\217"
+	.string	"\267\273E\246\313\224\311\333\371\356\203\247\253\022\314S\237\305BnC\376\201\323\320\203\017A\005\231\310=8\307\320\301\211X\275\203D%\230\037m\204\006\271Y\375\207\226C\016>dh8H%X\306\307\001?\261\327\003\315\336\"\321@5\2409\357U\235P\t\006\252\r\320\240\363\200W\341\t6\360\003\214\344h\360\006\316y\031\\\003\f\236\301\331\005\364\217\022\314\217>~\224\315\251\266\031\234J8\251>\030\374G \332\347\202\017\031\n6\315\370\352\254<v\b\271\022\237\2163|\213D\365\3449s\346\263\340\177\311\246;Bn\201s\217\034\325\205Tp\252s\035\344+\240\340H\264/Ie\205\362Qp#\274=\31592\354}\311\201#\307\207\376\246\314\374-\022\335\3233s\376\233\340xwtd\310\361\t\364,i<\207\004\247q\366\213\340\022@\360\b\346\330\311\221\001\0028\017\234\310\351\207(w\347\206\215\247s"
+	.string	"\254\341\006\270H\264\r\033\2673\240\003\257s\322\355y\272\003|r-\376\304\300[\234\363,p\006\024\370\002rj\322\354Q"
+	.string	".\201\0239\371\232qyb4f\254\337\020(\243\031\270H\324\214[\363\034\210\300\231\311\2472dhX\217"
+	.string	"\231\274\245\362\274\032p\345\231O\0017\200\200\027\200\276\220d\2726TL\030\024h \340L\367e\200\0239\361\320\334\305IEi\375\203 \024Sp\221h\027.\314\263\240"
+	.string	"\327\222|jS6\231X\320\272"
+	.string	"N:rZA\316yg?\001<\b"
+	.string	"\017`\r\315\202bA\241\020"
+	.ascii	"\250\032\220\0239\351\344=\305\311\303\226\306\211\353HL\030"
+	.ascii	"\203\360\250r\210=\2252\245dDD\024$\005I!\215\001\322\r\b1\310"
+	.ascii	"0\211\214\033\022 \0221\b\307\201T*\007EHS\250\321\030\\\031"
+	.ascii	"\273'\246Li\243\323\260]@K\354\3212H\363\270\214\346\271\301"
+	.ascii	"\202&~\346A\314\360!\b\375T\201\340\224=\fa\355\345;\215\260"
+	.ascii	"7)yJ~\024\313H\007@$\307\210\022J\224\314I%\217p"
+	.string	"\273\252\271*\200\367\0049\016\275\346\261\243\016\206r\361~H\320\376\342\377\232I\305Hi\244\037\320p\274\230:\272\344\203\t\201\306_ \n_C\217/\236\023x\360X\200`|\302RY\232\262\245R\3709\307\251\274\274\220\271\242\206\2161\211\241\007\225\350\t\230\030\337\351\317!~Y\217\337\254\036\n,\224\337GD\322q36\"\213\306b(\260\217\034\316\001\305\314:\265\317d\234\374\027\364F\377:\311\006F\016\023`0\037\206\330N<\024\2408E\016Fi\330\271!\310E\274\215\024\220\340\216-\222\240\307\207x\340\253\230\356\334\350Jo\207`G\036\024\2340-7\304\313/o\333\316\242\b\020\323\021a\370\027\231\b\013\304\204\232\003d2\367\323!v\321;N\325\3070q\234\213\370\273\322hb\365 \212=v1\f\247\202Fa\201\230Ps\200\254i\004s\372i\033)\255\225\306\201\2628bf\267\246H\312"
+	.string	""
+	.string	"\037\3058gH0D\360\023a~\203\333\272\251]\336\316\240?O\200\r\200G\3766\210\362\234l\306\253\321\025\312a\323K\320\313\037\023"
+	.string	"\f\204r3\334\353\2042\2719\376\030\210;\206\024?p\363\332\257\020pJ\037\026/k>k\313l\"\356\203\265a\341`\302\220P\3447\201p4G\301[W7\362[A\327J\365f\374\032\361W\374W\314\033\037&\024"
+	.string	" \022\217\210\374\006p\016\223d\323\031&.m\\W\ra\244\r4x7\354\361\327\260Q\366\326\331\026i\b!u\232\374\356`\026\241\036\226\237e\027\363\003\262\347"
+	.string	"\037\353!\254\331W\211G6#\301\322\347M\222\300\351-\320`\255\30528\025$d\222\235\352\300\345\206=U-CJ_;|J\034\256\004Y\027`1W\357\232\220\350\274\177\246\276g\316\301(BW,H\0064\204\376\n\003\250\254\320C\347\331\032\nj=R\264\023b\241p\243\234I\030Em\317\273F\273h\344\027a\023PP\347\311e\332\254\321\227|\200\310y\350#\331\370a#T\212\2678?%s\027\n\037\027\200\013{\021\204\247\300!k\360\341[\253\031\206\004Y\036\370\213b\022Y\255\306\324/\203\372\311\235\365\271\351\340;\272P\266\315*=I"
+	.string	"{\030R\307\345\t\342?!\215l\363H\320j\226~\240\023\323\332\302\003\226\244o\225\264"
+	.ascii	"\203\271rY/\350\361\370I\254\251\201\344\370\214\214;+\312\321"
+	.ascii	"\030\020\025I\f(\352"
+	.string	"\365G\311Z\321D\227\022\330ET\215\213s\301\212\025\321\263\342>\224[+\nJ\315\232YM?\243\222\203(;U(G3d\006\315\264\277\025U\324j\363Id\n\357V\b\335\244\345\303\344R\301k\234\265\215\365M\362T\221\345\224M=\243n\315\035\211\223,\371\374O\271\264\274\212\201\323\301h\037\226\013j\205\350\265\377\315\0056S\357xl\217\243\202p\261\032\t\317`\213+_$\002\270\031\211\210{\314~\274hB\235\203\216\257Bm\022\213Y\202\340\210\206!\220\005\372\\Q\272i\300s\216\f\351\366\366\016\351\216$\373h2\037O\351}\365%|\0074\342\373\216?>\313&\231j\006\342\362\225\276\364\203\322,\206\256})4(\352\355c\274\346\345CS\273:4\301]\224\344w\035R<\033\247\f\332\245\tTX\317\034\343\340]T+F\372cUh8=|\301"
+	.ascii	"\373\035}\357\217\263\211\260L\247>B7\034\374d\220\340\350\004"
+	.ascii	";1q8\377\302\247\211\323Q\202\265\022-\306\304\343\274\013\230"
+	.ascii	"k\317\320\205\340X\315\217\003\232\331US,S\b-\350\275\313~\315"
+	.ascii	"m\007\244\207\211>\236\205 \364\211rb\265ZKi\245\352*\205o8k"
+	.ascii	"\257\265\224\322j\325RJK\025\316\342\265\224\352\255\256R\305"
+	.ascii	"\272\2454TQ%\225\2636\245H\220\335\003\212\264\202\232\326\310"
+	.ascii	"\217\306]\260\354\314`e\365\202eZ\33045o\225\0077\302\r.$\013"
+	.ascii	"bHC&6\256\026/\247 ]o\211\02675\315g\341\331O`\200+\250\340\263"
+	.ascii	"\025A\214.h\225\215\224\375\204b?a\352z\220Uh\312\2510`\020\315"
+	.ascii	"\232`\231I\310O\033\007\002\226\344\343\223\241[\3172AxPh\236"
+	.ascii	"\261&\211\002:\247-\307=J\256\304\342\255\030\360\303t3\320\020"
+	.ascii	"\037\217\264\326\376\240)\3449\211\361\317\272}\264\305}\273"
+	.ascii	"\201 \t\274<\331F\253\272G\232;\205\230\341'\316\220\363\"\355"
+	.ascii	"J\247\016\027\302\026\315\276\217l\210\\\3370vfp\303\026\300"
+	.ascii	"\007\265 ?\237p\363:\"\032\006*\264\003=zF\nOK\207\036@\320>"
+	.ascii	"V1&\301S\365\005\016#>p\366\221\226\202J\t\255\002U\005E\003"
+	.ascii	"e\215'\201v\364\236\322\236\323\002"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.78.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\366'5s"
+	.ascii	"z\273\364(K \322Z\031\016\027Um\247?\253uk\376\2563@\025\322"
+	.ascii	"\226sM\374\212\323\215L\0032\273\260s\005\023\302\303\337C\020"
+	.ascii	"\314\307+\371q\346J!4\252\252B \252\361\346-\340\263\261AW\216"
+	.ascii	"!\231\234\030\255\352\"{\223-\245L\001\242\002,\002\177\002V"
+	.ascii	"6n\367\337\261<\246\230\035\023\214"
+	.string	"\357ko\371W\350\345W\330%\004W s\213PK\2600\253\275\020\231X\305\346!\323*\256\360\t\\\241\2239N\216a*3\211t\207zt\362\f\371\230\204{LA8s\376\344\004\026\006\256\205q\3520\337\0202\001\225\210\205\177\312\303\302>8&\2337\346\232f\341^\\\241\036\0314sxuvf\352\3220{\320c\226\341\243\333\033\263sKV\3566\226\177K~\2360+\346\347\371\t+\367\f\226~LUUyN\370y\266\230\364O}\233\347\371\037\367:#U\024c\234\0250 TUE\332\342\221\306~{\235J\343\0240/\030\251\323\204\332\244,\314\217\345\177\273\254\227\251mSa}TU\212\341\016\252\332F\343J\306-\276\315\370\377\313\266[\246\376\272\263\rm+\325\372z\002W\250\252\352R\213\005B\267x\356\017\272\305>\333\251\275\334\233\217;\334\337\356v0\377\3626\037=\f\340\261\243"
+	.string	"\035\004\344\3001\300\r&\033\002\324XR\242\221\2044CF"
+	.string	""
+	.string	"\3048\202a\364\302E\213\"\026+\210T\f\t\035S\004\001\241\3709\341c\242D\017\211\021<;\"\214)Z<\233\247\276T{\271m\356B\251b[] +S\356\233qP\366pP\346\262\370onX{0Xe\256\370_\336V\266\302\372 \"K\256P\227\310=\020\r8\\\036\207xuxG\001C\254\216!\364\f\231\200\034\201\213#p\315\312\003\334\200\263Lp\266\357\r\333\020"
+	.string	"pk"
+	.string	"\002\266\341%\2454K#M\034=N\312CB\2633\320\254\034\037XF"
+	.ascii	"w\013\300\335\n\322q\f2Gs\013cn\r\307\260\321\0131\353B\314\036"
+	.ascii	"\206\341\026rE^\226\205\027\252.\274\202h\313\252\330\342\204"
+	.ascii	"\215\207\204\326\366\270f\305\344\024V\202\252,P\225\254\032"
+	.ascii	"\030\305O\332\236H\333\242\201}L\240m\t\264.1\356\t#\001\266"
+	.ascii	"#\300\22610\217\221\326\356\270 k\001\206\025\261?D\201\001l"
+	.ascii	"]\334\020e\311\306sFX\236\013\373C\024\345\t\264\246\f\216\026"
+	.ascii	"\247^\213\2363\200(3\330\263\365\344\004\322\252r\305c\313X["
+	.ascii	"U\\\264B\fS\242 K\262@\2470\217\214\234\2258n\366\360t\340\242"
+	.ascii	"\205\312\224%\213\362\265\263\345\004e\276\027\306~\272@\226"
+	.ascii	"\324Jq6\t\352\363\206\332\ns=[\311\223'\f!\226m\356\371\002Y"
+	.ascii	"R\311\234\376PU\365|\265\325\302\236\201\375\213\\\376\247\360"
+	.ascii	"\277\270\022g\302s\341W\241=e\013!\316\202"
+	.string	"_\205\362\212\202\270c\261Rh\340\031\210\257\351zG\024\347k\352\247T\261R\250\233\363\233\257\351\236r\250\315\235\320J\241}g\277\257B}w)~8\263\371*D\247\f\332;\253\371*4\346\016(\357\254\367\3658x\207\002\357\354\303\327\343\237\362\347\314\331\356\353\321\356\356\204\231\257\307U\351\263R(\017&V\n\335\241\304J\241sg2_\217p\312\036\035\356H\254\024*w\016\363U(N\311\003w\216\373zL\274\333\001sv\373z<T\212\360rn\373z\214sg\334r\346\362\365\230&];k\371z$\243D\325\316Y\276\036\233wE,g\034\276\246uN\033\316W\276\246\202\312\256\341\\\345k\332w\3074\234\323\276\246gv\245\320-2\332\377U\b\216RU\2516\354+_\2512\266h\243\221\334\324Q\2750\342\331\356\213^\330\231\004\335\336 X\n\233%\371R\371\bO\274WO\350\026\267\213"
+	.ascii	"\225L8q\273\314\2067\300V\001\255\321\333\\VnIt\003l\302C\374"
+	.ascii	"mIn\263\177O\265\245\374iS\316\314\312\306\304\300\276\226^]"
+	.string	"\\[Z\315\337\254\346/V\363\327*\345#I\371%\244|\022R~T\312\207J\371O)\377H\312\037!\345\213\220\362\215\244\374\")\337)\345{\320\374\r\232?$\345k\320\374\fR>\006\315\267 \345W\320\374\t\232\037A\312\207\240\371\0174\337\201\224\337@\363\027h\276\220\346#\220\362\2034\037H\363}\244\374\036\315\347\221\362w4_G\363s\244|\034\315\277\261o\273L\013f\327\306\266\355\326h~\214\215\333\037\245|\030\31572\362_4\337\205\221\337\002\345\027\031\371,\232\277\"\345\023\245|\025\315\037J\371B\315?\246\374\024\315\017J\371@(\037E\312\377i\376\211\224\357\203\362M\244\374\022\315\357I\371$P\376\210\224\317\323\374\235\224/\"\345\033S~\232\362\321\224_L\371g\312\357\224\317(\177\367J\b]\326\240\360\247\252Z\211uT5E\036\002\275\\>z\003\273\310\b\240\253\031o\277\202"
+	.string	"\024\021<\262\361\356\212\364\n\372\234\2513\303\201\017\017&\342\324"
+	.string	"\351\355\002\322;\347.F\231\033\306\216\274\232\313\354\327\020\206\323\032\036\331td\234z\rK\260\365\030\035\304xu\211=\004z\275\020\350%d3z\261l>\263\337C\027\036\354\341\221\335\214\363\240\367\220\304[SR\03370 \220\350b\337\223n\033\001\300\030\034_\030\027\245\220\336e\253-S\013\351\245S\327\242\315\230nm\304\300\002\r_\346\260)\372j\246\3333\025\013\r\250\216l.[4h\246\342\351\177\212Kki\242\201\2666\345\245\bH3\203\234\245\220"
+	.ascii	"\217\026%\335\002\275_r\013\364&2W\020\2015\253\355\331\211\n"
+	.ascii	"\f\234\034\3318`\301\240\331\211\210\266\322Wl`\260\026\201\203"
+	.ascii	"r\214\233\003\275`\0164's\030\022\022k\236\333\263\325\261\002"
+	.ascii	"\253#\233JZ\005\315V\306)h\306\242\2322.\371@\257\330\003\315"
+	.ascii	"O\306\244\020\2238\0264\326,f\317Y@\020d\035\331fR h\316J\311"
+	.ascii	"\232`\264Q\240\307\322\346a\004\275c\0214c\335\200\342\247\254"
+	.ascii	"\331\206=o\235h`\353\310\016\003k\240yK\005\377\016<0b\017\215"
+	.ascii	"\232dS\035\355\037\202\206\241\251\254Q\031v\203\311\tz\313&"
+	.ascii	"h\326\262\342c\302\2549p\317]%\202t\035\331^/\004i\356*\272\300"
+	.ascii	"U\264\013tCZ\013z\315\372j\231\332\202f\256\265\007\316 \025"
+	.ascii	"\211\263f8{^\216\350\261<\262\243h\365h^\236\235\325t\204&A\263"
+	.ascii	"p\326g\363/\231A\357\331\3712h\366\242\302\323f;S\232\335\354"
+	.ascii	"\031\314\350%&\203\2106k\252\335\001vd\257\320Ov4\2035\215v\322"
+	.ascii	"M\372\217/9\244w\n\033.S\017i\376\002\334=\366\261\371\031\377"
+	.ascii	"\326\206\017\233ul\016\2334\210\377\366<f\001\006\274W/6\325"
+	.ascii	"9\030X\005\035\202\342h\017\334\334\360\330\221\255\0161\252"
+	.ascii	"j\023\034gDN\334\340\357\200\b\021t\2138z-\2530\214K\027&\375"
+	.ascii	"?\211\3534\035\265QU\225\200\337\211\351\204`TU\025G\331T\230"
+	.ascii	"\221\025hT\266\270WA0\341D$;;\267\277&\"\023N|\322n\320\233\326"
+	.ascii	"\347\252\301M\334\327\241L\275A\263\330\236Z\322\356\326\316"
+	.ascii	"\342\204Hr\342y\312\376\007\025\037\366\020\352]\025\333,/\242"
+	.ascii	"\224\244\210\022\"OKPQOOQMC\027\234\340\004etZr\204\210\tE\250"
+	.ascii	"(#J\232\240\226"
+	.ascii	"\b9\021\202\021\020\240\242\2028)!2\301\221($J\240\242\232|\336"
+	.ascii	"\244\224D\t\224\323\223\222$KD\370\200H\007MH\226\232@X\2022"
+	.ascii	"B\344i\251\tI\222%\245\242G\221\340\204dIIT\024\222%\2366&\333"
+	.ascii	"R\276c\202P\030i{\252\330V\005\216D\214\tBi\244\215\361\030\375"
+	.ascii	"\037L:\371\304\304D\036\026h\263\003U\261\205\235J\213\256\305"
+	.ascii	"\t1j4\313`\220\241F\263\314\360#\250\321\034\252\f\350i\024\313"
+	.ascii	"\f\005\254U\243W\316\344X\254F\257T\335\330\254F\305\324\004"
+	.ascii	"X\255F\301\374\224v\253\321\2573H\313\325\350r0\200\355j\324"
+	.ascii	"\313\357h\275\032\365\252z\261\313F\271\374\212\366\253Q\256"
+	.ascii	"*\242\005ktKMh\305z\023g\b\332\261\336C\265\237-\353\245\343"
+	.ascii	"gb\315z\r\317\220\330\263^\302\301\235\235\322{EpM7\255\217\032"
+	.ascii	"\353SW\266\271;ql;\030\002\301gy\201\n\b1j\356\333\357\\\002"
+	.ascii	"H\346\216<\323h@\322;\007\003\313\211\326d4j\030f\226~."
+	.string	"\332\310E\257\030>\004\202\f5\023\356\267\314\001%\2249\3624\223RBo\231\027dSY\3161\031R\030\352\027|\311\277&\342\212\036Z\321K7\b\344GP\263\020\373\255\363AB\335\221'X\f$\364\326\265\200a*KR\233\244s\251\374\021\324-\316\027\212\346\340\034;\350da\231\372\330\333\303\234\036r\336P\031\320\323,g\277x<\242\360\216<\271\316\026\242z\361X\344pF\231\312rj\235Pz\232\305\322\314\211\356)\261\303\211^\2735;\n\260j\336\333\257\236\016\250\325;\362\274:\255\240z\365\210\372|rVY5\021s9\267\323k\265\323\213&\r\0019\260\232\345\366\273\006\307\323\232#\317\344\311\344\251w\215\212\265SMDT\321L\336\350\305\272\321\273\327\034\340\006\334~\373\230\216\364\035\331t\2068\322\333'TH8\230\325Bj\313\267\034\275Y9z\331\274\331\020@\253\031\314~\001k\214"
+	.string	"xd\317\tb\204^\300\024@4%\241\005\256)\020u\364j\351\350\375\373\262\244\224\267\33784D\210sd\277q#Bo\034\2406\177~\027"
+	.string	"\361\241hn\341\321\273\305\243\367\r\232\244\036\264P!q5\367\260_93\214\3109\262\327\2501\322+\347g\255\323\350\345\375\004&}\004\203\007\250\202\250-\315c\210T\211\004\"\"I\222B:\342\r\b!\312(W\307\003\022`\342$\304\303X\306\214F\"\224\024\224\241\016\327/Aj\n\237L\221"
+	.string	"\034'm\366\032o<\017\367U\365\274\032\025>N\302{\264\252zh\3030v\362_\215p\006/RC+\236`\337\265\343\335r\371\343\324`A\315\241\205\370[\373\202\3045Q\\\216$DEbpA\210\267"
+	.string	"\374\313\243E\027 \307\2300d{\211v\307\205p-\\I\250\215\200a\r\253,\260.\\}\027\023P\323\024B\235\276i\260&\212]\032P\272\252\007\306\342I\277\233\346B+\375\f\332\217\214\314s\025\221MT\202\324\246Gil\334}\"\226_\205^\353\367\332\022\316\377[o\366\304u\034\333\317\006x\342T\351t\254p\374kuj\001-\032\230q]\354\341\225KO\223J\243p\372\300\257\032\016pj\375\363\306\221\302\376\007\264\004Sg\205\342o\342\211w\353^~%\377Zf\375\257\352\365\272\223]b\240\031\034\334\236s\241\001\201h\025K\327\027\2177\255\273\305\310\215m\244B\030\006x\"\360F\266\300\344:O\200\024\023\336\273k\366\253z\337\373l:\275\034>\215\234TdR~\314Cp\013\312\326\305\314\3570\262\357G\370\315\245"
+	.ascii	"\223\024\275\300)^\376\357\366\354\257&[\3770eTah\264(Q\253\253"
+	.ascii	"1Y\217\231\0366Y\3314\250\032L?\221Q@\023\325aTf\234\003\240"
+	.ascii	"?\2605\256\353\346s0S\0262\204\364"
+	.string	"\352\274\357\224\316Z'Q\2559'\324\326.\216\f1@:\371\007d\006\2350\236\017d\240\235\370\207\222\371\323 \252+\205\335K\004\361\363\002\207}\023W\2462\266\351`\263X\301\367o\340\264\265\354\327\f\32599^K\306\331\f\256F\270Z\225}[\371\022\342\373:-\214\fx\224Pp,\302\267\333\332K\305\tW\243\262\265\345\263\032\326HK|\203\253\214\364\372u\313r?\341\366U=\374\326\373\335\334\303I8\206\363\322\243`\372\231\036\\\372l\237\335_\351\277K\234\365\364\025\270\220\336/,\355h\245\274zn\354\326Z\353\177\245W\337\371bF\232\325\225\335\200\354?e\376k\274!\223\230\030xQp\305h\315\220\201\242\006e\320\2631\327\206n\315\020\350\207\345\362&\302\033\353!\204\263C\356nY\215fMZ.A[\255\313A{+\f3\305)\216\337+\264-\007\177o\266\205g8\364\365\2526"
+	.string	"'\275\203\0167\204z*^4\204\n\212\322>\017vZ\262\314\ny\345\213\nZ\250\\\260@\203qG\235,\207\240B\224pK\316\317C\356\276\273\013\235\262G\335X\360\366\332\260\346#\306\327\302\262\231\230\263(\210\202o\037i\026YP!J\270%w\016\323e\004s\257\307\260\013:\363x\017\312gq\323c\233\206\235)"
+	.string	"\220\034'\247\244\022\225\2217[<)\374\363w\374%\275\206\235 'g\322\2470\25357v"
+	.string	"\331Nu\0368\336\375\351\213\255t\225\2564X\214aIYz\023\324y\361v\035\274\201\264\345\005\354F\373\263\2541\242``=\177\224\324\256U\264\210\271\235\353\365*\304\317^\366\220_N\344"
+	.string	"cN2=\360\230Yu\236%gGw\003e\003%\362\003\023\313B\234%!\223\275\372\343A\227\003\335\340\300\300&\261\tm\004\307\017\346'\263\373P\3731\030M'\005\264|t\352\234D^\n\025\306%\026G[\013b\002q\341E\231\306\300\214x\317O\314\024?k.\326\362\312\207\231\301\370\0361eq\221\037#\261\243V\r\346xg\321\266\"\026\342\220o\223\345\3319\303\353\320\371\326O\354\346\316\326\002\236[\252\366\0329\334\376rK\316\rh\347\f\373"
+	.ascii	"\242S\025\300\206\367\227\301\021\"&\367\200\250zC\276\244B\210"
+	.ascii	"\236\263as\324\326\365\242+\366\277j\245\240\277\036\352\215"
+	.ascii	"g\350\254\265&g\242\335&-"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.79.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\337\005\205$"
+	.string	"\nBh\016Dp\336M:{\300MV\200\2756\260T7\312\356\267\220K\027\230s\001\323\201\371B\210S\3733\351\237\034=\334\234-i\374\245\200+*\n\r\367\240\320\375@C\374Soj\310\005/\263\266M\032\221&wJ\001\327"
+	.string	"\301"
+	.string	"\321"
+	.ascii	"\302\327\253z\303\317X\236\267Z\213\017^\232\303\271\364E\341"
+	.ascii	"\007\324!\333\024\013\347KSj\237\313\273\3508Y\016\357j\365\032"
+	.ascii	"d\246\326\"\004/\235/\225~d\276\314\275\310|i\333\021$\350\260"
+	.ascii	"\220\200\325T\037\245\261;Xf\201j-\376\266\311\205\007\340\353"
+	.ascii	"\361v\247\316,sK\205\276\361\032\206Q\326\262\266\246\016\240"
+	.ascii	"\353\276.#\022\332\243G\316K\340\005\204\353\273\317\321\342"
+	.ascii	"B3B\317\334\221\034&z\034\020\335\004\371\331\023T\321*Bu\367"
+	.ascii	"\002r\344\346\220\2279\007oi\200\002l]\345\216~H\311\372\321"
+	.ascii	"\212\346rJm\220X\237\243\325\225C\360\225\004\356\306S\036[U"
+	.ascii	"t\261x[C\363\350I\032(\367\322\352Z\252\253Pk5\315\332\002r\007"
+	.ascii	"\270m@\266M\330\245U;\345\223\271\0137\310)\032\367'i\236\250"
+	.ascii	"\355\202\371g|4\004\256\244\216\025\242R\225\224\361\315\330"
+	.ascii	"\355\364=\207\371\362VK|\343\322`\214m\267\253}\021\221\324:"
+	.ascii	"u\242\335hVm\360R\300\322c\0273poU\264\220]\034\322\005\263\277"
+	.ascii	"\311d\022\316\373e\227\324\007\222\226\032\311\350`\356\242\222"
+	.ascii	"\232\350\305\177\350d\277\200{\271}K\335+\251yK\275[\352s\251"
+	.ascii	"u%\265iR\227K\275KMK\352+\301\300\362\303\307\326\211k\265\376"
+	.ascii	"H\022\252\310\362\314\224\203\371\275\034-\214Ep\035\263\274"
+	.ascii	"\314?\003\203\303\312\225\035 n\366\243\335\263\215\2279\211"
+	.ascii	"\220\232Zk\317\206\335{Im\035\276\321=\333^\002\336\360:B\ta"
+	.ascii	"\266\227N\247\303\002;\265V\n\036\316\366\341\254\265N\230#\025"
+	.ascii	"BA\230X\224\371\322\\\tN\310\250h\322~\234#\243|1\217 A\302|"
+	.ascii	"Y\356\203p\225\301\025A\332\"\242=i\314]\2445\275\3623\244I\017"
+	.ascii	"\355\356\317.b\030\366\005\253\320\323\316\240-N\267`\027\232"
+	.ascii	"C\233\2647>\247f$\316\330v$\016M#J\367e\356\037O\240(w\312\200"
+	.ascii	"\021\216Zy\025&\321\256\370\321)\276F\305Yk\325\004\177\355j"
+	.ascii	"\230|\261\227\006\006\351\263\202\346K\242\325\322#\020\261\013"
+	.ascii	"\231\217\322\265\233`\320gY\251j\247<\264tuL\222|\301*DE\223"
+	.ascii	"Fs%\351\226\033\332/\224\021O\025\025\344\035\265\237h\320g}"
+	.ascii	"o\247-\016r\030\301\0321\230J\330\b:\235Q3\202\301\025eS\324"
+	.ascii	"\323\214\323\351\251I\n\350T#\003\221\201KQRNA\031RQ5^\260`R"
+	.ascii	"\001\204\372\001[\374\234\232\230d\374\200PQ\277%\004~\232\021"
+	.ascii	"\204\372I==A\375zE\252\347\352~!\363\\AR\355\320\b\250}\001C"
+	.ascii	"X\23611\317\001\360\321\336\332\032|\333\253\302\3256l\373R\\"
+	.ascii	"\203f\214o\301\374\263\237\3101M\n\317h/66\b\253\214\231\264"
+	.ascii	"\276\345a\013M\337{\214-\341\303\346\neX\177\310\364x\273?s\037"
+	.ascii	"M\201\020?\201v\013\306\346\007\320\234\342{\364\034\330\243"
+	.ascii	"\025-\236;v\316\206\313\f\256\210\233\363\326hi\334\025q\267"
+	.ascii	"\274-`v\236\273\333\2447W[t\213\264\347\346\352\\Q1W\267@\266"
+	.ascii	"\2605\277\245\375A\236\013V\264\346\336\313\001p\250a,\304\020"
+	.ascii	"\223\246FDD$\220\302\244\305\200\002\221\2513\036\021\2205EC"
+	.ascii	"\024\246\205a\016D0\225\377\227\365\007b\260\321\030\253\006"
+	.ascii	"9\023\211\316S\344\346\357\336\021o\267TDv\355pq\352\352\003"
+	.ascii	"r\347i\366T\325\313+S\366gE\031\343\005\037|\304\335\2213\241"
+	.ascii	"zl\361\223\350\017\225\226/(X\202\213\212\303\t\327\355O\177"
+	.ascii	"\024\302\006;\030\247\317\344\3324\316\210g4\372\246k\\y&\013"
+	.ascii	"\230aO\367\245`\341\276\353\240\375\002\020\345[Fv\245\274HQ"
+	.ascii	"7\273Ps=*[\001\341W\364\352sR\337\267\205\306\337\275]\271@6"
+	.ascii	"\314\227z.;h\314\004$\306!\221\242\355W\353i\021\3051\274\200"
+	.ascii	"\214\364\201\026\234\364.\277\022\"P\202\213q<\030P\225\216\200"
+	.ascii	"\243D\361\236\300\b\027\006\004\3408\256B\036\265\305U\270J\251"
+	.ascii	"\036\233\025\030\202\325"
+	.text
+	.section	.gnu.lto_calcActiveAdjustmentRanges.80.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`E\004\305\033"
+	.string	"v\262\257I\240\230Q:\300\341\367;A\021\201\004\203e\020\013\254D\033\251\376z\035h\315\273\231\351\263Q\307\266\200\2053@\177/\245UU\266\207\255Qo\340u0\200\034'\207\224\222O\334\231\244CtI\374\246\317\267F\b!D\356\224\002\230"
+	.string	"\216"
+	.string	"\240"
+	.string	"'\031\214+\354\330\311\037\350\230\357;\221\334\177A\257\273\372\3629Um\325\212$;\351\233\363\244\233\274@y\022v\002\345I\347l/\007XT\035\004'*\243!W\255u\2668\254\340c\360>i\356\257\323,\311qi\316\007~\254\321\203\270\343\351\376\032\351\321\022\335\261 \311\030'\020\177\024?\034\242\247Y\341F\322\322M\245\2270\236\322\311\242\030\217\005\035\003\360\214F\006P\247-xDt?|\007'-0LIK\247f\205Z\253\351\216\227t\303n\033\210m\035{L\020g\342)_\207y,E\277;\351[\252<\231\2427&\210\030!Z4\214\302\356*\245\354\017\036x\013\220cg\373\234\240\337\331A\226\023\253\242\325\331\301!\272M\366\005<q9\362\332\260mJ\352\232?\335/\222\372\\js\251K\222\232\\\352q\251w\244\246K}\003"
+	.string	"\200Jx\337A\254\365E\361L\265\"\237\364\370\323\377;\265\357\027y\224\035\363\212\037\361\311\364\310@\331\261\007\375\241\221\013s\177\362\324kR\375\021\227\223\326V\255\365\302\031\337\035\367E4\206h\321U\273\347\352\235\021\262d3^\256\322\220\333\344\017%\3353\t\273\330\036n\345\303K\027\305G\303W+Q\204*Ak"
+	.string	"\314\225\360\205o\312\251\374\224'\351\036\251G\354\372\235H\225\344\314\270M\226\375\213\023b\021\3212\036@\237\344?r\340\355\254Y\033D\210=\324\357\002\212\312\252k\253hu~\324\247n;|\224]\342RA[\305\245\326*\341\311\241\320|\035']\263\331\312\2235\373\250g\2001C\212\017\"\222\030B\264\270_\206(um\223\235\307\350\215\341\222\335_\022\036\301s\333N\017m\203\005\240\022(h:6\0216\256\335\374"
+	.ascii	"\365\330n@?(H\210\240\205\250\341f5\235Y\017\017\3556\253\341"
+	.ascii	"~f7\013\354c\302\206\233\001\371\370\340f\261\240\320\263\320"
+	.ascii	"X\t\355\220\203\306Z\231(\374\367\003_\263e\204\026_\333d\023"
+	.ascii	"\313\264\331\305\242\262\277\266\205\247\312\327\376\367\261"
+	.ascii	"\326Z\317\007\177\255\315~x\034!\217-\324<q\327\302\231ea\310"
+	.ascii	"\241\337\235\213\300\354\262S\256\271e\247\3342H\017MI\256m\025"
+	.ascii	"\277\302i\220\303\317r-\0328\344\344\224\257%\367\300\320(\315"
+	.ascii	"\270Wxva\036\004S\250A0\205\214T\006\231@f\202\231\240\266 m"
+	.ascii	"\220\002\031\252\252\016\021@\265\205\310$\005i\3753\\\305*)"
+	.ascii	"\215[\021\021\303\242s\317\335R\306{\016r\212X\261\264\200Q/"
+	.ascii	"\370\r\275U\036\220\330\030c`\203\2378\204\310Q\001\202?z\220"
+	.ascii	"\330\261v\232Z\251\374\327\n@(\242Kx\326\206\304\324\330a\304"
+	.ascii	"s\223\016\346A\300\205f\001E \001Ct\235\200\305\021\335\364\026"
+	.ascii	"[R\307\362\316V\307(T\021\n*$\352\212pj\313\213\276B\370EW\027"
+	.ascii	"S\013p\030\tF\220\t+|\311\302\024HP\3648\316\353\230Yz\365\224"
+	.ascii	"\246\253\202\"\331\3773\035\324m\232W\032"
+	.text
+	.section	.gnu.lto_updateAdjustmentStates.81.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\254\006\315%"
+	.string	"\352C\334\016E\200\334M:\277\266\005\257\n[\024\200S\240\342\005\267\b\220|\320\232\343\241\252Z\200X}\242R\335\343\306\037\007%\313\246\326K\270w\324\223\374\031%dZc\340\372\254\3552K\365td\004\331\206Z#\233H\231d\324"
+	.string	"\311"
+	.string	"\346"
+	.string	"X6\202\260\214\253\326zE\354V\314\217M\005\250j\365A\257a\016\266Z\211I\272\323%\352.\200\224A\343U\366y\204b\305\335S\331{\355\211\273;\275\224O1\377\265_^\203\365W\305\341\311Vk]p\272H\272\323\004'\"O\307\013 Oy\267\346\356\034#\253J\2254\274\372\211\025k\255\274\336\332\003\037\211\337\222\315\377\224:\222\216\315\346>\312\307 ]fN \325\177\306\234U\216$W\303\3421Bxc3;\261\307en\302\220\340\216\353\024"
+	.string	"\tf\235\034\223\240\\e\t\002\326\030wX\36449\331\0250\301\312b\272\003Z\361\250\206\2255&\240r\276\001\364q\237\370\016\303\263\016\220\340\216snB\255u\371\004\006\277\273\357.qw\231v\311\031\001RAmj\365\375\334\365p/\037.\240\013\232\023\037^\265\372\036\234\036l7\306\315@tQ\23550\034^\\\336%\204\b\022K\344iw.\b\027\235S\307\233;\227\366\203\253\342\270\021\327\322\244\253\265B\330\227=\313\211\375\221\323uR\301?O\367*\310\323\367\251\374BP(\346fV\305q=\026\306\n\330\255\265K\354\361!\020yc\333\026\262;\362\032\030y\013\214\274\004J\336\243\222\327\210\362\0265\357"
+	.string	"\242\217}\207\376\365\025\242\274A\224\027h\344\0050\362\356(\357\017\345-G^\235\2167\227\343%)/\035yG\222\267)/\217\274W"
+	.string	"\264&\016\360\\[j\315\021\307\247\236\241fJ>\366\177\235w\277\017;\231\214\007=\322\266\332\310\220\003z\250K\234lM%o\233\312\371\312<`:\036s\211\220\223\264\242\235\3371\233\354\311\314'\346\220\315.\362t@\237\354\314\245\205\307\207\024"
+	.string	"\r\324\227\363\203\213r6% *:s"
+	.ascii	"tR\021)\217\243t\242\037hg\340\274\3315y&,\353j3%\201\310\246"
+	.ascii	"8\033\363\353_\326\276\206\302X\301\002\371\323\002y:\324c\237"
+	.ascii	"S\007\322\313\376\351\003m5|\3648nu]\366/<\215\322\217\226\240"
+	.ascii	"y\251\241\321\365\257\374\202\016\341\230\333n\23564Bh\0062\327"
+	.ascii	"\016\320\240\r\301\334\354bx\231\f\271.h\\ih\271\216!\034\353"
+	.ascii	"\372\022{\177\0328U\256\214\255\265-H\262\243\300\336\370\370"
+	.ascii	"m\217\270\233\366\256\206\r\374\223\354\004VM\265c\323\276\034"
+	.ascii	"\016\027\243\264\373\021\006\314\330\r\212L\371Y\213\342\204"
+	.ascii	"\223\211'\250\n\001`41=9\321]B\222r\361\324\264\302\205\324\213"
+	.ascii	"\024L$D,E\361\226L\360\236\234H\254\340-EI\361\220\020,\024\213"
+	.ascii	"\246(\236\013(\250(\336\216X\365\026\022\345\277\2323<S\325\275"
+	.ascii	"\237\326Z\2411:\242\3567\274\340B}C\250\203\272B\031\266\301"
+	.ascii	"\347~\t\262g\374s\317\310\323\240F\340&\253\212\343>\326Zk\311"
+	.ascii	"\340BM\324'\236\276\t\305zl\254\260\316@\377~\332)\320\004\332"
+	.ascii	"@\371\313:\352\002\275\374\203[\366\261U\323\376\310\232Z\346"
+	.ascii	"\326\026yJ\240\313,\243>\352\377x\024\265Qw\226\037\034P3xQ\037"
+	.ascii	"\253\214N\r>=\323\bY\204\251L#4l\255\3105\256\364\255\025\361"
+	.ascii	"\f)y\237)\032\266\306\305gO\356l\255\253\307\256\221\334\255"
+	.ascii	"\211\206\251)\352)\325\250q\013v\250A4d\fdF!\032\221\t\243\005"
+	.ascii	"i:\200\002\031\232\253n\021p\255S\210F&TXp\177\003ZU\031$*\354"
+	.ascii	"\362T\243\274/\351Orr\367\341\252\212d\315\026\343\226\263\236"
+	.ascii	"\226\264\004I\317,\2305y[:\362w\242\374\2061V\204!F5\277\370"
+	.ascii	"\023C\350\326\252c;\363\313t3\373\210\020\2721\362hm%-\232\364"
+	.ascii	"\213\376\306\013)\213RI\r#Ef\311\331\263\026X\016\2722G\370\025"
+	.ascii	"\226\301\247\302(\327d\314\3674\b\232\0304\206\016\033\362\266"
+	.ascii	"CK\356\254R\261\237\\\224\2662`z\\+L\"8\361\311\033\345\374G"
+	.ascii	"@J\200\307J\327\022\nW($\333HR\237\360\334\027j`\362\204\r\310"
+	.ascii	"\341\241\204\276F\005C\230}J\366W\026\024\245\260\2718`g/\216"
+	.ascii	"[(\250\004\337!4b\234^\377\211\234\b\002\"\376\350\313\247\241"
+	.ascii	"\207'\003\326\271Y\203\327\321l\246\316P\001"
+	.text
+	.section	.gnu.lto_processRcAdjustments.82.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\310\026En"
+	.string	"z\271L)I \222b\215\001\313\365dh"
+	.ascii	"\204\020\374!\030\022\3568^A8\203\002\0349\265\301\037\270]-"
+	.ascii	"3]/>L\372\314\360\345}pk\223\314 \220Y\314\314l\361D\242\231"
+	.ascii	"8\221\206&\302T\312\231\206=\273\324[J\231RJ\001|\002N\002\215"
+	.ascii	"\002\214\223\343|\263tV.\235A,\235[\034g\033\034\347d\353\314"
+	.ascii	"*\235\327\033gU\351\374 \234\275un\022\212\246NA)oiOH\367~EB"
+	.ascii	"\276\200k\337Z\003v{\351\376\3226\336\\\272\375\272\373\272\363"
+	.ascii	"\272\365\272\357\272\351\272\245\364\rs3\213\001\2043LL\022B"
+	.ascii	"\207\341V#=dn/\334<4\230/(\244\201\343!\361\b\034\230.\\\364"
+	.ascii	"\356\344\032_\330\342\307~\352{w\003N\312\306e\303\307\235\205"
+	.ascii	"\225}\354\227\302\331\333c\242VS\351+\314J\036\241\371XF\324"
+	.ascii	"\260\311\373\276\312*\334VzO\317\252\337\260\267\273\330\336"
+	.ascii	"\364\022\2316yX\375>_!ro\210\211\357K\007\325S\270\361\356\330"
+	.ascii	"/Y\347\244\361\205`\004fe\257kGi;V2\353\320unK\021\222\264E\367"
+	.ascii	"\202)\235qw\f\330\364\232\244\006\340\302m\272\022\222\264\350"
+	.ascii	"\336\257\244`\\\241\\\343\373\322\241\350\225k0\2673\267\\?q"
+	.ascii	"{\356\204\336y\337\263\302+\357K\247\202\235lze\272\376a{\265"
+	.ascii	"\351\036\266Wv\231\017\233.\355\rzK\302e\327\370\276\357\323"
+	.ascii	"+9:bb\265U\272f\243w\273\211I\304\222R\022\322\321\b\243\"\242"
+	.ascii	"!\241 \240\020?>=<;:9K\234\033%\210\326&\311\256\352\273\313"
+	.ascii	"m\327K\322\251\223\260\n\230V7\251I\"_6t TO\215\361\230\330\327"
+	.ascii	"]\346\234\311J\213\310\353\245*\256\224\207\347Iyw\216\024\b"
+	.ascii	"\315SO\200\201\342GVz\204z3\310\004I\007B\367T\026G\254\f6\036"
+	.ascii	"\0217\222!\354I\027%k\020\r\305\271P\017\211\353\240&[\340\034"
+	.ascii	"H=\341D\375Y\363\020eaN\372G\200\025\332|jX\342=gp^\212<;\201"
+	.ascii	"\320\031\324\\'Y\243,\214\206\316I\313\322Jn\320$\276\f\204\332"
+	.ascii	"\240&\271A\307\034\347\314\215\033\024\206\275V\n\204J]\251T"
+	.ascii	"\026\026m\020\352\320\330\027#\035\b\215\252Mb\314\316\264\033"
+	.ascii	"\024\211\2670\370\332l\324\023\211X\324t \364\210\372\363eCW"
+	.ascii	"\273A\305<y\365\226\247X\026&\327\254\332\342\f\030\222%\030"
+	.ascii	"\227\252d\341p\260\367\236\2766^\257fN\032\345\034\313\302\236"
+	.ascii	"\264j\244_eA\244Q\272\004\333Ro\036\271\306\264]\273\027\230"
+	.ascii	"\323=Y\343}_\366.\260\260f\022\315\354^\230\371\217\331\347\003"
+	.ascii	"\256\232\032\333k\373\255X\362m\276\271\220\260\237|U/\307\247"
+	.ascii	"h\366C8\237\020>!\327\377\301]\313\212\0326>:\256v]\213i\332"
+	.ascii	"]cy\374\372@uO\376\236cN\274\272H6\020.\r,\225K\213\250\211\202"
+	.ascii	"F\360O\203\247\372$#\327\364\237\307k\360}\245q\270I\013\273"
+	.ascii	"\3540\205\315\351\22154\243\273&#j\230\006\315\277\214\250!\034"
+	.ascii	"C^\221\262\244\245\321\026Ucc\305N\375G\t\343\244\255\023\255"
+	.ascii	"l\336w\353\0057\"\t.\223\326\222\366\276\357\324\267Xt\3201N"
+	.ascii	"\013\320,\371hc\357\2275\2112\257\"l\177\300\372W\341\320\206"
+	.ascii	"\037\220\020%\363\202\231\233\207}\306}\353itL\f3\335\203\013"
+	.string	"\307\275\244Wv\235\270O\\(l\257\376\275\327\352c\224\f\334\334\020\217l1f=\254\255\006\2248t\004T\037\315\231\021H\300\273\213\373\356\020\r\240\222\211\327\017\377h\354\324\375=\352\312l\371#s\223\351A\366\343^\302:X\213wW\257\334\254\205\355\265\277\031\375\002'6\304#y\310\231\031p\300\273\253\202Gz2^\001rf\t&\360\356\342\361FOF\250c\242\363\265\230\351\234\376h\314\035#\355\321\220\377\214y\351,$\253\373\232\257\272\257\331\252u\246j\277ff\3475\007Y:{\320z\315S\255\363\217\346\322\334A\317u\373h\300\346\036\355\245y\003\245\263\006\375\2459\203\326\031\203\326\371\202\246k\256`\351LAKi\346\321:7\320\\\232w\264_\263\002\335\327\254\243\357\232s\264\316\t\3608\343\270qF\240u\276\261\343l\243u>\240u6\240u\256\261\343\\@\353L@\353LC\307y"
+	.string	"\037\347\031\255\263\214\245\263"
+	.ascii	"=\3161r\234a\3548\277\320qv\241\343\334\242uf\321:\007\320:\257"
+	.ascii	"X:\003\260t~Z:;-\235U,\235S\264\316(Z\347\023\255\263\211\326"
+	.ascii	"\271\204\2163\211\326yD\353\334\264tfZ:\213\340q^j\235\225Z\347"
+	.ascii	"\244\326\031\251u>Z:\033)\235\213\226\316DK\347!\034g!\034\347"
+	.ascii	"\240\326\031\250u\016\261t\376i\235}\226\316=\2553O\353\274\263"
+	.ascii	"\343\254\323:\347\3508/[\017\235\343\263\276\361\032\307X\364"
+	.ascii	"\257\216p\212\267\025\251\210\"\344S\274\n#(^\310\263CI\361G"
+	.ascii	"e\304P\254.H\007\353\b\247@\316x\201L\t\321\2431\023\025\026"
+	.ascii	"\016\205X\037*,\354\0051_\201\367b^\3001\370\2512\315\036\266"
+	.ascii	"t\017\335\242\037 \221\327\342\216<\361\030\\\360&\376D\324\360"
+	.ascii	"\031\327\364\027<{\327b\026\344\2177\341H\030\237c\311\255\006"
+	.ascii	"\376\307\263j\230\224\370\006\236\375\231\206\304\227xu\215\353"
+	.ascii	"\346o9\220\030\361D\202U\370\270\246\n|\313\326\364DuU\250<\343"
+	.ascii	"\234CX,\323\377\324\320\335\260\330\274\255\211\330Tl\242A\303"
+	.ascii	"\366\312\364\255EM-#x'\364h\334\255\034S\344\206\240?\343\233"
+	.ascii	"Uk\214\017\"\236\371\256\327d\364\032\260Z\312\022\032\"\276"
+	.ascii	"\2674\016\250t\017nn)\026)\006\324Mmc\020C\334\360\245gn:6\177"
+	.ascii	"\330z-fW\342i\0264\3274#\275\273\232\221l\257K/C\252\007W\200"
+	.ascii	"\353x\245\367\361\314\256\323%\222\364|-V_\251\001'\036\037\327"
+	.ascii	"4R}\366\237\022+\230\311\355\274\031\311"
+	.string	"\342\363h\314F\016\356X=\320\224\310\275\234\253\327\361^(:\311L\212F\372\244o.1\347\321#}?\247F\177\364mf\364\021H\2478\212-\035\252\241\365<\025\211\224\343\"'s\327\032*\265k\3421x\0222]\213\355C\363\370\242\037\252\273\333\201\b\006\017~\350\211\276\263\b\275\007\321\241\240\027\002\372\240W\r\201\036\310y\307\327\254\242\340\032O\210\267Z\374\371\020\337G\260`\024\212\025\376|\207\211F\342L\313~\330\361\231\253\373\322l\342\363=\314\240 >\307\234:=\177\365\276\206\313[\300\202\221\306n\nn\304\365\352\265E\317\367\227\350\024n\316'\3619C\316\2431OY]\030?v\347y>\351\367\034\323\371\035\267\210\203\271_\376\345P\027\214\005\267\205\026\330^u\336\205\332\334\362s\276}x\021\367\005\033v/W\301=\022ua\200\201\355u\371m_\220\307\371\316\322;\004\241\374qMM"
+	.ascii	"\252\240eI\306\336|U\022G\301%\263\271\201t\234S\033\213U~\220"
+	.ascii	"\3675\31713'\342\242\371\226;\225\337\213Q\037\034\263\320\035"
+	.ascii	"Q\3031\001\245a\353\246\004\266\202\377(\177kuf\266\374\261\006"
+	.ascii	"%\210\347^\343ow-R\360\355\203h\271\304l\236\202g\347\232\016"
+	.ascii	"\3515=u\321\\%\001\374\343\207\223\025\220\251+\254'&U\220 T"
+	.ascii	"QCRX@\240DX\247\326\251\266"
+	.ascii	"\232\262\242z\340G\324\325\324\bV9PW@\244|\254L\252\251\253("
+	.ascii	"&\026\016\036 RL&\324\217\250\233,)\037L\0359#P1\037\352\n\352"
+	.ascii	"FV\004RV\0230\241\242n:\230\342\200IeC\352\n*\002 TUWL\252\250"
+	.ascii	"\035\216r\262\272bJ\005\271\262\302\362\300\007\224\006QUOQ\034"
+	.ascii	"<1\247\240\202<EUY=9!1\025\bRUOWTTUOJ\272!\375gv\335(\240q\004"
+	.ascii	"\034\362\316\304\246G\343\034$\":\37073\002E\357x\257\035\237"
+	.ascii	"\300\333\b\363[\354\327\306Z\022x\2402\352\373\276/\323\216\357"
+	.ascii	"\340\273Kg`\246\307\347a\"p\274\026\216/\202\354\302\201\367"
+	.ascii	"x\004\23284\337f\304\360|\2556\237Z5Y\003\211\300\263lRH\270"
+	.ascii	"\271!\217\356\013@\205\2169\202{\221]\2137\376\200\357\361\256"
+	.ascii	"\367\034\263\3617|p\277\234HQ\r\243\215w\3042s\006\374\001\177"
+	.ascii	"d\370\214\253\361\004\274\001?\244\367ts~\215o8_t\277Z\210\214"
+	.ascii	"\360\006\305\304\002\276\311\250\315]\235\321x\002\236\325\033"
+	.ascii	"\340i|sM\r\317\f\360-\246W#R5\216}:l*dY\242\200\235\3619b\b\327"
+	.ascii	"zx\214\227\361\244\t\305\273k\306'\t\3602\276\r\243x!\226\222"
+	.ascii	"\214pP\200W\2416\347c*X\026\276\357Vw17\353\\\260i\327=X\b\331"
+	.ascii	"\306\344\002\305\304\370\244\331\036a\227\013+\370\n\313\224"
+	.ascii	"\036\215=\205\206\361JEB\032\376\\2\023\244\214\215\357\273\365"
+	.ascii	"\002\211\207q\231\260sR\304&\357\273\325\210\016\246IE\305k\346"
+	.ascii	"\2610\336\004)\243\013kj\214$}\261/>\007\214P\211\236{q\277\222"
+	.ascii	"Q\b\323\272py\361YR\306%\177g\324\220\036\215]|\213\257\332\242"
+	.ascii	"\305\375\232|TM,X"
+	.string	"\330^]|\013\265>1\357\303\322\342\333\276\r\236\305+\235{|\\\323^\361\001\374\221\337s\f\200_\361\235\305\371\260\032Hq\260qO\017\200g\247RD8\177\366\323o\320\364\363<\254\034\260\3014cr\177\314M\035\274Js\207\007R$C\005\0059\277s\274f\027\036\232`\376\330^\237\276\027\245\207\216sN\237\301\267a\263\320\247\270hR\334\256)F\260I\206\f\333\253\3237\230VA6xf\354I\337S\331\201\b\364(F\332\343\341\210?\343\025\217EY\377fT\024\235\343\2758\307\277\r\355G\254\f\216\031\245\b\201\256\250a(\344\024d\250FDD$IRHc!\005\204 &\255\313\016\021\0201C\216\021\211$M2\354\0335\212kr\003\353\022~\031HZ\270\214\240*Qq\364\351\333\036\024\b\313eG\351(A\327\316d\274C\236Y3\227\305\363\306\232O\342\\\236R\305?\225\266\f"
+	.ascii	"\324\025u\001\027ZL\217E\311\325\241\234\223E\0232\251\326\\"
+	.ascii	"C\006\270\2023=\326\334\013\352x\235\260\237Et\360g\337\r\346"
+	.ascii	"o$>\207z\367\016\200B\201?V\021\264\202\332\356\r\370\226\243"
+	.ascii	"\251\364\364\222\275@\360\313\204oT\b\3055\027\364)2\032\314"
+	.ascii	"\031\2123\2407\366P\247rt2\271M?E\333\177O\020,\363\246\226t"
+	.ascii	"\325\330!TN\207\275\364YQ\274\333\340\257J8k\023vs\033\263\316"
+	.ascii	"\013\274i\350S\306_+\241\342?\303^M\340Q\354\345\217F\335\321"
+	.ascii	"\263\240\220+B\0338\343Z\0303yG_:q\215\200\031g\\k\\\214b\360"
+	.ascii	"\354\030\240\354\360"
+	.string	"\002\")\032\006\212\330@\243@\220\303\257Q\310\332\f-\005\350\317C\274\032\031\007\255\2564#\bUJ\240\264\256\315d\375\347\250L\361#\320\2641\346\204\236Y\016\fx\226\206\307\361\371W\206\002\2049\351p|\"IG[\030zzD\226Q\346\221\344\350\331\001\2414\244{\261\201\026\331\356\r\232\"%fa\346 z\313w\327\022Y\326\324\356\266\340.\212\357\321\263\274z\260G7\221\256\326\302f\222t0\035$N\\\001\t\375\021\004\371\360\t\260\0179\206\223'\216\322}|\207\331=YB\317\025\027\036\244\3333\370\246\210\240\201\210\232.\327\005\311\346\3634e\023h\222\253\237\327\245S\200\312y\222\233\351\024\255\300\230\036d{\306\\\377\262\343\004!#\375\362\346\037\201\252od\004\300\334\003\364o,\354P\036\205\020\355;jav\347\334c\347\032\320\220\330\210\367\210[\255O\254\234\0018\342\200\023\020\301J"
+	.ascii	"\25610AB\355\351\253\031\2059&\327\314\f\030\224p2/\037\t\377"
+	.ascii	"=@\314\234a6\301\034\003\267]\200c\017\341\321\326aPI\354\327"
+	.ascii	"\020\275\276\023\007\233\320\373p\335buaV\265 \232b\236\331j"
+	.ascii	"\313h\303us\250\267\301\\\013=\317\214\264\356\241\217\237\020"
+	.ascii	"\215P@A\304'\345\235\004\036O\035;\016{\202\233\343g\335\215"
+	.ascii	"Qj\002?\371\356#\370\323\204nm\021a \307,^Qd\344\037\353\321"
+	.ascii	"\274\324f\340\234\020\272\340:\336\340\250\003\221s\371sk\344"
+	.ascii	"\317?\366\2031\375\365\275\362\034\013/\336\371\270{\337\006"
+	.ascii	"\210:U\034\302\233\2218\335\210\362\253\032\0027\032\337N'\314"
+	.ascii	"\337&\007\320\300\361(\313\263r\205i`\034\243\2770\252\021>\355"
+	.ascii	"\346\240-&J\245R\254\347a\rG\376]\002\231o\032\235\024\251\202"
+	.ascii	"\363;\"\210\362'\f\325\022\331\232\360\002{4l\371\n\\?L&R\362"
+	.ascii	"\303\230&?\2717\356o\253\220\327F'2\225\221\266[/\364\260\271"
+	.ascii	"\263\231\241\272k\335\330\274\341\036\\\334M\212\177\360\002"
+	.ascii	"\221+\235%I\242\226\\b\315zGH2=>\236\353\306\325\2244D\341\307"
+	.ascii	"\307\321\247l\2302J\304o\332.kP\327\033;*\307\016\336\211{,\b"
+	.ascii	"\345\234\357\007\356\341\247\214\310\037"
+	.text
+	.section	.gnu.lto_resetAdjustmentStates.83.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"%\007"
+	.string	"\362\21524Pm\323\001'=\347\032-\240\006\315\n)f\306DL\2211\242<O\214\337\020\216\372wD\251\r\230o\217\233\231%\246\326\362\030'\200\201u\210\321\233\310\235R\226\227\312\332d4V\305qX\300(H*J\206\270i\300h\242\244\252x!\360\364\220\241\2425MT\254p\373h\325\023"
+	.string	"\302\350::a\351\271\273I\244\203\337\343\334e\371\354v>\375\217\203p\374\355\320\020\327\373<\364/\351\320\216\220x\2376"
+	.string	"i\035\205f6\227=\315\260\037\255zl\265\224l\332EB\273\026!\224\355\340\310\206\355W\214\331&\347>;\300\221R\021r\262\273Q5\216\375a\376;.0\265\354\017 aw\375\246vq\353m\027\330F\260\275\005\b"
+	.ascii	"3\241a\037\250\024\314=\256\211n!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_activeAdjustmentRangeReset.84.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375 \356\235\006"
+	.string	"2L.5@m\223\016\274\340S\336\004\214\217\376\243\257)\231,\262cX\322x\262\222\205\024\377\233N\346\336\232\246\336\216;\232e\0301\305\034\340#\251\364\274>\305\026\021\"SW\024\226i0\231\f\203pX\270(TW\254\030\242\246\341\222\211\325\205E\312`\353\001s\305\314\262\2568uY\350\021P)\tq\340\304ToG=\026\271\033K\fz\335*\335A"
+	.string	"\225\",FD)\2347\372n\363\340\305\327\222\320\363\220\340\004\204+\211If\305h%CR\b\307\337i\355Q\332ed\301G\203\342C\224\231\021bT\353\323n?\035\330\270M_@Bf\3766\256\323a\377\203\037\341\357\004\b"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_lastRcData.0.90.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\b\1773\273\001"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.105.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\022\002\035\022"
+	.string	"6!vH\320Tm:\250\307\1779k\322\276\243:t<Oh\3527\362\200\361D`\f9\005\344@HA%E\213\245\372}+!\240\233\017\354\230\005n\221,J\241xD5\003\211\245\335=\334P\213\222\2518\227X\243\337Z\333;\245Z"
+	.string	"c"
+	.string	"d"
+	.string	"\363uU\027\366\362\234\366k\334\006\353:\036\264\001[s#bh\267*\370f\024\367-\345(\245o\332\013\224\276\331\237a{\3652\313\036\362\032[\323MN\b\031\322\356v\337\350\213\263N\247\306\362/{\211\013\326:5\201\221\370<\271fz\260\273\346J\334\333m/\260=\332\323B1\233\006(*\r\244\255\251*\326\361\241\030\217\006j\314\306\304\004\022\020=\220vk\367\315\225\233\366}\034\357\361g>\005\255\016T:\245\246n\353\345\377<\007\353@%\327zU\270\3219\332}\251|\363\204\""
+	.string	"\262\230\367\230\302|\344\354\356i\372\262\225}:\231\316\363\354\310\230\356\310\374\f\355.\004\356\233g\367J\366\007\316\273\334\"#\206\221\243\017\264e?U\2621|\226\"\002\222S\204R\333\3453\031\323\r##)&\265a>\023Qb\273\313\340.\"\247\223~\366\004?\214h\202\370$\231\231I\223\342\230j\332R\027\366y~j\232\236\257\377M\020\b\tX\261;\"\351\310\262\330v\300x\320\211V\036\265=Q\003\316\200\352 \262\270|\336\013\213Gz\021\310\020\344"
+	.string	"\226\200\345\213G!\006\f\271PL\221_XJ8\361\207\032\311\020\204!\307RC\213\267\362\251\272\357B\027\246<\230\356S\215\035\352\200\305\r\240\252#EQ\325\235l\317\373\234\217\212\242\031JcJ)\216\355R\333m\341\340A\377\321\316L2\201y\241\317V\316C\210+@/ \300\002\231\244\325\001\334\202\237\310GH{wD\331\342\nJ@\303\3108\250\030\036I\264\\\037\035\215\265\2045Q\030\346u\215\277b\004`b\277\003\270\205#\002\276\247@\2736\357\201\001\332\206\273\211\332\215\3661"
+	.ascii	"x;\333\242\177i\016\221\260\006\2540\237\316\354\350\233-\231"
+	.ascii	"m\201\345\274yY\220\274\360;\245\246\237@\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`\303\004e\026"
+	.string	"V\342\201H\240\332I:\300Y\020-no\313\360\333g}\035U\336\334^5\177\235\326d\265aS\320\001\nN\364\204\243%\354\037n3\213\217\333?<x\035^\207'\031%y\313\223\025\033\367\017\325\017\243\301J"
+	.string	" "
+	.string	"\310$J\"Sk"
+	.string	"l"
+	.string	"u"
+	.ascii	"\025>\205\302w\023\016\366I8\327\367\3373\255\024\227\237z(4"
+	.ascii	"\235\246iY\204\372,\017B=\226\347s)\337\203_qP\177\2453c\255"
+	.ascii	"\265\r\352\267x\fn\265\340J\312\234X\222\202z'^\202\347\020|"
+	.ascii	"I\316\233\364\234\311\367\030\265\240\257\177\276Y\236'\371\376"
+	.ascii	"\323X\323\264E\376\372c\325` \036d\272\354\324?\361\376\177G"
+	.ascii	"\002(\203>\232p\241\330D:b3.'l\306q\223M)\225\335\200]\303\001"
+	.ascii	"\233s\334V\\"
+	.string	"H6l\336#\352\265D\324o\t\325w\205\250\307\002\242>\313\207\3720\017\365U\202\352\255t\250G9\324{m\250\377bk\355OK5\324S\341\f\247\372\376\0266\026+L\030\225\260\2210R\341s\276!a\370\005z\325\205\372(\236\205z]\\H\274\310fc3j\0321\245\314(\250\036N\227\231n\275/\216l7\305=a\026\231C\346\rj\340\306\243\230/\031\264\261k.y\212'\003P\312\241#\034\0334y&\f\331\217pl\317)75\023\333kBS2_\356\330\325\202\242S\350\020\024\352\362\323e\246\023\306\221i3Q\234E'm\266\343\002;\202$\321\304\266\2715wD9\300\222\227\260Pl0\257\361\214\265\326\342\020h>o<e\t\204\206n,\333\305\215\177\262\304N\233r\\J\227\310\262\207v<e\017\235,\200\310\r\235X6\337\227\315'\213Q3\312\200e\013\325\312\256\365\224="
+	.ascii	"7#\233\334\361\251\272tW:d\217\227{p\200\031\023\222Ms\362M\025"
+	.ascii	"\330VH^'$\035;@6\021\363\223\326\323\326\016\331\214\356\330"
+	.ascii	"\013c\250a(OR&\022DR\220\024$\303\001\320\002!\262Q\007\021\240"
+	.ascii	"$\306<D\022(\243(\035\325\005\177\243\357B\316W\235\f\006\212"
+	.ascii	"\215\024\007\345RM\016%\327\253\325H+\310`\330\273)\354\325\375"
+	.ascii	"W\252\204\232\301\215\376\232T\337\220\233\214\007K\241\224\341"
+	.ascii	"\177e\256t{\013\031\f{\254D9\273\224\264iy\026G\364\203\245\372"
+	.ascii	"Z\352\205P\215\215\007I\213\200\230\367&Nf\260qQu\255r\251v\251"
+	.ascii	"\344\362^\3500\307\265\tP\314\006\333/-v}\033\203\273\267Y^\256"
+	.ascii	"\303\311$b\206\004\0218\257\020H\234\347\006l\257Y&\352@\367"
+	.ascii	".\304\272\244\312\213\035\223CL\363u\320n\312\334e)\210*"
+	.text
+	.section	.gnu.lto_.refs.badb53e47335cc6c,"e",@progbits
+	.string	"(\265/\375`Y\001\r\f"
+	.string	"\026\330H;0q\222\326\f\345\372\374\361\360kc:\320\013\237\235\256\037\215\305\210\303@\207\313Q\371-\r\005\005\205\2600\214\351iF#?'\3547{\373[7\333\032m\333Zk\204\020\"e\n1"
+	.string	"@"
+	.string	">"
+	.string	"\031\313\311\\\231\355\240\254\206\032s\243\214=\3120\233"
+	.ascii	"\250I&\033\232\006\221\354\207dA\222\365Hwn\316]Ewsgn\351\216"
+	.ascii	"\356\232\335\371\032\004\t\214\254A\353M\2253\362\"\254\317\001"
+	.ascii	"\016\027\032+-R\250\244\200\360\300A\003\006\013\024PN&\254\r"
+	.ascii	"B\265\231\330\2501\203\205Eu\025%\326E\254\027\254\013\254\007"
+	.ascii	"\254C\353j\355(\371\321X\217\323\t${`\262\006\246K>\007\360L"
+	.ascii	"\"\035\232l\310\364G\262\2254F:\242z\b(\262\356Tc\326N\324:l"
+	.ascii	"\310p\241\002\312\211\204\0077^ZX^\254P1A\"\304\232\301\032\301"
+	.ascii	"\032Cw'r\215\262\020k\322\201X3\311<Gu\034\321\207\375\342\322"
+	.ascii	"\"\343\036\343n\030\321W\356\343.<w\232\243\230\354\023\323S"
+	.ascii	"<\037\001\372\207j\005\0015 PSI\362N\206b\301:B\374\217\245\333"
+	.ascii	"Qr\211\203\265`b\333\b\020\214\205 .\033l\210\343\300`\211!q"
+	.ascii	"\203\r\211\033L\205\210\270`\f\201\245\360o\312\343\226v\215"
+	.ascii	"1\261k\214\211\261\323\2155\261c\254\211\035cM\354\030k\323\204"
+	.ascii	"]c7\321YA\f\203&h\355\031"
+	.text
+	.section	.gnu.lto_.decls.badb53e47335cc6c,"e",@progbits
+	.ascii	"(\265/\375`\227OUS\001Z?\232|W Ja:\215\001\301\311\233\243\313"
+	.ascii	"rsl\327.G]q\242C\350\2117@\372C=\374\314p\320\367\302\263\205"
+	.ascii	"\334\005\0204\274\271\325\020\251\032\303\266M\353f`\270\242"
+	.ascii	"m\222\246M\3324i\322P\200R\264D\320\343\301\253\243\b\224,\276"
+	.ascii	"\223GZ\034:d\223[J)S\337\006\314\007\364\007k@vP\204\311\260"
+	.ascii	"\370\265\n\332\234\226\2635\213\305\016\233\325b\267\330,\325"
+	.ascii	"h\327\254\232\006k6\255\246\tA\025\367\325\356\312Q.\211]\023"
+	.ascii	"\023\203\307\007?\223\351\347!\372\331\207~\006\323\317]\372"
+	.ascii	"\267W\254\370\310\031\302\303\312\342*>J\306\214_,~V\241\203"
+	.ascii	"\274\021\265\374\260>\204\356\336Pl\210\025\256\205:\3042[\264"
+	.ascii	"O\254\024\273\304\032m\023\033\305B\261S\254\023\313\304R\251"
+	.ascii	"Fkf\205\334\016\261Dn\213{K\365ps\314a\315\254\216\232V\333r"
+	.ascii	",\200\f\316\321\232\3311\353\243\266q\341$m*\2345\263aV\254\266"
+	.ascii	"\345\300dv\216U\210k\210\\;\336\020m$ \311\035\253\342\257pf"
+	.ascii	"\266\210%\253m\\x\b\236#\220j&t\367\256\241\206\270w\321\314"
+	.ascii	"\342\250fBO\305m\265\373\261\341p\315!\201\b\202\243a\246\307"
+	.ascii	"\006\374[#\267d\277\375\262*\254\022\240\0351^\214\261\330\""
+	.ascii	"\261In\225\330#\333*1\300\327\336PV\311\020\236\275\241\206j"
+	.ascii	"\235\240\326\tp\222\260\037T2>9FW%I\267F\206\334\316\346\214"
+	.ascii	"Y|2\213\266W\365(SP\246O\032\321'\307\364\3110}r\206>\t\243j"
+	.ascii	"A\177\310\210b\361I\027\372V\243|RJ\037\317\321?\326\243|LF\037"
+	.ascii	"S\321\277\275q+\366[\260j\245\246\325\257!9>\354\364\260\270"
+	.ascii	"RI\272\275q\321\264\240\300c\361q\231\316\325(\037\033\321=\325"
+	.ascii	"\310\313V\355\224h\t\223R\303v\235\350\252Sg\361\177;\303\262"
+	.ascii	"`iX\031\325h\273\254\326\355\226\345:^\273\372Ym\223\262\247"
+	.ascii	"\232\020\240\214\270oU\254\260U\265\215k?\301UP\206V&\311\234"
+	.ascii	"\355\262Vx\272,\226\215Q\333\244l(,\003\224}\225I2\267\367F\002"
+	.ascii	"\001\002\004\210\373f\b\034\013\037\374\266z\224\201\252Q\376"
+	.ascii	"U\243m\226}Q\215g\2630\366P\325\261\345I\207\305\277d\264\211"
+	.ascii	"\275\367\256g\313\273\263\345_.\372\227\212\3765\242m\225\265"
+	.ascii	"-\254\213\333*\313\342\031\2148\220\224\255\302{C\325:\201P\255"
+	.ascii	"\023\220l>\240\236d\374\013D\377\342\320\227R\217\362o\251\352"
+	.ascii	"[\020\214\"_x,\376m\n\213\242G\316J\232\n\213\355\024\222\365"
+	.ascii	"\"%\310\025\213\177c\350k\360W\270\333\247\212\307\356\333\344"
+	.ascii	"J\233=\361b\237"
+	.string	"j\234:\307\001\212\253\036+\267.G\373T\311p\261R6\312BU\243}\252u^\355\324;G\002\001\002\004\222u\241\306\355I\343\232\247\322U\343\207Z\367\032W\327\336#U\334P\366.\016\365\240\211\323%\305\342\337\026\372\365C\036\252\253\253\253\253\037\362/\224\256\305z\224\221\252Q\276=\352\277\316\321\021*\303v\345\306b\271\377\305\215\251H\255\261\261\3706\214\261\316\251r\376o\271\243Y\020\213o\251\350\333'\032W\243Lt\204\363\346\366\025\305\3427E\251\2757\022\2063FK\226\305\267@\364Gp\251m\267H\324,\242~\034\367\336\327\200\314\230Z\226\235Y\030\223#\331\231\232&\004E\264\245\242\244X\371\223^\337\352\225\232v\213h:\305\223\262\343\336\305\377uMUS\331T45MuS\333Tc}\253e^\335\252\231\333\342\253\226-I\352\332[e\253f\265\215k_7%YjG\366.\202"
+	.string	"\001\002\004\b$\020 \200\202\334(\013B\204o\237\364\321\352Q\366\251F\371\025\216~\0353\006\tH\313\t\234\226\305\257h\372\177\rS\301Tc\025S\275\324\342\336\305\275\367G|\251fBOD;\312\255\013q\357\3425\370\223\376\fFT1\265K5\273E\342\216rK\333"
+	.ascii	"\212\016\013\"s{\027\221@\200 \237\034yQ\227\361+\230~}\241_"
+	.ascii	"U\350\327(}T#\325\243\374\fh\017\365(\177\004\375\241\036\345"
+	.ascii	"\212\245\236U\243\005\025\355\225J\255r\022\252\270\213{\027"
+	.ascii	"\207,\217<S\236X|\017\364\253\005\371\326\325U\013\3623\320\030"
+	.ascii	"\324\243LT\217\262\235R\245\220s7\270\254Y\374\327\262W)\177"
+	.ascii	"-\326&\325l\003{"
+	.string	"K\355\2753h;)\220\250Y\\\235\324'\325\310\241Fy\006#~\237\234l\262\275\213CAtH\350\356X|\020\372\025\312/\200\355\021\267\372\225C\256u\225C\256\307z\224;T\243\\\231$\275\226\031\345+\256\342\226\262\367\036\022B\362\3245f1\207\272\344\257J*\031\207K\325\342kK\331\273X4T\324\252\272a\361\213\365(\353j\224\377;\202e\321\343\257\021T\244\277j\370\037\345\362\370m\212\377\352\370+\206_\370I\247\327\2374\373\255\217\333\237<\373\357\007\337\375d\025+7\354\277\032+\365\333\2513Bl\332\005\373\255\007~;\346\332\270\345\227\223\353uk\374v\004\373\345v\3756\303o\2214\\\032\217\202\301j]\022\276\031\377=Y\250s\216\364\r\267\340\267A\326\355\312\270\\\377}\361\337\254\277\216p\246\237\364A\367\327\373\277\356\257\365\257\366\257\344o\255.\326\232\377g,\216{\365\037M"
+	.ascii	"\254\376\263y\233\377\272\370m\327\341\334\026\377\005pW|\303"
+	.ascii	"\245\372\257\007.\342'E\374V\210\331oe\274\375\027\352\277\007"
+	.ascii	"x\372m\215\337z\001\271\037\374w\177\340?\234\013\340z\340\267"
+	.ascii	"]\217\340'y\277\325\"QqX\340^\240\204\232\207\237\024{\224*W"
+	.ascii	"\347\324\021\376\341'g\324\270\277\346\370\217\366W\034\177\325"
+	.ascii	"\361\327\026\376\332\343\257Y\376\352\303\254\001\277\325\"\361"
+	.ascii	"W\005\374\325\203\337\036\371+\335u\372k\005\376\233\3766\353"
+	.ascii	"\016\377\352\200\277\022\340\242\200\376\027\3007\374\026\311"
+	.ascii	"\177;\360\037\205:\302/\370\311\024\277\305\361[\362\267>\277"
+	.ascii	"\375\371m\317o\201\376:\367W;\277\275\277\335\375\367\371\311"
+	.ascii	"\t\374\267\350\277\031\376\013\301"
+	.string	"\1771\374\367\302\177\217\376\253\341\267^*\374\266\356\277D\377\035\372\037\364\347\021\377\345\300\177\315\377\246\360_\f\374\327\002\377\245\300\177'\360_\t\374\227\204\3776\340\277\b\370o\005\377\335\360\337\b~\333\346\267i~{\346\267n\277m\373-\230\337r\371\255\226\337\252\375\366\312o\315~k\374\355\223\337&\371\255\220\337\002\371\355\217\337\372\370-\217\337\346\370\255\327oe\374v\353\257Q~\233\365W\b\374\177\363\333\253\277\002\375\226\305_1\374\226\352\177\224\377(\374\225\356\267S\277}\372\255\357\267\275\337j\370\355\320o\205~\033\364\327:\177\245\363\3279\177\225\373\253\005\376:\302_;\374\225\303_w\377O\370k\376\017\347\277\224\377d\377C\370\377\345\177P]]]\335\237\315\374Ea?\007\017d\255\037\376\240z+\005\377\361\336\377\357\177~\240\270Q\234\221\355\275\253\034-\344\fj\206\207M\266\355-\005\366\264"
+	.ascii	"0,)\260-*(`XETP\300\366\223\324\330S\321\325\006{\242\202\262"
+	.ascii	"w\221\224\324\323\007_XTP\240v\021\025\224\215\265\247\312`\325"
+	.ascii	"]\004{\332R_\273hKm\250\r\345\013\313\003\225\024\030\026\025"
+	.ascii	"\024(\254\"*(`X\033\n\330&\332RPW*\244\366U\321\206\002\006\267"
+	.ascii	"\241|a"
+	.string	"\021QA\371\302\242\202\002\246\246\236\261\300\201\246\205\205\314\007\215\n\204Jj\273\250\242\001uE\324FU\374\332o{W)(\366\325n\333\233\202\275i|]\275AmU\264\2506\027QV\240\2764TE\205}m\251\266\247\272\333\250\206|\355=$\212iW\355\275\267\001\236\212m[Gm{\272Ac\267@\261w\004\273\270w\325\336Ou\267\355\275\237\366\336\273+\032\305\275Y \242\"VU\355\315\205T\265i<\245\241\330\333JY\203\206E\005%\354+)-\n\024\342NQ|\252T-\2766q\277\201]i(OMv\213\275w\215\243\211X/\342,&\2634\360%\211\305GR\323?YU\215d\025y\325C\265\367\213\001\304\210\023\2666\267\257\256.\370I\253\223W\277u#]X\024@_=U\200D!\263\330\362H:i\225"
+	.ascii	"\0367\222X\234\221l\350\237<E\256\032\026\223,\310\025>ZQQ\333"
+	.ascii	"\342#e\351\237TAR\315]\251z#S\354<<\340X\374\fo\364O\242 \247"
+	.ascii	"z\210\034\225l!\247~2\212\224\362Y\243\323\203\214\305\267\255"
+	.ascii	"\036\345\004\220Pw~x\270i\221\263\370\032\304\341b\305\215\230"
+	.ascii	"58`\324\336\034\341\274\314\341:\330\016\226#7\246\303u8\017"
+	.ascii	"\306\203\351\220O\325\210\357`9\257px\316\253\234\267\267\034"
+	.ascii	"i\324\240\031q\007\307u9&\341;X\rn#\364T\334O\271J\034\035\230"
+	.ascii	"\271\2757\322\317\2129[ZH\270\356z\224\237\301L?\203\021\375"
+	.ascii	"\fb\372\031X\320\317\260B\037\0029\372\020\240\321\207\340L\377"
+	.ascii	"\230\315q\033%\033\310TR`C,\306k\222\216\331\274a\245\305\260"
+	.ascii	"\230\254F\371\020\224\351CpD\037\002\037\372\020l\235\231\302"
+	.ascii	"M\310\030\2212\303\206\007\017\231\305[bnrH\301Y\360\026,\006"
+	.ascii	"?\301]p\030<\006\177\301Q\260\033\206\202\315p\031\254\005\267"
+	.ascii	"\341)\330\013\246\202\271\340+x\r\247a0\030\013\266\202\253`"
+	.ascii	"5\314\206\317\260\021\243U#&\203\213\307M\260\223\n7\206\250"
+	.ascii	"\006v\267j\340\331\262Q\247L\220jv\266\026f\307\3246\256\004"
+	.ascii	"\034\201s\334{W\270\036a\210_v\326\306\276t\345\251p:\336\314"
+	.ascii	" \251f5\250\020\367.\022\273\334-\032tIG\260\221*\\\210\230\f"
+	.ascii	"&\303eBw\357\033e\304$Sr\b\251fX\252\374\360rL\032r%\211\b6b"
+	.ascii	"\345X\341|\200\341!\2068\243\356X\341p\260\321rC\211\224\273"
+	.ascii	"\205\311\340\026\332`2\330+H\234\326\034R\217\223\261\2552\006"
+	.ascii	"`{\254G9\304\234\3761\223\3432\263\r\354\f;!u.\342,\306K\222"
+	.ascii	"\216\231t\270\302\226f\361\256\032\345\037\305\351\037\265\351"
+	.ascii	"\037a\321?z\242\177\004\246q\021\254\025Fl\314\342\037\261\240"
+	.ascii	"\177\364\244\217\001\216>\206,\372\030\242\350cP\242\217\341"
+	.ascii	"\207>\006\035\372\030\276\3641l\351cH\241o\004G\337h\213\276"
+	.ascii	"\021\024}#\036\372F^\372F/\364\215\242\364/\270\321\277@F\377"
+	.ascii	"\302\231\376\005\"\372\027\264\364\213\350\364\213\320\350\027"
+	.ascii	"M\321/\"\352\027i\351\037\263 \243\026\277\220\344\311:\226\361"
+	.ascii	"\343\027\030\006\346\252So\252\354X\214c`\255j\324\200\267\342"
+	.ascii	"rDaY\374\"\027\332\003{W\r\271\326\325U\r\331~\325\243\\A5\312"
+	.ascii	"\030+\3518\013\013\211\221\212\305E\370J\203\2214\257\026\260"
+	.ascii	"\325\235\037\273\300Um\330txY,GR\321r2\303\342\3275,7\217\220"
+	.ascii	"\024\321\226\n\253A\304*\360\306T\267H\334Uy\342u\334{c\025\326"
+	.ascii	"\352\326\335&W\032\313\223\256#\013\334\002\257\250F\254\242"
+	.ascii	"\312\2715\360LAi\234B\203V\213b\261\306\342\023\345\321O\\D,"
+	.ascii	"\205QT#\236\302P\265\270\361\024\216\n\223\221\245\246\001D\215"
+	.ascii	"Cd..\343\023\271\321'\362\242O\304\246O\204V\347\322\341\036"
+	.ascii	"d\306\324Qr\361\024\351PtY|\242\035\372\216\235[\347\211\227"
+	.ascii	"$P\366\3269v\362\025t\241\264\302\234\315Y\240\245\262T!\243"
+	.ascii	"#\227\205\313\013\025\213\377+w\315\326\314y\303b\3615\250jq"
+	.ascii	"\334\252\341\266\346B]*\031^j\216I@\276\020\253\304\310\263u"
+	.ascii	"g\204\271\331\242\321\206\b\225\202\205.\266\315\013\024\n\343"
+	.ascii	"\f\353f\206\013\261\013\231.ni\260\304\331;>\216\327\005\f\272"
+	.ascii	"#\324\215\252\201\245\342\0307w\244\232y\273\"\207\2057\304<"
+	.ascii	"<\210n\366\215\224\255.6\307.\366\213\0353\365\305\306!\2633"
+	.ascii	"Ft\203S\006uUp]\027YTV\316\034%\3048\271$\026\r\035$f\367\353"
+	.ascii	"\216\335\"Z\bQc\256\013-<G\027W+F\334\235#\207\214\271\343\205"
+	.ascii	"ja\254\262qxzX77S\210qu:\254\233=29Z\267kf\317X\037BOD{\213\235"
+	.ascii	"\021\367\336q\367\311\213M\0331*\327\311mr\303\3346W\315]s\251"
+	.ascii	"\334\267[\346\026o\222+\345^\271c\256\227[\3452\271`\356\226"
+	.ascii	"\253\345\262]\267[\344~\271i.\226\333v\237\\+7\355N\271g\256"
+	.ascii	"\221\013\345\262\271nn\234\333\345\222]%\367\354\316\271Q\256"
+	.ascii	"\3325s\271\334%\027\315=\336,\267\354\242]2\027\316}s\305\\9"
+	.ascii	"7\356\256]\343Er\341\356\221j\274fW\310\357\220{]\\+\026D+?\302"
+	.ascii	"\\\250;E\343h\343\350v\034m\227{\213D\020\214a\216\266\213\365"
+	.ascii	"\002\206h\335\254\032+\266\314\177\267\270\352X7\270\251%\304"
+	.ascii	"\353\342E\335Qm\205\025\221\305\031\027D73\273F\254\n\021\f\321"
+	.ascii	"\354\006\361r\334\273\bev\245\304\272\2166\356\232\331:\306\037"
+	.ascii	"\307\275\213H\327\b\232\327S\335xGW\215\362\211\272\364\211\\"
+	.ascii	"\350\017\345\321\037z\243?\364E\337\261\353\243\007F\0275,\026"
+	.ascii	"\367\270\005\253V.\335\n,K,\376\320\232\376\177u\334\034w\307"
+	.ascii	"\305Q\215\227\307\025\033\021\226\343\270vy\334\026v\034\253"
+	.ascii	"\200\351\270<\356\r\r\340\356\310\035\331\273H\352\340\212s\363"
+	.ascii	"\301\037B\242?\024D\177\210\250?4\246?\324C\327\270\244_\033"
+	.ascii	"\370\206\234U\020\213?\224C\177HK_\210N_(N_\310M_HM_\310\211"
+	.ascii	"\276\320\230\276P\f\355\241\032\345\013M\351\007\275\321\017"
+	.ascii	"\352\242\037d\246\037tD?\b\207~\220\226>P\036\215A5\312\007\212"
+	.ascii	"\323\007B\243\017\224\246\017\264D\037H\207>\320\013}\240(\375"
+	.ascii	"\2379\375\0374\372?[\364\177\244\350\027\253Q\376O\020\375\237"
+	.ascii	"0\375\237,}\237:}\2378\372>^\364}\234\350\373\020\365}\264\364"
+	.ascii	"}\246\364{\342\350\367|\321\357\221\242\377V\217\362{\210\350"
+	.ascii	"\243U\243\374\236/\375\036\026\372\272\216\276\006\243\257\241"
+	.ascii	"\350\353 \232\203z\224\257_\350\353\255\277c\243\277\333\242"
+	.ascii	"\317%M\177\027E\277\255\032\345\317\325\243\374\335\021\375\235"
+	.ascii	"\230\266`l\230jD\262b\312D\271\240a\361w5\364\007vE\312\257\253"
+	.ascii	"H\371;\024\372\331\215\376\221Ku:,\316ur\235LW\257\256\342DD"
+	.ascii	"U\311R\263\363L\227\363\334x\373B\222'\343\311Z\314\276\300\274"
+	.ascii	"9\203\302\341e\361\235Zfn\355\f\2173\375\347\271\354\345g\254"
+	.ascii	"\2506Eg\013O\221\221#,\313\221H\332\250\272\264\025\201\254\254"
+	.ascii	"x|e9\344\213!n\304\236\304a\233\363rF\205\305\331Mv\223\341~"
+	.ascii	"\001\212\207\217\230\026B\270\314m.\030\037\376||\206#Q\264\221"
+	.ascii	"S\306\342\f\347l\372\316\22423\026\3477g"
+	.ascii	"\333}\021\023\346E\301\016\375\3476\244\327\031\2563i,N\223&"
+	.ascii	"\257A\372z\202\033\300U\213 Lp\330Y\262fMVSG\306W\036\233\337"
+	.ascii	"|bfk\026\237\002\024\372\023\324\2311\223\317T'\333\nC\22707"
+	.ascii	":\\\207H\025\2273@\204\204\265\260\370\023\260\001\003&\227A"
+	.ascii	"\232\323\344\216\2341\017\027(2\317ez|\314\231\333\221\333\304"
+	.ascii	"\260\220\365\326\226\307\304p1\026&\213\021\301\315\222-\026"
+	.ascii	"\177\0021:\314\025r\275\370\340\022\307\342O\200\326\245K\366"
+	.ascii	"\202\364\365\004W\201\2202t`\312\316\320|Y\234\275\374\250\301"
+	.ascii	":\262\304\342O0\266eKf+\302\341\322gN\262\240Y\374\tbd\311\222"
+	.ascii	"\331vZ-p\33092dcg\251\263\366\314\246D\255\270\345\341LZ\032"
+	.ascii	"\2715\244E\013jZ\205\232\232\264\342\331\177FnU'\333*I\215\016"
+	.ascii	"\314\221\275\271>\220t\350\316\250,\276\007 ff\371\n\022\220"
+	.ascii	"-\227\344G\013O\2220V\236\257\220Z\212{\207\305\271\n\331\002"
+	.ascii	"\b\311U\f*T\350\262\330@b\251L\321R\003M\227)Y\212\006\354f\206"
+	.ascii	"\2152\213\357\201\206\276\007\026d\317L\310\262\361\242\251\305"
+	.ascii	"\315\2457\031Y\236c\023\026M\3104y6>C\311`\304\335\034)\202\006"
+	.ascii	"\312\342\374\344B\\a\324\216\026?;\361\021\"\006\305\210\305"
+	.ascii	"\327N\264\260\260,\316\305\273\261C\334\264\200\2638\227\235"
+	.ascii	"\r\210+\315\034\216%=j5\304\300,\376\216\n\232\031D\213\357A"
+	.ascii	"\252\205\347\036-\344$\267\214\336O\305\315\365\365\004\207\001"
+	.ascii	"\020\026uI\3466\025\327\207\037$k\212\254\tyN\362\214$\203\021"
+	.ascii	"g\253V\336\2109,\316G^u\304\211Be\361s\221l\344\357\351\001\322"
+	.string	"\306\n\235\305\227\340\214\316D\n\360\277\307v\331\261\201\307\342\347!9\312\370 b\261\255g\3139\b\220\227\264\271\031\026g \207\023d\245I\016\032\304\377=WL\230[\224\305\331G\036\253\306\177\311?^\034\022RK1\345\213\305\227@\214~\375\227\374\201\372/9\357x\346\361\367\3740aC\341f\361%\320\242s\216g\035\177Om\301E[\031\213/A\232\3763\216\277\007\b\256\207\326\016\213/\201\025}\t\214\271\306k\344\033\325\311\266\252b*X\200\231\333\233\353\003\246\263\342\3101\354\371\306\237\301\b[%\364\006\006\035.\2133X5#\0333c\304\342\317\3116\206\254v\234\231l#\177\361 B\374\032S\354\241\313SCE\366\252^\310\260\031r\333\342K`D\377\231F\246Az9\200h\3570+\264}\305u\301n\256,\016\230\305\227\200\306\233\223wH<d\236j$\337d\026\222\2426\224\217\004"
+	.ascii	"\t\243q\301M\323\265\335,\226a\255\304\201#c\361%\260\3220H\272"
+	.ascii	"\274\331\034\237\310:\2625\032He\024\265-\307\002\212\2149B\221"
+	.ascii	"uBOE{\337\310Y\231+o\345\030\371E\326\252\306\f#\2478\211\207"
+	.ascii	"\314#\225\224a\344\2507\030\231*_\3256.\242-\205\305g\005X[\227"
+	.ascii	"\020&\351\356fC\024\225\003\230\2709f"
+	.string	"\253\214U\215\371\352H\305\235\257\262\212\354\242\266q\025w\326\317\0257:rAqf\336fd\374g\027\271\312J\021G\034\213s\213\035\327\326\227)\213\337\001\216\376\363\212j\314,\364\234#iw\334l\331\021\326F\277\003\032\375\016]t\236\322g\216]b,~\207,\372\035\316\364;P\321\357\340D\277\303\022\375\347M\326A\361\"GL\235u\013\323\"\312\342w@\242m\261\036\345\017\325(\223t\310:\244\235\277g(\tZ\013U,~\007 \372\344\334\377\236\b\354\030S\305b\\\317\226\3119'\345\376\036\373\345\007\261\312\342w\350\241O\306!\345\374=BocS\232X\374\0167\364\311\270*urdXL\302i\024\035\264,\360\351\302\3425\003\316I\270\237<Z9V\311\nuy\350X\034T\215\262\335J:\t\347G\214\226c\231\305\347\200G\237\\S\3116F\262\r\271\006io\254\n\200<\341\272"
+	.string	"\007\031\342\026\306\342s(\243\3115\226\203\027\013\200\330\344d<Qsr\315\217\227X6\325l\0037\320\260\271Yl\301\222N\252\261KZ\240\332aq\2324\344\226\336{\023\021\022\266vdsq}\3701RE\355\311\342s(;s\206\334\262{\357M\334qABw$S\333\222b\3619\350\320e\310-\244\0339\245\237\260\366\206:\262\233\021\306\241\206>\007,\375\223b^\215\244\030\262\255:\331O?n\324\350\300\370x\335\2413c19\206\t\0259c\026\237\003\224\376\006/\257F\322\013\t\346\303\327\316\""
+	.string	"\020\2608-2L\354\307\r\213\311/CZl\304\342X\374\rn\372\033\262\350\237\344R\215$\027,\343\303\327\316\362@$\216\033]P\0215\031`\026\177\303\221\2655R\213\\\216\023\207\353\203\316\312b\301\213\355\244\226\024dV\204\220M\340r\260\270\262\370\033\302\364\331\031\251\346a\357\215b\237\370\022\242&\355\244Z5\033\"c\223e\315b\022m\307cJ\020,\026\177\016\031&\327\346\314\342o\250\2322\205\274\022G\210\225\223Wz\270^\f\301a1Y\245\272\201\221\273a1I\345\326a\267:6\254\314\321?if$\315\256\034\222\223\2355\364\003\212\313\005CT\270@\035->"
+	.string	"\334\364O\032\215\244\221|a\235\354'\241\037hrI\346\366\346\272"
+	.string	"hE\021\310\361\n\331\311\310'u\357\275\271\366\023\\\322\214\250\260\2659''\237\260\005\025\215j\332XL2!\233\374\357\3719\326\310!\325\204,\322\360\221\002E\225\237)\2518h,&\313\254\020\037&<~"
+	.string	"\261\230\\R\315\376\367\370\234ym\"\026\177\316\331\376\367\340\030iJ\302X|"
+	.string	" !B&!B\"\311{\327\342\227\325\325\346\272\372P\244\b\211\304\356\257\275\211;\263\260#G\362\310I$;-G%f\026\223Fn\335\377\236 9F+-\213?\307\306\370\337\223\325\f\261\221\302\342\003@K?\2026B\204T)>W\017\210\032;F\200E\377$\020 Y\" \376\370\361%K\0041\364CT\322G5\222>\316\346\200\r\205\205\001\021!\373\202k\250\323'uT\222\207\221\344Q\3150\330Q\211\342r\334W\305\013\256\201\215~\255f\371\025I%mT#i\203\314\001\243\202%Q0.\300UBQ\310\254\332,\376I\261\2238~\022\214\f#[\260=V\234\335\243Q-\312b\362F\322I1r\315\2328n\026OP\215\262\206b=\312\227kF5\2223H\257\013W\017p[q\334W\\\027"
+	.ascii	"m\0362\244\274~\222\006\331E\326\250_Un\312\256X\374&(M\252\b"
+	.ascii	"\232\305\027\332\352Q\266=\252Q\276\006\"\372'e\030I\031U\nI"
+	.ascii	"\265w\226\007\"O4x\351\2230\310\030'\265Nj\221['\332{G\355]\243"
+	.ascii	"+\303E\205\255\315m\256\253\017\377\347\234\334\372\033\240\r"
+	.ascii	"d\231!cT,\276\006*\375\327\333?o\250\253\275w\026Y\334WQ@\371"
+	.ascii	"\257\257\001K\247\0220\350\201\320\357L\2352\320@\330\324#\215"
+	.ascii	"\206g\n1dJ\313&\021\300`SS\2607\004\006{=g\na6\235\251\210!j"
+	.ascii	"\2228Q_\004)oH\202\331t\246zx\376~gS\376\225\300\245\363\204"
+	.ascii	"%\340I\3424{\246\tC\021L\240F\351\t\024\301w\n\203<H\315\245"
+	.ascii	"\t<0\227\200%S\017"
+	.ascii	"\351L!D\004O\241i2\240\tEM\241i\246\220\341L!\226\200g\t=\023"
+	.ascii	"\322\023x\022\235H\321\363\003s(\344\204!5\207MfS>S\210%\340"
+	.ascii	"\211\246C\021\246\317\351\327\003\236\"\320\241\223\b\b~?' 0"
+	.ascii	"\b\334\245<s\205s\230K\004Q\2464\b\334)\225\346\017\233\250\223"
+	.ascii	"\020\013"
+	.string	"\233zMfS\036\236A'\204A\017\"H\317\024bI(bI\330\003:\201\260$\374\001*Yr\310[\022\002\245<\340\222\220\004.\t\257\271\3029\304\303\241\211\372|\345\356\2040\330\303h*\274>\023\270t\376\312\235\317\034:as\270;\312[\022\206\b:\201\246\303s\3114\2017\324 ,I0}A\022\202(\004O\237S\007\276S\250\341\377\257\255\273\b\206G>\030\2040!\035\226?\240\324(\0352\201\226i\371A\017\315\303\236\t\303\241\331\013\242B\f=\363g\236p\224\241\204\024h\242\250S\257\350Hh\246'\234\370\t\205\245\021\005\030\204H\321R\030B\204\245\340\b\003p\372\005\207)p\350\240\367+{\021\244@\247\240\007*\fK\022\214\206\351\317\251T2}H'\360\206\346\022\2604a\303\211\022E;82\323\322't\202\340\275\0235\201\346\222\276\0016(\300\006\034\230\330\235\003\004`\200"
+	.string	"\f\3629@@R\022\0026H\322\337 \351\246\007A(=S\210\245S)C\223\231\016O\f\205\206H\234i\257,2}\301&\237a\357L\207gZ\246C\236\n\3032\035\032\006K\330\300LK\364H\205^\360\327s\022\366\202\314\246\023\005\263W\242!,\001\317&\264\003\240\004P\263DP\b\001j\236Jg\n4}\"\370\3202\230\302\320\nL$\230C\246\3543Q'\0373-M0W8\233\316T(\001\324\3749\371L\246\336\360\350L!L\240\"\226\204F\250\217\260l\352\241$j\372N\022AT\3503M\240\277\362D\315a\221\t\363't\372@\351W2\371\230\276\023EM\022A\036\360\364\220\362vK%\n\301\223\267\344\364\023\"\241>\340\231\002/-\207\274&'4U\301\024\016\001"
+	.ascii	"d\376\312\236O\212\232$\200g\017\365\235M$\360l\322*\364L\246"
+	.ascii	"\236\211\262I\017\r\177%\211_P\210\232)P\204\036\232ah\232\350"
+	.ascii	"\222\371AS\351\001\t\241\322\205\264$q\246\275\016L_\220\004"
+	.ascii	"\364,\221\200g\317\034:\231@\177x&\234J\236\211\262ihx\224\232"
+	.ascii	"C%\245\340\217)<\221\026i\350\220:\t\201g\006\223\304\231\226"
+	.ascii	"$N\324\364m@\203i\257T\342-\001O\2464\030l\032\362z(\222/x\242"
+	.ascii	"\246\320l*Q%^\017\035\362\316\341\020\325\260KyeZ~\020,a8\344"
+	.ascii	"$4\323!.\323\322\207M\036\006\223g\372\202$\fK\360\235B\240\025"
+	.ascii	"\230x%\312\023B+0\361\210V`b\352\245A`z\246\020\276S(\002"
+	.string	"\t\204:\344)\371Na.\241\212P?\250\276SxS\340\031,A\350\344\003\236\026\310\360S\242\274\200\323\t\276S(\004<IH;\360\235B\"\223\204\371\033J{\246\222\222Q\212\232B\023&/\375\235)\017\030\\\341D\203LH\246/H\302\211\364$Q\242!\234)\260\034B\001\002\340Y\206\200\006\323\02251\230P\242<Q\3643{\275\016\314\264D\205|KD\276_\220ih\242L)/5\207Hf\323\231\372\234(\177\246\357\007\203\231\226(\317h\b4\205MA\017|g\ti\231\002\t#`\360LQ\360\241e\t4\b\202\3174\225\216J\224'xC>+0\3612\030\016Ka\211\340\257\350\004j\222\b\366L\224\3074,\321\236\220P:\f\006S8J\203D\347\317\022\260D\032\236&J\336\222S\n\246/\003\360,\227\212\206M<_i2\225*\004\203?\036j\002\317\022MyA\264Wj"
+	.string	"\236\345\022Q\021\032DQ3\203\222R0u\352\361x\303\024\312\013\031\240f\372;\225.\254\300\304\003\236+0\361L\224M\274&\324L}<%\341\217\007<\341\303`\372\202$\224\200\302\206\364l:G0\177K\300\0162"
+	.ascii	"\3172\204\242\324\034\232&\240\346\322\322\211\242P\"\370\373"
+	.ascii	"u\340\001S\017\350T\376:\360\314\241\323\005\023\345\317Dy%\312"
+	.ascii	"\023<\237\231\226\350\222\231\002O\f\300\340\231\226"
+	.string	"+\234hi\002\317\021\322\241\023\312\224\032\221\300\263\\\3621{\300\222\204\257\344\001\317&\236/(u\022\246NA\036\032L\203M\027r\nt\n\366x\277\237\331\343\005S\2472\003/\005\232\347\020X\242)\322\231B\020\005\317\264Dy\302\235\331;I\230\276\334\353\225<\037\032\354\231M8=S\b\021=\245\n\320\222\251\207\315\2462\002\346\357T\n\242\302\0373-M\370\005\321\024\030\354\031q\340;I@\231\322\035\007A\241\211\006\240L\251\036\016\315\2644\241\207\356\202B\023\r\350\241yh\246%J~ B\t(\023\n\300\023\276\236\024x\006\205*\224&\232\002\257\024\246B\246\360Dj\224\002\315\036j\ny\2774\r\242L)\004\351\331t\376xfZ\242>\246/HB)Lwg\n1T2}\276\237y*\361L\004SP\241W\376R\030\300\220\327\001\360\344\245@\223D\003\226\202#\244LK\347O)"
+	.ascii	"\273\022&P\233N\277\262\002i\031\374\201P\302\004\006\001\203"
+	.ascii	"g\332\003:\201\360\013\006\031\300#\227\312\037\bi\031\374)\365"
+	.ascii	"\244\031h\220v\220:\005\315\2463\355\031\362\314\264LO(J\207"
+	.ascii	"\274\013\275\234\236)\304P\002\363W\366N(2\341T\016\245g\n14"
+	.ascii	"}\301&\r\017\nMTD\032\f\242\"~\204fz\202\017h\356\206<s\tX\232"
+	.ascii	"\320\023\022\232\351\t)Z\246\303\036s\tX\242\344\322\251\004"
+	.ascii	"\f\376L \260d\362\200\251\227\236%N0\341T\036\2310}@\021\206"
+	.ascii	"R\336\006I)\360t\322\250\231\002M\017\210R\036\007)\360t\332"
+	.ascii	"=)\311\003\017\024\210@\b\272\027b\230\002\315\246t\350\304\001"
+	.ascii	"_\311\353\241\"zJ\"\200g\331$\242\207\016E\204\350\360\177\347"
+	.ascii	"#_\251CXX-\331\365\330\361\210\232\321c\b\214Nl\312Nl'\266\323"
+	.ascii	"A\001\0344\271$;\035\273\034j]{,\307\016G\ti\246\346\310,\237"
+	.ascii	"\251\272;4v-X\265\234\245\244\215\230\305\017@\f\375\357n\\\301"
+	.ascii	"ou\246\274\302H\265\241\030-\312\312\354\300\332|\366\023\226"
+	.ascii	"-;\033\271L\r9v\346\276\236\210a\222\206\303\026\311\270\214"
+	.ascii	"\260\370Q\003\314\215<]n\026\357\314\316\212Uh\234a@\\\0131;"
+	.ascii	"#\257\371rF\304\210\305\305\236#O\352\334\331\305\330\305\330"
+	.ascii	"q\375\330\261\320\302\210\234\335\326w\\6\206\225\232\3025\305"
+	.ascii	"\342\235\226\335=n,\254I\263\305X\341\261c\361)\220\243\213\030"
+	.ascii	"\270\214\270\260\270H\266wQ(\027\351\221\"-\213\274\302_1\216"
+	.ascii	"L\260rtu\261A\263W\371F~\001f\006\211\027!\342\212#[\026\357"
+	.ascii	"\252\f\360\2657\324\256\305\316\305wU/\356\252\206\360\f\325"
+	.ascii	":\201\025b\345\005]f\261[q\367W\2227\213\307\024\213dO;\306,"
+	.ascii	"\336I\355\244vTu_\215\330z\261K\361\035\325\033\"\30563\213w"
+	.ascii	"(\252\331\020)\2562\213wSW\272\254\212\3249\034J\312\210\261"
+	.ascii	"\370\024\264\351b\361\007\255\306\024\030;\250\234\244\314\r"
+	.ascii	"\250\261\335S\r\241%t=\356\354\266\261\255,\205n\2503r\264b\232"
+	.ascii	"G9\n\222"
+	.string	"L)\203\024\232\241\2316\007\023\025@0p@\"\227\315\226\305=\023\300BJ+\005\222(\347\240BC#\022H\020)H\n\n\222e\016\215\232n\224%=\367\005\300\306\373Qh\243\2302\020\231\007,(\320r\245\233\022\243\322&\354\f\021\351"
+	.string	"\320h\355y\225re\177?-+U\004Qz\310\031\242D\270g\262[0Q\001\252\025\233\276A\f\317\2378\270d\360\306D\365\240\255\362\235\\htJ\227w\355\037\243\202^\004\256b\020\351cY\247=\240\252\231\001\005t\252\347\241\253\222H\r\001\207\237\0333\272@\035\"\214 -\200\254\305\027\262\310\242\252\366\335\026\235y\323\253\3234\370\t\253GmB7\355\003;Z\377\255\335\006\306\f1\353Su\\\016\277\f\267\t4\007a\b\316n\307\215\31676\314\301\327\371\331\226RkK\035\334\207\373\243rP\263\214*\203\354\270\025"
+	.string	";\0260\312%$U\336\037"
+	.string	"G26Rk8#\353\317\031\3564:\366\242\325\264\323\363\351!s\nA@\324\303\233\271\254=`\255\262\363\tmO\006\302\227d\367'\333u\353(k9\256\353\366\334\002v\271\203\255\222\005\323\2541s\n9c\215y\r\271\032\377O\006\244\342\255\352?d\314\235\371\006\242\336P\016\344\215\374\021?\334{&\324\231\326l\310W4\025f\025{\334i\200\340e\037\2300\031{h\241w:\270\252\257\226\264$\360\2720\033\344\2129\232\337\202\302[S\360\233 \244l>RtB\264\031\214\262\t|\315\312\264R\212\bh<\322T2\365\342CgIj\266{\035\301$\220)F>\r\001j\335JA\2342x\n\370\347\274\216\342`\212\340dr\r\005R\305D\203D|\337\35245\026\362\325\021kl,S\024\204\242QK`\374%\227\034\322KE\216s\302O\356\204\251\273"
+	.ascii	"\245\260m\371&\330\f\277\347z\276\235B"
+	.string	"uG\035\246u\242\201\3645U\275\032\030\031\243\351\377\354Xv\346\203G\271Vb\025\223\301\354\240.\223\376\034\301\233\261\352:\326\204/\322R>N7\201V\274WO\271\365|\276\325\332\205\335k\353PL\205\320\242\360C*J\033\332\"jA\026\351\227\2170q\020\023Kc\231\343\254\247\312\210\330\270f\260[\016\310\250Y\006\305C\311\374+\377\300\242\217\031yD\331\314\245\334\350\340 {\347k\367\034\3325T^|N\256\312Y\266\250\376\202 e.t\256\177\013\230\242\207^]\"\354\3224\337)\034\020\026eb\013\361\326\360\266;\266\256t\323/\230JDJ\217T8\335D,a\006\2443\003\367\254q#\376c\\\030R%\331\201t\226\337\204\017\276\225\231\276\274u]\205\"\210\2021\236\2066\263\025H\325?\202\003\302\363\327\036\n4\210A\357.h\252\256h\313\315\004\203t\325\342\247]_\342$\211\302"
+	.ascii	"\366u\353\244[Pq\327\373\327\n7\006\314q\210\356,\201.\340F\315"
+	.ascii	"\345\374\325\345W\021\345\344+\b;\252\3304I2\231\213yZv*6ms\254"
+	.ascii	"U1\f\245Fj\2779 \355\356\016\226\377\364$\023x\277\255\351\247"
+	.ascii	"\031i\202i~_auD:e\277\277\275OS5lv\324\262a|\354a\016\206K\236"
+	.ascii	"\306\323\271\b\b\016\007\326\036`Jb\351\200\260\354E-{zZ\362"
+	.ascii	"-y \246i\025\376\347\306\245Csb\374\354zW\367\342\253\347\255"
+	.ascii	"\326\350\311\021 \250\326W\316\253U\205\304J\342\360%\n\320\t"
+	.ascii	"\264P\304eL\302\024p\314\235\213NM\262\344\370o\353\270\312\332"
+	.ascii	"K\203\t\311\344\006\025D^\310B\365\303\3053XC\236y\375\306\355"
+	.ascii	"\270\n\277\272*\003\351\\+\313^\002\267\373\315\210P\200\220"
+	.ascii	"\256\005\316\375\b\230t'\2064\320jA0\023<\256c\255\326NgEL\321"
+	.ascii	"<\205\016#\032+\316\027\332+\204\374\n&R\rJ+q]\322\031\336\246"
+	.ascii	"\nP[\251l\2161d\261\345\357\372\246O\321\023\330, \361k\370\320"
+	.ascii	"2\234\304\316\365\200\272\274\201;\204\370\f\324&\230\021qH\241"
+	.ascii	"\330\370 a\244\031\215\0058\202D\350\374\215\355\313\037\362"
+	.ascii	"\213\244x\201\261\001\302\022O\242\320\340N\322\037\244G\037"
+	.ascii	"\234\303\211|\241\007\f\224Y\036\202&\342FIXd\243\t\354t\300"
+	.ascii	"e\263g0\234nQ\302\246\230\335/+9Y\220R\200\344\204\"\006u\013"
+	.ascii	"\331,\303\270\002\270\3140'\201z\264s\016\352[Q\260U\3375\274"
+	.ascii	"\332\203xk\t\277 T\353sb\032ao|\361`t\357\0016\013\026|\232\322"
+	.ascii	"\237\001\371\300\325\343<\203\367A\240\210:\006{\220c\262\352"
+	.ascii	"\201h\336\252.d\202r\035&\377^9\322\264+\0061\311{\342L\007\261"
+	.ascii	"aL\3649\007_N\314\211(\276\357!\211\006B~\023\301\031\215\267"
+	.ascii	"\0204^yR\034>\263\376\235\357s\271\023\243\204\205`4\334\265"
+	.ascii	"{\334m~\261\362i\372\024L\313\375\273\234\352\312}qF(\001l\351"
+	.ascii	"Ic\001\372\224\311@\360m\n\273V\327\367A\205\324&>\r\366\202"
+	.ascii	"\260\016Xr7\206\201\230\272<S<\035\007\016\371\231]\2266\324"
+	.ascii	"\310\210o_\221\366Q)\t\221J\262\003f\b\214\304P\264\341\002_"
+	.ascii	"\301\321\333\216Z\217\030\032\320\223\n\203\343\n`\377 \3144"
+	.ascii	"\267\b\206$\231\311\231\352N\271\304<\345\030f@0\006\365@#\024"
+	.ascii	"\353\320\244\fh\324DC\263\2362\333\300_Hq\215<G\321\217\202\250"
+	.ascii	"\3428\213.\336\355 \025\373\345\207"
+	.string	"S1p\177\302\247a\273\n\314\221\026\303\247\231M\204\036L\256\240\255}\031\373\364qW\325\204\207\326.K\025\256 ,>\331}{\035\217\213\334 | \214\333\033\234\\\303\256^\335\263\004`\006*\n\374|\263\016\237\020D\201\345|\256\242\263\213u\007\013m\204j,/\222C\302q\313\320e\n\2124/\234q\271;:<\313\262\217\017\310.\270`<\362\307)\261\323\302\034y\030\224\334\335R\321\347\226\247\325+\n \274_\230\277\325\305\225\372*\260\347s\217\334\030\246\005bB\236\374\215^oR)\032c}\267\031=\021 \344\2028+\262\233\360\235]\364\006\034IK\214$H\177\251\033\241\353Wf6\244\016\001\f1\337r\357\204y}\020L\213B\205\223:\206P\362\322\n\232\247\304\274\226\373\031.\357Y\363\351\312K6\220\334\b\351\273\254N\344,\352\221n\225UN\242\203\024\034\335\343b\243]\345\233"
+	.string	"\305\2122V\227\323\274*\022O\353\b\215}}h\213\343\235N\354\375\263\233\242j\371sp\355\341\326\027\2352\247\210\311V\352*\2261\374\027o\206\215\364\211\222:\3237\345\253\250\210\"cm\025\253\206\177\312Z\252\221\304\260\346\t,\314]Ig\215\207:\3335%IH\340\307\005\347tj\225\227\r0c\013~\260Bn\321\177\242w\242\354\244\231\222\313<^\337Hcs\276\337\253\332fs\370\343\377\367\247\373\227jR\235\230$\312\276\302,\204\361\200\346s\233J\245\031\230M\316\317\"3d\r\270\020\365H/\004%\025\003\236S\005\316\324\274V \037\340\204\0017\325y\270\300\n"
+	.string	"!\331\307b\205E\266Z\n\tNS\241\323\234M\256{\342\3007WA\342\227s\330\356\301!|\0253a\331_I\332\342\310\315\375\"\372A,\237\201\0253\240\004"
+	.ascii	"l>\021\253Q\2009~q#S\276\340i|\031\236H\017\204\034c\2655@\253"
+	.ascii	"\304V^P\023\342\326\331\220@"
+	.string	"\325\330.(\304hkA2\b\020\342\003\257lT'\r\241cy\f\027\3527\251~`\236\023\3121\340\350\272^u$\316Vk)\242%;\025\004Y"
+	.string	"\310\345)\347\330\244\024.\030\202\364\327\217J/$!2\276\274#\357nQ\241\242"
+	.ascii	"\301\270\212\263\271\321\247\2403=z@C\203\374\261\243\274/\263"
+	.ascii	"\2515'\273m\325\237\350\320\264\"`\374U\253\322\320\276\005H"
+	.ascii	"\321\307\337\210E\304\352\022\003\303&7\360\253\3076\0370%-l"
+	.ascii	"J\323\030\356YK\017: \206\37177\354\352Y\255\324\207\374l\237"
+	.ascii	"\371\323\r\031\305Ey\255l\233\324\222\034U~\261\300\210\206\030"
+	.ascii	"\232YK\006>\223\220 :T\021\243\265\337\246\026\305\222>\f\251"
+	.ascii	"\260\f\254\266\004\314e\251\216\355\373\031\225\214\356\3220"
+	.ascii	"\341\342e{w\367\345\232\"h\244\320Y\200\200\021uB\226f\211\037"
+	.ascii	"\367\2356\275\354Y\"\2728\236\352\353\316\377\351\253\232E \f"
+	.ascii	"R4\344@\365\371\340R\3605I\335\376\345D\361\006\016m\212\001"
+	.ascii	"\274\241\024\231\003i>"
+	.string	"\365\322\307]\267}\2117\316\356f&\321\334\023}\203w\357\333D8\266\224\272\b\353F\335\262\343\301\316$\207k\237\037\307F\247\013\362\324\245\"(y\364\234\310<\373\205\225\230\313\336\353k\027\"\301\001\351\021\240\373\256\350\231M\206\2178\230-'X~\204\022m\003\2252\206\217\225\221\304&\276\023K\336\001\024\"\002+T\347\017\032\250K\346\204\035Pj+L\231\204\354|\333[8-*\033\360\023\252)\f\301\212\366\217\317\307R;<\254\236\342\317\232\237\233\226\"V'~.\240\343q|4\314\344[M<\036\020\302\355?\233\313\320\037\274?pW\347qK$\006Y\267\272\233=>$\036\265\347V\3714\376\023\220\351x\346\376U\007\234J/\220\242\bV-\266\237\357\247Q\332u+\230\307\352/\266\207\210q\006\f )(Z\2501`\204\201*\260\326w\320\021S\n\371\353L\341WF|nsF\331\205"
+	.ascii	"\2213Mf\026[NvHhN{B\230\340\211\3745\027\252\370\360\2535\233"
+	.ascii	"\373\330\036\020\232J\036\006\356\004\241\r4e\361\256\020\307"
+	.ascii	"\035\200\340\257*\2309\020\225J\254 :Ai\225\247I\207*\2560\331"
+	.ascii	"\323\220>\240\377#C<\022\275\231\317\351\370\347\327S\235,e\226"
+	.ascii	"\r\354p\334\337\2307\243\317L\223c-\334\2138\332;\366\313\262"
+	.ascii	"\353\217\337\031c7\177K\244\257\215\372s\306mz\307\027\021\336"
+	.ascii	"sv\213\305S\356\254\0212A\344m@u\371\032\267x\256B1\377\364\266"
+	.ascii	"\212\241\246?\256\351\016\344\256\350P\343*\311\035\260\373c"
+	.ascii	"\327;r\317^G\374k\0019oy\\U\227B\322\003I\347k\335\006\030s\300"
+	.ascii	")\316\030\273w\344\345]\037\364\333\332\317\230\312\334\375Y"
+	.ascii	"\216F'C\355\n\337]\373\327\312\255i\345\361\036,\023\263'\360"
+	.ascii	"\007m\215*j\301\346\311\002]\223\271&r*{O\226n?\026\243\336l"
+	.ascii	"\354v@\025\2662\374$\336\243\377\265U\272\357\"o[<\373yK\361"
+	.ascii	"t\267\343v\360\373v\027\371R?I\036\353\217\363\362\177\326\277"
+	.ascii	"C\315G\220G\367o\351l\020\366\316\221\266\306\357\213\246G\241"
+	.ascii	"\265+"
+	.text
+	.section	.gnu.lto_.symtab.badb53e47335cc6c,"e",@progbits
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.badb53e47335cc6c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
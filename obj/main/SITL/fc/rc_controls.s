@@ -0,0 +1,1330 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\005\007"
+	.string	"4\t\212\001"
+	.string	"\030"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\303\375\206\360\n\020\002\003\002\004\002\005\002\006\002\007\002\b\007\005\b\244\204\257\002`\003\002\003\002\005"
+	.string	"\002"
+	.string	"\003\002\t\007\002\007\002\n\005\n\002\n\t\n\013\f\016\021\220\237\222\215\004\002\022\201\212\206\304\023\344\371\276\347\t\024\250\332\251\210\016\025\026\253\262\211\366\t\027\236\321\306!\030\031\353\227\221\315\013\032\211\236\236\264\001\033\034\240\342\234\212\n"
+	.ascii	"\" p\202B\250\333\245|\372\222\305\332/J\324h\231\321Na|\022"
+	.ascii	"k\367)BG\001\230\335&Z\310\210\200a\300\301\262\2307\302\030"
+	.ascii	"\240C\340!\330\004\274\005P8\f\002\353k\204\326w\013\367+\210"
+	.ascii	"\270\253\315\232\013w!\027\316\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 \202\265\001"
+	.string	"\350v"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	""
+	.string	"\021\002"
+	.string	"\003\022"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.ascii	" \007\327\240&\fQ\365\305\264b\327\335\\\214\225%2W\201\001\026"
+	.text
+	.section	.gnu.lto_.inline.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`G\001-\007"
+	.string	"2\211\035(pU\222\016LC`\017S\001\357}G\013\227\020\242\276\n\007\304\233\210:UU\272\021\\p`\21247\255]\262\245L\001\377G\344\324\301\210\236\225wR\266\271;\350\003\347\205\305\217\310\252\030\n\304RN\237\225E\006:\027\022,\210\277d\377C 3\001P\364\3510\211\246  \361\372_\224\031\354'\224sk\264rw\322\275\323\363\214\266\317\311\356\356\326?w\021/ `\242RH\346\001\261l \256\303\n\271\201\001\346\022\214X\006\262\2139\217\326\027[\255\267*~\322\310\205\023\007\337 dq\260 hH\300\236_(\023\337\0310\030\200\037\246\004L\340\002\002\214\013\317\221\026Pv\356^\301C"
+	.ascii	"Va\004\025\2724\310\001\204\007\200$\263m\360\322;\256\265\240"
+	.ascii	"\027\370p\202\271\337`Zs\253j\327\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\305\006"
+	.string	"B\t\035&\200\265I\0073#\247\372\245Rc\022\031\001\360jj\231\274\265g/&ht?\\"
+	.string	";{\254\260\241\315\304\312$\003$\371\221\013K\327\240\213\371\022\006\270m\232\023$\303\254x\206\330\332\320\265\214--\024E\272\356\270\345\224LJM\201\353\220\177|\353\350>\272\316FY\322\360\207\333\031\220 \026<\354aK\253\346\254\332tf\\K\252\245+\371\222<>\020, \220\202\t\024\221\007X\241\201\"\244\321\224c\213\233\373\311\310M\312\215 \370\356mh\337\275\n\3067\b\356\376\024\270@m\352\246\3144"
+	.ascii	"\3039\211\225/\201%\031Hjj\002^S\303?\"\013 @\237\f+R\305o\222"
+	.ascii	"+^D2Bk\265\023\021\204\240k\037&cfk\225\344\210\353\2129\004"
+	.text
+	.section	.gnu.lto_.pureconst.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\021\204\004\022\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 z]\002"
+	.string	"\264\002n"
+	.string	"\005"
+	.string	"\001\002\024\001\002\001\300\007\025"
+	.string	"\001\002\026\004\003\002\027\001"
+	.string	"\002\030"
+	.string	"\001\002\031\001"
+	.string	"\002\032"
+	.string	"\001\002\033\021\002\300\007\200\022\r"
+	.string	"_\020"
+	.ascii	"|`EP\016\\\205\365\252&\244\004\001F\337<\202\331w\267\003,\f"
+	.ascii	"\003,"
+	.text
+	.section	.gnu.lto_.lto.53f77b0f781b4a35,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.76.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\315\201\023\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\005\031?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.78.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.82.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 \227e\004"
+	.string	"\344\007a"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\326\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\002\220 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.84.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.88.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\241\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\016\032?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.90.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 W5\002"
+	.string	"4\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\350\0072\264\013\352\376\n?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.ascii	"*#\300!\314\306\2004\225\313)V\017\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.91.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375 \347e\006"
+	.string	"RL-3Pm\222\016$\243\252\022\252z'U\023\216\332@\226\220I-\377\226\354\252\375\273\035vv\347`N`\020;3\213(\242\357"
+	.string	"\017(S\217\315Z\373d\313\024\273\314\306\341Q\034\315s\t\216j\216\241i\032\024\036\232\2436-\023\360\203X\240\032\347=\252a\256,\033!\033"
+	.string	"1\211oHE\252\313qD\007ku\272\035K'd"
+	.string	"\026 ,\375\365A\226\361\255df\316F?\216\354\342q\"@\222\031*\245\244\311T\322\361{\036\263\301\201\347\252\327F\250\030\244\211\021\224\314\2531\215V\305\352\026\244\225\217\013\222%\372\024/\b\2319Z\242\212\316\372\023\374\005?E\007"
+	.ascii	"2\001\0238#&\016\345\256!K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.92.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`5\001%\r"
+	.string	"\006\032YA\020\257&\035\250\201\241\207\n\023\372U\002\t\324-l\"^\204\222\313\024\237\223\341J\230\260'\377[c\3751\324\321\203\3218\021C\024"
+	.string	""
+	.string	"\2004\324\205\216\201\003\320}lI\343\333\030\t\331;\311\224\002H"
+	.string	"A"
+	.string	"F"
+	.string	"\026@\371\241\003P~-\320\251\307\333\005\027W\210\t\231d27\353\026\354\361sGO]\205<\r\023Z\210\264\217_\004\273\215\366"
+	.string	"\257\241\2558\216\314t\007c\213\246\202X\205dfQ\244Ap)\267E\320\226@k\t\001\265\313\314\354Gm\261\032\227\354\214c+\207\245\034\3669\254;\366\016\213\016\353MU:\261\241\"\323\345\364\"M<\230\fm;\355\246\355\261\365\006s\350\270\344\240/\223\302\b\021\231\333G;0\374"
+	.string	"\004\247L\037\006az?`\314\314\317O:\262x\211YA\027\375\335\315\262\"\343\277#\021\232\361\361F\301\"\323z\370\245!02\323@\355\301\037\032\324\030\374\312IA\213\374\352\024\312\317\337H\001\003\302S\273}\360\244\006$\t\260\022\221\223\221\252\027\b\207\001\226\241\230`\227\310\225Y\227\002\313d\301H\211ue\034\013d@\261\023\222\314B\301\260\314\332li\227\037\025]\207\361\036\256\336\322Vs\016\320UZ]s\207f@x\242\336I\356\356#\352\256\304;\025\031"
+	.ascii	"L\204^\350\206\0275E .\210\001n\300n\025l\001e\300\270l\220\003"
+	.ascii	"r\345\020\214G 1\261^\202{\025<\244\272\200\270\346\300\312b"
+	.ascii	"\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.93.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`\262\003\275\027"
+	.string	"\006\253\226J\300\224Q:y\003?&\204\024\215k6\254\005 0\307\317\376\302\374!\310\252\337\302\234\252\270-+\210\212\004\372\317\037O\346\360\360\210@\360x\0263M\305*\2010K\255C~b\263\241A\3114\007\303b#\255%{\023)e\n\203"
+	.string	"q"
+	.string	"\212"
+	.ascii	"\271\222Iu\232\301\022\377y~\362\273b\225xN\013\177F\273\021"
+	.ascii	"\b\005\264\224\244\326\037\214e]tg\270-\272\263E,m\311Q"
+	.string	"\225\022\351\f\233i\337q\327\263\344\250Jmo\007$\3516\260\2705\017K\303\026\242\246\241\005\242\353\020\272\236@\b!w?<\201B\326\356\026\262\324Z\311\235\017w\330R\344\006\222\005\242\343\020\272rG\270\355-\007\355l\314\242K\255\365\214\333i\330\257\366?\214\377-\177\237\b3\026\273\266\206\376\025lxq\334\254\027;\326hI\021\033}\ft{\0020\310\215\227|d\226\2727\364\227]\340\305mooW\350\005\223\323\255{\376\237\215\233\367o\227eY\276\213\376\363]\223\277B\371\255\311W\t\371)\223\2172\371\254\311?\241\374\325\344\223\224?N\276*\344\247&_\244|:\3713\344\207\315o\3463\363\027\300\250{\022\300Tk'\tV\307\013\323\252\227\006\224olR\301\346\3001v\001\250T\253\2027R-\232`\222\"(6o7\304\021! m\336\305\017\300&\332\342\202\255\3612ci0h"
+	.string	"\003Cw\322\206\215\360\205={\201\242j\\\276V\206\203T\255\365\300\027\306\306x"
+	.ascii	"!&\246\247\021$J\2025.\037\3254\2444W\206v\263\212?\302\272\220"
+	.ascii	"I\325z3\360m\261K\022\276$v~\206f~i\032\001\224\257\306\345q"
+	.ascii	"\364P\030\205\315\373-w\217\275t,\310f;8\262\330Ll\006\213Q\200"
+	.ascii	"\341\330\320\334\300b3\035\330+\300e953\330\216L6\203\221\377"
+	.ascii	"\377\253m\027=\207E\324\270K\243\333[\225S\217\b\375\322\250"
+	.ascii	"\253\203\376\273\372.\265\266\205\225w\b\035\361\215\315\373"
+	.ascii	"J\253t\206V\257\374\360\321\352WJ\253\364\340\221\322\363\251"
+	.ascii	"\211\022f\362\311!\251PZ\325\254$`\023J\023\030\362Cd\343r]\271"
+	.ascii	"#\\\212\325\252\336#\340\217\223&\233\325\242\217\037$\033\227"
+	.ascii	"_uG\250Q8$\031b\250\2102\222\322\202\264\001\240\002\031!\333"
+	.ascii	"9\020PU$SAZ\016\225*M\220\266A\002\002\351\f\\\023\274\037u\237"
+	.ascii	"\207\217\254T\236\242\216n!\216kLO\335m$\b\375&\256\247!\203"
+	.ascii	"\341\204i\0072\266\214\244\257\007\200c7\222+\200\203U1\3116"
+	.ascii	"@\301?\212|\003+\037X\271\022q\323\206\215{@\020FM9\315\200\022"
+	.ascii	"\356\261\374C\b\003d\353\236\351\204\242f{\361[\024\261\225\313"
+	.ascii	"~a\b\243T,\021z(+\004\333\300)\337\242H\327\327\273\032"
+	.text
+	.section	.gnu.lto_processRcStickPositions.94.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`\267\033\205v"
+	.string	"\352\266$)M \220\342\031\003\257\254\024\311\005 T\037\2608$\352\326\212\030\2046\255-0/8b\257\005\020\b\325\355#z\304\214\245b\006\347\300\241\250\241"
+	.ascii	"\310\022"
+	.string	"\020\245\022\213\234\356\363\230\343\026i\244e!\364\320\200+E\245\245M\244\2242\245\224\002\211\002>\002\225\002\316\335e#\334\322\316\242<\036\314\364\035[\254\341\245\262V\220\264\223\356&\335q\335:\353\253\277\273\314m\347\244\204e\327\364%#\341\356\360)\325s\334t\234\344f\322\323f7\341=#\327\323\b\305\356\b\341\373\276\"\214\315.\233\247mvm\235\266Yo9Nr\324T\263\343\266\226\\\323w\254\304\2200q\207\357;ej\226\231\214\315r\223y\260\247B\336\266\333\021fw\370\276/\324\007\341\265\327i\263\321\233\315w<\205\245p\024v\201\241\360\023\266c'\\\307t\334\204\247W)P\2340Q\302\252\212\004\325\324\b\251(\021!\240\236\234\232\230\226\224@$}\360\200t\324\301hYD4$\024\004\304\341\307\247\207gG'g\003\316\215M\2152\211<\032\335\226]\337\233\334\\\315w|S\224"
+	.ascii	"\221\222\004M\024\003\210\234\205\345\231\271\260\203\007T\307"
+	.ascii	"\031\313P\236\3309\331\251s\261l4\323\255\334\204F"
+	.string	"\r\347\316\232\227X\313\253\331\232\327\f\226\247Bk^c=k^'\370\225\016\034)\026\025\035E\016 '\022kp\023\210]\002Q\372L\343Vh\252n\260@\202%\243:\034lq\2362\2648\317\352:\325D3b\255\242\362\346\271\322\305\266\226>\311\270T\2311\036U\r\203\"B\260C\b\206q(.\375\304e\213;\211\221>\377\274i\204'L~Kk\321\017\265j\003>\263\254K-\3240%, `\320\342I\037\222\346\302\240xp\261\220\250\364\021`\207u)\315\317\214'\006\037dZ\372\224\342FQ\246\370\362\316\005/\242\302\304\211\250\314\371\320\2524%\321\256\001\237xk\317\n]p-}\312\271\220\213%\327\005\004Q\013\3133[\363q\326A@p\315\241\2057\377\201\003|\272\271\017\034\022\357Y\243\244\220\3415\3403n\255Q2(=\342<;E\\'\217\210\347\f\361\ry*8N^\337"
+	.ascii	">\205\254K\351S\315m\244O#\200\3174\257Q\032\255\225\241ur]\""
+	.ascii	"\254\202\246\001\237h+\317\330\021gK\237<\034\271J\3118<k\300"
+	.ascii	"\347\331\252L\023\346\245\345\332H\372\334\341\307U\031\230d"
+	.ascii	"G\003>u\254R:\356\002\275\334\350b\001)\203\266\233\243\333\260"
+	.ascii	"u\351bd`\316\242\320\253\r\231\214u\371\276o\222\354\313\277"
+	.ascii	"\351zi\ba\\u\255\f\332\356b\275\357\313\356$+kV\321\314\354\036"
+	.ascii	"3'\300\334C#+\336\346=1L\321\rS\363+\276=\323\177]\363\035\006"
+	.ascii	"\313\263J\330\216i\241-\371QV\376\361]\256\302.\177\275\270\230"
+	.ascii	"|\345\257\177`i\"@\221\237\374\237=\260\026\210\\\247\th\231"
+	.ascii	"\r@\300\333\211\374#\265\312\366\365\\l\374cgi-,FP@\201\266Y"
+	.ascii	"\243\207B/o\320\256\035\277\3022\310\325x\365A/\026\364\356_"
+	.ascii	"P'\310\335\3270lq\027\341\020T\250h\233u\217\n\271T\241]\276"
+	.ascii	"x\374(\273Y\334~\032\017\367\006\235\251\261^\214W7\305\267\\"
+	.ascii	"\033\r\367\2668\367V{\365bX\017\205\002\\\235\230/O\323\353\373"
+	.ascii	"\276\257\221\256\217E\372\360\332\036{^Y\024\237\342\305\230"
+	.ascii	"\233\032\353\373\371$\f\241\001,\315\313\027\335\375\350\264"
+	.ascii	"\207Z\024\337c\317\324\245\375(w\221\276\264\265m\274\t{\212"
+	.ascii	"(^\254\365c\277e\240\255Ta\377(\375\253\316u\261\037}{\250\265"
+	.ascii	"\361\021\020\311\0133\353\273\300$\320\365\243\274\276\277V\335"
+	.ascii	"\226/O\303\377\253\003\215\267\302\370\276_T\334wM\005\002\t"
+	.ascii	"&\230\240m\366\337\203\340\\\277\177\207)23S\261\245\2600\276"
+	.ascii	"\357[\305\355BG\251\200\273H\263lA\013og\263\334-\332f\373Y\251"
+	.ascii	"\337\233\225._do\336k\257\276k|\323\365Qa_\035\230'\212^\276"
+	.ascii	"\370:\356\002\333\376\243\314S/\377\037\201It\274\300\377\203"
+	.ascii	"\271\237c6\272\006\322\231\002\243\363\n\244\263\n\244\363\002"
+	.ascii	"\335\244\031\353*E\3075\243p\235O$\235M$\235K\270\316VG\347*"
+	.ascii	"\2443\t\2443\025\322y\n\351<\002\351,\245t\216R:\213P:\207@:"
+	.ascii	"C\3318?\3258;\271\316MJg&\244\363\022\322Y\t\351\f\242\3069I"
+	.ascii	"\351\374\001\351\354A\351\214\344:\037\271\316\035\222\316FI"
+	.ascii	"\347\245\353\\\204t&R:\017\271\316B\035\327\034\204t\006::s@"
+	.ascii	":\377(\235}\224\316=Hg\036\245\363\216\322Y\307u\316I:oH:\343"
+	.ascii	"\270\3167Ig\033\243s\215\321YitN\032\235\221F\347\243\353lD:"
+	.ascii	"\273F\347\366\350\314\032\235\327\243\363\033\235\335\rL3\314"
+	.ascii	"3o\376\305F\306\251\257\267Z(\247\203\372\245\2640S\366\006\030"
+	.ascii	"7\303#\226>2M&\206\340hc\002\321>\275\362\b\265A\264N\377\364"
+	.ascii	"A\211N\337\252\275\r\026\"3,E5\213\266\351\177\255\356\257\205"
+	.ascii	"\246O!\350D'\230!\242\304\364\002\27019A\331{\002\002\204\021"
+	.ascii	"p\351A8\013K\317v\371R\265\363\032DKR\346\221\035\245\315\321"
+	.ascii	"\370\340\201\006\266*!\222\364x\303\257\375\234\0209jf\265Uz"
+	.ascii	"\245\"\r\216\204Yu#~\204\211\310Ld.2\027\333f\225\336\312\253"
+	.ascii	"\257:\327a\006b\207\345\233\364*\320\340\352\004\257\274\232"
+	.ascii	"2\274\235I\357\203\307\205\312^\320\200\030}\370\226\236\230"
+	.ascii	"\321\024\363v~\370\036\274\277$Z\374\364\226\013\bz\370\005\202"
+	.ascii	"x\370+\264\"ir\320\032\035\275\261\267ry\003R\204\344\003\351"
+	.ascii	"\221\004\3738WxG\344'\364Q\nG\317\232\271\222\223\370\005:$\003"
+	.ascii	"\232\017\2523\037?\204\202\254\234\2476nT+_vs\214\254y\243\177"
+	.ascii	"\230\351\261c*\214a\007\207\032}\207W\004\353\r\332\345\033\025"
+	.ascii	"\375\022\205\242w\365\354\246\374\246\2339t4y\330\230Q\277\200"
+	.ascii	"v\360\310:\007\032*\207\217\"\266\2124M\364*\374I\364.\340b5"
+	.ascii	"\006\027j\225\2603hi\270e\212n\206\216\244L\223"
+	.string	"\237\241\3574\356\034z$\301v\241]l\370\230i\026\255\220\207\t=[\230X\265i{r\326\303\245\267\332\240/\3121\306\t\025A&<\037eF\353\231\362\367a\320\306\316\367V\013\364M9\226\324m\001\362\256\356\255\366\347\201\026\177\336\005D\363\306gb\230\241\343\363\312!j>\337\242y\217\241+\313\351y\017\204\362\321\214z;{\276\337zx=\027\033\245\257\272\341\243<\324Rp\\\253\023\323C-\317S\360\354a\320j3\b\317\273\200g\252\320$\025\232J\256,\031i\"I\276\200\223\344\314\315$M%\336N\266\231\"G\365z.\356\2756\334\002A\205+\035t3\354\362E\234B\030f\334\354\274\026\222s7\337Z\346&\\S\316\333\271\3636S\226P\277\236\313\350\013\033\231\315G\231L\353\374\005ub\b3h2\001@\347\277\254\314\0334\350\007\211p\304\245\311\325|\2243h\271\305\364\230\f`"
+	.string	""
+	.string	"@\333,k%\360\320\220E\013\206\225\006\272\031r\025> ]\2249\377\245\235\205\033>\007\347m~\3037X\332\315\343t\271\371#4-bp\2205"
+	.ascii	"\214\0166\320z@++FV\007/"
+	.string	"\264\2628\310r\341\242\205\317\006\375A\007\017\304\200\301\262\213'\030\034\274\320\212\341\301\013\027\026\270\320\202r\201\001\224\007\033\264\350"
+	.string	"\312\205\026\f\250'!~\361A\226\026T\214\027/\264\240\222]\215\325\265\243\333\023\027p\302\322\243\225|}\n\350\255\265\222\257J\002Mrg\255\344\203C\300\bso\t\365\323\272g\005*\217\236\214\003|\360\177\tI\201\237\213\b\333\333C\215]q\007\333\243\261#\212\241\261=\217\246\301\227\204\n\346\212d\324\240\006\f\025Y!M\356\241P'\036\207\211?\3418\272\304\233\260\372\022of\365.\nvy|74p\2476f\022\020\324\226\364\216\024 6fV\303bg\251\021\360\321\023\224|\r34\337\325Yh\323\001\230N\303jg\241\275U\001>\332,\226|\030\013\2470\314\314\267\266c\302}\240j\266\346\307\340\241aW\r\335<\246\207\204\001\224\260\276\357\332\225]o \244\243\241\031\213\313\023\221W\306"
+	.ascii	"\340\305\3775\207G\375\227\237K./\221]\021\216\n5\316\r\261\227"
+	.ascii	"\030\033x\361\246qn\207Y<\330\252\204`\256\310-|m\326\3222u?"
+	.ascii	"i;&\223\035!\357\373\266\223\231\331\204Yg\327MC\257\215\n\366"
+	.ascii	"\\<%D\007\326G9\251\345\360\235\324V=\007'\364\031\230vP\230"
+	.ascii	"Q\242\264\315V\275\373#\260\232\002\224\266+\022?\270\366PK\365"
+	.ascii	"$\276\303\314\3060\247P={\305\313\333\222\fc)\202\374D\021Y\230"
+	.ascii	"\242\370'\025\346\237\031 ?\264\023\037\315\321[\355\324_\360"
+	.ascii	"e\352\331\037}&\362\254\364=y1R\202\257\267\332\021\377\023%"
+	.ascii	"R'\350W\272\255\372\211\234_\273\225\267\252&%|\355V\332HH\240"
+	.ascii	"\307\334\263\202\346X:\007J\345\362Dn0e\177T\177\354["
+	.string	"\266\234\261\275=\262\260k\371\243\301\366\276}\3540\360\240\361}\271:\215\265\260\354\316w\006\224\355\355\361*\371\036w\232;_\245\245\fW\324\033\361\017\330U\3353)g\246\372\232J\022\251^U~b#>\312Yz\253\225\372\227\346I};y1zS\251\250\277`\215ze^\325\335\003\262\030%b\205#\233\367\2640\377\376\250_!D4\340k3c\350\302\374\342\355\024\3617Y\240\230`\232Jl\362\252\360\036\032\272\247\020\nx\277\315\034\32323\3130e\360v\206\370\030\210\204UB\003\234\251\231\003\202q\250\022\3610\322\342\016!\232\021\221\024$I\2411\"\013\020\210bi\232\307\324\003\022@DEKt\316\\IA\222JZ\003,\323\223\021\217J\256R\231V\271\220\241\340\326)\032\260f\350\235`\242\231+\200\034)\206~\245\036R\211\301W3\b\2376m\202\330\203\350\031Na\2413'L\234"
+	.string	"\214\350y\177\027\231\234d_\270\250a_^\367\211\241^\231\274\2462\0038\250f\r\262l:\t6G\243\253\302t^\233$\322O\002\357\354\206\343\025^\366\001\354\021\243ux\357\350\332\2570\306= ]\254\215;\021\307B\205\360C]B\211\270\365Y\316\313d\237\037iq1\260\202k\031_\231"
+	.ascii	"R\253C\276^\355]\263\036\203\024\276*\332\203\271T\3454\353n"
+	.ascii	"~\252\365G\003\301"
+	.string	"\303t\017\255\274c/\351\322\032\344\346$6`b\226\335\324b\353x\200;z\310\354\203\302\177 \276m\241P x\254c\025\271\032\331\312\2567~\360t\200\356H\027\023\257\376\325\036\251\212\361`\277\\\223\b_4r\"\027 \306\306\f\224A\374L\206#\356b\236vb\377\002\025\242\033\344b\331Q\243\037S\250\327\216\016\004>\217\232C\001\315\327\032\205\\wR\\/\341\364\333\374\244y$O\004\317\367\237\336|\354%\323\\\264GH)LLl\213\3343\302\357\376\031kX\375(y\362\006\343v\350\315F{\346\215\243sr\027\027\036[+-x=\240\356vR\00313\344\276L\244O\263\b,\262\002\231\2601\223\rZ\016B\221\370W\371\001\303\030\262r\210\217\233+e\372)/\254j5\001\b9\362\233 \3220\371\243\235\323u;s\203\241&\033k9\306\341-;\2508`#\324\230\020L?\356\354"
+	.ascii	"\252\034\030\201\250\377\355\372\341\020\033\334k1\"\035\361"
+	.ascii	"\"y\276,\025\216\002y\221\034\354s\234\004$\207~\363\252\031"
+	.ascii	" C\0200z\262\245T\033\341A\034\224)\203\013\354|\244\346\347"
+	.ascii	"B\037\177\213\327e\023\342_\276*D\202\360@\3627\301\344\222\240"
+	.ascii	"tH\034\006\314\226z=\002\250\224\231\n\303\026\354x.(\202\233"
+	.ascii	"\350>\307\3516-\377b\323A4\322\274PC:6\202\351\030\004\274\013"
+	.ascii	"\006\216\247\326\026P\343\211\202\004\351\023\374\274\364&(\333"
+	.ascii	"\204\036!\377\224\020\353W\326\016\013\204\346a4\205\351\223"
+	.ascii	"t\315\225%\373!3\235X0\202\370\r0\377\353\373\0253,\003\235\206"
+	.ascii	"\247`\224\270\240P\370\021$\336>*|R&G\366]r\334\202\206\031\\"
+	.ascii	"j\002\222\\!%n\322\270\323\315,8\360%\003=ZXo\007\260\031\bf"
+	.ascii	"\352\367\250{\353\327J\260H\305\364h\312x\235\254\372\205\372"
+	.ascii	"\320\312-\330H\332\226\033\205Z\372\3516H\257w\260\360\372\221"
+	.ascii	"\213^&\267\306\254\327(\021\024^\373\263\320\340D\375\264\035"
+	.ascii	"h\001\313\316k\243*\020A\201\\\331s\326\235\360\271\243k\342"
+	.ascii	"\2031K;\237\212\230\300l\335\371\007\372S\370+\276w\214\364\020"
+	.ascii	"s\356\304r\"$Y\350yA\270\025cj\321\231HM\324\341\002\376\232"
+	.ascii	"\"\032/\t\216\214\031\276\254Ss\013;\252TM\341/r\257\355\001"
+	.ascii	"\321R@\003@U\335\214\020\231\f\226\256[ \346\357\264'\346\024"
+	.ascii	"JG\242\224D\256\214\212\322\365\336%\242\324\001\225S\031\241"
+	.ascii	"\315Z\250\030g`\f\342j\003\237$\270\013\303=A\")P\302m\331\\"
+	.ascii	"\210\362R\321\261n\234;2|Z0\312\240D\242\222T'\251)\271\225\327"
+	.ascii	"\017\345\005\021\377\370y,\314\277\370\300W\021\256\362\276\315"
+	.ascii	"|\315\350\261\230\371T\343\036\300J\205\3650\314)|B\021K 2p\202"
+	.ascii	"T\035Z\021W\257b\323\244\240\016;\036Y\201\324\007\002-\001\204"
+	.ascii	"\037]\f\037\031-\r\252\026\202\241w\364\026x\211\312\025\330"
+	.ascii	"\307n<\331\325T\"{&k\370hZ\255\324\336\363\374\r9\332\325\375"
+	.ascii	"e\375L\323s\b)\331\335\310\220p\020\245p\267s\005\207\316[\355"
+	.ascii	"\312\273\"\177%cB\325u\225S\013h\316\326\232\\\021he\005\035"
+	.ascii	"\225\214\355\035\016Ng\b\275I\234*\2272X\\z\255\b\032\364:\365"
+	.ascii	"2<Q\r\360V\027\237J\322\224'G\253\305\267v\f,\320\342\030\271"
+	.ascii	"\325xW\342\360\276h\225A\201\344\213\2729c\236\225\363\032\243"
+	.ascii	"h\001"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.95.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\r\r"
+	.string	"\026\233\\B \217\223\016\313\370+\230T\246 \312"
+	.string	"\276\242\234v\373G)\004\200O\\\372X\244\033\260m|\335\372\r\365\362\344\330\302\027\311\237k\024(\300"
+	.string	"\300L\036\021\237\203=\022\001#%l\207\020\262\367\2262\245I"
+	.string	"H"
+	.string	"G"
+	.string	"\001\362\233\230O\t\371\332\305`\302ew3\314\261\016m\373 \036\002\344\320\3438\224\"\212\005\022\223\314\356b\004. \036\276o\342\241nx\350\031\362\277\362\367\002\346\004\251$\362\254\026\354\256\223T*\271\365\266\013\330\336\260_!?\324\264j:_\372"
+	.string	"4\032R\314tP\273\024\272\231U\001_<\374t\373&\037ur\352[\262\237\300\002\345\202\213\335\345\034\372\200u\026[sx\033dklk\332\347.\002t\025\t\206\273&-\\v\271\f\033\260\016\003\235V\212\240e\364a$;GUM\260\342\232z\222\030\242\354>/\241Y\273\273\341\2178\211\b~\207C{@\362\244C\037$\036^\217\372\006\005\314\213(;\233\023I\315`\377\355\356ZO.M[?\335\325U\376\370\224!\034\231m\f:\036\320\323\t\351x\3164<\017\264\355\363\241e\034\331\206e\016\260\217N\207\007\226m\036Lc\2005\b\r6\354\243i\033\246\341\366o\365\304\266/\375\312\037\f\023\221\216Xc\356T\264\364\322\263<[L\243\230J-U\220\032\311\2102\020"
+	.ascii	"2\241\251I\343\365\204\337xa\271\006\311\304\004\3105\212\372"
+	.ascii	"pPgf\265\001a\370f\257\253\024A\022\250\300\202\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rcControlsInit.96.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\215\007"
+	.string	"\362\31645Po\322\001 /P\253\354z\b\300\231\201\207P]\334\374\212\252\316=\367\233%\210\323\231e\021w\214\276^XPU3\306\330\022\353\025`\340\316\264F\210\224)\005~\033\353\001FO\007>\205\027\335kp\035\316B\345^\264\334f\300\020\202!:\017\204\321i\264\375\264:J8\331>\nr\252\257}\244\302\367\260CE\371\025\346\224\2222\226k\352A(\343\223/\006H?\002c[\022\371\354JP\022\331,\024\363\224\366\004E>s\226B6\220b\266\206\245n\330\237VG\366\323\371\3643\002&)\234\225\335\213\027\227\335(\224\017\333\327\370\262U\256u\354K4B\244\226\335u\312\361\353y\371\007y@&\302\236\031\204\335uf\"\214[o\273\300\266\201m\222\n"
+	.ascii	"3\241\227\0378\310\034[\312\374\001\013]\303\021\206\360/\343"
+	.ascii	"\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`H\005\225\025"
+	.string	"\266%\212G\220\226J:\200>\260.1\177\035[\266\206\353?4\270\211\"\020\2609\241\253\032z'\003\001\341\206\200\373\2261'\177\035H\331+\002j\021"
+	.string	"\300\003O\311\025\274\234Y\255\310\n`\0040BO\341\336E`jI\223D\246t"
+	.string	"t"
+	.string	"z"
+	.string	"OQP\"\204AG#\177\245(%\246\250&\250\246'\020\302\022\301o\275\002\272\0212\330W\033\177\372IF\237g\001\036\013\371;\020\262\347p<w\262\363&\244\316\331\310\234\257\235\r,\253\314\327G2\342\374\254\2719\023\322\346g\\,\026\2135\375\264\361U4\357\321\353\023G\376\267\2263\347A\376\037\255\312\260\277\1772\027\313+\313\262,\320?2\376oI\nre3<\366-\367x\374\241\327\312Co\212\016\3756\016\375\270\r}(\032\372r\031\372s\030\372t\027\372O,\364\243T\350\277Q\350\273M\350K\221\320\237\222\324\257\213\320\247\002\241_\345A\337\316A\377\256A\377\n\203~qAo\251\240o%Ao\025\202\276\222-\313\362\2479\320_\262H\367a\340cG\377at\262\242\227\021=\310\320\205\b}\b\371\237\b1t\260"
+	.string	"R&\341C\331i\270?\265\266~\224\235\352\017\345\021\347\216^D\263 e\241)\254@\224\227\314 \312Ku\027F\235\232\020\345\020uG/\270\035@\312=su\342Z\bQ\2269w\335\304\260\206(\313\230K\216\021\261#\242\034c\372P\216\251@\3120\347\n\240CS\021\244\fS\327f\355\353\305\fe\227s[\334\302n\024Q\016p\356"
+	.ascii	"\"\035\\\021e\246]\256\273OZ^Y\226\245\321\013\373\216^xs\324"
+	.ascii	"!\216\n6\\\002fW4\224\327\253v\235\3733\353\262\241\2744\316"
+	.ascii	"5\342\312\2729W\206\250\205Cyg\324\r\2366j(\257\f\363ls\267\r"
+	.ascii	"+\315G\031\205\271H\304\0259\224\251\314\005p\266U\354Q\246\252"
+	.ascii	":\224\247\206;\224\247\314\375Y\235\030\017e\251\263GYj\270c"
+	.ascii	"\375z\353\241l\242\256K\221\032s?\312Ouq\002L\250A\020\203\271"
+	.ascii	"\220\204\"\223HAA\222\0030\003!\3324\006\021\260$\246\220A\302"
+	.ascii	"\215h\220\004\362\001:5\240\3147\344n\340\002:\236+{=\226\276"
+	.ascii	"\220\244\216R\340\236\344K\317\252 \202\235\304\203\352\t\335"
+	.ascii	"s\261}6\272\347b\373l\244\217\336\260l\366\223\016\374\326\023"
+	.ascii	"\344\336\200$\336\201V\221\332v\343\241\360\365hU\353\214\332"
+	.ascii	"\274\3356\251\310\022\233\2306\367\262\306\320M\334\370f+\261"
+	.ascii	"\3052\004f\253\3248\377\017"
+	.text
+	.section	.gnu.lto_.refs.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\225\006"
+	.string	"\262\316,1`M\222\016\300D\321\200\2543\235\277\027"
+	.string	"0_\0012t\b\202 \b\002c\350\350W\261t\276\fd\213la\207\265\266\265F6i\204\220F\266L\001s\260"
+	.string	"\tp@ip\203\023\n(\ffpa\200\372i\001z\331\227^\214\327{\221\275\026\371\255\260|)*\275\023\225\257D\n\312\211\373MJHFDB\246\037D\372?<\336\337\301\361\372\033\331\327\310?C\372\210\327!\336?\344;D\275!z\006\351;Q_\350+\270\236\360:B\366\203\354\006\371\231|\214{\332#\033\352\274i\257aoY?\265\217\330\273\366\215\375Z?\320L}\325\210\367\313\t\f"
+	.ascii	" \004\304E\211\252*n\251`A\205\200\270 <\210jd\006sE\3156pY"
+	.text
+	.section	.gnu.lto_.decls.53f77b0f781b4a35,"e",@progbits
+	.string	"(\265/\375`\3535\305\350"
+	.ascii	"\252i\245PX \fY:\215\001\326\217V\321\245O\016\263\375\003\025"
+	.ascii	"\313\206\035\f\213*+\325\037\321\361\002\034\221\205\264\262"
+	.ascii	"\352\324b\334(\271`81\366v:\n\002\232\374\326\\v\006?\315{I\304"
+	.ascii	"\234\340m#\234p\217\217\016\032[Z\f\3262\2577\365\233y\243Lk"
+	.ascii	"\333\215H)e\nN\004\025\005>\005xTanO\227\354i&c\212O\r'L\034"
+	.ascii	"\205\227M\246\234\240\206\307\304\306\274a\362\344\334\\p\301"
+	.ascii	"+0\213K\206\223\367\216\352\302\364\301U\227\354\2669=\240\b"
+	.ascii	"\330\007\314\004']\264\333\226#\002\\*\310a&7\357\222\341$\233"
+	.ascii	"\373\305\317\007\323\256\216\247\303\314\021\254&/\th\354a\f"
+	.ascii	"=\316A6\202\275\301~@\362\\\320a\215o\370\034\343\030\200\223"
+	.ascii	"\2632\254\177\2760\364>-\364>+\364>\032\350{aPlC\313X\263\302"
+	.ascii	"\302\372\2759\364=4\364=%\350\341v\240\357\325@\177\327cB\337"
+	.ascii	"3B\337\333\350\365\n\350u\027\364\232\r\275V\202^c\241\327O\350"
+	.ascii	"\265\022}\266C\237\267\240\317S\320g'\312c\204U\334'"
+	.string	"\017>r\033r\001\205\365s\027j\302\316\273<\276\347,\364\331\006\312!\027\241\307o(\bO\364x\bz0<\003=\336\350\321\356\033\272\341Z\360e\200\022\231\211qa\r\3466\227D\360\272x\271r\267\356.\367&\272E]\222\346.\335}j\270_.]\216\241%\254\177\331\320\024\354}5\370n^\336\325\340\303\313\213\301w\2008\237\337.8KD\2220\301z\347ZPA\303O\253\314\306\r.Wj\342\270$\223X\377\003\025\035jkW\314)i\250\212$<\344\3028\360\340^\271L.Yn2\177K\254|\310\225A\301\272\\)\\4\034\245\316&*\352\301\334\273\231\345\276],\027\356j\271V\356\226\373\274Wn\333o\225\353v\334\334\233h\357\375k\366\373\374^\271l\027-7\3116\321\220[\007$N\261\264\273\275\233\035x:\374\234]X\224\351\350\313]\f>\234[\205\376\306@\177\213\320\237"
+	.string	"\3350D7"
+	.string	"\001z\317n\224\373\314\340J\371}r\315\336S6w\023_\341\205!\301\372#\240\277\031\370r^\336\315\300\367\t\240:\027\203\017\223]\f\276+v\233\334\347\005w,'\217\344\334\224!Rf\f\326\207"
+	.string	"\372\353\344\002Pn\017\316\203\376^\340\273y\367\002\337Q\364m\027\003\330\0059M\031IUK\224\370T\330pR\301\372W\311\177\2357\311\307\360r\357&{\357\f(\022\030<1X\337}1\370t\256\005\337=\342\363\213\304\202O\311\251\271s\036pUU\004\353|-|]\256\353\225\217Z,7\330\336\315\235\237\221(T`X_/|Q\270\315_\257\333u\016<\270\r\321\346\332\273y\275\364\336\312{1\300\271\027\203\336Y\017%\022\237>F\337\274\030|\350\265\340[\202\361\232?\247\340!2\363g\326\002\036\370/\b\376\033\374o\b~\374\001\037\030\013\003#\320C\004@W?&\001\033w\370\300%\320\361c\0249~\234\002\034?V\3360\262\2725\214Pa\027S?\246\362_\0162\370\257\020^J\255\377\307N\202?C\340z\360\337\b\334\03230\024f\300\323\217\037@\343\177\002x\376["
+	.string	"\343?\001\376\254A\t\001\350?\347\374\177\373\217\345\377\225\377Y\376\303\375w\373\257\345\277c\377\321?K5\341\031\330)\213\360_\r\374\270\367?\377\372\246\t\313\270\340\307\006\370q\001~\274\341\307\030\374\230"
+	.string	"?N\300\177\277\316\300\177\351\376{\367\337\025\376\013\346\277_\376k\367_1m\377\235\373\257\334\t\377s~\r\343\307K?~\361c\244\037\253\370q\321\217\207~l\302\217O\360\343\024?>\361\343\366\307\353\217\217?&\341\307\304\037\253?\016\3768\3751\360\307 \370\361\210\037\207\3701\210\037C\340\307 \374\270\203\037s\360\343\236\037g\360c\235\037\343\374\330\367_\274\377\216\371/\331\177\271\376K\344\277A\376\373\343\277\314\377\362\370\357\216\377\342\370o\325\177\245\376\033\365\337\247\377\316\370o\323\177c\374\367\305\177\223\376\213\364_\025\377U\3767\371\377\313\377\272\377\232\360?\204\377I\376\243\360_\024\374\327\004\377-\341\277\355\177\331\377\"\377k\374/\361\277\224\377\252\377%\361\337\013\374\267\373\017\346?\227\377[\376/\371\257\344?\006\3767\377\223\370\237\366\377&///\357\357u\340\257\311\362#"
+	.string	"*K2\330?\223\361\324\314\220\302\320g%&p\221\"\202uN\202\032\335\024\311`f\313\221\270\234$;G\2607\021n\361\344\344\005\353|$#yv\346\257\354\354`\271\2672;s\310\354\255\314\271\027\203{1\320E\250|0\361\351\337\bA\263\227\317s\023\373"
+	.string	"KK\303\372\346F\206\021#\231\353B\300\t\224\\N\023\2519\204\253\347\026\004\213\t\326\277Q1dH&2\263\367\236C\200Y\362Fi\311\221\246\255g\"x\313\215\026\025\221,\254\263\026\336bc\243\312\216-\272 A.\032\207\245Ry"
+	.ascii	"\255/\224\n-\252\310\355\307\217K\306"
+	.string	"\263L\322m\360\312\352\215!i\312\222\202u\237\031+3\363\336\313\031\034\204\224\345\2001\307#\373X\302\303\b\0260\3646Ax\360\270d\367\310~A\203\224tC\273\333\033M\203\034\273!5\256\260\276\315\221\216\035\227l\203\263%1\350k\266\334\300q\275\364\2063\251\0326\3645dT\331F\256\272u\033j0\267\322\326\3405J\320\327\024Y\332\310R\227\f\335\314\237X\221\r\271\232,\36457j\324\310Q(\217\231\324\005p\\Q\357r\343\306\244\245\306\305\323\3573?e\245\002\262\226vu=*+\037Uef<\363\214\013\206\303r3m\0202\247\025\344no'\rn\206<\2311e\245\351\367\231\233\362\366\331[Ic\203\326\027\316\225\032)\3109YZ\3121\256\323N\322q\350ZB\265PYs\022#\237@\363\304lb\004\353\f\303&/\213\025/\256\314DS\365\342>\363\213\253\204Cs\303\260"
+	.string	"\310\222\223\006\250\013:\271&\r\026,r\222\221\257_X\332\t.r\213\347$\237\227\025LY\260>\230\213\246\275\2008\335\300\3724\033\375\355\272\031\351\231\221\256\027\317N\316m\220\245\324\324\3403q\3503Q.z6zf\243\254\302\002{\357\013D\346\260\310\356\266\223\023\207\032\256\260-jXg\025^6\333\202\231, T-\210\240?\376}[\251\264\367f\3525\267\322\220\315o\357^\016\377\315\315\267"
+	.string	"{wh\367VFi\253C\201\214)\2376\354\367\332\366&\232JF`j\211h\252\351\3109\265\223DX\311\035\245=\225<r\356\275\263\211\210\222\"\226{\347\310\271\227v\221\333\322\335\315\251\344&Z\356\235M\264\225\033\216\210\246\226\216\234\312\245\235#\347\324\322vNm\235M\244TB\"\332J;\33395\267\235\313%\235#\347r\351\3109\265\343n!]11\235\265Y\355\270_GD\333E\022\224RI\247\355\250\271\334p{_0\243\255T\200\275\241\226Jp\312\246K6\324\346b\250\211ry\233ICT\313M\324v\024d\271w\220!\240\235\324A\262\331\266u\334\266d\025\324na\264w"
+	.ascii	"\222\366N\336\335\266\367N\356\275\177JP\315\275i\350\0341\223"
+	.ascii	"\222\366v\342I\332P\3112\243\2751\330\026\262\245#'\325"
+	.ascii	"\322\247L\211\223\271U4\223\227\271\341\246\224Pg\362k\267\370"
+	.ascii	"\2022\227`\320a\335l\326\220E\205\235\200uN\346\310\340b\365"
+	.ascii	"\005\353\317 \2418\217\347\327\303I\024\271;2\030\257\004\272"
+	.ascii	"\035S\342\310\204\301bp\023\213\037Lma\354\360\n\250\2250Vib"
+	.ascii	"v{\346\355K\r0\\\367\345\007\346J\330\024:\r6ioL\266\026\007"
+	.ascii	",\327t^p\322r\201\205\273\314,i Q\336@1\027\254\302}\342\270"
+	.ascii	"\353#\313\346MV\312X\033\343\340\313\341\340\303Y0\334}\376\f"
+	.ascii	"k\231!jn\347\325!%\251#\nE\361\273?{\303r\206\207\366\004\353"
+	.ascii	"+\330\312}b,\330-\nf\033\243B\302X0\025\\\205\352HC\207\0164"
+	.ascii	"t;h\370\364\321\025\350q\225;k`\264i\231\2015\007>\307m\276-"
+	.ascii	"(Ra\260>j\204\256\361\334\340X\n\261\201\365\177]\320_\263\024"
+	.ascii	"n\035No\357%\0315<\345>q\032F;>\273jN\234\206\245\334\272\333"
+	.ascii	"\226c\353\027\3142C\266\366\336\035x:\3440\3165\271$\350\177"
+	.ascii	"Y\350\177<\320\377\254P}-@1\313bc]NX\227\341'\367\211\3150\331"
+	.ascii	"m\356\335\3740\246\263\207\260t\371\230\341\347\316XPp\301\264"
+	.ascii	"\265w\223\247C\007\033#]g+|\372?\031\350\177\033\275\257\213"
+	.ascii	"\22332d\270\314Z\3049_ha\356\215\2630\027n\342%\230\007>\202"
+	.ascii	"\225`0\354\304>p\023\334\0033\261\030\366\302a\370\007F\202\201"
+	.ascii	"\340/<\004w\341\"8\t\326\302Bp\020l\004\243"
+	.string	"\200\2670\026&r\237\230\t\326q\274\003_\225-Q\301C\230\350\216yw\313\220a\336)\303\370\320\030+\302H[^\344\270`\2541\361N\212Q\213\221&Wv\311\3409\225.\031\034s\212\211\007M)\210\271c.Y\031\037)\274\024c:\235\320\230>\230\t\266\3029\252\274\230\001\277&\021\347\325\f2\032\254\267\036TN\231\351#\342\374\241\244\311HF\025/x2\364\017\354\0265\327\326\213\241q4\205qM\301\032\006\214\314\305SF\327K\313\023R\005\254\267\324[\322[?\256\242\334\345+\031cV\260~\006\034,X\364^\360,\223s\035\254\321\211\241q\027\245\366\226\245\305{/z.j\242\254`qa\335K\312\221\002\306\006Y\030\364`p\231\fyW*\340\220\220< \245\025dK\207\021\222\204\006E\205\212\254\342\036Q~Q\273\303i.\306\312\254zE\275\"7\257\250\255\232\031keF\260>"
+	.string	"\242z\311^\2627\324"
+	.string	"%\035\024\246\361\205mGO\371\336\020M\031\2439\2611\033l\271\302\312\303\303\323y\037\226\334\320h\234\324\236pe\256\363n^\225$j\370\016\310T\321\027.c\306d\256;F\347\025u\247\233L*\264\\\271\273\323a."
+	.string	"y\262\002\222\"2X\207\261\213\022E&\212\235\335\021\257\250\255\036\225\263\n\312\221\272\272\034\345\346\025\005\246v\226\22457\247\351@"
+	.ascii	"\222\325\"\006\224 \232\356\256\013\033\025\fOqq\332\213\006"
+	.ascii	"\224[\224\2660\020\2709)]\256\275h\035*\304\340\342\265\202\311"
+	.ascii	",\212\013\027.\231kM\371\246v\347\263\233:\213\202B\226,Z\313"
+	.ascii	"\205\262\\\004\351\315\006\334\265\026\f\346\027\206`\301\242"
+	.ascii	"\251(\335\324\266zMI\232z\340Y\371\255d.\236e\3662\345\025%\325"
+	.ascii	"\025\246J\025\375\365\201\311\210J\210\223\217\2655ME\310\262"
+	.ascii	"\314\220\273\n\224VL\266k*ym\007\020\247\205&\261\35311\235\226"
+	.ascii	"\337lv\362\310~\361\033\233RD\351n\0379q\250\371b\361U%\312u"
+	.ascii	"\332\365\024\016<x\334\326\2207%\326:\205k4\247\265'rR4\032\020"
+	.ascii	"+\247\326\035\372\005\240Gd,-a\255\317\036\367 q-\346\260\326"
+	.ascii	"P~\346\224\345\016\207"
+	.string	"\331\331\250\254\fa\255\311t\331}>M?9\316\023\025ais\350M\270O\363i'\327O\242\254\246\2644a\362\366\304\274\202\276\202\265$It\030\003\224\312\f\331\312Y\252\223\221\004v\035\326\373r5\227\267\004JJy\267D+\241a*\303\252\303Z\tv\313B`\250\0315\221 \311\\S?\320\266\264\221,I\025\360\360\362\322_<@\350~\240\241cG\314\310\232\327_=#O\232MdTv*\214\215)RDw\3710a\221\331\262\361\022\343\326\305u\335u\003&I\033\n\332\210\217\355\005\0311;N\320\017\321C\364\326\005\257#WQ8\340X\271\261\202\205\326\272\336\312\031\022\302\303\t\366r\263\025\207e\206T\220 V+\226\030!\332a\221\365g\351\037\027\213\246\rLN\205\233;\251((_t\\\373\320AG\365$\327\033z\352\302Z\367\320X<\256v\350\244\300t\355t\237\232I\343\340"
+	.ascii	"\004\277\335\251\340\005\353\0337X\354\262$\301\372:J\320*M\245"
+	.ascii	"\245\364\224^\336\247\266\322Q\3273\360\320\257\232\215\353\205"
+	.ascii	"\343\263zr\301tG\203\006\224\023\363\232=\315\320V\272\206\325"
+	.ascii	"\013\027Lw?&C\262H\331\350\353d\241\327\211B\257\023\003\275"
+	.ascii	"\316\021\372\034;\3649U\320\336\265\340\3232tS\214\023`\3444"
+	.ascii	"\321_+i\245\314\274:\233h\210\215\214\311W\2217,}t\355B\037\345"
+	.ascii	"1&\214f\254P\365\310\\\224@\t\303Z\267\320I,\364\n\215\224\343"
+	.ascii	"\224w]\224\247\215D\030\301\021\013$>\344n\314\306,\3155\233"
+	.ascii	"4se\300\236`\255\2074\221V\352\244\336c\360\360\362\346\321\331"
+	.ascii	"\233\352\216\314\206)FWS\226'\317j\367\231\237\3441>C[YD\001"
+	.ascii	"Z_4\\]`l`-\0067\3712We\n\372\313E%W\341\"\347\226\333\270\266"
+	.ascii	"|\300\222\263\f\241\"g%\267\341$w\366\256\312_r\230|\227\355"
+	.ascii	"r]^\341>3\230\f\367\274\226\331\316\223\301\344+p`\262\226<w"
+	.ascii	"\333\234t6\321\323\213\\\007\232\025Sm5p4\225\307Y0td\001\024"
+	.ascii	"\342\3442\335}\346\271\3634w\236\313[\262\227\333\346\324\334"
+	.ascii	"L5N\252\330Ai\350pCw\005\356\311\347\245\013N\223&\216/X\347"
+	.ascii	"\270\237SSZQ\021.\367\231U@\301l\225\215y\\\215\224\035TZ\350"
+	.ascii	"q\262\320\343T\3457\024\213\\\r\266(\36484\320\343\304@\217\223"
+	.ascii	"\204\036\347\250Jn\3539\247\324\261\265a+k-\206\260>\016\021"
+	.ascii	"\2129\\\013\276\234BN\313)BvClJ\b;\250\210a\255\321p\232\017"
+	.ascii	"f\222\024\0348\254\260\257(=\261\274\272\031X\3473\324\350\306"
+	.ascii	".\003\232\032O\033OX?\237\375\331\013C\231 \017o\005\254\263"
+	.ascii	"\231\3173\224\032\266(r^X\333\260\241\277DnF\341y\f\205L\306"
+	.ascii	"\301i\303\330\240U\006\245\001:\267U%\205u\223h\357\315Sctc\314"
+	.ascii	"\035\326Y,;\311\317\177f\306\254\205\025\250(\350s\023\232\034"
+	.ascii	"n=\204`\215s\3303\223\177\346\307\245D\024V\206>\007\254j\202"
+	.ascii	"\024\305\324\230\022\2405\212 4\036C\030\217D\226\270\341@\036"
+	.ascii	"V\265(\304b\320\002k\324 b\211V\035\352\024S\343\220x\202\250"
+	.ascii	"\006\325\021\330\021(\326\236\013Tv\204\372\223\262Eb\372\243"
+	.ascii	"\343;\220\207\236#1\203\317(\224bm},\361Fhah$\246XK\350\200h"
+	.ascii	"\325!\206\003y\b\300\232\266$. \207=G\342\005$P\r:\002\001I\210"
+	.ascii	"P\201\f\30755\201\3018B-\n\215)P\002\204D\021tX\265\030L\021"
+	.ascii	"\302\004\261\230\206"
+	.string	"hU\022\301`\232\301H\\[\266G\025\n\025\203Fb\317\312\n\365"
+	.string	"\240X\0242\032\217\306_\013\364\225p4\376~R\265\250[\225\rR\203|i[TE\254j\253\006\035A\244(\"\221\251\005)~\210\3551\004\241\021\304\220\370s\"e{\202?\031\324\"\361\347\270\212\240\266\351\b\352\220\347@\036z\204\306\t\260#\324U\250M\325\037\235\003y`\203\032&\300\201\021%B\200"
+	.string	"N@D\0060"
+	.string	"\f1\002\220\304\210\035\f\0314\264*\273\252'\324\025x\201\005V\200\226\220\246\260\331Q\207-\233\376"
+	.ascii	"\201m1\275\260a\007\203\005)\220\307\020\026Zd\317\020\0314\n"
+	.ascii	"Q\240U\331\032\343"
+	.string	"\017\356\261@\233\026h\034\"{\306!2\253& \262\232e\325U(L\177)\220\307\240^[d\376M\212\265e\211Cu\004`\006\241j\034\022\213\351O\250\262B\232\375=mS!p\210\364\200\263\246@A\rD\006\251%F\030\"\007\320\022\215#p\202j\361G\025\321\252\303\0139m\332\2624\255\205\003y\030\022\177\324 bk\024\"@\315\315\006\036J\004\255\3015\247\306\307C\233\252Hu\204\366\030\302Qx3\303\201\007\026\003\"\202k\r\372\301\003\273\322\260\301\021XV\r\036Wd\206\034\024k\332\246\"\202\253/Hm\331\024$0\250@\035V\250M[\022E\241`1\rf\020\032\323\240\240c\210\340:Cd\217\" A\030G\250k\252!h\005q,Q\301\203 \326#\005X\022\202\304\226\304\320Hd7\300\022\001\360 qU\215\352\020}\007\037,\340\003\020P\374\016\202\0036p\300\006\276\203\340"
+	.string	"\037\037\007|\340\203\376\003\237\334\266$\260i\211\237 \215\nT\221\252j\302F\005\262\303\264H\001\265h\"e\211\".\264*P8\002\305\321\304\257\005r\360A\250\204t\315?\252\020\330f8\220\207U-\252\301`\332\303\256G\326\250\262\005@\366X \033D\\K\210 4\202\260P,\036W\315\252B\305\364\204oh$\006\255)N\320\232\002[v%\376"
+	.string	"\215G`1\r\002\217k\212!\206\024iQ\025\002\203\326\224%\nw\016\344\001\305\3323DZ@\261\322 \323\240\340\332[U!\361\304qE\nU\024k1%\256*\273\203B-\"\205D\374\024S \032UH\\W\365\304\021h$nh\201\277aZ\342H\004\016\205\212H\236\235Ve\325Uh$\232"
+	.string	"\266)\013\f\022Z[\022T$+"
+	.string	"\033\265\230\006i\332U=a$\006W!1\250g$\006\241$\004U\240 \2124\b\315aC\024\323\023\306#\261M\213G\344\252\266\306\021\3015\003\253\252\353P\025\241\026\207F\020Ai\210\023\310\237\n\204\305#\020\253\256@%\3246\bB\025\0361\260\022S\036#1\250\262B@\024kMQ5\032S\240 \020\205P\nD\221\006\345\260\353q]U\f\276Ve\177~\2165;\032~~\216\255Pp"
+	.ascii	",\021E\n\034\n\231P\205\255\020\322H\314\240\"S\264@\365\004"
+	.ascii	"\261MO\020WUh\301zl\203\351\017\360\330\n\245\300\241\221\b\324"
+	.ascii	"\036\217A,0\270\362\b\217\304UE\002\177\220E\240\032\224\256"
+	.ascii	"?\300\340\312\002\211,\273j\370\035\310\202\037\221\352\332\323"
+	.ascii	"\036\217kO\r\013\034\022\177\214\307\020\">\264@Cb\361G\247\204"
+	.ascii	"c\021'G\370\241\230\256\255\220j\234Q\213m{\\\201Z\240\360\203"
+	.ascii	"\320\230\232\020\246\252\320B\t\307bM\013\374\300\007\005\032"
+	.ascii	"\022\201\200\302\017-1\210X\264i\201 \264F\242\320\357>>!6l "
+	.ascii	"\204\n\240A\017l\361\270\266\306c\020\030\\{\202?=Fb\032\324"
+	.ascii	"\023\\\331\036\017\002\020~P\205\307 \240P\005\n\266\304\022"
+	.ascii	"\330\234\342\361(\001`/+\f\207\214\207\216\033\3144\2346\257"
+	.ascii	"<\035>.\232\257\251h\214\030\326\327\335\024,H=\250\364\316\304"
+	.ascii	"\2229xh\271\362\202y4\305\331\330A\367S\213\321\374\241#\214"
+	.ascii	"M\217\"a\226r\350"
+	.string	"<\0341#&u8zCJ\264\270\200a}C\205\004\350ZXYE\321\340a\261\335Ue\256\260\0319\250\250z/\222Duu\301S\267N[e=\215`\335\263\321[\276'\365\236\024\356I\345\274<_\327\225%\276\250\254\254\302\253a\005\353&\227\315\213\027WK\250\255\233\271\"v<\236tW\016\334\322\252\005\215\035\204~\250S\222\244\221X:\004\025c\314\320LI\232$\215\001\363\024@@X\\,\232j\254\236\017\023@\322I4r\022&\231R\312\220\210\210\210$IRYv\003),0\351n|\324iDsmE\234\212J\203F\352\253\2046\270\344\277{\221Zw$\224\rj>\370\237\206+%b\272\256\207\210L\202\204\250\365\272\315\300\\(\003{\202@.\356k\260Oz+\007\226jZ\274[\262\237\r\356\216\b\375q0\343\237\246<\374\026\243\333J\345\261\310\303\313\311\377* \234K\325\\"
+	.string	"\351V\206+\242\001\351\235\220A\351ui\267Z\025\334\333\nH\365\027\377G\206\251\300\214\335\257\026\366\022\372\373D\216\271\211\267 \227]\315Ya\370\023A!\016A\261\305\263\250\001\245\341\310\311\226yy\033y\334\373$rq\326N\224\257\202\036p\"3\374\210\tq\306\003\247\3336n\310.\250\330\245+\335\205Y\246\016\326!\256/\r\266\203L\360\370F\247\024\315P\030!'\303RR\035\337\273N\273l\213\336i(\002\031\260\235\277\257v\303U\2636\001\034\017\027\207{\246\334>jL\210^8+\343\320\303e/ \030d="
+	.string	"\345\265L\364<\346P\273\"0\376?2Z\302s\275\2013\266C2^\243\347\226\230\260\005|\247\210\241\326\255M\3709\270q\211\332A\201\317\301\337\235"
+	.ascii	"\212\260\272\024\357h\306,_\360\340\307\3627\264\013]\335`\340"
+	.ascii	"\327A!\001a\2076Q\367P\345\353P\331h+\310,\202S\221a\"Z\034\337"
+	.ascii	";C\217\303\347"
+	.string	"\006M\340\333\300\232\204^(X\223\335\001\211:Q\034\216&\243\203\023\261\215\252\212,\203\201\t*2@L\210#)o{We,\376\254%\253}X~\036\351\321bb)c\204\217/O[\242\2739\r\205F\233Y\353\357\260\207\306\346p)\bnt\326\372\026\237\331\320Y%\203C\215\024\340j\027\232\201\353\347\210\243\347(xCX\2714\216\206A/\205'\221HD\204\323\247\311\252J\377\201\3314\006-\356O\214\236\026GO\372\204,n.\331\343\260L\373\275\320gi\340\366-\t{\363\202pe~\373\2325\236\341\352MI\002\224CF\212\007\352V\322\320\223!\274\327\032\374Z\220t\371\320\231h\003\343\352p\215\304\376 \225_C\235kJ\357\002\253y\266\036\210\262\350\201_\327\265V\347\355\265V\263\335\r\222}B\213\212\263\210\243s|@3\377\346\\9\325\334\201\346\211\315h\302EVsa<`"
+	.ascii	"f\021\356\247\372]G\343\021\232\211(&U\363\007\362H\225\274\332"
+	.ascii	"\300P\030\364f\337;R?\226\364M\215\343\302\371\017\336\253\302"
+	.ascii	"v\235\275\332c\247rEd\024e\336\001R:\262\345\231rt\007\302\032"
+	.ascii	"\210\024<\342L\342\206E\242C\355\301Q\247L\bD\341\235\r\265o"
+	.ascii	"\325\245\226\243\214pMC\013\2173i.\020{\217\377uy \3761\245{"
+	.ascii	"]\301\354\264\347\032i\234W\237\212\261\336:HZv)\332\n\177\341"
+	.ascii	"\030\257\0203@\263\272\f\303\f\360\357n"
+	.string	"\362\031%U]\374\340w\351\345\341{\212\325\226\021\230\254\013\325\217D\255\263DQ\217\26284\340 \274\034m\305\030\343Y82\235\306(\305\331\225\006\030\301\\\202\206sEYy\035$\300\205\210r\0039\302`Qz\226\363]6\317@\342\020"
+	.string	")\374\235f\306W\355!\234\205\322|\267e\251\f\344oU\336\340z\311\2460\333%\021\316Z\2167;\253{8\373m\204\325~mAC\346m\366K \340|\206I\023]\242\207\201\354*\350-J\025\242?\355q\025\345\254\204\252\370\334\224\302\253\025|TG\345sXw\225\345\216A\0057\335\211-\270\270\220\303\212\331\224x.\264s]\245mIj\rE\311\035,\b}v\"\273A/\34788\020\361L\247\327F\277c\324\343\346\302(\311{\316/\3616\257\020\202\216n\030R\223\301Qd\r\3027^\343\367@\021G\317\226IE\306gTh\311\003]\231c\302i\203\"\\\255\350\222\024\324`\267b\232\264\351\242\240\027\340\023{f/\376Y\r@\261W"
+	.string	"\262J@\206\322"
+	.string	"\223\220C>\312\\,cn\351&\023>kg\3117w\034\275zr\227\276\206\313_\355.\0207P\240\232\213\026\234\023\337\232\302\302e\362\005\031\360I\337\2021\317\001K\267h\362|~tB\261v\350\336\234\250\252\320\214\307\330h"
+	.string	"i\206b\001\250\264\265-\220\362BV\ra\225ld\334Z\254\210{4\201i\333\245\330\313t\320<\2569I\202\023F\241O\237\247Gw\220^\273\005\343\211\022\263\005\364u\303\344\266cB\340\316\207\234\271t|\034b\r"
+	.ascii	"G5\374IK\245\020\261\210\201%\374\365\345\300\214{\330w\017B"
+	.ascii	"\372\306\3348\213\360\272\205\303\362H8DC\365\222\327\023\304"
+	.ascii	"\370tL\370\037\343ZZ\364\236\263\337!\025\315\304\254\346\304"
+	.ascii	"\345h\241\030\341\260\361z \220[\235\221'\027\307\013\\\245h"
+	.ascii	"\206\366\035\315\206\352\324I\266[\315Q\225\330M!\031\265\326"
+	.ascii	"\253\223N\301\0349F~AIH$\035a\307\333+\231\262-\013\221\276i"
+	.ascii	"6\314w\006\267\021\377\023\217\0023\333\353^\203\0315"
+	.string	"\001\220\353F\2776\376\177\340\334\211\"\337Kxw\rc\203\340\257\177\025ff:qTC\227\007/\266\373\264\353\277\222\327\2719\217\376\352k\033\212\013\350X}\020e4K\277\206j\304/\311\326\227o01L:F\373Xq\244\255\225\337 \277\273\347\242ce\305\355\370\234\375\361\311}82\223e\273^* \312\233\t5g1\307V\350C\201F\275q\006 \224Ss\360\303 \252\212i\026OB\214U3\"\372sz]\222\b,\213o\004L\316\234K5\344\313MI\bU;\354\240\276},\341\027\357\250\372K\b\220V\373\256d\025\030\230\341(\003\321\240J\225?z\244\264\332\3136R\371\305\251\374\323%\\&\231\220\305\0202\216\332=vs\214\342.\t\255\337\020W\200\351\251n&Z\322\273\336ma\320\036'\022\206\307\203\036*\255A\232\0269\355\370O\264(l\220\022c\314\3003f\232\362\263n"
+	.string	"\363j!+9\334ao\024\223\246\203\316\242\241\332\377\303V8\266\266\020\225j\033\311\240\234\201\272\030\357\277\271\223\334\265a\353\236\227\217\337\270T\277\376\201\253^\320g\027\025M\367\026O \311\021>K\346f\245\017\240\337\362\242\337\033\300\214\311(\351\"\364\271\201BP\311Kh\375|\022\267\004\372X\031\3657\017scc}\256V\377\370\031|2\373\035\362'\210\022%\275\374\240\002&\324\270\033\337\331\203\341o\025\024\\H\333\300\fL2\304\305\002\2241*LB\333\217\352\345*\351c\244I3\371g\351\375\305\274\357\023c\220\360o.l\013?$\017yY\341\271\333\353\242l*\032\336N\226\2534&z\321\336\352z\200\214\304\023"
+	.string	"\227')XR\240N\337\241W\252V\214\213\30541\347\256\017Jr\346O\372\340\307\201_\350\212\346\337\215VD\2301\032\321\303(\027\331\312^\215\300A\367R\307\004`/!\r\341\316\341\307\353lI&\002\377D[_\255\026e+\305\bU6\300\367\037eU\302\212\023Z\307\274\030UZ\322\206\220\037\373\271\034\321\003\354\371\332<{\351\017z[RZ|\342B\223\3476\354\333WU\216\354\265t\331\353\265\005L\324\\\263\273\345T\177\316\013\365\013\300\327\025\277\"\274\016\035\316\022\005\024\367\322oM$\020\275\210\356\\h\211u\221\251#C\302a\224\005\037\277!\001\030\347\203\251\026J\343Q\374y\f\266\t\017\230\335\207\016\311/{\333\367\247\246\316Z`\215&iq\260/\327\036\243\360\377\371{\231\275\241r\021\250\345m\033\240\036@\362"
+	.string	"\365\267\t\237\233&[=\374\275\230\034\"\323\334r\300\242\373R\351\024\374R\374\034\242\356T;i\346\341\373x@\367\f\317c\343\256_\213]~\032\2469\025\3154\200g\240\213\350\0266\377\276\367\316\340[\330\356xo\314"
+	.ascii	"\233\247\376\036\035\361\326$<\fe}\227\002n\245~*\314\260\350"
+	.ascii	"\236p\227r\037'\233\206U#SUW\207a\243\0364\274\362\260\337`*"
+	.ascii	"\337#\305/\3421\2407<\247\322S\356\357\344\236\270\030\3100<"
+	.ascii	"6\274\026E_8\223\272\2166\266\340\326\244e\366\213c\350\320\213"
+	.ascii	"Qo\345=3t \177\\\373\351\242uX\324\322\224\013\357GJ\326v\352"
+	.ascii	"PBe\3235wW"
+	.text
+	.section	.gnu.lto_.symtab.53f77b0f781b4a35,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.53f77b0f781b4a35,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
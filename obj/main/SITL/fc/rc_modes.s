@@ -0,0 +1,997 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\375\007"
+	.string	"D\013\217\001"
+	.string	"\030"
+	.string	"\326\363\316\r\002\002"
+	.string	"\002\001\001\276\264\256\247\t"
+	.string	"\002\240\342\234\212\n\003\365\203\345\270\t\004\002\003\002\003\004\350\300\306\254\005\002\002\004\002\004\005\006\226\336\200\374\002\006\002\005\007\002\b\b\203\200\211\346\n\f\t\t\234\315\220\335\004\f\002\005\002\001\n\013\203\357\265\324\b\006\f\203\236\236\216\006$\002\005\002\n\002\001\006\007\002\b\002\013\002\013\004\002\004\002\r\016\017\352\263\360\321\b\020\021\022\246\213\347\204\013\b\023\240\377\330\335\001\004\024\262\270\337\265\r\b\002\f\002\f\r\025\230\311\247\340\005"
+	.string	"\026\206\375\263\365\n\024\016\002\016\027\272\251\207\240\r\030\240\342\234\212\n"
+	.ascii	"\" \200\202bU7\300\200\214\205KP\0240\001 t\265\317%\\\217%F"
+	.ascii	"\223\001j\031\357\236\315\262\334\272\313`\222P\314\0030>\326"
+	.ascii	"|\225\375\022\002\232L\303=C\"d\270/\307\316\263\203\363\205"
+	.ascii	"\206;\206\244\202@\212\342\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"}\005"
+	.string	"2H\025\031\200\265I\007\253\2660A\0234A\023"
+	.ascii	"\217\217\037\t\361\275\2215\273\267L)\256n\"\001\230h\210\375"
+	.ascii	"`\240\302\233\030\272\240\300\272\265\224YB\214\211\362\334\313"
+	.ascii	"+-C\306\316\377\026#l\006Y\033\346l\244\235=MG\217h)\357\303"
+	.ascii	"\343Q\347\322\r\366\024x@' p\002!+>\321\b\314\013Z&R\\\246O;"
+	.ascii	"\257\271\225\201\001f\200b'\001\001\216\201 [b\037\303\b\272"
+	.ascii	"\021\315\307\206W\022\006\\\024]\030+-\215\224\246H\210\224\336"
+	.ascii	"\002\243\313\206\223a\243\361R\333\307\206\327\330\360GX\374"
+	.ascii	"O\004\322\274<Z\007\001\027\300\r"
+	.text
+	.section	.gnu.lto_.inline.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\302\003\325\021"
+	.string	"\006XWD"
+	.string	"\223\223\306\200\263z\255\020\360E\"T,\346\226}\246\234\252\023\r\203c\214\346\330w7Pn\227\317\2774G\250\034\261_P\210\302\027\251BTUU\325\362\007=ml\237\362O\202\320\377\266\021![\312\235\0026"
+	.string	"B"
+	.string	"O"
+	.string	"\333u\237\216\317\226\246\242]\024\365\241I\365.\022\177\035\036\332\016m\372{\366\343\332"
+	.string	"\256\253H\347\234\323\372\tsN\n\037\177\037Q8\034\236l\315\234\363\343\257\243\211+l\234p\031\371\3703\205\233\002f\032a\177\270\300\312T\302\306\341\003=\205 \201\301\300\022[S\017'\365!\356Y\256i\367\335\274\250V\271\306\265\365pR \252\375n<\036\227\374I\024\276\004\240\020\006p\2647<\234L#\322\256\304`a9\207"
+	.string	"\317rr\304\312\214\222\245\322};@\207\204\350U\311\255\320b\303\242\363'\273!&e\346\200U\262\342\240Q\201\"\301\235(#\203\225\321@\223\322K\326\026%\323B\206\034\303`\274\224f:o\242\001/\215\224\226\016\001\204\315P\342\\\b`\240_\007z\232s\202\034\340\030\353I*B\345eS@\322\0225\\\324\f\370s\301z\224\265\361P0 \224\355\341\241`\2563\013\312\301\224\303\025\030i\007S\016\367\231dU$\036\332\340U\035e\250\301\2552BB\001\211Q\n\031\306`\2422U\347\001\0210)CJ!)\0311(H\251\003\367\203'J\r\347F\277\312\270\340\267\201-\257\324\352\250}\275\3518\233\323\243\201C]\006\017\017%\n\273\371g\236\226\331:w`\300\244Q\253\203"
+	.ascii	"p\302\257\352\202k\203hwl\240\244pxw\023\335\220\r\312\203p\206"
+	.ascii	"\336\347\2634\005\301r\372\210\273\204@\2324\214L\350\020h\264"
+	.ascii	"\"\323\206\t\306\255\376\205/\025\021\003\361;\272p\202\203\217"
+	.ascii	"V3\241\256\025\253\202_\341q\366\274\3058\023\320\202\277~ \r"
+	.ascii	"~7\232Lt![]\202b%M\"\261\017\303\257\205\0321wP\352\221j\366"
+	.ascii	"\306:\002\260%U\030\177\030\347\222\375I\271S\004%Ow\364e\n\342"
+	.ascii	"i>g\265\271N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\031\005]\013"
+	.string	"\302M&&\220'I\007\177}\362]@\257\266\273\273\245s"
+	.string	"\244\360_\313w\347\252p8e-aG7\"lDn\261\267L;f6\256d\245\204\024\257\373\007|\023I\202\220\2038U\367\207\027f\334\264X\\\220E\211\f\332'd\314\306\220M\246\212\242l\220\255\235\363A\326\004\362\332k\017\2637\n\237\260\2427\343?\200\216+\254BDT]\357z\r\377h\262v\250B\276i\206W\273?\205\352F~#\273!$zxz\177C\226eYV\305e\343\332^!^\217\257\021X\016\004Z\250\241Y1!IA\251\320\034\220\"\241\243\262\003\022"
+	.string	"\002\"\212\342I\022)B\024Q\204\002\tHB\021\241$)H\2061\300X\207\247-\357\277\332\023s"
+	.string	"\356]~\211jB\004*\257\334^P\242`m\314\263\312[^jAm\250\267\201_\335\355#\225\321\212\325qU\200\245?\305\001#\217L\022,\006.w\037\t\024\231\252-\326N6\n-\252\224\223DHR\232\215\334a^\376\325<\"\326\351\256\256o\230\236M\250\021\373\336!#\020\253\226\3556\355QTB\351\250\313H\265\377\025\275\215\"\276Z\006\313e\325\007\244\\ZR\222u\302\b\226\252Lh\001\017\247\3361\001\365\002\202\001"
+	.string	"\"%r\244\2623E\001\023L\320\300\374"
+	.ascii	"\230\273Q"
+	.text
+	.section	.gnu.lto_.pureconst.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\231\004\001\230\004\003\231\004\004\204\004\006\205\004\b\231"
+	.ascii	"\004\t\231\004\013\231\004\f\231\004\022\205\004\023\205\004"
+	.ascii	"\024\232\004\025\204\004\026\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\r\007"
+	.string	"\022\311\037*\220\265\031\016\340\257\007\337\035'\243XUu\304\335a\273]\007\302e\343\311\331\266\r\375\366\257\276\265q'e\343\267\233,\2212\005S\025UY\222fJ\300\002X&\226I\345R\247k#`\00138P\270\n2\306\204\214 \327<.\230\001^\t\327L \026\336\3324\225H9\274H\273c\020\032\244\374\321\247=IG\373/\257ye\036*\r\357\367\224T\236\246\347\\Q\356\312\250;;O\202* @\002e\n\311\007S\310\225\345n\334\020\r\n\006\360bHm\314H\253\235Ij\030WP9\030wwa\365\213\316\033\330[\347e\315\334\235\324\260RS\016\021iq\277\323\260\274\245a\301\340\350\n\346\003k\236\257\"t\030\340\211!\216=\204\262\306,\200\235q\020\220\021kt\225h\363"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.2ae75c8f77ae44ce,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.44.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007T"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\267\317\017yw\250\357\006yu"
+	.string	"\005\001\006'\001\300\002\251\300"
+	.string	"0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.ascii	"]\305\240r\3773\211\033@\021"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.45.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"e\b"
+	.string	"\266\020=80q\323\001\200B\207\220\274\260\270\022N\273\257\365p:U\227\006Lo&\370o\224\020\267\021\030\312\347h\246~)0\3504\264f\377\307\301\307\243\316x\215\331\336d\313\224\002,"
+	.string	"-"
+	.string	")"
+	.string	"\266\275\300\320\331+@\305\233\034\017\027\234\335p\306\222{W\317\377\352\b05`\352\273z\034v\327\n\246@\356x\333\t\266E\266c\002W\031\360B@\263\373\261\243\2636r\006\305vg\203l\253\332O\271Jw\025\207\001vEV2\273\241\310\n\237\313\320\007\256K\353\002\327e&\273\247\203\376\312Y.\374\223Ko\234\036\274\364\271\353\322\316\330\320\203V\f\241\342g\207\237F\022\373\326\356\256\343\210\255\253\036\244\007\215LB\032\033m%Rf\202\300\264\211M\314\n\212\b\323\304\264m\216\f\234Y\224\264\211\221e\332\004\205{[\261!\344\024;\374Q\215\017\337\302\035\004\007"
+	.ascii	"2\003\302\260\241\0137r\031\025\322\030M\034\"v\256\371\004"
+	.text
+	.section	.gnu.lto_rcModeUpdate.46.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\325\007"
+	.string	"b\31777@o\323\001\233NL\r\024\007o\032\264\2261\337\250\n\305{\210;\317 \302o\032\206\363hxPL\240Y/!\230\017a=\352\262\373\345\312\036\375\017\311\322&{\247\024\227\326\321 ,\256\217\345\312\001]\022\230'\242f\264N\320\017E\307Ck\006\242\234\003c\025WF5\f\313\350\346\333S+=?|\234F2\303>x\021B()\371\340UB~\311\030[|\367\351o\325\247\026\302\302!2\212\241\375\211\242\034\261O\355\356Zz\366M\177\244\032@\n\302\335\216PfO\363\305dc\373\321\376\311Q\270\233\266\013\354z-.\273\337\202\025\254O\177'\250>\255\017T\237\346l\030\003\215\200\231\215\225\230\335\245\222\344\334#\347?\345"
+	.string	"\035I\364\250q\330]\307\216\344q\313\333N\260\315`\033\f\t"
+	.ascii	"2C\363\f\f\217J\226\t\204`\310%\330f5%\334\341E;\311"
+	.text
+	.section	.gnu.lto_airmodeIsEnabled.47.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016$\243\212\253IsK\335\255\243@v\013%\262\372\317\320\305\262\265\273\035\236\336y\267@\374Z\231\231A4]\274\314\017d\247\016\215\321\332\3362\005S\226\314\245\241\302,PV\243\034\032\304\003\003\246QV\246Y\006\256\".V\223\250*\253U\262,\212\016\t:H\361\005i\310u9\236\320\\\261NW\003\320\351P \324\271\321g\234\303\214\257\224(\372\357\303\002\213\226\230d~F)I2\215t\374\233\257\214\220\260\371j\266\361)\206\247B\004%3k\250\321\253w\335~T\362\b\235` N/@!3?\ft\321\261\277\301\177\360{\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isRangeActive.48.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\241\002\225\025"
+	.string	"V\351\216J\300\322Q:s\020\360\335+\t\205\003\200\366\016\036\221\003Pu\213\300\0220\242\214\203\375\021<\353!J\210\f\332\207\243\205\340\254\204\222\206ey\212\221EQ\024\"3\351dlp\022f\223~\346\377\223\330\256T\2254BH\2222\005}"
+	.string	"m"
+	.string	"{"
+	.ascii	"\032\303F\2033\002\\S'\354\261\004\365E\352X\352\t\251\243\277"
+	.ascii	"\372S\343\317\371{Q4gp\201\017\224:\332v\203\025\033\3374\330"
+	.ascii	"\223\243;9\274\031Qs\006aG\2417U\221\243\370\275Y?\250J\203t"
+	.ascii	"|\322q\352\371H(9B\307\335\212,\037\b\221\300\234s\345\323\355"
+	.ascii	"E\004?$\021,_N|-\355\364\320 \335\033\037oW\3252\347\364\366"
+	.ascii	"|!\324\245\332\266\261\375\300^\035\001Jco\240\3111*\243V\316"
+	.ascii	"\251s`\025N\330P\252\320\321:C\352\250O\201\243\364\203\001\204"
+	.ascii	"\333\241\035\314\355\201"
+	.string	"\266\212\363<~y\215\242?\252'\032T\005\360\265\313\353\326\327\254\257M\276.\371z\3655\311\327#_\227_\253\276&\311\365\370\265\370\365\307\365\216k\rP\300\004\217(\005\307\2349C\"Si4Za{e[\\[\201\002\332#\005\244H<\320\257\223\\\203t\365C\210\264\372\353\336^\220\334\310I\376\243\335/\245\374\310I\037;\037}y\037\035'\225N\365\325\311'W\013\362\252{wB\306\223\027w\360\246p;\364\2407d\345\234\223\305ZCm\314\374\002\263\332\203!u\034\277\322d\204\333\241E\365\021\371\213\327\335/\267C\237\374g\0204\224\343!4\2659\206,\235\370\201\336\353+\b\223t+e\033C\263\027Z\3146\322\314\\h\0222\314h\264\330\005\b4\035b-\313Tdf.\265\030\n2\033Lf\001F\203\211\305\300d6\031\230J\212k\032f6\030\207Z\315\006[\005q*\316\363x"
+	.string	"S\t\036\021\211\022\201IG\210h\2557\262\345\326\335\202{Nu\240wL\240+*P\327ol\327Q\256<\222<P,\342\242'j<\017\35358P\302$%R\223\263tHKnr\362h\347\263/\271\262\320\201\342i0 @\002B\220\223v\265\241\245\025\350\225\360\306\300\027\3576\366\326H\021\256iL\363h\213g\371Gq\216\353E\234\001\302k\t\276x\f\026I\023\006\306\311\214\350cG\244\301\223(e`\347\340\315\341u\306r\3504\f\332\342V\212)"
+	.ascii	"\204)\213\316\nYx^-|s\270RcF\017\202qF\026\037a9*\266w\003\312"
+	.ascii	"i]\232d\341*\264\353\265|\017"
+	.text
+	.section	.gnu.lto_updateMasksForMac.49.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`.\003\355\025"
+	.string	"f'\215J\300RN:R*o\345\205\213\370\343\200\341OT\330\320\3241Dn\257\230\374\231\2731(P"
+	.string	"qZ\302RUm\275?\376\314X\277~\375\336\311m\033.\265m\004\254\311\nn\245\377\022\340\373\237\261/J\313\226\020B\210\334)\005y"
+	.string	"o"
+	.string	"x"
+	.string	"\037\031/Zg_\375,\252\007&\3518e\325ZgKt\335]%9\212\341R\235O\2628\335\3453ww\035\347\367\022\311\312\007\210\222& ~~\037\255|~/\263\003\025C\330\226\216\r\021S'L\351e\005\275\314\036\r\377t\023$\237_x\240\326*b\362\350\206$=%|\"fN\210"
+	.string	"k\352\307\235N=\230<JI\226Z\253\251\317\374\271\001\334\366\b\333\020\354U\tA\357\220\375\246\177\344L\177\354\347\037\362\245\037&R\273D\352R\244&G\352q\251C\221z\227\232\212\324\027\260\"\225\345\243@\217Z{\202@j\225\330\342\310\366\355?\331\257\277l\207\324^\320@\367&\233\237\006\204\316\244\030\016\230\242\030\320\223\303\200"
+	.string	"\225\007\fJpj?\351J\272/\335\\V\353\220\226T\255\247\002\237\224\027}\236d\274X\0067\264\214\0054\0014\216\354\t\217\021}\021d\006\222x\3338n\t\017\221]\273\224m\334?\235\036\355"
+	.ascii	"\021R\362\0321A\301\b\037\365p\351\325n,\334\247`\261{(\035\177"
+	.ascii	"\321\026\226\324\332f\244\353\002\334\301\243[\206\321o\310\332"
+	.ascii	"12\364>\272)\037z\273\263}\373\n\\Y+O\305W\001\223\241$q3^\374"
+	.ascii	"J\330\311\022RZ\302\241A\373\334\321\ra\177\203\301`6\r15\265"
+	.ascii	"\007.\033l3\244\f\rm\302\313\f\215\254\321n\353\032\n\215\355"
+	.ascii	"\005wk\251\345f5\230\331L\f\3556\253\345hf(\004\214\303`\313"
+	.ascii	"\315jp\270\334\354u\326\207u\207\034\001E\025\316\346\204\265"
+	.ascii	"\326\352\"\241\261\205\255]\301\302\235\316\322\333]\tT\016\215"
+	.ascii	"\262\206\214\2726dE\206k]S9\264l* \017\021\244\214\226\033[\373"
+	.ascii	"\002U\271/\023\307\t\031%[h\364>Sp\201#\367e\006> \300\002\021"
+	.ascii	"!\254\0076*pV\350\006\211\001s\024\257\364lD\3532\357\013j\311"
+	.ascii	"\254\360\243\210\305M\310\022\327Qz\276\316\335\325\310\022\262"
+	.ascii	"\033\025l\306B\r\227\372b)*W\177\265\200(\313\t\3770\224/\367"
+	.ascii	"\306\264P\336\222\221E\250\342b\244\nf@\260!\342e\0017\f\226"
+	.ascii	"\213\202\r\315\211\035\036oo\311bqN`\226\210\021\0010J\351\021"
+	.ascii	"r6\026\306\313\020C\002AV\203\217b|\306\n\257\203\267\324\f"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.50.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\324\001E\020"
+	.string	"\266\236lF"
+	.string	"\223\223\016X\332\245\216\362J\235R\255\357\236t\360\364\241\246A\373\317\223\351\233\005b3I\201faw\353\355Y\022\b\3154\306"
+	.string	"^K\342\233TZ!\260\277h'D\023BY\3356Yvl B\310&R\246\024W"
+	.string	"Q"
+	.string	"^"
+	.string	"\254\227\b\2349C\006N\260]:<Iv\271}@vi\224\315\343\341\313\374\013G\210\032!sNnQ\034u\211\255\242\374\277.\362\201\251\313\255\345\030"
+	.ascii	"\260\345\213)\020s\202\214\200,\214\244\225\342\373\353:\002"
+	.ascii	"\\\251j\024\346\234\326\017$qg\267m\3016\004[#\004\243\035\256"
+	.ascii	"t]\354\3578\216\243\327e\237\346\337\036\376\232Tg\237\371%\246"
+	.ascii	"^L\255\230\372#\023D!=\020\334\314\331\032\207\314\034\222F\214"
+	.ascii	"\355\3735\267Q\271\013/\370\303si\253\330\236\313{l\232\033\016"
+	.ascii	"4<\301,\270\332gq\031\324gV\n|f\372\317\rL\344\350\212\200@V"
+	.ascii	"\374eG\304\331u\361?d\331\376u\001\341\316\t\037:v\260t\307\001"
+	.ascii	"\364\373\233\3178\035x\231S\365\317\217q\031\034\214r\322\177"
+	.ascii	"\247\314&$\322\177\331\336\346\025Z*tD\226M\331&\035\206\207"
+	.ascii	"mN\326\003\377E\212i\203Y\311.\277\022Z\256\02223*\r!Sg\002\002"
+	.ascii	"4\322B\246\316\344d\324i^'Z{%&\320\tI\244\301+q\336\006n\204"
+	.ascii	"\322\2118\257d\342J\f\230\324\001T\342RH\244\022\347\tU\307\346"
+	.ascii	"\272\260\026\242\216\250\332\0256\347\234\222\200n\253\255\\"
+	.ascii	"\373\002\206lSj\203\245\025\203}tw[;C\215\325\371\250\256\266"
+	.ascii	"v\347\005% \260\202\031\301\335#\241Y\n\334\373\270\255\230\222"
+	.ascii	"\264\031\303+\200\333\273\273\222\351C@zW\342*\226J\004\213\017"
+	.ascii	"\257|\356\227\2675\302\222\r\255H\244\025\022\2171\300\214\204"
+	.ascii	",\315\265\031\017\314\034\031\356\205/\303\210\200\2112\346\362"
+	.ascii	"\332d\033s\215\226A\001"
+	.text
+	.section	.gnu.lto_updateActivatedModes.51.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\343\f\305A"
+	.ascii	"\352q\310\030@P\246\326\030#\360\273\277'\313\264'\017\336\327"
+	.ascii	")\300S\346W92\267\352u\326\331\223aF\322 Q\275\265\357\354\320"
+	.ascii	"K?\021\021\321\325\377\371:8\224\0130\033\355&\375\017XK\331"
+	.ascii	"\244\224)\245\024\177\001c\001\200\001O8\334r\330\352\312\355"
+	.ascii	"8[D#\364\005{`\005\372L\364\276P\r\355\233\326\030\326\276\225"
+	.ascii	"\3112\245k7:\272\216!,\315\230O9\346\240\2164=\307\243\345\030"
+	.ascii	"\351\270\246\343\230\233\f7\034\007\325\364\032\267\331p\035"
+	.ascii	"\221\013\372\212E@\213{bh{%\252\335\304\3620\323gz4\031\006A"
+	.ascii	"'Q\017\346.\323n\314A\376\321d\370\007\2223\346\263W\346\037"
+	.ascii	"\314\301^\327\036\323l\035\345`[\225\bP D\340\373\236\211\211"
+	.ascii	"[\320\366\332\317Vs{\rHk\f\003\036\351\372\232\276oXT\257\214"
+	.ascii	"\240\355\225\241\355\304\366\332v\023\333\253\313\f\250\241\316"
+	.ascii	"\267\313\fI\226I\364\276/\325SI\342a\253\320f\244w\273\211iI"
+	.ascii	")I8D:\n\032\001\333\037\273\252\357.\367/+\332>\226\007\231\207"
+	.ascii	"F\314\330MV\232\311\212J\\\262\023\206\326\321*\256\344|\303"
+	.ascii	"\364\244'-\354\343\223\036\252\277.\260,m'\354\212\212\2657\235"
+	.ascii	"k8\244#M\031s\322G\301_\226\233^\017\225\351a\322F\006\242\214"
+	.ascii	"-i\340\022o\313\322\302\224\370O\205b\336\221\t\305\222\252S"
+	.ascii	"\035)~\332M\033H\013c\342\254J\264\023\326D%\276\357\033\024"
+	.ascii	"\363\3625\312X\223VU\250\251\334!\241X\227\352\004\226E\331q"
+	.ascii	"\355_b\\\376\r\327PhqO\275(cN\332\177Y\357\373\262+\305\306\232"
+	.ascii	"\235\232\271\227\314\f\2039('\337\344-V}\034Q>\\\276\307D\377"
+	.ascii	"o\271\036Sl+\\\360V\252\017\301\254\2133\264!\255\023d\205\270"
+	.ascii	"\030\024\342\240:\t:\204d>\0075\241\031l\257\377q\310\n1\325"
+	.ascii	"\326\346z\272\341\r\371\350@\034T;=\177\032P\007\017\037>\260"
+	.ascii	"\275>}\317\265\007:\246\264K\036\032$\375\376l\231$\337\321\373"
+	.ascii	"Ht\237\020\355\373\276X\334{\232\317\b\356+\275r\t\023\336J\023"
+	.ascii	"l\257\375\035\327\252\227Ak\364\346\216\336\367ov]b\317L^\240"
+	.ascii	"\021\260C=)T<\221v\215q\322\322\216:\032&\322$o\233\345\260Q"
+	.ascii	"\335d\232\255(t*\231]\300\360V\362P\016\2527\365z#3\024\351\337"
+	.ascii	"dn,\347\336\224\377\214\231u\266`\344\\\201u\316b\235)\264\316"
+	.ascii	"\023Zg\t\255s\204\326\031B\353\374\240uv\320:c\265\316\rZg\006"
+	.ascii	"\255\363U\320yA\353\254\340\347lU\365s\236\222\3528\315PF\316"
+	.ascii	"O\2553\200\266c\323<d\235\233Xg\246\326y\251uVb\235\223\200\316"
+	.ascii	"B\326\031\t\350|\324:\007\177\316F\2553\260un[\347\337\317\231"
+	.ascii	"\005:\257\254\263\nt\376\326\331\177\316\235\001\200\223\331"
+	.ascii	"\244\251\374<\350\013\326\247\350\225\256sZ:N\267]7\233\356\265"
+	.ascii	"nhw[\263\314\215w\3071\226\001\\\307}\205]&L\347\255d:\266W\340"
+	.ascii	"\007\330\243\344\350}\255\276\357\373\"I\365\360\253\276\341"
+	.ascii	":*\312\032?\372&\023\270\343$\tgDA\353N\331\033\034\333\211:"
+	.ascii	"\253\312\333\357\272\272'.\024b\362\215\234\365\355\2019\272"
+	.ascii	"h\336\033_\360\233\354\300\250\366V\252'\374\027\363\204\247"
+	.ascii	"\360\235\344;\032}3\215\031\345\027\340\237\261\204o\360?\210"
+	.ascii	" \212\342\271\222\216\360\022<IC\370\b\317\326y\245Y=\204\357"
+	.ascii	"-e\210\222|G\253-^z\3557\371\3017\370\007\024\235\363C:\370\007"
+	.ascii	"\377u^L\001X\357\340\331?^iS\217\365ie\201~\\\f\276\301\263\207"
+	.ascii	"\224\272\\=\203g\367*"
+	.string	"\204\364>^\360W\257\342%\371\\%N\346Ji\331\307\374\210\333t\251\270hhl\257\013\376j\317\234\332\\\307\376^\301W\261\261A\346\2711\221\214GZd\320\357\233?\365,\242t\270|\317\212\203\271`<\030)B\304\352\237\366\270a\027\213+]0PD\244\314\256\026\037\342r\371\257\245\331\352B\334\313\223n\027\266\327\251o7\355U\210H\231jk\354\377\376\361\\/\316\345\202A\2614s\244\037\331o\272\366\273\245\231\2226ok\354Sk\261\353w\226(\036\227\357\365iQ\221)\342[\264\376:\bNo\315\271P1\262h=\340-\327\321b+\327lO\317\354\212q\325\204h\324\244^ol$Z\016\221\251\001\034\303\305\016\0319\212\025X\374d4\017\0275~3\266VthQc\305\257C\217\031E\0319\266\202\\L\260\345\242\205\r\032*\2128\250\212/\250j\310XA\203\252\210c\213*\201"
+	.ascii	"\266q\303\005\016\252\0346l\340\240\nB\217\375g\354KQ\375R8L"
+	.ascii	"&\251\006\360_\034\226\322\343#\327\240@\324\367\215B\241\333"
+	.ascii	"\272\247m\336\307M\317\356\346o[A\372\\\243\221\355\325\363("
+	.ascii	"\007\001\370\246o\266\351\233M\205T\233c\262\020\200-\r\n\241"
+	.ascii	";\303v\221l\277y\2648\300\371\276\307V\266\001q\263\360\355\326"
+	.ascii	"Z`[\364\246]Lh\366\236K\337L\324L\377v\242|$\270\273I\226\331"
+	.ascii	"\035\342~y+\231\276\243\r\f\003'Lo\312\365F\356\266f\177\272"
+	.ascii	"\032\220\"\305\342\231~\202B\006\231\227f\t\2267p&pJ]1\367HG"
+	.ascii	"[\204]\234\3364\251\364MFR\n\245\376\371\f\243\332\311\351\227"
+	.ascii	"\276,\231n)\311\351\245\276\337\364\324\321\016\231\347V\345"
+	.ascii	"J\337ww\025\240^\351\255\254\330%\371\222\036\351\241\276\377"
+	.ascii	"$\221 \205\321\244\357>-Z\037&\013\026\341\367\035\032\321\217"
+	.ascii	"\276\357\232\r\351U$q4\255\030K\251\223\312\221\353YJ\361\274"
+	.ascii	"\211\307\034\303\317\\J\205o<\243\017\212p(n6\242\314\204\321"
+	.ascii	"\267\234>\240\266|2\325^\370M\356\306r"
+	.string	"\356M\207\177\306\301*GU\377|<\252\207\377\365\300\2770\207\335\2113\003\200\366\250Q$&\225aH!\031\021\221\321$i\fp\002\221\251*\242\007\021`%tlFD\024\244i\016\203H_\330-W\301R p\207\331\360S\210\225\363\264\357\344\021c\361~\347\245\340\023\311\306\311\306;\300X\203+\357\205\325\250\036h\037\261\227\200\252v\2072\310\3622A\340!\275 \266\254\031\256)\353,\251\246\220\367\344m\230mz3Y\364cez\267\255\201\373\2044\200\337fg\3001\004VS\026\002MZ\242\013\3173R\216\r\313w'\335\266\304x\302\244USi\355\332\331\200y\026\302H\3267o\272\231\326T\t\254\230\317{\311\303\243\331,\231s\346\303gk\033\224$;\360#v\315\303\246$\304O\237zs?\232%\237}\251\020n\220\255\364R\252\3153\023X\217\316a\211\315\2613!\340\246\020o\264\310"
+	.string	"G\312\027j\007\216r\345\227~\314h2\031}{\354~0\024.\252\034\334FI,V\231\230U#\321L\022\351\037\f8\f\331_\347\235\205\242\246\304\266i\212\007\312\302\032 \365C\371\241\360&\2458\266X$\025u\376\245\240G\001\340\245|Z\003r9\230\220g\271:\236\202\341z&"
+	.ascii	"_\004\004\205\366\275\332\230\346\224\326A$|\253\223\245\272"
+	.ascii	"(\032^)\260\300\200\002\230\251wGZ\303\246\246\027\242|\204t"
+	.ascii	"\017\251^]\203h\370`2\320\264z\0348a\346\216 b/Q2\306\346ij\326"
+	.ascii	"a(uR\216\375\267\275\226"
+	.string	"-\332:\005\240\363\n6\313\254\2726\214\261\tZ\333\241\330\245\334\221*\335\344\354p\304\275\003h\326\340\343\216,\3245:\277\270\214\007"
+	.ascii	"\260\232Y\240\275\b\"\rr\006\240L\323q\357\211*+\304\017\314"
+	.ascii	"\333t\361fpc\372\020\317\365\231Qg\363\202]$\313\260i>\261\225"
+	.ascii	"\027)LE\303\217^\325.&c\347\356l#\026\331(\373\315\311\"}y\357"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.52.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\373\002\035\025"
+	.string	"\246\247\212H\3200\2511\300\210u\005h\343\332\375C\256\371?%)\366\017\b\033\302\f\354X\247\263\351\2114G_\222\314o\315\226"
+	.string	"\330\227\320E.,\026\024\037\341\005\347\230E\206y\\a\013\266\036@9\370\007\330>w\333RJ\231Ry"
+	.string	"l"
+	.string	"{"
+	.string	"\342m="
+	.ascii	"\361\026A\202\026\327^\352\344\276\033\212\t\032\336[\222\024"
+	.ascii	"\204\003\274\2267k\326>\262D[\351\254\371.\037+}\031n\270\f\232"
+	.ascii	"\233\272\240*\346\351\275\333d\225\260\271\bc+\203\244\232\234"
+	.ascii	"\207\356\245N\021\301\251\233\240\271\231\265\032\300i\322\340"
+	.ascii	"\241\203\251\0371>D\335\3679\243\303M\372\336'\022\360\006T\241"
+	.ascii	"\263\371d\225\334{=et\031\356\326m\357\3306\261'Utg\227\267I"
+	.ascii	" \247\2642\315\2619\316\373[\236\026\377s\333:]\3554\265\323"
+	.ascii	"\263N\337u\"5\234\022\241qo\356\312\352\302\260H<\377\371\355"
+	.ascii	"\373\302\201\334a\003\016\357\275.\373>\277\364{v\375Xit\241"
+	.ascii	"\031\177AER\367\336\220[\223\343\355\355\026\333e{N\373=?\321"
+	.ascii	"r\036\006\267\356\365\340ttoy\300 \343\355\200\177\004'\177\021"
+	.ascii	"\243B.\224*\375\323\344\320T\003\310\322\235)\235t\216\3605="
+	.ascii	"x\013$\030\325aqD\351\223B\030\345E)\243\375:\021Lf\207VLJ\022"
+	.ascii	"\374wPD\275Jwn\321S\232/\210\233U\266#\\(\006R\363\204\323s/"
+	.ascii	"\216\344A6\313SLh\361\344H\004{\356\275\nP\374'\363wn=\2630/"
+	.ascii	"s\353\257\210\267\247\367\275\200-\212\212g\233W\024x\304\353"
+	.ascii	"@\003\226\020\273\212\003\321\257\221\025\230\312L\206\362\242"
+	.ascii	"\221/\b$\205X\212\214|\321V\310\021\001\236U\200\321H\226\331"
+	.ascii	"\214F\272J\333i\216\353\227~\2377\200r\372\031\261\374\232x\337"
+	.ascii	"M\240\226~F\366\257\211\242H]b\243\267\033#\335\231%\0249(\025"
+	.ascii	"\316\220[:c%\321\322\363|B\334\254z\275\367^\226\310-\345\240"
+	.ascii	"\357\275Z\355\330\200\301\271Q&&\237\027\3611\261\322\216\031"
+	.ascii	">a4 \220\002\241\232\254\003\346@\316\357\013\265\360\020Af\""
+	.ascii	"w\3405\266%\tK5\277\242(\337U\326\270\001\354\t7*\007\201\206"
+	.ascii	"cf\3562!L\307\305\330\230c\270\210-CX\263\200&u\r,/\326@\312"
+	.ascii	"9\260f\341!\024\337\024-/\330B\313\"\220\320;Q\367%\241e<\256"
+	.ascii	"\025-\220\2067\233\256\013:\001\026,\200\n\013\301u\220Tf\262"
+	.ascii	"\255~\265\213\f"
+	.text
+	.section	.gnu.lto_isModeActivationConditionLinked.53.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\030\002-\022"
+	.string	"F#|H\340\322&\035 \331B\355M\365 \375\037\n\336\024\255\212u\b\265\210]\r\310\356\f\331$\255\\?\240\242\256\365\246\333\346\236\343\253\225\332dc\274\024Q\030\243\325\300X\016\242&~#\353*\316\307\001e\315\220F\366\2262\245j"
+	.string	"_"
+	.string	"k"
+	.string	"\t\024\320\270u\320D\316g\270\330P\323\234\340\267%,\340\021\274;m\035\325\311\270\332\362k\216\212k\323\004\202D\026\213*N\261\035\267\275\264S\261s\031U\204\200N\254\355\226\224\222\3054\306\003<5tHd6\261D\307\b\246\207W\034\031L\367\266\353Q\220p)\206l\347\212Z\231sZod\036n\357\266wl\263\330\212\022?\312\352\370\332\275Q\255Q\375\221\026\260\tHJ\322\2349OEf\016y\364\363\332o\337\032\336\302"
+	.string	"\\B\200\346\234)\373\241\017\3726\247jF\362j:x\267!\036?\346\234'\227\376\274\313\3334v\312\266\252\375\240\013\321\234\266\301#s\212\260a4'\210\300&\336%\201\227t\227\361\001\272\313{\243FBG>\246\323U\2370'\341D1\017f\310\320E\301\3753%\"[\334\231Q\373e\2058\230:\331\2069\214\030\223\017@<As\302\026|\310\316\360\0272#?9)pAsN\006.~[\371(.maF\177s\351c\350.\277\017o\3005d\005\315\245O\273dD\013\261;\263\301\227\026\240\321`\362\366\330\336i\001\236"
+	.ascii	"s\027\007\235U)3/.+\231\026\025\353SE\370(\300@\220\371T\254"
+	.ascii	"\231/e\200W\025^X\337\205\325\212\365\245@\327\267\307g\361\006"
+	.ascii	"JDnE\235\337\352\036\236E\311\307\255(\376\255.\306\365\212k"
+	.ascii	"_=P;3*'\275\335\234\236|\027\307H\335\356ia\016\246N\217s\316"
+	.ascii	"\331\241|\327\333\333\036\213\370\340\340\300\363\322'\r# \200"
+	.ascii	"\202)\263sf@N\263\217\262\205\277\025w\370\032\"IB\362\346;\312"
+	.ascii	"\362\205\f\302\330\372\260\322\341)\313\346\353!$\337\324\226"
+	.ascii	"\027l\241m\021PhO\324\276 \262\214\213k\241\005\322~\263a]\340"
+	.ascii	"DT\004+\312\336\203K\"\371\"\277\256C\006"
+	.text
+	.section	.gnu.lto_removeModeActivationCondition.54.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\227\005\215#"
+	.string	":A\024\016K\240\024R:\224gg\360\304\205n\324\016\t\357\350\243M\315\243\256\255\004\227\332\032\375)\230\361\216R\253\215\373d;\374\233\323\210N\224\224\310\314\270\347i\214\036\257\323\373\204r\264\326q?\342wa\317\246}+\371$\226\220-w\222\001\317"
+	.string	"\300"
+	.string	"\320"
+	.ascii	"P~\334{\\\300\272\363%\201\307\230/\355a\314\227\374\303L\345"
+	.ascii	"\306\247{d\027\"d\331\275w\327N4\026pk<\343\372\3479\334\315"
+	.ascii	"\226\326\320\223f\276\224\266\353\017?\307\r\340\030\373\t\201"
+	.ascii	"\236\263]\242l\370d\320\205u`F$v\244\257\342\016\343\210\370"
+	.ascii	"\233\355AJO\227\216Z\274fc\214h\374\236\f\016m\202*@\262\\*\310"
+	.ascii	"\242\242\251p\250\236\266uh}=\031\\a\035XM\305x\326\013H\005"
+	.ascii	"UTZ\315F\212\233|\246\370\213\265I\202d\365dP\311\002`\212\202"
+	.ascii	"u\251\340S-cnm\002b\022$\234\260\204\215\tc\222\362\254W\240"
+	.ascii	"P\250\366\221/\235\212\310\226\216\210\257\264\007\367^\256?"
+	.ascii	"\341\321\031\300\231\317\200\231%0\227\035\207z\311:\035\352"
+	.ascii	"\177/\371\035\314\2273\375\256\227@\204Y\214\210\270\222n\375"
+	.ascii	"~\326\313\033S_D]\202\352\331\271\246\364\260\352.2\033}\265"
+	.ascii	"&\\R\304\335\304\\\203V\2469+\317\310\374\352\027@\253\fcV\316"
+	.ascii	"\375x\276\331\322\332\215g\324V>_V6m\345\322\254l\315\312]V\256"
+	.ascii	"\266\362\007\340\214\204\355\316\3565:\333r\301\312 5~\374\215"
+	.ascii	"|\036\357\nq-N\231\220!\320+]e|\254o1\247,\342ZL\023\3425u\357"
+	.ascii	"\315bN\257\203\217<r\215\025\335\210`N_\366sp\312\314F\335\t"
+	.ascii	"\024<\265\264LT\271\327\250\340%\357\316\227\314\374\312\374"
+	.ascii	"\252[\375\374\212\004\243\367.\005\255\033j\231\201\232]\245"
+	.ascii	"\226\220\350\026C1\241\233s1\373\\\t\017\255\201\344I@\230/\315"
+	.ascii	"~\217'\335e\237H\345u&Qt\3548\273Xu\205\206)\323l_\320\256\301"
+	.ascii	"\\gvW),%\267\256uw\005*/{\357\275\264\257\327Z\246/P"
+	.string	"}\r\021}\365\214{\207RS\021\263\213\374\337$\221\310x\351&~\326Q(\262%6\327l\333\326h\003\231u&\372a\030\026\024\241jVv\361:\323\326\271\346:\224\305W\317\316\307-NH\266\213]\233\007\353\211P5c\346\f/\202\243\033F\021\253\356\2757Dx7\037FQeUB>\244g\276\254\3754\214\"Z]\275\353@z\346\321\311\357]\314#\376\203g\216=\335{\033\370\270\327\006\016\314A\347>\274\236\234\234\236\251\001\202\31186=<\r\275\035\f8<;\234\234\235\007\235\f;;\034\236\236\235\r\r\367>\360xv>\275\036\317.5\006\275\233|\034\001\013j\0370\327EFq\334j\240\310\210\267\006\262\275\245\375\034?\313\310N\324\033\271\255\201\327\2317\324\312\207\234\315\330\302\245\264f[\336\310\323\006\336\272\246\217|\2314U\257n]\254/g$\246\202\31743\005\013\365?\306\375"
+	.string	"\033j\240"
+	.string	"EG\244\255\213)M\363\305\"\240*\370b\023v\370P|\f\346K\032\004(\274|c<Xl=\331k,O\036\036\306\263_N\300`\372[\267\\^\330>\255\031\225\226\003G\222\232\324\316Z\263\245\325\232\326\300zv\177\352\n\221\326m\177\3446l\250q$\303\224RL!\221\211FD*\315\030p\002\2312\252\036\021\240\321\013hJ\n\303\236\001M\3523\177qu\343H\230L\371rS:\341\230\223?\202\342\255\017!L\023@\323\346a\255\214\203<\b\313xp:x% \276Vq%\230\211\354*6EL\"\276\303\370\363\027\200*4\271\344\n\226\322\2026\255w\243d(\027\003j\001\2002\030J6|\201,\305^@\210-\017\023\022\006Fq\346!\375P\026\357d<\266\0055b|\372\021\352\306\2175Y)\277_\376\342E\0332\322\016\205.\302\201\245\002\021\353$J\235\265"
+	.string	"\2756Og2\305\274\034\270\374\035$\035q\273\365\322\2425\177\2014\237\306\271\201\242U\347\020\230\017\336\227D_"
+	.ascii	"-U\260g\311\260\247\035\303\302\223DG1\236\353\247\345\205\353"
+	.ascii	"M\211\371\003"
+	.text
+	.section	.gnu.lto_isModeActivationConditionConfigured.55.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\345\n"
+	.string	"\266\025M<01P:\2008\222\306\270\252\"\307\340+}\341=\237\242\2630\347b\0302\367\317\257V\t\266G\360\226FBZ\330\310~)\260\004\274\b/q\326%C\305a\350\235|B\266\224)\005<"
+	.string	"<"
+	.string	"7"
+	.string	"^\320@\343\3561\304\347\"\021\035P\244v#\246\242w\207\232\235\357\035j\215\026/P)\276\017W"
+	.string	"\337\006\026\330\335\223\236\236\217\223\371\230\354\256\263\363y\270\253\333\206`\233\201}\003\001\325G?t:5}+sJ\321p\320\261\373\351\310\261.\252\025#lkl\210\035c$\310\264o\342'4\037i\030\020YN\t\304i7*\360\201\353\225\343\005X\257\256\007\260^\331\016N\365d\203n\240\206rw=U\220\021\374:\241$\203\2238le\344faU\n\325\306\220\311w\256'\375\202aco\314\340\240\236\035\275\324\220}\270\273k\005\331\217\177\031%B\006\214E\253\\\031ESg\222K\205\302\246I\3108,\253\200]\260@\321\260\214\273`\022\002\336,\025\016\303l\033\207A\342\036\256\202\374(a2\251\337Y'\375\001\212\204IE\376\235\225\352\261\003\016"
+	.ascii	"P\204\366\323\206\327\304\016 4\007\334\202\346BH3\266\20090"
+	.ascii	"\030\030Y\200\n\206\252rH]\337\332R\006"
+	.text
+	.section	.gnu.lto_analyzeModeActivationConditions.56.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`:\004\225\033"
+	.string	"Vq\254I\260\226Q:4\206\002\301a1\327\244"
+	.string	"\340\026\257\270\230q;\320\177\\\313W\344\272Rx\230\320\016\235\251\375g\212\376Z\022\304p\037o\020x\2409\221\274\311\375A\264o\017\":\303m\216\205\0029Y3\215\020\262\311\226)\005\222"
+	.string	"\214"
+	.string	"\240"
+	.string	"\324~a\273N\367<\273|\245\353h\337\371\2245\242\026\260J\tV\255D7\247nP\236\276\336f<\2559\201\361\3244[\370\036R\375\221\237\220SV\255\3655\177\270\300\305\336].\355\255\222\034\2518\227\346\363\276`\007\274\341jo\2113F\026\216c!\272!Z #Du\237mK2\203\217\"\243\2236>\n=\005-\005\200\263qQ"
+	.string	".\206\250\240\351+\003\007\264\363\276\323\037R\\v\024\031}\311\f\265V\357\rWt\003\270m#\2665\330\242\203\027b\023\206\332\337\f5\236R_U\221/?;\264kk\356*\343\315\337;oG"
+	.string	"\322\315\346\211\355o^\340\215`\320\254\331=\333\316#\373\007\222\226\202\236=l\033r]C\3274g\272I\272\036\351\232\322\265H\327s\\/]\337"
+	.string	"\315\223+\026\242j\035\032\226\251A\372$\351L\377\356k\337G\362_\213;9\200mK\221\026\366\227\376d\273\374\342N\246>a\223\355z\317\367I\230@;\323\254\254C\310$G\244\260j\355E(\037\263F\311i\333\305\251f\f|,\237\372"
+	.string	"\002\007g<\275"
+	.ascii	"\304H\234\301\337\272<\370\234\342|P\316\266C[\2313\300\224\320"
+	.ascii	"\210\321\275X\345 \022\347\221E\214;e\276,@K\306v\210W\021\321"
+	.ascii	" w\225S\252\025\210\002\025\237V\322\320\020-JS.\265b<\335E\312"
+	.ascii	"]\345t\273\377.eg\202\371\317\206\361(>b\224U\255\265\002\224"
+	.ascii	"C\215\360\205\234:\007\006\233\377]4\243#\314\f\"Ij\220\363\363"
+	.ascii	"M\247MtQBg~v8\253\232\354tL':$\217\252\254\233\373L\016t\024"
+	.ascii	"\007>\201\342\260\234\r\263\036\025<:\245a\020X\350\220\210\361"
+	.ascii	"\214\200\311^\260\022\257\024(rx^0\031\213\027\004\004\216\251"
+	.ascii	"\320\221\275zb1\331\313\325\373\371\354\301\001J\360g\332\354"
+	.ascii	"#\326\272\003\303w?\357\003\260\230v\330\232Gn\005!m&\r\262\226"
+	.ascii	"q\341\305Zk-\377\331HN\233y\337)\r\035p\311\236o\231%\270\332"
+	.ascii	"\200\363\032\263\230\240s\264\242TrY9\235\307|\031B2\336\234"
+	.ascii	"f~IX\3632u`\277\344w:o\347A\356KN\251f\372O\035<\354o4\363O/"
+	.ascii	"\251\304\3241XA\001W\250Q0\305\214C\310\310\0043A\215\026(\351"
+	.ascii	"\200\002\031\262\262\016\021P\305tT\213\213\365\f\201\224\n["
+	.ascii	"\366\017\201FD.\225\177L\237\002\2506\253\323Vqd\r8\330\265\233"
+	.ascii	"-T\223\321\304D\251I*\2644\003\324\027\375\300U\267\252\330\247"
+	.ascii	"\020\300X2\302\306K\354\360\007\350\256\264{C\354\224\035\214"
+	.ascii	"Lku%\306h\301\022\220gS\227F\024\257\235\r\213\3056\003\315\300"
+	.ascii	"v\214\313\"\250s\335m\356\001\323\210\220\221hNe8\351Z\273\310"
+	.ascii	"^\200\253V\205\022\245}\304\026\341\260\321$\240\204\221\376"
+	.ascii	"\363\211\204\375e%2\216[T\312\241%a\362\326:\311\344bH\332\375"
+	.ascii	"\3217\246\303P\001"
+	.text
+	.section	.gnu.lto_updateMasksForMac.part.0.66.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\266\001\245\017"
+	.string	"\346\033dF"
+	.string	"\257(\035\220\0315\203j\242\210\2629\371}\240\177\243\311\202\340\305\346\373O\006\023\337\337\2045\033\370oH[_m\270\343l\361\366_\262U\375\250\317n8m:y\"\233\240;x\346\233J\207\005id\023\271S\nI"
+	.string	"U"
+	.string	"N"
+	.string	"\033\273)6\264\335\321\343\323\b\272O\217/\300}v'\300}\332_\261\235jY\264a|,\261\207\2756\304j\273\353}*\211\213W\271\211\376g\3178q\251\256"
+	.ascii	"\\\036.\007|\343\204\354\256\273\017\367\274m\217m\b\266\364"
+	.ascii	"\b\261\373\261\224\257\3423k\304\030\304\223:L\330Q\205,\013"
+	.ascii	"\305\253fJ\033\304#\036&\374x@\304\370\252q\320]\366r\352(\207"
+	.ascii	"]\215\350\370|\t\241\240\373\324\260\312\303\\N\352r\342\020"
+	.ascii	"\260&\260Y\002)?\246\336\202\342\030\267C\313R\332Oq\026\361"
+	.ascii	"-\250\007k\262\300\247\301`\3017\361\351\243\270O\251\247\275"
+	.ascii	"\303\365\302\206e%o\244\252X\267m5\305>\354WNZ~\374\317m0x\355"
+	.ascii	"\262nb,\312\2449\361\231_\366\307\\\355\373,\276\302\247\315"
+	.ascii	"\310\204n\311\204\035\325\270\254\006 j\257\332\203. \222\310"
+	.ascii	"\310\026\272 *\371DF@\244\017\207\304\364\211\020\206H\234\357"
+	.ascii	"3R\177\037\246\020\b\034M\370J\336G\301#\211>#\357+\231\274\017"
+	.ascii	"\003\006+\204J^\t\b\226<\371\331;\331\212\213\225fPU\261\035"
+	.ascii	"@JU\265E$\362'\226\200\242AU\266Go\001v\033+ \200\002\031\253"
+	.ascii	"\354\265\013\374\n\354\221^\001\374\013'4\023\023y:\302\177\270"
+	.ascii	"\266\263\340\260\250\347\324\026\027\274\t i\244\353\211\fj\f"
+	.ascii	"a\241t\002\270\235Aw\266\342\326zx\234\264\334Q\006\341\233\217"
+	.ascii	"\310\303]\037\253\317\370f,\021$\362A\262whg\301L^j\026\324^"
+	.ascii	"\220\234\342\351\327\3421"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.part.0.69.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`j\006e'"
+	.string	"\232G\204\017Ep\236Q:\267\303\211h \003V\356\210\221\016\\\036\335M\371\036\250Y\250jP\243z\254\256\032\375\261'\303\305e\306UF[\334\001\323:\024'\263!\241\\K\274\267Z\243\252\236\345xamO\032!D\312$\003\342"
+	.string	"\331"
+	.string	"\346"
+	.ascii	"\273S\373"
+	.string	".\367Bu.\333\306>T\274'\263\332\325\351\266h\321b\346A\363\225Y\252:K\325\022\005\314OZ%\353\216\3422\357\336\312\305\202\277bc\311\250b)q\230\325\232\\\360s\021\244?7y%\364gz$\364\347\356\253\354\256Uq\203\273w\236LR\257TC\324\262\254\265\362~6\222\007\277\323\345p\351\r=\315\346\241\340\236\354ll\273\372\316Ig&\310s\366\347`\305 \246\022\027\223\255\267)\002\341\\\020\263\t\254\370\203q7\013Dv\004y\332\246\350e6\235\335\t\254\330\305\267\253\235\367\004\214r\255\213\321\307Q\3362\366\370\251\305&\2211\313l\252\265\352\214X\334f\202\343\031\036D\306\241\251\304\246H\235\253\235s\030\211\314G\037\272Y\250\265\356\205__\242\357\356\332\356\212\330E\r\004\177\272\372\023HL\310m\334\310\355\241\233\265\326\272mdW\307;`\307\313\364-\377\322\225\277\200\2247"
+	.string	"\312\253\204\362&\351x\221P\336\243\224\027@\312k\224\362\026\245\274D)\357P\312\273Kyu)o.\345\305\245\274i\216\367\226\362\2428\336\023\307k\246\274\215\343\345'\377;\025h+:\326\312\325F\250\n9\321\232\334\254\f\325\002\237\004q\034Cv1'\263@\263veu\235/\254\344\323\356\002\227\262zN\327\222\367\323\334\375\376\313\325\246\216\266O\343qE9\206\325Z\305\204\221a\326\256\332u\276\226a\313\224\247\036F\306\223\225\213F\3272l\231!\005s.\373\263\325\335l\035@\260z\031p\213\016 \004_\006l\272JV\256\t\3078a\313Z\223O?\267BJ\026w\270\302\216Vn\215\\>\237\316\246\202\003\350\034\273"
+	.string	"\372\250Od\023\242\215,4%\311\362l#k\324\271\266\241\003\220\022\315\351\274\250\215>\347D]\324h\232\026\330\331D}'^\200\210l\302'\021\224\307\314l\344\016u\256\373\2162\315m\270\353\241\3564\255#\223\256w\215\332\321\002\033\266\256\257\366\023\314\013\017\221M\210\205\353\\\243\177\214\240\244\215\353e\255>\267N\333DCd\223\372Z\210\264\326*a\377\346pD\354\b\022\374-\022\350\317[C\220\203f~\323\320n\264\033`\0013\\\333r\034r\333\366\371\314\017\233!\335\310\263\315N\241T\203\305\202J\274M\037\220s\2655\3615jn\2348\217\002\375i\266\022\035k\216V\304\270\273\271\020\221m\267w4\276\264V\254\b\37337~\373%6\320\237\334?\0135~*\2408\274\370AA\365X`\2501\325+\372\321h1\303w!\005\325\017\352\346\002\330\363\240\002\252w\363\365`\364\372\030"
+	.string	"\177*\242`\240\360I\361|+xP-z0x>) \217\001\323F\305\370I\361fDEI\361t7\353\323\261\2665\302\036n\337\334!\340\001}\264\023\252\"\020g\320\006\237\004\241\210X\016\350\242!\205\002\211\351\032\271|\244\326Zs\215\344'=\256<(\005e\352\023Q\2461\300\273A*\301*\374-\246N\032\363\263f\330W8'\016\320K-\240\337\273\301+\027\370[\333D\354\253U\352"
+	.string	"\005\316\b\r\327\306\330\204\265\326\253\264\221K\300\315\027\261\f=\332\340\306k\254\214\317\347J\235c\017D\223ZJ9\207"
+	.string	"#\365\321\276\247*\255U\370\255}\236\353\321\260\241\252\n\345\320\201\277\225\324\024\204d\365\325\356z\270\235\017H\034\200\201\250a$\305\214R\306)\231\031\021ia\222\306\220\002\221\252\252:\021\260A\253\232\202\322d\332\f\266\327S\3743\363\n\267\302=E'\376\353\220\003\301\240\001\254\222\250 \r\222`fF\232e\240\216\002h1\013B#\301\021:\346\177\306$\237\215<\374f\353\360\224\357\023@Y\341\317E\364\354\250\332\200j\332\323X\030/\211A\245\2666\245=\320\241\363\264PJ\235\032h\362\210m%|\212\252\303c\225Ld\004\351\233{W\254\317\205\374\351\004\223\261\213\237\237\371\310Z\b\350r\3727\331I\345\260\313\f^\007o\005\251e\253\340\306"
+	.ascii	"\342\236\2127N@.3\217(\021l}\224\214\305>\353\f\023*\005\235"
+	.ascii	"\203P\334\320\315'\213\004N/\2705S\234\372M{X\241\013\025/\n"
+	.ascii	"\266)\005:*\362Lr\367n\222\216\226\"\243\\:\020\200\377L\267"
+	.ascii	"\326m\241(p\334\353'\344!\246\330x\033qT\355m%\2121/\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`\365\002\315\020"
+	.string	"V\031cG\020\355\246\003(MV\250\256BhF\227\317\305\324\350\270\017\333!V\b\216\241?\007\322`\231\240\373mm=\342\211\315v9\002"
+	.string	""
+	.string	"@-?H\007\t\024\260\363G\331\030\311\006\250m@5\377Qd\267\225m\022%\231RN"
+	.string	"U"
+	.string	"M"
+	.ascii	"v$\244\200\307<\211L\267\"\037)\035\330+\344S@\036\205\3241?"
+	.ascii	"\236\201\244\307b\261\230\307\237\200/\263\343M\244[\016p\343"
+	.ascii	"K\244\351Q-\322`pLf\226\241\325\360=\211\311\206\241\230\201"
+	.ascii	"\371\231;\330t\205\265\326z\317-\311\314n\"\355*\216=\346\271"
+	.ascii	"\007\346\017\274<\002\227g\236\324\033hy\030\226wik-\363\267"
+	.ascii	"\3621\255r\232\314\020f\0368` \263"
+	.string	"`&\201L\003\024\267\270J\031\231\003X=#P>%O\276et#Tc\362,\033;!\206J~E\202#O\n\324\253H\022\220\351\001\236\205-\203V\022X\332\346}\271\255\264m\276]\315-ZTs\213\3334\032\232\003\270}\242 \002\207\323|d\2415\\\021\204\230\272\3506\203\360\031\272\300Q\027\215\034\365\3546\277|0\344\224\250\367\330\255\003{y\350\250\253\332;\352`\027,\022\273O\224\250`c\"9\370\221L\030\276\375\364E\315\017\320'\300\275\333\027\034`\033\272\352\336H\240z\351z\325\273\026\255\236q3\002\204\3359\037\\;\264zF\242{\002\013\005\316V=\033\333]A\253\233\256z\213\\u\005*\360\253\001= \240\002!\242\353\006TR\340d\204F\275\247\326\236\360s\0271\362>\215\360\035\315c\270$@\336h\226\346\252\344\026\231\270\247te\303\303\036\007!\220\332 )\032\246\212"
+	.ascii	"\031\031\034\202\003;\301.\021\034\001\207/\220TY\332\2170\017"
+	.ascii	"\033o \300\032F\242\036\215g\353\370\341\016\331*\302\017:o\b"
+	.ascii	"\302\250\345\201mH\303<I@\232\204\371\370\303[\236\027\005\340"
+	.ascii	":\264\315\371\332!\351\262\203\363\021\321@\234\375\255\033y"
+	.ascii	"\260\234"
+	.text
+	.section	.gnu.lto_.refs.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375 \325m\004"
+	.string	"\322K\037!\240'\031\016\377\377\377\377\377\377y\201U\232\264\317u\377?w\263\233lIZ\333\255m\262\367\2262\005\013\260l\360\205\354D\355\252O$;\255}X\237\362\2626\325\002\322\213r\204%\303,\370\3217\375\322_\00703\234\275@\256\300\235\260\036\241\177\3207(/H\236@=\003\375\352'\375\366\025\375C\037\225\037d\305\232db\017$\336H\034\241\021\345\003}\354\235\315\312\036\271\375\r\001\004"
+	.ascii	"\243\022\341g~yM\212\022\224/"
+	.text
+	.section	.gnu.lto_.decls.2ae75c8f77ae44ce,"e",@progbits
+	.string	"(\265/\375`($m\241"
+	.string	"\352\377l8Q0\022\322I\007^\317\026zfv\357\273Z\254j\247\350\362c4\264\327,#\351\221\037\243h;vG!\255\205\202(\353\343\317\026\216\245G\022zE\035-\214\b\250\252\252,\312*\253\250\"*\353\016\334\322\230;\332s\024\310\032\001>\221D\262\245L\001\367\002u\003\220\003|\300\016\363\0017q[L\264\024}_\251I\223\3660\367\243\252\317\207\203\360\"c\327\350\373\007\2323\350\224+l@4z^\371\f\363\035]\317\360\030\336\333YZ/\024"
+	.ascii	"J\\8\262\370\251\340\331\223\"\342\003E\337M\365\274W\246\237"
+	.ascii	"\367\006\320MC\3004\177X\017gi\275i8xh\252\324\006\325\026Ag"
+	.ascii	"2$R\347\324zyR18\253?@5L1K\311X\243y\353Z\b2X\310\222\320\251"
+	.ascii	"\177@\013s\331Y\352\271KX\\\272\316\3568\313\334\027\266\343"
+	.ascii	":\306c0\274\362\035\317\235\2730\335\321\365\3365~\342\205\271"
+	.ascii	"D\301\nS\366\007\361\035Ca)\326\211S\235\202\225\307\307S\370"
+	.ascii	"\216\331\030\213]\273\324\035J]\370\356\275*T\370\250P\241\""
+	.ascii	"E\003b\307\226\203\236\345T\276l\"\355a&*\032o\301y\362\200\306"
+	.ascii	"\004S\317\\\3529H\020>9Qgf\242\032=;\251\3478^Y\216\257\234\251"
+	.ascii	"\360\332y\275w\275\367\336\005\034\277\355,{\256\222\035\226"
+	.ascii	"\256{\327?\360\007\375-\\\260\034"
+	.string	"W\3417\273v]%;\267\b\226j\242x\371\335\273\372\250Pq\203&\326c0E?T\177\202\312V\270\215W\024\354\366\026.n\227g\267\354\336\225G\247\315X\0336\215>\004\365\214\"\345AF\221>\003\365\024\250=l\"m&\221\376\260\211\224\325:\260\013\030%\215\236\205\032\345\n\250\247c\023i?\377\300e\214f\233L\317\253v\357:\342\006-\013\031\263Qf\302f\2742\332\317N\370\354\350\331\363\246\335\273\352Xf\024\027+\215\246`\023)\312$\322s\223\357\324]\027o\365\374\223\362\360O\372\225M\244*\223H\305~\036\353\243\bt\223\340\004\006\376\026R\024\203\2140{\027\340\357\273\237\357\006\205\177{\3416\0130\340K\374-7\243\331H\374-\205\t\253\241\271\035\2133\367\362\263\231;\023\270\347g\027\300\354p\001\301G\300\3365\370\373\310\317%\214\361\273\211\277[\260\230\255:\274C\371\177v"
+	.string	"\376\026\212\373\017\347\363\237"
+	.string	"\236\277\237n8\372w\r?\373\220\207\363\367\361\347 ?g\375\214\365\263\325\317=\374|\365\363\0200?7\177\256\372\231\352\277\316oI\370\031\357g\271\237\245\374l\3663\331\317`?{\375\314\365s\221\237\211\374\214\374\031\351g\031~\236\3613\321\3172~\216\341g\030~~\341g\026~V\341g\023~>\341g\240\237C\370\031\306\317\031\374\214\301\317\025\374,\301\317\017\374O\341g\003~N\177\026\376\017\374\237\367s\001?\243\370y\200\377[\376\373\375w\373\371\304\377\276\237}~\016\340g"
+	.ascii	"~\036\361\037\205\237y~\306\371Y\375\337\346\277\340\1776\377"
+	.ascii	"\001\377\247\371\177\346\177\230\377h\377/\370\257\345\177\317"
+	.ascii	"\340\340\340\340\237\252\377M\323\177B)\367N\255\320Y\362\266"
+	.ascii	"\303\325\016gg\255\006c\351t\263%0\b\252\216\362V\333)\343c\315"
+	.ascii	"T\243\r\205\337\3222\256/aOx\234\356\231/O\322\216\200u=\203"
+	.ascii	"\300i#\030$\007\032_\271\301\002\242\3466zt\307\272\366\312\177"
+	.ascii	"\274^\247\t\362\326\025\267\201*\023&m\006\343b\355\340y\242"
+	.ascii	"\311q\326h\233\341(\361\302b\03236\326?\250\313{\311\264\341"
+	.ascii	"\3231\373\302F\204\354\375\003\032\020)\2739\260\203u\030_\347"
+	.ascii	"\275S\327\212\371\263Ql\322\274-y\207\361\037\217\022\030\022"
+	.ascii	"6.:bzw;4z\273\246bu\027V{\245\367\362\372tr\336)\347\317\337"
+	.ascii	">\274\275R\246.u^\215\266\222\336\022B\2112\202\244\265n\202"
+	.ascii	"\234=\237X\365\325;\353Y\235D]\336\273\\\257\023\243\225MM\375"
+	.ascii	"\314\b\213\013\303\365N\36229\227\200\020f7\234\300\032m#\275"
+	.ascii	"\205&\231\202\223\332B\302C\224%S\362V!r8\240\216\360\034;\327"
+	.ascii	"\364\270k\264\213\244O\262\330\006\033m!\255e\313\276~\200i5"
+	.ascii	"\221 ruH\372R6D\256,5\272\366\220\353l\002G\326\350\323\360_"
+	.ascii	"\216\016\250+A\032\275%So\255\316\351e:\357\275P7\353u*\345\234"
+	.ascii	"o\230\177~\035\266\214\300\265.\350\356\005{\366\251^V\230@R"
+	.ascii	"\334\377\336\345\210\273^g3\355j\331|R\3674b\275V\001\334\264"
+	.ascii	"\254\333\\\257\236\320\347\355\273^\276KWO34\327\247\263\271"
+	.ascii	">\227=w\351\271\274w}\352i\2521\227\334L\273zj\246=\237F\334"
+	.ascii	"\245\273\274iL+u\351\371\324\334\362|\352i\2461"
+	.string	"\237\232KWO#\276\236[;\354\270bva'\315\245\313\243\211\212\351\354\241k\256\317\233w/\253\335\270N\004\356\245z:\363\230R\334\246D\307Ci\215\371\344\023MJX\317\273D\327\374z\336\373\245D\3436A\260\\\351n\021\246[fQ]\246\033\367\n\320t\357\222/\335\275wy\357\025:\251\326{y\350iv55\335;\345\323t\251\226n7\356m51mO\3154\254g\220\033\224\264\256\213c]r\327\315\273r\252iK'\227\351\336\313h\324\256\247\036g\032\345\262/K\3005\255\304T\030\217\252*Nc\2330\262\314\361]\247s\305\373\013\220\265\201p\032\237\365BY\300%\352\313\357:\247V\b\241\250\335A\001[\313r\234\234\216<\033]w\266x\024\251\232\342\273\326\343\332b\222\352\250\346:\202\227\222\254\2355\332>\372\307;\252{\334\216\202\340y/\263\243x\002\357e\3620\037\300|"
+	.string	"J\206\225dJ\227\3727\324S\357\020\304Ck4\317'\305\363\023Ks:a\361\373\301L\243o\247\277\233\232\007\277\305\200e\265\344\256Q.\261#\350\315$\202\212\026\301$\215\222h\035Q:G7y}\216\t\366\362\335\374\233\331J\215\203\237\367.\261\016e\232"
+	.string	"\033\355\245\326\201\327\023}\343\206\271\336\225\317h)=i\2518\334\313'R\036\034\344\023i?\331D\252"
+	.ascii	"\223H\373\006\275\227;OcO\2464:\202I\244'\204an=\fi#h\357\223"
+	.ascii	",\257\321 \326\265\313\226F\270\002Q\360\254QMY\314\346O\370"
+	.ascii	"\003\020Xj\215\362_\263\037\003\236\377xM\316\022\377\241\367"
+	.ascii	"29\026\316KHZ\230\021\365\r\250gQOn\327\373\227\036\223\231F"
+	.ascii	"m\333\343\246\300\370\021\261P\346\260\354\224\032\265l\267U"
+	.ascii	"~\034\234\267 B\256\256\326\360\200tU\251\017\021\265\256V\212"
+	.ascii	"\225\320\317\231\345\206\332\255\2245ee?\032\265Q\354\027'S\233"
+	.ascii	"F\355\231\205\362\324\205\215\225F-\232M\343\365Z\354\223\357"
+	.ascii	"\274\341\220\242\305I}\016|-\251u\"\234\302\003\0333\204RY\231"
+	.ascii	"5+\241\344)\t\225_N\023\300:&Ln\315\322<\2413\3432\351\234S "
+	.ascii	"`\\X\230%K\243x9\322\347\247Jy\215\345\260dv\214\f\020\203\201"
+	.ascii	"V,\207\031U\305\213\022\3658F\300\300,\027\2311>a\031@\253 ]"
+	.ascii	"]\326\213{V%1I\370\344\312|\370\260>\334z\351\214\271!\231\322"
+	.ascii	"\250U\362=TM\221%18P\352\217\330#\226\213\317\226D\202\370\261"
+	.ascii	"\177KWcz\353\226K\250\203\311\221\247"
+	.ascii	"F-\222\353y\t\013\333\372\271\016(j\224\362\212\330\"\275\005"
+	.ascii	"F\317\275XM\332\306\270\310\340\236\250\3471\356\276[%^\273\317"
+	.ascii	"\022\361q\262.w\346\366\250V\330\274'!U\032\035\262.\255\241"
+	.ascii	"1\343EL=\227\341\2609\314\306p\027\035\266Y&\346\311\366X\322"
+	.ascii	"e\207m\356,G\334\233\025\246\253\007+\304f\331+\373\264X\274"
+	.ascii	"Z+\353\343v\311\352p\237\365\336\2455ke\231\254\223\351\2642"
+	.ascii	"(\313\343\2637\254\354\017[\305tS=w\251\312^\b\035WtU;(\216\353"
+	.ascii	"\021\240\324\204a\246\307w\357Je\203\360j\253\356c\253l\224\005"
+	.ascii	"\302tS\353\205\022\301\346\005kJ\305\t\025:g\276\344\001I\201"
+	.ascii	"\360\260\263\266\022A\323\250\335aJJ\213\016SR\274\332)5\215"
+	.ascii	"\230\033\233\353\211\2203\202\245\376P\257:\251W\231P\352\035"
+	.ascii	"_\325\\\240z\241\237j\233,\017^\027\260N}DP\n\332\236z^ \265"
+	.ascii	"\203\203\274@z\241\030\365\302:\365B.\352os\330fZ\226\2769\333"
+	.ascii	"|\263\343\302\244\204EM\361\303$\322\036\264K\313$k\033B\305"
+	.ascii	"M\275\275#\030\351B\245Q\224\037\227\266\340\273\315\217\323"
+	.ascii	"Z\222t5\255\251o6\035\230\307%\305I\243\027\246\251o@*\203};"
+	.ascii	"4\332\177\352\r\341\222\005BTU\351\241\377\376^\323~\035e\303"
+	.ascii	"\240\340\232F\237\307&R\2354Ao5s@\3605i4G\350\343\314\231\216"
+	.ascii	"\213\"\005\210\214"
+	.string	"\225*}zz\315G\204KhV$N\314\336\233\017\375\003\024l\322h\227\331\351\241\246\r\222\336\n\001(\005u\244-/\257\307\250O\332D}\371\205x\002\342\320\022\363\036#\f\034k\002\245\303\244>\340\341u\030N\230\250/1\034\037<\374\252\032}\n\365\345K\207\tY\363\341\313YW\243\2771SWGf\013\035];\3354\3216=\276(\352Wp\317\255=\3678\030\034\210\211\341\273\316\273\3427bXxm,\275\005\247\211\252\331\343\343)\036m=\266\374\235\245\265\364S\013\245\300lai\264\304]\231D\372\233\036\352\332r\355\364\263\336e\tc\242\276\374n\226\340\340:\216\357\275\313\021\365%f\261<\347\202\304\335\324}qM\331[\353\267\265vcck7\025\255\2135\222'\270\245\355\355ve6F\257\321\266\202vY\321A\325hWAr%\313\030\032\247\036\375\232\302kO\351\346\317\363B\245"
+	.ascii	"\343\263s\372\005D#\031CeR\f\003|\210\310$$\024\351h\310XD*\223"
+	.ascii	"@D\242$\243!c\021\b\231L\002\002\300\310(\311h<\032\2055\034"
+	.ascii	"\2214\224G\243p\306\220h\204*\211\311#\342Q\252\024J\221\307"
+	.ascii	"\026\200\206\b@&)\207\304\031=\247\301\002(\211$\322PD\022\t"
+	.ascii	"\240\024"
+	.string	"J\252@<**\325\344\0219T<J\221F/\224\304\017N\203\305PY\224\001d<\036\035\035\207P(\211((\2132D\330@:\276@@y\032,\212\220\200\212\220\206\214I\036(\211I\021\306\031\255\274I\n\025!\345(\205\214EH7\306\"$K\264\241\230D\223I\"\222\210h(\264\201t\034B\221J$KD4\026\025\215\206B\"b2\t\035\"&\205G\n\025!\261\320\261\201T&\213E\304\023\016H\332`\303hh\034\032@DD&\025\025g\030\217/\022 \322p<\"\"Q\030\2404\022\223Dd\t\311b\n\021J(\215I\307\027GDe\322\006\nBI\005l\f\221H\r\206\2061\206;I\"\242rX\342\004\n)N\203E\r$P\r$\211\241r\310\301\0202%&\213:;\306\016\222  \213\303\036\025r:X\001\204\024^h \324\001\007$\304\020zq\202\020\n \214\030\341"
+	.ascii	"\013%r\210\304bh\030\003y\364 )Cr\030\203\250\034\022!%\371|"
+	.ascii	"\250\210$\032\211E\352!\210\240\201\b&\250!\374\004\0248@\201"
+	.ascii	"\003\351'\240 (\210\202\b\202\324G\020d"
+	.string	"\211\210F2\206\311\"\007H\"\r\035$m\3100TT&\003\370\220\f\311a\214\030C\310\022\310!\215!T)\024A\220\322X\024\032\035\217\033\b\335(\223B2$\207G\312\342\0065\2162r\224B-\036P\223\312\242\fTyL\201\210(\203\261h\244&\205\212D\306\343\013\343\261\250\034\322PT\016ip\202(D\004B\215\243\f!\021\bi\r\"\221\021\204\0275\222\206<\312\3238\361#\022\021\t\244<\036\221@\"\210\214DaR\350\004#\242\3218\2441\264\243\024\232@i,&\t\221\210J\024\224\310\2412\211C,2\016\2217D!\021C\305\242\243\b8\017\nz\221B\205\021>P\207X$\211D\307#\241!$\320\320\f cqx\0044\204L\002\261\360YZ\262\274\254\261\035\215\342\325e1\271\032u@k}\256ma9Ii\324\n\266\r\264mn\005\037\302\251\265\256V\320n\341\261|"
+	.ascii	"\017\223m\314\\\212Z5V\215\005\304\031C\325\266\346\026\320\376"
+	.ascii	"U=!\333\263\177\326O\247\t\227\233\026k\307EK\255L\0323\236\274"
+	.ascii	"\247\020\246>+E\207O\352\271\204\246\223\270\320\353#\273\262"
+	.ascii	"\323\245CL\252\315\310\3215\031,\322\250\325\263zv\217\235\316"
+	.ascii	"%\232\004\224\310L\371\370\371m\231\333\275\336\n\361\324\344"
+	.ascii	"\f\\\334\017\267\037\270\304\221q\313Y\"\350\3246\246\275R'5"
+	.ascii	"~7\304p\251w<\270\366\302X\257\301\267\346\355\274\336\"b\360"
+	.ascii	"H\037Z\243Xn\271`\261x\266\256"
+	.string	"\347*\335\333\305\027G\024\245&\337\230\230%pt\267x\267w-\\<\216\327\362\272\264\032\265_n\341\212\240\201\322\264\263pJ\310\254\3255P\005h\025\350\345Zu[`\215\266\355\362\275\234,n~@\032\265s\337\323Ys\242E\265\345\266\212Y\334\r\273F\255\026\036\302\203\256.\213\031$QF\332\324\207\220B\345\326\n\025+g\361r\356\362\354:\t\255`\361\202\363\273\315\251\037\021Nv8\361\362v+w\013D\013\027\327\023[\202\307l\324\306\335\302Mqy\343\273\022\202\370\250\222\2714\b\363\0303\206JFd$I\222\306R\n\020\204\"q\"(\352\035\022\240\3654Q*\306\220\314\210$%I\322f\\\2071q\264\266\030\024}\224\222\321\306\230V\213\f\275\226\245\335\177\371\351O\262\367\365\237\320\302\366\237{Sh\343\037g\203\032\255\302>\203\374\003R\262\325\301\317\321\016\313\374\212\315\363\320g\206"
+	.ascii	")\215`\303hC\016\202\b\237\34394:@\032\316q\235\3772l]}\034\317"
+	.ascii	",\312\317\261\021\307\353Y\321_\254\255W\352\247\220|\263\236"
+	.ascii	"\037#\"\356\007O\310a\224\202^\243\314v\245\302\361\366\001R"
+	.ascii	"\006m1H\244Y\305\3207Y\345(d\270\326\254Y\205\245c\205v\372="
+	.ascii	"\b\343\2608\315\270+\377$0\016<\242\260%@\320\304\366\361\002"
+	.ascii	"\023\027\024\372w\215p\022\020Q\227\271s\353\311!\026\312\357"
+	.ascii	"\024+\361{&Y3\355M\353hsxi*;\024s3\230\202\223\344S\233\360\252"
+	.ascii	"\277Nf\264\274p?\351}\351\355\023\260\247\337l\016\370(nZ\220"
+	.ascii	"\355C\244yr\026\313I\254K\360\2028\306]\027)\016\304KX\333[\341"
+	.ascii	"o\310\230\322*\227N\006\002\344\326@\245\007pc\3326\262\354\314"
+	.ascii	"\365\273\205\302l\255RY\225\240\376\333\227\002\260\337x\207"
+	.ascii	"\032\301_l\356t\216\036\224\230\354\332\332\023S\353\345n\203"
+	.ascii	"!\340\207\b#\n,\371\n"
+	.ascii	"\006\336Y\236\250wt\2717\370\272\005y\013>$K\025\\D\2235\013"
+	.ascii	"H\314*\213\363\312?T\003\233F\242\222\026\354q{\001o\316\320"
+	.ascii	"g\372\263\306\207\362*P\261\374\\@\032,1\353yv8\300]N6W\026\265"
+	.ascii	"\335\205o\234"
+	.string	"\267b\225)\254\355\227\017\002x\035\215P!\261\370A\221\300S\203~\220c<\325\002.\225^\200\003x-~^\312N$\342w\310<Zf\244\316U\037^~p\036^\300\377\214\203\306\035}\356I\2417\236\325\324\227&YA\002\253(\332&\260\276Q\355_\016\311\bk\226\354\351\273\204$\240\365\350R\247\004\017\324u\302\340\013E\020\320\234>AE\242\350\360\311.\375G\013\244pJ\034\350\340_Z\357\343\005bu\374G\361\t5-L\345\204@\275\177U\255Vs\n\021\360\261\236L\033a[\332\221\247in27O\006\t5M;\312gp\2677\032\304\302\025\226\316\354_\215O\275{J!\027\346\337\310\200\203Q\230\242\320BF\260\255d\363a,6\362\264>-\327\205\212\326\362\377\025\305\316PK\342\322\0074\004v\021\235\223\250:,j<\310\013nK\f\312\213\b\365\352;\277\203\234\344-\3764\016"
+	.string	"i\2151<o\234Y\357{\262\224\\\027)/7\201T@\207X(\334\306\337"
+	.ascii	"\342FP \370F\335\231_\375Y\007lq\031_\375\2148\036\266\204I\344"
+	.ascii	"\037/\361\227\347\033\234\034\200{K\372\334\212_\252\255\240"
+	.ascii	"\346\366\210\003\017\025\271qQ\334*j\210)\377Pv\374\300\261s"
+	.ascii	"\2666\036\322bC\273\263+Bo%1\214\313\330h\013\276\317\313&x\003"
+	.ascii	"4\366\356\213\001\023\330\242H(.\215\244\250@v\271\302\201\304"
+	.ascii	"7Bf \005h!\032 \247\325\323\022\022\2478\241U1)\267\341\210\273"
+	.ascii	"\367\316\206-\t5(\241\021\025\310\200\242$\270\333i\243\003\235"
+	.ascii	"\232K\303\314\001vc\252\013\344W\213\262\356Q\204\242)}:E\347"
+	.ascii	"\201\374\035.\2603\007\340E\340\330B\027\331\247s\034Q\353\254"
+	.ascii	"\236\265\217\021\203\316RU\025Bu\3243na\301Xg\257\373%\317-F"
+	.ascii	"`\257\240@H\367\246'`\240\217^\"\273\237\224W\203\303\227\377"
+	.ascii	"S\2422IQ9;C\032\232\300\323\2264\241G\206mg\3116\345\244\250"
+	.ascii	"8Lh\2062\231\235\304d\363\003-\237G\332q\201\375*\260\242\033"
+	.ascii	"\3279\3234?.\317\262\225\322\004nL\341\017"
+	.string	"\267\270\353\215\016L\370Ki\233\310\235\204$\t\026\034\344\241u\303\240\336p2\263\321\201\315S\220\374\333\324\270p\032\313\b\236Q\233\356\305\f\0169\313\312\177u)\003b\3349\363\b&\201\361{\303\350\337yU\363\34745(\307k\256\351B\314{F\244\fD\004\t\016\202\374\373\323]q\206q\264\242\220\360\313(\210\202\224\261\030\206V\021\023\007\2733D\256U#\247/[\274\022\230\"\032\030\232\0235L\364\322(<\252\322o\2128w\214\204\241\007l\005\267I\257\023\262\326r\3603\017v\024\022@\303\260\345f\004\212\n2.I\207\317\243t]E$3\241\227T\201\222\347\357\016\357e5\334R\212\221\367>t3\bP\353,\016\314\273\341\360\376\b\366\203\026<\204\333\263\020\3771\327\373O\256\301\361\033\370z\033\332^o\276n\212\3321\364\376\206#/5\347\013\223/\205\276\016\333\207x\024c\345\342\005"
+	.ascii	"\357:\276\001q\212\377i\350\021a\206\270z\335o\001\212\006\340"
+	.ascii	"\217\346\213|;\246\363\276_{_\371\016\356\362\341\227\253\327"
+	.ascii	"\334\263\270\037J\314\320R\377D\216\320\333\241\215\217\221G"
+	.ascii	"s\315\340\\\250o\253\223\265^\325\245m\366\271\016g\257\360="
+	.ascii	"\235s\275^~\353\363\376\377\036\210k\311\013p\037~\247\253\374"
+	.ascii	"\003\333O\274\225\216\237l~`\263\310\216\267\034\230\345a\230"
+	.ascii	"\037zP\354b\315\\\340\263I\221\207a\232f\365\304\315)g\210\347"
+	.ascii	".}\231\223x\237\370\235\277\300\034\020~\322\214\020\037B\031"
+	.ascii	"\201\034\261\322=\343wH\232\357b\225\031\337\275`lt\351\223\361"
+	.ascii	"0\342\254\354S\222\037\300\204!\237\301\254\276_\343\027l.\257"
+	.ascii	"\005\267\032\367\205\355\364\035\341\037;\275\2713\372\314\375"
+	.ascii	"}z\177|_\216\257\276\017\337?\324\200\373\316\373k\316\324\261"
+	.ascii	"\253\343%|\206\\H\376\316\241\\\347\350\2346\244\025y\223\254"
+	.ascii	"(L\311\177xZ\001"
+	.text
+	.section	.gnu.lto_.symtab.2ae75c8f77ae44ce,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"updateMasksForMac"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"updateMasksForStickyModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2ae75c8f77ae44ce,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
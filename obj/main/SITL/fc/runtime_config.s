@@ -0,0 +1,555 @@
+	.file	"runtime_config.c"
+	.section	.gnu.lto_.profile.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 \300\315\003"
+	.string	"\024\005\264"
+	.string	"\020"
+	.string	"\354\270\344\363\013\004\002"
+	.string	"\001\352\263\360\321\b\002\267\204\341\306\016\003\342\201\222\246\004\002\004\354\206\342\366\006\005\243\276\342\320\003\006\002\001\006\007\320\253\336\204\013\b\220\352\317\274\f\002\t\n\013\f\002\002\002\r\240\252\372\323\004\016\017\352\263\360\321\b"
+	.string	"\020"
+	.ascii	"X\005\246!\037\344\240C><\207\036\362\216j\206[7\317U\200\357"
+	.ascii	"\315\355q\3512\32428u\312\r\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 L}\001"
+	.string	"\320@"
+	.string	"\n"
+	.string	"\001\001\002\003"
+	.string	"\003\004"
+	.string	"\003\005\003"
+	.string	"\001\007\b\n\001\013\f"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"*\2033/\003C\260\020\201y\215\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\004"
+	.string	"\022F\023\034\240'\351\377\211\254\3702\325\322u\357\267\370\004\376\377\377\315\254%\344,ido\271S#r\f@pG!\201\b\\\336\376\323u\250\2033\020\016\2133IU8\026\311\207\247\366\376\253m\333*\367\277W5\325e\337V\025\231i\274\331\216\036"
+	.ascii	"(\026)\3409\234%3GIA\261\344\200\320\270\302B\035\b\200\006i"
+	.ascii	"caV\271*\00566\242\277\b\026`\206\003x\340\330Q&@;`\016\030s"
+	.ascii	"\001-\260\201\225QR\326u\212&<\305\2779\203KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 f\365\001"
+	.string	"\204\002Z"
+	.string	"\n"
+	.string	"\001\001\003\177\002\003\002\003"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\005\004\002\002\001,"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	"\007\b\005\n\005\013\f"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"*\203\201:\004-\313\371ng\375f3*\370l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\002\230\004\003\204\004\004\204\004\005\230\004\007"
+	.ascii	"\230\004\b\204\004\n\230\004\013\230\004\f\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 \364\255\002"
+	.string	"t\002\350"
+	.string	"\n"
+	.string	"\001\002\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\002\006\001"
+	.string	"\007\b\001\300\001\002\005\001"
+	.string	"\013\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"@\026=\027\266\354\250\331@z\003K\305\335\305"
+	.ascii	"*\030=\027la\2663\207b\345\247d\002\362\355\271`\013\263\235"
+	.ascii	"9`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.403565909d3ab004,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_armingDisableFlagNames.13.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`\256\002\265\023"
+	.string	"\346#\206L\220\230q:\244\313\254\314\323\211\227i\017\236\353\003\267\3655\002T\253\200(\022\001"
+	.string	"\314\bd\004\b\240R\372\006\365\310\003\227c\333\204\007.\006\fa\025\375ca\357&y\322\360\372\3720\267\235vF\004"
+	.string	"8\3518\002A\203\333BI\006t"
+	.string	"s"
+	.string	"r"
+	.string	"@`\372\364\336\272\350\320\311\254;0=\272\267\001\226\320\031u\302\275\025`\003\235Y\321{;`\006J\243\n\335[\0021P\032\240{[\300\005\257F\035\002\323\333\2755\260\002\255Y%\200i\204{{"
+	.string	"\205\221\215\232so\021\2300\262Y_\367\366eD\221\003\225\002\2306\270\267\t\376\362\335\366A\030\325\326'\rQHH\351/\334\036\201i\352\336\266Sw\312CMGr%_\362&w\372\223?=\312\245\234\312\241nE\346Q\fl)($\013\025\036\364\257\334\0264\335*\274\313toSSnw\305\201\351\227\356-"
+	.ascii	"(:\030U\351\336\252\234\024\301\254O\272\267\226IO\314\017\230"
+	.ascii	"\376\303\275\375\376\362%\321\305t\270\267,Gx-\225\303-\242k"
+	.ascii	"}\303\275]\t1\n\325g\270\267\254\037\274p=\206{\333\322#'\023"
+	.ascii	"\346\230Y\235\307\223\214\275d\264\314\352\233\2341\333\316\262"
+	.ascii	"t\215\331\245q\255\237\234O\320\016g\353\321\345\210\202\320"
+	.ascii	"^\210\363\t\203r7]\210\353\r\205-\005\275\023\352\351\205D\273"
+	.ascii	"]/li\034\361\214\325LY\306\254~\210\2138\211\227x\322O<\305U"
+	.ascii	"\234\305[\374\305a\\\306\225N\3435~\3438\236\343\353w\234\307"
+	.ascii	"}\234\351@\036\344CN\344Ff\036]f\036X9cY\265i\226\344Nf\351\235"
+	.ascii	"|\203]_\217/l\2221\374\332)].\315\203kx\246\223\301\3061q\026"
+	.ascii	"\277\036\311\363,3\316\271\352\221\204\315\360\327\243\2103\214"
+	.ascii	"\325\262\214\307L+g\253\276\301%i\333\025#\261\370u\214\024U"
+	.ascii	"m\312DU\237\246K\3254S\246\352\021\002\017\2113\246\255\332\244"
+	.ascii	"\301T]3m\243\216\030. @\303)n\004\263\342\336{ '\306`\215R\256"
+	.ascii	"e2\037dB1\3323\371\275K\344\361\241\324`L\\C&N\303\r\343e\212"
+	.ascii	"gBr\227\310d\267K\347\201\200\034\231d>\223[\313d\353\313\244"
+	.ascii	"o\275<.\2433\221\371Ld\236\311m\335\315D\307\326\335L\b\3467"
+	.ascii	"\234\""
+	.text
+	.section	.gnu.lto_setArmingDisabled.15.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\275\b"
+	.string	"\326P=7@\217\322\001\230\222|\275\223N\002v\tUX\223\354\376\177\306\f\004.9\250\361\266!\2729\013\030\f\373\327GN\226\001\231\344\031^\330\331N*\367\3044![\312\224\002+"
+	.string	"."
+	.string	","
+	.string	"\027\310\216\271\263Y\376i\354G R-\227\335\215\232\361\356\331\371\0079\306S\231\236"
+	.string	"\n\273\353\364T\022\267\336\366\201\355\004\333+\001g\375P\323\231\351g\031\205\nA\311n\304\353e]\030\nG\306\366\323\276\307?\272\263J\306\354^\244\230\354~\b\326\004\0343\370@v\f\006J\242-\257\005\3525\365\251\t\324C.R\3627<\"\345\275c>);v\315\234\264:,N\371\262?S*\206}\270\273k]\331\001\236MC\007Z\323x>\235\320\2461p@\037Qh\304E\255\023C\237\r(j\334C\324\024xs\340pQ\264m\\\314|{\270\272\362B\205\353\244(g\f"
+	.ascii	"2\241\335/0.\020\0047)&R\031bQ\366\025L\271\004K\254\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_unsetArmingDisabled.16.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\r\t"
+	.string	"\226Q?9@\305(\035\240\256A\322\233\274\032*\330>D3\206\2014\270\323\345&\232!0\257\3547D7\327\302\225e?\373\263i\206\021\207\305\034\234\261'\311\274o}\335\b!R\246\024,"
+	.string	"/"
+	.string	"."
+	.string	"\307\256\013d\307\374\331(\017/\366!\020\246\325\312\356F\265\370\367\374\374{\374\002\236FO\213\302\356:\301\223\304\255\267}`;\3016\200\366U\377\225i\325tf\372\226L\303\204@e7\242\025`Y\030I\006\306\366\323>\307;\276\253D\276\354R\224\214\354\206\b\326\002\216\031| \013+0%\365\252z\023\252\364\217\203\210|\f\203By\360\230\037\312\216\245j'\250K\257W\241Z\246\tR\266\354p\224Za\377\332\335\265\246\002\233L\003wy\3236\034\316\323m\f\232\016\347\343\001yq\343\242\207\223\351\304\315{\210Z\201;\007\215\027?]\347EL\270\277VS^\330`\221\264dU\021\r\r"
+	.ascii	"2\241\375/0.\020\0047)&P\031:*\033cZ\020`\326%,b5\032\334\345"
+	.ascii	"E;\311"
+	.text
+	.section	.gnu.lto_isArmingDisabled.17.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 \375\375\006"
+	.string	"2\31505Pm\222\016$\243*\n\201\244+kI\020"
+	.string	"\200na2\365\340\253\372\263o\177g\r\301_\301\350\326\356\260\373ff\226h\272H/\27481u\250\321Z\333D\246[\226\206\013\203e\326\302%si\260\215\006-\f\304.\206\f\264\264\007h\0318s\270hP\223e\032\254t\261I\312$\370$\350kP53\033\032\001\365\243 \233\2531\004\347\225+u9U\251f\200\304\347\225\276\363\274\274\370N1I\377;\337\273S\325a\"@\022\243\250\224\022K(\221\215\277\363\225\021\022:o\3552D\265\240\b\205\240\304\330\301\304\350\326\267\335zt\342\2308\341F\236>"
+	.string	"\205\030\343\217\033E\364\354_\360\037\374\025\001\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getArmingDisableFlags.18.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03pM\322\001\240\253\016\313\363\032q\323\312\2209\207\374:\360+r\226j[C\332\316p\213\370$@\375\033\356\377\377\2259\313\354\337\"\"pl\367\336R\246\024\226.\013S\206\252\244\004\214f\332P\016\026\2242\220\232\0244P\262\032\340\245\300\025\003\306\202\233\252\262`\024\367\nJ\265|\024\302~\310\343\345o\370\201\223\307\356|\316\273K\r\240\370d\310\216\236T\f\373m\025d;\235\372NR\bHv%B+\213\342L8lw\354\310\367\370G\307W\213\032Y$r\0211\242\262\033\241\345\003\357\256]\340\335i\306\257\347\345\037\344\255\303\242\004\313<O"
+	.string	"\204\335ub\331\304\255\267m`\373\300vE\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_enableFlightMode.19.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`\034\001U\r"
+	.string	"6\031[D\020\221\223\016\177\212a\245\330\200j\020\004\2124\0302\032\204\354%\314\312w\017\rl\004\244Px\204\264\177C;\305<\232/\262\024\353\241\236@)\002E($*"
+	.string	"1"
+	.string	"\021\355\f\274\021\254%\237\354-eJ\001F"
+	.string	"E"
+	.string	"D"
+	.string	"Zv N,oec\241\261\333a\003^\300z\314\023\260\036\365\303\265CM\315\277w\270\222\362q\250\322!\312\025nZ\2546\001\250\023\364Hq\220\271\367\304\2002er4\330]'\207\322p\307\333v`\233\201}\223\252;j:5}"
+	.string	"\034'1\007V\354f\370j\354*\262\020q\325o\223|\317\035\276J\273\366\345\332<\0221v;\004\217^pe\332?q\024\244w\027\254\331\365"
+	.string	"\363\262\333)0\347z\334@\333~\211\233 9\237\213\252\212\0320\231\341\3018\345\214S]\316\311\210zM\375\206b\312\317\226^!\244\274\330n\234\345-\232\037\302#$y\356\321'\261\036\243j\f\314\210\r%\371\331])U\305>\334\335\265\246\254y\367[\017!\235\007\022B2\213\302\250\003\202\366p&|@B\231'\302\007\350#\022\032\021a\036\020,\364\351\2000\217h\204q<\234U\370\020a\"Y&\302:\272=\\MitS\242&\253\320\250\246p!\003\257Lp\333\302(\3179@\213\215\325IK\237\351\020\027"
+	.ascii	"2\241')p\206\303 \270bp\2451\3626*\341\016\027\270-\2061\n,Q"
+	.ascii	"\025\017_YcQ\355q\241\322\026V\220f\267&\024\313\251s\320. %"
+	.ascii	"\320\252\233\246\024\n\n"
+	.text
+	.section	.gnu.lto_disableFlightMode.20.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`C\001\025\016"
+	.string	"\366\332_D"
+	.string	"\221(\035{\215t\3337"
+	.string	"o\004\243|Ka}4\310y\345-vs\221\r;\361l\350e\326\232\265\226\311\030A\274Q\254\274P\341\223'\322\377/\271\022\302\031\361\001\352\005\3361\206g\013\3226\331R\246\024M"
+	.string	"H"
+	.string	"H"
+	.string	"\376\210\263\220\314\351\247\202A\202+\272\026\033s~Z\200{\310_z\001\362\327v8\367\270\312\371\007\037E\234\300x\251\322\243\206o,\320bQ\003@\n\025=L>x\007\257\026R'\325\314\2029\247\325Ke\270\257\333f`[\201\375\020\001Vk\376\375\231\257n\271\352]\265\256\372\233\f\313\313\200pN\223\020\307t\271Z\200\370\352\267I>\350\314_q\330da\035\370\2425\347g\340\227\023`\252\366I\274\004\351_\005w\314\311\001\006k\316\017\2019\330\257\217h;\234\314Vu\001\006\214\201\322\030\313\375fk\335Mq\217\206I\303\335}\247:i\350\257\356\273\r\231\375:8q\321\345x\313Op\276\007\223\224\350\275_~\211\374%w_d\254\250L\032\332_I7\305~\234\213b\257:\013\"\235\006\020D6)a\324\001E{8\021>!\241\315\363"
+	.string	"\004\364\031\t\221\2104O\210\026\372t@\232G4\3228\004\274M"
+	.string	"\021i#\333&\322\262o>\316E\321\354\207iOV\241\33151\343F\304\364\300m\n#\275\347\r\212\025\027\324\226\256\022\323b\355\246\370\001\031"
+	.string	"2\241u)\260\206\303 \270vp\2253\3626*\301b.\342\r\357\255\005\224\302\006\226"
+	.ascii	"\202K:\330\222\312\016\213j\317\205\034\363f\020i\326hB\261\234"
+	.ascii	":\007\355\002R\002\255\272iJ\241\240"
+	.text
+	.section	.gnu.lto_sensors.21.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"v\021>6P\215\322\001$\351*\032\254\200g\200\311\021\302\200\312K\374o6\353=\3645\373\365\365\324\277E(\033?\376ibf6\333Dq\275Z\307d,\253\361\223\275\245L)/"
+	.string	"."
+	.string	"+"
+	.string	"\001\331\241\021L>\275\253h=\002e\345\241\262\333E\245\370\351y\362\277\361\227\362@\302r\241\236\226\204\335u\262\\\016\267\336v\201\355\003\333%\001\232NM?\263\214\234\f|\354\266b+k\002C0l\233l\214\355L\373\031\3270\035V\362e\027\342\002d\2673\260\006\3400s\201\354\360=+\021U\306\374\364\232\372\325Ku\216w\224|\013\217Hy\326\241O\312\016\257\227W*cv\207J\235\260\377vw\255\022\206\207\375/\f\241\315\347Y\323,x:\240MS\340|<\"\320\210\213Z'\202<\233O\324\270P\324\020xk\340pQ\264m\\\304t{C\315\244Te\277\224\245B}\t"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\007t\004\274\b1"
+	.ascii	"L\327$\003"
+	.text
+	.section	.gnu.lto_sensorsSet.22.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\305\b"
+	.string	"\306\220=9@\305(\035\340]5\303\025\342@V\022^d\310\204!\375K\271]R\200M\345'\365\177\304\237\236\205S6\002\351F\2463l<\315c\302\214=7gw\312\307F\366\3362\245*"
+	.string	"-"
+	.string	"+"
+	.string	"\002\327\245;;\345_\306>\004\3054\322\262\273\023b\274\273v\376?\216\361N\243\353Eaw\255\336i\342\206\267}`;\301\366I\177T\265\252\372\327E\305\204\200\265+\321\n\260+Y\262\221\261}\265\337q\217\356)\2211\273\026\034$\273\037\202\261\200K\203\017\\\227\361\001\367X\"<Tx\023E\351\252\203\210|\rG\204\364\336\245\037\272.\017\245\212\005\240\202\244-\373\033)\274\260\037ww\rQ\366S\001\016\037M':\303\0324\216g\313\0306\035\r\344\201\340f\306\231\036M\323\231\031\367\231X\201\267\207\r7A\333\306\315\314\267\217\013Q^XY\221`\311\nE\002\f"
+	.ascii	"2\241\333/0.\020\004\027)\036R\031bQ\366\025L\271\004K\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sensorsClear.23.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\365\b"
+	.string	"v\221>7P\215\322\001\020{{\002hH\024\021!p\314\230\272\244]\356\350\214\323\013o\323\332\217\354\351kX\312\306\217\177\332\350L\243\304Tq}\313\224\362\303\352G#\204H\231R,"
+	.string	"."
+	.string	"-"
+	.string	"Z\366\200\355\232?\033\345!\306\036\004\206\022y\355n\324\213\177\317\317\177\307/`\252\364\264 \354\256\023LI\334z\333\005\266\017l\277\002o\375Y\2465\323\231\351[,0\223L\311nDle]\032\311\006\306\366\323>\353\034\337[$_v+X#\273\241\2015"
+	.string	"\327\b.\260=)\251W\325\243T\247{\374\203\344k\030b\224\007\257\371\243\355Z\352@\206*\323\253\002\305\tj\302\2241;,\245Z\330\317vw\255+;\r\241\315'3\247a\360t@\035\267\300\371xD\240\007/r\235\b\362l>\221\363BQ\223q\347\300\361\242\250\353\274\210\t\367\331\352\312\t*.\223\236\254\032r0\r"
+	.string	"2\241\371/0.\020\004\027)\036\300\320P\331"
+	.string	"\323\202"
+	.ascii	"\263.a\021\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_sensorsMask.24.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03`m\322\001@\203"
+	.string	"'t\246\300jp\265x\277\207\236-,\316Y!\232E\275\013\260\324O\007\300\267\374EQY\260h\202\206)\373,\372\242\367\336R\246\024\216.\fRf\242\"\005\214F\332L\017\025\2142p\222\02640\252\034\340\245\300T\003\246\202\033\212\252`%\356\025\224j\371h\204}\220G\313\3270\004'\177\335\371\234w\227\032`\361\311\314\216\236T\f\373m\025d;\235*Pqr0\262;\221\245\254\211+\331\260\335\261+~\307=:\266Z\fa/$\223\020A\331\215\320r\202w\327>\360\3564\343\326\323\362\377\361\306\021\"\2710\317\023 aw\235\027Fq\353m\033\330F\260}\021\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\365\004"
+	.string	"\242G\034%\2407\035\330\367\377\376\370\\\374\025\372\365\245\263\237\377\253\377\377\245\035\373n\"\"\264\324DD\304\366\313\277\245L\001\016\\\210\013,\002y\256a\003\021Sd\216\247mw\355Bf\235\200UB):5*}\220\321-\350U\266}\214>\247\234O\351C\263(siy\244\034\312\344/\233\215\327\n\034\265\235\210e\330\267\037\t\004\354\356\272?i\033\r\001\021"
+	.ascii	",\033\332\262.\303\345\007Fce\327\260\301\365\f\235\001=\300"
+	.ascii	"k\256,\002\350\001\257\331`\021@\017\360\215\235\037\021\241"
+	.ascii	"U\031"
+	.text
+	.section	.gnu.lto_.refs.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"\342\304\013\020\260%\351\f\3030\245\266\265\335\310&{\313\224\002z\t\330\251]9L\251\205y\031l\221\212!\016\322\241\235\0242\262\363n7\345}\235\032\b\004"
+	.ascii	")A\2119\233\022\327\273\346\030"
+	.text
+	.section	.gnu.lto_.decls.403565909d3ab004,"e",@progbits
+	.string	"(\265/\375`\206\016\rH"
+	.ascii	"\212~P\033CP^N:w\343\004\324\362Ao\237Q\221\367\203\246\003\261"
+	.ascii	"C\336\303)\317\3162#\332m\345\212\261\355z\030!e=E\"Qb\216\263"
+	.ascii	"\013\240\201\tK\203 \217\203r3\203\202\007\2743\037O&O\254\224"
+	.ascii	")j\001\243\001\261\001\355\275aI\314\263\256\256{\301\nt\335"
+	.ascii	"g\262.\353\336\236\316\241s2\245dPb\335\027\351\331\375\321&"
+	.ascii	"\371\354\376\2155Yi\322\355r\335{9\017{\346\024\202\247U&\303"
+	.ascii	"s\334J`\272s\035\227y\220\262\275mG!\214\213\266\232\304Lk\313"
+	.ascii	"`\317\022\326aa!KX\233x\314\320\262E\032\212\223'\311\264\325"
+	.ascii	"\273`\3438LQW\0320pZ\375\b6\216\301\260}~\230\344\265z\n\354"
+	.ascii	"\317_\232\214\374\304\271J\203\223\300.\355\304\260\265\224\331"
+	.ascii	"8:drA\357\364\336V)(\252FM\331*w\3416n9\372\263\033\277]}\203"
+	.ascii	"^\351\275\255\321PYDo\256\325\006\314\264\252\274\264\236\275"
+	.ascii	"<\300\330\345\360f\317M+\0227\255o\231ieyim&\034\f\372\231\017"
+	.ascii	"\243\220\023\350\346g\003'\330\304\377\bC?\243\361S\177\236s"
+	.ascii	"\023\367\246\267\306%\376K\370\377\266\376l\345\347\242\237I"
+	.ascii	"\374<\342\347\020?\203\370\371\351g\017?o\370Y\303\317\027~\266"
+	.ascii	"\3603\205\237'\374\034\341g\b?7\370\231\301\177\245\277\021\374"
+	.ascii	"|\340\347\001?\013\370\331\350\347\377'\374?\370\237\317\177"
+	.ascii	"=\377\003\377\003\376\247\363\337\357\377\233\377zx\377\313\374"
+	.ascii	"\037\363?\314\1770\377\341\376K\377G\377\027\370\237\367\277"
+	.ascii	"\250\260\260\260\360\347>?\343\371\211\270\002g:l\327fws{b\350"
+	.ascii	"\214m\361\205\305\211\303~\001\316\204\304D\227\004\262c\234"
+	.ascii	"\374\311\362\233\n\001\262i\243\246\325\367\262M\033~\263\242"
+	.ascii	"\275^L\026\266\365\354:B%u\027<\277a\276!+W\310\270Ze\276f7\334"
+	.ascii	"w\346\343\275\242e\313|\352\275Jf\007G\314\016\202\356\246(\243"
+	.ascii	"\253z\016\304\236\355\260zz\214\307`\"\242]\201Gmm\033V\032\366"
+	.ascii	"\234\2069\357\334r\036OW\240\370\023(\3606\333\n\347/\354\231"
+	.ascii	"\247\353\331\f\337\235\317\264|\206\361\236t\357\275\272W\211"
+	.ascii	"\233\007J?-\301>\027\f\254\t@\337\233\240\264U\306\3733p8`\321"
+	.ascii	"\275l\367\336\004\\\350\006nM\253\027\344i\321\2251\254<"
+	.string	"\255\236\231\354\373_\257\262y\357\375\njo\363\252h\345 \346\246\337\210\207\374\340\016\217\004\350^/6=\354\2259%\222V\3777\270i\367&\225n{\233L\351X\222\t\307\347Tj\257\030\201+-\273\314v\314\251Bo\337\366\362]\2169y0[h\223\331B\223Iw\tM\336\333:\223\230Se\222\231\3221'S\nu*\335\345M^\251R\214]B\235\3145Pg\022S\252t2\227cN\245 ld\177\314<|O\266\302\\\336 ]Oe3i\217\331B\357\337\275<\315\272\315\007\367>\241\315?\245\021\246\273\332\013r5F\t\345\366\336k\240\353\212\fz\227{L,\320{\261\\\335\270]\033\222\355\336\205\302{\311\262\347\345\312\272\367@\327\275I\276{\367\336\344\275W\250\371\fM\026t$O,J\253D-\006%\302j\256\301j\365\r\375[I/i\255\031ka\025=\\\255\236\216\231V"
+	.string	"\274\264\366\223\370NB\264\034\022\206J\253C\274\2646X\203u\030\277\211Q\262\247\317\275`MHb\327\316O\037y\207\0350h\255Lk\244\277\202\310\366\324\231\213\026)\322_\037\336\253\244\313\331\360IX\036\330\026\366\375\305=\244\355!\375U \004Z[\340\021^\035\335\035)\354\271\277\326\366\352&\267\n\332i\024\210K\240\301V?,c\317\nV.d\005\353\231\013\267\222\333Vv\327\212\366&?\214\001\253`4g0\r_\253\357\256\277\257z\331\\E\320{\227\367^\002Fw\203P\264\232\253\267\220\326\2064\221\322\262\r\325\rf!\322j3\033\310[\253\177\f\223o\255\265\001z\257\262\265\220"
+	.ascii	"\335\253Dbv\300\354@U#"
+	.string	"\253\022fU?\\\3026\026\361\235\265\2646\301\332\213d\364D\212\226\271V\007\360\322J\304iC&[X\3307@\241Q\021\276*h}\345\206s\266\354U\001DH\310\203l\322\275\352\373s\306g\376\242]wX?~x\220\215\332\331z\252h\224u\274\376\234\007\325>/q\376\336\260gAf>|XNm\257\363E\334\326\263O\337\311\255x\360\260\236\277\325\b\0346Y\234\347\254\307H\020n\257Mne\343\005\350\217\\` \323\271\303>2[\3174\242,\256\351\332\032{\256\303\fxn\031\220\355\272m\340e\353\231v\233x\025X&jY\346\242\260g\266[\345\310a:\375%\232\026\270\252\231c\006\314\234\277q\301\251\312H\340\270\243X4AUeDF\351\260:aU\334Q,\322 @\204\214B\036\001 \241\236\204\254\242nH\251\307\242\216\250\026\003p\034\243X\020YE\025s\234(B\026a"
+	.string	"\200Q\343\350hUu\244*\036\205j(!Q\025\223\246\230rTU\231\200\n:\032\223\250z,\0058\203W\355(Z9!\253\252\254\234\210j\224@\026\217J\2272Z\025\251\212S\3547t\260\320\341\311\207\320\237>`\370\200a\375\323\007\"\361C\007\"\373\016\304!\022\252\003\021\t\225A\003\222\312\330\203\255Q\305\002yc\312\230\303\206R\021\3528\025\225#E1\007\215\250\243\021\305\024\225Q\207U\224\200\023\211'\032\304h\241\202\225\2720e\264AU%\005U\324aDR\365\260r\222\262\341De\214\322\341$eut\272\260"
+	.ascii	"\216\345\3308\300\275-i\207\035\365Q\003\007H\324n5\2025(\346"
+	.ascii	"\215\247F>\272/\267V\025|\243'\244\325w\373\267Z{\201C\006\317"
+	.ascii	"\223V\237\230im4\342\273\255\2734a\232ua\203rZi\266\351\021\341"
+	.ascii	"\224\2556\255\266\032\361\275\266@\356"
+	.string	"\256\256U!.i~_\326\304\265\372N\373\373\254\267\220\321\203k\322j\223\033\361\255E-\333\343\205\226\005\213\340\034\262\037\255\276\261\374\215\326W\230\3131,\255b`\246u=#\276\255\f\377\234uDZ\r\252\322T\334\230{\302\264\372\246\362\367\263\247\024\231\021\021\322\246\325O\327\210o)H}s\202T\242\230\205\2111i3\351\020\231'f\201\255\366\023\342\033J\210(ej\255\016\2354)\202\345v\244\325w\223\277\313\232\211\321\023\255\214I\253\337c\246\265h\214\370\201\027\250q0\207\0205C22\"\222\202$I\007a\005\204 \b\245\264\r\021 )\244J\210\024$M\n\373\034)\211\340\304\240\025\2225$\351\004\205\334\252\027E\275\005\b\333rV\234\244\336<\200+\350\016!\363^\227\3344v3\340\032\301\250'\347$Z\235\372y*\237\256\362&\233S\224\373\034\205\205W1\335\342<P\374\t\013"
+	.string	"\336W\355\257\235\350\004Y>F\307\216\\\233\365/\345 \357\246\270i\036\007\177\342\204C"
+	.ascii	"\342\330\366\257s\271\035\207\350\212aFu'g\200cT\034\004,m\254"
+	.ascii	"\217\203h\221x\274\245\307^\037\0066M\332@\037g\304z<bq\315w"
+	.ascii	"1\365\230\nby|pk\306\n\027\r\242\363[\332\037\036u\356B\035l"
+	.ascii	"t\234\333\306\224\212\036\272\267\344,C\200rQSID\216\266\234"
+	.ascii	"\350\002\322Q$\027a\205f"
+	.string	"\227\244\257\376#\262C_\274p-5\023+\273\252\341w\252\324\324&\235\311n0"
+	.string	"U\372\230_\036H\007\253\t?7\373\341\004\007>\2502\234\377\253i\265J\326\256,\232X\310\330\226\224|\201\334\206E]\330\305\343\005\344\013FH\345\357\263\005S\204\204kA\240\343\330\220\f\025\306R\\\251\260\331D\314\343\037\3522\357\f\350N\275H\017\307"
+	.string	"}\207\217\030\325\020\251\360\246\017\0358\357\305u&\242Ek:;\313\316\336{\372\354\232\027\226Cit\372v\335\321+\374\241\364h\314\007\033\337\340<\210\342J\201\255\351\357\235\271\034\331u\005$\356\350\274\201C05\202?.\001\343\237\211\206\0021\231'y\242\264\312\350F\tH\352\322\362\315\364\263^\312\326\376\363\340\350\r3\361\233B\247\373.\f\237\205\31264\370y\037d\350\233&\2245?"
+	.ascii	"\001\246&w9q|\242\202\243\027\024[s\t\276\207]\222\210bF?x\214"
+	.ascii	"\332V\341M\360^\305S\313\211&P=\360\357Zyx=\371\017\374\2738"
+	.ascii	"\002\217\274\020l\nB\036w:xh\324\364&\317\350\3644\324K\004\032"
+	.ascii	"\033U\225+L\376"
+	.text
+	.section	.gnu.lto_.symtab.403565909d3ab004,"e",@progbits
+	.string	"setArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"sensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.403565909d3ab004,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,479 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375 \213\265\002"
+	.string	"\244\003\177"
+	.string	"\b"
+	.string	"\222\236\262\314\016\024\002"
+	.string	"\001"
+	.string	"\001\240\342\234\212\n\004\005\006\243\203\333\233\017\004\002"
+	.string	"\002"
+	.string	"\b\362\354\276\360\017\006"
+	.string	"\002"
+	.string	"\t\367\376\306\241\002\001\n\316\226\366\301\r\004"
+	.string	"\013"
+	.ascii	"?\351\b\025xV\205p\301\340XJ\307\317\265\340\265]\262\334\355"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375 /\025\001"
+	.string	"\240#"
+	.string	"\005"
+	.string	""
+	.string	"\001\006\001"
+	.string	"\001\b\t\n"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"-!X\202T\356\302\264d\003X"
+	.text
+	.section	.gnu.lto_.inline.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375 \372M\004"
+	.string	"4\006\356"
+	.string	"\005"
+	.string	""
+	.string	"\032\377\377\377\243\003g\001"
+	.string	""
+	.string	"\002&\306\302\353\263\002f"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\006"
+	.string	"\017\334\375\272\262\003f\001"
+	.string	""
+	.string	"\002\016\224\334\236\352\002e\001\n\001"
+	.string	""
+	.string	"\b"
+	.string	"\b\003d\t"
+	.string	"\007\262\346\314\211\002f\n"
+	.string	"\r\344\314\231\363\016\250\270\275\224\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"0\200\207\361\272\351\260/\f\240\251\360l\245(\365b\215\006\256"
+	.ascii	" \365\325\001`aS)\366\224\3756\200\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"D\002*"
+	.string	"\005"
+	.string	"\006\002\002\006y\001\004"
+	.string	"\001\300\004\001\004\300\004\001"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	")!@\300\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\006\230\004\b\230\004\t\230\004\n\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375 \224\245\002"
+	.string	"\344\002\210"
+	.string	"\005"
+	.string	"\003\002\004"
+	.string	"\001\002\004\001"
+	.string	"\002\005"
+	.string	"\001\002\006\001"
+	.string	"\002\006"
+	.string	"\002"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\b\001\006"
+	.string	""
+	.string	"\t\005\001"
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"C0\220\022x%\340\242\306\300\270(\220\270j\207\204\3005\311N"
+	.ascii	"\025\270\250\034j\026|e\002\bm\003m"
+	.text
+	.section	.gnu.lto_.lto.78e3698ae7a8e7a0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsOnArm.20.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\265\007"
+	.string	"\362M25`m\322\001@_a\255\2048!r\305x\245HZ\005\001\260\005\256+\005\247Y\342\261\240%\360\277\315\230FJ\203 c\340\335\r1\342\260\355\315dl\"eJ\001\256,\027v\301\256W)\274\005\314E\363*\353z\226\001C\206\004\353a\020Z\257\"\332O\253\037W\261q\264\343\324\220\f\006>\222\374\217\203d4\020\352\001\210\303\342\352{<\324\340g\370\3328\177\003p\227\243H\342d\311S\332\016\017\371x=\006\305\326Q\315\026i\251 \373\323\352\307~:\237>E\331\020\020\331\225(\235\354\346F4l\277\342\314.!\200\b\bE\214Lv\367\351\305\263g\346\277\343\224\350\321\236\024\302\356:\243g\342\326\333.\260m`\233$\021"
+	.ascii	"3\241\303\0378g\356\3544\f\f{\325\203\250-`!pf\324\276D\255*"
+	.ascii	"\317\365\\\310\357\202\365\227q\303\345X\264\223\f"
+	.text
+	.section	.gnu.lto_statsOnDisarm.21.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\335\b"
+	.string	"\246\320<7@\217\322\001\360\037\023g\331\340\372\337\365\367~\037]E\002W\361\326\305\260\300\207\375_Q\025\376FQ\270/\320\354\031\020\250|&\327\003I.\362Rx\321\337[\312\224\002,"
+	.string	","
+	.string	"-"
+	.string	"\376Y\337p]\351O\263q}\b\261\223\226\267\236\031\035\352\021\244@\270\263\236\030\335)\023@aw\235\\\247q\303\333^\260}`[%\034\366\337\252\312~:\241@\307\200\313nj\026\2630\210\022b\373\366[6\347\034\223l\026\003\213\200\222\013\222\227\335\215\272:\351O\223\024\262\230\211Z\224Ie\030YA\245\314\366\366\227H\263\213J\360]\027\241\360?\016]1\312s\207\376(s\230\332Y\301\270L9\263_\247\324\376t\266\220'\264\305\217C\214x\360@\304\017h\213\235\002k\022\r\240\030\3224P\344\274L\177\253*\303\024\230IOo\223\2666\221\347\254Z\272G\016"
+	.string	"3\241\301/\306\325Pl\330\013\250\366A\352\211\270\314\206"
+	.ascii	"]\303'\206\370\227{\307\345\210\331$\036L\355\001"
+	.text
+	.section	.gnu.lto_statsOnLoop.22.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\355\n"
+	.string	"\326\323H@ \307*\035pF\217\222\343s\001\370\004wt\006\326\201\233H\335\264\006\225r\t\273D\225\314\360\330fb\331\306\205\0074\314\304\236tH\252\004c\"\300\320\320\303C`g\253\220\336\325\022\262\245L)6"
+	.string	"7"
+	.string	"5"
+	.string	"/}\223\253%\377\255k\304\021\374v0r\3510\347\334\214']\t!\0230S\030Qr!\245\"\276u\r\031C\325\f\305\234\323*\216\"7w\333\026\266\037\354G\004\333\267\301\205\001\211Ik\366\013\324]\331\227sU\366\325\362\352\275Z\257\276f\302\204\223`\316T\255\301\214m\003Vl\177\343\222\215\200\001\225p"
+	.string	"\004\300\2029g\267'\001\373\031\254\300\256\256\334\177\260\204Z\213\331\225@\311\250\375u\350E\335\217%\341\202?\213&\013\260\036q\337\013\230\201\223\322\354\273\0163\362S\354A\322\213\337|\022\367\376t>\221G\364u\237\214nC\303\003\352>\241\257\353p\354q`\204:\221\347\205\272\315k^\316UU\264\304L\033n\bj\203<\275\350]\320\004\\/,\271+\257\202\2178\031\026"
+	.ascii	"3\241eh`\254\267pf/\240\355oL\316\026\341\265\020\t\327m\202"
+	.ascii	"\t*t\200\205B\254\370\032Vqa<\032,y\031\002<\335\020\332\251"
+	.ascii	"\ni\245A\326:\241"
+	.text
+	.section	.gnu.lto_statsOnDisarm.part.0.32.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375`\273\003U\027"
+	.string	"\326'\215J\260\226Q:\364\254\\\3069\226a(!\207\234\346\204\316\311\030\031\333f,v\343\231y\247.^\177\275\267\331\033\177{;\360\333\316\001\033|j\315Q\336\227\255/^\333~\330\271\264Wv\251\234\0179\243{k\373\233\020\"wJ\001u"
+	.string	"x"
+	.string	"t"
+	.string	"\273\033\345\304Z\303\201\022ST\255%\314G#P}t9\013\371Q|"
+	.string	"\362E9\027z"
+	.string	"PK\364\213tv\253\365\361/l\353\354%/\203j\217w\366\222\026\017.\244\017C\251Zk\354\343\002}wq\347\270\363_\364\325\017\250sq\376\200\"\276b\202\250\035P^@\237\310\302\203\342\367\341'\b`oN"
+	.ascii	"\037i\203Z\253U#n\362\266#\330f`\213\007\002tz\205N\277\350\264"
+	.ascii	"\n\235v\321\351\026\235f\321\351\025\235V\321iJ\247I:=\212tz"
+	.ascii	"\351\364\244\323o9\201\037\265\362LI\251&F\036)~\364$[\216m\013"
+	.ascii	"\216fO\016\235qb\r\226\022|\236\240`HU_\t\343\033\307\201c\\"
+	.ascii	"K\031\024\242\303\n\033DR\265\226\261\217.U\260`\f\023\316i\330"
+	.ascii	"\300\020\013\277\274\320\037\036\351n\224\263\213\257\254\300"
+	.ascii	"\036\031\237\021/P@\376k\362\347\310q\311%\247\354\224\2601\334"
+	.ascii	"GNUkU\3403\275i\306\027\372h\031\016\267\020\206Z\b\367\017\212"
+	.ascii	"\022\225\264\373c\353\340\371\020#FA|3\212)\324g\344\256\270"
+	.ascii	"si\307\305\334\357\356w\210zs\312~\217+\315|!\323\320F\237F~"
+	.ascii	"\234\373r$\310\233SfM\273\2466\377\373~\370\225\020\025N\275"
+	.ascii	"\325\231\373\343\035/\326\365\261\003\336@cs\3130-\203\331n3"
+	.ascii	"7[L\246!\306\2016S\023\223\335\330b0"
+	.string	"\001\256\331\314nb\267Z\355&\326\262=\357?Xr\342m\317+\256\254\223\331\004\232\210\364k\262\262s(\306k\243\230\250\354j_O\317\221\256U\331\002JZ\313ZW\022\n\255]\005yG\216$WAF\206\374\310\332/\235\b\362,\334H\221\325\302H\bU\373D\204\256\270\252%\237\\\270\220\234\312\211nL\223\220\334 \271U\250q8\252\f$2#3A\222\302\2669\220\002\0313\233\007\022\240\326-t\210h\306\262\\\277\003\004\207\272\321\245\223\244\fO<\220\030\333\235r<\230\203j`\337\376N\372\250\331K\345\032\\Q}eS\333\324\274\255\307$r\332\n\236;\032<V\3472.U\300\003E\3637k\324\365\223u3\021\343\0370\326,~Y\202\r\277\233\221\233\"\003\232\355\213\261\341mi \227\252`l\323+\002\274\251\305\312K\336.>\026\230\316\215\232\271\277\365\234G\265\235\334N}r#"
+	.ascii	"\212\026\255k\222\034!\343\337\341\217\026\253\225\030\327A\300"
+	.ascii	"\024\244\246\261\374\023\0304"
+	.text
+	.section	.gnu.lto_statsOnLoop.part.0.33.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375`\030\001\365\f"
+	.string	"\306\227UC\020q\233\0168H\371\201\t\003\324\b\204\320{a\205\233\246W*m\370\004\301(\360\245HnT\263\216\366\363K\240\326\353\216\357\263\215s\203\252\252\227\316O0t\324\212&\037\325\177`\364\366\333\336[\312\224\002A"
+	.string	"A"
+	.string	"B"
+	.string	"sN\353qC|t\031\341*5\362\357\035\263q\244\313\f\327\341Q7\216\303a\251\342L\272\260"
+	.string	"\311\210\r"
+	.string	"\247A\005,*:\356]5p&\325\001\247\250\006sN_J\356\313mK\260\215\300~\206\337\036}\020\371\370e\240\002\205\211\210\236t;/u8\367\304^\365\252ZU\375\214\200\0044\346$9\365\230\037\342\f\022\366\275\020\273\252\036\237\302v\210\275\362\024\224\271\301#{\345\200Icc\244\305\216\021\364\233\t\270(Y\360\335(\0011\310\335\203\300\250\215Y\320o\273\357x|\332\222\274?J\013\213\214\335\316\366F\352\336\373\005\007\213\032%m\361\277\221_]\353\210\211\246'\373+\236\222\371\"|\001D\003\2768\231\350#\312\254\013\202E\341\3433\301\272B\231\3051`\254\002(d\2110,dU\266\365p\356\211\003\023\237\310jr\273\216\364_\034F\347\201\307#\037)\225\030'r\304"
+	.string	"\n\377\221\366\005\222\036\276\322\222\254Q\373#\034"
+	.ascii	"\207\033\270\017\267P\245\221\206\343`\261\315\362\335\314\256"
+	.ascii	"\031\016\241i\231TYOU\n\254\316\373\201\t\020\020\005\303\\\341"
+	.ascii	"t\230\3108#\026u\256NS\234\006\200k/FN\200\257\376j\024\310{"
+	.ascii	"\3156\236P\360"
+	.text
+	.section	.gnu.lto_.symbol_nodes.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"]\006"
+	.string	"\024\tw\001"
+	.string	""
+	.string	""
+	.string	"\002 \177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\021\b\200\204\001"
+	.string	""
+	.string	"\003\005\031\t\030\n\022\013\023\f\002!\177\r\032\016\002\024\177\017\272\200\202\002\025\177\020\026\177\021\001\027\177\022\377\037"
+	.string	""
+	.string	"\200\200\200\001\033\177\023\034\177\024\035\177\025\003"
+	.string	"\013\320\360\372\250\001\001\344\n\003"
+	.string	"\013$\003\006\016\263\357\3407\001\344\001\003\006\r\304\001\003\006\f\204\001\003\b\t"
+	.string	"b\003\nd\003\n\006\250\270\275\324"
+	.string	"\001\342\001"
+	.string	"\027"
+	.ascii	"K\310\003\347\300\240\020\246Fk]%h\006\005\352\001\300\341\003"
+	.ascii	"\304\301\245\263'\030.{\200\372\316\327\302\215?\004\204\250"
+	.ascii	"#V\003l\204JX0\326\231X\245\341\2150\313"
+	.text
+	.section	.gnu.lto_.refs.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375 W\365\001"
+	.string	"\362\304\f\022\220\251\2051\377\377\377\260U\330\307&\261^\262\245L\001\223\262\312b\265G\t\3211dFST"
+	.string	"C\321\302\224@\036\214\005;0=\333L\211=]\374\020\002"
+	.ascii	"W\005\252\tT\031"
+	.text
+	.section	.gnu.lto_.decls.78e3698ae7a8e7a0,"e",@progbits
+	.string	"(\265/\375`P\f\355?"
+	.string	"\232m,\030DP^R\007/\360R.}\330A\027\262\367\003W\031\257\215\031?\266\213\230\255{\345@\316V}#\313[\020,\245\006\201\" `'\020F\201\031 $\266\201\006\272 D\326\022!Oh\350|6;6\221)\005@\001g\001\177\001\376\326\016\347q\315\306\377n\377\337~\266\346n"
+	.ascii	"\200\376\303\264\220\375\307\355_\272\233\332\345<\214\273!\330"
+	.ascii	"\361\037\006F\0045\303\243,\360?~\360 \351\301\003\03710@\260"
+	.ascii	" \326\337\221\332\"\034nC\271\355\302u6\007\343iK\336\326\356"
+	.ascii	"\305\2774PU\374V \274\277\257\265\314\366\t\267}\251%\362\245"
+	.ascii	"\2661\270\013\034\251e\375\250\365\330\273x\232\222[{\202\205"
+	.ascii	"\036\276h\177\366\037\023\r\021^!\314\223\331.\272\355h}\204"
+	.ascii	"\366\026\272\310mWj\275\320\225\332\316n_\035\251\355v-\335\236"
+	.ascii	"\305\317\226\2060V\365\327\376c\243!A\274\250Yf;v\244\326\365"
+	.ascii	"\243\326[%oG\320\335V?\320\335\204\002\272\035\316\230\356\216"
+	.ascii	"\353n97\320\355I~D\240\333\333\376\370\210\335n\347C\335]\246"
+	.ascii	"\333\205\234\330\335\b\202\272\235\315\203\034\250\273\005\335"
+	.ascii	"\355n\007B\335\316\327\355?\335>\354v\357\356\301\356\366\353"
+	.ascii	"\356\273\356\006\354\356;\335\375\327\335|\335=\247\273\365\272"
+	.ascii	"[Nw\303\351\3567\335\335\326\335t\335\315\246\273\325t\367\231"
+	.ascii	"\3566\323\335g\335=\240\273\327tw[XXX\330\355g\335\031\356v\365"
+	.ascii	"\004S\306\300d\266\363\016\267\335\216\333\271\273}\250\364\377"
+	.ascii	"\267|\342\227F\205Z\367q_\352\036\362\2417\350n\366\207\235`"
+	.ascii	"\357\037\314\211\035W\312\033\224Hf\273{\301\267\331\377k\364"
+	.ascii	"\361Kak\330\013\253\325M\215\3427B\340\255H\036\216\303\246l"
+	.ascii	"\365\363\307\357_\0256\225\001\307U)\034W\337\242\257\252\276"
+	.ascii	"\377\361\264\b^\203\276\016[\303\246\260\265:5\372\252\177\337"
+	.ascii	"\n5\342VU\2470\233\352\264\b\266B\247pU\330\324\350\313\211\222"
+	.ascii	"\263\035yuW\274\017\256z\037Y^Pi\321\025\216\253\037\347\337"
+	.ascii	"\327\254^\332\340\337\253*\215\003\355r\270\350\325G\324\rZ\365"
+	.ascii	"\370\377\013dE\217T\277\352\nO\251\376O\211J}V\2057\276>\023"
+	.ascii	"\277\276H\274\036\313\352\337\300\307\377Y\377\257\377\365\377"
+	.ascii	"\337\377\377\221z\305\377C\212`\262\254\254\177jR\326{\275qV"
+	.ascii	"\377y-\017n\n"
+	.string	"[\217T\233\342\274X\311\376*~\235\354\343\204I]\353\333\345\261\376\337\377\\\262)\227_f\351\222\210ze\324=]\330<%\371\"g\346jrW\217([b\236\246Y\264\352[\377\343\241!4\310\334\033\032%\2428H\026\222\314v\373\031\227#\n\306I\2113\333\276e\202\005\227s.\256\346W*\007,[\352P\020\223\305\214\223\3611^\306\323\\.\254\324\337:\300uE\363\334\356\354\343\216e\023\262\344Hf\3433!--\261*V\233\241\232\0175<=\334\\6:\327\036<\346\206P\334\f\276y\307\340p\315\033\025+\231\315:\262\216|\245\341\361\344\314\362\220?\272&\331\252\363U\323\t\"\264\352k\313l\337q \tybcm9\232\243~\347oBrp\225\257\3146\313E\217\236\374\n(\273\332\201%\215\2319\311oa\231\224#X\231\365\302\354\204\371\333\013}\217P\225\027\262\377Pw\006"
+	.ascii	"\334\031\370\224y\002Mk\331f\215\270\315r\271\202\202>Xa\255"
+	.ascii	"H\235%V\311\240\226\274A\237\003\022\024R\335\323\347\002\002"
+	.ascii	">\227-\272\300\366\313\034\2615xw\322\374\216\2539\332k\261X"
+	.ascii	"\003\363\"\302S\345K\fK\237\377\365\371\265\237\337\271\357\377"
+	.ascii	"[\364\321\275\275:9\274\006\317d"
+	.string	"\266\207cn\017\211\360\361\371\\C!\033^\315\231\343nl\334`l\213\316\fPO\317\335X\264\237\006%\321\352\372\021\370\217\006\202O\331[\355\271\271\335.\247=\315\345x\033\026\355\271`\260\361@\023\370O\205\340\262\211\"\267'\263\235\257\270i\016\307\347J\204\030\363\244\316Kc\b\235\307\334:\177S\347w\355\277\307U-\351S\245K\355Ww\323n\227\346v~\347/\375\247\376p/\314\026]\340S\251K\256\231%{\210d\326\357\232\216\320\377\331\377#\360\251\013\310\251\030\307\347\214\024Ef\262M\261\242\005\013\021\"\220\317d\263\006\261\350\004E`\212\311\374`\364\271\361l&C$\207Z\212\251\350l\"i$\233O\006Ze\323CPK19\031\2273\232E'(\005\316\250\343\324\210\250eR\331<\022\211TL&\212\345\212\250e\362i\211\2442\"i\034\235GJ'#QK19\251\242\212\314\244"
+	.ascii	"%\210\245\211e\r\346\324\b\244\323\362\350\202\005\t$%\362\351"
+	.ascii	"\274\341\"\200395\225T\032\225\315cP\017I`z6\217TL\312\346\321"
+	.ascii	"\231\f\261\\!\240\235\222M\344\022\031\345v\205\013\021.d\260"
+	.ascii	"\361\323\0316H\330 \241\355\f\033\232\2326\\hr\373B\323\360\371"
+	.ascii	"4:S\270H#\362\211\231\242\211\244B\"c\b\265T\024\325\200fR!\233"
+	.ascii	"\305'\223\331,\022\235\306\250$\324\222\t\302\371\224\212JNA"
+	.ascii	"\0359\215He\3629\201\202\2534>\235\311'\343\324\361\311|\032"
+	.ascii	"\003<\215\031\236\313\344\214\237nj\002\261\340\205\n\022\256"
+	.ascii	"\023S\321\t\252\270L\036\225E\247\246\263\310\204\364\204\234"
+	.ascii	"\212q\\\"\215\316\347\361\351\034\002\273\n\362bEo\355+\277\037"
+	.ascii	"\374\260\222x\271\232\335\034V\224\310\020\006t\232\024\311,"
+	.ascii	"]\354\306^\361\350\3302\233\201d \231\n\004\247\007\034\265\253"
+	.ascii	"\311\025\020\260\256 n\224\030\332\2264\f+\363xx\334\254\225"
+	.ascii	"\2652\027P\374Z?h\250?\226\270\362\026Q\214\255k\315V\236f5d"
+	.ascii	"\203R\350b\027]L\bs\200\371\250\221,\210\224SFdDDD\2224\351\200"
+	.ascii	"\002\221\241\253\316\001\021`\251\224fj\223dX\003@\230\240\t"
+	.ascii	"&\200\267v\2055\372j\270\357D\262\233i1w\230\265*\241\250uY`"
+	.ascii	"\217\"_\315y\331\314\245A16J\367w{\231\340\322\271\"\004\250"
+	.ascii	"\3343V\270\271AQ\001\356\363\225e"
+	.string	"R\366\303\225S\304\017j\337\177\263$4\3771\334\210\260\255\367\266\301 \251\t\032\200\326\336\033\305\275\304#u\344N\001F\361\017ok\243\013\007h\202Z&\177;\216\017\350\216h\201\025\265\234\205\004\035\357\250\353\227v1\320\343J-\332\264\203s\036z:\177w`G\206\320\tF\016`Ie\021\261!EG\251\254\334F\031\234\350N\016\327a>\b\330iL$*\211\231&\361A\"\377a\3658\350\350\303\024\003A\302\261\213\033b\253\276\206mq5\251-\217\313>j@\300\341K>A\220'3\377\202\302\3004R]\353\342\324z\370\t\316\211\326I\2247\344\316_\f\2477\257\247\362\375>+\177)\372\243\307\224X\232\016\340X<Q(\236t\004*Gk\221\275J\272\022a\013\354R\3046\017\rJ9\365O\311\244\270\343\256S\220F:\234\337\320\024\322YB\243!\304%\210'\237\223[\n\314\214'J"
+	.string	"\352\322M\215\352N\223\265\032b\001\360c"
+	.ascii	")I\t\220C\001\rr\032\252\231\177A\242\263\002\213\377\267n\200"
+	.ascii	"\201\223\23179\345,\3502\t\214}-\263\312}\377\372\023F\201)\251"
+	.ascii	"^\274y\260W\306\227$\272.M\242<*\246\177l]\243\273\361\372\307"
+	.ascii	"\373L\331el\326"
+	.string	"p\202r-\331?\241\316\r\204\301"
+	.ascii	"\341\301;\217/\032'\304\335\373\300\235\301}\330\253,\207\365"
+	.ascii	"4\277\317\322e\357\301\234\r6zf\030\237\376\242\260\331\256\233"
+	.ascii	"\374\340\264\n"
+	.text
+	.section	.gnu.lto_.symtab.78e3698ae7a8e7a0,"e",@progbits
+	.string	"statsOnArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"statsOnLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.78e3698ae7a8e7a0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1473 @@
+	.file	"tasks.c"
+	.section	.gnu.lto_.profile.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375 \263\005\005"
+	.string	"\264\b\247"
+	.string	"\017"
+	.string	"\314\345\244\232\005"
+	.string	"\001\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\003\215\252\323\020"
+	.string	"\005\252\341\351\246\005"
+	.string	"\006\275\236\357\212\016"
+	.string	"\007\314\362\222\226\013\t\347\230\200\264\n"
+	.string	"\n\376\376\316\323\004"
+	.string	"\013\376\303\253\241\n\016\305\352\265q\017\220\232\246\235\f\b\002\001\002\001\002\003\002\003\020\240\342\234\212\n\023\207\311\252\341\017"
+	.string	"\024\241\340\331\265\006\020\002\002\002\004\002\005\002\006\002\007\002\006\002\003\001\002\b\002\001\002\t\002"
+	.string	"\002\n\032\273\246\227\356\r"
+	.string	"\007"
+	.ascii	"\335\345\257\030\300Yji\032Oa\025\352\226\r\264\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375 \361\245\003"
+	.string	"\364\002\345"
+	.string	"\r"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\003\001\002\001\005\001\001\006\001\007"
+	.string	"\t\n"
+	.string	"\013\016\017"
+	.string	"\023"
+	.string	"\024"
+	.string	""
+	.string	"\001\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\037"
+	.ascii	"7\t$e\007.\266\033\301\261\003\202\207\"\273\023\240\204/@\034"
+	.ascii	"8\006L\\,\200\271\\\005\274Z\030\030\243\203@\006.\247\244\001"
+	.ascii	"\313\300\210\237\201[\002q\021T\002\257\234\3154\200\331\200"
+	.ascii	"\212;0\300\002"
+	.text
+	.section	.gnu.lto_.inline.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\323\002\365\t"
+	.string	"b\013(/Pm\222\016\250\fH\231\224\032\3048\0310\256\264p\266\2075DM\020\\\200Y\222\030\266\231\225Mdff\246\203\213\337~\243\351\326Z\333{\247\343\031\340\003\205&\203\340"
+	.string	"AD&.\267\360\300\254a\207\202\307\310Z\240\222\233\266\223\215\266\222\003\222\363\344\253\247\265\235\246\3764\235\ffz\315\332#>\026\025\f\020\353\351\217\222\034\030\027\022\013?.\r\016\325RJG\026\344@?k\222\334\344\272\n"
+	.ascii	"\376Y2\244\223\301P\337\254\335O\341#\005\3336z\204\266\t\217"
+	.ascii	"\177\005\031\321\026\372\352\324\bD\250Q\242\"\t\244\026Vk\035"
+	.ascii	"P\242AR\235\007\021\2004'0\216)\023LP\201H\222 \005\316\315\246"
+	.ascii	"\364\340V\377\0034\013\201\203\222\321\305\314\023\246\224\337"
+	.ascii	"\303X\325\222DE]\267T\352\t~\344e\354a\017A\216\223\205m\340"
+	.ascii	"h=\031\303\212\300\275\242&'\275\fil\303<\254\222\001j<\223\032"
+	.ascii	"\215\234]2R\001]\363\3538U;\214\313\315\r\347\201!\001\214\346"
+	.ascii	"\221\230\351\\\220\003\232:C\002C\342,\361\227\2305\3343\246"
+	.ascii	"\347\252\233H\304\376\207\343tVu\003Wr\367"
+	.text
+	.section	.gnu.lto_.jmpfuncs.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\006\004\345\f"
+	.string	"&\32020pEI:\216\363X\345\200\003\376\236\232\002\232C\272\252\n\177\3618U\t\370\254A\030\252r\b\200L\025\2156am\263\315\266\326Z\333m\023\231v%"
+	.string	"\""
+	.string	"&"
+	.ascii	"\375\024\272\303\017\007w\303!$t\206\031\350\003\2203\013\327"
+	.ascii	"\3357\265\326\332h\271\321\362\335U\330\250\367O:\f\020]\037"
+	.ascii	"\311;\222}\304'\331B\024\265A\026\357\3569\2079lJ\266M\373y\027"
+	.ascii	"\365\356\231\352J~%\003\322\021\267\263)\016\307\020\267W<\305"
+	.ascii	"\305\313\345IN\323\300\205@~<\002\250j\375\344x\342%\026\350"
+	.ascii	"\252\226\344K\250w\237\031\027\t\026,Gr*h-\323q\236\347\301\030"
+	.ascii	"\203\240/\306m{qq-D\206i\032\213\243\310y\222\215\206\024t\250"
+	.ascii	"AyS\232\224\244\262s\340B*2\017\022\300\340\203\016!g\224\251"
+	.ascii	"\221\t6)M\373\006\"C/\3330\330\332\251\230\372\026E\005\256\224"
+	.ascii	"n\222\250\341 \345K\002K\221\221\267\257Z\020K\023\025\307\236"
+	.ascii	"\204H\356Ce8`Y\231\004\361aZ\221X9e7|k\205\004\003\250Z\203\006"
+	.ascii	"\013\222f2\320a\016<\036\247I\b\202\276P\232n\350\023n\320\352"
+	.ascii	"\365\221qN\260\326\230Wb\330k*\267\2672r\222\035\327\246\374"
+	.ascii	"\325\222P\366\226\304\271\032gx\212\203\303\261A\342}M\337\013"
+	.ascii	"z7j\177\263\260\321-U\r\327\207\266\026\366\350\270M\317\200"
+	.ascii	"\3221\337i\320\253\203\244\035\310\303\361\342xo\004U\031G\375"
+	.ascii	"h\001\254\277\214\344{\271\250\031"
+	.text
+	.section	.gnu.lto_.pureconst.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\230\004\001\230\004\003\230\004\005\230\004\006\230\004\007"
+	.ascii	"\230\004\t\230\004\n\230\004\013\230\004\016\230\004\017\230"
+	.ascii	"\004\023\230\004\024\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375 \341\235\003"
+	.string	"\342\205\021\033\240)\303\030\377\377\377\377\377\377\377\317\264\377\355\377F\333\247\265\244e#yK\231\002\377\222DV\207)d\365X9V\215\235\214\325b\252\230\222\210h\246\315\212\2312;k\231\f*,\003A`\300'\345Y\t'\001\023"
+	.string	"\003\371V\026\255@\354\251"
+	.ascii	"k\022\335\205\003!p\027\004\313\204*\002\366\201\302\230*\016"
+	.ascii	"\244\003\355\331|n\347\004\320x\003X"
+	.text
+	.section	.gnu.lto_.lto.205422c25bd7b04b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.119.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"m\007"
+	.string	"\"\21634`m3\006p\244bp\327\001\"\244\034\361\207p\332_]\360\356\224\326\032\021>\372\214\302Oj\"(\251\246\224S\201y\211(7Y\037\204\321b\355\226R\246\024\231\203\325\3414h\036\013\303>U@+M\006\221m\264Y=L\017g\323\231\025\226M\rA\257\b\013\233\332ua3\343\335\362QT\006\226\257\"\202>\024I\302Vb\002\272+$Y\371@\221k=\016\306\215\326\362\377\033E\255\244J'\005(\377EK\351\337d\342\221ik\330\032\304!\233E(\212\3713F%\277\227P\004"
+	.string	"O\006\036\270x\222\026\270x\352\326\252\330\3538\245\221b1B\372?#\2077\303\255\366\310\230.\304\031R\013\377\013\273\020\206\033\335\366\240\255B\333\217\013"
+	.ascii	"2\241u/0.\f\334\245\331\360\232\202\001\314\273\004@\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_taskHandleSerial.120.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"5\013"
+	.string	"\206\024MB O\225\016\300r [\240\315V\312~\320\315\236\235\300_h\b^\340\377T`\211 B\220k\033\0166 \004\255\271{\354Y\202\262A\220\n\244\01383\212\273\261\020\271\271\025\023mb-\331d\313\224\0029"
+	.string	";"
+	.string	"7"
+	.string	"\273\234\264p\360S\223\n\372\031\242\350Sr\272&M\"Z(\\\342\351R\023\200:\021\201C,i\224\030\005\025g]\037\210$\325\210ew\255\241h\272\267\333.`\233\200}\220\252\352G.)\031\213"
+	.string	"\257]\b\263\027\013\233%4Ll_\355sx\007\360+\006\306\330\235\360\032\261;\0160"
+	.string	"\311g\310)\333\247v\217\355\323\240\275\342\343\205\215\250\0344"
+	.string	"!\333\033`$)z\206\020\005\223\006m\227\007Z)J\352\302\276\207\177"
+	.string	"\371\030\274 \244\017?\375\320\366yy\326;B\230\2200\322\231=\212T\252\354k\273\273\226\025\354\257\376\337%\303\321\030\370t2\236\007\3526\334U\276\315\207\371p\035\002\256\243\301p\270\316\373\270\312\207=\t2\036\367\361x<n2\356-#I\232\023\2657\034\251$Z\304R\232Dm\005\237>\264\206+\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.121.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\265\013"
+	.string	"\346\225PB\020o\234\016`\202nx\307\025 \227\200\265\022\"\r\316\211\314\005\200\367\256\227\005\240\031w\215J\316\032\021\372\3771\f\007xx\317V\001\364\b%\001)\240\032\2700\203C\325J\206\361\b\372d\357-S\n<"
+	.string	":"
+	.string	"?"
+	.string	"v\212\203\034;\331\3508\205\030\331\335+b\370v\031u\363\237:\305\373\270K\013\2172\023\"B$\300g\222\027T\006\357\251+\205\257S\235$\330]\253\367U\270\347m+\260}\300>\202\366\345\356\256\243\206\255j\353\036\377T\365)\225\021\023\031\025\273\250\222\027\033\316\021\032,\266\257\3669\274\303v\217\t\246\354^(\001\262\013\032p\001\353\223\300/\325\247\274\200\352\323[\216\240\351=c|\254\b\273\310\235\203$\004$\032SY\361\251['@\2400)\211\177L\365hE\353)\243\273\207\177\030\371\035\226@\322{\237>\251\372|\234,Hl\310(i\211\rr\0327\002Z\003\316\247\303@\004\342d\331\b\003`L\243y\264\215\350\302\034\\\240\316\346sa\231vi\0068\004\201\223]\242P(\273,\340^n\324\360\002\027a)v\017\264\212\210Eg\264=\037\375h\021\232\"'-u\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.122.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"}\b"
+	.string	"F\320<:0\3456\035\2003F\243\224\r\007x\rFY\333\303\tJ#|\251\204i\007\n\202\375W\245\006\254C\243\373\364'T\031\210\313\200\221\004d\026\272P(\305\023\261\331\357M\266L))"
+	.string	"-"
+	.string	")"
+	.string	"\227\376l\231\207!\253A\2512RfvwF\220\177\327\317\277\352\034\3204\272j\030v\327\n\2326\356x\333\007\266\027l\263\004\366S\277ZX\007L\202\312\256F"
+	.string	""
+	.string	"\273\222.#\230\355\253}\222\227|O]\230\263\373\361\322\262\033*\030asip\202\353\322\372\300\025\352\243L\334\344'\235/ri\021\205\036\274\f\270c\256K\215v\205\205\036\264\256p\2540\342\310\016K\032Q\366\255\335]\307S\335\203\006\3728x!\215\343D\231\200\263N\027\321y\274\231A\314\320\307\003\232\031\327\315N\2017\t\215\233\336\266q\023\013I\2676\236\334\340\261\"\305\2227\001\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.123.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\275\t"
+	.string	"\326\021C: \261\322\001\234\370\260 E"
+	.string	"_\312\027\372\302\3033\201\002\3139\r\022.,\240R\2405dl\034\004d\247\270VFB\262\202\204\002\t\324\032\230h\201\016\rth\021\331{\247\0240"
+	.string	"4"
+	.string	"0"
+	.string	"\273[g\310\303\323)C?@D\235v\035\237\324\300\345Q\353\210*\352q\221\261\036\273\314\020WRr@\273k\331\0229n\356\266\027l+\330\236\t2\b4\273\032\267\232\225q,#\035\333\227\366I^\022\036\206a\200]\020\225\225\3351\301\007\3359\317\t6\347\350\0076\347\034\3321\037E\226\363Ja\235\320\002(\323\027\233\317\007\023\230\225\264\231\223t\332\025\026\362\255\317\307\336\275\264\314j\263\325D\331\243J\316\227}\272\273\353\351\262\017\373\251\224>\307a\203\026`\203\2104b8\225D\337G\341\t\330\373\200\021`\350T=\210Z\032\205H\325\373\300\372)\260IB\364\325\223\311\364\325\316\230:(5U\264\233"
+	.string	"\345[\246\267}\334\002\020"
+	.ascii	"2\003\3020\037\302^\r\244\205=\241\032\213Jl\220\265\325.\276"
+	.ascii	"`\213\300\250KX\304j\264\270\313M\265G\003S{"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.124.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\005\n"
+	.string	"6\023F<0\345(\0350\215W\374OK\300\230!*\313\201\246=\234\200y\346G*)\224\r\303\256\372c\016\205\326 \006\333\344\276\304\205&+T\026\016\274.\271\034 \362K\375\266\021\262\367N)3"
+	.string	"4"
+	.string	"4"
+	.string	"u\216\034<\235\022\364\357\372&\024M\247\232\217O\232\020c\t\360\361\262CD\321N\212$\274\353\222C<I\231a\330]\313P\364\270\265\333n\260\275`\033@\003f\013\323ZJ\354\2176\347\034\333\227\366M~\002\276\225\341\315\256\210\312kwT0\202\346\332\301;\3335\372\202\355\232A\033\346#k3\253\331F\212\200\335\r,Y\3545\215\261}F\240\274\240\244\314\233\244/m\266\305\205|\370)\260\"\302P\323d\217&9W\366\351\356\256\247\312~\353\247R\372\031\002\020\227\032\263\233\n\037\004H\024z \215@\236W\342\006\314y\276\211\357C\252\234D\035\205>\242\312y_\365\030\270\243"
+	.string	"y\225\324u^\345\214{\272Se\207\020\230\306<\321\215\264\273\n\371\320\363\001\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.125.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"e\007"
+	.string	"r\31646@o\323\001\230NL\267\021\376\203\271\006a\215ya\300e\351\3139\357\206\207Q\342\004A\251\2406\351\210\240\253FX\310\370\313KW\266\336\304\320\374\370\326\332\226)\005\332\303\025\0029l\242+\313&\254\200Z\036-B\373l\321\202\210\"\320'\024\255L\213\236\202b\022W\0267\f\313b\347\273\251CR\033JN\027\020\243T&l)*\322^Se\344\224\001\273\366\353\022~\264\246\376\277\220\324\332d'%@\362\262\340\362o\314\310\374T\261\210t\332:[\233\370\204\263\311\242\234\337\243e\345\377\022\212"
+	.string	"\340\312\300\004\032W\224\0074\256\312\2650\376@\276)uh\244\304\374\217\260d\316\311\325F1\307\033u\316\r\303\377\2467\342p\241\333\036\264Uh\033\022\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.126.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"\275\013"
+	.string	"\346\326RA Q\233\016\0342b\376`\020\017\360\302\022\200\207\213\004fT\336\260\003\013\326:\355%h\261\326\037\021\241\n\017oU\325\355\316\260\233\255J:-\224\250r\001\030\275#\364\222\351\347\347\351\223\275\245L)A"
+	.string	"="
+	.string	"?"
+	.ascii	"\377F\266\""
+	.string	"\"B\003\213\034\273k\251\310\267G\250\271\371/\271\245\363\270\307\312\303\341\305#\245\302\002'\02782^\006\250\001)\321\275\344\271\301\373\310\254,\330]g\347q\270\251\333~`\373\200}\004\001%\373pw\327\032b\237\344\217\232\316L\277\312\234d(\210\261\013\222\262cM\361\205\211\213\355\247}\024O\261\235\004\203-\273!Z\234\354~\006L\240z\034p\r\365\b\037\200z\364f\327\b\251\037aB\003@V\373\017ec\026\362]*\004\020$\345\356\217\373GPN'\252%_\243\256\021Lf\220\022\305\276\212\257\320|\022\026\215\362\335\243?\242\036\257\332\001\206\216\017\036\231b\177\\j\232\203\316\307\323 \004\352d\231\350\302\370\332h\0244N\310\272$X \017\347c]\231fm\004\030\253\320\311\254\020\206e\326\345\333\303\325\020\0067L\036\372\0211\031\325\236\340\311w\206\3129\201\311\306\t\250%\377\002\025\020"
+	.ascii	"3\241uh\340\254\267,\266\227\025z\201\305\201\034]\025Op\027"
+	.ascii	"\026L\271\004K\254\246\214_\036B\223Ua\271\352\230P"
+	.text
+	.section	.gnu.lto_fcTasksInit.127.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`Q\te-"
+	.string	"\252M\340\020Gp\236Q:\273\224\n\\*5q\020#\334k\227u|t\333\026\024E\232\337\207R\220\237\270\205D\0371\fbQ\272\307P\330\203\342\344\301\006\277@\335\003\033\365\206\223me\272k\260\277\332\267\377m\237\020B\210\334I\006\372"
+	.string	"\346"
+	.string	"\372"
+	.ascii	"}9E/\243\347\345\263/w_\276\367\3629$}\035\201\030\001\323m\230"
+	.ascii	"\255\325\032\237\266\f\025\303\344_\377\362\227\371W\036\214"
+	.ascii	"q\313!\345\331\327\024\b\353Qf\340\200\375W\215\")fk%a\311\345"
+	.ascii	"\353\254m\231GG\031\301z\224Yf9g&\333\207}\251\322r\326\266\255"
+	.ascii	"\260\215\234}\020\370\363\363\365x;]\016w\263\255j\212\236}Y"
+	.ascii	"\276:\301V4J=\b\364Rr\177\324\tC\260\274\376;\033P\235\001\271"
+	.ascii	"\331U\2223\227V\265\346N\256\220\\\237\327\221\333\373T\362\274"
+	.ascii	"\344\316\354\352\310uu[\317m\001\271\270\037\277\335\354\352"
+	.ascii	"\307\301n\344\344\312\307\265\031\r\301\322\372z'WZW5\273\352"
+	.ascii	"\2013V\335\324\006\272\356\370y\006\255\226\024wF\252SA3L\036"
+	.ascii	"\234\221x{g\034\236Em\333\036\354\367\206\221x\257:\241m[\276"
+	.ascii	"E#\326\031\350\314\0372\263\022\363:#+R\247}[\206U\365\231z\206"
+	.ascii	"\024m\244\276Z\325\230!\206\177\311\320\345^4l\350\320!=\212"
+	.ascii	"\266\212#\237\243r\031t\317~\2263{\370P\324}\366\202\333\021"
+	.ascii	"\210\3143Y\332\215\222\331\2502\274k\374\276\375\252>\314!\316"
+	.ascii	"E\304\332\266\304\007\374-\017\033\301Wr\224I\224\270/\036\345"
+	.ascii	"\227H\217\276i\034\357\034\225\313\251\273\226\322`\2365y\027"
+	.ascii	"\351?S\312\334\204\202\007\245\214\252\245\030w\231W\264\270"
+	.ascii	"/2pO\213\326\034\266\0243sx\033\311\374\263m\"\314\350e\245\177"
+	.ascii	"\235\223\276<#\365e\243\276\\\324\227\211\372\362\220z\231\300"
+	.ascii	"zy\200zYH\275,@\275\034\240/\003P/\007\365e \365r\260/\003\325"
+	.ascii	"\313?}\371\247^\366\235\227{\352e\336yy\247^\326\251\227q\352"
+	.ascii	"\345\233z\331\326\227\327\364\262\032B\272X$\213L\217\366\372"
+	.ascii	"@\362\270\325gJsb\262r\215d\336\345\365\215\355Y\023\007\347"
+	.ascii	"geAw\327\367L\251\221\273a\233\254m\333>\340\263y\033\366\b\233"
+	.ascii	"\204\365b\275\322\243\273\356,5\264'\323\232b\267\365\350\272"
+	.ascii	"\244\332\027\025\351E}C\327&\022\334\237m\362\204\215r_\324u"
+	.ascii	"\016\f\2362bQ\337pA\250Z*\2655\362\354\265\211\034\235\250\373"
+	.ascii	"j#\371\242G\337\271Q[\236H'\352\033`\256\324\007\273\001$\\O"
+	.ascii	"\324F[\251\371V\345\030\336\2655\305\035\270\275\266=K%ef\255"
+	.ascii	"\260\312\373\"\256U+A\210-u\362\030\345\224$\332\3107\231\232"
+	.ascii	"\2568g#\317\374\326\271\",\330\323\324@s\353\223\275\271m\333"
+	.ascii	"Ju#\3710R[\357\340`\201C\274i\314L\341fj\224\261u\n.%k\333\222"
+	.ascii	"z\355\333\222\314\205T\355$\013\037saLm\025\\D\322\016M(\226"
+	.ascii	"\242X8\201\210r\321\364\364\024\303\202\214\247\246\250\250\245"
+	.ascii	"\nMP1|\314\224\004\265\002j)J\310tB\350\"\305R\013!\323\023\224"
+	.ascii	"0\t\210\235^4=\t\243\234\234\236\2048\346\324\271\312\246z\310"
+	.ascii	"\274;\324=\002=\204\203@_/*b\276'M\264f\360\356\370\230PW\362"
+	.ascii	"\r\320vTd\315\206\232.h~\202.O\354Z}7\246,\240\325e\347\327\310"
+	.ascii	"\365\2541\035\320OX\336\020o\232\325\315b\215\327x\261\330,\035"
+	.ascii	",\017\036\351\321\001-,\322<*ycR|\273\243\267\032\255%<\244\033"
+	.ascii	"\t\265\211U\250scQ\214z\327Kr%\254\fO@\267\331\325.\240\257\347"
+	.ascii	"\356\002t\233Q=@#\030\323\001\240uA\r\340\fj\"1j@\235\0136P\202"
+	.ascii	"\273\006\033\001\026\036`\343~\032x\340\376\247\211\260\320\374"
+	.ascii	"Z\365\365\257\301ef\177\260[\367E__\257\254&\032\314\022CkR\351"
+	.ascii	"\3163\245\277\035\275\376\234s\335\016\235\327a\003\200\271\250"
+	.ascii	"\201,\203\031T\"\"#R\220$)4\006\260\002\021\241\252y\0208\205"
+	.ascii	"\212L\222\f\007U\324J\300\024\331u\"D\233\213\334\314a|\230\245"
+	.ascii	"@\027\307sBq=.,\325\324_\232h.\313\262k\213\364Yg\364\236\201"
+	.ascii	"7B=;x\307\335\323+\006\350^<\352A\356\"\31772A+_\235\003=<w "
+	.ascii	"y\216m\247\255\355\035\366\331\262,\365_hdIW\276\320\326B%\371"
+	.ascii	"\224\025\032a\227s&\030\241\021z\317\003\3312~$\257!z\265o\367"
+	.ascii	"\024\001\340^\264|+l\265]0\334\202\020!C-\022{\206m\200.\200"
+	.ascii	"\212w\316>\201\013z\313h\006\215\3731\241r\017m2\220\325T\317"
+	.ascii	"\322q\266\030\246\231a\320ee\253\333K*\310\357\230\b\241\216"
+	.ascii	"\217{'\036\026\232\355\212\377\210\340'MT\205=\007D'\363\245"
+	.ascii	"2\"v\322\267GBz\225\245VA\364\205S]\323V\324T\310E)\241\021\367"
+	.ascii	"\312\344E\037b\033\345\303&\r\241\316\004\262\276\017f\005\266"
+	.ascii	"V\003\256p\241\034\177\245\217\3060\246\237\341.\350R+J\341#"
+	.ascii	"j\312\335\362\265\371Vd?\020\022\034\264\271\246\002\233B\241"
+	.ascii	"\224\221-\246(tSs\302\301\355?\256\005\200!\312\251T\007(J\303"
+	.ascii	"{\327\231!j\b$+`j\377\343\n\225\345\013\013\210\231\232\351o"
+	.ascii	"\257\377\001"
+	.text
+	.section	.gnu.lto_cfTasks.128.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\320\005]\034"
+	.string	"\366*\250Kp\230R\007\373zM\023\267\337\t\254\\@\230\022\224\365I\026A\206\271\215h\013\315&\300O\347\351U\322\231\034\324\002\235-\036\315\247\237\244\311~\205\r\236\335\316B^\371lp\2653k\003Ir\260#%=\336\243w\toU&\031\227"
+	.string	"\230"
+	.string	"\224"
+	.ascii	"0r\364\007\241\233s \263\365\254\354m\327\\\365\2274\005\220"
+	.ascii	"\326#\316\307\203%[\347\360\364\266\266\253\006\320A\377\016"
+	.ascii	"7\036\304\236\016wm}\231ULZ\363q\320\257\266\226\303\347\207"
+	.ascii	"\255\0270\373\321K\212f\372\373M\306\254\006\332\2310\370\353"
+	.ascii	"\006\3520\325NJ\025\360\004~\277~X\363\251\364\213\005\275\f"
+	.ascii	"\241\037s\376\214\n\320\003\321\243\"\006d\026\006H_D\243\365"
+	.ascii	"\005\2666\020\304@\244\241\267hpeu{\321h\321#\375\332R\267\375"
+	.ascii	"~\373\231\337\257;n\357\025/[U\275eb\373\362q\020<\211\207\300"
+	.ascii	"\272\352\355\031[u\345\034h\336!\210\327G\036\272\013\030l\375"
+	.ascii	"T\301,\"\232\273\036\243g\340\222\372<\272_Z\026\276\201G\273"
+	.ascii	"V\347b\353\227z\365\006Y{R*\260\332|*\364W\331\263\362K`=\f\346"
+	.ascii	"\262\002\336\255?\023EO\312\033u\261\376\322e\326.\241\237\211"
+	.ascii	"\223&}\314e\353\347\260\363lY\275\323\324\345\216~$xI\336\"["
+	.ascii	"G0v\b[S)\025\246\211\354\245\216~\"E\354p\216l\335\203\354@="
+	.ascii	"\271\275\246\024BB\346\023*\254)\260\235\024\200\236\302!\247"
+	.ascii	"\363)|\331O\343\313\336\306\337x\266o\373\267\207\373\037\017"
+	.ascii	"\344\205\374\2207\362G>\357\225"
+	.string	"\374\223\207\362S\024\374\225\307\302\213\270\021\377\300\221\270\b>\202\233\340K\334\211\263\340R\t8\026\202\376\304\333\270\224OU9\371\225\025\225\033To\247\260T\271\364\t\312\311\243Zt-V-85\213\3527YU)\225\363\023M\316Ds\024\\\205\223\257h\302a\307\202)\036l\252\267]k_\333\356\327\302\225x\tN\342\003\233\350\"\341u\037\337Y^\312\300\375\316.1\251\004n\2421\351\333\310xY\\\367p\350\372f\267\335;q\313\206]c\374\312\300}3\234\335\244l$\266\373-\2723\214\324\231s\3368V\016e\266<\307/\354\372,\343w\236]\233\230-'\213\276-\313n\362\210\034\262\033\031\2736\353~\211\312\3318\303n\273\227\361\374\036_\370\235]\366;4\352\274\304a\334\356\035\244\r\322\230cL\266\233Y\003\r\202\376\f\t\231\022\204\023\350\237\200\210\2501\\\313\2402*\252Si\016"
+	.string	"#\0219n\003\0200\205\250\206\250\220\016I\207\024\301L\273\201\351Wi\236\003\311\333\206\325\232u\266\210i\2508O\t\317h\261\372"
+	.string	"\240EGW\257\301V\234\337Ueb\001\313\001\235\216\263\204\276\021I\235\020\265\312\214CY\221c\204>\330l\374\356\341\237\210\250\333\223\022\227\210\224+Hc\310\300"
+	.ascii	"\350\365ct\177\273'5,\245\350s3\2114\270;\217v \3164\341\005"
+	.ascii	"B\221\365\346\335\236\350\246\2026\017`\264.]L$!\337\264\036"
+	.ascii	"\264\246a\247\3470\212\332\274\255/\001\307\352\033\202\326,"
+	.ascii	"<\260\376h\0069\341.\n\022\211^\2669&@\313Dh\021B\006H\345\341"
+	.ascii	"\346\003\302E\273V\346\316`\371\327\320(h\314\244\361\325\321"
+	.ascii	"\367#\274\233\323\311,\016\344\fM\211z\\\n"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.175.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\225\t"
+	.string	"\206\221?:0\345(\035\2003X#\351\032\217\301\021,S\021xB\264WU$\241\370\365\246F\3036\001j\203\210>\314iD\017\214\226\006\210\"x\214U\036\230\364\304\t#\255\335[\356\224\002-"
+	.string	"-"
+	.string	"."
+	.string	"~\371'\262\032\326\310\006J\314\356\316Ke\335\273\302\350\371w=;\245L\327\200T\307a\301\243\246aw\215y\334\362\266\031l/\330\317\0026\204\377Jo\221\342\267)\224!\264o\362\023\357-\222\263\335\220\224\225\335O\341\322\t\330%\302\r2\227\361\233\314\245\375\022\333%\224=\007\024\035\201\213\204W\333\342\002\376d\001\225\226\227\206\232\240\256\2541\256\252\354\177\377\345\206\363\261\313\021"
+	.string	"\300\202H\026\022\333\267\357*\331\232v\351\035\204\007\364y\030\205<\034W\261\rx\343t\022]g4\267\210\031\372t@s\343\272\3119\260h\302\303\315\221H\304M\355qUe\007\230\027\206fXUW\266\261\024"
+	.string	"\031\213\021\261\002\343\3414a\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZ\260\231\274\323,p\355\305\224\323r\372"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.176.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`%\001\205\r"
+	.string	"V\030YD\020\217(\035\020P\005V\b\244*\002\322\017\251\372\303\212\313\002\220g\002\317\341%\340Y\350<\300\221r\307\353\217\037\243-<$\266\274&\231\253\323\024@\005\004\300b\300\006xU2|\242k\020\344\223\275\345N)D"
+	.string	"E"
+	.string	"D"
+	.ascii	"&\213l\030\017M\366rj\tI\311\330\335\354SK.\272\3248E\376Q\327"
+	.ascii	"\370"
+	.string	"\300\321e\374@\017Wy\240\305\"\306\006X\222\034\"%\276\253\0365\200\244\030\005|^\030\354\256\261\017\367u\333\016l/\260\277!*)\2205\245pA\223\235\002a#\023\266\n\311\320R\200\375\344\376I\310G\031\203\022z\b\242\031A\360\351\030\355\243x\n\321C\020k\354\216X\261\262\033&\370\264\001\354Ss\216\353S>s}b>\177\302v(,\f:\262\376&,\255\025\325\223m\320u%\020\202D\312\213Rd\361\025m\217\217\370\357z\325_\302\241\003\213\244\243\250'\353\224\253$\367\257L\001\027\273\"3ZV\304la\342*?\312\243}_\305S|U\033\307\241\020a\2635\370\3308\214\007\302\326\341<\370p\233\347yh\001\254ux&x6\237L\223\220q\234M'\323<O\3261\300]\205\315\313>]\347e\361r\225\004ul5\302\272\240$\t ^3\357\\vg!\376\363\306\nD\036"
+	.ascii	"C\013b\271\001\0171\256\013t\213\364\336\204\306>@\024\fs]\323"
+	.ascii	"X\326\326\224%`\b\220\017d\034\005\202\254&&\303\360\026\215"
+	.ascii	"RX\027\210\202`\356\031\272\250s:-\264\231\262\323@p\355\305"
+	.ascii	"\024\207\246\306\275\253\214\001"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.177.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\031\001%\r"
+	.string	"\346XXC \217\232\016#\205\"\020\002\b\206d\177\302\200\276\335\203\030B\307#y\343j\027\334B\233\031\205\254i-4\031\tV4\f\352M\"\b\341\300@+,\0208\036\264\343\b\016y\f\250\265B\177\262\267\224)\005A"
+	.string	"I"
+	.string	"A"
+	.ascii	"\273\037\202G\033\240\036\253\017\230\036\341\005L\217\232\307"
+	.ascii	"\227\260\355Q\261g\307"
+	.string	"\370\367a5F\026B\244\231\335\265\036\325\303\275kB\317\377\\\001\\\300\360\3548\324\b\331]S\031\356x\333\tl/\260\257!\376\324\341\001c7\245$c9D\027!\016\363\273<\355\333?\341\361U\234d\r\2147 \236\277\230X\305\336\200x\1771\251>\337\246lZ>\0233\n\250G\027\317\277\223j\303\201Gg\332G\361\024\336\277\023o\354v\220i\021\"U[\244\223\027\271\252\240\037\247\252G\213Lh\306_`\272\246:C+(Y\262\277\342,4\037\204'py\321\243\317M\217\327\223\016G\210xAb\005\224\245\324\221\025\036\256\262\3301\2550\2350\003Ww1 \341\032d\335U\"\341\242\220qp\017\262\016\307A7\222m[\t\026\300\330\007'\302]\235\205A\260F8W\307\3026\316\372 `\215$\333\254N\3236Kc;\257,\016\001)\212\352\3106G>\006\313\036\023\201C\355\202\036\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.178.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\333\001\005\021"
+	.string	"\346\036mG\340\262(\035b\211}|\005G\235\036\021\177\227S\017DG\222\353\360\224)\366\354W)\024S\3262\017\233u\340_?\247\254!\222y6\261A*H.\341\b\3439\2340\033\327\t\233`\220*\265\2605\022\262\267\224)\005S"
+	.string	"W"
+	.string	"Z"
+	.string	"1\234/\027\253\332\237\371\n\326iT\0060',G\306\234\341\203K\217\204\\\212<\301v\031\177`\273\264\237\302\366\312\305,{\366P6\271\030N\213\215\317\234\263\273\334\022g}5\262\374\224o\200\227\207\253\201G\216d\316\351\220\017\267\274m\b\266%\330:!sI\330\233\232\223\352M\252\245T\307\250\336\207\277F\365\007\214\324\b\274\314\311\341\007\310\034!uN\330\376\215\275#\262\022\312^\021`zT\370\314\225\351\300v\312\336\211\241\354e\301D\315\206\317\357\267\270M\352,\314\325\314d\346\234\251\3735+\033\004\262\352\303\325iT\001\0226\253\211X?\306sH'\337\347\352\261-\327"
+	.string	"6k\345\270\341z\344nke\371q\0351\367\316\026W\356m\316@\207\007\007\205\013\037\273q\027GK\220\257\356\356YbZ\372c\377\305a\250|\030\203(z\327\245\217\262]~_s\335\001\202\3662\023BE\177tc\336\370\0306\t\235LP\242\257+\201\337\007z\013N\025F\037\211\002\25242\2316x\002\354\205N''\021\252\3632t%\222\350\353<\323\251\013)0\250ad\352P h\352@'Q\331\326n\314\276"
+	.string	"\242\335(\2406\006\221\336e\004<\264\032\255\265)\376\275\315\247\361\032\336\250\244d\273\224\035x\310\370\320\235\021. \200\002\031T\305\003\202n\020N\b\315\305$\002a\002\211\210\324cD\273\254\233\261Z\315.\177\333x\025\223\262\256\264y\341\235\335m\253\254s\265\240\26643\342\342\362\"\316%\354\311\273\021F\214\342Y\200^\rS\351=\244\306\2647(lsmb,|\356\330\261\275\264\345\354k\033.\233\027"
+	.ascii	"\211W9\372M?\341\215\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375`\357\006\225\024"
+	.string	"f\240vH\300\326I:$\360\244n\227\333\325 H\307m\251pz\227\326\204!3\016\334\254\206\005\257\032\317\t\310D\037\373o\212\2420\036\b\022#\304\bqD\360\326D\023\325H\007\t\342<\020\233\224]\013@\206\r\334\"G\222$\003`"
+	.string	"`"
+	.string	"d"
+	.ascii	"\\\272!\347<\233\177x\253jp\n\331\207\027t#\001\272j\351\004"
+	.ascii	"\334\241U\265\233\\S5\347kvg\371\347>\322\371\\\273\364\334F"
+	.ascii	"x|\343\300\365\213\316\374\276\251\304\300]\244+p\315\022\300"
+	.ascii	"CjW/\035\002\336\341\355\\\267\300\346\367qm\251^\325\311\224"
+	.ascii	"\001\3149\347\200\253\227NUcT\002\267\t\rw\211\f\267\016\f7x"
+	.ascii	"\341\306a\341\246\252p\023\241pkM\270\205H\270\253\"\334< \334"
+	.ascii	"V\323\351\316\361\340\266\341\340\256\321\340\246\301\340\236"
+	.ascii	"\261\340\226\241\340\216\221\340\206\201\340\236j\272_0\335."
+	.ascii	"\274t\267\260F)y&\231\005\222Q\034\371\204\221WxE\226\362\276"
+	.ascii	"\271\204\350\372u\273\006\013\033\221d\353\317\035\024,R\254"
+	.ascii	"df\026\312\326\222\252\3522\232Y\203E2\213\203\211\331\032Q\314"
+	.ascii	"\020\314\rf\215\345\244\256*I`\261\205\262\305\266\026$\004["
+	.ascii	"\247\037 \317g\327\242\327!\217\327\240\235\363\262\362\244\307"
+	.ascii	"[\323%qG\215\270S\210\270U\204"
+	.string	"\270?\020w\217\017w\020\0177\220\016\367\025\207\033kC\372$>\201Krq#N4-+7\345&\027\007z\207*\353\312MnN\2103\342\210\264Q.-\244\2017\342M8\332\2106\240Mn\315X\303$\267f6\316\304\031(\322\204Jri@\271\262P\256L&\264Fa\262\225\263\311\215\211\2010\360&\027\312II6\311\305\331^W_Md\263\255%\315\026&\036\311\002r\2501\030K\341p9\205)u\020\003\031Zg\f\021`\024J\031\253D$\224\230\241\017\031\213#8\360\331\224\371Dk7\323\237\033\223\314qS\3476Nc\301\355[\373Eb\016\221h\205\273T\367\326\266f\344\360|Fm\367\316;\306\252\261\330\007d`,C\370\375\244\035_\333R\206\246\313\372\254\323\302G\311\202u\251\321\213o\336\275\2717\367\346\336\334\233\373\310\030w\367\346\336p\237\317\251\362\345x\241=\223\263\273?"
+	.ascii	"\243Kz\246'\363\204\373\316\237\356,\332Hv\2265\377A.!\321\202"
+	.ascii	"\203\233\343\276\002\254pT\337\r?\314\334\315\375\006\223)\346"
+	.ascii	"\326\250\002"
+	.text
+	.section	.gnu.lto_.refs.205422c25bd7b04b,"e",@progbits
+	.string	"(\265/\375 \207]\003"
+	.string	"\362\007\030\035`m\322\0010\f\3030\fL\222@\t\360\352\b\031`\234\2426.f4\356\337D\312\024WJ\251\352\rtRI\331H!\215\352\224\365QGS\033\005\224\321\005\333\242\370J\342#\304\263\366P\373\246=\323\376\016\033\326L\201\257\207+\210\363\231p\016\277\246\337\240\2024\327\212\363\2328;\371_\002\002"
+	.ascii	"7\003Q\301\034\003"
+	.text
+	.section	.gnu.lto_.decls.205422c25bd7b04b,"e",@progbits
+	.ascii	"(\265/\375`\340R]g\001z_r\205U \fa:\215\001\301/\306{\342bsp"
+	.ascii	"\271\314<\314\035n\260\336xY\255\223\227}\343\330Wn\201I\013"
+	.ascii	"\007\242\227T\245do\247\233Pl\313\326\\^\312\3613]\"N\020\022"
+	.ascii	"\343\3404z\231#\"\001\017(\233GBG\251|0\326s\250\241\262\355"
+	.ascii	"-\245\224)q\007T\b\275\bx\005\236\302V\366mM\004\0318|\205YX"
+	.ascii	"$^\201U\254\221\301+.\0360s\342\206\212\034a\322\304\314\367"
+	.ascii	"\211\243\263\022\252)cn\306U\230J\b\016\007\227\262\233\357s"
+	.ascii	"F\337'\214\276O\013\372\016o\213\304\306k\227t\334\333\n\023"
+	.ascii	"6\336\272\273\207\303\324U\t9\352\342\260\361\342\001*B\026\244"
+	.ascii	"\216\027\346\366\004\210\231\357#D\377w\217\036\274\302\025\233"
+	.ascii	"\236c\331BW\232!7\377\267\310\233\347\3329\356$\2407,6\334\315"
+	.ascii	"\367\021\323\367\301\241\357\023C\337\247\205\276\276\323s\267"
+	.ascii	"\316\224/'ftsZ\216\276v\243\355\321\"\231I\366\310\374\321\036"
+	.ascii	"\231\327g\342\374w\315\315\272p,ok\013\024\267\233o\233\353\306"
+	.ascii	"\"7\3347\233\310\312\371\230\322\272\371\032\214&\301\336v\203"
+	.ascii	"i\357\356\354\006\363Z\2136\355\221y,\366\310D\223D\304\205c"
+	.ascii	"\312\325\315\327N\364=h\341\202\301P\262t\225\036A\342\336\356"
+	.ascii	"\031\213\274fn\23053W\314-c\337\326\266\024\027\006tP\276\274"
+	.ascii	"$\205\252$\363\3140\363\230K\206\250\305\020\025An\276\336c\350"
+	.ascii	"\364yo^\356\227\273\245\006d\213\0276}\336\022-w\013\032;u+n"
+	.ascii	">/\210\026\336\227>\257K\237\327B_\266{\345\267\355\356\333\366"
+	.ascii	"\201\327\336R\267\215H\317\336RD\326^`\355\005y\tX\221*f>\317"
+	.ascii	"J\337\304\243o\322i\336\321\"\231O\232\3217\301\350\307\331#"
+	.ascii	"\363\346Q\333\215v\004\n\003\007\016\331\315\367x\225\\\026\354"
+	.ascii	"\333ZNR\345B\271O,\362\036o\223_\252\353\344\036\357\222{f\337"
+	.ascii	"\326v\376\2215W\303\f_\231\211Bff\273-\222y3\207\366p\231\370"
+	.ascii	"P\035\211|\326\314\341X\273\371\246\f}\323J_\026\336v\313\320"
+	.ascii	"\311\221\274\331^a\3725\303X\272X\351\271\371\345\036\375\337"
+	.ascii	"$7\306\177\221\\!\331\315\0273-73\341\260Z\206\312\275\275\306"
+	.ascii	"\2141\331(\023\307D\343\256\220\005g\227\274T-\254\026\373\346"
+	.ascii	"\303\001g{\342\246\252\274.\325\026\033\0268\273\244Q\nM\213"
+	.ascii	"\261\253\025\226\215\351\277D\356\330\365q\207\334\260Kv\177"
+	.ascii	"\334\257\313\343\366\270E.\220k\344\006\271G.\330-\273b\026y"
+	.ascii	"\205\\\035\277^wG\r\005,is\251\256\220\313ug\fQ\035\267\326\020"
+	.ascii	"\3331\f\226e\033\302{\347\3103f\245\302\262\331\267\256m\244"
+	.ascii	"\363\001Y\326\315\322\262h\366\255k\3439\033\316\316\354\276"
+	.ascii	"\200a\321\314\"Ypv\311\034G7,\342\340\354\222d\256\220{\303j"
+	.ascii	"\031\222:\356,\036\362\r\316.y\251\376\016@\270B\256\013\313"
+	.ascii	"6d<n\030\274\"^pv\311\275\217\037\222>h4/\224 \321 _/\213db`"
+	.ascii	"\217\314\227m\372\345\231~\371C\277\334\322\317I\375\374F\337"
+	.ascii	".\2417\032n\252\334\374\314E?\243]\031\326E\035\261$7?\017\321"
+	.ascii	"7F\256\241\237Y\350c="
+	.string	"\232\0036Z\004\213d\036W\321\307L\364q\017}\254\245\217\247\364\333\320\351\307\221\321E\366\310|\322\"\231\277R\264\005\366\310\374\357\276+\243\200Y\"u\263\335c\355,\322\336\375(\204\245f\214i\273\371\326\203I\344AO\335\214\264=d7\327Y.\266\016\206\222\205BU\327o\223\026\217\315c\221\266\316\322\335\332\261w<\370\255\224:\333\246\266B\234\332o\245\324\331)5\342\366>~H\372\360\341\347\r\232:\036:\233^\026\311|\032{d\376*\321\277m\301J\261[\354\334\365\322\220\201\330\236;7\313%\231_\262\342\330\334\374\033\246\377\3339\026\316\306\261pl\234\225c\221\226\216es\333\306\272y>\356ME\346g\262t\354\233U\203\241d\351\266\252\253\270\275\367\255\2277X_\300\360\246\210\265\360\340g\272\245c\327X-\370\210E\253\210r\027\027F\214e\0332\026\355)5,\306\366>\336\236u"
+	.ascii	"\202\245c\307X6|\034\333Sh\334\002\020veK+\271\3671\351\003\321"
+	.ascii	"\232;k_\206\362m\033\3757\213d\006\331#\363\226\213\276]\263"
+	.ascii	"il\332\224\037yn\276%\323\326\214=c\221\026\315o\313X2\317h^"
+	.ascii	";m\357-\004$\206eM\352\346\250\275\367\266\347b\362\356\356\356"
+	.ascii	"\356\354\271\230\267<t\266G\246\005\026\311\274\215\241o\245"
+	.ascii	"\364\327,\222\371\023\372X,\222y/\026\311\264]\230n[82\263\272"
+	.ascii	"\216{m\357MT\001\033\227,7\363\354\221\371\2366\267E2-\026\233"
+	.ascii	"\305\"7\260n\267W\254\332K\251\343>\356}$\272A\366P\211r\363"
+	.ascii	"-\240o70\361\335\235\335\300\274\003\364\265G\246]\263T,\262"
+	.ascii	"\203\265\362\016@86\242\021\t\331\261`\227\347\346\213\240o\253"
+	.ascii	"\\\303\231\r\3027\350\333\016\246\275\263\035\314k\3757{d\026"
+	.ascii	"Y$"
+	.string	"\363\267i\026\215\307\244\013\330\332\315\026\355Z(6\312-\232=\276\003\020\036D\265\317\366>Z\264\274\267\224\265\027\fY{A\311e\210T\0243\377\352\337>\331@SiA\2369\361 \204g\315\224\331\315\277m\362[&\366\254\003\276\302\362\332k{\037\215\210\2163\\\204\335\374\243E2\265=2o\226\25067<\206\213\274\004&\262\366\243\277\324\372q\007p\005n\f\037cx\003\3779\244\025\375\345\212+\002\\B\217\377\246x\002\364\227%\370q\005;@(\371\300\217/\334\262k\204\307\217\305~L\001\016\3731\330\177\321vx\375X\007\216\037\337\300+\374\270K\306\217cp\375x\353\277M0\214\037\277\370\257\022\363\307\377\261\3751\376q\371c\375c\243\037\267\3701\213\377\326\375\367\316\217\tp\246\337\334\340j\360\3379\377\345\201U\3748\265\372m\235\377\206\341\252\3372\340\277_\230\312f\360[\r~;"
+	.string	"\313\204\247~\214\202\324\377$6\376x\370_\021l\0258\330\243\377v\3777\370_\342\277\006\377\365:\002\376R\314l\204\377\246(\001\207\017\375\345\020\033\340\222\360\362/3\360_'\230\004?&\361\333\004\214\340\222\360\237\277\f\301]\303\036\020\301\177(S`\374\030\001!\370/\t\367\371K\364\006\271r\036\214]\350/9\360\337(\030\004\276[\301)\376s\370/\t\017\372\313\252\233%\352\277$\334\374\313\337\217U\370q\361\307\352\217\211?>\361\343\247\037\243?\366\375\370\374q\n?\236\300\217%\360c\022~\034\342\307 ~\334\200\037/\340\307\t\370\261\007?f\372\361\322\217\r\360c\002\374x"
+	.string	"?\336\340\307\031\374X"
+	.string	"?\276\340\307"
+	.ascii	"\3701\005?\336\360c\r?F\372\361\321\177\305\374\027\314\177\275"
+	.ascii	"\374\267\313\177\267\374\327\355\277S\376\333\366_\266\377\""
+	.ascii	"\377\273\366_\264\377\246\375\267\311\177\237\374w\311\177\225"
+	.ascii	"\374\327\354\277e\3775\362\337\261\377\022\371\257\220\377\362"
+	.ascii	"\370o\330\177\277\376\353\365_\035\377\315\361_\034\377\265\361"
+	.ascii	"\337\032\377\241\374w\373o\327\177c\374\227\353\267\t\370\257"
+	.ascii	"\b\376\233\342\277Q\377\005\376W\205\377\026\377K\302\177!\360"
+	.ascii	"\333;\277\005\361[\020~\373\301\377\273\377y\376G\371\357\344"
+	.ascii	"\177\223\377g\3775\360?\314\177\242\273\273"
+	.ascii	"\273\273\277\f\373\217|?\002\250\004\373m\357m\334{\363\262n"
+	.ascii	"\034\367\256Qt5\346\302\305\336]I.\366\r"
+	.string	"c\026\253\275\357\332\033,ZWi`^LY\244\244\215m\025G\243\275\302\362\332c\273\315W\226N3B\331X{o;\247\307\264\270\344n.y\020\315\200#6w\3635\250\321e\230\236\223\233\003\343\346k(\243\313\257\034\206\005\327v\3635x\321\307\263\275\217Cf\022!*\262\334\254\225\220\365\310s\363\261J\r1=n.q\344\272\0254\254\351#\020\226\034Tb\334\\\326\2603\310|\325\335|\r,\350\377/g|F\331\225\244w\223(+\342\366\356\362 \264B\016\2134\032/\273\210\364\324\245\221\272\371t\226\205=l\254n\276\206\0362^rQ\271a\207\306\263\335\263]\311\225\344e\244\363\001\231T\235[r\357.\017\330\207\021\26477\227\\\345\326\320\330\031\254)7\227ZClUs\360\334|\rUeV\371\242tQ\204\214\355\305\315\345U\351\302\007\313\0362@\\`\261\020\246\316\215\233[x"
+	.ascii	"\f\316\230\233\237\001\217fQ\256\320[i\366\325\315\317 G\237"
+	.ascii	"\256T\301\353\022\247K\024\025V<xPY\273\271\254z\261\307\252"
+	.ascii	"\205\233\237\341\213\276E\226T\345\324\t9\260\314\225R/\247\262"
+	.ascii	"\233\252\025\\7\237\2564\376\367\371Y\363&\317\333\315\177i,"
+	.ascii	"7\257\252\016LZ\271\363]P\016\261\032ln~\006+\372\031\314\262"
+	.ascii	"\036\025\344\200\200\271\371\031\206\344<G\f]J^\340\221C\227"
+	.ascii	"\206\n\230\233\377|\347\026\231\357d\272\021v\357\266(8\342\366"
+	.ascii	"\356\"\300\217\030\220!w7?\303\226\376\263\235Lg\367\233\031"
+	.ascii	"vn\256\303;\242$\207\331\315G\322\243\377g\271\f\227\343\362"
+	.ascii	"\234L\307\"\363\\&\363\\\346Z\315\345\267,\207\013\203#;\344"
+	.ascii	"\334\222sy\314\2262\212@fF\316-y\304(\347\226d\312sY\f\0359\267"
+	.ascii	"$S\236\313Tr\030\256\002\034\321\332IX\315kH\\P\216\263!(\314"
+	.ascii	"\232*\373\346#\265\321o\262\033\213\314p\362\031+\271\r>b\321"
+	.ascii	"m`+\342\366\336\031N\256\222\315\fI\025m*\260\253\261\275\367"
+	.ascii	"\206\017\037~\344\200\32403\233$\241\036^Ht\334|$,\372V\215M"
+	.ascii	"\317\232\234\306\"\263\232\214&-\253\311W.\234\"d\030O\332\230"
+	.ascii	"83\037\351L\037\311\207\316f\340X\257\275\323\366\336\032\200"
+	.ascii	"\270\336\334\254p\363\221d\350!{d\036\303\235>\206:\372\030\330"
+	.ascii	"h0&\0215u\\n>\206,\332J\356b\337|d\2730q_r\013\026\231\275dd"
+	.ascii	"\366\222\253\3348C\345\336R`\306\200t\204i\25503\027\234\374"
+	.ascii	"\202\005y\3631(\321\267jllcX.\234+cYK\336\222\263Xdv\313m\277"
+	.ascii	"\331-_\271p\354\233\217\235W\240\235\2213\333{\177\370\220\364"
+	.ascii	"\241\264\023\207\207\216\316\307 C\377\b\217\376Q\035\375#8\375"
+	.ascii	"#6\372GY\364\217\330\364\217\324\362\224 \251\031W\314\334\374"
+	.ascii	"\2433\375g)<.z\364\234]\343\n9cn\3062\220\214$\263\220\217Y,"
+	.ascii	"3\311O2\224\334$\373\310j\231G\376\221\323\262YF\313A\362Y\026"
+	.ascii	"\222\227\344\"9I>\222\235\344\261L$\017\311eYI&\313=\262\021"
+	.ascii	"\213\314Q\362\3273X\016\373\245zQ&\357lL\216\351\3213f\304wx"
+	.ascii	"\306\230\362\2146\251le\337\272\024`6'.k\314\230\021\333\325"
+	.ascii	"\221\331\nc\304y\366P\271\260lm\306\230pT\001\341\277T9\306\227"
+	.ascii	"k\304u\226\315\316z\371\231nd\033\3101\031^\306\366>\346(\331"
+	.ascii	"+\357\030\302{\207=\t\223\203\312\030\r\313v\205\013L\034S\027"
+	.ascii	"\333X^!\333\260\022w\251\264\304\304\301 3v\215\030\317]\\\013"
+	.ascii	"8YE\276\202\033\333\373\230u\254\305\345(\231E\2348c\216\202"
+	.ascii	"\367\030a2\366!\311\007\215\b\215'\017\3107\316\"\231JG8\362"
+	.ascii	"\216\265#w/\344n\376\021\r\375\243*\375\013s\372\027\332\350"
+	.ascii	"_\230\242s\215<c\214\030\221\233\177\341\211\376\005\036\372"
+	.ascii	"\027b\350\033%\365\215\340\350\033\275\351\033m\3217\272\242"
+	.ascii	"o\244\246ot\246o$D\337(\206~\221\036\375\"7\372EX\364\213\322"
+	.ascii	"\364\213\314\364\213|\350\027m\351$\213d\346\251Le\221I\271\352"
+	.ascii	"\314\324\213\0337\277\250\205.\301\266I\346\357l\222y\242;}\""
+	.ascii	"9\332\203E2O\244E\237\250L\237\350\206>\021\225\376\020\033\375"
+	.ascii	"\241+\372Ce\372\307I;?l\266ZP\271\371\252a;WJ\234:\370\016\246"
+	.ascii	"\303s\026\211\355\340\270c:XN\315\316\235r\317\330\310\344\334"
+	.ascii	"\222Q\260\235\2336$\313\021\333\271U\360\034#\217m\207\234[\322"
+	.ascii	"\207\017\0374\030#\327\n?\331'\313\036\231\037j\241\341\206\226"
+	.ascii	"\224\231a\344\346\017Ii+\345\272].\030J\226FN\315\t\202\307\242"
+	.ascii	"\270\031\333\373x\273\3344`\036\232X!o\233\207';\214k0\331\333"
+	.ascii	"\354\333\332\256\202R\200&F\270d2\213Ek\200\021.if\245\3405\027"
+	.ascii	"\213E\303\340\211\026\\2\211\321\3407\230\rn\203\345`8\370\r"
+	.ascii	"\237\301j\260\031\034\007\273\301i,\022\257\301`\277k\227\n\334"
+	.ascii	"\361\232K\007{\211`\225%\00108kp\031\336[\03701s\247~+\005\217"
+	.ascii	"\301e\354[\327\2262~\360\204\f.\231\274j\360\232+'\016\336\261"
+	.ascii	"\006\177a \"Xe\371\274\210\362&N\r^s\331\3348\366\315\307\336"
+	.ascii	"Z\0374\311\002\227L\356\275\205f\274\201\301\306!\377\230\314"
+	.ascii	"q\031\313\326\201\255\301\bL\226\216\233;`:&c\232m\331\201\347"
+	.ascii	"\346\013q\3218\314\006\242\260\036Rjn\276\220\232F\202\315\360"
+	.ascii	"ql\204\251\027-`0\330\213E\342/T\370\013f\001\263\211`\2255\201"
+	.ascii	")\027q_p\227\213\3410u\265\245vp@\206\347\315\226,\305\307\027"
+	.ascii	"\035:_\210\205\376\315R\333`\337|8\300\b\222L\025\026\342\330"
+	.ascii	"\360\022\234\306a\352\312\004/V\246\234\313\220\317\336_kcgT"
+	.ascii	"\226\304\271Y\363`\337\326D`9\213\333\373\310\206\221\3472DU"
+	.ascii	"\264\251\210\230\305\355\2751\033\226\262\301\374\361c\r\231"
+	.ascii	"\244\026\314\005_\301n\030\013\316\202\267\3406\213\304l\330"
+	.ascii	"J)E-\231\347B~\220\232~\220\023\375\240$\372AD\364\203\304\364"
+	.ascii	"\203r\350\007\315\320\017\302\212b\3058\347\f\214\233\017\224"
+	.ascii	"\347\210\241X$F\303gL\260\22309ch\370\tvrA\216\033'[I|\005N\035"
+	.ascii	"53\037h\211\376\261\223&@vMp\3305\301gCN\212`\205\335|\240/}"
+	.ascii	" \033\372@1\364\201\\\350\037+96\373\261\021|\344\266u\240\244"
+	.ascii	"\262\"\214\212\233q\022\246c%U>\260\266n\336\300\036\231\007"
+	.ascii	"\262\322\0072\352{\264H\246\007{d\376\307\016\021\\d\210\036"
+	.ascii	"\242\346\306\0263D\206\240Y\333m\204\034\0179\234\371\306\330"
+	.ascii	"\245\016\f\376\321C\317\214,En\376\217\232\276Eb\037=.[\331\n"
+	.ascii	"+7\343\036hA\233CP\235\03021n>\035\026\373\3573\264\306I\233"
+	.ascii	"\226\233\177,\0266\344\342\314\376\n\303`>v\332\354ar\363\177"
+	.ascii	"\316\364\177\220h\016\354\221\211u\\8MhH\271\371??\364\177|\003"
+	.ascii	"\343\260H\234\343\332\371\235s\343\236\204s\\\271K\307sC'\307"
+	.ascii	"\275\203k\330\267\256\242M\005\267'n\357\235\364\341\203\225"
+	.ascii	"\322\305N\316\314\270\005\246\021gl\005\334\205m"
+	.ascii	"X$\256q\\\343&\261q\310h\2647\017=c5\260\024^1Du\334[\346\034"
+	.ascii	"c\220\272\344\336\373\303\206\017\037\200\260\304p\030u\376\217"
+	.ascii	"e\340\031\026\211i\340\03000\227}\353:\356\255!\344\216 u40\026"
+	.ascii	"~\301a\352*\002[\340\304i-@\266\374"
+	.string	"0\363\177p\350\037sm\255h;\302\346f\254\365#\243\353m\313\315\377\321\3228\353\366\005YU\230\233\377s\245o\221\227\203]\034.\210\230\031Mn\376\317\224\276\217\036}\237\244\276\007\001*\262X\2167:\304\3022]\2321\\`\347\205\375\266\313}A\025\244\346\212\234\217\233\357\032\246\363\300n\023\036W@\276L\035iq\360\354\331\341\265\206\207\0232:\316\363\262\242#\206\21537\363n0\235\247\303\264\303\323b-\007\216 \260,7b6\316\303\361\363n\334\251\2400_\320\344\271\231\310\036\231\271\f\323y6\364\335\235\226\0375V \252\261C\214E\327y+\264u\300\347\212\017 q7\363h0\235\327\245\200 aKn\306\274\0312zZdjn\346\311\270m\035\330\032\206\366\fiQ&\006\027\033)b\250h\235\307\365\363\266\362\016\2722F\215\307\315\245=2m\031\246\363\264r\230\035\030F\262`"
+	.string	"Ue\211\251rq\036\214\237\367\302~1\357\212\324\301\272\371\307\036\231<\026L\347\271"
+	.ascii	"\242\212Q\205\b\026\257\005\224+;UV\234\327\342\347\261\260a"
+	.ascii	"\202\200\310\340*s\263\217=2-\023\246\363V\020\241i\243#\302"
+	.ascii	"\273*{\350\260=8\320\360T\230s\017\220\303\022\343Y\211\225E"
+	.ascii	"\266\\M\361\252J\260\n\2545\351B\225C\210I\035\020\253\251\266"
+	.ascii	"\240.+aa\244J\033\327\013MO\025\317h\306\375\224\315\025\301"
+	.ascii	"\303\333S\356\236\330i!j\343%\206\265\007\216\336\301\243\216"
+	.ascii	"J\217\311$\350\207\261\256G\2364\263n\f\326\224\211\307m\005"
+	.ascii	"\037`7\337\271S\272E\231+K\352\2700\310MFGg\316%ya7\\vnWcUh\334"
+	.ascii	"|\rt\310\311\231s\026m\303@Z\202\325\303K\322\214\303\352\201"
+	.ascii	"d\216\354\b\030\326\315\327\300\205\0349f\034\232\2712;\347H"
+	.ascii	"\335\22797\343~\330\250!\262v\263\t\227\367\334\rYa\343\346\323"
+	.ascii	"Y\264\377>A,\266\264\344\260s\343\306\204\223\244w\023\260\025"
+	.ascii	"qB\326\0241\276\271\t\307\307N\214\222\032\031\260aS\272\201"
+	.ascii	"11\267\260\345\2013\243F\r\234\251%\272\f\230=\307\233\237\001"
+	.ascii	"\0264hJ\267$/\314f\216\210\231\031X\031\036\263\233\237\201\032"
+	.ascii	"\027.\246\231$/\243\035\236\027,8cCW\266|\224\275\3354\223\304"
+	.ascii	"\313\235\0317\233b\3142C\214F\310n6\311\374v(Is\3633\3102\307"
+	.ascii	"\230_\3140\377}\200nX\201c\343f\023\214\020\253\251\026n>\006"
+	.ascii	"x\364\351L/\377}J\253!E\270\334l\266\320\365\343\307\221\233"
+	.ascii	"\217A\032}\2134\273\224]>\233"
+	.string	"MY\362\346c\240%K\026SK\226\251\036Yx\311\2125:\334njAZ\261b\266\215\3212W\226\344U\211\203\002f^\271\331f\252\221\325\330r\263\311\226\367\310q\023\344\214\n\025\263\212E\3330>\300:\223\364Bf\n\0161f\225{\206\337(y+r\3631\320R\273\2329%\311\313Hgna=\361\222|Rw\246\211)\345\346\024!:\2657'\002@\023%\212\251\203\227\205\345d\213\327\003\f\013\354\346\013`\f\n\024\020\246\230\224]\033n\356`\271\371\002\210\361\344I\351\026\207\245dI)\207CI\327\315\017\200\231&MJ\267%XI\306\314|\322\346\220M\235!Ab2\001\001\212\234\333\230\027_\240,\271\311\204W\305#O\214\233M\026t\022\272:,\246\231\224\332\21383S\211\tS\276\314\305\t\302\202s\246\316L\222\317l\300H\270\304X\0319r\244t3\033\263bXH\232\334\374"
+	.string	"\334 #+\205\330\242\343\024\232'cAjS\342\244\271\371\001\270*R\244t;\300\206\263#b\"%&F\235!C\316\260\210\210\321Q\206\246u\363/`\022$\b\021+\310\026/G\226\266\263\233\177\301\326\217\0376\tV\017/Q^lT\324\364\350ana\361\310\221\335\220\030\277n\276\005,\210\211\225B\200\312\260\300\272\314\206X\240I3r\363-\250\001\006\266"
+	.string	"/8;\237\267)0\\7\337\202\275c\007\bqpvf8\254\270\334\335|"
+	.string	"\300\321&\016\023\207\251\303\242m\030\226\312\021;}w\345\312\224\231\343\246\0164O\326\264\271\371t\367\354\277\217I\006\206\236\272\233\017"
+	.string	"(6l\224w,\332\206\201\341\013W\236%I\263\013\315\231\0327\037"
+	.ascii	":VX\301\003-u7\200\266\330]\233:4h0EaRf\266w\227\207\037\251"
+	.ascii	"#3\230\334\374\n\322hS\206)\243\024b\3216\214\2442h\346\312\262"
+	.ascii	"\320d\331\335\374\n\270\350[\026lI\306\"K2&\227\317\325\336Z"
+	.ascii	"\003x\022\005,Irgu\021`\210\355he\344\314M\256\277,S\276\231"
+	.ascii	"[A?.\356\224\330\271\331\3242m\364@\322\302\315\257\300\212\276"
+	.ascii	"=\223c\265T\255\235\241\tc'\006N\315\027\363\205\t\303\2342]"
+	.ascii	"\224wf\225\331\302dan3\313\2742U\230FS\312\2442\255\314\025\026"
+	.ascii	"ib\375WM\271\007\357h\223\327\360\0167yMK\204/`seI=h\346\312"
+	.ascii	"\222&V\t\367\304hb\225s\3128\271\002\264\020%\rO\231\347"
+	.string	"\313\003\227\271\271\262$\033+u\312\244\bVY>VjX\210\273pi\362\032\206\222\245\247\250\2011\261J\271rN\004\253,\037\025UK\350\224q\304\230\214\355\275\337\224q\304\250\304\341\035&V\271&\314\324\\Yr\357\235$\364\202\316\013\025\030\344W@C\227\025\274\310SG\304$\006\017!7o\"\237,y\220\310\270\371\025H\351\277L\226w\254\231.S\254J;/\357d@\312\021\271\233K\272\274\206\365\345\226#\016\222\260 e7\277CR\377\345\234\020\323NN-\313\315\3570G\277\203\031}<\203\001#\210\327\315\357\340\246\337\001M\277C\231>\227\022\316&\"j\201N\007\226\233\337\301\207~\207\030\372\035\252\3649\330\321\347\320F\237C\026}\016K\3649\364\320\3470C\227f\230^\236\031\322bA\255\312\315F\366\310<\230m\221L /{d\236\303\013\375\227bn\221\245\230\262\207\007\257\275U"
+	.ascii	"\262/&c%\230X\221\260\233O\201\235\376K0\267\310\022L)\226\324"
+	.ascii	"f\224s\363\260\207\255\355\346SP\247\377\322\313-\262\364R\202"
+	.ascii	"e\264m\344\271\3012WCw\241qKr\363)\350r\213,\273\2249\"\340\265"
+	.ascii	"\271, {\203\263\333`E\303\307\315\247\340M\377\345\226[d\271"
+	.ascii	"\245\264\221\321\266\021H\r\216-\263\344\336]\004\340\335\201"
+	.ascii	"b\206\316\315\247\300J\226,\245[\022\0364]\036|\336t\320\321"
+	.ascii	"\270\331\215\202c[\233E\343\251@\303\244\fn\213\r#7\237\202\034"
+	.ascii	"\372/\331\220%\233\325r\321v\326\317\017\256%e?M\312\320\270"
+	.ascii	"\273\371\023\320\351\277\254R\256\225\310\274\246\215Y\032)\026"
+	.ascii	"&ng\035\t\360\t\332\350O\360EJ\271&e\312\224\fhY\323\237`\fJ"
+	.ascii	"\031\005J\231\226\206\206F\201\251\tt\350O\240\342\254trV>9\335"
+	.ascii	"\313'\345\2312\"Unn\322$\253L\224\244\376\2063K\226T\315\021"
+	.ascii	"1\343\2759\201\273q\3637\244%)\315\222"
+	.string	"\224B\314\275\355\321\013F\226\022%\245\020m,r%\321\337\260\243\254l\001G6t\0311\322\302\334\206\255\377r\fY\216Y6\213\266a\374\254\230\352\221\225\334\333\013\001\210\354$\301\021\344\346'm!B\244\024\242\367\336\306\343\206Q\201(`I\314\222\320\364K\037\345\217\227@\200\224B\354\336{\317\201\201%I\356\256,\017\177\031\344\245\2203.qxn>]^\373\357\323\343\002$y\363\223d\350\377\366\3677\267T\326\336{\253<\356\254\251 \363\267\267\245\265\036~!\213m"
+	.ascii	"\376\347C\241\260\267U\332\330\336\333\326\321G\332\244lX\260"
+	.ascii	"\377\2667\325\227\321\001_ZT_4\256\322\276\264\214\256\322\276"
+	.ascii	"\266\221\212\210\321(k\177\031\257\322\3666\242\2422\212\360"
+	.ascii	"\322\272J\223\332FWi[kW\235\321\262\373\370e\334T^\333hSm\251"
+	.ascii	"\235\346\245e\301\025\325\227\326U\232\224\226\321U\332\227"
+	.string	"\326N\373\332E\233J*k\005\325\3162\332i_tv\232\227V\321U\232\227\326U\332W\031\033\207\305]\235\214\273\261 v\326xE\265_\270\270!\225U\364vu\364\332m\366\266kV;k\277\355\035\200\275oxe\265\221\242a\261L\275\275\230\262\"\345\265\301\305\024\230\327\246z3\332\375vU\346\265w\331\024\324v\261\367\336\037\030\217o\373\207}3\206\335\330XV{O\260\217{\273\330\333h\003\207RR\241\3263\270$\034\006\203C\237\360w\246\253*\034\372|\326\237\260\204T\310\310\350\204z\226XQu(\212\004\321G-\256\347\232\002\210\013\252\217D\321\017\350\373\351\241\275s=E\020\325\023\204C\024\320\365,\002O\024\020 \252A\r\031\322u\204p\004\242\032\304@T\203E\274\023\352Y\002=M\f\323\323\304\317\241\224\22684\241@\023\247\020\002j\thZ\\O\324\251\350PJ\027\024\251)"
+	.string	"\201\303\021\024\034J\311'L\241\236\032"
+	.ascii	"\201CbOuZO\247\023\350PJK\303\037\0208\034\241:A\251'\320\t\310"
+	.ascii	"\347;}P\337\b$\025]\3175\0055\230\236@\020G?uH\354\020\374\255"
+	.ascii	"*\004|\023\034J)jhbi\370\033>`\370\023\376\210C\207R\n\236\276"
+	.ascii	"\336\322\360\347K\207\016\245\324A=\211\301\241O\350PJ*\361i"
+	.ascii	"i\370\303\240\022\237|Bl\260\300\241\224\226|NP\276\365$\252"
+	.ascii	"\277&\242\250\364\204\017\205\n"
+	.string	"\021\225\n\035J\251\030\374-%\255 \212\301\237\021q84\241\3517\202\250\351\034\232\260\366\364\241\224R\024XlB\241|\352\005\300s\035\256\027\320\340\211\002\032<Q8\241\236%L\024U \237\2608\202\217OX\034\241Ih=Wu(\305\372K\207\277tD\023\221\nb\355\241\301\337\n\264\252\350z\232pB=\327#\340)|\372\245\260\202hB\323\237\212\212X\325\023(\204\006\177%P\240/E\b\364\351LQ\024 2d@\203\277\022\347\nDE\004\213)<\t\177(\206\301\013h\360W\302\207FA \352\f\026\251<\"\237\357\304\3034\305S\306p\264\376\204%\250'\324\263\204\317\t\350PJh:\364-\371\234T@Q8\327S\004\006H\250?\240C)\371\322%\237\023\272\236$\240T4uBID\221\b\342@\251D\024\211U=\201C\302\337yB\024\211\242\024P`\223\360\214\300\3200=\037"
+	.string	"\245\364\003\372\226~@_\323\360\204\037\320\307\023\342@iMO\242R\211\023\352\271b\020\376\316\023N\250\347\252A\234P\317U\303\241\224|=4\370[\205\305\024"
+	.string	"\352\323\t\034\341I\370\013\246'\320\t\365\\\215\236\001m*\256\277\025\b\002]O`\321\007<C\234P\317\025\351\276_\212\n\321'\375\017B0@\b\"D\361.\002\0028@"
+	.string	"\007\346E@"
+	.ascii	"\023\023\002B`\322\017\201\t\257\353\232\002HDI\030\035J\211"
+	.ascii	"\250\006\227\210j\020\355\255joEO\370\316\021D5\b\224\256#\204"
+	.ascii	"#\254\352p\004Q\r\036\251\275\240&\341\031\f\016C\250*\352\033"
+	.ascii	"\246#|#\020\325\340\021\332k*\341\204z\226p\362\375\004\321U"
+	.ascii	"M\221\302\004\353\352\2046\365V\rj\261\007\345[\177#\232\204"
+	.ascii	" \200\300azt!EW48D\002\001T\317\211\bD\323S\205\246\364\\\327"
+	.ascii	"\236\023\332\264\341PJ*\234)\260J\001\0208L3\224o\375\021K\025"
+	.ascii	"-\002O\024f\261\247\006\177i\t\325\367\013\236\302\024\"V\250"
+	.ascii	"\247\037\320\tI\2053\305\303\024\325\200\317w\362\326\236Z\001"
+	.ascii	"4\370[\365\241\224\242\322\245'\342QT\372C<\203\276\264L\321"
+	.ascii	"\246\037\212aJlB\243"
+	.string	"R\243(\024H,\212p\002\236P?h\323/MQ\024\303\236\360g\301\332\343=\235%\206\277\336S\021HL2ZQ\025M\233\204?\023\275\365T{\301b\272\236@\211*\005A(\360\364\375\254)\212B\370\363\245M\277`)\374\005\365\t\037\n\345\213:\203\232H\r\001\034\022}\251\006\025E\323'T\004\n|\022\202\b\236!P\020\235.4\001\207P*\232B\225@\327\023\305o\365\201@\233\206'\244\2773I\370\363\241j\261\027u\006{Q)\020\020\025\nO(_/\252x\366\242\316 \221\232\016\323\0245WTur\032\002\241\304\024\253\321\006'\247\341Z\364U\240\376\242\316\336S\321\004\332\264\026\211\302\237\006\224\230b\355\241(~\353\211\342\227\242M\034\322\341\352;\235z\303\265x\366\236\204?\250u8\f\252=_\232D\3549\021\201=4x\246N=_\252\366~\252\232n8\224\022\nD}\2763"
+	.string	"j\317\347;\313\365PJ\031\244(\020\370s2W\242\036\357PJ\253\257\230\256j\007j/\n]\213A\243\023\276!\260\3273Waq\350\353\365x)*Ta\330\353\361\324\024U\213\302^O7\t\177'z=S\025\376\210j\257\307\003\242\275\236\317\332[\325\037\260\350PJ*JL\261\032\240\tMO(\325"
+	.string	"K\352\3723\261T\024>\031 \252(\374\001\r\360A\b\275\020D\210ZB\233\212@\237\360\267\224\252\305\245\003\254Q\250\020x\nSt\025\376zM'\232B\255\304^O\003\n4%\366z\346\252\376\200\275\236y\256gS\257g\242 \370\251\275\236y\3027\004f\037\232\366~\326\237\260\004\341\b\353O\3703\323u\204OX\034\241\351DI\370| 0\250=\024\250\b\237\357\324\302\021\232N45W\265\367#\246\340\204\212@\211)J\364J\030\221\002\020\352\023\236\253*\374\351\2657\201\022\262\3607B\250\372\314\037Q\305j/D\007%"
+	.string	"\205\350\240\004\037\323\327\301\017\037JI-\232\330\240\366Nh*J\321U=\203\246\252\242iS\323\311CQ\234\300\024\212\304\240.\366P\240Mj\321\204V{\250\357\207\002\025\241\026M"
+	.string	"\241=\224\230\242\204Z4\341\203\022S\254j\321\004O-\232\300$0\365|\276\323\344\251p\222\b!\002\204\271\036J\251H\f\366\206i\212'\237\357\\RS\024\305/m\032"
+	.ascii	"\332#\301\001\b\034\204P$\006\217\204\303\337Z\004\016U4\375"
+	.ascii	"Q{\030\320^\nEb\020\310\\\201E\025%\201\256\250\210\"1x\001\355"
+	.ascii	"\t\237~\300\2637$|\372\001A\370|\247N\321t\242$\316\365l\362"
+	.ascii	"IU\247\036\324\323\017\252\347\363\235A\351\t\345\313h\3230\204"
+	.ascii	"p\370S\177(\3204\b\005\332\204\201'\212\024]\205%<\t\177@b\360"
+	.ascii	"L\301\347;\217B\210"
+	.string	""
+	.string	"\341\363\235&\352\023N`UO\324\204\025DS\005\200\250\317\007B\375m8\224\3220M\3614\201\332\033\246)\236\314\265\327\201\007h\360\267\022\207C\023V\364)=\327!\247\020\"@\f\323\024O\372PJKj:T\205\250\332A\355E\235\302_\360\202\n\031V!\252\242)q\035\n\327\323\004\212\r>\024@!\264w\001\355a@}iq\230B\212\256\350\t\253\020M\323\242\357B\212\365\347;\211\247\t\242\365|\200\005P\265(\244\256)\n\004\021\002U\213\030\320\247s\025\242\276\024\035!\034\376Vb\260\250\n\207>\016\352OEStUS@\255\247\t\024C\350\323\271\002\207(\200@\324\007\004\026\235\326\323\004\212\243UX\034\206"
+	.string	"\002\321\020)Rt]\317\007\240\276t\350\204\204B\250i\370K\321\021ND\023\326\323\304O\350I\370\023\246\347\0052"
+	.string	"O\337o\375\245!\322\341\b\302\341o=\323\242\210\3654\201bh=\224\322\322\360\247\341C\"\232.\255\303a\272\004\224\"]\321 \nDW\rj\357\302\t\365<A8\374\255>a\321)\b\355\225\260\246\303\021\031R\364\347\364[\205h\323\357\207\250\006U\342\223Q\024\332$,\001]\317\264\251x\232\350E\rM\234\360\235@\023\031\324\247\237\223p\030bM\207D\240\265\027\002\323*\374\0255\b\240z\350z\246=t=\233\210\305\036\360\374\245\250\212\264\366DX\205\277\"\357LL!,\250"
+	.ascii	"\n$h\237\222zB=\327%\237\323\222\360w\006\227|\251\272\244\204"
+	.ascii	"\224\242\253\357LO(_o\035\016M\240i\021p8|@\257\374\317#\263"
+	.ascii	"ZhT\345A\216\34551hz\272\360\200\360\200\360\210\374\202\324"
+	.ascii	"\336S{\347\b\362C\006\313\216\221\344\356\212\341\341\347"
+	.string	"\r9\217\b\027\2538u\316\334\314\023\242\363Py\222\346f^\220s\tC\006L\307\315\247;\227\377>YF\026&cn\276\006O\364\317\373a\232\321lot]>\252\020\255\310\001\227\247\007\217\207\022(aV7\363x\374<\0329\205\246\250\023\002$\202@\252\344 \216\305\224B\312\031\221\232Ms\243\025@0XX \025J\243$?\023@\303\013\315U9\321\222P1B3\222$\345\223Js'`b?re<\224\345\\\206\035\251\206c\335\353\236\301R-4\b\243\206QL#\025N\032L5V0\270}P-\b\275kp\266\257\207\236c\232\322\207TJG\200@\f\332f\257W\f[\237~K\322c\217\261\206\2614\243\n\007\267n\353?G\316wb\031XS\242\216\362Q\253\222\241\341p\207\207\031\024\371\036\301\024\017k\311\277\325\325\025`?\223\334\3516\034\212)b\002\270\262\262`\351l)\334"
+	.string	"\2178\355\003\276\223\001\202\0077\364\233\377\344\0039\361\237'S\232\365<\227\307x\007\037f\220\354\017\305\030\007\2505\310\363b~`\343\013\004\203\300\304\002\355\356PUVx\025\256\013{>\223Q\245\022L\236AJl\r\300\340N\300\035\025\241\306\214}\265d\377V.\370\226(:\271\203\004D\036 \260`\226c;&$\021\214D\253 U\3277\231#\326\232&R\220\033\231+%\207\374\261\322\033\322\330\362e\327B\rha\211\266\274\b\227f\234H\031Mg\274\235O\027*\303vv\311\267\222\217*\333\255B\n\357%\275\305\025j\313X\200\332c\237\244ih"
+	.string	""
+	.ascii	"o\251{&\016\024\3368\032f)\256\330$\\\314\352\n\025\274\255\321"
+	.ascii	"\035]K\244\277\306U/`\225\037A\\\241\202\r\262\255\354\rG\361"
+	.ascii	"\355\203\244\336\307f\032\356\025]\265\030rs\001 \362\223\013"
+	.ascii	"\236\357\fn\3017\372S\032 8Y\274\326o@\002\337\262\322\007'\312"
+	.ascii	"\373\327DN\273\236\357\377Q\317\030\242\325\255\tx/\003\321U"
+	.ascii	"\fS\360\374\340\214\031dB\024I\343\325fV}I\037\375\310\0065\024"
+	.ascii	"\304\216{4\321\261S9:\363\233c\017\253v\216\"\035\207g\301\370"
+	.ascii	"\2124\206\374z(\r'\261\372D;Muox?is\241\320\301\270\\\313\020"
+	.ascii	"\330~\223i\016\347\222<<\3255p:\360\303H\356\341\262\366\007"
+	.ascii	"\021\311\t\234\240\271;\206L\364\302\272\025^U\b*\343d\bM9\272"
+	.ascii	"d\364\345\262\n\004x\027\024\262\213<\326\367?k\331K\322\326"
+	.ascii	"\262'\272I\2641\337I\246,\254\243\360$3-_\003\n7\016\031O\317"
+	.ascii	"u\312;0\025q a\005?\265r\242|\371\255G\314\257\201\021\336\022"
+	.ascii	"\021/\254\315\255'\016kO;uAZ|xZ\310\305\253\025\226\017\371B"
+	.ascii	"K\303(.\271\221\305\002/\271\202}\353\371\276+\361\006\307\236"
+	.ascii	"(\326\372\351Fw \026B\3021\300\317\226\252\206px\366P\373\267"
+	.ascii	"\363_\323;\377\213\240\231\376\241\257\230\211\n]\267W\\^\350"
+	.ascii	"t\322d\373\241t\227,\0173D}\030A\316F\244/\333(\377\226:\ts\342"
+	.ascii	"?\3048\257\002\272n\377\2556\257$d\350\013\201n\fM\033\346\334"
+	.ascii	"\226\323s\262uAd\211\034\245\211\211z\"!\304\203\003\266\206"
+	.ascii	"\262)\002\027X\306\031\0300T\037\310-4\355\032]\254[\241\323"
+	.ascii	">\371a[D\324\037a\r"
+	.string	"\3730\26163\001\013\006\017\321\324`>\320\331\036t\256\326\t\357\021\343\371\214)@!\337\017\243\354\217\002\310 3n\272\001g\310\234\320-^vL3\252\321\237N)\023Wv1\334\026F\322\017\007\375-\352\235G\351\320\027\345\345\f\220@\230\t(\215:\365{\274\207vHj\n\241[\232\265\302\266\357\317\t)\224\361\310\007\023[\361eC\225\367I\306\302'b\347\230\376-\0178K\034\321U\344M\354t\032\021ZM\022\007Vm\276\36210\020\337\016\336\032lf\016\273q{\346j@\b9|\036\005\017C\214a@y\326\3458lR\300\006\240\030\275\226\016\313Y'$'\330\366\315\017\271\315\342\266\236\265\220\346\352\336\246\202\006\276\222\335\260:\304\343\032S\244\331\214W\3167\214)\350\030*6T\375\227\022\330\240\207g\320\353G\200\353\315\036r]\332+\207\237\376l)\346\032\226\263\2418\364L\201\017"
+	.string	"\323]\226a\240\305\235\030\257\247\0216\255\261:\"K\006\274\231\234\354\224},\241\244=9C6\240\025\201J"
+	.string	"HH\232 \024(hJBaS\314\031\245\006\312^\277\006\376j\217^\322\b\r2%\006\251\237v\353\376"
+	.ascii	"\365\032 Q\302\304\352\231\2013\004<\376L\234'5\006\300\236\213"
+	.ascii	"r\344\244ZF'T(\024V\233\254\345RJ\255\211D\367\320\317\323\027"
+	.ascii	"B:\316\365\211\350\204\354\023\366\203AQm\374\274\t\244\3139"
+	.ascii	"\3146f\234\230\225\321w\230UT\006\203\335\273\021I\312D\336o"
+	.ascii	"<lNP\020n\242\020Yb\032\255\323\223\200\316\373\005v\305[\317"
+	.ascii	"\341\365\277\217\022\b\230!\221\371%\277PL~&\216\253\371\326"
+	.ascii	"\221)(\364\231\367\217\274\020r3\300Z%TFT\242~.^\b-\311\027\270"
+	.ascii	"\351\310\334\320\004%F\001AB5\263!\021\326\263\232\330P\256\222"
+	.ascii	"\240~=r\336`\020\020\271\026\216\253!\312U\306\nag!\255c{\205"
+	.ascii	"\212\371Z\250?Dg\355\234Ak\303 Y\315\321c\214\372\315\013\037"
+	.ascii	"LN$FR\347[\342\343{\365\303\244\2743\r\021\304gW+,C\311\331."
+	.ascii	"4a\207\247\316\342J\001(\237/6%\224\201A\225\254i\246{\372\021"
+	.ascii	"\310Xi\t\021D\035\341tQ\321\003\026L"
+	.string	"\313K\352\035q\271\006\362\227x\n\273\002\016\344&#\344H0\365\031O\211\335\254cd\250\261\003\007I\265\213\321\265\301\270\"]\215\326/\327\b\255t\236\324\2422P~,\006j\336\204c\257="
+	.string	"\326\271\206\032\346;\301\034:\236\350j\ft\342R\031\260P\334\267u\007\206\210\257\210u\025M\244[\213GK{\016\365ZP\272\245\0352\026\333P\276K\207\213\336\266\351u\324\376\255\301}\252\027I0\244\253\356\331!\013\207/\210\\\022\2105\327\210Sj9\027\347\037~\312\345\345\207\032\206q\354\340&U\tI{\027/\301iK\345#\242\322<)=|$\314\365\363a\357\002>@\327l\300Nx0\316\fB\263"
+	.string	"k\317\007G\325\005\360\006BQ\016gAx\027l\203ih\201\361\25228hwa[\237\036j\223\363\246CN\233\317\016\031\n\300y\260\274"
+	.string	"\020\330R;\004\371r\252@\230SF\327G\303\241q\301\320t\001a\342\337p\240\0167G\244a`<4P!n\331s\3424C\365\313\2729H@\326\260\231Z\033\013z\227\252\362\252b\3070\307T\212\240\332\373W\203\323\023\020!4\212\231\037\267.\023\btl\007\"\362p\336\305iX[\371c\370\303&\311\205\340\242$\345\314\365?{\201Tj\261\255\235\231c\224\336Q\036\254\003)\022H\253c\376\177\235\031\242\336\022p\220Q\351\273\202\035\024\372\241\305v\355_2\250\021\370\002\373-\277!j\r\3217Or7\335\307\305\220Q\362\242fS\327\267:\274\223\033{8\253\353\275Q\001\202\333\364\377\"}\262m-`\300\201\024\325\353@\256\177\247\221\330\022\347Aqn9?\024\2756\314|~J9\002\263\373\312+;#\330\320\370~\336\302[\222\325\327\300\340'GL\214\034J9j-\347"
+	.string	"\n\336 \347w\252\257lz1\202\202q\001RHE\363\322 \335\303B#'Do;Y\375q\300~,$"
+	.string	"!xN\025p\326\240\n\313\210DM\240\213A6\215\361#\024\033\t\206\375\337\277\260aA\314\255n\314\330R9\230\264\025\314\207s\024\352\224\310_\221\377\t?\330\226\255"
+	.string	"\025\013\363H5\t"
+	.string	"\320\331\315\273L\232)=\343\032\325\214O\347B\310K\334ldV\332\035\227\363Y\230\367\262F-"
+	.string	"\355\207\330\207?\211\341\265y\304\330y\207\037\243\347\303\004\001j=\232[\300\341\322\322\337\030\221qR-\312\324\252p\215T\030o#_\250\240\352\342B\223P\017\021x\352\3537$\021\322A\276{\245 \007\013\004\227[\352\263\201\376`>.\006\221S2\352<\325u\037\226\276\363\321\017\327f\320\033H\207\3632"
+	.string	"\032\2011\274v\b\34439\377\254\375\300\244\332,\031\321\242\024\260\005'\300\354\022\303 \352[{=\341.)7\034\365\f\373\3513\226\022\232j\013g,9A\306\323"
+	.ascii	"$sz\245\260\037\264\333k1\311gN\330\271\337Q\361wZm\212\026\004"
+	.ascii	"W\234\2141\206\237\346)\255\205\350)\267\216\362\206|\004H\007"
+	.ascii	"\232\033\225"
+	.string	"\nr\240\310\3460\363mg\212`\356\327\350O\373Z`?0\177\314\344\224d\220?\205Tgi/\346S\326\2646\003\367S\025\376T\2262\303|\240U\367s\215wm\351j\252n:\337\200O j\215\f\261\001\311\232\301\352nxw\006n1B~=5\256\374\206C\222\310\233?\032\241\"\0028\243^\203`\236IEBW\032I<U#O\312\200j\225F,?0\221m#\001\273\001C\323 P\322\027\303\211\205q\217r\364\220_\007\221\244lb|\257\004}Mr|/\261\270h\221\337\366\205k\306xG\226\037(\214$\320\3011\262\3368~\030\016C\304\262\004U;\320\357\247\0300\301m\220\r\333\026\241\323\016J\026\210&\220\207u5\370=\f\334<d~\341\024\354J\256\263\303p\366\021BpIh)\002\366\036Q\270\300#r\257\206\036u\033\345\344\214\374r\234`\3042\b#\0257\276\243\003"
+	.string	"\002\264Z\221\242\"\251o\027\026(*\215\347c\361`"
+	.ascii	"\273\345Z \301p\231\030V(\002,1\336\350\206\007\021 \211\310"
+	.ascii	"\210\303\027R\033\236B\214`'$\240\221\323\262\245/\030\324\177"
+	.ascii	"y\343>\"\272\033b\262 P\366\227\311\373\273\353\262\215\234;"
+	.ascii	"\236\\\216\217\214\336B\350!h\3504\202\352O:(\340\364\236\227"
+	.ascii	"\220\037\177\324\242+p\001\252\211\3519lYK=\\\3628\366\255X'"
+	.ascii	"o G`q\026O\030C\016\t\273\313\262GL\350\335!$\216\220\345)\016"
+	.ascii	"\003\205\255\217\344\347\177\360\212&=^\264/s\245\247\326\267"
+	.ascii	"\026\362\224c\023{\377N\312\272\003\314\303~\327>J\316U\261\363"
+	.ascii	"\024\210\344$8{\257j\236_\013\254\352\204\263\240\206\247\203"
+	.ascii	"\247\340e\241p4/\333\r\304\362\231v\367\340\200\364\236\017}"
+	.ascii	"D\271!|G\306\315\345t\227\333n\221\2713\345\f\252e\330v\035\341"
+	.ascii	":\363\365b(\007#\362j\263\273yo\321?\273\352u\202\263n\334\021"
+	.ascii	"0Y\004\350Cr\002v\3341\236]\3424\0026\2337[\347\\\243\263\345"
+	.ascii	"\270\n\310\037\213w\352~\245\341MZU\017\326\356\310\3739\355"
+	.ascii	"\036\227\362)v.\023\371\013\374v\201\363\\\335\177\227\353:o"
+	.ascii	"\377\350\352\200\245\323j\030\003wL\0279\273\013\214<8\242\202"
+	.ascii	"\371\261\340\362\352\037\001[\210\004\355AX\365\261\374\005Q"
+	.ascii	"\267\321\274,]\020\371\255\221\261O\252\267\246\326\213\267\317"
+	.ascii	"\343\231\313\351\316\322\371\330\266\322\005\230\215\361\241"
+	.ascii	"\037\017\261\261)\306\201e\216'\030\223\\\260\262\342W\233\247"
+	.ascii	"+"
+	.text
+	.section	.gnu.lto_.symtab.205422c25bd7b04b,"e",@progbits
+	.string	"fcTasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"flashfsPoll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"afatfs_poll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.205422c25bd7b04b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1143 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\205\b"
+	.string	"t\013\271\001"
+	.string	"\025"
+	.string	"\220\254\202\314\013\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\270\372\352\363\016\002\002\007\002\001\004\243\237\214\230\017J\002\003\004\b\b\002\t\002\006\002\n\005"
+	.string	"\002\001\b\257\253\313\240\016\030\007\002\001\t\345\227\312\267\013\004\002"
+	.string	"\002\001\n\207\330\300\037\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\353\323\235\254\b\017\316\362\227\372\013\020\260\222\312\332\b\007\002\001\021\223\210\212\227\004\006\022\315\361\362\357\016\b\007\002\001\023\353\303\321\231\004\024\302\260\202\373\013\025\301\275\326\260\016\026\247\326\301\366\f\027\240\342\234\212\n"
+	.string	") \260\2021\032\336,9\274\2002\261%\340\206d\\\344V%\243+\264b\222rG\271:\320\335\200\t\b \001\311\bH\226"
+	.ascii	"\346\205\006\2305\356x:6\021f\200\001g\347\026\016\t\230\034"
+	.ascii	"\016\201\001Q\004\314\001M\001\312+`\021i7\005s\"\004\356\366"
+	.ascii	"\306(\236\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 \177\255\002"
+	.string	"\204\003s"
+	.string	"\017"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\001\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021"
+	.string	"\022"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\f"
+	.string	"\250\300E8C\250\32655\200\001p\007l\344\nn\036"
+	.ascii	"\003^\232\202\001\026"
+	.text
+	.section	.gnu.lto_.inline.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\024\002\335\b"
+	.string	"\222\213&,pK\323\030\374\007\327s\244\204@G\b.\\A3\270@P\b\252>\345w\243\246\347\252\252\372UW\n*\211\335\215.\211[J\231\002\3777\334@\222b\302!#\031\252\364\261\273\314\317\r%u\034\035\022\r\356\201\037\323p\376\231\352\217Rr\303\b\270%\312\247\354\366\230\004p"
+	.string	"E@A+\0270 \356tl8.\3514\322\353\272,\344\017r\301B\241\002\037\b\031\001q\201\201\017\263\307(\363qRK\037\227\374\317\363\345\356.\362SV\273\373\344\243A&\354\256\363\315\252\004; \300\"\232\033;\177\302\322\273\301\272,p+\3111\347g\262\340H\355\364\251a\020\035\230WC\364\342\355B\204\fW\003)\336%~)\324)\210L\203q\215\233\344I2\223\"y\"sB\303\254\021\217c\207M\260v\216\007\377c\230&.\330\352m\357eyL!\020\3470\020\326t\025(\274\2055\207\002\271\344D\374"
+	.ascii	"f8?\022\013\343\243r\201[_\361\214\335b\240\310O\345\025j\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"E\004"
+	.string	"\002\006\023\036\260%\351\f\303\200c/\017\303B\371"
+	.string	"k]\222$\371Xk-\261\255\221Fl\261\211\224)\377\004K<\370\027\374\201\323C!\321\003>y\344\317\037o\274\271T\361L\327\266D\260\275c23\026\312\323\226Q\264\305\215\242\341Z\364\"\032"
+	.string	"@\b\314\r\027n\231\272\t\024& \365"
+	.string	"\340ye\261\263\373U\027X"
+	.ascii	"\344\340x\nm\2705hf\020`V\\\013 \027\334\200v7\205\341<'g\337"
+	.ascii	"\226%`\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\270\004\b\230\004\t\230\004\n\204\004"
+	.ascii	"\013\204\004\f\204\004\r\230\004\016\204\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\265\004"
+	.ascii	"rE\016\023\2407\035\377\377\377\343X\353MKo\177\377\013\322\244"
+	.ascii	"L\001\377\317C=\036\233\225\nb\270\242\360\r\006\256A\266\366"
+	.ascii	"\371\227T\222gu\242\316k\331\312\347)\267N\323n\346\021+ \200"
+	.ascii	"\002\031[\017\266\354\0068\256\b1/h\335\234C\366\016q\315\263"
+	.ascii	"\223X\241!\034.\034\013\214\210\233p{c\343\3443\002\326\024\341"
+	.ascii	"+\261Lf\324,\273\221\003\302\250\002\263\274B\324@\205\300- "
+	.ascii	"\032\3400P#ok11\260\320\251\254\t\tp8|\332\316\20557\004"
+	.text
+	.section	.gnu.lto_.lto.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.43.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\004\bb"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\304\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\f\201\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.45.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 ^u\002"
+	.string	"\264\003Q"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\036\005\001\006'\001\024\001"
+	.string	"\n\004\344'\001\350\007?\202\210\200\300\001\177}\302\001{\301\001y\300\001w\277\001u\276\001s\275\001q\274\001o\273\001"
+	.string	"\007"
+	.ascii	"6C\202\272\003\215\001\221\224\273/-a\240\b"
+	.text
+	.section	.gnu.lto_failsafeProcedureNames.46.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\231\n}\273\0012\206\b{\230\317\001y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_failsafeReset.47.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`e\002\265\017"
+	.string	"\306\233cE\360\220*\035\352|\t\345YiG\261,\2633\002\365ph\336F9\220\322:\306u\033\353\225\314\357z\333\037 \362\310\333\377f\363\306NM\316\270D\376\f\222#Vv\312\232\3742\257\227\206\304\304\022\262\211\224)\005G"
+	.string	"I"
+	.string	"U"
+	.string	"i\217Kw\232\216\231\3462\255\231\316\247/\300\333 \323\361\262\233a\346\306\312\"\f\b\333\007M\262g\234\305\262oQ\245\264n\273\033\252\207\223\236$\377#\376\241R(O\017\301\356:Q)\r\267\336v\001\333\006l\005\003\252\234F\031'\025\323\354~u\251\252\003Z\247\020\246\234\3615\365)9\\\362\022!\315.\206\017\237\304W\027\374\017\217\036\235\344Q\217\376I\367x\005P\203\211X\225r\306f\231R;\330\347vw\255+\266\2467\231\3762\255\311*\333\313m\b\207q}\265\330\315vOgG8\213\025`*\246\262m\324\226p\025)b\353\323\215\211k\364\323X\343\244bb\335S\215v\274:\365&\334\205\203\242\323\003(0\033\253\250v\347-O"
+	.ascii	"\226\335\375\360[~B\00442\322=r8P48\215w\t\356xx>\234\021\t\210"
+	.ascii	"\363\tM(\210\200H>a\005\020\247$\354\210F\241\007\001\207,xD"
+	.ascii	"\241I($\nAV\351\334\352J\002\016\262\222\232\354\203t\266\202"
+	.ascii	"\323@f^\215\026\322\331\013.\023\"\363R4\025\203\307`\265\331"
+	.ascii	"\255\301c\300H\315T\016\376\302\005\350\212\271=\370\253\205"
+	.ascii	"+&0  \003\0211\325\001SC?L\201\223{\367v\203\034\006\036\207"
+	.ascii	"Y\231\301\021\337>\354a\\}\330\303\270%\001\307\370\2724qh\266"
+	.ascii	"\370>H\315(X\006k\345\261e\314\022e;v\017\327\004\b\361pw\256"
+	.ascii	"`\225\312&3\0060N\177r\366vHF\270\032\007\200\030!\307\335\214"
+	.ascii	"\375\210\373\301\340d^\264\225\f"
+	.text
+	.section	.gnu.lto_failsafeInit.48.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\245\007"
+	.string	"\022\31647Po\322\001\240\020\"\217X\221h\300\0240\236@\227\255\254\221\274\004m"
+	.string	"4+\232Ey\314\277\035(\314FXX+df\234\215\354\373\366\017)\026\266\250F6\331;\245\346l:\330E=\331\205\315\017\303B\346\301\246Cv5L\316F\347f\300\332Cg\233\037M\333\246\246\356\253\215%\200\323\007L\313(R\330\247\226\rq\024%\311\250\254x\007Yv\304G@\001\246\335=\360C.\"\341w\\z\"\004\337]\372!\353\022\301\"\245\001\3622\202\237]E0n\330\2576\226\354*\241z.\002\337\356\305\027\263)\211\342a\373\032s6\313\253i\217:\251(\361vwF\216s\207\234\377\323\0132R:\222\3500\243\260\273\206\035\t\343\216\267M`\333\300\266I\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.49.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\362\31525`m\322\001@_\002\fC\\\214\226\200\037K\324~H\220\262\322\305\n\321,\352\275 ,\324\211\236\030o\255\220$!uHQ\310\223\"\304\363`kdo)S\n\336h8\025\345\351XT\025?\t\bV\247\212\013\026\245\0207\230'j0\276\0308X\374\\\027\026/\334\376\255\222\254\231\221B\330nxHf\331]\003\037\344\234\203\257q\350\007P^;\364A\323a*\300\307(;\233\023\245Z\330\177\253$\333\351\324J\311\004\323\355Jt)[\002K\033\266C\366\305\347xG\310\331\3432\266\200\n\222\b\021\224].f>0\035\276\013L\207\212\361\354\231\371\367\370;\241\030\3216\321\263r\260\273Nm\233\270\365\266\tl\027\330\276\b\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.50.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$G\213\307r\300\334R\337\360\263\264\363\207\251y\371\252\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352Lj\031\002\030\274\314\326\266F\210L\001k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^FJ\006L2G\247\225$\251D:~\320c>@"
+	.string	"\275\265\333\030\025\343\204\"D%\263\213P\243[\337v\353Q*\345\002\205#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.51.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"2\31506Pm\222\016d,\316\264h+"
+	.string	"\r\333\364\263\264\363\207l.\370\257\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352LjY\200\030\274\214\326\266F\210L\001g0\232\313\342l0\353\212\035\206\005lsE\007\314j\210\031\215\0231\002g\017\032-v\262L\213\227.\013IC\202\020\234\370!\n\262\001df\302\375h)\342r\264Z\302\363\312\265\272\236J\253\007\003J\241w\372\016\364`\306\227\312\314\034\222\376\367\203\026\024\223\001\221L\321)%K\252\221\216\377\363\227\017\020>o\3556D\3050Q\204\2302\273\b5\272\365m\267\036\245N.H\270\021\250\317\242\220\231?nT\321a\377\202\337\340\267\b\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.52.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375 \372\335\006"
+	.string	"\362L04`m3\006\260\2015\0379\0019\001H\301\217%\252=\224n\250\236t\207iMz\345\303N\234\350\305\274]\351\300\032\252i\261:o\244\260\341\313\222$R\246\024\305\254Kve0\332\225M\315\202\202\206\311f\203v1L\214\313LK\240\233\303\205\233\232m\343f\365\33514\211\\\305\304\023%jo\250\366\301\037\233"
+	.string	"\321\177\203\272\303\036\020u\206e#8\320\236e\315\241,\017>\244\n\016\024\017,\265_\007\306\213\326\323c\250\215\t\037\235\f\244\374\237\022\351$rD\243\255\253vm\211?\321\r\2622\0212\372?#\206;\303\256\366\206\001<P\307\320\202\360\277\320\003Q\270\321m\t\332\026\264\265\b\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeActivate.54.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`z\001-\016"
+	.string	"\366\231\\D"
+	.string	"\221(\035\317Z\252\"\232\317\375\237|K\232\217\365\262\177\204\372\030\366\303\243\341\235t\204ie\215\376\227eTTU\277!!\326\3375F2\377\254\001B5\302\344\336\b\\Ddh06B\310\336D\312\224\002D"
+	.string	"D"
+	.string	"K"
+	.ascii	"\351\247iL\323\232\351|\372\001B6\324\3148pb\027\345Uc]/&\204"
+	.ascii	"\355s\230d\3138K\265\031\013\312\311K\315\356F\365p\322\223\344"
+	.ascii	"\277\345[\227Rzf\013v\327\331\245p\270\365\266\r\330F`g\201Z"
+	.ascii	"r\236\203\366\310Mp%\022\250\300\370A\320\266p"
+	.string	"\022\240\016\325\356~\370._\205|\020\177\3160\312w\177\376\b\376)P\231I\215\240a\312\227\315:\245\262\330\307VWl,\275y\351\355\2455,\235=\r\037/FG\363\364\n5{A\2450}3\267\fT\305t\200\r\224\210S\276\234\252\372\223\033\206\360\024\021\264]\223\017\037\305[\022BDD\340_\352a>\254\004\244=\201\202\306\226\213\353\244%\003Hm\317\201v\307\223\357\234\255\026\227I\356xx>\234\021\t\307\371\304\222\n#\034\311'^\3408\240\330\021\215\242\007\001\2070xD\261$\024\022E\016\226\351\272\322\240\205\313\244'o\364\005H\207J\346\035\315\246\033\rP\323M\217Je\252\251\3020x\f\210\306\"\323t\321a\005\325v\360\025\017T\004  p\002!1\343\003\343\200QeF~\356<[\032q\035\3120<%]@%<\013lQ@\364\004s\023\310dQX\360*\344\234\321\326"
+	.ascii	"\254\303\216\006\306\255\341\354\032\255H\336\226m\002N\016\263"
+	.ascii	"r\320#\007\202\332s<\004\250t\213\326<\001"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.56.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"\"N35P\215\322\001$\241\252\013\201\336E\362(,\002\002\343\320\017\213\322*\237j\266!{\372h\240\005}\003i\177!3c\006\302\305}\bb\232\t\r\330\337[\312\224\002\266T.V\245a\256\312\212\231\005\205\013c\305\206\253b\210\226L\213\025\2121\207K\0263\030\226E\252\333\277U\221\252@G=\376\265\311U\365\225|L\036?\234C\013\330]\004\177\343%\b\237t\350\bM\236;\3645\223\303+\345\242\324\311\223\335qRG\366\337\252\310vZ3\375GM\204\024|\354\202N$\013\002M\031\26676e\203\203\215\267w\026\240\217<>\035#\273]\324\212o\317\315\277\306!\005I\204\013q\236"
+	.string	"\t\273\353\344B\022\267\336\366\200m\002\333\030\001\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.57.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"5\n"
+	.string	"\306SH> M5\035$\004\202#\200B\002\f7\3444\227\313\234\240\210\021n\311$\220\017V\r;\232n\300\200\210\001B\256\0370L@ \006\261\004\n\263?Wd\232\315\376\330\213\233\366\255;J\231R3"
+	.string	"3"
+	.string	"7"
+	.string	"\033\217\307\214K\254G\307-\254G\177v\211\207\246=\312\203\002\324\211\335\305\364\301\277\347\347\377\302!\340\350\363\274\004\354\256\023\0341\270\365\2665l\007\260\177\021\341'\325\201}\307\356\256\265d\377\364\307Lk\2463\323\277\"\022BLR\273\013V)V\025AD\210\330~\332\257p\013\337O\236!\273$\016\037v\303\211\003\033\016\232H\275\252\306\016\242\006\241\\\371\022q\317\212\232z\221\020Q\b\271\273\006\357\261\273"
+	.string	"|\f\317\320\361!<:\201'\017>\372\036\353\361\032I#P\234@\271\262\003\227M\3432\002\027M\266\351:\005\272N\205-\224\fS\3512Z\005\203q\016\030\3202\030L\243U\020`\026\256\303(\030\3366\031\207q\266\215\303\"\341\336\261Z\362\200\t*\220\206\254\232\362$\246\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.58.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\305\007"
+	.string	"\262N56P\213\323\001\200\340\310x\2533\022\017De\037s\003`l\310\236\371"
+	.string	"\324E5\333B\335\037K\036gp\344Y\0242\315p$C^\300\345\033\216%\013D\233\310\235R\266T.\330\305e\262\013\233\033\204\203,\203\315\204\354\322L\313\306\315J\2005\205\31367\232\266M\013\334+\310\300#\354\250\307?\246\262\263k`2$%\222I\344jk\016j"
+	.string	"\241\335%\360/\216\261\340O\\\232\343H\237S]J\216\257\324\211'S\321fh\210\377\256\224\r\213\320\243\236\rzQ#\354S\253 \373\321\257\254\016\020\ni\367\3414\262\241\374\240\260}\313\235\035r0\264\027\215\034D\246\335\235*\361\356\261\363_\361\311\367\361\036%\005\273\353\370} n\275m\001\333\003\266G\001\f"
+	.ascii	"3\001'~\306\232\271\013\266\333\224h\244bW\236\353\271\220\323"
+	.ascii	"\005\353/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.59.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"%\013"
+	.string	"\266TK?0M\225\016\b_\373\2727\310\370s\307\3468\310\362\247V\027-\333*&M1bf\2209?lg\324\365 \007C\n\373\312PU#a\rU\205\0273(\013\310\221DK\2641\356-eJ\0019"
+	.string	"5"
+	.string	":"
+	.string	"{U\211\007\252\024\273\233\351\204\177\0165?\376O\307\350<\320\341C\302\025r\264>\274\"\236\bJF\026\272\237\236\020<.\363B\300\356:;/\302\035o{\200\355\016\373\005\002\241\214\031\246\315\240A\276\273\002\340"
+	.string	"\202\305)\310\376@\251%\373p\225d?\035\237\206O\353\323\317\200\270FLD\354\216b+\226\025W\027l\037\342\217m\342\237)\242\204\331\326\276A\025\365$(\250^\241F\024\0160p\031\263\215\340\251\355\241AUc\365R\201\272\332\232\177\233\304\264\273\001|\3243,\360+<\232\343\211\276\307\3421v\350\\\001\256L,\027\n'\243Q.Y\347"
+	.string	"F\313\\\262\004\032E\223U6\234l\262\341M\201e\223u\266m\223A\276=\\%\0218\301\n)\007#i[0\371\316z\023\254\345A\265\024\025\252\201T\210\024"
+	.ascii	"3\241\265h`\254\267\272f/\320\346\201\3468\274\021\013\266\233"
+	.ascii	"\225\324\265\022\f\210\373\224\030\244bW\236\353\271\220c\r\266"
+	.ascii	"\274\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.60.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\006\001\335\013"
+	.string	"VVO>\020Q\225\016\304\303\260Rph\020\004\210P\315\375\037\311\315\\t\003\271D \022\220\035f\251\211%\315Z}g,U\022{\303 "
+	.string	"\n\nD5B\371y"
+	.string	"\331\032\t\256-Z#[\312\224\002:"
+	.string	":"
+	.string	"@"
+	.string	"\036l\177b\221\375\342\035j\257\342\250\240\222\261\273Q7\\t\250)\362!\026\311\306e\207\245+\205#A\002\273\373\021\317\013\234\226\t\261\354\256s\3432\334\326m#\260]\300\276\205\3719\2226\004P~\273\032Xux\232f\266\022>\302\303\2260!\2779W\034\036I3\273\313RO\366\341\252\311~\032>\255O\347\323\237PJ-\242\213]\f_\215\365\254\025\001\252\272\340\004\013R\322\260}=\005\n\250\337\340\220zU\2656(|\320\362\263\215\271j\023I\245\002"
+	.string	"\361\315 q\26537\261\t\200\332\335\003~\367\022\230\337\341\226\033t,\277\363\270\005;6\030\243\306T2\232\013\304\301.M\f1\330`\034Mt\200]\235\210\371\200be\200=\0172\237\030\362x>q\322\355\341\252)\201\006o\244\032\324\223/\017[\301W\027\001(\025\222\020)\0211F\371\345\356f\252'\030\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.61.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"E\n"
+	.string	"\026\323F=@\245*\035\240\327\355\212j\376z\367\236\236X\003\350@B\224@\347\235\022{\210\304=\222\264\277\032\266!t\323D\313Hf?\371\315e\030>\201\210K\205\265I\\\234&\327\321\366\336;\2455"
+	.string	"3"
+	.string	"5"
+	.string	")\223\332\356v\323\343\373\346w:\345\347\033\204\245\323J\306'MXq\030\340\302\023U"
+	.string	" K\335uy\021\242\244$\300\354\256%\030b\334\365\266\033l/\330\247\001,\232\306*\364\\\331R\232\326\273\306\032\201\313\200]\325\355\300\312\352\t\210\355\373\257\213\244\223xv\304Dv\227{\265I6\367z\316\237-\340ck\037\263\b\036Q\350\274\353\007\260\031\2146\013\200\2226_4\350%\243\312\3562\370\343a\024\376\307\253+D\362\340\253/\242\274\322y\361rD\025\262\361\022M\362f\217'9\003\326X6\234\f\310\323\311p\272\320\203C\307\303\351\":\031\210N\363\001u\026\004{\022\233O\027\362\274O\307\215&\360\030\323<\201\264@\332\336\204<\3509K\227\226\255\300\234,;\020"
+	.ascii	"2\003\303\341\306X\240j\224\207\001\202i\330\217|\016\017\225"
+	.ascii	"\036[\3432\016G\205\036T\210\227+\200\313\327T\32340\005\005"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.80.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"u\b"
+	.string	"\362\31787@\217\322\001\230\215\221\336\375^\236\013j\005\217\004"
+	.string	"\241Yd\344\226\361\355Q\277^\237\345f!\206\303\211\216\376]G\303%\262\032 `<|\317\246\230\365 {\313\235R\336h8\233\366u8m\233\037\206\005\256\263\315\006N\363\314\215\367M\r\201;\007\2167?]\347\315\3146|\\EY!\305UR\t\253j\3126\006\306{0\273{\2007Y`\244\3045\241$\377 \314\376.\002\032P\355\356\201\037r\026\204\277q\351\210\020\274\351\322\017a\227\227\216\025\017\225\022|AMY\343\343*\312\216\031\004\220\335\212W\313fH\022\016\373+\221\235e\227\377\260-\262\360\310F9K\265o\235P\264Xvw^\252\306GW\030G\376W\277\230N\244+\346tq\230y\004H\330]\007`\334\362\266\rl\027\3306\t\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.87.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`P\032\365o"
+	.string	"\272\256\024'M0\020\352\031\003Oe\0226_.\350\253\271\177*h\344\347\331\3530\225\357\240\233\007\305\345`^\245\3325!\231\026\352\004\355\006\363\306\260\224R\005\005 \020\344b6.?\362\240:,]8\255\351\352W\364\276\350\325\207\305^\271eJ)\005h\002,\002i\002J&ss\3775\rS}\345\016cnS}\375D\204\276r"
+	.ascii	"c\201\"\0200v\205\351\017\320\r\003\251\n\003\240\005r'i%\334"
+	.ascii	"Kx\251\247\002I\3571W\2715\022n\275\252\316\343<\001p\364\301"
+	.ascii	"MU1w\f\215\307\274d\024}e\244\0334\240 \241\257|\245\003Q\n\307"
+	.ascii	"\302mU\301-\327B\272H\303\320w\274\264\253\253;\202\201\322\b"
+	.ascii	"\035\035Ou\017\316\315\002%\221!C\254\224/\217\344\220\264\261"
+	.ascii	"B\004\224\215|AE\317\245\340\016\322.\270=\227\302gK\356\005"
+	.ascii	"\233\240\032\030\200\262\221>m\3236\222m\232\266\221@\330\371"
+	.ascii	"\244\242\343\2548\352|r;\316\312\007K\356\375r\276\311\301)\276"
+	.ascii	"\257\234Q#\371H\331\310e#\373\215\231UD\331e\236\322rjo\023i"
+	.ascii	"\361\024\242\370\276\257R#?\355\233\225k\016b\345\273-\"\304"
+	.ascii	"\223S\223\223iI)\t\351\310\250\210\b\304\220P\020\320\007\017"
+	.ascii	"?>=<;:9\03584qnljhfdb`\230/.\313\026\026e\262E\262\357P.w\013"
+	.ascii	"\030V\213\240\322!\250L\361\247\2560\261vb\223\\_l\355\027%d"
+	.ascii	"\241\030\013\361\272-*\305\233\234\311\021\270\252\223ii0\320"
+	.ascii	"\225\370\002=i\320\211#Ei\2136\361#\274=Ek\033\025\r\022)a}@"
+	.ascii	"\370E\367\226\370\320\265\205\330\230;viI\235\007%\243n\204\331"
+	.ascii	"5\220]\177`\223\230\300\260\266_\364\312\312L\007\347`p\017F"
+	.ascii	"\372\307\b\353\323\026\245s\037\226\034=z\222Q,#]!\334\"\317"
+	.ascii	"\016\220\270\326&\205<\034}\026\265\276\316`\347t\200k\3019\f"
+	.ascii	"v\023\307\255ov\260\271M\r\315[\317\340H\301e\332\2424\326<&"
+	.ascii	"\031\305\303z\004n\361,,G\303\250\2259\323/\252&\365\227\237"
+	.ascii	"\2630\262va\233\270\024\307\332/J\306\2720>i\350\266\350\230"
+	.ascii	"/\331\242\302\030\022\333/\252\203\265\371b\203\366]\377\264"
+	.ascii	"EQ\360\026\037l\026A&3\024\251\326hY\302\320\350\372,J#\251L"
+	.ascii	"F\235\205\211u\322\241`3\272}v9r\t\366\344r\226-\2222\201a\363"
+	.ascii	"d*e\t\306\345\317\004\333b}\336\367\355\273v/0-\367\231\206J"
+	.ascii	"F\275\357\313\235\245\330\f@3\263;\314|\002\363\r\215\354c^\243"
+	.ascii	"Nn\006\273X\3130+b\366\022\275`\207\301S\224\355V\3330\245\332"
+	.ascii	"\033UB\360\276\025\302\271y\224\231\247\354\260\361\300j)\263"
+	.ascii	"\1779\364%jUx\305\334\221\005w\341V\275\005\013\031\"\373\276"
+	.ascii	"\357\253l\221\355\330\314\262\335V\355\314{-\237:\236\327\326"
+	.ascii	";E\353H_\321-D\310\236W\226;E\313\364^\234\214\201\273Z\333G"
+	.ascii	"\343\235V\371}\327,\202s\336;m\362\225\316\225|\24451\237E)#"
+	.ascii	"\362\251\334\216\355\337A\006\261\016\377\004\277\223\370XXd"
+	.ascii	"\237\312\336\256\265m\277\r\347\242l9\343\233g\271V\345\373n"
+	.ascii	"\205`\177\035\313\005R\200\001\006\264\215l_)\212\016\f\353\333"
+	.ascii	"?\225\231\255Z\3447\307\036\347\004\267\234\221w\274\355\004"
+	.ascii	"Zf\005\030\360\206\"\377PN\261p\353\261\270{\247\375g\237\375"
+	.ascii	")\306\275\330\214\rp\347\340\007\"\210\240m\344\177\334\230\024"
+	.ascii	"\251U,\253)h\373\375\331\306'\236\226?r?\341\021\235H\201\362"
+	.ascii	"}\337\020\334\210]\245\002\356\034\027xC/h\033\331\337O\332["
+	.ascii	"\220\301Cj\215\313\362G\177*?\024\224\032c\"?\032\363\223S\223"
+	.ascii	"\223\251_h^j \315JL\347$\2463R\214\363Q"
+	.string	"\214\263\021\214s\021\323\231\210\351\f\202\351<\304t\026r\347 w\006b:\177`:{`:\3770\235}\230\316=\356\314\303t\336a:\353\3108\347\3008w\340\320\224q\306\201q\276Y:\3330\235k\230\3164m\327<\263t\226a:\3070\235ab\234\2311\316/0\316.L\347\345\213s\213\2133\313\322Y\271tN.\235\333&\322\214\\:\263K\347wgoqn\021\214\230\300H\337\367\353\361\312k\206\304\333\321v\335F\272\211t\277\320\r\304p\212\255\232\\/(\335+l3+\221\026\205\"\260U\263\315\254T#\205\036m%-\310V\354+\306\365RP\260U\313\251}A\251\035\201\013T\301\037Di\255\340b\353\334\266\344\214\272\206\206B\002\177\320\224S\013k\221\341\344\211\247\324H\226\013I\276x\325\370\242\350U:|\316\225\025Ot\323\252t\370\336k\243,\276\305\270,\177\024z*'\227"
+	.ascii	"q\370\027\374`\324\315\367B\352\346w\334\334\335\343Y\217\240"
+	.ascii	"\243n>\2077\001\007\224.)\316\367\036\263\003~x\325\b\023\370"
+	.ascii	"\276/\024\273\rnx\365\210\345ji\265\215\364&P\303\233\307\351"
+	.ascii	"=v\271\234\212\233F\350S\334\247\313\302\365r\275\332F\336|/"
+	.ascii	"i\007\022#\200\262* \020\r_`\335\207Gc\032\0260<\257?\016m\346"
+	.ascii	"\363\355y\365i\307vz/\367\363a\343\360\317\303\240 \340\317\215"
+	.ascii	"\264\032\215\202\306\273X\350\023\350V\221\240\300\310S\314\363"
+	.ascii	"k\035\274\030z\360\336\234\257\373\256%X\241\017\313\033\305"
+	.ascii	"x\370\361<\225\233\243\260\2741/\205\274\024v\376\270\257\370"
+	.ascii	"\261C_\026j<\372\330W\360\024%\237\327\274'\254\241P\330\204"
+	.ascii	"\2310\353\216.|\211kUb\363K$v\3258\235 |\205\317\234\264$n5H"
+	.ascii	"o\t\243\016\210.\f\255\303\021\032\020\031\315\304#\353\343\360"
+	.ascii	"T\031\334i\020\336\013\022!M\277~\3018\342\210p\345\333\356\213"
+	.ascii	"\030\356\f+}[rl\2017\037\344\221\351mr\265\231Q\003J\315S\331"
+	.ascii	"\256\356\0067D\026'B\254\320\340\270\321\271S\244\"\207\211n"
+	.ascii	"C\334*\222\220\227\027U\024y\256y\200W\314f\236\3125O\343\304"
+	.ascii	"\005w\252\fR\363!\242\320<\317\265\312|\301\205\03223\377\213"
+	.ascii	"\211O\016\377l\366\f[\304$\003\333\235\266\314.\r\267\272S8&"
+	.ascii	"\037R\024\275\254[p\253\325\245\fR\334\020\235dn\2317\224u\256"
+	.ascii	"e\356\206\204\020\246e\336\177\250 \363\004D\211sY\361\007\307"
+	.ascii	"D>\224\224\205\227\230gvmx\233;\035R\353\221\264\203\032\302"
+	.ascii	"\374\362c\276\t\330%e>\f\r\315y\355\3133\237\007\260\253\315"
+	.ascii	"\345_\276\237\216Y\376Hu67M\207\313w\2225#\034\256\016o\350\362"
+	.ascii	"\007\270\306\260am\211K\267\273\243m\371\366\033rf\327\207\373"
+	.ascii	"\303\033\332\362H_/\372\264\036\213\277\233`C\026\227\317f\377"
+	.ascii	"\210\3541\254o\350S,\304\242\013C+\322\362T\356\366F\376\346"
+	.ascii	"#7\220\264\300\342\324\364\314&\231\336\371^i\354j\310\0333L"
+	.ascii	"\331\321\3303%e\354f/\335+\202B\334\201\211&q\202\304\001%H\300"
+	.ascii	"\001\b&F0!UB\212\nF\003\251\017\250H Ax\240J\201\016J\2340A\302"
+	.ascii	"\210\031)\r\246\032\240\222\nAJ*\203\026\251\023$N\214\250\252"
+	.ascii	"\222*1E\025\202\024\025\223K$Im@\242\312\003\023$6P:\321\001"
+	.ascii	"\007&<\330@\t\004\023$>P*AU\245\224\264\303S!HQ)\235\230\232"
+	.ascii	"\242RZ"
+	.ascii	"vT\326k\211\220\300\227\232\\\361yC\273E\222\037}[3F\030\341"
+	.ascii	"B\260MM\277\364^\276\242\227\276]H\264\001\245\306H\345\351\251"
+	.ascii	"D\222p\271pz4\236\361\242{^\235L\355\3308^k\317\353\222C\333"
+	.ascii	"\225\332\021\251\035G\260`\362\274\0269\264\231%rz\337qh\317"
+	.ascii	"\260\260>\2579\315v\354\233\247\342\363Z\343P\007X\274\330\351"
+	.ascii	"|fr>/9\237\225\234\317H\316\347\242\247g\242\247\347\035\347"
+	.ascii	"s\216\363\271\351|\256q>\263,\316oR\2221<|r\370\367\203\231U"
+	.ascii	"\374\343\343\243\225\246\246V\337E\307'\337f\325\003\220O\021"
+	.ascii	"\361\305\0166>7\304\244\317\201\303\016j\210\364D\237\364I\300"
+	.ascii	".\351\321#\371\2166\372\243\337\001\354j+z#\352\257\271i\257"
+	.ascii	"V\364}]#\372'=+}Z7\232\251w\330\347\004\361Tw\032\364hC/\364"
+	.ascii	" \276\txfc\350;O\350\237\360\307\221\305B\2464\251[E\"{\211\201"
+	.ascii	"\304m\001\377\025\315|\365weC\\_\316\217)\340R\320w\"\007}/\232"
+	.ascii	"m\305\374`k\242\004\364\r\b\364@2\254\202M\252IO\345\017\357"
+	.ascii	"\301\311\fw\252\224\361\341\235<\274\216^\025)\007\225\263F\341"
+	.ascii	"\343h\372\302\255\366\250}X\336\020E\304\237g\276\202\362Qw\332"
+	.ascii	"\243\366\325\022B\r}\276\347\177\276)\304\205;U\266\360\371\276"
+	.ascii	"\366\274\b=\032"
+	.string	"\316(n\331\215\214\276\005\334\373\212\260e\276\242reC\215^\214\276-i\243\350\021],\304\362F\243\262\357z.BEDA\036\237\345N\037\013\006\221\220\347\\\030\n\026=\225_j \342\3717\234\023D\300\231\257\252\\\335\340\r\345y\002d\360\001\342\251\334w\335b\203\206\243\320w\212\226Y\017\316\177\332y\235\031\277\025l\034\3769i<\276Z\364Fw\252\274\262\363BQ\032O\347\033\257\225\2101\310-\026j=\326PN\202!\250\362 !\222\302\212!D2\"2\222$\351\262\n\020\210da\236\306\330\003\022`$5\213\204\214)\251\231\024\224\2242\354w2;\255He\247q\007\331@A\367\30757\301dCAm\342\\\370=\243\314j\211\260\337\212\244@\177\365\337\350\311A\267M=\304\264\274b\202\177\325S)\235\207\034\240\003\245a\304\021V\302I\n\356\310\266@\240\037\332\002_\377\343\342\315"
+	.ascii	"\036\247}O\215\357T\341NA\3024L\244Sa\332\203\356\356i2\035\364"
+	.ascii	"h\215\200Xf4K\\d\273I\313\243\274!%S\202\372\242Gf\360\224\020"
+	.ascii	"F\342\271\036$:\320\bn\b\222\232&!\004\327\213\222\206\330SS"
+	.ascii	"\321\335U%o\370\226\355\t\236\360\364\344G\022>\266\351\223\363"
+	.ascii	"\017\007\326\346piO\244\024\344\253\276\221w\t\320\370\376\310"
+	.ascii	"2\310~\371\001\300\217\332=\317\242&G(\016\361\027\371\036^\f"
+	.ascii	"\"s\333"
+	.string	".\"~\013N\266]\307\226\321\355\340\013\313a\321\020'6~\346\242')\223\206\t\213@\204\211\315\207`\032\354\f\317rx\306~\357\020\347\300%\016\"\"\264\37506_\376\207g\263uq[8\332f\352K1\\v\270!L\377\r\207\035\206}?\240[\273\300\013\272\323\316\214\336{0\266I\265\350X}V<&\226` q$v\237\027\036T\222\3770\032\033!\364]\005C-4\3104\373T\346\241\303u\341\261X\363z\002\323Gn\257\325\037\214\013\002{\250\216\343\270\256\303S\360mKn\276\203\003\311\034\007<\227x\376\346\307\005\320g\022[\244\207\235\304\246\334\311\247\004U-s\356f\371\214@a\bl$8\305' \305\207\357\231\200\213)\243\020$6\330U\361\b\0330O\224\341\3108Nu\346\337\315\3417=\r\001(\330\226\302\246\304\236\327\ba\222\344u\304\367i\311\372B\214\205\330AJ"
+	.string	"\332\355/\317\267&\""
+	.string	"\tj\3306\033\362\241C\013%\357\277;h\215f?\202\201\233z|P\314?$l\352v\301\007I]-\353\221ye\203B`L\317\254\335`;\253=1+\263\3048#Z\273\242\362\374"
+	.ascii	"\361\376K\374b\003%\363\364\375\356\305$\344\260\333\323\276"
+	.ascii	"\262\347\027,\004V{\203\347\316\364b\326\025\365\317\272\253"
+	.ascii	"\212Fh/c\354\374\207\204$+\205y,\345\273\204\0336\354\034\226"
+	.ascii	"\3565\370\005:\2552{W\352\235-\273\236\346d/P\242\r\355\037T"
+	.ascii	"\265H!5ibH\363\313Pl\005\246\254\216\310G\217\261`\372qg\261"
+	.ascii	"\024\343\205\f\334\277\005;\326^lK\tY\213d\2302\354'\274\016"
+	.ascii	"%R-\312t<\324J]\220\354\001\324\365\311\223\2619\017V\026\353"
+	.ascii	"\005\337\216+\265b\030\335\016\325}\020Ym=\343\307Qi\201\275"
+	.ascii	"\252\260\024cB\024c3\r\223\370\201\003\345\341}*\030\006f]\371"
+	.ascii	"9h\261\017dZ\217\210q\202\002\210\246\265\003e\262\377 \217\325"
+	.ascii	"\024v9\325\020\333Y\351\341\206\201 2t\304\214\021\360%bK<\016"
+	.ascii	"q\376\251\344\355\rd\326\251\200\276H\202 \250\272b\222\347J"
+	.ascii	"\004\"\030?\246Q\210\263?\262\261S\004\347\024\217\257\243C8"
+	.ascii	"\205b\\\334W\244\242\227R\324\302\360\341\325\364\277n\031E\035"
+	.ascii	"&\351d&u7h\020\370\006\b\350\247\371\305\244\270\n\020\361-J"
+	.ascii	"5\375\236\"\253\206\313U\262\031\263Y\223\202\233\307\026O\304"
+	.ascii	"\377\357q\024\356}\364\335\205\206e\256$c>\207#\261\372T\266"
+	.ascii	"b\217I~\266\3569\2008\213\006\036\034\245\227k\036\006F\030\253"
+	.ascii	"k\240\b\0211\364\323\027\343\320J\nC?q#\024\354\314\257\364B"
+	.ascii	"p\013\376\241\332\254\002\326\003N\317\332\275\257\373\255\037"
+	.ascii	"\325\351\200q`\037\237\345\020\372)\244\325\"\232\276\3161\220"
+	.ascii	"\035T\367\316\356E\214\272r+\240W\237\336q\230\216w\240\276i"
+	.ascii	"\035#\303\224\370\372\230\304C\2500Ri\305kt\003\022\211qh\004"
+	.ascii	"\247\373\330\330\334ey\020\027{;\277\331\345\022\016"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`U\003e\020"
+	.string	"VZdH\360\320&\035\270Z \275\322\270\344JF\2337\242\024\321\360\271\3635\332i\355\341!\306EN\317\207L\374@|\276u\352v7\263\223\003\333\201\313\221^\276\\a\212\247bt\016q\272\333\206\366\263\227\003U\303lKId\nN"
+	.string	"T"
+	.string	"Q"
+	.ascii	"\006\232A\201^`\322-\002\rS\322/$\355\242jV\252[\266n\252@5\313"
+	.ascii	"vz\320\310aD\356"
+	.string	",bKV#2\365i\250f\327y\"}\241\355\036$J\334_\275Y:\211\377\001\314\256\233;\177\3771@(\3179gH\307l\377yB\333\352\003)\350\377\304\364_$\350\363\300\364}^\372.\\\372-X\375\236\242\226\216\300\322\007u\316\371\247\212V\rAWR\342\277\341\025\203]p!P\211\277LLf&F\003\243yQpeX]\275\017*+\361\300*~\007\211\357&\245\037\240\264\203\223n\020k\001t\241x1\204)\336\032O\305[\363\331x\312\2323\031\222\327&T\325\215\331\016\t\357\353\323\017\235\234\031\307\373\n\225\32311d\342\205}*o|xH^\r\240\344\345\020\352\201B|?'\336\016\240\222\202j+Jx%\230v\325\223\337\231\007\257\240-Y\215\210A$)EZ\245\251\312j9\204v\300\232|\254~\034\357h\204w\024*\3538QC\362\222ptK1\003\307yA>\025"
+	.string	"\366\214\220\274!\235\362P\217\022\347-}\"\274%P%O\216\215\023/GC\341h"
+	.string	"\021(h\3478 "
+	.string	"\003!\"\306\006\"$\030IR}\017\202M2\\\032)\032K\267Z\177\324\321\302\320\033\332\372\241\tX`\036\303>\336&\031\271\233\f\253I\220"
+	.ascii	"\t \001\222 \235\240K\002\222\216\300d\344\007\364\030-\265$"
+	.ascii	"\202\221\371]\214Y\326\306y\007W\027}\356\347~\356\347~\356\347"
+	.ascii	"~\356\347~.\357\226V~>\202\030\203#\005\226\272\bPZ\334+\320"
+	.ascii	"\020RH\326\227\001"
+	.text
+	.section	.gnu.lto_.refs.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\005\007"
+	.string	"\002\017'*pM2\034\037\034\013\251p\257B\247\252\252\252\252\252XUU}\026\347\220\260Kt\305\211\2615\332o\244\265\326\b\331{\313\224\002\016\254`\033AR\312\252\336(\327\232V\223LGS\235\231c\240\213\226+S\340\rx7\257\346\215\006x1/\364\316\373\244@zbRB2uD$\004\344\303\243c\225c\343Uc5\003c\352\305\263Z8J\361N\274\022\323\210\027\342}x\035\336\206\227aUx\023^\204\351\301k0\215\226>\323\264\364U\013i3\357e\265\274k\272\367\327\321+\002\034"
+	.string	"f\b\236ZA\300\371\026\323Q5\275#\003\340"
+	.ascii	" \020\034K\2658\330\235\276-8\266\305\236\206~e:Q\366\214Z\006"
+	.ascii	"\026\202\225\226=\260L\346\n\312\336\226-(\353G\313\036C-@\257"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_.decls.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"(\265/\375`\226-\375\302"
+	.string	"\n-qBZ0\212II\215\001*\316\255f!\216\357\227o\273\362\214\316A\234w\030\372\276r\300\207\031\310\007\027#\334\315\2739h\272\374Kkm\263\217v\020Z\260\326|\257\3332-\203\203\303\340\tJ)Q\022\252\372\367\242\025U\341\226tw\341\256\023@/\336\265\360pi\225l&\245\224)\201\003\023\004H\004ww\320d\003\225\223\255\344\201\\\223\177\350g)\375\354B\037\337\351c)\272\007M\227\300B4\007v'\275\312[d\241\"\356\362\352"
+	.ascii	"\003\005\363\241oE\2448/\317\212H\217\237\264\005c\303X(\b\233"
+	.ascii	"\207\223Dv\327\2060@\302\340\335|\314\244oA\2446\317\202H\177"
+	.ascii	"\361\364\321n\275\200\270y6\035\345\350b\026\003\346$\210\362"
+	.ascii	"\3469\re\346\374\352Z\203\301\331\004+Z\304\"1\203\023\342\363"
+	.ascii	"\304&9\002\266#\n\205\315~\341\247\263gDJGt\357\347\026\233\305"
+	.ascii	"V\261Wl\324\312Y;\213\305r\261u\226\316Z\261Z,\324\316Y*\267"
+	.ascii	"q\266\206\347\347\336K\265\255\256\031\200\3309\373f\247\330"
+	.ascii	"(\237;\251'\365\302\276\r+\263hxH\222&\223\352\212\3728\301\331"
+	.ascii	"K\251+\247\222\337.ab\223\330,\237[\251\007\026\304F\371}\376"
+	.ascii	"\0134\260s\266\315~\331$\237\033)\225\262j\362r\f~K\344v\316"
+	.ascii	"\246\331"
+	.string	"$xH\322^J\271\215\220\302\306$\311\335\336O\nx(\210\231\272;\253\372\220\257\005C\264\205\2634X\250\007+\345\326\315Fy\214\362\271\237{\357\033;WU\244t\363/\020\275\201\275\255\207\324\346\345Y\017\351o\226\276\267\003\032\247\251y\354N\372k\244o\271\350[7}[\246o\271\364-\224\276\205\241q\332\354N\332ce\220Y>od\246\320\335\020\273\371V\251\377cf\317H\310\322\3327\277\002f%X\262\rHkL.7\277\003m\215\330#\026j\307~\013f\303\236\2114w\330\336\317\rX\331\004\345\354\346[\261C\020\26558\007}\333\223\336\330\236\364Z\207\260;i\266:i\b\253\223r\331.\373\205\231F\315-\266\3673\247\307\305DJ\354f\373u\255\227}\336~Y!\277@\203\327,w\327\336O\373\225\367VZ;\201\215\265\023\304,\201A\t\226\346_\375\247\335I\265\325I\377["
+	.string	"\t\330)\024\026\370m\215\033\002S\347\277\034\"`\003\302\377\2746\236\233\363\277\354\377\207\013\201\377\236\370\257\211\377\016\200\311\204\037\037\200&\3514?\236\200\311\3533?\026A7\263\200?\360c\341o]\334\016\220\002p\3455?VE\274\367\343\337\241\026\270\367*\340\277)\007s7\001\377y\016\342\3079V(\374\237\253\242"
+	.string	"\225\b\351\217#\360\277J\226\353\037\233\370_\207\245\206\377V\376k\371\037\375\277\345\377\225\377v7\203\377t\027\203{\301\r\360\377\204\177\370q\003~\373\374\257\317\177K\374\327\202\377V\360?\346\307:\277\315\371-\316o\037\370m\207\337\002\340\267;\277\345\371m\332\177\231\037O\375\226\356\267]~{\367[\273\337\326\375\226\313o\361n\317o\335~;\367[\271+\342\377\315\217\273\374\327"
+	.ascii	"\377\r\300\177A\3747\202\377z\370o\207\377\356\374\367\346\277"
+	.ascii	"4\377\355\375\027\3776\314o\277\374v\310oe\374\326\307o\221~"
+	.ascii	"\233\365[\347ow\374\326\352\267U\277\245\372\255\324o\233\277"
+	.ascii	"u\341\267O\277m\341\267M\277e\372m\322o\215~\373\342\267\314"
+	.ascii	"\337\016\375'\373\177\366\337\353\277\224\337\026\3756\371[\016"
+	.ascii	"\3746\003\277]\361_\206\337\252\370\255\361\267 ~\373\341\267"
+	.ascii	"\021\374\026\202\337z\370\337\345\377\335\177.\377\237\377\025"
+	.ascii	"\360\177\355\277N^^^\336\037\023\367\313\304\375\022h\005\025"
+	.ascii	"\304HMa\345\270\031\327\270i\2622E\367\324\257q6Aq\323\335\226"
+	.ascii	"\310F\232a!\371\206v\267\267Z\0057vZ7t\334\374\232\345\022fZ"
+	.ascii	"\222!\003g\027Q1r\342\036\315\027vQ}\232%1pR\f\314L\367\266\317"
+	.ascii	"&R\022\022\022f\352$\017\024('\247\236\364\307\222]\023\020}"
+	.ascii	"\232&\243[(6\302\312\024\266\256R\304\214\356$\247\nd\240\234"
+	.ascii	"\300\260\270\3714\373\305-\024\277\300\313\020\236;i\203\344"
+	.ascii	"\246\245v\267\223v\005\237\231\323\307,p\213c\027P\354\0023\365"
+	.ascii	"\336\233\002rZj[\333)\251\0073\237\245f\177\210y\363q5\006\246"
+	.ascii	"\377\373\247[\231\264\367^\212y\356\244\242\232\333\030k{\376"
+	.ascii	"\r\026[\001\374\317\033\377\267@\003{+\251T\325\351\036gJ\033"
+	.ascii	"\017\261\377\266\275\227Q\311\007D)-\243h0\303\242vry\225\314"
+	.ascii	"I\332QIf\330\3369{\271L~\320\3349\314\260\255\264Y\274)\331\375"
+	.ascii	"\214J\356es\347\354\345V\206`.\243\224\230aJ\245\034fX\224\322"
+	.ascii	"\016\213\3328{\251Lba\271\223rvX\224\334\016k*\3410\303\232J"
+	.ascii	"\314\260\250\035v\214\205\036ZKS\252\246\310\254\033s\271c\034"
+	.ascii	"=)\223p\332\230\317\346\216\333\333\212\265\330I\002\330\373"
+	.ascii	"\251\231\024\247\244a\321\212\332b\024!Q6\255\207\243\"\251\346"
+	.ascii	"^\2661}4\367\366Q\024\264\2172H>\333\366\013\266-\231\343i\033"
+	.ascii	"\265\330\033\202\243\275\223v\267\355\275\223{\357^\322\323s"
+	.ascii	"\357\026p\230\316\243\243\275\235x\216\366S2\255\305\336W\254"
+	.ascii	"\n\232\0223L\252\351\223f$\314\271]<\223\326\271\343\242\222"
+	.ascii	"tXr\3106\332{[:\355T\2221w3.\232\311\312Z\272\335\374\231\030"
+	.ascii	"\032'yh\252p\331\262\301\35007O\246\331\002\230rK\030\274\373"
+	.ascii	"E\303u\231Zk\303\273]j\216\232\034\221r\363e\314\356\035\027"
+	.ascii	";\373l\002\001s\363\257\335\177\353\356\026;\3056\367^Z\026Y"
+	.ascii	"\216\274\334|\233v'%\200\325I\357\234\317/\235\215\022\220\""
+	.ascii	"c7\347\310\365\226|\371\322\025\005\013K\217\032\234Kn\333\245"
+	.ascii	"\341Z\271hw\312\255r\257\334\270\233\344Fo\332Ur\265\\\270\213"
+	.ascii	"\3452\271T\356\fW\312ur\335.\333\255\341\256\335&W\355F\271o"
+	.ascii	"\367\311\225\341B\261\320\233\345\226\375\232\335\263_\274\037"
+	.ascii	"Q^T\3359\211\344\370\302\354@\027!\277\217\327Y\330\013\027\206"
+	.ascii	"--\321\256\030\356\206\342\244\272\333K\024\310Z4\n\314\022\037"
+	.ascii	"q>F\3064\340j\002uw\230\333\374}\212\3340\262.5g\226\013\275"
+	.ascii	"Hr|9\257\324\021\250\363+\310\363\367\031R\346$r\303\2200\267"
+	.ascii	"\236Hi\261\021\301\221\307#\313\n\224\253,N\0371\261h\226\353"
+	.ascii	"\274\222\345N\365\260x\350\250\343\241@\206\310\025\215/\017"
+	.ascii	"\362\215\332\235t\004\226\376E\262/\260;\364z\344\305\230\273"
+	.ascii	"\371\216\371\374\222\351\244IN\317-&A\331\222\264\233{2/\350"
+	.ascii	"\313\320\320\227a\241\257\275\350\353&\027,7A\231\272\272\371"
+	.ascii	":M_o\351k*\3758\375B\277\007F\377\2567\247\337\233\242\337k\323"
+	.ascii	"\357\315\240\3373\323\357y\351\367\250\364{1\364S<\375\364M?"
+	.ascii	"e\242\037M\307\364\323 \372i\016}\255\256\016\013\345\271;\336"
+	.ascii	"\212b<\335\374\364\206\346\300\316\263<\351S%\375\230<\375\030"
+	.ascii	")\3721F\364c\256\364c\232\364\305\272\350\3476}\265lD\377\327"
+	.ascii	"\005\021z\231\204\254\353\336\030{\362\320\213!\r\007\225\215"
+	.ascii	"\236\r]\246\024m\335\026\356\2144\311\213\026Wn>\0061\220\274"
+	.ascii	"\2700\316\234FfQ\216\312\242{_\246\273t\225\256\214\353ti"
+	.ascii	"\334\246[\303B\357\214\213\364\233d\225\374\342\331/w\333\340"
+	.ascii	"\275]Xs2Y\270\333\26691 \210\332\235q\223\227\205m\253z@\227"
+	.ascii	"\223\350mqg\\\027\001\317N\213\227\346a\325\031\335<cu\322|\345"
+	.ascii	"\363\214\265d\032\273\272Y&\303\220wP1\362\004z\363\363\216?"
+	.ascii	"\353\270/j\314\240\024\241\2729\306\352\244\026\314\347\331*"
+	.ascii	"\347\260C\312zA9\004m\f\254J\006\032\263\255\250\335\315PP\231"
+	.ascii	"\n\2102H\323m\201\216\315j\352\231j&L\0139\262\234\243D\025\035"
+	.ascii	"W7g\251K\003F\326\222]\216\322\202\003\307\332\322U\326\235\035"
+	.ascii	"R\245\305L\355\306\r\314\344ib-oZL[{CI\343\342\262a#\031\243"
+	.ascii	"\265\224V\344\346?\360B\215\032\230\212\2132\013\355\316\215"
+	.ascii	"\013\221\032w4hd\027<\315\244\\\317\227\333\033Z\357\354\206"
+	.ascii	"\363h\212\222R\236\301\323L\316\3654y\273\312\222a\302f\364\302"
+	.ascii	"\f\246\031\033N$\\7g\0315yT\340\276\266\362RN\363\350(#q\370"
+	.ascii	"\"b\365d\003G\365\002F\216\361\214tS\364cG\031\336\033\266\260"
+	.ascii	"H\251Q\307\002\013\031\006O\017\245'fq\371\3053\f\233\347V\344"
+	.ascii	"\t\230\036Q,\350\332X\260\310.\034\220\366\206\266\305\205\211"
+	.ascii	"\325\214\334\342\331\305eq\255\226\234\265]/5V\242`\274\235\351"
+	.ascii	"\347\235\213R\250RJ\255'w\300\213\220*\271(+\273\324h\202\271"
+	.ascii	"9'\203SG\224\350\320\307\311\021&\fV\362\340\354-u\207\246\357"
+	.ascii	"\316\2108%)9\206b\241X\t\376\342S\264\225A,\340\221\224\211r"
+	.ascii	"\231\213\336\214\367\274H\350\344p\212\364mW\033~\263\022\205"
+	.ascii	"\303n]U\242Sp\234V\224(\r\330\315&\231\263w\016\\\207\275\340"
+	.ascii	".\230\013\336\202\357,\024\333\341\032\216\331p\024l\207\245"
+	.ascii	"\304\331\341*x\316\2669\341\354\245\331\314\213\250\266\0336"
+	.ascii	"\271\355X>\0241C\360\302\"\207\351,\024\317\235\347\271\361\034"
+	.ascii	"\266\202\243\266\315\351\271\227h\312\334\362\274<P\260a\216"
+	.ascii	"\2068\033iT\213\r\222g\007\350n\306YzN4\326X\300]\261P\214Eo"
+	.ascii	"\331J\303;\026\232\031\254\244\332\364o\234\350\337\224iLEK\211"
+	.ascii	"\336`;\242\177\003\246\177\343\245\177\243\245\177\303\343\r"
+	.ascii	"\273\2059\251cs\273pP\214\212`\320\267\307\t~r\023\004\215\212"
+	.ascii	"lm\004\253(d7\347&w\r\313y\244f\023w\005\0352C\fY^]\215\2331"
+	.ascii	"\023\335\342\006\207\210\231\033f8l\334|\314\344\307a\367\211"
+	.ascii	"\201<0\\n\276I>\307Kh\330\230D\277n\376\215\013\260\34340,C\217"
+	.ascii	"\323\226\021\202\007\024\034\323\211\323\315O\215%\027\303\351"
+	.ascii	"f\\\206\3170\332/#\223\304\b\356)O\037\233\315T\275\301\360\343"
+	.ascii	"\346k\277$\305d\307H~\231^W\322\022\352E\037C\361\330/\203\301"
+	.ascii	"<I\302\202\030\007\254@\001\271\031\037\321-l\340D\310T!\202"
+	.ascii	"\005\037\371\261\221\313\003w]`\357\3455\262\341\244\345f\033"
+	.ascii	"\253\223\3420\237\343"
+	.string	"\"\027Klm\355\346\r6a\372\026\210\305Z\026\212\265\360\220\030\346Vf\225\350\221\366TA^\366 \253{\246cb.\214<i\234\230e^7\037\177\375v\t\216\001{\3254\367F\222\233P&0\330\013\013\341b\242\332\361\354\222I\303\3731\343f\034\004s\035wa \270+\203\346\336J\334u\363eo\345\215\265\023X;A\016\"\2055\226\346\333|\351\013|\216\267\322-%P]n\266\333\246\312\207\017<\247\023\254)7\337&FV\226\224'\316\036\327\033\227\025\336\325\025v\0269\213:\275\200\203\016c\035;3\334\327\224\270\233\277\305&I\331\220\276x\241\242w\354\300T!ph2C\266\344\254\241\314\312\n3m\003\300\300DS'\023,\313\037UU\230*\204\355\200\244\226\332V/\r\311\225/9\364\324\024\246\n\201\203\020\036\251\222\273\272<\252/\031\036=\244\214\220\242\036\205\245d\234vr\216"
+	.string	"\\1P7\232X7KY4\375\204\355\t\333\315\337\220l6\341\314\23445\336\274\232\324\271\340\002O\fI-\265;\030\230^\224My\202\342\247k\027\342\207\334\024%\033\264d\250\021E\346t\013\305N\270\205\236\346^\262\200\007\224S\310!#\021\305\211\025C\243\321\304\n\305\021Vx0\201\337\tU\305/\004\002\330<h\004\211\242\260\203\352\253YU\243\252\246\220\256E\020\216G\024\216B"
+	.string	"\254E \t\340\216\320\232\006\205F\022<j\320\361\267\002;\004s\206\305\025I,\002}8\307\241\023\206\200\303\037\260\303\203F\034\201\036 P\001\024'\2340\341\203\300\007$\210\340;\221\302g\002\212\234\240\t\244z$\016\351\020U\234\007\215 q\\U\025\3025\b\001\322w\024A\037\205\303\241P(]a,\236@\032I"
+	.string	"\031\201\304!\020\220\352\221\206\370sc\216\276\032\244\217\bd\214!\002\031\261\212\001\3411\037\217\352\032\f\376z+\214E`^\221F\374\r+V\344Q\b\244\246\360\005U\"\220p\370\353\005\325\343P\006\252\307\336\177\310_\320\007d\034a34\n\251'"
+	.string	"\031%X\177A\300|T\205~#\224"
+	.string	""
+	.string	"Uh\350\250\246\b\022U\343q\310\004\242\024D\022Rx@\256?\244\t\352\021\205\bG\024H!\021EM\n\242\025\270\246\310\233\007\215"
+	.string	"\372T!!\2228\264\222"
+	.string	"\006\200F\007\371\013\032Q\200\240\304\b\344\3723\216\250"
+	.ascii	"\221\004\001\b\251\310\343\n\0236\034x\240pU\211*\220~\006\033"
+	.ascii	" `\003\016\210z\347\240\203\022\035\224H\317A\007>>\035l\340"
+	.ascii	"\243\277\201\017F\372\202(\210\212)\364\206)\374\216\302\017"
+	.ascii	"\200\210B\241\365\307A\365\035\201~C\020r\0364\202h%\001d\324"
+	.ascii	"!Zg\214?!\340\032\263\252A\241\212\342j\f\252D\353\360'\\\325"
+	.ascii	"c\016\221:4\016}\3603\374\005\315\250A\341\352#\nC }=\240\337"
+	.ascii	"\tE\241\017hhh\344\311\t\022\205)\370\220\277\243OhhE\252\240"
+	.ascii	"\032\217\021\324\250\303\037p\006\271\252*\210B\340\032\024\n"
+	.ascii	"\305\020\205BZ\005\240\032\004$\372\t\351\233\343\211\341O\005"
+	.ascii	"\261(D\376\206E\343\252\"\211(\200k\207\243\252\256@\352\007"
+	.ascii	"\352\020\210hB\350wB\205\361\347\201\023T\344\317\204\032,\212"
+	.ascii	"\260\n\177<D!P=\016\371T\"\361\027\004\364\021\r\375|D?\241\233"
+	.ascii	"\343Z\\Wu'E\252\307\237\237\"M\216\207\237\237\"r\b(\301QH\364"
+	.ascii	"\363\001\r\245\240\006\221CF\242\260\203j\\\201\364\375T\bW5"
+	.ascii	"\370a-\"\201\277\037_\0219\364\363\001\021\205A\310bQ\350\350"
+	.ascii	"\003\256<F\337\217q\350S\205~\353\217\017\270\036}\302\343q\365"
+	.ascii	"p\364\001\t\177\210\305\02389+\024\207\276\bl~~\212j\260(\344"
+	.ascii	"\013\002\"\205+\0349\250\353PP\005\026W\243\357\001\275\3427"
+	.ascii	"T\203\276\265\003\322\307A/8,\006\035\3255\b\351S\001(D\036}"
+	.ascii	"<\017\002\361\242Q]I \213\305\225\004\315\321\207\364m\340\203"
+	.ascii	"$\n{G$QU\241\246@D\341ZD\n\211E\241\031U\205\020\t\374\245\352"
+	.ascii	":\264\256XU\025E\240\232b\345\220bg(\374\201\020\024\016\177"
+	.ascii	"*tV(N@\035\"\221\3055\b\231\2034\021T\203\216B\242\020\004\325"
+	.ascii	"\203\340p\250\030d\002\020Q\030$\376\206\036v\220\276\0130@\022"
+	.ascii	"\205C\032\251\036\325\265\204`Q\270\252%\374\220"
+	.string	"\277\017\210R"
+	.string	"\021\205*\204*P]#P}%\334\250\307_\2201F\365\245\330\271\217\317\211\020(\214\020\001\r\034\241\376\374\216C\341\357\207\0042\bH8\374!A\024\376\204H"
+	.string	"\327#\211\021\037T\344\017i\202\nD\341\004\210V\232a\261\350\201/\206\214j\306H\fV\304\3060\225\007sFS\320\026t\01607\340\304f\324l-^KG\220\344\202\330\355\270\271H\021\314\314`\t\217\263\f\226\3010\225\335Ir%\322\240\264\324\356t\254\262\220,$\017\221I\3164\26191\365\f\311O9\034L[\236_,dP\321\201\223\217\2211\004\252\312\315^\027\tG\227+\\7_\307\206\376sW\206aC\326b\254\216\01333\264F\225T\220\"\274v\366#\006 \331E\323\215\266\0317g\255\034\303\363\326\363\326\315[8//\025B\303\2214?\2374h.@\231|\340e>+3\"vs\r\022\222\216f\026\017\026IO2\217\007\203\337\250\262\t1\311i\245\314\314\210\214\214$I\322\001\222\n\020\204\243i\230\346X\017\022"
+	.string	"\004A\224B\246\214\b\211\210\210\202\224$\251d\331\r\005\021\020\203O\022\316\217\370k\bj\304\226\357H\331\376D\004\270^\300\243E1\210y\237\226.\2420\234\361z\307\354\214rO/\332\306\260\247\3742\332\\\032"
+	.string	"\335\215\241\0068s\302e\344_\\,\223\310\256*\256\223s\374J\310\022\243\2530O/\221\252eE\fW\261\t\3272\215\367,\344?\032p\313\030\315\"\315\031\2365\317\013\252e\351\267}\310\223L1\324\002\217\362\r\354\204\250\272\240\357\235+\035\320r\362\225\214\340\026\330\336\323\226\220\372\013\223W\307\302\177\"\341\242\221\214D_\337"
+	.string	"ON\232\211\255\311\221\354f\211$s`]}\b#\305EN\356D\213k}\267\274\223Z\362\246\207\225\307)?\264N\234\360\277\331\033\373\257K\r\375\023\fz8T\273\027[\352\233\326l\376\332Y\201y\320D\2315\235q\272kA\227\2248\032\f\260E\375Y\227\223\001\234\320\025\350\201\252e~$\360'\307\274ea\030,0y\307\030\35333\241\212\0055\2263\310XXvoBTo\375\230\247\303\017Y\232C\222\304\333\023\3553\026n\020\027\001{i\003\333\355\2014 \b\352\271c\002\006\310\371J{(\213\"(\354\323E\236N\003\037"
+	.ascii	"\233\233zVj\016\271\255\255\272m\022\201\r\264\235\316(kv\235"
+	.ascii	"\237\214\327\322\365\367\307\322\257\370\261\016c\357\035\300"
+	.ascii	"\311%P/\255\343\227sL_\215\232p\367\n\314\367\363\276L\202|\376"
+	.ascii	"\363q\307\304=\357>(4k\261\227:\022[>e%\304\232P\220\251\216"
+	.ascii	"\303@8\241\312~\213\273\263D\336\325\177\220\325n\304o\322,\346"
+	.ascii	"\032-\300\032\256\201,\326\340\376\344\211\035\255jq\263\313"
+	.ascii	"G\333L\235N\2665\005\265\353 q\327\213\262\363\256~^)\273Lp\333"
+	.ascii	"\230\226\006.\354s\303\371?p\354M\375\001f\376\257?\277\336y"
+	.ascii	"m\266\365\256T="
+	.string	"\0138E\375\263\240I\025\211\375/\223\202\235J2f\230\301\346E\346>\262\266P\303\247\340\373\2032`A7\331l\252G<x<is\256\262j\372\336\354J\023\214\322Y\304;+s&k\300xr \351\002\203\242$E=\b\r\b\257\001\344\266\001\261\230#(#\367>u)\027\270\217\265\016\034\177\177)ai\013\334\2008\030\f\230<\327J\307\252\267\243P\327\221\b12<uM\253\243\213\260\276\306\027\366\314\320\222\303`p3:kN\023\353\002A\340\372\t\251\b\360\333\021\347\274\201\250\274\030=\245\344V\310YZ\2726\333\320+\272\305\337\225\340s}\350\376>I:LP(\n\nt*\240\202<\036\270\206y\272\204m\033k\346\255\325\0061B\317\2058\267\340EVpv\265(D\202\331Q;~\207\327\351\340;\353\032q\316]\324&\nZX}\332\374g\016\263_ \360\366\341\313^\254\341\026"
+	.string	"S!\234\264S\264*\203\352\207\237\0337\367,4\351\267\220\324/a\346\017#\315\024\236\004\024a9\313g\026\341\315\367O\351\327:\255K.A\244\001\353\031\331=\bP\354]>1\203\313\221\026jF\257G\026+y\033\324\234G[\302\243`\276()0N7M\225n\177p\353\241\1773)\276\336\2078\365\303\372\017\352^\222\242\242R9"
+	.string	"\231\276C\026\n\371{8MT\020\341\2348"
+	.string	"W\302\213\333;\213K\275\251e\3563\244\213\361D\007\216a\0049\036O\004\275\260\371\020\307Y\340\246\347\347\224z\375.K\356\274\3363\301\346\357\215\327\217\005\210\344%\313UM\344\364\223_\204r\347\356\277\314\277\215\356u\016\305\326\005G\032_\316>\323B\340\253\243C"
+	.string	"8\312\233/\246^\247Vd\341c\325\260\3131\324\376v\331\247\321\256\273bw\224\342\353;\275 \210\375\270\324\013=\334\237\333Vg\307\332Y\222\r#3Z\370\326"
+	.ascii	"c\346\2449\034\361H\226\272\325\353vM\257\216\373\316T\311\244"
+	.ascii	"l\363?Nc0\267E\265\007\204\301\252\241k,9y]Jc\231\215:\365R\201"
+	.ascii	"j\227\225\377B\344\356F\n\270\255\b\2603.8\315\020>dE\377VX\005"
+	.ascii	"\rk\342\3456\020\332n\206\222\201\020s\370\237Ws\037\227\002"
+	.ascii	"G\026\266\001o\333i\377v\337\263\345\370\323\022fo\337J'\n\207"
+	.ascii	"\026n\223\322\202\347\246\221\364g\371\003\275{N\251-\261B\363"
+	.ascii	"\\\331\23681INvn;\034\345H$f\236*bE\\\204\372\361\003-\354\346"
+	.ascii	"+B-iX5,\226\r\312\234\257\332\263(#\212\304^\237\307xARn0\t\213"
+	.ascii	"N\241O\310zY\374\267x-e\256\\\311X\360\223\303F\350\rd\035\231"
+	.ascii	"\354z5\357\037$\301\3011\253[/JL\277\201q\034\t\222\037@\240"
+	.ascii	"\301\224\371nu\370Q\314\nB&c\236T\265Czb\332\026\033\346\355"
+	.ascii	"Z\307\334\020\344Yf\206-\214^!E<\240f\024\237\312\254mJ\214\313"
+	.ascii	"\334\252\202\254\256\224\222\273\325a\231\323\n\306\376e_\272"
+	.ascii	"\357\366[+\020\207\215\224X\020\036\371\345\253\345\245\326\342"
+	.ascii	"Q\217\340C?*f\026B\262\266&h\340v\324I\222\313M\034K\b\341\311"
+	.ascii	"\323\025\277\244pD\310/\321\024\224\nt\034\312i\372\302\272."
+	.ascii	"\316\346\310@'\r\034\356\033\241\256B:\3118\001=\206\336\360"
+	.ascii	"Qe\352\007\324\216\bL-\301\226\250\227\"&\235\231*\270\213RG"
+	.ascii	"C6fE\273\371r\255/V:p12\n\274\271\360(\030+\243\376\022\177\367"
+	.ascii	"M\375/\321\264}\366\023\247\204f\235.\274A\005>\347}\217\336"
+	.ascii	"\274'\256;O@4\355\025c\363f\266\227)\206\303\350\037\"\305\315"
+	.ascii	"'Tk\303\260\"N>oj+\351\255E\023\027\n$\301\242w\275\327\306\355"
+	.ascii	"\223\365Q\353\226,\025\220X\005\217\nE\005k\250\2437\020\023"
+	.ascii	"\263\363\217\025/\212RE\237e=\b\330\265\225\264\354Z\2325\203"
+	.ascii	"\204\315\2565;a\024,)\345\264B_$\0078P\2131\310~\"\376U<\003"
+	.ascii	"S\215\207Z\223t\020\344\252\302\262K\230Q[,*\004\371\026\023"
+	.ascii	"\346\335\233\002\r\267%\220\277)\261W\310\034\346\353\241I\261"
+	.ascii	"\210J\215;F\212\246R\033`1U\n\302\3500\332{>>\224?q\257\303\233"
+	.ascii	"\017{\216\325\261|{\215\371O\3313~'I~\272\270\321\276\261\f\364"
+	.ascii	"\220\344\013\314S\376"
+	.string	"\274K\242\305\030\372\002\365\341\212\345\363\003p\2177\325P\35118\367\300\323\330\274\036\321#\276\227\341\277C\256C8\272\0175\352L}\207\217\026|^\227G\f\214\374\222\212\342y\371r\001\374\350\210\365\375\037~7\031\020v\367qN\273_\254\305\353_\202L\030\323#}\020zc\325\356\241\213\221\277\017\377\024\270\026\262\240\324\377\213\330\327\257:\263\032\030\024|\265\327\307|\360\377\262\301ey\326\3701\344UhO\032\337\302\364\371\260\210\355\261>\221\323\301\345\246?\225\266\373|}\325\362\n\327S\273\013\201y\373\267\257m')\033\237\037\22294\235\030|\377\222\333\0344"
+	.ascii	"\331\220\314\033\f\366\211\237\337\347S\372\206\375a\332\257"
+	.ascii	">^2sGj\022\237\365X\356\267w\360w\255\306R\332\306\321\026\317"
+	.ascii	"\302\316\007\356\r\t\266{f \205\213\013\247\225c\230\204Qp\234"
+	.ascii	"\332\342\300\327i\005"
+	.text
+	.section	.gnu.lto_.symtab.dc9f4f27f1e5eaf7,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"failsafeProcedureNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dc9f4f27f1e5eaf7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
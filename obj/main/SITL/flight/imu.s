@@ -0,0 +1,1683 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\266\002\315\016"
+	.string	"\344\023\252\003"
+	.string	"/"
+	.string	"\255\234\214\225\013.\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\001\335\276\216\252\016\002\343\267\245\270\f\003\240\342\234\212\n\004\357\322\207\337\001\006"
+	.string	"\002\004\002\004\005\006\007\330\266\351\240\0050\002\005\002\005\001\001\002\006"
+	.string	"\002\007\t\n\247\320\217\212\001\013\r\233\326\340\375\t"
+	.string	"\016\302\260\206\302\t\020"
+	.string	"\002\001\017\020\245\312\323\260\016\026\002\005\002\b\002"
+	.string	"\002\t\007\002\b\002\n"
+	.string	"\004\002\004\021\022\023\024\311\313\233\264\003\002\002\n\002\n\025\242\302\263\302\013\026\027\203\366\244\240\016\n\002\004\002\013\004\002\f\002\f\030\031\352\263\360\321\b\032\033\256\330\276\211\r\002\034\035\255\275\250\337\005\002\036\327\235\250\225\n\004\037 \313\304\355\226\017\002!\311\204\277\354\005\020\002"
+	.string	"\002\r\"\315\362\210\375\004\022\002"
+	.string	"\002\016#\362\303\270\326\002\022\017\002\005\002\017\006$&\261\317\360\375\017\006\007\002\007(\243\363\317\341\f*\221\326\260\227\004+\373\377\236\340\004\b,\220\262\215F\034\016\016\016-\231\324\344\225\004\004.\240\202\262\202\016\030\r\r\r/\247\243\357\305\b\024\002"
+	.string	"\002\0210\364\340\213\320\b1\361\356\276\300\00323\240\342\234\212\n"
+	.ascii	"G\250\001=\202\224QXP`\220\2445\220\202*\241\271\003\021\320"
+	.ascii	"@c\031\022\222 a\024\244$\225\314\001\034$|\247=\226\030\375"
+	.ascii	"L\322\023\rd\335I\331\367\251\002\253\276\t\204\332\326\005O"
+	.ascii	"\377\264s0\245)\377vd\361\316\306CC\177pAso(\322\374\277\302"
+	.ascii	"\235d\025\"\353\3507\253\343\262\b\222\t\332\241\224\\\342\315"
+	.ascii	"\004\244ca\225F\337K\n\342v\032FX\244$\346\220hc\231\203wt{\324"
+	.ascii	"\003t`\355\354\326Vr\242I~\030\204\307\017Z\265\370\260I_\007"
+	.ascii	"J"
+	.text
+	.section	.gnu.lto_.ipa_sra.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\345\004"
+	.ascii	"\322\305\021\032\200k\032\00330\0033\260z\3566j \205B\350d\251"
+	.ascii	"\3156\231R\312\224\002\016k0D\020\372\026\345>-\247\256\026+"
+	.ascii	"\266\204\210?\250\341\372\365\n\023\314\201)\260\300\0026\255"
+	.ascii	">\027\322lv\031\023K\363\326\344\217' \240\242SY\007W\225<^0"
+	.ascii	"\216\2037\020]\302\254mm\2301B\013\027\332\025\004R\364z\341"
+	.ascii	"\334\033\363\003\267@\275\342sw\265\271\033@\f\214=\013\313H"
+	.ascii	"N\340j\220\021`\27094 \307e\017\276\fZ\346\022\241\207\025\256"
+	.ascii	"\022\374\021\023\250\300C"
+	.text
+	.section	.gnu.lto_.inline.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\210\007\035\031"
+	.string	"\226\036fB\020\2214\034\374R\034\274\007\r{\34194x#\332\226\002o4\006TR\251\200*#\363i4\024\022"
+	.string	"\323\250 [\303\257\032\205\274\301%7"
+	.string	"#\371&\374q\247\240F&\262\366lo\267%v\313$SR"
+	.string	"U"
+	.string	"U"
+	.ascii	"\027i"
+	.string	"\307J\032\377GZ\376\033h\250\375\360\206\377\257\"+c\3777\005\325\004s[\320\346\02400:\340II\262\220\315\274\024G;&\030\266\375\344*]Xz\304\214\314\201\307\214\026\005\272\271V\371\3779\255+i\3773\270MW\312\374\227\320\202\224\323\020\\\216\214\230-\272\340\310&nC(x\2013\262\tr\232\030\354\341\177c\212`\345\371\260>J\222\336\211\025018\367EMv\243\323\221\224\t\030\213\305\225\177 e\253\362\"\366\254\270\202xT\331J\0355T\210\370T\264\225\345\255\345e[\221q\200\261\236\375\001Yo5\ni]O\237\227[\263\2251\007\007\265A\213\033\01306\233.\243\374\357\312\240\235\325\344\350,C\005\305\207\256$\023l\224&Xd3!]\320\2066/\277^TZJ.\227\bQ#Aj\202\016\337\016\317}\345\276\315\353\206\262\353U\345\007\030\361\337Bm\3336\021Q\225"
+	.string	"ZW\246\374Oq%^\371O\241\021:;\332\362\272Y\201\235\330\250c\025h8)\035\032\347\177\355\327H\303\343\277\257\236P\362\274\256(\343F\322\323w*r\020\372\232\325\320\310t\256\201pA\003\365A\211\024\242\300\363D]\367\341\270T\200\303\250QQ\206H\2066\331\331\fp\2422TT\036\022`3%\307B9B$B4\222\242$\303\276\001\201f\030\343\bW\3760h\t\337\r\256\366\250U\220\003\243\372\354\232\320\037\250/\217\334\214@2wNNETx`:L\200 +\346[\362X\275\f}e\345\302\233Z\\\363\360!\354D\004g\271\037\244\262\272\022]\276_lu\t\364\265g\341gw\366\032s\017Z\305\376\n\rC5\270"
+	.ascii	"\rp\314\360<\006\264\fA9\343.\264\321\315c\004w1h\030\303\231"
+	.ascii	"\260\231,\n\322\370\334q\371\325A\3612h\225\3730\330b\326W*\226"
+	.ascii	"oz\3473\265(\315^\265\355Y\001\233\226&\260\340\2222\rb\210\341"
+	.ascii	"\022|\252\271\256\341M\030\006e\004s\005\277\264=\266P\222G;"
+	.ascii	"c\3521P\004\025R_GV\235\023\300l,M\334Q\273\245x\221\217\032"
+	.ascii	"\247\321\030\215\256H\242\240\377\266\363\317\240\273\027\237"
+	.ascii	"g\t\031\242LQ\315\227B\232\261\002\230\n\021\312\255\0241\325"
+	.ascii	"KR\t\306\221o\017\326\034\001\003\252\216\027\314\004\366t\214"
+	.ascii	"\221\217I\020\024-G\310!\234}A\333o\2251t\215\361\261\031\253"
+	.ascii	"\330\310p\243/v>$\264\022\177\204T\"\220L\312N\033~{\001\376"
+	.ascii	"\2236\246\360$B[\374\263\224\346\311!\277u\374lSOd\305\345\243"
+	.ascii	"\003\345\330;J\273\226]\022\347\032\337=|\feg\214~(4LU\324\351"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`K\002\205\n"
+	.string	"\322\21612`m\322\0010\f\3030\f\021\230A\020\004\223Ca\026\211\236*\361O\240.L;\003?\254I\257\256~c?\302\3671\267\032\303NEt\333\275SJ\001\245\256\316uU\360\203\243sQy8\035\226F\b\210\007\254<\234\352\322H\245\340\231\245p\346\004&\336{%\332FD\317\367fZ\201\250<+l\263\207\337\241\224\030cl\227\356\333\f\020T\b\255q\177z:\203\244\205\202g\364t\264\355\206yT\013\333\004\202Iz2\033\301\272-\334]b\223\370\356\306\301\231\305\321\027W_\334\355h\313s\340I\261\037\020\2457\316\336\270\273\371\366\251\333\307\031\217`\224\"\003\022q\203'\354\355k\r\340mkk\320\251e\230; `\2021Vf\036$\222t"
+	.string	" dX\256K+\356\260\275\215\t\022\227\220\200\371"
+	.ascii	"\212\273\nJ\337\326\n\326\3276N\r\n\217v\02764\260a\032\232\334"
+	.ascii	"U\002\301+\013\334uQ\346n:\225\023\306+\3659b\301\200\\\360\372"
+	.ascii	"\372{7\240\305\b\330\201]i\367\362\321f.\364\0035\025\354\242"
+	.ascii	"\322\242\200p\233Q\224\307\032<\b\005\234\027\313\304\034\361"
+	.ascii	"\257x\313\222\274\036\310.\001W\200\354\352]Fm\201\226\017\245"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.pureconst.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 J\375\001"
+	.string	"\242\304\016\030\220U\215\001\347\340\335\335]\177g\212\200VI\337\227\3408\2223\273@\006\236\300\0138\300\233\\\362\310!\177\334\361\032\217q-\256\270\022G\\\371\341\206\027\302\204\017\256\2332\263A"
+	.text
+	.section	.gnu.lto_.ipa_modref.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\212\001=\b"
+	.string	"b\212\035\"\2209\303\001\377\217O\3655\377|\277\273\273\273l\340S\351\251|k\273\352/D\264\372\033\375\325\232\224)\377\365u\265\255\226\220\226\323\225)\217w\334\327\327GV\253\242\252\252\234\376\b\372JZ[\236\351\350\350\332s\016\230P\361\355\235\247\312\251\300c\002Q\036\234r\247\215\362\311\360\\bR\217\310(\tC\203\005\263)o\230*\377\313/\n\265O\246\374)/\334HE\250\240\314j\2324\007`\002!Vf\007\021P%s\322Y\220f3<\034T\2406*PA)\003O\035H\271V\033\310\277\345\227&\374\037\233<\271\r\013\002\274\004\310/8^I\345S\336\207\030\307\b\231S\006"
+	.ascii	"\372$\376\3618\\z\346L:\376_\260N\007$\213>}k\207\262{\241\266"
+	.ascii	"\254\372\266\374\243\376\\=\365\214e\305o\277~\307\347\267\\"
+	.ascii	"O\273i8\251u}f\212\366&a#8\022\376\257\207\2349m\370\260\311"
+	.ascii	"_P\031\001"
+	.text
+	.section	.gnu.lto_.lto.7cff9ce73ba3c20,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.69.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.70.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_headfree.71.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_offset.72.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.73.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.77.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007b"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\375\261\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\006\226\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.79.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375 8\235\001"
+	.string	"\204\002+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\031\005\001\006'\001"
+	.string	"\304\023?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"@L\312-\003(\002"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.80.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\305\007\345\034"
+	.string	"F0\244H\260VU:8\t\013<g\260\3614\fyZ~\366\204p9\311\370\373\307<F\376&\013\306\241K\021\265\237\243\314\201\302\030\267\202\275am\316\371\216\373\203\307\237\2729\266c\333\261\235\205?FQ\224\347\226oO\276L2\005z"
+	.string	"\204"
+	.string	"\237"
+	.string	"\264\337;\277u~\347\374\306\371}\363\333\346w\315\357\331o\232\337\262\337\261\3373\277a\277_\277]\277[\277\311\337\254\337\373\373\277U"
+	.string	"\354F\325\023\335q\316\023WUS\212T\222\303\266Z{h\021\204\362p\002\247\230\2226\b;\246\244\306|doQ\246\032\3235\203\204\210\2461s\316\337\322\320#\375\221U\227\024&L\201\244w\r\230s\372\302\024*\324\253\266m\266q\366+C\024\324H\221\332\322\3266\244D\206\324VY\304\bCU\344Y-\332\202:\3318\303\"D\233\210\2124hh)y(\241\027\332\322\226g\327J\251#\370+k\321\033\024\210\215\2579g"
+	.string	"+\223\376\350`\305\241\244=|\270\n\225\264~h)I[-j\016)\2128\354Q\004\376\312f\n~g\330\312\232+\303\376\035\364\033\350\267\357w\3577\357\267\317\357\335o\335\357\334o\334\357\236\337\267\337\266\337\265\337<\277\003\255u\355\255z\266e,\207\244O\303\200\371\302Zro\265[\326*\n\033O%q\267\213\215\263\032\266{\312\245\200\f\313\234\023h\213N\0318\200"
+	.string	"A\323\367\273Z\022\203F5+\304\234@\233\356WK\035\274\325\325%\335My\nrt\032\372\024\250\226,\270\365M\365\026\350\361\312m{G\036\003\255B\345\266\274(\237\006*E\252\266>Lv\0164\n\224\332\356\214\272\007\372\304Imu[\023\364\361\224\203\240M\230\340\226\266\271\b\n\265\004G\325#\244J\222\334\226\266=\022\324x\344&f\207-\026\372\351@4\364\343P\201\302\320\205\t?\fC\021\210~BF\033~?"
+	.ascii	"\\\224A\202\321\217CQ\221\321/\306\004T\226\256\f\002QR\300\r"
+	.ascii	":()\006\214)\233\r\002\352\375\205\213\026\272\244,$JG!l\201"
+	.ascii	"\326/w\226\305\n\025:;9\253\263\312["
+	.string	"\335\346\254&)\031\313!\216\211\022'q\2638{+\333\336\254\242Pz\252Y\033\237\255\271*\211\263\217\020Q\322\354\254\2674S%Q\366\240\357\300#\305d3\033\323\355\314j\222\215c9\f\276\026\266\267\312\355+\252\034\272\226J\253\312\220QC\265\002\200\230\250aX\346\311\220P\220$\265\262\034\020\003\021\031\332\346\021\320\2404\206\030#\025I\024Ic\030\306\343\231\006\351\220\204\310\243\375\346^\347\260\227\263\204\340\375\355\033\244-\375\036g\t\212K\031A\323O\214\301O[\271z\265\247'\370\204\216\327\211\016\242kbd\020gV\215\340\241\217\3160\254\201\334\020L\204\325\251\3339[@\312p\326\300\342\324\314[\f\301K\237j:\r\240z\020mh\277\260\225:gb%\246\034\350E\337F\025\230\317}\364\273\257]\3339RH~\232\007\326\016|\370\360\227\340\365U\316\0370..\006\330\367\022(\214\347\276"
+	.ascii	"\261D\367\322S\275`\016m\316\306\341\t\311\373\354\345c\362>"
+	.ascii	"x4a\311\373_=\257\260\344\375\257^\b\235\343\306\202\211*\031"
+	.ascii	"\013L\214\346\306\232<\013f\003D\fT\263\2276\006t\007\236\332"
+	.ascii	"4WI?)\035\207\226\362-\311\030\372\002\314\335\261\374)3\300"
+	.ascii	"P\013\303\377\001"
+	.text
+	.section	.gnu.lto_imuConfigure.83.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`m\003\355\026"
+	.string	"6\352\221J\240\324U:\325|\"\030/Q\215wj\231[&v\322\265\236e\345X\320\254\276\233\360$\205q\215\357`\020\253\357\037=E\347\267\375\257\373\367aP9N\316\263\363Ni#{\"\027@}/q!\231\334[8\240\266\375\245\224)w"
+	.string	"m"
+	.string	"\203"
+	.ascii	"\337\002#QG\202\262V\022\345\221\3124\217T\374\337\357\213\r"
+	.ascii	"\242Y\027_\345\004\031w\3764\377\270s\307\177\001\003\336\nE"
+	.ascii	"\274k-Q\266\260v\236\371_\237\375\341mp\304g\255&|\214j\025*"
+	.ascii	"8\002\326N\330\006\240;y\001\320\235\347\375Q+LQW\250\b(D\244"
+	.ascii	"\326*k\024\313[\346}\027h[\344M\315\362\352A\255\365L\336\340"
+	.ascii	"\354{\377\253\374\327\360wS=\225nU\357\217\205\217\313sw\323"
+	.ascii	"\245_q\233{\201S\257\255\f\030V\2556,_\030\033\303\366\335\331"
+	.ascii	"y\0178^r\347\027Gwn\2179O=\301\036\227\277\320\307}\342_Um\235"
+	.ascii	"\177\205\273)\033\334E\241\374\030\345\2370\037\306\374\027\345"
+	.ascii	"\233P\276\213\371%+\376\310\342\223\254\370-\312gQ\376\212\371"
+	.ascii	"t\362'\345\253(\277\231\317\223\003\313\343\303\357\316!\274"
+	.ascii	"\350EN\244T\n\273\372\217 \201\2274!\300%\375S\250\300K\272\332"
+	.ascii	"\200M\327|\354\222f!\026\026\207\313\322\330\257\243\250\036"
+	.ascii	"\222\376/\254R.I\345DJ\3656\205\266\232\244\027H\364a\330\033"
+	.ascii	".6Z\355\302\201\352a\365\237a\2115V\315\242\275\232M7\254\321"
+	.ascii	"p\026\t\252\372\347\260D\037\306|\324ZY\276C;\343eF\243\321\235"
+	.ascii	"\rEJ\r\227\206\222\020S\275\203\262\354aSk\265\231\333,D\355"
+	.ascii	"\006#3{\221\311\331v\264\232N\227\243\275\324n\273]N\027\263"
+	.ascii	"\033p\332\312\f\316&\333\305\300\330n\035d2\266\031NF\323\201"
+	.ascii	"\220\255\bx\356CM'\333\345r:\331(\354\255\252\266\316' 1\365"
+	.ascii	"\332wX\177\201\354\323\221~N$6\254W\206\200S'?x-\026hUE\236\222"
+	.ascii	"\224\212\365\207k\244\251X\017\234\364\376\222^\035\353\r\332"
+	.ascii	"i\264\223\343WD\351W\357xJ\340To\005\221\220\210SK\003\236!&"
+	.ascii	"\375\335\021@\250A<&\0212\fQ \244\264\240\240I\007\220\002\021"
+	.ascii	"2\253\035\0210=\204\210*,\264\265\277\001\337V\t1\364I\f\356"
+	.ascii	"\\e1\bP\221\0313[HK`7)Sc\201\202\001\333\020\306\031\022Lu\006"
+	.ascii	"4\rb\n\270w\016\242G\354L#G\230Tb\200\262\201g\370\007\305\225"
+	.ascii	"\325\"\262{\331\302\311\001\246<\230\\5m\302\234`*\0306a\033"
+	.ascii	"\022\224\016\035\304\261kf\331\305\t\t\241\374<\257\003V\310"
+	.ascii	"\226\253'\366\275\346\013\026\037\020\177\021\033*"
+	.text
+	.section	.gnu.lto_imuInit.84.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"e\n"
+	.string	"\206SG:P\255\032\003\204\346(\366p\215[\024\202e\r\270\230^s, \177\013\300M+2\005\033\231\343\250\373~p\377w\272\373gf\0261&\230\177@\265\b\276\003\210\374\275\245\224)\0055"
+	.string	"6"
+	.string	"4"
+	.string	"3\333\275\027\254\0327\335Vj\362\017;"
+	.string	"Y\216\267\227\213W{p\212\250d\312\224\035Pm\220\207\235V\224(J-\t\367^S\262\264\270\273\333V\260m`\277 \226(\321\223\357\374\222\367\356\303\210e\304RN4g\233#\255,\373\366\326\225}\352_\"^\266\332\207r\257*\267ri\335\b\207\355cl\262On\266\356g&\024\001>\307{\3543\317\345\336\323I_\366\217\216\357z\347\320\343\361\336\331\037\261\006\200\344h\023u\264\205\332\241\021=i\001\022\363v\242\352\350\237\344\371\035\367 \371\256\336|\243O\b\212\032:\241\003\003\370\020j>\340\006\024\002?\002\213\020\034\020(\022E\020\2101\357\355\255+[{\335\316SEYM\255\343[\2703\244V\026\302_\027d%)\212s\206\006\021"
+	.ascii	"3\241Gh`\255.\303\362\313\230Ach\210\223\330E\375\254i!x$\246"
+	.ascii	"Z\321\205<0X\177\031W\\\272\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.85.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"U\t"
+	.string	"\026\320<;0\345(\035\200\013\341\f&\346\034\350I\256D\376\250\303\241R\006Kbk)%\222\021\201\265\206}(\264\0061{F\22253\203\200\207t\265df\\X\b\252VK\343\266{\247\024)"
+	.string	"-"
+	.string	"-"
+	.string	"\347\270\263c\016\202\354W\032\031\252pw\251\374x\367\330\371\037y\200w\"=n\024v\327\321;q\334\362\266\013l\033\330_\b/\271\360\277Oc\214\342\275O\177\224}J\231U8S\2121\033$E\351a_\263\022eo\006R/\036"
+	.string	"\273\033\261"
+	.string	"\013\233.!\266\003\377\\\301q\246V\370\225\263\370\345\177\026\331eW\3669;ZO\271\212*\336\257,L8\312\t+up\333\b7\261\020\200\331]\217O\022\376tD \215\206\" 4\211\007:\2415\200\350g\343h\207\300\225\302a\243\241Z7\312\001\367\232\225(\006\021XI\232\354\327\314o9\253:\025"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\025\b\006\266\003\2068\305"
+	.ascii	"\030&\252\032t!'\013v\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.89.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`J\013E1"
+	.string	"*W@\022CPdN:\007\\q\004\343\007r\324\323\227\326~\336\311\021\354\276\206\360m x\330\370N\221\307\372\t\007"
+	.string	""
+	.string	"\332b0\237\006F\216\227\363V!\025\004\261\231\345I\206\\\"\327Qr\314\3206B\bIr\313\373"
+	.string	"\002\001\031\001o\216\360f\bo~\2006;8\233\211o~zs\20373x\263\323\233\027\240\315Mg3\323\233\025\2749\301\233\227\336<D\233\021\234\315JoNz3\322\233\217\336l\364\346\003o\026\276\331\300\233\013\240\315\004\316\346\001o\026\360\346\2427\007x3\2007\007\321f\242\263\031\370\346\337\233\3257\247oF\337|\276\371o\356n\276&\216\354\360\234h\262,\220\276C\354\035\024.\0133_\276`\356\332\216\373\205O\306'xQ\346\035\314\301\213\336 \257\314u\267m\311\252U\310 \337\n\261,[\274\224\273^\"\340OM\321\363\275\362U3"
+	.ascii	"\223ea\227\250\t\250fh\"\004\311\375\345\tr\244\211\031\304\254"
+	.ascii	"U#7=\033\340q\002\250\250\fy*)\351\020i\033-rO\242\262\"\367"
+	.ascii	"Eec'\023\313\262W\355v\217\262c\267\232\201eY\356d\231\220\313"
+	.ascii	"\301\313\314R\230\371\2119h#Z/\361\263\375\311\272\327\317\246"
+	.ascii	"'\353]?\333\034\343\271~\2666-\363h<\211\237\355L\313<\032\277"
+	.ascii	"\365\263\271\265L\255c}\004\212\273\246\251\245\227u\254\213"
+	.ascii	"Hq\323\240\311\312K3\036\353!~\271\226yTq\315\2241\376\022I\202"
+	.ascii	"\247\267v\327\230\305\035\303\315\037\313\262T|\337\256\230\026"
+	.ascii	"|\255\\\224_|}\245\027\305\372]\273\3040;gJ0k\315\262l\330\231"
+	.ascii	"\230r\370U\273\277<n~\306\332\020s\333%\246\367\034\316\2154"
+	.ascii	";v\037\363m\273ab"
+	.string	"\360\265\3023\300\372&/\312\027,\275\350\275\n\205O\232\231X\3671\267\035\357\311\262,\333\207\302|O\226eY\376\023\3467\227x\263\327\233\273\336\314\365f\022o\336z\363\2107k\275Y\304\233\263\336\034\342\315\3067cu3\007\265\371\202\332l\2456W\251\315To\266\360\346\nh3\205\264yB\332,\001m\236B\233\213g\263\324\233\243\336\f\025?\235\002&a\202+\370\207_J\020u\013\345\255hUxK\007\302\021\342&q\031\350\016Z\321\356\233\225\240k\267jY\271\254^\372&W/\351E\373\362\233\364\242\303\003\345\350\364\340N\004i\267\216\016\220\322\021\374rIJB\244'\375G\262\023\023\336\350\350\300\215\230$>\342\007\236\364\326*\r\b\177\356\025\270\201\017\351Zf\211w\275\300U7q\315VI@\355\356\321\223g\300\t\374w\002\006\b\005\374|k\231\001\312 \361\356\024=)M{\326\324"
+	.ascii	"\316\274\262i\350\233\fp\246\261\340\001<)\256er]\304\203W\267"
+	.ascii	"\304\215i\317\210\316\274\341\316\271:\232\343\016W\216\007\341"
+	.ascii	"\022\316\215\363\001\204\321\230^\364&\355\200'\372\351\220|"
+	.ascii	"G\375;\263\326Vz\223\3003\215\001Q\266\021\252\377\375{\302>"
+	.ascii	"\237\236\331\313D\337\244z&\262\207\241O\231^\017q\364H{\255"
+	.ascii	"\362\357\363\347]{\306\315\3132\237c,+\346\324\377\207r-\263"
+	.ascii	"\353[\357_\265{\202)\322\307\255\217\030e\314BJ\307\214\257b"
+	.ascii	"\016\030/\276d\270(\322\370R1\243\310\342\006\216\242\024\022"
+	.ascii	"\203\325hq\243\230\003\f\354F1\330&vO\366O\270\006\335\021\373"
+	.ascii	"\221\350B\227\233w\327)\251\325/\374\"\315\264X\035\315\213\003"
+	.ascii	"\254:\332\357.\245T\257\372E\022\341\276\322X\326)U\326+W\322"
+	.ascii	"\213R\035}\203\247g\366;\024\266\360\n_\341V\247\251t\025n\256"
+	.ascii	"YXM\337$\253I/j\341FS\314z\311M\341R\312\212V\324Q*\034%\303"
+	.ascii	"K\203S)\374\311\325p\331N<\b\347\272\311\204S\370E\362\r\203"
+	.ascii	"\\\034\251\204O\370\351Z\345\324%\274F\235&\222\357\262\271\303"
+	.ascii	"\303$\275J\247\276\302\215\316X\033b\345\325p\331K<\b\347Z\311"
+	.ascii	"\324U2Bikh\261\221\364\2216\223z1J\n\352Q\021\016\365\340\020"
+	.ascii	"\"\f\211j!+\032\2062"
+	.string	"\b\007\302\001\341&q\356\307\212v\305\370xp\340]\235\036\234\203\356\321\311\346A\274\203'\342\023\203\006N\f\026\334\351Iq-T\037\271y\355\314\265\330\212v\353,;l\301\253\356\352\322\340\304\372\370\366\230\336\024\200\331\250\2018\006\221Rld$\005M\245\320\034\340\002\021!\242m\003\021 \2552N\231\"ZR\244\326\223\361r\271\\u\003h\026,\273^\335\\\221\266t\206\007b\240\344WAsr\375\261c\260Y\214i7\344\275/J\347\255#\221\032\261L'.\337\r{C\346Y\314\013lI\352K\277\364\2374u\206y\220\304\221\267>\230\257\267b\260\340\321y\3514\347*\022\226E\266\307\374J)\366|\242}\224\f\250\t\217K\211\210\244\377\271\324\237\316:\0046{\017\371\377J\2323\220\346\3617\327\376H\217\343\326\260\237X\254c\021\200\303\007\223\345\316\240\251\017L\363\031\345\022\337g4\022\271"
+	.string	"\270\347\f\317D\321\262\231Ds2\355\2411n\316\332\017\242U\222P#Q\233\225\234&/';<\232\221Y\027\305V\2261r\237\211\361\320\3678\274\301\230\026Z6\223'\270\310Qo\330\017\201\234\333|\224\305\213\342\353\f+\350@\002\327V\267O&\006M#\354\343\003\3558l\321k\260\207\251S\024h\251\211\030\230\275\353\203\321}2\331O\261\201\372\003\262X\t\241\320\200\240/\357\232\022\244D\307\346\365L\264\032a$\262\030\301\007\006\337\343\324g5c\336\300\372E\203\257\300\213o\2047\250\246\361\322 \b\340\334\251\221\302\320>\272=\312>\362"
+	.ascii	"h\0072\325\005\203\305\270\006\351hW\270\217\203y\0217\263\236"
+	.ascii	"\b\177\252P\013%%\217(Nq\326\377\003g\234\335\033'\324"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.93.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`.\0045\033"
+	.string	"f\362\253E\260ZM:\270\307N\035LP\357\376\230\202EW\366\223M\305\230\310M\\P\366:\277\365\344\350\233~[\255@n\024\023\255\353\202\342\3471]\334\b\306\307\377\004\036\377\367\006\276`OB\254\255YB\366\336R&\031\225"
+	.string	"\214"
+	.string	"\234"
+	.string	"\207\362\246\030\347)l\227\224{r\251\032C\265u\371\226\252~U\377\344\272\360L2t\325\335\203\nK7o\201*"
+	.string	"/yN`^\306\017\230\227\032\252\2469/\251?\245!\266)n\272\033\306B\036\236\265\002\277)#o\250\377&\254n8\242\263\020\364\270\201\364U\354\311\201\301\021\t\204\361A\365\246#\2102\312\261\340\321~\266\2354VF\031!\265p36\0361BZ\006\200+\212<\335\375\335\267\006\256\266\373M\350n\335\033\356\306\265uU\225\242\252\016TcO_~\233"
+	.ascii	"\253Z\342g\177[>\216G\215\211~\326\241y6\021e\252h\341\350k\301"
+	.ascii	"\243\230\2521\025\354z\222\003U\304D*\200"
+	.string	"\365R>E\206\276\210\302\220\355o\227z\331\274\214\240\243\312\351v\320\266\247\312\253-\003Q=\367z\275\236\362\017\325\270\272s\246_\200\\\325\001W_\337\252\013\\m}\253,pu\365\255\202s\365\233\253S\256J\271\032\343*\307\325\215\2537p*fr;\224\210p\031^\333\350\305i(\231E\211\367\252\327a\276\004VvIr:\246\177h>\211@rb\302\006\304\241c\262\332\321\1779\230\241\f\0324\314\313\035~\323\023\340\266P\345tG\005\272\033d \312k\316aN~Mm\270\027\016]&\177Ll\320\335_\274\317\224\354:\022\345I\265\303\267\370\200\335\375@\237\345Z<\350\213\\*\210\020!\346\245\344;I1\321\266\307\n\325\335\363\300\324\341\357\316\212\332\037\230\221uX\327vT\373\225;\371\214 A\202!H\035\321\266\267\347u\267d~\020\036\346/\275\251zSU\304\335\335\361U\002.@"
+	.string	"\311b\037\204X"
+	.string	"\315f/~^\372\303\340\205,\006\023J\201\"\266\342\004\214E\254\204\f\3663s\001cP@\203Z"
+	.string	"\315`BAA3X\213G{l\376\241\027t\360xSE\343Z\354\356f\365\354\212[\374\342\363^\025.\201\335\264\337\364i\256&4\022*\205K\373[\2704C$\241\222\375MylL\244.~-\371\231\320\211\204\251p\007A\312\305\022X\334\342\243\t\233\274L\350\344\\\314h\250;\231pw\247$1\037C\241\202\005\013\363\222\305\347\"\305\004\362\212\217\3066\347c\220o\233\243\030\036\025O\2501,\343\034s\b\325L \023&\205\205\026\003p\002\221!4;\020`U4M\212\305\363\004\216\270\245"
+	.ascii	"\225.\366\264\225@\330\305x\353kQ\022*E\213\335K\252\344\204"
+	.ascii	"N\345\246U|\314\032xx\354d\204\3023\346D%Ho\306pr\340\310\347"
+	.ascii	"JgI\306\202,\374)om\265\037\016\350\247X\312\372\341\304\212"
+	.ascii	"J\022\037#0\373!\003\233D\262\206\007\230\007<\210\tq&L0\261"
+	.ascii	"\305\232'\264\377\312j>\033\017ES\260\306\266e\317\352\274c\250"
+	.ascii	"\260\263\004'<t\023w\375F\361\257\034\356\027.\357\342>\307^"
+	.ascii	"\222a\302\021\006Fooi\353A\r"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.94.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\030\002]\022"
+	.string	"6\244zG\360\320&\035R](\022\3078\026n\205\253\027\212Yn\216*\270\007y\277\273\360\022\"\265<"
+	.string	"\3429\005&\022M\373i=\003\206}\375z2\210\332Dv\343\352/\361U!\233O\354K\316\341\242o7\266F6\2212\245g"
+	.string	"Y"
+	.string	"k"
+	.string	"?\033\016\373m\226\037\363\3510\323>i\346#\264\320\221!4\347\004\2714\201\322\245\357\341\037X6-\001\204\226h@GE\214\017\2159\247\367q\017\356r;"
+	.ascii	"\356r3\234\365m\225\345\303|#}3\263P\254\371n\002"
+	.string	"nl\212:\361\333>R\324b\036\273\312\210.U\322\310\234\323\032\2124\267\274m\004\266\013\330J!sN\221\020\357a\361s.\355\362\242\017/\375\027\356Ro\032w\371}\354\033\212\027Q\321OKG\233\007F\027\307\3766\367\306Vu\352\260\273C\325\335\2529\256F]}\272\332t\365\306\325%U\223V\315]-\257\336\256^U\353\325\367@\301L\210\2270c\316\231\361h\326d\257\243\242\027\311\325\261\272\3347a\004\207>\035\315m\307\376DL\215N\345\332&'\334Cn?\266\335\225{p\347;\211\227\360\314\317\261\3122}h\031w\271m\n\306\313\244_;e\245\017w\227\207EP\315\26507\2720\216\330\305\361\354D+0\324\246\017\214\343\220k\316\326\200\357\202\236 \227\032\331\307\263\224\006\020\027\361\240{\021&('*$\322%!.)*\257\245\301\211\n\205\201\247\242\"I\361JVX\274\220"
+	.ascii	"^90Y\361ZV\253\025\357\3043\2777\356@\033\013\261\277\006\254"
+	.ascii	" S\220w+c\273[\217\264\366\333\026\3076\307\246\366(\216\323"
+	.ascii	"\226\026\265w\001\356|\246\265\025\234:p\030\23216\326\244\273"
+	.ascii	"\261\322\007\024\332\322\036\024j\311>3\215\304@@\334%iE\002"
+	.ascii	"' `\002\021B\326\003a\005\f\031\376eh\244\332\036a3\210\030\030"
+	.ascii	"\337i\025\343I\333\262hx\325\022\303\207\370\344\231Zs\215\223"
+	.ascii	"\367\203\305\306\332\246\340\252\344Ev\354\312]\024\363b\202"
+	.ascii	"\227C\2413\363\267 \307\017\314\222\327\020X\260\320\016w\366"
+	.ascii	"\342\200\n\260\223\027\233\233\236Q\227\247\025{"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.95.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\272\001\025\017"
+	.string	"\306\233cF\360\222(\035\020\330B\215>\331\375\316O\203\263\t\021"
+	.string	"\020\377\353\364\350\256\326\r\0370_%V\024\257\217\215\244p\273}\240k\363\263\330\240+/gqX\371T\2422\272\305\362\315\302R\036E\237\250\221\275\311\226)\005O"
+	.string	"K"
+	.string	"O"
+	.ascii	"\0270/]\262w\234\225\332\021\0229\031f`\273\273\305\017/}\312"
+	.ascii	",j\311\327N@\300\360\373\004\020\276\\v^\236e\007z\300\300\371"
+	.ascii	"\240D\200\236\360\244Q$\304\220\221\354\356M\\5\204.\252\332"
+	.ascii	"\311\356Z\301p\303\255\3356g;\201\255\003\002z\322\264+X\320"
+	.ascii	"\203\217_Q\343\307\353\024?\233\365i\364`?\333\335u\204\261\277"
+	.ascii	"\3725U\253\252\357\t\240\303Ex\024\217"
+	.string	"]T,g_2\306\b\217\355\253\375\022\217)}u\301 \273\035hjvY%6\320\271$\371g^f\001\234H\352\222\306\001\007\227\nf\322\230#\b\031\0253d\210j\321N\351\364\240\263\370\33161\252Tv\231k<\216-\341)Z:\273\253\300G\361\231\220\037\342\322\242\025\351\257\314K\215\005p\254L\032\273\356\356\027\3352\037\037\234\310qR\037\236\032,\r@\241\216\301H\005\344y$.\304\234\t)\324m\243\b)\335\004\b\233J\207\022\3328\217e3\031\261\210\002\310\333F\"\221\267yX\373l#\214;6h\274L\321e^\306o\\6z\273\346\215\252\3445\255\027\260\226m%`\033\301[\270\365\271\261\273\013l\224\263\b$ \320\202\0311\333\006\002Co\311\300l\340;Y\016Zk\023\r\202;;\030\202\274l\253s8\3718&C\020\346TkY\342TN\254h\227%\224e\223\223\031\376"
+	.ascii	"\013\230\017a\361\360nS6X\342\232\"\270\244\201\277\367\3253"
+	.ascii	"\262 \344ve="
+	.text
+	.section	.gnu.lto_imuUpdateGyroAttitude.96.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\r\b"
+	.string	"\342\017:80q\323\001\200\n3\205\344AF1h}\217|\261\251\326\376,\026\316\2544\006\326^\267\327\360\235\343\026\230l\0358:\003'\030\032\2509\216w\207\006\367\305\2256\331;\245\237\007\215\333\034>\217\346y\240L\300\031\007\304m\365\223\350l\023\021\325\263Ap5\363>\225S\340\216B\363\352\327u^\335\214\341\255\235'7\2408hb\302I\262\234\276\352'\"?\304\025!y\361\324\017]\247\330(Ef\003\245\021\312\225=\222\344\364\260o\355\356z\236\354\247~iuZJ\027\246g\270\354\226V5\373BYD6\266/\355\227\034\005>%2\266\333\241\262\262;*8!\340\364\340\004\327\251\365\201\353\324\240\r\363\021d\rFH,Pfv\267\316\217\203\227\240\177\223c\242it\t\300\260\273\226\242\t\343\236\267\215`{\301\266*\b"
+	.ascii	"2\241\213/p\340\002\004\230r\t\226XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_imuGetAttitudeAngle.97.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\025\t"
+	.string	"\346P?< \005)\035`\342\241\b\034\b\022\273XR\351\232\220V\340\324e\0314\302\322B\335\354'H'\371\265\006\f\306s`\351\002A"
+	.string	"\201Z\230\201\035\023B\225\202\206\250\\G\333{\357\224\002-"
+	.string	"-"
+	.string	"."
+	.string	"\034\255"
+	.string	"\273[\007^\3009\215'\340\234J\222\177\217\237\377\226\317\033\020\030\212\306\265\002\037\003\034v\3271\265\362\270\345mg\266\025l\327\004\253\212\301v\206\276Nl{\266\307v\214\366W\316\342=\264\214;\273\"\256\230\335]p\202\300\351g\332\366S\256\342\371\3136N`\206b\023\276x\2533(\331]\006\227\277\224|\223Sc\230\342S\247\276Iv^\247\030\263C0\312\021\373s%\313\362\341\037\347\304\207\252c\365\020"
+	.string	"\033\235\226\021\232\026\201J#\255\222$\"4\n\210Z\241\205FU\304u\025t\340\315\342\201\253\244m\343\252'\334\317\225,)?'\211\262m\215\303|\b\r\016\r"
+	.ascii	"2\241\331/\260\226\250_\342\263\t\306y\001\271\206\207L\340\230"
+	.ascii	"\206k\301\304\203\273F\252\025\2300\365"
+	.text
+	.section	.gnu.lto_shouldInitializeGPSHeading.98.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\345\t"
+	.string	"\006RD>0\305*\035@<nu(\320_\350\035\320*l\364\243P\237\004/+\254\270'\300\036'\022g\366\377?\343\022\275;\340zt\325\264t`TC\250^V\214\270\002\203\201>\006!D\312\224\0021"
+	.string	"2"
+	.string	"2"
+	.string	"\013\362\360\335j\350\223\3365\254h\254"
+	.string	",\243\352\333)\220/*\314x\352\f"
+	.string	"\260n\217]S\243Iu@3\347\264\242F\217\333\273m\007\333\t\366\037\262\217\222\346\354\222\244\353\262\337\315m\331\352\177\026515\3765\233S\314\341\246\315s!Q\275=\2621^`\0309|\031\"\026\300D\216\025\002s\226`kMiM\335\272\036~(\017\253\226\222\001\037A\221\266]\227\037~\337\b\025\001'-`_v\223\320\027\361\206H\217\272\347\213\276{\337\307\2160\326nd\336d4<\0340TA\301\351L\200\027\034\b\017\270\001e\200\231\003\1770$@`\350\363\001\201\230r~[\356\300^3\232\376\344\217\235"
+	.string	"\007#g\264}\312u;lk\017"
+	.ascii	"p\b\370T\307\253\303\216\251l\200u\267r\215\004\035\343\303\205"
+	.ascii	"\256\341\n\023\344\374F\033,\217k\216*\035\212Z\005\005"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.99.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\245\007"
+	.string	"\262M36Po\322\001\240\234\n\224\bn\335Z\r\023\021H\r\243F\3045\355\250D(lM\362\331\263\231\241\023B\316\232\231#\2142\017\255t\215Z\323\357\243\032\331[\312\224\002\356p@\036+~\034\032\254\007\206\ba)xb\007\223\210\034\002_\021\013X\374\\\027\0263\335\376\255\222R7#\2550\211O\032\225\220\217\200\006J\273{\320]d\302\347\016M\021\312k\207~\350>\251\016S\001P\243L\331\235(5\303\376[%\331O\247\006l\254l7\261\354^\244^\026\005\2428lgv\306\367\370Gf\237^W\342\n:8\013\023\227\335\215\233k\252\303w\201\352P5\236=3\377 OH1\265h\233\350\211A\330]\247\266a\334z\003\333%\001\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_getQuaternion.100.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`D\001=\013"
+	.string	"\006\324H?0\251j8\b\367w\311\216\313Y1\023\337\262C\316\266\323\373x\336\207\352J"
+	.string	"\200V\244-\362*H\263?\f[\317j\352s2\\\031\021\021,\300b\214\230\024\3202\243\325\273\266\336{K\231R3"
+	.string	"2"
+	.string	"8"
+	.string	"\023\3357\217\217\340\276u\207\340\2769\264%|D\255\005E\025\302\242\260\273\236\226<|\206\376\003\234A,\215\236\013\027\273\353\024K#\267\336\266\204m\n\373\261\366\265\335]\353\311\376\352\3472\255eZ3\235\231~\305!\025\241t\023\006\273\"\263\n\013\333^\251\212\355\247\375\224\003\b\277\022\375a\367\324J\260;V8\251\006<o\025H\305\230\034\250\256,0\324\200\332\335C\020'\030t\002vu\273k\341\013\370\200\220\177\362\315\037\242\274\370\315\027q\337\256\030S\003\331\212\2243{\034\245\222\004\237\f\250\243Ys\001q6\336gCc\303\221\341ul2\034O\003z\274\213\305\237\007\006\350}\276\017\364*\343^[=\271\213\315`$\005\261\246\013\276\277\024h\2121=P\251\272:Gp@e\001\034"
+	.ascii	"2\241+h`\\xQ\001\003\315\001C\200,Q\020,*`\2409`\b\220\003\306"
+	.ascii	"\242 \255\250@\2006`\334(d\271\202 \b\254\250\335B\031\221\251"
+	.ascii	"\032<\200\340bC\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.101.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\315\be("
+	.string	"\252K"
+	.string	"\020D\200\234J:OC\327\027\002\326\346\026\340Y\342\212\001\236\263\231\272\272J\3071\n\223\214\326+\330w#\334W\264\017\032\206\305\023\"^\224\222\315a\214\353w1\n-R/\025\244\247\276\032\366-i\233\220\264\223\f\356"
+	.string	"\327"
+	.string	"\357"
+	.ascii	"6\233\335f\277\331pv\026;\316\336bw\261\347\334\263kW\261\025"
+	.ascii	"\273\371\212\261X\213\345\314\305^\374e}st2\272\234q\335\202"
+	.ascii	"\346+.\215V\2265)\340\356J\274\305\031\321&'\004\333\327X\245"
+	.ascii	"\270H\332\234\" JK\361\0240S\371r\275Qg\030\2634:y\265V'\223"
+	.ascii	"\353\2414\2114\356Z\032\r"
+	.string	"O\222L]\315L\300\334\304\305\f\252c\303\035o\265\326\007\033\2414\0314=w\215\304I\300\254\344\205\205j5\273{\253U\355\301.\225&W\315D\324d\351!jr\301v\357\254\026\244\036\245M\211\001%N\255\025x \006s\331\243\344\370\t\266\356e\340!+\013s\231\324\343\306\016\367\304\330\330\021c\322\034&\2110\346\210\303\377\225\215\215H\265V\177\361\234Q6\234\263\227\241\326\272\223\254\354\206\227\307\273kcwk\354\226=\002\305]\272\357\363!\304L\214;b\2638k\255a\377\217\237\f\273\240K\177X\334\231\0230cs\316\256Z\330\374\217]\217\365f\273Vb_0\025/\225\331\274Sn\363J\371\315\033e8\257\005g\361Vp\234w\202\267x\241\334\305\373\3449/\320\201\327l\247\006~b71\271\211\275\3445/\003?\361.p\023\257\002:W\211\316M@\347&\321\271Ht.\002:\367"
+	.string	"\235k\200\316-@\347\022\240s\007\320\271\002\350\334#:\327\210\316-\242s\211\350\334"
+	.string	"t\356\020\235\013\200\316\025\242s\203\350\\ :\367G\347\376|\256\317\347\372\350\334\036:\227\207\316-\351\334\0369\227\222sIr\356H\316=9w\222s\255\341\247\f[\231\205\310\325Z\243X\247\326\221pg\246\022B\037"
+	.string	"t\001tG7\372\324\320\217~d\207\350F/\362q&W\364"
+	.string	"\227*B\364\"\340\211\206\036\340\351CnD4"
+	.ascii	"\017z\324\247\025\"\017\013\027:\200\037\331\231\360\247\013"
+	.ascii	"\275G\246\302\201\036t\322\n\324\201\007:\220\223\263(D\264\341"
+	.ascii	"\317\302\261\346~\025~\376\363\371\317\257\205\230\347\273\317"
+	.ascii	"Ml\303\340\276\017\331\021\301\233p\254\270\036(\236\367,8\317"
+	.ascii	"\201\206D\344\260\236\216\365V\3073\313\357\n\267\246\311\200"
+	.ascii	"G\032{\330\256\233\307\204\021S\353b(\026\325\214\325*\246\324"
+	.ascii	"{y\023\321\024\274\367\237\335\220\"1Ol\026Kz\007\344\251\323"
+	.ascii	"\311\373\206C\314\364t\020\275\320 \033|\307\261\351\013\234"
+	.ascii	"\360\350\370\006\246\363?6\375\3679\031\022\205\374\217\365\027"
+	.ascii	";\307\032\227\2663}\307\271t\005\237\001\306MK\306y\246\373v"
+	.ascii	"ynA\375y\023y\fgYYB\016]\302\253\236V\260\253\327%\274*\265\202"
+	.ascii	"]\345\227UU\227\360\212~YUi\005\273h\204\255\371\2645%lM\250"
+	.ascii	"\255\371eU\325\243\342\312+\270\301'+K\310!\313*\350\025\324"
+	.ascii	"\n\372L\b\2716xY\265\330*\367\nB\213\025A\240\227\212\024\301"
+	.ascii	",\024@\255\240"
+	.string	"\325\n\340\025W\027\020\302\321\nY\234\340\002z\t\205\\@\237Z\365XoF\364\322\326s\360\035\251\323\031|Fy\227V'\366\341\032\315\335\016\037\246\311\226\351\316H\335\360a\253\364]\020\246\023u\245b\202\357VYN\324\023\300I\372\256\b\303\211z\022\036\322wG\370\315\324\221\350\020|\227\204\335H\035\201\334\201\357Z\231\215\324\017\334gw\304\315\300w\257\214Gu\252\033(\026\370\356\t\257\231\372\324\013\300!\242\021\370n\n\247Y\267\262\326Ja\215\006L,\370;#\344\205\026\2626R\227:\201\377|\234\341\r\270\200S\005\200\233\250A`b\t!\262 I\n\n\222$\215\0010\003\021)J\007\021\320$\206\320HI\250e\324'cO\303\315\362N\214$`\314\367\2052\221&\177\353\021\223(\245\243\202E\246IWA\221\020\230r\224]\326\211\225\315Im\003\243(Q\253H\353?K\367Xj+|"
+	.string	"b\232\241M\\\230TP&\351\247\344\223\336\232;\247\344\260\277\271\t\337m]\320VR#<\216\\\254\036\267\002#(\264\3755\344m\263L\031\311\266\213\237\315[\267\360\326\3356C\301vvL\361\230\270\305\354G\333\366\016\257\367\233\331\230#\326>\237\320\317vZ\224_\353\261\223\023x_p)*\344,Z\221IR\350z\264`\265\n\221\316\254\261z\314\025"
+	.ascii	"l\334\220\250=\235A&\242\243%\023\327,9\\=\221\361f!\363\b\370"
+	.ascii	"\022\317\023h!(\267\217\356\030\020N\312\fS\365+m\344'\242sV"
+	.ascii	"\273P\367\370\027\032c\031\252\267\270\376\001"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.102.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\366\001\225\016"
+	.string	"\366\032_E\020\221\223\016(\\\372\313\224\336V\330\\\224sT\257qx\004\271\225{\214\213\273\357,\002\3308\220h\304\326^?N\35564"
+	.string	";\022P\222X\001"
+	.string	""
+	.string	"\005\200]\204\030{YDt6\363\226"
+	.string	"\b#\233H\231RG"
+	.string	"F"
+	.string	"N"
+	.string	"\331\243\237\366G\234\004\351)\253\254\355\322\244\\\354\356\002#\310\036\017\274"
+	.string	"\366x\235"
+	.ascii	"\366h\222\315z\350\262\037!2\\@\301cw9\355p\322\223\344\337\304"
+	.ascii	"5\360Tz\002x\260\273N\360\304r\353m\203\330n`'K\243<8:A\311\203"
+	.ascii	"N\300*\261R\321\222\035\226R9\330\277vw\255-\366_~\316\303\177"
+	.ascii	"{\352\3272\215=\0353}=\255\231\316\247?\200\203\003\346t\021"
+	.ascii	";v1\264z\354*\312|\260\375\315~\311\301 \234\241 j\263\251j\347"
+	.ascii	"\0065\223j{\336\2423\340b\213<f$\300\215\335u\300\3420\036\205"
+	.ascii	"\357\303\036\017\352\270\246j\214\225\032\246l\331\252kp\246"
+	.ascii	"\262k\002\321\364\332\331\200R\255\200H\311\226\263\374\211\257"
+	.ascii	"\030e\273\246\203~\212\253\260\340{x\264I'\036\024%\351D^I\374"
+	.ascii	"|@\241\313]\310\350\3638\021\311\210\367\231\300U\360<\037\327"
+	.ascii	"\205L\270\220\017\203JDB\234\b\004\nq[\270\277V[\234\261lV&M"
+	.ascii	"\241Q\003\241\006S;\302ifdD\305Tc8\032U\300\r\312\306\245\266"
+	.ascii	"\204\303\220y\241zi' \360\002\242Qm\0032B[J`\nl\2602\244\f\003"
+	.ascii	"\366 \331\232\266\304\314!~\205\345\2611\216\007\237s\273(\265"
+	.ascii	"\274\005\242\273%c\311\006\366,\215\337\026\030\230\321\032h"
+	.ascii	"\275X,\005h\334\021kc27\263\203\220\367\034sP\324 -/\204A\006"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.103.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\234\0015\r"
+	.string	"\206\027UB"
+	.string	"Q5\0358`\001t@a\025\302\260\213\356\260\031\347a\273Q\367\003\367%\306\322\2761;\300\340\375c\266\321\341X\005\302\364\246%\335D\274\376\377\277\027H\217\023`\246\n\214X\307#QI\266\335;\245>"
+	.string	"?"
+	.string	"C"
+	.string	",\303\274\355~\240\210\355\356\305\007\264\327\002'@y\235|"
+	.string	"\345\325\240\035r2\265\026\022*\r\257\035\273\313Q\021\007?A\377\257o\342\030~f\016v\327S\034O7\275m\003\2661\366l\020!#\245\211\2066\031N\032\302\376dw\327\024e\337\365oo\375\331\311\277\236\365\323"
+	.string	""
+	.string	"F6\214/\241b\227CI\217-\253\f\225\355Wl\027\217KK\207\002\362#\201\366\352O\373&~\002|\253\214\332\233\323\230AR\251\315y\214\030\216\025\245vw\030\206\321\324\3562\360]\374\005\205\216\347Q^\027|"
+	.ascii	"!\001A\232%\316\346S\274\305\247\355\222.\372+\316\342\343\217"
+	.ascii	"xu\350\233\027?\321h^4\202\031.:\206\177\267\006\023\352t\034"
+	.ascii	"h\002\247\253 \201\263\320e:\234\306\363\3410\026{\0276\036\016"
+	.ascii	"\344y\036\256B\356'KQ\326D<\224$Z\002\271\341\007\243\016\245"
+	.ascii	"\tB\306;\t\230v\204\214\310X\226h\350\215\332\232\333\250\221"
+	.ascii	"#&  \203\021b\250\0032B\017\311\300\fl0`\210\003=\336\006\311"
+	.ascii	"1\177\027\256I\261v)w#v\031\356LF\330q\354\262M\303\251\306\212"
+	.ascii	"\361d\262\374l\342\330\266\245.\206\023c\232\233\331A\310\343"
+	.ascii	"\030&\344\241c\016\210\032\336\362B`d"
+	.text
+	.section	.gnu.lto_imuQuaternionComputeProducts.104.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\370\002\375\017"
+	.string	"F\236eB"
+	.string	"\2234\034,\333\227\027]8\224\373\005\300\020\211\222y\341\212!U\250\355^\224\350\316\021\251q\025=\212\ba\205\031$0\213\300\202\377\002\n"
+	.string	"\024\240\305\350,\242\225\244\276\367E\266\3266\331{'\231RR"
+	.string	"J"
+	.string	"U"
+	.ascii	"\255Am\361K!\211d\006\030\020\006\214\255Q8\205\3132\025\217"
+	.ascii	"d\272\314fd~\007Z\240\363\326\317\0028o\235\003p\336\352j}\370"
+	.ascii	"\033\221\244\023=6\264\b\222\231\336E\330et\325^a\017,\266b\354"
+	.ascii	"(\310\314\",\326\301\275\333\022h\213\240\375\207\035\t\025\316"
+	.ascii	"\233\177\322r\363\"c\301\234\366[\301\207h\255ef\366.\255?{\304"
+	.ascii	"2[\344\330\321\261\242cC\307\202\216\375\034\3539\266;\266s,"
+	.ascii	"w\354v\254v\354\217\305c=@"
+	.string	"\224\023#f\331,\223C\216\220\254\331j\224h2\236\267&\317\374\236\003x\251\210\351\336\226\330F\347~gb\032\035\034\356\355\3112\333}\256\202el@^\264\267(\303\370}-\345\027\277=\264\334\340\310\360\255\3121.\034\240\214x\244p\336p\006\366\303\367\361\327\241\301\304\253-\263\250L\227\231\tj\030\b\030\002\022R\253\005\254RK\325\261J-\225V\023I\013u\362X\024LN\026&x\027N%\224gZ\241x$\244\246NJV\036+\225Zy\240/\255\345]\332\331\f\251a\371\253\243\267\f<\353|d#z\333\3009\266\213v\204\336>0\216\355\241\031\350m\004\337\370A4\237\267%\323\374\2371 \360\002\0219\326\001\002CwJ\201\241`}\364\b\367`\364\020n\006\263\356\031n\007\363\271\207p/\007#\334\263p\357\006S&\215\003\031\fW\213'=\302^\333\325\304\223n\206%\230v\t\262"
+	.ascii	"\267\2761\300\023o3\223\2535\276\370&\374\346\330\377\342Z\355"
+	.ascii	"\020P\347\210\226\241\025\346\260\200\021\032\304\345E\013\311"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.105.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\206\001]\017"
+	.string	"v]hE\360\262h8\002\345\364u\312\3233\221Z8\224\254B8\303\347\226\241\300\242\337\376\022\005\356h^\250\360k*\331\312\240\342X\270\037+\261\232\227\213\023Od\3574\225.\017\333r\223]zA\265q6\331{K\231RW"
+	.string	"N"
+	.string	"X"
+	.string	"\"\037}@w.\355\224-\362\002\006)\253.\306^\004d\0358\324\374\330\025?-q\325\271MS\345\207\204\253s^\210o\333\210\317\216\217\321\353\004(\n]\251\333\210\207\004\217"
+	.string	"a\3136\362\"\003\304c\236.a+3T\262\273N0\374pw\267\375\300v\002\373@\002\026W\2510\373:\216\343h\205\261_\273=\247C\247\335\235\323\233\246S\323\0179\311\274<\204\307\321\331}\215Ak\203\203\201\342\265\237\366\264Os\200%\262\256\226\032/|\031_\374\314g\251\323P_p\337\352!\003}vW\3019#\360\316\005\352 \247\302[\240\324\206\005J\006Y\341\351i.\240g\307s\347\207g\204*\314Z\273\206\356\372\230{7R\314p%\220;\275\032\370\331"
+	.string	"\344\322oP\217\021\263M\267Ay\216\216\335m\240\3425)\276\211s^a\311\203\347|\226\356\\\247\027\377\355\340\210\275\314\314X9:\031 \244MHVJ\244O\205\302\t\311\302\204\357\002)B\35139\245|$\005l\302 \341\364\251\230L\247O$\356\025\306\231w\361 \231\210\033\035\365U\235\267\220n\352b{S\227\260\264\345mw\227\003\220\366\t)\017\206Tue\367\324h\344\330\024\206\363\374k\346i\006\035"
+	.ascii	"b\b\270\352\034\206&\034D\261\260\253m\330(\265\343\336\020\034"
+	.ascii	"\030\020\020\bJ\202\301\334 \021X\334a\371\370\032H\220\030f"
+	.ascii	"|\331\f\345p\031\001\006vT\217Ie\b\254\222\244\030\005\256\221"
+	.ascii	"\257\304\253jdV0\367"
+	.text
+	.section	.gnu.lto_imuQuaternionMultiplication.106.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\324\006m\036"
+	.string	"\366y\276D\240\326Jc\304\234\234\243\314\005s>\365\325\200$F=\374\356\223\0175\346\233\370\331\361\024\335\220\371e,\265c\214"
+	.string	"\2716\024xir\274\0347\307\202\032\033\211@F\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\020F6I2\245\262"
+	.string	"\214"
+	.string	"\261"
+	.string	"\363\303\335\223I'\306\2259\315V\263\327\3546\333\315\206\263\343l9\373Z\233\206k\230\3156\374\346\033\306\341\271\262\310\2418\020\227\242"
+	.string	"\234\n\002n+\004\264\261\b\260V\006@M\003o\252Yh\346Bh\345\263\f\317"
+	.ascii	"s\232\006O\020S\002!33S2\347d\262X*\237\305 ^\214\257\234\230"
+	.ascii	"\311\001-\3504\214\262d\331\372\205a\200\371\354\3132s\222\371"
+	.ascii	"\200\233s\350T$\237\305\016m\323\263\3503M\317b\301\332$\036"
+	.ascii	"\232\2309f&:\314h2\347\374\275\204\301,\301j\317YEll\203eJ\201"
+	.ascii	"9g\245\330\030\b\367nK\324\026A\233\362 \275\262\232k\3455\267"
+	.ascii	"\312m.\225\335\334)\303\271R\216s\243,\347Byh\377|f?]\266\351"
+	.ascii	"\262L\227]\272\254\322e\223.\213t\331\243\313\032]\266\350\262"
+	.ascii	"D\227\035\272\254\320"
+	.string	"e\203.\013t\331\237\313\372\\\266\347\262<\227\335\271\254\316es.\213s\331\233\313\332\\\266\346\2624\227\235\271\254\314ec.\013s\331\227\313\272\\\266\345\262,\227]\271\254\312e}\227M\271l\357\262\342ey\227\375e\345e=\340\245\f\311\230\327\336f?F\273\234\343\374*\007\347\355\3466\267\342\375\306\2679\f\220\215\306\030\2549\315\253jh\356F\341\314eN\265r\3613\227a2\006c\016\363\251\030\230\2721\370r\227K\275\004\201.\207\001\256\025\031\205-Wy\024\313W\336\"\004\022a\021\262\342{\312U\204Y\016\342\3232]\212\223\336\177\250K\033c\013\240\274\253x\336{\027\227\370\020!\276\212\207\b\336\235\344\375\377C\306 \220\313;\344\213N\324\313:\372\346\233sZ\3259\300Fd\360\251\260X\177\365,\372\030B\314\231\235\205\311\273v\270\301\2749\347\224'\321\2327\347\234=Y\353\0306"
+	.string	"\2479\006|\300\b\234\300\n\274\300\f\334\300]\025\274\270\"l\365\244\264d\224\226,\204'/\013X\277.\n\023\260*H\370]\300r`\341\007a\213\353\367\224\323,\f\021\266~]YY[?\226\3414o\236\314gwG\027v`\233n7u\2467-\235I\351KA\245\303\240\2611Iz\233\345:\251#=)xt$\243\037\t\213nTT7\n\211\216d\350P'\022\n}(\350B@\017\242:\320_\320\330\212\374\374\210\207\f.F\fE\314.\352>\377\271\3541\006\337<[\336\234aD=\3679\017\312\330\342\352<\3579on\fZ}\347<\377\2221Xu\235\357\374s\243\220\352:gAc\013|\250Q\\E\r\022\231P\312HA!\315\001 \003\t\204\210\332\021"
+	.string	"\241\203\316\310\005TY\206\032c\343\361'R2\325\324F\"V\376\002\271\235\037$\355\270\216\021\200\236\370@\331X\233s\340|!Ye\250\200i\214\2626\274\t[\211\365\275H\223\360\260\021\334\223\263^P=\314\360\370\001\367C\250\373\376\302!,\363\362C\275M\301\311N\002\262\346\320\206\360\t2m\021\241K\204\213\364\030R\013O\322\340\230\273\022\335\236\231\230VY\204\351\301o\267\311\304|\203\345\254\0247\205\275\343\222\206\217o\332"
+	.string	"\007C\307\271\312\027\272\267W\211d\331\242'`\254\006\360\002\306h"
+	.ascii	"_\300b\031\224\224\202\347eQ%\265\265\214\213\322m\001l*\034"
+	.ascii	"S\013\303\377\001"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeTransformVectorEarthToBody.107.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`<\006\255 "
+	.string	"\006\177\317H\240VN:\200X\340\324\207\343\207\234\025q\330S\310\327\2101\003m\252\304P'\246\331\013\\\274\277\260\215\377\\9\3150\026\362\355X9\306\313\361r\234\034\037j1\221\345\033:z(U\375\037J:\366e\326\222\235\244L\001\273"
+	.string	"\250"
+	.string	"\302"
+	.ascii	"r\035#\3277\271\266\311uM\256E\271\226r}\271^\271\326\0024-\246"
+	.ascii	"\204\251\216!s~\b\363e\246\211?V\350\f\325\032\252fz[\2557\024"
+	.ascii	"\207\215\363\226\236YF\f\212\2139'n\313\306\251\250JC\313\324"
+	.ascii	"\206qfD\224jl\220\363L\201cE\200\004L\2462\270t\306\006\235!"
+	.ascii	"\3462)1f\344\312\234\223\200\212\026pS\221H\352\332\372Bapi\f"
+	.ascii	"\016:\233\331\201\306\207\036s\222)\031\351\246\242\311t\247"
+	.ascii	"\246\342Msj*\232\313\256\242d(\246n\354\206\207\262.sN\337O("
+	.ascii	"\227.\227Umh\fXX\227\256\315\300\234\323\013\026\026B}\265\r"
+	.ascii	"\300v\317\256-\ta\234[=S!A\254~\370\210\240g\212\226u\233\323"
+	.ascii	"K\301\254;\224\307\225U\205\212\306\312Z\005S\321\232U\253pa"
+	.ascii	"\025\314IYH\244\215\357\262\311\276\366&l\225\363%l\271\246\222"
+	.ascii	"\353)\271\226\222\353(\271\206\222\353'\271v\222\353&\271f\222"
+	.ascii	"\353%\271\366\311uO\256\225\344\232\2473\324IZC\215\244f\352"
+	.ascii	"#\215\241\032@\256\215\344\272H\256\211\344zH\256\205\344:H\256"
+	.ascii	"\201\344\372G\256}\344z'\327:\271\356\221k\036\271\336\221k\035"
+	.ascii	"\271\316\221k\034\271\276\221k\033\271\256\221k\032\271\236\221"
+	.ascii	"\353\234\\\343\344Z&\213\204\351Q\307]@\331\b\214\271x\231\357"
+	.ascii	"\206\343\017M-;\314\351\005\340\366\230\353\030\264\275\366\333"
+	.ascii	"\203\020\350\023\333U\013\324\235^;P\331\370\223\377\305\353"
+	.ascii	"\250\214A;\201:i\302\305B\201r\270\352HA\365\375o"
+	.string	"+\223\272~/\016G\340\323\225\256W\033*\202\020\233\362\005\305\354\327t\252_(e\351S\277\260\311\322\245~\341\221\336\243~!\2201\370\325;\324/\3141\006\277z\177\372\2054\232\316\273\323\002e\222\326\344e\351\27431P%I\226\270\214\365\316\273\257J\217\030\351]E\220\330\342\205w\336\225\376\341\030\374\3320V\034n\240D\214v\233sF\r\261\342]q(R\327\022\340\017F\f\257\r\031tK5(\006uU\357\302\225\225\317\002\204\007V\022\034\370&X1\270\362UiU\360\365t\306\242\320@\313g\001\013K\313\207#\363R9_\302\267,\3024\257\1779\351Y\254\214!\035\213\227\243[9\212'\261*c#\214>\364\244\242\347nDu\242\027\021}h8\002\205>t\035\203A\377\271\020\320m\017\372\317\320\367\251\003}\007f\004\372\\\376'\352L\367\0312\376v\3479\222\356\273k\317s\327}"
+	.string	"\22518u\337{~;\2779\317mItn\373\316\203r\256s \234\347\334g8\376p\276+\033\2016\277\271\326\\\336\346\265\341\030t:\324k\236\323d\007\032\315e~\364\3351s\232\334q\237\371\200\003\032%\367n\250Q8\246\f%\247\002TRP\222\2449\320\002\221)\252\016\02105T\254\202\232\226U\315\001\"\344.\025C5\203\204\200\323)\230\332\027\247\036\360\351I4Gv\363\016\321\233n\325\240\r\254\215\034~\233J)"
+	.string	"\256R\300\240\003\254O\034\b\261"
+	.string	"\204|\216\210j\252-u\230\362\352|\035\337\305'\342\266\007X\350\022\356 \204\t\\y\203p\007\001,RT-\b\r\232$\243B{\237~]I\265\025\336\004\267\234\222g\373\310\244\030\017\n\350;<\007\277\335(\f)~\006\332\303\307\355\375&0l\343\216!\253Y\277\305\003\005\320-D\330\004\344\225Xa\241"
+	.ascii	"\376m\b\306\233d\250_\305\026\266\2446\336\032\034p\226\002\350"
+	.ascii	"W\240\303\346\371\251@R\213.\377\001"
+	.text
+	.section	.gnu.lto_imuInit.part.0.132.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"u\b"
+	.string	"RO87Po\322\001 [\234w\206 \251\253\337\347[\fv\225\264\327p0\t\353\326y\324\033\261\313dD!\236 \022Dh\320\017\205\343\216K\350|\377\032\320`\327&r\247\024>\230\336\234\033gB\363\030\266/{\3708\204:\216\263}\3316=\006\326:\241\216\223\237D\004G\001!+\270\254\223\332\004\311N\201\275\3176\345\347yS^\266\341\255\325\223\033F\\2TC\025e[\003}\025\220\215pU\310\n\217\026\033\016\f{\264/0\340K\026`1\271l(\t*\312j\335Z=\331\212y\f\220\354~\314\310lIlA\261\237\022\331\327\365\370\024\333\"\020\217l\230\253N\366\253\227\216U\314\356\312G5\371\350\n\255\221\377\324\001J&\3225\300\024rHpK\263\260\273\336\210\334\361\266\023l{l\257\004\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.134.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\345\002\375\025"
+	.string	"Fi\215F\300\332(\035 "
+	.string	"\202\244\n4\032e\213\200\240\f\177\276U\222\214\020\2677\311\237\211vQ\220>@\373\377\372Y\324\326\211\255a\243\376\265\f\004PZ^X\027\300\272\341\351\242s\364\251\207l\344O$\204l\"eJ\001z"
+	.string	"o"
+	.string	"w"
+	.string	"1s\3260\262dN\232\202K\217\300K\233\317x\227\335\013x\227\366\201\330n\255\260\313\306r\032\216I\343\003\314\211\"^\346\234\245\313\275q\327?Ov\253\240\313O\020\243\313l|\375\373\032\324\316\241\312N\227\331\370\342\236\316F\027\227\335M\026&\\fvv\314Dc\t\355D\243LWf4\321\331\3149\177\273\246\030c\252\004\016~\r\346\234>\214\347\216\271m\023\266%\330\373\005\017=\021+\375\314\277}"
+	.string	"P\225\034N\266/\335\036/\330\315\265a\203\267\335\237T{R-;u\327\251w\325z\332\177\001\n\203$4\347N\016\314\244!\233\360\270\355\267\357\023\371\020\377f\221\355\333Z\266\221\025\361\223O\026\363(\266\370\310\3102\347$]z\001\370\332\375Z\313\026\211\254zZ\353?$:\332\034WX\325~\220\013q\375\207\204\003\257\361\344zR.T\341\002\006\f\336\245\334\207\311\3619\347\354F^\267\277\035@\215\375\310\333\355\326z\202'\2469\373P\036%\203\206\r\033\274\313\335\333\254\354u\316\371\332\3551\351\272\342\220+2\375b\337\311\203\374\304\327a\016\016r\220w\251\313"
+	.string	"\206\222\037<0\3151Y\342\016\253\0362\372\265O9\036f\210\364@O\022\202s\302\216\034\t\b_\307\245S\241~v\351\252\020\3052\235D1|p\322\311Q98\351\260X\241\370\201e`u\341\224BY`\251N\2428\302\024\300&\234\021)T\211\365!\007\245\343\241\244BuH\225L\342\252\204C\3430\304I,\261\302P,\351\327F\355G14\005\007\333\330\267=\036\331|\250\310o\265#]\306\346#DI\0077\205\215@\301\265!DP\240\241\037\234\254\363\016\250=\201\202~\366m\347e\b\b.\266/\357of\b\265\2205\236w\025Z\036= \200\002\031+\335\006?\022\204\313\030L\016\372\013"
+	.string	"F\361\363)\232\227BI\216a\342\3726RWa\235co\344\200\231\017Y\32448s\035N\261\375,\006\314#h\373h^\343-W\301\222q\013z\334\256I8~\340\376\363\307\031\273\303.\211\3720\377\265#\261$"
+	.string	";\264pv4/\204,\370\n"
+	.ascii	";5^\340\361\370\274\331\361zI\221\263\206mM\331e\200\324\336"
+	.ascii	"\271 \346\340\243\307\027\234\352\351p\213\265\317\t"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.part.0.136.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\276\003\025\027"
+	.string	"\206i\217J\260\022R:\360\215T\212\022\362B\b\203\216G\264\321\207xAO\356\243\020\205wP\np\333X&M\267}\371\337\372\333\177h\362z\247\335\207\353\225$0\202\t\352\227\254\027\220!&\3165\346C1\357\324\025\202\355\223M\344N)v"
+	.string	"t"
+	.string	"}"
+	.ascii	"0\\\"\325~\264cX.X\177~n\344#\275x\320\366\243\235\327^\275N"
+	.ascii	"\310\257\007\244\326j\340\324\004\\\247'\017@\236\316\247\220"
+	.ascii	"\247\353\033\325\354\322\266\331\345\351]\270\305\245\366c\333"
+	.ascii	"-.6\337\036<\341\003\340\347\241C\214b\255\301\330\351\232\370"
+	.ascii	"\355;\307\233?{@\270\357\207\037\201A\302\022=\232\200B|\242"
+	.ascii	"|l\301\324Z\355\022q\323\333F`\373\200=*\b\271\2315w\310;~\254"
+	.ascii	"+d{\372E\247M\350t\t\235&\271\323]\322\351\021:-B\247]t\272E"
+	.ascii	"\247I:M\351\364H\247\227NO:}\225\361\347{\371j\365\311\032RG"
+	.ascii	"\320'\024O\372\227~\247\257}\277i\350T\273P\307\260]\260\022"
+	.ascii	"\311\370\f\333\205:\257 \352\334\301\342\327S\300u\n\033\237"
+	.ascii	"B\272\\bRR\202\345N\352\216G\212\306\223\016\364\003\013\333"
+	.ascii	"-\256\\\222-uL?F\266\334\211\305#\276&]\221\265ij\346{#\013\343"
+	.ascii	"Y\234kEv\253ZK\256k[B\236Ogs\035Q\255Mp\005\314\311\236\003\007"
+	.ascii	"\271/\343N\272[\305K1\274\307]\255\271\225\335q\005@\361V\350"
+	.ascii	"f\226\347~w\007D\361|:\013\277\0015\367RW\366\315mx\350\252\265"
+	.ascii	"\276\3705\3764\363\211N\255\001g\276\207C\236~\213\202P\021\371"
+	.ascii	"\214\200\001:3;\313Af\232\206e\303\215,\226S\301Fv\201B\f\203"
+	.ascii	"l\346&FC\303\211\261\250x\226\241\206\026\313\231\315h\261\362"
+	.ascii	"c]!\177x\224\371\337\310\327\366\330~\255ar\253\363~\334\035"
+	.ascii	"\262M+\362\371\300T\227\204M\326^pb\020\006&;\247\210*\246v\213"
+	.ascii	"kp,\037\305bn\305v\360++\bAK-\212%k?8\017\017_VT\257\212 !&\006"
+	.ascii	"\252G\314\315,\243L\222\265'\310\314\367J\002I\250q<\345\214"
+	.ascii	"r\002\022\242$A\n\032\r\007\240\002\221\271\252:\021 A\211(\020"
+	.ascii	"\252PaK\333\0010\004\353\"\247\266\327\316\206w\264\232\312U"
+	.ascii	"\265\270\347n\252\225\377\001\bt\017f\213O\305\343\355\013\004"
+	.ascii	"u'v\253\350\370P\310\025/Y7\224\361\327j]i\240\234\013\256+\214"
+	.ascii	"\016\312qq\236\031*\267\026\030\373-\347\331\303\270=\250\030"
+	.ascii	"\310\355\221\2606*T\341\333LUf@r=\324\320\212\255Wr\t\265\034"
+	.ascii	"\021\t\211\327!\302\273\304a\267`]\b\214\212d\252\303\250\325"
+	.ascii	"\253\2731\032\177\211A\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\f\006\265\026"
+	.string	"\006c\200H\260\330I:\220\351\034\217\240\024\332\365\370V*\2443\301\377m\314\235\322\375\035?_\270\177\360\247\211(\322\326\3710\372\362\315g|\202\316\b\2443\006\236\323\217\013\244\031\326\367\350\312/\017\225\365\023\003\302\004>i\233\310-Se"
+	.string	"r"
+	.string	"k"
+	.ascii	"\271>\020\233!\244\243\243~\327\304\035\213\032]\213\026]\007"
+	.ascii	"\375?\305J\203\250\377c\336|\213\016\365\276\250\2428\n\365\216"
+	.ascii	"3\350Y(\320\263\350w?\317A\277#p\0348\bN\345@?\3104\220+\200"
+	.ascii	"\344\323\367\232='\005\374\006\345\177\307\212s\033\364\277\254"
+	.ascii	"\212b\235\361\367\337\003\306~\265\326\312\323\347\232\377\301"
+	.ascii	"\227+\242\210\206\370\016\372\263\200\222\212R\361\004\342<\350"
+	.ascii	"\317$\305\244\223r\212r\202ZzZ\321\363\035[|\270\017\352\241"
+	.ascii	"\337\244C\237\t\207\376\222\r}%\032\372`3C?\t\206G\271\320'b"
+	.ascii	"\341U*\364\272\240\360\261\t\277\302\275^\257'\241?dF\350#\231"
+	.ascii	"\020\372\345\203\376\021\007\357\322\240\3775\031\364\215(\275"
+	.ascii	"\306\202~\221\231dD\277S"
+	.string	"\200K@\024<\033\213fXF\206\f\362B\236\361\200B\316\211\341&\362\246\034@\006(mH\233\232\262f\004 \303\013\0029\034\177@\206!w'\0042X\202<\240\217\227\374\371X\267;&\243\267\025\364q\212\276\225\247\376\024\024})N},\272\276\330\211>\224\246\276\023\246\376\023\023\375\260\245~\257D_\013\211>\227\375?k\255\377\315\210\376\226\247\365\370<,\313\013,\344a\331x\343\375\002o\274Z\277\335XV\346vvx\251\366]WVU6\035\316\301\351 \3318i\277\232-gcP\334\235\030B\246>\033\203$\226\215C\252}\231\272\262\242\325\030W\343\035w\217j\254\264\214\253q\223x\032\313\360dF\030\230YI\343\031ID\343\245\332\255\032\023\343\212\241a\235\021\r'\235\206g3\001r\2501\020\213\301\024)I\222l\254\001\320\002!2j\016\021\220\020&\021D\321H(\001\231v\240\220"
+	.ascii	"\016\202\233#\314]\321\031'\004\340X\037Qj\377<\363jd\240\333"
+	.ascii	"ze\30234\242h\233\301\274\223f\207#`\253 \343\f\224\020\227T"
+	.ascii	"\177$!\323Y\264j/\256\270\235LL_-\363>\201e<\221VB\264\322{\307"
+	.ascii	"tW\236\332S<\252\367\"\357\236\234\366\030\024s\224b\312X_\362"
+	.ascii	"\327\017\031\240\n\301\353\277&\366&S\201;$&N\016.\3138\252a"
+	.ascii	"%\307\2237\031\242\201\201\336\035z\377\330\263\366\024\021\226"
+	.ascii	"5\221P\336\205\310\234\365lWr\235lF6\030U\212\257\363\017c|\222"
+	.ascii	"\202\236\037\215\001\00279\020\237\345\241b\303EV\025"
+	.text
+	.section	.gnu.lto_.refs.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`,\001\025\013"
+	.string	"\326\036N1@k\233\306\230m\323\332U\024EQ\024EQ\024EQ\024\005\036\226TZ\023\214C\266\253/E\373Rh\374\377GD\267\321\343\247\245&\"D\312\224\002:"
+	.string	"A"
+	.string	"C"
+	.ascii	"\221"
+	.string	"2\221\016\371H\214\034e\032\375d\316\007\267\016n3n1n+n-\267\024\267\224\333\211[\211-\304\026\302\266\262}\330:l\033\266k\215l\237\325\261e\326\263}\215\250Y\002\332T;\345C\262\232\3661\3554\255c\332\307\324L7\035\220n\320\220\241\261bh\250\027$\325\302\251\025(,u\302Z\t\247\021N!\254mp\232\261\366\342T\301\251\305Z\212\265\022k\243H\237H\233\025\245(;Q\324\241\242RE\241\206n\340\002\253Y\002\314\200=\312NQ\200\3712\300>1\200m$\226\231\354I\326$\273\344H\343A\314#\2060'\316F\232}x\330JZ\007\245\016\325J\224\256j\035*b\030\003\243l\301\tE\352Xd\276\371d\027\217\314\322\302\204 f\3632\357\275v\205\243\0041\327\332g-\263N\320\b]\366\271\254s\331\273ha\214\020\250\003)\343\b\261\003\215\0233#K#\226V\001\016"
+	.ascii	"\244\233\002\350\332\3322\306\344\354\200\245\213x\017\324b\253"
+	.ascii	"\005,6\333\305\\`\367\264\232U\260wk\231\215\263\032)"
+	.text
+	.section	.gnu.lto_.decls.7cff9ce73ba3c20,"e",@progbits
+	.string	"(\265/\375`\374I-F\001\0323\332yV JQ9\351\024t^\001\207\201;7\374k\261\313\242\204\255\331\306\361\213L\342\342\215\370\260\242\006spXA\3269\016`Bh\344.4\031W\r\265\327\357}_\367\336\252\242\270\216\242$Gu]\313\221\234"
+	.ascii	"~;\272\347{^W\247\2771\367\325\255\t\331[\356\024\245\006\240"
+	.ascii	"\007\250\007N:\355\227\315_\237\254\265\f\re\225`;P\272\260\340"
+	.ascii	"\365\021$nI\232\n\210I(;5I\001\313Y\271\326aMe\225p\370\205\223"
+	.ascii	"\267\020\254\302\302|n\325\252D'\207:t\276\347(+\020\266(r}\337"
+	.ascii	"jpY\223u\223\272l\263^\262\301X\0232"
+	.string	"&\355\005\344$\224\235\272\324\300\314\332\254\305\332\213j\247\313\314j\215\017\025\2625Y\370\276\251\340\367\022\277\317\360\273\f\277\307\360\233\b~k\341\343U\242\363\235\003\277k\340\277\215\200\t\301\262\365\324\267\277\212\272\206\022\2702}\337I\374w\221&\342c\367V\245E\017)\262dH~\304\365}}\203\377\026b\364\003\207L\223X\220\006\262\214\301t\243\201\274\275\332\007n\216\013\253\276\335\243}\324\345\345\372\307}N\312\234\006\344J\022H\337W5xE\3169\327\313\235;{{{{\365r\347\337<\260v\230X\351R\353\322\342\221\252b{\352\373J\246\325/\032\013(\251\314R$\256\362\346\364rV~\003\031\177\003r\022\312PMQ`\\\275\243\267\352\262\265Z\207Yku\325\337\354\331\224\004.\302\310\370P\364\241\236\371\321\344\n\337\327-\270\261\272st\326\033\253c8\211\016\356\343\324X7g\246Z\007"
+	.string	"T\353"
+	.ascii	"L9\"LN\316\373*\207\377\306ae\301Lq\333\322\367\325,\212Ne#c"
+	.ascii	"\316\3376\372\252ot\215\272l\253\246\321.Ht\320V\375\242\241"
+	.ascii	"*\335U\003\226\324\301\313Y\331V]\325T\225\316\353\00329x9+y"
+	.ascii	"\262\210\355E\361\334\3275\374\212\206{FK\325%\006=\245\fj!t"
+	.ascii	"\326\234\364}\035\303\257\030\234vo\257bp\276\312\200_}\340~"
+	.ascii	"j\030uYA\3078\211\016n\223h\231,ge\320O\235\261:r\372\276\352"
+	.ascii	"\300\257\025\234u\257Vp\276Na\243Jt\376\335\242\202 \245\225"
+	.ascii	"\214vj\246\236(`l\334\372\256\251t\200\230\204r.b\207\327M\235"
+	.ascii	"\254\313fj\246\272\327\271\322y\335%s\035>\334(z]Z\316\316U\257"
+	.ascii	"\356TU9\233\322\3675\n\277\262\201s\006lN\255S\345\324e\245\363"
+	.ascii	"W\274\232\367V\346\354\324\246\352\001\2319k\241\001\253tj\234"
+	.ascii	"\252W\351\274>\230b\246"
+	.string	"\350\303\007c\223\036r\360}}\201_\223\270\272\251o\352\262C\235\341\265Les\223I\231\2259\347\240\272\306\253\211\252\357Y`\021\344\\;\234uo\257v8\217\304B\225\350<\021kP\211\316\363\016\003\354D\205\215LM\232\037\257=%Z\232\277\232\251g\252\235\017\316L\025\222\276\177\255{\265\373+\232Z\366\267\326\312\331)\347<A{\311\323\241\327\327\247\016\235\255U\211\316\013\352\320Y\313\214x\255\033:\247\256\224Y-\347\034d\341\254\270\230\323\267\311\314\371h\3710\022\243o}\022\247\206\205\312\022\270'U\276\252\333\233\333\025\035rC\376\372\245v\251c*\227\032\246\202\251^\352\226JW\305\324e\235\373k\226\252\305\251\272\301\261\325'S\312\310\346\252\225\277U:\265\n6%\013^\316\371C\321\207\017\037*\2179f\210Hp[Y\211N\243:t\336\005\374$|\024\277\005\374\037>\007\360Y\300\277"
+	.string	"\376\t\374\024\260\005u\350\374\253\224\2772\251d\265\315>Eie\265\234\225\032\232\f\233\037<\372\376\257j\225\255\256\325(uY\333\376\372\244B\371U\346\334Fv\266c\003'9\314\320\376\006\344\313\031K\026\\\316\371\265\354\037\361\327&\325\254\266U\345\337\200\234\224y\b\017\020'eJ\364r\316E\037>|\370`RM\361\032\302sk\256D\247P\035:_\323\276\001-wp\036|\214\177\342_\374\306\026T\242\363\326\241\363t\225\350\274\262\022\235\270\016\235\366\316Y\240\353\267\f\370\300\337%\354\357\257<W\332\001 \260,x@q\243\202\337\024\361\333\r\277\005\362"
+	.ascii	"\005p\374m\376\215\377\336\371\233\247e(\200\355\200\335\300"
+	.ascii	"\222\377D\277\211\204b7\020\206\3647\nv\005\023:\005\240\377"
+	.ascii	"n\235\320D6\320\0208\341\034~\323\002\277-\301\001\007N\370\320"
+	.ascii	"o\232\340B\367\305\336\237`g0\211~Bg\263\236\360\363\277l\376"
+	.ascii	"Z\200JA\231\357\205\340\370\277a\376Vj\001\374\376\367\312_\367"
+	.ascii	"\032\004\226\205\277\316\371[\204\315@\245\300\312\314\240\035"
+	.ascii	"\320\f\330\300\t\327\360\337\343\3370,\006\350T\021\376V!\201"
+	.ascii	":\302\337U\366\002(\254\360[\020\177=\201\342\267'^t\017R\002"
+	.ascii	"8\210\337\354\360W\236+\177\213 \347?\235\363qj\377\237\363w"
+	.ascii	"\006V\205\337Z\3406\205\337\362\240 dO\260&\374/\372\277\201"
+	.ascii	"&\362\004\374w\004\177=a'\360\367QE\300}\377=\263\030T1%\374"
+	.ascii	"\275\201%\241=p\024\027\372\357\r\016X;\302o\213D\030\200\225"
+	.ascii	"\300_-\b\300\337 l\b\326\304\337\b\260\017\270\207\037\340\267"
+	.ascii	"\021\370+\217\320\t\360_\"\377\321\374\267{\032(Q\324\252\006"
+	.ascii	"5\003\"\247\340\277\302\277r\370\353\004\177\225\340\257C\177"
+	.ascii	"G1o\374"
+	.string	"m\346\357\273\277\325\374m\367\367\231\277\323\374\235\367w\006\354\003\376\306\362w\335\337e\254\003\376\007\375\346\230\277\376{\277/F@\341?\335\177.\377\305\200\371\377\345\377\334\177-\377\275\374\017\363\236\377\232\370\017\345\177\224\377j\377\327n\376\227\002\277m\300oK\374\266\203\337\206\370m\002~k\364\333\016\277%\372\355\320o{~{\376\366\376\366\177\277\371\273\315\337k\376f\373{\311\337a\177\247\3607\221\277\275\376\336\372;\307\337V\177\343\370\373\306\3374\376\226\372;\352\357\030\177\347\277Y\374\255\342\357\343\337!\370[\351o\027\376F\372\373\350\357\026\376\376\300\337\036\370\233\002\177s\340o\r\374\235\201\277/\360\267\005\376\256\300\337$\374-\302\337&\376\006\341o\b\374\355\200\277\031\360\267\002\376\366\340o\016\376\346\371[\304\337\031\374\025\203\277\032\375\225\202\277A\374\215\200\377v\177\025\361\327\004\374\215\301\337\006\370\273"
+	.string	"\177=\361\367"
+	.string	"\376\026\300\337\025\374\315\341\357\r\177\013\375\255\341\377\f\377Q\374\225\347\257B\377O\370\273\347\357\377u\002\177\325\340\257\031\374\365\303_\021\360\327\002\374\225"
+	.ascii	"\177-\372\353\375\253\375\257\346\377\211\377i\376\217\371\337"
+	.ascii	"\366\337\204\377\302\377[\376\013`ooo\357\347\341\360\373\374"
+	.ascii	"~\016X\004\\7\236\322\270\2504<\245q\345\244S\221\244\206\251"
+	.ascii	"\314\225|J\313Y\203\223S2\004-\252\2474\246\254\341)-S\345\026"
+	.ascii	"`\250jVr%\263\223V\326\220\2352SN\323\242\262\340\311\211\213"
+	.ascii	"\352)\215\211J\303S\032\027UN\343\312B\331\211i\n\206S\236\322"
+	.ascii	"\220\323\270\362r\232\026\225\320S\232\026\325S\032\327X-\002"
+	.ascii	"\203L\035\032R\304~\304P\267\236\234\362\f\031XLSBtOJ\255\\\227"
+	.ascii	"sUs\221\2472]\316\004\310\031Kk\252\216\351F\205k\242\233\321"
+	.ascii	"\324\306\244U\2259\347\0162\232\272\264\262\023]\262f\272\247"
+	.ascii	"#Z9\037iJ\3122r\316\231\203\244\222.\003\251tI\036X9\312"
+	.string	"E\316"
+	.ascii	"\310\312\234e\344\234\254\231.\347\234\3149\357La)s\216A\350"
+	.ascii	"\tL\206\214\234\257\212dd\254d\234\213\234[\355\f\034\325SZ\227"
+	.ascii	"\326\210\270'i`\371\2052Y\237\242\2642X\256\343\232\302i\311"
+	.ascii	"\263\034\225s\256l0\030\025\2155}\357\027f\263\346N\252\357}"
+	.ascii	"\332\360%\302\363\306vE\325\367>I\360\025\342\203\345\013\317"
+	.ascii	"\252\357}\272\360\005B$\213\227\261\276\367\271\361\343G\032"
+	.ascii	"-&\036i\372\336gF\217\036Q\302\234\301\213\352z]\336\256&\302"
+	.ascii	"3\345\203\322\244\006/O]\201\350(-oR\372\336\247\005~\035\253"
+	.ascii	"wk\253\301|O9\323H@\231\017\023\276;|\230\254\334\276\364}\017"
+	.ascii	"\034\0357\353\224b\205G\217\276\027K\231\226s\356P\325d\311\221"
+	.ascii	"\353\373\2361\330\013\033^\216\213\243.o\fi1\330&\367\n(\251"
+	.ascii	"\314T'\f >Qt\274"
+	.string	"xq\336{\325s\037\3109\315\315+\b^\337k5\342\367F\003\204\360X\322\327\326\250\313[\303\216!A\231\223@RF\232\210\351\345\251)\020\357i\202\377Kc\214\0179eM}\377;\343\267\352\277Rw\352R\005\231\3212&\331WI\226s\016\362\305\311Ab\243o\245\253D\247\207:t^\031#~g\354\004\331*\023\322\227\202\033\365\013%\006LIS\337\030\276\037vy^\372\276\247\b~5c\212\001\254\t\307uqa\334\247\272\274/\256\023\331}q[l`d\211\025\261 \246.\"@\360}\017\025~\317\013\374\236\026\370=M\370\277I\273\307S\246\nj\315\356\365[\265\253tj7\211\035\235\233m\035;\247.\355\236\205s\033\307\312q\333k\270\256\"\305\210\222)\275n\333k)'\2218\245\335\353+V/\271#eK\311\224^\316\031kI\322\300\301s}\271\022\235u\252\016\235\347\321\202g"
+	.ascii	"Z\342\305J\206\276\347\211\303\235\245\301\364\030{6\205\331"
+	.ascii	"\232\356\360\222X&N\314t\226&\323m\272\214\312\216h\3519#\263"
+	.ascii	"\255\260$zn\366\316\222\345\026g\t(K\206%\321\373\322X\020H\206"
+	.ascii	"%\021\363\362w\226\273\246k\254Jw\225\223y\027\230Q\205%\321"
+	.ascii	"\263v\226\215\305\263y\366\215mc\315X4V\215=c\335\33056"
+	.string	"M]\332;[\344-\327V\032\316\355]\317\261BJ\270\230\232@\027\032\274\234\363\235-\263c<4=\345\\\305\001\223/Y,\031[W\351\2562S\222\0033#aI\364\372\215\275k=;<;\344\316\022\261HJ\270\230\362\315pr\306\315\337o\354]\317\2203\025\007eqaI\364r\316?Vg\244\244x\270\277-s[\007\365\201<\201\006-S;\372\222\030q[\346\024\253\262\005\247\357yx`+\246C\020\217\037Lc\372\236\247\006nb\317\254\022L\204\246\031t6\214\375R\227\026\214\223\005c\321\254\225\022.\246Ph\222\201\007\306z9\027\017MO\231iK\003#p\276\252\356\023\257,;\360\275/\013~\315s\353P\351\274>\220\201\315\214\312\030\236\025\353\304J\361\320\364T\001,mxp\227\003\362\345\314\2456e\t^\234Q\245S\013\001\216\f/g\245\265b\253\\\256\210\030\236\265b\337:"
+	.ascii	"1)\363\324\t\004\210\020,=.v\316^\261[l\026\253\305v\261X\352"
+	.ascii	"\322Z\261r\037\314'K=9\033\356}5\360}2\360}-\3601\035|\334\006"
+	.ascii	"\037\247\301\307c\360\361\226\266\266\344\035\030\251\276\307"
+	.ascii	"Q\326l\224\272\264lv\231f\241\360H\003\306f\325,\224\ri\314p"
+	.ascii	"\301\351Y74m\226\347=\206\201\177\013\345IO\235\262\254:O\354"
+	.ascii	"\022\250\311W\024\217\276\337\311\303\3379\203\277\023\006\177"
+	.ascii	"\207\013\376\255\362\366\354=\367\001s\r\306\226\027}\255\331"
+	.ascii	"\210[e\013\257\250\252\276\030\324\241\363;r\370;p\370;\3131"
+	.ascii	"\273D\f\023\031\203U\005lL,\214Z\256Sr+v5\347\231\244\2258@\354"
+	.ascii	"\021\031\346X\305}\365\375N\r\374\272\264aV\006)G`\264\031\271"
+	.ascii	"\225\001\313'{\360\211\303e\256F\337\273\261`\377}@d\232\274"
+	.ascii	"Q\351\373[\260/ \031`2\327\227-\342{SG\207I\337\357@\341\357"
+	.ascii	"8a\r\352\320\031\004M\331\215'}\177\352\375\260^ui\201\330\344"
+	.ascii	";N\313y\221\005\322tl6\203\007\3042\331\036\225\356J(;\251\241"
+	.ascii	"\203W\237X\251\263\346\274V\226\313\016\214\207\355\262>\352"
+	.ascii	"\322\366\270\355a\233l\024PRC\316>\346\200\365\2602l\r 'e\256"
+	.ascii	":\357\362\0321\275\017=Q=\262\222\370\376\267Zv\253.-\227\335"
+	.ascii	"Q\264A\fVG\245\273R\346* 6\2555bzd\\\366\206\305\341\241\351"
+	.ascii	"\211\204*h\3600\225 U\200\234\367\247\035\376\255\216,\030oa"
+	.ascii	"erX,\036\033WtU\372\376\244\3039^g\030i\261\245\357\317+\370"
+	.ascii	"u\3714\366\352j\256\020.Ve}\177N\301?\331\360O(\370\033\330\032"
+	.ascii	"v\206\245\252tj!\314\251\2614\254\215\272\2645l\225\255a\235"
+	.ascii	"\264\334\341\001}\2051);\357O&\370*q\202\322\305NY\251\374\363"
+	.ascii	"\243&K\356H\337\237F\360\317 \370\247\017\374\337\306\260Pui"
+	.ascii	"\243,\214\"e\316mQ\266\205}\362"
+	.string	"\320\364T\202\2168x9+m\224uj\250\236/\2605bz9+\213>|\330\3411\305,\310yo\312\301\277}\262/p<I\231\2434\257\\\211!\262\264.lR\231\213z\316\304\310j\372\336l\203o\332\341\233a\360M-\370\246\033\256\323{P\270\232\210\365\275\231V\307$\3037\305pUV\242\263\250\016\235W\326\241\363\246\021|3\b>\\\035:\017W\211N6EA4\262\240<\365\275i\003\177\2032}\306\236M\341(?\204\340\365\232\272\354\274F\243f\226\327v}W\351\3242\023\215\013\334(\313$\321\373\211\242'\307\352\274iZM\020\024\221\027B\256\244i\303\277J\352\332LW-\203\b\251\273<\360/U\213\251a\336\304\201\321\367\227\tw\230_4\255\037\313d\325\345\255\357-\034|{\207o\301\340\327U\242\263\271t\227\367\\o\311=\307\201V\316L=\0274'g\246\240Z\007P\353"
+	.ascii	"\356\222\256\257(\347\275\355\202o\341\360\351\352\320y\275J"
+	.ascii	"t\336\266\341\035e%:\257W\207\316\216\353)ui\324T\224A>2l\262"
+	.ascii	"\324\372\336:\301\257Fg\220\321y\373\205o\275\360\361\352\320"
+	.ascii	"y;\003\327\334lk>7d\256\316\364]k%}f\317\246&\020\246M\255\227"
+	.ascii	"\r\245\237t\224\272\354\265F{\007v=\256~\342\260\221&\313\205"
+	.ascii	"\004u6l\234Na\366p\362\254\306\221.2f\2344.T\316M\032(\233\352"
+	.ascii	"r\2762\222`\212\036\332\324O\032?\253Htp\271\017\352\240-\241"
+	.ascii	"\372}\275\326\305MY\337K \207\357\346\224R\"\007\212\214\024"
+	.ascii	"\025\223\032>\206\364\275\004O\360%8{z:\241\236\200\276\266f"
+	.ascii	"\2549c\374\204z\333\252\303\361\243\357\t\343\210\013\027\247"
+	.ascii	"S\025R6\215\201\001\226\363\225Q\217\224/]M\372^\002\257\223"
+	.ascii	"\351d:\235*Z\226\362`\366e\211\025\275\234\257\214X@+\262\346"
+	.ascii	"l\372\351\364\006\345\314\027*\022da\275\233u\364\316\\\335T"
+	.ascii	"e\276\322J\2561\300\016-wK\364\362\023\226\021\222\217\035\\"
+	.ascii	"\314\275\237\231\313\336\022\216\313\234s\223\316\357\333)3f"
+	.ascii	"\013Z\337\023\215\301f\234\233r~\237\231\203\006\232#}OD\207"
+	.ascii	"\177"
+	.ascii	"\023\316\357\363\361\3422\267\246\357\211\264\340\023Q\301\277"
+	.ascii	"\371\306|S\355\212\2249\351A\311\331O\f,\275\030\372\236H\r\377"
+	.ascii	"f\033\263\315\r\322B9w\231\301\345\251+\020\225Lnk\331\367Dc"
+	.ascii	"RnZ1\245\230kF4e\246\"\026\230\031\361\315\311-\251\352\233\327"
+	.ascii	"ml\362\276\364"
+	.string	"=\321\020\374Jv\305\314\202\346\211\026\023\213\207\246'\022\310\316p1\347*\235\327\007I\274\340\215\260N&\0263`gL<\363\316Lc\2421\325\324\245igz1\355\314-uxnv&\235Y\347v\207\227s\346\211\301E\227\005t\257<\215\207\246'\022\232\244\3013\313\230f\352\322\254{\321\006f\235\371\305$\323#\005\314\031<\275\234\225\037:|\370Y#\246.\307y\177\223\314\030\2406\345\0176}M1;W7\266\264\350{\242(\374\233`\352\322\f\203\335\210\305\311\351{7\276\236+A\272\346\372\236\b\006>Q\023>\2077f\027<\006/k\256\3579\340\341s\260\303\347P\006\237\003\030\374\233Y\260\244ii3\207\245\241\272D5\365=\2079lR1\345\202\226\300\371`\353{\263\312\177\337\tA\274\260\365\275Sz\313\027\230\214\2767\343\200\352\212\254\235\365\275\t\307\266\327\006G_\363\r\273\340"
+	.ascii	"\207\001O\226\333\216\034n7\337~\263\254\275\300\260Gg\206\276"
+	.ascii	"\025\315\210\233n=sV\360\314\372\236C\231Iv3\212If\262\031]\345"
+	.ascii	"\252\004\230\305a\201\360\241c\206K\213\276\312+RZd\3645\237"
+	.ascii	"\230j\346\332\357\363Q\211\n\203\325\367\034\220\340\233P\376"
+	.ascii	"\373x\274\300\020A\322\267\353\345N3\355\346\362\367\355\220"
+	.ascii	"M9\255\365=\0070|\023\315t\362\373,\035.T`\364=\007/|\363\354"
+	.ascii	"\277o\004h\266\306\372\232J\354\202\003\016\f|g\320\322\birS"
+	.ascii	"\371\233f}\244\347>\020\225\343\352\256/P\035:\315\262\0217\233"
+	.ascii	"\364\227\332\226-}\177\352\320\371\241=$H\314%ck`g[\024\023\032"
+	.ascii	"c7\2270\031c\347Cl\307\305\021\032K1%f\215\030m\244b\3300vY\276"
+	.ascii	"\314$\327\251mo\f\336\333\327\227\031\206\363\216\215\244\317"
+	.ascii	"\231\245\2166\031n\206\375\334\341\255\351\3655\215\354}\201"
+	.ascii	"\325\3655\301n\235\274\036^\306\f\205a3\210\031\304$r\322\331"
+	.ascii	"j\"&\326\243\334\221\2143\344&\221*\226e\215\217\276\246\220"
+	.ascii	"[\307'\215\231\2252\346S\017671\364\375\220UW\227\351\245\344"
+	.ascii	"\013\214'\314\231\021&?nz\331-nn\334\3645}`13\\t\372\232=x\f"
+	.ascii	"5\341\254,s\253\346\314&\316\007\026\347Fij\335\334\332\263\213"
+	.ascii	"#\353k\3560\317z\304\201\351k\352\br;\253\023\322\367n|\025\211"
+	.ascii	"\333X\224\276\337\220\207\1773\307\353\322\314q\301\212\320r"
+	.ascii	"r\347-\251d\312\210\216\224\267\276\337\220\006\377&\016\023"
+	.ascii	"GCU\264,\305\003#\031\364&I\226\220\276\337\360\305\264a\336"
+	.ascii	"0m\\4\246\225iu\321\2749w\004\221\301[6\351\373\ro\370\033\222"
+	.ascii	"\340\337\244z]\232T&\215\213\226\223@K&Vk\364r\276\002\321cV"
+	.ascii	"Um\372\232U=2\320\360r\364\375\006\036\370\033\262\360o\3160"
+	.ascii	"e\230RW\013'\2470\333\327\020\274\r/\3605\334\231Qf\324E\343"
+	.ascii	"fKC\234\311d2\2311\032\200d\r\314GG\035\0303L\0307c\250\341\021"
+	.ascii	"\223\304G\235\276f\013\363\351\277\257\355\266\220I\322\3677"
+	.ascii	"\237\314\027lo\364\250\364W\320\03075[L\027\246\223M\263\321"
+	.ascii	"%\253\257\331\344;\363\202\203I\337\273\251z`m\206$\373^\003"
+	.ascii	"\0229\227c\346\3169g\260\035,H\306\360*\221((\275\275\233\371"
+	.ascii	"\276i!cH\235\377\276\2379ZVh\352\320\331j\201\344K\017\311M\340"
+	.ascii	"\214\365\275s4\374\320\323\273p|rg>&mw4\340\374\355J\310T\337"
+	.ascii	"k\270\201\337X\365\272\371Itp\333\3347\215\365AS\316:\274N*\032"
+	.ascii	"\240\360\205\350`6l\316\270\274s\315\205\2208}/\004\346\356w"
+	.ascii	"7\357u*\206\263,\016(\356\212\020:\274\337\274\252\327\001(\032"
+	.ascii	"\227\373\357\2736\342\230t\351{!7\374\3374i\256\026\t\231\251"
+	.ascii	"\352\002&TJ\020\027\n3c\346\242\231\341T\262\2653g%\206\313\231"
+	.ascii	"_4@drxp\372\336\315\325\372\357\373\311\005\321\353{\241,\374"
+	.ascii	";\246\3362e\272J\235\302O\2344\301\313SX@\354\250\315U\275\351"
+	.ascii	"{\241*\374\332U\316\203\250W\214\230\313\221 \201.\263\323G\217"
+	.ascii	"=\266\276\027r\001\006L\003\261O9S]"
+	.string	"\240\304\353\312\225=:\272{$/\316\027d\tY\227\276\017*\203\3371\324;7\327XU\231\2458\214%\261\200\360I\202\206\354M\337\007Y\301\377\345\302\245\355\r\377W\313\353\362j\271C\316\251\023\302\274\005a\301r\203\23093]]`f\004\337u\r1\353\373 \"\230\n\225k\005\347,_\360\2347]zr\277V\272N\316V\\\337[\245\251\262\326\304l\364\275\233\206\372\3573\273\336\330\275\365}\220\226\333\215s\273poo\027\256\346)7;TISM\253*G_8\237\221\260\256\250\276\017J\342\003m\211r\333\242\334#g\316U\251%5\225\257\246\214\330\330\356\021\234\3149\251\314RE]\256\214j\016\031\264\210\365=\020\025|\2404\374_\265\237D\007uy\325\032\252H+\271\306\0023#\346\233\223\033F\372\036h\f\377\246\325\373\344\311\337\352\224\004/\234H\301\003\n\202\377\366\277\013P\273\314"
+	.string	"\303L_'\313\353\344\0261\312\271\252\001fTW x\330\264}\345\276\007\332\302\377=[\336\263\2462\322bb\272@\311\331\232*\275\234\261\200\300]Xt\264\350\373\237<3\263\016\306\222?\\\312\312.W\2470\224&6\2745\374_&\313\313\344o$\344\026g%\306\266\222\210\211\335\261\013\345\234\233r\326\201u\346\030\223\273H\316\224\031\351\373\037\033\370\277I\2267IM\343{\312\231\252\004\223\274\f\342?S\370\327\310\225\3417\3547\354\036\2519\347|\225\223y\034\304\2355\021\323\313WSF\377\335\374\0361\301\034)\022\245\357}f\300\377\353\373?3\323T\316\271\312T\346\251&\237\363\257\257f\255F\377O\265\225"
+	.ascii	"\377o\316W@1\347&7\261\234sm\203\303\336\230rX\220M"
+	.string	"\272\234\235\270\222\037pQ9\005)\2608LaR\360\244\020\"R\364\204\021]!T\022\200\013\301\342\220\210\344\340B\2608|R\210\nX$\245C J\302\261\204\343\021\270\244T\f\n\035w\236\024b\202TH\024\3766\034\211@\341\021P\205\"\212#\212\032\221\320#!\236\341\020I$\026\211;\307\024\271\364#\n\323\241\020\331\302\357\007tL\221K\227\004\021\230\002}\216\305 \260gE\321\270\264\004\374\021\205G\236'\2058\016\207\300`R\nT\022\361B\321\230\224\026\211;)\200\350\360\246Gb1h\246H\211B\343\360D\221\200FT\005\b\301 \220\207\305R\321\004P\372\244\020HK\"\220\226\206\202D\244\b=\304\024m\036\177HK>\351\217\210\264d\022\221\226,\n\203\360xY,\025\203\327\230.\331\377\2600\246G!\022\252\302o\303\021\272s\204\036\221\367\270s`\n<J\321#j\374!-\205"
+	.ascii	"\372\241)p\270\244\204\242@Z\352\300\342\250\030\201\"\212\244"
+	.ascii	"\324\b\224\300\005\224\214\305\024G\"\320\210B"
+	.string	"\204p\270$L\207H\023(\360\220\002\221\026\330\300B\n*\234@*\t5\004\203@\213D\024*\031\201=\032\212\322\223hD\bTI\210b\005\023J\230@I\230\036%`\002\251$\254\200\205\024TP*\032E\240 E\221~\322\241\020\305\261h\"E\221\202z4\bq$\374\201A8\004\nS!\261\204\243!\262\230t\004@\212\216\200T\022\016\2418\"\213B\025\250q\t"
+	.string	" \024\215,F RB\236@\225\204(\202A OJD\026M\364(!O\004\203\300S\ty\"E\217\250\nH%\341\004HD\341\021\020%\341D\n#\240\307\025\210\300\240P0\b\374\005S\234BJhzdq\342'\204\032\221>\001@O\240@\202\005\220JB\003\354h\020\"5\002\227B\244Bb\tH%!P\nL\217<\0328\002\005\177F\021A\001\034\221\200C\021\320\243\242\tA\034P\344\020x\001t\b\f\236H7\030\215E\023\3500M\213\306$\024h\n\034\"\203C`\320\202\024h\202\361\256\020\032S\240\tiQ\0054E.)\025=(4\242D\024\t\237\003\0172\360\240\304\212\235\227X\200\006\013\320\340|\211\005\214\030\261"
+	.string	"\017F\340{0\302\246Gt\210D\004\301\210\016\221\022 JS\0245\2468\002\242I8\0045E\217)R\024\317\024B\320\351\357\270\002\252$Lq\3723\246)p\350A\027\202\305\n \225\204?)\320\243\337/\rzR\210cR\nT\022A,*)\025\203"
+	.ascii	"\320@5\026\323 \252\342\267\224\302\227\201\312B}R\b#:D\tp\374"
+	.ascii	"\005\203@3}R\b\003\030\321\341P\230\342L\203~;O\n\221\006\221"
+	.ascii	"\306\364H\342\370[\201\246H%\r.\004\213\303\337\357L\211\310"
+	.ascii	"b\360\367\3331\242\304\027\212\277\337\316\321\210\036\221\304"
+	.ascii	"\337\017\037\021\205.\374~\347\221(\\:\376~;C\364\367\363\245"
+	.ascii	"\277\364(\034\n=)\304\021]b\221fp\204\032\201I\307\fD\034Sa\013"
+	.ascii	"\"\220D\244"
+	.string	"\fV \211\302a\006\034x\360\363\240\304\n\021\350\021r\030$\nE\030\217H\021\nHW\240\304!\220hDS\242\360w\004D\215I\351\322\3577\201\n\324\270\364\373\235\351Q8\374\375N`\n<\372\375N\024\006\341\361\367;]\b\026\2077\210\032\177<\251\220X\002Q\204TH\024\236\3064\205 \021)\302\021\020U!\030\004\201\303\361\247\002\r!\030\004b\242\bG@\324x\246\307\237p\351D\n4\004t\211\005\212_\t)\234\350A\203D`z$\nq\372C\241\204K\024\246@<\006O\341\322\321\036\177&H\224\320c\202D\t\2763HBh\237\024\342\210l\241\303\361g\302\221\220\021M\217@\245\363xD\215GG\300\035T\005px\002\271\244\204\221?\025\350\321\021\331\002>\376\320\240P\005\032\302\021\331B\017\372C\227X\2408\"[\360\241K,\322#\262\205\235#\262\005;\302\210_0\b<_"
+	.string	"\252`\"\004\020\316\364I!\220KJ\277\242\221\005R0\b\024q4\242*\204\306#\004\240?\0254\350@\003\017\220KJCG\324\310s\374q@O \227\224z\316t\210<\242*\020\213\3024\210\246h\b\310%\245\r\350\217\210$\034\002\177\306\342\221\210\036\201\210H\302!\b\301 \020\2638\002\242*"
+	.string	"S\340\221\317xL\361KB\022&\375\202A\240\217\021\230\024\274\350Q\321\004\261(<\nU\240F\037\025\350\221M\177$6\030\002U\030\321\224X\002\022Q8\\R\002\236\b\006\201C&B"
+	.string	"!\030\004\236h\220\210Bz\004\242\025HA8BS\340\321\322\nC4\030\004\341(\354p\374\001S`\b\304\2420E\016\213'\216KH\032\322'\2058.!\211(\n9(\231H\207@\363\370#\026\205)0X\254\300q\t\351'\005\016-\2618\264I\303\241=B\321\245\023=\350\321\210,\2328\"\"\213F$\237\245\342Q\322M\201'\224\220\304\363\230\006\221GEc\n\033\210E!\321\210\246@d\bx\322\037\211\rR\242p\007U\022\246D\244\nH%\341\206a\261\030\201\237y\374!\tS\020\213&\220J\302\236%$\026\272\360S\n\036\235\350\020\211\b\374\r\207@\245cO\372+\221\022\205\310\035\364\b\231\n\323\024\370K\217\300\024?/"
+	.string	"\215v8,\032oR0\025.\231\351\317\203\021)Q\270\363\002\220\205=\242\310!P\305\371\302\013\275\342\205f\361B\303\360B\257X\321,V4\f+\232\005\213\206\201E\303"
+	.ascii	"C?\251\350\305%\324(\"-\026\215\"z>b\204\t\013V8a\004\034\f\201"
+	.ascii	"T\022\212H\223\220\204\303\024\"\210B\240\222\210\240\361(\""
+	.ascii	"\304\004/\324\025\225E\205\241\376?\277\220}A\331\341\245\351"
+	.ascii	"\356XPW\221\2627/4\224XV\246\314\231a6\315\013\031\332\272 \331"
+	.ascii	"\211\212\221\246d\371\267s\313\031X\316Y\310\347L\033)j}_\244"
+	.ascii	"\005\377\247\0264g\2355\313\270,\027\354\253\312S\023\0263\206"
+	.ascii	"y\325\303\251\314\025\223F\016\023s\244\357\353\362\264\002\027"
+	.ascii	"\2015Q=\344\206\004\325i\365\210\252r\265\270\240\315\261B\345"
+	.ascii	"\026\371\240\347\003My\004\212\030\231\270\374D\317\255\n\356"
+	.ascii	"\204\nc\022\333;\337\232\352F\0139l}\317\266S\312O\267\237n}"
+	.ascii	"\272\331\275\275\263L\f\224\223\255\253\34055tPQN\257\037\033"
+	.ascii	"vU\346\326\356\221\273\206\303\253K\315\211gm/\317\356\204r\342"
+	.ascii	"\300\242F\257\257\224\224\020\255\345\357\22046d|\364U\366\300"
+	.ascii	"\351X\253\321\367T\236\312\023-\257D\026\252\032F\377y\366\023"
+	.ascii	"\355\255'K\2267\"Me\026v\345\243\357\213\232\340\3774\273A\212"
+	.ascii	"\250\261a\326\304d\253gPS\364\372.Yr\222\025\305\205\351\262"
+	.ascii	"\032\3127\266N&?\311\344\274\211\202\244\250I\311O1%'\222\212"
+	.ascii	"\226\245v\214,\211#&\226\237\256\214\332\r\223\030O\324\200\375"
+	.ascii	"4\002v\"\271\021\204\310\0263Y2\374D\362\363HP"
+	.string	"\2263\250\034a'\217)8Tv[\212\374E.\\E\313R#\230\344\304\021\013\nB\306\206K\337O0$H\220s\b\207\270\344\232*\273\004\006\231\035\247\220\237C\334,\351\232\234sRs\342\364\375\004<r\374\314\312qz\335:e\035X;4\264\304\021\323\313OWFAZ|\264\355\365\370\351\365\363\007\211\016.w%9#J\337\237>x\302z\244)\351\373\f\320\254\250\250\372\236['\017\254,sr\3608\273t\364\230\301e\305d\323\311\233\2740\\\247\026\023\035`i\264\316\035L_\312\306.V\207\035\263,\250\334W\307;\374\220\311[\242\351{b\371\252^|\301\365\275\225\352j\001\007\347\306\215\023G\026\023o+\204\315\250\323\321CrL\252\304 \020\345\024b\310\241\022\242\222\026\003\303\024@ HL\034\226\017\330\305=\023\300\002\314k\225\221\234e\231c\204FDD\222\024$\225v\003\224)"
+	.string	"\254\t\3243\201\332\312\244\231\310\340\252?\230\032\250T?\332\t\346J\210R\306\375X\006\352\"\252x\3462\321\326\215\377"
+	.string	"o\236\323\222K\036|\235\177\202\225\345\2429.\220_R\n\035JA\230\231\256\377x3/`\312\276VV\246340m\306\237;\353\3733w \314"
+	.ascii	"\370H\0240,I\004\203\210Y`\260\211\033\337\034Gl\366\337C\316"
+	.ascii	"4\216\374\263:\t\322i\302\331g\361L\377\271V\211\3304\302"
+	.ascii	"\021\302_88H\355\236\344&\242\216\305Q\341\317\310\234\017\023"
+	.ascii	"\007\255:\212\331\f\3470\344\302D\31121\370\363\306\210\t\365"
+	.ascii	"\205\347\211"
+	.string	"@v\306+D\222(\262\335\342w\245\022L\311F\256\325\210\313\350q\350\376\243z\246I\234\004\226\306v\304\001\367-\257*o\rAa[\036\336<\233\314\274\231\210k\230\364c\003.\365`\322`\327R\r\013F\245\303\251\326J\314\366\374\013:\027\006\353\263\352\311\320\330\252mD\300\312%_\3760\334JE`\026pk3\206\330\024\332WS\355\243\365\253\226\f\327\264\320$\372\310\245\3119Y \020\243QP\\\344\217\247~F\230\313\355-MS49:\332\314\3032KC\302\031\2521\325.\357\206~^\216l*B\334\032\207T\273IA=\235\335\225\355\2024 \274\214\035pIt!P\365\202\311\t\231\347\207\307\264\004m_,\204\354~_K*\244\240\315\027q\341\330\2158\304<Y\372cH\013\370/\345\327\301^\371\017\366\232*\032\264ty\333r\3126\213;\f\\\235\326DM\201;\304\210v\3327"
+	.string	"\357\241lU\201\016\332\003\253\220 \371*0\300$q\301\206\233O\224\227\031\304\3615\031\231\364T\320\233\212\355\202\025{\304\323\276J\245o\212\031=\235M_S\210E\374W\373\177=.\255\025{\326\347\020\254\313u!\332H\031`C.\227\342\025`J=\230\"\355+C\257\371\260\0178<\210W\266#\377<\277\200\336n\300C\036\nr\365Fq\222\342\031%\017\214\f\360\333|\243\336\250\362\344\037~\305"
+	.string	"\240\2345\352^\003\2224\362l@X|#\234\035\002\3529%\003\032*I \347\253\331\034\035\311\3275\223\331G\002\323Rk'\270\310\016M\241M\n\265\303=\305\225\035\b\023:\340\034X\036\272\367\255]\273\263\024\306; \335\215\013'\024\252]-\035\206<\220YH\331X\356\n\035\n5\350K\373\t\030\024S\222{\032\n+P\304\307ro2\024gU\022\031\373\036\240\033{\342\377\376\334]-\027\257V\222\323\036p\346%\345\301\275\024\245\032\262\005k\006\004x\214x\0313[J\343\026\302"
+	.ascii	"\254\206\352\205K'\"\352\201\322\240vE\256o\\:O\321\312\346F"
+	.ascii	"o\036\242*\372\331\273i\360\313\302\211?-=\337V/\264\322\337"
+	.ascii	"\266\b\271K\023\203\032\004k\330\177Od`"
+	.string	"\t\355\375\204.\034\324G,\342c\230\324\002\233\353?\031\201\325\343T\333BLC\001\326\246N[\2122\223S\037\r\22045k\351*\177\013\262\332\252\305\220]\352\273\237\fyg\273\367\216\\&\366\261&Lvc\220\177\346\367\013\237\343\206YT\201Sg\316\346\225C\262\271\003\273[}!\342\b\361H\250\254\332NG\212O$\314bC\312\362\334\331\302\330E\200\364\216\323\013\320i\365\221\223\036SZY\255\312ea{\354Y\203m\367\362\330a}\177\364\033?\r\235Sy\212\377u\255 \020\331Rk\236\2658\030\215i\303R|\3222Eu6\373{\340\375:\316\201\344\273\006\017\025\203I\260$:\261\205\312E\335\2603i#\236\246\341R\013j\210\2558]uS&oPd\033\266\002-\001\020\251G\366\216\301uR\252\270\265F\302I\035\177\352\325\013Q\007:^\025`\272\207X%\351\340\357\213S\253\365"
+	.string	"\365\375\354\313\250\356\367\314\357\002>\270\006\220s\030\024\266\217\347 \271\017i\022L\n\326\204P\200\006\212\232 rj\263\354\026\022\336\256:w\225I\201\033x\217\327\376X\027\341>\201\262RV\225 [\373\260<\321\362o\374\341\346\337\303\243bNI\0247\177\217\3760\330M\272[/J\205u\271\353\340j\301\\\357u\203\272pi\374\331\272\030&_)\350\352\023\366\251?\214!\332\267\270\244\322w\301\004\374\316d\254#_\373$?E\257\261b\303\241x.\221Y\"I\017R"
+	.string	"\253\006\245\212\230\226^\032\212\325\302\354\237\224\374G;01\321\240\215K6\013\346\317'\264.Y\303\342z\307\003\347\250H\177\234\203\r\361J\254\353\324\300\231\312iDuPj\327\303\357\212\301xp\273\362\027\215\310@\f\201C\013kx\255\033] \211\\\211PmUB~\210\237\352\360\203\025xu\374\260n=\177\206\320\342\306\256\224l\222\033:\206\340/5\013\031\021.\003\261N%\353A\212K\267\b\375\251[)\210\312h\260[\367[h\t\035@:Ca]d+\307Lf\206R\311\025L\344\032\177\356\222]\375#\217\215\336\367\334Y\030Y\225%\244\357\024\210\232v\360\311\3276\226\240\327P\026\213pw\004*\306"
+	.ascii	"\221\001B@x\210z\001\237\346\262&\266\343\365\350i>\263\005b"
+	.ascii	"\200\022\377{\361+\220n\016\245\3273x\265_59\310\314\325\366"
+	.ascii	"\021\205\376+\223`P\231N\266\233\002L\2643\024t\361\021\025m"
+	.ascii	"\3059\031T;\327\2129\276\353xO{\211\335!\233\342\204\372(\200"
+	.ascii	"\225\212\336\362p\375\033E\276\223R\220\232wH\032\300[Y\326\021"
+	.ascii	")\343s}@\376\207\004\227\277\013\347\373\003\263\233\306\337"
+	.ascii	"\256d\333\366..G\022\241`\237\217\217\3414\354\372JH\316\034"
+	.ascii	"\320\331\006t\266"
+	.string	"!\372\320\376\275\352\004\322\373\216\030$>\0020q\213\223\016\317\374\375s\345\243Z\336\304\207\327\\\312\317\311\027\231\356H\267&\202\262\274\026\023Gb\264#\245\001l\272\2342\032Z\306\332\204\034\241\376\363\247:\242\b\254\036N\204,\r\364+\224f\236}u\\\244\232\022\331D\211\202\244O\022\002\372\030dJ\031\b\334\352\t:\222\274\221p`\3351\255\226\270\200\323\302\242<\271\237\033<\345\350\272\366\357\244\246\177\207\321H\017\227:\311\006\206\031\367l\332\271\336\306\363~\247\315\235fk\t\032<\005\374qp[\215\200\177\213\212N\tf\\KOo\345\\\221?\311\236y\230\205v8\203\035$c\346\305N\3735\024\032\331\216s\323\206_\366\034\3230\320>4$\302\203)\n7\265\255?\022_\n\227F\317\374`\222\245\266[Y\\\325\216K\343/\245\350J\245\235\025\217Ck\2114\305E6\246A\372\263\367g"
+	.string	"\205\352\330x\205\303\313\202\f\255\033\301\320\036\002\347%\272\261\371UL\377\346\325<\007\020\224#\267Q#\230\202L\320\013B\230\300J\232\337\023A\006\r\177\264\215{z7\301\332\310\251\\\360z\376\311\202\352\237\224\254\233\300\345\2621\215\336\003\034\020\035\330V\343Ir\274\"\250/\f\253"
+	.ascii	"\353\3243[}\224\020\337\352sw\024\242\236\250\263\227\345!1 "
+	.ascii	"&\006\305t\373^7\037R\364\021\002.\247}`\326K\253G\237H<b\306"
+	.ascii	"L\032\313\001\261\254Z%\026\273\001\003\rB\255\020-\334F\332"
+	.ascii	"/v\337.X\364\020k\207\035\251\016E\217\f\"\365\244\033\365\276"
+	.ascii	"\313c\215\344M\016\201\274\3167M\251\020\347ka#\233\321\367\237"
+	.ascii	"\205k\204\007\217h\216\346\030\023\261\244\377\266\274\232Y\026"
+	.ascii	"\253<\305\220\234\346\240=C\003\002\200\336\240\222qX+o \376"
+	.ascii	"\352b\334\360\242\361J\257\324F*q\020\300\216\245\022u\376\265"
+	.ascii	"\251\205S~\301\263\274\232\\\026\232\257\3603\300a \352\370|"
+	.ascii	"N H\022\t4\310\243\323=ocDw\330\242\370\237\240^aJ\241\343\005"
+	.ascii	"=\t\264\177\027\030\377c\0135\232\244&%\205M\037\3034[\217\302"
+	.ascii	"Q\020\262c\320A\006\036\036\270\313\275\371o\033O\327\340\017"
+	.string	"\3510\314?7\217O\260\223F-H\267\3760\363\321\206\333\241P\n`\314\0373\302"
+	.ascii	"\317\372X/a[C\255$\337g0\326\240\204o\355\350\371\304[\002\310"
+	.ascii	"Ol;\343\262+\363w\255\350\263\372\227\2553\004qnJ\346\250\274"
+	.ascii	"m}/\352\373=\276\277e\007\360z\322x\262\376\037\260y\226{\b\340"
+	.ascii	"\203$\261t\205W@"
+	.string	">|\336\b\210{\330/\334\003@G\310\336\201v\037+\3777\347\276@\3336[>l\206r\333\341\007?\322[\220\231\357\017\370\366\0360\254'\271\367#\351W\347h\331\242\177\352r\340\313\347\235\tm\302\356F\204\216q\315i\243\177\273w\232\372@(\317\013\376V#\376\204\375H\345\023\261_I\326[\rF\365\377Hp%\371h\332\377\360\342{\300kj\234\262\310\317\233\332*\226\247\202\006\3626\020\333\336?I\260\247\240/\215\274(u\240C\247A\277\245#>\003\016\210\275X\336\202\036\227\372:A\304\274k|\220N\003\271\263(\226\3400\005\251\375\034\330\b\356\357x\366\317R\233*\203_\270\353]\032f9x!Xn\336\353\242\3467\255^\335\216\027\024\376\200\310m&g2\232\267\312\255R\360y\266\rD\366\336}0\313\373\325\267~x\241\357\261\315\377\232\267\217\370\341\376\273\333\346\016?\"\347\243\360"
+	.string	"\377\361\016wm\371MrX2\013"
+	.ascii	"\366K\307\225\276b0\345\365\346\323a\3051\320Q\034\276\333\233"
+	.ascii	"6\232\035\013S\344i\023e\017\314\205\301\017f\256t6\241\277c"
+	.ascii	"r\315\334\274O\232u\247b_\241ot'%\b\007A\336\026\213\311C\276"
+	.ascii	"\007E?\032\264\361IGrW"
+	.text
+	.section	.gnu.lto_.symtab.7cff9ce73ba3c20,"e",@progbits
+	.string	"headfree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"offset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"canUseGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"imuUpdateGyroAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"imuGetAttitudeAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"shouldInitializeGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"getQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"imuComputeQuaternionFromRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"imuQuaternionComputeProducts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"imuQuaternionMultiplication"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7cff9ce73ba3c20,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
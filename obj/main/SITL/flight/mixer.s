@@ -0,0 +1,2918 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\001\005\315\027"
+	.string	"\364\037\365\005"
+	.string	"S"
+	.string	"\336\245\364\243\013\022\002"
+	.string	"\002\001\002\002\001\311\343\266\330\b\242\002\002"
+	.string	"\002\003\002"
+	.string	"\002"
+	.string	"\002\002\002\004\004\002\005\002\006\002\005\007\002\007\002\b\002\b\006\t\002\t\004\352\263\360\321\b\007\240\342\234\212\n\b\t\n\013\f\r\016\017\020\021\022\023\024\324\317\204\363\013\034\002\n\002\013\002\005\002\f\002\r\005\002\r\002\002\002\025\026\027\030\031\032\033\367\347\202\353\017$\016\005\002\017\002\017\005\002\r\034\035\313\206\250;\r\002\002\002\036\215\260\277\341\007\004\037\224\257\304\213\n \352\200\375\305\017\b\002\b!\353\252\315\223\t\"#\277\364\311\272\003`\002\020\002\020\002\002\002\021"
+	.string	"\002\021\002\005\002\022\023\002\023\002\002\002\024\025\002\026\r\002\r&*+.\350\300\306\254\005\002/\354\206\342\366\0060\260\216\270\207\0061\333\207\312\212\004\0022\226\214\355\205\002&\027\005\002\00534\332\201\320\271\005\0045\273\355\313\341\006\n\002\030\002\f\0056\323\225\374\231\n*\031\002\031\002\002\032\002\033\002\032\034\002\03478\322\245\257\357\0059\220\236\340\376\004\n\016\002\016\032:\203\341\306\354\b\r;\316\313\323\260\017"
+	.string	"<\374\314\200\371\n=\322\221\266\371>\214\311\266\207\016\006\002\002\024?\236\221\316\247\001@\314\346\201\343\002\002\002\b\002\bA\375\242\215\341\f"
+	.string	"B\231\357\216\353\007"
+	.string	"C\262\306\244\375\002"
+	.string	"D\256\330\276\211\r\002EF\316\317\221\317\017G\216\205\223\310\017H\314\311\255\300\001I\235\206\367\317\002J\206\270\257\235\016K\222\254\341\316\003L\221\260\327\363\002M\207\254\251\246\016N\325\233\244\265\013O\334\356\363\332\tP\335\372\220\202\003Q\247\327\342\262\fR\254\275\261iS\321\256\205\311\017T\251\323\316\250\fU\201\340\323\240\001V\204\206\332\243\016W\322\222\235\355\fXY\241\214\237\207\013Z[\312\246\347\201\003\\\274\227\252\360\b]\240\342\234\212\n"
+	.ascii	"\200\210\250\261\271\240\214\314I\222$[k\220\202\242\031\242"
+	.ascii	"n\022\300\343R\214;5\025'i\212R\330\217\003\027\210\355`\316"
+	.ascii	"\224\024\257I\312i\r\b\222\320\025\364\310>?-\351\236\2751\226"
+	.ascii	"P%q\204em\025\360m\025\2466\374D\361\005B\023\305\334\337M'C"
+	.ascii	"[\276;<\013N\241\224\272\033\005\207\350\371\243Yd\021,\022\355"
+	.ascii	"\316D\237)\212\325\007%\311\267\002*RT\030k\245'\327[\3558U\225"
+	.ascii	"\377zgd>\356|\261Kb\303-\275\311\313\025\266s\363G)\374\007v"
+	.ascii	"mE\340z\007\320\223t|\t\204\260\331\355\005+\240\337Zs\b$$\251"
+	.ascii	"\0161\256\212\314q,\317u&\206\276*\364\2039\227\362O\227\345"
+	.ascii	"\\\312\177\221P\363 D\326\314\0027\354Z\177oT\344\201\263\207"
+	.ascii	"\316%\330t\364\225\003\201\373m\f\224\321f\204\\y\266\227r@\230"
+	.ascii	"\332\030SF\034w\361"
+	.text
+	.section	.gnu.lto_.ipa_sra.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\275\004"
+	.ascii	"\342\305\021\032`m\322\0010\f\3030@\202\300W\2026\350Q\341\334"
+	.ascii	"\350\336O\205\001\224;\245N\311\021\310\316\307\351\035\333\030"
+	.ascii	"c\261B\023\2138\254a\013\023\006SP\316\300\004\314\350\272\240"
+	.ascii	"\375z\234}2\223ZkQE\327m<\005# \200\002);\363\020\202\222f5\340"
+	.ascii	"EJ\2406\300\312\242\006\033\367\307\205\223\336.\3434\365\271"
+	.ascii	"\0036S\337<\246\030q\200g\2156\274\004\27566@S`A\366\226\361"
+	.ascii	"\362%Nl\330V\245(\240/\"\221\003\036\001u\004\"p\001\206"
+	.text
+	.section	.gnu.lto_.inline.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\177\005\315\026"
+	.string	"V\335mJ\320\262*\035\223\321\025#KV!"
+	.string	"E\360\333_\235\366\231\250,\207pN>x4\321\364\265y\202^\213\274\270\233(s\225\253\305\305V\264\222NFr5\036Pg\357n\307\335\355\200\372n\201Df\361\255\201D\r$\022)e\nT"
+	.string	"]"
+	.string	"Z"
+	.string	"\0368\367\373a9\316\t\354\367)\264\216\377\213k\277\226sK\2748\207e\267r\341I\366?\331\"<\332\025\327Za#\220_\r\220m\374\267\213ug\013nm\337\247\320\237$\362\331d\036\254\347\307\310\337\342\0321\227\034\002\370\337\027\357b.:H\376\362#\2107f\354\r\312\200\252\177jA1\306U\007A\203\204\243\222w\367\315\352\236\02486LG\2117Y\305\007g\303*p\275a\200\376_\302\373}\321\343\2613\362S\nm5\r\327\033\222)\n\037]\351\245l\374]<\363\02233\331\274\304\314\310\227,\331+\302\"\306\037\205{\360\360\214\330X4@)\035\314\321"
+	.string	"}\346\020\\MKk:e\333\322\232\216\351\017j\227X,\334\261\302\004y\007\254\206\251\265vh1\257\326\332\340\fN"
+	.string	"|\201\312\370\237\204L\036\326\n\023]A'\370\257b^5\002\376I\242\030\272XiT]\013\2769\361\256\311x\342\017\313o\224\226\001#o\016\273\241\324\220\362\0270C\236!\304~[|\253\301\261B\272I\355\3211\344\234\276\264\344\343\364\245\243_h\0267\340\2554\371\004\360\0264\335\202\212\033\255\360\024\272\242S\340}\302\177T\226\006\311\206\221\245A\321%\234>\027\264QF\246\316\016\240\326\325\276\035\022\273\001\217\320\277\\\200\203\250\001A\246\b\215\tM\013\n\205a\f\200\242\22122\017\022"
+	.ascii	"\024=\307\222\316Xe\212hA\222j\375\016x\307h\351G[\315\332=%"
+	.ascii	"\236!\361\0021F\244\t\353\2343CD1\260E\327\247\357\244\267\f"
+	.ascii	"\312n\270\245\002>\2471\336\3734\206\356r6z\212\321)\023\301"
+	.ascii	"tLZ\325a\271\006\345\213\202\036\264\250\346\331S\212\271\303"
+	.ascii	"\304\245*:\267\035\004U\237\021\t\fU+\247;6|(>\331\201\317\207"
+	.ascii	"SZ\345\311U\3061\275\3070\325\344\345\345\200}\\\2679\001\342"
+	.ascii	"%\263\367\365oy\267%\"\355\f\376\206/\227\323u\370,\266SjL]v"
+	.ascii	"\374uc\213\371-W\262\213k\226kl2\350\200l\001\2345\240\237\232"
+	.ascii	"\262F\303\220\221&\017.\362\2373\311\202\320\024\027\223\356"
+	.ascii	"\022q0\373\247\345\314\0177AC\212)\022\317)\332\024\321\220\253"
+	.ascii	"&\211%\276\204\371A\230\231\233\022\301\b\360b\254T\005|\336"
+	.ascii	"\243\323\353\335\361\f3/\251r\361\240\244i\227\3112\272\025\314"
+	.ascii	"%l+\236\013\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\027\002\265\013"
+	.string	"\246\22186P\245&\35103S[y\331'*&\314\"\236\331\220133\331\001W\220\231\231\031\007k\232\246i\202\213\342\223\320\007_\212\315\256)\343}\327\223o\022\344K\231\002("
+	.string	"+"
+	.string	"*"
+	.string	"\345\007\372\005\224EY\274\222\326f2<\223\326^\261B\251M\251\225\0252\317d\036F\346\341\214\327ie\354Q\310\247)P\325\006X\300\372H\304\262B\252\017\326\251WQ/i(\200\354\274\205Rc\207\375\364\222e\303\362\022\365\bz\027\262\006\f@\005n\330\023Q\217\222\370\210\207\370\204\007\316;\374\r\317\360\013\177$@\016 \001\260\035\2039\362HZ9H\021J\371r]\327u\214i\002\277\007\325\361\304\361\301F_\323\210\254\306\307\246\262\352Ad3\036c\272\230\027\364\201>\274\023\213\217\034\016o\244U\374S|? 0\002b\220u= c\335\320\265\267,\231A\034$\323E$\2330\256X\n\264\262\t\371\214\3308]\320(\245\006GsaO\313\260\337\351A\274\257\333XZ\347V\242\006\342\303\240n\256\267\335rc3\330P.\003\333\376\311"
+	.ascii	"\334eK\314\334r\223\212\3013\225\035p\322\"\320-\323H\352\267"
+	.ascii	"\2053\363qi\b\344\362\n\252Aa\366\362\"@<b\322\265\024k\317)"
+	.ascii	"\b\311\264\034\311\221\213`\363\330jL!1\034B\264\3337\300H;\212"
+	.ascii	"\353\006"
+	.text
+	.section	.gnu.lto_.pureconst.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 _}\002"
+	.string	"\362\305\022\032pO\032\003T\037RU\025W}\007\244\372\033\022\364\306\316\230\330\243\353\300\211\fZ\3061~q\213W\234\342\0237\022\2178\304\037\35605<\206/\\\341%4\204v\320\fZ\301#\370\300\005\216\264\200\007\360\307\035S\241\252\322\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`Z\001m\b"
+	.string	"b\314#(pI4\034d\214\253\252\252\322\375\377\377{<"
+	.string	"U@\025PJ\220\031I\374\237\232\315o\354_\264\225\257[\322\366\245L\001C\374\340\260`l\230\341\027\024\336\352|\345\357\345b\002\302\177\260A\001\247:\251\252T\260\022<\251\366I @\352\004(\217tB:\231r\246\211\365QY=\355\264\nv!\250\034j\237O\3714~\347\2752~:\345\217\362_\323\234)Zc6\321\006\242ykn\236\274s\317\317\034\257yw\264K\345\212\004_\334\2105 @\002\243T\345\016\017O\274\f\214;\276\033\366\311#C\374)\305>\260\260\306e`\371\302zI\323\362\211\304\330>\016\242\330n&\254\362\f\362\216R\262\301\\#\255\202\306\3130\267\260f\\\223\021C\362\025\345\3416\r\307\f\021`\306"
+	.ascii	"\343`\b\216\200e\030\3317`\206\365\351j\2664\210\334\030up\247"
+	.ascii	"&%a\367\211+=\334\243\214\241\006?\235~\333`\322\317\253hw\b"
+	.text
+	.section	.gnu.lto_.lto.34a2667f66545232,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.73.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007`"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\305\221\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\003\024?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.75.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 .M\001"
+	.string	"\370!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177\035\001\003?\202\210\200\030}{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"@DJ\320\003(\002"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.79.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \225E\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\317\241\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\327\006us\250\364\005uq"
+	.string	"\005\001\006'\001\032\206 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.80.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\320\002\235\024"
+	.string	"fd\203J\260\022R:\340\305q\254d\3513\n\230\207\206\024\024\344V.3\3063\326B\222\253\215\016\261sr"
+	.string	"\371?\331\017|\267rh\326\267\247\335\341\366\026\236\th\017!\205\236^\b\367\312 \266 yrX\351[\367\326\310&r\247\024i"
+	.string	"h"
+	.string	"w"
+	.string	"-v'\252y\254V\037\023R\255\345\001\253\274N]>\300x\372z\311x\352\235\275\343%\260>\b\374\360\002\253\326*\333\023~],oq\356N\305\235;\277\350\003zC\036is*\272zB@\215\220:bK\025\217\021\027~\362\2208S\f\362\371^\370\002?W<\322\347\323\305\240\326\352\311#E\334\343m\343l/\260\267$\366\314\217t\257Zk\002\037F\256\303\t\260\326\372\024\247~\315x\n\241\307\327\033\352q3\267\354\322f\356\317~K\325\016\220\327g\307vZ\344D?}\360\236s\372"
+	.string	"H\200z$J\240\330aYAli\325&\252\264\342\301\333/}\241\321]\354\036\364RJNYI\005?TC+\247F\360:M\021\017\263\375i\177\350\001\022\b"
+	.ascii	"k\255-\366\204\343\240\200\022\345D\247xV%Sd\305W\030m\013\027"
+	.ascii	"\346y\337\013\037\242\305\202*\213Jgm<Wd=yV7sk\367\250'+i\367"
+	.ascii	"\347\362\033\265\023&\020\243)\321\304\313k\300H\035B\256\250"
+	.ascii	"\331\227L\\IC\022\244\230+\351L\\N\303\2776\332\264\323\250\315"
+	.ascii	"\200\005=am\223\3552t(Q\276=\006\207S\220\252'\241\227\212\353"
+	.ascii	"\30643\f2\017Bbh02\267\006\270[\356f\203\371\205\0057\243\241"
+	.ascii	"\331d\271\f14\r02\031\232\213M\366\202\233\221\261\b\360m\303"
+	.ascii	"\f'\313\335n8\031\254\254_\237\035\330h\272Y\034\217D8T\315\344"
+	.ascii	"EW!}`\321\375\231\204\267\261]\251\271\362\271<^\032\347N\250"
+	.ascii	"\240T\316\374q\261\326Z\305\375\3316\360\271\261=\325\317\325"
+	.ascii	"N\017gm{x\216; \300\002\2219b\007t\022(\013<\350\021<\214gn\243"
+	.ascii	"\001\n\344^\211\021\346\0019\213/\231\017\0031\224l\020\376\330"
+	.ascii	"\003\326\264\232UF\024\251\215\270d,\226\367\265HX\002\224c\304"
+	.ascii	"\333!%\004{G9\340^\310\320`O\217\324\r\026\027d\260\r\274]\225"
+	.ascii	"p\030\243\225\273h\326\013\253%\211X\005*]M,\323\3266c\341u["
+	.ascii	"a\273\333Y\013k\346t\320.\035\213\340^\2507\336\013\221\316%"
+	.ascii	"\236"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.84.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\367\301\025\006yw\350\345\005yu"
+	.string	"\005\001\006'\001\200\001\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"\\\205\240r?h\2227\200\""
+	.text
+	.section	.gnu.lto_mixerQuadX.93.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.94.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.95.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.96.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.97.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.98.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.99.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.100.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.101.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.102.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.103.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.104.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.105.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.106.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\225\005"
+	.string	"D\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200$"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\004\240\270\275\224\304\001{\303\001y\302\001w\301\002\004\244\312\001{\311\001y\310\001w\307\001\244$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\032"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\360"
+	.string	"\020\204\323/\347\032S=@\0173\300uR\021\0016\001sA\031<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerDualcopter.107.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.108.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.109.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.110.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`D\003]\017"
+	.string	"\204\026\020\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\306\205\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\240,\177q"
+	.string	"\275\312\026\301\025\274\236\370\247\037om\317\024\023\360\247(ki\006\325\324\022\354'\177g\330\021\274\020\344\247\037ec\301\335\017\340'\340\016\274\236\274\247(a_\b\344\343\r\270'a]\347\f\264'a[\352\013\260'kY\325\355\n\254'\177W\275\360\t\274\236\250\363\001\244\247(kU\365\007\240'kS\325\370\005\370\246\037oQ\305\375\004\274\236\364\246(\177O\200\002\003\234\236\360&\177M\203\002\274\236\354\246\037KI\206\330\003G3\210\0024\207\002\205\002\204\002\202\002\201\002\377\001\376\001\374\001\373\001\372\001\371\001\367\001\366\0015\364\001\362\001\361\001\357\001\356\001\354\001\353\001\351\001\350\001\346\001\345\001\342\001\341\001\337\001\336\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.ascii	"Z\250\221\270#Ej?\326`\223\304i\003\021 $\323\021N\003U\013c"
+	.ascii	"\354\022\200\214i0\023\344\231.\355\245\201\240\314\202A\224"
+	.ascii	"(\221\204\376] \005\2719s\351w\230\3165h\321\2648\245\303F\177"
+	.ascii	"&\352*\240;e\300\230\262\"\333|\344!\364R\002\307\330A\220\200"
+	.ascii	"D\271\r\344\002\206\356\207\344[\f\364\374\317\263\205\002N\214"
+	.ascii	"\342M\300\027\320J=\002<\031\334I\031jV\212\026\203\256\006u"
+	.ascii	"\250S"
+	.text
+	.section	.gnu.lto_getMotorCount.117.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \345}\006"
+	.string	"\362K-4@o\222\016\230\265(~\317\223\351\271\251v\203us\310\253[\2337\211\370\333\315\036\n\026!=\256\242\357\361X\024\r\027=\247J\307A\321=^\255}\262e\no4\2173Au\234\307\241\201z`p\020\324B\307m\236\204\323\f\\Ep\236\363T\325s\031,\333J\330\bD\255\342;R\022\353~L\361\301^\235\356\007\323\t[@\206\b\263\307B\3306\276\227l\245\037\307&`\242\242\260\2229\312Z2e:\001\371A\237\371"
+	.string	"\001\264U\254c\204\361\320\260(a\311\304\\\343\250U\264nEz\tA\311.R\250\b\220\220\231\343E\302\350\255\177\301o\360_\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getMotorMixRange.118.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \367\325\006"
+	.string	"\022\r05Pm\222\016$\243\202.T\244\032\332Q\031\276\246\230c\343\203c\345\361\027\313\326\336T`\025\334a\321\f;\266\230\231\"Vp\013\267\347\n-\243\217\326\032\3312\005k2\330F\302\342\274N\003\203\345\260\360\036,\005\316\323`\021/S\360\005\261\301^\347\272\260w\331\262.\204\016\363q\024\337\221n\223\256\350\211GX\255\324}T\225B\027\200\361\301\226\337<\3504\276S\272\320\027GGPBI0\311\264ha\311\023\252\304\343\317\376rA\032\222=i\3328DU\351\250 Y\311\314\207\351@Uj\252@U\312m4+f\267\"\235>J)\032\310S\004@\310\314Q\003]t\327\337\340?\3703\002\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.119.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\f\001\215\r"
+	.string	"\326\031]E"
+	.string	"\2216\0358.\363\331\367\bP\013\254\031\373\312\272\343\031\006\335"
+	.string	"V\016\303\215\253\353O$\240\2400\376\243\337\201\021\f\315\274\372\242]\201\256j\021\355P\177\337U\306\270:\035E\001^\277\216\320\226\354-eJ\001I"
+	.string	"E"
+	.string	"I"
+	.ascii	"\363\304\2612\361m\\\272\300ui\016\003!w\0177\234\216\222RR\311"
+	.ascii	"\2303\314VC\247\335\343j\347g:\242\212\212"
+	.string	"\030&O\364xa\370\006\360F\021\233s\036\274\222x$\325L\307\234\323j\362.\334\362\266\025\330N`\277\013\266\252\345Sw\334\177\267\252\372\031\316g\222\001EeW\204\363\024Sc\272H\024)O\375\337\325\276}\021\376\2125\037\3610\364\224[0R8=\007+\230\211\340\272\304>\300\272\214\027`=\344\203\326\374\3530Q\030%\026\335x\\\022\373R\233\302Go\322\335\025\375\300\313\212\303.\312\033K\356\301_/$X\220\224\206\377\215\365\225k-\225\214^\342\252\020\277\203+\210\350M\227\276\310r<\300\230\200%#\032c\207\"]\224\013\325\207\024\336\223\332A<\232\307\023\322\340\303m\240\255\003\300\036\034\356\303\202\326\311@\021@4\t\0202\217\366\240\223yp\237\214C\300\333\204\017.\003m\033\227i\302\371=\361\3013h\021\242\304\242\177g9\256\356za\200p\231\361bdG-qQ\376\312\027\234"
+	.string	"\003\026"
+	.ascii	"r\b\370U\323\240\006\226\342r\016\254\336\025\201\0232\343\032"
+	.ascii	"\215\220b\202r\315\020\204\b\200\212}\013\007\200\tX\255>\214"
+	.ascii	"\205D\021\035*\242p\227\0305\344P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_mixerIsTricopter.120.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"e\007"
+	.string	"\342\r24Po\322\001 ;\215=x\334\306\325\007\203\335\001\201\274+pV^\313\262fQ\262\036m\207!%\200h\r\221\2319R\272\357:I\361\\M\374 \233H\231R\276X\020Sqe\236\346\301\341\202hx\021\027C\346]\340\304\263\b\214I`\340\323`\030|U\334O\253#\325\202\217\202\234zU\275v1\220\377\206rz\275F\002]\344#\033\277\303\024\234\374v\347s\250;\247\001\030\237,\331\321\223\232a\177Z\035\331\231vNk\372\224"
+	.string	"\210\312\002\312n\250\324\262)\216\344a\273cWFH\3508{\334\b\235\303D+a\331\215O5\236=3\377!w\037'+\233\310\363\004P\330]\347&\262\270\365\266\rl\037\330&\t\r"
+	.ascii	"2\241\215\037X\307\304\2028p\231L\242\021*\020\327\3045\004\225"
+	.ascii	"\237X\202\345p\315\231\204\371\004"
+	.text
+	.section	.gnu.lto_initEscEndpoints.121.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`K\006\225\""
+	.string	"\226\375\324H\220VN:\207\037n \372\235b!\007\036\\\016\023\332\237\245o\322@h\032\311j$\300\013VE\253\030X\3676\330\321\2578SHnl\351\215\271\200A\340\023\211\300pW\032\376\271\317T\377\377\177\333Wk\t\331IJ\031\267"
+	.string	"\261"
+	.string	"\305"
+	.ascii	">\332KC{{\357\235y\257\214\331\313{\357\316\3545\313\336\222"
+	.ascii	"\366\322\367\276{\233{y@\323\r\256\0308\336\216\345XS\324\215"
+	.ascii	"\251SJ%9\230\214\331\310\275\313\273|\\.#[4`\326\261zIps\002"
+	.ascii	"$I\200\307%\363\330\366\226\201\260X\025\033\027\215g\245\242"
+	.ascii	"\347|\323\202\254\265\006\340r\001\360\270\0042\217\311%e\035"
+	.ascii	"\223\313\255\332\215\343\343\215\312F\334\264\314\222\265\326"
+	.ascii	"\340mp\025\357\314\222\276\253\226w\006d\212[V\274{\301\346\314"
+	.ascii	"\326\013.\317\023MY\360k\266\262(\260\326\312c\334(\266\260\272"
+	.ascii	"w\006j\255\333\305\255\025\274<\336]\021\273\313`\3274\021oe"
+	.ascii	"\307\272\005\352\352\276d\325z\205D\277\364\247\235`X]\267?\375"
+	.ascii	"O\332\211\354\377\354#J\030-\272\256\265Z\375][\2059\230\375"
+	.ascii	"\fA\326\262Z\314\356\n\271\b\007^\255\265i\231\b\t)\236W\t\223"
+	.ascii	"\313\276\214\221\205\260Y\211e\257\035\202h.r\271\f\302\344\222"
+	.ascii	"O \207\016.1\030W]\267{\304\352w\3552\255\247\261\313d\274LK"
+	.ascii	"l\344U\242\275I\264\027\211\366\036\321^\243\367\002\337[D{\211"
+	.ascii	"\336\3733{\207h\257\220\331\033D{\201\314\336\037\332\353c\366"
+	.ascii	"\366\320^\036\263w\207\366\352\320\336\034\332\213C{oh\257\215"
+	.ascii	"\331[C{\003l\245\312\316}<\232\310\031u\2508\200\313\271\316"
+	.ascii	"\371\374\332=\347<\306-\f\216\024\247\263\025\2730\375\3468\347"
+	.ascii	"\223\013\353\346\234t\333r\"m\276\254\306k\213\366`\317\366\314"
+	.ascii	"\344\222\213]jn\363\317\235H\b\f\345I\315}.\230\204\031\251\357"
+	.ascii	"L\3575\232\367\356\003S:\315\177p3\357\375gv\"e\276\373\314\177"
+	.ascii	"\346\316/\336e\"p\332\022\336Y\255\315h~w\326\242\333\t\254\204"
+	.ascii	"\002"
+	.string	"\257\326\254\246e$\234\244\302Z\270\320\\\274`ri\236\313\270\223;\274\270\304\214\345\273\226\333\304\342\276t\363M\213\026Z/\032\267\322QP\231\345\247\202\270\3314\260\362\223\271\013\245\241\271X\236*M\206\0342\353V\024\215g\004D\250\020QQNC\034\242PJ\330\200H\365\201H\34545$\016\245n\366I\300\024\324\b\241T\220\270A\203\260CT\320\203\020\203T\360i*DP@\320\016?@M\005\211\303\341T\260w\274bZOc+\264\230ru,1;tU=\366l7\304J2y\325u\273\2441H'z\322wi'\327\321\215\216\004v\364\"6\340\215N4w\"\213\376;\360BG\316/\254\242\377\314\264\350~'\372.\355D\016\375\027\306r\311\241\367\206D\t\023\002\343\024t\241\237\355\007\177\361\022\364\036\21759#\020\227\237\003\375sb\274\005\216\343\252\306\016 @`r\371s\036\343"
+	.ascii	"W\326\302L\237\267\004=\36795S\300mYz\356\253\241\026f\344\271"
+	.ascii	"\262`\347<\247G\030\004~\250aD\002\221b\312f\024\224\024\024"
+	.ascii	"$i\f\300\002\221)*n\0210\265T\210LRU\2061zBg\211;\311\tbB=\344"
+	.ascii	"\t\200\b\023\237\204\370/\204\004\315\205\210\204\274\226\201"
+	.ascii	"C\371\356\373\275a\332~\360\264\222\226\220\326\215\261\317d"
+	.ascii	"\301\350\221\nveN\005&Y\24037@\223=\244\n\322b5\tDEhO\3318\232"
+	.ascii	"h\252\"\t\326\253\r=u\027N\nG=\020\031\034\350c\316\264T\261"
+	.ascii	"\177u\"\265\231h\001m\337\312\345\t!4`:,y\002;\236]\224\311\003"
+	.ascii	"\315\225\261\253\236\216\216\361\203\304\310p\307\327\367zD}"
+	.ascii	"\001\234\227\030\355\273-\310\217x\370\027\241\373\001\224\352"
+	.ascii	"743m\262\350\\\267\016\007\301\333/\236=\027\006R^\300\327\321"
+	.ascii	"\024\255R7,\342S\343G&\337+9\322\201D\365\322\335\214\365\256"
+	.ascii	"D\341?\022)\360\301]|\026\205#\345\214l\037\375\003"
+	.text
+	.section	.gnu.lto_mixerInit.122.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\022\001E\r"
+	.string	"\326\330YD\020\221\223\016\270H\206b\240\366\360\242 \237\315\320\024 dG\217\035\306\222\331J\254\240\240\372v\225YA\033\254\265\230\217\004\243G\025\317\220\024"
+	.string	" *T"
+	.string	"\bJ\237"
+	.string	"\312\332d9`\322H\342\336[\312\224\002E"
+	.string	"B"
+	.string	"C"
+	.string	"\234x\370> \036:d\343x\327\262\207\361b$\303cw3%\361\320\237f\310\377\351\027GB\371[\271\276\004\252\030;\002\220R\036G\305\205\373\351\271\201\264e~0\330]'G\352p\303\333n`{\201}\016\001~\351\315K_/mi:\376\345W\314@I\206H\216]\225U\217MA\032\023>\314cN\336Y=\334P\261\273\330\241}bc\207\307l?\355\227n\n\375\005\344kWDif\267S`\004\326\341\201\007\004\256\037\024\243Z\372\021\315\226+\273\210\372\230'\312E\025\302\364\341J[\303\220\347\234\250\023\251MQ\254\352\267\270\f\310/a\022\223<w\350\233\304CH\243\306\n\020\242\\\331\335\226:\302\376\333\335\265\2628\235\b\232\203\313! \237\216\006\317HVBa\202GDBf\301\003a$\013\371\220d \005\254]\350|\262\022M\373dX'\372[e\361\003SJ\244\333\253"
+	.string	""
+	.string	"\225\342-5\252\031u\206\270\321\237.\200\005\n\030\0353l\244d\215/\265t\243\037\255\004\031"
+	.string	"`\2212\023o\222\206\333\032`\322\254\020e"
+	.string	"\332\005\031\203\t"
+	.string	"W(\263\373\325\330"
+	.ascii	"&\240]2\277\202U`\305\351\256\262\260\\\0066\025zP\321\210\325"
+	.ascii	"\025q-O%\344\224B\355\001"
+	.text
+	.section	.gnu.lto_loadLaunchControlMixer.123.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\t\002\245\020"
+	.string	"&\335kI\340\260*\035\300`U\273\362\324\200\301\210\224\251Q\365\035\"\202\036\020\300 "
+	.string	"\177\240\177\002G\224\215\232\227\211Sd\330\332\333\251\203\324\272\261\257c\r3\3140\003IH\020\237\3452\\J\031c\230\200\bF#\204l\262wJ\001V"
+	.string	"R"
+	.string	"Z"
+	.string	"\024\204\305\177\345\r\316\323C\260~t\236\374\231\033\270\341X$\352\341\027\276\264n|\220-\237\250\347\326\341\345\247\013\251\232\240\007\t\327+\207\177_\210\216\007\236\017\022\303\007\002\203\263\001D\256&}y\021\033\216E\272>C\006\273\353\311\"5\334\342m\267l\213\330\263A2(}\331%j\212zXF\230\306\330\237\307\356\371\351{\b\330\351\234\334v3\364v\233SmD<v\373'\374\322\240\2438\354\364\230k\"\252%\316jl9vw\344\325\t\304\327\002\017"
+	.string	"\276~\007"
+	.ascii	"\276\036\344\223m{)\263\257\341iY\221\333\3351\271\\j\366b\320"
+	.ascii	"`\200\\\274\022\271\233x!\263\361\321\227M\263=\017\234\226d"
+	.ascii	"8\253\271\3036\205\2730-Dfw\027\2640\021xeq\372\371\260\323\301"
+	.ascii	"f\246\020\r\212\255r\025\246\0018vW\344\247\270\254\202\037\342"
+	.ascii	"\325\027V\346Y\257\376Jy\004:p:\233\324\354\321\331\213.\243"
+	.ascii	"\233$T*\26102\031S\"@\030Ix0\236\214\034\230\214$%\2241\004b"
+	.ascii	"\322\204\222\322\230B\"\225FP\271\24713\027k\360rRT\025\322\227"
+	.ascii	"C\032\365C\351\316\034\371\244.\256\201\223\036&\333Y\315\035"
+	.ascii	"\377vwA\005\237\364CUl8\026\030\325\354\315\233Jzm\306\r\r/,"
+	.ascii	" \300\202\241)\333\006q\201\375\356H\227qR\356\262L8\037Q\004"
+	.ascii	"\277\265g\251!\005k\033\217\343`\202\372NR\f\356\203u\bN\245"
+	.ascii	"\206\365'\313Y\006\344\020\026s,[\305B1\226Cf\032\223\304A\326"
+	.ascii	"a\313\223[\335\tkN\332\t\256VN\210\237\031\0327\334\001\221\206"
+	.ascii	",\3377z\335\316\005\311"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.124.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\307\t-3"
+	.string	"\312U\314\022E`\\N:\375\246\251Q\211H\026\032K\303z\026v\266P\354\374:\220\305\231s\232f2\276\223R\327!\221~\035\355D\177\177\374\201A4\022\030\r7\270\205w\231J}\245\342\244\212\367Y\231YK\b!r'\031\033\001\b\001\033\001sL\264\034|/o\362\333x\330\005\251\343L\206\262\273\032\277\013\177\355\\t\234\215\315"
+	.string	"\255\272\200nrz{m\333\032\2572\003\340\325\245\033\255W\323\027\255W\231u0\017\257\252C$\263\336\331\314\332;\225\311/\320\266m\217\315d\250\210e\340S\2663QE\036@\021\221\321PQ(\210\b4<\022\006\201\354\252\246}\221|vBp\313\313\352"
+	.string	"\316\3028\271EON\364\344FP\332\226w\250\311\213f\027J\021\334u\231\245\003\332\216\334\240\224\335\001$\312\237\372\366\350>W\344\022\331\tK\276\214\034\3506\371\360WF~\224\026\021\211\303\373\334\231\034\340Y\021\213r\205LI\276\304\036\274\353\022#r\201)\313\325\205\367\273\256\261\364\351\216\035\261\307\355\270,\025\260\257\251\0045\264&A^Zi{q\253{\334\231\252t\215]5m\260T#\344w]a\251\221\033%tR \330;\310++]j\333\366i\277J/\254{\331\tm\333\362\335\362\372:#\235\371p\230\331\0023\360+/\303\006\017\215\332e\034 \355\377\341\2449'\353\366\275"
+	.ascii	"Z3,M\215\347\364\032\237\266\222\317lVO\300\265\344\331\\c\355"
+	.ascii	"N\321|f\335>\276\375\356~R\210\200\213t\023+R\277\237\244\303"
+	.ascii	":\363:\023(\244\244\326\253H=d\342\026\r\373\324\312\247{\231"
+	.ascii	")\376\031\257\240\272\337\242Z\257\252I0P=W\367\217\231\r\353"
+	.ascii	"v\031\363\237\356hM\341&c^p@\275\354\364\346\271\211\351p\347"
+	.ascii	"%\365\262R\022\001\341e\244;\317E\241\340\345\240\3652\221\275"
+	.ascii	"\f\004\274<\004^\026\262\227\203\353e\340z\231]/\257\352e\365"
+	.ascii	"b\316iz\271\323\3137\275\374\007J]nl\310i[ \177~m\033\225N\312"
+	.ascii	"\233?\334\357\374\305<e\376\034\017\221b\234h{*\230\034\364\306"
+	.ascii	"\3458\230t\2421\237\311\217\013\021}cB\337\016\307\017\343\206"
+	.ascii	"\\\312bk\275\330&\2179&4\307\231\254\252\371-\231`\370n9\322"
+	.ascii	"\366\255M\225\360\bb\303\0166P_\353\3129\315*\354a_\253J\261"
+	.ascii	"\205\375\271_\370\352\343L\376\271\272\177\315O32.\240.\343\253"
+	.ascii	"\032\177Y\343/\321\370\267\035\030]\243'4~A+yx"
+	.string	"\242\027\237\255#\256\260\006\273\252\371\244p\277\n\t\362\372d0\312\353\013v\260\256.*<\237C\331\344\0314=A*R\336\004\273\214\247V`\027P\223\322\264\003\356\271q\236\007\303\321\214\231=\034O\206$\263\266\315z\332\373\035\r)\207\016k\207\365*\320(\307\214\2265\242;6_\200]\306bkRs\332i\013\265\222\315\254B}\275\346\363\277\336X\2257\254\203\013uR\377+\352d\273\316\267\360|j]\233\355k-\237k\037\231~K\265\260\217\311\223\023\007\252@\036\377\315\341|\210\272\337\212Z\257\342\210\362)\305\336~(\241\253\bf\276Nj?Is\0163\210\267\021\261\201Ig\311l\333\254\bw2\2378\033(v\351CO\032f\333\266Okn7\202\177v\225ID\311\350\307\235\201\233\\t-\314\202\352,\005\241j\312\006\225\213#\r\026+\250Z\2508\276\240B\341\342(U5\343\ba"
+	.ascii	"\303\2101Uu\244\001\003F\325q\310v\365&\343\264[\210\266\321"
+	.ascii	"\275\253\306\002\320e\314\242!b\352~\032\031\277\264T\264\324"
+	.ascii	"L-\244\204G\235R\037\216\031\271v\221\260\023\211\357\362\036"
+	.ascii	"AZ\301\202\314\202\314\262\362\035\273E\330\211\324\302c\316"
+	.ascii	"c\326\253J\3750W@\245\355\214\310\250\311\030M\361@s:\\\320M"
+	.ascii	"\255\324{S\177\255\371|\332\266m;\324\324\007\032\207\036\237"
+	.ascii	"\326\022\253\b\342\206\201\r\001\343\007\n\275\272\177A\276\274"
+	.ascii	"\206C\374\240A\267\3045\357\204\272\214\235N]\325T\363&#\323"
+	.ascii	".\027;\021\230\265m\033\341\007\224R\236\017\247\016.\361\213"
+	.ascii	"\256mAA\270=\336dFn\271I(\003ZH\265\250\266+\340\303\027\245"
+	.ascii	"k7\256(\231\240.\343\341\023\210@\253\317#\343\213\255,vPW\260"
+	.ascii	"#vP?\371\347\352f\021[i\316\371\266\210\205\021\213M\240\317"
+	.ascii	"\354\343\366G\005\222\313\333\362\316\230\271\304\265\202J\272"
+	.ascii	"m*\247\f\200\322\250\201,\304\030C\b\021\311H\222\244\222\016"
+	.ascii	"\200\002\221)\263n\021p)d\254D$\315\262\033\001\362\207\301\357"
+	.ascii	"'Y\025\002:(\241]\276\315u\216\033\327\270F>{\3762\273R(\262"
+	.ascii	"\013i\034.\371[#\325/D\270\216V\022x\321\360{\177\030\032\263"
+	.ascii	"\225\337\265"
+	.string	"\355*\225f&b\344\224\224&w\370\213UiK\212&CO\225\200\242\0070\013\270\003\367\334\236\263\374b&\220\035\260eA'\027\241\276\257\252P\327F&2t\311\216\254\237\f\"\252\3161k\275\247\201\256\342\335\261@\3322f\304\337?D~z\030\2379\363cGg\033\242I\031\0053&\267\254J\250[\344N\370\f\305\277\nK\354/\273\267\367O\307\203~\326\030M\026\024\253\021^\206\372\251\237\211I\342\036p\2076\255\006\3177\377\"=R\035\274\r0\247+\225tO[\005S\240b\311\302\231\346\203&\003\211\270\021\344\204-\305\300B~\260.\3629\001\n\274\351\231\n\235l\231\331\0170z\266\322\213\376\211\f\306\023,\362!\342F\261l\266\244\231\216\2328\222\320\342\013L\211\337@\260\307\020J\r\026%Ts\275\341u\n\337<\341\206\362m\211\230\225\031\200\342\246a\267\033\263f\216\311f\352\367l"
+	.string	"\240\035@\233\211\036\341\032\263\262\006\343~\303\367\351\030\350K\221\257Q\236N\241\022\353\304\031\205`\227"
+	.string	"\b\r|f\3117l\336\257J\262C\337\201 \305\306\360\204{\323S\275\016>C\206\021\245\017\025\351UL){A\276&3\004r\f\363"
+	.ascii	"\327O\325\321\227l\b\376\003"
+	.text
+	.section	.gnu.lto_mixerLoadMix.125.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\236\003\205\032"
+	.string	"v\261\253I\260\226Q:f\336\237\002\323B\377\256\001qR\2016|\207\327P=\367\342\261\341\024\275a6E-\003E\356D\377V\353\214\302\346\005w\340\303\272o\244\375\260\377\304\301)\034\255^#0\222\217\242\217\234]\364\t!d\313\235R\226"
+	.string	"\213"
+	.string	"\230"
+	.string	"\253Za\004%\325Z_V@>4p\026\361!\275K|h\233\035\365\222W\217d\22434Uk\205-\320\203\017\216&O\313\233\256\355\344(\256B\272\323\346\373>y\234\340\200F\273\233\223t$q\202\306a\250\244\226^\224\233c\212\r\236\213$\317W\324\305\342\307\323\213~"
+	.ascii	"\311\316\n\272\340\tG\317}?pc\207\305\f\351hb\347\t\300\216\004"
+	.ascii	"\205i\302\244G\267\303Mj#\305\367D\237B\200>\240\321"
+	.string	".\305\347(\241\326\352\251\263Cq\247\3346\223m\b\366\326.p3h\2277s\177\354\3034\311\325\360\372\330-,\027\372]\357\335+\357\375*\377\335\255\017\335\254O\247\204\323\2539M\322\351q\247\305\235\016\3514\235\323\273\323s\247? \302\013\027-\202\216\026X\326\023A(\325)\\\n\372\357\037*2\200S\326\035\205*'\035S\357\341\023\r\231\211\274\331!\177HHR\265\326\227\207~@>\234,\333\263<\017\333\205F|\245V\237\"I\265\226/\303\310\207.\311O\373:\276\303\366\236\231\034PFJ\254\326'\204H\027\203\355\330\203\310\264\360j\305q`\273\302\227d\001\240j\305\201I\272\022\007\372\031\017=3\023\2573\333\373\356\002\\\362\244w\013\367\307c\323\266\354*\231/g\255\316L\"k\337\363)\301\231T\247\265\326JY\333\262\"\240\004sH\b\354\017\377a\244\002\274Z\253\003\377\310\246&"
+	.string	"j\306\b\361\241\013o\3526\203\236\353\332\335\347r\250\334D\304\357\334\347n\260\366{\242\323\246\252_N\224\333\f\356\376L<QZ/\270\312\256\354\002=\371\200D\001\262\327h1\033\331\204\231YM\rDL\313&\226\201F\026:\206\001-f#\233\201\325l\220\221u\320"
+	.string	"\243\221]\230\201\305\320j0\006\004<\363\020\243\301jf3\032\214U\326\257\217\357\344\021%\247\333\342\310\375q"
+	.string	"\035\221eC\031\253\227\267V\327\212\362\031Ym\312>'\312\315\026N\344\302\253I\3462d\265\257\030\275\333\f~&\251\242\322\215\255e\331KU\001/\304CL\003\236/#\036\321\324\n\354\022]\317\315\265\344.\020q\351\216\367\361p\305\326\206\373\242\277\200\242|\300\337\024R\321\002'\356\217\377\004\001D\250Q(\243\220\203\002d&\220\t\206\306\264\320bP\002!\307\252n\020hg\233d\031\003\021\352\316Tlt\254.\033q\037k\347d\005e\202\356,\236\005\236Rx\030\240u\270B\2411%\374\260\317\304_U\364\t\212\337v& cH\326\032\b\373/\306\225h0Bb\243\372\007\001\327*\241:\2610;\247=\245\216\251B"
+	.ascii	"u\025\236\325\016TC\353\243\251E\244Wq\270\270\300\253\336X2"
+	.ascii	"\353\302\324\322w([M\263j\037\2003\217q\360\325q\352\340`\242"
+	.ascii	"i]\265U\0304\367\022\212\n"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.126.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\022\001\025\r"
+	.string	"6YYC\020\257&\035"
+	.string	"v'\340N\214\025A\017\305\355Q[\373\374\272\237\220\273\273d0~\22188\347&\231\346\2526\322\361xihx\362\b\352\025\001"
+	.string	""
+	.string	"@\250\002\220h\f\024\224\007J\312\256O\310\336R\246\024D"
+	.string	"D"
+	.string	"F"
+	.string	"%\233\335\265\024\2045\376\342\3752;|\232\231\317\362'\322h6N\344\360U%\034X\004\3402\274N\rM\207\307'\t\027\312\267rr}<\024i1\033w\362\254\026\354\256s\343Ln\352\266?\266\023\330\377\b\232b\237D\272\363\351W"
+	.string	"D#\356\232iwC7ce`\n\021'\335>\t?\232\363\022o\311N2\314\327d\257\331\254l/vw\343\320\b4\016\017\234"
+	.string	"u\370>\200:<\307\231\355\3421\304\376\324i\b\"-f\344C(;_m[\270\311\247\002-v\267\343\227~b\202?:4\205\220\220\r\006(;\373&\356\342\223?\362\005\277\344\267C\337/\372\370\027\003\245t\203\002\312N\325Tr\203BU\305\216\"\331\251\031\031\341\327\335\301\201yT\270@\254\317\207\203\353A\003\013\302\305"
+	.string	"\304\352\300$X\034\006\354\211\340\201Y\037\217\007\2638q\257),\277\266\302\203\fHCPU\\\251PJu&7\236Jb\030*\365-.3\030R\306\337\356\356\263\202\247R* \027"
+	.ascii	"1\003\377\334\301@\003\245}Yn\326|\210\362=\2042T\212\210\232"
+	.ascii	"S1\246`Z\202v[\342\233\233p\2728\323\352\312K\023\201c\034\276"
+	.ascii	"Q\366\212U\343\001E\304t\315'"
+	.text
+	.section	.gnu.lto_writeMotors.127.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"]\n"
+	.string	"\266\323HA \251*\035(\223\304\227\204\323\3000\234F\t_\271D\224\227$@n\244\341\003:s\212*\2603\2411\202w\036\030\302\016[\201[\240\001\020\004\306\204\0220\311\020!\212i\"\024\207\331\326\310\226;\2455"
+	.string	"7"
+	.string	"4"
+	.string	"\341F\260N&\b&\354\256\246"
+	.string	":\331}\252\354|\013g\341\003\275\317K\312\265\001$\315\314\356\276ui\002GRZ8\273k\371\201\250;\273m\013\333\024\366\035\002\027\206"
+	.string	"\013\300\227\022\354\236*P\3301k \340\256\333'\340\213/p\003\335]v\360E\355K!+\204\355\256\346\231'.\3172\207\250<\233\177\250<;\306\235\035\341bv\350C\376\263\252w\213\336+\302\030Lu\345\221\312\025\343"
+	.string	"\004\222\214yJ;DD\376\273^\301k\3008R\317\026=\251+\030\003\t\243Ue\337u\317K?\333\335\331p\036\220\355\243\211646\216\f\255c\273\370h\035.\244m$\f\362\360p\232\b\004\3424\214\270WU\353?y=\030It4u\345\213\177\252$\205\"5\237j\262-2\016"
+	.ascii	"2\003\006:\306\022\003\371\213]\304\206A\\\306\375\251 \272\260"
+	.ascii	"\227U\226\227&\202s\017\3402\324\220\355*e"
+	.text
+	.section	.gnu.lto_writeAllMotors.128.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\356\001\345\021"
+	.string	"\346\342wG\340\320(\035\232\342xq=\342\273\t\316\210d\366\303"
+	.string	"\356\027\024\312\004T\210/>\220`\224\206\004\032\304\375\333z\3121\211O\273\207\rS\306\205\031\346!\007@\230\204,\236\210_b@#\3538\333\377\215\354-eJ\001c"
+	.string	"^"
+	.string	"b"
+	.string	"\001N\300{\314{x\217~\3314\f\314\026\266"
+	.ascii	"'\247\305\307hwS\372\301\245\303\333\r\363u\222\027\241\346\313"
+	.ascii	"\3479\224\251\355h\037\354$\016\3678\276\026\370\201c\311\bI"
+	.ascii	"\263\027\020\034\337\f\222\034\351\202\236{\326>YB\034\333\365"
+	.ascii	"\271G\231\232\020\355\263=I\fv\327I\373`\356\322m\333l\213\330"
+	.ascii	"\231 \337\371I\377IkL'L\237\003\300\315\214\3575\240\335\227"
+	.ascii	"\235\215\035\212A7\377\271\375\233\2373\312/q\237\327\177\354"
+	.ascii	"\342\013\263w1\302\021\241\333]\220G\207\224\036?\340I\034\267"
+	.ascii	"\362\233O1B9\273\213z\264Wl\324c\242lg\332\037q\235\327w48\356"
+	.ascii	"zP\321bwE\254\240\364\030o\271\341\2578\013\023\337\306\253\223"
+	.ascii	"\023\3571\265\200\214\230X\356\016ww\241C\016\325\244\036=5!"
+	.ascii	"\226\016\262\334\371j\033\303S\030\250\243fwI\374\023G\301\362"
+	.ascii	"m\036\335B\311\323P\274\307\323j\304rg\222^\237\273\203\236Z"
+	.ascii	"\f\026],w\252\271\027\263O\225\306\276\311\362$5G:\353\214\355"
+	.ascii	"\245O\246\253\253Xi\325\210\253$\303\212\225R\241`\262\2520!"
+	.ascii	"ea\025\201\225R\271RR#\007\334\272P\342J\251\264Z\256\024\352"
+	.ascii	"\026\273\316\360\374.D\273\241\230\312H\003\036@\310\323\254"
+	.ascii	"\n3\002\233N\216\367\024\357\244\022z\212:\322\307\251J\362\264"
+	.ascii	"\223\036w\001&\210B\f\311\024\026\225\306\246\"5\251\026%\310"
+	.ascii	"\241\326\240\2526\200\261!\217\234\252\032& `\002Bt\352\001\261"
+	.ascii	"\300\337;\372\003+\352\200\217\275[W\323t\201\005\002\343\005"
+	.ascii	"\333V(k\r(\226\\H(\345\327\212\2146HM\314\301,\351\353V\325\313"
+	.ascii	"\361\345>\265\007l}\342R\f\031\034\215\370+\271]\342D\\\004\306"
+	.ascii	"\304Pn\2707o\242\244\035@\224M\027}\002"
+	.text
+	.section	.gnu.lto_stopMotors.129.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\345\007"
+	.string	"rO65PO\323\001\243X\254\251P\021\204[\241vE\205N\023\217\205\240\274\037\275\370\253mY\301\303\264'\020\367\317\322\314\314\254X\036t\360\255D\320\307\377\266\304J\231R\2668Z\247\342\302\342\307\241\341\202`\210\021\327\002\026-\315\0239\005\316$:Z\374d\231\026+p\257Y\025\001\264p\204 \265p\225\t\177\330\330Xf}!\225\252\266g\"\337\331\340B9\247\252>4sM=\006\313I^b\024\177d\n\223\362\335'\337\244\315\247\253\300\347\022\363\201\262d\203\\j\207}\315\252\310\326\264f:\237>5 2\362\236\241\262\253Q\222\331pJ\001\261\375\312\233\375r\360c\tBNB&0\273\033\325\343\333s\363?\362\200\316\343\236\224\302\356:;o\343\326\333>\260\215`{%\f"
+	.ascii	"3\241\275\037\330\314\\\260i\016\232\206\247\262}\244\332s!\367"
+	.ascii	"\031\354\277\214\013.\335\242\235O"
+	.text
+	.section	.gnu.lto_stopPwmAllMotors.130.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\255\007"
+	.string	"\242\01656@o\323\001\233N\365bVts\261\016\236\3768J\006p\357E\313\234\323\304\261\304\311\021e\017E0\256\372\212GQ4\034\356\315\257\020\321e`&6M\210\224)\005\2764\333\206\002\313b\207a\001sP\210\017XB\026\257\215\0235\004\326 6[\354h\332\026-p?\255\2120*\244\360\243\025\316\244\225r\254\262\033\262\353#\304d\252\035\301\311{.\260\320\316\327\324\203^.\362\021\t\177\344\tO\336;\345{\252SW\201\320JH\350\223%\033\354R5\354O\253\";\323\371\364\253\f\310\350\373E\311.F\311eC\n\245\303\366-s6\313A\216\035\3608\001\221\264\354n\324\215sO\316?\351\001\336\327=\001\020v\327\351}\031\267\336\266\201\355\003\333&\001\013"
+	.ascii	"3\241\233\037\270\310\\\260i\016\232\206YT#.\214\032\203%/C\200"
+	.ascii	"K\267h\347\023"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.138.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375` \026e["
+	.string	"\n\221X L \322\322\351\233\264z_\f\214\263>\314\325\331\001\0300Y:\230fr\303[\315X\3644=\032\357\230I\217C\bJ@T#\321\321:\324\226)\270\033\210\252q\336\241\2677i^\254A\213L7-\263\262\303lI7!\273[J)\005\344\001\273\001\376\001\\\264\316E\326\231\210\350\f\202\350<Dt\026\":\007\r\235\201\206\316?Cg\237\241\263%:\023\211\316\303\241\263P\350\034\f:\253C\347T\350\354A\347\356$?T\350\314\232\214\206{\311\376~\270i\3221R\332\256;\256[\256\333K7\230n\270V=u!s3w\0357\224\255]\007M\002\026\267\365\3313ps\351.\375\245\351\330\202\371"
+	.ascii	"x\327\252\246\370\265\245\321\320s\307\366\362A\337\345m\260"
+	.ascii	"\265)\177{\367\302\365R\330\251\2207\221*\027\002\360\316u\233"
+	.ascii	"\333\223\266-a\247q!\250y\301\255\205\006\204\235voa\313\314"
+	.ascii	"p\f\355{v=\315\234)z\366\356\275':e\027\302v\346\306\322Y\216"
+	.ascii	"\375&\002P\350\206\251\215\020\346^8\024\\B\330\251S\027\325"
+	.ascii	"N\201M\244v\312Gf:HF.\030\213)u\304\344\360\334{\251\236\205"
+	.ascii	">\366\224T\324\b(\021ON!\232\230\226\224\214IHGF\305\"\"\020"
+	.ascii	"CBA@?>\2268\024\006\325\024\370~\344\016V\001\325\242\340-\315"
+	.ascii	"\300z\n\332R\016\355\250\272\036\261\246\254\216\316\241D|\351"
+	.ascii	"\247/^\334\tX\345\310\224\020Z\272I\313\2333-ei%,W\3348\227\364"
+	.ascii	"\224\301\221\200E2\266e\257){\002M\354\211\271c\305\217\214\236"
+	.ascii	"\322\316\330\272\350B\027\271@\245,\212\023I\201\342 \032\t\246"
+	.ascii	"\207\202UD,nu<\244\235=i\241\265\016\002\026\325\250\315\351"
+	.ascii	"5ek@\023hgPh\342@?\301\252\2643\264\366a\262\304m\013\304\346"
+	.ascii	"\023\2252%>|\022\372\354\271\035\341!\355l\355 \323\232\211\271"
+	.ascii	"\252\244\023\363\024I\003\201\314\214\320\205\371\257)\263\003"
+	.ascii	":\335{{K\373\230Y\322=Xu\357e_\232\2355\223hfgcf\032\230\211"
+	.ascii	"\232\004Y\357\363A91\277\035\346\330\3570k\335\363\315\211\237"
+	.ascii	"\365\276G)\203\007\314\346;u\370\304\017\332Q\242\t\177\370-"
+	.ascii	"\346\207\364\277\030\032\316\033\3417\264\3232+]\364\r\351\177"
+	.ascii	"p\367\336`\037\257\250\301w\031\236\235\303\361\312\232fs\314"
+	.ascii	"r\3242c\206\332i\360"
+	.string	"c\304Q\3379\246\325\357\212\223\323\344\305F@e\306\241\303{\251~\303q\243$M\237;\257\365>\340`\307\016\265S\240\334\222\017\311\n4\016=\204\367\206\265\3406\32374\300\035\245S~ \202\b\324N\323o+\253\334\363\355\336{\201L*\005\337t-\344\213\213\323\315\244\372S\360\354b\314\244\37717\231\276\223\200;\nOP\201\367\262\202\277\263r\2112\221\376\327\377N\336@\355\307 NN\230\347\341!w\272}\201\312\374\303\312{\331\337sl\364\244\t{0f\270\244\277\223\271\377\357\357\357\217_\005\346~\353\366\352\270\346!-\327,$\203\006\323\254\325v\315Y\355\2459H\203i\306j\270f\037Bg\n\254s\017\353\274@{i\346\321`\232w4\\s\002\r\327\254\303:\347\260\3168\254\363\r\353l\303:\327\260\3164\254\363\f\353\\Et>\300:\033\360\343,\343\3079\206\217s\001\326\231"
+	.ascii	"\353\f\303:\277\360qva\235[X\347\001\2543\013\353\274\302:\013"
+	.ascii	"`\235U\004\235\003\260\316T\3269E\320\031\205\320\031\200\241"
+	.ascii	"\363\t\353lb\350\\\302\307\231\204u\236\262\316R\3269\312:\217"
+	.ascii	"\260\316P\326Y\304\320\371\311:;\3718\207\260\316M\326\231\311"
+	.ascii	":/Yg%\353l\264\316IAg$\353|d\235\215\202\036\276\005\200o*\353"
+	.ascii	"\235\347[\321\312\232\036\244\035\177\"O\313\211\357\266\325"
+	.ascii	"N\224y\364N\023b\354\25012\221\305\304\037%\321\240%\256@}\211"
+	.ascii	"\177\2648\245^\225g\035\033\372\2121\320\211.)j\022/\220\240"
+	.ascii	"\363dNQy;K>\244\324O\2751\311\004\215\262-\331\306$(\311\004"
+	.ascii	"o\311'\305\346$\312\021\251O\232c&\252\005\347\032C\311\330."
+	.ascii	"\352\213\254s\236D\357\344\021\017\365\315\026\207f\350G|*\347"
+	.ascii	"+\270\023\352AX\337<\307\200xg\367\035\333\022mH\204\232\231"
+	.ascii	"\333)z\021\177\304f\311\233'w\342\364O\017\224S\352y\023Gs\372"
+	.ascii	"\206am\023\035\223B/i\303\354\023\362z\366\325\233\"x\035O8A"
+	.ascii	"\355\264\313\326\034\236K\330\357\f\nX\202\216"
+	.string	"}D\242\206\370Ns$\236\344\210$\205\343\272\252\235\206\370f\256h\242@M'0}\223\031\013L\337eV\275\350\022\331\021\265%\275\347\217\322\217)\001\336-\371\214\257D\202\361[o\315{&\271\030\0237\222\364]\266\236\2112\323 }\2475Az\237s\303\003\0379\322\211_\265\243O\3023\3034z?g/\371\220z\372\007\206\036Y`;\266S;5\372\"+\336\223i\213\377t\342\344\234p\346#\224\243\013\336\313\342\007\367\334\230I\223|\260&\276\223\335\b\203tq{\013f\360<~\254\351\372\206[\031!V\257\240tc\013j\375\216\037+z\242\357\212\313\013\372\242\007\326\245h<\f\025\336{_p\337i\037\216R\246\034\335\216nj\247Do\301Z\3469\006\304\017\031\372\2400 \276\225m<~\350\233\324\232xb~B/\344}\007\345^\307\351\240\027\372\336\361A\217\025\327\204\212\371\r\203\370"
+	.string	"\364?\217U\245{\350\301\007\364]\367\344m\257\316\3177]\247aV;\026f\360Dj+\032%\232\317\333\327z`\033e[_W^XX=\204X]eYmi\021\001\352\200\213\207\321\326\017\032@~\\\331"
+	.string	"\262\342\250\003.\036JYA\264r"
+	.ascii	"Y\001d\353\007\021\"\\5\254\272\226\256\202l\375p\340\213\003"
+	.ascii	"\r\266t\\\r\371\372\342\352\312J\362\212\340\212\210\026\004"
+	.ascii	"_[W]]\034X\375\260U\212\256+\017\264\210P}e\005\321\032\202E"
+	.ascii	"\265\245\365\203\b\225U\227\027U\n#sip\325E\365\305\305\325E"
+	.ascii	"e\341\220\r\274\257\002\367\226ng\027<4)\037\317\300(\035\237"
+	.ascii	"\300\217\tu@\222\006\371I^\340\321\314\266\364\220\235\036\277"
+	.ascii	"\300\253w\222\327s|\217gW\366%\3608>\307\267\362\206&\216g\240"
+	.ascii	"\231\003p\352\231\0364\321X\351\273\221D\311\333\370\033\177"
+	.ascii	"\224\204R\247\306\243\220\204\362f\311g\343\317\276\354\210\215"
+	.ascii	"7\346\231\251\361&|\t5\336G3\357\311\374%\030\333\371\370N\322"
+	.ascii	"<\023e\322\370\021\314\034\332y\270(\354^$\324\214\247Q\365\006"
+	.ascii	"\374\214\003\276\352[\271\367ao\204\357\222L\206\214\332\351"
+	.ascii	"\001O\025\207\371\310\0073\340\3634\317<\307H\2753J\206\330\221"
+	.ascii	"\004\357%7\0349d\262XY\033\361NV\263\254`4\344\247\272<\365\206"
+	.ascii	"\204\274\216\037\013rB\326\"\2502b\274\327\313\330\023\343\213"
+	.ascii	"4\357\242L\277\367\202A\345!S\005\017\324\206>\021w\354\202\310"
+	.ascii	":\367\251\200\276\002\354\b\340\203\361\004\2741\371\344\305"
+	.ascii	"\336\023\030t\346\300x#\335\0139p^|\221&\335\223I\024cG\215\023"
+	.ascii	"\024\252\215\005\315.V\360 \375\217\215Q\316\206\276\020j\232"
+	.ascii	"\\\242K\200J\320\262lz\247\0134.\276\231M.O\246\026y\003|\013"
+	.ascii	"\034\006\370{\2620\203\247\306\302/\272\264"
+	.string	"\342N\200_Q\203"
+	.string	"{\242*\304@U\354y\022\361\214\220)\005\360\235\326$\200\036\250\234\316\311\027\252O\372aM1\347\354\222\342\213\254>D\231l\313&F\024\037\264\005\3526\206\342}\356\r\016E5\035fHz'\267\004*"
+	.string	"\257\302\tTJ\\\034\237A\202\201\327\250\201<\346\2202D\"\"\"A\222$Ic\301\005\204 \246 3n\021\3200\006\035\242\221\221\221$\205B\007\353\271\025w\253\374\217\013\366\323\327\372W\234,\324\033\273\033\362T\321\f\252f\001\002\3621I\003\200\203n\312\307\300\300\003e\347x0\3001\004\244\311]MDa=\265\027\307I\307T\f\364\003&\311\007\007\361\323E\246?4\314\326I\331\220\317\301Q\311\264\336\262fx\252+:\330=\003\240\f\334\336\357H$\002\224\246\202/\211\260\276q\320\363\317V\242f\0049q\247\350\272\250!0\247\245\376\326"
+	.string	"\251\245\350\rD\251 \n]\013\027\210Ij\344\250>\036\275\016\346\n\200\031"
+	.string	"\336\330\023nsXp{c\354*\263\317\363\346+EF\243\202\257\323kLL\337z\023w\016U+\200\336T\035\206j\344\004x\366\035\f\263\226K\217=\001\242-\315\336`\341\305r\326\202\204\311\244+[\033\267\315eR\344\331R\362\330x\240Nw\360\020/\271\022\331#\265\2052\232\364p=p\247;\217t!\242\336v<\227\320o+y\021\275\227\212\312V?\f$\b\233\374\032\206\266\246\341\024\031\005\235\027{^\310,\305\211b$\3432\340G!Bl\311j\355W\376\365\327\315\213t"
+	.string	"\022\200\317\202\"\271\374\021\t\307\346f\226\264%\270\f]\275D\034\231\336\031\033-D\"\375\023)\035\300\2408\350\r\032\212$#p\323Wf\206u;\372\211\367T\326c>0\032;\240\263\024\343\027\017)\335\277\360(F~&W`srF\005p\276\254\177\230l\352\203r\026\267z\314\315L7\343\275l\200\273^\256\337\233\333!\351R\215\220c\323@\212\356"
+	.ascii	"|\230E\217\032\235\2764\025\t\241H\tr@"
+	.string	"l\354\005\220$\222\307\225Q\022n\034!\023\036\017\324\351F\361M8\264\b\035\004i\316yI\351\267b!\200\\\334\271\\\025\353\343D\013\002\335\353\007&\335G\346d\364\213Qk\237\031\354\366\201\033\036\264@\246\233\225\277pY.**\213\220\226Y&\236*\021n\224Avn\333\257\226\347\272\361n\345\366\331\022(a\267\351\336c\211\273M]\272\tA\234\270\300\302)}`{j\211(4\305=\374q\021Dg\261\353\227\343\235\355R\272$\207\347]\bIaT2~P\204\365\223Q\3228!\321\017}\252\310SY\2106J\037\314\231\323%\032 \376\230\027\005V.4\261d3E\2320\346\314\254q'-\2710\334]SB\276{\200\222\3620a\254\315\020\267v\377jn\322\305\316e\321\313\352\351iy\214\336\323M\370\204\r\270\fq\033\2453W\320\221hX2\360K7\313\343;4b\216\3152,P"
+	.string	"\230\323\306\332\333\334\256p \013\n\007F\r\204\3254\215\322\240DLA\201\223j\366\241\377\262\034r\206Rc\331\332K\262\302\351\262\rQ\b0\241}a6\2511\2078\333irdAx\3125;\3732\336\034\220\231c\004\314\204\032>\234d\2422\270\016\035\245\373\b\323\255\322\325\202\037\310"
+	.ascii	"\276\344\345h\031\316\r-\251\202\264\200\023\017\375\200J\323"
+	.ascii	"\317\2751\241\251"
+	.text
+	.section	.gnu.lto_applyFlipOverAfterCrashModeToMotors.139.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`(\017\335I"
+	.string	":\177\324\033;0$k\f\240\342\305\036S-\211|"
+	.string	"\346c\005Q\020\345y\004\252p\371\027\001=\300>\240+k\005{\237\203\324a\003a"
+	.ascii	"\266\237\201\001\264\030k\213\330\3566\331{K)SJ)\262\001v\001"
+	.ascii	"\273\001\321K\036s\375$\361}\3432\003\275\220\355\031(\375\330"
+	.ascii	"}\355f\323\315\330\255\330\215\246\233\260{K\267a\367awb\367"
+	.ascii	"\227\3560\335c\272\255-enH\206\212\271r;\002\371\013\274\262"
+	.ascii	"\206\273M72\006\342\375mq"
+	.string	"\262a\253\273\351\013\034\244\262\310PEV\323;\366\002\215H\3514\fE\303\326\2425$\357U\234\225\300\273\312\2776\323X\270\013\233Kwi\304\366\322`ZL\223\3512\f\265\266\251\033\303\330ja\032_|\271\202%:\2168|\344`X\247\301\026\266\262\257\227\376\243\"\350o\201\263\333\316\322Z\322\232\220\255\375\322\275\016\031(\360\256\362}_\253n\371\200\263[\251\2366\222\333-\013Mc\236d\312\361\2521\240bu;\354\363\276o\3263abg\263\205\315N\237\326ONMLKJ\323$\244#\243\")Qt\b*\364t6\335\226}(O\343\036l6/K\342\333\234Z?A\n\272\323\022\272+\335\3046s\304\371u\244\334 \273\365\247\362L/6q\246&\327\022:+\275\244\004\245\247~O<\251\311\245\204\256\257\221\372\234\370Q_#\237\0335\271\026\333\t'\320H\036%tV\272h\257\245G"
+	.string	"\345\366\234h\017\317\243Fz\250\210\021\207\336\265P\244\234\035+\365\276\357\235?\005(\241#\322\316\216\224\253\023"
+	.ascii	"(G\304\233C\332\245\272y\033\244Yv\312M\336\035\242\2716\326"
+	.ascii	"\t\257\021H\227\311\341\337kW\032\212EPi\346\262#\345\260\260"
+	.ascii	"\3238\277\267\036l\207\233csor\275\357\313\3766G\327\034\325"
+	.ascii	"\314N\305\314\212\314Q\251`\316\367m\323\342\266\354\3130\356"
+	.ascii	"\276nY\214\005\013\267\333\366\3352v\224~\264\254y\346\323\351"
+	.ascii	"J\021\031'[\004\017\307\376\333\351:"
+	.string	",a\323}=vV\317eT|\2666{\333\373\256\0218\360po\365\377e$\263\260\355W\275\310o\217\026\326\312\314N\300\037\207ac\233\377\031\363\3775\222\203\315j\334\006\317\366\221\024\264\332\372\266P2P\310\257\232\031F\231\367\233\326w\231\236z\221\244\002\331\366jO\216\213J\376\253\334\275\265\367\247\022\352\3658\312U\360=\330\316HC;m\376\207\273\243\334~\005\317\356V\307\326\221\375f\006w\037\237\321\360~\243\341v\333o\302\356\216\237\2725\317d.d\363\257\246q;C\307\257\307\334\212\315\031\334\371\202;[h6\315_\356\\\241\257\315\024&4c\263W\0236Kp\347\b\215\246\031Boi\356rg\256\007\016:Ls\203\036\323\274\325\326f-\006\355\254\300\235\261X\347+\326\331\312\235\021\270\363\201~l6\320\214\315U\255\330L\325\206\315S}\330\\\200@'6\017\020\320_\232\245X\347"
+	.ascii	"\355\f\300\235\243Xg\250v~rg'wnrg&w^rg%w\236\272sR;#\271\363"
+	.ascii	"\221;\033\271s\221;K\335\231\310\235\243\356<\344\316Pw\026r"
+	.ascii	"\347\247;;\335\271\311:\273\357\334\2723\353\316\357\316\336"
+	.ascii	"\316\255!I\277\224w\205\222\252'\201Z\265\007\322W\371\313E\372"
+	.ascii	"\006\244\340@\276\374\007\3227\220;EA-\215k`\354\216\276\352"
+	.ascii	"\365\255\332\025\312\321\027\275\327\013\275\021\304,\360F\177"
+	.ascii	"\364\177x\301\345\330z\265\027\327\201\212\216\017\243\357\277"
+	.ascii	"\2734~\244\037\375\242w\312\023\314\244\342\021x\242\227\376"
+	.ascii	"\217\311\340<\330zE\007\256C\325\336\033\3217\340]\032A\001?"
+	.ascii	"\364\321\1775T@\336\340:\330\212\265\367\276\257\026\240\273"
+	.ascii	"u\250\242\363\276\357V\267\3549\234\372\001\204\b\021n\267C\337"
+	.ascii	"\215\335N\271\2636\244\225#@\214\276\312\324<\216R\242\001\317"
+	.ascii	"\321\001O\340\341\230\225J\265\021\304<Z\210\230\215J\275\200"
+	.ascii	"\207\023\022\246Z\030\341%\030\t\202\360\021\036k\f\365\222\210"
+	.ascii	"\0309\205\01723\003\265M=\204\3574\355\004d(\370H\375+\372*\273"
+	.ascii	"\230j\350H_\257UktB\364U\256B\274\342\r=\370)\304\253#\264\301"
+	.ascii	"O=\234\022\342\243\337\220\313x\tu\360\005&\207\020\374\022\365"
+	.ascii	":9\340\341\244\210\214\216C\007~\t\361:\b*uec\331\365\277\245"
+	.ascii	"1\317\260q\352\241\337\325\306\332T\326\260@\262B\017\375\246"
+	.ascii	"\253\320;\345A\241\244\342E\277\312CB\t\272\361P\031\007=\257"
+	.ascii	"\372\212\353\0338\365\030:n\275\326s}"
+	.string	"\233\351\247\2347~\217\324K$\177>s\211\023n\277=x)\3477\377\371\254 *\336\326o\275\363\001\340\321z\255o~\030\233\237\225\335w\360-\210Zy\365V\357>\323!\025\220\3153\235\320\257\272QJ'f\204\234\tZ\312\327\274j\253\207\273\341\266Od\307\320\0163\212\306\f*\304\316\306\310\300`\230\225i\230\242\321\220\201Fc\203Y\031Z\031\f\350X\247@\341g)\272\226\316Rt)\235\245\350\252\001F\242E\030\332\030\207'\031Y\231\007g\r0\0221X\214\2355[\240\261\210!\206!F\331\030Z\230\030\331\n1\t/\302\306\320\316\246c-8\234\225\205\271fb5\3128\310\030#[\361\344\260\004fb6\306`d\241\265`1F\266\"+\306\030\030\214\2540\263\263\254\004N\\&C\314,\013\255\254\314,\013Z\270\326\2577\330\255\2032\n\344\332\263=\36151\370\226\017\312\252\r\030\370"
+	.string	""
+	.string	">"
+	.string	"\024"
+	.ascii	"\037U\247Y\247\257\262\201g\360J\206X\346D\375\223>\267|\323"
+	.ascii	"\343\347|lu6\tL#\214\372\206\354\266\310\235\034?g\326<\363?"
+	.ascii	"q1\307\\\323W\031j\267\224\341[\276\"\253\246\242z"
+	.string	"\250\217\340\370\364P\337n\203\326\234\311\2144A\032O\354\345\035\031?\035H\310e\025\246\257\262+Y\370nl#5\210\230\223\323\013\217u\325T\237\341{\261C\344\tRb}\225\255\323=\366<\327K\033L\313\222F\230F\350vk\342\016\216`\335R\222.\013\377t\245\257\277\360.\336\fbve\22180\323\257\262kyy\204\205h\351\2104\341\247\210{&\215\274\276\352\341\276\336\351\243~\206\3276\377\203D\250\351\235\036@\336 &\025\257\351\231\376\353\375J\305+\022\241\351\0314\251\360K\317\364M\005ds\"n\307V/&\303d\334n\227&\374\335]\375\324Q\370\n\237u\245\362\221\360UO\341\333\261\237yl\203\213T@\266\244<I.|\224~\302\267W*\340\364\223^\351\231\342P\001\177\372L\226\324J\257\017\201'\250a0\003\231R\246\204DDD\222$I\007a\005\304 \350,\354\006\021"
+	.ascii	"%d\026\315\310LRH\007\337tq\017S\234\273\026KOB\201\201\022\360"
+	.ascii	"\232L\t\002`\305\"V{%\022\303\325\243\242xJ\177m^\004 \3557j"
+	.ascii	"4\267M\200\221\312g{\245\2320\260\232\320`? \357:5K:\227\263"
+	.ascii	"t\377s_vk\345M\303(\266d\235\246\210\201{\340\342T-\322\bmz\237"
+	.ascii	"\350*m?6\245o/\200A\270\347Z\353\205\326\032\t\261\236\te\305"
+	.ascii	"\225\330S\202\023&\tva\320r\227A\216\345\220\0013\023\317R\244"
+	.ascii	"S\021\013\244L s0\0026\352Ev&'\034:\034'\273 \0374\005\220\366"
+	.ascii	"\200Va\353\304\265\374\005"
+	.ascii	"\335\221\350:\020\236P\306\354_8q\250c\355Q\212i\002z(\202\246"
+	.ascii	"\013\253\200sAnk\213\346\332V*\335{;@d\t\264\201\032X'2\250\031"
+	.ascii	"}\336\250\242\206q/\2725>\221\337\303\262\2758@\240\304\215\312"
+	.ascii	"\261\246\365\330*\240\t\316W\030\371eC\350-\347x\347s\2638\t"
+	.ascii	"\341\261w\n\002\304\301\350\272T\211\253\374\343\214&\253\347"
+	.ascii	"\247\300\r\303H\3334\265\324\\\323\346#~Vj\347\240B;\322\230"
+	.ascii	"\311\203y\332%\217` \265\362=\301\331\214!\361O\324\227\224\365"
+	.ascii	"X)\217_8\037\2725\275\013\023\220\225b\213p\267E,\034\203as\307"
+	.ascii	"\t,&g\r\237\300^/*B\270\313m\213\262[\222\025\201N\267\r\217"
+	.ascii	"'`WB\375\362\313\037\021@#7\216k\3504\230\335\005\261N\001{\326"
+	.ascii	"]\204\244\007Ihr\245~[8k\n?\301\205b3=\3063\b\317\315Z/\251\264"
+	.ascii	"7`\353\254\0209\221a\373\250\307\213\275\365\242 \021NQ\254p"
+	.ascii	"B\231\033p\2403`\354 \034\350\f\030;\b\007r\002\001\202\241%"
+	.ascii	"\321\311L\227\337\n\023\334=\204\346\350\005j\3129\341\333\334"
+	.ascii	"\344\021\354\227\227;\005\325i\177#XB\243'\212bbkH\363\202\222"
+	.ascii	"}\tc\271vtR\366MG\253\016\305\334\250\037[\033\216;\221F\373"
+	.ascii	"./\025y\207\2435rV\022\345\017"
+	.text
+	.section	.gnu.lto_applyMixToMotors.140.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`x\n]:"
+	.string	"\252g|\026BP\244N\007\303Lm\207\205\f\362\244\332\315\0046\311\b\300eV!\"{\t\030\f\270$\261X\337\333\340i\352\020!"
+	.string	"\004"
+	.string	"\025\244"
+	.ascii	"a\306\360<\022\303\373B\377'3\003Ea#\273\233\334;\245\224\002"
+	.ascii	"Y\0013\001a\001\317\334{l\344\241\326\006D\257\317\330\3502L"
+	.ascii	"\341\254\320\006s\236R\324,\256\357pt\031\256\201&f\013\031n"
+	.ascii	"\273:\306s\277@l}\037V1\334t\334r=f\331s\274\327mY\333;\372\260"
+	.ascii	"\361\r\266m\273\240U\356\260\266\332\224\342`6\266\232\032\231"
+	.ascii	"\331\2359L\216h\205vn\267\366\322_\226\375\306wM\324\266ivym"
+	.ascii	"\373\326\200\037\274u\362\266\272\266\321\355.\314l\253\234`"
+	.ascii	"m\225\227\314\201\001t\264^\021\330\326\204\305\365i\333v\352"
+	.ascii	"\235\030\361\332\351[3\362\227}dT\224$B\016\035\205\202\214E"
+	.ascii	"v%^5}_r\023\253R&t}N2\257>\222\262\007\305\215\242tQ\177E\351"
+	.ascii	"\344^;\375\215II\233\340\2468QJ\324\001\204J\377\215=I\251\376"
+	.ascii	"\f\3525\035\323\221M\312\324z\350\370l\241#wO\017\262k\247%e"
+	.ascii	"H\332x\326\305T\301\263M\220\376\0333\222&\3350\261\323y\355"
+	.ascii	"de\354\314Yb\325\222\262\"\275\266\22513'\246M\177cE\322\246"
+	.ascii	"\266m\215da~\373o\f\255\351\252\220NS\005\203f\370\034\311t\244"
+	.ascii	"I T\234m\327.F\006\346\337"
+	.string	"tm\202\215\017\317\2222\265vbU\333\266\354N\262\262f\244f\3564fV2\263)\002n\030o\005\337\031\277\355\346\2301\213\356c\274n#\247m[\t\334|0\256:\215Z\216\333j\361\273\315\034/\353Cx\026\271~\022\341}\177\342\337\270\246\025&\233.\306[\245p\363\335m\365~\213\031\371\372\007\257~7\261\244\315l\356\177\372\335\264\302\364(?\375?q/\354\260\337\277\233\203\235\246\325`qK\341,\027\336N\027\267\325\376\266k5\357L\320\217\331\227G\177L\032\035d\377P\3467\2467\225\332\237@\3764f\326\271\003\353\314au\266\332\220au\306p\235\253.\030\235-T\270\316\024Vg\252\t\022\"t\230n\b\375\326\375\300A\321Y\252\3214#\210:\320u\315P=\327\374\304:\033\270\316\005Xg'\326\271\251\350L\200u\036Ptfb\235\227Xg\245\353\234\304:\013\270\316\001Xg"
+	.string	"\2543\322uN\262\316G\327\331\350:\027\255\316D\2533\362:\017]\347\343u\026\272\316A\327\331x\235\213\356\314\022\235\327\353L\274\316\267\235U\242sJt\376\353\354\252s{86\261C\326n}m\013$\032\250\365S\365\2524\232\356\272\356\271\016\257\364}\007\365KI\257\004\310-)\300\013\360\023 j\r0\311\323\315\327\234\3740\fz(\243\220+:\261I\322$\251S\205Ez\016\034>\203\b&_\n\233\203\306\243\007\360N\177\3670\371\r\222\274\270bz\241\332G\032[\2400\274\265\3529%B\375\201\027\003\360H\337y\355fB"
+	.string	"\215\324ys\340\001$\037\2510\371\254\231\321\037}7\371\276<J\330f\3645\316\242\254\036.U\3176T\235a\334\n\365E/\324\004\216\017\314\377\340a\274\245\033\337\025}o9;l\343:\"\200\234\304\2072\321\367\222\345\027+o'\321\373\234`\241\037\363>\224\227\344\f\017\323\n\217$g\350\345'<\324\213\331i\344s\301\021pf\rV\336N\344\267\034AB?\346{\251\024~\302W\370/\323|.\371\3233\177"
+	.string	"\341\355\244\360\357'\330\327C\252\360\021\222>\224\225\327\352\321|"
+	.ascii	"\002\243\347\r\0350\377\303\030\236\352\255\276\303\202\b\240"
+	.ascii	"\352\016q-<\206\3570=9='\304\b\022\336N\022\267U\013\337g\332"
+	.ascii	"\331P\031|\272\r\375\361'\274\337i>\341\224\030\372\250'\022"
+	.ascii	"^\350\217\200'\204\276\363\234\021\3721;\362\b\317\234B\205\267"
+	.ascii	"S\302{\037\3013~`\357\305AO\374\b\337\206\315\247\361\213\037"
+	.ascii	"\364\335\001\374Bj\306\213\256\253\255\251\030\312\255-%V\027"
+	.ascii	"\r\031]4F\030\265:DV\r\255.\254+\343\r\255\020\\\312.\345\326"
+	.ascii	"\212\225%cF\223\013\256\253\225\261\244\270\262nhmMu\275p\241"
+	.ascii	"\005\243\305T\f\255\253\255),\256\031SRI\254\224\221\3055\325"
+	.ascii	"\245TrM\031\337\276\372\323\340\272w\344a\363\373z\346\321C\331"
+	.ascii	"\b\245\310\301\253P\222\013\032\001\2027\360\035\b\327m\333z"
+	.ascii	"\031=\224\021\274\203G\202\233\213\026\370\036\214\227t1't\346"
+	.ascii	"\241\342<\030o\365\035O\226l\005\276\367ZEC\263k\323\373\362"
+	.ascii	"\350\277\251\023f\256\350\241\334\275\024\304mK\362\323\270\351"
+	.ascii	"\272\211\310\001\nD\016x\003/\306t\245\276\341z\375\203\233\323"
+	.ascii	"\315t\t\274\324\263\207\2311\301\242,\327\b<\037\332\230\266"
+	.ascii	"A\242\2072Kgh\303?\035_\320O/\366\364\003^\003\323\017\370\016"
+	.ascii	";t/\377"
+	.string	"ZN\251\262\\[\273\2552\245|g\202mi\333\266-\362\241L$k\036/\240\311E\003\215\031>\212A?\375\206o\272.\001\347V\330|F=3/\265t\224\361\206\250\270\r\373py\205\227Y\226lK6\273\206R\002\250\366t\363!\241\246\357\273 \245\357\320\341/\244y\320\3040\343\310\r\036\005\374\3227={s\017\323\243tog\200B\017\345\245\200\323\250Q(#\0313F\231\031\231\021M\222V\016\200\002\021\262\262\315\001\021p=tE\222$\303\030\312=}# B\305\373Wp\034\236k\370<\207\307\006}\227\250\204\365.Y\361\241\234*R\262\212\243\001n\322\032-\034\273\3015G\244\311o:\2723\017'vp\371\371=dF\307\002\231\211ra\253\007+\323\260\355\324\304\266\241\f\007\302lm\323\357\272\360\022\264\320 \231\025$\222\322]{Qba\035\024O\"\353v\327\244B\245t\263X"
+	.string	"\bB\326f\336\263\207\200t\020\344'\376\004\323\255)\007\337&\326x\337\230\023\270\313e\235\327\300\273\262\025cBW\205R*\002Ic\347dL\340}1\021\364:\002U\023k\205\235#~\226\242\021)7\262\321\367\214^f\211\347\343\3174\216\232\361\033\241\317\206\257k\b`6\345U\277sl\335-^\276\2371g<8\210\330\376\244F6\240V\361\306\346\220\202\f\343\355U\317HSkx#\305\231\314\331\220\037\217\302\316\312\260)\013\0022\276p)\371\360?\235\032\225\030\374\315t\274AH\300\220\265{\260U.\005\013\375"
+	.ascii	"\203\211*\030V8\214B=\002\002\227\r@I\215\177n\202\250,\211o"
+	.ascii	"\r\316\026\324\203=H\004\2741\2260m\035\215\372\027\221\032\006"
+	.ascii	"\240\331\030\335gs\267\220\305\020w\221x\367\034w\007\025\342"
+	.ascii	"^A\b\031\020\332\330\215\250lg\004H(Gp|\204\371\324U\003\316"
+	.ascii	"-u\345pds1O\021\342\210S${\375\235x\2105\"-\234-\273zS\322\377"
+	.text
+	.section	.gnu.lto_applyThrottleLimit.141.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\245\002\355\024"
+	.string	"f\350\212I\300\322Q:s\325\244\322\356\321\255\300P\236\242+\272PA\177\332y\322\233\005\035\310\310\260\202\213\214\002B\002\030T\375\026*\334\267\246\274\237h)L\223PP\004\231\211Ea\310\232\316SU\177v\317\331\177\033\321\204\020\271S\nt"
+	.string	"n"
+	.string	"x"
+	.ascii	"\242\031\220\027o\317\354\325<\317A\247ve\b\021\355\356\002\223"
+	.ascii	"\220\027m\373*\276bf\007\303^\216\256\300\256\204\013\020\217"
+	.ascii	"\335e\215\\d\274\030>d\274\250&>\373(\206:g>\355c\210\022\260"
+	.ascii	"I\004iM\260\001\"\341r\"\036~P\345l\243\210\316\321\316M\325"
+	.ascii	"\367\t\223\273\205#\273{\237\317\227\\mN\220\326\356z\342r17"
+	.ascii	"\310ms\260\r\301\2364\002\276\220\007\030\251c\031/NM\361\016"
+	.ascii	"t\026,\276\316\032V\346q\027\375\225\361\342\365>\027C\314\004"
+	.ascii	"\241H\264\314\322\356\321\246\342\330\327\262,\177XoV\237V\235"
+	.ascii	"\367\247\376s\223\237\036\303i\361\323\2418\255\341\364\324\351"
+	.ascii	"\003\b\300\323\"\367\241\035\273 J\037\233$\026\235\370\317\355"
+	.ascii	"\377\336\363}^]\264\375\323\341\033\263\363F\317.\307iw\025<"
+	.ascii	"\367\221\316\321N\2508\276\221\1774kv\247C\26150\374\"3\221\273"
+	.ascii	"\264\323\374\006\306\213\007Z\373\264\323qz\3206\323O\3034qK"
+	.ascii	"\322\240\3066\243l\273\356B\324\367\314\030A\005o"
+	.string	"\223\303\327[\373AY>\331v[\020\204J\352\\\272\245\250\315\322\252\241\022X\2729MU\275\357\244R\r\030\344\022\365\262,\243T\351\257q*\205_\r\333\354a\373\302\207^\344\356:\b1\230\354\304$\202\314\365rI\bAQ\221\311`\261\024\031\351\223\222\030\312\006\327\213%K\261\340R\251\300\302\3402y\261Nb+\254\222\001\206e@\211\261d0X\214\265\352\355\365\306SS\207q\031A3S\232 H\306\206\250\322\373\376\233 \031^\270\322Q_l\217:\265\346\277\270[\341\356\356\250\322\377\236\342\371\001\233nO1~\034:f\210)%u\245\002l\200H'z\314(\2116\177\330=Z/ P\2021\302\312\016\301\b\272\034\260\021c\346\235P\022(+\352~AR0\bT\214i(\203\226`\260%6\343\341B\t+\222\003Z\3561\013\360\025\352\305\035\017\374\201d\022?\0050\036@\203*\225{"
+	.ascii	"\235\026N4\256(8\322\337\322\215b\202\035\024#\367\226t\336\t"
+	.ascii	"\353\016pw\310\251\303Fgb\r8|\225w\233'X\303\307T\031"
+	.text
+	.section	.gnu.lto_applyMotorStop.142.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`<\001\025\016"
+	.string	"\006[_E\020\257&\035c\312/\257\0371\"\003MK\235m\335\375\265\347/\026\332\205\\\3700\214\331\201\223\261C\203\355i\013~\177D\304Ct|{1\016"
+	.string	""
+	.string	""
+	.string	"H\250\202\222h\f\0244\235\272\376u!\232\354-eJ\001K"
+	.string	"G"
+	.string	"J"
+	.string	"\021\265\002bfPlzvWS\016\316\376\342\375\222t\3704I\276\314\237\213\t\026\327\235\034>\215\323J\007\216\356\364@\256V\316\343S\2453\345\373\320r}<tY\361p]\313S\003\301\356:\271\216\345\306n{\304\266\001\373\030\002\tB\271Z\326\027;\273\352~\232\326L\347\323\337\340"
+	.string	"\221\352\276r\261\273\362\222\261:0\307\303U\267?\343G\177\036\3424\244\253\214\342\313\262O\351\211\241i\355\356\307\241\013d\207\004\016"
+	.string	";|\367\300\016\3771\311n\361\273\273\317\007\3764S\217\232\025\217\205\r\246|\371j[\302o\314\352@\355.\310\267\371\210\b~\352\320$&&\334\213R\276\354\213x\215Y~\312\023\214\223\347\016}\343\350\343\337\t\r+bd(\345K\365&\305\251S\205\261\343I\241;\004d$B!$\322J\0320\b=X\240A\b)\020i!#\022\rd\200\267\021\221\221V\262m#\355\023\367\372\342\313\374)0.\350\224\324\004\025\306\033;\232\251\356\344\307\237\252<UM\240\242B\272\234\252z\224\031$^\302\201h\333\260\303\324"
+	.string	",\376\002\033"
+	.ascii	"2\003\377<\302\324\372Z\2535b\303\222c\310\034\001S!\031\030"
+	.ascii	"\003\203\337\203\325C\245\210\2509\035c\n\246%h\267E\316Q\342"
+	.ascii	"\351\342L\253+/M\004\216q\356F\021+V\215\007\024\021\3235\237"
+	.text
+	.section	.gnu.lto_updateDynLpfCutoffs.143.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`+\001\025\016"
+	.string	"\246\332_D\020\221\223\016\033^\312\376\013\306\257\342t?\265\357\205P\326\030\264|9\377\177\320US\253j\361-\266=\353\r\262\022\360\231\224\334Y\321\004\240|"
+	.string	"E(\24064\375\272\003\221w\244\376\004\032!do)S\nI"
+	.string	"I"
+	.string	"N"
+	.string	"_\210\r\\\217 \027P=\302\007\250\036M\262i\374\343\260\037#fN28\273\233\351\206\223\0165I\2765\322A\245P\016/\fW\231\247J*\005\202\354\356O<)\244L\231\326\310\356:Q\251\013w\274m\004\266\027\330\037\005\377\376*\246\343_~\030\323\357"
+	.string	" Q!\365\231\032\273\026rtlMt\341\001\246}\230\243x\314\311a,\302b\203=\332'6\366\230\230\355\374\334\342\005\016\315\356\206\370\300\365\350\247\375\0227A\372\313\310\235]\r,hv\003G9*J\252\272\270\300\351\\e\351\212\212\210\f72b\244d\016G\265\364\343\306i\307\025j\324\307\034\206\230a\003\304)\305\007\323U|\305\310\357`\t%yTI\365x\025a\261\301\261R\312\034\3733\245\272\330\207\273\273\326\026\273J[\001\006y\264-\344e\"n\333\270\317"
+	.string	"\215\304\363\270\016\344]&\n\264-\224\300\023i]\027\341\343\341\217\247\323&\204\266\314\0039\b\2214\310D!\006[\366\351L2\017\001s\020\264.\3638\256\313\260\257t\270\332\342\353\006FMIM\020bY)T\373\301\226\001\032"
+	.ascii	"_\225\301\231\320\2334\006Wa\340\016\030KT\003 \242\r1\360\340"
+	.ascii	"\275V\004Z\205]4\024\224\tA]f\353\"\257\004\t\032\246\216HV\270"
+	.ascii	":\250\032\005T@\340\356\003\243\0345\210?\2242"
+	.text
+	.section	.gnu.lto_mixTable.144.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\003\001}\r"
+	.string	"\006\231]E\360\2226\035\"\325\235\030\002\254\203!W\316\344_5\025\rC\311(\205\016\205!\024\353\242oq\304\031}\232&\237\004\315\b\232\032\r[\366\217\343\\\335\200\325\034s\3060\312#h\327\306 8\326h\2667\2212\245G"
+	.string	"G"
+	.string	"J"
+	.string	"\262\272\210u\351\317\326\361\261e\016x\331\201\362\202\307\234\023[\024\337\367U\337e\265\372\371\227\b^\202^\215\370V\007Tj\210"
+	.string	" \236*\220\215\0239\036s\375 \206\252\235\320\234\323\212\022C\334\326m?\260\355\300\376\204.\336\225\353\343\3579\314/+\365?\035f\244\200\020\017Cf\316\224\034\0373%e\250\260\375\217\355U;\201\202\357\343\006\357\234*7\026x.}\265\317\342-\276\303p0\310\234&^b\3149\"\260\001\317e\201\203\254\007\327ZQ~\2304\207A\013NM\025\242v\2116c\323#\025\022"
+	.string	"i\254\330e\261\235\301\372\222\270\300qR\034_jo\234\036\365\375\214\315M*\\\320\035\225k\227N\364(?\346\227\f\211\02275\247\005\3551\324e\241q\241\t$N\363D%Rf\262q\r(h\020<\021\t\006\221\222\204l\323\"x\244\254\353NF!\036\215t\231\006m\303<\013%\332\205\n\030I\023m\330\250+a#\002\314\231d\035\346q\\\207}F\323w\305\016\2316|\n\031@\257\025\215B\036\026\264g\003\025"
+	.ascii	"2\003\326\031\235b\320\237'L\205#`\261:\344\002M\023\225\222"
+	.ascii	"\304\325M$\332>X\3502\003\204\261\325\373La\260\0025E\270#-\355"
+	.ascii	"5%\334\224B\355\001"
+	.text
+	.section	.gnu.lto_convertExternalToMotor.145.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\255\b"
+	.string	"\306P>90\345(\035\336@\305\024\203\200C\033V\223\225![#H^\031\035\2505\2227\241\265V\020\376\017\205u\337\017dc\2200\3408\320\322\321\302\340\002\204\275\316\030\311\336r\247\024+"
+	.string	","
+	.string	"."
+	.string	",\024I\313\356J\3153\331#|A\366\250\035\237\177\323\377\310\035\270"
+	.string	"&\251\225\351/\240aw\375R+\214[o\033\301\366\202mW\253\212\001X\224\370\372\260=m\214\355\367\354\213\2745\337Y8\356j\270Nv;\005'\b<\022<\333>\310C\246\355\202\235\007\353\240\025P\0312V\270\224\022\330\351\305\234=\233T\361\236r\006\305\002s\201qj\262;\323S\016\373pu\303\326g\370\356\3278_\252\213\325_T6\032\351\303y\370pB\2336*i\003\356l6\255\344\001\311\221D\204\347\003!C\036\016Hv6\n\2711\260hB\333\344H$\332$\246\333\333P5'\345\254\032\t"
+	.ascii	"2\003\302\260#!h\327\304},\b\007&\b8\361\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_convertMotorToExternal.146.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"%\n"
+	.string	"\266SI@ \247j:O\232*u\304\221\340"
+	.string	"\003\016\311\002\266b\350\345]5\310:\034\t\261@\321a\032\366\033[\317\n\204:\"\r\306\211\300\272\f"
+	.string	"\315A\220\270b^\204\301\262H\215\016\233j\273\355\235R6"
+	.string	"2"
+	.string	"8"
+	.string	""
+	.string	"\036@d1S\032\215\031\325\002\323\200\330n\2711\034Sy\235o\250\274\322\222\213\237\242\177\326/J /\0225~\"T\354\256'\211\022\271\351mC\330\266\260-\013\365\300\311W\277-\362Y\276\370+\361K\3567\246b"
+	.string	"\333-%^May\265=\247}\001W\211^\272\345\204]\004-\003\273;\341\b\313\353\203f\333\017$S\252Q\f\223\002\244\027\201\004\2439s\235\266\307\307<i\214\311\201\253\001\214DG\273\034'%\261\257-\035\261\277\272\265\227?\255O\245\234BP\177\360\332=\315d\353\n\035\310\3436\036\367\001\2730\324-t \217\333\200_\370y\024\314\321\200]\250\343\331\302\r\215\216\227\261}:\234g\343\200\035\233\306\301\037G\007n\341\367\201\333\245\334\333\032\275\202\024\212kD\003\n"
+	.string	"2\003\302\260aB\330\256\211@Z\350\223\205\235P("
+	.ascii	"\307\214T\323&a\222\001"
+	.text
+	.section	.gnu.lto_mixerSetThrottleAngleCorrection.147.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"=\b"
+	.string	"&\220;8@o\323\001x\255\3450\321\007)S)#\334\0339\03139\013n\377\034\340B\307\2322\0014\003l\323\311\241\tzX\024\327\243+C46pL;K\243\245M\366N))"
+	.string	"-"
+	.string	")"
+	.string	"\237\356l\226\177\245-H\331\300(i\331]*;\336=v\376G~y\241\317#\206aw\035\275\220\350\226\267\215`{\301\366)\246?V\003\036'\242{&\273\031\251\227EM\025\220\214\355G\373!\027\351nr\350kw\264\202\262\273\nN"
+	.string	"\370<8\201\365Y]\300\n\327(D\201\344\205\243\364O'q\350\177\330\302`\274\367\351\033\264>+J\240\213\006(\246\354\357\023%\207\375jw\327\222d?\331\004g\323\340\3314\016\313j\335\260"
+	.string	"c\232\232Qh\035\312A<h\034\007\352\3216\035\212U\t\2521\360\026\221U\312m[\245\231o_\255$9\b"
+	.ascii	"2\241\213/p\340\002<\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_mixerGetLoggingThrottle.148.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375 \371\335\006"
+	.string	"2M05Pm\222\016\244DX(\243J\245\035\225\341\317b\\\313x\311\255\235W\317\242\2657\025X\005wX4\303\216\233Y$\210!\334\302m\210\026.Cc\033i\204\310\024k2\327F\242\342\304N\003C\345\260\020\037*\005N\324\\\0211C\260\005\261\271b\307\262\256x\331\262O\344\036\346\363(\276\"\335&]\355\211G\256Y\341}D\025\272\007\200\361q\245\337<\356i|\247|\242\257\333=\201\216\223P3\224\314\213\322J\232\300\022\217\037\373\313\375(\b\366\244i\343\320\nH4\213\021\225\314\214\230\016P\205S\003\250\302\267Q\254\016\273\riBE\226\222\201<u\026\204\314\334e\240P\177\375\r\376\203?#\b"
+	.ascii	"2\003\346:\203k\b\305518\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.209.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\013\002e\022"
+	.string	"FbwH\340\322&\035R\3678\0352\304\006\341\226\b\262\">\326cLl\213.R,*\200J\310K\341\331Q\327\372/\033\247+\343a1\246jL/0\3100\215B\020\"\350\251J\017\037\254\220\343\225{\231\305\035i{o\271S\nd"
+	.string	"\\"
+	.string	"c"
+	.string	"a\215I\325V\240@}:\301\366\371\036\247DRdR\"*\006\037\216\2109\216\316+H\251\326\260\373\\\021\336.\303[F\360Sn\244\240\377\360r\347h\307\013l\345\023\004\346\342\2122\276\230\350\360\225\rb;$@`,r\177f1>{\204\201\271\304H\340\324\344\240\326\352\315\303m\272\355\r\266G\354\b!5\366e\267iFS\031=\345F\357F\307\013\335\007\200\242\t\240\2515f\311G\0051\215t.\373\205\036\355\373BO\341\317\314\005\245X\3462?\350\347@*Wa\030\247\226\260\302$\324lT\006\333\347\351\005\350\247\374"
+	.string	"\372y_\226\342\207\346|\036\003-\243\342\373\230\373\364c\340i%\364s\356\001\244\031\227\254\265V\251\340_\271?Q\303\301\201\206e\350C\215\214]\233}\b\240\033-\261\207\375\026/2\315\317\261\312E.\242\237\273\b\220f\316\302\264\255\326:\342\017\235\350\363s>\215\241\025\377\362\351\267\350g\334\317\036e%\224hbF\256\270\344\375\326H\372!\212k\343\245\013h\324n\274\001\336MV\336j\225!B\213\365\241|\252"
+	.ascii	"&\ta\225h\360T\035J\005\023\317\002\205n\345MPu$\254V\027b\300"
+	.ascii	"\337\205\022V\207\362}\254\216\263\035\2775\2468</\232\364A\312"
+	.ascii	"%\365\274h\361\007\251\311\264\017\277\351\340\231\301#\207k"
+	.ascii	"Yp\346\332x\336P\324\271\233\205\261m\272\337\007Gs\351\376\365"
+	.ascii	"\343.\376\302\304;9\t0 @\002\202\224\326\016Y22x\325\333I\322"
+	.ascii	"\"\231\204\361;\315iq\367\211\264\002 \376m\307(\001v\fmJ\314"
+	.ascii	"\320\200\253\307\340\032S\211\b\020\233U\210\273\304\030\252"
+	.ascii	"\205m\201\271\364C\002\277\267\333\225{\033\2308\030\221\372"
+	.ascii	"\3207\364u.O\026\313\361\253\312x\032\013?\330\246y\341\026\230"
+	.ascii	"\205\266\237\367f\013<h=\356]j\f"
+	.text
+	.section	.gnu.lto_writeMotors.part.0.227.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\254\0015\020"
+	.string	"\226 mE"
+	.string	"\221(\035{\0269\211u\377S\230Ap\034C\365\246\345\273I4/\242\017\r`$\357\354\004\234"
+	.string	"\240\276\370\277=\217#\b\252\017\344\241\276\376\377\377\337\033&\037N\335\242\276a\233d$7\240O\366\336R\246\024X"
+	.string	"V"
+	.string	"Y"
+	.ascii	"\217\367_$\233\303y\374\b\333$\024\227l\030\207\265\246\001\227"
+	.ascii	"\312\344\204\2149'\367\270\037\2749\204\335\253\245G\270*K\376"
+	.ascii	"_\337\360>\323\243z_\312!\334R*\020\001>\024\364\324h1\227]O"
+	.ascii	"\276\223.\207k\303\265\343rc0\347\364\206\303\275\335v\310\266"
+	.ascii	"\002[7\002\251O\227\345\225\367\264j4\357\212\275\352m\325\022"
+	.ascii	"\252#\\\365\252Z\037\273\017@W\235\2319U54\246J\214\t\361\330"
+	.ascii	"o\337\217\235\204/3\307\205d\017\024l~(\177\371.~\211\303J7a"
+	.ascii	"\026\237\032\3461\264\\-\332\234\263\363\350\004\233G\217\023"
+	.ascii	"\220\217\360\03527\251q\024O\001\362[\034\322u\3621.\202\027"
+	.ascii	"+8\347\234\273,\333\013\376\205[ \346\315,x(\321\032s\250:$\322"
+	.ascii	"{VI\255\311\337]\253\027\303v\205\303X\305f\316\351\361_>\233"
+	.ascii	"\340\267<Z\204D\357=\372$\362Q\367\262C\021\253\0253bNZ\343\375"
+	.ascii	"\316d\002\335\375\371\030\201(t!n\344AH\007\301\001\027\241\003"
+	.ascii	"\tq\237\221\b\367q\300\"\t\240\0217\"\022\2158\216m\375\256\374"
+	.ascii	"\202\213\0264\247-\211\313\362e\177\207\227\224\f+w\023\240\333"
+	.ascii	"\332 \237\327\007\300\270\220\241A\255\311{O\253F\203\313rd\221"
+	.ascii	"\235sX\024\356\367D\356\267\301\fJk\216+7! P\202QL\317\001-2"
+	.ascii	",\200\201\253\344\242\314\270\024\352wg\255\321\302\313\344#"
+	.ascii	"\356qh\302H,>\300\217\203\023\2325\003VXL\354\233Xc,h\276\364"
+	.ascii	"\b<X\226\221\re\313[Y\b\255\231\273\260\204\311\225\\N\256\356"
+	.ascii	"\275V\341\001"
+	.text
+	.section	.gnu.lto_updateDynLpfCutoffs.part.0.229.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`0\003m\027"
+	.string	"\366\351\223J\300\224Uc\350dT;\tH_\037\007f\016t\003%\22576p\177\031\314\232\262\002 9d\211\213\226\367\304I4\216F\270o\242\355\336+s\340\302\203\350'\266)\252\266\350\003\247\260\r_\350?\001\003\233c\267\275\267\224)\005w"
+	.string	"\177"
+	.string	"z"
+	.ascii	"\027\202y\322\265>\245\375\207fL\357N\347Z\355\367\334\247\366"
+	.ascii	"\037\032\223\334\273\202hxo\352\340\244\033\230'U?P\236\034o"
+	.ascii	"\240<i?\206m\232\3165;\310S\236\213\300\027\304\001\235\356\275"
+	.ascii	"\347I\333\342\265\217\266\2225\377\300\223\344v5\037kng\342v"
+	.ascii	"T\335 \342Jv\267q\201\016\212\247\027\275\222\330\331\324Z\340"
+	.ascii	"$\n\345\336k\363\304]\3366\005\3333\266\325\020\325\365\277\377"
+	.ascii	"\002*/\002\357\336\022E#7\005\211\344\342\302\377\350I\216Q\335"
+	.ascii	"R\236\335\177A\242\f\247{\273&2\216\031S\236\235\007"
+	.string	"\0348\034\373>\321\215|$\247\216\206\261\3360Vs\354\3601U0\207\036\344\0279uapf\325-8\373\305\271\037\321\363\331\030r\35759i\024s\310N\001\375\031\027\222y\220\037\360~\310T\037H\263S)\333\372\037mLoOg\013d#%\247\341\275\001\266\204b\261\251\264(k\205\243-\355\221\216\341'\024r3\344/\242\242(d\355\216I;Z\330\257\307\255\026\261\257\364%\323\360{F\235T\237sRy\222\264!x@\236r\254\035me\302\035\261\325\242\001\324jmV\207\3629kU7[c\033]\310%\267{m\fn\253}\321-\350\020\326\270yaS\213\325\356\330\222\343\265:\366\323\337D\331\352\222\244\232\274\360\036\315jk\003v9A[,\331\351z\265Z\257U\202\026\230\t.\020,%),\350\fK\346Z\231\305\020@_d\262\027\314Ef\306.\240-V\212\314\205\302`\263U"
+	.string	"\257N`\350\007V\353\224\271p`\275\264\234.\326J\353\\\301b\347\211\002\277`P\330){\275`g\275\177\021D\226\2106kc\373q4\255O|\016\232\f**\345\311\353xMO<\033\216\303\3405\371rl\265\270!\346C\034PQ\326^Y\325\347|\036Dz\210,|"
+	.string	"\245\001H\250q4g\fC\006)\031\2414A\322\026\033\200\002\031+\342\r\020`j\210\n\313\034\326+\204e\2202k\327|\017\333#\233\230\237\345z\321\301fW\252-\274hA&\204\031Mq\207\022\3766rY\013\233\002>\306D\263@\035#a\235\317\266\341\345'W\210\001\024\276\226\334\201\220iAk4\023\230\212\020\230\312\274\211\323\036\034\345H\300\265\211\326"
+	.ascii	"S\022t\003\025J\220E\375\0167\322\007\354_\231\352\210\305\273"
+	.ascii	"\036\352\310Hid\266\272\315\256\320\206\240y\037\264\303\177"
+	.ascii	"\353\241\001"
+	.text
+	.section	.gnu.lto_mixTable.part.0.238.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`j%]\251"
+	.string	"z\017U<H\020\020\345\355\214\001\277\257l\334s\367p\246\021\004h\333\262\242\334\250R\206\2030\375S\371\364\365\340\237\215U\320\374\021\226\323\377\202\353\322\311\0016\361\245\332\003\373\276\357\232\017\314\360w\016-\323k\201\372\331\306\3362\245\224\002\275\003k\003\261\003j{\211S"
+	.ascii	"\005N=\212?q(\354\034\260\322\235\370\006`J\266;;\272\304&~\306"
+	.ascii	"\254\354C>\232\021\374\300\2370+\275\t\273\023VZ\371\006a\344"
+	.ascii	"\334\262`\222VR\217\2623a\3662\317 \313\243\374g|\3648\023\207"
+	.ascii	"^\365!?`\350F\245\273b\316b&\353*\324\306.\344/\263\222\207\364"
+	.ascii	"!\033\2412&\016a^\366!\023\215-\006r\017jB\334\213\254T\024#"
+	.ascii	"\322\207\374g\213\205T\272\367}\225\210\334\212\254$\322\211"
+	.ascii	"\254w6de\223\3658\"E\334h\304\270\3254\233\316k\0034\234\236"
+	.ascii	"\323v\232\257\363t\237\376\323\200\232\260\rYY(H\220\324J\262"
+	.ascii	"\217\201\304:\273\345Mv/\024\301\036tvv\353\350\315\363\366Y"
+	.ascii	"\334\\\023\237\332%;\t\031\b\b\006\b\326\276j:n\316J\\\243\237"
+	.ascii	"\277\2779j\0260\331G>b\275\207\311~\255\307\331{\230Odv\357t"
+	.ascii	"\310JG\r]\242\235d\037\217\274\223\220x\372\372\272\204\260'"
+	.ascii	"v\207\261}\201s d\347\352\320\001\243\003\026\201\315N\23369"
+	.ascii	"q\216\360\323X\234#\375B_%\213ss\262\357k'%\331G=\261~\34356"
+	.ascii	"}\337\251\233>\200\263\337x\265\257\232vn1\356}\247M\222}\364"
+	.ascii	"\267\227\220I\3106X,c\237\210\336WNZ\233~\361\304B`\254\321\223"
+	.ascii	"\357\217.\361\353n\r\330\032\260~\241\274\216\247\255\216"
+	.string	"N\326*\331W1\236\246a\354S\231\335\333\005\351\007\250\217N\252\217\314@\262\217Jn\275\255|B\205X\237\tk\273\367I\353\314'T8\373L\030\377\373R\377X$\373\310\356m'\326e\226\264v\357\331\224\335\231\273\256\3118\273\314\022&z\337,rm\336\327\216D\0379D\262\217O\275\204\354c\333I\310>2\367\0343\213M\331\311,\330vn/\006\271\301(\232\304\367}\251\372\370Z6\210\340d\267v\3152Zg\263\035\215\0312b\300x\341\242\005\213\025*R\2408a\242\004\325\024\211\021R\"B\200\370\340!\252\003\207\rPO\03228a\270`\241B\023\223\273\244\224\204D\341\310\250h\202\004e\004\242\344\020\362\330\276\263\031'\267K\317\306\232\355\206\252\332(Y\3302h\032\205zF\241^\\t\031\214\035\203\261a\020\362\027\215\203\334\205\242\267hLt\026\215`\246\203\276\"\317\264Q\320U"
+	.string	"\352\024\201\215\002\220,\320O\374i\023~\336?^\202\212\357\317\247\206\252"
+	.string	"5\211;=\342\216\035\227\252\363e\216\213\350"
+	.ascii	"\n\235\016A\247A\264\026\366\332(<l\201r\374\003\266=\264Qr\203"
+	.ascii	"\340t\236)\266\265\220\206\311\2266\314\363(\274\356 \305k\237"
+	.ascii	"\240!8\207v\210\311\023\270\3163e\323\266\030\224u\343ke|C\007"
+	.ascii	"P\356\032jM?\251i[\343\032\356:\003\231v\"S\347\030\350\372\002"
+	.ascii	"\335\234[h2\020\272\002\bM\037\3109\323\227v\351\344\274\004"
+	.ascii	"Z\032\252\202\200\355N\016\235b\026(p\255\344\245\263L\273 \227"
+	.ascii	"\266\350qa\250,S\270Or\016\340\374\214\213"
+	.string	"#}\331\342\024\336\372\250\025\2215\300a\347\231\276\265KO\340\244m\350\346FW\272\b\314\364J\236)\325'\250\265\004+S\324\\\t\225\005JZGh\237\362L\323\2528\321PU\026(T:\331y\246hi\r\005fJ\305\207\"\234\t\240\221P\247\022\365c+\202j'\312\022\036\266@&\336&\245\364\027\235=\333\247\367}\333\260\335\354\254\314\035\251\331\314P\325\373\276|\304\246A3\001\315\334\352an9f\rf\002F\311\2572\017>H\345;\225&Z\233\223w$z\tEiqH8\034\275\242?\241\206U\304\366S\203\264\276\367e\032\205\n\t\226\275/\031\007\t?a\001\2669}\240`\236C_E\276\362\331\241\205\317()\205\210\310\257\362\221N\313\356f\213\351\357\315\351\245\303\250]\023\333\260\243\356\236\275\315V\224\333\373\222\265\324\311\305\351E\031(0\216J\207\342\315\"<\321\243M\351r\347"
+	.string	"~{_<\217\261\022\376\230G8\236\323\003\247\277\367}[\260\361\020\234\003`\247\030\347\030o\251s\f\262\217\021\236\210L\362\211\206>\371G=(\341\320\017\355\2116\036\037\371\215\007\315\222y!9_\303Dr\274\266\217LT\313S<~\265\303\220\377}h\365S\346\203\346\274"
+	.string	"a\311\367}W\260[/p\326qw\341\201\354\343?\021\031v;7\303\203\273\013;\313\324\360\226\326x\025ohd^\210\2771D\251\373\240\235\342\033S\370|\004\331\377c\201s\326?e>\21038\263\001\bxK\373\333\260\273\203\253\007k\212\331\347\217\371W\371k\264p\033\224\345ocv6\3050X\322:_\240\344\034\246\244\t5'q\235\221\264\316`K\316_\255\263\327\005\347\256%\347#K\316F\230\234\231J\316\\J\316[L\316E\210\364\265\331\002\327y\351:k\271\316C\\g!\256s\226\353\214\325:_)9\007\261r\235\003\340:W\340p\315@\\\347\037\024\370p\235{\270\316<\\\347\t\372\256y\207\353,\201\353\034\201\353\254\303u\316\341:C\340:?\340n\3158\\g\007\\g"
+	.string	"\270\3167\\\347\006Zg\006,8/\320v\335\nXpN\300uF\300u>\240u6@\311\271"
+	.ascii	"\033\2563\001\215\327\\\243\3334W\321p\235g8[\263\f\3279\006"
+	.ascii	"\f\327\371\205\353\354\302un"
+	.string	"\341:\263p\235W\270\316*\210\234St\240f\024\025\234OTp6\341W\232K09S19O\265\234f\022\255\363\b&g)\327Y\204\353\034\302u\006\361\301u\366\320:G)9wp\2359(9ohr\206r\235\237\332\332\255!\003\223\263S\3575cp\235/\270\316\026\\\347\n\256sS\353\314\324:\273\256\363\222R\343iNj>\315H\355\247\231\202\353|\344:\033\271\316E\035\330<\301u\226\340:+]\347\b\2563Q\353\234l\235\207\\g\344\222\3631\311\271Ur\376$g\357\302\346\356\267\266\314\026#\352\373>)\264\370\256\035\335|\351\302\356@\335\201\335~\272\371t\343\351\336\353\256\323-\247[\257\273M7^\367]\367\265\375J;[\273[;\034\b>*`\0370\236tU\252\214i_5\203q\314\330\004\032K\234\234Z\234Ci\236\016\200\335\272\274RC\230\261\255\235[\027eu\215"
+	.string	"\302P\271\007\374\243}\321\354\334\240\264_^\"]\342[f'\265\344\037\237\001\0232,(\330\244S\354$\276\257\035U\037\233P;17\273\227/\254\204\213`\025lC\227\310\305\267\360\004\324\275\304\016\336\334\264\200i\251\243\273KR\035\013{\033+\331<\213gY\254\313 \233&\251\326\207\354kW\304\370\251\314\311\227\245Kt5f4iNX9T\002\013+\350CN\021\216\346\204"
+	.ascii	"X\004\371\355-\360\f|\223a\2641\201W\340\027x\317\240[1{\002"
+	.ascii	"\315\211\246\211{\256=\226%\206MDoi\023\021\331\307\004\336\241"
+	.ascii	"\315\241\216\212\300g\320\243\202f\303\017x\346&\241&\243\267"
+	.ascii	"\224\237\312~\214\323\016\020"
+	.ascii	"A\305*\242qX\353\020\177\240l<g\020\373\022\316\347\f\030|\215"
+	.ascii	"7c\250\346s\233a\311W\275\231\001_\342m\330)\340\r\370\2166>"
+	.ascii	"\332S\tk\026r\216\215!\373X@\273\247VHn\303\023\001\317\032j"
+	.ascii	"\274\363\315\270}\252j+\327\0038\321@\343\233#\272\304\333x_"
+	.ascii	"\353\034V>D(\225\306S\033\016c\225\376\274\255[:\324<94\250\032"
+	.ascii	"O\343\th?\3003j\236\276\312UO\343\337La\031\353\336\214\227\361"
+	.ascii	"4~\210\355o\020\n&\306\273x\031?\344\367w\205\361/>\306\277\341"
+	.ascii	"\363\245\274\370\246\243\242Ql\361+\336\305_`\373\303B\251,\236"
+	.ascii	"\302\267\370\026\r\223\347\200\305w\033*\0329\025?\341W\3743"
+	.ascii	"F\377\214\261\311\237:\2478\275pw\331B\366Q\305S\371!s\342Q|"
+	.ascii	"\212oh\230\243\346:H\023\177\342\033\n\246\304\233xo\353\035"
+	.ascii	"\317?l\264\221\354\257q\230\234ip\222j_\353~\022-#\210A\252\305"
+	.ascii	"6"
+	.string	"\350\241;\f\336\314\235\276IO\270\226\331\303\260\344\3158\203\024\321\351\253?68\207\241\215\352P\033LL\274\360U\366\n#Z\305u\216\332$\325#\336\214\352\203X\247>\351\251\376\361\242h$~\352\215\236w\020\243UF<\211o\306h#\231\205\n\337\306\3756\232\372\264\324?\234\006Rm\321\271)\323W\371\303U\312\336R\210n\273J!\243\004\342=\211C2+'\027\305\"qx\021\"\236\235\360\313\336\250\365y\366\271#$Sl\256\032sF7\304{\224&\202\263\336\rB\013\237o\367\037\341\234\245\017\317\341A<\022\333\035\237/v\327\233\2761g\344\357V\016\337\032%2\377wm\355\225\353\022\367\2561\2627\262`\362}\307\232\332\355\204\\L\272\275S\250\252\267PnK\326\317\330\007qS\231]\221\231\305\004]\372\206h5\204\007\350+\363F6\3003v\205\036\376\303; (\230\250\367\360\027"
+	.string	"A\263\035>\352\235\203N\372=\357\256\321\306\")\325N\222_\207!;|\020\353\035?c\247\231\033vx?\353\020X\364,R\353\b]\020c7\340<\316C\366\221\303O\240\326G\016\r\351\253lBz\364\364\315w\225\2033bl\373\2147\343\277\336\360A\254\177\236\370\240\240\223\316y\346"
+	.string	"\262\217\033"
+	.ascii	"=\320\001\016\234R\244 \373\b\365\035E\215\017\205\024T\234i"
+	.ascii	"\336\322\247o\262C\224\322\367\215t7\210\356\350\253\354\024"
+	.ascii	"\035#X\224\341'\\\307\300M\300\3600\302\220\032\236E A.F_ef\f"
+	.ascii	"\237\241P\215\357\331'\ra\221\004\013\357S\224M\177\341\315\036"
+	.ascii	"@:}\0205\347s$\371\276e+\330\365\370\036\347\025,N66d\037\235"
+	.ascii	"\036\210\332\336\205\307p\200_\2358P0\317\t_]z\013\022\276\312"
+	.ascii	"\3357\007\027\305F\030\372k&\262\r;\2318\367\026\305\022!\275"
+	.ascii	"R\205oz\237\322\347w\234o\217\365\220}\254\300\364M\3563}C\t"
+	.ascii	"\335?\342)\375\022\030\265;\326>i\262d\312\257F\3706\346\301"
+	.ascii	"'i\364\236v\346\020;D\364Go\346d:\351\177\f\320\030g5\351;\\"
+	.ascii	"\305\330iq:\314\024nH\037C\355\315\321Sx7j\330g\2374D_E~\254"
+	.ascii	"5\225\265\265\374\252\300Z^Z_V[T\\\314\255-\346\225\326\224\222"
+	.ascii	".\252!F\222\204\030I@\251d\271\365_I\313\256Q\204\331\365\305"
+	.ascii	"\305\264\241u\305\005fU$\351F\026\222\345\327\225\225\262H\021"
+	.ascii	"&\004\024\264\256\276\2268\220\276\226[\313\006\266\300r`-q$"
+	.ascii	"\261\n+\302\312\372\272\312\372\312*\200ki$G\022\2530\243$V<"
+	.ascii	"\260\2268\274\226Jj`e\025\261\272\362:\352b~]Y\035\340be\025"
+	.ascii	"\tb\305e@QR\211\025\327\362\206\222\345\215.\346\027sK\211\225"
+	.ascii	"\365\345\005f\001\226\025\027\030R\326\020.+-\033YE\276\276\230"
+	.ascii	"]Z:\262\260\230[]K\253%.\346\362\313\312\213+\313\310\026\323"
+	.ascii	"\006\326\022\307\227U\020$I^\021dm-u|qeuu\201]M\340\253\251\256"
+	.ascii	",%\313-\252/\255!\313\"B\250\270\226V[TW]^TS\026\230i$\253\213"
+	.ascii	"\352\213\311\354\242Rv\025\331?\253\274\332\367\315B#{\206\006"
+	.ascii	"\323Q|\0376\234\346\233\223\333\373\276M\266f\265\311\325\360"
+	.ascii	"U\3142a\201\206\013\234\031_e\242?1\224\374\377\201!\325I.\370"
+	.ascii	"$a\177\001\240\260g\032\322\240\215TF\222W\362IV6\210H\276\t"
+	.ascii	"17\247\017\310X#7?\377\307KK\363\355\r\331\207\261\\8\017\311"
+	.ascii	"\367bGa\331\263H\255\353\340\035\214\301~\3304\030\337\306`\357"
+	.ascii	"\365B\254v\276\036\254\351\345\3674\277\274\337\353iz0\200\246"
+	.ascii	"\0301\310>~=\21172]\357\365="
+	.string	"\365x\232c\370\371\276\257)7\327\254\253C\366\261\353%\270\202\327W\252\230\027\037\220G\374\034\275\375\001i\344\217\320\371:\3142M3f\220}4\362\030\\\301\223C{'t\200.\026\367 \255(\352\265\370*3_\310\323\313\374\376k\364\240\257L\202\234 .,\332\t\311\365|\254\177\030{\353\271\236=\212\366\324\013kZ\235c[\337u\345\252\210F\266\367\206Y\361U\216\272\362\355\245\260\340'\\\353\344\221 R\344\207\037u\363\212dn\256i\262\361\226\026\371V\323\250\326g\303\211\3405\031\333\260#\\\003\305)f\313T\240\320z';\221\365\3137c\336\361\313\267\3408\205\332h\355\223&\356\231b\307k\2410!\344\375-\221\365C\336l\307;\331\020\254\035*\243\365\004\326\367x!\3121\321:\023_\345\254\357\361\376\332\241\340\263|<\326\027=\007\371\240qO\nn}z%z|\023Z\367\224h"
+	.ascii	"\235P\275\031D@38V\246\276?"
+	.string	"\274U\322H\334Q@ELL<\312s\263e\304WY\252Gp0\2038g\225\372*+\267\204\260\372\343\026\020R\r\344\352\201\004\371+5A\336\311\017\032\234\224\212G\304W\031\310[\275k\025\214\003\245\006\340])\341\217\257\340\003\360\217\007\245\363\364B\3153\311\n\336\277\030*\272!\363&\201\2036\b\001\245\326\366\006\304\267\375\370\037C\324\362\303\332\304\336\241\340}\374\217Gb\023\274B\343\236f\232\006P\262\001B\224\022\366(\303\343'\370\036u<\336\350\rM\002gn\3525\343xK'\370%\004\350{\202\260\343\354\360\217Z\367A\202\377\300\337\032I/\202\227\340\221\207:>\202\034\017\301\353\370\206R\303\344x\367\355\201\307\361\020|\203y\340;K\335s\340o<\216\270\034~\343}\313\3075\371\222\017\367_\232u\232w\232||\310&\236\246\237\267\324\201\367\267^\312\016R\354c\302\004\307\026\306\003"
+	.string	">\310\226\346\036"
+	.ascii	"<\020\352\035E\264\033nR\302\006\274\001?M@o\351\215\2576\360"
+	.ascii	"c\206tQ\n8\002\257@s\260\031\310\241]\305\344\307:l\250\361\024"
+	.ascii	"l\250z\037o\306\321n\nB2\020\203\004\250\362\330$\222\242\034"
+	.ascii	"s\f\315\214\310L\222\024:\"\n\020\210d\211\244\267\326\003\022"
+	.ascii	"\200t5\215C\203d\204DD$IR\251GkY\211\3642b\336^}=f\211\3527\220"
+	.ascii	"#X\254\300X\362e\230\344\241\351\366\304\343\246\to#\302\300"
+	.ascii	"\232\373\300jo\352\253\354\352nq\016y++\225\312\245\204\320\332"
+	.ascii	"%\314FQP&\347\244\231/\302\205{\332\363\002\264\224\260\352\325"
+	.ascii	"\236\352a\314"
+	.ascii	"\325\334\203dC\203\274\033\036k\t\261\344\021Qg\263\375LK(\036"
+	.ascii	"l\006K-\rT\314\005Ax\351\257(\n\230b\246\347~\214\340\272\273"
+	.ascii	"k\305M\016\003B\342\006\013S])\020\3258u\016\\\344\261FI\311"
+	.ascii	"W\220\022\b6\240\\\023\351\225\266\246}\347\356\253\265\325g"
+	.ascii	"\"hy\244J\020o\\\376\333\367\223"
+	.string	"_\033_\3426\020\376w\304`\323H\347\345\032~{R\301F\035\031#\255\353\216\257\230\321\221{\f'&\204(y\277BH\035+2\t\323n\376;\243\332y\213\262\354O(\371\306\251i~\2178\261T\231G\356k\231 3?g\224\256&\347\233)\233#d\016\237\313u1\030 \031\357\027W\246e8\332@\021\301\023XgL\323\226\272\\\232\312Kc=5h\242a\231A\022~\353\250\260 \272T\250\207/\212\315\205g\350\2731\266\253\307\345'\364\2621&\222\032\fUr0\225\f\b\253z'\340\241\304G\241\347\035P%\216\355k\"\241\004q\200>\372Q{c\344\347\005?4<\365vq&\207Kr\257+\267@\342\364\265P\261.O\320\346\341sW\332S[\334\030zIu\372\326B\212\270\276\261s\347\036\275\311~1\177QI\227\315+\025s\"\277\301\036!\331\262\265R\372\005i`&\240\305"
+	.string	"|\272\371\352\214\240\nU\022\257a\250\3068j\221\344\253C\3453 \265\332\232\222w\351\033\362\344\t\250\375\216\350\030\177i(4\266\277\315\016\220yk\306]H#\234\277h\323\350ouHnK\277:\3158hM\003-\204\017Qv\205x>+\253\367s"
+	.string	"A\330\f\335\211\030\233\253Uv\376\202\b7\022\223L\020\374\350\201\304\234\035\333\307\360l\331\355\001\375d9\326+\317\002d\204N/\224\226\274=\\\274\260\325\217\3663e-\325\361.0\226 \354\333\223\260\365\205\316\305Y#\007\364\027<X`\r\303s"
+	.string	"\367\365\376N\265\317~\027\320t\372\263N\260\271\177\361b\262\376.\246\201p\347\330\242E\256\021J\363\215\372\037\255\365<\003\215\212 RB\274"
+	.string	"\347)\016Hh.X=\374\r\036\263\331\264@\021\302\362f"
+	.string	"\276v/H\302*\035\375\370\210%\3630\343\227u\212\002g&X\200\026\324\314\022+\243\001\023`/\201b\330\212u7\230\242\336\350\206BR\b\001r\250\350\355y\212\031\327Nb\002\323\273[\031\274\300\306\033k\227\363~\225F\205\335\216B\327B\353g\234\252\216\352\211)\373\363\023\236\021{\261\2604\032(?'\374\001\372"
+	.string	"7\327\341b\036|+<:\371\224+\235\013)\016\bOf\302SZ\300\305na\240\200P\244xJw4e\343q\241\3511\234\336\330bu\202\315\367k\032\267\221\211\030\022\372Vy\216\200k\275\300\315k4\242\273\335\260\216@\342\026\367Z\335\265\007\315\214"
+	.string	"G0;\363\233\240h\304\356x\366\235\b\214x\376\277\354\201S,l\027e\372dg\263\fs^\217\324d\t\362\317\026\233\037\376@\377W\256\273-O\f_\"\3261/\214P\321\357\324\350\033$\375\\\244\201\016.\211\260\003\273\255\357\242\005\375\225\260 \334<\247\344\"8\201\037\214\234\006\331\232\201u\321Z\255$\215\035\352\271V\250`\232\231I\303TS\341\263Z\305\362\005\361;\312F\230\n\324\330\210b\352\206Y\f!\261\354\006"
+	.string	"><\3056\023;o\256\t\366\215\325\302\224.\352\225\212\350{P+\314\346A\026\375\202-\347l\246\310\207\024\003\364S\226\332S\353\240\3226\321\353\226\264M\353\016\321\023\357!\007;\f|\251\315\221\037r\355@\021\256.\\\021\004\326Xm\357\220\277\272\017?\334\311\2618\217[i\310%\265\312\223[\301~\270,\234\242\320\025\030V\203\250pH\230\037\237t\331\352\206\336\3214*\307C\\\210\321\3639\n\371\251!\345\331Y\203\2276I\330F+A\262K\fUXUh\312\r\177'7\305\245\236\263X,\273\274\016\034^\034\306\rU\037S\262\0266@\370\200\362W\222Y\341\220\214\016|\017\305($\205\326\002\270\272\002[\001\033\353\330\300\027\222\003q3\200\244\013b\272\004\023\300\217\266"
+	.string	"\020\343\201\335`\035\276\266+\343\n\276~\035\033\013\273\367#}\374\016\200N\020\033\"\374\265\360\363\211\"\3064\f\315M\t\357\346\005@\357\276\337T\032\214\327\334\257sp]\224\002\215\b\210"
+	.string	"x'z(\02685\t\352_\005,\273\002\233\222w?&\324\305t0a\363\205W}!\355+St9\307\271l\316\027\226\305o\226\266\tm\372d"
+	.string	"\33198<e\"\365 \325\315\r\177I\273a.\002\003\264\221R\252\367F`\247\310S\316\346\306\327\346\335X\204j^\232b\242\264\376\n\367\216\242\360@\tMs*\t\243\213\3110\255]G\256\250\304\205\375JY\222$V\016\2228\325\202#k\201\330x\334|}\033\330\264\311-\013j&\264\030\275\372F\375\350\327\256v\351]\242\233\026J\215L\246\b.\270\221\020Y\207c\215J\312\312\013&\035(r\260\331\225\254\314\"\312B(\025@\225\030<D\313\230\312\374\002\205\326\034\342V.\017\360h\352\371A\314\230\277\363\205\350\200\335\265\202\273U\246Uj|\313\254\313\345\230"
+	.ascii	"!\016\254\330\330wF\357\310b\205\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`\274\n\305#"
+	.string	"f\372\315;@\346Jc}\332\367\335\235\023\334\314H\264 \022@"
+	.string	"\273\233\035\002\230\365\367\303\360\333\230\220\341S\272u\023?\377\200\233\355W~\205}\207\\rI\323c\200\260C\276\235\215$I)\276"
+	.string	"\275"
+	.string	"\266"
+	.ascii	"\306\033_c\343jj\370\017\215\257\013~f\306\343d\\-\206\007\301"
+	.ascii	"\370\230\364\305\257\244.\356\t[|\215\305\231\351\222\252\252"
+	.ascii	"\352\212\373@\243\212{\2650\305= R].\327\b\177\203\334P\334\347"
+	.ascii	"\235p\2406(\241\211\373)F+K\030\020\t\357\2150_*\302\206!,\b"
+	.ascii	"\204\351X\017\314O\331\207{)F\017\206\224Z\265\203\t\245VV\331"
+	.ascii	"\021\007?\332\360'\032N\227\341Q0\034\312\205{Q\035\314\202\017"
+	.ascii	"\247\376\225ZY\301\205\024.7\341YRk\177U%\234M\204\333!!\034"
+	.ascii	"-\265}T\227Ku\316F\243\321\250\324}\230qiGg_{\317\330"
+	.string	"'\030~\231yp\335\307h;\200\\\252jC}\354\376\354U\214'f;\251m\305eu\305\205\265E\305x\246X\217\024\363I\037f?\251\255D\213k\253G\026\226\326\215,\"\f\374\325\353Q\254\007\305\203`f\364eA/\003\256^\364\304\212\226N\2444\242\253\376\273>\324\345FN\374l\342@&\366[\342BJl(\211\373R$\367fG\356\255\030\271/\343\272'\333s\333s\333\272\037\323\272\257R\344^l\221\310=\025\343\220\373\245\220{ea\036\242_\220\353(\220\353J\306\037\327\213F\037&L{8/\345qMI\315\272\236d\334q\r\305r\236\364\352ZQ\307\265$\017\316a\243\227\343:\222\325u\242J\207\343\0321\026\217\317\213\314\214\234,\323\032\330d\0010\217\316'\242&{'\363\353\235\372\370\326\234\250\311v=o\275:\2716\033\272\025\342|\001\270\260\264\037\353\013\260\t6}\350\326"
+	.ascii	"\363\267\363\273%\360\374\375w{\\\177\300\333\250[?o\217\314"
+	.ascii	"[<1\305<\367\331\306\335\247\301\335\177)s\357\205\314\275\226"
+	.ascii	"\267\3734n\367h\306\334\233i\273\207\023s_&\314=\0310\367o\314"
+	.ascii	"{7\266\373\266\265\3730j\367`\276\334\263\245\335o\361r\337\245"
+	.ascii	"\313=\027.\367w[\356\233Z\356\345d\271\257\303r\017\347\312}"
+	.ascii	"\034\264{,g\367m\314\356\305X\271wSv?Gv\377\346j\226c\243\276"
+	.ascii	"\244\272i\337L\372.\201R\020]\223\357l\225"
+	.string	"\377|g\025\334wF\244\355\354)Q\331\253E*{\346$(\013\366\313\247)\033\345\301\2516ha\037C\245\354\006\007R\366\270>\035\330\257%h`\243\f\223\226\351Q\322\032`\236\300\035\350\033\037&-\324\n)i\267\020\223\366\310\0372i\2210\023\223v\t\363\007\340\330\3248R\322v=%9\025\223\366pO4\353\005\314\035\276\371\231\264\247k^\302\234\267?NI[\365%B\244=\256\216\220\366\310\374\241j\321:.D\332c\363\b\314\352\344\236\240\354q\035\204\262W\202O\366\350t\243';\200\351\347d\231\236\212\216\026\227x\346EN\026\200\363\001\200\271\250A\020\002\262\322HS\222B\245\003\340\002!\242m:\021\200 \250\231\021\021\211DD\206\222\036\027\230\032;\324`\243\"\375\302\034\\<t\344r\002\007\363\031\024qf\035\216Wck\362\022\221\270\327\2319\324\367\235IwF\221\017\006\201G"
+	.ascii	"\330H\245\211\031%\\\034(\270\366\244\372O\376e\263\250\037\005"
+	.ascii	"\267t\212\264\202\333\316\354\032\211\247 \301\201\006U\364\243"
+	.ascii	"\016y>$\224\326#\n\313\207S\005Q\222\002Y\210\022)\310\202(I"
+	.ascii	"\201,D\211\024dAD\006L\375\2656\266-\301\272U\214\365\304\372"
+	.ascii	"\335fb\312\300\270\206\327\323=\206\277\305\347\316\257L~S\334"
+	.ascii	"\346*\374\220\255\363\355\247 \267#\005\363\217\241\206\327\031"
+	.ascii	"\353\355 Fn\020y7l\274W\266\247=\304\307\332\004V\024\355\372"
+	.ascii	"\203\251nsf\366\035\025.\240\346\275\b\354\323,\331M\242\363"
+	.ascii	"\342CjZYi-Y\035\005\360eG<k\016V\373O\343\271\253\2152\033\346"
+	.ascii	"\311\335':@\363\2130\235GA\004i\274r(\003!\274\220\032\237\244"
+	.ascii	"P\252S\"\fb\227\227:\275\205\352L\004\361\350\3649,\223\370\326"
+	.ascii	"\273@U\003"
+	.text
+	.section	.gnu.lto_.refs.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`^\003=\027"
+	.string	"\306w\233F\300\332(\303\001\220 \265$E"
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004\222|\025ED\361\347\317Q\020\204\\\257\177EQ\024EQ\250\b"
+	.string	""
+	.string	"@!\035\"\324\204(\201\200\r\374g\033\3721\372c\371\215\212\377V~K\232-y\322\310\226)\214"
+	.string	"\202"
+	.string	"\210"
+	.string	"\277\226,X\254T\2412EJ\024(\250\377\211\223&K\224 9b\244\310\020!A|\364 \375<v|\377\r\357\257\021\372i\210}\031\241~\220\251\017\343\324wa\372\201\302>\013\260\277\242\324W\221\372S\214\372(P\257@\364?bG\020\352>\242\317\231z\317\251\0270=\201\260\357|\257\003\366\001\244\027\020\366"
+	.ascii	"\244\307\001;\356\373[\251\333H_\216z\355{\032\321\263\274\217"
+	.ascii	"\351\036\325}\330}\311\373/\324E\335w\363n\343C\021\002\203\263"
+	.ascii	"^\222\365\220l\232n\317\325X]\317\314E\344\317\326\3675\200\356"
+	.ascii	"Q\234x\375\317|\037\362\r\270z\316\350qJ_k}M\351e\255\217\215"
+	.ascii	"~\005\373\024\370b\370\240\3705-\203\372\031A\256\327\017D\376"
+	.ascii	"+\\\375\024\255\377\001\037A\370;\254\317\031\0377\276\315\370"
+	.ascii	"(\326w\036s\272\036\304\336\016\342\227\203\251wC\330\233\001"
+	.ascii	"\354\305P\352\275\220\372Z\030\365V\370\276\024V\337\t_T\277"
+	.ascii	"\027\321\277\345\024\336\035\354\013+\201\371\316\252\353\244"
+	.ascii	"\372\215\347m_\257\361<\255\325g</#\365\230\3673\250\016\363"
+	.ascii	"^&\325]_g\265\372\312\373\320+\355\035\325\205\255\323\001\275"
+	.ascii	"\270\005\364\222\347\364\232(\341\352%1\242\373\212\b\360\r\201"
+	.ascii	"\363\0051\277\037z5\220\270~\230\233>\030/]\270d\271r\263\231"
+	.ascii	"O\345\366O\211\302d\366/I\"\376D\310\277\205(\366\034\361q\266"
+	.ascii	"\247\261>V{U\355E\345\\4\316M\265\377h\337\321\256\261\005\017"
+	.ascii	"d.d\262\246\204\356\371\217\3113!t\367\230=\363\301\2747;\350"
+	.ascii	"U\265A\357l\006]\320]\333\n~\022\364\371\352m}`\222r\373\314"
+	.ascii	"w\314u\314s\314q\314o\314c\330\230\327\230\323\230\317\230\313"
+	.ascii	"\230\307\230\007\315a\314_\314]\314\201\346-fn5\356\325oZ_\226"
+	.ascii	"\275V\366\232\362g\343\317\312\036#\0376\3661\367,\262\257\310"
+	.ascii	"\256\312\375\211\354!\371`\317\203c'\365\374$k f\257\354\241"
+	.ascii	"\262\317\362;~\313\026\b5 \200\242rc\363\016JPi\306\"\271\375"
+	.ascii	"%\370\255\337\0021\343\360!\362\313\370}\024\213\212Qb\021\230"
+	.ascii	"\023\243\3436p9\016\bV\204\020\227\0218\256\201?\214\333DA\221"
+	.ascii	"\337\016\300\366\005\274\206\241\230\006\266\204\021\243\241"
+	.ascii	"\032\216\350$\266\036g0C\216;\030C \216\202`\323\001\273B\030"
+	.ascii	"G0\261!'q\341`\307\220>\3169\330!$!\356\032\214\200;\"\250h"
+	.text
+	.section	.gnu.lto_.decls.34a2667f66545232,"e",@progbits
+	.string	"(\265/\375`8s\265\330\001\372\377\356\247S\020(\205\3514\006\203\213\250\215\032\25155\346O\204=\375\376"
+	.string	"\222\216\017\360\360|\216\220\232O\244\223\325\355u\273\343\224\227\r\004\201\205k\332\266\250\004"
+	.string	""
+	.string	"\020dx\020\0234\213\247"
+	.string	""
+	.ascii	"\004\031R\337\240\241i]\226\3434\324\0261t\223{o\271\245L\001"
+	.ascii	"\031\t{\n\345\nB\351\335p\356x\306\\\301\213\202\363\357\024"
+	.ascii	"6cM<\334\304o.\032\276\303v\307s\367\355w\2046\230.\355\022\273"
+	.ascii	"\"\353\273\303n\272\220\\\ru\320\001\n\346\307\0241\235\037\264"
+	.ascii	"\242\037\214\242\037\364\322\017V\325\321A\371\322\225\2063\246"
+	.ascii	"\303X\r^sL\207gx\b#\234\307\t\323\345\275\231\356\275\300\347"
+	.ascii	"\336\013P7#LT\322\374\340\f\375\3434 \342\314\320$\206f\250\207"
+	.ascii	"\315\0341c\316\230Ia\3648#\20336\3635\274\265w\226\030z\177~"
+	.ascii	"8\343\271\242\3432\006(\362\343\t\316'\031\374\346\206\315\322"
+	.ascii	"\022\316\037\321\346\005\326\245\210\024.U\276\232s\360\033\336"
+	.ascii	"\002\004\311\332\021\266\027F\342p\030\f\207\345\260\030\f\006"
+	.ascii	"\217\271h\370\r\273\035\177\301UEo\330\313fZ*\301\315\207\020"
+	.ascii	"\365\314n\006\027\240\354s\203\322k1\372z\213\276.\323\327K\364"
+	.ascii	"\365\226\276\266\241\257a\350\253|\372\307ZT\2679s\310p\376\233"
+	.ascii	"rSc\r\030N\202\3110\023[\301_\330\f\243\3414|\206\221\340,\330"
+	.ascii	"\b\006\303X\260\024\254\206\3030\025\254\004O\301Mp\024\374\004"
+	.ascii	"W\301N0\023\274\004C\301eX\f\037\301c\027\r_\301^\307Dp\221\262"
+	.ascii	"\033d\240\372\300\376\234\346\200\375\301\210\263\203\307\232"
+	.ascii	"Z\f,u\347\260\f \366\006\207\230\373\367\344\247\226#\256y\377"
+	.ascii	"\230\376l\320\201\355\315,\372qe\204\377\226\351\270mp`\201\373"
+	.ascii	"\266\001\336\300\277\250\353\226\301\002V\246\365\006\206\257"
+	.ascii	"`!x\210\317\271\367\017)`{\357\" j`=n\333\226fV\230\255\277\310"
+	.ascii	"\207\226\"\314u\313dib\311\335\262\2531s\376\373w\001\003q\325"
+	.ascii	"\177\313\254\330\274\321\270m>\347\336<\354\300\212\202\334\266"
+	.ascii	";\207e\200'\367\017_\301T7\355\316\r1\201\254Mso\346\337\037"
+	.ascii	"\302\b\370\n~q\333|\226\230{JE\002\026xev\004\207\024\005d\334"
+	.ascii	"\274B)\321\rJ\257\276i<\244MU\022H\003\017\347\253]\364U\246"
+	.ascii	"\276zD_\355\322W\231\364\3235\372)\030}:(\372\351\021\375\276"
+	.ascii	"+\224>\355\322Oq\350\247U\372)\224>\032\250\217\276\321G\301"
+	.ascii	"\350\243R\364\321/}\264\206>\nC\277y\205\322g9\372\231\215~v"
+	.ascii	"\323X\006\236q\321\206p\324\376\271f\232hh\341\374\274E\177`"
+	.ascii	"\337\241\364\201w(}6\323\317`\372\371J\377\344\323?\311\350\237"
+	.ascii	"V\364\323\210\350\263]\241\364g\225\376\333\025J\217\371\264"
+	.ascii	"\0057(\375\334\025J\377+g\202\037\346\225\324\017\234\377\353"
+	.ascii	"\027g\347GT\230$8\367\r\351hq\221s\203\363\361\032\375\021Y4"
+	.ascii	"\f*i7\357n\271mN&[\020\013\025)M\262\377\226\345\335fW\226\377"
+	.ascii	"\352]\274\013\347\336]\276\273w\321n\336u\363kw\3378\251]\271"
+	.ascii	"\"\305\354\246\3710\001m\247\246[\226w\261\3344\037&\346\246"
+	.ascii	"R\251\250]\221\375@\251c\342\304'\037K\321\227\355\n\245\021"
+	.ascii	"\334\240\3648\211f3\224\273\240!\362\206\363\361\226\376U\003"
+	.ascii	"\223e\355/\242\273b\256\031\237%\240\355de\rl\357\375\377\256"
+	.ascii	"\271hn\232[w\325\334\031\356\231\213v\351\256\334o\331\325r\314"
+	.ascii	"\334;\313\336\373\367\r\016\313\2240W\334\276\3346\237%\240\335"
+	.ascii	"\244F\013\330\336\314_)!\214p\351.\333m;\231`\252\025![\232{"
+	.ascii	"3?\342/\372\245\273q7\355d\262m\247\2463!t\005\256\201\351\333"
+	.ascii	"\233\331A\007C\035t\320A\007\035\004q`a\261\001\345\377\222\371"
+	.ascii	"5s\313\\`{\320XNQW8\317\345+1@\216\340\374\313F\3371E\277d\202"
+	.ascii	"R*,\346N\333{\377P\240\305\215\013\316\352\rJ\177\321\350_/\372"
+	.ascii	"\027M\3772\321\277]z\350\n\245\2776\364\357\223\006q\205\322"
+	.ascii	"\313\345v\271h\023\\/\017a\204\237Kf\233lo\346O\017\340\030\240"
+	.ascii	"\034\234\357\001\375;Az\003\357\004\351\215\272\204+\224\376"
+	.ascii	"H\337}\205\3227@\377\004\375\001h\013\256Pz\251"
+	.string	"\334\263\213\306\301\265\362\313\274S\216217so\346\017.\362\247F\005\347\203\240\177\253<\310\314\036\341=\372\227\203\364\f\f\274\034\244\307\032\350\n\245\370\006\245 \\\241\024\350F\371/\224K\306\301\t\025\265\265\323\366fj\320N^\260\220\341|\346\025J\365\rJ\177\334\314;~l\306\004\f\374'\007\247\006\370H6!\037@\353\317\004\370\361\025\226\216\0264\220\301\013,\201\026N\017\262\376\213\f\361c\r\3763\002<\302\217\r\360\343\003\374\347\220\320\2175\340=\0308\020n\220s\374\031G\232\253\376<\343\302Hf!\207\344\237\006\340\230\301\213\354\3244\201?w \263*\207?\375\371\263\207b\016b\372\007\026\344\240qp\031\334\207\336\375\347\005\027\230\362\3436\013D\271\025&?\336\3130X\271\372\247F\376sC^\372\361[\216\300\3275\n\342\340?\321\274\377\334\201?\0379\310\037\370\317\302\231\366\234."
+	.string	"\371q\013?\226"
+	.string	"\266"
+	.string	"\276@\026\246\360q\244\314i\267\223S\344\331\202\006~\274\345\203\004<d%\024\367\340G\317\230\301gW\003\227\003\033\300d\2622\347\344\217\345\362\n)\362*\340P%g\233\263\231\217\377\345\311H\247\335\2117\374\361\223;\201\377\232\360_\t\374y\250w\356\375\331\370\347\f\374w\204$\031\003\367p\025\377\220%\263\377\255`\250\233\360\243\021\370q\221\037C\255\177\366P<WHs\374\371\204\037k\021\177\034\230c\270\212\263p\236?\275a\306\b\313\301\354\037\364\247\367\307o9\0029\202kt\375\243|'\252\356\007\376\341\022\270\212k\370S\251\377\276\270O\033\300\307\246<4!_\340\307d\262\360"
+	.string	"8\353^\256\f\t\374\030y\026r\005\006p\016\376\264\305\177?\200\311\334\246\001\244K\374\226#`\204\263\276\363\247\310\037\177\371\217ww\216\370\037\347V\340:\200\354R\340\277\020\370o\0042\004\376\323\357\307R\371\001?\006\300\177/g\207o\300\002\376\340\032\374)\361\307Y\331\001\377\225q\215\204?\336\3130\374\367r\n\301|\301\037}s\026\322\t\234B\376\263\203\374\2470\374\247\tY\205Qi\351I\306\237_\310.\374gTn\300\177R\3759\305\177Z\311\360\343\r\374\230\003\377\231\200\334\302\377\t\376\264\351?Y5"
+	.ascii	"\377\351\2014\360?\223\027h\360\237,\004B\032\376\363\205\332"
+	.ascii	"s\227\352M\360\237-\324\377d\325\363?\223g\376\223u\373\317\""
+	.ascii	"\226\377d\377\313\201\377n\340\277\035\370\357\007\236\376)\334"
+	.ascii	"\001n\323{~\025\306\377\274\377s\377\351\376\227\371\3175?~\312"
+	.ascii	",\374G\363\177\357\377\335\177\274\377i\314\374\327\373\317\346"
+	.ascii	"\177\263\357\303\3778\037\372\321\006\254\375\217\343$\243\320"
+	.ascii	"\361_\r\374\027\371\337\343\177\206\371\257\321\177\364W\235"
+	.ascii	"\374\347\223\377d\376\247\224\377\214\362\237P\376\263\354?\315"
+	.ascii	"~,\346?\323\374y\205\377\034\362\237c\377)\366\237q\177f\300"
+	.ascii	"\377\237_\265\362\347\005\374\371\304\237Q\370\263\002\376l\302"
+	.ascii	"\237\021\360\347\002\374y\304\237\213\376,\342\317"
+	.string	"\037\3749\304\237\003\360g\016\376\254\301\237/\370s\004\177\036\3723\207?\377\374\271\347\317;\177\016\376Y\375\363\371\237r\376s\357?\361\376\263\371\237v\377\331\346?\353\3763\315\177\236\371\317\270\377\\\373O-\377Y\345?\251\374\247\215\377\264\372O\252\377\244\361\237Q\377)\343?\241\376\363\351?\233\376s\351??\360\2372\374\247\322\177j\340?\215\377\211\201\377\\\377\363\002\377i\201\377\224\300\177:\340?\203\3763\375O\027\3763\305\177\256\360\237\013\370\261\234\377<\361\237(\374'\211\377<\300\177\026\340?\007\360\237\002\370\317\021\377Y\364\237\"~\314\367\237\037\374g\007\377\311\301\177j\360\237"
+	.ascii	"\370\317\013\376\223\202\377\374\360\237\021\374\347\320\177"
+	.ascii	"v\370O\016\377\331\363\237:\377\251\376\347\177<\347\307}?\206"
+	.ascii	"\363\343\273\037\247\371\361\231\037\233\371q\231\037\223\371"
+	.ascii	"\261\230\037\303\375\370\313\217\333~\334\345\307l?\336\362\343"
+	.ascii	",?N\3731\332\217\317~l\366c\346\217\313~L\366\343'?\026\373q"
+	.ascii	"\223\037\207\375\370\310\217\277~<\344\307\026\370\361\361\277"
+	.ascii	"K\377e\372q\217\037\363\370/\340\177_\374\357\373\261\326\217"
+	.ascii	"\263~\214\365c\034?\226\372\361\214\037C\375\370\351\277\225"
+	.ascii	"\377*\376{\371\317\302\217\331\0377\375\230\351\307K?F\376\030"
+	.ascii	"\351\307\306\037g\340\307\303\037\013\177|\201\037#\340\307"
+	.string	"\037\374\230\350\2773\376\013\343\277O\377m\372\257\362\277\354\377\027\376[\374/\361\2771\374G\361_\013\374w\205\377~\377\343\374'\373\017\366?\356\377\b\201\201\201\201?\220\323\357A\355g@\\\347S\020\n=\003\270\202\r/K8_\2024\372\317zY\357\266\201\240^iz\346\273h\231\357|:\301\334K\037\244t\301\233\214\227Z\2312\\\022x\321?J\346\242\241d\316\246 \324\336V\"p\261\242\nq\t\320\364\217\306\241\241q\250\230so&,\003$\t\323\211\232\243\003\b\316\250\\:\266\244\353\t\316\227@L_\002 oo(\034\034\n\207\232Yr\344\n\316\227`\351\313\227)\003P\022V\327\326v\267\023\233\251\n\004.x\200a}\021t\351\322\345k\227\252\303\323\f\254\346\246\302\nq\253f\270R\207\363#0cc;\323@\tW\004G\364Q-\027\307\301q\276\266a\343\271\276$d\326\376c"
+	.string	"\\1|1\326\340|T\355\242X\214\240Y\320\030w[\355\033cI\022\277f\004=\364#\240\241\177\321\030\351\217\246\245a\251t+\315I\342\246)\007\r\255\rX\335\331\331\327N\\\260$k\300\342\314\314\302\2640\231h\003P\362\244\254\354k\301\275\337x\244;\270v\210C\360\245\177\224\354\027\r%\373\332\211\375\202\212\006J\230\260B\360\b)\363\306\r\347C\260C\377\350\0234\364\t6sb\213)I\tP\252\204\220\251p\230\356t\340|\bj\350\037\025\373EC\305\320\036 \266v\215\f\300\370\020B\026\007\006\327\030\316\037\372\323G\225\\\224\tj\004mr\323Lx\261\367\226\221\264\207\025`X\337\246b\206\370P\235\376\220\233\376\275i\351\217\202\375\242\241`h\030\210\255m\345A\222\255\300+\264\013\b\222\0378\243I~\256\330"
+	.ascii	"\201\203\363\207\256\350\017=\321?z\004\r=r\333\256\331"
+	.string	"\236\322\211\321\304\225\327\267\367[\210\237\275&;\212\340\374!\032D\210\240_\007\332{7\355\315cG\272\003\217\n\304\217\0269\372\345C\346\326\214\023\343\177P\350F\244\017\347{@\243\217\372@\271\216v\275\013\035\242\367\336K\314=5\304\204\t0\254oca\201@o0\355H\023rt\310\355x\366\007\035#V\246\220\340|=4\310\377\340\t\303\256j,\b\n\204\357\310\233\253\276\375\203\244\311\326\016\364\307u\323s\305dm\006\234\357A\211\376\177\217\377t3Q\355\275\255P\346\246j\342I\377\373\213\336\013\342\357\271\347\305\340\177\336\373\026@\332\373\305\336\220\275\367\315\323J\326\230tX\260\321\271\275\235\270\226L\340\252r\342\302\001u\306U\245\001\352\214k/9\035Y\322@\265\271\226\240\316\366\326\340\344\264db\253\n\352\214ik\200:\333U\373\205\231\252\273\231\\K\333ikk\330N\233i\237mUY"
+	.ascii	"\345\304U\005u\306T\245\001\352\214\253j\237qm\240\355\304D\025"
+	.ascii	"\303iSi\330g\\w\373l\253\n\b\352l\253\n\352\214k\314%\"\303o"
+	.ascii	"\357\206\336\220\"kn\031(\247MCJ\213\211\nh\016\212\271\265\351"
+	.ascii	"\366\276iO\233j\317\355\215\301\336Z[TtL8.[\323\034\215\246,"
+	.ascii	"L[\227\271\367\206@\252\251kk;\315-\335=\007\265dk\357%MG[j\357"
+	.ascii	"\275EXb\316m\257;\267\364CkG=\355\035\301f\356-\265\367\322\335"
+	.ascii	"s{\357\245\275\267J\245\305\334;\013\b\nLJjo\254!\251\255\265"
+	.ascii	"\304\345io\234V\307V\005u\326\265U\304\005\355\fl\303`.]\250"
+	.ascii	"\250\255\r\266\351\270\250\364\331\322\224\035\265\367\276p4"
+	.ascii	"XU\r<\234\231;l<\324l\340\214\362P\215h\371\322\304\371\035\376"
+	.ascii	"\264V\021\210"
+	.string	"\2256\234\337!O\243Y?K\246~\300\341\374\016t\372Gs\2408v\220\264a\341\241Sh\350\024\212\343\304\026\023\027\bp\314`\205\310W\315\256\031p\276\032\202AM\031\016\234\337AN\377\252Y}\315'\270\367[\0240\264\006J\245\306l\217\252\017\275\201\332\270hh\r\264\352\231\331A\007C\3011\037bOi~\2072\375\016a\372\035\276\364;li)&\007,'4p\310@g\004\267\262\2500\341\374\016S2@\240PA'\346\017\017\323\325\22628\277\303\023\372\204\307\310\216\350i\364\305O\246+1k\3157\314\262&$qhSn\236E\350\204\244A\231\320%\264N\315\211\335\335\321\245?\343e8\350\346\331\342B%\216\n\347\300t\310\036T\023\316\027r#'\317\311\177\027-\003\346\275\241\021zE\0310\347\021if\300\314\227\375\356\034\026s[\371t\025\271\"\363\331\262SK\243\375\342\234]"
+	.ascii	"\361\356\316%f\272d\b\236\027\234\377_\264\334\207\375\376\377"
+	.ascii	"2\367\020\256\261\306\313\016\347\013\251\321\027\"\243/\324"
+	.ascii	"\246/\204EK\260\257Pz\202\335\240\364\332\025=\337\361\300\241"
+	.ascii	";\033k\3467K\260\3505a\252]\2744\245\354p\340\rk\222w\303\315"
+	.ascii	"\315\313bx3\242\332\260\271\314\255\261?4\317l\376\234&\317\220"
+	.ascii	"\353\356\013;)?\234\263\232Lw\321 \310k\360\2064U\341|!*\332"
+	.ascii	"\003{_\b\322\033\030x!H\361\326\025J3\270Ai>S\364\214\306\247"
+	.ascii	"j\254\312\025\2345\230\201@u\302\245G\2202s\330\r\332\022/sd"
+	.ascii	"t\362\226\024\231\302y\f\224#U\342p\276\020\022\375\021Y\336"
+	.ascii	"\324N\036>\347\336Ll\300\250\344.\331K\376\222\3432[~\313m\031"
+	.ascii	".\203\311r\331-s\311b.Z\016\223\265<o\311kMV\334\024\3450\271"
+	.ascii	"\312\233f\016\223\323N\036w\016+?i\323\334{\3470yJ6\273sC2\231"
+	.ascii	"_\363J\035\032SN\016sN\2357\356\034V^2\247\211\345\266\255\311"
+	.ascii	"a\362\031S\335\222\241\236;-4_\0372\246\272B)\0067(=\207=}\016"
+	.ascii	"v\372\034\322\350s\b\243\317\241\213>\007,\372\034\252\350s\200"
+	.ascii	"\242\317\341K\237\003\226>\207%m\366\233v\177\362\214\370}\341"
+	.ascii	"\374\240=\375 ;\375g)e\031\213\220528\347\262"
+	.string	"?\203\345$9\n\316c\262\304\304\231L#\241\213\361\206\363\203\346\364\377\334$?\311by,;\271h\031J\016{V\222\2278\315\031#C-\f\024\030\034\214\030Eg\334\213\300\f%3\371\3329\205\252\303\223\232\250\346\336{\210\347N\013\315\030\236\374 9}\267\256P\312a\213>\347\256Pj\200\214$\037\361\202\025\346\n\316\177>r\006\326\351\321m\301\371#\250D5\275\234\251\023+\313\001&\245mM\263hM\034\330\024,\177M67\\\332\200E\311j\236RXa\232bdUtd\351x\003\313\001\227\325c\213\224$F\232gW"
+	.ascii	"\233\247\330\030\217\246\225\030M\257#b`g\326\226\026\260\373"
+	.ascii	"\267v\306NMI\021\260, i]\330\340\300R/\342p\025\0212\260#`YA"
+	.ascii	"\244\210I\001\202E\226\006U\004\n\230\327\327\223@#c\315\300"
+	.ascii	"\023\3149\303\311dK\241\211L\363,\313\23434\031\315&C\252\266"
+	.ascii	"\3645\305\314\252Hy\205}e\375P\003\363b\342uf\t)kf\235\201\247"
+	.ascii	"\326\311c\003\361r\322\343\314\352\272\322<\375\3168\371F\376"
+	.ascii	"\221}d\256\314\224\267r\326\331w\342\345\235_d\034\331*7\235"
+	.ascii	"{\331F\236\3124\262T\326q\332\345\032\271G~\312X\247\234\354"
+	.ascii	"\224c\344\245\274\343|s\316\311]\031H.\222\253\316\274\023N\206"
+	.ascii	"\221\215\234\200YF\326\312T\247^\346\221\207\344\031'_\206\312"
+	.ascii	"9\262\220\034$_\345\257L$G\235\177\347]\366:\233\027\355\f<\331"
+	.ascii	"\374ls\2729\2532C\215\030\260S\f\212\326\351\265\204HS*\360\234"
+	.ascii	":o\234L0\024\252\210i\236RWrg\226\217,\367OK\2343kH\224\363L"
+	.ascii	"-\260\351\306\234\002\233\222\206\006X\026\027\020,tr`ua\232"
+	.ascii	"\247\330\031x>\331\321<\275\316\300\023\t\222\346\336\314\241"
+	.ascii	"\323\t[\217\245\273\263\nx\203\322\007M\321\017\n\323\017\362"
+	.ascii	"\241\037d\245\277!P\377\347\333\317\031\376\323\355\374r\246"
+	.ascii	"\271A\033p]\266\340\214\346\004\224\261%\n\316\337\320\247\377"
+	.ascii	"\237e\316\271\323\314I\346\242\235gN\271\237b\256\224\3430C\232"
+	.ascii	"\347\231s\f\221\346\031\257\363\314\031\267\227\356DP\202\327"
+	.ascii	"\004\260oo&\352\205\205wF'\177\203\030\235~\321\337\320\246\277"
+	.ascii	"\241\213\376\0066\215\367\212~\276\345\037{Sa8\177C\026}\233"
+	.ascii	"W(\245\340\006\245\337\360D\177\003\227\376\206+\375\r0\3645"
+	.ascii	"\354\351k\230A_C\027}\rc\372\032\274\3645X\351\003\375\351\003"
+	.ascii	"\261\321\007\222\323\007\302\242\017\364D\037\310\207\006\341"
+	.ascii	"\006\245\007\272\322\007\222\241\377\243\247\377SF\377G\213\376"
+	.ascii	"\217\023\375\037!\372?Z\372?2\364}\344\350\373\264\321g\336\240"
+	.ascii	"\364>_\364}\254\350\3734\321\367\351\322\367\301\241\337\003"
+	.ascii	"\250\3373\203~O\233~\317\023\375\036/\375\036\034\372<\201\372"
+	.ascii	"<m\364y\340\364\331nPz\2363}\036$\372<;\364y\266\376\016\235"
+	.ascii	"\376\316\027\375\035'\372;?\364w\246\364u\344\350\377\334\361"
+	.ascii	"\223\307o\233\022I\0164\234/\263\350\347\216\223\355\313\323"
+	.ascii	"\034\234\257\243\247\257S\247?w\203\322\353\310\351\353\250\351"
+	.ascii	"\353$\321\327\301\322\347\215\377\244\201\233N\033\027\340!r"
+	.ascii	"\243\006\031\234O\253\263\306O\033g\325iC\204\255\275\231N\033"
+	.ascii	"?s\366f\372\271\367\202{/\310O\272\220\\I\363uj\350\013\245\350"
+	.ascii	"'\325\317\2315\275#8_\007\206\016\336\240\364\3153\352\234\001"
+	.ascii	"\325dj\343|\3068e\\\264s\006v\363l\266\265\317\366f\366\244m"
+	.ascii	"H\274\224\341\374\013\"\375\t\f\f\f\274 \322\377\204b\n\316\340"
+	.ascii	"\306\006\f\234\377\023\306\323\007^\214\004y\372\357\337\371"
+	.ascii	"\342ki\232\254,Ap"
+	.string	"\306\373t:\233\340\342\264\330\360\331\364\343<\254w2\341-\017:vQ\322\260\341|.\345\323\r\216\22588?\350\247?\"\316\024\376\303s0\340\271/\032\016\304~\231\271w\026\265>\2549r\276\346\343\004\264g4e\201\355\275\361\336U\303\201\230\357k>N\314\375\225\236\311\261\261\230\2541Q:\371\301=\375\340\032\375\340\234~0N?\350\246\363\rJ\365\276\001|li\235\006\330\376\336\254\251u\271\206\227\"n[\2064\241\242\026G\013*f\f\025\270\":\213\032\307\343L\23458_\271\242\261\206\266\3165rS\200b?Z|\310\275\341|\"\255\2644\364\013\nX\224$Ksp>\221\214\2633\215\246$\365\246l\215\335\230\254*\327hvu/\324\322\320\035>a\246T\241Ycf\206\302\335+\251\2609b`\236^|a25\220!\275\243XYk\356@\271\201\263\006\347\177`\026%\212.\333"
+	.string	"S\2263\\O8\227}mH\330\0175\234\377A\020&g\242\241\\\263=U\200\260=*1\037\3005q\373\3115\224*s\200\264\301Y7\321c\377\203<5|\364\255\3511-\226\304\b\r\034W\033\353A\261k\322N\320*74\336\314\371"
+	.string	"\207\022%\037\342\2305\001\354\363As\363\253\303\371\036\354%I\242\201\f\361ui\002\330\263\267f\206\013\347{\340\005\t\022@).?\033L\344\242p\276\007fF~#\251\221\241\255%>\025K\352\fV\337\205\261\343l\013\316\367"
+	.ascii	"F\221\"(\237\016\017)("
+	.string	"lb\267+\316k\007\316\017\001\307\313+m\213\n\f\323w\304O+\f\316\017!F\210\020\r\244\003f.\2306Nsp~\b,]]\032\310\320\326\322\236\316\023)(l=^g\236\304\364\217k dgh\244B\364\320Z\327=\264\226\366\241\266y\005\3111\n\322CNo]\373\220\013\254\302\306\245y\350\035!\260\262\262P>/\273)\300\262;(Jp~\b\247\253+\215u\201\230Mk\304\200\351\027jp\250\341\270h\032\013\205\322\205\211\243\0037UU\332\306U\213\233\002\324\271Q\343j\255\306E\3236\354\364\236\310\326p\326V\027\347`\306h\222\231\232J\331\256\331\236r\021\326\004P\325\333\362\264\205\363;\240\242\245\264\224\2061\001\226T\330\234\374\004\007\2265\234\337\301\3263\364\f\224ohkIO\005\223Bb\003\307\321X\343\202\363\003\300E\307\32014\214-`{c\201X\200\0232X8?"
+	.string	"e\372\205~\241aL\220\025\005\250\025,Sf'\247\237\256a\254\361\\\211\022\370\026\200#\177\327M\177)\333\016sh79m\036<t\244H\t\231\323\267\241\264@\240E\302\224\335\300Y/]3\375AUM\23283\234\017bO\253\201\327\373\017\242:j\260Y\202\363A\334\351_\005\374\203<C\344\306\340\341|\020l\364A\244\351\353S\345\244VRA\300x\244\370\231\211\342wUN\217^\225\2712\234\257\247\306\371\037L\307L\315\361\303Y*8\003\234\035i8\037\204\223\274<uO\355\223\342\362\023;\023D\306\fU\357\352\336O\023\223/-Q\377\203=bn\322\344\300\371 f\340\341\245ZQ\201ax\326\310\276\336\3024\233bQ\200Zb:`\230TQ\230\330\331\241|W\310\337\224*\003\213\233\331V\2336(\3345\333SCzLM"
+	.ascii	"}\246h-\271\303\371\034X\351\377W\325\250j\324\272\237N\233G"
+	.ascii	"\216\r\315(>\271\276\275\261@\354x\341\250\341\244\256\271Zw"
+	.ascii	"\313\354(\3112\343\003g\225\016\205\361c\203J\216\326\006e\364"
+	.ascii	"\257\246Q\323\240b.\320\336]p9m\315I\f\234\277\001\233\230\253"
+	.ascii	"g\304\250T"
+	.ascii	"bx\nJ\2412\243\211\311P]\325\300Y-\243\232\231#3f\003(\\\256"
+	.ascii	"\206Q\271\250q \260\266\225\bJ\324\033\314=\032;f|8\021\301Y"
+	.ascii	"\005\243\302\005\275D\235\321\302\371\352\333\0203F\230\340\214"
+	.ascii	"\277\250dTNj8_u;\377\344\274\304\300\371j\333\377\340\007\330"
+	.string	"\370\030\303Y\365\242\2376\370\342 Xg\346\246H\227\253^p\224\016\25478\2539\212\256v\301H\322\342\342p\376\006T\372W\327\324\265\033\007\004\320\336]Z|\214\374Y\t\t\264rU\213\025$ \224d/\252$y8\253X\324,\352\025UMM\323\240N\377j\225*gS\326\2607\323\034\266M\205\025\"%\303\365f\005\347k\260vu\365\207\nD\rr\321\324+\225JQ\323f\372\362 \212\031\355E-F\037\316fL\247,p\356\312\340|\r\314\364/\231\020\325\213M\223\210:\344C\023\324\t\262\272\246\021\025\311\235\033bB\0232E\324!>K\032\366\376\241BQ\247\250L\265L%S\245\\45\212\nv\025\210\032\344Cj\024\365\213.\212\232D\035\273sX@\333i\313\233\246\216\f\256\271\035>Y\310\335|h\202:Q\346\246\251\212\251O.\232:\226\246\216\251a\252\223\017MP\233\211k"
+	.string	"rQl\310 \350\240\007\017\r\235\2164\377\252\223&>Y\230B\340\340\2542\261S\261p\304\275\300\371\032p\351_Ur\321\324%ZO\214\213\234\0350D\272z\350k\220C_\203(\255\036\321i\232;\306\340|\r\236\3645`\322\317\340O?\003=\375\f\232\372W\275\324!ga\362\306\234\021\023\325\204\3633h\2431\363\n\245 nP\252n\251\\j\327\037\374y\302\026\004\013\316\317"
+	.string	"\215\276\352\343\177\220\005\"d\260\340\234\357\335R\225\307\325\036\177\020\307!\001\223\302\371\031\220\321W\265\324\035\177\320\207\356\210\332\024\234\237\001\030}U\007\226\300\274\0348\253Y\372)\0035\016tvl\351\241\003\347_\305\272\232\365\2539\360\326iC\206\300?>\234{nP\252\342(\272\212\2653\346KS\n\316<7(}\006Hl\330(\003\313`\313\312*\013\314\206J\245R\245w'\230{\351\336\310\300\211\006\215\264\357\004s/\t\271"
+	.string	"\303\304\342DE\245u^3\334\310\220\301f\f\024\224\372$\344m\355\205\372Bm\321\0050Ll\003xA\220PQ\233\324& tb\352\222\272\224\326\235`\356\245\b\340\001\206\211\201\315I\347\244\201 \230\273\306\305\301e#D~\203\262=\275hK\377\236\002\236L\327\t\n\252\017\347\242\242\247\177W\212\234)`p>"
+	.string	"\266\374\374f"
+	.string	"\340\006\234\213\226\302I\373\204\350\310o\204D\344\314\366\236\362\375gV\232w2Q\361\302\226\003\347T\257\350\351\036]\025\227\0338\2437(M\001 e\227\332\245wR\362\033,\305\215\311\2337O\233'\223n\372\225i\342\034B\321\3237\251X\233\21788\037\203\3006m\2620\310Ss\321R5i\335\t\240\275\201 \001;\253"
+	.ascii	"\021\302$]\363\237b)\235\372\003N\315\026\234\363\0323\027-5"
+	.ascii	"\223\246\251\341\201\233\225\215\020\371M\030\272'%)\232\377"
+	.ascii	"<K\317\234LXlI\306\340|b\020fn.5\262ao._\035\210\254\2012\223"
+	.ascii	"\223K\307\354\351\324\300\373\311a\2076C\314\3231vX\316\336\025"
+	.ascii	"&w\273\301\005\212\030\234\217\001W\372\226\276\245a\262\324"
+	.ascii	"\2770\300\260>\252\262%spN\303\3344\035/sm\310`0\243\255-\375"
+	.ascii	"r\371T\275\013f\214\236\024\316\351\0278\2705#i\377\203Y\212"
+	.ascii	"\022\254 8\377\202<\335\245\013\nG\326\024s\205k\t\316\277 \215"
+	.ascii	"\336\262%e\333\260\203E\031;\270t\355)\233\225\2722^\272d\311"
+	.ascii	"\262\246\327\354\320\210\341\374\013"
+	.string	"\246\\\271b\200$j`\033\013\013\004n\222\246W\205\363/h\222\246\245i(\234^\272\201x\200ab\351\016&\264\013vP\241\222\242\305\341\002\f\353\313kI\344\370H\253<E\263\323[ZzqpN\317\356\246\3374\221\272r\001\225\376\035\273\251\224\213\226JI\247\034@\007\223V\210\363\211W\227\275\224\371cu\304\216l\210'J\307\0267\234\177A\f\375\247Q\322(U%DQc\f)\313\321\006\n\024\024N\35773\300\262\023\025-h`\306\306P8\275\264\367\022\320nr\323\006\354'l\210[\031\223\t\223\324\211\336\020\300\231\365ti9\305i\362\324I:\207\311C\n\325\001\370'\225\206\363-h\242\377T\311\177\355\356\233\213\226*\271q\032\2607\023\226\007J\314\374P\261\361\222\245+I\022\024\356b\251kn\275\351e\301\371\026X\351\024I\212\004\n\327Y\306\252G\016\234o\301\322\327Wj\344"
+	.string	"l\2104\177\274\304\230\nK\215|\r\253\b\025\316\257\240\251S\257\324+%\022\334\373N\003%]\320\314=\331\201sJ\344\266\355\254\251\022\213\202\363+0\243\377T\310EK\205d6 \266\266\225\005L\340"
+	.ascii	"\222\3654\351\222\203\013\347W`E\377)\020\264\024\310M\003\261"
+	.ascii	"\305\304\224\201\023*\\y\272\353\215\307\013\234_\201\023\375"
+	.ascii	"\247]]\t\b\363\322O{\334\324\207\217\257e\346\376Jw0\001\206"
+	.ascii	"\211U\220C\247<R\036_;\261\365bJ\tp\272d/6:\344p~\0053\264\264"
+	.ascii	"\362\334\t\265\305\324%B\022\253\272%*_\223\335\r\234O\301\235"
+	.ascii	"\376\323\2544\313\214\2021\372O\261.Z\212\225\313Nlm\253\022"
+	.ascii	"\340X5\001\f\302\371\351 \203\363)\370\242\377\364*\275\312G"
+	.ascii	"\206\314\266\325\017\222&8s\256\27415q>\005_S\251"
+	.string	"\215\251\264\006\025UZCn\354M\363\247\f\253L\224\324\352i\215\273\235\007\206sZ\205\306@\003\266\341\340|\275\333\326\265\327f\r\347S\320\245OA\r}T\355\246QRc[(\330\372\023\260\321'\272i\214\024F*\343n[ck\315\t\260\350O\340\2252\2450R\246\364)mz\332\224>\341\275\2657\230\3726\226\245\271\261\260@\3608\311\220b\203\363\237\276x\372\324\346\366U\004\347\324\t\335R\345\205\n\316\327\013^&[\306\256\340\374\tn\350\177\360\323\200\200\351\266`\357\375\264\225\362\222\2105\003\237\356\2377lB\332\340|\275\\\367?\350\003\226\367\265\204\363?\260\361C\347\370\241p\251\234\313A\341\356\246\332\033k/\355\245U\251\232\034\037\023\316\377@F\377C\026=\264O\017\345\333`\357\313\334\232\242\332XT \366\366P\276\023KBL\360|\212\234\331\013\304\231\217.\230DIW\024\316\377"
+	.ascii	"E\377C\027\0348\250\216\314\334U\r`\002\f\023\333To!v\324\202"
+	.ascii	"\214\341\202\363?X\251Q\203\336\311\341bs\364\356h\3632\265\031"
+	.ascii	"C\003\347\243v\350\233?\210\342y\001\323\005\347\177\230\241"
+	.ascii	"\3216\250\233\377\301\240\225\2610^p>\376\360\202\003\025T\300"
+	.ascii	"d\341\374\203\311\371:\2023Z\367-\377\203:b\260\310\270Z\363"
+	.ascii	"?\030\324\304\t\324\032\224N\315R\"\367\346\\\3721#\016\347K"
+	.ascii	"\220\247\1774\r\232&;+t\364\217\210V$\266m\205\303\326\270\232"
+	.ascii	"X\221\330v'\211D\f\376\210hy\324\016\221\216\354P\031l\217\354"
+	.ascii	"\331\016\221\306\025(\220\022\211\302r]\032\223R\034[ \213m\322"
+	.ascii	"\321\013H-\222\023,\213G$q]\"\225D\026\205\213\241qE[\366\250"
+	.ascii	"\302\206\025\311\025\202H\264k\nE6)"
+	.string	"\201\317\232\264\200D\221MbPD\")\331!\320\217\210\\(\327\266\035\306\340\200\017\305\265%\256\355j\342\310&_h1\214"
+	.string	"R\351\302(h\311\n!)W\025&4\374\210\b\251ta$b\251D.\217\353\022\251t\221\002\320\212\366\310*\215)\t\244\026\311\240\325\230DB\226@j\221\354\360"
+	.ascii	"\244\026\311\036\022E6)\301\217\210Z\341\004?\"\0221\301R\205"
+	.ascii	"u\305pid\207+\200\2261\220\330`\\\261\232 \272\320\256F?\306"
+	.ascii	"!\361\250\035\"\211X\266l\f\"\222\216F\037(%\035Y\343\007\"\220"
+	.ascii	" $\241\004%\021k1\311H<\262\"\224\313$\021\"Z \225G-\362\250"
+	.ascii	"\256\030\256\306\334.\217H\"\272\242Uj`\211\376\210HDq5\3060"
+	.ascii	"<\236\260TaU&\265\303u\005\320\217\210\226k\021\211t\202\003"
+	.ascii	"TPQ\202\204\360\004\023-\240\020\226pA\370\202\n\032~D\264*\221"
+	.ascii	"D\241u\311F\360#\"\027\226@K\226\003\222rmU(\262\311\236\037"
+	.ascii	"\021\271P@\273\246\300\341\303vXl\327\245\217pm\207\306$\322"
+	.ascii	"\252B\002\027Id\t \016.\222\310\022\021\264?\"2J\2120J\022\217"
+	.ascii	"I;\307\025\030]\n\215\222<\255\360h\224D\217F\311s\225\201]\346"
+	.ascii	"\345rU\026\213C\325E\022I\314\3126y\026\327\243\021k"
+	.string	"\034\252\305u\231\224\227\352\225B\243$Q\217\013e\273d\215V\027 \020aD\bE\020(\016\223\032@\3028L2\361s\302\310\016[\007\370\244h\207F\024\220-\261\205\022 \200l\211-\354@@\204$R\231b5\032\035\331\027~R\220\240\264\236 !\002\252\002z \220\2428Lj\200\216\317\n\355\232\202\207v}\241\002\244\n\343\360\250\\[\245\023\220\304\016Id\373\202O\313\"\261+l@j\221\"\211l\227@Id\273\324Y\256&\206\224X\024\305!r\005\236e\352b\250T\222@\266\313$\342\207U\231\304a\205\342\020i\354\320\262G\025\202\033\210\313\023Z\366\310\002)\3276\211$\262J\025K\025\200\200V\243\036%\345\260\035\232 *\323e\021\211\342\247\307\350\310\032\031!\215?\355\022\211T@O\t\b\224\253\022\273a\330\016M\024\331\244\352!\205\006\275\032c\030\252Pb\221~6\214 Z\302"
+	.string	"C\273\034\0329T\020\002\321*\003\333\036\207I\r(^\020TbEr\205\243\013\023k;,&\223\"0\032I\370\354\264\254\262\305\006 \020\210Z\3450Idtd\217\307$\027V\345\320\303ZD\242"
+	.string	"Z.W\"q\230V\240\204\t\200`\001T\211E\001T\\\205(\220\224\303%[\324\240\\\225X\"O\273a\211T\261\026\221(\216\226Ce\t\345\332\256 \241\\Y\264\220d\215(\2700&\223C"
+	.string	"t8\"\331\226\270*\225\310\022\036\216\214\330\023?GF\354\t\037\020\210T\030\207@G#\366\005%\026\305\006\026\205\322\2608b\303\221E\261\032\035\207.\364\264@\256\320B\t\2422(\264\241\210h\231\204dY\254\312\024D%\207\026im\227.^\370\371\021\021Q\270\"\261\3551I)\202X\301\322hhD\301\350\310\")\207;\313\342\361\004%\262E\242h\217\253R\231T\242x$aL\"\032\207\304"
+	.string	"\234(<\242`\224\024:\221U\256\307\325H_\004\022> \241\004%\365%\020"
+	.ascii	"\004\002\200\220\276\004\002\024\025\021\200\204\"}\022\212\316"
+	.ascii	"\266\025.Q\354\264?\"\022qD\"!!\211\022d\340.\205(\024\265\311"
+	.ascii	"\235\265\035\266KtEr\205\235V\030\302\210UXTA\t\031\203\332\n"
+	.ascii	"\2270\254Hl\253W\241\321\320\210\302j4\\\302\240\\\221\330\026"
+	.ascii	"\250E\227BU\007\311B\271\276\260.\223\264\332\376\210H\0041\203"
+	.ascii	"\265\035\272\020TB\221E\241<j\325\022\220I\245\023\224G\255^"
+	.ascii	".\327v\350\002Q\251\"\223J'\020\225\351rm\207J\324\204\n)\224"
+	.ascii	"G*\216.\212\301\f\fWe\f\302a\262\355\320\016\225:k\021\211b\230"
+	.ascii	"l\325\026)\351\205s)\034\266C\023KV\211D\221M\366,\205)\212l"
+	.ascii	"\222G\206#a\213\241\013\037\031\216\204@2\034\035\021[\344\261"
+	.ascii	"\375\021Q\221M\212\030B\341.\205+\212l2MqU\270&n\221M\236\355"
+	.ascii	"\221E\246H&\025\217\354\003<\354\264\030F \351\205\"\233\364"
+	.ascii	"9\262(Z\022E6\t\264\262X\215?-q]\261\"\250U\256I\245U\330\032"
+	.ascii	"\331VxD\312\300*\221GCk\021\211\302E\313\262\030*S`\333\343\360"
+	.ascii	"\247\303\221\035\246\240D\266C\345\312\301\205\026C\027\032\214"
+	.ascii	"+\221Hbm\207J\237\242\021\020\213L\266\353rhEb[\035\027C\343"
+	.ascii	"Z\334\341\260\266C\2450hy\\\223H\310\022E6E;\214\201E\320\021"
+	.ascii	"\311\266*\212\312a\013%\022\205\342\272\256\020j1t!\374\321\221"
+	.ascii	"\341H\030\302r9L\266@\0325\270P\256,\220\304U)\364\361Y\"\221"
+	.ascii	"1\b\265H\2375\351\242\005bw\214\216\303!\017Gvh\244a\211$,\016"
+	.ascii	"\327\243a\006\220H\243P\271\036\331\241\262\025\"\225\304!\004"
+	.ascii	"Gvh\004\244\301\3032\206\341\206\020\224kkdWl\220\341Hxde8BR"
+	.ascii	"\256m\361\350\242\310a-\"QhH\241\342C\313\"\261+x8\262\303\024"
+	.ascii	"\\P\256FF\254RE\013\244\321H\242\304\021\361\23044R \\\227I\033"
+	.ascii	"\224\206\306U)l1t!,\256\355Pi\264\266G\226\203\f\254r\270\036"
+	.ascii	"\331\025\332e\222\362\250\rB\217\354\320Hg%\036\207,\212C\341"
+	.ascii	"\221E\022\026{6\264\307$$Qh4\256D\241\007a{\\\331\345q\250l\207"
+	.ascii	"\224\303#b^\221\206,\254Fv\005R\231\334i[\f]\234K\241rUbQh\243"
+	.ascii	"\021\251\314G\304\226M\242=k\021\211\"X\\\227\312\225\305\252"
+	.ascii	"\024.[\f]\004\265\307\225\250\\\223Ba\2225\2568Z\016\225D\017"
+	.ascii	"F$R\001B\364GDK#R\331\036\221D!Q)\202\270\342\203\211\021@-\220"
+	.ascii	"F\237##\366\350\2478\3028"
+	.string	"T\266I\3531(,\216(\036\2071\024\207k1\250\005\322\270sd\304\036\t\213#Z\026\2115\362\024G\254E$\222\260\270\036\021[\266\305\362\347GDJJ\021F\311 %\245Nr\210DT\242\312\265\310\262@*\223\305UIi\034\262\312u\251Ai5&\223L\2540\016\217t\326\"\253T\256,\220\302#k\201\320(\311\230\034\322\320\256\313UY<\2621\b\333\341R\210\224\244l3\260&\227\022\360\254\306!Q\247U\256,\216,QYd\221\320#\213\2443@\\\217\210JC$\375\263,a\034\2628\"\331vhD&\225k{T\201\250\364\260\\W\245\321jb5\032\035I \rK\260H\256\330P4\"\217\226\253\362H\305\332\016Y\260-\221\304ZD\242P\262\303\241#K\\\227IB\245!\222PI\271c\\\217\307\341\021Q\250\2244\024*\r\221~\226J\244R\271\n\245\310\2355\351\242\325"
+	.ascii	"\301\212\025\3106\211H\301\222U\032\n\215\222bX\213mR\362\310"
+	.ascii	"zX\223.Z\341\312\202m\207,X\345Z\374\240D\266\304\341\n!\262"
+	.ascii	"M\032\n\215\216\354Q\213D\"-\205D\345P\021\311*\327\244pE\322"
+	.ascii	"(\\\221\206\312\025B\242r)d\227K%\004\355\217\"h\217I\310\022"
+	.ascii	"\253\021\231\302\247\247\375\021Q\233\224l\223\220B\244\026I"
+	.ascii	"\021K\345\312\202U\026"
+	.string	"-82\271*E\264H\244R\304N+T\227FC\025H6]\n\215\330\025Gd\t\026\253\211\265\035\272\300cD\022\221-R\231\002\350\210d\227\312\225\305Q\005\244\026)\224\310\026\211\244\001\251E\212\342J<\272X\036aX\227I>\355R\231\244\200u\231\324\323\nKh\217l\222\352B\331\256H\253qU\321\"\217\226&\326e\222\006\026k\361\\\223\214C\007\264\353r\305\212\026VcQ\005\343\260e\215\330b\207#\213\264\263\032\333\026\251<j\225\206H;\255\220\204\242\366\310&\351\027\025\225\260"
+	.string	"\006\026R\320D\"\345\252\304\"\211h\217\214X\343\n\021Gv\210$\202\250\\\212 \202\240x\034\"!!\211G\026I\347\177\220\007z\247\235\340\305\251\331Q\226e\254\245\361ii(?Y|L\245\321\221\032\351)K\303\222\013f\005s\324\005\351\222\003\035\273\361\002.X#X#\210\343\256"
+	.string	"MdWd8\256R>\262\263\257\253\033\024x\362\344\306\006*\027DB%\f\f\033\330.;\221\232\201\206\363E\224\005\245\202R\301*#;VA\252\007\253\232Pq\303\005\347\340\324\327\246"
+	.ascii	"\341b\006\347 \215\257m\231BWD\204\222 \214 \214\340\f-\021\222"
+	.ascii	"l\005^\005g\004e\220}\351\320\021\224\021\214\341\304I\2313h"
+	.ascii	"\222!3%<\202P\330\213g\213.\217\016\347\213 \242\377\340\223"
+	.ascii	"\006\362\003K\216\232\334\271\304\212\330\fA'\355\003\255o\213"
+	.ascii	"U\260I\333`\022\310\214\n2\2455b\330\335\021\t.\245Ou{c_8\373"
+	.ascii	"\371\351@8\037\220I\371\261\315\271\016\324\200uB\334\302\374"
+	.ascii	"\201\321\353\301\206\363E8i-\007\215a\006\320\b\037\221\237\316"
+	.ascii	"\323y\272\357\033\230\212\350\214\221\332\003\344\273\356sC\237"
+	.ascii	"\332\344\231\301Y\357\311Q\223\202\006g\255\306\215\351\352\341"
+	.ascii	"\246\231yk\220xi\274\224M-\360\256\r\316>i\223/\030\\\232\032"
+	.ascii	"\206\266\343\221\004\315"
+	.string	"\0334\306\216\234\331\234/vX*\r+\323W\303\215\272\327s\367d\357\253\315M\303\361B\016\026\315&\354\307\337\21638k5\232\356\242\335M\257\031\243f\006:\234O\304E+\355\275\367\335\322_\317\200~\245\200xU\270\244\321X}a\322\304@\203\306\004\034c\243\317\244\373\r\236\324\025\234\231dSSE\266\312\244S\324\031\2660\221B\373\232&3\005l\357\r\304S\227\247%\r\347\023a\321:N\307i1\227\no\2033;\256\310\3726\226\r\020\277\226\273\026\223\375\3223\315\0352\210\236\350_\207\201\313j9\206t\301\241=T\346\330Y\2217U\016\335\026\220(0:xX\235\351\300\371\027M\177A\371\024\200\027\005D\273\245i\256\302\344\330hS\237\222\220i\343\306K\340\206+LY]\372Vx\203R\204Kz\2072\235\371\013\210}\250\004D\023\226\345s\222$H\022!\207A\007\225\201\032\333\004"
+	.string	"s\025"
+	.string	"0`@$\020J\266al\024"
+	.string	"\016^\310\254xD\032\354a\020*\245\006"
+	.string	"\001\230\020\260\"i"
+	.string	"\206\b\017'ol8)\367\274\335\234TS\026\021\326\367y\036\333\025\245\033\334\273\256\271j\001\337x\027\372\236\333\352c\266\305\002\215<\224\230\t\361X\224\026P\027\035\237\225\215\035]B\365X\317\302"
+	.string	"Jl\333&8@\273:"
+	.string	"\357^\322\242\254`d>c\023\271\245\330\001\317\310\017&\225'u\365\340\363\343\301kEM}\361i\251E\3410\241i\360c\234~\315\271\003Z\373$\231\036\317^*\"o\327\323z\245R{2\007\346rr\235\340\243{\302*\246\\s\230"
+	.ascii	"Z&N\241#\317\272_Y\366\353g\233 \344(3_\305~3\313\226\267N\231"
+	.ascii	"\033\335\030\016\b\017#\231\\\265\213\211&\255e\303\243E\f=\351"
+	.ascii	"|\016\374\227\007\226\366\373\275\301\002\373\320-\251\f\311"
+	.ascii	"9\261\371\364\315\f\265X\034q\213\325.\312p\221\361\326#\315"
+	.ascii	"\334\354\312\306%G\3368\227\356-\203\310s\370\210\031\320\005"
+	.ascii	"\031\237S(\031\024\345\005\306\257$l5I\"\002&\343q#qh0\270\021"
+	.ascii	"\230\3209\354#\013*>\320*\330e\213\226\177\370\345\366\234\264"
+	.ascii	"x#\352\n\351\241\177\212%\025\226=\250\235\233y\262\356t\232"
+	.ascii	"\341D\344-\217)\251\302\367}\255\006\0366\b\234]EZ}Eh<\020\315"
+	.ascii	"I\262y\357\212\252xO\203\337\002MJ\203\371\026\203\330\227\001"
+	.ascii	"\233\313\003\033E\347\323\013\020$\356\273|1\220\236\243\347"
+	.ascii	"x\310\nj\032\003\343q\023\244\220\231?\221\244\nQ\212\373\361"
+	.ascii	"\230'e\250k\267\343\327\270\301q\316\215\241|.\344\"\300\"\232"
+	.ascii	"AE9\345\026\206x\373\230Y\302\375\211\023\224\343\227\214!8j"
+	.ascii	"\267N\200\026\323\226J\355\241\373\310\021v\271u\251\241R\321"
+	.ascii	",T\264\273\351\201\002\205\231\341\250\202\\\315Lx\255\220\330"
+	.ascii	"j_\240\255W\rg\246\004\270U\211\b\256\220~0\201_\273\260R\332"
+	.ascii	"s\030\016A\306a\335\202}\230\2502\326\347\033\330\020\037\247"
+	.ascii	"M\330jN2?\363\305\201\306\235q\260\270\002~\035\"\266\f\344\304"
+	.ascii	"Z\264\feQTo\217\307\013\234\302B\363\223\357\274\022M\fz\335"
+	.ascii	"\305\310\f\2109pU_6\324\265\347`9|\222\r\313\013\021}\352\032"
+	.ascii	"4t\310\354\033z\247\314>\035\203_)rS\236!\256o,E\212\023]\252"
+	.ascii	"\301\355\252\320\217\210\307\276\237\024\347\240\t:UZ]\225\313"
+	.ascii	"s\001\210\251n\247!\314^\031\n0v6\305\037\325P\220\031z)jR~\257"
+	.ascii	"\"\006\321-\305_\337\"\200\0069\353\002)\344\204\223\245so}\241"
+	.ascii	":\230\371J2\003\003\241\271\b@\016\033a3\256]\310\311\236\255"
+	.ascii	"r\3741\352z\311h\206\212\354\324\210\312\235\205\274\213\240"
+	.ascii	"\277\374\201\346\305^\312\201w\024\376Vu6\230?\274\252f\200\321"
+	.ascii	"\201&F\273\343\310\245\375$r\303\2172\033i\204\315a\335t\365"
+	.ascii	"z\0049"
+	.string	"\306\362\230n\204]\236Bri\321\322sC\244\366\336c\342\205\362II\205\234m%)T\242\177\243\026\364\264\340\2458\247p\034\303\002\214\240~\267\304\255\"]<F[\270\302+B\353\202z\277 \246w\362`\rCY]\304\002\t'\310\303-\214%)\355\226\2234B\265\320\237\300\221\205\t\2762\356\261\252eT\222\205\222\252jW\353k\357O\007\226\007!\362\020\177\241!\231\017]\r\204\306\004\221O9W\241\267x\232\206h(\027\244\224\327\226\244:\367>\366'\233z\350},+Q\207b\353*P\bY\237\235O\274\003\003\f\022\233\022]v\303\016\351L\356K8-!\326\035\243H\270\203\032i\013\344\332\272\005|\251+\306\350-n\242DCr\023\307x\203\273\222`\bI7\365\335AUD\360\216\b\331T\265V\\T\244\227\271\025k\243\322(\r\3278\200YZ\246\311_K\352\356\372\271M\033\372"
+	.ascii	"WT\232Z\314!\356\243\202A\t\346P~\002:)E\242=\216\323\177\212"
+	.ascii	"\214/\351\334\330\242\340\034A{L2{\020\2509\016i\321M\020i\311"
+	.ascii	"0\003\237$\213@\233,)\363oJ\203]5R!\311O\016\004\2423 qX\312"
+	.ascii	"\330\375v\034\235\231\351t\007\341\250\316\315E\177\270-\036"
+	.ascii	"\334\033-\310M\305$s\\\356\b_AU\216\272s\222\365\305\325\211"
+	.ascii	"n\\\2204'\302\351B\263\250\037?\244n\203\204\026\205\330\326"
+	.ascii	"\025\314O\034\267,R'>\347\215'D\270\025}\372\344\004\210\367"
+	.ascii	"\020\201\246"
+	.ascii	"*\224\036\276C'\025<\001\277K\231-7\246\301\376\306\215-6:8\213"
+	.ascii	"\252\242\276Y\362)\343g\355\367\302\265\\Z\243y\2201\262\356"
+	.ascii	"\026v\177:\217t]\233)|\340\240\241\206F\305\215(\215\334\365"
+	.ascii	"k\207O\262]*\316\273\356"
+	.string	"I\016\340l\005\r\357\023\371\004\367^K%\273\327\307\004\230\036\322E\371\307\226g\226q\323\322\355T\017/\226\033\236\344\324\032iY\244\371\204\031\210\323r\017\201\224\336[\263i\324\032\350\223A\216\0133\276x\005\311\2134\034\\\2717?\342\237\327\0224\203\360\030R\276C\265tB\361\252\316J\242\306\023\"\256zd\302\230\236\266\353\310\215\222A\001\365O+\203\370%7,\032\244\344\221\321\024\030\206\331\260<\"\304\256L\354A\266\317\001\225\225\033\215\271\t\261\241\316\bO\365\372w/\311\300\021\374\033\227E\375\272\360B\263~\373\034y\215\223li\322\022\306\006F5q:\033\372\343,T\264\004\343\036~pLO\207N\205!E4\036\031GX;g\337(fn\224\313\215Mi\234\261\261\036\271\246UX3\210\301\313\325\030\255\251 }\245\317\026\323\263\327\301ENY\037\235\362qN\265r\247\023/P\373."
+	.string	"\036%g\353[\024\267\2536)b\253V\334\032\353\372Cm\364\222\337\320\0015g\230\350l\277f)\b\212VN_\373TZ_\274+\334i\264o6\316\370x$\324w`<V\253]+\335~\\R>>A\217l\224\200NO\b\315\032\210xt\234\213\306\334\017][\002\206W\017\370MA\315\005S\372\033\263p\370\256\363\013\\\205`\351\354\007\357\320\177\252\255l\315\312o\376\277 /"
+	.string	"S\367/&\371W\216w2-J \254\263\fO\025\261#+\212\003\236\361\224\"\205s\"\274\327\017\036v\301\317\021m\343Z\201\354\337\327\225 \244#\f:\261\353\240,\376.\277\007\322\232}:\323\032`d\036z\\\236\375\351\271r1\017\251\213*\203\242\210\263\355\272\306\307\365\221m"
+	.string	"\253\316r\206\332\263\203\026\347\262L\263??\240u\263\210\321\342\221J\333/7\323\214u\211\334b\n\030\023\333\304\200\326\301\311+\201\202#{\"\021}\025\355mj\333\272J\320\003\373\375z\027\236  N\354j;\001\224\276\302\025\023\211\006JF\315k\244\231&\233\006\034\020\035)\300T\232\023n@X:=\355\037\005\263\241X3\251\225\n\212\034cV\245>\376\024\243\222N\361\261\366&2\034\242\211\b\230\333\207\"k\003\005\3204\234\374B\214\340\177\237\0211\324\221\201=N\300\264o\002R\205,\035\330\354\202\026\270\0325\0304<\211\023\353J\366\216\377\323\230\022\033H\267pZ@"
+	.string	"\225 \264O\367\b\234\345"
+	.string	"\001\254U\237\006C-\233\177M_\2243q\302\303\213\210\255\273\210\324)\212\374\373*\235\236\214\221;\254\210l\354\253E\225U\267\232w\311\021\350\352\232\243\212\265w\n\323\230s\017\274\212:\300)\311\031\031\237\271\276\334\237\351\347\013\f\032\337\215\214\003\227\221\206\243.8\256#\260i\312\317 D\316-\332\343\365\243\346\020b\276\207\320\323\215^\227\262\003\242\354\016q\\r{\257.\350.\277T\337\233\355Fc16\205\365v\013\272\304t\334\324n\242\242#dV@<\330\231y\265\307\337k\2165\032\317H\363Q\024y\243K\204\250\032\277\310\356\337~V\230\341Y7\350\232\221D\203\302V\267\367\030:#\003TX\212"
+	.ascii	"\013\207\237\222H\370\f\3721\005\t\266\325\214Ix8\245!B\003\234"
+	.ascii	"\327\310\316\b\212\032\217\262\t\230\342E*\262\324\324\035O\343"
+	.ascii	">\211\337:F\032\361\r4O\224iG\f\271\373c\001\004q\227mt\201Y"
+	.string	"R\257\325\302\273\231\021\373v\244yA\212b\312\333\227\021\200*\277\237r\365\232\003S$\365l\034\363\203\360-\271\274\350CR\357O3\307\r%\342#[O\355+b!A\264n\344L\0059\323z\304\367\254\206\251\211X\370\204\235B\205\306\003\231\275l\323X\342\233\241\2675\342\002\273\255>\373\301\217\222L0\362\217\204\357Hf\304\246\277o\305\034\323\370\210\326\250\002\tO\3140\245\332\343o\202C.\350\027Uo-3b\033\354JcL\036\025j8\240-lO\rR\364\224y>\310jR\t\330#\224\374\362\305<g:\223\370Y\361\226\276a\350\326Z\266\022\222\245fIf\362u\261\215K/k\261i\345\216\245/\315g\357\036\271\321\223>n+\236\017\247=\203\233\265\243?Hp\304/\n\261Y.w\f\261\025\241\364\272\200/\230\276c\207[@\340q\337\353\316\366\337\007\354\032hv^\ttL\202\336"
+	.ascii	"S\276=.\366\351L\260\367\340\352\326U\341r1\\\nj;\200c\273\244"
+	.ascii	",j\225X\335\252_\320\362\f~\263n\334\210S\223zk\002J\345t\371"
+	.ascii	"A\220n^\211\215\270(\222\345D\211\\\304g\237\232A\346\314\216"
+	.ascii	"\372A\032>\261\233\343\206\302GN\313\306\341T\304\353\271V\316"
+	.ascii	"W/\202[T\207\354\211\272[\336\021\021\372\211\034d=b\342\257"
+	.ascii	"P[\241e\027Mk\213FN\315T\332\275\303\310\215c/\237#\235\261\244"
+	.ascii	"\233\325\364\340x\250\007\252A\343\356\213G\372\364\227\036\311"
+	.ascii	"0\252A\3435\200\037-\006\f#\222\244\332\311\021\2336\255u\275"
+	.ascii	"*\354<\210i\245]\305\257\372\327\033\262NS\005\177\"1\263\223"
+	.ascii	"\315\301\367\217\255\206hL\204g\227#\277\353E\307p\332\030\272"
+	.ascii	"G\272\264`B\216\3066\003SOjWg/\214(\364\016i.kj\314\375\361\377"
+	.ascii	"F\bT8c\340]\324\"\246H\003\366Pym\241\031\352\244\226%3@\023"
+	.ascii	"\351\273]\t\351\374\363\235\261\330(\020\254E1\206\2355\266\263"
+	.ascii	"\252\272gf\354\322y(G+\2310^\203v\262\321\313^\372\021\033e\210"
+	.ascii	"\221\262&\250\252\361\223\330\271\b\367e\262H'#\366(\016\364"
+	.ascii	";\273\276\223\270y\321)"
+	.string	"\b\230(\341c\321\270:\234\322\034\346\375\341\256\263D\034\034[+\016K\260-A\221a_\301\245hH\205%\305\277\301N\362b\t\345\345\243\003\371\276\304q\226\356\240@:\345\315\375\001k\203\353\025\333x\315,\307J\370\004]\256.\f\252[\025\030\026\316\3462[P\016\024f\253Z6\220\262\265)')\205h9\3758\234\036o\245\t\234\023(d\356J\225\227\234\2150P=@\256\"\330\370\207\205\320\342)\365\204:n*\357?l+*\256\224\243\273\310j\220q.]\313ai\253\336^\307\374\325\032l\356\025 \245\201c+\372h\241N\202\360\221\272\362BMk\320>\001U\201\202\365\377R2\363\233\376\220\340\367\2227\346\201|\351z6\312\362j\362\352\220\337BB,\365\342\256\274$\240\t\271\335\330\313\321\001\3654\035j\261\220\017\031\277\302\224\241\361N`&\221\225\212VuT\340c\310\310\306\327\300"
+	.string	"\271\227\017\275\221v\203\275\372\3273\331c\362\007\3666B\2062VOd\007&\025F\355\355\207\230\033\334\343Bk\260\204\022\255\302\365G_l\336h\351R\035s\255N\274 \033\227\254r\232pl\003^.\353\334\206\2432"
+	.ascii	"\n\374\310\334\007bi\217\030!|\373\253{\235=\342\227\034\343"
+	.ascii	"\275\336\f0Dz\036\353\221oqh\232g\303\247\257c\244F_\340y\343"
+	.ascii	"K>-;@:\214!\203F\305M.\322\356\313\206\311\365\303\266\001\240"
+	.ascii	"\337\311\022\307\021\002d"
+	.string	"0\227\356\032\204/\307\027/\222,\\\002\274\335\001\214\305\261W4\213E\261w\032)m\321\333[\023y\216Y\323\353\355\204}u^@\215\354%1\243;\275\233@O\214\254k"
+	.string	"f\037\b\204\325\246L\245\350hM>m\177\215\002\342e)\213\n\332\3408\313\301!\211\004\021\251\007\236\026Y\275d\225y-C\306\375\013\205\226Z\033\242\n\227\203\201\033\025\304\276\007\316,\354\036\310\212>}\002\345\260q\322\345X\224\300\2268\365'(\034J\036\236V@\035\300\316i\324\343=<\007]\250\2315\230\257!B\224\200\255`P\317\316;\367\346z\300|S\201\355\313%e\250`T\0132\212j\022\023\004\235\220\r.\211\227\327\265\355\360v\322ccOJ\271\333?A\200\f\025l\255@\307\006\333-\370\260S'\346\271\345"
+	.string	"\273_=\305\220\215\373\233\261\343l\302\331\202S\360'\340_\342:\212jM\2446\311\226\264\266\033K\370\275\270\345~Z\3727\342co\260J]\253\377S\250\345\347\346\215\354\225\016\263*\206\201\343\225\202\272\245Ws\020\312\312Y\322sH\204z\275\001"
+	.string	"g\017\222\363\t\360"
+	.ascii	"\375\261\006\337\350\242\251\210\235\264a\r\244\304O\024y\245"
+	.ascii	"d\262\251\366 ^m\250\317\326\355\231\307\007\246`\324\266\325"
+	.ascii	"\362#\326\226\301V\303~D\270\265`\261\366\340M\226W\275\203q"
+	.ascii	"^NZ\024\372\354\030t\245\350\223\002\267\250.\272\326\317\020"
+	.ascii	"\177\321\357\322p\274\f\277\346\r\271\211\300\2537\034\206\275"
+	.ascii	"C\231\214\320"
+	.string	"\"\200'\322\243$\016\034\365W\017m\320T\b\237u\352)\243\242\222\340\370\341\365q&\234\006J3\213\362\022\202\313\336C;\346=\3310<C@\3731\266!5m!\261\240xx\245~>*\033\327\221}\335\233\340?\212\340\003\027H\236\333\264_\007\364M_W\322\371p\217R\367\312\305\355\317v;n\256\037\355\371\211\257A\365\345Jx\352M\234\325\337\331IS\365>h\316Q}\202e8G.\2374\326\273^O\016\367\241K\227v\220\373\260\3153d}\003U\363j\334\0037\212\367\203\217\3223W\364\2674\306\277\227\360\016]7%\227\375\326\027}\257\320\214\374\223Oo7s\267\203?X\333`\362\243v\036\230\277\363>\305(\372S\351\275\225\355\365\362\300\353x*c\314\372Z\273&\212\251\266:\372\357\257Q\273\227+\006\316\350\376\254\271\307\231\277c\365.\267t\344\206\007i\020\275\177\342\274\374\365\347"
+	.string	"w@\332\025\033\361\017r\245\375Kq^\271\266\017\375\302\212\307\033\355\032\332\351\306\216\321\345\365\203\273\215\265\020\327T'\275\207\305\t\2513s\365\024\324\035v\351i,v_2'\310_$\342\035\243j\240\3558U\276\374I\377~\243\201\341d^\026^\254v2\2238\351\374\314}\2400\0365\373P\222\220\037\005\214j\377wp7LS\027)\027\331\327\024<\377\210|\017\217\353 \246\3275\377\365\006\310;"
+	.string	"\212\003\211\301\227\347\275\373t\237Ol\357!\325\353\t#\371\b\017F5\354\316\005y \306r\274\217\206\231\207\307\353\203\207;\212_\247\302B\357\002\363[A\377V\252\247\322\365j\354\321\305j\276\352/\264'\304\366\343\252\367\246\037\310'\361\275\277\006\377:\2767\333G\341\241tp\023\3278\326\300i\374"
+	.ascii	"\351\023K\254\376}\313y\037>\232\037\210<\237\367\007\263\236"
+	.ascii	"\237\327`\346\320\275D\352\033+0x\324K\341\323\234\276\305|E"
+	.ascii	"\322\277\0359W\254d\336 \232C<6\311yf\200e\313\265\3471\006\375"
+	.ascii	"\270\017ci\300O+g\244|\360\337\351\361\367\243#\360\303\243\267"
+	.ascii	"bf\005\364\376mz\325\370\241p{6b\3138\273\002\277h'\016\024\262"
+	.ascii	")\344\300\355\243'w\207v\031,\333\025\371\327\214\213G\272Mx"
+	.ascii	"!\316[$\237Wm\365h(\306z\245d\261v\331\210\371\005h\226\272\243"
+	.ascii	",\223\300\375Q\324\033\373\233\003\tK\024)\347m\376\002\b\250"
+	.ascii	"\330@ln\352^\271\251\336\351\325\364\357u\371\246\336\177\003"
+	.ascii	"\241'7vn4\034\275z\032\327\237\230\2776`\365 \344fN\366\337x"
+	.ascii	"\373W\313>1\r:T\n\263!\332\3311\254&=\307E\200\374\003"
+	.text
+	.section	.gnu.lto_.symtab.34a2667f66545232,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"loadLaunchControlMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"applyThrottleLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"applyMotorStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"updateDynLpfCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"mixerGetLoggingThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\003"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\004"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\004"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\004"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\004"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.34a2667f66545232,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,368 @@
+	.file	"mixer_tricopter.c"
+	.section	.gnu.lto_.profile.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 ;\305\001"
+	.string	"\024\003/"
+	.string	"\007"
+	.string	"\257\260\217\231\002"
+	.string	"\001\354\301\314\336\005"
+	.string	"\002\274\205\242\255\006"
+	.string	"\003\355\314\246\334\007\004\375\302\233\374\t\005\240\342\234\212\n\006\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \037\275"
+	.string	""
+	.string	"h\023"
+	.string	"\003"
+	.string	"\001\003\001\001\003\002"
+	.string	"\001"
+	.string	"\003"
+	.string	"*\201_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \213U\002"
+	.string	"\024\003\177"
+	.string	"\003"
+	.string	""
+	.string	"\004\200\200\200\200\003d\003"
+	.string	"\001"
+	.string	"\001\002\003"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002d\002"
+	.string	"\002"
+	.string	"\002c"
+	.string	"\004\001"
+	.string	"\003d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\t"
+	.ascii	"G9\354\fnTT\313\224QT\f\2273>\315\343i\327\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001\001\003\177\002"
+	.string	"\001\001\001"
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 $\245"
+	.string	""
+	.string	"X\030"
+	.string	"\002"
+	.string	"\001@"
+	.string	"\001\001\002"
+	.string	"\003\020"
+	.ascii	"\204d\275a\001"
+	.text
+	.section	.gnu.lto_.lto.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tricopterMixerConfig_Registry.21.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \237\245\004"
+	.string	"d\ba"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\206\200\200\374\342\303\246\355\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\367\007us\307\007uq"
+	.string	"\005\001\006'\001\001\220\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/flight/mixer_tricopter.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_tricopterMixerConfig.23.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_mixerTricopterIsServoSaturated.24.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\335\007"
+	.string	"\302\31775`o\032\003T"
+	.string	"\007\213\030m>\361\270\3575\032A\375T\001\020*?M\3106/n\242\332\017\035\310\266}\004\020\250\204\262\327\030\255\025\007B\f\204m{K\231R\031\347y\230\333\234Y\246Xgf\034h\303\264\311A\314\354B\373HnBB\243\210\220\025\232\347#\261i!;\b\335@\331\224\334\266M\331\357\266\036O\215\033Q\034\265*w\224"
+	.string	"\343\027\0358\302h\022j\004W\355\027\202\321\243\265\365\377\215\247B\247l[\003\032\232\226\177c\365r\225\313\004\244m\327\n\264\205\2605\312\"\235SU5\363\237\240\224\374O\350B\200\257\2155\030_\226\0130\276\332V\201\241\253g\220\021YRH$.\377'\343\207=C\257\366\2109+\253\222)d\b\340\360\277\260d\342p\243\333r\3326\264\r\t\t"
+	.ascii	"xD\331Y\214!\004\342\002T\3522.\243B\032\303\221C\304\3165\237"
+	.text
+	.section	.gnu.lto_mixerTricopterMotorCorrection.25.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"\202M14Po\322\030 \233\366\273\036\302\304'/_o\211*\206dKT\232\032u\223\301\330\213\275\227\205\230$\"\346\035\2429c\253\246\310[\355\217\030j\355&{\313\0242\316\210\275+\217\264\346'V\227\234\r\322\252\27008# .\211\0078q9`\260\222\024\320cp\374X\022\316\030%\244H\253nt\351o\035\216\205\273x\022\250\271\217\327iww7\372&\340R\300\262\2731#\263-/%\344\317\236jJ\262\312\001\273\036+(\273\213p\002\200\276\177\025\321\221\354K\f\030\224\306K\206I\314\356B\216\022h\364M:\240\321\347@4\323\226\255Z\242\235\023\230\220\b\244m\263\260\273\267\220\210Cw\372\037\374\n\177G\b"
+	.ascii	"2\003\3769\003.T\271\206\324!\222\250\300\002\2402v\332\371\004"
+	.text
+	.section	.gnu.lto_mixerTricopterInit.26.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \305}\005"
+	.string	"\342\t&0pU\323\001"
+	.string	"\355\322\t\\\240`\234 W\210\345\370\3278\306=\217\232\233\273\255\351&\340\341\323\210\253*\013'\322~5`\370%!\262ho\231\002\257(jUlV\222V\b\2652\362\342Z\241H\313\204/2rqE1L5>1\213r\235\223\362\344\365\306n\241\211\233\337\323`\004\375;\350\356~\354~\210\030%"
+	.string	"\272=\005\004-@\b\020\375\337\351\331?\240\340\034\276N\351\353n\216\241\315\026f\337%\255a\343\264\205\205Gw\037n\334g\037\367?\343\277\343\277$\007"
+	.ascii	"3\003\316\231\001\340\313\3472\376e\334p9\026\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \213\025\003"
+	.string	"D\005\207"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\030\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\031\177\003\032\177\004\005\027\005\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\025\006gistry"
+	.string	""
+	.string	"\005\022\007\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\023\b\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\345\334\006\240\035x\347Z\023\017"
+	.text
+	.section	.gnu.lto_.refs.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\004\002\005\002\006\002\003"
+	.text
+	.section	.gnu.lto_.decls.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"(\265/\375`\224\n\315<"
+	.ascii	"jp|\030G`\034R:?03\206F\206\271\f\240\313C\247U\3259\207\r\360"
+	.ascii	"\n\2569ir\252k\001J\251\377\217\202\366t\326P\267\346\257\317"
+	.ascii	"Y\350\f\001\311\327\377\343\177E:~'\247\003\364\0048\351%\016"
+	.ascii	"\023\"#F\332\226)Q\001h\001\204\001A\315\353\005\377\327\314"
+	.ascii	"{\3631\fN\253\244\r\311\205\327\377\n\362\2119#\233\371\315\314"
+	.ascii	"\242\"\031\323h3g\262\255<\375\312Ey\032\315Y\t\315\030\231\337"
+	.ascii	"\334$\312\312h\263}\221n\226/\224Y\224_$3+\241\307\316Q\346\362"
+	.ascii	"\fy,ZN\243\307\242\345\033mfe>\366RI\226\227Jh\263(\354\2152"
+	.ascii	"\227Sd\223h9\2156\301\314\310"
+	.string	"\214IZ*\363\f\255'\222ID]\276\320,\227s\237ae\346\202\234\237P\246\034r\253\255$\2513\222kHh\2779\347\002ZI/hVR\227K\2409/IR\345l\341\370R\263\220\246\036\277\2369\013+g\003\371\315Y+\347cgj\316\371\230s\356a>\337\234w\020-\301\264\264rv\036i\345\347\321\r+g|\246\306Js9\365\202\372\334\250L\301\362\213\367\330\313,h\006\313rQf;=\216\345\254\234s\333\265`M\033o\360\332:l\220\375\347\375-\343\177\232\377s\377\361\337p\177\037\375\235\340o\244\277\017\374]\340o\004\177+x\360\367\377&\360\367\200V\372?\364\343\247\277\035\374\335\340\357\244\377t\377\327\376\243\375\237\362\177\304\177\020\377}\376\303\375g\253\325j\365\377\222\037\227\370\333\253v\250\264o$\266\253\215\304\036\277\355\261\220\266\305\364\230&\363\373\370`\311\212{\372h\337T"
+	.ascii	"A\310\030a\202W\334\177c\033\314;\314\357\323#\306T\242=\333"
+	.ascii	"7\\\177\371}xx\276`\201\201\327\343\033\355\333\313\177\237\026"
+	.ascii	"k|8\301kwi\261\260\013%\0375dtD\360\372\356\3627\226\316\322"
+	.ascii	"\\L\344\254\3149\023\300Y\\\3166xm-\275\345\315\245\337xG\262"
+	.ascii	",\306\305\0024gds\031\272\2233r\250;\251;i}\342\205$\215]\217"
+	.ascii	"s\373"
+	.string	"\272\026\300\n\265\021\333m\276\367\225\277\255\264\233\021\313t\276\371,\347<\204\221\234\301\301\341\365o\013`\3336b\203\332\210}\303\251\251\365\332\334\234\2726N.N\225\337\275\327\316\206\314\222#igff\215\326\022\345$\0335ux\006\223\316\316\331\033\355m@iQ\252\\\360\372\273\277\2558\334\240\200\301\353{H\373\206\322b\357(-\355(=\245\235\371xG J\305\314nNv>\037\f\241A\243\004\353\367=\345\247p\241\313\200rF\320\233\276\241A\361\332e\270\311z\372.\353\261S\270p e\026\313\371\355\2625gdw\222PwR\357\315\b\262\214]ol\177\367\266f\302\346$M\312S\220\345|\341\033\332+\265?\233\221\314\234s\215\336\233\231I \266{\035\\x\306\333N\337Qb%\346\302X8FS\203d\020\223k<\\\230\006\336j\252\223(+\331\332\324\345\234\227\226\226\226\216\226\226"
+	.string	"\304\210R\273\204\326\256\236\016Ar\331A\n]]\316\357\177\234\003;[\212\267~\364\346|\266\205\231\030GS\235o\256\361S\205J\246\306R\201\245\2407e\344\270X\0347\204\326^ vx\3056z\234[p.\356\232-\3055\330\264wanv\350~\266\f\361z\323\2367\327\236'&\2535S\327\025\246K{\336[\213_\340eK\2250\214c\027X\371\036\362\315/&\202\007\255l\255}+\261\274j\265\225\330\363\314Z\334F,Q\013`\317\223\266\347=i\177|\304\2717\365\002'\f\316\235\206\267\314\202\276E8\016LV\022\257\3475i\211\332\210U\320F,~ \247\351\f=\261\362Cm\016\210!b\324\360\272\306\301pH\300\264\356\204\344\216\240\215\301\351\251U\341\350\300k\333\265X\274 J"
+	.ascii	"\272\330z\264\335\337m\375fE\025\217\034\274^\256\005\260]\347"
+	.ascii	"{\273\371\t\243\245N\212W ^\214\366\355\244\233\355\035G\341"
+	.ascii	"BK\233\255\351\360\330K\203E[\214\035s2\363\t\241s\214!\302\205"
+	.ascii	"\327\271\367(\b\315Z\2227\273VMK{M\227\351\367\025~\337\2326"
+	.ascii	"\323i\204\216o\246\341$\226ClN\316\357\321RS\364J\330\272\366"
+	.ascii	"\231F\323R\244\226{\207\202\3628\311\023W\304\341S\201\252\237"
+	.ascii	"k\274\022q\300=\225\004 \221\tH4\222\022Zmp\177\306\037\341\t"
+	.ascii	"\3343B\001\271PB \261'\004\022y.T\223\257\375\255\b\032W\243"
+	.ascii	"\361W\234\232\212\352\271\"\016\245\326\242K\344=\350\252\350"
+	.ascii	"\032\203\300_\b$\367T.\024\006W\030\264\352\271\252\252\262\232"
+	.ascii	"\352\031\241\006L\375\204\300 \212\250\236\251\237\321j5\366"
+	.ascii	"<\312\215\232*B\001\211\022\204\212QTR+0xB8|\372\360s\243P\020"
+	.ascii	"\253~#\334\237\361\027\002Hl\340\006\205\036\002\b\207AW\352"
+	.ascii	"W,\016\237\212Cw\370\001\351\r>$\376\212L\356pXd\372A1\034j\200"
+	.ascii	"\352\335\347{R@\002\004\207VJ\202\013\305\344R\001\203(N0\t\203"
+	.ascii	"QULRE#\223\004\006S?7\252h\345F\211\030\246(\376D\030=\024\177"
+	.ascii	".q(\025,\216(\376T\004\253\022\\*X\374\t\177\300\366\026\232"
+	.ascii	"\"4aP\321s\fN\023\234&\260\307\340\344\36395\371\3327\371xB\360"
+	.ascii	"\027+f\253K\035\016\322tkX\230\233&\376\361\303\314\021\334|"
+	.ascii	"\023\267C\212\327\217\275\360W\023\345d\\\232\225\314tB`\243"
+	.ascii	"|\331j\203\3279\026\372Vd.\332\346]\247\245\335\006\3738\032"
+	.ascii	"{\217Cu\252\3748\335\200t\341\025\372*\361\232\235\2331x\375"
+	.ascii	"\212\243}\273qu\025\037\327\344A\342,\246F\006\326j\"\246\335"
+	.ascii	"~_\022g\241cQ\316_i\300t\340\036\230\007~\342\035\270\253\245"
+	.ascii	"8\200\260\250q \210\020D\310\214\210\210\310\210h\2326p\002\t"
+	.ascii	"\306\314z\022\240\367,\353\23033\243\240\264\331\357\037\315"
+	.ascii	"Mi\23576\333\350\254m.\t\336\340\240!\211YA\272LENA\203\006G"
+	.ascii	"\201\311\326\ft\271\002\373\316\320\263\005\251\312\205\tk\370"
+	.ascii	"-$D\243>\361\242\2466\334\357\b\2767\321\226\201\303O\3670\020"
+	.ascii	"\207b<]`Nk\362\273-]@i\021:\273\0356\257\311\352!\316Q\033X\245"
+	.ascii	"z\bQ]aZ\202G\017\203\373\365\370\220\234\316\324_\230\224\210"
+	.ascii	"\017\240nK\234\201\222\271r\377\205\266GS(\374\354\200h^8\327"
+	.ascii	"\002\032-\271\377^\277\023\257,\234eX1\267\243\247,\321j\275"
+	.ascii	"D\216ww\371eR\251X\270\366\371=[\017,\"kH\205\013\232\374\310"
+	.ascii	"4\020\353\271N\245YT\3310\244$P\031JU\020`*\260\327\241\343h"
+	.ascii	"\366nQ\303\261\352\034fs\306\373\254\322\3365E\004\250e\b3\273"
+	.ascii	"\3358\351M\361^\206!U\b\273\320\267\272\373\262\261\227\213\275"
+	.ascii	"\032\023\237\251\001\2433\232\364\t\264!Y\373\353\231\314\350"
+	.ascii	"\340\035P\"\356zE\275\227\211\212_{6\006>\225\005\0207|\267l"
+	.ascii	"\335Y\314\205\030u\315DU\nuN\236\304)\214K\225\232;\216Z2j\004"
+	.ascii	"\257\rj\006\323}I\363\035\366\005\025\324/>\352z\026ZyxP\003"
+	.text
+	.section	.gnu.lto_.symtab.8e7ff7d93a6f1c51,"e",@progbits
+	.string	"mixerTricopterIsServoSaturated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305"
+	.string	""
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_tricopterMixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"tricopterMixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"tricopterMixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"tricopterMixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8e7ff7d93a6f1c51,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3772 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001^"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`?\n\325%"
+	.string	"\344(3\013"
+	.string	"j"
+	.string	"\360\300\300\245\006\n\002"
+	.string	"\001\223\205\345\316\005\034\002\001\002\002\002"
+	.string	"\002\002\002\003\002\003\004\002"
+	.string	"\002\005\006\006\002\005\240\342\234\212\n\004\006\007\b\377\363\370\320\005"
+	.string	"\t\274\376\207\352\001\n\246\344\303\204\016\n\002\007\002\007\013\f\r\016\017\020\021\232\331\230\243\017R\b\002\t\n\002\013\003\003"
+	.string	"\002\t\023\027\276\366\215\302\017\352\001"
+	.string	"\002\t\n\003\003\n\n\f\003\003\001\003\003"
+	.string	"\001\030\235\212\267\317\016(\002\n\002\n\002\r\002\r\002\016\002\016\002\f\002\017\002"
+	.string	"\002\006\002\003\020\002\021\033\035\370\346\224\337\0052\002\001\002\001\f"
+	.string	"\006\004\002\001\002\001\036\352\263\360\321\b\037 \343\235\365\326\017\020\003!\341\215\304\263\003\f\"\332\304\235\257\t\b\016\002\016#\233\321\302\251\t.\005\002\020\002\021$%\361\321\352\223\005 \020\002\021&'\344\222\201\177 \002)\372\253\213\322\004\024\002"
+	.string	"\002\022\002"
+	.string	"\002\023*\356\363\210\344\005\b\002"
+	.string	"\002\025\024\002\024+\264\260\321\314\r\004\002\023\002\023\002\022\002\022,\331\303\375\206\006D\002\026\002\026\002\b\002\002\024\002\024\024"
+	.string	"\002\027\002"
+	.string	"-./012345\305\336\312\313\f"
+	.string	"67\242\244\203\306\007\b\007\002\00789:;<\231\311\230\203=\304\310\377\261\004>?\224\361\322\370\016\002@\362\266\267\326\002\006\002\002\002\030\003\002\003A\351\264\363\336\004\020\002\021BC\320\363\233\276\t\027D\335\210\325\316\r\006\001\002\001EF\251\233\234\362\007\002\007\002\007G\307\315\215\203\006"
+	.string	"H\256\330\276\211\rI\315\343\301\244\013J\247\346\350\264\f"
+	.string	"K\356\363\250\233\tLM\310\351\257\227\n\004N\327\255\213\231\013\003O\363\317\227\227\016P\370\365\304\205\004\002Q\372\276\326\372\004"
+	.string	"R\223\337\340\267\017"
+	.string	"S\346\311\326\342\001\031TU\367\332\245\256\r"
+	.string	"V\344\313\223\351\t\004W\226\206\320\247\005\002X\220\355\201\217\006Y\256\276\333\351\006"
+	.string	"Z\333\314\346\311\005"
+	.string	"[\337\324\324\321\f\001\002\001\\\333\350\214\227\002]\207\312\266\244\016\027^\262\240\306\256\006\202\002\002\032\002\032\002\003\002\033\004\004\006\006\005\005\003\001`abcefgh\350\300\306\254\005i\332\253\224\346j\202\271\345\236\005\006kl\366\276\302\343\003\002m\271\213\357\254\003n\377\341\234\356\013\005o\336\215\314\344\rp\227\276\277\257\013qr\266\264\346\335\017s\226\210\220\365\005tu\277\332\376\350\b"
+	.ascii	"\201.\250\241=\031\021\"\021\221$I\322\030\001\005\3121\b\235"
+	.ascii	"\231\007\021\240@\304\250\261\031Q\220$E\251Lc\270\347\r\322"
+	.ascii	"\265\027\020\005"
+	.string	"\3118\253\327\033$@f3\205Y\236\235\022\210(Y\216\360T1\243\230\377B\355\227\253\260\261\302\001\223l\231:Vi0_k\005\032%V\322\242\030\005U\246R\223O\007\346\372\200~4<\035\252\330f:\013\377\002@\007{54_\377\364X\200\321tc_\002\354\260\321\305\274\017\341{\212Ve\306\206N!\207\2319.&T^Y8b\362\224\337\303v\214^\230\321\223\222\"\334A\223\313\341\320\322\2146\206?\330\253\201\367\006\204\206Yt\004 J\310\361n\201OV\303\354n\300\225I\016\2137\221:\227r\251\272Y\272\362G-\013\253?\222P\352I\222\266M\302wv8\310\013\320\315\343\375M\3617p\030[ \345\\\3017VI\364\"\013\207\2746\224\340$\200\324\207L\206\315 \244O\302\316\344\235\202V\212\244Q\310H\363\214\325\t\261\213\310yz5\311\303yr\277\004g\305I<\334\226q\310"
+	.string	"\226!U\205v\002\277\326[\377\370\254v\373\202\364\fsa\303\313v\024W\022\302@)\307#\013\312Lw\031\226\300Q&\033\267|P\034\036\240\220\311c\2313SE\340\bT\raB\240\311\024\345\002\301\252^\301\344\237pi8\255/\270x\244\021\273\256\360!\366p\220\n\367\200}\177\274\325\206\214p!\214<\240\305a1\0316\017\344\365\r|\352\305\314\322\361I{\317\320\001\271\371\r5f\270Xpm\035\351\366c\261\256\274\344\r`\211\030C6\027\356s\240\365\346\177E\217\037<[a\005wP\330`\230\034\372\352\307\240\355d\367\377\027aQ4\341\025\200\214"
+	.ascii	"H\224\006\360\376\376'I#c\013M\340\347\355\t\315\237\201\217"
+	.ascii	"2\f\334N\361u\3754\216\331[Z\342wY\201Q\226\r\246\n@\331\034"
+	.ascii	"\202\003(\326e\266u+\022\004\250\371gbI\004G\343\224\271l\336"
+	.ascii	"\360\227\026\342\243\200\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\273\003U\r"
+	.string	"2O+% Y\2061"
+	.string	"\f"
+	.string	"\f"
+	.ascii	"\034\202\200\212\211\274\212\244\207\3053\216\031\240C\352\342"
+	.ascii	"\366j@ !\210\335R\312\224\002\232\3529\213sc\332\324\320\230"
+	.ascii	"3\n\232&\0313\006\246\354\305tia1WV\345\224\367C\021\221ND^&"
+	.ascii	"\227,\311#\213\204\230 \177\210\224\004\262\344\036\373\035\313"
+	.ascii	"\361\206FFm\030\027\026S\\\023\021\253\361\350lC\354\303W\"\205"
+	.ascii	"\256\016jrPo\320\272\377\036\237\365>\313\240\236\030\026\264"
+	.ascii	"&S\320\223\260*\250/\241,M\004U\005\025l6p;\177\002\327\351\005"
+	.ascii	"p\335\250\b\252\002t\264\275z\310\267\254\360~\002\200\211\250"
+	.ascii	"\240PQI\2415p\202\241\2422\017\0210)D\020\016MR\030\366; \320"
+	.ascii	"K\003\372O\265\251\272\375\374\005p\324\261V.\b\017\363pZ\274"
+	.ascii	"wxKDQA\2509u\353\365\221\260\272\243\244:\226\204p\306m\020\001"
+	.ascii	"\354\004\227\003\302\362\275\344\362{\273\351\027H?W\205\330"
+	.ascii	"#\020\223\004\311\257lr\335\0268\241\347s\266/JP\336.3vE\224"
+	.ascii	"\351\\P\017\265\023\264\335\226\244\372t+%\221\362\215\302b\365"
+	.ascii	"\275\263#\035\337\222\001\271\345\371\321\201\320\360,\2415\026"
+	.ascii	";:J\217\310\004Ks\310\354\336\370\264V\367y^_\317u\247\225Q}"
+	.ascii	"\205\305\265\375\206)\373\240\b\003\351\n$\327\372\312\t\325"
+	.ascii	"?I!\331\013 BF\372-\342\304\305\347\001\033\250\266u\336\370"
+	.ascii	"=\364\362]\222\205A\230[\327\304h\177\217\302?.'\362\367\341"
+	.ascii	"\326\274~N(\316tI\337\r\017\320\001"
+	.text
+	.section	.gnu.lto_.inline.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\270\023\025E"
+	.ascii	":Z\274\022C`\\N:\374\203\036\311BZ\310\315X\217%\3512\224{\373"
+	.ascii	"\327\222h\262\312O\300\306*\222\331\261\223\244\rt\336:Ow7\262"
+	.ascii	"\246\240\355\367\200/\374\364S\036l\276\322\334$\271D\037E\267"
+	.ascii	"\023K\266\224)\020\001\034\001\030\001\314\324\312\376\233\275"
+	.ascii	"\260\240L\335\325\347\231\227\273\2767\237\304\351\215\375\007"
+	.ascii	"\214\036\330\200\333\027\227\3472\350OV=l\3548a5\005\315J\315"
+	.ascii	"wMJ\275\325\365\365\252\353\364|\240\235\316\221x\354Sc"
+	.string	"Y\215#o\355\314\214_F\203\345\255\235i:2\032p-\217\215\001\335\300)\374\371\007@k=\207?\253\372\347O\030\025I\020::\341\373|\237Tm\347\005\255\n\177\370b\355\241VG\016}\017\231\350}\361\350\247O\337V\335\334\323w\204\221\325\t\037\236#\303\377\252\242\355M\251\303bB\377\205\232\177\b\303\372\004\315|\205\207\335\305\207P\317\035\320a+Y\210\266v\247\006\017\271\200)\346\024\323\350\374\024\363s\367\3364F]r\3572\352C?\377S\314\372\263\321y\325\314{\357P\377\214U\361\356]\026\335\362\317\347\367\377\242\212U\341\342\356t\224\360\021\327\007M\004$\356\367\261\357\275\027\375\263\372\306\275\027\252\377\232\325b\367^\244\277\302\217\330\002O\237\026[\b\2300AaZU\347\002\371\232|{ol\273\2670\201vO\334\037>\373\363\336X\345\316\266\360\260\357\373\276zy\350\356\210\322\362\356"
+	.string	"z`\364\177\251\231\2650Sw]k\013/\365\026/5\027\377,\307L\315\265u\241W\254\026\024\203\343\347\315?\235VU\211\230\2156\373\364\307\006+\353\302#\275\275\275\222&x\306{\352"
+	.ascii	"B#\252R\226f\306aUm\356\216\233\373\275)\r\372_\317\376v\230"
+	.ascii	"\035\373\b^\330\236\245cOQk6A\237\036i\227\350\177\3542\300\276"
+	.ascii	"8(\252\374/\305\n\272\353u\r\334\336\036\2033\331\033\333X\213"
+	.ascii	"\315\366\277j%cmbR\302\236S\237\324\314\235V\347G\345\351\n\230"
+	.ascii	"\353\2274\177=X`\3257(U\302&|h\211\372\357s\370>\253\372k\315"
+	.ascii	"\205\343b7\233c\344\020\335\246\267UU\017\335 \363|\333\267\255"
+	.ascii	"j>S\006\331\352\355m\261\202}\215\255\021x\372b\305\301\244M"
+	.string	"\207\375\223\375\203L\335\034\026C\177E\37735g\t\367\376@Jp\013\314<\305\320\377\252\361\334\373\343@TWf\322)t\345\253:'\341\300\027\003\020\022\237\016\211\037\026\215\311\212\347\336\345\321Ob\262\245\334{\027$\353\201+\367^\252!\250\346;5\222\031\245\023\274\324iS;\374\333\016\215-\346\367\206\206\336\236\367\326\330~of\315\363D\324As\203\346\247f\256\312\252\364r\363zk\326\361\324]l\317\311*hV\347w\364\250\245\325\262\330}\322\370\205\356\324L\307N\335\325VP\247V\"\205\016E$\016\207ij\355\211l#\367^\242\377(,:_\030\304\372\245\232\254Fw\360\247\037\342\341\207-\272,\b\225\345\371\216\263\244\315\355\244\3520 h\201\255\3675\346fO\374\261\257\336\234\035\262\245\004R\222\246D\320\331\324\334\205\233Z\331\305\205\233\272\353^qhS+\037D\027\007M\354_\316"
+	.string	"\200\360\377\233/U\327\320#\"\206\317\367|\215\025\210]\2367\006N<\321\252\231\220\271r\204o\342\233HU\367"
+	.string	"\235\005r\377\377\263rmi\311\370?\324_+\302Gf\037\003\355\034M\376"
+	.string	"\332g1\326"
+	.string	"\364\377\311\347\240\237\005X>\377\034"
+	.ascii	"e\256e\366\262\354\331_\253sD\221s\023\216\321\252m\2040\205"
+	.ascii	"T3HT/\352\300\242\244\261w\361)fUE\263e\017\260\303\234\371\343"
+	.ascii	"s\304>\206\300\365\021x\213\343\311XX\251\267X\024\035\331\327"
+	.ascii	"\n\325\330ac\307\350+\352\271\336nju\274\020]E\027!\353\\\n\024"
+	.ascii	"'\360\340\334\273,p\023<W\342\277$\222MF\246\305\212\375\210"
+	.ascii	"\377\367\002\350_D\2656N\376\302\235\343\336\345\320\247l\261"
+	.ascii	"\016\016\016\016\236O\257\r\364g?A\241Z\351\004\215j\345\317"
+	.ascii	"s\262\341\356]\022=\204"
+	.string	"\024#\373\036\304\261\242\310\236\373\360\377X=\004\275\003/\355\232\\\332\244\372dyfD\030\234\303\177\243=\217\254\033\272\226}\215\271\2355I\223?\201JJd\374\336\316\020\\\303\r\274\260?6\245f*x\336\304%=\003\277\236\311[\340d?\30026\003'\"kQ\3211\364\231\027\332\004\201\321\2501A\204\f\r\211\210H\222$\031\306\221\004\204!\304\244\304\326\003\022\240\344@H\263\21682\"\201\210\004\"\"I\212\nRi\r\327\002\225h\252\374\363Mr\234\271(\204\217\2329|\377\341\262\326a*n\225\361\305\0030Kn\254'\301r7\373\337\020\301n\205\177\356\rvf\231%\205f\360\312\230\221\233&\025MD\252\352\312]} \244}\324\207\370\225\033\263\307\013A'\252\2014\222+\220\372\313\001A\005\037\333g\221\300\025\004\300\254\253\032\240#\345T}\026\017\fs)\211\240q48:`\274"
+	.string	"\206|\001\306f\f\371WQ&-\t;\373\364_\335\"\210\345\232\214F\003B7\231\261y\031.\226z\235\236P\245\306\236\354\260HJ\335Ep\254\355\366\242\345eLV'\311\334\370M\023rg\2315\226F\234*\021D~\202\320S:3\325\2301\321\322\254\314<\274\302rRm\214\242\363Q\312\377+\354\21436\350\371M\2164H\200|H4S\242\312\372\006\227K+\230^\036\366Hl\300"
+	.ascii	"\250\265\226M\334\272\256\276\333d5\f,z\222*\273\377t\246\262"
+	.ascii	"Hz\"\340\017Uh\364\265\031\353\302p\252\206I\346v\006fG\355\311"
+	.ascii	"\026"
+	.string	"\364sJJ\372\240\210l\364\217\303\0049\220g'\006%ArF\304\304\275\021\220?\323I\002\336[&\"eP_3\235d+J6Is\025|\202K\375\3461\037\256D\236\3271\273\333\376\350\302\347n\230Lm\223Lz\001\324|g\313;\221[\336\347\203\310\272\\\216\177x81\245iIC\376\210\037N\233\320\320D\357V\226O\263\364\221\262m\353Dt\241k\027\376\023i_\303\335\312\335\225MX]L\272\365\331\016/\361L2\264\034^\306;4CPuI\350\376\303\262\274\337a\354.\006\021`W\322\bB\031\261\343\224\334E\356\0261Y\354\377+\006\273z\375D\233\320\037\310\304\243C\302\b\3219\264\200\002\f\3403\276\373\354\023\201\243\321b\376Lm\232>A1\255\322*\341\317;e\034\210mg<\263~Hg\317_3\321s!\304\3050\354\330<\357Z9\371\002\203\226;\264\315\306tfQ"
+	.string	" 0\201\303\364\342\321\374\241\f\303g%\220\002p\272\366R.\0048r\201\331\234\3263iE+\201<S\275\340\2328\264\364\223\fD\262\306\024\031\322+\360\313\243\334\250\301\273\240d\320\250T\241E\337"
+	.string	"jvl\262c\223\035k\310pR\345S\232/8\217\266E\321\233\331\255J\0323\2244\210k[\254\2437PCq\310\033A\200\217x\303T\034\217\231\323\202\262\243\227D\231x.\013\342\262|\362\371\020\257\365\372\323\344v6\321\377v\241\341\360\233\363[ \355\212C\314\237\307\035\252.\204\360-\003%"
+	.ascii	"=}\003\035S\342\215Z\220\022\2274)Z139\260\334\201/\016\034\177"
+	.ascii	"?L(|\272\374\001\231\251\224"
+	.string	"p\021\366\227\347\301.ch\247\234\334\316\031\025\2719\032Q3:\343\003\375\201\343(+\243\315\234\007\225Uh:k\350\202\337\206^\273<\314\033b'\032\352(\004\315\357\007\253-u\344\263\304Q\340\252\363Z\254ywf\2140v\353\203\247\374QD*\212\021t\222\203_%`\336"
+	.ascii	"\t.$]T\017t\342\003\007\022\306\375Y\3163\276\370\226\337\242"
+	.ascii	"\360\033\306\313\233\247\341\374\200\r-\215\016\332\332#E\024"
+	.ascii	"\214\211O\222\327\353$\232\002d\302\030\370q\375\325[\266E\255"
+	.ascii	":\265\220;-e\315\331\301c\255\266oV\2061p\312d\214^EM\200\375"
+	.ascii	"\021\235\024\362\217\310u>~6\267n\244d\004\351\333\363\311\213"
+	.ascii	"\200\004\205\226\rc\034\215r,\203\251\337\225\252s\261\244\217"
+	.ascii	"\t\205\355*m1\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`v\r\325\037"
+	.string	"\206 iB\360\224\223\016h3\260\234\201\333\007G\304\020U\350\373\260(\344\206\003\215\201\213\372\256\004\320\021X+\254\277jF\305\264\202\224\335q\036\021nHD\3156\343ko\b\365\361Z\331t\227"
+	.string	"\261m\345N)\005S"
+	.string	"S"
+	.string	"Y"
+	.string	"y\003*\013?/\200"
+	.ascii	"\rm\333\266y\005J\255\214<\005\253\353\345\016\213c$\252\326"
+	.ascii	"\212\241R\301(\035m\022\334a{\265K\226\2709\357(\020\334\265"
+	.ascii	"\371\\\236\316\266lZ\356\320;l\035N\317<{\346\335M\035\265\032"
+	.ascii	"5\267\330\272\317>C\366\273\240\240\232\211Vo\317\346\216JJ\351"
+	.ascii	"\255JWJ\372\305>\336\220t\024\212{\370?y\302<SJo*\261gt\354\t"
+	.ascii	"zIO\031\333\316\244\356\306\335\2709\316\354&\276\376\316\033"
+	.ascii	"\357wb\023\361s\023\260\023\307{H\263.\221H\263\036\016\320\254"
+	.ascii	"g\242\251\nh\026\006\231\206\246\177\3122\2400\264\027\260\n"
+	.ascii	".\024\260O0IX\241\205\227\b\210=I\020\354\321\253G\357\266\315"
+	.ascii	"\303\357;=\300dZ\314A\003\032\304,\306\306\233?0X[\246\347\t"
+	.ascii	"\325t\342k\325\302Ty\262d\246\347\312\313r\022\275\002X\252i"
+	.ascii	"N\033\376\311KOO\222\003.1%=\235\355\242\005\213vEM\323\244\242"
+	.ascii	"M\201\222\f\356^\204\310\020\227\nb!9\243\316\321\244\2215n\031"
+	.ascii	"\356\\\356\221\347\2163\020\373\207A+\257^y\2677_\251\026\273"
+	.ascii	"\306\370Dk\242Dq\354\003\3644\211\021M\243\b\032,D\013\302\033"
+	.ascii	"\236f^\030\325\017\315\354\241\0358\264\033\002\201\034\250q"
+	.ascii	"Q\207j\222\202d\332\r\341\004\204@\006\251\224\036\022\240\321"
+	.ascii	"X\f\344\201LA\210\214\"2\"\023\210HAAAR\250t\334\306\217\202"
+	.ascii	"\270\365\034\207\024\235\342\373.q\237\003O\235\260\231q<\003"
+	.ascii	"_\222\332\\\260w\244\263\303\347d\002\r\376F\245\250\201\341"
+	.ascii	"\366\275\317\341M\316?\3327\236\341\275\330A\245\347\320\362"
+	.ascii	"e\223\207\341=\365?\030F\264\037\202b\343\236\003\233\367\236"
+	.ascii	"\005\345\"\035ha\200F \212Nl:\250\303\277 \271\202v\201\220\317"
+	.ascii	"/\005\223Q\224\221\302\253b\212\263uw\224@;Y\310Q*7\245\223\337"
+	.ascii	"\343:Dvz\356/\330\302\303\367\326\361\314\360\3139\205T5_I7\t"
+	.ascii	"\326\001\374\330a<\0259\023\224\232\221\261\376\f\203I\252"
+	.string	"r\276\206\222'\236\352\3134)\251\025]p\270d\353,\177\252\006\300\317$\225\242\370Z\004\261\376Q;\315\327\207\"\266R\301\335~\260\003<\0057\250\212\326R\272\377C1\030\f$\036\205t\317t\214O\204\217\333ux\200\265\323$<\234\177\254\271\272\013&\233\274\246\361\253\327\370\302\217rHzul\244\240E\255\2757|\363\315\317\020|\006\306\340E\206}c\001\007\036\022!\024\251\354\304}\245\340\337\305Q\364\202\321\177Q*\024\f\230Gq\333\261\276\016\017\354\"?@m\310H\301\244\2002\301eP\b\336$\2454x\027t\273-\212\334\233\211\363\313\350O\203\034\364X\227A\2402\344\234+V`\330\033\004\317\337\267\031\315\254#t\231\030O\260(*?dO\254\362\213\312v\374%\t\"-\274\004g\035\244X\327\236\373\267E\322\022nYQ\2545\300\244\277\241\344R\030H\244\324\262\320Nl\240\242f"
+	.ascii	"\310\022I\277t\032\344\204\227C\262.\314\252\207+C]2\362#\215"
+	.ascii	"\230VY\317&3,S\251\234K\333Px\3461&\275\340\037\002\255\255\245"
+	.ascii	"\263s\203D\342Xh\361\324\274\367\220\244\261\023\3038\311](A"
+	.ascii	"\354\362D\343\230\373\303\032,\343\245 Z\317<gC\\\231\251cyO"
+	.ascii	"\225/\227\273\345p\253\"\370&\027HC\003\204]\027\310\207M\020"
+	.ascii	"BO\276\350\273\320I\247\212\272R\247Z\tb\017"
+	.text
+	.section	.gnu.lto_.pureconst.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 \255=\004"
+	.string	"\322\312 &@\257\2411\303\316\3115\n\300u\254\022t\253DC\005\313EDu\322\371\365\333O\377w\336\021\340\017\275+\"\220\035Z\210\203\370\207\346\341\035\316\241m\2704\264\f\307\360\013E,\274B\243\320&\\\302#\034\302\037\334\301\033\234\301\027\\\301\0234\004?p\003/p\002\037p\001\017\320"
+	.string	"\374\344&'\371\310\023y!\017\344}\334\343u<\216k\343\322x\306\303\270.\236\305\2538\305'.\361TI)5\022"
+	.text
+	.section	.gnu.lto_.ipa_modref.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\343\006\215\034"
+	.string	"\226iz@\020\223\222\341P"
+	.string	"\265\200\202P\240\300\003\240\030@\023j\001\005\241"
+	.string	"\352\240\n\032"
+	.string	"\360\377\243\360\377\377\377\366\032\354\301\003\214\217\276\214f\352\343\227)\253\235\326\230}\017\235\330>\334\204\020B\244L\001b"
+	.string	"o"
+	.string	"b"
+	.string	"A\246\354\343\212\343*\036\223\364\341\326\246\233I\317K\007\376c\240"
+	.string	"\246\255\r\230vP.*\177/\004\233;\347p\346\316\271m^Q\235\2430\ng\322\271\332|]\3236y]\0256\271v=)=\322\236\322\351\022\370iRn\322\206L9\202`6l\376jD\207B~\023\224\277\310\325+,\340\255\036\001\325H\244\026\202\237\031\3121t.(\277P\351EX9\322'\204a;\327\301H\372^\265\322\265Gm*}\227\347\272\\\r\250\316u\200\314/\327\311<[\3106\3778\267\321P\326\001\262\355y0\355\016\266="
+	.ascii	"\317e\332\253\2649\245\275O\320\352\275f\357\252\260\213\322"
+	.ascii	"\256I\303.)\323\256\251G\352\234u\243\262\251\262\311\347(\037"
+	.ascii	"\223\025\034E\023\307\034\323a\372\336\3530\345\"\325\215\024"
+	.ascii	"\341\227rfo\005\345.euS\bO=x\200\243\306&#\257FS\016\244\266"
+	.ascii	"\374\324\340/\3512\370A\345\240:W )\235~k4\345L9O\013^\324\367"
+	.ascii	"T\2455t\262\224\263\264\006\267\320W\361\225"
+	.string	"N\225J\213:O\312O:I\312Ij\375Wus5\n\207fZ\224P\207JB3-J,\2154f\3742b\\\030/\336\005J\365e\361+T\244X!\212Ot\307\206e&,\214%\236\223x\00494\004\210\352\330\260\3547\341\207\337CKg:\314A\346o\314\213\313\274\205\345\331\f\027&<7\254\274h\302\250\222\362\243\234t\370QC\203\231\224\3020\235.S\246\\\246S%\374\322\254\331\363\t\024\200\320\250\321D\307\234\251\2214)dc\rP\0021\210\312\254\003\021P\2614\b\245 I\032\003:\005\324\"w\260\212\301(\323\303\202\205\227\277a+\310\353\177\375O\032\002d:\360\276\317\345\310\003\253\twrgp\310\030\020\216\242\017O\003\354\377\201D\343\355y\024\214nF\355\303`\027\210u(xwC\300`V\377\222sW\356($\024I\325/\370\344\330\2038u\304\020[\346\344,\0208"
+	.string	"\232\013B8 U\210\3539\360X\211\303\tIz\342\020\367"
+	.ascii	"\234\270\371\307z\250\024\313\372\343\017\215f\337\022\311h\271"
+	.ascii	"\025\336\367\305n\027u\n\353\312I\032R\205<n{\265\210k\022\261"
+	.ascii	"\321C\256\003\023\025\026\b\351PGe\232\326n\301\263x\257\300"
+	.ascii	"Wb\357\027]J\241%\305\n)\354m\022\243hxTOx\263\350^\343B~\255"
+	.ascii	"^\206\251\346K\242L7is\b7B\346\371\320\330\266\025\250\233\250"
+	.ascii	"\350\210:,`n\270\020\024\377\347\\\200\313\370\274\216\267\002"
+	.ascii	"p9o\354\203\024^\261\250\265\034J\263e\353X\3744?\023b\3155\302"
+	.ascii	",bH\003Z\332\232dO`\030\325\204\311H\375z8(v\342T\336\025\354"
+	.ascii	"\016ixlw>\362*\b[\013\t\261&\237\267\210\374\260n\312\322Q\202"
+	.ascii	"\023]\003\326X`L3\246\265\366\315\235gX\005\001\377\331#\375"
+	.ascii	"\351\301\3223\350Gc\037i;\364\002\r+\325{+O\367\307\233Fc)Yr"
+	.ascii	"\361\360\203\027u\306e\016$yt\007\343\326\274\257\320N\257\214"
+	.ascii	"\3201\211\3415\003"
+	.text
+	.section	.gnu.lto_.lto.d1933b172416639a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidNames.60.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.73.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007b"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\326\301\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\314\006us\250\346\005uq"
+	.string	"\005\001\006'\001\006\370\303"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.75.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 8\235\001"
+	.string	"\204\002+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\024\005\001\006'\001\364\003\001\002?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.string	")\"\300\274\177"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.82.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 \225=\004"
+	.string	"\224\007c"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\356\203\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\364\006us\306\006uq"
+	.string	"\005\001\006'\001\372\002\216\340\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	"*\"\301,:E\2217\200\""
+	.text
+	.section	.gnu.lto_resetPidProfile.83.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\335\b"
+	.string	"\366\321@:0\345(\035\346\224\023\026>\342I=\224\200\032s\211\037p\266N<\006e)\202=4\301\034\032\330\220\007\261\222\210\366\23340\030 x\304\205A\261H\016\311\261f\311&{\247\024-"
+	.string	"/"
+	.string	"/"
+	.string	"\331\347\346\004\331\247?;\3465\265Gi\3218i\355.\225\036\377\036?\377#\017\bM\340\243\246aw\035C\023\307-o\373\300\366\202\355\227\273\226(\373\252?b?\255Z2\f\257\335\215\327\314\256\346\nH\214\267\317\261\375h?\344\"\337U\027\037\330E\245\250\354V\005'l>]_\020,\331\353M<\314%\265[z\350\223\274d\204\375\343\323\026^\366\360\323\367\262\317(m\212\212\370\320\b0"
+	.string	"\326\305*I\320\256`\224\035\366\261\335 \221\026\332:\207\217\306\t\330\323\371h\034%E@h\242\020\235\320\036$\250\247\033\321\216\2017\016\324Q\322\266u\224S\367\330J\224\347i\345ba\310\fk\242\003\334\001\007"
+	.ascii	"2\241\313/\360\301\205S\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.84.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\215\001\305\017"
+	.string	"V\237jE"
+	.string	"\261&\035\304\f$X\227\341A\033\033\307\271\370]\3755\037z\013\332#\375\016\301S8y\332\005\312o\252mKS\306a]Y\2012\"5A\201\002"
+	.string	"\203j\335\204\307\017\211/\337a\306\365\236\020\262\267\224)\005U"
+	.string	"U"
+	.string	"R"
+	.ascii	"\376\330\036\375\335@\366\270\275@\366h\222}\343\037\314\376"
+	.ascii	"\325a\245\225cw9%a=\374n\230\244G\250I\362\265\221\230+\200\341"
+	.ascii	"\360R\245G8`w\005\2448\300\006\311\222:%<\321r}\353\013`3\274"
+	.ascii	"T\313S\033\331]\247\227\002qg\267-\262\375\300>N_"
+	.string	"\375\332Y7|Z5\235\232~\200\003.4\"\274\330\365\020\343\261:1\206\211\263~\373>\213\273T>c\r\361\317o\371\323\3422\244\263l\263\225>l\256\227\307\263\273 \217v\260=&\200*\366\347\361\037\333O\373*\276\202\364\225\206\023\330U\335\300\330\375B\0020\007f\027u\317\177\335\005\b\276\304\243/\214\262{\217\376({T\365]\0302\344=\337\365\253j\364X\035<(-9US\325\327\240R\270\347\306\311\256\251G\2418e\314P\257o=\272\300rVzL\031S\335\335\222\352\213\375\235\362\273\273V\225\275\005\335G&(\335\tH\004\241\244\013}L\"R\322\205\270\024\n\023:\224\023\316B'\241\002G\"\032q\"\b\f\n\231\210\270\024\020H\304}>\323\277\252\362c\276\311\020\241c\322S\324\027k7\272\251\356$\310\241\262\204\034\352W2;\033r\307!4\203C\335>lZ'\0333#"
+	.string	"\344i~\232\327\214\002\036"
+	.string	"3\241\365i\f\246\001\215\332.\222\265\324\230\235\314\214i\314 \036\266N\025\354\210\246\021\230\226\202\021.\207\246e0\013+\210i\300E\f\252"
+	.ascii	"t\025\016\356\365*M\263j%\020\0277D\224\rv\332\333s\300\237\224"
+	.ascii	";\327|\002"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.87.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"=\b"
+	.string	"\026\220;8Po\322\001\240X\214\253\252\230w\345\345/\006D(\213\357n~\023\232\026\207\342\326\204\360\022+\214,1\212l\264\210\310\222\352\211\016#\203B\243\242b:\016\262\311\336)\005)"
+	.string	"-"
+	.string	"*"
+	.string	"\227\346l\230\177\035\373\223\307\205I\314\356\316\310q\356\220\363?rMW\032\035\002(\354\256aW\312\270\343m\033\330N\260\355\005\276\367Ck`\245\305\341e\027c5\263*\211\002\262\261}h?\344\"\334=\247\254\331U9\235\354.\202\017\002.\013.p]Z\347\\\001\321\344\006\026\025)Z\030F\237\344%N\371\037\2560\n\276\273\364\215\272.\245K\212\214\006\t\256\354o\004\343\206}kw\327\321\344U\333<\225~(\206-\200*\335\030(h\210c\254\363\220\211\346&\021\221} f(\363\200&V'f\207\300\232\210\326\271iZ\235\233oom\b"
+	.ascii	"2\241\205/0\340\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidOsdAntiGravityActive.88.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\315\007"
+	.string	"r\21766P\215\322\001`^U\225\004{(K2\206\360\261%\212u|\227\004\255\362\251f\033\262\247\257\231\310\300\003\324|]TU\365T\334\327\356\005Z\3430\214\277\267\224)\005\316`\034.M\344HD\\\023\020\261\342j\240\210\231l\0231\003\3064\017Y\344`X\026/\334\376\255\226\236\026\2004\344\324\353\323\213P\241\217\234\304\235\177\262\205UVY\016S\tL\032\336\\\304]\300\356*\370!O]\370\247Cct\362\333\241\337\261\034^\017L)P\266l\356\223\272a\377\355\356ZK\266\323/\323\231\351C\001\225\024\206nw\324b-\n\\}\330\276m\217}1B\202\307\332\271\216\321=P\242\222\225].*\307\265\247\346\037\344\217ub\262\221>O\200\205\335un\244\214[o`{\025\n"
+	.ascii	"2\241\255\037x\313\304bT\370R%\202\250\032<\027\204\341\232\223"
+	.ascii	"\246\030g\356\r"
+	.text
+	.section	.gnu.lto_pidStabilisationState.89.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\335\b"
+	.string	"v\221@;0\345(\035"
+	.string	">'B\210%(T\256Y\345\302\246\272\323\tJ\023_\032X\372\256\277m\330g\260\004\205\321\3259\330\177\023\tX0\352\230bLE\0355\034\373\213\232l\262eJ\001,"
+	.string	"."
+	.string	"/"
+	.string	"R;\301vi\320~y\350\261?qe\220\310vw\306\216\203W\320\277\3105)\225\351\032\340\260\273\326\224j\343\216\267\235`\273\301vJ\353\270\262\377\372U\325\227o\255,&bfWc\026`Wd\fdc\373j?\344.\360\257\2225\273\034.(\273\341\202\025\004.\021^\260=\247\210\362\243?r\030\206\377\341\013\222>u\351\223\266\313\003\030\213\211\314Ig\376K\233\306G\006\226\n\254\245$\206\322\231\035\2324\262\354k\273\033\240\257\363Ax\240P\250\363>Q\367\360\341F\003\366p>\334h~\024\023\\Hb\212\270N\305\364x\026\223c\340n\004\362\346\327u\336\334\204{m\343\312\262\265"
+	.string	"`\002\b"
+	.ascii	"2\241\263/P\300\20530\352\022\026\261\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.90.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidBuildRuntimeFilters.109.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\374\022\355J"
+	.ascii	"\032x\334\032=@$k\f\013B\300\244\t\020\323\356\205\351\210xb"
+	.ascii	".\260,`e\355\026\270qa 3\267\001\271:\263\376\200\205\b\272C"
+	.ascii	"A\335o\352\256\246=\234\320B\013u\333\357&\245\224;\245\224\002"
+	.ascii	"\237\001q\001\243\001\337:;\353\334,\246\254\260\211&\276\257"
+	.ascii	"\333\245\237w\315*f\257\017\273\t\273\267t\0276\223\271\231\373"
+	.ascii	"\0137\342!\r\367\354M\251G^\341\344\373\276/\334^\273\2654\227"
+	.ascii	"6dg\227\366\"\355\302\032\356\331\233k\330\206G\302\355\025\312"
+	.ascii	"\354#vK\031\024\215\350Mk\313{\242\301\355,=(m\3022\367\005\343"
+	.ascii	"\262\035\236\231|_A\003\275r\003\267W\"w\301\033LDo\332\240\221"
+	.ascii	"\255v\346\266\322\200\322\016\314\321E\357\253D\016\230\367\025"
+	.ascii	"\314\342+\267W\026\354$\266W\267\217\330^Y\312\034\331\202wo"
+	.ascii	"\233Ge\323\262\347}\337\255_\322\322\266\252\242\202NIEA=951"
+	.ascii	"-)%!\035\031\025\021\r\t\005=\235M \267eW\346\273\224\373\254"
+	.ascii	"\255\252\f\013\235\312KC\275t\361))\245\275*\224uqW:\252\315"
+	.ascii	"[ \224\025@\177\322s\302\203\322\264g\204\351\317\217\312/\035"
+	.ascii	"\271\t\241\254\213\253\322J{Iyz\216t4\304\303(\310\022JQ\033"
+	.ascii	"\341B^$e]\234\223&b\322uowlR\023E<\246\252{k\362CxF\\\b\217\316"
+	.ascii	"\203\346\3729g\330T|oE\334I\325TQ\247\013e]\034\221\006b\026"
+	.ascii	"\230\f\223'\311Mo\332|oB\334m\2767\252\267M\270 \315v\233\267"
+	.ascii	"!k\276\n\301\2511\241\357\373:\341\330\234\311\346\335Q\326\305"
+	.ascii	"\031\3663\013\320\241\371!\004\227\306Lb\223\204N\033\266\367"
+	.ascii	"\200\323\341\336Fx\337\227}\n\027\327\f\240\231\035\215\231\307"
+	.ascii	"\230\211\374\004m\206~d\177\315\203\246\032x\307g\022q};\216"
+	.ascii	"\360\353\253\030L\303\374\365\233\315\2225t\234\r\356\373\246"
+	.ascii	"1\340\206c\346\247\203{\343\327\276\305\277\300\377\b\357p\326"
+	.ascii	"\032\321\022\233\231\357\213f\345\377\337k|:\232M\267\341\304"
+	.ascii	"\017\214\310\210l\257\376Ay\024\253T\017S\311\246\b3\353\021"
+	.ascii	"D7\366y\024\321\214M\007\251\007kD\233\211\316\231\312\2250q"
+	.ascii	"u\367\276h=e>\321\212(\334\367}\031p\2231\333\223\002\351\316"
+	.ascii	"I\016*\244\343T\256\365\246t\215\377v\374\305\366\253\030\204"
+	.ascii	"Ls>\314\r\246\303|q;a\260\026\336\323\026l\257\375m\330W}\207"
+	.ascii	"\177T4\277d\026<\363\267c\356\277\274\274\254\362+an\302\346"
+	.ascii	"\f}\330l\241\003\273)Lh\301n\t]\330\034\241\t\233\275zKs\227"
+	.ascii	"\323\231A\353\314\325:/h\235\0254\235\0238\235\021\264\316\007"
+	.ascii	"Z\347\255\246\263V\353\234\325t\306r:\033h\235\013\264\316\004"
+	.ascii	"\232\316\003Z\347+\247\263\200\3269@\353\f\240u\266b\235\253"
+	.ascii	"\\g* gh\353<\305:K9\235\243Zg\250\326\371\251uvj:7\261\316L\256"
+	.ascii	"\363\022\220\263R\353\234\304:#9\235\217Zg\243\326\271\250u&"
+	.ascii	"j:\017\261\316B\256s\020\220\363\223uv\266\316\315\326\031\310"
+	.ascii	"uvY\347\326ufY\347\325uf\266\316\001<\334n\351\327)_\216 a\325"
+	.ascii	"!\025\331\343Xy\244ed\017\227\263~2^\0325p\244Oz\2456\251\333"
+	.ascii	"Z\22108'\"\005\354\032\202\245\344\365INE\372/c\351\343\002\020"
+	.ascii	"\311\304\265~2\252)\342r\243?\n\"\025\002U\363\270\250\020\021"
+	.ascii	"\207\223\316-xd\251\021\177\223\"9\372\236\312\021}Q\022#\257"
+	.ascii	"/\372^\233D\3636\251\035#\022\375\227\311S\245J\227H\231@\030"
+	.ascii	"\341S\245(\221\216S9\327\321Oe\326\234\371\037\250\037\200~D"
+	.ascii	"l\354;Z\362\311{$\215]\255\243\330^\347<y\337H\367}\317\232\216"
+	.ascii	"}\372\266]>y\217\274\004\024\034IsK<\177\245yC\337\366U\376\005"
+	.ascii	"\016\361\031D\343\365B\337d\"\023\331,\205\030\033\237A_\306"
+	.ascii	"H\347\314\360^\337\243!\333\353\273\354\202\336\356\371J\350"
+	.ascii	"t\320\253\330k\313\240_\373\"\241\264\237\254\307\f\377q\350"
+	.ascii	"T\003\347\234UCI\277kk+\323\024\340\335R)\254\205w~\363\237\317"
+	.ascii	",\235\"\375\363\2362\363\245\376\031sW\206=\037\337\367\225V"
+	.ascii	"i<R\300^\003<\277\3558\377\345\340T\251P\007\372\3463K\240\340"
+	.ascii	"=\265\360P\265?\343\256o~\273\017\3648\350,\256MV\270\340 \022"
+	.ascii	"\261W*\235\304\251\034\201\3071[\2006\260\356w\344\034\367\235"
+	.ascii	"ko\332\022\315\017*\356\333qC.\352\261\023\276\377\024-\231\314"
+	.ascii	"\357\372\036el\3273\365%\031\224\223\346|\376\370\335\341i\337"
+	.ascii	"n\302\223\315Yd\263d2\200~K\330\366\307\006\321\260\037\037\\"
+	.ascii	"|\221\211\301`\311fDi\310(\343P\366\005\003\214\206"
+	.string	"\f\2601\013+\2421\216l`p\361E&\306!l\f,\304\212\247\r\027(f\314H\021\243\206\330\013\024ac`d+\210\300^DY\210\215yX\021\215\321\004\013\213\222\301\2401\326\362\227\326\212h\214-2\027-\242/Xl\301\210\246\b\333\372\032\233\261\245\305\304b1\300\306\266\310\304\304\306\266\234\202o3\337W\302h\257\203i\305\365\f\362\230Qz%\003\005\277\200\353\216\333\341\304\347\343\203\005\0174\251\340?H\235j\225\233N\020\231\340W\266:\177\201I\250\016<\2029\321g\245\313\231B\220\365[\007\264~\353\373P\217;j}\023B\302\311\372\017\342\370G\225\304\322\350\bm\263>,\226Y\325\333\230\365\301\372\225-N5\220\313\013\274\0015Q7\373\343\215Q\006\256\236@\201\037\360\004>km\322\354\322\031\007|ka\022x\346\352G\300\371\243N\005x\001je\242\3173W\224\316M\t\260z"
+	.string	"\001\250\036\200\030\253\377 j\036$\"\361\365\221\354Z#\031E\n\204\177A\272\301\350C~PJFU\275\307\241\372\252g+\303@Q\351\360B\252_\247\244\251{\342\"\211\327\317\3063NR?\365P\302A)\240\203,\320\245\237rA\251\377E\305?*`\037\237\275~6\206i\202\372(*\177\3229\256;5\367\213r\372'\250\245\177\222\342\364\277\230\370\367\310\327W\225\314k)?\246'\354;\334\356\364\334\2128qs\322\304\346M\232\276\235rX\275[\272\022\341K\204\036\251\325D=JL\357v\006\033\227\236\351\333C0Io\267\024\201q\250\2018f\221C$\"\222\024\024\024\244\320\032\341\005\204\030\246\230i\007\021\260(\306\244S3\244%I\322\001\003HpB\323\366'+\361\245\266#;\204l!\335\376\023\303\310.-s\222\331\345\242\n"
+	.string	"e\324L\2354`\264Z\303(\375\244v\327\255\271Z?z\37291\346#\370\006\347\031\201/\025\"\257\310#\314Q\337\303X\020\210S\352\266\263\031\240\260\323y\331\327&e\361U\305\f\373DX\3744\321mC\007\35575i\262%\024\261\271\346\271\314\267\267h\312?\033{Y\373\324B\33502\201\315\b\327\272\352\3462! Y\212\351\024-8WW\251"
+	.ascii	"\343*\261\003\0053\007iw\035X\260>L\327\355\267&Lib\320\274l"
+	.ascii	"D\021\036fu^InJ\357l\327`\256\356\032|\355\r\341`1\323Z\244\223"
+	.ascii	"'^2!\231\352\210\217\226\3501\204\243\352T\373W\351r\"uv\252"
+	.ascii	".W\217\375@5f2\213\037\263\004T"
+	.string	"\020\300N\177\035\023B!\b\242\302\013>\037-\031\274\226\245\373\223^\302\235\245F2K^VKq\264\3470\354\003zU\210\345v\b\213\316d\001?w\226\013\310R\262\243 \004p\352\227\364\026\356p}\031&\215Q\344"
+	.string	"\310\001\317\303O\030\250\222\0347h\224A\270\b\301\300#\037d\362\263\204;z\033\304n=\246\020*\367?\023-\353\303`\321\343,\217\317\257&\377\031\300\033\214"
+	.ascii	"\214p\264}\343\315\274\234\026a\324\205\240\350:\210\t\267\344"
+	.ascii	"\217a\204\240q0-MK\3569z\345\335\317\365{\\\004$\236v\237\307"
+	.ascii	"\256\313\013\t\256\323\242D\320\272\315\312\304\272\024\234A"
+	.ascii	"C\\\317\322\353\326\275\365\2213\261\214\341m\036\331*8\b\235"
+	.ascii	"\316W\210:\335l\003\351YL\317;\230\233mP\327\270\305\320\274"
+	.ascii	"\237c[\177R\335\013\216\260\340\371\003\272~\250G\357\020h7\200"
+	.ascii	"\334\312DXu\266\363Q\207\3471\377@M_\220A_`m\225'4D\243\037I"
+	.ascii	"\277\247;H\353oE\212\342D\265oH\035\252h\306\361\251\032#\205"
+	.ascii	"9\036\026\016\034\022+\363C\364\215\003\354\376\346_\374\342"
+	.ascii	"\363\021\334l\301\314\277\375\346\345\335G\267\003\334f6s\233"
+	.ascii	"\204\225yY\020\3343)\200u\302\033\202\315\310\373\233\220\267"
+	.ascii	"#\271\231O\177\360\265Ux5\203\"=\024\200\317<\230\300\024\371"
+	.ascii	"c\265!\216\332\177^94\276P\004\322\026\243O\324\210\034B+\r\036"
+	.ascii	"N\227a\203\n(\320\366d\237\007\276\325"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.110.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`M\001\335\r"
+	.string	"\266\031]D\020\221\223\016;\221P?\227\243\016D\351\236\207W@GTO\241\220\322\366&+r\212\371q\217i\377&\375\350\017k\333G\261$\307\3625"
+	.string	"\212\300\340\272\221\360\213\322D\024\020*\355\374f\215\330\275\311\226)\005E"
+	.string	"G"
+	.string	"I"
+	.ascii	"\001\344\243\036\200|4g\313\370\027b\257b&\305\004\315\356b\020"
+	.ascii	"\004\247\334\243\005\225\3637\037N\347\235\036\257\016\267R\n"
+	.ascii	"e\256\031"
+	.string	"\274\013\226\200\335\375\352\212\301C\251n>\273k\355\274\r\267\274\355\314v\003\373\034\002\376\313\177=\346\227\377~K\325\332\221\236\212\246\206\205\026\273\032\246\216}\021Y\214\260}\3732\266\347\036;FD\202\002\007\270\177\246\177,\nFg\340z\264\252\375\022w\341\376r\342\270\253r\261b\367#\340\001\327\343\307\003\n\255);<\347\254\261LR\302\333\370\347\2347 \\\261}\"/\b\002\323\262\212\221\322\032\313\024\243M\013\016\022\026\364O\034\205\311gq\311D\337=\372&\362\021\001\f\313\007\027\017(:\355\357\244p\305>\234s\316\030\2528Y\310\344\2403\322*( )A\310F8 \320F*-\020e\244\022\r\344a\221\220\021-\204\221\"\220h% l\202\366@\002&\"\032a! \336B\231\b#m\233\b\363|{\250\302\300S\345\240\201\002Q3\"G\025\332\033\005}\347\257\376I\301\223/\030\034"
+	.string	"\255s\340\314\200{f0x9\354\013\023\305\271\027\f"
+	.ascii	"[\204\252\032zW\f\363\"\306\024\264\003\202\375\234l\243\356"
+	.ascii	"\007\2561n\270\016\024\001\343\300`>\t-P\243\205\273\004\006"
+	.ascii	"\f\302\220{\326\341c\245\f"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.111.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`-\001=\r"
+	.string	"\026Z[C\020\2574\035()0@kBQ\260\004U\362;\366\214\320\005\2004yv\337\345O\251\306G<qj\325\215\265F\004E\247\322\351<\246\005"
+	.string	""
+	.string	"@]\356T\252\210D\361\302\022\274\363\366\331to\"eJ\001G"
+	.string	"H"
+	.string	"E"
+	.ascii	"\032\017@\035\346\001P\207\346l\025\377^v\003F\002\n\b\027\273"
+	.ascii	"[\251\005.\271\303I\223\3631>\035\221\327\035"
+	.string	"rZ>\205RK\317\t\336\203\211cw/\363T\361N21>\273\353\024y,7u\333 \333\006\354\207\002\232\351\324\364;\031\030FxO\251\331]\211/\226\006\226\320p\322\355\177~\311\036\337\303?p'y\346\313\262\217\360\002\263\262bw;\016M\200s\3101\335c;\323>\207w\340\036Sb\270[\301\004\211\335o\200\005p\016\0032\377\204\2643\324T'\312\215c\2146\223F]\317\342!.B\3633x\204$/:\364I\264\300\005\n&\031\377\030c\013\325\221K(\250\332\2256\220R\204\322\306\376\272\324\221}\2151\242\260\272\330\217\371\341Iw\332\345\340c\262,l\0339\220\201\266\220\313\3120\210\007\202K\244\332\024$\270B\254\212\301\365\261\240\002\311\264\312c\303\230\b(\2536\f\313*\317\267W\227\247\234\230\2411\321\223\032\250#\277\364\267@\360n\264\343\252*v'Sm\254A^\344\007\026"
+	.string	"2\003\006j\006\027"
+	.ascii	"k\340\0012\005\002)B\224\222\210\f)c\221\250\225\3110\300\271"
+	.ascii	"\314\326\205\004.\b8\251\252]b%E\270K`\300 \f\271g\035>V\312"
+	.text
+	.section	.gnu.lto_pidResetIterm.114.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`7\001\245\r"
+	.string	"v\031ZC"
+	.string	"\2216\0358\247\256/EG\336'\242\240\013\224\210\304\252D\267@z\325@s\252j"
+	.string	"[\204Fr\037_\221s\254\254\226\3723\312\005\353\377\377\377|\357k\034\262\340\236\300\304\260\353D\317\361\223\275\345N)E"
+	.string	"D"
+	.string	"H"
+	.string	"\353\351^@\270\204\273K)\t\353\345w\313\230}J\215\231\257\361h\271L\t\321B\343D\237r\300\356\n\340<\310\005\261\204\033E\331\235\\\377}\246l1\032w\362\250\361\330]G\2153\271\247\333\016\331\376\330\337\002\376D\361\273\273V\025\373\236w_\023\340\304\306}\003wE\314\344X\231\371\302\304\275\333G\341\177\336<\305Ud\367\f\343k\262'\t;\230\032\273\373\3714\202\216O\003\357L\237\362\234\351\363\033g6\215\177,\001[\314\207\021#\030\203\035\377\345.,\013X\274\206M\237\027\312\f\033\264\035\017\330\027\356b\260"
+	.string	"\003\333\034\316\002\003\001\226\335m\260\342$\r~\211Oo\020\211\327>}\221\351\363\337\245\r\024\031a8\022gTwW\244\272\342X\225\341C\032\004\344\240\n\241B\022\"T\023 P\025\252\017\n\024\310\205Q \217\255\220\007\027\025\262\254\213\332|{Ui\371Ibt2#:\232\272b"
+	.string	"%\235TK\361\363k\211m+\370\3657H\245\016\021\307\245t\202_'\345\220\002\035"
+	.ascii	"2\003\006:\306\313\016\224\254\355\213\314Ng\306\212\214U\255"
+	.ascii	"\013\216h\304\bQ\2200\272j\030L\270\005\246)\332\264\007\323"
+	.ascii	"&\230\353\272\324\333\330\320\231\234VM\277\b\021d\306\215\033"
+	.ascii	"eC\236\366\366\034\020(\312\246k>\001"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.117.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\225\n"
+	.string	"F\224JA0\211*\035(C\013p\254\375\261PH[t@\325\376?9J\254\252\257\004\341\233C6\365\004\273\277e\274\301\020\343"
+	.string	"\245\016\323\036?\234)(\302\341\026ci2\264Vj\270\002\272D\223\275\367N)8"
+	.string	"7"
+	.string	"6"
+	.string	"\007*\2108\300\260\273U\016\370\367)\343\347_\365\t\030\212>7"
+	.string	"\227s\002\006!\366\020\226\246\305T"
+	.string	"\274\352q$$\305\330`\261\273\216`Xr\323\333\276\260]\355W\002\251_\306\350k\225\004\026\302\223\270vM\263\f\373\242\021\fPl?\332W\360\005\337S~\340\311\256\004Wkw),\261\235F\334\242\235\316Ch\247\376\354\013_\241\366\022-i\220v\251\301\242P\2122\333\037g\201\266\335\255\360\031\274\001\210O\340\324!\241x\360\324\017i\247\227\030\001b\bR\2438\263W\242(\005\330\237\273\273\226'\373\001\232\216\347q\335\306\333\234\301lp>\325\333tp:\034\325\203\223\341\251\231\016T1\027s\037MW=\216\353*e\265\237+O\336&\270^#I\232\016QJ\333\303\305\203\236Rt\224\f\026\016"
+	.ascii	"3\241%h\f\255\301\336\260\227P\255\202@(Bt\035\002\034\230r\t"
+	.ascii	"\266YM\021w9f\22340\265\007"
+	.text
+	.section	.gnu.lto_pidBuildRuntime.118.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\231$m\203"
+	.ascii	"j\322d-G\020P\355f8\302\267\343p\005\373\037D\233L\341\232["
+	.string	"\306\035\243B\272\302,>\322\307I\t2\350\374\360[\341\t\321\300\240\313\255\27609p\t\232\f\340;\274@\303\005\345E\017\233\221\250\262\247y\007\331{\357$\245\f\236\002\260\002\341\002\213B\257\327\211\332\333\004\355e\242\366.Q{\225\244\275I\320\336\023\320^\023\320\336\022\324^$j/\tj\357\bi\257\bi\357\021\2647\004\243^#ho\021\265\027\004\265\367\203\264\327\003\264\267\003\265\227\203^/\021\265w\203^\257\006j\357\220^o\006j\257\220^/\006j\357\005\275^\013\324\336\n\320^\n\322\336\250\264w\002\264W\202\2647\202\264\027\202^o\220\264\027H\332\373@\257\327\201^\357\017\265\267\001\265\227\001\265w\201\264W\001\264\327\207\332\333C\355\345\221\366&\220\366\"\320\353=@\3555@\355\335\241\366B\245\275:\322\336\034\275^\034j\357\223\332[@\332K\200\332;\200\332{#\355\025 \355\r"
+	.string	"\355\265\201\366\326P{\001@{i\250\2753\324^\031io\f\264\027\206\332\353\244\3666\245\275Lh\357\222\332\253\244\366\276@{]\250\275-\324\336\244\264\227E\257w\205\332\253B\355EJ{S\240\275>\265\027\205\332{\"\355=B{M\250\275Fjo/\355U\321\336T\355E\325\3363\355=\332\313\214\004\nA\206\266\270Km]\265\232K\254p\350\2361^c\356\201\371\016s\222\317]\336\345<\313l\007\360"
+	.string	"\362\332\217\327\341\232e\216\331\242\272uE#\202g\217\0305\313\343\341N\226&\342\215\2333 =\326a\331\316\036q\032\357"
+	.ascii	"\344\344\266\361\312\265\362\026<7]u\353\272>1\272\f\364\030"
+	.ascii	"\235q\376hw\033M\213\022\322j\225\326\005\305\275\313s\230\016"
+	.ascii	"\220\221S\254b]g\350\243g]\321r\354\215\036\243\213\306-RF{\314"
+	.ascii	"\"et\027\270K\247t\265\006\023h\323\304J\342\255\353\n\36541"
+	.ascii	"\366|\242\361\3128\220a\304hbZRz\341\324\"\211\305\n\025H)|("
+	.ascii	"N\034\2310\352\2512\320\364\r\\>\321\034\233\304\255 \3038\221"
+	.ascii	"\350\234;\360\214u\f$71\301\345\260\345\320\031.9\274\024\347"
+	.ascii	"\330Jq\330\340\364\013$;\315\341\026sn\350$\026j\2203\\kx\205"
+	.ascii	"\r\347\214\262/5\264\n\036q\332 \251Az\210\314\306\016\235\341"
+	.ascii	"R\303)\304\370\314\0273i\213\032\332lX\032g\276\250\271O\315"
+	.ascii	"W\243(\303'\312\220\351#/6\341el#\032g\270\212\334+\342K\221"
+	.ascii	"F\331\227\256VO$\254s\207\235\253\226\241\006\241\201\353\214"
+	.ascii	"\321>\343t\f\337\267%<g\254\353\312u\270\263\266\206\335j\220"
+	.ascii	"u]\267\211[\\\2743x\267\027\330\335\017vkl6\036@\233>c\303\017"
+	.ascii	"\263\206\233\006\003\232\371N\271\034\372\253\306YO\321\317\021"
+	.ascii	"\200c\2239\223D;\032\007\340g\333\260\256\215?N\316\025\217\374"
+	.ascii	"\020\353\3421G\343\351\230\242\033s\206\234\036\323&\3433b\\"
+	.ascii	"\306\3255\030\2171\244\301\374|p\035\311\261u\003\306\331O\321"
+	.ascii	"\355\350D\247\265V\331\363=\231'\220\0330EMwbz\323\323\274\245"
+	.ascii	"3u\227_\0171\035\235u\004G\023\005X:\013Q\f\302H\351[\260\206"
+	.ascii	"\fv\276\270\322Q\271a\231PH\013W\211\243\327\256\352`\363\266"
+	.ascii	"\245\214\2768\223\025\333\216\310\336\303\200`\027\3003^\344"
+	.ascii	"\342B\024\225L\365a\313v8G\r(\333}\317\224\305\316f\236\225\243"
+	.ascii	"\331\244\021\262jE\314\374f\263\231'\003\007\263\231\263\335"
+	.ascii	"\231\322\212j\303\257\026\337\205\200\227PB\321\0272i\300\346"
+	.ascii	"\222\336\202\305\223V\234\205\004\234(\212\225bI\034\341<bws"
+	.ascii	"+\236\316)\262\035U|\267\002F\302\356\0201\2100CHW\221\342H\276"
+	.ascii	"\247\270\200\351\226\206|L\024\337\025\302\204\006\315)2\203"
+	.ascii	"\266\304\211\2438\372\t\023?\032\302rF\304\231X;\"\215\276\273"
+	.ascii	"\001\023\261\312\033p\034\330\020[\327\325\003\006\004\002\243"
+	.ascii	"h\033\321N\311\302.38 \315&^\357F\347a\231\372\336\323\273a]"
+	.ascii	"z\365\214\265h\327\b\373\3711\333\334\356\024\032\3679\302js"
+	.ascii	"\353j\245\300\b\314\007\t\243\234L\237\306)\346y7\233\315E\350"
+	.ascii	"\303\266\373\211\331\016\263\326\320\r\f\177b\026{\326r\212~"
+	.ascii	"\327\004\026b\225\275u]{,\273M\321\220$Il*e\024M\022\355\316"
+	.ascii	"\257\222\357\254\317j]\253j\240\347!\037a7\367?\237\256\r\353"
+	.ascii	"\370\277\f4]\211\260\026Uu\023m]\327?l\177)_I\332 \253V\264\273"
+	.ascii	"K\370\207_o]\255z,\357\231:\323\244\267FK\312(\277H1\311DVus"
+	.ascii	"O\364\305x\373\244O\314k\276+\265B3q\007\b\004\006n\370\340."
+	.ascii	"Z\260\037\326l6\233\373\031v\355\226\274\306\313\204\370\016"
+	.ascii	"/\313a4ff\303Hf^#\306=\3602\030'y\331\314W\0312^\306bW\fc\304"
+	.ascii	"\204\001\303\265\365E\013\006/]\262\210\\\266`\r\325^\276J{\331"
+	.ascii	"JXe\324\313\301U\355\005\252\275Ti\357\024\332\373\002\332\253"
+	.ascii	"\305\250\327\005\2647K\257\027\013\367\300\373C{[\350\365^Q{"
+	.ascii	"\255\240\275U\324^*h/\013j\357\024\264W\212\332\033\005\355\205"
+	.ascii	"\242\366>Q{W@{U@{\245\324\336\024\324\016\217\362\316K\273\030"
+	.ascii	"\2243\231\221\355\370$y\032\356\024\255\360'WZ\252\360\025~&"
+	.ascii	"\325\216F\205\363\036c\236\243\024\017\227\001h\206\347f~Rg\244"
+	.ascii	"Q\215\211La\355eVy\322\241\360\024\316t7,sr\024\216\256)o\214"
+	.ascii	"rrFdT;\"\233\370\360.\037\2237\371)7\254\373\341c\230\234\365"
+	.ascii	"\030\3550\221K\332\036\306\247$iI\222+Ir%B1%\326\242\023\334"
+	.ascii	"\276\0054\243\032\342Z\277\023\232L\023\372\334\313\222h\367"
+	.ascii	"\366\254\237\t\347\262b\363\210,\001\320\271\254\021\355\210"
+	.ascii	"8\326\257\204EL\024H\342~\225\364\225I8\222\237y\303/\241\220"
+	.ascii	"\213\027\034\241\021N\202\b\037\341MK,]G.\302\227\332\206_\302"
+	.ascii	"#g\2123\243<\0014KC\370\203\3128\252\270n\216)&\302\303\013A"
+	.ascii	"\256\363\200f\276\013j%B8\277)\":\032\031\324L(g\030i\221\033"
+	.ascii	"9c\001!,\324I\374\212\234\311\212G\200\260lDr\037\034\004\017"
+	.ascii	"\376A\007\367\340\210>\364\353\200\216\203C}\004\221s\360\257"
+	.ascii	"!\321K\"gcq\311\334\340\256\013i\360\r~\271a\035U\242\036\244"
+	.ascii	"\301\3628\204\331\2022\370\220\237K*%Z.\203\363\236\242!!\337"
+	.ascii	"\245\312\3538\f.\204\252\331D``\350xA\260\001Y\360\013~\256\t"
+	.ascii	"\373-\312\202s\234\242 f\005W\335g\225>\n^\301\317\344\260\016"
+	.ascii	"\253\207\370Qp\206S\024t\214\342\322n\300,\237\034\321n\202G"
+	.ascii	"})O\202O\340\245\201\370Ip\256+\006bF\240\325{:\017C\360\b\256"
+	.ascii	"\256\0059\004[\255'H  `\232\r(&\217hW5\367\300\201\\M:\360\007"
+	.ascii	"\316X\213bh<\016\234q(\3121\221?\212\315\003\320\253L\253E\375"
+	.ascii	"8\327a\024Y\224;\0365\360d\322\035\321\216\201\006\216.\207|"
+	.ascii	"\204r\316\300\233\320\220Q\033\222\t\0278\313y/\025\370\002_"
+	.ascii	"\222\033\326\371\270\002g\036X\2044\257\246\2118\376\245>\256"
+	.ascii	"$\355\315\252\025\231\351\263\237\217\027)\002:\""
+	.ascii	"w\2012\364\234U\372\302\024\377\340\341\365x\234U:\035}g\033"
+	.ascii	"\217\357x\217\004\316\343KI\004\236\300\225\332\206e\007\034"
+	.ascii	"\2013\232\316!\352\200\363\234\342\237#\022G\233\255\322\351"
+	.ascii	"\315\233\001\357\262U\376\230\333\005\206u\033`\032\035JrD\273"
+	.ascii	"\035\207\272\001\333lzl\225\313k\026\250f\331\232\211\313\226"
+	.ascii	"2\272\343F]:\016u\247\274N\3039\256\343Nk\3032\034\317aC\257"
+	.ascii	"\211\302\361TO\361\355\351\206\256a\225\276s\rM!\035\320\020"
+	.ascii	"\025\360'\002^\300\227\336\326\b\002\356B\350\3456$\033`\254"
+	.ascii	"iX\345[ 7E\264\276\361\001\004\370\215/-\207u\001\234\307\004"
+	.ascii	"8\3326$\013Q\244\20609\255D\221\222Bd\312\025&Q\244\214@\241"
+	.ascii	"\322\304\212\024R\025),I\316&O\244\234H\241B\204\211\324\024"
+	.ascii	"\023M\240HY\211r\205\212\272Kt0\221\232\002e%\005\024\244\236"
+	.ascii	"8\201\212\"\225\004\n\324\022*U\240t(\255\224)M\250@Y\221\"\205"
+	.ascii	"\n\324\021\332\312\274~\206\036\335\031\\\325\205\313\\\232\331"
+	.ascii	"\234\327\0341u\210\216\016\334\325\203\313_H\234a\320\2652\347"
+	.ascii	"/2\3472gJ\222\271;\267\274\316|\274\326\214\211N\255\007\001"
+	.ascii	"H\016L\217U\361l<\214\256\342\331e\212\311]g@\203\272\306<\006"
+	.ascii	"1\3471Wz\013s\026\243\304I|\212\364\002\363\335\251\274sK\232"
+	.ascii	"\"\n\255\177\270\316`\266\316\\W\363\276\234\267\246\232\347"
+	.ascii	"\325\027\364\313\313\016\f<\374D\250\211\227\337\323\351w\006"
+	.ascii	"\003;c\200\235\227g<l$m\354\210\256jz\330Yu\006\311\274\222p"
+	.ascii	"\360\032l]\253\230\036\246\365\346*mP\005\277\b\006\255\243y"
+	.ascii	"C>0t9{9w\371\21388jp\353\272.=l\263\316E\244\375\261jE_\342\367"
+	.ascii	"CL\211#<\256\b\211\216\271\254\377P\303\254\304\204\376:n\315"
+	.ascii	"\235B\036\357\007\265K%|\"\252+"
+	.string	"\034b\204\316l|\37616\217{\276\256k\360E\322\0233\036f\255!\240?-\236\370\347D\304\372]\022\023W\346\302[\376\"nL9$\023bq\371\241U&\245W\214\365\246\2701\265!\037a\013e\r\036\376A\2673\036f}\311W\347\341\325\225\344\206uV^NH\230\250J\353s@3\252\255\007\252:\3071\336\035\221UA07\002J\"\016\236\275\210\365\214\203\021\021\023(\346pKP\0358u\252\243m/|*\206\277\275@\227\364\260 \367\001\232%\2751.\361\020\261\320R\374\020@\263$\257\273i9\3731\032b\256\200\222\272\300B7S\231\221\201\nM3\321\205\363\235Bm\340\254\036\334,a\337\0034;\323\\\317/\313\031\216Q\020\0265g\003z\331\360<QX\316]F\271+7\274\007\240\227\257\016k \\\343F\264\233\303\033\204U\264\232\037<4\346;\204\016!=l\227j\354;"
+	.ascii	"\315\\\030\335\340 B\262\n|\340\202\235\267)^g\257\303\322\365"
+	.ascii	"\230a\244\214\302![\301\316\266"
+	.string	"\361\226\256\307\f\266\232\335@v:\273K\307\364&\304\272\006\371\253\211+\001\b\200Y\365\2426\227\363k\341-\030\2038\"}Q\351\225+qs8QW^\304\330f\305\3548t^\225[\371\327r\370\233*\3477F%\223\312\361e\177c\341T\376\245\234\223\261p\236cT\036\247\3209\233;)\237\362'\317\276F\312\271\314\310\306\214R\347\276%\224\202\327\250\002\031%\324\202\322\261\021\021I\222$\303f\022\f\020\206\341P\326Iy\007\022\24045\307\222N\021eF$\240\222&\2514\007\303B\324\233\002C\343\201<'\325;@F\022*\237\016\375\0139\005t&\212\247\241\326\027g\033\252m\306\027\265\324\336\310=ui\370Q\321\236\234W\213\255{K2\033R2\177\023r`\214Ql`\342\242+\306\255\251\360\205\217\335h\\\207\251P\255\005(\002\233;\r\177\314QCM\326Y\203\032\022\360\337\343G\302"
+	.string	"E\003j\001\266\030R=\247h`\017\001\250\017\245\232g\226\253\254GD\031\364\357\354\317?\361\005]R\260\352GK\207\021\274\021\237\016\316:\336G\001\225\323I\341j\251e\355\356t\222\303\200\322\240\302%"
+	.string	"jt\005\301\225\005[\261N\343Ws\3606\032\273<\251\232g\020\273\352`\002\244\023\373\374\216\244\013\230\017!#\2743\270\"\243\310W\376%\272\210\020\251\022\257\262\252\2072\035u]\256\356nKB\231\305\343v\273>\215\003@\036w\266"
+	.string	""
+	.string	"\234\363\n_r\372_\2162_\017\265\220&#\025\214\322\360\221\342\033\245\242\265A\016\226\026h>c\321\370\223r\300\024We\267\245\260\347[\"\304\206~\376\342\373Q7\024#\251\233g{bKw\023\334\"\302\r \330\234U\202Q}\235&W\223+3\016\327\261\360\233]9&+\207\260\343\231\005!\345&\036mJ\336M\037\321>\355\363<\360#ms-/M\315\342\3004\356eT\021\220\231\226\334@$\365\215\220\373\023\n\"\345\f\025\365C\\:\326I\007j\177r\215Q\313\177\025\237\276\211\252\352\221\345\004\020L\177\351\356\265E\n\365\256\031\307\2133\221-\343A\004\221S"
+	.string	"\274"
+	.string	"\321w\317y(~t\363%\257\241\370yt1q\263\300fu\307\331\245\341x\251z\217\221\005\234\001\335\246e#E\030P\322{\234"
+	.string	"\032\f\001\225\3431\262\337\360\25727%M\346\327\220\360M\342)\352%)4\212\256F\204\032\342\2017+z\310\254\037L\021\026\021\315|\027\013|Uc\004\232\320\214"
+	.string	"\360\325\022U\t\265\272{];"
+	.ascii	"~\027\233&\203?\321.\033\025c\245Dx,5\217U\316f\270\325\342="
+	.ascii	"\377\3741\3118j;b\347evv\361d\223]\310\373=b\273g\334\352\033"
+	.ascii	"\364\267\004x\036\227\260\302f\210\340\373\350\272Z\317\240\007"
+	.ascii	",\267}`\373\366\333\361\021\210B\310#:\334\"A\254\262\273\366"
+	.ascii	"\026\305<X3\300\377zu\264\245\317\246r\"h#\370\034\2637\241)"
+	.ascii	"v\267\311\320\363zF\375\227H7"
+	.string	"\237A\035k\334\324\236:\351\035\272\330B0\355\376\354\324\2518\315\274jxIfi(-\263\305[\230\264\224\316Df\221\245 \232\022\345F\216\204\215\346B\363\341\034\245=M\211\3146T\256S\254\302\350\020\204T+m\211\274\006>t\302\003\261\233\257\004[Ej\342P\233\204`\234+>\256\222Y\020\301\367\204\035/\023T\"\200\365C\276\375\267Rj4\024-\210\362\031\242\022\212\317U\310\032\263F\224\320\270\007\271\337\260vB\333\n\013\242m\234g\231\263\211-\t\330\250\204i\310mb\272|\344{\003\204\346\026'>y\344l\307\366\355\177\256\231\"\360\276\222\307\350\350\201\002!\347\236\273\020~\036Y\013k\262\314\203\035l\336\307*\234Gfm\331\247X\325\266\265\316\252tk\n7\257W \323\373g\357}\366\371D\352?\324\001\311\232\256<\327\2325\264<\241\315j\025\224\241A\2111\252fn\3039\210"
+	.ascii	"\2210[A\227J\004z\241)\276\220\221\2720\3241\353A\203\026\257"
+	.ascii	"\031\"/Vj\2645\262\024o\214R\312\261Qm\317\352\233\025\300D\224"
+	.ascii	"\016\313\253\270\0034\322\341\216\341\250\235\223td`\251\360"
+	.ascii	"\322V\315\242\245.\"\326n\276\037\352Q:\bF5\021r\345\272^\034"
+	.ascii	"\237\3375!\276\233\004'\026-`.Fy\375\240\t\361\335$8\261h\201"
+	.ascii	"\304HLh\005\213D\320"
+	.string	"S\3507\266\025\236\2547\177\0038\022\r_\303\233\226\313{=\027\323z\264\277\005\025\275\277\321\354\262\244#\007\316\0241\214\267\340\237}\034\002e8\377\006d\202'4-\362\017%\212e>\nK\376?\002(e\013\3207\316\221\235u\264\177s\321\206\335\024\221\251~\342\006:\337\314~\353\235\245\366\212\337\314\302dtn\222\350om\371{1\\yTj\365)=]k O\340\013d\261\300\227\237\024\321\232\021\037\226\003\323\032(\2271"
+	.ascii	"\373\037\330i\301\232\372\207\352\357\327~\353\001\311\254\273"
+	.ascii	"\340\213\270;\352Ew\200\023\311\275\250)d\266\013\257\333\273"
+	.ascii	"r\034>\275\250}\tXM\215\f\337\003y%\006\246\022\231\205\313]"
+	.ascii	"\2253\3718P\313\214\021\253\026'\240\342/\333\376fm"
+	.text
+	.section	.gnu.lto_pidInitFixedFilters.119.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`a\003\025\025"
+	.string	"\206&\204H\300RN:Pq\360:\265\272\261g\202\354\362\244\330\270\026\215Xy\240\272\300~\t\370\232\260\nt\301\215\365\326V\357\372\377B7\321\177\034\214\002\261R\355\n\222,\030\304J~\022)j\240\376\336\206\273V\304\222\275\245L)m"
+	.string	"c"
+	.string	"q"
+	.ascii	"g\361\026\265#\371\306'\317\274\207\036EFVsN\224K\237\200\227"
+	.ascii	"&\027\360]\306\007\370.\357r\315\246\202\341\246MA\021\211\016"
+	.ascii	"J=\346\234\261\035\341}\334\335Qk\227q\265\346\263Tt\217AGUa"
+	.ascii	"\316v\031\001\3149Er\270\230@wr8\032Q\364|\277\273\f\322\361"
+	.ascii	"\302\\\317\225\2452\347\264\2069\236\373\273m\033\333(\366\252"
+	.ascii	"\b\3222\263\331w\251\373\020\304M\257\354\273x\222\006\237\310"
+	.ascii	"57\372\360\322\277\371.\277\337=\246\370y2\362\271\351\325\356"
+	.ascii	"\234\323\266;d\357l\372\271B6\354H\367k\325\256U\267V\r\262j"
+	.ascii	"p\325\254U\177Q-W\035W\275\252\326\253O\022\302\203(\367\025"
+	.ascii	"Ms~\270\3721{\222\351\304\221n\377\310\337\331\025\253&\222\246"
+	.ascii	"r\324\307c\334!\333\007\376Z\330\016H\322\361tD\340\350\225I"
+	.ascii	"4"
+	.string	"\256\\\373\001\004\234\rZ\215\225\0024\316\024A\002\013\313w)GtA{\002\005}\030\327\004'\3433\314k\361\222>\364\322w\271[\362\344\344#\242_\363\016d\221\2349o\004t\355\227\030}h\023\235\265\331\217\301\341\365\3206\314a\310N\244\346\234\013\224\376\342\202O\3645\262\r-\321.)\025d31\033\01312\f0\261\f\262\026\231\230\013MM,\005\346\331\314\013M\314f6\243\211\271v\363+d\260\352\247w[\034\223\250\213j\007\203\226\025\350\222jmIT\b\220(\035\rh\372\020\004j\201\364\300-\201r\362\271\261\366G\317A\003\347\274=\364q\374i\305\001\215\366]\216\350\327\373XM\337^w\003?PF\227;\344\220\022\013\333\235R\224\277v\007\301_\001G\250AX\205\2302\"\023\020%\321\026\024\246\003\360\002\031\032\352\001\021p-sDnJ4\314\001s\200O\262\211\221\223\271\177"
+	.string	"x=\223?+\346ZG\312\324\b\375\260#.\262-\223\273\270d\264\246}\371D\365\021\223_F%\330\366L\013\211\"\302\027\315 \324\177Z\304\317\260l\006\036\033\\\035\275\211\007W\b\231\232\214"
+	.string	"\356P?\n\267[4c(h\371p2"
+	.string	"9<"
+	.ascii	"\257\n\317\364\350\263~1\0022`\317o\324\305 `\202\351\363i"
+	.text
+	.section	.gnu.lto_pidLoadDtermLowpass.122.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`8\002e\023"
+	.string	"f\244\201I\320\360(\035\332\301|h\273\262\320\260\243tI0\\\301\226\305!\205"
+	.string	"\"\313\246\246\017\372kB\036\234\\J\353\327\003\270\363i}\325\360\243\013_\213\324\364\2023\240,\264\200mB6)\376`\214I\020?\032!{\223\275S\nh"
+	.string	"e"
+	.string	"r"
+	.ascii	"3\027\260\333\323\002iw<\340\021\360\324\343C\352)x\220z\352"
+	.ascii	"\231\375B\244fi\b@\340\270\301\321\330\335\324\354\360\331\277"
+	.ascii	"J\275)g\376w\202\373)\024i\377:D\235W\235\323\017\321\306#\260"
+	.ascii	"\273\317\325H\017\324\371\364\f\354\202v>D\233\007r\323\355\216"
+	.ascii	"\273\304\021i\244\374Nv\3272\0241\334\340m\313l3\260\245,r\372"
+	.ascii	"\330\367vw={\354\017\375\247\023\375\340\215\376\357\343_Ai\372"
+	.ascii	"I{Tzz|\360T\020?b\306\356\205\246\033\273\202*y\260}\377\350"
+	.ascii	"9\230\223p\211\006\\\210\335E\235\33206\352\364(\333T\332%\t"
+	.ascii	"f7\212\3718`\303\222\320\222\202I$\223\302D\216\024D\002\254"
+	.ascii	"\255h\207\344\322\276\320E\314>\024\227\031,\310\340\020\203"
+	.ascii	"\205\213+\2756)\005\334]\244\026\204\002?3\365\224\316\20797"
+	.ascii	"\361\002\200i\327\366\320\216\360\022*p\327f\242s\251,`\002\222"
+	.ascii	"\251\247\336\254<9\024a\216\334\005\335\222<\0179'8O\323fa\311"
+	.ascii	"\207>\356'6\223\346o\316iy\223\243&\233~\323\355>\314\351\343"
+	.ascii	"\026\227\221\237\335\332\303:'MESQ\013\233\264a\2174\001+\231"
+	.ascii	"J\206\002[\255ZN.\257\330\212\347j \323\202\301T_l%k\261V\252"
+	.ascii	"UH$\260`)\331\004\026Vk%\345b\251\\R*1\230\024\211\210_\260U"
+	.ascii	",%{\275b)\324X\273\267\263\007<\022\307\0320j\223\346\233>K."
+	.ascii	"\224\227z\242\225\342\003\371\257z\332\3013t\204\263S\223M\325"
+	.ascii	"!\322\233t\3729\007\017\344C\323I\013\272\351\230\350c\3527\237"
+	.ascii	"\013, \240\202\2319\352\001\242\320\036\f\304\0212\030\316\021"
+	.ascii	"wp\321FL\360D\201\213\367\226\330\206\215'i\002J\317iES\270\032"
+	.ascii	"C\235\356\034\013\231R\322\330\016\226Bp\026G\324\265\030&\360"
+	.ascii	"bN\034\036\255\203\343},\2666\233\304\303\262KtD@F\031\037yn"
+	.ascii	"\361Y{E\250[\335\277\006\r\354@\001"
+	.text
+	.section	.gnu.lto_pidLoadRuntime.123.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\243\020\215A"
+	.string	"jf\324\026@@\242N\007\323\356\353\357\030\237\363\227\335-d\315L\032N\222\235v\321N\254R\332s\034\211\032a\276y\364\024\300\t\020(\376\\\035"
+	.string	"\001\016\0201\251\021MgfUuQ\023\021!{o\231R\nY\001B\001^\001>\246\033\234\245\221\363\273\366\276\366=\027\363:_\243\361,\226\235\210cU\nc\316Y\312\333\306\220\364\026\312\221\\oY7rut\3539Y\307\034\317\363x\370]\217\270:R\347\274\355\346\321\315\364\266ev\327\371X\362>b\346\006#\374w7x\360\372\034\220\3069S\375\004s\276S\320\b\222\336\366\333mgIH\216:\250\216I\3018\346\234\247p[cg\357\274\235\376u\002\003\242\240\004\004xr\002\320\304\264\244\224\204tdTD4\364\024r6\231Ke\022\351\266,\376\267\035Y\201]\373\333\233\206E\235\300\2001\036\325\247\307\367P\002\304x"
+	.ascii	"\026\312\216\205\312\253\373'v\210\216e\320\027\345\235\240\210"
+	.ascii	"\3159\200&/\316\324E\260\372KJr\236T\005\220\312#!+\034Mq#8\026"
+	.ascii	"\312\317\243\260\200I\371\"d\205>/Q\225\202\307\211\330\234\023"
+	.ascii	"\275\371\220\0340\267\267\177\272\245\275\020\325\235h\324o\242"
+	.ascii	"\235=\323\314\227.\007\254\314\354\225X\300\312\242\344\200\221"
+	.ascii	"}2\312\211\330\230#\245\216\005l\354]\351\220o\2258\313B\017"
+	.ascii	"\343\312\204\302\270X#2\277Cf\230\220\307\3140.\026*\347\354"
+	.ascii	"v\376^a[\377\310\n9\347\376i\230\230w\001\357\376!\335\315\241"
+	.ascii	"[\210/\201.\324\225Tx\265\251%\221.n\361\333\211S\350bw3\302"
+	.ascii	"\341P\271\225\221z\366\246\312\255\211\32437-v\222\2612R\351"
+	.ascii	"\\\314\326\317J\371[\253f\322@\f\365$\334E\306\2370\225W[\264"
+	.ascii	"\321\320m1\033\273x\030W\306\342'\315b<\207\353\377\260!\221"
+	.ascii	"\3149Ch\037\3645U&N\274OO`O\363V\327(<\r\225\363\212u\221\013"
+	.ascii	"Bw\377p4UN2\326D\tf\374\f\213v8o\273\205\213\367\251\225\353"
+	.ascii	"-\306\017\346\324i\375\243\367]\316\031c\266\366\341>\341?\374"
+	.ascii	"\242\310\365\177\372\t?\336q\366\367\005q\257\314\t;v6g\177["
+	.ascii	"\210{\203\264\376\261\373n\3531[\267{\306O\272\233\337\t\232"
+	.ascii	"\337\b\232\337\007\232\337\006\234\257\316\375\311\347\334\235"
+	.ascii	"\376\273\351\277\231\376{\351\277\225\376;\311\371\274\221\232"
+	.ascii	"\337G\314o#\367\273h\371M\304\374\036r\277\237\313o!\345\267"
+	.ascii	"3\371\335D~3\335\357\245\373\255t\277\223\3567\322\375v\335\357"
+	.ascii	"\326\375f\335o\214\277\377\277]\202\323\342\226\241^\225\f#\336"
+	.ascii	"\345\257\307@\271\260-S\305\371\334\273]\360\315`\316\031pL;"
+	.ascii	"\271\t\343~:\002\330h\315\311;EA\242\332\332\033g\024\342\323"
+	.ascii	"\250\236jW9*Z\021\246\360f\306\366ejW9\2621\"\214\373\032\247"
+	.ascii	"K\240\257\204\205\360\023\017\341\356\367\355\225\002%}%W\237"
+	.ascii	"\344\235\242\300M\354\221\274U\336+o\334\373\364\215s\275\035"
+	.ascii	"\302\3767]\362`T\317\260k\226/\257'\2360\247\356\215\314x\265"
+	.ascii	"|\327\313\305\225\242\327,?\375\"Bw\032i\303K\177\310s\275\020"
+	.ascii	",\327\333\327z\355\230\321\253\225\376\374\321\032\256\267\313"
+	.ascii	"\265\272\275\2562\255\177<\"\360M\354\304\355~\257\227\227\356"
+	.ascii	"}\332-\216\266\033a6)O\302\356\347?v\204\217Z\243\241\013\252"
+	.ascii	"\221\273\204\007z\355\240n\177\034\220\205\013\0312\270\336:"
+	.ascii	"\261O\227\270#V31g.\237vo\360>\035\236\321\253\025o\371\354i"
+	.ascii	"b\357s\rk}\210\323%Z\377\210q\3169Z4$\345\377\204"
+	.string	"z\023\356j\242\302\234\363\220\003q\231\212\037<\017\020<L\354\214sm\362tJ\371;V\251\322\300&\324\231PxE\211\n9\227X\211\377\317\035;K\354\204 |\221\212\216\242\022?\243V\307\346R\312\237\261\212&\rTB}i\205W\033\036s\231\304H\374y\022\021\223\330\337\204\360+\225\325\020\211\235q\254z\224H)\377\305\352\23148\256z\264`qdY\345\240q\245!\207\025\016\253\254f\017\253\0276:X\321\270\202\201\225%\342\305\325\215g\273X\360\342\352\306T\016\0311\256h\300\230\262q\325\242\306\224\213,\034S\013\226\032\353\206U\326T\016,\254\254)\346\235\226{n\274R\250\205\267\372\b\367\337y\306\016\004\324\200\r\030D\320\327\351\300_\254:\302A\316\020\253u\375s^\021H\220\3077\032u\275E\342\035Z\241\322\235=\342\341\340[\253\332\341\334\316=l\371\021\022\220\023\247\020\316\326"
+	.string	"\004\330\365\334\264\331\322[#\344\007\3374&\336a\0235i\020t\024f\353\307\256\327\016u\306L\031\301\367\253\035\256\005$\300\236\007\330\201\317\304\277\367K\3722\311\033S\344\373\034\371\304$\350"
+	.string	"L\330\363\372\t\263\2653\n\200\002\030+\022I9\022\356R\340H\370\251|q\326\t\352H\270@\212/}\204C\250[\377\b \f\030\275<\274\256&\003\330\005\355\352\336/e\364\272H\327%\350\345\310wy\323\234\321\353bU\316"
+	.string	"\223\340\322\026-Y\260\\\261\013T:\200\253t \306C8G\235\243\362~)\341~\312\033\206\344U\302\304\365\366\337L\3638`\277d\037\3455C\206\021\316\275h\377\366\2469\361\256\205\357\366P\276M\315\365\366"
+	.string	"\3162\353\343'\251\t;  \274FCE\350/a\"\\\024\201m\250\241H\003\031\242\221\021\t\222$I\2451\361\005\304\030\305\\Y\007\021\320,\247\240B4R\332\264\035\262\360'\252\001\243\252@j\026\325C%\ty\224I\023\245JD\306jc\021dy\246}\323\223g\301\225\314\370+)\366\217\251\021\235\376VERl'i?\025dA\212\277~=\275\265\307\355\241\007<\302\255\027\325\3617\001\301\007\021U?\031\225\"\002\342\006\216\211\311\203\312\334:5\353v#\235\f\341\213%\303\315\304\213&7\374\374@\203\3755\261\370\347b~5\335r^\026F\376\220\002\n.1\264\034U\227"
+	.string	"\216\216\333\020&X\237@\221\377\371\214N\006o\221\347>\247\240Ze\300\027\373([]aU?MR\371\023\n\333s\305\346\245\\~@\257\333\254\341\373\204\373gn\326:\323\021\241\033\020(6\233i\305H[3\377\364\fqj\307G>\n\341}K\365g@b\342\024fF\002\204\020\221\217\233\306\316\016\262)\210D\027<\t.?\313\377\016\224p^(\261\004M(\3323\325 \367NE\\\355\223\373\374\272N\201\374N\367\035\243\241\207\207?F\031G\277\027\271\033.[5R)M\217kJ\327\306\031\337\323\354\320\265\330}\002M"
+	.string	"b\237'\257\022\036.\364\002\032Dx\302\031\262=\026\215\273\236\322\005\205u@\r@\003y\301\032\223\347\321\364Y\300S\226\007\221\254\272\237\215\261\337\036b\202c\334&6m\242f\205l\227Mm\274\013sK}w\226+\327\032\255,\311\2755\242\235\016\237\013sJ|v\224\"\327\032mX\222pk\344\252I\025\217%\336\256\013;k\223\f\271\326D;\202ESw;\265&\370\251\f\211\242\276P\357\207\266W'&T\037\025e\023\357'\231\264\342\032\276\206\341\261\323z\351\370f{\177\032<Ag\357\023K\317\362\311"
+	.ascii	"\310\016D\332H\341\026\342r_\332I?\031\003\363(\220Y\321*?"
+	.ascii	"c?1\327n\327+\310\236\311\313\3048\245\005\215\241\223JS\324"
+	.ascii	"\214\003p\325\242\357\276\231\216\233\345\344\304 \f\344\232"
+	.ascii	"\361\323\361.\2073\024\251\rf\026\347\301.\206\017vd\220\024"
+	.ascii	"4\320L\fLm\375\370t\367\342\013#\002g\034\017\213\345\363E\373"
+	.ascii	"`,\220m\3115\035\373\327\315L\276\316\224<d\\\fR\301@y\231\376"
+	.ascii	"\026\203\177"
+	.text
+	.section	.gnu.lto_pidUpdateRuntime.124.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\202\001\315\017"
+	.string	"F\037nF"
+	.string	"\263f8\240\272/&kP\226F&m\006\372^\344?~:V\n\362\253\022i\251\240\361\233-\214\2740\264 \362\372.\356\275i\266\253\255\265\3355\b\016*\215\245u\003$\267\026\250r\234\325`\267\335M\312\224\002W"
+	.string	"T"
+	.string	"]"
+	.string	"~\260i\332()\257\217\036>\036 \001\244s\003\345i_\347-^\337\371\360\001\2736=\200vG\023\227l\317<\236\200\366l;J{\346\227]D\"\2631\rrp\320\370\f\331]NS\374\365|\371\3579"
+	.ascii	"\261&\346Y\202\260\273N\261F\304\255\267\255\300\366\312\276"
+	.ascii	"\217\006\302\330\320\314\2120\217\3541LEa\237\264\273k\265\261"
+	.ascii	"?\376"
+	.string	"\246\363\334\333w\376\222\246\263R\232\244i\325\322\251\245?\022\200\005\210\232\307t\354\2068*\262B\231\r\025\347\371\355{\303]8\345fwO\177\217O\266y8|g\266\003NN\320\217\335q\301\26344$\221h\033\34630\224\020\311xL%\325\345\305N{FR\023q\304\246\252\250\0351!\251\233f\016\032#\230\321\035\244]S\017T\242(\034\372\t\n\363\310\367y\214U\362\270\331\205]\274\217\315\3400\274Dp\"HhBgw\035\374\374E\006\037\347\231[\276\274\370i\317Jz\rf\201\351T.\022\004\274\200\235\213\345Epu/\0358\322\261\274\225\017\234\240\362Z&\247NT^\213s\261\254<\326\n\347\342\251\264p)\360\205;!\361\327\352@\316\365} w\032a'\255\332x\003RC\b\246\241\013d\246\2526\205\n&\315TcDh\214PYR\222\332\026.\344E'\220\321\030\373\001\030"
+	.ascii	"D\250\332w\002\224a\375\340\305q+\fU\231\024\206I\227\355@\310"
+	.ascii	"\035\243\311\020'f\340\2579%\206\200l\242\346\275p1\327\304:"
+	.ascii	"\004\203\350\260J\270\005}\003\324*\340$/\256I\006"
+	.text
+	.section	.gnu.lto_pidInitFilters.125.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\005\b"
+	.string	"\322O98@o\323\001\270\366-H\344t\251\\\200\313\365\226\333x`-Zs\257C\252_\033r\263\260]\020\037\231\260\177:\023s\021L2\233A2\336`;~\374\377\267&wJ\001\241\321%\302\264\005\320\225\001\370\343\001]\331$94\\#\321\204\270\030\036\346G\333\246\247c,\013i\223\204a\332\344\204\373j\025\264\302\306\246\306\n-9#\r\256jo\021[\212h\241\235+iKL\310{\226(\r15\226\264\263\303N*\207\375jw\327\n\332?\375jm\243\t\343{\211\312\256\351\305eE\353\344\203c\373\322~\310E\270\237(\036\260\013\242\230\354\206\007.\320\334r\370\001\314-\315\0050\267\314\331,\017=\266\003\262rA\322\262\273S;\316]r\376G\276\361\276\3562\223\260\273\226\336\227q\353m\023\330F\260\215\n\t"
+	.ascii	"2\241\227/0\\0i\006\0070\345\022l\263\232\002\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_pidInitConfig.126.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\235\007"
+	.string	"\002\21766P\217\032\003\220\034\2253\253r\302\205\351\227Q\265\330\351\244\211\214Ua3\031\332\007QDv\336"
+	.string	"x\nZ^5\003\001\242\021\350\210l\267@\2658Q\333[\312\224\002\237\020\006\312\266\006\017\246\t\264\303\361`\232\034A<`!\220\224\300\034\"dg\023I\316\246\231\366\331\344(\3136\251\231\267\365h*C\t\245JY\304\213Z\020\3010\266\023\024\320^\241Ii\252R\030\261kg\007#Gk\353\377\033M\255O6\264D+\222\306\347\023\225\237\364\342\362\225\013\345C\323\326\260\265\210G8\237*<\360\233RP\377L\350A\306W\247\0130\2762&\300\370*\327\262xz|\023\262\312(i\371/c\2079C\2566\211\003\274\2573\004X\370_\350}\033nt[\203\266\nmA\002\b"
+	.ascii	"2\241u/pq\341\001L\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_pidInit.127.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\213\003\345\031"
+	.string	"\326\257\245G\240\\M:$\367\232\031`'\226\226\270w\376\022\361\324\212\242\bI\347\330DKi)l\306\250\222\024\226\367S\035\227\315\374}\323g\247z\036/1:p\211\003\\\215\3309H\372\202\323=\374\277h\2214\262\211\334)\005\207"
+	.string	"\210"
+	.string	"\232"
+	.string	"2\240\216\243\361\322\006\240x4\354?\371S\215\227~\335\242\210\247v\r[<]\321\366\247}'g\032\337t\343\002jE\322Y\251\265\334\361\202\360\324\345\t\200\247\341\007\200\247\036m4/\223j\001&\275\0348\255Zkl\217x\377\225\3677\307\323o\347\350\273,8\375;\252\332\221\266\241\323/@\255\025f\303\361A\230;l\264\371%\371\361}\324\351\021\217\212\264\375\370tY\250\265z\2226\243\033\274m!\333\035\354u\n\317r-(R\360\360\200\247s)\230q\317\257\370\204\265V\t\376\356Vd\276\322\251[\374\314\223?\340\351\327\306\rj\253\211h\366\354\2226\327\210\375\327E\322\t\247a9\341\264\370\246\377\025N\343\\w\203\256iJ\247?:\275\340\364\244\323'"
+	.string	"#\243d;/Wk\217^\233zE\261 \271\356\267\357\347.%\343T\034\341\206\323z\351GY\312\247\214\327y\352\325\250^\207V\0232\253\326\332\340\324\021\302\323\003\337\007\200\001\340)\335G\375[\272\341\240\224\321\001\271\324\305l\230c\222\310\331\303p\230n\222j\255\023\276\034\214\207\017!B\200\247:{\251\177UE\326\360\310\351\200l\255uh\r\363\"bN\221j\304\365\356k\214je"
+	.string	"\333Y\225\227\232\025\316\372[\316\305\273\021\256\342*\244\232\335kA\322\020\251\256\320\353Y\025\325J\224@\\\234}m\211&\356\214*\252Z\326\267>\325y>\276\222I\224(\201\373D\242$f\b\223\220\335\357\267;\265%\332\354y\356\356s\2741\361\251\023a\255E\022\034f!{\217\013\331\n\240\031\b\025\262\240\227y\036\250\220\005\305\204X\370\310\\\254\210\275\220\245\370\211\361\314b\304\036\0240PP\317,&\004\0044\213\211%\321_\027\311\351aN\211\217\255,\242\245\231\301t\360\327&\031\225\304\350r\245`\372O\343\222\221\311\237\376\312\335\256\266\262h;D\327\210]V\233\263{f68\270;v\016\356\233\240\234)\232l\376}\016\016n\316\352\034\361\250jC\020L\235\245k\217L\243\323<\351\0038v\310\276\031\030"
+	.string	"\260\214ua\007\213\314\313`\310\240a\236\324\020I\250!\030G9\204\224R\002\251@\204\212\302$\035`\002\221R\332\r\021"
+	.ascii	"\266t\215\365;\222TI\340\216O\363\302@\357\332\315ia\217BT%A"
+	.ascii	"\376k\3647\206\347\216\377$\215R^\214\313`L\335>\324I+|\320\020"
+	.ascii	"'\2720\337\330%>\230t\324\r`7\242A0\224\370\252\362=^Sc\f\275"
+	.ascii	"\25278Z\255\027\353\022\356F\352J\f,\327\262\007\374\323\254"
+	.ascii	"\242\220\2247vE\271\270\0046O\240\002\362%\367t_\326\320\177"
+	.ascii	"QU\330\320\307\362\330\\\377\256\302\204\021\022\331\354\235"
+	.ascii	"\f\2209\223\023\250"
+	.text
+	.section	.gnu.lto_pidChangeProfile.128.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\305\007"
+	.string	"\022\217770q\323\001\203\202\036\345y\335\310\b\250\230`\346\221\200\373v|\002\3159\224\372\033\025\030\376v\302\264q~*\327\240R\242\r\256\322{\315\240\252s\252\331L\264\224)\005\031\3305\202\300DYH\343\"\256l+0\350se[$QLd\242P\034e\022\025\021\304Y\304\217\307\332\206q\221\244i\\\354\204{==\240\244njJ\312a+\023~\26514\362\237\r:\324s\352\225@\004\246E\365\222S\312\225\035z\251$\366\001VO\366Q\177f\372\326\005\312\364\001~F\265kZ\341l\312\2229\261\375\216\355L{\201\241;j\303\272;\302\022\263\033*\030A\340\226;\233\346\241\311zTB<\\lv7j\311\273g\347\177\345\003\037\350=\003\034v\327\371\201 \267\336\366\201\355\006\333)\001\b"
+	.ascii	"3\003\376:\303\020s\213k\"\001&\020\225\232\f\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.129.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"]\007"
+	.string	"\"\r270q\222\016 \344\201o\0056\312X\tb\264\303\276\t\376\350\2567W\250\320\303\304ow{\344\353k\356\332\341oh((0B9\304>\n\375U \375\300f\t\221)\203>\016X(\212$\"\260\t\210X\2015PD\220f\021?\236\263\320\203\026EY\246\305\216*\013O\00250\254\022\314Ph\nJ=L-$\b\375\023z\362\252 &3\027nIM..\252\327\030\243W\256\327\035\001\364j\207i\325\242)\275\233W\221\036\374\370r\022\236\236C \203\352\372\342\222\271qc\223\254\213e\344o\347\355g\252\nIOJDC\245\225\231\021\202t\353\333nS\035\340:R_"
+	.string	"Cf\376\270\216\243\303\376\006\377\301\277\022\f"
+	.string	"3\001\3638\303\364\256\001\303"
+	.ascii	"\356B%\265Y%\240k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.130.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\016\001\235\f"
+	.string	"\266\030VA q\223\016\034\016Q\205\303E\307K\3436\340\\\307\242 \344\253h\251\034\007p\020\224\021\323\262\221m\214\210\300$\t\b\327\211\352\365\001p\025\b\020\210p\236s H\025\206m3c\211\264\275\245L)D"
+	.string	"@"
+	.string	"B"
+	.string	"%2\273{\244\017(\002RH\224\240\270\261\273Qs"
+	.string	"\226\303w\017\313\241zx\366\247\231\371T\307\200V\2621\332>\177\030\256\231-\3644\273{\225\247\311\246eR\235\335u\216\266\0137\274\355\003\266\243\375\n\001\032^\340\340@y\262I\237\324\016\366\337\352\211]\235\373\251s\351\367\264>\235O\377\222\2411c{\251\305\256\205\223\2165\301\025 lg6&\317\271\363e\327\005\f\025\273K\300\003\252C\333~\312\003z\321\006-ON\275\252^$B\353\356\f\355\2026\224\246:\340P\212!\n\241\345\356~\264\263\235\233\253\202\025\031\241\314a[\302W\334U\273[\3007\361\023\023|\224CS \311\217\016}\022\313\341\025A \"\030f]!X\345\017\316\002\317H\304B\032xD\030D\b\236\004\017\342\307\025!r\002\330\032\001\271\"fYW\304\220\366o\365\304W\3713\224\214H\241\225\372%\245PMlC\275\251\306\016\023H\265G\351\323J\223\205\352\013\025"
+	.ascii	"+\013\275\307\r\377\263\275nh\371\247\306\354\300\020\227\300"
+	.ascii	"\0177@\002\025\266\204\235\261\3215\274i\202\264\2023h\3618&"
+	.ascii	"\210\250p\007P\371 5dQ\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.131.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"]\f"
+	.string	"v\227TB"
+	.string	"s\233\016\230\bb\021i#r\272\f\351#_6\331\31691\020f7\034|\227\004\025\314\205f\261Q\301 \030Mn\007\266\352\256\354\022-P\020"
+	.string	"\222\212 \350\037\200\304\266\300\300\327\226\354-eJ\001B"
+	.string	"@"
+	.string	"A"
+	.string	"\002\246G\370"
+	.string	"\323\243\232\270\366\b55\377\262a \272\361q\335\366H}8\204\004D\250x8\220c\004\217\252\033\245b:\022\230\331\335\267x\226t\242\314\313fw\235\\\327\341\236n\033\202m\005\366\035\004\253$\354{\177\324{w>\375\t\343#Fw\025\032\273&-Av%\316@a[\263\253\274\347\317"
+	.string	"vk\330\220\261\273\t\214\200z\264\355\243\234\205f\177\220t\342\244"
+	.string	"\n\f\016/~\354\256\225y$&)`TM\351\261\242\204c\224,\271\273\233~\266\323\300UBi\307(Yl\207^\362G\355\356\002?\345.B\374\223Go\020\311s\217\276\310\364x}\020B\007\020o$[l\322\226Z\302>\fY\350\223\205\032`Wvy*s4\023:\037+\273`\241\203\241\202\225\241\023\301cq0\220\245\031\340\353C\001\263\262\353\302\254\212\264\207\251\206\032U\265\304\266j\210\212\225\021\025E*\243\332\032@y.\025\352v\020\001\025"
+	.ascii	"\177\b\b\303L\023\226\323\320\030\333\353\bm\001\241\034%=HQ"
+	.ascii	"\021 \274L0\256\211 \023rT\344\226\211$*0\004\250\034\261\032"
+	.ascii	"\247\25295\343lW)\003"
+	.text
+	.section	.gnu.lto_pidCopyProfile.132.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\033\001\035\r"
+	.string	"6\230WB\020\221\223\016$\324\001\n\331\343\252W\350\0300\312\233\206i"
+	.string	"\305\236b\336iS&O\321\274@k\306Z\361cZn\204\3722\216M\006\"\254J+\240DtA`\031xX1\204F1\262\311\336R\246\024D"
+	.string	"?"
+	.string	"E"
+	.string	"\206\361.\304r\220h\331L\310\330\335KA\374s\3704?~\314"
+	.string	"\030q\240\303J\303\337\353X\341\262\t y0Y\234Ij"
+	.string	"\356\344u\354\356KO\013\234(3fv\3279\3422\334\324m/\260\255\300>\204\366\337*\311\376\312_]\345\217\231\206\231~\232VM\247\246o\221\300\240\\\340\336\022c\027\345Dc]`\n\021\266o\331+\246\003\231v\001\003\237\253\224Xw;\224@\261\333\021\360\200\352\320\037\007\n5\306\204\362\344\250O\235[L\31050\234X<Mq\245Q\225{\371\220\273\013RS\240T\033\260\2740\311\031N\275\252\276\026\333\206\356\225\246F\025\333_BE\275V\340\360\302\342\342\304\bQ\236\354N\224\232\022\032\255\2631a\203\211$\330\204d \034\355\003\313><\035l\303\032\017,\033\271<\017\034d! \227H\306 \302\245\321:\227\007\2079#\033\355\362p8\332eu\241\277U\222\021\224\326\004\023R\021\244\022Z\002I~\344\227\2369Q\220\253\033"
+	.ascii	"l\263\341\214iR\262q\241\345\325/\353B;\005]\004\016.\301\212"
+	.ascii	"\240d\301\301(Ld\030c2\333aS4\327\360\234Y\200E\030\003\312\201"
+	.ascii	"\301\300\b}\306\b\356\0220`U#k\206\334\256\242\007"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.133.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`A\b\245,"
+	.string	"\312N\034\021EpZN:_\002\002x"
+	.string	"\013&Z\bE\226\0013\354\315\301V\226?]\2201\374\351\226e"
+	.string	"L\254\323?\310Pe\271\312\376\025\006\220G9\314\205\007\nm\003{\303vg\013\373\355\277;\336\266I#d\313\235d\002\001\341"
+	.ascii	"\002\001\314\317\302\227c\241\026\031a\310\234=\241B\343\340"
+	.ascii	"\370\316\232t@\257 i\r\357\326\327\027\226)|+,\244\362*Xw\213"
+	.ascii	"1\314\002r\207\311\"g^\032\320\233\303z\241\223\2057\231\017"
+	.ascii	"\205\037\345RX\310\206t\303\200\336\\c%\322\326\360\326\340\302"
+	.ascii	"\303b\001\275i2c\361\237\\\215\205i\254\274[c\266d\200\336<\232"
+	.ascii	"\214_\261[\303\214\235y\271\271\367>\335d'\364&\337\354N\260"
+	.ascii	"\230\225\023\270\270\324\026\230\361u\261\321\271\367"
+	.string	"F!\235\350\274i/t\336\354!\307\2720\bD\177\247i\273b\361\177\020$ \331\264y\205e]\030\274\030\260\035qO*\003\343Q\201I\350\017B\0201\035\377\211\001\313\021\327U\317\236%g_o\202\210\361\270\311U\255\r\220\374r\343b\300xX\2460B\326\b\303\266j\373\204\245\026\351\336{\265\327\032a\310Z\177\020\356\275\\\275\302\304\316<gf7f~\301\374\323\013Lu/U\r\007\315\275W\301\334\351J\360\213\334\344\342\211z\257\233\374\023\347\315\244\276\225\327$\233\0164\255\272\344\243\026\320\003\272A]*\007Y\227\f\254PG-\004\003\004X\237\316|\265\242\336K@_\312\253\217)s\226w[\235\305\234\206\254M\306|{{\214\031\352\351\200\201k9\027p:\332\271\351\254\314tV^\372\333Y\351\254L\340n\347$[\031\311V\036\360\265\363\321\331\316\002le\243\303\235\211O;\027\331\312"
+	.ascii	"le\"[y\310V\026\262\225\203le [yh+\377\330\312>\266r\217\255"
+	.ascii	"\314c+\013m\345\240\255\f\264\225Q[\371g+\237\266\262iV\266\266"
+	.ascii	"rw\345\332\225\217\340\247I\221\260\203is\357\327\222\357\336"
+	.ascii	"\231qF\256\345\207\373\337~\267\177\355g\373\321\376\264\243"
+	.ascii	"\314\017B\324,\177M\226%DM\032O\033\327\276Xx\0348<\375\270["
+	.ascii	"\273d\335\371\324A\r\325\235FMZv\253\260\237\332\312\245I\263"
+	.ascii	"\203-lb^J7\305\007\330\301\376\335I\313\00640\304Z\032.\251\236"
+	.ascii	"V]\372tP\237r\220\025m\237\346\232\302A\373|K\351\232\372\354"
+	.ascii	"__y\264\r\022\357Lz\204\347l\260\3750\317\256{\027\236\267\346"
+	.ascii	"l\007x?\016\256\257#V\311\314U\311l\343\232]\206\343\261\022"
+	.ascii	"\215\331!\222mu\352\2757\253\233\2149\234\266E\254\245\331\252"
+	.ascii	"{\314\254\341e8"
+	.string	"\240\037s2\036>\200\250\367\002\321\033\222mL\320\224\267b\006\t\220\313\017\226\313\275\255{\265\224\272\233\272\276\245eL\335}\265+y\325\245n\226\232@3\365\333\256DC\256\366\222R\327\236\361&\365\273\030?;0U\277-vJ\375+/j\303C{\023\350w\365%\365\233B\231t\217y\352_b4\037\021\016W\305\343\024\206\"\321\221j*\302\261\310\302\252\212E\360\205T\235\222\252\"\244\252\211c\t\253*\3431\003\212*\027U\025\254\256`\024\215W&\206\254\256\212\307)\253\"\n*+\nG\253*\243\261\005U\020S%\030QT\021u4Q\242\210\202D\224Uq*E\024\225\221ET\002\"_\251\2502F\035\257\256\214QBf\3464\255\333\333c\\[\355\037\353\222\353\263\225\353^\266\004\017\234\254K\316\316\204\352\245.\271>`\021\022\320\235\035\270;\255F\0325RQ\033\t\001\364\001\242\036j"
+	.ascii	"MdK\313\210M\324\304;)\335P\037\215\311k\223"
+	.string	"\352\005\233\214\037w\tsJP\247\367\350\232K\376\f4\261k03\261[M\216\331Z\335V\335\003.Y\331D\244\317\251&\313\314\241i\241\005Z\250\rt\263\361\331\021\352\347H\222\251\203\006\324<]\240\373-M\"\225pu\321\0336P?-\373\351\236\036\266Q\234\264\214\347\247\003\344\245GX\371$\367\336aO_\356\037\002\200\236\250\201(\343\230b\246hFD\222\202\244\220\016\220\002\231)+n\0210)T\320PI\224R\273\001P\006\260X\244\377\347\340\276`\324\313\246\244X)\365\223#\324\311q\224\273\344x;\201\251\204\270\342\034$\034\260\256\206\375\345\260<| \360\332\243\021\346\334\267\217\231\324\005\316\216\007\016\246)\304\354\204T\305\217\275\r\211\036\233\372\306\356\013Y\250\206\224'QD\250\305X\016^\273\330\013\310\3548\027\214/\354\256\021\206\371;\\\273\316'\336\b\376\223\201V\333\200P\351\242"
+	.string	".\340\211E\271j\221S\2123py\302\244J\263\240;=\343\272F"
+	.ascii	"z\3264?\362Q\346\201a\3534w9\265W\245\f:\304\257A\262\247\341"
+	.ascii	"X\006\371\305\367\341\355u}l#\307\240\005\"\364\215\217\212\032"
+	.ascii	"\t\242\204\253Uk?\271b\303{\240\361f\375\277\256\256{\351\017"
+	.ascii	"w\271]\3607^\366\226e\336Wu_\023\305q\234\320\210\333\357i\241"
+	.ascii	"\311\330V\376c\241\243\274\005\244\007\0336\353\211T\321g\217"
+	.ascii	"\207<R[\242FOaF\205\214\017\320\213\b\202\021\360\017\374\213"
+	.ascii	"\2567\301\2139\270d\330\230\377\005\266\375e\211D\244\303r\311"
+	.ascii	"\210\323v<*"
+	.text
+	.section	.gnu.lto_pidLevel.134.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`B\005\255#"
+	.string	"\312C\270\016E\200\234Q:_\237&\331\034\ntKd\323\370\254\264\001\216\322\0253\256^\f\241\263\320\234\346\306\3136\241J\232\212\331 \367:0K\264K\227\2041\3061^}\236*I&\367}`\340S\263\370\337\b!r\247\024\324"
+	.string	"\275"
+	.string	"\337"
+	.string	"8[\275\213'\034\317\234\324ZqV6\356&\265\203\376\226\177\031\307\305aes\272\352\244\320\322\342\325F\245i\266\272"
+	.ascii	"\231\325Z\031\3344\211\022\213\303J\242JCx\306\302Z\211A\200"
+	.ascii	"\250\016\253D\211@\251}\257O\t\236\312\214"
+	.string	"\027\325\272EG\254V/\007n\340e\363\351\221\036\363\255V P\304j\255\016\354d\273i\333\207\362(A;LCV\326\024\t]r\264\256\364\251\265\352\f<w\336,\177t\336\334!\017\276v\232\345\322\240\377\257g\020\366\261S4^\275\246\343\247\216\233e\256\206\221\242\220\221X.0K\356\371W\026-\203\2147\276\345\202\243\231\033BFa\231K\023d\316\301Ni\030\207\224\326*\324ZM\213F\033\267\355\266_\330\276a\233\f\002IkC\355\350\213\345\036\214\217\341^\231\356\256yF4\373\322\275\026\232\243\036\206g\253u\b\301\007\303\201\205\215k\306y\363+\343\310\347\t\022\213\246\331^B\272B\354\227u\267\354\033\265S\002\004\307\362\037\270\330\335t-7\323\255\374\006J\352\245s\271\225\216\374\223N\345/p,\367\200\222Z@I\235+\251\221J\352\243\222\332\350F]TR\023\225\324C\247\026:u"
+	.string	"\0335\200S\343l\324A%\365\355\324\266S\327J\352\263Fm\226\324eI\275\247\2465\352+\240=\2628I\032_\207\254\326\032i\201j\231\371\345\310\305~-?\227\257}\373]\374\244qbL\244\024w6/\007\263\003+\304'\334\254\321\036\3547\037c\274\320\302\350m\227\226\206\235N'\233\232*q\210\256\356t\026\255\323\232j\3558\331\313>\370\\\006!\202\276(\342\274Y\264grD{\262\203h\227\226i\251\027\"\022a\330\273\270Y\342\243\232BZ\332\237a\255XMCK\264'*\021\332\241M\032#\232\005X\334\n-\2011\"\022"
+	.ascii	"\033\300\032nf\304\307\210\324:\224`\227x\031\023d\202\310\023"
+	.ascii	"\007{\023\343\274\t`?V\344K\320\342\214P\244\240/\006\355\277"
+	.ascii	"~.-2$~\314\206{U\236\253\264FkJ\314#\244I=i~\354\n\261\322\336"
+	.ascii	"vG\016\256\036`\326\240\031\322?\266\355\255\266\266\3353\"\236"
+	.ascii	"\332\232cZh\346\236{:D31\346\236\307\343\331\023d\271\273J\373"
+	.ascii	"3D%B\232\346!\032\226z`%\005|\242\322\365|TT>\250\002R\300\250"
+	.ascii	"\336\356\007\0341\265s\261\363\320\363\311\340\375|RH\246\205"
+	.ascii	"\237\357\367\333\005\001{<_\025p7B\005/\004\260\267\373\375Z"
+	.ascii	"@\031Q\361~$vSQ\275\247\333n\212\267\302\367\013\241\202W\025"
+	.ascii	"d\305\203\361T\032\352\201\n^\225\016(\025\305\233Z\241\353\361"
+	.ascii	"\236\250tP?+\335\003\002\366U\355~:\240\317\367\323\341\274\260"
+	.ascii	"^\326\335\362\223\317p\247\311\211`\227\264\310\352\230\tv\300"
+	.ascii	"\200\24224\036eX+\254\035X\001\213\340\330\264\271\025\260IW"
+	.ascii	"\230\026is[;\013v=\016\034\244=\233\364\270\342\007i\200\332"
+	.ascii	"\026.\320\027\233\366\311\347\312\320p\224\tO\344\217\231\330"
+	.ascii	"\311\264G\233`\267\rQ\211\020\303\3358\314Vk\205\340\263y\233"
+	.ascii	"\f\336\320\241\303y\363\310A\222O\237c\027\022KLV\215$fW\250"
+	.ascii	"1(\343\2201F\0323#\023\020\221\244 m\220\"\221\253\262\003\021"
+	.ascii	"\300=+\343V6\003\336\301\342\233\025U&F\332\2274@z\216\025oa"
+	.ascii	"\367\317\246\025\247\035\22145\021\224\2659\336\254\243\270\t"
+	.ascii	"\005\027\360$\306r\001\f\310\364\361\321\324\304\271 \241\244"
+	.ascii	"\013\221=\201\225\346U\021\353[\021\tP\221y\206\244\275\346\342"
+	.ascii	"?\320\310\330s\004g\257\337\026LG\227.\205uv\366;\215+u\300\024"
+	.ascii	"\0263\340\025EJW\034\033\343\261\314Bs\214\016'\001\240\365z"
+	.ascii	"\226FBi\371hv\315\355\005\303\337Zv\245\2630$B\350\342H\264\235"
+	.ascii	"\265i,\220\347\304\334\307]\020@\024P\220Ocn\242\250\221t*"
+	.text
+	.section	.gnu.lto_handleCrashRecovery.136.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\223\f\345?"
+	.ascii	"\332m<\030C@bR\007]\365\326\276\357)\303Ry\020\373G\336s\265"
+	.ascii	"\354\373\302\326\246kJ\357(l\020&\221\234\244\332:p\247\267d"
+	.ascii	"\360f\372E\241Us\202L\220\252\260C\236O\023\273\357\311.\331"
+	.ascii	"\332\336[\312\224\002q\001M\001u\001q\031\261\036\320\007\314"
+	.ascii	"\263\267\330`\340\316k\353\332\036\357?\315\377\335k\367_c\205"
+	.ascii	"zFM\032\267\033j\242m\242\036S\252\365\235\3033w1~\373\330Y\357"
+	.ascii	"\217J\245o\357\r\365\255{\r\355~,j\245\262\367\256{2\312\027"
+	.ascii	"\343\314\250\335U\351\376Z\237\016\306\213\361\bQ8T\276u\207"
+	.ascii	"\341\376~\353\276\356`\324(]/.f\355D\333%\306\231A\272\020\354"
+	.ascii	"\226\031N\334;"
+	.string	"\r\f\335\005\235\305\353\270_G \265H\337\336\316(\257\312s\177%~,6\222\206\266\263:\204n\357\271(\2070\374\326\347\206\237\335\337\312\307\305/w\343\270\177\307\225j\326\267w\226(G0\374\226\351\217\334o\331/r\277\365\330\035O\022\216\375\345\200J$\207\226\353\336\033\251\225|\374FEG\242!\241 #\374\026\211C\241\333\262:\307\376\302*\342\023\372\365F\302\252\242\351\037\227d\242)[\036b\262\226\205\202\316\262qj$\303\354\001=5>\2453<\262w\033+\222_\263&\267\261h.\022\211\270\215\r\311CaUS\232\017\"/,B\205\274\313&8\303#\013\202\206\261Gzj|O&Gn\331\002H\242\200\357f\254\214eR\223\227\343\205\342\310\354\013uf\355fl\3122\355\275?\314g\036P\260\234\205U{o\317O\250\217\367\243w\377\032\356^\305\375\005\021\317\347V;\254fF\355"
+	.string	"\345\374\312\333\\\217VK=\277\227\253@\353+\202L\252t\236\325\322\007Z\353\357S\305\363\017\277\027b\270\367\206\340/\347\347\214\360\237~\353$J\224p\277\325\372\303<\373\366\025x=\213\223\233\322\017t\022\237\034\201\262N\240\247\364\333=;%N\337\030?[\236\200\345A\367\177\363pL\240H\221\377\231\302\3756\353'\266\317{\357/\255\245\356\277\345\276VQ\255\343\314\177\334\277\315\347m\371O\375\n+\377\363[\177,\367\333\327\032\032x=\213+k\346A\3679\260g\367\336;k\251\373\263{\357\355\032\211\373\233\275B1\273\325\233\235\302\343\275Ox\263K\3704\357T\305\354So\366\007\017\346\277\301w\371g\360^\376\027\374\335;\362\261\374K}\226\177\005pv\250\337\362\237\340\315~\300\230\375\351\315\356d\314n\340\315\336\364fg2f/\360f'`\314>\200\230}\t\316."
+	.string	"\316\256\004g\017"
+	.ascii	"gO\202\263#\301\331\001\300\331\217\340\354Fo\366\242b\366#\234"
+	.ascii	"\235\b\316>\004g\027\202\263\007\301\331\215ov\370\315\376\032"
+	.ascii	"\263\027\337\354Dc\366!1\273\020\316\356\302\331[8;\373f\327"
+	.ascii	"\305\354\231\230\375-\004\261\021#\356\267G\372\245D\343\300"
+	.ascii	"\325)\235\341\221\301Z\272\335\263\221\226Q\305[\220\335\343"
+	.ascii	"#\261Z\376\247\221\316]\006\177\344\201\351\2579-\365\n\272H"
+	.ascii	"/ci\346\021\"?\213\240\214\t\204f\245+\034u\002m\245\237.\353"
+	.ascii	"8\352\bQ8peN\356\261\222\214\303\255H\331\031\263\03153X\314"
+	.ascii	"\244I\334\326\346~\353\027ms\2756\363 Q\231\216\303@\013i\"\255"
+	.ascii	"T\005t\027\366D\350\314\255F\354\235\247\037R\007i!\355\332A"
+	.ascii	"\371@\202A\372\003\243x\200r\326\007#'\n\332\336Nap\360\217s"
+	.ascii	"\357\246\223Q#\265\276\023\346\006k\243V\022\f\353{5Q\303\272"
+	.ascii	"\265\013+\352\367O\034\205j\312=\236\362\200\361\033\2045?\177"
+	.ascii	"\215\341<\256\022\307\345\177\306q\356\267EM\305V7\324D\375q"
+	.ascii	"\222\347\023S\337\272\267\267s\312\335\352\377,\f\367vB\330\023"
+	.ascii	"\247]\3700k{\357\267\241\377\314c"
+	.string	"\220\213\342\301\3255\211\257\367B\375i\325:K9\277\006\327}\003\207\374O\341\223q\341\223\007\330\347\324_\023\272P\375\206Z\352%\344\270C\372\311<\021\r\315\025\267\266\266\325P\232\207;\224\016\332\353\213\332U\347x\361\023\262\332\325C\332s\330\037\030\224\220:k\256\253[]\026d:\375\362\206\r\236\270\314\255?\365w1\356\267\256~\036DX\335\352\017\363kz\207\236%\325\225\305\274\332R\362,\251\344\226\026\023\311\245\334\332Rb\005\240\221\"[\025\227\312\3452Idri)_0\223!Vhy8&\231W \224K\257\026\303\256\021\311--\021L\256\344r\031\003\313\330\245E\343\212\335\322Z\212H\272h\301uE\364Z&e(\261\222\313\024Y]WK\254 \307\222Z\241\365\002\311\314j\241\345\202\005\222K\353j\013\211\265\354BJ%\271\362Er\211d*\225K\344;\327|vk$\031\004\321"
+	.string	"\373\232\032\314H\nqL\240\2773+\177EZ\352\337&\273\275[\224\357\3727\224\022G\345\250\245NA7i\267*\233\t\232\202\216\272s@;\351\tzI\360I\037x\022S\263\231\2656\353\336\223\316f\330\fh\247&q\224\017\234\306o\337\207\211\001\375k>\203_\224\017nh\357\217\036\"\t\272\211\215Xf\213\241kM\307@t\344\250\264\004\255@0\354\312\244\th*\275\264\246\200fJ\022Ss\226\346\002:[\351\f\320\004\324\342(\337g/\247\305o\377\267\227\217\f\320\257\3463\244\211\316\001l\032\303Goh\351\365\374\222Y\236\263\252f\247*$@I\013\310f\371\314H\221\374n\347~\253$\007\316\345r\207#(\200Fb\223\244\003D\345!eB\222"
+	.string	"\353\232y\320(\346\344i\324RG\322"
+	.string	"\364\273\375\310@\334J\206\244?\013\035\271#\r@g\3010\005\331\207[\243\200dh,\344iO,\217\305C\314\002\200\367\250\201$$\221C\310\221\021\t\"IR\2204\006\220\002\021!\253\332\006\021 -c\220\311\314(i\016\255:\274\315\002\301\376!\350\22065\351\330\272\220\230}b\r\241\375\362\006\311\333n|\n\367\017\376>\244\344\232\332\353\305\351\n\374\333\236\365;\353\021vh\224\004\030\0376\t\200\3366Lw\377\027\032\0344\002\304\203\200\371\215H\277\227\244l\fm\302\246\220\362\254\215}\260'\367N\037w{\323\nm\355<\"\013\333(\210%\205\361\025\270z\263\234o\254"
+	.ascii	"\356z\232\"\267\336;\334s\325T\360\030g=\230"
+	.string	"\251\374/\001\034e\363\263\370vM\223\267\036\3765\013b\335\002\016\326\007R\372\214\363\200\342#\320\0013*\300\275\371\330\345\264\201)\325\306s\371\303-\251\351y\200l\331\004\375\2016\227\337v\202\334\031<\243\301\202n\352\001\301\206\332=\356\210\364mwJ\275\324V)\323\373\343\332V\233tX\247\213(\254Q\212\303\261q\370z\354ME\202u\333-O\3504H\275'\245\335h\347\357J\343\312\023{\275~\026\235\005\244\303\217\277\363\360\"\030ko(\352\332M/C\315\221\374\035\341\233@\337\017\006\202\227*\265\332\333\206{\232\203n\327\030O\356\"Q^\351\017\252\371\253z\340\371U\016*`\332\3020\006\312:\027\336\317\210\364\237\257\213\0071\334'U\001\323\221\002=\032j\245\245\017\207AR\336F\247e\311\004\215`\267b\252\365\271\237\r\301\222\256\036\3261\r\363\375X,`\002e\234|0\007\217\3149"
+	.ascii	"l\3714[\013vS\255\300\315,G\200"
+	.ascii	"X\303\3467\255G\001\220G\372\377\240\3729\031\245}\327%\203\243"
+	.ascii	"1\305\312\331\316w\235\023\r\221\330zC:\352*\373V=b%~\006\370"
+	.ascii	"(\300\303\314`=*\217\n"
+	.text
+	.section	.gnu.lto_detectAndSetCrashRecovery.137.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\r\b\305+"
+	.string	"JL\364\020C`\252\325\030f!\342\177\205\236H\362\257c~\006V(\022\356\030\214\nRC\307b\2035\310\326\244\354\257V\234\326\312\205s<\"\207,.\004\256C\254\262\3158\267\373\321\214r\313m\224\225M\244\224)\245\024\376"
+	.string	"\342"
+	.string	"\375"
+	.string	"J&\2104l\006\2337\034~K\215'^y*\370\227\rf\337\327\nZ\346}\227\017X\302\255Ung\356,\315\345v\327\215\337\3338\240^x\322\3367\354\001/\270\265j\324\301\265\325\264\201k\253\3542\347)zz\221\021\274\356Dq\201\276\357+\374$\355vp\b\370\363\365x;]\256\305\2617\333\252\246\357.\267\355\002\313t\";8\304\304\201Z\375\363\2355\263\266\232J\274\247\205\345\274\356\322G[M\"\276;\322\331.XQ=;\227Bx\202\n\351\263\346\2204\267\026%\247\267\232B\274\r\342\270\347V\023\210\263\317\037~{V\271-\025\360$\333\321g\315g\232"
+	.ascii	"\216\221;\2553\312\327>k.i\235P\256n5\265v\316'O\373\254\251"
+	.ascii	"\225\032\275\357\333:\227\376i\20343\177vNe\032\234j\302\354"
+	.ascii	".\355R\316\245\273\355\302\373\276\354L'U3Q37\017f62\257k\001"
+	.ascii	">gF\261\344\315\364_\211\024Q>\362\323pY\301J\027\254I\337]\232"
+	.ascii	"\245\003\326{{\301\332\237\364\354QUJ\2172\367\230&3\344f\302"
+	.ascii	"\304\025\336\314\025k\253\375JhUI\217\272\257y\232z\362|c\025"
+	.ascii	"\360ES\205\264\360\211cg\351k\314_J\377+\346\376h4\032\345?\302"
+	.ascii	"\274:'\265\316\016p\316H\275\245\033A\177u\037\265X\267Q\207"
+	.ascii	"u\033\350\256n\0016g\"\3269\310:\017\261\316@\326\371\307:\373"
+	.ascii	"Z\347\336\315\231\207s\336\331\234u\254s\216unYg\034\353\314"
+	.ascii	"\262\3167\326\331\306:\2576g\225u"
+	.string	"No\316os\366\325\271\037 \251Q\306\t\363\322\363u\276\336\251\350\240\327L=\343\204\231\233\373K\203\211\321^\270M\206\231=\263\264\312\034\203\271m\265[fN\305f\244\275W*xz\013K\314J\237\226\n\003D\307\300\231]'.\224\266\332\241\300\371\253\335)+\263[\305\275\342\315dG\263\322q\200\n2\367\352\2260#`hK_k'\310 m\356[2\027K\327\241\223{\013h]\270o\337\347@A\217\374\350\231]/\f\336L\334\177\231h\324l\371H/KN\301\261\177\313\320q\316\330\217`\3647@\267#i\370\260\177\305\266_\277\221\200\225\261\2066\343\261\333\373\276\022\270\313\372\315\006n&\2552\007\017\036\326Vm\257\204\326e\340\327o\225Q=P\320\336\227\254:\267\277:\323\352\273\032X\267i2\030\037@\200X[U_\330GTh\310\330\376\212\307\232}\371\276\311\003\351\267\025\330\033"
+	.ascii	"\316,\202\20473}\367\022\rd\246|$O\350\001E\256\004V\336M\255"
+	.ascii	"\233\300\372\317K\323jJ\2308qbm\365\377H\204P n%O\262\035*\214"
+	.ascii	"\325?\327$\314B\211\330\304t\024\272(65\025\207\001\210\307\245"
+	.ascii	"\020\306\242\321Hd\227\216-\210)T'\022\304&\246\021G\027D\243"
+	.ascii	"1\306P\347\304Dc)\255a$\312(\016\211F\024,\234\226\214\303\035"
+	.ascii	"\017\225R0\275\020\036Y\254`j\241B\350\202i\251I84:\t\225\212"
+	.ascii	"\270\370\202h\024\036\213E\243\260\375Jv\372\376\021\356\300"
+	.ascii	"\243H\240\264\344+\203OTXc\024\224j8\206\210\276\233(\211\372"
+	.ascii	"<\271\252X-J\216\016\340_q\267q$\020\2541V\372$=\332\272\311"
+	.ascii	"\201\347\027\374\241\262h\241 \360\207\200\377f\254\242\244f"
+	.ascii	"\212 \361\375\336\367<%`d\202xl\355\367\256\306\367\005\374@"
+	.ascii	"AwOeo\317\301\367\336\251\200\225\031i\250{\005\250\227^\341"
+	.ascii	"\352Bz\007_\344'\252\320\356\021<\3227\230N\247\314I\253\342"
+	.ascii	"C\354\211\237\335'e\r\220\312\362\362tv\370\350>\004\226\230"
+	.ascii	"+;\004\317\235\326{\334$n\226\273\304]\262\266\312\252\205Iy"
+	.ascii	"r\t\351\206\261\006\200\241\250a0$\225DS3\"%IR(t\300\002\021"
+	.ascii	"\241*z\021`\245d\314d$*,\007\230shV\275:\n\fP\200\317\021\266"
+	.ascii	"\247\247\361u{\250\222^\325^\237\020}a&F\361\353\272p\3658!c"
+	.ascii	"\302\350\200\021\347\250\001\3416\006\365\212T5\t\203\006\274"
+	.ascii	"\247\327\273\301Q\274\227\302\221v\217\024N\365nm\251t\301\247"
+	.ascii	"\305\347!\206\375\277\250\311\022\324\263F\331\233\001\222\025"
+	.ascii	"!0\366\300\200\225\302zC\217\253\324v\225\240(\316h\274w\204"
+	.ascii	"\363\343\n\227^a\244\261a\303\322\033\372\221\312\306Y\311\226"
+	.ascii	"=\027\313\221O+v\266\2337p\b\024\367N\341q\307\264*\004\200s"
+	.ascii	"W\304^\303\266\371r\364V\340\200\f\335\022\313$\030vh\221\216"
+	.ascii	"\030 \265\346\323\322$\336;\240\017\363\350\002\364j\230\260"
+	.ascii	"\230\n\034\021\224|\001\352\242*\223:T\304C\246\253_\254-\277"
+	.ascii	"W\233K\033\205!_\3712\006\020\177P\276V&\251\326\210\017\371"
+	.ascii	"\320\336x\005\232\2432\250\231\3778\025\300:\233q\335\262\360"
+	.ascii	"\221\312*\002\006\3422i\273Hp\374\316\001\334\002\2665\225\302"
+	.ascii	"v\"\364\017"
+	.text
+	.section	.gnu.lto_acroTrainerSign.138.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\025\t"
+	.string	"\306P>: \345*\035`\225\001D\b\236\001\017\301\210\2038&\003\351\021\026J:\270<\202\242c\252\033W\200\033f\257=\341A\020\200\245T"
+	.string	"\251\031\202\273pt\232T\260;~\262\245L)-"
+	.string	"-"
+	.string	","
+	.string	"\331\371\177]\"\346\311N\037\3510u\205\b!-)\202\257\004\025j#0\177=\275\317\224\031\360\260\273\316\323\207\272\267\333\216\260\315`\233\026\233\274\3132\017\354\322Z*\273\353\340\005\201o\266\375\326O:\233\005\302J>\316\214\365\021\223\331\335\330\271\201\346\033|\201\346\233\222\274;\324\263\230\232\210\312lgB*\204\213)gl\030)ue\037\256\252\354\273\376\314\364!\307$\005u\017e\027$"
+	.string	"\200}\331VX\266;;\035\267\207\243\370\204\342\b\343\342\223a\0217>\023\032\321#\342\210\334\201A\241\nQ\034\201@\242\270\201\355U\345T\356\231\r\277z\332\361\320\022\204\272\312\007\016"
+	.ascii	"A\bX\321\251n\b\020\252\312CE9\r\220\016a\271\206\353f\3618&"
+	.ascii	"\210\250p\005Py\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.139.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`@\020\005N"
+	.string	"\252\203\324\034Q@\022&usO\276\206^\201LZr\236\f\372\256\0018\363\204\373\272\314\031\032u\2200\224\354\276\207\\\b\235A\247\272\273\347\202\031\213\306\321\230\242\230\023\272\013\231\272\211\222+G\267\237\206\311\376\215\030\331\345\230\231\273/\363\020\2205#d7I)\245\277\001\211\001\300\001on<\rZ\321\262\273\340\027\345\203/-a\367\336\030\032J\006\355\204\201]iw\0310\013]h*\263\2209h'\274\202\251\341m\215\335{\273\005\356\027\272IO\031"
+	.ascii	"\001\332\206\201\352(\303\354\326\360Ei\304\215\335\335kF\301"
+	.ascii	"\257W6<*\334\002\277^\327486\315\356\020a\224\306\335\330\235"
+	.ascii	"\n\016\230\205\275\256\314-\267\032\013\2319\215\247}\241\327"
+	.ascii	"\343\352\250ov\367\336\242^\231\351\231\360\264G\274WL\"$\334"
+	.ascii	"\231\333\254Wh\233\005\017p\210\267y\026\202\223{\315\216\330"
+	.ascii	"\310\354\307\355]\306m\f\274\267\353\005'\367\336#&\372\365\312"
+	.ascii	"\314\334b=\3262O\r\2301c\005%\352\364\211vw\357E\036\273\310"
+	.ascii	"\366\332k\032\266\327\007\322m\013\005\001\375\034}zxvt\2149"
+	.ascii	"876\305\032\232\031\031b\f\314\360E\030\004\376|\354\332{o\271"
+	.ascii	"}(zaR\270\263\2715\0332ZH\254\203\304^p\240\265\376Ys\301\217"
+	.ascii	"-\264O\013*xOY\363\224\221\371NW\261\265\216\330\230\033\227"
+	.ascii	"t\316\022%\216s"
+	.string	"\023f\304m\302\336\212x\221H\327\364\214CzCpD\234&8\303\355i\307\245\013*\244g\202\364\216R\204\270\214\017\005\265\177\272\240aM\224~yL\217\206\001\303\332\362!\030\026\017\177\351\261\303\205::\330+R\371Q7bkJV\203a\345p`\025,\0358\374\367\323\005\325j\3373J\377\200ai9{\243\327\236qkJ\026\214\215\031\275!*?\352\032\212\323{M\377i\377T\301b\353\035\357\275\255\326~e\203\351\356Cq\357e\267\262\001m\036jf\027cf(\363p.\300\017\276\021\315i\367{\366\201\357Cs\036az\225}\377\313\242@\263}\335\333Tbf\240\353\032\370\335\333$\201C\333|\240\321z\210\007l\257\276o6\351\223\365\331\357g^\225W[g\323A\020\200\022s\004\215E\002$,\367^\022Wzn\002\356!NNl\257\353\367\264\217\240ix[dO\252\274\312~4"
+	.ascii	"\262\260\257\365\275x\312\314\036\224\364\r\245\275HV\021\037"
+	.ascii	"<\310\321p\357\275\275\217V\351\022M#\b\361\226\350~\"V\351["
+	.ascii	"\255\177U\316\350\232\336\205\277\211\330~\245g\177j1\273\206"
+	.ascii	"\216{\342\036\302I\027\336V.\330^\373\205`iu[dZU^e6c\372G\231"
+	.ascii	"\373\253\325j\225\337\213\231E;\257hj\267f\025\355\234\242\235"
+	.ascii	"\231z\255y\251Y\350\036\240\313\272O\274\263\211\237s\211\237"
+	.ascii	"\263R3\351Nj\266f$R\303\320|d\324i\315E@\347\021Bg\021\357\034"
+	.ascii	"\002\350L$t\006\001t\036\002:\013\t\235\203\336\031(\350\374"
+	.ascii	"\323\316\307\240\263\317;\367\2743\317;\357\274\263\316;\033"
+	.ascii	"\3379\347\235q\336\371\346\235m\336\271\370\3165\357L\363\316"
+	.ascii	"3\357,\363\316\304v\216ig\230w\036\276\363K;\013\3379\330\316"
+	.ascii	"\300v\376\001\235}\355\314\002\235\327w\376w\366\237s# \202\006"
+	.ascii	"\246\034\023\252\333\317\231\335\032U\274\033\267>1\322n\335"
+	.ascii	"k\335l\3350t\247\301\315\300\035&e\2232\003\017aq\302\035YW|"
+	.ascii	"\360 GgS\203\324\rGc\324L\177e\374\341w\327\331\224\2467B\221"
+	.ascii	"\262\235\315\245\335\025?Z\363^\034\301\025\031\236\266\267\224"
+	.ascii	"\006rI\271y5fn\336D"
+	.string	"\3237\334\322\347|\323\277\025\347\226\212/~\316\033\255hU\235`&\036\347U$\361\021\2408=10\266\260-\2622\232\217\316p\251V\343fZJ;\217\033'\3648c\202\240#\316\256i\3637\337\203s\202\025\337\346\327-\316;\027\201\247\315\244E\301i\264)\234\370\272\362\020Z%\255XK\326\222\261\275\026\277\337\232\005T\252\246\204e\274\376\375\331\036\230^\355r\357\255\251\371\177v\247\026\232\237\371\232w8\025\374\351N\232\357,2?\3639[\234G\210?|\231\357\025O|\026\372U=\233K\263#\016\235\331Bgv\333Q\273<\2470\335T\354\222:\3459}\341\246b\217b\274\212\333~.#\346\201P\265\273-\262'1\037\255r\033\210\274\260/<.A;j\0170+>\305\257UjrC\230\177YrF\207\307m\277\037`\276k\220\276\f\377\345\225gL@s\341\351\217\333\207\276S\261\242"
+	.ascii	"o\253\002\330^\207\217\224\226-\375\313\373\320D\250:\357\204"
+	.ascii	"\037\335\302mBX\264\364\221\257-wZ\202\037\345\024/\364\032\262"
+	.ascii	"\226\254\300\203\\\263\331\275\027"
+	.string	"\370Qv\037Rw\224\006\206Q\225<\247\254Q\257\370\253\242\026\276\362\354\206\246w\331\201\333~m\327:\2648 \201\004\330^\205\"\272\324\276~\276\367b_\221\272\241\364L\317\250S\374\225\r\275\364\035e\332lW\222p\335\313L\325j\227\346\275UA\301_z\317\342\004\013\374\002\211\352\305\322)\n)5\025\0255\365d\204\341\264\2012\271\224j\201\301S\362\305\3230J\231\\\266X&\251\222\312`\005\311\345S\362\202)e\f\030\002\226RI\245R\203\247\227eR\371K)\250\251\005\226I\252_\024\224\322\201$\f\027RN@*\250\016\234z\374\204T\001T\f\344\362\205\013(\030\026 \245\240\234\242\220OJ*$\022\016O\305H*\221\313\251)%RhV\325\275\373^\334j=\343I\317=\235\242\207\361Io\364W\337j-C\305\004\037\342\252\236\311=\241\021H\036\226\202\210\037\021B\004\362C\004\251"
+	.string	"D\364H<\t\2307\267\201x\242\"\020\317\342\340j\276\214\037\261\343\320\221\027!\022\363C>\036\355\237_\241MR\350\021zf6r!\020\f\200\305\245\036\244%\241\204\026\007\016\253\035\202^\350q\232<\363"
+	.ascii	"p\240gny\264=\330\266\n\372c\363ep\375\226\036\350q\2548\301"
+	.ascii	"`\254\344\311\361\204\350\026\b\373\363m\302\031\235\377p"
+	.string	"\257\026H\353\243\375\361\203\355\365\347;\220FQ\242U\304\202\232\333\316GuN\374\361\225gt>\177\214\272\217\026\b\227\317\177 m\343b\374(s+u\036<\345\331\321\n\261Q\312\341:Z\"FZ$H\246M\364\244\t\327\326\330]\316M\323{\261\351\355b\250\361\234\3324\375\360\250p\317)\021\331[VI\312n\274\331\\<z\2669z\356\021\217\036\351\257\372\255\201'\304\220\3439\275a\361^L\252\243\276=\2476I\337\324\006r\275\231\345\325 \372\027\375\2253\033iG\326\034\025\234\236\347y\026\357YJ\270\321\363\235C\323\357<\317\033\321t~\370;L\257\363=h8dp\332\3350\005\355\b\201O\250\201<\"\031B\206FDD$IRH\007a\005\204 '\241;\017\021 )d\214QI\223\354\254\001\266\033_:\244\204\242R\243\031\236\251\242\270\303M#\003\275W\212\250!D\373(\203\340"
+	.ascii	"\342\352E\376\244'\344v\215=i\371D_C\025T\337\\\"\271\235Yt\002"
+	.ascii	"\235/\373J\347\275t\204{\322\207\t\343\336\327\351\210b?\274"
+	.ascii	"\273@\326\372\375\230\004\263Ug\334A_H\223\251x\3733\3126\241"
+	.ascii	"\260}4[>u\230JW"
+	.string	"\"\210\213\327\262\274\305\363\202\207\214\236S>p\273\023H\237u\272N\201f\325\316\21787\247=~\253@\032{\356+w2\024\226\234\341\247TwgJ!6\f\223\264\355JrIV\206\001\377\201\360\3209\330\224\026\206\304\205\2200h1p\301\205\030\376F\264l\377\233\363M\021q\023\302\345*A:o8;\360Qx\b\320\315\f\005w\3420\261,\264\033\340 ]\b\233%\244P\3319\326W*K\347s\212L\020\206\267\215%\366\213oh\362\370C`X\026\013}\370b&\372b"
+	.ascii	"%\240\032\327\223\021_/\007|\204\013H@h^X^\025\301\007s\247\324"
+	.ascii	"6\f\233Cs\021\364\210Y\352\342\002\305C\3363\314o\177x\020/8"
+	.ascii	"\022\373\230\256\216\004B\320_\220\252hq\356\227\217P\262T\334"
+	.ascii	"A \306\036\r8v\nu\361\004\2219\302\341\236zH\264\272\023\004"
+	.ascii	"\270\201\342\345\005\206\317\003\\1\351\244\317g4f\222M\223\324"
+	.ascii	"\227\225d\206\216\225Z\f\200\025\201\206\301%\024\016a,J\275"
+	.ascii	"\f\247\031vR]\177o\360\304\270$\n\213\2466\257<\264\022d\201"
+	.ascii	"\320\036\2774\032\362\035\220%\252-\006\332?W\356\362\001\033"
+	.ascii	"}r\351\211\365\033\326HZg+@(\236\236\314\0237\203\262\220\306"
+	.ascii	"\276\247\342\267\032&\344\235\260\336O\243\227\261\365\237\327"
+	.ascii	"`\343\213\354_\004\007\225\344\030\243\303\226XD\314\002\202"
+	.ascii	"\217\004J\346\004\235\241\271\026X]\003\225\334\242\271\335>"
+	.ascii	"\354\262\352\360\327R\211\300\265\013>\037m\344\004\237\232G"
+	.ascii	"_g\234\214\225\216\204\215\027v,\204\332\274\242#!2/a\035\243"
+	.ascii	"I\311\250#\373\b5\354^\247D\020\241\354y1\0316!\321c\037\303"
+	.ascii	"h\303\204!\272?\301\331\031}\371\256\025BwP($\321f\251\275\317"
+	.ascii	"m\300\r}\345\253\t:*\r)\323^\313\2365\373\265L\005"
+	.text
+	.section	.gnu.lto_rotateVector.141.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`k\003m\027"
+	.string	"6\355\227G\300XM:\300\275S|& s|A$x\017\222c\245\033r\033T\310\302h\250\004\032\251\340\317\013\327\352\320]\221M#\351\023\002\322G\020\006Dp\260d\376\261\320\325\313\317\202"
+	.string	"\311Y\023\362\027?\222F\310\2262\245\200"
+	.string	"{"
+	.string	"~"
+	.ascii	"\357\334\340{7 \036\264s\034\rY\360=}\033\277q\034\261\327\274"
+	.ascii	"\364\231]\242\033\323n-\307\tj\247\361"
+	.string	"\336}\007\340\275\263_\303ny\347\002\337;\307l&7\"\366\207An\310\b\333\224\335ei\013\353c\355\216\031{\0275c~\352\201\216\307\"ZT\320\354\347]\224\331]\325LDL\220B3Y\306\031'\256GzWD\343\0214;\361L=\330]g\320l\350\366n\033f{\202\255+\0024\277\335\253\230\236\211i\231\230\216\211i\325\3230\232~\3214\030\323.O\267h\372\323t*\246\275\247;MGMk\2463\323\027\020\300\212\222\241\253h\262k\"\352\312>uM1\236\364+\375\270\377\366h\337~\017\337\307\227\316d\020g\247\270\267\b9$2$|JPrP\020\276$\343\362\351J.\211\203\317\346#\031|\347\3578\217\330ov\372\016\355IL\311\035q\262\273\006\0022\f\252\027\275Q\030P_V\n\252\307\301\345S\033my\323S\372\325hJ\243\315\377\0013\356\203\341{\311{\347\351\205R"
+	.string	"\251\215v\372\220F\274\205x\252Q\037\032\321\250*X\204FdD\026\240\324\232\274\235\274\225\246\2026\032\220\220\226\363+\215~I\330$\313(\037\370J\257g:\005\033\r\027\322d\031\245\272\273?\252Ev\355'\277Jd?\351\306\371\321\177\363\332os\245\273\346\270;\n.\264t\301\205\226Z"
+	.ascii	"\301\323\023[\357q\265`:0\327\353\373\360\035\036\037\017\003"
+	.ascii	"4\274t>\357 \300\320\362a\3016hhq\310\300\352i\351t`\355\274"
+	.ascii	"<\260\020\334\330\345\303\363b\301\\\256\027\013\254\355\277"
+	.ascii	"J\244\343/\321\202\310\023\220\312:-r*\210^\025*\r|\245B9H'\360"
+	.ascii	"\004\307\342\b*DVy\334\335\215\306\201Ux!\205\n\212\031\205q"
+	.ascii	"\361\240'2\352\2423\232\266P\206\2472\252\262\321\214\204F1\352"
+	.ascii	")\216\036KHS\251\213\306h\214\022\032\005A\250\021\360\250#L"
+	.ascii	"\221\tl(\210\244\205\205s\240\002\221\253\342\006\020Xfb\232"
+	.ascii	"\016\":\332:N \177\273\211K^\336\357\374\3360\267\253KP\215."
+	.ascii	"\214/\265^\003)\312{=\277\307Q\314\017U>\257*c9d\270\225\331"
+	.ascii	"\024\n\016\031\317\3437\314\314\244\236\204\022\300T\262\035"
+	.ascii	"W\030\004\024\215m\003\253\031\265k\326W\003EW\321\264\007\030"
+	.ascii	"J\300\231x\311\370h\272x\342\030\275^\376-\274r\303zf\330\212"
+	.ascii	"\b\316\233\f\375\003"
+	.text
+	.section	.gnu.lto_rotateItermAndAxisError.142.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\212\007U)"
+	.string	"\232F|\017Fp\336M:\343\2130\234\242e\255=K\0236\377\303\237\013\326\3508L\276\245\335\306\233\365vQ\310\033S\226\242>16?\370UC$\300\024\313\026Q\222\265G\234\267u\375\263\266\365G\372\3264\335\032![\356$\003\352"
+	.string	"\324"
+	.string	"\345"
+	.string	"\271\233\254v\337ys\367\242\363f\243V\314t\004d\335\253\007b\336n\220\365\271\367\376zI\217\307}{<\343\254\325\213"
+	.ascii	"\020\365\206\204x;#4H\227\303\235\246\355j\305\3075\331bZg\270"
+	.ascii	"u\365\"/\"\223\003HOd{_\266\001\262H\355)!\032?\204|N\217\322"
+	.ascii	"x\307\213h\274\220\355u\331\006^\206T\036\256I\t\221\310w\027"
+	.ascii	"\022\271\221UJ\301*Z\300\213(\344AB\254o\r\211\234\353\354R\025"
+	.ascii	"?d\316\246\005\304\036\225e\245\037{\201(ZAj\316\366\330\264"
+	.ascii	"~\330\006f6*\016\212\217\237\270&\263_(\032\313\f\267|\334\264"
+	.ascii	"\t\272\322p\235M\213\211\365Y{\324\225\206Kh\253\206]ZC\"\007"
+	.ascii	"\335\312\252-\264\205e\225\356\275\267\362\252c+\253V\\\323\275"
+	.ascii	"\227\353p\213x\366\235\371S\230\271\002\363\231\025\201\370\354"
+	.ascii	"\352\rWw\221g\234\357\023bpjT?\314\354\342i3r\367^\b|0\017\023"
+	.ascii	"\344\203\335\344\030S\365\303\233\374\251\363\346\033\304\027"
+	.ascii	"\240\2670a]2\037\257j\027\231\177.,\344\027w\022\346$\244\243"
+	.ascii	"\213}9\363\216v\336\275\354\214\332\312A\266\262\316\254\234"
+	.ascii	"\263\225q\266\362i+\233\266\2625+\267\255\\\273\362\225|L\300"
+	.ascii	"\210/R\346\336\036\313?W\315Ls\362/?\332\337\345/\373\263\374"
+	.ascii	"b?\231\217\264\227\213\005\245\361\t\032\337\013\025\345\220"
+	.ascii	"3F\273\350\300\224B(\220\361\315\030-c\345s\030\225\303\246\334"
+	.ascii	"\257\360\217\037cT\313\267X]\214F]\223\242\304a\347\336\373 "
+	.ascii	"wS\311\362\261<\314\352Y\252~\2117\367G\231\303\316\275ZL7\031"
+	.ascii	"A\306{\205t^\247\312\203S\375\320\351\f!\242~\310wK\213\250e"
+	.ascii	"\365\025\322"
+	.string	"\354\217\233\240.\242y\256k\2238\271~\360\225g\017\230\016\327RmopvMjV%,\327EF\317\234Im\246&\323\321\326\261\340hW%\2678\005G;\251\003\024\215elt\235}\344$R[\317\031\342\361\265\331g\237d+\336\206\223\f\214\367\336\b\314#\316\246j\251m\355l%L<=\2357\315\276\331M*)\331[\232\260.\273\357\275Wg\027\317\003\320\016#\367\262\204\345\222O\215{\205\006l\373\272\316\261\021\005\353j\276\206\223(\030\311\310\376\330\315!\351X\225\037\367\336kv\221\035\034\352\354\256\251\230\333\315\374\f\024\037\214\243\200\300\376\271\375\020\326\345\t\200\035Im\222\231\253\201\332*\304\326\2608\031N*k\223\370\n2\016<T\213\250\027\023\202\037\202R3\242\320\251\024O\035^\004\201TOTA\251\035\243`\220\002\b\343G\265\"\n\330B\305\357\005\360\311\305\017\205\324\324\217\201"
+	.ascii	"\016\302\200\222\372Q\005\203R?\364xo\345\317\221\242Q\0236V"
+	.ascii	"\321\330\001T\331{\275$\274\313\355l\251K\242\241\2436\341\b"
+	.ascii	"1\235\307\353\361\372\250\213\212\251YP/99\240-P\006$#\240\346"
+	.ascii	"\024\271\240>\362&1\035\363\2266\204\366\243\023\001\264\237"
+	.ascii	"9\r0\236\235\310-\315r\354\"\353\316\354\220\332\204c\304\364"
+	.ascii	"\335\256\037\250\362v\215\324E\305\2577\272>\343\244\317X\367"
+	.ascii	"\f\361\b1\234\017'\227\214\314*\276'CR\204<\327\243a\003\007"
+	.ascii	"\016\347M]\337\313M\256\024\371\026\366]\027\371\347\343\275"
+	.ascii	"\327\250\223\210\371\273\267\214\211\303G\003\324\223\375\350"
+	.ascii	"t\240mx\262\333q\032\020\200\244\250a0\245\224S\b\221\214\004"
+	.ascii	"#MRH\007\220\002\021\261*\333\021\200\251UE$I\2410\035\"\202"
+	.ascii	"N\326\336t]IZa\033e\210#D\236\235\266\255\2558l\277G$\275\033"
+	.ascii	"\034\347V\372G\364dpH\352QO\224Q\304(\343\256U\bB\202ONi\330"
+	.ascii	"\204T\264\315\242\246\204\261\341\244\315V\020\246\2570\260\213"
+	.ascii	"\355\177.\215\307\326\310\277k\r\277a\203\330z\247\203\237\034"
+	.ascii	"\223;DCG-\0136/\345\021bG\021\337_\252L\f\237\304\351\337N\""
+	.ascii	"\222D\341Y\242\201\031\201\222\343\3503\022\235H`dK\003\261\247"
+	.ascii	"\320\260\232\034\241A\035\"\314#\316\327\354\fuD\367\250b\356"
+	.ascii	"i\201>\005 I\0253\331\225\254:\267,B\303D\267c\263\261.\307\305"
+	.ascii	"b\223f\025\247\207,\275[\333*\177\203\3403\250\357\341\031U\235"
+	.ascii	"\331O\207\252\317\365\334\272\270\260\303\253|\347\316\242t\350"
+	.ascii	"\311\360\214\177^\316z[c\307$\210\234\024G\320\025\373w\002\b"
+	.ascii	"8T^S\300\233\t?\361\220\366\342!\f\274#\206\227\360\263\021\311"
+	.ascii	"\n\346OQKS\344vH\204\346/j\260X\025U\247\211\250,\336,\024\370"
+	.ascii	"\366\313\260\337\272\367\007"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.143.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`K\002=\023"
+	.string	"\266d\200H\300\322Q:\243\002\n!\r\345D<"
+	.string	"\017h\202n@\206\26666T\3123hp\020\305RL\rB\242\016\364\226B\005sws\312oK\277,v\033\202\240\300D\273\305bKJ\356\243A \315\240\377\0366B\366\226;\245k"
+	.string	"d"
+	.string	"m"
+	.string	"[\342\210\306\356\226\370"
+	.ascii	"\352\323\266\357\342/lvO\362P\360\0240b\221\033j\332]\026\311"
+	.ascii	"E\276O\371\001\337\247\236\270\355\3407\245F\233\017\236L\220"
+	.ascii	"I\221\244\333\335\016\242l\376\205\354r\222dwg\342\034q\251\332"
+	.ascii	"\341\242\312\0047G\"Bv2Rd\311\004\323\205\036iv11\202'\273\353"
+	.ascii	"\250\333\325\334\250\333\266\331>\261\343\006\272\227\357\363"
+	.ascii	"\nA\007\207\023\t\230\030\332\274[\324\034\373\032\206\241\223"
+	.ascii	"\025\307>\320\277R\235\367\247\036t\243\276hpF\1772z\306h\251"
+	.ascii	"\321\372\350\250\321\027 \342\363\241\346;\275\335\020a\220U"
+	.ascii	"\232E*\036\364\333\027\262\312v\220{\337\232\215JLF-z\354\256"
+	.ascii	"\202OG\210<\367n4-x<\220\215\f`\003I?@\346\247\266K\336\303\320"
+	.ascii	" \307\356:\360e|F\006\237\347\323-\227K\347c\352\247 \217\334"
+	.ascii	"\323*J\265W`\337uSIpz\263{'Z;\004\267\013c \245RG\206fV\304\304"
+	.ascii	"\360\017l\200\200\220\b\336\362\251v \342\240*\323A\372y\217"
+	.ascii	"\356\006I5\307+\215\232\"\244\003\027\177\370\032\365\271\247"
+	.ascii	"\017\035F\213\317\343\330K|\265\327L[5\226\227\204\232\013,&"
+	.ascii	"\253\275(\250\300d\001h0\017-i\227\211\nL\306\252mX\201\261h"
+	.ascii	"`\271\300Z-,\327\214\3062\031qL\366\232\261j\261\330\214\305"
+	.ascii	"\333+\216-?\225\256b\330\350\231)E)\215m\224~i\307G\tFc\344\356"
+	.ascii	".H \246t\245v\005\013\361:\225N\275\205a\370\364\321>PS\204v"
+	.ascii	"\324x\021\355\002\n\312\367\t*\003\235+ \220\002!A\363\373\t"
+	.ascii	"\214\306<\257(m\001\037\276\232\375O3>\220d1d( \207\363\277N"
+	.ascii	"\336\337\032\276\306\335\276mA2\256\325\375\264}\203\344\272"
+	.ascii	"\314\310\200\fJR\021v\331)B\332\320\237\373\355\260)4v\003\204"
+	.ascii	"\203\307\245\006\001\031\026\016M\001\347h0\316\205!\353r\216"
+	.ascii	"qE1\252\016\n\005"
+	.text
+	.section	.gnu.lto_applyAbsoluteControl.144.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`x\r\025C"
+	.ascii	"\252s0\031<0\246N\007\344\360p\273\313;U\376@k\361\214\274\277"
+	.ascii	"H\004og\314\330o\270A\260\034\235]h\242\037\016E\2727P\217t]"
+	.ascii	"\344\243\302\273-\263\310\375L(7\021![\356\224R\n\210\001V\001"
+	.ascii	"\206\001\227\332@\227*\327{\272\371t\327\351\276\323\235\327"
+	.ascii	"=\355\316\323C\346\006\354\271h^_\373\021i?\234$\212\307G\"\314"
+	.ascii	"G=\334{\315\307G>\205sR\366\024\332\263\324K\232\016\267\235"
+	.ascii	"\306k\275\306\323T>\346a\204d*\b$\217\247\201.\3555z\004v\347"
+	.ascii	"\310\332\322\351\271=Gs6\210u\216t\373\244uAe\366*=j\333\326"
+	.ascii	"A_\226A\354\373Gf9~L\374\233\276k6\034\326"
+	.string	"KB\265gwY\360\264\255\035\027W\260#\272\335\221>\231\036\020\373r;s\263\3516\315\256C\302\305\266\335\362\207\247m\317\270X\001\261oVW\261}\327\236b\373r\223\271Q\022\255-\243\260\027\230\026\247R\333\266\312\377\322\315N^YUQMIEA=!\235\232\216\306\"q\310\336\365\275\311=\247\213jme\235D\323WM\225s+iWI\351\330\3048\225\264/\316\247\242-\025\355\013\343Qp\r\005\006\020\316\237\2624rm0\210\355\255\375\262\270\323\232\325\327Z\203\330\244X\274i\350u\264\322\306*T+^\324\332\362\344J\023\257\360\265\026\035\233\233\017\2474\273n\t\342\302\b\331\366\\\261\370\322\374\366 6*kV\333\266\30764_\327\006o\177Q\232\332Z\203\330\320\254U\202\2700:\266\235\371\257[i\n\371 \333\234+\226\034\2640=\247}\255\355\314}\350\325\266-\273Z\333\223f"
+	.string	"\315\334r\230\271\r\36310\3533\267x\341\255\226\341\263\320\276\214\271\005\201l%Rk\322\214`l"
+	.ascii	"\323\266-\006E\275H\306\f\0324\276\325\244t\242&[\307q\263\036"
+	.ascii	"\333\367\277\251\355\302\220\024\321Z\0255Y\"\271\255\017\345"
+	.ascii	"\t]\203\365\357Lw\201]\250\r\325\340\216\343\033\313%\333\327"
+	.ascii	"\277\013\316\315\314\253\355\321\351\236\334?\224\247\314\354"
+	.ascii	"\007\372q\334\3759\363Bf\376jA<%\266mk\201\033P\007\002\343\216"
+	.ascii	"\353\313;\302\274\325\302\330\276\3751\302L\"\2543\363*\263\235"
+	.ascii	"\323\037\312\334_\255V1\361w\3516q\235I\\g\021 zO\363\207\346"
+	.ascii	"\323\354\345\241\355\272;t\235f\016}\247yCO\2335t\236\346\f]"
+	.ascii	"\327\215\241\341t_\270\316\022\"t^3\004\243\263\262\350\334u"
+	.ascii	"\235\271\256\363\003\326\331\201\321\271A\321\231\301u^`tVPt"
+	.ascii	"Np\235\267Xg\004\327\371\300u6p\235\265\256s\326u.p\235\t\\\347"
+	.ascii	"\001\327Y\300u\016p\235\261\2563\200\353\234\274\316W\327\331"
+	.ascii	"\212\350\\u\235\251\256\363\324u\226\272\316Q\327\031\352:?]"
+	.ascii	"g\344uv\272\316MD\347#\321\331Ht.^g\342u\036^g\366:\337\241\363"
+	.ascii	"z\235\237u\366\353\334*\252\026\305=i)_\333:\251\006\205Q\274"
+	.ascii	";Dv\006\237\254>\300G=\373S\222\023Q\037\244;\344C9\200_\273"
+	.ascii	"\233\224\2708?B\177\260>\371\001\3761=\337\"<\200\307r'\200o"
+	.ascii	"<873/\3636\371\025\002\251V\177\365\375\0344\363j\233\316\204"
+	.ascii	"\311\352\273\257\327LQ<\302:\247u\b\241\257\330\201\364\347\350"
+	.ascii	"\341\233\257\373\315\016$)\021\304G\3705H]\225\345\314\037Bx"
+	.ascii	"\253U}\007J\307\004r~\031\225\246\207\262\0339\274Saq\303K\350"
+	.ascii	"\360\022\336\303\177\336s\316\351\325\365\370P7~\027\256\301"
+	.ascii	"\2773E\252\237z\020\377\202\205#X\217\352)\300\2715\375\324?"
+	.ascii	"\031B\303\367\034d\2759\227\016\021\037\312F@\224\330\017O\300"
+	.ascii	"\016\240?\327\353!\374"
+	.string	"\0323\263\324C\375iz\251\277\200O\017\365\236\007\341\221\377\364\375\244sv%\236\226`=\344\267\224(\034B7\263\341C\231\377\374<\331\260\337\305\351{\313\335\237\3277\275\323\377\244'\335$\236\022\271#\265\244\023(T\250`\3736}\323\205\311\224\206j\366\341\257\234\337s\316\353\233\257W@\345\370\236s\215\305\t!\336\3551\366\370\314;E\306_\343\244\271mx\343_Ciu\035\236\303\027\377\030Gn\232\246f\370\031\236\303_\271\273\347\234s\370\033\336\234\323\346\365\254m\315\016h\370\341_\305\221V\237tN\2572\373\032\336\005\237\2252\374}\366\207\202\3179\347}+\250\324Q\322\377\003\314\243+\b\017\262\245\230\322\307\230\230\330\330\027V\004\tM:~\244\320\361\303D\220\343\327\362\370\265,\262\024\333\301~-}\204\211\355`\231cL\346\b1&\030Y\030\222\314G\330\330\0172\260\0279\302X\220\371"
+	.string	"c2\205|I\201\221-]\2141\215\354 \006\t+\262\\\371\253+G\330\017%\031\217\035a=t(}\204-\305\224_\314 \312\256$\217\375"
+	.string	"c*\311\306\306\230\312\243\235Y\177\2279\335K\244~\201\314\336\311kR\371a\232b*$\202\353z\345\017\271\272\036<\327\01719\324\273<\240\262\"FlP\256\036z\250\035\374\020\337\342\340\233\332\353\243\350\036a\025\253\006\317\314]\256\245)\306C\026\006\337\340\223\206\0260X\360ILO,\2773\264\252\207\262\202K\005\344B\325HX\f\177\315\376\252S\n\2504\305t"
+	.ascii	"\343S\334\255)\327\034\323$\323$\2436\230\340\025|R0-\323\226"
+	.ascii	"o=s\363L3\r\333j\t>\353\354\313\264\020I\374\026\211\271\350"
+	.ascii	"\324\211H\016\235\263\202\031%K\244\240\210\337\200n\350\034"
+	.ascii	"=\rx\022\277&\241k\260\b\276\275\370\023\004_$:M\343v\340\r\374"
+	.ascii	"\201\177\301$\215\f\374M\263h"
+	.string	"\255\212\326#\023\265\332 \211\317z\255_\363\236oY\257&\252\347Dt\247J\224\200/\360D\250\207\362\214C\310\250o\277.j\351\323s\272z\021\277V\340\007|\003\212x\002_\340o\234'\235\363\313\231\254\021\370\236\006\326\t\370\001k|\211+\021\360\204u\"\376\311\323+0h\001\201\t\250a$\t\221B\206dHDD\222$I\007Q\005\304 \t-\343\001\021@%T\216\315H\223\244\3160\006\030\217\n=r<\377'\327\264m\2273*N2\037\260&\222\202Lf\311\274\320f\275\3014\303O\262v9\253\222\223w\335\213\b\005\016)\207W\323E\215\2047)MN\016l}x\363`\220\201\017\003\336\017i\201\347;\230\361\377D\205\351\250\372t\305\262M\217\315\204\202\\\034L\366\026r@\217@\264\220\266\224V\377\230\021\352RVH\022\211\016\245\200\321b\277=?\363c`\353\005d\233\217\225\270\033"
+	.string	"\357\301\225'*[B\377\336\2202\255\256\221[\334\005%p9\352\215\013\261aa\233cl\f\301\265\305\\\213U\013\2151\226[b,&/X\255\200r\211}\016\303\201\353\323\002\037\335\035\242!\006k\263\230\032\200Z\226\377\337#\020G6h-\304\330\263hh\314\257\271\245j\2237YC\352\304\206\036v\025c\3641_\335\210\035L\3728\247\305o\343\314\006(\342I\330\270@\332m\367/f\305\371\340\363\002\006\257\225\234+\2540\306=g\204:\266\031\2463%"
+	.ascii	"\256\206\315|<!Dx\203m\220\343\\w\023~\033\263q\260]\272\375"
+	.ascii	"\376h\233z^\3705\353\310\253\265\320\306o\357;\201\023\017\376"
+	.ascii	"o\3504\325\225\314\261\007\250\301\025\006\350\211a\205"
+	.ascii	"l\242\020mHJ\206\272\353\024N\361\213\226\374\342\037\225\026"
+	.ascii	"\204\360\024T\033o\023-\352\265\"2h\346\352\263\2344<\215R\251"
+	.ascii	">\002\277\304L\355 5\370lc\003B\342#\332\207D\201\202e\\,\234"
+	.ascii	"\341\216\341~\361\335[V(\363<\241\2163\f &\\\272\r\375HB\236"
+	.ascii	"\222\266\202\004\224@\177\330\301F$\244\347\326\275:\372\357"
+	.ascii	"\t\007-O\r \233\242\243\004t\266\025\321\202\277\226\221\322"
+	.ascii	"++\333m\021Muo\351\270p\3472\001\036\224\360\016'\021N\022\023"
+	.ascii	"\201\020\354Q\214e5"
+	.text
+	.section	.gnu.lto_applyItermRelax.145.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\271\t\3452"
+	.string	"zW8\023AP\246N\007\027\264\241\236zf\335o\n`\2144\216\225\366\355\221\200\371\377\013>\024;\003\013\3316b\221\020\031\355\215\330\344\364\023Q\302\2207Z\251.\017\035\013\026\003\031a\366\326\2156\331[\246\224R%\001\003\001+\001}\315\272\350\335{\253\032\345\022\f\307\207\341\305\364\230d\223a\271N\272\367\354\314\334\275o\006\330\301\233\332\3054\314\r\342u;gumz\n\374\355\206\033>+\265Qng\356.\355%\331n8\030x\257\023\347\334\275J\003L\2456\n\325\306\264Q\333\305\264QN2\3779\206]\257\005uZt\214)t\357\275z(\235l\247\246#\323\222Q\251HLB:\032\032\025\t\203@\365\227\242\366=\311\375\223"
+	.string	"\\\313\274\332iK7\265\365\261M\2133\251\365\222Z\0257Ri%*i^lCsb\200$$[@O\315\240\276[J\261F\262*k\263-\243\370Q;1\233\322C[\200\2115.q#\266\345\024/R\302\266L\342\302\376B\322A$@$F\\e[\036\361\237u\272[\026\261S:<m\271\016p\267lCm\201%r\202\f\313\302\254\321\316\223>\326N\331y\322gX\246\264NK\344\004\021\226\211\371\337-\267X\250{o\307\265\217\225\201\271\377$\334{\331\3272\263f"
+	.ascii	"\315\334w\230\231\006\263\n\"n\366\245\336\343\304\nE\375\277"
+	.ascii	"\375_\234\330\032\330\177\221\311E\317\030\222\367\3733\237H"
+	.ascii	"\341\275F=T\330{1\267\233\031O{V\267\256\313z\020\345\336\333"
+	.ascii	"\200\256\333\260\340Ns\341\2756\312\355\"m\324\277\327!\315F"
+	.ascii	"\002;\3254n\226K\033\355\317\2016\247\251\007\315\221/\1772\277"
+	.ascii	"y\3713\231\373\237\317\347\223\377\214\271\303t\023h2\335T\375"
+	.ascii	"\326=\300:O\365\\\263\200>\323,\325i\232\243\332\255\033\252"
+	.ascii	"\341\272\237\200\316G\325\231\351\347\274d\235\215\252\263\322"
+	.ascii	"\317\271h\235\211\252s\322\317\031)u>\262\316C\353ld\235\213"
+	.ascii	"\254\2630u\016Zg\240uV\255\363\317:\247\2513j\235\255u~\324\331"
+	.ascii	"\255s'h5=\262\037f\315\245\356^\262\347\241[\007]\243\326s\335"
+	.ascii	"g\272\323\3643;\271\325\314\261\023\351\253\311\265\022\242W"
+	.ascii	"\0077\243\345\230\205\215v\243\3518\026\246\271a/\\\257\325q"
+	.ascii	"Y\323:s#bk`O;\236|Ht:\370\350\236\335\227f\036\333\001\001\203"
+	.ascii	"wT\364J{z\335\233z\341\027\275\215\023c\003\363\247\360\203\314"
+	.ascii	".\204\306\020\274Q\0313\304J\203\337n\315<\017\255\207\005(\370"
+	.ascii	"\035\004-\017_\377`\003h\212QU\037\377h\317N\255\311\207\351"
+	.ascii	"\370`B\246\350\231\354jU;\260\252\037\254|U\202V}\3741;\215>"
+	.ascii	"\372e\247\326\024>\223\273yn\217\210\227\340\237\001\277\350"
+	.ascii	"\256i\007\374&\2741\324\001\231\225*\300\277\263\2754\302\343"
+	.ascii	"\216\252~\3675\345(\275/\271\306N5M}K7\326zI\262\004\371=s\300"
+	.ascii	"\267\\{!!{`\004\335\261sJ\t\370\251\207@'6\350\367\354lv\345"
+	.ascii	"\275_R\002\276\n/}\251\377\375\001:18`\f\242\361\330\211'\375"
+	.ascii	"V\323\031\016\241\341i\267#_|\244\266\310\315\371N\235\037D\250"
+	.ascii	"\367\237f\236\322\373\232H\030\331\232}f\343H\241\376\303\314"
+	.ascii	"y6\347(\275\257\277\261R\364Q4\371(\275\217\231C\264\035\026"
+	.ascii	"\003n9=g\004\211\022\336k\211\264Q\364E\240\321i\013(L\370\n"
+	.ascii	".\r+\270,\310\020v\305\320\332\342\352\312\002\241B\253CW\214"
+	.ascii	",$rF\n\"r\013\211\2440\314\352:\361a\013i\203\205\n\003\231\325"
+	.ascii	"\245\205\312\320\252q\302r\212\003*\264\270\256\272Z\260\320"
+	.ascii	"z\261\342*\206\326\t\030W)\2202\256\016\034y\213+\013y\325\265"
+	.ascii	"\265\205\274\022\276\335\3763\006\252\005\252\363\365`l\235\006"
+	.ascii	"8\325?=\201\207z\346\344\225d\026\357\225;\256\223\314\250\305"
+	.ascii	"\251\243\343\275\374\336\353\325\304\344\253\367\030\363f\272"
+	.ascii	"t\351\231\214K\306?\"\032;\362u\244\363\204I\311\200\213\205"
+	.ascii	"\025_\211X|(\245\263\341\206SO\374#\242\245gr\037\352\243G\327"
+	.ascii	"\330=\215I\317\314V\356\225l\213\300\375\364\233\344\222\364"
+	.ascii	"\222\374\222\374\262\356}\322\037\361t$zr\251g\236@!\355\025"
+	.ascii	"\351S&M\224\357\325PS\004\275Qz&Uc\245G\337X\232y}m\b\213;\215"
+	.ascii	"+\\\270\2206z\364\275D\003\324V\244L\221P3\217\370L34?Z\nEX\301"
+	.ascii	"\364I\032\332\270u\317\311\245\336\350\2317p\360^\207\004>\352"
+	.ascii	"\215\236\210\347\245L\200\307\250\2010\345\020Sj\206FR\220\024"
+	.ascii	"\244\320\030\220\002\221\251\252z\020@\247\206&I\322\001\177"
+	.ascii	"\201\344v%T\261ul\314\206na\0327\362G\330\036k\262UG\203\262"
+	.ascii	"\2665'\020\341\213;\331\0131\022\375.a;\205\032,8\357\321\302"
+	.ascii	"\343hL\254T*\rV\220\254m\025J\371%0\354DJ\t\021g\304c\374DA\277"
+	.ascii	"\005\2224\013\002\007\006|\222\262Q\204%\204\235\260\374p\260"
+	.ascii	"o\302\277w\305\351\003\001tK\261\221*\331\312u\374\250e\237\321"
+	.ascii	"\003]\344\3377\332T\3740\370\013\277\214N\006\027q\320\204d\200"
+	.ascii	"\b\"\022\2034\272\017\001*\006\310\\7O\305\351\262\253\222\023"
+	.ascii	"\310\t\265\354u\024K\"\233\345Y)\205/\215\223\n\267 j\245\356"
+	.ascii	"\221.f\260\302\026\337\352\353\b\035\271\001\273\326HyA\345x"
+	.ascii	"\275\021\267\306\276v)1\201\n[*\354\206\223\210\202\027-\007"
+	.ascii	"o\276\003\013\304a\212ADP\327\370/Is\314b\271tMP\326\023\322"
+	.ascii	"\314\343\267p\034K\304\311n\312\363\255\230+\264\256\177I\326"
+	.ascii	"^\300\205\007\357\231\205\031\270W\267\0234\377g/\234\2136}^"
+	.ascii	"n\236\007\005\001xc\202Z:\334(\020\370\rDW/\271\3108\374\230"
+	.ascii	"_\351\314FM\277V\364Q\327\344\244\3328\370I}P\024\343\003%h."
+	.ascii	"\373\271w1\257\037\270\006\370\232B\267l\301v\246\322\365g`~"
+	.ascii	"\307\f\202\230\206\023\365\313|\032\341\373\003"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.146.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\255\n"
+	.string	"\266\324KA \251*\035"
+	.string	"7\201N\b\033\261\341\203s\231f\177o\230)@-\003>\233\023\024\317\211\204\336\2425&\020AII\264H%[\026"
+	.string	""
+	.string	"\023\220\374mr\362\210o\223:\354\233\2443\021M\366\336;\245:"
+	.string	"6"
+	.string	"6"
+	.string	"\020\036[\331\013\203[\n\201\204\335\365\246\353\341\351\224\241\317 \226N;\224O:\301J\231\340 \236(\306A-u\330e\211\210\222RA\263\273\226*qu\327\333\316\260}a\377!\273\236,\373\257\237^\372\234\204\313duX\204\335\223\361\266\265\252@\200\305\366\245}\002/\020\376e\232\027v\033\314\022\354\256\205+\272W\314#\270Wz\b\356\325\241\035s\266L\263-)>9d\017P\322f{t\231i\335\356b\370\006~`\304\017\360j\022\222\274\352\325'q\257\237\207\235."
+	.string	"0\016x\231\344h\307Nr\266\354\323\335 G\324\351h\200\037\316\367\2156\r\336d:<!\017\374\360\360\200t\274\217g#\304\333|\"/s1(\304\371<\020\004\372<K\314\364\311\262\3064O\264\223t\332\"\"y\225\351,\335\2462\316\002\r"
+	.ascii	"2\003\3269\004\353\245;\354%\264U,H<p7\016L\271\004\333\254\246"
+	.ascii	"\210\273\334T{40\265\007"
+	.text
+	.section	.gnu.lto_pidGetAirmodeThrottleOffset.147.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\r\007"
+	.string	"rM14Po\322\001 ;\313\202\2516>\034\037r@;R3\024\256L\257\016\305\255\371z\\\026\201x\006\310Ge\366\252F\022\3247\227F\232\312q K\366\2262\245\336h\030*\016\354@<T\021\016p\242Z\220\200\233\213\002j\nlq\032.\330\261\254\013R\332\336\255\216R3 \305\260]\361\022\227"
+	.string	"v\027\301'\271f\341g\177\276\360\344\261?\3373\375\245\006\214\200r\263\265O*\207}\267:\262\237N% e\242\243l\273\032\333\313\262<\225\017\333\321\246|\220\207D\273\3444\217\314`e#\303\304ewa\346\003\323\237\273\300\364\247\035\217\317\350_\344\n-)'X\350\363\304$\354\256\023\013\211n\375\201mR\t"
+	.ascii	"2\241]\037\370\354\020\240k\270p\210\02136qW\244\331\360\256"
+	.ascii	"{\003"
+	.text
+	.section	.gnu.lto_applyLaunchControl.148.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`c\005\005\""
+	.string	"\346\375\326D\200^Q:\361\003\252@\306\036\260\325y\212\361\277|K\204\031\215\204\314whzX]\037C\2374\277aB\300\027\333\312\0270V\332\301A\243\374LF\332\032\364"
+	.string	"h\032\324\201f\324\257\366K>\331D\356\224\002\306"
+	.string	"\255"
+	.string	"\312"
+	.string	"U\302\251/\314i\177\352a\222.\306\307-@\355Q\005\271\252u\252\310\023\246J\177^\312k\034\2535\n\232\253Zk\221!\224\247\266\375/\007\223d[}XZ\n\203\201\330\205)(\250\326\212[p\033y:\236"
+	.string	"y\272T\236\364\231,V\302H:\356L\362a\033\202\367\260dU\346\327\364\3433\006Q\234\236.\033#x\251\001t\233\020,\277\017\227\314\330\326\020%f\236f9\022=`\260eH\222\t[Pke\232\344\207g\2605\344\3117\251\221\217\243m\216\224\256Z\323\322\030\301\311\233\"\263\246\336\334\261\302\222 &\265&\245\221\366\305T\347\301O M\2759a\033j\255\236\277&\247\233v\333zl\227\260i\202W4\312Z\353\005?\315\255l\370P\247>\3121\377\313A\236~\213\254H\361f\361I\262\204\221\263\013\364\204\017\330\345qI\241\302\323\233_\366\224\322\\\240\375-\026\213E\357\024\233\350\302\373\366\252\373\300\305\374\006l\227\372\007"
+	.ascii	"\370\230\273F\247\207\3504\355\3233:-\243\323\261O\227\237\206"
+	.ascii	"\221\323\344\247)9=\216\323K\247\3478\375\004\006\244\240\234"
+	.ascii	".\314\252UH\221P\325\242XY.\374\253\3761_\373\366\317\370C\317"
+	.ascii	"\204u\210q<\334\214g\247U=\346p!\0223\234\214=\233v\222\037\364"
+	.ascii	"\314\366\030[\275:\325\251\325E\374\342Uk\260:\">\254Rk\017\203"
+	.ascii	"M\342tJ\224\265\366.l\2318\361\340\035(\037\344)\271\037Z\301"
+	.ascii	"\032\227\356\231\n\361f\261\350Z),"
+	.string	"\334\251\265b\260U\\\316\n\nw\340<\016\213\026.\\\354\315\234bAu\r\302\342\315\242+\\\201\022U.\220\266E\025\2477\277\246\263\226\204h\201-\3204\3105:\261\315R.P]]\216\345\347D\213\\\240O\346\017\"T\202e\264\355\220\020\211\324\332\252Am\201<\370\006<.:#\255\n\320\033Z\233\007\3400\313\267\305\201l\207\226\004d\253{\254\225\327`\256l=}~\224f\321\2659`\355\234\214\371\337\334\223y\201AQD\264z\373\303\363\017\221,7\343O\203\374\276\017U\036\353\036FH5r\035d\034\220n\344v\273\035/hH\271\335\332\320\355P\344j\310\270a\024\323\241\343a4\372\005\005\030:\0348\244\0312t5b\340n\350\214l\340^\354t\340(\334|\204#\267\303!\035\035\355p\263)\336\307\n\253\255c\265\365Hk/\"|\222*?\374\221\b\233\004\221\021\255G\262\266"
+	.string	"\026\210m"
+	.ascii	"\002\346D\361\321\342\255\322L\301\254-y[\033D\210\371\037\321"
+	.ascii	"\342\216xaR\223\354\217\022\214P\212l\201\356\361'\345m)\217"
+	.ascii	"\253x\333\017"
+	.string	"?\002\210&\220O\213\022\0026W\304\330\002}`i\273\243\2023[\332\356\032\237\327\356l\t\330A\2235\344\212z\242\241X\374\212\355\201\235{|[\312\215-Q\320\347\005[\272\345\302\202>-\344\006j\250q8\003\225q\306dDDa\222V\306`\002\231:\233\007\020hF4M\2419n\"@Skh\203\344\262\234\355\0300S\347\f\204I\"\006MV+;\207\003g]ga\234\320\274\013\027/\206\201y\201p\335\\G\221>\260\n\t\021t\361\024\242i\003\261\332B\326\034\220=\261F\335\221)h\201L\217\211\003V);\207\324\305\231Ch\221\301\364<\177v'V\3054M\212i\376`M\361\323\f\261\257\017\374\236/D\330\260\331\205\345\2713\253{ G\234\bS\260(\372\251Q\360\247P|\301\"\220\021\226\316\252\273\337\rMD\270s\261D\207#V\001\2273\256}\373\2221k*N\177z"
+	.ascii	"\323\001\251\336\263\371\203q\306\324\346\354\254\205\373a\210"
+	.ascii	"\273\275g\243\205\";\305c\332\201\036\025\367\237*"
+	.text
+	.section	.gnu.lto_pidController.149.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\376?\215\002\001*\273}^L\020\030\247\255\f\007C\225 7t\310\312\016\025@@@~\366\037\fA\260o\034\021#\335gJQ\t\322\024\030\202\240\315\250Q\327\205\200\214\355\242\242\212\227y\263\315SM:\374<z\b\275\224N.b\224\352\355\266>\016\331[\312$\003\320\005O\005\364\005)/\006H\274\027\244\274\026\224\340\255\340\210\027"
+	.ascii	")/\005)\357\004H\274?\220x}\244\274\022\244\274\021\244\274\020"
+	.ascii	"\244\274\017\244\274\016 \361\366@\342\345\221\362\356Hyu \361"
+	.ascii	"6\200\304\313@\312\233#\345\305\221\362.\240\304{#\211\327F\312"
+	.ascii	"[C\211\227F\022\357\214\224W\006\t^\005\222x\023Hyc\244\2740"
+	.ascii	"R\336\027)\257\213\224\267E\312\213@\312\313\"\345]1\202W\205"
+	.ascii	"\b\336\024)/\212\224\367\304\021\357\001#xM\210\340-\221\362"
+	.ascii	"*\035\361\222Hy\223R\336\021)\257\210\2247D\b^\244\020\274 <"
+	.ascii	"\360\036\245\274\037R^\017H\274\035\216x\rHy\215\220x9\200\340"
+	.ascii	"My\312\027\365\300{\036\361\366\007^\366\300{Fs\240\216\361\216"
+	.ascii	"\215\\\263\377\240\255W\315D\353\036t\316\330\345~\300\377\357"
+	.ascii	"<\345|uF\236\213g\251\037\321O\370\363\371\357~\274\377\317\257"
+	.ascii	"\367\007\372\367~=\177\236\177\355o\363\277\371\341\374o\177"
+	.ascii	"\234\177\316;\260\001l\304(v\317Y_\263\326C\371*\024%\3122\326"
+	.ascii	"\325\236Az,\205\243\354\263\226\202\002\327u5\202\262\\\265F"
+	.ascii	"\310e\036\025\271\2544\254\004\016\002S+\342\343\256\321\356"
+	.ascii	"\233\313F\236Z#\251e\246\251\343\233\241\210\213\206\352\002"
+	.ascii	"\375\274\006yE\300\233+d\254\257o\237\350\205kD\330\247\016\217"
+	.ascii	"\337\272\256\254\005\3212\361\n\3438\013\001\273F\206\016\270"
+	.ascii	"\017,Dlz\337\376P\332\365\327\205+\315\376\357jL\277\224\367"
+	.ascii	"\226\211\264\362\035\027:5\370\255\353Z\343\350n\323\276\320"
+	.ascii	"\032\035"
+	.string	"m:\241,\\,:\272\327s\277]\243M\300\373\226\2051\270\345\236\275\335\373\334\317\363\016\350\202\316\267F{[\372\002\005\362[\327\325\217\036\235 \277u\305\232\373C\207\350\r\217.\321\230u\305\252\341n\231{\022\325\225\211\025\035\345\323\344k\326\312|d\030\304\347\367\245\250n\215\216Z@\247e\023\260[g?\267F\347\332f=\225u{\322,\343.\267\307\263F\273{8\"\223\327\331\246\002'\220+\315\272\256FGwog\017\267FG\231\374\316\332\231\262!\315*NW\321\321]&\273FG\215v\211{\266\273y\333\335\316\274\234\323Y\2439M\304pP\306\005&\343\340\t<\362-\016\013pZ8\327\344\332xy\362\322,\217\344\320A\374\233\026\276\036W\027\022\3459\363[W\264!m\226y\256m>&\317\336\030\016\212\316\346j\304\2579Y!\205\266F\r\361\352\342\322\004\256\353:\343\350N\260\307"
+	.string	"F\273\032\342\327\274\260\351\272v\021\346(:\272\342<\357>\315\315\210?\203:\210u\355\022\027g]\321jl\214\242\243\213\366\021\303\243E\0171<\272\304]\276\243}\255Jr\205Tj\201\353\272\336\350/}\370\354\334\366O\264o\022J\374\342m\237\275[?k\267|v\317\326\255\236\245\333\271\315\263xVn\343\026n\357\254\235\255\263tv\316\312\3318\313\334\267u[8\333\266o\326\315\266Y\266][\265e\263i\273f\325,\332\017\037\022D"
+	.string	"\301\003\016\364\340\261CG\003\f\344\300\261\300\r\0335h\314\220\241@\0021`\274p\321\002\001\026+T\244@q\342"
+	.string	"\023%\224H$\215\020\021\002\t\304\321\007\017\035\f0\342\220\026m\030\242g3q\277a\202/W\330\220S\242\276x\307\323\306\333\007\316\367\016\316\327\317\271\342\215\327\316\215\263\332\360\362q\363\335s\344\345\346[\367FOR\227\361\214N\r\274t\347\221\331\271"
+	.string	"\0132\254%\357\234\235W\232o\036<*\336\266\210iuy\241\371\312\321P\306\033w\242\313H\303\222\027n\354{g\314J\214\327N\330\267\216\030)a\274t\302|\347\2342\300\204\341\225\303Vc`\274q\276\276\314\023]\306\257\244.\343\026\336\267/.^78\247V\227\227\226o\233\210./,\3377'\272\214X\370\311\025^7Y\316\027[\274m\340\336\250\360iuy%\277l\311+\336\265\023]\306\244\024^\265\223\315\206\t@0\253\004\317\264\272\274\242|\323vMR\227\021\311\253\246\311S?\253t\031\241\360\242\265\250\372\217\346}4\013Y\002\302G@\310S\211\030\002D\177"
+	.ascii	"\321 ;p&0\3507\347D\227\361\311Ib\352J\354dX\202\334\203\247"
+	.ascii	"~f\3512V\025\0062\217\276\357\350+<\0132,>\326\221\324e\264\332"
+	.ascii	"\343\006N\023\\sZ'\272\214V\347\013>^\202\0041\003\201\236\003"
+	.ascii	"\220_ \306\241\367\005\364~#\257\216m\350y\r;,=tLc\3563\346\362"
+	.ascii	"\260\2149;,"
+	.string	"<\254\200\334\023\220\213\343\030\314\303`\276\361\013\267\273 \303z\263\303\202\303-\334\332\030\001\2677\314\342\3640\246\316x;,\267\023\007\223\013\241\033^\321\346*N\031~r\016\335\016\253\3159\342J\fY\003\2478;\n\263\2370\373\001\247\2114\347\0134l\302,\360,\310\260h\340\022g|gA\206U\306Ju\017B\347\216V\227W\232\2238\217\306\316\005\3028\311K\226\330G\314}H\236D\203\272\262\304.B\314C\234/\312\006\357\334\016K\314ibm\nL\030F\002s\020`\300\370\350\353\037N\031\\sZ#\370x\t:\031\326\026\366\360\305\305\035\276\264\260\001\357\312\272r\243\027\263\234\303\025,\234^!\303\332\342\";\254$\0132,,\274\201EWV\226\017\217FS\250\030\235\242\342S\353\355a\212\361\\\261\256\353\351\234\253\246H1o\230`]\327e\344\224\254\257\n\337-\252\261{\030vy"
+	.ascii	"\t\nt\t7d\225\242\372\307|*\340^\002}216\202g\013%\003\007Z\246"
+	.ascii	"\215\257U\005\031\220\223\027y\353\272\3568\272\234\307z*\"\225"
+	.ascii	"Pm\252\315\341\321\030\375\271\243\313\260B\3019En\366\242\031"
+	.ascii	"\317\315f\023\321\210V\356\2076\263\302\020\227\353\016mfz\220"
+	.ascii	"~\247\337\245\253V\304\235~\240/w$\333]n\341@?\320\303CFn.\214"
+	.ascii	"v\240\227\217\206\214\334\334\027\355\242a4\333\351s\367\242"
+	.ascii	"\277\246\327\242]\364Iw\034c\344\346\242\340]b\024\020>\262E"
+	.ascii	"\237zg\352\366\030;juX!\351\204@\240QH\323#\305\203F\326\263"
+	.ascii	"L:\004Z\2040\3002\026\275\242\177\247O\227\207E\247I\271eN\355"
+	.ascii	"\333\212&@\330!A$\0254\030\216H\245\343N\212V\321\033\334P\244"
+	.ascii	"8\321(\346\234h\037`\237\261\206\r\016D\233\037\320)\3049\240"
+	.ascii	"I\b\373;2\321\273[\203\337\210T<\362\326u\355\261\f\207\335\210"
+	.ascii	"P\252\210Q\242\f\217\276D\233\350\r{=X\251w\211S\210T\206G\226"
+	.ascii	"\350\025R\0355(\302C+\265\222\332\027\315x\016~r\016}\240q\242"
+	.ascii	"\331\220D\263\260\306lD\263\030\210V\254\f\217\222\350%a\206"
+	.ascii	"\222\232\315\326\276\265\035$\241\"7wD'u\377\035\271\230\367"
+	.ascii	"\n\264\006\355G\263iHj]\213-D\364\210\020\375\241E\364\217dF"
+	.ascii	"n.R\207h\245\277\243_\221\233\353B\362kg\b\242\221\032\205\333"
+	.ascii	"\221\253A\364\251\n\213\334\304\3025\020\303\316\216\372v\364"
+	.ascii	"<"
+	.string	"\364\207\3761\260\210\206\323,S\313\276\355\333\360\250\207>VX\237`\322C\330;t\005eD\266t\350\017\206\365\225%\213\334|\207V\356\351\374Wmg\370\206\373\026\206{r\370[\030\036OW]\271\001\215\302\002\330L\031\226\201\350\265\027st\211J\342\227/\303\243\0064\ta}egEn\356\337\232\214\013a{e\006\304\351\261k\205\371\021\314\002A\263\3314:\207V\356\236\310\220Cwa\032\2400,\206\310\022\021\flx\224C_\r,Y\344&+\255\353\232\262\2374@R<\370\033\315f\263\350\313\323vJ\323\223\342\301\005K\373U\302\374\224%\267\256\331lnh\345\013\303e%{ya/fU \206\t3<\nC\230\240\245\241\"7W\254\353:l\3452\232n\264\225\313\275\314\257\273,\265\256\305\026\035\022\345\001\243b\362\335\364\301\272jw\227\027\360\367\351\274E\\\225>5\205\356"
+	.ascii	"I\361\340\366\037c\310h\372o}:\007AHU\307\310\315=Z\037cx6\243"
+	.ascii	"\351e\252\244\221\233\273\314\305[\210a{1K\034#\222\341#\217"
+	.ascii	"\356\211d\206G\317\356\260f\317\020\227Y\262\310\3152\3042\267"
+	.ascii	"\206\321v\206\313\013\336%\236!\226\265\265\21263\347\331J^4"
+	.ascii	"\343\1774\233\315\356.K4\033vw(L\323\223\342\301\335%\242\341"
+	.ascii	"-\242Y\321\272\256;\226\223\n \326P\264\256\353\305\034\335\027"
+	.ascii	"\031\036\355N\317\212\334\334\345\030\270J\221\275\230\245\240"
+	.ascii	"\002>\362\350\276"
+	.string	"\202\341Q\356\023\n\253#\230,rsQ\360n\006@\370\310\273\351\024md\374\004\375\214\035\265\213f\3746\233\315Bn\345\356\267\331l\026nw\331\365\300\313h.\367\345\262\313}y\231\362\362\231\020\274<\003\b^6\223\362\262\f\377\373r\231\224\227\311R^&\363<_\036s=_\016s>_V\246\274\354\305W_\356Jy9\311\310/[IyY+\345e\253#\372r\325\021}\031J\312\313O\270\370e*\226\372\362\221\245\276<\225\362r\361\204_\216\372\335\227\327\337}Ox\300\357\021\245\274\037Ly/\370?\337\023z\240\357\373~\366\377\017O\371\336\356o\276\307\3636\337\313\245\274\217{\233\357\357|\315\3778\207\363\375\333\337\276w{\234\357\333>\347{7!x\037\226\362^L\312\3730)\357\301\244\274\007\343)\337\177\035\321\367_\256\347{/\317\363\275\362m\276\357\202\304{/$\336w\245\274_"
+	.string	"\022\357\271\244\274\337\222\362\236+\345\275\226\224\367YR\336c\t\301\373+G\274\337Jy\237Lyo%\345}\225\224\3671\244\274\327B\342=\225\224\367Y)\357\247\244\274\307Jy\177\225\362^J\312\373()\357\255R\336W\205\340=2\345=\224#\336?IyO\225\362\376\230\362~*\345\275T\312{c\312\373b\312\373(\017\274_S^b\312\253\246\274P)/\f)\357\013#x\025 \202\327I\312\353B\312\333B\312\313\302\021o\223\021\274O\"x\231\244\274N)o\002R\336%#x\233D\360*Iy\223\034\361\"\031\301\213"
+	.string	"\021\274\007Hy\231\216xW0\301\253B\312\233B\312\273\224\362\036Iy\215\244\274(\244\274ER^\003\220\340=!\3455\241\004o\001\216x\t"
+	.string	"\202\227H\312[B\312;\200\224\227\204\224w\204\224W\204\2247\204\224wH\312\013B\312+$\345\375 \345\365 \345\355 \345\345 \345\335 \211W"
+	.ascii	")o\220\224W\203\224\027H\312\033\200\2247\203\200\\\325l\325"
+	.ascii	"L\365\324K\255\371\347h\310\270\305\f"
+	.string	"\245U`B\311\251\312\n\242b\212\032\025A\336yubA\321\261\003\005\307G\302\r\217\252\320\037\324\232u\310*}\244\031J7\336\221\353I/u\n}\202\356H/\265\022\335i\265\314\035_g\225\023\032\310#\315SG\343\306\b\313\346P5\037\233\2374\037\237\316\240\326d\036\2154\n\315T\335{r\347\023*#\375\271\265Qh\023xM\266\"m\200\346c\237jG2c\236s\352\224*\322_\003;\233j\0034\222Za\363\0308\2059\252O\350]\250:(>|$O\365\2123\352\003\032d\347\252\356}\315\257\233j\037\324\235Z\350\204\346\251\2130U\b\210\254b\243\220\rX\217V\256\t\375\2564=\211\226\031#o\241\360\032\221\023\024y\203&\364\271\306\016\361\260b \315Q\005\350](=\250@\004\350\0024\273\001\022\240\217g\254O\360\354\305\030\301-;$\220B;\324\336\220g\350\027\236\277\254"
+	.string	"\252)t\307f\232gh\245?\"\3758\315f\232\327\237f\360\006\225\235Y\033\243lCDZ\310X_Y\t=\200\346\250\366\240$\204;\222\031\233\020T\337\276\225\320g#\241G\350\001\354\331Hh\027zs\212}|N\230T\267\021\372\205G\013\307\366\004w\220W 6:\316w\346\263B\210O\241\273\333\261\301Ai\240\225;"
+	.ascii	"?9\276\200\276\337S.rk\374\\\341\350\240Y\206\256Z\021\332\t"
+	.string	"jP\007Z\246\215<@jU\214<=\365\352\304W\236\b}\032\306\360\004\317\216|\302\206\372\203\002\344#y\355\237%\032\322x\313L\361\325\007\t\017Q]\b=\244O\330m\3478\306h\307\307\t\224\240\352\026B\177\rlNqH\377l\214\256,)C\327-\223\204\036uK\004\335\371\316\201r\020\220\001\016\032\204\376\002\b\227_\2029Z\271\274\300\005\373|\277\225\240:0T\314\033\037\354\203\001\241;\350\373\235\223U\304\310\245\335\351!\324B\032\204n\272#\227\261K\177\320B\016\246=\350\017\360\356AG\240\307Aw\320?\022\202B\324y\226\211\207\203fa\f\356\304A\330q\313<\037\234Z\365?w\324\253\303\331\021\354\273\351\235\025\271\311\013\264r\233Mg\231\022|\365\234\017vzv\203\0012\302066\210\263L\024\255\325Lu+\351-H\277\257\341\004)Z\327\342\233nS\243\214A\202\f\217\256"
+	.string	"z\203U\247\272\215\n\310&\200>\331\330\333\336\351BCV\215D}AzW\245j\265e\222`\243n\211Hk7\260\326\240\203t\t;@:"
+	.string	"\255A\377Hf\004\322?\300\240\264\232eJ\200\246V\355X5J\327\240^\3018\013@\337\320\230[\221F\006\214Ag\200A\1779\306F0\331\002\237\037BME\215\201\217\\\024V\354\262\254\311\216Z1$\327\214\013\232\301\244\225\225]\3200\364d"
+	.string	"6-\350\343\375z\267\240}\210\025\226%\255\364\231e\352\370Z\327u\307\f\352\226\215\226\241\315\250X\264\250[\266\f\217\236P\227 F(\330\304\357;\240\363\355[\321\373\372qz\314X\005\275\253z\251J>r\317\365JG-"
+	.string	"\272\202\036*\371"
+	.string	"\325/-F\005+ZW\251\035\333a`\030\243\206\201\032\036\005@\233 \006(xFA_\357}=AS\320\337\373\004\3754b\207\312\222`\313\264\221\327_N`|\365\227\367u\tb\177\202s\212\n\264r\357\307\022\353[\006F%\360\243\255}\364\217\356?\037\315\001o\257\217j\216\221\233\305\030\0220\361v\027\2571\225\f\037)A\237r\320X\3313\325Q\033\007\210V\bF\2579\364\205\337\260\n\271^D\220\002C\320\333\\\266\230Q\317\360\221\021\364\212#\004z\224\330\372\340\\\234\371\335\332"
+	.ascii	"\276~3\303\2404-zt\213\245e)#\202\365h\036Z{v\200\b\360\350+"
+	.ascii	"DT4D0\036\255\002"
+	.string	",\217Z\037\213VR\371\275t\257\371\353[\261\343T+\302:z;\251\326\300GnWi+\252\0325MU\343\360\335\033\036\375\237fS\335\360\221;z\005UG\355\367\256\243\257%\006W8\247\225FE\003\355\224\006\bO3\320\rt\357\361\327\316\360^\232\201>\337\321,bw\322\376\260\3251r3E+\227O0Y?\360\227\342G\307\215\212y"
+	.ascii	"\223\351=K\340h.\323U\273\\\206\357(\226X\235\264?o\b\225\351"
+	.ascii	"\254e&\345M\001\023T\226\005E\216\346b3Y\3778&\206\030\222\353"
+	.ascii	"\004\027;G3\231\376\221\313\330C\316\237\335\001G\324\020\254"
+	.ascii	"y;\263g]W\023\255\214\353\034\215B\332\234\024\017\356\021\365"
+	.ascii	"\343z\250\314\362\207\213\215\243\217\250\331\355\200R\226Y\264"
+	.ascii	"\256k\217m\253\216\342\244Mus\033\036\345b?\360g\231\342\333"
+	.ascii	"\027\227\331\234\243\255\353Z\"G;\2215\224e\276\310c\366\023"
+	.ascii	"'$\3124U\216~\025\261:es\212\334\\\034\375\275\237p\004\276"
+	.string	"\227\336U\351\250v\370H\034}\276\213\340CC\r{\244:j\327u\215R\032\302\273\252\234\232\207\217\004\243A\313\036cG\221h\345\032\001\032\301c\272\001\211\230\361+k\210u\263\331\024Lj\345\225\315c\232\204Z\335\237\005\372l\313$\321{HB5\372F\257\215^\240\213\035\374\355\253\243T>\247\353U\275S\351\324?7\272\004^\035\027\022\332\020\224\3214zgt\rD\035\334mP\345\363\271@\026T\357\360\324?\177\206Git\t:=>\3647C\255L\003\216\321\n\364&\3202\232\310e\252\243v\271\320\007\207\223\267\256\353\221\204\324\275\337\371Z\327\265\207\037\017R\373\006\251\205\n\r\217\006\273\202\215\245$LO%v\005\033LVx*\222\344\206\222\246$I\232\214\230@\341\004nrr\222\201\022\246\r\216xP\302\264\301\021\244\"OH\226\216\240J\23068\302\301\311\023\223\221&$K\"|\360"
+	.ascii	"\251h)M\342\264\364\004\204I\223&&\026\226\234\226tXz*\"\304"
+	.ascii	"\251\311\311\351\202$NKOL\036\212<!Y\262\340I\tS\323\222\247"
+	.ascii	"%\020\2160-9J\322\004\204#LK\206L\230\\(r:5=\031)\202A\221%O"
+	.ascii	"\251\022\246% \264P\304I\007$MNOJ\232*X\301\210\222&E\220\204"
+	.ascii	"`\002d\251\211\021&KB\230,Q\001\304\022\013LOF(X:\322\264\001"
+	.ascii	"\222%\026\226\220|`\252@\211\223#h\022\247\245'\013\226\236\212"
+	.ascii	"\birr\242B\007&!,%a\032\362\244d\311\311\251\211\221\016KH\230"
+	.ascii	"Rhr\362\340\b\323\022\016k\304\306\021\246%7\236VP\201\tI\n7"
+	.ascii	"\2240\025Ir\303\210\023\223\0336\224\266i\311\222\323"
+	.string	"\215\247\246&\247\033h\305s`f\025\364+\266q\235\254\375t\016\302o\r7\277\324\312M\001\031\341\262n@)\3148/y\331?t\204\227\315e\035\"\315\n\356\310e4\264\314\021h!'PeT7\247\244\037\271U\255\240~\313$\361%\267\373\202\024\264O\335\022\301\207\3471\246\254\211\341J\023\250\002n\352\312H+\367\347\300\0067\225Bw\361jU\220\031\2578eo\202\311\021WbH\024Z\271\234\365\032`\fp\273\336\363\004\264\377\365\325|\366\277\303\254a\213+\362\325\267k\023l\311\276#\227Q/\357\217Z\346\206\366\271\263\013D\353\364\320\301Y\342\221\213\013\f\264#\206\326A\351\224\261-\003\321\344\374\335\031\240\225\313\005\230q\316\372c\220BF\217\t3\216v\325\036\220\237\234C't5\203\201:\323\325\307\302\305\330Q2\270\346\264L8\227F\001\215\003u.}:?\311\312\326\276\256\353Z"
+	.string	"\"\034\246\033\020\211\031\277\027\261\264s]\327\225"
+	.string	"\255\3440\375\272\217\240\246\327w\3442\342\351\375~k\316u\355\372\361\275\337o\r7\231\b+\333\336\270Q\227\315\262$\327\331\263\033,aK\263\255\251!\t\025\271\266t\023\036\307p\031\324\322\347\352\023{\317\242\245O\250a\351'\373Y\256\364\261\364\020\357\350W\354_\351C\241A\327\020\315\324l\365\020kIXf\245\257\325Ov\023\276J\337J\243\177\312~\f\375*\350Y\fMC/Y4C\323,\023\005\032u+\351\213\006\255~Z&\232\221\245\005\312"
+	.ascii	"N\245O(\rP\r\350\222\bz\206J\323\320;\025\022\322\330\356\322"
+	.ascii	"\364\262\372S\232\225\315{i\250\231e\276\217\f\352\326\351\312"
+	.ascii	"d\365\373`\365\257\372SZI\355\310\325\206\222Y\346\231c\324\255"
+	.ascii	"\303\031\303\3523\365\316\244\364\243\364\257\032\375;r\205-"
+	.ascii	"\323\207\030u\213G\030)\355C\017l\2315\362\320/u\013\306\227"
+	.ascii	"(}\276\2433,"
+	.string	"\001G\360j\3452_|u\361\272\027\275$w5{5\r\267\343!.\313d&\272E\335\342\265<\256\256f\254g\340\2674$x\206e\231.\276\256lUY\366\005V\211\001\325J.\373\226\350\224e\272@\261\324\255\023W\n\244\255\031\342J\263j\274\002\261\021a\210Q\263\224\237rk\374P\201\360\252\3463]u\324\270V(M\357L[-3\305W\225\272\225\364\205d\253w\360'\n3\004(}\2536\032\322\312e!3\316V\377\325\230AqT\314\017r\204u\325\366\253\232\245\240T\313t\221\207\036\325-\035y\350\224U\247g\310~U\237nG?do <\206\365\2414\322\227(\314\023\204V\262\231\220\356\262|\242\331\360O\372\003Y\232\236\032\264H4C\243\2364[\035-\\\n*\373 m\355\214\007\205\204\211\352\226\202\201\200\201\201En\252T\247\241e\252(\244n\235 \224\265\324\263\f\f\354"
+	.string	"5\252\005:\373\226\211\342\344S\267\222\316=\005,\347\0029h\353NS\2733n"
+	.string	"H/\357\316R\313\362KP"
+	.string	"\255\\\006r\316I\211\201K\003N\366\305t\325\356\251\322N\274>w\307\376T\237\252\177\362\371\261\317\324K^\252?\325\033\360\216db\372a\372R\315O>\302\037$\334\031\244\225\273V\232\223\r\204\360h\310\330/6[\351\033\177z\350\214\335\202\364\316\240\324^l\256:\007[\\\244:\352t\204O\344h\320\312\335\250~a\307v\312\305E5?9*\303\262\216 \220V.cp\3369_\220\001k\365\303tU\230\35646\315\2411"
+	.ascii	"n\316:\313|\242\223\216Z\365\277s\216zu\274S\016k\365\341:\003"
+	.ascii	";\fZ\271'\206\r\277v\207\263\363\355k\177\314\222Il8\313T\361"
+	.ascii	"u\266\235{HBEb?n\351VvA+\331\226\211\342\\S\267\222N\265sp\t"
+	.ascii	"g\031\310R\346\264\316,h\345\362\324\317U\325|\373\301V=\242"
+	.ascii	"\215\360\214\307\277t\325\256\332\273Pm\347\232e\242Ps\242\375"
+	.ascii	"KC\265\332&\376\216dn\032\206\206\342\250~\241ah%;\347\3312\177"
+	.ascii	"|\235fjU\004_i\324+\032yh^H\264d+;\253@\001\275\2736\316\262"
+	.ascii	"\245\223V\200\013NZh\027X\350\026d(CF\206\005\366\202\214\002"
+	.ascii	"\200&cM\372\311\245\332pO \024\n\356\2457\224a\363%M/\005\024"
+	.ascii	"/n\023\374x\3523L\f\223~rbB\005\256mO\212\004\264S+\355\035\311"
+	.ascii	"\330\252\227t\002\032\005\341\371\265\314\357}Q\253\356\347\364"
+	.ascii	"\242^\035N\271\244\277\247wV\364\261\201\n\033/\t\232j\234^]"
+	.ascii	"J\272)\211\022\252N\022\301i\345H\270\220\bB"
+	.string	"\200\2003\013\221\312\307\327\211\345"
+	.ascii	"\215\200V\262\303t\2006\036\216\315\324J{\350\236*\206\036\300"
+	.ascii	"q\242\331p\205\276\237\263\312\n\375\344X\263,y\364\247%\217"
+	.ascii	"\0033~/\315S\177\261\246\031\204a\250\243\001T\301\\4S\262\234"
+	.ascii	"c\312\210\320\214&IZ\003S\026@080*\033\013\203j\017\023@\004"
+	.ascii	"\317(\362\311D\0162\251\f*\221$\351<\326\036\005\260\340\216"
+	.ascii	"\353\353(\262\374.0\210K\375@\347\224\322\222\261\233.\360\233"
+	.ascii	"\257\372y[!>T[\274\001\265K*\272\\y\276jl\207\263j\345\324\251"
+	.ascii	"\240M9\372\003\217\345\270\217\\\364\231\274\261\f\036\244r\275"
+	.ascii	"\r\312\201\217\375Z\2137\n|\244\016\344\217f\f\247\261\330\203"
+	.ascii	"I\273m\371cs\023\f\030OG\027\367\037\205\200"
+	.string	"\221\f(\304\212\261\020\233t\327\"b\177\035\322>d\315\221E+\031\274\363\002\262.yn\207\206\241\037\200\245\320^J\0058\237\247\227\332\301b\025\373b:\324(\316X#\022\031\354\007\364\377$\333\234\004\017B\336\355\301M\210\007&\321\276\2309\255\313yTj\334\233\372]\301I\261\230\366T\n\2615+R(|\225x\"J,\212wOX8\254s\316\317\303a\276<4\344\265\034\323\325~\321(\035\356B\177\371\207\367=x\350\017\344\370\2320\275Sk\364\256\340\001g\b\373\021\363DV\262$\276F8gNu\007\003[\264\001\342\356l\"\325`\207\225\353\237C]\312p<\2432\312t\275m\217\242\363.\300\211L\354\345H\232\351\267\027E\330`\305\025Kw&k\230\013\022\026\357\375|q5\022\327V\226\336\213\013\246\177\235\245\345\035\272\252v\223\324L\017\031\366 \307\275\226-m\305\253w(+\245"
+	.ascii	"m\0179\206\270\342\373H\377\263Y\231\375\235r\353P4]\277:\312"
+	.ascii	"\331\030\302\2148x\250\303\031\250~\337\266\232\361\272\301\032"
+	.ascii	"\fD[_\343w\b\213<\203\234\210\200\027fMzGH\217/9i\ni\373\210"
+	.ascii	")4~\347\304\017\2760Hdk@\032\366\211B\030\303qi\214ZKl\222\331"
+	.ascii	"\226\325\252\200\005E\f\205\\\rB\330\024\372x.\360\242\210\342"
+	.ascii	"\335S|KkMJ\177\212\327\216\256\203\026\024u\212\025a\030\200"
+	.ascii	"\320.\0230p\243[6\265\372\235"
+	.string	"\006]\255G\r\273_\211-\206\223e\023'\332\024\347d\227\215\370\330\243\257\021\227\277\266\250dQ\215|)\236\354\231nw <\037\317]\373\265\227[\312_\033R\362\260\373\270sP\302\001#p\272\241s\265\022Y\327\235\357\264\235Q:\336\361\n\343I\322?\332\277w\254\335\230\345\203\rut\374\261O\355\205\303:\262\0054\336\341\214\375\337f\035b\361\220v\351\2676\241\313R\250\266\222\226\307~{\3348\200r]`;\036\023l?\341\227\374e(U*n\336_\220$\300H#\376 i\213'\275\371Z\020\270\215\261\205\205R\006G\031 \236ND\364\3277\006w\267\263\024\341k#\242\031EQ\017)\275\200l\333\244VIt\253~\302\243r~\357\024\377\235Z\352\037E\262\343\245k\230\312y\332\340!\314!W\312D\223\264\304C\367\243<\355c\243\326|\332\243d\272@w\226u\203d\224t\237&\241"
+	.string	"\312\223T\303E\005\341\033\032\351\371\372\017\370\210\330z\t\205\2515\315\032\2354\361\030\304\320 \361\245\031k\317+\271o\034\300\325\221\222\200h\257\213\247\225\267\311\300u\300\003\246,\321J\266Dx\270\357\330.8[\026K2\224\256Cb3'{V\335"
+	.string	"\263\0362\003E\\\356\217Ul\360\261\023\220\307;J\337\031,\362\245?\327\334 @!V\246 \270\021\232,\023\321\321\327\bD\373j\364\334\352\2605\251\\\306O\274&\351\341\356h\001t\f\355\225\364\355\334\355\265\324Cu\"\277\312\206<\301j\031:\237\300 \307/\332\200\005#\b\220\354\251\203\202k\332>\324\320\210\314\301\033\034\030\210m \263\001W\3470vV\206\253\202\033 \324\365\377\370I]2\277^Qd\002\004\361\225\235\244\002\025\036\002\310\207\344\336\377\006\362\244\263,\343\232-\022\324\265\217\266H\232\224\022R\245"
+	.string	"l\220\251\2062\2276\272\212\303s\026O\241\234\353Mz\275\f\024\310\225[/\321&\004\344\340A\250I\243\005\236Wg\022\364q\007\016\\9\030\237\355\350\250\223\257\247\251\216\324\254\005\371\257-\226\276\316\207qh\221\371\237\t4\346\3025\237{\210q\261\246D\022\353\351\234\223\341h\030u\330\236\201\263\306qv\237oFqw3\227Yk3\226\001\374\244\240\332\272(\004P\210za\002\007\200\332\233[\250\371\n\0205t%T,\224!\372P\177\242\337\",+u\215*y\317(\242f\347z\263\222?\3037\320\204\243A\262\315\331\"\217\351\3325\207\027\313VN&}\n/\216\375X\306\222\260\016\005\231\321\242\213\315\034x\215\301\310\333\2461\242h\204\267\021\261\037\020\337\234\032\327.\f`\016z\302|\r\205\354\016}\212\036\331L\234-q\034"
+	.string	"0\r\275\217\217R\263\224\374*s\277\306JO\261/\225\013\354 \212\247i\337\024\316dj@Km\241N\316\016\233\320\241@\002ZV\324~%R\025\303\236P-o\021\257eN\320\003P\351\346\253\323L\276B\301'\356\371A\002`H\302bh\020\212T\351qF\026ab\367\301\314[\326o?\363\004\226\223D\361\001\331\376PJ\317\021\322r"
+	.string	"4\b\202M\320!\275\220\315\\@\342>\374b\022\252\213\236\232\244\263\202\325\367\034\302A>\036\357D\305\243f\272#\252\375\363\027\004\304\253\351\244b\253`\030)\311\300#\214Q{\344\244\273a8D`Y\001\305i\364\355Y\313\006"
+	.string	"w\205@F\334E\360\304\220\250\031\b\nQ\356r\263\030k\t!\217\242"
+	.string	"\262\007\343\320\337O\302\323D\207\233\215\262\033\002u\022\240\274\214\335g\253\002R\345i\367s%\025\365U\202\310F#\232\263Z\333F\312\271\256\255,A\366\355\"!\257\274^\2374\374!\223\265\372\001\255\037\013v\331\320op\357\222\013\034a\311\237,\304:\3150p\200W)\336\262\321\233\257\344\232@\374$\221\351\004\245\006\311\037;M\013\030\367@;c\026%@\007%n\313\215\365\251\324\017\221\313\235\224\243\371\223\2270\004\210\251\250\230\306t\213Z<\006\027\3013B\210\202\207\217\372\333T\020J5T\001\263\206L{{\2129\345\026\254\356t\220\017\320\357\362\027\341\227\240!\235y^\336\256\230r?O%\270\375\374)\025\244\206\025?\220Tv9\316\331^\316"
+	.string	"\203\224\234\327\250\"_\n\325M\021\263\247\245H\032\372\031\340\250k\223\356\306Q(\177\334\342W\237\250ck\274\2363\313\345\013D\205\023l\261a\320C8\030gn5\375\214b\256\322\221\025:\030O\350%\250\361Lk\355\332=\017K\020F\214\220\204\241\016\026X\265\004\0054\223\353<\314A'\352\245\024Aa\255+\"\241\251\334\0351\270P\256s+5=F\326X\222)\031\355W\306;\320q19\262\253\327\273\341(\370\257\357\365\212\226dX\037\343\004\241Jq\234\366g,j\2555C\214}\262;:2\327&S"
+	.ascii	"\231\330@8\301\006\363z@p\376FZ\236%G3\265\035\241pg1\345V\n"
+	.ascii	"\226\303\016\324\020\365\372\323\215\350\310\304\tVHn \242?\317"
+	.ascii	"\355\362\310\325\234=A\237\216fH"
+	.ascii	"\261\002aq\002\017\032\022_\207\033<c\312Qc\022\224\216*y\203"
+	.ascii	"\242[\320\351\262\300\316[\005f!\375\256\327\236\312\262Q\nd"
+	.ascii	"\321yO\252\020:<\307^\350\265\372\"&^\375\240D\223\333\215\335"
+	.ascii	"XpZ|dZ\225]$\005~\206#\225\t\241\206\363A\032\370\203\256\241"
+	.ascii	"\211\2223\364\005\352\373\344&\277iB\222\371\240\307\001\372"
+	.ascii	"\346\301\220\266\334\036q\222\021\272\232\314\373vQ\215j\032"
+	.ascii	".md7\231\020F\022\036\360\022\223$\036i\254\332\r\032\355 J\355"
+	.ascii	"/\254\237VJIG\375\246\220\331\013\213\262\216\320CN\002\214\207"
+	.ascii	"~d\245\177;\242\204\200^\3302AL\242\204\002\224!\004\027\004"
+	.ascii	"\366\266\364DS\001\364\367\317!_\306|\203)\002\215P8Y\240\026"
+	.ascii	"\23730\t\021\206K\210V\027\021\376\240w\375g\366\276<'UKt\231"
+	.ascii	"9\270\222?\277\252\20656\346C\0375\216S\362XVT\301\300\214>\006"
+	.ascii	"P\325O\037Qoy\305O\311\026^\356\037\341\334\272\224\377\334\033"
+	.ascii	"\307St"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.150.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"\302K,2PO\323\001 \235\351\026"
+	.string	"\256j?\030\327\312N\004\24588\332\3727\213\204\330\306\336F"
+	.string	"i\200h\220\252\212(\004\352\354\344BT\326\030G\004I\231R\216 \007\211z\226D\2044\001\361*\244\006\212\027U\026\017*\360D=T\317\232\246\352=q\257\231\324\003M1\354\217\234\004\372\032_\\y\356\216\177\005\334I\035\340\320rc\307,\265\303>\300j\306v:\325@E\263q\314\311n\267iY\024\307$\304\366mc\366\343\004\005\314\360\361\243#X\001\331JXv\343S\217\303'\364/r\206\r\223\302]\262\247\300\302\356:\271\213\306\255G\260\235\021\b"
+	.ascii	"2\003\316:#h\b\3055\261a\b\022\356\2624\033\336uo"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.151.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"U\n"
+	.string	"v\323HA m\225\016\3270\323\250\331\320GB\314\fJ\343\301\244\022pb\007\270A\224D\r\206\241\325\373\033\266`\327\020Vk\357\026\322\353\275\222E\220\021]@`}\231\246_\2213\nO\327n\221l)S\n4"
+	.string	"7"
+	.string	"5"
+	.string	"\022D\354n\324\005\347\01659\377\260W:\317tHY]a\205L\001\007\n/\0051\020`X\035\366\f\340\2412'\231\335uv\036\201[\273m\016\333\321\376\003ke\301\277~}\372\023\013\017\002\n\374"
+	.string	"\205\335\0013\022\033\323,8\260}\213\355L[c\203\373\253t9\210\t\257\013\273_\206/(\327\314\331\035\3761\330\313\207\007\252)5Y\025\252SU\"+\204\220%Pm\251^=\"lH\345\b\373\020\376\225\374\006\036\221\362\3355\2374q\355\n\300\225\301e\340\2243\373C\245\266\354\303\335\r\234M\263u\2148\036\2127\230\217\016(n\"!\235\021\220\350\351hH\342&$\212\230\213? N(n\237O(Z\276\323\341*\253\242\301\213\235\024\005'\t\325\026\225\344;\037\366L\r"
+	.ascii	"3\241\017(\360\202\327`\274\027\251\315\005\3618P\214\200\\F"
+	.ascii	"\001\252\373Jj\234\270sQ\265C\003SP"
+	.text
+	.section	.gnu.lto_pidSetAntiGravityState.152.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"%\013"
+	.string	"&\224LC\020\251L:"
+	.string	"\354\357g\263\320\305\\\343\210\371\375\276A\321pl\257\273\273\225\375w{\\D\007.*\326\035\033\336\331I|A\331@\022\004\211\b\016\200\"\004\240\022px$\b\024\350.\204-Bd\357\235R8"
+	.string	"7"
+	.string	";"
+	.string	"\033\n\013H\020\354v\267\316"
+	.string	"\017O\247\f\375\317\236a\211\250\323\326'u\300\001\3205\210+*\241\002\241\365\331e\211\250\222\362r\261\273\226,\361\344\376n\033\303v\265O\021r\302\354\323\235/\373\262\237^\372\227\207\013\fP\356\312\355\232\3642\354\355s@\300\3665\266\245\264+,\302\313N\233WP {\260;N8\002\363\317\241=\341\243\200\r\253\335\024\204\177\3404\333F\\s\315\362\017\214\345v;\331\300\002neN\030\235\237\0334\t+\211\301\276\201\217'\177\200K&y\326?\337d\371\367\251\021\213\300KI\311\236=\242\002\037\260\003f\224>!\214=\034\016\320\250\202\037\036 \220\216\032\002uB\252\207$R9\033\213F\037R\005E\"R\325\214{\272\363\345L\256\300-5U\2463\301(\246\343\271\350\204\331\276\266\f\022"
+	.ascii	"3\241mh`\020\016\001\373\203{\007;\247\204\320\340\004\202\b"
+	.ascii	"\016\210\334\203 \016\020s\241k\370D&\274\222\032'\356\334T\355"
+	.ascii	"L\321\024\024"
+	.text
+	.section	.gnu.lto_pidAntiGravityEnabled.153.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"\302K,2PO\323\001\240\342\276\021\0041\356\255\007\343Z\220"
+	.string	"*\231^\233\254W\n\t\261\215\275\215"
+	.string	"\322"
+	.string	"\321 U\025Q\b\324\331\311\205\250\2541\216\b\2222\245\216 \007\211z\226D\2044\001\361*\244\006\212\027U\026\017*\360D=T\317\232\246\352=q\257\231\324\003M1\354\217\234\004\372 \276\270\362\334\035\377\n\270\223:\300\241\345\306\216Yj\207}\200\325\214\355t\252\201&e\343\030\225\335n\323\262(\216I\210\355\333\306\354\307\t\n\230\341\343GG\260r\262\225\260\354\306\247\036\207O\350_\344\f\033F\303]\262\247\300\302\356:\271\213\306\255G\260\235\021\b"
+	.ascii	"2\003\316:#h\b\3055\261a\b\022\356\2624\033\336uo"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.154.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\315\n"
+	.string	"&\025L@@K\225\016X\240\260\007\312\2570C\007\225G,\004T\262OW\030\240Zy\210$\220\r\266\265\\\257)1+HS\200,\013,^\327\005\270\334\231o\335\340\335\356wF`\020\033\211d\357\275S\n:"
+	.string	"9"
+	.string	"7"
+	.string	"\t0\200\330\335*#t\235\354>e\354\374\237\356\360\276\316g\326\340rZ\2604\264\036>.\370@3\022\222\340\375\364\250\340\373\304\030\221\261\273\216\336\307\340\246\267\255a\273\332\207\004>6\361\240$\272\203\016\273\241W\210U\321\r\023\354\207\366\343\017\333\217\366)\274Bw\320\031\354\330\345"
+	.string	"\246v\367\302\025\331)\305#\330\351<\004;ug{xHZ\311\207U\336`\227\001P+Pt\3316\360\013\233lw1|\013G\035\360K\247F\300\211\367N}\016vz\271aj\231@O|\331a'J\b\366\347\356\256\345\310>\370\317\030\003\025\f\307i\233\205\313L\231\b\270h*g!p\301\f\250\005."
+	.string	"2\225\262m\352DbMS\331*\247i[}\204\373\271rd\307J\244\362\310\317\224\210S\332\031-\336\363\224\235\223\\\254\224\f\016"
+	.ascii	"3\2417h\f\255\301\336\260\227P\255\202@(Bt\035\002\234\313\224"
+	.ascii	"\232\021\233\325i\340\032\211)$\236A\355\001"
+	.text
+	.section	.gnu.lto_pidSetItermReset.155.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"m\007"
+	.string	"B\31647Po\322\001 \361\205\003\261\327'\n\303\346\201\242\302\277\204\376j\204\351kV4\213\222\025g\t7\275\021\342\223;SUU4+o\"\220t!\260Z\210\336d\313\224\002\233\214\223\220\351d\2265\330F\363\310\017\303\202\306Q\220\035-\323 5\234\203\304.o\236\214\223\237m\343$f\356\253\205\245\213\t\006j\004#\254\320\027\371\f\371\034~"
+	.string	"\351\275G\037\004\360\b\001B\362q1\322\224=E\n5\354W\013K\366\277_+\201\214\023\213\233Rv)R-\213\212%\036\266\217\261\255j\033\034t\377B\327UN\337iw\026\230 \340\321\235\215\362i\332keBb\204ew%\334xw\355\374\207\374\342\221DW\013aw\255\036\251\342\206\267=`\033\263\335\021\b"
+	.ascii	"3\241e\037\270\ts\213k\342z\b\271\244&\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.156.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\r\b"
+	.string	"\222\31775@\223\032\003\030\022\013\353\377A\323\2141\310 2\317\310\255\273e\246\270A\032i\303O\371\266\235\221\277\026\314\272\002\343\262\260\263\205\344P\367M\352\311\337\244\2242\245$\355\"\024+\0025h\243Y\212\200\320$\036&\205\026\232\230\"\2164A\003\335F\016\334,m\0337=\260;\036\256 \374\240`\006\206S\032\343\374W\250O\214RQ\273,kazNY\326&\330\221\241\336\254\205\235\036\fi\035\017W\355{\205~\331/\026\2606<\334z\3719f5\217\221\262\221\266]\353y~\325\245\235\037d\245\345\177B\0178\226mk\022\227tm,\302D\\\0043\037\032*4\377\347\307\002\033\313\350\200\215%d\271\363\353j\233\230A\246\005\223R\235\374"
+	.string	"\026\376\367\245T\035.t[\203\266\bmY\002\013"
+	.ascii	"2\241\245/p+\n\"\026\017b\002r\r\327\304\342\341!\210\250p\003"
+	.ascii	"PyL\355$\003"
+	.text
+	.section	.gnu.lto__reset_template_240.4.158.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`w\001\335\r"
+	.string	"\266XYB\320\334$\303\001\b\030U\234X\334\366\351G\365\016\267\345s\233\235\034\016\"\363\301\017\026\016\230\n\b\ft\344:\3660\202\\0\025\275\340\007\007L\305\004C\201.\201S\252\337"
+	.string	"\004\001\307Q\364\266\215\244\035I"
+	.string	"M"
+	.string	"C"
+	.string	"\332G;9\027\370R\317\354\251\035\264\202E\002\027=0$\034!|\271\301z,\2454\002\276T&\034c<\342\227\2673\2064@h\354\310\330\351\250\363\252\026V\304\216\bPK\360\003\247#\201\257\323\261\226\205\035a"
+	.string	"\b-\236\034\236\035\366<\254\345\303\035\210W!6\022\3616\342\216g3$\376J\374\231\270\350\304\037\212\024"
+	.string	"\330l\231\313Hw\331\313J\217yp\031\007*t\036J\235\224\275\244M\206A\204\257/\251\301d\207\321\026\323`\301\246\235\244\300\344e\037\005\005\262\327 \317\n\231\353\220\273\022\231k\221\273\032y\026\311?M2\225*yv\311Ee\362\252M\256R'\317>y\326\347\255@[)\3677a#\n_\251\360\312\302D\027\3760\374e\030\213\206\263lx\006\320"
+	.ascii	"\312\004\241\005\367\221g\376\221h\006\222j\336\344\2329\331"
+	.ascii	"f(\362\315Q$\234\247\214\263\224\276x6\306]e\034\324\031\317"
+	.ascii	"\322\230k\215gm,\324\033\0175\307\263:Vu\307\\{<\245>\236\375"
+	.ascii	"1Q) \260\242\302\353\337\"\334\306\\\202\033\266xm9\2522B\355"
+	.ascii	"Z\342\"&\006\2068\255\373\262\312\016+\266pNc\"\337\204\332\360"
+	.ascii	")\260\037|\035\013\336l7\332\344_W%3.n@\273\221\306Ht\333\332"
+	.ascii	"\030 z3\366=\003\265\223\221\271f1\016\007"
+	.text
+	.section	.gnu.lto_pidLoadBiquadFilter.part.0.201.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`@\002\035\020"
+	.string	"F\035gF\360\260(\035\330sW\247\242\347\253\353\305\352\372\037\254\021\376\307\234\352>MG\317\325\314\b\341\375{\032\352z\f\365\226)3\257}\275\216b\3639|\034\026\037\203\345\353e\320\214%\270\233\202\252\257\214\330\275\267\334)\005N"
+	.string	"V"
+	.string	"P"
+	.ascii	"\353\232A\263\373%\270\364\201\355\322\337\013\314\313\355\004"
+	.ascii	"\346\245\375\022\266Uv\355\237\210U\361\312\256y.\354\311\202"
+	.ascii	"\226\031\f08v\227\273\324\020_]a\\\371\254\225\223\353g\207\254"
+	.ascii	"\225\r\207\003\036;\rv\327\033\207[\3366\3106\003\033\306\002"
+	.ascii	"\233!'\307\202\2205$.s\3730*\177f\017\333\2271H\210\3521&q;\334"
+	.ascii	"\206\215\013m\367Cpi\tm\220\220\325cL\376"
+	.string	"\031h\315\\h\n\266K\017+\274,\206\322\030\312\023`Sd\037>\020\376S\375%\345\371V\203\212!\264o\342\260\325_R\027\260\001\257\2505\243\323D\034\030T\025\236\371\260\331]\220\237\202\002IJ\006\353\206M:\212\322\266\233\002\362OT\220\340\217\270\364Q\363\022\252\327\252\361\202\241\300\034\250,\326\370\270\352\262'tgB\317\t-'t\374\367\353\204\206\227\375\007\020[h|x\330\235'\34290u\035I\007\251t\022\305S\347\225\214D\323\241\317\203\221\211\363 \214\214JD\\\204\221\b\211\013\235&p\037\217K\246\356\304y\245\322\211\203\217\253.o7,b\240\250\005\353\343\356\256*\213\355\216\302\b\375EG\275\326\315k\252\213\356\264\211#\265\305\310WH\365Z\265. \300\202\231\271\323\001\3342\210\262\f\f\214!\006bf\200\205\350Ph1\214\003\305\270\204\017E\213\3158\020\022]\023\266\204\200"
+	.ascii	"p\243\200\027r`u`\210\240\3445\330h\322>Dy\230W\270\002\223\330"
+	.ascii	"f\303\316Q\246g\315|\353\341\032(\326\034\261\\\221\263;l\006"
+	.ascii	"\013\026@\267\347E\035\320\316\023\326\030"
+	.text
+	.section	.gnu.lto_pidLoadDtermLowpass.part.0.204.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\235\002-\024"
+	.string	"\026\244\200I\3200'\035\374K\330\037\332#\2150\346Z\237b>\363\030sd\207:\200\f\336\262\034\262v\b\202i\276\243~\323\3509\344~\217\210K\377\354{`(Z<\314\270D+D8<r\336U\364r\207\244\354\332\244\221M\366N)d"
+	.string	"q"
+	.string	"h"
+	.ascii	"\003vyj(\355\226\r^\255 |uy\003\340k\370\002\340\253}\024\266"
+	.ascii	"o\266\324K\237\2651\316\226zi\330\334\203\037+\016C\275\335\025"
+	.ascii	"_i\211\343^?:A\234\317\"9zk\206\314\275\316\031\362\346\337\007"
+	.ascii	"ys\n\200\324} \273\373\246O\032RfN\002\007Y$\273\353\360\303"
+	.ascii	"\315\272m\n\266#\330\223*>9\273\335u\275\"\201\344\312\255a\355"
+	.ascii	"\360\242v=\226\017\271\2746w\003\266\263\353\355z,\323gq\363"
+	.ascii	"\217\354\262}\243\242\026\220\034\t\006\257\006\213Z^e\202\020"
+	.ascii	"J\020\302W\227\353<\221CDn[S\247\035\"\202\373\220\313\313\003"
+	.ascii	"9N;'\007t^(\350\205\006\275\274\004\254N\350\t6\347\313\333y"
+	.ascii	"0\257r=\330xN\373)\016\204;\017\346\001\2646BG\025P\314\2742"
+	.ascii	"\375\334\335\034\245=\266]\300S\020\035x\250\310A\303\206n\356"
+	.ascii	"\230\264\307\024\374vwMy\354\227\377\327\232\246\027\372\347"
+	.ascii	"\211\376\267&\016\002\234\335\232\253\036\253S\227N\234\351G"
+	.ascii	"\372\215N\355\373Ko\032_P\022J\207i7,\006\252\037\253\251q\201"
+	.ascii	"\f\320\214\321\276\213+\331.\263\274\205\237DI\250+\022^Rh\264"
+	.ascii	"\030Kf\213\331&\320d2\224\226\312X3\371j2[\312\314\004t\t\254"
+	.ascii	"\302\214&\332,\234\314RL\304\225YLE,\251\265\210\260\227G\232"
+	.ascii	"\254&\332\306\261&\316\177Ky\216\036\256 \313\252\251\030*cZ"
+	.ascii	"?vxI4\">Jc8)@\324\356\216\3700.\304J\300\327)c\006\307\233,\373"
+	.ascii	"\323I\270\253\033\361\2352\314|\023(\340+\r: \260\002\221\271"
+	.ascii	":\007\3302\210\277\0026\332x \303*\327<\221 \223\242\335O\207"
+	.ascii	"\245\233:uN\271\fq\353\f\177I\237\026\362t\"s\327\373\025Y\225"
+	.ascii	"\233\263uD|\3042\361b\207N\033M\254\2200;\363\b\024M\2151\210"
+	.ascii	"]\320\255\302\362lY\261\365V\327\373_\004\365]\030\331\271\033"
+	.ascii	"~\303k\336\226\234\361f\224(\211\354A\222;\254\006\273,\020\373"
+	.ascii	"\275.~\3052hz\221\365\256>\006"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.part.0.220.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\237\004%\035"
+	.string	"\0265\264E\240\234I:PuB!\005\371^\226>\300~\275Li\034\201\234\354\372\275S"
+	.string	"\003\026\363Ka\031\007\020\262\212\226\332\334\272tta\021\307\201\243\002\227\362\234\236\230\332rH\365\341H\235\371\326\032i{\223-S\n\232"
+	.string	"\234"
+	.string	"\234"
+	.ascii	"\227\266K=\317\350S6\224\267LL\216j_\352Qt\237\262a\271\373\264"
+	.ascii	"\265e"
+	.string	"\227\007\341\322\r\300\313\234\027\230\227\372\001\363\322\376\023\333FL\326\331`\347\021\331c\245\301Q%\266\273\267\3138\304\361\037\357\236\251\356\340l\312/*M\347\3172X\375\023\222C+\334\035\035\374r\31205}\022T\307.Ig\032.\371\361\251k#\303\364\270\302\235\217\1777j;\245Y\240H\226\021k\270[\212\361X\377\230\224\365\302\335\217\253\200\323f\031v\327G\002r\327n\333\211m\020\366\267#?\323\347\362.?\376\021\347\\\350\303K\337\305\274D1\325\304\t\212\033$\355i\214r\244E\250^\257\007\307\021\312\266\321\324\265\251\246\201jp\246\236\375\352\236S-\247\372;\357\217S\255R\375\001\332\264`k\227G/\316>\311.I~\365O\371\253<\332\367\257\334\212\217e\333\225\221\231\260<\213\356Z\234\245\243\304\333\035\21121(b\273\353\001\274\324\371\244\334\227b\344W\335\312\266*T\250 \301"
+	.string	"~\212'T0:U\221\036\330\2437\016.'T\320\235\252\3509\233d&\244"
+	.string	"\0062\316\242\035B\204>\264\377%\303\200Wh[\350iF\\\360\332]\013h\356U\302?ri\023'N\314\313Y|\350C\200j\374\242\235B\205>\224Q\347F<r\214_\374R\230o\346g\214\305\343+_E\251E\346\244\tI{\276\230+`\323u\244d\216\377\356\"}]>\031\345z\262\206\313#\216\222}\332\235-\177\214\301\300\335\243;\375\t\246\230U\002\033&\031\013\333\335\0350\276\223\375/ owt\224\264\314~\326\275\024\365\340p\363\3621\310T\227\223TS\334\335\243\030\243\036C9\032<\037.\250\006\211\332P\216\206\206\237\031+p,h>>@D36\b\341\210^\344|"
+	.ascii	"\270'\002\213\\\320\215\250\305O\356\205\317-F\216\007\306\255"
+	.ascii	"Gh\350\026\341\200\201\202pB7\"  \241\233\376\033\241\254\376"
+	.ascii	"\034ezt!\305$0F9\300\327\264EYD\035|F\035\266\r\3413j\024\252"
+	.ascii	"/%\205\343\370oww\366\3403\332\342\267\312zKNI_~%\3031\031(\030"
+	.ascii	"i\261\026m\335\023\235\324R\033\030ltS\257\"\022\3665\0326p\340"
+	.ascii	"0/k1\322\324\034\254\203\207\017\372\360\303\274\004\243\324"
+	.ascii	"*\033\343:\001\2561\211@\003b\250a0\307\020cDF\206\204\244 I"
+	.ascii	"\322\001`\002\2312\263\035\021\220\301c\246\005j\317\254\256"
+	.ascii	"V\213\230tp\256\204&\031d\245\377@\313D\207#\342\016 \377\013"
+	.ascii	"\231dH!\262K\027\310\271\302\260\200\235=ril\264\205yZ\341\261"
+	.ascii	"\204\3016\301\371\302>\242p\246\264\036\306\b\233\244{\310\363"
+	.ascii	"Od\300\276 \346\003\245/wSO\213\232E\256CJ\206`\271\377aXh d"
+	.ascii	"\260\336\277G\212l\233\212\343Da\252\3101\261\312#\304\002~\303"
+	.ascii	"]Z\n\271<\t\352C\273\034\310y%`\315i\303\025\004\246\021\370"
+	.ascii	"\330\f\006T\031f\316\232\375\3724\316\254!\263\\]s\315\0207\304"
+	.ascii	"D\317\330g\025/\334\340!\225\313 z\325\260,d\356\354\016i"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.part.0.221.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\320\003}\031"
+	.string	"fo\236E\300\332(\035\220\210A\240\3670\005\253\345\353\365\021\\\270\2610\255\315A\261`\223\234\005\314\253]P!\305\177{\003Pk\262)\326\304\214b"
+	.string	"B\026\242\bsE\321<\252Y@]\214X\035Xk\204\220M\344N)\207"
+	.string	"\201"
+	.string	"\212"
+	.string	"\272\245\321\254\322\276\221\037\201\035\t\f\317\335\333\226(\273:\b\237f ~\022\370\001\360S\336"
+	.ascii	"\370i\277\210\355\027\3150\273\314uD\213 G\003H\t\232\335M}*"
+	.ascii	"\017\353?\335\rJ\330Cp~*E\230\377\242\177;F+c-\366\360#\260\273"
+	.ascii	"\002j@\237\0049\243&\223\240\034s8>5\350\314w\244\347\354\b\342"
+	.ascii	"2\326n\\g>\340\201\036<\037\246Z\f\2257"
+	.string	"\027\303\n\273\353\313lw\351\266\207lS\2605L\377a\025<\362\343\247\317\243G\372G\304\346d\210M&{\326\353\356\306\244\016YE\305\365z=5V\234}\022\245MS\272\024J\213\240t\370\243\033\234\322sJ\177\327\375:\245\345'\375\002\322\326 \313n\215\336\232\275\315)@~\364\333\367\217n\344#\371\304\344e\324L\2675Z\221\317\344I\256\004\366%\346}m\354\203\210r5\314\354\256\203OO\020?Q\337\375\242\227}:}\312\353^G\002C\006]\206|7rj\250\266\207\017\362\243\375\244\236\0331\243\355\326\271\200x\0221\273KA\313\267\210\360\177|z\004\t\022\340g\250\037q\f\220R?\265uv\344\307\251\250\030\032\263\352\247\3771\343_9\026CA\341\235w\032\302\366\344RnBHRL\262\261\376\273+S\035\262\253\370V$\357\366\333\346t\004\331\333\342L\361\251\270\214\270\033\273\320\257"
+	.ascii	"\224\262\013*\304p\271\0348P|!\373;Q\2678\250\231lc\277\311\235"
+	.ascii	"\254\034=\253\027%>\225\212\345rq\241\265\343Z\261R\001\260N"
+	.ascii	"\204\023\253\026)W\n\024\253\025\252\024\213U\t\236\224N\253"
+	.ascii	"'\025\001\201Y-vZ)\027\213\325J\235l\313\177\025W\364\313\350"
+	.ascii	"\302K\222\251O\250C\236=D\007\017@f\236\024\324\031\020\016\252"
+	.ascii	"<bDf&\325X\377\355\356\202\017\016\352I\023\030\311\350\375\b"
+	.ascii	"\371\354~\311\006h\242\244\250%5\251m\341\302\317\030\226\030"
+	.ascii	"\f_B\004\346a2h\310\311\001?M\252%/\377\262\201C\007\371\261"
+	.ascii	"\003\370)j\b\333.\r\357\362(Q\250a8\305\024bFfdDd\302\266\225"
+	.ascii	"\003\200\002\221\2622\017\020X\211hA\232\003$\204ie\227Dv\005"
+	.ascii	"G\270\3733\266\005um$\263\001D\207{\201\377\360R\310\374w\313"
+	.ascii	"\252+\202\255 X\325\177]\311\250Z\250.F{ \301\334\302\t\001\334"
+	.ascii	"\307\256\217^\2078\351\303\301\352\035B\204%\355\306k}\021\330"
+	.ascii	"\371>LN+4 \343\367\312mtSv\225\314\315\206MY\030o\026\215\033"
+	.ascii	"x\311\235\005{\354\266\226\004\031\266H\226\320\354L\374\021"
+	.ascii	"W\233\263\365\336Qrg\226\2201-\255\334 T\001P\202F\201|\352\001"
+	.ascii	"\223\270s/\025vk&\360\037"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.part.0.222.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"M\013"
+	.string	"\026\226L?0M\225\016@<\225O\324\353\260&\264\377\325{3\323=(\306\350\370cK\371\023\n\351l-V)41\0318$`C\037|D$*Y\246hO\031K\204@\3443"
+	.string	"b\331\320&R\246\0249"
+	.string	"9"
+	.string	";"
+	.string	"\020\373\305\343\320\376\005\333\036\221;\373\304\277\t;\261`\202\001*\305\356\306C\225\360\356\232X\347\377\364\2107\372\\+F\016\236\026\307 "
+	.string	"v\327\331\203\033\3366\207\355h?@\231\316\177\377!\t\241\303\265\333\340\345\332\b0\004\005\333\267\177\362\330\022\311\241\355\314\177\036\354[\223\310\231\3661<Cw\rV9\262+b\005bw7\016\255\221\035f\034\343\361\036\nP\276\234zU\205$\026T\b\345\313Y^\277\341\035:\331.\350\236\217:\207\003\276\351\320\234N\336;\364;\b\022\344\275TX\2425\202\245@?\251%+vlw\327J\262\006\226\f\307i\333\205\313\\\241\f\300l\"w)\200\311\020\210\0060\0024\261\262q\"ebmc\331\"\247i[\224\034[%9k\255X \rYUK\266U}\017\377`\225o\262\306)\247P\001\025"
+	.string	"h\213!\266\002\343\001\221\330hB$\326\262\031\3242\255\202\367"
+	.string	"\n\027;\266j/\r\r\201\\\235\241\211g"
+	.ascii	"\233\311;\315\002\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.part.0.224.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`6\001m\r"
+	.string	"6ZZB\020\221\223\016H\263\030\004O\332\335\006\326]\303\200\202JhH\354\273v\376\327\376\204\241t\237U\227!\324w\3024\242aT\333nG\002"
+	.string	"\005 \"T\020>\232\b\303\272\216N^\212M\032\331;\311\224\002G"
+	.string	"@"
+	.string	"I"
+	.string	"\004,\277\326%NT\332\326/&!jQn\363p\002y\231\261 \223#31\277\020\017\250\374\234\005T~\357`\221\217NT;\306\tF/P\245\025\024\337c%\2031\200\335\006Af\326\322\340>\267=\320\326@\353--\275sy\226\226\343\315\265\020\273Al\205\330\207X\207\330{\263\021\261\276\3204R\223\211!\265#9<\026\037Z\307\234\264W+j\257\"z3L\236T\212h\230\242\312\311l\341bEf\026\360k\225K\233\207T8J\337\377\352"
+	.string	"d\324\330 mpw\177\377\240\231\340\031\025\356\036a\242\341\202\367\377W\203\024b\204\251\266%FQ\224\225\231#\365\t\313\204\352\223_)\230\240K~\265I\345\347\373\206i\206\016\023)\230\302\007Z\350\243\205\024\2002-\363\\%\021a\320\371`\032\204\007\235\b\0160\t\235\005\036\214\004T\202\211|4\3734"
+	.string	"aZ\226\201\260\313.\317R\220\024.0\320:\347\027\332r\356\0308D\304H\371\250\377[\332\272on\3754$\020\036X\275\365d\001\032"
+	.string	"J\033\003\344\r\216\323\314\262h8%\004\016\310"
+	.ascii	"\343r\225\306\205   \n\206\271\256\365\215eA\031\204\006S]Y\255"
+	.ascii	"u\260\023b\360\fC\254r\200&8\375N\317\005iJj9\375\3322\006"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.226.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\346\002%\025"
+	.string	"V\346\206J\260\022R:s\320\327\003\347I[w1r\3122;\376\272~\247\024\211-\236M\027\255\244\200\027`\255R%\233Cz}\235\357\3628\212\212\252\366oH2\025\274'\224\364=\244I^g\375O\312[\306\007\263\212\226\354-wJ\001m"
+	.string	"p"
+	.string	"t"
+	.string	"\343\220\301\312\367\254\262b;o\347c\035\312y\245\255\262r;o\307[\353\021/X\353\230\340\324'\"\247\366\231l\333r\276\331?>\356\252\t\323\224\320OXku\235n\210\337>W\322\233\177\337\001\340t<\237\022\247\343\360\235\n\200\204\037\004\350~f"
+	.ascii	",!\036\367]j\320\371HYr\332jPk\265H\207[\274m\b\266c\366\236"
+	.ascii	"\004^\372Y7\311\026\245[TZ\\i\372\336?\251\364\256\264|\323\177"
+	.ascii	"\222\311$\034pT\353\320\020!\025\211F\215\220&\343\216(\327\302"
+	.ascii	"\346\234Y\213\306\035\321}SU)\204\365gD\261\355C\235\205\216"
+	.ascii	"s6\003P\017\b\225_U\020\na\255\243\353\324\343\r\210\247\"' "
+	.ascii	"\372\300\002\273\377\356\244\363\025\276\225\321\225\211Z\253"
+	.ascii	"\216\364}6{d\244i\fE\306\341\362\337\r\033.\b\374\032\227\252"
+	.ascii	"\360\362\222\307\275\304\323\367\214\256\206Q$\322Y\267\224\270"
+	.ascii	"+\256\035#\223\307\371\276\177\303\023\017ih\025\264<>\3603\200"
+	.ascii	"v\3552b\210{\340\\\272\367}\006\235\036\2253]\354p\030\016\303"
+	.ascii	"\302\354\261\253\265.x\361 \215\277t\352\331\215<\356F<\335\275"
+	.ascii	"\323#\224\0201\222\240\001\345\341+\327\207\352)\253G\016\221"
+	.ascii	"\253\024\226y\321pJ.\304`5\017b32\230\031\215\005&c\251\341\300"
+	.ascii	"J\374J\201\311l\\5\231\030\331\f\214\253F\366B\343z\321p\\)&"
+	.ascii	"\236\331\304h\256\332lFs\215\330\226\237u\223\034\250\250C\253"
+	.ascii	"\236\365\361~\326Z\353< QN\327\2260\241*\210T\016\240\345\361"
+	.ascii	"\336T\301\036\322\256\222[;\227\346\363\361#\261\354\353\370"
+	.ascii	"\216\035\177\311\024ZZ\304\323\326>g\004\344D; \200\002\221s"
+	.ascii	"\326\001\3025\f\266m\220\262\366\247\201C\351]]Hm\205\225\244"
+	.ascii	"\024Ld\263\264\342\306\035\306\333\310\255\225\335P\243f\310"
+	.ascii	"g\366\275\025\345\213E&\036\316m\017X\364l]\354^\310<\223\325"
+	.ascii	"p\f\314-\213\263f\242w\2301\234<*\330\352\001@\254p\b\365\017"
+	.ascii	"r\033b\031N\3322\363\330row*\234\330q\232\331\306\330\n\351\032"
+	.ascii	"L\022jb5\ro\347m\267\020joB\034\332\031\367.<\006"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.part.0.232.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\207\004%\035"
+	.string	"\226t\265H\240\230Q:\300t\234;Q\343\007E_:Y\350\201\037\341P\235O\2376{\343\203\034\353\311oS&\002\366\037\367\255o\2156\270\225q\270\034\243Q\317\263\370\0215\2574J\211\311Q\230\356\350\242\024{k\373\204l\271S\n\240"
+	.string	"\224"
+	.string	"\244"
+	.string	"wrR\207\353\304TW\3148\230\363M;\332T\201?\317\371&&:V+\017-U\265\326\007\037\275"
+	.string	"\366\321>\223\335\317\266\257\344Kx6\025mZ\032\032 \0369zb\246\326j\373X{\016\371\221^"
+	.string	"\371q\201\234\367\030\354E\216t\247\214\347k0\nrU\002\211\036\233%\360\306a\217z\202\"?\244\371\312q\2222H\322R\203\006\204As\262zl\315\200Gs\034\207a\350\243\316!8\264R\002m|}Ed\216\220\310$\003\032\355\fp\331\213\247\326\352\367t\334\263\333\036\332\346\261\351\214I\377\001\262\252&\340\251e\210Q;Qls\375I\366\247l\357\314\005[\252\277\332Twj\276\271\306\276\324\241\340\374\241U"
+	.ascii	"\315\227\037} \362\3437\202\360\252\013\2517\213s\203^\331\026"
+	.ascii	"\213\305.\257\017\033\0076M{M\337\354\264"
+	.string	"\315\214N\313\346t\214N\303^\3444y\250{\274\323O\307\351}\323?\351\364\007L\241\204\035\265\316(\246\251J\343\224!\207\272}\250\235\037\345\331\323\3165\037\317\177\362\354\211\251^i\324\211\265EL2\246\326\332\340\243+xg\004\244\254\222v\334\033)+B&\335\331\306\210\355\334\234\023\030\337<c\330\306\366Gkz\263\310\245\003\020lC\b\277t!M\375\264\026\230t\311\265=|\230/_YCX \376\244\265\345W\"F\220 A~$\277P\371\3010\341\240\001&\335]\273\204\211\371r\334\232\321\022\331\317\322\202\200Vi\373\305\261\364XX\252\265N\270r+\037\177\370\321\267\237\037\362\343\356\254\313\220\252\274\321\233E\277\352g\372a\021M5\336_H\024V\331\r\332D\277\312\244\242\244T\211P\210T\245\272#\305\237b.X\255D\017\272[n{t+n\030t,pAB\272\033\210\0238!"
+	.ascii	"C8\027=\324>\020N\340\204l\272\024?\270\025(l,p=@6\237\334\220"
+	.ascii	"\r\202\216\203\204n9\233.((g\233\331\236\247\225\222\263\305"
+	.ascii	"\331\030\266q\366YLF\260z[\024\243m\230s\361\224T\320\362\267"
+	.ascii	".\206\307\204\327\344\302|y\201\3748obI\346fi\2533u\264\006\301"
+	.ascii	"\264Y;\203\006\362\345\315\326|T\2172\315WkO\301lmV\247\013\214"
+	.ascii	"\"E\024p\240\221\001\333\240w\216#e\373\037^6\310\326\205p\013"
+	.ascii	"\211\2202\t\353\265A\233\334\240eVO\364\265\001c\250q<\246\f"
+	.ascii	"R\206hDDd\002\303\244\003\220\002\0212#7\020Xi\250\024\322\001"
+	.ascii	"\335\004\234\224\321\204pxx\200\265\321\022\272\266q\2509\245"
+	.ascii	"6\374\037\333et\204\300\005#D\331\032\377\025w;\212,\005\252"
+	.ascii	"\302\021 \213\342\303l\"\323\003\215\275\322l\237\214\376`\306"
+	.ascii	"\354\301\f\370\237_\341\374u\370\013].\035&F\346\354\337\007"
+	.ascii	"\377\214\034\"\214\371\326N,\233\031\322\337\346vh\350(D\370"
+	.ascii	"\254\320u\027\f\270\240t\320\237\030h|\2456\2517\315\267\022"
+	.ascii	"\253\n\027\241\030\246\277~a23G|P\255\277\207\343#j\323\020\240"
+	.ascii	"m\330\232\366\313*\211\263K\240\013\331|\201\264,\372K\240\017"
+	.ascii	"R\204f\244\202\353\233\303\024b\371Q\001"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.part.0.234.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\332\003\335\031"
+	.string	"v.\241G\300\030Q:\300\373}\355\n%Q"
+	.string	"!\355\226j=\036\252(d\375A\344"
+	.string	"\224P\230Y\312\001S\224\241\177\256\214]h\227\372\324\202*\364\200\314\333\206\211\242\353(\342\002v\254`|#\003\0248\372\2374\262\211\224)\005\211"
+	.string	"\201"
+	.string	"\214"
+	.string	"\327\r\201\2729\232\260\252\375\036O\"\272\017\367\234\232\263\t\357\310\234\023\302\245\031\210\2277'\020^\202\267\t/\355\357\260=d\302D\266\227\353\220f\201\2463\"v\2769'\353rk\234\350\"*\224\340j\212\310\017q1\201\f#\025G\251nG\017A\0075\220"
+	.ascii	"O\204J\265\335P\034\274\231s\256n4]\320\200\213('\002\334\212"
+	.ascii	"\300\005O3\272|w\035q\233\251\016x\n5"
+	.string	"a\316\351\313V\334\252\333&a\033\203\275[\002_\335\357N\001\013\257\251\226\233\351O\027\347M\035\234K\3035\252^\251Z\245\352\224\252EU\243T\035\252Z\202\252^\275\356\277\215\216\fX\314Y\342wf\302\220In<\310\213\330\275\033\232\016i\374\316\207\023\017\337\244\315\007BF\0323\214D\322\370.\375!\347\331+\013]\210o42\371\204\356\003\031\362w^\331~\220!\337\320\224\334\3734\232\352\324\305\211\r\314\234\363\301\245#\210\227\253K\333\252\001d\222drq\013\305=\004HO\236b\\\"\303\342GE%p\200\2133j\345n\025\245(_\324\242\244\324|2\375y\2576l.\236vqvOA\270\032\224\250\320\264\214\345~\303U4\265\234\355\363&\367\3049\247\004&r\237c\\\322\221$\003\227(\341\340\006\271\026\273\272\340\036M\r\307L\177{!?\002\023\347\224\335\346\033y\317\345\217\227\366"
+	.string	"\323\333.}X\370\001\204\336\266\273\\rGNE\033\302\356\035\206A\332\2342\005\001\356\301\201\365\304r~X@\256\237\037W\313\300NP\005W*\246\003\333\331\271\020\003\322y\275>\264"
+	.ascii	"\270\205\263\301'\210\025\353\341\361\351\260\303\002\362\311"
+	.ascii	"\371a\265^0\026N\001\273"
+	.string	"\202t^\254\230\313\365b\255\2764<A\2663qq\306\220%\\Y(Zz\361E\246\266fG\3305X\334;pew0\315\310\244\244\245H\030\324\342\304]\255\265&f\246H\306<\305\bU\274\013\370\221\323b\306\312\224*\356\211O\252M%\311\364gqS\373Z\030Y\316\251H\371\224\226\016\017Ox)\356\215F\246V\250\201,\003\025B\306\320\0042\"2\243m1\240\002\031*\253\007\020pH\233d9\364\226JV>\221\241\344\003\210\247\266\221\003<n#`$\212:\t\320u\001Vq\234\316mM=K\260\325\313\022\264\324\272_6V\213P\207\310@\330\376\004@\254B\227\242\341\234]\323\320/\222\313\213a\\\005B^\324\303\234\223\366\027V6\251\317i;\177\235\251\356\033o\233F\341\004A\022M\301_\03401\215\006c\214j\006\305F\006L\003\325s9\t\205\020`\\6\200\304\231bV\351"
+	.ascii	"b\"\231b\027o\2710\211~\221\275\362|\372\036\347\377\241\270"
+	.ascii	"\366\304\252\361\003"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.239.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`K\001\345\r"
+	.string	"V\231[E"
+	.string	"\257(\035\300_e\356\216\356\324\353\376\310\364\255\364!,ou\305\030\r`nH\240\024\232i\3121g\370\207\372\231C\2462\220Es[\274K\272K\377\2678\032\201I\340\326M\347\336\224\246\330\b\331D\312\224\002G"
+	.string	"E"
+	.string	"G"
+	.ascii	"\030\266\023\203\005\001D\315\356\306C\275\360\323a\246\251\235"
+	.ascii	"\374\355\323R\221\232yu&\207\211\322Mx\266}\276'\213\3147\363"
+	.ascii	"\352$\\\001t'\331\200\335\275\367\214\320\2452\003\\\333>\273"
+	.ascii	"\353\r\205{\273m\220\355h?C+\273)\261\031k\001\226\320`\373\376"
+	.ascii	"\207\177\244{0\202\026\n\326\356\222\356{&\233\303\261\346a\354"
+	.ascii	"\3610\335U\272\267)*\326\264=\036\247\273J\235\323\304\274\234"
+	.ascii	"\330\3658\016\275\2619\264\337\301\266I\305'\373\305\275,2\254"
+	.ascii	"\0027\360\030\233\020\300bw\017\370!.\342\201\277:4II\036\345"
+	.ascii	"\320/\321\016\377\235\300\006\027\253\226\027\032T\306\254\317"
+	.ascii	"\3355QU\331.iW\375`0\276\026')#Ue\325\262U\027\3730\377\267l"
+	.ascii	"y\002\240\321\307(\001\t$\2621H\207\202\320H\0345`\020r\260 "
+	.ascii	"\212\204>B\"\210\210$vt\314\215\200Dq\304q\242\310\261\235\317"
+	.ascii	"V]\254\261\242K\201\322\024T\225\372\260\223(\371+\207p\234\367"
+	.ascii	"\r\016\260\232\026\327\n*c\031\307G\274^!  p\202\231\303\362"
+	.ascii	"\323\031\230\002\277\247\241E\370%\263miE$\266\003 \033\271\033"
+	.ascii	"\223z[\360W\026\320\362\360#:\303\214k\241\316\210\330\346\336"
+	.ascii	"\304D\330\372\261v\003\304-\261\244\254\031 \265\267w\347\203"
+	.ascii	"\274ki\265\365\2047\006"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.part.0.240.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`k\005M "
+	.string	"\326z\311G\200ZN:%\330\317m\277\342\234\0227b\313\025\257f\344\376\321< \245\230\005\b0\376\243y\023\177\240\001\255\n\333\217\343u\241y\224\301i\324\2209Op\275L\021\333\307\201\033\363P\351\017\n\262M\032\331D\312$\003\260"
+	.string	"\252"
+	.string	"\265"
+	.ascii	"Pv\3151\336\217E\355\232\3462\177\0305\016k\027\3262\357>\354"
+	.ascii	"b\347\237\254\332\356j\325\"\266Vk=p\272\004\312S\243\367\310"
+	.ascii	"\323\361A\344\351\356\235\354n\024\326\356\271\273\346C\256Z"
+	.ascii	"\004G\264\212\022Wk\365\235\266\220\335\366\307\341\227\366y"
+	.ascii	"\336\256\324\221tl6\317\275.i\354;a\226\324yH\260n\360N\227\024"
+	.ascii	"D\006\216\2278\256\373\332\003\270a\345\260b"
+	.string	"r\364q\303\3121&\250\265\036\255\212)\357H\215\217e\215\367X@\253\013\r\236\254\340\330\013\363#\315\315\3160\262\250\230\201n\352\222j\255\373)\035_\235\357.\232\335u\260K\025\004\247+\342\307\027\376\310\323\367\315Na\307\227\0339\261)\236\303\275\265mr\034\230\326\213m \273D<\336\241\253}{\314+\264\343\r\002*y\177~\366\365a\336\036\346\345a\336\035\035\257\316\313\276&\345\345Q\336\035\363\226\314\253#y\311\221\2272\357\370\341\337\224\227G\336\033q\023\001`\265\306\2303W{P\266\"/\373\317~\265\367\356\367ikj\347X\315\"\300\315\031\211\362){\2645\317\242*\225\305\342\005\027W\254\26528\224\223\355\315\326|\231\224\026kT5\254YXRZ\274\312\250\277*\302\251)\326:<:\335\004e\017\376\006\241\001\322\207\217\221\200\304Uk]\340v1\024*X\260@\236\376\364\2056"
+	.string	"\360N\363\364\356\005\f|aO\033\271h\2515\233\247\037,\336\313\277\254\332\276k3l\332\246\221\247;}\264\217l_sr7\272\326*5\276\326Z\373\034H\235^Av\246\212\341\354\356\206s\341\260E\247\235\276\336\310\211\361\332\354~\013z\33157\257\037tS\366\256i\025+9\272\036\273\354\007\221P\361\234%[\327Eo\301\"m\262o%\247\303\265d\241\375\266!b@\334\275\353\001\004_8\366\303zT\265\324\276\271i\225`qW\351mKe\255\025i\317\366+L\373\256)~,\224F\024LO\023\232\232\200P*\226xL%\240\240\200O#\240\312]B\020\342\347\344\203\032!\342W\242\311w\342\247d\302\267\364\224\302\207\240h\201NLO>( \360\311g~\354\277\"\316"
+	.ascii	"3\325TW\274\222\250)Qw\364^\217\255\264\t\343c\327k\2422\005"
+	.ascii	"8\250\205z\210\310Y$X$q\0369\2333\211\206\257Q3d\266\020\361"
+	.ascii	"hN%'\223\363\353\374\"O\203\372kr\036\307\213K\256\334\2660/"
+	.ascii	".\035\017H\242\306&\016L\313\212\354\2555\211#PSb\037\335\247"
+	.ascii	"a\034\270O\363\0222b\177\244\275\265\273\006\356\323@MT\306\243"
+	.ascii	",\250%\200{\372\247w\317\260\363\t_\270{2@!3\302\335q\250q8\304"
+	.ascii	"\214bJ\321D\222d\246\255\034\260\002\231\"\233\007\021\260\265"
+	.ascii	"c5[\220\373\006\017\004.\244dHk\016\306\223\035\341\004\263\374"
+	.ascii	"\240&\275\353}\201c\370:y\240\244\204\214\244\332\241\224(\232"
+	.ascii	"\233\257\343 \354\200\020\213v\353\rd?r\377Nz\022\226\215C&\362"
+	.ascii	"\007\262\b\255\304\266\201f5\217\030\345\215\311/~\021\214\225"
+	.ascii	"m\\4E\312E\2370\321:\0264\001\374\313\033\255\230Eu_\002c<\305"
+	.ascii	"VJ\300\220\031\341\234\355\237'!3b71\220\274/\322\017Ng\f\355"
+	.ascii	"t\327\016&i\343\213\020b\322\342\320\221\260\200\301\301\267"
+	.ascii	"\3031\"\243\b\314,\323e\022nW\001\211\3052\221UNm\373\302\212"
+	.ascii	"\341\026\230+*\025\030\307\365\334\024\253AH\221\030+\351\266"
+	.ascii	"\303K\360]Wb!\375\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\314\020\3158"
+	.ascii	"\232_h\024=@\246J:[\376\206'\020\251$s\224\025\rMR\223+\327N"
+	.ascii	"\216\222\361\256\013\231\227ALkPOz\316\333{\273`\337\001\374"
+	.ascii	"\356\343-\214/\352\250J\207d\325\306\200\335\037\321\233$\031"
+	.ascii	"0\001(\001I\001\222\254p8\2534\0132\2514\007:\343?\347\224f@"
+	.ascii	"&\n'\245Y\317\314\024\247F\366(\375?(\\\351|\322\3673\353;*c"
+	.ascii	"F\347\311\372\214\234\364\223f\223\276!s\214\347\236\366Y\363"
+	.ascii	"L\372\204L\"+\032r\242\243\334\250y\321\231\n.\351\367)a>g\222"
+	.ascii	"\346M&\017\221\360\337y\321#|w\362\320\bO\312\300\205\2120K\204"
+	.ascii	"\t\r\341\276S\b\3579\037\244Y\323\023\220fA\261\276\335\217>"
+	.ascii	"\036\037\277\323\243_\306\203\r\235;\372Ttp\362\034\314\321?"
+	.ascii	"3q\364\321n\364\233\2306\372cf\330\235\324`\243\023\215>\231"
+	.ascii	"\tv53\330\322\327e\374\315\031\243\377\304d\030\315\230\314\027"
+	.ascii	"\3752Z}\365.\372mo\301G\324\2102"
+	.string	"+X\262\350\217\371].\227\201+\232#\231\024\030R\005~d\201\035\251\3406\005#:Qh8O4\003\232\023\256f\022\215p&\232\375\230<,\261!\002\037\"q3#X\356d\346\005\"\216\346\274\314O\321\020lw\2421\271#\003\242/\345\t%\022Q9\314\315|w\366\243(\212~\350G1\231Y\252.Q\255\240\324\215J\357\200\221\036\2225I]a+\\\205i\013\245B\245\377[@\341\275\232Ix\301\002\205\367\351/\212\242C\306\004\340F\035\317F\024E\371W\230<\337\321mR\304\277\177\372k\366\372m\374\364\335\350\365\353\372\364\317\344\365\303\340\365\213|\372qw}\344\236>\235]_\216\236\376\\\236\376\212\247\177\254\353\333\241\353\033\221\3759w\372ok?\315\\_\314\261\317&\327'c\354\273\331\351\203\251\323\377r\364t\372k\350\343\372^>\307\013\216\351\3440\236\223YF\020\031`Ah"
+	.ascii	"yc=q\030\357d6\"\026\004\310\2150\032b0\302|H\340\247c\207\303"
+	.ascii	"}\3167<\350t\323\357\322\246\317\205M\177\313\232~\232\232\276"
+	.ascii	"\2264\375,h\372X\3143|\307\314\341\3120\037\206\323q{\235\223"
+	.ascii	"\f\257m\2173\346p\316\263\235\315\251\274\230\376\025\265o%L"
+	.ascii	"\277J\261?\005L\337l\255\237~\3513Q\353\023\275\364\207"
+	.string	"f\227>z.\214<\277\245y\231\326\254\324\322<\350\224\245\371\322\2614S\272\322\354\327\350h\315\001\274\b\257\316\332\026\033\357W(\034\2504\334\257^\367)5\363\272P\352\237x\335\267\231\272\356\223\n\330u\241V\"\007v\335'\342\026\327\375\261\212\353N\rH\376B\330\272\002\216\277\203\255\373\344\337&\315\216\221\003\b\367\353O\263S\244\346\001\204;\325\336)o\215-ju\242\205\005gx2\255\033 \275\311\022\337\274\211\326}Z\177\001K\246!/\265L?t\336\332^\246u\255\2227\261\262\256UZ\240\235Z\277\300\255\222 Vf\335\001\351\025\220-\003?\226u\301~\251\262n\230zv\004\351\314\312\214\365V|\351\330Wz.8de\254\304\272Si\332S,\023\356K%-TX7J=\2008=a\316\344\312\274d\005\320\240\023\257nT\362o\023\374\303[\300\340B\255C\006\367)\221\301\365\320"
+	.string	"]p\255\322\363\\\230GsS\351\331\270L\260\241\316\016%\336\224\340\342Hk\2643\322G%R\"b\245\201{\301\244T\325}\235tS\325mp\346\301\252;\244\035\242\002I\305\326\263\237\034\273\250G\312c\275\231w\351P1\307\232#}\227!?75\324\257\366K\265Z\003\245nU\n(u\013\254G\200F\347\2153I\335\374\365\267\t\376\3411\222!\335\023\327x\345F\367l{\347?*\\\025f\235j\\\231\361\346k\357\346r\271\324\304\254\223\t\267\376\201Z\037\332\313"
+	.string	"\3273\241A\262\274\243\222\326\233lfQ\034\251\212VD\351OCX,\261\322\316J\005\247^\202r%C N\361Yj\002\277h\2459\376\3621{;y\016h\314\324\262\230\275K\210\277\t\230\275D\210\177 @c\245+f\357\220\342\r\320\371\0012\300\354\025#\236\225}hq\f\326&\314\336\260\"\263\367@{.(fz\274d\366V\265\207p\244\003T \275\360/\017\023+[)\314\336\257S\230\275\r\316\230\025\004\263\254\3439\356\273P\304\237\345\230\357\276\215\302J\346\343\301\263e\313F\026tO\374\263\214MY\303\201\003m\361\336\025\036\177\275+,\376z\027\252X\305z\367\252\317\355\300\305y\367J\310y\367K\003\343y\361\335\375Q\260\213\367\334\006t\027\214\221\027\252e\344\025\2527c\344\007\337\332\002\377\204\221\327\003\025\317\335\253T,\347\266\347\366\247"
+	.string	"\313]\241\372\fY4Ia%\3139ab\343}*>\201\030\250Q\024G\202\311DD\nR\220$\035\301\005\3041\307\312\352\021\260\230\263\f\031\021\021\021\221@\304\246\003\330A9b\350\221b=\231\335\326\021\003\307D,\340\350\200*'\335\033d\237\357r\001q<\316cz\250\023{\rq\\AT\251m\347\222\373\235\024N\020\220\001\225\264cE\264\2074\256\302\n\273Z\276\3146\030}\232*\212z\365\037\356Ye+\375\001\234\223G,\021\3167\212\256\306\255\265\357\371Z\"\330Y\f\225u\b\3078\220\303\344\253\223MA\013\032\255\352wk\256\203\253(\256"
+	.ascii	"F\352L]B\327\312\230\274D~\376\271J\261\351a\017 \2107\237\301"
+	.ascii	"Y\334\240p\035\353\232R\332\342\f!\361v\007G\024\001\240"
+	.string	"y\030\266\202\271\0207\300\2626\377fq[4\364Xf\315\b\224\237\224\335\0066\361\270\260\303\247Ck\210\237\355]\202\247\261\004\016l-\354u\351JV)\024*\005\205J\245P\250\024\024*\225B\241RP\250R@\242\227\360\363\362$\201\301pkq\210es\275\275\233\3702p\023\022\330\310\342\306w\374\261\327\270{\265\321;\031\271\214=\202\373C[\320\347\007\226,n>n#\310\030\024\231X\334X[$\232\233\210$\356\362\221G[\245i-hH\263~\354 \f\306\nn\247\317\004\262\341-\266%\301\357\244\376!k\362\013l\270<eW4l\300\001N\362\037\036\252\b\267\032f\211\2738\002\205\356\336f\325kY2\237\225\202\t\241SLV*X_\220g\251s\210A)\301\002\3511G\21408B,\344;,\315\3133\017\253tR\036\003\331\244\200\300\035 j$\274\b\0308`{\350\274\320\031"
+	.ascii	"\001\215Y\021\355\304\017\357\024\215\265\306\274E\023\221\210"
+	.ascii	"\356\\\327JSu\370\356\\)\323\311\2111\263\320\227\253\340\312"
+	.ascii	"\350y\264aE\241\020Q\0160j"
+	.text
+	.section	.gnu.lto_.refs.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\372\005\375!"
+	.string	"\232O\240\rC\220lI\241\003b\367&\335\031r\363,xo\327\254\215O\325\306\317O\t\320\246\342\0033\"id\247\023\351\375\353\326\367\347\233\332,KC\021\001\303`\377\366\333tmm\233h\333b[l\204\020B\344N\001\273"
+	.string	"\303"
+	.string	"\303"
+	.string	"\237\325\267Z\372\021\374\003\340G55\375N\314\225\226>\250\037\366\275\246\317\335L\267\027\323%\f\213.\277\212\367^\375.1g\320\227\352C\201?\240\317\224\373\\.O\312=R\337(\227\313\226>\225N\302\235rp\377\3277\200>\0345f\304|\177\230\243>\230-\267>\026\332\017f\324\035|\357u\324\267n\375\352\326\027\334:\025\355\247\220z\324\367\005\216\272\356\326\225h\177d\324E\334\207\267\016\336\372w\353\336\255(7\216\250\027}O4\324m\337\327l\235\366}X\353\337\367\025\352I{6\373\013\252,\327\211\371\221\370\270\260\027y?\324\017\002_\374\036\364\336\353g\317\331\207z\002\nr\256\361\271\232o\215\277e\225kY\345Y\343cU\345WU\371\202\361\251\234\362)\247|\034_\n*?"
+	.string	"\225\033\030\037*A\177\032\337i\354\003\250\272\200\361\003\214\275i\374\246\251\\7\325scO\352\033\365q\243m\f\032\037\354\177\343\b\242\316\243J\345S\273\034\301\356\245v\271\201\376S\231v\257k\312s\273\034\332\275\030\365U\272"
+	.string	"\321V\272|\324\345Q\272\334\311\023\202\352\223\354\277l\t\3770\357\327\362\245\313\273\274\267\352'\350S\205\271\201\357\243\302\207\352\357p\237\364\275Q\370\241S\367<\002\267kK?\353\267\017\360\220\224\026\340\375\324'\320\327\365\213Z\353\213K\377-\035@\366_\273]\276\265\024\003\230Mnt\233\315\017\275\346m\257\311eJ\337\325<\342:\247m\021\031\"\237e}\220.\377\274\007\361}H\017g.;t\241\261\323\260\372\f\227\313\276\034\244\221\371\004\347 n\310\033\346)\246\206f\310\253\225\347_\211\241w.y!\357a\026z\036\226\025\362\f*\205<\211\252#\321\236\210\252\327\276\247M\020\377\006\313\275\\\336\\J\360.\262\3455\333\323\3723[\016\332\376\263\365\0165\2028N\227\333\274\247\375\365\"W\377\266\n!\\T\360\341\230\177X\275X}"
+	.string	":\350\236W\236D\355\352B\\}F{q+\265n"
+	.ascii	"^\343\3524\332\313\266:\250\365\231\225\f\302\301\261'V\257\272"
+	.ascii	"\327\202\274\253\337 \177\247\343\351d\312\302\223u;\305\352"
+	.ascii	"\212\261U\300\311\024(N\344\337b\271w\230\330&\274s\260K$\211"
+	.ascii	"\274T\302\274S\244\f\347\033\005\312\023'M\226\314\345"
+	.string	"\233\004\t\021!\3377\310\217\036<v\350\310q\303F\r\0322\304\274/\304o\213@\200\376\370\341\263'\017\2359q\336(}\216\375&\3176bi\320\230)3F\227\247\027.Y\260\350\362\254\"\245\3263\212\023&K\224\034I#\270\317\"\277\371\034\"\344\261<\201<\366\351\003\207\215\0323dT\365\214\001C\314\323\005\240>\342\317\347\016\370\317\2113\266\373\333\f\366\257\331M\377\314m\362\305\334\346\007\223%\301\025\252\276\225\376U\246\372T\372\016\300\327\352_\365\025X}_u\330Ky\177@\227?y\357tX\316\324\317y\275\322b\007v\250AdC\004F\031\"B#\"\"\"$\306\006p\0021G4n\020\310\\\030\016\217\017r\323\354'\235\353\222\306\275\302H\303\332,\023\232\210\210\275\345\211x\004\356P\376`\001\207\310\275\b\304\341\002>\2604\204\351\271\276\"\270i\254\332\006'\264p\373\265J\222,"
+	.ascii	"=\3419\340\326J\264\177\335P&$p(\370@\032\265\247F\004\320\022"
+	.ascii	"\354\272M2\357\215BN\031\312\354?X2m\023\364\326\013\310\204"
+	.ascii	"4,q\336WQ\001\261F\035\006e\005P\256\262|\204kH\336\374\310D"
+	.ascii	"\202%J\300\210Z\372d\f(\271\252\034\355](\331\212\220g\301Yv"
+	.ascii	"\310\025\371\353\365N\025 \f\214\336q\343\005\224\2545\265\004"
+	.ascii	"\336\204@E\350\260\236!\004\nl\266\252\001"
+	.text
+	.section	.gnu.lto_.decls.d1933b172416639a,"e",@progbits
+	.string	"(\265/\375`\370\234\235g\002\352\320\237\324S\020(\205\3514\006\300\025\227\007r\177\242\277\357\003k\275\033\262\"\303>X\353e\2446\227\003\326~\377#\310,\273e0m\333E"
+	.string	"T\200x\212\036\273\005"
+	.string	" F\004\031\226\035\266\013"
+	.string	""
+	.string	"\"8y\360\034'H\222\b\274j>$E\332\226{o\271\245L\001%\013\177\r\275\r\022(oPz\212]\240\364\300\030\232\371\3430X\f^s\032\221\221e\004\347=\241\325\213o\307\r\234\377\203\243\377\201\231\031d\030\017\347a=\254\346.q\032|\3467\017\243\241\322VF*\215\314\341z\240~\266\324\213)2<\234\006\337\035\356d\253\342"
+	.ascii	"\303\f\r\241\016:\350@7\201\342\206\306/\377\327F\3371\372\277"
+	.ascii	":\375\037\030\375\237\234\376o\212>\367\rJ\377S\323\377\211i"
+	.ascii	"\022\027(\375oK\377w\245\377\333\372\253\236\376\352E\177m\323"
+	.ascii	"_\211\350\257<\364\343.P\212\305\247\313\233\036q8\177\265\322"
+	.ascii	"_\267\306U\260\225\273\374\026\f\367\025J\271\333\366\336>w\254"
+	.ascii	"K\323\030\316\327M\355b\357\275\357\267\244j___\337\375\226\364"
+	.ascii	"\372\213\276^\352k$\372v\027(\275\366\241\257g\350\253u\364U"
+	.ascii	"6\372*\031}5\213\276\252\246\257\216\351\253Y\372j\225\276\332"
+	.ascii	"\244\2372\365\335Z\364\323*\372)\024\375\364L\337\264\210~\252"
+	.ascii	"C?\335\372\250\236\276\350\234>\352\246\217\226\351\0207(=\352"
+	.ascii	"C\037\255\322\317v\364%\273@\351\357nP\372\214\247\237\337\364"
+	.ascii	"\263\231\306>p\327]\202\300^/a\342g\223\023\037\fw\226\334\241"
+	.ascii	"\203\3633\021\375\013\"\275}\027D\372\354C?\347\320Wy\201\322"
+	.ascii	"3oP\212u\340"
+	.string	"\035w\271\001\316:\276\201s\034uRn\345\336J\037\034\304\216\333\023\234\237\251\364\357\006\351\331\327w7H\237\241\364\317\rJ\177\214\343\030\353\307W\027\357p\230\253\003\256c\263\325\304\031\337\030:\306\001\224V%\225>g\034\027\030up\306M\315s\201\322\033\247\247\177~\321?\327\364\265\033\242\177v\351\313\274@\351O*\375\263Ic\234\006Cy\bA\233:\\8\037\323\351\377\270\t;\335%~\272g\360\3235s\341N\266\252u\206\227\035&~\272h\360\356\201R\356&\340\323\035\254ds\357\355\241\203\016|\262\262\226HIs\237\220\256\002\304K\t\316\307I\364o\032\223K\333\177\363\324d\305\245\245Q\223\033Z\343\205\354\316M\030>\263\233\247\307E\216y\363\366\320\342\346\334\346\255s\355\3348\227\316\275s\337\\9wy\341\3346\277c.\031\250\2757\234\313\346p\327ny\311\324\2740\367\336\035\bu"
+	.ascii	"L\306E\335m\310\307F\364\261\227>\346\322\307<\364\361\016}\234"
+	.ascii	"C\037\337\320\307V\372\230J\037K\351\237\013\224\336\356\006"
+	.ascii	"\245\025\334\321\277k\364\257\031\375\333Ec\256\033\224fp\201"
+	.ascii	"R\034w\201\322[G'\205\306\231;8\377F\321\277\313\033\206\016"
+	.ascii	"\230\244M\23380\277t\177\t\023\207\343\331;m\357\375\001CZ\030"
+	.ascii	"\033Q8_.w\356\377\352\343\244g\007\007\316\377\235\373\262\302"
+	.ascii	"iK2\301Y\016\250$\r\313\r\234\177\233\350\377wy\275\334.\312"
+	.ascii	"-\304\023c\214\213\031\316\277H\364\337\034\356\377z\223XY2\005"
+	.ascii	"\347_\036\372\227\206>\367\005J\177\233\364[\350\263\352\002"
+	.ascii	"\245V\204\"\200F-\007\316\357\200\376m\233r\270\236uo/M\310\366"
+	.string	"\336\377\340\037\372/\224\333v\337n\224\303}\220\261\267\227,\237&\270(9\232{\357\377\267\312\245r\227\367\355\272=+\367^\356\275;\350@h]\342\343\fF\232\177B\337\204\376\225\362\016N\333\3047\350\367\350|\201\322\nnPz\255O\256\013\224\376\227\355\277h7\355\256\235QS\\{\271\2672\203\212\306\305k\211\363]\303W\355*\177\327n\223\2270q\036\250\235\266\267\362\256\345\275\235\356\265\240\347^\013\320-C\234\236\244\371X_y\203R}\201\322\367\251\310\026dM\300\302\333\b\367\340\32712\002>\360\337\256S\305`h\016A\027\317\245\"\276\303]C\307\340\327Eh\322?\240n\231\203\b\374(\224\254\013L\3703\210[\301`\022\020`\205\212 \013~\355A\366Y\2221d \006S\237\301\257}\376[\301_2\352\312\374\374\252\333\1778\377\347\374\267\363\337\315\233?\246\373\n]VT\260\0377"
+	.string	"g\340\307I?\036b\007`\026\330"
+	.string	"?>\001\023\341\0240\006\260\004p\021\276"
+	.string	"^\001\217\200!\200Y\024X\251\002?F"
+	.string	"~"
+	.string	".\001\013q\002\214?n\001\263P\3741\361\307\032\370q\273\002\213\260\301\217/\300\030`\r\376\213\367c\023\347\177\203\326np\360\347\250*\013F"
+	.string	"k\300\213?\203\200\nD\006\301\324\352\341\317\007@\333\256\314\b`\272\332\032\224\2432\004\356\224\377R]+\327\353R\271[\347\322y\201\323\t\372\344\277*\206$~\364\354\266\270PCo\347\022\324\t\026\312\366c\002\234c\250\362?\235\320\265\274\200\377\374\372\261\016T\355\317M=N\024h\023\030`\320\2413\205|B\006q\243P#\031 \302o]\376\214<y\b\261\373\361\036\335\207k\200\226\215 \267\220\366\337 \354\342a\277&\363\243\f@\323\272H!L\007D\215\300\377\267\377V0X\222\034\001\272BP\372O2\224\t\252\032\257\013_\301D]\372\261\b\356\013t\204%7\b\337\241\""
+	.ascii	"\013\303u\357\340W\213\376<\002=\373\363\212Ep1\270\320?d\022"
+	.ascii	":x2\340\256\241J\376\333\344bp\263\350H\220\372\277\302W\234"
+	.ascii	"'\322\247S\n5K\222\211\\\f|\\\254\013\\H-\354+\036\302\257\252"
+	.ascii	"\377W\f\263\240\016@S\374\247\017\222l\203\353\206A\311\0168"
+	.ascii	"\362\001-\033\363\021\277\032\3436\371o\020:tue\304\3701\214"
+	.ascii	"\017\\\025\347\017j\344?u\b\255\270\032Z\206\351p\335\230\027"
+	.ascii	"\340WG\234<P!\377\225q'@\203\374\350\330\217o\374(\0204\004\261"
+	.ascii	"\002\340`\013!4L\307W\374\202_M\341\016\271]0\324\217\233~,\343"
+	.ascii	"\307O\377\371\001\352\343\3176~\364\203\037\345\372\277\002\355"
+	.ascii	"Aw\017\277\232\200?\207@\265\376\253]\375u\013\177\266\340\317"
+	.ascii	"\030\374h\326\005$\3747\004\354\333\217w\340\254\347_Ky\372\353"
+	.ascii	"')\340\271\234\201\213f\002\335\361\177\205\rP\035\177\236\300"
+	.ascii	"9\370\265\222\n\034\371\3178(\216\377l\001\2751\201\"\377y\207"
+	.ascii	"\332\370\317!\n\0027\377Y\347?\355\374({\201\037\275\372\361"
+	.ascii	"\234\332\331d\363\237mN\276?\023\2715\356\013W\f\025\001\225"
+	.ascii	"\037\323\241T\347\2323\fJ\343T\203N\241Ri\204\334\021\274\016"
+	.ascii	"\235\021\004\013\371\nt\250\214\377j\027\203\217\360\253Y\316"
+	.ascii	"+h\323\315\350\376q\232\377$\203\216\340\264\362\177\205\032"
+	.ascii	"\274\367\016\277\272\366\237\247z\022\241\"\320)\234\026@C\260"
+	.ascii	"\302\006\007\361\247c\3779DA\360\337\256\037\237\370\357\026"
+	.ascii	"\036\376\367\307\2179\360\337\252\037;\340G?\360\337\257\377"
+	.ascii	"\006\371o\b~\214\364_\256\037\263\370/\325\177\241~|\302\177"
+	.ascii	"\265~\234\342G'\370\357\222\027\376\213\374\261\005\376\313\343"
+	.ascii	"\307)\374W\307\177\301\024\200'\360\337\"?\226\300\177_\3748"
+	.ascii	"\002\377\265\372q\321\177\313~|\201\377&\177|\364_\037?\016\341"
+	.ascii	"\277X?^\341\277.\340\021\376+\365c\025\360\006\376\273\204[\370"
+	.ascii	"o\326\217!\360\337\251\037\263\377m\361\343\016\374\367\003?"
+	.ascii	"V"
+	.ascii	"\372/\220\037\227\360\337\260\037\013\377\233\343\307*\376\353"
+	.ascii	"\342\307\b\370/\023>\300\177\333\037?\340\277Wx\351\277D\260"
+	.ascii	"\321\217\333\377\356\037'\340\277=\376\033D\201\377:\375\027"
+	.ascii	"\307\217Y\370\357\214\005\374w\310\177m\374W\306\217\031\360"
+	.ascii	"_\244\037_p\207?\266\340\277\034\3701\006\377M\372/\361\277c"
+	.ascii	"\377-\376\270\202\037u\361\343\025?\312\364_/$\252A\213\017t"
+	.ascii	"\237\361\247o\376\354\001u\341\277Q\377\305`\205\003\177m\002"
+	.ascii	"\267\251\362\337+\377\305r\263|\375u\330\237\201\376\034\364"
+	.ascii	"\243K\031\370\017\0338\370s\212\266\177\006\022\371\212\234\365"
+	.ascii	"\372_\261\377>\375W\004\377m\372\357\bn\215\037\243\360\337\027"
+	.ascii	"~,\302\177w\374\030\003?F\361\243\030\220\377=\212\321\343\177"
+	.ascii	"\357\005\301\177\363\231\002>*\340\307\036\370\321\240\377\374"
+	.ascii	"y\340\277BP\325\210\026\177L\302\217\013\320\342\336\370/\214"
+	.ascii	"\377\3068\335\177i\374\257\273KP\342?\\\203o\200*\375w\002/?"
+	.ascii	"\341O\267\3749\353\317X\377\361\277\026\340\317\020P\313\017"
+	.ascii	"\320=\356\322i\302W\270\232\316\361\347\0232\t\377\317_K\235"
+	.ascii	"\367\026\300o\376\373S\257\037M\302.P\243\353\037\355;\355\240"
+	.ascii	"\254\032*\304\361c#?N\362c$?6\373s\227\377\350\277\226\375\231"
+	.ascii	"\355\317R\376\034\345\317m\177v\362g(\177v\373s\006\320\242?"
+	.ascii	"\027\371\263\362\317k\177\366\362\243,\376\373\374+\333\237\363"
+	.ascii	"\376\337\177\355\362\243\301\037%\372\321\f\374\350\005~\264"
+	.ascii	"\002?\272\342GU\374(\013?\272\302\217:\340GO\370\321\022~\024"
+	.ascii	"\305\217\236\370\321\002\374(\001~\364\203\037\035\372\321\021"
+	.ascii	"?\272\301\217~\370Q\241\037\345\360\243=?\252\177\364\374\363"
+	.ascii	"\235?\353\375y\314\237\355\376\354\345\317T\376<\345\317Z\177"
+	.ascii	"\276\361\347\252?7\340\317T\177\236\3723\002\376<\343\317Q\177"
+	.ascii	"\206\361\347\247?7\375\031\004\177~\341\317-\376\214\374\263"
+	.ascii	"\007\376\234\364\347\020\376L\342\317\303?s\360\347\013\376\314"
+	.ascii	"\376\271\350\317\301?g\340\317\027\370s\005\376<\201?K\360\347"
+	.ascii	"\026\376\274\341\317\371\317\020\370\363\003\376\234\302\237"
+	.ascii	"O\3703\t?\356\373\363\b\177^\300\237\023\360g\002\374\371\203"
+	.ascii	"?\017\375\271\203?c\360g\020\177\236\340\317A\177\366\3713\206"
+	.ascii	"?\003\377\274\376Y\375O;\377\331\374\3176\377\311\367\237\314"
+	.ascii	"\377\\\363\237{\377\231\346?\365\376\023\357?\353\376\263\314"
+	.ascii	"\177b\371O(\377\371\344?\321\376\223\311\177\032\371\317\262"
+	.ascii	"\377\004\362\237`\377\271\365\237Y\377\251\343?s\374\247\324"
+	.ascii	"\177\312\370\317\030\377\371\342?\237\376\363\205\377t\361\237"
+	.ascii	".\374'\361?\223\376\223\003\377\271\201\377\274\300\177J\340"
+	.ascii	"?W\374'\004\376\363\001\377\231\342?S\370O\024\376\323\204\377"
+	.ascii	"$\341?O\374'\001~\034\344\307?\376[\371\261\327\377\276\037s"
+	.ascii	"\3757\350?M\374\347\007?\026\301\217\267~\274\343\277\017\370"
+	.ascii	"\257\212\377v\371q\213\377b\371\317\241\037'\377\223\304\177"
+	.ascii	"\212\370\317\237\377\364\371O\236\377.\371\317\337\177\252\377"
+	.ascii	"\211\376\347\371\237\367\307o~\334\346\307l\376;\301\1771\370"
+	.ascii	"\361\336\217\325\374X\357\307x\377\353\376\253\375x\314\217\353"
+	.ascii	"\376\257\370\257\301\217\351\376\257\360\343\271\037\177\371"
+	.ascii	"\261\227\037\313\375X\311\217\205\374X\354\307a?\006\373\361"
+	.ascii	"\327\217\273~\354\343\307=~\254\365\343\254\037\353\370\361\214"
+	.ascii	"\377-\374\330\305\177\345\376\353\345\277[\376\253\345\277Y\376"
+	.ascii	"\273\366_\265\377\036\371\257\221\377\312\377)\376w\371?\367"
+	.ascii	"\177\001}}}}\377\007\250\177\002\005\374F\032\0049d\320\301\371"
+	.ascii	"\377\221\321\021B\004\347\224I^\342$\216\026\316\177s+\377W]"
+	.ascii	"\306E\206\031\316\0071D\247J0\274\321=\311\202\363A\370\320i"
+	.ascii	"\222\236\257\251=8\234\017b\207N\217\374\340\336\222V8\037\004"
+	.ascii	"\224\376\257\226\253EJ\356)\331\3572%K\211\260p\367\206{\302"
+	.ascii	"\203\271w\322\203\037\030\220!}8\377\003\236\376\323\")\221\235"
+	.ascii	"\207\005\007\347!G\224l\235\341\374\017Y\364\3774H\032\226\216"
+	.ascii	"\245b)\220\273L\205\244^O\2770\2174\251\220\024,\375a#\203#]"
+	.ascii	"zu\232\251\220\264k;5\211P6F\257N\223\353\256ep\304I\257N3\025"
+	.ascii	"\222\372(\343\323\253\323\024\222^\245=\256\235\330\3366\004"
+	.ascii	"p\344J\257Ns\357-\004\205k\b\223\307\003\317\334\231)\033\347"
+	.ascii	"\177P\352\236\013\224\376\003\020\375\017=\364?\\\351\177x\241"
+	.ascii	"\267R\"f\346l\301\371\023\254\321yN\272\343\332\211\345;sL\036"
+	.ascii	"i\326]\246Z\251\215T\253\007\335\333\351\013\031\260\307\227"
+	.ascii	"\225\2144\3538\233rqo8\177\202-U\3102\035+i\2164\231\342\270"
+	.ascii	"\313\024+\275\001\225b\215=A\013\323\334{\303a\312a\243\363'"
+	.ascii	"\310\322\237\340\205\276\004v4\217\023\226\02518\24754\0319`"
+	.ascii	"s8_\202\273\224*D:\225\266\205\252.\235q\262\321\323\341\205"
+	.ascii	"\363%\240\222\312Hc\304\230q\366\342\305\205\023\372\331PU\244"
+	.ascii	"\310\276\364\237>-\323\247\013'\244\334W@\032T\022\320\320\277"
+	.ascii	"K.\032\347\351N\233r\363\356\253\252\007\240\271c\356\252\033"
+	.ascii	"\036\334\203\034}\264\211\3129:g\016\332\247\233\366nR\356\032"
+	.ascii	"WJ\030\254ds'\223!\262\324\f$E\356\034\355\333S\331jL\221\301"
+	.ascii	"\371oP;\377\327\037\237\0303h\354\324\261\201\007eK\034t\214"
+	.ascii	"\216\r*t\362\220\363\313\020/mp\276\007<\375\377\036\377\351"
+	.ascii	"v\252\332{_\241\312]\365\304\223\376\367\027\2757\304\217\341"
+	.ascii	"\236\367\202\377\371\035\020\356\r\203\316n\357}\335\350#pNY"
+	.ascii	"\025\354\333\355\r\325\325\304\200.+\250\256\034Qm]V\031\242"
+	.ascii	"\332\272v\023\024\221\246\fU\273\253)\252m\357\fPPM(\270\254"
+	.ascii	"\242\332\234v\206\250\266m\265_\214\261\272[\331\325\264\241"
+	.ascii	"\270v\206\r\265\235v\033\227U\005QP]VQmNV\031\242\332\272\254"
+	.ascii	"v[\327\376\331PNU2\240vU\206\335\326\305f\267qY\375D\265qYE\265"
+	.ascii	"u\351\335\244\024\021,X`\354\206\234]\266(\250MEC\313\251\352"
+	.ascii	"\307.J\311\265\357\366\276K\030\273j\333\355}\301\336Z\\UwN9"
+	.ascii	"n\334\223\035\325\023\025'\256\253\334{{\240\361\344\305\265"
+	.ascii	"\241\354\232\356\266\213B\302\2657\222'\244Mc\357\275AhR\332"
+	.ascii	"\355\261k\327\364\245\265\247`\354-\301V\356Mc\357\246\273\355"
+	.ascii	"\366\336M{o\265JK\271\367\216\237(2\0324\366N\n\321\330ZMW`\354"
+	.ascii	"\215\227yqVQm^\\CW\242\264\221\355\030\312\246\0335\305\265\311"
+	.ascii	"\366]W\225nkb\333S{\357\333F\223Y\331\340\303\371\036\210\350"
+	.ascii	"\037\205\203\276\371}YkJS\221d\251yks\227h\033\214%\244\334M"
+	.ascii	"\352\333\035V\262\271\253\252<\270\207/\315D\331l\\\005\313\314"
+	.ascii	"\031\316\3670\305\\\203_\3005\305\230\355\251!\301M\211\023\234"
+	.ascii	"=`\250\321FG\017\347\377G\365\256\207\342]'\273\306%3\007C\255"
+	.ascii	"\271w2D\317\035\274\271\215\363\205\354\350\037\315C\361|\250"
+	.ascii	"\370\250a\006\275;\212\367\203R\007,\r\316h\031\024\315\377\225"
+	.ascii	"\307\206\217&\034\2323g\331\020\252\034V\336\240\355=\241f\256"
+	.ascii	"\033VC\265\246\016\316\350\030\345\2051f\356\005\316\027\312"
+	.ascii	"C\305\034\303\351\204E\007\2073Z\247\354\t\203\346\314\035\316"
+	.ascii	"\027:\243\377\273<\034J\227\235p\261\221\355\275\177x\362\334"
+	.ascii	"TY\342|!;e\332\336"
+	.ascii	"J\037\236\0325\202p\341\254\004\306m\271\335\370\202\312a5Q\220"
+	.ascii	"d\221C\275\270A\022\244\006\316]~hD\240\314\341|!*\032\312\035"
+	.ascii	"\031\235\2233\257\347\334\333I\217\354\346\245\311yC\251\240"
+	.ascii	"p\250\026\324\r\275\202VA\261\240q\350\026\324\n:\005\345r\227"
+	.ascii	"h\0264\312Q)\350\362\004\243T\223\005U\303Z\327N\214\001ik\230"
+	.ascii	"Ch\026\224\355\314\273v\311\314$\315\315\313\2022A\321\256\235"
+	.ascii	"XN\233\363$\017om\217l\t\002\230\320a\336<4K&\313f\327.\231\221"
+	.ascii	"\324a\266\341\257\236s\357-\274<4\013\272\346\311k\353\f\003"
+	.ascii	"\033\2552B>d\\u\203\322\013.Pz!\033\372BR\372BN\372\035\342\350"
+	.ascii	"wX\243\337\341N\277\303\030\375\016^\364;\270\351wH\242\337a"
+	.ascii	"K\243a\255\353\343f\310\034!8\277\203\r\375\016R\032E\362\304"
+	.ascii	"\305\204\016\316\377\240\fL\017E\202\026QC\226\206\f=\202\232"
+	.ascii	"\241IP%w\211\"A\215\240HP\"Ml@\240\023\263\206\245\271\267\022"
+	.ascii	"}\313\332T\277|\016}\372\034\324\350s\300\242\317\241L\237\003"
+	.ascii	"\r\375\243CP!t\202\240\r\301(\0204\310\351\205'\205\342\303I"
+	.ascii	"\211\363\341\2247(]\233\350\330\333\217\213YX\025*\206\206\335"
+	.ascii	"\267\274\2538\036\035`\250X\375\270pE\264$\371\300\276\364\222"
+	.ascii	"=\202\340\274t\272\241\314\202z\341-\307N\027\263.\037\251\223"
+	.ascii	"9aj8\367\001\227\204\351\240\342\352\341B2\251\266u\264G\356"
+	.ascii	"\273=6\240\234\355\300\371\274\033:\272\205\200 _LxxPr\245\307"
+	.ascii	"\017\255,\236\037v\312\336\340\234\365-\230kw@kpi\002\265\003"
+	.ascii	"\325a\346\t\r\316Ie\333\336\333\303\351\245\313\220)\234\037"
+	.ascii	"$Gc\2418\356\022\315\201R\3459\350\215S\031\247\341\274d0\321"
+	.ascii	"\034(\f\224\206W\024\331\217\017\310\2164\333\020\302\020\306"
+	.ascii	"\225\244\207\030\253:Wh\325]\242Vh\2156+\265\210\021\275:\315"
+	.ascii	"SN\033\0353\315\017\002\242\037\204\245Q\032\271\357r\355\016"
+	.ascii	"@\033vx:p.1tt*=\323\342C\016*\205\312\230B\326\306\n\316y\016"
+	.ascii	"\n\325\343\364\2637\2214\314\031h\324]\2422P\031(\f4\306\265"
+	.ascii	"\023\313L\302x\350 Oiz}I3\032#\367\251WZ\330\260\340\374\240"
+	.ascii	"+}\234\003\335y\350\023\372\002u\272K\024\352\231N\356\353A\367"
+	.ascii	"\346\322C\241\320\246\334\367\033r\205\206\257yT\003\243\243"
+	.ascii	"\3637\270\321\337\260\247s\235l\347.=\344;|bOV8\177\303\031-"
+	.ascii	"\202\275\257\207\364\366\365]\017\3517\214\321\3370\247\377,"
+	.ascii	"'7\303\352\302T\3019\216\0227\331p\266p\376\006+\372\037\344"
+	.ascii	"\251)\346\275\323A&O\256N\307\016<\346P\2209\262|e\207y\3572"
+	.ascii	"\226\227\232{\227#\rY\214\035me\276\310A\201\222\345\206\306"
+	.ascii	"\013Y\233\03197\034fE\313ig\b\023\263\335a\236\201\332b\326\220"
+	.ascii	"\301\324r\3161s\206\335\324T!\303\261G\326\027\204\314\355l\263"
+	.ascii	"\274wI\275\272\223\314\21398id\314\263\016\02127\\d-G%\231a\252"
+	.ascii	"\240D\211\235q\320\310\264\234M&\247\336)g\tsh\231yd\261S\031"
+	.ascii	"g\302S\0353\fvR'\f\325\f\023\331I\214\354\336\335\360j\312e)"
+	.ascii	"\032L-\347\035!n\230\210\033\231\226\3344\206\335N7jL\267\274"
+	.ascii	"<\361\316\274\236\246\237\275\301\340\310\264\344\247\036d{+"
+	.ascii	"\261\333\311"
+	.string	"f\nso\345\377\374$;\311a\262\232\234\227\365\362[\306\313d2[F\313n\331J\266\313s\231J^\313t\331K\356\222\271\3442YI\006\223\3572\\\026\223\333r\225\214%O\311g\362Y\206\222\323\344\275\354&\177\311MrZ\216\313p\262\224\234%\233\311rY-\243\311l\262\226\254\314W\362\230\314\314kr]~\223\333\344-9Jf\222\371\362\222\273\314\313<\344\231H.r\254\334\033*L\246!5FG&\227ah1\367Vj\311\033\b\263m\231\311\262\331\251$+\001\n\035s\357\375\223\356\307mg\0300d'\230\037\273\235{T\3163\377\275\263!\207\351v\276y\321\204lo%\016c\325\307\224Q\203l\206\031*2\267s\315\333m\003\202\265z\234~6\324\023\230e\026\362\205\271\267R./\363\013\036\314\345I\007J\021\346\336J\241SI\\\217\246\273\363\237\313\236\315\376s\356\004\223\223\360"
+	.string	"\301a\243\016\347|$#yN\222\215\344$ p\355\355\224\223\370\324\331\333\311\347^\013\356\265 3\361*2%\315\337\340\246/\332\320s\231\017\031\2707Dp\376\206&Ze\336\240\364w.P\372\rd\372\033|\350o\250\322\337\320\244\017\264\247\377\274\365,\366\347\254\254\225\303\356\r9,Vp\376q\336\231a\245\t\316\007B\243\377g\257\334\225\277\262\217\273\314`\271\3073\327\311wl\002\212\030soe\006;\237`\255S\031\247c<\001\302\314\321\206\277z\232~\366\023\231\261\241\fvF\361\352\301\334[\211\216%\371\310\374rj\247/\224\241\347\255\374\005\247\206\021\234\017\004F_\346\rJ)\270@\351\201\246\350\003\031\321\007\372\241\017\224C\037\b\206\276\0068\372\032\306\350kp\323\327`D_\003\227\276\006+}\r[?\303\032\375\f\\\3643\274\351gX\323\317"
+	.ascii	"D?\003\226~\006'\375\037>\375\037;\375\237+\372?N\364\177\204"
+	.ascii	"\350\377\360\320\377\231\322\367\221\243\357\243F\337G\213\276"
+	.ascii	"O\232\276\017\020}\237*\375\236>\375\0365\372=[\364{\234\350"
+	.ascii	"\367\024\321\357\331\241\337\363B\037\303\235&\301E\213p\203"
+	.ascii	"\322cP\242\217\341K\037C\r\375\270\033\224\336\313\231\367\237"
+	.ascii	"w'\035\376\332\300\261\210\216(8\037\203\f}\362\334\321o\336"
+	.ascii	"\240\364<L}\036:}\332\235b\356R\350\0343\346\211J\013\347\363"
+	.ascii	"p\321#\330W(}\337\025J\317\243\246\317\003\246\205nP\372\345"
+	.ascii	"\rJ\327/\033h\250,oir^\316\300\210q\207\363\331\005\265#V\206"
+	.ascii	"\007\316\347I\352\377\344\022\346\316\260\001udK\b\fr\316<\235"
+	.ascii	"i\311\222\337\302\340\352p>\263\374'\333\351\344\304\262\272"
+	.ascii	"I\322\244\304\371J\221;\031^p>\317\f\375\377|;\341\316*\247\225"
+	.ascii	"\223\312]\236q\247\224\237\313\323\r\357\311\2146(Qdm1d\220E"
+	.ascii	"\351#\213;\247x\200m\r\313\331\336[\210\207\215V\2310<\371@5"
+	.ascii	"\372r\335\240tC\235>\220N\0378\247\017\224\323\007v\321\247\335"
+	.ascii	"\rJ\021p*\261T5\032:\242\326\316&szze8\01759\223d\263)L\2653"
+	.ascii	"\355.\317&'\032T\223\323\354d\242\272Y\2415\317(1O\312\322|`"
+	.ascii	"\022}*9\317\3562\304\271D\351\263\236i\303c\211\363\201B\364"
+	.ascii	"o\210\324'Dz \017}\340\r\375\237H@\370(\261h|\341\374\237Gz\356"
+	.ascii	"\304\2441\303y\214L\3159\206\373\316*L\347\304qf\2351\260\235"
+	.ascii	"3\352\034rR\235^g\2173\354\264:\267\316\035\347\217\023\354\024"
+	.ascii	"\202\357\234>\316\032\347\213\223\007vs\0329u\234]g\216\023\352"
+	.ascii	"$;a\234W8\316\351tN\235\373\244\201\341\234EN\031\247\026n\342"
+	.ascii	":g\2203y\212a9x\016~s\3328\245\316\246\363\351\304:\211\2347"
+	.ascii	"\316\031\347\327\311u\002\271\313\263\f\2639\346\303m.\244\334"
+	.ascii	"\033\312LI\230\034?Fc\203\262\224\233\023\333x\006\226\302{\b"
+	.ascii	"s\353G"
+	.string	"\214\031mR\320\230g\031\036\203\231P\262\234<y\303J6\335\246,\251\322bnq\205Q1\267\300bH\205\251{\301\203\006U\f1\254\344Y\331\021=\254ds\f\310\035\254d3\214\035\306\272v\313\035"
+	.ascii	"-\254\344\031\215\032<\230V\311$V\262\211\207\374x\214\210\034"
+	.ascii	"&\332\223\273\226\202\251]1\267\f~q\262U\245\020c\t\363,\303"
+	.ascii	"=\260V\217\223rW\251Rj\224\031I\203\225l\266-\231`%\317\312\220"
+	.ascii	"\344a%\317\344\276\214\335,w\013\02390=\230Z\266\f\301J6\315"
+	.ascii	"\226\200\301J\236Y\235e\330\006\306:\331\252J@\223\305\304\322"
+	.string	"\204\211\027\344\256\235J25\n\230\035&\2361%\004+\331D[{c\2125\301_\327.\271O3pX\3113-\\\360\327\251$S\245\200\ta\312\321m\231p\262\206\225l\342\0302~6\224\024\"d{+\305`\030\327\356\332%\225\373\n(\345\314\354\214\216lL\310\034\262\262$uX\3113/@0\2174/Z\272\004\301J6\321\324\254(\343\256\204-\231[ahd0c\234e8\n\277\210Q\004+\331l\213\222\206\225l\336,g\331\325r\257~ahX\311f\033\025\034w\262Ui)`E\230\330\355\355\f\267A\331\300\027M\260\222gfL\344\310\320\224\207\353\201Rn!\251\0317\254d\023\273\375,\303Wp\226\036(\345\266\372\201\021\301J6\361\330_\302\304Y\206\213\340\257\236&\345\256\241\2025\225\035\b\3354@\356\276\210 \0078\377\300\336\223\244\303\302\304\371\277\257\337\021\2606%8\177"
+	.string	"\332\t\226\225\025\316\277.$j\246\330\340\374\363\361-<I4\315\260_\2172;v\374\264\204\270\232\336\374\252\246\272\256\232Ld\234\351\361\313\372O\353\r\024;50\311d\332o\354+o\013\316\037\242\362\253\372U\375\260\210\220\235R\364\324\342\340\370\017\013\003\217\255\26648\377n\034"
+	.string	"j\316\f\316?\033\207\263Sb\321\300\371wu2\021\002\246\206\205\363\317\352pj\217)u\336H\265\215A\263\303\371C\277\031\277\031?\252'C\264\224)ZY?\032\377Q\3718\231\372\"\007\347\337T\352\246\213\2145;8\377\244\262\027'U\230'\2234L\215:s\302^\274\370E\t\351\335\204\214\027\346\336\311\020\030\2624\031#\347\027\343\277(8\037w:\302p\376\301\320\361\333\277\375{z\"\007C\255\031\246u\206\352\347\364\337\323\236\317\331\2357\0348\377\232\206\244V5_\331\250Y\357\234d\256r'\271\232\330\024@\tU\230\227\346\216J\206\350\221Z\323\005\326\374z\347\253\235\022&\256\206\370#J\024\234\327:\277cm\242D\341\374u\316J\347_\327\2624T\356\340|\022i\364*g"
+	.string	"<\346\370\250\263\306\271\032L\003K\022\0368\257p\276\006\003\0256\261\365\215\027\231'\234W\276\265\315]~nus\245O\017\226\030ns8\237\204\031\375\373\271t\004\367s\351\272\346+\363_W,[`t\372_\367\376U\235r&\213\f\347\223\360\242O\342J\231\273\\\313\254z!\224\273I\204>\037%_\3464\255yN<|\334]\241\223\004\307\335W\274\1775\263\236\031B\003\310\024\234W4C_\357V8\264\272/\234=\004\245\022\\\240\364$\226\372_\307\254c\3223\274\2666\365\001\351\302\371$\226|\371j\367\345\312"
+	.ascii	"OBT0!Nb8\257a\326\272\225n\005\263\316\221\370a\345k\227\325"
+	.ascii	"\312\352\005\263)\233~d\252\254P\336\302t\301\031\f\nL\033\234"
+	.ascii	"W-+\2275\313\024\031-\234\277n\021\0333$\t\3168\213\232V\005"
+	.ascii	"\345\206\363W,\247\0350Yd\340\374\365\312\377u\004z>\226\340"
+	.ascii	"\274\306i\030$rl\260\3469Q\023\004\356k\334\237~a\0369\311\006"
+	.ascii	"\246\262\222kp^\271\206\276\302\341\"\313\2719\234?\302\216\376"
+	.ascii	"W*+\025\325\316\t?{{}\211\213b\363\245\n\316\037\201f\353k\220"
+	.ascii	"U\310:\344.\327\255u\312\031\225\33460@\003F\317Hc\223\304\331"
+	.ascii	"\215J\0336bp\376\210/\3727\215\310J\246\307,[\213|x\212:!-\217"
+	.ascii	"\211d5\273vb\f0\253c\016\031Y\213\3644e\330\373\013\217\314\311"
+	.ascii	"\272\\\245\254P\326'k\224\273\\\333V%_\205\254C\240r\254m\353"
+	.ascii	"\221;"
+	.string	"\346\336\312\266\365lU^\273\344\317\206\262\262\3467\243\313\216GO&r5\037\236\242NPS\303\\\327V\266\273\\\225\313U\271.Y\325><Em\247\256\002\200\241qG\313C\007\030\370\312\334e\245\371_\325\326&T\224amp^\323\366\2229F0\271\313\025mO\2779\273BGM\027 ^J\364G\224\351\217\370\322k\022m\206\311#\f\316\037\261\245?b\207\376\b\034\372#h\350\217\210\322\377J\266\026i\373\342&\314Z\004\177\221\241\233z\302\371#\2404V\336\2404\304\005J\327\260ul\005\362\257>L\342~\274\341|\021u\364W\261\377\353\n@\352\336p\316\367[\322\025\354\353\217\177\305sE\310h\340|\021q\364W\257\365\353_{\356\210\270\261\341|\021k\364\327\256\267>7:p^}h\030\"\304l\360\343a\245GV\217\257>\376\225\013\213\275\320g'\016\316\030.P\212\257\206\276\366"
+	.string	"\206\341\302\\\303\371\"\250\254X+\326\252%\244\334W\300 S\264<@\333\366\314\260\262x\270\314\260\230y\307\0243m8\257;V\035\370\f\263\302\363\302yM\246l;\240\342p\276\b\2655\207\210\260\365j\275Zo|x\243\243\017\216\314\032\316\377j\343\353\r8\236)M\372\274|\013\216+ht8_D\325Z\265V\351\2647SL\240\0230yY\372\250\250\300\234s`\266\322p\376"
+	.string	"\360\364:\265N\3514\275\337\260\222M%^K\264p\376"
+	.string	"\260\2543\326\031\372\355\204\275\241\r\220\246\021\264,8\177"
+	.string	"L\364\277F\255Q@\006\340\245\377\365\205\346[a`,\006<E\355}\025b.j"
+	.string	"4\364\005\360F\377\353\323\372DE"
+	.string	"b\364\257\357\254{m\302X?{\314^\305\262\2701\005\020\247u\237\356\323d\"dY\303J6\005\240\246/\200 u\352\214\t \251\345\374%Lh>=\347\256\345\235\334M|\025\314M\t\240I\337\203;}\355\346j8\232O\307I\255\362^n\247+\020\346\244<\310\242\357A\232\376M\255\322_\267\321mP\2713\212\313\311\013\2042\033^[j\234\247=\0348\337\203.\275\267\247\331\340\275\345\3560yb\234A\323b^\263\371\2119[\332\301Y\257I\313\304\341}\021C\264\005H\023\347{pC\353\351\3514'\354\017r[Gv4\223:\r\234\230\221/7\234\337AS\243\321h4\336\206+E\264B`\320\243\343\023\243\357\256\361\266\320\250\241fH\007wf\314\350.\r{\357M\246\202A[\302\204\343\203\216\032\234\337\201\024M\206L\252\345"
+	.ascii	"c_\330t\350@RW\247\305\b\241ea%\2337\350$\335\354\356R\213\301"
+	.ascii	"\242\314\321\201\227\3765\235\246K\317Bx\t9\317\202\004\351\201"
+	.ascii	"\363;\270\232\233\323]\364\356\203\342\204K\016\347w0CNNw\321"
+	.ascii	"{\016\002\322\340\261\325\331\262Ew)@\036V\362\354WdY\006\215"
+	.ascii	"\313u\227!o\232@8P\243\263dI\265\224-\345\030\321\243\302\371"
+	.ascii	"\034\324\351__\321Wtp EW\321U4\\\002\336\2320u\322\254\314I["
+	.ascii	"\271"
+	.string	"\206\303"
+	.ascii	"\203J[\031\037\233\230W\020\234\317A\231\2362E\277\235\260o\220"
+	.ascii	"3*4f\242\340\254\337\356Z\331\021\257)\234\317\201\016}\035\345"
+	.ascii	"\352\345\362p\267\212C\214\2671&\007Q"
+	.string	"\372p\027C\355\355\204\201\017X\223;\0348k(\032\212\336q\352\005\301J\236\r\271B\342\206\363C\260a\323O\330\2348i\223\347s\006\213\357\005\316\017Q\247\037\"\312\332\332]\023\332Mm\020P6\027\002\311\022\335d\211Nc\302D\247!\317\260\222g\030\320\330\211\023C\273N\033K\203C/\004\017\375\r\372\222h%I\364\01633\275C\250K\235\337\027\036{u8\177\003=\375\r\342\364\257\217\350#Rv6@\023\242\313\204h\262!C4\331\207-g\030\316T\024\025\316\232\f\356\004k\322r\203\263&\222\267f\306\266\301\016}\r\370\3004\0200=\226\376\370\017=\2067\327\336d\252\0274:f*D\207\227\033\261\353\2612tf\300\341\254\3034 \243\257A\225\036\332\253\207\356\322\200\213Kw\235\360\001\315\r+\331\\y\234\311\213\363q\335\005w\245\344\211\311\242A\231\276\006T\372\327<4\017\261"
+	.string	"\304\311\241\263r\350\035\311\244\3361\224\207\225<\353q\022B\366C\307\365\216\264\26624\002\240E?"
+	.string	"@\264\225\306\241\255\364\215\253+}C\250lJ\213\321\001ee\343\372F"
+	.ascii	"\244\36430\243\177]C\327H\3474T\245\240G\207IE\377\232\206\246"
+	.ascii	"\221\332\205\220\232\223\201\231\224\024\376\"\241N\221\272\223"
+	.ascii	"\001\227\376\265\f-\343\256\221P\341\364\35201\350\353\323/\372"
+	.ascii	"t\f\r\343:\306\036\035\220#mZkG\222?p\326[o\r\245\233\340\360"
+	.ascii	"\324$i\334\346\340\374\353\247k\250;|9\234p\326NXK3i\212!\301"
+	.ascii	"Y7\341/\2755sXp\376\033\374\345\005'\r\034\316\307`\214>\006"
+	.ascii	"j\372W\347\334\245:G\265\263F\355muA\030\030U\214\013\231\033"
+	.ascii	"\234U;\277JG\255\203\276\271[\364\342\206\340\334!\356\006\245"
+	.ascii	"x\316\005J\217\301\2177o\324\346\222/X\311f\234\253\315\246\254"
+	.ascii	"e\f\234U8i\031\036\264.r\206`\200C\377x\r\257\035\356\204\375"
+	.ascii	"\202\255\2022\">X\304\344t\361\361\341\257\253\3345~1\276\\p"
+	.ascii	"G\377\027\313\305r\341@(+\242\255l\324\250+s\313x!\303QQ\352"
+	.ascii	"\336\t?{\007\201#S\367^\374`\354\311\300RX\312\212\252w\227\252"
+	.ascii	"\036*D\356\2024g\316\250x\005Hb%\317\356\256\342\2451\266\226"
+	.ascii	"IpV\321\340\257;T:\240\350\264\250vZ\3242d\256\226\331k\002\003"
+	.ascii	"%\005gu\214J\207v\235\021\023\205\263*f\313\026\265N7\021\300"
+	.ascii	"N\230\253u{Q\342\264L\341\254\316\251t<z\\\222v\350\300\360\330"
+	.ascii	"`\006\271\363\221\372\241\346\006g\365\313\265ss\246n\t\316*"
+	.ascii	"\027Un-G\223\210*\247zy\203\032\213\202\241x\256\326DQ\252]\356"
+	.ascii	"\231\355\001\337\221+\213\343\246\177\001\021)*\234\024\025K"
+	.ascii	"\272\367Ur\325\250\272r\025\313\336\r\362\004\352\013\316j\\"
+	.ascii	"\352F/\231j\023\345\215\256\n\206\030\234\325\245\272T\255\334"
+	.ascii	"]\005\207\225lV\271je/\312\2343hpV\251\244nx\260I\303YuS\337"
+	.ascii	"\200n[\300\324\250o\352\024\256/qz\302\350\311x\302\371o\356"
+	.ascii	"\332\214\253,[8\377\202\035\372\026@\201\202\277\204\270\232"
+	.ascii	"\370,\250\362\201c\306#\b\316\267\240M\223&\352\2234\252\223"
+	.ascii	"\253O\202\300\250B\205\263\312\246\342\340a\362\335\321\303Y"
+	.ascii	"U~Ks\313\335\232j\225\341\320`a\342\254\252Ya\273\013\"w\345"
+	.ascii	"\n\022$*\223.gK\2562\001\002i\202\247\205\263z\366-Q\236l\301"
+	.ascii	"YUr8\237\244\034\222;8\253fI\334\364\177\237\334'\251]\b)<!B"
+	.ascii	"\324\262-xdW\313\360\2170wX8\253E\276\245\254\217\212\022\234"
+	.ascii	"U\"C,@\242\206\251a*\220\n,\301J\236\215]\005r\252U\t\033\303"
+	.ascii	"Y\025;\303P\301\362\205\363\337\250\373\307\326\033\316\267\300"
+	.ascii	"\207\312\245r\251`M\364\310\324\257\253`\227\315\312\215(\234"
+	.ascii	"U\257o\251r%+\211\263\332\225\226\361\211\243\223\323\206\263"
+	.ascii	"\352\303\202$\017\036\352V\005{o\030\333E\023\255\016S\335\202"
+	.ascii	"[\223A\252p~\005}\372W\263\324\254\324\352\204\355t\225\301Z"
+	.ascii	"R\215\376]\273\252\016U\307]\273\312]\303"
+	.string	"\207L\226\322\203W \247\322Pi\2509\326v\250XWs\364t\245\021\022\206\263zC\305\3213U$O\013\260\216\n\031*\234U\033\3526\202\247\025\205\263z\245\242E\321\222\004g\265J\265\372\277\206@\252\006\034\234\325\032\207\303{\223\353\202\263J\005EJ\n\355\201\235\354\253_\214\2475|\030\312\230@y\302\371\025\254\351_\225\241\312@\263\316\250\355\344\203D\031\230\n\200\350\273Tc\244H\260\223\335\344\003\347\204\206o\314\035\031pp~\005>\364\257\276\270K\365\005\326B\2416\327X\332\234\352\272\322^^\266^\260\251SG}\022\341\n\234\352t\365\tN7\243\244\001\202\263\332\364-E\234\320\301\3029\265\243\356\273%\007\307\030u\247}ojd\354H*=\254G^\230\251\335A\251<\234Il\200\201a7gN\232W\326\007\200\270\346\233)\234\373\243|\"\303\204l\357d\b\240Y\0264Wp>"
+	.string	"\320\230\314\024\016\032\017\032\246\0324\351\233\247px\242\234\3364\3019e\223\272\361r\303\303J\335\244m\256|\2119\365\361\324\311\342C\223\362\3356H\272\230\330\341\f\200\261\275\275-"
+	.string	"h\3514M\232\346\322\005Aq\240\301\310\303\371"
+	.ascii	"\230\0323&\315S\207$S\274\247y\231\310\223\225:8\247f\322\273"
+	.ascii	"s\013\224\233\031whpX\311\303rv\2711\224\313+\351\031\314\206"
+	.ascii	"\247+LIZ\006\030f\307\325]Z&%\203\336\341\240\"\"\204\202\232"
+	.ascii	"&]p>\005o\364\237\322-S\272\324\356W\225\202\324\036sWUy\220"
+	.ascii	"\332\375i\230\264\356\302\341/vh\304p\276\312\033\224\ny\271"
+	.ascii	"\313\324K:\247\247"
+	.string	"&\235\373S\271\364\013\336\030\370\003\314\234$\316\251\335\rJ\237\346\002\245\247\240\216\013\227\223IVn\253\224\f\225\027\017\326\037mvP\301\371\024T\311\222%\325\242d\354o\236j\031\203\204\310\024\234O\301\222\364Jz\005\355\323\373-\252\202\036bwp>\005^\372O\341\3562\205;\263\234\240\334M\277\247\032I\017\322-RUnp>\005Y\372O\253\374.\323*\251Yv\262\233T\274+h\315\346\336I\017t\222\f\0263\234O\001\226\376\323\267e\372v\270\254\334B\324'<\266\007\247\300\206\376S\267\277\204\211\273L\335\360\327u\262k\374b\330X\303\327\334\333\213\007\331\316\2323c8\037\304\032\375\247R~\227\251\224\323\313\t\312\335\004\f\363\002\242\314\223')\024\004d\221C\266\223U!P4\256+\314\264mo\314\025\336\306\371 \250\244K\236.I\331\356\336{g\001S\025\342O\321\236\262=UB"
+	.string	"\207\035\0308?UK\327\376\025\363\260\263\221\340|\020Pt\232\2266\371\277f@\345\352\t\347c\020L6P\271\004-qX\001\222\270\304\303&\261\b\266K)\220H\"X\245akT*Z\215\210\303\340\361\267b\003\220\205\237%\"\333\266'P\240\300B\313\036y \016\215-\264\bV\240xd:\002b\221\303 \240Q{\364"
+	.ascii	"\022-\201"
+	.string	"\005\025\202\202Z\024\223\214\216\254\013\017(\036\231\2166\bO\264,2\203\3221\210\034\nS\266\r\252h\331#\037!1\310B\030dQ\030\365\034I\004{\f\022\262m\0209\324p$\021H\2446\250d\304&\005\213\220@\237\023-k\302\222\322\020\350H\"\212\216#\212\214\220,N$\031\261(\212T\264\354\221\206#\2118\262.\206J#\\\fS\034\213m1E\313\036\375\034I\0042))X\204\324\006\225F \333!\213\021K\304\243\001\270X\"\016\223\006"
+	.string	"B\bD!\210\340bD\213$\026\213P\243\2268<&\245-\213Tb\225R\025\002-k\202\317O\t,\250\320\016\211("
+	.string	"\021\207A\023\332!\021\005\fG\022qD\034\036[\344\bV\270\224TD\034\2168\"\227FpHJZ\"\022\213D\265%b_\030\"\323\026\305#R[$\252FA6)3\031\213\224X\245\024\311*\005W\020\016\215\232\311X\034\241\207H\303\203mP\330\262\310\236\025\036\230\214\305\021\202\332#\21182\21682\002\025\021\227\200D#\214\"\211\216\214<-\021\361\310\210\022\217\214'\373\302\020\231\221H\366(\024\006U&c\261(\037[\343)d\211G\303\244\240*d\221K\231X\034\266E,R\375\221\350\310(\002\003\323\261E\016\217X\025\033Z\"\027\254\2208$\302`\f\246(\256@\006\207I'\212\216\0348\374\f\215A-\313\201\025\026St`_\340\0204$\202m\203*\212G&\023:\260"
+	.string	"\224\201\204\b\243\006\r\034J\210X*\016]`\217,\260KEHV\005\322x$\264\341\003\021+\332c\260m\201\025\026Sp\030\241%\262\307\343R\221\207#\233\204\341D\313\232 \034\032' \036\r[`\215\025\264C\"\n\302\241Q\303\0211\210\364\243b@\036\3316\251G84b\020\262I,\202D\022\202\204\310\007\b\207\306\016\031\224\216\354\n\024B\254\013\303\266(\003\207\226mA84\202"
+	.string	"\222`C\005*6\350a2\006M\260B84^`d<\341\202\023\034P\020"
+	.string	"\241\241\226\205 \326\310\264\342\2108Dj\213E\245\026\212\216AB\366\205aRp\330\016\211(T\360\301\310\250\002\353\302\260\r\2720<\262(0`\n\036\217'\220\035\332\240\320\030\001\341\320\370\343\202\025\022Q\340\220\241\007\005\020\t\021\3551h\024\321"
+	.string	"a\260\250\202ph\224"
+	.string	"\330\262-\b\211'\204\036P\360I*\036\333\245\244\"\222\305\211\r*h\020\016\215\032\251=\"\262\307\266\205$\326\005V\205\023\212\222\202EB\310\b\264'\204l[\304\266,\nVXLA\034\002\261IBb\020\t\bE\016]\234\320G\022QDt\034Qd\004"
+	.ascii	"a1\205\317\t\246$\2431"
+	.string	"\370\3433T\002\212\r\031\230\212\210\354\222\007\330c\t\302\241\221\247\204\244\244%\242O\322p\251\001\302!{D\f\252 \016S\bW\341\220\205\fH\326\305\260\204vHDA84\002!\211\210%\034\031\203\202m\020\205phT\213G\246\243\274B\210\217$\342h\211\005+\034!L\032.\261\360\300\n\213)\326\037\021\205\016H$[T\024L3\360\301\005\2064\220\201\017.@B\003\277c\261-b%\300\362\264-2i\211\004V\270\324\016\3336\030\244\304\266H\246\026$h5\034\331\226U*\006\275\200DddL\372\261\307`\013\3411xD\032\021!\035\r\221\210\212\212\202<mKd\304\n=\034I\004\b\344\004\310\242\241R\220\310\204\"\250xd-PT\024TY\"\344Q0\251\0046\211E\0209DqD\034*\035\203\033Z\"d\004X\245a\253Y\"\326\310\264B\303P\t#\243\n@FF\0258"
+	.string	"\261\340\363\242\341\221%\262G\372 \2040\200\020Dp\241^\004\003\2200"
+	.string	"\211\364\"\030`h\310"
+	.string	"!\f\351\2070t\202 \202\004\b%\210\3306\230dTb[\242\226E\262G\242 \344\320Epe\211\3306\330\2660L\032\262\b\266-\b\207\306\016=,\321\b\302\241QCK\034\236m\260\230d\204\266G\0221\242\310(\003\266\r\252"
+	.string	"\022A8LqDjU\021\212F\027$\034\221Z\215D\262mPE\321Q-\032]\220PtL\221l\033<\242(P`\341\210\264\202\310$\\;\020d\217,\210\202\306\026\310\310\241\r\036\177\254\260\230\"hlU$\321\321\320\210\bT*\022Y!\021\022\311\026\025\217F\"\341\320\230\201X\034\266D\326\005\366h\224\240\002\"\266\r\2720l\213\202\254\220\310\310\250\310v \330\0221\005[\004\211KG\fZ#VH\324v8\222\bbq\030\274"
+	.string	"\271D\204T\032\036W \025\265C\026\204\304\023II\305#P\213\340\361<\222\210%\245aRR\361\230\221\212\332\241\021U[\004\231N$\273\224\024t!m\217A\244\242\314*\005W"
+	.ascii	"\"Y\020\016\215</ \021\265\b2\365\274\200D\364\363\002\022RQ"
+	.ascii	"[$\266H\"#\341\320\230\n\207\3063C\007\240\322R\013\302\241\261"
+	.ascii	"\2078L\321\236\020\016\215?>m\021kd\004\304\n\213JD,Q\2334l\211"
+	.ascii	"\2048\250h\021d\312\300\266\301c\217\360\210\350\247%B\n\261"
+	.ascii	"J\303\366\307\024Lb\205\300\rl\033<\022\001!\211\254Q\2518\202"
+	.ascii	"p\310B\033d\341\002P\213 \023\221\317\013HD%\222\210\216D==-"
+	.ascii	"\262Xd\021t$b\215L\355\017\360\210\030\f\022\035-\261`\205\035"
+	.ascii	"\210\303\340Q\006\244\022Q\022QKT<\026\005=\020\207\301\243\237"
+	.ascii	"\f\307\342\361\310v(\"*\"B\262\bj`\215L-Q\t\r/ \021\021\207/"
+	.ascii	" \021\271\b*\021\021\031\031\223\210\210L\302\r\037\210\303\240"
+	.ascii	"\t,\222Uqd\217\216\206\307\025-\212II'( b\221K"
+	.string	"\032\\\004\223\330#Q\213 \023\321\006\2248\f\036\375\330\"b\320\005a\220\2108T\"\022bh\227\214\355R\221\350Xl\213J\032\322\226\270T,\"JJb\213\210\330\244\241Q\361h$*\266K\301\016\355Pi\230DD\324\022\331V\250=\222\322R\013'\222(\330\006Q \207.N\b\207F\f,\\\024.\212[\302=\222\210\342\221\351h\004\362XD\022Y\244\004H\242\342\221\351(m\211J|\300*\r[c\261\250B\313\036\035\203m\217\321\b(N\024\217LG\032I\304*\r[\342\222\n\341\320\310\323\032\245\200\221D?\306\024\3600\005,L\001\267DvX442b\213#\b\207\306\036\246vXTLb%\340\"\250$<\006[\034\213%\bY\326(\2108\f\232\220\304\272\300&\255\304a\320\004 \2618l\207Hb\360\230aCq\330\006U\034\213mQ\260\004\r.\020Qh\211\303\"\013\023"
+	.string	"b\205\305\024\355\2215\272 \241M\032\256 \026_\030\036\213HA\310\b\004\333\026\210\214"
+	.string	"S0\211E\301*\rW\374\264D%>h\211C\025\311\262\307#\026\305\260\210E\001\202m\203*\230\216\254\013\305\"VE\006\245#\333\242"
+	.ascii	"*\036\231L\320\300\241E\260\002H\310\340\261\bC[\304\300\n\213"
+	.ascii	")|\212m\360\310&\261EE'6\b\221\017`j\207.\004\217&\f[bpC\213"
+	.ascii	",\026\033\200\341\307\032\231V\364\374\b\223\212HH\366\210\264"
+	.ascii	"B\351\310\266\303\t\210\303\240\tE\301\264(\250\036\213\307#"
+	.ascii	"\tEA\036#\243b\2734BQP\007\261J\303\025\302 \213\024\354@\261"
+	.ascii	"\250\202\020r\350"
+	.string	"\342\304\321\022\013\026\305\006\3420h\302\221%\016\203\307\025\305cQ\320\207\025\026Sd`\223\216\210':\fSH*\036[bq\004\244\"\342R0\311\007\005\026\271\364\343\"\230\304\252h\021\254\200\220m\203\307#\266%\0165"
+	.ascii	"%\005\213\212G\343\260\210U\001\242\001\304\342\260\r\2760<\006"
+	.ascii	"Y\342P\205\026\271tDj7\264D\"\264\304\341\222\312C\034\022\205"
+	.ascii	"0\324\022\207K\332E0\205"
+	.string	"\221Q\005\"\223pm\211l\321\221e\2018L!\004\022\207A\023\212G&\023\210\303\024B\036\3420hBK\034\026\215-\333\002q\230B\370\323\016\225\206*\264,\322\310\350\001+XaQ\3518\fJ\220\001\251\250-\256\360\003\342)\261\241\275P[\202\t#\211zH\260\300C,p\t\026x(\210K\004\361\220\013\\\302\005\036b\302\302\340\222\007\206,x\226\210z\326\022JG\266\025b8\266,\374\264H\"M,\201)\311h<\301\001\211\f\032[\024Uh\021\254\200\322\221m\215>FF\025\330\244\266-\036\221Z\240\221Q\005\343\222\2208l\261\266H\"\214F\020\213JJ\305\242\t^4\262\307\021m\261x\034\001\354\300E\022\035\3316iX\302Pk\004~hh\204\n\"\260\202\t\272H\204ph\034\321\"\035\r\223\214F\020\207A\245\021EG\344\b\021\035\3306\330\"Q#\243\nEA4\251Xl"
+	.string	"\021z\340\233F{K\262\304\371!\030\321R\244"
+	.string	"\335\322B,\017tC\355`,c}x!\364\320p\330\r^\2211(:\r\013\311\241\246G\333\023\036\036Tn\350\2360\311RI\222\3249\311\261\326\351\322\245\306\246\002\271Q\005J\371\204\272a\201q\262\006\206\201\216\227\327V\203\242DL\t\034\234\225i{+{R3!1\256\244\375\330\336\230\251\333CS\313\326\330\004\361\301\344\327\3063\204\211\034\253%\232\354\354\212\226\232\263\224\255K\024 k\224H\244\234\2351\373\025\211\322\264r\225\344g\345\r\306\0247@$\372\255\001|S`\300#\251\025\030'u\210\020\001\226\335\252\252\275\223\273\251\315"
+	.ascii	"\322\250\370v\220\035X\206\263\370\344\205m\371\2023\260Hju\216"
+	.ascii	"\2713$\216\t:\372\007\016Q\2670\250-"
+	.string	"\223`\200B\260V\216\027t\336p\006\002\311`\236\260H\341<\207L\2158c?%<XZw3\274\274\200aC\200WThf?\016\f3{\242\346\n\316@0\340\227\t\246\376\201])\222\016\232?\234\370Xo\354m\225\225\301\031\270\005\354q \327\201\\\030\310u\366\365\245M\312HI\363\017\344\241\307\3266TjsZ\272\353\347\326\307&M\226Y\004\226M\270\340\f\314\001\314\001\324\241\006\251\221<PG&\263v\346\316\304\234\376\201XjSmZ\276\001\003\304\221jq\323!\346uC\305\333\347\027<\"jUU\300\253kp\332\373i\357-\261\f\350\232\326\2604w\362F\210\037hu\340U\231\025G\0337/\023p\332m\265\261\303L\033U]\233\264\034}4\324=f\034\034VpN\3314\211\321\341\254\354\243\332Gp\006>\001\237\2002\356\256R\222\006\030u\240\214\275\0367<$Hp\006\306"
+	.ascii	"~\251\373b\005g \024\020\306\377u\370\204\206\f\b\003\370\242"
+	.ascii	"g\013M\212\031\236%|m?L\250\351\037\350\244b\371\311\350{r\247"
+	.ascii	"\215^\242\026\246\007\334j\031\r\245\n\232!}vw-\006\031\270;"
+	.ascii	"s*\231\223\257\253\237\2354\257\312\225\331\022g\024\314\006"
+	.ascii	"\336\320\220L\321\371i\335q\201M\341\374\223s\313\230A\363\261"
+	.ascii	"\021\346\024\326\374\205\365\330\255\365\215\305\331\341\363"
+	.ascii	"\225\244\343\006\347\306\033\035\003\335\362\326$\346\206*\312"
+	.ascii	"\030\030K\332\374\236\362\2306t\314\360\375\260z\274\272\354"
+	.ascii	"\316\260\371E\251G\234\316\372\230p\302\214\204\331\372\255a"
+	.ascii	"\342\266g'\205\363\206\244\022\252_\232\377\324\360a\371\310"
+	.ascii	"\302\371\227\367\323\373\277\236"
+	.string	"J\310\246\340\341\374\273\274\232\275#i\260\250\341\374\273\373\341\211\221\271e\371\231UM$\315<4\353\035\225\n\215\316\2173\252\035\034f\310[\0223h\337\0225up\2772\351\331iC\354H\224\037\231\325K\262o\314\031\316b\304\250[ \266\250\224le\271\271\027z8\337\304W]\035\004\330\2405\317\274\346\306x\340|\023Utt\372M\013\225\032\037\017\2219Zs\346\346t\327u\262k|\310\302\206\326\324\\XWd\340|\020\366\270\374'\307Ew\001\225[\27754\310\0275\0348\377\274t\271\323\242\345G%\304u\2229\203\241\206\204\3057\205\363A\300\202\005\313\027\030j*\226;+\273\264\2708\375v\235\354\032\033\256\210Ak6\243\356v|\301\371 \204\375\250\374\250\374\254\244dS]WgfWW\240\374\252\374ge\257O\f\0240UG\272^\264\301\371 \340\2302%\325r\235\354\032\036\352"
+	.ascii	"u\320]A\303\371 P-\227\311\037\327\216\263\302\371\037\334\211"
+	.ascii	"\022\345\027\205E\205fv\3434\265a[\363\344\311\257M\210\253\351"
+	.ascii	"MjF\245\306\327<\322\346\211\016\34768\\\266\352\340\374\017"
+	.ascii	"\242\240\241\375\330\3243*4\263\364\305"
+	.string	"\0261r?\345\177lpQ\270T\221\203\363o\r\315r\307\035\234\177j\207;\303\353\262\203\363\257\311\341\330\300\256\214\301\371\227\366A\217%K@\354\240R\262\265\212Q\333\003\203\363?\250\221$\311O\211\020W\023\233\f\216\360\241\341\363\331z\303d\207\331\177Jr_\006\244l\340(A\347\310\221\365\206\026\225\222\255\263\275\223!\034\240\244.\211\363Kh\321\277\262_\231\272%\304\325\024G\325Bu\204/L\352\211\030\234_Bl\354\277!c\277\"\252\026\241\375\004\265\267\306\200\350P\025a6w\224V\210\243\037=\300\020\371\257\b\230>(q]?!*\0323sNp\376\005A\263l\350!\001\362\257<b`\302\360\341\374!>\375!\275\337\326\177\\\277\255_\330y\206\016\220M\212M\214\327\177a\377\375(a\342j\316\314\3168\005\213w\2504d\221\330\345c\272(\306\002-\346\034R\nM\021i\003C\025"
+	.string	" P8\032\221\211\206\373\334\r\024\200\013R\306\246\200L\232\013\245$\250\020SF\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200"
+	.string	"\032\272=\343\n\200\337\326.\365>\020\r7\311\r\320\bG\245\377\216\361:\027\214u\262\210\306\212\004:\200\226\271\202\320\013\316\262\023\333\034\n2=\213\303\251y"
+	.string	"W\325\334\347\222)i\020GAc\226\222\f3t\3162\250\266S\022\353\034\264\223&\"\372\312\300\326q\245\037\303\253\314\345\262\001L\252$\2554\3037[E\217"
+	.string	"g(\360t\262\212}@\256\030Hc\316\270f\360B\345\336\360\035\254/"
+	.string	"\246H\004\025dx\032\313\237es\265\363g'5iFQ!\367\342\241\332\231\317\210\374\277\232@\326\262,\3122\n\274\001\245\245\026\f\242\027\247f2n\361s\177\034%bs\230\214T$\003\256\232\nJ\2435\375\363\260;\217\004x\307\204\321\352\375\227\211\222\323\324"
+	.string	"\005\242\272KMq\032\371V\202\312\261\217;\325\370h\320<\252rp\233\212|G\227\360tM\222F\2212\002\036.\f>=\247\033hI\0349fi\003\013\226\331\004\200\034\013\017\032,\t|"
+	.ascii	"R8 \310V&&\256\324\b~\372\322\264#\352\266\350\374\017\230\220"
+	.ascii	"\206\204<\271\355\356\231\304\300\211\312>\230\225Q0\222\333"
+	.ascii	"D\275\207\003\352"
+	.string	"\377\343u\360\302\001\326]\\v\001\027\\\260\340u_(2J\003\265\202!\333\336\222\36661B\237\342u1\310\223T\261\376\034\237\206\302<\013e\313\354&1\336\217\007-BVM\224\256j\235\317\332\321\323\001\233\234\301\213\204\205\254\376\025\024o\317n\320\230\250\273\360XMj\233\027\207\306\324\370\313J5Eb\213\277\232(F\215\252zR\022]\204Ih\340\347\025\343(\346V\314\210\320q\032\263\233\2045A\023=:-]\366\b\211\354\336\243F\216r\314\301\250\376\3262\217\230\013\362\2350:\354r\\\3455\002\253l\203ZX\034\230)[l\316\340\370 \0267\211\254\303\336q\024>\345\206\3708\274\005\347\353\240/*T)\202\2660\301s%\232\205!&R\370\340m\237\251\346x\037\367\262\227\031\003"
+	.ascii	"\203\324\315^Jxg&\345mcOW\017\331\346i6\206\202\3103.\216[\007"
+	.ascii	"\013\241\261H!\3452\317@$\007t\037\243\027\033\325\212\316FG"
+	.ascii	"+Y\217\016\201\004n\362\t\313\361\367\231j=\223\223T\303\301"
+	.ascii	"\345\\k\243\350\007\261\263\333\324\213\333G,%\277;M\366\027"
+	.ascii	"^\020\247\217\321"
+	.string	"\353\265\233C\204h\320\206\346\030+\264\275\333\330FO\364\270\363pT(\004\367s\307%\202\025\260\223\026\3727G\004\302\002\243{\374\333\201\330\254\307+y\260=\363c\207@#\207\377\345>\333o\357\376\353\272\243\007\332p\2219f\256\266\215\225}\201h\270\310\362\212\216E\307\373*]B\224\224n\242\233\021\257Z\220\350!^\201\360\274\022\027a6-`\215\204P\377\2368_\216\013K'\263\223\303\336\0216\024\346\203HY\205\363\366d\tY;\304\323oi\342\317fS-\205\226\340\332\302\247\207;\005\312\200\0161\021d\263\210,\036\001^U\3371\365\252\n#\006\361<\252\\\005\334\t8\233\376\334H\364\366R\344\252\006\341\251\267Y\013\320\"\216\250\237gkV\003\036\352\3224\031\236\025\002p\362\001\203O\274\301*\351\320\356\237\003+\rK\337e?\345\b\370k\212\227U\\\266a%\314\227Kvj]\242"
+	.string	"m]"
+	.ascii	"\234b\030@\210\244(\036\204\262\323\002\2169\3421V~\202L\312"
+	.ascii	"\304\354.:7\020LM\374\356\370\031v\005Apg\223A\217U\376\273\n"
+	.ascii	"\377_\322.D+Q0\317\315\262\375\201E?\266\207\223\343\3202\350"
+	.ascii	"\307\017\t\327m\345\253\230U\242\342\2610\327\007\353\264:o\363"
+	.ascii	"\252\020\017\221\331A\255,\300!z\226\200\004m\324\346\272L,}"
+	.ascii	"\337\026LGzu\221\247\271U\3609\234\216\314\0042\205*e\326k\233"
+	.ascii	"\212\255\305~\002\320\266\343\337\213\200\211\266\214\366{\301"
+	.ascii	"\006q\247\364R\261l\343?\245\251m\031\227\215\350\356\343\371"
+	.ascii	"\365\206!\2475\361\254%#\231<\005\355&\213dM\324h\315A=\214\246"
+	.ascii	"#i\004\2065\\\220C\206\037\350\004\013`\250%\256\022\367\330"
+	.ascii	"LL\361\300b\025`\204\246\354YNK\201^\317+\267\306\216\tg\256"
+	.ascii	"\263\362\346\027\2032\0317\263\226\332\307\013I\214\220\231;"
+	.ascii	"\b\361%\353M\301\264\326\355\212D\b-Z+\223\242\301\030\373\177"
+	.ascii	"+p\314\347\265\256\027\337t\001JN\366\340\223\016\340"
+	.string	"F\206\350\372a4\347\221F\024\216\034,{\3307\"o\363K\342x\300\304\344\327\033\236w\335*\277%\3303\355\277\006y\243~\275H\007o\275\031U\017 \244\312\n\002Zd\341\212 \357\307=+\311\251\276S\211\023\220\256@\356\267_\217qy\023\272[\326\241\273\242\354\2105\326\252\013\270[f\320\003\362\216\340\ft\2278nZD\325M\361\033~\236\t\fw\322t\215\232sc\335\305\303\0130\013\331p\005\030\335\007B!PjY\267\322\320\300\3122\305\240\245\244\262\375\027yQ\234j~\216\237\347i7\270\007]\367?<\317\003\245\312\024\257O\217\364\007\354\226\302\376t\207\227\267.\370\2776\032(\2763\247?\\\235\330\013)=^\025\353\006)l\201qT\240\354\264\366fw+\210\307\277I\b\346\1778\342\033\277\340\216NJ~'\025\212\340A@\251\221\306^\222\245\033\363:\245K\002E\"\333\371\013"
+	.ascii	"V\220!\272\004\211\226\316\3072D\353\327\221\0249\200#\242\357"
+	.ascii	"\016\023\033\227o\022\022\001\001\273\335\203\027d\366.R\373"
+	.ascii	"o\034\035\253@\202"
+	.string	"I\327CY\322\335\227\230\256\274o\227/\370W<.\316M<X\217\207\321\373\265k\264\371\225\017f4E\025\005\0340Y\004\344k\\&\342a\n^\336\325\234\036#;lVs\204\231N\372[\354D\370\336\235\354\337\277\361l!\276\017t5\332\316\224\016\227\256E\337\322\345\206\264\021k\316k\335\177/*S\205\255\350\363`\302\rHB]\006\331a\226y#\214{>\267\275q_\264\307\260\225f\275i&M4\200Y\3758\264\016\203VJ\357T\335~\024\361\240\003\375\203Ns\001*\354z\2200\365\337@d\025\244\344O-s\376i\317\232\344\005\276WS\231t\254\241\b\035\"\202\247\265\233\216\352\327\022\352`\262\250\f\203d\322-\215\302\236\303l\320\024\360}\201\210\210\360\240[\326\333\277\355\352;\245\f\334q\341\331\273\302b\031\346U\217\210V\201\332IT\334\243U\372\364u)Hz=\225t\2546\001"
+	.string	"\f'T\215\305Z\037\302@\254\2154\022D\031\250.\177\230\222\204\267B8\313\246X\357N\357\3603\243\306\353\337ck\377J\263\032\375x\230\374c\\n\021\322h\367M3?=D\334\314\371\r\212)r\310\334\255\271f.\313\374m\207[n\323\226\023\234\374\004\263I\\\300\331\332\004\022\001U\313\360p\027\260\222Mr\355\272\242o\257l\375\025\n\226Z\331\366\362\230\304&\247\267\202\205N\377\260\214\2165\274\224\267\340\272\251o<~\233\037LS1s\222\341t\363m|\277Q\371K:"
+	.string	"\021(\001FB\261\221M\224a\305^\224\006\2608\fr\247N\272\211o \324\017\323p"
+	.ascii	"\250(z\330\276\270\201\344\330c\005\f\3647\3303LE2\301\r\314"
+	.ascii	"\366\346\037u\027yHw\256G\354\256>\245\"\362Z\273R\262\217\377"
+	.ascii	"\376eP(\222\017\\!\021\005\310\317a\270\241tijL\037v,\233\372"
+	.ascii	".\351?\021\302b\355\264\255\362\355\3354\374\247\357\234\033"
+	.ascii	"KO\246\253\252\340\021Z\241\257\314\330q\024\322T3\320O\262\353"
+	.ascii	"\315\n\327\nC\226\271\f\004\020|\230\230\364x,;9\265\302\210"
+	.ascii	"uP\364\2109\017=\345\215\330\356b\366\326\255+d\200{\037B\332"
+	.ascii	"=\261\334\262A\241=1\342\344\032$\243_\263wV\324\217\027\224"
+	.ascii	")\023l\031xa\034|\3725\305S\255\357\273u+\351\261\002b5*\200"
+	.ascii	"\335aS0}\277f\350\334E\002sd\362z\253\tz:;<\367E\214\032\356"
+	.ascii	"1a\273K\013\257K\223\205\366(Lc\"\346\304\233\366w\023\020\205"
+	.ascii	"\302z\267\b\025\337\320\2009\032ZBIH\003\271\222a\211\253\027"
+	.ascii	"\230\256\340\307\200\007\020\355\250\336*#iO\t\303\276p%=\\\025"
+	.ascii	"\003wq\247\264]\207=\213^\364SBe\361\311}~\215\327\017\344\366"
+	.ascii	"W|\024\302\035\265\317>\366\243\345\203P\021\302'bV\346\007\267"
+	.ascii	"\312Ky\301\321?\206\353\234\0076\344\331\r\334\020\303I8-cr\314"
+	.ascii	"C\200\272\206q\320\004`\303\020F\227*\261\327\325<c,\223\002"
+	.ascii	"D\006=\0307\271j\340\247\264\321\224\205F\363\217\267u"
+	.string	"\355\214\275\325M\205\256\035\326\325\213`\333\020\037\021\326\371\376\007\033<D\002\022L{\336Rx[\2002\035\307Y\273\316\026\271\333\245\312\314l\221\354\251\316\032\025\240\033\366\354\006N\3145O\nJ\347:\364]\334\226Os[\331\324M\340\255|\034@\231\023\216xB\327\2265\212\301\353\304Y'\327B\244+"
+	.string	"\005\336l\244\225F\322\007z\242\330\250~\"\330"
+	.ascii	"\241R}\201[\325\253\036\346\307L\344\364s\327\030\001\026\006"
+	.ascii	"\r\264\307\024;*\035$\336\336al\217\370\021\253\331j\222\324"
+	.ascii	">\016\227\322\353\274u\232\211\243v\310\372\325#F\345\304D\225"
+	.ascii	"_\0057H]\315v-w\216\273@\352j\020|\341\260zz\372@\326\237\f\023"
+	.ascii	"\233\273\317\316\032\256)\017\225\371\373u\347\0369\316\233\332"
+	.ascii	"\025&9\310H\2150\362\022\202&\356\034\336\240\345\262L\013\007"
+	.ascii	"\200\233\231t\004?0\315\371\267\271\\\037\254S\307\220_#Db\344"
+	.ascii	"\220\035\333\354\"\322z\241\271M\270\222\376Cv\214}\245a\271"
+	.ascii	"\r\333\336\363\b\001\376\311\217z\206o(.\007\327\273=\264:\260"
+	.ascii	"y\031\341C\306( \270\376\214X\361\226\207\215\233\352\215`\033"
+	.ascii	"B\355\245f(\353\0018\300\261\343\335\373\217\321\013J}(\345\266"
+	.ascii	"\342\327\005\310\002&\206\251P\036\213\333j\311\270$\212\210"
+	.ascii	"\027\275s\217Y\344\027\036\253.X*`H\005]F\276\362hi\227\301\016"
+	.ascii	"\374\003h\351L\344\271\231=\007K\\\no%Lx\233\330dKo(\030\243"
+	.ascii	"c\274\362\357\244\317\302A\230\244\226\"\214Lx\321\0208\215l"
+	.ascii	"-\356\2339N\003\324b\266\344^&\355\237\024\310\331\274\220\357"
+	.ascii	"\324TD\013\201:W\206\017\037V\016\001R\336\215\240)O\250\nn\363"
+	.ascii	"f\374a\317w\374\331i\261w\322\345S\341p/\327\026\264\263\260"
+	.ascii	"\364\n\302\314\f\325\0319Q\030\210\031\020\202\027b\376\026\f"
+	.ascii	"U\202\232\"W\203\305H\212C\335\340\260\322\376\240\311\304\223"
+	.ascii	"\r>\225j\311\212\002\226\322\035wI\257\266\301\2756\006FI\200"
+	.ascii	"\316\034a\006\003\255\037\b\335\362U1\314L\001\241\0053\2104"
+	.ascii	"3\030\232\t4i\004\237Ui\3013\346\341\205\3538\375\0022\341\322"
+	.ascii	"\257\030\355\023[\321\300h\021\234Ou\323\227K\325\254F!\201P"
+	.ascii	"\007\374:v%g\275\305\217A\225\323G\322\330\207\325\032\017hU"
+	.ascii	":\266C\201*\244\030\205\307\201\371\017Z\360!\300\3212\246\203"
+	.ascii	"\355bnM`G\321\366\2172\341\004pm3\031Z\b\222#\376I-\314\306I"
+	.ascii	"\235q\266\3563\224t\031Qcfz\213!kF\333v\276\250}\200\200PA\343"
+	.ascii	"\216}E\270\f\320\266\027\200\f4\327\227\257\\\331\245\331\216"
+	.ascii	"\003\205s6\362J\231\331`\214cB\006\334\334$\324\016\230\204g"
+	.ascii	"\313&\351\312\276\212\200\221\263\030\204\336\252:X\nP\324E\271"
+	.ascii	"\350\234\274'1\267\255\260pf\372:\036|*6\023\2423W\221a\020#"
+	.ascii	"M\323N\316\002*\\RC#\021\004K\002\025\207\371\220P\021qw\346"
+	.ascii	"`\367\bvL\364vt\326\234;K:\n\226\205\315\341\2016|z\001\005\363"
+	.ascii	"\363\227\353#\226\227[6+\211\224\337\327cK\356g\342d\261\230"
+	.ascii	"s\2076\276\255\217\243\255(\225\366Yq\003\277M\025\376M\265M"
+	.ascii	"\270\214\232\371\220P:\211\213n\350\037\206\236h\202\264\240"
+	.ascii	"Zc\211\035\335\017\n\313;:\017'\313\272\322\247\221OT\326E\024"
+	.ascii	"Z\204s\236P9\352\270S\242\356#s7q\\J\037\342\026?<\375!{=\030"
+	.ascii	"\201deNs\035\360>\026\3276\255\323\255%\233!\3331\037-2\227Y"
+	.ascii	"\343f\355\234\215\310\302vh\230\006\022\005\r\330H\315\235\332"
+	.ascii	"\212\255\304<W%\273A \bVpg\210]:\301hW\331\214\t'\r\321\272\260"
+	.ascii	"\307\242\341`\rL.YS\024 \331\022\033\274q\210T\2345g#\033f\364"
+	.ascii	"\006_S\213\017\f>P\344\362\343\334@}G\256\207>\236\b\335\244"
+	.ascii	"]\212\0130qO\020\031\320\324t\343\220\210\007\232Z\032I\221\374"
+	.ascii	"\216\313=D):\260\342\277\373M\3014\321\227\344\020\204\2737\305"
+	.ascii	"\376P\242*\203\200\244{Z4H\240\223\201\332[\251\376\206\317\210"
+	.ascii	"\004(\225\3256A\223\231\236\030\370\351\210\007\322\031\030\315"
+	.ascii	"\216\201h\305i\235W%\035\244\372\304\352\026\263e\300C\354\201"
+	.ascii	"\tl\033\257\325\204\261~q\274>`\316\261|dY\362\332\364\300\346"
+	.ascii	"\363\033\271m~\")\0210e\252\352\367\253\312A\026\n\325\013\276"
+	.ascii	"r0\343B \275\320\306\272\200\246\317\353*\270x\204+-\213_\325"
+	.ascii	"\225#I\272\306S\301\267\2069\270\330\0263\334\311\362\277y\203"
+	.ascii	"\265W<\"\331\317\234\3643\345\202\234d6\323\265=\376D\035\036"
+	.ascii	"e'>\322\276\262\001D\340\301\201\376\031(z\313\315\266T\257\033"
+	.ascii	"\347\\\272\253\004Y\366Dh\252\277\037\320\023b\360\242\035\324"
+	.ascii	"t$<f\004\354\031QHB\336)\2317\3600\311_^$w\266\005\025\214\211"
+	.ascii	"\334>}\245\006vMa0f\247uX#Y\345\003&;\342\3353}:S\005\311Ar\262"
+	.ascii	"\016\302\214D\205\n\031\232\333\020\023{-\374\bt7\303}\316\b"
+	.ascii	"w\277\346\226\005B\377\001\321F'\224\211\353nj\202KQ]\313\341"
+	.ascii	"A\352\340x\220G\0301L\217\370\342!\220*\313\220\375\024\263D"
+	.ascii	"\264\265\006@\004\332M\313\210r\301!\036\226M\274m\265\354\343"
+	.ascii	"\n\331\370c\336S;\300\350\004\362\020\264\352\360\024\022\231"
+	.ascii	"\244\304\024\n]\375\371\341f\034)\207\242\331Gz\325\024g\210"
+	.ascii	"$\250z\225W\027\006\375\225\264\237(\265\271\306;l\3716\334\217"
+	.ascii	"\346\206H\266\255\2414"
+	.string	"`_\324T\227\003\035\204\200-\342\267\232\250,\363n\320t\205-P\3103n{\246\376i\224\034\312\314y\255\262\310\006\353\267\3243\007\260\347\300}By\305E^([\263\t\001\311\305\332\222f\202\207\324n\260\240\321\032~\260\330\037w\2113mG\323$#1\273:\3677\215\261/\214\021\316\327v\360o\303c\253r\243\266\330\b<\212\326\033\306\377Bsu\305$;V9\204\357\245\201\273\366<\372\356\321L\205Z\026\002\217/\205d$\377\t1\300\316\204\032\n\337\016]\211\227\321\032\017|\333\342\030\273 )\201\")\371%\337\370!]b\nP\345{\332\025F\353DQ4Mi\201\265\314\363\201\327\230d\223\324\212+eQ\255\003T\207\277\361M\260\320\017\026C/{\365RI\375n`cg\231Py\243'\313\214\3665\340\254\353\327\327-f\340K\242+dj\224E%\020@@\316\364\354\251\\\364\353"
+	.string	":\36548^^pG\215\002\024\367oQ\206\360VB\235\264\2529\314@\347\303\206\237A\300C\034\231A\303a[\276\016x\233\225\236\\\212Q\021\211\237\032\017\005\216\213 \346|d\256\256\032$*\fN\013\312Z\367d\347aES\020@\224\013\375\377\327\240v\232i\r\036\217\376\347\320\310\016se-\2537\221\341\306\023F\355\214\341\355\312'\247\277\351\221\030\223\224\336\256\203\235b\214\356\005\223w]s\372P\002\257\322\206L"
+	.string	"I\257<\271\001r\263\236\355\b\2567U?\236\216\307\2501\013\356}\003}*\020\234J\251\023\202\312Fw-4"
+	.ascii	"\035\013\027\227v\356>\200\342Vm\026eN\246\0178-.\337ol\3343"
+	.ascii	"\231\367\001@\231\327\212\355\b\3579\373\354\310E\177\264\253"
+	.ascii	"\005\257\252\ro\2228\2360\333"
+	.string	"49\340*\031\311\325T$\236\206}\370\376q]\213\203\031\300\264\377Od\026\327w\2110y[<\362\307\264;x*\300-{\350L\352,\233m\257\345d8\001\b\235\334\205\267\234\363\355\331\b\341\022\204d\334q~N\243$WFZv\024$\205\362\263[\226\004(\022\232\310\201{"
+	.string	"\325\372@\233\250*\361\215jz5 !\321\243\020\365\336b]\371\261\236\037\330\001MM\023\313\035\316\301\2263\305A\354\250\215<\330n\007\347\360\334\212b\200Z\271D\376At\210X\252!U}< \\u?\352\312|~t+\274Rb\224\256\016z\255\321i\372\240\317\207O\351\331\276\022"
+	.string	"\373\003\025\365\253\217\260\325\233\216\311$\006!qcD\304\233\357\006AC\t\301\267\243\230\251\003D\332\226\002{\315\331D\205\330\036{\024\230\032\304\3548\205\310`\216J\n,\200\003\230\336\355\3453"
+	.string	"k\300\324\333y\247Q\224\225\\c\246\343U0\343r\3172\234#|\254;\2626\270\005^\222\005\213\204"
+	.ascii	"\327\021_7T\036\031NZJ\356D)\274\227\2606:\nL\356\220u\301G\271"
+	.ascii	"\267\035\350\357\tS\b\t\266t\303\004.5\372s@`\375\216M]\375\271"
+	.ascii	"\244\255\221\303\037\257\03647)\244\265\313c\313\273\177x\025"
+	.ascii	"\026\230\260\244"
+	.string	"t\231\3226\304H\254~\240\335\212\366\2745\365T\220\224\201\337\f\262\353V\316\367\037\013I;\234n\t\320\250yF\2138Ibe\3767\020N2b\253\2376\366\363\022\244K\347\363\256>\236\341]\310\240hU\206\246\225{\203\310F\227\325\271[\3165<\264\261\374j\221c\303\"\310GLQ_\r\006\233\033\r.Zu\025k\263\323\360\030GW\007J\356`\3774\334P\034/\302@m\355q\177\220\313c\325\242\255\377\367\324s'\374\234\2163t\361\035\340\037\213|\325\263\237P\215\205z\016=/3\026\315G\346>{w%f\034\007\375\0039\323\323t\265\336\276\005^\327\355\307\333\332\250\305oF\375\375\326\017\336\350?\306\361.\275\261\233\"V\333\371\262f\2272\377\340\030\333\f\321\352jY^ \255{\001C0\351T\322\272\300\274$\2747\317\243\367\231\212\257\0173\1775\r\204\213P6\302\f\315\024\375"
+	.string	"\n\372\302\277\257\225V\265\027\326\237\262\275\233\3213\353"
+	.string	"\330\rg\202\276\345x\016\215b+\336\277<\261\223UVn\261q\345\245\375\344f2\354\371\251\327\034\030\376\200G\027\215\330{\224\355\332\373\337nw\360\323\371\006\316\305\3136\037\372Z\375\366\354\307\313W\332}\320\367\275\236\377\362|\364\357\031\217\037\\v\301`"
+	.ascii	"\370>\200\350\367\233\236@\257\006`\342\n\300\332}\270\007N\366"
+	.ascii	"\204\260\330\016Q\\\214\325\007`\372\b\210\326\223\030\346\252"
+	.ascii	"\362\336\237\213\231\361\276\315\f\005=!\037\254\300\251\204"
+	.ascii	"q\236\371 \200U\376\221\356\372!\347\243\222\367\270?L\312\307"
+	.ascii	"N\207\343\377yh?\271\215\\\337`\021\243%\365!\373e\257a\362H"
+	.ascii	"_\211\372\321\266=B\351\211\356\371\327\344!\3342D\366{Y\274"
+	.ascii	"s\350\023m~\201g\234y|t\251\377\202?\357\326\364\274\035>H=\026"
+	.ascii	"\303~\246\276B\222\375\256\352\320\f_\315{\211\342\225\240\365"
+	.ascii	"\230(65\363\3374u\362[z\370\362\242H\326\323R\257\tf6\234\260"
+	.ascii	"]\372\234\001\037M]\217t\264\314\240N\007\362+\364iu\226\377"
+	.ascii	"Jat\327=\342\333\325\372l\354Y"
+	.string	"\t\316\211\320XYk\267\273\366+\377\312\356\003Aa\f\342\032\006\037\326s\2712\312!\216\360\374\257]^\244\340G\246\314\243s\345\037\326TeH5Gg\006\233\322\0367c\257qP\243>\271\035K)L\004gv\354W\265\223\017\245\216\314\350\236\020\342\270Zr\033\215gO|\320C\363;G\270}\344\214\211\255\344y\327\200\367\313w\344\243\220\37324\317\037w\351\203\266\"\n\341l\344\311\034~B\341E\023_T\177]\224}\310\365\003\265\364\366}\263\265\026\007\314\311Eh\374)\363o\031/'f\262\322\353\246!BO\302v=\376\332\3678\201\335Ts.n\\\301\263c\030\377q(\372>=\216?h\365g\236~#\375\245\377\355\212\030\245\t_\226\202Sf\371aV\357c .\t\311\325\302\364\323\343\007\025\016w\270 \344p=x\340\362\005\311/4G\241\037\341[\036\022LI\372\0069\006;"
+	.ascii	"\270Z;l\241\376L\254``\353\316\363\"\231J\317\033\320\376\343"
+	.ascii	"6\266\b\256\235\210\226\303\272\251\207\270%\036\244\334W\306"
+	.ascii	"\033\331=\203\275\251\234o\351\213NW\273\346#N\0275\363\032$"
+	.ascii	"'\270vB\374WV\314\311\251~H\254Jn\322\330\265\026\2173\352\r"
+	.ascii	"\244N\327&\366;-\031\007\355\336\340T\217\351\272=\370\177F2"
+	.ascii	"\263\032\342\300^v\244\025\037\276\3158\021\326\217`\337L\013"
+	.ascii	"\312\361$sb\346\032A\036\347\375`Y\376\337\271gNuO\233\331\300"
+	.ascii	"\342\245f\177\240\360j\2453}s\"Y\236x\211\034\311\265~\316\245"
+	.ascii	"\325c\021\276e\353\231\301\310i\036\373\2165\2227\260\364\211"
+	.ascii	"\275\330\222^\326pn\220\333\bo\367x5\2573\016\374\351\370\034"
+	.ascii	"\344\3735\350w`\372Y\336*V;J\336\245vB\376\021\363\021\240g4"
+	.ascii	"\370C(\357F\334%\275\017jw\261e\240\324\215\373\033\300\256\206"
+	.ascii	"\222\253\f\264\032\266\006\321\2103\225\374\376/\234\342\323"
+	.ascii	"\373\2057\034\336\3370}\277\007\262\343'\364\353\030~c9>\267"
+	.ascii	"\\\002\016V_^wo\037\320\217g\342\332\303\341\256g\317\200\345"
+	.ascii	"?\375.'\327\005\322(e\363\3247\027\375oh\333\317,w\205\266\037"
+	.ascii	"\214B\343\251\324\237\032\373R\273\315\325\bz|x\267j\315\224"
+	.ascii	"a\231\f(\2774\366]\211s\353\023SV\\M\263\276\370\241\272\376"
+	.ascii	"\204U\026\330\332n\274\260\355,e\031\323qQ\245r@\346?y\013\351"
+	.ascii	"\034\344\004\375\367\213o\376Ub\240\341\262\341M\237\374R\335"
+	.ascii	"\220\232Y\316\231\243{\351\326uN\342Au\317\234\331\341\353\211"
+	.ascii	"\252\256{.\023\351\360]\334v\364\237\275N\032\274\34238\354\033"
+	.ascii	"\223\263\244\006\337\016ga\362\337\350.l9|N\276\206\346\220\r"
+	.ascii	"\275\274\332\177\344ij\337\320\t\212\365\312\316\320\033\320"
+	.ascii	"\307\002\373\256\3269\002|\270\020\250\006\245p\367\230\320\023"
+	.ascii	"=\322=\322?"
+	.text
+	.section	.gnu.lto_.symtab.d1933b172416639a,"e",@progbits
+	.string	"pidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\003"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\004"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\004"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\004"
+	.string	""
+	.string	"pidChangeProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"applyRcSmoothingDerivativeFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\004"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\004"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\004"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\004"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\004"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\005"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\005"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\005"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\005"
+	.string	""
+	.string	"imuGetAttitudeAngle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\005"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\005"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\005"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\005"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\005"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\005"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\005"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\005"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\005"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\005"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\005"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\005"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\005"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\005"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\005"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d1933b172416639a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,987 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\005\b"
+	.string	"\204\n\261\001"
+	.string	"\031"
+	.string	"\336\372\231\241\006\n\002"
+	.string	"\002\001\001\345\247\315\254\005\b\002\002\001\002\315\334\336\004\003\320\301\276\333\005\002\004\361\355\244k\016"
+	.string	"\002\001\005\263\362\307\316\b\006\002\003\002\002\004\006\240\342\234\212\n\007\b\201\277\312\340\b\n\002\005\006\002\007\002"
+	.string	"\t\352\263\360\321\b\013\f\337\252\254\376\006H\b\002\b\002\005\002\t\002\n\002\n\002\006\002\t\b\002\013\002\002\004\002"
+	.string	"\002\004\n\002\f\f\r\022\023\024\025\026\027\032\350\300\306\254\002\033\354\206\342\366\006\002\034\347\273\234\355\f\002\035\355\314\246\334\007\036\262\343\300\276\004\037\240\342\234\212\n"
+	.string	"( \200\202RW\335\020\303\214$\370M\2476\266.R\336\035\215U$r\327\244\306\374\n'f&\303\311\005\363a\260\020c!\265\005 \330\204`~\347 \340\034\024\023p"
+	.ascii	"\343[\223\327V\272\006C\227<QC\305M8\207\026\250\242\220\003"
+	.ascii	"\223\230\271\3760\207RQ\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 \310\335\002"
+	.string	"2\304\013\023\300g8\377?\364\377\377\363\021\025\026%\241%dK\231R\316d\"\363\360\243TNx@f\320W\243\274W\203\215?R\2417\255\336I\270\004\022"
+	.string	"-\031n\322\241\\"
+	.string	"v"
+	.ascii	"R<\353\300\205U\006\2166l\302cAa\321\004\301Y\261\277[\313\005"
+	.ascii	"b\340\b\210\004\006X"
+	.text
+	.section	.gnu.lto_.inline.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\f\003\205\r"
+	.string	"&\223=8PI\224tDF\315\256\265C\"\222\341>\217Q\250!T\260\021H\024fO\2178X\243}\364\037`\2006}7+\207\366\t\023\201Qc\242\241\330\376\223\3216\262\345N\001'"
+	.string	"."
+	.string	"0"
+	.string	"_\270\270\342\213]U\227\242\2564\233\335H\357\336\013\333K\232\231Y\351{\365\267\2057\364\216F\nj2\323\361\215\331\001m\254\224\301\246\223"
+	.string	"b6\004\203\263\237X\373jt[?\220\231\227g\023"
+	.string	"\374&\213\251\226\033a\323A\300\030\373O\312\270\217\023d\330"
+	.string	"\201\017G\2250b\f=\315\346-\202\267\363\334$x\001\304\251\260\270\235\246Y\267Y\267\005\270[u\213\224\023\372<\350\024\345\260\205_-'\341\246\0268KD\374\027>\030\327\350_,l \204\216\202"
+	.string	"\234\260@A\3462K\020\314\315*H\341\350\335\215\003\352 3'nC0\343\224\2022\363\321\033pB\237V\250\321<\352\234\031\n\233\202B\261\030p\002)Tf\036\022\200\325,\204\343\320XW\371o\335\001p\350\330\203\232\360\312\351\240\004c\272\316a\203Oz\222\300 ]\352\260c\233A\333w\226)\361\255"
+	.ascii	"\360z\nB6S\343rUH\373/\007h\305Z\266\005j\234\f(\211\r\340\016"
+	.ascii	"r\216\002\340\346\331\211#?\240\316\007?\2339^\301\306\247\247"
+	.ascii	"\203=\277\202\031\037A\260\356dH\340\204>\345\252\232\237\207"
+	.ascii	"R!\275\356\221\203]\214\013\334\251\330?\377O\211\003\023)^\013"
+	.ascii	"\304<\331r\003\260\231c\210\3623[\013\017#\323Mjw\374,\316\021"
+	.ascii	"\223:\314\310ZL\224:\357"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"]\006"
+	.string	"\342H\034%\2205I\007\377\277\216\233\0169\340\271\261\377\265\253Ld\377\375s?\366\342\374\251\260\2775\267\315\036\3226\221I\006$\017\244\201,\230=\317\n\3256k\255\305#\017\331\351\245\027(\312\022\320xL"
+	.ascii	"\325\231$/Ty\323\232\036!pC\352!\325\311\03049\275\345\233\230"
+	.ascii	"\365\354\214\274Z\304-\232\363L1\210\324\346;\323cz\367\022\177"
+	.ascii	"\342\302\035\001& @\002\202\030\265\036\020\361\335eQ\303\240"
+	.ascii	"\265vq\241\3003\320\343\350\335\270\213\334\322\204\250\307N"
+	.ascii	"\200\002\362\317\334na\022\242\305\020\345f\0314r\306\235.\207"
+	.ascii	"EJB\346(\004\256\234&kP\007\034\253\231u\021\333l\260\020.\007"
+	.ascii	"|q\250\002\263\266\030\031\254pC"
+	.text
+	.section	.gnu.lto_.pureconst.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\232\004\001\232\004\002\232\004\003\231\004\004\232\004\005"
+	.ascii	"\230\004\b\230\004\f\230\004\032\204\004\033\204\004\034\204"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"M\005"
+	.ascii	"R\207\024\035\260'\303\001\320\261C\ts\204a\030\206\001Xf\330"
+	.ascii	"\310,\262\325.a#id\313\224\002\252\236\030\341A\r\363\244l\225"
+	.ascii	"!D\005\236\346\205-a\236l\223\231\243#W[\265\001\324\265C7\272"
+	.ascii	"\270L\317q\241M\204\321X\n\335M\333\301V\031\003\276\b% P\202"
+	.ascii	"1&\367\307\220 \342X\210\200\320A\2039\330\202\202G \363\320"
+	.ascii	"\261\271\302\307\025\223\220\255F\237\200U\022\r\201_\214\331"
+	.ascii	"\261\212\303\024\t\220\033\256\336\307f\325\322l<^\376\235\304"
+	.ascii	"s\251S\251_\240\222\230-\201\030\006-g\274\004\002\326\207W8"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.lto.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_positionConfig_Registry.38.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 \227e\004"
+	.string	"\344\007`"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\266\352\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\001\270 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/position.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_positionConfig.40.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_altitudeEstimatorInit.42.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"E\013"
+	.string	"\366\324MC\020\213j:\020U\231\376F\317\200\b8\200\277C\301\230>\346]\224\"\365\351*\n\262%\033\317\333\232>\257\007H$\202\301\216#\303\251\252\252\352\304\002\251\222\354?X\344\244\202T\3430c2jd\357\224\0026"
+	.string	"9"
+	.string	"<"
+	.string	"[V|\321}s\371\t\356[w\t\356\233I\333\302\313\324\336U"
+	.string	"\300\353\334]\257&8yJ\372w]b:\215N#\230\33555\235\b\334\365\266)\2661\366A\001\366[\177\375\352\247\035\206\354\304@a\356\016\230mX\3316a\201\355Ol\323\362,\362-\233\032\304\006(\231b\273[\361\245\373f\241\235\332wp\025\371\225\350\021\273\250\n\261\r\234\r\036\006:3\210\217"
+	.string	"kp\232\266)\305\016\035B\204%\341<k\265?\376\300f\267\273\027\377\025\002\362\220R \342\276e\b\240p@e\200Dgv9\242\025\201}mw\327\025\025\035\215\315Fh\374FN\306!\004\307L\347\033\305\215\304\032\213\007\374\306O\004?\336\350\321\361q8<\317\227\351x\232P\364,\025\006?\233\320\033A0\364&\345^\333\212\262\306@\246\341\002\251\226\374\203\002\022"
+	.ascii	"2\241M/0\\\300\200\202\3011\232\326\221\005\301#\365\372Sc\251"
+	.ascii	"\331\355\007\273\356\032e\f\363\002\201\301\025ij\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_altitudeEstimatorPredict.43.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"E\f"
+	.string	"f\326RA Q\224\016\f\301Ac\304N\241`\034n\017X\004J\215\324c\027=\247\260\34600\221\217\267\326\260#\001O 3\346\004\361?\321\216)0\234\031\004\346\343}\007\213\022\2312\371\332m\357\275wJ\001?"
+	.string	"A"
+	.string	">"
+	.string	"\364\263\236"
+	.string	"\375tg\323\370\207\332{\2402\250n\354\256\025G\274\273\214\260\363\003x\241\313jz\224\t>\3040M\274\221\244\254B\210\\u\310\301#A(\301\354\256a\311\363p\317\233\201\375\007\0013B\277\322\032\253\002 \273\035Fr\254\214\371\302\204\355O\354\217\022\013\340\367\025\335;\f\"\005\254\206\321\206\220\335\255\370R?\017\310C\373)\256\242{\n\364\001\273'\221\220\335\257b\005\365\323\337)\0014\206\240\013\033+\020\321\037\372\b\301c\006\t\342\260}\341->\027\237\005\207\241\356\356I\200\350\347\343UGp\002\006\212\224\b\216\330_\bF\021\366\345\356\256\343\311\376\307/y\307O\237\372\003\\\004\230\311p\0328\270.M\3252N\303\301\270m\003\300\227\245\223a\034\266e\036\213\2430\001\253 \301\352`\032\216ui\233e1\340\314\263\321,.\3134k\362\3551\2428\222\025J\"\2153\332\0266\370\222\003\030"
+	.ascii	"2\003\302\260\304\204\335\032\b\016{\033\325\002\bl\"D=\304j"
+	.ascii	"E\2122\201\235k\300\200\031\003\314\201\314\202\216(!n \006\270"
+	.ascii	"\"MM\021w\271\245=\f\205\365\203\203\003"
+	.text
+	.section	.gnu.lto_altitudeEstimatorCorrect.44.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\303\002\005\024"
+	.string	"F\345\201G\320\362h8P\002\231]"
+	.string	"@\262\300\f3m|\266\203\037L\310\001%\370\241\257\030`\003"
+	.string	"\347\217\361\334\325^\004\314\337\340\3519\030\206\214\325\f\262\372z\220\036\320k\363\35152.\356\250\315\317m\266\311\336[\312\224\002k"
+	.string	"a"
+	.string	"r"
+	.string	"\256\305\220\313\200\264\273%>\031\037\022"
+	.string	"\237\366Q<\305\355\275\231\277vw\240\220v}%N0>\264\357#\342\303\361"
+	.string	"\304\207\276\3319\356\353\331\007\235\270\260\342\307\356\3024\304o\017A\315\233O\363pe\203sp\304\271\202\bx5nX65\340\b\223\016\324\211\236\032lr\231)\224\335u\356l:\334\342mC\260\375\300\326\002\001\270\374\331\276\\*\217}pw\327\272c\177\350~\035\350we\272u\241_\344\275?$\323\254L\2572\255\312\364\230\351T\246\305L\207\231V0\375\221\024\217I\300\323\356\206_\220]\na\370|\350\366\213l\326Od\226\355!\013#\r\207"
+	.string	";\035#\035\273K\362\320\r,\344\263 }Wq;\220\217\300\013\206*\352_\332\322P?#\347IWB\325\245/M\027\272\237\234)\034\311GJ\262\243\351\350-\234L|X+\370\375\242jvq\006D\264\245/\272\203\233\234$]\217\\\376\362\205\017&\020\240*]\032\242\366\254B~\347Pi>b\307[R\345\361e\304k\204 \0345\031e\273v#\231\023\237\305J\314\270\273\0271#>\274\236\350\007H\334"
+	.string	"\322\013\264\031\215\026\013m+\351\302 \266\022c\223\331ZRV\264\231-\305Ef\253\305TV1y\231\311l\262\332\f\006f\233\300\"k\221"
+	.string	"{\221\245\270\300Th5\230\311"
+	.ascii	"\317`b4\230m6\243\301X>\334\301\325\035\243\3404\027\262\224"
+	.ascii	"F\250+e\375\260\\i\245\177\362\320Si\322\250\242\252T\233t<\331"
+	.ascii	"e\214z'\245^Jc\370\250\325\363\035\017QUS\2526t\274\234o74 \200"
+	.ascii	"\202\0319\354\001\322\241\261\023\303u/\211g\357\335\032\345"
+	.ascii	"+\223\237A<\214KT\314\214\222\225]b\035\303\240@\305\300\370"
+	.ascii	"\325\032\374C\354\356\243fy1\235\345U}\323SL\340\346\325\254"
+	.ascii	"\202\344wvX\234F\217mP`\362\201\206[L\210\255\203\356S\270\237"
+	.ascii	"m\242\t>\"\030\003\024F\202`\256\314\002#\212\342F\214\256H\203"
+	.ascii	")\203\233!]m\217\006\006\367"
+	.text
+	.section	.gnu.lto_positionUpdateVerticalAcceleration.47.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\226\002]\025"
+	.string	"vi\220H\300VQ:$_\364\006\230\001(\312\001\361\233\373\330A\351\016\334W\201G\212p\227n\266\003\221\352V|\253\307\252 S\025}hy\031\r@-\305~W\301\370\267\331uc\217G\235\276\375f\322\367\321\377\t!\204\310\235Rx"
+	.string	"o"
+	.string	"\204"
+	.string	".\372V6\303l\203\321\356\302\230\301x\320\237\366c\\\006\354A\030L\332-\201\304h\027\007\343\004\343A\227\263\204\007\277\007\b\017\032f+9\356g\237\023R\243\361dwIMq\330\303O'\314\027eH\266[\354\341\207\177\337\201\021@<\230n>\037\313\316D\222\353>5\334hSQ7\332\347\262\273\317}f\270\315\346\024ev\327\323v\353p\213\267\035\301v\215=\211\002\263g\343fSQ\330\377vw\255'lq\0325N\237\216\373U.t\227\302i\322\203\376Q\234\006\305\351O\234\3269=\303\351\257\210@v-\275\335\r=)K\004\324\261\342B\277}\337\306o\360|\310\340\356\210\3076\321\270\3166\271\347C\326\233\223\027\273k:h\367\330\246\203\3639\233l\013]\030c\034\004\330L\034\341\355.\202\203\236\031'.z\335\r"
+	.string	"\361\200\0214w7\246\327\tA\225\220C\3423\243\370SUPg\220\032\210\347~v\013|\252D\265\027\027^J\252\272`\304\220Z\214Q\213\304\031GPD\310\212N\013\261\204\304\332\rz\275\037>\273\262\227\251%\235D\264\026\263\331\363I\247>\367\017\210\311\321\314\210\216G\322\223\016hR\233r\035\225\244\277\361\317E\021\036\220\021\035\213\331q<\007\006_\205+\254\346m\253\360\340\025\334\035\301"
+	.string	"!\013\306\211Q\255\312\027\311j\255V\255\024\201\327\204IC\263\232\201\220J\331\214;\017T\253\322\301\213\245r\271xR'\247bX\255\362U\356\264r\310\027\316Mi\201\002\311*mVd\312\265C\306\264\270\225\243r\221\257V\313E\232p\262\353\211\334\307\032A\210\310t\026\002\230%U\321\017\375G)\273\315\207\256\306f\336\346Pc\377\211\3023\372\024\205\216\243\256s\352=t\306\335U\340\3578\017\225\257\342\240o\3122<\210\n* `\002\2311\355\001\305\026\213\362\001\377\307\230u\\b\366Z\332\274~pX\227\021\"\243]\356\030R$c\276Y\201\312\216"
+	.ascii	"\034\023M\270*\231Y\225\t\r&\3406$\3240\213\321\031j\332v\236"
+	.ascii	"\366.\343\264\026\026\232\"1\0336k\"\301\b\212\270\026\016G0"
+	.ascii	"\213\024\230\257\340@\013\206\335\327(\355\256\261]J\017"
+	.text
+	.section	.gnu.lto_calculateEstimatedVario.50.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\320\003]\033"
+	.string	"ft\263J\240\326Q:\304Y\370b\204\361\310{\241\267\n(\350\364||\2017eu\223\344\344$\005X'\376\312\333\267\326h\360>\244v4\333\013\226q\314^\013^\207W\340\027p\nj\266\210Bg\375\250\254~\362\177\333\204\020\"wJ\001\234"
+	.string	"\217"
+	.string	"\241"
+	.string	"\241\375\034M>\234\034\307\243\354\2279\374\206WI\017\027\265\326\027\007\373uq\332B\276\215C\371\365\244\263\361\301\252/i\304R\003'\035\335\025Q\250$%\254Z\353\200\213N@\267\251C\b\253\276\023 v\324\352T\300\006\350E\317i\177\306i\b\035\250s\253V\023U;j\255\005L\200^\264\tm\3731.C\310C\023\230\242hL\nAd\303I\255u\006{\314xq\376e\274\270(>\3649\344\037\3529M>j \211\022\261\373$\027\324Z=\177\"\214\356\275\355"
+	.ascii	"\266/\330!\202L\275\031\364\334\335\020J\211\365\215\355\334"
+	.ascii	"\227K\275K}J\347+9\3106\377\263\215\027\277$O*\353\2107\2036"
+	.ascii	"\26077\311~X\027\311\3664\316\315\235\356\032\232?\335\2627\375"
+	.ascii	"3\007\3761\327\264\f9\035C\247a\350\364\013\235v\241\323-\344"
+	.ascii	"4\214\234f!\247W\350\264\n\235N\241\323/:\355\242\323-r\232\266"
+	.ascii	"\246I:=\322i\221N\207tz\311\351IN?\247\265b\267\304\310\221\200"
+	.ascii	"`\255!\202O\252\225\310\203\305\235\376\247\217S\234\001\033"
+	.ascii	"\273\352\201\030aUm\005\301`\222\327\246\270\266\265\257}\311"
+	.ascii	"$\344C<\245\301R\226\032/\272\266uD\267\265\207Rb\221K\367DQ"
+	.ascii	",\341@&\320Z}\007\374\037\257\242\340+]t\005\232O\033/\222\373"
+	.ascii	"j\242\312\232\2612]\327\2151k\3272\314\377h\366P\247O\250\212"
+	.ascii	"\262\260>\354\3169$\330\306\254g\331\344%\344\246\032e\013\333"
+	.ascii	"G=\204\241\342G\013\024OLb\313C4\232zAb"
+	.string	"\\\331\376\252$\"n\270\343\276\0042\263\342\216GJ,\336\324\231\030\325Z-\300W+/g7\334\227\001\346\321\t\342\311\321n3\037\334\355\206\333\221\365\324 \374\334r\025zj\033\310\332\315\346\340\202\230\353a\200\003\242Y \275\243\343\203\263\345lA\270\237Y\216'\203\255\007\303\314\307F\273\315v\200\202f:4\306\375\324\200f9\034\016h\366\002\362\036~\221p\326\206\267=\263,\316By\250ueY\036\f\336\354\312>\207x\335Xs\263,QA\254d\266f\177E\024Ef\302\254\375 \302\370\237\314\002\210\252\262\362\355\3160[\344:~J^6ea\226\034R\226pY\225}\331\330U\313z\352\265N\227\235\271*\227z\255mY\031\224\222\211fU\002B\2501 \002\031\305\224T$\201H 3Z\230tp\242\251+\262\003\021\020\262\2422\311\260\277\001_\030@\232\022[4v?\313\356\n9+"
+	.string	"MS/\264/]\240>\327;\314\300Um!\340\224\375\220\361\r\232Iq \b\032I\323\032\022\310\332\220\272\303\003[ ,o:\274o\356t\005\017M0A\240\234:\221\177\342XY\321\347\237{\314\335|\263\312\262GJ/\273}5h},mv\t\270\307\32155\251'\210\201\356\332\021\005\313\231e\270"
+	.ascii	"\374\377\201\221\244/\333\244\001"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.52.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\207\024]a"
+	.string	"J\240\344#M \320\322\032\003\f&\371?\343\345\331V}\241\001\020\322\243S\356l\304:\310\330\026\302\020\222\203c\342\2700\362\377k\234\013\350<\255/\036)\002\241(f-w3\204-\271\201\260\034f!\2034\256"
+	.ascii	"2\242+\270-;\266&\222\244\224R'\002\370\0010\002\316nt\356\251"
+	.ascii	"\017g\240b\321*\2777u\275\252\201.\336\312\345IO\273\255t_\351"
+	.ascii	"n\353~\353\206\353\216\353\226\353\346\322E\327q\242\033\231"
+	.ascii	"\233\271\275t\230\256\333\240\351\230\206\327\231\026\323s\314"
+	.ascii	"T\355\205\277K\340\031\025\363\006\314\305/\r\206\271\310"
+	.string	"V\355\205\r\030\353\203R\351\225\331\212\271\330\3537\f\275\326l\355\326X:\206\246\366\226\356\302E.=\206Y_C-A\340\374\\w:&7w\3020\016\b\223\213\307\345\212\322A\371\352,\255\245m8\037CWn\370F\357\374zk\330+\217w\017\373\306T'Nd\323\016\332\336v\\1\"\223\243r\006UB\200\266\255\374`fM]\257\022h~\323\006\246@\230\\S\027\214\2004<*J\2752\001\303v\346\246\322jmK=`\242\353\"\231\223s\335)\023/\r{e\266\017\333k\260{\330^\271e\256\241\247K\334f\223\276lo\\\327m\276\222n\273\211iI)\211\304\b\021!@|\360\320\001\211yd\264,\"\032\022\n\002\372\361\341\320\243L\362\354 \217\306\242\016q(d\327\340{\313\235\325Mw\315tg\347Ku\255TG\347IsMbN\214\217\b\323\"\302P=\204P\005\210\270\376"
+	.ascii	"\027\203{\200\233\323\342\035\2624R\026,\316\314\362\346GFq\313"
+	.ascii	"\240\211 o\304\272\314\227Z\320\b\347\235\241\313\276\244^\024"
+	.ascii	"G\305\211\206\322\204\202I\320\272\022\272\314\027Z\320\207\214"
+	.ascii	"\n}]\3665\305\203\322\316\034\250J\377t\331\027\231\373<i\301"
+	.ascii	"9\3644q\245\023\026<\351\244y\260\246\204\241\002\210D\310\222"
+	.ascii	"\336a2\346H&P?\nU \021r\244\215b]\0243\342:e_E\234X\346\353\b"
+	.ascii	"\021\037\"!\021\022\326B\035\260\022\232-\202\275A\246\353\272"
+	.ascii	"\335\245}\0040\247\257\255\025\326\301`\222\337\0267H0\256\240"
+	.ascii	"\217\027\331\263\b\026\304?x\224d\f\020\t\266\025d\322\341\275"
+	.ascii	"\335\245\221\312\276\356\334\205*\\\327e\177\202\tin6\363;\300"
+	.ascii	"\314b\230\223\022\004gP5\251\326\233\006\364\241\244e\302\204"
+	.ascii	"\355\365\201_\363\330\320\232\264\033 F\314m\013\375\327>)Z\342"
+	.ascii	"\272\256\023\233n\323\272\300\355\244Wn\243\264R\244\260\275"
+	.ascii	"\306\370u\353\n\232\324\200\267*kt\226\354\213\357.Mt\343\275"
+	.ascii	"d\331\177\361\354oX\r\255\2465k\321\332\2646\215\355\225\375"
+	.string	"\013N\bl9_\325\031\210\037ed\024\360\245\n\273\177\260l\224\357\245\006[\257Q|W\321\314\233\227*\204\361\302\350\334K\r*u\211\357Z\231\353\333\030\3437Dr\346\266\312\n\357'\214\007\322b\203\320\310\231]\274\360~2R\213\035\211h\234\313~T\257\377\253\210\234\231\201\006\274\237\377;]tx[\237\305\\\264\210e\255\037\355\226\013t\301-\370Q\376\301\372g\260\206&\310\203-\203e\216`\002\357\247\277\r\273)\240\037\327gq\213\317[\255\364\241\2115\234\024\252n\377\3215%\335\203u\361AC\314\326\354\270\034\016\367\267x\027\357f\234P\266zL\343y\300\355\204\247\236\274\237Ol\257\375sC\240@\325\302\264\274\312<\335\362\2172\367W\253\325*\177\022\346w\276at\2062:c\200t\246Q\301\214\247\2443\0042\036\210\001\343\350\254\300\321\371Esiv\321\322\356\026H\347\002\332J\363"
+	.ascii	"}\2459E\2675\243\350\267f\247~k\026\240\341\232Ot\\\263\211\226"
+	.ascii	"k.\241t\016@\351\f\200\322\271\251tnB:3%\235\227\216\316JJ\347"
+	.ascii	"$\2443\211\036\347\021Ig\021H\347\020=\316 \222\316\037\222\316"
+	.ascii	"\036\222\316\035\222\316HIg\346;\037)\235\215\216\316\313\243"
+	.ascii	"s\221\322\231(\351<\224t\026J:\007%\235\201\222\316?Ig\237\243"
+	.ascii	"3\207\236"
+	.string	"6\367\274\263\022\351\234D:\363\274\363\316;#\217\316G\036g#\217s\021\351\254\263\343LD:\013\217\316\354;\257\357\374\037A\312\004\2661Z\276Qo\215\017\205\224:6\313^~\257Y\242d\371'\230\260\251\245!+:\202\346=\343\200\241#:\021\025n\355\241\265\271s}CF\272\350\215\322+p\342\250\021\362\242\357\032\220\244P\364M>\351\031iX^P\212?\202>\001\"z\3567>\346\003\204\226\311\263=\327\020\340.\376\351\231[\021Z/\357'\321/\275H\300\013\362Y<\364\025\374\233q\336\t\375\317\017=\313\346\204\006=\320\013\225m1\265]\017z\241\034'\224\247\007z\341\027\247\367\371\237og\331\214\367\371.\222v\303\017\t,\207w\26250/\322\2220t].'\3660'\322\232pBK\204\b\333+\207\337q\244\rTM\352\363Q\366d\3535\253\004\372R\225{M^*O\367\365"
+	.ascii	"\312\024\217\342\225\277\256\335\255\355\271\205%\337\304\317"
+	.ascii	"\030\222\374_\253\343\371\022\377\364\355\204R\002\317/\217\340"
+	.ascii	"A\3258\350\t\001\363\246M\223\233'\177=;\317\002\315\327\316"
+	.ascii	"/\361\331\365\215I\243\374(\003\246\311b\223\307\307\345p:ML"
+	.ascii	"\0250I\246A\252f\217\347\243}=\2020\312\227\2636&B\220j\215\344"
+	.ascii	"y\001,\361\354 \370\023\210\006\255\021#l\257+\033/haZ;\310\367"
+	.ascii	"\025\334\351\357\217#\355\330\030\333+\362a\210!?\312\303\326"
+	.ascii	"\353\342\033\302K5v_\263Q4/\225\330z\235\342\273X3g\334\326q"
+	.ascii	"+\362R\215\020\274\016\273\021\210\356\266\323w\t\243w/u\350"
+	.ascii	"\\]t{\276T\343\003o\201\036\221\333\007{\342\273\206J\255\363"
+	.ascii	"~\360R\2151^\030\245{\251D\2456\361]6\264\002\3032\335K\366\370"
+	.ascii	"\n\270Vk\226B\233v\374\242@\350\221\343G\271\350\346\365R\213"
+	.ascii	"2\0220s\346\245\3520\265\211\300\351\035P\255\316\341\352bfj"
+	.ascii	"\353E!2\r\n\360\020|\333\365\013?4\031\234m\266\214\306\227\361"
+	.ascii	"\376\367\316)>o\3517Fr\271\256\226\007\343\267sN\347\213\377"
+	.ascii	"\177N?\342\353|\213\235U\3379\3056\312\022\277J\205\016l\243"
+	.ascii	"\3038\304W\022\013\234\243\311*\307U\215\251!\316\321\0245%u"
+	.ascii	"\325\334A55E\005%dc\315@\210\203\265\021\025\305#\202\253\252"
+	.ascii	"(\n\254x\3400^Y\365\250\222\300\212\007\216\341\225\216\025T"
+	.ascii	"U5\020(^\351Xa\305\343E\024\0075r\350\330\210\302\261\243F\016"
+	.ascii	"\026WQV7n\304\250\3413\305\"\312F\217+\251+\035+lDU\365\260\252"
+	.ascii	"\0215\245\264\232 jJJ\202\253\035QUU=\240\216\f\325\264\203J"
+	.ascii	"\352J\312\212\212G\363*\007\016)\0357\232;\244jL5\241\252\254"
+	.ascii	"\232MK\246\342\021U\325\274\242\242\252j\026\247Z\255B\353\267"
+	.ascii	"\202M\001\274\227!3&\200w\342\013c\312[\002\340\351\334\256\316"
+	.ascii	"\001PJKj2\271\2300M\022\276\245\225^(\211\031\226\021M\317\314"
+	.ascii	"K\016\306G\363\214\353\272)\330\275\370\027\254<,3X{X{,\3237"
+	.ascii	"=K\303;g\351\231^\310\346\274\323\242:\375\322\007\3759\313\266"
+	.ascii	"\276t\271\265\211\370(#\2735c\225\376\206\\k\306\327\246)\375"
+	.ascii	"R\022(o!\222"
+	.string	"\342\204\237$bM\316\332\236\333\034,\327-\340\205\317\356t\323\325j\363\027\226\304\027\360\r\246\203S\232\204\031sC[\233\021O\342\377O\304\2104\216\345M\304\027\267\344"
+	.string	"JC\264\201\370\020\037\214a\001\377\240\006\313\006\266\237 \236\271\306T+\037\236\201\261\031\240jR\020=S lZ#X\306\336@\325\302\326\350\005.\371\360QfE\030k\254?\226\206\217\334\034\030\330\344\331a\3604>\350\357\235\003\365-\036\203\357\272\016J1\343'F\2066W\363"
+	.ascii	"\353\206'\250o\342\013\363p\343\035\315\032\232\236K\3731\345"
+	.ascii	"\306\367\\\273\232\327\031\250\232\224\205w\360\342g\355;t]\255"
+	.ascii	"~"
+	.string	"\2321V\034,9L\347gq\317{\370v\032Q\203\302\034\322wp\361H_B\332\201\371\314XU\217\302\324\243%e\375\\\323\363\314\357\027\244{N\277\020H\230\234!\035\275\223e9\224\037N\346O\332\255 \355\373\262\275\036=\325\330\022\250\232\024\356\n\027?\346G\031\310\020\243\247\367\241\367S\301\357\274p/uh\306\367\f\360M\006\016\fl\362\210\200\020%sd\344\304\350\227^fx\001\201\235\250\221,#\025C\206dDDD\222$Ica\005\204 &\235\264\016\022\200\264-F\244\016\322l\232\375\337\r\245\206iX\316 e\314\320\357\232Sc\271\022D\264\027\363V\033\212\256L\202\321\206\313ODz\2021z\330\201\352\344\322'z\357\243\320\344\232\272f\376\336\326\002Mb\300`\177-\215\250\035\245sz\247w\375\204\264\001~\3724\230\234\251\313k\006ox\\,\001]\320\225%\304\311\270\377\341"
+	.string	"\246J\351\261\232D6\344#|P\257\322\343\037\356\354T\370\030Mf\260Z'\f}>\260\r\313uG\006\270\022\224HJ%m\270\327\350\346\233W\371fW\026Q\205^\2322\232c"
+	.string	"]\331GR\b5\227Idn\341Y1\264IOx\035|\213\"\020\200\273\3331}\337\237\322\316\022n\332(Ga\313u\340/\244\027\033\214\320-\314\031\333\271\202\315\030p\346\252\330\220\tMRi5\211\320\3114\362\306\254P\374\013\305\254\"\330\2255\246\272\206\365q\222\314\013'\3169\341\232f\266\252\251*\335\021\223\3337.<\311\320lH\310:\205_\\\232Tqp\333\267?\341U\306\356Q\f\355N\206\231a\224Pn\222\r:\371\020B\203\020y"
+	.string	"y\215\326+\"\244\266G\316\221\322b\037\365a\3725\221(y6\225\031\277w\236\354:H\247\205\325(\240\343}\025\2678\277\312\3133\033\007\357\"\310y\370:e\033\252w\\\301\265\277\2347\220t\245r\365\257-\337y\243\323sP`\224\222\0060\033\373\272\016\371\205!:/\026.`\267\324\337\035\320\262\r\201\2050\304^\243\200ww?@/v\222K\375!\212\b\236\233\327\247{\330\262\210\002\376\304 \346\024\021\3416M<4f\243f\347\377\366\243h\n\t\022hj\356\337\021\312t\310\037\023sv\017?\260\004\3105\t\022\204\220\020[l\177\006,\216\006\256\021\3044\300!\216\210K*\207"
+	.ascii	"\021e\027\004\347\241\216\236\223\312\350\020\365x\367W\362\024"
+	.ascii	"'d\371\272\367P\372\324\b\341\005\021\247\230\177\t\034\301<"
+	.ascii	"\257\321\240\bZr\002\317\035\334D\016\210D\324\220\253DF\213"
+	.ascii	"\251\337u%\221np\003\247\366\241P\314\341kS\234\221\202mP\320"
+	.ascii	"D\264\346\301h\212\342f\236\333\232&h6\316\265\316II\354\002"
+	.ascii	"\367\243\351\231\260\0240\361\340\022\n\036\030NP\213\321\177"
+	.ascii	"\032\004\324Z\342\"z\230\017\036\237\231\030d\017\336\207\243"
+	.ascii	"Y\216cr\326D\361\022\245\360\240tbM?I\220\240\350(\220D\206\334"
+	.ascii	"N\201a\330a\024\303\251=+?\353dh\310\rGG!\\\252\027\353 M\372"
+	.ascii	"\361\266\252M\2201\304\005\364\3522\354\376<y\234\357f\212Nq"
+	.ascii	"\260 \3203\245\336{?\036\324\221\365\225Bm\350\024\246i>\353"
+	.ascii	"+\205\332\241\016\274\001}Sl\2260U\207\256  \242v\260?\354u\004"
+	.ascii	"`e\345\037\256\242^R<\350\331\360R\354H\235@\312\327\355\350"
+	.ascii	"\260E\204\335\223\305b`N\354<\354\304S\003"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.53.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 \350\205\006"
+	.string	"\"\214-4Pm\222\016\244D\214*\247\352\212u\003\246@Q\334Z\305\005\377\226\354\252\375\273\035\346\332\236\306y6\213\343f\032)\022q/\265L\220\b\216\030\330,\3312\005g0\232GY\024\347m\234\005\361@E88\r\305 \3412\025\307a\b~\233\206\312Y\357U\356\222e\333\b[\001\250Q|EJ\272\256\307\023\035,\326\351v"
+	.string	":a\023\300"
+	.string	"a\351\263\0176\215\257%\333\350\307\261\r\220N\026P2C\245\2254\231J>~\317_FH\360|5\343\b\265#\243bD%3sm\243W\361\272\r\251\005\204$\005\023}\212\001\n\2319b\242\213\336\372\033\374\007\277E\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getEstimatedAltitudeCm.54.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 \366\315\006"
+	.string	"\002\315/3Po\322\001 ;\215=j\023-a\311\340[\3133,\326CT\"\024\266\206Z\367G\222\350%\330\206z\242\032[nL\365Ko\263$\225\033\264\367\2262\245\326d6\021N\260\0239orh\200\017\fo\003\025 \236F\352\274L\201#gAzS\214\322\273\\{\025\245bB*a\177\344\027\345w8\302\223\257\336|\217{K\r\260\b\345\310\276@\251\030\366\331\252\310v:U\340D%\001e\227b\324\262)\315\304\303\366\307\276\370 \017\371\230b\227\206\34568&HXv\367aN\340\336\330\007\334\233f\234zR\376E\316>JV*\013\364\004@\330]geU\334z\333\006\266\017l_\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.55.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 \366\315\006"
+	.string	"B\21504Po\322\001#;\323\216\251)O\367\001X\335\002\002\265\205\365L\035\212[\263\306y'I\364\022lC=QU4c\202\375\347Z,\030\335\017vo\"eJ\001\326d6\360U\257\0039\256zpx\020\rn\363\026\"\234\206\352\270L\201!\207\201r\025\204\224\303\\{\035\245\032\204t\302\376\310\257\350{X\302\223\267\316|O;K\005\300\be\311\276@\251\032\366\247\335]\353\310v:U\240EE\301d\267\242\304\262)\354\344\303\366\307\306\370 \017\3718\346\305a\321:H\024$+\273\353\002N\320\316\362\003\355L7\036\237\321\277\310'R\t\212%\002=/\t\273\353\264D\027\267\336\366\201m\004\333\031\001\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_altitudeEstimatorPredict.part.0.75.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`p\002M\022"
+	.string	"\026!rF\360\320&\035\330\274\362\030<stY\201[\274z2f\37603\240\270\217~s\370h$=\374\022\274v4\252\372\210\345\n~\034\rj\017\334\233,:\374j]\026b\232=\221\246\316\2708EkF,\331$\355\224\002Y"
+	.string	"_"
+	.string	"\\"
+	.ascii	"\020\372k9\347E\344\313\017\262B\330\372\205q\\\316yqH\346\214"
+	.ascii	"\215\240\314/\201cK8\307~&\2609r\036\2609\266n\321\266%\253\253"
+	.ascii	"\275\341\257&\255S\243agGfv\216/a\227\0175W\r\343\227<\2000\024"
+	.ascii	"`m\204\222\231\345B\270\321m\025\264u\320\302\033\001\345\334"
+	.ascii	"c\217\016\273\0356\372\307\325\274c\377\260\320\237\355\220\020"
+	.ascii	"\023\027\231\035\212z\344\210(\224\302?n-\243U\003\325\324\326"
+	.ascii	"?>.\035\311\340\343\302\301\310\n\304\220@\201#3I\034\313\200"
+	.ascii	"s4\365\360\360\234Xp\350\235\326\2276\262\036\206u\\\216\321"
+	.ascii	"\231\026 7\3008\004e\346\t\3478\242\005:b23W\313|!\340N\272c"
+	.ascii	"7\243k\347.B\024\273\201y\236\261\275\304\004\316\253\202\205"
+	.ascii	"\342_c\210\007\374\257\035\002\305T\300`Q\333\225\203:\3432\363"
+	.ascii	"\244\236a\260P\3338\326/\233#\274\201L\262b\210\005\316\013\026"
+	.ascii	"\301\323\364\232\265\374LA\016\373qX\323aK\207%\035\006(\324"
+	.ascii	"\351,\b0%e\245\301\003\024\352\304\251<\326i%\305Z\251\220\212"
+	.ascii	"2a\361R\254\324\312k\351X\023$\244(D\350XR\247\225\016\245Zu"
+	.ascii	"&\007\352\265\250\250:\226\347\251:h\224\327a\275\265\237\246"
+	.ascii	"-\310ip\337\016\362\013\"x>>\324\031\200\032\307\3440=\376\343"
+	.ascii	"'\212\311\224>\272\351\006\200H\337^\372\0269 \200\202\2312\363"
+	.ascii	"\276\005\361\271\246\214\240\234\340\n\202M\017\230\354\222\021"
+	.ascii	"\323,\r\236\275\270\314\270\367\026'\242W\r\201\0048\337\377"
+	.ascii	"0\357v\210g\2210\344\263\334\266\200\020\255a\266p\275\tg\300"
+	.ascii	")\"\013\025\260\374\237f>\213u\003{=&[\216X\304\341\316\030\225"
+	.ascii	"\220\267c\201\335>\243\267\253\024\302\f\314@\204\342x]ahH\366"
+	.ascii	"\016m-X\223\267\315\002\264\007n\324D\277\313\214\001"
+	.text
+	.section	.gnu.lto_altitudeEstimatorCorrect.part.0.77.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\251\002=\023"
+	.string	"\206bxH\340\3604\035\352\025\366c?,\337U\377\374H\264\370\341e\310v\214\2121\022\357\246\274\256\370v,\204w\321\007c\325c\320$\236\266\315xiF\226 Cw\302\027\264\242|`> \365\250Xz\301\365\262!\303v\333;\245^"
+	.string	"f"
+	.string	"b"
+	.string	"\367q90\256\r\314s\332\3579\213\327}\\\036\262\213\223\243\334\035\031\274z\301\366\352\361\005R\257\333\007\244^\355\307l\2130\277l\035\037u\366?\261\017@\263\335\355^i\212\277N\247\366\362\247L\315\313\351e\327V\220\210\222\251\021\361)r\355\243dw\275\215\270\353m;\260]\301\246\004\002N6b\210&lC>\371\322\346\334\362#\323\232\032<\273\313\265\330\334\353\364\207D\337\3502sB\342\213\304)a=\004\225t\022\231\024\331\351\204\343)\006\025a{\275\2209\030\033\266\027\230\001\031\024EP\273\253\340\325\0176\323y q\334\035\230\251\213\377\274\376\302\244&`A\304\204(w\227d{Uis~\024\003\037-d\263\331\351Kkx\223\311"
+	.string	":\273K\342\317\340\340\362w\\R\257/?c37nzJ\300\314\250IsL5m)\216\375\361\237\007\372\277\2054\340\261K\023\305cMT$\0257\372\227\376\244\277\350\232}\037\351G\276\2143\231[RR2\251\002\331ej\242\260\275&\211Vu\210a\362k\2633+\223i\301d\206(\023\374@\220U[\020X(-\241\027\252\254"
+	.ascii	"\200_\270jy\241\213\005\342\223\221\225\317\013=\327\307\322"
+	.ascii	"\205\0310x*\027\272\025o\325\352N@W7\202\300\037\013\013\354"
+	.ascii	"\302\357\003;\356%04\306\364\332\356.\2459\262\177&\250\007\315"
+	.ascii	"\215\320\322\023\376SR/\355\375)e\266\243u\247#\036\223\266g"
+	.ascii	"\202\227\376N#: \220\002\021\253\353\006\004\002dnM\021\334I"
+	.ascii	"T\220\016\360I[v\246\355\202\360M\\\023mc|\013 \217\217\360;"
+	.ascii	"\21442\310\262d\342\337\036\031Ov\353,\314\025\216'\230\235\022"
+	.ascii	"\"&\t\033\302B:\f\342f\3367<K&\034y\207\204\206\022\326\006\230"
+	.ascii	"07\0072\317ev\322h\274\201\375\037\030\254\227\b\345\021\326"
+	.ascii	"0#\026\212\355\321\204A$i\037Z.0\235\267/\013 \036\362\024Z\227"
+	.ascii	"^\373\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`0\002\235\r"
+	.string	"\364\023,\003"
+	.string	""
+	.string	""
+	.string	"\002\313"
+	.string	"\177\031\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \315"
+	.string	"\177\032*\177\033\272\200\202\002+\177\034,\177\035/\177\036\005.\037\200\204\001"
+	.string	""
+	.string	"\003\005-\021\0022\177 \0058!\005<\"\005:#\0024\177$\377\377\377\377\003\005=%\005\302"
+	.string	"&\303"
+	.string	"'\304"
+	.string	"(\305"
+	.string	")3*\306"
+	.string	"+\307"
+	.string	",#-\201"
+	.string	"\0051.\200\003\005)/\310"
+	.string	"0\311"
+	.string	"1\0025\1772\0026\17737\1774\005(5\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005&6gistry"
+	.string	""
+	.string	"\005$7\0019\1778\037"
+	.string	""
+	.string	"\200\200\200\001;\1779>\177:\301"
+	.string	"\177;\300"
+	.string	"\177<?\177=\377\003\003"
+	.string	"\240\341\365\321\002\001b\003\004\001\340\236\212\256\001\001b\003\005"
+	.string	"\320\360\372\250\001\001\242\007\003\b\344\006\003\b!\204\016\304\016\003\f\"\307\377\241\372\001\001\244\001\003\f%\201\234\313\322"
+	.string	"\001\344\001\003\f$\200\316\245)\001\244\006\003\f#\304\006\007\003\f\b\202\037\003\f\b\364\374\342)\001\342c\003\f\004\341\245\211\231\001\001\302j\003\f!\270\251\242&\001\344no"
+	.string	"3 \260\002\241\253\361\351\3650\2274]\334\336^\246\3064\031:\373\313\336w\300\214\376\004\354R\365\004\273$p8"
+	.ascii	"q\315R\206-\214\303\"H !\206/\333\206\264\333\374r\017\021dc"
+	.ascii	"Z\214\223\3044\261Cy\264y0\023\333Fd\2147j\032!\201\307\304\f"
+	.ascii	"\266\2213>\003\3070\310\f\243\003%\fK\323\243o,~\330X\004w\214"
+	.ascii	"\212\344lu\002"
+	.text
+	.section	.gnu.lto_.refs.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375 \360}\005"
+	.string	"\002\315&+\200M\2261 B\207|\321\333\302\020\310\300\f\314\300\f\314\200\332v)\204\220+"
+	.string	""
+	.string	"\b\221\275\t\373\331\215\260?!{C\376\226)\025 \006\310\202\026"
+	.ascii	"\356\232\260\363D\330U\017\366\212\312\365\024\024\023\203]R"
+	.ascii	"p\222\021\221\020\020\317\376\210\356\321!AsH{C\272\306\2653"
+	.ascii	"\254c\\{amqm\2055E\347\t\316\022\325FTCT\373\320\331\017g\035"
+	.ascii	"\252\033\b\356Ps\006\256\250)\201-\233\335\246\346\3233-5\255"
+	.ascii	"\t\030\223\331eb.7\022t\222\216\242]\364b\371I\b\004\0012\013"
+	.ascii	"\\\024\257\212\001i\271\300KdJ\001"
+	.text
+	.section	.gnu.lto_.decls.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"(\265/\375`\346$\245\255"
+	.ascii	"\252\032=>[0JAI\351\252\017: W}\316\017\315\354,2\004\200\b\202"
+	.ascii	"M\036\375\365R\216\340\241V\375z{<`x\2052\273\357\2777\374\277"
+	.ascii	"\fu\326\334\337\3154\223\333\352\367c\352\360\036.\322\266m\322"
+	.ascii	"\224'\212\266\025\b.\375#\207\345\266}:~\003$\351\370=a[cdo\231"
+	.ascii	"\002C\003\334\003\365\003\277,`\233d\225\032z4\253\342\275\345"
+	.ascii	"3Cs\3167}\225\226\274\262\351\357\n\370\004^\037m\367{\205\177"
+	.ascii	"k\340\337\030\370\227\t?z\223\360o\306\177\327q\270y\302h\242"
+	.ascii	"Q&\314\022&\264\037O\326\244D\261d\3517(Yqjd\372K\303\3201\264"
+	.ascii	"\230\036\323t=\327`\032\332aZ\356\355\245\205\334>s^\302]YS\323"
+	.ascii	"\322\\\236d\215\350\322o\276\233\263\f\262,*U\372\255\333\232"
+	.ascii	"\013\330\212\022\315\371\331azJ\267u\033\016\007t\261E7\b\323"
+	.ascii	"\321~\353\300\t\024\363\303\207\017;\037h\302\330\200r4AZc\307"
+	.ascii	"\360m\021|\253\205\267\2440\242\324\330a\323\333+|+\205o\231"
+	.ascii	"\360\216\030\374\326\202yZg\327V\372\205\206rh\267\233\364\312"
+	.ascii	"]6e\202\224\021\363\002~s\330u]s\330\275\317p\210"
+	.string	"\206\342\216\322l\r\365\320R\336PZ\3553\312g~\346\374\274\261:\310(1\302\205\337\036v\267\256\256=\354\336X\030\247uv\266\354\355\304\003^\236\205u\245\221\335\314a\275h\302c\023\203\333\021\020\2640\036W\023\253/\233ruW\237]%&g\376\312\371\231c\237\210\234I\331\324\205\235+E\t\324\223M\337Q\370\335\365<\231\257\227\263\023\261\254\021^'\363-\237Y\005\022`Ia\306\332\254\227tYC\233\254\217\274\221t\222\247\317\234\305r\316o!\"6h\262\376\3520_\362\231[\210X\222\024\206.\347\347\233\310\377\363\367\220&\322d]\344d\027\250\310\331I\224\004S\312$9\243\3139\177\370\260\363\341C\006\032at\034eH;\3146X\213\275\303Z\311El\360\232e\356\312\371\331ai\316\312n\f|\335\030\314\240\255\2404\262K\337\001\374\037\356\334:;\034\t\340\267\221\227\360\312\033\274"
+	.ascii	"\370\026\340\373\360-\356\320:\273\264\255uv\177\266\316\016"
+	.ascii	"\267\206]\004j~\213B\331\001\006\220\376\227\303\305\306\204"
+	.ascii	"\220\001K\201\325\371;I\301\177)v\202\277}\177\003\340o\017X"
+	.ascii	"\r\377\335\202\374\315\264\022\374\275\305\346\374\335dq\376"
+	.ascii	"\276bovH\270\300\372xn\201\337\232\3756\203\355\375\037c\361"
+	.ascii	"\337j\226\367\333\335\177\r\3747\200\235y\005\277\375Q\367\277"
+	.ascii	"\004\017\177\227\271\004\277\275\352\021\3004\f\267\371m\323"
+	.ascii	"\337\036\314}\200\364\177\311\313\376\213\375'{\357\267T\177"
+	.ascii	"c\3607\216\377\366\277A\177\213\375m\3667\331\337K\376.\373\233"
+	.ascii	"\211\227\277\267\376\016\373\033L\356\377\315\177u\374\335\345"
+	.ascii	"o.\177g\371;\356o\267\277\327\376N\373\033\355\357\253\277_\374"
+	.ascii	"\355\3647\213\277W\374\255\342\357\244\277\221\376V\376-\202"
+	.ascii	"\277C\360\367\t\177\237\370{\375\373\3707\361\357\341\337D\177"
+	.ascii	"\013\375\315\201\2777\360\267\006\376\306\300\337%\374\035\302"
+	.ascii	"\337\037\374m\201\277#\3607\320\337\007\370\233\347o\022\177"
+	.ascii	"o\360\337\205\277G\374\335\373[\304\337!\376\356\371_\201\377"
+	.ascii	"`\177\177\370;\203\2779\374}\301\3772\377\311\374O\373\037\364"
+	.ascii	"\277\311\177\264\377L\376\237\375\247\300\377\006\374W\373\357"
+	.ascii	"\253\253\253\253\373S\346\317+\341\337 \027n\026\016\347\235"
+	.ascii	"\26467\036t5L$\254\035o\267p]h\321\030\264~h9\350z\340\333)m"
+	.ascii	"\253X9Y\232\2772\222\027\317Yv\343A\207\205\317\273\302'\033"
+	.ascii	"@G\001\243\342J\333\033j\333l\013\326+'\327\270&\210\235\027"
+	.ascii	"\257.c6=\357\t\037D\333(k\226\315.\341$\023\207!\305\210ff\006"
+	.ascii	"q^\n\374\035\035v\342\304\252u3'\273\020\300,\352\306\203\316"
+	.ascii	"\b\023\223\017(\267j\366j\0034n<\261K<0lgT\326\307\216\255\305"
+	.ascii	"\2300mM\336P\333\304j5\023\203Y\251E3\363\t\342;%ff\226\t\316"
+	.ascii	"\nh\273:t\330h:\273e\342c\202\246\202\016\233Z\027\254\326\314"
+	.ascii	"\230\323\231\021\033XL\314\222\215\310n<\200\330d\016\250\265"
+	.ascii	"\261[\262%;\346\021\233\344\210\005\273Ur\013\266\203:q\201\316"
+	.ascii	"\246\366\313>\361\227'(\023\311\221X/\234\3149\211\223\217\252"
+	.ascii	"pe\331`\241r\345\b\030\374\2314\274e\215lY\257]\316\375t\266"
+	.ascii	"`\346&\223\347\026\210\rr\313u.\353\325\231\231s\223\001FpDs"
+	.ascii	"\263\311\003L\343\201\245\310\255\327\267\324\\\200}\210Y\221"
+	.ascii	"aS+\304>}aMbxz\022Y\201eK\030\027\256\030\nQBl\n\265C\372\210"
+	.ascii	"m\312\320r\303\246\266\353f\254\b\234\016\233\376\313\311\232"
+	.ascii	"\205\261 `6\375\314\020\374\031\031\370\377{\227\225\314\234"
+	.ascii	"\363\323\31433\217j\3363\335<\277M\337\316 \337\337\002\f<s\222"
+	.ascii	"\311\334\034\356A\246\214z\207\374\231\266\234\227UI\007T9-\253"
+	.ascii	"\240\224\240U9\271\334\221\314a\346\252\244\0224\347\234\274"
+	.ascii	"\\&Ap\346\034%hv\312HT\234:?\253\222y\351\3149y\231\225\035\224"
+	.ascii	"\226UNJP\245S\216\022\264\312)C\2532N^*\231*\226\231\231\223"
+	.ascii	"\241U]2\324\351\204\243\004u:)A\253b4\031\2458)'\2629+\252vR"
+	.ascii	"Zf\026MRJ&N\233\322\323\231\341r\356\257\024\231\231A\316RN&"
+	.ascii	"\234\022\252\313\216\332X\034\211)\235\275\241\351\310\312\231"
+	.ascii	"\227mJ>\2349\3738\"\312M\032$\237m\371\252\333\2224\2442S\212"
+	.ascii	"\234-h\3129\331\271-\347\234\3149\363\230R\317\234S\300Q\312"
+	.ascii	"jj\312\271\271\323\224\245\222f)r\266_qeNJP+\347\217\031\022"
+	.ascii	"hVNz&;+\303U114Y$3y\301YN.\344l\372|\322\224\311P\362\302\246"
+	.ascii	"\226\005\313["
+	.string	"\262\026\005{\333\321s\3632\365\305\343\r\265<\372lF)+{\204\340r\272\361\240\313L&\210\247?\262r\215\022\306\330\224\035\330\252`Wh(\217\335\361\204N\320\374\301\242\006~\363\354nxt\3448\321l\016\261\351m\016{\325\316\\\201\317\305\021 )\330\324\332\2607\032\272\301\342\220\303q\344d\323\247SX\0049\367\206]\327\325\365\206\235\245\361s[C\303\216\331|\346\257\005\350\240\261e\323{k5c\347$\206-:;\303Rm%\205\251j\250\235a\235\375\314\271k\307\206\255lG4M\2372\341\247J\374[\031\033x?\314\250l\330)\033\325\373\342\326\214\263\351G\330(\213d]\334\"\314\bT\021\213\346\234S\260P6\206mZ\251\206\332(\373\342\026\005\013\343\251\232\215\262\271\337\3563\213\227\304\312I\324*\217\306\226\335\346S\342\344\345\321\222Fb\243l\262\333\356\263\f'\031!\213\356\200"
+	.ascii	"\243G\217\232\264\235\255\263\233\340F\237v\372*\f\f\215\nna"
+	.ascii	"YXfC\255\223eJG\254\030\322\325\204\223\227V_YD\254\223Ma\227"
+	.ascii	"\234xVDdl\325\234u\311M\341\3647\t\376\r\202\003\312,[\262\021"
+	.ascii	"\353\345\252F\f\334\026+6\355\322\345\262\330q\336\270:\236\325"
+	.ascii	"\230(GS\266\374[.\227\035\234\205\030a\212\"\3450b\203\313\f"
+	.ascii	"\025\037;\300\216d\311r\235vV+\240\230x)\326\304"
+	.ascii	"\211\005\007w\343\332+\267\230\300,\327\311\335-\025nT\367\312"
+	.ascii	"o\334\227#mCln\260\375Za\273n\375\245\237\271\351L\312\025\200"
+	.ascii	"\352\311\033\033]V\222\342\031\262A\265v_\370u\373Z\335\221\262"
+	.ascii	"\252K\345\267\312\337\343\275\275\240\346\305\005\337\266\337"
+	.ascii	")Q.\260\370\210\223\362\367jp\254\261\311Y\301\257\211\202\377"
+	.ascii	"\344\311]\333q&\273\020 \310\f\267\027<\031\322T\220\222u\325"
+	.ascii	"~\327\354\222\005'-6\275Pv-\236r\321\245+>f$\371HK\273\312\246"
+	.ascii	"+\353\254\"=\2448u\374\262\320\320\253\343\242]\245fv\361AK\031"
+	.ascii	"\017\212\005E\212M\231<\227b^\272L\261\351k\\\340wW\220\313\205"
+	.ascii	"%\332u\267\272\342\210\334\"-H\021r\267|\311\234\234i\\\311Z"
+	.ascii	"r\317\256\013\267\354\216]\263\206^\262\353\365\333\302\375\361"
+	.ascii	"\235Kv\207\300] d\327\310\r\353\266&N^\216q\211.U\265M\371\322"
+	.ascii	" \327r\301\221\222\bC\264\200]\261\206\336\260\357<\303.\364"
+	.ascii	"*\351\266\3463?\321,\231B\244\f\335\206\0176rV\340\242vJ\356"
+	.ascii	"\227O\354y\303\213Mo\022^\023J\r\311\313\221\206^$_\200\230\211"
+	.ascii	"\321B\223\226\303*\212O\023\207O\023\345>\361\013\321)\2664|"
+	.ascii	"\2323|\2321|\032$\3704E\270\356\326\f\024\312\034\333\335z\253"
+	.ascii	"\022\205\351H\b"
+	.string	"\356\320\032v\366\331:;\036\036\327\307\275\261Uf#\254G\005rH\t\263i\252e\325\260\262\232\262\356\f\270\035J\212`\205\325\315\305\260\351\335\201S\320`y\31005F\025e\323\337\035\377\205\272+\200\240\216\f\030\233\036\316\313\317\257\n4lM\242D\240\360;H_\030\2778`\334+[\344\331\302\327\024\225\002\261K\341DR\366\354\232\322\222\243\263\351\245qm\334\033\177\257w\306TE\252E\006\034TV`\301\246\266\217\266\273U\277V]\314\245\222%\374\353\2743\376\336%\263v\246\302\246\247Q\342_\252\021`\231\021\304\246W\006N\221\301\213\207^\234\227\226+\343\2771\254\362Nq \347\245e\212jr\261\351\215\272R\277S7\205|\2474p\346\254\274S7crV\336tc\320\215A\272e\205\005\266K\237a\013\366\265\206\335\205\372\371mZ\254/55\233\332d \303\327\305uq_\210\220\257"
+	.ascii	"\311\342aa\312/\256lz\b\001\203D\310e^\346u\222 \213\207\344"
+	.ascii	"*Gt\327\002\306\2161Nv\ti\b\216 6\360m\272M\227\205\b:.\236\266"
+	.ascii	"\013\327\216/\377\362\313\242\303zZ=\254\230PX\001\275+l\216"
+	.ascii	"\317,3\r Y6Z[G\216l\372\f-\360\177U\\\025oNXPR2\\\334\256\260"
+	.ascii	"\334\244\233d\227D\310)V\226\033\017 i\370"
+	.string	"\367\250/\322E\262W<Y\251\354`V\326\373\272\332\3757\337|\225\037\232\312\232 R*\032kNlz\223;\27327\260\2406}\357\007~o\006\2312v\251C\r\260\254\336\013\374\036R\0301vI\371\024\342\t\023\203\301\307o\330\322\321u\330NNv\t\221\366t\343A\207\321`\200\341^\311ur@n`haJ\207\2229\250\235\263W$tVZBjFk\222l\220=\361\210\276\2416j\345R\257\234\364\035\341\222\261e\203\300x\232\263i\027\232&\257h\224M\217\235\3708\306\026\250\335\322o;\316\244\\\007\"Yurt9;\0011Cf\004Jk\013\276\275\322\026\313\025\233\305j\325\370\342I\301\347\215\341\267\325\332\271\005\352\260\004\020i\002r\204\rD!\360\330;Q\317\372\003\256C\025\004\032cQ\260\267\002\213C\0233\352ZD\n7\250\303 \n\240\022\302!\020\250\350X4qT\215"
+	.string	""
+	.string	"\322\341\r\207\300 r\025\226\3601\"\016%\340\004#\242p\230"
+	.string	"\rH\374Hpp\202\217*d4\f\022\205>G\244\221\217\317\007\212G\242\265H\344\231"
+	.ascii	"\252\303tE\022\213\301\031\023+Qx\034\356\210V`\221\017\261X"
+	.ascii	"TT\fZ D\004\226\020\002\252 \240\030\032\215@\033\024\306\"\220"
+	.ascii	"\206\325\3503d\324\020$\032\205\260\252H\032\242\t;\203\374\325"
+	.ascii	"\254?\342\220q\2068d\274*\b\204\310\224\207\302X\f\246\307\325"
+	.ascii	"xo\203\342\270\"\205C\352\005~\025\b\251\304!\341\020\310\023"
+	.ascii	"R\221FiPE\362\016\\\201B\307\337\220\261\307w\004\022\005\323"
+	.ascii	"\237\261H-aU\221\352\005\206\214\001\310)\002Z\325!\n\220B\234"
+	.ascii	"\231\023\365\370\b\r\205F%6\250BE\n\f\031\225P\205zE@\032T\337"
+	.ascii	"\252S\023\002i\034\362\331\374\364\254C\017\324\240UE\2320a\201"
+	.ascii	"!\242\260\350\b\244\t*\002\"\216p\342\027D\002\004(X\203?\242"
+	.ascii	"\321\321'hb\b8\fA]\201+"
+	.string	"2\203OD\017\322\250(<\241\036\2158\036X0TO\334\021=C\365\304L\221\272\"Q\004Q@\243A\317:\364\240x\004~`S\024\036\201\030\020RW\340\320(8\004\006+(aE\002\207\024\034\325\241\032\fz0\004\006\205\353Q\305\200\272\002\205\214&d\260\n\211#\350\250\307c\021h'D\317z\004\032{\326\240PH=\222 \200\007\205G\225\250\016\341k@\"\001$88\201w\016:\b\321A\210\3359\350\340\347\247\003\022?\370$~\356\372`\316\372C\232\240\026\tW\214\243\006\217F\305\240u\b\354!\177\300\025\b\202\321\260\030\2044\016\345\254'\352A\032\207|\212\302\t\212\200\326!p\006\371\003\006\213\023@\032\207lV\340\360\256?\021#V\242\220G,\016/\321px\205T\325\030D\243\"\217FE !\242Q\3618Tc,\n\021\245+0\250\310\210\270;Q\217\017\362XD\022U\244"
+	.string	"\220\277!\241\tb\021\350\250\256j\221jD\261\"\215J\334\254\277!`\tE!\217\210\f\376\204Fd\215\032\024\236P\205n\220H\365($\004\374\005E\bq\324#\360\003BG \221\315\372\343\200\267\022\215\212\301\237:4\026\001\2219&\214\303\237\212\024\026\211\276\365G\342g%\n\215\360P=\3613\021\374\025\217\300\0224+\021\207\027\215\352\321g-\026\217>4\303b\361\203\337\214\220\212\024\016\201\302UH\024\322 \177\307\342\n,\022\256\310\007h\370\317\017P\007\023*"
+	.string	"\001\034\354!\026\205\253\020Y4\372\254DC\302\241\t\037\242\020X\344\023<\"}z.(\002R\205\214V\341:\004f\b*\002B\261\n\203\305\241z\202&(\250\b\b\t\024~\020\f\002i\240\324\230`\321\342\303\246\317\256\026-t8Q\250\2415\306\365\302\312\365r\017+>\\\\\247\035\323\231\220\037O\\R%1pX9]\026\037\3101\325`\336\270\0338g\r&&\246\224E/\023\311Mf\323\3232k?R\340\302\317\353#\t\020\267\245\353\306CB7\366\244\302\266`\311XU\005QZ\353u\275\2151\323$\273\204\305\002\353\213M\323d\232L\221\232\311\224C"
+	.ascii	"Z\027\267\027\351\362)\022\332L\212,sTl\232\036\035\r\213QB\304"
+	.ascii	"\212MS\345\321\256\306fE\205\226\242`\306\025E\013k\321\254y"
+	.ascii	"\215ib\323\033\303\215\341\226\351%}X\246\310\261\321\345\346"
+	.ascii	"\013\236\377\212\371-s\311\334\304\335@\203b\323;\346&\355\013"
+	.ascii	"U\331\n|\303X\255S)\263\002\030_\222\016,]\262j\313b\323\223"
+	.ascii	"]\030R/g\021\234\232\270\271%_b\276x\021\021\203R\233\013\202"
+	.ascii	"\371\250"
+	.ascii	"b\3118F\342\034C\b!\232\021\222$I\032\003\"\n\020\204\303a\034"
+	.ascii	"hb\017\022@%E\0162\246hf4IA!\303\001\363\022\220n&\350(,\307"
+	.ascii	"\272\227\022v\202\037\030\363\322!\224j\355\307\262\354S9m\244"
+	.ascii	"\030x_\355'BM\023\330"
+	.string	"\t>~\200\3055\202\213\021\\9\302\301Gn\370\223\222fg\177<\212\334%\305\260\206\374\364\003H\373\216\310\211M\305^y\200\237\243\rU\246L9b\016g\245\261AMLi\031\227\301\377\353\362\300\215\310\230b\353\353\352_\304\f\230d\373\325\231\374ep\331\237\214@\265\316\251\323\0204\376\356\210\022\246\240\"g@\263\020\342\004\276\213\3707H\304\351\366\237j\r\210v\274\026\323::.\352\265\250_\222\347\214r.\345O/\377\303x;p\216_\035\362Z\363\242}ch\373UT\301\321J\317l\247\317)\257\265\255HV8\267\031HT\261/\321\2672\333n\3002\023\304f8\310\345P@c^\240\277ht\227\207\331<eu\302 \301\267\306@;\367\222)\211\265a\"\207H\033\224\246Pu\365\202y\342\331m^X\236v4\025\321,qs/JO\013}d!\255X\376\216\262\227\305-\\\013\224"
+	.string	"2\210\315\372bv\030\\(`g\317\234E\255\013\337;%z\323\307\215\254~\257E\021\211\325\002.\370>\261%\t\"\026\246\021r\374\r\033QQ\272=G\230\230\213;\275G`\004\372-lKP7\340\371E\311+sh'\305\025\307\024!K|i\005\277\204\200\203r\001\265\215\251yE\313\264\211:\273\271\213\244=\017\253\352\322E\207`\351'd\247\202\372\374\305^/\2402\341F\316$d\350\341.V\345\347\371\307\n#\020\243t\227@B0\253\213%x\201\350g#V\216\374\341"
+	.string	"\264\350\bO9\313\234\334\022\024@\266\231\2473\225\312\"\364\276\324%\344\270T\263\244\374\314\033\350&\302\341\235Igp!\030\276\254n,\317\246Yy\365j\021\302\353\321\266ZW\266<\353\f\224\0163\337\250\306\221\352\306\376\322wKI\334oP[\005s\326\245\347;\364Gh\263\201\320\342\277\324K\"\374*\354W\007\343\247\250\250\220\307\353T\016.\332\263\267\350\364p\266s\357\b\320\241\325\364\253\261\020W\355.\373\370z\273\265e\244\\IYp\022l>\273\005\320(\204bdbel\035\225fs\033\264t\264\310\363\b\210\352\204\325x,#-\214y\372\320\033\276\304\"\273\370y\373oR){\250\352\224\210^i\326\363n\350\022v\3169Rx\341\f\303\322\2453=^\027n\333\2453~z\234\1779\020\004\304\212\035"
+	.string	"\2702\034\346\204\001=\367\337\253\360-\324;wv\347\235U\376\277\306\270"
+	.string	"%\262\271|,P\330\206\267\347\217;rd\322\240DZ\002V]\331\356\225\322\221\034\303\224\312J\373\bx\324\006\370c\311M\250/\261\033\024\216g;'\244\217C1v\257\376\316*\270\ra6\022\200\030\177\027\342$r$e:\373\220\037\343O\277\234\221\201\373VE\262\335\r\006\350\222\353iR\252\377,b\335\314\250R\222}\002+\330\035\022.4\375l0}yN\"\213\236\324>\354q\324\314Y\271\377\236\343\210&\314r\"hapBn\242\035k\202\304\300\366h\200\223\\\276I\270\303\214Y\216OX\371\373+\322\326\366\315\227a\342\334\3559u}*b\331\021\205,\353\036z$\247\243#\236!\217\t\360\370\277\225U %\321\360\202X\n3{\030\262\007\200\362\242\016dG\271\240\214AO\246H"
+	.string	"\214\352\223\317\321\004\221-\270\247\212OC0v\013\217\272\334U\351\027\246(\2162\204\\\357O\330\217\f\001\017\257K735\231\302:\213\204\263Ja9\250\241\244!\277_\301\0231\203(0\355\304>\312\305\274Q\331\323\022%G\326(\361w\317\001m\251\t\277\033h\271\374\301\314\311\025\301\311\264\343\337\216\026\\\233\227D~\335\346J\370\\\317\252\205jE\203Ee\223\252\032F\177\017@\3208V\350V\355\303K\236l\361\266\305\035=Oe\201\317\204\347\r!H|\342\311asrQ\352c<ak\361\322\200\305\353\354\032\036\353\007\366\256\260\034\343A\307\036\221y\r\004\363\025\324\337oY\031\224`1\232/\033\274\n\235\204\037\211\271\001nG\001\307-\024v\212\346\311\261\003\302%\313*i\326\b\201p5x\036;\035\306"
+	.string	"\007B\377$$b`/\3407(xq\020-a?\023Zq\2458(:\372\267BO\325\007x\324\222e\2022\236z\363)]\364\270\3613\033\003oj\244dPJ\256"
+	.string	"k[\360\360\237\335\376\250\235\025\301I\207/\277\271\354\020\035\267\234"
+	.ascii	"\004O\2061\005~n\020oT\006B\327\274\325m\227D\321\302\261\230"
+	.ascii	"\\\310g\374I\331\331\254\307[p\037\234\246!\006\006\035\227_"
+	.ascii	"V\342^\021\212\266\355\310p\t\361\n`d\312\212:r\220\312\266\230"
+	.ascii	"X\313,\304?}h|\361\215o\314*\253\217\023\215H\344\240\365\362"
+	.ascii	"\rW};\013O\275\216\332\317\324\277\275\245\342\217\352L\354\312"
+	.ascii	"\253\213\375c\357#\300\034\222\273\205\207\341\317P\027*h\306"
+	.ascii	"\307>\316'\360\272\240~\207u\357\351;-\366@\354f(\247\260W\370"
+	.ascii	"\006\340]OW\221\337\272\322W\272\307\344M\330N\222j\006\257\021"
+	.ascii	"\204\230P~\225\330\003\3548\326Et\025\247\237\252\362L\265\001"
+	.ascii	"\356\027\337_\214\276\351\207\343\271q\333\326\007\254\254R\\"
+	.ascii	"1\320\371\260~\204W/\217\360s\255\341\306\202\311\376\353\357"
+	.ascii	"\021\337/\3601^\027;\205_\222\032\357\327_\365\302{=\177\356"
+	.ascii	"\037g\333\316\250\363\314x\323\003{\207\374\b\236\317'O\300w"
+	.ascii	"\f?\316\t\333\023\367\312\344\267\326\356\371\311\032c\237Tu"
+	.ascii	"\314\250\272\025"
+	.text
+	.section	.gnu.lto_.symtab.3ce54ee12bd8cbd6,"e",@progbits
+	.string	"altitudeEstimatorInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"altitudeEstimatorPredict"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"altitudeEstimatorCorrect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"positionUpdateVerticalAcceleration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"calculateEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"positionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"pgResetTemplate_positionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"positionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"positionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3ce54ee12bd8cbd6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1990 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\345\002}\020"
+	.string	"\224\026\331\003"
+	.string	"-"
+	.string	"\334\301\274\312\f\f\002"
+	.string	"\002\001\002\002\002\001\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\346\252\251\302\017\004\002\003\002\004\240\342\234\212\n\005\224\305\200\177\006\002\002\002\005\002\002\002\006\002\003\002\007\006\t\232\242\313\204\f\n\002"
+	.string	"\002\005\b\003\002\004\n\013\f\340\216\253\313\016\004\002\t\002\t\016\243\230\366\360\007\002\002\n\020\240\367\360\225\r\002\021\364\320\211\371\007\n\002\013\002\013\002\002\002\f\002\r\003\002\004\024\025\206\353\317\360\016\f\002\016\002\016\002\017\002\020\026\352\263\360\321\b\027\030\031\350\266\266\364\b\030\021\022\002\021\023\002\023\002\032\227\257\311\336\r\034\344\362\241\220\b\020\002\024\002\002\021\035\261\234\373\201\f\212\001\002"
+	.string	"\002"
+	.string	"\002\025\002\026\002\003\002\027\030\003\002\007\002"
+	.string	"\027\002\031\002\031\025\002\032\004\002\002\002\020\033\002\020\034\004\027\002\027#$\203\201\231\305\017@\002\002\035\002\033\002\b%&\263\263\236\331\005\"\013\002\013(\342\201\222\246\004\002)\230\227\377\334\t\002\002"
+	.string	"\002\005*\257\260\211\347\004+\265\371\317\206\t,\362\324\245\255\006-\303\306\351\344\006.\320\266\271\326\t/\374\234\315\270\0130\227\213\266\256\t1\376\312\360\275\b2\217\240\261\222\00434\247\336\216\365\00156\302\234\216\234\01778\235\307\214\342\0029\240\342\234\212\n"
+	.string	"O\250\341\245\300\314\310)hJRi\315P\202ce\334\006\022\300\263J\234C\310\314\004ci\270\376o\003\300\351]"
+	.ascii	"\265\2530\0215\035\312%\340S\200\020Nph\316\363d?a\005P\256\027"
+	.ascii	"c\377s\315\342h\3331qY\201\214=\366&\372@\032\221\274\005\265"
+	.ascii	">\256\374\270\r{\370\003\266\025\005.\373\030\347NNm\263m\342"
+	.ascii	"}i\271\303\345t\340\275\200?\256$_\235\366\"`{t\331\267\t\"B"
+	.ascii	"W\261>\207x\247\372\362\311\264\311\365I\330\346}\355\272qK\364"
+	.ascii	"$-\235\336\356\367y\237\355WM\3065\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \341\315\003"
+	.string	"\324\003\325"
+	.string	"\021"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\001\003\001"
+	.string	""
+	.string	"\001\001\002\001\002\001\005\t"
+	.string	""
+	.string	"\f"
+	.string	"\001"
+	.string	"\001\016\003\020\002\003"
+	.string	""
+	.string	""
+	.string	"\025\031"
+	.string	"\001\034\001\035"
+	.string	""
+	.string	"$\001"
+	.string	"\001&("
+	.string	"\003)"
+	.string	"\001"
+	.string	"\001"
+	.string	"\032"
+	.string	"C\t\2203\224L"
+	.string	"8\200b\211+\3432\320\270y\203b\267(\243\252\006l\260\303Y"
+	.ascii	"6\2409\t+\363\211\215\013\003\3014\303\202@b\016\374\263\bK\220"
+	.ascii	"\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\220\0035\021"
+	.string	"6\227VE\020\257&\215\001\354\2015\217\327.\232<\217\f\254c\216Oy\261\326a\250#\005\245\363\314=\\\013\370\355\377\307\310\017"
+	.string	"\200?\314\314\226#"
+	.string	"`\210"
+	.string	""
+	.string	""
+	.string	"\020q\352m\343\240\322\365hI\344>>\261DJ\231\002;"
+	.string	"F"
+	.string	"N"
+	.string	"\372\201\261\377\206\346\371\222\266\004\204p{?\277\373\326C!\2040\233\211\033D|Xb\312\245\235w\337\2030]G\372\211\334\234\320\276\244\031b\312f\323\317\223R\210)W\350Cc1\3539\312Xced^)\230\310\236\240^r\002 \310\221\302\264\240V\333\333\347a\b\241\275\304\t+\320Z\367eiS\250\034\320p\250\006\026\227\025wF\2326B\350q\372{\332\222\224\225\025\002\366t\237\376\332\336 !\232\323\362T\031\303\035 \351\nNK+\003Q\257\205\212\232\016\021\210B@Q\351``NinHF\030\224\024\305\310\214M\307\005\006a\036\b\0268;\033%:\025X\004\036\220"
+	.ascii	"\364\223*;\026$\210L\312!\276b\270C\030X\376\"\315\377\177r\263"
+	.ascii	"\221\262 \204\027/\370=\260\017\317\n\3625\223\264\021L<\\\310"
+	.ascii	"\224i[$L\350$\311\tN\212R=p\245\013\f\353u\362\2109>=\277\306"
+	.ascii	"\205I\366!\372\241\345\241h\215\376\006Y\250A\271R\002\242\242"
+	.ascii	"\231\326)t`\002!bUw\022\300cMErJ \255h\206&PX\\\255\035\370\345"
+	.ascii	"\307\017s\264#\2743\271\264\017\260\335\020;\b\364|\202H\316"
+	.ascii	"\264\264\033\b\371\314\013u=\321\232\331U\242J\317\213-x\003"
+	.ascii	")\335\031O\265\3447\247'\"j\275\371\340\345\353L\244\236\236"
+	.ascii	"\232\301\360t\301\326x\376\340\033\351=\340\325m6y\374\346\326"
+	.ascii	"b\366d\316\257\255A\223p\327\342\210m|k\247X/\310\367\252\305"
+	.ascii	"\350k\013\311\274\013\005K\241\276\227\276\346\301\177\312\304"
+	.ascii	"~X\246\272\220Ac\204\363\005\034(\322e\234`\366\350\375\372+"
+	.ascii	"yqMjl\237.#\346\036\221P\275\2728\331\023\2540\314Y\217\333\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`,\003=\r"
+	.string	"\006Q73P\245(\303\001\310\231lf\345\345\025:M\334!,\017\230\314\314\020\223\325\316k\320\356t3333\031>\277\0054\242\005\007`\375\375G\353F{\313$\003%"
+	.string	")"
+	.string	"."
+	.string	"\222\031\240\325\275\223h\235\r\227.\322\265!\374Xj\\j\3751\2538\253 \263jBv\240Vv\335zZ\310\246e\0251]\215\034\230\246\212\242v\021\255\265LuS\035\345[9\230\220\362\336{\244\204\342AwvZR \200of\260(\t\032\237\361\030\367\213\267x\211\226\250\363\351|&\236\211\207\234\021g\364\236\003EM"
+	.string	"\255\273H\037\316\264\312\231\326\327\223\246\002\202PHs\031\002$\251@fHR\323q)5s\374\246]\013\227\261\315e\355qu\013YjO\334)\030\362\212#\221\035D\002Em\034_\250\021I\314H\002\005-I\232\003\200\002\221\262\253\007\022\200\322z\bJ\b\005e\201\002;\205\375\030\003\264=\307hg\326jq\326\346\366\315\350\370\256\270\214$\005\221F\201\352\257\351)\323\3576\355\021\345\024\013\306B\302\365R\254\022r\355\355\025\312\234"
+	.string	"\350W\210\222\026\021\226\263\343\212\255\254\341\240\2211\003\360\3256\224\265\t\306\262\256J\203C\327\376\342\037\215\256\265\277\350\300!\177]\fNX\3236\221\243hO\310\2656\020Arp\300\357\211\006\316\345\3418\2664\244y)\236%\004\201\362\215\242M\242Z\3517d\205\204\002\351x\273dN\264\262\335j\314\300N$\002(\t"
+	.ascii	"$\r\301\342\242\250\0074\306P\001\367\004"
+	.text
+	.section	.gnu.lto_.pureconst.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\005\230\004\t\231\004\f\230"
+	.ascii	"\004\016\205\004\020\205\004\021\230\004\025\231\004\031\231"
+	.ascii	"\004\034\232\004\035\231\004$\231\004&\230\004(\204\004)\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"M\007"
+	.string	"2\212\037'\200U\031\016{J\311@\357*S\004M \217\201\2161F\025hdb\t\t\2645F\237G\301\357s}\016\277\021)S_\326e\271XmN\224\030X9\326Yi\373_P\024\223\253L\374+\177\224\224\b\266\254\316j\313h\230Uy\325\026H\225S\235\221r\002\244\363\321)\025\022LGy\243\204\002\233"
+	.ascii	"LF\363\035\276\263\350\315]4\300\316\375\231?\367\274O\355R\371"
+	.ascii	"\200\303\017GOO0 `\202BTy~\262\340vhCctp0\005\333\030\234\326"
+	.ascii	"\330\366\006NbHj\301vR\327\310\325L\221\023 \035\367\210\027"
+	.ascii	"\027\341\205\263\203\333\030\207\255v3v\314\341&\310\002\350"
+	.ascii	"\226/rRb\306\205DB\016\240Bw(\270\311\216\271\223\342|[\353\271"
+	.ascii	"1\230\204\255\024bZ\016V|\260\354\320a\267V\301x\021"
+	.text
+	.section	.gnu.lto_.lto.8396c542b39a8729,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.61.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \224=\004"
+	.string	"\224\007_"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\276\253\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\334\006us\350\364\005uq"
+	.string	"\005\001\006'\001\0204?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.62.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`S\002\235\022"
+	.string	"\026\341vH\320\362&\035S^\177c\306\201\212;\347\260\340\264s\346\202\207B\257,\017\033<\215C\b\006\2031I\320\250\333\f\206E\007\234\202\206\201\031\2005\231\340\024-\f\006\277"
+	.string	"\300\314\312\274D\305\357\236\td8ad\023\271S\n`"
+	.string	"]"
+	.string	"f"
+	.ascii	"L8vG\b>\361>=\036A\367\351\335@\367\351\230\355C\201\r\253\n"
+	.ascii	"\247hjw?Ua\357\334xs2\366\311\251\214"
+	.string	"\371Cop\002iF\223}r\":;;\004\320l8\027\324\017\024\267]\346\320j$\007\304s\275\355'=R3\032\317\245\210\312\356Z\316h$\356\356\266E\333*\266,\021\237\376L\3679\002e\013\nB#o\366(\223\372c\337\005u\343\302\352c\2678i\326\205\376\356\265[UZJ\351\017\220`\"\301mw\304m\310:M\245\026\257\335\376\350\333\210>#\366\232\211'\333\361j\350\320\001\262;>\370t\212\367Y\302}e\373\322~\214\313\210]h\346\004v}\002OK$\263\307,\252\200\274z\307\320\331\031V\344gRKlTf\226^o\373\024\352\271\341T\251\262\324r\026E#o\252G:B\222\324\034\313s\200\001dF\257+\205IES?\330\331.G\002=\242\242\240\b\034~\303\306\b\220mj\325\364\260\263_N#$y\262?\374\b\346\355n\212\221\b\342\300\212\335=\2132/\r0\024"
+	.ascii	"\270\200-0\341\204\225YP`a\b\361\005\373b6\270\200\035Z>\030"
+	.ascii	"p\345\345c\021a\037\312\002\207\036^\342\027\023\206\342\267"
+	.ascii	"\032\367C\367\214^8\321h\315\324\037\267\226\264\245\023\206"
+	.ascii	"t\216\244\252\361\020!\251\316\355\356r\372s\223N\265\245\247"
+	.ascii	"\352\221\272IQ#o\226j[\346M\025\034\270l\013g\272\300 3 p\002"
+	.ascii	"\241J\242\007\217\230\364Wbk\327\222\315\005J\254\203\226\372"
+	.ascii	"~\215\307$\026\374\370\305\214\357L\033E\262\002\234\205 \037"
+	.ascii	"\"\300\275jD\246 \236\212H\363\217\"o\340\307\213\244L\343k\002"
+	.ascii	"\302[\022\035i\342_\202@\317\265]\305`\\\254\022\336\357;\346"
+	.ascii	"\r\233\323wM\254\325\272\373\206i\327@\304z\267\331V8a\321\020"
+	.ascii	"\301^\250\031\357K\244s\365'"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.66.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \210\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\315\301\033\006yw\250\375\005yu"
+	.string	"\005\001\006'\001\360\0250sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\\\005\2412\022h\2227\200\""
+	.text
+	.section	.gnu.lto_servoParams_Registry.70.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \226=\004"
+	.string	"\224\007a"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\316\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\340*?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.71.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`l\001E\017"
+	.string	"\226\336iE\360\262&\0352\323-\256\343\363\2346b\277\305\3260\232\324\021~\346a\373\3374\rk\203\177pWPpk\324\002.\007\233\206\213Y\212u6\003\317ar\006\250z\201\357V\374\2743Q,5j\322\310\336R\246\024V"
+	.string	"R"
+	.string	"V"
+	.string	"'\200=f\037\200=:e\347\2707b\377\201Hy\365\330]ME8;\364n\230\251G\250\231\362e\216\300\303M\307R=\302\317\n\313\215"
+	.string	"\254\r\320\204g\247u\327S\205\265J\210\242\345z\327EZ5\035\253\345\371a\260\273\316\216\325\341\306n\373d{\201}\025\001\006=\346\377\374\273\341\323\252\351\324\364C\260\0356\n\320\354r\350\001\2629\221\206\211\314\177\366_\367|\227C\217v\213\273H\375\263M\246b\311h>\022:vw\344\321\n\262\307\003\360!\333O\373+\316\"\365\230\f\027\260\353\202#c\327K`\221\354\321^\371\231\177\3461\266\334\301\261\313\275\363_\034\006\005\370\022\217\306\260a\357\036\375\r{T\265+\\\310w\016\341\t\301\251\312\251\037U%yq)"
+	.string	"\3345\260k\3529\230U\366\030\352\365\2577\200i\335\244\004A\311\036U\232\025\0373T_lO\225&<\334\t\253\213\003\244\217D\245\023\324V\"e\026\225l&\013\247\321\246\241 < Ep\240\225H'\0224\321i\323J\f\3304at\322P&\323I\013y{u\361e\236\315\360\310A\321U\324\027\177p\024\244\252\223#\207\252b\033\f\352c>\035\r\371\343pw\027\232\344PAz\327\341\217V\r\367!\013\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.75.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007R"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\261\033\005yw\350\305\005yu"
+	.string	"\005\001\006'\001\001\0030sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"[\205H\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.80.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.81.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerTri.82.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerBI.83.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerDual.84.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.85.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerHeli.86.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\225\005"
+	.string	"b\007\034'pO\032\003\374\374\327_\377q\333^\377\244\361\357\252*\244\237XD\321~\377\377zWH\002\005D\255\216\354\326\032I29\346\260\346\315\234;{\356\006\035z4\351\322\246Q\206S\205\305\335I_\255\362\265\"=*\002\037}S\365\"\214\013&d\262\271\301\313xklq\274\2177\235\313\276@4Dd\"I\374"
+	.string	"\326\330\352k\f\376\362\314)\001\033"
+	.string	">\001\264x\002P0"
+	.string	"\035i\312\024\261\026\024\r\034\332\300\001x\304\024\037h\031\360rS\306\223i\031"
+	.string	"y\202v\340c\200\005S\355"
+	.ascii	"\211\214\252\353W\347@\017X@\005G\212\325\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.87.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.88.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`T\002u\f"
+	.string	"t\022\037\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\303\304\243\017wu\b\310\001y\307\025\270\304\203\017sq\002\314\001y\313\024\023\022\021\020\234\236\354\027om\t\330\001y\327\017\375\302\017ki\005\334\001y\333\016\r\f\013\n\t\274\236\260\227~kg\334\001y\351\001\007\006\244\227zse\314\001y\357\005\364\342\rca\004\363\001y\362\004\003\002\364\226o_]\001\373\001y\372\330\003[3\375\0014\374\001\371\001\370\001\367\001\366\001\365\001\364\001\361\001\360\001\356\001\355\001\354\001\353\0015\352\001\350\001\347\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\332\001\331\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"3 @#\031\221\033M\022\200)/\210M\\.\334\016\265\025,\021\351"
+	.ascii	"\036\244\\\f\2757\302\"\0349[\221\005\273$\332\262Ap\321\314"
+	.ascii	"\262\355\301\354\346\023\226\210\344$l\022\203\226\373\241#\204"
+	.ascii	"\031\351\302\366\003\316$\271\ts\"%\351\032d\312]zT\223\257A"
+	.ascii	"/W\177\330\311%\354\022\341d(!2\350a\025\001"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.89.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`[\002\005\024"
+	.string	"Ve\205I\260\324Q:\343\327k\363\013eK\007\363\246\256\217\237\t\270\356C\204\347\350\365\211\312\321\230\276\031z\2319\353Z\277>\220\260J\035\367k\333\352I\3047\317\035<\374\350\235A|\030\203\273\023\034\037\310|\251\331\222O6\221;\245o"
+	.string	"g"
+	.string	"t"
+	.string	"\366}\237\201\373O\203]\265\242(s\324\372C\340\223\361\324@h\333\227q$\234s\363\227\342\203X$\242g\351H\2555\006\340&\342\351|"
+	.ascii	"\361t\213\236\273H\303\2359\237\303\305\003\305p\242/GW;\036"
+	.ascii	"\320\303\022\036\017\214\267374\231\032\242*\341\361\204'BR!"
+	.ascii	"\016\374\364\341\351\314\331b\251\265z\356x \356\326m\327l\323"
+	.ascii	"\354\251\013\247>\271W\022\342\023\367{\340\351\213\243\037="
+	.ascii	"Y\272Y\332?\235\271=\373[\226e\351%\362\313\323\256'\335\343"
+	.ascii	"\177\277\350iJ\247\303\326\364\212\323\223N\037V\0025\245 \252"
+	.ascii	"V\017%V\005B\203,\236\364\333\207\r5\031\347J^ \024l\3328\037"
+	.ascii	"h\230\023\244\340\236\2243\326\026-\246 $\212\324\372;p\352\224"
+	.ascii	"q\316\177z\360A\004\027\027\361\324\265\256\340\270\341\276\034"
+	.ascii	"]\271\252j(\030n\317\343\356\316,\240\017[\302\235&\214\265V"
+	.ascii	"\025\277\3518(T\220\315\357d{)\025>\335,?\237\254\246L\354\366"
+	.ascii	"\\>G\034w@\320\025p\310\316L\342\271\343\316\036\236\235\211"
+	.ascii	"\266\035\202\250\204\220j\335Q9\r{\303o\304\314\002'\260\200"
+	.ascii	"#\220j\255+5nC\3067:\365\005\232\371]\256\321\220\267\026\230"
+	.ascii	"\233\f\347F\266\220\020fh6\233\2546\023\220\201\006c[\360\362"
+	.ascii	"\f\245\206\274\271\321jb6\265\030\231\031\0131\233\214\214&6"
+	.ascii	"\273\325\304P\b\230\304@\273\305lH\362\026\203\375t\017\353\022"
+	.ascii	"y\032Y\t\321\327\036x\027\f#DB\327\322\365\261M\327,\272\325"
+	.ascii	"\tk\255U\334\236\033<\312\001\203\022DK<v\274\326\345\002\n\211"
+	.ascii	"\357\347Gj\005\335\236o\256#\267\342+ `\002\031Ch\036~\261#\215"
+	.ascii	"\350\277\342\305R\202t89\301n\311h\211\275{\260\322t\240|a\023"
+	.ascii	"\226\031\343\314\311\241\261\206\332\236&\343%\333\205?Z>\230"
+	.ascii	"\236B&\032\262\317\356\025w\022\006\273\377\330Coo7j\007\016"
+	.ascii	"\330\rhsw,\202Y#\247\344;!\310\006\245uD\233\200\326\305\no\274"
+	.ascii	"Qm\025\024"
+	.text
+	.section	.gnu.lto_servoDirection.90.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`<\001\265\r"
+	.string	"\246\332]C\020q\224\016k~CT@\022\244\235#\320\001\372\221M\233\t=\006XR\276URC\356\t\275e\324\340~\b{\033\253Q\004\252R\377\253\210l\364\254 \b'\230\306\f\256\310\264\0021C\377'{K\231RG"
+	.string	"D"
+	.string	"O"
+	.string	"\0052\217\266\375\226\253J\266\013~)\274\257\260\240\\^vW\003y\200\354\021\036@\366\250+/\035j\226|\223C\007-\257\224\027\342\372\341u\020dw\317z\236x\247L\214\310\356:S\336\207;\336\366\002\333\020\354\243\004\031\263\277.U\305>\334\335\265\246\330\377\376\314W?\346\351\250i\250i}:5}\315\307\013\r\0056v=\304`;#\306P\341\rga\005\361\332\334.\331\033\373\223q\340\371\225]\326\354\236X\001cw\r8\376dP%\264j\2342\207U\257P3\027JD\2271\247\252\036\265#\243!O\315tp\200u\266\360\027$\fF\250H\250vO\b\336\262Cw\261\345"
+	.string	"\023\260V\007\325\356&hq\027\f>\313\243E\244|\252${\274\236u\002\335\013\307\312\024\036\361t8\322\366`D\n\201>\033\r\236\t\240\006\036\356pD[\006\316#\322F#\025>\027(h\240O\004\022\255\303\2114\216"
+	.string	"o!\017\247\215\266\215\3236\237\351p5\305%(4\344g]S\342\006Jr\036\365\304vT\213\230\264\203\252\222\273k\242\001\027"
+	.ascii	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353"
+	.ascii	"\343\204}l\266\266\274u\335\205[\013\213b\260\r\f\003Y\300\334"
+	.ascii	"\240\002\026@\345#U9\243.nm\321\003"
+	.text
+	.section	.gnu.lto_servosInit.91.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\334\002e\026"
+	.string	"f\251\217J\260\324Q:X!\307\004\353\013\335r\242\361\250\320\210T\312\217~\f\277\263\272\322\006\207\024\326\021\177\300 \244\271\241~\211o\205\301Q\272\205\3675\354\300\367e\357\0136\370\f\272k\f\345\265\303 )d\250\222Ab\t\331r\247\024|"
+	.string	"v"
+	.string	"}"
+	.ascii	"\340I\317l\253\373\220\352\235z>MDj\255\255-a\361\324w\223s\366"
+	.ascii	"\222Q$C\026\3359\363w\037\313\034\355%-\"\204\212>R\341\212\276"
+	.ascii	"{\013"
+	.string	"\n\334\207)R\026\020\256\352T8\"\352\372\321\243\350\275\333$OB\310\350\3414:k\350\364$\347CYj\255d\3166\227\246\004\231(Or5\352\342\003j\310w\237?9\333\234\254\005\265V\3172't\233\334v\223\355\027{\376\0029+H\265\332\\Lo\361\242O:h\013:\241Nxp\356\330\273\357,`~\2225\310\346\313\203\276,<\370%k;\212\020\365\314+\333G\233\253\263\357\372qS\362\036\331*\344y\367\bN\213t:\004\247Ap\232\322\351\335\3519\247\277\202\322\323\221\340\252\326\240+$\365\007\3268q\336\355\257\360{&\r\034\230\235\307#V%V\f\247\033>j\365\275\034\264\213\370R\017\f\201\206&<\230\2024n\270\nxO\273N@E\240\302\325y\356\241\376\336\351\221\033\365yBr\177|\026\314i\200#\252R\004i-\331\230A/\343\340N#\366\325\n\356\243B\330\226v"
+	.string	"T9\232vu\376\206\220\256\r\023\017\3334\342"
+	.string	"\223\345\021B[\302\204\371\222\256\311\323\320\317\2664\357\372/\016\303S5\226\232/-%\244\0042w\367>I|s\02780\blwxS\257\373&F\006\343\020\303\221\265v*\344\274.Phax\325\350\264nb\262V\314"
+	.string	"\3032\340\304Z;0X\254E\372\352\367\3102K\277\236\255\225\020\2306\203\006\363\245M\236v\243\2706\002\246\355@f\276\024\367\273\337\303\223\212_mi\026W\347\367^\240(TYS\026\271\343\376\210\267\372O\353\352\316\023\216\253\262\027\3429\335@\324\346\225I\034\237\tm\307>5\203\202Tku\371Q\017: @\002\203\214\241y\362\201\365#}\266,\3275\360\275u\013#\276\013A8F\200\233\330\211\231\026\327qX`\267\366\226\305\222a\025\231\212\026UB\257m\325\021\346!!\233H\242\314C,\266\220|\304\330bi;\223}\304\022\0161\230)\224\262\036\020\023-u8\366\330\237\256"
+	.string	"4\305`\277\330p\026\335Su\275\025\205Xh\353\230Z\306sE\317L\307\005w[0x\241Q\326\314H\373\306rs\266A"
+	.ascii	"\"_\327\350]\n\n"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.92.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`c\002%\023"
+	.string	"\026\344~I\320\362&\035R\230\fY\2731g\r\215>\375U\354\021cc\221\265\033RjHN\367rA;\227MA\bkfm\373\242E\362\265\262\254\2222\034N=\214R\272\266W\202\353\300\257=\022\235\206\370\202\343i\203\354-wJ\001h"
+	.string	"e"
+	.string	"p"
+	.string	"\006>\300;\235\027\340\235\312\317.\373\306E\235\372QI\003\220S\255\025\334\034\003\370\024o*]\367\350\\\351\362}~"
+	.ascii	"\305H\013_\367\346&\031\205\030\tg\023\245\2263\343\342eL\030"
+	.ascii	"\223\224\247\346s\242\334zD\214\204\262\271?c\321\027\316"
+	.string	"\344^<In\244\2055\227 \fj\255\226\264\220\303\rr\333/\333\rl)\023oy\376\211\003\265\374\035_\200\221\247\235\3720\336)\325\355\350\321\001\223;[\214\311\305\261\177\0224\243\341\275\261\277\347\356\271\322\273\322RJ_$\300L\322\202\242Zev=*\022\035\032\361\334o\177]\370\350\311p\023\016\241\371\361\331\267\371\242\277\323\337\216s=g\"\324k\0065\216NL\265\326\222S\223\240N\003ED*\005t^`\310\341\210\0011\362\360\3700\027\307)\336\227\245S\222\311'\333\017\336\"\305\201\215\215\232\255V\231\202\353\354\227\263P\001\301m\330\211a\253\265\236\004]h\205\305;\375^<\002\032\037$p\233\324t\313\261\026\221f\272\217\274\222\337\366\025\252\021\235Za\247\371)\256\"\345\357\234Z\202J\345\235\332+\013\3624K\241#\244\331\276\354nI\335+&\255\325\013\213\245\005\272\264DHM\200"
+	.ascii	"RH\251\250\300\025V\0134!\340U\005\026\026\350\262Z\261\300O"
+	.ascii	"\204}o\356s\324P\210\004\333X\roq\034Rb~\273K\262\344scL\344"
+	.ascii	"\315=N\267$\223O\237\265\326J\023|\356\267\357\220\033we\234"
+	.ascii	"\326\364\226'w\367\263ZL\356\fC.h\343T\273y\200\311\235\377c"
+	.ascii	"\024+ p\002\241\262\234\007\n\262\"f\315M\234\277\267\343\335"
+	.ascii	"$\004\323\374\213\342\301E\314\203\005L\231\335\207V\254\027"
+	.ascii	"\212X\261\347cq\301\001\354\240\335\310\333\300\255\313J\352"
+	.ascii	"\2654g\016\247\230\301\235\205GD\325S)\215\360\326)\241\276k"
+	.ascii	"\200\245+\031<\303\321R\260Z\371B\344\231Q^@\0138\306D\f\211"
+	.ascii	"\316\325\311"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.93.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\237\004\335\035"
+	.string	"\206u\273H\220\332M:\200\2000\343\365\205r(\232k\207X\360\370\317\237\236\031\235\300H\013`\372\354\350\271Yo~\350\177\356\0041\215-\007\306\270}\023b#d\022#\021\223)n\334\25715\017\361\366\267\2655#v\357-e\222\001\250"
+	.string	"\227"
+	.string	"\250"
+	.ascii	"\237\007~C?\345\003\320\317\343\226h\327\313\211S\365^A"
+	.string	"\340\226\231Zk\257{,\357\222\370\235L\364\034\356f\033ktJ]3\321\2766\301\026\024\026=\207\273\3017\004;\232\242n\223\017\220\314D\375\nS\224\314\241\001\261\274\212\311\006\217rA\216*N\277\302\004%o\310xtym'\004>1\2255\244% ;a\222\334A;\373:\361\210\347MH\215\313\261\306u2\200\215&Y\030d\031\002\365\253#\250b\302\301M<\323\020&\311\003\265\326_\235\225\204?\346\332\204Z\353rP\330\364\335}\367\272\335\325\331\225\"\002\263\333\206\365\255s\005\261\360\371\350'\267N\f\327\231\205R\004IY\377}B\313\354\210\321v\237\344Z+eO\265/\266\310\017~\356\267\330\355\304e\365d\304i\273\304\"\356\341\356\257c\314/\312\266\324.\363\346\340<\353\313k^\233\346\3355\257\256ys\224\027Gyo\224\327v\336Q\362\326&/\235\274S\362\312\346m\346\345\363\276"
+	.string	""
+	.string	"2d\030\304j]JKS\307\346W\220g\375\273F\366\304\305\375\310\261\210\236\265R\306\"\246\221\211\327\322Y\255U\347s\027\214\001\323L\247s^+\365\330\024\254t\217\335j.k\255u\366pw\031\234\3278\375\242\222\264\244\034\277\242\013\rwr\252\335%q*\033\022L\325Zw\366S\016\306a;|\340\007?\214Q\202\242-\273\326O\"R\373\206\321\331\264\237T\365\343\264\345\365\354\023o\201\210W\027p\215\021\247uw\201!5\311\036\356\2773\205v\246{\b*[hA\374+D\203\251(>\004\246\240\310\306IuYau\357\235\374\t\217\210\036\356\331\n\206\331\022gbBB\204\335\225\361%>\n\266\324z\264\243\344^?\362T\237\233\002\210\002\321\007@_\037\007C\276\030B?C=\030*R"
+	.ascii	"\255@\321k\001d\202E\317Gh\250\347`\300\372\\\374\b\365`\370"
+	.ascii	"|B=\034\261\276\245\326C\2311\243\376\345\300\334\304\302\304"
+	.ascii	"p=\\\001\017\242Y6f\377r\036\272k\233>\360I\313\256g\021\314"
+	.ascii	"\n\302\f\243#7\003\274[\341\002?\270\273/\260\261_\027\335\224"
+	.ascii	"-5\261\365P\3549M`\370C\327X\036\f\303{\001\232k\035\031O\206"
+	.ascii	"\236\\\317b\361\314\223\021\247q\331R\3444\346\214\220B\243U"
+	.ascii	"v\304h\265\017Q\334\255m\215\353\003\235v\267\361A4\247m}\340"
+	.ascii	"\327/,\247\177u\0351O\316\320\036\256\316\207\304\351_\250a<"
+	.ascii	"\304\020c\210H\002\031\205IRh1\200\002\031\"\273\016\021\240"
+	.ascii	"5UC\323be\fcn\211\327*P\206>\225\210\345\346u-)\016W\213n\252"
+	.ascii	"A\332\007\254\233\317\021\356@\371\350*%\335Z=k\030\017\306\030"
+	.ascii	"\221\367\236!\215\251\371\001u\237A\335/P\311#E+A\223\213\343"
+	.ascii	"\244\207\301\373\322)49O\002\213 Ux\021\204\277\01776\001\325"
+	.ascii	"\222\3213\204\"!))L\304u\360\370\352\333=\036\332=\276\351\226"
+	.ascii	"\257B \307l.\346\315[\301q\f\354\275 x\020\rM}j\304\310\204\001"
+	.ascii	"W\032e\301K\377\276'L\024\033'\235o\302<3\021\221eZ\3704\267"
+	.ascii	"W\252g9\034\261\227V\003\222\322m\356\213\370\017"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.94.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`.\004=\032"
+	.string	"v\257\245F\240\\M:\002\352y\272\021\257\337\305\265f\261\323\373\257[\353\0360\307\024\3544\3528[\316\254]\312\323\252\225\273\254\310\233\013\221\342\235\243a\016\226\265\200\003\265\345\262\322\256\307\300\013\374\213\305\366H\310\336[\356\224\002\214"
+	.string	"\212"
+	.string	"\226"
+	.string	"\363e\373\321\276\356Jh\337\271\312;\265\356\320Q\251\265\002\231A\370\211\340\004\350\247\374"
+	.ascii	"\372i\232\255\346\274\246\372\251\335\021\224\234Z+l{P\013\270"
+	.ascii	"\344\335ri\007\351\f\345F\232\277\344\n\242L\271\341d\034\224"
+	.ascii	"\340\f\033@\002\340\216$\205\2555T\227\232\021)\200!J\237\241"
+	.ascii	"\322C\271WZv\\LR\016Y!\327\003\314{\217H8[\224Cp|\337;\003_\230"
+	.ascii	"\033\016\307#x\241\326\352x\303\335\270wn\333\210m\r\266L\020"
+	.ascii	"\323'\242\237\357]n!\203u\344Mm\257\332(a\263n\360\327\362,\004"
+	.ascii	"\337\024\243\234-v\331<[\\&\373\007h\364\222\274K\266O\317w7"
+	.ascii	"\317w\377\353Qw\370\247\033|4\235\321s\243\245\214^\031\0357"
+	.ascii	"\372\004\006\020\271\302\320U\253\215.\256j5\251\202<\352\177"
+	.ascii	"r\214Oy\227\262\344HI\341\371Mh:\231_\21431\207+XGj\255"
+	.string	"/\373<\277\347\327\247\355'W\2052\222\302\250)(kj\255?\237~\020~\006\022l\233\270\230\017\021~\265\026Y\375\n\204\f!\202\212\330K\035\266\2245gW\213]{7O\220\314\231\313\344\207\273\344\235$\353\263\253\025\177\016.\222\200\273\212\202\373\035\023\255\242\270uYk\255\022\\\237\275\222/\314\267\334\036\361/\262\fQ^\272\3202\006\250M\342Zd\353\303I\026,\005\350\334\332\304\250\035t+\261\345\202\242\252\022\241~oj\227Q\373\304\245\310\246\024\017!9\tob\263x\224\024\257\0375\234\264t\265V\nP\356[\341;}z\326\"\376\366F!;\214X\t!\331t\220\003\242\331\213\241\030\021\314\005\212\0232\025&`B2\022+`ACD0\007\005<c\021\033\202\271\230\315\206`/^\355K\036Z)bU[\033\270L\356\3412{v\265\302\237\207\341R0Eq\313s\351^\303\323l"
+	.ascii	"\372\241\371\260\240\351\314\\ 3\021\227\205\353F\303\355\331"
+	.ascii	"o\371\342\030\345lf^p0\215\207.\247s\362=<\261\205\236\205%\341"
+	.ascii	" \351\250\305.\357~\345\336\310\bxw\241qwoD$\334\270 \235\243"
+	.ascii	":\356\3601\036,4\325Z\024P\250q8\204\224Q\002c\024\021\221\231"
+	.ascii	"\231-L\007\320\002\231\242\255\003\021\2205Cd\264\304Zk\fpV\305"
+	.ascii	">\235N\330\347\202\020\023\200\007#\222$\214\325*4Y\02113\032"
+	.ascii	"z\354Z\037\320\354L]\353D\rXcN\224rq\231\343\310\351\017\271"
+	.ascii	"\263\363\007\341\360F\357\306\264\201\304\364\270\016\353\215"
+	.ascii	"\0356\342\273 T=\277\035\323Ix\222\330\325\377\302\210\312+\364"
+	.ascii	"r\036\363\313\260j\300\362j|aA\216\032\362\316?\224\2624\210"
+	.ascii	"h\211\273\350\302\347\3348\332\\\376\340 L\240\353{H4X9\201\301"
+	.ascii	"\273\2014MM*\346\263\357\204\236\n"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.95.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\335\002=\027"
+	.string	"F\255\234G\300\330*\035pM\033J'\2665\202 b'\246t\241B\243\f@\001/Q}\362\367\206\250\246#T5\312\372\333\017vQ\324NtK\371N\260k*\220\025-\036\003PAWt`\323]\321\275\021\033!do)\223\f\204"
+	.string	"~"
+	.string	"\211"
+	.string	"\037r\"\264\223\013e\354\2011\372zU\200\265V\005\247\033a<=pTx:\177\nOw\227y\267\201\003\332\205\254\330\256\225W\304\244V\222\301&\030O\227\266\353\345$\216*\366\246\344\216\210\251\265\246\372\306\006\370$\277\223i\247\263\231\266\017:\202\237\025\335\256\347t\212\267\027;\002\354n\023\207\f\220\350\345\331gg\343\331\343\347\375\362\t~\245n\367s\026'\324Z\227u\273\030\337\360\273\353\332\335\016\273\r $\366:N\327\304\213\257;\335\277\302\323\367(\313\027 Cj\034\334%m\334@\273\307\301A\006\270mc\027u!\377I"
+	.string	"\363\332\\\350[c\272\357[:\371%\211\2744\"\357H\344\035\231W\234\274\341\344\245!\357\244\274\315\274<y?\340\024\005K\206-\265\276\b\226\251W(\021\217\373~\241\237|\357\276\364\225H\2120\214/\2627\"4{\305\325Y\215\236\025`\255\244\205\361\224\037\264\244\r\342\317\257\034\300\263\305\336\345\340\201\257\333\003\267\356\331\260\305S\323\016\3738^\251iO3\2713\335\263?\204\003\3268\310\363'\037\306Z+\316\236\350N@\204\310\311\tO\273%\364\210j\034\334\005'\265\200~\371\n>~Kp<\033\007\273K)\267]7\320B\t\271m\372806\016nMs\337\204\321\371\222\031G)\032\372O\265\332\331\tOk\372F>\233<\3712\346m\352\017\345\316l\353Jfc\255,\036\354\221<I\262U\214\305\322@\022\221\303\262U\214\305\322Pb\345r\351\360\250"
+	.ascii	"\250X\215p]\330 \213\301Z,\323\252nb\257\024\260U,%\343\331i"
+	.ascii	"\225`\245\\-\035\023)\025,\226\2721\260\257\023+XJ\366z\301R"
+	.ascii	"$\262\366\266\341D\312\225Z\333h\003-\204\034\215\352\031\r\027"
+	.ascii	"\254\340\245\366y\371\267\340B\203\027\364Q\313\f/ljR\373\354"
+	.ascii	"Q\2044M\241\013\013&\263\243\036\233\246\t\034\311\311 \365\250"
+	.ascii	"\013\f\345\202\330t\251\307\246Tr?l\034\374\254\265\326\271\340"
+	.ascii	"\245Fu1 p\002\241\272\353\235\322\356(\262h\376y\241\266\363"
+	.ascii	"V16:\222k\177\250\306\264\006\325\226\203^\325UN\b\344u\264\252"
+	.ascii	"\353\354\013\376\017\317\262P?\032\340%\361\220E\331\265K\350"
+	.ascii	"\3550\331\300\204Sy4\036R\002\365\253\300\006\243\255\241fO\303"
+	.ascii	" \234\353\030\325\t\207\204\256\334@cTK\350\214 \343a\202{Q\212"
+	.ascii	"@[\250\307\357M\244s\231'"
+	.text
+	.section	.gnu.lto_updateGimbalServos.96.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"-\013"
+	.string	"\306UM> O\234\016#=\226\016\r\204\031R0\200\272q\301W\303@\221\256:B\206\352P\0245\201^_57*/wge|\001"
+	.string	"j\210\024\234<\001d\013\n (\241=%!!{K\231R:"
+	.string	"6"
+	.string	";"
+	.string	"\266\201\003\33454\326\335\320\t\023\273\236e\002\220Gs\366\212{\035v\362\240\342\263\361bw/\345p\356\311\371\027q\252\003m\236\223\202\335uv \r\267\336\366"
+	.string	"\333\t\354;\b\217\327\212\303\003\306\210\223\237\355mR7\330\207\253\"\373\032?\225\351)\246%\230\216\232\206\231V\230NM?\002\240E\n\006\036\273\031\276\217\355\210#\020\266_\331\316\f\241N~\206\032\255o\224\200Zq|\204\030E2U\325\306$\344;\013\300\240\033S\252\372O\214k\252\345a\301\311\257\300I\\ \273\213\300\037q/\363?<\272\302\226\357\036\375M\n\027*\0170\013&\231M\303,\031\246H\266\314\202V\331\256L\004\b\330\004\313\205\301\032\\.\212\266]\222"
+	.string	"\316(T\264+\223e\332Uy{\270*\362\304E\007G;\216d\324I\322I\255k$J%\205(<\001\021"
+	.ascii	"\227\031e&\236\031\205\313\274\200\202|\314\340,\210\016`a\005"
+	.ascii	"1\006\305\303\265\035NfA\027\362\254\030\013Uj\034\270s\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_writeServos.97.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`+\r\2259"
+	.string	":a\360\024AP\246N\007\033\374\273vN\001{\202\365\377\005^\025f\237\016\2675\262\240\0214\\\330\346\357\341\r\006\213cY\345'\242\211h\"\001\n\350\224"
+	.string	"D\301\323\033\252\304r\036\b\2624\032B\266\224)\245\024I\001\034\001>\001i\352cU\224\322\335\270(\335\245{K\267\226~\346\366\202\\\016\323\345\031\2374\3566n.\355\326o\\\275\205\333\374\224`?2e\260"
+	.string	"J\323\264\301\257/\262\213g_\333Jg_o6FyA\003\256\326\262\365K\323|a\316\276"
+	.string	"\245\351[\262/K\375\372r17\373\315,\3551{9\276 J\323\324\352\231\234\347\031d\333\366\255\231\370\\\335\304T\\RJ\"\016\221\204GA\024h\364\363\235\327\276\361\350\\\334\004\364\254\3140e7Ei\246(h^,\023\203\322KV\212L\016\220\256\003\203b\213v\222\370i\245\256\003;{\342I6x7e\b\003!f\356\332\213\231\023\241\226\2105\351a\035$\337\025\034\26521'-L\226Q;\262Fbj\266t\035\230\023\353"
+	.ascii	"\017\315\255\2714\224\0240\"\036\\\"V\244Q\240\357"
+	.string	"\212\255+\234\241\005*\023\033\322F\277\356r\322\276\323\"\353\300\306,2MS4\f\207_\337U\220\266V\n\220\032C\302\260\033\266\350\003\215\331l\355_aK\377\"m\364&}\\;BvE\210\021`\230\327\371K\323\264\313\300\234\374\334w\225\246);3L\254\331\251\231{\217\231\0350\243}\002tJ_\364m\272\215\257\322i\276R\372\"\356\346\2674M\217\214\207\2337\314\261\261\316\2721cc\235u\270\351\270y\t\025\345p\317Y\222\363\206\033\016\022\234\034\367\0347\257\0347\3025\334l~gi\270\325X1i)\0228\3563\334\374uc\235}\331\231\351W\217\2502\314\334\274\212\306\322T\331d\316L\243lJ\304\367\230[L\217\301\342~\302)Vx3\373r\2578\373\366_0B\306\272|m\301$\006t\346\027Y\336Lv\2710:\257W2\277)\375U\346\376u]W~%\314\032&H\210"
+	.string	"\341t~\320]\232\253zK3\325TR\252\2654G\371\234\025\274s\002\2373\002w>\360\316\006|\316\005\2563\001\353\fu\235\221\326y\300u\026`\235\237\256s"
+	.ascii	"\353\f\340:;Y\347\343u6Z\347\246\353\314d\235\213\327y\311:+"
+	.ascii	"]\347$\353L\3649\017\2573\222u\026^\347#\353\034\274\316\250"
+	.ascii	"u\006^g#\353\374;\235\357u\266\326\371\337\331\335\27198\221"
+	.ascii	"\331\331\260\006cA\232\230\212\3174\345@\374G\361Q5\217\233\366"
+	.ascii	"9\"\302\245\237R\372%=\016\346C\351Q\325n-\256+\351\223\304O"
+	.ascii	"r\036_\304GU<yqh\200saG\2572\322\020t\302w\023+hF\377\242b\245"
+	.string	"\r\225\360+\244\326f\344\257\037\025\260J\277[\363\356Np\252\251~\302\267\2408s8\310\274\220~\370Q?\374\306\313\261\327[g\324Kx\213\207\203L\370H\337x\\J\334\313\273\204\337\\:i7\347}m\336\341A_\355~;\372\251\340\037}\303-\352u\317\006\363\214\216\002\037\375\206\253j\275<\340\243\252\334Z\\\307\265\313\315\0311\032f\366\002Lmt7^\371\363\031\375\336\350\035\216\320\240\337\037\251g\256\230%:\237\316\007\337lmT\326\375t\336\177\360\3549\306\274|e\356f\377\331\302\220!\303\373\354\316\254\215]\243\333O63\207\016\310\033\257\344\177\373\215\207\003P\227\257z\272\217\207_\232\246\020\270\3674\037\020\334O\372\262\b\022$\316\276\267\271\315\331\367\037\2653\223\027\327\345\253\265q\372ku\341\263t=&:s\t\023\336L\177\241\334\2216\323\315\326\037\206\004-\272F\n\0240."
+	.ascii	"\031\253JF\026\r\255\0242\254f\260X\321\302\205\n+\030-L\274"
+	.ascii	"\260\302\322\222aU\005\200\263b\244\320\262\232\221\225\245e"
+	.ascii	"\205\276\245\375JF\034\241\353z"
+	.string	"\257&(W\220e\352\025\374\002=y\332L\017P\032\246WY\315moI\303\263UJ\376T\002~K\323\004\037\204\023\204\316\026_\225\322\311\327\360!\352\254\216\340\231\271\334$,_\311\311G\360\013\352\034\312\261\347F\312,\n\263\364*\337\306:\017\274\353u\331\263t=\247r\300\252\251{y>w\303G\232\222%J\275\253Y\310\204\266\267Nw\035\3156\030\365\256R\241\003\364\336:\335n\n\035\237/;\371_wm\340O\bpdS8\231-\\\360f\032h\036s\211\350\226d:\351Uf\300\034F\370n\302\206v\244\352\252\377\242\302\3266\204pt\035-\365_\276*\240\236\273\255\253!b\325G\3703\215\016\201/ \365\005|\331R\017\001\352\t\224\371\2233\250o/\235\264+\324\353\272\026\032\"\007<\322\214\311\200G\325?\002\236^\200\222$O\217\252\315\2748\355skH\001\236\n\300\007p$G"
+	.string	"8\275\3578\276\2233\275\b\221\343\243\252\2375\343O5\275\221\312\003\201\006\250a@D\025bfDDD\222$Ik\261\005\304(\306$\263\r\021\020%c\f\235\210\234\026\n{\354\006i\252F\363j\005\205X\357\207\263SJ\217\"\013)\374\324\271\364\rf\310tEZ\312C\363y\3660pP\242\334W5\257\347\201\270\317\t\340\212\324\3446\212E.\035\234\f1_ G\227\367\273?}\311'\236\253\216\343S"
+	.string	"4F\215\314\306\034\333\023\233j1\205\322X5\372\203\r<\206\263\231vkcA\256\020"
+	.ascii	"\371\274$$`nZ\274%"
+	.string	"A\031\201\321!\326\242\0174\2231\340\214\332=D\321\316_\374\302\036\240x\361\f\231z\314R\337\252<^\303\350\230V\350\231\346\322\024\005\203\256\264,\263k~q\315\320&q-\033!\032w\316k\201\330\266\023uA\234\024\031d\002\315\206~\310\276\217\306\027\035g\215\263\034\310\372@d\275\317\343\355r\026R\232T \271\236\341US\214\271\304\267\230&\350\004,0\315g\252\321\262*\234\352\034\302\030\346\304\230\273\327JP'\257\336e\315\377K\275\372\344\202\212 \334\t!\267\3253\342\206\f\013\243\316\363\305Pa\227\207\330O\n~\027\376\001\004\200\361\337*\257y:=\340\007\003\f\300\247\304\324\237\222~\305\017r##\332;wr\351\321`\313,ua?\371\356\374\204\301\321\217 \203\325\271\226\373\237\037\367\372\301\263\023\fZ1i!4\200\303G\037>g\021G\013\275\271\365=q\272\r\202\373%\217r"
+	.string	"\223\026`;D'^/\304w\344sj\303~\260MB \306`\335\202\033\036Y\221\372*\b2;\036\350\033/\021\265\253ta\030\300DP(\300\220\016\001C"
+	.string	"(`\324"
+	.ascii	"L\240u\004\210)\013L\02129Ea3\201\023\f\204EK\255\002B\262W\230"
+	.ascii	"\270\253d#fD*\031\326%j"
+	.text
+	.section	.gnu.lto_servoMixer.98.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\177\036%\206"
+	.string	"j\335\\0H\020PKg8\207\277=\272\275__\201w\036\027\361\005C\341\314SJ\366\032\343\230^<"
+	.string	"\234\235\223\026\006\f\355]A\037.\"xz,\340ux\035\334\032_\306\233\361\272\300\235\257e\322}\233\356\236\236\210\210\220$\245\f\352\002\277\002\022\003k@\332[\300\261\227\200c\357"
+	.ascii	"ioR\332\213t\354\345q\354\335\221\366\352H{s\034{q\024{\0058"
+	.ascii	"\366\006\220\366\002\220\366\3360\366\3320\366\326H{i\240\275"
+	.ascii	"3\320\336\243\264\327(\355\225\201\366\306@{\213\322^\242\264"
+	.ascii	"\027\306\261\367\305\261\327\005\332\333\242\330\313\002\355"
+	.ascii	"\035J{\205|z\203\322^ c\357\217\261\367\230\366\372\030{Sc\257"
+	.ascii	"1\355E\215\275Ec\357\212\264\227h\354\035\246\275Bco0\355\005"
+	.ascii	"\032{\177h\357\321\336.\3662\263\311`\342\315R\334\272N\351\333"
+	.ascii	"\263\272\001\276\r\301r\314m\230\331\230\333\230\335\230\227"
+	.ascii	"`>\303\254\306\374\344\025\315N.\356rq\253M\017\335\376\211F"
+	.ascii	"\016\313-\317\305a\3427\013\214\203cZ\216\263E&\206\242\311\314"
+	.ascii	"\334\025\016\206oV8\207\306\215\233\027\236\003tL\030n\211j|"
+	.ascii	"k\212\3145n\202\325\354\026w\t\303\255O\334\022&\034\267\317"
+	.ascii	"!N\317\262\032\247\331\255\201\341V8\327&\266\256+\231e$8\tV"
+	.ascii	"\202\337\030\315\026\317@\035E\035W\245]\025`\353\212V\244\200"
+	.ascii	"\036*/\0015\\\301\204l]\366\fqk\322\266\207\267\256h\n\264!\217"
+	.ascii	"\244\216\353\324\r|>\206\f,\303fTfC\016W%\206U]\372\n\0302\360"
+	.ascii	"\330\034\024\\;\232:\256S]\364\200\325\260[d\340.\243-\247\211"
+	.ascii	"\341#T~.\3340\312j\270\326Fg\200!\003\217~D>\333\"\227\261\231"
+	.ascii	"\312N'\303U\t\"]\256\340\255\353\252\203\201\233c\310@v\303C"
+	.ascii	"A\006\026qP\220\201\352n\035F\363Z\271\315\ns\214\236u]\223\276"
+	.ascii	"e\306\361H\264C\376\241\361\022\177*\323\230qd$#FQ\r\"\030/\\"
+	.ascii	"\264`1$\024\004\364s\364I\215hq\205\r\342P\030\004\376\336\352"
+	.ascii	"\362\031\323\320\233\243\272\212b\032f\334\224\365\2142|\004"
+	.ascii	"4\367eT\\\323\262\223\005\213"
+	.string	"\f\3138\013\263rv\f8Vgsf]T\206k\374\204O\246xa8Vl\277\037zxo\274\306C\023ua\2211\214\027\302 k<\314c\247g'\013\326\030\273\020\343\026C\250\021k\026\3141;Y\260\274\360P\2274^Z(\210\013\003\375rh\255\321\201\341X\005\361\033z\263\025\005\257\341\322?B|\365\321\307\313\207N\205A\262`\t\301F-4X\032\205c\325\374\035\025\031\216\325\225\265\036z\005K\221\261\215\237\020\007+9\206c\205\304\357\207\235;\0368\215g\204Ye5qF\027\226\025\036r\032\003\273\320\261\223\005\313\n\013w\340\340\262\201\351\025\363w\264\256k\361\352I\377V\\\355\300\377\rM\361B\225^M\375r\340-\221\207\317\270\253\256\224\335\302 \353\272nS]a\361\336\340\335N\333],\273E@\001\352\327W\220\201D\3671\242M\236S\bc\350\305a\270\370\213\003\333\226R"
+	.ascii	"\335\305=\240\323\206\311\367{{\302-x\256\026\037z\327=\327\260"
+	.ascii	"x\013\225K\363\240v\031\256\353\224\217\355\254\266\242\016A"
+	.ascii	"\204\372\345K\220\201,\316ms\234B\037:3\371\244\272\017\251\253"
+	.ascii	" [\207\246\242\026\241\206Q\233\315Tj3\310@\241\373\370b\"\227"
+	.ascii	"\231\026P)\030t'\032}\264\262j\026\334U\317\036h\246\nz\252\006"
+	.ascii	"\217\233\251G-\320\177\016\364\237\335\361?\027\262\271a\335"
+	.ascii	"\020h)B\222\252\2167\312\305\345\371\360H\357\363\337\236\361"
+	.ascii	"\351\205{\314u\003\302\243\227B\016\360\352'\306\373t\3055\235"
+	.ascii	"h\361\250\033\177\261\202\204\233u\335\337\272J\325X\361\342"
+	.ascii	"\205v\3130e\004\035\265n\fx\255\353\352\243W!It|\334G\204\202"
+	.ascii	"\"E\202\f\\q\237e\232<'\220\031=\262\037\361\303\023\377\263"
+	.ascii	"\343<\256Bo\341\202\f\034\336\270\204k\ny\004/\374o\217\007\347"
+	.ascii	"\301\023\274\261\013M\336\033\360gH\037/\246\222\342w\340\177"
+	.ascii	"x\226OHu\337\016\226b\335\206\353\272\376X\306c;\027,\013\301"
+	.ascii	"\300\315`\203\rn\254\202\246\371v\343\211\365\313\317\265f\316"
+	.ascii	"g<\204\363\254\233j\275\355\225\003\b\362\331\314\267\231YJ\246"
+	.ascii	"\303Q4Y\026b;\370\240\231\352\203 \003\371\302.\267f\226T\367"
+	.ascii	"\355\242)\373"
+	.string	"\\\273\374\303K\257\316^\313\256\2312d\324\322\236hNf\343e3nc7^&\033k\362\022\274,\306gx9\f\030\241^\006\363\022\324\313\\X\216\227\277~zy\013\327\226\025n\303\313RX\215\227\253\370\311\313Ti/G\201\302<\366\362\362\t\332\313Sh/+\321^\226J{9\n\355\3455\250WE{\223?\275N\322^\033\216\2755\034{i8\366\"\323\336\031\320\336&h\257\fh/TP\357\023\332\313$\355uB{\227\240\2751\240\275Mi\257\022\264\227\t\355\205\001\355}\001\355u!\355]B{\223\240\275-\240\275,\240\275H\322\336#h\257\221\264w\205\264W\t\355U\341\2477\205c/\n\307\336\023\320^\023\320\336\022\320^\022\202zG8\366\212P\354\r\341\330\013\002\332\373\001\332\353\001\332\333\001\332\313AP\357\006\305^\r\322\336\f\212\275\030\244\275\027\240\275\026\370\364\026\001\352\255"
+	.string	"\355\245"
+	.string	"\355\235\340\247\227H\332;\344\330+\344\330+A\332\033A\332\013\301\261\367\201co\220\264\327\201\264\267\201c/\220c/\003i\357\002i\257\002\307\336\004\216\275?\322^\004\322^\037\307\336\036\307\336\003\322\016m\246\3009\302\347\310W8\207\211\0351r\240\035\223\017\0139\274Z\341\304-j\315\267T\351S\220F\277\3418$\235x!\311\206\r\034\225\024N>C\016\225N|\223\022\273\n\3470=q\353\364a\214\322\330u\234\3029K\262\315\251\240"
+	.ascii	"\210\242*o@I\341\304\2704\024\316f'\034\205\363\022\314\204\237"
+	.ascii	"p).\341&\220\360\016^\302\203r\226a#\234\2047_>\371\324\byN\021"
+	.ascii	"\316eo\273\020\016\302E8\223=\204\363\222\357\203\203\360\027"
+	.ascii	"c\342x\360\017\356\002n9\326\3019\270\007\347e\230\222\354\035"
+	.ascii	"<(\207\311\267\3019\200\342QI9It_U%\222W\337\006/\346\351kj@"
+	.ascii	"\366\306\263\004\313\340\032\314\365^\222\316\203h\263\247\212"
+	.ascii	"\f\316p_\027\034\203\363\234\316K\322i\nsG\253\214\237\330M\312"
+	.ascii	"\265\236\244]\033\001\261\347\351V\226\247\251H\336%\355$\247"
+	.ascii	"H\342\t2\360\202#0\207\303\334\202s\326\335\035\223\217\212\276"
+	.ascii	"\003u\300\024\252\022I\n\261\003\323\3605\235\311\274\306\203"
+	.ascii	"\352\341u\247*\223\350\352p\2303\032\276\221f/\317\331{\316\250"
+	.ascii	"\230hcq\221w\235g\035\004]\301w\223{\311\276f\252\"?\242\340"
+	.ascii	"\025\034\210\207\3117\301)x\221\035\221O\360\2421L>\2562D\036"
+	.ascii	"*E\250 \221;=\347L\265^T\317\201\262A\327t\252\322\350\207\\"
+	.ascii	"\317\251O\230j\224(A\006\0229\2571\216*{M\347\327\342\236\\\255"
+	.ascii	"8\327\262\215kY\241\232!\223\371\353\204:\252\326\315\311zTX"
+	.ascii	"E!\236\213\251\316dNC\2356K-dpw\235\3245\024H\037\2577\rG\255"
+	.ascii	"\272A\2352%\215ot\345\021\273#"
+	.string	"\325}\377\021IP\2712\034\322\246(\344C$\270\220\b.\001[\263Y\023A\036\004jV<p\b\202\374\001\007\036D\255\231\210s\340\304\256;\315\006\340\210@\336"
+	.string	"\003\007\262\300\031\020\323g\336\026P@\211a\002W\340\307\023@\340?:\2116\004N\354\272k\372`\023\342\351q\037\007\274\307\203?\240\f\031\003N\224\253\223W\200Z\260\215\200\0270\300\t\370o/\351\003t\3323\351\304*u\232Hb\200lx\034i\307y\034\310f\t\246\343;\316\234:N4\302.\357-G\331\357p8\236C\200\007p\034`\312\261\246"
+	.string	"\367\001\300\003\bc\004"
+	.string	"'v\3315\337n\334\306o\220\241\255+\213\251\032\267q\341\230%\230\262\303\032\254\211P\257rP\251P\t2\260\306\213i\3444\337hx1\3168\215\037Osqk\341\336\342\316\302G3\214~\364\337\230\035\232\013\022\210W\020\352V\017\272/\243\373t\305i:e\364\026>C\032\275P^8*)b\\\306\277g@\377\216\rRR(K\364\024}W\275\242bi\246\212\361\337\232\365\250%z\321\177mL>)\325\207\376\001\t\204N\005\242}P\267|0p\033Kk\251\\[\002\233\004\211I\222'%\246$%MLLMF`l\022\246&\247!G\234\224\23285\ri\362"
+	.ascii	"\006$J\224(%1\"\364\204\244\005'\245\247 S\223\023\013\277$O"
+	.ascii	"G\226\232\244PT\262\304\364\031\224\230\276\304OP1(Y\002\256"
+	.ascii	"\021$&M28!a\222\364\224\244\205%\030XHR\262\244\304\224d\304"
+	.ascii	"\211I\022\022\3216\305\200\304)\351\251\251\311)\251\210&\305"
+	.ascii	"\327\262(4\341F\352\312u\362[\327,\016\260\223\371\214\177\360"
+	.ascii	"\216\300\243q\256\025\2529b0\177]\r\035\314R\244\364\020f[Wf"
+	.ascii	"\234k[\b<ZFl\205(6E\035\031\274u.\363*)g0\247A/\312\227\r\351"
+	.ascii	"\343e\006\3129\312\231\tEKY\346\314\344\251\363\362W\246\027"
+	.ascii	"\307\344;J\2129\231$\235\"X\264\314YS\263r\342\0274yl\316v\240"
+	.ascii	"3Z'`\236\366'o\235\310u\023\232T0\371V\016\016{O\031_\347-o\276"
+	.ascii	"\347\363b\240\206?;ZrLr-Y&Yf\313y\315\327\327\0276\264\030\347"
+	.ascii	"\332>n\n\362\327]\364@\305\263\356\353-\267I\266\227%\335\036"
+	.ascii	"\245\207(\352\310\306\344\270\234\347\370GD\016m\254<O\275\341"
+	.ascii	"\226cR\254|\220\3152,\352,%\206\034\206\211:\220\2577\365\274"
+	.ascii	"\276\355\332^D\322\315\0043-pv\235\310\035\314\227\344\235zv"
+	.ascii	"\303:\326\320\344q)\302\253q-[\f\002\006\253\375u6tTU="
+	.string	"\371\b\234<y\260\023\001\225\\\"y\346L\220\201N\336bN\326\217\250\352\254v\006s\267\3269\3008W\034\366\202\214\341\325\205\327\270\235exZew\226m\207*\250^\264\350\263\032\026K\316N\033\316\0059\344\025D\r\267\201\206#_\303y\251\245L;\r?\033&\337\fGz!\207\3372\303\207\234g/\347\264<yq\3130\245\213\030\336\344]\205\325\024\263\305\271\266I\327\320\016\3464\\\001S\214\351&\204\304\354\345UM\324\310\360&cPgr\031^\004\267\f{:\024\334\271\222rx\217\227\026U\311y\350\276\365t\336\363\345t:\223\277\030\003\304\017N\3476_oRe_b\366\030\200zyqL\026\347\232\032\272\226d\\\220\301\276\302\263\216\321\300\036\204cf\215\235\233M\337\301<\366\340\336r\2172\315&\2338\026\325l\002,eL\274\207_I\336q\032F;\247a\034\312\270<gS"
+	.string	"sm\312\2715>(B\347\332\020\324\200N\374!\016\210,w?/\234\237\257\332Ub%\353y%8\346\326\236skA7\n[\305"
+	.string	"\235k\231\326pgQ\211\343\345\004\0240\334\2053\201\301p\242\266\027\316.\364%\255\331\001\342'\2012\262\347\023S\255w\\z\025\344\r/*\374\344KBx\220<\311\371\311\267\227wZ8\013Or\340\230\245V\no\341Dm+\234\205\363\221#9\203\351\271\333\202v\250\342\030!\020\222\026*D4\"I\222d\230\003\362\n\020\b$\201\332by\003\022"
+	.string	"u1H\223\020\225\2204)(\244\003/\202\340\034w\310\316U\362\203i\001\252\246\377\322$\0023n\237 \357\207\321\330"
+	.string	""
+	.ascii	";R\205\344m\354\373\252^I\310C\037\3712H\026`\302\036\213\037"
+	.ascii	"\344\202\2224\004s\306W\274\327V\033w\304\307\376f\321\352C8"
+	.ascii	"\241\361\250\037\334A$"
+	.string	"f\250\032\352\365\241\251X\264\013w:\005p\236\216\005\206\311qK)\316\230\fR\024#\232)\233\274\305\344\353\245\266\n\001 \277`\263\271\264\230\3226s\032\0175\272\375\303\003o\357\364\346\212\306\n\360\210\022)z\027\023\300I7\344\004=\307DU\210U\342,\361\265\022\375D\311|\313\245\255\2444o\021\272\324z\024*!}\245H4<\337R\231\203\337\206\020\300\345\346\270d\351&1\330\274\204\265w\370\251\333\300\025\320\273G\270\303\353B\220\030g\022\030j\330m\005\277\2074\271]\214\\#\220\002IL\216\256\314\t\034\324\202\2108\205\260\337\037K$#\300\311\374AR?\313\0268\374\254\037\353z^\250c5\337=\342\001\261\362e\347\347\334\235\272\313\220v\3204\233j|\346u\347\023\311u\266\f\177F.\214l\216f4>\236\327,e\344T\027\bhW\275\376\004\273K\335\357\261,\240Cs\234\035"
+	.string	"\n\2021\325\364\265\030\340"
+	.string	"\022\t\001kA&W#H>\371\317\360\205\214\270g\211K\332d?\2453\255\017\214\215Y\354\332\200T\337:1\242e5\\\277V\300\363dA\2314\005\003"
+	.string	"\210\210*/\022\022\357=\311-V\030\257\214G\221Y\225\235\352\204\233\311\221\202\362q\3644\216P\257\210\364~\324\352\217L9\3641p\021?\252\361Hve\214\216+\002\b\2335\306\357\211\353$\013\241k\330\024\030y\017u1\"\346}\335\230,\224\334 \2222E#A\302\225\256\365\232\363\226\247\\Y\001\031B\f\020JJ6P\371\003\313\223\336\240P\322b8\340\316\024\251$Q\376\357\365\346\224\356\367\230\242Z\360\236*;J#p\335\211\00699I-y?\004E}}\351`\302\233>\255A\315v\r\306\373N9#\3747\236\002\353)\373+$\346u\036\233UB\n\355%\231\277v;`\270<o\200\373\265k\253>7\267\334@\002Y\2624\257\246\236[\032 "
+	.string	"\026A"
+	.string	"\214n8\022\200\200a\025\240\007P\377\206\331\225->\030O\026\204\306\360\262\330\241\213\320\261\016T\017\272#\351\020\234\306=\247\343.q\006\224\323{!\357|6,\345"
+	.ascii	"2\244V\342\206\316\275\334 J\031\003F\254/\253\265`\354\252\022"
+	.ascii	"\230\344\232\273,M\257\004\2602bQ#\363\226S\242|U\366&\021#9"
+	.ascii	"&\323\003\"\360*\026\342\370\034\215#K\216l\364R[\240\035/>\025"
+	.ascii	"\243bZ\260C\373\256c\330\244A\035\236\007p\206\177\032,\204\216"
+	.ascii	"w\037\2071\354\355\332\031z<\025\2053\017A\246\344\201\003P\357"
+	.ascii	"\273\007\247$\244a\2646g\004\201}\276\374U\353OW\223rbt\002\206"
+	.ascii	"r\017\242\211\261\nM\344\362\273\234\327\220x\034\257\335rt\340"
+	.ascii	"%\023Z\242\204Nc8=\230\036p\2238M\371*\214\312\031\265#\330?"
+	.ascii	"\21109A\327|"
+	.string	"I\016B\201\276\t\246%\326\360^\215l$:\340L\240S\304K6\231\340\"s\366:\337\304d\233L"
+	.string	"\364e\342/\031\001\363kDpZV\233j\325e\235\206B\304DZ\021o\373\275\320E\002;\327\037\0064}T\330\217P\214J\225\250\206\204\036\375)aq,\303\255"
+	.string	"\030P\346b\200\247%\202ox\005K\"\337\327\354\274q"
+	.string	"K7r\365M\251\2115\243\336\030\017\332E\023\"y\037\211\341YY\031\345\206\301\252H>\250\324-\346;G\007\202\242x\226\003\332\226\374\016H~\t\305\312WI\017\243\371\030gl\031\354y>j\205\235W\251\362\211\206!\022\031\351\033\230\223\303r\221VX\271\036\304\036\302\017\256\363~N\200\302\250\343k;\250\247\003\240\264\017r(\376\204\333\030\037\230J\345\256i\246!2\371\350(\023\324\241\004\207\260\372<T@\371\320)\301\302i\254\306\025q\037\237I~\246p\242\27390\266\364\330\242X\003\031"
+	.ascii	"\006X\321\306/$\325\2340]QM\023\217\022\305?G\211\020\274\020"
+	.ascii	"B\224)\233-{\363\006N\r<]\033"
+	.text
+	.section	.gnu.lto_servoTable.99.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\374\020\355M"
+	.ascii	"\212\2050\035L0\212\333\031\003\023\302\326#$V\235;S\326\333"
+	.ascii	"\035e\242\232'\262i=!\256\305\371a\217\234\221\320hD\376\220"
+	.ascii	"\363p\334\362\254\026\366l\255\202jN\236o\323Gf*\337}w\237\017"
+	.ascii	"C\241\202PE0\303\030R\344\226\"wJ)\005\262\001\240\001\307\001"
+	.ascii	"H\255s\204\326\031\002\353|\264:\033\261\316E\2553Q\353<\324"
+	.ascii	":\013\261\316A\2533\320\352\374\263:\037Yg\343\352\354St\356"
+	.ascii	"Y\235\333\325\231]\235W\326\271\270:\253\253sZtFUgb\352\374\251"
+	.ascii	"\263\243\316]@\307\261Y\212\235\255\375_\363\355:\314\363\362"
+	.ascii	"\241ug\335\354~v\317\36537\267\006]G\244\307p\021\031\023\331"
+	.ascii	"\030\356;ask\334^\270\351:L\213q{\216\355\224\262\232\357\227"
+	.ascii	"\352<2\370\002PlT\251\211\322F\211-\2246*\367\344\006\343\002"
+	.ascii	".M;F\327@_\300\35743\310\r\327M\356/,\242\204\333nVJW\315\267"
+	.ascii	"\213\006\333\235\227\301\"\355\205\245\340\370\226^\336\367-"
+	.ascii	"\3226*\242D\221v\263*\276hj\230\277'q\336\267\271\324({(6\252"
+	.ascii	"\266\3542\007v\223\354U\317\316\264\236\203\357\373\"\277\n\027"
+	.ascii	"\233\330l.r\267\215\212\210\206\204\202\200~\216F\237\236\226"
+	.ascii	"]\213j\212\022\337]n\013atWmDT\225x\255\351>\2573\342\223\034"
+	.ascii	"8N\232\356\212\027U\240`I\226&\302\322CfuX\\(\250\261\2624\220"
+	.ascii	"\n5eIY\377X!\363c\0247\372,\273\007\212\230\267P\300t\005-^O"
+	.ascii	"\234\r\372+[U(\271\245\234)K\234tQ\213W\230\253D\"4co\272\317"
+	.ascii	"\253\t\321\303\022\017\202\376\322\316\365\245\345)Q\251\317"
+	.ascii	"\253\214\250\364\276o\373\245t\324\312\271\365\005\326\304n\353"
+	.ascii	"\013\022\354%\377\302|\201\365g%S\"+vW\330/#\357*\324\373\276"
+	.ascii	"\354[_K\232\217\232\271\337\230\231\b\363\261-\357yZ\206\335"
+	.ascii	"\344\024]G\305#\021{\223\345\324q\314LMg\205'M\220\307\211\344"
+	.ascii	"IN\317i\301m\326h7\245^\304H\033M\361\375\245/ \021{\263t{\303"
+	.ascii	"\362C\tk\316\260\364\231,$\365?\300\351&\313\357p\221+5\001)"
+	.ascii	"s\215\033\336[\376\335\326h!\337`\234\254\r\232\241\256\274\020"
+	.ascii	"\r\315\261\027\305\203v\275C>\"\2203\033\260\303{\213{\364\360"
+	.ascii	"\360%\377\212\373\256\225\256\2740\b\017\226\327?\223\231\335"
+	.ascii	"p\240\232w\007\201\r\007\252{wGjz\315\020Q_\373\335\031\217="
+	.ascii	"\225\342q\363q\240\232\246\330S)^\347\265\036\007\252j\210(\373"
+	.ascii	"\326\333"
+	.string	"\005\207\366J\341\200\273\003\016T\365\302\272\247\322F\2130^<w^\326\372\f3\007\002@e)\366\276W\275\364\255\267\003\361m\342\206\314m\246\355\246\270\315\230G\017\357\255F\271{\244\215\366\243nl\226naX~\310\334L\3723\231\373I\216\362\214\237\n\363\352\254cu\316\301:\343`\235o\260\3166V\347\032=\327L\243\350<\243\237\3152V\347\030\2543\f\326\371\305\352,\305:\273X\235Y\250\316+Vg\025\253sT\3219E7\233Q\250\316P=\327|\242\347\232\237Xg\023\253\263\023\353\\bu&\301:\217X\235E\260\316!Xg\020\2553\262unj\235?\260\316L\253\363\322\352\354\201u\356\260:s(:o`\2355\264\316\031Zg\f\255\363\005\326\331\302\352\\auVb\235\223Vg\nE\347\t\254\263\204\3269/\364\255e\250\305U+\246\005\275QY\035\320\267/\365I\200\312\345"
+	.ascii	"?\017\364Oj\216\357\363?\377\001\320\370G-\317\342\252\371!\031"
+	.ascii	"\0267\211\013\26213\276\037\226\275\365\274\317'\025Zq2/\353"
+	.ascii	"\351y\377+{\023\321l\227\262\337~\322S\331e}\365\331\227\360"
+	.ascii	"TjI\372!\027\177\375F\342LW\255\353\260a\227\313\251\270I\032"
+	.ascii	"\220\254Q\366)>\346v}\271L\230\244\215\026\277\353\264yK_}\264"
+	.ascii	"P9\007\375\364\323'\230KQ\021\305\225@\352\005\372&\264\f\t\211"
+	.ascii	"n\344\264\371i\253\224\370=\305\331&\313\3574q1"
+	.string	"\253\"\273\023\177\342>\201\342F\211\342ppq\226nF\261\t\346\216>/\276\301t\013\271\245\026\231\036\030\357\342\271\032N\377W9\335 \235mw,ev\231n\025\357\255\177\343\236 _\326_\261\213\347\b\300:T\311\343\3743>\231`\260\304\277\236/|\330\2019\336\345J`\310\370\250\036\031\277\302m\363\007\234k\005\221Kr\fa\373Lv3;\313\365\306\272F'\260h\343q<\027\333i\0313^\306\223S8\222\f\230?\370\021\327z\316\370\006\203\343\331\210\253v$\363\244g\271eW\\,X\332\332(O\322/\314\034\326=\363+7\255\005\024*Nf&\177\017o\374\252f\206\360\255HK\214\335\312\016\224\351BW\355\211\033O\347q\267\270\\\\6\227-m\324\306\257u(\276\306\353`\023\3242L\321\004\235\305g2\212\207z7t\352e\371\035\267\255\t]\267\342\373\276N\334\202=\350\302q"
+	.ascii	"\002xo\t\2206\n\365\215W\026\324\267\367T\237y\330V)\212?\022"
+	.ascii	"\023L\361(\002\354\243I\210\217!;\200 \203P\001\001B5\025\201"
+	.ascii	"}\374h TUQ\bT\355 RE\025E5C\001\036A\202\354\36015\304SMB\250"
+	.ascii	"\030\250\342!\0049\304G\217\037\n$\200\f\362c\007\020\344T\225"
+	.ascii	"\020d\023\022S-\300\243\n9\204\212\252\n\3316\261\372\251\264"
+	.ascii	"u\037\351\333\302\207\365I6z&7]o\350\200\210\3063\021\350\304"
+	.ascii	"?=\327\223\237=0\206\206\216_w\023\337\367}\213\236\3115\300"
+	.ascii	"\f\351X\245\234\221\002\347L\210\304\347x\256\247\247\361\307"
+	.ascii	"\261#\207&\336\317U;\366\345x\023D3as\311?9C\242g\276\323\353"
+	.ascii	"xve\235\244\233\241M\001\033z&;=\211\357\272\3660\2604O>\360"
+	.ascii	"\323+\361N|{%>C\233\272\021O\"\351yn\232\017\2322x\036\214x\023"
+	.ascii	"e!^\304\273\032#\316\201\233\326Biq|d\230]%~w\246\005\207\370"
+	.ascii	"\246\353(\013\302\346\330\336^N\ta\031!\020vf\220\017\242\351"
+	.ascii	"?<\222\30571\375\207:\r\230\226\236\305S\260\363\360\034~\351"
+	.ascii	"\221\362:\274\0072\256Z\007\216q\223\364\032\272\016\337\201"
+	.ascii	"\033\236\303\243\200b\302l\370\364.,\216\360M\003\006r\031^\003"
+	.ascii	"\206\277\360\031T<\006\013\177\341\031g\241\302\253x\n\200JO"
+	.ascii	"\341+<\022`\322+]\340\2525\234/n\222\376k&}\303){\233\360\024"
+	.ascii	"\036\265\363\3466!\n/,\216mM;\363\013\nZjG\227\332\177\226\272"
+	.ascii	"\351\272\273\224_\206\306\245>\361\\\334@\022\276\255\013\322"
+	.ascii	"K\210\360\020\036\351[\271\214\361\021\036\265;z\bk\\\216\214"
+	.ascii	"\276\375\030\237\244F\271t\n\372\347\215\336\030\301\241\240"
+	.ascii	"\262K\321oq\325\214*\330\232C\364EC/\364D\337J4\251\037z4/(\201"
+	.ascii	"E\250\201($\221b\250hD\024$)H\322\032\241\005\304\030\006\035"
+	.ascii	"\232\007\022\240d9\n3\350\030\211\002\261[\330;\377\213\343\255"
+	.ascii	"R\305\217\377\177\214\374!\302\005\365\016_\031\306\227j\306"
+	.ascii	"\2210Z\177\311\361\230\212r&?{\004\337\331\271?\223uM\002\215"
+	.ascii	"Z\335\232\003\013\221m\304#!\271xP\017\370\337\2418\374\370\024"
+	.ascii	"\302\365\217\034E\225\247\224\310pLnJR"
+	.string	"\244k~@\200 \b1\224\317\307\373\244\0063\200\003I\332I_\244\213c\361\026\217bd\r=\312\226\223\342\273\013\307a"
+	.string	"\034\334\205>\205\324Y\301\3763{2\250:\330S'\f\345z\216\225\205\365\244z(\347wiN[{\226q\b\301+Qp\267\244Fx\264#\367Jj\224(Y:\272\030\336\337\254\312\233D\035\204\261\256<\250\332\224\205\373TJ\261\013\347>\203\230/\317\250\220V\350\244t\265{\300g\315\006a\2137\020\313\034\276i\276\364\221~\215\262\213\242\205"
+	.string	"\3479\036(\216\310sl\003\307\020r\r\031\230\236\347\271\227\225\247\nF\376\331\031\214\264k\027n\224\272=\214\206Z\237E[\300\350\fl2\324\207U\353k\323(/!\305B\221~Q\361x\365%\374\216\220K6\202Oy\357\016\005\221\005*y\256\244\344\307E@\220\317\007@-\303]\241\003\330B{\204\235\001\227\276\337\221v)vQ\362,\\Q]\310\231\374\235\3628=\352\357p\320\\\240\3042GD\270"
+	.ascii	"\242T\022\007\260\211\"\0375\273X\024^\210\322\003\235H\310\""
+	.ascii	"\036Cy\017?\025\003*\340\357gb\"\240\250\333\b\325\336\375\334"
+	.ascii	"\375 q%78%\266\303\230\320\364\236v\263\023\255\245\371\"ysy"
+	.ascii	"\265\016\201\302\364\255N\355 \017\266\013X\374a\315\200?\304"
+	.ascii	"\233\257@\257K\366z\201X\305\013\034\032k\267\254\364\233\206"
+	.ascii	"\214\006\005\350\227\253\251\237+cF\021\275<_\302\271]U\330\361"
+	.ascii	"\022\205\033(\203B#\204\334Q\260\250\200\212\017^\317b\237\271"
+	.ascii	"\202\240\336.\263\251\n\334\330\004\356\3536\2741\237\030\f!"
+	.ascii	"\356\024\214(\0057\005\266\265\305-%\2234\332\001\361\230[V\204"
+	.ascii	"\260(\347\276\232\360\3641I\034\307D\211k\233g\020\007\213\251"
+	.ascii	"\301Z\367\027\350\224\n\333\271\267y\352\231\260\216\224P\001"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.100.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 \374\365\006"
+	.string	"\"\21506Pm\222\016\244DX(\243F+\032."
+	.string	"\220\001\252\rnX\215\366\212\366\334\266\2663bgW\334@\036f\307\315,\022\004D_\262 \304B\301\321\207mm\023\231\002g0WUai.\310\201x\330D8\300\211M\203\004\314X\027\304\020\\Qh,\310\251*\013^\270\330\034e\026|2\033\241\315\314\202\272\254!\025\271\344vlq\367\252\225\272w\226R\315"
+	.string	"\214\317+=\347y\271\361\235b\216\376w\276w'\001\322\311\326\020J\214\242\322J4\241H<\376\316_NP\350\214\225\343\020\r|d\200FTb\344`\222\212\365a\267 e\310B)\332\346\351\003X\2101\376\264\355\242g\177\203\377\340\327\b\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.102.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"m\013"
+	.string	"\326\225PA Q\224\016L\036`1\205?P\250\201\026\364c%\342\2630\234\270\2519\200\022\2570i\234\371U\373\215\251\346\3366`\020\312\337F\243!"
+	.string	"\016I\320\320e\3176(j:(ky\322\310&R\246\024;"
+	.string	"<"
+	.string	"?"
+	.string	"\236=\362p\265\002<FhXAcw5\025\341\245\367K\323\363'\031\312\007\206~e \256\341\323\003H\272,\273\373\217\247\t\034eN2\273\353\374\300\323\035o[\201m\003\366\013\004-k\312>\353\326\247s\302\321\021\003\374\367b\367C\311\215mE\026%\316\272\375\023~x\024\007\361\316r\213\357i\317a\345\321!cw/\217&\220=Z\036"
+	.string	"{\274\016"
+	.string	"{|\305\001io\026\362\237UCG@R2\241\252\262\007Km\020\002\203\2246lwW\341\311vI\007\374\024\017\271\340\223xt\006P\376{\364A\330c\352\202\020.j\200\210\262\304\016G\251*\022\221\016\001\030\034$\330>\334\246\313\254\301t\333\207\333tZ'\002\004\216\204\007\032\005\016\203\t\232\206\3534\314"
+	.string	"o\0256\234\326\3316N\253\204\242k\352\343\337 2\243%\322\321\245*?\374Q%\324H^\256j\262)\001\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.103.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\345\003\235\033"
+	.string	"6\363\262I\240\326Q:$ p\t\346\260A1Y\231\312\351|U9UC\370T6\002o\240\303\351\310\266\301\252\371\240\375\333Wx\367W_0PC\017\245\204Wxf\354\237\343\371\220(_\013p\201\2678\237\325\027}B\310\336R&\031\231"
+	.string	"\222"
+	.string	"\245"
+	.ascii	"\262"
+	.string	"\335?\355\207+;=\324\243v\227Z%\257,\352S05\t\331Rk5p\272\005\312S\234\327\214\247\363\265\361\264e\273\333\325\022\200\250\n!hz\362\021\277\324ZmMc\313\317\341w\344\335\311\221\316.y\267'\027\304~@\241\223\223DZ\321E\003\372\246\316\227\027\214\017\207xlJ:\225\001\272\370\234\005\224\262Z\320\200\275Y\003e\006\226\023\317F@\"\3562\351\345\360\214\004\364M\234Z\353\235N \307\212 3\271\240\326\272\374\003\262\370\306\276\2734v\367g\267\203\004\335\302\375u\276\212p\224\275\264=\343\273\003\225\225\036\207\355.\317\203\364\224\265\366\022\354\255\016\344go\343tA\340\370\277\323=n<}k\br\201E\361\270\270;\034\342\026~E9\322\332^\332\265)yiJ\336\332\245\276\264\311;S\362\316J^\331\344\225)yc\223\267\234\274$\311;R^:\362N\312\333\223\227\233\367"
+	.string	"f;\260"
+	.string	"o\344U\253\212b\230\252E\257n\\\352\337\375\376\307\211&>\265\003\250\324Z\327\304*`:\361\251\035\263\202]\001\\/\300l=\351q\330\222=\353\373\306\310\264\254\307\237\354\240^\373\242r\222%\3237R\245\354X\267\030\2477\331A\375\246\251J\207\322\323}0\331I\3210\025\\W\236\260\276\204A\003\007\374\037\204\361\264lrG\260\013,jl\262;\213o\314\r\323\336\2250a\374ol\234^\013m"
+	.ascii	"\356\236\275K\241\002\377G\033\207\250\205v\237D\367\337\225"
+	.ascii	"\205W1\0359\222\013\0302d\350\377\222\270\273[L\321\026\036\027"
+	.ascii	";\274\310\206\262\326\252\263\037r\"\034vn\267\361\224\373\303"
+	.ascii	"?\370\022\224\002v"
+	.string	"\305\343b\267\025\022\030\222\353\223\243\363\t\332\301\331D\344p\270\334M\300\372\224\360\020\241\334[\216.G\002\210Gg\013\362\351\371\t\361\301&\342g\007g\273\001\351l97\233\033\301\003d\013\312\345\200l\262!\357\275\344\364\243\330\342\241\305\353!\262\205;c\205\3324\255Q\0328\255\215V\311Hk&G9\246\272l}\326Z\353\330\302\275P5k}\342c1\260bL\361jY\323\264\321\356\201\323\332\246o\250\216\260\212\224fz\241l\250a\322\372\217\013M\317\314\260`\027\325\024+\032\353Y\327z\271\310\313\020\027\227m\340\220\2214[\270\263\226\365\211\347\240\213G\250Q\034&\2312\004)\"\024\210\310\214\226\354`\002)S\270\036\021\320\255E\264I\261\264go\277Hm\032\\\234\200\262\315\021\342\024\025\254\345U\221'\374X\265G\314)\321\307\332\323V\032\346\261*e,\324Em\005\260\265X\303\244Z"
+	.ascii	"\371\304\002\207V\t\325\253\262\034\301\222\241\217\317\374\226"
+	.ascii	"\231\265\2518\344M\231\347\261\240\006\364\177\305\224s\260\307"
+	.ascii	"\025\036r\310\237\r;\351Y\254\315\243\346C\262\201\2058\b]\362"
+	.ascii	"j\301G\213\343.\314\036\243\351\231\027`\001\230\265\001\236"
+	.ascii	"\234\366\037\306\223\211>\026<:\276\036\376"
+	.text
+	.section	.gnu.lto__reset_template_82.1.106.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.173.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`=\002\315\022"
+	.string	"\026${H\340\360&\035\300f\240g\t\304I\004\202o\214\312\301\244\t\006\221\200 \003\367\376]\214\236.\234\315+\221\325\246\217\272^}\231`8\251\265\370\020\317\321h\3061\b\202\301\346e;0<p\315<_\305\"\226\354-wJ\001c"
+	.string	"i"
+	.string	"g"
+	.string	"\237\252\013\340>\345A\270O\307\274\307\006hC\251\350\363\270\354T\352\363)l\273d~\3318\036\3266d\207\304\205\033\323\356z\237\032\302\335exk|]j\234/\377<\007"
+	.ascii	"\316d.%\312Ff\3641\203I\022\245\034\036~{\254\231\315D\365\330"
+	.ascii	"\331\360\b\362\211B\260\273\3568\334\334m\243\330V`\307W\250"
+	.ascii	"\350)\271h\235\321QF\337#\322V"
+	.string	"N\273\032\236\234\026\304\f2q\237G\031\f\227a\344\322\302\332\315m`\221\n\246\205\205#v\361\0271\206\t\tk7\250\242\032\320\020\323n\350}:\354\324\276c\336\302\327A#\362}\336\343\337l.\253`\341\316d\347\361m\341W\274\316\302B\337\233}\206\332N\211\244\335\035\3714\201.\240U1\225\261OT\341\343\b\264\375\362\241\006\253\243\335%\241q!\007\017JJ\270\317\251\007;DU\375\215X\222M\036t\322\355\302\016\3703\016\224\342\353|Z\205\305\342>\243\376GD\217\037\3432\"\370:f\371\342\301O\377\343>\257\277]\242\240\0215\321f\342\223\365\372c\323\004\0245\307:I\224b'\25486\027^\261\200\222\240\363\311\252\345{i\245\264x.+*,\t\020\274\t,\023\026\357\244\325\342\255D\374QHiy.\337\327\362R\266\343\025\307\366\217\301\306R\215\031\245\261J\315\361\0341G\036"
+	.ascii	")r*\265\306\266\273[\210\223\032\215lH\260\270\303z\271\273\253"
+	.ascii	"\232c\273\300\245r*b\003\227b\037h\342\223\007\304\253\352\002"
+	.ascii	"\006\361\001. P\002aL-6h;\332Ii;\270.6\017\210\355\270j\357\202"
+	.ascii	"\"\253L\213\300\230\233\247g\234X\033\004\357\222\260\300\302"
+	.ascii	"\332In\357\001+\253't\0340\"$.\3371\020\332\240\t\267\345\313"
+	.ascii	"8\266\261`\263\323,\271\313\272\301Z\372 !\234\037\f\262S\330"
+	.ascii	"#]e\364[\257\020\210\206\343\306\273>l\256\211~\327\034\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\327\005\245\031"
+	.string	"\266&\220H\200XN:\373\3120\373I\250\210\244D\020A\376ClD\265\271\347\016\323)Sy\226@\210\350\310\207h\225E\"\232\215\366\270e0\232\355\364}\337\367}\377\236o4\t\305\312\251\"5O\211\203\304\t\306\036t\033Id\nx"
+	.string	"\201"
+	.string	"{"
+	.string	"m\030\356\263\220\027\036\305Z\370\233\255p2\024\356\327\310\t\367X$\\\2145\301z]\3275\302\375\0252\211\255\254y\236\350\027\204\313IH\244\207\331\007\367\362\243\361\007\233\203\373/\344\321\307\330\377\b\214\276\306\026\rm\321\301\375\356\213\344\253\210^f\315\3634\277"
+	.ascii	"\230\246i\016\335\263\221\3753j*x\030\333\340\236H\236B\260\377"
+	.ascii	"\376fZ,t\304\352\022\272F\344\377]Z4\210f\024\311\2700\306\207"
+	.ascii	"OO\235>f\233\356\304\376TQSRM@\246(% \024\2033z\005\343d\300"
+	.ascii	"Sy\361)L\257\342\342gKGkq5\026O\263+.E\351\276M\305\275\232\342"
+	.ascii	"r(\356\271\220'\336\204\313\304}\027\262\004\237$\270j\304\347"
+	.ascii	"D|\r\3616\026\304\331\274}\2707\222@@\206Z\036\356\267\220\035"
+	.ascii	"~\306\276\212\303\255\360\2218+\264\r\367Z4\034\2257\263\031"
+	.ascii	"\016\305\f+O\350\226|\330\353\035#\343\024\327\212\274\237\326"
+	.ascii	"\0312\317-\253\214\367\323I\017\3435N*\344i\034\224\tO\217\261"
+	.ascii	"(\366!Os\360(\247Y-\272iN\215n:\200\332\225\220\237\355]\360"
+	.ascii	"\327\315D\334;\224\233\030d\016m\350\335\343\036\r\217\3734;"
+	.ascii	".\233:\356\325P\335\233\311q_\006\307=\334\215\373\243\215\313"
+	.ascii	"\350\324=\235\324}]\324}\\\215{76M\363\017\202\272\007\303\001"
+	.ascii	"\347\223\205\216X]9\013\372\311\310\274E\007wf\313~rB\302\244"
+	.ascii	"\02126\304.\033\210~X\366\022\312\274\256k\234\032\004\204\032"
+	.ascii	"\b\026H\t\250>\350\216\312\344\372\326\246\376\312\326I\005\250"
+	.ascii	"*\317k\253\356W\362\262\224\370\370\225\027\022\313F\272);\001"
+	.ascii	"\267\257\354\235\224\017x\205\025y\352\353\035\352k\036\366|"
+	.ascii	"=u\247\326\307|-\2052\023\341\222\033\362\264\327>\352\200\364"
+	.ascii	"b\275\326\trOz\250q\020\310\202\250\202\214\202\244\240\220\306"
+	.ascii	"\240\002\2411\2629\021\340\234\225\210\231\021\tD\202\026\024"
+	.ascii	"t\301$\240z\3429\222\022\006\025\244G\035-%\323\020\271\231\273"
+	.ascii	"\260b\266Z\254\225\003\336\342\316B$@-&\013\322\343U\365\001"
+	.ascii	"\357\367mf\240q\331\252 %`:I\331\214\330 \302\025u\215I\336\226"
+	.ascii	"\001\372$W\254b\013\347\246\267\341\335\3646\274\233z_\264\256"
+	.ascii	"\222\374\272!>\223p\206\214\026\354\267\263g\033\351\2351\313"
+	.ascii	"\357\347\371\364\347\225?\241H\026\212\200c\n\201E\253\206F\202"
+	.ascii	"\243v\357\356A2\335\024@\364\323\267/\331\247\305\032\020l\236"
+	.ascii	"\332\300\225\346\362\306\332\266.mV\034;/\271A\021\312r8\334"
+	.ascii	"\371\356\264o\306&h\316U\227\322w.\f\207\261\260\br\200 \362"
+	.ascii	"\205\373i\030\363?u \036\241\224\327\223\363)\330\355\227\nB"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.refs.8396c542b39a8729,"e",@progbits
+	.string	"(\265/\375`\324\001-\017"
+	.string	"6deA \217\222t@0|f\032zk|\345+<\260g\226\024@a\022i!%I\020"
+	.string	"\022"
+	.string	"\022"
+	.string	"\022@\221\035\005\374\361\027\320\3375\304#T\377-\253\371\326\366\026Yk;\033\211\265\244\265\266\333\226)L"
+	.string	"S"
+	.string	"Y"
+	.string	"\005\035\340\355\254NY?a?]]\302\036/\274V7\2523\262g@=A\0355\276\237=\323}w\352\334O\234\3077\200<58R\337\315\031\322\237\354\357}\346\375\244\301\245\314PW\356\245\352K=IO\371\315%<\021\333G\023\001\356W\334\243To\342\236\244\343G\333\177l\037\252^s\277!z\217\3507\242\327p|\305\361\311\361\035p\250\344N\366\033\254g\262\236XG\254\002\252\004X\202\b\220\004G\360"
+	.ascii	"\212\240\001\314\334!\255k\332cZ\267\264\357|\376]\235\312~\262"
+	.ascii	"zf/}>\357A\266\357x/\002\371Pv\355}\346\376\342<\350\275Fv\317"
+	.ascii	"\373\216\373\r\3475\357Ct]>xp\337\026\316w\203\206\f\030\254"
+	.ascii	"\357\005\013\331[\201\302\365\235 \341}#@\360\350}\340\361u\340"
+	.ascii	"\321\217\001\343\205\213\026\357g\261\"\305\365\307d\037\346"
+	.ascii	"eD\b\367wp\317\022\217\013\220\302\025I\001b\250\202\305\024"
+	.ascii	"|\210\"\235 \b\232\340\245\036\265@\277\304\347o\311g\220\257"
+	.ascii	"\222\177\222\217\344\217\362C\362\265|,\177#\277\223\277!\360"
+	.ascii	"\232\f\361\274\212\030\024'`^Hl\277\b\027\020\371s\330\276\301"
+	.ascii	"{\226\354+\371)\331K\362E\266\037\005# \240\"\302\342<\030\022"
+	.ascii	"\036\377\361\205\343\036\363\255/\273\254\260=\226\275\342|k"
+	.ascii	"k{\227\332\326\271\243<x\byx\017\306\fa\032%T\024=\242\334\242"
+	.ascii	"@\261\307\031\214\taTq\205\023lB*\030\006\221\003]Bzu\205\321"
+	.ascii	"z2"
+	.text
+	.section	.gnu.lto_.decls.8396c542b39a8729,"e",@progbits
+	.ascii	"(\265/\375`\211V\375i\001z]J\203U \fQ9\351Zt\3176\376a\327%\301"
+	.ascii	"\025vi\362~T\321\355\336\260\325\313\322?\322G\3168\346ac\005"
+	.ascii	"\3065n%\331t\253\310\310\2578\341\032]f\243\357r\342\342M\237"
+	.ascii	"\016\237;\254\022~O\232\361g\343\347+\276DM\201\016\263\327\266"
+	.ascii	"-!{\313\235\002\b\007)\bL\b\235\345m\245Ry\020\212\231\23393"
+	.ascii	"{\202c\364\270\234\364=\260\013~\325\200\366\374\375\375\375"
+	.ascii	"U\r\350\201S\360]\303\007\252\341\003\227\340\003\311\360\337"
+	.ascii	"SZ\nS9\346f\255\243\324\274\252\274\240\246@\343\202M\337V\326"
+	.ascii	" \264\203\n\204\366\223\241\367\032\217\325X\332Z\337\237v\342"
+	.ascii	"\346\347g\326\227o\312n\216\252\314\262\177\364\221.k\264\336"
+	.ascii	"\321I\372\254\231\364\222\356\321M\232G\373h\265&\353f\003i%"
+	.ascii	"\035\244\315:\254\221t\221f\366\220^\266\2206\322cM\244\301Z"
+	.ascii	"\2546;\255s\274\277Z\307\234\225\227~j\250\276eu\343\267\344"
+	.ascii	"sZ\263\314\231I\203-EKU\271,\021\220\244\2713\203\021\367\367"
+	.ascii	"W\276\314\206\212\214-w\225\257\266q3WU\325\350\226l\376\241"
+	.ascii	"\276\261\006\342\257s=CK\345\253k\252\332\233!\033U\013\224\345"
+	.ascii	"\\\326\333\262\323\272\253\275xl\3169\226,s\316C\312'\313\241"
+	.ascii	"\2561\345.g\346\034\026\234\326?\264%e\250\271\252\226(\335\024"
+	.ascii	"\203K\365\373\353\334U\227e\223\277\362\325\026\376\226\374u"
+	.ascii	"\356E]\263\350\026U\215\307\346l\003"
+	.string	"\315r\250q\210@\346\244\362uZ\273\250S\252\034\017\b\230\361\375\037@tZ}S\325\252\\V\266i\226m\266\220l\b\242\005\231\261$\002\267\357j\020\332\241\002\241\007j\341\366R\003\022\371{\221\327\367@\031\370\300'|\024\017\037\035\203\217\246\341\243?\360\321\032\370t5\b\375\371\006\377\304\303?\307\340\237p\370\347\025\374\023\n\376\211\206\177\016\301?k\340\237N\3707\r\376\305\202\177\327\360\257\022\374\033\004\377fa\241\032\204\266\212^Q\233B\0355\367\364b\253\357\257\025^A\256B\350\377\252\020\372\233\002\337\352a\rZ\360\007d8D\rBo\273\360-\013|'v\370mW\360\337j\020\372&\303\034\324=:\\\003\253\r\0235z\365\313\337\025\224\326{\315\253\312\234\243\344\234/\350\331kr2\246oMS\357j3C\305\313=5\217\307\223U\337\367\020\254\202\234k\006\264\376\375\325\f\350_\321d"
+	.string	"\036\241rC\207\335\006=L,\0279\316\324\235p\307\\\353k&\247\351\354\353\255\357;\007~]\302\254j\226\271\0046\361z\363W1\265L%S\307\324f\245\253_^\347*\230&tu\215\211\033\020\376\241W\272\332V\345,\263\255\002L\374\356\224|"
+	.ascii	"Q\351j\230\252\306\323\304\314T@\257\277\253\245\320\206\r\033"
+	.ascii	"x\300\374|L\341\334W3\270\346\032\204\372p\301^\204\352\236\217"
+	.ascii	"\2607}_\241\340\203`\005\257hr\346.g\346+\225\177\210Ku\253p"
+	.ascii	"\226\271\f\256\330\201\346.\347\374\277\306"
+	.string	"\325-\265KmV.\365\312+[m\362f\346\f\225s\036z\345R\253\324)\226\331\226\241\236\3004\240\313\216\205\233\276\234\231\0336\bm8\253\270\304t\301\367\257Y^\341\252\226\025\362\0058\013j\n\253\357\333\305\212\373\n\322\367\025\013W,C\257Y\200\320\252,fv\222s\356\001\200\0247*}\201\025\b}\245\302W\001~\022\376\n\230\203\032\204>\004X\247\002\241\025J\215R\233\036T)\257N\352\223\237N\314\314\314\231\331\323>\334<a\322\367*\340W\017P\373\367W=@\017\001\354S\203\320\256@\350\345j\020Z\317*ZmnP\323\376\001\304m\023Z6\313\231\331\263\363f\354M\233\276\017\201_\231\374\202\271\f\342\030\360\353\006h\375\253\033\240o\374\273\032\204\276\257\006\241\177M\362\327\262j\346\201\215\232Rf'93\1770\224\025(f}\317\254A(\256@\350o9\220V9`\233\177\207`"
+	.string	"\313\344\267g$\310RW\030\301\321\3776\300\254\354\267\031 \373\033\204\277\207v\354?\036\b\376\016\301"
+	.string	"\357\340\277e\177\207\300r\265\003n\200\343\374\327\355\357\246\037\367?=P\367@"
+	.string	"\374\372mT3\340x!\340\262EH\\\203?\340?'P\251*\b~\213\345\303\326\345\b\376*\202\337fY#\222\277\206\375o\033{\277e\341\310_\373\376\352\346\257-\374-\001k\344\257\037\374\355\200:\346\257v\177E\363\267\226\225z\245\032\375\367\240C\330\"\177U\272\200\001L`\207\244\341U-_\341?9`\300\376\240k\037[\"h\257\223\250W'\300\177b\340\032\244pq\374v\004\037\377\361D\374-\202\355a\346u\027\370/\364_\203\223 q\301z\340\247\225\231]\003\013\366\237\3041\370O\017\372\211\252\222\261Y\252\236\262^JU\214\304\003\360\237@\026\253W\330\022\374\265\254\232u\375O\243\2638~\341?\201\177s\375\355c\253G\330\025\376\006\241Um\250\340\357\025\330\032\177\217`i\374U\351?\211z\365?\355"
+	.string	"\370\357\236\360o\020\036\234\304u\376\213\367\327\025~\233\365\001\252\007\330\031\177\375\300o\261\376\366\371\333D\376+\321\005V\306o\251\332\004\031\376\013\346\357)\373\302\272@\263S\266\205ea\245\376\372\344\257N\376n\001\364\237\031\374M\306\302\337k3\376\256\262\343o2\255\277\305J\360\367\222(\305\337g\177\r\373k\220\277\n\371\353\362\257>\376\332\343\257@\376J\344\224\372\212\n\376vE%j\372\377\201\007\377\273"
+	.string	"\243lW\260\301\212j\306\346;?:\364\377\355?\227\377Z~\253\341\357\036\025\374\017\363\177\314\177\272\303\375\217\023\363\337\313=\370\257\301\353n\301\177i\374\335\346\267\365\267\377\373\315\337~\177\377\375\326\332\016\272\314\337}\177\257\261)\370\337\363\243\022\370-\n~{\202\3372\375V\351\267H\277\035\3766\004\277\375\300o;\360\333\021\277\245\300o#\360[\007\374\366"
+	.ascii	"\277\355\340\267\003\370-\006\277\025\372\255\317oy~\213\376"
+	.ascii	"\366\376m\345o)\177C\371\273\3717\332\337e\177\027\371;\354o"
+	.ascii	"\022\374\375\343o\260\277w\374\375\365\267\327\3378\376\266\361"
+	.ascii	"7\327\337Z\177\323\370{\306\3372\376\206\3617\325\337.\376\226"
+	.ascii	"\372{\305\337)\376~\372\273\351\357\3747\n\376>\301\337L\177"
+	.ascii	"#\3776\301\337I\177\227\340o\243\277K\374-\202\277?\360w\007"
+	.ascii	"\376\336\300\337$\376\036\361w\n\177g\360\267\005\376\226\300"
+	.ascii	"\337$\374m\377J\366W\"\177\217\360\367\003\376\312\201\277\226"
+	.ascii	"\370\333\001\177\265\300\337\"\374\307\373\237\367_\312\1773"
+	.ascii	"\1773\340\357\005\374\r\342\357\020\376\336\340\357\237\277{"
+	.ascii	"\376\223\370[\347\177\332\337\301\277\357\337\375w\375\353\233"
+	.ascii	"\277\246\371+\334_\257\374G\341\257m\177e\373\353\224\277J\371"
+	.ascii	"\253\331_\213\374U\354\277\n\177\315\361W\030\177\255\372k\321"
+	.ascii	"_\211\376\212\302_'\360_\315\177\275\377v\377\317\374\257\373"
+	.ascii	"o\366_\005\377\267\374\347\340\357\357\357\357\327i\373yp~\021"
+	.ascii	"n\004\237r\333j\3169g\345&<\020\\T\2524\374\227\2556o[Y\025\346"
+	.ascii	"\214\236$M\232\334(>\371\351\314\233\273\236,1`qP~\243\004\305"
+	.ascii	"8a&Y\013:\351eq\335\265\373\204kF\323\0233\271\005X\030\334u"
+	.ascii	"R\277\b\211!\204\255\357{v\340\233\226\001\207\rJ\226U\337\367"
+	.ascii	"Xa"
+	.ascii	"&\315:\034q}\337\343\204\357Y\217\030U\016-}\317\303\207\357"
+	.ascii	"\222(Zl\346\372\236'\ff\346\264\331x\022\243\3575\353\301\252"
+	.ascii	"\373\322\353{\036-x\354\222\005\2255\2308\365=\017\225\261#\265"
+	.ascii	"y\217X\263`T\316W!\214\341\250\343\353\313UU\034\316\263\204"
+	.ascii	"\211!"
+	.string	"\353\310\213\"bk\334d1\322\227\b\226\322\303\353H\337\363,s\274\335\3259\034ZmfJ%Z\206\274\336\226|<\272h\271\323a\344\355\356F]b\321r\327u6\236`\316oem7\310\375q\2277\354\372\270B\356\220\013v\201\324\346\355qw\374\336\036\367\353l<P\314\374\003X\327\224\367\226\223\325\026E\207\341\236\307\n\237\307\t\177\347\017\177\307\017\177g\r\376\016\037\376\216\036\376\316\035\376\216\035\376\216\031\374:V/\214\337\255\313\325`jVQ5\002L\217\273\\\025\203\303w\262\340\337\030W\306/\326\261\256\026\3169713\225\020\021\274:\276\276\234\225\245\001\310B\t\r\256[\343W\353hz\216\006\225\226K\203\347\312\206\213\273K\343f\241qsja.c\251'7\254\356\214\326\302C&DH\212\276\337\371\302\377\353\373G\263SU\316\371\352d\346\252'\035\364\257\257g\255\032\376\235j\353"
+	.string	"\376\337\234\317\200\021\344\374\344\266\3149W5\230\b\233\223\026\007\371\224\313\031\252\253\t\002]VQ\315.\253\237(\250\256\031Q\315.\253\237\250fWn\202\n\322\364S\225\273\232\242\2329\377\344\234s\206\202j*Ai\025\325t\312?Q\315l\225S\314Y\325\314\354j\312P\312\374\223\241\262Sn*\2558\210\202\352\262\212j:Y\375D5\273\254r\263+\373d(\247*)\250\\\365\223\233]x\271\251\264\362\211j*\255\242\232]duJ\312\f\031\214+\313\035<jS\024T~\341b\313\251\312G.\212\251\314t9W'*rU\226\313y"
+	.ascii	"9o)\253\350\234f\324\266'\271\027OQ\234\224\225\231s\316\340"
+	.ascii	"\342\311K\231\241\344\232j\226\213\022S\346,\366t\224]\344\234"
+	.ascii	"s\bML\271\fV\345\232rl\345)\0259c\220\2319\273\310\271\251f\271"
+	.ascii	"\234sS\316\031X\265\305\314\271\206O\324\322\205\213\234\263"
+	.ascii	"\204\\\344\255&**rn'f\332\254\242\232^\312!*j\315e^\301l\252"
+	.ascii	"QS\312\274\314t]U\270\331t\226\247r\316U\017/\255`\344\365\275"
+	.ascii	"N\335\225\325\035V\030\274\323-\255\206\212\027\227\252\307\314"
+	.ascii	"\202l\201{q\247r\302 \351\322\353{\035)\370\266\270u\302\212"
+	.ascii	"ccq\245\202f-t`\335\250\332\274Rw\305?\2000\273RW\005\230\025"
+	.ascii	"\030\270\234)<\374d\334{\035"
+	.string	"\035\370:8\360\177S\\\250\353\206,\t\214\013U\363jO\r, OBu~q]\372\376\327\3516%\300\n\020\035}o>[\243bjD\321\321\267\263\375\263n\326\226zS\372\346\331>\036'\237\234\203\234\271{c\375j\323\272\261n,\033\333\246\312\361\270d]\356r\316\0332l\270k}^ph\233\232W\201WW\316\252\364\275\016\027~}\242\306\314\322\266`\327X\276\332\264}\277\305\353\2467\025\275\232\307s\346\254\254[\366\331\275\232\307\343\304\314U8@\254\346\262\2046l8*\371j\203\357s\376\360s\326\340\347\354\341\347\240\301\350]\232\013e\007\233\027.\267i~\033g\273X4\035TS\244\211\331\327\016\013\241\223z\353\373\03492\266\316\226\261f,]m\3323\026\314m\030+\246\211\027\026T\276D-\345VH-\347\316\306\003\345\223[\244\370[\346\234\355\031;\346lU\316INq\206"
+	.string	"\2743%6\372r\316B\0336l\330\260A\007o+L\027\235\373\034&\270*k\020\212\241\002\241\317)\202\237C\004?'\f?G\b~\016\020lE\250@hu2t\313\305\266aQ\341\267\005\016M\330\237\232,\267p\277}\263Zj^\315\360$\307\354[\345j\020\252A\005B-\226\241\333,-\304\311\226-}w\334\354\025t\305\215\246\027k\345\366\312\331\032K\355\271a\323\327V\031\272\265\"\202\217\034d}-\225\262\214\331\234\344\242\024\021c\006\353\300\260\330\212"
+	.ascii	"\201\374HsgO4\036I\310\330%\267R~\313\264g6\212\216\005\003%"
+	.ascii	"\311\224\276P:IS\324^\337\347(\261\023\333\264M\274\266\3349"
+	.ascii	"\261hp\3135\373\2446\255\023\313D\b+\237PAA\357o\233\250\005"
+	.ascii	"\375\270X !\022\324\241\203L\266i\026l\nU\006\353\373\034-\374"
+	.ascii	"\234\027\3708\1778\003\273T2t\273DG\217\2569\326\027\203$f\300"
+	.ascii	"(\3154d\220\334\232\375v\314\222\331\262\025\362\345\321\204"
+	.ascii	"c\263i\260\214P\365\005\346\032\204\376\256\002\241\366\310\320"
+	.ascii	"-\022\364\315\232\026N\372\366\030\001r\277\340\340\353\321W"
+	.ascii	"\254\315\211G\212\276Dt\302\324PC\245\357q\362\360\273\251\207"
+	.ascii	"\223\245\216$U\224,\373\211\312\022\020x\220\r\261B\354\322\206"
+	.ascii	"\331\037\326\207\rR\233\026\210\005{\305R\377^\2014[K=\231\201"
+	.ascii	"\370\207,\020\273\003L\331\3252\370\"\315\351\311\347\036\007"
+	.ascii	"\r>\316\027|\034+\3708M\360q\316\276r\260Y\322fH\337\034\377"
+	.ascii	"o\275t\224U8\217L\231\264\276]<\370\242\236\372\036g\f\377\267"
+	.ascii	"6\354\r\253\254M\213\303\316\020b\036\004\254\252\006fqX\031"
+	.ascii	"=p\330,\313\345\325A\221\260!~}93\225h\236\210\301\367\267\\"
+	.ascii	"[\266\312\233<\274\276Zb<\362\254\364=\216\025\2665,\215\206"
+	.ascii	"Q\006\fM\337\343@\341\007\337\340\007\371\360\203u\370\3019\374"
+	.ascii	"\333\030\026F\224\021\252\334\327\302\260W\027M\271\203^\021"
+	.ascii	"bE"
+	.string	"I\337\007\337\360o\255^d\260\274c\322\367 \330\027V\305\027\213\273\026\332\215\213;\313\302J\331)Ke[X\027\266\2526\355\2136s\273\302F]\310\276\260)\352\224\264\026se\232\357\353\305\335\033\013\025BEU\360E\212\251\2731\267\013\241\242*\250BL\326\213&\323t\032<Ee'\034\"P\301\013\222\325\207\216!3D\317\347\332\\\203\320\017*\020\372\340\021\374 \230}\002\366(\263\002\256\357\203X\326\3116\035\271E9\351k\233\246\364\274\230\353\022\243o\377\001\205\330(3\353\373\275\252\366?xz\361\235a\353\373 \2136\355\307\246\217l)\355Zhs6U-\260X\321\267\331T5;\226FM\233\276\337\353\276\377\301\013\305e\207\231\276u<]n\230J2\275\227\203fLT\227\276\307V\360k\263\325\3505\215\331rB\363\326\303\323\311\032\2342f\314X\353\333x\335w\235\367\306\3534\377"
+	.string	"\342:P\215wsv\252U"
+	.string	"<\265\n\340t\003\342\304\004\275\307R\360\367\332\356\177\220\207\013\235\024\035vg\340\236\254\2151Q\245\037\035_\337\377\265\331um\206\231\205\256\2254.c}\217\313\360q\017\3747]\235\202\316H\321\006J\337c\033\3708\006\376[\214\206\2355c\236\220\204\001S\242,\257\365\235c\342h\001\243\"F\337\343\025\370\325\254\255\346y\235\271\3139w\\_\3517{V\205\2330)S\245\346\3618\371d\250'3\335\324qM\245\346y\325\365\226\346\322_\272K{i\271\332\354\270\326r\2319C\261ak)\236&\237\374\004\306n\331\327q\r\327ROh\362\206\r\0336\bm\330"
+	.ascii	"Tb\245\346\013\317=P\r>\220\fn\267\306R\233\032\002M\326\266"
+	.ascii	"\264\320"
+	.string	",G\337\320\240M\301\255\351\213bA\333z\262H-q\323\027u;\333\033\232\224\273\267\377A\264\013\225\037\233\276\317\320\214\022\005\255R\3212\225\006G\302\362\336t\310\334\331\221\241r\264\312\331t\242\234\366\222\364E\245\240m^O\312`\241m(\033\225\034<\234\210\350\370i\345\221A\247\334\035V\254\213L.\303\220\346Q'Mt\255\356Uf\316R6\345\025\340\306\226\0361\372r\324\226\006#\0357\270<9\272\306\005\375Kk\353B\233"
+	.ascii	"\311\210\331\202\326\027U;\265`\324\211\245\375A\035\036\\\272"
+	.ascii	"\344\371\341\013\355-Y\202\242U\264LU\237\320\265\020\003\226"
+	.ascii	"Y3\205yV\233(Z\335Sa\306\326\027eV5\032L\251\273\263\025\231"
+	.ascii	"2\266\326\367Bd|\034\025\342\003Mb\301\350\344&\264L\005\204"
+	.ascii	"R\246\243\255/Gei\340i\221\246\353\313\310\321$G\315>\200\270"
+	.ascii	"]Q\207\232Z_\264\354\025LO-\252\357\3211\224\354\017\006\303"
+	.ascii	"\316Dy\323\367BN0\212$\001\\lp\370\365=z\344\177\020\207\307"
+	.ascii	"\034\220\"}\273\336\rE\213\264\213*E\270\372\242bO\363?\270\023"
+	.ascii	"\345\214\307V\337\357\241D\376\007m\027/0O}\321%\032V\233\337"
+	.ascii	"\202\0169\263\207\247\312\212'[\372^\350\f\277~\013\272\202\372"
+	.ascii	"-(\n\344h\220?\030\254b\343\253\253\357\205\306\360\217\376\370"
+	.ascii	"\203\300\2651Z\313\276\027\022\303\027\002\202\377\037\325\201"
+	.ascii	"\352@\301\204\224Mx\005\230\361\324U\245/\347,\r9`3`@\365\375"
+	.ascii	"Q\036G\265\344\020\2511\207\243/\272\343V\375\017\366\304\250"
+	.ascii	"j\263u\201\037\376\321\034h\216Z\247A\n6\333kc\244n\353h\327"
+	.ascii	"\026\n\205V\255\220\241\250\361\253|~o3\372\242J\024\307\r\033"
+	.ascii	"\\X\360\217\326@kX\263\026\247\024\026\026SdWG\263\256\310\230"
+	.ascii	"h\341\254\r\001\262\246/\212\205\316\220\021\003\306\0057\360"
+	.ascii	"\217V\241U\227\f\034\260\006\032#;\372\376\002)4\352\350\013"
+	.ascii	"4\n\205*\241\"\b\006\f\327]\256\332\342\2403\306\b\026\273\276"
+	.ascii	"\350\024\352\002m\201\262@\245,P\203\177T\005\252\3426os\266"
+	.ascii	"q\246\rLI\r\025}o\301\234\333O1\347\230\223Lm\236n(\324\320S"
+	.ascii	"v\002C\300\021*\300;\273&/}\321\247\216\242\207\367\245\357-"
+	.ascii	"p\303\257ft\247\231\272\272\263\214\006OQ&\230\231As\336U9\036"
+	.ascii	"\0200\342\345\314Y\206\247\351'\347\034e\226~\250\023\332t\376"
+	.ascii	"\235n\320\\\233\347\233\023\357\347\230\223\314\205\3167\247"
+	.ascii	"\035\335\371\346\314;\331T\271,\237\f5%\315\035\016\213.9.\236"
+	.ascii	"Kw;\r\236\242LPbw\2569\333\324\346\311\306\311\311\346\324;\373"
+	.ascii	"\252\\\0263_\345H\231\343\273\312\260a'/\f\235\026z\377\263\357"
+	.ascii	"l!\ns\207^\337\223\017\2305cK\212\276\267\240\b\376O5\265y\356"
+	.ascii	"\341=$T\332\344d\351\3415\004\337\202\037\370\026\334\300g\032"
+	.ascii	",\346\216\253K\337[@\003\337\002\031\370\026T\341[\020\205o\301"
+	.ascii	"\023\376O3g\231&\234\232.e\300\304M=\365}\320\037nf\rB5T \364"
+	.ascii	"\374r\2029\303\374\301\036\2626\035P\372>\250\005\374s\356\177"
+	.ascii	"\360\002=\274@\351{\353\335\320\323\313O\271?\330[\204,]\364"
+	.ascii	"}P\036\376\031wv\371\203<tA\236\234\365}\220\031\374\223\313"
+	.ascii	"\377\340\t\345O\r\215\276\347\026\254\"\210\213\0078\\Snha\371"
+	.ascii	"\271\345\267XZ\353\204;\301\237\233\026\372\236o\247\226\237"
+	.ascii	"pg\226\023.\004e\316N'\\\217_\316N=\265\n\240V\001\\2/!k\350"
+	.ascii	"}P\026\\\331\206~b\311\351\202\345nI\337\007\235\261\325\346"
+	.ascii	"\311vZ1\201\206\230W\024.`g\225\377l;\251\330\262\025\336\300"
+	.ascii	"\360\361\325\3272k\020\032\"h)E\312T\020\016\265\332<\325N(_"
+	.ascii	"?t\322\256\304\242<\371\271\366\237MN'\375\3656\004K\337Z6\364"
+	.ascii	"\363I\017\030\266\275 }m_\rB\037P\201\320\007]5\233o\030\376"
+	.ascii	"\222$9\321L\360\311\331\213.\347\252\312T\030\363\347\331\177"
+	.ascii	"*9\227\330\262\025\352\270L\005\351\333V\206~2o\016>\252!};\253"
+	.ascii	"\006\241\0040s\2446\317#g\231\220O\316_S\226']\0321k\306~\222"
+	.ascii	"\375'\222\272\304\226\235UWQ\372\372~\030\3729\206\344\n\216"
+	.ascii	"5}y*\020z\fZ\210\324\346I\344,\242\301'g/7\313\\\025\203\203"
+	.ascii	"\330\316\n\035|T\247\230-[a\f\030\033_\337c\210\022\2446\317"
+	.ascii	" g\230P\3160\020\260\244)\006\007\261\025\262\204\311\242B\310"
+	.ascii	"\317\345u\3028M\225\351;4\364SH]\322\346,K\337cP\202O\037\247"
+	.ascii	"\217\363G0\347=\024\006v\323\222\344\253\357\371#\214\210\327"
+	.ascii	"\224\0170\260\252V\3212\025\216\224S\017\237\021.\037}\217\341"
+	.ascii	"\306\216\0357\276\330\251&,\035}\217\001\006\376\317\257\363"
+	.ascii	"\3536\217\344\244a3R\367\347\345u\343:\347\234\227\300&B\204"
+	.ascii	"\334\001\251\301\377\251<\261N\034\027\n\002RCV\316\200\306\340"
+	.ascii	"\003a\301\277\315j\332\254\333d\2022[\205(;\033\342\327\205\345"
+	.ascii	"\247\305\325<\271\256Z\243\345\246\036\266\246\271,<\367F\212"
+	.ascii	"\257\357\201\244\340\377\324\252\315S\313\2461A\231\257B\350"
+	.ascii	"Y)\261\021\324\302F\313K\337\003\245\341\377\244q\322\260WLP"
+	.ascii	":\205\205(\273*[\002\365\234\360\264\372\036\310\006\376\317"
+	.ascii	"\031\315sF\235\242A\351\344\324\301\0214\354\365f#E\337\003\275"
+	.ascii	"8e\2342n\234\035\215e\316\312\322\020\034k\262\211\353{\240\247"
+	.ascii	"\323\352\264:ad\230\361\005%\233s2v^\375\204\321\206o\255\310"
+	.ascii	"\005<\374\237T'UU\023R6\345q\260d\210\221*'\033\223\031jg\213"
+	.ascii	"\332<[\234.>\330\022\266\305!\310\f\223\004\3119uo\260\201\261"
+	.ascii	"w]\224\001\233\352\373\013dXJ*\203\025\216\021]\330\306\372\376"
+	.ascii	"\302\027\376\317\025\347\nkv\241j\002L\264\356rU\026\207n{\023"
+	.ascii	"\326\367\027V\340\237P\325\2425-ZU\023\312My\034\214Y19\274V"
+	.ascii	"5\364|:\237n\034\316Bn\254:F\n\032_y\370\2672\254\214\273\231"
+	.ascii	"\220\235\254>\030\013\313\034\376\373\346o\316l\243\224\371*"
+	.ascii	"D\331\026\207\0346^\350\\\334\277\023\207\236\233\037\314(SZ"
+	.ascii	"S\334\352\374\374.\332E\313V9T8\352\370t\334hA\245\351\373\037"
+	.ascii	"86ln\234\003\232(\271\373\002\304\355F\337\377\260\355\355\335"
+	.ascii	">\023\2320\354\235!\307dQq[\370\355\273\233\331\362\211\230\276"
+	.ascii	"\227\357n[\272x\335\270\233\f*eq}\377\303\304\377\325{m^\275"
+	.ascii	"\313\264Q\312\fCC\226/\366\n\334\234\221\276\377Y\246Is\361\202"
+	.ascii	"\271\252\003=\253:\276>\024I\033\026Y\356~\361j\336\216]\f\034"
+	.ascii	"i.\376\007\353\232\233.0\372\376g\005\376\257]m^\273~3A\351t"
+	.ascii	"\325\201^\230\022\033}9\277q\340\331Z\341\242M\337\373\354\225"
+	.ascii	"\271uen\034\232se*\251\252rV\225\0063fn\\\315U|\250\214\260\243"
+	.ascii	"\0346\300\364\275O\030|\237(\370\277aj\363\206\271d\252U\316"
+	.ascii	"NY\035\020\241\202\2169\223;\353K\346\277b\356\230kU\271\210"
+	.ascii	"\271\342\322\027\275\234\030\376\257\227\332\274^\356\\w\345"
+	.ascii	"\240Y\030\330]\256\252\3420\367_\271\373\345\212u\216\002\367"
+	.ascii	"\242\357\205\\\203\320VV \364><\270p\271q\367\3119?\345l"
+	.ascii	"\203\013\235q\366\275\337\2709\261 k}\357\243\205\377\013\327"
+	.ascii	"\274p-\205\203\"xA\262v\214T\241\321\325\367>1\360\177\337^\233"
+	.ascii	"\367\355&\321\240\314W\b\bS\266\331\352\3139\213\303\351\365"
+	.ascii	"%$G\337\373@a\301R\353\316\250\234\255\006\220\346l\247\207\026"
+	.ascii	"\2761"
+	.string	"\274+W\264\302z\260\340\377Vi\336*U\357\214\312Na\035\034\301\313\342\200\203\266\304\222\245\357{\332\246\0049E\342\360\030L\221J\f\223K(\b\375\344h\240\003\f?\352\200<J\016\223R\243\342p\004\316\217: \323\"c\222\220\350\350\201\310D\006\tl\340\004\022$\214 \224@\t\030@AH\302\b\241\n'\374$S\244\207\024\251\304\260(\001\344\t\351q)9LM\370\234\340\243d$\"\036I \201D\244`\201$\261x\002\020\n$%\245\021~\220\206DG\311a\222\007d\222X\302\303R\321(\001LKE\"R\002BP\200P\001!\230<$\221E#\321i\"Y$\036\221P\016$\261`T$\036\223H\017i\321\022\022Q\221\350\341\210\\\362`\001\022\322R\261h,\002\223\302\364\004D$\312\202\361x\2244\026\201&\206)\322E\241D\224\224&\241?\352\200\"\002\311t\002\030|2\300"
+	.string	"\205\222\221\204 !R\311H\302O\362G\035\214\224<\030)\021\025\227r\212&\372D\n\215\224t\222\302\242\221\322Y4R\262\351\t\210\310\213D\246\307\242\242!\020\205\222\221\350\036\223J\266(-\032\021\221\206\300\242\024\271t\221\300\037\205FJ\035v\216\303#\242\213\342\230D\022\215\322\021A)\222Q\221\250\202\017\322p\251\004\"Rj\002OZ\034\")\035\211#\\0*\0229`T$\242@\022\201\301\347\204\b\020\217$v\220FE\"R\003H\342\005\244\321\020I\204Q\221\230t\034\346 \223\304#\0139@)R\211!\211\235\017:\364\340arXB\021Q\t\370\243\016H$\3431Y4\022\t\2114(*\016\223\222\214$\020\035\203EF\024zp\230\210(\024\r\215\026\370\371Q\007\"\341\321\003\221\211"
+	.ascii	" \223\303$\022\007\231\203\201\364\270\204\201h\203$c\022\271"
+	.ascii	"DB\321\320\210\204\001\211\242\340\223$\026O@\342\024\215\304"
+	.ascii	"$Qz$\226\320#\342\210\001\024\212\304\244c\232L\2134\244I\304"
+	.ascii	"\244\222\321h\201\"b\n?>\037tH\036\207J\035\222\304\342\tH\024"
+	.ascii	"\303\343q\204\013rt\206\311a\tDG\264')M\"Q\250 \274`$\301\264"
+	.ascii	"4\002\006'r\002irX\244\264t!)D\036S\244%\t\244EKIb29\fJ\ns\222"
+	.ascii	"\311TXt\002\223\261\004P\205d1=\036\227\210~\222?\352`\302C\321"
+	.ascii	"\230\224d$\372\200\242\221\302c\232D\"\212(\032.\231\200X\202"
+	.ascii	"\347\203\022=T\242?\224\350\241a\177\030\366\020S\177`\352!\024"
+	.ascii	"}\341DHaQD2E\246#\214\224\202ND<\246\305\324\b?\004\005$@\001"
+	.ascii	"!\230\200\017"
+	.string	"\301\200\017\030\360\001\372\020\f\030\032b\200\002\206\360\0250d\207:|\b!L\223C$\245\2444)\024bH\205FC$\021\251\321\020\251\201c\232DL\372\244B\246\264\250x\302\217:x0\022/@\032\226H\"\032\361\244E\306\244\313\302\360h\177\324a)\211\210\204d<\336#\242$Q\351da\210\302\"\323%\244\341\t4\371\243\016ED%\241\244%\025,R8L\016K@\022\231F(\"*\355\244PO\250%T\0215\231\"-\035/R\210L\221\226F\350\244HK#x\222L\306\022\026\231\032\035\207\311\235\234\2424UB\236\311\037uH\352\240\240s\"\205\300\2431iL\3021\2368\246*\244\310%\2342\021\223\202L\307dq\311H\202N\232\034\2168B\246G\023\351\b\246\343\3161\231BQ\30409,\201\205\341\210\242a:\202\350\230sL\246p\241(\002\271\224\034&U :\366\034\223)"
+	.ascii	"!\031\215\021\020\236i\0221Y\\\032\301t\374)\212H\223\206G\021"
+	.ascii	"HdJd<\246@t\364\031&\207%\344\f\223\303\022\202\311$\343Q\204"
+	.ascii	"\211\013Ha\322\3608L\n"
+	.string	"?\200\200L\211\216KF\025\212R\3441=\221\036{\212\304$\3134L\262)RQ\0211\tM\223\303\343\375Q\007\246\243\007#% \246#\216\3220\211\350x\036\323\"\342\t\343Q\251(e:\"\r\211\307\024\371\303\224\")-\225`\002ix\204\223\026\021\217\307\364\204QX$r 4ZBR\022\372I\246\310\364XT$\226\020&\207Ha\322\3221Y\202T\t\231\201N\2124$\302I\036\323\023E\"\321\261\210\230t\026\211I\270\004D\351\021\021\3230\t\367 \221\206'\212Fbr\210dT:\246\311\342\tD\307\013\220iz4JKH\221\214\212#$\rI8\241d\342B\021\222\361\b\231\036\217H\244\311\341\tb\222h\204\264\310\210\302\2218\024*\022\211R\344\222\220i\230$d:\346\b\231\226\206B\246aR\017\362h<\036\323 4\231\"M\2300\346\244J(\222?\031L\2300&\227\210"
+	.ascii	"\200$2\r\205FK%\322\242\344\222R\221xA\252\204\")LO\020\223\303"
+	.ascii	"\023\304cZ\244\301\321\230$\032\232\020\032\223KC\241Q\221x\224"
+	.ascii	"4\032\223\220B\242\243P\221\221xL\225\204&\224\220\204i\322\360"
+	.ascii	"hBHtD\n\211H\3441\0030\371\243\fHH\036\207I\025\214\212\304\242"
+	.ascii	"\343\220\205\243Q\004RZ,\016\217\2106\330I\376\250CrI)\271d\024"
+	.ascii	"&\261\240\344\001yLO\020\217E\034\334\250\224\036=$\215\306\243"
+	.ascii	"\207\234\244\020\210"
+	.string	"4\032\2220\022Q\244\320\210h\242h$\341DZ\002\022i)\205c\232,\246$\370\244\311\341\210$\026R\3209\221\026\331\244P\001C\311\"q\t\233 =\232\020\"\221C%\026\214H\302\013Ia\210d\221\270\004\374\320\020\t\034h\340\002\023\300D\035\220\036\222GFD$\023\036\212\304a\222\007\242#\322C\007\f\214'\216)RX\224&\035\207\305%!\361\230\374\371\017T{\273js*\306\322\372\r?A#\327\242\tdb\266&\315\214GY$\214[+Q\002<\303k@\n\026W\313>\340\031\220\031\007\004\257\013\310\004.9\253(\253\342\260\r#h\372\372>\203?\314\024k\202d\214\331\032P\255o\312U\031Z\005\357\030\322\305\006\331\235\353\245\035\031\2171\364\016\217\214\357\007\022\264\257j\305\270\312q\344\252m\350\323\201\326\027(\006,r\240\221\003\2154\320\210\375\373C\223\204i\202\006\t\002\034\202"
+	.string	"7\275#C\302\016\034\342\246\342\214\232\271\276\300%P\310\036\376\201@n\033O\037\234\030\251\037h\221?\346\224\217\233$\207\033.0}\201_\300/ X\260\251\314\2136\035\007\202\001y\234\310\001E\203\007p\007\016\322\207E\306\242H_\021.\370\007\346p\261\323%\006X\013/\364\214\334\222?\260\0337\2008:\200\312YEF\021\304\013\312\235\362@\034\266\t\226\267'B\326\360\017\264q\343\356\023\032<\274\270~D o\352k\013\375\322C\247\374\232\322\312Y\226f\300\032h6\256\232Zl\300P\265"
+	.ascii	"\314b\006\321\373q\327\367\t\016\306V_\240\025\320\n(\243VU\345"
+	.ascii	"\r\300k\315\325\262/g\305\320\360\003\257\016\224\001\214a\006"
+	.ascii	"IYW\f \214\033Z\372\372G\033\026\266\f\224\3404\246\016\025\225"
+	.ascii	"\017%U\330T"
+	.string	"\224\230 /\212\3341\2576\037.\320Z\314\214\027\273\251\023\n\216\031\027pEZ\234e8J\337\221%\213\323\312\211#\212\f\232TSKG\r+\340\212\003\243z\362\260ph\365\005\246"
+	.string	"\2528\262\\+\323\367\265y;4D\316TQ\322\027\370\004\204\342\261|b%\315\357\252\372\304\372\3148\241I\200/\312\332\350h\"\263\343C\210\017(`\276Z:Z\230\004\351B\377P0\030V|\270\275\271Q\2400\301\273\322\327\317\357\374\361\025\344j\211\244\306\233\271\276\317\200\006\03367.\r\310\325\362<\242\346F[\337g"
+	.string	"\225\227\207\366U\264L\325"
+	.ascii	"\"G\206\340@\321\300\263\321\302\321\276\273\r)\323\004\244/"
+	.ascii	"\312w7\245\032\033\215\276\350\336\335j\354\200\001\245/\252"
+	.ascii	"\346nm\236,\t\323\027\325\303\240\013\0324\350\335\022&F\262"
+	.ascii	"\372x\300\350`\321\"\315\321\273\247\"?\244\334\262\035$vbh\364"
+	.ascii	"=\006C\300\034\025\003\006=c\307\260m\3119kq\366\205\356\350"
+	.ascii	"\231\243u\037@\334\016\211\2211N}Q3\347\311\212\253r\327\367"
+	.ascii	"h\031\034\"_\315#}\237\200\377A\214\206ee\325\027%#f7\205\327"
+	.ascii	"\027\035s7\235,2};\302`\340\243K\027\364KE\313TC0\206\230!Y\302"
+	.ascii	"f.\t*w\364\313\316^\232\234\022\324\213\033.\\\316\037\025-S"
+	.ascii	"a\240r6\304\257o\007\356\206\212\2753p"
+	.string	"p7NHi\305\374\310\322P\367\344\236\244\351\373\foW~\005}\023\3029\t\023 w9gi\300\001\206\016\250\363\021tZD2\306(J2\205\024B4S\223$\035c\025@0PD\036\227K\326\311>\023\200\203LmE1\321\202\f1C4\"\2424\005Ij\fs,\360\303\247A\313\376'(lR\336\317\366_\337?\235\016\022\351\303\031(\274\360`\351\bN@\317\354\024P\221\231\016\350e\240jO\363J\213(\204\020\260\020)z\245\306\307\362\267\260\024\036\274\234h\225n\264<LU\364\234\345\241j\323\003@U\257m]\214\353\322\350\271\223\265\320\226,\232\026,\365\233\355P\322\340\331d\231Uh`\254\210\032 \007WJX\220R\313\331\177\003\352\205\221\263<Lp\007\254'\232\320\005\326\302D\261\246b\025:\2319\361\020\304\020=\3124\025H\311\335\310\356\353\302\247\206=\235[d\312\316\223"
+	.string	"\371M_t\307g\313\341\277\223\371\261*\253m\016\312\363C#\275\260Q\247$\207\023%\005\003\302\224\3522.'\246\016Y\235tU\312\335\324\204\314sG\360\352\270\305\312\323\026\317q\242\207{J\331\260\"\233MXrMW\022\301\277E\2002\254BKvD^\224\345Y}\332x&F\265vM\030T`\ttt\272\226\037\237\212\205\241\354\200\262m\364M\026\354"
+	.string	"K\347\367e&\324\314`\t\372\203\363\325k\313\333\030K!\n\226\270\340\373\353\226\266u]\373\252\037\271u\372\275\034\006\310\246\030\315z\002[\002\013\231K\334\201\025N\264\274\247\233\f\246|\032rb\372\241\353\027.\226\346\t\316l|5Bu\334o\350l \035\332j#\226\214\"\224\215Z\352\320\020\263C\\\023\316k\274X\213\361\365C\221\\a\227\325\246V\361\256DE\ryF\274\254\370j\020\243b\006\025\035G\rE\366\375\005\223\n\237y\224FL\031\277d\325\271\325y9\353\036^\222\r8\344\025\256\347(}\330"
+	.string	"\"\212\003K\235\325\270\354\"H\030<`\201\327\342'\247\204\243u\273\3379\232\025\215\252UJh\b\313\251\212Vg\031@\350\0261=a\212\260\204\372\275\002C\221C\242\312K\026\242\265\037:\334fH\311U|\350\312\003r\177\344\377\255\205\3262\345q\026\256\004#\0269}\226\243\371\352\351\336~x\300\364\244\333\376XT\374*\260\231\364yA\n\366\317\360C\336Z\211Dy\006)\235\343r\246P\034!"
+	.ascii	"78\332p"
+	.string	"pSf([\220t\027c\307\337F\342\340\225\243\245\212\220\211\334uH\345\303]\303\341\001\306\261\374M0s\217Q\371\314\313\r\234\017wRM\302\0041Bn\343\365\330\207\331\243\253i\264\b\344\215\350\234m\234\021\316\315m\361S\036\373\201R\220\274\274\361[z\017\261lJ\034\236H\323\030\362\230}\002U\270\343\234pt]0\213J\023m\375-\236O\215-\372\203\223;\230\240E\270l~\376\325\264\323\027S<?\336\274\327\027\216*\206Q\206\335g^/\001H\022\251!.\035\222=*\373\277\027b\026\204\b\006\211\n]\2419<\\\004\026\007#\371\356\317]\347\214\355\020\262p.\035\035`\376\312@<X\352+H\036\260\f\316T\340\205\374x\r\303\233\320\201^\0138\302\263\324\232\374\260\330\226%\303\357\262ib\203/\275s\316^\377\016\201\310b\323\007\201\270g\023\236\f\312dX\016\007\232\006\207\327\234"
+	.string	",y*\021\260G\261\022\251\265\\\260\020f\312\037\320\2341c\350\256l\016\252^\266u\031\273 p\326b\263\320,H\366\225\2057\315\345UL\327l\252\351\f8\315\376\017]45\f\034R=\261\223\244\217\001\007\374\374\247\202\252YFO\206X\276\336\351\247\0318\213\256\b\356\221\200\346\r\344\354v\004pS\270\002\023s`\305\017\366+"
+	.ascii	"p\256\241\r\255?F)\334\314L\341D\304\236]>)`\275\301\344\361"
+	.ascii	"CDJ+\251{\221\215\345\354\371c\217e\260ir\326!\212\350l!\362"
+	.ascii	"\237\201\211,\\=\311\202^\270\377\307S\356>\f\b]\372Z\321JH\360"
+	.ascii	"F\001\246ijP\235\007\305G\221S\326\f\325\037\003\027^\035PI9"
+	.ascii	"\356\300\036\201\264(\207\013kiX\240jAx\252\222\026u\332\252"
+	.ascii	";-\266\236\374\225A\254)\244~\037b\320D\246\250\213\021C\217"
+	.ascii	"\022r\307\3561\226\236\355\021\267bF9\003$\266\316\037\265\253"
+	.ascii	"\370z\307S\365\016\tiY\340{\fk\177\203|b%\361\032TVT\230\356"
+	.ascii	"(7\0255~Y\274S\020\366\342\363q\275x\017\026J2\242@\200P\013"
+	.ascii	"\233\256\177o4\243\030@9\277$VEq6\304\340VJ\032\240\335\316\235"
+	.ascii	"u\336\371Q\n\200\347,p\2552\246v\3149i\236\350K\332\273\243Q"
+	.ascii	"\336\207k\006C\302*\270W\204Sp\327-\265Y\240\002\255b\003}\315"
+	.ascii	"F\312X\250\325D\225@qtX\225]e\020\352\237\2517\006E\205\344\263"
+	.ascii	"X$v\210FB\204\022\202oJy\230\032T+X\315\320\001\005tw\020\216"
+	.ascii	"0\302sW\t\217\3561\302\361\252\305\002\037ok\237\006u\3633M\215"
+	.ascii	"\363E\272\002\025\303\220-hx\304\364\241g*\336\366E(\\\276Ne"
+	.ascii	"\t}\\-x\347\300\304\226\333{\324\355\271\361\306\222\320\371"
+	.ascii	"\030G\306\311F\366\r\352\002\356NE\035y\257ji\324\356J\3352f"
+	.ascii	"v\314;\216\\\335\275\230CjB\251\213\324\225\376\243.w,Q\321V"
+	.ascii	"\032\200\262\f\307\230\034\260r\3015\007\025a\213M\003\237AL"
+	.ascii	"\034\245\306=ex\b5\321\376PL\366\236\342\340Cnmi\241/t\3726!"
+	.ascii	"\001{\312\303s\251\342\331\347\302\007\361\365\016\\i\266\332"
+	.ascii	"\017}\367\336\325\017xK\211\006\341'\205\"% \ti[\243r\b\337\316"
+	.ascii	"\306\212\336\344lB\030\006\276\277\213D\213!\234\220*\312\242"
+	.ascii	"l\314\267\350\206\3151|p0\022`\326n\007\216`S\306\241\226\312"
+	.ascii	"\3457o\304\321\223^\323\220\244\212[i\311\343i9"
+	.string	""
+	.string	"\2318\325D\023\350\323\301\346_\321\352\252H\346H\352-6F\002\210\340\364\2069\177\226"
+	.string	"\307\r\303+.\022\232\030\024R\\\245.\204\301C&_\213\306\022\276'!\034R\006k5\274\357:PJ\n\221D\374\001y\310\216Fr\260\343\bK\221\342~*\362\fA\315C\327\300\006\265\036\350Ya6\223\200\001\224F\355\364\215\035\251>\213z"
+	.string	"p?pA\246L\214@\344\310ObX\210\034&\330"
+	.string	"\224/\230|\263\306\2275F\243\343Qf"
+	.string	"(\271h\260\007\374O\"\210\2575\224_\252\351Y@\035\035\030\200\363\374![\347\r\335\t\316SZc\373\366n\327\367\305\213\221_\036l\333\022\333\003m\302f\377\361\263$\"5\244\270\272\231 =\310\270\037\030\r#\225\211\272D:\311^h1\003[\210B<\003b\3274\243F\007E\243\266\274\037\313\202\221\3371\211\016\357\334\004P\331t\351\317x"
+	.string	"\304U\343`\236!\2648x\351!|F$\223\210~\317\315\034\016\330uK\274\261\323\326j\203Ld\334\373\224,LQ\"\243'J&\003\264\343)\366\003\264\031\222\346\326\255\245\255\024t\257\210c\\\217\241\031\007*\343\374\344\027\035mm\312\350\036R\341*\355\302\003\207\317\342%\313F\0377\215\215\316_\b\370\347\350a&\217{5$U\225JS$\264S\353\034\336\027W\006W\b\017\301\353V\206E\305'\020\312zP\224;`c\320\003h\247\377\324 aG\270\355\302\366\314\373\244\264\313\322\004\020Yj\213\207~\367m\222K\201\327T\265"
+	.string	"\304\224>\355\021\312\201i\035\3552\303\035\365\264\241E\020\017'tx\376N"
+	.string	"\273\001w\200y\240%\006B\220\253\272o\262\b\003\235\375d\023\036\350\364\320Pk\247j_i%\330\027\265s r\320D\303E'\304d\217\002|Q\351\302d\001\3205"
+	.ascii	"\270\354\3655\224W\312"
+	.string	"\016\325)b\276\260_\300\rj!\035\003\332}\253\n'V\003.F@\226\3502\035\231\005\310mNG\332W\276\346\036\323\320\220\315\350>O\264i\231*\036\370\255[\034q'\261n_\315\335\273\017\2312\204\017tum\357j\255\336\262b\016)\031\032\345Uu\260\024\351|\240\352\212\031\303M\276s\272\210uv\201\264kjY^\007\tsA\261eI!c\233\377\\\312_K#?F~z\304bT\034\023\366\025.^\261\2301\261v\313\364Z\224\025\2258\372l\243\256\311\277\001H\212\255r\375\006\022\0016\264\322y \024\222\301\323K0\205\017\217\0200&\002O!\300X7?\357\200(p\006\262\346\244b.@\250\036\005\262\032\0368\367\013\206\227O\311\260Y>\030H\021(\\d\300\305\230\312\017\302:\316\256 \366\216\214B\272\322u |Pvj\356\316v\325\026\271\332\254\376\021\021\233\032\n\226\213"
+	.string	"n8\265[\344D\370\001\022\024~\177\377\022\313\204z\270!f\211\3342_\302\274\036\375\364\345\347\214\335h\352"
+	.string	"\366{\263q\216\201D\250\006\231\276\240n4\036\325\340\347!\213\326$-\020\377\314\006k.\244\n)? *xq\013\370\343?g\336\002F\r\2133\312\230\303\364\325l (\310\342\334\237P-\334\3351\034\242<\257\275a\017\377\376\355\237N\022\364N\254\352\375L\245O\035K\365\270\t\337\216\363+&K\021\245\265\354\245\236\227\\\202a\2615$\240\377\340\207U\007.\230z\235,\f\225\t\032\240\330\273(\226G\032$\021\345\270$\3312-\b6\027>U-'(=\276\227\033r\016\256 \311\254\330mD\243\317B\313\3179\253\035\327V"
+	.ascii	"\2663@\251\314`\"5\335\203]\224\3244\240\310X\246\220\352\367"
+	.ascii	"\204,\226k\241\274\327T\233X8a\304\004\024;\306j\tR\354uX\022"
+	.ascii	"l\244\017M`8\261\226\3024v\r\372'H\241l\370\267\t?\f\204\327"
+	.ascii	"\232\365\021\201\241`\341\235\220\277Y-V_U\177iu\366\366\315"
+	.ascii	"\036c\236\350A[O\247\030d\230\330\301\016z\311\254\316k\233\304"
+	.ascii	"\256\331B\177z\250X\036d\245\300Y\177\314@C\023\301^\352;\t^"
+	.ascii	"\326UAg\210\353!\221\177\343\036&\001'\242>\266\3150\bm\310\262"
+	.ascii	"\327x!\253\235\021\345\215\355\355I\033\363GD\354kE\306\335\361"
+	.ascii	"\214\350\201U\307\270<\300\305#\302\377\\s)\334\221\004\261\303"
+	.ascii	"\357z \372\033\362\234\216`jk\2755\336\223\277\257t\377\263$"
+	.ascii	";\356\331c\364\254\033\372X~\301\251,\333\2729\226\203[\030\246"
+	.ascii	"\037\374{\367|\361Y1\361\277\335\2769\266\277\260\313\217\371"
+	.ascii	"\314*\177>|\305\215\331\304w'\013\237zq&\271a\313\213\375=\303"
+	.ascii	"_\307\375%\371Rp\366\356\274\237\301U\376\\\231\355\263\n\247"
+	.ascii	"\024\347X\257\217\370\371\334\037\362\230\271\260\305:\354\365"
+	.ascii	"\350\247\227\334C\347\026]\260\363\231\311?\343\037\364#\002"
+	.ascii	"\223\266\177\336\f}\345\227\342\340\024\207\266A\253\016\222"
+	.ascii	"_\364sv[I\371\027\232\007\267O\366gbk\335\276\361Fl\301\177n"
+	.ascii	"r+\240\331\230a/\347#\036\007\331q\262:~_u\021\032~\206\327\233"
+	.ascii	"\330\2163\2344\351\371\037\311\300\2370\340\350|A\363+k\312\333"
+	.ascii	"|&\264\356\201h\200\357\377>\247md\013fF\264y@SR{]\2358~:\002"
+	.ascii	"c\006\336\207d\224\242\243\226p\301\252\233n\376\207\307\033"
+	.ascii	"\362/\313\306\211\340%\032\336\263\340\251\3119\017\372\306\323"
+	.ascii	"\213\246\307\234\330\350\246\374\350sJt\022\254s0wq\232H\341"
+	.ascii	"\326H\357\r\365C\264\026\362=\343\373/Q\237M\3754\310f\212\305"
+	.ascii	"\200\177\t\235\213\243\263\\r\313\r\356\005xQ\\\004\027\307\005"
+	.ascii	"\364b\262<\232'\260V\376e:\257z\207\256\334\335\304\250\033\006"
+	.ascii	"+\353\340\374T\002\334\001\035c\302\376\211d\240(8?\203;\336"
+	.ascii	"}\237\361\360\021v9~\3668:\233\267R\302\tv\226\207\023\234\222"
+	.ascii	"\256"
+	.text
+	.section	.gnu.lto_.symtab.8396c542b39a8729,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8396c542b39a8729,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
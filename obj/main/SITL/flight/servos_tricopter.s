@@ -0,0 +1,273 @@
+	.file	"servos_tricopter.c"
+	.section	.gnu.lto_.profile.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 '\035\001"
+	.string	"\350\033"
+	.string	"\003"
+	.string	"\242\316\326\257\007\002\002"
+	.string	"\002\001\002\262\374\202\245\005"
+	.string	"\003\274\205\242\255\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\003"
+	.string	""
+	.string	"\003\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 \200E\002"
+	.string	"\024\003t"
+	.string	"\003"
+	.string	""
+	.string	"\005\200\200\200\200\002e\001"
+	.string	""
+	.string	"\002\004d"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\003f\001"
+	.string	"\201\200\200\200~\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"M\005\320\025v\216\302\362\022\203\347=,C\270\334\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\002\230\004\003\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 &\275"
+	.string	""
+	.string	"X\032"
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"<K\200\320 \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.157aec14e1ed0c64,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servosTricopterIsEnabledServoUnarmed.26.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"m\007"
+	.string	"BN46@o\323\001\230\016\004\267&\203E\002\335(F\034\247"
+	.string	"\025"
+	.string	",\250\275\031Hh\274_\271\261\361\020\256\332\030\3161L\314\201\300\210\340P:\254\215\361\374\326\232\224)\005\256:\321\322<XuEm!\303*\242\225A\355\301\341\202h\200\022\027C\004\254b\006;\034c\036+B\r\303\"\334|\334\247\325\221*\001\247\235\375\001\314U\365\241\224\316\023'\311"
+	.string	"v1\022\374\221\223(|\220S\266\370\344\275S\376\007s\352\252!qY\262\277.\265\303\376\264:\262\235\326L\177\322\230\004\250\354j\224^\226\205B\t\261\r\26276@"
+	.string	"y\023\310\320\226\223P\211\313\356\007\325\343\333s\363/\362\002\216\025Ot\361\314(\354\256\323\023m\334z\333\034\333\007\266?\002\t"
+	.ascii	"2\241Y\037x\301D\360SA\273&\372Ed$D\036w\243\323N2"
+	.text
+	.section	.gnu.lto_servosTricopterMixer.27.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 \331\365\005"
+	.string	"\342J)1p\307\351\220,tB_\313\275 \360\016\355\035\301,\345\023i\206E\210\320\346\240\334\027t?\263\370\215fU\r\212\363\235\307\372\241\372\326\243\311\227[\246\247&Z\325kR\026\255\022ljh\205\311j\251X\027\212\314X\023\214\244(&\247\307\347UQY\347\244R\372z\331\213\f@\017o\347\370s:q\2713\n\300\215\265\377\323\"\013\374{h\366~\226\002\026aw(lh0R \370\277\322\263\177\241\361Q$\200\020\030\272[\362\300f\033\263\357\036l\202\353\264\215\210Hw?r\035\300\236\367\277\343?\344\377&\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_servosTricopterInit.28.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 \306]\005"
+	.string	"\262\211$+pm:\240{\263\017-\302\try\270F]\0306 \324\304\213\265/\350\300\202?\235\243\252\3522\026\274\\\030\003P\204\350\357-S\277,\212Um^\031\255\214mV(\266q\215@2\311\203)Yc\302\027\335\330J|j\030\345:'\345*\354\225\340\301\"/\177\330E\311\371\027\320\022\374cE*\224\2725)T\217\002!\317\377\255\316\375&\003\206 \312\200N\335\315\262\263\334F\356\273\237\035x_\267Q\260\350\356G\357\333\354\345\376G\374W\374w\004\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 z\215\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\032\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\035\004 \033\177\005\002\034\177\006\001\036\177\007\377\037"
+	.string	""
+	.string	"\200\200\200\003\002\004\200\200\200\200\004\001$"
+	.string	"\006"
+	.ascii	"U\204Z\3412\\\366\264\2423\240\021\301\252'"
+	.text
+	.section	.gnu.lto_.refs.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.157aec14e1ed0c64,"e",@progbits
+	.string	"(\265/\375`t\007\375-"
+	.string	"jSp\022E`\236n1\177\336\367\373&\244\362dU\364B\315W\234\356\0261\351\203\332e\207\b\254\255cj\215D\t\256\201Y\254J\b\004\334E\307\231\211L\177p&"
+	.string	"\237KL\005C\370\205U\236e\304(\376\342\322\312\235R"
+	.string	"\001\022\001\021\001Z\034K:\247\375\361\252\f\006\257\265\030:\356\376\347\242\242\240\"\037R\307\233\030Vmgs0(\336"
+	.ascii	"\253<fm\241\352\027u\253\315"
+	.string	"\207\021Tm\207\302z\227_\273\227\237\025\251\234\237g\201\22555T\315q&l\373\017\266\275\006\333\036\263C~du\374g\365*n\305\227\020\374J\373\231\243\265\3178\377\214~\351\235-Q\265[\260\355\020\326\364\371t\bk?\261=\016\264\242\315\023l\3179\320\352\263\217\371R\310\231M\341B\2470\331\213\375\317<\003\366\232\354\345\241j\207 k\246\256\277\320Cl\273\320\352O\027Z\033e\373\316\201\326n\177\322\355N\\L(\215\263\3447\373\237}x\346-\255\036\250\332\263\003\255\254\377\254\016\247\273\357\274\273\275\256\273\235\335\375\334\353n\005m\\\257\273\363\272\033\257\273\337t\267]w\253\351\3564\335-\326\335lw\263u\267\372|>\237\335m\325\355w\335>\273\315x\226\337\371\357fX\217l\360\317%#\235F\033\236v\325\214qU\305(\373\374\377\007\264\256\274\344?6c%\362\277\222\253\247\327\262"
+	.string	"\317\315\027\342M\270\007\327ga\375#\320\372\207\375\233\377\017\377\177\016\222k\376\307\321\023\203ii\375+\203\264\236\013V\303\372G\315\340\322\2221\323K\376\251Ia\202\275\213\031v\260wv!Y&<\366Y\377\357u,X\222\006\035\252\252\021"
+	.string	"\217\371\360\202\252\215\032\201s\2628\266\362\226R\246xY:\203\345L\361\332{\3634\216\306\317\370\322\235\356\326^\306\315\2309\235\312R\257\202;]\315\311\244s\332\207e\2349(\024.\270\323\243x\331\016<\277\214\034\257\347\214-AEEE;B\342|e\005P\375\035h\355A\217l3\310\335|\035\331\253c\273\302\026\326\305\224\270\271\377\271=K\367\257\315\2718[:\203\001p\001Dn\256\333\305x\030\037\343Ko\363\265\36647kt\376?\376\177;Z\367\257\275\315\003\377\237\376\357`\003{%\027\321\316\017\030U\256\300\334\3359\236\307]\341ikC\362\206\327r>7%F\312\336\264/\375\215\307\241d\017\013({\241\214\240C\006\207\207\206\252\235\"a\333\327\270\\;\233\245\263q;"
+	.string	"\312O\341\316p\204\335\275RI\204\232\t#C\347\246\335\216N\347_\354\377\025"
+	.ascii	"8\222\304+\013U\235\016\3656^\327N\347s:G\247S\377\215\356\f"
+	.ascii	"v\334\031\370\326\212\030\227\253\332)\026\333(\031\266\321\356"
+	.ascii	"\365\215\310\377\237\341\233\037y\245\263\272\317\235\250{\200"
+	.ascii	"\247\336\340\323\226\320\374/\"\333\261I\260\030s\240jw\017}"
+	.ascii	"\207\375\303>??2fv\301q\231["
+	.string	"\322g~\036\006\236\331\343\343\271+\251\312\217\376\374\376\307\256\344\212x\226\221\361,\303=\177\224\341\3779\331\023\233\031a\217\231]\311\230)'}\376\370\3603\215<\330\243\234\214\303\310\311\236\230iL\306\307\256\244\017\021\371\353\306\0137#\026\037\213\217\037C\213\313\210\354\tnk%\004\021\340\025\016=\374\270\255\225\020D\201\250\366-\262 A\240\037@\021\211\031\200>\023$\232Z\250\024\301\341\206\242\207\022E\007\315$t\333a\353\304\266\005$\tHIV9\235\2444Ai\302\332IJ\277\237\022\322\217m\244_\372\366\223Q\202\001o?\031\275SR\357\024\021\030U%uTt[*\241\3334\324D\251\326=z\211D\367H\300\013\314):\005K\020\205k\021\350$T1$.Q\265\032\212PS\"\334\366\035\266K=\355\033\034\021U%B\207\252mJ_ \322\217]\321\272*\200\305bP\252\212\b\005$"
+	.ascii	"lj\243\334\340p\n(t_\237\027\230\364\016\205S9\375\373-\r\231"
+	.ascii	"\b\321\201e2r\333W\212\310$t_`\221H\345\266\305\243\367\311I"
+	.ascii	"\b\245\342h(\fF\0351\271\305##\007K\257\033|I8\r\205Mn\260\312"
+	.ascii	"%r\200j\207\303\340\023\223Pw\2430\236"
+	.string	"zv#\210\027s\326\221!\343KF\237q\036\346f4T\325\323s\274 9}\0332cK\330\277\222(]\202\267&K./\317\361\330\200\200\250a(f\024R\206\020$\230\031\241\231\021\027\033`\002\221)\264u\021PE\202*\250m\322\236\001\027Gb\277:\377;(\202\267\243\266\227\332\211\213\343(1\317\034\024\240M\317uy\006\333\275Ox\275CPQ\r\365J\315P\304@\264\207\007hLd;\314\237UF\377[g$\313x3\022%\021R\"\220mE\020\330\t\371\353\204\300\311\277\023\236]\377 \207\262\315\254?\032n\222T\027\337\216Z\376\224^E@\022c\035\024\344*\005\307+\005\211\232-DL\2415t\230a-}\202\372Aj\235\340O\362)\200\037\270D\300k\t|\243x>Z\322P\377\315\266]\317l\200\034\013\335\366\020\357\243\207\034\025Pmb\215`\216\355\370ro\2164\3527$"
+	.ascii	"\317W\310A\2637\302\t\017\214\242rh\361\360?\315\313\253\216"
+	.ascii	"\001Kr\351$\344\314\300\017\301d\357\\\332\353K\220\020X\f}d"
+	.ascii	"\247\360\355\033\2166\371\006\317\351,\253S\036\202)\203?v\353"
+	.ascii	"\275\f[t\006\337E\272|\002\377\001"
+	.text
+	.section	.gnu.lto_.symtab.157aec14e1ed0c64,"e",@progbits
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.157aec14e1ed0c64,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4010 @@
+	.file	"asyncfatfs.c"
+	.section	.gnu.lto_.profile.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375 \030\301"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\020"
+	.string	"$"
+	.string	"("
+	.string	""
+	.string	"+"
+	.string	"-"
+	.string	";"
+	.string	""
+	.string	"G"
+	.string	"I"
+	.text
+	.section	.gnu.lto_.icf.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\265\r}1"
+	.string	"\0267\321Jp\230Rc\333\2277\223/\304\2103\235D\356\355@\036\251\207\271\362\226\214b\366\007\200h\200\271\201"
+	.string	"Q\033(Y\033(Y\033(9\016\224\357\373\276\357\373>\3364\320\306\235\b\032[\261YH7\021\273wI\332\336M\266L{\007\254"
+	.string	"\275"
+	.string	"\302"
+	.string	"?\222\376\221e\276uO\214\250\302\341\207\305\303\306\342\003\274\370M\237x\372\373\365\233\3475\215\n\016?\204\207\276\267+\\Zf\371k\f\234\036\301BE\376Y"
+	.string	"\302}\004\266m!m\305\277\034\367\212\256~\274\001\377\340?\337}\022\025cU?\241<'\264\204\315\367\313@y\030\034\"\024\343\016^\277\306?\220xB*4}}\360\317w\366\276\303\377\337\003\311X]\321/\327={\367\273\367\237\017\312\244C\256\327\376\373\313Y)\316\210\332\316NSx\324\035\367\304\226RD\375\267\342\251\215\006\373\263?\273^\030g\325P\302ZK\254\263U\322\252\227\032\346\336\317\371~\316q\276\340sRr|\321\004\241m=\224f\326\327\312t\306\322"
+	.ascii	"%\334\242a\305\311\311\254\260\331\026\251\246\345\315m~ss\233"
+	.ascii	"%\373\305\f\nOI\037\256\213\212\025S#|\323\352\356\232\300\374"
+	.ascii	"\361\246\251\251w\315i\356\363Z\221\371\350\252\367\367\203\031"
+	.ascii	"\252j\006\233\200\031b\354D\rL+Y\0379S\3273\037p\236\337\325"
+	.ascii	"YV\030r\003\260z65:\356\357\030 (h\324\270\374R\3462\337_n\232"
+	.ascii	"w,\307\2204\200\362\355\246Rr\033R\374ab`^\277F1\250Q\210m\233"
+	.ascii	"\346u\204D?\236\355\250,\342\206\264\033\234>y\225\001\020\360"
+	.ascii	"\344\351#\003\354{\016?\213g\353\263\177\236=\333\324&\331R\225"
+	.ascii	"\242\340\310\276\240\203+K\260\357\274\223\347\304\317-\023\262"
+	.ascii	"#<\004\312+]\037\032\236\223\325\001#\361OZdi\031\3309I\237\214"
+	.ascii	"\242\274'\240\375&\r)I\025\210\203\034\251\272\372!j\353J\"@"
+	.ascii	"\317Crvb>g\341\037\331\\\r\257\2365\036\0022f\364\024\302\275"
+	.ascii	"&^fA\234;\337\207M\200\201\255\361\2542\224\211-h'\371c!=\222"
+	.ascii	"j\356\234Y\357\235\315c\340\306\235\233\316P\350\026\301QE\301"
+	.ascii	"\374n\326\306\037_\270)y:r\206\0372\233\327i\262\365\233\327"
+	.ascii	"\371\001\030\206\323Z\022\316"
+	.string	"~\316h\3256\265\233\266G\225\307\345\315\006\346\n\353/\267\260\0170(.H\374q,[y\351A\035\361oW\307E\2135\021\354\231\364\013\216\020,\335V\027% \366Z\030\035\222\017@\3524\311\315\303/\252uU\355 \207\361\210Rq\240{lvZ\3126\320G\n\203u<\230~h\200\251\2624\005e\370\215\005\316\376\347?\207\177CDK;0\354@\202b\354\302\206\343\372\322e\301\025\263\021TT!\270\367\216\201\311\300\341\356\n\224\302\332+\262\26155\301\355\242\366U\225\340\363d\013$\322\205\356(\002}\002s+\204\316\314\b\004\037x#\275\270Q\345\001\035\215\202B\344\340mZZ\026\031\rf\027*u\306\205\301\363\354\217\304\001J\247`D\0278\3574>\331gO\201\206\250\021.\031\021\"i\222\244\003\241\004\3149\b\2353\017\021\300,\305(33\"\"\005IAA!\035\037ML\2618"
+	.string	"\bil\227\367\360Ssw)X\271\357_6"
+	.string	"\305n\034\004\351imF;\266.e\346\247Ym\241\240\200\314\245\016\342\357\b\351\253\022\210t\037\016\260z]?A\270Tp\017\023.s\237\362H\365\330\255%1+Pi\311\311ZO\244\303\215F?"
+	.string	"\374\022\033R\204l\007\001\026t\243\036&\346\246\352\224M\247\t\025\210\0219\027Z\236\375R\203\367\035i\265\030\346\203\3439\003!\245\2222Lk\272\256\265\337\261\364\310\035w\236\033_\r\300\207\257\305\344o\276\177\347\205n\"h\221J{j\222w\363\313\303\212o\325\264\356\351\304U\223\261h[\251\357\301f\315z\301_\263\203\257\006\0369j\302G\250\305P\3262p\264\"\372\266\344R\031\332\302:\241\266sF |Q\037L\207\177x\2313?\341\362\314\321h\327\032\3331\364A\306W\370g\353\2303lBc\347\240\004L$DU\305t\221\243<\227\231\343\353\220<@\026\344&QH +toS\3332.\026\373\266\201\036;U\316\370\237\3558wC\034w\336\253\344\017\001\206q\207"
+	.string	"\022\346*\372#I\267\316\234\301c7t \367Zq\202=\023L\261\313\275\320&\3645\251\261\021@e\017k\311-\361\330\317\037\033\351C7\362\242D2z\013!\253\214Xx\207\025\303\nCC\311\201\367;g\270\330\354\345F\216\373\312\bYl{\307\207v\301\177\226\367\240\325\254\"W\354\377\274\216s\277\ro\001\303\371\310\023\223\034I\346\361\026v\bc\n\2041\250\317\b\243n\206;\370?\020\376\341\022\200/@\025\223\270\251\330$! \246a\275\215\352\022\230\r\366\006\306\013\352\215\206O\261D\226"
+	.string	"\f\3405h\3620\203\363\327eV\b\305\3174\213\037\376h\313\370Q8\376gS\303\215>\335\006\203\033w\n\313xi\264\310\n[\271\357\235\211g0\f\007\260\b@}\240#cQ\216]/\330\352' \217\335\213R"
+	.string	"\260\361\261\211 \215\235X\264q\335\206\220\371\004\253t\240\275f\036\335\271\207\233\263(\036\336[\340\270g\251\201\374\314W\341\254T`\211\370y~\251M\3754\347\313\213\335~!i\254\3344\336\177^B\241\377\347\322q\202\366\022a\203\007\017\016!V\004b\3238\306I\210&my\341\222\364pc\002\217\235\264\365\207\2105_\223\f\020\031\354\357"
+	.ascii	"\330\221C\021W\3741\273o~\216\264l`O\314\307\363\206L\035:\247"
+	.ascii	"w\303t\266}'\347\216\330J-\353\341{\306lq\375\215\372\303\276"
+	.ascii	"\221 bc\265\021M\b3\002\250Z%\347\364\374\312\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`P\006]\023"
+	.string	"6\025<&\260\034%\351\360\306\316\316\316\316\316\316\216!*\242\212\b\214\030\250h&\""
+	.string	"(R\256\225g\177k\3156K\344N),"
+	.string	"0"
+	.string	"3"
+	.string	"\277(\211)\222\332\004\326\244\350\224\036\020\231BV#u\t\330S\n0\200\275\354\307B\317\276&gK\2674\253\354K\333zQ\264\234\004K\250#\324\020\266\307\265=\2004\245l\026#w\320"
+	.string	"j\216>s\225\3243X\240!\253\240N"
+	.string	"\262\272\314NW\230\337\020x\300\300\026(M<\002\317\215p\324\232\311\024\001)\223*\231\344\325HY\"f\b\020\215\023\235\234\332\207u?\017\317\0358Tm\2704x\2067\006/\224\233\205]\244B\325\024&\004\316\035(:f\216\211\343\306\264\261k\320\200\264vm\3062*\006\214}*{\261.\324\026'IY\254\330\225\nM\001\351\247B\361\\N\254\211\307\224UJL\302\200\301\250\221\271\204&\251\024Z\003`\2021TT\345\001\022\340\323D\n\246\212\251*\252d\377\353%\310\300D^PZ\200L\265M\\u\335\274\351h\230\261\356\270\246\347\225Q\2338\374\325\314S\001U\027U"
+	.string	"\302?\262\262\327\004\021\201\024W@\241[\032a\323K\216\0336\016\326\263\320\302m\225\372\315'\t\253E-@&g\322\235\235\206\244V\0370\343\201`IQ/\346E\230f\217\3471\006\373\303\201aR\013\2102\f\031\311[6\005\263\202\334\232hta\201\020\217\217\002\277\335\002\321b\212\003\002\030\352\343\004U)0\230\343p\217\317t\"\326m\232_\246\350\304$\274\353\207\274\233W\340\321\260\313h\313\242^\256\373>\255\245\343ynR\2200f2\302\232:x\313,\266f\303\266\030\334X\227-\034\277\356\302\260s \372<\225\034\323\231\0302\262\t\032o\220\210m\005S\314\032\350\004\360C\036\213\\fx\263\004\037\266_bP\241\252\366\303\257\367\026.\300\211X\037\214\247\256\216\376\037"
+	.ascii	"\3604\330\346S\203\274R9\3729\310\n-\025Cb\256\233G8\245\360"
+	.ascii	"?\350L\267\001x\355O\017:\355\364\021\002\332\204\347\226\340"
+	.ascii	"m\320Z#\232\204\347\276t\272\250\250\262.\n\207x\002\b\237\203"
+	.ascii	"\215\224E\200,\340\250gY\252:\231\207\206\027\212\335\257\322"
+	.ascii	"\007\312@\024\310\2716\357\023"
+	.text
+	.section	.gnu.lto_.inline.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\220-\235\232"
+	.string	"\332\262X&M \224RI\007[\215\206o\342\003\225\351\276\361\332\322\004\301c\036\017\022\276{u\324\005\232\212m*\233k\314c;\334\003`\f"
+	.ascii	"\f\375:(\266V\37581\360jY$8/\213y\357s\334K\360l\305=?\030]Q"
+	.ascii	"\357F\332\336R\2466\002H\002_\002sY\366C\363~Hl-O\020\251*\275"
+	.ascii	"\024\241\003Jx{\312%\253\222\324\233\367HT\212J\312\021\241\336"
+	.ascii	"\002\002\266%x\344\252\211\037,\204\264\315Jq\320\017\272I\002"
+	.ascii	"\376\213\266\361\242\233(\262lcn\302*\211z\351\314\306\0334S"
+	.ascii	"3\024~Q\037\207\312\rz\251\205`Z\236$\217\304{\376S\333\323O"
+	.ascii	"q\236\237o\244Q\224\005\t\253<\236\374\332<\035\021\211\321\321"
+	.ascii	"1\201qa\265A\345\270\222P\325H\311\244\301\2512\177\276\330q"
+	.ascii	"~wE\222\250%\301\254\220\323\243\342R\340)\376\367\016\022\375"
+	.ascii	"\272\367\332\357\374<7t\262K\313\354\354\237o\350\260.-3\025"
+	.ascii	"\327\371\016Wb\317\205\331{\332\271\275-\3221W\220d\021\376<"
+	.ascii	"\221n\311\322\303L\275iC\243\251%\303\234es\263\024\256\315\304"
+	.ascii	"=\224\265\227\272viKs\025\270\025R6\262\272\221\225O\211\324"
+	.ascii	"R\360\346\354z\236\310\334\344\242Z\334h!\304\254\3745\360 _"
+	.string	"\031\250\325Y\332\345\246\333\246\314\355k\007\210!\036\341\275\257\241o\016\315\363\3742)T\221\2514A\323\316p\3716\372\007\336\221'`\245\201F\201\212\363\305T[E\230\255\350{\211-\005Gm\253\347\301\346{k\330\363\3664\366\331\2757\200\267=\217\350\255\021\t|\333\341}[b\363\317\373c\263\335{\201\357\363\276\213l\354\003\336v\364D\227\236\3500\242\372\213\302\270\301\3037h>\214\346-&\216\302g\364\274\306\254\306E\255\303}\346\314\231s\017z\206\007\335\3247\350\347p\023VY\3248\030\n\027\361\245\315MUeQ3\361\023\356\240\227~\030h\275\334\264\243\354\240\231\016tN\352.[\302 q+/\377\333=\211\376\311\351\210\302E\277\254l\312\034\241\003oTe\243\312\327'5\222+S^@\311\362\277A\371\240\324\255EP\377\0235s\237mh\2720p_Z\274\322\033Y\361\377\024\025)"
+	.string	"\245\326s\223K\232\357\372#\275\367\"\355\373}\354{\357-\377\244\326\342E\227%D\377\277h>\237\223\250\236\027]\226"
+	.string	"\277\013\237\340)C\347fR5\025f\300\257\324RN\366\310\224zl\256\255\354H\\h\207}Jz\240\013\201\224\332\310\236[\024F\276\205@\305v\343\0056D\320\310\367\t\360\315\267\007\n\331\204\255G\217\275\b\315aX\204\306\241\303\016nJ\021\352\206\004I;\237i\200=\217\250\326\220*S\\l$n\274\360\240\306V\023\023g\246\"5\226;'\240\364\bw\316\0344\277\331h\311MA\224!4\323k\234\"dvB/\340\334\003\344\363P\263\304\234"
+	.string	"\277\022\325\022\245M\314\fM\225pQ1q+'\340\354S\262y\346y\265'Rw\231)\262c\305\253\265H\365\006:\326Ev\225\001R\022j\036\033\017\b\325\224\276y\363F\203)\031\243U\300\371^\251\247\256\214\224\t?\274\221&\353.\023$\272\345\312\310\025\233\307f\210\027\032 4\303q/\351\3608%\b\275C\016M\205\207\032\230\3031\203\220n\354\3244\231\200\022}\301\331\201\307\200\251\242\330m\354d\335uR\265\356\302\322tqm)\261"
+	.ascii	"\b\001\277h\246\323.pI\344(0\007\250\364W\022\340\267p}\324\013"
+	.ascii	"\300\230\004\232Y\302\025W\203\037^\250yx\004\013\365\322g\224"
+	.ascii	"BX\\oy?\007\352\3733\204\263&\316\t\212d\306\371\335\201\361"
+	.ascii	"MS\347|\271p\214_\2251z\351\300d\332\230\034\240\007@\337\225"
+	.ascii	"\255\376\244I\007\340\364\257\246\371j\022i\0171M\324\324\250"
+	.ascii	"18}\301wWb\233Iy\211a\032D\352\2735T\362|\376\033\264\312\231"
+	.ascii	"\344\224\031\202g6\252\301\033\227<T2\033e6.\332\302Z8\306\037"
+	.ascii	"\267\340S\346\026e\214\306\361\362M\213\022c\356v\363\365\325"
+	.ascii	"\276\332\032\354\273Z\032\\\274\272\250A\377\254\0349\243\357"
+	.ascii	"\352\202_\317\327\263\206\257~\345\373J4\337\365]\217\372\213"
+	.ascii	"\231\327\026=\266\326\227\252\251\241\017\2079~\341\377!\277"
+	.ascii	"9\307\234r\330K|\266\243<\205=h\246\227s\274\306\242\036\260"
+	.ascii	">\2775\317!_{\376<j ~pC\204\267\367\366\026)\2318"
+	.string	"\257$v^\357\353%R\247\276\255+\265o\215\251\376px?<\302\252\037~H\244N\272\002\367\246y\3571\031\274\001\357\022\232{H\3050\215\316AMI\243w\250\343\022\032\007\023\\B\347\260W\226\320K\355\203d\b\276;\f\236\301\377>R\f\256F.ye\177\001\217\024\236\373\"\221\276\360\307\376\262\226f\244\274}\261\307\340\254\211\243E\326\021d\b\021]A\366\357\017q\350%Zp|$p\013\330\310\212R)2[\334,\022\261%\266\030\210\302r&\213\201W\300gsa\003\335\021\204\332\232\007l\240B\254yr+\340\024\360\310\341\202Fm\307\007\336\021(a\263\324\237\2347?\237\340\307JB3\363\225$4\023\267\316%(\342\314VZ\335\321\326\306\013\bxka\\\340\340\340\324\306\314\252\034\213\215\300\366Y-7Z.\210(\177*\320\236\020C+\302\201F\351R\306\354E\205\240Z0(\310"
+	.string	"\341\"\335B2\305\256\377\244\252H\001\240\0065CD\2318~\362\264\304ME\261\353\230\020\303\246u\210@\346\211\211\300>p#\253J\344\3675\217\250\236\234&k\270n\216\315S=R)*s\264t\216\255\204oL_\360u\270u/rH\331N\2363\307P\3764\023\333(\230\320\263\n\272\003|!m>\002P;\254\003\212XR"
+	.string	"\263\036[]M\375+5m\322\274\317\266\350\001\332\340\233\314v\363\250\2038\371\262\322\357\363}\036\201\005\337\247y\337g\r\032g\304\213\213\221(\326\331\033\336\005\267\326\276\255\255\367\266Xo\375\362\364\272\350\274V~\355\373\032\244_\217\260\"\004\215\276\357\373\276\211?\322\2626\2679\373!_\360?j\272\254\265)\0344\367\031\3154Nz\236\243\254\004\217\320L\264\211s\260)Gh\246\357\234\225(\226):\324\334Jm\340D!\365\226i\221%\\Y\3702_&*R\206"
+	.string	"\003\340\f\024\233/\213n\236j\276\330o\302\370\356jR\357\241\261\222\023\364\027\366\343\315\007\031\315?\315~\245\214^bz\276\201\266\375\tA{^]\200\366\255\256"
+	.ascii	"\221]\002\266\236u\261\251\234\\2KXd\244X\330^\025\240#p#\253"
+	.ascii	"\237\214\325]\250\262\342\374\320\317j\263\367\365-?\300\274"
+	.ascii	"u\316\362P\251\204\344\371\ncIU\221\250\241\371R\262\027\266"
+	.ascii	"n\2308\361\006\350\001o(\274\360\350\202\372\327\013\217\316"
+	.ascii	"\347/p\2555\251\345\224 \317\274\270\371cE2%\3012\252\324|\274"
+	.ascii	"Yp\027Z`a\205\177\007\327[\236\360*\244\360\332FY\300\220<T\242"
+	.ascii	"\320S\215o\3000\206j\233b\225\345\363\023\252-b9r\n\2728\215"
+	.ascii	"\245\220\203>\272\246V\334\004s\bE\275=\241\336\b\311c\021l\336"
+	.ascii	"c\326c\024Z\007\346!3\212\272\251O\007\340\241\022\205\306\301"
+	.ascii	"\300\275\036P\304\2648\tH\332\2256\366F\3474\0164\322&Qx"
+	.string	"8\221\345\b\2674\223\351\330\311\025\224\212\317x\362#\003s&\374\b\374\003\243\312&\027\312\bN\353\317\211\361}\361\016+\303\016\313\275\310\235\213`\236<\354z\357y}\270\3119\261x\327\363\232\367\352\320\261%\260\322\346\034o\230s\274)S \177"
+	.ascii	"\351s\340!\330\377\330\\}UX\312\376ZY\020\257\236\203@l\037N"
+	.ascii	"M@\241A\367\250oZ\263\2657\2656\262\317\360\031\331\263\264C"
+	.ascii	"F\013\332\324\317c\360\230\260\273\250.\3222n\214\020\242|\022"
+	.ascii	"\177iv@{\211\235U\006\313\fT\2172\247zi\330Y\0254|\254w\327Q"
+	.ascii	"kB\316\334\317\2077\262\252J\334\344\234v\376\201\007\377\331"
+	.ascii	"\bV\217-'k\315\b\235\237g\233\246\027\256\2672?/zW\033_kJ\264"
+	.ascii	"\273\2604?PR^u\007\004\377\237+W\330\210\027\235\026\005\207"
+	.ascii	"A\373)\232\266\331\217/=\026I/zk\215\326D\324\360\202\260^\001"
+	.ascii	"\035p\212+\240E_\215\364o*LTP\251\323\300\250\260\311\340\333"
+	.ascii	"]}P\210|\360\0276\262hq\351B\006\244cg\266,IQ\027\207\353\351"
+	.ascii	"\247<\241\231\355\330\204f\362\341\034y\245\tJ\320\\=I\340\034"
+	.ascii	"T[\344{\322\r\330\326\363\213\013\2325\312e\214\037"
+	.string	"\026\276}\202\310\231$\003|\210,\317\264\264\004\377Pa\342$\347\200k\340D\211Hs\207\316\335{U\234\250\016+\027\240\261\333\374\334\252h\255\325Xk\275\307\2262'\344J\247\233\310|[\210\026\0250\335\267H\311\276\304\330\350ap\332\261\203\240\202{\0032\fN#R37&X|\013\303\275\255C\030\206C\033\315\327\205\254k\025\356\021\355\203B\303\246_\207\027\f\031\230\263z\203\002\204\226\250\303\326\223\024$A\356\024\315H\222$i\f\363\022@\340\240$\032\222\nFu\362\003\023@TI\263\270X\rB\306\220\021\021\021\021\021Q\220\244$\2054\006%\344\352\254\305l\224\203\355K\313\007zZ \240\203],V\265\006\276\304\372\317\345\f\200\317\f\223,\356X\217\022\217\337{\f<\005\022H@ \373\2664\305\016\273P\027'H\323\rR-9\255\341Oxt\260}$%\273\303\222M\f\020~\246"
+	.string	"T\205\ff\253\023+\354hS\013\260\023(\216<\\\320\b\322\272h\024\345b\200\t\335\227\241\307\253*\276t\332\313C\034\235\021H\227\003]m'(\234\240"
+	.ascii	"\340a\302!g\277s\016\312\002\0138\331\233F\027\267\323\3630\335"
+	.ascii	"\022t\216L\327\277A\237\215\357\246b*\350H:k\240\343*\363\335"
+	.ascii	"3n\375\317z\032\346\203\247'\230\314\341\350Qr\257\024\r|\321"
+	.ascii	"\366N\302/\323m8\037#\235\263_\241{$\0274@{s\035V\320Ab\341S"
+	.ascii	"\007r\376DEg\346\246\177\355\024\032{[\030\036&X\274V\026gR\037"
+	.ascii	"k\246o2\017\245\013\024\024\205\035<\332\361e\337\306\b\017Y"
+	.ascii	"6\257t\304%\013y\363\223%\304\2227(\377\006\t=\031\317\3536\331"
+	.ascii	"m\232b>gq\317d\004\"L\023-\245\360\\o\3225\351\017\237\327\273"
+	.ascii	"\215J\324\006\240L\267\n\342\266;vx+\026m\035\312)\201\352hv"
+	.ascii	"\006\220(A\002\2101av\350\017\272\372d3\322\304\327\004\230\242"
+	.ascii	"\247B\f\364M\tq\020O\363]\200cm\2705}\244\201d\222\301\314\b"
+	.ascii	"\206K\202\320\205\017n\352j\234\377\234c\221\250\305\247\033"
+	.ascii	"\235L\3325\264\364\f\200z'fA?{\226\002}\233InT\303\327\363\203"
+	.ascii	"T@\365U\031\371&Er2\031\345!G\246\0243R\001D[8\3121\0251T\026"
+	.ascii	"\266\225Q}\211\324"
+	.string	"\267Vc\334\257v~\023\344O\375\352\372\225\273\203G\0361\224\223i\260\016\034L39\250\314\023\024\355tA\330\242\303\340Z\254;\367\253\354\210C\220\030\206\240\237@>\363ou\345O\240*@\t\304\306\353T\242\372\333k\224\264\222\375\2513\347\325\310\3235]B\337\260\\\024\006\013ch\024\261\324fT\2528BV\374&]:\207\\\3371\375\247\377\362O0\272\210m\317%\n\311\250$\022-\013\354\026n\032\237d\003\2328(4\303\336\327?\256~\330asM\025c\247k\224/\240\214\005\270\232\353\313\366l\377<\033\004\371\016h\0307\206[\232\235\003\344\311\373J\275\271\373\2173\266\215\254\375[A\025\227T\352\030\256X\375\006\\\221\256\f\314\013V\301\241\022\362\345\216P\350\273\300\276)\314#Cw1\223\361\212@\365\3651\243\217=\377\202f:\306\356!\203\220\351\346\301l_(\371\264\255\311\227\321"
+	.ascii	"\303W\b\231X\272@\272P\303\255/\021Z\232H\344z\260\026\237C\214"
+	.ascii	"\200Xvw\301\202\276w\350\255\t|'\310\023i,\001`\262OaA\nU3\001"
+	.ascii	"\241\333j\026\307\207\215e\370W\313\223\217\202\232f\357\t\362"
+	.ascii	"#\275|\316\323\252\336F\356H9,\023>\b\221\203iRP>O\f\307\300"
+	.ascii	"L\021!j\007<\357QF\326\240ZX]bQ\334(\361\1776P\367\236\021W\334"
+	.ascii	"{\342\234\\|\270\342G\332\307\367\022}\255\363\245vm\312J\276"
+	.ascii	"\234 \0315\367\226\225\373\225\262J:\261}\002B\233\024\260\323"
+	.ascii	"s\364\327\236n\002\261\tE\214\233\205\276\235#\321\324\325\013"
+	.ascii	"Z\203h\320\241\333\303\3702\230j\232\375}\231:t\310\004%B\276"
+	.ascii	"\340c\332\342\206\353\254Jl#\3342\025r\017\270$\234\306\223\352"
+	.ascii	"qN\026\317\274\347\246:\3758\235P\233\264\237\207\2102\b\301"
+	.ascii	"\272!5\231\213\303O\250\021,\376'O\325\3312\225\335\036\304\205"
+	.ascii	"\"u\222 u?\252\263\307\337\377\025k\277\b\343\006w\363\217\263"
+	.ascii	"\274\027\366\rM\251\360om?\203\235\016\2113nS\266\r\372>\347"
+	.ascii	"\206g\251\336i\222\277\312\211J\277YMO\346\366>2\361ry\344e\361"
+	.ascii	"=\254\222\377]T\001\223\020k\344\236\315d*\300\306\373\236\024"
+	.ascii	"W\331]#\240\344P\357\215\253~\310\370\216?Ym\016,\242\261\006"
+	.ascii	"\304\351\363\333\003|P\343N\b\366/_\313\247\020\211\036\030\356"
+	.ascii	"\267P\304\342\370\273\352\200Ge!\302\227\256\321\302\213\264"
+	.ascii	"\001\266w\240F\270\260\306 \260\335\335\007\362bp\372\003\237"
+	.ascii	",\002\264sw^\026.i\263\202r\023%m4d?\257H\335\300\240$\231\207"
+	.ascii	"/\3023JJ\222XTC{\315\004\370Adq\313\212\245\243:J\232\016\235"
+	.ascii	"QHV\005\235\r\215\232*](,t\321?>Xp\324\rB\216\346\266\364}\030"
+	.ascii	"\275w\260\231\321Ta\267\253\022\336\340\313\243\035\2769\215"
+	.ascii	"0&\303\254k\032\3246\324\245)\272J\334{\347GQ\263T\fo\306\250"
+	.ascii	"\266l\362\373\313;\016\302\204\025o\264!\022\022\276)\325\375"
+	.ascii	"\353Y\210v\310\351\245%6mB\216\251\033\2103\250PNo\335,6\276"
+	.ascii	"\033\267\b\0325\034\377\274\276\306\300\234\255\253;\"\207\200"
+	.ascii	"o\030\263\b\322ks\0207\201\354\216j\330$\340\372\275\346p\376"
+	.ascii	"-\325\253\261\357_\002\276\020f\367>.\214dE\344\376\275S\275"
+	.ascii	"\0220\220g\202+_\004\004t\343$$\200\236\330\301\254K\366c{+\375"
+	.ascii	";c0ge\265\307$c>m.\b\177\203\026\027\376\3022/`\232\374\271\320"
+	.ascii	"\035\277\265\231\271\221WI1\226Scv\357\3406\023n\254J\213\366"
+	.ascii	"+\247\347\360\305\202\020\313\030\240\367/95\n\213\200\261\330"
+	.ascii	"\305:g\204Of\334\021(\344\n\021L\312\274/\341\006`"
+	.string	"+\035J\357\266+\322g\205E\bV~\3103\221Q\272(\273\016\033C\246\202\211\024\323\022\357\320\017A:\251=Z\f\263\241\360&\027\r\317\3252t\355\327 \026\361\226\267\036\341\250\f\373\213:c\265m\244\267\365\326\026B`\302\234\025\n\316\244\265\237K#w\317\031\327e"
+	.string	"~\303w\240\253#|\204\341V\354\"\263`\347A\n\227)\2370s}\201\265\277\251\341\200\345\004l\207\006\233\361@\244\315\320WI\177\3054\025\330\035\361\217\003n\030\227\357#|\333\235B\313\025\306-\237~\272yi\217\327ez\t\250\022?A\306\335\0024\032\372q\205`\245:\261\236?\214\017\245\002\343\376\35322P\r\342\366D'\217\310\220\327q\341\022\243J\245\334\332_\310\254J@:\234\3542$\026\027\311\3454\0063\244\3658\037\\\201\372\203$\274\277fM\001z\275[}\260\215\3161aq\177\240\304\3446v\231\205\307\307\375\260\253&$\310\230\356\373\232\207\007\ny\221o:06v\304'\223\357\212\214\303_\031\022\240\205d{\017\374\337\247\f)\304\357\004\341Y\232\324Chm4#\267\237?W\206t@X\223\374\345l\212\034u\364\310\230'7\206\202b(\320\213S\265\322\237m\326\262\312"
+	.ascii	"X\307\332\304\373\022\233\030\023\267\317\025\322[O\221\363z"
+	.ascii	"i\255\317\252d\334\004\201Xl\202`1\243\316\344\262S\302'\235"
+	.ascii	"\2236R\f\317\"\013\342\261Z\351\2357O\341\f\2522\240\356s\360"
+	.ascii	"(\031\257C\331\303p\0061\341%\225\363\345\330\304\322\250\370"
+	.ascii	"\335\005\217j\263Y\203\340\177(P\360\225\276C\275l;\026\340\364"
+	.ascii	"Ea\203\006\332%\214\326]\345l\331\331\206\311\360\024Z\263\034"
+	.ascii	"7Z+\n1!.\237]\276\037\200@\244z\f\276\005\267\3429"
+	.string	"\024\200\020a1\322\026\355\215\321\2066\3508\243nu\032\304\013\002;\307\301v@\032\332h\253\003G\033\0354Y\315h\333\306\314\r7\241\340\223\345\203\006\363r\352\016\3574GS$}\200\373Hc\032\257\300WF+\235\310\363?\357A9\255\257<\346z\025]\r\2622\370\370\336Up\300\277F\273LU\376B\341\213^\t~\"\201\342\344\212\033\350o<\367\224!6~\341\366\240\035\\\330\237_;\247\244\371\350b\324\201\303\177\311a\223j-\222\237\"\246G\224\005F\177\375\245\206\3103x\f\352g\364^]\241<\264\201F\215\314\\L\357v=\221\303(\310} Z%\n\320,\205\273J\226\357\342\006\027\271\237B!Y!\006\227ko$\2527\373)\307<Wj#\367<\217\022\227\267u}\034x\353\337`_\217\326q+ \203\3025S<\334\030\233-\270\250\246\021\306\024PNa\032\351\2472\302\271"
+	.ascii	"\215X\026\263$\021\351\001&n\266C@\360\001\270\370k\216c\257"
+	.ascii	"1w\300[\036\222\341CqQRO\030pnI7\252\251\245\024\017\3353\303"
+	.ascii	"7:\013\352\317\253\363\333\005H\r\315W\221\375SL\365a\375\367"
+	.ascii	"\177T\242\206\200)1\212\374v\3630\333\001\213\036\273A\371f\035"
+	.ascii	"\375\002\245Yu\013\374O\026O\207A\306G\307S\272M\227:\203\210"
+	.ascii	"\312?\335\326Jd\262\213\323)~\276\206eM\f\204\366\271=\3001\027"
+	.ascii	"m8z\223\314\375=b\352V%B\t\350L\263\200\030R:3\220\004\036\352"
+	.ascii	"\024r\337%\005'\343\022}\217s\307\261,2\325\231c\005\362?\334"
+	.ascii	"8[#H\033[/\212\347\336\255-\214'W\260\276\226\301HbF%\306\021"
+	.ascii	"\206C\245#;P\022J"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\255\03257"
+	.string	"F6\250C\320XMc\240\030 M\337\"\016U\360X\206\241M\215p\twp\203\025\374\022\302A`\342\314\370I\003\334\270-\230c:\376O\300\213\311\255cd8\023\245v]\227\222\256\266w\331\330p\023\271\245L)\005\206"
+	.string	"\222"
+	.string	"\232"
+	.string	"6\342\273\210M\304kq\270\025\351\323\347S\200\277"
+	.string	"\005P+qa\276\225\030\346\333\262\253\361\231\230\357yU\233j\225\224\334'\371~\376\334*\362\036b\013\361"
+	.string	"\317\212\347\344=\265\203\262\245i\367F\025/\220m\307-G\3329\362\206\337\347\330\3323\207\374\264=,\336Q\034N\017I{H\336\205q\233\357\373\276\r\245\275\320\226\232&\373\354>\177>\205l\303\b;\035\225\352\250\344\2663\376\347\023\332eQ\233V\001\216vP\3305\350g\214\f<\245\353\356\356\224\375WM\0237YiWOLe\346hWK\361\024\017J\315\303Z='/\312]\303Z\215g\017i\r\376\256C{A\213\214\274td\225\206f{\b\005\\\202\326N\2741yN\336\224v0\316\303\035[\031y\331F\004I\375Tn\311\224[\362V\031i\253\317\370\303\201B\235\316@\322\2434\005W\001\327\247\353\263#P\326\200\226;wC["
+	.string	"w\363\232m\355}\363\2351\226[\025\352\270\035>\271\327\306\276MK\233\267\305\033\264X\306\356\235\233\373\334\371\361\225\357|\306b\220\006\227\017\230\225\347\ri/\371\334\266\03075-\311\320\372\213\274,\352\344\210O\"\fmO\333\013\355\321\027\337^\354.6\027G\013\r#\037gG|\243\342\314\356\323\347\251\275\002\353<\335\351\364\214E\261\227\355"
+	.ascii	"\366u\216rKJ\024\205\327L\222,\330\315\r7\241\210%\3415\217\356"
+	.ascii	"B\376G\332<&\362\251\024\026\277^n\2258\2133\230\217f3fI3V\216"
+	.ascii	"$\302q\004\b\257y\347\310\276\345\036t\377\035\225\305@xHa$\223"
+	.ascii	"\255\020\241j\254\305m\230\t\211\\\322\330Rl\t\206\321\241\224"
+	.ascii	"\261hk\324\256hU4E\213\342D4\321\335\032\254\204\355C\342u \267"
+	.ascii	"d\205\334\236;\250\210\350e\216[\255RE\237=C\"\f\305\235\236"
+	.ascii	"\214C\036\036M\363\261\321\2108\020\332\373!\355\3573\243c\026"
+	.ascii	"\343v\212\251\255\001\3423\365\202\330\2147\244\365\212xN\336"
+	.ascii	"\221v\326\340\023\267\262\207\2607h\203\370\340\341E\007\233"
+	.ascii	"\363\205\300\304\2028\016b\344\364\222l4\214\003\353\323s\310"
+	.ascii	"}\242\312X\003B\272\307\330Y6$\225*\201\365\250aQ\206fD\222$"
+	.ascii	"\205\264\031\301\004\204 \346\244\204\350\001\022\340!I\212b"
+	.ascii	"I\214\242\030\202\022\231\221\021\tDD\244 \005)HZ\003\020\004"
+	.ascii	"DV\027\203\004\344Hj\271Gl=\205P\204\031v\033f\3345\320K\310"
+	.ascii	"\311z\361\001\276\344\016d\22749\262\242\306\207\273\232\032"
+	.ascii	"\222F?\214\353|p\277LR"
+	.string	"5\0069\362\340\212\350\267\335\020\364\226Ue\245\276K\360RrM\301E\013H\f\025\352\240%\305qr\254\2574P,2C\002>D\317\350F\310a[3\247w\201\256\342\347\b\027Q\324l\343^g\210\225/\357$^\374\f`\332\340\247:\215\351\007M\252\232\245\211\232\342\034:?\365D\200/\001an\364\361\022\372\256\253\202\327\363\340\302y\217\337\332\324\023\227\314B&\250\257N\004\036\356O\361'\235'?\221\240\n#\343N\273\177\333\322?\336\337(i\336\257~v\346\374+\2158\361\257\242\24030\275\255A6{\021~\021\345\331\326P\340\254\016u\346\376.\342\013\222\346\364\367_B:\360\303*\367\245\022\267\345\377uU\260\337\353\003\203\023\036\207]\370\236\316E\253\205\301\360\004\257\017\237\336\245\242\326\204\24376A\262\256\b0x\373\220\034\360K(\240\240\032\177\337\364\240\020$g\205\036\334\204-'"
+	.string	"\203\2205*\214\262u\272G\253\245\220\201\350k\313^z\307\002>\0333\340(\036P\251|q\237\007\267\212\211\033I\2737\2039fw\245m9\335\243\032\017{x\177 G\247\244\357\242\013+\321;s\026sJ2\210\271\323\002\006\006\220\221\332c#\243\341A\340n\n\003\226\221\013X\026P( \001\370\220\327\217\237\035lg/\255\222k\006\030\347=P\250\342\217\213\021\236FZ\024b/3X\237OK$m{a"
+	.string	"\266\201G\337[5\306ML\004\245\246+M9E\300\243\211Q\364\311\2364K\347\031\242\321T\"\324\177;\f\216\354Q\264\314\307\265\023\007.(1"
+	.string	"\244F\032\263Y\273\236\007\f\251\275\321\354\335N\031g\r\027\316\034\f\020\314\361\330]9\362\211P{M\221K\3275\345\300\\bA_\0366\253+f\267\210\300rj\317*W\230\020Oc\211cj\222\311x\3233\260*\207G_ns\245\335E\314\036s\247\304\2610$L\312\016\206\207\f\212\323qR\336\331\342\310\346\306\277\tH\221\2633b\3262\364\220q"
+	.string	"\271\">>:\033\237=#\257\0220/\327&\031\225\362\374\337\204\213\260\350\244\201\245\024\341\2155~^\313f\024\227\262\033\226\364\036q\020\220b\264<tC%\210\333\210\241\016\260\225\006\213&\313\207B\233\216\367\bH\262Fn\013\277$\233\202\262\035\274\001\t<\237\346\b\204\272\270/c\177\321\037j\t\027\013\305\377\035\217m\tP\3577W\264\254\211\033v\376\335"
+	.ascii	"\255\352\235_\3300it\272\370$;\031\020\245\221(-\312\205\357"
+	.ascii	"\272\263\362a\327\240\246\213S\273u/\220\372\262\006R!\315C\013"
+	.ascii	"\340\272[\037\255T\363\201\023\2408_\317>\3066o\027\033\317l"
+	.ascii	"\016\370\201\366.\036!Sf\013\265\240l\241e\302\f()\233\316\036"
+	.ascii	"\017\316\0233\026W\351)6P\367\220\343 \244*\207\305\256\026\253"
+	.ascii	"\211\217\242O\220\200g\023\316\320\023\270E\234\231\025\233\177"
+	.ascii	"s\003\221\335]\270i!>\004\306\377)\3052\273JV\204\217w\210\006"
+	.ascii	"\203jG\035s\223 \025\225n\007.v\307\240\373\377N\273\370j\034"
+	.ascii	"\274IN0\355\034\301q\265|*\337\271G\234\327\005\351=n,\013\354"
+	.ascii	"'\332\372I \310\206\373@\2178=\353S\315a\322?\210Gi\232\310\263"
+	.ascii	"'\"F\237`\004\322\026\202\023i\016T\021D\244x\206\330c\234\357"
+	.ascii	"\301 `\274J\273\202\030a\315\0041OV\253I/N\323\003\342(^\022"
+	.ascii	"\177 \312c\026t\247\021\007Ln\304\035\271\3657\375\020\204\253"
+	.ascii	"\203\357TZ\035\364$\255\3723\274 \274\r\007aW1i\371\376\332p"
+	.ascii	"\033h\016\324\242\230w\243\350{\177\261\275\024\343\003"
+	.text
+	.section	.gnu.lto_.pureconst.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"}\006"
+	.string	"\026\320220ee\030\003\300\300\300\300\300\300\200^DD\n'\036\030c\253\240\240\240"
+	.string	"\213'\252U$#\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214 \263\003&"
+	.string	"#"
+	.string	"$"
+	.string	"\336\204&a*\302\024\204?\270\20378\203\327\202\227\202\226\340\b^\007n\340\025x\004\256\017\270\200W\241\252\252\032\020\2478\212\237\270\211W\342\221\370\210&\242\2058\210\366\341\036^\207s\370\206kx\206c\370\205[x\205S\004?\236\217\3678\217\357\270\216\3478\216\337\270\215\3278\215\326\214&\343\025\343\005\243\275h.\336\242\261\370\212\253\030Z\0024\224\026@\013\200\326\223\346\244\325d\212\311[\362\224<\311C\362\2164#\255\310\213H\033\362\204<\310\201<"
+	.text
+	.section	.gnu.lto_.ipa_modref.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\221\020=1"
+	.string	"\2060\225D\300\032%\351\222!\n\242 \n\231\302\204\021\\\327\354\202\210D \004\300 \021\004QR\366\323b%E\020\f\356Q\005.\201\227\b\2772\210W\001\020\023l\366\212e\235\223@@"
+	.string	"\200\341vz4km#r\247u"
+	.string	"}"
+	.string	"\206"
+	.string	"\2319\326s\365\200Pe\306\n<\204\031\203\n!\004*g\224\004:\240\247\200\241\236BB\007\330Z"
+	.ascii	"\372\031\364z::\035\025\313\376\314\351\211\323O\234\242N!Bz"
+	.ascii	"\266\342\ta\225\316!lQ\220f\331c\316\263,\343\t\265\234\222["
+	.ascii	"\310\234k\332b\316\261W\305\006\322w\342\232\267\232s\355?\252"
+	.ascii	"e?3yO\232^\373g+\201\232\377\351(\307\261\204?\340#5\222b\025"
+	.ascii	".]\347*\222\022>\247\021zn\244\345sw\244\335H\037\204\346\203"
+	.ascii	"3\263h\225\203~\007!\247\352\363\351\366\246\264\025i'\322\227"
+	.ascii	"\rF\354\374\030\334\005\337\314|\325\207Zz\n\276\020\226;\031"
+	.ascii	"\375j~z\366\270\3639\312\0044\355\242\024\213\206\\w\305D\340"
+	.ascii	"*\326\345\001\2320\361\025_\235\252Y&\235\247\352\275\2456\244"
+	.ascii	"\247\252i\325i\007\357\3167\327\267\253y\r\374\335\335\007yM"
+	.ascii	"w\322\256iP\247\271\223\235\236\247J\025\252LOM$\022\231\324"
+	.ascii	"\257\004g\265\334\020\310\305\225\310!\361\347MZ1\023\257\034"
+	.ascii	"\275\3167b\365zh\363\366\213\230\025\342/\210\244&}h\222\261"
+	.ascii	"\263\232<\017/\246\303\313\367\3430\003)P\272\030\343\353!\371"
+	.ascii	"\222\276;"
+	.string	"Vd\322\367\222b\033Z\335\251\206\317\320\304P\330\214\254\256\224\335\246\244\357$}\027\322\302\025\256i\351Q\260p\006)\nj\351B$H\332uL\bC\036\310s\303\303#\004\352\033\033\32476x\330\230>(sl),{\376\034\302!\3043t\003g\207\263\361\246.k\320\310tT\360\315\3202\326/#\325\2141\004\243\233n\365\007\313\371\305\253\\\254\312\026\377\342\031\313\342\033\267\035\315\237\264\252\025\277\212\233b\243D\361\243\245{-\305,\313$\"\210\355ZMX\001\005\211LLaD\3254\b!?u>\256n#\252\351\304\032\262P\301r\006)\212\2273\203\022\353\371\341\320\324\304\370\005L|\305\030\201\344\250\201\311\252\031\031I\222\264\006\301\004\304 \006!\205{\022 \2045Hs\016*\231\221\321$%\311\326\032#\243\241H]t\273\334p\230\314\377\3775o\270\264\351\203\275\037\306\026j\347\325\205"
+	.string	";\277\2274\376l\362\355\013R\374\223\210L\bL8\314"
+	.ascii	"K\025\220q\225m\254\321\214+TO5\2172\3222z\233|\023&\226\263"
+	.ascii	"D\\C\244\304U'\374\307\024t\333\316\221$\211\227\225\f:a\376"
+	.ascii	"\206\344\264\241\373\032u\340-*\266\304!\231##\257\3646\363k"
+	.ascii	"]I\013\313.\004\206\375\311\002\206\255\tT\363\327w\006\207\202"
+	.string	"\314k\355n\356{9c.\017t\250\262r\2112\303\030\"H\257\216\373\231\021\027\204\254\001\211\215\376\330\322\030\331\331hl0\2012\207}\262e\323>o\356\376\243\221H\371\234\357 \303\253#\321\323\347:\262(\304\374\002\027\234)\321\250\274\212\270]Ag\n\203\326\001\323\271\250\244N\241\222V\237L\217\225=\362\316f4\235j\256Y\001Q\3248\375x.\324\326q\342`p\264\271\236$C\031\220\344I\343\003\302\3549?\230\252\355$\032QE\030\030\315\341\207\301\253A6\323\210\257!;\251,\306\"\321\366\212\330\ruA>\217\371\036\357\226\262\324x,\352\\\035\027\235d\321I\300\r\211\353\002\320W3\230\001\b\246\021\231\267\207\201\3615\001\216<9\210\331\316m\322\204\246\253\202YN\2071\266p\350\253\306d\310\2057\264\263<\\\335\215\204?$p!_O\013`w\310;V\032\302\302\203J?\301\334"
+	.string	"3\321r\317\037\226\364\265Wf\205a\004i\247<K\315\231Qow\306^\331\037\246'\021\256I\001\272\241\300\"\245\205\301\211#\3237#\003\301\361\230e\357\004U3\217\342R#H\030\361\265\275\230\242\337R\354\272 \374\341\364[EM7\246v\246\260\334f\373)Rh\r\0061\314G\226\365\246\223!\252a\260\362\225\017\007]+r\370p\213l\302R\b\022\315\240\177\317/\351\177"
+	.string	"\017\233\261\375\334&\340\226\276\337R{2IF\336S\305\006\313\215`\334\033\032)\217\270\331\311'\321\244\322\211t\217\251\327\0323\254\177\360\007\226'8\323U\322\364\271\254"
+	.string	"2'\021|\261\215.\025\226>\204b\220\303\335\\RB\177\277"
+	.string	"\025aG\3130\271\n!\370\345\3560)\347G\213\242\271\345\367\327>\254x<\240b\315\3665\354\202\020\030\232\021\263'H\037\376\377\225\244\r\02552vT \373\233\f\343\006F\b\211&\362\221\257\031\271\223\251\005\022K\244\264h$&\267\235\263\324\231\2542\230\364\004%\215dq\343\351\376k\177\2132\022SF"
+	.string	"\366B\315\023\244\244\005\223\222\240\267\361\333]\363\337$\353\330\217\252{\357\266\206\263\357V\334\r!\371\024\232\305\025\024PA\325\274ff\007\312\344b\216,*4\200\220\301\231\371\243'\222\270L^p\256J3\367\336Eq\225\310\274\312^\003\020\324\nA\n=\271\315D\375O\030\201n\024(\217\032\336l\246\276\254\351\234}\215\366[\262\3116\305\331l\225\222\003\244a\367&\267\320=n\334\245Y\273\220\201QA\352\307r\216#;&\024\337\262\360\330\344-\226\316rB/"
+	.ascii	"\241\347,h[k\n\322\227y\220\225\277-J\346\260\341\017\255\244"
+	.ascii	"\232\006\353B\376\255v\324\026\303\375\277\337\375\212\223\377"
+	.ascii	"[\037\256'ra1\005L\271\302\037\327.\200\301\013\265D\023\231"
+	.ascii	"e\237\004;WG\242\211_ZM\202\r\311\211OR\306\310\305{\251B\t\276"
+	.ascii	"\207\336\304\255\3610\375g\2103%\256\017\374*\300\007"
+	.text
+	.section	.gnu.lto_.lto.e357364e5c98059b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_afatfs_cacheLruRemove.40.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`7\003U\023"
+	.string	"\266\337tI\300\324M:hf\353\376U'\321\330\237\264\310D\023L\313\325\307\032\231\222Is\210\354F\001\356fN\225*X\363\261=:\256\337\216 B+\025\333\206DQ\fA\0063\303\273\310\243m\373\372\211s\342\363m\033\331D\312\224\002_"
+	.string	"U"
+	.string	"c"
+	.string	"^\320\272,p\223\357\322\273\200\357\3226;j"
+	.ascii	"\2069\243\200\304\322\r\221\325\234\023\\\020\267\275\305\372"
+	.ascii	"\244\267j\363\205\356\272\341f\3362\300\372\016N\207\1777\031"
+	.ascii	"T\346\334#\301\345|=\004:L\034\002\340l<\023'\036 \027\272j\300"
+	.ascii	"\325\250\262\034\3149\2557\034\316\355\272m\032\333\r\354\245"
+	.ascii	"\020cT\n\212\247\250\371\".}\001F\177\273\364e\276\313/l\224"
+	.ascii	"\"\222\243\321+{hF\367\203}on\217\375\334\357\272\372S\265T\265"
+	.ascii	"w\365\252ZU\375\027\200\234\021\356#|\314\271\341\312\310\334"
+	.ascii	"\311\244\237\022\333W\373&~\302\366\234k\3305\347\316\221\214"
+	.ascii	"9g\202J.\257'\033,\032\342\0074R\005\315HB\362\366FP\337\335"
+	.ascii	"\023"
+	.string	"\235\217\322\315\021E\242r\362\340\351\332\262\037\211\257\247\303x\f\230\357r\203\334\246,\341/\304 \027-X\350\036h\024R\342>7\235\335^]\374\276\020tP6Z\304\366\312\211D\330(e\273\302U\260\274\350i\316\311\340\322\236]\347\362\2461\262\b-\017d\023\302XH\342\020\245\246\362\022S\t[dj1p\266\002\266\254\304X\300\220V\003Q\016xfAF\003_f3\032X24\357\315\355q\353\007\325\216fkZ=h\347\261C\207\334oOt?E\254\257\035\336i\367\342\361\031r\233\372V\\6\211\260\261\312*\007\323\222\\\330X%\275\305!\246\204\210\371\r\026\002\001C\250q\\\302\020cUa\371\2440\007\220\002\231\031;\017\0208ffF&\254Z\f\265MC-\335X8\225\025T0\341T\351\276\"\205\246\202\361w)\241+\b\254\r\243\252J`m\020^u@&j\267m\331\341\316"
+	.ascii	"z\\\204\232\340(\207\262\345\330)\"\347\301\001%X\276\300\r\""
+	.ascii	"C\361 \022\201@\016jA\204\205\317\234\217\r\334\303\355\032]"
+	.ascii	"^\263I\241\002y\271F@\236rPO\375\2766\013~\201\226]\232\253\366"
+	.ascii	"\307P\304>\314\236\\k`\241\006"
+	.text
+	.section	.gnu.lto_afatfs_cacheSectorTouch.43.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`q\002\225\022"
+	.string	"\346\240vH\300\324M:X\022\364\347\210\002\274\314\200\277\035\210"
+	.string	"e2&\341\246\204\nYG%\330\224B\216\212\270\241\306\217m\213\374\357\320\236\313%\265\222\3300\210d\273\004\271\276\016\343D\216\206\243\246\bd\314\3038\255\221\275\345N)_"
+	.string	"W"
+	.string	"d"
+	.string	",\336Bv\036\037\231d\227\004\022\321\356\0320\002\325\247\200\247t\237\362(\335\247e\366\023\200\016;;\240b\207&(jw=5q\331\247\324(\363\337s\022\2606\373\264\271,\251\331\\e\201\233\244\020'\265\031\231\262\204\343\364\360\361CM&\306\024\203\335u\004k5ww\333\016l/\260\243\215\017/\241l@7 \264\230s\027\243\332\0302\304\203&\360T\0047\2433\333G&j\t\373rw\327\232ck\264J\243S\217\3564zj\264<\317\037Y&?\234j\337a\332\005\2213\262\270i\244\343\273x\030s\037\227\330x\334vw\365i\307\330\253\317\257l?\332\017:\225\205sc\2429B\213\271\247"
+	.ascii	"op*\343Ru\226\244\363\323c&\022\261\324\207\206\360\032QFED:"
+	.ascii	"\004B\205\216p\032\237\312\237\361!\303\272\327\330\200\206\360"
+	.ascii	"<\367\257{\350\326c|\nl@\241\315\3410\\\027j\332\335\004\236"
+	.ascii	"p\241\327\225D\344n\273\273\022\364\027\025|\024-\260x\360\323"
+	.ascii	"\277\320}\006\032\\\022\\\032\270(|\255\257\304\237\312\013\013"
+	.ascii	"L\213\345s\331\360\322\362`/\317\345\325j\361\276\330\213\247"
+	.ascii	"2\3000\013\256\230\007\003\203\305\274\225\017\355r5\247\347"
+	.ascii	"\367\360\224\303\321T\306*U\372Lv\250\364\004g\205\320L\251\216"
+	.ascii	"o\345D\3549\\\001\220^\254&\034)M\371\2409\"\265S\224\237\233"
+	.ascii	"\220X\024di\204\234\017~\343c5\035\035\204\212\0012 \220\002"
+	.ascii	"\021\262\323\r\365\355I\017\275\255\2009l\376W7\246\r\\/J-\005"
+	.ascii	"4o/M\303O\027$*BK\235SU\003\006\267\262\312\214\017V\262\\\255"
+	.ascii	"P\216\270'\310\020\261O)\213\002`:\232pl\214N8r\017hBm\323e\351"
+	.ascii	"7f`\252\345\020p\330P\223G\001\031\352\034&\204\006\270\376\300"
+	.ascii	"f\350\001\321\232\317\225\301\226[!_\312\325\270\326\036"
+	.text
+	.section	.gnu.lto_afatfs_cacheSectorDemote.44.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`q\002\255\022"
+	.string	"v\340uH\320\362&\035\223\210\335>\031"
+	.string	"(i<\307h$P\3619b<.\204\245\314\236\365\321\201'\315\345w(\303L\353\34707[\006C\351\302^\334\312\301S\017\007\2737pz\305Ob\017\032\022\361\352\301=\255\221\275\345N)_"
+	.string	"W"
+	.string	"d"
+	.string	"/f\327q\222Ej%\241TTk5`\004\253O\0017\351>\345K\272O\317l\037"
+	.string	"8T\332\001\026@2>R\265VoM|\366)7\316\374\357\\\004\fi\2374\227\254\220\346+\013\324\344"
+	.string	"A\022\306H\023'\033\036\277=z\babT-\250\265:\202\341\314\335\335v\003\333\n\354\210\024\277]F\331\210\244\200\324b\316]\214k_\300\020\017\232"
+	.ascii	"T\b\\\314\322l\036\230\270%\354\313Zk\365\336\330\033\275\332"
+	.ascii	"h\325\243\273\215\236\033-\257\363G\327\310\217\240\3609M\265"
+	.ascii	"~\310\r\251\270y\264\302\207\361\333\313y\314\262\351h}\332/"
+	.ascii	"v\353\363-\333\217\366s\036q\347\272lp\232d\246j1w\025`\rn\201"
+	.ascii	".wiK(zv\304D!\226\373\233\037\234\006M\261!\26582*Z!0\352f\b"
+	.ascii	"\037\242+?\350B\376\272\317\330\220\\\350<w\332\375\346\327g"
+	.ascii	"\320\024\033\321\206\313\200\375\347\251\326\232\300\022\376"
+	.ascii	"\023;\223m\b\305\3471(\370)V\276x\360\323\267\320}\006\031`\021"
+	.ascii	"X\030\300&\320\027e\231\236\264\250\270\274T(\213\206\226\227"
+	.ascii	"\367\305<\226\330k\305\243\262\026\357d\200\277\n0\231\347\362"
+	.ascii	"}2\257\305S\273\254{\263\363w\200\022\201\253-\214W\313DG\226"
+	.ascii	"VKb\203\223\233\252\305AQN\310\256\004\013p#\346z\262\241ZU\017"
+	.ascii	"\231)\271\335\226\364\340@E\243 N#\344t\360\032\324\365\224t"
+	.ascii	"0*4 p\002\021\262\243\033u\354\311\013\275\255\2009l\376W7\246"
+	.ascii	"\033Z/\212Z\bh\326^\372\206\237$H\024\204\2262\247*\006\026\334"
+	.ascii	"\352*2NX\311r5\204\002qO!C\310\376\244,\b0\223\303`\023\273c"
+	.ascii	"\204\035\320\231\332\206g\3517f \252\345\020p\210(\262[,\331"
+	.ascii	"\004d\262\003\023\207fB\214\205\353\006\266\204\016\f\203\035"
+	.ascii	"\2519_\031\265\334\020\362\261\\\215k\355\001"
+	.text
+	.section	.gnu.lto_afatfs_cacheInit.45.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\266\003m\030"
+	.string	"\246*\230M\260\020V:s\216<#+q\220>\241\242\337\255N\252\206\362\223\030j\377\377\234\360^\356\254zK\315(\343\321\330\275\001\365\fE\2268\264)\f\344\3304\372g\240o\354l\376EgA"
+	.string	"\213\313\307\362\203?\233/Z#\204\020\262w\222\001\201"
+	.string	"|"
+	.string	"\205"
+	.ascii	"\235 \275)\340\"\347\315\362!\347\315\356\226n\326\315\263\272"
+	.ascii	"\326\355\004\340%\333\020\350\034\345|\2229g\027\026\321\253"
+	.ascii	"\227\3027zkO\321\323,\361\255\365y^\362\202F\272\325\366\264"
+	.ascii	"4\217-~\316\264\241C\271\240&g\347C\334EK\324\374\244\271\271"
+	.ascii	"Zi^\226\005l`p\370X_J\221\030<\034g\177eV\227\213?\274\311\003"
+	.ascii	"\266\272\265\346\027e\220s\356\253[g\336\252ww\210\356.\351\306"
+	.ascii	"D\001@\2614\347\333u\335\023\276BE\004'\347\\\242\342?\262~\316"
+	.ascii	"\315\256@\273\327\335\354\323N\013\027\356uM\340\351\204\021"
+	.ascii	"\006\333\272\205\270\213{\335'\361\371\340k|\323}o\267\356m\026"
+	.ascii	"\276\275\272\267U\367v\372\013\337\017\361\220b\261\036H\314"
+	.ascii	"YC\273#\033M\"\022\027\376\335\357\003\317\266<E\037\330E\371"
+	.ascii	"r\316\254\367\364\207\017\036E"
+	.string	"\355\302.>\317\344\307$u\226t\344\234Gn\006*\f\302\373-\345\246n\003B\206\257\304\275\024c[\322\b\326\206\313\225\352\024\237m\0077\252&\273\"\337\222R\022\016\322A\261\375:\222\232\276H\361gvE;\301\333m\317\366\203\037\251&;b2\303\215N\376s\3149+h\bw\201r\245\235P\262\350\305\b\347\315\263/\241v\304$\036\3725\001a\334#\276\373u\242\241\344\333\253g7\354B\252\3071h\266s\362E\335n\333\255\333\3027\322\371\366]<\337\363\2617\214\204\226\302\362J\201\255`\240\275\\\262\230k%\366Rq\301f4\027\311\200\226QPg.\026\231l\346b\to\3077<\177\314S\321x\303\270\024\367\032E\236(\306\310;\362c\031\374 \213t\271R/s\316\0315\360c\024\177\370\006,\260\205\261\301\335\266[\370\206\352\201l\341\017\336\257\315M\235,|TKp$\274\306I"
+	.ascii	"\032( \307\031,\214\346\310M\245x\205C\330\337\3235\341\241]"
+	.ascii	"M\025\354M*\310\221\3518I\250\221,\243\224QF\231\241\221hB\005"
+	.ascii	"\206:p\002\021\242\254\016\021`\3012E$\022'\273\001u\240\361"
+	.ascii	"\354\361\207k\333m'%\264(\022\251a\310I\376\002\231G\007\242"
+	.ascii	"\254\212MH\2638*\314\244\222\244\3247\001\311\007Vm\001V\023"
+	.ascii	"|\r\003\277\323\221\013\034Q\377;\202\325H\f\263\376\240\364"
+	.ascii	"{\310=y\256\244\211\233\216\271Q\265\bX\363\205\323)\266u\243"
+	.ascii	"\252\347t\330@bC\276\336\205\034\321Ka6\204\266\3638\303\260"
+	.ascii	"\201V\343\337~\351\224z\331\021\316}`:\024\352\016\024r\250\236"
+	.ascii	"\311%\025\003\f\371\240\306\004\232?"
+	.text
+	.section	.gnu.lto_afatfs_cacheSectorInit.46.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\214\007\205'"
+	.string	"\312C0\017D`^Rc\347\321#F7e\013\305r\317\035\016\273\"\213~\206\321\375\203\340!\324\r \002*\270\034?\3140\250x\321y6Y\025\333\364\003.\360i\360%h\006}\005,\001\313s\234\326\265\221\335D\312\224\002\327"
+	.string	"\324"
+	.string	"\347"
+	.ascii	";\336\305DP\264\247\371j\\\216\305k\361\t84Xa\353\272\026}.\276"
+	.ascii	"\331\317\212\337\362\304[\2274W$=\247W]X\335\2726%<5\212\246"
+	.ascii	"o\207\r\364\324\002\331\024,\034O\326\343\315\005L\352\204\275"
+	.ascii	"\221\260Mc\237/\353\332D2\007\337S\337\332\017\273\330\361c~"
+	.ascii	"\372g]\241\274}Y\327\025\311\026|O\031|H}\312{\220\372\324G{"
+	.ascii	"\216\321\217\025\252\302\2258Seu\353\272\376n\024\253\366\370"
+	.ascii	"\236\232\362\256=\372\3167X\2369\345\320\224P\357\rPN]\355\226"
+	.ascii	"J\211\264*\225\252\247\275\254/:I\245\222\363x\032\304\230R\006"
+	.ascii	"(\177\360.\331\231\033\220R\312\336\253\235g\305\252\rR\016M"
+	.ascii	"Yu\333\343\260\256\253mR\211"
+	.string	"\344\366\3356\021\333Ivo\031n\244\354\036\027]#\020Y_pSww\r\0342\264{\267\326\016\3674\200+\231\342g\202\016\240knq3/\206\240e\210\356\333$\2536\334\250\n\335\241\373\265'9\273\334\246\226 m\324Os\214\2131\022A\323l\036\177\023\276,\303\323\247yx7\242\005\256u]/<\037\206\206\377\365\324JK\366\311%\365\251\320\275\332\037\260=\355\260\304\306\242l\324n\"\355\335\262\177A\r\231._-;\301\321\2175\202[\033\375X\027\245\326D>\353!\237\265\320\217u\320\217\365\001\237\265\201\247\335\005N\366\007x\363O?\366_\237\265\365Y\237\301\335\302G\352\212\234+\327\\\215D\355V4)\230)O\373\355\267\201qj\347\031\206\025\366\345l\316\001\315a\227}-A\267\227\345\3456u\347\244\367\tF`\263\023*`\363\360|\210\002\366dyyI\316\265\331.^\027t"
+	.string	"ms\213\347y\261\302\352\311\214;\236\263\035\270g;\2135^^\250\254>\346\3515p\337\3664\314\352\211\224;K\257\035\343tF\340\225]\235\357\b\177\006\035~\216\3703Wy\230unG\205\372\364\316G`\203c\203%\266\364\352\335-\023"
+	.string	"\"\346.=\272Dfnw\226\350&\270T\216>\250\026\335w9\337\370q!\212n\017\371\345Fe\305[\327uU\323\036\347I\bN\360g\342o\204\021\334\020\213\240G\316\257h\262\212K\023\255\267\224w\023\334\002\227\312Fp\3758\030A\377\313\177R\237Z3\311\271\250\244\263\tbX#D\202\252!*H\203\340\376\214U\034\330\330\321Z\223;\274\273e\243{\257\2233KLJ6x2\210K\303&\033\252S\223\216!\261\b\304\203(\203I\004\261\306P8\004\340\341\204\342\f\035\302\031C\246\036E\341\257I\351\307\244$\274\361\033:\025\177\023 \270\t\007\321\351\247\243\251\311\351\007\324\214\372\325\262o\316\t\232\250\213\264\337\001\314vu"
+	.string	".\317\230R\270\242\234\035\305T\373\210\305j\035\305\200K\263\272,(O|,\315\352\350\002\\\373\230\305:\351"
+	.string	"\\\232a5Y\342X\232\201-?\250\266\007\313\344\003pY\266DI\025\214e\031\223.\352\"T\033\204M\"\002\270\324\202Dy\204\271\324\302\244\033a\213\030\201WQ\246%b\207X*{\205\030\221\270\202\360\312nT\177\355\345=\201`!]\302\3760\372\376\264R\367U\256\242`cF\366^\373\004\n\373\244\357<"
+	.string	"\263hSO\035\251\013\345\240k\241\354\032}r\356\336\200\216\250Q4\306\020c\206F\204DFA\222\244\003\240\002\021\2612\036\0210\261B\316P\211\330\334\ro\f\255\r\024\255o\247$\017\024/e\016 W\376!\257\251\271\017:P\250<\210\221\314\177{KP\356}QK4`\013\020?G\375\007\203\353C\247q\301\215[\037\230\261f\2640;p\255\202\350\214q\314\334m\"t\244\031#\257Y\021\036-\321#\212B\322\006\240Di\007\231"
+	.string	"\246]5( \231\025\322\202\004\f\266.w\b\235\303\342V\326\253a\003"
+	.string	"\343#f\fB|\ri2\262\365\005s\263\317\034\326\245\260\020 \312\240\257\300\212Q"
+	.ascii	"\0347\225B\265<\233\301\232o~\316\226!\342\345G\307\374#\316"
+	.ascii	"PT\rI\217Ir\fg\255 \025=\243kS\200\221\244\357\326\317\255\230"
+	.ascii	"YC\b\273\261l\324\374\344\332\311\371\366qL\202\245-\311\177"
+	.ascii	"cx\326i\377\037r\234\266+\311\363@\\2~\361\332O\343\237wn\024"
+	.ascii	"\0340p\005\250v\206r\342\027\001\333\317\242_(\274\307\242\017"
+	.ascii	"3\372\037"
+	.text
+	.section	.gnu.lto_afatfs_sdcardReadComplete.48.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`:\006e&"
+	.string	"\312C,\017Gp\334Q:\375BA%EO\301\302\260^\260\006l\375\236\222&\021m\264\\\370\214\255}\277\261K\"\375\326\235\315M[\247\270\fM9N3\323\035\210t\337nTI\016\201R@\362c\347>\363#\252\265F\b\221;\311\340"
+	.string	"\322"
+	.string	"\335"
+	.string	"J\003\200\356\022sL\304\362f\2277P\240\273d$\211\206\333S\276e~\326\251\f\257\205\203q\367R\345\361r\357R\002[\270==\360\235\372\024}"
+	.ascii	"\365)\017\231\321\006\344\270\304\nQ\2464eQ\273\367\362\372\b"
+	.ascii	"\247vx\235On\355\301\335lj\212\266\035\362\267\236 \211F\274"
+	.ascii	"\316\007\001\225\017\251\347\256\216RvE\023$\213py\3311\211\032"
+	.ascii	"03\363\344W\307!\266\307\266\201\312\307\324qh\2056\310\250\227"
+	.ascii	"\035\243\320\365\007\232\363WG!\366v\340\352\030\304\332\320"
+	.ascii	"\335\031#m^v\234B\037L\221\001\362\255&\253\352\220L\027\273"
+	.ascii	"\335\2014\332\264\t\324Q4\003\025,$:\344\022\332W\266\302\254"
+	.ascii	"H&\333\027\373\203\344\027\363\331\205\204\272\265m\270\367\262"
+	.ascii	"uB\3728\377\234\371:ff\301\234.\003?{'%\365i\332\027;\332L~1"
+	.ascii	"\237\\\242\212v\2155\374\206\212\266\255?\3664+*\314\370\334"
+	.ascii	"\nb\264k\314K\243m%\363/\224\215I\302]\305\334\226\203r\226\001"
+	.ascii	"\254\226\201V\313?\272\036\313>\253\345\334\332c\331v,\277\372"
+	.ascii	"\260s\372\345\217\342,\177'\224\322\343\ty.\317{{\254\341\271"
+	.ascii	"d\351\027&\017;\377\353c\302\207a\001\007\3630\276\030O\2600"
+	.ascii	"<\030\360\227\351*YE!\002\307\313\233<\343\\\214\"\211\006\353"
+	.ascii	"^\370_&X\230q0\340\001\342\362\366\350anQ\313R\273w\t\341)\257"
+	.ascii	"\270\315`\026v\271\027\215s\261\2013\032\314\353\226w\3258\027"
+	.ascii	"7\230\223l*\353\336\273>e\256\301\274>\355\225YK\235\022}\345"
+	.ascii	"\314\341\261\004|1W\273\2558\2310\325\004\351\300\222\3456\244"
+	.ascii	"\276O\305$\376fH\310\352\336{\341hD\021R\334MQ\2016O\261\222"
+	.ascii	"i\242h\025\355\332\027\374\320\341dk%\277\371?5A\231I\205~\261"
+	.ascii	"\377H\023\324S\347\372\247w\b\375\247\277u\005D\247\022%j+\231"
+	.ascii	"B\024\252\3534\211M{\355\035\274v\240\272v\333a\256Y\262v\320"
+	.ascii	"{\357M\233l\342j\200w\236\021\035\315\263\350M\247\256\325\253"
+	.ascii	"\344W\035\255-RUch+}\032\355 S\315\222\265\303o\362\211\243\271"
+	.ascii	"\341\300\312\350fD\f8\305\313\212vgd?\303?\365\251O\343\264\326"
+	.ascii	"\316\365\223\311\246\361\271\225\247\330fl\256tu+\307\230e\334"
+	.ascii	"\fp\301\331\275\027\303\307X\305\313\254H\233\204Y]\030s2=\376"
+	.ascii	"\222\247o\372\002G\357%\365<\274\360\365Z\300\200\321\363\345"
+	.ascii	"\202?##\032-T\033?\027H!\202\300$\337O\270\"\001\217\222z\301"
+	.ascii	"\237\f \216}BB\243\244\236\221\017II\330\343\001\217xHG\275\030"
+	.ascii	"<_P\310\023j\300@\031\277 /\t\b\f\362\326e\361]\305\267\264)"
+	.ascii	"d\3056\352Z\371!\225\231\204-Z\242\275E\273\2635)I7Xr\212>\b"
+	.ascii	",\277kX\205C\3277\030\233\230\343\322\361\225\263\035\256\252"
+	.ascii	"\271\351\262\266\222\203Z\345\361\004\205\230f\006\340N\007\235"
+	.ascii	"\325\275\305;\335\213?\334\016\210\235U\235\240n/&'@\r\240\337"
+	.ascii	"\224\007\275\3470\365\247"
+	.string	"\201\372^O\241\b\241c|j\2712\3325\035\235\252/=\004\354O3\213\030a\357\304?K\223\"[j\"\037\316\347\f9\220C\304 \255h\027g\005s:\231\312\222\363\203H\032\256\225\001|\250\201(\002\021S\210\021\231`\002\021\031U\016p\002\0212\263:\020hI\2324cu\374\362\341\002\274D &2\030\035#\b\304 \277\326\020\306m7\276B\341\263\362W,\346\230\020\350XI\2076\302@\027\256\365\004\303\0213=\324`\362\220\345\270.T\223:,\t'd\3330\313\216\246Od9\013\201*\353\00486b#'DI-:\177\362\343\337\005\365i\201w\340\241oe\331\317`ApE\314]\025\t\363\224am\n\254\271aD\027\037(>d\207\226\264\271\007\250]C\017\2633\204S<\354W\335H\301\021\007^'\211\320\242\210]^\363\360\360U\373h!)\177F\317\003\003z\235\212\032\004"
+	.ascii	"!D\3606\f\034\211\242\024\263<\350\3341i\367?\t\2544\\\300U "
+	.ascii	"N\354]IQ&\334\272\334\235\220\316\306\225M\202\002F\336\315\263"
+	.ascii	"S~6\321\365\2134u\377\362\357\017"
+	.text
+	.section	.gnu.lto_afatfs_sdcardWriteComplete.49.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\225\006\255'"
+	.string	":Ep\017Gp\234U:_\247f\334\322\tK\2379\007\255M*\232\237MI\311\355\023\223\002\374\336\315\376\005(!\246\030\233,\276\360\206\252\031\200*\307\314\370.\212b\377\\CD\232\321M\231\374_\207\214xkY\264F\b\331;\311\341"
+	.string	"\326"
+	.string	"\347"
+	.string	"\3355\272\333\257\270\355\326R6\002_\2713x,7\006\004\345\241s\f\210&\3556q\250Ayx\204\t\006\332\327\376\355>\363T\202\307\312\321\265\234\247\246^rnBh\n\264\257\006\236c\277\252\037b\277v\260;\316"
+	.ascii	"\035\231i\302\225\233\247,d9g\035N\322\353\r\376\347\326\332"
+	.ascii	"j\264\031\273\252\370\006\373\317#\220\322b\372\317\355\300\024"
+	.ascii	"\020\344[\253\"R5\260\365\003_\305\"\3276\005D\3525\365A\030"
+	.ascii	"\224\343\277\212Gu\210\210V\330\255\212D.\315\252\030ugjN\315"
+	.ascii	"\221\261\177\025\245\324\006I3B\376|\272,\316\350\364\256_(\243"
+	.ascii	"\360\256UC\256\252\027\250LQ\2023\016U|\345)\2465:]\374\2567"
+	.ascii	"@r9\245Y\306!\277\263\f9\347\276D#\2207\356\335\275\247\273W"
+	.ascii	"t\263\020\002\\Ni\227#\206\343`g\330\206\357\365\225y\214\n\245"
+	.ascii	"\317(\341U\260\335)nF\305\217X\316\271B\237\314\313\354\372M"
+	.ascii	"\2766\257wO\354\261_kF)3\311\264\323t\247\335M\341\305\312\356"
+	.string	"W\370*\263\2441U7\276\235\273\335\016`\273=d\273-\004\240\275\035d\273\r\204ko\333\216\345\257=\372\246\275\371\317l\267\261\355\366\255\335\376\200\002ZN0,Wo\260\264\231\177L\367\3444+\030'\217\376\335\357s\335\013x1-\340a\036\355wu\004\n\301{9\264g|K\257U\3225I\346\275\364\301D\2400\343_|\006\230\232\371\207\315\311\205\214I\226s\323\301\327VA\233\321\r\324\372\026\215oi\234\030\215\356\226\313\263j|K\317\252\306\236$\2319\347\366kI\246\0351zt\324\260\262\217\3465\214\255H\2477\345\321H\303\312\306/b\217?\345l\323 ^\247\210h\331}\342t\214\036\220\370\234#\002r\216\377\274\003+R\262$\025\254\246;}\202 <\2103\254\354C\177\037OC\316\254D\177\327mS\256\226O\\\030\b\013a(\242\013\341(\037U\254\324\001c\302beK8\252"
+	.string	"\360\272\344\3220\016C\365\364>\026\207q\231\323\315\360\226\2519\347\274\2068\034\337\303\306\214\276\346\315\321\241n"
+	.ascii	"`\326\n\311\225\007\213\213\024\225\227\212\225Ax\206\177\316"
+	.ascii	"6\303[\326\207\266\210\213\341`\260\\q\251\221\202&\361\260\243"
+	.ascii	"\234\030\233 \\\303\302a |$\022*\224>\373`\2607W\2620Vzu\273"
+	.ascii	"8"
+	.string	"\230/\201\205{\265\211\177\241X\253\242\313$3\315\325\034z\003\277\353*\024\031I\337-\3558\274\340\355X\300\200\261\343\335~=$$\032,X\033\275\026J\037~\276%^\017\330*\371\222\226v\277\236\f_\255yD@\244\245\035\022O\351\006p\247\363%\351\224\222v1t\274\037PG\264\240}2z?\335\222\317\367\323\265\315\246c*\332\035(i\232\260\360\007+/\324%^\036G9\261\035_\306\246\334\016\334\376V\260\212\206{bc\314\204\204KK\213\225\235\3035\374\255\337\250\036U\230\352\200\005\300\317\272:6\340\22697\235\370\254\356p\207\036r\313+\314a\274\345\024e\b\007\300\177\352\223\337QV\b\017\341g}\225B\344\216P\252\305Jx\247\264-#=lX\211\273?\334\334\321\234\330\224H\347\301/\306X\205\343\224\354\017\347\323QZ\316\271\302\236\213KHe\271R_\304\346)b@f\244"
+	.string	"\317Q\356N\373e\214*\200\202\250\221\034\004\221B\f\315\210\210\210\310l\2321`\002\021:\263:\021\2605$DS\n\265\033\265\220 \260\335\025\275\346G\254\353\201Z)\301\327<\231S0(\347s\341\020\035X02\030\022\3668\273\216\267\203a*\034\034\026.\360\346^x\205W\316\300\031\314\262\r\017+\321\0369\036"
+	.string	"@\2411^\215\005\375A\024R;\310\204\352\026\nY\225\001\305\277\bc{\247tj2\315\037\305\263\004\213f\022\335\313\n\226\016\037\034h\247\311Z\336\262K\276\332\307\235\324il/8\237\003\277S(\316\202\003\366\210\221\003\023\317E\227\024\354\230\032\321\355\362\275&\253\346R\214\275w\341\334\301\345\037\007\311_M\200\347@\264n\212\241\333\371\356\305\205\247\276\372T\t\023\301\003\016q\366\235%P\227PG\320\033a\234"
+	.ascii	"\303+\316\031\240_\023\344m\214#)y\245)\340\324\222\016\366\213"
+	.ascii	"\007O\032\3753|\\j\0062\n\204\006\332{_\255O$\2327=pf\203^t\370"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_afatfs_cacheFlushSector.50.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\363\004\225\034"
+	.string	"&3\264I\260\326M:\025@\227"
+	.string	"M\333\0236\334\260(\370)\007CF\341#AA\t\\D\277\006\t*\276\370L\212\024\323\266\332\205\330J\214?\341\266\335\013\030\311\033\326>^\234\343_3\216!\266)\0233\005ZZ#d\023\271S\n\231"
+	.string	"\223"
+	.string	"\245"
+	.string	"U\303Z\211\206`*\026E\222\303\217\272\324\212C\031Bi\265Tk\235\235\332+\354\331\351g\266?\355\377\356\224\373\223\203\226\325J\243\312H\255U\201\033\304NkN\033O\305\013\030O\235\263\273\006\004U\035\203&\337\020\020a\255\265\2666\236;9Rqg\316/"
+	.string	"%\n\257\247;\271VT\306\003_\301\350\311\027\257\027\343T(h\244%\005o"
+	.ascii	"\350\r\255\b\343+&\360:\322%@\017H\244\021\341\340\035\370\311"
+	.ascii	"\242\267\233\223\224Pk\365\344\365^\334\261\333\326\331\216`"
+	.ascii	"\323\003\001v\007"
+	.string	"\017\363<\327\004\355\207S\335,(\227,\025!2dW\366\235;\0329\321\032\n;\222\027/\252\265m\374\206\360a\005hz\261\r\342S6\023ePh;\347Bn\247B\252\265>\300y\220\021\027\226J\226j\255\016~\034\210\216\257t\352\022;\363\274S\0377\236~I\035\227\222\317\351\351g\016m\250\335\334#\373;\034\016\301\2745lr\232f\234\236\371\264\314\237\376\230O\313>\035\3734\371\351\221NSqZ\024\247W\234\236;\375\001(x\020\265\350=%\0240\254\223=\\\b\275t3LR0i\t\335\243*~\326\264\202\372-\325\")\376\024w\305Na<}\320>\231\372!x\024\333]\004\260\310\250Uw_\f\251\216FV^?a-\252\bN\351\316\212\200f\230\tL\377f<T\005\0131\232\025\327\276\200a\236G\267f\310\311\r\204\322\252\252\t\023q\017|\201#\\X>\247\247\231`\206"
+	.string	"H\265\376\234w)k\270\222\r4$$O\2623\236\322\354\026\021\332\261\233C\313\354\314~(L\254wp\214Y\231\275\324)\217\031]vZAt\354D\332\234\273\033)pD\360X\300!q\263\335"
+	.ascii	"\370f\343\223s\302\226s\343Q\341c\253\341tj<:\266\235\332\255"
+	.ascii	"\307\247fc\3008\0238=\265\0238\\Om\006\365s\261n\r\307\276z`"
+	.ascii	"\375\354\316\277\372\247\276J,\261\326Z\311Ys@2\252K\311\367"
+	.ascii	"\033\206\215\220\211\342*\362\375\302d\te_\274\304V&\374\212"
+	.ascii	"-\2072\213\211\312c\2040U\260q\217\236kb:\227\\\023mk\213\216"
+	.ascii	"\362J\270\317\001G;\347t\257\0340Ey\225\245\213KFy\265\304\205"
+	.ascii	"\334+\016\322\266\254\234\247\345g\016m\363q\311\025\271\204"
+	.ascii	"|;O\370\226\2031\255q9\004V\2501H\303\214R\312\004###3[\232\016"
+	.ascii	"\240\002\2211\"\333\021@%C\314\224\214\340\246\315\265IC}\245"
+	.ascii	"\362\310\207\003\005\326\3242 \024\330\212\033\370\264\217\275"
+	.ascii	"\3242+\331_M\261\003\204\002w\b\252\247<[mh\211%\367\261iG\372"
+	.ascii	"\027)\333\201-\212\271\313Y\222\305\220\335\252L\013\032\254"
+	.ascii	"\377\263\275\271\356\224B\203\202\267\t\264H!\247!\023\246\331"
+	.ascii	"\002%Nk\320\002\020\344n\0273T;|\260\234\2348\233\201\fA\314"
+	.ascii	"\t\217\272=\313KHp\345b\234\263\222\340\344\244\315,Ru\261w\233"
+	.ascii	"*\267\316)fU\013\177\030\246f\321\037n\252\"PQ\323B\334\005\f"
+	.ascii	"s\221S\306\254\006"
+	.text
+	.section	.gnu.lto_afatfs_allocateCacheSector.52.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\240\tU6"
+	.string	"j\\\230\024EP\036V\007\361\206\201\005\035q\030/0\372\367f\272\261\264ke\3269\003\005\242\231\203F\321\353:\324ym\004,F\313N\330\032"
+	.string	"\004\200\260\b'R\016y\"\230\366\006\341\215\003\315y3\347\373\366\367\336I\246\0248\001\035\001=\001\376~7\262=K\377\272\273\332k\036Cc\277\3616&DN\034\307\016\374m\r<\177\263\223Yu/\216\275\266`\342\270\n\241\223x\376\372\025\247\"\273\327>\330\300zF\030c.\267\320\305q\214dt\"\354\257\353B\260\277\237\244}M|\244\003(\016\021\207B\302 \240\237 \320\347\347\353\361v\360\353~F\266\373\236W\016\240\030|*\207\262J2\321\211\017\233\b5a\222\205.\006\265\037Mws.q3\023\2709\236\366\225\203\262\316{\033\243\316\361\202:q\240\235\322RR\356\032\346?^\320!\036t0\347\020wsF3\320\315\371\004\314)$\373\270\3044F\334\270\233s\3526\210\226\351\341Y\272\362\317\315\031\004\315\013\2009\267\262\257"
+	.string	"\022(\227\367\334\013caJ\334\315\t\304\3752\2636\007s\006\311\274\235\022\232\277F\316\350\250w\274\240\\\276s\2540\207\335\fK\330l\177\317\245k\002\310\326\216\2472\277>\334u\211\315'\314\3403\313m 'k\347\367\264\221?\370L\272\3068\216=\213g\255\3472\347\235R\034\307\235\231O\250w"
+	.string	"\357vmw\217\350\346\261\bQ\367\245-\374\367gX\265\356\347\177\177\267E\031M\346\272\376\367w?\300\033%X2\205\233)\363\357lp\255\302\307\210\311\257@I&\262\266%\277\255`\377\317\316a\261\302ee<\335\335\344lV\2748\216)\264\253\371\232S{\023\177\373\251Evf\013\330_\177\317\342.[\324L\214\f+\327uW\223\371\245\335^a\371D\331\177\244\273\227\333H"
+	.ascii	"\316=\240\227\333\250\310\317\274\211\340\334\002\274\352]$\016"
+	.ascii	"\177\271\205\234\314]\330\313\035t0\336@_n\037_\356\337.\267"
+	.ascii	"\257\227\273\307\313\315\333\345\336\301\271_8\267\013\347~8"
+	.ascii	"w\206s\373\201\032\324\346\216\247o\317\304q\263NO\214\346M\373"
+	.ascii	"\3623w0\356U\377\356\264\366\262\366\254\307\312\270*l\214*\347"
+	.ascii	"\213cexY\177\221\271)2\272\255\356\245\373\3275\274K\027\267"
+	.ascii	"f~\326\216\326\022\222\220\256\305\257]\345e\275{\316\315E\251"
+	.ascii	"q\034\273\226v.\022\222\252|\013\225\361\252\0327}\3263:*]\034"
+	.ascii	"W\231xU\335\277\032\335\277\316\354|\305s\006M\326_-{@\203/m"
+	.ascii	"?\302\274w/\r\256\347Xa\233g\351\301\024\017S\321\364\016\357"
+	.ascii	"]\033m\023k\037)\327\023\330\001\336\275\2245n\203\333\351\220"
+	.ascii	"\324\335H2\257#\302\347\230\210tv\020\212\324\201\022\035C\300"
+	.ascii	"\003\007\323\347\245\355W\367\035K\037Z\337\221;\232\373\302"
+	.ascii	"\304\246K,\317\350\215\257u\344\306\337j&ICG\r\223\337K{\002"
+	.ascii	"W\217\300\277KvD_\364Z]\347Tp\321?\0367\366\340r\250\234M\234"
+	.ascii	"%\177\203\303\344jo\b<\f\326\205"
+	.string	"\275Cv&\344H[\357\245=\340\205/e\205\363k\203p9\253\005\323k7\007\217[J\320\"\034\216\211\270\335\016\370\036Y\321\033\275wu\251%\333\230\355\301z5reh\274\020\316\206\n\3016\216c\013\356\245I\370\232\022o\224\265i\224\252\306\337\374j\002\366\227\350\035\315]\265.\254\265M\027\256\fn\005\013_\300\273\027\177\251\\k\3116f[\311\\G\301\215\314\222\335K\275\261G\276\340\227vv\375\214\007\315\262{\336\265\240`\241\003WsR\254q\3570\267cO\240\310\316l\307\272R\362\257z\314mPN\343iE\024\210\247\030MNG\027.\232\2004\236VD\201\220:\306pz\232\372\265\323\321\024\213\030M,\234\242\252\246\232\220\216PHQPM/\220\234\244\246\220\216\024\364\021\306\223\024R\214\343Q\n\351W\305\272\341n\261\370C\313\266\350\217\367X\206y\002\037y0\370\255\204\365\311\033"
+	.ascii	"\204|\210\231\030\262\240\336\267;d\374\"\203\354\300\205_\374"
+	.ascii	"BF\271\346\241\202F\371W\r\240q\256\305\227\266\2356\3268c\222"
+	.ascii	"Ms\350\245\375\2036$\376\033\0074|\340k\315q\340?\022\253\237"
+	.ascii	")\322\344\214(%\377\240\3626\037K\3166\355\301\344\\\246<\210"
+	.ascii	"/]T+\346%;f:4\202}~C\235\033\301\277\367y_n%\263VRn\032\301t"
+	.ascii	"\321\267\n;t\344p\"\277w\255\0220X\271\316\233\213\025\346\227"
+	.ascii	"\220\277O;I\254p\216\r\342\326%DR\201}\357^\033\362\022IeF\364"
+	.ascii	"-,\216\263\\d\345\222\263m\263\r&\230+\252\245\313\311\234\205"
+	.ascii	"\254\002\373\353\373\031\3217\340\367\336\323\234'"
+	.string	"gD.\316\322\333\264\250L\t\022\313WT\b\2469\036\276g\335-\023\325\n\261iE\200~\fd\343w#\307\220Xr\200\307\250q(\304\224S\f\215\0042\"\332$i\f`\002\2211\263n\021\2005TU$\205\206\315\265~\347\326\331y\252\007\337#T\261\217\"\210\3247\337\006\327]$+1I\016\262\357\231\364\033'\321\277T\003\230]\b\242=\343\317\003\364\267\351\002!\320p\336\316\331\372\b\224\216\321\251\254\250\b\312\356+p\006\315\377\2472\243\300\315\212\312Bc\371\340\032\350\364\312\270\027\032\272\266k\220\242}\347 \316\232[\312\004\262~\266\001\020v\306\275\313o\220\362Nz\223-\364H\2561\217\367\230\t\204:,N\357\205\351\237\344P\377\210G \204\2003O\234O\270\207\346\376wX\250\344>\254L\236bo\021\306u\t>\013aL\307\241\022\f\n\332\310\313b\302u\037\034Q\361\304>&"
+	.ascii	"\314P\350]\315\345\303\201z?\327\f\035r\361V\317\240)\340\244"
+	.ascii	"\365\2547\207\306\253w\321\352OT\257\2238\2145\254\312\346\254"
+	.ascii	"\337\3677W\315@8\341R\"f\314Q\262\236\375\327\231\275\002\027"
+	.ascii	"Q\036$sK\te\241\n\241\305\257\352\025\372E\350\326\253\240l\022"
+	.ascii	"\316J\211R\027\234\223\344\314\210\221H\367 \266\003\301\326"
+	.ascii	"mK\257\021\005\244\036\323,\303\374\3425\377\205\211\351Z=\250"
+	.ascii	"2\276\363\017\211\220\362\013*f\312jh[\037\365\243{\234\347j"
+	.ascii	"L\317\\\306\252\232\342\316}5\227T\253\350\276A\311/\363\335"
+	.ascii	"\250\032\361\326\030\206K}`\321/\202\300D\266\216\232\377\250"
+	.ascii	"\261\021\007\373)\247\315W\2367\275\346\323\206(5"
+	.text
+	.section	.gnu.lto_afatfs_flush.53.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`u\001u\017"
+	.string	"f\236kF\360\220*\035\3720\353\264\237\273H5\346\026\026\0279\366}\260\305@\343\032\303\374\323\335\375\351\370_\312A;2\254\223\223\026_a\036\273)\212\177\2616\264\270*KO\\\005H\032\364V\324\304\340mW\333\b\221;\245X"
+	.string	"R"
+	.string	"W"
+	.string	"#\315nwA\377\f\322\371g\340\0046\377\274\177l\256\262?^"
+	.ascii	"\242\362\352d\013l\300h\003\005G\263K\202Jb5W\367t\256|O\214"
+	.ascii	"u\257\243r\365\n\254\300P\271\355\363\025;\361\020\320\0201\363"
+	.ascii	"\331\247+f2''dw=[\261\224\373\273m\007\266%\330_\021\3664\307"
+	.ascii	"\323\337o\267w\332\255"
+	.string	"\257\335S\247\357\341\340\002{\305~\243\306.\254\344\2613\276\027'~\373i\177\355j\337>\214\217\363\347f\235\2671\r\306\032\024\273\033\341*|\3626\177j\033<\264\2148v\273\244H\347\337\307\277\250N\263\356\233\262\357\240#Wu\335\366\177@\211\321c\006(\313\262\274\202\315T\227\355\231vI\234oqT\225\365\020.\204\213\252\f\364\353\004\030\031'\263\306\366\205\263\260\256\263\273\f\374\334cP~\211\177\306@2\337\372\347\223\350g?\220cG\212\225\361\245d\2266\311\232*k\261\3531\302\312\342\244\207%\022\004\001\031B\n&\221\223\230\032\205\017R\250\220T\341$\n?<\n\241FR\242\221\221I\003J\004\212$\320D\022\225\300\321\t\005\206\022X\264\020\236\300\224(\236\300\017\271W\026\177\366\316\f\rD\316\305\374W\033+G?\177\352\220\0225\361T\346\343dLL\320=u\001\310\311\274f(\027"
+	.ascii	"\334\224\243\256 \t\303Z\250(\216\260\261c\026\336\216\355\t"
+	.ascii	"m\227\376]\270\315\262.t\r\022l\004\225=\b&\325%\213\272\006"
+	.ascii	".\032e9Y\273\250ae\340\344Eu5\236AA\001"
+	.text
+	.section	.gnu.lto_afatfs_isFull.54.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\335\006"
+	.string	"\362\314/5Pm\222\016\204\263\213(\200\022\020\020b\037\213\240\024\376V1\250\253^\331\260\177\267w\264aWL\305\265h\353f\026iU\"\207\347z\206)O]\221\233%D\246[\226\354\242\251.Vf\223U\361\302\304\f\246r\210\026\226EK\345\353\241\001\213\232\353\302\"\325eahh\360\201\022?DG\232@f*\\\217\212\"\356F\2477\234\327\255\323\345"
+	.string	"tzp@\364y\245\357<\017^|)\tC\377\373A\202\022\n\256$\221LP\351$I\246\020\216\277\363\324\007\t\235\265v\031\240\202\221\306\004\210If\027!F\265>\355\266\243\f\037\244\221\215\363\364\005,d\346o\343*:\354_\371\021~\213\t"
+	.ascii	"u\331#X\300F\f)(\004\350\032^\030\341\226\020$\3349S;\237"
+	.text
+	.section	.gnu.lto_afatfs_fileGetCursorPhysicalSector.57.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\265\0025\025"
+	.string	"&\347\210I\300\020)\035\317`\\n\215\366\234\301\240\272 N\030\007\255,\267wf8M\251i\350\353K\243\271\325\n\200\250\325i\177\n\263\334\265\225a\233\335\366\275)6\204\2660_\260U\177\205\361\036x\2442\253\275\267F\b!R\246\024q"
+	.string	"k"
+	.string	"x"
+	.string	"j\313\3300\333\252\366\207N$\363`\314"
+	.string	"\332\244\021\342\264\2303(\342\005\256\217\016\272l\373(\036$c\235\003\r\273\234\003D,l\216\256\346\f\326\f\034\204\374(>"
+	.ascii	"\371qA\\\367Q\\\325\3713\037o\364\007<-\030=\337\316E\327\316"
+	.ascii	"WL\360\203\322\221\371hD\020)\017T/\272\336\370x\252%\311\234"
+	.ascii	"\323\332\363\345\334\344m\227\330n`o\201v\220\247\373\301\276"
+	.ascii	"8\267\307.\325\264R=+\325\262R\035+\325\037\245\032V\252=J\365"
+	.ascii	"\253T\273\036\374\313R=Z-\226\352-\325J\252\017`f\205\343{V\216"
+	.ascii	"97\f\263f\324\3304\302_q%\227\037y\234\331\232\372\005\271\330"
+	.ascii	"\302'\301\\\205\267\210\351\352\0274\347\274\321\221^~\344\003"
+	.ascii	"\001\251\256\346\234O\361b\303`l\330\307\344li{\244K\020v\260"
+	.ascii	"\252\331\222\255\356lE\0346\034x:\364\223<\341/tN\177\242`W\260"
+	.ascii	"\351{6\362\243l\237\364\020\036\246\022?!\337\336\244\023\361"
+	.ascii	"\371\222\217\356\215>\002\001\251\260\324E\225\024\217\030\323"
+	.ascii	"r\355\0138}o\\qg\376\323\373E\355Q\310\257\005\341\r\032\325"
+	.ascii	"a\033\303\231P\\sN\006\376\222J\316%\"\206\374\370}\321\305\023"
+	.ascii	"@\033&\206v:\f&\031p'\242o#,'-\266\223[\n\f\213\255\226\303\325"
+	.ascii	"Rp6\224\332m\205\2456\202\3009\025\223\225ZK.\267R\203\005w\027"
+	.ascii	"\347\366\\\307f\307\217\030[\357\215mqM\262[\336H\333\217\215"
+	.ascii	"-\001-\330\276\366c\305*\217u-l\313\0325$J\0365\303c\217\024"
+	.ascii	"b6\034\016\267\256#w]Kj\325\374\224\f\341P2^{\245\213N@\032X"
+	.ascii	"\021\036C'@\301\324\206\b\275\356\2476 `\242A\205\346\001\265"
+	.ascii	"\354\265\022\372x\007\036\224@~\004\377\3352*i1\302\321yt\346"
+	.ascii	"q\273@R{-\313W\331\330\277\354t\332\020\2109;|\245N\3532@\302"
+	.ascii	"@\270\237\344\34348\003[1\217\255^\006J\242[\003m\305P\026\257"
+	.ascii	"\034\r\004bs\265\332U\032\333\254\341\311\2118\250\307#\r\335"
+	.ascii	"7\r\356\006\347\354W\2260N\342\\\274%\261\247\2256\021H\001\001"
+	.ascii	"\326 \334Dc\350P"
+	.text
+	.section	.gnu.lto_afatfs_cacheSector.59.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`k\f\345>"
+	.ascii	"\232k\364\027CPdR\007\013\265"
+	.string	"\004\323\313\274Z\020\217\177\371A\216\263\206\325\216\347\250\203A\307\233\370\250\"ij\033\241\361\031Fi\b\030@(\251e\035\f4\216\006\036/~\374\375Omi\357\254\264b\331\336[\246\224\002n\001R\001s\001y\250\325=\364\326\355\276\321\336\326\303\356\026\323g<\203e\307a'G\266\227s^\340m_\261\331`\217y\213\232\243D\373\335\017$\334p03\374\230\235s\330x\300j\356\345\206\177\251\221<\346-\353\026\rj\300\376\3674\033\035\314yLP\231\234\325\234Z\002\320\333\356n\337\342h7\372\315\300\325\374\301$'\366\\\353\313YM\311\344H\327[\326\215\\o1\023\177})\200RR\022\351\b\t\300\250\210\3508d,\022\207\302 P\310mY\374o;\323\227\232\350\234s\334\242A<\300\006\25604W\322\342IZ\262|\022\213#a\201\362Gf\216d\221r\222\340Q0m\363\303\347\236<"
+	.ascii	"\263\2627\022\212\032\003s\342EM\234"
+	.string	"\210\254\311\037\253>\344u_U?\3732\362F\241\2506\357\300\265\243\f\032\24010\251\027\t\214\201\025qb\335W\021\226)\347\354g_D~\310B\340\352#\342u_S\226\350\367\264\033\362B3\251\0231\227Xg\212\230\217}mi\203@\366\201[\024\316\353\276\302\330b\025\2753os\002g_\322\027\362&\232\273\354\203\035j\250\303\350\223-\362-a\323#\332\365-\020g\215\321\255a\224\3531\253`O\316\2171\352d\221^fPo\363\327\021}\376\013E\345\234\373\241Q0o\001\336\375J\335=\243[\b\027\032\332\313\274\355\r\034\336\241\034\\o\3335\3256Y\322\232\177}5p\374\376\202\335z\017\315\271\243\230?\310l\217\2312 \246>\371\022\306\3155(V;\311G\302\335\037B\274C\2270\2263f&\316\026fVI\353\353!\204\251\356^tG\252\270\230\332\317z\033\037\372a\327\261\302%"
+	.ascii	"\254\2636Y\213\374v4\"F\274C\333\321x\224\0233\273\367\2101\305"
+	.ascii	"X\033.\022\236\312\333"
+	.string	"z\277\3774\\^U,\300M\n\377\254v\266\336\257\337g\270G8\211\373\237R\347_\373\b;\3666o\305\252p\326\2730\177\315\277v\2539\037S\273\035_\257W\276\306J\272\203\337\020\212\276\033\020}+\333\357'\341\267S\3217\003\242\357\005\376\305\275\251\375.0\374&p\374fr6\367\001.\306{)\370\235\024\374Nz\232;\222\203q?\352o\243\263y\027\207\276\211C\337C\343\267\260\370\035$~\003\333o\241\341\267+\374n\203\337\270\375v(_B\347\325\003\314s\300\311\331\353*(\307i\347\240\270\030\357v\267\356!\232\bU\270\276\2343];\267&\347sX\356\326 \252\177Xp\036\007\303\335\332\004\331\033\026\030\355c\374\255{\330Z\356\326x\356M\320\024-\347A\210\230\260\357\311\301y\306\035}\215\027\261\216\356`\222\367z\251=x\354p(\237\"\016\002\363\250=\356\2120\365z\365\004\356"
+	.string	"\314\204=\215\267Z\252}\254wl}\234\177\r\320\226G\215\b\273\rw@ \253\233\255\367;2\370%\262\327\311\267%\231R\024\266F:\344W.\020\267M\2669\300'\337u\005\3055e\340\267\250\220\357L\236\201\362\021\302@'w,\204\261\350\354\370\323\365\347\374\353\004\037l\230\306\"\246\352\3713\245,|\236r\272R\t\300\373s\245U;,}\232\356\365\315\035\261\215\273\330\317\254y\t\336\327\270\273\275R\336)@\006\370\255\362^y\207\272\036\304M\310\036\240\275'f\366\002\2777\213\261\232s\323\241N\327\357\026\007\364rAV\373\030`L\246\213J\001\274"
+	.string	"\373\223\315\336g\334%\\"
+	.ascii	";\235\267V\302\3748\357\330\316\234\177-^\271\300\r1U\215'\031"
+	.ascii	"h\256\005\262"
+	.string	"\346y\222\343\271PH\231\276=\346\017\3525\037R8!_{\237\326k\002#e\367\264\336\207\301.\345\306i\327\323z\277f7%\362.\345\342i\317\323z\t\006I\335K\214\235\366\274\326\003\272\224\353\255s\265:\360\320\260\344#\271\311\357\272[\017\203\275\365a\372tx\344\371\177\335\375vq:RP\335\215\301\355\246\fP\270\340s\250\220x9g(9^\027V*\252\226U\307\030.d`MYi-\263\254\204ZWK\026\030\264\206YV)R\3108\341\322\260B\341BC\026V\214*\253\020,\226U+\264j\250xa\324UOZ)b,ST\271\250\241\265Tb\255P\272X\261l\241\254\312\322R>\035h\254\027VY\312\030XXY\312\241Z\323\331\214\225\264G1#\366\214Sr\177]!\0204\300\366\327\3656\017\036\221\233>\343\334\367\3275b\035\335m\304\217\235\354\322\333\233\327\361\216\n\320"
+	.string	"\367Sy\313H\030\313\332k\270\336z\233\263k\310\336\234wnJ\354q\177\026\327\357\226\227\362Q\032<a\245\373\361%\374\204=N\211\210\315\226\025\236L!(\243Br\342\276t\207\230\210\223y\272\246\316\277\206}u\311d\tu\210\235\017\031\033\240\264$\3746\305z\304\311+\267\373\035\362H\256*\034\231B\360F\250\220~\nF\266\326q\334ty!A\300\325\037uH\370\346\260\020\370\270\267y\224{\321\262\243\310\221\203\027\342\366\271\327\310\213\344\035\332,f65\337\330\220|\356\204OX\363|NL\252\225Bg\007\025&\245*~\t\2637E\373 /\244\312\365\326\t\373\234\033\220Bg7\345\222\366?\252"
+	.string	"\340A}L9[\025\214\n\252\032\025b!\325\353\016\032\244i\301G\026<"
+	.string	"I\3346\303\350\271\343D7#_\200\004-\341\2133\302\324\026\026\t\200\356\250A8D\021c\206DDDD\222$I\007\220\002\221\241\252u\003\021\3608\206\034;\n\233\024\206\003\244\210\302L\247\365\231\274\032\370\t\013\004\267t:\354^\334\330\033h\370\253z\335 P\224\376\322=\252C\211\030${\005mf\376O\215\320\231\227\310}W\312\373e\346\205P\035\267NT\276\335v&\231\037r\003\301,,\257 $\254\0356\232\201\256\032\013\232nrB\022D\t\222\347T\0173*\247=\tL4\r\322X\304\311-\341ni\bV`Y\006\203\353\n\361E\201\207p\223m\251C\346\001*\260,\274:\217\302B\025\243\265\2429\362b>\373\202\233\036:\347\361\312rQt\325\001+\020$3\004\001"
+	.string	"2\227\241\032\301\373\256\327\337n\277t\254\bM\267\207\265<\320h\023\f\337\237\204\201\270\024\302\300\001\220\035\231\377z\232\242S\360.8~\321\254\233=[\352~\324\224x\362P\367S\337\203\013\215\357h\221^\344\024'\334\017\200\237E\211/"
+	.ascii	"1&E,QT\031\3066\263\355\267n\001\253\022\201}\351\270\n\236\374"
+	.ascii	"\375&\236\214\255\252\220\223\212\354/\003\364\325\361\302\233"
+	.ascii	"D\031\"\375\245U\276\362\206\216\270\207\036\261(\355\222\326"
+	.ascii	"P\300\261\n\345\313\354Eqlz\364\210\032\022V\245\266\002\022"
+	.ascii	"\203\001P\253\221\334+>\304B\214\n\371\261\n^8.x\303\226\244"
+	.ascii	"\266nD\212\003\244\230)o2P\227V\212D'\214\241\234\211_\356\036"
+	.ascii	"\017&h\206oS\241\270\235\2677\223.\336\211#j!\217\235\354\"\016"
+	.ascii	".\310#\202\314u\037@\335\204\025w\r:\037\3332\bm\276\254\364"
+	.ascii	"\363\240\326\345\021\203-\0305"
+	.ascii	"\360o\212DQR\244\340\271Sh\023,\345\270+\334fs\325x\177"
+	.text
+	.section	.gnu.lto_afatfs_parseMBR.60.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\312\003m\033"
+	.string	"6\264\263I\240VN:\202\225O\237')\013\335\364\001\306\302\032b\0164tp\340\237\3338U\216\37282\313\"#\013\326j_\214\371/\277\210\307\325/\274\026\274\016\257\303?\343&\267\31699\213\232\273G\244Y#\333\b\331\204\310\235R\242"
+	.string	"\223"
+	.string	"\242"
+	.string	"vi{N\373J\317qs\237\210\007\250\265\310\nH\255\277\006\226@^\364\357,\364\"y\001\364\"\004\t7\316\025\030\201\303\365`j\306N\223W\255?\333\272p\370\360w\307f\356\262\0309R1,w\346|\234\313\302\031\026\215\240_\371\004\205\021\200\236\260rf\f\201\321\017\320I\331\222\241\"J_,~\202>\322\260\202\220\023%j<\235p\306\320\342*y;SD\301\364\331\303\0331\303\353\200^^\371\bm\215\267\013]j\255_:\002$\237\2409G\013\265VO\036\336\317=\273\355+\333\025\354U\021\376\341\374[C`:v{\246:\216~5"
+	.ascii	"\267r&\230}\036\030p\244\214\215r\021\373\245\207\276##\273\254"
+	.ascii	"\037A\272\031\264\1778s{\366WHR\227\316[d\257\354\264\312}\177"
+	.ascii	"\212\247k\007\3364O\317<]z"
+	.string	"Z\266\323\261q\232\244\323#\235\246\342\264\030N\207\341\364\356\364\334\351\263(x\262K\3024ec\263~\265D0\254\036\021\245f\034x\373?\237\311\245\257\343;n\0164\225K\316\257\362\306&!/%\257Z\353\202\213\246@^t\to\337\004Z9\023\254\311\350+\214>Gg\273RP1\312\225\355l\277c\202\226\373\035\251\307\320\330\312\366;8\336\365\030\252\262\261\225\365R4\321!\262a.\025s\300\200\312\2068Z\362\345\373\023\026\r q{\236\241tw\007T\013\313<j\246\205I\255u\202\017e\303\201\300\213\213\376\007z\221n\213\226\217\334\224\025c:5\326w\0014\\r=u\210Rn+\272\033\356u\220v3h\332\356\236\351a\221#%\300,\247(@OXH\341\366\374\273\213\004\224\025\345\026\3710\216\243s\247Q\217\340\\\221\252\347\0012\247\301\331\334`j\250o\016j6\330\274l\270u"
+	.ascii	"Q\363b\303\311\330:\310\274p\260\335hjl\016\022\030\347\001\206"
+	.ascii	"\306f\203\303\321\330\312_\375\026y\316W}_u\031SVNQ\343\237\243"
+	.ascii	"_:\0316\225\344\024\025{\325k\333\263\266\240\333]\216l{\036"
+	.ascii	"\211\220+\273[\345\202\323\266'\274\251(m\357{Xk\2551\006\247"
+	.ascii	"\355\312\002\350\t\005'\017\227\016\t\271=OJ\267\305\307\r\""
+	.ascii	"\221\356\270=\366\270\366\205[\315\260\f9\221\f~\271\315\363"
+	.ascii	"\334\350\305\001\275\241(\036'\272\031\254Y%\t2\326\304\037\250"
+	.ascii	"$`F\250Q(\202\210D\3068$\001\211\214I\322t`\002\031c\305\033"
+	.ascii	"\020X\311\266:uQt\360\013uq\263\251+S\323&X\262\201\253\321\002"
+	.ascii	"\027\177\023\320\227ep\222;D_)7\037\367$y`L\356\340\250\205\226"
+	.ascii	"X8\211hB\243}\021X\275B\222_\021\\PeC\306\021\207\352\311\241"
+	.ascii	"\244\371\323x\006\031c6\241\036\342\"4\357\263\352\356H*rBZa"
+	.ascii	"\313\305({\002\033\033\324M\253\flxt\226\356^\333z\004\344f\200"
+	.ascii	"b,\356\313\277,\360\262\331`pIb\333R\177"
+	.text
+	.section	.gnu.lto_afatfs_parseVolumeID.61.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013u6"
+	.string	"\312\\P\024BP\350\325\030\341=\271\002\255\361\2624\"6\020\332\333\367Y!f\332\377\221\205Ni\377\021\b\256R!\264\321\240\265!\002\252\263\002PGZ\307\007\220\016ZK\f\266\360\013\266\261\335%DJ)eJ)\0058\001\017\0018\001\316=\241\211\016Z\23447<_'\372\372\230\036z\335\254e\242t\227\356\264\346V\3535f\036\323h/\334\301.f\222|\231\321`\346\365\332\3146\270\321Z\312\2744\244\372\256\275\252S\f\215\031\231\206\2166\027\033\335\0059"
+	.string	"+\372r\265\322\261\250\231\202^\231\202\333\353"
+	.string	"\325\235\271\315Z\213\215>\253\321F\357\273Dn\314\373F\031\360\223\333+G{\310\366\352v\220\355\225\231\331\301\223\rN\022q\\\371i\340v'KJ\350}\243\306o\322\311V*\022\223\220\206\302\340\221Q\021\360\347\353\361v:\267eW\365=\311}\325J\255\005\rs\306\344\230\025\002\373\201\245\213\304\262N\"\213\342HC(-|2\346\301\n\3177%u\276p\r\351#'O7*\022k`\230\024\211\377|\255\005\260\037_\335;\002\3352\342<\350V\221\036\\L\337\021"
+	.string	"\373\341\325:8[D\326\232"
+	.string	"t\313\313]\265\351kM\220\206\263\325\245\016\337(\311\323\266\022K\263Y+\016\025\213\307\305\364\377q-\325\001\357\373\266\264]\213\213\351\336Zx\337\227\275\311\365\243y\251\231\233\215\231A0\353\340\002v8D\307!\3355\353\353\240ms_Z\270}g\277 :U\232\260\357\344~\366\bV}\207\246\231v\215_\3654G\337\367]\371\255G\260\3773\372L\222l\304'\352\032l\257\377<)\2226-\257V\275K\260\376~F\242\335J\370?\020k\177\337\367\352\337\251\276\r\305\366\243@\273\203\345\206\230\331D\217\201r\333\222d'\334\261\250\257 v\250\354\254\217,\263T\263\035}r\357\373B\340\376\322`Vp\217\365\312,\\x7{\345v\301\366\332\322>"
+	.string	"m#\3732\233S\372\2249\272\364w2\267\372\376\022f\327YB\353\034\241\2734?uZ\263\361\235\235\336\231\301;7\275s\202>\353.\360\316\002\3369"
+	.ascii	";\003h\235\231Z\347%\235\263R\353\\l\235\211\255sR\353\214\264"
+	.ascii	":\017[g\241\353\034t\235\217\\g#\327\271hu\006\256\316\277\326"
+	.ascii	"\331\327:\367Zg^\353\274c\235u\255\263\333:\267\2533\333:\257"
+	.ascii	"\254\263\312:?\353\354k-\244bp@_\202o/M2{zM\037\340\265\374\364"
+	.ascii	"\360}O\264*\256\034~\017y\206)\023^\361w\252\206i\376\t\276\360"
+	.ascii	"\350\203\317\364\306L\364S\243?z\342\333\200\3467\266\350\215"
+	.ascii	"\276\235\303\204\002\277(Y\326\206\200\337V\236l\205\002<s2K"
+	.ascii	"\023\032\224d\247K\351S\365\227\324\322\201\220-\207\223[z\356"
+	.ascii	"B\307\3111\206\006\224\241\327\026\023\226\340u\356\373}\323"
+	.ascii	"wV\"\366\020\017A\275\206b\177\337\203n\350>P\277\277\361T+;"
+	.ascii	"\363=3\207\336\243\247"
+	.string	"\345\272\367\276o\021\251oo\355zzY\326\361\002\365\021*\242\207\367Nv\235\202\356\265\326\221M\221\313js\027\264\204\327R\320\022\276\245]\240K\b\330\025\2408\273w\356\324\340p\350\030\001\033\341{\255\035\312\016,W\200\342\330\341\375\356#<{V\327r\350\003J\323\345=\n46\300\351t:m$\273{\336\007\245aj\273g\356\320u\350\004j\376\321\375\316C\313)\241\3736\"6-t\346>\363\207\206\203\364\311\275\371\270\346\237\366\327w\277\r\303\374Z\372\224\331o\277\263\022)}\332m\240\330\357\264UTSVR\307\020QVQ)xU\".hP\361!E\214\243\216j\312J\352X\305\262\224S\225\n\253(\025R1\220UQ\306)\026\306\030,\242`\030\245\250\252\214N\006xJ\306\221\312h55Ee\344E\225\255\276\277\204_\274\261\251\265\025\273\223lK\333=\344fH\255\215\345N\262"
+	.string	""
+	.ascii	"<[P\376R\211\311\2117A\372\230<\242\247\027>\323#\315\031\203"
+	.ascii	"s\377\351[\351\230\032\363kY|'"
+	.string	"#Y%H\240\034X{=\331\020bux\201\021\227\236x\022$\020\211\252'\212\037A\2664\314\215\\\250\020\346E\234\344\226\236\r\362\214+;\373-)dICZ\351Q\240\331!rt\273\224\276iM\2323\245O\221^H\020\270\241sm\235a\233\363D\370N\376\351\360\371\306O\2348,7\244#\362EM\360\235\276\343\b\324\272\3614C6\247\262!\003\344\250\210\301\367[\323\r\n\320\351\005\274\226\200\271F\262\305\177\245\231)Z\\q\212\347\360,i\363\217\322\370\305\017J\305\3700\261\020_\300\033\277\0031\245$\275\360\211\317\364\206\364\355'}Q\312\374\362F\262\001\036\351W8\305\3320\241K#*\216\205\214cP4|\247\017\200\340\250q0\004\221#\n\315\210\210\210$I\222\016\240\"\021\252\252:\021@%t\024\t%J\2451\365M\253X\001d\315\207\332\030\b\210\270@\274G\333\027\2764S"
+	.string	"\200D+u\326\357\003\"\366\300\2103=\251i\235m\301\202\314E+b\351\322\343=\326\273\341\260Q^\2602m\2304*\207\031v\023-g\206\354;G:\237\212\362{\302\325L+\274PZ!\304\273N\245L\275\017\235\340\340\335F\031\363\334l\366\013\317/`\207^5-\272\314\205\225\373\220\024\232\37548Z\361\2500\322\267!\r`\301\3544\tS\030\202\356\305\303\342\013U3\270\365\352\364\317\350}\307_\f\034\243L\203LF\212\234LJ\"\237\331\251\261\343(\003}\3677z\233^\313{\004\2262\245\247\224\340M\270\002Av2!\0278"
+	.string	"\f\n\310\205W<\251\342fo\351\035\177%\304\335\330\322L\362qp\2123\307\231\t\340\261\363S\325BE\374\333\001\022\227\232.d\240t\370&\324W*\2470\261\330<U\277c\254\206)\217\037l\336A\032z\257\267\335!\356\210\300\350\313\201p\002\022/$\346\373\003^\032K@FL\020*L\343\0041\210\031\035\223\320g\264\f\2661(\336\262\3460\035\210\2731\251\373\277\317\t\372*\225\004i)\035\304\315\3162\315TD\211\325\245\314\342\0237|+*\232(\265\016\367\374P"
+	.ascii	"\350\233\0020\\\367A\032\220`\360\227\225]K{\250\203>\214\205"
+	.ascii	"\261N\364\217\002\347\352\317\272\3318a\nz\351\213\310\207\023"
+	.ascii	"?\300\324\f\210O\264\226\244\214\325'p\223\037\025"
+	.text
+	.section	.gnu.lto_afatfs_FATIsEndOfChainMarker.63.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"u\f"
+	.string	"\346\227VC"
+	.string	"\2216\035\\\020\223d\341c\0317\224,\300/\016$BU\026\274n\207\242\317a\344\007\n\036\246\250\231\337\txkZ\215<\004^M\320\177\377]\336wdO\314N\322\372Ga\366l\201O\332\336R\246\024G"
+	.string	">"
+	.string	"A"
+	.ascii	"\n<D\036\021H\331`$@q\242@B\306\356g"
+	.string	")\207\217\036\241\346\310\357\266G\r\313!GJ\211\005\327\261\\\341\201\026\025\027\002t$\310\221\321\360\342/O\225\016%\263\372\330]'\327\255\334\324m7\260\315\300>H\273\326\r\256\356\375\321iu:5}\016\316\212\n+/\245\330\2650CcM\361D\311\266\310\336\330\316\264\037\342\"D\367&xc7\203\213\022\273\037\002{h\036\013\234C=\302\017\240\036m;\\\245\t\343\341d\"\351v\020\\\213I\325\305\372\022\352\032\022\323\202\2243lc\217)\321\354\356\002\037\346#4\377\303\243C&y\356\3217\241\036\257\1779\364:\3248y'9c\177[\252\213}\270\033\231'\344\023\002\311< -\004\341\002\340\253C\023\001uD.\022\tZ\307\302F,\222\221\316\307\2722\315\3520`,\202'\263@\030\226Y\233o\017a\n\320JUU\324\037'\212\022\035\244\3024\021C\006\003\334dT\373\301'\037\023"
+	.ascii	"u\331\363C@\030\266\264p!\213\035F\250\214\331\007\214\r\025"
+	.ascii	"\034H\030i\273T\220H\340B\3442\nW\243H\036\023\342\315A\242\032"
+	.ascii	"\222\347RP"
+	.text
+	.section	.gnu.lto_afatfs_FATGetNextCluster.64.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`>\006u&"
+	.string	"\272G`\017G\200ZN:;l)N\017>\244\344c\307;\332\022\367r\033\357\231\247\306\177\375j\260\025\353\210\360bjZn\230\303\364\355\367\327\033;\344\177\236`6!\356\026\r\f\202 \207O\301\221\f\264\\\264m\322\b!r\247\024\351"
+	.string	"\312"
+	.string	"\347"
+	.ascii	"E\264Z\321\200dA6jC\334jEC!\246\264S\333\352\211\\jD\334j\245"
+	.ascii	"\"\001\306\364ZU?#\215\332\021\267Z\215\013^:\004\371\344_2\016"
+	.ascii	"e\211\300N}\372\222\202\301xz\215Ar\247>\001\301B"
+	.string	"\253\325\330\300\022(\275\227\217\316\325\372\003\016Z\255\265\201\037\234/m\373M\316%\303L\032\240\2046xj=\244\242\260\251\325H\304{\217\371\222<\217\371r\205\234\351;]\356\304\231%\271\224\3117{\006(\256\260!\261\351; \035\216\302\217\252\035\317\275\215J\207\026U\016z\222\n\212[l\274\215j\007\331\323\005\b\231\233\035H\213\312\212\342p\334\324!J\221\274Z\353\217Q\264\274qRG\274\361%\177\202\364h\243C|\"yZ\330\244\236v:Et\242\024G\241\326j:$V\3359\267\335e[h\227h\002)\276\304<Q7~\232M\034\313\211\263\326\n\301W\373\225\"\277\310K\033\365\350\207=\363\245\320>\355Bg\254\270\025\273\274\204\364\3156:\321\275\262O\326\rb\237\324C'\365\201\034\265\320I\035tR\003\235\324\274\223\372\347P\376\002\007\273}N\352\236{\375\002n\374yN\352\235\223:"
+	.string	"I\255\263\243\006\260\243\3169\251w$\265\356\244\316\345P\237:j\334\216\332\334Q\227'5\251\243\336\0345=\251\257\240\347L\221\2523\t\253\265\306\333\233\312VRAr\260_\354'\373\313N\332\367\253\374\b\343g>\217,5\030G;\025{\347Oy\332\357g\326eYYRk\375\024{\367\263w/\251-\303\017\373\330\245\334\314\273\262 /'N2tHk\355K\261\353G\206E\266s\257L\315\237\323\300r\302%5\245\274\230\363v\312g2}v\205k^\276\304\030\240~\320d\360\237=\314\206\004X6\207\217y\370\032\254\227Ak\177"
+	.string	"A?\364\271\220\241\032\2666nR\333d\240\375\006-\0018QE\336\366,\320\222\307\250\242\023N\304\301\004#`}\371\331\234\227\260\326\332d\356\225\027\\\300\346\020\371\032s\364\210\267\005\273\364\354\217\037\362\001\347e\377\336\354%\217,\265-\253R"
+	.string	"\375\331\245,\235?\273\331R\210\265$E\256!\317\372i$J\320\017\375\264S\210\332\246\273\361\361&F\016\355\311\276j\376\366\240\311\263C;"
+	.string	"\352H\230\224\225\023}\363\201}\331\327lx\346\274\217&\317\036\330Sy\b0F\336\242\3428Q(.uk\367\312\364'L\241\r1z*\2206\350\004}@\244\013\"\200EG<\276$\240Q\357g\002[(\375z>\323\0020F\017i\347\353\001\177J-\214p1z*\2206"
+	.ascii	"\213\216N\0339\370\035\001\213\216\214\220\202\277\"\242\244"
+	.ascii	"\025DH+\212\\\020\031\371~D\016\0208\351E\317G\004LJ\362\021"
+	.ascii	"\355\214\302\223u\203\370\354\273 !\262\t\327\311JbdA\262\326"
+	.ascii	"\037\023^\366\273=\331\t\242\001\326f\352brB?\334Y\336\3236\331"
+	.ascii	"G\223\"x\006\330\005\003`u\253C\346,\200\335\346\354\366Q*|l"
+	.ascii	"I\267g\223\305e\313K\350\343T\030\230.\267"
+	.string	">\232\016A\2350K\307\315\371f^X8\213\370,\366S:\314\335\305\355\243\224\320[\213Y\256\271\217\322\"\267\334K\305!;\271\f\206X\371\302\307X\234\273\267\221\265\266\345+q\324t\344\366\312YN\327g\233x\231q\250A,\244\020S\n!\031\022\2310\223$\351p\002\231\251\273m\020Xg\303\205t\347\222\245~\303\323\207\237\352\220b\344\006\251\200\244U@\212\330\224\3042h\243\374\025\235\305r\024\306>2(\2100F\373@~\244gi_\357\270;\342\355\344\345\026\351\027\007\265'n\214\234-H<\363\374w\005\273\273F46\257\003\317\270y\266\006\025\232\250\036\024\351J\375F\307\371u\006\037tb\226\265\327'\232\301|\264\342\"\t\213w4\030\377\365a3{r\347\306\377g\21608o\261\335z\342\230*\304f\020\237\275\270U3\303\251h\0252f>8F\215\376Y\367\352\327kN\206\336"
+	.string	".f\255t\3205\246\016N\266"
+	.ascii	"$% \212eE\200\324\007#@\315\"e\264h\320\"4\336\245+`\023\t\320"
+	.ascii	"\270\013C\322r\214,\177\253xq\263\275\331\250!\326\037"
+	.text
+	.section	.gnu.lto_afatfs_FATSetNextCluster.65.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\034\005\215 "
+	.string	"F\375\323J\240\230Q:\301\331\035\315\036\260ad\272\023\022.\370s\264\241<mKO\342\306\221\321\033\360\002N\277_\273\331\342\217EX\330\235E\026\204){\200\023I}\213\373\236\017?x\002j?\267Q9\330\031\236`3\3226!r'\031\305"
+	.string	"\255"
+	.string	"\302"
+	.string	"\214.9\023\240O\375\314\256\225{\"S\326\224\344\275E>\306\3634\033\345\323\211\335\213T\264\312=\371\272\262\250$\357\265\022\341\024\364kt\017\303K\226V\362^c\203\233\334\301x\304B\255o\362\225\263;\2244\264\272\327\350\200!\2347\231\231\217\344L@\034\244\201\350WC'+\212\020\252\353^cM\347\003\354\315\3624{\263}<\350\261\023f\315\262k\020\377\370\fDK\264\206D\241\307\016\234G2\302q\330\021J\024V[2(J\251q+E8\312\001U\222\270\374\030\254\246\215\2272\242\215wi@i\207W"
+	.ascii	"\342P\251\023eKx\344k\f\"\260VX\205{/\327!\321\350,;3\347`\346"
+	.ascii	"\027\314eW\317\262\235\367\336\b|'\177r\343\003\271\3118\025"
+	.ascii	"\365C\025\366\346M\037\371\004\\O\222\305$M\277\2322\033\201"
+	.ascii	"\265{0\277\3234M\271\225\230m\345\034[\031\007V\371\306V\266"
+	.ascii	"\271\361\257\271\323\231f+\323\274\351\237\241\225\001\304*\317"
+	.ascii	"\304*\243\266\262\f\255\034\223U>\317\312\260Xe\033\253l\332"
+	.ascii	"\312\345Y\271a\225\253\255|\004\004\222d\030=I\226{i\244d\356"
+	.string	"\226y5\344N\377\323\037\365O\275d>\377\352X=\247\342\335R\230\2367\271\0253\312\257:\322\305\251X\266\004\246\353\336\373*f\324\0053z\2632\003\361\225\034\352R?\0067\306\314\200Ay\355\035\363\211k\261e\251=b\351\353H\323\357B\206\305-\373\007YZ\367O\253\213M\345\373\254\203\237\352W8\b\370\301\354\341\307\017\023\264\334\264i\346\020\"\352\207\264\323\030\246E^Ia\0131M\277m\272@\231`\021\210\305$\276\345\323\242\351c]\001\2172\375\343K\256\2450^G&\255\236\352P\271\363T\227\312\201\320*Rd\032\316\232\217,a\242~\310G\276B\260\205.\206G*U\346\364\237\336_\236\336gg\235\323\004\210\204H\t\217\2005e\234~\324\273j\310u\236\235\330Y\343\364\255\016\002K\2204\370\005\254DT\256\221\356\036\3656{\323(\224l\031\252b\370H>\021;]\357\206\343\331"
+	.ascii	">\270\024<\033~v=\036\f;]\357\206\013\321\263\355\320z+zx\270"
+	.ascii	"\235\365\301\361\240;\\\217\327\263\342Bog\353\361f\370\366\200"
+	.ascii	"\267\323\263\355\334x~x\266\232.W\343\311\331X\324n;^\355\301"
+	.ascii	"\002\326\265\300\355j=\235nWC\215\277\227\267\225\270_\205\310"
+	.ascii	"\215\255_\003\237|Q?\345\275H\024>\365'"
+	.string	"\235\312{\357\215\3254?\231\302\227\2637k[t\314t\254\001\224h\317\310\032\225a\3701\027\353\021K\251\027sq%]\235g\363\271\264\310\200\243\005\b_go~\310U\323g\233e\204_\266\273a\375`\221z\216b\315\266\375 \221\262\315\276\360\353\367\364\262q\266\034\361\206\037ug{I\b\\\2501<\242\210r\212!\022\212$H)H\322\001\220\242\2412\363\020PfD\224\341b\003\034\231;\242\276\306\331\264%j\215.\212\205\r2\205\355T{\357]\f\026c \331\004|`\373\255\310\350\201\202\016ze\037c\241\221L=\306\276\247\230C\"['F\033T\331\\\310\265\324\207\223;$*\237O\226i\242\311\221\265\310\237\213\267\013Pssd\301\307B%\337\n\216Zy\013#\374,\231\255-\212\007\250\312\367\3440\224\b\303\262\254,\264\224\"\226,k[o\264\207\243\314\021\310\016\266@\f\206\""
+	.ascii	"\242\220\037\203[\334\007 \300\310\223*\200\301W\376\236xA\325"
+	.ascii	"X\326}\360Vc\301?"
+	.text
+	.section	.gnu.lto_afatfs_findClusterWithCondition.68.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`&\0215["
+	.string	"z\233\200\"N0\222\322\031\016\273~\001\233\302\220<\342\001\242\242\034\221\271\337@\025\2055A\005\332\263XX\002\304\353\304tR\252\254\035~\366\373\310y\023\025U!\212(bE*"
+	.ascii	"\340suW\035\255y\327=\263u\363\273\337\256\177 \243F\233l)\223"
+	.ascii	"\f \002\336\001\025\002N\035\227[\f\362\324\274nW\307.\231\227"
+	.ascii	"\201\272\334\022\275\344M\201\332\035\223\001\363\213\026\033"
+	.ascii	">\267[\\\025.\267=\367F\315\227\231\n\273\305\007\207\273?\366"
+	.ascii	"a\336\366\267\307\275\271\305\335\025#\345\263\342\255\3472\253"
+	.ascii	"\323\353[\327\344\221p\306$\342\272\202}\311\255\253\234\017"
+	.ascii	"7c\017\0301lr9T$\360\343l<\320U\351\242\356\215\225uM\343`m\351"
+	.ascii	"\222\256\322V\256t)\246\317\354o]\327\003\036\\\033\350\027\343"
+	.ascii	"R\t\243\323^\303\217{\351A\344\263^\251\361=\2206\\\346\243\371"
+	.ascii	"@}\326\253&mr\353\232\266\264\t\f\037<\227\233\375\330c\f\254"
+	.ascii	"*\"\005\324\231\321\002\363\267\256iLI\027J\037D\037\224>\330"
+	.ascii	"P\366g\215\372x\244\243\022F$\212F(\021\211\030\022\n\021\004"
+	.ascii	"\364\223\344\323\243\362\200(\356\020\207\3024\2106\037"
+	.string	"\367TG:J!\007\257\022\350\261x\2219^\362\fu\340-\215\330\2332\260Q\332ev\022\302\246.\263\027\2419\270peDVW\224+\341%\313\316\374\306\222mL\364\252.\027a\305\271\347\007\326U\345C\350\020\331\221\270\343%\251\240\006\300\351@\366\261d\027\026B\033\030Sd\310\361\222ZP\226\302\306\357cI&\207\360\240y%H\330\344w\242\032'\234\037X\327\224\003I\021C\353\037\216\362$4\266\324\007,\331%\365IrA}\204Mw\037\362\340\244\342\007\326\305\345=J`]J\256\342%\225\240I|_\314\203\256\300\372\363\002AGK\315\307\222I\030\004*4\204\n\362x\3110\364D\237\rs~w\245\261\244\027\027\213Xur;\302\246\346k`\335\300f\006\b\326\205v\342Xr\013\232\264\256\353\307\\\t/y\204\207[\224\251\220\030\235\224\203%\221\264\320\310\323\035.#\017\242HN\224"
+	.ascii	"\252\\Yh\222\363N\353N,F\211\274\321\023_vDT.+T\bM\2237/s\336"
+	.ascii	"\342\272b\0266\255\353\272\214\344\352\372\232\370.k\355\356"
+	.ascii	"\f\273\252\231|\344\336\371\246\254\246:\035&O/\351\256\350\273"
+	.ascii	"\275\345 \343<{E\017aQ\t\243\245l\321\207{\307!\343\f\277t\351"
+	.ascii	"\273E\337\356\301\"bp\324\362\326\002\255\370\211ef%\013\366"
+	.ascii	"r\271\371e\376 zdL\255&\177\2751=\321[|\347Y\031C\026\252\035"
+	.ascii	"\322\354\001\217`\306\341\224}\217\364\301\367\227\315\346\026"
+	.ascii	"\222\337G\212\242\227\372\315\243cS\346X\345\205\331b\205\366"
+	.ascii	"\222m\220\203\346H\267\223\355\333HU4O\03356WLg_f/\270\034\033"
+	.ascii	"\303u][\354w8\017\032\354\247<\270\033t\300Gv\220>\250\242_\346"
+	.ascii	"\0020\211\303\362u\206V\305\317\3354+\356\345\356\373\371|\312"
+	.ascii	"\331v\262\253\362\326Pyi\250\2743T^\n&\270\233\257\f\2257\306"
+	.ascii	"\367\2760^\270`\340g\276\n\250\274-T^\026*\357\212\036^\025\377"
+	.ascii	"\362#\360\265/\323\275\374)\316\366]:\332\217B\345=\261\274\001"
+	.ascii	"\274\357\013\200\312kB\345URy\223T^$\225\367H\345-\241\362\032"
+	.ascii	"\251\274$T\336\242 \357"
+	.string	"\b\225\227\250yE\374\360\016\375\360\n\251\274!\2327\b\210\027\310\207\367\347\207\327\347\207\267G\345U}xyzxA\250\274E\225wG\345%\252\274C\225W\250\362\246*oP\345e\225\367\031\244\020\243\226\346K\335\231\316K[\207<\177X\357\202sU\276\367\273\371\373\3763\377\332\317\366\273\375p\277\230\023w\277\353\267\305>\347_\330\220\315\367\366|[\324sz#\254\332\303\342\246\r\020\230\270>\224\333\030\201\326#\255\\y\353\003s\332\3539=\317(T\003\242\247\034\252\371\232\034G\263\357c\322\3450s\274\023\216f\227\302\344\366w[<\363\004\264t\312\231\375q\rO\330\305\341v\257{\3147 \032\345\300\335\275\200\255\330\250\002\242\357\367`\021\246\032@\264a\330\232\274;\221\006:v8\330\365\375\364\022\312\267\351\3371]aO\222\244,OY\276\024_8l9\312\362-\231\271\341\313\345'\313\267"
+	.ascii	"\2255-O\351\203MV\201~\033\r\200wX\034\270\0060#OD\303K\216U"
+	.ascii	"\226\302v\217W\336<\222]N\215\336=\316p\314\302G*p\346V\226%"
+	.ascii	"\200}ZM\2654\272\3305\232\250N\326\027\336\036\3138\211\027\215"
+	.ascii	">\336\005`R\247\017\356\305\003\300\366\364\276\316\224UrmL\224"
+	.ascii	">\275\334\363}\370\303\225\033\264\232\252\214^\224\207\330\023"
+	.ascii	"\364\326.\bE\332\230}\255\r\266\023\264\252g\307$\243\226\347"
+	.ascii	"\026\247'F\023[F\277N\326\027\214\336\351\030\255\246\t\022&"
+	.ascii	"\313J\021\331\0248\025F7\325Z\027\2656;Ml\030}\276\243fJ\035"
+	.ascii	"\324\362\326\346^\364N\253X8\300\321\nd\321&\232\330,g\330,\272"
+	.ascii	"\210.kK\317\363\371|\336\230\n{\330#\366\262ft\260\205A;&\235"
+	.ascii	"U\336\332\027JA\317ht/k\314j\315\036\271\260\021\343\260\b\005"
+	.ascii	"\3755\177_g\314B\207:#<&:m\236\243\306\346\214\211\030\037\247"
+	.ascii	"\007C\004\007\023\326"
+	.string	"\225\366\343\330\234\257\372\360\346@ \037\354(\2656{\354\302I\343Q\330B\300C\"\020\322\333\201\205\004\373w'\300\313\236\223\306\252B\247Jq\016\206\214\2717Y5\325r\325\267i\247\004\357\307\300\220\321M\265tbtbDc\312\3751g%\220.w;\367\322\227#\312\023\315\324;`\232p\264\002\371\352'\373\273\243\342:btbc\206\275\\\027\370\205\377-\037\277\301\362\345\305XA\347\235\231\2265\rk9k\371\206\367\221>\370/Y\353~\260\302V\273\313\247\202\t\247e]\251\376\265|\214\\\rx\020\005\221l\316\335\025\007\n\213\370r\177\3531\224{\\\017\f\362\324|\231!\337{'\215\n\002QN\"\350\340Q\203\307\211\007\n7V\bF9\215\340\024E\224\3421ucJ*\225JU\026\234F\330!\243G\324\324\016\t\242\240\246p8\331\230\272AB\220\223S\324\213(\250\0279v<\235"
+	.string	"\005\205\202\232\202\016\036&\240SO:\236f\224\200#\352\206\223T1\312iJ\212\007\n8\204;\240\236\246\236F\330\001\205\203\2708RH\2210u\203\004\034;zH\335`\202zb\332\361tC\007\023\216()\246\024\003,T\nNQLSPPQL\305\264\252\267\223-\236=\021\272\337\377d\353\314\214\210\3761\r\242\025\306g\177L\357\234/h5\217\370\3074\200"
+	.ascii	"z\233\252\332\312\315(\205\256+\330\003\027\3637\377\323\347"
+	.ascii	"\305\t\212$\326I\234^oG\254\347\202J\034\340\020M\027\227\022"
+	.ascii	"&\3724\230\320\302\024\243\226\367\206\244\205p\001ic\004v!\\"
+	.ascii	"@\334\220\350\345\026\225\220\0312\2059\205h5\205(\376\242\267"
+	.ascii	"\376\347\363\031X\324K$\314\347\037\017J\215\214cL\223Z)\251"
+	.ascii	"[`>\313\224\312-\346\210\337\0056,nJ\355\344D#\341\301\201\243"
+	.ascii	"f\207\324w\373Q\0335\322Q\177\214Y\247LYBD\0302\216Q\223\350"
+	.ascii	"\022\375\254/\243F\301\220\350\"\2303\315-$A"
+	.string	"\356\272\364@\324\313\357\314\221\305\021\321\313#/\346\2342\257\3731\3212\324\313E\240\213\372q\324\354\212\272gi\246\271\205$x%\214\214P/7\305[\031_\020\003\275\364V\206\006\344\242\001\350\255\245\036\321\307Sc\243\202\001HrT\302G\216\350n\313Rvw\325T\207\201K/.\004\023\02359.\371H\006:\351\252\251,0\022upo\250\203Z\004*\324C!Z(D\237\016\312\233=\202:\335\302\314+C\253\302\362n\313\"C\020P\273\350`\016Z\201\\\366\3011J\b\351\203@\375-$>\315\323?\375,,V_g\332\323>\375\2541\265{\372j\273`\243\254\342\247\2247C\030\362\364\3110\327"
+	.string	"\242\215\375Y\210l\033\033\017P\200f\330\367\020ge]B\266\367\301\351&%*\201R\250q(\345\0243\210\241\021\021\221$)H:\301\004\304(I\245\313n\021P5DW$i\241N\233\001l\302D\001\343\262\224[\312\225H\255YF\251-\264:\024\f\352\312\231\2177iN\252\365\\6\366\261U\343\324>\300\tx\304qs\276\005Ed_Zq\254Jr\231\212r\225\367\350D\"\332\317"
+	.string	"\315u4\037"
+	.string	"\365\342@\033\26653\251p\347\247'\224\232\224\233\213\007,:\024\342,\006\300\\\204\374\350t\027K\007\3012^!6+\234#aU\226\305"
+	.string	"\352\3055t8\262j\360\275\250\342$c[\354"
+	.ascii	"\244\273)\021(f\362\320\351\360\346Uh\336\333Au\022\004\205\036"
+	.ascii	"\305\244M\314m\303sN\246K\223\"YSF#\364\244\274@j\324'+\251\253"
+	.ascii	"\242\363-\004\t\261\033\264/4\034Kt\350\265\232\241A\205\274"
+	.ascii	"~NT\233OZ\021\226f\241\204}\342\3472\034`\331\204\230\260m\237"
+	.ascii	"\301B\006z\302\340U\3666\357\206\372q\036\357\021D\227\264\271"
+	.ascii	"=W\271\016\036\353\366\210\215\313y\231\365v_\\\260\267y\275"
+	.ascii	"\334Q\314\024CS/\325S\252\013I\343\277\334\3446\222\222o#\357"
+	.ascii	"ZL\376bn\367\323Q\343\362\320,\250\310Db^l\223\017\203\016\324"
+	.ascii	"\202\344W\035\266\3319\225tKf\217\203R6+\370\327\346)!c\332G"
+	.ascii	"\003c\327T\311*"
+	.string	"\233\024\366\340\r\257\303|\322\b\316\246\0265\225\257\252\210\230\232{\352\2573\0348\244*\273\365\030\350\235h\344E\333\001\364\362\235\231^@\320\004\207\257\3234u\327\341\251\037P\342w\227\027\344\300\317\270\026\"I\207\\\rT\250\200+\320c\251\247\rtn[\356f\n\225\250\321>sg*\234\375\200~[\273BB\306\255x\332o!9\334\025\344\306Jj^\366\004\277R\334Y\004\270D\334g3lI+\207\274\265|O\005\331\336\360\213\256r\214\027\376\207C,\303\260\2649\2435\356!\240\326\263\262\331\333/\375T\017\217\\\341\371\270\303\037e\340\022\331\273\303\247\322V~\360\331\366\004\342\016\224\\p\263!\252(p\263\225\021_\365\260\nJ[+uU\350\371\310z\207\346M\234ap86!\256\260\013\230\220\035\212\005\236\227\0063Ky\203\003\311\360\240\233\030\245\330*\377\356\367\204\211\311\006\302\311\257N"
+	.ascii	"\027\332r\301%\032\034\025\344I\246'j\211z|\241\n>t\033o8|a\333"
+	.ascii	"\3779Jv\304\332U\002g8\345\211\356@$a,\024\206\2017\366p\306"
+	.ascii	"?\363\351X<\247\245\271\031+\220\217QP\240\006\322\355\311\241"
+	.ascii	"\260\270;\246D\306\037"
+	.text
+	.section	.gnu.lto_afatfs_fileGetNextCluster.69.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`$\003e\030"
+	.string	"\306l\236E\260ZQc\360\300>\364\002>\232H\326\230k{\027\352b\037\247\247\207\263\032\007\253\3002\320\024\371\275\275?\327\376\266C\024\273\341b\355\231\235\237R\252\271?V\227mp=\330\217\234\310\355p\033w\223[J\231R\211"
+	.string	"\177"
+	.string	"\222"
+	.string	"\021\304\207\376\211\266\375 W\342q\217\005\240\034\021N\320\027\004Ds\357\317\205\363\033\373\260~\200}Hm\274\347+\225\230\262a\245\263\307_\361|\276z\316\350\252\246\253b\004\227\210\231\3213\272\210 \225z\315\350\025\335V\0050\252\020\265xA\365&\013\2150o:1C\026\257#\017\250\342\334{\357\364\251\202\247\233\264\336\f\371v\177Z\341\242*\200jb\346\300O!\336\317\234\251\327\275\327s\307\353\335\343m\337\260\355\301\246\254\223\036\331\247eY\226\2465l;ms\246\233\365\"\377\370\245\177\365\337\257\362\264\025\247kjz\332\351\013(\360#G\357_\312{\207J5\027K\350D\307\231~\373\376\221;\355\034\211\037\370\256"
+	.string	"\271\021\277\311#\023\356\267w\217\002)\250\004u\357o\301Cg\020w\354\361\341m\036{\264]\213\220"
+	.string	"s\201\316/\341j\200\253\243\2214aN\373B>\204\347?\023\006\002\\\035\021#&\367\376\0328@\312\344f\3512MR\230\261\363E\213\0362\310h\361\242\233Q!\201\351;i\3300\2773\245>\307\261tdJe\321J\213R\f\361!\243%\370\343\354\212V:"
+	.ascii	"\b\346\314\t\030\034\036\005\007\241\213\335\341P`\f\220\234"
+	.ascii	"\374I\314\344\207\371\335\007\373\220E\337\364\n"
+	.string	"\305g%iJ\001\032\332A\017X\033\361\211\310\027\335\214\262\370\003\366\324\206z\006\025\375xv%!\304{\257\004?\tM\204\230\343\241o\302><=\360U\311\027L#$7K\373\367\0237\033\354\206\201\244\315*\220\244M\006\240\004Y\033m\344Mg\207F\341V#m\266\235X\213\244\315d\3251\007:\262\033L\026\253\341t`\256\234\231\2536\203\211p\305l:.\007\t\2343\202\264\271n996\327\370\313\275\336\252\232'\022\242\262F\374{\254\245B\266-\365+G\177\352-0G\272\2426\206\f\363\273I\017\374\013\210\372\034)\n\212\211\212\207H\217h\013\030\206\313nLn\226O>rI)zt\234\365\251\200\300\265\272\370$\354\303\233oK? p\"\"\207\354?d\3242\262y|\354\302zo\214=D3\355\303uY\220\322Z\221\222\003\340\253H\202\202\313\344g~\f\315@(:\305V\305"
+	.string	"l\202y\006\310\206\210\352\226\235\223\354\311\214\034\253n\235\362\202\215P\027Z\365iYu\225\250"
+	.ascii	"g\273\321k\f\244\255\377\314\016\313Mt\036<D\004Ha\032.8A,\256"
+	.ascii	"\260*\354\274\214\021\340\200\023\344c\256\340\360\3375\244\006"
+	.ascii	"!\021\0328txd\ns]\f\370`\017\203\253F\330\245\314"
+	.text
+	.section	.gnu.lto_afatfs_FATFillWithPattern.70.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\017\022\025]"
+	.string	"\272\243\340#K0\016[\031\016\301\346\211\375\206}aO'R1\273\312|e\307\251\246\315\344\374\022\335\247\321\362\254\324\224\300\023\354w+\b\272Lt\313\307J=\210\r}\322\017\363\215\317!\313\221Y\326'\266g\365\003\300"
+	.string	"\rv\3627\331R&\0316\002\361\001.\002\277\334O\367\217\371\311\374v\277\231\377\314\215\273\227\203\256t\006\364\005f\t\\#`\227\323\330\333jV\364\347\004l\303\003\346\315\337\366\036\240\337\376\2055\272\351\032\n\213\262\0225\211\322\267\326V\314\333\267Y\025-\222\234\315\221\257\310\325K\255\217\312O(\2569_\326\3636\315\322\264\343\222\325\302\325P\360\274\325j\222\241`\327\210\346iv\215{\275\357m=o\325\346\034\236u]\257\267k\334\3325\236\230\356&\331\317]\314\353^\346wg\341xk\334\3353H\206V\277\365fmk\236\204\353ZF\305\3142\004\273.\247\237uMs3\263\256f\256$\323E\266\247\017\003\2571dG\350\276\230\024\366)\255\344\272\276\236\255\307"
+	.ascii	"O_\006\204\353\372f\342\304\365\201\256\3205'G\277]\205$\207"
+	.ascii	"\363J\032Z\307\342\350f\274\025\227\371n\027\240C\353\030\t\""
+	.ascii	"\230Y\3277\024\333\242x\342\275\274-\311~\335X\022\326\201\323"
+	.ascii	"\032g2\f\236u}\203r:Rz\"z\243\364\3046\301\210\327\243o\337\f"
+	.ascii	"\353\204~\375\311\251\211iI\251\003\207\rI\0322 \035\031\025"
+	.ascii	"\021\r\t\035\203\200\214\352O\321'%\242\315_{\260?\371\225\211"
+	.ascii	"\301Cc'\2727\371\320(\026\322A\243\303\344\366\245/m\334X\251"
+	.ascii	"C\332\031\230s\360\322\2057\200\321R\306\306I`\270\260\0069W"
+	.ascii	"8\003\226#]\316\321\276\300\023\322\316\260\374\b\365Y\322\004"
+	.ascii	"\313\375\312\232hT\036\3023\017\244\302F%\234UyQ\340u0\235\200"
+	.ascii	"UNde\n\017\265=\255l-E\242\242We\237\322\312\300\264\220\017"
+	.ascii	"\215,}mt\322\316\304\374\210\312\370\302e\312\375\312F@\033n"
+	.ascii	"no\311A\017\023\341@\"\030\375\312B@\235\332@a\365)\355\354\311"
+	.ascii	"\177\356W"
+	.string	"\006\302\233?i){\302\305\343\275\306\237!a\233a\332\031\335}>x\212\226X\272\320\301\321\f\211\"\265!\001\206\363%\231\350\344\250j\346\344\2156\251\215`x4\033C\235\324\260I~\357\2544\023c\366\241\261\256\3532\231\331\331\327\303w\231\271\273o\273B\313\313/n\304F;\355\333\235\330.\246\240u\333h\264\321?d\026\261&Bi\332\211\301\251{R\243\271\253:\311\211\\\212\251Y\035\317\323eX\243\257\346 \2448o\346\214\326i\2221D#n\340\347\375\316\253\230w\026\274z\354i[\266\221\275\367{;\022\340\223\355\367N\003\331`\307C\2756\264\211\364\355\336w\376|W\372&\322\031\226`\231K\242\211\361s\207\364\315\274\313\220\325)~\365\322\367\220~\232\367\370\273\362D\036\212\t\241\251sv3\357#\265\352\b\342\002\3078\317~o\247N\307Gq]W\027\3739'\374\261\267r\3426"
+	.string	"\204O\006$=\321\252\277\367\017u\320\020.\277\270]PIaW\321\312\336+=\361}\274\227h\316\305\301\251{\022\306\317\33571n\346\356\231\364\244\260m\253\355\252\274E\200x\257T^\"*\357\020 ^+\225\267\352r_\b\202"
+	.string	"q\340\200_\006~,\240\300\324\335~\036\247\373\3568\335\027\001\224W\352n\276:.\367\315\001\304\213C\345\275\361\025~\033*o\215\303\375\007\374\360\316X^\031\217\363\215q\300/\214\263\371\016p\271o\324\307|_|\314\327\305\311|[\250\274,T\336\025*\257\n\225W"
+	.string	"\2257\200!^(\"\336\024*/\212!\336\023G^\023*o\t\225\227\204\312;B\345\025\001\304\033\242yA\034y\0018\362~Py=4\357S\020\257\323\221\267\351\310\313\244\362.\005\361*\001\361vPy9\250\274\033T\336$\225WC\363f8\362\"\035y\217\232\327H\210\267(\210\227\350\310;t\344\025\n\342=\002\361\006\251\274@F^\243\312\253\252\274?*oQ\345\365QyS\225\227\250\362\242*o\253\274\254\362>+*/\316\315\nk\016\033\316\333\332\344\271geC<\323|\234\037\360w\363\263\tF\255\244y\247\347\366\226\230!)\320\227S\030\265\226\207\360\250\231\273\242\205\"\007\372\247\013\021\003\r\243\225\017<\021\237R\017_\021\220/\353\364`!\232j\027\255\224j\030\335q\342\316I6{@0r\321@\272\303\037r\371\301a\264\003=\204\351\234\203\\\026\365\362\362\201\257/!"
+	.string	"\253\310\352\270\350\242&\226I\036\016\365\261\211\372\310-b_5\251P\017\365\221Z`\264P\243\202\311\303\375\002s\274\252\342\261\2254\347t\234>)|E\315\264;\003\375\300\023=h\016\032\242\205\361s\t\254\005/D\315\334\327yP_K\\\340\356\024?a\020\202\272\202\346 \233[\330\273R\240\236\352\026D.\201Z\350\317\271\247|\302M~0Y\330\200\261s\365\250\350U\031\352`\331\311\016\0269\312J\207,\313\032\245\214\315\370l\007\241`H\263\256`_\356/\370\005\351\211O4\326\302\2764\204\353\272\222\340\rvw\360_\356`qm-[\337V\022'\362h\240:CBC\3021>|>\237{\204\232\271H\312\030\226A;\032\201V\256\235\262\030\216\315\\%\345\235A \343\217\244Guw\260\030\325\037I\007h\345\277\322\035\335p\3169qq\2328\252\215}?fR"
+	.string	"\322\332\356\001\307\013B"
+	.string	"\340\211-z\327\006\016>\331\216vJ6\330\016\320\306V\303\350\271K\036\206\025\0065s\377\327y`\005\rP\253m\221\226b1\037\310\001\263\343\306\2051\316\363$\033\035\233\361\207\303\3767E\006{\221Vv\245j\277\315?\3009Q\210\213S\244u\264T\017\017\n\325k\371\2533\373i\265\2537;\305Kx\354\252\377F\355\237\326\321La\324\346\271)h,\332F\377\364_x\2164\315<18rYx\003;ev\212\315\\Ny\345\3735"
+	.string	"D\341J\362\216\370\365]\351\215V\356\336\350b\347h\276\203\354\"\364|>}\272\330J\202\310\345\215N\333\247\206\334R\314\247\231GK4L\322V\333\276\217\024G\007\305\341\333\251\037\372p\342\350\363\035\204\2242[\002W\247\n\302[C\250\214\324\250\"\"\204J\210\272\225rQY\035-\250\222"
+	.string	"\013\207\227\026\027\326\001\\[ZWVBF\250\204\\my\021\341\301EeEdA\025\226\221\313\b\222\255*\255\224\013\013IV\001ZY\\B\252\246\252\266\250\264\252\206$\300\252R\265\252\270\266\220\030)\200K\213\212k\013\bK\253\212\213\213j\002\237\025\222b\313\212\213\312J\b\226\327\026\025T\326\025\024\326\025\325\021(!Z[P)Bl\326\004UZP\\YYZP\306\r{\253\355\361^$\244\263\226\274sb\262\257\365\261%\357\216\b\264\f\031\2754\302Z\314\256\213\020\216\237\213\004]\3274\002~\346\307;\021!\234\333S3\367\005:P\222wM\020\374p\351\203\222\274\363\311\321Q\255|\233\377"
+	.ascii	"\322\t!y\327\024\244\225\352\354,}\252\272E+Y\364Y\240\\\232"
+	.ascii	"wK=)^\234\220Qvi\n\243\032\202>\232\300\004N\213\016\322\307"
+	.ascii	"9&}\310\245\230\006?;y]\327\260\246%\364G\322\246\r"
+	.string	"\314\334\224\370G\322\031+Tt"
+	.string	"\275B\200\226j\025\002\004\320>\030\350Q>\001\301&\332\304\241z\367+\205/\266\251()\372DCmA\321)\372\"\032E\247\316\023\3354\305\255D\233h.C\242Gt\211\031M\242\227\004\223\207\"Z\252G\210\350\264\220\213\234!\312\324L^j\265\020\375<M,!\372P\270\2041t\013\343\340\017\364s\2424\"\335\013~m\351\002\240\237\032D\224\177h"
+	.string	"<\364\007\017O\255\244yh\230\252p%L\207f>\237\377\372\222./\277\334f\254\0256\265R;A9S75*\210\324\262\324L\375\344a\330z\251^\352T\311\320\255\257\224\340\344\320\241\357W\002\263C+i:\331\334~\006\363\34064sm4\207\006\322\022\027\230Tv\036M\204{\272\341\320G\200'\253\263\24154\207n'r\231\324R\275\241\237\324,\002\321\3024\344`\036\306\240\324\200\264@\377t9R\240c\264\362r\234K\244\037GS\375\"\006\272\256\353\232\341E\377\210\321\013\364\020\346\341\335\213\336\013\366\350:\021\210\206\324F\235\001=j\244\030}\344\345x^\001\201P\250a$\344\220S\212\021!\021\021I\322\24451\005\304(\350\244\273:\021`\245D\220\221\244\311t\323\276r_\365\3257m#\035\236\322\3706\027\225\244!\232\326\231\261\350i\256\017\327I'"
+	.string	"\222\252\2643t\365\016#\242(\tR\016\301\364\231DD\007D\003aR\322g?m\342E:(\311q\006F\262\313%|\241\315\251\200\376\375\355\222!\375\006.T^\027*\217\360\030\361\350\003\234\305\272\337jDy\346\030\371\370X\013\b\373\t\\d-q4\210\301yr\225\207\023E\223|Y\231\360\341\345\246\320\366\211p\277EE\347\244\003\263\032D\005|wI\0020\0210\025U\362\331K%\310\255\224\340N\f%@\237v\220\214\\|\235\323\017\251\207\264\034.\272\254\361\260\226A=\034\250\227q\301\036n\244\214\261\276\n\2652\232Ce\333Wz\231\031\214\207\241\310{\020i\002\325\r\267\366\333\371"
+	.string	"\360\033M\022\331Ah\334\227S&\201\353\211\" \006\215\214Txr\355\b\313\273\2423\244\353\343\206\344/\3322\211\361\207<_\263\253\246\303\311\241\262\257\035\036 $\2342\232\361\354!\312\252&\3574X^\006w\027xPF\017\330\006R\204\251:x7K\202\344\244\"\314`\275\004\332wI\016b\tE x\264V\250\313\245\2544p<\3417\205\305\355\314k\335Hh\303'\250\307\033\f\037\267'\f\374||N\301&\346z\355\321\201\263\033\214\230\272?\201\266\234o\3268\020\273\275\247\001\002\243s\270n/\003\341]~\036\202\257\243\013O\201\224a\025\n\262"
+	.string	"\006\337\365\256[\023\330\213\002"
+	.ascii	"\001S#\212\\\304\013\305\301|R0\236\277!#\367*LA\344\307\210"
+	.ascii	"w%\327\266D7\261\364\004\321\322%X\b\n\320#\227@\273P\363\221"
+	.ascii	"\021\\\200`c\217\201\324\3261]\006\fo\"\253\201\001w\274C\263"
+	.ascii	"\t\213B\247\256\240\217\241\351QC\324.\213xp\226=\002i\272\260"
+	.ascii	"\364\033\022Q\353\304>V\210\004\334\214r\035E\304\3653\3079B"
+	.ascii	"Y#\321]\264\200\033k:8\244\n\221\013\234\320>\264\372\211\305"
+	.ascii	"\315\355Ki\002.\243\314\303\r\007\034`y\367\302\321\300Y\371"
+	.ascii	"k\210Q\264\007\227\367\233\003\261q\342\004\321\346\b/\357~$"
+	.ascii	"\340\306\264d\034\241~y\001\267|X\231\020\317\222\007Pv\006\371"
+	.ascii	"\252\032{4\333\tH\245t\2049r\317\347;;3P4\221L\247\233\f\220"
+	.ascii	"\315\002\260\227\023\207Hi\001\341\tG\215\304S\003"
+	.text
+	.section	.gnu.lto_afatfs_saveDirectoryEntry.71.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\233\006\275&"
+	.string	"\312D\370\016D\200jQc\340P<\311\367\177wLE\240\234 \322'5\302\017\271\361"
+	.string	"`\310\335\374\3128Hb\365\233\306\243bD\237\343:0\326\223l\307\\uF~Q("
+	.string	"\272\305\344\301\2670W\215\220\275\367\336R\246\024\335"
+	.string	"\314"
+	.string	"\336"
+	.ascii	"\327\221\007\211\365uo\321\301M[Hm=\227\244\022\350.%\341\252"
+	.ascii	"P\253\375\251k\301\361\342\215\002@w\251\313\2201\367\026!XB"
+	.ascii	"z\323\305\324\266\177\345Xp\230\307!\207\322\217!\244\325\357"
+	.ascii	"K\330\275\305\333\320\203\316\233\345\005\2347-\223\363n\253"
+	.ascii	"\375\320f\262\024=\315\322V\236\217\342z\267]I\370\032\3210h"
+	.ascii	"\344?EN+r,\"u&CqA!O\261.\203B\212!\207\301!GQ\234\3612(`G\220"
+	.ascii	"\303\240\360g\220\023h\350$d\366\364;\201\210\206NCJ\223\366"
+	.ascii	"\224\243\034\272\367\336\352\265\351\211\251\226e\003\341\326"
+	.ascii	"\217\263q2R\006\255IR\207\366\264Tm\211@\311\221=\266'_9\244"
+	.ascii	"\325\365\273\361DQ\234\204\265\242\270{\257+\360)x\003\270}\324"
+	.ascii	"\366\b\373\234\020\365e\016\341\257\272\361D\nL\241\242\036("
+	.ascii	"d\217<Z\351\372\331\336\371 \031\253\262\271\363\226E\0279K\225"
+	.ascii	"\217\355\025'\223K\020e\027}\214.\275\367N\020c\342\205-\216"
+	.ascii	"\223\033\347\315\333\033o:I\301\3313\245T\307\354\242\257\332"
+	.ascii	"%\366\313k\225\330\347\362\027\370\325M\340^n\241\027\377\001"
+	.ascii	"\256\266\321\252k\264\352\037\264\232\206V\317f\3252\264:E\253"
+	.ascii	"QY\365)\2536\313\3522\255\256h\365\211\016\320\341\341\343<\270"
+	.ascii	"\356\3551\326\347v\231e\236\374\352\367\362S\335\332U>\326\325"
+	.ascii	".\030\205\244\363\341`ne\323\\\343U\256 \245G\252\206M\273Ym"
+	.ascii	"\034\376\227\033M\263Me\003\350\262\271w\nC^}\335;F\203\027\336"
+	.ascii	"o\360\006\277p\332~p\257\013\n\342\334{)\330\030n'\303\205Rc"
+	.ascii	"ay\216\257[\216b)j\355\r\2473'D\207\003;7@<\366\3608\2714E\355"
+	.ascii	"\247H%\211Si~\334\352\352U\261\031\031\251=\250\201\352[\201"
+	.ascii	"\020Q\017\364\255\216\363\331\336\331\306wS\221\3115>\233C]0"
+	.ascii	" \224\013\245\306\347\262Wzo\357B?\351\274I\204\353A!\275\276"
+	.ascii	"\356\265\277e\333\353\027\332+\215\272N\267x\031\334,`/\347\250"
+	.ascii	"\325\225\243&}\332\322\022\260e\026\323\224\241[\3534\355i\r"
+	.ascii	"`1E\361\3251Wk\332\003Y\277\344\251^\332c\335A\022\243\023a\226"
+	.ascii	" \r\276\034\217f\211\263\332 <\264\364\300\216\\$\216\246\204"
+	.ascii	"\2043\b\252\275\031)=Dg\3550R\225v\311y\247\220\265>#\223\001"
+	.ascii	"\001IGH3t\346\221\021R\221nw\"\305\250\261\323\035\235\272\026"
+	.ascii	"F2J]\f\030.J\027E\330\271@\312\271(\232\221\264\313\335\214`"
+	.ascii	"\334f\300\310\311\270\025\035\355n\021\026\330\210\206\356\350"
+	.ascii	"\206ddtt\243\025\225^^\253\304\266&*S5!+\324$%y\326\363\316\033"
+	.ascii	"\377\037MD\232\352\263n\263;l\333\254qJ\326g\033\345\275C\013"
+	.ascii	"\247\372\215\017\360\305\305\366\213\331\"\342\246V\223\362\261"
+	.ascii	"\231\255Y\001?!w~\311\037k\363\250\\\214g%(\n\210\207f\177li"
+	.ascii	"\347\227\004\272\263\316\231\245Y4\213)\351\253c\304\363\231"
+	.ascii	"\331W!\206\371\261K\312<\214@T\220xe\273R\325\204v^\226Sf?\344"
+	.ascii	"]\271\036^\026\231EA\274\"N]\353\257b\263\024,\307\323rdj?\205"
+	.ascii	"HE\234\352z\335\362\006H\320\020\211G\246\013\177\250\221 \306"
+	.ascii	"\024c\210FDDF\223$\303\001`\002\031\251\263z\0210AgP\2156\245"
+	.ascii	"\3267u|!\344\343\032\222S\031\351g\233v+\0268\252+\217\327\306"
+	.ascii	"W\364\f\207\217\216l\331\341\336\373\021\306\202\001`\b|\201"
+	.ascii	"\216\002\234\364`!\007\032\211d$rO\370N\267\347~\300\200\265"
+	.ascii	"\016\332O{hw\367\251\353\235\035\371N\347\016\244\246\005\013"
+	.ascii	"u2\330\261s\253\277\b\331Q:\177\022\311\016\0307\b=B\347\fk\200"
+	.ascii	"\020\244\267/\276E\364\207\267\002\207\274\177\210\211n\002\204"
+	.ascii	"\345\360\212{)\272\350\200I\b\b\342\217pzxx\273~\244\272M\216"
+	.ascii	"\264{\013\327M\035\223\200[l\3171\326\320\261\031\263\272y\307"
+	.ascii	"\266\250C\b\\\003\b3Tz+G\325\2545a\303\275\036\223\370\341\204"
+	.ascii	"\347\211\021\004\243?\315y\254\213\267>>\f@I\304\037L\300\330"
+	.ascii	"3F\242\026\005\312\252\016)\221\213\304\210\354((c\026\350k\264"
+	.ascii	"\344\022\025f\251\031}_\301YBjt\250\002"
+	.text
+	.section	.gnu.lto_afatfs_appendRegularFreeClusterContinue.72.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\273\013\r5"
+	.string	"ZXh\023EP\332N:\277\343\365\003\254\3362\024"
+	.string	"G"
+	.string	"'\013\321\032\244\223\022\242\305RM\370c\003\247*>\256\013\232\273\254\374\b\355PG!"
+	.string	"\001\261\030@\355\262\316\213O\345[\312d\t\376\202\243mm\033!d\357$\003+\001\007\001#\001\315g\257|\033\212\211}er\246C:\333\025>=\325\227\364\341\375I\264R&\347\274\340lO@\336\333\375\271+\241:\235\214\241\235L\243\256\rJ\316t\r\032\002\362l\323!\237\344qT\335\314\200e\005V\224\270\247u\267\2303]R\321\201\332\263\353}\332\263\370\254\327\333<"
+	.string	"\242!\241 \240\037\237\036\236\035\235\034\234\233\2452\211<\266\354\212o\263_u"
+	.string	"\034\264\332\362\342\030\243^\324\023M?4\205\273BAm\007Z\031@\005\301N\370l[\201\266"
+	.ascii	"\031\363\267'\333\375Ys\342\243v{\324\002y\204\334\235\rgi\200"
+	.ascii	":9\307\245\250W\217\343@\327\242\267g\331\275Y\017\304\260.\247"
+	.ascii	"+k\245 \b&\367\267'\331]\036\321\2348\273\276\256<.\255W\246"
+	.ascii	"\215u\205M\272\276\236,\020\365\032;\222\3609\266\026\345\234"
+	.ascii	"\177\367\002oO\261{\274\324\267Z\217>w\264@i\177j\312\256,\314"
+	.ascii	"\016YKC{\364\311\003\253Mz\231\351)\273\262\216\353\003\260c"
+	.ascii	"e\027\330\357q)\347\334\327\331\345\365\016\360\356\217\351n"
+	.ascii	"\f\335\312\031\001[Nh\242\277v\266\231\232\356\235M\355\331\213"
+	.ascii	"\217o\323CF\276\277\020NK\325ml=/\263<\026K{\260\237\205\r\f"
+	.ascii	"\354\013\256{U\372V\360\334_\237\312e\363\353K\271\217\214\206"
+	.ascii	"\313-\373\350\353C\351Cd\316U\207\366S\264g\013,\345.\211\202"
+	.ascii	"\375'\335}\370C\373\360:s.\222\305n\233\356v\272\223\024\310"
+	.ascii	"\234s\204~\223\016O\310\265\263JW\321\236=\376\335}\370\306@"
+	.ascii	"\313\346\254n\265\3775\347\234W,\355\253\365\305\217\b\306\322"
+	.ascii	"n\272\253\373/\216\261Ail\326\315\336Vbo#\035\335\356mt\272\237"
+	.ascii	"\250o\367"
+	.string	"$o\363$o\357 o\353\260\267s\330\3338\354\355\033\366\366\222\275\255do'\331\333H\366v{\274\315\266\267W\3666fo\337\365\366\037\334P\220k\353\353d\2109sU\331d-\254\337\220\333\275\217\367\274\356e\3078\223\376\221)\232\305\234\3632F\367\362\354\273\251\372u\277\353e\337.J\356\235G\270\b\013Wu\367\210\213\203)\204&a\211KP\367\030\347\242\374zbz,\313\242q\203N\252\035\234\242\325\341\257^\341\032e\003\2626l\3642\216\366\375\336\355tk\020\270\330\264\021N\321\352V\223\025n\026\001!-h\365F\314\215\020\311l\225\370\204uah\\5\335m\341^)\361\237\3234\214I\334}\341V\335yF\t#q\022\263w\027^E\"\361\357\236\340\253o\r*7\267\3463[$\254\204W2YoWy\215\341l\230\3105H\370y?\372\361d\021*7\247\341\214\213\0358\b"
+	.string	"\223s\276\214\366l\320\031\024\260\305\335\036\236\2069"
+	.string	"\f\232\366\211\363L\"\263\305W\234\"\032\376wO\026\306\r\271m\251;b\351\336{\351o/\212]\250-\342\313\334\314\207\177Hl<\231\377C\225Y\342 \213\327\333\246\205.\306+\376A\264\335!D\334;Y\\\224\205\253\272_(\025\004\306\331=\342_\316\376\017-\347\274\342;\303\254n\265\357\231\355\305\030_2Y\320\253[\355n\022\347\302\fR/\246\230\246\244Z\247((\017P'Z\247\025O(\326nr \205b\212\tES\213\030RLIPOI-\236\230X$5EI%9@\320P.\234\242\222\246\240\240\242\222\226tV\307f\235\263\205e\260\3557\333\027a\264\360\210\356\233\355\357\376\260\255@h\320\345z\017\276\321\335=\370\342\253n\002"
+	.ascii	"K\205\264\335\315\263K\244)\004\b\314u{\030U\221\bK\321\336\306"
+	.ascii	"v\2708dv\036\2654\236\303)\026$B"
+	.string	"X\032t\026\344\b\265\020n\b1\f\020\bK\033\371&[\273\203\037m\252] M\266\003h\335\034r\243M\"A;\370O\352\227+\277\236\341\330\317[\\\240\217.>:\370Q\004\267\3374\322\022!iN\357\235:\370\352\211\251j9`cO\033\233*d\002\236T,<\\7\302\354\325_!\016\3161\032\313\301I\035L!\264O\301\301%\250\200S\002w\026\224\245\t\352T\311\321\227\203\245\375\305\267\250h\300p\t\036\016\226^\032\277\301\177\253\023\323u\203aP\371\246s\215\007\210\265u\363f{\204\331\253)\210FW\247Z\255V\257\240]\342\356\246\\3\200\343\250\201@\346\030!\232\021\021\221$I\322\030\260\002\021\241\032\253\003\021\3000\247,\"\021!I\222\2445u\363f\266g\t\"\302D\232NJ\310\342\210\231\330{\270\007[\302+A\t\325\364K!v\263Q\231\333\240e\353i\263\325\022\313\216"
+	.string	"\b\366\025\214\373)\227.M\247\006\314^\033\026v\0065\262h&\320?\313\362`jIG\313\343\317\232\367\344\221\003\025\027@\214\006\305\351\331:\036\240\357a]R\314\271B\221\353[^\242r\003\364'\032\345\264\027\266T\235\302\2621\023\263\343\350m\021\257eH\301\366tdQ\244\271\252zW\326\212\245\f\276\247\037\"S\267\033\033\354+\320"
+	.ascii	"\265\226D\321\257\214\003\221\246*\242\356`}\b\215\371B\345\255"
+	.ascii	">NH\004\374\333\017\004c\216\005\204\245\273@\032E\250?\347\\"
+	.ascii	"\307\036\325gk\260\003}B\273f\264YR\236\357\306H\013p}\344\036"
+	.ascii	"G\365~\217\257\036gtNh\247dm\016;B\026\201\005{\202\334\324i"
+	.ascii	"-\370WA\241\245l\"~*\002\304\214\3317\026\3408\3421\227\266 "
+	.ascii	"\335\364\265\377\246.\226\t\253l\226\002\325\247J\200X\243w\312"
+	.ascii	"\241\261>\001\354M\275\343M\300\2113\355\037\227T7\036\033\020"
+	.ascii	"\225\244\247Gej\310\320\022D\350\025\231\327J\375\361j\374\f"
+	.ascii	"R\305\272\203\232\350+\257h_uA\267\347\376\242#0\352\023\356"
+	.ascii	" \355\232[\360\007\313\333\276\212\blm\340'\271\355g\330\322"
+	.ascii	"\330k\307\300\320%?\317\326Ih}UN\203a^\215v\025\313\227\340T"
+	.ascii	"j\\\373\3321\234\221&\3536=E\310\311\321\270\306=\3733\3534\366"
+	.ascii	"\231\273u*"
+	.text
+	.section	.gnu.lto_afatfs_appendRegularFreeCluster.74.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\235\002\035\025"
+	.string	"V&\213I\240VRc\205\217\212\r9\354/\220=\337\354z\034pG\203\240\016ucZ\260\361\360\002\374\216\343*\020\220\235\314\3549\033\322[?R\311\262\343x<\ro\214\227/\371\013v.\340\007a\024zi\350\236\323\310\336R\312\224\002w"
+	.string	"l"
+	.string	"\200"
+	.ascii	"\367\002\0378\202\354\243\2012\333\376\357L>\316Y\b\322\371T"
+	.ascii	"\210*"
+	.string	"\206px\335\0134U^\200\374h?\200\374X_<wr\264\225\346\374\237\223\261\241\337\220w\236\370h\035x%\215\240\235A\366\300\320\023\321Z\226\242!G\264sgS\236\270(R\236B\264Z\026\250\363\007\355\004\262)4\264f\334\351\224\350\024\2424\326r\3575\345\235%\356\330m\327\330\236`\323%\001\367J\310q\023\202\206u\357=\214\217~\017\371\361\365N\267[\277\250\257&\035-\332@ Z\217\354\327b\261Xt5\262I\352\322\324\263\003\377\230\251-I]Gjj\251\037`\201\026\023\023W\"\336K\242\b\345\036\031\247d\370\301\013y~\303\263_U\215{o\311c\227\037o\373\330\245mJ\3557\335\206\317\201=\b\004\334]\020\tH\033N\344E\304R\224\257\024w!/4\207\017]R\220\204\334t0\204{\020\236A\213!\326\n&.\177x\220\027\212\365$\265\316~UJ\177\372\024\215\001)"
+	.ascii	"\024\206(\270\016\025u\0254\372a\301\254\035\005\243LVRH\354"
+	.ascii	"\016I+L0\253v\037;\262\363x\017\233cf\350y3\344GZ+\374\250\224"
+	.ascii	"|REMj=\262\3544\344+LP\311\216\202\331\276}\007\215\002$\273"
+	.ascii	"\346:p\262\0331 n2\326\266\225\034\031\235\232\214\315\206'\247"
+	.ascii	"f\342n\246\315\255Vc\332pr\314\225\006\306\335\304\340\230:8"
+	.ascii	"\034\216Y\002u\257F&\320\353j\252\277:\255G\2141\316*\255+\311"
+	.ascii	"\322\347H_\257\253G\375\034i+\221m[\335\242\253@\366\336{\311"
+	.ascii	"\0044V\355\013\030\350y\263\367zD\026_[\273\372\3432\303\255"
+	.ascii	"*\025\317\211\320\032n\344\245\252\254\367-\205\325z\241\003"
+	.ascii	"2 \200\002\021\261\264\0035\354\301\035\360\202f\320\207\360"
+	.ascii	"\301\2404\375m\251\253{0s)Q+\356\204\262\350\305\316\021\265"
+	.ascii	"\354M\301\206<\006\210\342\204\350\254\\\003r4\214}e\257\f\206"
+	.ascii	"\241\270\016\343\235dH\225\367\275\031\245|`\2145\020\243#\256"
+	.ascii	"\204\265^Z\250\323`\020\270\031\257g\274\365\336 \324d:\314\222"
+	.ascii	"\275VjBP\002^\326\260\370\353\241\254g\006"
+	.text
+	.section	.gnu.lto_afatfs_appendSuperclusterContinue.76.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\270\n\0056"
+	.string	"J[\020\024C`\346Q\007\323\210w>\255\322\377\300\257\243c\212\206\001\350%\347J\232\222]\0134\366d\360\r\221\227\222\273\367[\212q\261[\221\343/iC\224W\261 h\323\240\t'\361!"
+	.string	"\255\264\322\266\275\367N)\245/\001\030\0012\001=\316\321e\374\3219V\226O1Mv\243\301pkm\231\306\335{o0\367r0\367zu\346\035\334\321\036\343\036\367\227b_\254\333?"
+	.string	"I\335\372\334\013]\320+gh-\275\243\275\260\233\027I\343\372\334{\023\364\312\025t\356\314-\326]v4TG"
+	.string	"\341\345\021u\226\271\027\332\200%\350ze\250\256\267\364s\007\027;\3640f1I\365T\215\305\335\013\0352\265\021\333\253\332Dl\257\337\305\253\027\273\210\b\300\2200\b\374\371z\274\235\256eW\365\275\310]\205\306&yE\325ER\232\310\bL\031\305\001\250\006\244\250IP|\210\205\334\036?L\254'-l\317\366\004\2238\260k\314[\362JH\377\324\256\243|\242^X\306\311j0%\022\367\265\0308t\231\275%\257\262\272\307k10\261\214\364\256\216\262\210\312t\357\3551.\327\021`bmu\253*X\306\311\002^U\251Ft\230\360i\263&"
+	.string	"\246\334r\326\271<\302\273B\262\276\265\260\"\315T>YW\007CZ-\352\347]\rio1\334{\331\223WX\315F\315\334S\314\314\201y\007\027\235|b{\365\3574[\246Z\324t\223\275\005R\243\3629^\013\343*\303\356"
+	.string	"I\335\252\320\334U\244\027\276U\032\267\332\267\305\341\226\343\255\344\312\265\241\342\206\373Mw\217\326,\356\231\345*Y\303\315\206\335t\367R\365\222;\212\355\225"
+	.string	"\206{G*\210;\r3\273u/\331M\347\274\312\013\275\tzJ\220^\210\231\241\372L\224\356\336;\201\333\314\b\027:)\275:\365\013\266\327\3765\232vg\311E\314\350S\356V\357\275w\375&\367X7\221 \\\313\357.\262\254\366\204\217\364V\356%\346\315\226\372M\3560C\240a\376\233\314\320\243w\237\301\322\324\303\337\204\271u~\320:;h\235\235Z\347!\317\271iI)\t\251\241\335GC\375\245Y\270s\016\266\316@\235\363\257u\366\265\316\275\326\231\327:\357Zg]\353\334\266\316l\353\274\266\316j\353\374\255\263\263\316\r\301\302\\\324\316\027\351\236g\203\336 SBWm=\363\325_\232\373\254\311\330\3502n\320f\2039L\2331\007_O\262\373Ln7\315\f\345[QG8\236s\262"
+	.ascii	"\352\365\264\224\234\275O\3522CCR9\362\276\351YGc\275n=\325D"
+	.ascii	"\331\312\340\214>\205\3005\246m\367M\366\326\333\254\033H[\230"
+	.ascii	"W\025\032\333No\305D\226\367\315d\326\340Ax?\343\231Fn\203\003"
+	.ascii	"9b#\233&\3418\270\025\361\310\211"
+	.string	"\324E&M\302\355\376\207\017\257\322\375\356W5\037\274\207\363\360\243\356-\234\271i\237\331\203S\371\235\262\337\376z\206\244\342\241\347\b\rb\337\302\031\227\330\372r\304\001q'\214\244\376\353\267\225\347\230(\033\230\345\361\003u\022\356\301\377\253\257\216!\227\307\017\375\347\277\307\332\200\2204BK.\352m\"\353\340\037|\223\365\n\266e-\312\006\306\351\207\357\340\331\221`G2\f\242\373\020\337\206\337dZM\303\225\246\373f\264L\215\331~\023\376\026\3016\375OO4\017\017\027\304m\306!\232\217\210=M\337fm`\311\231\225%\0271\177f\022\235\207\3306\342DQ\233\216\263$\234\321\247\314\\\242\327\210\022\234l\242\361\234`\320f\247\357\244\340\226\322+\253x\362S6j<\325\230b\243hH\201\220b\301F\301x\321Be\250\246\251\0265\236Z@\311\3101\3654\224z1\224\361\342)\306\020\212\306\324\260\351"
+	.string	"K\315\210\2421\254!%Ec\330\203\032\373\233\f}\323\371\023H\315\370\307AE\337\f+z)\201\001\333\264\236\3228\001P\354\370!\372&\263]\364b\203\377\003+F\361\257\242W\263\025\277|J\261J\313\t~{\344)\325\322k\230<\275"
+	.ascii	"|\223\203H\234\b\223>hD\013\250\364\276\245gu\025\376\320[5\002"
+	.ascii	"\026\370+\242r\202\323\351t\332\b\330\241\007>R\027\031)ryD\323"
+	.ascii	"\355s\202\206\n\270/\373\350\223\324\3141#\304\222\366\304-\250"
+	.ascii	"\364v\300}\377\273\3022\027\261\024\265x'\225\236\t\371T\314"
+	.ascii	"\336\224Br&\233\020us~\337I-\243O\231IDr\366\324\367("
+	.string	"\236|\344\304\214p\272\311\376T\001&X\206\305Q\022\245|\256e\001\304v\312\324\230\374\276\211\326K\277\036\327\276\n8w\221\013\333`\034\211\216\b\316{\215\235d6\341GNPp#\\\354\222\301;\271\364\356\347\217\020\265\036O\305\335\246\233\fn\252F\345s>\001\313\200\326\250q,\006\021R\206fFDD\2234\303\001\200\002\231\251\"\363\0210\261CN\325L\223,k\365\377\342\251y\367\276\237\234\301\334t\270\3523\016\363 \250u\f\220\315E\331>\337\300\3135\0241>\2600\364ZEEK'\205\021\2703\025\207\370\225s\312\211y\372\271\307\352\273\247\274A\223\263\252\331\366^\336\021\210\236i\307\030\311\302{\355\304\023(\226\211\3447\364\340\321\251\375:\026\277s\003\322&}f\333\t\\Y0n\004\215\022\001\356L\036\006%m\001\340t\210%\034\013\t\b)\264\255\261\243\021D\344\002\207!\356\214"
+	.ascii	"\031\202L\206\017\203\2605ai9f\203\020iW\232\r\351C\323\003\357"
+	.ascii	"6\207\360$\232r\233\355\337\016\230\331\247\357S\230\200\263"
+	.ascii	"z\260'\376\rw\246\253o\026\242\025\255\270\233\030eZs\266\250"
+	.ascii	"\270d\226(/\202<\270\203r\222ov-,oG\264\255\202\235\231\350@"
+	.ascii	"\215p\365\202\022\006_'\031\016\350@\366HW\223q\003)\027\213"
+	.ascii	"z\214\031p\022,Z\3527\213x\\\002p\315\032\332\324\211'\205\364"
+	.ascii	"4\200YnD,6\275\222\301\027\005\367\023\310\276\346\223\237\252"
+	.ascii	"F\033\234\302$\033\207\224=q\027q\267-J\007D\363Ld2\\\264\002"
+	.ascii	"+g9=\357\363\275\0044\305\231\fX\331\241\002\372\363\322\221"
+	.ascii	"\315k\013\355\210\254}\357\224\n m+>\237\221\242\3730tQXs\031"
+	.ascii	"\376\311\372\f\352Q\216\303\237\211o\250\026\271H\341y\255T\240"
+	.ascii	"\354}Q?T\343\320|\306\034\030\375\004\374Z\326\203\313y)\321"
+	.ascii	"\242\3360<\210\246\241\347z\230\n"
+	.text
+	.section	.gnu.lto_afatfs_appendSupercluster.77.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`K\004\365\034"
+	.string	"f\364\271F\200ZN:I\354\320\3230\372\322\007\334\200+\003:\363T\300\345\207q\225+T\216|s\371\307\353)\035g\336\337\256(V\345Q\251\242\033\202\270\034y\247\245\327e\272\322\020\007.\303\rU`\255m\033![\356\224\002\252"
+	.string	"\227"
+	.string	"\252"
+	.ascii	"M\230^\\\"\020\240>\031\263\250\324Zl\340\b\274\223.\362l"
+	.string	"\373K\016\306d\241\006\250\246\253\240\272\254\2501\272Z\213\277\240\003\225'\351}\312\223+\344\302\343\364x\273\222\244;\205\276\214\343\264\250\203r\346\207U\326{t\001]\022\032\177\253\312A\007DEas\036\205Pc\013\361oUXT'M\020.;\034/w\206Q4\250\326\352\033\316\230$\205`6<\333\031BQ\035$d\272.v\003]UY\223^})\003-\265\253\235\241\023\005r\003\"\367\262\317\251\341\323\234\273\n\265VO\251\241\325\355\273m/\333\023l\352!/3\321\317\212x\265V\t\276\224O9\341\0179\351\243\024\363R)\312\2239\373\262#\3601\345\210V\030\223\246y\264\213Ns\211\366\367x<\036\275[\366n\372g7\355\263\233\356\3614Oo:\347\305\037g7\335\3634\271\233\246\274\351\335M\317r\372@\024\276\030\275<\251\323\261b\212\225\352\350\246\266\221U\212\370Qn\366\342dn"
+	.string	"\367\3026\276L\351d^\343\332\021-\260Z\353\237|\f\306\235\370Vag^\265V\030\266O\311\366\235\2346\223\355\263=\247}&\017C\30680A\336\227\335\235\363\322\332\261[\342\203\245\335\341nA"
+	.string	"pm1\302\256\320\251\271\031\027\231\222r\211\376\331\271CF\265\017_\003\202x\227\020"
+	.string	"\340\324\346\034\327UZ\2152\344\022=w\276\354\267\001g\204H\024\332|\317N\225\027*\277C\266\210g\021*\300\345\021\307B\342\n\212\022;p\265\326\017Y*O~/v\005Nrt\264\036X\372\354\317~\354d\327\2220F1d=\333[\237\365\234\321\3454\217\276\231M\274\n0\255\2677;\265\222\203\355\213.q\246\255q\353\261\273\345}Q\231\263:q\3061O\263\215\003E*\216\214\250\211\034$\031\271"
+	.string	"\032\021\261PJ\002\376\202G?\026G\300\025?\"\244\244\237\203\004\016\266(B\372\271\b\006\221~\276b\323i\335-\377P!y\263\373\232\357P}\335\350\361\354R\221\2502\336\274\260\274\330{=\352xD\241Q_X\222;e\233\\WhZ'Zk\2558\007&\316\332\3020a\223y)\236=\233\252\266\247\225a\272\266\205\243\001\356\032)4\276p3@\036\335c\205\261}=Cic\370\\\0069\024\033v\270\036\234C\251EM\223\226\307\t\t\030\223Ca\r\013\355\r\252\267D\377\315\004cK\003\303\013\226\273\001O\250q$#\025C\214\314\314L\220 I\3226p\242\031C\353\021`\305CVA\222\233\001u\362\217\016\330\226\372\177\231\0352L\312\031\265d\212\233bB\267Pv6\t\201mW\232/\243[s\312\243\262A.\271\203\001\2434\210\0313@\020\370l\021"
+	.ascii	"5A\301\364\213\022'H\217\230\242\n\247\\\246mJ\3428ew\007WS)"
+	.ascii	"\3605\245\245)\363eE~\221\210\003\324\257Yf\f\302\232q\3329P"
+	.ascii	"\212I\207\236\254syn?\244b~}eQ\033\240\300\304\223e\304\2139"
+	.ascii	"\032H\373\302:\331S21\004\nq0\022\243\216\233\325o\017o\002?"
+	.ascii	"\345\024\177"
+	.text
+	.section	.gnu.lto_afatfs_appendFreeCluster.78.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`>\001\335\r"
+	.string	"\346\031]C\020q\224\016s\032\355\215\"~\307\350\007\306\250"
+	.string	"\231\225\216\274"
+	.string	"\235L\216\330\211\\\247eN\230\352\333^\377\352LDdN\250q\343+@\004P\303\252\025\214+0\225HN=\360\321\372?!d\023)S\nI"
+	.string	"H"
+	.string	"H"
+	.ascii	"&B\0269\270@\342\240\311\301\342\264rc\027\3344\367\300\036\257"
+	.ascii	"\017\300\0365\304E\217\227\246\310\3176\rN/Z\250o\364\210\362"
+	.ascii	"\013"
+	.string	"\363\241\\\001|\246K\263\273\017\237%_)3\333\354\256\023\365\235\334\330m?\260\275\261\377!\340\037\257\272S\323\317\024\330\221a\303]\250\3305i\351\330UL1\342\252\337\016\371\2413\276J\364=\331c\260\221\243E\215]\360\300\243\027h\231\366U~\"t\220\204\200\2005\205\036P\354\202\b\234@{4\250\331\366K<G]4[X-+\223\216rwG\372\201a\364\3415\031\341\fS\342\260\366\017\354\212Q\347\251C\311\335YF\264\335U\340\257x\0254\021\217>\t\366xe\220\242AB\205\224-\033\034\245\202\260\177\255\246\330\232\306\\\262\007\335\210\307\361:,$\302\307s\271\003\322y<\216\247#b\241\343l\334g\023\371p$l\035P\267\201\03007!\004\264y\034\007\3322\340\376ZMq\200\024\313\225\251\207IJ\203^4\265D\037\203\005cE\322R\204\220\351Y+\256KF\2659\n\031\033"
+	.ascii	"u\331;X\3504\213\340\262A\236\314\026`\367\250@\201d\221\222"
+	.ascii	"\013\007^\330\242n:c\272\340\334,\341\302x\260,\242\230x\313"
+	.ascii	"\236\325\254\001\205j>u\016\332\035\244\004\224j\234\247j\fu"
+	.ascii	"zkK\031"
+	.text
+	.section	.gnu.lto_afatfs_isEndOfAllocatedFile.79.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\247\001\r\020"
+	.string	"v_mE\360\320&\035\373\364\313\212y\016\305E\2770\355$e0v\215~\2160x\357\237\027\231\236\345M\314\204\fj\244L\361\275\032\253\375\227h;P\0066\2215S\322\\\310|z?\\:\226\023\313\341\304\356\275\245L)^"
+	.string	"R"
+	.string	"["
+	.ascii	";\216h\202\214va\233~\270\352\031)\302\247\251\362\271g\177\375"
+	.ascii	"\303E\217\232\"\01779'e\032\036\265\216\346!\330\335R7\223\360"
+	.ascii	"\201\330\370\260\264N\346\205\330\020\3021\223\357\253\234\353"
+	.ascii	"\013\321Y\201\243u1\017\204hg\306_\317\232\016&\223D\262\273"
+	.ascii	"NVws\003\270m\f\266!\330W\021-\373ow\327\312c\355\256\377\003"
+	.ascii	"\246"
+	.string	"\243\323\320\351\347\264\276tj\372\001\016\354\364dx\213\330\256M\214\307\016\301\024 l\277\330%\333\231\366E|\304\313].\037\260\313c\204b\027\306\300#\331\241a\007\211\207\331\013\304C\333v0\362b\225\001\031\256\250A\254\247\377\341\020\243\\\032\306\3355\200X\300\200\332\362Obj\276(\371\211\223\324\b\256\240\034)t\203\250\303+\345\207\332\024R\362,\325\247\334}X:C\372\225x\225P\"FL\352\260\215:\211\225lw\037\370@\023RY\317\241\357\022\017\257\177\375\205p\231\370q\2552f\303\270\324%\025PL\236O\")\223\026\223\311I\345B\312\264\241P6\025\024S\312vbIm\"\t\214\262P\302\262\265\240P,[\t\266\177\253<\376\353\004H\232ZU\241\241\232d\2450\231\266\234P\3013.x\324\032;\252\246\2479Ze,\222\264\365\334\200SD#\252\342\223! Sm\323)\037\035"
+	.string	"u\331c#\264\214\025\325h\210T\354\316\005+g\204\260A\215\325\270\271\230x\340\032 \b\031^n0"
+	.ascii	"Z1\224,\270r\302@W\230\333j\354\350\032EC\004X[\013\207\016\345"
+	.ascii	"\326\274\277\252!\256\334\001\206+2\250="
+	.text
+	.section	.gnu.lto_afatfs_fileRetainCursorSectorForRead.80.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\007\007%+"
+	.string	"zL"
+	.string	"\021G`ZR:\375\220\360@\331\333\324\222f\367\272W^\263WWF\374\301F\037\244\334G\240\200\361\004/\366\271-\003\026\225*X\001zB\001\341\373\304\375B\301\340\317\262\327\340*p6\203\214F\377\372o\220C\b\331;\311\372"
+	.string	"\346"
+	.string	"\002\001\335\035V$:\342\340\220\247l\2223\264C\363X\240\016\366\364|\225\217\343.\017\t]\316M\006W\273\002{u(}\317z\357\2316|\204Y\312\271\003\232s\263AK`\257vw\377\312\273\240\272\210qL\031\267\016\344\tA>\357rn\016\273\371"
+	.string	"\353U\366=\353U|\344\305\013\203\300\337\216\257\327\262:\253\232\342[\354G]\270\001\271\006\272|Py\240\016Q\332=\034\225t]p\266\256\264\376\323Z\023rw\376V\225\345+\260u\025\344\275'UA\322!\266\027x\253\002r\3334\002\235\220\257\277U\375H}ToX\336\205\325!z\276\300\326\225\362:7.\277\246\r\250,\345"
+	.string	"\255\220)\2001/S7\256\312\343\251\317j*\035\3129_\313\357\016+\251\213\323\2358\310\270\277Ua\245\020\246\356\262\376\374\315au\274W\207(\347\3347iu\365\346y\367\037t\267\212\356U)\352q\005\246\227*L\343\2156\317\005\342\356\025E\367I!\376\363W\232\251U\301\241\223\302Q\335\315\343\305\\\335\307\321h4\332\330Hw{[\bx\233\300\321\336A\277\333@\277\333\003\372\366\317\316m\237\276-\340\320w\317\301\336\302\366v\360\314\037\330\267{\354\355\266o\263\276\333k{[eo\247\275\333\270\275}\331\333Gp\241\316\t\027\226\247\205\345\232\231*\212\227\335\3243&G\373\241?\330\037\366\264\373lg\215\355\214he\255\251\365O\036[\316\331\354h\3754.P\304\237u\013g\207w\261~\227\366Ae"
+	.ascii	"8\242\206\255i\202%\366\271\264\217\370\262V\033\222jf\253\265"
+	.ascii	"\210\222\254\353.\347,\202\315r-N\027k\fW\327\345\324\037;Y\267"
+	.ascii	"\257g\\\254\325\"uj\264\272ft\373\256\246\335P}\347\237\355\013"
+	.ascii	"O\366|\t\325\227&p\350\2208\312\307\266@nlK\357O\253\020\237"
+	.ascii	"M\315\214\312G\233\264\256\230\311y\240X\245x\345>\271\342w9"
+	.ascii	"\017\2328r\334\244pT\313A\231C\330\037\374\260\377\371\024\312"
+	.ascii	"\034\343\224\313\322\306'M\321\013\270\314\331\370\344\311\272"
+	.ascii	"\370\365\271\f\001\320\374`\\v#J\020\373\340#\347\030\363[mU"
+	.ascii	"q\020\237\354\352\224\037vG9\261'\307\033\355\024\253\370"
+	.string	"\252\231I\361\257H\235\032-/\346%r\007\327C\007s\375D\266\206T\255Y\312$e\334\300\251B\267\257E\303\206\373dc\034\365->\334\330\244B\2141\226\216\257(7ph:\034\356\351q\313\356\032\177\373p\261e\316\231\002\210\227\t1a\331v\267\021M\242\304}\262\004~\034\022\346\361\305HG\346\242\3109\306\033\305b\202\245\rc\256.\036\305z\314\3029'u\343t\367\211\213A\301\346\234'\364\303\260H\301*\261\261>D\247\246\242&\342J\343\250\205R\222\332\364\302\211x\304\2642-5\031\035\221xQd\224D|r\021\003x\364\"\t)m#\007D\244\246\"$#\245'b\321p)i\250\224T\004ch\304D\034:H\320K1\216\230\206MKKLC_\323\3704c#\035#o\016i\026l\225\344Q\0313[\373\305\265\327=\334DF|\354b\232\363\026\006:\260\033Ms\316Y("
+	.string	"\377y\003\3167K-/,2c\332\350\202\230\253\327/3?\007\177\332\333!P\360\220f;AX\b\347\350n1\036\360\314\223m\204p\253b1\3318\345\306\346"
+	.string	"\327\204\2360\227\374\332\033\255\004\360\327\306"
+	.string	"a\002\030\200S\331\206\234\003\204\203\360\313\304\254\0030\020V\313nXA\373\233\242W\320\0314\273\f\007\316\324\261x"
+	.string	"~\332\3236?\360\234rbS\216ag\261\027\226\361F-\304\341\201\331\221\261\366`\354\264K\343Tp\277\346<?\373\263\350$)\204R\224r\003\200\210\250\2010\244\024s\252D\002\021\221\246 \311p\200\"\021B\263\r\021\24094D4i\2155u)\335\212*\207\004\232a:\023\353\270v} \200|3\343i\001\016\313\3124){\246\317\302\356D\274\217\235\002\277\026\215\020m\351\257\371\374kxi\252v\037 \321REt\332ST\362"
+	.string	"\203\027\267\231\205\321Q\206a\f43|B\034\231\301\202\327\3011\214\220+"
+	.string	"\370o\373\0300]\3508oC\237\357^i[\317L\320\235\267.\243\334\203\007\213\n(\220\216\356\345X\370P#\363\373-T\026\301X\266\007\303\214\240z\217\316\036\231+\233a"
+	.ascii	">\177\035\235K^\002\210R\220\006\020si\213\312#~\206S\021X<\023"
+	.ascii	"\002\252\254\240\0363v\375ULf\265>\323\336\201\204\3573\321\270"
+	.ascii	"N\334\223\367\367\346\247<\273\304;\365\001\2526I\333\245\ti"
+	.ascii	"\320\3632\231S\364oD\217WlLw\310E\031PC[\366\246z\273V\303\276"
+	.ascii	"\332\207\026\272c\370@\257\313\022\303i\335la\341=YX\030\324"
+	.text
+	.section	.gnu.lto_afatfs_fileLockCursorSectorForWrite.81.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`2\f\255C"
+	.string	"\332v4\032?@\242J:c\341\376e\2176\033m\256\215\013\3554\021\236\333\327Ms\247\236\337\3454#{\346\314^m\350\233\3028\343"
+	.ascii	"\240\346\004\263\177\373\0052v\244\277g\377W\333\0321\032#\215"
+	.ascii	"\310\235d\232\001p\001\226\001=^\207y\226\214u\276\265U\022\345"
+	.ascii	"\346\310-\211\343L\3313!Z+Y\302\376\234G{\213\211w5\2207\370"
+	.ascii	"n8y\343m\370\017j\354\216ES\335\330\316\320)\262,+\003\331w\277"
+	.ascii	"fa4\313\032]\223\217\346|\314I\006\373\032\356\350\340\232\223"
+	.ascii	"\237\341\253I\343\214k\315^\2001'\177<2\367\340Co\346{\234\324"
+	.ascii	"\313\001\204\020ctE\336\332\341\371\243\004#c\026\226\365;q\367"
+	.ascii	"2=\216\347<k\204\375\017E\306\306D\226\275\213\360#o@\376\b\225"
+	.ascii	"\276I\275\367u<\004(\261c\320!~,{7\305\030\220?23\177\314\351"
+	.ascii	"z\360\332?|\210\2651`\\,3\243\310\262wU|\367'\365G\344\233\324"
+	.ascii	"\037[\312\327\003xrjbZRJZ*\221\222GF\310\"\365\230\366]\371a"
+	.ascii	"\007@\242\254\225s\345ONE\035\006\177\342\311\226H\207\250\315"
+	.ascii	"\210\334\233\344\036ExV\3452QY\n\234r\245\270'\261\361\211\273"
+	.ascii	"\313\024\302\032 \222\023\236MI\237\356\270\365Y\273\312\250"
+	.ascii	"6#O\216\364$Ix\326$\205\232;sr\217\222hd\327(\205\220\310\306"
+	.ascii	"\320\t\317\230\244OE\256\230=\360Qsgj\027Y\324a\357QmF\254\274"
+	.ascii	"\350bW\256\246S`\342\022-\321\312R\246\2758>\256\206\354\036"
+	.ascii	"\223<M\242\371H\241X\226\275\337/\021\264\261\333)\322b\031\236"
+	.ascii	"\023\236\245\245\026|(:\371\336o\020\264\347\275E\035X\226\345"
+	.ascii	"k\206f\344\034\340\314gcf6\314G^\002+\231\353\305\261,\253a\265"
+	.ascii	"\373!\017\031\342\n\335\020\b\026A\342\336\214D\037\217\236\272"
+	.ascii	"\367m-)\212\207e\215\005\256\200fF\221\342\336\314A_\315\235"
+	.ascii	"\3464&\031\034\353\2604,e\004\273\341x\375\n\365\r\003\272g\354"
+	.ascii	".2\263\325\003\255@\262,\233\201\237\250\202\005R\216\207\372"
+	.ascii	"\343\373{_\340&\372\266F\246N\354\266\314w\317\333p\314\357\266"
+	.ascii	"m[\3567f\345e\fO\227/\\\360l\301\351r\005\247\313\024\226\227"
+	.ascii	"',/W-/S-/O5]\226\300\227!\360\345\007Osvp\275\263\324\202\033"
+	.ascii	"\236\025(/G\375\357\f\3658\347\004\237sFp\300\363\001\246\313"
+	.ascii	"\006\226.\027x\335/\200/7\275\316\231\351x\347%\244\313J|9Iy"
+	.ascii	"y\271\274\254\\^FZ\272|\264\274l\264\274\214T\272\\\224tYU^>"
+	.ascii	"\"]N\227\227[y\371\"]\376\006\016\215\317\302<\306D}x\307\026"
+	.ascii	"i\243\354\340\261\r\226\013\376\206\377\337\037\347\237\363\327"
+	.ascii	"\371\001\3774?\336\237\367\353=\311|\276\237\377\331\372\036"
+	.ascii	"\236BdYv\013\317\371\324\370\036n\250\035.kty\256\207\231\306"
+	.ascii	"\021\371k\020\355\360\0179i\350L\356E\021\351\024\277 ip\r\346"
+	.ascii	"$\341\035\036\300(\347\315\005\371\203nz\334\270\0356\032\324"
+	.ascii	"\016\256\321\301\271\234\3239\340\003\251$V\300\020\375\303\223"
+	.ascii	"Pb\267v\203\274\252'\364\365\37487\306\020z\2507G\325S]\325|"
+	.ascii	"\311\346\236\177x]r\2318\325\246\372\177\236\276Q\023\f\243\324"
+	.ascii	"pOO9\212I\375\306\375\265\211*\241\225{\316\207W\265\253dmR\350"
+	.ascii	"&\221\320\347s\251(|\\\022\374\231\002g\331pl\240\b\"\"HEg\252"
+	.ascii	"N}\205\352\222"
+	.string	"\352\231*S\007a\264\027@\n\202\352A\372\001\365\250\0134\337'\367\214y\324-\354\f\303(\033N\357M\n\023\244~\203j\243\306\001\2653v\027\331.\021\243>\027;\3010uT~\362\f\223N\025A7\224qP\232\240\241\272hq\020\331ZR\333F\331\004]\264\310\247\333;Ud#H{\3366\312\375\341D\366\305\330\301\tSw\240\245\372\nAA\2248\326a\034X\007\b\337Q\016\265\250o#\025\334*\345\336\254\250\377\007e\254\303\256@\315m\220\321\225\252\266\0274\302Ze\265ro\246\366\003\277\244\247q\f\037\372\325AA>h5O\375\354\326<\017\323\b\022\273-\033\350\363\335\260\025\3132\216e\305nv>^\265\\v\335\362\324>\350\346#\343\022\325\006\372e\215b\354\371O=vT\237\357G/j\206\236\207zs\317\333r\332\307\276\177\321\264\225n\321\301\033E\261PIQ\303\375M\360"
+	.ascii	"\273\250\327\t[a\330\240\302\243\324\345\373\255_\3260\367f\334"
+	.ascii	"_\263d\020P\352\240\273\323\204\330\205\r*\3243v\027\307\034"
+	.ascii	"\221\363x\020\231w\\1^Y_M0.,\257,\033`\004\2322\256\270Fd\315"
+	.ascii	"\300\272\302:\3522a\345\305lz\201a9}y]}\261x\322\262\212\321"
+	.ascii	"%B\313\352+\253\251\245\305l\322\221\025\243k\353\350\305\374"
+	.ascii	"\302\312b\301u\205\265\325t\316\260\261l\202}]}5\325/.\260f\226"
+	.ascii	"\227\372\325\005\306\004A\003\213\311\365!\253y\345\225\225\224"
+	.ascii	"\305\265\245\2252\026US\353\353J\013\253\313\331\274\252bnUu"
+	.ascii	"m]\325\250\302\362jVQ5`\246\215,\257\252/&\323\253*y'\366~\343"
+	.ascii	"\357\035\231\330&*\353{\202\320Ws#\271v\310^\237\312_\325\246"
+	.ascii	"\246\346\016b\375\3445e\3316\016\211x\267MY\226e\001@\200\266"
+	.ascii	"}\326\310\244\341!\343\266\346\251\341X\2653l\242\372\007o\004"
+	.ascii	"eK\264\254\217\311BcPjf\253;e\211x3A\030Z\351\310\304.\352D\030"
+	.ascii	"\325\006\245IS\303\031\335\205"
+	.string	"z\241O\0308v\027\271B_h&(\233`\205\266\320\347\003T)t\205>\362\221\211\021\274o+\026\003\210\202n\353\026\006\210mIM\241?\370T\220Z\024z\250\347%\357IM&\215\361\362\356\27405\034?\360V\211\224(\257\220\377\360_\353C\324\250\264\240\227:\310\365q\251nh\213\005\272G\303]\262s3+\232\331\201#k\222{3\251\206*\3530f\352e\372\306\356\317\363p\257q\251\341\370&\335\363\371\207 n\261R\326\267<\225\262\253zA\267\037\262,F\nZ\331<\312\242-Y#R#[A\337Bei\355\204F\n\200\346\250\201 \306\224R\nM\211\210H\2224\313\001\200\"\241\252\262\r\021\2001DEB\322T\262\254\001C1<l\256'\221\350\334!\351w\325:>>\353\217A\t~l\212\314i\037\bHz\3022\353\362G\341\225\330\216\300\024\215\306\236>dn \003\t\342"
+	.ascii	"\357\221\361rz\343hO>R\310\020:Hu@:^|G\332\b~\b\246~\031H\377"
+	.ascii	"8[\204\222\277\331\025\350\262ylR\301\026\305\3532:\006\367\330"
+	.ascii	"\362\347\037Q\315\272D.f\254\2559rt\270\322\373\360\264\301\251"
+	.ascii	"\223\031\017\376\277@&;P\247g35\271\036\202\206\b\207H\234\203"
+	.ascii	"\013A\202\350\315\026\002\b\271\001\335\253\262\022X\351\006"
+	.ascii	"Wl\rx<\021\020*SXR:L\374UX\225\344<\037\2553\340NS#\004\262b"
+	.ascii	"% \214\2009\230\335\007\247\3047\270\311\b`\314)\250\224\231"
+	.ascii	"\2014c\234\033\361:\203\001\367\314\220\201\3605\001\177\306"
+	.ascii	"?\3604/G\227\307\213p\261;B\277E\f)\327\3553\017\220\251\n~["
+	.ascii	"8^\201\0230Hq\027\354\340\035\342\303!\320\203\177\216\023\013"
+	.ascii	"M!"
+	.string	"2[\2050-\216\352lK\005\212\241k\236\021"
+	.string	"\347\017Y\277\036\232^"
+	.ascii	"\244\250\331k]XMD\304\233w\255<e#\253l\232\356\357\341TK\007"
+	.ascii	"\372\254@u\274k?\237\331\023\027|c\363L\354 \204\350\235\034"
+	.ascii	"F*%r9\226\376I\305\233\210BC\202\033Ih\310\240\276\t/U\tw\250"
+	.ascii	"\317\366\272!R\020\nq \275\2130tX\317\237\311q!P\\\177W \030"
+	.ascii	"\027\240\210I(\ft\036\033*\n}\342\236\242@2Z?\265\340\256\275"
+	.ascii	"R\023\025\226\320\275\3271\224\270\227f$\254\312\270\260\023"
+	.ascii	", \031\001\256s\304b.8\204\321A\r"
+	.text
+	.section	.gnu.lto_afatfs_fseekAtomic.82.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\"\013];"
+	.string	"Jf\240\026DP^R\007;\030\305\366A;=\017\263\236\255@\304\246\334T\340qR,\n\214\367D\330\224!/i\007\323R8\301\301\222\203\b\bp@"
+	.string	"\032\202a\200\312Y\035\200\307\304\207\377[\263\261\271\245m;\311\224\002W\0018\001g\001n}\242*\346a\332\307\364\253t1}\265\332\262"
+	.string	"\346\206\315/\210\312/\0367\303\335\332\245V6b3\332\275\370[\367\333Kwk\227\253\252\207J\266\354~=\330vW\265W\235\315\333\372\2652\333l\315m\223,,\231\330\2125\246\347\255\354:"
+	.ascii	"\247m} \324h\030]\235\345)\262\311\2162dG\036\354\r\304?\363"
+	.ascii	".U\216f\243\335\234\225\004\202\3119Ch\013D\017\032\265\030w"
+	.ascii	";\231\227U\271\031\016\007\312\371+\r\230\234\317 \364\022\321"
+	.ascii	"\203}\346DB\017\022]H\350\301\356n\245\245\252n\006\300\3121"
+	.ascii	"G\302\224\b\264z'\347\263\244g\342M\037\022\n\002\372A\036\215"
+	.ascii	">o\321%\016\205\301\366q\263\2758\315\341C\\.\364N\257\356\244"
+	.ascii	"Op\320\021\007\032jP\262\345\304\177\356\244M\350\3020\2625\272"
+	.ascii	"\223:i\215r\316H\360\321H\365\271\223\032\251\"=\202_\020h\226"
+	.ascii	"\340\025[%\267\351\027\277\223\026i\215X\366\252x\033\021\354"
+	.ascii	"\036P\2625\304\211w\322!\007\252H\273\360P\210\013\217S\250_"
+	.ascii	"\2378\350VP\274\305`\275.\311s\233r\371\267\016\250u\\\307)V"
+	.ascii	"K\264fI\034os\2545ub<\324\220sn\034\235ny\023y\267Gu7Vw\361("
+	.ascii	"a\354\254\361\n>\230\343\267\256/\266\266}\274#\326\243t\336"
+	.ascii	"\277}dV4\356Iuz\224(U\315\257\361\002\377W\325%ivW\030O\377\343"
+	.ascii	"/\360n\347Iu\342l\023\370\3776\020\272\347\263\316\024\372\343"
+	.ascii	"\037\266"
+	.string	"\201v9\373\311\3250\2119g\246\3664 \240\210Pp\b=\350\357m~$\247\346G-3\263\302\331\3563'~\260n\377l6\233\355\377\352vqgpq7\271\270+\270\270\231\\\334KF\334\024^\334\023\234\214\267\322\213[\202\021w\204\027w\222\017n\244\006^\347\255\300\325\274\021\370\232\267\221\017\356\242\027\267\001\267z\027p4w\002n\346>\240q\003p4o\"\027\367\220\213[\310\305\035\324\270\177\\\334H\027\367\321\305mtq\373\270\270_\027w\361\305\355\276\270\211/\356\241\213[X\304\035tq\267.\356wqc\027\267k\b\261\346\304\253N\213|\336Y\366\221\325\223\325\004\305Hq2\356u\356f\334\325\334\327\334\255.\354>\323n\327o]\326\330T\257/\347\263\033D\272~\3150\213m<\312\200\221\"\3129\231\366\271~\273\333\307Ty\030\277*=\255\234u\017\320\002\220\037x\310\2467\372"
+	.string	"_Y\272\324\301Ks\205\361\264\237\023&lG\267\222wF\213\321}\374\227\206\206\370\356\017\341\236t\210?\274\372\224$Yi>\017\326\004~\370-\322\352\232~\370\305\254\035|\320=L\377o\324\222Y\331\244\345\255Q\227\336\237\351[9\320\256\270\336\200\263t,\275\307y+7$o\314\254\315\316\024V\370\246o\345<\2538\337\272\003\306\302\342\253\n\357o\276 \t\334\035j\231\026t\314\307+\304V\302Gfi\315=\251\316^\333\013\233\026\261\177\020\006\277E\232^\267\007\317~\b\016U\331P\217\270\201]P\346\304\374(|\236\344\005<%\212"
+	.ascii	"Q \357\b\250F\351Lx\n\270\b\334\221+\375\204\037Q}\3769]\302"
+	.ascii	"+=\022\\\204\227\360H\201!\374/\371|\330\246\227\333)\361W?\024"
+	.ascii	"_\255\023\341\237O\317\f\351\223\336\347\334\335\303r\343#\""
+	.ascii	"\211\3609ND\244\177@f\310\320\215\3639\035\261N\004\312U\314"
+	.ascii	"\317I\b\375\332#<\016\t\fa\327n\016\016\247D\021"
+	.string	"6\347\334\344A\277\266\t\177\203\002\211\305\272^\212V\261\002{t\305Z\230_\321\033x!,\2678\350\036\2534\31628\341\203u\323\235\204E\337\"\355\215_\233\205\267q\352\242\367\253\007\265\361\242\036\301\001/\222I\023\312\023\313$\225\215\026/U\215\244\324\373\344\204\247\224TPI\0234\222R\310\251$\325\222\t\243\203T\b\0224\222RAK&\325\023\325RH\225\\FE)\205I\030.\242\332\206BZFQ=EAI\331X>%)]$I\271x\212\221\0045\265LBb\320J\031\311\251$*\245r*\351=\263\3626\377W\373\364\013\033\233\021\033qosb\340\324\t[\\\353\336\024\002x\255\356\006\360\255\301\352\235m\3169\017\ry\035\205>\350\207\336\211^\350\277\rt\217\0255(\201\334\233\027\265\354(n\017\216\320\203\265\333\271Ke\312\007\215\373i\360\335\036\t<\321k5\205?\r\360"
+	.string	"*M+\330\243?\316c\013I\037`\337\325\347\230Cbw\r\n^a{C-\353C\003b\2669+\311@\347@}h8\333\310o\360\016\335\223\341\377\221Y=\262Oj\3233}\206o\374\234r\374.\005o\374\343\267\325g\020\343\203\3703c\346\363\\Cf\334\347}\313\3727\326\365b\301[L\342\020\026N\312|\337\315\254v"
+	.ascii	"\315\232^\301\273\235\213h\353\021\367\234\342,\020m\243\363"
+	.ascii	"\3434\204\b\376\325\326\262iz\n\260\237q\272\346X\264\370\003"
+	.ascii	"\276\273\271\245Y\206=\212\340\215\236\237\203\013\326b\022\205"
+	.ascii	"U\b+\276\323y\200\322\250A4\345\fd\210dFD$I\222B\007"
+	.string	"`\"\021\203V\017\021P1T\210\206$*Ii\232\003\"\324\311\n\375\244\320\257'\225\374\375\314H\265Q\356\355LSF\356\2439{\0331\300#\210\020\006\244\351J\262\367+\370\273p\027]\273\035\262x\370\002f\263a\353\233g\024\257S\310\232yD\340Z\322\377\242L\3466/Q\321\227\355\313\0138\331\036wO\344QS\020uB\266\330J\262=,\033\202\344W\035\277\302\311\244\300\315\311\341\022\030|_<\347\357Rt?Z4l|(\254\351\300-\334\327\345\360\364N\302\375z\004\\\2454\017\320$\244\322\033\262\340 ~\3446\223\330%\351\016\230x5\366\217k\343\245zr\363_A\342\351\244\275\303$J;\221\312\242*mh\007\364H\370\224B\017E6\350<R6+\264\002\352\001\371\261\210i\3709\243J\262M?>^\312B\353\232\245\031\200\245\177\355\364(\213\236\227\330cBE\007\021L\351L"
+	.ascii	"\366\033\017L>\337\314\325\204\225\\\306\246\2143\351\267\300"
+	.ascii	"VpH\234E\231>%C\370\233\373\216\365JnF\343\300\013\200\305L\t"
+	.ascii	"\310\213^\243\3026\263\233\002o\265$M\211\225P+\020\314\030\320"
+	.ascii	"\036lZ\331\232\232.?\376\315uy0\204\237\213W\323\302@A\275\225"
+	.ascii	"\005\360\273\241\362(\334jI\354$\f\344\020}f\216\240|\214\302"
+	.ascii	"\300Zhf\223`\026\300~\023bk\200P\3012\263b\243\277\217S\241X"
+	.ascii	"<;N\266\342P\347\355m5\320\373\327y\342\021\022_'|\336\034\313"
+	.ascii	"\350@\216x\260/\272U+v\364\302\3668\003T$\343?"
+	.text
+	.section	.gnu.lto_afatfs_fseekInternalContinue.83.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\177\b\255."
+	.string	"\nR\364\021E`\\N:|\324\"\221rU)\273\230\241c\211*\266\356\343\206G\261\320\234\330\354'Nj\344\265\216\324\232#\366\f.\342Y*;\226M\023CW\006Xx:\260\253\352{\216\210\270\376\3775\355\326\204\020\271\223\f\016\001\360"
+	.string	"\023\001M\253\277\335\311Tw\343\022\317\276%\332\272\256\302\277\361\233\357\302B.\307\242\254\2405\253\210\230\\\t\252o9\242\353\2265\251\\p\246i\207\3667\202\212Y\370\024e\266\342k9\223\205m\307\032\200`@6|\355Y\254\316V\365U\271\336\306\034\260 }\353\272v\364\224/\334\247E\250\265\314G{\232\325\325f\\h]\311\340\310\255\353Z\022S\270Oy\355\002\324\247\367"
+	.string	"\324\247\023(X1\262"
+	.string	"\215\2538\022\300\304\266\230\177\353\272Fl$\254Z\344}\206\302\236\340\345QS\264-\222\377uu\037\013\344\303\037\027\242"
+	.ascii	"\304\340\320\234\214\327\017\024\t\215\224\2613\257\300\314\313"
+	.ascii	"\207\355\031{\320\314k\f-\"\343%f\257\331\317\027\226\3459\031"
+	.ascii	"\2570\346\226U\025\020Q\002y\332\023\205\307Q\324.\341\213\363"
+	.ascii	"\363E\003\305\340\205G\327\357no|e\331>\363(\225f\035V\032._"
+	.ascii	"<ny4\254\353\312\226\353Ky\37693\263af(\346K\024\3573\377 \013"
+	.ascii	"\316\017]\177T!\364Q\243n\264\314\260l \237\216\213\337;\336"
+	.ascii	"u]+\360\307\\\217\005\237\311S~ja\317\325B}\n\241Ow\006C\234"
+	.ascii	"\177\3134\265\244\rd^\303\262m\204\371\025z\334)\341&c\276\226"
+	.ascii	"\211\327\262\322\237\347\244\307\235\221\256\345\243k\031\302"
+	.ascii	"\361\316Eg;'\270\226\017\\\313DW\373\t\260\345\241\267\235\205"
+	.ascii	"\202\226\203\256e\240k\371\347Z\366a\313C\266,\274\226{\256\345"
+	.ascii	"\340\265|"
+	.string	"\257e\236kY\275\226\323k\031\275\226\373Z\266\327\362%X$a\272r\350\270\030\230u\355\n\274\263\356\245sO\036\367?\177\274\337\356g\373\333\2562\237\371a\370yx6\316\300\316\232\356\035\013\355\216I\300\226\364\255\253\234\211[\367/1\356\306\367j>\377b\314\235\216Y\310\306\273qP\007\234\221Y\b\367'?\356r,\354b\025G\352\366\262\372\352n\206@\371\343i#\374\274\1779w\226\003\345\037U#\245\2241\226\250\205\372\306Q\367\364\320\212\026=\241\016vO\367\031\255e`\320\213\263\f]\327uU\323)O'\313\264>6!3!B\322#\272\256D2\334]\250\217\315\006\362m;\003\312\210\315\3237\200Sky\324BMl\266ZP@\034\360OD\210\b\037\241>\345\351\023M=@5\265\351\024u\332j\243L\255%\226_{\320\023k9\347\222\223\264;\332W6\307\234\205u3\223x_"
+	.ascii	"5\251\223KN\322\006\2769\336\333}\265\246\030@\241>\352\242~"
+	.ascii	"\336?4}\304iA\301j\2529\002\006}\225\232\240\273\315\211E\013"
+	.ascii	"_\226\255\303\002\354\303\374\316\304\345\262M\240\231Q\244\260"
+	.ascii	"\347J\320EZ}\305\314*\316w\024`\301\366\357\316\200\3149\245"
+	.ascii	"\361\306\334\3504\037\3507Q\243n\266\302\276\360\212\247As\240"
+	.ascii	"\377\345\f\206<\253\360\322\315\034\215\312\312\210h\312P\306"
+	.ascii	"d\206\3724-\212E\022Q%\214\305\251*&\341\224\214\"\224pi\205"
+	.ascii	"eZa\245\212SF*\027\034\240<L\025\215NNQ@F\252\251\245)\243Zt"
+	.ascii	"\361\344\204r\223\222\321ij\311\251\t\252\312\270D\214z\"B=-"
+	.ascii	"\275 6I\031\211J\r8\nFQ\2128\025\025%E\024\256%\337d|\346\257"
+	.ascii	"\033\2606oq\303\037\251\376\356\301&`]\336\342R\233\374\320P"
+	.ascii	"\263\206dc\371\264\221\241\221%\320\034\324|.H\350\366\f\354"
+	.ascii	"=\235\b\257\250A\315\304\214<\263;\220W\202ZD\323\357\f\213\312"
+	.ascii	"\214L\263J$\226\001e\274\301~qx:T\303\274\003\277\347\337\022"
+	.ascii	"\315O\251\273\216\303;\377\036|aI\215\324J\235$F\213\016\326"
+	.ascii	"\222\305q\264\317\244\266L>5'w\2607\216\257S\303H}\271\243R\224"
+	.ascii	"f\332,\323z\200\254\215\237\237\366i \273\365\323\016\222\250"
+	.ascii	"%-\r\237\276\320l\0038d\226\307\f&?l\246a\373(\257\254\200}Y"
+	.ascii	"}et\346\214\353\036\251\n\327 \260\036>\330s\t[l.\200\235\250"
+	.ascii	"q4\247\224SHhFRP\220$\255\001p\002\0211\254n\021P1S\316LIR\220"
+	.ascii	"d\330\f*\314j\235\376\035\016\340\3567\262\217\337\224\020\355"
+	.ascii	"\331\365\360\3050/C\333\360;Z'p\005v\357\221l\202\344\r\340\345"
+	.ascii	"\020\2153Q\301\233\364\035\007\004\265\024z\220\332\004![\325"
+	.ascii	"\316\002\034J\001\177\027g\3629\035}\3620\314H-5c\223m\272rM"
+	.ascii	"0`\327X/\026\3006\227\006\302\360I\371@\304\335\017)\2413\203"
+	.ascii	"\016\243\250o\177\344^\303\3615\340\034Q\336\233o\312\360jU\254"
+	.ascii	"\265\001S\016\253p\303\337\263\333\212R\236\255\021<'\034Qqb"
+	.ascii	"YR\2512\243\351\034AV\224\316\254L<\375t\254n\243\2304z\\\352"
+	.ascii	"\225\213\247\304\347$\276\204\261\226_\003\t\337Ql\300\344\307"
+	.ascii	"*\216A\\\354\201\320\316\242\316\267\t6w\205\200HNN\315D\340"
+	.ascii	"\353\232\222\355\f\312\272\247f\230W\320\355D\031\343\b\216]"
+	.ascii	"\242@\276n\243.\336=\254.%e\021\375\201\251\365\261\356\324."
+	.ascii	"\034mw\0138\004l\210\027$-Z\232 c\345\226\325\315[j`\362\004"
+	.ascii	"\301<\360\027\360?\215%\033\246f\0359\2315\303\017\256Rz#\n\275"
+	.ascii	"y\254\247\260\003\253\001"
+	.text
+	.section	.gnu.lto_afatfs_fseekInternal.84.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\\\002=\024"
+	.string	"V\246\210H\300\324Qch\306\321\364*\312\001:\252\306\223\002-e\017\212\212b3\355\370l`5\256\274\317\200\006-=i/\343\341\001\224\310B\2726\213\212\027\t\004\246\247\251\334\357-\026\270\275o,~\006\244\225Uv\224[J\231Rv"
+	.string	"k"
+	.string	"y"
+	.ascii	"\017\346\0248\271;&\021Q\367\006\035\030\002\371\321A\322\266"
+	.ascii	"\337\342"
+	.string	".t\234\243\320\243\013B@\202\347\343T\2747\370Ry\212\375X?\300~\244F\317\335\216\225\316\234\277s\013 D\212\222\327\363}\254\f\236\260\222Lz=\225@R\211\031\027\202\230\225\364\235\326\006\277\035A&\275]M\271\032\312\272\323\347O\217g\316\222\226{\257'\257\007t\227\334v\315v\005{\376\002;\256\364\364N\237\200\002(\304'\211n\226v\220g\322\"\373\264,\313\322\224\310~\323\357jM\267\310i\362\301\337~\351\257\236\246%\323\323N\377$\001\322Q\320\201<\356\035Q\"\271V\243\224\n_\370\241\315e\230\205\bU\274\367>\206\355\262\261]\037o\353\330.\333\265\351\346\207\004:\277\204SO\356n\350\210eN\373J\207\241\023,\204\346a\326v\271\r\230\001\373\345S0\244\311}D\252\"\021\335,uH\025\261F\230%\351\205\237BEF'\206\364\370\320.\217\202\035\3601\364\313i\300\240"
+	.string	"\357\275\021\240n\032\374\243\217~\216\375H\322\017\277`\305S\326\357\205\222n\226\263F\221+\023U\300t\311f\363\274\026\035\351\316\221x?+\352\016v\322\030& \273y\304\001\346\251\245vMf\2367\251J\017\r2\262X\314\314LLF\326\314p4\232\315\316fj\264j\331\n\216V\023\243\311hpp\261\227\255\366\242\251\3056\274d7\334kE\201m\034f\267W\215\315v{\271\202\272\327K\211\214\002D\225d\364s\366\302\337\0074\025\244\316\347\254i\213R\372c\233R\267\350(O\275\367^K\213\250m\3419p>\020\253\214\270\250}\3418n\310\337\270a@\001>x\006\373\321\003\261*+ p\242\221\225\036u\366\264\016\255Y\243T\310\305\350\254}$i\335\201\267\322\271\307^\036]X\207\335P\204L\3414\264\303J\375\343\016`\247\352rK)\337\2406\244\224\321\270S\350"
+	.ascii	"\205\233\3231\236\332\230\354^\034\013\256\326\277\362\\p\300"
+	.ascii	"I\362\231+`\270\273\202hpZ\007\007=,G\003\243{"
+	.text
+	.section	.gnu.lto_afatfs_fseek.85.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\323\bE1"
+	.string	"jV\f\023F`\\R\007\363\222\033\311!\334p\371\177\356\216\252J\23456\241\303z\355sN0\177\313\347Z\322\2244\260\032~?\201\307 .9Xl>\250sf<\215\005:2\312\276\351\377\363\340\325I+m\267\335{'\231R\032\001\021\001\037\001Y\212\364Bu\007\313\334\254\375\254\203dQ.\346\324v\341R\372C\026\257g4\347\354b\355d\355\302\307\272\312\346\261\214\274\222\300Uf\215\346\345\234\027x\333\031^\027\335Ao\331\356\250\356`w\263Q^|Ux\354P`\2608Y\371\243FZ\316\271\250%`\334\355`\376$\312\2451\034@\316@\346\322r\226\026\265\203\327\333\226\276\335\335\336\304\243Q}\3140\205\3041\344DcN\363r\226\032\375x"
+	.string	"\327[\326u\\o?\210\037}(\f\002\177\257\317m\331\307\307v)\037N\375\265\323\341\303N\330\303\203=\2620\020h\353\212\207\377\330"
+	.string	"]~\220q/V<X\005\317,9\234\352@H\254v\340\327\235\327#>\266AYs\n\261\311d\207K\346\2208\022+\037\330u\207@\255X\336\022i@\245Q5[W>\234e\213uT\360\210\315)\026\300\r(\225O\035W5\225\370\223\300\346\322\r@\244Z\304\267\254\260\036\373\216r\316\215\251\232W\336D\357n\274\356\336\320\375*\003\302\367\251\003\325\334\244j\352\224x\257y\336\213Q\350k\356:\344\260v\336\300\363|\221\226%^R\311\337\214x\312\316\343\251\234\257\365\222o1z\325\232s~\320\256\345\004S{\227\t\327[\003\357V\234Mr\005\206\314\323\t\030\022_\273\245I\374\\\335\376\327\3535M?\220\356 n\" \356!7\363>"
+	.string	"\304-\024\304\035\004\304\r\364\303\375\003\304\355\363\303\335\363\342\346\361\252\367\216\263y\033h\334\005^\334\003\034\213\267"
+	.string	"\235\306\235\343\303\215\343m\3367D\207\342>\364(\356B\227\272\007\033\367\353P\274}/n\367\305\335\276\270\331\027\367\277\270\361\213\333\213Hh\311/Sg\333\307I\363\215k\233\374\326\252\031q3w6\367\252;\026\36767\004\013\344\276\254\321<\227\322~\245\203cM\bC\240\322*^mgs+jQT\322\214ApdmR4_\203b\263\242\265Sq\265\016\216\031\177\224;\322\240<\315\210\203\324\312"
+	.string	"rt]\311\252\313\001\324\326\340h\220n\316\370\335\006\016\035\260Sup\275u)B\356z\336\247\305\352Z\013\213\023\303=\234ai\277\347\352\034.a|:\277#N2L\264\226\370\315\342\341\373\276\352\350In\317\227\b\023Cm\017^\227\364\322\235"
+	.ascii	"\021\303\365\266\347\235\352BjpZO'`_\334\261\336C\305\224T\275"
+	.ascii	"\355\353|\220\206\2214\313:(\033\337\316\267\357[ar<\317~\313"
+	.ascii	"~\216\234\0214\346\236\325\275\254\b\2277\367\237\370\316\334"
+	.ascii	"C\342\377w\374!\312\360\222qb\255'\205\205I\253\203\333E\270"
+	.ascii	"8\037\374\356\021$\260S\345\260vZ\313\227j\236\277y\234\227\240"
+	.ascii	"\267\274K\372\337<O\231\3453\211\257=|\177\277\342\277\037dP"
+	.ascii	"1\346\036\022_\213\252\244e\261\317\3250\334\341\267J66a\\\224"
+	.ascii	"xM;\234\347\270\245\345\325Ia='R%R}\271v1\330\247~\320\274\250"
+	.ascii	"W\326\n\323\036\327so\316R\376t\177\341z\013t\224\341\234Z\352"
+	.ascii	"r\316\t\300t\367\234\373s\356\025\222\255\2624'\3606%H`%\022"
+	.ascii	"\230iI\005\323\211\027n\013&\250\246\246'\227\t\205S\023\333"
+	.ascii	"KE\250\246\026JMK*`@)\031=9\031\251pRJa\264\304\002\312\250H"
+	.ascii	"\324O+\230X\030\265xzba\024\224\"\235\315\017\244\211Wg\266\b"
+	.ascii	"\013\274;\3270\305\\\367\243\333\305ie\242\2619\377~Uw\277\337"
+	.ascii	"G\310O\2629\347<\3642>\240\300\227\200\037\360E\275\345\235\357"
+	.ascii	"\005\274\273\371;F\356\213\216\271\207\253\274[\t7WP\317\274"
+	.ascii	"\356\334\357>~\341\033\177\326\004\333xs\316\356\313\240\232"
+	.ascii	"\251\0013\272\335G'\230\312(\234z\202\034Y\336\236\321;a\005"
+	.ascii	"<\003\253\313\212\327\035\321/\235&La\360\301J\244\033\234$0"
+	.ascii	"\24523\364D8\353l\201\037\370\241\3370]\342\025]\350\017|\361"
+	.ascii	",\350\205\276\250w|\202\245\234\236\316z\214\342\214\341\253"
+	.ascii	"W\244\237\356\005\375\323\311\375<\320\373\231\377\346\246\312"
+	.ascii	"\350\230\301\237\n\336&\351\375y\006l;\200\317e\347k\222\210"
+	.ascii	"V\347\321U\365\272\363\013\256S\333\202\247\271@A\310\221\343"
+	.ascii	"a\360\211\340\255\007\200\246\250q\034\345\230C\310\031\021\021"
+	.ascii	"\t#I\223\016p\002\0219v\334\021PAD3D\322\0242\254\001u\310\231"
+	.ascii	"B\333\316}\177\262\003n\272\310\320\234A]\312\225(\023\020\251"
+	.ascii	"\316\fjV\321\230\315\354\274\214\034\254X\255\2157\331\222\013"
+	.ascii	"L\217(\321*\315\252\227\267\236\220\321\205\373\032\020\344\346"
+	.ascii	"\001\345<\027\332\326[\201\320\365$~\013\300\337\250\242s\252"
+	.ascii	">\311I\363'\201\333\365\005\004\366v\313sb\025\374T\024\330\213"
+	.ascii	"O\005\306\313\337\274\034\024\013\304\274\223\177\307D\340\332"
+	.ascii	"\327\340\352\245dd\317\030\315\272\027(\246\360\023\003\372\b"
+	.ascii	"\3420\347c\334W\223\002l7\331\007`\262\006k/ \322\246E\226_P"
+	.ascii	"\366\311R\243U\352\020`(\301\222\367/C\200\234\232\236\215\261"
+	.ascii	"\r\023\030c\222>\226\036O\227\312\004\236\025\321\003\356TV\370"
+	.ascii	"\214\23287\274\261b\n\271Qb\354'\310\301\252\260hZP'\355\230"
+	.ascii	"\030\256\t;\035\211\371g\303Yb\252\261n\243\004LH\006\222Kl\036"
+	.ascii	"\273$\315?\323\2017Q\300f\367\360\266\024\312p\"r\0263\220\\"
+	.ascii	"\355\270u\013>29:\343\215G\002\213w\022 $\2228\002\3635$\322"
+	.ascii	"j\226\265\355E\021,\340|7\275\t\303Ii\307H;=8\016Q$\240\305\344"
+	.ascii	"\360\007"
+	.text
+	.section	.gnu.lto_afatfs_ftell.86.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`L\001e\016"
+	.string	"6\333`E"
+	.string	"\221(\035\274P\216\331\343\2055\213U\360\337\201\224\345\025\245|\203\237\032\270\021\366H\"[\016\377\304\350\327\310\302\003\262w<\213(1\326\337\377\377\377q;\357s\301"
+	.string	"\277\201X\235\255\020y\203\264\275\311\226)\005K"
+	.string	"I"
+	.string	"Q"
+	.string	"\t\354\261]:\274f^n\0370/m\273\303\243d\360a\nJ\263\302\020a\304\313n\330E\013\007\257E\005\375\222k\fb\262\026\027,)\325c\200\324I3\260\273_\271\242\244LT3\037\273k=IM\270\345m;\260\335\300>\207\327vw\035Y\366\303?3\325\363\256[\245\372\033\232\001\006%Au\0173vQ14\226\205T\241\301\366}\021\177\215<\204;b+^v\227\033\261\271\227l\316v\fI.\013T\355\203\270J\351.\222\013\330e\261\244\330\r\003"
+	.string	"f>i^\252\354$\206;\217\201l\333\356>fT\262\231\356nIt\310\234\221B\353E\013\031-.&\n\343\277\354\275DH\201\331\313\"\207}\004RvW\001\211\021\004\377\302\245O2/g\374\353\b6\230\200QA\305e\322\030;<il\331\001\237\317\033y\242\017\264u\036x\036\315\034\016\221g\264\361p>$\321\246\373\274\356\343mD:NH\324q\034\360\007\352\204\272\321\367\205:.4]\333\310\362W\037`\260\370\203\363+\337j\254:\300P\250\017N\215(\2665\372\303\024OZlE\377\004\b$\034"
+	.ascii	"u\331\253Xh \021J\315\326Y\301\342\321\326\025&\325E\200/\216"
+	.ascii	"p\301\026\260*#n\306\202pZ\301`^J\213}\270\306\r\r\361\202F\332"
+	.ascii	"\"\364\314\004\016\n\301e`d\001*\030\252\312!u}kK\031"
+	.text
+	.section	.gnu.lto_afatfs_findNext.87.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\341\003\025\033"
+	.string	"\0262\260H\260XQ:\300)\t\257\007\262oKI\337!\221t\262*\033\305\314\307\266\336\033d\035aN\3208\353\376h?\276\336\007\325\023\003\272j\266\220#+8\023\003\207\343O\313\034\200A\300\367\315wOF\264\377I\333\204\310\235R\236"
+	.string	"\220"
+	.string	"\236"
+	.string	"J:$\314i\377\350H=\027\2568M\255CUN\265\n\033\370\001\371\321B\322\266\037\344Bz\234\263\360\243\203\221@\250\211\257\210\227Z\205\261\233\333\320\217\342\005\320\217\233\343\271\273Z,rEGqg\316\367\271\253\345ba\304\211uSk\275\021\020\215I\262@\222\022Ru#\250\306Wb\315\222\036\275[\001\232!60B\362\3057\351u6>\266\2002.\316"
+	.string	"\177\\@\336\\qApJ\214\031`O\264\251\202\003\313\233>["
+	.string	"ws\256&\324Z=\177\300\240\373u\333@lw\260\227)\274\371\305\266\354Hfd\255\025\202\177\004\004\tR\307G\037G?~\337t\004\\\240\260\004\207\034\351fi\013}\346\022\331\337\262,K\357\220\375\245\277\300\231n\330\205\177\315\223~\032O\313\254\246_\256iWk\272\305\232f\261\246I:M\311\351\221\234\026\351\364\256\246'\235\376\201i\024|\341\"\306\2074\325\372\242\fS\243F'Eg\372\355\036\277\311.\333L)\002T+\365@UBQ\266\324*d\360\321\033HqI\305T\205M\302\021\bPy\001\364\343|\372\rY\013\333\326\276\307\343\346\226B\311e-}\352\031\355\310=p\005\251\211o\f]("
+	.ascii	"~\303q\351\376\257Qq\307}/\270\233\245w\305\335'\337\030\335"
+	.ascii	",\237\354FHBUu4\211\b\371x\253\024\024\266\313\243\022d\300\364"
+	.ascii	"\360a\376\007\333\017\213\242D\361vI\2127\244Kt\213\251@~\306"
+	.ascii	"\334g\324\311F\352@I\262x\341\242\233\245\207C\034ND\024t\256"
+	.ascii	"Mi\212f\212\365~Bk\326\026\2013\377\233\373\251\242\037Q?\353"
+	.ascii	"\363\035\277`\324.\221\001|F\277#\224\256\004\266\332M"
+	.string	"6\343\2418\333m\207\202\215\226C\332f9;4\035\212\263\325n\262\231\215\226\303\262\314\001\217\316\rGG\266\203\343\301\211\325h\261\035\032\216\211\230\314\306\023s\240\300\265\0233[\354V\253\331b.a\275Xw\310\003\202J\250\326\237\243o\372e\004\211q1\3729*\263-l\313\254'\350v'\326\325\225E\300\264\226\250\004\235\t\241d\311\007\021\251#*\326\0221\371\313\300\274\200a\376\367*\277s\022\243\205t\255\255\341P\033\304.\260\311\241\303\374\317\265cR\021U\024o}\334Z_J\206\022/)_EI\250A(\251\220R\212\251\211D\242\204\242b\003\240\242\231:z\021PI\253\250\266\236\001\265P^+\246\223\331I\330\355\200ur\267\366*\304\235z\270jX\342\254D\230\2547j\372\204\250BHS\021R+}\363\366%\235\232\210\322\222f\326c\370\251_\252\243\234\004\177\361y\375\215\016q\313"
+	.ascii	"\301\223\341,\023\317\237\250\257\327\255\021\316\270\007|\256"
+	.ascii	"8\f\303c\337w\355\252\033$\207\3074\245>\241\311~\326\020L\022"
+	.ascii	">dkK)\246s\332\300\263\263\222\007j\277\255\201\255U\312&N\025"
+	.ascii	"yj"
+	.text
+	.section	.gnu.lto_afatfs_findLast.88.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`6\003%\026"
+	.string	"\226\246\212J\260\022R:\252\342\301\tu\022A\303\215\261\034\224\030\205\237\316v\323{z\341\216\332\220\353\bd\303^\300\365\252\267\276\322g\035\375\333v#\374:o_\264s\245?e\302v<N}C~`\316\035Vw6>id\023\271S\nn"
+	.string	"o"
+	.string	"x"
+	.string	"\247\002F\032\033vz\230\355O\373@\017\322]\250\346"
+	.string	"j\345q\301T\253\360\200\021\224\247\026\336\204<-_B\236Zg[]\330SOvF\340\f\265j\255\262Eq\335I:\356\324\371\037\372\313\367\333p\362\303\351Mo\216:\337\321\204\352\204\216\221\237\315X"
+	.string	"(\245s\342'\207\037oN\327\203Z\253\247\357\227s\273n\333\3056\004{5\004\003\234l\224"
+	.ascii	"\006\t\355\346\226-\344\315\r\332\037\353\362\330t\0326N\213"
+	.ascii	"\374\350~\215\323%\235v\215\323\344N\323qz\334\351\275\320?\003"
+	.ascii	"\274\220\200\364vH\354\ra\355\260\025\244NQ\247\024?\372\355"
+	.ascii	"\373F?\362\221\f\033\352Nt\242i.\264\204*- P\255\365D\376\320"
+	.ascii	"0\025/\242\371\nC\215\365\250\356r\026\004\223\212@)\247vP\006"
+	.ascii	"1\\\273W8\204\350\222{\244\277\254zIW\224R8\214[I\327@\324\316"
+	.ascii	"\270A\245G\335F\212\017\341\003\365\343\317\310\023\255\362\247"
+	.ascii	"Y\203\036\fw\242\241\024k\255\nNO\364\312\233ZH\212Kg\252\271"
+	.ascii	"\274\314\373^\310\323\033\365d\355\216[\322KZ\302\0312\233xP"
+	.ascii	"\231\330\r\376F\356V(\312a3\177\370D\333\336\342V\326Z\023\370"
+	.ascii	",2\344|\237\032\362t\367\304\0073\2259\203\263\305\320Vp5\013"
+	.ascii	"/\323b9\226\230\031\013\rf&7\223\331j2\230\332\354EF\303\345"
+	.ascii	"d1\002\266]X\301\311bl6\234\f&\334}\254\3133\364\362\311\003"
+	.ascii	"\226\017\254\335\362\310*\020>/~\262`[C\206\001\025\re\252\205"
+	.ascii	"\204\306\311\320\267Cda+B)\345\257\025\331\b\303\233\036\261"
+	.ascii	"\227\373\332\230\322\r\2207\267\354\332rcBp\206\354\346\326\204"
+	.ascii	"\317\220\331\253\"\356R\264\205\222\321\262\303? `\002\021\252"
+	.ascii	"S\017\265\354\t\016m8\001\317t8\233O\006\242\213I\311\037\243"
+	.ascii	"5\001\315\r\212\035A\334i\210\202\t\231\300\244f\026^CT\300\206"
+	.ascii	"\277\335T\21025\247\214+EJA6\245\357\003n\303;\356\224\206\266"
+	.ascii	"\313\372\033\031:2\034\222@@K\215\202<`\204&\n\366\024\300\016"
+	.ascii	"d\363\350\351\340[\003jD8\266\2307\304B\263\206%\302\342,\016"
+	.ascii	"\361\272\210W\355A\222uF70\210\205t\223l\302\327\231\346.\005"
+	.ascii	"\354He\223\327\256,h\306\224\242C\001"
+	.text
+	.section	.gnu.lto_afatfs_findFirst.89.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\355\t"
+	.string	"\366\022F= \005)\035 \201\205\263\3206E\0049\304?\307D\304\302\303\026o@J\317\f\027\243ZC~\031\374\307j\314D1\233h"
+	.string	"A\002RM\016\236\347\255"
+	.string	"\230\201-v\267c\023\262wJ\0011"
+	.string	"4"
+	.string	"5"
+	.string	"\036\177@\317qn@\3179\264i>\212l\302\307\310\306\f\300\356\326\031\362\3602\364\237\362\216\350b]\006D\354\256\245\350\352\270\347m+\330\226\260\277\005\366\307\177\273\354\227\364C\002\3638\313\315.G-\300\3228\230\022\333\367\330\226\343\n\201`3TD\210K\373'G\t/\273x\301\356\313\345ewl\260\003\347\\\324.}\345\343\354\356\203?\253\230\030\230\201\255\350\271SK\214\211MK\326L\245OA\031.\247m\241\222\027\275\020\223\241iL\226=\262\344\004\261\277\355\356z\276\002\340Hd\362HT\005~\251n\004z\242\216;\020\212\224\n\221:\223\n\025\252\237WM^\250T;\020UA\037\177\247\021XS\337\007V\317\270\337v\276\004b5\264\326\304p\370/\r"
+	.ascii	"u\261'34S\201\205\363\257\331\325\302\330\002\256\261\2550\036"
+	.ascii	"(\021\214\bPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_afatfs_extendSubdirectoryContinue.90.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`h\020\265Q"
+	.string	"\n\210P\036P0\222\322\031\016\265*\013\251\360)\030\364\326k$b\021u\332AQ2\276K%\216i\361A\023\262A0+\032`q\220W\376\037\307\006\216nN\024\270\230cfc\355NEv\356"
+	.string	""
+	.ascii	"D\200\270`F\035\270\235\237\371\323A\215Q\242\367\336R&\031\317"
+	.ascii	"\001\252\001\326\001U~8\227]\022\316\360\274\326u%Ai\327\204"
+	.ascii	"]5\016\224k^[\236\266\233.\323\321\326\001%\020y\353\272\246"
+	.ascii	"L\273\351Os7\310~\354d\317r-Wnz\246&\227\314~\b\327\267\365F"
+	.ascii	"\275c\230\335\272\246\351xY\323W\252\365D\360\216e7v\370\225"
+	.ascii	" \307\002\344kq\375\252w\314b\267\256b\006\374\334\027\276\237"
+	.ascii	"B\376\327\203\334\312\3221\317Q\213\335\272\256\004\374\334\b"
+	.ascii	"|\314\273O>,\310\305R\370\021\256B\306\264\322\326Ul\305*\340"
+	.ascii	"\373\271b\276Sy\225 \253\306\030\362T\004\305\221J\324\225\274"
+	.ascii	"u\025;*:\017\372\323<\t\364g\327\260\3015[}\021\321\220P\320"
+	.ascii	"\t \023?>=<%H\354\350\bs\202\300_\212s\343\263AO\263Y\335\017"
+	.ascii	"_D\024\366\2410e\222\205\270\354AU~\302$q<\213\373\233\261\212"
+	.ascii	"\251\202\313H\205\201`l\261\325\231\370\372\317W\232\027\373"
+	.ascii	"\334\2009\322\231QB\205\365"
+	.string	"\036'\347q\242v\024oF\033\270\304\233\361\206&L\202\311w\314\002\354x0\202\247\005'\305s\031\227\260\316\233\221\211Y\304e\334b\241\231\243\236\231,\252\262\347\230\017\200ym\375\315\250e\266\0252.W\036\341 \326\201(~YTWO\315\002\260\332\212\374\315(\203\311\003\206\0062\347r\024\\F#\214s\345\tP\022Q\234\252\372\315\237\312\3563\337%\303\017\1773Z\231\020h\201[r.\343\221m08+\003%g6Uu\324D\300l\n-8\025e\002\243\320q]y\226\232\"\362\t\226C\f8SC\320_\034\224\030\236e\264:\315\026E\3368SE\3166H\353\272.\027\247\250\276(\276\313\030\354\356\t\273A\252]2\366Mh\240?_\364\271<\005\017\313.,\2600_$\234)U\310\334)\177\032\317\350\274\nX\362\303\326M#\335\276H?\003m\3122\037\337\305\325\031\220\244\214\314\206"
+	.string	"%R\332\262\254\235\265\217\273\231 \255\033\317\310\344\335=\3612MR\301\241WQ\027}\n\211\203\033\233\023\302i\366\207\215z\367\202\032\374\242\213\3463P\256\334\204\364p\377v\206\022\203\333\220\327,\360\306\266\344l$\231}\231\356\202\303\212dn?\206\257\001\212dh$\f\207\025I\334^n\351f\334Y\035n?\304\322\371\326ux\254\275\006\350O\024Hk\230\243r\017fw\351~\254\245\343\342\272\246H\210\274\267\273\031\\\b\r|\353\272.\260\017B\355\332\300\327\344\347\001\357"
+	.string	"\375\371\276\362f\227\263\270\257\344\023/\367\347\2512eff#w\323\246\020\227\335\310]1(\276\016Rt0\333N\262\233\201\215c\371\326"
+	.string	"\362Z\220\362\322Hyg\244\2742R\336\n\200\274I)o\214\224\027\206\016\357\013\027H-~\366=Zq\261\337\350\307\233by\211^\366\035\372\361\n\ty\203R\336\023B^\240 \357O\016\257O\312\333\223\362\362"
+	.string	"yK\004ywR^\235\224W\230\362\346"
+	.ascii	"y\203@^`\312\373Ky\323\037/\016\220\367\006\310\353KymR^\364"
+	.ascii	"\307{\246\274f\312\333'/\343\360\376\006\r\2741\270+\307*-'\266"
+	.ascii	"\266\260T\263\272\235j7\034\313_\366\233\375g7w\277{\264\373"
+	.ascii	"p6\023\376e[\007\264\274\265{Qz\227=\237,\335\260\0028-T\203"
+	.ascii	"\022d\021N\367ly!+\276\240\256\200\356\252R\234\245\256\320\245"
+	.ascii	"$\363\272\273i\201\221\240}\323@s]\352\242\366|S\214\005\304"
+	.ascii	"H\253x\306\246}\215\206\021\242m\323&\252\330\b\332\337Sb\371"
+	.ascii	"J\262\270\352\002\272\273*\330JuaE\0030\250G#-\"1I\345\225\274"
+	.ascii	";\234/\033Z\224\342m7\331\220\020{\270-~v\212^&vA1U\b\273*\f"
+	.ascii	"<\245\036U\2101\242\240\032\021@\275B\177\236\375\266\337\330"
+	.ascii	"\352\302\245\370\302n\031\343\305\313\216\331\2773cs\0240\013"
+	.ascii	"Mf\277"
+	.string	"m\3537\203\007&\211\016\361\335\347\332U\217\260\nM\t\210Yu\006\226Ri\370\271\\T\273T$Q\n}\265\263\245\236\n6\327\253[\250\001g&\252\r\374\342\026\021\315\316\215\301\331\336\227U\303\021a\245L\330\310\025\252\272\242\013\036u\213\226\332\240\"`^9\215\\%UQ\222=%zM`\215\266\321RF=DA\353Aj\242\252\253$pE\017\265\324\326\375\250\317\035\344\340\306\306\f\300\373&\224\217v-\352\223\342\020\0245\n\277xtUu\345\246g\027\325C3\330\310\265Y\022\1777I\302\350\242\266\244I]\243\245v\001P\277T*\374\342\212\037\251\272\302A\317NH\017\2014\332\002S\355\210\032(9\262\275\247#>\243i\364\275\234\203\261+42\272\202\236\321f\231(+(\266U\301x\330\264\344U\r[\t&\340\027'@\177\312\350\263\335h\0064/,\260\344\323\232\n\372\306\0215_"
+	.ascii	"T\021"
+	.string	"!\362\213\321I\315\312\250\275\233\357\032\n\243c\264\211G\334\203\342%\005O\323\004\243=8\202\346+\271\263Em\2064\t}\321\037\234\313\3028\232$#\324L?|\340\360\301\204.\351\330\261\343\207\213_\215\021p\344\340\301\004D\204\036\301%\035>\230~\2140A\tIL9:\226\224h(\201\200\002YR\362\221C\307\022\017\020n6\007\013\246\035>p\354\310Q\002\020&\034GJ<\216J\340\201\203\204\243\034KLG,\002X\245\036:\226\216|()-\035\245\373\364N\262\301*0'\276\275\212\336H\020QdD?\363\236\252/\272\240\327\235.\247E\023\021\365\"=5\324\3760\3275+\002\345u\354\254\360r\327\212\210\216\367\r\372\032B{P\017A\335CYF/\251\345<\244\221\311#\3427\233\362\304m\310k\204\032\031\224\004\324\313fS`\b\200I\030\232\023NfP\240~\226S\035+\235\314"
+	.string	"u\017e\230\257\344\323\235\360\320]\247\"\330\314\t\017"
+	.ascii	"'4\234\305I\317G\313K9\204\327\235\230\337L\312\322\rHHI\335"
+	.ascii	"\034\223\365\230y\312 \274\356\236L\244=\355H"
+	.string	"P=\004\326\300B\232\037\034<#ZQ[H\b\373DKq\362?\3754\237\376\351\242\236\366\351\006\"j\317\344\351\236>Q\315\372&\364D\3634Q\0266!\210\\@hWE\3704\262\t\035j\244\336\231\373\"G\304\202\002\202\332\350\022\247\225rmL\016\013\026\024/{\\\360^\315i\215\323\262{\370!\320\324\226\360\344@w\372jg+\025\302\206E\300\215\211\200\315\325\bJ\035\302/\356\264\371E\312\232\333\220\036f\271J\262V\242\221\253\3239m9\313\345r\371&T\330:\375s\205\210\025\3059|\t\233\305\\\322F\347\324\330\372B\026\265G\242\2214|\n\022-/\030\005\231v\260\201\346\274\310\001\241 \177\r\224\341i\377\032\210\b?iJ\373i\224J\275\344\n\276\301\tR\351u\307\3077a\202<\273\341\"\027\n\201E\250q4\344\020S\n\315\210\210$I\222\326!\005\004\031&\245\274\016\021"
+	.ascii	"5\210\034\232\031\221$I\262s\002%\334\023Jn\3726\357\304"
+	.string	"\007\205-U\"\200F)!;\214\254\302CV?i*\\k\353IH\034V\2077\346\207\024g\236\231#>\230\320\201x\202\370\216+\264\346R\037\344t\300\321\374PQNUT\274\331\352\270\b\265\363\346\006\234\037\225\200'\274\256\361\f\220\253g\367\260\n\013\210\3701\27574\024\334\374\354\016{AL\302\232#/\311\004\023\032\367\330\257\351\200:\020\3055\372}#\037k\367ash\220z\341\263*F\253\301y\236\262\343\302\346\025_Y\264#P\232v\026\205s\325;\315\344\265N\313\220Rw\242\002\t\235\227\274\302\275xk\0017,)\0018\221\314<\322\233\344\327?=&\257{*\224s\227e\252\346\336+\315q\223\254\266\250\3351\360\230_k\224\343Kt\245\200AV\033\031\230\3567gz&K\314\353\217\030L\353\r\341\372\305\214\311u"
+	.ascii	"7\216\361\362W2ej2\264\334\344\177\037\301\325XM2\013^\013\""
+	.ascii	"\2372\203\350\020&\334R\216_\3220\2504uh\342\300,\027\342\251"
+	.ascii	"\035[\033x\204u>\020\302\342\037\0203\036\213\211?\336\226;o"
+	.ascii	"\024\027\242\307!\274\264\306:j\203j\335n\032\374\346\361\240"
+	.ascii	"\017A,_@\223p\027\243\331\215\240mQ\204\350\"\207K`\364\371\350"
+	.ascii	"d?a?\256[\200eA\370J\265yg\212\315\342\305\344\241V,\210P\003"
+	.ascii	"\257j\206!\365T\007\226\002\272\227\271\261Fx\r\235\bb\034\314"
+	.ascii	"\224\tS\304\033\304 \254\243\234\277\355\3369\360\240\3042qB"
+	.ascii	"\034\301\250';\270\306Dc\226\242\340\345\004\240-\205!\324\265"
+	.ascii	"Q\237\211\232\251\375\307 \273\224\340\375k\2164\211\231\263"
+	.ascii	"\003g\365\362\260L\tk\267#\026\234\274%](\224n2\352g\323\262"
+	.ascii	"\331-\314\025\002\310\262\034\bNx\252\243F\350\017\376\255\367"
+	.ascii	"\023,J\345h\242\211\325\330\315\334\006\275\256\202}\204h\320"
+	.ascii	"\340\t\017\236\264I\247\262(\3524\005\330\220*\253\333\002\224"
+	.ascii	"\007\034g\330\021\251Q_cr\204\201\275\305_\213q\246\037@\304"
+	.ascii	"!\277\216'\361\347O,I\317\371\321\356MW@\220\240\356\217\263"
+	.ascii	"#\256@\337\245u\204\224\310l\247Zw\005\022\255\277\223\006\032"
+	.ascii	"2\313.\201\344SWaA\r\366\b\212KI\324\fQ\244\260\356C\"ot{\307"
+	.ascii	"\035F\222;\033T"
+	.text
+	.section	.gnu.lto_afatfs_extendSubdirectory.91.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\366\003\365\033"
+	.string	"\226\262\263E\220^Qc\f\246A\031\244\210}\031r`\375\231n\002\306Z\372H\200\340\301\247\361\370\310\030\301\256\275\261\332\271\353-`a\3316\300v\016\034\020\tl'\215\224%\304g%vR%\221>\325\266\311\336[\312\224\002\237"
+	.string	"\226"
+	.string	"\252"
+	.string	"v\222\r\263Mr\261\021$B\302nA\032f\250\325\376\357QI\007\342@ \340\356\244\236\250\356\005J\260\205\363\245\201\247m\037\313\263$\031\005\221C\347\324"
+	.string	"\311\016\246\240\361^\240\214\301\r\230/\311\0230_Z'G\3572K\322V\324W\272\313\305#\213\016\2577\344\346OO\310K\222"
+	.string	"\221)\254XO\007\031\001kJ\021X/G%\311\n>\316\370b\275\035\t@\253I\032X\217\251Z\022\303\2757\326[\"\317{\357\203\257=zL\265\2724\334{]y\275 \367y\3337l\243\260\311\004\001c\206\026\024\207nq1\263\002PU7\232\221\354\207\027\2222\025'\211\026\013\274W\311Z\237\353c\230\267.\244\340\354j\036\333DOc\\\360\301\334\212\240\3400_\336>x\222L\032<\376t\265\217\r\\\252\326g\237\274\367^[&\366Y\035\344\352\001\347\362\307^\325@\337\362\303~\252\317\003\177\327\253\232t\265=\253\253\253\372\007\204\236L9\275\030\346^ }\364\\5\245\230(\376\227\017s\357b\263H\032\314\371^.\254\361.\376I\211\306{/\254\206\r{Y\003W\370X\371U{\2417<\253v\343\312\236\343\221{0/4\207\277\361"
+	.string	""
+	.string	"\n\353\366\301!\314\227\027\376\301\022\253b\222,[\026q7\265Z\374U\261\332\237\224x\374\305\254=\342ll\260H\311\034\217\220\326&q55\bp\236t\265\017iZ\237K\374\252V%\203\366) \373\372\361\374\214\030K\353\243:\314Z\330\302\263D*\353'L\333\304\323\234@sC\021\243p\025\346\313\024i\030\343\326\353C\246\275\342VC\n\212n\3612\2633"
+	.string	"\324\275\367Oij\334\252Wf\354\354\310!\363t\300s\242d\215V\233\254\017\275\342\0013h3\0274h\314hg\207##\"\334\354\026"
+	.ascii	"\tg;\242\021\341\212^\274L\233\220\203q4\203A3B\312\315d\266"
+	.ascii	"\"\231Q\321\254&\243\341r\262\t\020l\273\021\341dG6\033N\006"
+	.ascii	"\003\352N^\313\304\005\232\252\322z\255\307\232\210W\246SSUj"
+	.ascii	"\353Q\323\332Zk\320\331%\227\365\271\222~\315\274\325\030\342"
+	.ascii	"\217\022\310\222\266\207-T]\326F\247\240T\352y\003\354\203\377"
+	.ascii	"\217&\"\325\261\316\316*9\310Vy\035K\344\335\271\320\250\225"
+	.ascii	"\317\211s9(\026\243Z\320\250z\336K\037\2152_\006\331;\005K\250"
+	.ascii	"A \244\030D\b\"\022\n\022&H\222b\003`\002\021A\267\036\021\260"
+	.ascii	"5DuZ\2431'\300\276\226p\356\324\211|\232t&\210`\264\362\307\005"
+	.ascii	"hv\263\300\006\004)\203\361<\344\361(\247\235\322\021WpgrAE\225"
+	.ascii	"\020jw\b\321{\300!\230\004j\347\323b\202\022d\300c^]\300B.\030"
+	.ascii	"\254\217\273\240\314{\026\323\356l\252g\206\352\2644\333_\f\030"
+	.ascii	"]\316\220\340\300Q\303'\241\030R\247\306`v\\\"W\r,\032Pd\213"
+	.ascii	"V\032`\352\004dh\023\347\017\351\223\202A\327\260k\005\215{\030"
+	.ascii	"D\240\360\250\021sv,P\r"
+	.text
+	.section	.gnu.lto_afatfs_allocateDirectoryEntry.92.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\351\t]7"
+	.ascii	"\212`h\025@@\242N\007g\177^\313\213\316\304:\317\322\314Rj\326"
+	.ascii	"\373=\225\231\366\361\330/\330\230\304\252\210\376\f\237y\216"
+	.ascii	"\230\355\3553&\373\373\007\013BDa2I\272\2436QQC\0033\204\354"
+	.ascii	"\275\223L)E\0016\001@\001a\232\035\333\263F\365\222s\346\321"
+	.ascii	"\235\244j\037C\345x\335\307\2645\227\301\332&ha\274\360\3119"
+	.ascii	"\257\350\321\235tv\355\276j\277\353d\273\035\366\034\226]\310"
+	.ascii	"\342\331\232\304\234\347\0328\333&\220+\030\037ue\037\376\213"
+	.ascii	"\225\240\206{\273=\316\345\256|\016\bR3o\321Q\367r\236{\320\023"
+	.ascii	"\220\316\366\034\322\273\270\227\253\306\037\270\262\306\232"
+	.ascii	"\316\312t\325\361\311y\356\211\311\215ZgW\177\266\316\276Z\023"
+	.ascii	"]\354O\"g\223\271\034R&\205\202\220\307\226]\277\350\342v,\177"
+	.ascii	"j]\242h\330\023w\n\261!\262ys\225\300\305G\211\023J\333V\245"
+	.ascii	"\237.8\376&]\273\314;/!\304\216a\233/\251>D=\273J%\236T\002h"
+	.ascii	"v\205\232\322\302\246\036D(\235"
+	.string	"\372\225]\344q\003\237\207\320BK\364\322'-\214\314\217oR\262\225)\347\354g\374\026\001\353\272\355\232\201\215]3P\377\306\226`\\\253\01769L\202E\357\272>\313\310\024:\241\024muPXe\352w~\277\300\266\356{\326\023/Z\031P\377\306\234P\352\266\032\r69\364;oz\223\266\335{\334\220s\356\353\005\026\346m\344\335\356\325\335/\272\221\213\001n\355V\255\263\376G6;w_\323\277\2638\230\366_mw'\223v\261+j\021\355\320\223\251a\031\314\363\206\316\326\365\323N\330 \274P\004\001C\302&\341qL\024\255\345\234)\300\261\201\242\335\rH\353\354\320;\241+\240B\346\220\n\027\227u\033\273\347\264\356W\273\335\013\345\002\245\375N\272\217n+0\272\235\300\3506\202\346\355\003E\267\r\370\236w\201\347\355\246\347m&\242\333K\316\333J\315\333\004<\320;\251y{\200\363\266\200\346\355"
+	.string	"\314\333H\315\333"
+	.ascii	"\230\267\217\236n\347\355\364/\356L\007\343\276\\\336\036\362"
+	.ascii	"9we\337>*o\267C\267Y\345\355u\350\366+o{\204\033\247\304H\221"
+	.ascii	"1\257s\227\263\221F@\331\rkF\212\357\271\007\272\333\371w{\373"
+	.ascii	"\240\023Fy\230\3761=\207Q\335\3116\036\330.\330I6Wj\034\260["
+	.ascii	"\207\377\265\n8|pLq5\355lt\370\232\356[s\230\234\025f\241\212"
+	.ascii	"g\330\002\251\243\317\375\246\246\272\305\370\231\356d\367p3"
+	.ascii	"\035 \220\0322\276\327\3167\346*\b\234*}\022s\316T^\246\203\370"
+	.ascii	"\320L\361<\327k\036\036\\xe\222_m\354\330\254=\002l\\v\265\260"
+	.ascii	"\331\321;\240\0330\023g\t\025.N\b\302U\360\355~\030\r3q?\337"
+	.ascii	"\240\204\233\202\t\372j\267r\205G'w>\367\261\250\234^[\340\017"
+	.ascii	"\374W;\256\266K?\203\316\257q\023o\304Ud;#\236\202\325\332\335"
+	.ascii	"R\264\316.\275\373\371\3527%\323'.\001 \314\266\\\323k\334\346"
+	.ascii	"\1770\024\2435?\n\336\243V\220\274\333\264\b>\301\257\200\321"
+	.ascii	"\267\003\217\340]\317\331\351\324NK\316\035#r\301m?\203\251\340"
+	.ascii	"*\327\275\372\037+\210Kfs\fr"
+	.string	"\026\255\201'\033\"\207\225\347\r`\323\033x\":4\301\246/\360\236\327\305\270f\357\277\226\351\233\236\315\213r\361=W\304W\222\fs\316r/\337k\234\305\363\340-\007\f\3578\036\334\005\303a\271\353^X\256u\266}\246w>_\361\224\001\242\223c\207E\3536\266/\304f'\r\221\"\326\225\366\253\207\316\376sY\277\233\003\373L[\217\265\3761\357k\232u\033\335\214\0377\213\354W\333\241\332\177OS\272\035<\\\367\372\277x]\316\270\331z\254\373W\267\267\270~\365F\353\017\245k\237\023\343\00622`\334\037P5\244\242\330\252\034=\250\240\240-\024\252\206T\224\215\326\nZ%\325\001\032U\003i\005\235\252\242\001\005\215\252\021\3244\234\250lT\311\260AC\312\212J\306\323T\324\223T\224\f\035O4\240TON\tzj\007\024\364\251jj\n\372\224\234\313\362w\322OA$\314'#\221\363\223\304"
+	.ascii	"\003\227\367\314\307\304\332\350\265\307\343\367\206\254\327"
+	.ascii	"z\236\271\363\225ot\031.\363\227\317"
+	.string	"\205\273\256{9\037\200X\233D\3675\347\234\211\276z\345 \202\201s~\225\232?\315\225\316\024\0015q\373\374\005jq\203y\336\314\271p\333\361W\353o\\\371\335\230\b6r\335\353\371~\347\236DLP\332'1\352G\246H\2430\227S2\2674Z\024\225\236\314\005\206$Xm\t\t\206\302<\022\240\316\013\017\201W\272fy\r<\351\t<\211\272\250\036'\037\360I\357\224\027\245\n\370\001\357\024\250\213\021\354\212\271xD\303\0217\f\253}\037\030\206\362uR\001\377\210s\342\262>\300\273\240\007\331\341\302C\034B\022\273E\260\031\022\351\035\370\225)\357\226\017\301fKC\237\272\365iQt\234\244=r\205\340$\031\326N\334 Xm\251\202\263m\267\013Ca\032\336\250\333\255)\036=\200\177\006\200\277\250q(\304\024cJ\311\210\210\214$I\322\001p\002\221)\273n\021\220\2614d\243I\241\305u\321\223\303"
+	.string	"<\3366\226\346d(\237\022\264\271\034\231\356\r\245]f;Ej\210\024\267\237"
+	.string	"Q\216\013\256\004I\211@\222\263&s\277\275\335/n&\346t\272Md\f\305\375,\360\307\256\f\274\347\215\332\304\265\351x:E\322\305\006\323_\312z\345\267\256\335,\322\373"
+	.ascii	"\355J\371\317\226\355\024\227\251\260\2768L\n\277\204Y\305\202"
+	.ascii	"\203\333\037\316\2174\234\"\336\217\027k\303\304\200&\374\237"
+	.ascii	"\013\315\256Y\240\365\342\266\263\320\262\003\324\263]\025\244"
+	.ascii	"\271O\232|\"\336\226)\t\2178\350J(Cy\220\212'tcP&\026\267\304"
+	.ascii	"\225\257\344\006V\\\361^\235\217|\223\021\221\243/\375\237\364"
+	.ascii	"\342\232\363I0\367\266\252\033\373\004a\255\277\260\245\355^"
+	.ascii	".s\346\255F\224\204\214`\233F\312\277\202ot(\"\257\034\005l["
+	.ascii	"\360\234a\322\034\256.\264d\304\023\212;\2312\203\217Y\030I{"
+	.ascii	"\250:x%\300\234S\226\024\024?\317\032\341\315d\341q\321\221\327"
+	.ascii	"\370k\226\336\003\237\376\035\f\237\f\366\037\225\230\276-{\264"
+	.ascii	">#\033\253[\313R\022\305\\\032\237\354\006\226 n\231\365\nH\360"
+	.ascii	" c\347\214\246F\342Z\205\013\215\355\341\\X\205\205o\034:4W\021"
+	.ascii	"\303\375a\t8\235th\310\323o\344\031IP\326\002\374\205R\f\333"
+	.ascii	"\314\\%\333\252\300\337\n\336\325"
+	.text
+	.section	.gnu.lto_afatfs_ftruncateContinue.94.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\027\020\315N"
+	.string	":\201\370\034Q0R\312I\007\253}z\252f\276Vgfb\275*/g:\224\276\360\340\2725\276\312^3\364\356\360\"\251N{\204\216\203\330Q\235\341H\3155x?"
+	.string	"q\3070\b\202\330\231\037\321Z\"Q\023\326\233\021j\366\375?\367\335\355\276C\211%\204H\231d\271\001\222\001\302\001\310\025\320\277\355\255\254/\216G\235\331\0222\265\306MQy\225]\337R\375m\317\"\362\355\216j\327w\223wu\354\325.\345S\356\266\276\266\224\307\031\261)dH`\013&\331\324J\026\026\307\301\327\202\257^\365\302\"bodjM[qs+\370\331u\334\207\025\303?182\265\326\001n\356\323n\311\273-\232t<\n\nOC\022\202|\202t\301\274{\343\241\350xZ\nB<5\353\030$\256\3264\026\333\204\336\3344\364N\376D\307\246\021h]\371P\0223\356P\273\2535\215)\351\277\363f\371\237\363f#Y\340\232\235>"
+	.string	"\245$"
+	.string	"\220\216\214\212\210\206\204\200A?\240\037\237\036\236\035\235\034\034\337\215\r\332;O\230es\272\267z"
+	.string	"lW\372U\333\223\330\2460"
+	.string	"lP\030\251\355Gh7*\177\202\274y\371\334\020\255,\300\313\rB\356\366\204\213\234\234\250$ l\213\217\317\r\235\224\277\"\214\204yq\310\003\017\365hp\341\213\260\313\307\205\232\314\rg``\333\203\216x-\371\317\254\315\f\250\206\342P\t\377\2241{R\206\314\313\206\373\224\f"
+	.string	"\361\005\303\347\2064\224LC]\231[I\302=B7\2362\336\361\261p\324)\016\3038\247\3474\301\fyL\b\273z\034\307\327s\"\363\212\3417s\303!\305\241\020\266)o$\211\343\347\206\306\022\306\026\037hA\030U\"\363\002\362\236N\327\2162\251\326z\267+\025\207@\370\344%?q&F\304\355\246k\353\274\221K\"w\262\241\3614\017\370\361\022\350}\323\365\343\334s\252\265.\013\273\274\276\002|\227S\330]\254]\235\234\374\021\316\242\346\n\342Omf\3451q\254\373\341\242F\321\273\035|\300\027>u\222V[\225h\023\271\210+\214\\oQ8\037h\363\210\2741G0Y\334\304~\210\337\355=mPr\350b\305k\316&v\371:Y\361\232\375\023"
+	.string	"\313\222\344D\0237\354\n^\030\363\323s\3132E\0135\027\230}\022%\227/{\2726\343bR\307\216\330#\301\207:\307\254\304\232`R\307\212\330\317\255\230\r\260 \317\302Z\271\354\211X1h\255V\017\333C\2357\225\234*\022bZ\266\354\256\230?l\305\240euX\323\352"
+	.string	"\276\261\035\234\267\273 \\\013\024ZkM`\237%\305\201\006\252\344\246\001\217:o\276D\302\205\3013^qr\177V{\001\310\016\263\024\342\351\273\375`=\322\030\373O\317\024\315U\324b+S6q/v\004\257\256\233\270\233\206\305\357\301\002\334\217m\031vg<=\312\377\200\311\353\364+\337\030\227\373\302x\341\242\251\305\327\276K(/\213\263}W\240\274*R<\355G\261\274G\313k\204\303[D4$t\303\013\364\361\376nx\201\232\327\007\345\355\341AywP^\035\2247\007\345\305Ay}(\357\r\312k\363\266/\212\362\366P^\323\206\267Dy\033\345\345\036\357)(`\256\005\037O\223\254\025\206\244\232\332\305\374a\311\257\374r\177\334\277\366\263\375m?w\277\373\037\366@\034\313\372\344\202IY<5\313H\2268\253+A\236\253\261\332\003vf\026\277\274\237\027\215\366\024\307\306\200^\264\251\266\206\204"
+	.ascii	"\376\022\327\251!]\302\027\276\350$-%\301\2432\006tz\003\"\262"
+	.ascii	"\b!d\215\211\237&\356\321\027XX\217\213\236\321\\\353\263\005"
+	.ascii	"\346\312\307E\233jjc\216`T\360\177\270\025\034hN\257\370nzC\232"
+	.ascii	"\003_\350b3\340\262\340\021\214\234\276\225-\255"
+	.string	"D\021&x=I\236\2009\202\004\242\tO\023\267E\233Z>$O\346\177c\031\322\035\020(\253\365\352B#2\024 k\321lf\016\255\213V[-N\213\205\021\3615N\233rg<DH\020_oP%\210\361\246\301\276~\\hf\251m\372\246M*[aXN\270G\020\251\314K\306\217\256\313\246s \251\340\225\365\301SE/\331!\337\216_\326\212,\272\327*zy\253\210UeS4~\301\005\026\375*GQ\204\312]\030\232\361jE\367\032\350\306\003n\213\t\026'\327l\256 R\231P\306\217\216\207)'4\223B\341\035f\037\013R\n\236\261\001\326\n2\321\255\003\234%CE\031_1\026\004\273\022\314\340\013g\2347W\264\n\3105</\177\333\034\330\216\022\262\030\376\205\253\321\020.ygw\305I\235&nS\233Y\3114\307\272!\356.{o\301\271{\001\006|aS'm\265\325\356\325\340"
+	.string	"\226\tw3x\232\340M\"\350\312\276\360\353\212\223xA`\331\325t{"
+	.string	"\227wf\304\337\006\345L\316"
+	.string	"H\322l\231R\233\f\247\b&\320\370\232\270?\203Tv pvM\354\210\326\214jn\232\030<\271_<\202\331\325\340f\202\3349\340\3064\265\260\346\316\246\211\313\275\375\b'\260G\032\343\031P p\b \360TT\025U\360\206\003U9\242J\360Q\005\253\240\252\250\316\252)\250*\f\236D\270!\305s\202\324\024\004Q7l<EEM\325\300\211\232\222\252@J\204S\204\250\252\250\033Q\017\2200\005\205\303\027u\303F\215ri,Q\325\250\202\252A\243\004\024\250\240\230\244l0\225`\003\n\007\023\215)*\246\245\024+eB\324\024S\225\224\324\024\223/\355\352-\303\352|\211\345%\021\365\327\027\221\274\243 \243>:\352u\272j\254\026\002h\242\224\307\245C\214\340t\350\276\220yMN+c\264(%5q\371x`\263\031*\351\220\030oM\300\276\032\344\232\377\034\343x"
+	.string	"\320\303\313N\213\376I\256\3454\241O\275\245)\324D\315\025\346D\335ZR\306\034\353\204\370\027\330!\t(HM<J\200Q\364\376z\271\315\210,]\262\332\n\005\232<\037\214R\260\363\327'K\177\360\224\024\354\327& \317\024\255\251\351\200\264\363\321\241\253\215\350\351\220\023\250Ov\254\313\342&\202p\224t\210"
+	.string	")\021\356!\025C\323R\034\322\"At)\2347\201\372C\344\030<c\235\021hC\300\241\3469R\262C\fF\250\240;\244\022wv>\\\340X\020j\342\022\371\002\313\373=\210oyB\250\207\232K\211\373,q\0171E\302\027\372tR\226\223`\020\335\213\036-\310 \316\214e\255\265\002\233\270A`h\200\320\366\231\321F\315\225\003\311\345\354'\316\204dA\301\262V\262\030d\242pr\235Z\207 0\007+\277\ru@b4\214v\352\027k\266\354\260\222\311d\362\301s\247c\364\322\231\031\270\030<\0323\030},\207\240\210\fs\266\323K\202\250\321\343\276\323/\"\275\340\001\231Bw\004K\201H\250\201(\305\234b\210dDD\244I\222\306!\005\004\031(\245\273\016\021"
+	.ascii	"5\247\034\242\221\231$\311r\235[jM?\243\215\353l\315\243[#\231"
+	.ascii	"\242\247\356$\255\311\fl\rz\2215\317\006\234\037\rU_\217O|>-"
+	.ascii	"[:\351cN\320\027\267\007\t\027\020\031\020\227\342&\325+\312"
+	.ascii	"\250/F\237\235&\023c\322\007\224wr\362\337\034x\307V\211\350"
+	.ascii	"r7\207\217\022\031\361\315\310\334\315P\367\274\336N\t_"
+	.ascii	"h\336#c\350\341\f\236\002^\237\245C\020\362Tk\322\277\367\320"
+	.ascii	"\234D\002\t#\306M\200\350d\022$\332\207{\345\344\345\314\275"
+	.ascii	"\004\201]K\021\256*.g\371\254\325\311\\\237\346ZO \220\017NE"
+	.ascii	"\007<\3502n\216\344E\2104\324%R\330\365l\242\251\310~\254\005"
+	.ascii	"\021\234\314\324e\307\\\026\023\001\202\035\205\016J\0030\374"
+	.ascii	"F"
+	.string	"V\314\260#\356\242\201\345\0218L\320\267\277\240azh\311\263*\311\026\203\233\312\306//\264N\336*\251\022\027\033\332\353\022\352\255fGct\220\022\271\346\2106\013\037\216\321\001s\371\254\"\240'F\300\333Q\321\001\2670\201\277\241\"\312\260Y?\374\306\354\252\030N\301\316\002\304\017\357D\347\336&A\3635gR52\242}j\265\314S;U\241\352\373\317\323+zm\340\271\242\023\376A\305\257\333k.-\331\032\365\321L\265\371\234\303\244\036:\301[\230\215\rsD\374U\364K\242\033IS\327pFZ\026\242\234\276\376\212\226\351\262ZL\332/\333\365#\036@\204\024\261.n\371\204m\350p\343\326\201 \305\223,\r\322|\035y\r\276h<\300R\203\241x<\210\326\262j\273^Q\374\016\347\2567\315\274\306)\t\n\205R\274\274\321\265\33453J\336\037\313[Y\235lG\220\26544%\n$\234\240"
+	.string	"D\257 \006\2169\357\206\260\t\216Pd\002qpr= >\005\nN\226\317\324\222\340J\264({c3\"\275\302\032\221\211\337\0345\246\"\213\221\260n\340\221\227\260\220\205\211D\241%\304F\230\351\375\030\001\275\245\255 \231\211b\260\227{\013b1U\023m\230\213\305Sp\253f3\273\224\231\013\212P\331\230>iq\221\354\037f!A\263\300\367M\325\006\261\035(\201\372\350\206\252[Mb\020\226z\237\334\250G\350\203N@\\Mj\321\270\3331@\037\315),\025"
+	.ascii	"\002\3679\rrQ\317\321\314\351\312\3062\3434[\276\034G\005"
+	.text
+	.section	.gnu.lto_afatfs_ftruncate.95.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\022\001\225\r"
+	.string	"\206Y]E"
+	.string	"\261&\035\034\365$\377\337\342x\007|43sHuB\032O\242 ?T\307\262\236\246)|\273\326m\301\270\234\001\272jI+\310\366ARUUU;\274\177\236\002\344\017\344\322L\032\036\235J\b\331[\312\224\002H"
+	.string	"I"
+	.string	"J"
+	.string	"\367`\217\332\r`\217\266\355\361a\362\351_\313\312\363\262b\301\004\316\356\267)\210\237\0165O~"
+	.ascii	"\326\311\241\246r\205\fZ0T"
+	.string	"\006\260R\320S\343\341\3461\317\024\226*3\003\331]'\n+\303\035o\033\202\355\b\366S\0011\215\335u+\200\264\031\261\302\240\341+.vW986Fl\021\302\366}\231\277H^\302\036/hpv\267Cbwn\262;\266\365+A@`U2\027\036d\332'q\030\323]&/\260\313B\263b\367k\340\017\355\321_'\311\302F\r\007\265\b\303t\203\213M\207\0322h\250\362\206\377\262\310Q\210\022\314x\331\373L\205\003-\273\353\340D\211\344\273<\372&\330#\246\177}\201\210\0247-\030\027*s\354/\225\372\301>\334\335\265\262\330\377~\315\351,\"\035'!\024\342:-$\004\372@w\035\244O\211\373t#%$n\363@\333\b\210\023m\335\210\264u(\260G!d\264\225<o\264u>\324\241f\372\230k9^Z3*\322?a\252)j\020\224\246\240\200\3244\252=\001\224G\3114j\027"
+	.ascii	"u\331\023C@\030\026hq\377\026\340\301\254PT\013 \260\214\020"
+	.ascii	"\031\013\342h\005\203y)-\366\3015o2\204\013\032i\213\320,\023"
+	.ascii	"8(\f\206-@El\271\232\306\240\240"
+	.text
+	.section	.gnu.lto_afatfs_createFileContinue.97.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\360$\025\233"
+	.ascii	"\312\362\3145K \320\332\031\003\211\317\320\020\250\257a\252"
+	.ascii	"\225\375\030\217\321A\275\373\230\3345j's6\325\r7[\013G\021\204"
+	.ascii	"\2108R-t"
+	.string	"\330_\270\304M\251\336\322n\271`N\201\212&\017\225\n\rD\361\020\361Z\f\224\224\r%%\267L)\245M\003\n\003V\003\357\374:\316\256t\356^\262\301\237\023L\235\333\365\005\347^\036\215\213\357\227c\226%M\355\006\354\016\323=\330m\246\275\331\255\330\275\330\315\330-\245\333\256\223\314\355X\336|z\341\314\001\303\211\034\333\373^1\001\211\307}\3555\335\310IF(\366=sjre{\337\271\031iZ\215\333\213P\375F\337n\0166I\003\002\262\217J\357\235\366L\243q[1\312\bk\356m\346p-Q\224>]\301\351\235\026\361\251|f\270\017\r\313\244\340\267\367\366\276\357\230&#B\343\361\r\020\352\231\b\203\334\204VAj_\331\227\016\303\035\310I/2\272\312\r\306\252\313\2317\300\031\320\310\346p|\006)\017oG\331\230P1\354#k\200\224\301\355EF\313 e\2245\367z\331\320\351\230\213"
+	.ascii	"\311\245\377\246\272\3126f{l\335\245\375\230gP\251\2123\230\247"
+	.ascii	"\230\223Y\232\312\335\307I,n\3575\037sUka\n\302(\226\320xl\003"
+	.ascii	"\244/\216,\256\367\270\261p\262\252\2570\225}\361^\254\036\004"
+	.ascii	"\230\345Y\343\034@VUi=\033\215\307T\325\3047\033\314\311)\235"
+	.ascii	"\307\234\344\023\032"
+	.string	"\217\217\3240c\310\342N`N\3661\331Q\272\256\3578\311\314v7\224/\340\333^\203nj\f\337\367\312\00204\235\333Rp\364\333\343\355\255D\267E\303\367\235K\352#;!\373h\3046\\\367\034\027\372\322\215\321\360}_\244>2\001\314\355\314\035\327rnO\257Z\347}\217\220\271\362\276sK\334\002\331G\236\353e\333Gd\357\264}d\227\271\360\347\3716[\270)B\353\024\337\367mz$\3342\373n\253H\201\242\211iI)\351\004\222\211\022$F\210\b\001\342\310\250\350\003\013\242!\241 \240\037\237\236%\317\216\007\035eN\007\016\033\22287H\233v\305\221}w\271\223\250\334E\275\232\255\"\3170\016.\0052\020N\211\031\024M\354\212\247\342\220\ri\240a\272M\352\305\231l^4\201\323afI\206\030\\\311\332IUB?a\365s\244?\326\250\213\233 \354\0226/\212\364\340\322$\034\253\217"
+	.string	"\245V\332\244{>\2025\002\224ri\223\352\271\b\t\252}\316\020}G\305A\370\350\243)m4\2055j\304\363\"V"
+	.ascii	"\275w\257\001\245y\254M[#\223\276\203\342\037\224L\276\232\005"
+	.ascii	"\240\224\260E;3\214\273\266I\3078\221\003hj{Cq-\024\367\304\203"
+	.ascii	"^h\240\027\370\340\374\347\001\2644/>K\272g\311\232/\325\232"
+	.ascii	"G\315\232\346;h\355\001P\212\306\032\005*q\035\271$\256L\242"
+	.ascii	"i\211z\371\350\234\036~}t\035\330\023\206X\3164\240t\005v\311"
+	.ascii	"c-\332wd\316a\2547\214\r\361\344Q\221\036b\215\303.g02\246\001"
+	.ascii	"\245b\354\t\262\277\037m(\304o\316\220\254\001T\300(i@i\030\333"
+	.ascii	"-\f\351\353\273>j\223\006q\2337\034/h\273TBE\353\"R\271o\221"
+	.ascii	"_\275\242\357\232}\301\317\316)\230\347\345\243\217\203U\246"
+	.ascii	"bp\274\236-\016U\t\265\213H\t[6\305\217~\034\257\037\3556/\336"
+	.ascii	"\367e\217z\365hn\321\314\277\310\314O\346#\250[9Q\332\356\f\221"
+	.ascii	"\201\227\361;\317\274=(\243\213\245E\301\351j\031\370\017\350"
+	.ascii	"\b\r\331\345\362\251\333\205\214s9\227\307\325\022^\273^m\037"
+	.ascii	"\031\3706\354\020Y\002_\355\354\310\215\006-\373NHG\b\200\377"
+	.ascii	"3\273@\\0\357(\373\311+W\266\254o6\025\266+z\310\033\355\177"
+	.ascii	"\037\322\rfy\032n\273\376\357/?+\3270o\353\036-lz[}i6.\260;\341"
+	.ascii	"\302c\337\033\331\020\034n\354-p!\022G\022.qoL\222hj\\\342\024"
+	.ascii	"\337\262\247g\235\221Wx\343\365\235+F\344\337x\276v\265\244\346"
+	.ascii	"\272\261\260\246\261;\346\256\340\035}z\033e\354I8h;\""
+	.string	"~\346\032A\"q\263\\\267\256b\275z(\256$w\321\257\262\027\251\357Z'\217p\354K\013\2169\337\366\315\270\232_\364\n\"5#C\246\274_\204\273\235Z#=g\357\373\366]\227\250\343Ks\333E\3226\"\273f^\346\"\341`]\301\315r\223\f\265\213\326\366\321&+\360\013Y\034\"\222s\273K\332\244n<\037rUt\366\276X\035ev\231\270\230\353vC\345;#\213\353#{\020\027\3426av\235\270p\336Q\027\256Et\237\270r\336Qn\304\306\321\002\304\360j\250\365M\366\034\335\203E\252h\330\3645LUB=;\276\231\003a\377b\341\320z\260\373\370.k:Y\302\306\203]\312\205H\357grm.\356\355-\323\301\336\305\2051\356\302\332\243\357\273\305\036\345B\344\3736\233\214\233\250\355\343\321\2137\260\311\026;\224\231\013\273\311\220g\257\364\235{\221\222ePg\204\342O'\344\373\276"
+	.string	"\260g\271Y\b \323\372\210\242\025h\373\330\177\254\343+#\223\233by#w\263\357\373\276\354\233u\253\201\272=\3717c\236s\372\037\311R\254R\307\177\204Y\310;w\217!\347\366\222\362hjs\357\350\022rn\035\\\321\245so\0059w\016\250V\0036\3673\253\3034\267\023\253\371\343\334\357\217\263\373\343\314\354q\276\372qV\341\307\031G\217s\nB\3167\226\316(\364`\363\tKg\023\204\234m,\235\255\202\234\253\226\316TA\316%\b9\327X:O\265\231f\032K\347\031B\316$,\235\245\202\234GX:\313x\312\240\031\2331P:[\240t\256"
+	.string	"\202 g\006ZJ3\002=\355v\321\213\214\315,\200\234W"
+	.string	"9\253"
+	.string	"rN\361\343\214\002\310\271I\351\314\244t^R:+)\235\223~\234O\3748#)\235M\3708\227\360q&\261t\036\261t\026\241t\016\341\343\f\302\307\371h\351l\264t.R:\177\360q&R:\017)\235\205|\234\203|\234\201\226\316?Kg\237\245s\217\217\363\322\307\231g\351\274\263t\366\240t\326\361qV*\235sz\234;(\2359\3608o\330qN\2763\216\216\363\315\322\031\311\343l\263\343\334*\235\217\036\234\331\206\235\374\rw\314)\023|\226\3072\302\206\1772\277\227\001\362\255$?\210k\rM\364+\206\0335W\333\244\306\321c\356\031i}\023\347\273\261\331,~g\340\302n\n\371\242\024\275\031\004\177|nYr\201\337\274O\343\375\224+"
+	.ascii	"\036\317us\361wL-L\252w\024\202\347\340\245p\320[\236.\206\233"
+	.ascii	"\227\242\262\266\027\375\332\321\235'\006\313\227\017o\346u\250"
+	.ascii	"\306\205\005\367\323\333P\373\3248[;\241\030'@\276\234\354\021"
+	.ascii	"\r\240\346\202\265\243\210x\366\r\361A\231\266\364\343`\270x"
+	.ascii	"\342>\213^x\270\346\361-\375\346\353\035\337<\272\353{G\353\370"
+	.ascii	"\356\342sb}\027\232\264\240\243\243\337\\\337}B\3216&\321W\352"
+	.ascii	"\013\022\304\267d\215/\355j\314\243\361)I\262\245\242L\032\030"
+	.ascii	"P\347\340C\342v!\237\205\034\337|\336\244\371\305\217\013\265"
+	.ascii	"\266\305\177#$\222\352\372\316\310\342\020}\210|\331\215'\203"
+	.ascii	"\341b\314}\026\ry1\024\376\306\267\365\204G\301\204?\301\306"
+	.ascii	"\233\260\346\203|}"
+	.ascii	"\030\330\177\331\250z\253o\302\2367\343*f\343\377x\037UK\257"
+	.ascii	"\227z]7\177\207\225\231)\344\273\240\257\343\271Jx\252cX\032"
+	.ascii	"\037\235\340\035#Voa=y\002\033\271\310\204\013t\317C?\237Y\035"
+	.ascii	"\255\347*\301\312.\327o\271]\310\317Q\302\267\025\272\345\265"
+	.ascii	"\234\250]>\313\t\372T]\316\\\265\252\217\325~\315\032v9\343\024"
+	.ascii	"\314;\334y\263\254\347\367\032-2\247\363\263\316\204\215q\n\332"
+	.ascii	"\2619\005ip\363\360f\254\326d\f\272\247\374\357\036\317\345\374"
+	.ascii	"o\332A\301\372~\277\235\337\201\315\306\205\321@'h\227\205}["
+	.ascii	"\252\305z\226\214V\233\363\217\23118\243\324\232\346\367_\217"
+	.ascii	" \242\247H&7}\275\270\032_\023=\234\301\257R\375\276\n]\022\257"
+	.ascii	"\323\007\343h\2446X\277.z\310|\025\336\375\0372\320\037W\317"
+	.ascii	"\374\016\364\304\253o+I\224\315\324\026\307\253\360O\325ZL\341"
+	.ascii	"q\274M\"\224\321\217\231\202~\b\005w\345\307L\344\024\276\375"
+	.ascii	":\251\311\336\331^\225@\235\244F\276\257\321\r2\340\311f\212"
+	.ascii	"i\333\267yf&\031f\031\357(\362;H\341\005H3N\206Y\003\034\n\314"
+	.ascii	"D\233o\365\242_X.&\203\266\2632\3218!\363\332V\332\207BC\023"
+	.ascii	"\214~\361\224\277\265\034\312\265?V\360\212\337\237\"\342\nY"
+	.ascii	"\262r`\250\241\305y\030\245\245'\225\215,\016\221H7\031@\037"
+	.ascii	"\353/W-\274\270n92\220!\323]}e\035\266\332\002\234\"\312&j\217"
+	.ascii	"o\301\263C\303\234\314T\343~N\310\343\367]#\005R\313\310\344"
+	.ascii	"8p\331\022\226\266\345\r\261\306Sa\270\340s\237EZ\334\255\234"
+	.ascii	",@u\321\303\251\257\341bzIM\343\247\276\201:\2553L=\343i<\223"
+	.ascii	"\236\026\231\323\033\231\204\237\361Lk\240\214X\336\270\306\257"
+	.ascii	"\300\3702\3263\337s\237O\265\342n}\235\036\t\377e\006\247#\274"
+	.ascii	"\324\367a\337\024>\363\312l\030\201\331\350T\334.d\336\b\257"
+	.ascii	"\324\027$\371fP\032\317\355\352`\275k!i\3247\304v\235m\323\245"
+	.ascii	"\270N\003\316\f\231\231iN\347>\213\004\350#\324ap\003TSVPQ\023"
+	.ascii	"\334\240\232\262\202\212\242\222\001BN\224\325S\002Q3dP\200\264"
+	.ascii	"\002\301\243l\220\360d\302\221*\n\204(\252\233'\017\374\006\225"
+	.ascii	"\025\215\250c\225\r\253'\253\2526\212j\252\201)\020\332(\022"
+	.ascii	"d\204\3002\024SU\bVO!@\321\270Q\365\3244%\243\211\206\214\247"
+	.ascii	"\031MPTUML$x\252F\024U\223\325\324\024USr"
+	.string	"\016\253\377\310\005`\357\325\020\353\235|\243\355\264\272}M\277\240\202y\205\332\212\307\340\257\357:\275jl\231\257\326\260J\256\032yj\374\365\275!\376\350\316;\334\222\302u\027\317*\236\013(\313\372\346\031\323K\305c\360\307\307\002\023\354\203\031S\214\307z$\373\343{\023Q\365\253\001\305\233y\212w\361\334y\314'\023\232\327/\236\337,\322\302\232\342c\374\351\225\255\240\367\366\206Ajh\362\320N-\323\037\353\302\200\331\361Ae\f\023\016oz\024\357\202\213\331\345\205\025\223\352\261\002p\3667S,\036l\020\246W\217\265\365\232>\306\337V\2031\301H|1\305\206\246\177uo\2107N\346\272\226\224\352\302\030Yz%\246\377\341\324c\215\036\242i\247v\351\231\376\003\275\226>F\225Q\311\206w0\301Z\234u1\305\224\316|\260:\\\267\"\226+M\025\215\"\242M\017@\306\244f\202\265\355\345oji\242\324"
+	.ascii	"\006\b\233\203\tFd\325cf\020\026\312\024\3439c\237\254\226\222"
+	.ascii	"\265]/\257o\275.\301\244\312\0302\271\016fu\213'*h\243#D6Q\233"
+	.ascii	"\364\025\260XIoUE\274N\207\250p)\"\275\331\277}\342\273\310\030"
+	.ascii	"\373J\235\370\030\3252\327\251\213g&,\003\367e\200/03&~\350\207"
+	.ascii	"\234\223\022O\336\3540Gf\214\304\233!\360\307:\031\236\324\360"
+	.ascii	"\177[\307\235\216\305$\202D2\3024\363\216\"\360F\320o\"yE)\253"
+	.ascii	"\252\027E4LU\r\363\206\364\216\325,b\325\313\365\004U\t\337\210"
+	.ascii	"\026rS\204\216\320\250\211Z\023\337B\324<\242\211\337\240\372"
+	.ascii	"\0077\365\352\316+\364\"\002IM\314\220C\252\"\242\340t,\204\013"
+	.ascii	"\r\301\210\304\030\320\350\006\343^A\020o\306E_f\246F\031\254"
+	.ascii	"\025}\265[<W\321\227\2315#\f\236\350\313\013YQ\363h6T\313\342"
+	.ascii	"\271\230\243\330\367-r\200!\fj\204qG\372\013\207\244U\2767\304"
+	.ascii	"\026I~\214\036\034\013\264'\034R\255rm\241\366\326*pa,\226<\r"
+	.ascii	"PB\252w\327\243\022\237\001\211\007\361%F<\211\377IL\212\370"
+	.ascii	"\021\037D\r\361\"\230\204\370\326\033\234\036=\321\2030\372\243"
+	.ascii	"o\251P\306\227\241\213\336\350\177\352\264\026?|\221\333\207"
+	.ascii	"\017`p:\364D\337PF\245\026\372\241o\251Z\214\316&B\337a\325\272"
+	.ascii	"\3534\3501\370O\004\372\345\007\375<\320\333Po|\376\347\201\022"
+	.ascii	"\265\026\235"
+	.string	"Rz\336\347\177\022\265\310:|\317\377\324A\031y^\371\313o\350\217\235\347\371c\035\224\361\350\341w\276\r\324Z\324y\017Nt\236ip\232\363\312o\270\276:\345|\177U\353\340\246,\032%D\214\336\214\033\252\355\360\335\366\244\257P\035\276\203\252\224'\367\267\257L(Q\230t\236W\350\365%\353\233\314\341y\213\023\322\347\327D\017\251NH\016\337B\374\320\\\247\034\270\007\202\366\250\362\320(\320\302\234t\206fDd$I\222\306\302\n\020\bBi\240\306\224\017\022\240D-\310\203\214)5\"#\005I\222\302\260\035<\005\251G\022$\013\327j1\340M\265\302\365\004Q\211\025\247r\304\r\333\017\300\f\262\f\336\357\231H\376\003l0\205\304U\254'\237\021/\031%`\013\371e9\215\026u\013\323\202\345\272sa\030\250)\332\333#\354,\3760\351\242\025<\365R\034<c\b}\215h}C\f\021\326\272'`"
+	.string	"\006\212\202d\320{B}\354B\276hcq\332W\200\204\016\276\323\371\331\255\345@\267\240\244Tn\2727f[\022\026jJ\362\234\036\230{\234\032\263rS\251S\231__\020\363\203\255~\tBj\315\006ri"
+	.string	"\276\365q\362\2750\272c\324\227!\374s\316Y\ty\376=H,8"
+	.string	"\244\3057/\f)H\2505tS+\314\227\252\317\240%\276\020\334O\n\312v2\327\231\370v\356\304{v\003\335\363\250\345\251C%6'E\207\367\370\357\003\300q"
+	.string	"(v\334\322m.b\007\341\277\031\031\312\311\205\024\237\216@`v'4l\022\315.\260\344[\007qId&\316\373\2648\025x\304\251\021\2208'\2038\372\3373\202\331'T\313\017\235C^l}\244\232\233[\244\031\007p\212\363\250\325\211p\323\236\304\334\345\267\321\365\255\212X8y\223\230\033k\200B\206]\325\250h\002}\340\302\343^\270\235 \3131N\372\202\353T\037\200\242\f\310\275\320\271\224\357\034\206\303\207\255Xq>\365\304\337\030)~d\212\335\2422Gr\303\005\fL\0322\302x\314\032}\001/k\201b\356\316\321e8\320\317\251\265P&\013\323I\r/*\346\202\241\354\261\301\331.hg%\215y#\3729\346\026\314\2207:\363\324\032\320\306\\T"
+	.ascii	"0\260`\334(H\275\304iu\241\322\020\275K\315\211B\263\005(\322"
+	.ascii	"\243\210\226\3507X\271cE\247&\030\353\177\265\277\\}\f\350*\001"
+	.ascii	"\262\340\305\360\337\240"
+	.string	"\020L\017\207S`\002mg\301-\367\254;\3639\034\274\340,\365\211\244x\013.+5\305fK,\004\373\002'e&H hR\\JE\243\272\273\240`u\361\322\271\324C\\\210\036\214S\007I`=\207d\376\336\267\330\177\343%\357J\337\270es\266Xm\327\317\023!\375\033\212\263\273o\006 (\367q\021y\264sl\351\2413\020hwYO\214\247%\333\006\353\007\004\237\3217\350'\247\027=n\323\312\372:\310\247\006\363"
+	.ascii	"\017v\222\351\271\230\342Y_\330\032\353h\212\205Z\020\313P\001"
+	.ascii	"\325\"`\001/\231\336\005\037C\372\320}\363U\re\332_\304J\363"
+	.ascii	"\270+\032\"\374\026hzZ\020f\330\247\354h2\217\025\020\361\203"
+	.ascii	"\373b\\;!tV\350P#\346\026\013\024*(\244\301\332\2647#\035l\204"
+	.ascii	"j\034eyBq\372@\237\216\224l{\205t\311\233\265;D\253\210d|\006"
+	.ascii	"\230$&\b\363\200\234&[\331\343&\220bpS\240\276?tXm\020_%\nK\310"
+	.ascii	"T%\305eD\223\207\372\217\222G\210.\260\317P\270J}\r;)\001\246"
+	.ascii	"\334\242\006Q7\307\340\317|\030\035\325\001\355\224\316\260\212"
+	.ascii	"\032d\375\334\327\"-)\3156\372\302\375\352\311\336]\267\2613"
+	.ascii	"\002z\301\373\225\f\207(\347:\321\036I\017Z-\023;\344\231\271"
+	.ascii	"\232w\306\232\251\254\311\200a\334&]\020\b~\217\3060l\035\325"
+	.ascii	"\306x\374\216y\234\235!\327\316~d\002f\023\226\327\223\257\360"
+	.ascii	"\2140|z\203RQ\025k\267`\031\303kdm\020>c\323P\364J\022\212~\013"
+	.ascii	":\267\303\275\216\372\244\245\017^\036\005\356\304\214\024\345"
+	.ascii	"\001\341\251^M\270\225?.88\311$\f_\354\f)\361\023\243xf\310\364"
+	.ascii	":\341?\333!\253\221s\023\253c\251\256\344fP\342\271\304\030\276"
+	.ascii	"LL\317?\231\331a\234\335hg^e)~\315\321\214\354H\304\003\371\220"
+	.ascii	"\2303_HUb."
+	.string	"\317`S\320\327Y\241)\211\246m\242r\204cFz\212G\207J\037\236\351\3534\353E\006@\376 \037\372\316+\3537\360T\017\027\277%N\217\024r\233L\262\005\212.\247z!\252\004\256\250}\253\030^\032\243\274\316cXb!\213\020\335\204\356K\274\373a\333\326#\213\333\305\f\356\326z\001\206\303\360REY\240%\177D\2347/k%\241\342`\331\021vU\362|\240\331\221\0058\212p\n\320\206\016\227\210\030\232!\2461\255\r$.i\253@h;\225o\205\213X\2756y\252\346D]\037+W,\204\314@\220\245\021\346\003R$%\350ID\230\304EC\232\013\004s\370-\305\225\300\245S\003E@a+V\005\225\035\352\003!\351\276B\366@3CF H{\213\236\2744\211\346\263;)\2510-\017\262\233\307\226\252\317\357\226\365\t\351A!7\267\026\324\310\327d\341\232Q\034\241.!R>\321C"
+	.string	"\364\214\331\033\342Y$\344\003\2261\355\351\353\262\030\225L\247\024s\216)\250\036\363\261+\2233A\264\255\242\234\313\022\270\202\347\327\224Q\33087\373\347@i\220\356@\302\215#\204\342x_\214S\221<\267\203\333a\310D\022\307\211&(\3729\262\3004\002^\245\322\227\022\322\024',\247iW\350"
+	.ascii	"n\326\037\177\b\217^w\005\001\371\030\256\366!4\024\352\323&"
+	.ascii	"\366\2505\235K.\234\t\364O\\\215\306\312\251\335\030\327\362"
+	.ascii	"\251\312L?\302\345\324-E\307\231\310a8k\t>m\242G\256\230\035"
+	.ascii	"S\374\322\316p\260\"t\020\037\3323\215r\357l*\b\330\220\355\236"
+	.ascii	" \201\t:5B\306{\340\205\020\035\001"
+	.text
+	.section	.gnu.lto_afatfs_funlinkContinue.99.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`0\001E\016"
+	.string	"&\032aG\340\262(\035\220\353\320*\"l\240\225\240\306\350\226\262\215n2w\273P\004\301\321\004Bn\251\302L\034\3500>\266[\232Q>\246kuY\037\347\030c\2141\217(\240\035\006O0\034\252#*\264<m\305\336[\356\224\002I"
+	.string	"I"
+	.string	"P"
+	.string	"\227\376n`^\202^`^\332\263wHP{Ba\301h\\\314vWS\023\367\036\025z\376_\007I\251N\217\035\256\261\001j&bD5\023E|hp\374u\250A%\003!\200\224\3355L\251lny\333\020l\247\330\037\021\366]\367|\353W\205>\b\224\305j6x8\214g\267\346\347\307\346\310\032)\356\372\355\377\345\020\373{\013\357\256\227\257\315>C\017\326\214\236\335\017\301\245\037\200.K\342\241\375\025g\341\275\005\363\001\273\253\035\261\335O\201Q@\001&=\206\312\201\033{\34508\320\356:x\341baD\347\304\245\0173/\377\001gg\306#\006\3768G\254EB\3772\247\222\240PaCvC\307\f\364\361\204\t\256j\267\\\200OM\025"
+	.string	"\"\004\007\037=(=\331\337\tj\t\373qw\327\272\n]\213i3uSD\2014\212\016\235t#\3236\n\261`\3506\215#i,\244mE\013\225:\355\304\304\\\005QI3q\\I\013\371\366\272r"
+	.string	"\031\215\234\030\225\211\004\3405\202\004\370\224K\274]FHD\3470\027\221\311\315\202OP\0068<\254\326U\246\003\032"
+	.ascii	"u\26173`\236!\243\017f\264\275\013k\342\261eHF\214T\267\200\034"
+	.ascii	"_Y\361\252\275\313\372\230\325>\350\n@\300k,\246L\320\351\232"
+	.ascii	"\235\206\203\001\313\240\211<\365\2128\311S]9\245P{"
+	.text
+	.section	.gnu.lto_afatfs_funlink.100.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\250\002\255\025"
+	.string	"\026\247\214I\320P\2471\374\007.\001\225\376_\020\312\2365\215\3153\rPF\265g\246\007e\317\177\033<\317\313\354\250\374C\bJDT\"\001!GD$8\270\026\276x"
+	.string	"^ei\330\207\253\204\2548\236A@\223\227\336{\313-eJ\001{"
+	.string	"l"
+	.string	"|"
+	.string	"\267\345\007\214\267\266\335"
+	.string	"\004\306\272\237\277\033\017\243!\rpx\3579\253A\327\275\243$G+V\252\363e\336\021r5%\304r\352\345\274$iX}\035y\365\340\354\234<\211\r:\032z4t\304p \r\265\337\355\\\024\025\370Z\344\310z\027D\217\027>[fo\206V\321AQ\006(Y\217'\232M7\210\256tj\323\233\241\224\024\271\367\232\326\364pn"
+	.string	"\267\035d\033\202M\211\0023\024\207}\362h\005\262/\336{\257\353\217m\352\030Im\376\374\311'\335u\244\276l\204\212'\004\032yU\254\363\336\204}]\027V*\204\355\373K\017\266<\205k\207\247\2563\035\310r\024\256@[%|G\367^\026\333l\261\315\333\3330\266i\273\236.9\036Pj\377\350H0Ozy\200{\177\236X\334{.0Hy\353\363\036c<\036\226H\335\030\253W\372\207\204J5\004P\177d\264\325\007R\240\321\327\304\252\2552~Q\225\357k\264\215f=\360TG\b\353\003\227p\306\203\256}\205\355@V\320%\207\272\021\370\335\332\254\017>\301\210\247-\037\022\315\211\301A\206\255@\247B!\214$\021e|\215Y\262\311\235PB\374\246\034\256\274\367^\350\366\325"
+	.string	"\210\244\035\r{\365\021\301\244U\3752\332\2523tB\206K\250\025&5Z\205\223\023Z\255\264\235\334HD\327>VHr4\222Z\212\313\nm\206\273\315Rn4\224YMee\366\201\3008\0136\225Y\016\207S\231\231\347\356\365\3077q\023\f\222\227\372\225^\202\031\201\005\243\304_7\326jS-\262\253\274\016{\333h\327ne+\360s\311\253ne,+\346*j\330EV;\302\251\\\246r\022d\277{/\203O\030o\255\215\255.\037\022\217\207*\206=%O7 `\242Q\fo\003\265\366\206\016\330\272\306\255\310P\212\356\225\265\245\227\211\"\205\301\307\324\325,\367?9\025\354\207*\325"
+	.ascii	"\274C\237Z\222\357\264\207\242\252\253\204\204/VY\233\334\302"
+	.ascii	"z\375y\205\232\302\307`\004JQj\364.ZQ\251q\303\t\"J\202\2027"
+	.ascii	"o\r\342\031\f\334]\b\216\371\363\310\rvU\310\313<\002\001\203"
+	.ascii	"q\264\234x}f\363[B\331\001f\253LF\330\255\345\016\213\365("
+	.text
+	.section	.gnu.lto_afatfs_createFile.101.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\202\006U\""
+	.string	"\226\272\321H\200\030R:\377W\326'7 B\242\277\343\317\202..\030\260\315\352\203B\314\\\250\3010\370\375\323\321\ts\335\006\024\026\246V\326\013Z\331\373~\247\333/M\\p\002O\221\363\352t\213he\275\232\236\333\021K\b\3312\311\271"
+	.string	"\257"
+	.string	"\303"
+	.string	"\314\273\243gnb\33613zE\306\320}\021\256\213\n\323\003X\230\rg3S\260\320\364*\301\367\356\023\031)\030\032I\343@\357B}]]\350\037\327\013\270\027\253)v/R\002[P\21723\277\353S\232x\2656\206NEz\272\2165\254\274\335\213\3641\362\005\322\243\352\007\244G\255\221\257\327\345\250\271\024=m\257\374\034\220\220\324\322\215X\024^\327\223\223\003\"R\325\343\352\031\025\217\207\275\307\t\325\216\316Y=Ey\305\250\223\347\336\273+\016\373\324\025\255n\317\002SK\210\274\"\324\t\201\311\245\315\303\336R\305\247\356\034\320\275\227\233X\254:\357\316\314X\314l\2029\235\021!>\026\374\240T\343\272\372\210\224Y\304\277\2140`\344\022\367rB=\032\366\007l\326\266\200L\271\330\237\344\024\357r*2\264\267\365\277\364I^\361-?"
+	.ascii	"\313{\357\017_\213\013 ?\311Q\376\232\036}\025\031\332V\233S"
+	.ascii	"\307q\200\346\261\263\2304\302w\226\237la\324'\362\223\327\201"
+	.ascii	"\261b\3021\243\254\220\031\371\3246\213\371\347\265X\314j3\317"
+	.ascii	"\257\374;\257\362\353\034\371\367\016\366\363~\374wg\263\252"
+	.ascii	"k\316\3454\247j3\232k>s\3156\327\334g\363\031\370\212\250\345"
+	.ascii	"8Y\330\275Sqo\256\031\332\205\t?\313\223K\307\302:e\332\333R"
+	.ascii	"\303\307y\241\022\231\327#\207\263\"Q\337\270X\225\250\023\276"
+	.ascii	"2I\217\346\354\216T\331\026\242\216\033\233L\2613\265\315U+\255"
+	.ascii	"\311\337V-\037\267\240\004mR{)J68\324\266\005\233\r\224\257\t"
+	.ascii	"\372\226j\202\024\030\231\250\375Q\311\306u\3325e\224\253\255"
+	.ascii	"^?F4A\r\226gN\3731\345\232\265K\256\227IC\263k\\\307\266g\253"
+	.ascii	"\027\317\246\021\327\360\332u\263\325\353g\271R\371\230 \007"
+	.ascii	"F\345\3132h\020\352\023\205\322\243m\037F\231\006\356\350\324"
+	.ascii	"q\rf8\325\304\332,\216\360\333\241/3P\335\344\235>\226"
+	.string	"\213\341\240\336\033ub\0075\212\304\203\243=\313\354\001D\237x\333nO\314\206V\310<\313\034\354\323/\200\277\241\243\243\037P%b\221\324A\0352Rbb\372\245D0~H'\321\221Q\321\311@\237\245\"\246_\021\020)\270\364\363%\031\371\220\214~0|@\245%\237\217\003N\212A\244\344cJJR\362\355\220N\267X;\373\263\346\0173'\373\304\025z\347c\375\001\241\311\303\f\312\nu\214\243\f,'\2302\257A\232*H\300\030\367\326v\357\025\252j\337P\355\223nnv\206\264\224\f\365\336\373\3033\252P\302\201\313\335\206[j\277j\245=\\\265\b\304P\266ykc/^[F\024A\312c\037\366\005V\330\264\276\316@u\223{\017\246:\226\307r\327\330\361\324q\254c[\030D\241d\303u\345\3239\333\313Z\215T\020\022}\250Q<\007\025S4%\005I\nJ\205\003\260\"\021\263\342\006\021"
+	.ascii	"=g\220S#\"\005\005)\264o\251\203\2646Qr<\204\032\027\345e\277"
+	.ascii	"E\260\027\327/\235)\334\263\264LtC\374!\345<\373\025\357\273"
+	.ascii	"\333\376\276\023\324!\273w\023%\004\330y\325p7 \004\262(\342"
+	.ascii	"h\211\310B\255s R\301\255#\024\207\347<\016?%5\272-\273\266\335"
+	.ascii	"=\255\021\344\271\263\357\330\\\004o\f\347\036#\223\304q\t\246"
+	.ascii	"SJtJ\246e\0229\232\340\374z\232\232\026\322\362\362\315PpEN}"
+	.ascii	" \267j\r\3325\372\027^\251*8\356\212\257\237\301\332\343\337"
+	.ascii	"\233\376\017\005mj\n\371u\267W\032\316IxcY\2438$\003\026\203"
+	.ascii	"\263\304\220n\220\243\256\366p\372j\345\013,\f\3701\301\202\340"
+	.ascii	"\323\344\206\223\341\315C\300\312\273O\230\021Xq7\337(\n\231"
+	.ascii	"\307\\\262A\250\347\244\274\260\341\273\327\274\257\341\345?"
+	.text
+	.section	.gnu.lto_afatfs_fcloseContinue.102.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\f\f\205>"
+	.string	"\032i`\027?@\246N\007\355\243?\251\203\0357\017\203\213\360\031\tg>\nU* +\3430\002I\366C\350\267z\001\272\221\377\2116E?\260CMpL\342\r\245\331\360?\210\3743!\021\021\262\367N)\245b\001P\001i\001\023\2109\230u0\037\323\264\032\3565|Ds\273LCw\364\223C\004\306u\031n4|\304k3;\372\fG\325\026M+\206\026\201\t\235\312i\365\312\021\210\275N\251\315\304\356`n2m\307\243\237\374J\002\001-\345ze\346\301|\354U=2s;s\313\365\334m\272\036\275\324\266S\376\350\265\355\223\213\035\020{\345g'\331^\211\315\304\366\312\227YP"
+	.ascii	"\2626\314\301\234\232\022O\260m[\257\257\302E\277\355\224lb\002"
+	.ascii	"\260\244\224\204\204<:\032\213\304!\273\252\357\227\333x\026"
+	.ascii	"\326NY:\2512\251\255\331\323~fY\324\255=]\326\272\016\2137\r"
+	.ascii	"\277\242\240\2755\323\225\006p\305\256\251\374\314\254\370\322"
+	.ascii	"\233:U\347\346J\315Nj:q\244e#\325\244\237\331R\315Z\326I\322"
+	.ascii	"\320&~\024\005\255\255\217\352\361\210\037\231\006\204\232\324"
+	.ascii	"\365^Sq1cs\243\237\331Z\034\245\027\251\250\240\2515Q\2250\027"
+	.ascii	"\347\326~fi\352\333\235\351k.fk>\034~\305\351UJ\032A\271\301"
+	.ascii	"(hj\315\372\231\265\035\317\200\370:\325\266ms1\313\342\252\232"
+	.ascii	"E\310M`\362H\226\262\343\331\017\177u\300\262N\022\24432\325"
+	.ascii	"\n\217\024@]\327>\344l\314}\370\325\266-{\331\031Z\363S3w\223"
+	.ascii	"\231)0\037\007\004\\~S\r\305\256\317\345g}\tR\351` \274/{\353"
+	.ascii	"\006V\375\033\002\274\273\003\253\364\314\037@x\227\251\357\212"
+	.ascii	"\244w\310>\354I\217\313\036\365\231\f\305&\211\201w~\330\206"
+	.ascii	"b\377\223\317\256L\013\321\177`\377%\244}a\316\254\371\323\345"
+	.ascii	"\237\331\215\305\372\257\270\223\376pE\234TXXH\330Xl\277?\033"
+	.ascii	"\005\262\034c\021m\207\004\261m\333\007\334R\024&\210o=\330^"
+	.ascii	"\373\273\256\017D\021yY\316\321\211y!\363s\314\2379\210EO\311"
+	.ascii	"?\205\331\350\314u\344\274\205t\326j5\315YH\347\004G\316XHg\004"
+	.ascii	"K\316WHg\253%\347*%\347\003Hg\003TE\347)\244\263TT\3675C\031"
+	.ascii	"\235\003 \235\235\214\316\311\246\323\334Ttfj\272n\245$\347#"
+	.ascii	"\222\263\361\310\271\210t&\0369\017\213\316\254\321y=:\253F\347"
+	.ascii	"/:;\321\271\037\240H4\366\2077\267\366|\236\355\221BF\355\235"
+	.ascii	"\365\215\226V\323\335\327M\247\237\371\311]\207\217\367\214\301"
+	.ascii	"\037@h\332\364\034\035-\207\237\246o\272\217;\016/pp;\257\371"
+	.ascii	"\230st\224W\347\24078\275g\243\237\274\352A$h\2039\217\333\315"
+	.ascii	"\002\0079Z\017l*\354\331\0361\336\245\021|\006+\356\374@\371"
+	.ascii	"Vq\"\327\215\253\276\241}\340\215\236'\313\271\350\3213\277\354"
+	.ascii	"i\252\006*3\344\364E'DJB\255nz\247\357j\004$\260\253\211\337"
+	.ascii	"\364\005\032\001Y\016\237\370P\201\224\204b\367\212\007yAt\345"
+	.ascii	"\215\273\316\024l\257\303\357:\255\326E\003\247,\347z\317\311"
+	.ascii	"R8M\313z\217\371\212\361\037\327\331\325\334\343\333\305\307"
+	.ascii	".\\T\323\305\016\254zM\002\357\370@\227p=y\262v|&7_\267\021\245"
+	.ascii	"\022i\261\253;N\033\343\3024\225yC\2517\360C\272\332\300\367"
+	.ascii	"^\373\324\310\"(\207\376\256\030\237\311\f\326\210T\277Za\241"
+	.ascii	">\352\207pa\203\261Q\377\212\324\266m\333\"\226.\004\353=\204"
+	.ascii	"\327\331y\032]\270\336cD\365,\227\266\274A\2724M\246\360\021"
+	.ascii	"\247\236\375\033w}\264\264\"\f\b\232_=x\235V|\273\264\340\205"
+	.ascii	"KN\003;\021\337:\266\327\251/\322E\275\324w[\333\336\030\237"
+	.ascii	"3\204\377\367\307.\315\360\231s\230G4 X\325\264m[\b=\207/\230"
+	.ascii	">t\303\254\316hs)W\250\r\3351\334|w\356\326y\227Y`{\205\372\216"
+	.ascii	"\323\352^[\336\035\0375k\025\032\003\313>\323\367\234^\345\326"
+	.ascii	"\242c|\316\244]hA\030\236\232\234\241\003i\350\265\301\224\375"
+	.ascii	"\023R;a\036\370\321\261\302>SO\0070ZE\no\021\003\206\013\225"
+	.ascii	"Yt\201\271\300\241\302\005\213\031;\300Tx\321\200\3415\003\206"
+	.ascii	"\n\031^,n\200yu]1\215\032-nx\341\240A\343\206\327\361)\326?\345"
+	.ascii	"K\354\307\2048Mp>>7t\221\234;c\037\266\206\257\220P\362\na\217"
+	.ascii	"J\027s\205\204Aq\207(\350[\204\355\365\370\036\244\210\006\351"
+	.ascii	"\334\331`.\023\247/\227\215\350C\n(H\202e\026\341]H\034y\220"
+	.ascii	"\002\306\0016=s\313eb\245\345\262\025\310r\235`\251k\255h \241"
+	.ascii	"\245\034 \023\004\347\266\273g\027\211w\031\377\207\021pb\211"
+	.ascii	"\002x&\017\3732a\215\337v\355iD\352\302\016\375\365\371\341\212"
+	.ascii	"\224\270\333e\322\340\252y\363\262!h\362m\342U\256\223(*\306"
+	.ascii	"o=i\240\301+K\001>M\313\0272\207\376\210\001"
+	.string	"\224\244\244\275\365\305\001n=\224\027\023\236\\\247\224\223\013\227\264\024\200Wf\350\267\234\215M\326k=\007\274\004\237\365]l\200,\261>\301w5R\022B\333^\374\240\351\026g\273\316\217\256]\270\307S\303\372\037\324\207\356\352\021|\257\351\242 2\350\240\244+(\316\344\272\021\257~\213O\r\311\213\264\222\353\2064\355\265\267h\034`_&+\305\321.\223\002\224\371z\361\263\353\224\232B\315.\\\322\364H\233i\002V\275\3253\221A\363\224\204h\250\240%A\366uc\253>\200\352\250a$\004\231c\250FDD$I\222t`\002\221!\273\252\003\021P)DJ\321\314\2440\031\306\265F\022\270f\202\3377\031\302\367%\310\326I,ri\2543\215\203.\245!\271SC\262\026\246;\302\027\t\257p2Jxe\307\335\232j\216W*@XK,8]\b\215\317\314\337_\243\305\374\030q\n>QU\214\264-"
+	.string	"\223\227>\022c\021\203M\270\360\"K\242\276\n\004\033X\322ZOaq\022!sEf\377\301\353\212\006Y\314\233\301\016\314\032l\237\370V\234\300e\036\251<\300\022\024\362L\025\3535\274\004#\202\217\361\326p\243\266"
+	.string	"\360\022WO\303\242\023\027\333\334\243\b\377d0\343\r\340\023\tu\207~R\313\206\320kHaH\261=\221\205`7G\320\030\260\274A\267EV\274I^\272v"
+	.string	"\202\2542F\272\f\005\016\271`\361\002\n=\364\270\223\313\020W\313\213\206p\200~\225&\240>\202\202\272y\374|\326^\350\320d\354m\016Oe\362\026\263F2;2\030\307O\270\006,P\301\200\205\007\272f.34\355a/GT\260\266.}\026\214\305$8\201\fG\bJ\372E\223*z]d\013\221\2559\216\336\370>\tV\262\326\370}!\311\371C\220\303\t\322\255\323y!O\346Q\244e\007\013\335\021k|6S\321\313b\023?\342f\343\224\247\024`t\026\262\006/\350\037\376+\030x\"l\207\030{\3212\203\034\030]\231b\023 \2714\260\3110,x\004wC\204\367i\002\251v\377\305\355\235\220\325/\001\006\211R\261\305\334\025\253_^b\003g7>T\033\356\315\356\317\035\215-w\213\362\266c\232&"
+	.ascii	"\371\371O;z6\221\230\253O \177\250vs\337\321\203\261p\375\202"
+	.ascii	"H1\357\303\256\037\034\204)\265`<"
+	.ascii	"\214U\327\024\313\2023K\bj"
+	.text
+	.section	.gnu.lto_afatfs_fclose.103.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\260\003\375\031"
+	.string	"\326\256\247I\240\032U:\022\316\027.UX!m\220>'Lx\357\377\356\337\b\330\200=\005\243\212|\371\254Q<\360\361f\377\373\337\320\007\317F5\256\215\235\321$\230\004C\0368X\017\022(S\204\341\207\251\275\203\230\002b\t\331{'\031\222"
+	.string	"\211"
+	.string	"\234"
+	.ascii	"\246M\273\373\256=k,X\333}\336\213h\357\275\270\200\234\205\206"
+	.ascii	"J9\257\020\232\002z\263\327\257\316\233\350\007\2347\273\273"
+	.ascii	"%P\240u\355\353\220\317\312g\203\0060M\316+\353\016y\355\250"
+	.ascii	"\323\304\327\326\3721\216\272\260dL6!\351\200~\342\225\317\221"
+	.ascii	"\234J7\0037 s<C\303\232(\217c\334`\267\005H\245\223\201W^\202"
+	.ascii	"\306\244:\234\275xB\223\032E\225\356\206S!\032%7\272\275\241"
+	.ascii	"\303Y\213\302\220sn\233\323\375\274\321w7\255\2737t\337\245\353"
+	.ascii	"\315^!\335\277\313\345r\331W\250\033\200m\325\211\357\233\027"
+	.ascii	"\337\251\257?\212\332>\337\373q\333\266(\333\017\320J\372%\201"
+	.ascii	"\276\334mZ\263\317\362)#\315)D/\376\304\333\356\367\225~\224"
+	.ascii	"\035J\2332\236\226\310\272S\244\023\373\305\033;\025\322\202"
+	.ascii	"\264\377>l\236C\351\273\343\t\271\343\345\234\323\377\372\301"
+	.ascii	"\013;\2252C\200\013\220qA>\2244<\312\201<?\232\341,%\333~\022"
+	.ascii	"0\t\261\360\034\334\354\f\350M\004\230\247;}<3\252\213\234\245"
+	.ascii	">\374y8\365\270\271\251\253\272\020\270\3148s\033\361.3k\274"
+	.ascii	"\271\026\350\364a\223\370\226\331\255(\265\270(\3217b\342\274"
+	.ascii	"\231\2727\036+\371\0013fW\324\255\245HR\357T\317\023\bQ2H\231"
+	.ascii	"\244\230\037\273u,\252\001\345\261]\277\362\"0t\263\317\373\343"
+	.ascii	"\027$!\216\331\025\265\005b\322\301d^!\267GGO\262`\330\371\013"
+	.ascii	"\343\327(^\005V\241O\305E\n4\347|#7\177\013\020\351\331\354\362"
+	.ascii	"AH\2424\335~q\342\333\203\350\213\2272I'\234]\323\035j\313\236"
+	.ascii	"h\331\024.\365\204\216\216\352B_:\260\034\334\256\b\262\234\026"
+	.ascii	"j\216kE\217Le\305`\254\0250U\005\313\265#cEP\3201\026\257\035"
+	.ascii	"V\213Xl\207\225\256\266\343|\205\372\276\034\301\240\331\257"
+	.ascii	"\2357:\312\306\207#\230\204\377\332i\357\215\356\266\2671\330"
+	.ascii	"\356\255q\3169\243p,\276\335\034:\330\347\372Hm\234 q7F\243\267"
+	.ascii	"\333\303\235z\036|\270\022\304\201\020o\022\201\023\246\312R"
+	.ascii	"Q\315\217{\365\354n=\251\342\f\265\353_^\250Jit\006L\236\224"
+	.ascii	"\273F\250A(\245\020d\n\025\215\004\221\024\026$\305\001\200\""
+	.ascii	"\231\313z\021\300\271SbRPX\3308u\306N\322\271'i\212\332\253S"
+	.ascii	"\n\b\2146\341\204\201\363\343&\202T+\331&\232\201\037BU\225Q"
+	.ascii	"\2619\315\274\322\264t\324\006 \262!\252\226\f\277U\237a]q\246"
+	.ascii	":+;{\212\036@A6EG[\013'\032\221\305\225H\340\227\243\326\300"
+	.ascii	"\330\305-`\037\035F\314w;\3264u\035\371\017\322\"C\307y\t\331"
+	.ascii	"\252\250.D~\336\222\322\336\360s\3508\200T\263`\255@\032\032"
+	.ascii	"\2254U"
+	.text
+	.section	.gnu.lto_afatfs_mkdir.104.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`R\003\275\030"
+	.string	"&-\237I\260XQ:\262=\016\367$\305FX\230@\230\3466\352\351\301\332\254Q\210\241\322\320\007x\366\347j~7\221-vx\016"
+	.string	"\236X"
+	.string	"x\354\267\205\037|\036t\030T\236\300\237\3348\226i\375S\253\361\240l\226\020B\266\334)\005\215"
+	.string	"\201"
+	.string	"\215"
+	.string	"\240\313\253\302\203\343]\302\203\022&\310\214\363R\350\246\322\201\003\305n\251\326r\265/\274\247\345\035N\234\243N\243\030\202t'\216O\211,y2;J\314\340b\247\347\247\347\370|\244.,~$\275\211\212\036\352 \311\206O\r\025,\246H\003\324ZS8\0244\302\324\301\321fH\203\347`\321\021\270\330\3619\245\027\210p\300H\341N\320\335\301;B\342jsot\006GG4(>\034\317\247\230\241\326\352i\303\355\334\344m\357lo\260\327B7\0316/\220\235j\001\247\311p\032\345\351\323s\277\370\362\007\301iz\337\275"
+	.string	"><\3219\331\351\310\261P\312zkb\252L@\"3\356\373\355\373>\356\363\215L\362d\327\275g\233\357\260\270\303\022\345g\250\326z\235\317\363y|g\363\036Fz\251\225\025'\366\256T\031Z\252\26568h\r\343\301\027jc\223\007o\313l\262\274\301\202aN\373C'\222=g\342\002j\005\312\t\251\265|\340\t\343\003\337m\241\277\036?\264\251Te\310\022Hw7\265:\366\200\t\256K\200\033)\024\227\\\333\303\207y\233_t\001\276,\277\333O\355\331\231\337\373\021V\001!\033\210\033\t\241"
+	.ascii	")\306@\021r\311\024"
+	.string	"?\236\215Gu\223a\243v\205\250\215\351\244\324\346\317\357\271\365!\256\004B%.$\304\201\n\007\337\363\353G1\252(\265V\n@\036d\306\217q\320\260\021\363\266\021\341A\324\336\350\013jLL?D\271\234\331\264\265\326\331n\220]\322\346W\004\257\307\264X ddX\255\3215\303\242q\311\274`F\267 \324\300\220`\301\264hnjX+\330kE\363b\315\254Z\261\232\025\004\005\206\211p\305V$`\260\330\212,s\276@\343\224\0261xG\343\225\334\224\222KO\373\222\2634_\311\351\236\226\003\257\bm6\241\bL\277Chp}_\226&&\265\235\031\311\217\244\033\247\r\032oBp_\364\331b\006\225\"+N.n\220\305$`\313\256\322l\360]\235\007\337}N\247T\233?Zk\255\241\203B\250A@\204\214D\202\021\210\310\f\021M\n5\006`\002\031:c\007\021\3609$\242d\3303u\b"
+	.string	"\304`t,\206qP\314L\310\256\013\021\340\001\335\035M\"\213\377g\255\255\315%\342C|\275\376\tG\254%#\330B\277\241\302\221e"
+	.string	"\377\217\032\253\225j\332\276\266%\002\0011'yc\b[\234\207\327\360\346\030R\024\002[\006\332A\230\177\334\266;\b\n\026\267m\224\325\031|\2224\013\030\265\261\2241"
+	.ascii	"\341Y\016\004\n'z\337\231\001\364\201\r\356\331\001\373Wh\250"
+	.text
+	.section	.gnu.lto_afatfs_chdir.105.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\r\r"
+	.string	"\026\332\\D\020\257&\035\200\213s\"\2522w\013\244\257\260\211]\332'\306\316@M\355\336\036\022\374\324\256\355\247\016[e]\373\031\033\036\204\001\177\350\255"
+	.string	""
+	.string	""
+	.string	"\220\245\210l|6\325Q\004c\247\253\251 \232\354-eJ\001I"
+	.string	"E"
+	.string	"N"
+	.string	"\321\3369\327#\366\001\327\243mwx\220\\\272\247\222\342t0\022\\b\354z\232nx\351P\263\344\007P\225\034b(W\210 \005\006e\243:A\216L\206\231w\317\023\225I\246\306\307\356:Q*\nw\274\355\005\266\025\330w\020\337\367YW6L_N\307\263~\350\3641\305\360!5\241\302khvS\337\214U\021S\254\330\276\337\362\326\350\236;bh<\354n6\262\263\223\354\314v\246}\020g!\235Er\001\273+\022'v\275\r{`\017PK\022\305\013\231\013\352\220\353\322wO\013+0Z\\\254ha\2222\374\226A\177\t)\300\242e\221\213\330\b\250\354n\202G?\304] \370\034\036\035\212\220G=n\2148\311\365x\351[?\320\241\304L\n\013\313\224\237\355\235R5\330\327/#n\023y>\034\210\001"
+	.string	"{8B \242\016\210gd\024\352h\033H\033\001uD4\017\027\3228\fx{\360\3414\321\266qZ\346\231\256+\277;V\323\305\274\230H\277tY\243^O\354\017\223\236\340\356.\334$T\373\323 \217\212\032\020"
+	.string	"u\331\373B\300B\235Q2\361\300AC5"
+	.ascii	"\002\337\b\201\307\204[\230\027\272\313\300\240\"y\r\225\036"
+	.ascii	"&N\313}4\006\265\007"
+	.text
+	.section	.gnu.lto_afatfs_fopen.106.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\310\006e)"
+	.string	"jKx\020Fp\\N:?"
+	.string	"\37175!\002\356\tO-\271k\217\254\303ISM'\324\030\370\272\317\233V\003sm{f\320\364\303\206\002v#\226\246v\26417;P\374Y\305X\026L\027\377z2\375\217\2655\273\t\221;\311\371"
+	.string	"\342"
+	.string	"\363"
+	.string	")w\360=\235bChx\223e\\\030\232j.\324\312|\261\217E\235\354\306\211\367z\221a\271\267\351\200'\370\236r\363E\373\324\367\037\373T\302\204(\306\361&\230U\221\315\013\225s\316\275\315\243.\302}\264y\356\2518N\034\n}zx\202\300\237\257gS\264+\016>\232\205nK\331\334\225+\251\023{H]X\\\037\376\030v!\372\243\205&w\270%\027\332@\356\311\326\235`\325\007\035\302-\231(\004#'\313\255\332C\004\013\310y\214\272\260\302\036D-\214E\t;\334\362\007\332S\236\\\356d\351\243\002\327\236\206\335\001\371\257\207\344\274\206$Yvbw>\243.,\255\367P\004d\206\2509\334R\013\035b\202\331q\347k\325\025U\265Y\300\253)[4\322v\344]K\255N\321\342\373WI\264\350\336k\257\220\265\366\220\356\275\\\225WXg"
+	.ascii	"g~\006f&\301l\r\004P\307\232\307uUy\027\274\332\341\237\257<"
+	.ascii	"\271$\273\277\200Nd\321\3560\311\212\307\347:\221\3755\332\\"
+	.ascii	"\247\230\310\232\307\357_;\240\272s6\027K>$\374\033\366\351\333"
+	.ascii	"\005\033d\334\331\326\261\34617\221\265\277\230\177\036VJrp{"
+	.ascii	"1\017\350U\036\022\360\253,\024\004\254\f\304\225\213'\373\177"
+	.ascii	">\345'\376*\017\257v\026\372\364\360\274\371\007{\225\177\275"
+	.ascii	"S9[_\345\264W\031\265\225\333V>\201\2456d\234\223\315\255\347"
+	.ascii	"\232\327*\257\316}K\263,\271\332O\345|\264\253\361\3278x\026"
+	.ascii	"\365\347\323X\306\315\270\315\320\3120\305\356\275\177\362\317"
+	.ascii	"\370UnE\306\257p[Q\262y\257zV\356\354\304\346\334{G\370\236\026"
+	.ascii	"\241\377\2612\230\203O\317\034\305wr\220O\205\306\357\324\255"
+	.ascii	"\001\207\355\213\335\275M\006\017#\016\200\251x]\211\002\025"
+	.ascii	"\236>\215M|\315\211\342\231{/\2054W\203\202S$\325$\373\024\250"
+	.ascii	"\277\366\005\311:u\230cd\307\232\327\367\336#\260\277x\210\313"
+	.ascii	"\314\366t\320V\0235\037O\337\371\003\331\342\272\323\353\323"
+	.ascii	"\260\214\246\266{]\305\3741\257\372)\340\351`ZV\231\377\214\b"
+	.ascii	"\017_\177\005`\222f\326k/\236\273\355t\352I\247\354D\326vO\007"
+	.ascii	"\323\254\346\250v\220\371\235\017\016\211\363&U\355Dp\223\222"
+	.ascii	"\264\250O3\332Am\273\312\f_\216\335\004\221\322\242dr\203\300"
+	.string	"\361\343\270\316w\257\324\231\f\376d\237\032!]3lt\354\336\230\271\356g\006\203$\353\035\346\213y70\211\025\227\252-\037\330]\336\346]p\347\221\244\252\235t\250}\032\330\346X\363f\334\215\210+\360\273\334\213\022z$O\331\330\302^\331\302>\035\352gA\373\213i\330\240\016K7\256h\362`\2042\276\210\301\324\244\3443\256hbB\215LI0\214/\226X\370X\351\301\023\013\250$\026J0l<%\0355-\035\301XJb:Rrz:z\220\200\233b\030\235\216\240\232\232\234\216\202\315\343\333\313\267\206\013\311sM\370\2733\032\024\352a\261\213\216\215\344\337}\330\305\016A\267\245l\356\271\005Y\363\210\004*\237\203eb\363\317\210\214\275%[\212\275\240\311A\031\366\227\320\206%V.(sB\334\304\335\247\277\270\347\306#\240\033\315\217\301\205]\345\340\302>Y\031\232d\305C\357\275\267\247\301\205-"
+	.string	"\305[[C\316\2311\221\025\215\035\233\034\036\240\260\007\fUb\247]tn\263?-\324\314\036>\324+\031\275Y-\305\275N\373\316\243N\350\324\220s\317;O;\034\020@`\312\r\177S\"\201\233\023Dm\204:\250\003\357\251\354Q\264R\242\f\366\027\217\260@\355TF\227\306\"\316&{\250Q$\203\0205\310\031\021\031\021\032M\233\003`\002!Tf\036\021`ED5\243ii\332\317\252\217Y+\n8\024t\345\321w\034\263\205\333K\200\217\260<'\322\262\034\200b\236\353m\033\021u\363\271X\245\003\332\240\374\257\225\230 M\375\206!\310S\346\247\326\265:\243\206\271\f"
+	.string	"\275\030\210)\034\223\2641C^/\227'\320T\225)\346-'c\350\035\b\002m\3164X\227\276*Y\334\234\020\344\232\211\201\331d\200x"
+	.string	"\236\217{\265|\024dd\016\276-7\347\342"
+	.string	"\270IOA\021\025/\026\332\214\234\267\233\266\216l\037\345\270\032\355\206e\210S\016V\tB\330\031\013\003\216\036\220\346\022\221\215w"
+	.ascii	"\260\252\247\027::\221r\276\223\265\366\264\310\335o2\243ff\231"
+	.ascii	"\336\207\337\236Y\033)O@\b\020\352~!\206\033\202dVAR\016\001"
+	.ascii	"i\017\306\347\353\272J\207\230^\201\275\227?\027r\344=tXl'\262"
+	.ascii	"\033\370}\341\017"
+	.text
+	.section	.gnu.lto_afatfs_fputc.107.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`Z\004\375\035"
+	.string	"\346\267\302I\240\230Q:\300;\005dW^\3261y\024\353\202\222p\303L0c\r(\360)\257\276\bO\274"
+	.string	"\016\332m\213\377FT\233~}\002\261\372\220\256\307x\354-z\203U _\b\"\357B\263?`\f4\231-\371\204\020\271S\n\251"
+	.string	"\240"
+	.string	"\260"
+	.string	"\264)\036\031\255\"`\265\026\177\316\037yT\357R\336z\235Q\357\302K\313\t\254\326z\340\245\037\234/{\310\245\266\002\006\275\027\217\274\265\016\217\306Z\215\b\354\340\324\276\323\237z\207Z\361"
+	.string	"\2652Y\031k-\"0\203\363\245\213\3171_\236\2771_\272gwy\221X\005h5\001\221\214\251\265\332\226\307{\217\231%\271\264\347\307 \310\202B\244\307l\334L\242\t\201\264$\r\f\243\320\250\t[\2209Ttp\271\025\220\2223\241\215oM\310\202\354\251\265\236\352\364\205\360Gi\fB\255\3254(\234q\237\267\255\3026\007\233\344\005\265}\030\240\322\317\036\256\305;k\255\r|& \202\316\036+\314\227\337\0079r\021\201\362\3210\273\370\243\273\303>Yk\255^&\233F\275S\243\326\241\241\316\241\241\306\241Q\337,\265\315\245\356\232O\335\265C\3754'\365\354\244\226\321P\237"
+	.ascii	"\250c4jsF]\316\250\311\031\365\312\250\351I}\001\013\304\300"
+	.ascii	"\250q\034Y\265\312\b3S\273J&>.\365O\371Y7\236x\225M,\242O\330"
+	.ascii	"I~e\323l\364%6\263\300\206KJne\357^e\005\307\257\246Z\353\316"
+	.ascii	"6\262i/\351\221\234\312\001Y\316"
+	.string	"3e;\333\345J\032R\341\311\326\301\321\213\f\324\271\376\024\023G\013\210~\b\363\345\203_|\305\237\233@\f\026q\370\264\264\303e\241F\254\325\367\340\215\276\360(\030\312\034Y?\206NO\016%\203\255a\003}p\203\3712&K\022r\263\346\356\254i\322\260\266\346\236\352\245\361\350\365\373\242\262\331\233=Y\357-\263fm\366\306\227Cn\210\371}M\005\371\321Z+\322\356\016\2170\313\375\020\245\205\005-crw\313\335-\240\322\233\274\266\344\232[>\257\331]Z\214\245,`\223\037\r3\335\232\375\025\360\214\217\303\235t\240[t\224\262a\347\231\337\272\\\321\r\207\201\b\250\b\267\023\022\262\240\313\355tF7\034\0248\020D@8\021\267\240\333\354v\034\211!!\3227\237\235PQ\220\320\215(\305.\310\226\033\262\021\r\005\225\260\335t;\233\017\001\347L\340t\266\242\\Ng\243\025}'\3532Q\375/x"
+	.ascii	"\351\362\355/\326C_\345\257\272\221\0201'XMC\247 \315\372V\021"
+	.ascii	"$\320\007m.\222\275\030\221\362e\376\230:TIH\030\022\030+Z~\345"
+	.ascii	"\t\337\362\303\223\345\312@\327B\001\207\250\263\277z\001 K\270"
+	.ascii	"\234X\006\314X\362\2309g\225\250\243y\036\023gs\326\024\250\364"
+	.ascii	"\263r\205c92\316\336\352\003\260du\r\237\240|\344l\257\324\002"
+	.ascii	"P\250Q \246\214c\30603\301\214\2146I\213\001p\002\2312+\017\020"
+	.ascii	"`X\323\246\335u\246Hr\236a\277\234+]\352H\024\250\354\373\270"
+	.ascii	"?\345\32610Q\"7\352M\200\006\325q\264\301\343Fi\325\3471\326"
+	.ascii	"S\253:H3|\251\225\\@d\362\263\2417\263\346\206\201QY\231\251"
+	.ascii	"R\323/\232\355J4\240o\361\311\004u&\003wi\326 \356\021{WK;6\335"
+	.ascii	"wx\223\351\307\326\004\006\021\205\271\300i\033w\374\262\263"
+	.ascii	"#\347\266\202{J\327\245\276\270\245\246\240\252\270lg\324\367"
+	.ascii	"\\\245\354*\206\002\026\376\241\350\243\027fj\250\222\336H\346"
+	.ascii	"\326\361\037"
+	.text
+	.section	.gnu.lto_afatfs_fwrite.108.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\302\001\305\020"
+	.string	"6\337oH\340\262(\0352#"
+	.string	"\271m\301\0263<<\344\022\250\030\240\263A\276\031\021\322\263\216\fq\344\001\275\306F\267\377\333l\031\n\254/Z\354\355s+\034\316\221a\ne\225\226R2K>\344\022\017'\333E;b\367&[\246\024Y"
+	.string	"W"
+	.string	"`"
+	.string	"\265\216\f\354\240\373\364\330\331\366S\\E\313\241\004\331KT\340\303\303\245\366\243\326\3613\360\021\372\311\235"
+	.string	"\375\224 \302\r?9\271\241?\022]\237\335\314\271\230'\312Vr\013f5d\002\2100n\304FM\320k_\030Q\266+2\251\265z_\304\r7\275\355\t\266#\330K\n\236k\357:\377\3509\177\210h\335}\374E^O\272\336\271>"
+	.string	"\031\342D\214\006\016\237\335j\215\271\r\325\237\3313\302wq\333\312[\270\001P\020\024\265Vo\305\366>o\267l\317\266\367:!'\240\306jf\020d\016\013\220\007\273\366o\216\323\372\330r\221Zi3x\002 \355\226\306\304\315\325\003\307\216\333l:\017H\322a\263\205\357\240\n\330|\272\223\267=\001\211\030A=\031d\304\244I\324\353n\260"
+	.ascii	"\212\255\220\351I\364\322\223^\027\032\230/\034\006J\211\377"
+	.ascii	"\"E\325\325Z/\342\323o\241\237\227\257\375@\216\235\237\331\212"
+	.ascii	"\233\327\336\354\021\266\362\303P\211\031\037\2264\007)\360D"
+	.ascii	"\256\300\323\tC\005\n\236\240N\234M$\254\223J\351dJ\261\260J"
+	.ascii	"\237\n\365\245P%\224\317\264b}$\b\254J\001W\237\212J\265\372"
+	.ascii	"\274\361uI\363k\037\260\367\2719n/\343\001g&\375\220N\tc{J\233"
+	.ascii	"\274$Lh\212\354H\206H\221\264)\224\366/+\251t\225t\240a\303\005"
+	.ascii	"& \200\242\031\344\003u{l\001\303\315\21214\361\026&x\314s\323"
+	.ascii	"t|\031\337\310\016h\316\271PCXw \363\033\315\004)\033=\306b\232"
+	.ascii	"~\321>3\003 \fCY\274 (\274`M\262t\344p/\344e\214\020\034\356"
+	.ascii	"]A4\370#tuP\345\255j\r\024"
+	.text
+	.section	.gnu.lto_afatfs_fread.109.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\300\001\255\020"
+	.string	"\226\037pH\360\320&\035P2\304\033\3545\2636\001\345f\360\035T8B\367\373\310\002\035\217\302\252\020\004\340\235\n-k74\351iL\324\036\227\300\365\351.\343\304s\030\321*\244\276w\360!r\330|^f\322\243=\261{\357-S\nY"
+	.string	"X"
+	.string	"`"
+	.string	"\013\334`\373t\270=\204~\332\366M<\347\345O\302\f\006&\210\301\243\205VTk\330\025\270\b\375\224\017\241\237\361\303\267\337\247\214\373\371%\220\345s\223\271\224q\340l\243T@##&"
+	.string	"\030\223\"B5D\247}_\300\331.\211\244\326\352u\0017\334\364\266'\330\216`/\201s\315\235\347/\275\347\377 \255\267\207?\311kI\327;\327\007\020q~`4p8NP\2550GF\225\306\004\302\361U\274\226\362\024f0tTTk\345Rl\356\363\366\313\346l{\337\363I\001UV\003\003!\362\250\350x\260k_\347;\257\207+\007\251\325\306\347\247\3260\333\316\224\330\021\332ac\250f\324\177<\023\216\232-\334G5"
+	.string	"\304\247\267\370\332\021\214ha#\0222F\321&\312m5P\344\220m\017\377&\372\310Eo\313L\314\027\316\302\304\201\277\342\204\265\325Z/\342\323_\241\237\217\247\335\300\215 \"\232\023:\260=\262\303\330F\017\366\237\223\023\206p\264\261\003+\257$\266\274T\nC\005\352\225\250R\322\250\021W\n\345\224B\255T\\\247\216\245\352V\252\223I\207j\271\272\221\003f\235x\255\016\205\305ju\\\b\273\271\224\033w\017\343\247\3751\035f\270\210\376Ge|\261-\243I`1v3A\366#\226\")\332\024N{\227\2154\262"
+	.ascii	"ex\321\"=\032$ \240\242\231S\017\265\366T\002\207\303\003\211"
+	.ascii	"}\343\0266\350\262\206\246\306w\360m\216\003\3159\027j\n\353"
+	.ascii	"\f\242\f\307\230 \311F\257\261\270\246_\263\177\330c(\304\013"
+	.ascii	"\004\205\027\254i\226\216\024\256B.\333\b\201\341\020}\360\247"
+	.ascii	"\351:&\310[\325R("
+	.text
+	.section	.gnu.lto_afatfs_feof.110.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\345\b"
+	.string	"\246\321>7@\217\322\001O\265A\343z\020\274b\215\212\204\036\276\211:\250j\264O\252d\255^\237\253\243<\202w\350_\371y\214\317\"X\377\001"
+	.string	"\356X\277\256\211D\262\211\224)\005/"
+	.string	"."
+	.string	","
+	.string	"\320\266\0176%\233\376a\2600%(*\220\224\335/\352\305MO\223\177\330\027N`!\253\326\351\t\240\260\273\316U\213\342\326\333\316\330N\260\255\022\233\226W\305\275\330.+\266\262&\220D\303\366m\227\354\213\355L\373\033\347(\335#=`\327%2\262\373\031x\263\035\372;F;\334.\240=\037\251\005\356\356\001\261\355.\202\337\021!\261\275\016}\222vx\035\310\360P\031\263\277S\252\205\375lw\327\3522\274\367g\232NM_\013\036\006\320'sG\323}F\234O'4\321q\"\007\212!\020\247!vD]\324d\3149xDq\304q\242x\371\366\206J\200\322\224S\257P\225E\345\245\036\036\013"
+	.ascii	"u\261'3 \f\273\207\263\240uD%Gi\202.co\227Q|\2520\246k\222\001"
+	.text
+	.section	.gnu.lto_afatfs_fileOperationContinue.111.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\177\004\225\026"
+	.string	"&\345\211I\240TRc_\317{E\267N=\261'\3101\024O\261\311\321\212\310\2231\274V\032\251\261\252\377vU\036\322\377A\263\">\352G\217l\314+\350\375\260\032\254\305\350\361V\317\213\220\374\t\237\262\336\265\215Y\343n{o)S\nx"
+	.string	"k"
+	.string	"t"
+	.string	"\266\227J\317\355\275`\215\371@}\335{m\266\304y/\251\321f\251\f=M[y~\357%Q\265\"\255EJIt\232]'\370\324H\026D\263\206\232\316\037\317\340D\224\222\b\206$\024\274I4\3443\302C\017\355\307s$\037\020\225\001\005\235\314\202\344\013\316\254\211@\270\005\342\344\267c\246p\221\350\372\361,C_\260V\031\314\275\327\365\347't\233\334\276\314\366\002\333L\020\226\002\214!<\025\211\355\335_\340\244\367^\005\276\013\r\033R\023?\375\034\364\347\355\217'p\005\344HX4\352\324\245\215\354U\253d\337.\227\313$\266I\366\215\277i\253k\255\376\211M\001\f\002\022\361\343\362\336\240e\330M\236V(j\266_\355\023_\344\335\230\363"
+	.string	"\367&}Q\335\213l\361K\372\323\310\247\240?\323\243\240?\315\013U\254"
+	.string	"T\330\224i\225~\370\311\231q\313\357\221>1e\371<\320\036\023\251$\261\305\225\217u\026\341\360s\230KT~\225\005\326\360m\324\243^V\020\323=\222\362\247\354\225\336\333\273\360\247A\177\262\300\334 Y\037\224\367\332\217\262\355\365\013\323\245\353\273\310{\340*.\260\216\331\266\360\0304\003\226\254;T\206\237\002\204T\313\241\013\n\254V\031\341*\262\306A\0372\027r3\246q.\273\231\233\333\f\256\246\303\356f\323\345l5\271\033\215\rg\263\263\271\030\260\016\203\214\215\355F\247\263\261\325\220\3670:v\307\227\361\233\367\336[\322`\351C\254\346 \006L\353\bM\345A\214\326\216\257\204@~)g\020L\253\2524B\221aQ\307\223\fE\302\004\0267V\240"
+	.string	"n\270&\032\377\324\320(y\232T\323\332\025r\365?>\221!Q\222\307\366\374\031_\371!\277\224\275k\2501\214fjf\244\240$\005EI\0070\003\021!n\003\021\260<)\241\251\031Kyu\025\t!h\n\355$ )\223w\227\222_\220`\300'X77\234\017\252\327A\007$\247\337\004\021\346\021\254\237\r\016>9\304\330\227\320\345e4\207\343\262\006y\277*#\322\240\006\223\005\\\256\240\347\n\270\374\332EXyo\353\227\210$\006\372\007\3119\307\224L80\213?&\254-|\f\030\035\221\242\2244"
+	.ascii	"\312\305\265y\3547N\350:\210\022\336\024(\326\357XA%|\013\266"
+	.ascii	"F5\376\023+&n\"GJt\365\021\240\\\253"
+	.text
+	.section	.gnu.lto_afatfs_fileOperationsPoll.112.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`h\001U\016"
+	.string	"FZ]D"
+	.string	"\257(\035@;\t\b\375\275\307\207\250\315\267X\340\351D\357-\354\360T\3425\257\276[\321\211X_\327,Y\376\263\301\0322\332\t\322\213\252\252j\347\367\337\210\200\274\f\235\337?\243u\364c$do)S\nG"
+	.string	"F"
+	.string	"L"
+	.string	"\006J\226\343\220\231\251"
+	.string	"\303bw5\315`=\374n\230\245G\250Y\362\263\016\325a\212\245\242\363\270G8`w\003x%0A\242\274S\302\r'\327\177\217)VL\347\235<\263\216\335uv\236\311\215\3356\311\266\307>\207\366\307\245\252\330\377j\212\235}u\347\323\307\360\250VP^\202f\367\302\353\305\266\242\t\r_\335~\213\377ys\017w)}\345\023_\223\275\205\0262\256\025\273\313y4\007\306\243\306\013`\217\360\004\260\307o\\\262S\004\252q\022#"
+	.ascii	",\341#@\024,\b]\204\203N\210\353\2773H\261h:\024S\276Tw\227S"
+	.ascii	"g\344[\016b$kvM\357\354\3550 \0335\273\353y\371\207\221\277\362"
+	.ascii	"\350\b!\371\356\321\017\301\036m\221\t\371\316\034\226\016-\022"
+	.ascii	"\345\002\241\033\324\031y\220>\036\240\017\221\321G\333B\332"
+	.ascii	"G\350\363@\003\211FZ\347\2007\b\rD\032i\333D\332\346\333\177"
+	.ascii	"5E\365\243XP\264Lz\212\252\342lF3UWr\236\212B\360\324\273\274"
+	.ascii	"\270H\322\305!\334xj\246\002R\254\030\n\030N\371\n\" P\202Qn"
+	.ascii	"\320\003u\366\344\320z\004\\\245\201\356{\327J,\263\213\336\330"
+	.ascii	"\376\256-\226xx7t\2410\300G\224W\334\333A7X\310Rg\370\345\305"
+	.ascii	"2/\3550bgy\2409\331\3164Z\371\205X\231\331\270\361\206\\{\333"
+	.ascii	"\006\004S6]\364\t"
+	.text
+	.section	.gnu.lto_afatfs_getContiguousFreeSpace.113.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\235\007"
+	.string	"\242\01656Pm\323\001\300\004\021\340\203Db\305\024\016.B\237d\364\274*\032C\362\033\344\265\371\247\317S\235\212k1\031\331\2261\027\216\241\217\337a\343\347e\324\350M\244L)\2764\032\347cq.\017H\263\"\326\211\236\216\245\020\257L\213\232\214\261\205\204,~0,\213\226oO\255\222\254\030N\037l3\034d\033(\261\265\1774\\.vws\350\227\3769\370\030\207\006\205\362\335\241\037\252\016S\003<\270\\\261\277Qj\205}j\225d;\235\272)\231P\334\204\262+\261rZ\022(\222a[d[\374\215s\210\274\035@p\036\301\310)\"De\367\213\230_\252C\352\002\325\241Z|{n\376;\216pbJ\351\274\321\023\300`w\235\2357q\353mgl\027\330\326\b\n"
+	.ascii	"u\331\233X\350\235\305\360\205P\362\022\240kxo\204\313B\220\341"
+	.ascii	"\256\230\332I\006"
+	.text
+	.section	.gnu.lto_afatfs_findLargestContiguousFreeBlockContinue.115.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`!\f\025;"
+	.string	"jc\330\025DP\236N\007\374\365\306\034\177\217\rL\213ty\356\244\234-v\202\252\210\2119\016\205'\253\241\324P\357\002\362\270bN\361]\252\020\0016\360\200\247_K\013\320\034~g\205\203nA\236\365\222\336d\357\235dJ\001O\001/\001H\001o\313\360,M\204\233\366=\327dt\273\026\227k\237\353\027\356m\030\335\352\243\341Y\332\271\270\031*\035Z\316\371uvK\3342i\345\226\273\216:\310\b\256\t>\216[\036\263g\2359\221Cr\266[\320h\207\353\227\206\277-\327\034\227\327#[}khJ\327\331\357\266\321n\305\257x\264_,\313$1g#O/\036\334\226YI\244j\025\\g\275\255\206\347\036\331s\020J\327"
+	.string	"sv;r\266!\270\316\266\253\371\232\215\256\312p\243\351E$m\202\365&\230\263\233R\322\203ZgWG\266\316>\222\036v\373U\016"
+	.string	"y\004\372\361\351\3411\276E\242\0334l\331\365qU\373p\211\351"
+	.ascii	"\220H~w\216e\016T6\227\004\377\254\023\364\274\330\\\r\027\331"
+	.ascii	"\352G\336D\315\260\017\221\221\036a\336\243\206+lM\022=\341z"
+	.ascii	"b\036\"?7V\2437\225\370\353Q\337\260D\257NV\227\017/b%N4\003"
+	.ascii	"\022\304\215p\ti\215{P\202\024\273n\260\356\017\017\032\002\326"
+	.ascii	"\006\225\335\231\271\021\256%?\374\341\255\203/g\213]_\276z\371"
+	.ascii	"\257FO=\257\236.\347\032\224\346\310\237\3279\326\352\262\302"
+	.ascii	"x\270\224sn\234\325\325\303;\200w{Xw\317\350~;\335=\302\367H"
+	.ascii	"\260\3616LF7\321:\353\357QWp5\035\364u\370\320\306wewI\332\207"
+	.ascii	"6\025ge\006\275\304\304\204\355\356`g\266La\037\332\3701\306"
+	.ascii	"\236}\331\n\275V\257\017\355A\265\275\270\377\261we[\364<n\242"
+	.ascii	"~V\330N{]\237\3602J7\347\034\241]\352zM\355J\234m\247\025\330"
+	.ascii	"\263V\264\316\026\275\3279\202\"]\242<\331\332\232\270\260\333"
+	.ascii	"\315\211\037\332\355\276&\247%\247\177\314;\311\267x#\271\270"
+	.ascii	"\033\270\234\367\221\213\333\350\305]\344X\274\211\274\315;\351"
+	.ascii	"n\336\006\212\270\013\270\2357\001\307\363\036rq\013\271\270"
+	.ascii	"\0054n\244\213\373\350\342\366qq\367\270\270y\212\270\215.\356"
+	.ascii	"\267\210\273\350\342&\026q\273.\356\241\213\273uq\263D\334\253"
+	.ascii	"\213\373]\334x\210\333\035H`\362\367\345R-9\363(\034\314hX\273"
+	.ascii	"&.\347\276\305\335\316\035\317\275\315\335\315\035\213\017\273"
+	.ascii	"\275\375\213\217\231\362\274\306U20.\246\3370~g\303\361Z\272"
+	.ascii	"f\260\237l\365\266\345\205\312\315\265[\3764\3052P\030\233T\020"
+	.ascii	"0\206;E\347u\335\001\006\220S\254\352\320\033\277\300\373U \201"
+	.ascii	"7>\2072X\325f\034\177\237\300O \304A\200\274\277\276\371\265"
+	.ascii	"\025\337\375\241_\320\346\352I\374\342;V\325\350}\n\013\013\013"
+	.ascii	"}AK\334\0208\035t\362\301UY\005\274\321\257\323\253'\3161}\001"
+	.ascii	"\373\300^M-\340}\214\340\223m\370\3563\270\303\2526{t1\271\303"
+	.ascii	"w1\256Ap:\370\007\364\206\312\030\243\333y\037\352\335#0\017"
+	.ascii	"\022;\374l\272'\030\330~7\006\274\245\305TDF\230\025\307\227"
+	.ascii	"-\373\355\017\350\200q,1\026\373\0168\335#\374:\320\205\003\256"
+	.ascii	"\370\320\354=\267\007e\b\361\241\215\255\032\337h*\024\3651\263"
+	.ascii	"q\263\251P\177`\270\332^XC\356\354N\373`SKL\003"
+	.string	"\321j\264\316\252Y\277\305\325\036\302\377\355\202\033\b\364\345\334\364\254\356\016^g\351,\035&\017\354\3139\177h\273A\204\300\236\265~\362\352\231\215\377\377\273\\=\235-\302\341,\001\361\027\237L\333\244\271\237{\324_*\\h\230\230\320}(\237\367\022\323\313\356\312\362\202\246\355T\027cJ\377\316\262\230\233\3667Musf\372\263\235D\353,\321R\236#\215\003\354\353n\252\373\363\201\230\025\256\006\312\023\030\305\t\354$\303\205r\006+\345\224\302I\212\310\202jE\224\023\007\030J\fNT\312\024O)\242\224MG\252'\250'\016\357\224\f*%U\b\026MRJ\247)c7%M\251\240R\252h\212ZN)\225^<)E=)\241\224\232\244\246\224\222\022\364\013\030NRJT/^H)\275nM\377\261\036b\373z\333\253\332!\265=\244{U\353Q/\026\221\222\301\252#b\257j\221\215|\374\316-&"
+	.ascii	"\347\201*4\016\371\320\3669w\007\235\344a\325\001!}\257?\307"
+	.ascii	"Oz\25555\246\004hT\272\244OC\213:K\206J\347\344\343\022\247y"
+	.ascii	"l\360\307Gz'<z\241o\360=kth\271:"
+	.string	"\003\020x\345\006\350\241\355\313\366\350\237\tg%\352F\350\217\177\364>\347\353\032\330^\224\017\316\316\231\303y\376\370CS?>\006}:\302\374x\362\207p\201V|\036*e\031\205)A\036\025.\r\254\233\002~\342\204)\001\231\320\264\357LP\331\235Y\017\321G\365\272-\340&L|\336\343P\337\322z\236\347\211\236msu\246\304\254\347\235\316/\t\031\317;\031j\226\2646|\304\223Fwex<c\325\2500yx\f\252\020\214\220\212'\2304\360\215\3056\024\221\205\341'\223\263\301\311_\243T\346\240)\360\001\200\354\250\2010\345\2302\210HDD4\005I\322\030\220\002\021)\243\352\021\3404\307\034\263Q\230$Y6\003K\007>\030\337\327\237J\342\307 D1\260\364\265\350\276.\361o\341'M\242\315\240\225\205\234\017R\f3\030\032\252\372\253\213I\031y\226\233$8c\207@\224\311\202J\212\r\331\371"
+	.string	"\311`\025\226\304\302\013$\307l\247?.Y\257L\021{)>:\362\215C\307\262\333N\305v\315\346\225\206\313XK\256\250\33428\025J\235\267\212E\304@\372*>\026H\352c\275\242\204\333\324d|_+{\273\t\222\374\313\350i\310\204,D;\211\273\214\255\025\327n\202\320\t\027\n\377\017#w$+#\316\025\331Br\334\313w`\353\201\235\376\375\373\333"
+	.string	"5/\340\004\026\002\376E\245\032\304\034\365\332\350N \264\376\b-\303\246b\006\301%wQ.\233l/T\274\316\330\203\356\326\347>\205.$b\340\227\016\211\353G@\375\323\225\332#\334\021\374\315\317/:\243\3718\031K7p\334*\370\226\244\375q\270\311\213$'n\372!|'\273\237\2311\365\213\263GJ\221\235f\262f\343q9\204\034\\\304<\002\217{\004\b\265*\204\030hL\353\254RiM~\241\326u\272r\363\246^\025k\244\326H\352\025\265\375\200\233\364]\362\362\362\311\331\334\177\327\347\344\313\313\032\303\372\001(\2300\243Wi}i\301-\"^\001a\323\210\356\221\fd\034\351}\322\254x\232\312\206y\231\376B\261]\253\342\241\017\336c>B\350\004\274\301-\027*\232\032c>y\002q\b\344\317\244A;!\322J\372Z\272.\325,c\344\222\177<\331`/"
+	.ascii	"\007\020\337\326\005\006>w\332\205\224\201\376\310P|\003_\236"
+	.ascii	"\273\202-_\315\214\301_okOq\226\032"
+	.text
+	.section	.gnu.lto_afatfs_freeFileCreated.116.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\271\003%\027"
+	.string	"\006(\221J\260\324Uc\264\344\362x9\031,\363\310\223\343\341\035.\300\335\323\t\023\374\032\313\312\333$6\227a\201\005\2777TH>\324\237\330z9y\3475oX\275\351\016\264o\224\344\304\023x\336^\341\002>N\310Yx\333\275\267\334)\005z"
+	.string	"u"
+	.string	"\201"
+	.ascii	"C\367\026\031\030e}\352\342a\352\323\365%\352S\347\354&\001\234"
+	.ascii	"[\203\242\004\244s\254\272\367\306,\212\347\336ZYj\212\3323\347"
+	.ascii	"\023\337\332\361j\336:{_Y#\256\242\n|I=$\274\034\024\266t\"\352"
+	.ascii	"G\2353\275\017O\357(\t\017\007=p\357u\361nN\213\226\364\220\312"
+	.ascii	"\377\020A\002]\240\004\2268\361\347\016Ow\236\254\224{\257\317"
+	.ascii	"\035\217\347\006p\333=\266\035\3306\031\276\f\017\2705\305\323"
+	.ascii	"[\nM&\253\241\315yu*\201=\"k\032\365\2646\247\310\225\021\352"
+	.ascii	"\3464b\027uG\257\375\331G\257\375\261\321\323kz\232\365\341\177"
+	.ascii	"\242\247\037\340\305$\202\2434\264N\305\033\342\352\310M\246"
+	.ascii	"8V\370/~\234y\f\277\250\242\222>\341\275\3670n\264e^\364\203"
+	.ascii	"\246S\360\336+c\317\330\256\247w\331\376i_x\240\334\2074\027"
+	.ascii	"p\357\017TFW\370R\322G\217\0271\203\202S\026\236\204tdT\200i"
+	.ascii	"$\264\223Z\355\215\276\360\0356\023\2431\274he\2003\\\207\206"
+	.ascii	"\327\323\0347>=b\"uN5\244X\366g*\237\245\013\325\376\330~\246"
+	.ascii	"\262\354\013\312\370\364\243e'\232\255C,\373\343\021\230\bj\341"
+	.ascii	"\003\032\246\254\273\2506\313\203\\`K\033G\322\354\r/\347w/\352"
+	.ascii	"\323\017\315\246\252\251\003{\310%jSoo\256}\206m\275\3676\b,"
+	.ascii	"\034h-\250g'\270\226\030Y\313\fF\006'\213\325h1\030\232\354%"
+	.ascii	"6\273\341b'&\256u`\271\305bj\265[\314U\2649zW\220\222VCl\254"
+	.ascii	"\256e\177\266\r\2346\204\b\347w>\361):[\323C*Y\254\366\347S="
+	.ascii	"\357\361\007\261\004\252\320\021J\177oSW\273c\243B\\`M\342\023"
+	.ascii	"(\251\204>\241\257\242\336h\t\017\242\002\365\264\f2o\004'\\"
+	.ascii	"\331\304\004\344<\230AUS\247\361\007I\250A<\242\214\222F!)\232"
+	.ascii	"$M\245\r\260\002\221\241\253\035\020X7\"\"\211\036uKC&\266\004"
+	.ascii	"\003\261^|/\223\350\354\270N\370dX\037[\fO\017\022MY%\273h\224"
+	.ascii	"\332A?,\004\221b\016\034\013F6\205i(\fl&\345\205\342\301\316"
+	.ascii	"2\\\342\027\272\267vny?\323!@\253<P)\020\t\343\n\317p&P\257S"
+	.ascii	"Lk\020b\236\343\354\026>\026\361Fb\277\216/\224\372\220\231\304"
+	.ascii	"\361\355!LJYO\232E\376\241\321Q\213,*\210\021\310\202\027\257"
+	.ascii	"\030\364\345^\005"
+	.text
+	.section	.gnu.lto_afatfs_initContinue.117.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\270\023uV"
+	.string	":\215\234\037P0R\322\031\016>\367R\241"
+	.string	"\240\216\242j^]\324\327\343K\024\"2\360\001\030\351=xm\342\222a\263\226Qw\272\356\341A \315"
+	.string	"G.f\347Cd"
+	.string	""
+	.string	"\020\001\330\001\230\300~\020"
+	.string	"Y\325\032p\007\263x\002t;\263*fBv7)\223\f\343\001\277\001\353\001M?U\356\364\341\310\245\374S~\264_\355\300\335\357\177\370\225\245S\331\340\327\352\026\266\024\345U\232Ne\231V\265\365\313\275\017\207\333\341\224\"PeCb\376}q \374)\245H$\205\246\"w\2364W\262\225\002a\223\223Ca\341O\266c8\263\276\355n3\276\334\263\312\337\335\214]\026v\207M\316\266;\\\027\276\\\326\241jrI\222\251\252:\374\271\353\302\356\360'\360eg\362\265\035\362\360\264\364j4\256\346Po\305\307\274\312SU4\026\302\237D\300\233\375,=\032\f9\352\234\372\254>\346\215<U\215b\300\317\205"
+	.string	"\355>\350O\341y\320\237{\261\247'[1\354\303\334\312SU\025\305\317m@\3703\335\025\0034\245>5\300\254Q\265\266\266\r\013\344\364\002\004PD4TB\b"
+	.string	"\022A#\200~D\370\364\360\354\350\344\340\334\330\020\20754\302 z\002\233\323\375\021\016\273#\362\351\002\034\301\021\205\254/\200\242\036\230\310\006\335\020\333\031\227\020j\003\313*c"
+	.string	"p\256\332H\220\215q\020\005G\216M\216H\035\037\021\\\321\225C\354@a\377\t\253\362\242\271\254#,\302\b\373\024y\017\021\266\"\314#6\204w\300\262p`\035\246\026$9.\212\374E!\353\303\271\t\256X\273\215\217\023\201\005$\263h}.\213\013\350\263%\b\230\273\371\340\341\\V\022H\244\252\352\301\262zp\rp\201\251\225\213(D\025\227\257\275\b,\213\007\323\024u\345h\273\360\003\274\2674;'H\035\017n\r\221U\214\002\037\344K\332\347\262\332\200\021d\321*\373\332\371\nI\305\247\023\263\035n\360\372\261\243\0069\205\006op\211\275+\253\215\006\230\200\326\273\006\251u\016\256PUu\371\210\314\361\035\340\273<\266\273)\354\352H\005\301\336M\317\204\301\376"
+	.string	"/\213\330\220\211\227\262\032\277\243\037\342g\243M\264;\001\333(\n\257\316\326"
+	.ascii	"\317J\037\335\337f\246E\216\246\225H\350.\013\256\201T\025\206"
+	.ascii	"G%\214\017\003\335}\301R0\242\340\326\337\310\222&L\261\304\316"
+	.ascii	"\257\007\265\273\366\\\276\353\001?%\t\335\261z.\274\267\260"
+	.ascii	"=(n: %\007+\301V\356\t(\260\017\226\346%\210\273w-\270\200\177"
+	.ascii	"\0046\221\024\332\273?\300\203\322\267\005\305M\025r9z\240\247"
+	.ascii	"\201r\277+\255\213\024\013\261?\374\276\323|\251\240_\236\311"
+	.ascii	"\006\302\343\276\210\356r\320\001\377\310\315mfbrU\375\264\227"
+	.ascii	";\t\275\2575\357\211\377v\321\242\376\300\030:\266\263\314\336"
+	.ascii	"Lp\n\007\007\032Y\230\336~\017=\313\333\2179\307\f\t\263\027"
+	.ascii	"\003\214\373\362\262\377\322X\276\354\366w<e\343wG\026\306e_"
+	.ascii	"w OL#_*\220-\373\271\025#T\325\247'\367I\350\317\242\025j\035"
+	.ascii	"\263\007sw\305\374I\241\227\232\245\242\251(\256D\345\301gv\327"
+	.ascii	"\203kI\022\252\252\352\300\036\313\263\204\260'\362sGP\342\037"
+	.ascii	"\225\320"
+	.string	"\237\357S\007\277\273d\231\031\0247\367\007\252\252\252\002[\371k\031\003\306\253[\271\347s\327\r\035W\266\205\354\022y_\020y]\334\360\"\021y[\330\360*p)_\243O\371\2460QD\303\033D\303;\202\310\013D\344\375!\362\212 \362\372\020y{x\210\274;D^\035\"o\016\221\027\347j\337\033\"/\261\206wH\303[C\303K3\344\025\2367X\303\213\022y\317!/\360\274]\303\3134\274\257\240\2053QtkL\253\266CSq\004\375\204\372A\005\371i\245Q\373\364\253\234\267l\234=\351\321\361\213hO\3734\320\337\037S)\n\341z\372{\253Z_\212\336i\243\336y\322l\032\233\354C\361pRR\253\253EI\261T\274\245\350\303\035E\r\315=\233U\252\211\210V.\367\360\331~\254\273$E\252\336x\256\276\210\272\350+\027\275\323A\252\246\336N\2679\351\201\r\250\356H\346ET\247w\372"
+	.ascii	"-T\311\234\306i\235\036\252\253\332r\3219\375\265\277\360\303"
+	.ascii	"\363K\263[\222\201\362i\345\016X\231)=-\244\237F\241Hm\343%\255"
+	.ascii	"\013\333\246O\254\226F\t\323\220\372l'\200\206'J\222ef8\315f"
+	.ascii	"\263\007N\323\b\323|\243JF\221\310\263\302\342i\345\326\275\210"
+	.ascii	"\022\343\244X\210)>+:\260\233V\261Yje\342\212\313R,\241;2b\037"
+	.ascii	"\b<\276>3\275\357\220\364#\246\205\267\267\356\355\f\037\340"
+	.ascii	"\335\024\231\352\340\037\207\315mggrQ`\312t\032\340/Y\207t\354"
+	.ascii	"&\207T\311\300\235\222\031R\037\377r&&'\325eI\316\002\374e\332"
+	.ascii	"#\365\341\204\007fE\340d#\351\017\006\356T\225\352\307\224\006"
+	.ascii	"!\025\t'~~\311D\322\261\241;U\205\372q7\r\302CR\345\t\0346\265"
+	.ascii	"!\275AhI\031.u\313\313mH\362\251\341\005<\273\260\275 \376\266"
+	.ascii	"\263\0368lu!A\230k\003\201\361\203\031\266wS\323>\270\216d\240"
+	.ascii	"\270I\3235\r\fC\225\214\342\346\362H\332A\323_\373\t\035\376"
+	.ascii	"\362l\n\340\335\273\245E\322#\374\343\002\373\251\2030\002GL"
+	.ascii	"\223\240\n\364\335\316[G\3140\321\243C\302Zi\022\241;(\233\346"
+	.ascii	"\300:\322%=^?\227\221\234#\025\273\333\b\351X\n\266\247e\350"
+	.ascii	"O\005\372P~\002\211\033\230d\231\331)\307\227\034\266\362\314"
+	.ascii	"\205\001\213d\304b\002\f6@B\322\300\305\320\211I\311\251\211"
+	.ascii	"\310"
+	.string	"$\303\251i\006\n,JPAFM\323\f'%\247&\224i\311)\206\214&T\006\323\222\005K%\240\033\303\250\311\004'%\023b\250\340B\223\322\321\322\tG*\234\240\224\302Q\f\246\246##\023\273\264\202\f\246#\247\245%\246\243!\032\324[\310\220\256O\016\252\243\026\006\240\252vI\220\307C\334\317\177_\264\2509\001Z\211\204\326\200\344\243\334Z\375V\276\023\343~\250}y\001\004\351\262[\367\372\306\201\374\260\013+\332q\243DQ\337\364\325\3617}\232Y.!J\302\025\324>\222~zD\0075\360I\363H\022\356\030\321\"\254u}fCE}V-\207p\300{\243\025\364\313\226!\035c\300\253cH\225*Z\313x\305\210\205\177,j\326\243C\312M\221i\226h$\322Og}\255qao,\0306\264\254{\t\360PC\250\225\373\223\214\001J\220\211\346\351+>\r\224\247O3k_\216\224R\004"
+	.ascii	"\024dF\310\332\252k\254VH\230\350\263jm,\255K\006\f\324_6\225"
+	.ascii	"\221\371\343\325S\305\363\265\224\221\357v\035\225b=\256\241"
+	.ascii	"n\334\202\356\032\351\214u\374\243\211&\242\352\247=S\374\371"
+	.ascii	"3\3621\025/\277\024\213\335\274\206h\020\326*bfx\177\333\234"
+	.ascii	"\225\240\033\310p\340\032\321\312\355K\032\272[\257d\205\022"
+	.ascii	"\266g\307e\370\366H\274Y\275\035\311\374ta2cRe^\230#\031`\213"
+	.ascii	"\376y\301\265\272E\331-\301^\264\210n\321\313T`QW\326\370\205"
+	.ascii	"\303\024\301\274\350_Y\223e^\212\267\322%\265z\223\273\024+\002"
+	.ascii	";\021\215\306\255nbfa\270\256x\200\027\227TI\327B\223\035Fx\274"
+	.ascii	"E\216\031\207j\255K\261\255]"
+	.ascii	"\343\030\316RT\341e\324c,F\276\003\200H\261\206\256\300\035\210"
+	.ascii	"\244\211\032\221d\331\026P\013\336W1\366\031\207\350\201\203"
+	.ascii	"\250Q<\006\231R\206FD$I\n\222\306\201\005\304\030\346\234\274"
+	.ascii	":\021\020"
+	.string	"\2612N)\"\321\244\320f\201\004\324\032\361\023\242\254}\020RH\361\025c,\003z+$6d\306\270\270\026G\023\342\b$\277%\356\226\201\022\022!\373\333\374TY#g\007|q\331\222Uw\242=!h\013ag\272\216j\250\341\241\316\345\374+\316\364\334\026\235B\265\234->\374\251{\370\006\322\357 \372j,\301\216H\321\333\202\005\br\236L\251\343\236\362\351\204\251|\267\325\202(\013\203\016[\215Z\306#\373\0011N)i? \023\314\235\335\270t\374G\367N\003T\3250\024l2T\313\0355\036a\225\364\253\207;V\330N\037\003\024\017g~\344\312g&h\215J#\245\234gb\256\200\355d\026\317\276,\313\322j\325\362_\322\006\207\026\254?A\364\251\206p\260\2317i\231\221\350!\275\236\223\026\245\220$\232]\033\334\210Q\362\2121'\300\315\214\310\220\202\n\t\3535_J\3322\350p \351"
+	.string	"f\202Kb\222O"
+	.ascii	"\2735\\\366C\322\321\321\301\352\303\203\301 .\r\211\034\021"
+	.ascii	"\263\2160FaL!}\241\006]\345\351\026\267\242\200.\002\201\b\254"
+	.ascii	"\317\272\006"
+	.string	"\314\026\013\357\346/\224\215\371\271\341\273\023\227\032<\217z\313\213\307E8\342\242\340v\300z:\203\\\302\256p4\360f=\337\342\007*y\205\032 w\200\277\330\341|\3001G\004\371\224\222\006'v\254d\361\350\t\243\263\016\202>\027\004#\243\320\253:\205JJ:\225\342\212t\261\231\022\317\016_\3375\243e\024l\366\277t\260#\225\333\3709\301\204\226b\f\253_\273\266\002s\t\2468\272\302\325\333\r\366aD\372Q\354\345h<\303\260n\305\214\236\314\320f&\251\tt}\t\031\024\245\031\024\243\233\353s}\201Dt\007g\024\304\214\354\306\0038\225\023,\025]!\236`\365\232\343\340\016\013R$\212hr\264\343\265\360\244\217[\254\234\215\321\217J0\375\320\237~\321\246\206\301\322\346\234\357\205\003\301Cz\005S >K\004\272Xy\325?\203\370\337\323H\027\200\\Y<\025\303\033\001P/:u\b\270B"
+	.ascii	"A\306\207\342\360\275E\2355P\301P\341\201`\270 \217\213\345\356"
+	.ascii	"K\224m\365\024\002\023\376\343}d\217|O$\r\020\242\251Vh\003\377"
+	.ascii	"\223\374\032\rQ\252\341\367J\033\223\341r\351\241\307\312)\320"
+	.ascii	"\0374\314\f\254\265\n\362\242\005\fa9\222R\022\231;4\222\024"
+	.ascii	"u\335D(\371\352\317@X_\272\002\303\023{\"\231;\335$\272\225\b"
+	.ascii	"U\007b\225\237\336v\207\305\210\315\325\361r\232\020\302\265"
+	.ascii	"\210\243\343\\w1\2073G\276\263L\264)i\033Z\210\254\\\003\241"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_afatfs_poll.118.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\267\001\265\020"
+	.string	"\226\236nG\360\320&\035\336#\366\377\277\007)\334\r\b\254me>\223{\237\373\034\271$+\276qt\001\221w\243\025l\217\03211g3\231ja^d\333 \271xb\373\362\322\206"
+	.string	"\345\035k\246\237\\\351\225g\215\220\275\367N)X"
+	.string	"X"
+	.string	"Y"
+	.string	"\333\3537\233\3304\036\306\254\001\033\257\r\"\216\335\345\246\211\233<\253tJ\023_#Q\330\210\235\027\310zV\340\025\304)=\320\"\343\303m.S@\024\232`\206\313\317E\227\234\032L\304\230\002j\240\243\335\275\314e\007\260%\245F\332]\313\027\270rk\267\375\331\216`_'\246\322tJ\037\200\003\237\037\226\207\330\331U\031u,O\205\001\363]\334\346\261\213.\371\214'\013\216\212\226\231\335\335\036\363Y\274\306[\213\f\337\225=\207\230\030P\320n\030\"z=\315W\224<t\316\310\025.\250\271"
+	.string	"\2053\037\257f z\035\235@\366J\357\221\275\332%vs\262XPT`t\302\370\343t\212\324\350\270\244\220/\372t\034\347\210v\267\201\377\3427\024\374\023\257Fy\325\367\346\305#\250q#EK\214\346D\216\037\307q\3074I\366)R\343\343\222B\326\244\255\272 \377\372\374M\017\t\236\326d\331aKN\030\373s\034\307!\317\027\007\035\352\004a"
+	.string	"\206NB*\344\363V\246\356\301J\325\235*|\245\316\303&\020\325\310\2524bJ\221\250J\234w\342R\247\022\2123}*\016D\201=\013\335\307\255<\357\343\266\360\344t\347\313\326\023\203\347d\266D1\353aK\354\202"
+	.ascii	":(\202r\004\261\344\020\335\335\315\004H\333\324]\346\244\326"
+	.ascii	"d\325\213\023\034$ 0\002\242\314\341\016\\\344\250+\310\004?"
+	.ascii	"\363\253\335.vV\261\365+\304.\345\262\371p\301\034\004\334\021"
+	.ascii	"\260H\025rS\330\023f\004\236L\321U\357U\366\365d\260l\260\307"
+	.ascii	"\320\262]W\321\253\\\274z\216\\\370B\177\226\257\232\020\272"
+	.ascii	"\347\304\263\324\206\001\265ul\374m)\003"
+	.text
+	.section	.gnu.lto_afatfs_getFilesystemState.119.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"E\007"
+	.string	"\362\31525Po\322\001 \371\252\206\243)\206\035\036\b\\\001N<\237\005\337\360\241\202\244\241\326\273#K\216\021\226X21Kb\b\fs\255\240P\033\306\356\203\221M\244L)\2664\330\306Sm\254\316\007\253`\344\300\016\247j\200\326\205AM\306\321\201\341\202\236\030/x\351\366\323*\311\212\3214\302\366\303I\262\200\335=\360G\336A\370\035\177\376\200\362\333\237\017\242\376R\005D\264,\331\235(u\303\376\264J\262\235NE\320\250\3108\207\262kQjY\225w\342a;d_\374\217\203\204\234)Hh\030\005+\024\023%,\273\035\304\234\200\372\233>@\375)\307\263g\346?\344\013&\\\3126\022=\001\022v\327\271\215.n\275\355\214m\003\333\\\t"
+	.ascii	"u\331#Xh\226\305((\004\350\032\336\033\341\262\020d\270+\246"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_afatfs_getLastError.120.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"=\007"
+	.string	"\362\21525Pm\323\001$-3\2324\230\256\245\362\237\305|\341\261\025\211V^\2055\304\264\371\247\3177\247\342ZLF\346 \n\016\220\367V~\2542\026\322\370\275\211\224)\005\266.Y\206Se\254M'\253\342\245\211\033M\245\020-,\213\027\213\257\205\004,r\256\013\213\224\267\227VC\326\312\246\016\266\031\376\241\001\354n\201\357q\257\301\037\035\272\343\311s\207\276g:L\r\350\330\362\263=Pj\205}i5d;\235\212\261\030Q\\\364\355J|'K\002G2l\177l\312\327\370\306\307\332\301\303\326aJ\" @Lv\275X\371\300t(]`:\324\213kO\315?\307\021D0B\270\016\364\244\030\354\256\223\353&n\275m\213m\002\333\242\t"
+	.ascii	"u\331#Xh\226\305((\004\350\032\336\033\341\262\020d\270+\246"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_afatfs_init.121.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\305\b"
+	.string	"FP<8@o\323\001pb\213\004C\3527\037\200\350\350@\036\352\204\243\016t\373\240%\375\252\331\206\034\346\030\243L;b\"\210|\326Q\374R\350]"
+	.string	"Y_NJ\264\236\232\335;\245)"
+	.string	"-"
+	.string	","
+	.string	"\277\374\331.\0277v"
+	.string	"\006\243\242\204\334\335J5\376}~\376M\007\bG\340\247Faw=\303\021\351\246\267M`\373\300~@)\344Kh\246L\247=A1\037\332"
+	.string	"e\032E\024\264Ep\322\f\373\231\335]\323\222m%t\240\\\234\203e\327\"\025\263c\245\362a;\232\311I\345\211\3647\313v8\3116\262P\236@\346=\226\315]\364\b\264\354.\202\037r\021\317\367xe\b\320|\370\312\007Y\257\"\312\3166\036\347\203q\262\216\204\207UN\253\035\r\333j\326yuS`\356\201\241\253\037\216\353\352%\3563KK\276P+c\210\212<\257Yv\303O\002\016"
+	.string	"u\261'\023\332\201\006\216\013\001l\002*\251\201@\260\335\247$\035U\tc\227A^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_afatfs_destroy.122.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\321\007-,"
+	.string	":K\350\020G`\034R:\277\027\033\227W\246\240eI%\360\242\252\226\312\032\347\211\210\3646\251\336\004I\235\312?\225\356&(\370\267\320\236\nr\205/\033\f\031\373\322\310Wy\260|A\003@\027+\264\364\034\364\333\377\326\b!{'\031\371"
+	.string	"\351"
+	.string	""
+	.ascii	"\001\321|\3053\"\027\345\222\223sN:\333\025zg\217\036\324\236"
+	.ascii	"]?l\237\272\201go7\215n`w\337{.\345\320\351\302\270\306\344\034"
+	.ascii	"m\320\022zg!H\240\321\312G\237UAuP\033Z\344\344\034U\302I\032"
+	.ascii	"\177\215\276yWy\240\037\237\036\036a\020\370\363\365x-\273\016"
+	.ascii	"\361U\366\227\007\342-A\257A\316J\027\2569E\260"
+	.string	"\226\374g=\300v\346\343\002\206,q\273O\233\325\263y{\016\265\344<[VC\232W\270\022q\031\262\"\030\023r\203A\016\f\002\344\376\220\212`\375\270\257\315\352\207\217\333[}\332\254\262\326\0079g\251\313\373E\351\361\226\307Y\236\253\032e\277TWSw\355\365\370p]\320L\323\321f\245d\r:c\204\315\241L.^\203\252\2340\037v\244-+%\353\20293\273C\177s\\E\335\313[\3129\367e^a\275\001\274\373T\335\375\242\273\025\013\027S\f0=\033\006\343\227\235\315\242\256\251\322jtH\322\254\330\331\177\3071\303q7\304G\214\355\305/\342\365\326*\016\306\330\3139O\350\233\375\313\212\276\326\331nq\274g\036\333\263\027\017x\353\202\272\325_1SUP0v\266\262\005\200\017\375\315\202n-\351\320\300I]jw4\352bg\367q\265Z\2556>\322H\367\366\221Q\021\321\220\320\271~"
+	.string	"}[x\262w\020\370\363\035\354\335\353\333\274\366v\333\336fy\267\327\3666fo\337\003\330M\234\252\034=\316\344.\347\252j\235\314\306~yr\262\037\354\267[\254_\326@\262\237Tk\214\213o9\227_\371X\367\323\305\032\273\245\021ir\345\234\201]\375\260\006\3228\330\023\255\260\023\277\322\367\272\226\006~\305x\306\312\277\361\204\312\315\345\034\365\360\350\261<=K\237\035I\005v\330\242\3602\370\303D8I\265C\007\347M\\\\\035\020;/\244\251\266\346\033\302\275\366\204\360\257\305H7\037\336\206\0304e\323\342gQ\353\314\371\t\341!\234\244\332\375\314/v\270\027E\323\234\241\316|#\"xN\037\366\237\27084\266)\274L\320E\026\304\267\362|X\350d\316b\244\032\023F \236\206\0304E\303*"
+	.string	"\023\243\325\204\332\365\260\263}?Z\243\357h\242u\r\223\036\304T\275\266=\374\260?\307\032Zs\230t\037\246j\360 \256"
+	.ascii	"\335:s\374\345K\n\031^\331}s\352\2446\244l\021\356u\365\341\036"
+	.ascii	"\246\nb#|,\252\232\3332\270\017\027\341\031T7/\267-\315\250["
+	.ascii	"\355\240\333\027\321\256\270"
+	.string	"{\004\211{f\203 2\205\227\3357\363\202\300\224\271F\214\360T+*x\246\255\270GNK\216\311\243\351\254\270\235\261&Z\fW\342h&\022<\273S|\f\361\3004\347L\201)\306'\233`\0341\024Y\03054\025]\034\205\305\026\306\020@2\212(\2328 \217I\246\"\210\244S\321\310\002I,\016\237\222H#\n\266\231\0348\245H\022S05=9\021\225\216F\245&#\261\205\022\023\322I\311A\202>\272(\"\225\222\307#R\t\030\205\372\232\361\221^\233\273*`\322\237_\3316\271\273\001&\345\271\364B,\304\275\004\205\243z\3159g\240\002\327A\330\273L\233\364w\275z\344y\336QB\225W\240\377\255\325\315\315\231\253\201\227\355\204\214\225\345\017v6\020[X\263|\203fM\352R-|\201\361\342\303\303\310\013\247\243\244\3620K%\r\212ZSI\224\036\354|\2339\277\252<\330\331\322#\031"
+	.string	"K3\342\005gt\373c\0316\3343\221\226\242\360\362k\272\243\214\320\367VG\307\206\024H\204{\375\37500\351G\370\204\327\332\307\232\303\357\372\254gw\204?v\003o\356\2464\241]D\267\273\203\007.q\001\200\241\250a0\"\221\202\206FFDF\223$\035\220\002\021!\263:\006\021\300\2514C5\251a;\236\241T}\217\2315z\205\356\027\022\264\270 \256\301|%\3313c!\025j&\0016\276\335\005C \203?\346r\035S\026\224T?cB6\342I\004e\303\256\003\241;\007\240^\261\004\327l\370\335\3225\031\261\362.(i\231G\235\006\t\324!p\003\356\313\311\312\3215r\245\0301t\244a\320e\204\377\224\322\366\307E\346k\026E\365\301\006\004\244<\270\372"
+	.ascii	"\226\"\257z)\376oX\022)s\003\234?\0329\252\022\341\314%\374\250"
+	.ascii	"N\2729F\252\036\210\006\201:~Z}\031u\226/\330\335\216\335\211"
+	.ascii	"\311R|0\267\331\340[8@,\254ti\036\320\007\350lyz\217L\032H\\"
+	.ascii	"\215\276?k\225\322-\206\210\030\360\333\301\026_X\263\334g\364"
+	.ascii	"\352\024\022jv\354B>\022\233;\255\265\004\210%\325\257\314\237"
+	.ascii	"\232\207k\272S\034\356\246>\233\017vw<\b\376\377\260\021\300"
+	.ascii	"\242\212\246.dk\213\367Gu\225\t\370\250\224\301L\2037Z\307\264"
+	.ascii	"K\0215\230\031\027=\317\274RZd\307\235\304\037\353\344\002\361"
+	.ascii	"i\263~\001\230*"
+	.text
+	.section	.gnu.lto_afatfs_getFreeBufferSpace.123.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`r\002\025\024"
+	.string	"F\345\203J\300\322Q:\2424c\201\207)\3617!\\9jv\013e\242\372\225\225\203\244\324\230\327-z\235\013\335\344\005\013\037\244\365h~3s\203\237\226\200\232Y\024EQ\340,L0\3257\213\2624`\235\211\221)?\332>\331[\356\224\002o"
+	.string	"l"
+	.string	"q"
+	.string	"\265\307\032\371"
+	.string	"\361t^\200x\272 \034\362\331\273QR\366\024J\244s\245\314\347\375\201M7\244\2155OM\nL*z\r\r\034&\203\333\217\211\373.k\343L\242B\202n\027wN'\t\215\0179D\306\234Y"
+	.string	"\027c\303j\304\221s5\346\314\221Z\253\310x#\367\276S \335\022m\274]\242\032\324Z-i\243\316\255\272\355\036\333)\266\234\005\303}q\302\351h7g\367j\344\tQ\207\022^\036[\225\022/t\323\371\335\275+-\245\364CRxd\270]WT\253m\b\2446Q\030@\027\372w\227\366\355\367|\237\220\225f5r\020\\1\242\326\212\222:\275M\343\363\274\372N\366\252S\217A\030<\332Qk\317\344\324\tR\247>\212\353h,\203\200c3\036\b\362.\020\365\250\001"
+	.ascii	"\\\350\226\2448\353e\342\334\324\256l:\0349\270\231\034\3323"
+	.ascii	"H$\331\350\346\374\267D\2712\310\020\223\204\377Z\377\371\264"
+	.ascii	"p9\022\020\t\006\005\310B\356\177!~ S\220\215\271\271\031\361"
+	.ascii	"\373\032z\272\221>lO\270\321\214\001\240\355\330\213\\J\026\234"
+	.ascii	"\332\256\253\200!\340SkU\220\342D0\377\347\32412\362\264S_F<"
+	.ascii	"\375\342~\334\020\356ld\255\307(\304\300X^\242WN`-1\225\226\225"
+	.ascii	"\027\0130\025\226\253\305zi\251\270\260V^0\326I\211]\025X^\254"
+	.ascii	"\230\313\365b\255z\365\313cO\324\\Q\f\340\244\303C\223\315\316"
+	.ascii	"R\2333\352ITE\020\366H\223\323\255y\212\273\347\3756\234\020"
+	.ascii	"']\263\222HI\2022D|\326Z+j\356\334\373\376\035\234\360GS\353"
+	.ascii	"9\347\356\326l\004\247\253\3320 `\002)\205\267\ru\330\323\022"
+	.ascii	"\030qh\274o\224\305\023U\316\213\215\0245\001#$\002\214\302\355"
+	.ascii	"\313\226\351\327\027\026\267\247\330\302Y\365&\265=\3750(\212"
+	.ascii	"f\323\267{.zf\362\254\030Dn\235\033\007\267f\264\370o+B\205\372"
+	.ascii	"D\325'\333\203\226U\013\003\256;\343>\227\3601\356\340m\204a"
+	.ascii	"\001o\246\362\363\272W'R\314~\337\324\256'"
+	.text
+	.section	.gnu.lto_afatfs_assert.part.0.140.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`A\001\r\r"
+	.string	"\266\027UB o\224\01631\005*\3400zV\240\003\025\020U\353f\031\257\f\270\262\235,\355\025r\021\205\"\320G#\f 6\250u\365\207\30505"
+	.string	"@"
+	.string	"\036\340\305f\363\315F\020x\234\3453~\333{\357\235RA"
+	.string	"@"
+	.string	"@"
+	.string	"\276\\\232\263UdvI\007:\244D0A\331]\n3\234\273\214\360M\316\257x.\001t\024\036\237G7\3410@\327\0215\273\373\324\237\204\216\343=\001\237\025\317\356\332R\341\256\334\266\002\333\t\354\203\004\030$\t\016\037\274YC\262\275]\245\241\364\261\253\242\227G\375\331\267/\302\371)_l\037eN\207\373\310\026\327\364\025'\n\\\032>\233\323\321\370\310\2269\013\024\021\023\273*\003\227\356X.m\r\007\360d\273\316\303\214$E\307K\261-\272I\265\354.\002\237\344%\016\374\r\227\3262\336=.\375\214yy\370\324c\t\323\213\026\250\215\267z\360d8\037\027\202\330\361\3713z(a.\354\226V.6X\275F\327\002\254Z\030\2666\032h\364\001Y\330\003\355C\353E\261\353#\242V\246\321\r\001\327\006\f2:\2525\243\357\236\r\310!C\323\276>\"\204\021\361\017\013%!'\021\236^g\210:"
+	.ascii	"\005\b\b\246U\310\311\333]\022\f  \260\002\2319\3634\265w*\034"
+	.ascii	"\303e\207M\024(\271\347\253\270\275\262,\212\361\315\343hQ\357"
+	.ascii	"5.\265\024\364m\313\302Dg\230\033\216\251\201\013\341+\264\026"
+	.ascii	"\00180\fz\360\272\332\023\372K]\370-tkJ\275\365Z:\006"
+	.text
+	.section	.gnu.lto_afatfs_cacheSectorMarkDirty.part.0.144.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\210\001\035\016"
+	.string	"\306\231ZC"
+	.string	"\261&\035\330e\240\206#\335O~\316x\214\025\224\236\322/\3024T?\364\267\373\301:\202xt\2762.\\\207\032d\330\037}\310&QUUU\277dDVFJQ\025\214\361p\240A*\331[\312\224\002D"
+	.string	"B"
+	.string	"K"
+	.ascii	"\317\3337\252?\353\005\252?\373!l\207\354\232o-\233b\221]\303"
+	.ascii	"aaM\024\200 a\220\271\331]\370\247\036.\272\246\023\371\217y"
+	.ascii	"\200\221\212\311\225\243\242\341I\340\016\200\203\335\265\265"
+	.ascii	"\341~\267\355a\273\201\235V\251T\026\253\273[]\261]\372\271\264"
+	.ascii	"\373\366\253\246S\323\277\262t\340\305.)Uc;\274\231\017\266o"
+	.ascii	"?&d_\2273\277\205\266\315\220\342L\37307\211>\242\204c\300V "
+	.ascii	"Ab\261\273%\370\263\207\365&w\220\312\366|\005\210\204\322\351"
+	.ascii	"f\306\347\247\270A\223b\002\004\337\245\244JE\021a\313\t\027"
+	.ascii	"cd\363\307\352\232\352h\\\340\200\222)\333!7\021\255\335]\340"
+	.ascii	"\227\270L\004\337\345\317\032I~\364\347\223T\177\327\213(\235"
+	.ascii	"^L'\031Y\004\215|2L\363<\340\030\353\320>@\235\017L\204\202\326"
+	.ascii	"\201\361\003E>\235\020\210e\032\3540\3408\342\311 (\306\f^w\253"
+	.ascii	"+\266d\300\3008Q\024\253*\213\355\247.\214\022@\203\372\310\006"
+	.ascii	"\301\235>u'\354-\214\262f\224AI\305K$ p\202!\302\333\006\265"
+	.ascii	"\331\273\2241 d`\"\240\034\207\343\004\215`\027q\273X|\365 _"
+	.ascii	"\201\323\205\221\205\210H\247I\371<\005=`\366b\215%\0227+\344"
+	.ascii	"\2070\310S#3\232\243q\266\321\267@Xz\302\362\310|\001\273\021"
+	.ascii	"@\356\005\265S\213~\327\033\003"
+	.text
+	.section	.gnu.lto_afatfs_fileGetCursorPhysicalSector.part.0.157.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\217\002\255\023"
+	.string	"\266$}G\340\360&\035B\007\200b\034\027\346{\027\375\007\316\200\337\214\307u\223\324'm\370\373x\005\353M\023|\241!\375Q\016>l\313\225\223\213\263m\2079\305A\030:h9\305\200\034\031\214\313\021"
+	.string	"\361z5B\b\331r\247\024g"
+	.string	"l"
+	.string	"d"
+	.string	"?,\343\326\320X\245}\331\307\226\373\254\f\b\2600@\024R\354\216\037\337\034\342}\363\350\331\037\301bq\216;0\032\333\276\210\307Z,\222\304\274\324\024\220\321\"\0041\355\216\337\267\216sp\337\346\005p\337\264\303\305\253\234\242/g`.\327\317\336"
+	.string	"\250\2516\003\263p\271\361\331\215\354\256\275\013\367v\333\"\266\027\330\222FEgA\353\t-\222\374f&\223\365\254\330\241\230\211\323\264\024\013\2610\243\207m\027"
+	.ascii	"\034\rK1\265\357\253\370Qx\2327\227\0321\034\332BG\241r#\253"
+	.ascii	"\217\021\223M\254\304O\330\256\323\374\261\263\273\037z\220o"
+	.ascii	"\242\350D\242;`\306\205\321\234H\374\326\354%\354\310\222d\354"
+	.ascii	"\216\036\337,\342\315\\*\322\237\261\330(\273\305FY\345\003z"
+	.ascii	"!\325\353\3249C\306\346%k"
+	.string	"\226\0279\251\252\033\222\f\210\227\203+\275\220\032b\257\356B\364v\367\200\337\342I\017|\236oF\001\345g@\356\333\365\263\037\203\007\022/\262&U\307:?Ws\354N\372\324I{\235t\327Is\377\371\267Nzv\322\332I\313N\372(\271\001A\206\335\n\265\246\275\331\216><,U+t\235$HQ\300\002[)\025\003\026\030\262\\)\016\325\311\312d:\005\022\232\264JLR)+a\311\007\256\276\224U\t\312\227b\205\037\210\001\203\020T\254\257\005\202\254\017e[~\256\346\370\263oHOO:\301\366I=\362\242/\253\252\216\3559\264\312\301\235N\365\264;\335H\034\247\235\022P\222\251\361J\035\306RK\345\363\254p\337\2707 \200\2429V\266\001t\260\222\303\004\334\314a\037\247j\033\355\276\330[|d\0345'X\250\345\200\032\035~vM\364\206\031\303\355\377b\023\244\306@\032h\035\202\263\204\371"
+	.string	"\232\037\027\321j\341\336\025\031\372gy\260\234\244\b{\243r\213T\322\360q\236\260\344"
+	.ascii	"\242\303ma 8\003\247W\307zo\310lMa\336\na\351\204\245\221\263"
+	.ascii	"\307\373\356\277\221[\270p\003D\235Br\351\265a\f"
+	.text
+	.section	.gnu.lto_afatfs_freeFileCreated.part.0.163.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\005\001m\f"
+	.string	"\226VQD \213*\035H\200\320\230\357\030:\034Xz\211)\236 [\311w\t\204\003\026\334\216\016\301\205\234\303X\363-\306\252\242\201\215\342c\303\304\n\001 \001\213A\257\007\216\201\260\202\"xc\006r\201\006\331d\357\224\002;"
+	.string	"="
+	.string	"A"
+	.string	"\325{\275\313v\311.O\032\330\224G\273\304 Y\323\205\366*\221\331v\367{\245\005>\236Nn\364\037{\004Je:\225P\001\370\2548\007\361\261\273\246\004\270\353m_l{\3307\t\265\225\202\335\275\354\017l\321\033\330\203A\300\356\212lot\377U\362c\366`\245\223\244\f\323\200\215W\317i\177\301\031\214'I\247\330ei\230\355\222\034\257\276P^M\376\242{\245\334\242{\235S\b+\031v\267\303\227\360\t\"\376\201W\213\241yT\250{\005\225\034l\035N\3636i\313\224;\267\224es\225v\241\262\332=\271}X\002\325\002\202\303~\373\276\203G\260=\217\016\301\023\0366\004\032\020p\3039c\0217 \314&\343\031\211\230/\004?\017\210\351|\231\217\370Y4\034\206h>\037(\f?\237g{\236[\312\262\347z\325Nt\304\224\322\3269\235\r~\306\251\360TY&\370\303\316\016\035"
+	.string	"tY\231\\\321\360\320\0136#m\302\201\355B%u\252\312#CH\200(\030\346\n\027\032+vK\300\230\321W\216\300n\027\215TX\327\247\024\210\373\236Q\212:\027\230\3564"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_afatfs_getFATPositionForCluster.part.0.165.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`0\002%\021"
+	.string	"\026_mG\360\262&\035R\357oj\006\032\301\341\266\301\201\356N\274\204\307\251aX\272\"\001\230\210\357P7\274\373\375\332\0306\242\023\232@\re\343\224$:\031\237V\271\257\3532z/\006\272\242\360X1+;\321,\331D\356\224\002U"
+	.string	"Z"
+	.string	"W"
+	.ascii	"w\221z\214h\220]\022;3vG\004\237&\001}\212\234\200\366\231]\244"
+	.ascii	"}\332ga\033e\357||Y\026\247\354\235\220\224U%\210\331Pq\365\330"
+	.ascii	"\335\355SM<u\225Y\312?\354 \254\226\352\n\240\365\341r\300\263"
+	.ascii	"\017\203\3355\b\304=o\233\3046hK\016\001\377\315\245}\237\006"
+	.ascii	"\316M\266/\007\261\034+\374\030\247\361e8d\37365\242EV5\342\267"
+	.ascii	"e\277\362\022\273\261cw<\360\351\n \230\364a(;\024z\315\314\320"
+	.ascii	"HPy\027j\334\026}q\231\324a\234B\004\354JF\304\002\320\247G\220"
+	.ascii	"\224\037Q\217\021\263q[,\226\322~\213)t\250\204P\365kh\020}\024"
+	.ascii	"\376I\373\324\032\026\217\223;\246IU\375\360t"
+	.string	"\370\201\"{\374\221W\0334\221gI=\316E909:+UIu\261f\331\356\256\265\204\375\327\257e\322\363\256?\313\2445\223\226\037\377\207\344\t\005>v=\364\370\330\021\363F\305m\002\237\027r]\t\205\006\020\276n\002\330\225\276\320\324\235\276\320\364@\264\241\263`\212\360y!\327\225\204#R\200\257\013A\223\013\334\307\334\bH\nG$\316t\002G\233W\332L\245\021\206\215\373\300m\304\200\275\f\335\267\205\236\367m\362\376W`p\350\234(\212U\325\305\366\374\224\307=\027\265\353\324\002)\0012 \220\002!3\272\001\347\320\013\225Ak\244n\220\315\241H0\265\302l<\373`\350\320:O\315\030\027d\320\220\207\221\300\237\321J\207k\tY\374\002\246\304J\305_\3525\360\no\001B#\316\376\356\2401\030a\240a\007f&\376k\260H\344\202v7\267\323\\\t\337\210\312\367\026\032\222\334Y\033\254\260"
+	.ascii	"\320^\200\234\372\364k\337\030"
+	.text
+	.section	.gnu.lto_afatfs_fileGetNextCluster.part.0.174.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\t\002\215\021"
+	.string	"6\337nG"
+	.string	"\261&\035\330\365\335!\377\327{\375"
+	.string	"\221>k\214j\217\213iK\b3\227\016\2743\3758\025; \370\306\264\301.,!\210A\254|\211\244\241_\237\020b\027\030\323\213\202\3033F\376\035q\362\263\255\215\221l\271S\nY"
+	.string	"`"
+	.string	"U"
+	.ascii	"\323cOF\234\310\331\035A\236Y\004\364\314~\212\225Ys\204Q\371"
+	.ascii	"`\333G\361W\211Y\016PLX"
+	.string	"H<1\034f~vG\355\031\351\0068\236\315\027\340x\246$\316\272\312\311\362e\212J\353\372\330\037\240\324\350IQ\001q9\372\354\030\331]\203X\356\354\266\025\330F\331rBvI$\274\016\311\307u\r\220\341\312y\375l\307y\013?\347\306Fe\322\t\215\177c\243\372\256\354;\300\360\274|$\204\367iV~\314\242\032X\212\324\"\260\353\002\373x\346\f\226\n\001\001Tb\213<\345gV\343\256\314\025\227)9\013\f\007<\366D\206\006\203\021d\225\037W\343\202X\345U\250\002R\257\037\267\273\n\362)\252\217]\266l\320\226\324\027\353\374\\u\261C\3223$\255\237\371\345\307\377\0352&\301k\327u\303\306\266d:%\216\363\357\3745W\373\276\213\307\260E\016\377\302\207Q\212\3511\261\273;.\211\254\256CBj\215\353\032\241\314\360y\375\200d\336\327\211\035\005\357\333B\"h\022#p\250\256\001\307\201\247"
+	.string	"\034\252;\315\f\234'\00291L\241\026\210\036\007\202\251M\200\267\220\360$\232N\233\247\nM\332\327i^g\262\240m`\250\205 \360w\201\0035\361\373@Md[~\256\272\370\261\217\244\352T\017\352\021\023\325\240\372\002[\025a"
+	.string	"22 p\"R\224\266\001\036\322he\345\232\304\307\207\002\223\206u\013.\2423\314\021\016\3417\304L9P\222/\211\024\027f\023\006]\354-#u\214\205w\006"
+	.ascii	"l\244\307\001+^\332\270K\030\364\365u\313\020\247\004e\037\325"
+	.ascii	"\006_a(\341\021\304Wh\217\245\326m\004\302K\314@\bw\353\233Z"
+	.ascii	"X>\332\315\233\263\312q\356(\354\265\321\020\322\033}\002\306"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_afatfs_FATIsEndOfChainMarker.part.0.180.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\035\013"
+	.string	"V\327O? \215&\351'8\002\020\200\004Q\203\210\261nN\300rq\001\224\022\302\216,-\031\327a\264\377\377\323\220mg\026+\274\371\017H\024D\"M \007l]\"\310z\222Kn\210\327\237\220\275e\nA"
+	.string	"<"
+	.string	"8"
+	.string	"\335\260F\006\264\250W\206\022\223\177\215Lh\321\200\221\021\211\003\"N\220x0\221yQm\210\241\242\3421\321=RiT\254\251\013FTJ\220J\023z\027e\025\033\231\371\205Bo\375\023\374\n\276\b\002\032\bX\310,9\241\310\013-\204\312\337\257\t\364\230\017=\246\355\307\353\005\352\312\207]Y2\031\357\313\241\035B]\371l\221y2\002D\346e\240\355\314\245\r\243\002,m\254\001,m\037\263\017\211'_\016\361!XW\022C\214\b8\372\020\261\246Z\220\244\b\271\323x:\365c)\036VT\020\271\323a\312\310\31223G\224\377n\337\254\335\310\356\353\325\366r\001\025\247\201\007\b\203\212\343\261@\034l"
+	.string	"\274\311\2608<\032\216\315\307\307\322P\235\016\352\243C\343Am*\213\312(p\347\001\247\242<\235NEa\376+KD\271\246^\034\303\206\022\376\206o\204\240\310\210\230\362\001\f"
+	.ascii	"tY\251h\003^.\214\r\310\003#\212K\230\234'u\247m\352\264\004"
+	.ascii	"\251\2014\217\276\266\340\001"
+	.text
+	.section	.gnu.lto_afatfs_isEndOfAllocatedFile.part.0.181.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\f"
+	.string	"FYUA\020\217&\351\303\022\005\300' \024\320\301p\201\337\216o"
+	.string	"W\362\f>\002\025\237A\321W\257\026\261\345\177\327G\273\177\243\027\034l_\325\025"
+	.string	"@I[u\356j\204\2130\240~\202\273\206\032!\233\310\024E"
+	.string	"@"
+	.string	"@"
+	.ascii	"\r@\365}C\334\201\371\034j\306\301\344\344"
+	.string	"\277\003\003:\264!a\304\205\201\0271JVZ23\253\01774Tl.t\333\be\244XS\025\260hqb\204b\241M\243.\303#3\257.\364\327?\301\217\340\013!;\327F\327n\315\332V\2554@D\246\311\tFfx)>\374\375\232>\177y\320_\306\326\354S\025\317F\226\025N\306\366\035\321\022\250*\236\002\310$\265\240\310\314\n\364\215\251\372\316*\200\352\253\002\305(D\207O\305\004\020\"NM\224(\313\002\220\253u\324w/\252\017\021\363\016\272\202U\231y\340\222\210\360\340z\350\273\036\252\257aM-\206\016%\222vj\2302\272\272\314\314\221\364\267\251\333\317\265\037\f8\033\267\206\003\333\210d6\232\020\017\226\261.\216\025\302\311\200X\232\016fq\020\370j\360\321\261D\256\253c]\352\022I\327T\215\366\220B\n?\205{\220\240hDL\371\035K\242\206\0356|\350V\224\224D\355\264\313\022"
+	.ascii	"u\331kZ\214\0347\f\200\314hp\035T${j\254/5\036 \n\206\025\256"
+	.ascii	"\210H\b\235\363\316\3564H\235\366!5\205\346\245\327\2261"
+	.text
+	.section	.gnu.lto_afatfs_fseekInternal.part.0.186.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`&\002%\022"
+	.string	"\306\340tG"
+	.string	"\355&\035\310^=I\031\363w\236\201\237j\320\361\007\232\213\324\352o=\006>\271B\030\3503\301\323\302\020\265\033}B\307#\310\320\365\355\226\355\257\277\240\2454/\224\347\324\223\311`\001\214\200\326\327\374\023K\310\226;\245`"
+	.string	"b"
+	.string	"^"
+	.ascii	"71\313(9\033[l\3736\247\225X\266 \302\211\013\201\027\025\t;"
+	.ascii	"G\265\222\3367\324\005p\337\350/\270o\273\341\262ot''\363M\276"
+	.ascii	"\275\374F\n\315\b\225\361\345t\252\214._z\001\343S\024`\024)"
+	.ascii	"\202\242\032\013/?WF\2249O\347H\032\265Vw\025n\322m;\260\315"
+	.ascii	"\300\236\034\001\365\"\036\302\017\002\372\001\231\251\037\020"
+	.ascii	"S5Q?\336\274\320\240\330\350x\354Rx\237'\346\227.\365\274&\202"
+	.ascii	"\262\2505\246\226\372\346m\276&BMU\314\320AAWb\227L\347wtF\250"
+	.ascii	"\316\310\211\214\235\307\211\221\225B\213w\332\377p\262\344 "
+	.ascii	"H\006\230\252\2303!\250V2\3017\257\272o&;\373\0010B\2733\266"
+	.ascii	"G\270\357\313\027\320!\262\3111\022g\212\2713^\356\264\256\214"
+	.ascii	"m1\275\307\371\347w\376\223f\251\242\325\312\262BE\305\260\r"
+	.ascii	"y8\320\211\214\261\212\031D\231\2203\226S\312,\210vTE2\205\261"
+	.ascii	"\n\r\236\234\261\220P`j\264\367|\355\373>\037\262K\016/\344\214"
+	.ascii	"\362\347\250\326-\330\007k\360\001\222`\255\320\345\0029\016"
+	.ascii	"\326\367\240\243\343cu\255\216\227\213\232\245\n]\260\317\305"
+	.ascii	"\362 \t?\017|y\036\257\017\202\307\n\t=\225\001\203\037\255\020"
+	.ascii	"\017\006\202!^\311\366\374\312\370\345O\364\227q\273+\266w\255"
+	.ascii	"q\262(\333\201\031\r$juc(\2009\327_\337\210\303\205\022\342\232"
+	.ascii	"x?\213j\0021 \220\"\"\263s\261\246\270\035\230I\344.\017\023"
+	.ascii	"3\344\262\033\026D^F\370\305 \201\342)\032P\007u\234\344\270"
+	.ascii	"\266\220,\264\330K%\317\324t\002n\210\232$\177\342\255M[\367"
+	.ascii	"A\320\372p\177\314\231,\224\034\362\311Gx\017\342\0374\031\331"
+	.ascii	"\214j\\\201n.\350\356\346\214d\263g\273\037\204\334\216\023\327"
+	.ascii	"B\200\032\366\233h>\356]f\f"
+	.text
+	.section	.gnu.lto_afatfs_flush.part.0.225.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\351\004\335\036"
+	.string	"\206\270\305J\240\230Q:\301s\374\325D\202\006Et\300\b\f\211\017\003\177W\237\361\311\t\315E\350\313\210\216\300!\366\361\325\266?=\250\216}\375X\326\354{\241\005\350\360\032|\350\234\034\211\3755\016\270\360\364\211d\231\264\226\020B\266\334I\006\261"
+	.string	"\251"
+	.string	"\262"
+	.string	"ls\236Dp\003\345I{\232\362\344\371C\0353\312\354\303\214\236\274\021\216`\243\033\212`\343\303\273/\t\205\n\f\271\364\230\274\356]\232\235\354\035\034\273]:\237uw4\006;\315\222\264]\323\035_\305\321\030\226W\231#c\220\210\214\036\2632.)1\277\0322\262\003\204|\004\335\370\004B\206hT\230%\263\242\024\17754\303V\220\221D\204W\317\353 *\272Y\203~2^\316\220+\320\037\213j\321_\317\"\270\367\316\374\200j[\007\300*\0303\277\2365\200\005\307\326\241^}\277\237Zk\321S3\303\275\227\317;:\00383o13\bf\013#\024n\177\202s \353\336;\301\311\243r\370I'\031g\242>\310Dy\262\366\241^s\243k\0138D\302\253G\356\267T\021,\247\332A\356T\306t4\204;\007s\212r\345\030\3544\357t.\313\312\344\233\316\226\254\334\266r\375\323\371\002\254\322Q"
+	.ascii	"\340\275B\3072\327\006\t\345\307\235\376\246\377\351\315|~\323"
+	.ascii	"\237\370P\214\026ug:\022\276\323\215\214.\321)\3211\361\213L"
+	.ascii	"x\312\336&\rC2@\356\275\037>\344+\371\022F\211=.\204\303/\\\367"
+	.ascii	".m8O\262\322\227|\236\204\247~\211\356[\204\031zq\335{kN\006"
+	.ascii	"\345\333\f\322\305\205\270\305\336{\357\331A.Zy)\337L\332\346"
+	.ascii	"\266\266\323\366\035\352"
+	.string	"\327\321\263\372*\315f\262l\356\262\331\326\262\321\3661?\370\373l\002\304/T,\200?&V\017\206\254\253\233\013Xpd\302+f\277\bx\034c\303\343u\225\035\344\262\311\256_\304\252\020\267\322\363&YUn\016%\254\302\261 \244B\366\233hI8\262b$e\267M\376\272\300\020\265\372\0345$\344\310\236(\273S1\304-\264O9\361.T7\327\"\005\347TS\335\357\302\343@\033Y\206t\007\331\336V\326>\022Q\013\250\222a\346\332\241\330 \b\2319\305\245n\030\004\267\333rn\035\b\240\260\211\320\331\220\303\361\324l\034xvl7\0229\232\215\206k\262\235\021<\264\0215\235\236\035\332\fw\233\351\334h9\263Zng&[\300\270\022\266\334\214\007\207\313\315\320w\016X\222\222P1*\306\337\225\037\376\334R2*F\301\376]\031k_s\006^\377\240u\312W\r!`\323m$\246\251\260f\366"
+	.ascii	"\242>\210o\374\200\254\257\031W\200Z\005\367S\"\305`\314\236"
+	.ascii	"\266a\355\2539\254o\274\202$e~\020\255`\035d\262GZ\363`\317\312"
+	.ascii	"\207y\366_\024\255^\244\262\2635\323\266\355\273\361\217\321"
+	.ascii	"\253\362\225\0068\036\217\3077(\331\232h\227\355\343\251[\250"
+	.ascii	"qD\202\024S\250J$LP\224\2649\200\002\231*\244\007\021pAd\301"
+	.ascii	"\024\203f9\234\021\252\317\207\036\027; =\256\260\254\326Z \342"
+	.ascii	"\032\230\332\370p\033q\n]\366`4\251\342i\244\314\202\370\335"
+	.ascii	"\362\252\f\036\214\2224\317\337}>VfZ\302\2457\2052j\201p\036"
+	.ascii	"\236M\025\004\233\r$\002\240\344=\2253z\344I\317I3*\331\357N"
+	.ascii	"Y\273\027\026\036\233i\204\004-\232\270X\364\005\3272\3040\340"
+	.ascii	"\324f\223\201\216\n\304\221\335\256?Wo\247\346>{\350\367\225"
+	.ascii	"\362\312\242\245\322\b\230\001P\234\254\221.\266\257Fx\f\216"
+	.ascii	"\bK\004\002\213\"4!\223\311Q\262\352\203\035\251n\217\037\303"
+	.ascii	"7\005"
+	.text
+	.section	.gnu.lto_afatfs_ftruncate.part.0.232.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\357\003-\031"
+	.string	"6\254\234H\260ZQc\\\334\2612\b\365\235'v\004#v\n\rf1\342\206\357a\341@\254\301\2303\224\325X\216\352\342q(L\270\003e U\227\373\364P;^h\363\301\371y\232\001px{haD\251\231\260\367\226[\312\224\002\200"
+	.string	"\204"
+	.string	"\213"
+	.ascii	"\f*\275yt\247\332\215yW\250p\245\366}\334\207t\247\332\003\334"
+	.ascii	"\253d\004\311\275f\202[\367\224\2676o3\336\226\0370\336\332\357"
+	.ascii	"a\236\236#\025\266\315\323\203d\333M\246$\033\036\214\023@\244"
+	.ascii	"\3565Y\267\365\306m\037\255X)i\363o\037I\037\221\307)\264\021"
+	.ascii	"\034\262kqKu;\026\027\001\354X\274\316\354rb\316\275\367\300"
+	.ascii	"\323\024;\034\245\002N\222>\367^\227.\356\362\266\203lK\260\305"
+	.ascii	"\235\343\355\201?\360\245H\r\032M\303\022t\f\255K\256\344\305"
+	.ascii	"[\225lS\223$\365XR\333\222Z$\251\353\177?\275\371\337\306\362"
+	.ascii	"\240\320\320\2707i\214\230[\303*\321\361\247\027\311\271\231"
+	.ascii	"LI\307\2213W3\022\007\003\330\344\0179\021[\345\331\205\230\347"
+	.ascii	"4\"u\357U\315\356\0039\362\201V\331\376S\220\"\272\nRTs\253\334"
+	.ascii	"\357\204<\031^\3565W\267\376)\221l\225E\372\337\017#\361\207"
+	.ascii	"\321M\315\315\375P\004\024*\320\353*\214\267c}\323)e\312wz\357"
+	.ascii	"\275\325\272d\033g\264\365\300\227U~Zr4\214\313\343\214b\265"
+	.ascii	"\325\364\304\013\234\205S\271 \326\006g\224)\037\206O\241\301"
+	.ascii	"\021\003\214.\252V;\303\243\264\252\024]\2247\374I\253\254\365"
+	.ascii	"+\316&S>\337\303hs\270\023\017\032\316&\275!\255\266\353L\214"
+	.ascii	"f\276\204\304K\301\213\306\333\016'"
+	.string	"\223\251\031\342A\2146\354I@\024`\262cG\022$\203\345\336\273\340\b\211\020~\216[\277\0260\232\213vaHF\006\275\\\037\204\204\\\257\022&\024\003\022\375\332\231\001\321\\@/\021\265\231\213%\213\261D\304\\!X/\242\031kG\307\262!\030\021\213&\223\021\261T\027oU\262\220\367\344\351\210\375m#YS\330&\253}JT\334h\200\372\266\036\343\352\257\266\315\207\315\211^g\004\301\035TL\324\233\203G\005{?\367\002%5<\227wi\311`\031:\241z\266.\265\306-#N+\275\2418V\373\301\263\264\b\b\203-\026\204CE\320\261\362+\023\002O\250A0C\03543#CI\024\246\315\030\220\242\231\273\325\001\021p\261D6$\005m\213\001\365sYr\024\221]\260\024\372`\302\330}\216\252qY$\276\234\031\352_\006\265\217\n{kB\033C\342j\223\274\321=\225J\260\271\2068\t\021"
+	.ascii	"\203Q\267\215\240\347@*\367Av\371F\350\332\200OR\317|6\300\216"
+	.ascii	"\341P\242\245\306\031\377\265\301\337\373O\274c6\245\276X\266"
+	.ascii	"\245\321\030!\3734\215\207\2277\226]<\231\033\001\370\333\360"
+	.ascii	"\021\265\270\315s\355\306\267\026#b\306\244\316\347\224\346\321"
+	.ascii	"\332*\363\275z^\300\213*xW\007\201G\347u\330\017"
+	.text
+	.section	.gnu.lto_afatfs_fileOperationContinue.part.0.243.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\355\n"
+	.string	"V\023F; \345*\035\017\324t\205"
+	.string	"\300\013\200SM\324<\b@\004\302\263U\202\315\346\243\371Q\315\b\306\n\004\313\346\001\217\333\030\201\200\321\330\332\302\214\265\232\200\"\023\317:\251\321\336{\247\0244"
+	.string	"2"
+	.string	"5"
+	.string	"-\203\366m\263\332\260S\003pq\222\333]\357Tz\034\274\214\023\364#\313\025^\236v\007\220\224\032\313\265\361H\360\031\340\331]w\0347\275\355\006\333\f\366!\002*[\243q\214\257\252\317R\233\272\032-\307h\237\344%\340g\251\017\354\306r+\273u\341\324\235\356\324\365\007\231\323\356\005\231S\373#\266U\366\355\365c\003\277\264)P\361,\377E\244\305e%C\223\016\266\t\247\247\375\341\2659\\\030c\242\224Y\316\2712f\277\376\237\324\246\"\320\261\233\021"
+	.string	"fa\224%\304\366\355\323\002\241\210\221h\032\3041\211N\037\021\210\2042}\274o\344\221F\037\t\017T2y\034\004\177\023\241\222w\372\276\222\247\371\\\031\263\247BZ\240\324h\260/\033\006n\253\2242\3334*\004\033"
+	.ascii	"u\331[[\f\270\025\030w\n,\006\234\250\202O\212\006\320\002\334"
+	.ascii	"\r>\243YQ\023\341\370p\325\f[\340)@\346\352V\232-\202\206\b$"
+	.ascii	"\204\316y\207\201\301N\013\300\265\207\024\026\232-=\241\214"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_afatfs_chdir.part.0.247.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\206\005\355 "
+	.string	"v\270\313F\200\232Nc?\023C\263\034Sm\327[\nH\236w\354\3110\027A\027\375\306\177\207"
+	.string	"\211\356\t\n1\022\273\271\2640\2302m;\325w\326\327\017\261T\263\334?\032e^\005\332e\031\303\222\200\266Q#{o)S\n\267"
+	.string	"\257"
+	.string	"\271"
+	.ascii	"\007{\030\323\305\224>@U\261\314\240\250\252q\302O\373\360~\332"
+	.ascii	"\370\034\364'\357\005\320\237\366\221\270\307g)\312\266{|\230"
+	.ascii	"\234\336\250\005\225#\246\006\343\270TU\343\357\347\365\361\364"
+	.ascii	">\233\036o\207\236\346\2657\251o\207RM\367)\233\274\275\331\350"
+	.ascii	"\364n5\245\343<\223\207\250V\343nQ9\314\234\266+0\037\273\216"
+	.ascii	"\220(*\273\333q\364\302Z\232+.fR7~\332|Y\243\245Hg5\265\343\246"
+	.ascii	"\231\003\3055\f \345\302\344\211;3\343\223z\262\327D\257\316"
+	.ascii	"|\004\220\202aZP\343J\373\330\355\f)'k\t\374f\207AUU_Xu\003\270"
+	.ascii	"\3552\333\027\354\223E'P[\325"
+	.string	"U\327\366\244\207~vb\2012i\242CAa@KU\325\nOZ\024\371[?\355}\362\020\274\230\200!\202\205\t\355\352\373\333\304\255\f\362\336,\333J\350/UW]\0222o^\236l\235\275Y\2767\277\353\272\256\276X\266\255O\236\265\271\263\276\250\265\275\361\277\201\363\214\007\016QU\241\3264j\2173J\227\243\316\304A\223Q\013\352?\324\260\025\227\352\223QB\322\316)G\262\350#o\226\264f\211|2i\312\272\225\344\227\375\270\342d\2766V%\261\250\252\352\212\353\217-\331>\233\311\366\371\332\033\227.\246\224\300\250NE\371Z;rg\274g@\357\r\222u\261S\261\213\311\300\013s/\210\265\365\353\007\2655\334\313\317\216V\027 \216R\371\261G\200[\343\210\305\277\375Go\370\026\270G\251iY\246\357\200\376h\016w\353p\343\263\275\255\bhB\362\354\331\330\322\203X\234S`\237v\t?\331\263"
+	.string	"5Pb\001\366\340V%\261\250v\364\360\341\307\333\240\341\350\3411<\2623s\302%\005}\335*w\300\272\312}\005\375=\331\253"
+	.ascii	"\t?\264C\034\r\210@9\345TDx\004\t\373!\t\364\247\035$d?\364\r"
+	.ascii	"\232\2328\272\270\027\267\311\367\247\362\302\252:o\226\2255"
+	.ascii	"\r\212\230T\257\225\357m\021\257\263-3JA#$\241\241 Q\211\236"
+	.ascii	"\205(\034\231@\n2!\224B\351(\350gD\364KA\024T\364\023\n\036\375"
+	.ascii	"(<\260\221\212\241\340\017\311\310(\370\363\231\352\305\362\305"
+	.ascii	"\226H$\372\247\350\307~\212\255!\221\246\237\242\347\235a\373"
+	.ascii	"\274\306 \274N\2767UUU}h\254\214\360X?\005\202\332!\020\002-"
+	.ascii	"+\003\310\300\306H\273R\257%VC\330\004\374g\210}\372\331\261"
+	.ascii	"N@\034+\f\242Trd\316\274vZ\304\252\351\327\216\326\n\304Ys\226"
+	.ascii	"\031\216\021\332\325\310\323\244_h\314{5\345\221.LhW\233\273"
+	.ascii	"<cFY\246C\203\212K\357f\245`\250\235\"9\231\024\354\301\030`"
+	.ascii	"\216\034\221\265u97@Fv\250q<\305\030D332\222\202\242\344\220"
+	.ascii	"\"\251*\343\006\020h8#I\222\0165J\213D\016\224eU\214\264\371"
+	.ascii	"\356\302\214q\375?\230\026N\2504\253\332\214\367u3\276>e\323"
+	.ascii	"r\341\016\034\316\226\355\205,|/\212\356\001\023\031]2\243\023"
+	.ascii	"\200\242\005)\244\323\274\367\234%\004\326\003I\021/p\030\250"
+	.ascii	"Va6\032\231\037\375\355\300\266\0067P<\372\216\365m\230\330\355"
+	.ascii	"\"\3262\024\036\227>\315\037\253^\332\030 <\244\375\321=\363"
+	.ascii	"^\333\025\300\270\372j\225\247\311\330\240b\025\024\322\301\\"
+	.ascii	"(/\212\207\007TwA0\251\017E7S\246\232\034\272\034\030\301\254"
+	.ascii	"\300\272t\365HW[Q\331x\323p\217\203\035\263\222\353\353\202\206"
+	.ascii	"\310\256\031\306\002\2718}\323\032-\007S\215\037\034\344\016"
+	.ascii	"\352b5f\031,\202\021\331\271$M\234\235\255\330\301i"
+	.text
+	.section	.gnu.lto_CSWTCH.163.251.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\205\005"
+	.string	"\362H\036,pk2\214\001\374\377\t\220H\377\377\377\377\377\377\377J\352\377\377\207>\230\376\377\377\271\252:M\241\265\265\265\265\265\2655K\333,I;\352A\204\233p\025\356\302e\330\320\341>\\\210\033q%\356\304\245\270\025\327\342^\\\214\233q5\356\306\345\270\035\327\343G\020\201(\204\300\240 @MQD\262\244\t\245b\271`2\232\r\247\363\364\001\205\024\300\001\351\362\234\244KU\352\n\032"
+	.ascii	"\001KI\203\001h\007\204\201\023\320\016\b\003'\240\035\020\006"
+	.ascii	"N@; \f\234\200v@\330\313\th\267\246\314Q\001\340.\245\261\232"
+	.ascii	"\"\340\356KK\030(\002"
+	.text
+	.section	.gnu.lto_afatfs_fwrite.part.0.253.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\213\007\265,"
+	.string	"*P\220\021H`\034R:\363\212"
+	.string	"\267p\202\214c\ng\036\312\3002\013&(\300)\003\345{M\313\177\300I\247\366\377Y\341-\354F\363(\211\362J\030\2543\013{@\3073\223\0253\207\225_/\356\227\365\340\243\375O\032!d\357$\003"
+	.string	"\001\372"
+	.ascii	"\007\001b\027\2425\272>\260W\307\266\264M\264\354-\3553U>\215"
+	.ascii	"\272h\223M\316O\005W\373\002\033\243\373w\365^\254\351\231\235"
+	.ascii	"}\217\245M{\362\022\b\026\205\364>\f\354E\n\366\242N\004|o\245"
+	.ascii	"\351U\230\002<3\325T\343\333}*\177\306x\025\246\373\344\234\205"
+	.ascii	"\006\315\371\271\340j;`\257\366\223\355\276\224\246n\323\347"
+	.ascii	"\226s\352Q\356\025\243[\r3\222\316\004_\3240\303\350r~\032]%"
+	.ascii	"\272\320z5=\320z\025\013i\337m\377\363\365X\336\252\246\370\002"
+	.ascii	"\333\376m:\221\377\005\235K\350\357\223Sy}\274\tA\250\256\336"
+	.ascii	"#\360\203\312\352l\222)+\266\02303Uuy)\221\231)\253\224(\347"
+	.ascii	"\374s2\357\352t\350\t$\231\332q\325\035OS\t`rH}\3557\3129#\275"
+	.ascii	"D\342\332\374\234\313\213\017=\206\271\2552^u?\250\256~\177\016"
+	.ascii	"\344M\3109\367\223<\336;\357\356\266\356\276\352\346\335a\266"
+	.ascii	"\032gu_\354\017\360\260\037\200\357\366\220P\220\3576\220\357"
+	.ascii	"\366O\360\266O\360v\317\316m\236\340\307\302\336@\336\355\037"
+	.ascii	"\360\266\357w\273w\2647\353\273\315\273\330{=\334[M_\366\306"
+	.ascii	"\276\333\367V\376\027P\243j<X9K\335\321\311=T/G^\366\217\375"
+	.ascii	"j?\332\017\367\237y\232\336Z>\025t/5\361\317-)\236\322J\314\353"
+	.ascii	"d\316v\277\337\206\346qpoo-\321r\fZ\305^=\343\346\226\223TEP"
+	.ascii	"[p\307a\026=\233\361b\372e\260\231Y\026\226W\316\371w2\315\300"
+	.ascii	"A\323\307\020\211\220\317,\265\222a\261\361\242\353\335n\006"
+	.ascii	"\016\214\037C\3743K\361\264IA\275\350\236X\263w\351\207\371\232"
+	.ascii	"ZZ\032\324\021\355\314\305=s\321\223\315\344;\207D\243R\260Z"
+	.ascii	"\272\177\306\356{\371\227\356_/\275K3\210\263s\262\204\373Z\232"
+	.ascii	"\372d\207\366\257\214\013\2276\315\001pv\277k\245tK\205\302}"
+	.ascii	"\223\302z\025\b\037l\310\224\244\205\323i\177\260\f9\267\272"
+	.ascii	"\273\301\271\301\305\033\260\372\260n\276\344\330\017X{\260\017"
+	.ascii	"\356{\341t\031z\260\032\304\254\007\226\224)\311,pA\242\353\206"
+	.ascii	"\225\007\027\005\334>\207\225\207;x\270o\362\340`\332YW\035\233"
+	.ascii	"\035\314\303A\374#\343\302\342\2045t{\030\210\177\270[\304\210"
+	.ascii	"\373f7\350\341\204\221\355\303,\376a<\347\264\304\207\317\264"
+	.ascii	"\343\341\036^\215\f\221\303\264K\252]]\211\243\336\300\231'\315"
+	.ascii	"\024ku\337\305\312b|\005\314\333W\334\362\316i\240{\334M\242"
+	.ascii	"\304}\223\305_;\320\027\027\2222K\214\354\025"
+	.string	"\253\230\207\213\310\234\340\2448\315oW\025?\356\354\033\250\2555N]\370x\316G\027\035\306Z\335\215\357\336\256\027c\3748\314*\345\275\353n\023W\323\2629\347\007\3759\030G\375\"L\353\325\213\017\275\232D\016\254nJ\362\336]\254\325\030\370@GG&\356\t\023W\2118<\016Q(\021\221z\306\241\212\020\302\343\2608\202\030\342\304P\005#\260H<\"\tA(m8\n\215II\035\212Dcq\t)\310(<2UP\022\036\217\303\342\013\240\222p\005.\n\223\222\226N\254\302\025\303\244\264\221\212\214I\307\243$$%&\343\221\021qh\2444<ba\204T4\032\025\035hb\013a\321\350H$\026\215~\307Y\375\265\377\250A\334\351\016\036\302O\335=\204{B\022+\271~X\253u\\E\243zA\334d\226\335\253\374N\257.Z\306,\353]\345\017=[\027\255\301,\273\030\247\217J\0133\246\027\024"
+	.string	"\257\370\351kW\243\\\230XzB\270\323\013"
+	.ascii	"\003\361S\273\256g\002\004\331\246M\016?\3159g\237\020\366A\025"
+	.ascii	"\221\343\264D\271\342\240\024\212\034\232\257\267+]\312\263\036"
+	.ascii	"\202\333gk\225\264L0F6~\273\201R#\312"
+	.string	"\002\341\037|\266\337*\033T\220o\332\326\272\333&\027\331\036l\253\333'7\267Q \004\200\224\250a8\305\2242\306\020\311\210\2104I\213\001p\002\031\262\262:\021\3201\2045)\355\035\307\265(v\357N\361\251:x\f#\013#\224\340\264\352\375\002\207\227|\002\021{|?x1*\352\016\353\030Z\313\302\342\312C\342u\f\320\3358\020\002\271axa\032Z\016<+\n\361\224j\341\237\372\f\220\325\307\37742\177\317\224\341I\376V\225\314b\020\227\334$\272q\206w\311\026\376\362*K\236\220UU[F\200\212\220/\204\373\335\276X\007*\004\326\007I\242\201\344\247_\237\250\267\332:@Q\352\006y\033EB\211\354\240\260\241\3050\226E\331\264(\036\351\314\271\023\227G\351F\2773\227\005\017&* \177\211\3319\207\326\316B\0339\033fM\240\f,\333\301o#\330\315\324\274\001\032.\016\241\270\322\372\344"
+	.string	"\351\241C\205\001\241"
+	.ascii	"\255\320E\243\242a$\263\320\363\353\227y\257a?\377\361/\035^"
+	.ascii	"\2306\0034}d\337\t}h:/?+\024\361\037EB\205\3461\357\363z\255"
+	.ascii	"\211M\3463\376\211\270$\020\341\234\376\352[#b\013N\003"
+	.text
+	.section	.gnu.lto_afatfs_fread.part.0.255.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`?\007M*"
+	.string	"\272K\250\020Gp\334Q:\351G\241;\001\fZ\311 A\321\005\2100E\321\025\201\374\325\002pa\346\022\237\263=lss\201\245e\004\325\336>\017\230\273\313d\242\207~\326\371b\320\371,g\244&y\021?T\265=i\204\020\271\223\f\365"
+	.string	"\357"
+	.string	"\363"
+	.string	"|D\305\\\214\277Y\3670\232\353\0168\367*\025\034\345\013\252\013f\336Q{1(\345M\262}\026\343\331\273T>\256*\234\366aW\234\316+Nn$\264}\025\250Sy\n\240\274YX\334\226\371S\256tq*O\367\335\373c\311\274W\311\340(CP\217\262Re~\024(6\236J\257$\326\277\016\346\202\215\032^H%\021\210i\"\303\360\334\253\374\035=zQz\364\374Pz\264\203\260\316\032\277\323\251\271\024=\333\362\214|[\225\214\372n\rK\213\371\302\352\b"
+	.string	"\311\302q\365l'\260\206u\203y\002K\260\264l\356JV'q\322sB\230\032W@I\344i\211\270\3059\333\321\242+V!qzd\341\370\271\223\361\204\t\326\354\221\245\365>\023l\241\315"
+	.string	"JR\235Eg|\2649\363\326*9e\255\320y9\n\367^\276T\216\263\317\231\031\f3\307`N\303\004\177"
+	.string	"\243\234e"
+	.string	"ED;\313CB_\236}\017;\367N\313A:\313@\252\345\237\253\235}r\226y\027;\357\336v\326\251\037;\347r\226\323\213\375\350\315\316g\316r\347,\333W\371?"
+	.ascii	"]\333\202\266\356\275\212\323sy\240_\220|\371\217\375f\377\372"
+	.ascii	"\243\371\325\376\266_\315\331\260\003\bP\\<\212Rz]\245dH\304"
+	.ascii	"\300\360\\*\245\002\007\020\232\270x\245\327Un\n\207\030\230"
+	.ascii	"\216\371|3O\303_s\2676.L5ee]H\230e\316\234\r\315\332\332\020"
+	.ascii	"'\2654'\233\346\324\273k\367I!+\221\024e\230yb\356\205?\346g"
+	.ascii	"fd\310\030\217\250\274\230'\326\2622cO\212\307\365\321\340Zu"
+	.ascii	"\230P\2670\377\313\3010\363\270\351^\330\301[\034\236{/\257\251"
+	.ascii	"\371[\240\370dg2o\331\245\213\361\274b\027\326\255$\"\324\243"
+	.ascii	"c\\\214\001\274\026\352\035\334\327\233\343\326\220\375\351\240"
+	.ascii	"\3565\363\b\022\366U\374\200\307\261\243\030\250}:\250O\270#"
+	.ascii	"\023\240>r\017\257\1770\030\371JC\356\221:\323\302b'w\242\276"
+	.ascii	"6j+\346\005M\334\350\020:\276I\245\335\305wJ}\272\261\224\371"
+	.ascii	"\262\342\326\263of`\320\276\312\247\317\366!+G\316\324\250:\212"
+	.ascii	"w\255k^7\b;\322Q\373\2747\246\272"
+	.string	"\276\333U9pP\326\206\343J\322D\273+\356\306\324v.\003\331\2238\344\r\264\317N\233\001\331\221\216\355\356\263\177v\365M\306\2235\307$S6\216\373\021l\220\031r\036h\242\006M\354v\017\356\013\240s\007\255\273\213\273m#YI\243\262y\230Yx8\335\005\334\230O\334\215Q\275\367F\340\303\265P\342\0279\312\177J\217\332>\363'\0246cM)R6\316v\0277\257\177|\211\341\345\310\375\203\371a\001\304!SP\350\241\250\204\342\203\t\240\260\303\360\003R\221\205\242\017\260\204E*a\213B\246'\013&\200B\242\2168d\n\n=,m`\022\026\223\2228\020\207EbS\220hI\250\242\211\302\244\244&\244T\250B)\351\344`\203b\022\0230)\270\364T\004\376\206J\277%%\340\212_\220X\37450\300C\026B\342\217i8$\376x\310\237:_\347\204\232\317\324H\307%F\017r\331o\036"
+	.string	"\003h\246 \325S\310]w\361\331\256k\256h\310\245\372\346\257\264\346\3549s\255\236\206\331\0353\252Ps\335B.\3177\357S\353\254f\310\245J\244\246Yu \227g\332\273\266:\333\321\365\f\231E-j>\317"
+	.ascii	"\335k+c\272{\2237\2568h\336\372\347\275\367\352~\272\327E\275"
+	.ascii	"\223\021%\355\310dj\327D-\201\r\334\324\032,Z\332\200\254*\207"
+	.ascii	"t\250\211F\226\357!\3455\210\020\366UC\rd\326Tk\302\361u\200"
+	.ascii	"\212\250Q<\304\2242\210\031\031\021\t\"I\242\016\200\002\221"
+	.ascii	"\252\262:\022\300vAo\r)()\237\373\035l\314J\241j\n\252\306I\275"
+	.ascii	"\034\016\363\222\235jw\255\372\262r\004\022G\026wF|\246N\343"
+	.ascii	"\017\032\252\037\226IS;x\326d \325\240K\245N\261\364hJ3\301\306"
+	.ascii	"AH\200\373(3#\270'\005\f\226\233\016\2470Z\372\225\311H\r\257"
+	.ascii	"\260\r\206\361\372w\240\361O-\235q\330\350\264\373\016e\330m"
+	.ascii	"3\236_:\210\213\356?\001T\260\327kD-M'\245\b7\370L\232@\322\366"
+	.ascii	"\211\351\316\317\b.\202\017O\274\236\336P\247\366%\365\315\335"
+	.ascii	"\333y\003.3\2618\004\3441\331\027\362\225\222\341\207\264`p\351"
+	.ascii	"q6\035ma\346\220\301\313H\027\037\370\036\210\247\334\"\017@"
+	.ascii	"Q4\242q\310\201H\006\377\222\276\267\347/`\341\367]\370\n\246"
+	.ascii	"G o\232\227d\227]?\360\243f\006\205\360\246\210\216Q\354\272"
+	.ascii	"j\303\316A\212\027XL \221k\315W\357a}\2420e9<\005"
+	.text
+	.section	.gnu.lto_afatfs_poll.part.0.257.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`\355\002\235\023"
+	.string	"\306axI\320\360(\035\332\2553$\320(\260J\204\207\340x\246\030\034N6>\230\354\002)\326\021\300\177\002\250i\351\007=1RE\340\336\233'&>_\331,\325\341\244\324\225G|"
+	.string	"\264\251FA\354\241G\200\272\300\366\377\311&{\247\024a"
+	.string	"c"
+	.string	"c"
+	.string	";L\273[\340\325\007P\257\251\207|\257\336A>\225\373\266\230\r\202\257\327\261\035{\361\212m\3437\232\025\240\233Y\370az\245!\276\362\352\321\371\255\370a\007\244\031M\366\352\001\243\363n\273\202\033\030\244\031M\303\251K\313\027RS\332"
+	.string	"\240U\240\363\343\337\211dw\215\332p\237n\333\304\266\003\233\246\002\0361\273\030v9\266V\211n>\364\013\375\270S\373\276\212\017\371-\f\006\305\200.\344\343\316\302\340O\314'\366\236\257\260U\316c\312\001W\"fgwA ?(\205Ko\203\022\330p\340\354n\203\367\370>\3771\210\"\345\233a\177\201\306\246\264\264{+A\275\372v\023*?\3412\345r[\332\t\204\322-\257)k\212(\235\361g\3704\350Q\315\003\316c\3702\346\311\317h_\223\351`D\212\274+{\214\375\022E\263/\003H\366\206\356\303\322\326V\304@\315e\356\260\315\372\013\022\265\273\b|\027'\232\340\213x\365\013e~\206\362\275\236>h\302\345\360\260\314\335\2443\246\337\351n\267k2\225\261\275\351\177Ug\023\343E\326\310\340\203\202h\322*q\221\260\225\270"
+	.string	"\366\022\307\b.\225\b\342\325\310\353\004\246:Y\265R^\252\220\034\303\326\250b\205+\327+\034!`R\202\350\na$\351\nA\333\363\336R\031\2039\030I,\264\305/{\274\335\335*\352\034\3755r9^\200i\217\020\346g\236B9\022I-T\346\033\235\346F$\311\246\016\323\007B\250aX\203\220b\202\231\031\221aFA\036\240\002\031Cn\003\021@\301bP\204()W\003\234$O\033\211hR\376\333ls\216\366\373f\bw \346\2002NA@y\376\362\300\274\266t\217\006\023\022j2$\232\236\200\257\275\001\005;d/SoS\357\316\265\306\314Vc\205\f\341\301\243\n\356\325\233\3644<x\273\320\240x\334\310\002\007\324r\344\013\342\251-\024\310\212\030\"\305\244"
+	.string	"l\346\212\200G\350\311\t"
+	.ascii	"t\257\313[\031\330\337a\374"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`,\0225G"
+	.string	"zxD\032HpXR:\377\376\317\262\270\035a!-!\362\267,\212>\371\243\272\252\353\f\266f(\2659\325\034\365%\362\310\305\2435\241\243\332x\216\344H\241=Q\26268\274\t!fH\251w\002\224v\3770LV7\262\346eK2\211\001\213\001\243\001P.w\3414D\252\362Nv\231\313\330\345-=\276\330\321"
+	.ascii	"8\361\260\313Z\236\227\263\274\252\005S\352\316\313v`\267\007"
+	.ascii	"\325[\262\240j;{\031\357\315\313`\320\374\353\362\227'\227\345"
+	.ascii	"\274.\3279\271<\327\344\262\025&\227\333\226\\\226*\271\214\245"
+	.ascii	"\247,S\366|\222\313Wz\247{\0027u$\227\251\034\271<\245\3532\233"
+	.ascii	"\221\373\274\"\367vy'r9:\344*\365\326\344\022>\003\263f\307\205"
+	.ascii	"\334$%\253\251H3\361 \367\323\036g\336\253\001r\177\247\374q"
+	.ascii	"\177\205\353\362Z\320\326\375\022\037\227\323\254\332\266\336"
+	.ascii	"\343\262\024\036\227\241;.\277\375\336<\322\204r\035\227\335"
+	.ascii	"\264.\253\345\270\214\266\274\357:\325\t\264\252\343\270\f\367"
+	.ascii	"\273q-\330\2707R\343\3623(\353\236\371&QR\334\235\306\345\273"
+	.ascii	"\031\227\317d\\\206\3622X@\240\307\272<\206\367\253\313N\253"
+	.ascii	"\313f\277\253!\321\241\3451.\227!\210\342P\362\252\313a\323\303"
+	.ascii	"\270\334\374Q]\376zq\257\243\303\3451A.\356sL]\246\026\367Yl"
+	.ascii	"\006\b4\352,.\323\375V\\\026\273\273\212\213Lq?\265\024\3054"
+	.ascii	"q\251+A\303\205\020\204\342^\205\321\223F\222\237\270\016\276"
+	.ascii	"\222`\270G\323\351\324\314\243.\222\211K\241\327\230\340\255"
+	.ascii	"/q\235zJ\355\333\326\225\327\210\304-\352\255\267A\257\231\257"
+	.ascii	"Lf\350\001\300\314\277\344\272&\2250_\346\263\251\373\222\311"
+	.ascii	"d\362P\327\330c\346\034c\255p\311\363\303d/\264\306\210?\375"
+	.ascii	"\244\374\251\\\330\231\361\033\261\201\234g\262\2611<\330\215"
+	.ascii	"\330;\313\367\240d8\256\202[\321\2555\225\330\352rK%\366\217"
+	.ascii	"\325!\036\nZ[\302\200O\363\354\260=\006z\330\236\351\212`A\205"
+	.ascii	"\006\032\304\3349\272\025\345biO\017\227\357\261\270\233\032"
+	.ascii	"\023\354\t\256\2116\321\351\351_\373\016\362\210\351\360\364"
+	.ascii	"P\353\034M!\026\306n;\rl\203;\375Vg\247\213n:\rd\177\2542:!9"
+	.ascii	"\005\230R5\342\b\f\233\210w.c\233\202\031\340\363Y\2368\004H"
+	.ascii	"T\035\320o\317\003%B'\034\320\300\365\307\247\234\234*\354\247"
+	.ascii	"\377\f\216\351XP\330\304\365\374\244\272:[\236\301Z\026& \330"
+	.ascii	"A\366C,\267\253\016\266:w\001S'g\334\026\354.\2572,p\202\375"
+	.ascii	"\3459\214\f(\031j\260s\332\037_|\031\363\341tpy_\024\214\027"
+	.string	"=\234\376\255\267\221\262\253\241\342\364\315\3628c(\320\324\233\006\266o*\033w}\323E\226\332\364M{\337\016\26405@\377\234\314\006\354k\375=\316\2009\343)\300V[\256\236\257[\350\276d\257\333\373\024W\356I\304\335\257V\356M\300\335\237\250r\217\202\312}\211\267\373(\267\373d\333=\224\364^j\312\3455l\227\247\321{\345\332\3454O&\223\314@R.\253\271\332e4i\227\317@/\233A\273\\\346\354r\236\232\233]&Sv9L\224\313^\232|m=qM\255\266?\t\250\232/CLM\253(\345\220\251\235vJ1G&\"\246\253!Z4\030n\251?\307\322%\244,\251$IK\255\256IJ\275\323\276\231bFR\030%9\220\002\235a\224\324g\037D\350\337\021\251U-\206Cj\325\b\251\277,:\352\237\223\341\216\032\270\342\031\035\365\315z\026\263\004ET=\352\013E\b8J\304t"
+	.ascii	"\037\364W\007F}\201\310\2505\274GW\004+\315\201\317\247}\202"
+	.ascii	"\345\215\031jQ\357\004\213\252\274\2410\033\026\ta\345\270CP"
+	.ascii	"TT\324O\357\253 M+\303\242\336\211\336@\334\031\263\201O\270"
+	.ascii	"|\021\213\022\251\2412C\r\372-\231\004\r:\330\036\001\021/ \352"
+	.ascii	"\221\243h-\254\202\307V\331\037\353\304\312\324#\327A\275n\f"
+	.ascii	"\035\313\254\342\276\250\307\026\032\036{p\3220J#\203\376\020"
+	.ascii	"\365\320\365!\256'yF\037\007\366\002x\2608\243\032\233\303z\237"
+	.ascii	"\263\254;\"c?-\377\2713\265-\325\330@\355\233,K+Jdl\037\255\034"
+	.ascii	"\347\031MK[\233p\356-\267\205\035c\251\261\203\306\016\016\215"
+	.ascii	"\375\365\307\330\304\366<\305F\225\350\020QS\025\225\\\002\242"
+	.ascii	">{\376\322\204\253S"
+	.string	"0\264`\2509T}\001\2315\316\242\017h\251\240\330<\354\373MFX\036O\261\273\340\020bf\247\3309j\333S\354\337RXL\303\273rCHAo\340*\nz\003\025\241\376\265\320\240\004\347b\305\244j\202\235\240\036\262\300UJ\004\352/\017 \350\257\207\362A\320\300\365\347@\363\254\302\237\316\t<\324z3\335\230@\261\224\327Z\270\236\235vUo\017x\215\307\244\251 \303P^\353\033v\310\313\214\306\035\223\272(7y\315\206\245L\247\3235\034\306\320[\225h\021\344\001C\273\310X\030\332g\243\220\330\254\317\036qY\007\327#\216\322\303*2_\260%\353'\033K<\326\277\350\271\255\214\316\b\213\371\276\274N\013\246\224\023\213\365\327'\207\365Y6vrXw\020\266=\374l\342\362\2774k\016\225\005\342g\017W\006\343g\013Y'~\366\r\373\246c\256-\361\363\246\251\305\311\217\237\rl\227\342^\314"
+	.ascii	"\300\317\ta\344\306\202\374\024\372\301\330\3317\253\221\375"
+	.ascii	"a\260VW\003\020\030\254\201\314\262\003\030\254\177k\003\006"
+	.ascii	"[\360L\023\005\311`\375%7\231-2\313o\\h^\003\270\331g\377#Sj"
+	.ascii	"\244Q\342\257~R\262\220T\241\205H\247\016\252s<\347\324w\312"
+	.ascii	"9I\235\372m\027\322\367']/\276\271\335!}\367b\337`\260\356\224"
+	.ascii	"\220}&\354m\220|\2550B\366\213,\317\024\303*L\022\262Od\371c"
+	.ascii	"tk-\210\354\021\316+\310\0261\007\207l\021\312\333xYk\262\024"
+	.ascii	"\331!\226M\310\346Q\236\311\2500Op\213\354\234\365_\301v#\t\331"
+	.ascii	"\252\362\034E\b\324\214\255 _\227E\"\311\204\354\257=\222\220"
+	.ascii	"\275\30325\275J\310\024\223A\023\216\023\031N\001M6K\222njS\377"
+	.ascii	"\224\357\251\235\211\303c+M=*O(\036\007\201\032\250q\030\245"
+	.ascii	"0s\206\246DR\220\202\202\244\003\021\005\2041'\241\253\016\021"
+	.ascii	"\260(\210\030BDdDd(\221z\327\023\334-\234@\032\020LH\372?\027"
+	.ascii	"\265\232\220\336\216\211\222\302\250\252b\312\252@|<\275#I\026"
+	.ascii	"\321D\233\200dQ17.\317C\336\361\346+\234\216\272h\351l\323\r"
+	.ascii	"NGw\271\033b\343\326|\373}\320\204\211N)r\3140\252N\326+\366"
+	.ascii	"-\371#\321f \035\366\037q\357\203+\220\232X\223X\307\237>\307"
+	.ascii	"6\347A\264P\311\256\303\302$\312]\241\236;\307\325\213\020\017"
+	.ascii	"\017r\036\362\214\0301-\350[h\277\264\251!Pg2\341k _\271\363"
+	.ascii	"\344\031q\331\310B\002\264\375\021\252\317~C\373\323\230}X\372"
+	.ascii	"\350Y\272|)\322G\321\375\374:Xy\tzh\reV\254\360\303\212H\n\262"
+	.ascii	"!;\215\001\024\376\037\203\242\227A\305S\231\236[\262np\217j"
+	.ascii	"Qv\3226\005\305\006z\274\222*gum\255\231\342\242RY\240\275\273"
+	.ascii	"i\201m\306\204p\357\314\220];\364\227p\204\317k\361\351\214\266"
+	.ascii	"|\237Z\230\317'\200\026\"\230"
+	.string	"\302\306\003V\211jt\220\n:\306:|\225\324\330\024\255\032\343\376$\0055\254\302pj\264\204\312\212\252QI\252\214\240\212\271&\200m\225\266\336\277:\177\352\374\251\363\247\316\237:\177\324\203\277.\357\006'\0030\266\322\021\206\036=:\3319\244\334\322\177\225K\261\376\343=at\277\337\254\361\316\327\205\302\017\232\030\271{\356\312\245\204\320\3104f\277\372g+\347\n e\210\234\037|{-av!}\2237\0243(\261k\b\271\365\226x\265\267yD\031_\350\376\345R\252[o\021\372aj\311{\255\340\205L\367\373\275\346\270+\334\260W}\240\334i\200>\263\251\016\226\244\350\\\370"
+	.string	"\272|Fyf\307\244\243\301\340\211KF"
+	.string	"\316SivA\224\336"
+	.ascii	"\201X\271\244f\316\231w\356\271\177\023\323w\351\031w\036r\013"
+	.ascii	"\362\200\300A\360\241\372\227x~p\032|$A\223\243\253\371\n\267"
+	.ascii	"&K?(\302`B\215\363\024\247\021\360\322\255\256\355xZ\226\360"
+	.ascii	"i\033\303r\202&\322\365A\301]\305\235v=h\375\007"
+	.text
+	.section	.gnu.lto_.refs.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`Z\005\275\030"
+	.string	"vec=\020\317f\030\003"
+	.string	"\254\262S\203\235\322\236\030"
+	.string	"\200F"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\0378\320\017\027\323\b\206\2708\f\206`\264\b\202 P \300\243\021\372\264i\223\275\333\332\336[\246\024C"
+	.string	"J"
+	.string	"V"
+	.string	"\316\2741+\314\373\362\026x\007\274\2477D\364nwB^\274\265\246\267\343\345x7\336\322\253\361f\274\244u\364Z\274\241\025\364b\237\236\225\372*\013\352\376:jo\366^\253\347\355\254\325K\255\257\227v0\004\327\262\252\274"
+	.ascii	"V\021\013L\227O\226weEyI\326\221O\220\317m\232\327\203*GV\220"
+	.ascii	"\325\264r\254\032+\306n\253\246\215\276\317\372\361Pn\357\037"
+	.ascii	"\206Y:Gjk]\031\306{\261\212\026\264f\327\211}V\253f\202\227\346"
+	.ascii	"\003\006(\325e\257\226J\226o\305R93>A_\nehQ<\3518Y&\373r\226"
+	.ascii	"\274#\227d\212\020\370\224\367dM<\316\fd\344q\306\274\333\232"
+	.ascii	"*\003\254\247\265\264\235\317sX\222|\226\334\3004g\025\304"
+	.string	"z\262nd[\362\b\322\240\024m%\350\"]\027#\312\027N\021\322\031:\013Y\005\212\302\204%\034a\bg\206\215\017(\007\r\216A\t\234\233\021\"lBp\370\020\2745\257\314z`U\300\312r~\220\316\017\322\202\223w\n\316\255\206\312\226\306r\r\357\031V|\252\"\005\212\023&rpVoH\330|\360\320a\303\226|\206\374\350fL\232\234\214%\332\364\034\214\366\262\037\007\200\303\250\021E\346\314\314\210HARP\2224\0060Bc\f\235\365\021\020>\033\232$\355\035XH\233\222%N6\306p\022\\\banD\353R\033a\334yA\036\246_\026v\330\022\234{\222\352n\361\305\263\n\001.\024\214\262\214\317\367R\356\303\\\361\"\006L\266\323\013.I\340\245j\350\260'\022\027\271\224@\\\300\244\270\360\240G\370I[\007\252\031Q\246\372\250\256,\235n}\324\313s#\270e\006\227\214\340z\013(\312"
+	.string	"\"B"
+	.string	"\016\251\304\270\336g%=g~@\362\331\372\315\214{\363^\211\177\250t.\032\364\374\203\264\177\362\364\237\321Q1\342awxX\205y\336Es\370k\274\311\223#\204\313\036&\320\331\374\355\300.\350\032.\330\364\376&\231U\\r\312\311\307\272\313\236\233\003G\260\314\277\243\024pC\347N\355a\347k\366\247\252\004f\216\316\034\230l^L\210\230O=;<\365N\304\022V<Nl\367\376\266\004zn=\262\350E'"
+	.ascii	"\322\301~_7\"B\212}]\002\177\270\340Y\fWr\020n\210\236\300\316"
+	.ascii	"l\333\357iXcA\313W\272\264\027i\207\367\256\244\300\027\265\331"
+	.ascii	"V\3458;&\024\302\320\247\375[\"\n\266!\374\277O\177\255C\323"
+	.ascii	"1J\235\007\313:\036\031\342\3260\321\350(\322\364\201\211\331"
+	.ascii	"\037\266S5\2570R\3067.\327i\336\265\344\237(\270E\bVf\307P\351"
+	.ascii	"i\320\004\254LA\r"
+	.text
+	.section	.gnu.lto_.decls.e357364e5c98059b,"e",@progbits
+	.string	"(\265/\375`w\245\365T\002\272w\207\301S\020(F\3514\006\264\232\347\277\217w\337\254!\376^\351yy\001\202\371)~"
+	.string	"!\362\377\320\317Ce~Z\226\325\363k\005Ou)\201ku\274\246J\024"
+	.string	"\200\275%v\370\211\240\026\243"
+	.ascii	" \f\272\241\301\341\223\2332b;l\302\021F\262\345\336[J)SB\n\016"
+	.ascii	"\f\215\fY\306>~\356c.\373\330m\203\260\274:\3511\331>\306\332"
+	.ascii	" 0\257N\372\337\300\nr\2308f\374\300\372\216]\262\373\314KMT"
+	.ascii	"\355Z\3332=\330\fab*\2035\217\026#'7\003\353k\366\n\216K\255"
+	.ascii	"\323\b9(\345\023\356\372]*w.3\245l\030M|\374\227\357\222\271"
+	.ascii	"b\256\363\232\271en\230\333w\367\356\230\333\274~7\357\367\313"
+	.ascii	"\325\273f\266mR\333\266\277tW\256\035\216\021\263uR\261\234\240"
+	.ascii	"\224O\346=\273~w\311E;\312h\235\324&N\240\224O2.j\023,&/L\004"
+	.ascii	"\235$\374\327\214\355\276\341$1\333\247\034,-(\345S\t\230\273"
+	.ascii	"\206\223\002\023\311\213\225\345\375#q\315\376\021J\270~W\355"
+	.ascii	"\256\341TQe/I\240\224ae\177\211_\277\333\345\342\3453\345n\322"
+	.ascii	"d\311\331\266\314_-\177\211\177\004\023\256\337\335r\3552s\331"
+	.ascii	"\"q\201\323 -\315I\356\331\266\314\236\036\236\236\232\254f\225"
+	.ascii	":\036\375\233\267/\363\356\244<W'\375e\333\277f$\356\335\232"
+	.ascii	"\304\314Y\361\310L\255a\375{d\377b\355\337\036\373\027\307\376"
+	.ascii	"\332\335I/\226\233\3456+\270u\037\301\204g\243%97i\304\322\b"
+	.ascii	"b\375Kc\377V\220\336\301[A\372\253\264/\345\356\244\267\312\265"
+	.ascii	"r\233#\256\334\357\224\033w\364\210\3312\333\226\231\203\271"
+	.ascii	"\3208A\303\372\035\330\277#\322<8xG\244\267aw\270;)\276:\351"
+	.ascii	"\355\356Nz\335l\006\245\370\236`\375\005\354\333v\241\334\346"
+	.ascii	"\225\362\337'\267\354z\tU\233\326\266\314\233|\204\003K\023\353"
+	.ascii	"\337(\267\301\2525\341\023\354_\022i\316\340\340\340\340%\221"
+	.ascii	"~g\353\253\223\3365|\233\\'\277kKk\272m\217\356\305 \347^\f."
+	.string	"\020)\245W\252\217\263/\032\276h\352\231\266=\272i\227\311/\332?\202\t\347Y\266dm\313\274\027\203{1\310A\305\260\232@\245\372x\247w'\305\340\356\244\035\256N*\342\356\244#\356Nz\346\335I\367\325Io\t\327\004=\003\326\375Rw\016Vf\201\026\363\025\264\005\t\32008\210#\360}v\227\277\023\202\026;@Q\300_:\3046\001O1\243\362\335\030\034pS\374\267\001>\330\213\206\340\206}\360\347\002\350\274\357\221\001\361\253^\376\213\301\350a\3711\007\271\355\206\251R\277\016\202.\375\367\311g\353\257\"ebF\242\201\217\370]NRk\320\244lB0\007\277\037w\b\363\273g\266!m2\226kH\275\366\232\374n\017\343\334\022\256\t\330\346\n`\n\276a\373\313\357\262\f\372\270\357~<A\213\377*\321\362c\017X\323\375\267\204k\002\3560\006\275\357\360o \270\n\336\323L\366Ba\374\031"
+	.string	"\232"
+	.string	"\271\007\003\341)/x\300\023d\027P\245\233\346GE\204\260\240\347\017\370\267\217?s"
+	.string	"}a\246\214\340\177\001\261\316\217\377e$\311D\232\201\377>\377k\346\307!r\220\353w\377\376\333\207\363\325uZ\360\273\345E\374\352\320\346wq\270\203|\233\177\357\310Z\371\357\327\f\310v\350\021\236\362\t~u\357\277_*\366\277\233\277FQ\243\036\235\356\033\024\205\257\337\251h\376\214\006m\267(\270ai~\207\277\216\301\277\331\204\277\276\200\306\021x\235\005\224\374\371\tJ\002\236\202\277n\330&\341\277)\020"
+	.string	"\375\300\217\247`\013\376\313\004/\177\324\003\377=\001\201\235\177\177\3757\205\253B\217{\365\337\251+\200\033V\343\277%\374\327\304%\300\217\341\336\327\223Yl=\257\217%\033@\r\360u\004\374\351\227?\003\340\327$\\\033z\013\252\201\"X~\364\206?\237\200\026\375wKH\017\232\374\357\t]\200\037\177m\r\3747\002\367\204\336\021\300v\3725\n\364\370\337\b\374W"
+	.string	"\0313A3\360_\023\376\314\202\0019R\310_\236l\260\260\331\217\323~\254\366\343'\177\376\217\323\3748\360\307\203?>\363c\301_\243\375h\013\324\370\243Et\305\257oh\021P\025\377-\362\343\265\257\273\324n\177.\001\025\2725\376\253\374\357\326\237\026Ci\300|X\f\356\340\332\270q}"
+	.string	"\371\2406\240\303\036\364\002h\006??*\002E\001C\301S~\364o\025\277\006\361k\b~T\002;\036\300\360\337\023\030\202,\003\215\300\217\247\334/\007\374wyg\370o\f\177\316@\n\354\345\252\300"
+	.string	"5\001\374\352\214_\367\240\020\370\263\225\377\236@k@\037 \206\322 \201&\212\002j"
+	.string	"\324\207\257D\002\376\r\004w\215wi\344\016\375"
+	.string	"\177\311\221\370\325\"\306\377\236@\376x\355\177\335]\266\335\b\364\215?\227\200\277\216X\357\252\020&\203\005~4\206L\303\345\340\026\360\253X\032\347\317\023\240.|]\370\357\027\250\001\016\2607\220\257\240-\340=\224\205\377\206\341\036\017*\370w\r\277\373\b\\E_\200\363\357\004\\\256\374\345\277'\320\025\376\233e\344K>\002M@\236 \263\330\027\300\310{\177\026\363\243*\374Y\n\232\302\rCQ\370\357\t\275\020\277\032\367\337\024\376\013\343\277'\276\226\376\033\343\307`nV\b\025\320\004h\341\340W\321\362\221\037WA\017\200C\\!or\203D\320c\200\037\315\277\313<n\377\r\273\332\312\352\372\321\021\256\326?\020_\227Yp\031\300\2576\311OP\022\356\024r\203\270@M\374\237\300\377\017#\"@\005\200\005"
+	.string	"\277:\226\231\027\353\tJ\202\017\233\207_\3151\205\216@A\327\004tx\340\032i\271_7\310\357n\230\217\036\007\270\201\226\270\036\370o\007\376\333\376\367\353b\375\316(\305Un\016\250\bx\n\013\325\204?K\241 \374\227\305%rU\020\206~\360\343/\026j\r?\256\340\376\270]\377\005\362\347\f\374\031\007\355\340\317N(\007\304\377\022\301\302\020\344 \350\006\377e\361;\f\\\037\371\352\307U\204~TD\326\372\340WS\374\270\311\217\331\356\362\013\2439!\022\"\017\375\330\353Fp\275\376+\301\177\203\334\236\363`(\370\213Ez\367\353\033\270\247\316\003\013\365\203?'A5\270\313\255\377u\231\370\237\202*_,T\343\237\315P\235\r\356\362\277_\031\374\250\210?\263\260"
+	.string	"\005\221A"
+	.string	"\371O\302\257\306PEi\301\257b\360k*\224\202\037g\271\362\347!\272\037\367\240\023\374\230'#\375\371\305\217J \201\024\r\361\347\244\037\005\361\343*L\032\374j\004f\250\016\363\346W\215(\370q\0168\352\307;~\314\301\217\247~\314\363c\r\374\030\352\307H?\266\242\372\361\007\034?\336\340\307?~\274\203}\350\300@4\370\361\306)\005\350\207\377w\371\005\017\376T\352\307;\330"
+	.string	"\030\001\377\357\260\007\227"
+	.ascii	"\016\300\rKo\374\357\313C\024G\001\232\307\237C@o\262\004P\233"
+	.ascii	"g\223f\266\341u\277c\361\277\204?\245\273X?\376\220\365g\034"
+	.ascii	"\376\234\303\217\326\374w\310\177\003\360\021\250\360G\321\037"
+	.ascii	"\315?\376\372\035\231\037W\220\376[\347\317c\320\373\343\016"
+	.ascii	">}5\277z\367\347\023\350\365`\006bzp\210\037\213\370\361\005"
+	.ascii	"7\254\231ix\317\237\"\321F\277>\322.\322h\030h\356"
+	.ascii	"p\217\376\300\377\021\372\t\303\024\356\200q\376\033\346\243"
+	.ascii	"\237#b\370\363\003\376\\\303\257\317\374Z\360\3077\377\265\373"
+	.ascii	"s\001t\236\363\303\177\237f\240~\376\231\206\037\367l\360\f\376"
+	.ascii	"\364\347\277\230\377}\377\227\374\337\343\273_\230\037c\360\347"
+	.ascii	"\002\350\2741\377\353\356\244@\227\371u\237v\3767\354>\337\340"
+	.ascii	"Og\220\371S\337\370u\230\373\006\346\277\317!\370\323*0z\n0\302"
+	.ascii	"\021\344\002\350<\355\345\277\317u\376\264\003?\316\340\307\021"
+	.ascii	"\374'\363\037\314\377:\234\363\337\271\374\301\237>\317\371S"
+	.ascii	"\027\277\276\3735\227_g\371\365\333\257\323~M\366\353$\277>\362"
+	.ascii	"k\255_c\375\372\352\327U\277\236\3725\216_/\375\032\351\3277"
+	.ascii	"\374:\371\353"
+	.string	"\343\257[\374\232\350\3273\374\032\003\277V\361\353\364\317i~\315\376\372\002\277\266\300\257C\374\032\002\277N\361\353\030~\335\200?\233\3715\003~\355\302\257Y\370\365\316\257S\370\365\001~]\200_\223\360\353\022\277\366\340\327\027\374Z\202_C\360\353\234_\257\177\356\373\265\372\347\301?\377\375\231\314\237\365\376,\346\317\\\376\254\345\317X\376,\367g\270?\273\375\231\355\317m\177V\3733\363\317g\177F\362\347\261?/\377\334\365g\256?k\375\031\353\317=\376\254\343\3178\376\254\3743\323\237_\374\271\003\177v\361\347\034\376\234\374\363\361\317D\177\006\372\363\004\376\\\303\237e\3703\f\177~\341\317\013\3703\212?+\340\317\b\370\263\001\376;\365\337\t\374\367\306\217\367\376\033\343\277\027\370o\362\277\r\370\257\317\177\373\376\273\342\277D\377\345\300\177\217~\334\366\337 ?\326\377U\362\337\355\307\373\3075~\f\344\307\t\370s"
+	.string	"\376\377\375\331\304\217\201~\374\377\346\3757\360\277_~,\301\177\317\374W"
+	.string	"\177>\341\307\035\374\271\204\377\372\375\267\314\177\001\377,\302\217m\376k\344\317!\374\030\304\237?\370\357\333\2377\370s\317\237G\374Y\3778\002\377\205\340?\317\237'\370\357\211?\363\374W\304\377\b\376\033\366g\020\377\365\361g\017\377\355\3713\316\377&\377G\374\247\340\277\334\377\016\376\373\374\267\352\177\335\177\003\360\377\356\3175\177F\377\234\377\214\377|\177\354\3741\337\217\305\374\030\314\217\365~\374\345\307y?\366\362c\274\037\337\375\270\313\217\271\374x\313\217\265\374\330\356\307V~\\\367\343*?\246\362\343\270\037O\3711\334\217\337~\354\366c)?n\3768\312\217\241\374\230\310\217\277~\354\365\343!?\026\362c\256\037o\375X\353\307Y\377S\374\030\353\307A~\234\302\217Q\370\261\002~\034\200\037\367\374\030"
+	.ascii	"?&\361\037\360\377\363?\227\377t\377\0370888\370{0\345\347\031"
+	.ascii	"\372m\030\021;\200\344\3418\253\257\261-/\270\r/\260\246\007"
+	.ascii	"\031\253\244\2731]\260\030\034/|MN.\330\313\226\214\224\327\242"
+	.ascii	"\256\346\264`A;\273?-X\353-\250\225k\027\325\241Mb\022\246\016"
+	.ascii	"\305\202^\271M4\013J\007\003\2253\241\244\\a\334\201qfA\3474"
+	.ascii	"\027\005HK\255f\242\327\023\242\247\347\006\006\326\226\333\326"
+	.ascii	"\007!\266\017\242\310\376Q\271;\227\346x!\310f\345\342m'b\354"
+	.ascii	"\230\252\254\177S\320\314\250\344\301\270\fV%\bVe\n\036\333\252"
+	.ascii	"\322f\006\016\037\271tKnd\275Q\271\361\334\2009\203%\213\024"
+	.ascii	"\314\325<qd\007\230(G\241\034\231\221\244\013\3266X\236\\\300"
+	.ascii	"\220\244Y\212\3359\2443\027n\tj\306D\206\023_=\235F^\304X\266"
+	.ascii	"-3\211`\\\030\0320&KK2\r>'\031\340\023t\re\2022\3216T\reC\233"
+	.ascii	"\240g(\032\352\004M\273Mt\t\252\004-\303M\230\254\304\022t,\320"
+	.ascii	"\331\266\314%\350\221\301e\3332{J0\213q%\201>\210\255\r\002\307"
+	.ascii	">\b\246}\235\347\276\016\230}\235,\373:\315}\235\262}\235\345"
+	.ascii	"\276\216\325\276\016\324\376\321\"\017\241\"q\363\021\0043\001"
+	.ascii	"\221d5\261\376m\242_N^\314%Yj\256\264\2712Y\274\320!:\246\300"
+	.ascii	"\244`\315\274\317\032f\201]\327o\315\201\246|\022\242\221\270"
+	.ascii	"2\031\272u\245he1u\214\312\325Z\226\215\024-l\020\013\212\205"
+	.ascii	"\006Ij\2711\301\372\006L\035VS\t\267(K3'W\2348\264\026\324\306"
+	.ascii	"\265\213B\271\200Aq\350)llt\315\3465\323msQ\2544\311\242\227"
+	.ascii	"P\356\034\222\034\346\361\227\200ks\2428\364\025M\344\211\263"
+	.ascii	"m[\024\207V\253[\2428\364\032\026\034\330\b\212\363\n\225B\247"
+	.ascii	"\320(\364\007Z\205\372@y\240=P*\024\b\232\003\335\201Z\241:n"
+	.ascii	"\023\305\241\261\350,\272N\333\241G\240D\351\211\320'\001}\201"
+	.ascii	"*\2416P\030(\324\227%Z\003\275q\233\250\215$\235\246\231\240"
+	.ascii	"6\364\0264)3\2270p\321\323r2\330\210\244\332\006\r\324\024+\254"
+	.ascii	"K\240MS_\244\234m\313\274fhS\017'\332\244\361x\344\351X\242N"
+	.ascii	"\350\023J\003eBg\240\312\333D\233\320\030\250\f\364\005\252\024"
+	.ascii	"\367\227@\233\264\227\035\313\266eB@\211H\031\216\326i\267\211"
+	.ascii	"\273\223\376C\340\276R\356N*\301\325Iyp\252\370\220\272\202\365"
+	.ascii	"\265\024/c\316\266e^3<2\247~\313K\2624\373\323_\304\234\372\211"
+	.ascii	"\363\316\345\264"
+	.string	"\345\206\201&D\377i=\035&3\227,\\\205\351?\355\247\3512s\271*\241\2259\245\354y\361]\274\253\256\2621\\\372O\213\271s8O\035\332$\244!\313?\335\267\205F\233A\217P$\324\bmu\032}F\003jA=\250\003\365\3636\365\237&\243\313\3504\315D/\177\334\364\247\271\350.\231\271D\201\246\304\331\266m\217\356\343\342\264\243@\377\003\230\375An\377Cs\377\203\332\376\007\346\376\007#\373\037\272\366?\360\330:\314\333\235T\f\254sS\211k0\250\024]\025\027\326\377Pc\377\003\214}\017h\366=\360\355{\300\333\177\336\235Tw\321s#4iaa}\017s\373\036\246\354{P\333\250\224\273\223~\356\352\244\036\302\366=,\367\257\251\\\323]\317] \002\0344]LuXk+Z\356zNW\321s%P\265\355\221\236\3139\323\266G9:\311\225\327\223T\337\003\327\326q%\256\251X"
+	.ascii	"%\316\rk\365\352\244\367p\265\357\301\306~\336\335I\357\241\335"
+	.ascii	"w>\367;|\331\3570\267\337a\312~\207'[\204\273\223\276C\222\375"
+	.ascii	"\016_\373\035\256\366;\330\330yyw\322\0234\332\210\235\004\307"
+	.ascii	"F\266\004\006\332\\\222\2433\246p\n\214\255*\254s\362\300\336"
+	.ascii	"\224\fi2\241\210&\202c\324\241m\257b,\311\360\326\225\f\247\036"
+	.ascii	"\323fZL+\321e:\311mj2\r\246\221\\f\273\224D\246\303.^N[\356&"
+	.ascii	"h3\234\232L\033\341\262\264,\241\311\364\227&r\355\242\332\366"
+	.ascii	"\251\204\257\257\301#\317\266m{z\362\025\247\267#8\3729v{\025"
+	.ascii	"b\371\223Zb\375\034\271\375\034&\3739d\3739E\266&\362k/\275<"
+	.ascii	"zI\t\331<w'\315W'}\316\325\376u\327\265\020\031J\3124\261f\332"
+	.ascii	"89qQi.;\314\005K\023\322\026\211\033@<\2440\254\177\255\245\263"
+	.ascii	"P\245\220%Xt\020=\245k\350\034Z\207\256\322TZJ\003\32184\226"
+	.ascii	"\356\241y\350\031\332\207v\322O\372JG\351\033\332J+5\r\275C\333"
+	.ascii	"\320P\372\307m\352,-\343\232I7\341%\314\224\301\324vK\273f}\305"
+	.ascii	"p\n\3363I\226HXi\206\222\216\341\265"
+	.ascii	"\345\314O\330\256\235\027\026'\224)^Q\240\224aGSK\214\204\223"
+	.ascii	"x\3443\235\225\323\262\232^\213\227\216d\261\314\\\252j^i\004"
+	.ascii	"\321\210A)\237Kc\271L\310wFg\345.\031\315\345#3\352\261|A\243"
+	.ascii	"\355\332y]\201R>o\232v\205/!K$\f\203)C\321YYJ\206\313\314%\013"
+	.ascii	"^r\316\022i\264\321\007\257.(\345\363\246\271\203GO&\276\274"
+	.ascii	"\240\224O}\244_x\tq\346&:+;y\\>Sn5\257\272\034\247\263\262\225"
+	.ascii	"L\207\223\304l\215>4\241\344&:+\257e\261\324+Og\345,Y\013\216"
+	.ascii	"\021\2635R\275\330\310tVff0#as\217'\355\263\301\266\303\204\306"
+	.ascii	"e\230w'\005a\355\352\244\317\321\001C/\325\204\271\201\251a\375"
+	.ascii	"\034%\030\177:\351f\313\325\335]\235Fj\356A\335\356\301\0311"
+	.ascii	"\334\212\f\342h\355\377Y0\237\271\315\214\346\031M\006\223\003"
+	.ascii	"\363\231r\006\257$N4\371.\3535\307B\364\364\324,\335y\351J\365"
+	.ascii	"&;\323\242\266\007\350\304l\231L>S\356\267&\202a\002\227||\313"
+	.ascii	"2Y\314\363\231\3772`\366\313fn3\227\311\316\347-\231\3135\317"
+	.ascii	"\332\004\270\304\206\215\036\223\373T\032{[G\260>N\323\230\233"
+	.ascii	"2\3737w\3737V\366o\330\366o\224\354\337tm\255\327\246v\300a}"
+	.ascii	"\022\234`\rz\311_n3\347e\274\234\207\2338Y\202R\346\034\371\311"
+	.ascii	"\030K\365o\242\366o\230\366o\214\366\245\272;)\210\253\223f-"
+	.ascii	"\177\276\222\261\\\273\013\340\256-\263\027X\347\272"
+	.string	"\022\317v\253\227/q1\260\0361(\2701\263\275;)\211v\356\231\356\317Tr\225\373\304T\333K\333\024\r\254\263\\\211\347\271\232$\033O\206`\275\202\3319\355\335I\257\363\352\244$\250\354\366\237\337\242\344\346\265\273\300:F)\345\013\353\354V\342\371\3556\261\021\245\005\353\004\274m\335\352\244=\312\253\223\336\206\311\276M\330&qw\322\333\004\331\267y\332=R2\223%\031-\203\331P\335h!y3\202\365\235R\342\231I\226BE\351\f\326\267\201\261;0\357N\212\227\256N\332c\227f\007\300\356\352\244YI*VG\205\n\353\32783Y\r\336\316b8\207\345$\317b\031\211MR\026\303\271\027\0034\256\353\b-\325\257\261\333\257q\333x\211\221\2156\254\177\265\\Yq\302a%!\313\232\302MNP\304d,\254\304;p\222\230-TN\027\030(\345s\013w\325\260\rf,\354\225\203\230PR\316"
+	.ascii	"\005\020\363\230\302U3\362\234@\240@!\373\321\325t\322\375\327"
+	.ascii	",ca+\\5#\013\224\362\251u\361\256\335Z\253\273d@)\3032\026\016"
+	.ascii	"\262\006\245|\016\311_y\231\273\362V6\222\271\262\220\234\225"
+	.ascii	"\213d\"Y+{\335f\306\302C\216c`\031<\333N\n\327\025\005\372\177"
+	.ascii	"\376\221\201\334f\016\222\257\216g`\032A\260W\266\312g\312\035"
+	.ascii	"\005\314\027g\220\313\226{P\200\264\204\202\021t\266m\313\323"
+	.ascii	"\323\223\242\301\322\327$\325\257\031\313U\332,\214\211\207\365"
+	.ascii	"k\200d\252\036\230\b\036\003\023\350#K\345\251\314#\353\3109"
+	.ascii	"\362\216\034u\233\271G\356\201\251\340+O,\330\317\204\2222\005"
+	.ascii	"\023_N\3122L()W6\2660\316\334c\0060br\017\254\004\307\261\001"
+	.ascii	"\346\036\231)\3430\241\244\214\201\t\2143\367\300\177\031)\237"
+	.ascii	")W8\246=g\333\266=!ztT\3303\353\203F\373\230\274a\345\032\230"
+	.ascii	"\355\332\341\030uh\221\276\320X\346\032\231F~\312\314%\013ZN"
+	.ascii	"\331F\276\221\241n3\327\3103r\215&\365H\313\366\265u~\372s\023"
+	.ascii	"\346q\355.\020\201\f\200D\310\260\316N%\236\225:\2512\212\231"
+	.ascii	"\223\206-\t&\301Zxu\322\327\360\330\257\211\261k\256Nza\232\315"
+	.ascii	"\223\003\245)\205\b\326\031FVr2U\"\303\330\341\214\221\227n3"
+	.ascii	"\303\310/\332l\302\366~`\245\372B2\373B\274}\241\226\315s\323"
+	.ascii	"\344\370\346\260\376\205c\303h\306\234e\200Zb\371\b\247\311F"
+	.ascii	"x\3606s\213\003\177\315\260\231\266\273\260en\361S+\311\362n"
+	.ascii	"\261\341\244)\024\304g\204D\226WWX_x&(\f\262/t\332_\003\367W"
+	.ascii	"/\373\266w'\205kZ\371\201u\2263p}\230\rk\321\nt:q\031L\006\217"
+	.ascii	"\271M\334\207\371\216\233p\022\356\303\\\260\230|\246\214\341"
+	.ascii	"\313\323\331\347\004\2153\033\261\301\305C\250\277\266m\2473"
+	.ascii	"(\203`p\030\254w\233x\017\343\035o\271p\327e]\346\234l\370K>"
+	.ascii	"Sn\270\030tx\017\3379\221s\366\364\2442\274\234\bn\355\005\347"
+	.ascii	"\34563J\236X\177\355\362\262\326\330_\221\366\267\337\376\346"
+	.ascii	"\262m\256N\212\355n\260\3040A\253\333B\366\267\324\246K\321\344"
+	.ascii	"\310\n\326\337J\0337Y\301Fp\230\t%\345\312\304\226\304\211\255"
+	.ascii	"`%8\316\204\222\022\0066\2619,w\233\330\n\256r\274\304_==<5|"
+	.ascii	"d\316\030I\365U2\373j\336N\313p\205\261\302\372\227\354\277f"
+	.ascii	"l8J>S\356&\230,\347\332\324\322\311\305\303I\352\320&q\361X\342"
+	.ascii	")\270\211\245`8\374v\233\330\r?9n\302d\347!\303n\270\t[\0177"
+	.ascii	"l\004\253\231PR\2564\330|8{xzz\264\034\031\25146\272\rC\241\201"
+	.ascii	"\214\333\031\326W\243\264\251k\373j\221}5\310\276\232c_m\332"
+	.ascii	"i\230\t\332\315\261\266\246\343/\r\255F\356\314\227#x\3111ZM"
+	.ascii	"^\325\222*X\337\017\237\375_o\302\320\350\255\231af\346\003c"
+	.ascii	"Va\375\324\313.\273\001\302\305H\231\333\304ex\b\263\345\331"
+	.ascii	"ZGg\236X?\235\333\270\275;)O\212@+=,v\2338\t.\302\223\004\033"
+	.ascii	"\301a\327.\212\331B\325\260\225A)\237m\313\344\351\311\300\310"
+	.ascii	"\240\025\2551\022\264\213\023\326\031\254\237:\331\277M|\344"
+	.ascii	"\030L;\221\312\272\302\032"
+	.string	"\203]\214MK\001\272\305\310\220'X?e\356\247C\366\323\037\0333\357NJ\342\352\244Ou\354\2473\260\220\034<\2679&\326G\317`.\364o\037\325\333G\263\354\243n\373(\332>\332\265\217f\355\243U\373(\323\306=\260\217\333\344\301T[\220h\360\300\372h\322\376@{y\322\017^\236\364\232o\337\312\335I\327\204F\002\337\252\260\024\256\201s\\\273,\005$\t\343l\333\366?\326\201\243n\023Ka\250\265\266mO\302_\002K\341\247\213\247BY\342-yzr\220\345\236\225Tc\033\370\306m\206\3008\332\234\333\227\205\364\204\3655s{\240mo\210\364\016\016\336\020\3515\330\276\236\332\327K\373\331\314~\376\262s{wR\021\256N*\302\312F\231w'\275\225\253\223~\300D\333\317F\366\263\326~\236\332 P]\235\364\001z\035r\276\233\266\263,\036B\262hi9`\314\340\22104\036b\364\230"
+	.string	"\001\262b\335%\255S\n\243\301#am\033E\342\306\250Zn\255A\276b\211\361\311\200\3622gV$*\210\220\253+\225y\227\264N \340\252n\216\256\246,\341\341\303\307Z\305Ce4\206\204\233\333\340\221\355\344k\306\216\225\352k\225\023)36"
+	.string	"p\024\365G\255SwI\353\264\223\246F\314 \227\246\225\307\327)\031]\316\350\300z\335\261\352X\245\306\310\370JC\306\212#\343]f\033Ee4f"
+	.ascii	"\2023\202\224y\266KQ$j\316\230\316\264<}\305\361\365\306\b&|"
+	.ascii	"/\354\b\336\021\326\253"
+	.ascii	"\215\343Daysb\375\025j\255\001$\r\t\326'\361\266\377\301\377"
+	.ascii	"u/\301\361\364\204\365\252\374\0366\262\3274\006\353\325\351"
+	.ascii	"q6Q^\236X`Y\256\270 a\2756}\235\361\257\353[\017 VX\237\304\223"
+	.ascii	"\375\257L\377\252>\301\333\261\304\372$\230\354\223([_\254/\326"
+	.ascii	"\245\333\201\211\304%\306RW\251\363\322\265\302\370\272T\023"
+	.ascii	"\350&\304\b\353U\211D\220\375|\256H\317Im\017\261\324\306\f+"
+	.ascii	"\"\317\266\215\"\221\347\224G\310\006\277\"\255GPmf\216\260^"
+	.ascii	"\215p\364\334\316\250a\375\021c\326v\247\271x\302\035H\266^`"
+	.ascii	"\275\321h\256&k:\006\261\336\200\373L\313td\206\365\026\304Z"
+	.ascii	";R#\r\353\217\210\262\177\233;0\305\231\362\"\216\310\b23f\376"
+	.ascii	"\314\216\322\370\350\302\372#\254\312\224I\343\266\237\022(\345"
+	.ascii	"s\223\005V\001\326\350\353\303`\270m\333v\251\312\371\355p\302"
+	.ascii	"\330QD\020\353\217\200\301\307\267\235\230\252m[\245\026\007"
+	.ascii	"4~4\234\353\331\331\233\021g.\233\361\326\001\2310a\366\336\352"
+	.ascii	"\027CX\265e+oO\277(\022\203\t\353w \367\345\313\326[\001 w\206"
+	.ascii	"J\02063\254\267\236\036\022;/\254\337\301\230\027/*[\013U\326"
+	.ascii	"\275)N'\257-[\366]\b\270\232.4\246\261.\337wD\354\302\200a\275"
+	.ascii	"\271\3403\324\306\214+B\354\256\314\204ib\375\016\254\366\257"
+	.ascii	"\330\335v\267\271\355R&t\351R\275p\313\262l\225J\036\274\203"
+	.ascii	"\034ss;\313u\223\203R\206\241Z`\370\240\202\345;\213MV\2300I"
+	.ascii	"X\357+\251\222\020\273,KXo\272\016d\304\305m+faw\306\2170C\252"
+	.ascii	"|[I\243\236KRXo*\251R~\302g\203\f\007h\3346\234\033\006{{\303"
+	.ascii	"`dd\330\f\226%Y\303\372\034\214\331\347 K\263Y\267\364\004\n"
+	.ascii	"\024\f&7\307\301\222\215\r\243\211\265q \345\304\311nb\026c\345"
+	.ascii	"\332\263!\003\353s\300\224\226\266\233\354\210=\241\224\317<"
+	.ascii	"\206\253mI\355\273\t\216\2173HyXo&y\t&\253\r\207\245km\226\325"
+	.ascii	"\0313\263\275\344\266\312\266\215:\200T\327\222n\351\304\004"
+	.ascii	"\353"
+	.string	"\275\344\b\263\256\b\326\233\211\317j\232\216\210E\001\263\267\222\255\004\243\205\220\342\021\303\255\256\t\353o@\007\006\266\307\310`0V\226\344{\f\237\321h\241\324\260\336b\370\354\257\314\022\033X\357\260T\351\377\212\201\320\220\003\304z#!\002q\226a\275\217\\;\2412\310\016%\0338\331Ev\221t\253\310s\003\257\275\273v\327\376\272m;\325\334\313\357\257\335\004$j\b\326\333\213\316I\340\036\326{\310\376\241\022yq\304\003\353\373\2259y\032a\375\r\236\252\2526W\216f\016\232\345\230\252\255o\256\233/\244\246\022\353\255\205\317\2544\211a\275\201\354,%E\316\254v\326\306z\313\201d\t\272w\346\306\364b\007\301P\350\032\231\2613\254\357\267\177\374_{\244TQ\331?\366\325j\346\253\251\313\276\332VEl\374\310\201\265\025\252\004-\373\333\245\033XlX\177\003\243\315\203\307\366\261\333\233\243\013J\031v\377"
+	.string	"\373\374z|\373X\325\224\2027\260\336S\370,g\354\211^\2152Q[G\224\312&%\245\262\231]\201R\206)9\302\322\302\372\032x\331\327"
+	.string	"n?m\034\373i\337\330P\033j\337\330)\"\265\343\240x\330\3306\276o\344\200ir\203\f\326\273\206\006K\3665\330\332L\233i;\221\341\340F\023J\371T\323\204\351\030\243\361\355\264\305\016\311\006\326{\006>\353\333\241\305\204\365nJ\245P\2533}x<\270\310\246`}\r\246v\214\030j_\013-\b3-(\345\263\257\356\212\023\254\257\201\3236\3320\266\321V\332G\373h+\305\001B)\303jp(i@\331/\276\225\242Du9a\275\223\360\231\260H \036\031\2547\222\006G\373\031\210\001T\007\001\3254\201\201j\032"
+	.string	"\300\211\271\021\202\344\005\033\326j\232\214\306t\304\207\265z\006\237\325t\301\342\353\201\265*\250\273\360\376\332\3642\260\333\317\200\315O\375\363K\267\314\230I\267L\250\222&\203!\373\031\310p\252d\234j\337\2301j\037\b%`\242H\240\315g\2265\254\373\212\\5a}\f\320\354c\360\345N\005s\247\212Q\305L\301\315\311a\255\206\301\303S\365n\253\274!\003J\371\374rU\257\004\215-@\260V\363\360Y~\232+#\207\265\352\345\342\241o\314\260\033\030L\331\307 \214\013\227@(\345\023\003\033j\235Z\247j)QC\nJ\371\264\273\252\005\337\b\002\027C\304\337V\351T:\025\313m[4SW\256b\321\\\352]\r\256#\021oqq\252\334\324\022\2242\314\312U\271"
+	.ascii	"\034!\371\300Z\255\202\315^\030\335\231\301Z\245\202\317\232"
+	.ascii	"8\244\242\2505\311\371 \202\365E\204\301\301\251:\244\306D\340"
+	.ascii	"\210\022Eu{\322\001\245\f\223r\325m)\313\222\036\326j\023\237"
+	.ascii	"\3210S*S\251\364\213\221*\030X_\004\322\232\332\266\246\2629"
+	.ascii	"q\242\262\t\246yr\225M*M\034\333\005^\366/HCCS\3250\360Q\006"
+	.ascii	"\245|2\271\252\006\244k\314\020\254\325\264\021\230\214\254]"
+	.ascii	"\300\245*Q\317T%*S-S\313Tf\034\240jv\225y\343\307\304\256\354"
+	.ascii	"\002\032\373\026\350\251D\3240\225\210:\226\344\352\330\333\017"
+	.ascii	"\276/\254U\261\"ET$\025\030\002\245\f;r\025\2110\313\017@5\254"
+	.ascii	"U0|&\\\242f\366\206\265j\304\002)\373\026xyy\251\313K\347\005"
+	.ascii	"\245\fS\2271\310\264[X\337\002\243\256\256\r\310\345\251\\*\227"
+	.ascii	"\332C\003S\025\254ii\251:\310\264U@EE\245b\221\220\313\242b\251"
+	.ascii	"A\216|h\375a\255\002\321W\304\b\266X\277\002%\365\207j\225\336"
+	.ascii	"\320a\330\206`a\255V\341\361\340\241\366\330\200\216\251\253"
+	.ascii	"=\3261+*\300\266\250(U\207\006"
+	.string	"\364T\0358f\324\250XmAA\2518*\200\346\306U\034:\213\217-_X\2536R(\27235\362\260Vk\240V\322 B\254\224\024(\325\031\352\fUY\003\035\2242\314\351\252\362:-\245)\303Z\245\261r\321\241\347e\202?\025\206\nCe\252\342\003J\371Te\\e\332Siin`\255\306x\034\016\024\"N\310\260V\227.\336]\302\2422\3122\250\276\030T\223R\265U[5\211\2069(e\230\232\244\251\214Q\301\302Z=R\207t1\002\205\265j\204Z\201\361EJ \326\367C\255\374_\037\320\205+\020\353OP\266?A\2163\251\330\231\024\315e&\031\2151\001\213\222\024\215\004\200f\322@3)`\007\177\177)\340\332*\37360k{>\005\274x\231\215\313G\222\004T\366%\020R\246\fF3A\211\224\0048\370\370\322\276\f<\201R\206\215y\332\227\333\210\320x\302:u\342\263+F"
+	.string	"\1778\375_\205F^ }\301\372!\316\354\273\273t\357\266m\031\021n:\322\2754\314\372\025(W\246\227\202A\231n7\264`\375\020]\364\362.^\016\027\030d\312\260N\275\240K!z;\276`\235\342];4)\3176\204\033\226\224\013\226tK\226,\351\226\022\300\234\240\224O-O\267\210\311\331\"H\003Ij\367\2065e\214]Z\227\206\251\032,K\353n\036^\272\202\006\013\353\207"
+	.ascii	"\333\017\001\265\345\344R\272\003\310\230{J\027\3074\307C\214"
+	.ascii	"\347o\277\245T\336\322*i\333^&\225\223\262\215"
+	.string	"R\222H\253\300\301\245q\267U~\005Ny\032\327\006\347\003\t\317\227}\236)R\244`0\001XA\333Q\242\244dc=x\270v[[\372$\205\036\017\216\275\266\226>\021\001\316\013J\371t\362\364I\026So(\321\273\202\365\375t\327\025\226.X\260>\217\322\222%\251Z\230%\223\247jL"
+	.string	"\343\322\036W\223\245\356\251\204u\212\346\301TS\013\353\373e1\031Pp=\260~\004|L\346\023*\273\254,%3"
+	.ascii	"\222\261e\331N\222$%3\201n\354)\031\0264\363\004\f\353\373=\356"
+	.ascii	"\377\252o\270\215a\301\372\021d\355\260\260tk\033],J\"x\332\177"
+	.ascii	"z\344)\222\271\013\264-3\255:\353\212\303z\204\022O\217L\251"
+	.ascii	"\002\304:%\222\026\271\315\323\245F\316\314\301y\203\341\204"
+	.ascii	"\016\353G c\377\236.\375\300=]\372\247_i\227\220#e\276\274\274"
+	.ascii	"R\254\333\266m+6\006\245|B\340\334\177*\344\267\231\nI\273\326"
+	.ascii	"\245\266\205\332\340K\t\224\362\331*\225\036\344f\031\251'\254"
+	.ascii	"\017\301\227\375\247\\\351\326\005\222\004\344-\325z\272\245"
+	.ascii	"By\342\245\213\331\3775\263iQ\345a\375t*\355\361\324\307S\037"
+	.ascii	")\326n\333\326\210\331:\r JI\342O\203<\305\302\341S\242\206\207"
+	.ascii	"uj\225\002\371\023S2\345*\375\201\231M+)oWU\027o0\360\311\021"
+	.ascii	"\326)\225\346\372\277\332\224\271B\323b}\277\213\367\177M\263"
+	.ascii	"8\235\t\304\372\020 \331\377\357\361\237\266G\312\266m\241Pf"
+	.ascii	"\253D\262I\377\373\213\336K\342\277\271\371f\360_\377\0240\266"
+	.ascii	"\355\013\274\260\266mo\231]\244y\264CD\213\332\265m\222\225\221"
+	.ascii	"\002\254\236\222\254r,\245Y=yXJ\263j\215\222\206\030yP\266VF"
+	.ascii	"Kim\353!)\311h\005\252\247\245\264\243\326\303RZ\373\324\276"
+	.ascii	"\330\362t[\246\225Q\233D\325zh\223\332\2436\215\352I\304R\222"
+	.ascii	"\325\323R\332\321\223\207\2454\253\2476\315\252\355\320&\035"
+	.ascii	")c$\265J\017m\232\325\2306\215\352\251\303R\032\325\323R\232"
+	.ascii	"\325\225;DF_\232\033wa\\On\325RRKc\006\217#e\007\273%&U\233\327"
+	.ascii	"\266wM\251U\266vm\233A\333\362\240R\346\035\345\270R\220\354"
+	.ascii	"h \265\035Q]f\333\266!f ]Q\265IvF\267\265[2B\325\266F\220V\264"
+	.ascii	"3\332\266mK0b\332\265Z\327\316\350\007\217\266I\251m%h\231m;"
+	.ascii	"\243m\215nk\327\266\255Q\333\266\252\222\007\263mutXZ\316\230"
+	.ascii	"\321\266Q<3Z\036FnJm\213\327\364\244<-\245]Q\225pSK[\2660\230"
+	.ascii	"Fw\251\211\252]\266yV\312\235ft\3266\265m{\311\354\345S\215>"
+	.ascii	"\035\351\216$\2512\"X\037\202\027:R\034i\216\333|\\\032\245U"
+	.ascii	"\305H\013\353\357\240\3318\264m\333"
+	.string	"\336\307\245\352\343\322\032\251\215\034\032hU\364\262\324P\246OB\277g\02756eJc\203m\251\335\300\372;B\322\031M)\323\325\217/\275\245\247L\177\032#\225QAN\027&\\\310`}\303\356N\032\301\325IS\030%\236.\335d\t9\322\304\032\202T\351\351\2131\033A\204\2649\253\233 \330\215\244\0368\3130/\245\024\351\n\224\030Y\254\260\376\323#4\260\210\332\225\034~R\1773\312\354p\366\371X\232qB\003\321'\032S J\346\332]\273\250\326hL\tE\336\364\246<\323\240\202\350`j\204\242I[\364\314m\242\201(\340\263\323\245;ff3fo\316\016\372;J\373;F\373 \004\367A\374\355\203\030\263\017\342\313>\b-\373 \346\366\217\216\3118\276\306\002\347\234Q\n\340D\211\203O\314]\232 \026\326\350\036\216\340\026\220:\254\017\202m\377h\230,\243L\026\222*`\374\320\274\035J"
+	.string	"\365\352\276\244\341\260&\001E\242\n6\205\236\241\240\342\260\005b\221\03044\276PA\021Y\224\002\322\205\034\210\310\240\0264\260CD\241\"\rG#\n\025\222\254\212\034\210)Z\024!\223\304\242\013%\214>-h\b*\026\031\217+\233\003\321\250\001\037\241\030\216\254\006\2142 \2116F\237!\242\020\0058\260A\023\2708\032\211\330\006$Y\026V \207-@\300\262"
+	.string	"*Ja\005r\330\002\004C\304\241O\320\220m!yd\221E\027\206\206\214-j\330!\027\311\024>(\2400\372\260D\303\342\221\275\241h\004\372I\016\205*hA\004tL\"S\366X\324B\267 \002*\036\223H5)\\!\311\262"
+	.string	"\224<\342\270H\266 :\021\342hL\016\213D\242#\353c\201\213\026@D,Q\312\303C\374I\016\205r\202\214@l\320O\210!{\374\351\360\025 \250(\022\217Id\blP\321\020P\221\030\302\021Y\024\002\004CCE\305\242\261\250j\300x\\\2214\026U\241!;\244\223,\222\210%J\2215\024\211*X\033~\276\002\204\020\220G\n\""
+	.string	"\312\340\307\303\221\025\022*J\201e\217.\214\307$\222\r\252y!\311\252\370\321aU\260*\204\214l\rP\262\250\205\020\t'\224"
+	.string	"\241\005\025|jH\241\202\260\310\2660\262 2\266\250\0312\266\370\220$\026\211CCF\031\220!\204~\220G\"\212\240\"Q\250C\0229|\301C\022\007\026\206\240\"1gh\210M\036\211A+\200:D\300\202e\221CCE(\220\304\233\240!{\f\032\262\307\025\310\242!\233\025\310\242!\035\020CD!\r\206\206\305#\233,\272\300\202e\221\024\004\r\331\031\216F\024\354\020q\203\020?\030"
+	.string	"\021\211\214I\024X\260,R\210\035\"\242 f D\001\213\343\260\001E\342p\205\nB1\004\025O ]\320 \204\b\366\210\002Yd,R\221D\262*\216\303\027>\270\3408\034*R\301\3160\"D\222X\003Q(\004\006+\222\304\032\206\206\210(B\244\300\201\205!\311\262\340\203\002\212\013P \2152\370\240\200\"\311\252\350\240\202\fTH\262,\260CD"
+	.string	"\260EEb\262hTA\b\371\363\203,J\016\223)>L\300\3428l@\006*\foD"
+	.string	"!y\034\266"
+	.string	"!yd\221\310\341\017\261\350B\207\031Rh"
+	.string	"\213<\016[\374$\211E\027\330\244\221\210]\201g\005P\221\321\347\006#\021;\303O\320\017\004\311\0376\007\"2\r\032\2623\204H!`\223\354P\013\"\243\nA\307!P\020\362\347@\304#[dU\354\227p\302\007'\230\300A\275\t\002\210@"
+	.string	"\021\322\233 @\211\022\0048\241\304\376\t%2\253\262?AE\243\n\026\260?\305#\233L\016e\360A\001\305\017\033dl"
+	.ascii	"{\3030\305W\200\300\022\021\223!\024\215DDF\240\020\310\237a"
+	.ascii	"\320O\315q\310\272\320+\222E#\021\352b\030\224\221\307\"\343"
+	.ascii	"\n\024\311&\213\212D\"\025\031T4\002\261H\025I\034\032\"\022"
+	.ascii	"\245\311\237#\033T\304I\376\370\240\200\002es \246\030\n\351"
+	.ascii	"\314\220,\n\221+\222E\326\347\003KD\364)\032\2116lr\270\002\022"
+	.ascii	"\311\002\001\241\220D\016\207pV\250 \266\320\201%\"\372\260\311"
+	.ascii	"\341\nl\222x\254!\211\034\016\335h\300\370B\216\207\023J$\207"
+	.ascii	"B(\333\302\205O\n\017#\220\200\304\201\335G\366\001H!\324h<\326"
+	.ascii	"\030\205\212. \205\322\"\026@C\033:l\366\006\3421\250\246\304"
+	.ascii	"\312\036\213\222\303\242\nb\212\244\321h\303\315\n.\354!\326"
+	.ascii	"\206\341\0137\324\214@Br(\364\263\202\013,Q\321\220\361"
+	.string	"\001\311\241\320M\322hL\241\005\021\006\324\343p\005\220f\211\2060\020\261F\365\310\312\200d\223.l\300\tbo8\262H\366\250\203\364A\001\005QQQM\032\215G\234\023J\f\211A,\021zB\t6\007b\n\037\024P\254,\200\206G\237\034d\320\220m\201\250\250\270\213lP\020q\305\315\b$\f\r\223\306$\316W\200\020t\034\006\025\207I\344Or(D\002ITT\024\006\261,\200\206-\322\344\217\fG\033\210tT\f\207P$\215F\0336r\005\320\016*\236@\256"
+	.string	"J\213D\025l\nC\033\206v\362g\263?(\222C!\035\266\205\013\037\366'\207\375\311\20184$&\211E\027&\240 \371\023\001NP\361\004\233\034\006\021\203\212C \033\233\025I\025E\366\205\026C\026\222H\326\206\233\0249\311\037\037\024P\260@\303\026)X\366(d\223$\026\211+\232sd\211\210>\302\240!\333\302\n\344\260\205\233\240!\333\302\020q\350St|\301\006\311\022\223G\342\n\036\220H\366\250\302x\224\241\350\302\nd\321\020\nv\005\320\020\b\004\222\035\"\242(\262-\214+{\024\332\354\317\315\321x<\236H\"\207C\353\220\321\230\302\017:4T\204\202\210M\"] \331!\242\020N\362'\206\035\226hXd\207\210B;\371\243\302\007\366\b$d\301\262Ha\362\207\005\313\246`\301\262H}A\362\007\005\tR@p\202\235!9\024\002qd[\024\245\370\220\374\221\300\202\344\017\n-rV"
+	.string	"\035\207,\222e\217(\202\212l\213\026C\017'.\030\266\200\300\206\242\024AE6\211\003\373!\371CC\362\207\035bW\370\300\016\021Q\260(\022\207\212EB\366\207E\016W\310\020\202E\016W\264@\223?>\307a\022\211\023Td\205 \222?\307\244\f\354\020\021ENr\bT,:&m\222?\035X"
+	.string	"\rm\030\032\032\002\355\344\217\n\036\330!\"\n\026i\034\002Z\213Fbrxd[\030\327\344\217\r\373\303\266p\341\303\016\021Qt`[\270H\352$\213\024\022\212\301F\205q\250\206\315\201\230\242\205\315\r\262\310H\274\201=\312p4\"\217E@;l\220\221H\333@<&\223\303\027vRv\005\320p\206\240!{\004\361\025\252\213c\262\310\n\223?G6Y$\036\211+\f\r\201\210H\027+d8\2626\020\025\301"
+	.string	"\002i\224\301\3051Y<\021\344\341H\024\262)\262\307c\021P\207\242\221\230$&\217\303\026 \222C!\034\344PH\210$**\326$\217\303d\n\240\017GV\006\244\207 69\0042\016\r\241\220D\016\207@\260@\016\033Pt\201M\272\260\301\303\221M\"\213\206T@\246pq$\256\2204\032\217 \336\301\215-\330c\bI\243\361\030B\r;d\3030\3508\004B\022\203j\222?Gc\262\005\361\b\204dW\240"
+	.string	"\0076\250\350\302\321\230\004b\2215\311\237\021HhA4L\"Y\"\242\017\233$\0365\200\223\304\201\205a\005r\270b\337\300\036e0\221,\022\213\324$\016,\fE\307!5\371sB\211d\221X\264\221\303\343\t\366\006b\262\b\210E\026\215@\022\260?lr\230L\301\002\3108\224\002\273\002h\250\3020\202\227(\241\202\b\032``a\003\201\200\024J\016\205\200\212.\220\303\020\214\304\020\212\304!Q\b@Gd\b p\300&\207I$\032\304\262"
+	.string	"2\016\245\311b\221Q\205\"q\230d\2175\377kb\254X5a\354t$-\251\313<\343\257\n\023\214\364\311\232W\004\213\f\245\024MMRM\022\0063\201n\206\bK\366_\203\244j\3412cG]\315\321V\272G6\366\306\324\030\251i\222 \2551\261\376k\332=\306\305\314)\fk!\032!\032a\232\265U\372\340\001\245|\n\323\230\t\233\363\202\365E\310\332\200\200B\301\020c_\002/\024|\246\325\351\020\341i\377\302\347\312%#Q\362\f\373K\221\244M\340\320\226f\326,iC\264\244\260\026\226\021\226\301hbJB\020\334\277\220\314n2"
+	.string	"\266\253\262>\265\252%/~\3021B-D\206\030\331\201\235k\032\331\025\2612\241\230\013\371\372pT\355\300Z\030F\270\207d\371\344\313\367\304\024\t\363V\206\265PO\b&k\351\004\356|w*\237F\236z_\326#*\2151\301 y\373\013*M\336\230\320\313\372Fu\006\n\t\326\302.\267K\316R\032U\333\036\t\361\204w\027vi/\320t\325\224r\311O7o[^z[\360\016\037SA\312\260^\2317\214\t\236\023k\341\025\341\025a\335m\225yY.\254\303\302\222\361\003k!\026l\346\365\267\303/\004,\373\027\322\335\250q\362\345\020\234c\322m6\252\232\3446\027\032\270e%\313\212\\\017(rep\225L\267\315\230\334\t\241\262&9\242\245t\206\337\336\204S\312\230"
+	.ascii	"\223\001w\341\224\324.\265\201\344\211-\204$n\272\213\315\231"
+	.ascii	"S\r#ll\302\246\331\027(\345S\030\345\302&\252\304\366\324\206"
+	.ascii	"\265\020\n>C\231T\221\002\003ka\033\016\323\323\032\240\234\226"
+	.ascii	"\247\221<\254\037\302\215\375\013\237l'\257\255'#\330\t\026."
+	.ascii	"\265)X\013\325\204M.\\\273p\r\013\327\362\340`\252\244K\223T"
+	.ascii	"\377B&\252\236\315\215\3002k\3024U\2140k\311\235\025!\232\352"
+	.ascii	"\346E\360I\024|v\246\262\255R! \231\231\245[WNj\371e\377\302"
+	.ascii	"2$\272\213\326S\023\031\031F\273%\310\365h\333B\261\374\201\301"
+	.ascii	"\301\301\3013m{$\024\303\3021a\222\013\305\256\346\205-\035\245"
+	.ascii	"``B$E\370"
+	.string	"\240\224O\341\221\013\2210\365\325\235\001\341\307\376\205F\330\272\260\236\214\025Q{\340\001^\311#\202C\270F\207\364b\271\334z+\211?6(\345\023\204\246\375\013\275T\035i\226\224\"X\204Y\302,a\227\337S\310\205]v8\242\304\300Z\250%\344\212R\267'%\344\022n\3554\312/P\204[\030O\204\250-\3149\254\264\017'\257I\225\254 \2522\207\313\223= @T,\233\272\275\243\"?\306\366\022\021\254*VVB\031\367\213\355\003)\233\212j\353a\252\274\"dN%\273G\217\255G\002\327\007V\373\027NU\325\350P\322\204O\310c\017\375\372\242BE\270CMbR\211\361\302Z\210C\210C(\225\004J\371\214\272PJ\363\340\002\314\3618|t\206\316\350\003\030\273\r\201\023F\004\254iCe\346Q\001i\022*\205J!T\026(\345S\370t!\324\tb\252\214a}?\0222\324\314 a\375"
+	.string	"\004\356_\350\224nI\375\372\306\002i\254S5IT\330\376f\320\351\300\202\226\326\224\002\356\004\252A\301Z\bC\bC(\243\005\243\004\230\tc\\(\003s\355=-\301Z\270\024"
+	.string	",\302\027\302\027k\325Z\344\312\362l\013\221\204HkU\2216\254\375\013\217\324\276\024\372\232\200\b\215\324\216\304\350\216`\315|\242\252\2027\210\244y"
+	.ascii	"\242\201\221f]J\257\200eqC\223VY\317d-6J<\3000\005\006\246t!"
+	.ascii	"D\020\233\202R>\003\300d\306\314\372,\242\367\367\365\271\331"
+	.ascii	"b\350yy\300\267\313\224\001\353ZZ\351\353K\311D$\225\001S\342"
+	.ascii	"<\333b\304\254N\021Im\253\324\272\370\001\226\345l\243l\220\370"
+	.ascii	"W\276\257N!cJbx\260\265\377u/\303\001\341\241\324%\314\212\303"
+	.ascii	"\316lP\013\353Uo\325K\311n\253\334\261\364@\271\377\365KJ\346"
+	.ascii	"\325"
+	.string	"\304G\035\326\253\227\325KJv\246\307\314\335\235\332\307Ce\344\227\036\261Yr\302\201\206\365{\364\354\354V.<pc\006\217\374\250\312\001\270n\371\312%\310\225<\035X\257ZR\245\256=\030Z\270\226\220\371\231\265M\371Ze\312\232%\357)\240mj\215:0\221\356\310\226j\226(=\302\344\276f\371\212Eu\362EF\030\254\327+tsVj\264\230\300E)\345 \021d\302\303z\245\022\307D\355\353\023\265\365-g\312m\333\250\026)\251\355\301C8x\263\004\fX\032\224\257o_\335F0\341qY2\306\260^\2454\243\254m\251\222\320I\023\"RX\257l\251Rv:\0223\306IMY\234\022\027\254\327\265\033\204\206\335\226&\377j3F\b\216-\254\337\303\334\357\t+{\331\232v\227\264N\003\260\322\233\022\226_\344\321AA\373\232\346A\022\2504\254\357\267.\371\277\322"
+	.string	"f\345m]\262\236i\361s\263\201\365\312\254\341A'\345\013\353\367t\355\325\f\005\324>\246rX\301\372==\310\310\326$n\351\227;(d\260~ORX\330\232\344l\360\310S3\221=Q\"\3665\t\233\220-'\373\252f\210\340\214)\254\017\200;\256\257]\\\353\221\314\005\t\016\023\237\025\220\345\327#_\301F0\341{\305 jjX\257F~\265\310\250-a\375\265\310\372\025\246-\r\326+\221\017\246\002\253\316`\375\365+kK\027\030\326\370>.]\275f\274\201M\341\214\316\250\224\206\215X'\204\302 E\323$b\f!\232\241m\020"
+	.string	"C\025"
+	.string	""
+	.string	"@,\034\026\313f\313\256\017\024\200\f?\316H1iB\030\351P\034C\022\031\021!"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\004\020"
+	.string	"D\351!!\365\321\260\2430\337\t\264\245\204l\3102B\227WOP\341/\224\b\310l\363\317r\371\335E\226?\233h\201\321\317\364\356\260\b\247\242G\252E\342+U\351 4\345\n0\267\370\360\227\214\301\265\207\020\007\231\245\313\250\r\372\204\306j\017\234?f\220\367\024\261\370\275v\230\350\017\032\277\227q\201\212N\254eBG\300(1\335\376"
+	.string	"\374O\030\253\265\254\266\345t\016\234:5>\232\016\366\207\037\352\275\342\322\023\300:\305b2\222\352\020\004yg\360fd\345\320E\366Ctp\177\335\361\371\265@\334OH\225\373"
+	.string	"*A2\212\254;\253\331\f\273\340\254\030\241\2022>f\315\227)\316'\212\330+\343,C\002\251YF\340$/\331\205\311\373\313h\306\321r%\020k\203^\004 \246Q0(3<4"
+	.ascii	"\006\206\241|a\217\3054\207~s\214m\260\006Me\003\363\247a,\220"
+	.ascii	"mX\263\344\357\013\376\240{\214,'\307\234`\r/i1\237\037\241\037"
+	.ascii	"3\374\035\263\277\034\004&\255Hl}\226\n?c\251\r\201W\253\335"
+	.ascii	"\361Z\375\303\374\364B\322@a^:(\2529*"
+	.string	"\241\264\313\274\372\265\335\266\243\263\305\273\t\346\3474\305.5\312Q\225o\242\264T\027\220D\353GrbE%D*\\\020}\322]Q\002\235\224\344\230c\324\223\345\266\013\272T.^\210\231\216\202e\037\272\301\355\025!\316\200\347\270\214\352\260&\t?F\357\247\327\333$\337X\366\327^k\3257_\300\ro9=`%\312\323J\343%5\371rf\002\215\"\bc\311E.\243\323\326\243\301r\t\216\332\331P$g\255\004g\2250\356E\222*\223\237\255s]\214x\324\331\243\314\350\361\330\n\r\326/\365:I\351\005~>-\364\265K\037\274\3548\226\266\344\275\032\350[\232\024#\320\002!\314\266\250JT\201Z\026\206\371\321E\360\005S\222\242\352\233\256\026\244\226W\216\300\254\365_P\240\266Y\345'\021O-IN|\005R\332<i\373\323Q\\\nP\t\2161\311\013\262-\357\"\005i\230\256$Q^\037\251"
+	.string	"\r,+Z\222`\002\177b\373\241\354\344D\231\203C\324\226\263&\231D|\205\377\324\316>A)*\212\202\322\376\016\tA\027|\021\213\224P\f\374\266\036\f\\\241\020jgO)\311\333M\367\371k\267\330r\323\365/N\212\205\356rSh\206h\233\221$\351b\362\260\336\022<\303\241\274-.\nZ\240\200iX\325z\302\304C\376w\246}T9\034\271h\201H\236p\177e\017\246\201\314G\216\021\326\353\306\210\305o\360\344"
+	.string	"\213\365"
+	.string	"V\t\331c1\327\031T\314\007\021\002\020\316\226qJ\2209n$\231\354c\256l\300\321W\200kw?P\024\317\005\344\b\005\372\336\267\377\314\025\221\375w\377\237\244\212NL\274X1o\320\2033\321a\232\376\b\345\267k\306\002\301\3212\006\025\365\031p\261?\225\244\310j\267\303U\304\201\037\323\240}B\326\250\336\272\203\025\200\345\242\201\267\f\324\302\237\202\377\351\003\216y\241\246\221\224\310\315-\032nx\213d7.z7rc\206\362n\177\271\002\360\206\341K\326g4\340X\003Y\027\020\331\367%\007\367f\344\346\230\276\236\030\325$4\236%8\\Qj.\0361\3456F\344\245\f@&k\333I\030\331\334\243\316\235J\327\346r@\335\030\274\354\253K\232\323\317\bdU\230>\022\200\265\362\376\356\3424\233Z\200$\243\025\205\270\0279:}l\333 E6\212\027\3538\023\037\377\371"
+	.ascii	"c\301\346\204\277\222L\316\n\b\332\337Ds\312Dx\0052\371\224\216"
+	.ascii	"\022\200\037\225\016\0323\225Sgw\r\004%\004L<R\350E\201\363B"
+	.ascii	"\224\234W\361\317\346\bE:\2756K.\213\021(\336:U\b\267\016\312"
+	.ascii	"\223\341\264\360\025<\377v!\243\360\236\314\225\313\024\374."
+	.ascii	"k"
+	.string	"\021\262\341(\301\273\220\021\016\ft\216\037\225|h\2148\t\205\356:=!I\t\016\034{\n\222\223\"g7H\200\264g\373\037J\032\265\373\240'\232H\023\211\374\367p\355\024\031\261\276\244\320\257\016\221\263f\245Yb\020G:R\021\221\344\337\024\2646\361l!\n\255\n\027\371\020x1\002+\235x\233;v\241\373\013%\206\376\205\030M\264\335\020\266)\270\334\220\357O\270\351+\226\3312\261jP\350\303\002\023\3403\246S\205\370\243\273\231\\\254\222\343Y\215e\257\352.\024<\262\261\344\346\001\031\351Z3\241\254y\tN\320\biO\033\240\364\323\356J\354x\241Zh\031\346\331\344&\300\324)\223n\274jN\326\260\345\302P%nD\260~\205^nJ(\327;p\005\372\343)L\271\363v\177s.\002\007sDJ\224\027\t\302\353w\334\005\002\b6cs\177\003\224\354\331\271?\257\030f!D\254\211\022%"
+	.string	"-\351\312\022\374\001>\262\323\227\334\013\324\264\254\365Y8\377\246\327$YO\2223ib\311\324\271\217$\007\355>\242UN}O\004:\267)xz?RX\363w\246+\201O+\211\375`w{\226\354\242et\212mH\177VV\226'I\314\251\260\255k\301\220-\020$\342pk\221T^I\311P\340C\244\372\235\220 \321\f\314\350L\250\260\212\270\330i\247\275\025\275\250m\2754\365\302^\354\241\267\310\267<\250}\353\022:N\351QXPY\334\216\340[\367\036\032\253\022\366\213\352\032t\034{\243\261\005y8gM\313\001\360\232w"
+	.ascii	"\256\273(\013M\331Rg9\345\351\265\342\n\321\334z\201/\232z\303"
+	.ascii	"\376\0330JW\003 \nG\240\203\f\002\330;\tR\372\242\274\346\246"
+	.ascii	"\352u\267\tF\375\330\026\330\342\215\332<\330\013\\h\272\245"
+	.ascii	"\225X\250H\355\330\261\237|\025"
+	.ascii	"\374\177N1]"
+	.string	"\341\350B\027\347&U\215j\304\327<4T\231\273\016\202o=\345\306\247C)\212>7H\337\377Y\264\005\204C)\353(\023\035\265\252\2546@1\310\302\310\024\307FLj\215'\256\302\371\034H\202\345\222LJ\033\3444\300\3360e\b\254;\3332\002Z)\341\232\023v\264\333\213/\301\257\373.\357\244\2477\221\205\301!\333\241\315#d\331]\303\034\323\324]\260\374\020\343\231+\354|QM9\034g\330Y\232w\254w/\301\276Y\352(\377<\255\231\242\033\352\340\206K\245\324S\"bA\275w\003|\300\334@\310@Qt\212\241\030\023\357\236\256`z\212a\307\001vF\342\332\216\356Xx\214\030A\2153\017\\<r\361\236\352\255^S\2757\323\245\370\300\255XR\002\327\277\354\241\\D<\360\277\0170\251C!\3036\006\225FvFjj\310\034\204\273EZ\001\370}\177\343\254\316|K\303)\300\2615\306"
+	.string	"1'J\326F\241{\265\017f\242\376,\274\227&\214m\304\027\230\257C$AZ\205\246\315\252\374"
+	.string	"\360+\252O\267\335\236\226\300\334\nE\312\376d\312\343\235\272\254\017K\260\256\202\213\257_\256uj\266\367\017zcz\261m\230\037,t\033@G\017y\263@\031\025\260&\367$\277n&\345d\02693]i@\243\"zl\217\226Zlt\331I\270\336\204\034,^\312\3519!gD^+\036i\330\3711\341\267j\034{\321\366L9"
+	.string	"\212\007\t\345\3030\340\n\301w\036t)>\272\212T\336C\323\362a\255IE\227\031\235\247\360\205^[U\262A\223\360`\342\236#\240Y:[\204\211\276\301\234Q\244\006c\332Uf\276\303_A)$_*\2029\306\021\240bw\227\267\356Yb\355\307\203\022\004\242\314<\345\262\032\027N\004 }[\034q\231\025g\205r\f\252}\267\312-\257\340\025\321\257O\351M\\\212p.\\\\3\r\300\203\326W\254\310\272\212\3328@\306h`\215\353B1\251\270\346\314@\332\354~\223\037\200,\303\342:\307gBO\302$\304\202M\255\016\347N\317\371\273-\306\223\206w\360\231\223\257\337\203\314**\256\2232]\036?\256\215\271f\210\030h\017'\302p\016\024\335\325=\342\323%\325\037\371!\207\321\027_\277\262\326\027\0302y\3718\213\0179\377\200A\315M"
+	.ascii	"\277\237\332\037\351\031\355\026W5\021:\255h\302\211B\342\322"
+	.ascii	"tw\031\376nZ\347\354v~~F\2540\2064\331\331R\213\\\367\205:W\234"
+	.ascii	"9\370aZi\225\232\266#\331Nw\"w>\322\211\232\253[\020/\202\314"
+	.ascii	"Y\216\355\250r\"H\203\3740l\201fC\376\314\027\341\3738\325\317"
+	.ascii	"\212\\-\343\320\207\352\366\274y\362\247\237\205R\027\023\352"
+	.ascii	"\245\256F\313\016#>\266\002p\235\202z\032}\2131\177\225\367V"
+	.ascii	"u\004X5\2365\030D\t\365\f'\004\350\317\220\205\002\243\250I\207"
+	.ascii	"\333\337N\242\342I#\203E\242k\305r\030\367\357\200\334\201\335"
+	.ascii	"Ya)\346?$\355\360\225\002\244\360\\0\210\233\275\311!\207\022"
+	.ascii	"\025\030\241K\237\3568\365\021E\3448\252\222-r\370\231\354\304"
+	.ascii	"#g\346-%\351\330\205\317.H\362gw\277\n\332\rg\2510\017\bX^\301"
+	.ascii	"h\300n\217\344\n\327f\360\253\321{\212\212\344\022m\301n\373"
+	.ascii	"\032\377\311\034\251\t\025\013lZ\360\330w)\303N\305\2056Y\317"
+	.ascii	"\007}G^\241(\025"
+	.string	"\276.Dl \031\3423\237\371r\003\245\\\312G\302\326\357V\004\325ar\355\232=\024\324!~\333\207\025\304\207\305\034H*\0079\307\206\307\264\272R\200\225mz?-8\304\314O\200S\027\t\246{\372;>O\322\004u\007\"6p\261\340\221L\004\340y\334D3zPe\212\210\274&\n\354\023\235\370\212\276o\345\210~\033\033@L>\257\333\024\302a\032<\222\313\206\334M(\351\233\342)\243\277m\n\316a\335\233\300x\2523\0359\017\037\314\210\215\371\212-Ph'z`\307\311\270\315\242&\305o\251\334\261\034OJnD\205\352o~\354\334\272\341\321\220\r\354\310\305\306\250\366+\337\207\337\t,A\251\"\244v[\336\274\034Vz0I\210);\215\203N\261*\207\346\236\222\017\035\234\230\0354Q|4\177\272\316N\213xu\314\351\241\2538\356\f\304:\346M\004\037\331`\002\233\330.\260\240!0$"
+	.string	"\222\003\252\223\270\243\252\026\005\263:@y\017d0\377\376G\366\212\2341\240\332\016u'\005\307.\235t\354X\253\317\220\272\200\210\311\337\256V+\027\034\275\026\307s\027v\357\211\232A\356A\275sK\352\317\020N\210'2)b"
+	.ascii	"\216\223\005y\017]\035;s\353\360#$\240X\322[?#\225\274\200\332"
+	.ascii	"^w\214\276i'\232\001\376\227\316\242\0024T\nUY}\021`%\241\002"
+	.ascii	"\231\027\354o\f1\303\250]\342s*\202\020:\003B\361?3!\200"
+	.string	"T\266\236\366)z\206E\035\003\377\013\333\250i\371\325 %\336\253E\255$\220\222\307*E\356\325^\272\027\023\\\227\201\362\307:\253\200\335\305N\245\337R\020\377\250v\033\306\262E\337/Q\240\230\362\201\346\346d\221\206\257e.\234\032\252>\367\b\252tC\311\201\034\024\301\221\341\216\013r\362\217\300\364\013\214\222\323\023\372):\367zAQ\n\261\347\217\364\262p\203(\f^\007\312\023\216\345\275\355\257\332\200V\272\257\363\026\257\207\337^\264\034\n\244\240}\264\265O;\266\370P\327\375,\222\364v5\235X\350\210\025U\3447\214\306j,B\033\237\3559\252\242\353:f\020\274\3774\026\216G\275\261\301\334a\245m\265\021\234\0357\360\003|-\022w\261\3100P\025\257\241\033\037\341HRi\252$\365\323c`\225\266\226\336\343\034\354\307\212B/s\244\204\244+\265\220\007y)(\334\376\n\345tVq\266F\306\217"
+	.ascii	"\312\304\006\373b\366\037"
+	.string	"F\352\270\0254\230+\027\335\275\003\211\0070\f\232\342\230\277\350\177\2353\022\222v\332\371C0\274$9~\177\251\307DJ\002\202\003\270D_\366\311s7\342fO\201\302\320\334\262\"Z7\215\302[d)9@\251\366\312\262b\30330\256E\270.\300\362!\307\2547>\213>q\250(\250\031J,S\t;\364\237\307.;\375$\254\2515\326\212\006\277c\265\222\277\203\273\b\334\003\221cm)\344\347W\214\016\206\034;As\020e\354\343\321\261\250\232\\\354\201\256\"\256\005\254\204\\w\354\211 P\211L1\222\372\327\374\313RQu\035\204\003H1\230\335\227\004\345\217\365\346\3552\252\251\271\327\214\344!XhJj\243\037\n\241\254\322$\004\330\360AL\032\306\345\037\006lpQ}\265\366Eeh\376\t\255\264\3526\020_\033\2724l\177\227L/ww\311k0\303\324\233\231\f9Jw\036\330,Nj\335"
+	.string	"cS\250a'\0231\253\311\202\035\310lQ\257\323\370\241\365\322\372#\376R\323\352\375!\356%\216\254a\006\353\326\330\r\336YH\023\344\260)\331\020x1\266c4\236~2k\251\033&R\233T\330\337\nd\302_\031\363\230i\303\257rx\202\020\242(e[\226\220$\223_\346R\263*\242\232\356\036+B\300\316\037d\265\032"
+	.ascii	"*\217\275x\243!\t\206P0L\203\330\240\242;\337\272w\323\276\232"
+	.ascii	"\231\241\375\350\001s\302z\352\271)6d_\273\215\320\265%f;[\352"
+	.ascii	"\005.>\237\243"
+	.ascii	"\215"
+	.string	"h\\\213\213|\355X\2310\"8M\241\001\253\205/\200\316\377C\222Ds\3348*\251\231>\351\344\260}%\261\030\027P\251\316|\307rEZ\021\243\347\353bD\202\237Y\210%\221\347\221\034\204|=\256e\325;b\035\276\266@b\274rRx\362O\b?\342\2233\343\343\037\225\177imq\231r\001c\223\230\252K\254\363\345\273\234\252w\225\n-f\227\025Z\221RML\237\220k\254\217<\225\205m\223q\376\343\020\20249\360F=\013\202\313\t\\\251\nxK\351\242n\247\211\241n2\204\263\355\346\253P\237\f'\334Ht`\262,j\020\005@&oI\212\201\311=@\320\013\226\035\305\377\327\026\376i\265\344\215\216k\275\2777\030\217\216\251\317 _\356\267\212\360\255\250>\204f\205D\206,\t\017Uq^=\332z \005h\2541\200\377\036\022\377\252\013\260\3267\326\002Z\274u\203\032|\323\375h\230"
+	.ascii	"\"\247j q\371\236\017UT1\207t\376;\270G\026\307\304\025\370\232"
+	.ascii	"V\200\333\350`\276y\325\247n\030\312\355{\205\206s%\233\212\333"
+	.ascii	"CO\316\372\\ Lx\221\244\337\327X\206\233\325\272I7q\r\301\031"
+	.ascii	"\b\362\236\240\254|\377\013\214\203\b\352#5\350\311\356\255A"
+	.ascii	"Q\252\300dl\206\242\337\363 "
+	.string	"T\3636\220\371-\230\031\302ei/\244C\t|\335&\353\323_\261\017U\30114\233)\256\342\257|\226\272bo\004\325\341\3428\375d\350^8\325\354\257%\264\313T\340=\020\\\177NuHv \302\336\355\370\223\001\002\304\203j4&\2619\376Z~ \315\307e\253\362\320-\363\372b\032Y\260r\330[_\202T\236\371\017\263\354\260E\246x\307\307\364|\"\255~\034\016t\257vOtB\212Ck\250m\027#\375#m\177\224\320\316\007 \213\204\230H\020?\035|\205\306\252g\2573w\310\315\247\364\353\231\372\037\266\315m~\236?\276\352-\206\362~\3059\314\310\206[\225H\307_7V\013\355\334l\027\360'\276\360X\265\205\245\016\210\250\230\313x\246L\352X\375{\362\243R\257j\316\335/\221\031\331\210\030\370\234\373\324\344f\230\247\n\325h\026\246\n\342\204\326\373:\034`\222\013\247\022\225Z+\360\204"
+	.string	"gf(KO\361\254\250c\206\323\001\244\\#%+#<\233\315\0075,'\345\245m\362\244\366\204@\346n'r\266h\005G\031\265]\004\354\026\367\323^\247\200\317=Qd\024\225\303\017\033G(\"3\344\210\t\037T\200\213\212\347\031\002\267\354}4!\362\344\017\340{\336\r\262EZ,v\016{\214\271\216\004\210X\227\341\034\360\263A\366d-\306.k\307\325\013y=\203W\317\004\016\230@b\271\177^\327w\205"
+	.string	"\"\003qV,D\025\216\316\027~"
+	.ascii	"\203\006!J\354k\240\251{\2122,\325\307\213#\213Q>\340\240\016"
+	.ascii	"Y\377F\263\3726\225\216,5(\234\013!6\231)`\200\275\\\013/\035"
+	.ascii	"\005-\2535a|%5y\260\266\243\217\347\235m\256\016\344/:.\327\034"
+	.ascii	"\345\235]<\375_Z\270v\300\245\234L\372i\356\242\233_\211>0ni"
+	.ascii	"i\027f\261\002:4\373\rpP\366V\351\025\231N\016\31605._8\352t"
+	.ascii	"\0024\303\320>\247\276$\241\326\031\326\365\263\307\037|\251"
+	.ascii	"{\342za\205\230\346&\005\307K\003x\230E9?\250BH\220h\352\253"
+	.ascii	"\t\225$\235\234@c\030\267\016\317\b\206Z\213\207\"\361\206P8"
+	.ascii	"j\3617\255X\031\3415Y,\252\3444l\001\252\220 \317V\356\240\316"
+	.ascii	"\337\204\312LD\376?|`\024\375B\261\364\301\255\271f\246\243N"
+	.ascii	"\227\201\335\214.L\253FK\377\276\253\212,\314\315zb\326\275o"
+	.ascii	"\276\351%\211\212;\001\256\372?j\302\030\002\203MR[\361\0177"
+	.ascii	"\336\215vM~zi\021\034\233HASZs\274Y\f[\207\303\213\275\226\304"
+	.ascii	"\377\204\216&\371+\352W\303\376\361\351\\\f\234?\202\363\266"
+	.ascii	"\0307\263\371`L=@\273\t\271\315\373\302A\2647~us\266\031\226"
+	.ascii	"4\3040a\363.\315\332/\3506\206\276\372q\021\3559(\016\302^\035"
+	.ascii	"zg\236\307r\371+L\276\013\305\021\035\365DN\257^F\275\263\376"
+	.ascii	"\344\356\333\3523e\373\272\366\355(\231\255\214\317\364\260\215"
+	.ascii	"\243'\236\250\357\277\037`\333\357\004\217|\334\r\345\377\277"
+	.ascii	"\303'\375q\335D\3400\334\210\243\351\362\221\277}\326z0\272\200"
+	.ascii	"_\307\327\361\350\356\277\234X\277\311\337\037\244\202\341\203"
+	.ascii	"\375\322\221\355\221\372[\"\022\243\343}\376\002\376\320\312"
+	.ascii	"w\023\274\205\325\2331\261e@f\213\324y\357\360\374\303\347\300"
+	.ascii	"\331\353\262\351\335\213\277\253\022>\250Ew\022\312\"\037,\023"
+	.ascii	":\366F\233\216vL\276x}\203\360z\004\177\311\363j\303\340\254"
+	.ascii	"\221\371\222\323\\\"`\205\313\357}\324C\326,\256\007P\300\345"
+	.ascii	"\377\341\221-\222\365\213\261c\262\006I\003/\373\3371~\200\305"
+	.ascii	"\210\366\034\bt\247\330u\002\355w}\343\203X\025\333\261E&\037"
+	.ascii	"\326\352\320\026\3127\025\370X\032G\247\240\037x\322\315\260"
+	.ascii	"\231\232\326E\004\346\312W\257\024\177\">\030\306\177\321\326"
+	.ascii	"\n4/\003?\270\266 \374\001\325\247\343\021O\305\342\316\006\035"
+	.ascii	"4|\307\"'\273r\371\036\333\272{\243\355l\247e\032\312\202\270"
+	.ascii	"\021.\271j\202Ob\357\251#\372\235\370f\203\327\371\236\016\265"
+	.ascii	"\320\277\007\204\276Q\005\356S\253c{^\031\345\216bS>\r\256\356"
+	.ascii	"c|;\233\005a\371\221\352\277\321+2\037\005\234\316\372n7\267"
+	.ascii	"\270\200\276\330\377\321\301\212\026v'\026\316\211\220n\365\252"
+	.ascii	"?\232\357\262%\023\254&|S\321\206\233p\377\333\315\025\2765\026"
+	.ascii	"Z\330\005\016\276\005\352~$\237\207Z\021\372\035\b\264\362\f"
+	.ascii	"}\235\244\204\305R\355\353\242\377<\250\365\274\f\035\007\222"
+	.ascii	"[\247\325C\n\374\"\341\035\rhm\237\322\177\254~\324\3171m[\224"
+	.ascii	"\023B\364\n\f'~\312\023\356\332\223_\247\236\260\234\304\206"
+	.ascii	"=\333x\007\\\356_n\375\322\212\236\363\233\001\315e\277G\235"
+	.ascii	"\352\013D\273;\356\217\372\336\346\035\353\336\177\310\223\177"
+	.ascii	"\231R\302\2735\367\236\b$\272lv\312l\377\035\344\372Bjc\327\356"
+	.ascii	"F\240\330\311\367\013\270\345\274\270P\005+\320\240\343\276\356"
+	.ascii	"r2\233\320\311\007~\335Za\317{o\003\335]w\314\r}\366\257\303"
+	.ascii	"\272\373\234\263\330\277.\353i\372\321\351|\254\331\351\276|"
+	.ascii	"\277\233k\357\331\222?fz\207x{\237t.A\214\367\317\271\212\223"
+	.ascii	"wYW\214\276%;on\374\337/]T\303\361Fj\\\341\333bo\037\364Mu\312"
+	.ascii	"'\237\363\231<\033\024\371@\240\274\306\371\020\026\253\375v"
+	.ascii	"\311\303\260\203\306\3630\255g\361jj\316\342\245x\rM\306\204"
+	.ascii	"\227\361\352w4M?{\001\372t\0356\327V\371\n\032\302\361\322\257"
+	.ascii	"\362\326\243\255Wju\214\327\274\270\256\001\327\365\361\274\232"
+	.ascii	"U\323\3427\333w\240uy\024\301\332\2138\2310*\004\017a\251\217"
+	.ascii	"\324\311\027Sg\222\026\316\254\273\036\317^\3640\255|\230\253"
+	.ascii	"\271\243\304)\376\231\234X\332\200#\214\273\337D\261\252y\244"
+	.ascii	"\031\220\363\350\276\356R\360F!\250\003\230\377~\361\211\321"
+	.ascii	"\276H\261\205\276\261\351\261\235\241\267_\316\3777$\367\344"
+	.ascii	"N\366r\256\330\267\200\315\377'.N\340\315\177\2017\347\352H\231"
+	.ascii	"=\266\017\362\375\237\334_6\200\271\207\331\372\227'[\372o\225"
+	.ascii	"\344\377I\350Bw\216\247\315"
+	.ascii	"\310B\337\327\033\201ql\364\225 \276\361\327\030\210\316{\364"
+	.ascii	"C\302'4\243\263l\360f\366\037\356\003\202_\034H\252I&\340Y\327"
+	.ascii	"\216\221\331\037\343\344\344\352\357yt\216\337\231$\365=Z\\&"
+	.ascii	"\017\223\231\344\362\312\233z\231\317\241\255\3714+\310H:\373"
+	.ascii	"f\217\345!\016-\207^\247\266\320\266\323{\377\276\340\231\032"
+	.ascii	"\330\223\004s\002<\354\351U\252GU\271Sk\354s\267\257\261v\361"
+	.ascii	"\315\217\002\273Aq\224}(\357\351%\377\245\232\200\346\201\211"
+	.ascii	"\330\326c,\375\322\322\276\013\267'\334\277\361;\217\2122\032"
+	.ascii	"\317\203<\263:\336\223\366X\236\321\216~\027q\375\373\332m\306"
+	.ascii	"\272[\340(\262|\310*\177Dl\332t/e\3267\250\376\205\033v\370\323"
+	.ascii	"\315\273\262\346\241\r\367\314\255\307yL\235\266,\374\254\363"
+	.ascii	"\230\340\254\375\270|\254\036w\347\201P\342\267|{}\260\2409\232"
+	.ascii	"[\325\316\225\247\341\317\326\035\267\331pg<m\375\025^k}\303"
+	.ascii	"\256\267z\237\356v\375\262\216G\\\307\357[\022"
+	.string	"6\260\345?\362\346\306u\377\370\007\334O*=\332u\251h\331\345\242c\223c^\235\033~\346\264\361R\376\305\340\325\312[\314\343\220u\276\233\215\325\013\204\261\347g\236\333\235>\005\022\033V\217\313\237~\367\207\213UT\177\351\340\031b\"\373z\004\360\371\212x5| \260\r\033\\\335\267L\361\330\005\256%\372]\237\333\025\372\316}{\2142\035\237*\365\216\370nH]\003\177\317\006~\024\n\335\224\023\336\253\215\353^\226\313\360\030&\313E_\226\233\353\304\357\3342o\375\315]\246\361\033\234\333!<;s\345\025\264\363\203\177N\365(\016\374v*7\241\332\361\016\337\300Z\375F\226\366\333\273(>F\306\315\336\272\n\3521<\271V\251m7\315\244\303\272\305\263Y\buS\017\232\360\274|\320\242\027\020\335\003\373E\277\342\033Y\337K\265cHX6\357*\3351\227\216\326#\b\205\247\343\302\357\006\361(\223\277"
+	.ascii	"\341\033|\016Z\302\234\334\257l<(\334\203\350]\b\331\221m\327"
+	.ascii	"\365\305\365\036o\330f\330g:Gj\312\335\204\031\311q\213\246o"
+	.ascii	"\253O?=\341\003\017]\034\033\333\312\353&W\034\354bcR\fX\301"
+	.ascii	"3Ew\224z\217\360\032|\333\261qY9\315p\006\343\334\026l2\343u"
+	.ascii	"\207\231\315v\340\216\355\252\254\327\356\027B[\356\346\2343"
+	.ascii	"{T1DN|\3043\314\361\356\250\230\207\223)\332\203\337\240\271"
+	.ascii	"\260\266J{o\243\352\331\330}\254\303\027\253\256K\345L\373\026"
+	.ascii	"v\343\227\\<5k\352\361>\177,\257\212\326J\375=if6\364\006\035"
+	.ascii	"W\f\2153\224F~=L`D\212\316v\374$\314.\2260{\r\356q\335x\232\345"
+	.ascii	"!_\"\342\262\034\316s\335mS\223\310Y.\231\037a\337d2\237\037"
+	.ascii	"=\037\301\323\276x\t|\375\362O6N\313\231w<>\027\375\307\342\272"
+	.ascii	"\371B\367)\371\336s\030\230\356vCj'\020\316|\267|\266&u{c\352"
+	.ascii	"^;\327\273\330\007AI\263\206\037\206\275Wv\004\256\223_\246\035"
+	.ascii	"P\360Rl6\234\3677\316\013W\353l\257\21723\267\026\355p\374\327"
+	.ascii	"o\357R\375\317x\345\343\035\335\022<z.\230\256\376+@\373\311"
+	.ascii	"\034\315[\013\360\341b\277+\\\221h\371V\202\357u/\367c\024'\025"
+	.ascii	"\037dlA\265\327\244\341\013I/'z&\215\304\245\317\367\233\346"
+	.ascii	"\355\206\016[\217\335\033\325U_\034\321\350\226\204C\343\274"
+	.ascii	"\357{\315\177o`\2175\302\316\321\376\360\374\254\277)\356O!\254"
+	.ascii	"\356\331|XH\352\366\363\021\221Q\245\003\203\333\321h\227\270"
+	.ascii	"\271\346\242d\021\024},\245\013\371\273-\251wM\334\311\371\037"
+	.ascii	"7\353\235|)\340\373\342J8o\302\346V\365\200ltx\377\360\245s9"
+	.ascii	"\305V\331vF\270\021\325*\331\322\t\327c\214}\256\236/,\316Z\274"
+	.ascii	"\311\261\001\265x\206\352\005\3668\347v\002C\246\2654\373\302"
+	.ascii	"j~\353u\364\255>\337\3335\244qj\353\230\317\327\211G\004\004"
+	.ascii	")\0064f\253\006\276d\273\341\265\370\027N\323\265\241uA\366\021"
+	.ascii	"\347U\215t\327\223\200\035\370\007"
+	.text
+	.section	.gnu.lto_.symtab.e357364e5c98059b,"e",@progbits
+	.string	"afatfs_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"afatfs_isFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"afatfs_fseek"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\004"
+	.string	""
+	.string	"afatfs_ftell"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\004"
+	.string	""
+	.string	"afatfs_findNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\004"
+	.string	""
+	.string	"afatfs_findLast"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"afatfs_findFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"afatfs_ftruncate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"afatfs_funlink"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\004"
+	.string	""
+	.string	"afatfs_fclose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\004"
+	.string	""
+	.string	"afatfs_mkdir"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"afatfs_chdir"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\004"
+	.string	""
+	.string	"afatfs_fopen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"afatfs_fputc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"afatfs_fwrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"afatfs_fread"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"afatfs_feof"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"afatfs_getContiguousFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\004"
+	.string	""
+	.string	"afatfs_poll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"afatfs_getFilesystemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\004"
+	.string	""
+	.string	"afatfs_getLastError"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\004"
+	.string	""
+	.string	"afatfs_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"afatfs_destroy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"afatfs_getFreeBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\004"
+	.string	""
+	.string	"sdcard_writeBlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"sdcard_beginWriteBlocks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"sdcard_readBlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"fat32_decodeClusterNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\004"
+	.string	""
+	.string	"fat_isFreeSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\004"
+	.string	""
+	.string	"fat16_isEndOfChainMarker"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\004"
+	.string	""
+	.string	"fat32_isEndOfChainMarker"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\004"
+	.string	""
+	.string	"fat_isDirectoryEntryTerminator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\004"
+	.string	""
+	.string	"fat_isDirectoryEntryEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\004"
+	.string	""
+	.string	"fat_convertFilenameToFATStyle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.string	"sdcard_poll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e357364e5c98059b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
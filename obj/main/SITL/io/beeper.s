@@ -0,0 +1,501 @@
+	.file	"beeper.c"
+	.section	.gnu.lto_.profile.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 [\005\002"
+	.string	"\324\002O"
+	.string	"\013"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\005\222\252\354\340\007"
+	.string	"\006\317\253\250\341\002"
+	.string	"\007\b\t\n\222\252\354\340\007"
+	.string	""
+	.string	"\007"
+	.ascii	"?\207\200q\201Q\301\020\225q\305\034k\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\370?"
+	.string	"\013"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004\005"
+	.string	"\003\006\003\007\003\b\t"
+	.string	"\003\n"
+	.string	"\003"
+	.string	"\007"
+	.ascii	"1\007\203\3034\033\001|*\203\265\f\272\2016"
+	.text
+	.section	.gnu.lto_.inline.728182c56799de24,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\350?"
+	.string	"\013"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\004\002\005"
+	.string	""
+	.string	"\006\003\007\003\b\t"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"1\007\203\3034\233\002\301TF\300]\024\3137\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 [\r\001"
+	.string	"pO"
+	.string	"\007"
+	.string	"\001\002"
+	.string	"\002\003\004\006\007\b"
+	.string	"\b"
+	.ascii	"`\013\330\0076\003[\300>\227\315@~\033h\003"
+	.text
+	.section	.gnu.lto_.lto.728182c56799de24,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeper.42.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \351E\006"
+	.string	"\022\314+0\200M\032\003h*T\026\003\363*\027\250"
+	.string	"J\231T\365\320\242xDD\0055\211\221\247)\031:F\f!0\335\021\343a\201z\267\037\267\334R\246\024\317\001b\236Z\250\3702\35758xq\017\027\006\214\263D\bG\021\024f^t\021\020F'\315\233U\235&\030E;5\213m\264~\376\277\254j\327\202\253\316o\261\242\362\223f\342!\265\365j\035b\021\351\021\211F\277\006H\311?\023z\020\3406y"
+	.string	"r{,"
+	.string	"\271U\266(\236\035/\370\310\250\350\244\374w\214\303\322K\326&q\264\341h\274"
+	.string	"\024\376wm8\030.s[\203\266\bm/\002\b"
+	.string	"2\003&j\006.\234\301\270K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_beeperSilence.43.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \273\r\005"
+	.string	"\002\t\",pe\322\001"
+	.string	"\335\353\371\177\304\017\354\343b@-\370a\330\322\330\b\277\366\006l\002\177\237\241\252/\336\004^7\306 \360\240\305\275S\n\256\250\031\257\030\033*-\205X\214\207V3\242T\301\362\212S%RN\235\272=\344\016\023H\261\273\354A\215\375\300B\316~\212gD\273\226"
+	.string	"\200\035\tB\035\333\237\214\331\244w\2345x0\025Piw\025n\216\375a\376?'h[\3667X\354\256\237\266]nx\333\b\333\t\333\216\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.44.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \341%\006"
+	.string	"B\013*2Pm\222\016$\203\310\"\242R\020\232\324k\020\202\206OYeG\024\373\350+\345\372H\030}V\332\204\231i"
+	.string	"U\034\256]/*\246\276\307\332\270\311N\001\036N\004c\270\254\311\264\325Y\313!\331&9\233\206\207\3244\210\314\f\314:\253\245\207\261\226\230\251\207\243\202\t\004\375\364Q\250\361\007P\034\275\302\212\333\030i-VTzb1\361\370\017\363+\365\t\n\322\201H\214-\006II;!| p\226\245G\271\251\243\004\037\031\024\")m\0239N:%}\027r\227\220\350s*`\241\355*$\272\270\361~\203?\177P\t"
+	.ascii	"m\21173\340\234\031\036\276\3345\034:\204\241R\223\301]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_beeperWarningBeeps.45.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \340\r\006"
+	.string	"2K)0`m!\035@c\203\024PD\250\343'\200D\241\232\344\332\t\r\336Z<\001\226j\363\037\322:"
+	.string	"\300\034\310]\355\234\304e\002fc5K\310N\001\034\r\004[\250\214\271\264\265Y\253!Y&5\031\006\207\304\264\207\274\b\3146\253%\207\261\226\226WT!\002\217\222\370\327IJ\3648\251\n}r(\ni)JH\nB\371\300\370\321\362\247\364\b\t\0165\"V\255E\207G\373\0166\b@\312\356E\360\215:\2201\232\340\030i\233\352\002\035&7\342\006V>\240\016&"
+	.string	"\205\266\247\017\250\002W\370\027\374\371{\002\t"
+	.ascii	"m\21173\340\234\031\035\276\3345\374\034BS\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_beeperUpdate.46.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \363\225\006"
+	.string	"\262L.2pm\032\003\240{=\037\020\205\346J\214\252/B\223\376\260\360\316!\"\022\202\222\002Z\002+\331\245b\250\272B\205\322\b\221\344A\264\t\tI\"eJ\001\036\206\267\231\026>\234\027\343\203\024PI\023_\347=\007\007'\307\231\0326N\212\036\247!(\354\274\350>\020F\207\2317\0135\023\301$\332\tZL\324\232\362\377e\241v1\312\"\221\237\342\304\344#-D\003\323\326\253\365\310\034\322\035\020\275\374\026#\220\177\"\364"
+	.string	"\300-\343\201\212\033\305\002\025\267\312\226\304\023\343\005\033\031\023\037%\377\035\273\260\364\222\265=|\241*\220\227E\341\177\027UU\270\314m\r\332&\264\255\002\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.47.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"\"\312&0\200\267\351\2003\242Y\021\026~0'r%\f\t\250\251\022\301\321\232m\033\343]\275\326\232v\032`N\006\244\371\202\252\322\203\367\241\006\236\032\331;\245\236$*+)+qR\021CQ.q\242\231(9<+I#\300\2344B\334\276>\021\006\005l\356zp\263\337,<\260\237\345[\267[0!\261\020\316\203\202m\313\206|\2067X\256\223\001L\213,$\020t\021\273\\\214\316x\3564_<w \302\353_\365\357\360F\227i\327\237B\262\273~\231fp\303\333~\330\206\330\016\b\t"
+	.ascii	"2\003\202\341\243\302Z\025\220k83\242]!\310pW(\355$\003"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.48.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \360\225\006"
+	.string	"B\214-4@o\222\016\320\036\243\237\361j\3267D\331T\002\253EW\322\t\037 @k7A\217\315\035p\305\306XU<y\"\002C\313\366\211\024yf\306\232X\262e\n\024\017T\233\263\261\246\31649\274\212z\021T\003\304\343X\022oSp\325\231\2547QU\326\313d\331K\322\200Z\305g\037l\242/&[\307c\033U\344\222\211\361\322\222*\356\344\343\367|\346G\354\310(\013dr\244\230df\302\007\001u\377\r\251\210\347\213\301\002\204)\200\214.JX2\263\247)\201T\207\351\200T\327<z\025\257[\222\342\306J\b\373\024\001\0262s\fa\031\275\3657\370\021~\215\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperModeMaskForTableIndex.49.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\240X\216\246\242\270\032\n8\252\310\332\255\024\231\366\\S\301\206\005\252*f\2141\330\342O\016\263=7c\215X\262e\n\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&\233\307c\303\350\b&3#\346%Y\\J\310\377y\315\217\330\222U\026\310\354XA\311L\205\017\002\352\376;R\222\317\027\203E\bC\020\001\2718q\311\314\336\246\004R]\246\003R]\373\350U\274nM\212\034-\"\fT\004X\310\314Q\204i\364\326\337\340O\3707\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.50.728182c56799de24,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"R\r16@o\222\016X\250\303\203\b\023\264>\\B\224\266\220"
+	.string	"1#\223gxu\347o7\203\216{9\340\212\215\261\252(\236\f"
+	.string	"\262\2274\020\t\325\374\243\265\335,!2\005\021\f\327\373\343\311,\220e-@\354\202\016\227B\003\374d\017\320C0\006\2622\b\201a\031\334\304\354VqDO\342c\310=\322\027\223\231\371\343xWp*5\244%\363\342\305%W(\224\217_\373\315\357\334w\244$Z\343)\003dj\250\234d\346\301\035M)\016\346\277\"-io\257bB\224\201"
+	.string	"\342Aa:eFx\354@UJS\201\252\324\353\350V\267\335\2264\300\264\301b2\n\325e\0222sg1\302\350\257\177\3477\370I\001\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363Z0\361\340.(\325\240I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.51.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \313\255\005"
+	.string	"R\n'0\200\267\351\2003\242\271\025\330\00351\034\025\253\300\310\272\246\312e\373\315\231\315\267\245\3275m4(L\214\210\362+A\245\367\3340\306\237\032\331;\245\256(*/)'qZ\261bI(\261\242\226H1</I\343eN\032#n\017\267\307\247\f\324\330\034\366\240\200}g\341f\277\310\267n\027 \002b\035\036\006\003\333\325\216|\204'T\273\301\341\b\264\305A\301f\341aw\343t\t\372\343\\\001\375\201\003\257\177\325\277\302\245.\323\260\277\004dw\3752-\340\206\267\335\260\355\260\215\t\b"
+	.ascii	"2\003\326\231!\340\200\\\303\235\021\r\013A\210\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.52.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \302\225\005"
+	.string	"\204\tk"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\345\243\237\001\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\257\261\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\365\262\001\274\340\004\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\027./src/main/io/beeper.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8\\\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.728182c56799de24,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\002"
+	.string	"\224\003\n\001"
+	.string	""
+	.string	""
+	.string	"\002*\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002+\177\005,\177\006-\177\007.\177\b/\177\t0\177\n1\177\0132\177\f3\177\r4\177\016"
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.728182c56799de24,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.728182c56799de24,"e",@progbits
+	.string	"(\265/\375`\357\007\325,"
+	.string	"\212Mt\021I`\034R:\227\315"
+	.string	"\007;E\207\212\307:\360R\211l\r\330\265\216\334\007Z\224+\305\351\211\306\005\310G\0041\223\201}Q5\246C\242\347>\235P\020\240\347;\371oFD\337\3524\343\027\301\203x\351\021|,[\362\311N\001\346"
+	.string	"\364"
+	.ascii	"\026\001\335mw\353$\251\342n\035?\357\022\211\354\2362\200l\252"
+	.ascii	"\326\t\325\2356\331\310\224/\023\013\006:\2510\227\035\025\267"
+	.ascii	"\371\225\202{\331kW\311\225\331Ji\251\356\316o\353RI\243M\252"
+	.ascii	"\022\345\246\357\0307\363\347\336\030#\223\252\247\260ff\236"
+	.ascii	"\222\277\026d*\2070\341\273\026\254\275\272c\037\036:'trR\365"
+	.ascii	"E\353\353\362\202^\006Kq\300@2#U\317`\315]\331+\177\345(9\276"
+	.ascii	"\n\0067\263;\346\331\2717\314\264\244\252P&\320S\263\200\336"
+	.ascii	"\177(\357\271\352\tO\327g\242\236O&\352\311\231\303\246\r\032"
+	.ascii	"\247\2253)L\312\264v\177\316\312\177\306\372\017\226\376\271"
+	.ascii	"\352?\335\377\270\377p\377\327\376\247\375\207\226\375\177\376"
+	.ascii	"w\376\037\373\037\342\177\363?\225\377`\377}\376\207\371\377"
+	.ascii	"\253\253\253\253\373\263\372\347\341\337c\nsQN\344z\212\212\210"
+	.ascii	"\347\354I\232\027i\226\347\261\257\371u{u\267\202\035:(\267+"
+	.ascii	"\251z79\354\277\317\210-\353H\252\236]\377^\273\311\356\236\301"
+	.ascii	"\213;\371\364\353e^\316D?O\336e\006\377\325\356\363D\273\221"
+	.ascii	"K\2705\211\026wG\252\376\027\352&\335-P\307\235|\231W\355;\005"
+	.ascii	"M\t\024\267UP3}\364\033_)U\270\323\216;\367\361J\271\342\215"
+	.ascii	"\341\344\033\303\355O\037\341\266;V\376\274M\267\315/\363J\371"
+	.ascii	"2a%P\037\273m\246k\265\036a\345+\006V\376\274LW\371\036\257\224"
+	.ascii	"@RK\254\252\267\214;\225\333\367\3301\220Tn\362\007\372\306p"
+	.ascii	"\257u\347&T'\031tS\301\3115\027G&{\202\306x\302\342\3029\356"
+	.ascii	"\356\003\310',\270\217\320\227\013\356\346zB\321H\tm\f\355!\031"
+	.ascii	"\332\372\240j)\250n\004\035w#\273\333\334\320\016P\266\232ll"
+	.ascii	"\031\016n\313H\264\247\243\371\243-\3153\\~3\223\345\365\366"
+	.ascii	"\347\266\254&\267\3315\273c \237\256\032@\212\304>>\247\034%"
+	.ascii	"6R5\263\311\321g\267\274\306M\002\334\355f7\237\271n\327'\347"
+	.ascii	"\241\234\207\324'XZb=\365i\330\3728\023\350\255Y@/\315RS\313"
+	.ascii	"kE\300\260\3118\363\2746f\347\207\025\327\213T\006\032ZN\223"
+	.ascii	"\333\312\212\372\2140\271\226e\236\323r\030\0320\037\357\237"
+	.ascii	"\252\rg\227Y\234\231Y\206\nu7T\267X\333\"\022\335\321qf&\366"
+	.ascii	"\f\315cvlL\240Zg>\265\267\252\346\232\365\331\313\227/9\314\020"
+	.ascii	"\336\226*\26440\317az\274\236Q8V\224\236D\344\254\224\225\t\201"
+	.ascii	"\221\243\255\261\204\013\227\374\354\261\354\001R\266C\255K\376"
+	.ascii	"\312O^\327\226\030G\025\036\326\2336-<\310\310\2623OU\330\342"
+	.ascii	"\261\364\311%\253\216n\362Wv\362\320\270\216\210\245\352sr}\026"
+	.ascii	"\313W\236\261|e,y,\033\365S\333T\003\253*\210\304\013J\274\341"
+	.ascii	"\207\"\353$\3341\016Y\0201\270(\032\207\031\b\024\203(\226T\226"
+	.ascii	")\350!(\205S\260C\202\026l\211!\007V\005\211`\210\"QC\220Q\t"
+	.ascii	"B\204\325\211X\\\022v`\231\204!\230\212\026\214\354\211 \326"
+	.ascii	"\030,\321$\342wb(\034\026\203#\00285\261\354\205!Qh\f2\025\205"
+	.ascii	"&\206D\fA\354\322\220U!\004\301\363\240\023\233\330b\221\221"
+	.ascii	"H,\026\001\350}IXd\207\354\211\365\022\216\034\034!\265\3209"
+	.ascii	"R\222Q\222Q\357HI@`\322\021p\375\021pgTr\022\3012\t\215\253Q"
+	.ascii	"\t\3118\024\262\320a\225\330\022\304\016\277\003\201\030\204"
+	.ascii	"Dx\330\260.=(\262M,K\242\210(,\032\n\203LEKE\247\242\007\005"
+	.ascii	"\016\007N\246\003jEE\233\244\241\361\366\203.\317\371\266\222"
+	.ascii	"`I\245j\236K\263\234<\347y.\307\371\035\363\234\232\207zr\036"
+	.ascii	"\342=\215\270ah\326\247go\336\344\270\265\273\333\270e\f\330"
+	.ascii	":\022\025\225\323\t\342\362\230\022\367\247\252\204-\200\243"
+	.ascii	"\250q0\306\234%\"2\"\"\322\202$\351\240\002\021\0323n\021`%\323"
+	.ascii	"p\246 \3110\007\240\221\246\276\362\004sw\363\365\223Ov\235\330"
+	.ascii	"\023\205\332\376c\371k\324\304N}t\335\345\213sT\324\006\245\252"
+	.ascii	"*\013\246\371G\004l\300\367\204\335\301)\313r\177\216 \250\r"
+	.ascii	"\223S\375\306\331\361\305\036\022\315\210>\374\332\327\027\302"
+	.ascii	">\215H2\220e\221d\013tx\321E\233\244\025\023\215\337_\004+X\256"
+	.ascii	"\031\223 \224\322+\262-Zh\036q\261\342\245Dh,+B\342\204(\335"
+	.ascii	"Z\024w\365\335\024l\002\242a\032)6\210H~K\300\207\224\255\332"
+	.ascii	"q.\352\324\006m\001!9w 1*\300\217\013}\256\247!\240\374\020\231"
+	.ascii	"\246\337\204Z\261(n\235\340\030i\365\267\017%{\337\332\005<r"
+	.ascii	"\311\026u\223\233\364y\342\227\314R\350=\272\023\001UKnj\271"
+	.ascii	"L#\320B\304\325\275\221\177\030d$\212\025\221\260\022\026\243"
+	.ascii	"(\257\034l\177\210\3332\2739)eO\003\323\033_\206=\204eA>`\214"
+	.ascii	"\227\327`/\232\241\303x\"8\310\243\275\232\017\363HX\31688z7"
+	.ascii	"\231\346b\262\032"
+	.text
+	.section	.gnu.lto_.symtab.728182c56799de24,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"beeperModeMaskForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.728182c56799de24,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,833 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\275\b"
+	.string	"\364\f\242\001"
+	.string	"\030"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\330\370\241\354\t"
+	.string	"\003\317\307\242\316\t\006\002"
+	.string	"\002\002\002\003\002\004\002\005\002\004\004\240\342\234\212\n\005\215\377\300\244\017"
+	.string	"\006\232\242\307\331\016\b\003\002\004\007\253\301\343+\006\002\006\002\007\007\002\007\b\320\235\262\314\006"
+	.string	"\t\224\217\236\327\t\006\002\b\002"
+	.string	"\013\f\366\324\377\367\f\b\005\002\004\r\231\370\252\307\004\f\002"
+	.string	"\002\t\t\016\273\275\367\232\t\n\002"
+	.string	"\002\002\017\260\376\345\344\001\b\002\b\020\266\344\336\363\021\256\214\313\351\001\036\b\002\b\022\231\272\370\356\007\n\002\013\002\002\005\002\004\023\240\342\234\212\n\024\370\221\301\220\005\r\r\025\026\304\302\235\224\006\027\334\347\232l\030\240\342\234\212\n"
+	.ascii	"  `\002c\225:\210<\\\231%$u\226\240R\374'\004\263\004\026\004"
+	.ascii	"7\300J\300m\300\r\250\bp `\3732\215H\256\004>\001\257\034\200"
+	.ascii	"\357\276\225F/\263\375Vc\356v\177\377\321\206\013\324\250\300"
+	.ascii	"\025R\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"\025\006"
+	.string	"\302\207\024\032\260%\351\f\3030e\001\017\3030\fdKk\2445k\255m\2445\273\267L)\356\356\222\205w)\025\245}\222BTzD\027a 8\002u\270h3\335\272\341\"\3130\233C\013qi\222lUL\300R\251\323\310\360\370T\354\274\362\307!\333.\236\b5 \240\202\032Bz\361\301\311\300\320\231\025\217\033\256\247A\211A?p\336\270h\03644/\343#$\t\270\034nJ\230h"
+	.ascii	"\023\320\247u1P\330\233\215\377\201ED\007\300\026a\204\rX8\217"
+	.ascii	"qOh\366p\031\fJ\206\315\237\001mn\365\345\322\367h\301\343\032"
+	.ascii	"\235\002\312\302>\363\337e\0268T\323|/\366a\364\201\300T\t\263"
+	.ascii	"\340n"
+	.text
+	.section	.gnu.lto_.inline.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\032\004e\022"
+	.string	"\346XVB\020\217&\3515\235\342\210\270>\371\242\246\235\215\256Dj~b\027\007E\326\311\261\203\276\003\376\b!\253\334\"\220\r\027!\232\3759\004\200\024"
+	.string	""
+	.string	"D*\021\252\354t|\334\332\357f\275\377\366\355\023\"w\n7"
+	.string	"A"
+	.string	"O"
+	.ascii	"\005\2568$\2279\363\356\357<\315\217\212!37\033\327\356>\212"
+	.ascii	"\334x\035\352\226u\337\357j43\263\242\246\204\314\364x\315\370"
+	.ascii	"1\246\033+\336q\324SfV\3779\203\005[\370\257\372\373\270s\036"
+	.ascii	"2\223S\315\240\r\035\226\301A\2335\203j\370p\302\324\023\034"
+	.ascii	"r#@\234>\252=\327s\033\264\204\213\024$\370\265\350yT\037r!^"
+	.ascii	"\214\244\256\315cv\263\342\257\305eB\207\"\027@\036\251\246\223"
+	.ascii	"H\f\315w\264\004\003\263A\201Vth\202Z!\340\202Jk\004\367\306"
+	.ascii	"\216\226\2248d@0\206\240\r\264\275\221\203\241r\362\362q\036"
+	.ascii	"\216R0\201\244\f8\320\001`\022\203Z\351\340\305\371\221e!\006"
+	.ascii	"\265r\341f\3342s\023\343_\214\303\261d\246\200\003\f\3328\316"
+	.ascii	"\312\017\022`\221\241\336\025P\224HX\357\240)-.+4\036\224%DE"
+	.ascii	"j\023\250U\204\312\311\313\325C25\242\241G\344:f\031(g\240\274"
+	.ascii	"\254z\244\266 )\211\2616\360FK\001m\2501\275sffD\223\202$c`\002"
+	.ascii	"\031\252\252;\022\300\0261\205\241\021\253\231\240$\005e\246"
+	.ascii	"\260\354\006\376\021<\253\245\350;X\343i\334\236\217D\037`\324"
+	.ascii	"\202\320i\312\256\027\005\370\004m5\304\306\025\305\024\367\225"
+	.ascii	"5(B%\207\261\274\376\2679\365\275/S\f(\223K$\201\227<\033\224"
+	.ascii	"\t\\/_\034\363\006k\225\341Hk;\324\037\326\244\032\362\343\023"
+	.ascii	"\362\255\254\274G\026\257\035\004\243\314\022\007\022\364#\001"
+	.ascii	"\326\031.\034\177\317}\375a\032\247\352\"`\374\214\216\264\025"
+	.ascii	"\253\320(\353+\264\332\355\270\232\257\343w\345\353\344.\003"
+	.ascii	"\022$\333\375 \256qEJ\362f\227\217\335\242\223\325\305p\322\037"
+	.ascii	"\335L\177\030Df\025\321J\0076\302\263\007CU*\313\376:\350\342"
+	.ascii	"\374&\224\247u=\360\335[HK\277\341\267i\232\006-\357\363\220"
+	.ascii	"\211\020\241H\215\240\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`v\005\215\017"
+	.string	"\306\324>5@m\222tH}HH\240}\371F\017\367\247\202VQ\024E\0178h\016c\371\304\253z\361MI\273\252\3014\320\016\r\340\320\034B\206\205\201~\263\333\222-\223\f-"
+	.string	"+"
+	.string	"4"
+	.ascii	"\250\207z-\0079\306Hy\224\307\004aeF\306\374`\2757\3547\254\263"
+	.ascii	"\243\247\341\247\231\244\003\216\007\324(k\365\222\377e=/h\021"
+	.ascii	"\002\345\365\016\277\263Lz\201\216z\225\277\226\006\366B\240"
+	.ascii	"\177\232w\026\324\373\020Io\036\344\t"
+	.string	")\245\304\324\274\353\316\030\376\302\235g\024\255\034N$P{=\215@\375z\022\201ZC\260\017\201\372\241IRJ\211\002\3030\026\276\353 87/\f\303Lz%\002Tl\030\300\007.?>\254\023\344\f,\354\240\264\016\006\206I0\320*9\340\352/f\345JE\002\016\005\324\250=|\207+4d\212q\212-\221z\213\266\367'k8\303\265\005\2107-z\024I@h\250\021I\005\021\tUPPH\273\001p\002\021\232\263z\022\340\321A\222\204I\346\004\212(\022H \026+\201\004\"\241\230t\324\247f#$\220\261\313\363\252\0132\315\250x\354k\3746\354\2302\226'~\311\315\323\246z\025\351\340\323$T\302\271\023y\217\\\n{\210U\236\361j\244\252\2008\324\017\314\250\254y\263\206\270\213\030DQl\336\264\205\200\261w4*c\276q\263\252h\205\201?\237\315\310\3775\"\262T\311\276?\344\211$"
+	.ascii	"/\342\304!\252\357C\311\017v\242\351<Q\n\037\034\225\003@\017"
+	.ascii	"\267=t\371\037\270nv\035\214\316\030\256\006,\364\307\024\355"
+	.ascii	"\020Vg\360\347l\312\270\031\317tp\177\373\366:\246\322\252\252"
+	.ascii	"\263\031Drt\375\22183*\220\252,P\354jX\222\307>\210A-J\303\276"
+	.ascii	"\2244\r4l\313\240\240%u\033\276U(\353\353\362"
+	.text
+	.section	.gnu.lto_.pureconst.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\205\004\001\200\004\002\200\004\003\231\004\005\230\004\006"
+	.ascii	"\231\004\007\230\004\b\230\004\t\230\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\271\004\017\231\004\020\230\004\021\231\004\022"
+	.ascii	"\232\004\024\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"]\007"
+	.ascii	"B\n$-pI\223\016\034\367q\357\352d \\\020\f\244%\340(\025*\364"
+	.ascii	";\362\252*\350\246\334t\230!\274z\266D\377\377\363o\344\023\362"
+	.ascii	"\267L\0013P\344\260!\004\241\310i\303\247\r\021\242\207\375\030"
+	.ascii	"\342\rpN\251\301\353r\020\261\242CE\\\2101\245*\277\013\220\255"
+	.ascii	"b\325\254Z\221R\n\324\202\374p\264q\222\022S\204xi5\201\351\201"
+	.ascii	"\202j\2623\351\362_\f\366\276J\336&s&{R\220\320Ef\353\222\306"
+	.ascii	"{\277\023d\3775\321\227\007\276\r\001( \220\002\251\301\352q"
+	.ascii	"\360:\nJ*\024w\332\207Zi\201\025\353\242\253\230\323=\251\343"
+	.ascii	"{\243Vp\205\334\0340\310\260\026S\262ZL\376\253\205\341\fl\201"
+	.ascii	"q\300\363\231ek\241\351\302\361\343\036\217K\r\207,c?B\300\346"
+	.ascii	";dB\376\216\315\036\260\240\266\361\267m(E"
+	.text
+	.section	.gnu.lto_.lto.fb7c25a783367c72,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.16.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375 \214\035\004"
+	.string	"T\007R"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\256\334\ryw\350\375\005yu"
+	.string	"\005\001\006'\001\005\200\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_heartbeat.20.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`:\001\255\016"
+	.string	"V\\eF"
+	.string	"\223\223\016[\352a\360\3621_kdVt\246\212\036{\272\231b4\204\227\033\244\001\275\240\310\253\251\032\265\037n\213"
+	.string	"\033t\"\n\201\0256\364\177\327k\375\026\242\006\321\277lP\\\177\037Z\204\255\221\275\367\336)\005P"
+	.string	"P"
+	.string	"O"
+	.string	"`\307\266\357\342/:\233f\202'\276\013\005cE&\310\356f\237\017\250\247\363\002\352\2514\361\356S\306\316\177\370\251\n\341\303\373R>=\\\316\002)\0218\001>\324\374\354\250Y9\353\221\345S\211\361z\260\273\216\336\327\341\246\267-\301v\004\373/\001\007\177)r\201\350A"
+	.string	"\310.\207\226\220\255\2419R|\365\333\367e\316\2621\227\036c)\303F\265\273X\311\306\336\371\2411+X\320}e\352\254\212k\006\t\230\233\335\026\222S7\350\234F\3731\016\323\035\334\360\221\335\324\r\034\273`\002g\235S\007\336Y\3344\325gY\020\305{UV\231\362\234\227\026\ri\255Ry\022\376P\2119\366k\334\206\346\243p\006.\336;\365\271zJ\345Y7\360\351h\361\301\024!\034\370\352r\206\007N\313)\266l\020\025e\t\373se\312\246\321\027\215\2563\232\006>\212\bt\242\201\253\244M\233\200\031T2\342D\024H\2336*\231\\\030q!\224L\013e\030B&\242\f\264qY\311\307\332\250\302\226\2214m\3130\360\364)\253\307e\305\220H\362K\262\330\276$\003\227\223D\3314wG8\b?r\263\232"
+	.string	"\"\202?\346a\3103c\243\n\027"
+	.ascii	"\266\3112x\266\301\b\251\3058c1\242\026\274\205a\001k\177Uk1"
+	.ascii	"\220\262\".\235&\312\231\301\272&\006\013+\242\324\320G\023E"
+	.ascii	"\\\214\240\212\fNDR\rZ%\322\224BA\001"
+	.text
+	.section	.gnu.lto_grab.21.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\200\001\275\017"
+	.string	"\026\235hG\360\222(\035R\353\232=a\025]\311\363\003\250A\013\272\n\361\2610\217\330\241\335j\026u\315E\371v~\264M\203\211\365\375\227Z\022\207kE)\330\204\243`CK\216g\001\3157'\247\021\242{\331\275md\357\275S\nQ"
+	.string	"T"
+	.string	"S"
+	.ascii	"\257\026?\266\375\027\207\361\3317T4\021zV5\254\231\037\273\273"
+	.ascii	"\211N@{\245\037\240\275\316\022\377N\247\374\374\277N]\036j\300"
+	.ascii	"\220\345\224\303'5\320\372\240# \\QQ\016\031\353\261K\227\260"
+	.ascii	"EJ\017\203\335\265\004\303\rw\275\355\007\266\035\330\347\021"
+	.ascii	"+v\024\200\355j\230\001YY\275\201\342\260\337\276/\363\330\312"
+	.ascii	"i<_8\256\335\375\214\303\374\321%&\037\3521\236/\037(\177\306"
+	.ascii	"%&\250\313H}6\205\0076\002&g\367e\344\325\n>+v\350\237\035\222"
+	.ascii	"\366c\034\346\273\210\341!\273\255\321\306\256\230\300\333'."
+	.ascii	"\360-\356\033\315\217\221(\310\203tj\223\345;!f\3434\247\315"
+	.ascii	"\211\"\323\243E\356\330\247\361\032\234\177\302\235\212<\250"
+	.ascii	"\242\275\316\371\330EB\034.:\244d\203\003\343Elt\350\274\250"
+	.ascii	"\344\314\026Wr\222\260Ow\266lM\272j\322\264J\317\213\277\004"
+	.ascii	"\340\t~\n7B\271`\322N^\007!\344\021I\311\304E8y])uR\241d\"\245"
+	.ascii	"l\035i\263@:\341\266\221g\332HD\356J\022\274\355\324u\336\026"
+	.ascii	"\022U\247\223\202@\260\b\"G^\247\213\355:\377\3723\260T\310T"
+	.ascii	"s\345\024\335\025\261 $'\206\006\220\b~\232\217\023@68\001! "
+	.ascii	"@\002b\310\252\0366\263$h\233#\266\304\310\207\360\026\207q\314"
+	.ascii	"\027\206\376*e1He\307\3255F\301\017e\n\202\341\240<\303\003I"
+	.ascii	"\001\375\206\027\nf_h\255Qq\023\204\201\322\224\340\002\270\303"
+	.ascii	"\267\357\344\346\340\226/7\322\007\355\226\246h\024\n"
+	.text
+	.section	.gnu.lto_release.22.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`s\001\365\017"
+	.string	"\366\336mG\360\262&\0350\305?\261\365\023\2114Twl#\250\006\033N*\r\177\312\365\222\316\232\n\203\210\336_\300\373#\030\275\0376=\"\302\203\321\350\275\333\204\264\305p}\016\257\034\027\346hU\236\213\322[Q\204\354\275\367N)V"
+	.string	"W"
+	.string	"["
+	.string	"\273a\002s\332\251C\315\266\257\3425\237\2553\303\0300c\341X\271\361\331].t\001\365t>@=\225&\376}\312\370\371\207}\242p\355h\201(\237\036.g\001\230\020?"
+	.ascii	"\200\254\031\272\261\263\362\330#\013\250\022c\006aw\035[`\207"
+	.ascii	"\233\3366\211m"
+	.string	"\t\366m\004\022\306\246\321\032\215\316ft}\370\317-\204\306\005\342%\207\354\021n\313O\220\335\2414f\376\372\355\3737\217\331\233U\267\361\200\026\031W\315\356n*{\373\347\303\274Y\301\202\357\257\225\2664\231\213\027\035<\273.\"\247v\240\235F\373,\336\342{\270\341\240]\030\234\031\001\255LV\211r #~^H\223j\225&0\037*\021\210}\031\317!\3712\256P*\325\323*\037\273\001\260F\212\017\277\251\332\026\216c\n\211\331]\006>\214\307\350|\231Sg\360\342[\247\276WO)\217\036\237\236U\214p\340\257\023\340\340\343Z\341\222\022\177\354\220\025e\t\373s\003\377\211id\242\301\253)TGa\363h\344\344\231JR\250\356\244\022]8y\245\023\256+q\030J\"\0237By\334H\310\335\211\204\342R]\207\342\2660\345Sf$\254\231\225\234(rM\262\330\326d\003\021)\222\345\325\334%\361"
+	.string	"v\020\317k\202\"\202\337\346\260\222\t\255\237\270u\252\037\023\215\342\003\032"
+	.ascii	"\266\311Rx\266\301\210\203\215\301\306\302!l\240?\303,k7\336"
+	.ascii	"6`\\\213\201T\302\342.X\241\321*\225\253\262\202\246\275\256"
+	.ascii	"\211\305\303\212(5\364\321D\021\027#\250\"\203\023\221T\203V"
+	.ascii	"\2114\245PP"
+	.text
+	.section	.gnu.lto_clearScreen.23.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`/\001\205\r"
+	.string	"\006\032[B\020\221\223\016s\354\353\177\t|p1\004\210{\035\357\21695\031\302\261\363&c\200\256q\220h\333\255\341?\343\326\b\"\225\032\240Z\0037!(\002\300\253\020 \316\241D\002\260\177\250"
+	.string	"\221H\366\2262\245F"
+	.string	"B"
+	.string	"I"
+	.string	"\027\260[\242R\332\365\026\370\252\036\355U\266\375\020\027\301\331,\3203\021q\200d\220\220^v\367\302\274"
+	.ascii	"\365\b"
+	.string	"?\200z\324\017\347\236\234\377\021\207(\035`t\"\317\223\343\301\356:;\321\206[o\033\201\355\006\366K\004'\217\316D\362\335\243/\302\301\220\357L`\264\246\226\220zl\317\223\352\301>\\-\261\357\375\025LG\230\206\232VMg\246o9(\275\270\034\370v5|\247u\021W@\330\346l+\355\247|\304\335\033\t\032\365!\016\252P\251\032\251\n\256\nI\241\023(?_SOr\303\006\271\212L\345\247\b\321T'#\324\343\325zq2\245|\3623\200\324\320\315\202\302\334,\324I\034E\205j\367\363\316\306~\302\202\201\030\273\313\300\304I\033?\235-\203`Y\323\241q6 \235-\3232d.h\034l\302\225aW\b\226\331\\\232\215su`\234i\024\266\253\223e\333ey{;\301\265\221gj\371(\310\277\007eG\370\n\217\225\350b\003\205FT[\302K\037\001LT\264E7\343\363}\377\240`\032"
+	.ascii	"\266\231E\246m0b\313\n\r\266\333Tt\022\214_X\200\365\216\214"
+	.ascii	"h\232\234z\256\222'2\246f\212\260\262XvG+\203l\214q\274\026\\"
+	.ascii	"\030\303e\266\t\306rP\231\203v\237\224\024\3235\311"
+	.text
+	.section	.gnu.lto_clearRemote.24.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\226\001\205\020"
+	.string	"\306\037qH\340\322&\035P\035j\213)\221\242$D\255`\235\226\235\221\337d\3058\230\222\216\326D\r7\353)\316\001\265v\264\213r\242\265!UL\020_\217 \307\311\320\264\217P\017\037>U\274\200\320g\317\210`#do\262eJ\001\\"
+	.string	"T"
+	.string	"^"
+	.string	"\033.\360\327]:|\201y\331\235\300\274\264m\006\rZ\314z\310b\206s\325bd\030\355\206_\\q\326\247\334\242\262|"
+	.string	"0\227\317\316\3462\376\230\241\202\007\r\230\3157\030Y\334\016\304N"
+	.string	"\t"
+	.ascii	"sm#7\206b>\273\312\300^T9\223\335\265\276`!n\356\2661\330\216"
+	.ascii	"`\037G\366\267\335]\307\230C\246\232$\325\334{~i\265\212P@a\344"
+	.ascii	"#\001mw\246"
+	.string	"\026d\207\244\r\027\017\177\373\376\317g\266g\226\3738\342\254\307b{\227\267[|\231=?\\u\373\202\243\345x(\332\245!\271\264\203N\325\376\316yZ\336\323\341\003vcA56\262w9~z\210\250\202\337\347\262\013\006jtnvv\367\257\303\270\205\246?3e\320\277HqF\227\037\245\250\001\305\230\343\237&\027Q~\210^\364\310>\355@'_\307\240\212\376u\351\253\314K.~v%\001\"\306\r\317\210\226\326\274R\b\bdW\0235\261\033\036\232\226\326\354\320\2451'\372\224S\t\205\203j\256\244\300\t\236K%(\325\251\302J\nD\255N4\240T\246\224\0174}\033L'\247\257\224R}%#\006Q\026R\337\n\b\246>/l}\223!\022v|\240\005m>kj\224\2116iE\227W\333.\316\203\"\237)@e\264OJ\372WH\334\242\213\217Z\224 \222\021FH\207\210\215\344\244\370\035"
+	.string	"\266\311\342c\333`\204\306\306\020G|\004\033\177i\001N\r3C5"
+	.ascii	"\0023\023\013.T\"\247\2210\322\205\026\021\227m\n\001t\215R<"
+	.ascii	"\002\336\021\230\027aaBr\363T37\342!x\262W\027A>0X\3440\367"
+	.text
+	.section	.gnu.lto_sendRun.25.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\266\003U\032"
+	.string	"\006q\252G\240\232M:\234\313\032]\277z\347\335&\250E\255\n\214\366\022\275\205\201=r\355\324#\024|W\257B\300\003\357\353\\^\265\243`\371\211\220\333\342ZO<\215\007>\2561\353\200\325\345\202\372_\330jmb\311\336r\247\024\224"
+	.string	"\211"
+	.string	"\230"
+	.ascii	"\t&\222'\301]\211\203S@]\342\301\213Rk\345\361\005\361tg\036"
+	.ascii	"'\374\335.\240\352\266^T\230\362\276\233\267V\336\027\005)\355"
+	.ascii	"W\275\b\356FX\374\246\326(`\224Z}<\246\211\247\366\235@x*\036"
+	.ascii	"'<\265\355\007\021p\316\335\327\203\021c\202jJ\362U\253\217\266"
+	.ascii	"=\236{H\347\312\234\237\3640H\026]3X[\\VNO\237L\300\235\b\242"
+	.string	"p\244\2319\351\346\016\026\255\246_]\272pZ\2222f\241\326j\271s\222q\307n{\264\215\301\3362\001\266y\366G%\r\324\376\026\332vp\340\315\246Wk\235p\340%\324\214\034\274\2523J2\314\366\351\344J\331\237u\243\254\003@:\347F~\234+\371o\376\373g\367\3756\226\026E\351\330\224\246\242\364\234\322;\245eL\372\005>\370\276\3120\030S+\21405U\213J\371q\253\337\276\377\344W\266\314\266;\361\356\300\242\252\265\312l\266\354\3646\316\007Z\3463y\023\334\255\220\304\n\304G\212G\246\326\030\rN\355#\236\312\030\001:\033n\322\301t\2041\331\340sV\304\021\257%\tf\237\313\267n\276\017{\370\221\337\375\204\2479k\343\005\025\257H\215k\371\315\322\2050\205\246\005O'\303<@~\347\336\311\265~f\275o9\3606\2407A\204\220\337Y\226\243\305&\331\3172\346|g[\305\261"
+	.ascii	"\361ty\305\257\004-\020\272\225!\004]\265V\tX\257R\302\367qj"
+	.ascii	"\"\023\362\273S\337Dx1\273\247\3357\255"
+	.string	"\221K\263\232\326\334\3547\300\024W\323\032\367\004\277\316\314v\212\274\203\341\351\376\202Cl6$\220D,\212\241\242-\032\2056\305X\333\243\332\270Af\241\036#\333\t\240\243\332ht\013*2\262\021\215\240\215D4\024DA'hB5\033\255g\307\243\321P\215v4\2165\232L\351\263n\224C/D\226@\241\177.<\360>^~,\2012\375\\(\256\013\333\342\332\202\322\352\2144k\335Q\201\314/\214m\230q\326\003\003\244\300+\350@\206\177\031\322\351u\305v\177Y:.\253'%\031f\260\251\033^t\231\202]h\314\225r\203\353\354\201\027\271\034\371R@R\240\006\0033\250xU\027\342_q\350 \277\013G\250a,\346\220\201fhH$M\322&9\200\")3\353\020pf\322$\303\0306C\317O;\224\222\256\304=\311\375/D\243\bO\271\225;\374\333\334\235\3445\301\0331rb8\210\004"
+	.ascii	"i\201\301\200\361\350\033\301\215pA\0270W$\3409E\222\037\030"
+	.ascii	"\341\032\307\t@D\254.$\321\303\f%\b2X\267ZU\323\276\332\177\223"
+	.ascii	"\214\331\0328B\357zm\353'\221I\216x\333H|C\305\304\203\016\330"
+	.ascii	"+\017\214<4~RL\322\037<\216\365\032\020\320\f\177\204`\354\201"
+	.ascii	"\237\223W\344\350\177"
+	.text
+	.section	.gnu.lto_updateRow.26.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\262\006m*"
+	.string	"\372L\330\020HpZN:[\264\033<\022D\330\346\316b\371\267\017-B"
+	.string	"\354\332m u'\230<f\363\022\257\213ou\330\331\360Tw!\372C\271m@\271\030\025\336\350C\240\365\345\005\341e\363\224\317\337\266\2665#\226\020\"w\222\001\377"
+	.string	"\343"
+	.string	"\375"
+	.ascii	"\003\264\352\226\274Y@\237@\025\211\267\252\f\307\204\266\314"
+	.ascii	"\013\032D\235\254\005\367\275[w\021n\231\337\344N\242\356|q\234"
+	.ascii	"{\273\236l\367:\023\260q}\312\316\365J\276$\212\271\ruza\365"
+	.ascii	"`\244YAYs\3575\006}G}\212^G}\332?\326{\245\360\216:\317>\036"
+	.ascii	"v\324\211C\341M\020\370\363\255=5E\333F\361\245N|R\331a\326\216"
+	.ascii	"\013o\2100ux\331 \212\240\216J\232\3231u\240;2\302\256N\204\231"
+	.ascii	"\303\002\201XJ\373C\233L\n\226\3231q\240\022\230\034\001r\266"
+	.ascii	"\013\021ajY\237\217\254\033_\205\270\262l\274\207\356\314\365"
+	.ascii	"0s:\246\r\024\301\326\226\031@,+\253\252M2v\\Y7\236\366\232q"
+	.ascii	"v\\Y[G\321\241;7#B,\030\250\017\f hg\273]bU\331\376\363\027\300"
+	.ascii	"h\261\343\312\332q\333\243p\357e{\205\225u\3069\363+0\363\bf"
+	.ascii	"\365\001b\356\275\016\252\334\312\022\377\353)\243`\262\277b"
+	.ascii	"R\237\n\265}^\321\b\352\367\237O\307\276\324X\341M\331<f\247"
+	.ascii	"\224\355&\363\325!Zf\334]\314GF\217\362\0370PD\364'\377\320\235"
+	.ascii	"\177\201\266L\340ig\241\223\375Am\031\350\307\247\247\310\323"
+	.ascii	"\226\003\254\226w\3322\200\266\254s\263sNj\031\347hgb[\036\266"
+	.ascii	"ea\317r\020\265\f\374\332\371\327\263\354C-\257\252\345^\317"
+	.ascii	"\262\212ZN{\226Q\324r\253\226m[~\002"
+	.string	"!s\356\b\315\2752\362\330\334.i\225!_\373\315~\264?\355(\263\032\237\215\201kR\232cD\254O\317\034\305?\373\224?\031\310\314iP\277J\246\357\252\251Vw\257\263\003\032\267\005U\021oUsML\303\315\270m\225b\256Q\232ou\367^\243\247\214a\215\242\342\316\315\250\357\247\177*\324\003\rT#\214\020`7\331wnS\205\335>\312\342~\272\330\302\264.\f\213R\214\312\346\265\2272dg?t\365\351d\334VJ\324?\275d\200\266\032\3504HJ\324\305^\026;@/\325\020R\306\245\312\336\035\275\367^_7\371l\367\215\305\251\365\212\232Q\365\247}zi\240\325#aX\354Z\354\242\366\020\026\306\202\321\275\325\350\005\333\327\347*#Se\357N\004\207\032\330\350\231&_\257\205z-v\257C\204\365\231\216.7\225\250!\204\255\261\003:\270 i7\347\214\260\331\272\315\305G\357\351\243\316"
+	.string	"\026F\271Ee\363>t&\327\003\355&\253\2156\262lL\225\275K\252C\2356\372T\216Q\375m\205\210\365\213\017\325_j\331\026\352\356+\307\250l\036\367\264\355\263\035u\003\223\343-_I\236\335M7$\001^W\314\354\342mI\t\274\356\275\017\224~\305\304P$\232\224\032\251T\242\204\212\021\352\223R\222\305\2104\3051\251\223KLOMH\310\344\332\004u<\361\224B\035\221\235D\0363"
+	.string	"9I\201\323\023\223\210$\362\350\304\002)\205\323\323\022\t\343q\311\330\264\204\304dLB>\031\025\004\361\321I\tiL\036\217H#\320y\337]\\'\2077\344\361\211\311\205\005\025\034\b\250\231\302TS\235\021\237G\341\2249\335\323\313?\277~\311\202g\215\316\250\220\330<\275\354\341\342\235\016\320\267\302\233\342\r\367\322\302\001\237.\312\b\207\027\352\323\235\242*g\2204\231\262ys[\212\330\ro~}\036pj\350Q\347\364\362l\317\2711jFQ\236&\376\f\007\206\003\210\220\247\001\264Q\277\215rK\247\0014\nE)\366\373\265N'\2074\360\262Dy\323\315\270\343\364\223\350\330a\023\350w\201f\376"
+	.string	"\302\376\n\247yX\265\024?\257\247\t4[+\033\277\036\352\264)\305rb<\201\022\374\375\004\200\204\250q8b\220SH\231\231@DDf\233\306`\002\231\2613n\020xV\333\264\006\266\251\243\035\343 \244O\342\304W\013#[\3044U\255\013\336\360\251L\266\026#\337\332S \263q\271\316\025\267'IlhP\0307\271pp\377T\251D\210\331v\331\236\\\274`0\323\034\354y\324L\347&W\206\311\221\271\323\"\203\344}\364\332\375\024\213N_|L\360\341R?B\"\275\334$\240ph\353,\325\301he\233l\377\206 \232O\234\376\362b@\234\230Or\b\322\306\t\277\033\n\224\242\261\266M{\005\312W\203\330y\343\372\004\227\205\024\335\373\223\"\355\r\275%\buV\0040hlGJ\204"
+	.ascii	"\276\310\205\262\277\270\203\250C\342\244\307\342f\2764\370="
+	.ascii	"\2202R\340\321C\321$\220.\023\344a[\3063\016\347Z\240\334Kb\331"
+	.ascii	"\372\376\361\003U+\331\366=\232Y\362\2608\302Wy\312\0027X\034"
+	.ascii	"\341\263\256E\330\311\317L\225\314\031\327}$\224\t\276?"
+	.text
+	.section	.gnu.lto_drawScreen.27.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\275\013U?"
+	.ascii	"zj\244\027B@\236N:\273"
+	.string	"\341\030\006\316 !\352R\223\356\352\2219\244&\242?\331\226\246^K\2663\034T/\264\255\324\b\271\020`7\212\n\fpD\027\022\221\223\b\354\003\223'^\005\363\037k\226H#d\357$\003d\001M\001p\001\256X\324\355\343c;$\361-}.\357\322\312\263|Fo\331\333\332\024\016\356\331\275\254:7\024\334\263\271\333\331\257\266\262\257\327\202Se\324\027\355\200\235\"^\363l;p\317\342\356cy\026\347\2519~\364\276n\177\201\357K-\320W\356\331\246\272w\307sv\013\256T8\264\366\t}\356)\276\357{5\365\345\361\354\372\244\343\331\374\226\324o\374J}\273\331\371'\247&\246\245\245R\022\322\221Q\021\321\220\2202\211t[\346\221]3v\366\223hb\177\302vw\252{\023\335\231\350\310H\301K\253\224\033\022@/\214FY\247\322\270y~\220\016/\353\326)(X\2510\372\344\bNrr\244\243"
+	.string	"miq7\212\203\303E\353\203<\272\270\007\"Y\263\036_\231\203y\202\211\3327\273=miM>T\030\225\256S\201lX\b\314\251\356\250x\200\332\322\234\\y\271\350Z\362\205\3215\271\250\021\214\\\333\035A\242\2740Zde\260x(\346~O\354\266\023\230\244\251\275U;\263\313\003\024F\327\326)\271\350\035>\276\372"
+	.string	"mikg?f\367u\245\222\252\031\242D\333\261.\t\227\334!B+\303y\245:\f\343\207\b\315l]\006\211\002}\365\370\f\215\f\343v\302\373\276\215\241hio"
+	.ascii	"\357\306K\335\035\243;\211\0257r2\355\302\314n9\353@\361B0\227"
+	.ascii	"0\347\006G\340H\363\260L\r\372E\217y\332\006l\t\307\246]\362"
+	.ascii	"\205.1\t8\306\013\233\247o\337z\210\255y\232\3468{\035\341\252"
+	.ascii	"\334\235B\005>\024\347"
+	.string	"\" kn\312\262\230\221\017\250\222\334`\307\347\025\325:ex\261\273\267\216\006\314}\337wA\337\314\317\264\350?9\333/\270\360\241g\373\\\307\263\317M\216L\221\346a\031\303\215\335T2\234\247\335\307*\024\244\322\331\255\333\305]\241\305\255\025\001\302\001\337Y\n\022\270\270\021\030pqc!q[\235\372W\271\270\233T.n\002.n\251\177yGA]\257\357\315\374\336\373\311\211\305\335\344\342fjq/!q/\223\270\225\222\270\223\\\334HH\334GG\334F.\356\"\0277\221\213{\b\211[\210\305\235tq#[\334\356\371\336\355\365\336\307#\356\225\305\235Y\334\230\305}\013Rn\322#og\331\220\372\006i\024\364\272a\305H\371\230\037\360\377\362\367\375{?\337\257\367\266\373}1\037\354V\366\215\013v\036\203GI\246\017(p~L\330\224\030\365\r\022\"/0\272\345\336\350V\376\365\003\001q\030\346\235"
+	.ascii	"\323\367\340\216\352\245\357\327\327\202\001\211\315\347-\216"
+	.ascii	"\210Q\343\263rT\\\265\016\234?1N\212p\034\263\362\t\365hA|\243"
+	.ascii	"\246\tW\335(7\263\326AQ\2719H\353\202F\374K \023\337[4\312G\271"
+	.ascii	";=P\"D\253\364\315m{\372\020N\207\362\264\233/\312^U:ex\261\253"
+	.ascii	"N\224\213\362\237jQy(\023\345\3431c$\303\215-\224\207*\\\321"
+	.ascii	"\302\037\241\374\300c:\266\374\306\216^\237P\236\366\001+\202"
+	.ascii	"K|\365\002\020\007\025\023\t\334}\231\242\314\323d\306rI\226"
+	.ascii	"J\222\262,vV.*M\272O\231*\237\365\352:\345\226*\267G\204u\224"
+	.ascii	" \276aS\206\027\221y\332C\213\255\202\234\344c{\0022\233gzx\""
+	.ascii	"y\002\266\t\376\230\355[\360\370\224\317\356w$\036b\236\326@"
+	.ascii	"~\227\273\211\210X\230\315;\3453&c\225\215\233\221\371O\306\306"
+	.ascii	"\360C\rz\234L6<G\266\212\373\220*a\232[ufV\220\207\020\377\252"
+	.ascii	"\206\\\020\344\247\234 \347=<_Ps\336w\254\303\357\214\370\026"
+	.ascii	"8;\b\362\357 \036\002:\304\312N\331@\306\203\314\244d\270\261"
+	.ascii	"\233p\363k&\220A\210\300\207b\255}\222<\263X33\201\334\030\312"
+	.ascii	"\347\206_.\264\2733\\\316\210s\231\363\276/\203\022\217cB\302"
+	.ascii	"\234\263p\326|\277_0R"
+	.string	"\367\007Jd\f7\346\227\251\335\365\265y\332\017\353Y\314\330Z\001\366u\f\353\362r\303\272\274\262\013\027\\,\220Z^*Z\310\330J~\265\260qc\005k\303\253\353\203\262\267\254j|\315Ha\303\253\253\306\r\0252j|q\261\270\352\342\272\242\301\245b\306\325\226\327\327\225\325Tw\325h\341ue\243\253\313\353JI\035\233\373\352t\334\360\004\362\004\\\233\227\222\312=a,\223\315=9\205\255\357\333&\341P\257\251\210Z\036\272D\226\207\337\033S\205|2w\371\b\300U\277\340\3118\257@I\357H\361n\245?\350\254s\336\341C+\344c\022\215\310\337\222\206\243\026F\303i\032\372O\332\231\347\314\202\017uf9\236\325\312\037<.\362\203N\232\247\026\206a\f\370\230\237\314\005\b\301S\027UZ#\247\3102\t*\367J\004\225\217\371\254\233\200\200\271?\232p\023\251\234\222\035R\004W\361\017\020e\363QH"
+	.string	"\362\253w\341\364aT6\017\025\225\231\362\363,e&|\266\204\315\260\271\221\346\255\357\373\276I\201\307`\370\367\004<\202\220{\035\202\312"
+	.ascii	"\362YT\216\220\017\346\005\346\324\220\031r\301yp\313\\ RV\206"
+	.ascii	"\312\020r\004\274?f\322e\356aa\211y@\371X\345\243\274D*e\253"
+	.ascii	"\334\370\311\230\224\225\362\237F\220rR\316\203\236\214cUG\312"
+	.ascii	"k\0373Ad\330\314\202\273\343(SI\253H\363\216\300\216\335\024"
+	.ascii	"\360\030\030\023\026C\316\305Q\f\200\364\250q(\005\025CH\215"
+	.ascii	"\210\210\214$\005I:P\002"
+	.string	"1\244\314\252\003\021`\255C\022\t\005Q\262\034\020\273\252\335\312$[\223\247\233k\350\021\245\245_\321K\333\2421L\251/\373\337e)\370\316%@b)8)\t\302\344a\263\016\355\305=\300\262\255\214\210U\f\200\023g.\235#H\256\344\336e\261\265\037\306]3\250\370\324q,\377M\335<\243\005C\322\270\204X:5\247\270\235\371z\366\230\276\354\350\230\036x3$\372\275\325\335\033\323M3\330\305*\214v\352B\253\337\332KET\207\347\366\361\312\364\207\273\363,\301\312\251\306p\022\016\205\\\347\222!\366\201\034\214\353\222\013\270\025K\205\201\200\322`\304bc\215\275c^\033\027\213\234`q8'4-w\304\3011_S\340\220\217\350\310&\210y\220]i\212\363\247\001\300t@7\304\2661u.\204\023~\2247\324\t>\241\277\030\327\236\364\220vM)\200\313\370\356\001\233t\f8\316u\254J\315\376\355"
+	.string	"'~<\b\364\"\2221\241i?\325\204\350\242bj4\242\231\350\307\265\020\303\336n\344\320\210\334k\001.\323\251\034\302\341x\266\320\256\357\232<\312\264\243<\360-\212~op\247J^\201u\230\004\257Fx\017\232\001\266\352\221GQ!\030\231_\025\221\27133\311\220Q\264\342\227\236\264`\356D\350sAfU\222\315?1\200\376Q\33461C\262J\353\316\344\226\202\021\322\222.J&Z\351\304G\207\033"
+	.ascii	"\243\300@\214a\320\377\241\033y7Q$\203\b\031\204\375;A\300\n"
+	.ascii	"\330%C\005>\002\031\250\243>\337@\030(\0221BM\274\265\346O\024"
+	.ascii	"\035\232k/\307\306\261f\322X6i\\\364\004v\377\270&\344Zm"
+	.ascii	"\"\225(\027\345\204\210\370:\266\202U0\2315\341\214\340l\177"
+	.ascii	"1\026\226\221M\243\273\266UKH\372aC\243\006"
+	.text
+	.section	.gnu.lto_screenSize.28.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\t"
+	.string	"F\223C90\345(\035\236\301\373\252#\320\343p\n\035\033\310\033>\322\304\373R8F\235\216\377\r\273"
+	.string	"\265A\"\214\357\216\255\213 a\200-(\264\223#\225k\024B=B\b!R\246\0243"
+	.string	"0"
+	.string	"1"
+	.string	"\240\215r\205\032(\315\324b\"\001\260\2731s\202\354\330\365\201\354\230f\034|\202\376C~\261T.'\324\350\251%\354\256\363\204\272\270\365\2665\266\017\354k\002\231VMg\246\277\005\254T\020Vv-Z\254M\301N8l\2036\306\366\323\276\352 \340C\321\005vS+\223\335p\343\270\035s\270\331\366=\376\021zA\274DusM\275)\200\277\217Dl\273\024\006\276\210'\261m\034\363E\331\261k\001\213\212\224-;\034\245b\330\277VS\266\246\265\207\177\246\351+!\217S\300\330\303\351>\320B\310\343\272\211\216C\367}\030\"\367\211\017\237\016(z\274/r2\346\272\006/\2068\316\213\230pok\232!i\311\227\246j\252/\025\035\245lY\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.29.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\300\003\375\032"
+	.string	"\2263\261G\240ZQ:\307\313SLnr\207\242\221\335?\262\177\036o\203\n\323u\347P\2259\302\231\324\274}w\217_}\316\033\f\271\177\017\264j\030f\001\025G|b\224\205\353\255\207v\341\241\\\325k\213P\306\021K\b\221;\245\236"
+	.string	"\214"
+	.string	"\242"
+	.ascii	"\265\372~.\272\002\031&A\352qU\334\223\020\tH\222\356\252\267"
+	.ascii	"-3 ,\265\025,\260\375H\222\267\326\032k\036\234\332w\272\021"
+	.ascii	"\333})\376\252\225\311\tU\255\276\004\226\221\027\355#m\373C"
+	.ascii	"N\304f\003C_\217\327\322\245\321A\245\251\265\312|\036\033/\206"
+	.ascii	"\207\215\0277\307m\037\305p\251\315\277\341)}\224q1<0\246\n\r"
+	.ascii	"\016/\027\306\226x\354J\336\n\032\342J^\216nx\240\306\225\030"
+	.ascii	"8\274[\030\273\272\021\346R\247-x9J[\021j\255\246;\336\213\273"
+	.ascii	"u\3334\333\035\354-\023A\333\247D\267\311\376\006\203\301\240"
+	.ascii	"\227\311~\324\315CR\307\226z\347S7\354\277[\347I\376\327\217"
+	.ascii	"\374\256#\371s\356\373qH\352r\251oHj\233\245&[\324\255\245\036"
+	.ascii	"\227Z\\\352\260E\275#5\035\251/@\207\306\025\004'\265.\005\327"
+	.ascii	"T+\361I\217O\375\277?\352k\337\376\022\237\311\233\270\374\031"
+	.ascii	"\350\203sU\334\215%\252Z\353\206O\031\370\372\242\236\005\016"
+	.ascii	"]\326\230Zk\020y\361\266\315\227ri;\352\304k\316\205M\256KpL"
+	.ascii	"Y\267r\"@og\273\366*\032\200z>O\205C\001/\265V\007\036>\345\003"
+	.ascii	"\201^\224K\001a"
+	.string	"\013\315\350w\263\361\"\317\036\313NF\316\216\"\020#A\330\352\354\316\002\211\311\231\0217\\\330\032\200\312\371\270\321\240]+.\002(\272\341\376\374vu\266\007K\227\205C_k\213\030A\277\333}\223\277\200KXV\270U\362\263\334\212\374\302m\262k\351R\035\264C\241\333\340\313i\325\231+\033\273M\316\331\357\320\023\026\034Uc\233\304\253\222\030\370TCEd\255\365;R\214\027\277\227z\201\037XA\234T\3203!:$Dk\347\254\026\204d\236\344\b\023\264\263v4\"\231\347\2260\211\266v\232\030J\023\001\031\035\025\t\325N\323\b\305\254\204\321\021-\204\314\244\311L\320fE2\242\363H\006\344c\323H\304)\253\231\346)+}\365a]&GP\2617\207\265\326:\226\273\205B\254\247\345;2\261\265\331\022\206\245\213q\263\2615\325e\215\213\3407\033r\311\255\271y\302\255(d\261Y\221\t*\210\323"
+	.string	"\013\027\350w\006\360\004\206\225\245\230"
+	.string	"\177\342\317\311\035z\002\323C[\373Z\236\2653\004\321\357\310\365\311\255\222w\266\265\n\242\224\350\002D\250Q(\203\024sF\231\032\t$\250PA\013-\006\240\"!+;\021@\"4UA\2125\0036#!\324\217\364K\251\352\234\225:3\272\311\nF\f\030\026\273zu"
+	.string	"x(\203\265\227\232f\310\273\251\361\237\212\235\by\323:KqHiw\2640\026]\352;8i\307\317\335u\021uO\277;\021f\200\306"
+	.ascii	"g\001\313n1\036i\371~\225#F\037>Y\021\301\003Y\241\323C\333\214"
+	.ascii	"I \260\240UG\347b\3408\261_\201\204\303\223v:\221{\302|}\253"
+	.ascii	"n\252\006"
+	.text
+	.section	.gnu.lto_writeChar.30.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`G\001\025\016"
+	.string	"\326\332^D"
+	.string	"\221(\035`F#\203\356\350\302\357,L\275\f\340kR\316\001[X\364\306\344\353\311D\030\224\255\272\001\3130\324\236\303u\344\341\261 \002\274b\313\353\013\247cf\201a\002\322=>\"d\343\263YB\244L)I"
+	.string	"O"
+	.string	"F"
+	.string	"\335?\f\007\260\253\202\201\261\373\201\030j\317\374i\266}\024O\321\3312\260\217%\305\321\320\001\265\202fw\341\347\0036\317\260\013\330<\323\021\357\236\235\177\327\261\023\255\031/uzr\026\354\256\323Kq\270\365\266\t\330v`\037&\3074\255\232\316,}\217"
+	.string	"-4H^\354\256\274r\354\214,F\211\277\374v\347\273\3541\213\267\272\277\230\2645\241ehy\220\331\335P\340\231\033h\317>\322\205\004\003\026\312?V%feD\323>\200\240\373\n\305\272\373\001\207\202\247\375\226\253\bj[\030\345\275M?(=\271\243\252G\325h\232*\322\232yic\033DY.hn\\m\033\270\253\264\261\354\256\310=\033\230^IbP5)\371\262\277S\252\b\373\330\356\256U\345\355\337\337\361\325\3379\353\327\356\362\024J\021\024tS\344\324$\202\224\304\305\007\036\203BD\243\023\b$.\212.\224\230\210F!\t0\206`\205P\311\t\004q#\030\362q\024M\340 )F\016z\276=\266\252\3324\001\210\024U\261\t\333\r1\"\263\312\227;\371\026wEX\303KU\355\b\034"
+	.string	"\266\231E\246\275\246\326\306\315\224\247\231\342t\231S\312\232\257\262\331YZ\316\b_B\355\232z,\213=\260\261_\231\033\320\004`\034"
+	.string	"}`00\b\300\031\f\3433"
+	.ascii	"0B\240\302\301\335'\325\212I\230d"
+	.text
+	.section	.gnu.lto_isTransferInProgress.31.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262M25Po\322\030 n%JR"
+	.string	"\364)\334\035B\305\232\021\317\032@\347\235d\324\020$\357\310\316l,\022\3566C\274&\375\326ae\244\271\005+\225\326B\342\3362\005\231\214\f\325\036\316\205}\0322\031/\211\016\304\205Y\0160Z0\302\352|\240Gb\220\2639^\017\022f1JX\315\325\215\332P\274\212\237 \367:^\001vw\177\243w\252A*\275,\254\354\206b`\226eJ\t\371\265\257~\347^G\224D\323\222\t\r\330\035\271\220v\247\301P\243\323S\007(\2354*@\351\364\177\200\240\275\351\374\be.@,NJ\273\023>\017\335\324m\253\232(\201\210\nG\013\212\b\244.\243\260\273;\fQ\206\376\364/\370\023\376\215\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"Y\005T\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_isSynced.32.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\022N35Po\322\030 \333 J,\2073\326\274@\004\346O\017\003\335nFhMl\b\222wdg6\026\tw\233!\003\r\023\275\2662\322\334\202\325\022\333\210\264\275e\n\230\214\013\234A\036\353\n1`2Z\021\237\007\353\252\032`\254 D\365\tA\220\274\240\247s\264\034$\304b\224\360\271\232\331\267\255\032\325\231x\024?E\356q\274fvw\177\333;\325\370xqQ0\331\035\305\300,\313\224R\372\263\347\374\316\275\206\250H\246#\022\n\260\273\251\240\354\316\202\341F\247\247\nP:m4\200\322\351\337\340 [\323\3511\322X\224*J^v'|\035\252\251\323V%\321\001\220\225\215\226\023\222H\235&aww\027$\f\375\351O\360#\374\031\001\007"
+	.ascii	"\265\311R\241A\3153\247\225\235u\r\201\354\020\361u\315'"
+	.text
+	.section	.gnu.lto_resync.33.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`>\001u\r"
+	.string	"\026\332[C\020\221\223\016\273\277\243\274(l\n@\367?\326\3542\"\317\021\240\035v\356\007\300a\374\033\200\377Q\373\254\346\317\330\250\226\234<\005J\353\003R\2629\202RU\200\367"
+	.string	"yG\240\265\331\n\236\330\275\211\224)\005E"
+	.string	"C"
+	.string	"L"
+	.ascii	"~\332\017\361"
+	.string	"\223\350(\223\007\330-\255x\331\355\0168^\177\356\316\201\177\327\005\300?\213\354\031\357L\233\351pJ1\241\332\335\250\034.z\212\374\213\270\007\247r\362\314$\330]'\247\222\341\326\3336`\033\201\375\030\001\037q\022 \337\345\317\025J\362\334\237_\002\377\256YK\f\313\t5\312\225\335\221R[\354[\273\273\326\222}\324\177i\032j\372e\332\322\264j:3\375\315W>\250j(\300\261\213a\025\2630\357\205\007\215\035\035,\317a\360\357\245R\252\033P\355\221\263 \360\f>\205\226\276\bW\221\302\322\r\214\024\b\224\252\3559\212\354\332]\020\377\004\211\204\001&\027\023\370\227:8\033\233g0UUe\\`!\345\312\327\324\247\354\260\366\022\024\256]\024\020\007\241M[\2401\366\361\001e\"\241M\373X\350L\370\200<\020\242\346\211$\236N\026\261\r\024?\nX\373\214l1\244i[\324t\243[\253%3\320"
+	.string	"3R\2229y\251\335\300A\2363geC\016\032(z\342?\004\332\017\356\"\004\200\251\305_D\002\030"
+	.ascii	"\266\231E\306\336\365Y\013nu\306F\336\332h\212\211\003\201\251"
+	.ascii	"\301\003\260\r(\003\354\201\355\302A\f\246\314\005\273W\211\345"
+	.ascii	"\235\260\232L%\340\203\001\227\020\232\325\024p\227\027\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_txBytesFree.34.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\222N45Pm\323\001\244\004\252\2337\240b\002=CBE\361pk\325`\003\363g\243\021\364\2714eV\315.\336\321\321\023A\022\265\326\356\271\215,j\310\333o[\356\224\002\230%\021$s4\325\325I\300,Yy6\f\325E)DI\305\006j\323\211\034\353\212\232\311\262Z\260\"&\245\025\245\271\267\352\004\241\037G\317v\360\274s\252\323G7{nO)\354\303U\220\025f2L\016Pv%VT\266$\"\301\260\235\331\222\355\367\354{\374#\373|x\300.\350ddw\0228b\036ybl\373\034\357\310\254\301i\321\001\\\204\"BRvg\234.`y\004\237\261<\322\212k\177\232\177\220\303\215\220\b\327m\177\027\203\335\365\343\272\211[o{\300v\201m\215\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.35.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"m\006"
+	.string	"\004\013\324"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\367\304\005\177}\270\367\224\005{y\370\366\364\003wu\270\366\244\005sq\370\365\324\007{o\270\365\244\005mk\370\364\304\005ig\270\364\264\005ec\330\357\004sa\270\357\304\005s_\370\356\204\005s]\270\356\324\003s["
+	.string	"?\202\210\200\340\001YW\306\001U\305\001S\304\001Q\303\001O\302\001M\301\001K\300\001I\277\001G\276\001E\275\001C\274\001A\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\f"
+	.string	"\200\024 \205\fD\003R"
+	.string	")\200\024@\n \005\220\022\223\0243I\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_displayPortMspInit.36.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`o\002e\022"
+	.string	"6\340tH\340\322\2501\222\222\001@#e4"
+	.string	"\353i\271\262\033\025<\252\275\333)\221\030\016Wx(\341\360\344~\256\027\215X\211P)\331Z\250++\027\247Q\201(\n\004\214\221\217\030\374\254\007\211\343\347\016mf\353\266Rn)S\nZ"
+	.string	"["
+	.string	"b"
+	.string	".<&;\367n\330\025]]\215!\302\247y\211r\322\013vB\367^\323\253\215b\233^o\247\330&\177\346'R,\006(c\\J\031\210Xj\204\356-A\227\017\261\257\337A\354+\005q\361S\364\237\273g\"\307fl\261}\216\b\334{=\307\026\227\233\336\266"
+	.ascii	"\333*\233\242\002$,\336\342\001\004\026\253\345\002!\322\341"
+	.ascii	"\250\315\247y\362+`\337\2758\233\253\230\340\275`\026f_O\276"
+	.ascii	"f\366\335{\373\350\243x\212\230\037\342\325\341l~|\365g\266f"
+	.ascii	"a~\364\2241\244\303@mv\2512)\214}\357\322\017\2667]"
+	.string	"\362\246It\372\363\246G\336\264\245\323\025\225\n\344\210\276\264H\363\235\025\200\030\033\323\307\310\343\364\225\265tD\251\017\356Ee\356\\\251\245g\371\361\322\005\256c\340\273w\205\304\247\361\032\007\020\224\314\217%\366\265\322\227\237@0E/9\3626wNM\221\303\370\311\317H`r\034\0057>R\223\342n\035;r\343\330\223\177\301\300\r\356\302A\352\347\336\033v\251d\265\030\353\204\026\312.\264(\310j\257\b`\370\002+\274Z1\320E\253\201\252\021\2072\t4\360$\fi\240\251\274}\307\354\013z\356\327\300\241Ew\243*\036\240c\346\355r\200Jq\204H\"\244\203\207\241\240\025j\363/\312\330\022\317!\312\240~jO\217P\217\322\314q\370\210|eI\264\364Q\222\230\373\r\236\217\236nzd\0025 \260\002\021)\354\006B@\035>\224a_\025\006\305\025E~:\246\250\261\005\202\257\331B\321\213\002q"
+	.string	"\326u!\nc\n\327\020+S\0314\206\332\356|1N\234X\026`\2753DH'7\030+\304\215oA\023\2126Nd\0343s\2238b\325\\Q7\250\316\271\264\371\201&\243\033\356Z\326\273p>\017\351\306"
+	.ascii	"\334\211\004=\364K<@\216L\314iSK\311"
+	.text
+	.section	.gnu.lto_output.part.0.45.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`q\001E\016"
+	.string	"\226Z[B \255&\035#\204\031( p\314m\207^c\032\2478\002\b3=\313\300"
+	.string	"Y3e\fZ\210h\321\2169X39$\254N\013\270"
+	.string	"H$\026\025\\\025U9|"
+	.string	"0\200\372\260\220LI${K\231RF"
+	.string	"M"
+	.string	"E"
+	.string	"\216\326\241\375\017\242\022\333~\207{\340\354\230\327\241\230(DPH(\023\273\033\017\261\007\250\016\337\001T\207\252\341\3345\037\347g\3114\272>\365\307\301\302\210\222\211\302\363\342\217BcwmU\270\341m\037\260\235\300>\211\207\206.\241[\354\236Z\020X\234}\261|e\277\342\230W\261#\031L`v\327\300\313\243D\335Nxi\037\304U\270\207x \240bGT$\024\350,k\2763F\206\350) \357\226\244\304\2326F\006\367\024\020\353\256I\t\230\335\216\300aOUSm\007\237|\t*F\322\221\257\251O]C:\021\2223\251'\326\367\267\273k=\271\3224<\313\377\216\372U\323\371\356\277\306b#\263K2#\263\030\240\210\r\177\271\375\026\221\237\362\365\342\022\302F\027\006\004\240-Sp}txh\203\020\003\345\360p\324\234\215\366\361,"
+	.string	"m\231\006a\303C\373t8b\326\211\037\235\rO\344l\237\270\301\234i\035[\004e\331\026/\333y=\371\251_$\324J#\330\256\324\032!*bU=\261\255I?\253\002& p\002!\243\363\001.\236\241\003c\324yh\311\343\021.P6(\212*\232\241\300"
+	.ascii	"\312l\215Q\263ow\211:R\333\2212G\370\207\373b\360`\327\317vl"
+	.ascii	"\320r*\354f\030\3217\271\006b\034$\021\034\327\261s\033$]dB\320"
+	.ascii	"\274\323m!z\n\365\245\327\2061"
+	.text
+	.section	.gnu.lto_clearRemote.part.0.49.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\030\002\355\022"
+	.string	"v\344|G\340\360&\035\352\247\256\b^\003\300\370\t\343u\274#>\023\305\033\310\213\330k\001\270Z\372 \331\322\343?c\365\03134\357\313R/\003\311q\301\3338A\r\320\267\327\314\215\357x\236\007\257\t\303Uq\204\354M\344N)e"
+	.string	"i"
+	.string	"g"
+	.string	"\017c\367\201\025\b\227C\315\032\355\247xO\313}`\367\330\3051:\332\r\023\\\032\364.\035~\300\274\364.`^\332G\341\020\221X\315\266CDZ,{\2503\323\301\334dlM\273!x\251\".\273FN\346G\032\215\313\365\266\033(Q\024c\006\021M\207\307"
+	.ascii	"\347:\222\335\265\347\341\226\267=b\273\201\035k\001]\264\316"
+	.ascii	"\350\370\360?\200\0035\0356\27337\034\033B&\215x\320\213b\266"
+	.ascii	"\322)&,\271\001\321\304cbc\366\303D_\361\262\225\270P\207fAM"
+	.ascii	"\310\003^\2368\177\350*\354\317\257\013Yo\366{\371~P\314\267"
+	.ascii	"\371\263}\240\377\260\370\344\022\356L\255\305\007\362w\351\377"
+	.ascii	"\260xK\242\033\312\321\300\264[\373\270\364\210g\215\001\234"
+	.ascii	"r\266\031\016"
+	.string	"\230xsT\325\313\344\260#\274\205\004\317g\221a\202\277\003\323\017F\321\211\236\227x\263G\324\331\2754O\267\322\274\320\223N\274\335\227\323l\224#\241\b\320\330]\005F?R\361w.]!\025O\273\364S\323\202*\236\346\333\016\001\211\351\006\323L]\242\346X\271s\2538\266\243;/zz\321\262\213\346\002)*\024\205\227k\256\264V%\237Q ,\227\352d\245\265b\301P.\260\\\251\024p\225\0021\244PT \252\345\002AN^\261TZ\340\312j\325\002\277s\2538\276\355\016d|\0302\212\277lv\272\301v\247&yQ\030\263p\2737\f\036\3643\375\250\346\330\236j?\370\222I\207\216\013}A\253q\273\335dJ\235\372\231\r\247R\247\rU\004\017+ @B\003a\335\006\266\310\002$\315\211T\246\031v\361s\340[\230\001\003]f\240\2446\224\354\260\2040B\301\332\301L't;\356\342\007"
+	.ascii	"\362|\204+\306\240\031\360\b\206s\266\265UuK\033\333.\026\203"
+	.ascii	"\250G\2439G\013\215\212(\332P\2042\034\270\222!2\235\365\241"
+	.ascii	"uA\211\214\272%\211\201\253\357\277\226\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\004\003\375\016"
+	.string	"\264\025"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002\034\177#\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\037\177$ \177%\027\177&\005\022\023\200\204\001"
+	.string	""
+	.string	"\003\002\"\177'\035\177(\377\377\377\377\003\036\177)-\177*\271\200\202\202\200 \024\177+\005(,\025\177-\002\026\177.\031\177/\032\1770\310\232\257\0061\1771 \030\1772\006\033\1773\261\325\3420!\1774\005\r5\201"
+	.string	"\002$\1776\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\021\034\005#\035\0207\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\0168\001&\1779\037"
+	.string	""
+	.string	"\200\200\200\001'\177:,\177;+\177<*\177=)\177>%\177?\003\003\031$\003\005\032\006\035\315\275\203\337\001\001\244\001\003\006\034\304\007\003\006\033\315\325\314\311"
+	.string	"\001\204\n\003\007\006\302\001\003\b\036D\003\t\b\310\377\241\372\001\001\202\001\003\013\f\242\001\003\r\033\244\006\003\r\242\007\003\r\033\352\233\252\372\016\r\305\304\211\022\001\302\017\003\017\020\020\017\302\001\003\021\020\241\212\214\020\001b\003\021\016\312\273\230\204\001\001\302\006\202\007\003\021\020\236\220\262\005\001\202\016\003\021\016\245\341\365\361\001\001\342\022\003\021\b\316\226\221\n\001\202\037\003\022\021\302\006\003\024\037$\003\024\031d\003\024\021\242\007"
+	.ascii	"; \300\002)\242\342\001\030T\021\300,!\336\320dx<\246\322\332"
+	.ascii	"\006f\330,\343\232\232^\371\226\263c\250\314z+oh\256c1\307/\021"
+	.ascii	"\322u\030\324\0038\006Gp\f8\374@\034,eXa:ld\002\271d4R\036\204"
+	.ascii	"\007\204\247\307\006\004\325\\f\003(\262\004\267\361\211u-\375"
+	.ascii	"\260o\240\224\f\007\362\267\240\177\fS5\201\016\3025\240CXP\034"
+	.ascii	"\303z\300\343h\365G\031\352q5h\3668\001"
+	.text
+	.section	.gnu.lto_.refs.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375 \361\375\004"
+	.string	"\342\314!\"\240'\031\016\377\377\377\377\377\377\377\363\231]{.\033^\276\355mw\023\333\b\331\233\020B\b\221[\312\024\017PQ\200\005I\004\023\216\007\r\316\206\207\211\210\2114\263\370\262x\352Fk#\352\217\265\253\376\364%\370\026\003\320Iw\241~j\304\231\241{Ay\205~B7B\377\240\333\240\274\240O\320m\364\213\033\006\340\300Y2\373P\216\224G\312\345|\224g\227\2106\225\223\275\272\233~*\2153\322}t\257<\347o\b\007"
+	.ascii	"\234\206\300\026\"L\215\222\205\233\250\366\"\t\365\220\240\224"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.decls.fb7c25a783367c72,"e",@progbits
+	.string	"(\265/\375`\325*E\273"
+	.string	"\352$!@W LI9\351\352\272\272\373\257\273\353\277\356\252\230\213\356\361\315N\212Lb\342\212\022\261\225\374\212\332\335\310\336}mD\335\255\347&|\214j;\217\234\352\020\033\257:\273]\344"
+	.string	"\214&\331\357\"\201\301\313\\h\261\227\360\027P\370\274\226\024\005Qv\312\034\237H\364\336R\246g\003\374\003\375\003m\333E\277x'\033\331I\003,\357=vr\247\314\275\307\035f\016\2309\260C\256\266\222\240\366=#m%\237w\013\017\2502\252y\315t\204\030\251z\264\005\321M)o\300\036P\364\262\007\224\317\360\036;?\350{.\303PNsl\336f\3530\203\204\254\355;)=\177\200\326\275=\376"
+	.string	"=\217I\233\t\333]\3728\206K\321\245\035\177@?H\221\234\234\201\265\275\353J\312\341\265\255\343\331\200\026\247\266\266vB\354\242\356\332\3265\221\030j\311\325\224\222\376\204\024~\016\t\263\003\243\3629\r\216\220\022"
+	.ascii	"\362\305$\215\237D\230P\242\360\263\004\261$^\236\031\022Fc\266"
+	.ascii	"\250\004p\235\3315\307\370\210N\275\267\n\215y\357\325\302[X"
+	.ascii	"\216\263p\027\346\302t\214\205\347\030\216\235\034\307l\3476"
+	.ascii	"v;O\363^$\026{\343#$(\271\027\341\367\211c5\276\302lQ\315\013"
+	.ascii	"\203\253\206p\rK\030M\307\330\274N!$I\342]\204\020Np\034O\341"
+	.ascii	"\247\006G\367VQ\355\034\315$\303\362\356m\212\020\301#B\204\b"
+	.ascii	"\021\275\314"
+	.string	":3Z`\3177R\346a\031\351\317W\330J\215\322\r\253cSgI\023\022\231\266\3475\256\362_\236\2343>\334\370\230\376\004\351\213\351\205\351E\220\376\227nh\302N\330\t\202\2374wr\316\b9\243\327\366!H\317 P\336c\020\3509\220\362L \r\201\326|\306J\316h\234\004\007\251\311h\366\336#3\007:\314\034\320<y\034\311P{\007\244O@\332\303\037P.\302d\354\344a#\017\341\304\253\261\310\005\273\367\356\260\333Q\323T\333\237H\377\227\375\202\343=q\2344\005w\217y\320wj\202?\240\033\330\003J\002\177@\177\016c0\020\025\271\264\274f\36769\3544e0\335h\373&\177@S\366\200b0V\217\376\036\241=\220\205\201V@w\200\003\357\371\353\323\317.~^\3729\371\363\361\347\243\237\231~~\361\263\322\317I?#\375\214\374\331\t\006\026A\b4p\377\207\370+\007\177\333l"
+	.string	"\005\377\321\277\212\360s\013@\214"
+	.string	"\326\300/ k1\243D\375+\b?\223`\330\301m\376z\200&@\006J\260\360\r\376z\302\356\351_Gxp\001\017i\024\035\232\255B_\240&\375\237\373\337\325 \374=\201'\267\340\257+\n\320)\334\334\003#|"
+	.string	"\340\257\300\237\211\364\tM\016\1775\376\f"
+	.ascii	"\013\376\326\276\016\335\200\377\036\374\325\207y\336\341\257"
+	.ascii	"\037\320\272\316_;\3603\2166\341\352g\002\240\370\231\313\317"
+	.ascii	"^~\266\373\231\356\347.?\177\351)?\313\375\274\345\177\316_\267"
+	.ascii	"\374\275\200\277\017\360\267\211\277=\370\233\347\357\233\277"
+	.ascii	"\323\237\303\374\214\367\263\331\317\316\237\311~.\362s\363\347"
+	.ascii	"\261\237\277~\366\3613\217\237w\374\254\343g\255\237\263~\256"
+	.ascii	"\361\263\324\3174~\216\372y\306\3172~\216\341g\030?\377g\020"
+	.ascii	"\377\275\374\257\373Y\3713\005~\326\340\347\233\2371\3709\205"
+	.ascii	"\237Q\370\331\346\347\023~\316\340\347\006\374\334\341\377\331"
+	.ascii	"\177\026\376?\371\231\001?/\340g\005\374\\\342g\022?\027\340"
+	.ascii	"g\017~\026\300\317!~\016\300\317\033\374\377\362\377\356\277"
+	.ascii	"\335\177\260\377&\374W\373\377aooo\357\367\025\177\353\364\007"
+	.ascii	"\240HL\205\224\253\362\364\004\357J\213\237\220H\267\211"
+	.string	"i\352\250\334\300\206l.o\334\275l\246t\225\035\334;\265T\306\035g0\223#\266\246#\264\343\2221`:\272Z^$6\244\217\345\275>\216R\\&\003\030\233lW\213\331\2147\246\356\222\322\275\0310\335k\344\313v\3575\336{}\312\251\346\275R\033\220L&\246{\243x\230\356\2241M\351\3366\223c\362\204,\273Z\372\244\031)c\336\026M#3o\234\2252-3\216\335\245{/\177I\231OPwm+\214\016\302\204\233\202\227\236\205p+9;[IUv@\242\026cDu\302\331R\333\332bK\317`s\375%.\211\227'eJ[\t\322\305N\312\225v\343\322\005\257\305\\\001+S\215*\320%\361\364\324\230\177}Q\217\225\251.\325\243\212T\233j\262\266\250J5\251\272`gEr\225w\r\275\344<`yV\230c\326\230>d\332M\307\310\341\336\033U\230Y\232\313\226$^\220~\3032"
+	.ascii	"\271$^3\251\310N\353(#\314%\361l\222\274\252\244d`\353E\233\272"
+	.ascii	"t\2512\363z{\017M\253\202c\251mO\237\251Aj\336\262\032\270/T"
+	.ascii	"fQ\322\263\364\326Hz+\226\336r\245\2678\304\204\261jyab\300\274"
+	.ascii	"\303\3500\t\241\342b\352\313\235\315\332\033\026,^\336w;NH\257"
+	.ascii	"\266m\327jJ\260\322\232\332v\035?\217P\tBw\363\025\003\211Wo"
+	.ascii	"\355x\351%\341\224i\b.r:M\230 {ly\313\335\304\311\310\262\244"
+	.ascii	"m\307\265\332\016\215%\324X\333\326\342\203A\203\224T\333\206"
+	.ascii	"\263\341R\247\326\204\2374Wa\272,i{\253\224\276zIM\270\265\241"
+	.ascii	"fI\272\312\260\275\333\376d\3002\006\232\026+k69\300d\231\251"
+	.ascii	"\362^;]7y\013\003Sc\032Fd\310R\243\202\205\303mF\235\216\023"
+	.ascii	"\270\0271\330\3227\243@I\303\214i\202y\276\241\240\341h\300m"
+	.ascii	"d\234`\372\311\377\032\235\266%\256\032O\332I\333\020\036zu\276"
+	.ascii	"\037ZUb\272\t\263\371Z\304\230\353\212\222\236I\221\263\263\263"
+	.ascii	"\317\370\256\247y\215 (\323\325HP8\345\236R\333\327\033i;\333"
+	.ascii	"\b;\333\354\357#\\\303m\221\345-\273\267\231S\2172\326\226\264"
+	.ascii	"\265=\350\016\367\224\361\263\337\326\226\216\310\240\332\366"
+	.ascii	"\256\260\214\261\263\307\272J\002\315k\f\222R*G\274J\2458NN:"
+	.ascii	"\226D\2202\316\350\211}1\026\245\347\022\224\2562?\370\b\td\256"
+	.ascii	"\220\036\322a\035\244\301\330\331_\r\344\355\305fg&\\\3744\303"
+	.ascii	"\244\341L\022/\357\304\357\323_\355C/\211'B\004\303\310q\204"
+	.ascii	"\202cijR\372\326K\337^\322\267\\\372\246\222\276\2230yr\270\224"
+	.ascii	"Y\263\262\325\343+\006\326\216&XM\232\336\217\030\232G\357 \242"
+	.ascii	"\325#K\333\367\216\277s\264\016~\332\310\210\372\362\244m+\371"
+	.ascii	"\003\332\001{@;\313\347\255E#'\367\345\255-\0078\260l\223\023"
+	.ascii	"\"N\332\276\261\236-\334\013\266\363\274wjm}|\33630\021\275\261"
+	.ascii	"(7\256\320#N\310\230m\337WM\324\306\030\217g\333\020|\336Vh\220"
+	.ascii	"'6\3068\333F\362\001@jp\351%\232\357\013\312\225Y\313\320Ux;"
+	.ascii	"\222\320\320QM\243\247zFS\265T\327`gW\375\035C\313x\367\261\252"
+	.ascii	"\223z\211\211\f\022'(.\237\030\033\356\275J2\357\275\315T\325"
+	.ascii	"\312\2062\242dKP\\yycn}\213\202\342\n\002\246\253X\f\243\241"
+	.ascii	"W4\240\270\362\364\272\212\315\264Q\347\330\274J\037Y\023\024"
+	.ascii	"\027\316\030\226\273\033\033\254\b\227?\240(\323*}C\375\335\324"
+	.ascii	"N\275\2443\006\311\264\321\266\237|\3360n\254@\261#\322\026g"
+	.ascii	"*\345a\362\007\264*\261\007\264\336^\372\373\250\221:\331\302"
+	.ascii	"\005='%\226#6"
+	.ascii	"I\353\213\021d\f6\211\206.hg\332\332\030 P\221\261Q\006\352Y"
+	.ascii	"n<~\264m\373\304\324\344\007U[\253|]\016\332X\326\224mJ\245\244"
+	.ascii	"\177a_\330$\317\322\350\245\207\310\323U\230\274{\243zP#uCp\330"
+	.ascii	"\244\234\027\333\026V\372\274\3272y\026Y\341p\256\261\310u\362"
+	.ascii	"-\231b%\226w\221Q=7c\311\2616{t\213\274m\021\302\211\317\005"
+	.ascii	"\001\002wlk\225n\223\242\326\232\330!\331\244\256\031\312\274"
+	.ascii	"Z\244\007!-\"\343\351\251\255=~\256}\314-yik\215\177\342Di\311"
+	.ascii	"\303a\257\225\253\267\243\266\325L=\303\316\253\325\275\3534"
+	.ascii	"i\201D\255\355\323\233>\005|5\264\222y\325\373kj\232T\315`\225"
+	.ascii	"7&\t\\\r\346\227\364\276.a\302T(\246\301\344\204#\030\272\264"
+	.ascii	"\232\344\025\n;k\222\212\3073\3264\336<\231\032\201\"\357\262"
+	.ascii	"\334\266_\032\355\213\227\266\262\364\f6\245R\341b\247\326e`"
+	.ascii	"rvV*\033\220+vU\272lK\227zW\275\324\272:W\355\330Y\351j\333k"
+	.ascii	"\224*\245\322\325\26562[\226\t`qvt\325\255\3121[\324\206\213"
+	.ascii	"TC\235\335\275\327\346\205\025\033\225\216\235\3629\2619\273"
+	.ascii	"{\233[*\027vV9\271\372V\343n\224\260\3511\301@D\316\035"
+	.string	"\226\270\032\250\375k\\\325\202\326\304\361\245m\205\363E\315PK\272\201\205\2355K\n&H\232\336\\\224\034W6\322\373j\244\3675\245\365J\232\305\216\312J\333\373\220\351}H\351\321\275\364\250\230\364\350\035\225.\243)\243\202g\205.\355\236&\365I}\016a\202u\006\227\276:\261@\216+g\177\242\225\311k\332_\323j[L\246\266\364\265\206\272$\256\007\222\261)\351\253\222\263=<\032m+Z\252\204\236}`CU\203\f5\332V\264\277\236q^'M\260gFL\333\034tGZ\217\324#\325,\265qA&\252\247\237\f!\323u0\257f\255\326\205\n\210\263\355Q\032\316\263\263:+\024\257E\215\320q\326\355\351(\223N\231\322k\251Q+\f\212+//\257\333\264\274\200\342\n\022V\307\302jSL\2546\371*\337\366\210\2746u\030\t\303Ec\227\236f-\005\002\244~\361\275Y\320\206\274~\355\344"
+	.ascii	"s&J\333*\304F\210\033\322\251m\r\202.\251!\303\331\266z\365V"
+	.ascii	"\255r&\313\034\243\341\274\200\341\244\312I\272\265U}\360\275"
+	.ascii	"Y\246\272^}T\032zk\313\266\225\253\325T0%I\265\2554\370\2068"
+	.ascii	"\021\271\322\2662\371i\263D\206\373\343\214\f\231n{\253\242\247"
+	.ascii	"\327m\315\364\0359Zb\247\303Yu\360\323\004\337\026I\216\250\354"
+	.ascii	"\356\2252\302\307&F7Ev\345J\267\245\306\267\260JUoP\325,\364"
+	.ascii	"^n.\235\2248^\263r\254\270)\325\265\255X3\324\252ZU\257\370*"
+	.ascii	"\263^\255^\257\236i@\340\302\332V\033\255\206F1J\035i[\227\374"
+	.ascii	"\254\31469\255\266U\206.\313a\242\341x\3446\206\264\257\265\266"
+	.ascii	"\247\001KO\323#\315\222\245\345\322\r\367hK\024\363F)\347\346"
+	.ascii	"\372.\315+S\246\336\324FK\t\024W\336\2301\335\366F\247LK\333"
+	.ascii	"\302\202\245\241p\324\255[\264\242b\364\274\306\2501\274\361"
+	.ascii	"\216\327a$p\357\365\265\340\022\245\354\371\373G\357Qy\357\205"
+	.ascii	"A\323\274\312#\034\224i\230{\376\034\256\334\301\177{o\006/4"
+	.ascii	"\257\361\211\207\227v-9\326h{O\303v/\222\225\321\004\253'$\253"
+	.ascii	"\031\3102\253kD\352a\344\240\274VFd\331\275\034.\022\222\321"
+	.ascii	"\001\313\313\001Yv\237n\222\333\023\337\246\225\361\"-/\207\213"
+	.ascii	"t\217!\220HVO\310\262\343\023\007d\231\325\323-\263\272\033."
+	.ascii	"\322Q\351\002\351*9\3342+/\267l\371\264\001Y\266|B\226YI\005"
+	.ascii	"\305 \260\026\201\301\024nR\020\215T\310\t\376\210\206E\"\372"
+	.ascii	"\033\032\025\331\"\025AAOA\202\370SDT\241\001\013D@\300\341\017"
+	.ascii	"\305S\220 \226\370\t\031\021\005\005\201%\206D\243\022\026\020"
+	.ascii	"\021\031\005\203\302\240\257\370\203\256\020\016S\024\205A\337"
+	.ascii	"\013@?\"[\374\021U\374T\240,\212\204(dP|\n\022CE%\206\212<\004"
+	.ascii	"\005\215 P\374\021o\202/t\221\206\3703T\204S\374\t\016\025\321"
+	.ascii	"\004\207\212\352\317\004@\242\025\022\002\362\261(\022\006\331"
+	.ascii	"a\261\250\n\375\202C@\" \237\320\217hd\211\276\017\177\206\212"
+	.ascii	"H\344\260\030\026\211\300\241\337\n\033\024\201\301\024\212\210"
+	.ascii	"\025\350\240\342W$\262@\361SD\254\200\0067\277\242P\305o\205"
+	.ascii	"\016+\204+\374\212@BEF5A\243\025|?!a\005\200DA>\324\004\211\342"
+	.ascii	"\020\250\210D\321\250\250h$"
+	.string	"\314y\020p\370\013\376\206\322\033`\004\020F \241\004\276\223P\202\211\022L\240'\241\004\037\237\022F\360I?\202O-\026\177B\020\341\367\033B\200\370+\2628\241\004\305\033\373#\002\375\210~C\337\215\315\317\004@\024D\233\241 pXDq3\004J\201\302\257\b\034\256\250!\022\177\303!\341P\205`\n\303\337\013\304 \320\220\005\"\260\202\"\320\317\205\342\020\350\227\242&(\310B\350\027\024d\201\202\bL+\370\375\004\205\300b\320o\bt@\021Q\205\016\212\"\242\212\032\342\317\217\b\370\202p\250B\005D\302\240\232\"\321H\004B\rX!\034\326\024\207?\030\202@t\004A@D.\354\020\211\277`1\305\020px\302\257\bL\261b\347!\206\277\027^0r\001\r\256\020\246 \322\f\201R\004\331\025\302\025F\020\004\"r!-\376\214\340\223\022W\bW(\272\021\n\376\210\277!:\024\004\n\005\177*\254"
+	.string	"\032\n\335\024\237\202\004q\370\203\0018\024\002qa\321oX\242(\024\016K\334\024\203FB\024\\"
+	.string	"\032\016\325\020\177r\210?\032(\016\205*x\370\021\271"
+	.string	"\304\002\f\350/\b\b\303O\b%\256\020\016-\221H\030d9`\344\353"
+	.string	"QXd\203\277\3370\210HDd\004\201\037\321(\207H(<\341\207F\3507\004\372\021\005\371\212?$\024\203@\364>>(\204\310\200\005\"\220\006\221(\"\252\370)\016\205E,\200\210\212\210@\241\022B`\211 \020HE\211\240!\261\004\211"
+	.ascii	"\254\020\2560\024\022\207FA5j^9L1:\340\250T\345\031\030F'S\254"
+	.ascii	"\030\025\ra\222R\222.\252\350\364\332\332#*PSP,\326\216\333\215"
+	.ascii	"c\217'\023e\342D\304\310\223\257\233\033\266E\326\326\246\361"
+	.ascii	"\336^\231\264\035d\331\362\336\243ub\233\334\246\375\356\264"
+	.ascii	"\260t\265\204Z\253\304\326\300\316?\355\222f\231\025-pqKi\t|"
+	.ascii	"\277E\253>\260\272\216\316z\251\b/L\016\311m\222;\0316\216X3"
+	.ascii	"/f\222-\237\243\353\352\322\304i\215<\213\211\304I\333\333)\363"
+	.ascii	"|\344\311\225\331(_\323\227\036\026Ym\342H\231\242\344R\304\""
+	.ascii	"u\330\210\354i\215\325,\262%\034]M\250\212T\205\244G[!B\254\030"
+	.ascii	"\223\345H\342\265\225!g\224\204\335\212\321\341\200\2211\332"
+	.ascii	"hk\301Z\315\327T\322\360\372z\025S\353\307\227\035\242C\205G"
+	.ascii	"\325\214\352\224\"\331\362F\325\3665\227\213\313zq\221\353T\001"
+	.ascii	"\021c\2163J\215( \267^\377\361J\235\213\266\366\007?\305^x5i"
+	.ascii	"k}tY\005\2332\023kk\273j\021%T\304:\t\023\027\026\215\273\254"
+	.ascii	"[\0356\3132\353]\032\2654zQ\300sL\216\022)!\313\035\267\314\333"
+	.ascii	"\255\020"
+	.string	"N\330\233\323\364\264\n\323\326\366\340ashq\221\272\255\222\262X\325m\303=\272\227\311\267\305\221#\244\235\0209 Ol\334b\335\316\200\026\307\314jko\\Y\331\345\353p\250\244\345\325hke\240z\325\023{*\275\265\265S\257c\260\232\330\334jx\331!#\007\\\372\364\212e\272u\262L6\252\276\235\t\321I\326Y\315"
+	.ascii	"\3436\352vF\020\313\210\221\266V\306\003\203\227\250\202\321"
+	.ascii	"<\311\322J\031dhDd$M\222\306R\n\020\204BQ\234\b2\365\022`$AO"
+	.ascii	"2\347\314\210\210\210\210H\n\n\222\324h\016\262V\340ab?\373\346"
+	.ascii	"@qx\352\035`\364\\\347\231\331\224\202\274GPc(x\253l\317*2r\312"
+	.ascii	"gU\300\020\371W>\rgU\314 <\273\252r\301l\331\007\316|\361'\223"
+	.ascii	"\352\2675]~h'\227+p\277|\234\013\267\273*\253J-\355\337\363}"
+	.ascii	"\213\f\021\371\265 \227_\373\322\370Z#\353\\\352\216^(\244\263"
+	.ascii	"?\021\206\035/\335\177\204\007\240@<=!\227\261*z\220\232\252"
+	.ascii	"\bM\233>+\366qO2%\003\273\276\200MQ\307L\305-`\332)=7\202\022"
+	.ascii	"Y\272|\326\205\2358\273\227z\373\3314\200\223\364_N\365\3531"
+	.ascii	"\240\266\200=\013\006\020>\026Q<\032A5$\023$\360E5W\200\221\321"
+	.ascii	"\275\217\337\223U\234\214\230R\r\016\356\326\231\344}\357\032"
+	.ascii	"~\305\247\244\223_E\246{\024\376\212\221\357\031[.\344\bv\026"
+	.ascii	"!4Q\006B6\017\275_M\007\236i\375\rW~\201\230\200\3727\232\355"
+	.ascii	"\351\377c\325\247n\251s\207\002J3\006\264l\223\002)\032\337\230"
+	.ascii	"\265O\002\353\301~\267\322\205\n\347\356\251>\264\233\037\360"
+	.ascii	"\334\313\302\314\252\225\007\374\355\003\315\221\031\030[\300"
+	.ascii	"7\204,fj^}\235\3458J?PuE\254o\2231\003\337?\310R\303\315\322"
+	.ascii	".\334\250D\035\004$\003\311n\245\253\354\002\237\233\276E\341"
+	.ascii	"\226I\373\023\336:X\247\265\215 \003\255\256\363nA\326\230\017"
+	.ascii	"\272\\\375\357\007`!\304\263u6\225\201\220w\030\323\017\211\215"
+	.ascii	"\360\224\320x\032\306\004^\362\354\201\216\260\227\352S\347\005"
+	.ascii	"\355\036\215w\245L\271\275a3d\345\022\340\342*@\030?\025\226"
+	.ascii	"\005\016e\300\307JQ94O\005{\370\301\210-\005d:!\232\315\334\276"
+	.ascii	"\\\320\212\320\204\234\212\343qP\365\\-\345\021\223\277\212I"
+	.ascii	"\337\303\374\213\272\367\007\2228\321\336\301\227\275\224\372"
+	.ascii	"\343|\3616\021#\177\3101\336gP\264\032\364\335\215\256 \223x"
+	.ascii	"\030\b&\352\250\034E\"KlOO,\347"
+	.string	"Mb\256\334\003\242\"\n\310\033\307\214\210\304\340\205\373\324\301+\245\030\212\026\262BL\323sWv\357\274\365t\004\t\210\351\224\323\234\331\367\207v\311\275\300C\"#\371\013\020\202.m\320\205b\024\245\207\274\327\313\033$\367\3116\223\216\344\243\331\332\022\202\340\013\021\236\312\210\241\026b\342\205/\243\303S\203\341J\263\021\016\022\2208\027\352\266\222\030R\357\f\2116B\265\020\274\270\313\b6\351H?\343\216\220\024+\345`\031\204+r\325\242\212A$ \222\006\301\207\352\305\002P&\311\277+\001'\205\302.\212\033\310*BU\260\342\307\363\373(BN3\304\334\\;\207\257C\022\370J=\031\250P\264\260P\237x\034\037\240\242\256hY\177\277\202\327\370\346o1/\371^\254\334t\235\225\230=\021\200y\326\t\352\2349\375j\351\0202bh3\b\256\004B\267\033\310\352\024\322\325\270\3526\261\363f\213y\265\252\367"
+	.string	"8\344\262\177\255^\370@\312\336dF\377\340\242\021\240\202N\234k\bU9}7\317\017%)\311J\300\272{\016\241-\341\257\2369\266A\257LG2I\222\036V\334M\003y7,\370<'\356F?H\301A\f\024w?\016\364\264@\200|\017\275D"
+	.ascii	"\021\211\200\030\344\021\027j\004\220!\\\211$\323\020\243\226"
+	.ascii	"\205\034\330\004#\240\b\001\355\343\0377\001mj\017\002\347\264"
+	.ascii	"_\301\b@e\236\322\355\320\001\313\024Z\314\213Q@\277\035\354"
+	.ascii	"\034`M\320\006\2224\320\030\305o\205|\2406\3558\273\375S%r\316"
+	.ascii	"m\020\214uYO\261I\344\370=yV\377D\3322\021\351\232\"\334\357"
+	.ascii	"\331\245\234UvTc?\336\013\237#\233\267\274\350\324\n\b\310\210"
+	.ascii	"\252\nn\317M8\031\370\265D\256C\"\003\336\306\337\331\"d\307"
+	.ascii	"\362G\232\320!\212Xj\311\324\224d\344\210I\372\217b\242F\275"
+	.ascii	"\257\030\201\024\205\340\354\024\367Z\301#\200\251\350\337\007"
+	.ascii	"\254w\352\242\236\002\233\315\315o3\363\303_\017\373\017\215"
+	.ascii	"\210\317\032;\332c\b\333\214E\315\373\322\b\272GH\327h\007$\372"
+	.ascii	"\244\"E d#e\277\214\030\366n\023Jg\234F\354~\006Qb\302\307\224"
+	.ascii	"\333:\307\220$vnW\322*\037\312\322\2156\204\341\336\206\n\251"
+	.ascii	"\327\260n\345\217\360\360\0028\330\"\245\254\371"
+	.string	"a\336\274\f\267\253{\266\253\013\334<\217\364\301\0273\362\335L\030\037yk\246\314\271u\244\022\254\214\315\026\332\214\270\352\212\357\304\262\3672\374\340\2532\036\361\206\266\200\300{\206\340x\026\235s\f\004\252\032+J\353\030\026\226>?x\320\220\236\342\360\210\276\220s\333\032\247\323\226~\272\323 :\234 \226\375f\221m/\307\272\025X\202\252<\223\352\203N3CO\215\nK\3436O\f\230\032\252s@\rU\302\221m\320\215\003fg6X\025\261\n\232#j#raU\203\f\366\302\036w;\f#\272\f\3408\371\035\026n\236<\260R\313\022\237\243\274\357\277HHm~=\020\307\210^ 7\2772\203\323\245I\0173\nJ\212\235q\301\023\212\261yMc73\355|\335hf\311A={\254\r]\353\243\tx_\261\300\231Q\t\316E\342\256,\240\034<\224\311y\004L\240\f\"a\\MA\336\202\263\r"
+	.string	"\t\340\210\244+h|\220\241\312\263\202\270\312s\345.P\177\316\322/\325>\342:\232\027\216\355\345\260\321L\254\262\022\210`M\265\231\300\005+P<\225@\017J\264>\244\035\247\264\034\315z8f\331\367S\354+}d\262~\242U3\216z/`tSI\277\262w\364\306X\342\236vV\214G.\301\177\231\367\336p\300x\236w\357\354T\271>\024'\n\216E\177\006\004\320\f\357\271cq\006\334\367\266/s\267\212\350}f@\346H\267\003\340sw\236\016'\005\210\303\216[\234\026]\361\036,f\241\364X|_\275\2153|\315\274]\257X\377\002\346\204i\005\223}.Q\006\250\203\370U~\317\367\030\340\223\324m\234O\261m\022S\034\314w\206w\3474w\323\375\013\350\360d\263\340\236\t\357-\304e\322\357\376\337\373\312\352\363\317\311[\256\274\003p\233{I\274\277/"
+	.ascii	"|\274\266\017\2430\272H\351 \334\b\261\377\352\367)\310Ot{_w"
+	.ascii	"\204\371\023\377o\243h\325\325$\354o\0346\241\340h\034\266\220"
+	.ascii	"k\322%\223vE\034(\021g\375y\302E\353s\346b\341\353\243\027o\\"
+	.ascii	"\177\001\025\231x\345\254R\274`t\324\305\272Y\034i\f\313=\330"
+	.ascii	"w\321r\324}T\235#\004^^pE\312]\3164\340Z\307s\351\357\225\375"
+	.ascii	"\312\376\021\347\343\311\t\275\267\266\341\365M\334G\363c\210"
+	.ascii	"\311\233\345\203\365\327l\261\300\276L\207\360\216\370\347\351"
+	.ascii	"\223<\365\373(\272\322\233=\016\350n\244^S\f}7\022\222\357\361"
+	.ascii	"\202_\220\333\267\321\362\215\344"
+	.ascii	"Z\001"
+	.text
+	.section	.gnu.lto_.symtab.fb7c25a783367c72,"e",@progbits
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fb7c25a783367c72,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2324 @@
+# 0 "./src/main/io/flashfs.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/io/flashfs.c"
+# 35 "./src/main/io/flashfs.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 36 "./src/main/io/flashfs.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 37 "./src/main/io/flashfs.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 38 "./src/main/io/flashfs.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 167 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 168 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 27 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 29 "./src/main/target/SITL/target.h" 2
+# 157 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+
+extern uint8_t eepromData[32768];
+
+
+
+
+
+
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 239 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+
+
+
+typedef struct sitlLatency_s {
+    uint32_t latencyUs;
+    uint32_t spikeUs;
+    uint32_t spikeInterval;
+    uint32_t count;
+} sitlLatency_t;
+
+void sitlLatencyInit(sitlLatency_t *latency, const char *envName);
+uint32_t sitlLatencyNext(sitlLatency_t *latency);
+# 169 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 170 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 32 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 171 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 172 "./src/main/platform.h" 2
+# 40 "./src/main/io/flashfs.c" 2
+
+# 1 "./src/main/common/crc.h" 1
+# 21 "./src/main/common/crc.h"
+       
+
+struct sbuf_s;
+
+uint16_t crc16_ccitt(uint16_t crc, unsigned char a);
+uint16_t crc16_ccitt_update(uint16_t crc, const void *data, uint32_t length);
+struct sbuf_s;
+void crc16_ccitt_sbuf_append(struct sbuf_s *dst, uint8_t *start);
+
+uint8_t crc8_dvb_s2(uint8_t crc, unsigned char a);
+uint8_t crc8_dvb_s2_update(uint8_t crc, const void *data, uint32_t length);
+void crc8_dvb_s2_sbuf_append(struct sbuf_s *dst, uint8_t *start);
+uint8_t crc8_xor_update(uint8_t crc, const void *data, uint32_t length);
+void crc8_xor_sbuf_append(struct sbuf_s *dst, uint8_t *start);
+# 42 "./src/main/io/flashfs.c" 2
+# 1 "./src/main/common/maths.h" 1
+# 21 "./src/main/common/maths.h"
+       
+# 63 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+int gcd(int num, int denom);
+float powerf(float base, int exp);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadband(float value, float deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+float scaleRangef(float x, float srcFrom, float srcTo, float destFrom, float destTo);
+
+void normalizeV(struct fp_vector *src, struct fp_vector *dest);
+
+void rotateV(struct fp_vector *v, fp_angles_t *delta);
+void buildRotationMatrix(fp_angles_t *delta, float matrix[3][3]);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+
+float exp_approx(float val);
+float log_approx(float val);
+float pow_approx(float a, float b);
+# 145 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 43 "./src/main/io/flashfs.c" 2
+# 1 "./src/main/common/printf.h" 1
+# 105 "./src/main/common/printf.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 108 "./src/main/common/printf.h" 2
+
+
+# 109 "./src/main/common/printf.h"
+typedef void (*putcf) (void *, char);
+extern putcf stdout_putf;
+extern void *stdout_putp;
+
+void init_printf(void *putp, void (*putf) (void *, char));
+
+int tfp_sprintf(char *s, const char *fmt, ...);
+int tfp_format(void *putp, void (*putf) (void *, char), const char *fmt, va_list va);
+# 44 "./src/main/io/flashfs.c" 2
+# 1 "./src/main/common/time.h" 1
+# 21 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/pg/pg.h" 1
+# 21 "./src/main/pg/pg.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 21 "./src/main/build/build_config.h"
+       
+# 27 "./src/main/pg/pg.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+# 73 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 190 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+
+# 192 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 192 "./src/main/pg/pg.h"
+    pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 196 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 196 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 29 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 83 "./src/main/common/time.h" 3 4
+_Bool 
+# 83 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 84 "./src/main/common/time.h" 3 4
+_Bool 
+# 84 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 91 "./src/main/common/time.h" 3 4
+_Bool 
+# 91 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 95 "./src/main/common/time.h" 3 4
+_Bool 
+# 95 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 96 "./src/main/common/time.h" 3 4
+_Bool 
+# 96 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 98 "./src/main/common/time.h" 3 4
+_Bool 
+# 98 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 99 "./src/main/common/time.h" 3 4
+_Bool 
+# 99 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+
+void rtcPersistWrite(int16_t offsetMinutes);
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcPersistRead(rtcTime_t *t);
+# 45 "./src/main/io/flashfs.c" 2
+
+# 1 "./src/main/drivers/flash.h" 1
+# 21 "./src/main/drivers/flash.h"
+       
+
+
+
+# 1 "./src/main/pg/flash.h" 1
+# 21 "./src/main/pg/flash.h"
+       
+
+
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 21 "./src/main/drivers/io_types.h"
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 48 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 26 "./src/main/pg/flash.h" 2
+
+
+
+typedef struct flashConfig_s {
+    ioTag_t csTag;
+    uint8_t spiDevice;
+    uint8_t quadSpiDevice;
+} flashConfig_t;
+
+extern flashConfig_t flashConfig_System; extern flashConfig_t flashConfig_Copy; static inline const flashConfig_t* flashConfig(void) { return &flashConfig_System; } static inline flashConfig_t* flashConfigMutable(void) { return &flashConfig_System; } struct _dummy;
+# 26 "./src/main/drivers/flash.h" 2
+# 1 "./src/main/drivers/io.h" 1
+# 21 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 21 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_GYRO_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_GYRO_EXTI,
+    OWNER_BARO_EXTI,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_TRANSPONDER,
+    OWNER_VTX_POWER,
+    OWNER_VTX_CS,
+    OWNER_VTX_DATA,
+    OWNER_VTX_CLK,
+    OWNER_COMPASS_CS,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_USB_MSC_PIN,
+    OWNER_MCO,
+    OWNER_RX_SPI_BIND,
+    OWNER_RX_SPI_LED,
+    OWNER_PREINIT,
+    OWNER_RX_SPI_EXTI,
+    OWNER_RX_SPI_CC2500_TX_EN,
+    OWNER_RX_SPI_CC2500_LNA_EN,
+    OWNER_RX_SPI_CC2500_ANT_SEL,
+    OWNER_QUADSPI_CLK,
+    OWNER_QUADSPI_BK1IO0,
+    OWNER_QUADSPI_BK1IO1,
+    OWNER_QUADSPI_BK1IO2,
+    OWNER_QUADSPI_BK1IO3,
+    OWNER_QUADSPI_BK1CS,
+    OWNER_QUADSPI_BK2IO0,
+    OWNER_QUADSPI_BK2IO1,
+    OWNER_QUADSPI_BK2IO2,
+    OWNER_QUADSPI_BK2IO3,
+    OWNER_QUADSPI_BK2CS,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 29 "./src/main/drivers/io.h" 2
+# 128 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 21 "./src/main/drivers/io_def.h"
+       
+# 54 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 21 "./src/main/drivers/io_def_generated.h"
+       
+# 55 "./src/main/drivers/io_def.h" 2
+# 129 "./src/main/drivers/io.h" 2
+
+
+# 130 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 130 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 131 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 131 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+
+# 139 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 139 "./src/main/drivers/io.h"
+    IOIsFreeOrPreinit(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 27 "./src/main/drivers/flash.h" 2
+
+
+
+
+
+
+
+typedef enum {
+    FLASH_TYPE_NOR = 0,
+    FLASH_TYPE_NAND
+} flashType_e;
+
+typedef uint16_t flashSector_t;
+
+typedef struct flashGeometry_s {
+    flashSector_t sectors;
+    uint16_t pageSize;
+    uint32_t sectorSize;
+    uint32_t totalSize;
+    uint16_t pagesPerSector;
+    flashType_e flashType;
+} flashGeometry_t;
+
+void flashPreInit(const flashConfig_t *flashConfig);
+
+# 51 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 51 "./src/main/drivers/flash.h"
+    flashInit(const flashConfig_t *flashConfig);
+
+
+# 53 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 53 "./src/main/drivers/flash.h"
+    flashIsReady(void);
+
+# 54 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 54 "./src/main/drivers/flash.h"
+    flashWaitForReady(uint32_t timeoutMillis);
+void flashEraseSector(uint32_t address);
+void flashEraseCompletely(void);
+void flashPageProgramBegin(uint32_t address);
+void flashPageProgramContinue(const uint8_t *data, int length);
+void flashPageProgramFinish(void);
+void flashPageProgram(uint32_t address, const uint8_t *data, int length);
+int flashReadBytes(uint32_t address, uint8_t *buffer, int length);
+void flashFlush(void);
+const flashGeometry_t *flashGetGeometry(void);
+
+
+
+
+
+typedef struct flashPartition_s {
+    uint8_t type;
+    flashSector_t startSector;
+    flashSector_t endSector;
+} flashPartition_t;
+# 83 "./src/main/drivers/flash.h"
+typedef enum {
+    FLASH_PARTITION_TYPE_UNKNOWN = 0,
+    FLASH_PARTITION_TYPE_PARTITION_TABLE,
+    FLASH_PARTITION_TYPE_FLASHFS,
+    FLASH_PARTITION_TYPE_BADBLOCK_MANAGEMENT,
+    FLASH_PARTITION_TYPE_FIRMWARE,
+    FLASH_PARTITION_TYPE_CONFIG,
+    FLASH_PARTITION_TYPE_FLASHFS_LOG_INDEX,
+    FLASH_MAX_PARTITIONS
+} flashPartitionType_e;
+
+typedef struct flashPartitionTable_s {
+    flashPartition_t partitions[FLASH_MAX_PARTITIONS];
+} flashPartitionTable_t;
+
+void flashPartitionSet(uint8_t index, uint32_t startSector, uint32_t endSector);
+flashPartition_t *flashPartitionFindByType(flashPartitionType_e type);
+const flashPartition_t *flashPartitionFindByIndex(uint8_t index);
+const char *flashPartitionGetTypeName(flashPartitionType_e type);
+# 47 "./src/main/io/flashfs.c" 2
+
+# 1 "./src/main/io/flashfs.h" 1
+# 21 "./src/main/io/flashfs.h"
+       
+# 43 "./src/main/io/flashfs.h"
+void flashfsEraseCompletely(void);
+void flashfsEraseAsync(void);
+void flashfsPoll(void);
+void flashfsEraseRange(uint32_t start, uint32_t end);
+
+uint32_t flashfsGetSize(void);
+uint32_t flashfsGetOffset(void);
+uint32_t flashfsGetWriteBufferFreeSpace(void);
+uint32_t flashfsGetWriteBufferSize(void);
+int flashfsIdentifyStartOfFreeSpace(void);
+struct flashGeometry_s;
+const struct flashGeometry_s* flashfsGetGeometry(void);
+
+void flashfsSeekAbs(uint32_t offset);
+void flashfsSeekRel(int32_t offset);
+
+void flashfsWriteByte(uint8_t byte);
+void flashfsWrite(const uint8_t *data, unsigned int len, 
+# 60 "./src/main/io/flashfs.h" 3 4
+                                                        _Bool 
+# 60 "./src/main/io/flashfs.h"
+                                                             sync);
+
+int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
+
+
+# 64 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 64 "./src/main/io/flashfs.h"
+    flashfsFlushAsync(
+# 64 "./src/main/io/flashfs.h" 3 4
+                      _Bool 
+# 64 "./src/main/io/flashfs.h"
+                           force);
+void flashfsFlushSync(void);
+
+void flashfsClose(void);
+void flashfsInit(void);
+
+# 69 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 69 "./src/main/io/flashfs.h"
+    flashfsIsSupported(void);
+
+
+# 71 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 71 "./src/main/io/flashfs.h"
+    flashfsIsReady(void);
+
+# 72 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 72 "./src/main/io/flashfs.h"
+    flashfsIsEOF(void);
+
+
+# 74 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 74 "./src/main/io/flashfs.h"
+    flashfsVerifyEntireFlash(void);
+# 49 "./src/main/io/flashfs.c" 2
+
+static const flashPartition_t *flashPartition = 
+# 50 "./src/main/io/flashfs.c" 3 4
+                                               ((void *)0)
+# 50 "./src/main/io/flashfs.c"
+                                                   ;
+static const flashGeometry_t *flashGeometry = 
+# 51 "./src/main/io/flashfs.c" 3 4
+                                             ((void *)0)
+# 51 "./src/main/io/flashfs.c"
+                                                 ;
+static uint32_t flashfsSize = 0;
+
+_Static_assert((1024 <= 
+# 54 "./src/main/io/flashfs.c" 3 4
+(65535)
+# 54 "./src/main/io/flashfs.c"
+), "FLASHFS_WRITE_BUFFER_SIZE_too_large");
+
+static uint8_t flashWriteBuffer[1024];
+# 65 "./src/main/io/flashfs.c"
+static uint16_t bufferHead = 0, bufferTail = 0;
+
+
+static uint32_t tailAddress = 0;
+
+
+
+
+
+
+static 
+# 75 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 75 "./src/main/io/flashfs.c"
+           erasing = 
+# 75 "./src/main/io/flashfs.c" 3 4
+                     0
+# 75 "./src/main/io/flashfs.c"
+                          ;
+static flashSector_t eraseSector = 0;
+static flashSector_t eraseEndSector = 0;
+# 123 "./src/main/io/flashfs.c"
+static void flashfsClearBuffer(void)
+{
+    bufferTail = bufferHead = 0;
+}
+
+static 
+# 128 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 128 "./src/main/io/flashfs.c"
+           flashfsBufferIsEmpty(void)
+{
+    return bufferTail == bufferHead;
+}
+
+static void flashfsSetTailAddress(uint32_t address)
+{
+    tailAddress = address;
+}
+
+static void flashfsEraseStart(flashSector_t startSector, flashSector_t endSector)
+{
+    eraseSector = startSector;
+    eraseEndSector = endSector;
+    erasing = 
+# 142 "./src/main/io/flashfs.c" 3 4
+             1
+# 142 "./src/main/io/flashfs.c"
+                 ;
+}
+
+
+
+
+
+
+static void flashfsEraseProcess(
+# 150 "./src/main/io/flashfs.c" 3 4
+                               _Bool 
+# 150 "./src/main/io/flashfs.c"
+                                    sync)
+{
+    if (!erasing || (!sync && !flashIsReady())) {
+        return;
+    }
+
+    if (eraseSector < eraseEndSector) {
+        flashEraseSector(eraseSector * flashGeometry->sectorSize);
+        eraseSector++;
+    } else {
+
+        erasing = 
+# 161 "./src/main/io/flashfs.c" 3 4
+                 0
+# 161 "./src/main/io/flashfs.c"
+                      ;
+
+
+
+    }
+}
+
+
+
+
+
+void flashfsPoll(void)
+{
+    flashfsEraseProcess(
+# 174 "./src/main/io/flashfs.c" 3 4
+                       0
+# 174 "./src/main/io/flashfs.c"
+                            );
+}
+
+
+
+
+static 
+# 180 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 180 "./src/main/io/flashfs.c"
+           flashfsIsErasedForWrite(uint32_t address)
+{
+    const flashSector_t sector = address / flashGeometry->sectorSize;
+
+    return !erasing || sector < eraseSector || sector >= eraseEndSector;
+}
+
+
+
+
+static flashSector_t flashfsEraseEndSector(void)
+{
+    flashSector_t endSector = flashPartition->endSector + 1;
+# 202 "./src/main/io/flashfs.c"
+    return endSector;
+}
+
+void flashfsEraseCompletely(void)
+{
+    const flashSector_t endSector = flashfsEraseEndSector();
+
+    erasing = 
+# 209 "./src/main/io/flashfs.c" 3 4
+             0
+# 209 "./src/main/io/flashfs.c"
+                  ;
+
+    for (flashSector_t sectorIndex = flashPartition->startSector; sectorIndex < endSector; sectorIndex++) {
+        uint32_t sectorAddress = sectorIndex * flashGeometry->sectorSize;
+        flashEraseSector(sectorAddress);
+    }
+
+    flashfsClearBuffer();
+
+    flashfsSetTailAddress(0);
+
+
+
+
+}
+
+
+
+
+
+
+
+void flashfsEraseAsync(void)
+{
+    const flashSector_t endSector = flashfsEraseEndSector();
+
+    flashfsClearBuffer();
+
+    flashfsSetTailAddress(0);
+
+    flashfsEraseStart(flashPartition->startSector, endSector);
+
+
+
+
+}
+
+
+
+
+
+void flashfsEraseRange(uint32_t start, uint32_t end)
+{
+    if (flashGeometry->sectorSize <= 0)
+        return;
+
+
+    int startSector = start / flashGeometry->sectorSize;
+
+
+    int endSector = end / flashGeometry->sectorSize;
+    int endRemainder = end % flashGeometry->sectorSize;
+
+    if (endRemainder > 0) {
+        endSector++;
+    }
+
+    for (int sectorIndex = startSector; sectorIndex < endSector; sectorIndex++) {
+        uint32_t sectorAddress = sectorIndex * flashGeometry->sectorSize;
+        flashEraseSector(sectorAddress);
+    }
+}
+
+
+
+
+
+
+
+# 277 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 277 "./src/main/io/flashfs.c"
+    flashfsIsReady(void)
+{
+
+    if (!flashfsIsSupported()) {
+        return 
+# 281 "./src/main/io/flashfs.c" 3 4
+              0
+# 281 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    flashfsEraseProcess(
+# 284 "./src/main/io/flashfs.c" 3 4
+                       0
+# 284 "./src/main/io/flashfs.c"
+                            );
+
+    return !erasing && flashIsReady();
+}
+
+
+# 289 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 289 "./src/main/io/flashfs.c"
+    flashfsIsSupported(void)
+{
+    return flashfsSize > 0;
+}
+
+uint32_t flashfsGetSize(void)
+{
+    return flashfsSize;
+}
+
+static uint32_t flashfsTransmitBufferUsed(void)
+{
+    if (bufferHead >= bufferTail)
+        return bufferHead - bufferTail;
+
+    return 1024 - bufferTail + bufferHead;
+}
+
+
+
+
+uint32_t flashfsGetWriteBufferSize(void)
+{
+    return (1024 - 1);
+}
+
+
+
+
+uint32_t flashfsGetWriteBufferFreeSpace(void)
+{
+    return flashfsGetWriteBufferSize() - flashfsTransmitBufferUsed();
+}
+# 344 "./src/main/io/flashfs.c"
+static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSizes, int bufferCount, 
+# 344 "./src/main/io/flashfs.c" 3 4
+                                                                                                    _Bool 
+# 344 "./src/main/io/flashfs.c"
+                                                                                                         sync, 
+# 344 "./src/main/io/flashfs.c" 3 4
+                                                                                                               _Bool 
+# 344 "./src/main/io/flashfs.c"
+                                                                                                                    fullPagesOnly)
+{
+    uint32_t bytesTotal = 0;
+
+    int i;
+
+    for (i = 0; i < bufferCount; i++) {
+        bytesTotal += bufferSizes[i];
+    }
+
+    if (!sync && !flashIsReady()) {
+        return 0;
+    }
+
+    uint32_t bytesTotalRemaining = bytesTotal;
+
+    uint16_t pageSize = flashGeometry->pageSize;
+
+
+    if (pageSize > (1024 - 1)) {
+        fullPagesOnly = 
+# 364 "./src/main/io/flashfs.c" 3 4
+                       0
+# 364 "./src/main/io/flashfs.c"
+                            ;
+    }
+
+    while (bytesTotalRemaining > 0) {
+        uint32_t bytesTotalThisIteration;
+        uint32_t bytesRemainThisIteration;
+
+
+
+
+
+        if (tailAddress % pageSize + bytesTotalRemaining >= pageSize) {
+            bytesTotalThisIteration = pageSize - tailAddress % pageSize;
+        } else if (fullPagesOnly) {
+            break;
+        } else {
+            bytesTotalThisIteration = bytesTotalRemaining;
+        }
+
+
+        if (flashfsIsEOF()) {
+
+            flashfsClearBuffer();
+
+            break;
+        }
+
+
+        if (!flashfsIsErasedForWrite(tailAddress)) {
+            if (!sync) {
+                break;
+            }
+
+            flashfsEraseProcess(
+# 397 "./src/main/io/flashfs.c" 3 4
+                               1
+# 397 "./src/main/io/flashfs.c"
+                                   );
+
+            continue;
+        }
+
+        flashPageProgramBegin(tailAddress);
+
+        bytesRemainThisIteration = bytesTotalThisIteration;
+
+        for (i = 0; i < bufferCount; i++) {
+            if (bufferSizes[i] > 0) {
+
+                if (bufferSizes[i] >= bytesRemainThisIteration) {
+                    flashPageProgramContinue(buffers[i], bytesRemainThisIteration);
+
+                    buffers[i] += bytesRemainThisIteration;
+                    bufferSizes[i] -= bytesRemainThisIteration;
+
+                    bytesRemainThisIteration = 0;
+                    break;
+                } else {
+
+                    flashPageProgramContinue(buffers[i], bufferSizes[i]);
+
+                    bytesRemainThisIteration -= bufferSizes[i];
+
+                    buffers[i] += bufferSizes[i];
+                    bufferSizes[i] = 0;
+                }
+            }
+        }
+
+        flashPageProgramFinish();
+
+        bytesTotalRemaining -= bytesTotalThisIteration;
+
+
+        flashfsSetTailAddress(tailAddress + bytesTotalThisIteration);
+
+
+
+
+
+        if (!sync)
+            break;
+    }
+
+    return bytesTotal - bytesTotalRemaining;
+}
+
+
+
+
+
+
+
+static void flashfsGetDirtyDataBuffers(uint8_t const *buffers[], uint32_t bufferSizes[])
+{
+    buffers[0] = flashWriteBuffer + bufferTail;
+    buffers[1] = flashWriteBuffer + 0;
+
+    if (bufferHead >= bufferTail) {
+        bufferSizes[0] = bufferHead - bufferTail;
+        bufferSizes[1] = 0;
+    } else {
+        bufferSizes[0] = 1024 - bufferTail;
+        bufferSizes[1] = bufferHead;
+    }
+}
+
+
+
+
+uint32_t flashfsGetOffset(void)
+{
+    uint8_t const * buffers[2];
+    uint32_t bufferSizes[2];
+
+
+
+    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+
+    return tailAddress + bufferSizes[0] + bufferSizes[1];
+}
+
+
+
+
+static void flashfsAdvanceTailInBuffer(uint32_t delta)
+{
+    bufferTail += delta;
+
+
+    if (bufferTail >= 1024) {
+        bufferTail -= 1024;
+    }
+
+    if (flashfsBufferIsEmpty()) {
+        flashfsClearBuffer();
+    }
+}
+
+
+
+
+
+static 
+# 503 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 503 "./src/main/io/flashfs.c"
+           flashfsShouldFlush(uint32_t bytesBuffered)
+{
+    const uint32_t pageSize = flashGeometry->pageSize;
+
+    if (pageSize > (1024 - 1)) {
+        return bytesBuffered >= (1024 / 2);
+    }
+
+    return tailAddress % pageSize + bytesBuffered >= pageSize;
+}
+# 521 "./src/main/io/flashfs.c"
+
+# 521 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 521 "./src/main/io/flashfs.c"
+    flashfsFlushAsync(
+# 521 "./src/main/io/flashfs.c" 3 4
+                      _Bool 
+# 521 "./src/main/io/flashfs.c"
+                           force)
+{
+    if (!flashfsBufferIsEmpty()) {
+        uint8_t const * buffers[2];
+        uint32_t bufferSizes[2];
+        uint32_t bytesWritten;
+
+        flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+        bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 2, 
+# 529 "./src/main/io/flashfs.c" 3 4
+                                                                   0
+# 529 "./src/main/io/flashfs.c"
+                                                                        , !force);
+        flashfsAdvanceTailInBuffer(bytesWritten);
+    }
+
+
+    flashfsEraseProcess(
+# 534 "./src/main/io/flashfs.c" 3 4
+                       0
+# 534 "./src/main/io/flashfs.c"
+                            );
+
+    return flashfsBufferIsEmpty();
+}
+
+
+
+
+
+
+
+void flashfsFlushSync(void)
+{
+    if (flashfsBufferIsEmpty()) {
+        return;
+    }
+
+    uint8_t const * buffers[2];
+    uint32_t bufferSizes[2];
+
+    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+    flashfsWriteBuffers(buffers, bufferSizes, 2, 
+# 555 "./src/main/io/flashfs.c" 3 4
+                                                1
+# 555 "./src/main/io/flashfs.c"
+                                                    , 
+# 555 "./src/main/io/flashfs.c" 3 4
+                                                      0
+# 555 "./src/main/io/flashfs.c"
+                                                           );
+
+
+    flashfsClearBuffer();
+}
+
+void flashfsSeekAbs(uint32_t offset)
+{
+    flashfsFlushSync();
+
+    flashfsSetTailAddress(offset);
+
+
+
+
+}
+
+void flashfsSeekRel(int32_t offset)
+{
+    flashfsFlushSync();
+
+    flashfsSetTailAddress(tailAddress + offset);
+}
+
+
+
+
+void flashfsWriteByte(uint8_t byte)
+{
+    flashWriteBuffer[bufferHead++] = byte;
+
+    if (bufferHead >= 1024) {
+        bufferHead = 0;
+    }
+
+    if (flashfsShouldFlush(flashfsTransmitBufferUsed())) {
+        flashfsFlushAsync(
+# 591 "./src/main/io/flashfs.c" 3 4
+                         0
+# 591 "./src/main/io/flashfs.c"
+                              );
+    }
+}
+
+
+
+
+
+
+
+void flashfsWrite(const uint8_t *data, unsigned int len, 
+# 601 "./src/main/io/flashfs.c" 3 4
+                                                        _Bool 
+# 601 "./src/main/io/flashfs.c"
+                                                             sync)
+{
+    uint8_t const * buffers[3];
+    uint32_t bufferSizes[3];
+
+
+    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+
+
+    buffers[2] = data;
+    bufferSizes[2] = len;
+
+
+
+
+    if (flashfsShouldFlush(bufferSizes[0] + bufferSizes[1] + bufferSizes[2])) {
+        uint32_t bytesWritten;
+
+
+        bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 3, 
+# 620 "./src/main/io/flashfs.c" 3 4
+                                                                   0
+# 620 "./src/main/io/flashfs.c"
+                                                                        , 
+# 620 "./src/main/io/flashfs.c" 3 4
+                                                                          1
+# 620 "./src/main/io/flashfs.c"
+                                                                              );
+
+        if (bufferSizes[0] == 0 && bufferSizes[1] == 0) {
+
+            flashfsClearBuffer();
+
+            if (bufferSizes[2] == 0) {
+
+                return;
+            }
+        } else {
+
+            flashfsAdvanceTailInBuffer(bytesWritten);
+        }
+
+
+        if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] > (1024 - 1)) {
+            if (sync) {
+
+                flashfsWriteBuffers(buffers, bufferSizes, 3, 
+# 639 "./src/main/io/flashfs.c" 3 4
+                                                            1
+# 639 "./src/main/io/flashfs.c"
+                                                                , 
+# 639 "./src/main/io/flashfs.c" 3 4
+                                                                  0
+# 639 "./src/main/io/flashfs.c"
+                                                                       );
+                flashfsClearBuffer();
+            } else {
+
+
+
+
+            }
+
+            return;
+        }
+
+
+        data = buffers[2];
+        len = bufferSizes[2];
+    }
+
+
+
+
+    unsigned int bufferBytesBeforeWrap = 1024 - bufferHead;
+
+    unsigned int firstPortion = len < bufferBytesBeforeWrap ? len : bufferBytesBeforeWrap;
+
+    memcpy(flashWriteBuffer + bufferHead, data, firstPortion);
+
+    bufferHead += firstPortion;
+
+    data += firstPortion;
+    len -= firstPortion;
+
+
+    if (bufferHead == 1024) {
+        memcpy(flashWriteBuffer + 0, data, len);
+
+        bufferHead = len;
+    }
+}
+
+
+
+
+
+
+int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
+{
+    int bytesRead = 0;
+
+    if (address >= flashfsSize) {
+        return 0;
+    }
+
+
+    if (address + len > flashfsSize) {
+
+        len = flashfsSize - address;
+    }
+
+
+    flashfsFlushSync();
+
+
+    while (len > 0) {
+        const int bytesReadThisIteration = flashReadBytes(address + bytesRead, buffer + bytesRead, len);
+        if (bytesReadThisIteration <= 0) {
+            break;
+        }
+
+        bytesRead += bytesReadThisIteration;
+        len -= bytesReadThisIteration;
+    }
+
+    return bytesRead;
+}
+
+enum {
+
+
+
+    FREE_BLOCK_SIZE = 2048,
+
+
+    FREE_BLOCK_TEST_SIZE_INTS = 4,
+    FREE_BLOCK_TEST_SIZE_BYTES = FREE_BLOCK_TEST_SIZE_INTS * sizeof(uint32_t)
+};
+
+_Static_assert((FREE_BLOCK_SIZE >= 2048), "FREE_BLOCK_SIZE_too_small");
+
+typedef union {
+    uint8_t bytes[FREE_BLOCK_TEST_SIZE_BYTES];
+    uint32_t ints[FREE_BLOCK_TEST_SIZE_INTS];
+} freeBlockTestBuffer_t;
+
+static 
+# 732 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 732 "./src/main/io/flashfs.c"
+           flashfsIsErasedTestBuffer(const freeBlockTestBuffer_t *testBuffer)
+{
+
+    for (int i = 0; i < FREE_BLOCK_TEST_SIZE_INTS; i++) {
+        if (testBuffer->ints[i] != 0xFFFFFFFF) {
+            return 
+# 737 "./src/main/io/flashfs.c" 3 4
+                  0
+# 737 "./src/main/io/flashfs.c"
+                       ;
+        }
+    }
+
+    return 
+# 741 "./src/main/io/flashfs.c" 3 4
+          1
+# 741 "./src/main/io/flashfs.c"
+              ;
+}
+
+
+
+
+
+static uint32_t flashfsFindStartOfFreeSpace(uint32_t searchStart)
+{
+# 759 "./src/main/io/flashfs.c"
+    freeBlockTestBuffer_t testBuffer;
+
+    int left = (searchStart + FREE_BLOCK_SIZE - 1) / FREE_BLOCK_SIZE;
+    int right = flashfsSize / FREE_BLOCK_SIZE;
+    int mid;
+    int result = right;
+
+    while (left < right) {
+        mid = (left + right) / 2;
+
+        if (flashReadBytes(mid * FREE_BLOCK_SIZE, testBuffer.bytes, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
+
+            break;
+        }
+
+        if (flashfsIsErasedTestBuffer(&testBuffer)) {
+
+
+
+            result = mid;
+
+            right = mid;
+        } else {
+            left = mid + 1;
+        }
+    }
+
+    return result * FREE_BLOCK_SIZE;
+}
+# 805 "./src/main/io/flashfs.c"
+int flashfsIdentifyStartOfFreeSpace(void)
+{
+# 821 "./src/main/io/flashfs.c"
+    return flashfsFindStartOfFreeSpace(0);
+
+}
+
+
+
+
+
+# 828 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 828 "./src/main/io/flashfs.c"
+    flashfsIsEOF(void)
+{
+    return tailAddress >= flashfsSize;
+}
+# 1087 "./src/main/io/flashfs.c"
+void flashfsClose(void)
+{
+
+
+
+
+
+    switch(flashGeometry->flashType) {
+    case FLASH_TYPE_NOR:
+        break;
+
+    case FLASH_TYPE_NAND:
+        flashFlush();
+
+
+        uint32_t pageSize = flashGeometry->pageSize;
+        flashfsSetTailAddress((tailAddress + pageSize - 1) & ~(pageSize - 1));
+
+        break;
+    }
+
+
+
+
+
+}
+
+
+
+
+void flashfsInit(void)
+{
+    flashfsSize = 0;
+    erasing = 
+# 1120 "./src/main/io/flashfs.c" 3 4
+             0
+# 1120 "./src/main/io/flashfs.c"
+                  ;
+
+    flashPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS);
+    flashGeometry = flashGetGeometry();
+
+    if (!flashPartition) {
+        return;
+    }
+
+    flashfsSize = (flashPartition->endSector + 1 - flashPartition->startSector) * flashGeometry->sectorSize;
+# 1138 "./src/main/io/flashfs.c"
+    flashfsSeekAbs(flashfsIdentifyStartOfFreeSpace());
+
+}
@@ -0,0 +1,1457 @@
+	.file	"flashfs.c"
+	.section	.gnu.lto_.profile.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\247\002\375\016"
+	.string	"\024\023\233\003"
+	.string	"("
+	.string	"\246\275\226\351\017\006\002"
+	.string	"\002"
+	.string	"\002\001\001\352\263\360\321\b\002\277\241\360\225\004\004\002\002\003\004\005\316\216\216\334\n\n\006\203\225\372\350\017\016\003\002\003\002"
+	.string	"\002\002\005\002\005\007\b\t\n\013\257\323\207\277\f\250\200\362\237\b2\002\006\002\006\002\002\004\002\005\002\005\007\006"
+	.string	"\002"
+	.string	"\r\016\323\323\251\213\016\017\222\236\266\360\r\b\020\300\246\367\376\017"
+	.string	"\021\301\274\313\337\f\022\002\b\002\b\002\002\002\t\t"
+	.string	"\002"
+	.string	"\022\023\320\367\302\371\t\005\002\005\024\263\347\330\206\n\b\025\255\235\373\347\003\002\002"
+	.string	"\002"
+	.string	"\026\342\201\222\246\004\027\354\206\342\366\006\030\205\374\320\271\r"
+	.string	"\031\252\260\236\264\013\032\232\206\242\244\007\006\033\221\217\213\271\f\030\n\002\n\002\013\002\013\034\240\342\234\212\n\035\354\263\203\222\001"
+	.string	"\036\347\373\341\373\r\034\037\263\240\307\317\013 \311\377\315\330\013!\203\251\360\233\006\022\002\f\002\r\"\206\327\335\244\b@\007\002\016\002"
+	.string	"\002\017\016\002\016\002\017\002\017#\317\375\241\227\005$\211\271\337\250\002"
+	.string	"%\372\365\325\307\005&\325\300\332\n\004\020\002\004'\206\215\357\350\t\024"
+	.string	""
+	.ascii	"X\250\341\235\300\030s0Ma\222\341`\002BUW\007\021\340@\203\270"
+	.ascii	"\024W\322v\354\242\007NdgTh\025r\270\262\001P\372\236\255\304"
+	.ascii	"\237\364\2733\275\036\342\02773G\225\324\3734j=\335\035&\240"
+	.ascii	"\354E\225\326\311\005\201\364\271\t\005\356\235\221\277\227)"
+	.ascii	"\017\352!\3163R\031\005\221\312\304\352\231\275\224\306\360\335"
+	.ascii	"?\215x\371\022\0172\217\250'\351I\255\356\340\215\032\221\356"
+	.ascii	"O \245\273n?r\213\366\b&\177y\003\002X\332\004\033\022;\360\002"
+	.ascii	")D*\246\220D\306\240\037\204\254:\244&\030m|8\256\222W8\264\340"
+	.ascii	"S\351\311\004a"
+	.text
+	.section	.gnu.lto_.ipa_sra.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\305\004"
+	.string	"\302\205\022\034`\307\244\0030\f\3030\fS\206\340\350\350\350\332=\n"
+	.string	"@\221vc\020$\267L\001\377\377\301\320\013\204\"q\317r0YA"
+	.ascii	"p5k\306\252S}\352R\217:t\367\207\363\034\3360\213rr\031\362\207"
+	.ascii	"\301\311\370}o\023\021$ \240\002*\273\0160\204\214 \227\342\376"
+	.ascii	"\267\230{`45\227]Y\360J\0218\240\t\343\022\261\204N8\330\242"
+	.ascii	"\235\301*\t\007:h\217\261bq\225\236C\260\270s`\361\3423\322\254"
+	.ascii	"k\036\346\t\005\350\202A\3163@\303Z\031\002"
+	.text
+	.section	.gnu.lto_.inline.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\220\005\365\027"
+	.string	"\306\337sJ\320\320*\035\352\354\314\217e\016j\262\336\316\207\360\223\303,\206\304\211\337\332@B\002\314\007\r\236F\b#\312\321_\025[\302\243\"\271z\337g\367\253\2071R\017\243\324\313\013.\013d!\365j\313p\355\200n\320'#hK\271SW"
+	.string	"\\"
+	.string	"g"
+	.string	"\nD\023\263\274\177>\250HI'\177\242$\377\2075\007\235 \021*\376\204\241\220\317\274\350Q\377\307\230w\357Uq\254i\004\215HK\037\375\207\215\316\177\375O\264\377\3721\262\267\347\363\213\357\275W\374W\270\246GK\021\364\177\020\256\257\257+]\023C\323\3022\317\272\330\022\033<d\214\342'\f\226\377\030+\311\265\354\237\350O\224\177.\033\345-\006LTT\341\305[|\222\001\3062\272\232MY\023\177\025\236\201\321\315T\013\366\377\211+w\263\264}Ua\036\234^\215\007_\376\326\232\364\211\b9d\354\315\243\360O\030\314\321\304\377\325\366\277\211\253\211j\342\0065\250\237{o\307[\003\352_\022\213n\260\240P\"\353\364\266\263\205\254X\002\314\216\023v\365\214\2016\\\017\311J\304\024\013\351\200\363y1an;\033\371"
+	.string	"\334_\361\253\001\250\316:\022B\270\030\237\342\031\346\212Z)\r\274\241\371RG\241H?\315zg\227Bh\204\357\301\345\227s:\310\203\237Oc\232\345K\357\035\234\233?\311(\220n\2105k\r>/9\"?"
+	.string	"\033/\220\016\307x\003-\026(\233\347*\217c\b\027~B\030#)\256\314i\211\241ou\002\277\255'ZO\364\375\237d\027tL:\324\263\037o\302$x+j3\226ac\003\350\3002\363k\n\347\210b\364\274\205\253D\326=\f3z\t\370.\265\033\b\326I\002\200\210\250\001A\206LIMI\n\222\264\031p\"\22122\017\022\300$a\346\034\"H\031\241\2418\227\n;s\021\302\305\032T\215\235\266M\251\220\260G\005\350_%\326G0\265e\2777\333\245\366t\352)\373wh\035\230t8\210K\224n\344\b\254z\351gYS\357P\200\210\377?\353\357\213\346\316\263\217\032(\007\331+\314\273t\273"
+	.ascii	"\211\215\n\202\316d\314\225Q\220\304mTiwG\032Kn6\034\234S\020"
+	.ascii	"q\224\023\360\310\"\331\253\227\rs^\274\006\255\371-\r\216\022"
+	.ascii	"[;\346\250\303`[\221\303\356l\237\314\277\017\371\216\307\225"
+	.ascii	"\t)z\035\315\356\001$\267\256I\3002\270\204Q\001O7F0qCv\351\220"
+	.ascii	"\355\372\220\260\220\371$\332\304\177Dal\3437\216\201\005\237"
+	.ascii	"U\212A\231\016\307\371\326I\005\207\202^\177\351\r\250\213\272"
+	.ascii	"\253{f\256\2439\001\224\034\263\254\244z\346\244[\327\323\306"
+	.ascii	"\331L\363\2274\022?X.\207\322\016\n\262U\301\343\357\360\265"
+	.ascii	"|\312\211a\332\327h\362\345\236\256\331?U\217\257\304\371H\335"
+	.ascii	"\250\310fm\357\035"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`D\003\245\f"
+	.string	"\246Q63P\245&\3510AWU}UUy=\240\252\252\252\253A\267\305\231f\210\200\3472\006\257\343\216\266\262m\333f\266c\366\255\366\177\243\302\020XF~kR\246)"
+	.string	"%"
+	.string	"*"
+	.string	"\275H/r\021\"\360T\300u\261!\337\247\211\177\260\036;\214\354\260\362O\237\\W"
+	.string	"\020\245\320\224B|\326z\021\271fI\"K\n>\363\230\277|\365\004\277\245\365ZoB\266\362\2246m=\360\033\266\026#\030\361\370U\232\352Q=J\217\005\034"
+	.string	"+/zi\304\250\236\245W\365&HF\nc\022\256 \334\016\270!\007\327\030L\266\334 5X\356i\005F\231ANU2S\260vz\360\207\337\341\033\236\026\214a\213\326\226^\246\327\026\270\331\372\360\312i%\t\252\332\b\202\036\t;\310\020\257\007Q\250AE\306\320\310L\222\244\264\305\220\002\221\252\262\016\022"
+	.ascii	"BR\210\243Qf\0202sd\271\305\365,\007\204\002\300\027\347W\b'"
+	.ascii	"\241\245H`\215\207\207\253\255\264\360\306\362\274\340\016)\212"
+	.ascii	"+\300}\221\224h'g\206\332\304A7\311\374\323\312J\003\220\033"
+	.ascii	"\256\024\342B\0021'U2+\013?C2{@2\210`0\270m\221\026f\367>\356"
+	.ascii	"g&HI\2759w\257CX\334f9\235)\346<6g\356\325\354|\354\337s\327"
+	.ascii	"\365\273\026\267\334/B\362\234T\022m\312\323\335\246\023Qx\311"
+	.ascii	"w\243\026Z\311g\327\nQ`?\002Y\211G\324\2420\227\271v\311\264"
+	.ascii	"\211%\343N"
+	.text
+	.section	.gnu.lto_.pureconst.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375 _\265\002"
+	.string	"\362\205\024 pk\322\001\374\377!\362?\326UUC\240\252\352\210\364\377\377\347\365\377\377l\255m\3676\233\333\001Wr#\037d>^\216\333\270\214\271\230\212\251fb\"\276\303g\230R\370\b\337`\nn\340\002\3564\245\033M\350\3123\235\333Lf./Sf6\t"
+	.text
+	.section	.gnu.lto_.ipa_modref.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\215\002}\t"
+	.ascii	"\022\312\037)\220\265\031\016\377\377\177Y\377|wwq\365l\244{"
+	.ascii	"\347\251\271 D\243&\"\264\366_\333\354\277\333\3744m\243F\366"
+	.ascii	"\2262\005c\0276@p1\277k\002\326\001?\300\223n\021\301\340VQ\223"
+	.ascii	"\024=F\n\371\007\364\216\033\177/\303\335E\253\312\251\316\246"
+	.ascii	"\274\251sV\260%Ft\016\315\251]~&!\313\224\303\363\200\206\247"
+	.ascii	"\374\241T\036u\272r\327\371\312_\333\242H\312o\351\224\277\013"
+	.ascii	"\337\n\002W\250\261I;\242\302\326f`\002\"5g\036\021@\225\"\322"
+	.ascii	"\231\023Z\350z\354\031\327\211\346<\226'\352\013\247\31426\322"
+	.ascii	"9hn.2\346\352_\252Z\354\343\n\021\364}\334S\2445L\007\222\332"
+	.ascii	"\335M\273\235\t\002ID\263(\024e\0055\023\n\021^\350\320\334\234"
+	.ascii	"\253\205\0239{{\344&\262)xD)\305\264\034KU[\3413<\326J\342\024"
+	.ascii	"x~\274Vz\207\016\222\n\253u\201\340\004\025\203\336O\323\357"
+	.ascii	"\350\230AN\254\327\325\311\363\245\n\024\021\360\330h\"\327k"
+	.ascii	"X\361`F\301\323\352\266I\343\234\327U\017\bz8p~\274B\005"
+	.text
+	.section	.gnu.lto_.lto.e1fbeeda2a3a294e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashfsEraseProcess.27.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\255\f"
+	.string	"\206\227UB \257$\035@\277\253\213vy\300\250\227\340\361\223\006.\026L"
+	.string	"\376\306\343\003\304\036\031\316f\020V\224f\033r\245\302`\n\346\255\330jM\032\"@\204L\241\003Z\006"
+	.string	""
+	.string	"\272\331d-\020B\310\2262\245E"
+	.string	"A"
+	.string	"@"
+	.string	"\233\277\201\241W\026\312)=)\301\204\340"
+	.string	"Q>\2150`I\276\3079\021\303\342\202\243\227a\322\302a@\222\324\307\241P\212pA\321\313\240\251@\342.O\b\260$\263\342\330]'\007On\353\266El\013\260o >\351\267\236~O\177s`\246\006\005'\356\232\304\027;3u\310`\373\227\355L\233@\201\355$\220\306U\210 \311\354v\003\034\300\372\344\315.\361\356\302V*-\0176\324\354.\246+\337^Q\323\323\fz\230\"\322P\332\304\313\007\020\357/\267\364\030\2361+hR\324 \352\212"
+	.string	"f\004I\272\260\257\341\035\310g\261\310'\317}\362?\324\247\353]\016\2404A\302HF\273\013\245\252\330\327\030c\264Zp\235\220\217\366\334\331\320<\024h\035\013<\260\354\003\013\371\350"
+	.string	"\301:\036\r\333\320p\306 \201\007k\220e\036\354\352\366\034#*z\273\273\325&m\220,\317Y5d\226\225\031Q\367\020WZLO\237\242J[s\220\347^\031"
+	.string	"2\003\352\f\207_\330\252\202\200+\200j\nD\301p\001\3302u\023Q\230"
+	.ascii	"\002\004\271A5\203\205E\254\2206,(.\030\226\324\270\340\356\335"
+	.ascii	"4m!\022\0067\004\356\216#\2503"
+	.text
+	.section	.gnu.lto_flashfsPoll.28.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375 \327\375\005"
+	.string	"\302J)3`\207\324\001"
+	.string	"5"
+	.string	"f\245\206Z\270\201\262"
+	.string	"M\340PB\r\252\035\256~\020\3038\020Z\300~7\016\230r\b\002\001\2346\356d\264J\246"
+	.string	"~\"\267L\001\237\242\213\232\\\022\205\232\264\232\226J\252\314\311\272f\2648\275H\254\211\241\324\232\220\327\313\335\003\326\261j\2749K\307\376\031\215\334\355\n0\034+\207\263\337\313$\013\374\3734w?G\252\270\360P\350\006h`\350\360pP\360\177\241c\177\302z\004\275\037B\347\023\273{\362\300b+\261\357\032lb\343\262\225\bHw_n\\\300\236\367?\343\177\343\277\026\b"
+	.ascii	"3\003\226:#[\270\3175<-\204\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_flashfsEraseCompletely.31.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`m\003=\031"
+	.string	"\326m\241G\300\030UcP\345\272\027\360:>\202\312\210x\031\325g\227\025\342<)\\3\030N\3465)\033\222\036.\004\320&\217\020\250nDJ\240\272\177\004\213\025D\261\244\007f\302F9\316fgt\340F\323\321\333\356\275\245L)\206"
+	.string	"\210"
+	.string	"\220"
+	.string	"WF\007\036)\352\345\336t\301I'0O\002\370\200\362d\275\2002\275\017\027Gm\213~\\\330\367=\350\305Q\2239\341\211\336{M'\355\027\266\351\344h\362\314\336\362\024\350\376\227\203!\344\345\336\253\2626l\213\305\217\351=\326\331\311\321\326\231\337;\202^\321v\31399\222vzp\244n;\343\003\342\020\311\203\2571n\265:\352\360\271}\360\nxSl7\237W\322\204{\257\253\3556\343.o;f\373\202mu\0016\023\345I\222\275\220\327\"\034\215\323\367C\253E;\255U\253\263\377"
+	.string	"\2108\264\255a\037x\247J\325\250\323\211\356\230\222YM\372\320=\226\325\226T]\313\352\0070"
+	.ascii	"\346\304\3318\255Qz{\212`\256\220D\222\343\300\237\350\037\272"
+	.ascii	"\265o\237\210\177\244\310\215\314Ntc\346\3100\207\374v\303\b"
+	.ascii	"\346\311\003\343\005\224G\375\340\220\r\317I\003\363w\240/\304"
+	.ascii	"\246 3\234\243\306\200\003s\2428~\220\3778\020\234\013\2618@"
+	.ascii	"K\003\005j\214\2651d\250\267\371T\004\212P\307\346\330\332\333"
+	.ascii	"\030[\227\360\354\2605\334\312\206*-8\230\367\336\024\345I+<"
+	.ascii	"\225\024\036>|\260\022\260\374\214\366\366GN\242<#\030ah\265"
+	.ascii	"h\355\257\311\316\315Z\235A\\\212\003\240{o\311\362\310\355N"
+	.ascii	"_\210\322\177r(!D\260\352m\254\362\344{\257\271\\\215\023=\242"
+	.ascii	"\235E\211\262)[\213x\316Z-\372@\267\336\344e\336\253\343\300"
+	.ascii	"gbC\302\337\301\312\223([\nz\222+\201\371;\323\230\250\0172\331"
+	.ascii	"+\346r\311\240V\274\\5+\231)\006S\321zmp\325\274Jn1\220\215("
+	.ascii	"!c\235\030\241\202\321\250jhX(T\255\230L\305\200\200a6\257\230"
+	.ascii	"J\005\f\026S\231R\332{\257\320e\370eH\2635\3737\245\257\345["
+	.ascii	"nf=dd|\274\336\360AO\037\016\313\263\314PXU!\033\227\231\322"
+	.ascii	"7\372\225\031\013\253U\320\253\257\347\350D\217H\2533\004\242"
+	.ascii	"=Y\222\255\226\354hc\244\354hOa~D\321\251\304\217\367\336;Z\235"
+	.ascii	"\223\217\366d\037\274\205\2237\205\347\fI\250Q\034H9f\214R\221"
+	.ascii	"\004B#\243\2511\200\002\24113\017\0210\252\312Zh\317\367W\350"
+	.ascii	"5@\\g\b\333\206\367\266\023\335\321M\bV\275Y\274\335\233\323"
+	.ascii	")4pB\331yM\037\020\276\013Y6\227\340b\262a\255$m:<*A\364\314"
+	.ascii	"\355g\370A\035\246_\254}M\240\340\310i\355\0336LqE\225\317o\221"
+	.ascii	"\034T\007\315\2539#5\345\007\331\261\370\247\021\356\312\203"
+	.ascii	"\351\221\220\276\245\346\2645\221\334[\302o\320\3560\304\310"
+	.ascii	"\334\236\210\325\307G\260#\024\352\034\250\242\371\344\353\330"
+	.ascii	"\235\n"
+	.text
+	.section	.gnu.lto_flashfsEraseAsync.32.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\006\002E\021"
+	.string	"v\336mH\360\260(\035\350\305_\314\337u\215\310=*\221WY\261\257\235\r\205%J\341\313\274\367{\304\306\260\370\246v\277\025\243\236h\032\r\225\335\361~\377V\244\022\217P1Ia\260\004A\312+\366B\313\222\255\245\026\355M\366N)T"
+	.string	"U"
+	.string	"\\"
+	.string	"\"\240\017\030\356.\313\037M:\275x\032\353(Z\006^\343~\200@3\206A\273c\202S#\020\235\n8\201z*?\240\236v$\273\354\237\217%\36677\017\266\240\335\365\246\314]\227.\377\263\217b0\033.?\032\354\256e\f\006\304=o\373\200m\005\266\224\ts\276\346\222G6\002\024E\274\344\220=\302\344$a\277\333\335\365\214\261_\273i\225\356>\244g\225>\200"
+	.string	";=\fnv_\206xl\r\212;\361\332o\337_\361\034\026\035,*\216\323\362\320\363g\247\305v\033\227\207\246`\016\027\373)^\363kL\032]\254\207\016 \017P\244\225T_\306g\224H01\301\2714\021\"\004E\031\214\307\230 m\261\035\246\352\273\370\013\323\t%\037C\325\323\333\\\212/90\314\275\336\252\335\244S\362t"
+	.ascii	"ar\310\257\271\302q)\321.\207\005~\013\r\027\374\031\225z\332"
+	.ascii	"\315\021\355:\277\251\3703F\371\344c_=\r\252o\345\204\"\241\220"
+	.ascii	"\202\032\371\004\262:\261\2602a8\361\276\224\227\2222\241x'\325"
+	.ascii	"\312\003)\340/\003J\345\255|\237\312#\215\257w;cfw\320c\024\002"
+	.ascii	"zM\230\377\220\352\3378\216\020\221\221\021\334\215&G}Z\017J"
+	.ascii	"\264\246#4\375\236\333h\221\224J9@\240(s\204\323\020\355\356"
+	.ascii	"\347g\227,\0024 \260\002\231\301\252\003\243\320\022\022\360"
+	.ascii	"%\r\023p&\203\321\262\214\275n_\rc\221w\307\030p\262\231\240"
+	.ascii	"dd\255\021\025\203\234\260\004r-N6\223\210\335\\\222\270\340"
+	.ascii	"\203\200\030\316\025Z\317\250\233\203\b\"V9\325\262\266\265\033"
+	.ascii	"8\330 \227[\216\200\265\310\035\317!\2415\003;6v=;[\246\213\322"
+	.ascii	"V\242\360\234>m\002\314\271\205 \236"
+	.text
+	.section	.gnu.lto_flashfsEraseRange.33.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\274\003e\031"
+	.string	"6\256\242H\300VQ:Es\004K\f\240\304\b\242\363\235'T{\272\352E\250\355\016\177\213M\355{\362\347\354\316\320\346\320\234\305\204\217\274]\037\357t\374\272j6I\246=\007\201\352*v[\223\215\030\367n\216\326\377\t!\233\310\235R\217"
+	.string	"\203"
+	.string	"\221"
+	.string	"_\242s#\026N\325\252c\367\244V\\\003'\030O\r\\@x\n\376\025\236Z\307\376r\\\217\372\034\224\013&aj\255\260\345a\326\357\367\373\035\304\335\342\324\371(\206\024\334\251\343\357|\004\305\236\030A\236\005(\b\224"
+	.ascii	"\365\324;\357\363\347f\233\"\221\032\017\317\273\202]\223\317"
+	.ascii	"\255\306)\215\203`\201\036\020\201\323\016/\253[m.\250@\250\312"
+	.ascii	"\f\231\033\017(\300i\207\227\347~\240\bP\320\234b\205Z\253\247"
+	.ascii	"\317M\306\235\272m\037\266q\354\265\021\257\037\335\256\326q"
+	.ascii	"\377\314\225n\326\215~\231\357n\325\223\356\324N\217;-\316\351"
+	.ascii	"p\247\351N\203;\275;=\347\364\007\270\2248Q\270Rk\214\337\230"
+	.ascii	"\212\205\366\204|\351\337\375G\177\322\257d\277\211\317\344\325"
+	.ascii	"\022\013"
+	.string	"\336\016\307S\255\270\016\327\371<\257v\271\335\r\016\343\351\217t&\317y\245\364\002C\222}\006j3\265V\3643d\302\221}\343\016\320\250T\004\343\251\326\272\340\324\017\214\343\322`<\365\247}%\001=\267p\211\374\242[\024\370Z\362f\264\255M\355\217)\203\267\366\265\034t?\233\320\201\034C>p\301]K`(\t\222\025\272.\272(t[l=p[3\013n\251\273\262\313\3323\271\210\232+\263\273)t9\033\022\036\t=\240\236\366%\302\271\036\220\270\324&\224\355\331\241\224\030k\255E\360{+h#\020\025\341\351\334\224\321\235\374\211\n\037\210M\234\230\3679\021\236~\237;\002-QG\202Z\314\237\215\333\231K\344\363\341\373\341\035\262k\276t\323\0044\032Y\306b\026h\001P\2201Y\206U9\313\271!7\304dd\252$c\244\206\230\214\004\020\223\221\233S\332\344\320\250o\034\320>\200\240\331\214\370"
+	.string	"\233\205\200\311B\330\340\300nJ\032\314\001\001\317H\220%,g6+a+\\}\205\026\3133.\221!P\tkv\273P\326\252\366G\265\251]#\007k\255UTm\315\236\367\013HvM6\241\325\244Y[\004\316\274\217\001\364\216`\251\355\216\307\025\227f\247\317VD\265\343R0SJQJ\270g:,\n\223\230\335\\SJ\250a4\243\214R\n\251\200D&\020\231\300\2056\220\002\031\2622\017\020XFC\324tpF\304\377\201\210\251\222~\031\227\207\327`\216\221\3162\322\325k"
+	.string	"\t\256\206A\350\237\263\240;\303s8\001<\344\036\344U\240\330:`\306\221I\036\2251J\324*\t\255\223Fo\325\332\206-m\220D\230\344\021&P\266'\322\317\026\202\233\013V\177\215q\253\207\036\236Z\323\364\263\001Q\236g\341\276\342\022I\372\225SJr\340 (\210$\202\267\300i\320\202\336\3401\n\374\376\275\017\221^"
+	.ascii	"\335\022\353\017"
+	.text
+	.section	.gnu.lto_flashfsIsReady.34.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"e\n"
+	.string	"\306SH? \345*\035\340\034g\302\021CE\265\212\017X\n"
+	.string	"LEQ\235U]\234&$3b\302\223\302\306\032\266e\\\323\027\327\311@fq"
+	.string	"\300\252\334\374\024:\260\002O\357\376\361s\243%\204H\231R7"
+	.string	"4"
+	.string	"6"
+	.string	"\254\243\244\244`js\226\340\232|<\267:\372\007d\351\\\201\307\227ch\211 @ O\\C\200Y\352\260\353\212D\251j8sN\253\212\354\270\273\333\216\260\355`_!\334\334\226\275j\317\352\265Z5\377 P+0q`N\326-\301\234u"
+	.string	"Vl\337\217]6z\213\267%\3405\347\374\336\331#\373;\311\376\374"
+	.string	"A\362\370\362$*\335\335\322m#7\231\265\350y{\330\023^TJ\006\006\320Pj\263_\336E\364]\346\020\351U\357|\221\367\316\333\313\256\257\022WH\f\304\2447\273<\351\222\330\017\366l\304O\205\330\261\370\200!\b\304"
+	.string	"u.@OH\0047\013\0163(B\340F\030\206\300\2574\235[\335\303.Ac\211\231Q\177\364vW\266w\3151\355\2113P;\324\320\007\017"
+	.string	"]\b\b\303,Y\310mX!\250\246@\352\211\270|\207"
+	.ascii	"]\30370Q\006\215[\206\310\343\3165\3254\rLA\001"
+	.text
+	.section	.gnu.lto_flashfsIsSupported.35.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375 \366\265\006"
+	.string	"\322\f/4Pm\222\016$\243\256\206\222&\\\030\\"
+	.string	"\200\200\340\326\271}\360\347\375\331\267\177\267\f\265z\305\rd,\266f\346\\#\247\213g<\212\242u\004\373[\333D\246g.\230F\001\303,h\236\265y\r\033\f\303\313\\\330\273\bl9$\\\357\301\262\256g\331\262hB\034"
+	.string	"a\350\313\241\024\021+\002\tU\243\033\234{1D\307Uku;\224VE\200\022\310\235~\3738\234\370R\231\231\243\351w\243s\227\n(\221 \204d\216N'9R}`\374\375=o\271\300\300s\326\255bT\213\016\021\207I\346\366\220\242Y]v\233Q\252\304CD#}\352*\007\231\271\323H\021\035K\360K\004\b"
+	.ascii	"2\001O8c\216#D\250@\306ev\270\313\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_flashfsGetSize.36.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375 \361\225\006"
+	.string	"B\214-2`m\322\001@\203"
+	.string	"'t\224S\016Ctf\373\241\004!\314t\261B4k\255\207C\334/\253#\312@\022R\246(\273})\247\0020\350\330{K\231R\326`\244\r\202\224I\330\270\307q\013\234\214\202\323D\222\303\f\3701\034D\256\341\275\310U\342^C\251\027\220>\330\377x\204>\206\035:\371\351\314\357\264\263\324\200\tPVv\374\244V\330_\253!\333\351T\213\306\211A\265\033Q\245\254\t+\311\260\355\261+>\307;<\206+^PM\204\004\002\004e7\272\313\005\332\331\272\245\235\251\305\341\023\372\367\370\332\030\t\231\250\317\023\240`w\235\023%q\353\tlS\004\t"
+	.ascii	"2\003\316:#f\b\3055\2216\004\216\031{\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_flashfsGetWriteBufferSize.38.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375 \321\365\005"
+	.string	"D\ny"
+	.string	""
+	.string	""
+	.string	"&\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\307\317\270\004\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\356\311\006\221\250\300\004\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\377N\341\362\023\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\377\007\244\003\001\200\300\013/root/repo"
+	.string	"\030./src/main/io/flashfs.c"
+	.string	"\t"
+	.ascii	"2\003\356\231\301\300\341\273\206KC\260\230a\206\273\"\315\206"
+	.ascii	"w\335\033"
+	.text
+	.section	.gnu.lto_flashfsGetWriteBufferFreeSpace.39.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`h\001\235\016"
+	.string	"\206\333`C\020\221\223\016\t\177\204\260&"
+	.string	"\233\035nS\365bAu\231#\301\312\313U{\357\231\253\007\331\336\253\367\261\274\371\302\204\"3\377e\257QRa6\001\024\001"
+	.string	"\364\300\231\244\241D\247[\223&\215\220-\245L)P"
+	.string	"F"
+	.string	"N"
+	.string	"\373}\360,\025\252\021\213\214\030?\215\343\033\326\341>\200u\250\036\016:\\M\220\177\023\207'\027(\222G\341p\202\013jGZfH\036\206\353\032(\275\270\340\361Lv#\325\001\306\277\347\211\327e^\007b\214N\222\207r[\267\255\300v\001\373/\0010\355\201\351\316\2469\233\3166\275\3314\006\323\232M_\233\2666\r\235^M\253\246\023\200"
+	.string	"\224\024\202U\214\026V5\"\fd!\302G\361\217\344'\234\231VF\304\030\263C\233\304\316\016o\227\330\231O\342%J\f\n\230&pA\345\n\231\024\207\275Tc)\324K/:u\271r\252\245\037\251T\241\216\264\314\214T\017A*\301\250\232t\201\312\213I\322`\021I\305\236\342*\233\017\302\021\270<\351\320\347\364\337\t\254\304\314\310\020\312\225\375u\251&\373\0335\305\016\376\350\340@\032p\036\016@\264-D{\020\342!\242}|8\255c\2007\b\f>\232\204m\373h\331\027\372FM\361gl\250\260\035,\206\206\030\325\250GOl\257r\204\264\263G\257\325A\326\252\350\324A\216v2\335(G/*u\231\252\f\246\232x\267\2606\001\037"
+	.ascii	"c\013M\276qr\330\340r7\233\266\341\013mP\361\320\027\004\331"
+	.ascii	"j\234\253\266\206-Bh\303\3163\025\327\351\3603\276\201b\226\001"
+	.ascii	"9p\031\317\341\"\035\353g\002pMD\336&\"T\241\013*\234qW\202j"
+	.ascii	"\024\210\203\031\002\315\245\240"
+	.text
+	.section	.gnu.lto_flashfsWriteBuffers.40.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`M\017}S"
+	.ascii	"\352\215\234\037O0\320\322\031\016\253\365X\257wC%\373\366\270"
+	.ascii	"\r\031\377\256\347\310\\\307r\030i\215\242\340\242U\220Iz\326"
+	.ascii	"\220\212f;\3465c\302\003,\202\237g`~\350\316\305P@\200\333\340"
+	.ascii	"\"+*\220}\313\246\347nww\233(\250\211 $dK\231d\364\001\257\001"
+	.ascii	"\357\001_T%\256\350\372\025\203L[\032\337\2714\330-\036\230\356"
+	.ascii	"\366\330\273p/\177\341p[|S\267p\251\202\345\266q\302,\247P\313"
+	.ascii	"X\332\336\272\256\033tQ\225\270\222+\327X\027'P,\234K\217\267"
+	.ascii	"`%\\\335\204L.a\366\3265\252<po\b\017Lr\333\223\206\b\006(\240"
+	.ascii	"\307\265\354x\024\211\210[Z\030\007R>\226\215K\223+\027\ngn\353"
+	.ascii	"\272\212\330\004\372\n\226Pr\345b\013\262d\336\375\332\255\364"
+	.ascii	"x\264\203\357\254\353\0214n\353\032\025\261 \204\007nTx\264\247"
+	.ascii	"\365X5\215\212}\021\307\2500\263\360\255kt\251\364\237\340\201"
+	.ascii	"\351{\202\007v\nE\233\2649\177\177\177\177O\243\3374U\277\244"
+	.ascii	"\224\204tdTD4$\024\004\364\343\323\303\263\223D\352"
+	.string	"\034\215E\342P\230\023\004\246\315\352>\353Kh\342\250\t\003[\341Jv\3166\270\0228\t\314\312\221\254\374h\315\310\316\231F\306E9(\220\200\241\235\250\312\207\212L\332\324\204\201\245](5\241F%\311\355\234gi_\331\002\346eN*\034T\245\t\003\005\231\220\251\t\003C\373\017\0025\360\255\335'5Z\361\362q\271%)\001Q78\034\256\215{\322\241\rO\332^\346d\222\032\360\325\205\312\345\306\230G\311\216\222'\223\2101\262H\252TF\214udx\207\"{ip\302\300\332~\264s>\313\234D\330\230\236\340r\247\304\3169$}\224!_\016\327\306\305\034\024a`CN4A\356KeN!<\\\n\003S\273\320\316\251\226*\2259\203pN\332\364\034\003\244\f\nz\267s\256\300\301\264i\357\2057\305/f\372\363\203\314K\347\253\213\201i\216\217\037d:_>R\022}{o\315\257-N\237"
+	.string	"y\037\356\034G\267\205\307\302\027\220s\016\212u]\227\275\276\300\276\035\276\313Qv\027m\327\370\026cly\\\334\007l\350\016\253\364\213\326`\212\r\254<S7\377d\212_\273h\254)d\274W\203!\272I\242\231\372dlc\270\270\357\351\272\256k\272Ng\352\027\375\021\304\334\020\242\323v\321l\246\353\271\317\343\241\n\227\354\261\372M!Z\374\267\334\rt\367\273\242\244_1\3017\367\273\312\266\370o\231\372}\2703A\351\330\360\266\370i\361_\367\0260>\276\272\241\273\321->\t\261\276\275\355#{c\207\327\306\016o\r /\215\327}g\034ye\034yc\350\360\302x\333W\202\027.\226\267\005\213\025*\036\375S\374\312\337"
+	.ascii	"\212#\357\002'\336\366+\360\026\276&\256\345/q,?\211\345\025"
+	.ascii	"`9\342a\276\"\234\224Mw\3732\2058\362\2028\362\006\200\344\375"
+	.ascii	"\220\344\365\200\344\005\340\310\333\001\311\273\304\274JF\336"
+	.ascii	"\244\224\027\351\310{t\3445B\362\026%y\211\220\274CH^!\346\r"
+	.ascii	"2\362\002\245\274?G^\237\346\3551\362\362\030yw\376\345\233\374"
+	.ascii	"\333\027\331\274:F\336\343\221\327x\344-\036y\211G\336\241\016"
+	.ascii	"\257\020\310\033|\227/\360\310\2336o\033y\331\310{\n\016h\363"
+	.ascii	"\0342v\326x\321\365\307_\234\265\016\370\326\344u\377\227?\314"
+	.ascii	"\337\302\337\345w\373\337\236\263\373\375\f\307\223\372\334\006"
+	.ascii	"\261\004\221\332-\336]\006\f>\267GQ\3040\330-\322\275n_f\213"
+	.ascii	"\273{2=t|n\221\242\324\351\330\223\331\242\216\307@\245\244\025"
+	.ascii	"]\235Ud{i|f\302\270\213\331-\256\006\237\333\241)b\317\264\303"
+	.ascii	"\260\007s\271-\206\241\301\t\021\341\201\001\355\323Nfxl&\336"
+	.ascii	"F0!\350\314}\372aly5T\241\017O7\320=\247\341;\315\323\324;\315"
+	.ascii	"#\357\217\351\267p\216,1\003\342a\357\252I\324\261\2508#p\366"
+	.ascii	"\270:\213Xv\226\303OC\357\220\fy\256\035\266L\354\364]\265\211"
+	.ascii	"\372\204\357\265:shu\\\235U\374\342\222\203O\t\0366$'\224`\026"
+	.ascii	"\221\322\323\320\345\035\345_\3464\240|L/I\247\337P\376\006\222"
+	.ascii	",6w<\r]\033=\203\316K5\203\242\236\331\350\003\2226Ha\262\323"
+	.ascii	"\320\004\264\326\210$\373\310\326\350\031})lc\230\374\201j6E"
+	.string	"=;\013\036X\243\223jX\032\243'\207\244\321\374\206-\217\271\330\307\016\025MUS\325\202\007\322\350\276\022\347,\210\214\236\321\355\002\323/F\017[F\003\343\272\252\274nU+\254\305\200\007a^l\214\036\362\n\243_\346\f\207\004*lgrPtR\243\262Q<\316\375Rp\026\2575\267\n\356\373\216\203\225\n\007\370^\016\004\017\274\fg\265\037m\236im~\305\004(\307\242\262\331\314\212\b\304\023-\242\233\013\364\316]X\026\233;:.\356\343{`\201>\336Ad\341\361a\301\241\315\fF\tZ\331\004\257Xlb\237\350\013\241\333\322\345d\253C\232.'\304\206\256\261\211]\305\026\203\262\213m\354\324L\327\223\330\303.\366\273\336L4\261\317\364\313\373\033u\005\326\260/w>k\222\366T\333,dB\250\0336the\216\t\373\310\255\202&Z\210,\r\033\231]\026g\323B\270\256\\\006\354\327L\275"
+	.string	"!\006\025<\320D#\223\254i\245\371\036\324~\311\302\220\301\367\222\021<P\330C3zgA\006XE"
+	.ascii	"\223\323P\275\007\333\003\037\336\2651\001\337+\230\2021\262"
+	.ascii	"\325Y\347a\241/-\230\246!\032\271#X\242\205\310\002UTWPQV\301"
+	.ascii	"\240)*\251\253\247\252\250\253\007\254\244.\210!D\224\272\005"
+	.ascii	"SRQ\022\344x\272\242\212a\025u\205UAO\224\005O\031\b\261rL\265"
+	.ascii	"\260\212\262\340\311E\216\034;p\034\241\246\260\254\322\253\251"
+	.ascii	"\035T)\2428\220\202Q\264\252\212\302\201cG\0059\0135\302\n\307"
+	.ascii	"\005VO9p,\251\244\226SRO:\226PUV\313\021BK\225AT\325\362\212"
+	.ascii	"\212\252jY\214j\275\217l\021M\034\246\027%\b\232\\\230^\202?"
+	.ascii	"s\001\004h\356-5KC7b\374\222\216(z\323\036e;95\262[|x\343\267"
+	.ascii	"\205\247E\351\b\331\233\"\001[\331\315U\372\\\271\241\314\277"
+	.ascii	"[\220\254\001!\251\241-\230\3201\275\030\261\350\365Q6\360\377"
+	.ascii	"Ar\007\005)G\201>\334W\234\031\303\364\"l\356\321Z\026\233\273"
+	.ascii	"<\020m\344b\316I\200\244=\325\206\004\320 \372]\317-~\006\320"
+	.ascii	"=\202\233\263 \"Z\331,\232\0034\177]N\006\340]\225\210Z\204\357"
+	.ascii	"\365\020\304\240\325m\031\021\215hN\022\327\345GD/\2739\354#"
+	.ascii	"Z\321@\257\037\345\233\232zi\206\266\216\355\311\0255t/w\"\034"
+	.ascii	"92C*zS\240e\217\350fS\257\350?\363n`7p\244\214!j\250\007\261"
+	.ascii	"\241\026=*m>4\222\207\006\240?t\232\245+\312\226\207\006\272"
+	.ascii	"\001\240y\350\3755\205t\350e\253h\240\233\016}>\2754H\275\244"
+	.ascii	"\256=-%u\212Vb\021\276\323I>\215\224\316\351\321\225H\301\210"
+	.ascii	"\nCA\313Nv\223\203zZ\247\233W\023\347\027\264\323\307\243\366"
+	.ascii	"`\324G\235\232\251@5\352;\317\244i\n)j$\2575D=\324ED\235fa\016"
+	.ascii	"5\2173xM!K\376i!\024T\250\222\217\316"
+	.string	"\332e\247\213\247\016\202\007\n5\243\001\352\024\035$<6P\007\321$\373\247o\234\001\303\364k%n\346\204\032\272\313\201=\250q$\345\024DH\r\311HAR\220\2441\341\004\304(l\251\353\001\021\200\265DG\223\244F\333\001k\002\216W\2771\327j)\214\347gL!_\346y\345==|\b\317y_y\351\376o\272\343\333-\344\025c\264\217\353\245\336\3723q#\264\316\021#\372dXr\371\2233D\313\225a\237Z\315\253\022j\347\230>\231\271"
+	.string	"\b\367j`c\b_\005)\276;\023*\246\302\202\364\374\001,\031\337\265\"]\313K_\nG\265JQ\325#\203.\203\374Y\210B`J"
+	.string	"\2022n{1\203l\362\217Q\325\337\274w\307\272\237G\007\310\3718Pp\232\326D\233\007\241E\240\313@\364{\024\217\315 \222E\177\231\302\363\374\276\371P\004&r\3238\021\rP\242\267\212\314\333\n#8G\221\032\231\016S7\"5\021\215\201\210\r\371F\273N>\224\266L\364\276t;\223_\311\006\b\350%\244,\223~\035;\341E\001\032\271<e\223\344\270\032|\276})K\034\274u\263\021\246\207\233L\370\022\204#\315\237\210\277|\200\036,:%\210\212\036`\006\032Y\237\002\366\363\213\332\204\033\305u\270"
+	.string	"\260X\206W\375\313\026\001\030\233\340\3451\372\366P\031?\305\002\016bv\267\3769I%\361\224\315\351n0w\270\253\217\332\215\212\324\013C\275\024\227\276\r\305+\201\304\320\267("
+	.ascii	"\351,\333\300\255\310\221\246w\322\"vd\247\224\212(P0Fi\256N"
+	.ascii	"qa^\006\n\324\377\372\037\260\203\334\320)/tFi\311S\370\320\271"
+	.ascii	"\013p\347\\\023\002\345\037Iu\336B\3515\033\205\313\222T=s\212"
+	.ascii	"\004\272\275\316jB\215\273N\235\214>\301N\250u`A\303f\352*X\034"
+	.ascii	"7t\bb\031\302\023\361\355RWa\204=s\360I\222\232\001\267\016\013"
+	.ascii	"\224\362\233\346\303\227\301D\375\023\373hw/3,r\205D\316\004"
+	.ascii	"B\352|\354 \330`\177r\340\245\372\366A?^\222.\t\016\336\351["
+	.ascii	"\332\023\272|\347\314\004\025kD\201epU\211E\345\275\020\324\243"
+	.ascii	"? 3\320\346\264\306\341\344\3221K\376\331\3209$\331\263\211@"
+	.ascii	"\264\004wZ\201%U\354\312L\230F\220L\300\327\322M\331v\231\327"
+	.ascii	"\200QjC\221>\217\0359\023s\241\260\"\021\360\261\272\213\017"
+	.ascii	"\226\\(j\204\350-\277\034\334x\260\347\341\261\222\375\312\266"
+	.ascii	"\303\342w\246A\207\274\026\203\n"
+	.text
+	.section	.gnu.lto_flashfsGetOffset.42.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`L\002\245\022"
+	.string	"6cyG\340\320(\035\363\323\352\b\210Cd\202\320"
+	.string	"\003\337\364%\304D("
+	.string	"/\005\337\306\365\300\251$\362\240\301"
+	.string	"6\272\243\236@\277\335\023\310k\277i\2007\3100\317\020n\221}dT7\370b\376\251\033\370-!{o)S\na"
+	.string	"d"
+	.string	"d"
+	.ascii	"(\376\255\034\307\016b\f\3159\275G{\305\366\036o\263\330\236"
+	.ascii	"o\342'X\374\202\337\007\232\364\t!\323\031\232\363C\235.@>\302"
+	.ascii	"\007\220\217\353\341\257G\270\372\3629\221\233G\0228n3\032\354"
+	.ascii	"Q\346\220D\223\371\232h.\3604\347\374w\205\241\305T9\2219\247"
+	.ascii	"uF\303p\313\333n`[\304V\020\001\235\272C\252\275NM\352\324\243"
+	.ascii	"N\335qj\216SK\253\343{n(\325*\325\007P FH\3456\347\205[\216)"
+	.ascii	"#\376\210hQS\320\2558\013\330s\035\004>e\370:\320b&\354\003\361"
+	.ascii	"S\234\347\345\327\354\240\370\263\307\234\253`\271N\205\016\026"
+	.ascii	"3\222\371\330\320\230s\202<\372@\367\350\257\363S\344\243\332"
+	.ascii	"\367\003k\352\330n\336@\262\324\261\026\210l@\322z\243\355\226"
+	.ascii	"\264\177\031\021\323\233\345\216\366\262\"n\273\375\006\242 "
+	.ascii	"Y\221\3169a\2734\346V.I\016\f\027\275\361\363\200\333\310S\263"
+	.ascii	"\271\317]\254\374\032G0\321\317L\344\243\334\177OP\202\207HC"
+	.ascii	"\213\336\354/\246Kc\037\316\235\261_\273?\244\332C\252M\235\272"
+	.ascii	"\024\013\f\224\\)\225\025\203VJ\245B!\361\\\022\342RAp\215HP"
+	.ascii	"\241X+\324\204\325\210\t\252\244\345B\205\0200\353$\325BQ`\261"
+	.ascii	"Z(\357k9\234;\343\333j@\217\275mg\375\227\374X\230\333f@\323"
+	.ascii	"H\310\206\263\336\302\205\261\035\367\324\2621\177\254n\334X"
+	.ascii	"\203\373\325\375\013\007\240W*\345\373\233\017\bz\021\227\306"
+	.ascii	"cO\210n\245- `\002\231AW\036\362\030d \241\223\225\030\244t\310"
+	.ascii	"\360H\346X\275\213\346h\302\\\261l\351\024&\236\035nC\344\315"
+	.ascii	"\366l1x\033\026\317\334\027\002\373'D\013\223\343\313\036\003"
+	.ascii	"F\032\265\203\2019\303\222#q\030D\342r\036\026\016\346\332G\326"
+	.ascii	"1\273n\306\275e\227\001$:\355\312\220\n\240\221\201o\313\330"
+	.ascii	"\371,7\354\336\326\006="
+	.text
+	.section	.gnu.lto_flashfsAdvanceTailInBuffer.43.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\232\001\025\017"
+	.string	"6\234cD"
+	.string	"\257(\035?\327\315\334\377\203\220\370\n\304\357\347\234\343\260_\005\242"
+	.string	"\002\202Z\346\276\343\223\230\307\032{\355\327\311\b\316e?\273\346XtL\326o\377\317UU\020\307"
+	.string	"}Q\307\240l\326\342\177\2627\2212\245P"
+	.string	"J"
+	.string	"N"
+	.string	"p{\200xh\223\275\342\263\224\345b0'/5\273\333\251\206\233\036\341\246i\3629\217\316\307:=r,\034n\004^%Z!\326j\323\220\311\240BBn\255k\210\245\3328v\367+\317\t\254T&\347\261\273\316\217U\341\346n{d\273\200\375\027\001(\266\246A\232\376\\\366s4\0355\255\232NM?$ F\006\002\315.\205\332\315\322`L\314gy\213\311g\326\013,:\354\256\347\3206\261=\207\367\330~\332\367p\025\323e\021\334\331\30503bwf\300\0038\207\034\327\210\017/\025\327\026Ch\315FE"
+	.string	"\343\304\352\225\312\335=\251\302\314\325^\212\252\033\262\024.&TicU\020\377Z\244^U\277z\245\376\341/%\177\203\037\224\344\277C\277$\036\246v\\\034\275\036\270\251\235\304@e\315\236\245Ra\366\267\335]k\"\022\021\020\005\320\037\035\245\220\005%\221HH\347\215:\006#\321H\367A*u\035\033\366\032\200\220:\022\317#u\236\031\352\333*J\002\0224\224\246bF\332#^\376\263\352\351\034\276\027\r*\314 \375\350W\016\300\205\206\305\005\212\031U\332\210p"
+	.string	"\322\216\013\346\243oy\306Z)\001# \200\202\231Qs\fCC\017)0\376V\357^"
+	.ascii	"\355s$\347\306\330\357\2701.f\243\005\255;\030\227\263\357>\307"
+	.ascii	"\336\212\250\034f\227\337\230<Y\310\022H\036\031\362\211\r@\026"
+	.ascii	"\264\237\335\2167\bA\354\247\005\032\001\303\205\0060\\\311r"
+	.ascii	"\333\365\364"
+	.text
+	.section	.gnu.lto_flashfsFlushAsync.45.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\003\005\r\037"
+	.string	"\226\267\303H\220\330Q:@r\037\025\320\252\216\3423\201a_\235\315\342>\307\241\236\013l\034\374\322\200\236|\235My=\236\375\216\214\376A\346\266i\210Dd"
+	.string	"\211d\205\321 \023\022\365[\261Q\003\206\365\220\240\255\363\210%\261r\247\024\250"
+	.string	"\246"
+	.string	"\270"
+	.string	"\305\363\3063\201\372\321\351UF}\213\241\2260Yk\261\350\245\023\234/\t\374f\276\244\375\307|\311\265cI\231'y\361\351H\274J\214cBb\255\325\366d\333^\256\re\333lSzb\024\356g\306\210Uj-&\260\201\363\245m+`"
+	.string	"\345\250\027\207V@Z6~\3065\265\026s\013\344Q\257\231%mi\224_\213\260\365\n>\027G`P\352\265\0327\257^\002\b^\235\246\023dA#Pk=\222\212.\355F\326\243\214N\360GC \3142\343[\247.\202>Jk\021j\255\246\300\240\214\373\274m\025\2663\330\345\202m\250 \225\213s)\237\242\344\007\261N\004=P\204\3712g\317u*d\306P\270\2055E\317\354\242\217n\226}Z]\037&:\251\207Nj\234\215Z\310F\035D\251o\224\032\310F\375C\251}(u\017\245\346\001@\275\203C\255sR\347\374x\237'\376\346I]R\352\027H2\263\202\021|\013*\265Z\235\271\251c%R\310\217\277\327\017\366\265\357/9R\305\305\254"
+	.ascii	"K\312\221#\361\233\374\353a\266Ay\024\250\203\245\340\251]\352"
+	.ascii	"m|\321\302\221\244p\276|\345q\362'P\367\352\321j\023\013Z9\206"
+	.ascii	"\324\032\343A\311\003\315\204\266\366\003\0132s\333 \240=\353"
+	.ascii	"=\305\274\001mM\r\230\257\354Xn\226\223\351\213\371\030\232\003"
+	.ascii	"bRHD\363\263>\230\2279}q\260\211u0_\256\021h\346\263?=\313\263"
+	.ascii	">\373\252!="
+	.string	"\373\337\233ry\3667\330p\371}\330&\031F\303\021\311tq9\362_\216\020\020\307\204D/c';\313\337\227\257\354\311\325\316\372Z\276\205\204\330\303<\340(1\352\370`\276\244F\240\031\226\243\333\260\326\251\003}+\277\002\302\017\362\322!\216\216\314\227;\373\252\">z\346\234\325\331#\177\300\310\261\253\354\370\206\212\245!\333\261\233\345\234-\027\353\305\017\2623^\306P\321=\236n\267sJ\252\365t+\2268\360t\273\235S\222\355\204\256\251i\211\347\241\247kzJ\n\240S\3421\355J+\031\365v#zH%v9\246\245\334\211%$\0239%^/g\2043\023\n\035/\327\304\304\304\313\331\212S_\037D\013\243\252Fe\223\234Z\237\207\026\267D\373\037\322G\317\334\f\265\301\355\213\003h\321m\t\023\350\326?\354\242e\214j\245j=\257\024\264Zy@8\330\237\344\242g\026@\317\265/`\240\007:"
+	.ascii	"\023\032:\330$\251V\312C\224n\321i\2030FC[\303\006z\340\271("
+	.ascii	"\254\256*\326J\371K\315\375>\354\024\210`I\351*;\3360\2056^\250"
+	.ascii	"q@\004\0212\304\020I\022I\232j\016\240\002\221\261\321\035\021"
+	.ascii	"P=DUC\223\302n\002.\370\3311\351\310^O#\272N\024_3\306\267\263"
+	.ascii	"\332\200\035\246Y\371Q\370\211'.\303\336f\341\364\201kQ\304?"
+	.ascii	"#\250V\211/\302\2647\335a\030\207\230\272\b\212\263\210\343\350"
+	.ascii	"\205\362I|v\024\204O\2762\020\305\215\232-Qi3\\^\306\037\367"
+	.ascii	"R\031.\367\261\270\312Qw?7\216S\027ROB\261@\036\246BXO\247\345"
+	.ascii	"\232tz\177\320\300\314p\321\213\331O]<\034\241\333I\004\341("
+	.ascii	"\326\332\025\235\246\256S=E\345EV0\367-\2452B\213\"\261T\304"
+	.ascii	"\347k\314\316\222+8\226\347\204>\231\251\3740I\351\302\373\274"
+	.ascii	"\260\263\320\344K\325"
+	.text
+	.section	.gnu.lto_flashfsFlushSync.46.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`l\004}\033"
+	.string	"\266/\251H\260\230Qc\361\356\273\b\243\312\002"
+	.string	"\214\231\337aQ\300\215\344w\223\272\261\351y\2207>\315\200\215\221\222O%\263\340rX\b\025\362\326l\371\250\267\241\377\240\347P~\030 \n\177\300g_\031\2725\266\335{\357\275\245L)\216"
+	.string	"\210"
+	.string	"\237"
+	.string	"\242\275\217\003}\376\376\343\366#\022\256\373\344\276\005\016\"\247\006\345\305_\227\237\276\350v\243\022\277A\367@UDH\242\356\005Jp\321\006\312\213\376\335f\274X\276f\274\350\233\235\345?\337\275!Z\322%U\335{_v\306o/\311Q\fm\275\371</I\034\340I\026\037Y(\213\213-\264'\034p\357}\360D\r\t\300\b\342\335\206\f\230P!-\324D\030\223#\313\215\003_Q\240\271ZI\234{\257\353\016\r\272\315\333\316\331~`\2071\002CtLk^\310\235b\376\2205\314\352w\263\361\242\265oz\255\241\302\327+\342\341\352\225\375\313U+d?\274V\206\315\252\256aU\323\230\3253f\265\213U-cV\267\314\352\030\263\032\246\254>\311j\326Xm\216\325V\200\216\321O\n\364>G\356\375\271\372r\237D\"5n\364\037\275\332\367\203\274i\347H\266hp\250\227\356"
+	.string	"\371R\210#\371\301\252\336\213\020\366\223\036\264O\2138\222Y<,<\356\275\347E[\204}>21\026\306\266\354{l\304\330\353\254L\013c\357\242K\023\235\025\356L\276 \017\361&\265\002d\362\340\237`\b\322\247^\332d\311\231\224\242\256)\007\305\264\342\264~\222+\241!\035X\301\344\tN\351\245\367^\013\343\305\232\264\223:\002\263\361\335\213\373\316/r#\027\374\241\213\306"
+	.ascii	"\203\215\027O\373\036\034\271zekY\366\301\037\330\241\004\204"
+	.ascii	"R\262\302Y\025C|\264\204%\214nF\035\325+\223\b\357\205\001\341"
+	.ascii	"Gg\300\223\322#\352\310VhL\001Y+dZky>7"
+	.string	"\234LA\241b\242z\t\266ZL&\333\311@\332b#f9\265\230L\266\223\341\264\316\002\233l\203\r\306A\366\242\315^\036f\260\016/\235\232\355\265\340\306\264\017\261\332\013\004\215V{\235?\334\303ke\030\007gs/\177\340g>\365-\032b\243\324\227^\213~\250z)\025\200\232\340\n^\013\370\002L\261#H\250\300\333\370\350\370ry\226\207t\215\275\362\235T\215%uN4Uf,\215\313\226\367.2\316\270,\311\305)\007\2454Z\241\234\321\217r)\241\2034\252\227R\311X\377\311\241\344\370\230p\242\024\222vR-\033]\250q8D\215R\246\246\024\244\240\264 \351\260\002\2211*\036\021P=eD\223\302Bi\f3\013jg\374\n\225\277^\270\022\203S\242O\205A\210\327\263\f\330d\311\261\035\247\360)\330\343M\030S\0340\207[\013A\022\247\351\345\002\026U\267\2361\346\355u\244O\373\274"
+	.ascii	"\326$2\035M\376\213\216\017\343\204\216k\211\202e6\350\226\277"
+	.ascii	"4\2145\246\317\273\374\030\210Id\314\311\016e\215\030\335\341"
+	.ascii	"\243\237HK\331\003VhB\244\246\373\224\215\262\231\263 ,\274\022"
+	.ascii	"8\013Bfh\365z \302\335\350\226$\025Q\334\020\177\244 \300d\245"
+	.ascii	"\031\347m\201r\232\fk\216\277\260L\275\370\t;\323\321\366\202"
+	.ascii	"\215\327\274\211\025Q\250\001"
+	.text
+	.section	.gnu.lto_flashfsSeekAbs.47.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"M\t"
+	.string	"v\222B;0\305*\035"
+	.string	">\327\032\032)!\253\221\207}DRF\350\343R\352\022o\257Hub\305\355\307\330\205\363\034\311\316\306\265b(( \244 \366\377jc\345\2510\013;\270\321\336)\005/"
+	.string	"2"
+	.string	"0"
+	.string	"/\320>/'\320>\355\331+\017AVC\2422\341\222\355.\225\037\367\036=\377\254g>T\3511@aw\035?\224\305-o\373\300\366\306\266,\003\240\t\352\024\260\335\212Y\200\215M\224\021\277\344\255\321C\013`\264l\237\366\310\336>\277\331~\264\257\372\312;Hrf\267\003<\331\r7F\300|\032\004\276\210!j\374\367\351W\355\363\255\307\220\013\225\306*\303\024g\236\321\216\220\210\377\234\220\002\213\235d\311\016OQz\330\277\354\356Z\246\354\203\277\234\001\242O\345\270N\263\207S\271\205\332a\340h\007\242\016\240N\003\365\204*\345h\334=|BT\324u!\272\205\246_V\246|\3261\257\r\016"
+	.string	",&y\262\224\276\353/R\n"
+	.ascii	"2\241\371/P\301\205s\227!M\305\013\032\373\n\221\210\325\025"
+	.ascii	"p-/\204I\006"
+	.text
+	.section	.gnu.lto_flashfsSeekRel.48.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"e\n"
+	.string	"\206\224H=0M\225\016S\363\342y"
+	.string	"U\212\345\b\367\377\021\230V\233yZ\276\027\275\177a\216\320\035-B\177\3040\215\310\3210A\305PP@(\346\300\236\233\313\361J\234\nD\006\331\310\215\244L)5"
+	.string	"5"
+	.string	"4"
+	.string	"\033\261"
+	.string	"\307#\200c`\217\215_`\217\366\354\020\017/,\204\344\362\254H\354\256\246\026\356==\377\250?@\020\347IQ`w\235 \350\301\255\267\035\300v\304>\201i\325tj\372\016\213\017#\320?\"v?/\327\266\242\207\f\376\206\2476\017]\021Ri\330\335\354\321\336\330\331\3433\333O\373\245\233\274\237\030\370\261;\301\324a7\232z\317\t\177u\326\305\037\231\303\344\301G\037\203=^3T\241\b\235|\031K[\301\202<\350\001 L\264>\345\330\341\227Z\301~cw\327J\301\376\351\3074\232J\267m\034f\212\244\333\ft\223\003\233\306Y4\004\226\311E\243d:M\0021\227\240\222\3214\034\227\321\262\260s\324\035,\222\203\022#:\372Y\225\303SO\f\020J\"\223\204\324\253\352\033\210\276\017"
+	.ascii	"2\003\3020\306\302\332\231P\020\\\255\030\3554\364\224\025#\312"
+	.ascii	"\302q\031\330T\350AE#VW\300\265\274\020&\031"
+	.text
+	.section	.gnu.lto_flashfsWriteByte.49.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\301\004] "
+	.string	"6\374\322H\200ZR\007\271\334\240"
+	.string	"\231\365\201V\215'\3249\253\207H\013H&\235l\262$\214\022\200=\305_\257\235\261\371b\343\013\037;\322\311X\004\017\327Vz\216p\213'\255\355Y\207\207\241^\214\352\337\205\366\357&r\357\224R\n\302"
+	.string	"\254"
+	.string	"\300"
+	.string	"(\267V+\235:\213\023X\201\025\271\367\346\032evb\3165\3529fvgN\260 \330\310\025\374\367\032\265\302\356U\036\340\001i\243\034d\356\322\312\035\267'\304\305p\213\355\336\373{\035\035l]nFMq\026=\337\203\3348\242"
+	.string	"VN\226i]\305\247\3265\324U\347N\002kbc\232\n\325\325\311\233\362A\354\344\f\237\361QkzQ\203fH#6^\310\350\264\251PYq5\200 TU\216S\361\305$\026c\264\305\rQ[\323\272\2121\032=\t\030\245\300\330\025\243N\336\331\r.\255d\341'\214\376]Qx\372\356\275\235l\227*\256\3568\242{/;\261\370\242\231\246\2319\n3+`>u\004\334X\234\004\302\233\330(7\b\333h\277\372\344efLVAy\223Y\271\372\037\231\373\274\217\203Yu\366\251\316C\356,\344\316A\356\f\344\316?\252\263\217;\367\270s\317\235y\254\363\216u\346\245\316:\251s\216\352\214\243:\337\250\3166\251sM3\233w8g\032\353\254kd\267\352\316\247u~\353\334"
+	.string	"z\234,\321\224\b\231\3724\345\235j\226\271f\350\330\217fv37\367\222frs\365V\260\251\263\370\213^lFd\023\367\026\347:I/\233Z\t\n\237Py\213\027\232\\H\266{\225\005\032e\003i\243\276\346\331F\317\316\261\035W\310\200\333\254\003\006n\254\022\266Q\335\253YPd]V\"\203\006\r\266Q\232o\256v)ZU\214I\234\320\017\005=\320\013\005\375\213\371\371\3646?\261@?O\341\213\351bb\316j\330\236\367\351=\317\367|G\001Y\275\311;\337\343=\317\237hBf\370\326>\210F3\364\217\274\363\274\347\260\234\"t\267(\033v^\255\202\302\373Vv\347\bc\244q\376\221\221\354\223\013VM\330\302\370\275\367\351\377\310\270f#\331\377\177\362\332\262,\023\272\033\253\317\314'zl\305\016\226{o\003\356\260\0263\342\306j\224\217\200@\333\250"
+	.string	"\036W\177~\017\337\376\277\232\370\245\033\311\366\377w\224q\355\256f\202\024\300\024IE@$#\022)\320\204\023\207\223\217\0200y\370\300d\024\302\303O)\3517\"\311H\304\357h\211\351\207\240\307J$\200K?\023JJK\277\234\022\252\317\3738\330\001\021\252\2665\250_u?\316\374"
+	.string	"\2027\221;\331D\353?\355p[\013\313\375\221\277G\363M\315\221"
+	.ascii	"Vf\b\226\326\274\316K\261\222\325\371N\266W\265HC\002\006M\213"
+	.ascii	"\320\335fp~\3679o\311\206G|\177\3638\177\222\355\336\346o\276"
+	.ascii	"\243\306V+}\245H\302\004o\342\004\333\250\315\343\206\315\266"
+	.ascii	"*\365\233]d}_\303\363\266\2421\221k\372G\3566\032.\354P\204,"
+	.ascii	"eC0\324\347}/\205\302\356\276\247\245\266,\323\375\356\335\312"
+	.ascii	"\360\215\311\025\372\314Bz\003R\2501 \304\0302\3061f&\020\231"
+	.ascii	"\221$\271\006`\002\221Aev\021`M\207L\024\250u\003\023\240\226"
+	.ascii	"\b\023b\305\376~\244\3756\207Q`\320\376\241p\007O@Z\360Y\013"
+	.ascii	"\023\031\341\246\020\203\371\017\266\2000S=j\243\207AWcA\304"
+	.ascii	"\222b\360nx\2636\0323\246\250\355s\027\237\311[\302W\351\314"
+	.ascii	"\005\037ba\341f\260\260#\004\026\271\315\350\260\b\bY\023f\365"
+	.ascii	"\30297\332~\202\245\2033H\253N\250y\003k\255\250\330\206|\004"
+	.ascii	"\323Ji\374AA\264=z\263\206T\230\246\223\032\n\252\022{\260\023"
+	.ascii	"\f\343d\275\255*\343@!\023\253\274n\207`\247|\270\262\210\337"
+	.ascii	"\346)*"
+	.text
+	.section	.gnu.lto_flashfsWrite.50.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\026\r}D"
+	.ascii	"\032u\220\031?@\346Q\007\013\267\310*A\250O\336\303\277'\204"
+	.ascii	"B\371e\230d\370\372\367?~\237i\262\n\232\r\373\021\376\025(\273"
+	.ascii	"\2409\350\034`5\302\253\177\225\376\024\266'<\376PK+\261{\357"
+	.ascii	"\224R\n\214\001f\001\213\001\215\207\205u\224::\216?\f\016\025"
+	.ascii	"\032\325\301]\207\205:\232\316\226\213\352\232"
+	.string	"\034?9-\307,\344\036\035\307\301\261:a\017fa\263k\2735\233~\353)\013\3414\234\262\343$\227\256\335\005z\3512&\257\306\257\331\226\006\350b\333\246\335(\373\215\217\245\257\355\t\365\351\202:\354b\273\206\301z\327\210\370\222\266\245\212Y\r\203\002^\322\033\026lC\303\213:\272W\372\240Y\256\300\274:\363\204\n\312F\363#@7\312\213\332\211\340\3226\243\3543\f\030x/\031\241\250_\263\005\326v\346\2166\233\262\311\bi\246{\251\264\211s\257T\212\241~\315\262\264\215m\263\277.\266\315\262\222\271PK\317n\200.k\3164\216\356\275So\245\225\375dt*61-)\021\223\206\302 \360\347k\331\365]\311\275\354'#Y\222,\355\244\326\305\225\302\020GP\332\356\251\266\016\0379\373\3644\315\233\320\232\211\256\255\312\256H\261\364\222\217\212\332\007\244\344\235\265\222\335\363\214\313S\212\023\257@=\311"
+	.string	"Y\222(=l\273g\024.O,.\204\302\345\371\304\203\253\021,\313W\333=\241\254\016\362\246\214\232\316\211\003\355\236h\3236\300\3459\346\277\001\206\252\207|A\252\324\250\036Y\022\261nW\007P=J\210a\316\325\270\247lP\343i:\273\244\327`\330\222~b\230\327Z\340\336\333r\355E\302\230\356>\252{/\373WX\222f"
+	.ascii	"\315\334G\230y\311,\214\024\335\334\022\002\304W};\321\253s\356"
+	.ascii	"\365\277\031\210\367\3603\332\346\274\374\221\"\0241@<\353\366"
+	.ascii	"\266&\326r\215\350\312A\224\n\215\036*\324\206~\254\363\r\363"
+	.ascii	"\256\r\023\252\347\026\324\203\204\304\3654\005p\371\026iE\333"
+	.ascii	"\254\247\371B\364\341[\256\001]\031\317\356\355\352/\356\273"
+	.ascii	"\306c\301\255\326,\267\270\272j\233\245\372nzaz\225=\374\207"
+	.ascii	"o\347^\367i?/\270\325\030F\f\357\257\030m\263\036\336M4\ne\023"
+	.ascii	"\353\362*\263"
+	.string	"\224\351o\306\334_\255V\253\374T\230\335\331\204;\227X\235\255Vg\022\356<bu\026\261:\207X\235\253\206\316 \332\231\212\350\374a\350\354\341\235;\2743\007w\336\340\316\032\3349\303;c\350;\315\027\206\316\026$Dh5\315R\275\2469\252\321t3\200\352\271f\005K\316\b\372L\267\201&\323M\240\317\220i~\032:\033\223\234\235\206\316\305\241s\223\2223\023\321y)\311Yiu&\256\316IC\347\241;\013\3359\350\316@w\376\271\263\317\235[wf\335yu\347wgw\347n1\340\017\223\017\232.b\376Nz\301\252\221.\225\215\323\322w\272\347\272\325t\257\351~\323\035\247[\346\266\373)\334\024hTOSqt\035\263arS:\216\233\216\205s\307(>~8\230\205v\372\016\007\337d>(3pgb\355\304_\264\334}\274I\333\265\263\201)\202F\025\361\234=e\203\204\355{\225\366\247"
+	.string	"u\332\0317;\3017\203\324\354#\333"
+	.ascii	"y\371\243(\366}K8\216\240lq\t<\252\037\264Tw]\277\231\260\200"
+	.ascii	"W\327\323\024\020\316\230\225k\3121\336_\n\276\351\272(\275\013"
+	.ascii	"\003\006\275b\277\004\276\031?\226\352\236\217C\n\270HN\270\026"
+	.ascii	"\303w\370\"\375\243\355\360=m\0273\302h\231\210O /\177\364\333"
+	.ascii	"\360\027\236\303\267sN1\032~\375\r\277\3165\241\027>\303k\370"
+	.ascii	"n\3061\233\221\203\035\225l'2\274\317Y\325\023\353\362\351\242"
+	.ascii	"=S|_\355c\273>\206\017R\275sF\231Y\276\240\324\366\315\330W\355"
+	.ascii	"\255\366\302\007(c\250\215\316\302_x\367\343\334\273\303\312"
+	.ascii	"2^\004\304\357^/\013\354_\3120!\270\325d\264\315Zx \031w:\021"
+	.ascii	"\031#\254\334\252m\026\3017\236v=e\372@\331\304\376\327\357\267"
+	.ascii	"&\324\277\377\237\235kB\231R\376\034\256D\365\333\361\327\337"
+	.ascii	"\320\261Akq\006\336\216N.\306\374\350A!\360\314\354]=\025B<\273"
+	.ascii	"\367b\360f{\332k\2341?kP\2365\361\334z~\373\013\221\211\3679"
+	.ascii	"\341\332\356\334\366J\354Y}\t\022\377\273\315sZ+\022\357k\004"
+	.ascii	"\307\274s[\337\214\217-\267^?Z1D\363\240QE#\236\233Q7:\276\231"
+	.ascii	"\020\206\235h\233\3754_\210D\374\210\020_\365\">;\262\270\270"
+	.ascii	"\216\310\253\031\303,\033X<~I_2\013\310\221\205\220\007"
+	.string	"\026\362*\013\271\245\225U\225\314\342\372Q\205\314\322\322\3621\303\270c\353\310\205\334R\301\225D\036\265\2064v\374H\256;\262r<\026\027V\215\225i@Hj\335Hb\345\320\232\332:N\3558b\351\230\242\201LNA\b\300[<\262\220S\\[[\310)\241\264\253\251\272\236\271\336{\357\023\220\r\203\333\002ek\016D\345\313\236\321\307\233\344z/\331\207\216\323\235w\246\313\311\bF\302\033_\310T\253\343\364\021\276\343\334\313\225S\227\002\022\336\211D\231\232\233s/\016\211\036\237\342\2331\0225r\350\230\202\006\036\300\027i\272n\260\246\0348LP\317\353\217\300?}\221\337\355\027m\361\1779\247\332\006H\352\001\274\204o\313\322\356\232[\"|\333\226V\327\364R|-M?\374\342w\023\312l\372 3\r\316\201+\375\3233aQj\021Ni\376\222\227\236]\355\212x\346iLKR\257\364]\206V\215z"
+	.string	"/\365\217&\250\251\210\370Q\357s\222\276#5\361\273\271e\370IW\206,\031's\364\304~I\2366\313&"
+	.ascii	"xP\b\366\310\345A\331zI\2366]LKU\250P\037t\324\324\331\002<n"
+	.ascii	"`"
+	.string	"\244\032I\300\332]T\351\331\f\236]\3025j\343\267g\222=D\341#\333\350\202\017|\341\263\204\202\337\341\312\357\331\007\376\373\371}s\031\333[k;Az\354\222\240\\\3013+\273(\2778\336\335!\252\327/\033\r\252G\311\320\027\201\022\250\221 \304\224r\210\021\022\021\221$I!\035\001\005\2048\n\251\264\r\021\220\26147$I\241\322\030\020Z\234\341\340\345\312W2V\345\030\214\002\r\205v\236z\255\rm\020\357/!\346F\2502\3223\261~\\\016@\037\274\222\221\220I`\247\036 \223\303/\230\371'\030\205KO<e]\3011\362\323\230\2774\233\036\332M\374@\001@\207\224\301-T\033U\244\365\002\310\202\306\235n\013\230\257l \317\214\203\006\033\224\302`\370\203\211\"\001\215ko\254\321\031NV\021}\n\nX\262\013\024A\002\003\336\351%\240\343\246.\355\261R\263\f\221\371\343\006O\341\351C"
+	.ascii	"|I\217\007+bs\036w\340[\003<\241\232\224+\300)\022/\324\200\346"
+	.ascii	".\346*\030\271{\312w\034\271 \221\021+\024\035\340\200\037\244"
+	.ascii	"\212\026]\322vD\271\275\027lH\003Vw%\261Yg\254#\302E(\210\214"
+	.ascii	"\023=g\222\2631\026\356\205z#\0031\210{\217\265q\373\007\333"
+	.ascii	"\022\004 jD!x2\262\030\022\345^\330\021\204M\005:\326AQ\244\331"
+	.ascii	"\300\343\037\006\306S\030w\374q7\006\035\273!i\345\225\342\205"
+	.ascii	"\301K\317\234\304\b\026sT\211\"v=\334\371\005\021E\210<7\327"
+	.ascii	"\024_\250?\231\224\235i\342D\350"
+	.string	"\003L\273\024\343\345\\\033.\357\275\202\375\\\341,\240\210\362\303\344\324\203\020;bW\221\357RW\024\2458\034\r\f68\231\016%x\312\225\250R&\215\030gTD\241\261\350\277N$\340?\tlp\371a\265S\230\277\345\303\362R\317\317\007Yq"
+	.ascii	"\001\006u:\332\263\337\266\302\360)a\240W\034m\330\"\363\220"
+	.ascii	"\314\305\005I\f\211\r\235\232x~W\244\307{e\245\375\353\004\374"
+	.ascii	"\r\341\f\027\030\352\251s\211\022b0\321\304\322\350S@\327\037"
+	.ascii	"\201\344X\016\026\371\033Di\332_\374\035m\007j>U\265vYm\234M"
+	.ascii	"d00\2459\270\211;\3306\257W9\030[ *\207\023\030\342\242 \026"
+	.ascii	"\245E\307\003\370)\033H\223m\201\251"
+	.text
+	.section	.gnu.lto_flashfsReadAbs.51.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\215\003\275\032"
+	.string	"\366q\260J\220\330Q:Er\337\340\326\024\235\243\334\240\266\254\272.\224\221\255\020\360\211O\313\002\254:\206\236%\365\2637\326\377\211\313()MA\313\365W\rfM\" \311\004 \001\022\312\246\220NR`\244\341\263\320\377\215\020B\266\334)\005\234"
+	.string	"\216"
+	.string	"\231"
+	.string	"\363L \354\2525\205\216 \265\006\023\370@y\3618\236CgO\321 \013_"
+	.ascii	"\245\252\037\036Sj\2553\232\303\214\027\351_\306\213\273\302"
+	.ascii	"\345\324\375\345*\311Q\244;u\376\313\267\373\353=Gw]\021\235"
+	.ascii	"\030~\006\371z\263,\240\242\310\350$e\240c\251\305\243>\207|"
+	.ascii	"?t\233\206T\267Atb\216\037\276l\242t%+E\221\321E\023\247-\276"
+	.ascii	"\020\224\246\326\n\363\371\314\245\b\220\206\224h\361\361(\314"
+	.ascii	"\221_\223\017_\300\006\321\321\234d\203Z\253'\220\257\350\206"
+	.ascii	"\3356\223\355\t\366\332\002GO\250\030\365\314-;\270\233\013\224"
+	.ascii	"\322\002\362\360&\33132\207\272c\336\364\303\274\374\351w9\323"
+	.ascii	"/\023\247Y.\274c\177z\272_;\355\332\351r\247\3119=\216\323\242"
+	.ascii	"8Mwz\356\364\007\260(\021\362=\006V\255$\266\254T#\242\324\214"
+	.ascii	"C\375\302O\373\366{\370QP\035F\300P\322rP^\274\255\363\207\206"
+	.ascii	"\331\026z\352\265\250^D\022%+(\265V\233\213^\260O5\024@\365\371"
+	.ascii	"\t\335\314\340w\350\336\364\341\262Z\223\212\314\202\245\037"
+	.ascii	"d\2071fw\007\325\226\223U\313\244;n\271v\255\302<P\314\322\364"
+	.ascii	"vg\331\222[\356{H\244\2700;\356{7xs\313\261\025\367?Z\260\245"
+	.ascii	"\373\250K\340\315\220\362\243\325\263H\2304E\215\013\364\207"
+	.ascii	"\377\220\320\312\t}Y\323u\331\327\006\331\260i_\3100\017\344"
+	.ascii	"\032&Q\214\360v'.\360e\311\237\f)=\032\004j\304\230\242s\210"
+	.ascii	"\313\312v\356\353'\003\253\207\304\273\271\252r\261\013\264l"
+	.ascii	"\2778NV>\263\212}\037\377\001\302\207\341\333\206y\240\r\343"
+	.ascii	"\305\357\207\247R\001;7\033\017\rW\343y\220\263Y\210  \207V\203"
+	.ascii	"\220\253\361x\300q\355\3240,\256\246\243\303\001g\314\345j\270"
+	.ascii	"\234\034\032i\n\nr:\026r4\f:\263\233m\266c\243e\230Q\300\345"
+	.ascii	"f\nd|\323P\303\315xn7\334\f\026\254\302SW\254D\317jh\332\234"
+	.ascii	"\305,\353\006=\313\023\276\026\370\233\253\252\027\256\005\332"
+	.ascii	"\2040\213\211\224Y!a\025\021\321\346\261\rzT\026\020rfM\305\327"
+	.ascii	"\3026\250f\204\031\330QIqZ\3423\253\320Zk-]\013\333\231}\217"
+	.ascii	"\006\317\265\344o\t+fc+\263/$KEzH<(\024IB\002@\250!0\004\215"
+	.ascii	"2\304!#b\022\214\3144\351`\002\221rX\017\020`g\304Y\003CUv\366"
+	.ascii	"\n\026h\003\021\360P\327\263\264\3277\247\242\207\311\016\206"
+	.ascii	"\025\234\243F\376>G\b\0229\355\325\273\333\300\2340>6\303\257"
+	.ascii	"M\222\024\330\017(\236i\353\030\3407\364\320\351\023/\364\216"
+	.ascii	"\323\3206\354\370\347nl\251\316\"\3640\307\225c\257\224\036k"
+	.ascii	"\"\377t\226B\200\002\3008a\033\003\030\027\367\213\347\203\201"
+	.ascii	"f\205$\263\\\310\374\206A\354xr\363\322\301\275\245\324"
+	.text
+	.section	.gnu.lto_flashfsFindStartOfFreeSpace.53.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\221\005u$"
+	.string	"*C\224\016J\220\026R:\301\347\327S@\032*h\222r\230Z\207B\333-c\360\nf@\\\360\270h!\204R\262\254\376E\337\3765n\266\352\023\353\037"
+	.string	"f\204&\002\200+N/q\322\f\027a\216|\320b\301x\330\362\033i\204l\271\223\f\336"
+	.string	"\277"
+	.string	"\330"
+	.string	"V\272\262h\2717\n\003z\363w\3465\347\361K\00510Aa\234f\257\220\n]ap@(r\032\220S\361\022O\255\037M\276\330\356\275\bn2\203z0&\306\335\233\205\245\310\275E\005|"
+	.string	"\275y\257\177-1\323\205\024MR\005\272\222<\005a\273\267\310\003\272\200\363\246}\315y\263g\330\333\342\371\344\\3=\315\341\320\333iZ]W&~n\215L\r\212\210\342\351\223\250+d\260\346N)\253\343\bdIU\035}\022Ee\201\bpEU\325\233\325I\321a%C|\262\f\252\312\2448\3253\307\324M\031b\n\264\327!\361\251Zt\352:\033\301\307\016\032\177\022\365\302v\330\230\332\271\242\256j\037y\324JW\333\226,)\253\327\333\204{/W(\242\324ywf\376\302\314\034\230M\007\001u\311\3519\355|\327>\243\b\333"
+	.ascii	",\317t\316\364\033g\355GR\210\025\254K\346b\260\366\026\363e"
+	.ascii	"\302\030\217\3341\230\177\316\312>"
+	.string	"=\2662\017W\336y\361\254\223\203\363\263\363\315\303\316654\007\373g^<\357t?\236S\263r\356bg\234Y\031\265\225of\345\323\254l\332\312\326Vn[\271\332\312\007\342I3\256\211u)\351)\305\333b)\34661\317n\374\354/\376a\277\330\177\374\311~2\237_\344g|4N\2237\273\222\225^\306\255\204\262\003\353\353\336\233\336\214\237\344T\351DnF/\266/\266\rJ\314\351\3153/\361\201\334\370 \037;\222S\026\362!K';\361+u_\025=d\376\235>\375\202\205\026\220.k\267\336\342\035\022\263\247\273\212\016\301ozho\372`\366\336{\317\004\277\351\236\036\240\345\265\024b\005\203*\256\224fo-\227\313\345;\234<\3553V\271\2229\303\235t\360yp%{8R\b\207\312\275N\rn\362\364\321~@\271\004\006\226\217\263\246\256*\223\222\303\366\026\377,\306\013\024\034\272\216\301"
+	.string	"\320\366\031\2258U0,Sg\312\256\244'C\005\212\031\304\221FAT\356\275\rn\336\2329\004R=\024\332@\302F\301g\337\372Wf\256M\237\035 ($)\344\n\232m\323\277\"\354\241\353\264\315N\265~,\357T\345\005\326\275\3255O{\267\355\013\333\256\366#L\374\032\234D\242\036\212D\233\270\032\303\203\2526M\337\354\251\255)F\367\365\210\210JP"
+	.string	"\376z\300\034\220\250wd\201E \214|\346\007#\244\006\036\225\370\365|'\320'\004\324P4\344\023\352\375R\036Z\360#*\372\t\035\021\361\222\214x\"\214\204\220xC\276\037oA\016'\215\350\371x\300\244$\037/-6=\267k\266\275k\235\235\006j\352 \237\260\367fI8\331\257%\254.9\327;}$\327\351\\\347\326\310\324\204\\io\361\361\247w\026\2262j\r\256u=\\q\\bU\232f\213\313\351\324"
+	.string	"\221I\030c\222\177\310e\206\227\234Ew\237zra\343f\323?=d\213\352Z\300\230\013\"7\233\306\365\360\310\007@q\232\355-\355\234\0362\316\246q\372\310[#/\222\301)\307 /.*Ti6\226<\377\337y\264\343jt\r\031K\332C\271Oh\250a0\242\224b\310\230\231\221\021\031\211\2321`\002\221bg\333\020XWDI:\024"
+	.string	"T\027\370\350s\037\372\262Z]m\262\213\334R\220v\223-%\322\343]\013dK\201\250~N\304I\020<\271|\200\304Z\034\025\017J\330H\336N\244\202\206\235RY\347@\023\035\025\260\001\027\ta\335=\2156\201H}\036\215\254{\236*\337o\343\235\232\016:n\276\263\\\354\227\341C7\255\005\370\351Q\215\225\320\227G\252]Pf\326W,\375\3748\316\375\354q\201\034#C(\357\t\342r)r\267\230\221\274\034\375<a\r+\210\242\002\241@]\"\217\344\263\bF+@b$Z}\364@\n*\250\367\377\031\323\375\005\f*\333,\216.\306u"
+	.ascii	"\261\2147\203\032N]\324\364Ys\331\243*2\226H\364e\306\363e0\025"
+	.text
+	.section	.gnu.lto_flashfsIdentifyStartOfFreeSpace.54.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375 \371\305\006"
+	.string	"\302\f/3`m\322\001\303\216\002\0041#\217\235\371\240\230dZ\245\200\251\227\266bZ#\326\205\210\302\276\254\216(\003IB\270`\311\366\205\020\324\254A\333\336[\312\224\002\316\\\242\006!b\0224\017n\336\302\006\243\3602R|\227\001C\206\003\3515@(=\313\265W\020\323\210\243\035_\231\336\223\302\311\220]\372\016\316~\200\310W\327(B)\373\242R+\354\263U\220\235i\366\364[\034\371HX\3670\331\375\204P\226\244\205`\330\236l\213\257\361\215\311\026a\327\205\025\220\361\341\3518\331\335\027]\300\275\261\003\2707\265\370\364\234\374s\334\240\003RRY\324\263R\260\273\316\312\232\270\365\004\266)\002\t"
+	.ascii	"2\003\316:#m\b\3055\361:D\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_flashfsIsEOF.55.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\355\006"
+	.string	"\362\f/3`m\322\001Pif\004\001\275\226\0266P\245\261\234\016\n4\265\332\002Pk\350\330\241Q\330\227\325\021e \231\201\303\370\251\355\013[a\200ol{K\231R\266P\340\205\001V\032.\356a\334\003\246\342\340,\023t\024\002?\210\205\311E\27479)\356\315\264\200\243\225S\257L\337\001U\021\346;\016\222\3605<\221\311[o~f\362v\r\250\340\344\310\216\233\324\013\373l\325\302v\232e:3\375&\340!r=4\262\353\031\2116\244\201l\330\276m\215-\371"
+	.string	"Ac\3521\3033\300!\352|\224\354F\247\030\247\236\224\377\317\025\252\020\211um\236"
+	.string	"\t\273\353\264.\212[o`\373\023\f"
+	.ascii	"2\003\3020j\270\026\244\200v<1\213P\204\270&6\r\241\303]\226"
+	.ascii	"f\303\273\356\r"
+	.text
+	.section	.gnu.lto_flashfsClose.56.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\375\n"
+	.string	"\346\223JA kj:\360\230T8\006\304\2006/"
+	.string	" X\254Hn\224\225\360sgL\300\267\260\253\322\355h\f\337\312\252\272\222\317[\261\262\230 \200 #O\330\364>\316\016\340AF\224\264E?M\310\226)\0058"
+	.string	"3"
+	.string	"<"
+	.string	"\245i#\034b \r\256\335\365&\204s\236M\345\370G\235\033\311\3163\310gF\361\002}\350H1\303H\340rPA~T%(\273k\035\311\320\255\335\366\206\355\013\373\032\001\3435_\263]\373\004#\254*\210<\032\263KQ\347\003\373\331N\222\255j\275\372\033\244\245 t\321j\227Al\304\262\264\016\022l\337~\312\356\336\231c\267\036\247\210\263\3630m\203\035\255\344\251s%\n\254\216\302\fb\203j4\177`\323i\221!\304G_\266\007\034C\370\330\375d\370\027\020\024x\2346\3335\235\234\352\252[\330\370'\033\320\350\003\266L\302KGX\001p\361>\214\027"
+	.string	"S\311x\0260\364&\021\177\0028@\217\300\367\201^Wz\236\355$\231+\211`y\246\370\321zX0a\313\225\\a\331\204\332\231O?\372\250\023"
+	.ascii	"3\2419\037C\216\3008X\376'[6\210\0064M\264 \220F\254\034\026"
+	.ascii	"\331dB\b\025\234E\335\347\032.\203\211\362r\205\270t1\333y\013"
+	.ascii	"\263\f"
+	.text
+	.section	.gnu.lto_flashfsInit.57.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\264\002}\025"
+	.string	"\026g\212J\260\022R:\342\316\344\030&9\315\301c\304\271\001\366\036\226\331\276\333\355\277%\033qF\2604OiQY\224\216\033\225\215\224\372\"\223\221\177*\025\177\363\250}\263v\013_\035:\233\271\212i\355\013\245\3271\332\366\244\021B\266L)o"
+	.string	"q"
+	.string	"z"
+	.string	"\367\177\017\336\\\311oB\241\003\252\265\2668\320\346</\017\033\373\306~\357>\234\363<\002c\020\351x\265V\331G\033\307\226}\\\231M\333\307\177D\325\004\252\307\263$\244\326:\243C7/\3225\375\234\213\007~\177\210\234UN9\237S\021\345\347\205\024\200\334)\222`\251 \361\244\357\207\334m\367\245Rk\365\342r=\367x\333+\266\t\3304A4"
+	.ascii	"\016i\304P\353Fs\354\323H\337\3510h.//\344G\005;\253\025\217"
+	.ascii	"!}\2467\305\370E\226\231\331\343f\310\217O\372\200\036!\227\216"
+	.ascii	"\367Cg\273\354\337\271\264\204}\261R!\033\266.\201\255G`k\031"
+	.ascii	"l\035+\327\260r]\276\326\257rM\226\353\361\265\026\3115\035\327"
+	.ascii	"+\256\177b \310Y\025\204\362Q\254_\r\321\305U\247\306\031F\266"
+	.ascii	"\003\024F\311\250\235\243\027-\031\034\307\213~i\347C\371HI:"
+	.ascii	"\002\331\321\235\333e\221\216\364<E\334\3407\034\224\265\336"
+	.ascii	"\020\3706:<(k\255/\372(\322\373\354z\f}K\025\024fQ\333HJ-(e\335"
+	.ascii	"v\210kPz`\267c\370\263\324\247\361\250\232\025\026\026)\223\265"
+	.ascii	"!D\330\343\226n\326\220\210\251\223\346\370\324\177\272\f\233"
+	.ascii	"\204\226\026\362\343^\341\266Hv?\201\264)T\bvI\261\301\\\260"
+	.ascii	"\3210\300\314j23\r2\264\f3\027\032\333,\305\304\265\r/43\016"
+	.ascii	"\265\032\315L\366\323\271X\251\220Ut\350)\226\320+\323\350\301"
+	.ascii	"\357\316\207\247\353\001\025X\037h\2360S\354q>\3601\246\240\243"
+	.ascii	"\241\226\200\275\213\373>\023\311L\332\343J\350}?\b\236\240\247"
+	.ascii	"\021J\265B\334\226\214\306\350\b=\021\356\2308\267\253w\035&"
+	.ascii	"\213\034\036\026\324\220\037e\364V0\032+)\0319 \200\002\021A"
+	.ascii	"7\017\363\320A$0q5G\226\r\321M\227\030\220\300\235\006\271\216"
+	.ascii	"\326\331\303\020t\032\003\201*\023\273\355\343\321\352\347y\036"
+	.ascii	"\200\261\300\223g\256\0020\020a\264\r\177\226\272\006\233\336"
+	.ascii	"uG\225O\334\245\302\0270k\336D\343Z4\331V\2003\216\200\277\311"
+	.ascii	"\323\032jl,\213\317\231c0!%\206kL\2542\034Q8\222\362\016\360"
+	.ascii	"(\f\032$\337\340\2154\250\215\343&$\347\256:z\265\013\n"
+	.text
+	.section	.gnu.lto_flashfsAdvanceTailInBuffer.part.0.70.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"&\027UD o\224\016\020\305\210aK44"
+	.string	"\017\"\3572H\373\331\034\2702\356\326\205\276Z\240\364b6\2340\"\204\244\b\036\321\250\232gv\362o\001\003\200,g\227\004f\32691\005\366\263\343\300j\215l\262wJ\001?"
+	.string	"@"
+	.string	"C"
+	.ascii	"3\373\274\007\333\234\207;;\305\353\267\025\221\222\t!kw\351"
+	.ascii	"\247\344\360\3562^\235\217\372e\225:Q}h\\>|\200\026\307\211\352"
+	.ascii	"\203"
+	.string	"\302\243\200_\225\005\273kK\205{\336\266\002\333\007\354\203\004#NO\271\202rawO\366C<\2643c<ei\001%\303\210\376\b\347\243\234\221p\257\031\030\f\231O\307h\377\303At\257\031\006\260\253\001\205\311nE\360i\003\226O\314\t`\237\327\007`\017\363\341\343\210\267\002\001W\033\261\025e\210\345\365k\345\006\373\272t\300]\257\225\262\031\246\t\021\2257\034\316\027\030\215\372y\235\224\023 k%\324\214mo8'_\274~^\202\257\202\254\335J?Or_\304\003\036\323\b\324`\372\243\331B\0166\317(D5\021} \362\220\350\247\264QM\001k\020@%j\322\264\022\315l\307\243\316\240\205\007\013\025\033\222C\312\220\0227!\305\260c\205\257a>\211\227h~\007G\330\342;6\354\001\" \200\002\031T\347\001\214\354\005\340\004TAcW \301z\005\370\220\354\021v\b@\362|\204_\fM\211"
+	.ascii	"\202b\257\217\027\034]\260\033TV'\230hwS\243\304\272\212\036"
+	.ascii	"\314\235\320\305\347T\013\315\224]\006@\355\205\236\266\245'"
+	.ascii	"\2741"
+	.text
+	.section	.gnu.lto_flashfsEraseProcess.part.0.71.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\301\001-\020"
+	.string	"\026\035gF\360\260(\035\372\371\315k\277x\231u\356\301\336\263\b\003?\"\324\212'|\207\177\334\341h\216\375^\023\200W\343\327g-g\253UE\357\260^Z0\330D\326\341\251\337e\344t\365\2612\327\216mE\204\354\275\245L)Q"
+	.string	"P"
+	.string	"T"
+	.string	"\223v\340\321\005\270G\317\343E\330F]p\312\246q\032\314\334b1.6:s\316\356q7<\365\bWe\312_y\324\257\345:\004\320r}\241\201\032\016\216\217\326\n\n`\305|\247]-\264T\252 \227[\311\234\323\\\206{\273m\004\266El\005\005\333\301U\203\311\274Xt\207n\314+\017\347\276\330P\315A\365\026\3252\252\243T\303\250^\250V\250\376\007\201\233"
+	.ascii	"\2609Y;rL\rQ\205\207\317\334\276\f\312\247\3313\343\017\b\365"
+	.ascii	"\331\t\316\327m\210<z\325\376\200R\237\235B\236#c\204\213\031"
+	.ascii	"\013\364\237\007\254v\305qw\345\036E\013\b\225C?!\342\346\\\221"
+	.ascii	"\370&&\234\3702O>\306\365\230\221x\t\257\301h$If\274\276\273"
+	.ascii	"\037\0165\\t\354\017\263SK\261\033\263\356\227A\315\213\225\356"
+	.ascii	"\330<\320\365\360i^C\362e.\251\350\277G_E>>\242\024\n\036\264"
+	.ascii	"h\304Cq\340\205 \240t\245Q\2272\n\221:\221\311\353FB\\\212pb"
+	.ascii	"\352$\224J\246\316\363}q\t\313\252\342\306|\222\376\212\2638"
+	.ascii	"\3712'0\321\177&\030b\350\344h\213\n\254\017\220[\234\1777~\222"
+	.ascii	"\334\226\333\267\300T7\333F\032\030!@T\256\255 - p\202\231\273"
+	.ascii	"\365\031\004\200\034\222\240K\236D\244\251b\021\027C \237B\364"
+	.ascii	"!\026S\260s\266\264\231\b\"\027\312\264c\336 X\221\230\313\342"
+	.ascii	"1\211\223d\003\264ci^\236!\333%\030s\\j\2077\260r\344\301\b?"
+	.ascii	"\206I;\240\021\210\220\360W\307\025nhm\231yK\026\204\355e\334"
+	.ascii	"\270cyA\033O\300x"
+	.text
+	.section	.gnu.lto_flashfsIsReady.part.0.78.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`O\001M\016"
+	.string	"\266Z^D"
+	.string	"\2576\035k\201\207\007$P\315j\323p\013<\033\216h\235\\\031\257{\315\341T\036\214k\b\303QHf;\233)b\340E\215t\003\305\273\254\272Ks\325\221+\027\274\n(\214.(N\327\223\266\267\224)\005K"
+	.string	"O"
+	.string	"F"
+	.string	"\035RdLs\206\327\345f\270vJ\306\325J\363\265\363\266S\007\037Y\230\200\321y\027.-<\002\360\270\3301\347\264<\024\335h\240\224\342\205\345qQ\200\250\245;x\245\340\205T7^U!sNoT\356\315mc\266\t\330o\t\352\030\325\253\276U"
+	.string	"&\300hN\321I\306\\\221*<\304tl!\202Q\t\027/.\223\0139\037k\034(Ks\202\304\213\311\367a\036~\036\302Kj\3412\347\374\334\007Ml\313>\261\255\313\203\360\007\210I\005\333\376"
+	.string	"9\261\366\220Et\r\001\013a%\264\233\367g\251)\241\330\375l\215\372\376\203\b\032Nk\354\313|\204\346sp\t\246\357.}\214\272\374\016\370L#\020\003HO\256\224s;\223\240\357|\360\tT\302\030%n7\335\317[=\316%\331VK\007\036\361\310H\026d\"\rH.\254s9\350\210\224\\#\236\354\362\3400\366@\201\347\212\200a\236\313z\234K\332\220q\245\345:\004\264!j?k\344\\\367\300w'\330\273q\2372\003\244'\271\337\r13+\342~3W\r\265;\f\364\235\006\037"
+	.string	"{\213Q\274\201\203&4Q\201o\224\214\212!\321\325E`\214\242\226\033vs\r \017\214p\305\3404\261\344.\200\025\314\030_\214\361&D0*\214P\341;\217\231\331"
+	.ascii	"\347\2025Q\\\307>\rO\241ySW9\006\332{B\031\003"
+	.text
+	.section	.gnu.lto_flashfsWriteByte.part.0.89.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`_\0015\016"
+	.string	"F\331[D\020\221\223\016\213\222\244\022\b"
+	.string	"\250\260\375"
+	.string	"\250n\024\343W\364\307\323H\027\227^\314\255O\250&RW\325\330<Z\364\310\306\363j\322g\243\225_G\240T$\207\277\333\347#"
+	.string	"\004:\351\206\360Pm{\357\235RB"
+	.string	"G"
+	.string	"K"
+	.string	"\216\273\246\024\214\335\252\340\323\b\254\317\353\363)ls%\026\3314^\275\325\234<tX\371v\227~F\022\027=B)\362_\037\200\244\033=\n\350>\034\026\270\004\320`wm\201\270\347mwl/\260?#&\324\356n\276j\345,\333Y`\300Hu\273\b1*\324\227\300\372\304~ \363)o \363\351\257\270\212}9\364\024sD\274\240\330\335+\004}\025\234_}\245\314\351pG\031\201\232\035\325\330|:B\233\323\021\035e$\321\304\216\362T\202\200i\267\024ccG\314\030&^\254a\243\352\2256k\257^\211\301\215\257\345.\016\301H\325\353\256\022b\205\372\226T7!\207\310\352u\017\\d\240\276\335J?\237\272\264\357\267x\213\357B\305mOq\354^|\001\231\206\017\204l\202\007\304\312D2H\220\356\340\330<(l\036\013\036T\373\320\013\037\317\007\355"
+	.ascii	"m\224Cc\r$\003Q\021M\003Qx\271\321\304\016N\224\300\2546D\016"
+	.ascii	"1\236\330\276\340\346v\205\017x\022\017`9\255`V\2448\202\361"
+	.ascii	"\304Q^n# `\002)f\267\003\357\006\221/\306\257\3007%#\3628\302"
+	.ascii	"\210!x\301\216\373\220\300\364\0318`\021w\241\201U>@P$d\322\021"
+	.ascii	"\256k\207\376\242\240\213\007\304\016\253\025\363\261\253\320"
+	.ascii	"H\360\375\330\255W\226\241\re\313[a\001\254\275\260\234\346\364"
+	.ascii	"k\303\030"
+	.text
+	.section	.gnu.lto_flashfsClose.part.0.95.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\004\002=\021"
+	.string	"\006\037lF"
+	.string	"\257(\035\357\377\364OX\300\314\230x\362\366'\313\343\234Y\253\205'\323\006\261\3626\266z\274\241\242\207\007`\277\277\005\236\032\252SL\255\341\253\327\377\366\377\247\322\272\203I\331\013\251\016\264z:\237\264\275\211\224)\005T"
+	.string	"T"
+	.string	"Y"
+	.ascii	"62\2349A\003\217&\320=n|\200|"
+	.string	"\344.@\276\026r\277\246\262?\237\307w\260\255*\361\312Vqpej\220\b_09sN\357q-|\365Un\345\327\256\037\n\326\3671\317\230q\245\020aR\341\232q\256\023\232s\272;\271\343m\207l{\266\222\004\207\371?Z\206\033\226\302\320\235y\271ssUl\251\356\244\272#\325R\252\243Ts\267\335\033\325\312\251\017@?\020\312\234\023\302\0273%\326\\\270\355\267\357{xL\310C\370\300w;x\027\037\306\246\372K\312\033\"\3404)\371p\020\253\277\244>)\314\223\254\0042\256\\\t\203\333\335\270\037\221\271jn\223R \322\303D\373\r\337\315ELwWK\274bx\364\021\244nN\021\004\376MB\207\317\002\"\037u=.\376\314i@|\026\227<\3640\017\371\370=\206\357\306!\326\322\320\036\265M\017\3640_\206\246\341\306\265,\231.e\026x\f\244\b\245\004\244\016\321G\347\021\b\305\261"
+	.string	"%b\300\341\231J\236\203\222\250\2017:\241<\220\206M\037\244\223\007\301d:y\037\333zn\256\212=\264\0257\255u\235"
+	.string	"?\213\341\264\344L\260\366\320\356\314v\267&\036s\375NZd5\224\226\206\356\254\334nO\363\212\355v\266\323b\204E\2000\f\303\247\0022 `\002!v\264\033\221\212\341\2770\007\007\307P\324q\204\346N\034\261\254\240\203\307p\213\217\255\002\016\352\221\nSkcf\331\2266\316\334Atc#[\265\304\022V<\264\240\216\3601\270\032\312\026O\017\2313\007\334\210E@\230\245\302\300cVa"
+	.string	"l\267o\016\334\005G\223G\005\\\223M[,\213\323\006hOYc"
+	.ascii	"\254\275\032jl\020\265\364\2040\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\362\004u\025"
+	.string	"va\200K\260\022r\016>\363=>\316R\233?\235U\335\330\356\310v\030\315\361\025>P\331z\2363\360@\262\250Ol\333X\354\354\354\\\331\341Q\177\250\252\252\252t\306\241\244\207C\313\253\375\357\237\035\313\252\2368Di\265\273B\f\304\022I)i"
+	.string	"n"
+	.string	"l"
+	.string	"_\303y\332\315\243L\345\243Ra\363,5?\243\t \316\274,T\257\013\003O@\346yG\270\306<C\301\230\2106F\301\254\227\277y\333\266-\357\317\320\345Dl1\305]\212\016%\367\354\024\342^w\203\211i\311\f\300\275\367\332\236\233Bg\356\365\026x\211\314<^U\275G\314\317\fU\242M\"KM\265\237\t\231Y\004\0229\322\307\265\333(\230\025\205\033}d\273Y\210\020\342\021\212>\002\273\327\023/\222n\354\032\236\177\031\236\2270|\317\205g%\013\257S\341w(<\317\204\307\221\3609}\357e\226Ex\206\321\020\376\346\301\333\204\016\276\246\301\323\360T\021\0241\030\274\314\202\217\361y\030\005\377\222\340y\b\336\345\300\363\r\001$b\317\267\360|n\347S\235\267\345\004\344\351\246*\236N\262\035JiY\021\225\247\377t\007\211Z\031&\212\273z'>2\265;\325"
+	.string	"\001\204+q\224$q\037\227\227\243\244\351\2353\335\303\252+}\003\260oR\f)\355J\217\001\333}Z8v\245\253\364\332\325\342h\253\245\364\024\266I\240\031[d\351#k\303\236\202H\271\322\373\327\341\212k#\304Hz\257\315A\224t\364\bL\252\261\324]l\207VL4|p\352\335{I\235\003L\352]\324\214\025\2254\364\262q\315Gz\355W?~O7\2327\3334l\225/F\363\016\300\346)\022C\256x\250\377"
+	.ascii	"\333MT=}\340\241~\026\365\200#,\244\022u\225_\267O(G\220\210"
+	.ascii	"\272IQw\333\266m\211:L]a\231\305d\036$5BH\031;W\334d\003R\250"
+	.ascii	"\241\220r)\0133E)(\225\016\240\002\231*\353\006\021`\020\213"
+	.ascii	"2B\004\204\221`f\202\321\240\003\354\301F\001\234\320(\226\345"
+	.ascii	"\263j!1*\316|\"\215\346!\031\224\303w\264\001\341\201 ga\003"
+	.ascii	"\204\036\337\306\032\"\027J\023\024\0071\225\n\301\005uE\302"
+	.ascii	"\346\2267\007SZ[\0161h\f|\252t\202.\342f:[4\335Jm\355\374\223"
+	.ascii	"\367\006J\222@ndZ41\230\325\332@1:\035b\036{\215l\223\031\307"
+	.ascii	"\305\361\376\320\177\344l>\027Y\b\023l&\034\341A)\271r\336\023"
+	.ascii	"\230\007\r\313\232Udq\304\363\007"
+	.text
+	.section	.gnu.lto_.refs.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"=\t"
+	.string	"V\330=-`E\223tp\307\360(\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\3224\374\267\302\200j\210f\237\320\f\250\206\260\246\177\023\333\bi\204\264\275\267L\001."
+	.string	"1"
+	.string	"2"
+	.string	"\353%\352#\331\033\366G\277\301\336Q/\232\273n\372b\365&u\225~Q\177\3147\215\320\n\237\311O\3313\373\345\313\362e/\366\356\374\016\b\355\216\316\324W]p\257\325\025\323\231\324\027$H\017\260\316\310\356`O\352s\365>7\320\r\353\210=\252\031\370\255\235~\001\326'\300\276\302|CzJ\354\035\352U>\203\237\260/\255#v\201ya\375\330\n\367\261N\372#;\002v\325\356$AG\360[\273\227v\th\207\375\3417\207\340\305\037w`\320\003\357`\375iO\317#\325\363\351\267\372\220*\375\372e;0\364\005\004h\367"
+	.string	"\260_\321n\n\374\211\354\022\330#\262C`\237\260\207\250G8\266\2430\206\004\021"
+	.ascii	"k\213\361\266\360Is\272-+i\264\363\211\315\370\302\"=\020\333"
+	.ascii	"\217A1\017\252o!X\242\024qSc.&\256\250\347I-G\004"
+	.text
+	.section	.gnu.lto_.decls.e1fbeeda2a3a294e,"e",@progbits
+	.string	"(\265/\375`J-%\272"
+	.string	"Z\016\325;W LI9\351\373cou\270\214k\356\231\313\211\314\211\254\236\277_T\\\306\331\210\323W\035\315]4\027cwomu|W\006L\363!\263RB\177\254\220\260\271\340\307\257\355}\235\313\242-\352\005\277[\222jh\242\344c~\267R\034f\214Q\346~\221M\357-e\n\023\003\240\003\324\003g>M\351\245Z@\027\2517\346\275)\b\020\034@\200"
+	.ascii	"\001\202\317\244g\252|,\313\365r\030\315\024\317N\216\273\025"
+	.ascii	"K\366\324%\032]\252\244''yC\257\002\346\"\363\223v#\315R\333"
+	.ascii	"3\326y\276:\317T\347\271x\236\004'wa/\\\366\201\277\234\333\330"
+	.ascii	"\3558K\351M[\310\0333(m/<\317\037z\265\331\344\017\275\033\235"
+	.ascii	"@\274\241\327J\336\260\345\303\331\2646%\254\2650\333\006\240"
+	.ascii	"\334,m\321x\255\204\342ed\f_`s\367^,\234\205\313\230\3556\025"
+	.ascii	"b\343\224\247\324'\307\333$\006L\2105Ph"
+	.string	"\232\314{/\210\016 j\335\335\217\257\236=\257\251u\240V\241AA\322\226\253\260\025.\313\200\257\034\004\021^\211b7\254'/I\336]\333\223p\276\311\031\3648M\350L\245\227\347\346IJ\333\037\241\363<\205\235\360Y'\357E\273\367^\320\373b3r\202\266\f\205\307\270,\210\243\234\245\260\331s\232\322;vo\372\223\263d\223CJ\333\rxC\317\006\235\377\311\376\023\346\212p\337y\016\352\375pP\217\237\b\235\3054\364\216\310\364\376,@H\017%mk\237|yC\017\210\t\207\005U#T\362J\2717\315\320\343f\311\004\326\366)o\350\235\254\241\227f\370\333\330\035HU\017=\177W\351@\002\033\376\316\361\202\204\223K\027@\331\0040k+ 7\300_/\200\224\006\216]\320\222B\213\204\366p\337_WX\373{\003\266\377j\255\301\337\034\372\003?s\265\005\275\341?\1775\361\267\206\356I\301\001\222"
+	.ascii	"~\366p\017\376\312\200\237\247\232g\210\204\335\316\003\360\327"
+	.ascii	"\f\220BU?\377j\200\241c\360\327\002\234\300(:\247\303P\023\310"
+	.ascii	"\214al\360W\024\372l\037q\210\202\306\371\371\205\317_w~\366"
+	.ascii	"\300\335\317K\354\232(\200\315)\310\300\317Zn\036\302\337ON\367"
+	.ascii	"3S\365\375L|\377\265\232\240\331\373\333\215\n\235\277\323\316"
+	.ascii	"\3637\035\2335\007\300\337qh~n\200\334\1775|r\216\360\035\304"
+	.ascii	"\261\231\237\227\367\360\367\003\306\334\376\335\345\347\b\210"
+	.ascii	"\371\031\r\363\235\277m\374\f\346\347\266\237\261\374\234\376"
+	.ascii	"\334\344\347\260\237\277~F\362\263\221\237\273~\026\362\263\013"
+	.ascii	"?k\375\f\344\347\036?\353\370Y\352g\344\317V?W\375|\374\031\306"
+	.ascii	"\317/~f\372\231\370\263\t~&\301\317G?\217\340g\027?\013\177n"
+	.ascii	"\3613\360g\244\237U\374\234\342\347\016\374\f\201\2371\360\263"
+	.ascii	"\005~>\361\363\004~\226\300\317'\374<\3643\211\237G\374\254\200"
+	.ascii	"\237K\370\031\204\237\205~\346\371\371\203\237E\374\247\373O"
+	.ascii	"\346\377\227\237C\374\354\301\377+?\203\370\337\3749\350\377"
+	.ascii	"\207\237?\374o\341\277\335\177\263\237\007\3603\007?k\3603\006"
+	.ascii	"?W\360\263\206\2373\374\334\363\263\317\317\377\377\346?\336"
+	.ascii	"\3776\377\353\376k\371\237\345\177\330\377\n\374w\373\257A\263"
+	.ascii	"\331l\376:\030\370{C\177\0067\002\235f\326T\250\234\2355\232"
+	.ascii	"\217\255\242\027\263\247\274\321\254\226\334\214\270;\236\030"
+	.ascii	"Uk:\332\336n\235\2672\242Da\345\315\254X\343\371\206\302MV\326"
+	.ascii	"d\254\354\364\036u\262`\024\275\230o\224L\372\t\223\026\353\335"
+	.ascii	"\313ir\352\330b8a\216l\235\265m\322\244\323\223xo\2214'\357\364"
+	.ascii	"i\254\030'K3a\316\327\364|'\341^R\326K\370\314\246\034\310\025"
+	.ascii	"\275\300\3561\365\340\365\310y\346\263\336\373H#y{\225\265W\203"
+	.ascii	"1\362\022\327\020\340\353\ry\f\372\373\353\r\306g<\367\006\240"
+	.ascii	"\315l\264\261j{:>\373\237\323\3632\205g\327\366\025\311\275\273"
+	.ascii	"t\274\367V\341\244\367\310\304\323c\034\356\341\312\034T\004"
+	.ascii	"\340\335{$,\206\323H\225\245\033m/\203\335K\314p\323{4\216a\021"
+	.ascii	"\215da\2502\244\227\307\005w\254\3075\246XT6y\373\246\227o\023"
+	.ascii	"\026\325\007\214i\362hL\223D\240\333\224$\336\233R\001\031\245"
+	.ascii	",\021\3318\206Ee\034KRe\270M\227x\307\226x\234MI*\343[\222\n"
+	.ascii	"\3108\266Del\302\242\312P$\214\2101\306]\030/\334el\272RQ8\226"
+	.ascii	"\216@Jc\232\274f\356e)\305{\344\340^\034\311\243\231\245\032"
+	.ascii	"l\205I)\305\204\266\224\344\364\336\333!\212)+y\233\224\306#"
+	.ascii	"\311{\2170\255\270Q\b \246\312\253\305Jb\017\034\027\252x/\006"
+	.ascii	"Q\367\022\371*\357\275\304{\257\357\210#\275\367\n\310\310\025"
+	.ascii	"\025u/\222C\324\305A\274R\274\267\245\300Y\2412\216e%\205\256"
+	.ascii	"\224\215q]\247\224\310\\\327\f\326\361\034#>\271PlN.*\031k:M"
+	.ascii	"\223\202\301\211\214\275r\242\265\243m\232\356X\321af\225\216"
+	.ascii	"U\200\374\222j\333[\275e\253\215\315K\023\031\242\326b\272@1"
+	.ascii	"\275P\326/\364U\211\364\022Y`\026\275\230\367x\364\340\235v\376"
+	.ascii	"\255\305k>pI\266\264m\037\375\203\313\316\326@XK\013Q\213\354"
+	.ascii	"\024\201\357l=8\016\007J\233\222\245,,\0358.j\236\260\376\346"
+	.ascii	"\301\\\310\356\025f[\236\344\016\353c\353\314G\333\367\216\326"
+	.ascii	"\321\264\343$\311\033-m\231\003k\350q\233\320\033G\265\222\245"
+	.ascii	"\210w\243\257v\242\356\262"
+	.string	"\324\264}_\375\215l\033MS\270\314\270\2275\364\232\206\320\273\306O\221\250\264\264\266\276&k\230\221\301OJ#\252\207\225\f\0366FN0%CJG\375(c\254\242*#\006MK\3337U_\236\036\031D\230Li\013\202\320\373\b\206\205\207\233))\002P\315\021\245\242r\320\226\030\341j\013\325elI\034m\337G\316\030\r\243\215\\\326O\335\364~\321\3057\2339\361\322g\t\35061!\335\372\251\227xYS+g\f1S \210\320O\315\304j>\304\364N\371\262\244t\230Z\220jN\373~\341\374\2007\364z6\316\267\325\3716\236}{y6\236@\351\333\2541\230\304P%\r\343\231\232\022\222\314;3K\243|zs\267$K\226\224\266|\327l\307x\347;v\303\323\304w\366\336%f\017>\314\036p\330\210,A\351\331\367\022\263\316\002U\362\300\352\332\370\234\244)\212\265\245K9\350t\315"
+	.ascii	"Bc\315yv\023\303J\037\234{\223n\\\\\336X\031\346E\r\263\3414"
+	.ascii	"<\30710\f\\\306k\270\314\331\f\237i\3425<\206\227\254\frB\226"
+	.ascii	"66\373\205\302\360Y\330[\bp\214\206\225R\034\240\366e\356\336"
+	.ascii	"T\210\3270\030\016`\252\262\213\330\215\253\312\372\245\210W"
+	.ascii	"\235\024\250\373\303\304\354\004d\274t\223o\307\221J\261\310"
+	.ascii	"\031\305\314\n++\313\263\3246\026\273S-\232RoL\3462\331\244\255"
+	.ascii	"r\351\241\261\322\214\253\\\352\026-\312KG\227\3325H`\350h\253"
+	.ascii	"\205\313\234C\310\316\350T\211\275\226\211U,U\f\317%\212\335"
+	.ascii	")\337\224$E\3320\257\021\031\344\363\244\006\313G\332+\226\327"
+	.ascii	"5\020D8\032\340\217\262\262\266U\355\254\305\246\314h\245^\351"
+	.ascii	"\222C\313cs\326*\007\350\034v<\360\250\350\004\tC\004I\333\256"
+	.ascii	"hG\323QjHr\264\255S\256\006\355I\020\272z\346%K"
+	.ascii	"\fS\333\032\245J\341\262\273U\263\373\2509\231\271\311\2357\001"
+	.ascii	"\337\255W\307^\311\324t\370\300\032\003\345\317\361\235-op}9"
+	.ascii	"\237\263%M;.\257\003\033n\310\264&M:u\303\345\223\324Rd\312W"
+	.ascii	"\222$5\354\265\351\352\260\343\2520\306b\210\261\3445,M\217U"
+	.ascii	"\223\233\222\276M\273\346X\216\216\257\257\216\343\220\254rw"
+	.ascii	"Ro\314\037\261.^L\332>\307\t\t\222^\242\221zc\346\240\225A\302"
+	.ascii	"\331\0311\322)\003\245Lrj\346z\270\2209\222u\346<\021\"\265\213"
+	.ascii	"C\262\302\275A\006\235c\200,\275\270^\273x\246\356\234\316\332"
+	.ascii	"\326\"\366\310\022%fm\353VOT\327R\224\263\315\270\262\244K\233"
+	.ascii	"\020!\035\307a\215I\321\213\351\004\244\212\214\212\226V/K\340"
+	.ascii	"\025\275\300N\360E\356\356\311\217\037\025\310IL@\332O\326\020"
+	.ascii	"4\270\n\204\r\t\034\223.\036\311d\355\201\304\255\350\305\334"
+	.ascii	"I\222\006d*\353\265\007[\n\343\311S\333\212\305g?mv;\334\332"
+	.ascii	"V\036=\344\326\270\273\021\364\023\243\254\rS\325\325U\325\021"
+	.ascii	"B\222\242\027X\275\033\3032\222\343U\207\217\023+v\312\266\025"
+	.ascii	"G\337\376A\344\307W\333z#\310j\305\3002\236/h\320\250H^@\027"
+	.ascii	"\036\227\317\\[]\224\032\257H>\273\310!\035\344\314\021\036N"
+	.ascii	"m\316jU\255\316X\266&&hejU\255\0222+z\201\341\364 R\006\225\245"
+	.ascii	">\325\251\372T\217\365X\241*T\2252\"U\364bv\f\034\312\0315\352"
+	.ascii	"U\ng\211ZZC\r'\253\215\\\025\262\363>\"\325\251:U\030\347\255"
+	.ascii	"\240\313\006\0279^q\253\306W\030whk;\276|7\352\213\372\242\233"
+	.ascii	"9j\266\212^`=c\224\034\301\322\366\276\030LL\335,q\363\270:k"
+	.ascii	"\351\306[\\%Vb7O\342\2314\\\027\211#h\347\r\215\224$W\362\362"
+	.ascii	"\272I\001\227\257\314\214\312\\N\025!D\3044+\334\227\262\210"
+	.ascii	"\330\211\207\327\313\022fE/f\005\363\204\\\026\251\253k;\240"
+	.ascii	"\313T\306\216\213\347I\223\313K\333\266\333\262*\302\326\266"
+	.ascii	"\231|&\346\n\256L/\007\035]\307q\224*E/fO1\327zO\347\033\006"
+	.ascii	"n6lZ\212\217p8x\347\271\245zsser\350\214\031\341h\2209\323\244"
+	.ascii	"\351\270J\346\255\350\005\346\233*\326\341q9\323rg:\016\016\256"
+	.ascii	"\3438\\i\016`\213\tJ\3338\264\363"
+	.string	"8`\347\230.3\246\227d\310\364\222\265\210 \203z^\2702\342h\273\274\313\3512\222\005\325\3668Z\347qd\204\t\303g%\256\315\202\302q:\333\336\326\312\363\336\253#\004\354\313[\311\343\225,\026\333\266\227&\372\300\230\201\201G\333\356\302y9]h\240y\323\266\337\316V\221uy_m\333mGl.\006\024\233\263\267\224\365\026\276c\246\033q\347\033\013w\226\262\316\302u\034\322[U\202\270\242\027\323v\251\353\255\255\361\262spQ9\337U\270\257\\\341\345\016\024\034Vli\026(\206B\264\005\027\212\222\220F\240h\360h\303\020\370\253FH.\222V\234P\032\266`ABhBxTD\324\333\300\006\032\020\342\300\0066\320\300\007\034\320\021\022\r\211\034\2404\f\376\0340D\2070\b&\251`d\342\002#TX\201\341\217\205\020H\024l!\003\211\026\206\350\211 \021\212\224\202\322\210!:\364\025!T"
+	.string	"\177\301\241P\004j\344\002\251\b\370\023\021\024\272\020a\001\022\222\013 0\t\350\033\242@G\360\023\366B\220\024\\1L\002\372\216\210P$\253\324\242\210\005\312\242\247\003\374\251@Gl@]"
+	.string	"\177C`R\n\034V\b\177\300\237\n,\210\202*T\020\261`\001\t\241\317\360\0074\241\302\n$\204&x\224\216~C j\244\2010\005\n<H(\005|\204)Pp\001EO\024\001\225N"
+	.string	"\r\225.X!t\201\244\302\020\025\036\035\2550D\207\200\0040D\207:\f\321!#t\030Lj\321\302\305\t\241\t\nP\025@\"\n\024\001\225\204(d\360QBB\207(R\013\026I)X\200\204\224\304\002\017*LBJ\301G\311\210\b\245\200\320\304\006\241\020\r\032\031\241\200\364#\032\356\bU"
+	.string	"\177\276\036\022>\350\216\006\241\020-J\n\262\200\n\211\202$\214\210\320\022)t0\370 \3040H\324\"\004\320\004\322\217\250\005\264\bH\004\002#\024<\b\217\212\210Z\234@\321\240\nG+\2340\002\376T\020\036\001\340E\277 \nDU\234G\300\b\007\030\241\004\021\370^\202\t\037\230\360A\357%\230 $d\302\bB\347G\020\252(\212\n\202\350\321\221\213\021\350\360\027\274\200oh\004Ds\204(\200I\277\341o\030$b\001\bm\2414\264\303 \321P\270\203\224\2244\002\005\316\360+B\b\203(\b~A#"
+	.string	"\240(v\320\026J-\344\bQ(\005\207(\213$t\350g\210\242G\350;\205:\350\b~'\220\210\206I\303\234!\212\021\204\202I\303\"\364D\020eA\210\252 j\341s\016Oj\201\006E\f\223\222\202\"v\206(J\360\t\321\241R\n\234!\n\020B\030\002\177.\316\013\t\245\260A\005$0t\026\205\020\036\255\020\022!\035\211H\372\211"
+	.ascii	"\376\210X\210(\n\nE\204\270@8\004\376,\020\030?\027*G\323\217"
+	.ascii	"6\033c\316)\315G\005\023\326\343j\313\366\260Y\347\024%d\267"
+	.ascii	"\"\261\021f\206\325`;WL\242\250i\313\325\030x\302$\273\272\262"
+	.ascii	";H\b+z\201Y\035\267;\322\274P\364as\364\324\210xUrX\034'\214"
+	.ascii	"\031\263a\221\035x\254\354\350\234\264\275\361\016=K\030\310"
+	.ascii	"\342\266N\213\354\3203\272\230\230!k\324.\244\016.Z\354\214\373"
+	.ascii	"\343\343\245\314\322L\333\363X\311\270\265\372YC\203\307\215"
+	.ascii	"\266\226\312V}q\235\235);\2324F\344\324\232\264\265S\366\030"
+	.ascii	"\204\313l\255\355\334\221y\204\t'U\261\370\244\226\334\375\210"
+	.ascii	"\252G\373d\237\252\233\234{TS\364\002\343!\236\277\215\241\344"
+	.ascii	"1\202\006\257\215\205!f\235\254S/\215r\347\2337\366\305Y$\252"
+	.ascii	"y\373\342\266II\332\322\332\222eJ\363"
+	.string	"!\004\216\314i\257%\322\330B.\355\264}\350\301cZ\021\302u7d\253m\315kb\020\270\250\031\234g\2011B\234\340\305\335\3250\2358\030jX\352\352\252\233\022/\344\230\257n\350\310\224Mv\200\234tt\335,\241\243\345\266\023\025\3032G\031\2211UMUS\327\\U\030^\327\304AI2\243m\235\343e\205\212\032\263\302K\256c\027\231\2734\254\354\325xq7\005M:&\347\346M[8\270\032\267C\226W\364b\306\3612\313\216\2710\325L5\323)\337cT\321\013\254\312Y\227u\331qYw:ad\032mH\r4;\306P1\263\021$KL/G\254\201\362\321\366\355\255\202\321\0213E\352\215\231C\206\204F\227.\257\001\204D\250\023\244\373<T\266N!\246FDFA\222\2441\303\024@@@L*\037\321\306\351\r\023\300S\207\204\322\222BG\206FHR\220B\232\003\177\242\220\2034"
+	.ascii	"Q\237\362\203\231H.$<\222\345\210\274\3446\334\251\301\372\215"
+	.ascii	"\326\330\355\375\021\255upV\345\346\220\t\245Z\221_Z\337\005"
+	.ascii	"\006\241\316\271\2502D\003\260\210+\355\232\326\224U\033\277"
+	.ascii	"(\231n\037\266\026V\253\351x\254\244k\363\373^XY\322\226E2\346"
+	.ascii	"\f\274\326\310\027\222\246\221\1775\263\277\211\301\360+\310"
+	.ascii	"b\ru\305W"
+	.string	"\205\262\337\226\264\360\231\271\256\340\223\034\013\364\363\230\275Jd\332T\311*-J\230\306y\3056\250\036\266W\345\r-\327\315SA\201\375\324\342\315x\344\324\274+\260/h\321(Z\261!R"
+	.ascii	"T\301v?\260\370\341\304\035\306\353V{3\005\037\nh\341\220+f\226"
+	.ascii	"\212x\270\224\240\200@\374\236\222\214\332\245z\250q\350\b\025"
+	.ascii	"\025\352\rq\366\372@\340\274\2077\020.\325&\322K\255\b\372u\355"
+	.ascii	"\034S"
+	.string	"\277*\276\006\006\305\215\027\006\322\334\331 \031t\310\nT\r\375s\276\362\357\020\376M\332+\216\335\271\267\217W\370@\032\357$S)\020p>\033\277\033\t\312\023\"\327w\344`Hda#\253d\271\264\260\002*C\310,\263f(\207W4\223\240/;\310%`E\263'\330\024\2555\351\177=\036\266\032\365{\255:@\302n\205g>]\357\211\356\nlr\030\244\257_\363\2377@\005A\212\005\375p\354\033\333\306\310\345\242\241\344<\350\213aJCl\243\b\\\270;\274/\340$Qn4\301)\370\355\3507\262i\030\270\327\267\243\300D\253\fD\243\006\231\266\211\223\324\320\212\211\253=\037J\346K/\347\034\220\274\240z\026\321\361\211\020\357\0043!(\002t\360\r1$y>n\331\352\262\2019\035\022\027\"2\301\244\337h\006~\021\262!\276\002Y\226{\262h\026\305\235r\t]\267Q@0\230\324r\206\375"
+	.string	"G[Co\314\034\320}\270\306\37411\304l\200\274Z\350\256\345q\303[#\351Ji\340\231:\017\224\\\nJg\353\317\266\017j\020\273"
+	.string	"\365\035\322\240|\024t\227}\252\"q\237\244B\223`J,\023\b\317\300\001\013[\030K\3526\331"
+	.string	"{>\r\033\233g~\317\244\365I\224 \201`\257\212\244\347\322\006"
+	.string	":\241\227b0G-\330\b.\240\272\2031\312\216\027\221V\005?H\224\331\304\347$.\233\231\007\030\252JBh2\2664\231\223\031"
+	.string	"s\032\244\240\357\331\245\250\301'k\340\216\200D\215\341\nVING\031\313\312\325^\350\276tzJ\r\256\235\325\355\243\364=*Ts\354Z\331>'\355|$\302\2327\026\242\217|@%\211J'\364\003\177\222\376\213\304\344+"
+	.string	"w\206\223eJ\0251\210\bz_\024\250j\314\243u\t0\332\202@H\003\303}(\346KX\321\310!/\355\245\337\215\300rGp\351\214\323g\037_\0258\331/\367.\347\213\274\327\037\032\201b\223D\361\254\005t\236j\037e\024\031\252\376\356\215^\222\303(\356@17\231"
+	.string	"\252\375\260\036\251\347\b\177(a\ta\3323\216\240\336\026Rv\263\001\002a\343\215\245\241\332\017\210\261\361\220\t\323\024\330\025r\241\276\302LD\263\3354\356n\023\373'\356\273\311o\263\232sT&&\360R\351\363\305\314$6bx#E\3655\362\034\331\360\261\361/2]\305!\271\206\360c\325\350g,t;m\013\003\226\300\212A\300\036\251\234\026>\242Y\220l\036s\033\201)\241\337\036\366\217#\006\275D]>T\244\261\315\323BOm\035\212\013+\276@5\305cO3\016\220TJ\204Jz\225b9\374\f\223\017ia\361\260\255\201\251\245U"
+	.string	"\262\0074O\020\3053\356j\231\375\245H\241(\244#\315IZ\322C4\274\036\005\200\205w\231\022\024\236\220\347\360\272\311\207\277J\354\336\213q\306@N\345\356B\366_Z\260\370\212,}\006\256\322\246\253t\022\bH;0\272'\226\205\016\f\237\357N\007v=\363}CmP\330\340r\361\200\265\221|R\302\344\267k\340\235K\374\356\b=|\363\37506T\353\266\001%\036\235b+[V\r\n=\363U4\023t\213Z\350(\005W\021\254\376\366\022"
+	.ascii	"\334\377\330|\201\322x\333&\216\223\260+\261\303\301G'\240\351"
+	.ascii	".\301\256"
+	.string	"\235\277+\372Os\343\227+\2509\265\214\342}g\376\315\376!\004[\275i\202\240*vO\374\365\376\177\3739\007\236\323@\313\323\2145\035\240y\023\310\311\350\244\225\256\205\213\214\364z\267g#\2420\034\\\035I1\234\377\022\303\017\242 \233\240\301\277\322\235\245\220\247?\325h\212i`\372\307O\374\274^s\327g\2173\003\210\314vIW8q\017X\2518q\232\245Q\261\344\243\237\343\235\2566\275\2678\370\250^8_\"~\376\311\377\257\017xW\271e\333\236\017\325O\307@)\f0p\331\244\363\235}\037~\005\353D\237)aa\261E\t\201\013 \321\004\200Hmo\304\275\243\276\300\330p\303\215\350@\374\313\240\362\321\317\215\007AF\254}\2041\272'\002\311\204\020\0318[\237\277m\253\225\335\352\324v\b\207M?\364\004\335\b\254\362\372B\213nT\265/\220\221\367t\020\324\236\003\035\243\327\321I\033\342"
+	.string	"\206f#my\177\b\233\370\276\376o/^7\261\376r\216*\336H%\212%c\013\317\037\030\347\037\266]\233\216z\364\205\005\350h\237a\201)"
+	.ascii	"\2330\026\017f\\H\027\016\320\035,4f\234\003i\020@\032&\256w"
+	.ascii	"\306\020\374.\262X\001G7I\224\f\302;\350\221\331vd\177\321V\344"
+	.ascii	"\t\371iU\264:\356\221\275b\324f\241\350\344\362\275\347\350z"
+	.ascii	"\022\216o\267\353\346\265OC\\\303 \306\241\216\340\234\304\372"
+	.ascii	"\325\370\307\333\030\\\243\302"
+	.string	"\312\361\276W\316d\360\f\317\312\311\243\375\247Y{+\322\275h47\353[q-V\376\206\342l\262\200\306\307\352\367\204\261+o\377:w\310\2368y\256\263\"a\235\240\217\024{\332\363m3oT\216@\340n\363\267\217\330\362\300\016@\235z\274\320\352!\340\333w\003\243\347U2/(y\323\355\233\317\311%\373\267G\n\344/\365\307\365\025f\371\274\307\034\003y(O;\234O>uG\035\035[\2675\361\241\345\355\351\033\355Q\371\201Z.\206\203\235\303\355\177\370\256\274d\016\376\031\230\013\201\335\364\213\366\356\3770\364\033{\334\3074\337\373\202\323x\330\316\024\303>\333q\271\320f\006\316\262\221/\352\"\035\366d[u\026\003\246\220=\212\350\364\263\017\033\272X\314\347\371\004YD{\346`\343(\002\343\370\3608z\362{\361y\306~\221\206k\332D\261\213\034\375\300\213nK\354\276U6\261\360\033\316\037\223_"
+	.ascii	"{^\2071\367\202\346Y\214\016\n\027.\b\033\020/g+\271C\307\r\231"
+	.ascii	"\253x\305\203#a13\0076\007\343\237x\262\263\317\305c\344\026"
+	.ascii	"\3567\214A\002\205I\340\345\372\221\356\376=\373\275O\267a\327"
+	.ascii	"\326\272\202s\177\262\316\346R\265\237\274\241\362\0217\177s"
+	.ascii	"\231p\317\223\327f\201p\304\302\206\177\275yq\353 \257\275\""
+	.ascii	"\375I\265\271\324\371\247G\275=\250\003\252\305\320xK\316Y\227"
+	.ascii	"\211k\371=\311\2071\033\006\257k\017\362\3179G\215\344\335\247"
+	.ascii	"\017\203\331\210I\377Ew_\317\030\313\356B\345G\356\033 \315\367"
+	.ascii	"wJ\236\356K\300\205\331\006\216\372\233\247\310\\\246\036m\317"
+	.ascii	"|\314\3479P\017\260\261\211\220=2\356\334{\341e\260\354\375\214"
+	.ascii	"\230q\347e\362\343\214\276\020\315a\260X\037h\\R\034\214\271"
+	.ascii	"5\234E>\020\016\376\257\256\377\354\372\022\035Z\216\334\254"
+	.ascii	"\233\217\241\374C]\311\234\305\234\302o\2217\200=4\f\001pe\232"
+	.ascii	"\312_$\017)\276\255\037\272\033\372*l#\254\263\033\005\322w\005"
+	.text
+	.section	.gnu.lto_.symtab.e1fbeeda2a3a294e,"e",@progbits
+	.string	"flashfsPoll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"flashfsEraseCompletely"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"flashfsEraseAsync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"flashfsEraseRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"flashfsIsSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"flashfsGetSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"flashfsGetWriteBufferSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"flashfsGetWriteBufferFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"flashfsGetOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"flashfsFlushAsync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"flashfsFlushSync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"flashfsSeekAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"flashfsSeekRel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"flashfsWriteByte"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"flashfsWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"flashfsReadAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"flashfsIdentifyStartOfFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"flashfsIsEOF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"flashfsClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"flashfsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"flashReadBytes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"flashEraseSector"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"flashIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"flashPageProgramFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"flashPageProgramContinue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"flashPageProgramBegin"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"flashFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"flashGetGeometry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"flashPartitionFindByType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e1fbeeda2a3a294e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
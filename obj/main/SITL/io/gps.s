@@ -0,0 +1,2752 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`7\n\365\037"
+	.string	"\204\037+\013"
+	.string	"_"
+	.string	"\254\240\363\203\f\b\002"
+	.string	"\001\356\370\341\314\n\022\002\001\343\350\227\330\0028\002\002\002\003\002\002\002\004\005\005\005\005\004\002\004\003\240\342\234\212\n\004\005\262\201\324\367\004\272\001\002"
+	.string	"\002\006\002\007\002\006\b\002\t\n\t\013\n\002"
+	.string	"\002\f\006\r\002\r"
+	.string	"\002"
+	.string	"\016\002\002\b\002\002\t\002\016\n\017\002\002\t\002\017\002\006\352\263\360\321\b\007\b\t\n\013\r\016\017\020\021\022\023\024\025\026\213\326\277\344\004\027\030\031\266\223\317\244\r\316\001\020\002\020\002\007\002\016\021\002\021\t\022\007\002\t\002\032\033\034\035\036\037\334\307\272\354\tt\t\002\t\n\002\023 !\"#$%&'(\337\367\374\374\n\232\023\002\002\002\024\025\002\025\002\n\002\026\027\002\024\023\030\026\031\002\002\032\030\033\034\035\002\002\036\030\037)\207\245\203\341\004*,\352\301\345\224\t-\234\247\312W.\341\313\326\317\016/\321\314\377\240\0170\223\222\223\260\0076 \002\024\002\002\002!\"\002!\030\002\0231\371\335\301\245\t<\n\0242\265\244\343\267\f\0023\307\333\345\224\001\002\002 \002\0034\370\262\277\340\b5\204\303\374x\0236\262\273\233\244\013\n7\306\311\227\362\003\b#\002$8\246\364\354\201\b"
+	.string	"9\322\277\262\337\n\002\002%\002%:\315\343\301\244\013;\377\331\231\340\001\020\002&%\002%\002'\002'<\234\204\226\332\f*(\002(\007\016\007\002)\007=>@\331\351\335\210\001ABC\367\267\354\225\001DE\242\365\310\247\017\f\007\002\007FGH\347\342\204\262\0134)\002\t\002*\007\002+),\002,\002\002\002IJKLMNOPQRS\355\211\310\217\002\016T\202\373\227i\f\002\002\002UV\270\310\203\214\001N-\n\003WX\243\334\230\230Y\237\326\370\247\r\016Z[\\]^\254\234\226\223\006_\364\312\240\315\016`a\240\342\234\212\n"
+	.string	"\201*\250\301I)\031!II\n\033\007!\005\f*\310\240u\003\022@$\"\222\347\f\201LD$\210$-I\255a3a\335C\bp-\304\303\243*\302Ez\002\240R\273\004:\374\230!\273a\036\365\221R^z\305.^j\336\001\027\314dL\272\016J\246\017\370\374\312R\002)2\340\247/|\346\201\016\215\n\334\007\323\006\234 "
+	.string	"CP"
+	.ascii	"\303\026\303\267\206\313&5\347a\024\027\027\025p\230%;\367N\353"
+	.ascii	"\230\206u\256i0\226A\372\222z\342a\005\211\227}<N\354\353Zo\021"
+	.ascii	"\233\311\223\213\022\2663\346\t\276/Fb\022x\260e\f\"\230(9/\205"
+	.ascii	"\255Z\252x\266)\005(\252\2057\377\235\231s\300\223\322\257e\305"
+	.ascii	"\232\220HO\377\217\242\371f\203o\262RT\021G\340\247`J@\030\307"
+	.ascii	"\307\346YDB}u\257\223\333+\203Gb\025R\355\230Q/\2763\177UW\227"
+	.ascii	"\374\236\343jO\026\256\016N\377\264G\t\212\322\367|Wv\2618\214"
+	.ascii	"\274\351\276\341w\016\026\340{s\344S\244MK\306f\364\357\373\372"
+	.ascii	"\377\326=GG\3175\375t]\231\310\314\353\330\245\353\306QSA\314"
+	.ascii	"\277\244\220\2178\020\265T\324\224\340\374\226\250\f\236\035"
+	.ascii	"\371S\247\364\004\263\254DF\244P\333\206OX\2034\3602\224\277"
+	.ascii	"P\241\377\350^\312\341jy\2276\214\374\252\226\005q\016\357\325"
+	.ascii	"\347\333r\3035\234m2\376\310\342\377\032&\266\356c\300\353\332"
+	.ascii	"\"\270\354\253\261\226j\345N\275\333\267sB\252Y\320\303\274&"
+	.ascii	"T\210M\202\211}\006\345>\333\227\230\304\022\343\361\204Ux\t"
+	.ascii	"\006%B\213\237\335\271\363Ap\331\360\303\366\257\274\361c\236"
+	.ascii	"\355&tp\236N\232\267q\345\001\205LD.2\247\240\205\3717\253R\005"
+	.ascii	"\302\036\264Y\254\277\353\b\216\031T\3621\344v;t\212\3444(\320"
+	.ascii	"\370\317F\320c\304'\t\017R\036M\301a\n\350\001K\017"
+	.text
+	.section	.gnu.lto_.ipa_sra.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\r\001\255\006"
+	.string	"\302\307\026\033`W\032\003 =\020\004\t\231\341\3746\225\374\234b\271\"q\003\301M\310\2262\245\356n4\272\231\307\\,\025)>Q\003\237\316\244\"\216\231\275\224\264\262`\007;\222\030\371!"
+	.string	"W\323/%\177\254\034g\303\276\031/\024\211\021n\320\233\240\013\016\332\265Uy\276[J\320\347@;7 P\202q\256\314\003s\004*J\001Ir\212\nK8\322\210=D5n\024X\235\025\272a\265\215\221\373\223\302:\035\313Y^\313\030\n\2168 \330JL\222\003V;\r?\332\\"
+	.ascii	"\035\274\306\275P\374iD\246\315u\254\275\211\302\233Z4z\200\""
+	.ascii	"\360#\230*\030-X\007x\311\005T\344A]e\034\031\263\231\375M(\200"
+	.ascii	"\253<\342\342\375\032&\200#\003VpQ\206"
+	.text
+	.section	.gnu.lto_.inline.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`x\t\225$"
+	.string	"&\363\257I\240VN\032\003\260\347\b\205\301\020\236\341\2769\346\034\332\333\221C\217\360\214\240b\344\247|\261\303fd\375\326\366\265\013\343E\307\374\030\313~\364\213\261SZ\007O\340Ox\301\332J\003\357j\303\327\253`\367\0262\244\221-w\n\221"
+	.string	"\226"
+	.string	"\243"
+	.string	"J\243n\203\206y\372l\222&@\261=r\263]\276\234cd\373\005\214\177\317\370>K\243\311\f+\302\376\004Z\025NjT\326\032\260\363\034#\372\007\020\237grN\316\263\343\304{\266\326Z\255j\255\270\377\331\023Yec36q\347\373\374Y\261\254\2621\232'9\331[0\026`\303\361r\036\025[+\262D|_\336baI!\343\345\201(\021)\\\224p\304\277f\347\37495kVh\376\323\004\323X\263A\223>\201h\032\027U\025\202\247\3716\";D\267\340\370>j\225\243,i\202\215Cf\315\006\215\371X|\372h\224\037\222\245\267|\200\207\256\255\255\251\321 V\332p\321|h\224\260Ki\016e\n\374\377\304\321\371\334\315\347\270\207\331\377Y\267\212\225\254e\355\331\035\265V\003\343\306\371\026\211\232\n\242\031uy\271Cs\347t6\354\210jk\337\2215\004U\233rD\313\370.W\337\355"
+	.string	"\305w\357x4X\345\tm\215\316\325y3(\306/Qk\375\375\355\327\355\254\022B\025\004\310\324\255\320\337\200\201\202"
+	.string	"\323D\016v\2568\365\241HZ_\300\004W\020\035P\337\336\246P'\314\030\033\217z\025A\tK\241\223\332\024\002K\020\247okX\201\332\272\351\250a\245\207\314\316,\265\016\305\034\241\256\310[\333\020f\217.\325:T\376 ELo\323px\355\300\215\363\033\277\207\256\026.2\036\267o\200\343\367v8\365\343\214\304Nt\345\314\311F\266\241\317\371\362\313"
+	.ascii	"\030\032\377g\257\212j\013\rMN\244\250<\\\2679Fs\337\006\271"
+	.ascii	"\200Lm\214]XfE\311\224z\301\342\242\216\250\263.\236~,\026\304"
+	.ascii	"\"am\221\355\271\003o\227\260\243 1\273\220\311\022\023\230?"
+	.ascii	"\360\326\253I\323\031.\t\225\224\323m\0170;w\013%L2[\312\324"
+	.ascii	"\205&\234N8\"\226)\251\013\306iw\370IA\251\232\232\271A\312b"
+	.ascii	"\225E`\016u\254\"\203\353\311\313\033~h\260^\335\230D@\373\203"
+	.ascii	"z\352q\2213\324\222\3040\253\226\326\327\220n\237"
+	.string	"\372\350\212\254\"\035\271/<N\362l\21725\231\ro.\255l\256\246\315\006Mc\264Y\241\251\r.\262(\035iA\227\313\275e\371\342\346\221\223\344+.\276;\223\316H\n;\002\360=\372\342\013XD\203\2334\200\331\2501A\243\210\214\215\214$IR\030\326p\002\231!\032\253\007\022\240\004=\207\322\216943\232\024$\373\037c\b\003\362\320\347\204>\224\252\367\313\276o\213\303*\334\373Av\227/\371N\367\354\364\2273#KOk\230\024f4'\0305\321\203y\252\2137`J\003\250\263\304x\232\373\021n\354;\361i\327s\273\337\257&h\020\345I\365q\240r\202\005\231\314\265I\257\231.\241\002\221\205\254\242\005\353a-\030\352\240\355T@\0354C\220\237\262\326\3646\336\241@x\253/\351\003\230\201\342\336\307\344\036\336\231\f\323\210F\351 \340\273\314\314\371\303\032\270<\250\004+\022\205\275/\220%"
+	.string	" "
+	.string	"\274\270\332\254\346\016%s@\232 \261\343\026ys\301NH(\323\016X.\304\263\226\375\305\216/a\233F\306\334f\232\250G\361R\333\264(\236:kHA;1\220\303WX\233\243\207UN\257\021\275\017\245\347\205-NM\272Al\32511\004\331`s\226B\007\026\230\1773e\005\210%\301\306\301\237~Q*\301\227z)\277CS\302\357 i\313\247}Z\254,p\364\021\371\207\266'0\217\367j\036\263Q~IO\246\370\375Z\371\232\224\037\023\276\260m\025a\026L\241\315e\033yxL/S\341-\217\360\026}\364\217m_\317\225\304Y\024\364\350\034\244<\207\376j\f\361\214\376\222\277\336\0361F\302\230\220W\r\257\232\r\356\300f\203\214\265\316P\205\211\\\031"
+	.string	"\003ItRA\025\336\"]\272\006\3422\274)s\r\315\217\265\2754\b\344\204/\343mZ\024\227\004\272\310\252sX\017\223\3568I\377W!i\177\314\212\004u+"
+	.ascii	"7\211)\342\260r\2010"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`)\013\345\030"
+	.string	"\346\236cB\020\221\223\0160\3046\024\032\303\346fR"
+	.string	"l\370o"
+	.string	"\001\300@"
+	.string	"\240\330v\017\255\320}\271\356\312\367\361q\"\256\347\345\241\026\2746*}\263D\331/\330\027?\216\023\335\t_\375\243\231\204\264d\247\224\002E"
+	.string	"M"
+	.string	"T"
+	.string	"Vv\333\203nv\273\366\371\246\361-\302\016\341\333\262\020\335\023\3706\317i\357\255.\n\274\275\271.\253\264\023\004\336\315W\251\272J\271E\023@\b\025\206\236(\017=\375\344\240\361\306\241g\237\035\373E\320\nm\007\211\255M\370\032\360\316\271\001\037\362\333\230;9\340\263\003\276\351"
+	.string	"m\257\272jg\333\266\315Y\222\206@d\332\003\236\002\035\253\351\301B\031\344\376\374~\277\332\304\227I\271\253\252\375z:{s\013\244;W\302\330\001#\354N, ;\207\363\003:3%\265\332\f\215\206V\243$o\034"
+	.ascii	"\214A5\362\004=G^\220\315\306\005O\240\300\233AX\203\360.\235"
+	.ascii	"\004o\315\006>m\355\006\256\334ee}\376\333)\336*R\2335\275\031"
+	.ascii	"e$\252HJ$em\303c\260P*\031,\324\007\344\260~|\304\\\345\016\033"
+	.ascii	"\345xdW\311\365\260Wz\327%\3120\354a\357\362\224\3431\022\225"
+	.ascii	"\\\244w]ota\016^N.\037\003+&S\013K\204\227\026\023\026\346dr"
+	.ascii	"1!\205\266\023\254\302N\341\333~\341\177\004\023\022\362\212"
+	.ascii	"$\264=\325\344AM\215\213\026m\003\226\013\325\311\323`\344LK"
+	.ascii	"U\f\263\320dxE\006\200\267\2501M\245f\206F\n\222\224:\200\002"
+	.ascii	"\021\262\242q\003\022\340\203\025C\301\034dH\021\203\210\210"
+	.ascii	"\310\004\022\210\210D)H\201!\215\001l\224\200\2028\036_X\020"
+	.ascii	"\336?W\335\344\234kc@~%\b\202Lgsr\030M;J.j\213\314\203\276\333"
+	.ascii	"\220\344`1\325xvB\303\346J\343$'\307h\273n\267\321\277\267e\216"
+	.string	"\266o^V\367\367\270PX\007\004I\252\377\021\020\205\232\312*J\330\210vF\266\323\020\021m\314\321\215[\3402\002\300_'\371\035Z\310\326\372\351\210\345\320\017\003\241[\356Y\304\bD\020Y\200\332\335n\005\314\370\226R-Q\263\034&1\0223\244\371\fM3r\307\324|\270\364\375vi\031#y\3015\177\263\324b\350\217\205\025\234\273&\353\006v\"E\001\363\222\205l\177'cb\261F\323Y\331q\024\236\\\207\373\220\363\356\315N^\261\250\024z\24584\241\272\335\373\017\fGw\302\215{\020\333n\232\204(b\030\320N\316\020\2500\033\276\331\270\266'\335\275\365\260t\341/\310k\224\371\241\031\024\252\023_\353\303vs\233\230K\302\021\352\325\315\352\247\377m\205\3268\033ag\277ln=\025$\305h\236\236O_\372\007/y\200Es~\372>\267\326U\255/T2_\2313\240:l\315\206\200\211\307"
+	.ascii	"<\330\\\2139\\\371\222P\360\243\247\307'\032\215\200x\007:\340"
+	.ascii	"\345\375\365\f\264\226H~*pP"
+	.text
+	.section	.gnu.lto_.pureconst.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 Vm\002"
+	.string	"bE\022\035\220\3310\006\357\366\220\307@\356N\265\320\253\265}\373\241\273d\373\241p\242\352\2047\221\001\276p\205\216\204#\374\340\005'\370\300\005^\300\001~\331\260\274J\006\345\223K\0369\344\343q\307k\274\305S<\361\020\317\03033\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`.\001\335\b"
+	.ascii	"RL&+\220)\031\0160\377\377c\315sww\243\376\203R\372\324\254\201"
+	.ascii	"o\273\007\253\326\003\377\321&wg\3445\235!\037hd\223M\244L\001"
+	.ascii	"?h\342\230\237{\320\3045\021\020/)%\377\224?\n\363\2413R\036"
+	.ascii	"\351|4\251\n\023.\303\304\037-\031c\214\261t\243\274\241(\212"
+	.ascii	"\262\326Z\312\341P\216\360\201\243\034j\r~Y,\236\255\343\250"
+	.ascii	"\312J\005O0\300\367\363y\0270\021E\221\304\223Q\316\350\263\241"
+	.ascii	"\223\241\034\322\245\275P\201\ti[kO\207a\3717\025\211\242\257"
+	.ascii	"\001\276+: @\002\244 3\017\024\2407\334\032\037:b#mc\265\243"
+	.ascii	"y59\213\320\354\"\263!\360`qB\347\343\346\270\n\217@\230\313"
+	.ascii	"\305\335\210\355\271\027t\273Bpc\264\206\027b\270\203\031`\033"
+	.ascii	"\303\026<k@`F\260U\243\320\320U\217\221\\>\304\256\370\013\f"
+	.ascii	"W\036f\314\264<\303W\312\225\265V\222g \013W\273\202\266\203"
+	.ascii	"\030\266\305\007\022O\033\f\315\020p.PnT\214\300>\217\271\""
+	.text
+	.section	.gnu.lto_.lto.a92a11effc6ce750,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.35.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\203\315\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_gpsInitData.61.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\305\307R}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\330\306\002k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\230\306\002k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\330\305\002k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\230\305\002c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.62.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 \306M\004"
+	.string	"2G\032&\200K\322\001@\\d"
+	.string	"\243\016\326C\006DQ<\322O\374j\232\036\227\004\252W,\034b\350\332@5\265I#D\246\022\314\275W'\224\356E\020\225*\214\246xHMGT\326"
+	.string	"t\265\320\371\031l^\021|\201\346\02283C\274efM\367&\207\277\372_\334\304\220\341\360\366T\200A1>M\351^-S\326\242\276\374O\r"
+	.ascii	" \023\220\t\310\004d\r\006\001\231\200L@& \023.\271\242\030\233"
+	.ascii	"\323\256\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxSbas.64.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 \334\345\004"
+	.string	"R\210\037+P\345$\035(\202\2537\253\004\022H \001\003\352\2145\263\273P\363\034\344\314\314\264\031\0351J4`\205\354\325v\032\220M\032I2\001\212\266}\017L+\200\274\214\241\016\300\275\201F[\353\023\330\264g\257{\376,z\264\351\323*\306\255E$\261\212\263z\200\347\250x\352\002<\033)^j\030</P<t\r\340\351&\274sN\274#\231`\331\305\3428\335\224wVZ\203g\021m5\001\f"
+	.ascii	"/\202\240\334.\344\003\345\202\254\301 P.\310\032\f\002\345r"
+	.ascii	"\250\374\006P\004"
+	.text
+	.section	.gnu.lto_ubloxGalileoInit.65.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 Ve\002"
+	.string	"\344\003\004"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"'\002\002\177"
+	.string	"D\265b\006><"
+	.string	""
+	.string	"  \007"
+	.string	"\b\020"
+	.string	"\001"
+	.string	"\001\001\001\001\003\002\004\b\003\b\020"
+	.string	""
+	.string	""
+	.string	"\001\001\004"
+	.string	"\b\003\005"
+	.string	"\003\005\006\b\016"
+	.string	"\001"
+	.string	"\001\001UG\005"
+	.ascii	" \b\b\017n\274\322\006\006\340"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.71.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 \217-\004"
+	.string	"t\007a"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\303\374\263\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\024\236 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.73.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 P5\002"
+	.string	"t\003C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\n\177}\001\001\005\001\006{y\001"
+	.string	"?\202\210\200\300\001wu\300\001s\277\001q\276\001o\275\001m\274\001k\274\001i\274\001g\273\001"
+	.string	"\005"
+	.ascii	"/b)w/\026RZ\301@\021"
+	.text
+	.section	.gnu.lto_gpsInit.76.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\021\b=)"
+	.string	"\252I\360\017Cp\336M:\363R\\P\361\372\220(\216\330\2458[\243\311\317`\037\220Z\254?\331\207\207\016O\310h\354\365\003\332p(t\356\0350\335\265\215\3239\354LQ\234\024\342\005\033\031+\tV\370\315nB\244L2\355"
+	.string	"\340"
+	.string	"\360"
+	.ascii	"$\320\324JUW\250\252\225j\260\234\370\357\276,\205\236\271c\002"
+	.ascii	")s\017s\343noy\274\270\345\227\334\226X\255\265\367r\227\307"
+	.ascii	"n\357e\237l{{\261\217\321\023}\274NU\021\025\361\302\323\247"
+	.ascii	"\326\"\205\227\013\201\367r\213/0_\362>`\276\\\272\013\367\342"
+	.ascii	"\224z\2632?\306\314\325Z}\335\265;\246/\"\342\355z\323\250$\233"
+	.ascii	"\351\376\351E\306\223^D?Dd\005,\263\264\257U)!\007\264u\211\302"
+	.ascii	"\373Z\025\226\024\357xI\336;\331\227\274\b\371\201r\205\365\031"
+	.ascii	" K\222\033\221\036\306\302\274\276V\305\204l#\2317=\253).\311"
+	.ascii	"\r]\200\234}\255j\t\3313\023\004v-UYLj8\233\023\243\203r\225"
+	.ascii	"\365&5\230\261BC\262\212\"\217\270\300i9\331Y\210U\220y\367\241"
+	.ascii	"\326\272,\264\272\372\036}w\331v\027\303\356\256O}\262_k\215"
+	.ascii	"\027\265`?\355>\204\322\357\204`\343\2323'\327\240_\266K\257"
+	.ascii	"\303\264\306\200\204q\nx_6\242\004_\330\240\027\\\321\251\005"
+	.ascii	"_\266&Ng\316\356\230\306`\276lQ<\316\017\316\313N\2729\363F\030"
+	.ascii	"g\200\013|\343L\n\177\361oX@]\270os7*V\260\330\263\230-\\\360"
+	.ascii	"\205\313k\264\324\246\372i\217\346\273/\256&\215\235;aLs\027"
+	.ascii	"\306\321\230\316\312#\333\334\177sW\306\315\374\220\246\324Z"
+	.ascii	"9\354\313\334\254i\377\365rk\334\340\013o\314\227'\273"
+	.string	"\204-larP\\\267[\fr\017\331\240Q\025\267\271v\233\367A\363:h\336\006'~\223x\274H;\336\243\3465\232\274\275\222\267h\362\022\225\274\274\222wW\362\316\311[\226\274d\311\333$/7\3573\034Lm\316OQ\330\212\016}Svwp\025\355:\340VkT\207\227\313E\230\212z\221U\250\225ie\276\234\355\363\"\222]\366\177\034\202\342\272\035\362\343\t!{''\210\216H\326Z\353\216\303Z\034*\275\346:\363 ?\003@\210\266\030\n\223KB\323\3723{\270\177\233iq\2651j.\362\277\331\275\240\253M\314\234\356]\031,\365#\300Q\302\270\377&\331\335=\320\220\231\332\nr]\327\311c,S\366p\357c&5\202.,\023\230O\263\314]\nF\271\360\205I_k\332\250E\365\323\032\371H\311!{\330\246\364C\206\034\364\217\273tB\203\216\016\216k\342\202\002\361qQ\374O\334Q"
+	.string	"\235 v\272\207|\372er\307\020\363\026\305\203v\227z9\037\372\205Wk\024\207\375\236\303Q0t\214\222Q\262\371\222\273<\302\321\021\337\273 \236\007O\237\355\210\022\001\277\246\0318\200J;\234\200't\344\370\035-\323\005\0359~>`\223\017G\023\214\033>&'\035\276\013\004\026\230C\206\223o\007\020\350\344\353\025\241\336\\\373\001\252\203\306\"%\356\302\\\036\364\215\273\304`\254\305\370\300\270&\030\013_\271qQp\225\037\022\025\343#lI\013\266\231\211\213\340\026'G\004\234H}\343\235\247?u\336\220zY\nw\001\367_K\203TJj\276\374\036a\234\007\336\323 \263O\205L\243\366}O\211L\256?\352]JE\255\370B\244&kV?\031a'\364\b"
+	.string	"7\013nG\335c\313\n\r\336\242Ix\313LX\213*YB\265\264\346K\243~\332\233\232\242\356e\321\341\353l\260\022\332\3656\254\242~\035\257\211\220\034\341u\323\371\022\333\032\253\302\353a\317\356@b\360D\361\240&l\344\307c(\021\364\t\257\326\272\353\243\275\021\241\270.\200\216\250A,\006\2352\f\231\210\004i\222J:\240\002\021!3z\021\020\245SNYI\265\236\325\322Q\255\375fL\276fv\370X\033\212o\323\004\215\372\226\n|\302\312\243\364\031GJ\362\017\220\227Wb\244\324\241\346\313QU>\205M\036\257\370\005\202\b\210\200\007\003\236\214\204t\211\b6\310a\206\313`\2047\272\026F\217\256"
+	.ascii	"\365\202d\007`\034\363d\213v\350\313\211\\\273W\240\3026\247"
+	.ascii	"\350\224g\310~\267\206#\270P\202\276\007\032\006\226\021)\024"
+	.ascii	".Wm\241\227\247\nN\3761\350Cn{\236\004\360E\262\342\331l\315"
+	.ascii	"\310.\215\013\267\254\334\367\003\217\253[\026`\376\364q\217"
+	.ascii	"\231^\205E\261\024\365\216\347\265\371\\\324\031^&\006|\\HS["
+	.ascii	"\323*\330\355I\273\253\360&z\350w\017\2301\340\223P)\302\366"
+	.ascii	"i\362\243\\`tk\017\230\021#\2433\242\356\311=\340E\365\r\315"
+	.ascii	"\312\255\257\367\232(\006\274&c;~\316b\377\027\374\034\326{x"
+	.ascii	"\022\030\005\245s'q\373\325\253\263\305K\305h\360\324 \277\242"
+	.ascii	"C\250\001"
+	.text
+	.section	.gnu.lto_gpsInitNmea.77.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\224\t\225,"
+	.string	"\232L\264\020D`\250Q\007\373\270\022\tV\211\005P\246\364\277\242\314\034\200P+ \213"
+	.string	"\250\306G~\266\211\016k'\311}\317\021rv\305\250[\316\222\317\227\231\370\357\365\360\330\001\242<\325!\007a.\314r\267-\245L)\005\356"
+	.string	"\352"
+	.string	"\005\001\367\373\206\277\325\373m\273\337)\376\306\367\373\336o{\277\337~\373\203\001Vs@\204\345\274#:(\223\3415\\\276t\247\231\033\357\342\315\356\\\317pfcb\024K\3169\347\270{Fw\316\361\373W\347\332\2678\227\325\227AUxT\303\200m\241\345\314d\340\270\231T\307\005\234\227:\276n\224:\356\265{\2173\261\262\203e\325\370\022(\347\374\263N|u\242\235n(\207\273\251\266\024_\373k\273\320\211\232\356\310\235.\331u4\362C9\247s,\342]G\"\217\033rs\372\203\241mQ\2526\247s\f\222C\326\370\324\225X\035q|{hj"
+	.ascii	"\355\220\305\313\333\021\305\230C\022\377\336^2N\217\035\262"
+	.ascii	"\352\362\346"
+	.string	",\321\343_n\240\353x\344\255\020\034r\230\362\236<\265\\\311\361\210}[\204\234s\277\021i\345]\344\335\016\240\273Gt\337\006\004\327b\250\034\345\222\311\272\t\362\316\302l\317\261\265 T\037m45P\262k\257\332f\346\301\324Z\032^\304\252^P\277e\262\326~YQ\312\260\243\274M\220\315[\333SL\271\373\356\023(\336\215L\226\367\343\017\331\320\n\333\301\034i\214L\370\204\374\311\363\311\323\332+4\355il\2771\343\200#%#)\323n\246\367\2509\013=\351N u\374G\271\250\305\205\226snr2\355I\025+\037337\345\220T}\241\356\226r1)\324\2343T;\030\017\243\242}\313qO\265x7\266H\035\273\365/\377-(X\222\\\226T\037\355f\016\337^u\273\215F\243jm\231t\337\357\336\375nb\362\245\367\322\375V\272\337I\370\033\351~\363\356\367\021\3766\272\337\001\322o"
+	.ascii	"\366\273(\375&\262\337\273\373\255\273\337C\367;w\277q\001\024"
+	.ascii	"~G\nU\307\316: B\327\2269{\245\373\034\217Cg1"
+	.string	"\024\272\3647\336F\032\356\351C9\273d\207\276\370\304\234\265=\371,Y\036\020-g\334\277\\-\323\"e\r\355\346\027Rw\266\205\027^\370\314d,PZ\223ugGy!B\0175\372qg\223]\262Z\213C\302\005\005\327lN\261@ih\334\235-\345j)vX\200\234\216\240\212\330\320\214\214\237'33Z*.\355O\231\337,\256OPE\273Y\f\275\243\\\016xg\372\036\f\t\316r.\2721\203ZT\240\240{C\207<\252\305\3042\001m\250,m\276 \275\326)\212\023\260-\371,\265W\366,\230tf\346F?\356\3014\2656{\241\305\344\360\243v\352\244\026C\355(\227\274G\300\364`\212m\267\207\017\357\306.@\264\302n\037s91\332\267:\304\210\021\251cl1Q\016\002\037ij\330^u0\275\226\206\027<\335$\034NP}\023\215\3239h\320\003B\371\200@\237\003\245\306\351\036"
+	.string	"{@\337\223\017\202\017\bl\360\340\351\311\367\344\003\002\237*p\350\240\341"
+	.string	"\001\031S+l\233pz\301\002\305oJ\352\267B*J\305\317\204\213\027?\247\243\236bq\302\305\017\306\324\224\213_\216I\3457G\240\262\303\3661\021\204O\310o\3169\023=\225\205\317\242\354Yov\324{\375\225f\257\331$\236\312w\341fK=\327Gi\356\224~\353\265\222\254\322g=V\222\305P\265\265o\262BY\271\324\"\005\005\216\221~\t\222\305D5\245\016\217\353\254\023\227\327\020\357\223<\222#\313\373\344\0339\262\030\n(\2005\372!F\366(K\304\007Y\247\250\375?\036\310J\345\256VV\257\325+u\034\300Be\255)\262"
+	.ascii	"V\345\367X\265x\330Y\316UP\335]\342y\254\\\334"
+	.string	"\211\225s\025\004\307\375\310\267Z\277\256\204\ti\373\204\324q\221\3650<KKd\275F!\252\200\260\250A8\252\0304E#RRP\220\244\305\320\002\021!\"\326\001\021\320(\205\034r\206\306&%\2054\006\0308D\310V\204\305MR\340\277h\251 \267\337\255\007\276m\353\025\331~p\326(\215\3766\374~iu%\324Gz[5M\371\2070\022\203_[\277K\334\357~z'p\316(\337\365_\211\305\216X\231\207\360\250\301\2239>\233\365Er\260\276\201\242\326%Ve%\\\304\002mI\220\357qH\006\001\032\345[rb\346k:\237S7\311\230\306\021\020\212~fs\261\374)\203\374\t\240\002N\307\271i(Z&\341\375\025\311\001Z\366\031\0363M(\301+\333\331\256F\301\321/\215\2534\327\347\200v\314=\216t\336\350hKC\240\353\204\311\231\201\003;\340\304P\351\300\327\365\001\310\351n\030\351"
+	.ascii	"\273\331T\216\2013\177\207a\n\004\037\355\017\0355\307\314\305"
+	.ascii	"\001\346\211\352\224\374<\350\3553V\310\273\253\002m\026U\373"
+	.ascii	"\276\200q\304\327\321A\034O\305-d\n\203\253\036y\031\264|\327"
+	.ascii	"b\314\r\356\260\377\256w\251\321h\023^\3709Fu\336\231(E\210W"
+	.ascii	"\225\035\026@S\201\362\345\013:\353x\325j\366\300L\r\300\264"
+	.ascii	"\256P\316\233\025\223\3133+\236\016)\316\013\022\274\226X\234"
+	.ascii	"\304\006F,5"
+	.text
+	.section	.gnu.lto_gpsInitUblox.78.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"M\t"
+	.string	"\326Q@80\221\322\001\260\236q6\202\316iPxQa\370'\007\311\222O%\247\022\3311t\355'\373d\246\372N\317\035\277\231\021\021\262Z\260\375Y0\006\374"
+	.string	"\357\277\021\"eJ\0010"
+	.string	"1"
+	.string	"."
+	.string	"\273\033\025\344\250k\232(\277\363u\327"
+	.string	"XW\raC\205\345\371T\232\200\254\243\345\257\347\305\267\312\344\200v\327\351}\031\367v\333\t\266\013l\317\002\006\037\261\031\215T\2066\250Ju\331\3270\fC\253\207\235\351|\372\234\001\230\314!f\027#\234\355\312\226Bb\373\036\243l\227\203!\373\230E\305\211LV\355\022\005F\326Ru\331\236\330\244.\230\260\254\222\306\234\274\332\246\210\274\227J\260\322\316~\311a\024\276\210%Ny\357\233\177\332|\273\376\365\016}L\244\206\310\211\342\203Ha\024C%S\374\004\230#1\224\"\004\307\225\242\007L\035\224R\3259\272\221\326\313\202{\360\254\271\266\273\253u\322\036qy/\016"
+	.ascii	"2\003N\035\206YX'\002\202iX\001+\200\266\217\205x\241\207p\350"
+	.ascii	"2\364\313\020\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.79.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\037\0015\f"
+	.string	"6\225NC\020mj:\037:\030b_\344\272\322\002\245!\335\033\274i\340\f\225\217R\230?]\237\3661<\005>P$\2410+f\320\250/(\3413\""
+	.string	""
+	.string	""
+	.string	"\n\030A\274*\340bA \033\b\271\037\365&{\247\024;"
+	.string	"9"
+	.string	"="
+	.string	"\013\366\256\016\241V\210\335\335\250\202w\257\031\235\235\237!\032\301\320{\355b\331U\317\036\224.0$\235\202>\255\002\365b@\t\t\320)\271\354\256'\030\026\270\265\333\346\260\215a\237\024\021\276\n\3407x\265"
+	.string	"\317<\370\352{\264\327SI\350\003\204\325g\226\266\370Mz\262O\313\262\024aj\262?}\315\303\300\206\001\343\356\250\034\261d\305\340\300\366+\356l\330\305\247\360\013\r\2447I\034\365Be\240\364t\013\376\205\307R[\252\340\263\f\233\\D{\365\004w\344!e\177\202m\230\005\013\301\256\367\004\023\\\215J\t4K\330\356\\\002\200\311.h\303\017\306X:\033\220\215\313l!\231\016\315\206\341t6\013\205\271\315\007g\033\3418\316V\021?\317\226\232T\277\210\303\001\362C?_\274/Y\315\304Z\237#\210\2142m\r7\017zb\034\311\217z\016\036"
+	.string	"2\241k)`\200\037\253\005\035\326\004\006\212\200|\237\032\024H\266S\301E\273\0307\355\201W"
+	.ascii	"J\236r\006*\254\225\332\306\321\261\020f1\3160>e!\\Fy\031b\\"
+	.ascii	":\230\215\277\b\322\f\346\324\245 \213.+O"
+	.text
+	.section	.gnu.lto_gpsUpdate.81.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\006\016\rA"
+	.string	"\212k\204\027CP\244N\007+d%\276U\001\302c\0203\225\002\377\003\371\320z\201w0\2513\323D\324\007\350H\266O\364/\030QH\204"
+	.string	"\332\320\363B\254'\255\215 \361W\272\303\017DQUY\325\330M\356-SJ\001e\001H\001l\001C\366;\257\337\353\360[\315\337x\375\376\365\333I\f\345\ryz\220B\327\335*\f\344\332\255h\250\264\217q\271\034\256\326G8o\216\356\2705o\022\336?6o\333\341j\035\342\r\004\270\243\333\301x\030\036\256\326\r\336B.\256\353\022}\355\346\321M\364u%v\267\177\267\177\361\263\326\321zt\220\353\212M\347\\WMA\023`}\r\340J\331W\325\215\331\327n\273\363\270\332\230{4\2136\333"
+	.ascii	"]\327E\342'\255~\353MG\246\245$#\322\221QQ\221h\210(\024\304"
+	.ascii	"\016\363\252b\247o\333\037*\307\304\023\363\\z\323\324\217S."
+	.ascii	"\3174\245\362Ke\236T&\345\215\252S\024\216WT\230(\217T\006\345"
+	.ascii	"\217\206Sm\356O#2"
+	.string	"O\033\373\2427\0370\246\357K`1\352Dw\\Q5\200\025\256\257\037\032N\2459\373gFf\217X\027\231\023\301\224,\311F\\d\252\220\213u%\361 \001b]Pg\375\216\353\035\252\007\242p\274\212\317\246\252$\247\311\236\313A?\253\007\372\316\370Q\332*s\022\237Z\277\252\303\037[e~\307\225D\205 \330\207\306\323\374\205<\231\257\n\231y9f\275\334I5B\345\362\212\317\037j\202\274+I<\315\005X\341\352\362?\234r]\267\337\371\354\362\006\340\335\376\327\335\f\272\207\326\004\330\343\272\365\342zv\276\217\323O\300\267\307\265i\030\336\235\023\360SW\240\035\023/\333\333\270\3075\225\323Q\316\031\262\321\001\376\255\016\225=\2565\270\234dq\314u]\251\3668n\267\241]\212\257\315\241C\2078\217\302B\307\254#\306o\b\310\r/Ce\t\230p\355\035*\017\261\004\334\337|\231\356\306\337$=\200"
+	.string	"\221}\035b\034\357\232\351\361\351\006\270b\2512gL\245\364+\356.q\342\335\231\327\254\370\303\253f\252\272\256\353\252\215\364*\356N\241\342\335\331\030\253\330\371\232\204E\377\270\273\252\305\273\023\343"
+	.ascii	"Yx\211\3461\215W\r~c\363\243\013ci\273C\030\023\354s\352\033"
+	.ascii	"\3311\213\265;Y/\330\355e\334\314\215v)\375\302\352\335i\225"
+	.ascii	"}u\334\340M\023\370b}a\267\032\363\261t\256\013\030\275\306N"
+	.ascii	"\272\331o\252\374\235a\370\215\201\375\236b\277/\260\337\026"
+	.ascii	"\362w\005\366\233\002\373=!\177K\310\337\021\362\367\003Gs\227"
+	.ascii	"\312\337\310\374\375\224\277\001\344o\247\374\335$\364}d\277"
+	.ascii	"\231\330\357%\366[)\177'\345o#\373\215\224\277\217\362\267Q\376"
+	.ascii	".\n\372.\262\337D\354\367P\376&\346o\241\374\035\304~\263\371"
+	.ascii	";K\377D%\203\204\3256xg\305#\354$\371\324\344\316\215\360\021"
+	.ascii	"6\342\021\251\243\205\206\231\314E\330\b\253}\266>,\tV\204i\274"
+	.ascii	"|\201hB\315\261/\242\326H.b\027{\376\222\326\b"
+	.string	"\353\272YR\375I^I{\004I\013\205f_\213X\307\273\027H\204_\345\322#qe\036\302D\030\363iE\231_\250\344\275\224F\206\260\211wo\212\366E\334\341\360\300\206\276\332&v\360\240v\257\345U]v\313\037L*2\327\205\370[\375\\\331L\025\"\355x\036\346\232\355Ui\276\363\205t\236#\235\027;\024Tn\366\003\351<\254\353.=\352\253\200)w\216Y\\\237\033\346\032\370\037\355Qv\314\345r\325\\\003\3040\255'\354n\r\317L\262\217E\304\307:(\232\220\020nw\363\256;\375|\320\2239\b\013a\037\f\212\002\3236'z\366\006a\351\267\313\265L\332&\030/\277l-Y,m\325\2239\002v\261F'\327\255\324\003\223\354\037\007l\237\264dm\2246J\3665\002^\240\207\266\206\361\2713\304R:G\262wkz\016\307\037`d\237d;\005\304\003\354r\036\3457\370\027={\013|"
+	.string	"W\346\356\326\254\275\342pwq\354X\334\335f\361=\312\244>\314\327,\3664w0\267#v\201}\355\3554o\361\275v\212\307I\035\340\337\2045F\264\210a%\302\206\214\026WW7\252\210\272jA\r\032/\2203\254\2202\254V\304@V]\325@.H\352\0314Z\\!m\314\230q\205$\252a9v\302\346\231\331aaf\323S^2\003\300Ox"
+	.ascii	"0\n([\340\321\307`v\302\017eM\317\007\240\267\3631\030\307\t"
+	.ascii	";\320Cc\252\200=\255\tWx:\037\205Mj\035\224m\211\n\277\241\343"
+	.ascii	"\364\0132\322\347=\262\024\246\302Ff\0203ZQ&Q\017S0I\3203`le"
+	.ascii	"\255\316\303\264I\262l2\340\013d"
+	.string	"hLuM>F,m\004\216\001\263X\2133\2051`'\323$\274\200\245\360\024\366O\363j\224\313\226\311\314\276^\300\036\306\327\256Wn\372\026\370\n\373C\302R\030\371X\241\331\006yw\036\361\220\033\330\\`_V\226{\232O-\177\360\250m\316\214\005\354md\344\332,P}\034\334\226{[kx\267\2666\347\343\335\255\220\366\312\303\341\355\261\313\302\313|fn\314\bK\333\310\346-\221\314T\227\365\202\275\204\2250\023\306j\264\252\200Q\262jK8J\017M\t?\034\036\335\020\037\342\366\245\026\330W\204\245|\276\345\317\376\013\005\354o\335z\371.?}\243@\365Z>\3137\335\337Z\303_I\026\307\254\370[\022\256B\350F\234\204\375\313\214\370\352\375\233\276X\311\334\335J?JR\311\316C\301\361\352\001\374C\3721e\201\031\250a4\006\225B\210FDD$I\2224\006A\005\204\030'\235t7\021"
+	.string	"-C\220\241\241\231\244F\032\003s\330\341\313\371\016d]\016\303\253\350\307Q\246p\305c\213&\276f\361\261+Q3p\177\347h\322\377B\334)v\254\336\367\277\256\033p\013[\241\336\242\205\360%\"p\320\223\207SR\274\361'\305\276WS\230\374\3720\310\243\277\250\b\t\232;\222\273\225\3506\360\235:i\013(\037\265\260"
+	.string	"=k6R\353\352\254\227\037\027\320\320\325\244;x\333\200\262\n{\037\302Q"
+	.ascii	"\325f\261\307\363\217\224D\307\321u\356RDi\026\331WgQkQ\230o"
+	.ascii	".OY"
+	.string	"\023\347\030gp\220\241\375/\317\024\247\027yY\250\307g\365\366R\017\201\335\332H8\312\205\f\376\032\325C\214\225\177\317\253w\033p\337>0\244\302\333|\224\301\263\257\n\240\340u\347\227\016\360l)Cs\254\t\351\356\311\302\r\037\337D\3301)\2247\346\203\t\261\266\274\004\340\f\013\223\363\207[\017\262y\207\027\200p\242\203\032\360\350\314\301\251>\246bQ7\302\332m\023\376\334\213\302Q,\246#\210\r\023~\271g9\343\301\004\241\264\005-3:\350\032\213g\371OJq`\253\331\365X\227\235\267eg:\013}\215\324\001\331\032\3756\241\245\307\33553\205%\256\255\365\023\"kE\252\\[\200\355\242\241\201\021\253!\232\034\322\257\223%\003\204\t\351\306\215Bl\002\334\356\361\020\226C\233\241\2000\327\345\215\225c{(CP&`\351\007\2335\200p\2023j\034\365\362\205%@?vD!&\234\2168."
+	.string	"\247\016\224\215\366\254h\274tL\300\315\311\212`\363\373\312\356C<\324l\235\321\212"
+	.ascii	"}Wd\332\034!2\321\3028v\327A\357\220"
+	.ascii	"\310\240\367\360\362\005&\213\0021z\352\241N\304\364\237\031"
+	.ascii	"\n\242\224\\\003\272\006\332xK\024H\323\315D+z\303\n\241\252"
+	.ascii	"\274\236U\355\246\024\307\0063\222+\212v\345\tW\2332?'9\326|"
+	.ascii	"<\324\235\303N.7\365\356\367\266\277\276\023\2623+\237\\\n9\354"
+	.ascii	"R+04>Z\r"
+	.text
+	.section	.gnu.lto_gpsNewData.82.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\033\002e\022"
+	.string	"v#{G\260\230M:\360\310[L\216d\205\344-R\002\237ZVz\346}c\373\317\017"
+	.string	"\006\354\322\350\240z\3521\351>\375\004\346\326\367\023i\353\030\003\337 px\334\240O\340n[K\027\2117\231\226\305y i{\023)S\nk"
+	.string	"["
+	.string	"i"
+	.string	"\260'\201p\234\223E\216\037s\322\026\330"
+	.string	"\367\030\3401\362Q/@>\032fG\031\0204c\fd\244\220\331\2402\347\354\366\305a\217\333*\314o\001c\217\034\212o\233\002\242#'\\@\240-F\211\213'_\272\206"
+	.string	"\203t\267\002E+\244V\240\267\315\030\251\311\256t\035\001\006\251\252j\346\234\326\017,q\313\333\266`\373\200\255&\0021\177u\317\262\337+\335\001\323\214\211\354\312\217\2066\315\3235\262\277a\030\206\336\"{S\2636\365\313\223~\226M\315mj\225TK\251\216Q\275\252\326M}\030"
+	.string	"RD\200\237%\231\223DXe\326\"\220\030\266\357\327\370\222\317in\231!Y=\332>\366\352\361+\333\252\366i\034)\023fC\244\206bt\346.iW\270\240\377\234"
+	.string	"\352\251&\327G\017\036_\024Km\f\031\364\237\334%\002%\244\346m\314q\355\233\357p\271\300\320\261P\276(\267\216\303\305\3159\033\3707\336\204\343\037=:GG\377=\372:\3621\356U\314\234\244\222>\325\"lZ\177\220\273\032\230\234"
+	.string	"\351\224YT\327~u\320\177\2733@\033\255\273E\323\263\203\323\275r:\01697\033\272\026OOG\003\343\327\216\213\247\363\360z\361t+\332\317\267\3105?\353ms\316\031\t\250\375"
+	.ascii	"\302\225^\343m\314HhFl\223\221,n\tS\023\275\214|Y\326ZeC\236"
+	.ascii	"\206.\022\341e\277t\004QV\246\020!\rq\373\364/\352\227\221\252"
+	.ascii	"\345\3662!\357A\356$\301?2\005\033\033\371\250\332' p\002\021"
+	.ascii	"\302\263\003\342\200\365!\232G\320\212\233\244\334\b\346\206"
+	.ascii	"n\252F\204 \222\212}\034\227\231\017\355\2431\020J\036tK\241"
+	.ascii	"[\357*=\301\026\222Y;m%\343\002\355\341\n\353\0237U\222\375\210"
+	.ascii	"B\202\017C\210\302\360\320\033L\2711\341\330W\221\210\373\225"
+	.ascii	"\261\345A\342)y\020Q"
+	.text
+	.section	.gnu.lto_gpsNewFrame.83.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\235\001E\017"
+	.string	"\226\335eE\360\260(\035\353Lzs\013\312{\257\316\337\027Ej1y\3775aEK\017\025Z=\331\336\314\347\201\303k\277\216\310_\2570\225\372tA\352aq\030\254\210\330\254\323\033\306\203q\226\027\225M&\231\354-eJ\001U"
+	.string	"K"
+	.string	"T"
+	.string	"\232w\301`\335U\201\321\354z\f\214@{\264\355\006\016J\\\272\007B\345\361\212\231\304\340\330\3658\375\360\322#\324,\371\246Ge\301t+\224\303\277\034\322\244\324\200\271a\261B\271\246PY\001WM\210m\225A\023"
+	.string	"\310\356:\273\325\311\235\335v\004\333\t\354\034\020\251\007\276\211{\"_\304\243-\220\362\335\243O\312\036\2577Rh\300b\247\374l\017\225\312b_\277\357\313a]\261\235\3668\275\335\345\327\234\216\232\206\232\326\230N\230~"
+	.string	"PL\305a\365\016\337\256\352\323\2616\361\305\b\333%v\307v\252\266\b(\337y\364@JMNU\275\246\251\033\312\303\f\223\234S~~\212\203NlL\271\343\256\032\027\fU\026\177\205?\363\026-\333\212\361U\030G{({\374[\373\232i9\214m\034\0036b\354\232\256b\033'\273]\320i\2452\307\366\204\237\030\321v\003\237\373\363A\"\001q\242\020W!\0242\302}F$\356\303\303\"\022\221\021wA$\032q\035\357t\270\272b\n/\0312.\322/eY\t\rp\323\277\034\002\214\204z4\352\006[Q>\212\033\004\356\356F\002\t\325\226\020\222\3576M\241n(\226\314e\256\340\206\005\005d\037"
+	.ascii	"L\023:/$\336\337\n\034P\0017u5\270VC\201\274\217 \332\230i\311"
+	.ascii	"\277\323\006\253\200`\200\346\247\234\201\nk\245\326\216\032"
+	.ascii	"x5\273@f\006.0\237F1\232@\017\327D\217\211c=\027&\270\006\314"
+	.ascii	"\343\240j\n\334\355\334\362\004"
+	.text
+	.section	.gnu.lto_gpsIsHealthy.84.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514`m\322\001"
+	.string	"\255\324\316\242`"
+	.string	"\207\336If\001\220R\002\345(\315\333\002\2725t\354\320h\024\273\253\246\026\200\240#\346\342\216\330\221D-\374\206&\233H\231R\276X`\306\301=\214\203\3000<\270\213\005\235\245\342\227i\260\234\304{\226\243\304=\265*R%\350\250\307\355\260\272\252\352\307\307\344q\304;`\300\356&\370\034/M\370\2437Sh\362\330\233\257\251\336\256\003\031\245N\236\354\310I\265\260O\255\212l\2475\323\247\004LF\331C \273\240\323\311\2064\023\311\366\306\246\370"
+	.string	"a\343\353\021\003T\321 \371x\224\354F\247\027\277\236\227\377\215/\210\204F\260\214\363\004P\330]'\226U\334z\333\006\266\013l\223\002\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_grab_fields.85.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\233\005]$"
+	.string	"ZB|\016J\240\230Q:\020\030\001\035#Y\327\265r\316\201\357puR\020\311\357\232|Dx\026c=\t\365\247\350z8\350^\016fp\322q\032\327z\n\243\303\213\374\n>\\\215\350k8\277\377\314\221\342\007\273\267V~K\b!D\312$\003\327"
+	.string	"\304"
+	.string	"\331"
+	.ascii	"\036\266k\025f\351a\336\275\220\017!z\361\303i\265\316H\"Uk\021"
+	.ascii	"\301\n@_n\021=\220\007!Z\336\204\020EA\036\242\027\244#Z\265"
+	.ascii	"\026s\267\337\230/\311\333\230/\273\306\306\230w\232\231,\006"
+	.ascii	"K_.\3644K\262\231\267\007q\2323\202R\220\3513\246\246\037\f\226"
+	.ascii	"Y\375\204Pg\037\320\210c4\202/\016Kb\342\324\305_V?\027\344\r"
+	.ascii	"\327\364k\301.\234R\220\305Q\022B\023\025'n\365[A\262\r-Wo\372"
+	.ascii	"\t\371$\r\b\247P\334\352\307\202\274\2512\344\222\002\221\330"
+	.ascii	"\034\"\236\271R\n&\275$\031\204\320J\202m!]I\201!\230\224\001"
+	.ascii	"{\344\255\326\232\002\217\270\017\365\n\3042WJ\301\027\3473B"
+	.ascii	"\255uy\0040\370\245}\367\bv\367\301n\351\023\265\376\306\376"
+	.ascii	"\203\371\362\335]|-\212\370\370\217\221\202\022\204\344\231\265"
+	.ascii	">\324\005\020y\202\345\244\345\210\267\272\213\214\035Z\335K"
+	.ascii	"\273E\020\374\002C1&\266g\354.o\017\201\001</\362\007\300\275"
+	.ascii	"\370\337\226wG'\307\206sS\263\371\323\267\246\344\2451/\315\311"
+	.ascii	";3ye&o\f\345\205\241\274i\311\373b^\327\311\2132\357y\362\232"
+	.ascii	"&oi\362\2227\362\355\033\277\\\362\276@l\313\r\340s\034k=q4S"
+	.ascii	"\251\224Lt\334\310o\374\237\336\273\337]\242\375\221#9\324\246"
+	.ascii	"O<\262>I j\355p`\344i\021\311\200\251\265\270\340F\326\311k\260"
+	.ascii	"^\304\025\342\026\230Z\253\317\313=\260K\362\356\202\006D/\022"
+	.ascii	"9^\003Zf\3042\341\342\351\233\366\311\3163k\260\234\250\216x"
+	.ascii	"+\235\035\217G\251\363LY\017\340\351X\313b\375\032\372x\022%"
+	.ascii	"\253\013\216W/\355\241\376\023\275+!\212\353%\315Z\327\264\317"
+	.ascii	"u\235\t\353 \247)"
+	.string	"R\327\231i\303^\235vO\331\260C_}_\013\264o\355\352\3274\332/#\037K\220\316\274\3163m\315\323\347\320\007\222^S\023\265D\221\342\352\245\235\271W\002\264\303a\002\220%\313\354[\237\315Xz<\3126\373\270&\273\354\007h\262S+=\276 \235)\342\343\201I%\302\240\367`\006\350\022\304\224\215\343\372t\352\261\244'4\342\343\252\240\032R\235\t\2763i\335D\246\206@l\200Ab\366\222\260\266\022+\020Sl*\021|g\276\377\343JxBvh\r?\007\3420\324\0322t\020\372)\2076\3548\220\030\202\204z1$\020\002\322\220\323\375\344:\374\\\340\220\303\020$\224KP[\035P\206\240\334\220N\027\224K\213\365=c\223\214bL\314zzI\031\253\350aQ\245\217\372\316No\204\2426\242\351\245\356q\365\302\024\361\361\260_\323\217YL\247\367\324\351n\337\306l\275\344ik\366y\367"
+	.ascii	"\247\f\235\266\344\304\270\222%\203\345\2200V\345`\237\353\264"
+	.ascii	"oI\030N\317zUB[\373\316-\030\201\356(~\324"
+	.string	"k\355crZ\337\312i\313\021oY\240\315\372\3264\265\236Q0\322Qu\262\326Zcd\252\323)\214UT\345\201\347\334\364\226\266\306i\337\2465\275d\371\250\333|\311m\232@\317\254\350\250\342'S#\262`\275\2645#Vs\250Q4\243\214d\312\320\214\310\004I\2324\006\220\002\031\252\253\007\020hY\233\264\006\373`7\216>\025\004'\033\202\221\267\027\277\032\213O\361\331\016\253\304\003\013\313S\251l\t\240\037\235\324\0049\301\241\221G6l\242\374`\245\272\343\214\303\207Je\263V\002\270\334\341\343!\013'\022P+\211\333\276\256\036[~[)\247\231\247l\311 F\356\265\270H\3573\207\340\370\324G?\303\333m\275O\221\2208{\r\020\323 X\214\347\321\307\376\262\303\313\202a\225z\340x\230c8\312\202*J\260.\242\366#w~\275SH/\236\305\247l\326\342\370,\261$\277\024\263 #2\304"
+	.ascii	"\330Mx\241\020\b\260\221\264\346\204\371\203{\001D\366\353\332"
+	.ascii	"P\243?y\306\330b\226\211\210G3@\363\301\366\354\346\\\325\343"
+	.ascii	"E>;\221\211\366?"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.86.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`m+\265\244"
+	.ascii	"z\376\0308D\0208og\f\371\311\370\316\201\247\347\251\2551\345"
+	.ascii	"\307&\322)\314\3029!\366u\266\336=\334\356L\337\204H\005\361"
+	.ascii	"\263\334\201Q5\216\t\215\246jM3\244\r4\240\252s\203\265Cv\r\235"
+	.ascii	"\2647\221R\246\224Rf\0033\003\203\003/\\g\027\256s\013\327\231"
+	.ascii	"\205\353\274\302uV\361\316)\336\031\205\353\234ut\306r\235\257"
+	.ascii	"\216\316V\357\\ut\246Jr>qt6\221\344\\B\203\363\224\006g\022\032"
+	.ascii	"\234G\034\235E\034\235C\2743\210\243\263\324\3219*\311\031*\311"
+	.ascii	"\371\303\321\371\311uv::{p\235;\270\316\034\\\347&\327y\203;"
+	.ascii	"3\275\363\322;+\271\263\206wN::\037\337\331}g$w>z\347\fGg\f\256"
+	.ascii	"s\321;\023\275\263\361\235\213\357\334\2763\353:\257\357\374"
+	.string	"\256\263w\036$0\177\316\332\f\232\367\235R=\364\002\262o\300t\233\356\026\272\327t\307uK\273\351\032\311\217<\203cp#/r\"\3573mt$\346fn6\334{o\032N\223na\203(1\351\253dZN\247f\016\337\327l\001\275\"n\026\272\r\267\036\033\251i\342\325l\330\207S\360\360}_\243\276\343\316c\2435\310(\245\364\235r\244\3267\310\303\350\305\255\206\215\232\345F\323x^\235\346+\312\211\364=\223\221Fj\346P\207\261\331\250^j\233][C\333\25437\341\226\353\271\256k;6:\203\\\337\246\f7\026\302\340\240s\312\220\"\243\242zYq\310~\307^\017\006\335\346\f\276\257\224\252Y\036\361\336f\300\370\337\367\231F\357}_+\016al6\005\213&\234lz\242\024\224\345&Gfw\370\276R\254\337\302J\275J\233\263<\331|\307v|\206\353\230\216\347XZ\203\306\f\0311`"
+	.ascii	"\360\302E\013\026+T\244@\221\205u\305h\254\252\250N\230(1Eb\204"
+	.ascii	"\210\020 \244\242\240><9y\350\300\241i\003"
+	.string	"\323\222\222\206\244\243\213t\224\001\203Q\021\221\261\330\262\353{\222{\351\307\220y\246l\276c;' 8\237\211\322\\\027\205)mY\346L\327R\320\354%VIS\223\322<\307\322\242V\r\277\246\261\236\030tShiJ\n\314n3K\364\031~T\227\341w\310c\254U\322\324\2404\f\247\264%\024C\016\300\013\210~\377\242z\350.Z\004j\026\202\200|\205\212?\235\302O\037G\261\376\223\303,\215\307\214\317*\303\020\231\236\326\373\363\254\242\326\tT\246\215\025\342\203\276j\261i3\2325*\257\245\360\230\371\255V\322\226S\334\252\252\250U\245\251\354\324\361\023E\2551Q<A&bDKD\331\304\244Q\241\323Ss\332\320y\022lF\344\361\271\210j\210\027\304\244QY\323 X\350435\355R\227=/k^j\032\325\007\305\367\241\315\023\236\\\\\247\231\301\265\030\\Pa\004\226J3\343c\235\360<"
+	.string	""
+	.ascii	"'\246C\031\016ME\255\roRmf`\234i\351\213+\255\320,b4$\255'\236"
+	.ascii	"v\2524\0363\276u\351\216\332\237n3\353\342G\"BP\020\004\245Q"
+	.ascii	"\341k7Z\006\232\002\n^\270\260\265E)Y\240DHi\314\220\300\267"
+	.ascii	"\036Iex:\035\203\213C1FY\212F@s\242\242\326!7AAiT\236m\304R<"
+	.ascii	":#k3kz\213\307\354\271Fy\331\331\230\263\256\232\224^\213Zv\275"
+	.ascii	"\245\006We\236U\351\177Rt\266\3544\263\276\326}\337W)m\311\\"
+	.ascii	"\275\250\365\276/;\363\214J3\001\315\314naf'\314$Z\004\337B2"
+	.ascii	"Z\305\006\247\231H\357~\2737F\350&\0315\352!}\207\311\262\006"
+	.ascii	"\032\007\243\320Z\022\234\006k\217"
+	.string	"\336\253<\017\314\270\346\350\373\231\005\r\342\0330\375x\204\316c\206gNB]M2J\202\355}\337\026\354x\236&\tw$)\227\224k\233e\013\231\204\030>\003\324\235\333\335\300\341\315\304\360\255\224\020\013\240\223W\262\177\351$V\270\277lAs\347\330\351\210\342\342\330\345\214\321(\273\231\342\333\033;\264\345B\206}\005\326\331\306\256\302:B\030v/RR`g\323\003-[\277\203'\262\253\365\221D\244.\354^\336\317\026v6\0264z?AYp-\354k\335Om\263J-n\325AOc#\333k\366J_\023\254'z\t]E\017\003\255z\364N*\337\211#\313@\204\026\206\245I4\b\203W9\264\342\021\352bd\374w\201\n\322l\212\361\333\020\212\212\337\202\036\005\2113\375\203\342\257x\201\376\332\262\3017\242_\363'ah\206Ijn\330\214\355\177\027_\022q\245\277\355wa\tO^\331\030\256"
+	.string	"\016\026\177\215\251\232\375ns\362\276kj\016\343\373\2165\323"
+	.string	"\343\230\220\251f\373\256_\370a|_\261f\032b\035<\274\231\354\277^\240:\200O^i\330\265\004\255\320[\023\2309\300\366\327\326\357\264:>N\334\020\027\256\037\001Z!b\023\254ef\016\232\020li\372\276\357\013\356\301\026\204"
+	.string	"7\n\315\262\005?~\264\315~`#\344\377\337d\211\202\376A\320\n\241M\300n\274@n\330_\343\246\342d\316\255\177\210x\b\324\234v\237\"\013\240\t\036r#[n\027:\020\311\215\002\033\001\342\315\004\3226\033\004M\360\215\220\230W\217\254"
+	.string	"\250tj\326\337R\372\254\247\352\0167\036\026\364@\350\204\333\264\377X\320(\302\255N\230\367}M\330ifh\260\226\0167\037\013>\001\232S\324`m\263\335%\274Q\2760r\230Y\320\370\276\312~\262\240\224\326\253\007\356m\360-\3415\321lG\371\022\201\310"
+	.string	"\222y\"\263t\351\277\306\334MwH\312\313\257\205\331\235\033\360\350\334\177\335\246\271\375\330\271\373zMs\323\315I\345\342:\256\271\2614]s7[\332\334W\332LwG)s\235\233)\266:\267\262\337>\323\234t\235\303\\\347&\2563\223w\006s\235=p\235;Pr\346 \311\031\231\344\274$\311\371\313uVrt\366::'q\23578:#9:\037q\23558:\0339:g\340:\0279:cpt&\342:_pt\266\340\350\\A\222\363\220$g\n\216\316]Gg!Gg.v\236 \311Y\202$\347\b\222\234!x\347\007\\g\007\336\271\201wf\300u^\300uV\340\350\034\344\350\fD\3119\001\327\371\207\353\354\303uF\300\235{\270\316<\336y\307;\353p\235\017xg\003\336\271"
+	.ascii	"w\316\341:\023\340"
+	.string	":o\271\316\003\270\3168\\g\001\216\3167\216\316\001\270\3166\336Y\353\235k\034\235i\270\3163\216\3162\3369\306;\303p\235\003\005\274\001\317\201\232\343\013\370&@\235\342\327X\332`m\216?\212[\311\326\261\034\337ymu&x\370\204{\203\342\327X\205!\254\376\373W\263\245T\306\337\324\342'\013\360\351V10\246\351\252\374<&a\033f&\322\257\202\031\251\237\230$\373 YV\3266\333\200?\305\347M\265Z\255\366W\333~\337\177\337zMU%\257.\360\356\271\374@\2758\023\260\234\371\276\254\325mE\205\273s\365k\334[\257\205\200>\210\004\274\017\247 \2649\247\033\317\220\214\325\326\033V\365S;\300o}\223Y!Dd\200G\342\374\003\215\022\341\216\223*\302!f\316@7M\032\034\325\235\356(\317*\005\335~\320\351\002\216\027\024\340q\374\037\001>\001\347\036D7a\356\304\215\357\323_m"
+	.ascii	"\177\203\337\205\017\374\002"
+	.string	"!9eJ\333l"
+	.ascii	"\177\320\246\032\023z\220X\323<gI\264C\316\2767B6\302\022\377"
+	.ascii	"\016\322j\n\030\002\215\267\361\305=\262\304\032\257U\343[@T"
+	.ascii	"~}4\276\bXh\020\233~\274B\177%f\360!\257\330\350\210\220D\223"
+	.ascii	"\3613\276\330G%'\216\214/N\013\311Ay8H\253\351\273\3717\311+"
+	.ascii	"I,I4\264\266\331\031\\\232W\r\343ct\363a\274\0075:\206d\211b"
+	.ascii	"kz\311[+\251c\246\332\360\247\211\202\371<v\262h\226gA9&\212"
+	.ascii	"6\370J\261\220hd\333\315<u~>\330/\276\261\374j7\366t\361\353"
+	.ascii	"\277\370\036\013\263\304k\025\357\3427,\347\030^\371\026\337"
+	.ascii	"\315\377\302\265\221-\213o\321\325F\266+\236\305\367\335\212"
+	.ascii	"\3577\347\035bs\254U|_\3715o\354\231\342U\374\225F\361)\236\245"
+	.ascii	"\216%2\251z\024\317T7'p\354\271\364\352\b\177\366\372E\345\237"
+	.ascii	"-u}\337\326\355T\026\221\365uN\254\317\372\225J5'\305z\026o\020"
+	.ascii	"u\005\304\020W\017\307\005\304\352\257\242e\254\n\307\264\327"
+	.ascii	"\340JV\250\007\302\355\320\2239|\025VO\344\365\253\336H\215M"
+	.ascii	" Y\"\0279/EE\302\213\t\363)|\241\222;\203\213:a\302w\341b\342"
+	.ascii	"O|\333\267\345\004\023\337\016\016\202Nq\203*\241\366jiS_\342"
+	.ascii	"\331\276\342\224\304O=\007\352X\231e\263\331N;\342I|S\241\210"
+	.ascii	"\037\361t\212x\366p\220\n \364\343\r\022\363!\304\332\217\360"
+	.ascii	"\365X\366\230\204\336\274\327\366\335[y\021B<\0138\310\371e\355"
+	.ascii	"5\002\273\033b\236'*\354t~o\306.W\347\245\260\233\231\363Q\330"
+	.ascii	"\327\362\332\023\332\361\006]q'\020[\376\203\207\322\332I=\210"
+	.ascii	"\242\376j\243^\3529\344\215\265-\377\311;\211\372V\217\260*\245"
+	.ascii	"z\200\342\362\312\244\227\177YO'\275\264\037\036\352{\254\355"
+	.ascii	"\351?<\273WE=\364\364, !\"\340\0238\303\016N_\034\021I\342\320"
+	.ascii	"\303;=\273\207,\261\204Su\337y\241\302\244\230\244\n\336L\017"
+	.ascii	"\317\016\022\016\002|RF\020\207\016\204Mmd\313\341;|\2235\003"
+	.ascii	"qx\2478t\232\232\036\220o\351\r\337\364MVe\351U?I2@6|\227\311"
+	.ascii	"\262\207\330\3448p\3626\374ZV\203\265L~\323@\246=78LK\277G\217"
+	.ascii	"\322/}\333\207\347\216R\033\304%9\r\326j\360\353\323"
+	.string	"\320\006:&\252\224\344\346u\222Q\022|,\365\370Is\344\034\277\305#t\023CF\203\033\034\344\307V\217\033:|\364\330\261\325\262\215\255\255\036[\355\020#D\224H\200\304\310\020%DF\276\274\212t\r\271\240\313H\244\r\3401\304\bW\222\n\212F\276v\0309\240 \207\222!E\272\270z,\36122\302\225\204\253\207\022\256\037K\274\212\272\232\273\256\274\220X\200u\204\b\226\006D\270\214`u%\361\302\272R\342#H\206$\301Rr\344H\022,#\261~-\314\253\215\344\257=\355~\277\254\357\243\304~\311\375~\367}q\351\307Pl\2000vY\366M>\354\311\254,\275\332e\317\316*\233<\222\247\037\264\211\203\t\237\352\020&\357\343\331'@\224\207\262R\3016L\017\215\340\222\245\203\007\363`5T\244\203\367\340\221\352\374\310\341\033\277\306G\215l;\3503,\322\301#y\332\211\323m\327G<C\202"
+	.ascii	"\003\310\353&\001\r\234\237\226\217\365\321\035b\334UO;\371e"
+	.ascii	"k\341\341S\316\233\215_\323\252!e\220\203\225\357\3512\007\351"
+	.ascii	"jl\260\276oZ\215A:\3578\275\027\326\306\310d\016s\023\006\307"
+	.ascii	"\233\311?5\024E\356\025-y\244'\366\327/\021\362_\277\241\216"
+	.ascii	"O Y\242\0229^\257\344Yj\222\367\372\246B!\237\344o\003:H~\203"
+	.ascii	"g\251G\036\211\236\026\362G\036*\017\0379\032\3241\362\032<\013"
+	.ascii	"(\2037\362\034\354f8\221\366W+\3443x(5>m\212\364a\360E\236\355"
+	.ascii	"#\362\0300\0333\"\377!\017\0374\027\374\365\036r\212\215Ih\301"
+	.ascii	"_\360l\005o\3017\355\031{\263\004l\256\257\340\241\324\246\325"
+	.ascii	"\2612C\356\364^\322\313\024\033\273\007I\217\202\037\322\365"
+	.ascii	"\024|S\037Y\342W\313\365]\337{-\301rj8\366\346I\2047\032B\376"
+	.ascii	"\023\327\326??!\337k\370\304\315\021\3636\343\327\326es\275\367"
+	.ascii	"Y\355|\325\341\372\026\\ZF\262\235\340[p\2073\207\355\t\013\364"
+	.ascii	"fN\360?5\204\005p\371J\226\200\317*'\016 \023\326\026\340H\360"
+	.ascii	"m\347y\0061\002?\253\233\244\027(\275=j+\233\244\027\343\232"
+	.ascii	"\027\3017\337\363\f4\216\320i\005g\365\320\204\366\251!5\006"
+	.ascii	"\004\200\3264I/xy\\\326\273\244\027;\b\276[pR\037\b\264\326\321"
+	.ascii	"\315\025nY\345\342\036\370\366sR\035\020\264\232AF\373\276\254"
+	.ascii	"P\344\233\003\337s\234\207\020\033\030\264\256@f\214\333\332"
+	.ascii	"&\246\201CP\006\2369\254p\005\223\214NM9\314pM!\fq\304\264Y^"
+	.ascii	"QX\277\204\275\020F\r\253\206U\3670\327.\311\250q\345\302\300"
+	.ascii	"7\237\323\0201\256\303\340\031\204\301$\352\263\3007\363\331"
+	.ascii	"\327\023\026\370~:\r\241M\261\300\r\335"
+	.string	"\346$\241\221q\356\330\375\001\260\246\261\263E\023\327\022\330\327\374\204\371\027\024p*\360\r8\013\241\315 \217\366\323\006\362AV,_\312\344\024 \337M'!\251\325JX\0340\246)\n\334\n\264\315NM\t\211\255!\254U\024X&\237<i\233M\340\033p\022\2026\215Z\334<_\264h\351w \232\250 \213\236\373\026\3732\272\377\361\335\266\236\375x&\316@\210M\261\246\373\3173\272\320kd\353\343[\352\343\251\366\264-~-M#[\004\276\347\336\211\332\343\021\370\022\200X\026\277\306\256\242\343\336S\264\334\267\362\313V(\335\303j\005!J\217oB|\326\025<\276\343v<\217\036:~\307;\331\351x\017{\\\305\257\245\351\003\276\345\f\370\003\336\211J\226(\026\203\257\250\362X-\013B\312\020\315\210\210$I\ni\r\302\013\020\b\002IZJx\036\022 D5F\244\216\251\032!I\222\026\016@\b"
+	.string	"\035I\203\266\n\336\263\372\207K\344\322\306}\304\264\264\211\270\217\302x\272\343\316"
+	.string	"\354\233\370O\375\323\343\234\334\221}\024\376\204\243\276\016Fv\033+\265]\366\256H\225\323\247\307d\305M\372\310!<\341\024\035>\205\205:\317d\230\330N\264.\203"
+	.string	"\303\210"
+	.string	"\265J;\357ahZ\034\356\324\264\n\001\352\026O\345P,\031\004\321\0228\265\260J\f\265\241\246\255\276X\363\214\276K\336^\024k\005_|.\242\231@\3018~\373/:\\\331\262\213\251\3760\333\362\013\305\023*\364\303fO\034\006\263{ \302\333Z\215\354\362\n\247"
+	.string	"\352V\0052=\317Nj\346\271\027!\330\240\236T\034\322\275t\314\271\360<"
+	.string	"\244\211\325Oe\245\366\317U\354\350<:\t\\\267\341\350\275\222\220\027\376a\200b1v\201\230\310\261R\234\272\030-\244\201\030\346\260#G\320\"&\251\372*\261*^\225\214\312\005\374\355]\267QZ\031=M\230\301\375\n\032\202\326\212PG\024 !\323\022\211S\227(%\033d~\254\227\320\224\tJCSJ\202\211\255\005\350FYX\266i\304>D\240\321\337\355\356\375\\f\224\275f3\314M\374E\021\263F5\211}\32116\302\325N\315K\t"
+	.ascii	"\231&)<\270\025\354\311\271\244\004\370\245\211\364"
+	.string	"\303\263\247\373^\322\032\337\307G\253;m\315\240B\306 -\344\003\003\004\251h\315!wem:\332\"\247_\313\211\233\333\301jI\305\312g\263c\241\227k\001 J\320\002Q\333\305\202\266\3005\001\231\346\214\344\r\235\277\355\233\210c72GCn:\013\336\371u?\261/\301\313\325@\177h\036\007\016\tu\235VU\213\360\r\356\325\372twh\267\np\035C\022\031:}\215n\003R\023\r\034\311\035\311\226$LDU\376\365\265@\027\001\356\357\r\273\035\321\360\304\316\\\301`\370Mp\243\373\024\225\347\274\013\001Z"
+	.string	"\257\250\234\013\363\202\374\334\210\347\273g\353\263^fN\260\254v\304\001\r>M\203:A|xw\341\350W\002\301\177\360\017d<\374k\035\206`\255k\304\024O\206\341"
+	.string	"\021\030a/Ut\344\307q\022\220.\220\201-X\210\244\350"
+	.ascii	"h[7\3327\307&\376\272\033\335\024\262\240\221]\320oHz\363d\250"
+	.ascii	"\360\025\357\245\221\366XY\355l\316\236\206\r\346\026\273\225"
+	.ascii	"6S\303`5\034S\272X\006\226\250qZ\323a\307:\220\262\253\207*,"
+	.ascii	"uH2\235o\225\bq\355Y\006\004\316Fm\251y\221U\324\371\334\316"
+	.ascii	"\226L\035Z\002\372\023\331.<\203\025\306\340%\300sV\0328\223"
+	.ascii	"r\254W\353\350\254\363\232\246\340(\250\b<\026j\256\030/\003"
+	.ascii	"\306l(c\363\240\307\357\004&7\030l\220i\027;\030=?\357\007H\260"
+	.ascii	"J\373\264\rs\r\027\372\274$\303\362\2557>n\244\025\243\373\r"
+	.ascii	"\306\337\306\213\270\377\005\216\217\354\035JN\205\037\035\321"
+	.ascii	"y*\206%GB\313\250z\257\254\206\003\343\217m\347\251c\306\214"
+	.ascii	"\263\310\3603\307q\036R\313\240\236!\254\317\036C\254\250\312"
+	.ascii	"\310[\305\200R\177\237?\232\2632;\276\267\244\003\315\037N\260"
+	.ascii	"\013\032\250'\315\027-\036Q\313\246\211j\335*i\027\276\222\344"
+	.ascii	"\256\017\230\325\306\234\327\314\241\266\203k\266\351\375\257"
+	.ascii	"\007\301\021@U+\035\244\033\bbL\n\276\022\f\r\006\237~\2264R"
+	.ascii	"@\r\205&\235Y"
+	.string	"\026\357o\330-\242 \361\364\200ll\363\224\326Z\210$-5x\356+z\215\315;\202\203\347\204\006\321\2148B8d\271I\264I\266~\035eW\341c\315\202\240\307\211\b^\322\227\342\203\224\212\322\330;\366$\337\"\252\261S\207Zz\307\342\325bz\225\310\374\202HI]\377\0325m\245\034\224k\016\346eJ\032(\240\346\347\037\017\260\344\226\0223=4\352A(\320\343>\324\302x8\267\237\035\244\020\242\226\301\375\312<a\256\300\206C~\301g,9Ob\352\307\002{\252/AwM\273/\216\007\267\226\3023\270s(&F$\354\271Y\031\244\336\004\377%\354\016\033\254\"%0\335\340\202<\230\354\345\024\326\0138v\367*\345\327v\036\331\377w\240(\374_\246\371]\246\301\342\317\336:\236)\311\266\371U!G\025\003\343&\307\221\326^\255\311\203\r\n\364\206G\221u\223\203\006,\317\364\325\311L\362\005"
+	.string	"I\017\0369\230\237\3227\315\007,\355G\214\331\361\215\002\022(\357$)\n\202Te\326\371\367\003*\342\234\211\006\243\245{B\371\033\234?\223\030\037\375\023\220\346\245n\273\322`\303`r\355\203:\356E\250B\025\274\"\217@!</@\331\262\017\270K\261<^A\241\233\214N\275\246Wd\256\310\346\321\336\222\355\275\334\256\031X\242\337\272~\233\363K\365\033\321\257\200N^j\234J\004\340\347\222\240H"
+	.ascii	"\341\245|\314\n|\337Z\030\272\237\360\211Bk\350S\234(\007\350"
+	.ascii	"\240\222$I\031\002\022\241\324\321"
+	.string	"\020\305t|\256\216\212\223R\302 \220\327Y\"<\007U\023\232'%\023)tT\033\271\332\277\342-6\350\252z<d(O\034e\263)\013\366\241\377\205(\363X\263GL\036P\231\302B\234\271\375e\004\270\266\r\324i\025\254|\302^\300\244o\200J\236\020\004\205m\240\255\3553\216\306'\236\002mE\331\223\3468S\004\025\003\233\270muZ\273\017\027\375\247\241\345\006\231<2\201O\275\325\367kl\305\263\315q\307^\217\301\352'\343\224\276\356\200\324u\374\035\336\027~ok\024\315\210\022\246\216\205\r\326H\357\304\275A\275C\024\332\263\353[\321Y\031\227\231)d\304]Zc=pFuP\016\005u\255\323\234\337\205\201\343O\232\221Fm\220-\206'\257[\233\203n\024\300F\021\240\235\036\367\306\222\t!\003\036\026\332\307\200Qp\331eN\254g\227A\235\201\fv)\005-\376CrE\323\211\205\356\\\224"
+	.ascii	"\276\367I?\336I\253/.\357\300\315+I\362D\362D\021S\023|?/T\306"
+	.ascii	"\004\311(%\211\265\373iY\037a\352/\003\233!\312\b\275\033\247"
+	.ascii	"\031\rYGZ"
+	.text
+	.section	.gnu.lto__update_checksum.103.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\344\001u\020"
+	.string	"v\036kE"
+	.string	"\315(\035\034a\3558\362-I\207\001(2\202\233U\2062\302k\030\021S#Oj "
+	.string	"%*\343\264\033\327\252\273bg\365\224\276\242\237\370\377\177'\247\375\023q\300l\362\245nA]_.\367-!{K\231RU"
+	.string	"U"
+	.string	"V"
+	.ascii	"\006\266K\317\013l\227V\331$\016\272L\214\032\233\t\264\023s"
+	.ascii	"\316n[\374\360\021\274\243\252.\343\252\312G\360\225hy%\227\221"
+	.ascii	"c\275,\004\360XqC'\207\346\264\253\313[i\304\260\362=\355\016"
+	.ascii	"p\276Z\313[\271r\r\346\234\326\226\247ro\267]\262-\262U\024\240"
+	.ascii	"\203\177\305g\377\347\340\315}voQ-\243:F\365F\265F\365\t\\\240"
+	.ascii	"xQy\205p\316W\2703o$\315\005\013[&\2051`\236\304P\320\200\331"
+	.ascii	"Q\260j3\020\251\016\242\274s~6\t\256\3665\\\246\372,\365\320"
+	.ascii	"\234\260\r\035\346\004\027\370\200\347\322\340\003s\316\0317"
+	.ascii	"f[\343\333\206\226\213}!P2\2544\264\354\210\273+;P\236\270\362"
+	.ascii	"\253q\261\354\202D\274eB\367\273\373\024(\337\352\244\253\036"
+	.ascii	"^\363@y^\374\324v\371\335b\037\007\027\213\211\206[\373\300\362"
+	.ascii	"vc6X\242\033.:9^\230\035\272\314/\3400?\200\0178BHq\304\021B"
+	.ascii	"\212\245\217\b;\"\031yD\2232FD t&\220\256\0042\222\320\221N#"
+	.ascii	"]\306\205M\"\037\247\216\304d:u\026\340\374\302\374i\001qc\262"
+	.ascii	"+\2711\277fd)\013\252Xn]\247\375)3\262\331\206\326Q?\273\255"
+	.ascii	"\313\247\230\021'\252\343\207Gm\334\202\226\303\371j1+ \220\202"
+	.ascii	"\031\314mb\340\275#A[3Q\221\242`\033\203C\b:\366\255\001z\213"
+	.ascii	"\037\334;\315\305\203m\203/\234\021<\272a\266\316\301\320\234"
+	.ascii	"\001\2466\230\005\240Q\027Q\357\030\314\257\220\201kmp\354\030"
+	.ascii	"\230\206\037\230Rv\370\036\306\013\340\021\001G\311\367\202Y"
+	.ascii	"H'(\277\031@\331t\301'"
+	.text
+	.section	.gnu.lto_ubloxAppendMessage.104.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\210\004e\035"
+	.string	"\326\365\273I\240\226U:\204x\340\r\250\356\223\323B\\\333\346\276y\274\201g\237c6x\314j\002.\363\252Z\362cv5\217'\224\305\332\354\313;\215W\214\037s^z\033<\374R\210\007z-\002G\235\302\027\273\202\353\337\022B$I)\254"
+	.string	"\233"
+	.string	"\250"
+	.ascii	"g\215!\301I\013\036\032\242r\257\276j\"\214\023\027_j-*8j\013"
+	.ascii	"I\270L8\217\224\270\211U\025F\216\021\212\344\036\253\274+L\r"
+	.ascii	"\326\264\037@Hz1\347\255U\230\205\300<\224\356\001jm\212\322"
+	.ascii	"\244\326\342\002\033p\035\025\362!I\326-\213\336\256\306\201"
+	.ascii	"\244\227\025H\306\324Z\234\271x\002\351Q\327\007\244G\367\206"
+	.ascii	"\277\374Y\274OSw\364\\S\347K\035C\317\351\352\027Lq\364l\365"
+	.ascii	"\224t\300\202\275\363'\353\013\362\312\233\300 \317<{\300\370"
+	.ascii	"^\371\013XB\343/\b\343f\213B\255\325\346/\270t\247\267m\263\375"
+	.ascii	"\301>}\004\366\177\210Y_\274M\266\201\037\377\002>\262\236#o"
+	.ascii	"\236\235\226i\235\226\351\234\226i\234S\335765?\362\013\210="
+	.ascii	"\311\017{\221\037\300\213?\315\241n\327\241~\364Q\367\3312\275"
+	.ascii	"?\336fj\372\007\b\330\350\262\364\031\306Z\225\226e*\025\024"
+	.ascii	"\271\343T?\362\217\372\217?\355\373L\256\264_F\372\022\277\311"
+	.ascii	"\22348\214@j\255/d\325\t\244W\345\322\212bL\007\327Q\252)]\254"
+	.ascii	"Z\251\0176%\275 }J\027\242~\211FR\312\202\243\346\200d\277\216"
+	.ascii	"\336N\362\225\\\312\257c.-,\241\321'\344\235\265\326z:\370\315"
+	.ascii	"\356lk(\234\342{\362\331\234\325YT\230\224-\316\346\354\315\370"
+	.ascii	"\204<\253\r9?\007\316^y\rH\204T@\031k\274\352\005\327\347s)l"
+	.ascii	"wmzD1>\341\306\266\346\312\367\3043\277\0026\266vQ\315\374\317"
+	.ascii	"2\337\2460l\277(Qj\305\031,h\032\333tH4\302\326\257r\222\001"
+	.ascii	"\260\376\224]\006a\242Y?\212\371\343t\206\f\223\025(\207\021"
+	.ascii	"\315\017H\321um:\234\221\305\367\3043\227\376\217\347R\337\n"
+	.ascii	"\2273\265\324Z\237\303\327\245G\023\230y\022fg.\355\"\317\334"
+	.ascii	"aFBDK\303\321\202NZ\b\020$\200N\021\270!#!\2424\210V#:A;j\005"
+	.ascii	"e\030\272\025\241\267\033\215\250\302\320\255\310\205\273\005"
+	.ascii	"\255\201\030\334\216\206f\265\0213\243\021\264\242\031\220\355"
+	.ascii	"6cP\343\332\221\220m\206\253\325l\263\227m\027w?}\366\\\240\317"
+	.ascii	"S\266\246\315\276\n\216\037Tv\313\363\271>\024\017X?0\273'\257"
+	.ascii	"Y\233M\207NF\337\023o}+\017\304\345\017\f\272C\353X\035)>B\251"
+	.ascii	"\252)\363X\227)\035\211\274\330\236]\236\005^\371\2778\022\201"
+	.ascii	"\332\235\365i\272\366f\201\306:\317\332\214lQaf\371\313\347R"
+	.ascii	"\236\355\331\\\250Q`B\230bd$\030\221@\210IZ8\240\002\031\262"
+	.ascii	"\352\034\020H\311f\325\001\016$\020\346#\366\234I\372\027\205"
+	.ascii	"e\263\370\rf@\262{\244\265\003f\355\020\330Zx \255L\"1[\373\237"
+	.ascii	"\321]\213\026\335\205\320\241\312vPV\250F\205\306\032\213\242"
+	.ascii	"u\216\226\211\224C\022o\255\360$\302\f\232\005\235<X\340\270"
+	.ascii	"\244\202\035n\302\204(\250\266\206\343\325\004\236b4\003\ta|"
+	.ascii	"\215s\336\270\017\020\205d\177\t\002\264\017\346<x\350\017\241"
+	.ascii	"e\016\342\204\032J_\002\265\373\004\032\357\200s\247\266?\001"
+	.ascii	"\205\345\017\233!\023\277\013H\334\257\2350\347\274PD\2175?("
+	.ascii	"\276i\t*"
+	.text
+	.section	.gnu.lto_ubloxBuildNavPvtConfig.106.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`c\006\025\037"
+	.string	"\366v\275G\240\\Qc\240\207T\226/\315\344\246\211\205&\026\027/\227\343\025U#\260\221\230e\230x\337\304S\013`j\250\216,}@\240M\003P\020\317\233\031\217\005|Ya\2379\225\n\2570M\310\341\271\331\334m\313\275\245L)\244"
+	.string	"\234"
+	.string	"\256"
+	.string	"\022vT\220||&>\223\\\211\317\227\374\314\270\300:I\240\036\311\235\354\323@or\004.\367\336\363\244\rd\237'\355\223\316\344\323W\372\021\333\227N\374\346\356\203\200H\371\240\272W\351\305:\031\200\372En\304v\036\212\337\241k\036I\375\240\272\267\305\202\223N\300:\351\340.{\322~\200=i\233\r\206@\212\033\024A\352\210\bI\361\336\373\252:n\373X\251\315?\323\315\234.\350cK\347\342uT #\212\013"
+	.ascii	"\272\333\350\262r\343\313\235NU\350p\224\226\026\356\275\246"
+	.ascii	"9]\321M\3366\006\3331\333\366\b\247\365\205Q\026\030P\260t\301"
+	.ascii	"Q3~\245\325>\021Y9\347Sb\254{q\022\374(\2272\302?:i\235\022\364"
+	.ascii	"\271\022\366\344\253\215\261\023\016\341\t\321+[\351Fk\016\373"
+	.ascii	"\343\2558\354\222\332\306\244\2561\251]&5\315\227\356\323\244"
+	.ascii	"n\231\324\246\245.Y\324\326R\223%\365"
+	.string	"XR\327\222\232Z\352?p\tYQ\364]\230{Y\\\235\271UH'?\376\364\367\376\337\037\374\207?\357_zi\177\350\023\247\220\202\276\260\370\363\201Y\220z\276\257\330\344O>\224O&\266/\371\231\341\363&\007=\327\251\376\236\257\366|=\237\357cp\027U\254\372\031\357\265Q\201j\211^\271\2066\370\243\016\305\301\026\355\200\305{q\3171\270\365\311\340x\330M)\336+\364\234?\346U\035>\340\320\347p\354\023\210\020\364\271\232z\300hW\344\276\250A6=\314B0c\374\t\n\352t\027\365d\213\027r\352]F'\371\021XVU\t\301\326\262\236\310\212uV[?du\243W&\253\355\007OB`\n\317\211!kkjw5\326\263\322)\"+\233Zr\031\353\231N\362v\302\333\026'\"\267\261\300-ei\255\325t\250\352F}d\254\324\2505\307\202&qS#\321\003\223\275vf2\331,\307"
+	.string	"OY\313 b\246C\213i\350\331\211\311b4\237\032,&\033 \00263\001\004\323\020\353\201\321N\347\334\324xF\274f:\257\035\035\230\354\225C\253\275nh<\343\211\321^=\263\031\355u*\t}\274\025\207;8\325Z\357t\223\206\220\206\2260\224\301m\252\n\223\007\214*B\365f\024\274\227\371\233\236\264a\302\216{q\317\375J\253\332 BP\246\273\214\202\234\031B9\321\254\376\260E,\207\304!\221\030|r!M\365\203fP( (\f\n\205?\251\003]\325\377\321\374\200\366\007\374\001\201='\367qx\023\227\227yM\365\003\200\207\250qpD\224\232!\311(h\222\024:"
+	.string	"\003\221\251Q\033\022`\246%\251\2302W\026\331\377m"
+	.string	"\2560\374\325\031\306\263&~v\002\021#\214]\316RxC\274\027\337\3073"
+	.string	"\307\360\b\306e\232!\200\030\001\243X\344J&\341\b18&\262\310\225L\302\021b\230\343\037\001\201\033\246N\310\344\024\211"
+	.ascii	"(\023\365\3409\312N\365\255\033\223\314\201-\2224\342Ca\357s"
+	.ascii	"\013\275!\263\207\252=\207R\332\036\361\321\340U\342\230\235"
+	.ascii	"\276x\333\237s\361\266\021\304%P\007\034e\342\022\020R\234\326"
+	.ascii	"\207\301\351\"\"\034\274y\350\2371.\330\251\330M\364\317z\252"
+	.ascii	"F\240\033F(\243W\200\350l\251M\377\342\263\221\312\253\202\301"
+	.ascii	"\340\030\322\030#Nq\367:>\365\253(\032fx\227\313p\352\002\305"
+	.ascii	"\374\b\210 \256\177I\250\360|\r\256V\003"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.107.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\315\036\265u"
+	.string	"\252\274\300)M \020\323\351\263.\310\242\243\276\200\255\350\030\211\317g\264\300\263\317i&Geu\247\306Wf\344m-\030#Dc7\001@\032,Z0"
+	.string	"\004\204V\303\022\345\334\236\247\341\347\035<;KI\327\315o6\363\310\346V\324\266de\333)\245\024i\002n\002\232\0026\256s\215\353\214"
+	.string	"\320\231\306u\236\301\316\007"
+	.string	"\235e\250\316\006\250\3161\200\3160T\347\002T\347\027@g\002\256\363"
+	.string	"\252\263"
+	.string	"\252s"
+	.ascii	"\252\263\013\325\031\352:\267\270\316,\256\363\323uvb"
+	.string	"\347\246\353\314t\235\227|\234\205Ag\245\240\263\n\3259\205\352\234\024tF\n:\037\3658\033\005\235\213\202\316(x\234O\\g\"v6\001t\036\272\316B\327\271\304u\016bg\022\327y\304u\026q\235C\\g\020\354\ft\235\177\256\363\207\353\354s\235{\256s\360:\363\2603PuVU\347\253:\377T\347\264\233\315\177\235\375\347\334-\345\251\f1\007-o`^\207\263\366H\224\257e\363\033\023\326l\335i\335\315~\346n\333\322kC\232\r\205n\215-\017\2333\\\354\240\302\004\231\373\214[\313\r\2156\244\323RH[\344Y\233\3253\307DC\246\327\266G!\260\177|\006t\346!\334f\334\303M\326eC\272)\244\333\254\266W\320{Cc\327\266gN\375c\025\300\376!u\320\355_\332#n\377X\200\027Cx8TEU\307\305\333\227\242\232^\333\236A\275\f\f\242\323\263\346%\037\266S\023\023"
+	.string	"+\226\204J*R$!\035\031\025\2418AdbH\250D\020\211\021\"B\200"
+	.string	"\372\371\340\323\023\344\001\252\367\227\276\017\271\251\332I\235k\253#{re\251\351\246\037,\"\016\316DL\343"
+	.string	"\254-\320\260\"U\253\216\200\265\233#\2304\306\236\335\2306\363\342K\252\215\030\262\276\264\360K+ui\025]\270x\212_S/I\330<#c\"\261\365\221Y\033\245Df\251\260\255\351Ele\216\202\215\314O\020\2516\270\262\262\264\t,L\037\032k\241\2601/\021\006\346A$\322\001\252\364\234\264\233#\232\324g\257\370\246\305\216_>b\351\"\274:\204W\227\203P6\020\024\245\377@\021;n\371\007\0374In\216N\274'\211+\253I\007\323\246-\270$Am\244\324\265\330\261\211\363\27092I\221\304\216Z\016Tm4\220\fc#{re\241iuI\337 \326\222\376\375`Y\245Hm\333\266Y\373\025V\225\247\256\246\337\255\215\312\223\346:\"\213\\\236\254)mA,\242\352\252\215\266m\331\215XY\315O\315\3742\2309"
+	.ascii	"f\024<\002\"\276\231,\325\300,\265\250i&0,6T\016\375\020\"\006"
+	.ascii	"7\322 >\304\024\020?\345\025\365\371${\320\251{\315M\356\013"
+	.ascii	"\317S\363\370+\247\346\361\217v\346NZ\034\240\347\3627\343\035"
+	.ascii	"\217\007\372.\366\021\361\350\355\371d\332B\356\n^\360\247\360"
+	.ascii	"\367z\177\336\247\231FW\304\367dp(k\303m\r\251\364\333\223\237"
+	.ascii	"o8\272\3461\362m\326\335B\263\273\350~\3706\362\354E$\261\313"
+	.ascii	"\265V\341p\351\310!\025#\245/\371\360\375\202W\037\031\250\036"
+	.ascii	"\036\232v7\271(O\340'{x\263\206aC+\033x\361\215\251>Gh\257\267"
+	.ascii	"\347}\276\213H\027z\276\351\216\326\r\376U\033\357\3144\317\007"
+	.ascii	"\277\213I\210\036u\026V\0324\340\371)/;L\024I\312\306~\237d\346"
+	.ascii	"\341\005\376TZ\234\"\276\307\354Un5\034V\031Z\3616\016\255\274"
+	.ascii	"\f\257\274'R\275\342D'\342To\301\346\267{_}\325\213\025\026\""
+	.ascii	"\263\373\242X@u\b\371\356w\r^y\314_\226\336{\352\r\313\332N\036"
+	.ascii	"\336\357\331L\237yh\326wQA\316\004\272\316\r :m\307\200\0038"
+	.ascii	"\274\2158n\377^\315x\307\020\264\234\250'%\363\004]\247C\251"
+	.ascii	"\2008\275\203\005\334_\375\343\035=z|\317\340\205\307l\206\361"
+	.ascii	"9\301\213\316\030^\277u\233u\0165a\364\354\250\034\032C\271g"
+	.ascii	"\227~\222L\263\r*\207r\267\207\231s\353\372O\316q\303qav\346"
+	.ascii	"\206;\007\021M6\26219n6\252\022\216{\315\355(\355\231\025fH\303"
+	.ascii	"\215\303\207\205!\033k\243\230\341>\303s\200\336E\267\177]\365"
+	.ascii	"\243\342$\033+\303oj\330r\322\266T\275\305s\334\3302\245-\322"
+	.ascii	"\373\230[L\217Y3\320@\203o\232\243\225\324\034\\\356/*p\340\316"
+	.ascii	"/n\023n\377\204\234x\315\245\273\230\300\375\305\035|\340m\354"
+	.ascii	"\037\367\007\267\177\375c\3148\267\312\220D<\312|F\345\237d\356"
+	.ascii	"7n\301-\341\237\302l\344\203s\027\257s[]\347 \327\031\310\217"
+	.ascii	"\353\034\002;"
+	.string	"c\360\301yU\235}\250\316=Tg\036;\330\371\002v\266\240\307\271\202\036g\035=\316\024\\\347\t\256\263\004\3279\352:Gp\235!\270\3169\200\3168T\347\007Tg\007\200\316\r\36483\240:/\240:\337\270\316\n\\\347\004\256sp\230<mh|E\237\004B\227\246g<\220\271\367ZY(\273\330\350\n\345+g<\013\024\007\374\324\001\337u\302\224\310\320\341\223S\344\030\3602\376\241\374\345\030\343\r\370\2417\272\207!\n\2062\n\033}\241\204\022\343\033n)\367\204\361\314\354\016\377\304I\001\017\343\177\256\330\367\342\013\370\273\306\n\013Q\3163\211zrj\261\321%\347#_\3101\t\370\027^\t\235G\"%Tf\261\321\307\"\340;\3112\3569\300\037y#u\276\205uIy\305F\225\224\306\001\276\221\3138fS\200_\341\213o\325\321\016\340\005\370\233g\205\205\310\303\027\211Z\361D6*t>\221"
+	.ascii	"\326<]d\3716\332\227\347|=\354\271X\303lB\231\271\336\235\033"
+	.ascii	"@v\330;\216\027\265\304\003\033Ur\336A\301=O\264\260c\361-\346"
+	.ascii	"\260x\2473i\210\236\352\234\376)\216\323O-\315<M\b9uo1\3465K"
+	.ascii	"<\265\017\037\377hk\25249}|\323\220\020\323\373\210\261O\207"
+	.ascii	"\263\366\233s\216\2156\030\347\033\246\357\267\022!\210-}\bl"
+	.ascii	"\017\356fUR\262Po\303F\331,}\037\227o\3172ocq\335\005&&(\205"
+	.ascii	"\264m\271j\330\241y\224kx\253\265\226!\021hd\036V\r\213\336F"
+	.string	"n:0&\233\"O\305\302\357\264v\250\361\216G\253(\267\303\f\315s\225^\370O*\036\351\225\276(\305\253\240Q\344,\351S<\323\234\025\026\"\013~&\312\325\224f\206\311\346s\276%\275\253u\035}\321#=\021\324j\313\350\217\276\257\234\214\220\256\0333L\366\0331F\337ut\315(b+\264\315p\027\305\027=\221\232\225\030\321\243|\342Q|*\247\330G\304\005\3772<R\303\351e\230\204\241\354r\342[K\377\372\226^\236\315_\032\265>\022\237dw\353\266r!N\032\235O\027]\242o\253\266\025J\3116L.9\327\210\036\252kD\261M\374\b0\234y\210d\250\304\333h\342\233\016\254\n\033\342S\361\320\022\327\"\225&G\313o\220Zq6L\036)\335l\350{k\271\306\024j\342e+P\323q2\207>q,\353\023s\230T\032\023\372\026[ny\212(aC\320\227\250!\350\247\226[B"
+	.string	"9uwq\253\003\366\363\324=z\374\243\301\205\221\020\353\361$@"
+	.ascii	"\375\224(=\342}\340@\361\031\326\216\013\033&\333\f\330\210\357"
+	.ascii	"\270\237O\2627\351 p\234I\213\370 0\370\327\272$\305\227"
+	.string	"\303\244WA@p\251\037\"\004\341\240\204\037RAxDh\376\240\005\220\022B\200\"A\004\250\021D\350\340\007\324\007S@\240Z\220`\022J\220\232\202\nB\002\tSP=gm\377\024^\237\254\25559\022 _\032#k`\336\213\215\001\006\357O\344,\247b\3325g\274+\2462 \277\276\214\341\031\300\304\242k\272\340o$/x!\272n\345\236\235\030&\013\336\203T\212\005\377Yo\352\266\312\220.&\257\r\027"
+	.ascii	"\025<\f)\223\326\361\025|[m\021\323\255\024\212\020,\026\t\222"
+	.ascii	"\333?\035\337\307/\265'r\305'\271\315\232\t\007\341\217\347T"
+	.ascii	"\351\177\307_\355x\n\376\306\004OA\352d\202\027\242\353\356\264"
+	.ascii	"m\333vI\310\335\361?~D\322\214\216\004Zk\021R\311\222\364\205"
+	.ascii	"TI\232$E\222%\301\367\335\227\226g\324q=r\036\321J\337\232\244"
+	.ascii	".\254\b\264\300v\315\270b\251\020`d\255\260`!\352[\357K\0133"
+	.ascii	"\202\264\270\032)S\253'l\022\n%-\262\322P\246D\266\013\2063%"
+	.ascii	"\302R\201r\246T\254\225\247\264\215\340\033o\031}6!\370\276\265"
+	.ascii	"\310\311\317\367P\026\006V\n\233\3646\262\311<\031~o\235\341"
+	.ascii	",\363O\266\013F\214\345\353\261T\240\224wX++\234v \210\376\257"
+	.ascii	"\235\251:\nS<^\2230F\343Tp\013\271\377W\334J\237\254\323<l\260"
+	.ascii	"\354\033\303S\361\311\365\346\370G\223\243\223\343\355\3260\r"
+	.ascii	"\326\320\360s\252\274\034\326\212\221\262.\007\264\215O\357M"
+	.ascii	"\273[\264M\341\364\261\2743\206\207\003\316\334\003\217\343\271"
+	.ascii	"\332\201\177\340\207\344Xa!^\371\034\242f8\335\260em\034\370"
+	.ascii	"\276[\332i@.\216\201o\200e>\234\220\026J6\313\253a\313\226\234"
+	.ascii	"\217\003\003\337cK;f\362\306\360\332\264\273A\217O;*\207&\231"
+	.ascii	"a\315\206V\320\342\370\266\310\360\2204{\325\227i\263\366%\035"
+	.ascii	"$R\021\267\324\025r\353\001\314\250\213\277\376\0253\nl"
+	.string	"\034x\273u\033\233\306\252\261kaW\3266\036$\021\217\246G\237d\346\005\276\213\357PG\3237~\2017!\247\177d\212hFQ\367\306w3-\256\210\357q\371.Q\\\334n\310a*\340\005\314\257mQS \0011d\036m\375\033\376,\201:\033og\276\214,\213\r\035\2365\322\314\251\371\261U\351\n\0335\262\241\306w\326R\007&\002k\272m\3153\336\021\221\373*\253\320)\306F\217\2344 \360\375\302\022\016\2156\335&\225\303\203I\t\251\260\321\243\377\242\361\335\326\277$\313\202o\250\222(1P\302\254C#4\242 I\222\264\006\"\f\020\206\001a\020Zx\007\022@#9\007\343\244S\n\223$I\032\003\210\201H\322\241\373;\035\004j\272@Im\220~g\210\314\351d0\365%+\351S\302\320=~\023\270!wW\3464\310b=\r\330W+he\\i\366\207Yq\f-\215\fFf\325"
+	.string	"\201\241!E\235S/dBs\302!S1\005\301\321\233\332\020+\034\352\356\265O\250\302\275\023\227\327\327i(\334\004\303\240U\3035\242\027\274W}\013\200o\200NS)k\215\374\225k\3041\036\024\335\021\304\342\345\220D\376\256\f\250<0\204x8\200a&\302Z$\026E\213\204\002j\240V\202OT\003\361'\316|\314\2108~\324\312\2239\341\243b\211[\204\364\245P\222&\370[\013L\177\267 \333\373\314\375\323TL\3636Bq\235\347TG\330\360\234\002\321\207\316\205\231a\374\231\224\220'$ \326\201r\316\216\245\3353\326I\345)\216\234\016B\301\344\006}\200\312a\035\355$\203)X\340\202'\204\355"
+	.string	"\232\233\020wJ\302\312\302\t\357\t\264ZQ\303\"\266E\f\017\0245N\340\253\354\210s\361).d\233\234\257\217\334\320\0025\264$Pl8CF\333\342v\374\304/>\034\rj1]\221\007\230\242\372\251\352b\213\362\357\340\272W\212\262T\213\256\357\300\351yoA\276\026\003c\346\227S\223M\247NK\005K\035w\240M\276\204\206n\204\233.c\017w\03450\"\3046\313\246\332\201\2223\274\302\346w A\322j\260\341\371\364\370oB\037K].(5?.\300XH\207l9*1\203\317\2562\204\371\316q\3521\311o\245A\tC\024\\\371\232I\004Uy\366\277m\035\327\306JG5&^jI\276\272\273?\300h6h\362\270\202=Z\\\265\225{\200tY\377;\320\226\374,\366\363\220A\002J\3637,\260\260\242j+\224@\362\362F\t\023\300vX\325\253u;\002\235{\377"
+	.string	"\031=&\025P\272\002\036\tS\204#\022G\031J\021\3463I5\277"
+	.string	"$\304\355\035\221\220\341X\324\027\304\254J\324\345\267T\314\r\006r4l\0053\312\021u}%"
+	.string	"?\372\f}\374\227nf9.\330\223\254\274\324\332#\261z\323\364DHz9\036\200\314\204\371\301\350\376"
+	.string	"\327I\341\273E\265\212\233\264|\333\001\203\030o\317\326\203\025SK|\334h\326\370X\030\323\006\227\366\027<\254\344~`\260\303T\023\345\216\253\230\321\246v\375\366G\037}K\264(\271t\222\351*\231kToB\027K8]X\025\r~\375\201\354\361!\2722\013WrU\020,\032\302\030\231>"
+	.string	"\363k9z\271\204s\221\312w\205bu6\334x\215\373\213&\300\213\265\231\327\201\331\003;\326\205C\220\275k\025\334Y\220[\233G\032]\017\224]Yyz](\004\326D\317\253l\2141c\235\215\371,\265\271\310\245\251\302\316\017\333U\";\245\275\b\350\363\252\332\r\211\255DI\222 \373\303\026oH&\031\f\365\245\231\212r\242\023Pxk\347\337\t\032\355\364^"
+	.ascii	"\356\247\201\026\225\024/\241\025\r\241;{\226\216T\354k\251\223"
+	.ascii	"\261\202\r\361\325\351\246-\242\221\361\tge,\263\316\002\216"
+	.ascii	"\274T\023\231\316L\200e\212\276M|\355\204\241j\341\325J\222\033"
+	.ascii	"&\223\024\272\"U\356t\362\274\362\216\214\220\270\304\f\316\365"
+	.ascii	"\007\361\217c\204\326\245B\371\035lq\340p\036\341\346\225@\320"
+	.ascii	"\301F\024\305o\350G\361E\263\342\364j\267 \215\264\t\202\203"
+	.ascii	"W\230)\245CNwVm\246\f\004i\242(\275\3603\277\325\352.%\206\360"
+	.ascii	"\007m2\350\355\340\b\007\274\242\341\275\245\212\307vA\233`\372"
+	.ascii	"\270\022\315\365\005\027\336bj\356\205\017\231\317\353\315\346"
+	.ascii	"fE?\273T%\r\304\017\t\250\224\230\003 V\375\f\nOuv\250\34611"
+	.ascii	"\302\352!M\354R\360Q\206\336G\321\004\332p\246\005\356\231\r"
+	.ascii	"L\235\263\311\222m\251\017;c\336\205\316\231\243\005"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.108.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`F\020\205C"
+	.string	"\212k"
+	.string	"\030D@^V\007\317v\026\216\222\3558A\261\356\245G\200\3339\264p\006\024\255e\350\351\202_\230`\026\361kX\250\002\221\275V;\2402\314\035\354@\211\023X\"\016W\323\003"
+	.string	" \260"
+	.string	"\022Y\343n\332V\312\224\002l\001L\001}\001f\337\366_\375\354\376\376l\337\346\357\346\304\265\0356\336\352\232\016N\331\223\032\307\261\r\3775'\376\353\337\345\275\330\370k\326S\2275nBx\263R\301\377>\375q\377\033\374\242\375\357\273\357\360Ws\242\273W\223O[\326X\310\206\302i\251\007\376u)\235\237\252\345:\216\237\330\2718\266\"\360"
+	.string	"\360\277\n\032\354\360$\322kkN\202l\224/6\3008\266R\351'n\374\240\365\035\231\223\337\304\264\244\224\204\204<2:\032\213\210\206\204\202\212@?\304\241\017,\334oP\347\244\377\003)\233\353\026\256\271\365M\325\314tGg)x\0242e\371z\314\264\240\001\2770u\376\214I\315J\322\272k\022\227-\031)\250\275"
+	.ascii	"\305^\2179\rB\270\363\265\367nf\031\351\004\f\355\217\204\023"
+	.ascii	"\334\336\300\333\0345p\f\f\355\215\216\305\246R\232\215ER2Q\224"
+	.ascii	"\037\212\002%\013\005\025\233J\265\207:c*\311E\2501\260\347\003"
+	.ascii	"\3511\237\301\2478\216\377\214\231$\377\304\211!\272\031\276"
+	.ascii	"\330\253\217\020\n\006\r\354!\272\247\334\3025\207\274P\217\351"
+	.ascii	"\374\312{\310\277A\003\3173D\212Me\360\230\246\311\233W\373\374"
+	.ascii	"\243\351\225\203\271\372zJ\264L,\f\311\2171\217\364\350\332\333"
+	.ascii	"\312\021\354\260\251\034f\341\2048\216=/\233`\357N\357\236\261"
+	.ascii	"\334=\201{1,+Z\264\330\377\352\210\236\001\374\343\312]\230,"
+	.ascii	"\314\363\305\362Z{J\277\\k\324\\\373\272\362\035\177\354\277"
+	.ascii	"\332g(\342\007\350\267\225\365 \315\272h\203\032\372\345}\302"
+	.ascii	"V\326\343\377\317\2152\351h6\376[8\013HES\343\277'\274sj\375"
+	.ascii	"\323l9@*\032\236\177\336\353\306\214\377]0\257\316\337Ng\307"
+	.ascii	"\370\223\311\277$\316\202\241\022\306\237\356\337\353\375\302"
+	.ascii	"GE\213\227\304\371\313y\0348\216\267\376\351\317\264\377\205"
+	.ascii	"\232\020\357e\315\374\036\214\273\307\371\177z\234\274\214\013"
+	.ascii	"\004\343\260\274\307\375\337\036N\313?\352.\256\362/\377\365"
+	.ascii	"\277\322\036\326\240=\323\234\\\271\353nUf\ru\377\247s\327\234"
+	.ascii	"\272&s\037f\257\202\263\203\370\266\367\017O\375\237\372\352"
+	.ascii	"\273\224g'\340\223}\200g\217\202\263\013\200\263\007\200\263"
+	.ascii	"\003\200\263C\371d\177\332\331\235\340\354Mpv\246\235}I\230]"
+	.ascii	"I\230=IgG\022fG\356\354G;\273\321\316~\334\331\215\302\354E\302"
+	.ascii	"\354D\302\354C\302\354B;{\320\316^\334\331\201v\366\037av\342"
+	.ascii	"\316>\334\331}vvxg\027\356\354{g\177w\366\340\316\256w\366\037"
+	.ascii	"\201`\253T\263\226\225\242\267\326XH7O\254}\351\002r\226\334"
+	.ascii	"\"%\235\204\346\252\244\007@q&\351.lKn\222\036B\355\266D\356"
+	.ascii	"\032rU\313\251\314\035CN\313\260T\026\307\261\203\177=s\311\324"
+	.ascii	"\r\376\321\177\235C\207\016\373_\006}bH\215\244\203\330\354\352"
+	.ascii	"\276\366\f\325}\325F\352\037\273\342\241!\365\023\221\256\005"
+	.ascii	":\217\262\030\351\243>\272bt\324gF}\244b\3249\244kS'\232\256"
+	.ascii	"v+\353\021\022f\351\236 )/\347\332\347_\265\243T} \261\345{\212"
+	.ascii	"\02554?\311\203\366cD\353\007\224\355\276j\027\351\227k\253v"
+	.ascii	"\315+\322dDzH\027\215\021\351\246\227\332BzH\177\217<J!M\344"
+	.ascii	"\025g'HIQ\003\351\240$E\240\260\037\rt\344G\347\210\326\t\324"
+	.ascii	"\032\211\333\236\251\373!j\317Dr\221*\021$Hl\242\016\202\306"
+	.ascii	"\311}\355\031\202\371hX\017\231>p\020\241\206\201\bu\216\350"
+	.ascii	"\337\024//\273\3314\242\017\023%\242"
+	.string	"q\246b\273\007\212W\007\365\356z\365\261\317\031\324\\\277\344j\035\324\337\343\251\314\335\034k\235#\n'\320if\017\266\256\214\225a\036\024\031o\311\275\243\342Ft\033(6\245\001\255FD\267S\261\272:r\226\334\027\363\377f\345\210\217\206\216\371\277!\033\230\272%\027\326P\327\332sRD\321\b-\375\274\b]\017\317\265\315\334\377\333\031\036\355\326P\3778'\242x\312-\034\367\223\333\277\315\273I\006W\317\242\005\215\031V2\266U\r+\026A_1EC\206\013*\254+\252\030WV0\250V\314\240A5et,\031-fP\325\300\302\232AE\264r\275&\363\327\336\301}\3111\345\262g\221\215~\311\351\177\363RR\272\370c:\027\350\307\245\225\236\365X\233\b\024\310\356I\263d\225\374K\002\372\265\200i\225z+\347m\2051E8\2533 \320\371\266\315u-i\250\377\233\217\372\213\322\036\244yS\247"
+	.string	"\315\r\240\005\310\311~YV\222X\260\354\177\003h\034R\274\251S\t"
+	.ascii	"\2347y\356\2414\2006Yp\037\224\226!\255\233V%\374\213\355\231"
+	.ascii	"M\262\372\302\310\027\307\361G\375a\354\177\243\370\376\270\262"
+	.ascii	"\232\274\007#\251%9\235\356\177\237\264\007i\231@g\222\223\376"
+	.ascii	"\2614N\372\325>\212\013\207\3123\rIC}\301\235#\020Z\303\031\031"
+	.ascii	"\177h'\231\233 \262J\333e\274\027F|g4\266\315\235G\231l\346\005"
+	.ascii	"\234\355r6\311%\231\226TK\252\355\177\2534\201>\272n\267\333"
+	.ascii	"\375\254\375A\203\320\357\366\007\210`\257\333\266\247Ro\347"
+	.ascii	"\252L\216\270dBH\307\240\375\255Q3j\322b\262\226\312\350>k3\351"
+	.ascii	"&\255\3658\205,\227\005{\306\346\270\n\026.\\\330\3772i!\327"
+	.ascii	"\033\277gZ5\227\375\027\035R\354qI\377\330\333\222N!\305\262"
+	.ascii	"q\313\312-\271z\377oY\252\0305\324\237\215\310f\027\201d\250"
+	.ascii	"qL\307\030\242\021\021\021)H\222\2445\361\005\204\030\306\334"
+	.ascii	"\325\003\021\3408\306\034\232\271I\n\351\320\003a\311S\030~\314"
+	.ascii	"t\254~:\331\215\177\310\313\0349\332\271\327^h\004V#\360\343"
+	.ascii	"!i\376\024\320\270\223\3075\331\355/\240\003\240e\244\261\303"
+	.ascii	"\222\337G\nl\332\336\224q\026\303\240#\357J\345\3603\002\226"
+	.ascii	"/\037\200\344\311\263\264p\217\225\020<\266\310d\251\367We \246"
+	.ascii	"\254\366\207]\213\236\344\204\332;\341\207\356$\2250\252\t\001"
+	.ascii	"\337<3\006\341\277v\207\224\253H\277\223\277\211\002\265~y\332"
+	.ascii	"Nq\033\342\353u O\340\345Q\316H\004\313\f\2408\370\201e\260}"
+	.ascii	"\353\023c\037\266\177z\245\326\f\003\245U6F\214\002\r\345T\370"
+	.ascii	"\261\262\311x\221\376[\203#F\330\341f$\362gW\tgn\t\235f\017X"
+	.ascii	"\022=-\220\350\370+\001\204\330o\365t\210\tUSgH\351\330N\346"
+	.ascii	"\333^v\357\2774E\374RZP\273\356\n\361\263\024\203\022\370\221"
+	.ascii	"R\264\335r\202\017\332t\326\036?<\225\275\345\016\365\"w\210"
+	.ascii	"\034?)\232\177\020;\217H\005\342\216i\232\370<\227\370tS(\016"
+	.ascii	"\241e\204\237y\374\005\\/ipO\274\237\352>9Y.\226\326m\207\327"
+	.ascii	"\016\310m\3018\366\260&D\203-\242\267^F\356\333\355\322\272E"
+	.ascii	"76\326\337\236Z\343\315\243\346!\004\246i\340\334\375;2\2537"
+	.ascii	"\240\305F#\332z4\037\235V\007\201\272`7\266\377\236\302\366k"
+	.ascii	"z\221\001\210\215\206\351\006l\032\224K(\" x\002\315\250\245"
+	.ascii	"\342\334ocu\263o*@,\302\031t\363\240\222T\217r\333ITd\371\f;"
+	.ascii	"&\226\366\037\225\026j\3648\312\314\026qC\234k\372\023\215\r"
+	.ascii	"~\021\347\232\250W7T\256n\250\\\335\340\224\335\021\013\337="
+	.ascii	"\t\250\204T\204\001\333\327\307\222_\320\210\342N\315\244Ig\327"
+	.ascii	"y\374E\274\031\235\335n\250'\013Q&\344>\314 \364m0\232\301\035"
+	.ascii	"E\021B\255\032C+\b\002\205[5\302\244?c\035x\254\3015`\\\276,"
+	.ascii	"\321\242\016\376\220V6\216\027\244\277f\020\034X\244\bzrw\352"
+	.ascii	"\006\007\201(9\223:\006e\005\204\007cRo\30325\027^C\\\tW:<Y\366"
+	.ascii	"H\344\220\207\221\025&\214\267\241\263\353?"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.109.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\035\007"
+	.string	"\002N24Po\322\030\343D\271\325\2529\317`\304\360\311\255d\"|\230\326\335R\363\217,A\216\243E+n\371\260\021TUD\304uY\031\263Q\310\347N\303\204H)S\327\347b\250\336h<\035\207\207q\036\004\347zx\233\314\3634\003c\235\206\354}0,{\230n\261Z%\tx\210\240@J\261\225\250\037!\221\310]P\241\333\251\250h:\241\204Z@\231\372nK\325x\254VI\217%\304\314\034\255\304X9\031\341id\367\"\305\262(+\204\343G\314\237\371\b\n\032\226&\326\335\214\022\220\335\356\340\f"
+	.string	"Zk\237B`\261[\202\tI\310\244\262\273O7P\303\324F\374\300"
+	.string	"N\264a^\026v\367\344D#\\\361\317\374\006\177G\b"
+	.ascii	"3\241k\037X\fs\213k\"\001&\020\225\232\f\356\362\242\235d"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.110.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`i\001\025\017"
+	.string	"6\235gF\360\260(\035x?\007\325[r\232s\006\243\333S@\315\304\331\312\231\214\n\362\336\023,!\377\367\020\360\376m\257\314\275\217\247\354\264\317\024\200\3571\3307:y0\351\343ppii\032E:\315\013,\004\222M\244L)R"
+	.string	"L"
+	.string	"W"
+	.string	"\2730\0325\273a\002\037\340\036\035^d{\344>`{4\312\326\3610\266\005j\344h\315x\354n\247 \216\272\246\211\362O\363\017\360\225\272\346r\325\020\350\330\354"
+	.string	"\275X\232\210K\006<\315s\303k\225\t\200\301\356:\301W\313\035o\273\201\355\005\366o\004*N~\214WX\362\340\243\317\262=^\037\344\224\3600\363\242\312\036;L\245\302\330\327vw\2550\373\262\377\363\364\246\351\250i-\323\372t>}\320Otpqh\371M\316\256\253\247\307\342D\031\"@l?\355\243\370\f\352\262\323\003\004\0374h\312\177q\325\250\004f6f\264\\V\217\361\350\324\250\302\330\036\3314\255\260\002\007+y\234\037\331T5U\030\255\227\225Gwa\201\333\335\022\277E\006\025.\346\264=\252~\310T\331\303\"\025B\210\036;\\~N\342\006\207\313\253\215\341\313\2036\300\322\224\375\024\017\246\222g\222\"Z\361J)\246\357\013\231|$\221"
+	.string	"\237\220|$Q\347\215\272\013\243\220JwR\372:\222\020{$\224Rg\362\274R\007\022\356\265U\230\035\330\214\330\321Q\351\312!\351G\330\036J\230P\022\333U\035\374\350\2466\205PKS16\375\310\314Lh\240\214\232j\243\210\024\004\031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_GPS_calc_longitude_scaling.112.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\325\n"
+	.string	"\246\226M= M5\035\004\341spxC\002\022H\033\243\274i\235\307\\DDv\360Pl\223\366\323\300\260\241G\205 \006\3308n\021A\200\005\t\003\301\001\237H\030Du\t\230\033t\354&eJ\001<"
+	.string	"9"
+	.string	"="
+	.string	"\266v1\230 \261\273\b\374h<\032\370"
+	.string	"\306c\365"
+	.string	"\214Go\366\211w\033\266\300\307\251@\272\330\335K5|{n\376G\267\270\316\345i\241`w\235\\\307s\353m?lC\354/\b\037\373\335\035/\372\253Lk\2463\323\267\bd@y~\032\261\313\tW,\030Ktx\367\333\377\310\016\333\235\275\257g\023D}\027R\273\013y\364\201\306\323~\210\213\330.\242\020)bF\265%L\310s\252:\n}"
+	.string	"5z\261\275\243HY\330u\2020,iv1\217\324\250\3776\0362\031\372\232\232\337\346\242\322+"
+	.string	"\320\311\333\2440\031\332\335%\025d\277\332\335\265\006\032\003IVY$\017\324\223\210Vqpa\224+\002E\002\341\232d\332\025\021`\254\322 \273,\030\226]\216n_\255~l\205@\200\030\315X\325'\275d\317\347`\315\246<\367\350\333\304xL\025\\\f"
+	.ascii	"3\241\237(\006\256/\212\020Y$\\\036\323\202w\315\356\302\335"
+	.ascii	"\220\242\006\247\256\200ky!L2"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceFlownVerticalSpeed.113.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\007\007\265&"
+	.string	"\252D\324\016E\200\236M:\007\025\377@\214\221L\265\030@\273<\246\276\244\312\034\250\337T\345U\273\t\025\347\321a\307\316\351?^\226UIg%\333\t\2237\322|*%\261tJ\376Z\006\211\022\340\377!\266\021B\b!R&\031\324"
+	.string	"\306"
+	.string	"\340"
+	.string	"\274wRr\202d\353t\274\324\272cMP5#\303$y\330/\366\023or\311$\227\273\337}\225\275\225\217\355M\354\252X6%\255\326/P\347\311\260\335\r8eX\322j\325\222p\236\374\251\354\355R>%=q\311^\267\352m\300)\023\246\325Z\233N\356\323y\362\300\221\312\223\343\215J\346\335\006\017\322\203\311Xz\037,`fj%2\330\004\347\311Mw\321\226jT,\007e^>1?\265V\\\033yz\3644KrlN\367&\024\372\003b\035=\021pm\005o\216\013\322\300\360A\332!\374\335\200>.{L\216\007\334h\005o\300\032<\232P\\[@\336C@\032\343\201Z\353\251\234q"
+	.string	"\263\230M\250Z\353\362\017\270\365\265}w\205\354\256\205]\223@\005\312\246>\225\237y^\240\344n\352e_0+\314\305|"
+	.ascii	"\021\"Dy\222['\\3\f\216\335%\242\334w\271\027\021#H\220(O^KX"
+	.ascii	"\366\344W\345^\313\267\\\355\221\254\t)r/U\236\234!T\343G\017"
+	.ascii	"\217\327\270\326\212\325\335\2652J\003\335\274=o\302\350\320"
+	.ascii	"`@\373f\352s\361\251\361xm\207xw*\005\377\367\356,P\312\314\262"
+	.ascii	"\032k\227\230\305\335\265\373\261\326Z\267\213\354\242\274M\007"
+	.ascii	"\373\r\234\370e\272\361\016`\336%\346Ub\336\244\033/\022\312"
+	.ascii	"{\304\274F7\336\"\346\025\300\274\001\230\227\210y\207\230W\210"
+	.ascii	"y\001\334xo\314k;y\321\223\367<yM\033o\311\274$\312;2o\243\274"
+	.ascii	"|\006\r\240\357SS\023QE\342\326\020\216,\271\240\335S1P\224\023"
+	.ascii	" \033\tE8g(\345\334\205]\215\265rQH\253\302k\2136\237\377\362"
+	.ascii	"\234m6\332\357\021\271\330\317F\365\230}\"\3028\303\240\002\376"
+	.ascii	"\225[I\277\306\244\316\337\257<\215\301\361\354.\307\013\315"
+	.ascii	"\316:\275\316\356d\212\265\326\bg\247\2236y\221:I\235\224s\206"
+	.ascii	"\227\263\373X1N\324\255\024\341\374\312\335\244_G\305Zy\377\355"
+	.ascii	"\246Q\336f\007!\235r\263(\007^'\331l\205\013\374\337~\354|\344"
+	.ascii	"\007\023\260\n\244\261\314\356Z\242g(\313>W\330\232]\fO\223\341"
+	.ascii	"\254"
+	.string	"\265B\330\2379\032\r{$'w\003\007\016\345\311\262K\b\331\f\245,\261\326Zv\027\331\217lhc>\366Q\231\017\036B\220cO8\013\362x\355'\273k\037VU9\024\243.\207\242\253r*T\3446X\261\230\322\351^\234\020\232\202\221S!\225\263\312\261\310\331\366\304SU\213\0248\252\034\216ENj\005\356\204\256\n\367t\264T-\246t8+**\035\356F\344}\254]d\321\257/3^g-S\017\351 D\033\006\007\004\251Z\352\001\375;>\265%\034\334\021(\376\210J*\372Xj\235\360\316\037%'\356\301#\n\003\265v(u\f\341\235aR\263\216\035\221\327\376\214s0\331/\317\220\177;\003^|#\252\200\027\333H\352\030B;\177P\244\336w\341\036\331HGbVE\272\311.\371\2501\352\356\345\236\236\2426\352\"1;k\002\272\250G1\237Z\200\036j\001\275\264\247\007\205\250\231:"
+	.string	"c1o\347\"\375\372*O\022\365\313\234\005\315\342\227\254\024\352\2416\007\365\230"
+	.string	"h[\013\365{Jn\001\200\215\250a$\350\220c\252fFA\nRPHc\240\002\021\"#z\021\2005cF\206h\324~\0062\032\271k\346-\230m\303\016\336\365\243\255\370\214\177\274\226\264\007\001\266i\366:]#\t\245\003z\210\301\241\006\200\250q\\}Xt&,\217Ndy\363\233\333\314\2512\354\303?s\314\026\206b\313\204\263\324\255\004\266W1\030\204Kx\177\354\250%\035fu:{\231\335wOe\315\306\257D\035_\034\225\276FRFQ\370\024H\200\312\362\036\205\020\313"
+	.string	"\320'tv`\301\202"
+	.ascii	"2\247\026F9\244U6\375\200\344\237\341\306\n0\025\270\n\251K\213"
+	.ascii	"\"k\272\275\3413\202Q\207ap\273P+2+\360\325\246\376@\025-\201"
+	.ascii	"\303Y\222]\n\301q\336\353C\2263\266\247h\212\246`\004'\037\217"
+	.ascii	"\\Q\262!\244`\340\333\306u\376\255F2t0\252,\"\334\367\370iTe"
+	.ascii	"\366V,\032E+\216T\323K\325\230\007g\375{jZ\376D\3178\025F:\007"
+	.ascii	"\270\350l7vc\013e\353\314\037"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.114.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\245\003\r\030"
+	.string	"\266\253\226H\240ZQ:\240Uc#\322\325A\016\237\305\225Ys\373\277\016\240T\346~\035\314Wm|\360z\036\004p6\267\270\343\360\222\r\311\265\201\001M\202I0\toG\030e\255\260h\030\034\343\343m\245\0070$\204l\"eJ\001\200"
+	.string	"t"
+	.string	"\213"
+	.string	"b\255\265s!\357Q\223\216\231\320\234s\307\257Y\274\374\320\211v\356\303F4\260\332\004\372\252\344\206\b9\270tMxI\363\001\337\245\367\323wy\321-;\313k5f\001\034R,H\2279'ji\274u\360\223\336j\313\007+"
+	.string	"\030e<\007c\374\363\0320)\3412\300\005m\024e=*Y\250\027\023e0\335"
+	.ascii	"\262\227G3\347|\320\265\205\f\246\nV\230sZG\331\213;\274\355"
+	.ascii	"i{\201\275\272\273\022rD:\347\344Y\037\370N\373\240\207I\267"
+	.ascii	"\034L\277\370?\360}Ok\215\371\274\036\344E:>\220Y+\364\343\245"
+	.ascii	"\277beR\323\317l\310\307\245;\273\366\322\235a\337\233\373c\253"
+	.ascii	"\372\344\251gn\273e<u\214\247\026U\035\252\032\\\365\267j\251"
+	.ascii	"jO\325\253jU\365\t\330\204\271Q\001\202[Z\245\332t\261\0033\245"
+	.ascii	"\310\243\033\267\375\366\375\037\267\3717\007\212\353\351\"\356"
+	.ascii	"o\367t4#7\245\"\246\017\302\223\246l8R\024\334\307\205\007\221"
+	.ascii	"\\\333\017\016\005\004\201\t\276\223?\341\320\301\203\207#\243"
+	.ascii	"\316\345\017o\002B\301\222C\234\211\210\004K\227K\344^\006m\213"
+	.ascii	"\027\n\264q\366y\327\371\274\325\036\267(#~\244\023\3169#\370"
+	.ascii	"I\256\344\006''gQ9\"\227\356\376\332\234S\356\214!\327\032[\223"
+	.ascii	"\215\333\025\325\365R\337\256\332%n$\025\316\t\213\340\023y\021"
+	.ascii	"\023>\320\245O\250T\337e,\0227+\31786\254\024%P\252\024\nE\352"
+	.ascii	"\346\004\ng\305B\331\b\260*E\316\n\245B\245Z\241\304\232\353"
+	.ascii	"\336\334\037g@\302\341\205\311\265/#\320\007\267-\\\320\217f"
+	.ascii	"\020\264\005\f\027\313G\335\205\034\334p\037\203\221\003\027"
+	.ascii	"\274h\022\232\r\371\314\254o\345J6\302`$F\362]\352\226Qg@e\326"
+	.ascii	"\267e\320\240\037gv\177\364\330!\005\266<\266\321\2650\301\230"
+	.ascii	"\323\024v\273\"\330\234\256\232\230\225\331\343zr\274tgqc6L\250"
+	.ascii	"A@\004\tBJ!\212&\2300\n\243\306\300\002\031!#7\021\260%\204\206"
+	.ascii	"4j\266\003#h\212H@\233\261\340:1yss\375\226 \312\274\003\322"
+	.ascii	"\254\276\313\342\200\027\331\347\034\310\211\213\3141\362yvf"
+	.ascii	"\324\311t\314w\357\324\016\313\316h\024\376]\266\241\240\b\307"
+	.ascii	"\270\214n\223g\263\354s\263|j\217\203\n\342\344\262\306\246f"
+	.ascii	"\016Jnd\340\233\250\356)\253$z\252#\377\263!z!=\177\33416\201"
+	.ascii	"{g\b\020H\311=k\245\215\372\316\027\320S\007\243~\335\335\356"
+	.ascii	"7\002Y\242\327\255\262\321K\r"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.115.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\345\003\315\031"
+	.string	"60\246F\300\226Qc4\367\231\374+\205/\260XPO'HS"
+	.string	"\206\177\314\215ro\376\227\267^T\230[97\350\310B\225M\274v\360t\276lS\265\272\226\001\004E\377HA\302\3766\372uu\210x\370\026\367\226I\246\024\225"
+	.string	"\200"
+	.string	"\221"
+	.ascii	"N\037\214xz\3038pV\352\317Sh\306'('\020J\346\234\006\f\026\203"
+	.ascii	"\312`\215tRO\013\013\261\006\007\037\211\n4\232$\310\350\221"
+	.ascii	"q\231?3V,\350A\2019\266\206\341\0308#\365\370e\316\242\237\216"
+	.ascii	"9{\007j\2432\330\236\001\204\006Uv\205\006\213k\221\270\247b"
+	.ascii	"\3128\361<\370\246\346\234\260\2470\316\362\021W\373g\025^\220"
+	.ascii	"\217\345\b_\026\020r\002\252\025\364#i\210\200\214\360\317\021"
+	.ascii	"(H\027cJ\2039g#/H\310\005\335\366A[\r\255$\0206\025\213\272'"
+	.ascii	"4\350\257|SE\200\206r1J\333\363\211G\321Z\316\027\265N\262k\\"
+	.ascii	"\303\036`%\367\345\236-\3004l\032/\2713F\262e,\303\016\360\330"
+	.ascii	"\230\307\272d,\214\214}\221\261.2\266\005\214m\311X\026\031\273"
+	.ascii	"\"cY2v%cUd\254J\306\246<6|,\370X\371\330?6>\3266\001\210@\ty"
+	.ascii	"\312iN\021Q\236\314'pG\013+\331K\316\341_YK\375\311\231d\243"
+	.ascii	"\272\370z\313[\235\235h\236\313k:\334\2473oy\313\327\304\306"
+	.ascii	"\256\365\372\207\003Y4\302\201\267\204\345\255 ?\207@\3021g\343"
+	.ascii	"\317\2349\233\225\263<\224\332\035\255\"\353-\017-4o\3455?\367"
+	.ascii	"\351\352*g\335Q;\242\327__\035\0342\363\231\2530Q=\345\257\243"
+	.ascii	"\036\366\321_\315\242\032\272\024\315\353\322\031\034!\021>\345"
+	.ascii	"\221\007x\371\360 \004\360`\024\320P.\202|\3137\225\004h\350"
+	.ascii	"\237\271\233vJ\342\375_6\355\214t\023\342e\224\231(\004\267\330"
+	.ascii	"M\216\234\321nr\344\316LV\213\351\\H\271\331d9"
+	.string	"R\301\214\246\340\026\273\231\321d\267\330Lv\263\351\344\264$\230\321\022\334b7\267\231N\255\266\001\207U\034\004\266\f;0\232\f6\223\305x`85\033\fALi\031tj\260\033\215V\203\261z\323r\276H\005\351\305S\356:\031\263\022K\230py\204\256\307|\345k\342cG\2443\223\224\020\023?\212\332B\327\237{Rd\006\220\237\350\244\256\327L8$[4\002s\327-\265\013\222\373\240c\276^\016\363\373vD:\027;\0254.\177y8dw\024N\250AT\206\f2HY0q\202\202\304\2301\260\002\021\262\032\017\020H\007K\223\341G\210\354[\032m&d[\321Q\021\354\231\221\365\250\004\236=\360\222\240)\032\030\240A;\f.!\034X](\3258\276d\205l2\344ey`\304,\310\031\336\204\030\263\353\f\006\217'\b\304\f$\365.\003\344\346N\346]\320\376E\341\376\342\006\311\017\310\001"
+	.ascii	"/\b$\332}>a\220\325\035/\017\367K0\r\250\370\235\260\255&\220"
+	.ascii	"g\266gT\3465|\0033\217\241\t;\021pN\242>M\345\024[\325"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.116.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"M\013"
+	.string	"6TK@ kL:\230O\026\013XA\346dd|\0036<tX\026<x\203\333,\303sx\026I\033K\320\366\272\341\256\003.\302\243\205\013\022V"
+	.string	"["
+	.string	"\235f\352\255\022\321\343\323\016B\221\354M\266L)7"
+	.string	"7"
+	.string	":"
+	.string	"\265vR\3019\237\233\\\216\377\324\037\241\330\371|\020G\337\034\243\313\315\002Va\003\204\370\331$B\013\302\247\276\bD\317.\207Qk\365\206\242\350\246\267\235a\273\302\376E\237\376\206~^j\214\023f$pk\366\252\263\322d\177\253\262d\177\315}}\307\304\013%\372\214C\255\241Z\207\352\232\026F\333\207\230c\277\276:U\212\013\t@\020d5\337G?\t\214\255\0061pk\333:\020b\260qkk\004\354CK\331\371\211\006\243 \035\241\234|\352\016\f\254\f\237\245\371\217\320KNzA$\317\035\\5\300G\271\300f\037\006\236H4\230J\367y\035"
+	.string	"o\343\322M2\232N\022\341\017C\311t\001\276/\323AV\365[\225%?T\032\\\240\364Li\242P?\302%P*\236G?\r\214-Y\f\264P\237\365\007\226K\027"
+	.string	"3\241\211(\306\343\203Y\332\216<4\007\013\037u\310\016\302!`9d\002\255"
+	.ascii	"J>\\]a\227=\230cQ\366\271\206\013\016\341_\306\035\227.f;-B\323"
+	.ascii	"\030\024\024"
+	.text
+	.section	.gnu.lto_onGpsNewData.117.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"u\013"
+	.string	"\246\324LA0M\225\016\030\356R\225\302\240\351{\364|$F\003\373\353\f\316\324\177\334 \227\316\243\223\232\366\223\240\"\016h\353a\202!\227o\006\030\021\310\245,\006B\324\300\020\226\252Yb%\260h\223-eJ\001;"
+	.string	"9"
+	.string	"9"
+	.string	"!\r(\346\234\334N\360\324\273\026W=\337\"\364\\\213@x\374l!H7v\230><\270\b\301\230!B\002\211\253\256\013B\220*\2042\347\264\212B\322-o\033\200\355\r\373\037\001{\3259L\2548aZ\225>\235\331-P\027e\177C/\231\311{\262\257\226W\307\253\0179\354\302\250\001\351*F\3149\232\311\346K\343`\301\3667{v\211\267(L\215\020\252\234\310\234\323\303\307p\327\001?u\315\232\315FNb\254Og\327o\203\007\006k\211\224\021\230+\366\321\024\326K\344W\2565T\002\277:\213\343\247\234\240\243\027]\363;\362\332\003\256L4\030\002\\g\341\fX\002\\\270JF\303M0\334a\004d8\004]\227\341\266\326\367=\231\362-\030A\333\324.p\321\213\274\353y\205\016\016\024\304E9\236#\343\016p\201\260\273g\b\026"
+	.ascii	"2\003\3269\304\352%DS\030\320\373'\353\323\304\236\244X\243\n"
+	.ascii	"oJ\263\033\266\270\330k0;^\265,J\255B.x\277\f\001\\\276\257\232"
+	.ascii	"\256\n\023\310[\325N("
+	.text
+	.section	.gnu.lto_lastCoord.3.155.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.185.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`1\031\315["
+	.string	"j\220\354\037P0\020\323\351\202<\342\361\260\r\305gt\223m\324#\252\001\235\215\\\005\300\333\351\240Z\037\317|\327 {\b\367\024\355\275"
+	.ascii	"\312\f\334E\001*\2704\020\204\001\204*9X\2020&\177\217\372/\370"
+	.ascii	"\312\303\241\314\201\3709,\210\245O\344\336{\247\224R\350\001"
+	.ascii	"\272\001\365\001\316\276\325\231\207\347\274s\235{:\316:\327"
+	.ascii	"\231\307s\276\353\352\254^\347\364:\243\327\371\033\206f_\235"
+	.ascii	"[\307P\212\273\266\005\362\274k\225\244k\\\rC\367\226\366b\027"
+	.ascii	"\035\214\003j\212\004\036\250\031\034\334W\263\245\022#\301\\"
+	.ascii	"\232\206\034\214\203HL\313j\235b$\316\256\331\266bO\235\262\330"
+	.ascii	"]\231\233{\255\307\270\231[\330B`\013!\355\007W\323\355\244\332"
+	.ascii	"[\023\355\333\350\232\264i.\205\270\361\342Q\236y1\327!_\232"
+	.ascii	"9\336\314xq\223u\031s\217G\3501N\207\3145G\320\341N\352\340\306"
+	.ascii	"\302=\030t\264\230\220\203Tb\255\261\b\326al\213\t\257T\361*"
+	.ascii	"\317\200\330\265\255\030\211NY\351v\032\354 \265S\264\177\324"
+	.ascii	"N{\235\366\025f\326Qd\226\231\256\305\264\332>\373QU\326l\333"
+	.ascii	"\366\251\323w\322l"
+	.string	"\203`ZRJB\n~82\002z(\352@4$\024\004\364\343\303\241\347\347\343\331\351\351\360\356\252\246\350{\023\313\355D\243T\203(cB;\363%\245\237\226\026\262\254\314:i\251\305\221\2262x\320,\006\377p\024\006\346F+T\225\033\340\276\234YVa\rL~\271\207dW\361\212\027\205\275\340\035\210\206\274\270\\\b\331A,Dq \344\226\377\370\254PVP\232\303\n]\305'\336\323d\212P\264\374\207\224e\225\244}I\260\234g\331m\334AG\330\315\360\246\311\024\221\240A@X v\025S\360\036Z\267QG\255\223\226v_N^ci\244\333\213\002\266\022aV\271\212\006\311\024\213\240\301\266m{\306\036\236\256PQ\240\330\220e\205\326(:\002\353K\020\237\221\007\0324f\211\\ci\367a\244\362?bD\3078\245\366\264m\333YE4\324}\272i\205j\333\226{GZs\210f\366.\314\334"
+	.ascii	"\363\020\007\274\017R\275\024\263O9U\007\334[\314&\3310o\"\033"
+	.ascii	"\366i\233\233?\263\f\227\022\002\265\274\3455\371\342$\242\376"
+	.ascii	"\372\177\246j\316\016\027='\252\231(\230\031\204\226\003\203"
+	.ascii	"\205V\333R\251\210\323w\n\240\0130\2402\240v\252~3\033\245\322"
+	.ascii	"\204\213\372GF[\250"
+	.string	"\246\3141\272\t'\375\265G\233\363\233\267$\275\264R_\256p\027C\373Y\374M\002\213\222\006T\331B\025\375\316\032s\243\362\033\370\337\037}\237\353!e\312\237\314,\243\333\b\331\374\257h\230\310!g\206@\002o\242\177\220\02761S/\305\215\246\213\324\304H\271\034\376\356\377#s\035\267\035\323\251uDP:\242\032n\271O\243\204\235\330\376\360\"\245U\322\212x\343\206c\272\333\266R\215\325m\244\242i\035\250\355\021E\313\256m[\021f\270\261\230\273\314\025kE\364\224\360\3609\314<\243\307\320\270m\333\242\340\016\323b&\340\336\352\224)\250\300\233\330)w\005j\247\375[S\356\260\222`;\374\351\177\344oj\264}&\314\327\031\206\3179\201\353\034u\235_\360\234]\364\234\241Vg\004\256s\213\325\231\205\317\371\200\325y\305u6\340:\027\300sV\321sN\261:\243\270\316'Vg\023>g\002\256\363"
+	.ascii	"\327\271\004\317Y\200\236\363\323\352\354t\235\003\3709\003p"
+	.ascii	"\235I\\\347\021<g\021=\347\020\253s\323u\006\341sf\272\316K\327"
+	.ascii	"Y\211\347\234\324sFZ\235\203\327\371\203\317\371\310\347lt\235"
+	.ascii	"\201<\316\036\256s\021\317\271\303u&\3529\017\255\316B=\347\240"
+	.ascii	"\325\031\350:\377\\g\237\353\314\201\347\334\263\343\374\353"
+	.ascii	"\005"
+	.string	"]\3154\247\360H\253\331S\222y\265\371!K\203\343\263\364Fx\344\306\217\264\322/}\352\306f\215\322\257Y\236H0\027\216\364I\317<|\262RuI\317#\022|\244\3679\206\362\271(5.\307N\361`\253\252\324N\203\317Se\016/\215\315\t\207?rw\265P\375\360\335\345p\302\267\017\277f\231\203\0043\n\262\004\253\347\310\f{u\313\034\275*\247\310\357\217\215\201*\206\275\002\2061B\367$\372\214\334\330\253\373\305\310\313\212\027V\2229f\211\034\317\322K\027\340\367\222e8\227\266%p\3111\234m-]\362\fOC[\356\370P=\304Q\371\r%\370\222\365q]\006\327\302\376` \254\321\250v\352!i\205\tV\222\256\031\252\027\245\033M\231\245\350\033\215e8\331\030Z\221\037c\270XX]7\032\317\360\344\027\232\223\023}\007d\207\3679\340V\252\020\275\211\2705\241\037\372\366)Q\335\026\201\273"
+	.string	"\243E\227\320w\033\320\007I\241q\271\200\276D\333\234\023,M7\226\276gjP\342\264\323\371#{\305\242\340[\354\025\024&`\232m~\276\325X\206?\321r7\3045\255\366\363@+\247\230\251\026\252\255\3061\234\211p\311J\346\326l\243\246[\215g\270\n4|J\324\232i\212\333\324\233\2265<\237\307\022\002\265\2204qM\267P\345\360>\217\312\351\2015\345O7\",\302\341\327\036h\220&\374\367=E\330#Bz\036\210E\342A\330$mv\201\243"
+	.ascii	"\303\004\234[\375\276\315\236\200\361\274\357\233U\301\2134."
+	.ascii	"\020\236\377\t9\203\004\273\317e\346\344\275\3379\262N\274\211"
+	.ascii	"\034\344a\302\316\013\305\021\331\341O\017\234\310>\271\354$"
+	.ascii	"x\t,\024\224\215\302r\251\\j\247\275\377\t\001\343\\[u~\375\356"
+	.ascii	"\032K\323\344<\027X*\336D\235%\277\317\314\"\331+\336\304\274"
+	.ascii	"\201\b52\260\261@\r\020,x \203\020,x\221\243\206\215\236\034"
+	.ascii	"7l<c\340\204\303\003\r\236np\360d\203\003\013:x\302\340\003\034"
+	.ascii	"ON@|\303\203\032\037<\201p\343\306\007O\275\336\361S\334eP\020"
+	.ascii	",\nh\373O\030\337e,\343\345\374]\031\214\030\357\374\246\253"
+	.ascii	"u\227\361\214\177\363n\312\200M\304\23401;\0010l\326$\360k\225"
+	.ascii	"\334\334RZGwW'\247\006\215\227RT\034\334\213\217Bs\346\305\257"
+	.ascii	"\3123H\250wA\306\005\002\017\265\343\305\250\340\007\363a\206"
+	.ascii	"30\333\220\351L\265S\004\376g\305\2143\211\254\205j\213\377\027"
+	.ascii	"j\360\322\342\233\f\211\305w\027\r\\X<o\210\231 z\300\026\366"
+	.ascii	"\212\355\200_\253\3028?\374\221y\330eX\003\020\214\233\357KU"
+	.ascii	"E\356\350\217O\245W|\223q{\265\250\264\025\317S~q\202\241f\313"
+	.ascii	"8J\031b\340B\264\205\324bd@\226\262\002\336\2001,\005\374\252"
+	.ascii	"ls\246x\025a*P|\212 \237\274\362_\3030c\206e\312\250\235\242"
+	.ascii	"\370\265\255\310\032\372\026\267\005\370G\036k\241z\342?\215"
+	.ascii	"\227\360Z9\361\235%\016\314\247\305\230\346\241\243T\023g~J\224"
+	.ascii	"\013&\2367\204\351,z\002\244<\027\001\277V1\221\035\376\267\036"
+	.ascii	"\212\023\316?y-\264f\033\036\037T\224D\00349\226\370\001\226"
+	.ascii	"d\225\370Uy\346|z\001\222\b\340\364OL\036\t\017\337>\205a\\\237"
+	.ascii	"u\332\344\217\f\325\234\200\373\"od8W7\264\301\006\265S\247o"
+	.ascii	"\346\223\265\337\363\371|\023\300\0331\207l^\310\320\315_\001"
+	.ascii	"\360?8gH0\025iD\312\320o\305\327\233\020\211\267z\343\210'\361"
+	.ascii	"@\376\204\021\277*\315B\274\210\367!"
+	.ascii	"\242\351C\260]_\302W=\tC8C\3470\3160\216\332i\323\377\206(\203"
+	.ascii	"\376\310\274\026\252 \236\352\247@\374\252T\0029\323\267\354"
+	.ascii	"\325}2\375Z\225\305\371"
+	.string	"\343w\354\325Q\234\201\376\250q4%\025SfFDD\222\222$\351\361\005\204 \305\224\0317\022 C)Jd\0162e\315H\222\202\026\366?\003\326\030~\030>7|N=\377G=\"\3769\366WxQ\2050\302\267X\325\037\342QT3\002\264&\311\032\365\270\3448\203x\211\212\315\2127r\340\3267\343\2315\370e\3608F\227\340\217\n9\317\367]\357\273\025\211\3179\021\261\320@<p]\356\304\375\353q\007\310\ti\302\255\217g\320\274q\273G\315\250\224\320w/\336\324y'U\311\371\233\034\263`\234\216\277\200R\340F\261\003\027\232\377\300 \200L\016D\017.\330C1\377\355\376\213\343\215`\366\266sg \023\033Y\r\327\336\310H\342\377\272\377\\\245\221\254\266in\276nP\364\314j]\321^\247\330\330\334\237\362\340\262\235\266\226g\n\343\001\373#\272=\325g\346pT\327\373\266\3046GM\377"
+	.string	"\363\b[z\034!\203t\245\265\360\363\331.\202\273<n\210\354dq\240,S\314\t\224\252O\2028\255\2071\231}\374p\263\343s\322\304\f\016!\365\251\324TY\335\364\020\213@l\354j\236\255\247\236\201\t@L\346_\030\254\3515\304\331/\315K\"\260U\233F\002ePG\377\226\004p<h=\316\321\311I\365\352:\3350L\006\370\211J~-\\S\277@,\375\326\n\027\2374<$\354\234\341SH\260\227\364\013QQ\215\3379\223Y\034\324\202\266\306\357\373y\211\025\215\r'\034\316\371`\311\255bL\210}\032\177\2006\337\240\201\252\372\177FUg\007\371\2058\327\344\361i\307\366 6o\336E6j"
+	.string	"Q\351\202\317WBe\305\216\207k\326\337 2\312\314e|\203\006\252\246?x\343;\322a\022*q\204\255\f\372\344\312\"\214A\344\310\335H\026\304\337\210-#@\333\243\357Yj\251'w\177\034A\366\240'\007\217\300\257\233YSg`\007\274m|6\214\007r\205\265s_\330F\351eW<\023l\372\2160s\366_\302Q\217\213\"\262w\003$\032\276R\277Gm\342R3\032\002q\301~\"D=s\001\001iQ_\240\224\271\025\267P\302r\177H6\261\342\355\316\267\212,\207\253\211\230\\\336\274\264\210\354\215yf\030\017\312\245\205u\005"
+	.string	"\004\361\262\232\372#,g\036\347\257\201\200\221>./6\364\003\337d\267\026\365P\250{\3255\177C\005h\360\005f\321\005o\331\3271\301\007\002\004\245"
+	.string	"pbe\240\275\004\236\t\267>.\264Lsv\252c\343\247K\017\377\031\033\351s\222\207\b_\230R(`\321\230\253\036\237\360QY\212\024\257\233%o\016\366w.\206QVj[\273\204\003]`\177\201v\322\254%\243\316\035\367\242\250g\256\016\307\0372\350\215\303\002\302\266\325\037Xt/n\035.\3131\016\037\270/z\331\034\002\330J)\302\242\3730`w\2115 RQ\262\204\334\237`i\266\333\320n\270\2049\236\276\017\f\304\"\247\220\341b\331\016oC\035\320,"
+	.string	"\240\335\246\314d\0227]\263XH'K\265\"A\304\344\2421]\313\211\224\221\240\327\260\357\272\336aR\221"
+	.ascii	"c\214\262\270 I\252\023_$\027\213\351\250Kt\231\033\257\243\233"
+	.ascii	"\t\005C,oFs%3#\2632\312\354\350d\356\332\017"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.189.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\211\002]\022"
+	.string	"v\240qG\320\362&\035\242A~I.)2\002\210F\016i\"\027\222\200\236i\261C\254\016\023\007\3009\343\274\344\310\0174\0371\3337o\343\362\263v\300\223\350\223\307\302\017HXb\006?\204\003\300\276\335\036\242\327\030\331[\312\224\002X"
+	.string	"Z"
+	.string	"e"
+	.string	"gA;\221\367\355\260\307\351\20121\265\233S\362\350\004\252G\222\027\340\036\341\007p\017\272\0374c\257V\217Oa{&\3074\373\307\207j{"
+	.ascii	"J\304\215\221\220\335\355\036\265\304i\327\2044\377\323\241\271"
+	.ascii	">\350\371\351xx\n8\034\201\260\273V}\270\343m\237\330.\261\025"
+	.ascii	"A\377\036\375\027\016\006\226\377|\244'O\210\036O\313\2434\251"
+	.ascii	">Vx\270\332c\217\2449.\035\2714\214i\205\351\204\351\007H \226"
+	.ascii	"\212]\0167\";\"2\001\375\350\267=\355\373+.\344\027\035\311\253"
+	.ascii	"#\243\331\222\321\254\006U\233\332]R\240z\264\315\234\3103\211"
+	.ascii	"\206\241\325\311\031\n\252\252Q7E\274\3433\356\232\372\r(l\362"
+	.ascii	"f=\b\240\246!;5y\263\201|\322\213V\220*\250\236\364\247\005"
+	.string	"\267\341\375F\r\0326\371\f\357J\f\232\356d\341\202J\376S\341d`8\223\347@*\206\253\201\324\322\223\256\264\002@j\267\346\237\315r\030\036\313\255\277p\231\324v\367\244\305]\270\370?\217~\275d2\262W\013\214\275Z\324-\226,\306\245\203\275\272\f/\026\230\256\025\223u,\002\206\305\270b\235\f\f\026\353V\266\363\376q\204\202\340\250Q\033\253\252\217m\3176\203\273$\036L\021\345\315\234\372Q\347\021A\002\nJTN\325\207\2338\250\321v\350tbG\325\317q\035\023\374\037SHI\341\036\377\001\311= \260\002!\253\332\0060\202/\343\026\313\340\321\035\326\270\342YP\262\337\342\231u\303\207\002Q\316A\270\203\203\2121\315i\234([\320\326\006\257r8\272\231\251\231\223\225\020\271sk\355\302\222\377\243\331\003\277\354\206\357\354\306\372\245\215\374l\260\027\255e\2777(\2746A\221fZAF\013\026\331"
+	.string	"\340\0364\002\264\333j\016\346\202\023\310c\003O\216\027\365P\254\262\375\326\257"
+	.ascii	",\2369:~\347\265t\f"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.191.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`X\n\3756"
+	.ascii	"J^h\024C`\250Q\007'C\200\342\001\216#\364\2752\241\021x\2030"
+	.ascii	"\021\351\344\264\325\t\006\223\354\212?b\264\320\271\235\230"
+	.ascii	"\331\020U\234\f\0272xa\367\342\207L:z\357\024G@\200k\267vVZ#"
+	.ascii	"{\313\224R\n5\001\024\001I\001b\272\311\272\315\364377\2313\355"
+	.ascii	"$\343B\303N&\335\275n\326\3224\310uj\206\253\f;\213\212J\256"
+	.ascii	"\203\036M\376\360X\220\373\322]\270\307\230'\306\0063Q\205]e"
+	.ascii	"\022L\207Y[\214\315\372Z\335\316Ah\316\031?\367\336\006\235\262"
+	.ascii	"S\256S\246\026\252\235\332\016\252\r\306\355\245\303jt\027\336"
+	.ascii	"y\215y\335{k<7\230\rf\036\257\323\376bf\033I^\231\371tX\326\005"
+	.ascii	"0\347\253J\214\320\275w\330\351?ao\033\326\334\363\265\201FE"
+	.ascii	"?\037Q\217\267\323\345pjj\337\203+\367\215\006n\265\321\026\230"
+	.ascii	"\226\027\375\262\332g\031\370Q#\250\237\311$V\370C\n\262\303"
+	.ascii	"\272\251+\271t\"+\334\352\242\322\317$\022\313\300\f\215\323"
+	.ascii	"\350='VG\232\327\264\303]Xb\205\325\272~&\215tW\262\210\347\230"
+	.ascii	"\272\222W\216\263\f\226q\202\3643\211e\205t\230\350\351\261"
+	.string	"\366\035\312*W\035\251\034\322\351N9\244\255]\340\346\247\314\247\304a\223p\374\220\302SR\371\367X\247LCh\\\332\226X\035i\007v\020w\341\336\313]\204\322|\324\314\r\202\231\0370\353\316\004\336H\021j\247\004\264\334\324g\362\210\226C\3540jgP\025\324\342\344^\302Z\303\371\302\322LI4\034b\004\346\023\375\006\nB\326\275WB\233v\223\202\233\253SV\261b\205\332)\356u]\276\331\355\017\2262\366\231\334\240\325\357\261~Pv(\013\2305*w\343o7\343\322\323\366\317d\346\364\315\032\t\265\237\276\007J\233\315\324\177\373\351\333\261\314A\373\377\367qi\364(\367\373w\325!n5]\026\305\315\305,\244\274\221Rj\247\375\r\326\251\225fZ\333U\321\243\376L\376`\367\326\032 9\370\2330\277s\202wF\360\316\007\336\331)\347l\240\311\232\233p\316L9\347\245\234s\001\234\263\022\316\231"
+	.string	"\316y\200"
+	.ascii	"\353\034\300:\003H\235\223Tg$\353,\264\316G\3269h\235\201\326"
+	.ascii	"\331\310:\027Y\347_\352\354\263\316D\326\271"
+	.string	"g\235y\326yg\235u\3269g\235q-\246Y}\347\324:[\353\374\326\331\337\271+\330?\313\337\362\336\037QCWIZ\326\354\206\356\034\227F^\200g\036\341V\312\344\003\367\321#\200 \004\312:\312\035\200g&\341;\210K\216\204Rr\0356\r\t-z\324\201W\021s~\004\360\315\246\031\250\255\254x\004\275Z\272\364K\024\n\005c\235-\271g2\256N?\251I\337K\300\234E\017\365\223\352\373\244\0172\0179\217K#[\325\0306\3343\331\315\264\311\261\270\327\375\016\3465\213\212\364S\354\327o\254YV-\353\2277r\375R;E\372\022M6-W\302CD$\2657\020+X\332\321\013\221\336\220\320b\360\217\236\3758eM\003?\370\002\322\336\242\307-\300/DLRs3\372\336\003\377'\3666\350\270\354=!\"\201A\253\027\241\240$\034o}\220\320\242\377\275\321\177\240\343\024\243\214f#F"
+	.ascii	"\264zy\360\247\241\0302h\320\240vZ\364\021\326\372\020s|@l\020"
+	.ascii	"\361{\023M>Z\312|z\236\204Yx:\017\207\016\036<\250D\357\373G"
+	.ascii	"C\226\354=\321\0070;n\341\275\356{\237\236\035\2275\220\254\331"
+	.ascii	"=\357\227\304\336\332\034\273vv\210\302\264\017o\366\214ru\277"
+	.ascii	"{\2444C\203\216[t\317\314S\375$\036\251\335{'p\2435\035\020!"
+	.ascii	"D\004P'\034\305\t\207\0215\003\312r\n\b0^\254\030\272\210\032"
+	.ascii	"\266\210\202\222\032\246"
+	.string	"\230\2021\204p\304.^\250\230\032\306p\341bj\310\353o\302|\241\370F\340\004o\320\314\253r\005\322d\236T\320\250\214\236\351O:\3017\230;i\004\237\240K\210\024\202o\260\266q\274\306\332\212\236\271\022Q\331\245xs%Rd\305\302R;\245\321lC\210\355Ie\337r(OH\326$I\324Ng4\333x\261\025\241[l_\277\241s\207\255LV\2467\222\177B\326\222\314\247\244\036\310=\273\225T\247?\360\354UWFgF=\221r\372\016k\013\247\351l3\360L\032\254\273\307\332\2257\275\201W:;\262)i\372vvZ\346%F\313\025\323/\375\f\tez_{\nYzv#\216\305N-&\363F2\331\031\022Zt\266Q\007\026\332e\266\020\215\362\241\272\267\350T\340\227\272\224\276\300\367\236\243\037\002?\340\225\276\217S\214>\304\211\254P\242\254\315\346/i])p\346\265\312z\305\0339"
+	.string	"\270\366\004\202f\374\033\374D\317d\035\036\236\200\177<\276C\375\026\004\006\217\275\367\336\3363[}\001\037\024\013\200\337\250a0\346\224R\210\204dD\222\244 i\f\200\002\021\"+\326\001\021`=e5\223$\313v\312\001\305\330<f\265>\032\335=\346b\3754\227\324\3149\341|\f\357\211\201"
+	.string	"\366o*\016Q+\037\254\321\3659\302\265q\253\201v\211v\005!\254\200$\222\344*Q\270I\035\277\216\027N\3726\005\036/F\310\347\260\244\350\rx9\277\013E\004Y\306\336\325\357\341\303\020y\037\233k\250pL\320\257\033\321x\232\204i\006Bi\330\241p\376\375g\002BQ\243\261\221D\313$\270\0041\230\205u\311\305\206q\311\300\231\006g\235SOy-Q\031\245\310vq\210\036\236\366\321fikLe\f\345\037:\262T;yu\222C\261\323I\365\006\353A\265\256hz\367\265\266\272\f\007\264\243\206\003\317\006\022m\226\271/\211\357L\035p\375\316\033\r>-\3027S\205\361\240\036\007\001X\325\243~\322\005\204\020X\001`a\254nI|6\373\022\363\016\265\2310\245\305\320s\b5\371Z\375\321#j\001\031\021\022\261\277e\235C\310\274$\272\333V\262k"
+	.ascii	"\302\006D\222\247,\202\306A`?\022\343\304\253v\032\306\203\212"
+	.ascii	"\021J\316K\326:\212f\016\317r%\331\241\002\021\360\320\361\216"
+	.ascii	"a\230\360\340O\211H\004Yt\235\027l\254\032\250\352$i\227\255"
+	.ascii	"k\2621BUa\024\365\353=\022\234F\345\335\302\212\301.\3647\006"
+	.ascii	"b=\005i\250\365\"\306\266}\343\263\ff7f\275#87!_\003\235b\221"
+	.ascii	"smjD>\274\207{\201\364OBP\315\231O\306#\334\260@W\335\021\367"
+	.ascii	"\364\322\270i\224\342\367|{\237L\301i"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.193.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\005\f"
+	.string	"\006\027QA q\223\016\034A\215\213\020\3246\002&xC\n5\024~ \\y@\347\277s\201@@[\231\2435\213\366T\324\321,\232\212n1\201 \024A*a\306w\034\273\302\202\306\247\027];D\022)S\nA"
+	.string	"="
+	.string	"<"
+	.string	"\232\255r\340\302\222\032\234\350\200\241\243\261\273\357\232#\256\235JT\315\277l\244Sx\332:\236\324\202\017\030\035\0026\023\205I\t\021\343\3351\303\306\201H\340\n`\263\273\266p\270\253\333~`[\201\375+\226C/\361\305\003\305\n\335\027\031\371*l\221\214\316\211\020|\310\\\235h\177\344)\264s\"\353.\210\211\213]\216\301\325\t,\327\001\307TW|\201\352j]\217\302\366\310V9Gb78\036\313\356:\360Y\274\005\346\227\270\272B\206?]\375\254\272>\337=srC\306\207\310H\tW0C\234zjS\204\255\350+z<\017\273\032Vl,\210\236\2308\311o\337_\361\316\016\234\233\243\311>\235\207]\217\302\005\301\3638\240\354i\f\030\373D"
+	.string	"=\013\030\006z\226m\374\246\224&'\025"
+	.string	"\375\256s\341O\316$9\217/f\244\200\310\f1uO\365\224P\202\302\2015\374\316\023n\022\030"
+	.ascii	"0\0021\001\244\2062\230\271\375\274!\340l\004D\3010W8\223-\364"
+	.ascii	"\304\204@\334-\016\245`\027\264\202e\356\271tQ\342\202\320\235"
+	.ascii	"\001\202\273\327\3224M\241{m\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`x\fE."
+	.string	"\332Ix\020<0\244J:m\336Z\n\247\0044\216\306b\362\274`\023\332\300C\027')fe\207SF&U@\013E\017\006]\302\301\301\301\351{\376;\214\026\002c\236\275n=\227\006\024\211\222\310\024\367"
+	.string	"\371"
+	.string	"\374"
+	.ascii	"V\220h\025\n(\225{I\347\331=%6{$t\312\275\341\035]\211\373Ge"
+	.ascii	"\367\220X\312=!\223\335/\327\373?K\034\345\276O#\253\367}\215"
+	.ascii	"\215\215\211<v\317\347TS\273/\373\322\3568\275\337s\336\343A"
+	.ascii	"\371\335\023\022NF4\271%&]KD8HUuUr\271\356L\362<$Ot\344\201b"
+	.ascii	"\007\f{!\260\017\032\271\241\"?D\251\020\226:\"\367\205\347\220"
+	.ascii	"+\022\3626\310\005\201|\321\217#\35237@6\037\367\216N\024\034"
+	.ascii	"zt@;\375\202 \342\001\017V\333\341AG\210\034\\^ pl\335\320Bm"
+	.ascii	"p\026\0075\230\214\006c\231\301hZlE\006WAc0\025\264S\030|\306"
+	.ascii	",#Z\372\342\236yv\372\341,\372\237\3271\027W\242Mi\232\246-\356"
+	.ascii	"\033m\311-\032\262\270o\036SUM\353\376\373\367]a$\034\"\332\212"
+	.ascii	"{@\347\377\001b\001_\204\266\024+\245\032\020$\300F\275A\251"
+	.ascii	"g\037\225\027\344\326sY\345\273\034e\357\262\224<\227\313\364"
+	.ascii	".\257\312\313ny\227\303\260\227\275\340]f\273\273\314\005\317"
+	.ascii	"\345.w\3561\331\271\257T\347^\221\316\375\242\335\345\264\356"
+	.ascii	"\236\221\356\376\322\234\373F9\367\231\342\334'\302\271\274\345"
+	.ascii	"\315\34547\227\257\264\271\254\205\315\3455N\323\364\267Zsy\214"
+	.ascii	"\325XHs=\364_\002&\026\346\343\013\315\367\320\037\207\030\016"
+	.ascii	"\035b;\302v\200\331\370*\242\341\274\222\361\231\353\231{ 3\027"
+	.ascii	"$\367Aq'\204vY \243\033\227\271G$s\177x&\331\f\365\263\303c\304"
+	.ascii	"p\367~\316\267\017c\356\377\234b.\343\205\251\340\306b\300\\"
+	.ascii	"\370r\325\226\301\213\206.Y\\\260\3306l\301\300s\177jSx\3552"
+	.ascii	"\036-\023\324$d\271lGE\004\024\313\375\244\363\n\203\3414\376"
+	.ascii	"\202\246\3406F\343)\001,a\3550\361\216\260x\016\320\034\2407"
+	.ascii	"\261$4'\035\036X\371\203`\2413\207t\325O-\237\215D\006\370HW"
+	.ascii	"\005\020\231\265Ge\333\274\341U\363\352\3242B\366\323\332\b\331"
+	.ascii	"Pk\224\222\023\244\2519{!\262\r\254RJG\310\236J2W%\331\202\033"
+	.ascii	"\240\026/\345W\313\001\372\374\305\rI\362\261\316\013\033$+\023"
+	.ascii	"\225\001\254r\nOdCQr\023!\243\345\037!\233\341V^P\346.\356Md"
+	.ascii	"\203\t\362yh\254\215\312\252\031N\311\001\364\260\214\037\244"
+	.ascii	"\352$-\217$\243\203\3642\235\220\252\033\254-Us\242\222\031\254"
+	.ascii	"\321}\020m&\\\371L\244\207\350-\332\027\n\313<\206\t\316\321"
+	.ascii	"\016\003S\271\251\f\321\357h\017\001\302\n~\251|\316\2614x\264"
+	.ascii	"s\274yY\251hK%\t\264\314i\342\332\256\bm\250\026j\345&S\374\362"
+	.ascii	"\244\344#\025C\272\226\005\260\005\032:%Y\301\032\274\300g\226"
+	.ascii	"y\356O\315\354|\037\324\254\352]P{\265\267\324Z\255|\364\343"
+	.ascii	"'\367\3053\273A\325\324j\340\215\021\240\371\331q8\263\243X\356"
+	.ascii	":ic\347;\263\241VE\245\323\245<\203o\236\331\307K\354\362\314"
+	.ascii	"\336\013D\226\345\214g\366\223\312Lf\013\335\330\377\276\354"
+	.ascii	"cR\361K^\034\323\270\367f\207/\333k\314\371\376\327R\311\251"
+	.ascii	"\366\315\363u\225\340\365\316\327Vo\274%\347\326\327u\276~\300"
+	.ascii	"u\275\206b\273\236\327OI&\241\346\314\355\210\317k'\226\253\253"
+	.ascii	"#4\273\372\251\255\304\325N\312D\256\346\025\021D\233\340\246"
+	.ascii	"\345V\037[n\232\244\325\307$\263\334\242\241\337)i\265\216\023"
+	.ascii	"\334t\250\325\3077+\264C3\233\305\304\342\320\254\362\351\007"
+	.ascii	"1Q\030"
+	.string	"dV\237\340\276\244\254\256JN\265RI\002Q+c\021\3629\363&\026\325\362\315\235\027b\265\323\032\200\351\250q\024\214RgHd$\005I!\255\001\320\002\251\031\332\346\021\240\030\223\320\231\021\031\021\021\221\024\364\235\355\313\341~!\234\235\b\342`\363\362V\222\371\373\265\020\341\0206c\315\351\337&\300\235\364\304\036.R\270\200\227\366x\331F\300\206\301\273~\020\312O\177\250\216\324\206\320\305W\247\357\315\377\350\2456\023\033F~\244\3372\003\341l\226<$iZ\251\204\214\t\310>E )\025\364\260\035\024+&\271\353\031\215]\300\352!{I\363N\367\330\222e\2400\303\220\366\205\322S\200\201\205\276\270\0248\005'zT\351D\027\021\376\225\210\020\252M\335\264)\242};\007*#p\313\203~`\244\205\021\013-\3047\301\253\363\025\300\203a\360\321 \370a\020\3608\fz\030\016<\f\004\037\207\002\217\007\b"
+	.ascii	"~\317\322\022Z\002\240f\371Y\363\3574\252\177\373O\330-\213\317"
+	.ascii	"\242\016Wb?\324utx`\323cM15\346 \244N\364\036\246\311\256\330"
+	.ascii	"\020@)\032\346\027\243\321x\304\250\214\007\\\234f\231\236\374"
+	.ascii	"T\317\"\001\203\257dpUC2\247\332\335\"{k\355b\307N\017\n\212"
+	.ascii	"\273\"\355\372P\t\332\214+.iq?\263?\261\325\300\236 \331\234"
+	.ascii	"\242\021\366\354\036<\265^\373(\210\351\306\baQB\352\002\207"
+	.ascii	"F4\241\037R\232\250d1\267V\265\276\037~\372\177|'\177\035IG\016"
+	.ascii	"\202~\251\327.A\305o\277\366\232aV\254\024\211\026\224\370'\201"
+	.ascii	"f\323\375\036\374\347\317<\202\"\033\251\020L83\212\230tp\324"
+	.text
+	.section	.gnu.lto_.refs.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\004\bM)"
+	.string	"Zb\214\020G\240\330M\206\003\300\265\376\265\275\235\261N~\372\260\263\371A\321\311\253\330\230|k\375\342\005\024h\242\223&\307\313\361r\274\224\303N9^Ja\234\177P\240p\037k_\264\354\355g\360CS?\250,R\213\217\215mD\246\375"
+	.string	"\375"
+	.string	"\356"
+	.ascii	"\367\214}g\374\034\241\307\221},\377Fv[\371\"\331o\312\237\005"
+	.ascii	"}u\003M$\027\352z\b\001\215\031\237o\031\261w\f\030\233\257\227"
+	.ascii	"-ca@~xu\361\340\332\322\312\302\332\241#\007\331\213\343\366"
+	.ascii	"\2751~m\330\2765~zi\374|g\350\2761X\214\020\277!r\275 r_\017"
+	.ascii	">_\0167\275\033n\276\032|z3\330\364b\250\365^\250}+\364\364N"
+	.ascii	"\350\371J\340\351\215\260\323GcF\247OfLN?\013\316?\005\327\217"
+	.ascii	"\362\004\247\337$\t\022#D\204\210\201}u\361\020\303\337\272\365"
+	.ascii	"\261\304p\253[/ \206S\215]j\374\250\261C\215\357$~\323\255/\335"
+	.ascii	">\200\370I\267\016\024\303\347\255\377n\337\023\237w\353Ebx\220"
+	.ascii	"\355\201l\375G\f\327\331\272\217\030\316#\206\357\330z\216\030"
+	.ascii	"\216#\206\217\266n\253\275(v\033\233\257\271\3514\233>\253\265"
+	.ascii	"f(\373\320\302;;\f_<Et\377\020\337O\226\353\007\311"
+	.string	"\375b`\263\017d\376?x\375\256\336\357c\267\353o\375~\255\243\366\252\243/\340\353T\276\237\352\365\250\336C\355\272\323Q\027\300\353L\277\256\364\373$_\007\372\036\251\327\217z\377\333\365\336\257\363|\275\310\367D\275.\324\373r\327\201\202:\351\353:\337\347z\275\247\367<\273\256\343\3539\275\2163\3528\273~\333u\333\256\333\354z\215\327\273\273H\352\316\220\001\203\350\373b\350\353\242\305\n\334W\305No\n\024'L\350\364\226 \221\323;B\004\016\327\373\241\354@\226d\371\275@\324ka\250\367\001\0323d\304\200\361\302E\313\025+T\246H\211\002\345I\023&eK\310\276\222$G\214\214\343/D\250?\006\266U\376X\345W\225OU~\024\331\007\224\017E\366\247\362\235\306\3364\376\222PO*\037\251\374\337\330{\343\363\204\372P\371A\345\377\fu\335\330}\306\003Ou\352\r.\240\002fg\232\257\024|"
+	.string	"\217\024\374\231\364?\340\367\346\363\346\357>hv\240\331\177r\263\367\314\337\t\2163\377\026l\"\n\316\2164\373\234\375\027\354FI\277\003>\321\374\022\370@\363\311\331u\263\363\314\2763{\316\354\270\331\307\331\337f\027g\277\231\2756{\315\354\264\\\370l\366p\226)\350R\230\263W\302\234i\320\234)3&\f\355\377\322e6g\177\026,W\252P\221\262\364Cq2+[2\347$\2424\233a\301\377+@\327\3541\267\262\202\177\005\340\253\346\023\230O5\273\324\374\250\331\007\314\3764\273\323\354M\263_\232]iv"
+	.ascii	"\263'\315\016\f>R\322\037\001\3377\337hv\336\354E\263\023\315"
+	.ascii	">4{9\037(\370$\360u\363{\202\317\223\364\270\340\343\314~\003"
+	.ascii	"\2768\277f~\347H\203\275\023\035\357/\373\3719\022_\026\336$"
+	.ascii	"\234\205\016f\323\310\033\204\327\030\314^\b\331\030\330\325"
+	.ascii	"\377u\221\276\027\371\363\270\b\326\354V\263W\315>5\207\032\373"
+	.ascii	"\322\370Jd\017\360G\263\377\315\336\233C%I~Ngv\234M\360g\013"
+	.ascii	"\3468\343\217\017\351\266\207\274\202\332%O\320\251\256~J\352"
+	.ascii	"i|\247\246\311\236\351 ]i\262\036<\310\377\310\356\353\221\335"
+	.ascii	"h\261\037z\354\205\026\353\344`]wX\3679\354{\006{\236\277\200"
+	.ascii	"\364\333?\272X\333\253w\257\021\004-\356\243\327\334\243s]2<"
+	.ascii	"P;7\366\236\361y\250:\316\\\275\315\325m\344\337\220O\233}\307"
+	.ascii	"\r\330\016\256\325\201g\365I\376\321\217|\337X\275G\276\221U"
+	.ascii	"\017Z\353ug}\216|\236\252\236S\365X82|$_\274\372\332\3705V\235"
+	.ascii	"V\325\002\272E\252\t\364\032\252N\365\233T\270-\370\264\340Q"
+	.ascii	"4\250\200\247\250qh&\020\303\210\210\214H\020IR\220\344\320\002"
+	.ascii	"\241\031\032=\020\320\223,\273\001s\300/{3\343\\\031\306\243"
+	.ascii	"\253\336\\\321\332\340C\337W\f\270<@\205V,\002\230\212TY2\fX"
+	.ascii	"Y\022\376\266\340ODm\326\316\036p\324\253\230\300IT\272\020\351"
+	.ascii	"\037%\rA\341\311P\253\353\233;\216L\302\230h\341G\314FXl\215"
+	.ascii	"x\232?\243\341\fU\333\337\335h3\332D\177t;\326l\273ts\375\273"
+	.ascii	"\227|\211\017[F1C\304j\233\271\034r\021\026\324\006#\304\364"
+	.ascii	"%\365Q\216\031\f#\307Q_k\t\b\300Wv\0241V\334\223,\265\250\345"
+	.ascii	"\031\241\303D\343z\301\321\2754\226V\231a\303\374\024rGD\202"
+	.ascii	"\351:\024{?\fF(S\037\fD\220\t\300\203Q\207\rv1\231\354\226\336"
+	.ascii	"e\241\300\226\241\366\300ma\017\300*b\016\033pe\006c\205\246"
+	.ascii	"\220\003\336F\223W\3131\360\023Q}\256\002"
+	.text
+	.section	.gnu.lto_.decls.a92a11effc6ce750,"e",@progbits
+	.string	"(\265/\375`\302\201%\031\002\372u\333\277S\0200E\3514\006\024\364\274`\274\243V\036\202y\345\271Dt\353d\230\243\370\231\302\370\341\\:~3\3669\225\325*\322\b\353T``\307<\276\265\r\274\203w\322\273\365w\355\315\275H\0339\206\021\003\332sC1\236\204Q\366<\243\254m\271\367\226R\312\024=\n\361\013U\f\277w;W\2304\311\273\371N\371\322>L\353\203\336\271K\027\207\0321\253\243b\253\241|\322\366\244\274k6\320n\250=\211\212\273n0\314\304\3354{f\357\2526\222\230\022\214\274eY\3437\345F\271s\267\312\225r\251\\9\273\274q\367\355\027\356B\371\305f\302\2404y\362\337\254\017\n\264=\350\363\224~~\322\317-\364\263\222>f\243\217\3734\b\353\203\036\203\321\307y\372\277g\327I_^\225\336\315'\341\007\372ur\217\3340,\226\224"
+	.string	"\036\333\177\313\256\330%\273c\327\314.\257\223\313\274N\256\214\271\346%R\244Mi\344:\351$\361\354%\245'J'\367\351:a\346\233nA\346\326\334\233\t\302\017\b \200"
+	.string	"B\n4\214\030\301\311\307Q\300~l\327\232\232\334\315\307f\372\377er\227\334\245]\336&\367\353\327\313\302%\001\003Src\350,\361\354\245-4e\334mr\221\334\030:K\314-\225n\205EI\361\333{\377\200"
+	.ascii	"\002\b8q\3131X:\0373\365q\021},D\037\373\320\307<4\216\355A\217"
+	.ascii	"\255\364\361\223~\363*-Y\216\r\263\034{C\204\350|Q\311\241\335"
+	.ascii	"\037\277B\376\013\344\006\3111s\222\244\345f\313e}P\037.@\277"
+	.ascii	"?\332H\201\352\362\321\245\243\247d\256\207]\273\\\366,\004{"
+	.ascii	"\263\355\275-\300SldGn\266\333\372\240w\003\375\366@\333\240"
+	.ascii	"\201\201\306\003D\016\232<\245\257\035\037\364R\334\332\362\346"
+	.ascii	"\377\352\270V`\364\276\360n\276\215kZB\003\b\tP_q3\202\200\265"
+	.ascii	"\270L\366\016-\205$L\236\\\253\373t\235F\274\330v\373%Q\022u"
+	.ascii	"c\224I2\244\271\367\276\205\373\355\332\265\272K\227i\304\324"
+	.ascii	"\266M~I\226#\230p\255\256\f{\246\203\304\334Q\006\020B\325\374"
+	.ascii	"\272W\367\306\335\272Y\027\307\305\2726\256\326\315a\227\327"
+	.ascii	"\352R\375V\335\032\247\222*I\037\207|\267\365A=\330\036\364W"
+	.ascii	"O\377b\321\277S\364\357\233\276\311+e\227\227\273S{\307vMA\352"
+	.ascii	"\272\371\027M\257\330{o{94\275\034\372\333D\377&\321\277E\364"
+	.ascii	"uq_\330\345\207\013\343\026\215}\3623\211\271\231{3w\356\017"
+	.ascii	"6id7\377v\351\333\017(\376\373\263\037\320_\033\372\227\006\210"
+	.ascii	"\313B]b\356\262\275\231;j\036\031,\264\233\177\237\364o\223\376"
+	.ascii	"\257\322M\302\331Jz\331\361\367\233\364\337}\221\354\030\016"
+	.ascii	"\035\025<57\337\317\372\240;m\200n\377\364\337_\\\327\315:l\326"
+	.ascii	"\344,\335\3020o\266k~\253\306\252\031\207\3240\273\031\243\001"
+	.ascii	"\272M\363&\205i\315\315\327\357L\212\027\305\253H\231\3333\277"
+	.ascii	"\355\263f\354Y\b,P\261\260\262(\335,\202"
+	.string	"\365AQ\333\203Z2@\267ez\320d\025s\243\355\275wp\027)\270\0317\237\266\007\375\355\030/\352U\2241Ym]Y\354\026\033$\274\3313\035$\236\255\204wC\251\306\346\003.\212\245\202\227e\302\b&X/\326\315\236a\2462=\333\342\212\263b\261`\261\244VS\272j\356\315\274\005\373\201\254\027[\305\332a\261\344^\332\001\367a\253\317\355\206\337\336\314\3776\214\025c\367,\237\005c\365\354\027\333\264K\353\305\346\335r\261]\236\231{/\355\275A\370A\373\222fm6d\253e}P\016\266\007\275\245\303\263Z\266\274\264\260\236\340\225]\261w:\210\223:3%W\224t\266n\310+mL\213n\206\235;\265P9\223\273\371\266\205\266rV\212]\332)\277\205b\343\236\307\264v\331\336\314\034\234D\303\316\355\346[\020\350\316\337\337\337\237\005\201\036\005\332\203\365A\263\355A\177g}\320\247\320/\241\317"
+	.string	"\315c}\320\023@\363\330\036\364\307\372\240\277M\353\260\303\244\361\244\343\346\337\242\235]<;'\245\233m\231ub\227\035\254\031s'\247\215\2226jn\376\007\372\266\003j\377l\007\364v\331\304\202\3311\334\344\244\265\321\366fj\200"
+	.string	"\022\033_n\266L+v;f\303>\202\t\307Hc{\271\367\266c%h\355\235d\307v\326\354\235\264c-\007\326r\220\227l\rQC\3637\320gZ\037T\333\036\364\226\311o\306\266\t\277\372f\330\313\224/-Y\376\313\206\353\316\017\\\271\377J\371\361\034\226\002\367\343(\030\312[\333\034\f\230\355"
+	.string	"\177Z\203\r\206\017\230\314\205\207\346\351\201\377aN\0210\323\331\201\223\003?\336?V\372\317\r\374y\352\324\300\217Qpf\340\304\300y\201\3776 +\2350\374\331\004\177>\301\177\232P\300%\300]!\357\377>\345\244\377|\301\250\201\037\335\362_7\264\207\n\315\336\234$\312\376\223'\203\353\374i\213?\257\235\0248'p\252`\017\003.\222\256?FO\t\270\335\267\r\226\304\277\334\005\314\343\036\376\024\t\023\271ow\355d\341\346f?C\362\237+\374\330\353\277l\377\371\007\325n\370p\020?\272\363\343\256?\233\235*\330\rO\377\264\205?3\371o\233\253\346\214\300\237\231'\004\376[\202\377\216"
+	.string	"\3438S\270\305\377>\335\347O!p\323\234}?\256\300)\200\313v\031p3\370m\b\354\315I\342\307/\340\020|\310\340~@\233\3301\333di\311~k\366[\264\337\236\255\375W\203\337\272\3756\312o\247\374\267\203\337^\3711\007\236vl\301\220\201\303R\3756F\322\305o\261~;\343\2674~;\365[\036\277\205\372\255\323\1777\370\255\217?#\377l<Q\370m\230\337\232\371-\231\337\016\305\3304\277\005\363\3336\377\345\340\277\377\257\376/\360\277\036\376\253s\302\035\300\335p9\374\366"
+	.string	"\327\307\203\377b\360\337\016\367\203\027\304\256;p\001\214\345\021\224X\361\2438\376\363\001?\316\340?\035\360_#\327\353\274v\0028\031\360\237#\376\323"
+	.string	"\377\t\364\237\"\374\347G\037\360\237\"\316\001p\340Z\371Y\002\376g\200m\374?\377\324"
+	.string	"\177\326\300\177\202\370\363\006\376\363\303o1\360[\023\277\315\300o7\360\333\013\374V\003\277\205\341\307\0258\005\360[\024~\373\200\337:\340\267\b\370-\t\313"
+	.string	"+\342\262Y\020v"
+	.string	"\026\203\337v\360[\017\277\325\340\267\031\374\266\203\005\300\2179\234\001\260\033\374\226\003L\302\177~\360g\020\234\036\3749\206\377\354 \023\375'\007\277\265\277\275\035\370/"
+	.string	"\021\327\313\351\341?7\370\355y\030.\027\016\374\247\333\177fp\030\260\317\325\037\r\341f2\364\237\016"
+	.string	"\0047\357\004\300\177-Y\314\356\2074"
+	.string	"?\326;/\370\361\t\007\260'\376\300\371\363\377\003^\2637\357\360\247q\327\316L\246rZ@\202\3776\340\254"
+	.string	"'\331,\211\037\333\323'\313\235\034\314~\226\257\234=?\356\362c/\377\271\341\317x\247\206\017x\r\227\371o\335I\374)\336\217G"
+	.ascii	"u-8\371\037\347O9\370\361\006'\317\237\275\316\235\373\364\233"
+	.ascii	"\037\305\373O\235\377\216\271\r\310O\377\231\223\241\376\023"
+	.ascii	"\347\317M\347\315]@\002\356\3233\260\347A\370\323\016?^\221\257"
+	.ascii	"N\340\177\313\376\313\344\3073\374\270\004\247\372_\346\177\317"
+	.ascii	"\354\360\321\251\377\274\365_"
+	.string	"0g\212y:\270#\376\373\200\377\206\370\257\002\376\274\342D\377\273\200\377&\340\317B~[\200\363\374/\002\376\313\200\006\340\2353+\371\017\303\377\f>\374'\306N\377\033\360\247\027\374\007\363\277\371\377\313\3770\377\367\376{\371\257\367\237\357\317\032\376g\251\362_\312\377\234_\007\340\317@\1776\300\237O\370s\t\177\036\341\317&\374\371"
+	.ascii	"?\356`\315\2377\370\263\b\177\026\241\346\377\316\257\217~\354"
+	.ascii	"\"\365\3711\323\177\267\376\273\343\307,\376[\371o\346?\372\247"
+	.ascii	";?F\301\177\373\243\177?>\372s\232?\243)\300\237\373\376\\\346"
+	.ascii	"\317\315?\363\375\367\205\377\272\360_\013\374\267\304\217\221"
+	.ascii	"\177\336\373\363\227?s\371s\336\377\r?\n\346\277|\277?J\365g"
+	.ascii	"-\177\276\373s\335\237\253\374Y\312\237\241\374\231\355\317g"
+	.ascii	"\177&\373\263\330\237\227"
+	.string	"\177>\362\347!\177\326\361g\254?\307\3703\324\237]\374y\351\317'\370\263\f\177>\3723\321\237\203\177\356\300\2377\360g\013\374\231\001\177V\300\237\021\360\347\r\177\276?\376\373\361\232\037\243\371\361\332\217\311~l\346\307b~\f\346\307^~\374\345\307Z~\234\345\307W~\\\345\307s?\226\362\343(?\206\362\343\267\037\267\375\230\355\307h?6\373q\331\217\231?\006\3731\223\037\177\375\030\311\217\275~\234\376\270\310\217\273~\314\343\3079~l\343\3072~<\365\343\344\217G\360c\250\037;\375\370\305\217[\374X\351\307)\370\261\t~\274\342\307*~l\3741\361\307D?\026\301\217S\374\030\305\217\205~|\342\307!\3701\b~\314\201\037k\340\307\030\3701\f?~\341\307%~\334\302\217'\360c\026~\034\201\037\223\370\361\003~\334\200\037/\340\307\t\370\361\001~|\302\217K\370\261\210\037\023\340\307\003\370\261"
+	.string	"\376\313\345\307\035\374\330\303\217;\374\330\347\307\366\277n\277\035\376w\341\277N\377=\3731\317\217w~\234\363\343\233\037\253\277=\300o\023\360[\b\374\370\376\226\001\377m\363_5\377M\363\333\363\277f\376;\346\277|\377-\372\357\b\376\013\202\377\202\371\257\336\177\275\374\367\356\177\006\377\265\362\337\272\337\336\374\367\303\177\261\377f\277\335\360\337*\377\245\362\337)\377\205\362\337\267\377>\371/\333\177\327\376\267\360\337\247\377\252\3757\355\277h\377=\362_\257\377\016\371o\327\177\263\376\213\365\337\032\377\215\361\337\251\377J\3757\371_\250\377b\340\277(\374\027\204\377\016\340\277\037\374\226\003\277\215\300oE\3746\304o\007\360\333"
+	.ascii	"\374\366\203\337z\360\337\304o\357\3775\377\317\374\027\363\037"
+	.ascii	"\355\377\331\377\261\377j\377\351\376\177\360\367\367\367\367"
+	.ascii	"\367\350\177\203\210\377\003%\bl\346\246\246\320\031c>8\022F"
+	.ascii	"\306\321\031\227\t\005\333"
+	.string	"\342\322\343f4\206%\373\257f4TRe4\2601/\325\0221GnF\243\276\346\200(o\276\2061\215>\351D\t\271Qw\3635 \321?\nc\211\3028\337~\230{\n\335\312\322N|gO7_C\020}\253\304\242Kh\023\352\342|s\200R\323N\312!\202\235\017\r[\032e\201\262@[\330q\241LG[\274ko\306\227\233\337\227\271\376\2538/\246\342\262n>\217\032}\036>\375\243\373v\211n4\t\210\327v\365p\3201\271\031E\272y\032k\332\270\371<v\372<R\364\177\376\235m\2504\241\304\334|\262\311i,\332\316\364\177\2569\323\370U\331\342\342f?\2773M\ttT\320\330\345\231\346d\002\205Iu\366_=\267\314\354\271\335|\236\"\372?\313\374<\363\237}\247\031;f\325\005\n\307\315\266\213\365A;\330\0364'\201~\2269\221\320\250\021d\314O2O\331\356\370\244n>\305"
+	.ascii	"\375\034\243\205$\311\326\315\026\360-O\276+\004\004s#Y\262\032"
+	.ascii	"U!L\300\351\f\225\035'\030\03530\372\246\334|\236\244\336;\277"
+	.ascii	"\214\241MK9\274\262\234]N/7\211gg\331\252\216$O\232<.\364O\274"
+	.ascii	"S\313\317-?\267\234\\\354\336{Wm$1\"$\t\243j\372\355\252$\210"
+	.ascii	"\377\314\373\311%s\335\273=6Vn~\237\035\373\257\3360uR\266n\376"
+	.ascii	"\016\032\375\333\337\037\335I\311\275\367\324\311\334I%\034\364"
+	.ascii	"\267\267\247\265 \376\034\213m\007\377\363\033\200\334[\251\315"
+	.ascii	"\335\336\333\226\321F\334\222lx\330\277\333{)\007\222\003rH-"
+	.ascii	"\345\240j*\313!\245\241\251,\307FZ\022\202\244!\271s 5\225\355"
+	.ascii	"\255ai\t)\005-\251\246\262\244\255\241\251lKm\026Y\244\354f\346"
+	.ascii	"@\332KZ[\303^\332I\273LK\312C\323R\016\251\246\262$)\rMe9\244"
+	.ascii	"vY\216\315\263\227\222\222.\226vR\303.\313!f\227iI\3614\225i"
+	.ascii	"I5\225\345\b\263_.\376\246b\260\271\353\221\306\2125-m\250\247"
+	.ascii	"\253\244$\317]\023Skw\331\333\2421\355\344\276\333\273\203\275"
+	.ascii	"\257\264\222]\222\250\354\233"
+	.string	"\322\035\224\022[\222\226e\356\275/xR\332\322\332KwHv\3375yi\355\355\245\224b?\355\275w\tH\314\273\335e\357\220t\\m'\246\275\001\260\231{?\355\215d\367\335\336\033i\357\235&\257\230{[\3614)\237\236\366\256\372y\332WHpL{_4\2757\251\246\262-- 8\2632\345n\301D\262MNZ[\271\273\344H\3522$\261\355\264\367\266d\264R*\306\230\233\277\263\246\377\363ny\336\235^+07\022\260\005\025\252\246\337N&C\370\216\022\375\237WN+\370E\2232nQQ?\264n>\353p\222h\264a\271\371;J\375\237tvJ\225\223\312Ien\212\332\025\306\304j\312\177F9\345N):mMX I\371\215\241\221\232\346\230n\276L\353\203\202\210;\241H\375\240c\203\342d\265\266\005i\224\026\250(\2707\027^\274\bs\363\371v\265\366F\033BC.\314\315#"
+	.ascii	"\375t\373\212\202"
+	.string	"\003M\333\005p7x<a\322ia\356`\260\335\030w\b\324\220\276\265\334T;\227d9)0b\322\320\254\306`\211\335|F%\331\344r\363w\260\364\377\263\354$;\305N\346\351\344\034\263\313\323\354\0043\313j\316%\026Kj7\026M\315\2440'\345\205\222d\007\214\323\354l\362\327\304,\276\266\274P\202\235f\247\0228\2514V~{3\177\362\316\240Q\321\311\327\001\243\257SE_\347\311\311\304\226\235u\251\271\371:H\316%\33797;\336\320\222n\276\216\016}\235)\375\0345\372?\221\340\035\361B\307\354|\324\021\371\351\365\237EN#@\247\277/J7g.'A\200~\022\261W`^\306\224\347\020\036uNG\200\374\034\362\237AN!=?\360\330\334\234\265\254\017\3722\333\203\236?\200~\002y\353+3\273\371d>\316\256\373c\r\231\215\263\353?\265N\034'\327\325\322\301\204E\337\315=8"
+	.ascii	"CF\354\346\347\360\351sG\346\263XZ8\3518y\330\345\271\343\314"
+	.ascii	"q\3568\267\354\031\035$\346FJ{<Q5\375\364\037\222r\r\315\317"
+	.ascii	"\341\242\237C\247\361\235\365A\025p\303^\311:\261Hp\022f\351"
+	.ascii	"\352'\326\367v\250]\271\371\264\001\364\363\352fI\206\232\220"
+	.ascii	"\233U\253\263\206\232\367\264\226E\343g\215\377\244:\253\354"
+	.ascii	"Y\b\306\3608\303v\363M\225\365A\255\021\333\203\2363\200~\322"
+	.ascii	"\310\221C\202\243y\263-r\312\260t1r\220\223\254\312\222\251\234"
+	.ascii	"\246\304\252;\245\316d\233\222/&?\223\377"
+	.ascii	"\177\231\256V\022\335\362\266d\027\005U&\212U\322\315\377\tu"
+	.ascii	">\331.}LDn>\235\320\244\253\277\0267?\247MS\311WF0%\325(\262"
+	.ascii	"\256f\\\026,%\226,\345\336\314\273\033\315-m\262\032 \\\254\276"
+	.ascii	"\3440NM=\250&\231|f\004SR\215\241\344bo\356`F0%U&<\037\315.5"
+	.ascii	"\224xW\3156YK\316\033\301\224Ta\340\3318[\234I'\214\263\351t"
+	.ascii	"q\2768w\376;\231N\244\314\346\\:Y\3445\247\222]\3466\331\357"
+	.ascii	"\031MN\343\245*\267\311|y\314\224\007\"D\276@\361\333\233\231"
+	.ascii	"\366X\302\305\306C~\016\017}\316\331\036\3649g\314\240\211\355"
+	.ascii	"\3511s\021.nCn\376o\227\271/\227a\356\037\024\f\217\253\312\315"
+	.ascii	"\317i\322\317Ajf1;g\236\312\344\231i\212\331\313`p\274\246"
+	.string	"\242\204\334|\034\274=\034:}\034(\3728N\364q\276\364q\206\350?\347\345-\247r\310\030\230\273\035\2346L\360p\334|\034\036\37285\364q\234\364o\376\364o\306d+\231E\\\034\327\315\277\241\242o\227\331\256\016\315\322d\233\321=\327\375#\230\36008{/\367\336\031\354\004i\303\242\343\346\\\345:\375\265\325\311\335\374>\365f\212\217-+7\377\246M\377&L\377y\212\224$2\324\272\224=K\371\263\223l\226\345pn6\2262\252\233\243\234q\263\262\346\346\337\020\321m9m\004SR}\261\305\246i\202R\215\362-\253\245\211\313n\031J\206\263\313\374\226\327\236\331\362\223\3770\367^z\313g9\315\336U1\367\024pk\315\225{\302F\016\230\177\023D[\246\365A\177l\017\372\233\033\37275\364\237\323\320\230\310\340\001\204\271\334{\357\250pj\216\314\270\37173t\312\264>\350\375l\017j\241"
+	.string	"=\227e\035f\242\212\220\211\205I\243&\351\346[8 y\b\026K\3525\2746\315<\226\231y\231\233d\260\274$+\311Lr\230]f\261\374\205Y(\331$\001c$M\221\313\204\305\222\372\214LM\026\313D\3264\343\220\204\201\363\272L~\312,\226\217\\&2\276()~;Wsbjp\310\277\201\241\177\263\244\017T\243\017\344\323\007^\321\007\276\351\003\317\364\201b\372@#Y\b\r\264\345\221\233\017\304\221\203"
+	.string	"e\350?\377x]\236rD\f\351\346?\373\310\\L\244l\241\335\234\271n\356\221\273\236\2712\217\217`\302q\2262W\336;\311Z\016t\254\345\340\224\013\222D\206\346\003\241\364\237w\344,\034&\322\215\271\234\225\247\362\225\275C\313qO\2249\013\307\341\273\271\234\205\3612\322\210\251\255~\305\271\345\254\234\224\243FLm[C\031\327\226\263\256\026\374c\304\324Vu\304Ui\346,,\004\277\215\230\332\2522\216J\023+k\345\033y+\347\3108\262\016\273\314Y9\353Z\271X\354]\325\336R%\304\321Q5\375."
+	.ascii	"A'\316\354\312\030\236\234m\250k4\\H\335|\365O\237\371\222\246"
+	.ascii	"I\227f\023=\245\f\273&V\224M\256(\263U\256\3121r\215<#\323\310"
+	.ascii	"Tv\231e\3749\231\245\262\214&^\224\366n\216L\rO\276\352\247\355"
+	.ascii	"\235\365A3\260=h\206\372I\207\200\241\241\346\346\253^\364\255"
+	.ascii	"\231\274\324$MVZ\323T\273m\3204o\013\276\373\327\304/3a-M\324"
+	.ascii	"d\246\314\242\t\233\334\";\345\246\374\224ad\027\371\205]f\246"
+	.ascii	"g&\220\314\222\213\033O\276\232E_m\323W\227\372\352\021\235\267"
+	.ascii	"\036\332\231\256\233\257\352\320\307I?P\233\247.5\322`5\030\r"
+	.ascii	"\036\203\373\260\030\334\304~\270\r^\203\311`3\370\017\207\301"
+	.string	"e0\037>c\227\230\315\217\261\340,q^\302\252\220\356\032\256&\230\260\256*6X\313\r.V\315\026.\232_\240\232Uln\023\213\r\336\323\213j\262\271a\262\266\\)\363l(\331\274P\002\261qR\356\315\004\301nAEQ\362A\276zC_\265\322Wc\350\253N\372*\013}\335\324\327w\372\372M_3\365\365R_\033\321X\313\372\240%\330\036\024_\271c\314|y\335|\255C\337\302\225\371\302Rp\025,\207\3470\025l\005O\301t\270\316.\261\335\217\3410\224\026A\342\314\204\t\261\013[\332\341(\227I\211]#\263\244\331\027\306\327\304\356\212\tc\362s\223N{Q8\344k\033\372Z\206\276Z\326\007\375\300\366\240\330-\347\252\b\022\265\233\257Y\350[3j\230\310\225f\021+j\330\210]S\255.\r\267\341'\230\r\257\331%V\3731\020\034\004H\r{a\264\021S[m\206ui\356\275A"
+	.ascii	"\222\271b\"\005\007\017\301J|v\265v\262\362\362Z\334\214\315"
+	.ascii	"\200a\\\234\324\270\371i\030\375\253\206\244\215I\2322\311\023"
+	.ascii	"e\030\026\303N0\031\006\303L\334\004\227\331%\036\273\2311|\344"
+	.ascii	"\352\331;.\007\204\271=Q\262\246\034\303\313\2609\265/6\345\030"
+	.ascii	"^\242\246\374\261HkoI\033\362\323.\372\251\026\375\364\212~J"
+	.ascii	"E?\205\323O\237\350\247h\372)\231~\312D?=\242\237v\351\24774"
+	.ascii	"\316\266>\250e\332\036\364i\225\306aZ\037\324\242\331\036\024"
+	.ascii	"\373\300y\002\227\304\353\346\247NzL_\215\346\335\202\233\340"
+	.ascii	"~4\355\332\214\027\027\312R\232\2524N\230\305\017\204\231\302"
+	.ascii	"\320\2141S\325f\317F0\355\025e\302\30241\027\256\201a\340\033"
+	.ascii	"8\013\273\300WX\n\277\300V\270\013oa-\214\205\251\360\016\034"
+	.ascii	"\003\367\3004\360\024~\302Q\030\n'\261\f\314\003\353\300Nx\006"
+	.ascii	"\316\201\253\260\r\273\3048\376\233\345\342U\235\201\213\272"
+	.ascii	"{\030\307\005c\317\214`\332\272\f\034Ws/\314u\262w\\\016\200"
+	.ascii	"\273\241\254\362\203R\3565/\023\326m\261\327\274c\312X)\267\344"
+	.ascii	"]\2752p>\232\030\307u\013\003\323\254B\363t\325\254q\241\346"
+	.ascii	"\007z\302\207\223\224\324\320\200a\206\r\\\323\335\023s\325\004"
+	.ascii	"B\n[\323\374k\203w\030\033\345\336\333\256\3356\177J0\214\003"
+	.ascii	"\267P@\230\237\362n\371rc\330;\264\024\340\272\224w\f\0318\033"
+	.ascii	"w\017\343\270|;Ij\004\\\026U\323oo&\b\251\034\235\026!(\344\243"
+	.ascii	"a\364Q/\372\350\026}4"
+	.string	",\372(\235\376\334\023}\224L\037]\242\217\016\321G\271\364Q,=\302\372\240G_\350\237k\364\317.\372\247\024\375\223M\377$\323?\227\350\237D\264\b\266\007\375\311C\377\244\322?\231\3643\032\375\314\247\317\274\242/\227\333\305./\270^\306p)I\335\374<E\243`o{\001j\377\376\354\005\350\363\230\376\033\230>\353l\017z\261\374\267\356\332\241)\213sq\363\275\002\024L\256.S\026<\230Y7\253K\206p\2715oV\225\244ZB\354\370n\334\254~\235\177KxN\250\374\375Wu\342\354r(\271\371\034pQ\211\250D\324#qR_\240\334tis\302\245z]=\222\363F\303G\233j\004\207\211\264\303\250F\324\"\352\230\275/KL\035%\033\312\0367\237\2035\225\307U.\225\207:\004\347\271\321\335\210\301\020\303\362\343\352\220\253BF0\341`\276\220\344%\335\254\006\271N\225\035\224\346\315W\201"
+	.ascii	"\215\354(Kr\363\013\240\307hHI\335\254\372\360\002\343$\346f"
+	.ascii	"\265\353r8U\\\374z\250=8(So\2507T\035?ZHcJ\230B$\215U\216\217"
+	.ascii	"\031BZh]\325\241n\235\201\001\227\247n\2519\352\330`l9\333\321"
+	.ascii	"\206\n\237\212\343\004"
+	.string	"\303"
+	.string	"L\323\2233\f\316\023,fO\206\314\230\241b\375h!\211Q"
+	.ascii	"\035\2164V~\030\314L\234\025\365\352*V\252\345C\211"
+	.string	"\323\221\233U\033\3472=\243\343\212\221\233U\2533\314\215\023\035mFnVk\344+]zK\232nV\253\016fI\007\021\272\233U\252\313\264\314\202B\345f\225F\036c\325\274\345\271\310a\260Y\327\0260\255dR\215a\001\244|\006\013\221\251\2531\266\370\255qq\263*\225j\375\210Be\204\003\031*\f\025\206\n\205\343\013\224/\324\213\322\215\267\247\253P:I\032L\265\233U\247Tk\355\354/\013\007M*\223\312\244\272\260c;\352\007\016\356\013\024\27798\346\023\265\351\252\213\264\031\227\266\274Ym\221\272Y\251\262gF\377\351?uI\004;1i\254\320'e\214(\325}uIU\302a\343\261\306\352f5\351\006\314\017\270\0357\337\303\027\025\211\351\277\212Z\211Z\223\346\346{\230\242\346W\243\331\330\261\035e\202\310\027(_88\240\244\344\255\271f\243\366\310{r\362\340\344\242]4\215\346G\013I\314"
+	.string	"\222N[^\271G\232&z7k4\332\017M\r-6\372\214\320\216\263(7\337\003\2160at\337FY\340]=)s\3357\205E\21752X\306\212\324i2z\214\231!g\1777k>\335\264\313\327i1\317{\261uu\363=P\351\024\354:\364\036\222X\256\267`\321{\030\214\336H\314]\245\205$F\204)k\251\225\266\254/.\327{\327_F0\341ri^^\354\335\254\365\274\350.y9\255\313I\\\225\326r\003&\307\204w\263\306\263<\240\356\262d\371U\0341@h\370\270\371\036`\350{X\262\263\323WP'd\376\222)\026,_l\254\\_1"
+	.string	"\215)c\322\376\253;I\324\300\310[\243;\035\372f\307v\224\001\336\262\254\371\332\273\n\004\266;\343c\0133\356q\232\212\035\333Q\034\224(\263\254\361\333\273\n\304\255:K\0132wM%\204%SeS\376\253\02782\007EO\321R\260\364\301\311\270Y\313\335\\\321\275\021\271\371\033\034\321:\312}\273\201E5w\3637\340\241\377_3\257\313~\273\324L\r\207\361p6\322\330\216J\327\230\244\001\363\333MU t`\360\345\330\261v\rw\3756\202\t\007C\344afv\263v\273\355\"c\326t\363\365\023\335\366\253*\221=\26667\177\203\026Z\263\025"
+	.string	"+\r\21657k\265\203\271OP\216`\335\254\323\316\227\303&\306uu\363\3734\232\225-<\245\233\265\023mf\227\247\323gg\356\350@i\221Fw\3637\330\372\366th\n\354\351P=vM\366\253*\224\254\0359n\276\006~\372\327b\277\232\252\345\331P\336|\r\310\350k\260\247\177\r\246\301\256\336\026\0205\211\003\306\224\233\257\301\234\376\365R/Q(\020<{o\205\2755\255\266\244\311\270\316\3222\364\022\334T\265\247\020\320\002\rz\2666\365t\263\222\313FF\f\226\233\257\301R\337\202\335\320Z_pX\264\f\224\232VX\352\351\320<\354\035\227\003\220\\i\346\260h:H\032\366\326\341EYD\177\351$\372\2106\242\221\330\245\366\322=~F9\345\264\227\336Zv\321^\232K+\355]\025\317^j\343\003\001\370\"\307\035\226N\276q0\031(5\255"
+	.string	"\006F\017\321D\354R+\321\264Rwi!7O\360\310(/"
+	.ascii	"!g\214\226.6\320\374k!:\b\033\263\007\231\2335\220\264\212\212"
+	.ascii	"\216\305\315\327\340J\377\332\207]\352\037}_pjj\350k\020C_\003"
+	.ascii	"&\275CoibY\271\371\032l\375\016k\364;\234\321\357\300\247\337"
+	.ascii	"AO\377Z\313\242\225U)c\345\346w\310\323\332\206\306\332Y\362"
+	.ascii	"\306c\355\346\353\253\377\252\013>\256\254\335\234\255.\335\020"
+	.ascii	"\345\323\315\3275t\272\bI\023\273\371\272j\355\257L\215\2335"
+	.ascii	"\225f\3520\367\001\210\325v\303\306\214k\252_\263\3204f\370c"
+	.ascii	"s\346\346w\261>\350\365\002\272\236aEJ3\354\346wp\242\227\256"
+	.ascii	"\245\364\222\236\312bL$ \0275W!\350\020a\222#\352\346\2340\311"
+	.ascii	"\032W7\353'\035\245\223\277\252\3069\341]\335\374\016M\3645\324"
+	.ascii	"\177\025\310\225%\310\221\233\257\275\034\252a\\;\375j\272L."
+	.ascii	"\245\335\374\016_\372\332\205~Q\027\347\342\346wP\352\353\246"
+	.ascii	"\377j\n\276\340Pr\263n\241\231:\340\370\240\352\215\201\371q"
+	.ascii	"\363\257\231\256[\374\266\315%b\307\256\223\215*\276\2335\013"
+	.ascii	"\240k\246;\004\215\216\356\346\034\333\203\276C\013\375k$\215"
+	.ascii	"\244\223VH\001nN\207MTZ\237N*\323\246M\372\267B\np^\304\340`"
+	.ascii	"\330\375\341\251Q\223\256Y!\0058>\345N\316\205\220b\025\271\262"
+	.ascii	"\306\315\317/E\223\231[\n\007n\315\216\225\0222TR4\031|\221\351"
+	.ascii	"K\315"
+	.string	"\\&\273\247\266u\341E$\252\231A\220\264LZ&\025\343a\211\310S3\003+\375\f\234\370\370R1D\262p\2130\033\257\371T\314R\256\211\306\356\277\032\224\363\341w\3633H\002\223\202\241\002\246\315\322\336\315\307\340L\232\227\352\245y\351\227\364\013\227sI\275\330\235\334\333*\355\362\324\013\266\363a\244\314)\314H\025\217\233\217\301\236>\006U\364\237j\321r\267\314\334@,\336\017\252\246_\325R\325\223\233\217A\024,)[\232\3452\345\215\266\223\246J\020\323\204\201\231>\006H\364S;\233^I\257\244v6\251\325\310\202\330+:\026v7\037\203 \3726\265C\323:\266?2H7\037\203\253*U\322\346\3542\235;\247\254\300\263\367\026\230\022\203%)R\31674\251\276P\nk\366E\211rB)\241\325\266\326\232_\240@Q\273\323\177\372\226\276\235o?<{\211\fM\t\200)i[\332\006Tj\002"
+	.string	"\263T-eK\325\326\326P-\215\304\244\016\254\354\312\315\007\200\022}"
+	.string	"\354@C\343\362\001\003\315\333\315\007\200\224\231\331u\272\314\235D\311n\340\031J`\340\335\374\013\332\244ciY:\226\222\245dA,\275\304\355\211\326\315\277@\212\376\005=\230g\242Zw\357\275\225\351\234\335\225\346\256\252\002\221#6w\247\343\346_\020\245\377\264\t\332\224\202\335\030y\243\245`\007Dy\301\222\376\317\231%hS\312\344\352\345\315\265\223\222D\260\373A\325\364\373\341\323\377\331\242\377\364+\375\262gvlG\001]$\355\230A\202EE\377)\222\024\311\325+\241\231\266|4w\262*\004\240\017%Q\304n\376\317\230\376S/\257\313\224\231[\n%\353\272YS\205\356\357\346\377"
+	.ascii	"\371\361#-\362s\345\005U\323\357:\301\352\223\"\362\264\210N"
+	.ascii	"\030V\332\330\315\251\362d#\342\204\366\345\346t\310\311\226"
+	.ascii	"\343\245\206K\225\233S!'[\376\273\272R\2739\rr\262\351(\251\313"
+	.ascii	"\362ws\n\344|\302f\215\334\311\366_\315\001Sr\221r\363\177d\350"
+	.ascii	"\247=l\332\225v\335\315&+\270\262{j\356\201-\375\270\371?J\372"
+	.ascii	"n\366.\355\235\344\301\316\216&]f\334\254CG\312C#} J\307I\032"
+	.ascii	"\027\226\035OyX\265]\005\344\346\367\335\030\377U\324\213\027"
+	.ascii	"\216\026]\260\260\322\034\035\330\243j~\241A\234xD\341x\232\003"
+	.ascii	"\310\303\006\322\362\346\367\245Z\377U\365\316\214\0314\255\364"
+	.ascii	"\306\034\024\335\217\323i[\255E\241\222fe?\234\254\035V\\\342"
+	.ascii	"h\320Hmh\244\2378+*\031%l4n\376S\253\2476\256\361t "
+	.ascii	"a\2729\255a\321t\214\\\t\022usZ\345\306\004\r\216\233S*\213\026"
+	.ascii	"#\206\326\220\233\337\207\307\226}ac2d\240o+\220\240w\222)\262"
+	.ascii	"\026\343\310\324\024j\205\203\021\260\233-$\267\266\233oAW\232"
+	.ascii	"L\223\250\026\317V\342\323S\356\252*\020\350\324\033\237\334"
+	.ascii	"\315\267\240F\n\225B\241Z\370K\027U\363kWU\201\320I\222B\344"
+	.ascii	"\356\346[\360\244S\247\324\t\325\322;\r\355\266]\321\315\335"
+	.ascii	"|\013X\270X\246.\322\027\033\222\0238\023rZ\t\201\335\017 W7"
+	.ascii	"\277\2022)\013\273LY\244-6$]8\263\321\334I\031!\244L;H\244\230"
+	.ascii	"\242\244[\244\226\254\271\371\025\350\351\247H6UZ\246J)\022n"
+	.ascii	"\332\037\232\250\232_\025T\321)\322\255\300\355\203\210\244\335"
+	.ascii	"\213\323J\b\260\224k\262nn\263D\333\240\1777Nn\234V\316\3706"
+	.ascii	"\330\315\257\300\211\376\3214O\203\256YAkO)\300\210\330U\b\232"
+	.ascii	"\007\013/MP5\326\214I\026\345f&\207\252$P7\277\002&\372G\375"
+	.ascii	"\374N(4\251\302 \343kV`\244\214]\242eP3;,\\\310\b\001\355\003"
+	.ascii	"\246\031Y\2721u\214\"O,n~\005=\232\350\230&\252\205\356m\231"
+	.ascii	"ZQ\311]\225\004!F\f\252\245\221\354\223\247*\020\30001\206`\335"
+	.ascii	"\374\n\254\364+`\nc\227h\0304\271\002s#\241\\\302d%,\350\344"
+	.ascii	"n\276O\233\275\275\353\004\302\001qQ`\364\217\352\331%\252w\235"
+	.ascii	"@\354\244\244\017\342\240\354\272t\261g?\n\210kRN\311\313\263"
+	.ascii	"\300\037U\363\013N\213\026+\252\246\237Z\226,\231\013\335+\232"
+	.ascii	"q0\232M\356\356\234\222\324\325\241V6\340\203\252\371\205\332"
+	.ascii	"\035\265\222#W\003\211\r\037\036U\252p\331\230\233\313\\\226"
+	.ascii	"\271\243L`Q5\277\236\244H\311\\?\033I\214\bq5|\226\364\217FY"
+	.ascii	"\242Qr\326\n\314\215\204\023W\307a\r\024(\366\354g#\215\361\020"
+	.ascii	"\367T\006uC\335\3207\2716\252\246\337\233J\304\310\226\323\315"
+	.ascii	"\347\240\345\311\023\267&X\226\027in>\207(kk\226\354\207\271"
+	.ascii	"\247R2+2\375\243him\034\274\3649l\351\243e\0265[\242f\227\311"
+	.ascii	"&\265\031\331\\s'\347B\2705l \251\335|\0160\364\355eB\177\224"
+	.ascii	"\214\314J\272dF\343\315OL\354\212\036\031\267$/aav\312\235\254"
+	.ascii	"\n\001\347\356\013\231!7\277\207\212\376\321&K\264\311\355\002"
+	.ascii	"\301\263\227\360\352\224@\334\306\304\334\374\0365&L\354\231"
+	.ascii	"e\356(t\213n.\204s\006\033\022\246\233\337\303\374R\342\326c"
+	.ascii	"D\277G\207\376Q$K\024\211=\373\321B\032\343!\254\310\222*\277"
+	.ascii	"\275\347B8\335\310\250\210\334\374\rh\364\217\022\371\331\005"
+	.ascii	"-\202z\361$\345\330j\227$i\315\235\334!\240F\244\352\312\244"
+	.ascii	"\335\374\r_\3647\340\351o\240\"d\210=\263\233i\317\240L\322\326"
+	.ascii	"t\323\337@\366\003\b\335R\177\203\021\256.{\346\001\357\235\025"
+	.ascii	"\366\006D\177C\016}t\313\242;\272\240<\354Y\026!\t\0333\204o"
+	.ascii	"\270\322\337\020"
+	.string	"C\337\3323\364Gs\344@\241\316\246\275\245:\350\201\006\035\243fF\352\346oH\272q\003\325\362\260\367f\332+\312\310\001i\276\357\250V\026/!j7_\303\027**\024K\357\275\221\230;\312\004\037U\363\353\352(\226E\2739\263\222!u3j\303\242\301@\323<\273\031\265\262gK\256\266\266\233\321\032v\006\226_\326\315h\325yE\275\3621&CC\024\304\"\211\027V\023\027\020\207B\243\212D1Lq\324Y\203G\243! r5q4\032\272\021\022\016\205\0318\256H\031PX\361\202Q\270\022\221\300I\221\253\211\243\261x$\256G\340S\2048\022\021\t\203\216\310\341\t\021G\304\241\002\2548\"\016\211\nP\302\t\301\023F\254\020\201<\022\213A'\n\244q\004\307s\004\242\020)\304y\212\020\307\024Ha\321\212\242\321\310H\030<\026\203\200C\304!2\305qH\034F\240\b\203\261\030\001\344PH\202"
+	.string	"\254B\305\026rd@\032\025A"
+	.string	"\005\344\260\350H\024\032a8\0161@\256\307\242\265\b\025\"\016Qp0A\\\215\212:+rh\314"
+	.string	"\22284\226\2701\261\006\201FG1\024\213D=( W\0254"
+	.string	""
+	.ascii	"\031<\266\020\2044\252\350j<2\312FEAF\344\021}\212\020\304\342"
+	.ascii	"\360h\\U\020\213A\301\243\321\220\007\307\"2(d,\0269\254EC\030"
+	.ascii	"\216\302\025\202\220F \022\230\002r5\021\2044\352<E\b\021\253"
+	.ascii	"\320\021Q\020q(\302x<\022Q\001\021\321\021\221X$\246\310\340"
+	.ascii	":\303\360\210\222\240hL\201,\022S\024\302\225(\313`\024T\264"
+	.ascii	"\026\241(P\024\327\030\204\310\240\n!\261G\006\243\"\t\035\344"
+	.ascii	"S\204\0302\0221d\024D<\212\300\r\021\305=\217\301!#\034d\220"
+	.ascii	"8dt\022\207\214\360:\303\360\230\217\307\325($$Le0*\006e#\322"
+	.ascii	"\b?G\006#\3628\034Z_\bn\020Z\211CC\"a*\264\036\217\3621\275\020"
+	.ascii	")\024\0322\n\241\203\024\022\031\025\2550 \327\343\372\302\220"
+	.ascii	"\321\005A\242bP\021Y4\032\005W\2348\332p<q\304\323sD\016O"
+	.string	"\004\203H\025F@c\021)\f\032\n\021Y8\032\251\260a\004\240\020k\321\020\206\024 @\001\023%T\310\271\300\321hH\005\016iP!$\302 t\346\210\020\302\270\026\ra0*\026\211\202*\204\304\235U\250X\024T!$\352\241\241\n!\221Gh\305\001\026\035\035uH\020\032Q\250\353j\034Z\201B\302\325\0304\256H\242!\n!R\230\202\n\304bO\317\206\265\250\270B\021\206\3258LA\210\370\200\020\253\021\b\024\002'\035!\004\222\350\001C\304a\221Qxc\242\210\004\221\205\240\211\022*TPD\202\310\202\317\020qh\024\256'\202EAA!\"\t\212)\020\213\024X\211\204A<C\304!\2210\350\030\f\002\340\204\220\b\201\243\321\020\207\340\212\024\n\031\035\005ydH\201$\022\256+\034\215B\022\b\031\205+\354\b\327\"\027R\344\220\310\202\n<\352\212!\212\325Xb\3478\305\327\025\240'\216"
+	.string	"\221C\"\013\352QE\032\213%\216FC\351\r\216\b!\220F\241Q\210\025E\242\023\027\350I\215+\222xT\f\342I\201\034\"\256DA!a\221H\006\241Qp\347\2040\030CP\360<\036\205DAA\324h\030\3031\210c\264\"\217\301\223\007H\202\225\030\314Y\261\022\365\211`*4\f\016\035\213\202\351\321h(\270\036\215B\243\240\006*@\001\024.\260cd\024\246 \301\243SB\210`\321\3211\206\2405E\020\017\222xT$!TDAd\301\202\rE\242\320P\305q\207h\242\204\n:A\023%TPqL\bQt\344\202\212\243\316S\204\b\"\036\031E\004\241\330"
+	.string	"\210LO\b1tlA5@\210\265HhD\021<\032\r\335\240\007\b!\003rh\024\032iT\004\240\020\310\365\210\002EQ=\201\200B\024\t\215B#]\264\"\2172\230\340\021\"\032\036\241P\201\020q52z\300\206\243\020\321:D\021<!4\016\335 \221&J\250\240U\f\020IP$\212\300\032D\024\"\217\303\024V\244\220\350(\210H\030\0244QB\205\017$\204\0202\026\213$\220\250q-::\022\213$tR\f\035\025\215)\220\307\243\260\304J$D\024\256p4\032\3420T\244"
+	.ascii	"r\215!"
+	.string	"HX\342h4\204\263\006#\300\001}"
+	.string	"\004Zpa-\022\032#@\202\325\205\243\321\320\316\203\206\306\225\270\016\351\227pB\001N\030\261\"\375\b\004\210\200"
+	.string	"\021\320\217@"
+	.string	"\020\020\002N"
+	.ascii	"\322?\001\b\217"
+	.string	"\b1D\034\032\221G\255\242\204\n\241\013\032\220\301\343\005\220\033\212C\013d0\"\327\242\225hEZ\260!\206\243\260\005bq\210\f\"\036\241\300Y\203,T`t,\n\256(\236\210!HHt\242\002dz\f\036\205'L\254(\022\2358\272A>E\b\021G\343\252bh\024\312\300\270\016Q\f\221\304Uh\b<\006q0\2004\026K\360\254D'\2040\250@\327\340*Tl\001i,\032\001W\241bQ^\203\025@\032\213F9Gbq\2104*\246+R\370\202\320\221\360\204^g\030\232Xg\030\232\320Hm\304\021\022\256+\020\r\2050\030W\024(\216PX\201\3041\"K\254*\206k\320\372\002\221ph\\\217?@!R\230B\fA\302\023DDB\022+\214:\310\030\220E\0309$\262p4\032\312Y\261\n\021\207\347\212\023G\370\030T\217\306\242\321\270\242G\344Qq-\032\"5\321\r\362(\244"
+	.ascii	"\362($\332\3219\"\203zE\n\221\307s\305*DdaE\n\215BG\302\0239"
+	.ascii	"k\260\205\243\321\220\206\025)D\232X\207\204\307\343Z\204CT,"
+	.ascii	"\242\020<S\020\021\035\213F\350Z4D\032\035\241D\302!\222\270"
+	.ascii	"\032W"
+	.string	"\024(\206B=+\206(\202\310\243q\210\"XDj@yF8\256\306\034\303\272\222 \257\220\001\025\"!\310a\205\f2 \207AE\242UEp\206 \2125h\3359\256F,D\302J$ZU\240:\301\n\216\353\013F\243\223\230\"\b\013\rU\034\363)\003rH$<\032AZ$\006a\025+\321\232\213\2063\b3\321J$\nS\004\245)H\024\035\021\317\343\220\220(\002D\302\023E\242\241\233\021\212(\210C\025G\364\304\321M\007\343Q1E&\016\213p\320z\304BC\"\241\2123'h=\022\203k\321\020\251\256F2 \203+\206(\364\361\b)D\036\203+\206(\200#\034\207\204D(\320\343\212\034\022\021\255H\341\021(4,\036\215\206DDkpCQ\013D\307\026r\220\304\342\fCc1E\017\2210h\2104\256*4\244@\032\213D\025y\024\256D\022\024\205\202B+Q\013\215\240\205F"
+	.ascii	"\352\310\020$4\036\005\005\tyJT \205\341\261h\204\003$\264\252"
+	.ascii	"0\256\307\325\250\256DA\303\024\253\212\340\020q($\\S\354\244"
+	.ascii	"\304!Q\320*\024\f\032\"W\342\220\260\210\003R\205\021>\256H\031"
+	.ascii	"N\234O\021b-\032\"E\020\213EE\305\240\013\216\301\265h\b\303"
+	.ascii	"\212\024\n\005o\214\302U\206\234\002I,\026\2352\b\205\360\321"
+	.ascii	"xTLq\036W\344\021qX\224\036\205\210\305\240\365\230\036\207D"
+	.ascii	"D\303\"\364\030\024\"\205)\020\213C\344\021Q\321D\021\t$\221"
+	.ascii	"\360<\006\211\305!R\030T\244\300\321h(\007)$\302\304\"\021NA"
+	.ascii	"D\204\205\326\325\310\304\r\t\234\007\035\203\302\265\310\005"
+	.ascii	"!R\230\302\321h(GH\244\207\210E\"\025)4QtDD\323\"\022\253\320"
+	.ascii	"\021r\210$\022\002\205\326\325\350x\032\025\205Rdd\360\004\240"
+	.ascii	"\243\361\250\030\024\024\"\036\025\215C9k\321\020\231\221\301"
+	.ascii	"\021H@\022\207GzE\n\205\362Spx\321h5\212@\026\213F\0217\307\243"
+	.ascii	"\321\320\315\032,q4\032\3121\256BC\025E\243\221^\203\300U\250"
+	.ascii	"\330\302Qx\342\250\327\340\316\320\020\005\261H\242\210<\022"
+	.ascii	"\002\327\340\003\216FC9BGB\024\212\310#\241.\256DC\"\341Pp=\036"
+	.ascii	"\371\254A\304b\020I\034\026\215\202kQ1E\020\271\036-@\2520\n"
+	.ascii	"\252\020\022gH\021\\\221BcpE\221\350\304Q\360h4\244\001\031\034"
+	.ascii	"\201$\016\217R\2430EP>\020\020\t\017\027pA\005\035\024\342h4"
+	.ascii	"$\2428\024A\034\n\213D\004\031\217\"B\364\374\007ZI\355\274x"
+	.ascii	"\035\351\263{\201\256E\261\241R\227\266\250\322\203\214\314\315"
+	.ascii	"6\251u\345T%EJ\333\236\304YQQc\364e%\3411\207\3769\235q\221w"
+	.ascii	"s\034\031\026\335\315\314\233\252\246'`r\352\022P\215\222%\177"
+	.ascii	"Q4\233$)0\036\3006`\033\020\212M\236@\026"
+	.string	"$J\212\337\256\222\001\204\002\204#BCK\0328\340\333_\013&I\320\247+DO\n\037\320\315\346\2514\222\344\251\335\374\017x\350\037\370De3\222\364\365\307,\343eH\327Z\213\013\204\n\314\r\265\264\210\222+,W\322\256^\336A\244\215\t\232z\226\366'f\357L]69\271\3322S\305\332\262\212\364p\222\346\330\021\246NYv\235P*\026j\326\310t\337\016\0313\253m\fH\004\016\215rJ\f\250D\263Qa\201\304D\261\372\220\244$-Y\002\004\263;\271?\220\303jr \030\232\222%'en\006.-Z\232-\033I7\003\231\3303\340\027>:(\0378iu\215\211\227\223\021#\300$\337\220\264\267\322\336Y?\200V\252d\200\370\201H\016L\"w2\355\225\311r3\360\310\345\264\232\2640-7\003\275.Gge\353\206\334\f8&v7\377\203$\346\315[V\232\214\323J\f.\222\270"
+	.string	"\207\034\250\334\031C\003\207\215\233\201A\200B\222(\325\274\334|\273<\2300F\366\240\200\335\f\374\001\004\302\245L\213;\337\233I?/?=\037\032.\205b\242\206G\027\020\307-\"\304\313\006\227\246R\247\004\254\307\033\nc\234v\360@g$\311h}\335\035\250\027\320\207\222,Jt\350+8S\346\336\324\266\316/9}z[-r\350\2752!]5n\326r_N\362\2327\003o"
+	.ascii	"o$\275@y@F\003\261.\360\n\230u \326\231@\254\r\326\354X\313\301"
+	.ascii	"\216\325\332\\\021\324\306\311%\214\336\022\215U\372\245\006"
+	.ascii	"j\345\306.\257\251\006\254\252\322Ek\207\323\315\247Rs\315\f"
+	.ascii	"\032h\222\272\215h\361\232\241J\311e{h\330\310P\357\252\330\b"
+	.ascii	"\261\213\221z9\345\326\220"
+	.string	"\270\246\264\214\220\247|\222B\265rZ\r\256\255\244z\004\215\234\f4Q'\231\033f\013\312\032\250\363\214\346\201wC\311\023\224\n\346\245\211\f'\325\005.\262T\305\002\206\212u\212\311\260Kz\201\256\301\311\352b\221\347\0025\003\\J\3050\323\244\343\314/\254\006\260\205FC\347v$\t\220i\310]\330_\327\315?\220\005\232|K2d\313\315j\033\265\rP)\355\372\242j\372\001\223\016T\272j\241d\002\"a\035IK\372\003\356\253\246\f\312\305\315\367\240\313\237\007u\372W\331\240PA\226 9\255\321S=\224PqS\223\246\212\211F\310\231\253i~\325OE\223\221\210LY\336|\253\254\017\352\001\031\240\253gR'b\354\266\231>)hl\214\251c\256\366\375*\031\265\214\033\223e\214\233o\322\372\240\035\330\036T\325\003\272:\346\324\323#\203'\246\251\323\305\312\253\f\337\325\346X\225\035S\240nV\303"
+	.ascii	"]\345[\243c3\344\346\036\025\214\272\347\264\307\306B\365ru\357"
+	.ascii	"W\365\324/,\374\232\1777\337&\353\203r`{\320[\005t\325\213X]"
+	.ascii	"\334R\027.;SkzB\362\256r\031\013\201\005+\226\224\376n\006\002"
+	.ascii	"\272\232\367\036\033\246Fl\312\315Y\262\250ZD\260\273\205\331"
+	.ascii	"\016\247&6\023\345E\245\342]\325b\317\2002\250\214"
+	.string	"\361\360"
+	.ascii	"\316\212\025\365\356G\013I\f\b8\365\t\207\230\225z\345\352\035"
+	.ascii	"\316\016< [\313\272:U\312\217\336M\234\274h\246\031Y\222\032"
+	.ascii	"2\367\317\251U~\364n\262\243\251\211\227\270\310\273A"
+	.string	"\345j\225\314\225\323\347\344\016\254G\224(\252\224\251%U~7f^\220i\222\273*\005/,\257\213\007WmW\241\264\251g7\314\237\255\264\264\263\262\200aNI\276\374v\323\025\210\363G\025\260\0317\253p)\227-tc7\253o\247\215\030_\334~\025\207\253\316\312\230\233\337A\236~\007wii*\233\345a*miR\352\f\301\0015f\355*\233\033\216.5z\334\254\252\335\255M\254\313\2178'N\324\263\037-\2443i\033'#M?$1\031^\252\331\3253\2673=,qw\263G\332\224\250\335\374\016\202\250d*Y\232\343\003pi\254\264\225\223+f7\277\203\026``\252\230\005\260\234]jJ\230W\3052\022\013;67\253a;_\236\2245\306\244SS\336\244\320$I\242.\257\300\245\261\362\313\221A&\204+\211x\250d\344\317\326dt\222 \ffj\216$)\310\030\252\242\261\001\323\025"
+	.string	"0H8\"\220\311\246]\354\006\024"
+	.string	"\020[\316\224f\\#\314A(\221b2#\320"
+	.string	"Z\b\032'\250\252\022*n2\3473\321\323\351sH\002\312\244c\177(<\035\366\032-\332ME>e\221\314v\360\202\264\034\332\"\374\212`\024@y\277\227\254A\026E\326\244\353e\230j\321\020\023lD\314\313KP\316\037\032\335\024P\351\2312\265\314\357\024-\374g\027"
+	.string	"g ,\n_J\244\021\242\303E\037\251\355\260\342\336vw\021\356\304\360\244\207\3226\032g%JXNs\r\305\340\260-+W\263\224\363\0063\347 *\002\271T\240!:(\210\216*O\274\002\207\366\n\224\n\177\201\211dh\306|\307\013HKB\240]\262\253x\223"
+	.string	"\346D\367\n\370Eh\356Hj\323\276\364(d\253G\336\321~\031\027N\255<M\373\245\313\344N0\346I\254[\001\263\335_\030\t\366\327\242\210\345b\322\372\331\bzo\221\315\252\330/\233\033\275\030\355\257\351\246\242\221_x/|\262\364\304D\004\354;#\300\017\246F\013\177\254\313^\034\007\221\263\246M\323\317eju\353\323uM\236K\f0\337\267\242S2p5\323\223\316\3473\255\364\3201\273\303\3668\342Z\245\257\r?\fVG\247\250\023i\271\221\337E\b\263\023'\257\203\310\253UK\353\266K\200\315<as\331\334\334Pv\260\270\020\3356T\363\023X\302\275\234\031\021\227\220\315`\217\017a\b\232;bt&\266\316ao\005]\243:\372\2018?\342\221\355ZK\250.%\3202\356\311\356\230\033\027\004\204\223.\033\013\217\222"
+	.string	"$F[\312N\247\354I\221YJ4\222\364\0344\035\201\254\350\277\333&\"\267\316L\275W\204\013E]\274"
+	.string	"{M\023N\177\240\023`\324\006\205\346\301\325~\241\261s\310\274\017\216\016\346\t\363\340\250f$\247 \255\256+3\334\036I4W\350\364\331\201xm\361\331\275@\2575\023I\275\2343\255\326\255-\256\360\177\306o\t\265;\304|+\203q\370\3201\340\307&\275<\2168\275Ar\013"
+	.string	";\t\254-`\354B.\345<.\tc\365\344k\\\237~\225\2440q\350\370\230\336bP\230\246>%\200t\204[\r\226K)\024\234\207\206\007|f\324\221H\322yQ\364\275\231;<\223\342K\345\366Ya\253\332\304\2256+\376\207\317H\371\352\n-@\317\214\374R\302&\267j\360\242X\373RpK\217F{aJ\260\373.\005\257\252\032i\253\333\215\255\220!\216)\203\232\322>\322\300\200\322\301\341\271r\244\352W\301n\320\323\006\263\264\235\327\006\204E\370\370\t\251\035\222\270\373\225\364f\371\350z\323\304KN\271\216tD\177\301fr\375L\251U{\234\362A5\226)8\364i\254\315\242\352\2721R[\343\323\217\235\003\"aK\323\205\003\016Y5c\342\023\331\332&\317d\016\333\276\r\037%\227<\203q\\\330=\336t\027\333>"
+	.string	"C\021^<\t\356,Ll\002\bA\271\357c\323\327\201G\371\211\353\357.\376\321\237\246\017\240\212J\3240~xVz\325\367\377NQ\352\367p\rW\345j\214)\n\272-i^G\213{j\275s\211\252J2\3132+`R\253w\311s\347\335\252\352\b\334\2231\221\037\326:4\323b\325\336Y\302?E\003\021\212\350\206\247\234UU\305Eh\t\225-\037nPw~!\031W\303\235\252\216\n\351WG-\214\26483M-\363NR\021c\225\031\252E\005#\356\324'\300\350Wc\244\233U\221\342\323\255=\347\177\364v\2425\022\275\271\245j\223U"
+	.string	"\030\374\371\356n\310\314\256\351r\272\352\214M\375\313\030_\"y\013]\215iuY\206\353\327\030>V\210\373%\216\205\237\302\200\201\177P\021\3572'XR\202\252\347\226tL\265\037\300\030\354\276\2535HE\362\024\004\223p\3018\304\336j\\\221,\033\003-\327W<\t5\321\214\3119\037\256\245\032\017\340\243]Y\027\335(\026\323w\225\321t\300\212\300\200R\344\264\273\006\275\255\017\266\260\033A\244F\026\367\201\225\237>\206\364\361oc)\bxZ\267\206\275({\266\264\246\237\271\224\260\313\\\357\215\273\204\033\b\224\205\343\007\361\n\226\346\211\256\330&iPX\202\247\200\231v\236^\027\267\261,+\022\226I\240q\273\\\007k\367\250\262['ko\246\226\214\367\345\3025\3673\251Ez\351Ur\364\f\204"
+	.string	"hW\260Yr\354\006\307uQYHq\234o\365.\353\274f\341\215\277\203L\nZF\226%\367\374\265\020\\\207\3302'\003\262\341A\344yD7\022\324]\277\260\006\327\021\365\332\204\265w\260$\236Z\204\035\360\b\217\374\001X&\243\356\376\025\237#\022yzX\006\301\375\344\375u\003]\312)~,\250\035\327\362\376\273\216\361\203o\253\243e\202B\302\354\266AhCNo\221\001\303\375\334z\242\344\357\343e\024X+\256\365r\023\277/O\344Q\2431\340$\220\360\002\370\034\331\272\353!\255\355\f\227`"
+	.string	"{\237&PS(\306\257-\022\316s\026\345\020\020&.\002\005\341\231\233\033\237\262)\20203*\023\034\200yfq\353\224\320,\315^\242\372.\240\314\251G$\340D!e\276\246\301\317d\024u\314\345\312\346\270\257\366\354_\371\005\261\277\374\230\201)kbf\2233f\002|\330g\033\347\347\207ka>\337f\262.\363\312Z\266cS\3627T\310\001\213\232\276\323\376\376H3\335F\212|iM\316K_\254\224\277\206B\032\210@S\225+\360\326\231\265\273\031)\215\340@\026\036\256\235%\274\330"
+	.string	"\221\374\347.C\353Y8\343T\201\374\035\300Rf\273\351v\333\3768M\003\300\246N\242\350\fy\376\210\203\020\034\3455m9\224\357\357k%?\200\372|\341#\325\231\255o\245o\2045W\347\026\f,\306A6\033EJ\220\007\340\307\346Y\371\276$\334\0055\321\347\346\334yQq\001a\242iA\302p\302\261KKo\007\363\t9!\210w\326[\370\363\345\227)D\222\301\335\"z\3634\340\217\313\2342"
+	.ascii	"\025\346\307\021e\020d\211\371&]e\367\027\021A\207\254\317g\337"
+	.ascii	"h\230;\205\2772\212\204\267\363\214S\325\345\2441\204\225\n1"
+	.ascii	"\"\302\314_8"
+	.string	"\362\302q\2333\226\"-~\215\226d\360\027\007i\354)L\325_\350\273\303\bX\022\370\005W\211\271\2308\302\027\252\270\"\022\022\271\341\363a\267\356^\240\207\357\341\360\372\330K\376c\032`O\232\n\201\305\321\240\220\227\215\347\310&\022\326\317=^F\241\333\013\027\336A\"4\346\224\336FX\n\275\230\230\225N\"j*\003\003\253v\217"
+	.string	"\f\2478\331\262s\205\374}Yhi\266\372\321\317\275\350\002\352\366\030\274\030W\276\272\027\341\020\273fx\211\347\205Xv\366E9B\330\313\271\206\206\rS\035\034|\245\013Xf1\334[\313\265\267NT\366lW\303\224J\226^JR\024\265Cv\307h%%\3470\246\320\201\205#\351\210o\361K'kvw.\271\346\354\304)\344q\247\226r\"\361U\376"
+	.string	"5\333\263\206L\317\nb#\312\223\303:\233\001\353\265\241\247%\260\017\201P-\204Zm\316A\013\206EgT\321\203\200:\330\006\033B\033\351\n\344.\333%hh[\333[\004u\210\267hl\021\245Zb\257\201\216A\322\f\222>\267\316\037Oy\350T\023R<\247d\372\31288A\023\355\212\225lS\013<\200\251\373\302Q\312\345\227\257\361\214\347:\311\362gF\374\272\300"
+	.string	"\307\304`\367\317n\343\320\232\224\002\2107y~_\003-v\202\230?\360\207\013\270i\034\274\351W\276\252\211\205L5\034\270\204\243b4\223\026iHb3a\326/G\275\237\\\246N\032\nz\273H\2511\030\213&\215\r\326}T\027\0231\207ue\323 \0063['\351\202RT,aC\300\202\024\221\310\022O\021\351^\322#P\224\372\275\205\216e\fd$\031\351\227l\3650\315\342\274\236\301\305*\305\001\3131\350OH\244_\344+\242\004\220\231\222\226\003\211\177\221O\242\345\\B\237%N\226\035\351z\365\005\361\337\333\350\217\371\004\355\225\300\341'\030I\021\212\300\273\340S\323\032\3159x\241\371bg\363\235C"
+	.string	";\004.\230\345\367\017+Y'\350\353\016\247\266+;j\r"
+	.string	"5\273\263\030\2321\360\223R\367:\213\360\021\032\021 \026\374~\327\001\301\334M\"\202r\270&\023F\020\375=Q\374\207\221(\n:y\030\3773\013eCk1\352\f44D\335\232\r;.\347\272\221\344D\037\222!..\265X\n\"\363B\333#\341_\354\200\035}\233\030\316D\030t~NP2h\245\262\312\322\244\226d\\HkK"
+	.string	"\375E\247[k-~\210M\202\273\242\246r!l\231&x-\237yO\332.\313\304`\304*\322z\330\316\305\031}(\343\210\235\315\245\304\235\330\330\330\2166\026j\326r\327\317&6\001\235\232\302\233u\375\362\2270\225\343\276\363v\354\252\364\330(\007\313Wg\r/1g\2141\221\311\b\220\235\324u\024\363\337\301\337\021R\271\207\252o\t\330F\230\322\223C\304e\203\276"
+	.string	"\255\036\302\262Z\222\037;\322\201d\nD\234JC\231^\220\030\312;\365\232\t\225^O#lQ\r-i\2740\364\344\360x\240U\341\334\206\217\231@\003H\276e\314?(=\240\270\246\\A\024M\334!\2522a\001(/\252\234\032`thc\336\206\203\2655(\200PB\317*\270R\235\007\201\301\fD^\310O\001\177\372Z\341\313y\237\\.z\300zq\b \271\007\303\026\362\037\320H\230\377\177\b\302\212\250\376\032\321Lc1\211Z[g:\tE\315\250\376T\003i|7K\361\234\376|\2621\354\271)\001\210:_t_J\324\213\217\211\337%-\330\307\313o\np;\230\004\253\223\221k\353\371I\342\327\217\333O\255??\200\006\3750:\232\242\265p\377\315\313\003\025P\357\373S\260\313H=tP\220\002\n\262g\377\306c\250j\326K\310\226\273"
+	.string	"\323\304\273aE\377\243\366\325^\214C\026\315\201\0175b\203a\303\265l,.L\326\310c\3733s\0243py3\022r6\312\247{a\221\027#n\222\177\336s\313\365aX\026\200\302~\264\004\341\267h\213k!E\363\253\n\225\210\332\246\205@"
+	.string	"\223"
+	.string	"``yM+\304\026\301\317\3253\211\021<\001\254\256c\367)F\363\303\265_\252\f\300>h\242\207\362n\301\030\364\325\330\365\377\307\024Kro\250\201_\237g\340\206\270\252v`f\246\001\243\276`7\263"
+	.ascii	"\277\022\341\373v-\2042f\004v\251\366\276\203\274\236\004\310"
+	.ascii	"$`\006\210\302\206\236*n\353DS{\203\365\020P1\2555\374S+\350"
+	.ascii	"\240.\326\024\004\032\202\202\305\243\317+t\312 \342\251@\035"
+	.ascii	"\356\234\224\034\340%?\307\207\360l)\\osAod\205\030#[\213t\203"
+	.ascii	".9E"
+	.string	"a\003\270|B\320\362\003\245\332\371`C\034X{4\252\312L\3219\341\027\334\2116\260\251M\335tsr\262\326U \234\333\317ns\177\212X?\203\\\211\242f!D\346\205 \013\355\201\023\311\304\226\0274\"\004\b\363\310\267\021M\324\313\b\320F\242\275m\t\3553\225\325\244&n\361\371\1774I\273\3516\235\347+\314u\002.\2430\262\301\033J\350\017\005Z\344\"[\006\301\311\"\331\302=\311O\332\"\025\333\375\221[\026\326\022\220\212t'\311\325\300\264\363\021\215\372\r\316\023\205\233\241l\3129\"u\026\350\002\213\230\371{Z\257\310\275\f\006\35482\037\310(N^\304A\031\300\240\r\252\250\251\312\254p\032\267\226\314\223\300\315\3341<\322\201\r&\222FG\002\347\305\036\022w\2002\242\023\363\240*\t\033>\350v\222\304*t\361x6\200e\001\220t\375\302)\177\375\bYi\350^\233\341s\033\303\016"
+	.string	"\033\033\356;\254\325\r\251L\002:v-\256\267\026\331 \3519L\"+=cUb&Gu\003\030\031\275k\22459\254\226\234_\376\311\353\211\276Y\371\033,\206\344t\020Q8\315)f\314\013\333\346\322A'\305#g\204\r?\261\320=\035\315\366\345\t\222\320;v/^\275aR\325\005+\215\022\177\273\273!E\310\274\352\200{r\322\343\212\334\344\n\221,\242"
+	.string	"\265\363\317\226V\b6\t(\036\253(zMH\027\371\021\255\355\031GF\243wj\210\377\316xr\345wG`\235\232v7\214\032\352\355\r\304\2170.\\\370\372\030\272s\326\002\0363f+1w\253v\2316O\310\353\\\0052\241\220\017\004\b\350\251\002@dFp\364\337$K\253b\371H\316'\360\fN\314_\037\271\376\203\007x\003\312\204\330"
+	.string	"\334\3175\376,\013\305\264:+\246\320\260\332OM\021\202\261\3565\342\250\206Z \271\334\242\331\215V\237\013\266r\021*\235\366#P \377\261\026\303?\2544\217\325\320\341\230\205[\341\300\334\026\033\001s\327\3773\200\337\031"
+	.string	"D\302g\323x\250\023\3109\262\034"
+	.ascii	"S\343\235(L\3469\352\017qw@\370i\352'\367\202\003\260\356\254"
+	.ascii	"\225%{\255\326?Ers\263\222U\007{\265\320Q\331\226\322\314\260"
+	.ascii	"h=P\2652S4\234|\265\312\222\2642\003[/\264\233\220\215l\266\240"
+	.ascii	"9,\366\275\253\326\361\244\355\325\211TZ\370*\331\354I\345\024"
+	.ascii	"DH\213\0355\270\267\275ee\b\323=\365g\320\215\3404W\374\275R"
+	.ascii	"\254\203c\037\360\2745\277\374\210\267\030\0218\375\333\352\252"
+	.ascii	"\310\345;\225\332\003\323\363\025|\020\223a\264 \322\3616J\013"
+	.ascii	"\332\263\026\240\343b&\366n\333\303\205\345\236w\217\t\017%\251"
+	.ascii	"\"\273\367\200\032h\313"
+	.ascii	"A[\312\201\310\022\236\304\230\270\t\303\353*\300\324\230\324"
+	.ascii	"\332\322`\323&f\215\037\347\023$\210\256\265\305I*Ri\303)\236"
+	.ascii	"b\255o\372\223\226z\273\326\366\253b\314\235\313\244'F3\353|"
+	.ascii	"\025av\203^\330\234'\026\3036\0013\237  mK"
+	.string	"\357\017\276S\364\206g\033\352\377\373m$K\355\001\3037\227P\312\020\271\354h\221\271\324\273\017\301\246\356\205e\250\017\002!\001N\276\345Cl\213/\332\340\300\241vi\276Kb\260h4A\n\0055\367\357\342\211/v\241X\227:\361\025\243\317\"\025\3170-\301*A?0\306eh\373\267\221\354\017\233\033 \034\024\250\024\020C\006\250\236P\343\033+1\345/\230\241\021\352\344\213c\253\3268\250\263\202\352\007\217)\202\367%\306\017\254r\2473\276\n\231,\213\2119\246\272vr -\204\323\334U2*\345\303<>#T\221\007\t\323(\264\254YL\215\2430'@\177 \346\031u,\256\201uJ\b\351\002\200SbcA\006\375\235p\333\235{[\035S:\221\236\201dU\353c~+s\222o\b@\275\313\206\262\234?>\214\2212\327\300\362\036y\t\251\267\375\326\374\217\220\213\034\265\t\372;\373\346\273d_"
+	.string	"\321ZH\370\212J\211NS\254\214\016\002\036\236\312=\220_xh\202\267\265qA\273\266\267\037S\tY+\300B\246\307bu3\277W\214\\\323\204z\373E\321\207[w\313\b\235\300\315\271\314\n_\275\243\373[40\376\307\001d4\232\"\216B2\032R\275Z\027X|\263\351\211\3555\324{\332\262q\241^E\345f\277<H\276,\314\265\262\264Ceu\"h\376A\372\376\362\243!\272\277\2504\031/d\320/\003\376\007"
+	.ascii	"\336Q4o\310\373\205\314\341\331X_\361\035\311\342\253\260\267"
+	.ascii	"\021\334\252N6\\\372!\325\244\253W\321\362\265\376\366\252\361"
+	.ascii	"0\340\324\035\347]b@us\246c\257\250}|=\254\0231\017f\356\273"
+	.ascii	"\342]\346\372@C&&\343\306\\\372Ui}X\355\336\025\020\316v\321"
+	.ascii	"u\325\204M\355g\207U?\200\035\377\202\033\311\236$o\203\245["
+	.ascii	"\213\367\315\327;\342:\257\302\310~X\276\260\016n\021j\277#\370"
+	.ascii	"\333\222\025P\r\006e\373ug\251\022\256\245\356\207\324\373\346"
+	.ascii	"\211+R>\331\017\361\336V\302]\345\276\f\275iA\317V4b*?\311\377"
+	.ascii	"\315]Wv\024\027f\353\364\233IC(\261w\312tf\217\221\344Q\367R"
+	.ascii	";\0365\257i<\236H6\250i/)\317\2339\257\370N\321\2329\263\371"
+	.ascii	"\262\262\275\264\3178\215B\316M\2572.\250\243\234\310\356\352"
+	.ascii	"\257\215\034\326\\\263\362\375\2142\227\252\177\370\301V\031"
+	.ascii	"\334\3302?,9^l\031N\342!\231\323%\351V+\375\226Q\215{\373\227"
+	.ascii	"ehe[\350\310p\177\222\320\264\245\363\f\317+\036\260\354P\262"
+	.ascii	"=\004c\27772\341\303d\324\215\027\302\213\024\274\203\201\353"
+	.ascii	"!8?\212w\320\273\201=\303\364\005\201+\362\2750I]AF[\307\302"
+	.ascii	"=;\\\3035\315\2218\233\362\257\211\260I\371\214\332[/\223{N\322"
+	.ascii	"o\361a\314y\321\351\r\366\026\323e\nL\346\r\352\370\220\352/"
+	.ascii	"a}E\261\351l\272'G\264l\271\267\357\230\376\351\273r?\263\203"
+	.ascii	"\300\235|j\275\217It?s\033\362\277\300kS\207\353\217\224\333"
+	.ascii	"\303\252\270D\321>Bn\377\177\315\263\347}\035\\\377\351|\321"
+	.ascii	"\315\370\257\377\003\345\221\332\023\374\367\006\"\237|\307\023"
+	.ascii	"p\365\035 \035~\370:gg\026\363\265\320\245\037o\330w\276\204"
+	.ascii	"\276\0246:\307\253\372\330\003\266f\303\206\347\226\031\373c"
+	.ascii	"\333\207Gw\237\352{V\371\322\342\370bxZ\360\264\311\230\376."
+	.ascii	"\246\272V\232Nx\360\2626C\372\3461\275\353s\037K\307\336U\353"
+	.ascii	"@\202\246\036?\037fru\354\342\020j\335p\2731\353\375yV\335b\232"
+	.ascii	"\326\017(w\331\377\371\371\305;|\177\255\357\020\206ssi3}\177"
+	.ascii	"\341\363\240\030\304\365\004I\357\245k\304\200\357u\225\033k"
+	.ascii	"\2363\374o@\r\021\377X\277'\306\241\024x\337n7\315\003o\325\333"
+	.ascii	"_\244\263L\370\205\3545\260\236n\351\177\211\017X\026\352\037"
+	.ascii	"x\263\264u\035;8\"\210\375\250\340$\370\331\252\331\017K\314"
+	.ascii	"\363\331\351\234f/\357/\355{\204g+\376\254\036\314\370\035\302"
+	.ascii	"%\230\2677o\300\035\262\234\214\355]G_\364\336\210\354\255O\352"
+	.ascii	"\016\226\332^J\007*&\364\037"
+	.text
+	.section	.gnu.lto_.symtab.a92a11effc6ce750,"e",@progbits
+	.string	"gpsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"gpsData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"gpsIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"dTnav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"ubx_nav_pvt_valid_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\003"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\004"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\004"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\004"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\004"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\004"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a92a11effc6ce750,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
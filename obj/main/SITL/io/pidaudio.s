@@ -0,0 +1,488 @@
+	.file	"pidaudio.c"
+	.section	.gnu.lto_.profile.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 s\225\002"
+	.string	"\344\003g"
+	.string	"\t"
+	.string	"\266\317\357\244\017\n\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\367\227\233\370\005\003\262\374\202\245\005"
+	.string	"\004\005\006\354\206\342\366\006\002\007\256\330\276\211\r\b\316\211\235\213\003\006\002\003\t\352\263\360\321\b"
+	.string	"\007"
+	.ascii	"\271=.]\262Z\006\360\2452(;\2766\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 =e\001"
+	.string	"\3401"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\005\006"
+	.string	"\003\007\001\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"7\003\377<\002vQ\254\001Co"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"E\004"
+	.string	"\362\306\026!\240'\351\340\377\372\217\255/\336K|j!Y\235M\210\rp@\340"
+	.string	"|#g^|\322\032\331r\247\277\375\203C\334$\262\2000\017\031\017\207\204\031\220\016\244\263(\350?`\211\266\212\347\233:\364\335,\373\005\264o\226\362\023\022\247\303\266]^\261\321\266\300\277\207\253\255\341\323\246\002\021"
+	.string	")\016I3"
+	.ascii	"\200\006\004\347(y\003\206(\206` \b\310\016\200\230\246\3206"
+	.ascii	"\006\376'\004I\323\335\256\006\205\251\360\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"5\003"
+	.string	"2E\020\033\300%\215\001\203\327EC\207\370\377\373\354\377\301\027\004\203\304\033 {\023)eJ\001\352\207Jy0\252,\256\216=\321\241\022\352\251\346\207\272\360\204\215\261di\r\243Tpy>\344\207V\200J<\020\r"
+	.ascii	"QI\031\027\006l\302\227\230F\023\307@\201\201\252\016\320\234"
+	.ascii	"\253y\231\315m5\233\024S\337\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\006\204\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 \204=\002"
+	.string	"\204\002x"
+	.string	"\007"
+	.string	"\002\002\004"
+	.string	"\001\002\004\001"
+	.string	"\002\006"
+	.string	"\001\002\007\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006\001\007"
+	.string	"\b\b"
+	.string	"\001\002\b\001"
+	.string	""
+	.string	"\r"
+	.ascii	"-\274f\216\273i\001\034\342llE\267\022\030 \r\220\006\250\005"
+	.ascii	"\001@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.60b961f0f3b9b986,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidAudioInit.21.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 \315u\005"
+	.string	"\"J%+\200k:\300Tpl&\222E\r\361P\273R\275)D\274#!\016\232\327\205k\375A\372\031\200\251\300\033\243\267\032 D\233\225[\246\277\252J1\207\205\321lV:\027\324R\314Kc\314\252\360\232%\264\331\250U\233\223\330\313\240\024\216\022\356\316\362\207D\344z\2474c\307\334/r\222/\377\002\232\301\237\247\016\365\351\256\214D=J\234\314\377\235\276\375 \302d\340\241lB\335=\031\263\333\312\355\273\341\n\274\217[\031@t\367\245\367Y\366\274\377\r\377\017\377\037\001\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStart.22.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@+\260v\203A\004\031L.\b$v\031\344\224\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!E\032-\354\235\345O\251\310\375n\030\215\036w\277\330I\336\374\033h\016\177.p\016\241\356L"
+	.string	"@\217\224\310\363\177\253s\277\tq!\2240\240SwO\356,\267\222\373\356g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStop.23.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@cX\030\007\217\200\350\320\037\"\244&\f\300\223\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!%\032-\354\235\345O\251\310\375n\b\215\036w\277\330I\336\374\033h\016\177.\230\016\245\356L"
+	.string	"@\217\024\250\363\177\253s?\tq!\2140\237SwO\346,\267\222\373\256g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioGetMode.24.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\222\314-2pM\322\001\260\006\200\325?@\3331\312 \350\202M\255\002\314X\252m\315n;['\242\323\244\203\266\374\257^\377B\027X\362{V\305\027K6\2212\245\276P\317a\",\030\227i\3175\007gih\227\352\241Q\006~\031\206\252A\274W5)\356\325\223:ut\302~\310#\3649,\241\311[g\276&:K\r\300\350\344\307\216\234\324\f\373\320\252\307v:U`\244\300d\267\342\263\262(\254\244\303\366\306\226|\217\177l\f\241\270q-\250P\210\244\354\3066\235 :\203>\020\235\251\306\341\023\372\007\371\001\311\211uq\236"
+	.string	"\n\273\353\264.\213[o\033\301v\202\355\213\b"
+	.ascii	"2\003\316:#e\b\3055Q5\002_!\262pW:\355$\003"
+	.text
+	.section	.gnu.lto_pidAudioSetMode.25.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"]\007"
+	.string	"\262\21644`o\032\003\027\022\302\016\001\231h\243\226d\347\020\336\004\004W[\221\316L#\253\203\313nO\036\342C\311J2`\022q\205\302\333\364\243YK\232l\271\245L)\237k\202\252z8\023\273$:\027\026\222\023\223\017X\007$=\031\204\344\030t\206>\231\214\2303\223\033\356\256\016Ou\310H\225 E\037\254O\2142\252A:!z\336\034k\221\345\0309RF6J\257k9\322\203\036\255\253\377/<\265F\331\257b\320 \350\376\213\016\346\251\330\022\262i\353\327\232\304%\232Q\243j\376\216\025\226\237[h\002\200\343\201\007,\307\312\002\226c\265\326\245\240\" \306B\345\345\277\204\037\326\374\264\332&\326l&\222_\246\341\177\337f\302p\241\333\"\264Uh+\022\b"
+	.ascii	"2\241u/pq\241\020\f\271\004K\254\246\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.26.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375`\375\001\035\021"
+	.string	"\006^lH"
+	.string	"\257(\035"
+	.string	"\210U\241\277\257CXQ!\342\241\231op>\3262h\004\255~_\343\242D\237B\235[\277|\370\266\337NU\221i\007\r\356==\374\327]\372\\\025:\205\355\343j\263\342\006\353z\307'\204\020\"eJ\001Y"
+	.string	"V"
+	.string	"S"
+	.string	"\250{\300\317\353\270U\224\2771\246\356\271\252\345\240\207\027\354\264\033X\361j\321\217\302=\362\003f\264F\226w/\377\017+\235\022#\3139\320\030\201\343\230s~F\226.' \347\345\005hL\341\024\304n&\234vU\031W\252\337\307\234\323\332\032%\334\033\267\355b\233\201\255\b\002\266\230\313\213kY\220s\245\006\215\211\323\241\330\360\331o\337\017\361\362\3442\276\t\025'\366A\234\264?F\271\214\327\206\306\366\316F\261?\357\3644\177\354\321"
+	.string	"\365\331\211#E\316\025\017X\213\231mNr\301;'"
+	.ascii	"\337\031e\3038\t3_\252\244\210\260\3159\303\305\3605\334\312"
+	.ascii	"\374\223\007n\001\227\216\332\310\310\261\260+\003\367\373\240"
+	.ascii	"t\301\322\035\3733\037q\36238D\324\267D\357\335\367\033gn0\225"
+	.ascii	"\326\360\247\007N\342\331%&\372\026\270\247\335\303\241C\315"
+	.ascii	"\255\306\332\224M\256te\366\271\271\027\354\317n\360j\275\372"
+	.ascii	"\001@\001#S\310\344\300d$\002Z\324!\222@JB \244\221P$\205\"\244"
+	.ascii	"PH(*\221\204\035\004,\216\214J\241I\024K\341\207T\375C\265+\217"
+	.ascii	"E\273\251\n\340\312|\022\327\023\272;\246\210\371VF\023\343\212"
+	.ascii	"\021\243y\344\210|w\203\323\001P\277$A\320\267\374\362\235\206"
+	.ascii	"\327\255\266\332\324avj\001/ P\002!\223\260\035\222\200`\370"
+	.ascii	"\315\260\225@\231\367M@\330\325\035lK\033\250j\002\203\013\347"
+	.ascii	"\232[pw\347\363\206\327C}\016\0342]e\243\325\276\027|\0304\345"
+	.ascii	"\230\344\023\303&\205H|\267\272[\364\232`;l\320~\"8\217\035\n"
+	.ascii	"[$\rj,c\341#\203\340\202\033\314\247\334t>\326 3\236\356\271"
+	.ascii	"\274\fq\016_\227z\355\204\002"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.part.0.36.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375`\316\b\335'"
+	.string	"\232E\320\016G\220XN:\301\365t\245>\376\020\356\005\341L\342g\314\032\036\033\207\236\322\246\202\240CC\271\243\243?\253\376\217M\301Y\034\231\024<I\023\312\214k\025H^"
+	.string	":\240\316\364\256\023\n\352)9\2761\333\226\020\"wJ\001\327"
+	.string	"\315"
+	.string	"\322"
+	.ascii	"b\265V\n\024lL\314\351\305\022\346\t\271*\325T\330\243"
+	.string	"<\275X\202\002\247h1\250\025\201\236\344\335\247<9\236\247\004\263\277\345\344O\232\276\304\207b\326\344\177\235\211\275\263\211/\361\216\205\355L\230\364\267\234|%\367\362.\t\022\024Lr\264 \323\345\007\020\234\316u\302S\\'h\005\222k\222#\213\214\003z\362I\274;\351\007\020\236\216\004\005\017\310U_<\250Z;\242\246V.\241\223N@O\336\210m\247)?\331n\347\302\252\367\222J\361\245\246\326\332;\271;\376\364\\I\216;\351\223\237#\002>7\211T4^\262}Z\265!\323>\255\300\306\217},R#\013\221j\3067J\030,sj\2558T\303q\356\234\346\210j\255>T\325\255\273m)\333\031l\332%~\226\177!\346\211!\312\223\337{}\216\225iUA\315\270\271W^\372\261\256\016[7\035t\300\200n\032H7]\340k\367\017\235&\360\266\333\207N\367\320i\036:\275C\247u\350t\316"
+	.string	"\335\264"
+	.string	"\335t\200\243\335"
+	.ascii	"\350\364\356\\n\034:\255{\327Mu\3239\335ty\261\233\244\323\343"
+	.ascii	"\313\356\245\32337}\004:\022\316j}\021\347\246\342 \245\374\270"
+	.ascii	"\222\277\353\027\373\313~*?\332\317\345\327\362\257\375m\177"
+	.ascii	"\230\357\354"
+	.string	"\373^\016\306\027s\267\266(\027av8Qc[\373\362%\f\203\032\226g\361\267\274\013\227'Z~\210]IC;;\333\272@\257@\271\024\237\354f\336\225eUqQ*\350\304\002\245\342T\247\230\214'\314\251\302\253\036\001\333\340K\2678\033\024\326\302\305\307\rM\026\276\243\301\222\322\355\273|\334\332\222\205\315\357u\034&m\306\334\322\235d=S\350\025\366\355&+\205^\256\275\201\303<1\267c\255Z\240\311-\327\250FY\n\270q\311\375\330y\324\206i\305\263\361\216\260V(\004\273\343\016\235\031\276\005g\234\347\356\006}\r\325\330\035f\224\213\207\303\252\265F\260\315`\n}?\263Vk\235p\322\023j\006\217\374\254\223\376\220\224T\236\234{\263\217[]gk\222\034\315\3134-\300\371\306\373\357^\331q\236u\341\300\332\370n&\033\034H\200T\034UA\032_\215\335\350\017\242DC\261\352\224'\261\006\177"
+	.string	"\371\233\305\230\325\n\374\r\373fl;MbU\300\213\232p\366\311\274\f\210\033\214D4\025!\375\226\350\206#\337\364\340\233F\"\232\212\220~K\271\244\021JLc\022\323\021S\221\211\244\021\324\037\032(\375\220\232\216\220~K=\245_o\304\357HD\357\003\211\022\275\006@VZJ\"\321cRR\"\321\233'\202\332`n\257|\266\217Z^H\003\243\326p\034\240\303\"\342c\3512\r\2112y?Q\036X)\373g\006\255]\244a\236h\236p\201>\260A\013l\214I\001g\346&\032K\2405P"
+	.string	"\350g\013\254\221U\032\002\373\263g\363Y\002[!l\370\026\254c\317\372l\2023C!<\253\263=;\0246\274\261\263<;\204F\303\305\375\232\341\233nd\354\354~\361\310Y\235U\320\026\303\305\251\266\006\3037\321\250r\366n\037\255\004\361\002\327\204\006)`\007\314\025\237*.\364"
+	.string	"\002"
+	.string	"l\2005\262j\262["
+	.string	"\3734\234\335\005\200\254\250aL\246\224R4#\"I\n\n\222\306\360\002\221)\342\034\022`59L\033\207f(\230 \n\212\213K\3526A\034\241\365:QI\322\246J\bA\200\375\216z\023\301I\256 \244\211\002\016\306*\201C\204\300zJ;\n&\032\350o`\250\336\301\346\0136^g\261\350\207\271\263\016j\336\022AD \"U\325\323\031p\350\"9K\342\313\237?\250\326F{h\202\326z$CT\342\367&?O!\260.\346\224I\210:\264P\241E\002v\355\036\246\t0\254\260\027dB\020\370\214\367\027\371\357\205\351~\033!\237F%\177\274s\023H\342\bD\030\370!\331\340"
+	.ascii	"\343Lq\221\006\211\2304u\027n\231~\204\377C\202\376o\320\333"
+	.ascii	"\242\220Si\300Z\336;\233I\267\"8\356\"V\206x\"\276\246?\334\353"
+	.ascii	"\210\254\343\202\017E\n\210\307xG<\340@\261h\255\240\f\357\213"
+	.ascii	"e\322\002\267hP&\265%\372\354w\215fR\302\352\3700V\261w\t\203"
+	.ascii	"\260ed\210\252\001\330\037\353l|\254\f/\240\315\377\301\032F"
+	.ascii	"\033p\344gQ\244\2021\260\027.0\352\305\210R-5\225\007\214\340"
+	.ascii	"`\353\214n\224\361\f\225\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"m\006"
+	.string	"b\t#*pE\352\216\317\255\013\355\030b\272\376\360YcU\253\332\006\376\377\377\377\377\177\007\250=\360\017Zi\345\007\331\2321\267\275\345\226)g \032'\227\n\343\315j(5\253\240j\003\300\"\211\246F\232\333\311\355TB\273\2143\201\252\316\227\n\237\257\306\211\214\021\030\037.6X\254\320\356\376\267\200\2129\245\2529\340\202\200\t\023k\022g\021c\321\353\007\304W|\266\271\277~\355X\363?\327\236\3679~\376#\013\225\335\335\001\356\342\177\245\004\033"
+	.ascii	".#\201\202[\204l\255\324\300\022\330\027,qY\335\263\206\001\352"
+	.ascii	"\001\300\001\300\001\300\341\003\344\363K\225F0<\277\221\031"
+	.ascii	"\034\240\035\370\034\370\034\370\276\223\260p\243\b\001i\352"
+	.ascii	"\310&\230e"
+	.text
+	.section	.gnu.lto_.refs.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"\002\f"
+	.string	""
+	.string	"\002\024"
+	.string	""
+	.string	"\002\026"
+	.string	"\001\006"
+	.string	"\001\001"
+	.string	"\001\007\001\001\001"
+	.string	"\003\b"
+	.string	"\t\002"
+	.string	"\001\t\007"
+	.string	""
+	.string	"\t\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.60b961f0f3b9b986,"e",@progbits
+	.string	"(\265/\375`t\0135="
+	.string	"\232j\214\027CP\236N\007wL\344\364\222\367\272\2742\365\374\030\027\265\303\310\2163\276T\rb\f?\361\332v\322\264"
+	.string	"\274\020~`\003T\336\324 "
+	.ascii	" \006\204X$\366\002\b\301\231\211\027\320\300\352s\215\256t\327"
+	.ascii	"n2\245B\001[\001m\001I\374\270\354\260\332Q\371\213\217\3610"
+	.ascii	".\306\301\370\353v>\327N\347^Z}\377\237Z\344n\274q\331j\335m"
+	.ascii	"\313\026\027S\227\236\013z\016=\016\033\211k\377\337\027\272"
+	.ascii	"=\213\333y]\317!\340\372\2673\013\222v\375\3359\374\177\244\b"
+	.ascii	"?\204gh\362~\324v\312\356\372\321j4!w\204\334I\271!\344~\220"
+	.ascii	"{\310\213\326\342\236\037\255\033\274hu+L\355W\212V\250\364}"
+	.ascii	"\241\"\235\030-;X\305\323nos7\207+\266]\356\307\375\277D<pwQ"
+	.ascii	"\234Xu)>\305_\207\353\366*\376\326\352\233\373\323\377\027\250"
+	.ascii	"\350\03433\207U\006~\264\252^\264\266S\351 \276\317\3208\267"
+	.ascii	"'\255B\236\264\366\353Gk\366\242\265\333\205\032t{\017\203\356"
+	.ascii	"\256\353n2)\336\272}\201\003!u;\031#/\220@\250\333\307\360\335"
+	.ascii	"q\004\206\003\344\f\032\031\002\036P\273}M\267\033\350\366\001"
+	.ascii	"\335n\324\355\002\272}\250\333s\267ww\007v7bw\323\351n9\335m"
+	.ascii	"\330\335\205\335M\330\335\203\335-\330\335y\335]\242\273\357"
+	.ascii	"\272;Mw\363u\367\036\211\356\206\353\356\002\335\215\327\335"
+	.ascii	"9111\261\333\305\272\261\202\356\254$<\357C\263~V\347qO\352\006"
+	.ascii	"\362\242;\370b\017\020\374\0373\002'/\231s\232a\265\273\031|"
+	.ascii	"?\371o\022\375\373\320v\232\326l\255\360E\211\336\367A\340\247"
+	.ascii	"?\276}\323\242\252\373\370\337\367\177\246Ec\264\257\013m_\267"
+	.ascii	"9\364O\267\371\377F\207\3328g\323\333iZ\264\235\272Q\242\177"
+	.ascii	"~\363\247N\037\371\351F\3332nt\250\235:\243\3553-J\244\303\b"
+	.ascii	"\0207\256\"|D\234\260}\376\227\327\231\023:\264\327\276\356\373"
+	.ascii	"\375{\234\326C\035\374\237\271P?\347\016\247\313\332\373\312"
+	.ascii	"\332\342t\375\375\377\002^Yj\356?\367Z6\367\237-k\352\27504\337"
+	.ascii	"\275'\342{\315\037g\337\245\365o\340\337\177\257\377\246\377"
+	.ascii	"\336\3777\377\277\007"
+	.string	"z\366\376\227\r\265k^^\377R$\257?kz\321\372\307q\200t\321v\252\3462y\2712]\373\255\267\351k\357\227\006\315\323f\225\357\372\177/\314k\321\034o\320x\032\037\267\f\316\211\325\366\255\214\306\371~\344\362\300$\301j\3178\243\327\323&F-\016\253\256\207=\317\367\332\365\334L[\310\320?\317w\373\177]O\375w\2727\bro\300\023\346\210\023nU;F\031<UN\310\234\036V\333\361\272\035\213\307\371\035v\t\370\300a\322|\261J&\007\317G;\262F\030\350F\315\223\03370\024\311-\n\272\225\035\256hfi]\030\2541\224\247\255\356\335\201\277x\324\342\b\316a\025\343\300]\376&\300^\305\346\233\020\020\"\024\304:X\355\242XnO\260z\242'X\273\250\225\261\023;q\353o\017\346jx;\232$\001x\222\021\242\341\255\306m\230\036%\177\315#X\305ZE\367\312\034\031V\261\215"
+	.string	"eBr\310a\025?s\235,T\320`\025g\365\340\345\251\365\3500\252\016/mf\3662\376\027\277\353\371\373`M]\276\336\034b:;v\0341\017}\226 \242\233\026\206t@\260#\002\020\"\007W\210\3256\364\276\356\366\311}]o=\3369s\234\216\317\206\2729n\262X\233\370\322\361\276"
+	.ascii	"Qr\330\255Y\223#GP5\334\2016\250\226\r\r\213"
+	.string	"\377hzk<\321-)f:ra\027z\240K\277(x\207\337\272\374ais\267\023\276N\350x\352\3337\003`!\323b;\374\227J\360!C\307\f\177ng\343>\370\372\240\367\215\370\340\306\316\315C_\t\355\205\271\350\336\267\376\271\340\237\007\256\377\376\272`\320\227B\223\332\327\270_;\340\353\200\036\230\233\377\315\367\301\034\016\307\327\233\303\227J\223\3247\200C\f\333\374\374\273\375?\002\036>6$Z\264\344v\266\334\270{}'\364\377\303\002L\243\205\013\314$\022+\367\224R\2251j\271\024\365\002\304\212\247\024\0368\030A|0A\302\350\001\205\021\352\211\210\215J\262TH\366\n\251,\3012\221S,X\346q\311&Y\021\004L<Ya1Y\250\237\236RZ\272Z\2622\220K\251\003Lc\0233\211\304\352a\223\312\0245\216T'\256\246\230\307\252\245\244\262\252J\031e\200\205\221<\242`\251\216QW"
+	.ascii	"\244X*\027\307$\b(&+B\310J\311\204b.\217L( &2\371$\205\264\352"
+	.ascii	"\371\351\002A\025\224\230\313\243\225\022\313<JY\2518\352(\344"
+	.ascii	"\222M\2620rc\320@AC\023\215\236nr\252\340Ta\355&'&&'\rL\2715"
+	.ascii	"0\025Y\243\324\023\r\245\213\036\326x\305J)I\bQ)\225\035\214"
+	.ascii	"<\314\236RbN\301@R\275PZ\261\313%\246R\271\\\nP\205\005U\274"
+	.ascii	"2\036\231\307\017WH\032\034\244\220V@'\374\311?x\bo&&\017\fT"
+	.ascii	"\224\020\221\243\224\224H)\254\243\024\322jI\211\\J\"\217UKQ"
+	.ascii	"\313\253%%\2444h\320\341]\032.\037\270u3\261\260\037I\270G\373"
+	.ascii	"<\337wj$"
+	.string	"u\362\205\325V\307r7F\303e@\204Q\342\030\341\321\007@Z$\214\315Y`\026\262!jX\225Jq\231\235\036A}An\340 k\\\346zBYL\214pq5@O\330\244!\003\034\033\233\022\264\305NI\233\03111$ykZ\007g%,\314\003\273\030\200\352\250\221Dg\2144\"3\"\"I\222d8\240\002\221!\253n\021p%\324J\233$\313\032\221\004HL\350\024Z\240@\373h/l\376I\263\332\275\326\344!Zqb\376N\267\003#\215\352t\205\336\213=Lu?d\230Lk\227\224\f\212%\351,\200J\375\352x\366\264\251\247\204s,,\375\240\021\025\332\024?&w\274\344\352x\316\035\313\265@\221\243\tT\022\240\340\021\034\2333P\025\255Oa\210\301\342\217\346\330\313h\256|\242n\334\031\317I\204j/\237\230\374%\002\035\203\305\320\020\204k\364Lru\333$3\016\302\300\274\232\203"
+	.string	"\243\315\350\241-\035\222"
+	.string	"M\364/{x\021\002Z\004\034[I+\366yEQ\343\343\212jr\312\226%\233\335\230\254\013\324\311\325\030\373\334}W0\n&N\240^\202\214Ec\272\217\321\237\003\001=O<\230\230?)\372\177\253\276\367\312\013\265\036F\377\345t{\345*\261\214\3509l\361b/I\243\223$\032)6\031\202G.\265\323\213L\244s\022/\223\362\024\320\214\216O\300\325\222C\233\200\034uB\265\312\300\334\251\030\334\202hB\252\017\2544\r\274\237\360K\316\323\237\003\326\370\330\363\303Gl\360(\277\001\206"
+	.ascii	"\271\225\312\213\213\034\240\204s \256\013\367\300oS\003\364"
+	.ascii	"\311g\344\347{\343,\245\201\261\226d{\020\343\252\346\370\220"
+	.ascii	"\323\332\231\016\257\264\236Jozgu\013\200\377\337\027\256<\016"
+	.ascii	"\023?\323\340@\356Sn\242\3573\030.\330/\257\247\233\305[\236"
+	.ascii	"\230\226\b\353Y\226\375\310Y\350m\300\377\361i\262o{\255c\333"
+	.ascii	"\216\255\037\323\320\375\254\312\224\375\017"
+	.text
+	.section	.gnu.lto_.symtab.60b961f0f3b9b986,"e",@progbits
+	.string	"pidAudioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"pidAudioStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"pidAudioStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"pidAudioGetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pidAudioSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"pidAudioUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"audioPlayTone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"audioSetupIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"audioGenerateWhiteNoise"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"audioSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.60b961f0f3b9b986,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1154 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\016"
+	.string	"\025"
+	.text
+	.section	.gnu.lto_.icf.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\310\001\305\013"
+	.string	"\222\317980\217\323\0304\224\222kUO!}\234\245\325\317\247\333\310)\020\341,\346\203\316\240I\213\036\222\006\022\006\006\271\b\013\n\031\360$*\360\331Fzs\255\021Yim\347&\001\026\245T\022\310\213\322*\264\261\"\213\007D\322\\\020qZ}*\017\036\"\017\0232\235Xd\344\326\024Dh\352*\300\234\265\213'\245\004r\363\316\313<\247\\\307\355-\007\252DI\006F\255\032*\325\200\262q-$\325\006\335\327\333\274\232"
+	.string	"\3319\201\210`\276\277\357\355\314 \344#\324\346\233\267`\370A]2M\001D\"\332}\275l\317t\327\273\227\273\312\367M\340\324J\347"
+	.ascii	"\233\323\247\025&\023#W\034s\\;~y\236\235a\f*\n\004\211-\347"
+	.ascii	"s\354\035[\256ma8\032]_r\316\035\013\016`\214[_X\302\207C\303"
+	.ascii	"\332X\203\001G\250\301\261\300H\211)TP\310\260\033`\202SE\262"
+	.ascii	"\003\021p=r\256\306\222a\rs\370\006\b\3770\205\322\036\\D\251"
+	.ascii	"\021'z\270\355w{`\205T\300\201\2442\214\316\352\302\365\201\035"
+	.ascii	"\212$\t\267\326\333\277,b\027l}\031\240(b\002\037L#-\327@\315"
+	.ascii	"\206#\273\242\376\274\037\336b4\305\030&a\277t\013I\317B2T\230"
+	.ascii	"#jt\250\250\177)-\275\343\276\315\353c}3_=,U\345\204\360\314"
+	.ascii	"\222\376\005\310\365\334\312\210;\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\233\001e\007"
+	.string	"\362\311\032\035\2007I\007s(,30\027\222\t\221Z\340@\374\326\236\276m\262v\357\326\332\3362\311|\2003\213#K\n\305\232\270+\035\346\\\006W\202\266\0071\361pf\331Fxx2'\3264\303\304B\370y\0256KZ\245\357N\362\"\215#k\371\217:\327\201\351@\277.0\242Z\210T\240w\372\260\263\221\r\350}\276Ar*lB9 p\202\231I\263\003\005\002\352D\314\305\313\241c&X@\027\215\3200\211\b\226\\\204\315{\2260\3300\211\300\206}!/\\\002\2723g\323\202\266\t\200\20717\256^1\214\242\005\026f\001\252F\b\013\006\240\371\302\320D\001\230\2409$\370g\316\200\324\303\205\330\230A"
+	.ascii	"\f\231\006\342\001\f3P!\250c\"\025tc5\353al\017\353\262!\271"
+	.ascii	"A\b3\032X\205\006\357\n\366\024e\b"
+	.text
+	.section	.gnu.lto_.inline.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`)\006\365\031"
+	.string	"&dyH\340\322&\215\001\324\272?\363\312\334\210Z\312\215m\220\227\224p\251KP\355\364m.\210\271n\321\371\350\354E\334\273\2103\260C\257\0048\355\025b,v \316\374P\231a\004\013\337\327\264\354Z\307\336l\310\210%do)S`"
+	.string	"`"
+	.string	"j"
+	.ascii	"+\314\322\230s\262~X\030\377~%\277?\232\270\203\323D\302\300"
+	.ascii	"\340\262\305\3159\273\027|[T\266s\316\351\275\2039g\315w$\253"
+	.ascii	"\177T\"%Y\332/\360Hvv\\i\342\317\f\037>(\235\246vX\250\257\252"
+	.ascii	"\270\357\313\272`\262\035}\017\023k6\0239o_g\342\013&\333\n\325"
+	.ascii	"\267>\231\004\337\353\365~\256\367s\275\037K\344\t2B\322A\020"
+	.ascii	"\365+.W\237i\221\232,\355.\351\366@Gk\324\252x<n8\347L\221\331"
+	.ascii	" \0306:\005tv\362S\373\311\222\023.\256\n<\223\235\275\353K\224"
+	.ascii	"\340\241)\367-\245,\312w\306\325\345t\224\307b|%\370/\3733\347"
+	.ascii	"\f\221\177q\002\253k.\233\"\247C\017V\314F\270\321\023\244d\326"
+	.ascii	"\260\020\264\361~&\002\335\334.\254\320l\210\245!\245\003"
+	.string	"\213|\177k\027y\245\362\027\351^\266\354N\215\t1v\320\202\216\355\346\3641\213\342C\021\007\025\251#4\247\226AHEgjX\250\253\302\302a\241T\3272\211\213\277\257\257\r<\271\264\225\253L\304I\372\001\224\002\206\270\200\007\277+9\005\245\245\032\221\202`\2609 A=\347\036Q\325\002dl\021x(K\323\025q\302\307\210u\200Vlw\026s\316\225\002X\202\237K\266D!\f*rt\257\334\371\312\225\225Q\341f\244\353d\331\243\032\016\233\215m\213\035H\032\344\257W\rj\300\3527=\221\270\250\232\300;\331\331'\033G<6\214\f\376)B\030*\301\203\372\200\235\250\201\265qddFd\224&\205tP\0021F\310\322\003\022\340\244)\206rgj&\220\221$E\325\354o\247(\250\3575l\033\034b\243\332\035\246\3259L\236\3527V\341\036u\217G\232[\334d\351\221L\203*8>Ov"
+	.string	"\2270\f\255\301\277\337b\341\265\323\263[$[\017\202\362\357v\344w\254\3470\311Z\t\374\301\"\ff\004u\255\314\305\016\354A\bd[\362|\020N\361\322\310\0334\311\303j\361\221\334\231\301\005A\265{5Q\f\326\334\300LN\367\341\203\266U\334k+\277\334\233\344\005\266 \262\033I\"\247\350\036p\004\374\b\205\207L\305\331\277\f\006\213\032l\272v\217\241m\273\333\237P\325}\313|\236\332"
+	.string	"\223\231\b\024\252c\327Et\215\240\312\317\223v\323@\022?\357\353Y1:\374\353\201\363a\320Bb\312fP\2076\250\311\246\302?\003\322\201\314\216\370\272#\022"
+	.ascii	"O\326\274L/\355\031\326\376)\006\312_\025\357D\\\211\033Af*\216"
+	.ascii	"\347\035\262#\002`5\027\tL\007\t\036u\224\361\272\f.\230R\371"
+	.ascii	"V1H\227\334\246Pd\230\031E?\2029\223\317UZ\236\217\2454\037U"
+	.ascii	"g\237\336\335=,-\333W@\001%*\317\260[\003\345\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\253\007\315\024"
+	.string	"\206XG5Pm\222\341\210\310\314\222j\203A@\020\fG\0258\272`\216\250\331z\323@e5\"\315\315,\227\210\017|\020\343\237k\nj\320\177\354zc\021!\273\355-\223\f1"
+	.string	";"
+	.string	"8"
+	.string	"\212\fO\257\230\304p\020\226\203@\336e\261\337\217\305\2670qx)qx\343p\2279\326s\270\332r\330\271\310\363\255T\320V\320\033\347\322\317b\215\204\031\354\005\213\221\242\250\t\260\276.v\f\232\236\252\252D\210\270\340\212\355\037\377\212\002\300\026E\252\26268\\5\324\302#<Di\300\003Lj\333\363<\023+\301\334\303w\250@^\003\030\026\327+xd\322\255\302\006\203M_\321k\261@ \002\246\215\031\331\001\177\260$S"
+	.ascii	"\3648|:\301#h2\345\321C\341ik\225\314\223\301\377\303G\357\250"
+	.ascii	"\252\241\260\001\233Til`\020/(\3005\376D\240\304\223\230s\254"
+	.ascii	"Glq\025\371.\036\0367\303b\347(E!\305s\200\202\331\354HQ\022"
+	.ascii	"bNH\351R`:\036\246\343\271\025\0267za\361\271\001\200\250\250"
+	.ascii	"Q\275\203f"
+	.string	"d&I\n\255\001P\002!\204\254\254\016\022@\303\034\005\3224\247\0304\320L $\263()\025\346\037@m\210\206\275]\323e\357\260\202\341@zf\344:\346\310\033%\250\265\336[\2601\356\360\300\344\316k\223\264\265 h$u\215&8s\336\245\256\223\225\314\2218K&R`c\025\035\277\347<\205\024\276\030O\007\375y\227\277\322\322\\\244\2317\241\217^\255\261\334\214\344\327`\313\276\023\261\330\232\334\314Dz\354\004\256/\374\364z`\343\312@vC\312k\307=\224\264R\276\220\221O\304\264\330>\317\277\003\025\\\220\021hA\3022P\013\274\335\341?!e\256sJG\354\264k\326\372\023\0130YT\230\001a\200@\246A\036\024\2034\223\223\223\235\360\004\305\221\216\367\024b\331\214\364a:I\356\215\265pdD\377\3062\226\371+\025\177\317,\344\366\203\234\201(a\b\032\002\026\320#B\323\026-\255\022"
+	.ascii	"\221\234be\347L\2156D\204\t\f}\020\366]\"\222\035\204,\361\363"
+	.ascii	"\257M0#v\362\301\321l\"C\250\377\"\256\247[\203\\\234r\206\205"
+	.ascii	"l\244%\020J\177a\220e\325\376:\267<P\013W\023\242F\211\260\271"
+	.ascii	"+\230'b\210\234\311RSR(\243\247\341]\",\212\351\033I)\375\314"
+	.ascii	"\201\\\360\223z0\302\3214\2416q\346\347T*D\325\0242"
+	.text
+	.section	.gnu.lto_.pureconst.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\271\004\001\231\004\002\232\004\003\232\004\004\231\004\005"
+	.ascii	"\231\004\t\232\004\n\231\004\013\231\004\r\230\004\016\232\004"
+	.ascii	"\017\232\004\020\231\004\021\230\004\022\230\004\023\230\004"
+	.ascii	"\024\230\004\025\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`'\001-\b"
+	.string	"\242\213\"(\220'I\007\377\377\277z}w\273\2353S\302^b;\376\377f\311\003:X4\025-Z4\364\366\377\333\326\220F\244L\001/j\221LT\342E2Q\347^\03686\270qA\031#\244,H\315\316E\330P\316\360\004\345\2433\325pa\356\341n\241&`"
+	.string	"\205\300\235:\227\232\203Pb%\374\214t\252NHMo*\0204\3170[\363\236\312\355\354\236\344\217\232Yj\177\207\023\321^v\275\236s\204r\205\362w\360\306\003\337E5 `\2021\205\325\003\2264\246\225{\202#\230\t9\b\034\016A\346fB\260X\"\317\205\027\311\304\301vq\270\200\252\224y\020\244\001\361\200\224\302\275 \323\222\003f"
+	.string	"g7\305*\222%\240hF\250"
+	.string	"\005\346\303\303m\374"
+	.ascii	"`\304\327*$\363\210\026\246rd\227\335i5XIl\013`g\361F\326\002"
+	.ascii	"\343\310=\027\230\207(\013\265\302\b`\017\222\017\2746~m\033"
+	.ascii	"\\\021"
+	.text
+	.section	.gnu.lto_.lto.ae72af1e25141c6b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_expectedResponsesLength.17.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375 \203\275\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\004\005\001?\202\210\200\020\177}\274\001{\273\001\005\001\006\025\002\273\001{\277\277\035\001\005"
+	.string	"\304\001{\303 y3\305\0014\302\001\301\001\300\001\276\001\275\001"
+	.string	"\n"
+	.string	"/\202@\335\250\356\200|7w"
+	.ascii	"\203@\271{fHi\020\003p"
+	.text
+	.section	.gnu.lto_runcamDeviceFlushRxBuffer.24.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"E\f"
+	.string	"\346\326SB\020q\233\0168<N\317"
+	.string	"\272C\224\261\200\0349Hi'\231\027\253\264\241\253\371\021"
+	.string	"Pt\006\361\030\350u\354\343\317\210\323\345R\324I"
+	.string	"\200\212\b\212Q\204\270\243\002\303*CA>\277\033\331[\312\224\002@"
+	.string	"?"
+	.string	"A"
+	.string	"&7v\327R\020\206\311=BM\316\317\016,:\357\363\b)P\210\210"
+	.string	"\036\bfJ*'/yj\360>\022\222\020\271\276\344\220\204\003\251\363D\236T\203\335uv\336\206{\272m\215m\214\375\007\001\376\350\2374\255\231\316L\337B\325xq e7d%\307\242\304\223\021\027\333O\373&~\202\373\250\343\002vC)-v?\005NP=\372;\201\351\261\372\200\351\321\234=\343\237h\251\01722\004j\241A*\001ww\241\216\330\256\362jW\340\344;#"
+	.string	"\321\217\355\013O\341\001"
+	.string	"cw\027\370(6\f\006D!\036\375\216\351\361\252\036\t\307\310#Wt\205\013\220\247:b\177\237\314\210J*\326\220\003\330\225u0\315\344\013\203]Y\007\323\\\233\245e\326\204\f\302\306\2726\216\205)`\215\002\266Y\0264m\263.\337^Cv`\003\305C?b\204IUIT\304"
+	.string	"\311\222/\231jK\330\344;U\006\036L<U\225\001\025"
+	.ascii	"2\003\353<\222c\353\365uX\\8kv\030A\334\021E \221\313\235\250"
+	.ascii	"\022o\302\302<\n\232P\213\224K\260\315jJp/n\251R\265\f\324\313"
+	.ascii	"&a>\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendRequestAndWaitingResp.26.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\350\007}0"
+	.ascii	"\312U\020\023DPdR\007\301\274\321[\022\203E[\212\272\262PQh\f"
+	.ascii	"\320U\232\303\356\264K\030~\332dI\254\"U\214%\2158\271@\004)"
+	.ascii	"\371p\025W[[\355RI'U\340K\313\210\216\027\224\215X\226\354\275"
+	.ascii	"\245L)\037\001\r\001 \001\300\375\373G&"
+	.string	"\207Y\322Es\274/pj\3443g\253\246\355\275#\270\213\026\314\233\351\017\023\305\016\355\251\351\023\024\300o\025\260O\344z\331cb\311v\224\301\220\261\373\204\n\372\255\313\037\332\3155P\210\217\335\177\354\251\372\253>\n\f\355\251\262g\332\336\326\b\256\004\374\326\255/\300\375\026\370D\356\267\256\335\345\274\325k\377\246\\\254\276\354\331{\023\263\023g\237\265\276\273X\277P\2200\370\003\374\271-\233\261\366\377q\300Yx\312\256gP\251\027\342\372 \026\302\0211q_\207\245\204%\272fa\362m\302:,.V\301\033\305A\326\201\024\216\310\327a%a\005\3201\211\363o\\\370gAW\326\326\003Y\004k\324`\371:\254-\326(\272d\314\277\277\240\n\326\021\374c\205vV\220\f\241V,\205-4\273\247{\374\2046\261\013\246\365m\360zuB\215<\313j\240ny2\204R\261\231\314\314-\b\235\302\371\351^"
+	.string	"\265y=\203j=\376q\330{;vB\263\336\207\336\375\205\356^\345\376\033\021\314w\372\337\275\033\021\376_\337:\t\023\370\235&\334\023\377\356\b\340\265\367\266\240\3742sj1q\237\023\300\277\337\323\270\017\376\327\376U1\364r\272\263h\001\324g\256*K9\021\006\312\356/`\340wz"
+	.ascii	"7\253^\336T\226r\2676q\236\362\345aC\305s\023\367!\354KB\330"
+	.ascii	"\225\206\330\223\206\330\221\032\f\2613\030b?2z\264\377\004\357"
+	.ascii	"\345\277\350\311\376\017<\231\177\002\037\346\237\350\317\376"
+	.ascii	"\207\336\372?\374\352?\320\317\275\273\031{\033\204\235\025b"
+	.ascii	"\317B\3548c\177\b\004\276\244\321\251X\276Z\367U\037\337\236"
+	.ascii	"k\325\246\374\334\277\232\277\232\237\363\247\363`\234N\363r"
+	.ascii	"~\3745'\241\365%\035\3734\376q\036<>\234\022\273\303lv\252'm"
+	.ascii	"l\317\336\326\007T\300\343\231\177\273\361k\216\347\234\271\341"
+	.ascii	"\036d\3736\367\240#\177\315\r\030i\"\035C\272\007\277\315\377"
+	.ascii	"z\320?\355\315\350WK\376\256\302RAU\315\333\033\353\301\267\336"
+	.ascii	"\003\370mL\364\024\277\323\025\024e6\377\373GYx\315\253Y\037"
+	.ascii	"'\263\353\302\003\346\251\277\334\003\363\300\204\270\376K\367"
+	.ascii	"\351\276\035\343\263*\3032\310H\371\351\276\303=\220\013h]\313"
+	.ascii	"\336\374\322u\327N\376]\376d\305\331r\007\350\311\277>~\314\253"
+	.ascii	"^\024\312\2779\310\256a\321\034\205es\326!\3128\347\334\342)"
+	.ascii	"aw\r\246\255\340w\342\214\364L2\327\304\362o\224]X\024)\273k"
+	.ascii	"-\357/e\265)\273\236\325a\342\276_\236z\0064m\203\334\356a\177"
+	.ascii	"\342\256\2627Sx\217\335{o\367_\3115\312\rX"
+	.string	"17\267*i\263\371#\211\231\226\315F\331\315O\017{<K\242\227\362\357hj\204;;\fr\214j\330\200\262\26396O\375(\017\263\262\314\315\024\336\363\227s-\366t\226Iw\232\313\347i*\322\0059?Gw\351\300\304\344~{\224\237\356\003\360\211#\245V\231\270/o\241\331\201e\037\346\317\257\365%g\325g(\273\177\370\327\331\352\264\t\033f\367\020\377.\177Yl\364\242\376oL \270\333;\307\347\001\305d|rJ\342x2*\203MNQ \214O\311\032N\"\224\306\247(\340\223\021y\\\321C\teL\301\243\210\f\202\212J\"\215G\250\237\223\261\204\260\bU\364\200,*\2138~<\210\240\341TD\"\223M?\2567I06\035u\030i4)\211\311#\321\351XD\022\233\224OD\t\006<\211\303\250$B%\223Jb\320\312\374\334\304\343\250\350\3451s\323\223\354\336]\033^\355\377}"
+	.string	"ydB\034p\233\201\262\177\233\226\322\315_\226*\022S\003\027$\303]\3123\312\334\264\271\246\302Dd\f\261\241\255\336\207\373\355R\376\266\307^W|Rj\265(\267y\202\2242VK\321=8a\236z\321U\002\326e\300\277\206\257t\021\003Z|\3221!o\372\251\203\340w*\345V-\f\317\226`\236:f~R~.o\256\257\360s\tt\374\003;5T\017\321E\360;u\021\367\333\244\374o\217\273"
+	.ascii	"\271\"\245V\023\030\371\327\361\272\346\204E\177\212\266\376"
+	.ascii	"]\016\370\351\302\323\233"
+	.string	"\200\331| \377\032\246\322J\200\232\353_\275\004\301\235\016\200\236\250Q$\245\0343N\231\021\021\tf$i:p\002\021*2\363\021\2009UU\222\024\2461\312\002\325\251\277\231\362\351\3559\274\325\300J\370L\020\016\365\020\305\245\267\275\001\201l\037\334`p\270P\325]h\036\030\t\331i5\005\306NaE\217qQ\327\322\254\227k\275\026R\224C|\215\243\341i\005\311V/X\201#\341\013wJ\365e\006\314y+\022\345\274\224\246\2345\035\300\334\307\364\214\261?\f\317@\251\300D\256)j\211\273\234\327\315G\013{\314zlw7\250\340\225-0=\210\031=\007\274\212\324\340\354\255/\220&\273\252\326m\203\260\035m\246q\377\237\260\033\202jppt\374}GI\204\240I\004\205\252\254\232C\250\300\351\301\3313\372\261\005d\275\255l&\356\3045\224\tFj\320j\263\277\216\306\235\212\307\375AO\266\243\n"
+	.ascii	"\223\274\357G\320A\034\303\217\030\0333(\002\f\237\366\020\345"
+	.ascii	"\210\347\004f\006L\201\006\300\215\273Y\235\256/\352I\220\006"
+	.ascii	"\244\036\370\373\237\001\376\226\273\023\2500\325.P1\277\220"
+	.ascii	"+\240\377K\027\205;\202\031\200\274\324\241(v\3140\364\250.F"
+	.ascii	"\330\206\213\364k\207BN\223\367\250"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.27.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\035\n"
+	.string	"\346\022F=0\345(\035\300s\330s3\237\226\262\335$fa\272\216f34\224\364\251\242\255\346Lo\237o\373\330\241njC\207\245\273\205\224\226\202\302\031\0300\363\303R\262\013\222\265\211%\204l\231R4"
+	.string	"6"
+	.string	"1"
+	.string	"2\032*\264\335\375&\311\307oSG\177\2004}\363V\237\233\002\313eE@\2426\316L$\346\261\353\006\231R\325xv\327\252\";n\356\266\035l/\330\367\002\352w\017"
+	.string	"h\001:\003v9j\005\366\205k9\331\330\276\332w\3755\036V:(\330\224\354ce\267dp\202w\316\3459\3359\357\006\3359\217\366\314\313\222\325\264\002\237\0212\230\224\022\260}\361\224Q\203\217B\312\360v\367&\347\374Rw\356\363\261+\210\207\213\365\202\235\264f\227&\235-\373\333\356\256\347\210}\330?5$\0218\rv> \b\343#\001\212_\b\372(@\020\023\037(\206\276\016\202\303\212\217\370\211\302P\3746\345\336s\232\250\315\3239m\213\220^\345m\232\224E\300,dz\324\005\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\t\325*\b|\"\3049\304zKx\002"
+	.ascii	"S.\3016\253)\342.\267\264G\003S{"
+	.text
+	.section	.gnu.lto_runcamSplitSendCommand.29.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`U\006u'"
+	.string	":Fp\017I\200\332Q:Af\227|\035!\006\020K\250\t"
+	.string	"\246\353\203\007\275\3703q\260\250 \250\321T\275\200DV\2156Q\242\353\370\024 \270m\221s\224\3178\322\200E\206\323=\220<5\370\366\313@I\025D\020!\204\020\"w\222\001\337"
+	.string	"\331"
+	.string	"\351"
+	.string	"\307{\203\017n\362Qz\323\310l\313\\\341\002\357\304\335\003\334\236\231\034\266[\346G\271\024\336\263f\\\300\275Um\270\356%F`\243\364&\023\017t\336L\357s\336d\3461\2779\221\310E\257\212\374\214t\356\275\266\276J\323t\207\313\227\304\363\332\274\003\340Yk;j\212\236f\331\226\307o:"
+	.ascii	"\343yJ\264\206\016$'\013J\225Gh\307\256\203\325\260\253O\b\344"
+	.ascii	"\265\022}\n\2469Yp\252<B\302\211\272\230\317\356\f\021F]M\251"
+	.ascii	"\204?\216\226\r\312\bis\262\240\217rh*\f\217\025\352gO\261{\270"
+	.ascii	"zBR\t\243n\036\354\036\312r \251\204@^\026Q\t\203\274K\013Ml"
+	.ascii	"h\251A\321(W+s\224\334x\013\204\352Y\213r\270\367\262\305\001"
+	.ascii	"%<\367\234\371\t\230\231\004\263\031\026\275\257\263,'\233d&"
+	.ascii	"\366l[1?\275\342e\204\273\212yA\321\275\316D\n\036vN\200\340"
+	.ascii	"\200j\331\200jy\250-\013\265\345\002\252e\002A@?\251e\237\001"
+	.ascii	"\347:\363\234\370\253\317\372\315\177\235-j\371\fz\244\312h\b"
+	.ascii	"\273WG2\355\2221\273\222\374\353\017\373\271~\257\177\n\177\313"
+	.ascii	"\303\370b\274j\341\335\312\277\370`\\e\013\250;\025~\227{i%c"
+	.ascii	"\206\367\336\325\253k\227^,t\253m\327n\002\n\346'\"\275\311\305"
+	.ascii	"e\351\327\027T\177WEN\335\271,\235AuG\331\215\343M\016\221\336"
+	.ascii	"\n_\313\257\034\213\356Y\214\322\246`\212\245\354\351\b\"\275"
+	.ascii	"IT\352\370Ux\325}kG\324\024\340\366\312\200X\367\022;\2447\177"
+	.ascii	"#\257\327z\221\367)1\322\213\365\341*IQ\3039\276\251\236\332"
+	.ascii	"V7:\203\032Ag\360\362\245\365l\016-&\307\324@\037h\353\346W'"
+	.ascii	"\351\034j\003\375_\017\241\036\352\362\353W\007\302\013\264P"
+	.ascii	"\337\227\326\263I\016\352\002-\303\311\326\257\216\323\223,E"
+	.ascii	"2\264\255\370I'\201>U1LP\023\350\213\275\354\032&\177u\234z\353"
+	.ascii	"\351\254\353\374i\237\006\352\273\371\365\350]M\212\035\377\b"
+	.ascii	"\177\351\274\351\323\326\b\214\242p\236\036\320\007{)6\204\343"
+	.ascii	"[\322;B\372\260\314\2662\"a\214\216\231\332g\354\371\2538\346"
+	.ascii	"D\352\021\350\230}}w23\204\033w?D\356\275GfQ\314\320,\206\035"
+	.ascii	"\341\300+\354,\350\204\366\342\264)c\224\367Rm\370\224\367\016"
+	.ascii	"0'G\255S\031\223\325\374\342|\237(\256\241a\321\230\031\351`"
+	.ascii	"^\244\367^\f\374/L+\322#3\316\233\357\033\337 \314\266\005\216"
+	.ascii	"E\347\230\\4\322o\271[\347p)R\350N\224`\312\231\320\255L-pI:"
+	.ascii	"\0259\023\351\3117\t\270\033\022\f\034\212[\316\246\204dk\201"
+	.ascii	"d\"\311v\313-\331$\b\261\222\013\\\316\306\244"
+	.string	"\244\224\263\255D\247w\225\355\336\001\254?m\033\370\243\226Mr\2175!\020y3\337p\3668\330r\001B\306\327M\3744\227S\242\031\232\331.\2369\363\301S\326\202\232\t\231U\376\370\2374\r\271\245VT\002\017v\025\0139V\033\320\\\226\247r\243\nt\307\230!\016\236\334\223\337\235D]\2245,\363Mm0C\223Z\333\212_\353*V\277\250\n\324(\3107f\n\344R]\220\232!\307L\240\016j \b)(E64,Zy\357\275;m\305KCR\004\375%q\236\320\003\275\240\201\314=\311d2y\2433A+\350\007\200\204\250A<\205\020S\004\231\231\tdF\333\244\003p\002\231\271\332\r\020`H5I\007o\360b\304\363\373\366\35259\021=\264\223q\036\205\21467\243\001n-\"\312\323\226\330@\0026\301\276Q\266WZ}\0362j\360Hk\026\307\341\241P\246\332\266\307c\323\375\037"
+	.string	"j\314\312\305\007\nb\255\312J4O}\352\303@o\235i\260[A\317\244\360;\360\223\035\026\003\260C\216\360\3701\257\037\0038,;\226\241P\270\3613\317%\303:\367\343j\\\332\360\030\376+\r\306\240\314\n\322=\325\232{cYd\230\337\001\254\333\300\005E\006@\372"
+	.string	"\352u\305\376{RE+\355\336$U\203\375\362\202%@\231C\343\274\356_2\200\271=A\262\220\276\327^\032\356\3136.\b\224\tm\305\354\005[]\003\313_\177\203G\351\023\204\001Pp%\271|\315F\375\020\221\004Eo\301&\310\202\313\037\350<\343\325\244\317\301\341 "
+	.ascii	"\023mb+\335J]U"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.30.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\331\002\275\025"
+	.string	"\366g\215J\240\024R:\203\320[9\232(\310\270A\024J\3075ZT\345\352o\001./\202\255b /\005\177\321\376P\325\352.\253\217\352G\037\030\277\334\200\367h4x|\230O\035\230u(;\361{\2746f\003\2657k\244\221M\344N)u"
+	.string	"o"
+	.string	"}"
+	.ascii	"\020\310S/h\240{\231#+Qk\351E\t\252Z\313\003\247F@~\332/\272"
+	.ascii	"\221\356A\034\001\261\252\223\264\242\251\3262\201\r\220\247"
+	.ascii	".\2172\236\222\0070\236Zg\013y\351\242\266\202\244zB\253Z\253"
+	.ascii	"l\203\256;\025w\352\374\234\323\027\220\347\"\311\363\025\031"
+	.ascii	"\214\260\3629\001\352\210%W\275\036\027~\376\200\2749[*\265V"
+	.ascii	"O\037\020\305=\336v\213m\027{\025\004\364{\341\247\317\317\324"
+	.ascii	"\217Qp7\207v\311\233\013d_\254\265Vo\013\373\345\035;\322\r\273"
+	.ascii	"\322m\362\340_\362\232~\271\246]\256i\3225\335\"\247Gr\232\266"
+	.ascii	"\246\305qz\351\364\024\247\217r`i5$\002\215ZM\f\261\352\016\352"
+	.ascii	"4\364\362G\372\225\276\366\177\364\244\013Mb[\311\346u\347\204"
+	.ascii	"\353\027t\204\212\005)G 'Vy@H\020\005\273\022\343\327S\343&\347"
+	.ascii	"\013M\330>`Z\372\365\210k\273\034\312B\200)_\370\023\006'\230"
+	.ascii	"\f&S6\343\251\030\345\253\332\315\241w\305}/\353M7\271\323\214"
+	.ascii	"\247\273\243\360\327\243\3413h\346\272\210\fax\303e\330\024\230"
+	.ascii	"2Y\372\224edU\f\035\361\020c\263d\355\227\331\274\317\342\346"
+	.ascii	"\370GS\220\305Zf\374rH\n\2423\257l\323\316$\343\300_\212\251"
+	.ascii	"\221\265\326\013\235\3728\343\003\264Y\255\206\0063\206\260\265"
+	.ascii	"\234\314\340j\022:\310\324Vh7\032\334\013-\006&\0027[\317Rh\263"
+	.ascii	"Z\r\rfv\223\331j\262\017\265\027\017\262\331mF\2262\3006\020"
+	.ascii	"\264\233\fg\263\335d$\345\356*\273\345\235.\320YF{\302u\260P"
+	.ascii	"(\241U\221\327\332\024\216\243\302\215\315\341\253r\355\213\334"
+	.ascii	"\326\272\366\275\024\260%\307m\355\350\243\227E\336Q#\335q\277"
+	.ascii	"\203\305\233C\307\226\356\213\230l\364\262\2446\0266 `\002\031"
+	.ascii	"B\273\r\3420v\236P`\321\rc\310\260\277\022\264\375\326h]\234"
+	.ascii	"\230\013T\210\2161a&C\263\2010V:\3520@\02277\f\217\340\356\276"
+	.ascii	"\025o4\241\332h\027\n'j\375\013\241\325\247\251\020ps\353\331"
+	.ascii	"\033\007r\310\027\311\207&\273\361\310,w\003\267BT\252\017>c"
+	.ascii	"\242\207\330z\325\376\352\306pz\2478\231\317D\034\205\225\004"
+	.ascii	"\266\221\227\233\236\021\271\246k\264G\003\313{"
+	.text
+	.section	.gnu.lto_runcamDeviceGetDeviceInfo.31.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"u\n"
+	.string	"&\325J> O\234\016\243\026\361\301\225YC\300@\025\362\233e#\b\236\"kt\036X>\314BQ\326\020\207\346\037\320\366\017\212\032{\200\004"
+	.string	"\346B#x^5\326\270\342\2004\377\021\215\270\255\224)\0057"
+	.string	"8"
+	.string	";"
+	.string	"\273\337"
+	.string	"\013\250\016\375\275\203:\254\316A\035z\263W\374\303\260\220\f\024\"\224L\273\033\365\302\267\347\346\377\3033:\317\346\t1\260\273\316\316#\341\326\333\016`\233b\277@*@\242\021\227'\373\343\244Z\260\377\330\335\265z\366G?|\244U\323\231\351C\376\t\231\\\034(\261\3339\301X\024\360\004\207\210\355\247}\017\027m\037=\270d\327ca\"\267\250\311\241\332W\202|g\215\316\204\255\240\033\333\330E((\251nt"
+	.string	"m\270\246&)\305\210\030\276\234\224U\273\020\b\370 \036\242\201\257\341\320\230L\276;\3643\324\341\025\222\360\002\227\205i.\013e\213rY\230\346\262XZ\314\260\270"
+	.string	"\253\\\242\245a\"\005\2003\006\227\026\035d\231\026#\037\367\307\252g\370\t\275h\301)\307\222\374\207\240R\355r\357\342SU'w\f"
+	.string	"2\241\201h`\306\005"
+	.ascii	"\005\313*a\020D\016Uw\017\230u\t\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_runcamDeviceInit.32.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\007\002U\022"
+	.string	"\266\242zG\260\230M:p\345\362\005-\032\264\037V \27071\017\314\313&r\355h[5\303\270 \003\342M$\267\037Q\236\314\004\225\216\313\3125kSX\017\330&\250\261\274R\237\203q\003<h\001\361\027fm\355&{\313\224\002b"
+	.string	"`"
+	.string	"j"
+	.string	"\035\353j\177\351\266\357L@\027\260K+bd7\224\361\003\3269\207'0\317\261>`\236\363gSy\210\264\207\252A$$\313\356v\361\306\277s2\352\347\337\351"
+	.string	"@Y\3209\243\313\027YL\243T\360\244\211\217"
+	.ascii	"2\027\222\301\221\r\"w\272\276\220\r\251\256(\354\256\025\224"
+	.ascii	"\025\335\363\266A\330\226`\253\211\2767m\235\007\361X\273K\343"
+	.ascii	"?\361\244\200\241\302q\316\007\232\347dj\264\331\222\025!\275"
+	.ascii	"\331\341\220\306\232\375x\273\335n\2164\373\341\335:\323\277"
+	.ascii	"\232j\311\251\243TkT?\306\301\224\331Q\022R\214\022n\214\033"
+	.ascii	"\227\235\342\220\344x\370\333\277\223_l\207?rg\204[\004\213\222"
+	.ascii	"Z\312\262\033B8\347W\202\301\031l\364\240\315<\027c\213\332\217"
+	.ascii	"\231\215I\243\255\341G|b\"\024\260\312\200\372\034f|\207\271"
+	.ascii	"\212\355=\314\356\376\207\371!\177\264C\210\320\203\032\345\322"
+	.ascii	"\360\210G\335,@\202:\341\212\3608\241\326cfcR\231\023\030R\321"
+	.ascii	"?\263\025\017\324x<I\211\351\026\303\350w\2373\355\027\n=\330"
+	.ascii	"\212\252d\244CK\225X\fr9\257\022;^M\017\314\343iM\273fp\\/\026"
+	.ascii	"8$\\\260\316{u;\257\033\235\316\005S\321\315 \260\307\203\003"
+	.ascii	"\353z<\017\326\275\204B\227\033i\033\260L\t\305!\271\273\313"
+	.ascii	"5\320\225\322\007D\017z\205\214}\321\216\240$\35135&\2505\311"
+	.ascii	"h\177\266K}M\005\250\\\341Lj\316\311+`U\2142\236\250\213-|\311"
+	.ascii	"\005\326n\214\306O\022% P\002!c\362\016\357\314\033\205n$\260"
+	.ascii	"\360+\264\242\"\031\370\201?<\200V\320\206@\223t\237\236\260"
+	.ascii	"\305!\204\3703\323\001Yh\237\006o\311\300\362\214\315\236)\177"
+	.ascii	"g<2\301<\310Y\302\245Z\211\353\325\007TF\241\t?\306\303\335\320"
+	.ascii	"\251\345\231+C\313\205\205\274T\270\252C\355\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulateCameraButton.33.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`!\002u\023"
+	.string	"Ve\203I\300RN:\302\211)\204\020\314\246\344\232.\247\223\013\264}\021\"\214\n\312\223\276\236\\ab2\252R\002\344C\373\353\337\340\347;\031\350c\352\245\332\300 T\005I\026\352\240\002\202\341\022T\031\224Y\203\331J\310&{\313\224\002q"
+	.string	"e"
+	.string	"u"
+	.string	"\036OB\357\201\037\241\367l\033A\002\032\307>\016\351\034\204\021\355\004U\255c(\205\036;\370Qo\312\215\3715\007/\353\371\267\262\361\234N\023\031N\264\327\320\3203\013\340|z\340\254\307\3639OzT\320\020\261\331\314\021\034%\200\256\243\255\234\007n3vDl7\223\344\t(\307\221\2769\266\331\356\247Rk\365\326l\033n\220\333\306`{\201\275\016\002\3668[\231\263/w\273\335\316\022g\203\353\325\217~\320ko\256\347\267\226\337z\351\372!\367P\251\246\032\360\250UgWU\235\274\027$l\337W\272.\346I\226;6\210j\255\254\030\233u\3576\215\315\262=\367\243\314\003\324\031T\206\246Z\233P\034\356\332/\272\021\315\217f.\240V\234\216\246ZG\024\033"
+	.ascii	"\357\005_\031\202\273a\342\203lw\317q \222Q\026\352\023$\264"
+	.ascii	".v<\375x\003\366\344O:R\204\222\240\237[Q\355\344\240\364u\022"
+	.ascii	"V\3665\177\262\306T\035\246\222\246\314Y\244\253\353\334\372"
+	.ascii	"\n\021\364J\016\351|D\355\346$\317B/'(I\331\254\017\333\256\247"
+	.ascii	"`!\020e\277\276T\001\254\265*@\341\322\002 \252\326\372\020\367"
+	.ascii	"\374\031z\357RD\256\352ft$\333].\342\013f\005\346z\021A\250["
+	.ascii	")\256\326\353\202\213B\013\026\212\257\320\345\265\322\022\266"
+	.ascii	"`\026\302\224\022\213/.X\b#\212\260\2205\312>\253\304\231J1-"
+	.ascii	"1}\177\214\036\351\f\244X,1y~\214z2\307\266'\255\"\223\263Yk"
+	.ascii	"\255\240\314-\214\237\030P\037\311N\tJ\373\001\004\223\033Yc"
+	.ascii	")\247|\013\332\017\331e\350J)\217s\233\355\316\037\003' P\242"
+	.ascii	"A\210\365\357\363:\013}$\361d\035\307\333\212\274 \204\206Z\020"
+	.ascii	"\343\013\265K\2436N\351\254V\350\210\272Y,\221{\214\216!\361"
+	.ascii	"!\202\342.v\2065c\341\\^\006`\336\230\331\274\bc\252\322>\342"
+	.ascii	"\231\023\004\225\025\326\261\003\017h\033q\036'\243s\273\001"
+	.ascii	"\303\331/;\031\340="
+	.text
+	.section	.gnu.lto_runcamDeviceOpen5KeyOSDCableConnection.34.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"U\013"
+	.string	"v\225OD\020\3118\035\250G\343\373?\003"
+	.string	"G\200;h\376"
+	.string	"\330)s5\203\031\373\016o+\234"
+	.string	"\345\256\330\252B\210\032\261\321\036\235\007\271\215\022UUG\210Y\013I\266\312\034z\244\020\311\256ry"
+	.string	"=5\262wJ\0018"
+	.string	"?"
+	.string	":"
+	.string	"\253\3351\303\025\3333\217\207\320\236m\177\320\2369\264)|$\260w\020\201\205Akw+\035\360\3603\364_^#\232H\237\231\217\335\365\024M/7\275m\n\333 \3669\002W\3754\363\323\266,\210T\330my\271vB\366\300\300\311\337\376Ko\254\261\021\236\034m{ \323\240\200\004\326\356\352\342\231;\2669\242D4\354J\231\240~\332O]AxU\312\035vQ\031\002/o\023\243\365\323\345%\032\306\277\340%h\023\261\033\202F\251-:\231\027m\201\300\2650\224\344\177\244\235\374\204\200VL\352Bi\276\354\2214i"
+	.string	"\373\330\356\256)\312\376\370c\001\236\317\013u\300\356\363i8\217(\244\003\201\235\217F3\307\3518\317\244\033\341\300\372y\325\343uH*\007\202*G\302\337\247\003k\350\373\300\272\031\367\330R\224\263\323b`\225\250\212G\330."
+	.string	"\017\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceClose5KeyOSDCableConnection.35.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"=\013"
+	.string	"v\325NC \2518\035\307\223f8\276\004\0220\340\321uW\325F[Yad"
+	.string	"\025b\223\254\244\\\036\310\013\0352\315t\351`\257~\251\006\b\373\001(\2660\326\2443F\273D\375j\001c\206r\374\023\022!{\247\0247"
+	.string	">"
+	.string	":"
+	.string	"\252\3351\303\025\3333\217\207\320\236m\177\320\2369\264W\037\r\354!P`q\320\332\335JO\017?C\377\3451\"I\364y\371\330]O\221\024\340\246\267Ma\033\304>GO\375\364\362\322\266,\210T\330my\271vB\026\001\301\311\337\376Kg\254\261\021\236\fm\233\340\362\340\300\212\265\253\272x\346\216m\216(\021\r\273R\242\352\247}\324\031\204O\245\334a\327\224!/o\023\243\365\023\300K4\214\277\301K\317&b\267\004\215R\033t2/\332b\201k\005P\221\347C\332\311O\234\024\f@]\030\315\227=\212&-`\037\333\33555\331\037\177,\234\317\373l\300\256\363a8\016(\244\363\200\233\016F3\247\3518\317\244\033\341\300\372y\225\343mH*\007z\252F\302_\247\003\353\347\373\300\232\031\367\330R\223\263\322b`\215\250\212C\330.\001\017\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonPress.36.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\035\f"
+	.string	"\266\326R@\020Q\225\016p\016\307\270c\305G[y\022\037l6\t\257fe\212x\333u\004\020\035p3\2645\344\037\351\237\003\254\201\220@\022\001\030\201\346\241\006\346\035)\005|t1\200w\335,\331{\357\224\002?"
+	.string	"B"
+	.string	">"
+	.string	"\017\200\235\332\263q<,\261\177\301\203\304\302\265\273U\232\356}\312\350\371\023\020\364\331\341r\026(\205\330\001"
+	.string	"\024M\0032Z\244\257\0363\200\243\030!\230\335u\374@\0167\275m\007\266\033\330\207\020\207<\205\bW\216\b5v5\274zl\213\302@a\373\024\333Su\341\006\003\031m\005\013\274\207\237WVD\303\004k\227eq}\264\177:\312{\n\303\200\312\216V\037k7\264\370@\344\324\341\005`\247\221\273\377\342\035\003\233\322\246\320\211\377\214`\306i=H\320?F\274\\H\177\260K\t+\033\243\370\341\207\277<a\322\001\002\365!\024_v\b\212\222\204\375\271\273kY\262\257\372\351S\377\244\321\001\331\246\302\003\255\323e8\222\r\267y2\235\306\341$\230\263\213\226m\026\264\tYW\271\255n\266\214\246f]\247^\b\230\343h]\365p\\W)\341\036\023\222\2429\211T\326\277\305\345\206k\260\004\377\212\253\340\"\033\025"
+	.ascii	"o\231'3 \f_,l\026\201\352\330\033Dh\020HQ\215\313\213X\376&|"
+	.ascii	"r\r\030\207\241A!\270l\253\021}F\013PQ\304]~\252\275)\232\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonRelease.37.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\315\b"
+	.string	"&\321=80\345(\035"
+	.string	"\21691\033e\001\203?\315\331Z\036S\006\230?j\300uE\222P\177\314\201\322\232\327\230\276 L\027\206\002$d\360W}M\220\"\252\226m\237\333J\231R+"
+	.string	"/"
+	.string	"*"
+	.string	"\234\013`\177\356\354\227G\220=\212\006\206\311kw\241~\274{v\376I\336A\251N\317\215\302\356:Q*\216[o\333\300v\202m\227\177\276\267\366\025\303 \263\233\n"
+	.string	"`[\236J\210\355{lg\2348\201O\373\"\037\351\356\242 \b\330\213\222\214\224\335\370\361\001\347\317\361\003\330_\251\n\237\367\n\246\033/a\b\367M\330\347\251v\204D\036\345dY\245V\333\241';\236R=\354kvw\255,\373\361\327\273\002\331\310\264\240\225\270\020\251\2039\003i\231\bBk\3108\270\211\340H\024r\200\031W\202\240\002o$\215\203\017\333\306AO\334kVY~\255\235\201\251P\013o\002\f"
+	.ascii	"o\231'\023\372\375\002'.@p\rh\205\241A!\270\f\214\bPQ\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getWaitingResponse.38.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\213\n\2655"
+	.string	"\372Z\024\024C`\350\325\030W2z|N}"
+	.string	"\020\240TDI``\243fsH\357\231T\024\037\330\235\3124\222\306\324\252\341\370\347N\346\275\313\316/\273\333\234\227:\343\202M\365k\231\230\021o\204\322\210\224R\312\224R\n6\001\027\001.\001Mn\271\267\270\375Z!y=\304\276\346\336\227\271\324)C`\335\231\333\254\263\340h\246\024\n|\253\216\350P{_f\023/`;5\200\366\225^\342`7"
+	.string	"3\214\353(\253\353\252\013\335\3732\207\314l#\265S\266\205j\247\257\204\213\334m"
+	.string	"GFEB\242 pH\350\347k{<vUS\364\335\345N\337\214na\266\246\032@\273u\364#2(H'n\324\206\374B)4\233x\221\025\327X\013\221\342,\313\214p\2115\021\02341\017F"
+	.string	"\203[\322\300nC\206\235-\361\241!-\204\n\2058\351t\033r\b\312D'JW\322\177d\355\353f\243V\330\234-\353\214p}u\333C\225\346\310\374\3516\244\027j\244\345\004\253\233]\316;`\204\313\253Y\224)\b\0307\335\206\f\202\n\337\246\034i\265>"
+	.ascii	"\005\351\345+\252$\0045b;\"\327n]\271\212RH\266\361\321mH0\264"
+	.ascii	"\331\216\310u\323\312\323\246\032k\364\265\2741\276\205\331\362"
+	.ascii	"\321\217>\230\003\313\"\264eD[\2556-]\246=k\253\312}\255\360"
+	.ascii	"\276/;\326\026Ws\200fn+\314l\201\231W\025?\006<\202\357\253A"
+	.ascii	"T~g\242\331\254\031\360\356\0169\246g\\\362\231\250\026\370\266"
+	.ascii	"\322\254S\345v\334O>\321h\210\354\373\276\020\270\327\372\f\n"
+	.ascii	"\356\261N\371\251\350\215UT;-\360f;\226I,fT~\307\3144\372+\231"
+	.ascii	"\033\302\361]\303\217\204yuvjbZ\235\227\332\331\254\244:3X\235"
+	.ascii	"\027\254\316\n|\316\t\372\331\234\244:#X\235\0134\263\033iu\036"
+	.ascii	"P$\354-\315D=\347`\353\fT\235\207Tg\241\236\363\257\347\354\343"
+	.ascii	"9\267\252sou\346\361\234Y\325y]\235U\3269U\235\321\325\371Wg"
+	.ascii	"W\235\333\201\3232\371%\346\365o\314W\353.\320\033'}\222\265"
+	.ascii	"\263\373\331\275\245\237\271\237\334e\210csi\2556\243\2710\203"
+	.ascii	"&Df0\267b\332\311\215\306m\030\0345\232\013\017\235\204\325\340"
+	.ascii	"\016S\343\345\352.\2574K\272\376\322g\314-\337h.L\300\t\222\344"
+	.ascii	"\362}\337\366\006\267\027n;\275\321]\\\364\r\302L\372\202[V\241"
+	.ascii	"\300v\2122\343\340\016-\364C\217\316\371\340S\274&\364)\0325"
+	.ascii	"f\277'}'\205\n\302\332\203\364\276\377\275*\310*it\243\264 )"
+	.ascii	"\33778\242)cv\2454 \"{\024\246<C\327\247M\362\336\267\317\354"
+	.ascii	"\226\271"
+	.string	"W\f\034\177\212\256\345}\357\017\357\033\034\327\312\274\216qJ\357\225i\332\211\354\342\212\360qc\275P\245\361\0168\372\351\257\317>\267\232\233\305\2027\026\257?\365G\037S\354\n5\301\247P\343\013\275g\205\036\027\030\270\307Z\250\235&\370Vk\017\323\n\304\031:O\213\"\270!\034\373<3\365W\r}\207\250~sYb\326v\240X\346\r\035\307\201M\177\300\332?\372\216v5\210;4\334\177\331\0343eh\0241V+\232\n\237\210\250\372\267\221f\035\017=\207X\302\177=\246\325\371\352\320\326\324W\362R\367G5\3370\177h7^k\033\021\242\277\233\355cct\177\246\2173P\372J^\335\252|IsnW}Ae\314'}\323g17\372\312g\307q\233\340\260\372\311\354Vi8!$\300u\332O\026\321oH<\200\353\324M\322\243w\260\0026d<\275\r\031\027^\304(F\25518\024[\260"
+	.string	"!\303E1*j\306\323\217\237\234\212O,h\024U<E\r\241X\f]\260@\321b\370\024\025c\350$\200\241^\024\243\2062\240\240\242\206-\223\212M\033\t\237\321#\341\267bU\256\322|\315\326E\237\3650\312\342\324\315Q\275\221\r"
+	.ascii	"\244\017\376\377i\266\251r;\227\003\206\025\345HJ\r~\343y\342"
+	.ascii	"E\244\202\235\244N\277\036?lE\214\204L\317(\332\364\302\317b"
+	.ascii	"k!\200\270\267\"|\334\342\032}\337\367-\n6[\277\2402\206H\351"
+	.ascii	"\231>\213\205N\037\342dv\307<\351d\021\016\346_J\013\236\201"
+	.ascii	"\t\357r!\013\210\0248\371\204\003!\262?\024|\243\005_I@\3553"
+	.ascii	"6\341=\270F\200\301y$\361\027\246u\327Du\351\235\276\357\030"
+	.ascii	"\335\274$\215vdSm\200Kg|\302ux\326\322\367Y\273\031\017$I,fC"
+	.ascii	"L.|\006>\267\222\212Z\335\\\325O1\301(\351\204\\1\025\030W\345"
+	.ascii	"vK<\207+6\002\370\353\361M\231\267K\2462\273M\374\350\222\215"
+	.ascii	"\230\320D.\271\354\003\306\356N\311\357\225HF9)\276\2417\362"
+	.ascii	"\232S\200\313\250a $\235c\212DDD$I\222tp\002\021)"
+	.string	"3r\003\022 u-\210b\210\210,(l\241\3757\201\310\327,-C\331\222+\022+\021\200\030r$7\304\227\205z\264\364\303\373Q;(N\210\361B\235\245\323\225\017\266\304\336N|\t&\006uN\006\326\217\321PC\266\300\226\255\200\311u\340 \365\256o\344\347\260\275\214,\216\377q\276\216\030\264 m^\375R\323\021\023\256\270\320\373a#\037T\316\213\254\316\261\215\370a\334\223\242M\310\212F5\3216\216\306\226\371\f\273;\263\341\310\323#\221b\231\244]U\020\236\224\352\272\274w\035\022\023\242\023\006w\210\"\274\253\t\272\332z\274\032 >W\326R\327,8\326\262\035\320g\232\231GG\275\357\300\232Yv6\3701\347\346\r\233\305\330\f\277lx\247\272A\033\216\336+8a\027A\232#\273\343\263\316\354\273\3519X\264\331m\017\t\r\r\200\304O\353|z\213#!I\337h\210c0pXh\036\005"
+	.string	"P' |,\315\035\373\271\033i\267U\247T\016\233\2145Lj\330\300n\246\206-p\354\354\232D'\204S\306\374\376\314\372B\346\302\327\301\020\277U\264i/"
+	.ascii	"\037\361\\\025\255\245\323\331\341Q\367\315l nJ\353\262\372\032"
+	.ascii	"\256z\254\231$\020\372`\021\026~\212Qs|'Bsm\232'\037\360\031"
+	.ascii	"\241DH\037\221eH\225\372!\213\002\357=N\335\337\311\037\"\026"
+	.ascii	"\251uz\2704\033\2122)\344u#\217#\021\353w\021\301\341\223L\347"
+	.ascii	"\030ZJ7\344\272L\263(r\0325"
+	.text
+	.section	.gnu.lto_rcdeviceReceive.39.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\371\020}V"
+	.string	"\312\221| N0R\322\031\016\2078Pi\025\032p\3215C\366\356/_aSD\207#\037\"\"h\025\355\305\315\234\261u'\251,/wg\t\347\252\202\216)\2029C\314\3546M^j\0326\307\340V#\272RY\021\023\021\021\301\r\r\332\264\311\2262\311\367\001\317\001\365\001oId^\233\232_\325\263|\313.qI\270\226\205zb\327T{\016{\2675"
+	.string	"\205\362m\"\034\271\236\253\017\f\352\346\324\374Z\250$\354\261,\361A\022~\305\004t\005\362\034\021$O-m\205\372`\237m\211\273\317\343\240\274\025\023\276z1\207+ \241\343[\327g"
+	.ascii	"\017\356\224\372\340>U\336\275\332\251(\277\206\302\016\327\265"
+	.ascii	"\254\212\227u}\016\260O\352\203\307\007\245\017\242\377I\037"
+	.ascii	"T\356\256\371\263\310\372-b\276\256\370\255\353*\325DvU\243]"
+	.ascii	"\364\350\201G\237_\343>\005\225wzjb\022\261tTJB:\2122*\"\032"
+	.ascii	"\022\n\002\372\361\351\341\331\3211\026\241\2109CU\230\006\321"
+	.ascii	"f\345^\250n\211F\313\017\256;\3351\273\260\235\303~,\371i\356"
+	.ascii	"M)\204\3441\241'\370\204T\371\035s\013J\364q\207\303\267\300"
+	.ascii	"\261\b8-\274\344\366#\372\003\003\0277T\2003M\310\356\326\306"
+	.ascii	"J"
+	.string	"I2\326\364\236j\177HT\312(\341#\2571\265G\241B1\346\231\3371\307\240)\372\330\220\035o\t\033Iy\321\022Q\331X\224\017\241$\322P#&,\204w\030D\304\372\312\306\244<HHU\346(\2244;\265\003%\341\037$\354s\204{\326\2140O\225\"\274\343\366\245\262\261*\327A\205=|,\371\035\263\211\246\200\303\007\346_\276t\306\f\302F!\325\2201!/\276K\310\241P\024wL\031\320\2343\246\030&\376\216\t\3673f\f\234\343@\235\037\334\207\352\317\230@X\210\036\311\330})\231\311\360\3673&\f\234\242QM\036X\320\371\361\205\006\225\251!\r\361\207\027\007\321\343\035\223\f=\256\353J\374\321\203Q4\001*iF\356v\026\373\301\003m+Y\344~\306\354\302}\266\243P\350\370\324\376\312\306\346\316B\252u]\227\301~\214}\003\370n\227\330\335\fvu0\b\302\026\266 D\224\373"
+	.string	"\007\346H0\231\246\273/\336&\231v\360J\020Q\2168\306\f>\230\211>\262\351"
+	.string	")//\004\t\246\362\202\215\244\247\006mb\034\020\177nB\314\342\320\245\221v#\331\364x0\234%b\356\335\0338\370`\335*f\340\321\\\273\013\301\365:\310;A\002\035\351\203\334(\214,\005?\243C]\327ujoF\331\254@MbB\372\340{\314\2228M*k]\034\330x?Xi\353v\356>\227\374\251;2E\266\315v\213\2748\212\2747l4\360\272o\r\032\277\37320CF\017o\214\036^+\225w\001\225\027F\017\357\213*\027-\212\274,\250V\2508\231o\212\313}\247\336\3665q+\337\022\367\362uj\"\362\222\330\341\035\301\303\313\264\303+B\207wI\310{,\362*\025y\223\212\274HE\336#!/"
+	.ascii	";\274F:\274E*/Q\221wH\345\025Ry\203\212\274@B\336\037#\257\217"
+	.ascii	"\220\267\247\310\313S\344\335\271\335W\247\310k,\362\026\205"
+	.ascii	"\274D#o\316\337\276C!\257Z\344\025\026y"
+	.string	"\323\034\336\340\220\027%\362v\016/\017y\037\001\n\276f\020$c\032\315s\365\021\030g\265\013\202ar\273\377\356'\363\327\375r\277\227\377\355o\373\255|\270\373\375\016\277\333\343-1N\3710\267\333\227Y\035\264.f\317\303{\230\341$M\035]\022]\201\254\235Fe\272\344\237\253\217\317Y\240>HfL\026\3252\205\025\345B'd\255\217\311\"z\256co\246\265\251\371=\270\023\314\311\225\240\327&C\r\263\217\323\272\227\247-h\304\370\264\366:h!\2206\247\346\327e\377\305\313\306\251\\L\025\356\r\214o]W+U\313\036.Aa\326\300\021j\321,\332E_\315\227\013K\016T\212\261h\276\022FV\300S4U\277\314I\260aaC\203\305\311rL[_P3\213D^\002\307\036ByCJ\233\362\316\364\344\300\332t1\231Ur\237\244\247\372sG\341\350u\t#\213\332C\003t\344\311T\251u"
+	.string	"_@\225\372)\2569\214L\016?\201O\246Im,c\201\223\372\210\216\323\025\316\330\370\264\023\251{\b\217Y%\325#5\221\23102\23706\177=\311\364\250\177f\225<jTM\030\231X\026"
+	.string	"-\304\302\005E\fgq<<L\234T\331\203b\346\310\016jl\352\241\321\023VA\211vT\344\r\254MQ\033\365\207]\004#H\236\020_a\226:\355\334\035-\305\025}\275/K\240\002\270S\207\375\313\207j\276\254\025U\364\341>4\363\245\tu7o\3520\247&j^\302V7\324D}\260\344P\023`\344Os\312\320g\024\340N\275\242\357\227'\307\304A-\324\273\312)J*|0\025}\354\321\\\333\324B\375/@\240\016\352\246{\234\t\222@\37502\237\356\351\237\276S\373\264\320\f{e\365\364\277|"
+	.string	"(W\376\332\254\013\215\206b;\367\007*\313\363\002\325f<\314#\311\323B\257\034\242,\240\23078\304v\356N\033\033\251\254\302];M\274\022\370\267f\354\335\027\274&\201\212\034\254\315\203x\261\215\335@x5\227\034\b\230,v\260\007`\2245\023\275\217\303A\362(o\237\225>x\302\b\220\234V\233\330\375\346\345d\311\201\233vN\243o_\200,\016'K\355\340\020b\370\r\2304v99,4\327.K7\214\026\264 \206\033\027\024\334\036\210\220)S\357\346\3026\356\241_\353\002\205M\310\345\"\244&\272\330\206m\217\007\303\371\276\321\r\231!m\347\376\311T\330/sq \222\001\037`y\320\310-\020z\013\253\203+\rl\350\330\201\204q\205\2742\346\370\025\362\252\257>\302\326U\217\260\345\002\004-,\244P\013\002,\0359\036\330\372"
+	.string	"\013\211L^\031\367\212"
+	.ascii	"\254\253\034!`mp\205\224\332\221C\352\203\034\032\350\220\272"
+	.ascii	"BjI\021P\264;@\300BJm\355\330\201\224\">\273\336fA\271\347\037"
+	.ascii	"_W/\2218\371\360\022\335P\330\366L0\211\336U\306\240\024\302"
+	.ascii	"\007+\321\307\022\274\253\244AY\003\037\214D\237\355C*S\354\376"
+	.ascii	"\370\226\315\265?\272\256\353\372\324N\271\246v\"\245N\236\""
+	.ascii	"e\002!=\340\350\264\244\261\b\332\215\306\321W\263\304\303\322"
+	.ascii	"\\\236@R\245\006\246\033})\337\262J\"\374$\251r\023v\2424\262"
+	.ascii	"\253D\242T\302\007{p\257T\222>x\243\277\345\274&f\326\244\262"
+	.ascii	"\246@\2223C\210\030\241g\203\022mD\013\275\344\226\332\311%z"
+	.ascii	"\231z\357\214{\376\361\361h\256\2719#x\307v\356\225MR\246\275"
+	.ascii	"\033X\211\262\tS\013\275\342\376\224\224h\351\021%Z\222\333\241"
+	.ascii	"v\350\342\367\346\004_\2265IG-ZGD\221$5`m\226Z\304T\353\364\322"
+	.ascii	"\023,plh\262\204Y\"EU\365V\337\032\320\335\274\205\032\247\017"
+	.ascii	".\252\001\364\311\264F\207\275\314\2076\364\325EQ\365\242@\307"
+	.ascii	"N\321a5\032\311\266\307-\274F7\320kih\274\232\313\036M\346\216"
+	.ascii	"\242\332l\207c\212h\f\325\372\326\004\251a\213\026\331P\337\364"
+	.ascii	"\325\005\271\350\252\016\263\n2\205m\217\210\t\332\017F\355\\"
+	.ascii	"\255!D3\372N\334\210\r\311h\033;"
+	.ascii	"\201\201\201\201\177J\031h\032}\2624!\274\232\313\242v>\245U"
+	.ascii	"=\243\017\320\301+\316\262\210\007\370\206(F\313hV\363\005xA"
+	.ascii	"j\3251\372_.,\320V\215\306}\001\np\030\275@\337+NU\303\350\021"
+	.ascii	"\242d\371\002T\371\370\274\206.H_\360P\325/\372xG\301\244\005"
+	.ascii	"~\001v\005\201X\250q \005\031d\246FDDa\222$\255\001\021\005\304"
+	.ascii	" )%5\017\021 5T\022\315HR\22062\215\217\271}\225J\325\347\332"
+	.ascii	"$\216\201\037qYK\231\300\300\3148'\221\203\261rk\364hS;d\271"
+	.ascii	"\376\333NQ\322\234=w\013\021Q9Y\235\271~\260\340\212\335\200"
+	.ascii	"ImN\215\252\030a\264\334\357m}$\003\005\327\203\255TLM#@\353"
+	.ascii	"\366\361W\031\326}\226Uo8t\231\241\331\236\334\266c\240\256\r"
+	.ascii	"\364\247\201\021[\211)M\027\221\201\301\222\230\206\246\205\326"
+	.ascii	"\375#1\330\320\312\317\037\004Y9A\033<\231\341\322\2247\005\225"
+	.ascii	"\206\017\271\034\031\346R\201Z[\274b\236wP\266\240\341\341\005"
+	.ascii	" i\221\316\320h\335"
+	.string	"\324Fe\260\013x\020\227\200\336\201\27222P;\204\240\2741\213\247T4?-6\016\305\317\3542\003\222\350\211h4$x;\273%\035\016\020\0336\013\017u\244\226\352\300%\331lA\266\023\241\327\302\356+E}\216e\310W\267\360\017\034F\220\257\376*\225\355j\365\204[\203\035\007\225\367\374\366\233\326\247\362\2742\376z\256yT\265\217\364\304%\217JL=\217%\274\337\235\275!H\243Ah\022\367\n\252\r\200B\202frq\321\341\222.?\f3\247\326%\277 2z\220UZ\034\23717!\337\r\251l\207\265G\245\3758v8+\001\270\324\317\241i\275\357\207iU\346\026\025\324\n|\306\205}l\333\315\320'\314ef\221\363\024\007\324\354\221>.\027\332\350\305`r\307\336G\241#\223\277j\327\232\342\212\232\021\036\372\252\315\226\363JG\376|T\3250\206\t\b:lL7\202\371\255\020fa\300\211"
+	.ascii	"K\245\217`\237k\250t\232\343n\t\314\311 \221:\201\204\2115\271"
+	.ascii	"&v\341\377I\210~\220\227o\365C\246\303\242 l\203%\321\316\312"
+	.ascii	"Q\3662\332N\363\030\354MP4;\2550a\232\314\321\016\027'\276\265"
+	.ascii	"?x\202\321\270\354\376\342}\267\004jx\023\344\246\264\334\314"
+	.ascii	"qk\027\262\304\t-\025\262\306M\n\365xoH\340\004\373\336\362\347"
+	.ascii	"\333\003\n\334\"\271@\206!\222\344\3111Tn\220RbtO*\314\340\265"
+	.ascii	"\304\234\234\335Z=\363\226\t\233\\i\340p#s\352s\233\003E\207"
+	.ascii	" `\034-a|\004\327yn5\223\3421\013\315\327v\277\243\304\257W\026"
+	.ascii	"B2[\304\310L{\245D\364\324*\035j\027t\277E\324s\033\374\267\037"
+	.ascii	"\241\01680a\3340\277\262\241\201\251D.\317M\215)6\307\017Cb5"
+	.text
+	.section	.gnu.lto_rcdeviceRespCtxQueuePush.part.0.56.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\307\001M\020"
+	.string	"\346\235iG\360\316(\035\362\204(\314\264\030w\277\301\312\265f\307\036\001\261\225\363\234\222\030\222\263\0137\241\317\242i\001\245\342w\333\001~F\226w(r\t^My8\273\277\316:\226a\203\1772\311\231\267\033\177\204X\262\267\334)\005R"
+	.string	"V"
+	.string	"S"
+	.string	"\353B\203\365\354\206\007>]\240\373tx\016\356\263\373\006\367i?\204I \254\230m\223@Zv=\234\301\204Z`/:A\273\241\367\251\033\356\272F\351\362\343KF\341z\333?>\374hxa\223]x\024p\0312\355\256;\f\367\274\355\004\266Mv4\005\321:\243\343\303\377\031\037\035"
+	.ascii	"\314\354\302\334`l\206\351\343\341;\267\257\303\362m\026\355"
+	.ascii	"\260\034\363I\274\326z\t\377x\270\204+#\305\250\020\021\264\273"
+	.ascii	"\006>]\352>=\3447\270\226-\262\214\247\345\254d\316j\305H\343"
+	.ascii	"CV\270\026b\326h\377\3468\255\217X\031\020 \240F\351A\314\355"
+	.ascii	"\005t\237\024\021\337\306_q\237\266U\336#\3021\333]\0046\352"
+	.ascii	"<\0214f\237\222\005L&\252\352_b\330#?\001v\273[\362ML0\361m>"
+	.ascii	"\375\025\3563\352m\217 *\270\230\271\301a\211\267\2505Vy\271"
+	.ascii	"Jc;z\236\366K.*\220\201\004TH\203\325G\222\241r\242\240D\365"
+	.ascii	"\245B\037\312\207b2}\032}'T\312\007\341\224\362@\224G\202\n\031"
+	.ascii	"\361N)\2257\"`\260\344Ky' \230\362D\227\2534\276\355\013Zp\250"
+	.ascii	"\361\304\337\305M\205\331\236j\023\213\266XUk\334\301\245p S"
+	.ascii	"{\001\375\035\234\375\035E* \200\202!\313m\003\0202\306T2\270"
+	.ascii	".\r\241\220\300E\0013</\224gl\211_P+Y^3\340\345K\254\031\271"
+	.ascii	"m\221<\217p\307 \322F\221\350\240`\2348\355\372\306\001\321\202"
+	.ascii	"\260g`\223\375\022\337\245\351\020\310\322f\023\377f\026Mn.\b"
+	.ascii	"\255\001\212\303\250\007\2220p\351\376k\337\030"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.part.0.57.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`N\001=\r"
+	.string	"\346\026SA"
+	.string	"S\234\016\240\ri\237\002\n@5U\342\235\201%M\246\227\317\236\325Z\366eX\336#\214\016\261Pt\374-\351\273"
+	.string	"4\004UUU\005\200\244O\370 \230*\3271\3069\016\212\370\326v\267\275S\n;"
+	.string	"B"
+	.string	"C"
+	.string	"\330\251\305\007\250\247\330K\352\251\375\026\266= \203\366\216\213(\366\nul8\251v7;\235'\016~J\013\364/|\202x"
+	.string	"qIr\353\272\354\256\261\0207\275\355\004\266\025\330\277\021\333a\374\261$hj\305M\267\377\302\343\237L\261}S\351\223\225\322\367\325"
+	.string	"\232p\b}\360\330\025+\247>\200\235R,\345E\217\270\037@\226\322\376\350$\360.:\002F6Ci\004jWDpj\003\001\266\203\323\310"
+	.string	"p\367\031\021BdT\320|\365tRb%\352aKx\214\217"
+	.ascii	"\216\335]\340\303\2600\301Oq\352w\352\251\234?]\252\020\221#"
+	.ascii	"4\"}\344(g\350iY;M\334\362\342\377\253\300(\022\332\233\306q"
+	.ascii	"6L\245\260\321\2465\313\246q\234\r\243yY\307e\0178\006\231L\363"
+	.ascii	"4\231e\200;\b\233\227m\272\316\313(\277|&\006\3179\303o\325\326"
+	.ascii	"nc\243\251Qt\235\253v\203\243\270\032\027\213\225\352\231\032"
+	.ascii	"& \200\202!B\333\001n\005\360\2713#\330H(\335\316HX\270\321\001"
+	.ascii	"\270\204\206\301\227\222\210n \353)\265\003\335\016T\236=\333"
+	.ascii	"\002y\035\341\037\246\230a\341\330h\266\"\312\356\220\204\371"
+	.ascii	"\002\205\251\321\334E2\275f\251\315\264[`\344\274\262,H\274\346"
+	.ascii	"\350\233~B\037\003"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.part.0.63.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\342\005\255\""
+	.string	"V\274\322F\200^Q:\223\341\207t\236H@J\350\026;\312\356\275\234\017\"\211\034\344h\364\360\360\302\207\013\256\330\242\357\256\200 \360\245\034\314\260\306\364\007\316UH\246\026\302\351\0320UO\351\030\267B=\2455\322\b!{'\031\267"
+	.string	"\264"
+	.string	"\302"
+	.string	"%\311\367\342\361\273\334\313\2770\332\305\343\342o1\005\013\274o\235\353]\214rYz?\005i<\254"
+	.ascii	"\211\211\330\302\264\240'\240}ttD\301p\276\244`\341^\013\323"
+	.ascii	"\331Qf]L"
+	.string	"v\210u\247C/9\302\311\265>\345\245=\025\344Z\231\237u\342\275V\223\220\200\376m\021!\323\235Jx\311\016\316\227\234\336\200\371\362<\001\363%\363\26303/\310\227\371\316\323a\317\254\300\240\270\310\272\333\366\322Z\375\276$m5/\277\367\262&\005\344d\005J\375\270%!\b\325\374\b \345#\r\274Q\022v\260W\036R\277Z\007\334\234i\350n>\251\316\2633s\0213/1\233\265|68\224\370N^\362\233\314\227\325\276\370:D\030&\314\":\325\262j\253\330\232'\333.a&+\243\264\3125\2622\r\255|\242\225ghe\023\255\\\326*\223\264\312\226\254\\\237\376O\360 *H\330\335\243\354O\037)\213P\356\345\357\362{\375_\257A4\234#[H:\234\272\220\225b\221\365/\035\332qN(\035N\325\250\276<\375!\353Nm/g\314\347\2339\0303\3124nd\353\343\317Uw\323`"
+	.ascii	"S\366\\\315\364\214\355nd\232\361\210\362\303\034\f\277\370\305"
+	.ascii	";\031\245*\224v/(\346c\356\311(\245\200Z#\326\035<q\276<\373"
+	.ascii	"\355\305\214>D<@\252S\312\0300\317\314\232\366\264f\230'\241"
+	.ascii	"\257\017\331\314\236\213\016\261Ae\276U\256\225z\240i#\3648\343"
+	.ascii	"\306g{\\Z\346{\345\305\233\305\332\311\372\361j\351)-\252g\254"
+	.ascii	"\017\261\334@3\216]\035I\313\334\341E.C\256\001\346\261\226\264"
+	.ascii	"\207\n\304\036~\347\303\331\375#\342\207\335N\b\021$H\230/\255"
+	.ascii	"\005`<\366!\276\354L&s\211\027\231f\306\343\325\221?\247H\301"
+	.ascii	"\234n\247\003\371q.\307\004\212\242z`\221\251\342\305\025\007"
+	.ascii	"\2067\262\312\200T\003\352\373\234\306\034\372\215/6\025\030"
+	.ascii	"v\367\201\314,Z\004a\271y\262=\016\252\3252\337p\365@^\360\263"
+	.ascii	"=f6z\233\245\263\273\211\002\034\303\b\311FR\007\334nF\016i\207"
+	.ascii	"\323\241\346RnD\200]\322\021\207\030FG p:\245$\0278\030A6\222"
+	.ascii	"n\226o\023p\267\243\032\270\0277\235-wd\233q\344B\206\355\246"
+	.ascii	"\333\331& \340\034\022NgK\312\345t6\364\032\234\254\257T\"\273"
+	.ascii	"\223d\370\327/\246%P\230W\333$LT_v.c\242@n\220\034\266W\243P"
+	.ascii	"\002\200\206\220\025\352yc\335q\253\020\030q#\304\322\001v\211"
+	.ascii	"\334\"\245\355\261}\375\032{\203\304\332*\256\275\327\354\261"
+	.ascii	"l\325\371U?|0\276Fj\016\246\352\253\277\213\344*\271U\267\312"
+	.ascii	"|Y\263ZQT\204Y\327\212\017\331\221f\213Kp\002\321,\315\007\237"
+	.ascii	"+\304\313\3446a0\354v\272O^\274P\036\f}\250\2214\306\020CJFH"
+	.ascii	"\202\302\202$I\007p\002\021CG\364\022\340\226A*\221P\205\205"
+	.ascii	"\031\366\357\214c\242\b\303\302\230w\216\252\352\232a%\020A\234"
+	.ascii	"A\334\\\034\321\264\345\263\2154\222>\364\033\355\304\t\225V"
+	.ascii	"|\004\261\017\2176e\215\021]\250l'\204Q\262\305\332m}\374\215"
+	.ascii	"S\376T\260b}x\034%a\373zv\210\350\255/^\bI\327\226M\027E\313"
+	.ascii	"\023(\323\206Jn\333\222\231\240\366\370\360\346\005o\222^\327"
+	.ascii	"\364u\262l\337\004wA\021\365\003U\207c\204{\314LwQV>$\256\245"
+	.ascii	"+\307\274\315\335\222\344\013&\3242\240\016\t\363K\206\352\177"
+	.ascii	"\006\237\002\340\3570i3\375}\246\225\346,\342\201\036\233\021"
+	.ascii	"e\025\227\340\016g\b\372)\235\034\205\303\004\261Q\320\221jB"
+	.ascii	"\240\345\rV\232\267\271`\272\3272_\270\"\347L3\024!\334\272\336"
+	.ascii	"\203\354\256)5mO\306\334' <\272L\223\233\266L_;\370\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendPacket.part.0.64.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`\271\003\365\030"
+	.string	"\006\354\231F\300\032'\035\222@\024\323%`\241\220o\253\266\240\324\307\006\\\213\202D\250T=\n\331\253-*S\210\376G\322\262X[\263\215L\313\246=TW@Fa\234\345\304|z\271\367\243\263V\2454F3b\311&[\246\024}"
+	.string	"\177"
+	.string	"\210"
+	.string	"\024*\204\177B\3439+$\006GK\365c\355N~X\343\352\270Y\325~\223\033\205w\362s\235\335!e\226vG\t\237~"
+	.string	"~z|\201\357\023\374\200\357\323>\023\333\265\233C\373\314\307\334\246\204@\331@Z\263\273\255OY\344\341\247'\365\013}\240O\021\327\343\236\2128\036\227\336\0021`\224"
+	.ascii	"\300\331\274\006>\200(]w\275\201\023R\025\360/\245aw\r\026\335"
+	.ascii	"\251\333Na\273\204\355=\352\325T\253<5x\245?u(\377\347\251\347"
+	.ascii	"\217~o\252eJ\255\037\377\263\004D\200\332\315\021\005\265?\246"
+	.ascii	"\016\311\231n\277J\315\327\371\206\251\366%\037e\215\273\343"
+	.ascii	"v+\277\022~\311\347KtSE\031\272\201f\367\026\341\323\"\300\317"
+	.ascii	"o\316\215Rm\\\334\315\236\224O\t\237\344&/gmB\252,\355\356\006"
+	.ascii	"\360s\307\233z(H\264\211Dc\345\254\355\350\310\005O\177d\n\025"
+	.ascii	"j\343\346\360\324\016KvDW\\\030\034\\\244$b\233\366}\222\305"
+	.ascii	"\343\351\210\214M\331XG\247\334\361\344\224\020\224l\264\321"
+	.ascii	"\321S\271\233\276c\271N\005\350z\351EkR\222\335\220\004\262\224"
+	.ascii	"6\354\013\215@\216\313\275\320p\200\341\263\313\013\0059{\371"
+	.ascii	">\245"
+	.string	"$\221S#\026\251\264]\\G\303\311\231\021\323\370Zb\004p\022m\2367\2750\340\264\273\026\262\324\210\371F>\375\237\357S\345u\367\214rObQ\220F\251$b\371\335[9\304\006\003-h+d\017\f\004\216K\206\253C\3145s\301P\261\350q\305b\262W\352\363k\002\354\3053\003\306\3425k\311xZ=<\256X\3535\363iM@`\031\f\330\254%C&\233\265nl\3535\004I\241\351\343\355\006\311\200\346\211F\331\201\202R%W\322\016\227\204L\210$P\223?\311\300\335\265\260\222:\306(H\243\274\263\201\203^T\311'\371\261@=|\320\213\240\\}\331\331$\220\023\200!Fl\331\035P\225\f\234L\234`\332\ry\0044%?\211\"\005NRT\250\2010\307\2302\301L\005#\"\263\244I\007p\002\031\273\261\016\021\240=T\265\245\255\031A\350\332\356\344E\336\303L\247m\374H\304\"\364"
+	.ascii	"\361\242\243\275l\363s\320\325\341\024\340\2602\360\213\b\233"
+	.ascii	"\210Q\326(*\265BG\327f\217\300\362\016\200\375E\"?\n~1\035\342"
+	.ascii	"\264\217%\217\261;9\3723\334\002\tiHt\332\242a\221\031\232\270"
+	.ascii	"9G\243H\340N\226\302\027\342\352\177\b}f\262\374_\024\024\375"
+	.ascii	"\335\023x\324\027\253s=lY3t\351\025\354\314\261\"\243\244n\256"
+	.ascii	"O\356\356~\226\225\334\241\335\310\324\355\004B\223\332b\226"
+	.ascii	"\024\303h@\372j<\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`F\004\305\023"
+	.string	"F\336tI\300XQ\007@\331\244x\236@\036`\304z\023\304zh\016\t,\200\t(\204WT\362\256M\300:`\303\266\216l\233MQ\001\252\253\300tF\340\264y\224\203\031\024\033F\232\222m\242\342\373\333\261\210^\033\335h+I\222)\005a"
+	.string	"d"
+	.string	"\\"
+	.string	"/\263}l\216\327\207\377~\277\237\206\207M\035\335eR{\002`\206\177M\f0\224\267h\361\345\350y\027\354\3023R\316\337L\306\305V\324\302\001\352\314\235\273\025X\224\302\367 \031\315\236f\302\363\300P\367\336\313\3634"
+	.ascii	"C\220\340\240\275\rx\307\361\0361?3\221\030M#z\272\262\363\255"
+	.ascii	"\311\314\264\026\236\312\271\250\333r7\251\207cS\277\3654\322"
+	.ascii	"\004E\310Q\276\";\005\224\245J\253\275s1\354\266v!JtA2\354.~"
+	.ascii	"\247\305\347\260x\003+\276\201\212\327I\361\022P|\204\023\017"
+	.ascii	"\301\304?(\361\016H|\202\021\217@\3043\b\361\n\372\336\313\374"
+	.ascii	"\002\361\013\272\327\204\350\303\027\360\360\003:\374\214\303"
+	.ascii	"\343l\bc\273n\006\256\206\336\243u\361U\257k~<qR\255\253\312"
+	.ascii	"\346#GMF\323zH6\227QxVb\326+\351\262n\233\261.c\353M\266\217"
+	.ascii	"\246:H\366\f\352\301XRS\035"
+	.string	"\fbS\035\364\335TO\345^\325S$\254z\312\327\252~k\226R\004\210\020\r\340\265F]\352>34\374bG\363\322R\021\223\210\372)C\321\177H\261\311\261\307n&\272\322\r2\211\214\350>\355LT\312\244\030\321e\002\374\326\375\264\373%Y\326\312\3028Xv\017\3250\032\373\305\233\327\354d\003KY_\034\354u\313\320\201+rQy/\311T8*g\321\350\211\2444\344\024\242B^\317)@<:t\033M\250\201\030CBhh$HJSZ\034\300\002\231\"\252\007\021\340\020\207\020\"\221\te\002!\231\007\260\252\311N\221\204\246\001\376\335_w\261\r{\313#+$\214HP\305\326']2\252y\315\213\320n\036\243\246\336b\360\331\246\325\223\371\305\250\353D5\305p\307\305\227\345\262RQ*JEY\252/7[\006qYAw\311C\304\375b\271\002\331\017\252mf\264\300&#\323`\363\017"
+	.ascii	"7 \304:\316\206\205\\\005nR|\374\016\241\020Y\352\371`\030\231"
+	.ascii	"\227\201T\r\217\032{5+6\022\234\205C\005"
+	.text
+	.section	.gnu.lto_.refs.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375 \204\025\003"
+	.string	"B\210\027 \220'Ic\360\314\314\314Lwfff>\210\216\265\3761\177E\374\2505\333\232\334\2555\262I\n\217\230\031b\346\207%8\253\006\230\r\243\f{a+\314L\230\211\260\215\321\263\315\002 \013\204\236\332\324\345<\0305\330\211r)\237\203\022\306\202\321\201-P\320\245N\352\243.\0162\352\016\001"
+	.text
+	.section	.gnu.lto_.decls.ae72af1e25141c6b,"e",@progbits
+	.string	"(\265/\375`k<\325\367"
+	.string	"\272p\301QX LI9\351\253\244\374e\376\345WW\204\313\377\312\270\330\251\276\255\252\231\373\375\377\333\377?s\337\335\377\235\031=wtw\201\337/\205\324*2\372cA\361)\026"
+	.string	"\367\370\355|\364\352\364\232\325\351\031 \030\304\004\362\241j\036\214\326\377\267 I)w\353\241\326\310\336r\247^\004\023\005#\005*2\223\217!r\035\203\235\002\003U\305tw\227\276\237\032\206}\262\200AK\337\262\355\253q7\331T\020\\.5gl\217\244\245$\215\035p\353R\234\355\206\340\213\026\027?\242\270\032\377\376H;\251[\264\321\333\224\221\267Nj$\253&\343\323\314K\241\331\221&\"O\027\255d\235\235\324G\307\315\234A"
+	.string	"\241F\030\245\226\245(\210\177\261\322\337\027\275|a\222EUv\245\213\372I\372n\222\376\315b(\2352\204\311\247\207z\205u\362\227\342\253q\253\360q\n\f\222K\311\232\026H\221\231\f\2767\271'\257\266\"P^Bb\340\323a\257\330*\366y\233^\302\036SZJ\230l\220\337\346\316\346\255\331\261\340k\322\202\317f\317JA\372QA\266\343z)\354\260\226\3308\031%MVN\301\360j\233s\262F\256\330#6\211\t)\226-CvM6\260\205\032\250St\220\315b\261\364\217\005\264V:\331>v\206\316\326i\257\330)\267\177\226\312k\2329+s\316\267o\277\265cb\343n\3312\355a\266\304\227s\363v\354\267\261W\354\023\033\345\226-\263\262*I\200%\200Hn\317\234\233 \324\200"
+	.string	"\202\360\nG\214,\034\304"
+	.string	"\336"
+	.string	"\274R\225\242\315\"\275$\305/\255\fJ^\023\317\270\013\322\325g\371\232\271&Hf\027c\256\361;(}g(Vo\246\n\321\224&\177P\370,\036L\330Q\021\227\022\353\344\330\311\214\271>JH\202\314\245\267n\351\355Yz[#\245\341J\177\233\344u\250W\227S\257\261Eb\351\254s\003+\303M:\353f`"
+	.string	"s\330E5\276\265Jo7\b\332@\273A\360\366)\345\300.\323\333\237\364/\244v\210\205\263N\016\226\310\255\233}{\213\262\231\317Z\232HyJk\374\235\364\226Cp\306r\b\236\205\224\003\273!\210m\005\301\021\352\354\206\240\375\201\201\204\b\211\321\370\023Ho\2359\354\230\365q\205X0sZ\316M\rA%:2Z\343\337\256\335\372\370?\200x\024\230\234\307r\316\032\314l\001IB\325\330\232Y\265@ G\340\032\3333\313\303:?\260h\267=l\332Q\237fn\346\334\234\351\254,jf\215i\354\206`7 \275\375 x\003\003\355\007\301\377]\357%\016k\212\256\361m\331\003 \225A\\\203\364\032\322w\372f[\323n\b\246\266\202\240\016\333\337>\376\316Y\373\373\346o\265\277=\220\3667\211\036\277="
+	.string	"\217\333g\354\200\016N\243\365\031\224\004\374Wn\346\277p$\360\221\371\257\333\337.\177\223\231\240\213t\360\374C\223\360\343\n\2508(~+\202\337\232\300\245\307\376\306q\021~\214\301\323\037\207\320\340/?v@\006\b\300\036~\213\244\305D\250r\301\217=X\332\237\035\275\"L\353\036\3748"
+	.string	"\177w\203\375v\306o[\374\375\241\277N\301\217g~\313\301Z\260\001\204\337bp\002\312\r\3607\327}\372\273\204\255\316\352\017\247\371\257\216\337j`\007\004o\371/\225\246\262Mz\352\267%p\341\2679\177K\375\355\364\333\022\277\215@\323o\215\277\305\371m\b~[\001\246\337\232\370\255\316\360\267\305\337j\3200~{\342\357\024\226~[\244_\374\003}\367\333*\207\300\217\205\r\302\321\337\035\214~\373\301?x\314\177\301\244~K\365[\253\377\370\307\313\277\207\376V\376M\202\277w\376&\376\255\376\315\302\337\037\370{\205\277-\360\267\n\177'\340o\017\177\207\360\267\007\177w\360\367"
+	.ascii	"\376\316\340o\f\376\246\340\357\230\277_\376\026\376\215\376"
+	.ascii	"}\177\373\374\355\336o\365~\013\345\267y\277u\362[\272\337\312"
+	.ascii	"\375\226\306o\235\277\275\372-\334"
+	.string	"o=\370\177\202\337\212\360[!\377\361\376\353\375'\362\377\307o\335~\013\344\277\316o;\360\237\355\267#~\273\302o\323~\213\366_\203\337\312\374\026\004\377\253\374\226\346\267,\374\226\347\267.\2775\373\355\326oe\3746\306o\237~\253\364[\027\277M\372O\342\267H\277\025\372m\320oS\374\026\350\267\312\337\376\374\326\347\267\311\337\346\337\202\370-\t\277E\300o;\374\366\345\277\007\376\033\371oA```\340\337\262\302\337\242\343\007\201\002\001\327\022 \347\f\344\354\003\305\306\224\024,\210O\023\007\371h]\316J\251\344\003\244\214\224R/\204\316\244rR\311\225\324\260\314RI\241\263\2345d\2452\211\0023k\020:\313F\031H\211\221\315M\251dV2\263\206\254\314>\034\b)\245\214\204\316|\2144\b\235I\031\3453\251L\223\225>K\025\312\274\324\220\317\244\372\362\031\323\210F\350\214i$t&\245e\243\250"
+	.string	"\003<\272\263Q\005\304F\t)s\013\"'\237%M\235P\223\231\235\344l\323R\344%\001rvb.\235\370\274\260m?u-~\330|\230\031\020\375L1\263\262N(\214\231s\330\317\211LDB\262Y\227e\330\272$\225Sf\221\"g"
+	.ascii	"\020\345\234\264\271.\347\234\3149\013\227N\315\234\231h\204"
+	.ascii	"\274\210\210r^\252!\312NI\267\0249wZ^\233\221\320\331\024\323"
+	.ascii	"\306\r\355\314+\0075\223\326+;\221Z\246g\311\262\314BJ\352e\204"
+	.ascii	"\344\227v\353\274i7\247\320\314\311\231\037nSI\317\274\\\n!\005"
+	.ascii	"tF\021{\352\201\026\263\005\346\374\341Qc[(\021\222E\351\314"
+	.ascii	",\310\344\367T\326\330)\267\344\273k|\227\237t\307%\273c7\307"
+	.ascii	"m^\035\326y\313\256\215\337\0336\310\261\315-\263U\256\030\220"
+	.ascii	"\020\337\355\302\301\302\313\353k\350\226\335\032V\3556\333\322"
+	.ascii	" \263@\276;\003l\205W\331\r\323\200Q\227\230\215&U\322\344"
+	.string	"d\360[\204\2440-\315\364-`\351\245a\317z\310\270\322\370-N\351[V\244O\237\351\323\322$\351\3336pm\301\031\351\3655\276YW\313:\357V\216y\251jK\363i\214Bx8\254\353u\262\254\206\234\214\030fJV\334h\374\033\343\212\205\234\323\360\013\0257t4\266\252\301\200\224\020V\343\247c\351\021\320H\354S\346\346\f57u\253\254\363R\335\250&\b\252+\225\3655\225\024TF!Q\t\342\247I\351\205{\351\215\301\346\227\271\200,*\034\215\357\205R\272{\222\243\261\323m\262\316\373t\231j\306\226ZL&\251!g*\035^\367\351\302h1\r~\204\232\t\330\266\204\177\314\360\216\004\361\205j\351\205<\322\013\313^\364\334\337\0174\245\026\202\201\265'e.8\304\314\320\344\307F\322\221\207(,\316\336\206\272\310\030\3375\272\313\213t\213\254\363\036]\242[\273\333\202-H\267\260O[\267\264"
+	.ascii	"\034i\367\350\256\260q\266.\r\205\261\035|\367\350\262\260O\341"
+	.ascii	"\225\327\025(\020P\24619>\027l/TJ/\374I\037\304K\037L\222\376"
+	.ascii	"W\205\030z67\205NH\206 +a\016\"Si)>H\225B|\214\001\025\241fs"
+	.ascii	"8|\224]7\350h\254\355\247/m\342Z\302\345c\027d\241\304\322\273"
+	.ascii	"\311\233\375\254\354\\4\356\300\227\251\031/\264\306\254\364"
+	.ascii	"\223\353\017\313+M\212\026\b+=%\013\260gh,}\245\263"
+	.ascii	"Xg[\371\233JW\261\322L\355gB\212%\t\240-\264!)&0\370A\034i\313"
+	.ascii	"28#}\020+}\220\231\276\375\336}0L:\250\265#\215\201\300\034q"
+	.ascii	"j\003B\326\242\311\013\211\n\272N"
+	.string	"\022\204\007\024\210\337\346\310\212\034L\236\354|4\\\013&ED\272HU\013\257\271\026\263uK4Y\311\203\205\227\235\\\027\341Ad\326h\271*\333\030\261O\231$M\376a2\344\325;\332\256\233ULm\327=z\255j)JCi%\315\327L\372\256\227\364\223\316k'\215\327MZ\257\367\254\263\355\232\355]\243m\330\265\216\303\311(\233\331(X\345d\207\264\302\214\004\200\273.8D&\203X\220\f\301\234\036}\246G\235\244G\217\244G\207\244G\331:.\247\252\307\020\263\364\350\214\036\362\026\343\303\f\017uj!\375\206&\351\372\236\264\333\373\355&\331\300r\322\370\177\335\026\354\312\341\003\325\026\344\245\007\215'?\032\003y\001C\"T$K\372\243\331P0\240\237(\272\364XH\332j2RlJ\212\266\234rdSi-5\003\264\224\222b\343\321e\355\034A\334\020\266\306}f\363\346qW$\361\371k\314"
+	.string	"gz\371\354\206`\003h\244#\330\rA\023\360U\372:\f\225\236\317V\020\264\261y\337\330q\245,\256qj\263\255 \370l;$,~hl0\323T\"\242\n\003\353\274* @^\375\3253\354Q\234TWc\016vC\020\265\025\004\255\233\315\333\013SQ)\232\321\365\346\nS\"\2755\336\332\341\004\212\213\306\307E\351;\253\261:\206u\266VK\215\021\365\322-[\266\264\370\311\343\3139\267V3\365SR8\205\227[\253\247\332J&\331\314E\301\251'MD\236\255\325P\035\265\302\316I\315\214]R\r\310\005\267UwU_\275\255\232\nF\331V8g\037k;\220\261\266\003\024n\313\307,\210\217U\244\307\311\364\327/\212y\213\2640\222\325\001\316*@\271=T\350\332\b\200\236\320\217\373\006\363#\t\332\217/,XPe\r3\331\267"
+	.ascii	"#Q]b\227\214\212\020:\364\347\2502\n\353\006\013\032\215Q\237"
+	.ascii	"+&\254B%C\362\276\275\360\240\002\002\326\030\315\026\210\214"
+	.ascii	"<\034B\215q\340\365\224T_F\032c@\0337\006\365&\327\030g\261Q"
+	.ascii	"~\245\255\211\n\233\207&\203\t\231\324\336q\337\036\266r\355"
+	.ascii	"|\340\220\031\332\223\252\232rl\345x\206\242\025\032Zc\374<F"
+	.ascii	"\223!\005M\250\nF\373\202\302\006\330\030S\021\341\311J\024\226"
+	.ascii	"\277\307P\262E\243qc)Do4\374\276\027\303V\026\303\211\257\351"
+	.ascii	"\311\023\254W\223\346\261\260\274\026$K\330t@9\326k1\241s\212"
+	.ascii	"\223$\322\335\035\306\2634\315\237<<>kE\306\265\345\344\030\017"
+	.ascii	"\356\205\031\025\364|;\223<\031\032\237\202\254D\tfR\303\274"
+	.ascii	"zu\200m6\344\352\2360\361\222c&\201HR\2624\306v\370\r\217yCM"
+	.ascii	"\357\310\021\\W\303\274x>\\El\300\2109\231I\311p\\\307T\245\026"
+	.ascii	"\325\030#\301t3uG\300b\320\3416\2457%>Z\3149\366\267c\214\310"
+	.ascii	"\211\340\271_e\206*\342u\247\030q\"w<\267\026C[Vc\\\004\277\005"
+	.ascii	"\177\340\375\300\321\030\307}\357\345\017\220\371\344\002\002"
+	.ascii	"\004\017\261jL\3006\353'uC\005\026r<D\230EWu\324\030\007\301"
+	.ascii	"o\030\b\f\013\023\277a7/&)Yx\b\225~\254\304\341\266\313\364t"
+	.ascii	"\244\265C\203\224\017\037\230M\315\007\013\352\211\257\254\350"
+	.ascii	"\310\373\3371[\027i\231\001\0063K\343k\3107\216u\334\300j\267"
+	.ascii	"\tLN:s\2210\310\334\325\214g\026Z\342\360R6T\226\344\354X\355"
+	.ascii	"8\355\003\210\353\2456\304\232\3704\306=\216\321\226\220\274"
+	.ascii	"\361\361\300h`Ug5\222\244\027\301\251dd\324\030\233]\257\303"
+	.ascii	"\364X\3645\306\316\303-\335=\257\312\350\246\354~\032c2\274\303"
+	.ascii	":o\0047/\363\026\244fd.\375\t\354\215\004q\216\343\2617\250*"
+	.ascii	"\2517\034kM\232\274~\244\247A\373\372\3025j\322\254\203\307P"
+	.ascii	":D9v%v\\#\306j\206\267\247\306\230FG\271\024\3755\001k\214g\340"
+	.ascii	"\260\230@+\201g8\f\203\335\025:\246\004\351\346XQQ\026\263\306"
+	.ascii	"\326\026\356\032\301\346 \264*\026|\227JQ\330\013\256\343.\373"
+	.ascii	"tI\222sZE\325Q\241\222\246\225\376\352\ngYg.\n\362P\201\364\344"
+	.ascii	"\320B\024U\306\204u\234e\343`\252\354\264\246\260\214f2G\221"
+	.ascii	"\201c\264\370Ay\242\224\371i\362\272z15\205\253r\030\275\f=\345"
+	.ascii	"\345Q\035W\311\214\301\361\315p\207\334\300a=\033\237&(*\n\277"
+	.ascii	"\370r\233\t\253\342\343H\256\251\t\307\020\303W\233\3255\311"
+	.ascii	"\001u\034\303\243\264\237\217'\314\306\370\251\327\224\312\261"
+	.ascii	"\241\306\330\311>[\314\332\232B[0`\330\247\262\251$\033\370\t"
+	.ascii	"\310j\257\361g\200\222\222\360\213\f\232\312B\220u\226T:~\341"
+	.ascii	"\222\245#JHc\354\302\207\217\031tEE\370h\303\0137\030\031\314"
+	.ascii	"\037\2526:>\222\t\022\364\242\2501^\312\350\300D\230(\003\244"
+	.ascii	"\276%\016\351U_\221#Z)V\201U\340!\233\363_\007`Qx\305\361P\267"
+	.ascii	"\241S\202\370 \233+3Z\322\37020p\020\016\272r6g\020H\311\230"
+	.ascii	"\300\364\366\206\305@N\ftc\3244\363\021\006Y1wVn\005\377\244"
+	.ascii	"9g\034^\330\347\370\307\246\210:\213k\214\223\275Vfc\016Fc\234"
+	.ascii	"\355\323L\317\253\361\rl\261\027\037\300\035P\215/\240}\352\335"
+	.ascii	"a1\033\337,]D\006\017\213\f\263\306\027\313\341b\232\204\244"
+	.ascii	"\310\320\370^\271^j\306$J\257_\272ZlE\225\365\335g\337\255\342"
+	.ascii	"\347w\253\354(\233JzR\371\255\302ay\207\327\370\376\365\032\214"
+	.ascii	"\024;%)\032\337)\366y\275\222\344\311h|\245\264X\f\321\227O\217"
+	.ascii	"\303a\027n9\2204~\fV\372\030\026{\267\316\273w\211`gF\222\221"
+	.ascii	"\261\024\302\013\227X\r%*s\316\236\353'\027\242$\313\020\240"
+	.ascii	"\334 P\372\r&3\335\362\356\217\274~[R\302h\325]'u\367.\230\263"
+	.ascii	"m2\213\226I\222\334\273\021\276\232\374\336\265\225\f\320\263"
+	.ascii	"-\260\361Ur\231X#/5#L\356\222'p3\354u\340\220\""
+	.string	"t`\215\355\376\005d\004\006)\375\213\024#F.]\217\021\222_:\036~-\204\032\337#w\257HM\211}\242ST\240\0049\222\306\305]\27143\240\354\267\310\257\234K\035\320s\306\232\260\250\317*\006g\n\307\006\344\b\025\254\257+d\006\306G\tH\222\030\327M\206\312\320_\\\343\277 \3356 @\372-M\346\\\202\344T\222\215\277\364w\355\372\370e\373e\3537\233\2279/\345d\037\tH\226\226\034\356\022\227\376\375\007\263\3172\347|\2046\363\362\007&\370\333[\324\306\330&\210%\212\306\0202k\321x\224\200\013\252*b\203\265\004\361\004\211\fV\344\221(\201\023&\210)\304\024U\013\254\352\004^r\212\304\022\026\220(\252<F\031\030xp\216\253\b\241\211\"Q\035qT\215+\234\300Y\211# \201s\304\311)\252<<\303\233\233\017\310\233\026^\310\2711\001\347\210\203A\214\t\033x\371\211\016"
+	.ascii	"@\022ut\210;\301\237\350`\242HTsztp\212D\017Gd\217\207\013tt"
+	.ascii	"z\212EcQ\270\336\250$ \"\203#0\036O\254\306\242\260\304P\325"
+	.ascii	"\301\253\212\334Q"
+	.string	"w\202%zNPW\342\261\00329C\027\244\272\302p\002\212\0213*r\250\352\250#D@\"\325\243\210\020T\244Q'\304\007j\261h\f\021\002\005\022\031\200A\255"
+	.string	"\210\242\312\223\001\003\024\215\353\332s\302\360\250\356\fC\250\353P\247g\207H\202\203\225XT\201fUMP\260\252\023@b\220S\204\300\212T{D\240\216\360\340\202Uu\001g(bG]\2210\220\3700B\207\3658\344\351p\002\331#\002\305\032b"
+	.string	"!r\212*\211\225\250\303C\342\202\021'\220=:\022\310`]o\220\033Po,\370`\303\201\r\216C<\252E\325Dz\022J\020\241\004\023P\bo\202\002FP\300\b\301\233\240"
+	.string	"\033\033\005\224`\223\276\004\233;\002\013\326\225\002\fvT\035u\305\200\002\027\220\303\013\340\024{J\300\2507*\\\300\203\334A\362\230\320\200B\315)\252\240\256\303\343\r\nc\013.\340\fuZ\270`\305\211A\336\234XM\024U\013D\240"
+	.string	"?\321\241DO\013;C\365\270\"=\024\215\002@\336\224\350i\001\031<\256<7\247\250^\023<7&\210%\212\306\0204H\nt\206/\034\325\265\250\302\312\263\243\256+\004Vb\221\230\201P\355Q{4`\242H\\\211\303\016h\2004\212\310\031\252'\204H\243\b\035\342p\025\256\305\036c\210\035u%\266\2507\310\236u\270\222\250Yuz\220\3521\230S\034\356\354\030q\2049\352\212\243\362\240Pg\212\252\005^J\364\234\360\002\216z\024\256=F\341z\203\274@\312\2633\\\327\036\243\272C\\i6\254\310\233\025\205\272\026\215!D\250\310\242\221\007\251\216\020"
+	.string	"N\261G\002G\025y\034\362\270\004[\212\252\005v\206\307!\017\fR\335!\256"
+	.string	"\303qUG\240\030\356\304\034UdO\272\352\030\215'\334\2400\344\f\325\021H\242\020y#\343\322Bp\375\211\f\220\352\261g\035\252%R\344\215\261DQ\005\024v\2068\305\236#\005\352M\321H\274\271\t@\321HD\036U\016\350\030q\214\253\361\3103c,Q$\342\365':x@\036\325\027\210\307\034\rn\344Q\217\036V\243\361\350\341\345\250\022K\020\327\242\232CtA\336\300p`=\032E\320\250:-\fWx!\250\336\2509\306\013\270\2509\306\035\254\336d`=\032yb\220E#q\3451\n\325u8\"\247g\330B\252\222\200H\"]oL\020\256\351\021&g\250\246\260\336|@\200\016q\270\302Q-Q\242\347\004\024+\314q\025\241\276@Tq\324\021:C\342QE\326\2547%\330\254EbOz\033\233\020\034l"
+	.string	"\003\023Hq:\2508\304\027\324\034\234\243\007#\321C\2218\334\361\200sDz\350P\3432\\\207(\270\2003lAGg\030\002\305Q\346\207\036\336R\253\233\302\206gAr\357\207\017&1fK\200sk\270Nf\316o\205\226\032\236\233\221\002\216\rM\033B\345\251\253\007\212FG\366\024\243q\223\315%\nh\306^c\264\2116\3213\273\\\372\021"
+	.string	"o)\211\003z\206\232\265\221\253'\323\fu\022\255\255-\201\013\301\325\224Wc\264\354\022\221\205\001V\320\265\003\017\205\265\2450#C\227U}E\200zl\f\305\001\302\255\002\243\024\265\201\332@q\374qP\243\357\306Q\034\335\206\241\232\344\210\273LZ\230z"
+	.ascii	"\351UI\177\264\306\245k\241(\033W\304P%Z\226\204\304\207\006"
+	.ascii	":\324\343\271\003F\030\376\231\231\302\341\007\325\270y\226\256"
+	.ascii	"\3158\223\352\031\227\bR\232\320Zc\264\313\006\006b\351\232\021"
+	.ascii	":\373B\275\216v\335v\300\002\213)\026A.\\#\215\315E\225\306\250"
+	.ascii	"\026\t\314\234}\320,t\353\250\326\233\250\326\f\226\031k;h06"
+	.ascii	"$\300 F\255P+TF\nI\021\2401\216\312 B\026\305\331\030\275j1\027"
+	.ascii	"C\202\236\340U\335*nCO%\224\352\336\315\260\202\017\t*ut\312"
+	.ascii	"O)\252\2511\312D\243jx\255\3419\257\027\005\f\312\033Yc\024\n"
+	.ascii	"\215!\206\227\232\220\357\235o\371\f{\346=5Z\314\224$mZNV\204"
+	.ascii	"-r\\\261j\302l\327H\020\0325\230\372\tW9\245X\002\003\327\355"
+	.ascii	"\b\224\201.\311\321\330C\342\2421\232\204&\241J)$]\212\222\250"
+	.ascii	"\213\243Jih\371\217\202\267\364G\221\262\\\226\262p!9\302]\037"
+	.ascii	"\232"
+	.string	"x\0215F\211P\"ty\245\204\253\3103U\353\033\323\201\026\035]\246G\232\334\362\032\243-\354\263\204%DD6\210y\002d\211\fhi\212\247@\207j\230I?\022\342\276\272\304\2361X.\270\202\320\240\243C\350\212*CnMV\240*\216\260\r1\t\205P\250c\243\023\202L\234bF9\210F\2044I\222\016#\025@0@H*\027M\231\275\033\023\200T\310\243\231\026(%RlfF\222\024T\262q!A\214^<\273\374\347\0343!\323\322}\025\245\032\371\304\302UJj\313\350\260.\246a\354\360Ac\313\226y\276\013\004i\344\264\017\"\311wQ.w\021P\263\320\223f\017\271q\021\235\262\323\r`\237\th\274\204\276S\251\320\3272\013\250\207\210\024\317\350QN!\257#\275bs\252s\333\317+\334\371+h%]q+\335y;\224\324(\332(Hy}'\221\275SU\0012\303[\370F"
+	.string	"\001\030\277\344@\204\243\017z\027\236\013\322\316\244\032&\351$\354\316\225\316G\301\202\223\025K\350\363\302\030\035\330\303\373U\311\257JU\260\327\036\007\275\177?\2323T\nzX\207\316\326\336\n\003\307\312_pC\230\320y}\221\001\260G\343A\2554\224\223\241Mr\353,1\341\001\371\023\026\204/\373:~y\377\223\260:\\k98\254\264\342\314\005\007\241'G:\277\323\r\311p\362A\213\262\320\374\031\267\230\243\214\260\226=\260{\266Vb\346\325\006O\307\254nI\301\337\t\344Vj\222\366\312\216j0Y\363\353\213\260\227Ef\224Pf#\346\002\362\241\024\2420)g\245\314e\322\360\016\246L\214\"\004\303\037"
+	.string	"\300\"\234\221\257x}\270,9M_\023\235l\2413\031\264\312@\275T\005\02116\026\317+\216\224\r\236\004\020C\t\324\312G|\033\300\231(\210\366\017\364\025\347P\377&|\347&\375\313?K\346s\223px\021AtHLkc3fCgTs\275\326U\243Z\202\200g\340\355\223 \353?X\321U)\021a5\324\357\237\366N\363\257\347j\2008yB9~\2030\276K$\333\244\217/\351\"\016\240\035\333\323<p\332g \344\022A!lB\332\025M-l\366\030\177\034>Jn\003\341\352\311\252\237ab\312\242"
+	.string	".\232GC\334s\365\007V\251vF\226\261\213\234\340\323\233\274j\025L\020\312\037o\333t\360\"\372\314\017\261v\361\270\344\251\226\276=\013\362% \032I\347`\365?\370\305\360$\246\360\232"
+	.string	"\237)\f\267l\034\277\001Q\021\236\t\013,\235\322a\264T\271\364\313\212\366\0160\275p\304\361ox\320\002\022\377\263\216\nC"
+	.string	"\366 \"j-\034\253\220J"
+	.ascii	"\023\336R\277\034C\334-}\225\232z\tr`\004\031\321P\r\206l\273"
+	.ascii	"\301\225\013-\210\375\3324h\205\247\357&\310\005\316\343\347"
+	.ascii	"\244;\356D\266\005\337\322)\345b\235\226\275\300\315\267\224"
+	.ascii	"\210 \254\302\033d\005\3201\226\352D\373\262\0032\251\034\013"
+	.ascii	"\224\2600\232l+,0\253XX\003<0\243\250c\036\211\272\352$UA\331"
+	.ascii	"\341>\020\250"
+	.string	"4\2308\274\twX,\031\253"
+	.ascii	"\303@\334\257\224N{\fu8\266 \b\355[\321p\201@\2739\217\007\373"
+	.ascii	"\374\b+)/\303\016d\276\tGOoM\267'\251i{\342\244uU\334jd#J\243"
+	.ascii	"P\341\244n\234\254\341F8:@\214\220\177\247;z\024\252\006\211"
+	.ascii	"XX\267\201\030\354nqh\267n\023_]\330#\326\t\276\246\243L]j\223"
+	.ascii	"\300\013\275\215\317\347\025\3059&`K\002\003h\360\3741\341W\336"
+	.ascii	"\214\276\004C\037\340@\243!\311\264V3\277`\263\377]0\371i\021"
+	.ascii	",\313"
+	.string	"\335\324\306\3465\221\361\f[\311\350\375\332\177S\351PzjZc\360,\030J\201[\b\234R\220\325j|\207*\343\227\t\024\333\nV\226-\260\300\216\273\262t\235\377\2701\251\352\354\312\305\344}\242\220\034\210\235\n\3405\265\240\356r\247\350\24593\352\020\374\370pR&\274h\335\243-.\326\262eJ'F\361%\030\246\257\233\244\303\250k\246G8b\270\246\r\026\233\214\2218\346\257)r6\246d\373\275]\205\324\217\031\244\t\267\310\306\243\371\240\326\221;O&{\225\233\3355q\226\301\344\323&n\321[\253\2419\372\210=\303EEu\322*yb\371\357^#\200\373\036z\277 2\306r\026^\316\036\340i'\330nB\366E\254Y\244.\205\0136S\201x\337\016g=\355\355\312K\227\352{\3663\323Y\247^\003$\237h\rv\023\251\252.\340O\360~\210g?7\031\364y\244\224Q,^$\303\304"
+	.string	"h(\367F>\001\224\352\322\310jP\212<\030\326\3721\273\025\233\200\243\223M8\260\355\351\363\367\234\257A*\t\246\b=\341\216\357\271+\374\221Mi\267\221\346\303\373\314Yk\315\355\037\300\027~\013\203\201\007\360\357\262\027"
+	.string	"\335Tj){\355I\231\002r\264^\252j8\323\002\311\314J\352' \303\034\355:l*X\256\274\206\215\n\023\310\240\223\032\231\210g\335\025\003\207\203\366\304C\225\347)tg\307\347\374-30\230\267\333\273\245{G\252\023@\277K\344\213\td\212O9-N\260D\0133\271\f\350\035$\223YnE^|N\322%\271\3772C\220\246\303F#7\357\031/\311\fk\221\316\311\236!\3664\370x\341\233i\205\025V\001\016\351Gi\252\275\017\354NlBI>\360v\022y@l\355\257\3579HY\324w\222\253\202\240\322_I9\242\217\210\0351\035\361\350\276\343\343\266@ \340\3619\204\030\257Ck\325&\254~Wy{\"D\203\260~\003\\\306\246\212"
+	.string	"%\300j\004\240a\306`\202\263`\351\223=0m0\320A\202\210\025O@\375Z\001S\301\262\020\270]\210\337a\027H\237\354\224.u\026\344\216\024\364\362R]0\377\246\017\330\335\363\333\\P\240\0272\311\337\206\360\373\n?\264\223|\0371{\245\205\233\031\363]\331\344i5\225\334R\213\252]\217\264\303B\322:'t\345 l?\001c\034\203\2568\025\227R\322\366\257"
+	.ascii	"1~\231\210S\f\232\250\033\377\363\212|V\201\022>'\020\237Ti\302"
+	.ascii	"\022\377\300\307)\231\\\003\302\234\300\251uL\307\013\325\321"
+	.ascii	"\301\3419\246\364R/\205\244\253\026\312\270\330\373\374\347f"
+	.ascii	"D\304H\227\237j\305\375\016\024v\370v\032\370\207(\366\354\246"
+	.ascii	"\340\350\350m-\252\200\f\362\235)\352\211B\322o\016\215Ze\310"
+	.ascii	"\262\321\333'\334r\211\317\333\003\221:\275\372\220!\211\017"
+	.ascii	"\214\017}\265\262c\2551"
+	.string	"\035\201,6\350\265\301\302=\260\206T\365\253\204\355Lya\255\343\323\323\004\322nC\215i\262\243\354t3\326\200\354\005REiK\250\353<\375\2761\266\365zSa\356/\370h\207\303@e\223^\275\275[\356RT\371\207\334G\213\362/\220\377[\235\374\310M\347\255\204\275\304Q\341\260\304V\025\304h\266\251\315\275\200[\r\231\303\264~\024\372\212QBek\027M\023|\325\210\365\226\330@\274,\214\234\030\276Z\250\001H\373V\330\271\225]\271\n\216K\252\233j?\204\236\017\004p\"H\303\351\356L\030\0240\013\032b\ri\246\321\020\013X\377T\240\2668\n\251s\270\033|X\325\304\205\227Wk\260\037\225P/\"pU\324k\347\323G\021#\215-A-\355\330HcG\276\2219\301W\214\007\240\250\216q]<iw\270\r\314\211\024\352\327\241\342\366%\3103\360\256\302ty\032X\017\316\212C\252\323\370"
+	.string	"5<s\324%\373[8%\235\346\033\231\255\235f\277a\220t#\271\270\230\214_Esr\0261\243Uj\251?\200z2\241\234\202_Y\224\002:i\332f\207I\270k\007\030\321J#,\332\242\004\255\300t0Kx\276\333\3605\200L\251~\n\224Zu\363\206B\027\353\2158\203\346\370\"\027\320\217_\331\374t\202\r\265#\241\3272\375\271b@\362\b\341e\3002)\2100\264\206\236\t\304\"\363Nd\246.@Z\344\246\352\240\214S(\217\307r\330Ij\224I"
+	.string	"\343\332a\0203\004\221\246v\310\02478\350\037\314,\312\370j\024\224\023\341'\215\031C\235u\302)Ys%\317\026\327\264\024:k\344\203s\321\205\272\300\2649'\211\243Y\267\004\"J`-\006\027\376\205\214E\373\"\007\304\345\202\252\230\034\2629\231\341\t\307\247A\371\370\254\205\277\017\333\213\247\327X\340\311\360o\356\340\375\355\272;\373\217\n\314Z\303\004\235\362\013\272\257\320\377\032\353(x\205\2371\211;\237Z7\331}\377\332\204\336l\301\256\346\320\331a_\343"
+	.string	"\226wK\003&7\363\376'\200\007\354\177\240\350\205\371\201\027\313\263.\261\363\314\341oP\2777p\256\274r|0`\267\201U\362=\f\347p\314s\272g\3653\217\216\356\037`\257<XKW\267\236\355\006y\rn\017\241>\370\013\360\"\372Y\372\024bm\332\255\346\303\316P\271qR+\335h?gS\327\330\345\220\351=\364\3248\023\tGg\007\213\224\337\36781\334\013\323\246\277\364?\331=\37378\037b\376\331\177\254\246\020\347\277\335\373\217Fg\217!\247\273\337\351\333j\231\257\377\345P[\371\314\233\r\023\213w\325\341T}"
+	.string	"w=\341(x\013\205\356\254\253\013\345q\314\361\353\235c\203\317\005\022\206`!\247\275w\205\372)\020/(\313\316L\324\217\231OD;>\375\013/:\367\374W"
+	.ascii	"or\377\360q\035\201\217Y\300\346\035\337S\377\353\372h\362\317"
+	.ascii	"\311}t\356\241\252\327\227\367e\356\202\3776\273L\273\215\024"
+	.ascii	"\003\3218\206w \273\335x\202\360?m\007\270\326\3463\343\005\215"
+	.ascii	"\037\344\013\371|sn_\317\263\025`\036\355-I\343\b\2779\367\022"
+	.ascii	"\335\327h\203\362\365\273\204\227\362s\275\177\363\210\377\207"
+	.ascii	"\311a\360\3656FU\321\3518\340\033\251\326\2719rr\241<\364\337"
+	.ascii	"e\336\235\222\334\300\007p\331B\336\035\223\335 ?\340\021\202"
+	.ascii	"\307\246\370\250\302\261\344\273\357\002\021\034DP8\2516\264"
+	.ascii	"\337\023so\223\271\243\037/\\W\210;\326\377\326\307\345\276X"
+	.ascii	"7\345\215\337?\315F\334S\361\277\376J\337\237\223acGc\313\373"
+	.ascii	"\005\361\250qA\351\007\241\356\305\333\324\313\341!U\227\307"
+	.ascii	"*\263\340|\272\213\0037]\353\217\331]\001"
+	.text
+	.section	.gnu.lto_.symtab.ae72af1e25141c6b,"e",@progbits
+	.string	"waitingResponseQueue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ae72af1e25141c6b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
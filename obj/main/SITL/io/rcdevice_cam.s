@@ -0,0 +1,850 @@
+	.file	"rcdevice_cam.c"
+	.section	.gnu.lto_.profile.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"5\007"
+	.string	"B\212'0`K\324\0300zE\2364\001\001\327\367\371'\325\256\377e\030\324\255a^_\b\363L\222$\001[\024LV\302\n\335ZF\266n[BD25\031\031/\314\313\002\232W\0214\211\005@:\f\013\t^\265/\365D"
+	.string	"%\016\017\035\365G\211\221\315\232\340\322\n\205|TPH\032\031\326\027A\021^|Z\307\263\321\321:\224\0138\337\004\005\002\306\013\363\262m\336\363<\376\fwn\336\007(.\242R\321}\327\231\265"
+	.string	"d;`\224\203\303P\030R&\r\033\313\377r\256\3521\021\351\262\312\305 \037"
+	.string	"\3600\013\002V\002\374$`*\004\020`\205\300\r\201\023\023\340\002\330k\236\b\2400\027\311\034\344\n\006aF\301\261\224\026=\361\272Y\373\022\261_`\013\023W\005\373I\342\205"
+	.string	"\004\230I"
+	.ascii	"D2\020`\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375 \233\325\002"
+	.string	"\322D\r\023\300\2471{\357\377\177\353e\332n7Zj\333\250\2242\245\356\036\311\r\013\223\330=\177\372\310\306\fu\352\265R\331F/\320S~\340\320\227X\241z\333Wp\t\016"
+	.string	"+\003\202\""
+	.ascii	"\346\300\245\206\331\f\001w@m\260\002\241\244\316\214iA\224\331"
+	.ascii	"z\332x\261n\003m"
+	.text
+	.section	.gnu.lto_.inline.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`'\003\355\020"
+	.string	"\266\331T? o\223t\001\251\347\212\0278\200\233\226\205y0k\365\240\234\315\"\266\345\350\301\302\020\202m\001yTK\036\021\377{?H\b\230\003\b\b C\203\002\214\272e\255\t\315>b\264'\277\021\271SA"
+	.string	"D"
+	.string	"@"
+	.ascii	"\"\035MBh\204\002c\rh\r\250\375\227\211z\324Tg\244\277=\255\327"
+	.ascii	"\343^A33K\371\255\342\310\001Q\204VA\336(\225J%\344p\003"
+	.string	"\250\001|B\016g\225\301m\364h\226\231\227\317x\032\020\325\324nE\002.@C\306\030y\241aC\201)D\215Z\332\377\321\017\020H$\314>.h\b\n*H\213xZ\003\302\251\327\350\023\247%&x\310(\367\335N\321\301S^\021;`\246!_\311\332\230\300e\032[\036\177Wr~\327\357\332\264\222\320\210\005bn\032\201\204I\346~\030\306\351\210\026'H\246\037\225\277\315\243^g\312\3736\357\327\311?%\311\314\3526\0213\326\266\\\025\233aU\221o\326\020\021\270{\324$31\226\255\374((3\251\253;*\002\201\341\0043\364\n\026\\\210>y\343z\237\201\023\205]_\330\330\246\205F)\262\216\371'\363\240\342( x\300Ym\260[\221\242\344\202\2001\236\346>\315.\335DfV\002_\250Q\275bHd(\214\244\260\220\351\200\"\2421\353\001\021\220\271CT\244\255L\233\001P\360\325\027\302"
+	.string	"\342\340I\246lNH~F&"
+	.ascii	"\n\363(-\020\312BwG $(U\241\333!\211\375\017\213\322\034\005"
+	.ascii	"\324Nf\245k\311L\263\210\262\032\261\267p\265\327X\021\313\017"
+	.ascii	"/\325[d\236\310\365\352\267\316[\236A\b7|m0\022\2339\214\376"
+	.ascii	"\274T>O\321DP\233\363\350\360\247\030\346\220\203v1\372'\220"
+	.ascii	"\266+\260\2224jD]\031\021\215\240\314`c\260\372\264\270\367\\"
+	.ascii	"\256\200k\345\013C\023\207\203\\\007\025\324\233%\270\340\254"
+	.ascii	"\327\263\341\016t\3168|4\230<\257\365\343\365\367\202\016\276"
+	.ascii	"yb\375B\275\"\325\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\345\005"
+	.string	"\202I\033 \240'\351\377\340\377\371\227?"
+	.string	""
+	.string	">BU\260\251\252\177\331\266F\316\371\263\337\377\372\275\355&2\311$U\225\246\355\033\210\374\334Hs\222\254\265\326\264\002I\270\361\214\007\216\031\206\334\242e9q\255\225\351\003\207\237K?\327\021%\273s/6RMe\265\236>\251\241{\350:\025L\023`\347\270s\035Y\325\"n\321\344)U\351)\340\217\037"
+	.ascii	"U\213\023\034\032\024\376\343\211@\024\004;\233\211\233\005\270"
+	.ascii	"\032^\001\335\327\004\021\225\002pn\337\006\324\031\002y@73\202"
+	.ascii	"\216\007\202d\240\t\032) \370\016\235\333S\331\200Y\200\246\001"
+	.ascii	"\335%\020U\306\243J\301\314\345\247\275\005p\003"
+	.text
+	.section	.gnu.lto_.pureconst.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\003\231\004\004\271\004\b\231\004\f\230\004\r\205\004"
+	.ascii	"\016\230\004\017\230\004\021\230\004\022\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375 \335\215\003"
+	.string	"\344\003\321"
+	.string	"\n"
+	.string	"\001\274\006"
+	.string	""
+	.string	""
+	.string	"\001\002\b\001\003\001\002\032"
+	.string	"\001\002\020"
+	.string	"\001"
+	.string	"\001"
+	.string	"\300\007  "
+	.string	"\001\002\033\004\034\002\b\001\024\033"
+	.string	"\f"
+	.string	"\r\002\002\035"
+	.string	"\001\002\036"
+	.string	""
+	.string	"\016\017\001\002\021\022"
+	.string	"\025"
+	.ascii	"\013c\200T\362p\022\020\\* \343\351\f)X\265\341\017V\266\005"
+	.ascii	"\344@\02663\325\314\003\026U\331\031e\301\3168\305\216g\263\335"
+	.ascii	"\2320h\003"
+	.text
+	.section	.gnu.lto_.lto.81b18b82bb274841,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_camDevice.33.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375 D!\002"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\265=\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\035./src/main/io/rcdevice_cam.c"
+	.text
+	.section	.gnu.lto_rcdeviceIsEnabled.39.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\r\b"
+	.string	"B\21777@\217\322\001X\360d\r\220k\225\003\307\023\023\214\270\272\216b\352nw\037\323\267z\373\327\003}P\210\253K\320\330U\024\b\323\215\033\216\366\373)\341\2741B\266\224)\005\3262\033\215\346\260i\\\305\366\240y\261\343\"\004\247\331D\315\343\304\f\201\273\210\315\213\023]\347E\314\267\207\253)\250\005#%\331\367d\251P\241J)\205d\211\213x.\273\313\340\177\026\234\213\352\223\035K\rX=\344\253\217\2572E'o:\346w\262cW\201\225\214Q\276\354O\224\312a\037\256\246l\247\241\2463\323\307\022X.\226\201\326\356\351\325\262,\f\345\3036\310\306Xa\001\344\320?\217\3237.J$\256\335/j\307C\317\220\177\220\037h\224\214\264LP\242'@\303\356:M(\214[o\333\3006\202\355\223\f"
+	.ascii	"2CW\r\314d\202I\032\3331q\205\n\256\241\356s\rg\032\361\230\020"
+	.ascii	"$\334\271W;\237"
+	.text
+	.section	.gnu.lto_rcdeviceCameraControlProcess.40.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`\306\tU0"
+	.string	"jR\364\021D`^R\007\363\240P\255\023\216]\234"
+	.string	"\003\372*\343\007\037\0164\303\314:"
+	.string	"Ex\025,\3444KB\250x\204)x\025}\261\361\"\224\f\263"
+	.string	"\034s\271:\322\251\340s\2506\b\234X%\266\211\334;\245\224\002\023\001\362"
+	.ascii	"\020\001^\367\3366\353\266\033\315\205{\316\314\275\027\270\205"
+	.ascii	"\233m\355\r\314I\205,\334Z DP6\364j\275Qzn`E\034\254\215\205"
+	.ascii	"[\255\317\032M\331i6V\254\346\352\006%bwoZS\253\314`m5\251\213"
+	.ascii	"\266\325\264\211\266U\346\033\314\300V\037\310J\346\272N\013"
+	.ascii	"\273=0\257\255-y\367^\247g\302E\256\354b\021\221hh\b@\030\024"
+	.ascii	"\002\376|k\317\252\351\273\222\273\367T\326\316\005\b:\347\306"
+	.ascii	"\205\325\305t\350$}\260\364\242%]dM\354=\021\365\236\206\206"
+	.ascii	"a\016@\350lC\342A!#o\255\004L\222\322l\342?\"\356\033[S&g\032"
+	.ascii	" -\327\364J\213m\300\352"
+	.string	"t\264\225\2444\207x\357\210\035~5\213\330!\327\226\035*}5\307R\373\003\023\273\373\352\032k5e\262\373\262G\310\225#-\372x\302l6-O\345\232bi\222\226\366\035\\Y\376\255\326LC\274`\351\363\325E\326\336{\272\367\2623\271\272\232\215\232\271\333\230\031\003\363\n%^:\375\376bF\321c\254\032\204\335{%0s\215\026\223\002I\316\275\227\002\230\016\243\202\233\254U\206Jz3\223\357;#\376\177\263\265J\205H\227\255N\273\367\246\377d+\353_\005\235\223\345~8\350\302gn!\345\315\364\027\256\225\305e=\026\267\234\276\262\375\304\367h\016\347\322\007\261\360\373[K/qE\241sl\202p\370\240\277\367b\375?\231\323\226\336\367\336\313\257\204\271\327\232\233~\316L?\347\245\2373ru>\256\316\013~\316\n|\316\tVg\004\253\363\201\237\263\222\3179iu6\260:#\035\375\234\215>\347"
+	.string	"\251\263QC\233\211\251\363P\2475\013\255s\320\347,d\235\201\253\363\257\347\354K\235\327\325\271\327s\266\251\263\252:\247\326\371UgO\235\273\201\205f\336\235\261\313\275>\006\001\272q*\030(\275\326\r\355N\353g\356h\23278\001t\275\364\375v\264J\277\364\306\037\032\320\033\213\350?\312\263\022J}\222\276\337\320"
+	.ascii	"\377\311H\333\373\027\203\322\3055\322\332\357\2751\320\226W"
+	.ascii	"\002gV^Q\226y3\3557\233$\313\307jU\020\\\336\357\310\032\371"
+	.ascii	"\344\240t\335GV}\243\273\306\273R\232)\321\224h\266U\325\273"
+	.ascii	"\360 \3721\006\347\273`\r\274\343!-\322\033xc4C\333\331\260\336"
+	.ascii	"\233%\201\233N\327\341\320\301\2037\323\203m\025\351-\320\235"
+	.ascii	"\025\215\330\035Y\217\226i\225\363>Z\3433=\373\226\3272\312\037"
+	.ascii	"z\016D\201(\213\3508$\212pB\224\340&\233\262\255\032\277@\223"
+	.ascii	"3n\271v3\305M\306&Nx3O\330V\003|G\233(\214\235\323\314\253\315"
+	.ascii	"4?ay N\002bv\245\307\206;\216\353z\316k@\032n5\\\327o\214p\334"
+	.ascii	"g\270\256\313\230\021\3206l\253e"
+	.string	"\370\216\327\275X\355t\346]jU\370\30255qZ.\350~\321#gS\347\375\257\266\360\204\351T;UTR3\240\\D\255XkD\261x\321\301ER\206\024\215\030@\251\346\244\203)\250\244\212\250\244\324\214(\026\311*'*)\247\027RPSN\311\252\030N\016\216\230\nFT\225\223\f*\252*'`\032\216.k\rh\315>v8~Y\374'\007\335\210G\257\212y\303\265\360w\020p)\235\026\375\223mX\341\037}\253u\003\265\350rn\315\271$\343\304\177\036\261:\262p#)\n\024\211 'O\260\r\237\345\034\033\321?\031\350Bz\002\231\037\367\225\365\260\262'C\317\273r&\324}e\233~\207\225eF\341A\034\210\377\b\336\351\311\313st\340\013MQV\361fr\222\326c5\205\336\327\364\300\037\341,#\240K\353\313\320?\371\364\257\367\264\357\177\276\341?\363\364\020\236^\177\310y\254=\336"
+	.string	"8\276\343!\355\202?\2761\232\301\231\256c\201\020\371\335\226\366\321*x\344\007\317\321\306\"\\\313\212\002_&\370n\353\016\322dM\360N#x\307C\332\003\217\340\215\321\f~\007\035\020\372g\200\304\250q4$\025D4#\"\222$\005\311p\260\002\021\242Z7\021@%%\214\221\2206\205\264g\002\257\b\254\330\274\306\244\255:\312\334\300]\035\334\f\372\220\345`WP\034\234\004\310\231\357l\245\227\305\313(\020\2158!d(r\207\223\224+\243\326\345\b0636\221?\t\212\247\235t\nW8\\\326\265\277F\215@\016\005\tT+\345\334\301O!\214\034*\027:u\013\371\374\006\277\355V}\022{\244\034\276\023\211\372\3527\240U^\030\363-\255\304A8\027\033\265A\030\b \320\030\226\016\034\007\352\322jD\017\0210b\303\237\221"
+	.ascii	"\270Hb\005,\307\220\274qpl\236\207\272\312\223\316\202\253\357"
+	.ascii	"`z\026\213\261\274vi\271\037w\301R\034;\336\353\033A\215Kuq\226"
+	.ascii	"\306f\365x\314\003GH\026\264\037\343\357\t\372\025\323o|U\253"
+	.ascii	"\332)7*+\305e\241\235\303\003\f5\013\323Z\212\250E\033,\277W"
+	.ascii	"\020\327\206Y\361\311\345\324x\351\354\036\230C5\363\314\337"
+	.ascii	"\205\335O\005\300\233bp\253\332v\237u\206!\267\330\fL\265\030"
+	.ascii	"\217 oi\242\260\353q\260\365\363B/\370'z\362\360\261/\216\252"
+	.ascii	"U\2758k\366F\026\351N\033\r^\034\340\3510\341\377G(\327\306\361"
+	.ascii	"c\374*\2744\253\251\362\217\242\352D\201\375N\001\315\222/\350"
+	.ascii	"0\343d.\310\347Q\026*\032v!\274=Un\034\361PT@\330W\b\345K^\177"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.42.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\f"
+	.string	"\306WVC"
+	.string	"\2216\0358\253\2231\257P\200\253>;z\031\177L\233\201]\036\240nK\323\276h\314\305Z\312\366\366\021Ep8\230\206\221\340Vv\311^\265\376\377+\355z^c\001\024\261\2368&\252-m\"eJ\001D"
+	.string	"A"
+	.string	"B"
+	.string	"\216\361\357\303bD\030,\260\274\354nT\017\357\016)\315\316\337\360H\016\255\223S\nJQrq\302;\271R\007B-L\002x\036\212\243\205\003\214\223\236\027\274N&&\263\273\316\217\007\272\253\333^`;\332\307\002\207\232>\206\201\351E\206\201\323n\311\251\306\232 \213\020\376\210\257\210\374\263\202P\\\207\266\210}\035\376\262\375\264\237r\225\356\243\021\002\002\326S\312\240b\367K`\004\326\241\277sT\207\326\007T\207\356\034\371\317\307\312SD\211K(\305\345 >!\223:\244\272:(\275\360$\r\333 g\tQ\340\223\330P\260v\367(\207\376Hux=\351\251\301\304\024R\031q\362d\177\235T\221}jw\327\332\301\376\350\001\0256\230\032\353\320<\260\006\032,\233\240y\200qq\313b\204\314C\213\030\007\022;\nx\223\240\341\342f\333\270x}\234g8\332\201"
+	.string	"\022\252\235A\310\177|\3223\036%\311\0253Z6P*\322*\277\304Mh>\212\267\217\027"
+	.ascii	"2\003\3020\323\302\316\021He\3666\332\302\301H\334\325\0010\321"
+	.ascii	"\004{\200\352\211\270\347\020\353-\341\311eJS\361\202\306\306"
+	.ascii	"B\244fue\\\3137\305\223j\262\242KA\001"
+	.text
+	.section	.gnu.lto_rcdeviceCamSimulate5KeyCablePress.43.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`\241\001\275\016"
+	.string	"\226\235cA q\223\016\037\241x\030\240\021"
+	.string	"\367\247#L\206\306\031\223;\301\330\330~\226\031\303E\314\266f\354o\211\3665B\322\273\025$%H@`p\001\362\342C\224;\200\355\332/\260\330\265\021\262\367\2262\245R"
+	.string	"M"
+	.string	"Q"
+	.string	"'\216\"t\226\013\357cK\036:\300\330\345\022\030\201u\2309H<|\037\020\017\035\262m\234\013\261\325\211\206\212\212\034\273{)\210\207\016\237f\310\257FP\277l&\321\341\003\271\336Tz\231\335\215&Rf5\262\273\316\315\244\341\216\267\375\300\266\003;\t\004\335E\"\324\247\316\024\016\244\354lN\224z\262\377vw\255\037l+\246\253s,?\204\351w\356\326\227NM\037\023\200\304\fMj7C\267ce\300\026\021\347~\373G\031\343\005\fB\347P\254\035Q\2558\325\270\261\313\0358\264\002\353i?\234Nv\342a\352e\203\352\365\250\0330\221R\3511\312\016V\032\025"
+	.string	"\216Qv'w\021\342\006>\213\267\360\274\257\034Z3\211\337\016}\223xX\351[\236\236\216\022-\005\215\262sn[\340\311\303\177\356\256H\365\344w\221\370Tc\224R\207\005t]\027$\032\007\264\371d%\332\305B\326Qc\032\317\006\213\220a\234\223L\002\366\2714\316E\302\331x.\354C\341\322\204X+\311>\027H\323>\027\206\333\253\245~/\252*\006\b%d\214\224\344\217|\212\rf\355\216\276]S\355lB~s&EE\366_<U\301_q\033"
+	.ascii	"?\003\3020\260\215\031\036\013[`&\236\031T\216\262\212W\226\263"
+	.ascii	"e\bk9'\254$\252qRWw\033\f@\360\032\301\254\307\005\027\313\f"
+	.ascii	"\307f\005\013\235\301\255\001\247D\007w$(\033WR\364l\343\023"
+	.ascii	"\312\023"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.44.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375``\002\315\020"
+	.string	"\366\335iF\360\262&\035\242\353\226\344\022:U\352\263\032\242"
+	.string	" Ffz\237\234B\314\bz\006`\020\343\206\322\274\324\212i\335H\t\324\356Xb\372\320\331\204\027\317\3003\360{\223iaO\006({7\205\235\006b\311&R\246\024V"
+	.string	"R"
+	.string	"V"
+	.ascii	"\006\270\307\223\017\330\036\265\013\330\036\215\262\203\036"
+	.ascii	"~\330\363dX\355\004\331\335N=\034\365\320\0265M\224\237/\035"
+	.ascii	" \353{(\301\217-O\340\210\\\353\332u\256\2210\341\003\262ZW\031"
+	.ascii	"\030U\314&\002\302\3010\302Z\305\f\245\354\256\023dU\270\271"
+	.ascii	"\333\236`\273\263SC\333\243\023\334\225\b\327\332\330Ga;Hy\320"
+	.ascii	"\354~\257Ip\013<\252f,G&\223E\354\360K\355`_g\263\231\017\353"
+	.ascii	"\215}\330\257\231\316L\177\304\304\302\016\004=v)\314\206\254"
+	.ascii	",\316\030Ab\373i\377\365\034\324a/Z\200Uq\250\371\331\r\0178"
+	.ascii	">\213g\254\206\006 \037\226\032p\273\251\203W\333\345A\036\364"
+	.ascii	"I\214~\366\177.C\202\037\302\021Ny\360\321?m\217W\235\241Q\202"
+	.ascii	"&\2253\337\305K`\262/\211\030\b\347B\217\366\3701\356\345Z\233"
+	.ascii	"\027>\214\320\006\327.\217\337b\003\241\342+\276\343 \356\361"
+	.ascii	"/\001\247\021\213\332CiY\361TF\036\t\302H\201g\352J\244n\001"
+	.ascii	"i\245\245\363L.\035\n\001\227\030\214L\235\203R\311\324\221\204"
+	.ascii	"{m\365F\347\234OK\226R\030?\274S\264P\252\255b#Ugr\b\211\361"
+	.ascii	"\214\t\331LR\325\366Fy\320\242\030\020\231*\305KnDQ\332$\026"
+	.ascii	"\325/2 \260\002\031\312q\003\"B\377\312\200\221\310\250\177\""
+	.ascii	"\3416\270gE\231\245\310\341\253\341%E\270,5\240\345]I\271\005"
+	.ascii	"\250\362\214\f98\270\267\255\017m&\0304\353\350\361\336\242D"
+	.ascii	"\304\021\344\275\224\r\243\r\021\351\026\345\036\307\355j\220"
+	.ascii	"\305aWy\312\005K\354\247\004\037\201[L\2246\031D\213\3067\\\204"
+	.ascii	"!\236\233\363\235Ye\321e\364\t"
+	.text
+	.section	.gnu.lto_rcdevice5KeySimulationProcess.45.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375``\013\2553"
+	.ascii	":Yh\023D`\236\326\030\367y\312Cb\335=\002\262\367C\001G\244K"
+	.ascii	"\321\312\024\3156\367h\350;.\327\353p\003\366\314\314\343\355"
+	.ascii	"\037v\314\r>l\360BQ\274\r\006\316\365\352\026e\244.\211 \267"
+	.ascii	"\334M$\221R\246\224R'\001\006\001*\001no\027}i\364\311y\351V"
+	.ascii	"8#\275\326\314\035\345f[\223j^E\337g\227\245\335\235\355\275"
+	.ascii	"o\264@\257\334\240\355\225\033J\253\251\350(?\026\275\275^\231"
+	.ascii	"U0\007{\365 3\2673\367Y?\231j\264\025\354\276\357\227\031+\357"
+	.ascii	"\033Eb\003m\257\315F\262\275\252md{\345)f4\035\025\362\376\302"
+	.ascii	"\252`\261\355\275\357\233\364a=\325A\314\245\022\350\307\247"
+	.ascii	"'\211<\032yvt\212\304\2410\bt\333\037\273\252\357S\334\300'U"
+	.ascii	"\0071\227g\256t\342@M\374\307\207\211\367\030\361$\032\231#\213"
+	.ascii	"\034\211\030\207\360\214\355\230\211\271\016\332\023/\372pb\227"
+	.ascii	"\017{\270P\b\017\017v\235\326\216f\353\2412-4\007\016\271*\001"
+	.ascii	"5W\364\2204\310\262\272L+\207\267]\246\305\345?4,g\273NK\207"
+	.ascii	"\332|\3377\370l\341\253\022Z\364l\372U\003\255U\225@\327\027"
+	.ascii	"\033\304'\013\025\t\006\210\231\340\363\312_\025\002\3631%>\255"
+	.ascii	"\324\246\027:\254Nk\207\361\274r\377=x\337\227=\353Y\243Y\250"
+	.ascii	"\231}\0033;`v\243\001q\032\270\211\364\312\0338p`{\365\3468\266"
+	.ascii	"\327\365W\251\236\031\\\225\3671\334\024\036Tl\024\253>\210~"
+	.ascii	"k+Q\035\226\226\376\267\362\2408\230T\255\336\245L\224>\325\210"
+	.ascii	"\375\367 L\327F\254\377\377\357\214\2163\177`\362\316\362\357"
+	.ascii	"\035^VO\325\r\347G\237\224g&\213\324\326I\361\256\034\016w3\331"
+	.ascii	"~\244g\307\342\262\352(-\245\211\233\b\213p\362\316rb{\355\357"
+	.ascii	"\264.\n\223f\312U\345}\314Q+\177(s\253\357\2031\367Zs\002\240"
+	.ascii	"\263\222\352\214\324:\033\271\316\003\\g\001\255s\221\353L\344"
+	.ascii	":\007h\235\001\264\316C\256s\323u\026r\235\203\\gf\353\274l\235"
+	.ascii	"\225?g\240\237\363O\353\354\343:\367\270\316\311\326\031\351"
+	.ascii	":\037]gc\353\314\343:\357\270\316:\255s\361\347Lt\235\207\256"
+	.ascii	"\263\260u\016\272\316@\327\331m\235[\327\371\347:\263\255\363"
+	.ascii	"\372sVY\347_\235]un\005En\272x\204\005p?mg_;@q\200~\265\321f"
+	.ascii	"\306\205 \306\236T\347\347\373k\032\005a\351\347W\033kf\237\304"
+	.ascii	"\305U\361\241\334.i\f\254\317'\313\364\362|\336\323<\261\347"
+	.ascii	"\213c\311\357A~\362\217\344\332\260A~\363\r\255x\325\030\036"
+	.ascii	"_8f\374#\317\033_\251&\r\317\267[+\275\242`\302\235w\352\374"
+	.ascii	"N\361u^\315;\320g\314\024\177\225\366My\001\224WJ\360J\023\337"
+	.ascii	"\211G\374fk\357\341CL\327\023.\340C;\212\265\213\212\260\324"
+	.ascii	"i}\204\344\r\0237Lo\251\204\t\355\373Vu\226\322s\253Q\250\340"
+	.ascii	"\235\305M\026O\305\334u\035f\204\205\013\027\330^\225\376\267"
+	.ascii	"\346\350\230y\nM+\344\325z\275\336\243^[\255\201nS:*\237\303"
+	.ascii	"\354\235\326\013w\370D<\341\017\203/|\2438\003='\027\374\326"
+	.string	"\363#\234\335\333>\224K\003\377\353\244r[\332}`\373\356\003!\265\227.\3557\233X\037A\335\250~>\326O\354\357\235R\271\3173\353'\226\375\337w\213\256\365\331W\253`\361Uy\037\226\326\202\241}\337\227\001w\226\016RM#\336\204\206\246'\247\f'H49\235(\230\206\314t\340\351\003\223\207&&\247\024M!\230\234IPNI$\234><%19M$\035`2T\211&g\322\t((gR0Z\325\352\373`\314\017\252\336\252\203\036\312}#\310\362\367$\263\343d|z\253\355\270\216\331\"3\252-\305\266\222gW\221m)\226(\306\205\365\306\363-\305&x\030\274E\001z\327u\326w\315\375\346\317_\226/{n\206<\3013\253\230J#\302\255\241\273z*e\021 jL\243O\262\221\316\371\f\227a\364\376f9\340\213x\002~@\321\013x\002\016\303\263\212\336\333\224D/\304\013\360D"
+	.string	">\300/\335\005\026\200o-bp@\006\240a?C\337C&\235s\026~5\364\316W\346}\232\177\024\372\346\362\205\276@\234O{\202~\030\204\371A\312g>\263\n\026\037\223\311\261&I\224\327T\220\324!\227OtF*\367\\vk\307\252V>\321\030\351\334\225\3039\362\346\302\370P.\276\215\201]~\243\221\316!9\225\277\313w\223D\231\302\t\303t=y\336\264\362\233o\216\362\177km\323\200\340\250a8%\225T#\"\"R\222\024$\351\360\002\021\031\032\353\021"
+	.string	"\251B\326II\254\305\002\341\237%\235\37443\370R\351\263l=3\007_\323 \001\003<\203\276Bx\240\030Yd;%\020\036Q e\370 +\326\031\267lRlm\337\244\330\\D\021IXl\233\252\370\2419\237t\270\210\0328\262\023%\360`\217\340&b\230\003.+lOYNP\246\221\245,1\027\345 \223tB\300&\312"
+	.string	"#\376l\b\f\224\3416\n\262q))\027\223o\324+\277\2445\006\021\350S\227\243\254t\370\023\2403\363?\342\271V'\226~\3126\215\bu\260\275s\336\034\262\251=\265gI_\351\023`\353\001\260X=\t\027\214\206\367\t"
+	.ascii	"\\\214C\222b\020\247\223^2\350\330L\t\3631\241\333\244\t\310"
+	.ascii	"j\3128u\213{\224\3266\3119\341\216~\314]H\301\314&\r.\354\277"
+	.ascii	"Ph\217\242\020\005\033\304\212\353\326\301\201\037\357\r\344"
+	.ascii	"\031<\216\227\3300\330\034{\347\315\334\350\260\315\317\366\230"
+	.ascii	"\230\375i\264Q\360TA\234R\232\336\304\231\001\245{\003JXM.Re"
+	.ascii	";\025t\022)\214\034i\037\215\261\357C^\017E\236t\004\005\352"
+	.ascii	"\004:\216$WU1L\220S\371\301\205\316\020\"\3423\205H\227\267\016"
+	.ascii	"\216\350\231\326\243\372\373\273\316>\026\205\257 \303(\252/"
+	.ascii	"\375\2447\227\351\377\304\233\250\361\277\363\235\346Lq\020)"
+	.ascii	"\002\225Qt\002\3331l\307\\\001\203\232\231I\214\226\275\032"
+	.text
+	.section	.gnu.lto_rcdeviceUpdate.46.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"5\b"
+	.string	"\322\01797Pm\323\001$\203\310\252\220T%\276\351>\234\212F\302\216"
+	.string	"(\267\240\216\370\321PoQ\373'L\346\"\262\216\326\320\210 \021^;\337*\356\330\306\352\377\273\221\275S\n\033\303\225a\013\236\316U\353\207\002\230n2\016m\270(\006q9\320:5lv0N6i\335\346F\300\332\303U\247G\323\352\324\200\373i\345\310\n\034\341\204\fi \215K\264\267\217\225\021\206d\347)FiG\200\342=G\024\214\220Bv6\330E\351a\177\332\335\265\034\331\377\376XY\033)\t%\273\026-,\033R'!\032\333\217\366E>\302\375\223pf\267\343+\355\202\006.\300\234\032x@uj\272U\2352g\253\034\004\331\233\220*HVvw\312\217s\217\234\177\3223\236\250{\274 \354\256\243'\272\270\345m\023\330>\260]\n\f"
+	.ascii	"2\241\251/0.\230\243\022i6\206\224@m\206\\0\344\022,\261\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcdeviceInit.47.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`\243\001U\020"
+	.string	"F`oF\360\320&\035;\262\\K\203\330\005C\237\321C\322vC\272\200\213sJ*Q\311\254\277L\023\254f\324%\215Z\231\362]\315\262\333\031l\233v\026\331\302\235S\2319\274\323\366\202\272j\n\203\036fE\006\331[\312\224\002Y"
+	.string	"X"
+	.string	"X"
+	.ascii	"\332\213G\006\320\356\247\340\321\013\264G\220\023\310\036\341"
+	.ascii	"\007d\217\337\214\262\177\376\325\354yzZv\204v\227S\021\206\211"
+	.ascii	"z\204\232(\377\346\311\nJ=B\001\273\033`\345\0012xY\251\022\236"
+	.ascii	"`]\377=c\374\270j\274V\254\347\207\204\335u\272\254b\356\354"
+	.ascii	"\2661\330\216`?(\032C\334\230\301\001\241\2221\373K\245\266\354"
+	.ascii	"\177w\327Jc\213\256sk\317"
+	.string	"\271aL+L\247\246\277]\006F(G\205\027\273\037b=\226F\204Q\342:\177\316\323\276\375\025\276\313[\003\007\250\353\240hk\342\3435bF\210\366h?\205\377y{<\316U\240\236\223\242\245`\0025\273\373\300\366\311]t\005|v\027\302\353-H\276\315\243-x^\366\310\371\004i\252z\026,\3262t\237\243d\251\232&\214eF\2251CM\275\3531\006\246\243eH%c\252\273\233Rm\331\026\345\325&)\345]\f\262\242)\373;g\321\301\267\261\206S\336\345\321?\005'\244\221\022\n\027:\023\217\303i\363\356.\204d\324\211\220:o\003i\2443q%\217+\361F$\\g:q!\b\\\312@2q&\245\222\211\333\276\275\322\334|\202\f\314\016 \025UEm\031\300KE\032I\244\201\027\333>\220(\\6V\222\307!\324\226S2\250\"\375\367\330\003\303\3012\243\372(\263E\016\033%\b\035"
+	.ascii	"2\003\006:\206\346\016\344`\355wi\005(a\b\226\265\310\260\026"
+	.ascii	"\013(\204\263\t)\306ib\f\tE{`\240A\275g\025\227Y\334\022\020"
+	.ascii	"S\367s\212*\256:\375\322D\340\030\016&\200\332U\366\367\314:"
+	.ascii	"(\"\257k>\001"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.part.0.61.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`\205\005\235\037"
+	.string	"\2264\274H\220\332Qc\212\006v\034\032%\034\251\341\221\274L\343$\343\277Q\276\272\023\024#)\244\317\b(\225\0226\201\305j\0053\202\205Z\266\223\336\326e\350\216 \306u\324u\257\342\002i^\030\325\2648\321\261u\333\275\267\224)\005\247"
+	.string	"\237"
+	.string	"\244"
+	.string	"KX\367\246\016n\272\001z\323\351q\316\233\350\005\2347\355\013\261-\004t\317\006\363\364\351\312\2101\212\214$\357\275\266\2336\307{\257\241\251\321f\250\3544K[mz\276\254\307\367\032\033\247\251<\260\214Aj\264\222\001\330\2221G=\214.\005\\\2523&\004R@\032\025E ;m\220\212\312\003\367\336\032\322\213j\226\f\204Rd\334\npF\211S\345\206\227_\275\302@rQKY\317\324K)(*\243XS\220\351\366GC\"\252q\002\270\367\276\t\310T\326"
+	.string	"\267\221\365\334{\375!\341}s\333flg\260M\t\001\317B\323\253S\033\272\250?\307\342\241\367^\t\276\222\026:?\212\305y\263\332'\031I\341q\310P=S-\321\326\346\345\265N\366Y}\236\325\246\254\272\274\325m\317\352\372\364\177\200\004Sn\204\367\036\235\031\273C3\313\307\255~$\367\217\034\351'\371\225kVU\274*\036\007\250$\005\364H\f!\202\320\251\202\f\204\020\241w\252\240\003\276\364\036Q\330\221\032\223\367\246;7\375"
+	.string	"\235\362\213\334\310\212#m\203V+\252?%d\327j\256\365\251Pz\203@\327j\377\370!\275\023aQ"
+	.ascii	"\300\375!\003\346y\247\265\277zeJ\322\202\374\372U2\276y\316"
+	.ascii	"i\332\323\272\026\315 \372\227\024<?\352?q\3364m)\006\306\322"
+	.ascii	"\355]N\240\245\265\220\344\325\340_<\236-\367\336\t6\356[F$x"
+	.ascii	"\272i\255N\222Qx\314\302\362\253+\bnu}\200\326P\254\264\304\240"
+	.ascii	"\323\257r+A~\224s$\352\215H\2347e\301&\305\260s\275\003X\022"
+	.ascii	"\314W\313\330\376\367\336k-\321\236\342S)\273\240\260\240\370"
+	.ascii	"Q,\327\325\2214\026\357\275:N\374-\203A\357\365]X\237sj\r7\\"
+	.ascii	"\036\251\261x\207W\207\211/\264\003\0304\224\320\345\200|v8\023"
+	.ascii	"\272\032N\204\356\302N\267\333\341f*\200n\3267\236\037\237[\b"
+	.ascii	"\334-\227\002'\342\266\263\351r\266\0229\237\037\333m\207\302"
+	.ascii	"\306\223c\235\t\334\316\006\244\323\355l\265\362Z'\367\fY\242"
+	.ascii	"\232+f<TP\n\023\032\263\376\222f\314K2L\353\237:\255\n\210W\355"
+	.ascii	"c\316\365\343\212\030\226\342\354\330\204\203f\211`?\355\002"
+	.ascii	"\245\034\006\244P\211\231\325\035\245\033\310/79\026\237P\002"
+	.ascii	"\2641\257\237\365\311\004T\234\1778m\020!\352\215|\247\255"
+	.string	"T\f\354g}~\226\207\361\231\ru%\303\354OKt\316y\332\005I]\220\\\354w\246\216<\t\177\250qH\306\020S3$AJS\220\244\003p\002\231\2621;\021 A\310\234\320&)l\354\031\355!\274\n5\370\227\251\325\212\353#\r\265;\362\302\260\033\376\202\270\025\002\232\232\366T\214\324\243\246\256\t\312\235\376\263\237p\236\362 \271\007Pf\"\333\022\235X\245\243\307g\345)\330\355Gh\377D\242\236\021\006u\213!\223\322;\n&u\277\240>\233{(\323\201\274\257m\277\031\240\215\376\375\003\035\371\264h\021<\362\377~\245P\013!\003\027\251-\264\021}\201\2647bS\253\207{NC\333y-\201\273\327\225\314\371\324,\326X\032\353\210\374\322\030\001\351\240\247{VX\232h\007\346 \003\207\t3\224\004\316\203h(\300\255c\302w\344\227\233!@\275\"\346\356\322/\264\316\314y\215\026\321Z\033\371"
+	.ascii	"\023\003\347\211\327\0209F\360\032Z\005(\216\272\330\177\030"
+	.ascii	"^\377\006\326\301R\213&v\262\030S\001"
+	.text
+	.section	.gnu.lto_CSWTCH.20.62.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375 cU\002"
+	.string	"T\003V"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\005\001\006\177\001\004\003\003\004\002\002\001\001"
+	.string	"?\202\210\200(}\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\t"
+	.ascii	"@\004\334\201\306\200\b\270\003\215\001\021/7\r\240\b"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.part.0.65.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\325\013"
+	.string	"F\225K;01P:\320\247\031m\022\261\345\362\376\\hg(\037\250\206\272\277iH\354l\025PT\322\260\355\243\013E\205\345\233\020\026_\ne\240\233B\3553\016\364\241\353/\316j\367\2262\2459"
+	.string	"<"
+	.string	"8"
+	.string	"*lw8X\263u\274+\2617\205\320\020c\307\356\306C%q\355\232O\363s\005\016\356\343\271\276\364\207\"E\016\356\003z\016\370\003P\331]W\035nx\333\013lG\373\031\002\nR\273\033>R\033\2027N\234t\373,:~\311\021R\347\035'\031\354\346\341\300\2413\355\267\270\013\355\035\347\t\330\013#D\330\330\355\022\034\032Au89\001\310\341\273\004r\0309|\273\235\273\332\0222y\316\023\f\352\261/\343\246\215o\302\0244y\356\320\327@\016\257\n:\361"
+	.string	"\261\345\007\214*\264\006\016\223\306\t\345\311\036\251#\353\373[\025\331\232\376\223\004\233\353\201\332\242`,V\203\313\272T\270\034XY\304.\021\302\305\202\211V\226\211\224\002\306\"\\Y\234\200aY\214\330\316\277U\221_zU\343\003jS\0133\222sEud;@\376\005\006\2536\037"
+	.string	"\233+0.\034\202\365\020V\363\002,\240\007F\334\202\036\026\005>\330\201\020\243\tPc\340\370{k\306&@\024\fs\205\313k\002\353\321Q\b\306\363\244{\232.\252\235\316\005m\272\354\\"
+	.ascii	"8y0\217\323l\351\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`>\002\335\f"
+	.string	"d\022:\003"
+	.string	""
+	.string	""
+	.string	"\002+\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005> \200\204\001!!\201\002*\177\026\270\300\002(\177\"\001\"#\201:$ 7%\002=\177& $'#(%)\002\301"
+	.string	"\177*\204\002'\177+\272\200\202\002,\177,\361\377\377\377\003-\177-;.\002.\177//\1770\001\005 1\003\0014\1772\377\037"
+	.string	""
+	.string	"\200\200\200\0019\17738\17746\17753\17761\17772\17780\17795\177:<\177;\003"
+	.string	"\024\244\007\003\003\b\240\341\365\321\002\001\202\001\003\004\027\201\200\200\200\003\001d\003\004\026\370\331\376\005\001\244\013\344\026\003\004\025\321\205\222\030\001\244\032\003\b\030\246\242\275\t\001\344\n\003\b\030\354\243\341\025\001\344\007\304\007\003\f\031d\003\016\033\315\231\263\346"
+	.string	"\001\204\001\003\016\f\302\001\003\016"
+	.string	"\202\006\003\016\032\344\006\003\017\026\310\377\241\372\001\017\032\211\220\350\006\001\344\013\003\017\016\302\243\255\033\001\202f\003\021\034$\003\021\004B\003\021\017b\003\022\035\001\001D"
+	.ascii	"7 \320\002)2n\002\321 \335 \260O{\002bh\017\315\032\365s<\204"
+	.ascii	"\220T\bI:\270k\027t@\007\350\202.\350\002\235A\347\005\031\262"
+	.ascii	"K\261\244`P\302\030i\276\235\375\214\345<\257%xDA\001ila\352"
+	.ascii	"\231M\300\020\027o@\372\241e7Cj\016\343>c\2115\246l\255\363#"
+	.ascii	"\312\300\3200xLr\003\323\355\201,\303\317\221\337(-\370\004"
+	.text
+	.section	.gnu.lto_.refs.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375 \3675\005"
+	.string	"\342\216&'\200K\322\03230?\0051A\0234A\0234\001\266\303\201\360lv\233m\233J1\261k\237\264M\202\310&dK\231\002'\305\332}n\016eo0\266\306z\306\032c}\261\236XK\254#\232!\232\035\326\fk\2055\302\372@m\240l\004\335\202[`\355\254\231\365\302lKH\244B\267\271\023t\321\rH\332u,B\367\"\312\0220\366i\254\323\330\304\330\2041\200\324B\261\025\212\245\270\037\226\033\322\013wB\372\340~\226!i\245L\036\2212d\003w\326A\367q'\033\275#\002"
+	.ascii	"\003\030$b\203\371\004"
+	.text
+	.section	.gnu.lto_.decls.81b18b82bb274841,"e",@progbits
+	.string	"(\265/\375`\322&e\250"
+	.string	"\032"
+	.ascii	"\0259W0\nA;\351\256\277\372\031D\312\027\274\334\212\327\235"
+	.ascii	"\233\371\r\244\201\"2\367;\273\027\212Ga\301\021\230w\022\365"
+	.ascii	"7o\370~'\205\223\2333\236\223t\273\255\f\003\307:\266\251Q\241"
+	.ascii	"D\256~\020M0\243\274\240\245\347j\332\242\271kB8\274\303'D\022"
+	.ascii	"\b\"{\313\024\375\002\216\003\224\003c0\013*\263\2701bR2\246"
+	.ascii	"\013&7\035\374Q\215`\331\002\343\246\277L\353;L\203i/\035m\301"
+	.ascii	"\336\362\346\322}\377\201\346\314d\353)\370\254Y\023\245\244"
+	.ascii	"\305/\347,$\330UZOI\263\225%\267\332_\001\006-\330]\032PG\t\315"
+	.ascii	"R\352\026_\023\231`\3575\237\207\245fM\023\036\026\277\234\241"
+	.ascii	"?\0324h\320\260\203\247<\262\302&m\300\333\177\035\370\006l?"
+	.ascii	"\034f\003\2469/\273/\350t_\230\221\333\261LS\323\337\345\372"
+	.ascii	"\026\263\316@\347\370\370\264\340\271()_7\315\222^\3019\211R"
+	.ascii	"e}c\3119\343\320\340\272\272\262d}\263\255o\275\277\327\232J"
+	.ascii	"\347\3755\343z\334\264\355\372\256\243\025\032\357\025`p\254"
+	.ascii	"D\313f9e\202\224\031Sd}aWP\333\212\320\273\256\333^8\355n\332"
+	.ascii	"\200\006\262\246\271}T)?50\222d\201\335\364mc\275\005\277P\317"
+	.ascii	"\365[/\301g\315\225\311\226\024\277n\373\205\336s\335\244\241"
+	.ascii	"`h\\f*\331!`\231\204\005\241`\316\320(M\327\321\236k&O\241Y\203"
+	.ascii	"\206\037\232\254#\204Rj\332NZ\256\243\030\372\311\333\255\217"
+	.ascii	"|f\t\315\320\234\241;\367\213\360H\332M\237\264\2761\250\270"
+	.ascii	"\260\2601\2507Z_\201\216\273\321\373\262qv\323k\2606\\#\351h"
+	.ascii	"+\351\266\247h\317\254\22634\007/cPQr\323w\222K\260\314\030<"
+	.ascii	"\202\365\235A\335\351\f\352iV\236\366QoOP-\264\217\n\215Kk\264"
+	.ascii	"\234\247\032S\360\214@\373\254\302\005rf\346\234#\250q\016\326"
+	.ascii	"p\3364C\373\2503=A\355\"Bo#\023\324\246\023\232wR\033`\244\304"
+	.ascii	"n\232\366\004\"\177\017i\263\n\230\351\351\231\335r\206\366\354"
+	.ascii	"@c@\331\270\351\241\355\243\256=A\r\374\315\217Y\214\340r'\b"
+	.ascii	"\375\035\364\367\r\002\312|~\234\0012\367\001\022Y;n\317\337"
+	.ascii	"G.\317k~<\303\354\013\214\277c\334\235\377?\023\234\202\037\303"
+	.ascii	"\350\2728\177\243\335\233\277\001"
+	.string	"\257\215\2303\245\277\241\334\232\237\275\347\307!\374\375\323\341\256?\326\340\357)W\375\373\356\316|\360\267\210\377\246\177\217]\374\177\356\377\223\377`6\370\373C\226{\377\027\300\312\177\022W\376\333\317\360c\013\374\017\374\372c\250\337\037\023\376\035\346\357/\177\007\376\335\367\267\226\277\251\374=\3677\223\277\343\376\216\376\215\344\357\267\277\317\376f\373;\355\357\"\177\233\375-\344\357\262\277\177\374M\366w\330\337`\177\177\375\215\343o\257\277\235\376\017\376\335\301\377\277\277\023\360\367\326\337Y\177S\370\233\306\377\t\376\223\371\217\341\357\253\377x\177\033\340\357\252\277\241\376~\372\373\302\337\023\370\233\204\277A\374\027\363\367\003\376\366\340o\005\374\235\301\177\302\377c\376\243\3757\373\277\200\377R\376\347\024\026\026\026\376)\005~\032\276_\202\016\004\316*\3503\b\341M\217\253~<\205\251p\214~\366\212>(17\305.\360\213\216R\3000"
+	.string	"o(M\321\255\034\310\271)\250]X\330\024\324\373l\037\225"
+	.ascii	"=A\305RB\307M"
+	.string	"\235\251 ko7\355\301Q\024\200,\251\321uS\374\264zqr\265\304O\330\251\261|Y\352q\323,K\254B\0267\275\005t\267N*\r\207_[\336\2140;<\032aw5\324\b\257\230-\035Y\256\270\\\2777\274'\277\251-Q~_\356\240\013\245\265(x9\264\334$[VvzX\204w\357b\301\223\201\227\260\0227a\026\230\t\267\270\205\267\f^\201\363%\203\2250\363\216\301\313\216^\302\276\322\306w\223\2449\t\357\337\365\322unyIe\241G\330\0301\032h\274\204\334 \264\220\236FlP\320\355l\213\026\250\330\025%<\302\\0j\021\274\033tY\353i\256n\340N\030(/{R\2004M\267\013\016\031\225\024\030\231\365\366yY\257\362\255W\253\254W\227\254W\335\260\\\t\343\201\306\245n\007\247\314\020\274\254\233^5\262^\025[\257r\255W\235\353U\247\225COP\257\225\025M\232\334"
+	.ascii	"\254BE\275#\222\331\246\374R\331\331\021\265\263q\323+\245\241"
+	.ascii	"\024F\247\310\235\313\r\224\034[Un\372\231+\353g\346\346\264"
+	.ascii	"f\324\350\274T\201\"\027\324\367\244\326\026\2755\314\234\334"
+	.ascii	"&\367\311e\322\321+w\343~\247\356\022$\367\255\337:\257\353\234"
+	.ascii	"\013\020\342v\345.\334M\322un\037\314\214\310]%\235G\343\025"
+	.ascii	"\306GF\303\314\225Y\024?\233\264\363\314\216\3653W\353g2\222"
+	.ascii	"\232\275\300\031na\326\247]|\216d\310\031\334S*"
+	.string	"s\303\2602\233\300\231\265\261I`O\355\246\277l\377-r\215\334\265\324\310Y\225\277\233\252i\201\331\200\212\262\242u\364\246]hCo\332=\303\001\305\003#xc\305\217\256-M\237\362X\237Z\255?\355\243b7\241_\"qO\226\310\2305 \315\220'[nC\256\220U\006X\036\330Ma\340L\301\212\213*\365\233\f!\256\0267n\016%k40\370\205l4ua>\227%\275\031ST\027+JOj\306\255\241\303\344\311L\256\2500\241\254\253\325uN\236\314\\{\n\233z\336\032mkPfW\307mq\2372\227UX\316Yh\253\363t\224<YI\317)\3542\257\216\273\242\36304\214\246\215\353\352.]\035\027\3526\235\270\234@\256\217\373u\203\\\260\033vw\\\262;v{\\\261\313\343\376\270e\035\275:\256\213\337\256\353u\225W\307]^N\207\t\315S*\027\226\206\037\r\355\244\203l*"
+	.string	")\341\305\241:\025\261\362\343\246O\363z<\270\256\235\361\337zl\267\036\313i\275\363.\036\225'\245$\353\361Z\206K\243\206\t\315jE\\mN\314\326\343\257+\003.-\313\336M\217a\254W\327JY\345\217\317\371k\365>\234\234'\300/\312r`\271\351\277\334*\225\307\220%\215[\025\343\246\315\007_\222\233\302\270\031\243\3024\007f}q]\314\214\255P\312\202\262\376\"Yyn\363J\351h!\271\223\032D\213Rd\353\2467\252\267\354\254hji\255\255\277O\377eq\2314"
+	.ascii	"\305\t\222\233\336&\241_'\334d\267\374rS\r\206\254\330\257}T"
+	.ascii	"\006\200\255\034\332G\365\360\\_w\253\326\373\225!\234I\243\023"
+	.ascii	"\262\274)aMn\212\377nS=\203\203\023\323\271\332\262\005\367\375"
+	.ascii	"\004Q\002\276\020\274W\201Urp9\356\263)\263\364\007\247\305A"
+	.ascii	"\313\027\230\236\036\326\002\201\221\263.T\202:x]MNY\216\265"
+	.ascii	"(\371\320\221\004KN\031\027=\253=|\245\346y\225\266\214\262\327"
+	.ascii	"f\305\n\306\373y*\001=\214\365\020\373!\210\237`8!\273)\036\276"
+	.ascii	"\243\351\253b\205\356\246\330n\305\033\344\222\"V\227\203EG\207"
+	.ascii	"\251\374\254\231\b\027\021?\034\2452d\204x\3121\025%,\252\244"
+	.ascii	"n\212\245\334&\356\"u\344nf\013\314\026%c\326;\271\023<\327k"
+	.ascii	"oMd\031l\362\270\352d@9\236\273\200p|\317\233\342'\267\311d\232"
+	.ascii	"9\335\024\313u^MZ\034\224\t\213G\324\216,%L\336Q\314\244\305"
+	.ascii	"\200\310j"
+	.string	"n8\016Z\\\034\006\3132\027\266\212e\311Y>\326h\024\277\255\231B\325\237U\331\327^\027\222\216b$\270*\3033SY\360\361w\347$\347\007\023+\255\233\036\307\311\315\r\277\r.\351r\n\0369~\3231\223\363\033\2641\224\313!\310e][\303l 2\004=z\354\360h\301\305vS\266\006\254\3511\266\365$\005\212\321\2408M\315\271\241O\251f\332\331\031\366Z\225?\201g\316\f3b\177Q\272\334\3647c\353o\230E\212\374\251NnY^\364\231\2315\340O\306\\\226t9\313v\332\306\254h\263\262b!B\032\260\241Y\252w\330\335\246\f\037Bnz\033%k\031\256Qv\255\234L\233\257\037\035\305?:\257\321\262\224M\013\245\330\017\301\234\3476\354\200\3711\343\253P\354\035\305b\230,E\313.tp87\334\200\375"
+	.ascii	"\022\343\246x,:\005L\216\276\3655sa\035\305a\227\255\241Yy\303"
+	.ascii	"\345\314\271A}NQ\022\203[w\354\300`\235\363\230\262\313)\370"
+	.ascii	"/\307`3wd`o`_Q\374\325c~\240\231\312fG\217\346\334\206\0316\""
+	.ascii	"a/n\372\032\033\353;Hc\034\035\3058\032\355\247\237+\270\370"
+	.ascii	"\374rsi\303k\256V."
+	.string	".\354\265\346\234-\240\354r\226eg\263\353\330\213\307+\313\022\226\201\323\302K\217N\020o\355\340,cD\355\272\340\254[\345$Fu\323\257w\370\211\261\360\214c\032\3074\256U\347f\316\316\254\374\273`\211]\227S0;\233\031\276z\275\325\274l\346\234\251f\240\271\251\204\363\236\351\316\360\3474n\n\376\2479\017s^\256\225yY\307\224,e\334B\376L]\316L-\245\003\264\246\230ZULjZY\311\004S\3664\263\226\222I-\347\236\314d*?<s\017\223Z\236\312+\356\246:C\265\224\231\371\314=\231\231\227\026\230\230ZSLj\313\251\036&5\255\251\254\246\225y2s\331l\301\314\315\236\254\246\365\227\325\236S<Lj\317)&5\255\033\035\325B\253\b\225Z\031\027Sg11s\024\024\326\262\311S\307\004}f,9\267\333RnR\2203\326\263\211eY\325qJuQJH\226\317\246"
+	.string	"\245\264\365\314\314:&\262g\316dJ(2\324\005Jh]\306\321uJ\033X\371i)g"
+	.string	"@\345\254\354\\\227sV\346\234i\232X\320\234\257x\230\302\240\240rv\376@e,\345\222\245\234\257\233\226\270)&\265\255\247\320\0226\265\260\314\002\252\354\260\214E\253\271\252)\317\362S\316\271\003\327\260)\027\2007\305W\317+2mw\330*E\254Q\221\350\201\205\"\026)i\204\007\311\342\003<;F\026)\204\002\260I\"k\304\2128"
+	.string	"\021k4\036\207\222G\243!\fG\001\024t,F\240\036\005PrH\304\016\213B\2508\226\240\351\200\204\020$\2066\030v\360!\004\020\206C\"\206#B\364\260C\"\004\311\342\207\rZ\366\204\217\005v\003N[4\206\300a[b\021\322\bG\001\244\002\031\244\0029\201\b\251V(2v\220\f\321\203\301\210\370aD\bEFv\004\320\tc\261-\0225\340\223ddA0\206\320)b\215\307\266M\342 Y\334\341"
+	.string	"\324\"\211H@\0038\n \242\2411\t\031DdB"
+	.string	"\311\023D#\017N\030\213GH\342M{\304\266\311\022F$\2238\311$KtD\212`tD\022\221\354\021q\250\206C\005@ \206HL`\304PM2\311\"E\030*\201\205"
+	.string	"\006\354\205v\230\034\001\311\"\261l\t\234\023\261FEF\"\210\tNTD\262F\366\304\372\013:\034\240\203\007\0254\367\220\001\207\f8\250\367\220\201\220P\006\035\204\326w\020\302\354\2605\262):(\201\205"
+	.string	"\321(\351\2508\342\2108$"
+	.string	"\232\243"
+	.string	"\n*\"\213\220l\321D\2615\262EE\033\022xX\243\022D\022)Tv\310\026\035A\260a\213\216G);\f\241E\036\221r\222\306c\261E:\322\260-QDQ\022\261\304\312n\2408bmW$N\021\221\005aT$\222\340@E\213\203lE`S\024Y\"V\304\217\r\006\210\210%\214\214\210C*\220:'\220\222\303\023E\023\306\343\020O\362\001#b\n$\333\032C\264HGl\333n\320\026\215E\n\355\260\002\013h\332\243\250P\304\266\304\024\305\226h\203d\361&9dQ\020\265E\r\214`\207\311\244\226\330\216\370i\215\222\222,R-2\022\217\216\216D4ElK\304\"\251`w\214\354\0077&\2228HA\304\"i\332\244#M;L\202\260\"\035\021\3336\351\310\036\025[\036\23769lU\260\255\3618$\002\2334\036\221\222\254\210"
+	.string	"\020\031\223<@\262I$\021\311F\2551\262\037\020[\342\207#\"\222\210\204\223d\217\212$J@\266\254\b\025\304\243\034$\233LZ[\243\343\221\203\341L\tEDVD\262H\223\034\352\264\311!N\213<\212`D,\"\331\244M;\364@\203dM\230H*\241\266G\001D\341G$\026\031\324\036\217\310\240\233v\330A\2505\026\223\326$\213Lj\211\254\21159<\2320\206\370pD$2&!\037`\207)\206\022\\Hh\310\302\b\021x\300J\004tD$\032\262D\305\024l\021\0212\350X\f2\026\211GAD\310d\020\320\004\306c1\211dI0:\022\035\333#\022i\347h\302XL_\364\331\260\001\341s\273.\bW\037]\250\300\240\002\233\302oe"
+	.string	"\327\226\3344\215J\245\2366\2376o\332\304\205\205dr^\356t_\350\276\240\022\311kS\241\274f\272\2149)\237\322\322#V7\266\234\002\237\340\360!\3254'(%PH\312\2242\031\351\261\003\267\376)\013*A\366"
+	.ascii	"\013\227\360\246\300\200\212\335\024\n\201\023H\024\223,u\341"
+	.ascii	"\306\364\226*i\371\023\002FGaa\252\004\241\314Y\352\2512G\316"
+	.ascii	"\352\207\214\235\2621c0a\2200\2747\204\306\0262\307\204u+\004"
+	.ascii	"\305n\223F\352\257\253\206\327\340 ~\023\322DV\2063\366W\265"
+	.ascii	"S\025&\214\233\216\022\272(*\277/_p`\363@\225\364\340\302v\240"
+	.ascii	"/\302\224h~~8\360\347\211\365\216"
+	.string	"4\221\225\r`i\313\b\340q\340\027\221\254\203T\250\222\321<H\342\230B\206fdd$I\222\016B\n\020\004\203a\036)\256\007\022`\364@\220B\247\220\314\210\210\210$IA\241F\007Lx\272\325\362\032\200\003gQ\327\347eR\333S\245}Y*\013\203\260b,h\247{\021\324\364\260[\"\256\310{Q\006\344DN\332k5\331\350\310\230\360\0266-\325a\304\253G5'Ln\320\371\310\r\251\2345P\031\"\241V\364Th\345;+yV\310\321%cH\201IF\324\205k\233\026\317\225\364I*\247\302\327\033\220}~\241\032\302\373H\347\017\302\207\236\235\275 \303\270,\007\345\001z\274i[\253w\243\264\304\022\031\352\202fA\215\262\225US\257)\256RK \276_*\3031e\231-\033\300>\201\031\274\246\364\254P\222\001\351\017@#C\361\263\343\227\266\177S\347\251\343\240\026k\f<\254D\3663"
+	.string	"\235g\3009\232\003\216\311\020z\277\303\007\302\312\322\n\344\f\t\243\223e\310\0220K\337\020\376\332\235Jk/\212\242\005<\030\370\357\007\375O`"
+	.string	"\320jYu\372\341j\222\006\203\033\324\376%9\026M\246\251\253\215\224\227\256:[\320\342(\375Yv\304M\330\352\001\266\347l\243"
+	.ascii	"\223"
+	.ascii	"W\032\026H\275\306,a6R\234\333\031\265W\3416m\320&\034a\335]"
+	.ascii	"\237$E\024\321\366\245c\213\212\215\222\310\310"
+	.string	"\300\315\232\376\355Tg>\255\316\016\217\304\1774e|\003\212\254\261\016%\365J\030\027\271\225\342#\232/\302=\236\2747\355\260\220e\004F\205|\377\"\004\200Kr\343\264\016R6\320\177\377m\226/\350\372{\334\314\242\321\375\002\246\316\367S\3441\037V\325\341B\007\246\367\241\310\253\002T\264\201\017\333]\256\252\222\002ydR\003\336\311G\315\033\tp\337\364\351\351k\343bR\340\336\221l\344L\266\236U\313\375\264\253\315\271\306\302\376\211\340\336,\270\261^\371\330\327\3314\221\327\301\307\253\n~\371\357qc\037\\\024\210\030\245\302\0360!\3129u\2172\275\375\340cY\350U\306\336M\006\350\365u\365\213'\330\267\314\232\360\207\320\034\232\220\327\300\230L\357\204\236\325^\264!x\211\034\303@UA\023x\346\207\003L{\203R\021M\270\001\036\370\352\322\256\231\331\243\265\224\177o-I\232\"\033\317&S\330\023\023"
+	.string	"\377ip\237J\200\343R\301>\f\034\035\002q\231NVixx&z\316\f\357w\332n\334\017}\034\363x\271y\240\306 \311\021\253\f\024\235\243\251\227UeZf\363\220\250\017jY\202b\312\320\2330*B\353bp\013\372\245\3162\314\254\247\367k\227`\023z\365/5T\325\202\320\225\025V8\322\233\351 \317\243!\362<\371\301\253K\323\200*\331\226\270\256\036D\243\262\240\257rDL]\320}\214\243;\213ZuDbg\356r\343Q\350\343\260\303H\240\272|\006:\205r\016x\211\022\337\032~\360\20143\321&\315\250T\275\250x\007\231\351\215D8I\212\344c\344>dIQ\222\355Y\374"
+	.ascii	"\356\236\323kK&p\200\262\231x\005,'E\0368\244?\031\236\f%\373"
+	.ascii	"(@I\354A\360\301\221I\251ip\250\236\2235\237\343\240\037,!53"
+	.ascii	"D\316P\336!\035\366\236\\\017*\304\"\321\212g\r\177\341u\243"
+	.ascii	"Isy_\273\t6N\260\370\340\212\3508\r\b\264_w\255\305\314\244\352"
+	.ascii	"\303\273\3523\267\374.r(e\306^\004=\301\224V\r\007\300\346\347"
+	.ascii	"\020\216\320\313*4\360\251'\222\312\306\302Q\300\034\020\377"
+	.ascii	"\t\211l\250^%\004\335\301Jc@\024/\352\\\326!\346\232\214\330"
+	.ascii	"\005P1P\332"
+	.string	"e\301\013>yn=6\361H_\375c\251\035|\201\227d'\217\311C\330\215\345\262\375\354\206\335\360\330\303\312\241\037\202\3174]\031\362\365\376\214\342m\230\300Fv4H\261\302\220,\360I\266\3617d\203\213\345\324;\256\364\223\301\275\213\305<J\377\213?K\350\217\341r\n\004\306.\214={L\253\031\217E%\355\204\275^\304&\367\341\373\215\264X\t\205z\351;\360\326<\027\344kA\366\342J\210\345\026\304\352\242WP\233\202\307g\321L\002W.~`4!\234I\313a}\205\222\217X\035z\036K\347ZC\352\301\032\007\223\013\2117\201\277Th\003\005$\343\016\306\365\227\035\337\231[\b\242\202\017-\240H\036f\270*\211\004\317\272\256\313\030\006(E\f\363G\263\221\3153h\241\001]\246\276\371J\210\356\327\367\273\300\273\331\211\234\265,\215\3376D\303\274\200lI\325\274@\001\354_\373K|\243\b9"
+	.string	"\220j\335\302\205X9\256\350\002]\211\217\244\360\r2\3172\264\b[\321\344\247\211V\324\327\002\314w\2738\020p\n\332\263\177\364'\177\253\202\032\312\005r\235\311^\312\206\365=x8\207\246\302\244T\004mr\274\235\220K]]\374\317d#(h\311\344\221\261\013\363r\340\006G\351}\234*\225t\211"
+	.string	"\210Z)\0132\212\020\036KE\325@\005\033\363\f:H\323\337\035u\270<c\007\331\335\223{\323\365\256\002*\377\2421\206\210\016C\323b@p\277\034\247\216tg\342\034\316\225\006|v\210p\332N\203\247\340\303S\330;\035.\305\233T\320\246]8P\230\362\370\313\210\215\332\\\265\232\276\247\013U5N\320\210xi\376\221\251\360\3500\320\032W;+4\026x\037=9\3377\312\021\300T\364s\254(y_\213\354MS\032%\t\023\350\202\357C\352u\220P\340\007\326\364\340\004\214\271~q\241\013\t\024\3263N%X\312\271\3171\204\253\336\234\322[\357\373\266op\243\300X\221\317\"F\252\332T\031\336\303\357\345\275\274K\271\236\017\302\216\353\373\352\230\361\370\205\316\027\217F\265\362\202\375\203\037\031\2771u\\\020Xe\204\023\337\307"
+	.ascii	"'x\035tz\271\277\341\275<\273\361\311\365Q\344\310\370\027\337"
+	.ascii	"\226\3467\353_d\217\336\025\346U\275\316L>K\336\351\177==\021"
+	.ascii	"\305~\325\360W\016|\234\373\324\272T\335T\023\375\220\355w\317"
+	.ascii	"\246\301\214\f\333[\321\027\323m1uj\277\255\035o\247\021k3\177"
+	.ascii	"C\237\212\335\305+\211\307\263\327\345\240\306\227\274g\377`"
+	.ascii	"\253\307\177\371\263\372\016\215\370\267\301\036z\370\236\314"
+	.ascii	"\244\363m\2402\016\232\332\345\307\373H\365\201\363\231\277}"
+	.ascii	"\275O\273\202^O\033\357D\352O\341\242\217_\375\200\335\310\266"
+	.ascii	"\273\217 \311-*\351GD\326\n"
+	.text
+	.section	.gnu.lto_.symtab.81b18b82bb274841,"e",@progbits
+	.string	"camDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"isButtonPressed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"rcdeviceInMenu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"waitingDeviceResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"rcdeviceSend5KeyOSDCableSimualtionEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.81b18b82bb274841,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
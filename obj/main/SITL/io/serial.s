@@ -0,0 +1,1260 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\033"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"}\t"
+	.string	"\242\317<:@o5\006\f\tws.b\0050\244@\351\006\355\300_a\362\031\324]\310\276\276\311\260n\246\354\321&\306\031\206a\030\206a\030\206\377A\202v\227\273_\be\023!_J\"2Uw\0373\264\240K:\220\243P\357\210\206aB\335$\336C\ta\313\235\016\b\321\3013F\032z\fr\356H(\263\200`{\375fo\317m\r\023\n\313\200v\353\345\230j\021\300\3072\267\307\337\317\333\3440m\004\\\347\211f\303\035sR.J"
+	.string	"}\275\323t\224\332\262c\327\327\277\rg\305\204v\022$\252d\364\357\177m(F\317\256[b\004$\"\303\364\365\353\371\366\226\006\0221\311\2704T\310\007f\335}\314\020\306\307\177\366<\021\264\216\225<H$\246:\275\270\234\256u\314\217}\254\214N\233-\320\316w\355\377\372\352\365\334v(?\262\252\231\b\025[*C\2554\001\027"
+	.string	"\026+\312U\201a\212\3462\367^J\334\0340su\002\315\336\346&+mY\025\215\205\200\310\034\206\313\215\224&G\311\265\0225\315\211\nl\271b\327\314L\264\353\243"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.ipa_sra.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\245\005"
+	.string	"\002G\023\031pk\322\0010\377\377\377\377\377\377\237H\377\377\377\377\330\2725B\210\334)\005\256\272\242\013\323T\363\365q\214\230xc\214\271P\354\"\324\303\374\036L+Z\317c\255\323\020b\2600\t\003\335\202-\260\002l\275\027%Ih\333\375M\370#2 \240\0021,\017\f\251\006\030\240\f\306a\360x\330\007\313\264E;\032\r\030h`\"\212%\2001\207\013\236\310\364K\034\016\235\b\241\225\200\277F\372\003}\003\347\020\036t67 \335\343\302&\210\273\"\034\007#\340\003\316&\206\005\315\026\371\n\366\r\310\327\356\264\016f\f\331\270r0{Z\333"
+	.ascii	",.\324\020"
+	.text
+	.section	.gnu.lto_.inline.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\213\004u\027"
+	.string	"\226%\204J\320\016)\035J\034\304`<\253\355\2113{\346\013\013\177=q\240\343\335\036\336\206\304\345\233C\333\005\210\251,\034t\360\334\340\334?\250\314\255\254\346\0328\364\032\263\310\325\214\234\023\013,n\241hf\006\303\226\234\214\330n[J\231\002n"
+	.string	"j"
+	.string	"v"
+	.string	"\234\362\3715\341\bB\277%\326[\217\341\366\373\261i\375Sk\025?\326\330\211\027\214)k\374\202\027\214i}#\2447\376"
+	.string	"\354E\271N8\t\330\213\022\257r\241\377I3\355\232\202\\'\rc\327\024$\276\037\303\365\377\326\244\261\214\026\244\025\256\277\3268.L\025\004\240\260\205\333\320\216\310\367g\372\253\324ZY~\376w\306\265\326\332\377\353\252\2255Q\005N~"
+	.ascii	"\321c\270\307p.\325w\354\377,"
+	.string	"\3647\351\337\211)\r%\177};\037'\220s\354\205O\231\r\375T\3609c\031`\356\206~\302\016c`\216FiO\256\376\177\360.\333\206\226~KZ*Gcb\274k\032\370\234u\221T\220'~\222\347I\236\347\202\316\360S\364\264\017?\351\177\017\336\375\373\035\"/\003*\006[\262m\377\225M@KN\331\376\326\032j\246\347\tv\020\240 \bH\253\033\f\005\020\033;<#\206X/\351\303\277#\f\037\3168D\355\231!\236\274\254[nA\025\223\345g\002\t\035q\376/yw\267%78\b\257\354WK\200\226\354\340\035\224\231\362\031\371\307\307.\341\227\034M\222Hc\fG@ \326=:J:\207\005\224R\370\243\360o\306\210'\326:S\001\177\f\267?/9YL\262+\022\026e\260\375yl\031\303H\225\317\377Ao\350\351$\220\363\305\353a_lk\004\364\3056\236\337\224\346\325\360\2418\360"
+	.string	"?\213\037\366h\234\023\203\203\321\004\022\341\342'~D\344\277\214\271C*\216\256\306\027\242\243\253\361q\034\300'\215\205J\334\330\270LZwD\003\206<y\032\327[\212\026\263.\275tH\"UD\001b\250\2414g\b2\020\221\b)\210j8\220\"\232\251*\017\022\300\345`\212\274\350D\202\n\nJ\312({H\370\304x\240f\231\321\304Km\326\207\344\364"
+	.string	"Pt\275-\265O\355\305\227\2547\221pc\313\331\350\246\345\256\275\224\330S`XN\377\361C\256i\375\316\263\331\200H\376\352@V\307M\306k#Q\031\365\022^\343\356\026\227(\306G\224r\325\264\242\342\003:n\324\323\344\177 \202\276\371\303"
+	.ascii	"E@x\251[\263R\001\351\377M\006\230h\250[Pp\004B\317\372\204\036"
+	.ascii	"\341\t\003\035\327\221\021\261A\f\352\225\374\323\226N\234\367"
+	.ascii	"G\331Y\004]8w\f.q2\017\016\032\217\314\305;\f\203\257\215O\022"
+	.ascii	"\006\223\302K-G\026Wb\327Ne\210\"\003\247#f4\203\213\352\307"
+	.ascii	"\351"
+	.text
+	.section	.gnu.lto_.jmpfuncs.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\206\002\r\013"
+	.string	"6\2200,\200EI\007l\306B*E\225\2701`\024E\332\3350\272\004\r\t\f8\316k\217Pk\255\265\375\315\265\210\333\b\370\026m\"wJ)#"
+	.string	"\""
+	.string	"%"
+	.string	"\347\345\272m\326\200\022Hli \262\302J\t 5\324\344}\024\366(e\371K\366Q[\206\311\226\013\242\210\235h\342\313\307'h\355,\377qh\213\324\362\031\337i]@\276\222\324J\222\313\333a\224\350\264\326\032\371\bV\214O\\~<\364\363\257Yp\025\334\206\233\340B\334\3453\377A\242\001\017\317\026;\360\303\340G\324ZK\321\214\234\275\266\362\026\376\302W^\224\227\0068\b\031\246\257H\266z8\310\006c\220\223\t\204#F\211\371\ff\323:F\250A9uff\222\202\026\026\2261\200\002\031\033+\017\021\260<F\234#\201P\315-\026\003#\275!"
+	.ascii	"\033qdA-\230\257\274Q\357\352\223\225\274\316\330K[`L\024\325"
+	.ascii	"Y\276\b\327\361\247\253\217\321\361\243\241\367\2327\026\237"
+	.ascii	"\247\314!\373P\241-q\320\\R\247e\316\362\302<\242\205\034\236"
+	.ascii	"\354\215\374u\366Hf\016E\270\022-\036m\027\016k\241\305\2172"
+	.ascii	"\217\244s\205\225\332 \342\365\217>\320\177\372\330\033\240\261"
+	.ascii	"\257\223Q\035z\273\025\214\023:\036M\347*a\013\t&B\031\225\007"
+	.text
+	.section	.gnu.lto_.pureconst.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375 F1\002"
+	.string	"B"
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\200\004\001\232\004\003\200\004\005\200\004\006\205\004\b\205"
+	.ascii	"\004\t\271\004\f\030\r\205\004\016\205\004\017\205\004\020\231"
+	.ascii	"\004\021\205\004\022\205\004\023\232\004\024\232\004\025\230"
+	.ascii	"\004\027\230\004\030\204\004\031\204\004\032\270\004\033\264"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\345\007"
+	.string	"B\f&+\220)\031\0160\317\330\377`;\312\344\177\030\256\337]\342e\256j\261\234\025=A\375\320\327\243\327\b!\334F\n\242\335\366&D\312\0247<@0\250;\255\351\227G\013\242r\005\2029\260\360\252h\035\357\267\270G\371\244\215\232\366H\347\244}>C\320\3438)\241\034\241Sj\005\224\346w\312%\365\032\3008\246<\350\224\224K\332\f\0020F\312\277\361\270\224\003\225\205\002\303EL\334\332r\363\326\206\312\330\222\230\253\307~\363\276\262\200@\346<\252\262A9\221\227;^\317\213, \240\202\231\233\362\343I\214\021\302\305\320\273\022\374\226\321\265\241\260Z{3\264\374EY,\262\376Z\215\016\354d\271\205N3\304\210\316\242\313\222\345\332"
+	.ascii	"\361\005\230\347v\357K\206\001\b\357U\210WhUh\013\263\320\202"
+	.ascii	"\207\301t\204\\$\2039\347\351\035\333l\233\233\211B\227\346%"
+	.ascii	"\372p\363\0330\034"
+	.text
+	.section	.gnu.lto_.lto.69a8404a04ffdbd1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.32.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.34.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.38.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375 \222\035\004"
+	.string	"T\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\203\364\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\006us\375\005uq"
+	.string	"\005\001\006'\001\344\r?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.39.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`$\003\265\024"
+	.string	"\326#\201J\300\322Q:`P\200F\003\350=\274*\240\373\033\235\260\007\247\2005\311\337\0025\016\00444\311\002\221\224\3152\232\331\372\304t\3059Z}\250\026L\306\"\223B\030\032\030\314D)\302K\217\372\374[\332\205T&\302\310&{\247\024h"
+	.string	"e"
+	.string	"q"
+	.string	"\017\222\371\200\335\035%\033\273\244\003\233\210\257&_ |\025O |5\315\216:\331\263/{%`\374vw\244),\036$op\322^A:i\276\320'NR\371T\224\253\275\202#67N\001r$@\227/\b\212\232\334m\202,rN?\364\271\243\272=\025\345r>G$\354\256'.\207s\207\267\035\3026\004\233\276\004<\333\274\242\224\310\246jG]\247\233n\244\260\365Jm\021#\346q.\001\"\253\244hh\315&k\223\362\330w\371hV\230\356\330\254\007\375\365\345=\347\364\005\244\334\374|\bz\354\232\270\262\332\245\312S\361\362\366I\177\310\305_\320^\372H\254\335\210De\224\324\356\266^\375@|U"
+	.string	"\236\304\366\247\375\237\003\321\002\237\224Ect\250htn8n\247\334\007\323\322\256\310\317\031\256\224\204\304TD\007j\370\016\0359~\365*\241\275\3417Tx;V\315J7uj\257\274\006\213\t\024\215\027\203\236\335u\275\332-7\202\211\273\033a\006L\007\003P>2\341kh\204\023b\233W1/r\021wg\\~\214\313\210\201\367y5\210Yx\334\253?\243\037:\330\242FU\025\260\267\3008\274\304&"
+	.ascii	"0\313\211\207\025\230\3545\033c\260\361\005\266\3422\262\310"
+	.ascii	"f\343\311\001\307>\274d#L,&\033I\310=\3351\205!K6z\263\233,\034"
+	.ascii	"\bJ\t\tN\222\216w\341=\025\261\302\211\037\235\237)\333QB\033"
+	.ascii	"\303\237P\0268\275\022\374(\271\320[\276+]\245<\036\341AY\224"
+	.ascii	"\366f\353\223\326\370(\234\364Aeof\0229\270\273\0136\bB\250q"
+	.ascii	"L\302\2242\025\b\211\210\310\204\005\315\003\340\002\2219r\003"
+	.ascii	"\021`Q\025\220\310\220\251G\213\001\255\240\004\306\027Q\351"
+	.ascii	"\021\024}Pw\037\211>\201\202*\326\0068\"\237X\006\361\340\213"
+	.ascii	"\321I\254\037\364\336\376\262\244V1\203h\272\326\341\326\210"
+	.ascii	"\334F\272;\316\343c\333\303Dbc\022\253\323\022AH\320\033\336"
+	.ascii	"{`@\206M\007?\374\325\251\315\304\267\216\263z\361UDn\256\006"
+	.ascii	"\324\033\2551\232S\277\203\345\350\020\244.?\215\2110\200W\003"
+	.ascii	"\251"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.40.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\223\001M\020"
+	.string	"\306\236mF\360\316(\035B\306\355E\263 k\205\355h\356\356\177\374\341\r\273f\206\001\251c\237\363\024\233\207\3434-w3\374\304gJ]\355`\317=|\253\320q\270\253\340\247\361k\254\242|\235\344M\351\373\202\020\262\367\226;\245X"
+	.string	"W"
+	.string	"Y"
+	.ascii	"\3632^\300\274\\\027\007x\254\367\204\247oS\306\205'\377"
+	.string	"\344[\334\235\021,\031\237*v\264\\J<v\310\372Pp\306\254\\~\274pV_\206\307\330\001\373\320!\343K\211\013b\246\363\371Rp\037;\202\227\332\352[9\334<(\245\206\253\017\303\315\3356\3136\003\373!\002\247\3717C\313\327;\276\336+\241a\204>\200\317\206\035\r\036J/\324`P\0232\307\303\353o\233\374\230?V\320\300\364j\302Q\230m\346\202\251\240\264j\\\332\203\3604\025\334Q\312B\023AiM\340\003\334\345e>c\362)V\016\337\226\"\243\262iAi\365\f|@*-\024\254\301Y\214\013\r2n\334]\226\275\333\355\307\013\247@\255\321\211\353\362\266pI2\024)\370\302\302mD8JS\034\276\3545\243\370\327\245%\224\346W\227~i^\302\355r\342~\037{$\361\232\251b\240\300\332\356\260\200\255\330u\331\365\004\236\343F\345\204\267\305\035\027\024B!#\"\031*\001=\b\231"
+	.string	"\202\300\031d#\002HD\n\225\274\221\310\033\021\201D<\020R\311\333 \340\021I\210\344\225\214F$\257\322o\213Ih7\323?\315\307\336\301\320Z\261[)\327\036(\213\342\331\326\345\005=\222[\271\202f=\205\254'\005_<RJ\351\\\327Mf\\\316\301\314K-  0\002\202\234U\035h\t\376\\Km\206\327\236\272\344\f\273"
+	.ascii	"\324|\301\345>\271\005\013\001\210f\022\026\367\345aC^a\017m"
+	.ascii	"\013\272\345\311m\203\237\004\226@\300\375a|B\023\017\374\315"
+	.ascii	"\260%,\301)\202-\004\256\261\207\262\342\033\235\366\221\001"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.41.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`}\001\335\017"
+	.string	"\366\035kF\360\222(\035\022q\347\326\244\212\036\036\t\334j\b_\224\370\353j\352\376\223\264\273\205\200\034\377\025\250\241\n\177\355\327H+C\fn\035\220\364\321\234\313\342\260\310f\216\263\022\013\360\026\276>Q\377WO\310\336[\356\224\002W"
+	.string	"T"
+	.string	"Y"
+	.ascii	"\361\002\346\245\206\360\366\b\273',]\2332*,\371\246kQsy\321"
+	.ascii	"1\362\265D\023 ?b.;\\}(8Q\300\\:p\331P}\035\036c\003\027*F\214"
+	.ascii	"|\030\242\312f3>_\n\352eO\340\252Q}0\207\332\311\356\032\252"
+	.ascii	">\016\367v\333+\333\f\354\237\b\257_*\264>vC\b\375"
+	.string	"\355\363\302Q2\333\335\320\303\2637\344\215\211\307n\037\346\313b\306\331L/\333\214\206\206\316\356\222\\z\301vy\273d\177\340_\027\f`W\206G\306\356\226\370\300vy\026oQ\262q\"L\304\367VM\013\315\220\335\345\f|\300\274\f\207:e\nWM\006\020(\330\003\265\204JH\016\031\025\252\246+\027H\235xDmY\352\325\233\331\221\202;\026\036c\302\266\2332\361a\234\206\024O\342\322\024X\346U\227>\313\274\274^v\0042=V\334\234`\217\316\\\210\330\250\266l\230\t*\313&\210\006\017V\226\255\315\007\025B*\242Nz\241\356A\267\"\n\251t\001\234\002\202\200\322y!\0227\3528Q\207\022\201K\361H\034\210\200G\022B\036\2672\032y\334\307{e\371/\276\351\324\3601Aw\324TU}rR\324\007M[\376\304\310\251\232\003I\016ue\234\t\365EfrRp\347qww*\b\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346\027\025e\353\3514\030\322"
+	.ascii	"i%\307x\204\233\307,z\346\255\002SP\3278 \204D\t\341\230\361"
+	.ascii	"taK]PS\344C\205\373g\0062e\t.ET\013\201Ac\257(+\324\215N;\311"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.42.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`1\002\265\023"
+	.string	"\326\245\205I\320\322(\035\322\270\017%#\226`\025\345\373\240\344\253&\262\n\327\317\314\206\230\307\334\247\275\314x\376\370\"\020!V\017\374\365\207\024\347\320F\340\367\351\305H|\301\r\324\223\315\242"
+	.string	"\005\254\260\233e\264\003\376\243\222O\366\226;\245r"
+	.string	"l"
+	.string	"r"
+	.string	"\007\346W\234\205\314\263\002\272\234\232\224\013\022L\017X\253Ne\335\007\204\247\342\005\204\247[\302\342\247\356\016\345\354\247\220\316\2253\237\345\247y\222\241\3111r\203\231%KI7\347\321d\230\302\346\264B.h\273}\370\234\021Z\354\230\030\271\271\314\335\375\204\356\273\214\271\325\344\236w\031\304D;\352\271\331\\\236Lj\255\226\266[\315-\336\366\315\266\211-)\0048@?<\204\360\342\330\250\353~1\2644\375\356\236\357\335K\245\345\224\276\210\005\035\340\022\211P\2553A!\365\006\rB\361\336\277\273\264o\377\205\357s\312\357\315^_hP3.= \210\247\267e>\317)7p \373NE\254:\247\037n\207R\255\272\004\247f Ji\237\347.d\327\255\314"
+	.string	"\265F\002\304O\255u\201\021\210\247\0012gc\302A\027\347+\r\021m\270\27316Pk\3411\027gq\345\302xH5\331d\033\303\177Vh\021\220\235Z\353\003\037\024"
+	.string	";& \215\327\230\205\247ri\021\020\025<\276\214\231\202\034\233\355\016\357A\221\220Sk-\201\361\030/\377\304\2517\304\344m\247~,<\rw\215l6s\277\367\235\002sI0CZdp\1772A\200vq\266\216En\255\224\025kd\271V'(\016-\226k\244\260\326xaLq\265X\243\210OH2\254FX+\246z\215*\327\270BQ\235\300b*\022\002~ih\301T)\257\027L\225r\375\342\370\274O0j\372\371\204\237\361\373\216R\032\"\232\273\224\256MZ\226&\342\2648\243lP\324R\233t\314}\360t\324d\323g\255\265\206\213\273J8\027\265\347\235\336\344\216^F\320d0& 0\002\204\030\324\035\037\202\230>C\301\335NR\352\357<\265"
+	.ascii	"\024\016 \270\341\r\026\331\027^\354-\2561\230\200\023.8N`\001"
+	.ascii	"#+T\366p\310X\3207\271\031\r\342\230Q8\032`}\361\324\351\203"
+	.ascii	"1ru\371&\311\002\310\024\036\347\215[`J\255\324:\002\312\032"
+	.ascii	"\234{\265\357\t"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.43.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`'\002=\023"
+	.string	"\306d\201H\340\322&\035\222\022\317X\233\335Z\031 \022=3\346\beC\302\252d\364\177O\326\037\332\222\246\tx\337\200\375\360Hw\260\216\302\202\344\225\034\026w(\004!\n\302\3608\304U\360.\307X\356\373\370\034\221H#{\313\235Rm"
+	.string	"h"
+	.string	"m"
+	.string	"*b\314*0\366\350\214\324\bq\261P\252u\374<~"
+	.string	"w\332]"
+	.ascii	"w\272#\334}\2167'Y?qt\256d\3712?\315\323+G\007\211\350\232&I"
+	.ascii	"G<\237\321H\016\305\316i\005\031Q(z\370\234\020V\310H\220\210"
+	.ascii	"5s\201lD\257]\336\210-\271\237]\016\335hFA\342\316\345\351\244"
+	.ascii	"\326j\031\212:ww\333\242\355\023[N\braB@8\200\360\302l\357?\177"
+	.ascii	"\307Y\232~\274\347i\367Ji9\245/\342\025\315~\024}\370\216j\305"
+	.ascii	"\2715\325\033t\310\347\264\177\274\264o\037\310\257\321X\257"
+	.ascii	"69\036\216k\303\203\356\364v\214?\363\210\0314\210\371\370\322"
+	.ascii	"\325\023'[l\bR\255#\202S/\220\362?0\017P+\254\251F\255\243\002"
+	.ascii	"\037\350N\237\342\001Ap\320\215\371HI\257\345v\367\306\006Z3"
+	.ascii	"=\346\306\334\255\334\025mGK2\331V\371\f\030ZTS\252\265:\220"
+	.ascii	"\001\002\240\325d0\036\203\305\235\312\245E\265\245\037\377\005"
+	.ascii	"+AOh[\303]\200\021zj\255&-n\303\340\22785\213\213|x\352\273p"
+	.ascii	"\247\334n\216pg\356\367\265S%\231\3155dF\336\326\366Z\022\332"
+	.ascii	"\215\331\243L\251\026T\212*e\005\205\342eH\245\254\250h\313\n"
+	.ascii	"\244 b\224\022\013(\325*\305\362\201\252oE\205R\371PV,_\t\001"
+	.ascii	"\203\027R\253\257\005\004W\337\210\353\027\346\317.\301\250\203"
+	.ascii	"\215\006\367\240\277v\017)\3515w)]\237\314,M\210\323\306\354"
+	.ascii	"\331\240\336\322P\372\346>h<Z\222\351\263\326Z\271\215\375\205"
+	.ascii	"\233\353\355g\247<>7\033\0214\362&\327D\030'  \002\203 \324\035"
+	.ascii	"n\315\177\bw\372\f\005w;I\251y\347\335\002X\370Yp\271\013\206"
+	.ascii	"#\330\213\316\2106\006\333 \257\013\300\tD\300\276\205\312\016"
+	.ascii	"\207\210\005}\223\233\361\020\307\210\262\321\200\346\r\r\004"
+	.ascii	"Q\220\362\023\232p\340o\006\262\265\004\247\b\266\300\\\255\334"
+	.ascii	":\002\312\232\316\275\332\376\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.45.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"]\t"
+	.string	"\246\022C;@\305(\035"
+	.string	"\274~\025\335]h\355#\376n\330\361\345\013m\370r\273\351\031M\341%\307,\231>\221i\rR\326\310Z\337\230\243\350\344\214\360\020\b\027<~\277X\"\214\333n\231R2"
+	.string	"1"
+	.string	"0"
+	.string	"%\204\251Be)\r\214\325\200\335)=op=b/\270\036a\352\245k\311\277\3111 !"
+	.string	"\276\223w\035`\330]\353wB\335\360\2667\2669\266\t\004V\307\317\037^\231\027\001\013\255\335\214V\201e\305\226\017\333$;\263\255j\237\344%\244O\n\023\354n\264Vv\247\2027\330\243\006c\333\027\371\b\311\001\3203\246\277\003\\\t\377\311S\272\214j\327\364\317G\371*\302\367x\264\250\323\177\217~'1\241\377\254*,\254\013\350\331\323S\330a\037\263\220\303\016\241M\033yB]\003f\017\347\241\243q\037\221\3344\031\322: \351\341D\222s\340\r\342\303\311\321\266q2\233{G\2501\301\ng\n\241\355"
+	.string	"\322\177\021f\\X\026\001\n"
+	.ascii	"2\003\302\260\343\216\213\367\320\226\01398f\217\003c\017\332"
+	.ascii	"}RRL\327$\003"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.46.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`{\002\255\024"
+	.string	"6\246\207J\260\324Q:x&\244\2511\311\211u0q\340\006\245\351\217?\3723<\376\005\237\206\202A\350\215(~o\017\035\372\3414\273H\326,\023\255\267\037\253\267\376\240\177\363\026W\261\245\033\351\255\347\366a\360\021\244\233\232\020\262\211\334)\005t"
+	.string	"j"
+	.string	"t"
+	.string	"\341I\2351Q\203T+\257\201\021\220\247\006\302\007\375\205\214i\003x?8+\237\025\267!\252Zy\245y\017 \236\222\007 \236\256\217\351\244]\244c\270\223\346\203\270\310\312\321\274g\233\364\204E\316\307\tA=p9\235\207\341\003\030\272\023\254\334-\\!`\360\277\317\232\334\314\334\367~\240E\320\327T\224\313\371\034Wj\255\236\270\034\316M\336v\b\333*\366\004\n\342\270s\377\273\004\244  \r\t\333\254Z\246 BE\273=6\3176S~\354@\341\345\261\317\373Y%\236&wz\024\247Eq\232\322\3510\234\336\235\236\367\3357\351"
+	.ascii	"E%\304\301T\2557UF\252\017\232\004t\337\355\013\371?\257|\037"
+	.ascii	"\355\225F\004\311\215\217\016\252V\336\202S\227\344\351m\031"
+	.ascii	"{e{N\373\273\307\2209\357C\342\316|@ff\021\263\226\256\270\341"
+	.ascii	"\323mD\270t\177;b\n\307Q\2012-\351n(\265L\242x\350l<\211&\236"
+	.ascii	"\206K\231\226\\\354\374#\032\003'\234m\0177\262p#\225\013\257"
+	.ascii	"\321\202\3404\3434\\\257\226\026\361\264d\367\t\2473\356n\201"
+	.ascii	"\241\333\221\2716\354D/o\372\251\265\246\370\300\313\310\340"
+	.ascii	"\2538\265\213l\036w\352\313\304\323\343\206\324f\225\377\227"
+	.ascii	"\257\230\026\013\214%\326r\221\304d\260\030W\214\003\006\322"
+	.ascii	".\024\r-\330\354\005S\312`e\f\326r)]3\230\022E\200e\033^\263"
+	.ascii	"2F&\233\225+\327\336{\204\246\035\360\210\036\351\377\235Dj\312"
+	.ascii	"&\374\222\344z\245\266\266\024\342\366x\334\022\276%\035/d\216"
+	.ascii	"q\337\273\002\245 \221]mV\205\265\326J\267\307\377\022\355\360"
+	.ascii	"\004\307\345\361\245\246l\266d\2775&`\264\023\025&\020\0031 "
+	.ascii	"P\202!sV\007\241\207LsWbkz\232\021\245'la8B\260\002\324$L\304"
+	.ascii	"u#\371?\212;\351\024e\026v\247f\374\227\251\222s\021\360\272"
+	.ascii	"\222d\371\035\020\350\237\243\270\033\030\021\367\310\250\201"
+	.ascii	"\003X\0021pP\023]\343A\222\035@\243W\204z\312\b\031\024\213\274"
+	.ascii	"J\201\307\251m\371l=\fU\211\216\3146\222\202\343a\f\217\326\354"
+	.ascii	"\271W\033\236"
+	.text
+	.section	.gnu.lto_determinePortSharing.47.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`U\001\025\017"
+	.string	"\326\234gF\360\260(\035\273xnc@\207G\215\203%[\327\376`4\376\376@\2464\351\365\033\373\024\352\223,}J\253\375h\362\024z\275WrB\030\336\304aqX\310H\241\34498\214n!epJ\256\321I#{K\231RV"
+	.string	"P"
+	.string	"T"
+	.ascii	"3\344@\376\241]\306\027\320.\367\345\3375\031W?\337\003D\271"
+	.ascii	"\366\3412\202\300\320\001\001\0023\304\003.\225\234\030\027\254"
+	.ascii	"b\260\200\300T\374\300a\335\370\200)\272\321A\214\212\n\020\210"
+	.ascii	"\212\037\033\235\022\207]W\300\024U\217\310\234\323\252\001\354"
+	.ascii	"p{n\273\263"
+	.string	"\r\301\376K-\3734\277\347\341\035\245z\245Z\243\372\233\200\025N\204\027sr\230\355\2302$\013\030\333&\373c{\3654\030\342\200\231b\3154P\265/\363\031\323\303\223\023\230\263\265\263b\316\220\201\023l\227\0167\333\376\353&L\376b(\002\364\344\330\250jr\314\353\322ox\331h!\267\025b\365R\226\031\036hD\005\332\356c<\253\273\253\271P\265\240t\346\257\356U;'\235\331\366\216\302\3026g\352\201_S\"ms\316\217\270\374\"\210\311\234t\366e\2218\021[\237hr[V0\260XJu\330!\212\256\313~\234\033\"\257+\205D\027J\266\t]\211\310\223P\032y&\036\016\205P\030\351F$$\316\3538Q7R\201\013\215H\\\210\001{&$#\256\344y#\356\023\316\307\271-\337Ev\243Oq\215\377\247\005\250!\303!\365\237v\330\001\270\310n\326\377\264\270+\266\343Z\344\264(-\032"
+	.ascii	"]\204\036\230\005\3102K\2001\260\001\2521B\r\200P\270(E\3030"
+	.ascii	"\020D\035\215\273E\020\220\025\222kx\303FJ\023\361\306\026N\022"
+	.ascii	"\362\201\271\002\025\016\356\n\322\006\247\020Z\022j\207\n\246"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_isSerialPortShared.48.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\233\001=\020"
+	.string	"6\237nF"
+	.string	"\261&\035;7\240\bP\323\243\007\247~\371\002!:\005\326\326\336$\257\013H\216\177\353\205z\030W\247f\272\002[:D \232P\321"
+	.string	"HPAw\017\205\265b&\330o\330\335\263\253\266m\332\202\330\275\267\224)\005Z"
+	.string	"Y"
+	.string	"W"
+	.ascii	"\321\337\013\310\307\354 \362\321\266\0338H\331\345\237\b\232"
+	.ascii	"\333\304\210\331\3211\347\247\255\315].#\\u\361\337\363\222\033"
+	.string	"\234\0312\254\227\313\016\217\033\024\222\346\234\"\326J\027\202\264|`\001X\032\240\b\354\365\341=\327\031\226J\025$a\316i\225aq\270A\267\275b\233\202}\026\001\3778\317\237=\347\227P\035\245\032\202\324\013R\253T_$\340\246\006\004\030s\322\304xL\032\361\005\t\333)[d;\242\370N\352<,p4W dD\310\036I\020~7\221\272N\006\035\315\225\212\206A\3668RU\373%\216\223zN\313\007\314\351\372i1\347\267\300\b\262\007!\022.\311\307~\341\036\260\261\177\265|n\300'\220\273\207\235\310VwW\346\210\361\240\322\230\277\272\217\351\001\2431\333)W\241\222\315\271z\340\247\360\272l\304\3437\004G\016\214\306\256\260W\313\305\272E\312%\371Y\351\016\373{\321\255\261\017\347\234\323\353\262\255\016]\347\001\\\267\241L\034K\t\nj\253`\301\304+\241\234\b\244\234J\023\270nC\2318\226\023"
+	.string	"\027\266\023\256#Ay\335J\310\246\021\f\245\31539i\335\246q[IE3y'm\304\200\273\025\023OCu\235\247\211\276y8\327e\215\n\256P\344qgl\207\226\004\263*\307\rerk\344\206x\265V\304u\005\037"
+	.string	"M\204~ea\314\221E\314\024\001\201;\225\0324\206J\030\004p!\026D\224\026\247_\226Q`\020\250\ta\260\257\270\346D\254\210A\370`\024\\\006F"
+	.ascii	"\34135\n.k\232N\324\342\246$\024\243f\317J\203\254uB\001"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.49.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\226\003\275\032"
+	.string	"\206\361\256J\240ZQ:\354^W\203k\0359\001(4]\001(+\351d\232\f\217C\264\335e9\314\3013+Hi\361[\307\235\205\257v\267\272\024\372\366}\234\307Q\233\f\341\231A\203.0\025\351\301c\017\375\375j\021!\204\354-w\222\001\232"
+	.string	"\216"
+	.string	"\235"
+	.string	"\301\377\370\371\211\202\355\2752\240L\335{.`\004\345-"
+	.ascii	"z\037g\372a\234\201\023\350#\211Q\206\204\024\357=_|~\300x[^"
+	.ascii	"\300x\3337\270|=\317%\305\335,\311\321\326\2468>\320\315J\026"
+	.ascii	"\361\252|\n\317E}`\225\345\305\235r\264<`\303wt\322\206X\264"
+	.ascii	"B\362\271\370\250!\370e\327kq[\027$%U\271zB\325&*\352\350\303"
+	.ascii	"\024\264\272zC\365\006\352\224\250\247\243}\247'\b\236L`\220"
+	.ascii	"|G\247$\205{/\323]\317w\23693+13\214\271K\004A\364\252\205E`"
+	.ascii	"\246\272\177\314g\216\276\tp\007\344\256\301\354b\3124\255\007"
+	.ascii	"\371Y?\377\231?\235\315K\235I\246l/<\327\222r\223\224iS~\r\356"
+	.ascii	",ZI\270\272W\305\325\230Ke\217\354\270\324\377\364\013\337\314"
+	.ascii	"g~\024\177\310,)\233\221\020\213\006\"|\250?\371\374\n\361L\037"
+	.ascii	"\321J\205\362C\370N\314\022\342\224@\274\362\211X"
+	.string	"\245\345\336S\301-\347\224\267g\376af1s\005\362\246\237\0079Q\001\\\035\r`\203\362\366\2466e~\227\246\315\2441K\301\317\340\221+\216\025\306m\2443\020\236\222\026{\333\330j\234\030<\232\254\020\240\335\314\0338\320\357Z}+\031\272\006b\346\016\177\342\001\202\221\027%'Mvj\250p).9\023\237\361\266\373\303\327%#/K\301S\0212U\325\022#\355Z\323\025\035\r\303\001(\253\337f3\177\200\321\357h\337\b5\020\317\364;BP\312P\231'\361y}\307\314&\216$v\251\252{u\017d?\2623\001x\257\316\301\324\215\314\370:nY\004\017\375\356\226\3173\336\232\035\204\332\261\b\262\035\230m\303\255F\303P#\273\301tf:=\260\2309{N\210\333\214\203\216\254\006\013a\263\021a\203Y\350\241\315n\261\036\037\020-\2161\030\001\233\325d\266\027m\366\352\231\301x^\261\232\355\305\240"
+	.ascii	"\323H\310j\257\033\215V{\261\316\240w\r\276\220\347\020\305\b"
+	.ascii	"\213\224|\334\370\341gt\\\025\2154mm3\205\240\316\3410\373\307"
+	.ascii	"f\016\322\325\266\007e\242oy\275\367\336\262\177\2143\326v\365"
+	.ascii	"\235nW\004\205B0r\364\212\322\237\222.K\310\376qS\221\031\326"
+	.ascii	"V\223Md\341T\027J\276\024\022\031\312{\003E\250q \245\214b\212"
+	.ascii	" $\"\"B\"\221:\220\002\031\2631\017\020h\2134\205e\fy\364\264"
+	.ascii	"v\r\305\217\312F\375\200\316B\375\022\312`\340\005\242\362\360"
+	.ascii	"\375\271\342\033\261\312'\266\210\3328\247\203.~Cl\334E\301\031"
+	.ascii	"Q\336e!\332\270R\226\213\002.u/\177R\231p\350\026\236\t\322!"
+	.ascii	"\200 \t6\313\223A\242\303\324\253<\233\363\317\314J\205\322q"
+	.ascii	"\260a\376\020\300\224<\201S\254\260\236(\220\035\023p7\016\371"
+	.ascii	"\005\n`\276\350f\0041\307\313\225\347.*\277\006M\003"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.50.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`F\006\305("
+	.string	"\252IL\020D`^N:\373\237\0231\216\270\016\324\034\211\003)\2719OHW1;\324jShZ\367\237\254\307\331c2\267\257\270\374\364Q\n\374\004\276\023%\344!;\220]\224\340\275\331\177\250\321\266\266=\261\233\020)\223\f\360"
+	.string	"\335"
+	.string	"\371"
+	.ascii	"?\t\230\337\315\332\253-p\257\304\"\260\245L\3010\300)\321\240"
+	.ascii	"~.\006\224y\367h\277\222\3654\032'JS\2624^\322T\331`\023\240"
+	.ascii	"?Wy\244\372\023\275Q\375\031aB\326j]\251\004\354Kpt\261\345\245"
+	.ascii	"\251\222\330I\026\275\251\374\n"
+	.string	"Y\353BCa\020\370\013B}\3654\233\265\366[\0272\027\0241\221\324\216<4}:\220o\276\0069fZ\300c'\310\227F\026:!\t#\362\3400y\004\236!\207\360\317D\0023\363\372\032\244\020s\301\235/}~\206\f\302Af\006 \250\2714vF\354k\220CL\004uG\346\374\355Ng\310\037\354{\215\"\257f\206\2613b\303d\227\371\272#s\200\311#\237\277\244\217\233\303\244\r\223\300\333\371+\311\305\375\345\027\300yA\3233\022F\344\354\323\220\246\351\262W2\354;\364\335?\330]\021\273g\224i\347\"C\202\2224\345\272\327\356z\370\026\025\017\003'M\271,P]\013\0134M\271(\304iU\251\372R\211\223\237{\032\365\247\201\376\333\317\036pi\274z\324\340@\335\246CO\256\273lW\271\305M\026\227\3141e\233l7\301\201\273}\r<\355/p\362:\235\274M\313\313t\266\357\222R"
+	.string	"\2247iy\001T^\244\312{Ty\215*oQ\345%\252\274C\225W\350\344\035V^a\345\rV^\340\311\373\253\274A\225\027\255\274\276\223\267^\371=}\274f\345\345\223\367OOP\306\206,\311\321v\312\024,\320\237T\315)\367\344n?\333\257|\357~\367m\37377\031O\217\310\240\260\273&w\322T\371\001=\226\375r\201?\367k\317\222u\266\235C\267\220h\333\033\223;i\232v@\003K\314\272\272\230\007:@\17718R\013(\303[C\363@G\215\324+"
+	.string	"\035\345\214yhc`F}\324&\266t\375(j\2426\352\013l\3071\223\250\213\272\004\335P\013\233\250\241\266\374F\026#I\241\036j\"\335\260\205\032\374=l\007\200\202\035\324\302\0360\327@\264\274\211\002\354`+p\363k \277\177\255\200\355\270\2076wP\373\350\216P|V\350\352\340}\347\252\257\321f\242S\333\327\357\332c\360w\355\nbh\214v\313=c+\351\344\365\361!\210\343bV\217\036U\315\276\331\332\335\256\211\233\211\362\265\031S\206\214\331\2766c\364\322j\234]v\254\252\324\007\372\n\016\3578f<\2336\264;\263\313\366\2516\241y\326\342p\261\237\375\237\352\273\251\227\273~\0309\320\276\271M>]{+u0S\347\0361yr_X@\3102\227\347E\253J\325\336\211\214>\367\210\321\013*\250RX\271\370\315\230BaEu\302\260\212Q\334"
+	.string	"\343\252\b\302\305\213\252 \013\251\251\025\033\212!TP\245\260*n0Z)\007-\242\250\256\246^\020\213TD+\252\250*\242\324\325\013\242\203\244-\272\230\272\"\302(\026\257\210@e\372&\333\253\235\303\235\234\266.\303_\253\376\355\036\356\250\264u\251ws&\246\3466R\021\022*\365\311\307\252I}\002\253\236\235\364$e\217\321ni\001\317\021\312\260\313\026\030$\210\352\3610c\250/\365\327\232\301"
+	.string	"}\265\243|x\350\340\375Z\352\357\335L\3234\025v\331R'\350/\017%6g\264[rK\251\223'.\250U\001\364\323\214\330@\357\216 \301\367\002\320\002v\020Q\303\325[\333\304\310\016.\240\023\260\316Z\234\023\315\351w\262\004t\374\315\275\251\371\254\016\017\2338[l_\334\202\272\214\356HEX\236\324\351a\203\206\213\375\360\215\273;<\324<\225z\030z\250Q\034\304\f\203H)%\"\"AF\324\254\001`\002\031\262+n\021\300\271ET\205a\317\032\213\266\221\324\330\265\212\f\271\030\177\317R\304\030@\013\240-\236\264\271\300\334\263$\347\213\222u0\375jN;\241\030,v&5\233\237\251\004\276\326\255f\030\230\312\266\241*= \210S\177:0-w,4hE\213q\027J<\347\353&\006\007\374\361\360\177\230s\2029\331?\005\312G;q\205\235\351\021\236\343\027\340`\257"
+	.string	"\315 \371\234\rH\211h\023%\252Wz\025\203kf\264\3300:\323\006\r\251)^.\316\\Y\375A\306u\213M\201<\266\320\230\277\004\"\354\301\002\307\252a\2011RBB"
+	.ascii	"jU\256\006\0070O\222\373|\301\353p\030\200t\034\315~y\215\332"
+	.ascii	"F\216Q\206\016\3731\032\026`\250\310\2617\372\314\216w\335\271"
+	.ascii	"{\274\213\363\360\016\242\271\302\255\321\322\365\350\363\344"
+	.ascii	"\002g/\321P\001"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.51.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`I\002\375\023"
+	.string	"\266\346\207J\300\020)\035\347\250 $R\251\"\013o\034\006/c\r0z/3\024l\034\307\322(\007@m\340\216*H\246\336\346\247\255:u\240w\247'\253$\n\3336]\227\254\230\213<\3071\021\377\345\364A\324\030\035O\032\331D\356\224\002u"
+	.string	"l"
+	.string	"t"
+	.ascii	"\342\351\001\360&~\202\305\264\002"
+	.string	"\244\016\rk\307\306\313\217\257V\262e\362\003\302S\361\002\302\323\375`\361 y\207\223vUH\301\2354\277\345*P\02533\303#\367\002\2124\335\2609\3176\303\0215\247\021z1p9\r\007\301\006(xv<r\030\300\365)a\274\374\204\311\335\346\236\367\371\"\312FC(W\363\251\032\251\265z\342r4\267x\3339\333#\366,\t\233S\344\224\201\2037\307^\211'\177\325\201\356\320\323\373\335=w\372\035\307a\3625A\370\325*\363\213\2522\250\221\210\003\375\273O\373\366\177\374\322,\037\210\366\3522\263\222\331yb\252\225d \336\307\347\231\265\363\221\3302#\226A>\246Z\353\307\251\025\210\247\267Yl\226\3559\355\367<\005\313\311\0250@\275y\330@TkM`\004\001sC\340r \321\325\371N87\033\356jal\340V\253\001\256\316\252\375\316vJ\267\te{\302]\254P$)\036\243\242\023"
+	.string	"8\242|\275\023\321\302\323/E\222*\321\363\0264\220$\234\355\013ga\362!\235Z\253\310\251-\373\212\023\007I\265\326\005A\027B\361A\234\272\202\312<\356\324W\tO\303}y\020\252\327\303\325\324\346o\313\230\247\242]\235M\332f\260\024\327k|\305\\$+\013\260Wl\2443\330(aL\211\301^c\207IBJ\\\343\f\206\322\222\215\255\330\3502i\221\314PZ!\004,\243"
+	.ascii	"\233\265Rd\262Y\213\345\3327\307W\361\007JSe/\374\320_~\345\204"
+	.ascii	"s\003\256vw=R[[\007\325\352\314\262\241\342\356\322\374\370\\"
+	.ascii	"\030\037\205s?\265[\272M\250\203\265\326\032\202|\256\270\347"
+	.ascii	"\235\222\350\225.7\266\371\013& @\002\203\030\324m\034\202\230"
+	.ascii	">\003\301\335lv\tM4\277\020e\317\005Lv\203\335\033m\273\\\260"
+	.ascii	"p\245\227\205w@\240\247\342t\3243W\243=xK\036\207\";\241]\267"
+	.ascii	"\267P\200\252o\321|\254\245\033\272\211\300\343T[2_\017\273\033"
+	.ascii	"\211\300\244\254$8B\2245\236{\265\370\t"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.52.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\033\001\275\r"
+	.string	"V\233`C"
+	.string	"q\225\016;\236\002|\t\327n\023)[i$\254E\022\022S\263\345\254Y^n\3527\354o\320\022jw?\270\bs_US9\301\376\220K\377\273\326^\031\020V\032\201\357\371\347;\033\321do)S\nN"
+	.string	"M"
+	.string	"L"
+	.string	"\332\243m\037@02\351\237\207\222\233X 1\321\262\373q\332\341\244G\250I\362\037;\254\301\302\005JUz\324p\230\331]\214\212B*\354X\241\310\002\250NP#smx\354\231R\215dr,\330]'J\225\341\326n\273\201m\005\366%\004?\214\351\204\351s\374$\245%\006\203\025\273%3\033\333\"\252"
+	.string	"q\330o\217\374\2301\376\367\022\243\303D\276\0250\\.\230\244Xv?\217G\033\330\036\375m\231\366G\234\304\350\257\t\276\354r\200\221\262\273\005L`{\314\\\200\366\b\337\021,\020\355\372\0311\333;\n\220mw\023\370'D!\333\207\307\253\346\305\313\224\263\247\314\265J\241\332\262\210\026UWTJ2TVNY\303[B\265#\204\362\250\250)\342$\004\r\226\223\226\354\257\224\332\262\017ww\255,k\207\335\361\257\235h\323\361:\236\r\347\002\352<\007\236\310\323u<"
+	.string	"\346|<\330x\240.\304}<\316\343mB8\016(\304}\f\360\007B\007\342D\237\017\210\303|{\270\312rB\217\247j\236\232\262\255i\306\244#N\325\364$7L9\323\242\266 \212\314\265\202\032\023"
+	.string	"M\204\336\031\341%L\021\270f\2104\215\350\265\2616q]'"
+	.ascii	"\203K\327(\256\021ek\002\216\213\f\256,N\311 \341\322\253\312"
+	.ascii	"W\316fY\023\n"
+	.text
+	.section	.gnu.lto_openSerialPort.53.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\331\003\345\033"
+	.string	"\226\362\267K\240\230Q:\300\253\301\325\246%;\036\327/\375m\204$\360\242\250\370\022p_S|\343\211\324\263\332\377\370\240\273\r\365Oi\243V\305D\353\377\253A</\240\276\034\347\f\307\302\227S\304\020\343\303\303^D\021\354\267M\b!{'\031\240"
+	.string	"\234"
+	.string	"\245"
+	.string	"\266\373HO\362\271\232\342?L\364Q\031s\316\r\032\001~y\200\354\356\276\220\037\3714NF-\n\236\305%\274\"[rVc\255\236\200\371\022_\200\371\362\3428\356-|\232%y-\256\237{\353\324\t\253\216\2164\202\303\343\b\302/5\256\236\200.~\336\352'\344Y\223d`\005\b\343\005\004\"\005\264\300B%\006\310\263\345\177\206'\311\007\306\030I1\300\025\344\313gE\344\005\334\331K\322P)Y\305"
+	.string	"udI4D\306\247nY"
+	.string	"w\326\23659\347\266=`\360\355zw\327\350\356]\367\275\021W\372\003<\352\r;\324\017\340O?\314\215\374\2577\375\2563\375-\030\333\370R\357\363\352o\266\355\373\262m]\266_\340P?d\f\031e\335+5\373\326.\271\252Db\364\250_\352\266\333\247O\374T\277\244r\310,Tspg\225:\332\302\023\205\253\321\005er)H=\002\222\263\272\340e\223\300\030*-b\331\234O&\376\303O>(\037L#\266\377\260\023\361\311\206\262\251\257\230\277\026P\321\t\005\322\236\351\204\371k\371\210Mh\256R\317\1778\212\310\304\230\263\332\240\035\340\227m\003A'\316\204]\031!\244(Z\244d\r\260"
+	.ascii	".\314}]\327m\335\016\036\354{\260K#\344c(\017o\256\261\340\242"
+	.ascii	"\374\3139+\200ij\301\343h\314Y/\326\227eG\020\363|\002\023\023"
+	.ascii	"\020\242AD\213\024'\346\305\267-\357\313\217]{\247\363\262\244"
+	.ascii	"\274D\267@G\250\030\221=\346\357\253,U\351\376p%=\020\372Iv@"
+	.ascii	"\340\234\363u\274\374\235\311\201\364c\327+I\362\302ws\314\363"
+	.ascii	"\312$\025\227\262v\226K\303\254y\273e3\373\336y?uW\326:\343h"
+	.ascii	"\334\335\\\267\232\263\227\250\373w]\327\265\257\215\356\263"
+	.ascii	"\021\250\215\003\354VK/\270l;\3519\273Is\310\331\r\315p\303\203"
+	.ascii	"\332`\364\206N\210)!CmppP\t(j.\235\224v\223\351\360\210\300\265"
+	.ascii	"\031M\004\355\2463\273\241\271Z6\203\203\322j3[,\245\305thhN"
+	.ascii	"LV\263\305f\ft\2723\253\305niZ\213\275\362\257\215>V\017(\036"
+	.ascii	"\021\303*\024\2758\021\311S\375^\026\335}o\327\374\\\035\231"
+	.ascii	"s\316-\330\355\266\360*\\pX$\2100\300}R\240H\305\220\3518do7"
+	.ascii	"\2067\321\300$\004\007\030V/\213y\355E!\\\227\256\234~\3741\234"
+	.ascii	"\302\357\021\247\004G\250a,G\bc\210\231\031\222@\202\320\242"
+	.ascii	"v\220\002\021\301\263\003\020X\310\246\352~\210\f\227\"t\302"
+	.ascii	"_\227(s\025*\213\347\031d\"$f&g\314\034\210\310~$\n\034\371\210"
+	.ascii	"\335C\204\215$\b\205\204\026\375D\223\006\2326\003\f\210\224"
+	.ascii	"L\261\020\\^\034v\001\020c\307o\250H\f\301\016*\035\310\2529"
+	.ascii	"\351U\277\302\237b\214b\3042[\375\242.P.\205\340\003\373\005"
+	.ascii	"\334\326/0#\200\372\235_\312#\017/\200\317\024\2266\245\370\234"
+	.ascii	"\361\347\02629\313H\222\303\236\374\007"
+	.text
+	.section	.gnu.lto_closeSerialPort.54.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\033\001%\r"
+	.string	"V\230YE\020\221\232\016\030^7\312\005\215/\024\372\246\364\177>\372\332\341Z\336\023\027\354\302\020U\240\020\350\251:b\201\032i\031"
+	.string	"\211\345i\017\223\261E\250\032Q\004\nR\315\362@F\001"
+	.string	"\366\017\257\317_#\262\267\334)\005D"
+	.string	"B"
+	.string	"G"
+	.string	"\363\004\250\313\352\003\250Kov\215O\322\036\370F\031dpv\327R\021\337\036\025n\376G\307=~\270F\006'4\320"
+	.string	"\350Vbg\006\307\367\322\341\206N\004\241\207gw\rY\272\226[\336\266\003\333\036\373\034\002V\027\373\363\216\217\371\265\212\020c\324\241\273\307bw\224\263ck\244\213\022\237\277\375\227\334\261=S\002\254\214}W\363y7\2733\301\245\027T\207\366a\236b{L\350\002v]N-v\247\002#\250.\035_aR\355n\003_\006E\003\231\261\273\037q\351\207\250K\024\357\005\212\033*0GC\2300\331\250S\250\250\312\235h\250\260\021A\035\226P\325\266p\001\236%\352K?\t\f\237\207\0347\"\345\354\311A}\261\037ww\003\240\221\217\006\001\344$\303\036|X$D\302\347\312@\232\205]\326\204\353Sb\211d\232\025b\300\030\005Pf\235`Xfu\346\336\243\242+Q_L\267G~\n\275\305\203\201CB\331\327gHL\025J\n\220<l\320\220@\300\334\204\262\261\027"
+	.ascii	".[\267e\236\314\2000\254\266\260!\013\004i;\036\306\342J%\r2"
+	.ascii	"\007Y/\225\213\236\232\002\016~5A\214\261\205\\\263\273p\367"
+	.ascii	"\243\210\345\251+\342Z~J\274)\205\332\003"
+	.text
+	.section	.gnu.lto_serialInit.55.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\b\0045\033"
+	.string	"\266q\257I\240\326Q:\2241\370\321\026\253Vx\252q=\366\330\367$\353/Qa\2319\320\206\002\276\177\276o{H\305\217\251i\340V\324u\247\255G1;\236\003h\300?\300\006\323\016h$\230>\224\204\236\307[=+\371{\023\271\223\f\236"
+	.string	"\214"
+	.string	"\233"
+	.string	"t\274\200z\272s\356F\220\260\273\023\013\002\007\353r\202\322=\304Y\006\344\351\356v\265|\270\324\004z\350pQ\304Kw\323\030\307\222\037\207_\331\334]FF\306*\035y\356\366OO \224\342q\031\371\005]f\214\025\371\212\337\362\t\307\032\227-B\336\224\335"
+	.string	"\006O\306\306\005U\222\262\024\200\372\204\361s1+\002$\240\321\351\267|F\263_\2139\2165U\222\262"
+	.ascii	"\370\021\215\016\216\246\310\230\375\206&\037\3524\211\206\027"
+	.ascii	"\2470$`\3603f\241\273w\366~\300\357\354\273;\265\273\034v\371"
+	.ascii	"*'\346{kS\004\243E\304AK\276\247\356\243.\325\263gZ\234\212\371"
+	.ascii	"\336\351^E=\245TI\276\216\234\272\b\315rw\0304Yi\3675.D;\226"
+	.ascii	"m\354\322|\370\317\234\370%\351\334\030\235[\353\\Z\347\216t"
+	.ascii	".\323\271s\234\373\032\0235b\024\375.,\273c\224aZ\213V5\235\370"
+	.ascii	"\335\023\331C\021\327\352\r\354\277\360\322c\310Ww\337\234\256"
+	.ascii	"\006\362\364\263\335\345\271{!\037\262\373P\267\262n\244r\252"
+	.ascii	"\273q\266F\236\036xM}\254\304Z\357\201\225\357\251\223\231Ot"
+	.ascii	"\304\233\345bM\276/X\f3\372\223_\351p\244\3440\210\362\254`\361"
+	.ascii	"G\227-\372| \241|\246AJ\232\210X\206\346\227\311\264\003i\306"
+	.ascii	"\310J\327\325\031\346'%9\210^C\363\313\236w=\334\211nAWwO\260"
+	.ascii	"\3121\260\324\335\265\323&TL\017l\327\347U\037\310\356\241\332"
+	.ascii	"~\352T"
+	.string	" \306\020\"\252\210zz>\3243\324\bZ\001R\305REaT\2743\363\375\275\2527?\221'\341\001\260\324-\364\336\376\310\221\354\354\231N\327\306\303\263\267+l$|n\364\347v\001\327\001(\207\333 \200\204\r\305\b\035\037\f@%p?\001v\007\002\n\235[\316\366C\303\335h>7\235\036\332N\356\207\006a\300\342R\330r4 \034.G\233\r\373l\343\351d\024\225V\330\227\020\363dXigB\222\206\331k\336\234d\030kUI\376\230\217\335\335\262\007'\231\206\317#H\205\310\0255\231\2201\257\254W\216uU^\021,\213\272\006Wr\024Xq\022,+\374\310\302\212\261\322\3766\2252\375-i\"b\315\224e\271u\233:2=\217L!\030\206\307%5\346\302\254'AjI\250A(#\rb\206\021\241\221\200Dd&m\003\260\002\221\251\272\r\021 AJN\212\250\331\f8\365\2331\005?"
+	.ascii	"y\217M>Z\302\244NP\214GwI\214ET0\b\362\001\364L\2537n7l=\355"
+	.ascii	"\304\215\245T\305\314Z_\275\306\342j\240\3757\224\302-]\320\275"
+	.ascii	"\272\254\205^g\253\243u\357{y}\th\305!\317\273\3469\265\206-"
+	.ascii	"\273A\266\232\334\007\261u3\24561\273g8\367\257\200\335\256\322"
+	.ascii	"\200&\200\236B\ri\325Kb\204Awdqc\024E\001n\315\235\275x0\252"
+	.ascii	"/\3456\007\226\3204"
+	.text
+	.section	.gnu.lto_serialRemovePort.56.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\020\002E\022"
+	.string	"\306\242zH\320\362&\035R$\255X\214\fU\301\225\222\211n\224E\336\300\242\332\351\377\300\001\032\016\270~\b3fP\373\206\257\232\221L\215\204\372\tt\316w\221\033\003|\361\020\372q;a\272\274\341\302\362b\2037wkdo\271S\ng"
+	.string	"`"
+	.string	"g"
+	.string	"\3233\033\307C\237\r\020\264cc\324cw=\375\340\325exwqvU7\245\306\231?ti\3739\242\2011WI\025\316\006\032#\240\215D\201\312Q{\356\361\006\234\211\035\310\b\235\317\016\227\322"
+	.ascii	"\017\f\016#\340\005I\"\303v\243\005\322D}\356\323\206c\242\201"
+	.ascii	":\217\252\006\273\353H\003s\356\325m\347\330>\261#\2031\021\005"
+	.ascii	"\252F\204\265\307\016\271\320\317:\321=g\264\234\321*\243\243"
+	.ascii	"F_D\344'\003x\\\322\256\206)\037\3534\227B\234\350\366C?\347"
+	.ascii	"\226\025,\230\235H\366\255\331\n>A5\035\273\341\201O'X}\276e"
+	.ascii	"\373\321\276\211\237"
+	.string	"\230]\b\306\254]\017M-v\027\201\t\254>\005\234\244\373\224\007\320=\366\221\236$\363\201\f\341\213\247}\335\247\352K\r)jgv\230\216\305\n\025wQC\"\301\343\265&\246\022RofiTX\221\r\232(e;\302\217`\n\324\330\335\023\333\026\236\202e\200\317\356\242\240\270\321\313\007\3724\205X<\355\323\217u\237QYBS\257\317\335\301\f\\\f\233\0372qJ\217p\242\224Tov\030/\256\225\226o\302\\\337\203\317\245\305\265\362\201X\305DB\312\007s\305\274\327\347\265|),\236\n,\346\231\224\3705\301\005\363\\^/\230\327\n\367\332c\017\375\030\236\224\234dtF\2457\267^\314\020\235?\3217\253\b\242\350\211&J\335a\314\345\356n\247\267\313\272\251!Zb\3031\305)u\351\264\035\237\272\254S\225\372\032\236\2318\025& p\002Bu\324\003\241\300\257\323KX\304+\365\3561\355M"
+	.string	"o6\252\345|\202\r\250\204\306\207Xl\301\356j\313\207\333\274\3342\213\215\023\034\367\nYX\374!\261\373\266\355@["
+	.ascii	"\026\372\023\350\003\375Bq\017\264\0341R\362\275d\210\370\016"
+	.ascii	"\2214d}_\211\272\246\213\222\001"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.57.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375 \344e\006"
+	.string	"\342\213,3Pm\222\016$\013\242:\201\352\312Z\022\206\003\276\346\214\347\224>_\236\265\266\355vxz\347\r\234\260\337\314lVQD\337J@\237"
+	.string	"\261\036\021\233%[\246c,\016\227\251\312h\0365=\210\351\362\3600\225\346Y\b\246\"2\325\223\240\250\352I[\326}\320\031t\234\347\013\322\020\353\202\236\330`\261Fw\003\320\b\235@F\007C\277]\3504\276\225t\237\037G7\300\001\312\252\221d^\204R\262$\032\351\3709/\255\260\300\331*\240\270N\016<\264\n\021\224\314\355\271\215ZE\353\366\243\r\036\315\004\313\256b"
+	.string	"Cf\216X\206\321]\377\204\037\341\267\b\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.58.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\200\001%\020"
+	.string	"\306_pF\340\322&\035Rwn\033};\036\032\304q\207\334\376j3\241\271T/d\260O\017\271\311\211\022\267\326\261<\032\265U\363\032\301\367\025\312\357W\214q\303\f\363\264\037+B\334G\007\202\364\362\020\263@\322\310\336R\246\024^"
+	.string	"T"
+	.string	"_"
+	.string	"\221A\203\027\257\376\365\340\bh\005\321\024\361\330\3756\005a\355\360\273c\256\236E\250\271\362a\236A\323M\006\031!\036\013\226\344\270\241s\330\323\306\223\3118\"\347\020:\020\"\021\"\304\233\201\n\213!\235<V\352aG\240\343\202h\206\n/\347i2\331]g\215\247\3416\335\366\3126\211\375\241\177\271\376\314i\370\327\2551\2350}-\302\017\234\033\357>\261]\234%\037\373\"\262\b\372\353\366?\037\346\223\377j\371\262\266\245\247U\002\307\356\227\340\321\013\264\307\333/\366\311v\246\375\023\027z\271\313\305 \273\036\222V\354\256\002\033\320\036\t|@\366\b\037 {-\231\252IE>\370\030\261:\310\344R\002\325\354\210\001\225\307\231\246vD5fR\311\266\204\307\\\016\320\330]\022\333\027\236B\245@\317\356\226\240xQ\312\377yt\005U\276\346\321We\217\251 .\325\353a\177"
+	.string	"\303\007\211\346GL.i\354\246\307\221*\217\375\301\244\356\034\351\300\260\301\272c\007\026P)+\\\354P\034\004\216e\005\225\302\0010\312\310\204\023\256C\251\266\024\267\255p'*\033J\247\332FD\234\242\200\3526\226T\252\333N\337^w\374\241k6Z\256\230Q\364W\331a\007\371i\231\210\031\351\277\312 T\233\304\250\f\207Ly|j\001M\032E\244m\264\004\"J\232I\245\303\335\335\370\007\031"
+	.ascii	"Y\b8Z\315Sz\r\244)u\335\t\301\030P\035\301\202\210\212e\303\355"
+	.ascii	"\342\354m\323\006\232\006`6\352B'\204\315\221,\323\272\355d\n"
+	.ascii	"y\366\264\027\227\002\252\205\252\240\261\251H\274\256I\006"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.59.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\245\n"
+	.string	"v\223H=\020\005+\035"
+	.string	"\004\216&`W\204\321\002Z\211./\341Ql7\317g\375\353\345X\205\364\200\306\206\254\277[\210\020\333\330]"
+	.string	"@\021JE@\252\203\251\033\340\332\013\021\332,!{\357\224\0026"
+	.string	"6"
+	.string	"6"
+	.string	"\225\316\320G\200\331\210#\352\\\345\254X#\237qUC\345mv\331'\307\230\232\265\244uz\331\033d`1\342\330\372\3440\354\256\2478v\334\335m?\330^\260O\003"
+	.string	"\266\306\315H>\266?\355\243<%|,\343\003\273\256\022f\227TpB\347\234\311\027t\347:'\350\3169\264kN\276\366\340\304ec\345fw=*\342:\303s\001\247\237\261y\324\335\335\352nz^\321\331\026\027\363\242\337b\373\250\251(\212\262\320V#\245!6\211\232\241Wy3u\331\217\375uN\237#`\3622\036F\333e\005\b'\360s\360x\004\202\020\225@\222\311\373J\236DI\024\341\215@\223\0072\3607A\002\275\323\367\201\336\207\334S\227;6\220\232\006Mq\030\335)\250B\243\232\245\003f\245\366G1/\006\023"
+	.ascii	"m\231'3\360\316#:\326R\\w\365\002\rc\035\2502\251h0/A\273l\221"
+	.ascii	"w\t\240YM\t\356\305-U\252\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_nopConsumer.60.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"R\013+3`M\222\016@c\003\267E\021\241.\013r\037H3\210\006\254\013E\003\241\206\007\217\205:\371\026\264\254\225$!\221\301\035\265\336#gh\003\265\3056Bv\n\316\343\034\2427\232\007'AN\247=\251EH\016\242m`\247i\006~\022\034\330<\357\301\226\251\232,T@\301*\276\232\026\323\370\214\312B\277\004@8\250\354@i/ZX\232r1\361\3703\363\257\365\n\f1C&fm\006II[%|"
+	.string	"\220\227\343\253\020|:-|\234X\214\254\264ml#c\256x\246H\006\200\250)\027\246\241\355\013Da\344,\177\203\037\341\377\004\b"
+	.ascii	"3\003\316\231\001\342\313]\303\265C\030*5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_serialPassthrough.61.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`\222\004\025\034"
+	.string	"\266r\263K\260\226Q:\344\215m\230af\210\236z\345\030\203\243T}\305\262q2\254`8\347`\200\016\217\243\333\243cf\030\230\276|\257\370\220,\356\313\2606\224\346\235\322\277\007\334z*#y\373t\312]u\377\t\231\2145B\b\331r'\031\244"
+	.string	"\226"
+	.string	"\233"
+	.string	"\343\3543\350)\323\212a\271`VfI\216\266\353\214\217c\305g^\034\2654EJ\266\013o0\354\001b\024\226/\335x\365\204\372\352FO\311\nR\356\305eX\274%\274\315pQc\216\316\032\312\351\356\262\245P\221\322\205\267\0266B\221\230\344K7\032\025&\370U\215\236\013+H9\335W\366\001\316\b\323\205\267#\273\032\342\b\376w\001K7\243j\036)\307\342%\fn\305I\025\037\207\204\252M\361\266\t\250r\350N\\\315\276\214\210P\375\367J\2043QkI\341\336\313\325\206\313\235_g>\0163O`n\2525\177\372_w\372]O\177\364M\377y\247s9V&m\345\321V\266c\345\266\225\253\255|\001\025E\225#\334\225\252\334[\364\205\313\235\032\223\330\370\220\037\b\305\324\253\301\027\302\0172\213\0338\230\035(\342w\350\212\320\321kA\2747E\360\221%\230\037+\213\371i\t\204\3524\""
+	.string	"zk\276\031\f\322\"\202W\346\003y\220\331\233H\274u\357\316\b\222{S\005\\\300\374\310\351i\310\217\346_\344G\2361\017\237\362n\200\035SN\374\264\334{a-\203M>\031\206\313h3k\250]\241\f\177\334\336\326\006\234z[M?\370Wp\330\213\300+\022W9\344[\346\213\"\263\023\253\267\275\017e\230\343\257T\202\f\245\246\001\243+Fe'\021\260\215\314\323sA\347\305\276\372\246\211\230\034{7\240\330\314\323cA\327\205\351\336\022\267\261\255\256.\233\250\310_})*\266\223fv@\272w\374\021\244\253\233&\365\304WU\253E6+\312\343\304\254g3\203"
+	.string	"\252\267\361\177?OJ\223\251Z\323\230SZ\355$\3467\330\002\344\3361\377\351|\363!g\233\003\317\0019\257\020\324a'&#+\214A\035vb\2621\210\203\216\007\3139\013<\340\304d:@\260\237\030\314'\206\323\003\313\221\001\301\026"
+	.ascii	"\340\237\017:2X\320\317\217\f\306*\371\275#\233o\232}\210d\237"
+	.ascii	"6Mv\351\363\361e\206\243\216\by\350\330\347q\216]\211\303&\274"
+	.ascii	"\245J*=Q\233>\324_H\206L\246jM\223\251\277\0308^\313v\b\324\366"
+	.ascii	"\177o\021\207Jbjj7\227\315>M4\265\033C\206z\033\337\b5\215k\272"
+	.ascii	"\273\214\321#\313\t/%\352\027V'\361\337@)!\234\253w\217z\355"
+	.ascii	"/\371\252\002[\250q0%\rR\n\221\210\210$I\r\351\300\002\021\271"
+	.ascii	":\007\0200\310\244\212\2269`\212\322\361\335\351q\246Q\312S\202"
+	.ascii	"=\212d\021\357\242\377B\221\357\026\344\321\362\326B\275d9\003"
+	.ascii	"\354a\234\246(\351\224\006\377\267\340qS-H;KU\206\363\001\027"
+	.ascii	"\320W\365\034M\22074\271q?\301\341(\340W\\\334\305\220\343\263"
+	.ascii	"\031\302&\007\333\327l\003\334t\266\342w\0015IK\263\275X\316"
+	.ascii	"\200\365\n\002\321\350\032:EB\024 ]P\b\340\377\026\271\272\316"
+	.ascii	"6\n\n\222o\315{<\034+k)\002\ft]\247A\373c>d\026\242\274\bO\231"
+	.ascii	"<\345C5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`W\003\225\020"
+	.string	"\004\030S\004"
+	.string	""
+	.string	""
+	.string	"\002<\177+\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006'\177,\260\206\3618\272\320\202\002"
+	.string	""
+	.string	""
+	.string	"\005 -\301\204\001(\177.\346\206\316\220\"/)\1770\234\211\365\321"
+	.string	"\002*\1771\005\037 \300\003\002+\1772.\1773\252\333\3426\005,\031\005#4-\1775\002/\17760\17771\1778\250\212\250\332\0012\1779\270\215\221\313"
+	.string	"3\177:\0024\177;5\177<\377\377\377\377\0036\177=7\177>\220!?\300\003\0028\177@\0029\177A:\177B;\177C\360\372\250\220\002=\177D\307\3712\005&E\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005$F\001>\177G\037"
+	.string	""
+	.string	"\200\220\200\001?\177H\300"
+	.string	"\177I\302"
+	.string	"\177J\301"
+	.string	"\177K\306"
+	.string	"\177L\305"
+	.string	"\177M\304"
+	.string	"\177N\303"
+	.string	"\177O\003\001\036$\003\f\036$\003\f\tB\003\017\016\320\371\216\307\003\001b\003\017\006\350\274\307\343\001\001\302\001\003\020\037\204\223\242\253\001\001\344\017\003\022\021\"\003\023\006\003 \271\255\362\217\002\001\204\006\003\024\b\025D\003\032\"\221\205\327\307\003\001$\003\032!D\003\033\032\"B\003\033&\300\206\275\355\002\001\344\001\003\033%\244\006\003\033$\304\006\003\033#\007\007\003\033%\231\365\231(\001\244\n\003\033$\300\327\351\371"
+	.string	"\001\304\n\003\033#\013\004\033\325\007\004\033\231\365\231(\001\325\013"
+	.string	"A\250a$bM\033\252(I\315\034\240\002\231\262\342\001\021\300\224\346\214"
+	.ascii	"\221`\202\241\td2\350\366\224Pf\353\211<\2370Y.\311\332f\237"
+	.ascii	"\331N#]\301F}\3433l\225\332\007\034\343x\326\256\351\nj\024O"
+	.ascii	"\341\024\372\212\344\372H\333{\3158\227?\240q\371\267\r\226\311"
+	.ascii	"\246\216_\256\262\246\204\023\307P\017c\345\332\311\230\322\035"
+	.ascii	"\321\356&\376\226-\263J=Fy-\252s\335\350p\312\241\345o\255\033"
+	.ascii	"I#\331\353\314\241\3211\314wz\245j"
+	.text
+	.section	.gnu.lto_.refs.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375 \261}\003"
+	.string	"\002\211\026\031\240'\351\377\377\377\377\377?\216\375{\373\237\306\237?\331\255\355F6\2212\005\263\210\236\036\312\305\235\256\241\005\316\233\300\353\270\271[\017\350\3448r\037(n\307\215\373*N\305K\347Q`7)O\221N+\200\233\2759O\247\327x\220\321K}\253Eg7\274t\341\355\344\237\b\006"
+	.ascii	"v\306bQ\367\272j\274\005q7\233S\337\362\004"
+	.text
+	.section	.gnu.lto_.decls.69a8404a04ffdbd1,"e",@progbits
+	.string	"(\265/\375`e1\255\315"
+	.string	"*4eDX JA;\351\313o\302\324\211\320\211\006O\360\371j\t1\"\310V\273w5\371\243\340\203G\037S\240\020\034\300\371\346}\001P\233:\335\374\352\357|\220\313\262\256\353\252Nv\024W@\334\264IK\001BQ\212&\3056[\311\355:\346u\024\363\364\373\357:\320\246\367\226;\005\232\0034\004[\004\315\006\212a\253{Q\324\270{\332\307\256\"\372\307\305g\315].xRj\204\241\245\267\"\2063\"\2068\257\205%\336yHH\345EX\343\031B\0211T\360z\202\\\t\221\372\244\221eY\311`f\235A\024Ue\260\237[V~\032S\2613\344\236\006\265\322\022\201v\006\033\275ZF(\3748\243v\212\025\264\253\r\264Pn\243X) \004Z4\257\244\350\221@\373\247\024\315y\355\340C\007\035\274\354\325\r\336H\361\033\232\016\237vm#\215\3325\373d"
+	.string	"RW\002\033\373}\030\266\031E\363\032\277a\244|v\317\352\331<\353\3046\261\253\355\263u\267v\366\356x\315\331g\353/a\373,\235\035\273ZF\351\331\217P4\347|\253\004o\210\255\255\005L\352\005\b\266\3172\261jwEK\203\270\n\243rKl\234\fSC\356\271s\001\315y\275\315\372K\374\037\210`\373\354\234\215\273+4\367\324%\331"
+	.string	"*\260\350J0\347\365C\0073x\201am2\3706I\3729\353aH\264F\322[\031\322\333\251\364\026\206\364\266'}\230\233}\263k\006\026\356\037\210\360\313\334\312Y1\204B\bE\220\336f0\264\2056\203\341m\322\243\261Y\017\303_ \035Z$6\211]C\330\264\3333{\344,\3155\2579\2573]uE\214\253\361SHoC\foa\241\r1\274\002\322\236\263\034\206\032\254\20722\027\"?f\2405\276%\373-\230\r\263c\375\314\331'\347L\201\314\232\335\226\221\025\263]`TU\032\177\203\264\263\3650\004a9\f\255W\211\333/\016C#\347\232g"
+	.string	"pd\rI\343\226.\233e\271\256\320\3203\207\345\274n\300kG}P\032[\"\266\210]-\327o\265\354\326\361\3263w\345\234c`\244\320\302\232\215AX\017C|#\227y\312Y\204w\272\"\347\234[\354\327\206_\255\207aj9\f\177{\363w\013\177\273@\303\363[\r,[\371\333\267NR\360_\276\337\277Q"
+	.string	"\301\337'v\342\234\264\341\377\256ap\006\327\304O\360_\256\026\234\032\031\363_!+\37471A\b\353\002\323\243u4\250\001\303\337\f\310\261:DK\255\002\253?\320\306\365\277\314\027\254\376\273\374W\005\225\r"
+	.string	"\0010\230\352\360\337\024~{\243q\372\346\304\377\266\360[\017\030p\300o?\300\301\374W\001O\377\353\301o\213:\005\013/\376\277\374\367\202\377\200\377\377\376\353\275\311\377\275\377y\377\361\316\367\300\377O|Z\375{\0016\377\267^\301\177Y\376\016\300\337\003\370["
+	.string	"\177o\3607\210\2779\370;Dc\360w\006]\363\177\346\307\024\370\255\321\317\177\373\337\230\277Q\374\355\201\2777\360\367\005\376^\341\357\024\376>\341\357\006\374=\302\337\035\374-\342\267\200\277u\362\333\275\337\346\375\266\356\267t\277e\373\255\331o\307~\373\365\333\365\267C~{\365\333\252\337R\375v\352\267\317\3372\375\026\206\337\036\375\226\350\267@\277m\376V\004\277-\376\366\002\277}\341\267\032\370\355\006\277U\361\337\357\267\026\374\247\362[\027~\273\374-\b~;\302o\033\360\277"
+	.string	"\277=\3766\347\267,\377\341~\213\363?\304\177\261\377i\277\205\371m\315oQ\374\266\003\277\305\300o9\360\333\r\3746\003\277\345\340\267\032\374\026\304o/\370m\313\377+\377\255\374\257\362\177\360?\331\177\256\377*\374\177\373oAaaa\341\337R\200\277\345\347\347 *a;~\326\016N 0\276\256\320\025\272D-?C\230D\\\250\025\223$\267\305/\321\035\"\226\335\260\242\324\370\276\200\351\253B\"5\344\272h\240\241\\\221\225A!\366\372\254\327\347\002I`\224\002\027Q4\0331y\320B%i\312y\177\032\002CU5\326\026\255'hj\215\337rt\345Wn3\3159[\256=\247\210{%\345\2046\276\315[\345\202\310\320\315.KF|v\235\013s\272\242lTr*$\365\347$\264Pbf"
+	.ascii	"a\201\r\246o*=\370\256\322x\326\231\231PB\270rs\312\020\361a"
+	.ascii	"\377\303\234\221X\326l\324C\034Z\026kE\3741\366\332\rr~\006)"
+	.ascii	"\326\314\354\373\373K\255\316\232K\007\221E\344\3144\022\352"
+	.ascii	"zbn\020\352jf!\257\271\243\rBk"
+	.string	"\266AA\356\212\312B\353\223\211\237\314\316k\366y:\312>O\346\216\320\232\215\362\372dj\310>G\032\204\326&S\250\353\351\310\nu=\2176d\237\314\314>M\033\251\317\363H\b\356y\244A\250\253y$\344\363td\363\372\314\226.m}b\002\345\256fL\316yh\2052\21197\2152\223I\023\345\247(Qn\312vN\310\032\225s\316\231\031\246\007\365tY{\362\234\220\217'\016P\316z\231(\004\246e\006\345\036\246\315\031h5\312\271\347\351\001\347\323\332\005\031\345\230\354\323\034\352\201z\022\201z\236A\331\207\r{$\324\005\365,\201\344\253\013\232{V\246\205f\275'\243\264\213\271\3460)1]U\316\241\266UJ\211\355m\212\215\024\230\232\332\237]\373\257\231\230X3S\206\353\305pM;J7\224\226\362\216\322Q\242\317\332Qp\316Mk5\220\261V\003\2265\035M\256!\376\020\353I\373\001\352"
+	.ascii	"{\233iB\371\364\330[{\257\235\3305\027q\bb22\362\200\357\203"
+	.ascii	"\314\020(1\020i\374aS\372\241O\023\275\266(\f(\215;\017\213\375"
+	.ascii	"\230)\001\274\263k\343\261\fI\262\322\260q,PS\234\2345^W\030"
+	.ascii	"\264&1\031u\315\204(\007\344\f\260\231\374=\327t\275D\234\311"
+	.ascii	"\243!V\243q\232\363\222\252K\305\213\311J\316\005\227\033V3\016"
+	.ascii	"n\346\352\347F\221\265,E\002]\253\274\271\245\177jJM\2676\253"
+	.ascii	"\007\b\324\243\261Q\223\2510h\252u\024qQE\267z\324\200\356\200"
+	.ascii	"6Ay8E\245\232\314\322A\305\360C\t\253\211\214\325\rE\205\300"
+	.ascii	"\330\352\257\030=-n\274\017\250.\007\220\006\222\361\321\220"
+	.ascii	"}\240\222z\207\fLdm\325W/\352\226\242j}\326l\275\3263\264\222"
+	.ascii	">\322e\235\326f=\326H:I\2135\232]\233\254a\274\301:\354\037Z"
+	.ascii	"F\220\006\002\343rF\311\272Hk\331\271\260\334D\002\321\003\352"
+	.ascii	"\027m\231\302\302q\005\004fY\277\274\302\264\234\354\2552\344"
+	.ascii	"\235\361h\334\325\\E\352p\270\201\245gY\215\364:\023H\364\207"
+	.ascii	"we\004\332YD\037HE;\236\206\260(\245g9J\317\342\223\036\007\246"
+	.ascii	"\307~W>\240<\266\372\032\317\315\020\t\207\324\331\270K\217\331"
+	.ascii	"\322c\262\364\270Hz\334#=\200\3450\354\030~\322\322p8\323\252"
+	.ascii	"\316\301\204H\376\242z\347\270\037\021\203\031\035ftQ\215\033"
+	.ascii	"\207U+4\203[k|\300\367\301(\311\001%\327\370\230(\375%L\217\326"
+	.ascii	"QP\331h\316\252\261\337\352\005\255\202\365d\237\f\225\242\324"
+	.ascii	"\320\262\341$#6\330\323\370 \264S\327XsQ\313T\222\023\323\323"
+	.ascii	"\256\355\324M\377@\204\334\301\207[ee\345\003\343\337\261\364"
+	.ascii	"weZz\241\222\305\204\255\261\022\f\031`Q\216\035\351\355]\017"
+	.ascii	"_'5"
+	.string	"\215\236a\327vv\214\267\214\206\341\037\326\234\313\262\332\331-z\310\214k\317\331D\215\224"
+	.ascii	" #\027\027uMf\200\340\276\376Rl5\\&\244\243\313\006\343\255\252"
+	.ascii	"\261\021V\"Sk+J\273\250a\3749gb\223\224\322m\246\357\300~!3\345"
+	.ascii	"\005\240\022&i\273\210\271\315\031qgm\351\337B\035\304\322\027"
+	.ascii	"\003\320\256\361;\350of\007}\355\243o\bJc|\3655\2423Op\n\373"
+	.ascii	"\220\203\252\353i\214{`\031\354\3727lu\231$AboV\322\217\300\376"
+	.ascii	"m\210w\034\363H\322$\365\364\247c\fo\t\372$=Q/\007\316a\007M"
+	.ascii	"h\310\031\312\r\255%\206/\347\333\f\201\307-\354z\0031\216+\344"
+	.ascii	"\31416\200\322\233\211\312j\"\322x\252\313\244@\241\023Ko\263"
+	.ascii	"\2060\f>\031E\230(k\017\t\313\370\261$j\204\211d\230\033r\216"
+	.ascii	"j\002}\342\033X\nCa\0338\312\256\370\t\303p\354\002\277\370\207"
+	.ascii	"#\370\t\037Y5;\207\243\001Yz\370\t\317\300Mv\316\251!\373\230"
+	.ascii	"=yq\3614WC\006\017\275\017\203\036!\023E\372j`'\273\342&\334"
+	.ascii	"\204i`&;\347\\3\022\314\021\272:\267\n:\210\211b\247\2674d\302"
+	.ascii	"Ke\353\224\224\306X\311I\343\355\207\312iW\234\004\030\004I\025"
+	.ascii	"\342\215\364\304gzb\214\024\307H\357\2425\210D\351\211-\322\023"
+	.ascii	"}\322\303XI\017\023\230\376\030\006&b\351r\373\223\303DquqC="
+	.ascii	"R\322\026a9\f\361\017\016\302BXh7\310\370\322c \024r,!k\214\355"
+	.ascii	"\327\206\270\347\330\347\215\007\224\b/=f\342\246\336\0161-\271"
+	.ascii	"\3648\223\025\376%5\276\205)\020\fZ\210\227\032fNK\215\177\013"
+	.ascii	"\377K\345\016^B\017\204\240\360Z\271W~\to\225|\tCx\346\334\274"
+	.ascii	"\2043Vrn\316X\253\201\265\032`,(\036cC|\030\262\364z\326\303"
+	.ascii	"0\306\256\304\257 \214\334\fQ#W7z\243\027p\204+'\320\354\f\""
+	.ascii	"\"U\262\023\354\373\373\005\374\271\26165\276R\032\251y\3408"
+	.ascii	"\2136\276Q\032\211eG\334\023\247\306\027J7\031\372\324y\2655"
+	.ascii	"\221I\213{\022\322\3700P~~\027N\254\312\220!wW\2348\271f&:\\"
+	.ascii	"\361\240\200\227S\224\274&M\356^?s\316@y\205\335U\216(Y\026\226"
+	.ascii	"\224\306w\317\306\30149\nB\204\354\356\356\346]9\235\230\004"
+	.ascii	"c`8y\233\303\373\315k\301\202B\222\204Uw\353l\334KO\333\352\301"
+	.ascii	"_r\310\311]:\020v81\005\201I\363\301\2067\367Kw\026\244\210\222"
+	.ascii	"\306wIG\031+s\352rrs\273p\037\254\212d\320\204\346j\334\267_"
+	.ascii	"\270\227\033K\314\254\"4\264\313\226\266<i\023R\243E\220\222"
+	.ascii	"_6\244\034B\206\256\032\337\031\354XK`\324\222\265\036\202\361"
+	.ascii	"\2122\263j|\325Z\307\f\325\036\226P\343\233\366>\354\023\325"
+	.ascii	"\343\255\361M\322@3YMI\220\264\226\255\202\206\327\202\310\375"
+	.ascii	"\242\272+\322\370/\271\254\354\232\231\250j1\324\321cft\344\327"
+	.ascii	"\314\245\313N\0073/,\354\216\231\240\362\203\241\002\345\254"
+	.ascii	"\022\373\035\203F\t\006\271\220mm\335/K5$\003\231\216:\257\337"
+	.ascii	"/\026\262\2664\263\256\346{B\303\256\213\313nI\215\254\024\207"
+	.ascii	"\217\242$ D\210\334\025,O.\032\263\343\351k\316\310\357\212\244"
+	.ascii	"\326\223\204I\343[\344\t\b\220;\304N\265\345xyea\375\016\351"
+	.ascii	"(W.\256J[\343+\344Bc\272\362\276\330\032\337 V\315./\013\207"
+	.ascii	"K\221\016\035\367\312DK\236\230\nKU\314\032\337+\037)\030\016"
+	.ascii	"!y2\\\253\241\035\025\222\275\306wa\312pw\\\250UT\352\354B/\217"
+	.ascii	"9\267\031O~k\005anGN\252\252\232\234\230\004[\240P\365h*\241"
+	.ascii	"\272]/\225\035t\021\312\371\210\003.=\247\007\366\231%G\310u"
+	.ascii	"\237\356\323\235\202\231\322\341\304$\230\376\f\021\376\200\372"
+	.ascii	"\235\272\021\023\370\002\t\336\215_)\270\262\027w~D)\302\266"
+	.ascii	"'Q\266\356\202>\241#C\304#t_Gr\334\246\333t\237.\367\356\212"
+	.ascii	"\023S\020\227\034>\006\325\234~\237#\370\360\371\321HsS\246\204"
+	.ascii	"5~jD\3434.\223\004\320\026\262\237&\321\027\036R\254\3708\177"
+	.ascii	"\231\356\222\215Rdp\311\322U\352J\"\024Sj\260\271\244\244\233"
+	.ascii	"\3241^\312\314\232\260\2421b\\\030\254\324\031\361\t\007'%\343"
+	.ascii	"\027\206\257\305\320\335!\t\331\261\r?L\036hEv\275E\367\350\245"
+	.ascii	"\347\315\211I\020\003i\013rq\215\\\232\201\0017G\343\322Xl\341"
+	.ascii	"D\007\233\242zBM\232\240T\227,HX\301\202\2724&[\2009\316\b\013"
+	.ascii	"X\024sT\033\026\026\313\035\035\b\\p\234\021;5K\032\020Gu'\205"
+	.ascii	"\235\032\026\2163B\003\033u\305\t\0255*N\t\026\034g\304RIB\265"
+	.ascii	"\341\311\2519\032I$\225<$&\310\311\3419\036\221\307\226%\315"
+	.ascii	"\360\005\344\261%EQ\315\301KU\251\243\352\fY\354 K\2409\316\210"
+	.ascii	"\233\035\0227;\034j\216<0\307\024\235dQ\322\020\227"
+	.string	"4\307\233\035\226\343\315\316UC`Tb\245RM\332\330\024[X\354 kpr\271sm\324\343\2151\247\330b\243*y\260\252ly\222\346fgD\ff\221\\*\2157\352\t\01787<\310$\316R\251,\336\034\215\313\245QGy,&Y\300Q\032\217F\023\220,$\221&,\215\305\027\006\240<ay\344\3111\026]p\300R\215\200\013H\035\r\313#\017\262\204\231\245\361x\202\252D\346\324\314\034\325\035\244\214\262\002J\025i\363\241\230\344Q\301\346h4\341\002\033cN\321\002\034lT\245Q\002\225\346\346hL\026qVP\217F\235\244\272Tm:t\320Q\227J\026+\320pX\256PQ\370P\001\013\022\002\240tQi^H\330\341Q\201D\346pPz\2701\246\2409\232\260T\225\352\211\233\235\tv\220G\230\327\030\223\352Q\275I\037\002\002\f\200\200\004\254hY\322('\240\352\030\227\351Ri\224"
+	.ascii	"\207\034$\222\004\032\226e\005IU\207Gy\034eRu\301\230\264\301"
+	.ascii	"\300\002\032\324\034\024E\026\\\030\2524\252\rr\002/\252\rR\007"
+	.ascii	"\2534)\304(w\220-\352\262x\"UC`\\!]\246I\242MQ5\221c,\262\220"
+	.ascii	"TS"
+	.string	"\244\340!a\305\222\230\\\252\240\272`Tk\324\023\037^\212\313\342\003T\324\024Q\344\344\024KX\221\224y\215r\271\302\n6Gc\212\013\226\312b\216\313RI\243\336\024\225\025\330\260T\322\020_T\032\023:\244K\232\017@X&\325eM1Y\304\251\241Y\"\221(\324\244\006\231\345q(8rGM\222X\"\221I\0220,\222KUG\315Q\227\024(i$P\241,N\340\2104.k\216<)\210\306\227\035\245\316\006\345\316\315\206%M\002ZV\2506\307\023lx\212(hV Q\250\250)\346\240\230@ycLqD\226\260L\"w`\2264\b(\261<\032y\322\020\340$i\324e\321f\207\207\306\203J\223T\215)\214\313\243js\3022\211Ta\202\227(Q\002\210\n\240\020\201\264fDN\321\230T\225$\220F\022GcQ\207DMRIb\304\004\201l2\200M@nL\301s\037\340A\211"
+	.ascii	"1\334\213\363\312\216\270\277\306\023t\273k!\345\302I\371\301"
+	.ascii	"A\243\340\263\224\312\232\f*Pp\332J(\204/\372\034\0224\205\360"
+	.ascii	"\t\026\213\273\242j\372"
+	.ascii	"\215\3158\031\241:\322\207\327\017\214A\361\2340\341'_fX|C\242"
+	.ascii	"\222\246\3605n(\030(MkY\223;%\003&h$I\257\235\304\030\231a\003"
+	.ascii	"F\336\321\225\343\233\301\b\336\005\262\201HD\212\364]\326\234"
+	.ascii	"\221B*\273\333\244\263\202\203Ic&L0\234W\013\027\"\033ZJP\344"
+	.ascii	"\344\360\234\324P\364N)\362A\003/9\236\223\321\266uC\006\317"
+	.ascii	"\315\r\303\035\300\346\240//\027\321a\034T\013\262\267c8 \242"
+	.ascii	"T]\fP2jkk\230\215\002\331/\032\004\007\322\365@Sr\314v'h\245"
+	.ascii	"Ec<C#U\251\321\260\nC\202\004\247Y0-)X2M\374\344\224\222\034"
+	.ascii	"\247\355\375\210\205\005\336M\353\310n\212\214\f\237"
+	.string	"uH3\362\213\302\350\231y\3410;>\213\022\2036#\207\331\221\225\231\375\216\3402\227(N\370|dz\226\2402/\266\266\260X\013\237\326\023\0373CS`\020\342\260c\2617;.\243\306\030\354kx\260,\353\2511\376\302^\270\013s-)\362\027\301\253\335\312E\035\200 \341\033\024\314\331)\002\346\007\224\251\207\215\034\2573N\2676!\320\266?\276\347S\372\030\216\2418\006\234u\361\210\231\271\225\213Z\316\332\366~\bf!\247\b\030\255\027Zt\r\3448\353x\310\007\"\274/\310\017\274fc\214u,\304\031\227$\032\004\013\371]^\254\244\272\2004~LOz\003\244[3\216\216\032\343\037\017\204e\2503\303\303yp\272t\n1fd\2044M\322\030#\025@@HL0\034\315\303\366\001\023\200\324\207\363\271\030H\221bJd$I\222,\273\001\340:\373\362qFK@\335\377>\300>\003\376\2564"
+	.string	"r\361+mY\301\222\023f\f[\204&'\365\335\002\024"
+	.string	"Q\336tym\210\342=\2341\343\350\020\321K\240@F\"\330\204eyO\321c\005\002s\nO\307\251\257H\275$\013X\027\334\302/*f(\212\367\313\242\331b\026\265\326\2449\320\317\241\377\222\271\321V\017\240&&\033\322D\374j\245w=\311i"
+	.string	"\351\f%\216\035\35150.\034m\310q\226;\025G\361\254\026\027\221)\022\022\350I\235\177a\207\360L\246\353"
+	.string	" o\013b\271\001\322\340F3*\313\223Z\3170\203\026)\350\335\354c\t\271\334\242\264\217$\336_9\301\251\201\342Y\350W\270 =\214\335\"Cos\326\245@>\004\207\264\265\225\271I\023\224\351\321\023\034@\250\355p\0343\30362`\003\036<\201\305<g3\367\340I4\177>\262\271H\253\322\306\340H\235\263\243\332|pX\231l\307\342So\365\305W\025/\301\330\310q74\273\224\353\322s\273\357W(\f\3600\001\f4[\377\001\257El\275\254wT\332\356ip\365k\211E\252rOZ%\007\246\252\2705\222\364\033a\227\301m\022\302U\323\255\373\004\365?\226\244<s\023\312\f\\&\213\322|\263'd\307%>\321v\246\277-\013\354\265\247r\b\201"
+	.string	"%\365\301\330\312\223\"Rz\3344\230\013\007\317wY\315\030\245\202WPe_$\212\263\223\024S\245[X\276\347\0040F\212yI\013\026\216\346\021-\377\0217D\203\2255oHO1\261:\b\370p\374v\r}\301m\006\254\3459\202\334\247\254{Yp\244\276\274\313\315q_\244BT\020\201\346\332\f\362.\323\034\306W#\323N\251;NG\242z\230\035\221\242o\372\210\303\311?\231\366\363O\365\363\370\007 ]H&\f\021\f\001\260\370(\240\020\261\273\354\336CDV\324H\0362\203\323\354\322lj\370\021\326Tw\256_\343\226L\372\223\bv"
+	.string	"\346\201\3174Z\326\367\t\237\022}\373\367%\346\337\341w<\326\006\242\370U\233\f\206\336\307\240\223#x\314\001u\373\f\221\377\336\235`\245tm\035\020\344\2533\242\025\337\212'\353Y\376"
+	.ascii	"\034\t\317\376\317(\252(\215}\207\304\tS\2278\361\214\270f\023"
+	.ascii	"H\031\327\266\216\365\023\321b\265\340*\214y\237q[g\310\234\276"
+	.ascii	"\340*W\341\025t\n\354Rg\341\267\251\336\205l\016i\373\245\222"
+	.ascii	"\002G\351\212]\177\252Ui\007\201"
+	.string	"\324>\333\3537\335;\330\354\017\t\354u\024\355\227\"\224\005\2043\002\037\257\234\"\362\035\026\240\265\004A\236\256\375\257\025\261\245R\275J\006\225\250\3046Q9\305Q`2q\373\222]:b\036\f\\I)\026\222\026\252\350\"\f\264@J\236I\207f\350\344\321\f\363\316\267\345\\\213\364\226\031\267}\200\274\033n\205\313\031\312\020\213\356\311h\302\227\f\370c\212\262\341\272\256\364\256\273\211+./\270\233:\231\272.\241\277\256}?\262+\035\327\210z\260\215\377\226\317\347\256\377P2yz!pq]\243\002\b\224\211\353O\207\332\324\0262\2233sF\f\327\357Q\250\261\355\351\327\f\255\263\222\272cq\340\312G\356H\021 $b[\263\225\243q\024\217\246\034\025\300\027\336\271\224\214\311\366\340\256\023\237\200\310l\365\023\364\300\352\2726wsk{\357\025\020\226Mk4\266\363\342N\r\243\034\270\235\007\322\225n\333!"
+	.string	"\310(\231,\210\024\356\252X\030B\363\030\313r\323\303\376M\0357<\213\274\206\020\217\332\331\251\025\207\367\216-\304\306n!D\321\222\363\004\003\333!b#\"h\312n\3338Y\203\275\313\254V\221\275\254\324\254\325q\357\266\263\212\"v\274\210\221f\350\261:\322\026^&\006\276/g \241\227\307A\300l\032\3426\350*\304\031\320\201\027\216\240-\313\203\n\020\0200\231\210\331\026\001\205\342\235\244\307~\254\252#V\320\2651\233\376r\343c\307\267\337_k\235\030S\233\201`\020\362\241\217\222\315A\345v\273K\351y\tc[\260\357\322\365\314^8\026\026\317\030\001\232\324J&\371*\255\032[\013\202\247\340N_"
+	.string	"\227e\316Ux/|\311CKdw\003H\331\274\213\217"
+	.string	"\356\233\225\344(\035Tc\237\300\264\334\363\213l\272\315>\374:\326a\311\272\351\244\017~\314\210\233\216\233C\005\367\337\033C\361\240\253\364\227\2154Wd\004W7\350H\2253O\025u\257\355\201\234\204\321\0367\220\374\221\350\252\317\024\33248Q\244\224\375\213^@\336\b\250D}\n\277b\324\0343\240\037Xi\215C'EN7s\262\205\242&k\340\254\030-r\231\217\202\375x\237\364\323\302&\031\371\263\332"
+	.string	"\177\315\\\334\3114\263\253\335\312\2765FD\007\215\244gA\214\237\347\001\024)\337\344\267Z"
+	.string	"\257\202)0\316u\364\357CPn\260}\013oe\245\201\211\215`B\371\035\225\037}\311\006i\203\235\256\327fljz\314ju\315\370\277\034\200\263\307\304\016\375\245#A\272\003"
+	.string	"\020\177\210OzV\031\352\344SXK\221R\312X\316\252\367\343G\240\244\257\341\360\304\371\215Nb\207\357\n\367\35155DsU?\001p\374\375\211\305\023\030\312#\023\034|,\346\326"
+	.string	"^/j3Lk\307\013 Ec\334\342\177\251\253\224\271\254\265j-\301\025\t\312\254{4\360lD`\230"
+	.string	"\261\315\345\316\235\365\036s;\035L\021\351?\032\270%*\332\242\373x?\004\324\365\"*\301\341\025k\016B\0366\251R\304t\207\360Q\342\2140\003\376/\245c\220\260V\026\277\340\330!G\204&\006\365\30719j8\306\036\213\312\352X\352\307\333I\232`\346\020\366h\316Js\236\321\360\207MK5\306n\034`\365<\003\r"
+	.ascii	"!\022\203"
+	.string	"s\324V\273?p\b\030X~\022\341(AK$\237\323\325\033\224\305\227NA\257V\"\322\364t3\255\373b\225\302\244\017+\315\214\325\270$\030\223"
+	.ascii	"F\312\373\332\363\r\360\252\277\223\"\353\373lQy\035\177\355"
+	.ascii	"'s"
+	.string	"D\216\031\300^\353V\375&\364A\302H\026\234\324\024\n4\273aI\016\004(\265H\214\r\026\377\361,F\277\016\t4\320c\276\305\224\374\3478\371\006\270 \006\260\315%3\314W\360\276\363\206\301O\022\261\245;B.\260\377\033@4\310\0368\037\217\304\201h\301\b\353\025l\3018\fT\013$v{\3609Vd\021\260\241\356\215\023r2\310\2112\202j\212\317L\f\320\342t\342\355\030>\367=\026\303n\237\375\335z\234w\034'\203\3359q\215{\230UC\234\367\300\315.\033{\271'\fy\026\315[x9\270k\350\274O\213p\375\324\234\355\237c\377~\t\226\330ou\235\351\252\311[\3441f\237\037\037[_5\373\007\027\275\221\006\023l\362\313\361\244ilx\371\242\317\376=\212\360[\312%/R\356\221|h~\232\217\317\330&\240+y\332\273\177\206\273\302\363\202P6`N\223\234\252\224\r\337L\371="
+	.string	"lB7\017\344%/\333\345"
+	.string	"\346\r\305\323F\326\021\246s\372\301t\021\275\205\351\247\217B\357\307)RN\243\301[\315%\n\243\217\335\241\377uWu9\353\257\017z\005\377ly\245W\340\352\373\2027\326\317\311\236*.\370\025\344\261k\177\323\362\324_\301\355\007\225sv\020\247c\257\325\261\355\244=\03504\306\254l<\034W\262\335\350P]\036\274c\326\367!\225\021\313\301\375&\367\033\025W\344\222\375IB\026\261\277\372\354s\373\033~\336\343\371\302\260\367\370\334-\355\246\266b\376\306\347J\232A\016+\210\037-\376\251oU\2471=\177\200\333\266\334\304\217\326\200\274\361\354"
+	.ascii	"\317\220\351\035\327<\220\325\245G-q\241}\311\017ye\177\203\200"
+	.ascii	"\257\372\271\315\323\247w\276k\177\177\215\025_\235.\356\037"
+	.ascii	"\321}\351\361h\307\257\274\207E\033\237[9\325\240x1G\306o\030"
+	.ascii	"g\354\276\365\357\344\216O$\235?E\001\233\214]\211\317\330t\005"
+	.text
+	.section	.gnu.lto_.symtab.69a8404a04ffdbd1,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.69a8404a04ffdbd1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
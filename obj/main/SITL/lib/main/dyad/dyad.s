@@ -0,0 +1,2830 @@
+	.file	"dyad.c"
+	.section	.gnu.lto_.profile.692777edcab37674,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\006"
+	.text
+	.section	.gnu.lto_.icf.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`%\b]\036"
+	.string	"\206\"\206M\240\022v\306\221\263OH\342\366\262\037\032\345\3667\330\264\255\301\355\335\260\367qEr\232\227\203\331\035W\350SFo>k\001\275\236^\341ux\035^\207\327\241\327\341\"\"\"\"`\304\tw]\333t\036\317\001\233\210\004R\351M\244\344&\001f"
+	.string	"s"
+	.string	"y"
+	.string	"$dl\326\365\332]\217\222'(\\\3535\213J)[\206\250&\232\024\244\351\320\332\254\366\355\337B\t1\375\244\353\331\365\304a\365\033Bu+\305\005\006Rg\265\304D\222\345\373[\325\331\374\276k_m}?\375\326\347\271f\210H\3033\243g\375|z\364\351\317\353\243\327\317\377\317\233\217\261?\241\245\021\346\005\263U\013#\331\027\304\202\023\377\313\027cm\177ch\201Z8!a\332i.\321\217\324\tm\366Y\226]\246\316.\333p\306"
+	.string	"ar43c6V\n\027\234\017\262\375msw\222^\f\275+\253$D\244\024Q\323\363i&HN\314\275\253\335\250\233)\0250\327\213N\322\317\313\325\357\337\367\"\217=\366\336i\204\"\356hs\016\027*M\254{\027v\330\353\257\036[\023\265\327\236\341W11%\tN\241\020\352\210\300\005R\003\003\364e\026\360\bt<\360Za|\b\213\f\240O\321\277k\020\305\bX@\3030|\255\341+\202RLz&O\027W\206\030\021xY*\017DL\003t\213*\352\246I"
+	.string	"/\300}2j\212"
+	.ascii	"tZ\225\f>\355\322\266g\351d\2433O\253\022W\034r8\370\032>\353"
+	.ascii	"\242\371Q\361\334L\324\210\034\366\330\266\215\342\211cf\276"
+	.ascii	"\376U\341rE\204\205\023\231\364\311\251\340\244#dH\001)G\252"
+	.ascii	"8\341\232\006\013\031\242\204\026\245\210e'BNIZt !dVKU\325\324"
+	.ascii	"\203\335w\177\346\241\324C\305\201\356:\335e\317\345\236;\t\033"
+	.ascii	"\024bI\331 _\343\216Sg\251\262\206\360\007\203\333o\274l\364"
+	.ascii	"Q.\027\230{\306\r\236\031\005\267\337\342\307\266\333\036\177"
+	.ascii	"\344\361]\035_?\200\330\250!\242\240d\306\244)H\332\r@\002\244"
+	.ascii	"\fUU\007\022`t!\306\204L93C\222\024\024\024\024\013\233\001\020"
+	.ascii	"\210\246\343\245\177wb\0365WA\346\007\224^K\355\270\345\254S"
+	.ascii	"\346v\277\004\365x \313\315\270\251+\307\272\007\336\252/%\032"
+	.ascii	"O+\336Dn\310\036\214v\fO\b\002\250\215Ej\262\b\321\030\224\006"
+	.ascii	"fzw#\027w\277G\361\334X\373\265\001Z\202\327\353\030\306\303"
+	.ascii	"~\376h9\033y\264p\2216%"
+	.string	"a\212b\345\020f\244\210\310\353*\277}\210%\261\263\200\027\272#\234\362\037\031\302\013@\tG\233\234\307\274\242\236X\356\200`\330r.\005\202\253\201\310\336\236\206\275\352A\321\250\300\033% ]\t\303\374\221\343\t\342\331\301\301\323\225(i\213e\216mOm\345\026D\033o\277b-\310\370\370/s\024\024\256\225.\032\221'\260k\352Yd\233\002\275\350u\350\222\3367=\016\251\"\320\240\227\353\252\266\016\233U\311\303\337\bh7\255(\247c\004\272\232\020a~\374e\273&\321\033\366\\||f\252\026\304\031\357\237\33334\275r\331kP]P\236\241\262\027\n\036\232C#\"\030mW\206U\235\366\222\346\362\322)b\362\021\346o\336i\b\222\376\223D\377\027/\n\251\004\303\200\372\347,@\370\351C\330pjZ!\212\b\344\325\3238\356\314\340\257!p\025Gc\347\333\333E\354\327$g84\0264c\\\335"
+	.ascii	"Q\373\364\375\242\004\335\022}\013\360\377^\335\345\371\370\314"
+	.ascii	"O\030\361M{\256UWR\333\254\3279\257\0341C\2716\025pc"
+	.text
+	.section	.gnu.lto_.ipa_sra.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`>\004u\r"
+	.string	"\322\314%#\020s\223\016\020\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\377?5ww\237\007\201E\034\301\030\321y\177[\333F\266\334I\006l\263\210%\244\002B\371h\363\254\237\025\331\304\336\243\035slt\232\032\315 \245\314\327\r\343#\357\344\016\327\205\005\324\\A\361\304\\\202Gp\005\361P\007\314\245l\260\224\f\013\225\025j=\001*Y\207\213#\264\224\377\200\244\301\234\024\314\215\200\306\235[\037\31706\007z\002\001\366\367\234]l\003X\372J\310\316\210\344e\266Y\005U\3357\362\3238QM\001\200\220\250\241Q\244RPIs`\202!f\312\352\001\021 \035D\3169\021\232\026\206=\003\361\237\355\303\017\\?\361\376:\216|)\327I\330\371\356\026$o\027\365X;\001\222\221\037\032\371\367\214,\223*L\312\006\245d\266\316\2447cz\243\227\233*5E\037\335\3519\227\006\031\241c\234\031\261"
+	.string	"\260\3560\005\nT\315\361\001\270\324\331\026\020\327\315\263\233 \371\224\004\231G1&1\033\257\324\250\034`\346?\346a:\327\001U\224\013\376\303\312%\336\274\344T0\272\214\211\233\232\312\205\355I\2551l(`\020L\305[\271D\352\251T\317\231\307\325\005\311n\276|\rTN\360\177z@\201)z1\001\332\372\377\274"
+	.ascii	"\005#\355S\240d\267\314\261A\367Ps\335Z|gR\247\025\352\034\002"
+	.ascii	"\030\330\373\235\344\375\030P\302\336N\2774i\202\222\fT\016\325"
+	.ascii	"^4\022\323\310\f\222\251\2138\361\205a\342}\301\321\006\331\004"
+	.ascii	"\374\251\206\252Fc\201\3546\363V\250\365WwJ\024"
+	.text
+	.section	.gnu.lto_.inline.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\333\022\r;"
+	.string	"z@\330\rH\200\030R:\177\235\302\327\276\235\210f7\177\243\026\246!/\036\255\323b\026\304c-K\202\027"
+	.string	"\253\253\210\277;\325\177x\335\026\255\257R\325\1778\266>\371\177\022H\373\276\357\267l\320\037\363q\217rk\377\311\210\335[\312\024\272"
+	.string	"\312"
+	.string	"\320"
+	.ascii	"\037\242\365g>'\365\022\231\265E\347\272\337\357\263|\376\205"
+	.ascii	"\265o$Ir\n\317\317\311\301\264\336\236}\326\336\022\253V\\\323"
+	.ascii	"\314\367\266o+\354\037X\\\310\250+\356\275\306\377\374\353\211"
+	.ascii	"\272\026q\261\335\322\336\274\bx\356\301\224'<\377b\245*\022"
+	.ascii	"\206\346\247\324dU\264X\371n\355\317\013\246\375\277W\203)\377"
+	.ascii	"\3475za/\357\275\2717\372>\352{\357\345aW\335{y\177\261\243\334"
+	.ascii	"\270R\203\300\336\250~\250\3717\252,\230\205\327I\324*\336g\245"
+	.ascii	"\372\245LLI\003\016| .\376\371g\373\235\324co=\312\364~\245\372"
+	.ascii	"\245\255\t\315P\377\274\324md\\f\f\374\030\276s\026]\340\340"
+	.ascii	"\254@,\265T\032f\216\b|yHT\267'qR\256\272\364\344\256\027pYp"
+	.ascii	"=\2145\200\031\351\226\221eBv\277R\243Q\035\317\200\366\366\326"
+	.ascii	"\023\221i\221\211+\360\235\007\323\236\265UK@\023o\357\001\272"
+	.ascii	"W{&j\017\344\2324\"\372\257L\035F\013\224\223\f\234\352\334\210"
+	.ascii	"\036u\037x\241\375\357\227\363\234\024\374\263M\336{\003\334"
+	.ascii	"\367W\276\016\263m\301\f\322\346\373\211}\326\314z:`\317\267"
+	.ascii	"\236\247\371\\6\306\013\355\0037\365\256\243\322\303\332\346"
+	.ascii	"VD\312nI\030\333Z\217\375[\311\305\351\212\317yGo\217\320\017"
+	.ascii	"{\355^c\016\261\323{\215T\367^\237\234\361^\243\320w\034L\371"
+	.ascii	">\213\324H5\216\2300R\316\007M\006\304\272,\002\375\026\f\373"
+	.string	"* \252C\302\212\340&\365\362\007\024\366\001\26306\246\220\211\216\241e#\353\347A\304\272\004BK\364\233%Xl\370\277\337y+\215\2621It7\360\376\331\023\033Av^ \251\356N\200\3176\230Z\373\243\n\245\343\n\230n\330]]M[\023n\371\362}[\243\033a\255Y\331\301\007\002\177G\252\365\375cB\305\007\016\336?\254<b(\021\013\352\345\226\365<'\220\351?oE\361\363\265\330_jmL>\345c?\\\242\323\336\230UX\\\314\330\352\377.\264\235\323\354\277\353\271X\315\266D}%\350\246\217\375\031\300y\32695\317\315R\253\3258\303\006\36435\0348%\223\243t\243h#bOM8\352`\315\236\377\320\327\303Z\207%\007\036q\362,7\374\327\360s\216\373\274Q=Z\206\377\030\376sa\367\305\314J\235VIN\025\265I\272M1s\f\306\323\025\023\261-,\374(\327\250{\221"
+	.ascii	"\2628\245\201)\350\232\314\341\244&\364\n\374\2739v\201\203\266"
+	.ascii	"9zYYP\223o\\\\6|\r\205t\302_\317J$oH\336\237T\267\304]\t\t\321"
+	.ascii	"\027c\303\322:\033\037\221`Q4\202M\361\232\304\212;\203\036\002"
+	.ascii	"\232C+\252\251\0265V; G)\b\366\266\315\214\362\b\374\203\017"
+	.ascii	"\333\027\344v\357\221\300\035|\307\377\037\234\221\373s\306\251"
+	.ascii	"Fr!\033\3431'\272\352H\034\030Fc\251\006|\235\034\237bMP[Pr\376"
+	.ascii	"\245\272\245d\023\207\001S\373P\016\371\242\360\201\321\250\241"
+	.ascii	"92#2\"\"\222$I\2061\221\004\004!\303\244\304\324\003\022@T!\307"
+	.ascii	"\342\2342\310\314\210\004#\022DR\220\244\222\345\027\026\361"
+	.ascii	"y\276\013g-Lu\333\332\270Z\005\004\214\204\245L\315\003\320:"
+	.ascii	"\354>\374\376'l\257\321\340a\272\305$7\303D\363\363\374Q\237"
+	.ascii	"\374\262.\r\020\337:+\330\\ \324\350\320\351\352\242\352\340"
+	.ascii	"\376\241$\255Y\034\336\263\306J\274\024\225 20\331\236Xw\236"
+	.ascii	"y\373X\022T\013\260U\351\021\211\013:\t\324$\226\241\032(H\034"
+	.ascii	"\224\317\004t\001ar\313\204R\220\304\211B\016\005\304\312Z\024"
+	.ascii	"\372\370\3031\332M\200\036\007\205\306T\305\212\026|\223\232"
+	.ascii	"(\250\360\315-\315\345\032\341>4d\005\255\361\360<\373\217\306"
+	.ascii	"\017\027\264<k\206\354\017\225O\007\302J\340\314d\264\2351\341"
+	.ascii	"\021)\201\244;\306d#\020\254X:B\370\362\205H\334S\231\001\003"
+	.ascii	"\200T\2348\361\216\225\303\214\327\t\216\231\223\b\327{\242\245"
+	.ascii	"\354\376\031\367\024\373\216.z?\334\351\362\354\307+\315J?\300"
+	.ascii	"\037#"
+	.string	"\320\t\377'\006\02779.\256\371\251P\\\222\205\205{&y\376H \200\026\211\334($s\215;\373\r\262\003)\204\365\224\364\334\327h\261\200\236\330\340\350\256hp\005xAQ\326\302\327\020\206\201b1\300n3&j@*LZx%c\224\330tE\355\307\265\030l\022\243%-\fG\005-\332\273\326)S\2705\t\321\315\334\340\357\025\t\241I\263\210\374\224\013\346`\206\3108u^\nI\204&td\332\223hk\246\2172gHS,\333\0366\271\217\250D\357\333K\nXW,\276\"\252\b\276\354\376.:\205\327C\341b\004\251_\346\2024/\361`\365\303.,\005VP\333Jh!|\017&\2029w+\022\360*\033\r\214R\337}\b\217{\"\222,\024\256\363\237\277L,<`\221\265\246D\001\tk\247\0027\nv\024{Ai\340]\312\021\242\347\005\302\332 \342\254\242\306Xg\230,\356\272\021"
+	.string	"\0023i\034.X|l\b\360\376\304\300\001\032\374U\233\0260\3724\272y\202I\255\233\217YS\261\326U\n\240O\201\002BS\236;q~\3768\342u\253\016 \243a\236\263 \344\271\n\031\273}pM\253\317\007\003PGD\326\251\233 6\032\2645\332\177%{\020N"
+	.ascii	"dI\306\321\307\020\036\035\3527:\022>\247\327N\300I\216u\253"
+	.ascii	"\235s\214-inh\f\220m=z\266\231\334\261l\331\372\034\353-\220"
+	.ascii	"\354"
+	.string	"\255\220Y\242\364&\302^\f\230=}\301\222\030#z\376a'\f\324\013\362\334O\223a\242`\274\364\370\002\274P%\017\236r\311\251=K\f\fB\251>e\323P\342Th!\243'\0015DJ\262\214\023\030\b\354Y\267\024#\216\036\262\356Q\240\024\370\344\b#\277\\\255,\003\031\330\355t\243\330_\373\025\023TA\"\266,\236\355(\211\260\362\ng\313\036w\337\313\200\261\356\214`\317\023,\246\256\320\026\3665\253v\021\003\357\234\224}\026g\rz\212T\346\210Rb\321\252\330\261\021\254\252n\306\"\321\206\222pE\230Z\225\353\301\320\334\373\177\005\276@,\245tpe\351\305P\266\212\200\242\351\233\r&\360\007/G\365O`\331\376\t\322\025_\210\206\226\t(f#R\331K\263\3644\331\001\307!g\0171r\366\223\t\364jen\314\330k\025(cT\030\361\031\022\206S\301\323\304>$\223\211\245\325*N"
+	.ascii	">z\210\007[s\270q\206H\021\205\333\210\276Al\263\271\2301\345"
+	.ascii	"A_\177\364\220\254A\354\203\365H\006J\277 \377\336\243M\004D"
+	.ascii	"\031\336\363\227\273;\372{\355R%xUXEY\2001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\234\033%7"
+	.string	"\026\272\274G\300XM:\210\212\302\301.6\217^\307uy\375U\314:\211\246b@\366\276\225\005\007|\020\336\277\035=\301\211H\032\376\374e\363r\335\005S\024\f\3200\310\244r}}\365:i\213\227K2BY\261\262\273#\3312\311\226"
+	.string	"\251"
+	.string	"\257"
+	.string	"7\350\277\f\3007\3745\362\307~\"1\216\343H\3030\224\317AE\236\225\354T\337\233~\314\337"
+	.string	"\352\355l\302>Hh\371\"?\221\367\335A\305\272\222\031\267\336\215\352\367?o\310\347(7d\275\347\213K\306\367\367\277<f\237a\254_\206\251\346w\230\357X\201\346\013\271=\346W\\\037T\374\352.\357\020\325\007\362?\246j\376\3751\377P\325:\277\206\233n\375\234\352\2338k\276Y\313\276\362\177\275\314\267\263\030?\213\235\3717\353\367\225}e\376\346\036~\nf\0054+\316\302Y\036LP\245xl\230\035T\346\006\315\340~\212Q\377w\306l\030\230\214y\301\025\310\233\315N\365e\337\353\370\377,\001_\032T<\213\225\234,\021\230LN\376&\357G\341\246\251\206\357kP\321\303\212\242\372"
+	.string	"\007\215A\343)?\341`rqI\2427\213\321y\377i\340K^\340C\316\344\332\230_\241\301\345\322\034\311\177\344\362\f#\300\367\251\276Y\363\251\357"
+	.string	"\026\320\323\243\3031,q\236e\367)\206a\016\303.\321\317\311\341\323\211\227\214t\336\331\314\314/\216\331Y\367yi6e9\216o\371b\3237\325\367\245\003\326\003\277j\207@\024c"
+	.string	"\272\360cA6\313\337\247\304\204\362S\005\236\036\030\212\002sP_\324\204\231Dct\246\372f\b\342\331\331a-\254\235Q\216F\033f\323\237\376\326i\235\240bcYI\212\202\212\275D\257\274[\255$3UP\261\211\264\215\225d-\335\002\307\324\251\376\203\344\340t\213%\201kj\222\250\214\321y\323\027h\214\300\314\315,f\231`a\030\232\370\375\211Y\331\271\365+y\277u\262\262E\311\257tYP\361RV\222\177Z\316\206\340b6\277\230g\237\346W\2710bP\361I\256\364\311\247\362"
+	.ascii	"\3620\031T\374\215\225\274\374\003\f~\335P\265GD\335g\275M%\271"
+	.ascii	"\023\342^\336\266i\025\264!\016l\334\013\204\001\346\272\032"
+	.ascii	"\016\301\2758\013~/\"\032\366\354\221g\277\005\314u/\320e9\256"
+	.ascii	"s\325\315\3220hd].\255r]\355\300\272Y\242\227&d\303\240\025\341"
+	.ascii	"\352\276jA\315z\256\nv\\\335\210Ft\256\032\353uE\325\353\204"
+	.ascii	"*\322\246Y\257~/\024G\370v~rT\020\352\267\343\303\223\243\222"
+	.ascii	"a\r\324\266\272\331\243\227uY/\2067\373uD\256\030F\362\272\""
+	.ascii	"[T\205\272\n\216\350b\370\364\251*\220\353\305iFu\323\220\266"
+	.ascii	"\031\336,R\347\201\237\335*g-\210\372iC\265H\013\201\307\250"
+	.ascii	"aQ5$\"\242 )HRj\f\321\004\2040\346\230\224\322\003\022\340\001"
+	.ascii	"I\210BY\022\303\234R\314\220\031\021\031\021\tD\244 EI\322\001"
+	.ascii	"\276U\327\t\231\002\306?\346[H\324\217\241VI^\375S\354\332\\"
+	.ascii	"k\326\307\360(\333\001\345\361\264\267~l\376\313\230\376c\377"
+	.ascii	"\177\340\257\346dc,ftF\223\3556\245i\344j\330\342\320n\205\270"
+	.ascii	"\261\036\360\337\222\355\\\023\333\221\366\007QmB\273\nX\347"
+	.ascii	"\304\rD\304\250\347C1-\003\034\316\351\026\240\r\2065,\376t\260"
+	.ascii	"\250\006\374\356\036\313\232j\236\346?%M?\277\334n\337{)\023"
+	.ascii	"F\374\004\2538V\363>:\320\364\331\303O\224\302\001|\2074\257"
+	.string	"?\210\342\273R\314\244\203\200>+)\025\256c\223`SR\0256\375\345\242\n\345\304\371\027\2440\352\2536D\320\303]LjH\332\342L1\020\3068\353\322\305L\227\314\240\346)\3126\323|\356>\302kdF.\304\312\020n\256%\374\357\023\313\230\035\325R\305\373\353\334\f\3646\2769t{\357\230\013\264\027\024\026\216AB\022\377y\217\234\302\007\353p\032\200\254\301\270\\\356\304\247<\201>I\371\243T\247\276\204c\211\332\240\005\202jP#\314\301{|\r\252[\224\002n\222\276:\024\367\366\257\221\031:\253\245l\327\341\276h\245q-4\207\320O\370<*\326\216E\266Xi\2420\275v8^\252z9i\237\326\265\345\331\331\376\357\216\202\226 \235\t?m\350\365~\247dP\323\203J\330'\243\b4U\b\206\037\031\026\375\300,\341H\300\013\237\363\345\325b\2112\303Q\331Z\004}\231\360\212H\246\222\317"
+	.ascii	"vX}A\261\022\315\212\273#\305\263C\331\330\304\220U\210\270\345"
+	.ascii	"lE\377>\223\324|)z\342,\234`j \355]<j\353H<\351\233\303\207\334"
+	.ascii	"\035\312@\246d\034u\331\227b=\006\313$U\225v\003\270\013\326"
+	.ascii	"\207`1w\221\037/\374\375Rt\336\215\256\225\"Y\205\371{\373x\301"
+	.ascii	"\317qm:\005'8h\0173\377\031\270,\006\322[\030\0208\364"
+	.string	"\307\245\325\241|\221\001CW\341\022ul|\214\306Q\322\347\316z\212\300\305\221\316\022\035q\335p>\327L\037c\305\003r\304I4\273@\bHV\264\220!\007\216n\310\377\225d\004):\201\342\0066\003\027\312\250*\260\320\352\206%\022\241\215\213\264\220g\265h5it4\366-\373\021\310\311\341\264\357\371W\245\351l\323,\022QP\343\370\037\200\013\037\332\266j\333?x\305f\364\016\312\204ZtR$h\2002!l9;\201\177\020\301\376\305'/W\216K\257L\366\321V\200^W6N\013?\353\rrB1\327\343\341gd\004rj\260\355\3539c.8\b\006\b^\312g\001\273\"\005\030\313\300\347$\244q\331\323\016\372d\247<R2B\247>39[\256.\237\256(\335\257\334UfUO_\261\313C`\256\242\222q\224\300#\024\222\345\004\370\212k#'\212\357\022\3578\022\215z`\346%\243\013"
+	.string	"S\314_*Y\276\203\210\225\264\262\214*\017\2711_8F]\013m\326\002\035\226\226\017\177\033(\273\305\327\205 \361\273u\212\236\300\241\tqu\340\241\f\217 \331Rw\311\311\205>\341`XJ`\3243\b\026\263\303j\201\335c\034\274\275\331\005\350\b\204\340D*\327\234\027\340\025\361\003x~\267\263\021\302\240"
+	.ascii	"5ZvN\027v\325\356\031~\204L\207X\270\022\317-X\016G\370\361\252"
+	.ascii	"\224\351\313\372\213\036\316\177\022\\\337\025gL\222\325s\200"
+	.ascii	"\306\210_\"\342tA\370B\007\262\003\223\334\330\242^\327=\222"
+	.ascii	"\343\205\035p\013(\333\b~\235\306c8\346\365\031u[=\250\2036\n"
+	.text
+	.section	.gnu.lto_.pureconst.692777edcab37674,"e",@progbits
+	.string	"(\265/\375 \241]\004"
+	.string	"\022\312!*0\351$\035\200\201\001\024#\0350T\320\350\302\300\300\300\300\300@\025\351\236u\207\037$\020\246)\221@\002\tM~\225~\212F\0027\205[\302\r\341vp3\270\025\354\b\356u\016\340\203\300\r\300\002\234+\254j\227\332\241\356\351\232n\351\222\356\350\212\316\320\t:?3x\316\316\013\034|\233Ss3\027\263\273\\\013\272\312\245\374&Wr#\027r{\374\034\273\006\226q\027Wae\002\033\020\027\177c\255\313.\306\230C"
+	.text
+	.section	.gnu.lto_.ipa_modref.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\264\007%\031"
+	.string	"\266YS<\020q\223t"
+	.string	""
+	.string	"0\252"
+	.string	""
+	.string	"T \030\321\240\252\231'Jcl\254#\f>Q\004\300w\325)\310\034\242a\225\323~\016\255y\357\326s\025\261\236$\375B\f\363\234\3650\333Z\333r\2479"
+	.string	"E"
+	.string	"G"
+	.ascii	"[n*J#`\250@\321j\034\366\306I\302/\023\2259\246\3225\220c\330"
+	.ascii	"^\322;\363\357\356\222~\234~ \375Vq\222fJl\365v\303\366}O\355"
+	.ascii	"#\3055\347\003`\021\240W#)\202=,x\340?\n\243\264\0214\320\301"
+	.ascii	"R|W\365\256\212\025\217\026\270Q\013\226y\353B\240'\275O\332"
+	.ascii	"iC\026\034p#\001'c\006{\221\203\205\032\240\"bL\323\243ntf\336"
+	.ascii	"\t\223\336;\275\017\231\013"
+	.string	"\177\310[\250\200n\213\nY\244\n\317\271q\337(<\2451VI\0230\022@0\3740\305\bCXc\036\244f\023\007\177\254\0063\270\005\037\"\3062\263\025\2258N\364\215\nL\274\022t\260\024x\311\244&6V\002o\252\215\347SQ\316\022\235\314tz6\236O5\235$>\231i\314\2072\216\310\303\257\016\027\016Kj\267\341\257\206+\312FE.\006\210\206\213\025\240_\344n\250Q\363X\335\350\232\001\003\245\365\023\321/\244_\210b\200\362\250\341E*\221\246 )Lc`\002\031\232*\353\022\200\3041\210:i\250df\024\026$\245=\016\017h1\t\310CT\230\225W\355\250\206\340\022\003Z\346+\324\251\260\037\327\034\267\225\333\t'I\327P\352\271\264v\203\376^2\230\256\023\t\005\202\033\247l\321\351#\235\360,h\356\022\373\211J\274\256\301m=\325\372\007\036\3051\254Y\007!F\364I\b\302\2659"
+	.string	"L\376%\306\354&\317mk+\220!\222\022\324\004\021\n\323\240\210\224 \fwf\335\311\322\247==3\347\266\322V\357\020gNz\rT\263p\2409\\\004\370*\301p\225\022\035_dU\3611\337"
+	.string	"G\344\341+\376V\226\354\026\313\333\200U\033_\305\f\352\362OKX{\216\231\333\030\364\013\337\\\026=\2334\3347"
+	.string	"\3167\265\270\346\345l8\265\257\f\205\321l\003\222\246\220A\030\256\033\305j(\207\004\021\"\036tC'\341\004\302f\221\377\020\317\252\2211\257\312\376\301X\261Q\351\300\337\212y\230s\314\247\322\224An\202\363\310\023\244\345tG\031\002\344\232\376\367\305\021\363\033\305W\n\274 y\204\003\216@<\3048\352\335Wh\250\250\310\312\032O\225\032\031}\224\366'rq\260\276$\356\333\205\337\032\356T\273\300\227uc\332`H\ng[ %\264kw\362\311\254\333\032\316\b\\\222xN\023\2327"
+	.ascii	"Y\023vy<\232\032\203\b\3073\221\331\303\034\275\330\333A\303"
+	.ascii	"|\320,\334\"\022\370?\246B\255V\365\006U\216V\177\304\366Hz\264"
+	.ascii	"i\027\001\305\353i\225/\342\023}\272\365\220\252\334(\006\324"
+	.ascii	"W\006&\353\236C\320\013p\335\371;\272b\255\007\204\374\3163\366"
+	.ascii	"\217 +`\212|\260N\n"
+	.text
+	.section	.gnu.lto_.lto.692777edcab37674,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dyad_realloc.24.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"5\r"
+	.string	"\266Z]C\020\221\223\016\023\361\310\311\321\373\032(l(j\264}F\264\274=R\350\245\004\252_\336\324\025D\2605jbD\021c\017\364V\334\tH\004"
+	.string	""
+	.string	"\300\203\005\025T\235\313\335r1\022R\264\224\020i{K\231RJ"
+	.string	"C"
+	.string	"I"
+	.string	"\266\375\023o\331\354\325"
+	.string	"o\304\212uj\341T\344\330\3652{\377\310<^\027\220yT\021\337\01657\237\201\207\027\035)th\205\017bf\2406\244\021T\020%~zj \2112-\b\273\353\354H+w\274m\007\266\033\330\307\020\267\356\362G\230\2060\2550\235\232\276\206@\213\253V\273\033\276\230ME\030\022\266o{\2635\2663\355{G\261\335\3051\214\355~\220\361\262\273!>p=r\240\2377y\365"
+	.string	"\273,\250\227]/\304\005\256\307 %\023\352\013\031\250 '\033\243\324a\325T\250Wq\035\022<\252j\272\340`d\3074uS\302\301\301\210\362\263\225WKm\013'\371\016SN\006\r9\352uA\351\006\267#%?\333\013\245\206\260\017WY\354\233n\354\246\007F\371h\036\022\017g\202\306\001\235h\233\222\177@&j\t\nFDPF\262\222\216\210'\213\320\251\360a\315\204\344\223\2014\355\223i\274\275\215\251\007\307!\225\242\"\375T4P\020@>\305Yt<j\354\252\274\243p\251 0\360h{\264|\347\\\361\245F\032\n\021"
+	.string	"\242\310\220\031Z\317\b\342\013\177\325\025Vmo\r\2416\3426\231`1\003\215\314"
+	.string	"]\303\337\331\304\201\023Hhc"
+	.ascii	"\345L\036A\355\001"
+	.text
+	.section	.gnu.lto_select_grow.29.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`S\003\035\027"
+	.string	"\326+\222E\260\032Q:\322b\257\033\205\337\363A@Q)gHw\373\036\341vn\275\212\030\327\264vg\274\027L\327\007\347\350\216\263\246*\272\303;\357\250\037\312\317\201<\235i\203\241#\371\254\334\254M\331,!do)S\n{"
+	.string	"w"
+	.string	"\177"
+	.string	"C\"D\251]\331]\232G\317x\2172\360i\337\307\177\274\376c\342"
+	.ascii	"vw\212 \331\265\035p\001\357\321\266\253\270G\357\001\270G\277"
+	.ascii	"l+\267\325\266\353\201\221#\264ewW\332c=\264\335\\\276\336q\021"
+	.ascii	"j\276\374\364\271\315h\260w\020\225\003\023\234HNG\213G\316\207"
+	.ascii	"hFkqH\242\261\270\232h8Pfw/\364\324\241\3052\273\007\273\353"
+	.ascii	"\234\321V\334\336m\243\260\275\300VY\313\300\027B\341\203\200"
+	.ascii	"\332\215G\337\004\367\230\322\020Kz\374\334\344\315\266\301"
+	.string	"\376U\036\373_\335\261c2\255:\320\235\372\317\037 \323\250\007\335\247\2306i\272\244i\030M\177\232&ez\224i\217Kw1\315e:\3024\204i\325tf\372\003FU\212\2168\320\262\233\342V\264Ob\022\034\007\372\203\036\344B\376\202<$\203\203Z\234\236\0309\024x\266\003y\035\310Cp\003J\264\346e\206\245\224Q9\2651\264\362\263N'\3108\241\260\nG2b\246\266\273\rl\r?\302\341\221\200\024Ngj$\201\032\365{\022\234*\324\313v\304\362\346T\3254rM}\316\227\233\274\025\361\256\337\214!.\252\273\013\213\312\343L\003/\315T\245(\325\261QJ$OS\\\334\344\rB\003O\251J/+\212\345\355\266\355\256*\217i\236\322\f/z\202P\301\311.\266]\037\342!o7\255\227\020\321\252ay`A\260\331\340\372B\3345\blX%lV\035Z,\016+\013\255\r*\273<\\"
+	.ascii	"\261\022\341r\201X}\266\275\356X\202\223'7\032s\247<\036\315"
+	.ascii	"b\214\252\rH\363\223\352\034\370IO\343\220;i\214^\205\017\221"
+	.ascii	"\f\006*?\245\271ImVM~\346O\206La.i\247&\275\214G\214\3500Z\202"
+	.ascii	"\321\314\342&\034I?%\371D\031))\245\236\216T\215\310r\304\230"
+	.ascii	"x\252P\230p\371\351t\311\210\222\224B\250A4\247\230B\212HM \321"
+	.ascii	"\b\005\206-\006p\002\031:\273\003\021p\305rW\322l\007\"6g\330"
+	.ascii	"\372\350\"\226\013S\220\251\337\3063\331\315\007J\250m\345\301"
+	.ascii	"\232\225\326\372\247\307\203#<\347(\257\002Cs4d]N\241d\017y\231"
+	.ascii	"\375\025\253\366\242U9\375F\347\216\200\317\037\213v\211\246"
+	.ascii	"\316\221v<\217\253s\005\377\367\345\016\362N\321.O\n\030\266"
+	.ascii	">S\245F\273\024|\21401\004\rn\tE\344a\025\204\350\310F\262|}"
+	.ascii	"\t-|}Pf\334`S\302\037"
+	.text
+	.section	.gnu.lto_select_zero.30.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\351\001\235\020"
+	.string	"\006 mE\340\224(\035\250\316\2178\244\345/b\344+v\007F\242N\242h\001\275\340L\337\\M\333\263\374\366\224dk{\315\005\227\006\227B\331\362(\203\031f\b\2570G\n\263\255\341K\020\234\001\372\227\372\333\336[\312\224\002X"
+	.string	"V"
+	.string	"X"
+	.string	"\361\020\364\001\361\320+\273\310\271\331~db\264\334\364\354\356Ie\254\177\334\rs\365\b\237\346\312g=\276"
+	.string	"\273;\212m\257\301\356\276\022\266x\371\2134\036X\354\345\372\024\300\360 1\212\271\036\311\307\t\"\357\236.\261-\363s\262\273NXl\304\375\271\355\226\355\004v:\b%6k\214-:\315\017\3406w|i\250\351\247i\315tf\372#\223#38\"\350\330\rQS\262=`\016\213\333\374\366\3379ds\257Y\335\306:oq$"
+	.string	"\241\031\331\335\322\241\021\200\016\013\274\247\375\231\313X\235\206\345\002vcj\344\330\345L>"
+	.string	":4wR9\337{GT}j\332\\\270\262\346T\325\267,ie\215F\352\347\305\017\325\335e=\225\331\251\343p\310\231v;=HvwUe.\375J\240\023\362\312$\266W>\303:\240\335}\340\337\\\360"
+	.ascii	"Zq\350\263\304\303\353\273\033p\355\300\240ie\315\346X\2512\373"
+	.ascii	"\257\351\t\250\257\334\024\030\244\240\200H9i@\241\250\234&\240"
+	.ascii	"2\220\234\332PAu\352\220J\251N!n\177\322RWT\231M`O\244\252BK"
+	.ascii	"\217\352bz\324\243\350\206\2742\311\037\\\360\250\"\275\b\032"
+	.ascii	"\317\006#\312\247\245C\265-\240\3620\207Ll\312R\375\306\007\322"
+	.ascii	"lw!\330\030nC\345p\024\004*)E' \220\002!1\354\001\302\310\020"
+	.ascii	"B\233\221\270\0040\n\344\223\273\016-o\307\265\261\224Mo\336"
+	.ascii	"\253\366\005nK\3436\362\215a\266\302\236*\302~D\304^(\260[P~"
+	.ascii	"\214*\306\371\310\232$`\356\001Wc\237<x\3230M\344\361J'.8\004"
+	.ascii	"\270\003\212\0024\234\2242\232\013B\001"
+	.text
+	.section	.gnu.lto_select_add.31.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\351\002=\026"
+	.string	"\006\352\217G\300VQ:\272\312\034\357R\324\3456\003\333\0203\345\0230oT_J\260l;u\362G\264\177\b\260\301~x,\005\026yp\250\313\362\377\273C\024Eu-EE\033\241\004}\007$\023\251\241 \252?!d\023)S\ny"
+	.string	"r"
+	.string	"\177"
+	.string	"\335\323\376\215\367\264n\013q\226\335\235\036@\273\241\214\013\200\217\016\337\342=\202Gy\217n\331K\036\326\366s!$\306\343\311\356\252\324\205\273l\375\363b\247\331\362\323\304\321\013\3673\313\371w\342\236\312,\326\301\354ni\006\313\330}:$`\250\314t\272\231\"&A\277=G\314^\331\311\240]\177;\001\023D:p?3\332\363{\260\273N\331\254\304\r\336\266\314\366\002[c\002\265\"&\326\035;\323\251\230F\335\347>=\307\317\362\035\277\351\266\177%\323%/\235\342\245I\231\006\275\364\347\245\275.\035c\272\213i\315tf\372\001PG/\334\021\234\020\305\205K\"g\264C1(\306}~\373\277\271d\333\007D\267(\302-\341\300\006t\343\311n\230\340\3212\266\356`AA\220\341q\264\236\303B&\355\266 \002\264\27326"
+	.string	">\302\004E<\224v\032\003\233\021UQzX\024\223\2522\260\345bQ\\\231\223\360\037\025\\\222\354\356\214ms\037\027\036\001\324N\032\301\211\215 W\346\242\362\330\244\251'\034M\220\030\021\221E\006\367\026\362\256\251I\004\233\361\312\234\355\233\367\260\020\270\273\r\374\237\t\030\300\027!\274\307\353"
+	.string	"\026/V\364\330\\\231\353vw;\223rE\355U\207\274\314\371c\310\220\b\315\321[\020\235\231*\217\035\346\344g\002\034^c!ql>\350\207\273\302\202\032\032V\215j\303\r\215\006\025\205\233\f-^q\260\361\240\302Y\255<\250J\341^w \020\r\271\364\365)\317\020V*\311\213\022\025\256\314\335\205\326S\303+\251"
+	.ascii	"\0356\315\203\260J\252@\214l\330R4k\2275!\251\247)\332\t\305"
+	.ascii	"h\240\222\364\237*8\250\335\021\314(\245\237\376\366\026\242"
+	.ascii	"\227\263<\223\246\324\031C\361:\020\234\003>\b\357\321\323\217"
+	.ascii	"H\341\322\223F=\214Fw\007: `\002\221r\272\003B2\304\321\3649"
+	.ascii	"\305\rJM\275\336\326ga\271A\334\347\006K\213P\t\t\333r\203\233"
+	.ascii	"\210a\256\2067\312@ .h\300\240\214p\234\314\277.\020b'\201\301"
+	.ascii	"\0319\304\205\013\023\027\211@,\214\303\326\rW\343N\243J\202"
+	.ascii	" \006\3531\226&Vi\310`]\270Pp\322V\315\224j\373\3133\2215\300"
+	.ascii	"\024i,\200\242\320n\330x\023iby\333\315\240\352\241j\350\330"
+	.ascii	"l/\344\221\227\200\237"
+	.text
+	.section	.gnu.lto_panic.41.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\276\001\215\020"
+	.string	"\366\035nI\300\222U:\360\226\214\254\0259\013D\221\207D\bG\004\343\t\237\213b\363=\"2X\300-^"
+	.string	"Q\033\337\367\337\253T\334-\366\352e\025\n7W\\\232\234\366\263\306,8"
+	.string	"\245\243J\273M\336B\022\342\215\255\335d\313\224\002U"
+	.string	"R"
+	.string	"\\"
+	.string	"?\036\016`7\247\205\320\356n\305(\246O\357\216\"}\232\036\200\364\351\230]\364\235nK*\214@\2740\332]Q\356<\366\031J\215\371\236\267\207#\343\3552<\225(\322Q2\322B\006>F\024\347]E\214\037TK\017v\327j\033I\334\244\333f\261\355\300V1{\233\255a\203\336\346\363\336\222\323\005\2016Rf\357d*u\354\207\273\273\2269\366\177\376)\325?Q0q\203\363\271\300\330\2759\0222\373\315\032+\016\364\333?\317'{w\027\261\003u\370\326pXx\004\201\2738*\237N`\372\374\200\253}\026\367\211=)r\204\240!\245\216_H\227\005x=h\032\304\376\214\013\275\370<\256"
+	.string	"\003C\372\274,\355\374\300\371\234\230\351\221M4\245\022\311\005\005\2014)3\211\246\350\246|\3572X%\272\335Y\320c\310\370<\237^\261\364\266O\237\325r\221\344z\202\300\232\224\271\244*\177\357<\330\201\021\273\001\036\201!8i\240Z\315\244hNL`2\257TX\323\302 \255Z\020\223\342\020#\316\254R-\321\302*\003\312.\232\013/\261\306\345z\211\247\222o\003\252\340v\013\204\023\335~\264I"
+	.ascii	"\007\013E\347{\3577\\j\267E0\325VR$LP\242\361gc\037\016HO(@\337"
+	.ascii	"\273\r\026j\307\220\264\016\r\371\321d# p\002\031\261\274\003"
+	.ascii	"\371\361E7~5\247\270IK\255\307\025\313\373\262H\355Z\020-\205"
+	.ascii	"99\213=,=W\276\342V\\\017\3104#\237\004\215f$\013*\322\222\262"
+	.ascii	"\211\264\345\243\210\355\246\332\r\210\254-\0167z\303\035\027"
+	.ascii	"\006\213<J%\350\222g\271\032\027\335\003"
+	.text
+	.section	.gnu.lto_destroyClosedStreams.43.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\366\001]\021"
+	.string	"F\340rG\360\360$\035\210\273\311\240\023wh[\325\265\247d\377P\rDjB\314\360[9\321\376f+ \024Dw(T\\\243\233\215O\270\204u\371\256\221\214\t\315\300\307\200\215\251\340\2750^^\353X\271\215\020B\310&R\246\024`"
+	.string	"V"
+	.string	"^"
+	.string	"\256\271\341\270,\004\331\230s~{\343NW\347\272Mf\253+_\215Z\200\242\312\271lc\301\350\334E\fM\346\261\024\033:\354\032\212,\332i25\337f.=q\346Yf \206\"\t\200\310\312P0:\340Il\321=\354\013p:\314\330 Ss\335\024\3149\255\240(s{\267\375b\373\263\365@*\272-\373\036\256\245\230\327\306\366\356so\232\374\353VU\377\344!1\255h 4'L\023\323<\222C;\367\371_W\373\366G\377\307'\fs:\270\313\037\346\223\037\342\"V\177\251>]b:0\344\020\233s\354\2704\007w\351\361(\355\222{"
+	.string	"\355\322+\033\351c\236\352\332$)=\350-2:jY\025\333\021nB\305\001c\333\377\274@PQ\3171\354$]\310\266\345\216\177A\200b\264\350\222\355\223\2270\0217\347L\340\013U\220\300\345\250\264\313\357\322 Rz\255\220\n\226\270\333\032\361 \225\237\343\t)z\360\322O\321.\345JV\n%\232\025m\262\307(\024DJ2\222\017\021\023\224\023\315\016\020\204|\244\204|%#\037$\037\310\310\003\224S\020DL>\224T\312\344;\215\363kc\0065\216V\226\205\3534\360dP\271\3166ouC\022\327\035\340\001\007H\306\237\3159g\267-\037v\t\302\345\347\234\022\017R\266\255\267\241\375\355\204"
+	.ascii	"\227\266\207\235\300\013\026=\372\341\346\345\206\f( \220\202"
+	.ascii	"\031\263\352B\031\221h\n\347@\273K*\254\274\251\b9\031X\003\365"
+	.ascii	"lMrd@@\367\302\340\206|Z\305\t\3578\260\233\221,\023\255(\030"
+	.ascii	"9\321\020\016\236\216\370VtO\355*-\274\025Dk\341\b\216\321H\372"
+	.ascii	"\037D\204\022\362\315\267\256\246\345\234x\374r\237'L\355\"\003"
+	.text
+	.section	.gnu.lto_updateTickTimer.44.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`1\006\345$"
+	.string	":A8\016J\200\330U:\374\262\352\250>{\204QT\360&-i\210g\254&mX~>\t\346\"fuM\244\361\017\221\272m\250\313D\032\001\3069q\366\266\375G\020dXl\236Q\304G\250\215\360\013w\330\371\017\207Fj\033!D\356$\003\316"
+	.string	"\301"
+	.string	"\326"
+	.string	"\357Zr&+\336\244\367\024!\312\031\202\332\325F\022\035\267.\371[\013\214VO\362$_\3117\244\217\305\261\030\202\221\b\025\326\275\227\005\037\311\267\253\374\254k\2618\222\026\351\235B\336\0305J)Q\260\316\356\225\032\272\312\005jW\177\237[\257\336\034\267^\355\033\373\230\305\034Yui?\226\270X\236\335{u\335\203W\276\265\35757\332\252\246\266\266>\276\275\0026$>\275\346Y\244h\004\355\215\007\214\032\247\2454\250(c"
+	.string	"\242\213\224\b\372\f{\023\312\256Ad\\}\363\251\021+X\206D\031Om\215\333\006\344\2001\343\235*x6\315<\213\324\2144\027e\034\376x\373\202\b\264\226&\341\336\313vH\204q\26693+af#\346U@C\220g\236P\375dy"
+	.ascii	"\233\335En2\263%\360\376Qz"
+	.string	"\tZ(\363\237\034\n7\371V\274\304L\373!3\327\253ou\254\354j\352g\243\314H\240\355\"\363Wh\024\b\367\016\346\325r\320j\031h\265\374C\263\354\263Z\356\241Y\346Y-\357\254\226s\253e\035\232e\334j9\207f\031\347\346L\346y]-\253\253\345t\265\334\253e\273Z\376\201\032(V\327\007\256{\243\242i.\231\032\006\344\311\337\371/\177\257\237\311\367\272\223/\326u\324\025\365\274w\305\303X]\2029r,\376\327\233|sr0\337\231N\266a\027\330\363^d\202\332U\256\035\267\372\336\244\367+\224\262\360\"\312\363\006\245\206VpfN\024\216\354\207G\353U\233\356e\230\253\251\337\301T\b\320\345^\341\207\027j\302\006\b\2562c\370W\206\006\033\312\350=\223\316.~]M\335\316c\353\235\254\341b<f\253T/)6v\254\2033\225u\350w\276l\003k\371\026\016|\253\253\037\273X\007"
+	.string	"U\367\336\364\034fuz"
+	.string	"a\305n{\022\204L\330ODU\320gj\333i\262\037o\240H\231\222K\2231-\322{s\024=\2236\312\271\316\351\035*`\363\302\032f8\246\240\t\302\274\314E\321\350\224\340\275?\002:\235\353\013\205"
+	.string	"m\224q\255\323\351W\210o\355p\035\344C\013\247s\332\226\t\237_2\357[I\017p\272\223\200)C\225\245ecu?\327\267\224j\367\336%\t\023\366C\376\326m\\\001\214\224\304\344\304\343-\t\245\330\215\020\"\301Sj\022\332\341L\354\222\230\232R\254IW\321d\231\307"
+	.ascii	"i\327C\322\235P\332\231\320\211P*\221\343%\024IL\272\246\245"
+	.ascii	"%&\335\r\371{\357\340\340$\3735\260\246\213\034\324j\033U\tZ"
+	.ascii	"\250\375\251\375\343\355\021#\021\252\254\251$P\367t\320\255"
+	.ascii	"\374\247\201|\372\247\323\257\020W\372\360tO\222yW\362(\2712"
+	.ascii	"\251\374\213t@o\334z^)t8\246\333v\332?\343\246\357\252\333f\306"
+	.ascii	"\266Z\304\354\f\255\213\334;^Qo\372G\036\251M\257\375b\314\327"
+	.ascii	"\0162\232)\277\004-4\275\367\336\265\213\307\227q\252\361\311"
+	.ascii	"0\371\262x\254\234\272\313\304\234\321\022\262\017\373W\207\332"
+	.ascii	"\332\314\023\214\354\207\334P\256\310\232\013\n\024Q\275\230"
+	.ascii	"\007|\250Q \345\034c\210\231\tH$MA!\007p\002\231\2512\333\022"
+	.ascii	"@\026\262sTQ\020\0256\366\337\"\244\230\346\320_\030\246'\020"
+	.ascii	"\237\203\230\262rN\364\200n\355\332\262=\220\252\245-/\214\333"
+	.ascii	"\363\220\327\200Y\266\265\020\224\335\025\266\243\373\370)\253"
+	.ascii	"\247\337\354)QR~\272\331 1\034(c\247\262\311\372\354`\273\314"
+	.ascii	"TFj\344$\257N\031\217!\311\331\\Z|\306\020\271/l\377)\336A\240"
+	.ascii	"\031\034\364\027\205'@\006\fv\330\205Xi\177\231'\037\232\274"
+	.ascii	"x\236\234\231\362\342\271\253p7r\334\233Dc\356\2561\261\266\006"
+	.ascii	"\tg\257bR!\375\037;?\341\256l\017\277\214\310\215`8\264h3\277"
+	.ascii	"\261\210\3604\t\335\364\t\340\352C4-\037\224\2326V\326\307.\316"
+	.ascii	"\220[\202Lb\361S\310*'P\356\330W\377\353\266\341\244\0253\032"
+	.ascii	"\355\337\b\245\316\323\033\325g\222YWVp\361\233%y\315\314\335"
+	.ascii	"d,s\350\fBT\001"
+	.text
+	.section	.gnu.lto_updateStreamTimeouts.45.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\023\005\005\""
+	.string	"\226\275\330E\200\232Nc?\352e\305\216\372\350\331)X\253}\215\377\272\033\306v@\260\f\334\254\007("
+	.string	"{\365\330]G\206\320\270\256\351\335\252\343%\326;C\2208L)\242\213\210\302\250\n\3123\363\3773\rZ\322\366\2262\245\303"
+	.string	"\273"
+	.string	"\312"
+	.string	"\266\223\r<jo\366\244\201\310'\021\376\354\351G\264\002\303\274\027y =\352\324\037;\231\360eP\277C,\fka\230\227\nK\350\250\r\244G-\362?\275\243C\367\351\035\265\320\006sd\327\365\001\261\213\241\344\356\336\033\264>\374\253\302\333\374\322\036z\332*\364+\335\025b1\3526\247\257\352J\310\263`\3418\207\362\230\313'_\255\212S\365\347\233\320#\353\306\323\002[YZ\357\235\n\214r3r\212\303\363\007\013\017\273\247\275"
+	.string	"\030\226VEO\005L\245\231\237+!D`\261\252\236'P\026,\255\023\350\336\013,RU\373\344/"
+	.string	"\311\023\263\225u\343\3257\341\336\353J,f\335\300\333\036b\233\202\215\002\b\020p\254MbG\306HV&U\233\306\251\301\377\311\333P\244\367^\266#\025\365D\277\355?\2650$\036\263\312F\331\310\251j\217\366\207\272\362\230\266\\\366\361U\367\370\252y|\325;i\265\216\257:'\255\306\271\371\375\354>}\325\326W]}\325\037"
+	.ascii	"\334J\023G\202\313\275W\3154w\016]~\235\355_\376e\377\331O\373"
+	.ascii	"\276\362K\377\315\355\212\271t4\243\3073wK\276\233\201K/\203"
+	.ascii	"\212\212\020ww'g\363\333\f\\\0236\035\315C_E\214cM\376\232\201"
+	.ascii	"K\316\244\351M`\234W\013ye\330$\245\304\215\335\335\213\265 "
+	.ascii	"=\372\273s%O\263\201v:\232-\215\346\221\243\001I/T5\317\354u"
+	.ascii	"V\246\276\227\027\024\274\236zGom\0315xV-JU\321\332\243\271\234"
+	.ascii	"\356\311\367r\005\013\365D\013\275\243?k\217i\360\264\244\276"
+	.ascii	"\005\003\016\335\275\303\0233\244\303\006\b\216\332\032n\266"
+	.ascii	"\341\311\237`W\324\2105\240\226\366\310&\246es\303\365\2764\207"
+	.ascii	"\277\031\256v\241N\244\350\bP\037\334TzBV:X\356U<\370^G\017\345"
+	.ascii	"o\037p\272\216\236\367\227\336\022\204\210\372\366\ra\027\217"
+	.ascii	"9\264Q\206q\336\273%\201yV\233\346\2619\266\307h\345\2079\302"
+	.ascii	"\354\230\202\206\210\333\265%4\233S\250\356\225\n\332\261<\366"
+	.ascii	"C\260\251\332\264\216\335\261'\333\210\267\225\320\261\004~\330"
+	.ascii	"\034[\267\f\231g3\321\333N\004"
+	.string	"fjJ\002*2B:b\002\342y\301T\221\210\214\224\230\226zF\367\t\006EDNEA\026GDHA\023G+~\234\324\302H)\310\224\224\244\024\004\"\245n\271\034\302\306\234\224\2352T\231\215=\332\205\322\230\336\330\233\325\250?{Z\253.?\255\200\257\272\363\336{\177A^\346\t@\327\275\367\306\352(\302e$K\023\324\323\372iB\"\302\260z\242O\033\345\340\t\335VO\350>V@\262\313\323,4\3621\206\263\217}\332\203\224f\272\214d\006\352\321n\366!=\255-\024\023\"\271\211\202f\256\312Fy\315\006\032\"j\355m\212\244\\\265=\326\332\252f8d\2526\311\016\246Z_\2315b\327Rw\266\344\264G+m\327\240[\023\001c\250Q$C\030c\214!\031\241@H\332b\016`\002\221\251,;\021\300ADCS\311\306\030\252\214B'\t\237lk\213k\322\221\036|(d\257\251\f"
+	.ascii	"O\227\355H\335,;\312\322\231\254%!\230\304\020\333\343\257h\265"
+	.ascii	"w\0358\376/\335[\033\036\364\262$\035\\\203X5Q\345\361\336\314"
+	.ascii	"\366\327\034\006/,\201~\372\320B<\247\367e*teE\001:0k\021\301"
+	.ascii	"\301\337\352\034\030J]S\221\311\325\"\\\013p,K\202\323\200\""
+	.ascii	"\235\213b)1i\001j\300x\355X:\025\252\204f#\034\273\020\005\007"
+	.ascii	"]\021>\311\243\224?\335}-Ua3\177\037C\341\325\251|<\206\030\023"
+	.ascii	"66\035\216\221\233\271U\374\303\374\b9H\250\346\273c\307\350"
+	.ascii	"\244\001\237p\200\026oa1)\341\017"
+	.text
+	.section	.gnu.lto_stream_destroy.46.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`,\005U\037"
+	.string	"&8\303G\220\232Nc\360J\257Ro\352$(,\210T\243T\021t\261\022Si\375\310\260\207\3101\025\204\201\377Y~\330\202l\235A\272\241K=\222\004\200!&\001F\263("
+	.string	""
+	.string	"\016\254i\013\316U\305H\204\310\336[n)S\n\251"
+	.string	"\246"
+	.string	"\260"
+	.string	"\270\0266\356\326\276\311\205\3069\371\226\357\\G\027\242\334 ^&\031\017\314\333\272s\001d\020\351\327I\306\355\264\302A\2747\230s\353\034\373\324\376\222g\371\256\325{\200{\251\314\304\356\r6\260\002\363\326\301\333\220\267\346\005\220\267\366\331a\036\004\336\322\312\306\223\260\314\275WW{\230\244\276\227\244\035+\365\371\364\313\331\371Kz9\226M1\202\344~O\343N\033q\254\211\222D\242n/\374Xd\255\353\374E}\244\361:\336d\031>\345~L#\002\252\034\305\013O\241~K\224\226\023\356\275\246\347o\306m\3366\f\333\036l\213!B\023\272\333<\027\032\214unR\fn\237\270\320d\326aAV\224\032k\225m"
+	.string	"\364\325F\001D\177\232b\2312d\252I\005\266\266X\251\265\352A\344+\201-5&\332f;\305\251\004\231\367^\035\177\254\207g\002\351\221\267\257\325\212\224\242\226\022Mc\007\227h\255\262\277\003l#\272R\3316\327\372s\270\222\272\246\244\276\225\324&I]Zj\322R\333S\217\247\256\017\336\324R?\001\256\310\031/@g\367\306Hs\346\016\355\230\220\007\177.\261.RaW\300\270H}\221gW\336u/\033\347\026\177b\235\263$\367\336?\331\034\334V\262\336ij\t\314\303\230\314\007b\n\256B\177\272\nyk\253\275\332\202%5V\037\355E\357iQN6\265\336Xm\224\226\242VY\253\fT6emj=GW@\252<\312\312\334\253\364\023W\241r\265\326\3578\332O\317\364\221\310\333Z#\254uA\325\030\357\275\227\254U\356\202\224\003\332\026\316\245g\216\271\340\r"
+	.string	"\332\324\bkRjWY\323\317\032\240\177ra\2063Wm\r\034\216%\313\260\251&\331\037v"
+	.ascii	"\220v\257\323\317\017\246\023\204\005 .\fA\201\020\324\320\316"
+	.ascii	"\250\234\333\"\206H{\304\205C7\273M\3027A\332%\036\366\331\035"
+	.ascii	"\361\210\214\212v>7B\273]\317M\021\317\317\315\315\356\307\350"
+	.ascii	"\300\356F.vBc\020\317\216\310\250\210\364\t\007><G>:! \236 ]"
+	.ascii	"\017\220\n\033\363V\354\210tF<\036\221\016g\333"
+	.string	"A\245\217$\256Rk6\244HT\252K>\032\357\335!\341\\\277\360\001\210Nr\325\027\023;\325\201Ck\252\037\026\326\343h\206j~\\Q\335\252\017\006\346\343f~\274\315g\205\223v\203r\245\303\254\376\327\227\220\223\031\"\3621>#8@\263^x\372u\344\314T\026\016-\253\357\345C\342\303\362\372\006\254a\221\310T\223\224\\L\221}Yg\3631Q\2206 \255\254\267\2503,-\262\022\003d\250a(\244\224S\220\314\210\210L\030i\222\016\220\002\221)+\017\021P=Cv%\3154\006\312\200\002Ce\324\223\236\021y}\022\2360X\256H<\322\353t&P,c0\341\330G\207\007\223\230\020pB\254\225\023-\201\204\372HJ&\261\324 \215G$(0\277(\027)m\252\276\253\035\0255\314.I;\266\005@\302\212\266\352\210\024\346\326\265\272\f\345 \366p\246\245$\305Su\226\361\nI{\354"
+	.string	"y,8e\277\027\333\271\3604\240\365_\243"
+	.string	"f\305\311\234U6\017i\373\216y+\354\t\301D\312\031?\230U\345\035\275 \200fi\221\346\252\300\203"
+	.string	"\t\020G\360f\272H\223\205\\\217\220\"\222\023b'\223\325\214s\342\376E{\240Y\246["
+	.ascii	"\003P\262%\240)&U\003"
+	.text
+	.section	.gnu.lto_stream_emitEvent.47.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\342\003\035\032"
+	.string	"\226\357\245I\240\230Q:\300\004\230@\217<b\3000\361o\253W7\360\243j\226\346t\311}i\334\312@\234\373\3541\272\246\370\243\212\213\232\243\306\257\236\352\027\032\360Z\360\016\353p\217S:\335\363\350\035\002\036rn\307'\204\354-wJ\001\223"
+	.string	"\207"
+	.string	"\222"
+	.string	"\322~\217\373\240=\347s\230Z\217\236\212\324\252k\340\003\342\251u\217\001O\305\277\300S\323\354\337u\270\032\326 \"\304\313Rk\205\255\f\213\222v\226\030\202t\256\244\371\3627e\350\366s\326\f\203H\330\270\223\022+&\004-TN\347\325\244\230Td\364P\305\301\371Z!\344\t\200\233\320d\360$\007\013\233\244(>\347\002\027KN"
+	.string	"\270\005\315\230\250\030S\357]\022\335\200\344\236\3679&\241\002\243\310\3502\214Pk\265\034\272\025\335/\267M\303\366\003{\255\004>\020\r;\022GC\004x\272G\246x\264\030!\257l\335\217\\$\373\020pZ~\336#{F\346L\367\353\271\037\346\272_\200\353Jw\213J\277\2544k\245\305P:\004\245A*M\251\364\234\322;\245\345J\177\300w\354\330\r\341`\251\225\304\325\226\nE\235n\234\351W\262\277\344\367\230f\257\266\022,\241Q\tU\255:\230x\372\363\334\362\177|G\273\222}\263\366$\214MT\265V\232S7\020O\rL\251\023qE\363\313\252\272be\202\306H\001\353p\035\340\005\320\376\330\246\360'\013\341n\325\317\n\\\373\302\223xt\341$o\250J\206#\361\bn\230\364;\013,FRs\221Lw\356\315\016\n\220\324b{\303}\366\321-"
+	.string	"%gs#\3669U\340 \316\226\246\030\255r\273\337\327\236\213M\307\200\373\t\224\273{\033\216\232\274\262k\345\202C\204\2728\366\246Y\r\316\036ND6\004\303\207\003R>\340\351\367\275\323,\215<r\313\204$\350\266\206Y;\347A|\304Z\253\203<1\235XO\b\031\216({\354961\236\236\020\2409\324t\260\231u\200\351\310lr`72\234\030\357\200\210\361\300zvvx`-]\375\036\371\302\023\324\210\255Q\261\026\311\255(\341\314\356\fIs\327\022\271\366e\237\264k2\341Q\366!\200\"\360\242`i\312\352\263\326Z\305E\362{\027\243\230\330"
+	.ascii	"e\326\223\272\266\265D6\203\267vf\317;\35516I\024a\315]+\263"
+	.ascii	":Fl.j2\267\245J\n\370Z\326\336\354\242\354\212\313Z9\332t\324"
+	.ascii	"\232\314\022H1) \006L\250A(e\030t\210\214L4BC\201\322bp\002\021"
+	.ascii	"2,\017\020P\210\246\270\262\031\"F\316*\204\362s\351\224\321"
+	.ascii	"\247\212z\260\267\374omuw\302)\016\024\273\346k\004\253\021\347"
+	.ascii	"TB\032\375\224ZmT,I\026\346[\234J\374\247\234\224\204\316\263"
+	.ascii	"d\036\252\036\352\207A\r'z(k.\\\213\244\245\367\301\255\204^"
+	.ascii	"g\f\335L\247{p\026\232\006\274r\335;?s\036\207\335\336`\021\347"
+	.ascii	"\036{\201\\\007\3446\005\360\237\225&\374\215\320L0\216)Ff\034"
+	.ascii	"\020\324b\002\331\330x\222I\303[w\231\303\254\232L\364Q\001"
+	.text
+	.section	.gnu.lto_stream_error.48.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\203\003u\031"
+	.string	"\006o\244G\240\032U:\360zH\307\002\005\016]\352\217\326\277\033\326\315\036\364A\036z\215\264\005.\323\346\373\"\006\361\252\036\222\370jG\365\267\253\333\307\223`\025\2759\351\201\213"
+	.string	"\217]&\220\0250P\217*54\202\310\336{'\031\215"
+	.string	"\207"
+	.string	"\220"
+	.ascii	"\345\2610\321\006\350\034\222\034\302\356v\3001\362\367e\251"
+	.ascii	"\257F\035\330)\363\253\334J"
+	.string	"y%\033\367\351F\362\"\354\3669`\004\344/\373\356\032\177\311\013\030\177\271d\206s_\257UL\350\034e\241\323\335\261\252\344\345U\343\265\225\226\374\237\3471yDW\005\371h\033\0241\343\243\305\323Y\027\032$n.<\242\367\307\355\212\367\343\3256(6\315i\361r\326\265kb\376<\305\3013\242T\205\241\273\231\232<\036g\362\314<\203\231=0W*\001\225\210\331gDk\022\363mW\244\326\225\376\325}\377=\226\337\222\224\357z\025'\277!\266-\335\273);\375t\235\234|\370/\375\300W\346\363\277|\310'2\313\251\fz\220o\222;A|'f\005u\331\335\313\205\314,\306=\310\024\262L\351n\326/3\216\231\365K\317\364\223Y\\\336\245<P\210\354'\034tD\025\273'\220\277\001\232\366\265|K\371\245\241\267nG\207S\252\330\271\035\260_\216@\376\326\n\365\312\177\0015*\020\024\224\t\204"
+	.string	"}\275\365\301\247\021\341\352u\353n\216 u\026\024\374>\370\223DK\rs\t\023\257\243J\304>\324V\346\0232z\363\225\226\211z\312\275'U\024\326\232\304\260\333\372\363\003\244@\375\330\344\250\024\017\331\356#\027\212W\350\024\327\244\223\212\020\2363q\374\220S\234\310D\332\353n\240\013\034C\244\210Nq\017\225p.3\302\376\341\311\330X\314\307\260\340/\371=\230\023i==\363\327\236\337\214C\0275z\223O<\017\030(O\272\314"
+	.string	"\367\240\302O\202\005/\334\003 \b?\t"
+	.ascii	"\254\020BQg\277\335f\225\005\256Vk\262\331M\006n\344\024?*d4"
+	.ascii	"T\304`\320d\265\030\n\332\013\027\333b\314n1\0316\333-\306\362"
+	.ascii	"\025\335vEb\216\363$\252XT\215xh\351\027\002\376\347}T/\272\252"
+	.ascii	"|a\006\r\364&[\332$\007\215\221\261U\013\374\326\\\310\033\336"
+	.ascii	"\206\211$\237M\213\016\374%6\306\337V\275\360\007\232\346\364"
+	.ascii	"\212XQ2@\037<\023\215\\U\346\017 \350\231\036O7\356\2555\312"
+	.ascii	"T\024\rsc\007\305\2068SC\250A,\206\224s\206\241\030\tHd\264m"
+	.ascii	"p\002\221\271:\017\020`X\332\244u\003\"\264|\315\306\021\303"
+	.ascii	"D\020\013d-\265W\025\263`\001\255\353\016\3723\220~3|\r f\253"
+	.ascii	"L&\364\365I\245\346K\357i\\l\363\331\235N\351\024\022\230\247"
+	.ascii	"\357cp\021i[\024\261\017\215S\362\223\325\227]\307\300av`*\004"
+	.ascii	"\335\031\\\377[\317\327\024\277\375\324tQk\324\274\243\202\033"
+	.ascii	"1\026\211\263\031\251+g/k(\004\345\321<EY@\367\007\361?\371("
+	.ascii	"\036\323\370\324\324\350\253\n"
+	.text
+	.section	.gnu.lto_stream_initAddress.49.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\203\006\215%"
+	.string	"\312C\350\016F\200\234Q:=\224A\247\263\016|\013\317\226R\306\254{\253~\353\214`\225\244\325\244\025#\260\250mx\303\320\306\211L\002l\304*\267G\3206(\024qehY\305q\213o\221\263\304G[@\377[\311'\204\310\235d\322"
+	.string	"\317"
+	.string	"\336"
+	.string	"`4\b\257\222\374\313\277\230o\334t#\007\005\313\256\200\367\336\333M\346&\346\333\315\276\327\213|\343\362.\366^\234~\251\254Z\3301\222\336k5\001\275\211\336\337\017\277\305\236\370\204BY\241\305\255#\351\275bA79\b\275\251\240|e>\360A{!\216\013\270\367I\032\261{\207B\314"
+	.ascii	"\275\311\303\353\316\233\350\007\2347\3312\227}\250ui[>\252\272"
+	.ascii	"\234\335{y\035\345\3665\224v\232eW\313\207z\255x\224v, F~\226"
+	.ascii	"\021\256\320\b\001\372U\225\2726N\350PUs\001\026\220#/K\n_?\260"
+	.ascii	"\034\226\262+\267_\216\332e\205\251\263$@\277\251\022\307\247"
+	.ascii	"\352\315\213\257<~R\265\3228\334{\271\372~@\316\2663s\021fv\301"
+	.ascii	"|\342\bRd_D\3705\3161\334q\n\320\354\nh6\240\276\371a+X\204}"
+	.ascii	"D\027\033d\232\203[\374L\r\364\336;\3047\203\202\b\245\202\243"
+	.ascii	"M.\260.\341\357\237\316\023\337Ua\316\314\242j\222\201\352\357"
+	.ascii	"y\354\f\372\215/\036\345\264|\314/z\365>~\361$\3600A\246T\r\305"
+	.ascii	"<\224\252\235\305\374N&\223I\356'\314\265\312\020j\225\037\\"
+	.ascii	"\370\353\320\312@h\345\\\2552\316V\371\206V\266\241\225k\265"
+	.ascii	"\312\250\2552\255V\371D+\233h\345\022\255\334h\345J\253\374\b"
+	.ascii	"\005\324x\221\215m\371h\262\341\375\221\364s\331\230c\266N\374"
+	.ascii	"\275\234\300\016\252\255%)3\263\022\007)\035S%\0302\005\236]"
+	.ascii	"\250\033T2\237\017\3660\246\033\271\201)\023s\300\253\240pWw"
+	.ascii	"\177:i}\343\317l\326\001\033\345{\254\224\006v\312\213\266\312"
+	.ascii	"\315\256\250\330\230\355\226\265R\357c]\0361dZ\325PLk<5\320\\"
+	.ascii	"\035\337\035\007uw.s\362\316l\261X\256z\037\255\037\3143D\246"
+	.ascii	"S\ru(g\266\374N\333m\226\363\354z\231\315\002\340\3106\370\242"
+	.ascii	"\325\222;\236\335{\312 \205=\007\213\213\217\371D|-%\326$;\225"
+	.ascii	"\367bm\270\2277\221\351J\211\2724\306\251\322\354\"1/\233\271"
+	.ascii	"\203y$\201CP6.N\t\007BcT\360\020\005d\322G$\252&\231LL\310\244"
+	.ascii	";\213w\3576\340%'G\345\303\t\352\215\367\362\200^\354\265\231"
+	.ascii	"A\204\250\367u+\240\022\3616$\372x\240v\313\021\256)\321\340"
+	.ascii	"h\342\305\023\022\264R\\\214\n\036j\n\013\fcG\203\250I\351h\311"
+	.ascii	"\251\210\247\264\324+\3421!\275\020\262\301\204\324\213!da\250"
+	.ascii	"\305\320\005\033\274##\246\030.\220z\274$%&\336.\311\310\210"
+	.ascii	"\250<\272\321S*e\020\035%-)\235\354bgD\344d\304C\352\021\311"
+	.ascii	"\340\025\365b\350x\006\215\243$\336\322\214\031I\274\3330\352"
+	.ascii	"\345\355'\314!\252\245^\336{o\355O\211}P\240\332\003B\003\245"
+	.ascii	"\3115\377\013B\377\013\3279\036\325g\233 8\342\032C\220N\200"
+	.ascii	"?\235\267\276\261V\331\036\005\216?*\225\3751\b\362\242"
+	.string	"\035\362\264\356ar\253Q\001n\375\340\036\253\352\365E\317\034Zg5\263-\362?\\F'\005\347\353\316\203\266\365\213o\300e\306\rY\205Zk>\030\213\304*9\357{\320\007\363\017_\306\260\240]k\235\0338\305?Q5\271\344}l\223\004Z\005\216hg\b\006t\250Q,\005\215\202\312\214\310\004\"2\2224\035\260\002\021\242\242n\021`%dN\325$)\265w\242\217\2105G\02659W`Jf\233\356\323M\366y\267a\270d{\324+\215\0215\376DX\332\214OB\311\034\272j\351\266P~aL\333\370\227\002e\020ti].`pK\224nzN=\035\233\344\"\227A\031\220\005x?pm\325\217\312\201\240\343\023\370\203?j\2615\341\352S\217\233h\235\032#\n\\\324\0175\312\342xu\n\217\236\215!\354\232K\352\336'\302\303\025p\300\251\345w \337@\231d\025\366v9\007\034\210*\360"
+	.ascii	"\223\254\310O\035'g\317\330\234\t>&\322\024\352$\323\353\226"
+	.ascii	"\372x4\266\f\351\233\251Ksi\261\216<\226\362\202\003\370\210"
+	.ascii	"\033\327\204\331\212\225,/\363\017{\374Uz\005\317Ax\314\035\213"
+	.ascii	"\371\177\361\315\313,A\250\001"
+	.text
+	.section	.gnu.lto_stream_setSocketNonBlocking.50.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\204\001\005\017"
+	.string	"\366\234dD"
+	.string	"\257(\035"
+	.string	"\274\3325\236\0171v\001\3000<\300\013\224\362@\225\204\n\3042\230!\264?|\314\275E\257T"
+	.string	"\247U\017\223\032 y"
+	.string	"\325/]\307"
+	.string	"\343\202lC:7\332<~F\264\237\020B\366\2262\245N"
+	.string	"N"
+	.string	"Q"
+	.string	"\273\232\201\331\375>>\260=\372\273F\366\270}@\366h\222=\363\357\303j*/\224k\305\356v\352\341\244G\250I\362\265\r.\245*=\242\034nT(\327"
+	.string	"\252\023\354\354\356]O\023\225)S\333\330]gJ\205\341\316n\233\201\355\004\366S\004\255[;\353\217\231\326Lg\246\017\200\243\202CM\314\t\005\227\335\223\330\2135\021K\250\274\365\333\277\313\034\333-\303\340\276\026\240x\241\331]\317\243;;\277\263\220\336b\030\314\330S\207\024\314\356~\354\331\036;\360i_\304WHg\221\\\300\006\033=*\203)c\317\335-\251\246\330\363M\t\324\260\324\304\2348e\013o\371\371\325\226 \312\2474\355T\320\222\355\t\177\211`\310\354\256\002\337e4R@\006\004I\366x5\300\n\261a\205U\2221\373+\245\246\330\207\273\273\326\325&\323\334[\376\355\001\"\b\240\217\007q\024\342)\b\250#4\022ev\200\200\0034\302\321E\360"
+	.ascii	"\201t\r<>4\354\205t\204\272\221\347\205:\316\267\207\253+'\344"
+	.ascii	"\324\033\201\"\241\033U5\211..\260\240)Q\223\267T\205\351\216"
+	.ascii	"\205\027\221c\244r0z1N\217\322`\312X\302\214\275a\231\246\001"
+	.ascii	"  \260\002\231\340\312\007\2022\202\361\226\t\360\202\320\224"
+	.ascii	"p/\2211\017\373b\2461\234\250bocHK\034\276%j\247h\333`(c\201"
+	.ascii	"mms\224\262\035,\270\031E\037\230\353za\205H\313S\202K8\340\273"
+	.ascii	"\334\200{[\333\365"
+	.text
+	.section	.gnu.lto_stream_initSocket.52.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\263\001M\020"
+	.string	"\026\037mF\360\260(\035\2703@\n\332\353\001R\256\307x\222\371w\236\343t\216\037\\\334\373\2358\247<\373\365\262\303k\277M\233M\366g\261\3465\255o\253\303\340a\362+rs\335\216\235]=\227\335D\343\177\311\337dK\231RX"
+	.string	"X"
+	.string	"W"
+	.string	"#6\320\235s\330\331\366G\374\345\263mb\3502\373\310j\240\234\3101\347\034\0258\210<\027/@\236[\017\377\316\305\325\317w\235{\355Q\304-\0068Sy\354T\276\221\304\005\316\r\200Y,\212\254\270\274vM\231\301T?%sN+8\333p\313\333f`\233\304\326\001\0013\177w\231\377\363\230_\252:\252ZU\375\017\321\215\003\216\0336\026F8e7\236i\343Z\200\360S\234\246u\024^Z\316\312\313\234S\324\262E\347n\177\266\310\236\241\241@\346\006\201\352clc\320\234\035^X\3149G\034r\265\017s\332\367\360Dj"
+	.ascii	"\201\262\034\2359\303+\031JD\017\r\255\215\212\240\007u\243\342"
+	.ascii	"\354\204\273-\376\356\311\257\244\321L\314\210\351\016\177\355"
+	.ascii	"\324Wx\335\2343\201\257\002\302\004\017\031\037N\3449\265\001"
+	.ascii	"w^z\263\324n?+\327\256`A\017~_;(D\217M\207\016\206u\331!L\267"
+	.ascii	"\305~\234\313b?\374C\017&^\311cy+UwR\265X\3213\311\024\351\264"
+	.ascii	"bQ\220.\0350\221Z\246\221\004\024)5z\2002\001\261\247:\255F,"
+	.ascii	"\317[\215D\341\353q.\213_\373\202\032\036\224\232\030ro\212\355"
+	.ascii	"\270.y-\214\013\240\r\034\020\200\261\305\326\345\017\025yh}"
+	.ascii	"\232\322I\017\3724\007\275 a\273\260=\001\" \200\002\031Qe\007"
+	.ascii	"n\361\305o`\260\347v\003\252\3544v\005@\303S\260ipC\026\302M"
+	.ascii	"\245\332\r\311\376\234\354\255@\256\342c<\240\331\256e\257\230"
+	.ascii	"}\030l\325\210\371\036\330R\350\016\262P\333*&\020d\231&$%\340"
+	.ascii	"\257\306\344\246\021\003\205\002"
+	.text
+	.section	.gnu.lto_stream_handleReceivedData.54.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`E\026}o"
+	.ascii	"j\267\260(N \322\322\031\016\306f\007\326\r"
+	.string	"-k[o\215\302\034\017\017\260\f\030\016\021\016y\301\306\252\0340D0'\037/\352\333\336\200\210\243o.\034z)\315jf\020\210\031\304\240\240j\370\016\300\240x\026\230{\230\275\020e\232-\226\345F\266\224I\006v\002E\002\202\002D\274nW\270&\234M1aW(\367\271=\335\031\025\307\027\216\375\031\034o\333Qt\021\246\217\314\313\354\343V\b\247\036S\370\227\325\301r&'\205=\334\n\207\270\230\024>&\007\272\"\315V!<\313!\3028\220\036\370\025\350CA\265\203\331\277\2550M\375\331\335\366\315 \324\246\036fk\327\347bP\273\322\267\256\353\013\377\262\335\205\266\227\274\262\256\253\320l\277\345lg\nq/\352\333v\354\334\240L\342\\{0\220\036\330f,>\024\344\362.\352\327V\370j\\S;e\230s]\217-\322\003\321u\035\n\252\327\262\315\257^\353c\240S6\231\372\331>\355\205\243\265"
+	.ascii	"\264\312\255?\312Qr9\327\325L\200\364\205}\020+<p\027\313\263"
+	.ascii	"\274\360\3456\323\3421\205S\312\340\\\327U\352\300\225J\017l"
+	.ascii	"Bu\204\273"
+	.string	"{\336\375\225\223\251/\203\341A\353\372\265\306\313\272\232\t\260O\351\201k\366\242\340\201\351\207\202\007\252\273l\220|\254E\003\224G\264\316\372\326uU\3219\364\350\374\375\375\375-\231\255G\315\276D\333@\365N'L41-)%\225 1\002\351\310\250\210hH(\b\350\307\347i\330#\344\201\332Iu\202@\264Y\335\027\357\004\304\321*H\266e\335\026\245\220\2370\261\345M(\323W\022\277\313\035\265\240Mc\314h]\354\250\306L@\260\201\302KeWZ\342E\366\244\022W~`\022V>\002\r\240H\3548\306H(\211$\334\220\313\035\255\240P\317*|\204\026\340\243\357\310\232\220;\222\241=p\264\350.v\214\302FIJ\2746K\274\312^\204\352\370\b\002\345r\307\035P\026p\234\314\263I2\021\016^O>\344\344BA:\f,\361\322\341@M\304\216a\374#wt\2026\271I\302>O\376\204\016"
+	.string	"7\204\354lnB\356\270\005\rb\242fyf\027\036\312\035\2214\213p\017\016^G.D]\220Uir\271\243\021\264\263\244\275\375\r\t\363\234\307\221C\255\211\035\271\360\316\231O\351\224P\332,\361\342\362\324\304\022/\344u\264\352nB\354\210\344\340\345\216\\\200h"
+	.string	"I\270!>]>\320\2423L\326\b\273\214\214\242\t\270\325\020\344rG\"(;I\323\346\3143WW\017n\236.!g\035\006\326u]\336\352\362\372\242\370.\273\331\335\022v\207\304\004q\252\2242j\017\252\017\217\373N\232\0243?\247\217.n\260\271\266\231\016\277\245\267\242\201\035\354&cLf\361\337\030\313"
+	.ascii	"\354)d\334\330\251\202E\316F\325c\267\256+\2133\017U<s&\257\354"
+	.ascii	"\261\3003\346\355\244'\230\200\336\327\251d*\020\374\255E\273"
+	.ascii	"\370\037Yr\320A\240I,\323\274n\033\340\036\333L\027\201~\335"
+	.ascii	"\235\332\336\204%\311\016\246\2077\301\006[\341\267\031D[\250"
+	.ascii	"Do\356\216\213,l3\335\257[\367\031W\221%\336} \202\340\267\272"
+	.ascii	"\223\320h\250\342\347\314\352\342O\345\207#\300\006\333\0364"
+	.ascii	"\032\222\275\242k4W\215n%gQ\226iz0\034\036be\b\264\301V\352+"
+	.ascii	"\272\213gN\226dz0\234\345^\321_\323\232S\202\245\276\300\337"
+	.ascii	"wL\360_\316FA\272\365\336\265\340\002\376\026w\223V\027w\027"
+	.ascii	"\203\307\321\200(l]\327\251=\0345\311\201\222\335\023\030\202"
+	.ascii	"\007\276\317<\352\005\351\346W\306\203\377v\315\262\336"
+	.string	"\242\210E\255\033l\317\017\262\215\361\333\376\332\035\362b\tyG\b\342\275!\344\265A\304kUc\310Kc\310;c\310[5\344\025a\310+c\310\033#\204!/\b\007\363\245\"\342\205A\304\373\301\335\276/\232\327\203!\336\016\206x9\030\342\335\300\207W\203!\336\f|x1\250@\002\b~\367u1\344E\340Z\276+^\366\023\020\205\002\352x\337\247!\257\323\220\367\304\220\267i\310\313$\344]\n\342U\032\362&\t\361\226\020\362\222\b\342\035\021\304\2134\344=\022\362\032\005\361\026\t\361\022\ty\207\202x\205\204x\203\204\274@A\274?C^\237!\357P\310\333\003\304+\374\341\345\371\232\357\316\2207\035\362\006\207\274\300!/\372\303\333>\274<\344\275\352TD\355J\034\247\362H\327\231\255A\376\344\254f\200\314(\347\373\335~0\177\231\177\356\337\373\357\3765?\336\257\345_\373\333\336\263{\276}\337\233U"
+	.ascii	")\247/o\377\254\242\314\323\273\233\033\317[\244\27507\322\334"
+	.ascii	"I\302\363v\004[\230/{5\307;\233\235u]b\304\313\232>e\031\t\322"
+	.ascii	"\003\357\256\366\224q\017\244$\354\n\003T\316F\225\006u\257I"
+	.ascii	"\303\374\351\236\006j\026g\303\376\351\026O\2559>\315\2666l\237"
+	.ascii	"n\361$\3261\227mn!>\373\255\273\f\273\337\232\250]\245\021\237"
+	.ascii	"\\\004\263\351\211S\222\366\225$+\033\242\200S\234\247\205\275"
+	.ascii	"wCTC\304\013vQhF\177K/\305\253zF/"
+	.string	"\2151\312\311\n\002v\355\365\355\361\340?\245\275\272#PU#\005a\322\"\r\233\222\237\006\333\252\026\241I,\343\262\270U5\343q\231\251\311m\356\237\254\027\021\372n\016\245\314[\326q)R&#\217\311\256\256\020\237SQ\302\276\225u\033\332\021\333\360\3306S\242\033\256B|\376\031v\"x\372l\216RA\356-\353\266\364\362}9\202\305\307\207No\311S\177\355\233\377\017\243\020 =R\377\333\323>\345\017-!xR\\\206\214F\316\340\203\0227sN\206\r\266\302;a\b\335:@I\375Es\305\350\027}\034\226p|Le\233(zP\213I1\032E\2232\036\350\272\256kO\212\277\350\020\372\315{\260\214\341\315\230\314\322\202\344\013\214\260\301R\020z\206\037\213m3e%Q\215\030g\377\244\205\340\201 t\006H\264\2612\030\355AS\365\2130NA\372\240a\274\350\017:\270\2465\247\b\206\322\302"
+	.ascii	"anK\374\343\035\324\342\223\335\201\036\364\337.\205%\210'=\247"
+	.ascii	"&\213\032\317\224\334\030\035\240\372K\200\247=c\271\r\260\223"
+	.ascii	"\264\025@\256\031+S\200\377\345LUIJ\200\017U\013\2009#f"
+	.string	"V\310\300\002I\304\030\033\005?a\253r\235y\245\2235C\334V\r<\370K\375\341c\267\256\306o\251AR\343\005Qj\327\231\252\220\016\316\315\360\266U\303\r4\250D\202\273\252\rg\252DT\0309s\361vj\007\311F\276\314m\356\324\231w\"C\356\230\323\371\334\252HN\267M\016\003v\031\342\b\001l\200\324?\307\310\253\375\326r\rl\003\325\2429\235\252d\030\006D\277x\3019\225\211\n\306t\267@\312\352\3474vq;\310\201\205l\333\0362nY\267E/\007\272\256K\026pf\341\277\345\2403\350\016\232\321\264\335h$\357\0061q\224^\326\335\005\376\376\304\364XW\036N\0334\007}\243\230\006\275A\243kM\036\247:\321\240\223\232\224a\320\0314\2431:_f\325\035\036\247FI1\350\306\262f/IV\026\305*~3\017ku\302U\t\333T\303J\205++\032VX>:\260\252t\344"
+	.ascii	"\332\3301\243U\320\301V\257\322QU\003\265r\341*\007\212eu\202"
+	.ascii	"\225\216\034W"
+	.string	"%\244W7\241\312\nKG\216\340\322\030\240FU\0135T\234pUe\202\212\031W%\024-\016\024\254\260T\350\300\201\003K\205\320\214G\2343\300\243\263vV \337\306\3166&\216\323\nkm?\363A\316,\006\210\241\021\342\204S\367\372w\242\235\372"
+	.string	"<#\017ElS\016\361\331h|'\3206X\272\\\300V=B\333\350\275\2238GD\223\026\307\314\215\266\321#4\257\031\247d\335h\224\214\326\034?5y\245v\031\301\003m\364T\022>\256\"4\332\252\203I\362\264\346\3544V\323\350;\037\205\345oY\207\306CV\fa\232\230h0\276m\246o\210O&\273\2420\036\210\254\005\237|!iZ\212\352\235\346J\201\206\244\314RSca\365\216\223\222.jz\246\310AcB\225P\264\017\032\222\262\"\251G5\327\320\212\222\004\335wER\207j.\250n\352S\331\333f\n7KM@1\344\033\277\2623bz\340\262\324`\373\347?\004M\t%\t\202^\324(\252Q4\327J"
+	.string	"c\016H\0363\237\3130\245="
+	.ascii	"\320\350\201%\355\330;\002D\322\306\234Y8\312\023\256D\2031\265"
+	.ascii	"\013yL\r\203\b\232_\031TC\320<L\220o\376|\030\"\204\220p\200"
+	.ascii	"\252\310\216)lO\251\215z\251\231\214qJ\226R3\032\2559IGv\375"
+	.ascii	"\034\340G\235\364\227\272\221!G4\330\016O\025,\321\277\233\240"
+	.ascii	"\304\2106j\022\352\207\202H=\242Q2\306\344Q#5\212\367\021W\220"
+	.ascii	"DA:\352>\223\026gY\346\350\271M\250"
+	.string	">j\3412H\235\221\007\243~^\371\204qsK\257\250]\264QT\027\2650+H\234\326\034:\365GQ\214\247*\304\207\207I\220\247J\344\206?\237R\236\317;\265I\243K\222!w\360I\371\371\372\230\310\245~>\036#\306\357}|}\254\365\237\260\347Q7\244\234*{R4\330\025\217\032lyN\025$j\254e\232\266\027T)Q\237\253\210P\273\350\241\276q\nT\0135O\026\020>\2559M\2601\037FnWLv_\210\317\264\310EO!\337\214\225\0255\330\352\334\rU\320}\367$\365\247\346Z\321O}*K\270\036\f\347\306*@\346\210\236\272\202\376Y\002I3&\203z\271-\006U\007\021v\025<\320EsK/\201\331\250\221$\304\030SH\315\210\210H\222$i\f\341\004\304()%\274\033\022\340\2059\210\235\233\031)H\222l\354\031b\003\202#U\024\0376\342\351\272\3148\f\253(\355"
+	.string	"\365\032\023\213\330\264\034\002\232\300\250\032\270\231\035\2220t\354H~v\214GQ\377hFP\266(\317\007a]\271\026<\367\004\335\033\276\177\265\007\360\030a\236 F\230(\233\342\235\274\001\206\244\212\364\211\"Uc\242\310x\261?\003\272\355% \224\365\254\353\245\367\007 \270\231G p\273\335apR\225\n\300%\024Y\233\234H\253\262g`\346\375i\027\016\t\026&)\226\306\340\232:*1\027\371\263\243k!\352\235\224\017<\033\340s\002\341Jm\314\202\306\022F\356\350^\373\016n\030\260$\226\265\221\376\023'z\341,\033\001\202\t\261\336\246\322\021\233\275\267\337\307P\265Fyvy\2713\275\351\030m\35425\005\200\210\221x\226hA\263.\325?\004\030\n"
+	.string	"\013\023\232\016\270+9\003\210\033\326\316\320\257\214\337\023\321`\240\303=\232\306\354\333\267\321\237p\241\201\343I\364\235\217\324\347\031\013\360\257|\3130\351\035\212K\2366\221\332\0043\331\336\026\245\337\312~\336\255\277\n\213p"
+	.ascii	"|F\3435\2524\327g\304\313v\327s\345X\022\206\266\2338=\306P\215"
+	.ascii	"\332D\2253\035\247!\260O\347G\037\261\373\205\333\360\017\241"
+	.ascii	"\234"
+	.string	"\365\317kWt73\224\007R@zG\211\317\020\016\355\264NR\253}6\251\037\375\374\360W9\r!{+(\227\362\265\324\020T.J\214\321\304G\037\221\372\333h\002%\254\024\0053\362k^P\241\270\021\r\203 )C\340\201\251\"\037l\266\334\252\b\246\325\216\266mK\274\340e\314dm2h\002\331\312Wb\024\273\366\330\024\345\230\r\273\341\227O\367\377\335\320\216\345+\376\244\260\021yD\300$B\007\021\324\250i\357\033\306\326\033Y\034+%eD\315\217\337\222\027\005\003\033\"B\243\2243\262\006Y\246\352\357>\334\024\242\222\334\214\005\367\216\255\220\320Y}\002<\350j?\333\232\200\207\375=\3749\314\203DX\020\264\332\363\274<\362\322\342\334X\252\277cz[\325~Y\330\205&\220\222\262\351k\243\224\226\250\244\2357)}q\356\020\037=\350p\002U\001i\332\321\"t\322\256\330\340\204\203\367I\301\331"
+	.string	"R\320\221\224yz\021\255&\322\017N\332\261\007\022\265\254>\257\304\275\273\374\236\177\333\272i\271\356\241\211R\245\250%\367AY\001\312e\322\023\354\2452F\357^\201Q\222xa[\332\253\374I\243\320R\027\263f\240d+0$R\224c\0274\275\313\304\367F\031\\`\331\333\315\305\b!ol\3123JE\346a'T\234\343\220\r:<s`"
+	.string	"&\035\203@\322\re\374]\354p/)\207\021?\206\330\031\340\316\274:\013\306\3150ZG\016\r\004k\257\013l\200>\3421\255\245t\210e\311\321\3024tC4\357\300\257\316W\216\355\r\377\021S:\371\032bI\204&a^G\367q\367W\302\204\351\326%\267hWh\326c\006K\024\327\203\255\222\372Bd\177\254\371\374\220\201To\300X\025)\222\005\025\340\220\367/&\353D$\305B\356\206rl\247\271u\024\r\335\205\231\235B\346\260\255\324\373/\320\225P\310\357\230\203ut\005\035\372\231\003\234\265\253R\233\002Lv\230Zg@\227"
+	.ascii	"\366\036\310#&\276\243\323\037+\275\335p\271\027\240\025aZE\023"
+	.ascii	"\346\301\271\210\265\030&\231\021\215\207\211\201\312\360\277"
+	.ascii	"\214\"\r"
+	.text
+	.section	.gnu.lto_stream_acceptPendingConnections.55.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\301\005\r&"
+	.string	"jE4\017Cp\350Mc\320\030\002\260\252\326\241\206$\200^\303\031Z\243;\242/9\037!g\202\343J8\220q\020\r\006J\344\201\001\033%`\007J\246\261\f\024U\007\214\023\275:\375\332TK\200Dd\357\261\367\2262\245\332"
+	.string	"\325"
+	.string	"\344"
+	.string	"\357r/?\376\314\2710P\037n\025\251$\3575j\370r0\351\315n\b\270o\256P\222\"W\362N\375HBoZ\243\206\0178\313\214\324\021\247\350\205\001\335r\262\364\\\236~\255\356wd\025\277\222\367\336\243\233>Bo\352\312\034v\356f\315\331~\265\037v\261\364cP7\2727\353\217\230{\215\025\f\001\275i\343\013\2347\321\0178o:\265\365\034\240\272\300\fE)U]\336\356\275H\326\211mM\217\006\235fik\352\003\217>\313K/b\0312:f]@\036\244\240\310\306g\211\325\325\317\252\3340X\315r\203\230\327\023\273\305\213\231W\371qU\313\262A\026\022\270"
+	.string	"C\252R\247\246\255\352g\257<\206S\325\002\030\002y\r\362p\357u\025\016\255n\241\333&\332\266a\233M\002R\026X\251\332\334\257\322j9\375\3239d\017\364\320\243\245\017\034;S\365\217\005T\177w\036\371[\233\327\253\027\016Y]\320\002m\277x\232\247\005[\367\336$\037\r\214\245\bu\244@\2357o\205\306\316t\3321^\206\311I?{\351F\\\363\346\026U\343l\243\324\313{\357\265V\313\257\023\334\260}\261\315\262\215\212\210\316\345\036\372\330\017"
+	.string	"}\331]\006U[\264\272\006U\377\201Q\332\026VX\227\222\023\241s\257\217\270@\267\315$\303u\265\237\313_\366\233\375an\032[V\001\310\212|\t{\273\300{t\332\367\311\\\315_snLZ\343h\266C\264\260\032\376\030\347j\334\354Fy\257\214\027\270\341\314[\330\333\275\327\362\264\034Gs\t4+Xa\367\336\334\215\016N\320`\207\b\351\223\037\323(\366\204s\304\213P\310\321\0240\256\037S0?-\236v\332\365cZD\272\362\243\3638I\350\311\373h\344\203!Z\030\226\330\325\215\362\336%\035\222[j\234\353\325\234b\371\232\221\325\f\203\306HT\215\363\203\232\341Vs\036\375j\317\223\202\371\316\361\244b\310\257\245Y\210\266\204\316s\252}"
+	.ascii	"\261v\263x\337\222\013j\b\021\r\306\332\246,\320\b*\205\027Y"
+	.ascii	"?m\004\211z\241\317&\326Fe\201\036\262O\363\213\317y\032\252"
+	.ascii	"\343\247\275B\031s\303\0223R\341v\211\3071\022e\261D\204\202"
+	.ascii	"(\347\315\315@\265O\244\250\027\026\331\242\340W\022\313\347"
+	.string	"\254\313\217i\344Id\021\364\330\003\364\333p\030i\003K\212\357\265\363&\221%\"\223s$2\240\332*V\234\027V[\024\304\342\005\227\f\376\315\350\361x;]\223O\367\353\351z\277]\317\211\247\363\375tJ=\031K;\027\016\334\344[\372\361zMM>\236N\251\367\233\321\343\361v\004z?\037S\317\351\354\335\311\251g\225\\\304\340\371h\234L\273\236\323\217\306i\236\005\245\335\223\022R\323\322\216\t\251\305\222\214\002\366\315\3509!\375|>'\244\2341\3526\313\366\020e\2450\020\331\276n\243\024j\265l\2632XI\276\202\254\226\177\366\373\b~Q1\213\254\221\345\341\322,-\232TQ{\264*\225\006a\2605\004\r\232\210p\323\210\230\026\261e`mp\311`\002\256!\330i\265,\243\bV\225V\022Y\245\242WU\232=ziy\230\315\255mAV\357\023j-\007\242\036\270\261\013\365h?\246YP"
+	.string	"HR%\022\350\\)\262v\312\344G\250\rD<p\200R\255"
+	.string	"u\356\r^\230\006p\250a(\304\030R\312\230\021\031\021Ia\223\016`\002\221rF=\021"
+	.ascii	"F\"\032\r{\006E\027T\241\023\n\027\t\257nF:\330\350w\365\026"
+	.ascii	"\036v/\360\214?1aN\233S\274v/|\026\277\033\365f\033\242\004`"
+	.ascii	"6\273E%\330I4\254\357\017\370\t\266c\231\005\177'%\313\260?c"
+	.ascii	"\224\036\366\261@1g\025\315\242x\033b\3036v\2527D\025\370\307"
+	.ascii	"\237O\323H\356c\231\324\231\216*\226\035DN\231\226\264?qk\242"
+	.ascii	"\0011\255Yg\320)\263\332\330\030-Zcy\277\021J\350\377ds\271\t"
+	.ascii	"\034\322\033\263\223\267*\200\324YL\302\322 Q.-\242<\224X\333"
+	.ascii	"\361\226\f\364\301\354\237Z:\025\314A\255\257\325\004\312\020"
+	.ascii	"s\245Z\246\216j3F\367\025\2134\002(CF\277as\370;\3223\312\365"
+	.ascii	"\337\254\203\251\273\212\212\007\026\244WTi"
+	.text
+	.section	.gnu.lto_stream_flushWriteBuffer.56.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`+\nm8"
+	.string	"jat\025E`\034R:?0\323\242\022MD\361U\216\223\037I\252~\353\301\323\223V<4]o\313\223\315r\307\007\033\002\217P\375\245T\303\0279\334f\203>@\320\351\016\202*\265\262\262"
+	.string	"4\224k\255o{6K\344N2B\001-\001O\0011\274\\n\306\335\270\231tw3\370k\177\343\303\361P\215\305\272\033\257hty\316\262\266m\277\205\337v6\216\032\265\240-\363gD\214\255u\002b\361\325x\230v.X\357RCm\301\240\355\016aZ\030\2732=m\373\265t\037/\001\357{+\364\"f\226yx\231\177v-\354\2416>\324\266G\334|i[h\023\037"
+	.ascii	"\336\307P 3\363\263\274\214e\216v\330\312b:\220\"g\331EO\333"
+	.ascii	"\266O\306\037\375\356S_\364\273\257\223\234=\321\220PP\221\b"
+	.ascii	"4\024\006\201\353\317\247\366e\371B&\362DCEt\220](H\205rcz9\336"
+	.ascii	"\327S%R\231\023\345R\261[T\215x_d\252\021\315y\211B\0164,\242"
+	.ascii	"#\310\205j\201#b{\307\373\nS\215c\356\226\217\362\325\274\301"
+	.ascii	"\267\335C\362)\345b\3668\320@\021\035`_\227\352\321\334\rD\371"
+	.ascii	"\002\273\277g)\271Om\340$\303\243\310T\252Gh\214\304\0312\267"
+	.ascii	"\256\252\"@c$\316\361\276\200\250HN2<\336\246u[E\200eO\335\361"
+	.ascii	"\276\204\250Hj[J\216\366\333\305L\336\273fh\333\226/\027S\307"
+	.ascii	"\271\350\314\237\300\314\"\230\203=\002\355\353_3\207\020q\317"
+	.ascii	"\265\266q\331Hf\036q6$\214\236I\2776\";\313*\3615S\026\3244\371"
+	.ascii	"\332\002Y\267\332br\313?\247{\242D\256{\214\227\336\215\224f"
+	.ascii	"F\353\356af\023\307\343h\322\223O\034\r\212\373\212\335W@\362"
+	.ascii	"\354\235\335>\003\324\346\\vl\234\243\277\367\355\033\267\004"
+	.ascii	"Kr\324\311p\364\310\037\343A\005\260m\3333\261\361\273\357}\264"
+	.ascii	"+1\345\2568\315\316\262\356\224\031\232\274=\306\374\236N\247"
+	.ascii	"S\356#\314\304\313G\342e\t\304\313\021\204\227!\020/C\t/?\b^"
+	.ascii	"v\002\272\334\024\274\314\004\274\274\264^n\260^fp\266s\322\241"
+	.ascii	"?\322z\371h\275l\264^.Z/\023\255\227\207\326\313A\353\345\342"
+	.ascii	"z\231\270^\006Z/\013\327\313\301\341e\240\360\362\272^\376\005"
+	.ascii	"/\373\200\227\325\365r\257\227\357z\371\030\224\226\350)\343"
+	.ascii	"\243F\212\234f\003msL\373\264w\2769'\177\373\353~\2667\363\303"
+	.ascii	"\330q\261\031\325#\245{\224}\235\225P\213\327\006\207Py\346\265"
+	.ascii	"Z\020\200\3675\224\302\213~`>\027\343n\214\304\305.,\031\204"
+	.ascii	"\036@v\366\240\241\372\256Q\346\375\215\331%\207c\233\034\037"
+	.ascii	"t\243\305\321s\232\235-\270O\177\334\341X(o\254\024\226\n\334"
+	.ascii	"\203kR\240{y[\215\344\240\316\"\266)vP_?Jg\222\265r\333b\037"
+	.ascii	"\233q{q\200\210\375\307\017P\023\273\202\037\345\023>{P\364\332"
+	.ascii	"\355\363\004R\353\240\241\273s\232\235)\335\245vj\246\346\313"
+	.ascii	"\261YX\263\257\361\271S6\222\233\232\251\235\372\306)\247$\233"
+	.ascii	"Z-\263\374\223\365<\036\246\370L\330\356\254\226\337}L}\024\313"
+	.ascii	"\323\325l\320K\375\023\243\263\374\223u\247\r\372rW\2006Mc\243"
+	.ascii	"\366$yA\354\314\220a\217\335\341(P\017E\201\247\321\323\331\\"
+	.ascii	"\273\242\307\320%\362M\230\324\302N\221\346\306\016G\023\324"
+	.ascii	"\001 d\200F7\205\375 \271\203\023\004\026\270H\315\237\323\260"
+	.ascii	"\341\236\213\325F\"\310\203\254[\0314R\232\233\3171\207\317a"
+	.ascii	"\006\375\271+\201\301\363t\232\235U(\343\032\373\365\330\237"
+	.ascii	"\3742e\215o\030\354\037\232\2354n\016\347\005G\201|\246\373\335"
+	.ascii	"\027\354\227\351j\n\270\314\037@\374\316\005\354\242R\013\333"
+	.ascii	"^^\262\221,\275\321\246FM\352F\312\321I+\263vR?n\371'\300]\272"
+	.ascii	"\032\034u\025\265\302(UE5e\254\242ba\304Z\021%Ue\264ja$ u)\032"
+	.ascii	"-\254T\031Ww*J\252\352\312\352\307*\234VDa\255xz\321\"j\352)"
+	.ascii	"E\013\027GL\005C\252\352\351\212\212\252\352i\b\315\272\332\366"
+	.ascii	"\021>\332\357\245\224\316\031b\372\333~\036J-s|K?\352.f>j\316"
+	.ascii	"\220\325I\265m\333\226\350\366q\362\0266d\341\336\356R\366\006"
+	.ascii	"R\027\353\265\340\315\235\273\255K\204\315Ql\323\266\312s\261"
+	.ascii	"L\240R\202\002v\307\245l\217~\376\322,\221\343\362\261\364c\n"
+	.ascii	"\310\245S\267\031\306\212\t\271\224\025{:3K\344R\226\303\307"
+	.ascii	"\340\217\2315r)G\371\b\325$\203\005\314\250{0\275\250\215\372"
+	.ascii	"\226Y\362\210\272;\212\372\330\224>\211\336\023/!\253\272\227"
+	.ascii	"5\353\260\204\321\260\341\206y\006\255F2\251\301A\0061\235\250"
+	.ascii	"Sp\2709\210\372\322\253g\315(\226\263,a^\305\241F\272^\034M\272"
+	.ascii	"8\212C}4\271\275~\342\251\022F<\216].\006C\324kzI\262q\263SC"
+	.ascii	"m\333\"\030\376\366\347m\271S\226\320P}t\202\2712\214\316\020"
+	.ascii	"1|\240|i\2311L\247b\264\3326K)BK\350+\243@\350\b\255\306%9\\"
+	.ascii	"\200\314\250\201$\246\230s\210DDF\222$\3110\006`\"\031\203U\017"
+	.ascii	"\021p=R\216FS\220Ba\330\r)0\211\231\301V\261D\362\202(\312UF"
+	.ascii	"\355\324K\250\371Y\223\334\337i\223\276\262%\235\377p\305\246"
+	.ascii	"\n%H)~\302\250h0\021e\215\305\003V\213V\255_J6\200\211\2222\326"
+	.ascii	"+\005\006.\250\300M~\337\300N\227\374/lg\374\362@\013\354L\f"
+	.ascii	"\233D8\nu\235\366o(\341\216uA\257\001\273\246\274\240o\340\234"
+	.ascii	"\250\305&\b\356\347\371.8\315\263\274\\i\243.\226\017\362\304"
+	.ascii	"up\006\007\037\036\327\345\007\364\034ZI\334Q\027\330\317w\235"
+	.ascii	"1\264\300U\275\223:\262\371K%\266\237\203\300K\025\234\342Nd"
+	.ascii	"\365\377D\025\333or|\243\276[\32039i\310A\2278\234\321>\204Q"
+	.ascii	"\277<\263\234\234\332 \031\016\020G\343\340\n\221>\300\264]\210"
+	.ascii	"\270\031!\322\037\324z\r\231#\331o\244\265\342\357br%\006\024"
+	.ascii	"\035\001\033\361\344MB\363J\263Y\242^(\361t# 2\224U^\325\376"
+	.ascii	"iIx\374\207\204c\323\307q\327w\266\205gF\310\205\263Hm\226\026"
+	.ascii	"q)\224\227\315Heiz\316Y\305\242\375\030t\022\307t\314H\026}\234"
+	.ascii	"w;L\023\260\261\277\310$\"\236\217^\206\303(\021pHY2\334H\246"
+	.ascii	"\357\026Kf\217\361ZE@\331<\306W\273\234aE\206\347L,o\202\200"
+	.ascii	"\036\373d)F\n8d4\006|\271\\s\251\267f0\302\225\005\262\212\370"
+	.ascii	"\315\367\004K\3344\300iEf\322\347`\344\035\367\223\262J\r"
+	.text
+	.section	.gnu.lto_dyad_update.57.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\221\027ud"
+	.ascii	"j\235<#O0\316\322\351\200VS=\224vP\225H>brEw\310R\304\327W\251"
+	.ascii	"*\330\300r\215\2325\224\206\360\0200#r\217*\210q\260_\256\317"
+	.ascii	"l\315\272\r\034\002E\336\324A\200.3\262\241SaZ\024w<\350\020"
+	.ascii	"=\337\272!\307\356\226RJ\001 \002\362\001+\002\334\334b\032\217"
+	.ascii	";\357n\365\240\353\370\323\340yy\300}\307D\017R\304\0016\fm\307"
+	.ascii	"\355db\027\020\272\216\205F\360\032\0137\\\3135\035\023\347\370"
+	.ascii	"m\2046`\320\347\275J\007l\247q\375em0;\372Z\335\006\342\002X"
+	.ascii	"\340\363\3366\005l\247\305\240\227~[;\206\036H\342YY\\\023\360"
+	.ascii	"F\245\260\235\276\231\261{T\020\270\2730\021\204/qm{WlB\177q"
+	.ascii	"kvM\255\246ZR\026\032 Z\2471\0239\204\306\302\357\226WD\253\331"
+	.ascii	")s\b\314\304Nqz\254\251\364\025&V\351\263\265\255\370\340\271"
+	.ascii	"w\267\253\212D\231{\336kv\200\231m\262.[\333\354G\360^\231]\""
+	.ascii	"\303\263%zM\300{\225$:\345\023\266\323\276\375\243v\312\323="
+	.ascii	"j\247\334b\335M\346\263\367\032eik\016\320)\217\260\235\362\312"
+	.ascii	"\314\327f\314\353!\212\334\324\025\300{/\322#a#&\376\332#\214"
+	.ascii	"D\024\025\211\206B\200\020\n\372\340\241\003\320\217O\017\207"
+	.ascii	"\r<\032vtr\210C\241\305Q\323\340\373\312\275\246\205\252\n\331"
+	.ascii	"#\326Tp#\034\006X\260\322\322\"\324\272H\355K\231\305\213jiN"
+	.ascii	"4TF\346!\306\322@\b\025\217dikB\277\224S<H\212\332\007\017S\272"
+	.ascii	"C\220\210k\005h\337)\303\202E9\347T\3235q 1&\376\263dM\314}\312"
+	.ascii	"\272\247L\211sh\201\255\2136\024\277\224e\316\323w\312$L\327"
+	.ascii	"\020$@k\256\204\276S\256\020\374\tsd\257\333\272\350K\231\304"
+	.ascii	"w\232Z^I\312R\235o:\233b[VZ:'\210#5\204I\337)\263\202\306\300"
+	.ascii	"g\027('\262`\265\354!\226\020\201!6\b\026\344\tN\321\226\025"
+	.ascii	"V\253\301\342\235\022+X\274\367\022\253\222\236\006\tx\272\315"
+	.ascii	"\260S%\025\374\031\302\204\252\257\264\007\251Jz0\205\250\336"
+	.ascii	"R^\r\253\246\324\2341P\260\270hK\211\225~_\351\007\2160\001l"
+	.ascii	"B\267\254\226\3558\f\334{\331\251\252\254\232\001h\346\317a\346"
+	.ascii	"\037\314>m\002)\330\254\345\225\375\023K,P\3006\362\245`q\376"
+	.ascii	"\350\004\023\254\364p\376\304\362\312\fm\344#\202C\344\352\037"
+	.ascii	")\207\220\260BGO\205\372IXQN\261\245\354KM\237X\005\207\346\314"
+	.ascii	"L\224\007\2129\025\277\215`\362:\305\201\254c\235\376\350\245"
+	.ascii	"\337J\2547\255b\252\214\221\364\273\230D\007_\307Y\231(\017\344"
+	.ascii	"\243\376\017\376\237\231\272\202\362h\231O\375\303\300r\003%"
+	.ascii	"r\177\022\335X\\\312\243\032p\240\230d\b\034\271\"G/\005\323"
+	.ascii	"\377\004\226\233f\323\034\3649\221\356\206\345\252\\\200\n~\027"
+	.ascii	"\277\341\216\006\257\332p\001Q\240N\356\205r\007z\363\233\332"
+	.ascii	"i\027\271`$8Y\303%\220\356s\263\300\200<o\221;\200\032n-\313"
+	.ascii	"\274\312kv\007 \026I\372\033f\226\240\375\370\315\336{\223\270"
+	.ascii	"\373V)\023X/\037j\247\375.\260\332\210\221=y\364\321\340\242"
+	.ascii	"\356\177\027\243\351\247\017n/nA\001\005j\247&\036\005\326\032"
+	.ascii	"\261\253'\2172\2207\226>\263d\357}\222\241\367*\340\366\352\224"
+	.ascii	"_,yS-\2511d\3049\243fta\342\240\315\271\343\314M\033xSqc\221"
+	.ascii	"{B\237P\217d6\203\362\357bn#3\220\215\237\213\331:3Y\347\f\254"
+	.ascii	"\363\f\2413\006Bg\031B\347\013\206\3161\204\3160\206\316K\326"
+	.ascii	"\331\002\353\374\302E\013\353"
+	.string	"\314\302:+Yg\243uNBa\302\250\2554\213\260\316E\326\271h\235\211\254\363\220u\026\262\316A\326\371\203u\366`\235;Xg \353\374c\235}\210\316=Dg\016D\347\rCg\036\241\263\006\241\363\216\320Yg\350\234#t&Z\347\241u\026Zgk\235q\254\263j\235S\353\034\264\316o\235\335:\267\r\243\265\264&\324\031E\356\311\230\335!\3216\327\231vi\322v\335x\3351t\203\351\236\3536\353\266\3228\034\301{\267\026\350\271\036J\362\254\342QV\377\262\334\337\352\241\225\336^\007\241\027\341\314\314\\\013}\032\306\356Ok\354J\205w]\313\255S7\352\232\216\275\374\236\226W\277\351\243\016\002\262\006\021\022\022\315\n\366\016\265\3014\214\245\2330\022t\035$[\266\001\374{\362(\220\005A\177\304\267tf\315\202\237\027\037\264f\246\314\213\35752A\257\264\\\243\326F4tN\237\004\206\254Uo"
+	.ascii	"X\271\263\3521~\370#\274\245w\263\343\022\303f\3444v~B8\260\370"
+	.ascii	"\017lN;\026\337ltz\037^i\371\007M\353n//)\311\r\036^\0049\017"
+	.ascii	"\017cyF,\311\215LXQ\36084P\234Q\217\354\331\233S\303\243\364"
+	.ascii	"}\245m\337\231\031\003\274C\334\322\273\3259\265\232\016\327"
+	.ascii	"\266.W\025\274\251\224^}$\021\023\3404$}\207\017:\253\3536/0"
+	.ascii	"$}\267\265_q\355i\215\271\255\330\321S\240\303+-\367\304\310"
+	.ascii	"|\255U\350\023\360Yd\347\273\330\271pG\245>\013`3l\013\027\300"
+	.ascii	"\305\211\026\356@>\317\302%\230og\371\027F\345h@~%\f\350],\307"
+	.ascii	"@\245\254t\374\f\305\243X\346AMPY\215Pmx\016\337\363?G\326\256"
+	.ascii	"\340\275z$\037\265\317\377|\210\244\026\224G\221x\331\nK"
+	.string	"\346\363 \222\220\035ysJ\035\240\224\236\022\036\006\026\366\002\207\027\006\272\0136\324e]\330\275\327\310\274&q(\253\222\034K;\300\257\r\257.\353\304\272\360,i*k\023\r\317\363\255\306\255\377\254X\200\250{\237\214v^\303\253[\222_:O\374\235\357\244\023(\235\357\201\222\022M>s\236y}\322TV(\256G\325G\374\234\357d\235{\371\022v[\243p\2337\025\267\251\235\022\377\335\350\302\264\306\352r\276\213w\222~lC\027\257\322\215q\023/\342\203t\232\026\361o\004\256,\032}SG\004\363\026|X \246\2137.\331\376\272\335\215r8|\022L$\\\314\341\237X\256\271i#\337\023\241\360\033\272eDK\205\360\205\320\002E\036N8\2125n\364p\242\001\202u4}\240\243iG\321\211G\261F\223\317\r\246\017p4\335\340\221\303Im\352\016\230\232t\360\330\241~\300\303k4\335\260\301\364"
+	.ascii	"\017\032M8p8\321\320a\032\005\324`\n\241\006\022\016\033L\035"
+	.ascii	" i`\343\306\017;\345h\322\201\304\303\311I\007\022\321\354\251"
+	.ascii	"\237\313\372\021q>=\024\3770{\216\370.\316!V6\305ED\213W\241"
+	.ascii	"/\344\240x#\243\017\022\342\207\364\023\023\274\367^\243w\342"
+	.ascii	"\003\210\331\342\215Yv\\\"\214}Pg\324#Y\013\nl\204\024\025\275"
+	.ascii	"\020\231G\346\314\314/)z\245,:1\262\026#C\025\267b\361\037\231"
+	.ascii	"'\006\332D_|\177%D\257\2245\007u,[DG\264>\030\206\230\206\236"
+	.ascii	"\271\364H\322\230Bd\360Ci\274\"y\256?\222\301w\332\033a\016\275"
+	.ascii	"R\226\0271\2666\366\225\201\210\341$V8j\031\301\334b\223L\001"
+	.ascii	"t\312\345\350\006\346\354f\333\276(Eol^\020\232\001\300\023\274"
+	.ascii	")A\237\265\364O\360~\2516\003)\331UBP\253u\177\261\020\306OL"
+	.ascii	"\035\243q"
+	.ascii	"\301)\371\320=\347\002\356\250\306\276\035\341\226N\251'r\374"
+	.ascii	"\362\243wo\262\251\216r6\311\"\200#]\303\035\355v\206G\322\310"
+	.ascii	"P\235\020&\215\230\206;\246y\022"
+	.string	"\362\270\217eT\346#\231\206;\226A\222\241\341\370\f'\t\257\236\030\216\3378\251\351\332h\354\252\307\263\312\233n<>\236\351<~sf\272\366%+\002G\321,\247\222\350\306{\251c\032n*~\250\217:\372\361\230\316;\252\321a\362\031\025\357\270\346\b\315\353\t\240\\\3503\371\310#\233>\"\030<\363\321\215G\331\255\351:UfY\201\"\243\326\367C\306\303x\f\264\240\222K4E\300\260y\322v\231\027\210F\301\\\3602\276\223_1\376\202\017nq\256Mb<\210$K\017\343=/\371\264s\256P\226\376\251\354\375i\215\2211\340H\335a\332i\267\"W(g\013\321\240\230A\237R\217\344\022\275\206\337\254\217\216e\024\360O\370\345\017\210\207\0361\264p\007\230\026>\253\274\005\201\361\250q4\347\020ShFDD\222$\2054\006\201\005\204 \306\230\253\365\021\3400\346\030C$BR\222dc\016@"
+	.string	"\020Ui\201+\024\"%P)\236\225\350\271\213\327\003L"
+	.string	"8\370kn\320\374\233j\220\306\203!\333"
+	.string	"ZqD\207\273\n\3543\360q;\364\r\266\342\243\244\005\304{<1=\262\316\3607\235\b\361\035\322]Sk\206\320\261\201;DneB\0019\303!\277\213\270\374\224\213\177\264\326\217w>%b%\210L\271$N?\331y\335\t\214\r\0243\377\327\256\034\b1\246'j"
+	.ascii	"\021(A@$\242'\331\315\f\213Al\357\034V,\030\237H\311\264\330"
+	.ascii	"\276\362\215\314RQ\304\274\266!\323IH\354\234}\\%\254\261\373"
+	.ascii	"x)aqQ\237\245T\275`\314\270\234\262\035f\2165\255\270\032B\355"
+	.ascii	"\374\3349f\2622\3268|\216+J\344T\222\006(=\341d\324@\204\275"
+	.ascii	"\333.\341\350\263\261\203%.\241\205#K\\t'u\354\242\325\304Y\230"
+	.ascii	"\254\271\350\022(\356\346U\225\244\264_ym\374^\022\004\226\337"
+	.ascii	"\322\331\025]4F\247"
+	.string	"\026\f\037\355\322\212P'\262\377EA)\203\003<L\n\243\263.\031\254B\206\240\3010\234\"V\205\2213P\214\001~\201\352\312\004\t\332ne\204d\202\363\272Z\016\331\316\032\023\362\033b\362eJhR\337\374\263\340\304\262T\233@\300\343\006\353Q\355\036\251g\221\246\020\225/SB\343\306LV\224\020q\253\363k\035]\fx\322\236\350;lUh\207\257\212c];\004\353\270\334\235\0174\\:\207\006\004Z{\r\251\274\263\252\301e@X*\004dI\n\212\370\347\245\266\271@\205q{\035\322S5\374\250\2409\033\340\361\006!v\341\306\231\211^BCR\221\247\006i\036\321\b\231~srT\247\347G\024\007K~\324\021\230\234\363\346g\234\367H7\350\376\345\371\357\341\262_\0310=\034X\020\240\371\327!\201\372\237\\\002\026\032c0\\\264\327\360~\022\344v\370\272\016\211\307E\013tS{\377\"HF"
+	.string	"\353\342\f\226\304\351E\233\375j!#)\353\274<[--U\341<\2209]1\330Y\321\177\f\036\242\245\305\260\t\325\213w#\341\360D\032\350V\363\333\037M\272m\270C\265?#\234\202\277\201\364\215\017f\346\177*K\266@\314_\335.\231m\310\250\017\177\262\255-\260j \334\n\346af\262\261#\214\275cE\315\333}n93\301\371\035u\0015\274\314P\262\022gA(\225\203\025Q\322W\246H\204\213\026R\201\207\340\2534\024\301\357h\030.\220\245\3328\016\005'\003{ZwlI\006\372\237O)o\213w\351\233ZS\313Ut\336\271\036AL(\247\2377\177k-C\201B"
+	.string	"\031\016`\345\263\265q\302\332\337\264d\030oL\333S=\245\317v\016/\323\023G\246 3\023\341/,\310M\005N*r\251jXP\032BaF\220\355(!\021<\363u\037NE\276\352|q\nF\360>+o*2\235\374MU\303\337\004\245X\250\242\352\370\fA=?@\307\243\377\355\222\317\336\311\214r\\`N\003F\365\241-\346>\201\3465\372+\302w"
+	.ascii	"\240H\027\346\207px\312\030r\007\302~\030R\234\372k\025\200\004"
+	.ascii	",u`\304\331j\244\224\351\024b\200\025\004\230d\261\364<87;\017"
+	.ascii	"qe\273X\340\n\003\352\244,\027\342\276\303\330P\346\221\336\371"
+	.ascii	"n\240\333\215\200+\204N\344M\367\002\216\023\371\361L\313\b\232"
+	.ascii	"<\f\021\301a%X\341\375\001"
+	.text
+	.section	.gnu.lto_dyad_init.58.692777edcab37674,"e",@progbits
+	.string	"(\265/\375 \335-\006"
+	.string	"\264\n\213"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\314\271\030\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\365\362\001\274\370\315#\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\205\360\371\320\233\307\001"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\006\325"
+	.string	"\001\r\006y\001\001\002\004"
+	.string	"\203\003\202\360\371\360\233G\244\003\001\200\300\013/root/repo"
+	.string	"\025lib/main/dyad/dyad.c"
+	.string	"\t"
+	.ascii	"3\003\326:#d\270\3055\321-\004\3742\004\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_dyad_shutdown.59.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`X\003\255\027"
+	.string	"f\252\225I\260\324Uc\364\017p\223=\0022\002z\246\256!\305\340\020\315\366\356"
+	.string	"\256%)\267R60;\214?\354Te0\"\037\312\242\302\203^?\322k\216\226\370\376\330\353\357G\334\337\271B\237\027'\023\230\030\350o\367\336{K\231R\202"
+	.string	"{"
+	.string	"\177"
+	.string	"~\335\254/\3334\233\310\205\276["
+	.ascii	")\b\017S\222{o\314\262\260/\205w\352\323\322\336JQ\327i\226\266"
+	.ascii	"\322\374\222\007U\004\227\323y\2534\361\361\203\242|\260\304"
+	.ascii	"SS\" \241\243\257\t\335U\242;>F\367\361\223\242\\I\"\247\376"
+	.ascii	"\263\325\323\025#\350\346\211\227\345\202\335\016\023\001r\267"
+	.ascii	"\362\344\2127\344\305\327\236\334N\265\377\235\002\357\351\210"
+	.ascii	"\313\005\275\242\022\356\275\256\270\034\320\375\272m*\333\n"
+	.ascii	"l\213!\273`R\255fYb\325N\316\332\236-\264\325\025_\022i\273\302"
+	.ascii	"n\235\325\351\2077jV\237eu-\253o\"\340\210\204\250\342OU\367"
+	.ascii	"\372d-\271V\346\024\214\017\177\373\276\323\2137\007\372G\031"
+	.ascii	";\335\215\035|S\316\231|\201x\032\037\372KJ4\234\003\r\341\370"
+	.ascii	"c"
+	.string	"\007\274\367\342\370J~\322g\340\\hcy\235nit\204\005\204\335t\202\364f\312O\316\233\345\007\2347\355\034\007\306\343\340\320AV\217\223\2357S\373\245\327\027:\340.8u_\022\031\205\332\236\357\252\361j'\004\271\325$U\265\021tG\220\312{\357=o\355\226\224\233\325\261\017\365(\033\277\310/0\3658\230\363\346\355\177\257R\307\243]P\310|\325j\375\342\007\231z\234K\253S\213z\fiQ\332\236a?\255\201!\220[M\372E\317~\303\306\364\336\253\342\333 !\302/\2629o\236\366\305#\220:\342\0131w\213\003\027\331\215K,D\214L&\346!\006\304\211g3/4\261\021\263\031M\354%\254\375\367\2248\024\245\004Y\2636\303\376\241-\374\312\306ju@\207\325\262=\267ph\313Z\027.\330Q\333\323\340\250=\321\360W<!\302\224\301Q\333\262\3779BRbg\253Y\366kN\0365"
+	.ascii	"v\260X\035C:\253\035\320\bJM\255\337\224A\303\233^\001\311J\t"
+	.ascii	"\362C{\3469jP\260\356\275+\037z\303\253X\b\370\356\275*\001H"
+	.ascii	"\250\221(\342\220R\210\024\221\tkJ\323b\220\002!\252\262\003"
+	.ascii	"\021\240\311\232\"JZ;\302\323\230\325\213A4\357\244\376D\324"
+	.ascii	"\215\022\270\036\350\323\317\274\024\f=\371\023\355\253q\020"
+	.ascii	"i\251\262\221\001\361\n<B\020\373H-T\277\220\003f\357v\037\361"
+	.ascii	"\227\340\262\224F\226\266\305c\213\033\311\030\035\220\330?\022"
+	.ascii	"qp\001\357\215\305V\303cNiJ(f\263d7\362\313\317\343\345\375\276"
+	.ascii	"o\r\331\300\250\357\3502R\313\323\r}8h\210\020\023\375\261\226"
+	.ascii	"\231\2334\b\342\375\322\354\365&f\375\001"
+	.text
+	.section	.gnu.lto_dyad_getVersion.60.692777edcab37674,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"R\213+2PM\324\001$\243\252\332\b\003\230\250\314A\321\""
+	.string	"\270\032E\331\250\324Z\031t\243\031\354\035L\030TE\030i`\024\007\025y*q\336\231\277\333\356\235R6\210\016\242\202\306\f\321$]\323\204\240\244\207\271@9@\256\"\032\254)QU\326|\352\036\344rv\271\323\t\207\013\030\270\004\330\"\205]5\0307\3543\0335l\310|\364(&\273\027+*{\"I:lc\366\343\177\367\300\234\305\256b\313@\370:\013\221\224\335:]\0175\227\316/\315e\344xv\230\371\377\270BH\311\b\365\264CK\302\356\032R\017\343\216\267-`\233\300v\027\n"
+	.ascii	"\242\310\220\031\032\030\241\032`\021Bs\r\207\215\030[\210\\"
+	.ascii	"\334\025S;\311"
+	.text
+	.section	.gnu.lto_dyad_getTime.61.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\275\013"
+	.string	"\246\326P?\020Q\225\016\360\270\274\353*En\242C\254I\200\214 \224\265~\005\243o\207\314\340\347i\344C\245EXs\362?\214"
+	.string	"\331n!\002"
+	.string	"E"
+	.string	"\t\027\200n\316\355\004\300k5\216\rm\"eJ\001>"
+	.string	";"
+	.string	"@"
+	.string	"\273\241\300\243\007`\217\337\211\217\372\211\315^\351\205PhUAa\260\240\002\307\356f\366N\201<b\007"
+	.string	"y\324\020\337\236\233\377\357\t8\030\255n\364yF\020\354\256\263\033q\270\365&`\177\023\251 \354_\253&[\323\230\246\243\246\257L\253\2463\323\367x\206\017\0316>N\177\321\332\325\020\356\330\030\321\005\211{\277}\333\233\377Y\222z\212\355\236g\2623\366\035D\240H\340\006\002.\215zQ\t.C\253^z\261\310\374k\240\032`D\352\232\2324D\240\255\371\247a\273{\340\252_\215\033%\024)P\206\216d\366\253\376A\300:;\302\204|\347\2570\341\345"
+	.string	"C\372\261\275O\022:\351\005\0060\027\n\230l\223\271h2\005\031\007\024k\017\030p\262\216\246q2\211\267\277VM\230V@\312\331s\355~\260\334\373AU\206\216\232\212\225\270\325E\244\226\007\226\216S\213\265-a\310\252\260\013\n\023"
+	.string	"\242\310\220\211\027\372h#l\340(D{T\201"
+	.ascii	"\312C\235~1\256\035{\250\3176\327p\3203\3418\325dp\322T\003\306"
+	.ascii	"I\221\346\305\017\016\016"
+	.text
+	.section	.gnu.lto_dyad_getStreamCount.62.692777edcab37674,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\322\214.4Pm\222\016$\241*^\221\253#\007\025\351x\0273h\3749\016j\334\374\216\2657T\365\311\036\037DG\246\252\352\242\252\212"
+	.string	"\247i.\352\200\243\265F\266L\001+\030T\224\246z\025\245\251\236\003\206jx\t\030\006\313\326\303B\346AXV\346U\266\254\353\240\273p\234\304\367\243\333\240\3539\342\017\026\253t\377L\225\320\005Xp0\364\333\006\035\3067J\327\371\342\350\"\315S\223\224L\212\020J\226H\"\034\377\365\225\253\265\343zP\264id\003\332\306D\310If\276K-S\245\250\002S%\227\321\253x\335z\024\001d\204\004\3136E\200\203\314\034\261\254\242\273\376\005?\301\177\021\b"
+	.ascii	"2\003\346:\203j\b\3055\2217\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_dyad_setTickInterval.63.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\205\007"
+	.string	"\002\01755P\215\322\001$\251\203\202i^0\262\223Y\233\360X\036\332\302+\263r\013)\224\366\017R\343'9\177Vyg;3E\254"
+	.string	"a+\212\035\265\007\222O6\3312\245\037\255\263i6\037K5\bZ\006B\313:\234LC\266\300a\300ts\330x\262\207m\363d\027\357\266\016G\305RPT!(\321\2045\312\037M\325\033\215\350\227\356\034\353~\227\243\302\005I\311\"\224\253\326\003%\304hm\375\177\341\250\365\311N\3132\225lR\362S\254V\256\212\"\244K[gk\016wp>5\345\200\177$\344\373\177\320\002\314\261\2361\227#f\201\313\261\\{bO\343\003&\322\004\210\312\377\ff\230sr\265=\f\320\211@NK\302\377f'\252p\241\333\022\2645h\213\n\t"
+	.ascii	"\242\310\220\211W|\321\002\027\266\301\220K\260\326j\n\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_dyad_setUpdateTimeout.64.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\205\007"
+	.string	"\002\01755`\215\032\003(\017\023\222\321M\210\323\277\017o\354\326\3312=\002\2339M\235 $\036\347\023~\334C;\033R\0243\004\2510\224c\353H\261\335{\313-eJ\001\236\214\243e4\236\253\231\203\f\363\220M\316\006\3030\0256\013\227j\r\232\316t\320\264\316\264xw\365(*V\222r\002\305\210\302X\227\354QS\255Q\210~\320\234e\335\317\262L\260\0309\251"
+	.string	"\301T\353}`\274h]\375\177\243\250ug\303\252\032uF\241\376\211\024\312O2d\303\322\326\2605\311\034\233\273\232\f\360\213\200|\377\rJ\200Y\326\363\305\262\304\034`YvkI\354e\\`D\222\3700\371?#\2067\303\255v\207+\\\350cx!\374/\344B\024nt\333\201\266\005mK\001\t"
+	.ascii	"\242\310\220\211W|\321\002\027\266\301\220K\260\326j\n\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_dyad_atPanic.65.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"e\t"
+	.string	"\346QA9 \261\322\001\244\017mP\341[\024\f\334\313ru\317\342\001!\214jA\021*\301\233\350\377\355_\341\341\301\350m4\323\240 \025\004\004A\230\341E\200~RP`\335M\356\224\0020"
+	.string	"/"
+	.string	"/"
+	.string	"-\020\005\031\013\206J\315\356\364<\037\352<z.\320yT\221\313C\351\237v\206\032\016\306\365b\035\002,\354\256\241\353\265q\353m\023\330>\260\377\t\321\205\344\363\267W>\315\037\333S\006\354\313\376e\"k\231\331\235\006\217.\200\237\311\203vc1\267\335\211\340\001\317\243m_v\224\225\245f\\\004\037qJ\005\357z\364U\235G\250\0160\335\tG\013\356\354\311\202\032b\237\263\273k\215\331\237\375\372y\303\b\222)\261}\034g\333\325\330\335l.$\323\247\243SE\004\307\243\004\222(E\362N%\221\204\367P2\205\374M@\240<\212\357Cy\237\271\347\254\306\240\376F\323\221k\251\205UW\032`:\033\217\327\236\"\035\r"
+	.ascii	"\242\310\220\211\367@\321Z^<\bXO~,\252\221q\341\346\030+\035"
+	.ascii	"E\256PY\206\237iL\355$\003"
+	.text
+	.section	.gnu.lto_dyad_newStream.66.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\221\002\235\024"
+	.string	"6&\207J\260\022R:\240\302\021\3334\316Kt\207R\323\032\205MW\225\217ZW\363\022x\230N\323\344\306\364 \025\367X\273Vg\375\352d\250\212\375\351\345_\250\312\252sc\234\341+ds\022\314\206;\201\0274\271\361\265E\233\020\271S\no"
+	.string	"k"
+	.string	"y"
+	.string	"3\237\310\256\217B\037\232\335w#V\236\262\226"
+	.ascii	"\340cZ\342a\325:\202\245\365\361\365u\033\307\017\262\353=\332"
+	.ascii	"\253J\325\357\364\354\240\204\265\226,\037\035\240\365\321\337"
+	.ascii	"\235\207c\332\206\320\251\371\034\330"
+	.string	"=\201(\302\252\265$]>\205~l\035\205~\334\024\247}\322\374\007=\201/\212\007n'\347\023\004A\255\325\023\267C\342\336\333\026`\233\200\275\005\0024\030\346q>p\027\314\022\3366\307!\323\302[\211\222\267c\034\346qtU\200\273\243,\241\316\346\330\245m.\n\373b\335\037\233N\237\320i\023:\375\032\247K\3504\3118=\362\336M\305\351\025\247\237\262\022\205\305\353\001\264{\332\251\262\212\030\376\250\301\261\306\212\377\376\336\247}\277\350?\037h\027\021\316\354\245A|\250~t\274Zkb\255'\\\204Csh\223%\331\023\235\221~3A\325\323\344\203\305Q\265]\206\303\246\017\265\326V^k\262\277\265\260\315\241K\366\265\242\221\203\003\037\224\254\212\212\336\310\222\354\304q\023\376\347\b\007N\030\331\025\322a\245\213\321C\231\344/\343@\n\277\n\026\036\002tQ\266\334\206\235FL\253\326j\3007\222\315\210\344"
+	.string	"\372\350\323\350G\b9\253\027V\2659\264\210\023e9];\036lf\rlFf\323\201:\246E\0066\223!5\320\300j\310\0134\031R\034\3330##mb1\031\351*k\027\353\376\3306\335\037\361\200\n\326\326\346]\251\001\237\273\373\233\316v\343A+)p\222\223\350\307\271\022rWt\241`rW0x\326^p'\032\256\252\366\2453\321| 3x\231\307\275,LnG\026\317\311\332\rn\303H\017\272(\314Y\371\246fT\335\0041 @\002b\314q\362bd\210\342\005\334\260\004\242r0[\310|\272d\007YF\343\006\r\330\357\374\274\333\215DC;V\002\271\367C[\034^\317u\3721\243\214\t\224\020\027\305\241X\231\364\351\263qfF\260\217\344\336\271\300r\r'\326P\016\253\270\b\030\366n\317D\347\220 lh"
+	.ascii	"B\270\256\376\372\373r\340\247\355E}\367\262\035\314\203\243"
+	.ascii	"\224h\323\025\310"
+	.text
+	.section	.gnu.lto_dyad_addListener.67.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\351\003%\031"
+	.string	"\346\354\233H\300\030Q:\020\350\243I"
+	.string	"\215,C\004\270\240\3112\2044\366\030(\n\330?\311AHy\261\300\031\270f\253i<\306\316\262\250\003I\253f\r\362\276\025A\020\004\314\310(3K\337\274`i\340`\332\331\366\t!\233\310\235R\204"
+	.string	"~"
+	.string	"\214"
+	.string	"G\325\232{\022\304\301\334\335\306\3547\\\232Tk\n\032Aj\255\r\274@<E\360}\332\247\361\032\263\363x\200\251'Q\314\310B\245\326]\003'\020O\275;\001\360T\374"
+	.string	"\360\3243[\312w\272\232\232q\204\203\303\250\326\272\332\025\237=\004\351\267s\346\207\020t\234t#m\036\2228\250sZ\"u\376}0\221\265\271\002H\234\017A\255\365>\237!H\332\234!\204Z\253\347\215\024q\213\267\255\301\366\003\373S\005\377\341R\364\205\377\300\036e\250\326\312\362\341\302\360$C-<\200\247\337\253\030\002r\323\271\231={G\233\273c\377\253\2333jN\237\346\264\313y\376"
+	.string	"\317\361\0038\3577\375\306_\022\247E\322tH\232\006\3474\235\323\2378\275\341\364\004\247_\3409)\216\274\270\022\241ZszZj\020\035\342\302\366}\036\367\241\371\016\227p<\243S\233\3066\235\336d\373\313a\242\324\251\326z@\274,\257&\260\375\321\365t\337\356\017\013\236$1\021\tlN\231Nv\257\343\037P\225\242\034\256\006O8Sw\t~\347\372>\026\306\371\233\301\265\001Q\373\233\025\006?-j\017"
+	.string	"\331\264\320(\203S\262\310\250\350\337\356x\301O\233\312Q\321\363\2446\217f\255\325fw\307\247u\331\002=Jj\363\310\276\021\336i'Q\210\322\345\322o\341\335]\004<u\331\373\\\301\213)=B=L\020\331`@\327\372\220\230\020\230*\301\334\305q .2o\366+\243lt\321P\f\255\021&&fl\2112\231W\207\027\3150\276fd\034@\267T\256\261\306\265\222\201\215\031V0\260\030\002\216ix\315\254d\261\330\314\312\264\273\371\367\315\211G#\202n\226f"
+	.ascii	"kGx\024\023\261p<\031\246\265%\034J\r\353D\317H\300\021\034\017"
+	.ascii	"Ki\355\t\037r\311:\321\223q!\031\n\363J\f<]#,J\204\273+\356m"
+	.ascii	"1R7\020\bn\270*\"\033\214o\301})q\266\320m\302\344[\272/\245"
+	.ascii	"\rG\253\360%.\203\002N\250A(\345\030D\002S\301\020\005\005I\013"
+	.ascii	"-\006`\002\021BG\017\021`5s\350fTgg\016Bsp]\374\035\017\261+"
+	.ascii	"4\3761\345J\364\371$\330\240L\031\020\332R\n&\212\302u\217\301"
+	.ascii	"\033!G\342d-\0242nj\rysV\215\243T7}\256\007]\324k\263\024\205"
+	.ascii	"\222\356\004`\371\214\322\247\241L\300\220@\3018\3260\251\"\237"
+	.ascii	"j\302\311`\266\300\300\340N\342YQ\225f\263\t\316\215$\331,(\321"
+	.ascii	"\266-\203I\215\314\227\n\271!H\375`\n\340\024\301CE\275[|\253"
+	.ascii	"\231w&\327\377\307\246ej.\fLTI\352\231*\250\355Pj"
+	.text
+	.section	.gnu.lto_dyad_removeListener.68.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\336\004e "
+	.string	"6=\322I\220VN:\232\343M>xC\375\203\370\316\355#\0262<Y5A\302\300;b\330\243\325\312&w<Xf\210u\177\242\230\205\221\003\255k\214\253\002"
+	.string	""
+	.string	""
+	.string	"\200\233\001\031\002\237\266\274\347\272}\305\035Y\355\326\244\021B\244L2\302"
+	.string	"\260"
+	.string	"\303"
+	.string	"F\034\260\361^L\007\262\307\325\325\232\345\303H\255\265\301\362\2407\r\224\347\335\373x\221\351]&\200\352\203/\212*\336j56\330\004\350\3155\336w\336DOs\336\\\246]\267\033\267\352M1E\224\220.\265V\237\216\261\271d2\231|i\374\356\230\351\272\035z\232e3\323\036A[R*\330t]\231\203\242\252\361\265*\254\362\007\356\355\354b@\336\235V\302\243\007\262\254\256~\226\020\254\004y+\334\244\360\202)\233%\003)9\2044XcRxA(.\313\005\3034\026_\253\272*}P`X9\331y*\370\304}\261\243Q\212XY\262\254\204\347\034\205Z\353\262T\320\352\313\373\356z\355\256\205\335\262,\0353\034\343\321\345\304\311]#\220\233\270\373\237-\270\267m\255\335\035\357\216\216W\207ysr\2748\314{\303\2746\314[\303\274\276\017\371i\036\344\017p \377\314\307\2762\275\230w\375"
+	.ascii	"\036\306\253c^\364a\337\\\311{\242\274&\363\2269\336\316\361"
+	.ascii	"\362\311\373\002\247\212\021\207\343\310d\255T\311\270\252f\236"
+	.ascii	"\331\370\330\037\366}\221\233\355\362V\351e\373`X\266\243\326"
+	.ascii	"z\"{\262\345\355\030\222L]\253\257\212+\n+(\355\362n\376b\313"
+	.ascii	"\333\335\260=\242MUhZ\361\352\255\326\312ss)"
+	.string	"\354\226C\366\312\215L}\372:!\241\203,}\246V\255\266\375\026.\270\244\\\300\306\351\323\005\226\2500N\307\323\246o\272\274\222r\365\274\246m\272\331\322\241\257k\232\331\322\033\300\253\t\355q?c\215_$\347M_\337\354\b\274\222_S\212\bQ\024qa'M\237\335=2\334\311^9{\202\f\356)\322\250b6q\003\264\331w\323\360\264%\263\013\264\375B.W\310r\246\313\006\372j{b\270\335\335p&{D\277\204C\007\024\251!\f\311\274t\277e\372`R\0357\337&'w\367S. '\267\327\334\3461*\314\376\236\004I\001\3628`\353}\262\233\302!Y\203)\201\nv\0237\350h{$\260\265;\3643\017h\2555\302\021!\"\001\310\031&\316\2331\001%N\364_\322OH\311\004\021\364\003**\372\005\241I\"\206H\f\231!~CGIH\347\006\365\b\375\226\204|D\020\375B\370"
+	.ascii	"\021\025\371\326h\304\320\221O\222\221\321\221\017\317\350\364"
+	.ascii	"\326Z"
+	.string	"\024\356\207\232S\003uM\334\213\235\007\206\246\202czK4\327\273\236\342\371\256?|Q\351\371\256{\375t\b|Yk\255\273&.\233\275\346\263\327\\\366\372b\177\n0\264a\367:\327S\273G\233\270\273\272FN\271\224\026'\264u\375sL\207@N\262\355\021\215\342\201\343\220\354\206D\313'\301-o\303bW\r\343\364N\313\364\336\354\002\006\276\324\036\354\213Z\332M\253\323\357\235f\262TGN\353\364\017\345\273\316\tX\25010c\2243\f)5\321D3\"Q\007\200\002!\252*\036\020`GC\223\302t\302\244\320\272k\333UAO<<^\275\356/GR\223\302\302\221!\224@\222`Z\221g\220\271\301\352\276 \312\221\330\333U`\007K-Z@:\020\232A\312\b\212Cd\022\001j\337\022\024\235\007\221\240#\200(\002f\310-Mi\353\034^\375p\021g\025efJ r\224\271\232\230\311\342]"
+	.ascii	"}\337Gs\240\030H\032\346P\023\336\025ez\220\024\036d\243\227"
+	.ascii	"(d\366\361\016\374\252H\210\327!\335\343\006AC\013t\256\3747"
+	.ascii	"\313\300\232\266i\311\371_\210\204-\336\235s\322\332\355\273"
+	.ascii	"=>\246\0056\351\005\273\037"
+	.text
+	.section	.gnu.lto_dyad_removeAllListeners.69.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\355\013"
+	.string	"\246\025O?\020O5\035@Yu)\247\023\200\031\347\264\235sb\314@\\"
+	.string	"\240\233\233\205\320\363\223Am\201\030\372/O&\236\021\r#\206\007\200$"
+	.string	"\244\220\225D%\345\333]\020\265\216\031\223\245M\344N)<"
+	.string	"9"
+	.string	"A"
+	.string	"\037\303- ~\270\260z\261\273\233z\370\344\367\211\251\374|G\3451\002?\237\032\351\030"
+	.string	"\220t\r"
+	.string	"\2120\311\356^u\211\001\fI\351\250\354\256\345\b\324pg\267\335\300v\002\373\f\0021\2665O\234l\037b[\216\037\361=\345\f?v;\264`\355.\305\023\355S\202]\332\027q\361;\312\363\001\273\245\024\254\335\221\342\003\332\247\307G\262O\355\004\262O\1776\213\236p\022\025\f\204\273\253`e\241# \004\341\311>\277\201\003\212\020.@rcA\370\322P5y\362+\347:\251V\210\344\313\036CRM\032&\\-k\311>\352\327\247\376;0Q\274\n\327n\206\215\234LG\241\233\030\256\323p6\231\037 \260p\035\313\226\271p\230\315\301\005B\304^\204N\263q<O\263AF\320\265d\355\005\243\005\322\320|\310\253\252\355I\220\037y\352\007S\223\275y\tgh\016\031"
+	.ascii	"\242\310\230\031\032\317\344\301\007K\330\336k\264\265\204\216"
+	.ascii	"&4\177\331\024\263\332A\313n\336\372@\211\211\013\313e\006\230"
+	.ascii	"\2062\206y\201\300\340\21245E\270K\300\200MM\036\352\364\326"
+	.ascii	"\2262"
+	.text
+	.section	.gnu.lto_dyad_close.70.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"m\n"
+	.string	"\366\323G= \345*\035\3408\222\342+\026\343\213\336W\240\360\321#`\255\032\276s^P"
+	.string	"D%`\2463-\302V\nt\353f%t+\0200\352L\002dd=\nV\005\004|\310\254%{\357\235R6"
+	.string	"5"
+	.string	"5"
+	.string	"\262\224\n\224"
+	.string	"\273\353\315\216\177\257t\312\317\027\bW\257\335\251\306'\365\274\\2\006\302\026\355j\0343\237]Z\204\240\224\232\317\356Z\272B\214\233\273m\006\333\036\373\235\342?\245\3649*\213\371\213m\367\3426`i\225%\204c\373\322>\311e\337E\325\tva\242\312\356\230\340\203\315\253\307w\334\353\346\035\356\325\237\r\340\243\307\026\004\256\027mN\230\021\376ip\"\323\222\002lO\334\304-\013~\tEj\263\273\377x\365U\334\353\347g\247#/\030\021\221%o\366\b\312\031\263Oww=a\366\003$\220\310\204:qvP\b\201R!\017b\004\"y\r\243\207\316\245\b\221\311C\225J&\2173\262N\367\303\232\340\2535rN\373$!\3572\235+\313\025[m\203\316\330=\202?H\021"
+	.ascii	"\242\310\220\211w1\314\300\b\004\016\n\305\346!@\230q\343\302"
+	.ascii	"\272%\020\201Q\227\260\232\325\350q\227[\332kJ\270)\205\332\003"
+	.text
+	.section	.gnu.lto_dyad_end.71.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\325\t"
+	.string	"\246\222C90\257\322\001\204m\316\220*\276\202\207\333\005Z\223\305\264'h\320\341\364\342\005\032\377\355\333\307\nJ\354l\220\253\203\374\205\201\001\270\020\016j\221\006\017\024\020U\021D\310\3362\2452"
+	.string	"3"
+	.string	"0"
+	.string	"\024#2\273\013J\215\207\237RC\037@T}~\257\313\331\201\241\274\002D\326\344\3342\\n\273V\210-U\215gw\255.\361\342\356n{\301v\307\276\027\367&\rw\225\225]\213\334\314\246t&\035\033\333W\373\263\323\302\327R\027\330\215\315HvG\004\033|\357<\236\343\275\373>\340\275sh\277|\334X\002ZK\",-\305\331\226x\210O\024|\220\t\324\267\273\347x\347\247\274w\227\267}~\300b<j+\315\331#K\245\314\376\334\335\265\214\331\257\375R\325\001\243O\250t2ynH"
+	.string	"}P \360A\364\031\201\f\"\007\216I\020\241\022x\"\221J\340f\\\335\263\222\254\251Q)mS\204\336\345)UZ\002s\303\220R\346\203_\026\004\020"
+	.ascii	"\242\310\220\031\032\2148L\200\253\201\330\260\227\320V\233 "
+	.ascii	"1.\254[\002\021\030u\t\253Y\215\026w\271\245=\032\230\332\003"
+	.text
+	.section	.gnu.lto_dyad_listenEx.72.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\\\nu9"
+	.ascii	"zc\024\026@@\246U\007=\227Uby\303\253\035\270\302pk0j\347>\343"
+	.ascii	"UQ\357\315\326\221\027eb\203(\316\337\225\320\253@\375\270w?"
+	.ascii	"\321\206\374\006\274\f\364\352N\233\375\357\340\245,\0337\331"
+	.ascii	"{K\231RI\001:\001Z\001\323\275cX\260s\364\002\002\302J\243\330"
+	.ascii	"\275\247.\330\234\232M\354\253(*~\315\251\277\275\366#\271\236"
+	.ascii	"%1\001\313\3719\361O\177\374^n\270z\306\274\356M\002~\267\335"
+	.ascii	"O\340\215\363h\361\247\005i\267S\272\225:5X<Q\354\316\352zz\327"
+	.ascii	"E\300\357j\351\206_z\313>\3767\256\b\336{J\316\032\215\360\256"
+	.ascii	"w\200\333`3\350\374k\234\352\273\275\303\370L\367\336\024\334"
+	.ascii	"BNS\344\225\366\306\2226}\372\354\376f\177\026\277\364\210\324"
+	.ascii	"\376&\330\231I\327\275\245\024\274\001\374\256Kaw\3677\363\321"
+	.ascii	"\330\235\332J\241\315\001g\344\266\330`\367\336P\301'\360\276"
+	.ascii	"\333\376\322\373\256\316\362\361\003\177\276\036o\007\353^\267"
+	.ascii	"\3259\366\3475\225\017\314_\377[\020\346e\345}-\023 >a\376O\227"
+	.ascii	"\225\226A\225+h\377\245\253J\356\3518sc\024\346\365\365<\035"
+	.ascii	"7\215\226\355\246|\351\222\222a8\253\356\377t9{\315\255\374\366"
+	.ascii	"8\333\302\310m=\260\005\362\003l.\333\337B\345"
+	.string	"\331kj\345\366\305\262\327h6\314\213\312\353\366\203\226AV`3\253\205!\305\371m\237\2254\261r\326\201\330{{f6\275\336\001\274\273\037r\367\250\373\216,n\336\360d\257XZ\351\222\301\221j=\346O\337\244\205qoj\feeI\256 \277\333\3379\341\263\266\035\033@\231\230\264;\212\024\371\231M\372\337L\032S\335\322J?\220\023\350w\373B,\006@\367^>\323\005\274\254\341D\007\306\317\352.c\306\033X\366\272\324J\032W\342\002Mxw\033\337\346T\037t\357\035\345\322\211\253\006\310\023\336\333\336\247\367\377#\364\352\373\231\362\347\362\356\273}\333\361\007ez\242w\230#?\323\337\r\243j\366\272\324J\367?\276m\357\344%\016\354+\352\350*\317\271K\261\276\335z\314\375\333\255\261\270K\3706\377\020\234\030\274\364?\370l\357M\237\346\237\351\327\374'\320\331\227\336\354\002\336\354J:{\200]v"
+	.string	":;Pg\377\355\262\373t\366^/;\217\227}\367f\207uv\235\316\376\352\354\256\316\336\276\331\265\316\236w\331?D~:\302\"\224vfN\023\222n\256\271\270]u\327\272|\332\377\364\177\355\237\355\337\316\277\236w#\324\353\025\203\233F\261[\271\237t\356\357\017\347\325\236\316\327y\352\337\3716\357\341\371<\361\353\361\021T*\355}\265%[bxsN\002@\211\261\264\340\345s\335\b"
+	.string	"@k\330\312:\227\244\311\263\223\240\205\223\3048d\b\032\230$V\222\237)A\007\265\272\f"
+	.ascii	"\365\205g\237\254\231!Hq\270`I?\375n\231I\274\204\013^\n\301"
+	.ascii	"\361\363\351\250\255Ho\\'^\b\351\234\264Pn\221\206\274\3535\211"
+	.ascii	"\237\344g:\351\3402#\211\311|=\2753\343E\371=\261\024\217z5f"
+	.ascii	"\243\253<G%k\021a\230\247\033\220Y\311X\361\225\242\217\n;\355"
+	.ascii	"+\004\353/\363\334S\346\264\220\333\217\257\274\357\366u\234"
+	.ascii	"M\373\221\253~E\363;\365\235\360:\261x,?\323\333\355\314\362"
+	.ascii	"r1\331[\343b\263xK\001\350\221\367]\235~\237w\262f\277\366\030"
+	.ascii	"\236w\3108\2722\341 \275\310\347\241\225Is\031h\241\\\227\b\271"
+	.ascii	"\325\256~u\227\330K~&\003\035\334\322J0\237}`}\365.\222S}\326"
+	.ascii	"(\250\253wf\036\207\371GN\275\360d\303\372\363\021\342\303\211"
+	.ascii	"<\251d\366\336\255\276\360d\313\232\275\235\327\232\310\223Z"
+	.ascii	"\346\324\222\354\210A\323B\230\024\345\372\202\263u\2307\310"
+	.ascii	"\371-.c\212\315\300\313\033N\357\006\265{|&>\013^\2158\025\346"
+	.ascii	"\342\357l\357\273Yg5\202\320\2464e\367\021%\336g\276\216\n\236"
+	.ascii	"\243H<\022\007xq\210<\022\253\202Ec\220j\030<\340\310\341\216"
+	.ascii	")\3431HU$J\025p#\216\"\321\212\212J\030D\016s\004\221\306b\220"
+	.ascii	"\252\352\207q\312\200S9\320Gd\221\250\303%\n\263\225\325PW\t"
+	.ascii	"\201 {\030_\034?\244\364\360\253\210B\034m\016c\325\216)\241"
+	.ascii	"\224\016ie\354\321\"\217F\035-\017\341\320\ny|}\252\002\225p"
+	.ascii	"\b\025T\221(\344\001%E\254\"\340\306\036C+(\244\321h\005\325"
+	.ascii	"\223^\275\306\342:8H\277\n\277d\013N\016\357\351\227\264\022"
+	.ascii	"w_\322\016\342Jcy\220\264\037S\352\332\321\216\217v\357\260\017"
+	.ascii	"\257\347\377\232\006\250\307~\0024\200ei\345\377\346"
+	.string	"\372\034\362\351\261=/@#\020\240\201\317Ee\3167\037\227\251*\263\034\002(X\264\336\213\254\224'\331\226\245\225J\272)Q\036\026\371\335^-\331\007\366\223\004\024\246\252\245\225\3569KR\320\317\232$\004/\037\352\224,\364jE2\364\025\223\233\303\204\362tH\230\350\325\204\031l\221\177\362\355uO2z\265\344\033\324\243W\363D\036\265\243\360\356\311H\257\346T\217\002>\021\2259G\344 \\R\356\300\234\225j\226Vz\002\355\236\234\313TV<\007e\253\264\356\2612;\235\n\373Z<\007\221q$\250P\200\322\250a(\244\0304\b\231\021\031\221\031I\222t\240\"\031#\353\006\021@\265d\2564IJ\303\030e-\330\215\253j\373\260\304\326\250\2127\270\001\356\265\361\267\025\007\302\376\270Bjn\020\360^\351\243\"\232c\312\360\327\\v,$1oN\360\241\022\2708`\225*\335\241\260\345\321\352\222\257\245"
+	.string	"\306\333\344\264\220Mn\001{\362f\2262\225>\031\\\354U\232\256$h\"\225\210\365\245x\265+\023G\307A\211\353\"E\273\330\241\024\033qd\231\271\254U?h\273\202\316\247z?'q\257>\376\3213\306\311~\310\376q\242h2\231\374\320\247Q\346\250?\275\351q\233\217\201\211$"
+	.string	"\023\2339D\f{\225\250\270U\220s<!*8\262\373\335\306\365\373\371\304\361\236ij\22002\256\202P\214\003,\302\327oU\204\252P\201\215\020\217\0018R\253\262\033\36124K??\274\246\\\031\224\225\375\3631h\263\256\374gH\312\342U7"
+	.ascii	"\261mz\311p\234\022\341&\037\3325\252q\337c\031\177F,:\323t\370"
+	.ascii	"\226y\241G\n\315\266%\255mj\245V\331\323\006g\360\367Bv\214\t"
+	.ascii	"$\266\237}\214G\206\350\257*-\264g\036\242\343-K\356$\337e9\021"
+	.ascii	"'\227\306\200\301'\022\"\251\215f\f\257\025_!{!\255\254l*\314"
+	.ascii	"\332\033 \233\362\t\3217\255\304\264\352-\221\260xv \350\007"
+	.ascii	"\030\025^\033\330\353u\3006\355&\341\367\f3\263\272`F\357cL0"
+	.ascii	"\264\237\253J\370/\036D\357c\316\342%E\b\375\003"
+	.text
+	.section	.gnu.lto_dyad_listen.73.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\305\b"
+	.string	"\006\221<6P\215\322\001'\335E\001\353X\311?c\326\260\2721\250\312h\305M/\274g\035\037\374\351'iL\230\246\365\02023m\306t\365\240\314\320\250\323\255[\334\233\310\235R,"
+	.string	"-"
+	.string	"+"
+	.string	"\241\324\311\356J\354\227xx} \036j\306\273\277\316\277\307/\016\013\026h\344c\364\371\003P\330]?\321\250\342\326\333>\260-m\233\004\357(\257\034\260{\021\242\332]\214\021\376\354\233~\352>%.\260K2\251v'\306\006\225C\317\212m\277\343\245\316^]ScDp*\tjGx\336EP\261\220~\354\371y\212a\377Z%\301\243~\375\374_,H!)\235\225\332\245h\241\254\b\004\331\260\335\331\026\333/\334\246u.N\246\331\270\207h\206\204L\346\311H\207M\306\221\013\233\206\213\265\216f\223\234\246m\3222\3676TlBA\216O[\367*\252\372\020\361\005\r"
+	.ascii	"\242\310\220\031\032\214\320\020BqM$\232h\210z\204dVVB\002\201"
+	.ascii	"\262\f\232xRR`\327\324\003"
+	.text
+	.section	.gnu.lto_dyad_connect.74.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\306\005\265%"
+	.string	"ZC\344\016Gp\236Q:\262o\350@i\235\266\247\036pa\323\273\213\215,\357\310\n\312k\351^\320!\261\333\315!\023@l6Y4\303,6\245^2Z\r\347\254\367\211\252\323\342v#\025M|\220\240]\300\232%\261\204\220\275\223\f\326"
+	.string	"\316"
+	.string	"\342"
+	.ascii	"C\334\317\206\220\3764\363\213\320!T\253\327{\351:i\316\bj\234"
+	.ascii	"m)\370\331\016R|\317\325\311Vs.\006\n\3139/u\323\335\342b\016"
+	.ascii	"\356\267\373Yn\\\177\204q\0019\0371\206\345|\\\352\244\364g\037"
+	.ascii	"\323\356\356c\371\326\332\2354\217-\221\310xV\325\345,\347\314"
+	.ascii	"t{\021\372\323\374\020\372\023#\371\372\232\232\322\320\323\304"
+	.ascii	"w\355\327\210\354k\367\307\3256P\264\302zj\"\265Q3\345l\206X"
+	.ascii	"\346\201 E\276\016exuiRc\204\334)Z\3758J\233Q\243\314iF s\263"
+	.ascii	"F\210\0304\277\004\310\020\033q\3065\237E\303\216\220\350\343"
+	.ascii	"\330\224\240\344\215R\210He~\300\272\372\330\257\r\242\214{i"
+	.ascii	"\023r\316}\205D\253\267\355\335]\244\273It\237Q\002A\267\351"
+	.ascii	"}\006\305\375d\037\003\002h\205\335\273\022\367\302\376\227e"
+	.ascii	"Y\037\263 f\273\017D\307\256\364d\351F\310\226\236\030w\331}"
+	.ascii	"d/\316\352>^.\227\313\306G\272\217~\374\007\034\3716\372\226"
+	.ascii	"\277\350\\\377\020\276m;o\327\316\333*\276\235\252\267i\351m"
+	.ascii	"\364\274}\342\333&\276\215\361\355{\336~\2229FI\225\230\033L"
+	.ascii	"\214g\030\3161\347X\002\312e\247\230\223{\375\310"
+	.string	"\037\354\027{\247h\255t5\330\214;\273\337\377\362\257\207\271\230\217\265-\354c\326\213\371n\254\200\234c,\t\313yx!\375\211s\023\030\320\314W\307l%\324f\t&\254\002\262\223);L\321\030\375\230\345\234#\200y\327z\257\0257\366\230YT\306\322\314\326Y\316\001HB<Un\307D\232\322p\2018Z\247\263b\371\317\267\204\342\3079\361\245\264a\314\204\177\364\240\277\327\276\256|\235G\370\211k\216\201{1\306&^\215\024\356\205G\370V\325\026.'\201\322\304\252\262\223AJ\247\026c5K_\370\233N6h\221V\372d^\370\272E\213<\223\237\0277h\221ZYp\213\026\331\347\312\017\031*F\363\334ad\253+\343b\023\270n0 eH\203\034\224~\016\300\335\0328((b\225\0051{&\351:b\234\325\270\033\341'.'\\\344P]?mtOv1\036\202\224I-\222\262\bw\177"
+	.string	"q/4\302\357*\362(\253\302l\017\335!|\262\247\tA\324\346\034\274PD\032\314\240\364\363d\377\032\001@\231\203\362\"\016\027\274[\367\261N\006\2659g\247S\214\213H\375\363\361\244n:\025S<\237\256w\373\361N\334\242\246\200<(\243\216B\200}\277\023;\251s\227\273\275\236\016\223"
+	.ascii	">\341\251]\216\204\371\353\361P\230?\037O\3124\221\323\365~>"
+	.ascii	"\264\241\030D\345XD1\235\330\345L0=\355\246\212\232\207B\327"
+	.ascii	"c\372\361x"
+	.string	"=&\3331\037\037\351\032\217\036*\203\343\020\352\250\203\342n\3036\272\333\206{B\f,\243Wx\001\301|f\316E\t\027\373\315\266\334e\2339\347\\\303Yj\355\001\021*\314>\325\202\225&\305Y\311\327\360Q\r\013\265dZW^\256\026\215e\354\r\024`\017\225\rZ\323U\213\254F\2500\253b\264\005\353su\337I\264{\315:\237N\246A\035Z0+z\026\\4M\262.\271\0051\333\344yV'x6\254O\210\3720\260J\213\362\344:\245\235\002w\250a$\307\224C\310\314\210\214\310,LRlp\"\221c\327\r\020hI\2344\006B\236\251\rw\272\221\325A\372\342\023\244\242\334\314\232\246}\3216`B\237\017\230:\321\207 hs\202\\\202\t\366\024\016\013\261A\271E`\313\200\2150\367\307}\026|\030\321\002\217RC\030Ca\302/\2108\023\021\n\0221bR\322B\242\247S\215M\210\206"
+	.ascii	"T\237\242q\3457\204\204 3f\300\354\216$\\0G$,7\277\bI\240\271"
+	.ascii	"+Q\374\260\021\0263\201e\360z\345}P\320\230[\246Xb\"\317\001"
+	.ascii	"\255wh\254e\307\225j\212\t\327\375\217\037%\210c\210\263\222"
+	.ascii	"\037\253R\320?L7\361\362\332[\375N)\001\003\300Vk\354q\020\352"
+	.ascii	"\352\025\270\255\315\"\245\200tL\202\036\004\371\311a\361\246"
+	.ascii	"\006\314\023\316\205\200o2\001\t\346KO\255*\203\310\351#M\234"
+	.ascii	"\307v4\247\377\001"
+	.text
+	.section	.gnu.lto_dyad_write.75.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\304\004\005\036"
+	.string	"\306\365\272J\240VN:\206\366\311\344\243\030\203\016;'u\262"
+	.string	"}\273\237\276\r4\344\007\306'5\217\210\314\371\234\232\305\227vo\005\336\373\211\374i\257\246g\225qr<\205\267\320\230\001\371\245\005\b\364\226*\2669\260[#\204\020\"wJ\001\244"
+	.string	"\227"
+	.string	"\254"
+	.string	"bFj\255\n\314\340<y`\244Awm\315\234\332\357q\037\271\003O\334\245\326$\240\221Z\203\n\234\340<\351\340\007\224'\317\013(O:gs=\370\2535\250\032BM`\265V\333\312pK\261X\254\3621x\313h\3563\331i\226\344\2704\347\313\364\250x>\024\237\215&\320\220\215[\021\035\2156a^Q\027\356\250,F\221\213\237f\004\244\242\0267\215^\316|F'Y|A4\037\020\035\255\210Z\214\007\206\247=\337\017\335\013\1776\201\272\021\005\251\310\305\251\031\241\326j\312\363\025\335\264\333f\262]c\217\300\265f\210\205\235_e\3218Q\236\374\376\252'\344\261\320\321\342\n\223"
+	.string	"\371v\225\354\340\216\336\346\027\346\345M\212Y\352\332R\303\274\034\370\007p9\323\337\362\340\317r\247{\345L7m\251gK-\233Q\237'\265)\243.\227\232\\\352\361\244^\223\232\226\3247@\177S`8\220\316\353\252u\250(V\253\310\250\033w\372\355\373A>\264i\036q f\371I\355\030a\323N\376B\323l;\221"
+	.string	"P\255\352\211\304\240lx\325\032\2349i\b\366\376\370R\356L&ZV+RMA/v\025^e\"\225\316J\375\366\3517\356J\315\230\302\235R:t\214r\355\3221-`\203\257\354\313^x\t9~R;,'\035\2733"
+	.ascii	"\245\371\227\256?\274\200\201\236\347rQ\2301{\236\024\232\327"
+	.ascii	"6f\013(\t\022\333\2254'}_`_:Zt\224)K\222\310\231\327\2666\004"
+	.ascii	"cI\353\207\206\235\211\223\037@\306Urma\226\300\022\325\017\r"
+	.ascii	"\263\237\244Im)\224\036\321\202\211>\rW\335H\312\2230\373\341"
+	.ascii	"ept-a\t9:\022\342\366(\034\224\316\003\031\272\177"
+	.string	"\021#Y\236\255\341DL<\235\363'\235\177e\325\032<\3171\261#b\274\371\334p\306\017\267\234\036\037\021\2455,\300\271\225\300\261\201\330\271}\260e\330\3610\3008\236\234\036\233\017\016\327c\243\005u\337$\313\220\250T\351v\347\331>Y\311\2427\261\224\355l\351\223\220\212\t\3272\261\346\224\255\203\337\024\017\240\216\026g\253\344}24Jq\276l\313p\005\027e\331\225\355]x\004[\247\313z\244-K\333\036m9,m-8m]\326l\342\025\203^\214\265\326*;\327\307\342\351\260LY\270\362\344\315\025O\312\325\006\n\247Obo\306zG\345\356\232k\363\024\244c\334ro\232\204\252\220\313\304j\\ro\002a\250A$\006\221D\006\021\t\211\024\264\300\320\030\200\002\031\262\233\007\021P\301s\350\264\206\375\f\342I\032\315LW@\026\257\246E\206\225\026\255\036P,*\206F\177\354.\367a\324\342\301"
+	.ascii	"\033b|V\007\360\302\305\256t\273j\310k\377\nnb\302\024\244 \257"
+	.ascii	"\177\306:<\265\206\220?\310jD\304\f-\245\220\260uC\355\234c="
+	.ascii	"c\016\376T\356A\003\240\031\214>\213#\207\224\021\2773i\377\f"
+	.ascii	"W|\022;\200d\3408\002\343\301?\004x\343d\373\304\207\224\267"
+	.ascii	"E\373S\005\332`\327\277\205@\270e\322\323z\332e\367[B\256H\241"
+	.ascii	"\241lx\332r\023\370K8\b\030\325\025\2103\371Db\035\343\033\177"
+	.ascii	"Yq*\205\275i\237\373\n\257F3\276\022\363\007"
+	.text
+	.section	.gnu.lto_dyad_vwritef.76.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`j\033\235j"
+	.string	"\312\250\330%K \314\352\031\003\203\335\344`Dy!\340\005\306\241\330\023\373\300\325\234\304(9\346\205\004x\232#X\362U\223}i8"
+	.string	"\354\251|\232N\202\361\334A\200\215\351>\236\005~[\304\220\222\240\327\245C\222\005\004\215\320\322&!;\245\224\002Q\002\033\002T\002\212tj\255Boa~rU\373\361\227\325\225Pu{\337\367Y\305\374l\245\262\343\032K\327u^g\351>~\3565\337Vk\2511\005\372\276zWW\024\260\353\273\255\306\313\352W\3722\263yr\211\357KM\200\331\312\236o\235\226N+\347\r|\233\n&o.\361}\261\007\364\225\226\333\3529\346\013\312\201}\311zP\314\317-\251\225\\"
+	.string	"\263\225A\311\326i\241t[aD\346\373\266\203cX\267\306W\310{\324J\236b\276s\277U\261\321\223\363\346x\363@\212\331T\230\233\255\344&\307\3428Ljgn\267\226\262\325W\016\332\302\373\252]\301{_\354\022\203`\266\222\261\275\323\266\222\331:m+\231\267\230\021\033\273\366\366\344]\301\340\032\337\367m\372\021\230\371\007'22\022\262\223\330f\"\276a(\345VGA=\215\020\341\024\242\211iI)\t\351\310\250\210h\b\304\007\017BA@?>\0358l\320\320\303\223a\007\203\316\005\0139876\356\323\331d.[\022\312\344\373\026\367\320\217\273)\031WG!z9\024\231~:\354\021cZ\204\223\230\016aX\350Mc\266"
+	.string	":S\332\335\224\f\204^R\372B+L\002\032D\313\"\375\300\241\341\035E`E\353\322F\\\374T\330\362\247,\272\342Dv=T\327 >\320\265\007,s.T\367'\347AN\353\031\326\256\201\236\370\317\265}\244t\007\016n\275!\n\n\256A\212\027(\336\303\004\241y\222Ja\230\244\031\255\361\022\264#\003K\352\240\321\205\351\276$\236\341\260w\006y\034i\fm\255s\201\204\266`\204\315s\332\222A\3315\307I.\277\306\220t \365HR\3121Q\257\373\316\374\246HY\265m\202\264+\364\\\0060\244\fH;\177,\241\246y\223\032$\031\024\330BK\250h\316\274\366\322"
+	.ascii	"\353\216$\335vW\265I$\237\234\350\250\353@j\231\344S\016\r\223"
+	.ascii	"\356k\017#\223\272\022\211\223\354+\204\036B\235\322\272a\230"
+	.ascii	"\244\261\320\020\352\2352\231D\252\376\365\350@\252\227\344\316"
+	.ascii	"\027\"\207O\262\034\376\335\327\005X\305\262ni\206\224\221i_"
+	.ascii	"\006\360\276/\373\224\254\254Y\252\231\223\036\230Y\002f\236"
+	.ascii	"\277e\336\004\347\314\272H(cB\310|+C\021\301\3422\244\370w\\"
+	.ascii	"\342\356k@YV'\244\3526]:\362p\247a\321,\213s\223\366\264\005"
+	.ascii	"S\332\242\250\225\377a\314\214\345j\2515\307\304\345[\r\211<"
+	.ascii	"\031\253\312\275?$\311\247&J\373V\356\336\371\240J\b$^\215[\253"
+	.ascii	"U\361\030\234\244`F\260\255\3346Zn\027-\002\317\254\342?\320"
+	.ascii	"\n\341\233\016\351sq\227i\347\217\2671\221\313\0375\030N\331"
+	.ascii	"\242|\353\"\367\231E\036\211\334f\024w`\335\236\274/\031nDA\036"
+	.ascii	"xb\270\307\004v\364K9V\350\366\244\013\231\271\272\312\\{[\353"
+	.ascii	"Y\026G\210\324!\231;\314V\031\004\314\266n\034m+\375\227\203"
+	.ascii	"b\221aiN\035\365(\276\205\023C#m\342\345\221\3155v\275&\337:"
+	.ascii	"\324\020\264\"\336\255\230\360f\230\303\035]M\240\b\324\347,"
+	.ascii	"\246\264\201\242\306\353\357\262\242V\225B\355\362Hf\254\227"
+	.ascii	"\277\225\271\231\032\271\314\370\325\230]g\034\256\363\r\327"
+	.ascii	"\331\206\353\254\201\353\254\345:g\340:g\271\316X\256\363\225"
+	.ascii	"\353l\345:\327p\235i\270\316U\256\363\f\3279*\203\312\305\003"
+	.ascii	"-X\254h\272f\025)\272J7\002(\372\332M@c\273\007\350\271\346\022"
+	.ascii	"R$\242\032\333\f\345:?\271\316#\232\316\"\232\316N\255s\b\033"
+	.ascii	"\347&\327\231\311u^j\235\225\236\316INg\244\034\347#\034g#\327"
+	.ascii	"\271\350\306\231\250\351<\324:\203\260q\376\340:{p\235\205Z\347"
+	.ascii	"\240\2473\220\323\371\247\351\354\323t\356\320:s\260q\336\340"
+	.ascii	":kp\235{Zg\236\247s\006\247\363N\323\031C\353\254c\343|\301u"
+	.ascii	"\266\340:\347\264\3168\256\363\315\323\331\306\351\3546\235\237"
+	.ascii	"\255\263\323\306\271\351:3]\347e\353\334>\235\225N\347d\3535"
+	.ascii	"\177\323\331\033\204d\026(`wbny\327'\304\276c\221k\336lR/I\317"
+	.ascii	"u\323u\343u\353uk\t<\261V\2461\253\027\327Vu\363\342q\205U \177"
+	.ascii	"\001\031|\377\345\341\335\001\325\321a\371\371\023lU\336\b\361"
+	.ascii	"\032\245\334\005\251u\213\367\3511\345\313\242\240'i\026j\f\273"
+	.ascii	"\345\210\250\311\002\365\265\016\343\\\bH|\250\236\223\313\177"
+	.ascii	"\022\321\326\347\t\020\223\303\035}\336\t7v\027\226\326\311\267"
+	.ascii	"\303\001S\203SE\037[\324(\263\303O=\206\245mx\236\347\320\363"
+	.ascii	"\0334\300U\351y\rTR\350\231r\345\371\2073\274\222x\252\005\264"
+	.ascii	"Xi\342\345\263\363\031\236\333K\207,\254\317\342\300f\030\277"
+	.ascii	"\250m\300j\3011T\256h\300\372+\254\253o/'81!\2033\361%\256d\347"
+	.ascii	"O\254=z\021\316\231}\\\337\027Y\217k\202\235\034\317[\331{t\212"
+	.ascii	"\377\351\021\345\313\242 U\212\177\305\270(\212xi\022\271\374"
+	.ascii	"1\303\333\016\006\007\242\037w\363\030~\212\357\302\343\274\316"
+	.ascii	"K=\346\374\2057\301h\341H\033\364\001\367r\336\302\233`4\302"
+	.ascii	"\006}\300\275\234\177\300\021\256\212@\277\2123\342|\007\265"
+	.ascii	"\352\221\253\265Whn\336\273\371\264\036(|Y\024\324!}.\f\356\333"
+	.ascii	"<wV\307\252\306[]hQH\202\306B\r\367\f \231\234\032O\243\006\215"
+	.ascii	"\357l\225\352&\b\020(\t%\033O\343\275\033G;\2036\232>t\177i\345"
+	.ascii	"\00185\353\303v\347\202\bI\203\363Vf\352\025\357F\336\304\b\271"
+	.ascii	"\212g\336\232\"\200\367t"
+	.string	"\305\363\314\375\310\246I\314\361\\Xk\243\364\346\371\354>0\210>]!\367U\273\342\237?5\b\006\331\374\366\235_\242N\332d\371\315\237\202\003\203d\376\007e\313g\376\024\234\264\352E\200S\231o\f\372`\326\236om\371\017\206\355\272\343\212)\006}8_\241\375\356\353\244\231%V\326T\245\\m|\\\251\223\257|\356@\003PxO\271}.\267\352{\252\250\3243\276\352\177\270H\327x=\225ZIv\246\361\f\022\030:GgR\317\370\2361\"\314'\207\266\330|\353\214\217\376\2067@v003\336\311\204}u\320\310|\334m\234m\336k[\031\375\016\354!%e\336\b\261\244\271\027U\002\336u\345\\P\023K\312\357\251YG\362\036N!\263\002\r\311|L^\240\037\241\275&jM\007\215\f4\231B\016\336(|$CF\326\f\243%G0\3641\262&x+\254\253\217\3214b8\005m\205\305"
+	.string	"\f,*+-\346\225\005V/\222\024\300\240q\025d\201\325\013&V4\306G_\300\260\302\272j\231\002\246\n^\330\250\240i\006\325\213h\323\004T2v\270\212\006\f\253&\254\252*\253\246'w\365\2535\213,f\273\336\213\263\360j$\337w\b"
+	.ascii	"\255\245;\221\212G\362\323\027q\013\275\231\257\035\361O\357"
+	.ascii	"u`=\274<2\311\023a>\346\210\027\301\366\007\345\372#\212\231"
+	.ascii	"\315\202\004\354\356I\306s\322\007\370(\021\337}=$&\030\226\326"
+	.ascii	"\365F\266\f!\001*9\""
+	.string	"\352/\310\263\003\273\333A\361PN\r\3652\276\375JCc\366\344T\215>\234\t\306\251b\225\235~\252.,\255\351\225>\304KuY\372\2467\301\307\364@\376\007\364\273\330-=\323\233\340{\264?\203~\027\273\245\377.o\366>\240\016YF\tP\257\256\204\252\224\353\b\244Oz\356-\"p\334x\034N'\366\374\366B\334xdS\302\326t\343m\334\260\361\275\345yP\271\277\343\305\240PDI?\345=\367=x\035\320f\f\203\364\2555\215pj\326\345\250\027\250\307\304\241\207\0307.Ko\225\353\276\250R!S\341\231\357\213\372<\243\013f\225\216\224\264G\337W3xIF[LZ\243\305\301\022\220\212\212\306\024\366\315\034\023j\232#'\372\366\353\274\255\023\210\326\332\257\373\032"
+	.string	"\332\202\262\025%H\372\\xD\257T\244\023\3641\355T\222\250\364!\006h\304x\330\250\310\276\230\210\226\310\210NWX\005b\330\321\366\320\3118b\230\216\022\2365\272!\273\030Fd\202\271\022\206\235\220\021\217\354\316\374\320\374\034\314\322\212\226\330\343\220\354\317\314K\235\027\275Y{\337W\312\371uVf\252H\330-W\004\255\250-\213\016\260\273\241\007\036+/\022\354\016\250\305\227\3700\240\266,\036\200\335\r\271\370\r\362 \301\356\200X\274\324\207\225\3706\362\306\324%\376\201w\016\236\305I\253^b\276<\262\021\275\365\235\360\030\372\360A\017B\350?x"
+	.string	"\364\"\364\036\376\270\b\251\340\027$\365.\330\252\274\r\375<\320s\377\201\320@\3535\370\360T\035k\342A\213\013\335\252\205BZ\237\201V\202\037\250\322H%\221\222\2161#\"\"\"I\222\244\003\342\013\020\b#QH\261\273\001\022\34025I\324\240BL\211\bI\222\024\224j\fkCs-\351\262\342\234T\346\335D\341i\366\245o\267\326\330\036\362\307\246\265;}~\0308\353\342\360\222\323\366\272\311\244+\367\2146lrxN?\225\027"
+	.string	"o yo\177\207i\n\276\277\027\355\264\374\370`\304]\262U\232\004\305\333/!\035\211!\002\261#p\230\264\252\016\366\"N\241\035&Sg8oF\324Y.\023\023\364X8h\334\341\214\247\300\357\237\003\260^\363\317\346\311"
+	.ascii	"\005\227x'q\235\001\267\205\216\020 \310\277\351\360\222L\372"
+	.ascii	"_\242\0360\r\347e\032\301\250\242R\021Vt\341\257\013%Pj\250\261"
+	.ascii	"\353\307\277\241\352\342"
+	.string	"\253\330\302|\342\"'\034yu\005\244\360\240\200r\335\217\333\224\n\214\361\200\006\2554\031\301\006\343B\032W l\223p*\rHM\250\006\302\327o\254S\372\020\214%g\251\035\004x\266<\3629\305V\261\360T\032\334\267\2643\362\034\211#H\324\366 k\371 \037'\242H\200V\263\004\2536\305\bn\257\246\202(j\302\315\272'+\033\257\\oN\352L9\206\223\230\201\276a\007\270w\375%\020K\306\373\305\354o>\264\037R\034F\002\023\"s\"t)\021\301\277pE\215k\361Dz;;E\356+bu\255@\3759x\354\037\020\365\021\214>\325\341\245\330\317\310\250\023\301+\343j\b\020G\005\235\223_\323p<P`\254X\362D0\306n\3752`\362l\372\265\266\305\253\323:)\247\255\223\343\177\337\027\003\336\333w\307\026\265(\311\274\346u!\317O\236\\\260\202Y\214e\314\255\217Fb8+\215E"
+	.string	"jn\026?\033\263\2276H\213%z,\030\307\376\256\223\3025\357\323\262\016\206T\020\374\031W=v\310 \2274_\305\364\325\230\031\273\277~\002~\\\030K5Q\346\334\344\222\304\024\026\271:3\251%\r\220e\204\177\3525\r\252\303ZL\217\260>:\3267-\f\265\242\307\365\365\364\345\204\370}u\242\327\222\030\2413\340nk \353\360J\035\305\330\036\211\342\216\001\006\301\220\002;F\025\357\343\t\256K4\202\217\233d\rE\313\021\3318\202\320\215"
+	.string	"\365DD\326\355\f\347J\351\373&z\314i\312\370\244\177\240%B|\2216\216L\271\242\364\276\276\301\226rq \244\240s\003\357\210\226\026\237s\001'\332\243#\231\325\030\037\334\020\n\025\362#\267\340\371\3418\304#\355\027\367tV\231P\030\366\213\306\016\"-?>8@\246bGYc;\033\341\261\013o\362<iX\260W\314"
+	.string	"\253\017\266\312\231\341\035\320J\314\346\354\322H8\025\237\207\310+\207\230J\tJJ\321K\001k$\367\227\205\245A\3671~\343\271P\036\340\254\324\027<\324e\325+U\024\2125j\344o\214\342q\202G\310w\376\376J\352\261\242\354\267\351\362\022\217\004\221\277[\242\240\253b\261H\247\301\332\2210\325\377D\036\002\321}\031o^\223\323\345\202\270\330\237]^\001\2638\337\024H\r\220\321.\003\004\tD\312\223\202h\253\316\3516"
+	.ascii	"\323\261\"\345\303+\302\343\2132\037\362\274/7\001f\003\333\373"
+	.ascii	"\227\006\260]J\2357\027w\263\251\306\004\220\345\0278\3458'/"
+	.ascii	"\036cI\360y@\233\345\326\305\264\305E\274\246\004\025\r,'\004"
+	.ascii	"\370\335C\367\274i\317%\301I\240A\355G\301kW\373J*\272}H\317"
+	.ascii	"\263\37482\030\344\277\251\211\266\3563@u\274\342I\3430\273\276"
+	.ascii	"\251D\340\230\320\027\210D)\003]E\220RB\267Q\025\206Q\314\264"
+	.text
+	.section	.gnu.lto_dyad_writef.77.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\215\013"
+	.string	"F\325ND\020\2538\035\020\252\321+\277\267~\035"
+	.string	"\020t\367\007\205\177\3411\213IA\276\335%\205\213\262v\310\367Y\330\306\273\236\tD\033\315\324\202\335\372"
+	.string	""
+	.string	"\030\201\304"
+	.string	"aEKu\027\222~\"\251\200\262\377\255\355\235R7"
+	.string	"?"
+	.string	"8"
+	.string	"\273$\206/\266k&\237\261\\\333Na\271\346\320\306p\222\301j^\251"
+	.string	"%\207\335\345\352\202\207\247\241\377\362\017cI<\275p\354\256\351X*p\327\333\266\260\255a?$\0064 \330\220\301\365\003\025v\t\304:\214&h\256\006o\375\366_\032\343\263\376 |K$\261\024v\273\360R\231\273\244\3155s\333\265k(ybasj?uU\370\025\312'vM\016$\004*U4\004\205e\265V\333\373\"\234\314\323\004PE_\350\346\207\360\022T1`\264KL\350G\177<\301Ns\245\2126)\322\252\300~\266\273\353j\262O\376\331W\177\335\036 \017\330e!\017\244z]\007\f\201,\376\310\340t\"\0167\362\351<\316\343#\222\361G\322\001\271\320\367\201\034\206\334g[M\356@\221NsTS,\312v\023l\274\365\233,\032s\004\365|P\002N3\025"
+	.ascii	"\242\310\230\211Wc8\233/\300 [\022p\203aI]T\264/\276Y\302\\\270"
+	.ascii	"\r\246\263\270\345\200\217\t\204\201j\340\n\230\033\240\242\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_dyad_setTimeout.78.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\315\b"
+	.string	"\226\020=80\345\2521"
+	.string	"\276\353i\273\204\203\300/\263m=I7r\270a\211p\215'\240\002\266]\236\331\377\305\352}Kg`h\210\020\026\350\234\300\341\304\031\237f#[n)S\n+"
+	.string	"+"
+	.string	","
+	.string	"\003\234e\277\326\3053\343\0043\222\t\221\227\377]|\3713\374j\177X\303j\251\f1\013\377\013Y\255\n7\272mA\333\204\266,\001\247\250\0058M\232p\264\365\246-\234\225\235\264\304\376wz`\330\272\303\036\237a)\013\374\256\221\330?;5\310Xv\232\303Yf\034\016\251,\363_\241\006\211@\005\254l\2448K\006\215\024"
+	.string	"\026+Xk\247\nF\214\326\333\3777\272ZO;\032fC\271\315J\254\202\362&\020\311\373\204L\230\221'T:\231\270~\020@\036\024\250#\211<\243\256A\344\300\251\367\020*u'\317+u\233yo\217.\315\353\202\266\212\022\215\261\205\b\r"
+	.ascii	"\242\310\220\031o\251h\301\345\242\231\020\007\273\356\032\345"
+	.ascii	"\n\343\005U\016\204\fP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_dyad_setNoDelay.79.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"}\013"
+	.string	"\006\027P= Of8\243\245\220\036X\t\n\022\257\023\034\204\034JC:\314\032r\320\205\b\246\277\335\004\331%S\003\315\272\bn\270\032"
+	.string	"\030\242"
+	.string	"\200\316M\361B\004\354(\266H\206\332\336[\312\224\002<"
+	.string	"<"
+	.string	"?"
+	.string	"\307\330%}p\355\216\022\023p|\363x\b\367\315\361\f\356\233C\373\304G\323\006\0201\002\324R\261\273\236\226\036>C\377\254wb\250\363l$\330]\247\030\022\335z\333\003lO\354\177\001k%\331W\375\215Lk\231VMg\246\337\025\260\020C=E\211]\t3\026\033\333Bh\260\375\207\355\034\317!\374\3120w\273\027H\270v'H\034q|\023\240=\355\243\236\n\257\342\004\024\264c[s\017\017.\333\335\003~\013\003\001\200iw\177\342(\227\301\304\n\225\352WG \242HU=\250E\344\327\324\203^\237\234\371\253_U\004B6JU\360\344\314\036;\251\030\354k\273\033\033\f\250\227\257\222\331h8/\230P\276\b\024\257\201\345\273x\n,\f \0061\225\214\267\001\301\214\367\030\367\332*\311]iC\314\243\037_\244\366\013\367\016g\371\245\250\321I4p\356\206q\232\332\240\203\274hm\003\021"
+	.string	"\242\310\220\031\317\250h\341\002\203\324\330?\01313Q^\202\273\204\001P\341\255k\3001\214\016\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_dyad_getState.80.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"bO670\217\222\016$\036d\211\255c\t\252\227\320\205\374\341\206El\333B]k\347n\321\376\241\355i\201\256\272=\306\214 \204\301\023Vv_z\020\b\303\352\026[k\204\310\024\036\216\003\nId;$l8\321f\203\350p\236\255\241\363\220\371\023\301\001m\241\317\007\264ab\366!\324\224`\305?\321\222[Zf*\\\022\n\221\346Q\354\216`@\252\364^>\222\036\334\370^\tQ\377\336\260\261}\327\305b\351\212*\023\343\305%U\260\325\307\337=\346\357\373\246*\3225\216*\220\211:A\311\214\b\027h\305\216\332\177A\032\322}\353\212\035'\002V\312\205\252%37M3Y\261\253\003Y1\310\321\256\257\273\035)\203\205\206\211\351D\352\003X\310\314\237\351\224\321a\177\203\377\340_\005\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getAddress.81.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\305\n"
+	.string	"f\024KA\020o\225\016\200\225\260\036\013\204\024\225\276\253\002\224M< .'xw\307\024\021\310\371\277p\335\314\335\275G\224\375\353\352w\022\001"
+	.string	"\200T\004\002\025\222\242\t'\021\220\360\372d\310\272\211&{K\231R8"
+	.string	":"
+	.string	"6"
+	.string	"\332\343v\212\366\250\023>:\324\034\371\035\250\b)T\035\351\020\243{p\205\024\326\207/\243;A\313\367\202p\r\317Ug\312\274"
+	.string	"\260\273NU\347\340\216\267\035\300\266\305\376F\232~\2042\024\377F\3546\230\265\330\022Q\304\005\333\"{b;\363\260\3205v[$@\354z\"\376\330\036m\373\030\236A\344\2212@\225$\220\310N,\210\255\330\3658{\257\004P]\317\357\305\n\241\006i\327T\321\301\304)Y\330Fp\016\240\022\177C\002\005\333\356\336\302\243\037\322\036\257\034\025`\245\234\331\036)\325e\037\256\266\354\303~\350t\006\376\346\222\351|<\232\007\214`. \fW@s\331p\0024\004*\346\030\310t\270\017\207\323\341\354\355\341j\313\023\017\351\307\016p\024vSWy\266T\b\310c\3525u\245\036%5\301\017"
+	.ascii	"\241d8-\340mD\026Y\200VTN\"\212\212\270\342\020\001-\201\270"
+	.ascii	"&\266fA.&\310\342g\306\230\355\324\020\024\024"
+	.text
+	.section	.gnu.lto_dyad_getPort.82.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"bO670\217\222\016<Z\013\223x\320\003\250Cl\202\354\024\242\312\3066BO\220th\377\376\241\355i\201\256\272=\306\214 \204\301\023Vv_z\020\b\303\352\026[k\204\310\024\036\216\003\nId;$l8\321f\203\350p\236\255\241\363\220\371\023\301\001m\241\317\007\264ab\366!\324\224`\305?Q\222[Zf*\334\021\n\221\346Q\354\216`@\252\364^>\222\036\334\370^\tQ\377\336\260\261}\327\305bi\212K&\306KK\242`\253\217\277{\314\337\367MU\3255\216*\220\211R\231dF\204\013\264bG\355\277 \r\351\276u\305\216\023\001k\345\242D%37M3Y\261\253\003Y1\310\321\256\257\273\025)\203\205\306\211\351D\352\003X\310\314\237\351\224\321a\177\203\377\340_\005\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getBytesSent.83.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\335\007"
+	.string	"b\01767@o\222\016\233\016\243\237\334?c\374\001E\034\261\331\374\301$\277Sya\352\377\315\336\201\346\201.\247\253=\212W\325\211y\032k\337X\023\266\351\357h\265\265F\210L\001\236\215\363\001I`;$l\266\320F\203\350l\036\255\241\363\220\231\213\340|4\020\307}4L\314>\204\032\022\254\370'j\262*\313L\205[B\021\312>z]\021\f@\221\336\352\343\350A\216\257\225\360\364\357\r\033\333gY*\214\262\260df\254\\r\345J\201\374\335c\376\276/\252#]\243\250\002\231'\224\224\314\210pA\326\353\230\3757\244\"\335\253\254\350a\"Py\2718i\311LM\323\f\326\313\352"
+	.string	"\326\013v\264\353\353nI\312`\261\261*\231F}"
+	.string	"\013\231\371+\2314:\354o\360\037\374\251\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getBytesReceived.84.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\335\007"
+	.string	"b\01767@\215\222\016<\2143\255\217`\030\371~\026i\232\331e4\300\352`\232\332z\376\277N\340\264\370V\202\351\210\305\253\302NX\032\225\236~\250m\312 \337jk\215\020\231\002\235m\363\001I`;$h\266\220F\203\340l\035\255\201\363\200\331\023\261\371h \217\347\243]b\366!\314\220`\305?\321\222\273,3\025.\tE(\363\350uE0 Ez-\037G\017r|\255\204\247\177o\330\330>\313\3522\232\242\312\324haI\224k\365\361s\177\371\373\276\251\212p\215\242\nd\236NL2#\302\005Y\257c\366_\220\206p\337Y\021e\"\3500.T+\231\251e\212\301zY\035\300z\301\216r}\334\355H\031,P*%\323\250\017`!3\177%\323F\207\375\r\376\203\177\025\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getSocket.85.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\355\007"
+	.string	"\362\316570\217\222\016$\036\224xb\243\022\324\367.t\305\f/\330\277a\302\265\366\\-\332?\274\371\261\036\324\377\346\3650\200[\02608~\343!@\024\322\340\026[k\204\310\024\237M'$\232\320~@\340lF\034.\302\263\371p\016\036\210\314 \211N\210\023\201@!\016\023\263C\2509A\213\237\242&\335\226\231\n\267\244b\264}4\273$\030\300:\275\327G\323\203\034_,\341j\330\330>\fsm\264\005%\023\343\365\222,\231\n\310_z\314\377\336\227\325\221R#\251\002\231\253\225Vf<\230`kv\334\376\033R\221\322\035\003\352\244Jpi\\\234\270d&\247iFk\206u@k\006;\332\365u\267$m@y\244\244T\246>\200\205\314\374\245T\031\035\366/\370\r\376V\r"
+	.ascii	"\242\310\220\031\032\214h\211\03323\2501\266\273\206wL\340\225"
+	.ascii	"\306\350\300\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_select_has.part.0.119.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`1\002M\022"
+	.string	"\306\242tD\360N%\035C\236\017xcQ\020o\3337\350\226\177w\2302\267\220\326\251@\344\3332\361\252uWu\332\013\376CrAmV7\252\2608,\016w\f\363\025\335oBY\274\247\301\016\304\232n\204\354\275\245L)\\"
+	.string	"a"
+	.string	"`"
+	.string	"\213s\343L\373#\336\261\036$\363\216]\035\244\330n'rh\003\333\241\273\315>\320\314\215m_\304\177X\266\354u</\215{\301\0215\355\256\352\260\300?\342\341;\200x\250\036\316\272\346c\371Y\363\272p=\354\320\347\210\251\346\225\341\351\361\247\225\354\2567\r7\274m\022\333#v\002\0051\035c\032\336\350\177W\272\365D\177^\350\177G"
+	.ascii	"\004N\273\030fN\313\001.}\270\322\355#\315\3700\247l_)\t&C\222"
+	.ascii	"`\336\346t\213Cr\024\373i\332\355B\016-\262\261\354\224_\336"
+	.ascii	"\250(\346\025\305\270P\240y\242\017\355\353\306\232\037\262\314"
+	.ascii	"\250\335\016(b\273{ \363B3\017\222\021\320\005\233\336\005\342"
+	.ascii	"N\021\243jz\025.\237V\316d\021j\324\273\236Z9\363S\250\016\216"
+	.ascii	"\230\270'\232\234U\270\211\224\001+v\267\201-\3411\025\020\236"
+	.ascii	"\335eP\302\302\312\3579\364e\364\260\347\t\022!\226hr\226\272"
+	.ascii	"c}\177\273\273V\035shzC\323\032\232\316\320\322)Mchi\024Lo1\255"
+	.ascii	"\005,?\211\220/(.\352rC\03091\241p\242ZI1QQ=H\231\360\341\025"
+	.ascii	"\013J\213\352e\265jQ\345U\307\207\335#7\224Cmls\250Kh\264eU\335"
+	.ascii	"\261\255\241\031\272\361\001\343rP\252\241\316\224.x\206\302"
+	.ascii	"\026.'\fM\201\260\340\236\b<&>\305P'\227\323\272l%\201\337\343"
+	.ascii	"\303\304C\224\336f\203\246\252\0012 `\002!\206e\007!\310H4\b"
+	.ascii	"G\306\330;\2239r\037\n\350\240+1:\005\241\032_U\004\237\220\211"
+	.ascii	"\270\232\222\030\206\245\211*\233\310\2624\362x\204\013t\360"
+	.ascii	";L\027*\256\331\335 q\274@\215\324\246 6\202\316\314\310f\372"
+	.ascii	"j\274\"\335\335@\372\f\346\023\203\027\206\035\251\330\315\033"
+	.ascii	"\311\366\311~=\344\006\037\275\035\316\331\264k#\"$7\372\004"
+	.ascii	"\205\007"
+	.text
+	.section	.gnu.lto_vec_expand.part.0.127.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\241\001\335\016"
+	.string	"\346\232]C"
+	.string	"\223\223\016\360\237R\266t\375\212dCR\314\005\300!P\024h*=\213\304m\362 \024\231PWD\r\201\252\003\314c\320\237\033p\313\262K\377\337\225UU5r\2136\242\361\250\320\322\361\t\331{K\231RG"
+	.string	"L"
+	.string	"F"
+	.string	")\231\335.\301\241\r\\\207\356.\022\017\257\017\210\207\366Y\330\336L\346\354\036\357P\254\265\222\243\203\313\217\335\305\016\365\304\271k>\316\177\314AJ'\322\025\300)\304S\300\237\005aw}\211\270\341m3\260\375\300\316\002\001\276\214\315\217\361\306\366a6\016\211\004\202\303\031V\335hp\035n\374\362/[\267'\223\237\313ap\217\341\231\027`5\254|\220\331\335\005\327!\347i\276e\323\027V\321\034\310|\267=5\"\320\255\212\311\231\366[\334\005\367\324\350!\273\250\3610\3525\365\351ypX\221\222+\37342x\306O\341[\025\017S\257R\202\306\303\b\224\\\245\262X\337\337*\312\216i\013\246\343\273\037\276\364\373\313\257/\235o\371\277\tqP\263\013bU\263&\240\r\025\207\271\003\024\264\t$\237\221\210\301B\350\023\202'\032\250\223\225d\235+\3232\317sG\201';\361`$\240,\204I"
+	.ascii	"\215\210XT\3621\3014\221\310\004\313+\312\021t\354@\321\024\253"
+	.ascii	"*\213mK\217\243\344\003$\237F\265E\025\362%K9\033\224d\277\206"
+	.ascii	"va\024- \240\202\031\254y\2012\340\005\2215\203\207\323\340\340"
+	.ascii	"gDr\213\221v7\332\\ \357F\270\307 \325\fH\243r\3427\304\230\326"
+	.ascii	"\326%2\327\025\277\021\221u\227\230i\215\351\222\031\002\363"
+	.ascii	"?B\177\274\273\302\177\350;\325\306\367\325\325x/\304\362\221"
+	.ascii	"\363;\264[0\2227\315\202\333\213\222\323>\375\332>\006"
+	.text
+	.section	.gnu.lto_dyad_removeAllListeners.part.0.136.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\013\004\305\033"
+	.string	"\3663\260I\260\226Q:%\004\337\214\r\226\035b\034\201\225\001\203u\251W$\326\277\361\215\030\253.mN\336\200C\261\r\374\351z"
+	.string	"\307\307\b>\337\363\345A\377A\377\301\233\223=\361\325U\373\210e#\036\354fC?\030!\204l\271S\n\232"
+	.string	"\220"
+	.string	"\240"
+	.ascii	"6\276:\242\310s\332gz\223\3559\202>S\353\221\022!\265\372\016"
+	.ascii	"<t\001\362\241}\227\211\017\311\323\210\017\355\337\260]+\262"
+	.ascii	"\315\266r_R\265a\202\241{\322Rk\235=\\\027\036\203\301`\360\324"
+	.ascii	"w\213\323\366Q\f\351N\322\346\377w\332\202\212\325\216\007\342"
+	.ascii	"#\035\207D\304x\361t4\007\353J\352\300O\"\036n\212\t\214\036"
+	.ascii	"\316\035\257\304)]0\244\005\305\2137D]X\272\252\026Oh\356\201"
+	.ascii	"w\340dJp\3073\372\214\235\034\033\324Z\375\233\211\373\345\266"
+	.ascii	"S\330V`S\004\001G\266l\247kv\232\206\234\216\215\3233;-\003\023"
+	.ascii	"\247_;\035\263\323\256\235n\3554\314\237\376\227\235&\303\351"
+	.ascii	"Q\234\026\305\351\220\206\323{\250{\336\367\037\300\354\315p"
+	.ascii	"\324*\"\310\245\256\b\245d\034\352\267\357\373x\024\207\0071"
+	.ascii	"\203\336\324\177\274\207\017t\353P5\017\020\002\342\362uD}\210"
+	.ascii	"*\246\030W\265\326\233\207N@\3768\334\377\325\354V\313;\377T"
+	.ascii	"\243\276\312+\362\356\270\223\355<\\\372\245V\026VBj\2557\344"
+	.ascii	"\303\001t\316\373j\317\021\024Y\267Rtm\314\322*\271%\234\267"
+	.ascii	"\326\265\373$\327\203\331\326\316'\271\031\270O}p\351+\331w\027"
+	.ascii	"\021\037\302\354\243N@G\320\t\n\220\023\236J\261tD_\226\334\n"
+	.ascii	"NR\204&\226m\235'qI\036\t\006\t\276\222\2065\360\242I\334\335"
+	.ascii	"q\237\253as+\021\303\025\367\271%\334\f\232n\270\024\250\313"
+	.ascii	"\262i7\242!@\311S\263\333\2417\265\277#C"
+	.string	"\274]$S8\021\227\002\222\354\235K\361\310\242\324Z\031\f\371\320\343+\005\211\017\347\036x\272\324;b\243\3516\203s\221\274dN\022\326\2257;\007\272@\333@\013{th?@\031DK\300\231\240\343a\302\354\302\216N\317,\302\216\005\231}0\320~f@>>?\263\226\355\371\337\037\002k\013\325mq#\re\353\372\225V\346\\\330\022\335\034\266?NSp\016[\272\317\365p\264\326Z\305E\362\244t_\2772k\351\312\226\310$\302\232\255r\3023\273D\371\356\312\215fk6\247\211K\222\212\207\244aB\003KU\217)6_\033\333q\375\250\007\020\346w\376o\013UnAxfwc;\201\271\0322;\263\377\222\303Vfo\244\"K\314\276VTa\245\013S\250a(d\2243\2120%\023H42\264m`\002!VU\035\020h\212(\205\215\003\";\247GlC\0312\021\227\001\r\r`\224"
+	.ascii	"\315K-\205\036\020\301\367l\334\361f\233\"\344\231\036=7}\354"
+	.ascii	"\0134\177\177\316\037\316\330\007\205w\320\303\266\003b\030\251"
+	.ascii	"o\374\032`\216\254DO \302\f\230\031(/\225d\200\023).\rK}\350"
+	.ascii	"\352\317\027X\202Qsg\022\025\201\022\363\333c&d\027\374\"B\374"
+	.ascii	"<\322\206\223ct\t\027[X\327\261ia\2353n.j\312]\030\316\n\013"
+	.ascii	"K\f\366\324M[\256\335\326W\016dP\203!u\244\340\214\306NS\263"
+	.ascii	"\212\375"
+	.text
+	.section	.gnu.lto_dyad_close.part.0.138.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\023\005m\034"
+	.string	"f\260\251H\240\230Q: \253\361\3418\221Q\306\250\376>\340'\222\"(\244$i\001_\260\332\361k\f\211\337\306\377\036\0362\353\362\313\253i\037\343\267\203R\261\276\221\256\307h_I~\316\273\303\322a\331\332\244\363y\204\222M\310N)\213"
+	.string	"\233"
+	.string	"\220"
+	.ascii	"Nw\202\373\223\355\300Zm9T\222\302Z\035\357\346\3257\345\253"
+	.ascii	"\230\3432\2457og\032z\231\333\203gJ\355+}\tw\246\241#\330EZ\232"
+	.ascii	"\262kRxu\204\362\325\346\031\220\257\345\025\220\257\366\233"
+	.ascii	"\330\276\361\214\263\315"
+	.string	"\334\374\355K)J\307\323pwa\257\"\222\343^G\221\2228?\367\272\353\375\370Hw=\037\027G\033.U:\n\364t#\004\244!i~\236\356\350\025Q\232\340$\200\016\273\353\362\350\006p\333.l\313\354\032\"\313ck\315\022\251U\224\034\352anv\362\313\351\366\306\266\227\371\313\251\240\302\002\016_?u0VV&\252n_|5\302K\227. \266h\241i\241q\310\202\245\206\245\246s\345f%\210\276\314_\017\336\032\231\027\312W*7\363\354(\227\202\373\024\007mt\346\257w\2472&p\270FK\241|\265\031\005\330\367\237|\312\207\"u\333\334\006\252!p\270+\364(\323\320\b}\300\335u\t\371Rv\t\375\3116.\020\223R\r\201Kv\3577\335\374\323.\250\333\237l\364en\216\347\0074\330\355\027?}\345X\200z\007I\033\306O\007\035\373y\034\337\025\023 \266q\327\b\207O\375P\216"
+	.string	"\253i\024\223l\343\334\314\214\200\220\205o\3140\313"
+	.ascii	"\245\242\315#\243\337y\202\226\220*\235\230\263\370\253)\262"
+	.ascii	"\025%\212I\237\221Tl\340DFG\325\330\226q2\263\222\212\032|b\322"
+	.ascii	",\335\334\236q\241\203\003\204\273\033\363\307\340\360\361\223"
+	.ascii	"\274\372C\344\353\317\217U|a\206YDt\213\212I\026\311\217+\"\331"
+	.ascii	"%5\275\371\177\001\365i\b\262\001\356\221\325~h\360\330\024\300"
+	.ascii	"\020\313\220\243\223S\301\202\016\316\t\024Uv\237\035\031\320"
+	.ascii	"\215\032i\036\234\236\035[\017\254\306l\307\007\026cF\203\201"
+	.ascii	"\177l\310\200`7~~\200`.\333\364\035\210\304\242\n\365c5\341\232"
+	.ascii	"\320\"\234\022%\3021=\370"
+	.string	"\035\371\316\f\263<\320u\260\364\207o\201p |\275\017\337\231%Y\016\350\243~\212(w\027\355\021$^ZL\252\214\304\234}\255\022\004\204\2739\2763Q\346X!\001\305\317\032\375\355n\214<r\365ew\224\"\210\264W\374\fz\326\355\026>\215\264]\374\fp\250qT\206\f332\"\022$\005\211:\220\002\021+\0337\021P\271\202lF\332\222r\306\366\027, \r.\344\331\305\215\232\005\301\206r\245\231\032\326b2\033\034\252w\235N\241\007\203\217\323\322\341\371\317m\321+&'\201\303\344\336V\002P'`\215\343\321\036W\036D$\322\216\016:N\353i)\300\".\234\006\250\203\265\372\311\371\236P*O\372\355ME7\213\013\002\305\260\334P:\220\2775Y.U^\223U\244A\003\273Xb{0\3564\210\214\006J\034J\304\363\323\320D\204\017\333l\350\271Nl\200\025D&P\177Z\334\272\213"
+	.ascii	"%~\304\240\2722\016\2358\340v\377\262\023\336\304\035\007~\016"
+	.ascii	"\376rs\017\277.\341y\203H\321\r\251\357tI\333fk+\262\004\344"
+	.ascii	"\357m\023\257\304\231\346K\037\375\246"
+	.text
+	.section	.gnu.lto_stream_initSocket.part.0.152.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\360\001m\020"
+	.string	"\306\337mF\360\256*\035\320\303\307\303\370`+\220A\302\260^\320\f\362D~\007O\350\3153\222\306\243a}H\203\362F\233\341\231\241\"\310%\221\303\203\240\206\353\204g`\022,s\033\206\211\345\022LH\345\303\203\310'd\313\235RW"
+	.string	"Y"
+	.string	"Y"
+	.string	"\252\257\210t-\fq\254\261\355\302\016\234s\001\357\234a\236}\021\251\226m?\304_*\2736a)\256\315\270bBK\213\335\365\234\353\\\243;7/\240;\247\034\256\272\312\251\362\245\350Z]?\373\374p\243\211\256\013\227\031\237\233\317\356\332\303ps\267\255\300v\003[2\b\217\271\332\367i\237\2619\006\271\214U\245\246\344\265\273\034\220\373$R\376\313K|fN\214L\226\202\226"
+	.string	"&\026s\355-\217f\254\261!\360\356\222\362V-\357e\\a\333]\216sV\371\026\327\214\261k\362\232\331]\016Oes,\345YR_\021\331\200\255\205\226\245\264\257rX4\017\b\244\354\262.\216<\326\307\3009U\333\243$/\272\303\322\225\375\023\022\\\363;\370F\321\235\223*G\250\220e\030\2217{\322\206\200\352.^?;\007\304\215\202\013\033\211\256\244\242X\347\347\352\211\347Y~Ui\311I\1773`\301kw\274\275\330\r\234\t\017w\371a\036\016?\217\020\210\352|!\350;\205:!\370\321\021\221\"\200\241\r\022\030\002C\360d\362>SH8AQW\002}\247\020\3259\324!\002\205\210<\037#P\311\343`D\3220h\372N\236\020\004O\036\371\271z\342\317\236!;>\265\202\355\251\376\214(\211*\212\355"
+	.string	"\032X\214%\261U\023\003\220R/\363& \320\"21n\376\370aoHH\313\315\3046:'\006y=\302\022\203Vb|]\300\203\205z\332\236\214\021D\201\013+\213\354. "
+	.ascii	"\016#\005}\354\337\202\205\246\032fx3\202l:\323'\333\372\344"
+	.ascii	"\006\036\325\016\355l\272\256\215\210\220\336\350\023\026\036"
+	.text
+	.section	.gnu.lto_dyad_end.part.0.165.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`)\001e\r"
+	.string	"V\030WC"
+	.string	"q\225\0160D\375\310P\302;~/0<\223G\351\321\220\246i\324\223\021\327\227\223\n\252\022\322\037\rh\r\201\265)\314G\023\200\316\310\345\211"
+	.string	"U\351\336\0161<\220R\307\030\206\337@\255\221\275\267L)C"
+	.string	"@"
+	.string	"E"
+	.string	".s6\214\203\337n:^p\bi\354\256\366\031E\234\373\224Q3\316G}*\253{]^\272\327\243\024\360\235\304\310t+\251\215lh=v\365\320\251T\t<\253pv\327\026\020w\345\266!\330N`\337\013,H\330\276\177\342a\351 \276x(\260\335-\335\217\235l\f\306\252\007O\3770m\300\375\340\262\252\375\216{p\3770}\300\356\206\211\025\273 \203O#\260|\032\274&\373\264\274@\366i\277\204\355S\221\303\n\256\321"
+	.string	"\210\213\225\236\330\336\236\302\"\007>\033\303Q\2142$\273\353 DC\006\177\304\247o\312>5>vY\342\3110\361Hi\212F\016\307\354r\343\206-\325z\360\177E\275\007-v[)(\033b\006\241\316GD\032e\236\320\300\323)y4\013\240NH\223"
+	.string	"\252\240\361v\341#\322H\333&\3220\347\244\242\312q\002\320G?\004Q\320\263\374\360\234UD9\376\251\220\221\016r\301\355\320UX$"
+	.ascii	"I\004o\006\254Dk\300>\223\030  @\002\243\2443\017\"\310\264$"
+	.ascii	"\330\r#\t{~(\037s+='o\357\\a\001\324\027\"O\215=\226h\2543\321"
+	.ascii	"\017\363\204\253\230 \242\230\313\211ac\264\302\020\342\345'"
+	.ascii	"i\267\333N\3315 j/u\343\026\313cm<!\340\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\371\016\3056"
+	.string	"\212ZX\024@0bR\007v{\212*\251\246\272\377\362\317\330M\311')\200\220\034\001\243\320n\265\356T\033mk\267\022"
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.ascii	"\3160\200t\221\221\225UX\367\032\353\234bP\017V\r(6\361iK\031"
+	.ascii	"9\001,\0013\001S\372\336r\365\255GJ\337{\242\364\315g\253\357"
+	.ascii	"<\255\276\365\262\372\276\003\245\357=\254\276\371\236\364\215"
+	.ascii	"\207\356\333\216\223\276\357\270,\313{;\361\271o<N\355\233\216"
+	.ascii	"\313}\327\351}\323i\322\367\034&}\317-\351[NI\337qI\372\316n"
+	.ascii	"A\3227\\|\210\212\345H\337oF\372v+\3227\226H\337mC\372f\023\322"
+	.ascii	"\367Z\220\276\345l\3009A<@\372\216\343\376\350\373\352\243o5"
+	.ascii	"7\333\243S@\320\307\307\306\243O\330\321w\355\352\350;-G\324"
+	.ascii	"\020G\337h7\372\005\033}Z\243S\321\350SR\007\206W\335\202;\313"
+	.ascii	"lf\364\n\264U\347`dt\b\004bt\256\005F\227z_\364\250\233\315C"
+	.ascii	"\344\242Kp[t\0064\213\316\267\350\025\235g\251\350\273\220@\212"
+	.ascii	"\276\r\271(\240\303\023\360\360%,,c\242/(\321\245_XXXH\242;\030"
+	.ascii	"\321\235\270\210\316\024\242;]\020P\303\004\006\206\324Y\006"
+	.ascii	"3\222eY\376\320\021\360\264CbX\036z\223\333\241+p9<\r\177oN\313"
+	.ascii	"\033\n\f\0015\364\370\225\347Y^\263w\337;[\205K\211!\f\224\241"
+	.ascii	"7p\367\336I\301Z\356 \316\257\272Tz\343\314\267[\226D[[\351_"
+	.ascii	"\253\322Ca\2258!Y!\033\325\362\211\365\362\2134\337z^\320X\267"
+	.ascii	"[\322\363\371Hy\341\013\241X\261\336\310'\322S\344_q\267\314"
+	.ascii	"\311\334\306\"\377\245\333\220>\271M\322\310\232\273jm\203~\216"
+	.ascii	"\216o\334\3069\276\221\336r\216_\2549/\273K\353::>\221\346\233"
+	.ascii	"\217\334\233\261\275v\374w\263\035\237\323S\307\207\342?=\376"
+	.ascii	"\023\3775\273']E\343\033\255\305'\316G\305\347Z\376\344\242\346"
+	.ascii	"=\372\252}=zN\307\277\254Ok\3565z\351\013\357\363-\337xa\203"
+	.ascii	"f6\332\373Wi\357W\325\357Cq#Y\355\375\227\346/\3132u:|^\345\034"
+	.ascii	"K\231A/n\364\311k\322\272EZ\215\333)\376\257v\363\277\342Kj{"
+	.ascii	"uT\374\211_\234o1\244\305o\033U\373\036$\353[p\254oAb}\003\206"
+	.ascii	"\365=\310K\337\204\272\364]\210K\337u[\372\266\003\353\333\217"
+	.ascii	"\226\276\001e\351;\020K\337\177\276\372\366\363\352\273\317\225"
+	.ascii	"\276\373\254\364\255\355\352;O\225\276\003Q\351\373/\001\340"
+	.ascii	"o^\3676\035\374\311\031Y\325\032\347)88h\214\360\2775\337y]i"
+	.ascii	"\234\030\341\347\363\020~+%\3701 \341\1772\202?Y\345Ke\272\332"
+	.ascii	"4\241\217\2347\364\211\327)\364\211\325#\364\2113\022\364\337"
+	.ascii	"*\377Apg\004\243\240\317\255\334}\262'\257\331oP:\320\347\330"
+	.ascii	"\250i\324?Ea\t\374k\235bz^\345Lo\305]2|\177\314\226Ls\006\360"
+	.ascii	"y\315.k\271\364\274>>\177Q\030W\032\322\323\355#\204&\340\371"
+	.ascii	"Ps\3177\001o\325\024\360M5\347a\002\315pm\3477k\276@\316\037"
+	.ascii	"u\351|\245\225\357Eex\376l\254\223J\214ol\2739\277X\345\007\f"
+	.ascii	"Q\353\226N;\255\266\355~s\376k\345\274\216\2311q[\316\371\304"
+	.ascii	"*w\347\004\373\310\226\315\177\233\317\267\331\346\363+\347b"
+	.ascii	"\b\001\345v\\s\332\374&[\376f\335\231m7\346\013\2517\363m\\\271"
+	.ascii	"\202/?\352\224\371N3\267\320'"
+	.string	"K\246d~\322\274\231\217\274N\231_\264r)@X\2026\226\311\271\3520K\346\363-\347gm\272\3547\346Wq\013\3244\266\r\307|c\033/\302\203\307 }\360\340y\265\346{\221\331\0313\245\364\225\320I\254F\256E\266|\370%\205og\245\337c\346\333\317M\230\237R\372NZ\3513\253\374\030\310\007H)\375\244\225s40\207\260\266\236\224\256\r\254\220R\312\363\374\325lJ\007\237\2449\2004\260;H\272.\032\270\363\242O\254\302yF\237k\243\317\255v\242\317\263\321\257\212\306\r\276\211\346H\205|\177Kt]\374\317\035?\263\346\257\247\017\224\263c\374Iu3\376$\232\017\271j<\345\225\277\237A,\225m\027\177R\333\214\207^g\370 \267w1\340V\242\301\215\027\177q\346OXw\226\366\214\377\255\233\361\2774\037\232\265\241\355\267\370\371\325N\374\334\232\215\343%\006o5\266\\\360VI\n"
+	.string	"HQ\304\266\335\022\270J\004\337\271\234\360+\251B\341O\2425R\363\002t\211\316\232\360\027\321\362\006X`\274\002\300/\244\336\360\373\240\247\360\367\320\036\341\317q\345Gx\201Z\033\013\177\215\353\256\003\377\f\253*?p\325Zq\302\357\244\345{\020_!\256"
+	.string	"\3607\315<\351\217\236 \023\376\245\232O]\371\262\013\200\350\250Q\024\207\231\316\214\210\004\"\"\n\222\244\003\240\002\251\241)\316\001\021\200 \350\234\"\201\214\004\022\220\210Iz\250mY\220\272\225\026\217\220\2364\217\r\330\226~\020\036\r!\307\367\223\367\005\327\003\370\211\275\017\355H!>b\301\316\265\203\263\2259Ri;y\270\206X\222\324~xSl\"\352(\337\336\355|5/A\177\326\003x?\240\217\237\326\344\201\220\372\333H\252\346\250\272[\367C}5\370{\354\242\036V\033\222}\032`\210\251\200X:\006\246\241\275\227x]<s\223\311\332\367<p\204\315\037\327\357\314K\253\034\336f#\310\201X\3536\201\265y\312JU\327C\322KL\377f\227p\351\274L\311'p\351A*'\336\324\217&\310XZE[[\354\211\331\036V"
+	.string	"O\257\372\013\373W\272\246\252}^8L.\260\006\214\f\030\223{c\322oH\327\034\217\371\345v$\f\305.QNr\307\363\004*\375I\001X\276\024\rrl\265>\234\217\347s\177\236\207\363{?\316\307\363\271?\317\303\371\275\037\347\343\371x\003\367\366G\f\201%\363X\230\017\235\333'\303\250\300>"
+	.string	"0 .\t8\r\233Sl5\2478\3563j\260\004\r\201\031O\200Y\312!\255\301\320\b\307#\306\247sF\227\027\027\346\310PU(@W\330\r4p\341r5J\345!:\315\276\006\302J\356\313\245}Y\306'\225\241\300\026\001\371\313\360\317"
+	.ascii	"\340\212\273\262G\261\023\2316x\212\031\303\222%\013\2460\345"
+	.ascii	",\274\004\377\013\361\226\247,\217\361\325\021\366\244\367;\016"
+	.ascii	"\255\232\341\305\272\345\313\220\211\263\023\006{\355\3465\247"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.refs.692777edcab37674,"e",@progbits
+	.string	"(\265/\375 \3665\005"
+	.string	"\"O''\220)\031\016K\354N\330\377\377\377\377\377\377\211\203\275\326?\276\020j\253X\352&b\305\377\215\354\302M\221M\332\336R\246\177F\371\027\375-*\312\247\350O\224K\364#\312!\372\017|\207~C\237\241\277\320\237T\276\240\\R\376\224\017\224C\312\035\345\r~*\025\236\003\320v\320/\356\007OH\223\331cF\340\253\214\262\347\354`\017=\331M\267\243\233\351/\374\304\r\0327<\262)\353%k?\316\023\254\207\360\001\326\336\272Q+\305\027\305\023\363T\\\322\343iG\320\026@\377 \207~\214\001"
+	.ascii	"d\004E\n"
+	.text
+	.section	.gnu.lto_.decls.692777edcab37674,"e",@progbits
+	.string	"(\265/\375`\307\213U\035\002\272b\247\274T \016\241\235\306KI\016J\335\23469\317\344\202\026\354\005@\023\3343\273)\361\253\250%\315LI\213o\303\256\242\227\030\007\205d$\355\0206\341\265pvG\036$\003\372\253=\246\3471\343\324#\212\303\027\213\310\275=\214\236h\034\210\216\t\331r\357-\267\224)K\n\320\013"
+	.ascii	"\fO\372\330\233\347\222\220'}I\246\232\354\350\303|>\315\272"
+	.ascii	"1\234\237\257\364s\222\306\343\263\001\245\227\247\206)5\213"
+	.ascii	"\362p\223\235\032k78?\007\351\347\255\233X,\254\211\034\023;"
+	.ascii	"\025x5E\355\360\022\016+.\016\005\253\376\364\323:\272$*uH\004"
+	.ascii	"\223\320%!\332\360bq$\t\236c\200\017\301#8?\035\242\237\n\221"
+	.ascii	"3\322\f\242\212\243\2223\322\356\330<\373\214\340\"-3\354\234"
+	.ascii	"\370\341\374\364\207~*\245\177L\344\303\212\340\035\216\326\220"
+	.ascii	"\347\017#L>8?\341V\261$\266\273\267c8m\230\247\024\310\363\277"
+	.ascii	"m\3511\370\342\316\255\214\260E\024R\033[1\017\306V\303\031\257"
+	.ascii	"\361hB%\206\363\323%\215\206\265\260\331\b\235\346\005\230\030"
+	.ascii	"\336 L\b\241{o5|\206\323n\031F\373\257\035\356\201\206y\334\276"
+	.ascii	"KG\266\263\215B\0358\255\233\365\264\344M\347\037\37786;.K\177"
+	.ascii	"<\203\374\224\221\021\241tL\351\340\214\307\256V\f$78?\235\241"
+	.ascii	"\377\343 \267\f\013\021\202\273\260\230\r\273d\207\310\217\350"
+	.ascii	"\336\233C\b\353\337\021\224^\316?\376:\026\373\361\026\346\302"
+	.ascii	"@T\2266X\321\001\333k\2013vb\260[\366#8\354W\355\210\220\017"
+	.ascii	"\347\343%:\006G\326\037Y\261\027\314\361\327j(\370\202\f\347"
+	.ascii	"\026#Z\357\373\262\336}]V\354\003\346\370\207\313\332,rn\262"
+	.ascii	"\275wK\3126D\207\020g<D\343\315\246\177\274\003\363\334&VHG\262"
+	.ascii	"\324V\214\20409\301\272\201\227\360h\212\017\035D]C]EW\270I/"
+	.ascii	"Q\352\301\263:\037\266\001\353Q$G\025\313\323\263\007\217*\034"
+	.ascii	"J\302\220X\340|\217\264\320\255\001\335\341\214\204mDiIa*\034"
+	.ascii	"u\313\360\324\217o`(<\205}\316\347\003O\341\247?Yr\234;\350\346"
+	.ascii	"\345\320\201\213b=A\2545\235/\0073\354\264R5e\250\006\316\307"
+	.ascii	"\\\372\267\f71\261\254\325\210\003\303\0313\275Oe{H\245\204\310"
+	.ascii	"\274p>`[\264q\326\304cI\211\035[R\250\204i\344\276\236\251)8"
+	.ascii	"\343$\214\245\177|\204\215\254\220\260\300\031\323hw\360\361"
+	.ascii	"\335\340|\f\245}\316\347\001g\207\204\2162\350\336N\273\035\314"
+	.ascii	"\343\001g\207\204\027\032\224\353\305\331\217a`!\\\204e\340\030"
+	.ascii	"x\006\036\272e\230\350\307@\270\371C\206{n\240\007\234\035\022"
+	.ascii	"lf\320\275\235\230\b\007U\251\021\335\261\253v\351\212\234[("
+	.ascii	"D\232\020\\togK\213&\201w\031\362\261\217N\235\367e\035q]\326"
+	.ascii	"\343\035}|\243\177\007\365o\024\036\027-[1\236\250\234\\{\357"
+	.ascii	"\226\266mp\307\020\316\277P\375\343\026Xg)\207\332\035\316?\326"
+	.ascii	"\301,|\004\311\303\301\231C\b\2429\212p\276\t\377\265\2733+3"
+	.ascii	"{\203\273C\322\240vL\204\224\235A\275\300.\333\b\235fk\304\205"
+	.ascii	"\232\330\223?\313\274\240z\267/\005k\352\261\274\257\"K\3366"
+	.ascii	"B\247\251\201\232\2133\350\024l\203q.\3415\30478\347F\257\224"
+	.ascii	";x\017\361\276\202\267\354\026^(\277~\367/\247\310-\274F\256"
+	.ascii	"\222\021:\315V\356&\344]\265\021:\315V'\212\f\272\267\263\253"
+	.ascii	"\360F\271\201#t\232-\217\2135\350\336N\250W\030\336\237,9\031"
+	.ascii	"vN\224\231\325\375*\274M\376\274td\026\310+\203\356\275C\340"
+	.ascii	"\020\002\313\224\243\235/\017\201\200+\031\225\013\035\200\027"
+	.ascii	"\nv\366\214M\341\374\273\247\331}_\326C\223\350\337\"\372\367"
+	.ascii	"M\337\275\353\344\226\375y\371\336\3468\267\330\336\273\245\270"
+	.ascii	"#+\247\007\347\3371\r\303\336{\337?W\366\360\360\360"
+	.string	"\360\376\271\376:\365\257\226\376\305\322\277Q\372\327H\377\376\350\017\256\313\372\253\243\225\304\325\335$\227\356\226]%J\356\330\235\253b\333\333\251\304\315\005\032\224C\b!\264\250\351i\r\352\374\3379$\332F\331\220!\316\367H\312\267f5\210\363_\240\377\337\262+\347\334\034\356\317\025\0139\234\277\324%\f\031B\344>o\334-\273C\206\3505\027i\320\023\372\316\353\262\336\204\037\206\355\216]5\026\033\r{;I\261\355\355\374\r\013\362'K\2737\023\032\333\336\373\377m\273k\327\355\226]\266\377~]\34798\367F\333{\377r] W\354\262]!\177\246`\315\235sC\314\004\260\247\016Rt\357\035B\b\034B@A,\013H\347\337\262\253\366\337\255\313u\323\322\235\236\245M\266\267S\203\005x\030\355\341|\317.\332o\3325{\b\021Om\3026\327\336\373\246)`i\357\233\233\326B\270\367M\313\275\002\270W"
+	.string	"\371GS\016\2635\177\002\372\227\354"
+	.string	"\270\331\"N"
+	.string	"}"
+	.string	"\350o\240\317\242?\270/k~Y\217\365\335\367e\315p]\326\263]\227\365t\327e\275\363\276\254\372\272\254WKI\254\374k\220\n\200\t\254.\340\016\230&\002\001\376U\004\337p"
+	.string	"\025fZ0\001"
+	.string	"\030\370/\t\025^FP\317\207\342\277\251\016\344\177)V\307\377\201U'\370\325\252_}\341\377\024\252\377\266\354\b\376G[\200\362\300[\372\304r ubSHg\2508\362\234\022\033\201\377\207!XS\251\324\251_\225\372\325\033\377\325 \264\200\206\227\376\247\251O?.r\004\374\254\b\375_\215\355f\023n\253\274\006?\373\362\350\330\257r"
+	.string	"C\3400?\333\376)\f\377mU\017\234\375\327\302?\037\251+<\020W\345&U\205_\355@\306\361\347\252_\345\300\217[\374\352\006~l\201\037\223\370s\217\037C@MA\002*\211\037c\340\307\031\300\300\217\343\304~\314\001\365\002\330\250\bk\340\307\0278\b\030\350\307(\3108\b\376\365\217\004\006\200\256\377\025\004 |\356\304\177\345\300\334"
+	.string	"\324\004\3240\021aN\311Y\230y\013i\212U\211\340\275_\341\252\353\031\356\n\362\247((A\217?eIG\200\365\026\326\251\257\200\rp\225\177\265\361\253\026\370U\024\376T\205\347\177U\372\357\006\350.\t5\002\277\232\317\341_g\374\031\0061\370U\b\\\375\327\241?5\361\200\037\263\275\344\006d\236\037\233\251\016\370\323\021j\003R\0222P\031\360g\"\031\277:\342\277\031\270`zu\001\230/-\035\001\337\251'\374\227\304[\300\020H_\f\360\023\374\353\333\275R\256\t(T\021W;\374o\376\2064\016\324\004\250\207\300\277.\377T\001\277\252\200\037\207\251&h\220\312\250!\262\315\315g!\352|W\375\002\376u\355\317\027Pa\376\303\375\351"
+	.string	"\324\022>\344s\367\336\233\252$\374\231\003\277\n\342\317 \370\361\b\352\b_\341\033\376k\302K\220\002@M\300\237\206\200\023\240\022\200\204\325\210_RU"
+	.ascii	"\177Z\001\365\203\254B\r\300\257\002\340.\377\212\363\347\021"
+	.ascii	"\376\f\342W;\274\375\327\225\377\372\375*\207\377\376\375\367"
+	.ascii	"\311\2179\374\027\360\177\340\257n\240j\360_\273\377\036\371"
+	.ascii	"3\007\277\372\362_%\377%\362\343\r\376\313\344\317\035\374j\006"
+	.ascii	"\370\3767\311\217;\3748-\300\217\315T\027\016~\274\362\337\033"
+	.ascii	"?.\273\031\037\340\177\013Q\352\206\037kp\325;\340\317\"\250"
+	.ascii	"*\277\332\232\240\352?"
+	.string	"\227\370\263\211_es \016\361\026\324\013\340__\370?\367_\001\374W\204\377\026"
+	.string	"\001\367\303\177\023p]\0060\202\372\r~\265\353\377\224\377m\377\375\377\265\377D\376\213\377?\377\264K]\377'\371?\370\237\356\202\267\203\r\377\325\360_\r\376\353r9\200\375i\330\257\252\377\ro\276#\250\371\277\034\\\365#\374*\330\177\301T\204\350\275\377\013\377\233U\374\253\367-\344\300\0208x\b\377Z\202\013\"\311\205\231\360\317\203\377\335\340f\360\247mG\373o\007\005\370q"
+	.ascii	"~|\200\037\017\340\317\r\3701\bR^\202\377+\344\300\377r\200\r"
+	.ascii	"\360\002\374\253\206\037g\220\375\376\013\376\217\3767\337U}"
+	.ascii	"\361W\327\376\f\345O\3432\364\317}\251\335\237\371\376\313\302"
+	.ascii	"\217\273\262\223?\315\313{\177\326\3731V\256\313J\376t\360\317"
+	.ascii	"t\177J\370\347$\377m\341\317s\377m\357\301\2572\271$0_>r\022"
+	.ascii	"\234\357\031\3765\315\300\177\276K\342,\277\212\344O\333\262"
+	.ascii	"\334\217\243\331\310\1779\360\337\024\376\273\201\317d\"w\205"
+	.ascii	"k\370U)?\206R\314C\376\314\346\347\237\337\376\223`\346+\277"
+	.ascii	"\372\367g\266?\217\3759\310\237\265\376\\\365g\247?#\375Y\306"
+	.ascii	"\237_\374\331\346\3171\370\363\212?+\377l\342\317\307?\207\340"
+	.ascii	"\317\034\3703\006\376\354\200?\203\3703\002\376l\200?w\360\347"
+	.ascii	"\f\177\326\177J\370\247\201\177\252\367\247v\177\032\367\247"
+	.ascii	"n\177\032\366\247^\177\312\343Ou\374\251\325\237V\375)\325\237"
+	.ascii	"B\375\351\323\237:\375\251\322\237\322\370S\236?\315\371S\030"
+	.ascii	"\374i\f\177\212\201?\r\341O\017\360\2475\177\232\342O\223\177"
+	.ascii	"j\342O\221\177\352\302\237\242\340OK\360\247#\370S\020\374\351"
+	.ascii	"\007\376T\205?\335\300\237f\340OI\374\351\004\376\024\205?e\300"
+	.ascii	"\237\212\370S\022\376t\204?\025\341OA\370S\002\374\251\006\177"
+	.ascii	"\312\362\247\305?\325\177\272\376\370\345O\357\217\007\177,\370"
+	.ascii	"\343(?\366\373q\337\217\361~l\367\343\272\037\323\375x\356\307"
+	.ascii	"\035\3701\n\377A\370/\211\377\252\360_\016\376\233\200\377\346"
+	.ascii	"\037\027\371\257\3741\215\037\307\375\370\371\337\002\374\230"
+	.ascii	"\355\307i?>\373q\331\217\311~<\366\343\260\037w\375_\341\307"
+	.ascii	"[?\306\361c\255\037\357\3701\004~\\\374q\326\217s\374\270\352"
+	.ascii	"\307R?\216\372\017\370\177\346\177\013\377\371~\354\364\343\032"
+	.ascii	"?6\372o\373\343\242\037\303\370\261\n?\336\300\2179\360c\005"
+	.ascii	"\374\330\204\037\217\360?\355\307 \374\330\303\177\025~\334\301"
+	.ascii	"\177\263\376\033\202\377\202\340\277\036\370\357\n\377U\300\177"
+	.ascii	"M\370o\210\377\302\374\267\204\377\222\360\337\021\376\263\360"
+	.ascii	"_\365\277 \376\333\301\177\327\377M\377\345\376\2138<<<\3745"
+	.ascii	"\320\372[\022\360\227x\013y\177,\350pV\r\377\364Qh\004\327\367"
+	.ascii	"\277e\341\326\206\374\341\374\225)\255\016\252\203j\337\215$"
+	.ascii	"\035\270\350\212R`\240*\b\204+zU\220\2575,\004R\303Y\225r>\027"
+	.ascii	"6</V\204\242DQ\275\326f\373\223\227\007\335M\247\b_\311\201B"
+	.ascii	"U\277\273w\362\242:pZ\273\310\352\303\257B\271\352\247d)/\016"
+	.ascii	"\347\257p\345\300\233\303\371*\206y\317S\373\356\336{\027\355"
+	.ascii	"\024\357\207\016\234\226\312w\265/\027~\341\350\341|@\325\t\017"
+	.ascii	"Q4\210\223=\033]K;x\255\215\241\304NP\325S\361\273\273S\361\246"
+	.ascii	"\240T<\265.\253\312\f\347\253 \321\277Z\246\332\375y\233z\314"
+	.ascii	"E\022"
+	.string	"\350nn\021\256\202VW\207u88\267P1j\216M\204\253|i\225N\245\313\260q\370\214\254T\254\264*\247\312\251s8\324\3249\027\3448\317pV\217\244W>\207p*J\372W\215|\316\360jG\r\"W\213\374*\225\032\247J\305P\223\202\363\325\272/\253\n\007s\225\310\n\024\025\217\265\267\253C~\025N}\202%!\364\201\363\265\272/\253\006\327eU\335`\256\276\265 U\331\024\341\374\302v\265\255\350\242.\032\003gu\r\346*\033+U\243k\n\347\016\322~\313\3244\314\266\241\231\2012=\250JS\377\352\231\327\006C\242\346Y\366b\201\324$p\355\207eH`\235\017\265L%kB#+J\220\253d\277*D\035c1b\203\310\017\316w\351\276\254\031\210\301\\\rR<\223+\314\201\263\213\363*\220_\005S\303\326\265-.\0308\343\346}Y\007p]V\365\013\346\252S\325\323\373[\202\263"
+	.ascii	"\256\313\252v\221\025\0069\341\374b\241\376-S\271\324\255\034"
+	.ascii	"cJI~\\\335\032\f4\333\201\363\001\377\374\337\346\241\266-$="
+	.ascii	"\256\372\370\261\227\252%Wd\311 \316\217\336\2275\267\200\271"
+	.ascii	"\332\343\360\360-J\345\321\263\351\236\256\312\324+5\213\204"
+	.ascii	"s\333\260QMt\340\242\273\331\024\341W\261\256f5\331!\204\303"
+	.ascii	"Y\325\001s\025\253\006\016 7\234_\314\323\252\325Mk\225b\030"
+	.ascii	"\325\345\250\352kr#\304Y\255b\321\350\236\004\341\254R\301\\"
+	.ascii	"\305\241\227x\364h\302y\203)\251\024Q\272\364n@\251Q|4\274\244"
+	.ascii	"p\276\320\373\262\002\340\272\254\352\023\314\325\033,>l\220"
+	.ascii	"\252p\366@\265\241:\001F\003\273\232n\231\352\3649\242\032\f"
+	.ascii	"\242)\234a`\2566}\r\202\021a\252\261\356\030\nj\252IWk\374\252"
+	.ascii	"\222\272\224\366<\374\301\371\203}_\326\274\257\313\252\"\301"
+	.ascii	"\\M*\362\034\311\341\004\347\364\360H5\352\001\346\244\203U\243"
+	.ascii	"?\005Sid\033IzJ8s\270/\353\257\316P\213Z\264\3029&*\321\325\242"
+	.ascii	"\377\276\2512T\242\214`\265\341\234\367}Y\325!\230\253Dc1\212"
+	.ascii	"\224\340\034\0015\306\375l\334|\341\314\"\007G\205\241\006\251"
+	.ascii	">j\217\n\244\362\250.\324\027j\013UH\375Qu\324\235[\2466ol\324"
+	.ascii	"}hXH88%G\325f\312\223\241\250\261u\320c@I\236x\3101\262\024\017"
+	.ascii	"8;$z\030\355\2747V\025\227\337<\340\354\220\330A\205\227\217"
+	.ascii	"\254%a\221\373\220\344!^u\271\310Z`fr\326\343$'\341\203\222\353"
+	.ascii	"\006\331\366v\002\345({x07ARY\2508\352\316\207\352M.\314\204"
+	.ascii	"\3310OQsT\233\034\315\203\267,\013f\301\224'C9\032\261C\2535"
+	.ascii	"tQ\347\364\240\373\334\002o\344\300\fx[\350\310\361t\303\006"
+	.ascii	"\267\267\026q\313\232\312\177\331/\2335\235p\330\301;\034!\320"
+	.ascii	"'\304\034:1)\320'0;\326\n\361\223\347\322\023\237\223*\300%\257"
+	.ascii	"\314\227\235\260D\355\b\321i\221$9\211\352\345\335\301\031<\004"
+	.ascii	"\365\362P\340Ud\f\007G\234\217\026>\240\277\275\214\227\357T"
+	.ascii	"\346f\354\364 \006\035\005\301I\2078\257\214\262]^\242\323\250"
+	.ascii	"\222p\261\354\330Q\304*\273\235\225\035e%\231\256hs\303im\215"
+	.ascii	"\361\3044\245\004?\205F\362\\F\242\201t5\231\302`Gowk\324j\317"
+	.ascii	"&\313e#,X{B\320\324\261-\244\257\374\023\365\343I\216\313D\206"
+	.ascii	"\236\302\004\317\246\304x[u\320\234\204\345g\206\313\321\254"
+	.ascii	"\030m\231\212Ln\214\345KoGZv\313m\332n\312\332\234\363E\226\031"
+	.ascii	"\031\333\332=|\023\362Z\373\371\340\354sS\313i\353\035\223Ma"
+	.ascii	"Z\020\226\273\037TI8\337\204\260'a_S\354~\\5v\327\355\333\264"
+	.ascii	"\273*\374\342\312^#\204\366\335\211r5(\006\206\302U\324*\007"
+	.ascii	"\311\316#W\202\320\257\255T\210\320*\213e\263,$\227\345\263<"
+	.ascii	"\226\3112\332-\313Ar\217\337\"\031H\016\222yd"
+	.ascii	"\037T\253R\236\327\220\350\336N\226\0324j\300\330\220\323}_\326"
+	.ascii	"\027\315\364\213N\375b\226~\021*wa'\237\274\215\363\213I\372"
+	.ascii	"E\030\372\305\027\372DC\375g\037Y\353\3068\022\342\311Z\271\207"
+	.ascii	"J\017\264\2660\234O\004\324'\362\351?\357\300hE\2501\233\273"
+	.ascii	",,\242\016\272\263(V\317X\177\276\312:Z\232vO\250p\316\260\357"
+	.ascii	"\313\212s"
+	.string	"\300<[\361\360\\E\301\371Ve\034,\274`dIMe\252\233\226\0023\037\036:8\347\355\334\327e\315Q0\317RwQ\361\3023\362\3019\002\207\031\312\217H\252\t\347\233P#7y\300\331!\241\225d#\337\270e\371);\345\247\234\224\227\210M\202X\355\033\222\"Wk>Q\212\351?Q/vp>\261\206>\221\206\316J\367Z\033\232\202\363\211=\372\304\034\375g\244\037!\262\003\314\006\347?\037e\031Y'\377\260\250{\337l\261e\031i4\347\214\320i\226\340\t\0204\313H\361\322@\226v\357'/\266,#\325J\357R\260f\t\236\024\025\345\031\231F6\312DY\306U\3659(\013=\303x\206\221\207\364\336\333\306\271\201\330\034?:p\321]\324\374\360\347\030\317C\270\216)M-\360\177\213\002\267C?\234\337B\321\377\357\361\277\356\233\346\336[Hu\356&\216\312\372\337_\365\336\017\377\312M\357"
+	.ascii	"\376\347\275E\230\331\373fni\357}\243h\254\265\033#\234\377\177"
+	.ascii	"\260U\272\275s\230l$\300\024\224\303$cG\214)H\303\216\030\323"
+	.ascii	"\266\311\251\262\321\320\334L6;b{k\310\311\261Aa)hG\354fk\330"
+	.ascii	"\021\333A\233E]\320\335N&\233\235\263\2645\354\234}\263\305\226"
+	.ascii	"\202>\330\311a\n\332\021\273\t\322\260#\306\024\264\305\230v"
+	.ascii	"\206\235s\323t\221\263\233\032\266\030\023\224-\266\024\224a"
+	.ascii	"Gl)hG\214i\352B\271\250\362\023B\262d\303\307\005\333\311\331"
+	.ascii	"?>G7\315\ft;\316\245\335d\357K\246\263\233\233n\357\001\354}"
+	.ascii	"\264\324lr#\343\262\341\320\375\340\240\335,]\347\336\273\203"
+	.ascii	"\017N\323\322\316\241\263\271\233n'ki\357,\234\023\333g\357\275"
+	.ascii	"\025`\343\244\333Q\227\316\306\351h\367\350\354\315\301v\356"
+	.ascii	"\355\263\267\315\335t{o\233\2757\333<r\356M#\303\216\225\217"
+	.ascii	"\317\336E\034|\366\221M\233\316\336\230L\217-hG\254i\t\246M\210"
+	.ascii	"\230\325n\341\264\271;=K\333j7ajj1\033\260\335\263\367\276\177"
+	.ascii	"\332*\b\206\037\316\371'\373\330\020\204\356\355\314?\331E\356"
+	.ascii	"a\261qn\033c\224T\226\026Pn\336\262\374\2236\261s\357\034\226"
+	.ascii	"\307jGn\315o\303\364\237_<\367\374\271E\336\301=FEOp\316<0\317"
+	.ascii	"/p\016299\234W~\350C\357\313\312r]\326\267=\364S\263\037&\347"
+	.ascii	"\244\204\351a\352\264\272\300\030P\306\311,\362\315-\3139\331"
+	.ascii	"\306/\347\244\202\227{\201W\224s\362N\351V\220'\225U\224B\345"
+	.ascii	"\304O\347kA}\375D\377\251\341\323\303?\235\222\016\336\264\024"
+	.ascii	"xp#\367\3049-\204yjx\027%\276\")\234\017X\247Y\253\373\262>\360"
+	.ascii	"\272\254\327D\364\365\233\276\t~7\236@\001\323(\351_*\345\226"
+	.ascii	"\245\201XJ\016L\233\244y\251\323\252\345\301#\204\006\246z)4"
+	.ascii	"\005k\352\263\026\202\320\300\024J\212\204\345\306\271\2331\330"
+	.ascii	"I\253\200\344\351 \346k2}\375\365\344\226\245\320\264O,\205\246"
+	.ascii	"{)_T\321 \234\026\321\350\310\215\0269_\367p\262\022\207\244"
+	.ascii	"\355\r\347k\034\372\372I_#\345y\220\202\275A\033\267\327\025"
+	.ascii	"\005\347\353\030\372\272\251\377\247J\322\272\324.e\222.\271"
+	.ascii	"e\351\035\366{\312#\355\361\234\232\311\245HR'\233n\221\007\004"
+	.ascii	"\335"
+	.string	"\333i$\355*\202>\275K\347R\272\324\311\246y\242~\356R\2574.\005k\266gQ3\240\351]\352#\355\272td\373&\210\0010\240\0069\204p\006v(\244\222\223\260<rL\250p\276\316\321g\243\372HJW$G\013\347\263}\372\254\235>;$.\375J\237)X\263\025r\303\fZ\344\226\245q)\021\024\240RK9\237M\323\316\024\b^\231U:$\205K\337nY\372\314\316\275\321\304R\264\324\311\326\n\301#\203>\323\264\324\355\322\025\355\233\253\017R\242\203p\035B\b!\355!\312\361\321\251[[\n\366F\023B\003\262\003\347T-]\273e\036\244l\316\226\025C\037\206\2038\237\225\322\277\036\254\367\360z\260\236U\022\362\024\355\354\262\\!A\032\202s:\226\222\3352\020\322\262c\037\251\331\325\033\347v\356\355l\301S\205e@p\316p_\326\263D\372\027\2045=<\274 \254i\020\230\247B"
+	.ascii	"\220\366l\303\231\275.\353Y\036\235\002I\273\360\322\336h{\357"
+	.ascii	"\r\326\036O,\0358\247`0O\303\356\362\200)\247\0378\247\327e\375"
+	.ascii	"j\250\277\006\352\257Nt\372#\335\272e\037R.gK{\367\207D\206\363"
+	.ascii	"\327%\372\367\303\332\362a\375\372\324_\331\364\245\273/\253"
+	.ascii	"\207\353\262\376\351\216\243\345\001^\341\374$e\303\251I\212"
+	.ascii	"\251\206\324\222\222T\022\222\324T\232#\315J\261R\252\024G\032"
+	.ascii	"\225Z\245W\251\216\264*\275\221B\335\262T\352f\223\245GRFR\351"
+	.ascii	"\f\251\224'\375\001\362\203mog\b!\254\364\350\325\341\360\220"
+	.ascii	"\221`%\036pvH\\q\341:|\267&\267\323\034\303A|8\226$\020O)#\303"
+	.ascii	"q\370H\312\"u\021\344\310\t\206\372\340\341\2754\301\030i\221"
+	.ascii	"\007\234\035\022X\205\030\n\006\274tE\031v\316Y\024\333\336N"
+	.ascii	"\240\024\006\022\266\024)\255\221>\2456\322\244T)=J\231\322\246"
+	.ascii	"\324)]Jg\244F\267,\245A\226\322Hy\322\237\324y\265\267\223\321"
+	.ascii	"\007\254\350_Qtog\b\035B\320t\204J\232\036\210\266\222vd\020"
+	.ascii	"\3519\t*\021\245C,CuOQ\234\277\312\320_u\204\202Z\304\240\352"
+	.ascii	"\360\204\202\266\274\004i\004\245M6\217\t\336X\241\276\n\365"
+	.ascii	"\351i_\034\n\271\362\351I\213n@\301\352I_\250io\201w8_\265\323"
+	.ascii	"W\341t\b\202x\t\245;i\213\\\367&\230\226\266Hu\212 \335E\301"
+	.ascii	"\371\252\020}5K\253\250\355\220\362\224\342\2447,\222\033`o\351"
+	.ascii	"MjS\3241d"
+	.string	"\350\007J_-2,\324OpR\314\f\013/\023\037\324F!&Lwl\375q\341|\365\205~\236\"\030U\tB\363\361#\030\305>0\224\234\242XJ\221\207\006`X\237~\236\213\362\307\022\244\311\003\215\362\247}\200\272\324\376\260\037\313\302\016K\253M?;\003H\2058\277\203\227n\317Z3*:#Z8\277\303\016\375\0169\306\376\261\b4\371+\322z*d\272\301\371\035n\264?\332\037m\220\033\266\201\326g\231\327\020\255\253\264h\220V\354m\220'K\237RR \316-\2206\314\355\017\312\037\316-X\033\366U\366\304\271\t\215\026Rpn\273Z\347\214\034R\002\341\220\230\001\371j\275\210I5n\230\264\034\n\206\371\300\371\200-W\035\221$LM\365kp\313I\273\225}p\345\024%1\262z\253\303\252\325\272a\033\350\016\305\261I:\210z\274\325j\305~\230\200pny\250NtD\243\340\334\356\370"
+	.ascii	"\220\"t8\267Y\177\266E\232\204\2408\267X\177\002\327\247D\020"
+	.ascii	"\347\253\016\315\247\267P\355S\013\201\235\277\"-\235$G\327\026"
+	.ascii	"\216\267U\317\236\033I\222pn\251Xn\314\304\314pn\243\332)"
+	.ascii	"&fQO\234[\251t\214OL\t\347s\030\324\355\215@\245\2675Z\245\326"
+	.ascii	"\311h\347\257\210m\316\251!5\275u\372\271\254\312\230\340\334"
+	.ascii	"2\265KOf\2745\232\321\"=%\022\3455$\332\362\007\343\305_{\364"
+	.ascii	"\026\351\257\214\bG\366\221\342PR#\016\347\226F\235\317}Z\031"
+	.ascii	"\034\226\322%jD~\254L1\361\352i\211\336\312\260\221\343\f\212"
+	.ascii	"s;\364'\223g\337\025\316m\214V\210\bX\2218\234[\030\255\020\325"
+	.ascii	"\331\r\0348\267?\255\320\324\241^\337\013&d{Ao\233\202@\276\336"
+	.ascii	"\360\330\255\324\006\365pn\201z\304\020\002D\206\3639\310\265"
+	.ascii	"8oY\2648\355\213\030D\377\212V\264\016\207|\341\374\267<o_\374"
+	.ascii	"S7A_8\267.\376L\357\214\366n\340\334\356\374y\2733\"8\267-\376"
+	.ascii	"\204\332\0341\301\271\325\321XvXN2pns\330Z\233\326F\333\340\200"
+	.ascii	"\004\365GL\323\301FV\026\275\236\022\325\207\034\226l\374\036"
+	.ascii	"\320\343E\023\234\033\r=\"\206\327\207\2047jl,\016g]8\243\007"
+	.ascii	"\321\021B>1\233#\234\365\240\234\221':\234\317\241IkA\016G\320"
+	.ascii	"k?\250\016\364\321\344\257(:5\246\204\b\360:P\307I\224:\234u"
+	.ascii	"\024\375\007\205\303P^\236\356{\203*\022\336\361U\361]\367E\211"
+	.ascii	"\270h\340\254\235`'9<\374p\326{\177ri@\265\340\303Y\3535\227"
+	.ascii	"\\3Y\242\3618,\331@a@\221\037xnQ\261);R\356\256\361\256Z[Z\233"
+	.ascii	"\227\266\343\320\"\356\272H\234V\222\201\256s\027\355\025\251"
+	.ascii	"\374\360\213\002(w\255\344\232.\320\316\260\t\316:\t;\247R\035"
+	.ascii	"\021\262\300\371zn\205\fH\355\005\316\032\tk\244H$fg\210\263"
+	.ascii	">\302\036\271\351\211\022\303\371 \n\241\320`\340\254\215\\5"
+	.ascii	"\255\027f\177\207k\377\232\036\302a\311\306\357\203g\321\037"
+	.ascii	"\216\013\036E\372\355z\210~Fy\036\342\340\254\341\3165cK\321"
+	.ascii	"\332\355O\300(&5\234u\333\371R\037\032F\324p\326l\254\031\356"
+	.ascii	"\341\212\263\361+\273F+\323i7l\003\261QF\f\243\321\275s\364A"
+	.ascii	"\345\356G\331\225N\203{\332YC\202\263>\303mQ\032Bp\326f\033\234"
+	.ascii	"\351\256\353/\335\245\307R\273\263)xn\321\266\005\017\236\271"
+	.ascii	"\260\353\261k!!D\234O\371$D\b\316:\310o\324\237\220\035\234\257"
+	.ascii	"\305\332+'h\2068k \032\354|>n;\220p\326\316?YA\003\203:\322^"
+	.ascii	"@\254\256uX\351\255\033\266\201`~L\361c\t\2322\264\321\272\336"
+	.ascii	"\272\376\361\244)\344\b\347k\037:K\367p\333Q#\216\265\243\232"
+	.ascii	"\362C\363\320;V\255\032\\>\364\216\354\364<\313!\207\363\001"
+	.ascii	"5\226\335]S\316\371\372\260\234\270y\341\254\2576\350\231\372"
+	.ascii	"\247t\325\r\333@ 0\"\345\210\326\336E\037\3263#L@p\\W\365\244"
+	.ascii	"\375\345\341\254\251\376\034\002\024c\201\363\377d"
+	.string	"\362\371A\202\336\270\216\272\241m\334\260\r\344\001\250\277\"\255(Pu@8k(;\244k%$m\203\303\222\r\224\022\272\310\376\212\356\276\252^h\247k\033Y+H\326\030\316\272\251=r\252E\301Y/i&\0336G\2048\353\032\035T\324\214\324\324p\276\006O}@\025M\005H\223\350 \316:\251L\350:\206\2206\342\260d\343W\302\025\317\237W\224\005O\327\217\246qm\344\304\221$\tg=\343O\034\30101\234\265\f]t3\345\344\356O\016\215fE\365p\326C\232\310\031\344\304\204\351\270\252\240p>`\366\372\337\262\370\004I\355\300Y\303\320\300\206\346\271\376\321<\272\231\341\216>\264(\t#l\002]7\377\020\"@\300\221\2030\212\363\001A\020\253B\242\206\263\366a\361\230\310\205\341\254{T#\030{Y/\216\314\371\341|\r\224\3645\3601\274\336\206z\347E,iE2[\222t\217\320\206"
+	.ascii	"\336\\\357\\\267\b!\342|7\366\342p\3269\232\205\326\371\3335"
+	.ascii	"\017\212X\f\234\257\301\215\3765\316\337\256Zn.\262p\376\313"
+	.ascii	"\023\255m\316\307\205\243Tt\210\027=;%\312\022\252^)\221\220"
+	.ascii	"9#\203g\t\365\374lpp~1\207\227S\022\234YA8'g\371\234\260\201"
+	.ascii	"\231He\333dp\342\354\361Y\355\235\242\017-j_XM\240g\003\317\002"
+	.ascii	"\256h{U\1778\263Q\3309\f\034\245\025\376\021\373\376\254\320"
+	.ascii	"pf\375X#D8\247\231\016\234Y(\354\021\0352\350\032\316O@\361+"
+	.ascii	"\t\222\025\316\354\223\2536c(\tg\266\357\354\356l\223;VO\355"
+	.ascii	"\332\033\247\004'N\02360\312\r&yg\365\212;<\204\364`\361~\030"
+	.ascii	"\371\215\260v\271\305u\356\"\263=\374\302\314\311\220\334Y\273"
+	.ascii	"\263KB\210\370\223\210\004\252\351\004gV\t[\247\333\360~\250"
+	.ascii	"\341|6\tK\367\267\267\213\306\031\013\234\377\202\244\3319\326"
+	.ascii	"\210\323`\\\r\234Y$# M\251A\210\363\331#Pu8v\340\214\357\237"
+	.ascii	"\353\013\021\334\33188u\313\005\216\303\306\311\331IH\353\227"
+	.ascii	"\221%I\321\275\243\365\201\245\343\211K\2023;\344,\221\277U\351"
+	.ascii	"C\243\312\201\363_|4\373l\205Z\344`\303\371)P\023\0136\234\377"
+	.ascii	"\262#vV\210\030\353\226\336\261kF\360\334\242{\247\350C\021\354"
+	.ascii	"\005\230\222\264\263ng\333B\2108\237\026\217\273\033\234Y\266"
+	.ascii	"\263\024!q\203\342|V\215]\373[\"\226\r\261\0368?\203<\375\021"
+	.ascii	"t\030QP\020\316,\332\371p\026_\017\024\234\331\263?U\212\360"
+	.ascii	"\2427\314\346\232\226\340\340\314\216\261d\267\354rl\331\235"
+	.ascii	"-,n-\312\344p~\006u\372\367rk\f\356\345V6\210\234\363w\262a\034"
+	.ascii	"\226l\240\300\370\320\273+\212\356]\364A\r\2743\302\004\354l"
+	.ascii	"\330\263\305\310FPN\006^Z\353,\227\026\353\245\332\250l\233\260"
+	.ascii	"\r\264*\361,I\322\332;E\0370[\020(V\327Y\257>@\255\266A\366\307"
+	.ascii	"\331\255\277m\335\222l0\341\374\f\224\364\317\372\370[\326\354"
+	.ascii	"\316\310\n\347g@C?\203\241\254,\226\307\263\b3\005\trd\307Y\036"
+	.ascii	"\267/\347P\225Ye\240\243C\307\363\205\325\n\020-\301\"P+\253"
+	.ascii	"\325Gkh\305\363\006\210\206\363]\346\330*\266j\365\261\341M\220"
+	.ascii	"\311\f\320\252MJ\212\245\302KoN\240\\>\202\340`\247\316R\251"
+	.ascii	"8qOI.`,\024\013\265\372 \221\301[\222\026{L98\337\005K\263O\354"
+	.ascii	"\323\252\363Vd\304\fA\030M5j\260Nzo4\275U\343\313\250\351\254"
+	.ascii	"S\337J\035T\0207\234Y\246\033\250uC\220\316\005\006{\304\036"
+	.ascii	"\261Jz;Y\340\322\201\323ba\223\022\202\301&\235U\352c\331-x6"
+	.ascii	"\316,\022\tE>O.-\330\036\266\207\245\321\346ee\364\274Q\024\343"
+	.ascii	",\215\2633B\210x_\025\226R\r\234\317\312`\213\376V\377]\021Y"
+	.ascii	"\302\371.[\263C,\321\233\3163\007\316\307\033\246\200\240\262"
+	.ascii	"7#N\b\347\337j\220\252\ng\026\306\221\261'r8\263B\230''\351\316"
+	.ascii	"\013\347\003\262AA\332\344\002\331 \266\251\242\204\205\341\317"
+	.ascii	"\331&\353\303\002A\201\016\203~\376\266\310\346\004\305\302\371"
+	.ascii	"\033\362\3647\310\351oPcuX\035\226\247\r\207\016\\\024\2738\214"
+	.ascii	"\272\301\2728\313\323\307\306A\223\260\341\314\356\334\300\032"
+	.ascii	"\202MB\234\331\026\177R\0044\\\212\002a7\273\331\234\bD\323\265"
+	.ascii	"\276A\026\347l\316S\367\200\ra\2023{\303\332\360\030\034\\\r"
+	.ascii	"#\260"
+	.ascii	"\247\003\247%\265E"
+	.string	"T\003\347\325\360\2712\347%\345\002\347\225P*J\224U\020\256\253\020\332\342]e\021\211~\025\324\313!\003\013\347UJ\f\254\246\304p^\0031\217\n\224\013,\300\rG\332\317o\205\336\275}\254\f\237:\2078\177\303\316\336\336\nu\300\024\0358\255\250N]\325\372\344+\364}D\\\304\200\201\363\332w\003\233\206\177@p^\371\256\016-\240+\234W'\330\306\021 \2370>\"RMs8_\203\224\274<\016;\344T\240D\301\332\201\3635\354\341\341\345!\005`Qi8\263\263[\231|\260\243[G.\027N\021\027\223\033\2504\206\363\206\3635p\321\321\255u~%l\225\261sl{o8\257u\252\227\232$\244\307\232\027RQ\223\0268_C\016\375\365\310]\347\346\366t\340\242\032\216\344\344\326\"w\357-\256l\003(\205\007\347k\320!Bd-\202\367\336\333\212\215\333\312\241R\255\re\255q_\213\254"
+	.string	"\276\325\241\265\365\350\221K\203\002\007\267>Id\260%\245\003\027e9\214\323#z>\363\016\275\256+$mm\253\333\0079t[>\320]T\364a\005:\005\006\234\333\333T\370\240\fA\341\374\flZMm]\373`\357\255\263a\210\262\265\003\335EG\037Xj(\271s\303y]\303<\317\036\265\250\023\rM\257\310ff\343\n\347g\320af\246\3421"
+	.ascii	"M\007N\013\013\t \013\234\237\001J\310J&$\017\215\215\345\241"
+	.ascii	"=\026\253('\f\234\237AI?\003\320\326\032\266\265\212\001\371"
+	.ascii	"*\306\305\265\202\335\335|\262"
+	.string	"\347\374\n\366\324:Ju|8\257_7\220.Pi\016\347\325\353O=X\366e\207\363\332\365'+7\327\244T\250\337b\247{\364X}\330@)\001\213o\325\372\352\343\271\362gF\370\242\005\355\352j\335\301\027\325\201\323Z\263\276\356\220r\302\023\305y\305\272\201\352\017\262\277\0338\257:0\017\2230$h-_9r\344!\230\243\026\033\032\007\016\025O\357)'-\315\250u**\017II\345\241\273\233{\027=\240\213\314j\027\025}h\t,\024\223\303\371-,\364Y\376l\2547l\254:\353\372\264>\255:\332\206C\227T\321\007\242\324\024\213?9}\026\256\242U\251hmZ\231\2766\301\b\376\021\341\274\326\300YI\230\024\"\341\274.\315\230\261&\351\2469\244\257I}+\207Tq\2048\257G8\213(D\n\016!\234W\243\03382\224\340\274\3228\334\032}\2639b\271\322gQj\256D\315u\350"
+	.ascii	"{_\347\022Ps\0275?\254Ak\320:D\302\246E\341\032\343\353\320\263"
+	.ascii	"\004\r\037P8\2570V!\226\030\372,7\372k\317]\177~\336\306!\303"
+	.ascii	"~\021\345\304\n\252\337vq\316\3367\004Pm\2028\205\341\374\325"
+	.ascii	"\305]_\254/\336\306\301\271q\260y|:p\321\225:\215\t\300\202c"
+	.ascii	"+\211\n\347\235\035\025oo\305m\305YqV\235'd:pZ+\213\257:}8iI"
+	.ascii	"\310\025\316k\316\r$\302"
+	.string	"\b\334R\302\243\260p\265\301\213\263Z\367W\233K\370c\345\206\263z\250\006?\001\302\002\033H\341\002\013\b\241\327\032f\n\025\231#\262\206\245\206\231BF\2114\252\310(\221\306\022*\\@.\217.\254 \227G\027\214)T\274\020st\301\250B\n\306\026\031%\322\210\\q\\\032UH\301\250\262\254A\276PsDa\324\312\344\361D\214q\245Q\"g\222%\214l\b\226idefh\214E%\n\025341\306\032\0251\306\"r\306\205#s\205\221\245\204\n\027\23054'\226\306\226iT!\005#\361\205\030\232\031\243\3124*\340\204\022%h\214\306\226\211\\\226(AcdUH\301Xd\256\210A\312\320\304\030\265\n)\030W\2202I\026\030\211\314erf\245\204\n\027\214Kd\215\212\b\231c\n\243qE\312\320\2400\252\314\2442\211\2241\256 c\2223)\22654\027Xr\360\023 R\034Y"
+	.string	"\302h$\236"
+	.ascii	"c4\022\221\310\232\022H\346\021Y\023Sdghh(`T-\260\201\024.\220"
+	.ascii	"-\260\201\024.`T!\005\243\216a\"M\224PY&\322DqIl\201\205\016"
+	.ascii	"\250P\001\2431\003\031e\322\205\274\"\2215%TVf\n\032\"3\305O"
+	.ascii	"\200`\032kL$\227F#\313\314QiBF\211\\\346\032\346R/\331\0251\310"
+	.ascii	"\232\374\023 \2244I\3461\206f\306H\243\254\251A\032\215\031\220"
+	.ascii	"+hP\240@\242`\177\002\004\022E\222I\3022\206%\002b8\312\224`"
+	.ascii	"\"M\250\374\004\210\031\2462\246\204\212DqT\326 \221)\230H\023"
+	.ascii	"E\f|`\002\306\017\240\200\302\0044P\001\025X0\032Y\220(\216\312"
+	.ascii	"\027bh\226L\244\211\342O\200`\"\225I\022\216)j\216\035R\3200"
+	.ascii	"\225F&R\231l\231K%M\214z\002L\212#\013\226.h@\266 \2714\022\231"
+	.ascii	"3*\226\310\032\243\fr\251B\251\302\250\2549\262`\003\313\254"
+	.ascii	"92\227\033\226+\264\214\022i<\2560*\223\314\231\244\n\027\214"
+	.ascii	"\306\f?\001\202&)\303\\2"
+	.string	"\217(jhJ\254%\230\312dM\212UY\243\202\211\254\241Qjf\022\006d\376\t\020&\224\311\032\346rfF\205RI\243d\231Fd\013\222\313\225\211\\\242@\242X\177\002\204\fs\231T\252P\177\002\204\013\311\031\031\346R\003\026\320\324\234`\322(\331\022G\344LF\"kJd\026\n\274P@\003\263\206f\005$\363\310d\201\2114\261\022\303q\006\211\002M\007Z\226\310\230\230\343z\002\230\022\204@\201\372A\322\205\243q\3052\206e\006\023G\246\361\270\302h\\)\261\"\006\006\013\254\270\310\310\034\213K%M\222\031\203T*i*`B\231\224Q\"W`\246@\306\304\034\003\300\002\244\222yT\001\301\013\322\005\211\"\331\002\023iBI\223\\\326 C\300D\232hQ\262\200F\206\251\342\304\222\231T&[\215l\321\300A\004'\226*fJlPCSS\243rd\036Q@\316\310(\217':,[\310"
+	.string	"\271\244\231\211\331`ff\002\310\0254(\2205"
+	.string	"\220Q\036S\300\2004\306 WhX\036O\224"
+	.string	"\202YsL\001by<\241a\346\270\242\006\311T\246\360BL\222\251\341\205\230d\013\314\345q\246\006\211\"\331\302\0131\311\026\220\314\243L\n\025-&\224\311\027bhf(\240\244\351"
+	.ascii	"\023\2714v #s$\262\200\246\306D\f\315\314\314\021Y\243\262\242"
+	.ascii	"\026Y\220A.if*\220\001S\251\202\246\002\031\226*1\320\3240\227"
+	.ascii	"H\031\026f\022\0052\303\222e\205\r&\226\034\210I*\217)\\~\002"
+	.ascii	"\204\0132L\244\362\305\230<\352\344\261E\246\210\201\231<\026"
+	.ascii	"ghbh\23045)\214\311c\221iT\"g^\210\241Y\266J\344\f1yd\221(\216"
+	.ascii	"J%\215\362\030cL\036UhJ(\223522G\315\204\001\2514&\217\354O\200"
+	.ascii	"\2309\256`\306\250\250a.IX\"S\304\300l\300\314q\005\323\210D"
+	.ascii	"\221d\032\215:\006\2714\256`\256L\343RFI\023\203\\\252X\032\215"
+	.ascii	"+1\310\245\n\343\n&;\001fR\2314nxL\262\006\251D\232\320W\300"
+	.ascii	"\t#\2340\002\006\366#\032PB\003JX?\242\00100\r8\001F\377\004"
+	.ascii	"\230\264=2\2172\306\343\222=.13\351B\002\220&\21654\314\2451"
+	.ascii	"\303r\331\232P&ed\216)T\224&\2223G\343ri4\022"
+	.string	"\227\307e\252L.\211\314\032\232\024,\323\330.\327\032\031\231#M\r\262\005Fer\251\223\307e\3124\036\227\305\030f\222(\216%\212L\2432\3312khR\320\224P&Y@3SB\377\004\be\222\004&R\231d\"\225\0340\215#\230\312\244\nv\004\221i<\001\346\004\230\020&\2500\032\213*\214'(\223F#[##sl\231\306\020&0\225I\025Z&iD\246\240\211Y\032OP&\227+'$\217\313\374\023 D\204\200A\033U\230G\346QD\b\030\216+F\243\210\0200\0345\314\310\314\310(i\220J\032d\006e\262\345\004\345\t\312\0245G%\213\321\230\242\346\250\334"
+	.ascii	"C\n\030R\320,\223*F#\3152\231a\251\\*\213F\243R\205\261FF\346"
+	.ascii	"\370B\f\315\322hla\"Y`\241e\"\227F\231\022\353O\200`\306 g\220"
+	.ascii	"K\022\2261,IP\24141\002\f*\224\311\231\021\024p\202\361\204\021"
+	.ascii	"0\220\200\224Q1\023\243L\222P\263TA\202\b/,\217(\2142%\214\306"
+	.ascii	"v\311L\272`\\\312\224\320K\231\022\251L\t\030\216(T\246\022\271"
+	.ascii	"\002\251V`\345\205\230\243\01333\307\030\315T\"WX\200\370\023"
+	.ascii	"\310\026$\227\031\231\"\006f>2\2172*\324\345\212d\322\240@\326"
+	.ascii	"\254&\226(R&\fHeFqD\3260\221\314#s\251.M\034gJ\250L\344\0131"
+	.ascii	"4,\030e\2161\310\024eJ\274\020C\263\\\227Kd\215\214\314\221e"
+	.ascii	"\326\320\244\310L%\222\205V\006\271\"\211\214A~`\211d\306\340"
+	.ascii	"\302J\f\314\344\212$3f\002\314\345qF\205\251\202\006\211\"\311"
+	.ascii	"d7\240\2275H%\222\271L\316\264\312\344\f\361/\247I\201\254!\201"
+	.ascii	"ICSCB\261\346x\"&\037\006\246\002\037\200\240\003\030\3201 d"
+	.ascii	"\2161\310\220\240"
+	.string	"L\036Q\220\340Br&\203#\363(\223O0M(\2213k\f\314d\3141\3051F\327 K\224PA\001$3Y\303\202\342\377b\016\242\223\026\2413\275\252b\025Kc\035\f\342Z+\342h\331T\2124\271\361Q\244*N\001\332!\201Q\214zq\352O\203\024\245\230\250\371A\341<\342\276\254D 0/F\335\005w=\355HA\025o\254\340\330\334\320(\336(>\311\240#\304\302\031\255\016:\004\34789\342\334\b\235f\373\323\304\005}\203\373\263\211\314\252\230\263g\365W\004\025\344\361{B\204\262\204\206\341`\022:\342\222%[P\273\342\026\274~E#\242\337\222\031\177q\247\350T\004*\312(\306(\332(&\025\203\2120\212/\212B\305\031\305\245\342Q\221\251HT\374)\326(\366\024\213\212.\212CE\245\"\215\"R\321\247\310Sl\026\233nY\321\2505{\221EQ\207x8\005o\025\215\210} "
+	.ascii	"Az\033\274j;\304'\221\3635yE\371)B,$\214+B4\202\323\205\267\360"
+	.ascii	"\210zQV\251\031\037\207\324i\305\216-I\202\356\275\211I\354\210"
+	.ascii	"w#t\232m\213&\037\320\"N\037\3619\2045\003\362\005\355\002$F"
+	.ascii	"\201\364\330D\275\2464\271\200\356\355\274J#\204\210\242\021"
+	.ascii	"q\217\350$uZ\261Bp\224\240{\357\257\342\315U{b\365V4\"\022^5"
+	.ascii	"\0178;$t\024\022\337~U\210:V4*\266"
+	.string	"P\311.]\321\336A\037\370\230zb$\252\332QMy{@\276\007N\364\212\363\276\2547\356\272\254\367\200\211\276\007q\372\036\234\351{\320\245\357A\225\276\007K\372\036\b\351{\300B\337\203\240\276\207=}\017r\372\036\324\364O\214\022\245\350\2334\270$D)\304\300/\234\242 \234\357\001\210\276\207\037\372\036\260\364=L\351{h\322D(\222\247=\0268\337\203\221\276\007 }\0178\372\035D\321\277\332t\242\223\233\226\202\r`\310\3019\304\371\035\350\351\237\250G\314\273nXq\267\354}\304&\377\257\322\301\212\030\021\021\020\234\337A\022\375\016\212\020\231\240\235\375\310\301\371\035\254\351w0\246\177\342\022b]K`\022&Nb\035Q\211\0354mK\277\003\035\3726\347\210Hx|\210\360\210H\210G\326\222\236Cp~\007N\372\035\314\320?\321\310\031Z\322\035\017\316\357\340\205\276K\206\372\034H\321\327\352\272\254\347"
+	.string	"\212\276N\242\333*h\002\236<$m-\222\332c\207_\035\233\323\225\212b\301D\\S\207\330pj\241\326V\261\244A\021r5[\324\350\002\201\320\210gM(VW8;s"
+	.ascii	"\225\034\3760k\265\212K\224\342\242e+\230\016\362\303#\212L-"
+	.ascii	"\222\322\330#\2225\326\006Im$\215\r\n!\006\001\324kj\021vb\220"
+	.ascii	"\237\b\204(\266\223\303\224\205s\t\367e]\257\313J\004\20391\254"
+	.ascii	"IP\333\020\316\352uY\211_\304\257f\217\016\234\326\022/}\270"
+	.ascii	"\005\326\327\245\266\255\020F\211\nr\265/\260\227\335U\326\226"
+	.ascii	"\017\342\217u\210\206\334\017\035\242\217VF\232\223Cg\214\250"
+	.ascii	"\265\332\024\316\tI\351\241\342\345\262\031PM<t\337Z\226Z\332"
+	.ascii	"\016 y\210\240QX\326\272\003\357\205\335\025\326\312dNN\320M"
+	.ascii	"\207\036\373\331\032|\272Z\233\312\262\234E,Ex\206P\2109t\232"
+	.ascii	"\336\337\031N\225\036\342\264a\203H\325$8u\"\025T\230\221\032"
+	.ascii	"8\023\245p\326\331\025\223\0268\023\243\016\307\302h\2723\202"
+	.ascii	"3\021\352pXf\205\2028\023o\020\2378\210#6\021\233V\303v7\257"
+	.ascii	"v8\350\322?\221i\325i\261\224\220\274\325X\305\360\2167!5\226"
+	.ascii	"t`\032u\b\367gdDL\312q\204\210tb\322\t3Z\020\301\231xt\003\177"
+	.ascii	"\243\017\217\003*\375\023i\350\252\017\300q\341\230\221B\315"
+	.ascii	"\214d\2619O\320\343Q\223\241\233*\270f\030\021\245q!\002on\f"
+	.ascii	"i#\"\021\013)N1\264\r,\325\204\356\307\317\017Q\250E\300T\216"
+	.ascii	")\321]\024\343\303O\f:Q\210\330$\313\003\374\302\371\200\304"
+	.ascii	"&\024Y\264\017\023\201.\223R\217\024\316\357\340\247\337\001"
+	.ascii	"O\377\304\236\023}\256\351B\210\370S\004X1|p&\276\320DK\242\300"
+	.ascii	"`\343Q}\25045\363l\270P\262\244\363\302\tqG\343\355\225\241&"
+	.ascii	"\237Ml\301z\325\3159\215\341\374\023u\3300\256\260\300$b\016"
+	.ascii	"1\207\365J\353\200D\377D\034\342\315J\235\223\033\223\366\360"
+	.ascii	"\304\233\237\270\2116t<x\334\341|w\356\313\252\341\272\254\367"
+	.ascii	"\013\346\355\341]\210j\320- Cu\356j\t5\365\n[\3025\b\207\235"
+	.ascii	"];\345-\341\257\212\265\203wh3\351\340|\213\356\313\332\n\302"
+	.ascii	"\274\235\322\226My\"\202\363\2066\252\267z\212\210\224\265Q\332"
+	.ascii	"(m q\357\247\005|\033\210\215\006\347\376\300:\264\351\277\375"
+	.ascii	"\313C\353S\006 \216%\017\353\024\333\017+\350[(g\227\344\331"
+	.ascii	"\354\370\341\3746\214\255A\225C\350\211j\265[\356\236\274\346"
+	.ascii	"\372X;4\256#*>/\"\225\341\213\"\255\023VoI\022\226\335\335\333"
+	.ascii	"\275\267z!D\374\331\"\214\215\bg\026\260\315S\223\232A@pn\361"
+	.ascii	"\332&-\223\020uZ\2058\267vm\030k\330b\t\337\0225\013\037\211"
+	.ascii	"\233\023\252c\003\211]5\254\242J\332$\305h\032\336\246c\t\327"
+	.ascii	"\0320\006\313\332\271\342\f%#|8\277C\231\376[$j_\017\"U[\355"
+	.ascii	"\021\326m\263\320}\035F\265r\252 \0235\2568\234\333\2704\006"
+	.ascii	"\207\207\207\207\204{\337\264q\2705\322\026y\033\367\026\266"
+	.ascii	"\211\326\316\315\232\377\226\210"
+	.string	"\272\227\260 \222\324\016\321;]B\206k8\267p\270}k\237o\341Z\267\207\020q\225\234\026.\357}s\257"
+	.string	"X\356\025\200\372\304q\003d\315\357"
+	.string	"\244\254\254e\013\242\261W\304\"'\350\267c\355-\333OG8\345\206\332\222\017\341\234Z\233\246\2669\275\260\303\031\215\2103\212d\250\324\204\315\325\206\n\215\222$\214\304\230c\2101DU\004\002\203\026"
+	.string	"084\036\220Ku\315v\007\024"
+	.string	"\021a\310\202^0\252\315\3438\210\0344\003"
+	.string	""
+	.string	"\204Q@"
+	.string	"\024\024\001\306a\005\354k\343oGQq\276\227E(\361 0nz\333\261\025\316j\250\201\253\334\365\243\026\344I\bZ\344\025Kg'\264"
+	.string	"\351\241[\270\301\272ka\002+\267zu\207\252\313\361P\002\321K\320\326,$Q\021/\376\355\0334\336\314\300y\252;\304$\364xg\007\374\360\314Z\316\215\037\226\372\253\265\340\"D\260\272\321\326o\247\272ea\020|_N\f\355-\275\312\270\262\232\202\263\314\36418\200\370\224\376\200\323\373\203\265\177\035\201\325\006\025\231\314\376>CLy]\342\323\310,\t\303\036\264\030\362\263\272\210\037\007\027\361\266UXkS\034\325\326-h\254\351\245F\234~\370|`\024\222\365\020\275B/bTg4\301BR>\004\0245\022\273\2401\366\t\r'\215Y^@E\020\366\266=\372\300\373\241\256)\272\034\303\365=)\322`\234\276)\212=\303\253\360 \026\212`_\216\260\241\303u\344J\3433irt-1\223W\230[C\237\3556i\277\242(D"
+	.ascii	"\353\257\201\321\257\303\253Hr\202\335\027\334\244\301r k\260"
+	.ascii	"\335\351\246\252\201\370\037\367\342B\032YjV\266K\311\244\302"
+	.ascii	"\236/d/mp\221Q\033T|S\2368c\351\027\261\2407\256@]\202\f\032"
+	.ascii	"e\202\267\n\351A{\3711\240\n\222\200\361\262\035\017\215]N\364"
+	.ascii	"xj\245\334'\353\032\300|\347@\251\245\202W\244t\002\207Ls\320"
+	.ascii	"fdO\020\017\344\230\302wY\274\024\fP91&\360h\322\202J&\337\340"
+	.ascii	"]\216|J\r\213CI\020\354G,\003`-\2628pe\372Ww\275 c\304J+\373"
+	.ascii	"\024\261\037\341\t\235\337z/\250\301j\226\003\222\224\277\365"
+	.ascii	"\372\257v\251H\231\3532\322\373\222S\024\023\361\363\204\253"
+	.ascii	"\rq2E\340\301\303\036\272\333\263\022\242,\243"
+	.string	"\235\021\371F\030\222\265\210WS+\245\f\364r\037\260\240um*Qz\370`PgC\340\300\3766\023f\003\357\357fw\232\233\307!\344\366Y\033<w\2409\005\001Hgg\006\351\3045\320!\322\277\037\205\3300\021\243\240\206g|;&\271\022fH\262\257\236\231a\267\375\031!\334\305?\2320\311$7n\b\361f\271@\317\330u<\t\225$/LAG{I\003\366=h\f\004\252\\\277\316\036\005\004\270p|TO/t9\207p\n\336\204u\017\257T\242\316\344W<7\225s*\373\255\277\"\357n\261c\312\216\316\032\023\356*'@\036\n\t\233\350\300\f$\002\206x%F[@k\221>}p&8\313\276\336\007\227FZ8\342\322\367$\270\242\025\2452:\0300\271\365\257\266\213\261\274\210#|\206g\332\377V\322\365b\330\375\205\212\363R|\232\020\213\264m\246\362\374\240\357\234\372gs\230\356h"
+	.string	"\235\272\360s\345\034\004\037$R\266\371\340\350\305nI\272\351lQ9\351\003Z\326\305\225\353]LA\327'\261\201H0|\321\226\007w.C\331|\317\203+\357\025\335'&\350\346\367\023OR\251\327a\260\220\310b\212X\330\355d\255F!\217)1\220\024w\f-7\205\374\322\255\f\305\302\276\0050\232%\373F\006\220\302D\017\321\202\366\210\377U\226\001{\220:\303UoY\262_J\031\367\341\341W*{l\372\013\374\003\326@\001\346@\224v|\265\343\261\204\356\\\177\004\362\224A\271\033\363C\247_\237L\277B\233Y\207\334\271\213\005\324\032)u\205\204\204\335&"
+	.string	"\304\243Vk`5S\325?\246\027E){2W<;\354\013\277\370T'^\2559u\022\303\331\177W\207\367\231\324\225[\322\212\201h\003\332\3769\257\300\333\001\036\351\373\301\255\0366\363\241\314hFT\267@.\244^\310\305\030\241F\203\324\310\235\376Y\325zV\273O\030\362\213\b\327WH\222\200H\276\212\272\033@\207\213\372{\320\344\346Xgge\"\212\r\332`(v\310\207\333\356\277\246\347\334\341i\234\211\327"
+	.ascii	"\247b\205\237R7I`\252\305\255\030\322\032\231pB\2702\204%\373"
+	.ascii	"\253\002\305&\027\232\240t\026\032\203J\361q\024O\013}\240F\030"
+	.ascii	"\260{Z:<5\272y\251\2458`\361\210; c\t*Oy\256\300{\034\013\303"
+	.ascii	"\352N\205k\035\356\230\n\244Z\034\340\027\"\223,\376\300\202"
+	.ascii	"\254\377\370\353 x\332\025Z\034<\377E\206\202}\330E\253&.GE\220"
+	.ascii	"2\037\257Sh\3450\341\236\302\325o\024&DP\274\237\337\266B\363"
+	.ascii	"\025\267$\306>\241\004\026L+\032\325\030\254F'\267\357\f6\316"
+	.ascii	"I\247\252\2123\rg c\363M\344\017\270\351X\321X\330Xq\376\275"
+	.ascii	"\007\233\347\377zb\355\301o\214,\017\246.\020*\241\212E\277\350"
+	.ascii	"\257Thzh\305\332\371\330\315A\275\226WT\b\003\316?U3r\262Tr:"
+	.ascii	"JZ1\003\032J\317\361\234m|a\230\b\232\332]\022\210\254~\3019"
+	.ascii	"\375\237\271\365\311\307nM\221h\323\350\013\003\234Y\342\226"
+	.ascii	"\001\320-\225rJ\"\257\323\\68i\036\256\261\007\201\n\305\310"
+	.ascii	"n\254\027\306\271r\2460\22566\300\374N\334\020\235Z\305\0052"
+	.ascii	"\356\205?-\365\242\027\032\374\200m\236\242\035\006jK\034H\241"
+	.ascii	"\302\213\021\255\251~\251s\313\b\341\204\306\237\224Q\303'\214"
+	.ascii	"\237\fIpzY\375\006\3226#\342\356D~\311\223\250i\225\210H0\034"
+	.ascii	"b\207@*\013\004\201\345\254\257\211\275\273&\222<1\366\235%/"
+	.ascii	"\230\313\023\362\005X\237\343\223_$\345\344\356\004R\003@,\035"
+	.ascii	"!\267\341\3673\035=\270\272\227\231\375\375\247s\032\351\215"
+	.ascii	"\332\221\302\274\200\toZ\002\271"
+	.string	"G\007\340e\216\316\f\346?]\322\300]\233\016\027\221\027P\304&\367\331\300\021\365f\033g\362\001\025\361\001\232\274\374\363B\001\203\260\346q}'y\212YO\245\201\007\264\231\376\222\375\213~\357\220\026r\271E\267\013FR\364|\341\006\340X\221\232\r\325t\351\001\240\314\250\032`\351pO\n\222c\025q\262C\315\371\332\302(\271\367\365\\|\275c6\221d\277\352Le\b\t\367\021\213Z(\374T\035\265\333X\n\252hq\220\003d\340\250HahA\025^\310|QS\007\371V\207\377\2015V1\246\246\346j\n\251 \245\374\314f&\"\256\323\336\231\201Y\256\376\233\251\264\262\370\234\013\275g^\321\th\203|\241\3354\002(\026\013W8GDH,\250\024\r\246x\017\2237`\237r\207\350\fC\240\237zv-&\\\203\3532\017\300j\341\3321e\005#\303/\212_X\332D\314\252R{<\306\013H"
+	.ascii	"N\226J\217\305\373\343QD\313\210\257\002\375\213\325\323\007"
+	.ascii	"\206\202|p\242$\305\034\273p.\374 \306\365\016\t\244\307\261"
+	.ascii	"[\253b\007\025\200g\357,\202]\376\025\004\344E\035\342:\006Z"
+	.ascii	"\037\001\234OqAu&\246M\001K\313\307\240\274c\b\024\250\225\331"
+	.ascii	"\003%l\322\302'I\033~8\004\0211\276d\346O"
+	.ascii	"G\3227\202\221'\310\300c\nPbF\305\211\202qe~v%K\020\342'\215"
+	.ascii	"4kP\017\302\006P\313\b`\377\f\356\002\362\016\355\204`\024\232"
+	.ascii	"\217\227W\313\2463\241\2771S\330\2261b\234\224\203\316Ng\313"
+	.ascii	"\350\\ly\241\317\203\300R*\007\267\317\3459\274'\240\224\240"
+	.ascii	"\255q\335\300T\r&\340-\267\354:\270b\300[\024\301\270\037\203"
+	.ascii	"\253T\n\205\352\370\322\001\223\025\027\267\223J\273\001\205"
+	.ascii	"\t\223\344p\020\351\034\374\331\204\302\253@\257\311yf))\240"
+	.ascii	"\351\315QGy\257\2249\214N\304\215K\333\241P\030Z[\361\305U\324"
+	.ascii	"\030\n\353\276C\301\360\234S%\273;&\260\342b\237j\321\275=8\251"
+	.ascii	"\177\200\025X\2716\230\372@\200\320\261--\223Z\357\324\227&J"
+	.ascii	"k\242J\234\021\342Pt\356\325r\247\364\256\003\267bl\371\325Z"
+	.ascii	"X3d8:R!\202m\347g\022,\232\242bK\025\364\365\337ZZ\216\215\271"
+	.ascii	"\233\003\247\266\r\321\346\215\236\216\225\030\032\304\344\322"
+	.ascii	"3H\240GB\271&\341\223\335\244\240\254\225M\bs\206\235\216\036"
+	.ascii	"\035g\304\340\352\317\262N%\211\030\230\201\243\266\025\003%"
+	.ascii	"\225\332\235\276l\231\363/6/1\300\200-\203V\352\315\300\005\314"
+	.ascii	"\312\254\355\026\307\327\360\232\t6N\366\252\317\0028\200I\261"
+	.ascii	"\021:\017F\273\r\206\342\302\320>\351\346\353\370\022&\001\204"
+	.ascii	"\243\244E\230\320\032\255\033\003M\355\335\370\200dY\374M\rA"
+	.ascii	"\241\311\300I\210\"\b\016.oz\001\370,\233b\241\354\241\252$t"
+	.ascii	"G\236<\002\024\006lF\214\362\261u\335;\375|\2417$a$F]\331\363"
+	.ascii	"\013\260\362/w\311\035\316>\023\354v\242\013\3765\371^\334\240"
+	.ascii	"x\"\357\241\300\230J\371.\227\030\310\311^\243\373%\346\250\374"
+	.ascii	"\241\037(\212\013\036G\342\220\225\260\370g\250!-2\020.\027`"
+	.ascii	"G\005\b4\226\227S\2652\367\246<+\352\214\361\253\016x\362\254"
+	.string	"\243+\001\210\265\205\276\343\204\240\rbIgGc]\243\t\362\274u\207{\"\273\244'.\205\n\336\374\271\351\263\352z\370\272\362\223\035M\302K\017\210w\276#\374d\031wD\303\300\215<\214\274\030bR\376\224\026\321qU\302&S1g\031\212k@\232\267B\360\027\242\322F\267\006\020\330`\320\355\315\271\255\r\275\376.A\247\361UmJ\3141\213\002\f;\371mw<\t\254I\255\332D3\317N\307N\244={\027&\034\306\224\222\376f\265\255\255kA>D\312H6\351g\312+\323\246 t\202\261\251\320W\354\r\224\271\232P?\207\265\200\207jQ~!wKIX`J\231@\350XbyXU\0222\236\235\321\201\304\364\321\0045\021\017\243Q\321\027_00\323\262\0054N5\036\254\356\t\365\337 Z\016\250\"\324\345K\351\2434(s\t\023\364\205\213: \224\023\225sN\373\332\357\234\315YF"
+	.string	"\211\253\0265\256\007\312$\232&\207\032s\202\351w\300p\246\273\274\317%\261\t\364>iSd\242\2539E\377\037\024\310\001H\331F\326\232\330~x\354\224e[\004\367KF\263y\023\024S\023\304\313S\3562qY\317\367R\370\375\217\304\353\nsv\365\037C\326cA7B\257 \301\027\327#\3608\313\277\325S5S\376\371\312\020\324-\370\260\236\002.*\\\240,\370\250\313 ~+z'\355l#\256|\276\0242\230\302p\215\202\323\313C\340\024\031\310\374\273\210\260\035P\371<\275O\266R\234+5 \3311\312\330S\034\333\031;\341\240\224\337\t\034\250\024\361#"
+	.string	"6\020\003\232\020\006XN\206\365\367\"\006\224\t\3768\334w\246I\n~\326\ng\211\005\305\252J\337\314GZ\231\by\201l\357\017\177\354\375\343\037wT\024E\257q,ZuF\n\313\302:\026\255\314\201\274\024\333\262\204\007M\\L\222$\"\271\361\252q\335+\256Y\301\264\220\004&\023F\341\330\262\2140qmp\262\024\211\266\262]>mua\311\b\300\275\021\244\022\317\362\224d\024K\203\217\201ed\210.\342\221\230eZ\005\366\025I\b\265Y\232\036\230\223\315\255\345\252H\224s"
+	.string	"\004\201\317\366>\233\020I\362(u.\352\034U\203\235x\223$\236\250@\001#\265\355\031(J\240=K\224$\342\302\202\240Z%\235\310"
+	.ascii	"\226@d\307mN\261\263D\327\0328\013\366hy(\250\357\222\020\321"
+	.ascii	"\350\006\320\0309\21727L> \033\030\337\375\324a\t"
+	.string	">\314/3\221e\r\264\202t\333\\\013\366\324$S4*\0010>\316\232**\202\334\246\226\035[A\320\207\275\313R\3108\321Q\032\250\201\\d\265\013\210\325\311\025DeT[\373f\266\027\016\007\342\230\337\350\205\357\203\362`Ry\2773\237\242Ic\334tz))\223,\024\236Mby\362\314f\"}\301,\247\262\235'\375\241C\324\302\272\237\ry\370V\346\334\004g\241)\272\256b\207J\350\317\376@\027\256:\016yH\310\2140\200\007\336\246W\242\222\305\334\336r|\007!\237\177\242\252VN\336\036\265}E_I\310\313\232\241\340D\036$Y\355\021\370\364\363\316B,\226\347\212H\237/`[\214\263\032\322\204x\224\352\032\232\213\207\253\264\351\352\365\333\022\021\023\375\354f\345)-t\037Q\262\221\204(\021\tC\266\2349\210\312A\272%\224\370n\233:\327\361\3471\005VP\336\210\t\220Ey\031)\251"
+	.string	"\267\b\334\026\200\022\027+\021\257\316\265\260\f\006\247\0170\3127C\242@\023\235\304\244\210\271\303s\266\252]XO\030v\301\252q\245\034\267\252\227\021;,\256z\247\027\b\214]\353\001\260\264\241\021/%\313\035v\"\024\271\3604\317\035bNx\336\217v\031H\244\265G\307Z\001\210u#\216\366R)Iw9E\241\304 \277\241R\206UQ\271X\b\025\260R\263\233$\266\037\315\026i\303\306\243\362N;\207\304\263\206\303`\274\033\250\261\353\004\016\003\200\030\266\037\212\345a\264\023\220\322\023\314g\334\252\024\250\211\254\314\361\243\210\210\034w\301\350H\264'\353\005\200\222\001V\255\326\3379w\377"
+	.string	"l~\215\252\t\360\310$\326\017\037\243NGTDD/\372\216\313\322\177\\k\277\370\321l\"\035\026\026\230\243\351\b\204:\220 y\013\311\232\265\376\326Qc\214\270\034\2558\343\r\201\304~}\320U\303\n\367f\n\357\325\001\227\202\003\306\351\004F\353'\233\326\357qKO\337c-BWo\213\221}6\0050\240q\215\230`\214\213"
+	.string	"\332\n\213\353\250z\022f j\001L\254\303\t\206\003\330!R;\006\365vq\326\264F\222\202\214\231\300F:\024\267vr\023\320\320{hx\001\277\361_\2740\222\240V\353\226s\313\367"
+	.ascii	"\374\213\276s\002\234^\203}M\300\023R_\305?h$\305\350\274X|\310"
+	.ascii	"\343s\222 \205\f\372W\305\303o.\177\261\264\t\0162\020\217\233"
+	.ascii	"R]\270\332\243ry\024~(\320\344\254\376\354\330\243\220\2701_"
+	.ascii	"\256\365\220\362(\221\003\222\005B`\\\240E\203\212\360\245\314"
+	.ascii	"@\310S\025@|\201\313w\036\243\004j\274\250\bk\007R^\016\333\321"
+	.ascii	"\350\037\346\355\321,Y~N\nd\310-:\275+I\300\005\347G\310;\224"
+	.ascii	"\375c\201\354<\311\342\234\003\365\240\365\207;U\342\362\027"
+	.ascii	"Y^\370E\375\312\"\035\315\024\311\214<B\356\0329\020c\353\344"
+	.ascii	"\336\306H\017\013m\251a\365\323\340\207\327M[\321\300)\300T\332"
+	.string	"Z\256\310\331\036\250\301QT\242 \2520\272\004\025\344\364\030\323\250{\244\377o5N\253\315ef\343\343\245,4\003f3\355o\0225ujRNtLX\304\031\370\\j\221\207A\322\007\307\007m\230;!.\351f\256\017_\344!P\025\350Y\322\230\305\265\253R\305q\333\274t\214gS\360S\343"
+	.string	"#\266\177\263\303\2141\341\320\360\261\246,v\375\3624\261}\246\206\f/)`\006!\020\020\327\251\004\232\235:\264\033\322=V[\217\301cB\022\373\"\210a:\265\030w\274_6Q>\373\257We\204\342\367w\247\276V\302\007\342=Y9TzE\316\272\332t\256\336\271N\\\324\016\223D\007Z!"
+	.string	"\016\035\240Y\225\312!*-\241\330q\232 \025\027\267\212\235\273i\371?p\264\2057\256\237\361R;l\t\0030\0012\006\"o9\215\357\273E\235w%\243j\351\340C\341\212K\257\267A|\023\312Q\212\207\3079y\323_\3022\222\350\330,\341W\232\213\366\343\030\303:)\213\222\260\273\321a\331\275\327\255{\3742wH\005\224\267\337P\266\347\2263tGf~\321\031]\313\355\222\177\274\267d\325\367\033\272>\027D\376`e`\356\316\377\032\265\366\306\253\371\351K\346\350\244\325\226w\364\t\262\217\021\323\225\375=\235\024r\006\213] \326\357\262]o\372%\371/\235\374\277\270Z\"\323\207x\273F\210\234Q]\375"
+	.string	"\320'\023@31IZ\\\263\275\360S\241|\233\211\325\224\332\316\200n<\261/\300|\336\377^\243\177\237\330\327)3\233\016\177\004\245?\312\364\341Q\371\252\324\237#\274\304d4}\234(\357\006\367\252\366\236%[\331Z\270)\366\301\343\362\201\234g\224\277\024\275b\375\3060\275\217?\236\337\343\364\032\307\257\305\242Y\030<\371\241\256q\377\220SAf"
+	.ascii	"\214\177\225\367\"\004\3757m\307\315\374\307[\347\241\253\364"
+	.ascii	"c\273?\213\254\345\t\346\002\312Y\021\333\257\250\255\211\377"
+	.ascii	"\2429\033\341my/\277\031\261:z\260~\263\355j\324/k\337aT\242"
+	.ascii	"\375\005F\316\225}e\351V>\331\022\305\352\330\331\367\033\233"
+	.ascii	"\346L\363\036\341\376\317\276\301x~\177\344\336|\276\343z}\334"
+	.ascii	"W\276\315\3418\303\024\026\374M\216\375\236\\\2538\375\343\361"
+	.ascii	"\020Dzli\225\206\300y\321x\262\243w\207\b\367\3721\b\271\213"
+	.ascii	"\346\306\007_\006\375\354W\3532\\\361\237\261g\237\323h\334\336"
+	.ascii	"n\377\037\272\223\021a\351\317\244\227\235}a\3139 \303G\314;"
+	.ascii	"\\\320O[\373+\243#\266\\0I\2370\224o\325\257\343\306+};h=\232"
+	.ascii	"\363c3\002'\\\334\303\350\374X\2566\022\033\257P\3540\3306\316"
+	.ascii	"\372E\2177\244\243^\221\346/\205\241K\362)\221\361\256t\216s"
+	.ascii	";\257{\003\b?\273v5\337\216\366\334\260\347\\8\237\024\3322\327"
+	.ascii	"\376p|\354\204\315\244\365)L\364s\223yI\013\002z\227\031\007"
+	.ascii	"'Q\375L\3163\244\306\035\220\\\334\357\233\333?\360\330\224\260"
+	.ascii	"\304G\347{\037Kca\306\365\004`r\307\365\322=\333\324\315\350"
+	.ascii	"t'\361\332\202\305{\377\321\230\225\327\364\375m/\361@T\237\266"
+	.ascii	"\020#\340>\020\003\366\375o\323\232\327!\270\201\234j\303\333"
+	.ascii	"\013\024\377\333\337[D\236\210b\263\240\177\336\252\373C\335"
+	.ascii	"|\236ks3\243\b\362\213v\341\317\031\377'\354\203\021\352?kB\317"
+	.ascii	"\337\243:\202\242w\340\177\f\351\035\272\257\363\351\f\224\037"
+	.ascii	"f\032\277\207\300\007G\353-\303\013\210w4?\316\023\345\306\361"
+	.ascii	"\003D\036&\t:\317<\037<\350\313IW\350\257\202\345\037\232]\317"
+	.ascii	"\342\340\220\023'\341\355g\271\333\244\233 \233\302\345\316."
+	.ascii	"a\020\223\321\263\376\314\347\276i\316G\211\375\326w\\\360\343"
+	.ascii	"0\266\257\213`\374\017\270_\223\273h\301\234k\037\343\021\340"
+	.ascii	"\024P6`\254\303\360A\255\017 \330\375a\341\001\310[lyI\317\256"
+	.ascii	"\r\356\202\3069\343\342\252\375\242\217X;OF\316\255\246G\r\370"
+	.ascii	"@>\375\256\323K\347)\370\177c\325dZ\203\021\345}}>\252\2713\335"
+	.ascii	"\237\313\223\215\\\350\031\267\307+g\263GG\005\356\177+cV\261"
+	.ascii	"+vFN\356L\237-5n\027\253\035i|\t\310\346\301N\326\276\275\272"
+	.ascii	"\024^9\224\243\372.\377\266^!\353\225#\264\271\224\214Gq\037"
+	.ascii	"?_\252Q\276D\357\204\265\336\001\267\363\306\203\307XU\252\037"
+	.ascii	"\337R\035\362\t\355N\233'x\363\b\335x\371\255\242\240\243\035"
+	.ascii	"m\305\256*\236\233\177\3308\261\255\323\335\177]\034\306y\232"
+	.ascii	"\316\326\3306\375\377pCW\304\302'\005\377\350\322G\300\177ar"
+	.ascii	"\254\345\003\241\307\310A\013YM\335\312yb?\345\346_-zV\300\307"
+	.ascii	"\332+=\235\253\327\370n\375\251\266\341\316\225\346\0253\006"
+	.ascii	"\310\231\244\035.@\326!\030\317\005\217\256\376p\270N\244\177"
+	.ascii	"\316{[\215W]\337\370\243\357\361\374\203.\f\336\3700=A\037\320"
+	.ascii	"\325U\024\266\375\001"
+	.text
+	.section	.gnu.lto_.symtab.692777edcab37674,"e",@progbits
+	.string	"dyad_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"dyad_getVersion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"dyad_getTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"dyad_getStreamCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"dyad_atPanic"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"dyad_removeListener"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"dyad_removeAllListeners"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"dyad_end"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"dyad_listen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"dyad_connect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"dyad_vwritef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"dyad_writef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"dyad_getState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"dyad_getAddress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"dyad_getPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"dyad_getBytesSent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"dyad_getBytesReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"dyad_getSocket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"inet_ntop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"getsockname"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"getpeername"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"gettimeofday"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\004"
+	.string	""
+	.string	"recv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"send"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\004"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\004"
+	.string	""
+	.string	"signal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"accept"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"getsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"select"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\004"
+	.string	""
+	.string	"freeaddrinfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"listen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\004"
+	.string	""
+	.string	"getaddrinfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\004"
+	.string	""
+	.string	"connect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"fgetc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.692777edcab37674,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
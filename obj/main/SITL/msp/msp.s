@@ -0,0 +1,5258 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\241\t\335\026"
+	.string	"&\034`H\300\224M\322\001\250\241\367\212\247\212\373\272~\254\255\375=H\207v\026\257e\365`v3;4u\340\177EQ\024EQ\032Y\266\3411y\243\365\361\221Lg\302O\264\314\374\204\"\243A>v4\001\036o\231$\273\265\226H\013Q"
+	.string	"E"
+	.string	"F"
+	.ascii	"\257&\320\362\200s\226Y\316\243t2Z\242\255\254\250l(\005\231"
+	.ascii	"\241\242r\336\251\232\200\270X\221\2022B\022\022\243\355\201"
+	.ascii	"\244\206\221\230r\\@\314Q\002\f\001\254\272'\2476)\352\334\244"
+	.ascii	"\307snno\257\233\373\341\366P\247\303I\311\322\206\262\241h\001"
+	.ascii	"\032\232g\270\327\354]si\306p/\300\341\231\251-\270\256\260k"
+	.ascii	"\n\273\236\260k\t\267\2063g\004\231;k\3261\307@\270\303\f\223"
+	.ascii	"\315\007\367\227_vpop\031\234Z\260\313]\301\360\004\267\214`"
+	.ascii	"\357\200\201\013\004\261v\342i\310\353\373\363\331\347\357\376"
+	.ascii	"\235\177\303\376^\277vi\016\"0\222xv\216\265\037<^\350\364\017"
+	.ascii	"\347=\367\334\272\363\334in\233\231m\302s\316\346\314}\247\265"
+	.ascii	"\216\207{\316\355p9\3448\375\346\274"
+	.string	"\331fC\006\333\346%\241x\242\021\033u\244i\307\221\020\f\232\030V\342\242\213X\034\323\r%\026A$ZCj\341\003h\304\252\210\203\211\226\344\207h\242g\317\226-{\366j\331\253\241\036;\217m#\324\024N\263\331\254\210\020AY\240\237eZ\020g'#\026I\241b\311\267\005\200\304\250\301\301\300\002\222\221\244\240 I\007\340\002\233\221\244y\022\300\343\020\220d\2101D\034\222\200\302\022\005)'\005\005Ism\304\257\361\031U\376{\034\266C\202\002\272\275=>\324\367\024\316\222\213\304dJH\t\351\"\341\256\023V\272\273\242\262\352I\331\345\374\033S\335\244\255\310vX\236%$\334\276\355{\365$\313\277\242\222b\204\323!Rr\016%*[\013\246\001\215\024\354\316r\r7\221'\325\335\274\222\207\333\263\345\327\177\300\004\275\242h\351 \bh\027\307\013\001\224P^\006\347\256\377\364\333\310\261u\204y\343\253l"
+	.string	"\356b,\035\201R\332\322\304(5\032\352} \004\021\354\325\235\250\302vfL(\360\231a\3615\327\303\220\343\221\242\006Y=u\221\b9Nu\203\256\210\016\337\026\037\321\310\t\022 \250\035o\250lp\001\2171O\333\034\375\377\030\226Yx(g):~\202\267>Mx\347!\373\354a.\031\316Q\016C\361\327',p\304^\177\266\334\245\351\302\277\235N\200a\206ml\305\265F\206\353\003\030\350\257\245\317\267h\2575C\b_\003\022\266\3065\370\025\371#\210\332\200_D}p\346\240y\201\251k"
+	.ascii	"O\371\\\037\246\337\370\324\222\277\336\373\242d\3379\031"
+	.text
+	.section	.gnu.lto_.ipa_sra.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\220\032\225\025"
+	.string	"\322K\033\033`U\223\0160\256$I\302d#}a\222$\t\203\364Y/Afo\255\334I\006{\357\341 \021il\200\251\214at[~O\344\342\367\336\277\375{\277\367\324(j[\336\t%j\006\210\210$\210\035j\232\267\332\366\357\267\367\336{\313\357\275\367\336\251O\205.\207P;\347L?`\211\234\365\255\355\336{\037\322LT\306\214\023\314\020\020\2019\250Af\352\241\005\0041\350P\215\036\022`q$D\242$Iq\024d\b!\206\031c\004\204\020\" \212\320\210\214\310l\332\0069\243\341\265\033"
+	.string	"fdA&\353b#kI\270<\337\313\267\022\321s:'~\360M\271\345\222 <\242\350\220\376(P\261\253\372\200\235\302\024\232|[\035l\330\\\200\273E\205D\\\334\227\001\342\026\007t\031\016\337\261\"!\255\207m\316\006\241\336\t\230\202Q\233\200\006\200Y\353\333\326\261\213_\202\t\\\331\314A5\240\271\354\334\3610\317_\\h]P\177"
+	.ascii	"\353`\007\232\321\244!\311\377z\301y\213\244\0024\323\236d\020"
+	.ascii	"[\2057\305\006DP\202\020\362$\246M\2038\032\251\274\204\223\234"
+	.ascii	"m\f8_\216{H\303*\253OQ\211\036\261+\213L\252,\033.\347\231\231"
+	.ascii	"\226\321\005e6f)L\313@\342QD0\237\"\343\216<\310\355\355HA0\026"
+	.ascii	"\227s\321~4v4?SAj\037J(H\323\346|\277r\3423\024\363\216T\300"
+	.ascii	"\345\007\001\0363.\032yc\373\340\250\343\274\357\017\250R\254"
+	.ascii	"\327\242\"\031\220\273\336\246\257\271\360\217\346\177^\022\034"
+	.ascii	"\032jO|\032\343\2677\240\341?5\252u\367#\262\264%\326\302\247"
+	.ascii	"\253\325kb\211~\313\303i\201V\325\273\nxS\276\023\372\216\336"
+	.ascii	"%\254=j\305j\250T=\035t\233A5/8V\360^\342\013\302\331\304\211"
+	.ascii	"\335\377\337\202\235\027[*`\265!b\355\323]\017\nYaY,[\030\337"
+	.ascii	"pR\243\232\277U5\273x\177\004\323\214\320\320\031\316W\336\036"
+	.ascii	"\244\225\022\244\304:\254\303\n\306\003\316\232h\353\211\374"
+	.ascii	"_Q\374\233\316Ip\251\225\304\260\334%|T\236\275=\212\214\375"
+	.ascii	"T\344\314\022\350\030\337\036c\350\202fC\223\030\354}&\216\211"
+	.ascii	"\207\f\034\201'y\t2\323*\002`\223\030\301<\252\021\312X\235\212"
+	.ascii	"e\022\271\320\302\321\313r\27284\377Jq\266\231\311\037\373\256"
+	.ascii	"#Y,\377\233\007`4w\264\217Y\221\003H\003\344\206i\020^\333tE"
+	.ascii	":\360\257\320\270\032,\366K\224`5(\205\262E|\343\354\030E5U_"
+	.ascii	"\377W=\310\037"
+	.text
+	.section	.gnu.lto_.inline.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\3430\335T"
+	.string	"\372Qt\021@P\246J:\323e\201}\017\250H\260\255\306\310&\033\025qlC\037ws\243\200\326\306\323"
+	.string	"@\004"
+	.string	"l>\220\355\rk\214\333\333(\262#\002\320\356\377w\365\301\300&&n\206mK \177o)S\375"
+	.string	"\376"
+	.ascii	"\034\001v\350\3109\234\353\035\315\363~W\027Wb\204\b\017\034"
+	.ascii	"4P\220\360`\2010\301\351\215F\353K\366\t\363\230\224\376#w:\322"
+	.ascii	"Z\024\256K\fX\003Z\006\247\020\023\020/pt\313\237\252\315\356"
+	.ascii	"\275H\375s\215\266s\257V\205\023\340j:y\361y\322\027\177\001"
+	.ascii	"\265\370\323d\3234M\333?\352\267\311\365\365\265\262\223\027"
+	.ascii	"[\376\235\274\372\347\375\207\364?\241\270\372\305\027\243\320"
+	.ascii	"\312\363Tw\271\351\rjzGQ\"wau\346k\024\020\363\346\275\331c\370"
+	.ascii	"\342}\361J\365\034\226/)\3033[\340\234\027\342;\r\222EeK\257"
+	.ascii	"\367JQ,_cA\354\315{\251:,o\221\021\003?\357\235\352)l\201p\302"
+	.ascii	"\027\357}\325e\361~#\373\336\353\243\374\263\356\275Z\177\322"
+	.ascii	"\377\247\346EfB\266\264\370\006bs5 \232\032\234F\225\366\317"
+	.ascii	"\234EW>\365\325\013\234mt]\227:/\352f\341\002\236\301M\255u\346"
+	.ascii	"gL\211\354\272E\205P\315R\315Q\315\215\005\206\237\372\252\362"
+	.ascii	"\037\366\303O\215\243&%\223\311\344\215\235\302\330<Z\256|\352"
+	.ascii	"\034\365\347>\f\325X4k\256\204\352+*<\333\240tU\342\314\270\213"
+	.ascii	"\t\305\261\367\324\366\326\312\037I\257U\323\251\355\255\t\370"
+	.ascii	"\t6\353\177f>j\376\311\365\236o\236\317\314\314\367|\026\317"
+	.ascii	"\305\313\314\327Zk\371<\317\223\371r}=\3223o\200}\302\2337\251"
+	.ascii	"\332no\r \361\366V\212\222!\252\273\017\316O\375\256\352-j|T"
+	.ascii	"\022\274\"{-\357\216]\323\0315|\265\363\301\207\246t{/T\3759"
+	.ascii	"F\206\350.\035\273N\017\334%q\236\212z\377h\023\273\345MS\356"
+	.ascii	"\n\232\031\205;E\237\fj\tS\022\273\303\0056<\263T\027a\273\373"
+	.ascii	"\263\364nc\313\3013\273\346\024M&\223[\345oE\003\371\354\261"
+	.ascii	"\251Q\210\377\001\375\361\323\207\317\036=\177~\001]\347\327"
+	.ascii	"\006Fx\354&S\336\200\231\361~\352W#\r\254\323\347v\336\234\352"
+	.ascii	"<s\024\315I\360\323\330M\276\336\f\231/\036i\034W\0220\341\227"
+	.ascii	"\341\253!+kH\224n\216\245\231\031B\312\343\007\350\020\005\037"
+	.ascii	"n\201\202/\370\316\244\234\3510\266\225Q\366\225L\013\216!\363"
+	.ascii	"H\207\bR\303G@mo\255l\001\232A%o\226\360\316\322\366\354xw\255"
+	.ascii	"tO\255\215\023\244\233\346\240)W\376U\224K\311\034\036\365B\360"
+	.ascii	"\263\036\237\341<\306c3l\307e\370\013w\351\273SgN\2344g\360\312"
+	.ascii	"\310\231 \361\241\303\206\n\023 8`pT\203\242\265y}\035\251\375"
+	.ascii	"o\205\321\377\244\262\331\274y\231b\322\240iE\206\254a\272\n"
+	.ascii	"b%\022\211?\222\021qI\257o\276\034`\026\033\311\210o\n\362+'"
+	.ascii	"\225?"
+	.string	"\217pUg\001\004TS\276\022_\211R=\310\312\223-}\242yO\244j%r\207\200\f_\317\342\261\313\b\335\241\r\371Zu\237\033\301@\036^\317\363\330K\320\336\226\324W{_\221\001\207Q\253=\262\343\356\275Fo{\003\361\001z\256\242n\212\326\304\220\376\3024Mkk\375/\370Ih\323\031\322\230\236\305\277k\321\330ddpP\370\265\357\253\024\rs\343\022\245\212\371\022\026\206(E\227\340\375\305\325\367\371>\221\364\007\220+f\001h\264\2205o\nu8+\r9\372/\243\231\336\2252\032\353\257\220\340\230\033\355%\226(\r\023\301\340\242\232\305\037\033\215\220\020&F\357\342\373\310\324\024dE\320\026R=2F3\267\021>6\326\247\232\007\363\245'\303Ym\345\261\257nt\266\242t\201x\272\034\334\311\332\"'\335\374\360b:R\265=5>%d\217\241b\366\245De\265\312\256\"D\376\207\210\240"
+	.string	"@\0230E}\037|\213\327[\276\367\314\314\326Zk\255\265\326Zk\255\265\366<O\341\273\233o\317\333\267H_/\237\247\032\211 \026#\303\250f\033\213R\245\311H\357\275|Bc\2035\250\362+\r\t\t\311H\n\222\202\244\003\322\n\020\220&Y\320I\b{\022@\342\034\006\2234\215)c\210!DDDD\002\021\021\021\021)H\222\244\003\033r\201\022Y\004\267\004\314\274]\rO\215\241\3424\177-\005\376%\334\236\271\0208\326\201\302y\262\304\234Pt\031\331:\251\016\256K\r\341\212\214\360\317\224\341\021Z<\223\026;\025\200\316\227\022\332*c\212}\376\340T\037\333\364\370\003]\310\274b \236\353\b\007\236\356\244P\032\342\024\303$\217\032\320\003\r\360\301\223\013\273`\307I\351\200\311/K\362\177\256\263\315V\030,\0202\335\223\026\300}\212\347\200\357b\264\270\304\301\0037\367\320\330g"
+	.string	"\314\001\256J\250\020U\002+\245z\301\344ny\031*\233<raF\003\257\370TJ\210\251q`\254\233\310$\310\247@{\022\025X\365*\314\316\3713\243N\314DR\016*\024\3351\334;3\226\214)\333\230'\207\302i\362!\264x\fY\315CoZ\211\264\263\340\227S\234g\262\021V\005\247\244%\242\313w\301\2423\352\030\257\364"
+	.string	"xo\007\317\034\234Dy\025\323#\251gN\225\017\032\327N\205\340\036\3528E_q\332T\376\265\306\264\212Q\221l\326%H\371\035\r\240\006Q$jz\234\20695\331\330a{\205\350\020\t\031\021\005p\362\360\300\r\362\320\326\232\352\342\033Z\310\306\220L\026\257\242\016\031@ \220\013\300\002S\200\356\201\020\3729`\230\033]`j\324\n\n\027\312u:\024Z`\302z\211\037\336\373\340}\236\306G\033O\264\330\221d\025\206\377\376r\017\365\r3\357g8n\215c\370S\211\034\237OK\005\210\345NP_be\341\234"
+	.ascii	"\2513\230\360\334\336\274#\357B)"
+	.string	"\2074\304g|\261\227f\032\004\201\241)j\260W#\034P\025\234\354{\311\200\201w\306c-\237\241\211\016\346Ew\323{\374f@\340\203; B\242j\207V\007~uPd\267@2?\276io%\r\0031pI\342\307\302wm\217\b\n\036\370`w\374\2719\224\351\004p\272c\236d\001[\264\346\334V/\002\201\017\374\335\367\t\354k\037\354}\225\0042q\017\324\217\337[\323_h\232\247\005\225G\230\r~\253k\t\366\036\002\200\362\256\247K&\313\344\257\211\350\020\275du\024\257V?In\005\204\3548\225G\221$\236D\013%\027\2650\217*\352;\211\203\2477-\030E\001\027\320\331&iZ\310\270Z\215\350\374}\325\250:xL\356M \300\002X\3223\004X\006\204\222\344,2o\374L1\231\212R&n5\"\331\260\303\307o\362\270o0\tC\037\311c\366#]'\210\005`\203N@S\313"
+	.ascii	"\352\350\275\023\250)\324<#z$\f\004a)\226:\013x\340Q\033\306"
+	.ascii	"WK!\234\245f\253\024D\005\234<\201\216\322J[\210\016\021C\332"
+	.ascii	"\035\336\367\276Ssd\215\020\300J\275\2522\350\315X|\241\337C"
+	.ascii	"\373p\306h\361\375\307\342B\024=\007\272.Z6\234\310\323\242\020"
+	.ascii	"3\220\2201\022\263%6j|\030\260\033:?\270\267\2575\025\206K\212"
+	.ascii	"+\203\021L\267\307)>\017\216\314\"LY\306\1774k\"\206#}\227\300"
+	.ascii	"A\363I"
+	.string	"\276\013C\267\033'z'%\005\317DS(\350m\205O\236\272\b\340\361.$\310~\020\347\020.o$\237M\373y\372\220E\244\352\020\221"
+	.string	",\313\b\026\354\276\374\254\002\004\r\311\206\330\004 F\"\363%L\324\265\366\2105C\022H\360\200\236L\311@\336y\351\016\316{\217k\255!\220xP@\342\221\343dse\021\247\236\030c\306\236'\247\206\332\243\314$\203\2040nE>^R\007gc\234\b\236?\274\347\326\"7]Z\031\323\003K\356bP\377\352\207iv\235;\022\032\025\214\252\001T;\346\027,\363&#\026\365\1773\fW\242\371\"\302\0178\311\037B\203Z\257\017I\331\013Pc\352\363\341\002\304\037\003\242\370\212a\200\207\246\346\310]\325\330\316p\233\206"
+	.string	"\244\037\203\223VpJ!W\226N\2321\274\374n\t\236<\005\326\251~@D\376wAn\263\322\b\323\031p\255\247\f\362|\227q\253!F\372_,\370f\003\325\305\224\nA\227Q\f\264-\254\304~\002=\214v \336\356'\371\037\253\341\247\301o\215\336\025\030S6_*D\rM$T l1\270\276\301\371\247\363R}@6\t\nE\231\373b\220 \200z\204\\TJ\302\361\022\027P\253\341\227\021z\373\360\333\343\207\223,\227\242\374\210TY\320\370P]\013\177rN\026!t\375\244\027-\316.x\034\201\343\255\n>\346\302I[Q.\250\233g\272\343}dj|IWJW_\315\324D\332#k\030Ulc\301\373S\036Y\214\333:d"
+	.string	"\354\n\265\270G"
+	.string	"\362\314\235\025G\241(8^V\nJ\031@\303>\254F\2570**\373\343\230),\372%\037i\230P@\334\227\305\217\222^\032Bg\006e\2257\340~\363:\213\344c\252\240\2722\364\354\275rl\200H5\302\024\344\374\322\002\375\340\004\326\250+\301\022J[\322\372x%{YybQT^fh\025\371\266\267<J\347\030\202*0\315>"
+	.string	"\207\204\242][\306\324\365\331\360\355\300\203\343\206;\231\201\223\256b$\363T\324\f\240@\265;\214\334\360c,\033\022%\212\270@\361"
+	.ascii	"KQf l\324\336\314\"\342\210\356>)\036\327\244p\316N\207\224D"
+	.ascii	"\375\r\bW/\344\205SA\267MluW\316\337\003\315=\363\221\210B\027"
+	.ascii	"\233\203G\364\032\361\360\347\334y\211\205\315\220\f(\3343\310"
+	.ascii	".\004\025\020\260g\267\224\t\313S\346\315DJ\311\376\304?Da\331"
+	.ascii	"\003\2749T\242[\321UK(\201\366\212Ar\254K\n\t\025\375\016\324"
+	.ascii	"\236 E\3408A\206\022#!\022\341I\216<=\330A\265\330p\326?\236"
+	.ascii	"S@I\354\337!u5]\313\374\204\246\270"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\346J]>"
+	.string	"\226\361\212@\320\332$\351"
+	.string	""
+	.string	"\016\252\207\250\365;\365\242Q\345\030\342\016!\240\026\007\314\322\214\202O\323\365heW3\371a\367<\240v\003\201\027\372\032\363n\340S\364w\320\f\021\221kF\246\265m\t\331I\006o"
+	.string	"x"
+	.string	"~"
+	.string	"\356t\210\375\3550''[LLR?\316i\272Wf;E\335\253\307\210@\324:y\216q\231\266\177\205#Q\346\275\262\367\216\3271\336*\350s\354\256\214\344WF\022/\320['\273N\342\255\037\n!\376\215\021\006\346\2351\363^\331\"E\356\225_\366\336}\327Z;il\035\266\240\336\202nw\255\371`K\330#?\350b~\326"
+	.string	"\315\026\002\222}\304\333W\362\004\232<\312I\n\316\227{\202\353Q\206\254<J\234\247!\230I\345\342E\005\003/\341.\226\275\377\357\277(O2>{\277\005on\333\242\354O\357\2757M\3706\255\214D\234\026e.J|\222y]\232%b\235d\267>\306\326\265VB\n\277\246@\201{e5\203\"\361\2105\"c{\247\265&\344!\025\215\036\243U\215\312\006^\342\320t\253\344!\326\002U\212\374*E\342\255> \373\312$"
+	.string	"e\357\025\207\263I\264\254m\022\033\242\225\225\007du;\020\354\275{\345{\356\007\035\006t\031\320i@W\302\232\351\313\377!\006m;`\373\013T$b\331\233\307\255QTN\316\314\f\362<\312\247\214\363$\224G\3312\003\343{\357u\271W:\313\262,\227\002\004\030\2304\316vQ\252\025,\252\026\354\231\231{\345\006d\257\330\376}\213r%\34377\r\215\320\340\202\202P\333Z\030{\320\261\257\020\"\313c\001\201,\02119\340\b\016\030$1}J\350~\320\375\376\033\205\277\224k-\325}\220\365\240\353Aw\340g\023n\373\033 a'\263\320Ts\257,3\301L \t\261\226eYW'\022\261\370HHCs\227$z\251P$\366\t\016\025\234\3104\227{\345\216\0032\246+!Z\017\036\246\204\241\022\016\363\350"
+	.string	"\331{\256@8O\013\316{\273\003\202\207\250\222\374\212\r\211$I\222\2151\302\t\020\004\203\231 h\235\273\033\022@\320(\004b1\220\243(\006\203(\310\020e\b!\304 \205\210!22\"E\243\346"
+	.string	"%Xs\332\233b\377wp\271\224\2508\261\236K\254\253\t\206E\004\027\202{F\240Qs\007\002\022\211\204-3\223\222\262\021u\210C\322\005\246cM\250\360\343\241\034\374\310\022\304'\353sn\277\330oq\305\320\205}\037\260\360^\257\325\247\330)Q\303\314qYC\362\016Q#\210\226\250\227\234\234i\264\216\270h\226\345\203\026\227\204\276d=\304\231\025u\207\030\243\244Z"
+	.ascii	"\017\021\314\006\214\026\204\300\210\367\256\016\213jx\363\013"
+	.ascii	"\377\247E\222\2423\213\031\267\224p \200^5\313\0346\3624!\313"
+	.ascii	"\007\313\235c\254"
+	.string	"\354\"y\301\232\210\215Nl\270\351\320E\303h7\020\217\025\306\353\242C\005\201\322}V\036\214\242\021\266\260\353\022\335\333\227\241\003\252\353\200x\306P\237\243\255,\242\365:\340n\200\241\311\201hpq{\023\367\004\b\n\362\332&2\003v\306\316c\356i\337;!\366\275u\226\213\022\350W\370=\303[\r\253\302\234Ub\321\026\026\333[\320-\2705=eyu\2407\3121W\215\310<\363I\372\265V.\337\005\300[\236\371,\224\3202\363\246\316\242?\330\013%}\247(\221\002\032#\365\236\r>&\306\366\334\377\023\\\230\036\2431\314V '\251\310\265CWG\200\272Q\265\240\202\201\243P>\265\"\216R\235\022\205\022\222\242\264&\335\243\322\260n\221\232\021\210 \020G\323\217\032\314\"\"^\211\305\030h\003aK\270T\367<A,\253\252\272\215\323s\360%\342m\375eL\240t\205\331\323\217n\266\350\020A"
+	.string	"\025\t]\371\003&\360\240\3225?\326\004\206!@l\3158r#Gi\215\361\213\330\333\252E\325\327\244l\324\200\203\343A\360\365\240\006\237\031\331=\224\314aQ\274\273(\243|[?\376\363\246\025!\006\360~\302I-K\177\024\002.?}\177gg|\240@\376\2008ZD\201g\227\300x\020Y\321\023p\334\245U\t\366\002\242i\006f !4A\346\342\321\245\003OrH4[uk\224\347\221\343\330\201-\244\263T\264\033\266'\354\253y\246\364\024\242T\234!\243>f\332\372ZN\f{#\f\304\325\007\304\230{\201C!\341\272\312\251\222\360W\306\034\266R\242\261^]\241\357\005$B\3148+|\307\270\020\005\nHp\222O\372\024Kx"
+	.string	"\307\202\002\005C\256\033\215\351/\210u\225w_I\037\226\0348\212\317\b\225\224\203\215\t\263qv,\214\002e3\266\340S\b\031\346\211\342\013\302\205\202\206\026j\211GT\204\250#t\007\371oy3\203\307c\306\b\341%\216\301y\002\201\247\222\222\363\252\225;\224\216\277Ka\343ur\247c\237Y\242O\325Ii[\301\037m#I\321\025\031\365Kh\350\267\362!\205\304\231h"
+	.string	"\351\234\325O\263\240\245\236\025\221\354w4\235\262\361\211\360\302GYy\274\335\003\215w\322\364 \352b\277X\\\373\016\314\230\365u\227\355O\340\220\001/l\367hv\030`q\367(\373\315\333(\004\205fl#\203\"\030\320<\245b\214;S\212\367\344\277b`\201`\346JG3:g\250"
+	.string	"j\270\001\275\036V\311\273\341o\005\2708\342\202\177\260QDM\267^++\363\363\330%\371F\016\315\304hO\006\216phHd\2043\230\370\357n\bv\355X\256+\027`\360\323{\001g\257\241\303\253D\363j\375&\214\273\324\333\026\303\315\003\226!F\200\"t\236%\302n\t\313d%4{\022t\354\205#\2618\007W_\316\345\367B\364\f\351<\f\005\243\212\333\301\351\020\326\374\251\236\322\361\007\336\354@\r\\\377S\234\001\326\002\022Q\027k\207'|\007\310\353\365\n+\267?\275^N\220\357\304\b?\314\221\316\035\026\203 0\3431 \022\307*K\215\345)\302M\316\tN8\022\034\231\343\335I\030\302\022\341\3023\235ydd\327\001\264\356\276\020\317<\234XW\021z\302\b\316\340\b\373\030\275\247|Y\004\352\013;\b\323g~B\333\357}"
+	.string	"\251\210\266ca\313\211\004gM\245\201\233\355\336\022#\270[-\327\360\303\022\005XU#\036\320\0040\211\276:H\376\216~\007\325Y\373+\212\271w\365\324\217)\240\2007\332\b\323-\020;\304\r\372C\366\312P\365\221\364Y8\020X\371\351\340$\244\\\324\302\216\271\342\233\004LA\336\314\233\375\022\207\256.\202\006h\235\332\025\363\037\004\022F\001_\242\2373\242N\340\001\013\271\314"
+	.string	"\374ROG\230@\326\0175\031F\304\177d\366$t\b"
+	.string	"Y\016p\256\007\242\237\263L\005'\022h\006\"\003P\337\321#\334r\236\231\021\322\n\230/\332\300\267\002\274\377CJ\022\374\236\235\036X\210\025 \033\036!J\326\330$f\220\272.\227\200\nQ\266\362%R\252\003\260\262\225\346\001-\024\200\301Yp\n\304\377~\202T\030Fxc\370S\006\rb\210R\250V:\276;^L\304\225\211p\f\224\013&\346\022xSd>\364I\"\226\207`\236i\026\3526\254]\235"
+	.ascii	"\013F(\302\033\370\335\261\304\326\374\003\243\366\fB\233>\004"
+	.ascii	"\025\311\b\344\037\026\f4$QFc\232\027V"
+	.ascii	"\220Z\260\001'"
+	.text
+	.section	.gnu.lto_.pureconst.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\271\004\022\231\004\023\231\004\024\271\004C\270\004E\232\005"
+	.ascii	"H\230\004I\232\004M\232\004N\232\004O\232\004R\231\004S\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\345\007"
+	.string	"\002\016*/`M\222\016@\321\301\020\004a\205(\242\250\212(\"\024#\330\341\r\017&\021\202n\001\001\20670\224\r\002\371\001\325\234\366\263k\2555\"e\nS\322\232bXG\r\321DI\316/\374O\367\241\221\277Q(GF\003\344\216\214\261c\222e\2147\347UF\241\314\257\004\214\013\213\212\227r^\332<\302\301\004\321\306GE\344\371`\036\314\357\030\224\005\177\273\n\212R\340IK9'\312\200\333\205\234\345\256\335e\353\254t\362\312%:)\345\224\316\210N\210\316\326\365C\347\244|\322))\227tV\345\016\205\376\376\032\340\201\247G$ `\202a\216\354)\030]\t\022\3555\336VE\027\217[\271\235\220a3\266`\344\005\214i[]\033\351\036\261\302\330\273G;_\3231_\205\331c+\023)\254\t6\035c\266\3704"
+	.ascii	"tq1P\2148PR@l\020\006\303\036\032\322\2178\200\""
+	.text
+	.section	.gnu.lto_.lto.c78e67b14e92a04f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspRebootFn.168.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\250\001\375\016"
+	.string	"V\232`F\360\2226\035\242\245/\314\327c\257\343\316\267\242\373\016\250\316\235LT\374\224\244i\002\243\001]\332\312\341\331|Y\030j\022\345C\351HY\3214\21030;\n?\023\207sa^o\177\241Vz/\f\233\320&[\246\024N"
+	.string	"J"
+	.string	"K"
+	.string	"\255\0138\254\335\335d\311\231\212\216i\331\274\244\212|\0026F8N\341w\214\001\351\332E\264\274<\323H\237\016v\200\241\313\257\333\374@\007\03079N\241\313%\313\b\373\224\240a\302\023Z\220\232\215\354\256\025\f[\356\220\333\326`\033d?\025\376\2043>V#\371\331\343\247R\306~\026\2434\302R\264U}\354\0368\260z4\320\331\335\320\372\261\251\211B!b\373j\277\346+DgQ\341\001vE\0313v\307\005F\240}z\374\007\373\324>"
+	.ascii	"\373\264\310V}$\261Y)j\242\271!O\376\213[\301\315\360afC\350"
+	.ascii	"\370;Vi/\200}j$\273\263\252Qa\037\307\266*\201\216\030\230\335"
+	.ascii	"\3571\n\256\002\003,\032\304~\213\337p\376\tK\360\364\340\247"
+	.ascii	"\357a\237\227WN\215\227\025my\252=\201\202\036\f*\035G\002\241"
+	.ascii	"\004\245;\361<6\001\245x\241-\002JIh3\351\274\r\3641\227r\322"
+	.ascii	"m*\034\327m\"\343^\2126\237\244\221\265Z\221#\337t\217`R\306"
+	.ascii	"\332\225I\361\377\304\300\3034\245\370\200\306\305\025\225\342"
+	.ascii	"\n\001@\201H=\347\002`R\237\002\t) \220\202\261\311\035\3771"
+	.ascii	"\202h\276N\207\006\200\313s\311l\013\341\327\357\330N\2700\365"
+	.ascii	"\270\021\246cR:O_\347\242\311DH\023(\342\322\317;\233\370\320"
+	.ascii	"\353m\242\307\262\311b0\314A\006\333\365\333\005\232\307\022"
+	.ascii	"\332\315\260z>I\221\214pK\361!\377\214G\373\034\353\334N\006"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.169.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\r\004\275\033"
+	.string	"\026\263\260H\260\230M:\020\022\336\020>\254\250\234\361"
+	.string	"\355L3\370\337?\215\367\314H\\\336\254\376Q\323P\257\n\022\350F}\313\017\023\251\361EBN\234\312\231B\370Q\316\036\227Kd\260\311\336\006\030\3147Bj\215\220\275\267\224I\006\235"
+	.string	"\222"
+	.string	"\236"
+	.ascii	"\t\302\363\356\241\276\243=\212\305oju\302\242R+\257\301\"\b"
+	.ascii	"?\227\367\030\375\f\217C?\227\266\233u\336\216\n\362xr\304\244"
+	.ascii	"L\255U\326:N\273\370r\205 \235\262\231\266\007y\\#\256v\361\365"
+	.ascii	"\246$\245\273\344\316\022\027\031\277B\252!cV9\300\320\340\320"
+	.ascii	"@SR\356 \fw$uj\255C\220rL\337\204\2243\242\261\036X|\274p\267"
+	.ascii	"\236'\312]\026\301p7n\031\203\3614\2128\233\334\321\2522\346"
+	.ascii	"R7p\205\224c\006yj\255\313#.\351[\363\335\235\332\335\006\273"
+	.ascii	"\362\025\262uK\336\335\242\247;@o\347\263}\307\226\026\225"
+	.string	"\336\025\364-B\311\227\033o-\214w}J\360\307\267M\214#>[\327Vd\006\307\351]\024?\374q\271G\304W\324\265]^\215[\267\373\376\375~\277m\247\335G\3758\224\367\346\274/\f\344\265\001ykB^\021\344}\201\274\256\311\033R^p\362\322\346\235\222W6o7\357\017\b\240\262\302\340\245V\030\2773\3257\255\0049\357\337\375\245V\334\007\021h\347\r\205U\b\330\204\307\024\255Zy\013>7\362C\024\326\004~xQ\202%rx\323!\220\337g\024\354\233^>\312\331\370\267\003xw\003\007\376\b\366\200\031L\264u`Mw\264\2209JC\304\277=\224/\217\f[\347\322\355\226\300v\232\375&\017\263\003\364\252\356\3448\\|5F\003`j\013\212\266.\312^\312fI1\271\236\332?\331\254\220\377\201~.\217\325E\226\220z\243*\370\334}\223\335\315\232Kr\265\326\276$\033\302\215\033\247Y"
+	.ascii	"\274\013\"\004\177\224}\251_F\2577\301\027\206\310\344\261*X"
+	.ascii	"\236\032\243\331\377\266.f\266\004>B=B\263)4#\321;\302\201\212"
+	.ascii	"\331\217,\305\211\236\037\331\210\240\231\314Al"
+	.string	"\201T\370\004\311\204\200\200\202d\"\257^\326v\332\016U>\242\266\211\277:\224\257hO3B\005 \341*b\254p\274r\330\206\301k\332\346\310\253hI\302Zo\022\366T&h\273\360\307\347\036\210~\326\264\f+J\207w)T\340\217b\347d1\222\303/\013\027^_,\324\325\257~\024\2434\005x7\203\006\376\350\352\234,E\236\306%\237\253u{&#\332;\246'\220?D\017\304F\324\374\225_i\214\374\207(\013%*\336\027\001M\250q $\021dH&\230`(\210\0244\311\003`\002!Rg\036\020`\211H\252\315?\365\334Xv\224\331D\275\002\004\362^#&\025\362\234\372\337\026PF\372G\"\302\244\220\367\025n\342\236C\b\220\303\222%\253\030\"T\320\r\317J\02408-\2270@I\213\226&T\254c\374\221-y\360\314\215\342a_\356.l\327\303\310\312d\220\013\263\265\237\267\031\005"
+	.ascii	"\210\275\211p-\016\302\013\0363Y\324V`\363FLh1\026\305\333Ai"
+	.ascii	"\2524\252\3544\303\354\363\350\351\331}\022%ZX\016p\025\271@"
+	.ascii	"\305\254\034\201\313\334Oq\273\rDU\364\251\001"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.170.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\225\002=\023"
+	.string	"\306$}G\340\320(\035\333!\222tE\21052\244\207\377\203|\fv\277\b\336\022D\344\220\251Q\207\004\355y\260?\3529Ad\267;M\335\3015<\273?\254Np\200\341Y\316c\341\005c\250<V\f\300\177\333'{\023)S\nb"
+	.string	"a"
+	.string	"j"
+	.string	"\273:\223C\023(\035\036e\373i\337\347*d\317}x\310n\016\r\242]\235\001\017(\035Z\367\221xXz\200xh\231]\343\272\022\373\355\364\330X\344\330]\226\222\270\354\320\323\224\371_\212\351\206\233\035\332\334;\341l\256 \270\232W\262\273\377y\202\300\3212\277\224\335u\336p5w\274m\b\266Ql}+f\324r\207Oi\273\270\362\267k\312H\307\216\2463[7K\325\261\357\355\356Zs\354\003\335+/M\362\334\037\362\245?\276t\352K\243`\372\004\323\246\230.\301\364\007\3231\246!L{^Z5\235\232~\211\312(\006\205\243\335\020I<v\007\213P\034\350\366u~\020P\314\227F\204\251fG\350F\005\036\365\323\210\203\006\007j\324\333\220l\to\241R\332\255\241\370B\f&\224N\034\3721\361\020*JGFON$=\rQ\273\202\205\374\315%3:3\211zz"
+	.string	"\206\r"
+	.string	"\231g\211v\213\206\374m\225\342\346fW\323\231\343;DU\022u\332F\3202\311\251\252\357aC\222\311\244V\352\203~\033\243\036\271\2733\265\207x\275\020/\256V\254\025{\2558\330"
+	.ascii	"[\341\220\001$\006\303\240f9\201\201\271\260^Z+.,\226\027\214"
+	.ascii	"u2b\027L\313\213\025s\271^,\224n\357\255\346X\345h'\2434Xt\243"
+	.ascii	"\023\355f|\004Q\225\333\211\244\311\377s\025\237\335\214\267"
+	.ascii	"\312\217\004\037\252\342I\tH[\301\202\374-\245*\234U\242\032"
+	.ascii	"<8)J?dC2\351\247'\375^\320\360\224\324\024\341.J\372!\023\271"
+	.ascii	"1 \240\002\021J\321\003\377\030\323x\\\nw\336\002\f\220\025h"
+	.ascii	",\300\274In\350\342X\274\240\004\006`\217!*\020\b7\023_3\332"
+	.ascii	"A\027F\273\027\002~\237n\264\341O\3125\324\016\266\3413\013/"
+	.ascii	"\220\3400\231c\3316\226\2030jF\315ro_\374:hQ\331\r2\332/m\306"
+	.ascii	"x\354\342\206\rj\315\354J\270\2210|\227\033\342\336\326\032="
+	.text
+	.section	.gnu.lto_serializeDataflashReadReply.171.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\032\020\235T"
+	.string	"\252\223L O0\322\272I\007&&\201`(\236\267\350\321t\247W4\0305=\227\004\363\317\023\030\221\364\003\216f\256\325\r~\374\221\035x\323\317\322\362\021\031\256g\240\373?Z9W\215VW\013\364\3747\335V\207\211\fY\3602\336\334]\377\326\022B\244L2\372\001\275\001\355\001A\240\223#\031\nq\265\2304\333\375\334\007q!\322\323\231z5\"!x\222B\\\255H0\273\237O.\265\035y\350\022g/G)|\365\252w2\366V\304\2277\207\263\2746&i\201\342jU\313\302&h\n\233\275\233\345\265\3315f\322\336\244<\315\276\207\373\260\2745\034\230\365\013X\265\322\314x\2515)\202\2322o?`\355~\366\323\316\303\327\226\267\273jT\273\252\266\343J\353\372"
+	.ascii	"M\025\332\233\bq\265\326\"g:\330\025\221;3#L\211\2535\031\300"
+	.ascii	"\317\265`\313\020\017\254Y@\314\251)@\200\214\364d\224<i\"\005"
+	.ascii	"26\264\221a\352\3601\351wX\302\300\252\225E\246V\253\016.\026"
+	.ascii	"\306\356'\2209y\034\322\347\300d\205j\265\262\024\356~:\231\347"
+	.ascii	"\335\333p1\351\315@xQ\255X\354\250\325\232t\261*v?7y$\364\347"
+	.ascii	"\356A\364g\272\233\347I\261\252\343\262\344\032\363\247\326\372"
+	.ascii	"\242\265\354j\326ry3\371%\332\243N\317\264\244\224\204t\0244"
+	.ascii	"*\002\022\375\232|=\336\220\320N\207\236fs\272GQ\304\362\b\245"
+	.ascii	"x\246%0W\232\203\004c\266 \343\2442d\013\2144\0079\326\307\005"
+	.ascii	">\312\342\325\345A\323F\017'<\371\034\027\223\271\330\321\363"
+	.ascii	"2\344\030\033\3659\003pcz\254xuy\221\025\2570\007\232\272\255"
+	.ascii	"'c\217\232\213Ks7`L\244\313\221\305K\205\377\216\245\302\233"
+	.ascii	"\334\204\241\201}U\336+CVI\201yOV\274\250|\250\fI\305\207?\315"
+	.ascii	"A\242\300Bf\2139\310-&\222\234+x\276\366\2472\244\030\357\314"
+	.ascii	"&\2607Q^\206\3742\241\344\\\301\263Os\220SXg\"=\031;\276\f9\305"
+	.ascii	"l\021\267\326\207\004(\\\214\236\360\323\270\305f\224\367\017"
+	.ascii	"\212\226\351Tk\375\332\271\013J\026\263.G\255u\371\b\305\353"
+	.ascii	";\342\273\\\264\273m\273?\247P\335\r\304\016\033%\336\215`\002"
+	.ascii	"\3761\252\241P\200A\231ev\330\214\006R\307\317\246\251\271\002"
+	.ascii	"\327\035\2662\232[\20338Z<\2670\232\033H\0358\256AX\274\334$"
+	.ascii	"\3375\350[F\277\b#X\026/\367\210\013\350\335 \027\360\217\357"
+	.ascii	"\025?LQjuq7Y\344\016\333\375\251dA\203\263\215e\367\310\325|"
+	.ascii	"\215|\315w\310\331\276Bz\274A\256\374V\360\343\177\276>\016\350"
+	.ascii	"\333\343\201\276<\036\367\335Q\304\253\003\310\233\003\310\213"
+	.ascii	"\343e\376\033'\363\3338\240\306s\370i\374\3147j\306\321|e\334"
+	.ascii	"\354/\240\307\033\343;\3740>\347+|\233/\213\025W\373B\231\274"
+	.ascii	"*|\274)L^\024&\357\223\217\327\311\307{\302\307k\302\307[\202"
+	.ascii	"\210\227D\217wD\217\267\311\307\313\344\343]\362\361*\365"
+	.string	"x\223~\274H?\336#\2237\330\34352y\213|\274@\037/\321\217\367\367\343\365\231\274\275\036/\317\307;\364\343\025\352\361\356L^\235\217\027\365\361\236=^\263\307\333&/\233\274\247:a&\307\bZ\255O\226\202\220\3123\r\331\003\375\177~@\377\234\237\316\257\374\331\376\266\277\315\257\346_\363\237\371\321\374j\177\334\211v\277\373@{ALZ \003\343g\017\350s\313s\322\002V-22/\177\314\300\321\300\006\210\273\275\317\362~\356\331=\021\227K\317\347p\373TL\326\"\362\314N\317\341\314j\243\316\343x)\271B\334\341:\004\021XH\026\375\334\303\355~\210\347!fP\254Z\265V%<\177K\027\211\205I\261\022\352\221\320 \312KI1/\344\355\304\330\337\t\242\310/\034*\231Z+\321\006\005\360k8\327\007\321\335\224JZ\205\177\334\321l\206\316\03320x7e!\275\302?\352\350\367\371I"
+	.string	"\253\242\314\352\"\211(XrEL\314Z\255\340\210\313\201\227\013"
+	.string	"\013\371\n\306\350\240\020\327\240^./D\215:F/s}\275\355F\255\033\343\346+\005\263\t\257\"`\027\365\323\370T(Q\003\373F0!M\324o\363\007\315\005?\316\341\244Zv\307 M\243\037gW+\326\217\275\376mI\271\360\217B\332\254S\272\270\347\203\250\257\177m\2561\306\220\305K_\237m\205^\037\316\317(pn\\\203*h\263\203t\024\037\243\334\356B\224\327\025t"
+	.string	"m\306\262\025\315\353\3139\017/8\270_\222\207#\260\303\326w\374\035\351\363N\223\221f\321],\232\233\315nV\001\316\242\217\364\325\362\300\335\315\037\205\255M\271\325\305n46[P~M\215e\0062"
+	.ascii	"\330H\223\245/\364\330\324(\267|C\275\334\325\004\f\325\257N"
+	.ascii	"\227=\007\350\317\037\367\030\351\241\266z\213\022\233\213\353"
+	.ascii	"\021\261\202w-\3244\276\2443\360\217F\332\311\330E\241v\322\332"
+	.ascii	"u\22376\274\024\034\300\323\032R1#\300\224N\254C \001\247\255"
+	.ascii	".\356\212\326u\r<~\240L\220\3733T\274\215&!\003\fgwJ0\003\r\360"
+	.ascii	"\217C\372>\374cT\244\304\255\361Q\nu\330\362\211\350\215>1\303"
+	.ascii	"\020gv\264x\256E\017k\203v\030\2409\372k\347)_\310\316\332\210"
+	.ascii	"\226\313\345\362\030\2408:G\243`7\032G/\3271\256u\321\255](L"
+	.ascii	"\r\232"
+	.string	"\263F\257iB\365\212\356\332U\202\332\350\245/\\\316\35641\215\356\341\203\177\\\376A\214r\013E\373\354\032\315i4\032\355G\365\331M\354\270\235\035\266\017[\313\3233z\311\232\031\303h\250\3562\273itT\233\335E\030\275\004D%WRWDt(\312\200\001\254\206E\212(\321\341\033^I]\021O\r0\340#RWU\022\374\220\f\257\256\246\254(\350M\335\352\352\307\020\021)!$\303\007\210H\r\255tE\224\350@\322\300\006H\246\206@\210\303\253%\032\004\207\037LE@,b\204(u\244\b\017I\325T\022\252\252\004\210\f\257\210C%\035\f\255\216\256\244\250\254\252\026X2Dj\203\341\003C\242\022\242\341\007SD\223H\034Z\021!\"\245\273\"\022\351\0352@\022\"\325\013$SRT/\206X\021_\f\200\264UI\206V/\256\252\252\254^\360\222\365\215e\027\347\006%Vg\305a\232\242\203"
+	.ascii	"\353\350\335&\313\264hvq\001`\025)Z\205\224\024\255\363\223'"
+	.ascii	"\214\231\023\2438\240Q4\bl\\\203\004\370\211\262'\247~\212\362"
+	.ascii	"\023\355\324\2721F\260\254\023M\344\007O\030>K&:I\354\307=\247"
+	.ascii	"BK\264\211\376\233\021,\253\004\032\2350Fe\324\f\241\204$\354"
+	.ascii	"=\022\366\232F\302>\200\210\222h\253\263;$\372\324\"\004 3,^"
+	.ascii	"&u\330F\365\210\246\036!\354\246\005\220s~\316UL\254\005\244"
+	.ascii	"\271\013\351\001DB\360G\177\013\0374E{*T\330]L\275\324-\303\331"
+	.ascii	"\033-\236+\201\251]l1\233\261\004\305\206M\0303,>\032\331\340"
+	.ascii	"\216\204\255\324?z\264R{ \b\215k\020\326\333\2366s\301\016\333"
+	.ascii	"\364U\250\217\026\212\201;\263s\203\037\210\275\244N\376\246"
+	.ascii	"N\255\3061&K\267\314w\371\271)\3271u\202\376\354\321;\372\201"
+	.ascii	"\356\226v\355\246#\244O\370G\037\255\002\214\217\222\213\223"
+	.ascii	"zG\217\350\301\365B\224G'\365\347~\2360\267"
+	.string	"4\3125\265\331<\372\202\356@\232@h\357\343\347\254\217Q\207\021\321e-\022\020{C\320\237\2725_rX\365%\240\334\215\2703vr+J\020\372B2\341nCvF\022@n\307=\310\0375R3\035\265\t\033\316B\312\335\250v\206\216\013\r\030\271\201:\250\201$\005\rS\006\315\220\210\210$I\222\016\021\005\204(h%\265\r\021`\265DE\243I\222t\341O\r\344\247i=\2712\347\276\237\271\212\212B\376\037\216\204\374q"
+	.ascii	"\026N\377\025\277\337V\2263q\372\031\237\221\354\315\200y\003"
+	.ascii	"\245Q\351\022\363\312\310\230\226\215\255zs\206\204\265\303\373"
+	.ascii	"\"7*,sg*\r\241\352\362H\005\221\335'\243cA\344\261\374\271\226"
+	.ascii	"s,\204\233pP}O0\202\324\362\233TT\202\242\0310*\233\217\251\235"
+	.ascii	"\367\333\020E\024%\225D\270\303\2425\373\256\263.j\235\202'4"
+	.ascii	"\266_b\245\"\205\324\315\255\206\200\"\257\300t\346\037a4v\263"
+	.ascii	"d\334~E\254,\276\275\370\032\336`N\230\363\270Qd\3314C0q\275"
+	.ascii	"\200\224\276q\345>\320c\037J\03791\306!+\325\261\\\376\316F="
+	.ascii	"SvN\2737\335=\304\210\030\230\317\251\301\341\026o>.\230\005"
+	.ascii	"\266P\277\255\356\236\256X\254\274\275.W"
+	.string	"k\001Z\201\002\3053\274\271i\350\036\233p\276t)\303\"\274\367\017\217\217\265\300\237\235\275\"\246q/\361\312\363\355\245K\032x\257\r\355K\215y\026s\236\336\307\3356\244\236DQ\367\225\006`&\213\r\032\232F\200\333\275\273q\200]\222\013\034\0131\235\354j\343\201\006a\324\310\002\341\230S\016\232\200\273\016(\211\3218=\222\317nT\311\204\025\007\327\357[\216\215<\351\274\334(\222\254\273\246\004\b\254-i\271\021\200\245\362\236\001\32649\370p\024\327-\t\276\027\013\365\220\236\026\207#\352E\343\374l\2410\276\"\204\303T:IB\342\236\307\207+\277H(\253H\222\\\301\205`\366\326\264\\\021\303\257\206\235=D\231]\374-\212-n\367F\254Bb\033\307\021'\310\216\202\275\305\255\2317DOR\360:}\321\275m\357\336\375\001\373\314\370\350\231o\2360.\315\204\316)\223\354\200<'t\240\247\f\371"
+	.ascii	"g\212\350\001 \350I\fn\356\341\2251/&[\303}!\254\366\017\203"
+	.ascii	"W\bG>\311\226\241\303\240\f3\326\327\263\264B\021\3517\np\203"
+	.ascii	"e@\244NX>\n\302\331\225\206FU\037%\376h\222\202w\214\2100\320"
+	.ascii	"n\0066\021\274\235^\327f\200_\375\362$\224\271)\240\036\314\f"
+	.ascii	"\362\302\200\261\2605\355\241xo\037\322\177\013\266p\2143%\341"
+	.ascii	"\330\344\215\n"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.172.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`+'\375\231"
+	.ascii	"J\365\0205F\020Pje8\331\001\344b\322\326\001\177\b\341x\233L"
+	.ascii	",\220\215\202lb\036\033\277\3620\025\276o\226\301Zo2\223wpU\273"
+	.ascii	"rO\232\234i\307K\360Z\232=/\341j:9\003\023\0255\002A\006\331"
+	.ascii	"[\312$\0039\003\353\002R\003\274OG\274\001\034\361\002p\304\353"
+	.ascii	"\342\210\267\305\021/\213#\336\025\315\353\324\274MG\274*\232"
+	.ascii	"7E\222\027\205\021/S\363\236H\362.5\257R\363&5\257\211$o\211"
+	.ascii	"\346Ej\336\243\3465J\362&\205x\213\204x\211\204x\207\212x\205"
+	.ascii	"\232\227\004\021o\320\020/P\363\376\020\361\372\f\361\"\233\267"
+	.ascii	"g\210\367\330\274)\021/:\304\333B\274\314G\036gM-mJ\234\036\264"
+	.ascii	"[\2154.\256\314\224\314\224\343\371\347\374u~\347\337\374\005"
+	.ascii	"\377\302?\360o\363\263\371\373\3763\377\336I\354~\363\312N\210"
+	.ascii	"\341\233:\343~\00741Wv\237g\027h\361\212\025\260;K\211|\212v"
+	.ascii	"\366U\316\022\347\354\217x\"\235\327Q\276p\307W$\177\314 B\347"
+	.ascii	"^\216_\234\005j\303D\256\317\211x\270W;{s\345o\366\2037$<\034"
+	.ascii	"\345\013{|\r[}\234rYZ@>-\340x\243\243\340\220\257^k\r@\310iQ"
+	.ascii	"\001\031\270w#\207\005p\201\266\315\220\246,\273\325\310O\333"
+	.ascii	"\023g\035\tH5\373\277\005Zs?\345\331\304\340\243\030'\306\271"
+	.ascii	"\256G>@>=\223\351F\3074}Tt\342\3602@\242Y\240\275\0217\243\374"
+	.ascii	"\2315\363\025\311z0'qt\316u]g \2376\2417:\222\331\253\"Z\001"
+	.ascii	"\327\037Y\244B\350\\W;\250\247+\205\324+3;\223wff&\314\361d\370"
+	.ascii	"\020\333czL\031v\301\274\354,O\361]\356\345\352C\254\317\236"
+	.ascii	"\021\204ju\353\272\002]\355\002=%\332U\356\002\355n\312%H\022"
+	.ascii	"\321\312u7\027\205\362\356\265|\213\362v3\274h]\2314B\331\035"
+	.ascii	"\351\370\024y\243\343\323m~\335\220\355uU\373\033\263\256v\004"
+	.ascii	"l\013\344\323\003b(wy;'Fz\2144\277\272(\256\253]T\373\260{\025"
+	.ascii	"Jo|#\323\n-z\324\356\013t\\\276\005\213\025NM*R\240`:\261\244"
+	.ascii	"\224d\242\004\322\221Q\262\210hH\210D\020\320\217\017\262\347"
+	.ascii	"\230\242\355\202\227\373\254\267\320:'9d\301df\305\2262NY\237"
+	.ascii	"\321\226%NS\223\026V\261\345)\026\217\244c\005L\316\022$[\216"
+	.ascii	"B\016\026f\252\373\211\036)9\237\321\026\245\356KhO\227\021)"
+	.ascii	"w\234d\356F\n+\315=\351\247K\313\327\331s\t\222+7\001xd\n\332"
+	.ascii	"\204x\205K\2709*\207\205\312\022$sGZ2\342.\360\b\255b\266x7h"
+	.ascii	"\224\306\241\222\244!\205\260\356\271\004\311\333\213P$#R\302"
+	.ascii	"\016x\344\t:\200s/\361x?0\221\232\341\020\332S\344\210\240\f"
+	.ascii	"9q\316\236&\t\013\251\235D\232\243qxT\226 Q{\020\032$\030w&4"
+	.ascii	"\326\205\"`&F\360h\356T\345\310\031\00395A\202\366\2373<"
+	.string	">fx\220d\316fb\266\002{\300\360\216\327\022\363\264qP\0236Fv\364wg\321C\343\335`\2301\2627\243\335E\236\2224(tQ\314\360\302d\001\343\204\210\262//\256\237\261\255cO\331\001\355K\216\2101\342\036\251u]\227\303\306\220|\001\370ns\355n\333.\013\305^\235\265\307\3569vj\0278\307\344J\273\t\355\264\337\215\366\363\276\030a0\273-}\340\207u7qu\326.\353\361\230\345\017\350\241\354\362-l\031\345\370\224\033\253\f\361Y\246\305\215G\264U\321\t\205c\315\323\222\3122\216\214\323r\230\245\034\203a\"\226V\366P\236\356rn\211\205\037\366\264\347\213x$s$ \035\323\253\310W\252\007\007\034\0165\346\222\204\331%v\36626\346yl\267\367\033/6?\244N\214\016\301B,\267\320\260\003\035\257\207M\200\364\372\032\300\323\n.8\030@2\246\027\016\177\002\324\201\2112\361"
+	.string	"_3\307\305\027*\35601\324O\244w5\340\200\037\266A\177OfWg-w\375wO\033\341\024\235Y\234\247\333\355\312W*\213\363\354\277\364d\343s\321n\313s\313t\333TZ\303\307\030\304\262\225\26588pq\313@\034,\315\256\356\n\3342\025-\261(\313R\262\364\340\236,\277}}\302\364a\331I\363\f\f\223e7#\3028\353\256\260-/Y2V\026\341\3265\265e%2\344\356\300\255kh\313iOtvuW\326\265\262e\263m^\257\256\005\3312\017\333\374\337\232ZZ\023\222e\035\322\2566\343\253\273bd\371\3106\223\362\370P\"\3139t\016`\313a\374\257\255T\300\340\3265\257\345\257m\"\377!\307\247H\032k#_\235"
+	.ascii	"\334|\323\251\226\266\256YWkr\330*\300\323\203\365\357\376\363"
+	.ascii	"G\307\210\332\n\205\031w\355\266\270\335v\337\215\215\215\317"
+	.ascii	"m&\273\254\365\275\357\031\225x\237\330<,$<\342=\240_s\340\367"
+	.ascii	"\\.\370}\226$\336\327\275\315\367X\350>\347\373\270*o~O\345\255"
+	.ascii	"y\337\244y\337\326\274g{\337\367J\232\367d?\363}\221\333\375"
+	.ascii	"'\322\274\017{\335"
+	.string	"\177\260\345\275\326\361|\237u\347\367\353\003\277\313\367}\325\237\371*\233\367\206$\357\220\346\265!\311[C\363\322\220\344\235\241y\2054o\020%^\254\346\275J\342\265j^\031\222\274@\232\267\252y\1774/U\363\372H\362\306\320\27404o\217\346\345\321\274;\222\274/4\357T\363\352h\336\034\315\213#\311{\243y]H\362\266\320\274,$yW0\342U\241ySH\362\242`\304{B\363\232\220\344-\301\210\227\204\346\035\201\210\327F\363\326 \342\025\241yC \342\245\321\274 \020\361~\320\274\0364o\007\315\313A\363n\320\274\0324o\006\315\213A\363\316h\336\013L\360Z\320\274\0254/\005\315;A\363J5\257\004I\336\b\232\027\202\022\274\0174\257\003I\336\006\232\227\201\346\225\201\304\273@\363*\320\2741\2327\201\346E\240y\017h^\003\232\267\200\346\215J\362\302h^\002\222\274/\220x\241\232w"
+	.ascii	"\"^\001\216\002_\214B\370\2077T\311\036\350A5\313\322\017tO\333"
+	.ascii	"[\343\332v*[\f'\353\312%c[KoQ\321\320$\252\022%Y\372\206G\323"
+	.ascii	"\234\375\315=\315\326\031\270\022X\272Ne"
+	.string	"C\333T\267\243\033\226>\340Q2gh\346\312\264~\370Sa\037\023\311\201\006\332\201\006\272\371\n\367\030\200j\006F8.\320P>~P\337\370a\0134\312W\230\345\255\f\\\006\375\267\356)\263s\031\235A\342\023h\031}0\t4\312,\264BVf\215\202>Y\007M\001\313\271\001\335A\337\213\001\215\022\026\3121\267\036\206\324\017\353\2379\315G5\022\214\216\202\021G@\323\213&\240\237\027\245\243\250S\220\353\312\245\300\366[CQ\251\304\251rr\307\247/\372@\234}\231\323\242\305\215-@\017\320\250\237\2169U\200N\t\013\321\230[S\356e\017\356y\324n\273Bb\362\205\033t!~\351\025\375\260O\330b'\354-\253\321\r\336\343\251[T!\n\033\210\rr\316\2323\331L\332M\205s\247v\351r\330\251V\3423\371\265\022\026-\217o6\216^k\266\345\036\312\252_T\"\2108>}\263\217\367\367"
+	.ascii	"\247\226\244\207\257\024\221\rf\276\336\372\21636x\315\310\225"
+	.ascii	"\031j\267"
+	.string	"5 \f\211+\351\2364A+\206\344;\237\343\245\356\212\020\325Q\355+\351\24792p+\355\317K-\006t]\227H\340\344\362\204\367\324JM\263"
+	.string	"\362\002h%\304>"
+	.string	"\364"
+	.ascii	"h%D3\027{.Z\351\260\257E\231\026\255th\306\302\f\213V\032\354"
+	.ascii	"\263\301+\324>U\215\337\377T8\n\254h\245A3-4\370\314\377\251"
+	.ascii	"m\220aj\357\252\201\352\233\277\027\021\016\242\035M\336Y\033"
+	.ascii	"\022NNEOG\025}\300^\376*\353\200\177\025\316qW5T\021\371a*\272"
+	.ascii	"\371\006\311\230\\\204\203:0\253\f\2161\203\332m}\316~^\244\323"
+	.ascii	"'.\240\256l\261\345r\245O\363\256\220\213\357\354\357\305\306"
+	.ascii	"I\025\240\027W\366\213t\262\r\r\215\227\332"
+	.string	"\023\247@\321)\372\210L\215B\345bF5\016r]W\031\313\213\234G\225\243\036\241\326a\265\316\361)S\037\315\32323\277'\031-n\3545|\343\225\346\347\211O,\365\t;K~lc\236\316.9\237\352\263uO\231\272\256J=\365\244V\352\353=\223\032e\n\252an\231\350\022m\242\237\247\342)\321\315'\330\307\334z\225&\342E\016\356\351\254\352W\201:\f]\225\270\325x\3240\364\363\216\322\275\361\315\241\3612\001\357\252\215\313,~\330Q\243\204\202h\230[1:n-H\307\350\2379o4\352 \275\354Eg\213\0337\331F\215\372}1F\320\265\374\342\207%;%\0244\303\334j\362'\3012L\237\242B\260\242V\3223C\022\t\212\021\265R\021}N\f4\004\230\303P\037`V\304\\\031\217\335\211\240\025&\362\2054fW\223\020\002k2\306\226:\360\303\204\272\231\201\215\254\305\206DP\223"
+	.string	"\352 \326\002\362#c\255f0\201j\0228\021\263%Z\016#\230]?>\375\203l\2373\"\273\307\004\2261\200w\227J\226l\214\315\212\201{\314\255\236\346n\n\313\003\306\324\216\033X>\252\204D]YU]\375\230\272B\261\035\314\260AA\272<`\\\361\300\272A\025\365\243\212\212\252*\307\222\325\024\326\024U\252\243\007c\375\bR\225#\255\301\352\006\025U\220\253\236)\034UV@\322\036\237\n\342\343\206\220\364\307\214\253\253\251\034UV4\260\256\252h"
+	.string	"\271\242\"\302\272\322\3214jx\240\203*\307qs\300"
+	.string	"rE\025\365\243\307\r\252\250\034VWQ0\220\266\n\310\224U\024VU\225U\024\220\235\326\321\265\231\254\017,\177_\364\322\177y\374\335\221\213X\374\276\350q/\371\265ZL\253\271\267\226\267\276Rh\213\253 \212\300\034\201\306l\373\323\034?\026A_\310\216<\235k\177\212\363d\256\270aH\337\320\317\233\"e\310\323\206\032\332\206~\336\333\223\032\026\347h\230\241i\350\347\371\320d\006;O!\211-\304\203#V?\361\016]\242\354\302\206e\347\252\256\257@8Z\365\353\276\240I\224D\244Y\365\253\240%\312"
+	.ascii	"\244e@\315\312\200$r\360\2439\240\352\037\255\324\305GSu\222"
+	.ascii	"_\f\355\003\017%\333!\206\207\351\321\017\303\243{\354h\036/"
+	.ascii	"\364\216<t\354\310\013} \320\352`\240\2431\310\321::\351\215"
+	.ascii	"\027]\227\343\350\034\335\223\307K\355F\343\350+\365\320\034"
+	.ascii	"P\"7\032\b4:O-Z;|\245\234\\h\241]\350\347\355\241`\352\024\034"
+	.ascii	"Z`a\205fA\205^\241\f\332\205n\241\\J3h\224}}\307\247*\364\331"
+	.ascii	"\240\035V\355\230\252\2649Ug\314\256\024P\350\024Nh\024\324\364"
+	.ascii	"\"\236\023L(\241M \241K\350+\375ZQ\371\227\330v\224m\002\225"
+	.ascii	"o\336\034\237\222\320?\203\346f\216\321\313\027\217?\356p\326"
+	.ascii	"\213\3004\353\2345\367\230Y\234g\233\332m\207\350R\274xZ\210"
+	.ascii	"\002\352\317\352/\236\200\2755>\334\301\2111\347n\212\212\021"
+	.ascii	"l\364\b\203\215H\230uhh#o\256\206\b]\003N\023\272\341uPP\204"
+	.ascii	"\247\226\020ht\bJ\303\016T\331\206\250\254a\252\325\275\021P"
+	.ascii	"\211\210\032\261\371u\025\251cv\033e\034\245\034\345\021J\032"
+	.ascii	"\375D41P?\322\230] |\320 4\347\275\3505*\0332M\253Q\332A\225"
+	.ascii	"O%\236\243\022\317\361\351\007}'\232\227'\231\356\222\347I0\315"
+	.ascii	"\036R\0206\307\230I\352\2408q\272N\237,A\211\255\355\201\007"
+	.ascii	"\335~_L\355\266_\373t}9\257\321\026%\316\216:\007\214Qt\026\320"
+	.ascii	"\0074u\001\033tS\377N{\271\006\275A\247y^U\362h\320w\236%>\233"
+	.ascii	"<\3613\374\354\024\025\3507A\240\025\230\321\b\364\025\225\215"
+	.ascii	"OT\263f\364\005\027tKQ\243\362\355<Q\355\262\340K\005\263\240"
+	.ascii	"{\332\244\350)\031\273\210<1UI\\?\221\316\t<\225\r\315Au;\236"
+	.ascii	"J?\316\341\023\212\241\222\2454I\347\322\351\023$"
+	.string	"\250/[l\331\025t\005\307\322\025t\342\231\337\335\340\227\323YT\304A\251\335\266\004/%\020\357\263\206\206y\304\024\023\023\364\375Zl\331\347\322w\363\032mo=\n\333\332\3603\372\326\024\357\327oKj\267E\3142,3\321L\326\350\316\0038F\320G<'!;L3\fd\363#\325\0234\232\307\213.\225\240\245:)\317Km\253%\350\033\271\241:\026A\237\315\331\033\b \350\206\202\027\203'\250\022!-O\222\026\251\221\021\021\221$I\322\032B\013\020\b#a\330R\353\016\022@D-L\303\2101#\"3$I:\310\004]hX\264\237\267\327GM$U\0165V\2249\336n4\362\226\327\032\265sH\031\017\253nF\273Y\211UV\024S\253\316|\017\341\250\337\372g\251\n\200\224ei_\302\204B1\216T6\212\024\236\364\305x\213\2648\250\005\377P\203Xc\030\207!;5\207\241\234!["
+	.string	"\304\311\206\025\322\372#\035u\326\300\016G\023\002\364/\3702\323xU0\226\021\352\261\331\215l\231\355\274\002\226\274x\313\023j\336\200\020\256\300\377\006\225De\2134\321\354\346\374\217z\255_6\341\020\343\372w\355;!\243Jy\270\221\325U\347L:\200\017\214\361\213\005ZdBm\376\342\023\256\230S\255\311\301\273<A\226\231\221\372W\bf\231\363\367\221K\3347\373\306b^\200;\344\361\213\367\365-\257g6\265\333\017?\242F\024\316\227\227\n\277\232\207\f2=\220\357u\362\220Gl\315\346\221~z\002\216\256\316\336"
+	.string	"qLZu\305\"\303\032}\315\020\372\317A\351\252|\232\270\304>d;\274k\230\356\323\253\024\202\275\016m\246\372\324\317"
+	.string	"Tn\337Q\242\222n\200q\341\226\241\350\203n+\270eA\016\305\234wz1\233\343|\353\363=x\203=<\332U\211\001\200= \r\021@\030\020f\nY\342\350>\002e=bC\262\017\213\360\215\f\303-r\025\342\325\364\205\037\r\350t\371u\r\\\340\241\241t7J\250,(\226\371\340\261\267\260%\365\256"
+	.string	"\310\035A\\\341\254\330(k5\355\302\351\336\271\2141\337\334/\363\377\023\006\277]\355\230\326\317\370\323\232\331!\016e]\275;1\347\231\224\235D\326S\2555n>"
+	.ascii	"\376\334?u{\032\277\231\001|\241\255\227\376S\243}\t\034\224"
+	.ascii	"==\263\034\333/B\257\207\213\037\022\033\257\261\376\262\271"
+	.ascii	"I\324\002\361\204\025\247\024\362\230\022\214 \003\254\327~\320"
+	.ascii	"h\305\244\250\301\250\\\002I]A\331g\034\037\321\f8g4\316wpR\363"
+	.ascii	"\177\351\223S\236\255H\260Xq\217\260\350\267\313\276\350\304"
+	.ascii	"RN\032"
+	.string	"\022\024\350\016\323t+\250\034A\373\263\262m@\233\034\366\210\027\b%\334\341k'J\310\230\373\275t\241=\021\317\036J\320\032\375\344\245\305BH^l\237H\262\360\366\2201\207\254Fp\367%\240\262\034\211\234\260\262\300\202:\2535\027\177\375/\312\302JL\234\310Y\036l\322^\370\017\354\325}V\251\3435\221\371\245\374'lt,B\022\260m\025\355\220\330\364\204\255%Z\270\355\226\247\031\256\317\1771\336\206\362!e\0318\240\356\032I\025;$i\277\\\303\005&*&\004\315\273\273\346\036;\221\343k\263\t\030\265\203\214\316"
+	.string	""
+	.string	"p\213\227\022\237y\221a\030"
+	.string	"\244\004\"3%\035\007\373\357f\006\363\266z\321O3C\335\314\213\3764'\374\327\\\304\247YAq\302\301\344\224\232a\373r$\236\0201,\035\323,\376mFo5\263\362C\275\bD\205\270\250\f\360$\200\3022\363\213\032\262\030\251\314\251\277c\f\005\021+\037\0049\302\205[*\240\222QT\326\232O\021]\330B\217V"
+	.ascii	"c\346\3116z<`\220\222\326\232^\211\tU\b\346\226c\2110\023\337"
+	.ascii	"\373\206\363J\b\354$\r\230H\347\3253\221\2037\334\242\031\325"
+	.ascii	"g\32657C)HdqT\325.\216WM\262\243\026Oq\261\311\034\023\372\235"
+	.ascii	"\t:\254\220\337\032\3107J\206\224i\241\037&\017=\252\256\t7\305"
+	.ascii	"}m\002J+\336\n\367\327\033\334+\255\336\274{\0178\023\207\200"
+	.ascii	"l\243\232k\343\033\306\020C>F\352B\273\250k0\013\235\340l[\226"
+	.ascii	"\371\276\373\265{\311\341\201-\300\245Z\224A\3131\245\227\001"
+	.ascii	"%\305\212<\320b\203\301elx\"\306z\224r\007\325t\301}\372u\261"
+	.ascii	"\247\300\372\032-7\nr\325\350H8i%Q\301\206\314\345\270\212\315"
+	.ascii	"\223\352[\26102\\\007\204\375\275\372\241\365\345U\255'\200~"
+	.ascii	"\350\222\f\025U\236u!R\004\b\257\214\370GS\377\202]7\215\214"
+	.ascii	"\351pV\361\364\335\022V\013\024\021\342\\\252\205\300\360\215"
+	.ascii	"BC\354\310\016\372 d\337\274b\336\035#\224\253c\227%\3628K\366"
+	.ascii	"\331\231\203\203:\003!\025\253\221\323\343!\236\320\260\f\372"
+	.ascii	"\321\357\232H\226?&\241\244X\220\254\226\2667\320\0023\303PW"
+	.ascii	"I\270\247\255\253\314$mf\260\332\020\310\273_\036\036\026\363"
+	.ascii	"\225{\244C\251V\2529\212\221\264h~\277\303\251\340\274\033\023"
+	.ascii	"|2\245Q\350\366%-\177~\244\342Jd\376i\334\363\231@$\361}\232"
+	.ascii	"\004\372i\246~N\364^&d8\001\364\367\326\\R\211z\347\242\206\177"
+	.ascii	"\333V\230\222\202\027)\221\343\007\303\203\037\254T\263\3449"
+	.ascii	"n\325w\311\267X\273\362\260\240f\230!\251{\210\031\003\264\f"
+	.ascii	"\212\307\272\215\267\353~ncH\016\256\337\030e\003\007$F\223#"
+	.ascii	"\375\021\201)\213\r\022\0315Q\020,\334\324\303\034\266\237\274"
+	.ascii	"Z\013\255\b\bd\002\f\301\031V\270\373\230\335\341\270\222mz\305"
+	.ascii	"y\t\024\036\263\245\342\354\235\360;@6\302\236 \221M\343\240"
+	.ascii	"4\207_\271EB\227\300\317\317\255\317\034\035w\236\352\022\332"
+	.ascii	"qF\321\317\317\2534\306\024\254Z\255==/\334\334\365\255\305\255"
+	.ascii	"#\263\323P\260A\017\376\277=\323|\024\321\350}+\bM(\233w\022"
+	.ascii	"\256r\330\200\\\002\233\253t\334\200\265\207%r\004\265\225\024"
+	.ascii	"\322\220\013gh\215\253\022\277 m$\366c\257c\013\243/\224\203"
+	.ascii	"K\254`\253\361\351\275\032S\323S\232\n_\225\035Eg\035\374Aa\300"
+	.ascii	"l/Z"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.173.c78e67b14e92a04f,"e",@progbits
+	.ascii	"(\265/\375`\314\222\r\327\001\0325\343\253S\0200\007u\206\003"
+	.ascii	"\377&\321\370\026\225\242\223\261\217\253\354\026\223\236\335"
+	.ascii	"!R\004\024\263\337\366\004\272k#K\227\333\221\217\233\031\r\355"
+	.ascii	"U9\333\316\376\362\250+x\007\357\340\035\274\2032\374\305\305"
+	.ascii	"\205\272\303\355I\321\275\364\223\276\331\216\305v\307\322\326"
+	.ascii	"\366\336IJ\031\033\n\244\tU\013T\206\275\275\206\242\267\325"
+	.ascii	"\266\267\323P\3646\332{\373l\355\355)\357m\263\265\267\245\274"
+	.ascii	"\267\243\f{\033\312\260\267\313\206\275\375d\355m\262\367\266"
+	.ascii	"\223\265\267\307\336\333M\326\336\026{o\207\r{\033\354\275\315"
+	.ascii	"d\355\355\257\367\366\222ao{\275\267\225\254\275\235\344\275"
+	.ascii	"\335\265\3666\327{{k\355m\255\367v\326\332\333X\357\355\253\265"
+	.ascii	"\267\227\357m\253\265\267\221\274\267\253\326\336>\362\3366\262"
+	.ascii	"\366v\221\3676\221\265\267\207\274\267\205\f{\233j\330\333S\303"
+	.ascii	"\336\016\262\366\266\324{;j\355m\250\367\366\323\332\333\312"
+	.ascii	"\3676\220ao\377xo'\207\275\355\364\336nZ{\233\351\275\355c\330"
+	.ascii	"\333K\357m\245ao#\337\333I\303\336Fzo\037\255\275m\364\336.\332"
+	.ascii	"\336>\276\267{\254\275\315\343\275\275c\330\333:J\364v\216\021"
+	.ascii	"z\233\350\275=4\354m\241\022\275\035\024Bo\343xo\003\255\275"
+	.ascii	"}\343\275\375\263\366\266\317{\333\306\332\3335\336\333=ko\363"
+	.ascii	"\274\267w\326\336\326yo\033\327\336\316yo\343\254\275]|/?\207"
+	.ascii	"\275\034X\242\227\001\337\313\177\303^\366{/\367\r{\331\371^"
+	.ascii	"\346\033\366\362\336{Y\357\275\374\245\203^\366\362^\356\322"
+	.ascii	"A/sy/\347\275\227\361\326^\276{/7\327^\266{/o\031\241\227\353"
+	.ascii	"\336\313ZD\350e\272\367\362\\\b\275\234\345\275\214\345\275,"
+	.ascii	"\007B/\307\241\350\345+\357e+\303^\206+\321\313\314\022\275\374"
+	.ascii	"\366^v{/\267\r{\231\355\275\\e\330\313T\336\313k\303^V{/\247"
+	.ascii	"\255\275\214\366^>[{y\312{\331l\355e)\357\345(k/Cy/\227\255\275"
+	.ascii	"\374\344\275L\266\366\262\223\367\362\330\332\313M\336\313b'"
+	.ascii	"z9\354\275\f\266\3662\223\017z\371\353\203^^\362^\366Z{Y\311"
+	.ascii	"{9\311\332\313]\357e\256\265\227\267\336\313Zk/g}\320\313X\033"
+	.ascii	"\364\362\325{y\271\366\262\325{\031\311\332\313U3\275|\344\275"
+	.ascii	"ld\355\345\"3\275L\344\275<d\355e!3\275L\365^\236\032\366r\020"
+	.ascii	"\023\275,\365^\216\032\3662\224\211^~z/+\207\275\f\304"
+	.string	"D/\377x/'\327^v2\321\313M\357e\246\265\227}\230\350\345\245\367\262\322\332\313H\023\275\234\364^FZ{\371\310D/\033\275\227\213\326^>\232\350\345\036\357e\036k/\3570\321\313:\336\3139\206\275Ld\242\227\207\336\313Bk/\007\231\350e\034\357e\240\265\227o\230\350\345\237\367\262\317\332\3136L\364r\215\367r\317\332\313<&zy\347\275\254\263\366\262\321D/\347\274\227q\326^.\232\350\245\361^\342\332{\363^\233\265\267\346\2754\357\235\361^\031\357\035b\330+D\211\336\024t\320\033\304{c\274\027\210a/\nJ\364\376P\242\027\306{}\030\366\276(\321\333\303{O0\3545A\211^\036\336\273\303\332\253\303{K0\354uQ\2427\207\367\3420\354%\001\211\336\033\266w\004\036\364\212@\203\336\020h\320\013\002\017z?\360^\017\254\275\035x/\007\326\336\rp\320\253\201\367f`\355\305"
+	.string	"\007\275\027x\257\005\326\336\n\274\227\002k\357\0048\350\225\300{#\260\366B\340\275\017X{\035\320Ao\003\336k\303\332\313"
+	.string	"\016z\027\360^\005\254\275\t\340\240\027\001\357=\300\260\327"
+	.string	"%z\013\360\336\032\206\2754\224\350\235\341\2752\f{c(\321K\200\367\016`\355\205a\203\336\0274\350u\341\275-\f{Y\310\240w\005\022\275\002x\257\n\303\336"
+	.ascii	"\224\350M\341\275-\206\275,2\350]A\242\027\005\022\275*\336{"
+	.ascii	"\002\211\336\024\303^\023\336\013\200\355-\341\275$\274w\204"
+	.ascii	"\265W\204\367\2060\354\005\341\275(\326\336\023\357\375`D\357"
+	.ascii	"\314\210^\023\357\365\340\275\035l/\007#z7\030\321\253\301{K"
+	.ascii	"\2747\203\355%1\242w8\242w}\357\210\367b\260\275\027\214\350"
+	.ascii	"\265`Do\005\357\025\361^\231\355\215\031\321\0133\242W\370\336"
+	.ascii	"\340{\325\355MG\364\242\333\373\367\366{9\310\004C\323\353\312"
+	.ascii	"\022\254\272g\351*\006=\377\212\314T\nU3q/q'q\027q\367\340\316"
+	.ascii	"\301\035\304-\304}\203\333\0067\017\267\0167\016\363\223\031"
+	.ascii	"\220\331\217\231\013\263\026\3469f,\314W\230\341\230\337\230"
+	.ascii	"\331\230\2430\2331\2371\2471\20717aV\302'v\271ie,\3509R\363\321"
+	.ascii	"K51\3119\274,>)!re\326\260\360\270J\252\314J\004}\2646RO\332"
+	.ascii	"he8\375\022cf\361\035c\222A\324\262\370nh\036\313R\236\354v\354"
+	.ascii	"\312\350\240B\024g\205c[\250\207j0\326`\200\231\230\220b\261"
+	.ascii	"KEP\023& .\034\372gY\355\351\214o\273\306\266\317\312pj\303\205"
+	.ascii	"\024R\330\2632\234\232A\341\355\254L\353\350\200A\321J\221\207"
+	.ascii	"\346\314\216H\302\034\263\032]\214\242&$pe\234\177+\363f\302"
+	.ascii	"\032\236\232\334Q-\356\250v\342\355\310\003{Y\033%7\276.Yi|i"
+	.ascii	"G\033%4>\264\343\2113\265\023\360\226%*\235Y\025\213E\231\272"
+	.ascii	"\225\341T\311\365\2047\267L\307\205#\313\312`\201\221\305\005"
+	.ascii	"\244C\030\007h\005-\206!@\253OH\261XT\341\266\314\\\2317+\255"
+	.ascii	":\274b\261H"
+	.string	"$lc3\242U\3067\204T\326\026\b\344\024>'\313Rx\n\243\261\332\312\244\275\030\232\303\352\303+\026\205l\316`da\371\3050\3333.\022\025\331\206\223\226\022\257X,\362P\306Pn8\n\nP\350t\025\207.0\326\205e@\310)\n\224\277\230lWfS\300N\026F\312\031\0372\253X,\312p\272\313K\226\305xle8mR\303E\236\342\f\247.Hx\t\020r\312L\030\354\206\303b\240\310\351*\342\310\364\024\341e\361\025\213B*8]\003@\211\331\024\354\312p\n\302\356\315\262\327\312\354\256\022\032(p\272\212Aj\223\0333\213\257X\354R\301\351\266@{\227\267\230\353\206\273\206\340\021\305\242\223S\205\220\323\355\342\fTN\205<T9\3357g\325\354\213E\344\032\224b\261k\305\216 \344twW\005\026n\226\306\006;8y)`i\351\371\342+\026\273Z\034\310\210\021\032\220 AB"
+	.string	"\037|\360\301\013\013e]\305N\342+\006 \254\253\b\377U\244i\312bwSXa\007\273\353E\202\004\211\026\026\003F\273xM\2544x\261\254\334\306\355\225\265\262p\313\334\267u\333\266e\333*Ke\327Vm\323\026m\317v\312\232\255\224\215\262P\266l\237,\331:\331\261m\262b\033\266`\313d\277v\311z\255\222M\262]4\314 C\f\004\030"
+	.string	"\f/\270\320\002\013+\b@\205"
+	.string	"\244\320\202\305\n\024T\234\220\302\004"
+	.string	"\224@\302\b\"\204"
+	.ascii	"\002\212\023\037\314\230\360\240\003\0166\320\240D\006$\206["
+	.ascii	"\267\216\330-\030\\`A\005\"db`\204A5E\277Yvn\351V\313\332ms\357"
+	.ascii	"\026o\363\226K\323X\366b\324j\3314fi2\204\303\213E\216\251\351"
+	.ascii	"\to\\\004\226zW\306x\255\230`2\216uS\223^8\264\013\0253\214\367"
+	.ascii	"\r"
+	.string	"E\021\306\325\353f\301\221^\033\n\266\330\366xTy\343\241\"bl\315m\355\214G\315\0073\2161\263-\035LMK\336\264\022LF\252E\221\230\214V\275hQ\252\316\270\230L\301b&\243\365CJ\225&Q\032\211\324\013\305J\223\222\267\354\t\211\261\036n:\230\232\224x\311J0\031\221\215d\024\211\311\230\324\353D\246\007\317\230\003v0ibt\354\025+\342\r\223\311\301\003\214\0036z\300\230|\301\362\225\366\324S\266\344\310(\017&\243O\257\027\252\303J\323\017\257\222#\363\r\237*[:\230\232~x\223\254\351m\327\231\030\rO\236!\360\3312\260\025!@2\006\201\210\320\263c\300"
+	.string	"U\017\030\001\270\260\f\200\213\007\fh\327 \303\221a\217\310\263u\334\365\013|\354\002\220]\267\320d\026\200\0305\343\032\302D\324\344\025\320\357\360!\305\320\327\023\327=ZZ"
+	.string	"u\254B\021\275"
+	.string	"\364\316[\2470\307-\320\2303\2622\026\240\210\f\351\234\266f\341\306+\032\240\204\206\002\212\001\033\232\002\225VQ\205O(2\032Em\b\023Q\025NQTeB\0174"
+	.ascii	"\354\320+!\207"
+	.string	"\036\tM\206\246F\bl\322\"\214q\b\177Z\r\202\030\243\b\343\023N\\myLDa\374\001z\002^\024=&\"\304\205f\0204\345\303\177\f\202\025\241\255\236A\017\247\306\024\003\022\210\033w\301j\023Y\354\001\032\304!\204%\357\316\210\353\226\335\301\025s\3007\300\272\004n\200\006w\202\246^\350\303\223\302tS\255\001\025\227\240c\224\013\307\020&\"*\316\200,.\252IH\361P\212\267\256\n\232\002\203@D\350\251\327\037DP<\202s\240x\267\240\030\024\213E\023LF64\005\020\210\b)5\006?\210\224|\001\223\205^\264\352\362\230\210\224l\001\bLDH\256 I\004\022\262e\216\332\030\004\"B\310\216\3411\0361\202VXO\231\016\246&2\206\331\331\372\361\342d\"*b\241\025\241#\212\242X,2\021\241\242\016\366Pa\020\210\b\025\265\312\203\323\230!\036\214\242' \331tX0\264\203f"
+	.string	"\327\264\205\325\270\177\206t\372u\274Y\232\217wN\311K'B\021\257\0261^\2731\336\246\033\357\335\034/\336\025o^g\361r\021\323rc\313\226\215>?\347T\020)\272\271\26752'5\376\334\332\254\214b\206\214ZYXWPQT\202\236\216\324\350\236\254\251\031\341"
+	.ascii	"*+c&\241 *O\375\020\"\301dt\322\242\2035\024\213\305m\237!\""
+	.ascii	"\336\030\274+C\302.\317\260\333\003\202D$\315>\233\002\312C\\"
+	.ascii	"b\021\265\226\310EL\322\354\343\3029\013\223\b\013<\372\301["
+	.ascii	"C\006O.\f\225a*\367T\313\tT0jeE\302\352\251\334\207Mww-\260\360"
+	.ascii	"\026V8\013\002X\001\007\212\263e$\314y\241E\342\032\213\271\300"
+	.ascii	"?\211_`D11\225S\001\234\3438\345\201|.\245\344\364sx\202\021"
+	.ascii	"\351\334S-=\250`\024\t\222\025\311\323\271\017\233\356\322T\b"
+	.ascii	"\300UH\341\001\350@\243H\276K$#\2265\373\244p\266\302$\324\374"
+	.ascii	"F<\271\334\303\235\026\206\312\005\251\226\247Z,P\301h\325\177"
+	.ascii	"vwW0Zu"
+	.string	"\016\364\322\242\323}\254BlI\021\003\024\030\255z\252\345\303\246\346\233\n\335\202\305[\2548\2137\231\006\032\205\357\022\315\210g*\373\2548\212\2478\ng\036*\306~\356\tWq\346\301;\362\023\216\266\355\016At\276-k\341\205]b\332\367\210k,\346\364R\234\231\234\252!\365\234Rr\372\371\35522\212\264\034\305\013\236\334`\025\275\n\030MDW\311\240\\\243\006\253\360\210\021r\215\212\036\371\317Z\360$O\375\020\252\340N\177\352\3455\233\223%\021\3024O\257.]\036\273d\236,2\321O5\341\314\264\304*\267#\372\231\330%\266}\013\361\255\204\262X,\266\300\351^\313\353\210p\304+D99\225S\023\316m\214\342!\267,\267\346\230\3078\006lm\311\211\207\323\2001O\256\006\260\b\323\3475\300$x\001\357\231\312T\030f)\315\307V\231\252\202U\237\377\354\276@\213E&\0328\215\031O\t"
+	.string	"J8"
+	.ascii	"\036\320\273D:b]\263O\t?_\037\240\r\255\352\020\357\210ys}_\024"
+	.ascii	"\320\273\304/\304\275f\037U\347jX_\027\246Q\003\3363\225\306"
+	.ascii	"\215\271\243\372\234\327\316\244\021e\301\334\335\376\366bY\212"
+	.ascii	"\323]1\307)\312k\247r\212\306\344I\177|\001gK|x;\307YV}\236\376"
+	.ascii	"\200y\322\tQ\233\360N\313\307\231\035w^n:\335\027"
+	.string	"|\222\251p\037w\304Q\231]i\323\351\276\025\362\236\251$<}\276\311x\256\214\375\\\035x\317\324t\313I\270\006F-`<Hc?\325'w\253\230;\307\t\036\223X)\r=\202\b\037\341MFt\212p\024J_\021\032z\005wX\337\020\346\316qN\345\347\013E2\n\367\024\307\013\227\027\235N\367\255\n\315\033\307{\246\206p\3766\217\027c?\027\204\207\260\177\3622\242\337\262\324\022\001\211\317f\037N\227\211O\225S\020ND\202-\2179\375\\\032\032\205\221\306\316\211\243\210\241wi\330\240\361\323\354s\342\307\353;b\032\217\2630\364\227\360\bA4\206\216L\236\017\216b\3478;\363\017\316&\276\301g<\270\211\257\370J;\270\007o\001\310\301;`\016.sD\203\017\277A\211kp\023\354P\33635\203\2278\nm$\236\001\006$\036\243\264\336\202\017G|\375\314\331\n\306\340#n\302\327\005\307"
+	.ascii	"\305\005\017.+8\314-\020\361\n\316\001`\363\236\2512\027q\023"
+	.ascii	"v1\227\021\306\\5\023\036=\314\271G\207\261\237\033\274\360j"
+	.ascii	"\033\n\254>x\016\316x\376\214\375\334\364*\232\236\253,\351\034"
+	.ascii	"g\177\364\334\023\230\323\317m\241\233i\354Pwi\364\240Q\324\354"
+	.ascii	"\363\237\257\257\007SG\005\323\0201w\216\263*4\273\035\215\373"
+	.ascii	".\215$"
+	.string	"\032J\315>\313j\214b-\355\034g\377|\362\236\251}v\373v\317\321\330\317m\321\3154\232\324]\032I\032@\232}\372\347\333\363S\321\274\306j4\242\\P\026\213E\366\331\245\021\204\006U\263O\272\345\254\306$\240\354\3551u\216\263-\307<\306\013\320\302\343\303\303i\300\335.\343\237t\260\332\001\213\007(&h\276\350<\037\2140x~\260\301\214\202'w\367R\2745\3404\3402\307p\031R\004\342I!\373!{\301\243\260 \373\251m2\340\026$\022\347A\355\243\266\331l^\030\017\310^\331<bfY\335i\237d\254`\021\224\373\3303\261S\220\260,\253+msfO\215\007\327\250H\373\244mv\031\336N\321\336h\233}\246D\"\261\016\217}\217mv\231\021$\022\033s\354ul\223\005\023\265@\241\375\3206W<\217\200@{\034\333\354;&\022\351\357>\373\237m\236\230\302\367\236}\215m\246"
+	.ascii	"S\373r\235\375\3166Mx\252\341\035g\237s\027\205,p\373i\027\345"
+	.ascii	"\206\337\366\3376\205[\236xYV\305%\276mg\235\224Z\226\325\227"
+	.ascii	"m=-Qa\\\266\273l\363\304\337\221\356n\033o\233'\266\034\347\266"
+	.ascii	"l\333e\341J\022R\\\242\333\326\202E\253\t\226\355,\333\234\371"
+	.ascii	";\312\335\215/\313\352\312v\3346\377\365\207Db2\267\341\334\336"
+	.ascii	"\256\204\264m\273m\223\305\237\032\033\225\355*\333d\261\345"
+	.ascii	"H%m[\rJ\025'B\212KS\266\317\312\334\230Q\266\245l\023"
+	.ascii	"\00525\262'\333e\333\3548\345\330\330\266\023&l]YVa\333b\333"
+	.ascii	"l9+$R\327\3276\223m\232\360\246&\203\222m/\002\360R\321,I\b\327"
+	.ascii	"v\3276\205\003\340\235\324',\313\252\270\224\265\255\265\315"
+	.ascii	"\226\233C\"\265\260\334\276\332f?\211C\"\255P\265\215d\233-\247"
+	.ascii	"T\241\310\266\221m\252`;\242 d{\3106\273M\n\211tB\220\355\251"
+	.ascii	"m\232\300V\002\324v\3246SLQ\013\001\310\266r\233\374'\205D\212"
+	.ascii	"\341\032\225\323\275\331m\266O\261X,\026Sp\272\333\311\335m\n"
+	.ascii	"\213E\034F\356\315n\223w\202IaYV\305\245b\nNQ\270\233\260\307"
+	.ascii	"\026\204,\322u\340n\227\221\321b\261X\354'w\031-\026\213\305"
+	.ascii	"\275\323.\317\361\006\225\030\013o0\251yx\203Hm\2037\330\243"
+	.ascii	"s\360\252}\235\304\253v\351\"^\325\355\275*\224\367\252>\034"
+	.ascii	"\205W\325a3\336\364\311g\274\351\026~\343M\2650\034o:\307WxS"
+	.ascii	"9\366\343M\2550 "
+	.string	"o\332\306O\336\264I\343\360\246\313\326\341M\217\260\026\336\264\310{S\345{\323\037\357M\235\336\2332\365\022oZ\004Boz\354%\336\264\207\b\275)\217\356\301\233\002\255\275i\215\2657\335)\24175\366\r\336\024\247\203xQ\300\026\342E\375H\350E\235\314\205\027\375\002\200^\324\216\273\230\3218\316bF\341N\364\242Ln\302\213\206\365\022/\n\326I\274(\223.\342E\277\272\007/\272\244s\360\242^}\203\027U\322<\274h\222\326\341E\273\032\207\027\345\342'/\272\305\200\274\250\026\373\361\242Y\314\205\027\305b-\274\350\025\317\361\242K\276\302\213Z1\034/\212\204\337x\321*f\343E\217\260\022^\324\310\366\242E\336\213\022\031\366\242C\336\213\nY{Q\252\367\242Sk/\032\344\275\250\324\332\213F\275\027\205Z{\321\247\367\242\312\265\027\005\362^\364\307\260\027Mn/\352\364^\264i{Q\246\367\242>"
+	.ascii	"\320\213.\275\027UZ{Q\344{\321\244\265\027Ez/z\264\366\242F\357"
+	.ascii	"E\213\326^\3648\323\213\366x/\312c\355Ew\314\364\242:\336\213"
+	.ascii	"\346X{Q\242\231^t\350\275\250\320\332\213\006\315\364\2428\336"
+	.ascii	"\213\002\255\275\350\215\231^\364\347\275\250\317\332\213\332"
+	.ascii	"\230\351Ek\274\027\355Y{Q\236\231^t\347\275\250\316\332\213\032"
+	.ascii	"gz\321\234\367\2428\303^\2648\323\373\347{\0378\354=\340L\357"
+	.ascii	"\377\336{\277a\357\373fz\357|\357\371\326\336\357\315\364^\357"
+	.ascii	"\275\377\262\366\336\313L\357\273\274\367\\\326\336\347\315\364"
+	.ascii	"\036\357\275\277[{\337\234\351\275\335{\277e\355}\335L\357\265"
+	.ascii	"\274\367tk\357\347fz\237\345\275\3072\354\275\334L\357\343\336"
+	.ascii	"\373+\303\336[\231\351=\334{\317\\{\3776\323{\267\367\276m\330"
+	.ascii	"{\266\231\336Wy\357\251\f{\2776\323{\265\367>m\355=\332L\357"
+	.ascii	"\317\336\373)k\357\315fz/\345\275\2172\354=\224\231\336\227\275"
+	.ascii	"\367O\206\275'\233\351\275\223\367~l\330\373&\357\275\330\260"
+	.ascii	"\367a\357=\330\332{&3\275\377z\357\227\f{\3575\323{%\357}\222"
+	.ascii	"\265\367]\357=\327\332\373\255\367^k\330\373\254\367\036k\330"
+	.ascii	"\373\253\367~\271\366\336\352\275G\262\366\276j\246\367G\336"
+	.ascii	"{#\303\336\027y\357\211\f{?\344\275\0272\354=\325L\357\247\336"
+	.ascii	"\373 \303\336K\315\364>\352\275\207\032\366\376\351\275W\016"
+	.ascii	"{\017\344\275\3771\354}r\246\367N\357}\323\260\367L3\275\367"
+	.ascii	"\361\336/\255\275W\032\366\036\371\336'\255\275Gz\357\217\206"
+	.ascii	"\2757*\321\373\242\367\3768\354}\217\367\236\307\332\373\035"
+	.ascii	"\357\275\216\265\3679\336{\242\265\367C\357\275\320\332\373\240"
+	.ascii	"\367\036\307\260\367@\357\375\215a\357\177\336{\237\265\3676"
+	.ascii	"\336\373\032k\357{\336{\236\265\367;\357\275\316\332{\343{\237"
+	.ascii	"\263\366\036\347\275/\256\275\375|o\007\256\275\r\370\336\376"
+	.ascii	"+\241\267\375\336\333}$\364\266\363\275\315\267\366\366\336{"
+	.ascii	"[o\330\333_\336\333^\326\336\356\362\336\346\262\366v\336{\033"
+	.ascii	"o\355\355\273\367vs\330\333v\357\355-\303\336\256{ok\031\366"
+	.ascii	"6\335{{n\330\333Y\336\333X\326\336\226{o\307\255\275}\345\275"
+	.ascii	"me\355m\270\3676s\355\355\267\367\266\333\332\333m\357m\266\265"
+	.ascii	"\267\253\274\267\003i\007\235\b\033\037Rk\353\211\267\006\004"
+	.ascii	"<\2712>\006H\201\236\032\025@\005\243K\226\274\201~\200\276\361"
+	.ascii	"\006z\273\361\231\247cN?\017\260\344)\320K\354\004y\343A\032"
+	.ascii	"\177|\336?lU\300|\316UPwN\0335\3366\324\322\304j\234\267\240"
+	.ascii	"\356\226=<\357\236)f5dc5Q\232\347l\005\325tJ\351\235\267\316"
+	.ascii	"{\347,'\204^\020J\2150\370$XVCVV\023%\212\312i\353\274\217\234"
+	.ascii	"VA5\227R\f\320\306\234\267\361\334\023\2303f\226s\025\240\354"
+	.ascii	"\276\304)\242\212\024\240qv\3368\3143j\027\237\356\200\325\234"
+	.ascii	"\325\354u\361l\004\225\345\031x~\002\236\003\203^\301%7ii5kk"
+	.ascii	"*\247\f\370\023\260\254\035s\372\371\347w\376\013v\021\375\252"
+	.ascii	"\020\237~W\001\n\313\362\270\327dMH\r3\260\3365\300D\206W1\223"
+	.ascii	"\305\240\202U(\377\331>\347\271\257-\250\225\345<\023A\305-\371"
+	.ascii	"\366\316|o\301%\321\317j\3570Dg\177H-e\032\323\251By\252\374"
+	.ascii	"\266\017\227\034\032f\bz>exri$\361\2273\031\233N\367\355\241"
+	.ascii	"0\1779\353\035\265\343\2712\302\005\213\324d\211\201HM]\013C"
+	.ascii	"\276\234\271@\275-\275t9{\271\022\234\n\"\325\305iC3\227\274"
+	.ascii	"3\027\271\340SM\226\022j\350\202\312\232\272\021\346\200\344"
+	.ascii	"\235\215\240\334\226[xwg\274\032\273\240S\220)"
+	.string	"\330TsW\223W\323\245\213\312)\337\235\205\240\332\234\315\032\347\346\214\312vOk\004\223\202\310\232e\251\255\371R\263W\263\247r\312vg$\250\266\345\321\013\247\200\352\302\214\341\311\335-Mt\336\202D\345\2727\2213XT\343w\254K[jIy\234\265,U\246{\312\243\0060\250\243\346\231\203\3169\3278\316sX*gy\343\300\t\006\331\030qd9\033A\241-\345\322\343Y\356<\306#\310hh\251\034\367\364\270\023\364\261\351\t\326\b\332\260\261\361c\003\004\244r\312q\3471N!\345L\n\251u$\300\223\273V\340\316V\230g\270\324\310\374vf\006\005w\210AcP\307f(\207\315\216\035oF\236\002\235G\2745\f\340\311\3356\266s[\217`\361\311\366\267\254B\345\\\245H\375\363\243r\026\362\264\347\\S;\257\235\311\216T>\233$=u\317F\311\207MS\223\312)\253=\355-\267v\360\326"
+	.ascii	"\203\013j\337S\250\035T0\352\365\201\327[GG\361\361f\343\005"
+	.ascii	"\257\253}o\035\\\201\257\2444\036\2441\r\355\234\226T\363\234"
+	.ascii	"\360\356\320\234gS\316g@\324-D#\214\225\262\245:-S\316HO^\226"
+	.ascii	"[9fR\316fY\260\374\311\305IqF\201r\216\002G4\262\230{R\2316_"
+	.ascii	"0V\236\360\275\271A9_=\335-\313\236\234\313\242\324*^\250\254"
+	.ascii	"=9#=5\311\234\234\311\202\250hD#\214\225'x=v\205\340S\317l\250"
+	.ascii	"\256A\236\234\330\221\231:\305fH\021\233#H\234\274wp\212\364"
+	.ascii	"\324l&TS6\\`!\305y\n\265\202\nF\225\250W\214*9\267\240\344)\316"
+	.ascii	"\033\210+\360u\364\344A\032\307\232\234\307"
+	.string	"\240\35049#\237\2608\305P\346Y\354=\304#\236\\"
+	.ascii	"\225\303\2162\227\252\023\033,\030\242'B\306\232\204a\001cr\006"
+	.ascii	"\003\023\242\206\315\230\220\311\231\350I\316\371\005xN\322R"
+	.ascii	"\227\330\234]\220\363D\351\245\344\353\214\367$\267\\\202\372"
+	.ascii	"q=q\312\261+D\237\272\245\265\344=\024\347dA\275\362\373\017"
+	.ascii	"'\023\247\001WP!\210\364\024J"
+	.string	"\007\025\214&\371O\222w\017\307\3311\341\004\220\344A\244w\017W\340\313(\215\007i\364Rr\366\342R\221T1\217\030Qr\026\362\304\226\244\353\234$\211:\204hDA\2716^\252\020\233/\030\"\262,d\026\325T\327Y\310S\232s+\207k\353\314\005\246F\021\2150DdVPO[g\242\247\264\345V\216V\326Y\353lg#\246\376P\223(\200b3&t\241r\312Yg\242'4\347\326Z3\326wm\312l\2424\373\004{\234\207\226l\314T&\233\263\n\230\310\204\364\215]!\376T\0376ih\006yz=t\252\222\272d\263fS\305\246\355M\345\224\261\336>\234NyB[\256\371Q\301\251\200\002\213\375\320b\356$y\372\201\025\200'W\206J\213\364\310\203P?\254\r\234\315\225\023\312b\221\207}\320\256\377\020\251T\276\372\001T#!\002\211T\302e\035TN\371\352\275\303\031|\375\030\245\020"
+	.string	"F\273\236\036\271\006\311\"0\036#\306\245\325yyu\266z\357\260\004\276\212\312z\002[<\2712ZV\244\313\247P0T0\312\005\306(\327;'\211TY\036\013\256\247\313k\360u\004\343A\032\221T\235\221\310\251:r\020\351\250\022:\3424R\344l$\213\nt\343\307\310&\257\305\\\021\033D\316[O_\313!B\316C\316vt*O\215\013s;DQ\335\261\251kA\2716v\252\216\315\235j\274Y\262\311k\221"
+	.ascii	"\225S\026r\027\350\266\324\242\212\223\200e\251\265\351b\363"
+	.ascii	"\305\346\213\312)S\275s8\335zZ\342<\266p\205\314[\361\344\356"
+	.ascii	"T\220\363\024\340\337\217 }R\316(\250s\324\236\236\024\324y\311"
+	.ascii	"\223\227\247\263\232\022p\251\004rV\346\021\375x\211\322f/\305"
+	.ascii	"\263q\022\271\tjA\t\344\274\344IJ\363\307YM\371\227t:'m\374\322"
+	.ascii	":+'\272\246=&\037g&\033\300\024\313\326M\220\320\307a\266\342"
+	.ascii	"\226\364\234J\310\263\022\034s\t\3622\320\271%}A::#\255H\253"
+	.ascii	"Pir\244f\344,:\236\213\316\246@9~\206')=\316hJ/\313c\016\217"
+	.ascii	"\035g\036g\262w\245eO\320n\202X\230\333q\031\350\2448\321qFS"
+	.ascii	"\3369\2179\210\3169l\236\251\030\321\217\215\bl\350\254\246\274"
+	.ascii	"[\n\005\235\205p\322%V\202\224\340p\002\3358\003\031S\256\271"
+	.ascii	"\033Z?g4esy\314\361\261q\3669\223\355\244W5\302\024\310M\363"
+	.ascii	"&Hh\3430[V5\320\224v\316#\nO.\f\324\ti\223\247P)T0\272\265u\346"
+	.ascii	"\242b\353i"
+	.string	"\223\257_@`<Hc\017\317\271\347l\227\223\036\251\241A\331\223\032\361r\023\344\002\317ix\"\262\363.r\352\246\334\342<\346\364\363\204'wu\214g\035\252\032\031\346l\244S7}l\274\ftR\234\343<2\016\027\3178g2\024\322\247\232\031\224{\363\223*o\200\204)\020b\361&\210\205\271\005\250\234r\3613<II\235\322\344\002\226\245\366f\350&G\016\225S\032g4e\226\0279E\323\0213\005\361\346\304\035\251\017\242Q)]\272\351Qtst\244rzs6R\252\340&\"\346\216M\315m\316d=\2019I\351\021\321X\224\032\335(\371\270ijR9\255\021\242\214[bB\312D\363\224)\231\362\330A\343\266d,3\316X\200\244DC3\316U\312\266\324i\214\321\"U,\343\251\323S\212\343&JX,\352\264\260\351\215\024\350&\b\325\315\220!*\2472\316c\234V)\333\226R\2745"
+	.ascii	"\300\206^\246\261C\025c\252\302\334\331\342\024Lf%\f!\304\207"
+	.ascii	"8\223\245\340B\360\217\336\2759r\203\244\331'\005\377\032\023"
+	.ascii	"\222 b<\bn\352\335\033\254\033\255f\237\030\377\032SR\003r\n"
+	.ascii	"\246\"\022\200@\301\2018\377p\024\3040\007*\214\377"
+	.string	"p&\343\2712r\24597i,R\234\033\260\022\322\"\214\263\225r\211\323\207\027\367\241\207\277H\202\002\376\371\365p6\242\\\262\334\3129\201\t~\2023\031\0177\201\027\312w\223\266\342\346\013\335\273\001#\001\375\202\352\335\210\215\335\220\221\251\234\362p6\242\364t\366=\001\2318\r8\302\223{A\223\020\322\266\247P>\250`TK\353;\234\233:|\207s\031\332\245F\230\207r\271\211bvsv\246r\252\3039\220y\352i+\247\237\"h=m\373\t\343\263\254\004.^\202\034\356\342\254\203\332\335\244\325\241[n\326n\252\334\264\335\264\251\234\346p\016\344\324H\tp\371\020\236\\\030-(R+O\373^\354\017\377q\f\023\b\314&\250h\326S+\037z\001\226\241P\241q8\t\216\003\013\365\r\337\275\201\273\271\322\354C\002\036\364\312\226\tQ8\324\312\215\334M\226\033\272\033:\225\323\033NT\362\262\2242"
+	.string	"\"mVN\230\020\244\367\207,\236\351\271d\356\034\307\004\\\223\272\017\236d\032\352\b\316Vn\352\3206\032,\346P6b\327\215\335\ne\261X\264A\345t\004gA\027\202\177\340\"8\363\0301\366sM\340\255\242\202\340!8\363\0201\366s\321\254\203\340\351\031\327\350\335\233\274\233.\315>\0378\377\361\220\371D\3024\036\247g\372<@\277<\205\002B\005\243Xh\016F\261\316]x\351\343\2514\201u\364\313\207W\374\262\360 \215\036\350\300=\360\005E\223\362;\233\322\001'\0076p\016h\340\033\330C\243(\373\240\224i@.\003\030x\006.p\f\234\235\250\023\342\216\n|\004:9\307\232\\ \316i\201\n\334\002g;?\024\214h\254\300G\340\022\037\223\257\n\234\247(\305-\267r(0\201S@\002\237\300\031\020UB\334Q\201\017\300\277\275$]\022pF"
+	.string	"\002\217\300\315\023\325\342\323\313\302\202\300y\212\322\333\003\034\360\007\234\355pP+\242\261\002\037\200^\276\354\016Q\003EB\334\271\006prG\320*b\217\r\342\017\220\312\251\003\316]8\235\242\344\346\334\312\351'\325\023\245\007O.\214\021\007i\221\247P(P\301\350\325\177\322\030\275:\3271Ls\255\360\254\221up\365\264\310\327\246\2762\033\272\001\004Xb\020:\004\0052Q"
+	.string	"\263\270\b\241j\300\371J)\315i\003\003n\303\002\316\200!T\312*/\nj\001g+\245\264\345V\216\002\022p\005 \340\t\310\201\002!\356\220I\002h\004\357G\022\001g+%4\347\001\f\360\003\024\340\006\350\2012\t\271\363\261T"
+	.string	"\264e\r4\274\206\031NC\021\232$\325D:\232\341|\245t\346\334\312\221!\206\313p\266#\300c \036\241Gb\222L\024@%2\313nw\b\037\264\007Q\251O\370\370\003\013\222U,\026_\330\201\362 \372h\"&\201\250\234\022\340\\\307\351\225\322\331r+M\207\222\214\003\030\032\003'(\0211\310\007\312b1\207}\026\025B\207\210OQ\304 A8,P\253\353\230\307\230\225\201X\314\r\236\\\231\253\022A\245\247Z2P\301\3502\230tty\016\364b\323\351>\276\242c\004\246\301\362A\245\227\270\302\267\307\2034\016"
+	.ascii	"\206\017\340"
+	.string	"\205\303p\276\201\336 R\2650W,\352\274\260K\034\202\376\020\227-\346\212E\235\0268]\324\006\352C,\242\245r\372\302\231\216S*J`\2536D\007V\302\205\007\223\336\200.z\321\236\273\003\013\031@\264\220\001\304pw`\021#\b\037\\\274\b\"F\nL\220\303\r'v\007\0261\\\344"
+	.string	"\343\205\bp"
+	.string	"\242\005\016\034\354\016,b\300\020\002\b\0271Zx\260;\260\210\261C\0207\274h\341\003\214\027/`\340\320A\020>\270x\341\203\016<\364P"
+	.string	"\030@\314\320\241\002\0310\f\220\203\213\023\370\300C\01702`\220\3408\260\017.\036\340\342\305\r>\004y`\027=\334\200C\2144\007\030\020\bb\007\035x\350\241\004\027\304\b\202\007\003\350pC\017%\020\006\341C\n`\034\300E\0203H"
+	.string	"\023C\207\033zP\200\213\036HpC\f\036\020\240\203\017<\274"
+	.string	"\342\2065\b\027\026\210a\203\213\027<\\\300E\0207 "
+	.string	"\207 \200\300 \210\034:\007\037nx\361\002\306\001rp\021\004\0200~\370!\0051|H\301\032D\214\034>\001\013@ \207\0278\250\213\003\213\037b\274h\361C\214\027-|\340\341\206\027-p"
+	.string	"\"F\013\026\031,\214\037\\"
+	.ascii	"\321\"\b\0300\200h!\263\273\333\225\303wZ\366ba\034\326\226\236"
+	.ascii	"2\027\250\033\363\030\303\340u\241\322S\226\0033\r\0255\202\026"
+	.ascii	"9\fK97.j\344h\221\263\027\237\260l\032\263\200\031\345<\237\317"
+	.ascii	"\234\022|Ho\t\251\205\247\244\237_\200\236\344\270\340\260v\312"
+	.ascii	"R\204\211\323\2009\304h&\034P\"C\216\022I\353&\242\337\220"
+	.string	"\263\321R\316)\204\352\250\2205*\271\345T\220\243SU\2028\245\242\216J\265E\305-\241\236\216B\275=9\267\224@\216*\341\272\251\006\310\371\270|C\177\240\311\243?\3362\256t\023\232<\033-\335H\360\244\323\231\251\235\272\311\351\335\304\253\030\026'S\207S`\351\302\304i\300\033\236\334\0238\216\340\020\301\2750\211'E\236\204`\271FE\303\376\263MaG\233\256\0021\272\033\301\223\"\270\023\312t \274\264\2205;a1\031Y\2042\350d\3245\373\240Lg:,\\L\235\343\370\260;\352\343<\3060CTt\351\250\235\b\037\"\230d\330-K\255\214;\031yy*\247\350\322UX\2229\217M\334O\212,9\361B\360\344\256\022\362\250\222\214.\"\220D\243\210$\024y&b\205&\241HG\223d|\021a$\342(\242H\306\236\f\247\f?\031~*\247(\322\271\312*\313\022=B\215\216\036\311"
+	.string	"\024\261\003N\204\016\324h\313*\316\no\r xr\267\350x\264H\306S\304\020\224cP\217s\225\025\333\222\307\216\243<pD\334@\333q\230-\021>:.S\344+\013\251\225\203\350h\016\243\210\0366\242\303l\211\330\031*\023\n:*\264#\"\307\212M\2360\3500[\"\2128\234@\350\215\243@2\200\177s7\372~\236,}P\033G}d\366\364\2326\274\324p\036\321\036\224\347h\217L^\r\013\312\235\321#\203w\0034\204\027\233\274\025s(\317Yx\222\322Dw\316UVd\250\016j<\252cC\246n\210>\233<\241\3610th\316\271\312\312\311\022\305A\213Gq\260\020\375d\220\221\213+\242\305\313`\345\t\266\f\004\374\003\337\210~3(W\310\270\265\361"
+	.ascii	"~\206\247*\177N\277\276\337\357GF\215\350'\003\n2i6u+\314\311"
+	.ascii	"\240\311\270a\223\307B\331w\031\350\2468\317VVL\370\366~> \231"
+	.ascii	"(D{ez\347*\253%\313/^\376/A2N\216^\232t\001tr\311\373\271\f\311"
+	.ascii	"\200!\363\276\360\366\356\232\377]\016\031%N\315.;/[\352\376"
+	.ascii	"-;d\264j\240\352\260\264\234\253\250\356\256\350\346~\272\036"
+	.ascii	"2Hj\204\314\035\311r\256\242jra\221\373\261\024\311\f\251\222"
+	.ascii	"\243\212\263\273b\345\277r$#E\364\313\262\002\005w\266\242\332"
+	.ascii	"\302\305|\373\231I2?j\224\2749\271\235\253\250\262\264\261\375"
+	.ascii	"mJ2>\302\330\224\252dYRY\373\251\370\220A\"\372=Y3R;[Qa9\362"
+	.ascii	"\320\301\3349\016W\032\332\237\326$\223\243F\306\0244\231\241"
+	.ascii	"\263s\025U\334r\312\315\376)I\031\03452\250\230\311\334\220r"
+	.ascii	"\256\242zs\036\377\372\266\370\230;\307\021\333\332cr\212\255"
+	.ascii	"/\314\017<\271\033\005\312\037\005\210\314\016\023\212\214\261"
+	.ascii	"\314y|B\366?y\222)\022\375\260\220\005:9[QMY\036\307\232\374"
+	.ascii	"cQ1~}M\234ba\277X\220\230=\233$\275\2603\222\252l\t\306\344\007"
+	.ascii	"\243\212\351R\343\205I\336\327\271\212\352\311\362\270\304\353"
+	.ascii	"_2$\246)\243\317k\213\222\263\025\025\331\362\230\244\353OR$"
+	.ascii	"\206n\256\313\311\265\365s\035\211\221#\032\343\266\316HTN\226"
+	.ascii	"ZY\277\026\222\0308f\226s\013\353\352\307j\263Ib\273:#\251\300"
+	.ascii	"\226*\266\214\230;\307YZ\375\313e\214\032\321\230fuF\242b\262"
+	.ascii	"\334BR"
+	.string	"\365#\301\212\231R\243\243J\312\221s\025\325\227\221\"\277\021\255\230\262'E\316H\252/\"C~\"\\1cM\206\234\221TK\204P\375B\222\304\2001Q}M\235\255\250\226,\217A\244\376 ^1J\224R]QO'\324\323\017u&\373\212\321\262\311zz.\225@~%X\314\322&\311\n\310\0319\025\350\334\372\221\374\177\210\305\034\251J\026\271\323\331j*\360Mg\372\233f\214\305\bQ\2153\262l\362\316t\230\230\251\3738[M\001:\217_\272\322\277t\344\257D\026\023e\223\024\003\205\004\\\262y\340\311\335$\244?\251,\006\310\017\2443\322\324\336\321\215\376\243\027\375F\347(1MD\246\"\347\261\307\1774\213Q\262IB\3668#\247\364\226<v\374<\316b\216\214v8u\344\370u\314H\213\351\301\3439\316HS_\226'\372\320O\024\223#\206h\350\2144\345\305)\024\364\013\255\305\004\305\340"
+	.string	"z\320\331j\312\013\326\326q\034\350\3071\243J\214\215\032\007:\013\231\272\373\215\237\377F[\314\216M\022\213\271\030\235\031r((c\214?\347\253\251\246\323\307\306\357\363\026S|\006\3328[M5k\364\3745\340`\374\210F\0263\256\300\364\315\220\003\200\252\007\343|\317\331j\312\216g\347\347\311\002\243\347\005\346\313\f\272\255\233a7\303N\345\364;g\243)\273\345un\374uf\334\301\344\341\335\2104\265e\215;\360\344\312\230\351m -\372\314\230\331\224\006\322\036G\301\376\2639\307\371s\354\266\034\347m\371\342\363/\322\315\315"
+	.string	"\024>\317WSn\316@\300w\240\\\034\340\031i\312\355/5\276\377\212\250\355\367\324\370\236\336\235\321e\306\227f\237\366\373\243\\}a\032\373P\347\273\357\355\343\210\332\316\243\316\031{0m3\2340l\3163\221\251\264+6>\2607\337\325\244\226;\016\250\241\301\244m\321\205\230*\333\300\f?\230)R`\314f"
+	.ascii	"\256\240,\026\2133\23648B\2461\252\234\246=.\304\024\231\006"
+	.ascii	"\236\3340\356\275\237N\247\373v`\240<\201)\243\351\261A\363\363"
+	.ascii	"\263\367\366\301h\337\224\223%Q\006\236\334\325\373\362\326\003"
+	.ascii	"\202\031k\362\345\\5\365\265\364\322\345\355%\b\006\214I\027"
+	.ascii	"'\227\2747\227!\030/%yg\253\251%xwo\274\0340\\D\243\026\314\026"
+	.ascii	"\315\216\0364EEwVA\236A\2745`\340\311\335\246\335\273"
+	.ascii	"y\004s\265\264sn\251{oI\202\251:Rw\256\n\002\250\205\356\255"
+	.ascii	"E\t\206\210M\222\020\230!4>\232h\222I\225\323\246\013\362\347"
+	.ascii	"\274\301[\303\005h\200\320,\2530u\3148"
+	.string	"\005\2225\013<\271;\227\345=\367\004#e\223\024\225\345\\\025\304\016\213\334\033\313\231\214&\252\345\376(H\2120\215( \211\273\362\216\243\t\002\223\204i\202q\242\241\031BCs\345l$H\026\024\220$1\3218\005\222\"f\005Z\256i\220\320,\221\344h2\266,:\361( \001\265\313S(\036T0\312\204\311\033\3110\315\t0\271\332\345kr\354M\002O\356Z\201{[\301\202IB:2\202\303\262d\276\275\231Z0=x\354\320\361\346tk{\273q\301\f\t\005\341h;\363I\3115[\2257[\022\230\037\242q\006\245\017MY\fs6h\314X(kT9\363I\3059\251\254\275\251\234\355z\002s\274`vl\222f\230\203\321\241)\223A\tc\2441c1\007\223\263v\356\223\212[\362\225Fr\251\255v\276\022HC6\003 MY\f\1774f,\374\324\316|Ro\316\b\240\310\342\231\232\350"
+	.string	"\002\201'\327\215;\355\314\344\245\245\255\033\355\2734`4b\315>\235v\f\320\214\t\371h\310\030L\271Bp\021\356\321\224\361\327\\\261\250C\023E\250Gc\346\202\320\213\360\013\315Y\032\315\332\232\312i\243\275\221\254"
+	.string	"$)\267\007<\215W\310\205\246\2120\217\246\r\206\210\033\223\307\001O\356\236My\237\321\274\t\355\266L9J\2359\217\360\326\320"
+	.string	"\006\250nO\241L\240\202\321\257\257\267YKy\233\t\265\b\351\244\274\215l\370\272\352\366\023;bY\242@yG9\333\245\315\2627\024\016\236\274\313\310\336O\216\312\301\t\257\020\215<\302J\034_\222\025\270&\273\212$U\266l'=\366vBsE\350F4^@\024\347\005iW\b/\3026\03294\203\274/bU\204U\204l4Y\350h\352\354\306\336F\234r\221z\302\200'w\233\210\275\233\334\t\325\322\304\234\204\201\275\303\362\204Sl\222\314\300\316UR`L\230t\021B!\032\313\276\316F\244\300\226x\275\227|\021:\261I\032\363:WI1q*I\362V\262'\f\003Kr6\"\305\244\213\353\335E\343\024.\021*\021z\321\370\321"
+	.ascii	"\322"
+	.string	"<i\236\\F\244\276\310\026\360\344n\314\223\271\245\365\336\302\021nii9\263\260\336YF\341\325\022\353\313\362j\371\276\332\021V\035Y:\255\254z\204D\206 \361\262\254:\362\256\262!\234\nr\344\316H\221\267\221\037!\324S\021\"C\336D\316d@\302\037\311!\347cT\323\bs'\365a*\"\314\235\343P\ta\356\034G\b\325[Hpn\352Mu\346A2\321O\355 \357\2513\017\021\343;\3107\260\013\022&!I\235\215\242\344\226QP\357\250!a\321\021\312\371\244|?\345\020\356 \032u(\317\307\250\270%\220\037o ;\204CB?\222N\357d\017!\220M\322\r\247\263Q\324\333r\253\211\351\335T$\264A4\326`:\037\243\334\234>\226\336>\216\204;:KnK%\344[)I\210#,\"\223\220\336IJA@\233\244?\244\263QT\333\362\310\350}\344#\350\334\013\362\3254%k\200"
+	.string	"1:F\2619\211(\340\311\335\242\343\273\350)\350\245&\252K\037\317\310(4g\367h\036\357\036g\262\232 A\274`3xWC5\244\246H\021\225\323\346\201\214B[nQ\361\326\220\200'ww\350x\357\310\361\326q$X\247\205n\256s\\\255\212*s\366\220\320{\350\034\364\026:#\t\312\021\223\230\254f\031\214\253\301b&[\243\025\274R\303\265\2022\b\027\264R\223\304\253\346\353K\345\211\302\250\344\002\327H\fOhc-NA\204\320\030\t\203\004$\343\031"
+	.ascii	"\b\305\3618\216[(\357\024\200\016KnLzbJ\240\023\223@C\341@\330"
+	.ascii	"@\004\240I\002\343\tX\273\247\362\275\177\266\344\344\003\037"
+	.ascii	"\376\032\337Kal\373\363X\351\031\226\206\360\3617I(\251\t.\f"
+	.ascii	">\223\350z|\365\202bC\027U~-a~b@\215\207\343\351p\3644y\235\201"
+	.ascii	"4\227\224\230?\371\177.K.@\016A\274\216Rq\322#8\267`\215l\201"
+	.ascii	"Nf\261\347m\353\017\007\321\t\257\017\251\227\333Q\224\221Q\031"
+	.ascii	"\r\226\215\240\024\274gISb\372\213B\032\261;\360\223H\266\341"
+	.ascii	"\026\306\027}\352\211Z@\317z\034\304\235(9\005}!\301\307\021"
+	.ascii	"\250\263b\320[\372\334\312\0240d\257s\215\307\375\235\325p\371"
+	.ascii	"a\243&\351\210y\370\312\177\013\374#E\302\017[\244\353\026k\252"
+	.ascii	"\257\007+&\354%\234\377\252\265u\316\217!\261\342\022>4\261\316"
+	.ascii	"^C\217oFRo\311\351\260\017\277\007\263\037\321yu\223\350\316"
+	.ascii	"G\346\202b\250\246A8z\022\317\0275A\232\362\003-6\216\206\206"
+	.ascii	"\0227a\370\3107\221\\QQ\243\361\215\021p\364\b\203\377H\033\321"
+	.ascii	"\302\261\207\323\234\353\023g\324N\355\367"
+	.string	"\315'Q\230x\021\006\001SG\272\371\030\276\n\375\367j3\246c~ \260\356-\377T\0210\034\262\261.\003W\336\313\325\315oC+m?\244\b\255p\205\300\351\031l\3300\371\261ON\2168\367\211\274\354B.\271]\271\006/r\271\270Q\275\277G~\345\214|\334\307r\2632l\342\3260\251\245d\350\270Y\234\201\262N\207\3100!\3741\353y\224\205\305%[\203\241\301\345\037\254N\035\341\221\353\353\2003\212\032\275\002\274\021\376E5M\020\035P\266F\311\221\314{\341\321\204\"61\210\273\001[m\303J\366:[\006\035\371p\215\304@\331\352}+\252\331\263\323,\353qM(4\350\003\200\301\0063\366\345\201\271\217\\\233\235\264\316\215)N\277\177\032x\021r\375\3748h-\031\n\313\234\341bNi`Xd\222\274\034\303\314\212\230YAQin\202\216ve\340\311\325\021\301i\252=c\273\236E7"
+	.string	"{\b\225\027\343\365U\246V9\344^\033\317\bmq6\354W\263l\021\206\037g\253\370\021\016\231\224D0\026e# R{\214\004\247\370$J\237\n\351@\313G\226?T\003\277\267\303\261\271\323i\035\177}a\213\030\246\265a6\031xpy0\307\032^\031\334X\246\027\n\360\350@\246\341\227\353d\356\253\250L\371\364\234\314H\213^{/\344\215\240t]p)\026h\326\270\304\033hN\226\2549k\017\251\347\375\b"
+	.string	"\257\227\035qC\3217\241Y'qcd\372v\033\221s\267S\356\207\177\360\302\006`\254\3608p\252\276\250\017\312\310\"\344\353\234Ta\363f\005+{\331C\373z]y\333\013\333/\361F\033\263\216\033\2603\254\242@\245\247d#\347\230\251\323\031\203\252\371|\2623{\363\325\351Uq:+I\205\006\302Y\214\250\346#`J\205\236\303$\341\300m\005\266;\250\260\307\f\222\232\371BsV\342\253\001\212\312\310\2008B\244?6T4\037\244^L:\0306x\001\212\354fw@3\225\307\037\301mW\025~\316w\350\267j\301\243t\330 e\327\262\274\226\213"
+	.string	"\3120\255-qNa)NW\306\334\332\261\341\022\230W\262oq\034\003\250\352\025\332b\322'9!E\177\252"
+	.ascii	"\362S2\017\276\274|a!f$\235\030!`W\200`\025\270\226\225?*\317"
+	.ascii	"\345\307\245\rJ0\240xst\247T\232x%\205"
+	.string	"\377\342G\315^a\357V:xd\210\274\307MX\324\201w\02028\201~\342\022o\261\221\220\250r\016y\263J\214e,"
+	.string	"u\304\250\030=\244\207\377\257\372\336\r\333\307\270\252\376\f\244\313*\345R\206\333\355\365\021\231\340I#:wH>\344\377\026\337\243h\355\302\206\254\344[\353\232\360p^\330\240\3250}=\226)\303\0028\026\327\037@\007\216"
+	.string	"\013\006\235\020\322\306MlA)\253=\332\260\b\216\224H\337\005\223\307(3\354\316\222g\036\026\266w\236\374\"\335\302\020\370\357\320\322@\316\306ts\005\314\254\007\001\220a\367\311q\307\365\246\r6\005\323\256\247TXg\344\001\257u\202O\342\275\031U\270\025\364Fj\264\"<@C\267V0\316P\"\016>\224\016r\313\205\t-y\260\324\255\337z\323\262\306&\360{\271\b\347,\270\213a^\001z\206\2713\341"
+	.ascii	"\343l\235&x\362s\003M\301\250\353\225KC'V\361\337\005V\257ur"
+	.ascii	"\025\311U\330\230\321\024\215l\223HY\210\021\200%}+\325\036\206"
+	.ascii	"l\363\215\260\305\231\342\233\317\304E\343\276\2714v\260P\225"
+	.ascii	"\203`m\354o\267\036\324PT\260\202\243x\355\034\247Q\321Q\b\305"
+	.ascii	"\303\303\320ud\301\207\260;\314L\r\266\350D\022-'\247\230Z\007"
+	.ascii	"iMQ\f(\237c\020\035\212\270\254\245S\346\2644 \244\377kN\365"
+	.ascii	"\013\225\243\370 \3465UX\257\261\021\254D\313\270\0233c\340\224"
+	.ascii	"\317\274\374\357\365\344J\tK\\\200\034q\226\300\n\t/2p\003:1"
+	.ascii	"\r\371c\320F\252,\206\311\030\315\214t\364\020#+\274O\024#\341"
+	.ascii	"\340\212u*&\2675\315\337\262\210|T\034I\267\261f\2034:\356Ui"
+	.ascii	"<5\316\316\035K\372\270(%\237\f\257\235\001\363\305&\220iS\021"
+	.ascii	"\0063i\352\001\3530\370W\364\345fy\214\334|\261\344L\354\263"
+	.ascii	"\266\241^\273\345%GO\366\213M\222\025\336\303`\037M\217,\332"
+	.ascii	"\371\030\220\005\321\031\216\2313\305\331\300$\025\023\350\256"
+	.ascii	"4\221t\033\300\252\331\2700\343+\347\237\030\250\264\027\177"
+	.ascii	"\307\351\213\004\323\033:\204\203\335B\002chI@\035\\\365c\nv"
+	.ascii	"e\0327\252\031\030\225\261\336\262\026W'\230\357#\003w\223z\335"
+	.ascii	"\260TwC\254\231\223V\304+\r\326\003T\030\344\317\206N\213\252"
+	.ascii	"\f\223@\bN\334\217Q\353\211&K0V \314TkP\202\t\220\312\361J\310"
+	.ascii	";$\rh\031\231\307\222\262\264\311\n\265@I\244aE*\335\016\313"
+	.ascii	"\2754\325\025\267\3745\236\310\321a\347\262/\325L\314S\272\236"
+	.ascii	"\373.i\036}\b\003\335\376\346!sM\360\022g\356<9\0130\344\363"
+	.ascii	"\023k\330\206#\2240)`\231q\211\261\bN\251E\270\340\240\322\256"
+	.ascii	"\255\267\205\352}#Z\207\247\213\206\352\026\253\210\212L\244"
+	.ascii	"\242\tdv$I\321v\227\334\202\237\240/=\032\266\036\251\307\371"
+	.ascii	"\242N\252\261\2451\265\260(\037\036\244\247\221\346\372@vJK-"
+	.ascii	"\250R\226Fy:)\016\232\023\334\350:\\\221\345\272\347p\206[\311"
+	.ascii	"#\034\252^\221\340s\312\263\312\211\220_\227\321Q<\252\"\242"
+	.ascii	"\bV\026\242\364v\322\260\301\037\215,\205\217\235\360"
+	.string	"\\\357\233V\272\355\231)\013b\317@\273-\224\372\354:;\022\352,J~h\344\227\326H\307;r\224q\023G\336`O\365\276\367\231\347F\030\370-\354\310\325\3178\322\361,\200\rv\246\341\230r\b\346T\323\305\302\020\307[\232\357[\211\031\366\223S\277\224\334\235\260\031\th\306\256v\251J\257p \205\312\336\b%\250\364k\223\340\321\242\371p\302oHk\320\306\242\203e!'m\235\277&\234B7\327t[w\242\3244\354\005E\307\020\002\321\361G$\325\351\363\353\215\245\233\275\212\252\0034\305A?H@\303\306'\263\n\323\216\224\306 \002\346\312\330\240\345jf\325\256F\340t\206\t\303\017Y=\322\023\032u\271\035=\355n6\004\212\376\272\376Yf\340\300\260\354\351\033/\f\274\035\256\361\036\334\237\035\220\322^\217N\313%iO\203-\202\271\376\213\322\266\017\365h\226\356\0365[\266\262n\364\271D;"
+	.string	"U\315\312\210\214\207\261\262[\274\344\321/\024\217w\024W\273\b\f\354!\306\026uU\2349\253\311c\333\001\213\3747\233\245\334\273s\006\323\266"
+	.string	"\216\251\036g.P\260\260y\226\020N]%8\371\215\257 1/\025\346\371\320\344\375#\301\t\310\266\021\354\3721G\254IJK\350\027\0059\237#\023\353\r\021[E\354it\263\037\341\251v|*:\270\352+\210\302\031u\305\272\234*w\001\262\323\247\032\333d\035kQ'\232\246\013\351\202\004\347\215\242\305[\314\351\004~\224\355$\032!\221\347\201\020W\366\003A\007\332\366=\"\023\034\261]_/\342\321!\257\b'\224qG\305[c\313\026\n\257/\207<X\276\375Y\310\301\253\235\r\001\232i\313\372\200\342}F\333\332\355\340\177l\377\227\3100\261\377m\232\241\346\334\250\370_\336S\327\240\352\207u\335\244\375\237\250Y\274m\237h\362V\200&<\001\2201\353'\262\037"
+	.string	"x\330\003cw\003\244F08\r?f\251\17781_\037bx"
+	.string	"\322\333>\373\025\273\370\214\210Z\260\020~O@\240\367\303\001\273\360(\325\352Ah<2c\006=|-\206\204\253w\203\rE\251\354\007\031\023\312\343\231\301v\024 V\005\342\233\201e4r\230\034h\362f,\275\315\303\217\022/H\322G\242\270\216\271iz\3747\207\326\0066\274d\317\327x\332\356\017\255Z\344\314\324\274\032/\203\217#\341\341s\247\332R\316,=pyq@\220\272\031,\205aJ\375\"\352\2065\372\202S#%0d\353\263\364\243\313N\030\301S\030r>2\210\331+\314u\240\300-B\201\257\221\302\007\347g\300\023}ax\365Yg{4E#1\245\340\221\321>\004n\336\376\242Q\343a*\201\347\303g$\226\333\205\214t\327\\=\341\343\250\277|\017n\336i\356\204\3574\255_\336\265\342\311\335\245\250\030D\201\023\221\022*\262\351\247\f\204\321"
+	.string	"4\t\211\003n4N\335\350\243\313\211\313U?#\252\314\271\374-\323\262fx\205\032\235X\210\206]M\215\241\217\220\376'\016\002l$?Q\0069\330\226\034+\354\367\336\032W\n\356\007\334\264=\001\257\315M\205?\237KK\253aH5\"\032\036\254\317\253`\321I\254\300\353\030=\035\211"
+	.string	"\226\203\300\256{:\331\232\336\234\360\002"
+	.string	"\213\034,?\305\216a%\353kR~O\346\017A\003Qr\036\032\222;\277\2016\0214mU\363\215\275zG\333\301:\317\360\233\263'\376\024\024\204\263\271\016\013?\301\302='\"\366\206\302\226)W\240\363`\026\t\205\376\026Bom\300\377\3262\3138\346`\035\226\027\226'\250\210\274\350 \203\3239\033*\364;J\323\035;_\220{\247\347\222\277\327\300W@\345$E\344\367,?Qx\370\227\232\301*\327\215"
+	.ascii	")\366\207\034\310*\273\337\211\301\037\n\330\377\340\234\336"
+	.ascii	"\354\026,8\307}\206\\h\366\334\233\034.\3330\377qv\360\355pj"
+	.ascii	"M\313[\215\201$I\236\342\226\002\201#\274=j\351_s\360\024\306"
+	.ascii	";\t\240\374\023\267bJ\335\3616/\253\031\245\227\255\n6\017\222"
+	.ascii	"\201\323\343r\t\226\3434\255cp\350\002&\345\261\316\261\330B"
+	.ascii	"(\244\247S%\237Ra\2150\003\317Q\255]\322\013E\327\266(R\262"
+	.string	"\004\277\354\207\032\310\237\343\312\327\021\335^\260\267:\254^\322\031\ft\032\354\312\314\247J\275\235i0\335 \226\225>\3031@\2664\207\324\273\276Lt\261\016\f\005k\004\027\231\217\013\231\255\214\3513b.\303i[\214\376C\334@\234\025[\225"
+	.string	"W\n;n\177\005\352\037\033\326fD,q<\324j\220\233\262\336>\220\261]\003\242\230\0376\024*%,\344\370\326\rV\200|B\307\317\003\376\303\370\001\204\247?\350!\325\331\233#\tp\305C\214\241\215[9\0377^\003z\217:\343\273\247\376\240\315R"
+	.string	"%\225"
+	.ascii	"\340\311p\023\024%vh\324\256\217\225\035\346\206\212rx"
+	.string	"n\334\357mcY\362\324\337@\314\350\317D\241\375\021\"c\301\352{A\306qz\231R\255}\346\033\261\244^\340q\235\205\033\250\001L!\236\347\336\276\225\324p\017\377T\324\342\336\324@\246\005to[\334>\035\326\326\2079\330\307\034\326^r\223\031#\233\207^Z\226\354B?t\335\006\b\301g\035#i\fh\023\352\312%\277\223V0\246-\204\351\264\200\325\257\223\361U\214\263#\217\363\3760l\217oh\021\337y%3\252$;\230\2707\016\247<u3\352s\001gF)\017\026\315y\342\331\305Ge\\\360\261\266\232\352\370\240&\327\262\201'v\020\237\245b\313\335\261\020\b\310RK\271\240\307\013\016\311ng2O\277B}\204P`m\246e7\210O.\311{-$\032hB#\002\354\bh\373\263\027\323\352\205\264K}\006\374\242\247\210\226h\207BN=\"\205h\37578\233\332\033\355\3775\304\025\207"
+	.string	"\310\r\223\262e\300\001\302\360\257\311,\231\254\252\337\232\3056\304)\201\275\345&K\351\330\033\336\005\203!L\374\202\177\263DBJ\227\"j\024\031O\337\214\351G\254\364\020\341kv\222/\226p\203H\3008\372D\237F\271\0275<\376u7y}l\026\260\377\275\347\326\247}\2022n\374\2236\375\236\223\330vSE\261\004O\353\277\020|\257\023\245O)H\201(\345\340\315?\310#\247oj\030\207Lp\332\021\313C\f\233\365\337\220"
+	.string	"\370N\347\256P\307\327\332A8\230J)\004\203\330p\252\2675V+;&\226\301\376\365\335\234\223X\204\366\241{@\233+\330\250\035b\215\020*Z\231\222\024U\234\213\n\346\322\027\334\216bS8f\2127\365\221\363\313\340\214\215\364\253\224\206\230+C\227X\212=7\226|l\266r\225\034\017\363\n,\r\241\346'\347f\242\006^P-\211\227\372o\317\326\256\003\334\\\337 s\227~\3475+\311\220l\036\303 ,\\\007uL(\371\264\247i\020T_\312\033o\217\341\277\330b\270q?\232\366\261\345\337\345\234\342q \"^)\322N\314wQ\007jT\354\274\311\016h\002}\213\315.\275\tZ\321\241\332H\347\251\336\350\213\256\316{*\202\306\375\032\007\354\227\023q\344\222\2508fa^L\255A\250\271\272\272\030o\035zu8fPks\232\336\233\271j\266\214\263\264a@@\034"
+	.ascii	"\312\247\227\276y\032\216z\b\202\272f\027\257jG3\273IN\257^\021"
+	.ascii	">\004v\337\340\362\001^\007k\2378\200?{4LF\265\027\302\200jy"
+	.ascii	"@\3743\376XF\311u\036\264\222\023\356\205\024P[\253\"Q\366\342"
+	.ascii	"6H\364Lc@E\374\322\264\244$6=\340\362C\315\260\340n\2341Q0\f"
+	.ascii	"a(0[\215r\235b,\024\255\333`S\302\241\251]\307\373\242\257u\354"
+	.ascii	"fj(d2\323MX\306I\212\\\032\001NJl&\356m\277/\277#?\244\234\246"
+	.ascii	"\2770\t\037\277\2735pb@.\246\246\257\350\324>$\002\375{T\013"
+	.ascii	"-\335\302\232\204g\227+\245\356\375o\207\020\333\303\216\027"
+	.ascii	"T\321\3050\247\f\325+\255U\032\nd\275c@\213\262\212\006\271\320"
+	.ascii	"\352\335\307\347}\017kO\336\242\300\272O\034\021\341\336{\036"
+	.ascii	"?\300:W\323X\371\205#f\030\373\274w\241\254ox+'i-\253\347\250"
+	.ascii	"\302%\367\275\002"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.174.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\002\020\005R"
+	.ascii	"\212\214H\037Q0T\312I\007\223\274\321\316\027\307\355t~]\314"
+	.ascii	"rx\271A\342\332yJr\033J\333BA\fz\330<\306\247\375\275\023\331"
+	.ascii	"\036'\276\274\345\005\204!\320\003\016\301\3505VM\274\334o\r"
+	.ascii	"]Iq\330\361\252\374\235\222\036*\376\316{\2725iD\312$\003\344"
+	.ascii	"\001"
+	.string	"\256\001\352\001G\2602g\n\377\341q\237\273\224SY\343\024\251W\253z\302\r\177O\374juB\235n\247\274n\325\257`\344\017\316\257\326\312$W\202\320\222D\255Shq\265f\331\200\362(<\016W\302M}\326\231\261?+~\265fi@\274\360\316\236\347\244O\222h\345r\326-\243\033Y\234\332\230Z\235G\027\356\f\342\205w\262kDwy\354\032wW\330\303\016>\003\232\230!\241\274{\347w\340q&Q=7\225\252-\310\221\223\270\315\273-\020\340q6\251\355Z\275\002\343ju\016\260C\304\013\227\\\215\307*'\250\232\332\" \214\026&\017cj\255HB\327I/D\237\223^\330`\037<\352\374\002-O+_\"\b\350\307\247\207gG\007\231\203C\342\306\346XCc\234)\022\207\251\020mV\356\227/q\026\247\006\030\204\016\253|\224\375\231\245\206\276\b\364\233\273]\032\003\315\260\265\344?v\227"
+	.string	"\314\314\311\222\373\330\2205\306=h3q\253\362g\026\032\272\300\332\331\221S9c\236t\313\354;e\327A\177\274\262"
+	.string	"\3713\253\f%\302\223a\210c!c$\225W\240Gf\305\3549B\216\2036 %\b\274?\263\304\320\213\3010\344Th`\022(n\320\234\256\037\362\376\314\352BW\344%\t\022\3066C~\254A\035\240\303\263\362g\326\020t\205W\030\r\352"
+	.string	"\ry{\177f\305\200n\320\305u\033\262\204\260\321\313\355(l\310\202\201g>\265\366\"\032F\260\006b\221-\256\017\377\314\342zcrz\267G"
+	.string	"6\304\251\006Xd\253\353\302\031\255\026\216\242*\374\344\2148jU\241:>\312\232wr\276\322\242\342>b5\243\325#HJ\223\227$\310\213d\255\ty\370@\255u\271\251\265\3655\361]\246`w\201\354\036}\002\033p0@X\255So\n\320.z\327\203\017\370\315=\237^\335\235U/Qa\267\215\366\341\201)8\305\203K\002\204\033\374f\367\277\020\241\352\345q\322\376\370\320\376\332\243s\323<\333\270Pq\340\036\371\200\336e\032\201\337\344\276\223\347|\321\303rG\325\313\275\336\217kH\306\370-\271L\002c\312\264t\177u\331{y\336\230\023\265\263\276\375\020b"
+	.string	"\221T\"{{\276\"N\244\206\351CR\253\020\373\274\355Blr\251\364\302W\r\207\214Q;\253D\252\321\226\335\355\322Y\306\274b\250uy\257.\334\254F\027\266\350\273}&\312\032\021@?+\026\334u.\271\277v\317/\\\341\233\3336\262\373\036\376\245\346\265\321\274\035(\375\356{\001\215\0312n\345\013\301\201\3702\360'_\030/\336\344wq&\377\001g\373[,\257\212\3465j^\001^\367MQD\224\362\0165o"
+	.string	"D^"
+	.ascii	"\214\274(R^\241\224\367\304\f\257\t\"o\211\2247(\345\005j\336"
+	.ascii	"\037\237\346\3551\362\362\244\274;)\257\316\f/2\345\315IyqR\336"
+	.ascii	"\233\346\265i\336c\363\326\020yiN\3675\026yg\212\274\305\"/\221"
+	.ascii	"\310;l\336\224\310+l^\224\310\333\315\313\237\362=\223\002nm"
+	.ascii	"[\232\204\331k=g\3651H\246\336\t\347\314~\367\327\375V~ \376"
+	.ascii	"'?\334/\367\323\375S^\334\375\356\265\354\361\326x\227\274\326"
+	.ascii	"\336_ \013vk\254\333)BT\316\252et3s\242vUe\177\345X\326\b\204"
+	.ascii	"\024Z\271j\353\221\335\251\235\325\352<\025\321\212\224\320\322"
+	.ascii	"Y}\004)\004-\243\217\31428+/\236\206\240\033\nSp\247u\232\247"
+	.ascii	"\207uVJz\360\340W\222H\334\35179\302\317\3022D\021\271\370R\202"
+	.ascii	"\361\233:M\024\245\256\002\372\0351[\375Y\036\247\024#>\313\347"
+	.ascii	"\224bD2\245\031\277\365\351p\207\354]e\r\237S&\tj\202a\240\221"
+	.ascii	"m\343F&\206)\210\3239\375,\034C\0242.FQX\027\213\234.\262M\361"
+	.ascii	"\340\013I\344\336V\214\004pZ\203\264.\200l\f\364\261\034)\327"
+	.ascii	"\207\326oB\214PA\342\300@\222\304\025{0\332F\032\021hC|\3237"
+	.ascii	"\375*\274\025\325\334U\242}.\306\t\345\022\345\232U/wW\251\003"
+	.ascii	"\373H\272X\306R\272\020\003\201\260\250\364\302\233\206\2216"
+	.ascii	"\004 \033\213\333\364\213f(V^Gva\323\250\\\337\020\027O,4\344"
+	.ascii	"\300\275X\002Zk\021\007.w\247\264<@?&<\270o\201\016\007\234c"
+	.ascii	"\277H\033\337\261O\3458o}]D\334\250\357\007\211\376\222Acho\231"
+	.ascii	"\251\302\231\004\307\2751\033=1/M"
+	.string	"\027\212\002aX\273\371\216t\251\203\204\230-\303l\341\002\3045\026\324\020\252\352\345\322tM\237)HE\323-\322\340\320\270\246x\220\016H\240M\177\255T\272?\202\227NiP\306\0241\305\203DkgF\034\323\210\350\252\351\2572\037v\315\017)9\264\361\341\024\031\003\243iJgZ\330C\212Y\261\317\004\302\305>s\256/\225\016\233\3303`a^\230j=xp\207\275?\342d\244\366c\213A\222\337L\362\320\0043\354\226\343\362\303\230\366S\332\347\343\242\025\304\340L\177\375v3@\t\242\230\352\3006\354\240\215|\310\300\b\220(\354\016\204C\024\355\277\211\341\362\273\375G\364\302\334\245\375\265\334G\377\017Xkv\250\215\026\240\257vw\370o\001OPIL(\340H\016q<I\251F\024S\216\224\t\005\034JN\311\246a2I\251\206\t7\232\206#\344\300\301\244A\222\t\352\204\020\2169( B\355\300"
+	.string	"\212\211\204\245\033N\305'\250$\250\035N9(\200bJ2=\325\344\210 \231dZ\322\361\224\004\225\324\221\344\224l\272\201J\212\320KO\311NR\252!B\323R\272K,\234\222MH9p\334hBZzJ\"\261\320Y\035NLOHP:t<!\031\235\365md\221X_\242\260\nW\246Nb\260\230p\305_\231\336\355\305\273?.&\\\215\362\312T\205\212\346\356\261\177~\037Xr\231\272\022\277\037\223\266-\336!Y44dD\227\205\210\327\032[P\177\2551\355G\251\205\\|\216\236\242\257Rt"
+	.ascii	"-\303\316\247\003\350.\363\345\017\357\013h\305S\264R\337\356"
+	.ascii	"B%id\332\364z\360\002@\205<)\235\260&\030\024\r@\267\020LA\241"
+	.ascii	">\321(:\375\263RR\300/h\241\356\201buC\017\036d\213:\021v@\330"
+	.ascii	"\211>\201\245\345\356\371<\302D\3775\301\224h\023%\032\335\241"
+	.ascii	"\017\360\016\210\217\376'+\211B\246\020sW\325\313''\211*\nK "
+	.ascii	"\354\202>\336\221x}\177\275\344GU\340O\017Q/\312C\324>C\f\324"
+	.ascii	"AH\242\216Cd\311\343\212 \261\344q\017\201=\240\206\221F\006"
+	.ascii	"\215\rF\037I\022\221\302-U\324\274\326\304|\212\332\330F\305"
+	.ascii	"K\233\035\025\007\276\267\3641y\353\351\257\005\022\345\212`"
+	.ascii	"\316\213^t\307\330E}\025\345\n[\016O}\321\2357Q_\3754\203i\343"
+	.ascii	"\362s\027\260\260 \001\364;Zk\255<:3z\b\253\256\f9\243\215}u"
+	.ascii	",\307\321\241\321\213\"\211\372\337\341\031N\3244\332\206Y\246"
+	.ascii	"\307,\340\375M\321\231\321\302\266*fmZz"
+	.string	"\272\250g\364\255\220\310\350\236\306a\226U\371\245\002\201/\250q,\344\224R\b\315\214\310H\222$i\f1\005\304 \b%\\\017\0210\255DL\215\314h\222\3022\007\333\302\303\345T\337<\2705l\200\2245r\254)\022\323C>\225\360\001K\345\275\037_>Xf\215<\234\006V\f\2524\330{\025O\220\bKD=74\007\004\177\217\251\230\302+\251\226\306}\340\fN\217\307\234\201\231[\350x3[M\252\2079\036\\q\242c\214A3\345x9\2227\216\306:\\3\305\317f\306M\344I\262j\245\247&\fE\311#\265\352\255q\305'1\371\200\345w\321L\305\241`\362M\343\340s#\205p\362n\225\317\017\340\244\377T\341\304p\n\205\310F\275\250\331\372!\0072\023\317^\324\022A\006\352\374a2\b. \321\025wi\346\235z`\320\340<\200E\315\361\363\256:/\272\333\"H[\270\034\320'l"
+	.string	"\200\002K\255\377\224&1\373l\254|slA\271qb\224!\"\0253\227\f\227G\366P\300j<\003Ah\260\240\200\300\007\"\231\320P\233\311\231\201t\b\t\354\245\373\235@\362\254\263\227CY\016\207\252^\365\263Y\216\311\257T\026'\314<\247\203\024\265\207<\276\302R\002\323\366c\334Wz:\236\277(\n\307\335\03023\314A\270:<\212\212\323\025/\274\227\034k}D\252\254.\277P\313Ef\206\363H\367\205rS\235\337\b\350\315\032\244\034\267o$\231l\347\272|#\354\237k}:\322\321\212\306\274\301\t\250dK\021Q3\225\023\300\201\301Rz|3U\251|\025\221'WN?q?.\336\341)\363+\260\243\234\326\r"
+	.ascii	"\347\303\301t\312\230\225\205\203{-\220\024\364\351VB)\374\233"
+	.ascii	"\020o\031\255\200\201k\366\3055C\344\2237\347\2367Vh\212\023"
+	.ascii	"};\007\347j@\t\312\272\023/\310T\276\214\220\265\345\265@\030"
+	.ascii	"\344\301\252\261\252qS\300\304&\365\374 \034\340\212\013\304"
+	.ascii	"\024\206\203\372\253<\323\200V\220\225\207\332\003\343\313)3"
+	.ascii	"{W\270\345\020\003\365C\302\321\323\247[\2721\032\274\226\271"
+	.ascii	"w#\357\b\036\304\225\2409\216y\355V\327x#\344\324M\030gA\227"
+	.ascii	"-\363e\027\2616\202j\321\333\204<\260jX\303\"\376\225\006\263"
+	.ascii	"in5\032\252a>#cFr8s\214\251"
+	.text
+	.section	.gnu.lto_mspFcDataFlashReadCommand.175.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\005\003e\027"
+	.string	"V\254\234L\300TU:8\305k#\2701\226\252Y2U\377\254\314(\304h2\210/\253\277\367}\377G\343\376G k /\342l\302\035\263P"
+	.string	"\201\001\003\2018\302v\246'U\366\317\337\322mZ\223P\031,\037\"\272Ve\214\020B\210\334I\006\207"
+	.string	"\200"
+	.string	"\213"
+	.string	"cQ\r\351#\244\344\240\274\310\n\030\330Nd\323r[\257n\364i\261\272P\272wu\271\310\bxmb\340\226\371.\376\302v\030\035\236\272\227\347\307\215{\327\004<\240\274\310\353W\343\305\362+\343E\2661\003Y<\334\333\202 \211\324H\351\336\313j\237\333>\206mm\374\373\216\242\356n\037E<4\355p\266\303\003I8\224"
+	.string	"\330}\bW\272\037\365\276\333\334\016\307Z\362\301\275\227\255\272\3239\223g\346\013\314<cnVH\326%I\270\2761\2577\333=\314\017o\3630\037\306\277R\245\216tF\275w>}\375M':\227/::\217\244e\221\264\034\222\226\233\264lI\313\027p\340\222.'\304\205~\334\253{\322\344\376\304\034+N\364\027\375G?\322\337\373c\334\3503n\343>6\365\320_\260\204LI\3435lG\242\371\325\271\007\001\024\334\311P^l\t/\343<\333\217j\277\352\375U\n\232H\232P^T\261_\t\343\203\202*R_\230\352\261s(@&\277\233\306\341"
+	.ascii	"\266;l\261Q\275j\346\n\026\354U\016\357\210\276\361\330b\331"
+	.ascii	"a?%\273;e\310\007\316\020\336\270\202A\203\275\252\352\020\b"
+	.ascii	"\260G\203\237\021\026\241\313m\2371\212\340\354\222\355\023\001"
+	.ascii	"\356Pi\271\354\325T\333#@\035\277\247XJ\272\321\335#\036\035"
+	.ascii	"O\315\262S\004\005\222 >pv\211O10{\025\325!\016\340\320\357}"
+	.ascii	"\3526J\235\334\330'\234b"
+	.string	"M\315\034\223\331\253o\002\275&\007\030\205\026\255\365*_/\b&\031Z\314\214\t\363j\231g\312\214\f\206\242\3469\213\311\"\274L\032j\322l0O\025\255\025;e\022j\\\255\030\023\306DiP\256\023m\032\372jv\275\314\320\030k\006\326\212\261\\'\312zY\261lf\236,\232Lv\262L\353}\363p\355'\345\365{\274&\224\362\354o3^H\360'\365\205|\233\261\354\234\355\3638-x\"\365Y~\315X 'I/T5\331\271N\365\201\202A\251\317\376\276\0264 \220\202\231A\343\001\2751\330\026\360\037\203]h\274'c\217\034\334\037\003\261\021\224]\317\314\206\222\275Cc\022S\271\274EY\237\303\025\321\356\206H\036\2103\330\205bS\233[\304\306X\257IM\feM\2413\2501\020\03356\261+\220F\002b\364\346\n\217\001\n\001>\237\243\226\2158A\b\027\221c\210\202l\316\301\034\021"
+	.ascii	"Q\006\227\213\232\274\251\271\252\203\356\001"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.176.c78e67b14e92a04f,"e",@progbits
+	.ascii	"(\265/\375`z\221\355\342\001\232\023g\250P\0200\006\361\214\001"
+	.ascii	"h\226\022Z\tRp2a\217I\264\261\352U)/\n\203\322\214FW\222Z#\257"
+	.ascii	"\235\243N\034\261\227\300Gu\027|\352\355\314\203\277H;\366\002"
+	.ascii	"l\370k\350C\257-\360\333\223\372\214\\\376\260\346\301\356\252"
+	.ascii	"\261\362&R\312\224R\n\034\n\177\t#\013hI\347>kqn\250\353\334"
+	.ascii	"f\256s\227%\235;I\322\271\311\\\347F\362\316=\346:\267X\213s"
+	.ascii	"\037y\347\016K:7X\322\271\277\336\271\275\222\316\335\325\342"
+	.ascii	"\334\\I\347\336jqn\255\244sg"
+	.string	"%\235\033\353\235\333H\322\271\213\26487\221\244s_\2658\267U\322\271\253\\\347\246r\235{J\204s\017I:\267\220\244sK\271\316\035\345:7\224\353\334O\357\334N\256s7\275s3\275s?\223\316\035\344\235{)\351\334J\256s\003y\347Nr\235\033\311u\356#\327\271\215\\\347.z\347&r\235\373\207\353\334C\256s\013\271\316\035\364\316\355\343\003\347\006r\235\273G\213s\377$\235\333\307u\356\036\327\271y\\\347\336I:7\217\244s\357H:\267\016\327\271u<p\356\034\327\271q<p\356\033\327\271\235\256s\333x\340\3345\256s\323\270\316\335t\235;\307;7\323u\356w\204\363\214\007\316K\327Y\306\003\347\030\327Y)\302\031&\351\374\"\3029\207\244s\tD8\343\360\3167$\235q\270\3167\336\331\305u&\301\tg\033\336\331F\322\271\206\bg\032&\234kH:\323\320\201\363\b\\\347\031"
+	.string	"p\236\301u\226\201\003\347\030\\g\031\0338\303\340:\307H:\213 \351\f#\351\034\202\2443\bJ8\177 \351\354\201\022\316\035H:\277(\341\314\201w\336\200\353\254\201\022\316\031p\2351P\302\371\002\357l\001\327\271\002%\234)\360\316\023p\235_(\341,\201wv\301u\216@\tg\b\274\363\003\\\347\026J8\263\360\316\016H:7\240\2043\003\\\347\005\224pV\200\353\234"
+	.string	"\327\031\001%\234\017\360\316.\\\347\025J8\253\340:\247\340:\243P\302\331"
+	.ascii	"\256\363\t\256s\001J8\233\360\316\004p\235Kp\235[\270\316\003"
+	.ascii	"p\235\005\340:\223\340:\007\340\235Gp\235Y\220p\026\301u\016"
+	.ascii	"\001\351\f\302;\257p\235Uh\340\234\302uF\361\316\037\270\316"
+	.ascii	"\036\270\316'\\g\023$\234;p\235\001\360\316\034\270\316\033\274"
+	.ascii	"s\t\327Y\203\026g\022\256sK\213\363\b\327YD\213s\322uv[\2343"
+	.ascii	"p\235C\2743\b\327\371\203\bg\017Ig\fD8_\220t\266\340\235+H:S"
+	.ascii	"0\302y\002\021\316\035\222\316\310wfy\347\225w>\276\263\361\235"
+	.ascii	"\333wf]\3475\003\347\177\3476F\341\200Z3\n\222C\350\347\205\275"
+	.ascii	";\325\3057\3122\231r\253\366g\373S{T\373\217\366\243\366\244"
+	.ascii	"v\037\355>\355=\332w\332u\264\337\264\347\2647\333k\332\337\356"
+	.ascii	"iwbwa\367`w`\267_\267^7\264\033\255\033Iw\222na\356+FRy\225\214"
+	.ascii	"[U \321y\216\315\372\273\201\013ar(\227\212\2722s\234c\223;\311"
+	.ascii	"\370\323\005\326W\210\275\202RU\217\315\266\023\210\366\320."
+	.ascii	"y\020\031\177f\240_\233w\345\351\n.\360}y\002\217\315\242`\333"
+	.ascii	"CK\344H\016$i\003E\256\220\002\251\034\233\365\"7\222\361\243"
+	.ascii	"\027\375\346\274\315\324\272r\222rl\326\002o\017\255\377\360"
+	.ascii	"\200\327\325S\337\035]\310\203\030\331,\n\n\250\bE\303\274\207"
+	.ascii	"\375\307\201z(\361\252r\336\216\356\003\002\237\"U:\322\216<"
+	.ascii	"\214lvGY\004\251Z\304w@\251Kp\\'\307\217\310\250\205\034\375"
+	.ascii	"\346).\260\013\361}\303\202h\334\206\22150\326\327l\001CBT;\307"
+	.ascii	"f\275\tc}\315\336\365\tj\326\225\3255\316d\244\2771\274z~\224"
+	.ascii	"\200\272\001M\330\333\303R&\r\354BT\314R\244\"\243\245\334F\274"
+	.ascii	"\334d\350C\356\256\256E\304\367}\221\206\214,\234a\301{\367v"
+	.ascii	"\217\236T\361\306\221\320IZ\027\370\276\357\n@nAF\006\262\333"
+	.ascii	"\372\232)@\032E\365\276\357\212f\231\004G>\356?*\335'\323~4\364"
+	.ascii	"\233\363\256\350I\241\002\337\227gE"
+	.string	"\263L\303\261YO2\301\255\306\275\247\247\334\200\031\366\356 \233\240\201]\210\03786\013'E\b\316N\b\216F]\241\020\\\025!8@\241\025\376\340l\264\032?5\360\250\350}_d\\\231\320\033\234[\022\2416\270^\322l\314H&A\253\261\004\310\204\336\367E6\313L\002fd\263\022\310\203\273\321j\374M\250YG]\357\373\"\231\333\214\373\254\323\030\331,\232r}\205P8T\244r\341\330,\364%\310\341\242\n\307fO0\313p\223u\031#\2319\211\262_\2337\207*\207h&\034\233\345FrC\277>o\343D\017\323\002\3377lE\263\314bu\346\016\353#2-V\002\327\202\227f\354f\305\261Y\016;\362;3\t-d\372K\311\377\276GzK\3367,\0046ql\226\253\273dx\306\00159|F84s\222!\276\357\313b\203\006\3216\273\266\207\266\331o\272\340\202!]\355\250f\302"
+	.string	"\203\017,\313\212\340\3575\254y\005\363\261\327\260>\366\032\326\234\302q\246[\253\263\032\253\215t\221&\322Wm\325UM\325S=\244\205\264TG5T?\265S75S?;H/\265R\003\351\244F\352\2436\352\242&\352\037=\324B\035\324>\032\250{\364O\373tO\363\364N\363\350\035\255\243u:\247q\372\246\235m\3235M\323\315\316\321\314~\271\312T\236\362\"+r\"K\031\221\017\331\220\013\271\n\023\362 \013r \003\362\037\373q\037Sa>\336c=\316\343)\214\307R8\n\3371\024\216\262\035\3271\035\317\261\034?\3418\206\3437v\302n\334\204\333\230\t\263\361\022^c%\254\306i\214\306g\fe3.\343$L\306Hx\214\305\370\b\207\255\240B\n(\030\340\204\002\230@\200\022Z\f@"
+	.string	"$\004`\004\026\"\204"
+	.string	"\302\n\025)P|\340\301\t\023\035"
+	.ascii	"\200\203\rJh@\242e\204\210\244\233A\b\020\037<`\320\\\027XP\001"
+	.ascii	"\005\023t@\262\254\034\215-\273~ouW{\371\f7\263[\253HN\026\242"
+	.ascii	"7\326\237\221\277\356\"\1775~\336D\236}\335W5}RT\274\255j\370"
+	.ascii	"\274\253\256\270\250\256\204Ly\020\235\367\220"
+	.string	"\272n!A}\301\211+\035u\335R\316\023\347\035\005\265\242\340\225\365\324\242T\363d}\261\2627\007z\002\341\244\347\250\207\322S\256\333\251\006\316y\272i5\362\340\231b\202 \340\017\337\241\346\315t\367T\322\375\264\013\202$W\265\024B\251\006\315[\351i\321\254K\n$\311\314\033)\256\327\246\251s\255\207\322\023\254\373\350\253\333\350+\316\313\273\250\253\233\250\353\215\313\373\307V\367\320\226\233\226\267PVwPV\333\224\267\217!\335@-J5C\330\204x\367\250\001\253\221\362\376yFu\373\324DAy\367<u\363<9y\357 u\363@:\362\336\3614\352\326QcTS\344\255\223sT\363\303\033\207/z\343\264\3429\332\361\266!J\354\032\232\347\216\356f\215\216\032\035\357\034tK\272\264\230\375\352t\265\332L\255R\235\24757S\347\305\305f\305E\327QtN\224\"\256\"\244\353\tD\347C\267i\016"
+	.ascii	"\235\r\207p\252\n\253|PZ\362k&lQj\366\205PjRq\036l\362"
+	.string	"\261`\240\2363\340_\235\263_\337\2343\225 (_\212\255\260.\255\275\270f\27588\347\274\265\346)kJ\234\361\324\232\245\250\2459GAk\276C;s\206\002m\216BC(5\315\234\355\330\237iU\335W3\335\227\227\363\\W\263\\\027\227\363\223\255\346\270--g\270\254\346\267\254)g'C\232\335\206\204Pj\nqn\202\367S$\330\026\325\314$\n\312\231\355\251y\311\223\223\363\032R\263\022\244#g\265\265\207\322\222QsZ\213R\323\250\310\031-\255\352\214\331+\317\0360Ah\b\245\346\020\257EJ\315\037\316f\\\326\242\324\024rf\257>\224\232;\316Iv\310zt\220,\216\375\211\345\360\221\2314\016kQj\336X\361@\371\nw<\3254\025\216\250\213\236\302\264Q0J\227ti\031`\356\004\231\264\002\034\245L\277\004\225|\216\332\004\304&"
+	.string	"\"\240\227\360\327-\376\374|"
+	.ascii	"}-\200>*N\002_\007\200o\317G\320k\026zv.B]\207\260\236\320Jt"
+	.ascii	"\322w<u\253\210$5Pt\016\302j\301\334:\302\023_\301\344#\327*"
+	.ascii	"\024\373XE\221\212\240\222\217\\\247\210k\024qp\376\301Z{\260"
+	.ascii	"\252X\263\342Q\342'\324\334D\007\210h\016\2003\347\200\003%\237"
+	.ascii	"\243\336\300\254K\230\201\271\006\253\207<#K \bA\351\332\260"
+	.ascii	"9\260\342\371r\022\353\006rQg\337\361@\255%\202 I\333\212\307"
+	.ascii	"\313[\372F\254,njk}\307\303\265\266\200\262\252jB-\027\261\325"
+	.ascii	"I\367\310\212'\3133x1\013\261J\267\252\224|\216\032\304j\254"
+	.ascii	"\331\031\322w<BV\023\022\003\231\264`\224\177`\362\221j\017\322"
+	.ascii	"\306\240sHus\255*\216\346z\264(\325(\256 \240,\365\365^s`\305"
+	.ascii	"\003\345\027\030]0\240\t\032\326%U\3629j\013*\260\340)m\nV\001"
+	.ascii	"\324 \026uHtJi+\036$\237\240\303\252\"\220\315\260\357x\214V"
+	.ascii	"\020;Cr\212\034\311\302\201"
+	.string	"\222\317\217^\371\221\326\034X\361\f\371\261\225|\216\332\030\324-\005=N\033g\373\216\347h\335\340}_dO\215\257\253\210\243\271\036}\307#\264\236\200\262\324\327i\355:=4\376'\224tomuw\371\264\333k\257\006\260f\317\016g\210b\242\224\307\016\035:5S\252\023KOS\256i\327\244K[\314y\322#J|\002\326\224j\0225\377\316\2408\211SGk\3204\242!!\036]\037\224j\346\332\206r\213j%\036\250\021\334\350\342}_\366\234\036\237\346\376jf\013\250\230\273\311\374\032 WV}IUTx\036\374*h\330s\342\231\227A\253\020%\t\275\241UjI\304\216\345-\036uEA\235\250\232x\346\245\321\332\244d\307\362\020\231\236ka\316\240\211g\217\020N;x\346%\322\252\264\004\302\216\345U9\352Bdv\261\002Y.\265I(\2068[]+\322\232\264|6-\237\242\332f\337\017"
+	.string	"\337\001\363R\310j\024\343\370\2764%\360ZdC\225\345\324\021"
+	.string	"\337=\272\250\322\257\034^M\333S\322`Fk${\266\231G(\203s\360\314\313\253e\021\357\034#\331o\360\034<\006\3165;'u\203w(a\241\006_\342\333\2603P\266\266\306\022MUIxh\022\255\006\377cyQ\306\350h<Q\203\357=B\273\255NAH\027e\372\264\005\006'\361\314K\255%\027\020\211\357\264^\255\272\nG\374\223\221|\311\365\360Y\250\356Z\321O\363:\354\326>\3157a\257\374\255@\035\022%\202\346\327\303\317\240L\355\260\305k\355\341\331q@\213\216\021R\021`k\016\316\r\004D\2545\311\217\351\252\242\345>\363\362\310\332T~\300/\206k\216\345\330\t\023\310V\346\262\354\270\276/,\241\335"
+	.string	"5\367\033+\211\346\231\314\277\370\323\006\240-\325\324\332f3\370&\354u\261\013\360[<5\235$C\254}\242R\003=\304\227.\331\332\226nnm\263,]\210g\367\b\215\2424\317t\377\271\242A\274\313\030\037\215'\262\b\317\231&\357\034\020\337{\204DQ\232gB\t\207><\363\362\355\t\225%^\360\007\227qrK:\272\266\331\326\355\303wZ\207\200B\030\344\326\354\"\003\017v\377\347\327G\305-\304\340=|;\251\030|\362\310\340\364\202g^By\275\245\264\2218\275\357[\002\3632\312\347-\361P\340e\336OY\356y\240\367\276o\t\315\362Ky\274%\025n\251fy\351\267\004\004l\233u\247\026\374\005\026|\022:\250h\325\235\326\3754(\r\361On\301\226"
+	.ascii	"\220\221\017\025\274+\276\0163\r\353\373*\255\320~\335\201b^"
+	.ascii	"\345\006\270+~\003\366\337\222\360\204\336\373\276\235\303\274"
+	.ascii	",\\\036z\347p\3775\006\320A\272h\3153kv\206\200\370'Op\346\201"
+	.ascii	"\325y#Ts\255\350o\276N\363+\370\004<\333W@\327\325F\321N\360"
+	.ascii	"\317\326\034\326l\016{\337\367\003\b\375\315gu~\204\363\314\316"
+	.ascii	"\346\250\351U\246\340\231\371\005\261\377^\220pz\337\327\204"
+	.ascii	"/\314\031\244\340[\260?\034\031\214\213\322<\363MH\fd\342\241"
+	.ascii	"\b\247\rq\272\302\340\237\334\315\365A\224-k\363lSJu\202gm@\350"
+	.ascii	"\327\372\t\276\367\372\001M\320C\033j\323\253\354\213\235b\020"
+	.ascii	"\353\202\016\317\037\367O\226\322\245\342r\272\234\266\315\272"
+	.ascii	"Z\316`\016\2572\362;|\273`\3164\275s\220\357q\203H\337\243S\f"
+	.ascii	"\032Y\220\202\257<\213s\006\207e\345;\255\033\320d\266\326Z?"
+	.ascii	"E\0258\223\277b{S\243\340\237\334\255l\331\235g\177\244,\031"
+	.ascii	"}\356\250\023\234\340\306?\356\230\331\251y&\263=\177\374f\177"
+	.ascii	"\336\370\306&\260C'\365\305\312\336:\2505\273\363?fw\370\363"
+	.ascii	"\r\210\330\363k\034\340a\224\346\231\354N\241\033v\n@\302(\362"
+	.ascii	"\237\234\201\222\351\327\312\2535\b%S\036\307u\353?G\333\223"
+	.ascii	"\343\33376}\261x\320\240\324\n\273\365l\323.\252\272n=K\336W"
+	.ascii	"\331:%%\356\370O&\241D\361\253\345V\266\024H\r\331U\353\237\371"
+	.ascii	":\314%8\373\3143@3A\3369\274\001\363\331gi\362\0024\376\263\241"
+	.ascii	"U`\355\007ie\273j=;VGe\254\216\306\023\337\347\216\312\222h?"
+	.ascii	"\354;\255W\224\306\366h<\221\273I\264\353\177\330\263;\205\232"
+	.ascii	"^e\376\2627SrK\361\314\320\f\221wN\263\3343Dm\263\353/\271\372"
+	.ascii	"\244B9\274\332>\311\246\353?y\002\355\277\313\230\035\215'\362"
+	.ascii	"\252\365\377\0308\275\312\002\2004\003\304;g\325z\207\002\"E"
+	.ascii	"i\236\311\337\323\235\326.H\243\210\201L\2372\2075\337\341\266"
+	.ascii	"rtw\375\223\231\377G\263\013\246O\271\233\305\r\312\255\275\376"
+	.ascii	")\306?\226\370\025\330\225\005\306\037&E\244z\223\272\370\275"
+	.ascii	"\020\257\276\250\264\370\267\f\221CK\214\360c\r.\376\025?\221"
+	.ascii	"\0064\242Q\361WE\245aB\370\207\330M\327\240\370\243\370\357\r"
+	.ascii	"\223\216\212\352\232\370\235\346\204\250\336\244 \374O\271\236"
+	.ascii	"\035To\022\020~%\376[\241\372\344\210\037\211\377VX\024\212#"
+	.ascii	"\342/\342\277\025\224\3009\021\342\037jbL\004\342\367\321&\345"
+	.ascii	"A\365>\374?L\272\002\273\262\336w\207\237g\t\032\325\233\364"
+	.ascii	":\370w\264\222\240=\252\307\341\317Q[\361\202{\033~g\247\275"
+	.ascii	"\212jT\337\344\247\341\277\237R\245\317\376\345gBW\350\002\247"
+	.ascii	"\354T3#\024.\221]q\013I\024v\310\216\330X`f]YoR\025\366"
+	.string	"\302(qp]Y\202\354\203\374\267\322\005\201\362\307\016hG\245\242\302\336G\367c\244\307\276\307\177k\022D9<\366)lf\321\256\2547\351\216=\212\222Nb\"\241Q\331\261G\371o\235\352\245\315\261\323\261\331\034b\034\373\023\376[\253A\216\212\370\210\023\3667\376C\001OH\2056\366&\374\367S\364\216\212PX\302\316F"
+	.string	"*\242\032\273\222\026O\302\272\262\336\2443v4\376\223\300\237"
+	.ascii	"\312\330\315\370\317\005)p! a'\343?\027\336V\034a\027\373\200"
+	.ascii	"/\354\213\035\354\304\212]\224\213\275\213\377\216\035\264\222"
+	.ascii	"e\230\377\272\306\250$\260+\353MzSd\261k\361\337\006\310\204"
+	.ascii	"\336\227\331G\310V23\3130\377y\316\373\276\357\233\242Yf7\302"
+	.ascii	"\314\177l\023\"GE\357\313\354#fff\031\346?\317y\337\367}S4\373"
+	.ascii	"[\317\032\021v\275{N\345\376\327\372'sRsx\225E\360\307z\346\231"
+	.ascii	"\347L\223wN\177\227u?\225H\303\244\2014\317d\016k\366W\253\324"
+	.ascii	"\252\377\223\271\277Z\245V\371\2030\273\217f#\334\bg\243[\027"
+	.ascii	"6\033\311\\gc\221\353l\364\341:\033y\\g\243\216\353l\264q\237"
+	.ascii	"\346\226\317{4\267z\276\323\334N\361\235\346\026\317u4\267u\336"
+	.ascii	"ln\305\274\246\271\rs\235\331 ~\323\314\376\360\234f6\250\241"
+	.ascii	"\315\354O\2435\263=\235\244\231\335\351\300fV\247\365\232Y\233"
+	.ascii	"\036l^\017;\261y\005|\3475\255\2234\257h\235\244y-\353$\315\353"
+	.ascii	"X'i^\267:I\363\252\325\323\346\325\311\337\346\365\306\217\232"
+	.ascii	"\277\316\223\232\177\356\235\237\311\b\347g\363\250\346_\362"
+	.ascii	"\316\217\346:\377\231\353\374P\217j~3\327\371\223\270\316\037"
+	.ascii	"\346:\377W\177u\377V#i~\255\026\353~,v~\035\367\321\3749\276"
+	.ascii	"\323\3748\256\243\371o\374\246\371\235=m~\233Nl\376\232\036l"
+	.ascii	"~\232\016l\376f'i\376\034\235\244\371\231\357\374/\ng\257\276"
+	.ascii	"\263S\337\331\247\357\354\213\357\354\212\357\354\211\357\354"
+	.ascii	"R\024\316\216\370\316~\350:\273\341\ng/|g\2572\302\331\tU8\373"
+	.ascii	"\240\353\354\202\256\263\007\272\316\016\350:\373\237\353\354"
+	.ascii	"~Ig\357K\341\354TF8;\337\bg\337s\235]\317u\366<\327\331\247\274"
+	.ascii	"\263\343\275\263Kyg\217\222t\366;\327\331\241\274\263G]g\267"
+	.ascii	"s\235\275.\351\354t\256\263\317%\235]\316u\366'\256\263\307\275"
+	.ascii	"\263\303\271\316\376\346:\273\023\327\331\335\\go\342:{\233\353"
+	.ascii	"\354L\336\331\331\\g_\362\316\276\366\316\256\304uv\265w\366"
+	.ascii	"\264wv\264w\366\263\244\263C]g7s\235\275\354\235=I\322\331\311"
+	.ascii	"\222\316\216\344\235}\314uv\261\244\263\037I:{X\322\331\301\\"
+	.ascii	"g\377B\341\354^\256\263w\275\263s\271\316\276\365\316\256\225"
+	.ascii	"t\366\254wv\254\244\263\033yg/\222tv\"(\234\375j\204\263[\271"
+	.ascii	"\316^\345:;U\322\331\247\336\331\207\274\263\013I:\273\324;{"
+	.ascii	"\324\bg\207zg\177\032\341\354N\256\2637\271\316\316\344:\373"
+	.ascii	"\323u\366 \256\263/\271\316\256\364\316\016\304u\366\244wv\244"
+	.ascii	"\244\263\037\275\263\033%\235\275\350\235\235\310u\366\037\256"
+	.ascii	"\263\017\271\316.\204\302\331\203F8\273\017\024\316\016\344:"
+	.ascii	"\373\217\353\354>\256\263\367\270\316\316\343:\373\216\353\354"
+	.ascii	"<\\g\337\341:\273\016\327\331uZ\234=\307uv\234\026g\277q\235"
+	.ascii	"\335\331\342\3546\256\263\327\2648;\215\353\354\315\026g\317"
+	.ascii	"\341:;\263\305\331_\327\271\253-\316Mu\235{\332\342\334\213\357"
+	.ascii	"\334\212\256s'\2668\2674\351\334\210-\316}\230tn\303\026\347"
+	.ascii	".L:w\225\026\347&t\235{\260\305\271\005]\347\016lqn@\327\271"
+	.ascii	"\377Z\234\333\317u\356\276\026\347\246\342:7_\213s\357\271\316"
+	.ascii	"\255\327\342\334y\357\334S\336\271\361\222\316-\245\305\271\243"
+	.ascii	"$\235\373\256\305\271\241\274sG]\347\266kq\356\272wn\272\244"
+	.ascii	"s\317\2658\267\\\322\271\237\2648w\234\353\334p-\316\375\346"
+	.ascii	":\267\223\026\347vkq\356&I\347nkqn&I\347fkq\356%I\347^K:\267"
+	.ascii	"\022\327\271\325Z\234;\355\235;6\323o\267\025\251\305\2179\233"
+	.ascii	"\316\320**~\363E\331\311\220\250\265\342\244\203,\361\333\355"
+	.ascii	")\375\2303C)\342\322\013\021V\224\200\360 ~\267\035\035J\r\213"
+	.ascii	"^\260p\na\205\350G\0175\303\357\267\225\240\302\2179+\324\252"
+	.ascii	"\362\314J\256\025\240\027\"\350\201\260\322c\345G\250\312\267"
+	.ascii	"\033\017\341\267Pe\320k\205G\221q\360\373PG\360[\370\013\004"
+	.ascii	"[\301I\n\374n\263\001\374\026\362\342\376\216\254\320\004\371"
+	.ascii	"[a\372}\013x}c\307\252\323\022"
+	.string	"Z\242\357\373m\221\312\267P\307GvL\224ZBK\260x|\337^\207{\037sFG\250Wv\254\242\214\241\322\373n\023\314\373\230\2639\255\030&\2302\345\035jN\006\fxx\337|PoQ\232\030R\240G*YR\276\355\364\242|\013M\342\356\320\216S\272\226\320\022w\337\204Q\240|\314Y\023\021D\337e\254.\372\016\365\005\343\237\314|P\\vjG;12\273o\267\271\272\2179S\022\002:\272o>(\254\271\265c\334\0133\266p\356\233\315\211\334\267\240\366\204\355\330$&\355\3117\027[\334\3438K\243:\212\322<\263\b\212\b\256\355\210\266\304\r\356;\316\354\355[H\342\304\355\230\244\311\022J\302\311\267\333\230\333\3438#\223\n\365\360\201\342\211\322<\263\352\327*\232\246 \350&\317\254|[r\035\273\232<\013Se\2347\rF\233\317l\022\2146?\320&w\314z\342\327\366mW\204\311\263"
+	.string	"8\304Fw\274\252\363c\373\266\243Z\3621\320\2775\273\343\020!ko\024k\322R\002\345\b\365T\250\344\215bMXjQ\216L\312\230)j\337rKi\037\003\355\363\300\021\r\355\233\257\t\251\003gxG\244\230>\267\263\357\270c\021\364c\240S\244fy\307\037\312\343\220\331\267\211MCe{G\037@e\337\0166\005%yf%\225\243O\017]\222o\371\232\200\310\216<^\034w\220}{\327\364\023\245yfS\017\222gV\372\035q\224\307\033<$\337\0162U_\374\223\327\275\356\261\261)\007\304"
+	.ascii	"\2174\312\230E7\261\357\270#\363\310\307@\3536\020\026v\250\001"
+	.ascii	"0A#u\nF\370EhL\224~\tf\340\237\334^\3572V\347\365\315\307d\027"
+	.ascii	"\245\301@W\241\261\360\246\245\353\372\226\033\344z\026\234\304"
+	.ascii	"m\035\032\003u,\241%\246[\337m~Z\037\003u\242\225%5R\3413\322"
+	.ascii	"e\275\221\217\351\r\353\231\225\212\306\274\027&\246`\275\361"
+	.ascii	"\214\311\355\002\377d#W\267\021#\337|LmE\246\306;\037tE\276\271"
+	.ascii	"\354\210<\013M\206\256\236YY5\322\275xe~,\241$X\277\253o\260"
+	.ascii	"$\343\023\253\307\001]\223\nU=s\f\323\b\367B\2037\252\357\252"
+	.ascii	"o'\225\352[1&/\276V\301\304\025\265@s\271\203\251H\264Y\201\251"
+	.ascii	"\032c\033\223)\244!\317\034\3434\256-\245J\204|\017\371vR\205"
+	.ascii	"|{\307d$\205cD{q&\365\306;&\242(\035cY\022\227.\352]>\246!\250"
+	.ascii	"\035\3061\245\t1\250o\2310\005==\230\322\304\327\323\267bL@\024"
+	.ascii	"pz\227\261:\247o>\246\237\t4\355\030\265\224\037d\305\020\231"
+	.ascii	"\320\303Rkz\343\223\245\352\013LL\357K\213\022\370'3\337\222"
+	.ascii	"\324\205~"
+	.ascii	"\276\313\363\233o)\002Az\214U/LP\031\335\202\274\361ni5\022U"
+	.ascii	"\006\201^Z\372\346[\022T\3721J\275\210\202\"S\372\226\311\222"
+	.ascii	"\035"
+	.string	"\020 c\023\323\263\211\276\201\3409\251I\337D\317\336H\337I\337\026:\251H\357\212-\311\035=sL\220\021\210\362D\314\2201)\206H\003\026\212\021\251u;\372\366n\251\315\350\231c\214\214E\306\037F\242\030$\006\022\263\264d\364\355\331\022[\3213\307<\215AJ\r\234\336\367\365Q$\266\004\346y\315.\036\360\343\203'\025Z\345\242\316\026\326\033\236\235\230\247\020\234\230\331i\ta\345@d\001\332\375\343\177\207Q\307\217o\037\263:\255\257\034^u\300P\316\215\021\3478\364\355\231\322\233\3203\3074\031k\224Gc\323H\023\363\364\201\336\373\276Q1B\246\332f\331\251\320\267gJnAU\306WIm\2531WEb\260\260\332\240o\305\224\332\032\3006u\373x\227\261:\037\337|J^@\317\034\243\325&\306pI\351z|\003};\251=\236\345S\322:SZo\336\231\375!Q\251\bS\253P\252b"
+	.string	"\024\357\237g\216\001\2139\322\022\366\317\223`V\246\365K\255B\211(\272"
+	.string	"\237\261V0\320\007\250\207\254\365\353+\354y\243\230\322\017OY\273\247\307\363\355\023\245\236\035h\213\247<\021\245\225\022\203\246\026\263\266\3266\313\372\355\200\220V\253I\315.\024\320<\330\332\250\035\213\307\343Y\301\352\341\216\266vNn\307\267P\252\205:\2369\306\255\205{a\302\311I\373\026\363\026\027#'\327\266\216\270*\341\0335\273H@\f]\365\255u\2369\306\256e\242D6\253NP\330\226\350\270\345@i\325\202D\323\320p\276s\276\235T\234o\217T\333n\242\264f\325$\273\262$\205\316\357\033\347\267G\252l6x\355\330b\235\330\0212\233o\331\252`5\317\034\223\327~\311\324 \233TD:\257.\226\346\273\346\333I\245\371\026Z\365j\356\265ZU\346\262\260\332\302\346\033\217T\271:\3073\307Pi\211(\221M\252\034\263\314b{\025\343\307\202"
+	.string	"\202W\325Z\305"
+	.ascii	"\306\b\306\020\306\024\266\315\032\311r|\027\366\373\315|c\323"
+	.ascii	"4\017\001\377\344\n\232D\333\357\377\030\265\337\357\275j\221"
+	.ascii	"NQ5:\300\3143\307\034\266R1\322\225%j\220\274((\274\234A\261"
+	.ascii	"\230iL\325;g\346[\301\352\317\222\3316Q\223\2460=\333\251\314"
+	.ascii	"/e\336\b\255\366\3044[%\231\232\225\245\351\"\036\220$\345\307"
+	.ascii	"(\237\215\243Va\234\255\021\242\224\"\"\272\227\207yyv\217:\315"
+	.ascii	"\001\247\025\252\022%\310G\t>\207\357\022(\342\360\3142:\355"
+	.ascii	"\317R\272\2624\r\274c^\366h}dv\254I \213hR-O\333#\263\323#\363"
+	.ascii	"\003\324\342x\034\236u\273\3617|\3739\2519p<\313F\225Fi\236\351"
+	.ascii	"\342\237ll\022\355\215\377\261i\336\215\357=\252\340\n\023\364"
+	.ascii	"\r\355k\375\217M\261\306\370\202\250oQ\246OUHDau\362Z\321o\363"
+	.ascii	"6\357\362\3757F\202wi\"\316,3$C\344\235C\202oj\257\212I\315g"
+	.ascii	"rt"
+	.string	"qg,\005\233_\235>\203<\351\241\r\203\355\r\257\221hmZ\247\214\021\222\f\020 m\263?\315\031\034\3426\236Y\346)\323\344\235cC\215\267\361\253\232\223Z\343\233\332\031\034\241\2029a\222\342\207\302?\231\231\306S\233c)-\321\276-S&J\210\314\324T\333l\327\3604Xz\006\253\245\341k\370V\315\306\252I\303\267q\324\253\251\3665\302W\032h\200\021T\261\2132W\2123~\0043\236=\242\2105C\021\026Q\006\353\220%\223\341g\220\341Y6\305\"1h\261Ud\270\be|\f2\236=\242x\005\3033\313x\261\2012`$\376X@\231#c2ddm\263ka\214\207\341\333I\215\361\354\021\305*\251N\241\210t\202\b\312X*|n\"x\026\212b\020\f(\2337\005\306\263{\212@!xf\03146\312\013\026\n{'\243&\263&\303&\303\026\202\357\264\006\261\247\370\363\324\354\242"
+	.string	"m\211\205\321\246\t \240\233\0233NA\360\355O\334\007\244\036xs\222D\315\003\337\006\265u\340\233\310\327\233\326\013\266\027\004pc\227\310\274\235\275\370\026H\215\003\337D\276\234\314\031\025\022\340\237\274\376\364\0066\020W\202\006\342\330\263%\032\370\226\250,\003\257B\223!\f<\263\214\034K\246l\342\222a\340[ \261\013\254I[X\300\002^\003\250"
+	.string	"\330\327\023\277\n|W\271(\240&\200\tL\340\035\232x\025\245y&\t/daE\013_\370\266\207\210\004\312\002\340\202\013D#D\240J\331Bo\217\245\232b\304\213\300\367T\b\004\276\211|\221\261x\300\003\336\241\211?\"\264\360\314\314:\261P\312\026O}2~!x\263[\333\254\221\256\205o\305'\013\337D\274\252ZB9\274\352=\366\002Cp\300\267\222\003\336\241\207\212\r\240c\225^\fNs\006\033\360M\210\304\200Oa\032\267"
+	.string	";\326\310Pm\001\337oI4\317\374\241\200Oa:\224"
+	.string	"(\254\020Y\316`\002\276e;$D\3003\313Da\201\224\307\025p\271(\343\367\301\232\366\b\370\326\355\347"
+	.string	"\337i\335MOBR\232\335Z\027\277\246}\333Tiz\225W\264w\361\275\330+PN\2732'\025\355;\2551\330;\004\341\237\274\362D\305\n\370,_\212\025\3755\257\323_\363M\375\340\007\246\270\242\346W\300\367\320T\267B\025vG9"
+	.string	"=<\226G\016\031\277\020Z\277\234\301\025\276\355\222h\236\311\352\250\360\255\330,\021/C\255\257\200\311\316\242\n\034%\213\233\233@\257*)\312\336F\331\302\251\346&\321\013\020E\n\217\002\333T\266\024=6G\317\351\245\360-\205}\225-\234\362\326\352\215\214_\b(|\213\247\251\001"
+	.string	"\313\336\367\016\271\2424\317LT\262\220~0\350\345\367\301:\366\207\206\275\350\325\327wUzxp\302\027\340[il\017\204\265\212\262\361\b\233\356\204o\274=&\034\302*\250l\301,\263\267\006\312P\001\234\341!\343\027\302\001\332f\013\360-\366\230\254}\253\337\001\270\245X\006PFPF\260m\326\204o\"^}ZBc\357{\207H'V\232\335Z\002\274\313X\035\001\276\367\016\215\276\346\220\310\204\fa\357\031VK(\\\247\364\341Ii\325J\3706\316\360\260\3053\313\034\256P\224\306\037?\275\250\035\213\327\342YA\303\302\001\314\311Iy\022\307\252\r\340\3318CB\0018Q\232p\222\221\256nK\"\343\217_\264I\233"
+	.string	"\004IP\\\227t\255)!\341\331=C\273"
+	.string	"<\263\314tES\032\177\374\262\022\231g\216\3263\231*\013\002\n\036\264\317l\205.\231\315e\215\263m6D\336\223\303\234AOB\224\324\3017\2116"
+	.string	"\3176\375\260\002\360\0165\214c\361#|#6\006\362\236\330\001\200D\223hY\374\217\371E\261\370\3363l\3634C6\016\224\316\274\324Y\356\360\316a\207\032\"E\233\317\334@\204\235\365\310\022\210\261\331G$\f\214.\204\027\301k\206)\204W\341I\006_\001\202\212_\361\036\232\340"
+	.ascii	"\235T\025\377P\303\241\024\317\274\354Y\265\226?\306f\237S\026"
+	.ascii	"\026\212O\361\355\244\242\370U\320\020\250\205p|J|\360m\365\301"
+	.ascii	"\373\236\341\217\007@k<\203\b9\270\260\310\301\305\003\317 \302"
+	.ascii	"\r\0338\270\310\270\301\002\307\f2\314\250a\004\317"
+	.string	" \302\r\0345d\320\300q\343\206\021\300"
+	.string	"\243\004\317 \302\r\0310\330\240\001\202\030.,b\304\220\224\341r\003\016\0305d\230qce\006\0342\324\220QC+\203\006\f\027`p\201aC\004+0\260\340\"\303\345\006\0341`\304pC\r\0304(\270\021C\306\215\365\306\214\032j\230A\243\305\321.2f\3040\003G\r\0310\314`\221aF\f5l$"
+	.string	"\207\213\r\033Xp\310\240!\006\214\027j\260p\003\207\213\215\027d\2501\243\306\f\0304d\270\204\200\241\006\f\0324l\3040\306\020\203\r\0314\300\260\300\013\214\022\300\250q\003\005d\324 \002\0307f\300"
+	.string	"\202\306\r.\310\300\001\303\305H\303F\r\031\n\220\201\003\206\313\n\216\0322h\324\220aF\r\007\260\341\362\"\303\0049\330\020\301\317h\0314`\270\304\300\342\250q\203\215\004\324 \243F\r\0303\304\350\200\343\006\f\025\344 \003\206\032,\310\250aF\f6\\^\210\341r\243\002\0317\324"
+	.string	"\003\007V\006\314\214\n\300\300\001\003\206c\f\227\033\377B\005\""
+	.ascii	"\003\215\030-\307\020\301\206\0334X\330p\203\006\213\0323`\320"
+	.ascii	"`\021\303\345\006\013\021@\260\r\033d\270\260\300a\303\206\013"
+	.ascii	"\213\260\034\037\204\273\254\217\202E\206\234k\024t\317\264\275"
+	.ascii	"\327+Q\251\223s\r\203\231\236i_\347u\336\277\371\276\357\333"
+	.ascii	"ZV;\212XN\302\351\347\005H\352\033\020\361\253\227\240\253\276"
+	.ascii	"\200/\3570j\223U\035\252~\017\346\021~\345ae\340y\201'\"%R[\264"
+	.ascii	"i\304F\345$\234\200\274,\345\201uxjf\206\241q\246\231(\022zB"
+	.ascii	"q\177\210F\2501\323w\352\263D\031\331\025Y\227Pa\302\364\362"
+	.ascii	"4.\265O\377\231,y\237\276\017\351\025\246(\243\265%\357yG=\023"
+	.ascii	"\32523L\216C\315De\260\214\313\313\252\222\303\253D\244\334\027"
+	.ascii	"\377\351%\252\006_|\226\250\242\274\253\017\255l\337\354\331"
+	.ascii	"\032%ScuO\376h\357B\034\352e\252\204\336K\325\313\225T\257\\"
+	.ascii	"I6\317\344\017\315n\255'\376\243\275\331{\342\273\220^YB+z{\263"
+	.ascii	"w\251\3660\230g\205\370R\004\361{pJ\365\271Z\305\224i\325\341"
+	.ascii	"3\277`\315\004\275\037~\253\031\276\337M!t\251 \225\007\374G"
+	.ascii	"w\240\230\273\222\023\275p\035_\274^\300\246\270\025\276\377"
+	.ascii	"hGr\257\362?\367\314/c/d\3369^\370_\367^\345)\240\362c\315I\375"
+	.ascii	"\272\377\304)l\377sN\370\016\244?\360M\001\213fM)\022\235\372"
+	.ascii	"'_`\253\205\030\341\336\270\325R\310\302\376\234\327q\373\317"
+	.ascii	"y\017j\026\253\2619\013\214n\357B\355Od=\004E\3739o\204\373\206"
+	.ascii	"\242\"\2247\310\327\001h&\352\203\262\016=^\326Lt\360\351\360"
+	.ascii	"\363\002\355\227\266\326\005\337\007\277\235T\301\367\240\006"
+	.ascii	"\3017\205\250\205\370\005\315r\355\212\346\016<^\324\274sx\204"
+	.ascii	"\016;^\326\330^\332\370\305\355\345-\255[\207\223**i\240M\263"
+	.ascii	"\013\251\177r\b>z\216\032\252\235\362!\332\252\324vj\361\376"
+	.ascii	"q^\347q\276\255\306\370\252\255l\037\347\333)\357<\215\001\264"
+	.ascii	"\2335\233#>\222\327\006\244\243\002\343:\340\340\005~;x\347\005"
+	.ascii	"(\327\301\006\360\333\304;\256?\272\016\315?-?\273\016\257\322"
+	.ascii	"\357\333\263;\254\276g~\201\202\234\276\350{\366\356\256H\024"
+	.ascii	"d\342\013\036R\352\002\365\222GB/\204\016\316Z\316`\216\023\356"
+	.ascii	"\306\b\033\n\004m\313\367,\031\022,\035w*\317\374B\345\305\317"
+	.ascii	";\247\345k\365\336\251\274\b\264\233<'\265\325{\007\352\017\203"
+	.ascii	"w*\bIA\351'\276o\361\336\375\234\324*\375Z\357|?b\257Z\265\331"
+	.ascii	"rB\321\372\336\267\222\261Q\264\257\365\276\367\316\323.@\253"
+	.ascii	"v6L\326\300\354\242M\377\344\225\037\375l\353\236\205\352\255"
+	.ascii	"\025\3757\257\003\244\377\346}\007\323\bH3\335|[\367\030<Q\337"
+	.ascii	"l\216\364\376\220\203/\200H\301\027\301\022Nw\310@5\275\367\035"
+	.ascii	"\r\342\t\330\233[\324 Z?\363\236\371\205\020\351\247$\321\227"
+	.ascii	"\007\346\025\2056\273\b2\245\020\271\327\265\246\227\207\367"
+	.ascii	">\345\333\302\244\224w\274'Af\263\005\343#}\227\362\235\326^"
+	.ascii	"\244\306\3765\273\265\377\276K\2775lz\225/8\363(\377\257\337"
+	.ascii	"\275Gy\243\233\223z\367\356\035\030\3223\277\034\"\243Jd\025"
+	.ascii	"j\226\022f\230/\244\335\213\264MB)D\323C\322!\353^\024_\246/"
+	.ascii	"U\030f\333l[\350P\276\005\335\356=\372\306\247\305\303"
+	.string	"^\272\240I\264n\367\217\204\2125FG\343\211v\337|`CPZ\005\230R]\023\t\367\346W\367m\"X\017]\r\262I\233\261\220\356]\261\257\352\234\023\271dm\356\215g_S9\034d\332\0134\271o\007\277\024\237\350 \315\312\236|\233\370%\215{f\230\035H$J\023NH1\344\030\314\016L\017\314\017\314O\334\223\257\303h]\003\371'\363\227\\\022\034\034\2176\302@i \322\3333R\013\351u\024gT\364\376\246\205\334RQ\364\035\3676\327&\030u\362\214\264B\032)z#\362\361\356\304\ny\225\302\307\367\233\023'?\202K\334\236\221Q\310\251\037nC<\357nQH\251\017x\276\335\334\350\332\004\303\232<#\203 \235\204\332\202t\336\233\004A>=\320\371nk\362\235\326\027\274\375\bRI\003\333\236\221FH Jn\251\277\242j\025\345\360\252\217f\203\001\352\260V\030m6\220\315{\333\213"
+	.ascii	"i\204<:a\264\371f\353\016~\026\307\362\320~\264}r\360\013\210"
+	.ascii	"I\020\362\307\020\22372\371\352\351\301\3066\375Y2\204\004\352"
+	.ascii	"\261\344[>.\251\317\332\332;\227a\224\346\231=\377d\346\n\214"
+	.ascii	"\322<\223\253.J\363L.:\036W\242\204mG\215\b\251C'\355]\355\215"
+	.ascii	"jN*\332{\332\213\360\263\331jz\225s\020jvk\375\354\035\355\223"
+	.ascii	"~6G\320\367\263o'\025\372\306;./3#\244\215\022Yc$3{#\023.\256"
+	.ascii	"2$d\016%\222Y\366-\023.-\036I\336e\254.\3117\037\327\0162 ,\323"
+	.ascii	"E\262g\007\271\256\220,\261H_\224@d\361\220<;\310U\325:|l\354"
+	.ascii	"\233\217\013I\354\311REI(\366\255\030\227\321\221&\226@@\277"
+	.ascii	"#\277&r\021\205=\261\364Qq\013\373\365\216k\b,\212E\357E\236"
+	.ascii	"_\316 \330\257\211\\A_BX\244(I8\335\261D\201\231\252\202\271"
+	.ascii	"\272j\375\213\013(I\263\013\235"
+	.string	"g\206)\302b73e\242\356\254\275\353\335\353\333\331\244\331\365\306\263\255\316\341z\027\256o\276-\351\026\026\313\023\245\006zp,q0Z\\0^^[\337i\r\342\311\226\340X\263\013\034-0\026\267&~Y\357ZY\317&n\275a\035aa[25\362\216e\344\333\263-\267\"c,j\0330\341\204\306\222\006CV\006\003\205\266N\344\275\310\267\223J\344[\261\255\266\260\3666\267W\032x\363\317\231\251\266\254}\324\252\210U\234W,dW\177\202ZU\313\352y\345\220eL-g\320\352\377\t\226\242W\253\300\222F\231>\265\251\3720\026\243v\252\367\252og\217/\0304\252\327\200\332\242ThJ\215\245\353E\005\\x9\203S\377\203X\202C\326X\262\260\214\270\345\f\366\264\013y\037\362\254\237\215\225\324\273\220o'U\352\377\016\313.\212\215\345\312\252\n\352=\n\352\237\t\026\335\3233\303\264\261\f\331"
+	.ascii	"\b=\0307\026!"
+	.ascii	"0o\025\350I=\231\323\373\323\267\223\352\364\317\004K\256)\216"
+	.ascii	"\345IY\201\036K\023\213\023\214\034\035\214\235]\333\254O\233"
+	.ascii	"\336\261\340\2424\317\254a\372 \323V\266\376|g\372v\n\001y~\004"
+	.ascii	"\n\207h\202\260 \371\322{\020\226\242\245wQ\253\322t\245wQ\372"
+	.ascii	"\346\303\002\253\266\n,\257\034\377d\206\201\202U%\007\205\205"
+	.ascii	"\024e\372\264\231\016\344\231a\360\234\357@~en\314Ie\361\211"
+	.ascii	"\002\003\350\001+\212\030\330o\t\276\242\231a\360f\202\016g\376"
+	.ascii	"\311\f\223\347|F\004\033\312R\337\222\r\362\256\323+Vc|I\317"
+	.ascii	"\006a\351\221\364\335C\355M*\204\346\353\3736\f\225\226\031\306"
+	.ascii	"\017\006\360\314\b]\224\346\2312\377d\020\332\212|)\331\037\037"
+	.ascii	"\242\355\352\017\346\325\372\235\257\023\243e\203\236\245\361"
+	.ascii	"\303\212\371'\363\217g\317\214\274)\035\211\017\351\375\314\210"
+	.ascii	"[\224\346\231A\357:\375\201\317\b\027awZ\263\264]QI\003a\216"
+	.ascii	"t\350\270\321\373\321\267nNj\231\267b\337\206=3\f!L\241w\216"
+	.ascii	"\033}{g\005\326YtV/\377<d\271y\001\202\323\213\276\275\263\322"
+	.ascii	"r\034\276g\016N\364\255D\364~fU\344\307\267b?~}bu5\364m\330\373"
+	.ascii	"\324I\365\241_\317\254\252\\\350\231a\244,L\245\007+U\226\027"
+	.ascii	"F\021f\nS\205\251\n\275\3334\210D+\244(M\t\n\333\203\230\036"
+	.ascii	"\364\315ge\344RZ\205\325\020\016V=\321\3463oP6\227;\026\243\315"
+	.ascii	"g\342\360r\367\361\314J\247\022\207W\016W\020c\244:\312\035;"
+	.ascii	"\332f\335\307\237\200F\27513\325:\320\273\214\361\255\020\256"
+	.ascii	"T\231\231\332Q\366\364\264\315:\320\237\2006u\371\342\373\371"
+	.ascii	"\377\022\374y\034h\207\322#\255b\212\216\004>\017\330$Z\357y"
+	.ascii	"\367\371v\366\350S*\177f\210\274\347]\320\nY(\267(\033\240<\377"
+	.ascii	"P>\236\307\001\255P\247UL\265E\231>\265\341\317\323\354\3262"
+	.ascii	"+\203\224C\\Q\232\032g;\377gSv\036\007\264\277\233V1\205E\303"
+	.ascii	"\312\231\225F"
+	.string	"J\244\251\242h\363\231@\226;\246\210\242\315\032\376\371g\375I\216\203\017m\347\361\237d\345\316y<\016hSx\264\212\251\240(\323\2474\354xf\345\322JT\271b\347;\276\025\033\242\350:\236Y\371\\\231S\232\320[y\262\"\247lR>)\243\224Qm\263\255\232\216o\237\f\021\324yf\245\220\2257\245\007zRV\234\264x:\337i\035bp\310[`\263\213\021x\016\223\234'\001mm\206\343L\255,\371\363\303\371\266S\273\371\007\244\r9\253V\320\224\203\316o93\233_\347\272\216\214j\256V\222(\225\206Kh\211\232\2251\247\371\026\252\336,\262rD\251L\\BKx\363\233\353\313s|\314\031\325\231\337\305%CEIu\346w[\226\277\037sF\325\252\276\221\"2TrT\255\250\037s6\225N\237J\351\201\236\022ke*\212S\250\364#U\212\013\355\223b\224&!Rhf\006\303\b\240"
+	.string	"\223\030"
+	.string	"\f\005\002E\023\325T\332\001\024\200\031S\216XXT4\222\214\244y\212\205a\207Q\211"
+	.string	"\002"
+	.ascii	" \b\236D\351\230\340\217\216\372\320{p\305\376g\0020\344O\206"
+	.ascii	"\211\244\255\311PK\242\370\335\027\373\216\322\002\004\207\324"
+	.ascii	"\347v\247`\270\025\332\203\333\312\016\232\346\204\220D\263\200"
+	.ascii	"\203!/`4)\177(\274\211i\342\336\rwg#\214\020\300\214\3415\fC"
+	.ascii	"H\005+\314\212\335)\344\200\331\255\313\216\222>\375\323\345"
+	.ascii	"\023\326R\217w$\312\230\234\312\235}\025\277`\246\336\220Tg\233"
+	.ascii	"b,\233\371\204jc\244nR\363G\222|]\013\3244\374\341\265$\016\314"
+	.ascii	"\334\371i\350=\221\306V2C\272\260D\347K\271?\200*\2203%\346\347"
+	.ascii	"\310A>\340:\233\342\307\342\3755\225\202\312\3310\240\342G\323"
+	.ascii	",\350.\250\361;\305L<LYa\312\222\210r\323\205T\b\214B\370\232"
+	.ascii	"\034\335V\317z\264\025\310\237C\343\251\026\260C\377w\336\364"
+	.ascii	"\241\211%\345\353N\225\024T\032_\363\021+\274r\340yV\003\336"
+	.ascii	"?\346\030\344\367\272@a>i2R\\\234\203Ql?\032\214\264\f\001\343"
+	.ascii	"\256\275\321X\343*\256\313_\220\201:\205\372\320Q\220\332\371"
+	.ascii	"lX]BJ\312hzn\020T}\177\272\342\026m\030\024\373Xr&a{\213^\255"
+	.ascii	"\025w\202s\316N2$a\246\202)3L\017\311H\232\305\257\342%O\201"
+	.ascii	"\032\370u\3038\2703EW\364\345.\316\321\273\312\nw\307<\241\365"
+	.ascii	"1g\363w\030\3704\355\370Ir7\230\n]\333\352\376\016Q\320\255\230"
+	.ascii	"d\353\314\373=\241\340\326\270\332\226\t\031\306p\227\253SvG"
+	.ascii	"\021\2075\006\004\201\021V\006\224\017\265{\255(\225\036\n\352"
+	.ascii	"\331u\372\215\211Rh\233-|\007\342K\231+\"\323\233U\035Y\214\263"
+	.ascii	"\206M\312:\214?g[\334D\274_\376\2505\333\177\266>mOO4^\254|\006"
+	.ascii	"\274N\363\354\335\3238\272\354\032\027.\372\022\023\220t\222"
+	.ascii	"\274\230\234\310S\225\302\221,'|o\371\343\b\332}\301\361\350"
+	.ascii	"\325\276\200r\220\351"
+	.string	"\360\327Y\322*\243$Mv\f\332fC%Y\023%\275&5k5Px\273\273\337qSl\r\253?\374\003\274\024\205W\027\2664R\264G\024J\242)\204\272\214\245\261\242]\004Q\022M!tE,\355\025m$\200\022h\n\243(ci\311e\027\314\263\035!\270\021\2469\034\266/\230z\3705\275\260{0.|\302\306\225\035\240\221\202Z\002\204E[\277\360c\313+\262\252\244\r1\247\317i\252\222 \310\361\r\314\351A\307\266\303n5\026}\0239\374\375\242\007\341\256\3628\037C!t\220\025r4\243\374s\300\362\265\034+\033\260)\246\245N\017\243my [\232\351\310P\347\361\013f\017\323R%\202\334q>2\373\222\334\374\236,\300\3224\263\n|}>\013\340:\344\345\356\24669\325\274\030Q\013u\211>\270\256\217X\005\017\260\rM\230\313QB2\n\305\276\203ME\005=\333\366i\266|X\236"
+	.string	"\261\034t\210Z\237\367\226\243\322K\177\260\260\254\373x\321\030\"\340x\025\373\246[\3730\322tp?\225\372\005\377\240\252\245\320,O\311\003\365\202\270\360\3330\344\364\037~\021F\fJ\316\212XvxN\360&}\032\337\245\\\240\022\202r\203\327 \350\220]\nm\200\323\007b\246s\347\r[a\253\216\225\210B\370XNd)VH\ff \232\200GA\313\006G\272\177\304=BI\363\r\304\237\005\025%\002:\272\b\222"
+	.string	"\032t\214\374\220:\220d\274\316\233\306\021\274l\300\330n\274dm\020\036\203\205\303Y\326\030\240\223E\322o-\232\273"
+	.string	"sw\273m}\025!\231-z>W\241\237\357\234\342l\332$\203\251\376O\025\240\313)'\013[iv0ZA\266\246\003\026G"
+	.ascii	"-V\n;\323;\302\270\242<\204\023\322\321\215\374\006\377\r Z\250"
+	.ascii	"R\260\223z\027D\245\3053\312\027\227Y\034\374\235\027\264\325"
+	.ascii	"\364\nh\224H\304\226_<\351d\362\305I\252\\\375h\310v\347#\004"
+	.ascii	"AC{\211pw\251\356d\227\323w\240O\271\304\215Kg;\245\326\007A"
+	.ascii	"1\260\222\240%o'o\323C`\353{\0271\331\344H~K\311\0238\201\244"
+	.ascii	"\026i\023\362\246\217\235\212\302d?\007\0039\236\246I\00284\373"
+	.ascii	"\243\347\274\274#\2343\236\203\325\367\343>/(8RAo\024\027\024"
+	.ascii	"\340"
+	.string	"R\\bK1\306O\2205\301D\303^\271S\256\024\303d\315S\342/\226\204\224N\261 \273\210\240\250\t}\236i\002Z1pt\325/\210G\241\237\224\223(9\371\2715\215\265\nrWE\236\354\333\270\362\367\303\354\302\250\r\320I\215Q)\r\244\340\336}\305\bWs\220N\370\205Lg\331\326B\352\317\032\211\036\266?5P47\227\221\360XY\267\333o \333\212\206\367\2244\355\240\350:\370\0132\271\2012!k$:\324\303\032\013\362\273\363B\350\003\224\004\326\356V\016$\2243d&e\305Zd\234D|`s\340d)z\fW\323E\013S\314\311\261%\320[S\360\245w\202\245\0239\024\305\311\273\262\327\036Y\271E\325N\322\202\201"
+	.string	"\345\367\310\266\320^\374\036_\277\334\343\266\203\247\367\302\202\351E\032\320\022\206\321\327\237\tX\034\017\326\300J\0044\230\313\277\237+b\226\340E\001n\007\266p\336\013@\004\305\237.8\240Y\272\270\3651~\202\340q1\345\230S\265\020\002\240;8\241<\020\261\217q]\266n\240\024mv 5\002\246\206\362-\375XW\201\001\211s\3622\273\271Z\f\200~8L1w\247:\331U\327\\\211\303r?\320\244@\363r\243\0370\351~\223\347\222\276.\364S\340\245\264Z\005~\341\024\f\352\273\216\211\354\214J\3668\273\373QCx\364\302\370\307C\242\216\344\360\340\362\013\026\267UF\301\207\312\263>;C\n\026`\006\327\343$\340\f\030\034\270\261\203\2633\351Q\300\215\2442"
+	.string	"84n\321P\203t\265*\305\250jR)\250.\2141\351Z(\177W<\273\030\356\246<\037\371\341\277H\031\345\310l\237Gk! h\352\003\352'\302G\ro\004\276\351\300\223u\201eT$\275\036\rO\357\234"
+	.string	"\321\343\032*\205\241O70\310\330\326\034C\274\350\236\220\372Io\324\005\021\277\261\244\216\352~\247\326\2730su\364vXbo"
+	.string	"\240\023\t\257t\0368\n\335\350\335\tDn\213<\004\035)\020ZB\252%\201\360O\205\257%_\252^\240\003\333\220\374\273\270Cr+y\005\033\006\274va\203\b\366k_\200\247\005\263*\206\263\253\231X\344|I\330\206\200\200\016\223\315g\t\256\313\226\226\357\302\030T\022\303\207\317\331\353-\rcVA@\341\252\002\021C\002P\270\233\350\rg\355\240\336]|p\301\251\233s\201\315Mc3\025\204\211H\210\345\0351\246\022p(:\177\334\nG>\325_\366\343\310\217\002+\265}\251\266\373\340>0N\241\204\316\262\245#V\233H\254\261\036\374\205!`q\341\2139\017a\206\312\332\324L\347\326\006o\231z\250\307\335"
+	.string	"\247Wi\330"
+	.string	"6\033\226f_6h*\251\265\325\016\221,\027=>Z\333"
+	.string	"\230a\271\327\003\312\206\335\234\004;!\221A\301{r\320\234\250%.\211\257/x\215\241\347\335_`\216I\030\336\222(XV\237\f~\346\322\236\340i\313\245\260\340\370\205Q\337\201\005\360\313\344\225\372\212q\236\307 $\221\351\305nmO\327\321n\177\352\030K\321\030V\355\245=;\007\002\262O\031d\334E\f\267uX\032\224\300\217\233\371\372\262e\226\227\361\230\354)L.\274\363\021~\374B?\341\r\333Q=\371\272*_\360'\030\235\337\373a\352\351\261\215,\232\253?\311\300\016E\025:\265\206\3658\242\232e\023\343\001\373\253\226p)\3236S\361\274\242\3775r\212"
+	.string	"\363\2155\001]\223\b\\'DQ\243\314\233ZZ\203\t\247a"
+	.string	"]\017\325D\002\366+\017{\326XG\351}\330\201<9\301\200Vf\003\241L@\332\344b.z-]`\206:\013\202\354as\262\274\224Ur\252\365d\2510Q\3074\303o\031,%\327\342N\225\373\035\222!\025\366@\377\"h\r,\341\025\204W+\343M\276\315\360\363h\324)\211\346\342"
+	.string	"\b\242\256\301\025y\315F|G\322)?\234+\354\250\305\t\203\355\267\305\330\006\365\214k\305\267j\"\264$\243p\374TS\021}\0320\211[\252j\206i\033\352\254/\335J\356\226\0227\026\3015\340\373\322\365\356\224\032\004S\223y\232\265\202\327\362\206uxW\314\021\005K]\203(8\002\236\026\275\240,D\352_\212a\243\311v\030\202\004H\346\336\222\226\374\243e\200K\255"
+	.ascii	"\210\\\n&\303\207\312\230+\013\375$H\215\221\351\261\324\242"
+	.ascii	"\217\266\246\242R\\H\004t\005\206b\200{\237\270\223\347\243_"
+	.ascii	"\231\205\243\210\b\341\377\234\330\202Z\264\362\365\212Q\213"
+	.ascii	"(\300:)dU\375}\3501\252`\013\332\363\tSzx5H(zt\224\236\335\364"
+	.ascii	"\315W\355\305Rl+\323\\\227 \233\310i\277\362N\223\020$Ga\224"
+	.ascii	"T\n\213\216\021g.\b>\275\316\375\371i\316\305\224\321\353\220"
+	.ascii	"\220z~"
+	.string	"\023\323n\002\362m\"\262\261\372\005sPF\305\030\206\3545\230\341\271\250\022A\02648 \f\270;I\333\266\003\327~\352D*\314\370*\247\246e^\222o\024\301\207\244s\t\262\205\205[\207\237N9W\267A,\243\022QeBk\272\253\263\212B\036\215\020\242\006\237\206\256\360\016\334\371\237\235Gh\231\370X0Vy\345R\022V\305\265m\365\f\356\245o\0245\254w?\267\026\027T\246\377\2236Gm\233/\f\353!\002\317\266r\322\237r\005V\224-\237Y\032\035\2550)rFJ\030N \3706{\331\234\221\3059\314\2714\2551\250$.\267\223\250\017\320\033\022j\206[\202\274n\273\243\327\334\306\033\031YM\200W]\212\245\003\370\333\241\246\341\374\345\212K]\223\033\211\001\"\270\355\b\200Q\247\247,\b\246)\036\236I\273\213\372\016\235\247\352\203\240\333\364\24484\324K\3300#f\337\270\220h\020\255"
+	.string	"\036\205\224\335r\245r\322\323Ih\r0\374\304\023K\241W\007C\337%l\203\227\230\274\267\r\353[+\256P\273;I\351\253e\246\260\263\325\b`T"
+	.ascii	";\211\321\200\024\202\216\333\203jt\206B\356Vd\241%\371\366\327"
+	.ascii	"\002\205,\273\026H8\377\350\312\226\003@\203\226\221B\002\245"
+	.ascii	"\005F\214\254;\374\257o\210\265D\345\201 \345\201\352\212\341"
+	.ascii	"\336\210\303\t\360B\240\352\301\232\275\324\f\361\214\030mqk"
+	.ascii	"\266\356n\220f\333\351\007 D\303\tm\023Y\266b\324m\236\177\335"
+	.ascii	"H+\0345\260\227\253;\273\315A\237\277w\030\323\272r\313\267\256"
+	.ascii	"\322=\221\337\306\364\355$$k\206\267N\266\367\262\241=\306\344"
+	.ascii	">r\376f\374\304\222!\313\277\003\021`5t\t$\332\324\243\177$\350"
+	.ascii	"\026:\004\244[C\230\206\251\365\251\356\223h\353\201\00179\224"
+	.ascii	"#\025\036\0344\373\205\203\313\312K\244\341\271\242\n\032\204"
+	.ascii	"Y\253\266\340\334\211\244\250\302\f\244\331\002\262\250\016\340"
+	.ascii	"f\350\305\344K[\237[j [\216>\234\371[TF\027\n\0138\251\006\311"
+	.ascii	"\257\330\272\320\372\021\245m\220\016_\263\227Vp9O\333%\310^"
+	.ascii	"|\337!\036\001\276\340\331e]\201\026\232\004,\200!\225\203\315"
+	.ascii	"\230\243\214n(\305\t/\236\203\020\207\204\216\315\241\217\023"
+	.ascii	"T\302\323\343e2z\301\350\305\337\273\006\241\301\027i\355c[\243"
+	.ascii	"{\300\272\256\302t\231\tj|\304\332\\\323%L\247\360\b\376\315"
+	.ascii	"\215\324\013\332\202\244o2GIYq\223\251\026\271\267\006\273$]"
+	.ascii	"$\316O\223\036o\220\301\277\201\326h\320\200~\362m\246\247d\327"
+	.ascii	"d\246\340\373\311\250\221\341\342\376\321\351M"
+	.ascii	"P\351\004\223\037a\300e (Z\016i<6r\346:\353t\216\313\257M#uM"
+	.ascii	"\265%\354_M&\205'\3231\373\336\271ik\333\"0!\266\204\216\210"
+	.ascii	"\260\002$\263X\364\274G-\334\210\311c\316\320BHG\312\032\275"
+	.ascii	"\204\345y\fE\364\270\271\306\302\201\302\253\374\236\246\307"
+	.ascii	"2N@\020g\005\347\322\022\376\202\344\324\344n\030\314\214\246"
+	.ascii	"\350I\345\267h:\322\371\213\340\325\306V^;\203\333\253\350\311"
+	.ascii	"\203\300\201\023\377\242xb\325\n\350\213\361\034\326%\242k\324"
+	.ascii	"h\276\373\214\270\037\021!\347\357\313%[\236\221\340\346>\202"
+	.ascii	"o$\344\240\360\001"
+	.string	"]b\301\244@\226\025Pom\362\344\221w\031\004\251\020\211\023\306\017\371\272\202\"\353\230\306\207M>Uo\376\332\374\350\336\357\233a\215\373\237[Z^*\377s\033\274Z\311\326\310\247\002c\237\350Q\261\210\\9}\036\201X\003\277\301T\363\206\351t)\243\311\231\220E\374\263\317_\303#\274\325\024;p:\363_\234\214\257hz\312\262\203\264\234\270\332\243\344\210\213o\335\027l\276\256,/\201]\327{\342\213\025\354NCC\3724&\202\3644\251\367\347\214\347-'/\235}\n\265\371\371Q\241\330\021\027\025QTS\242Lm\273\034J\347f\225\203!\354x\021\3776\352D\303\251\377\364X\027\177\021\242\237]\233\330\234\033\365I\241\275\023\240\357\"\240\345\310\260a|\341#\272\024'\030,6\223\307\272\261\210\327\225\326Lw\370g\362;\331\336\301\220\245\027\237ph\255X\277 \300pX^\214\302\017\222Odb"
+	.ascii	" \b\271\271l\223\253\315CK\272J\257\250t\037n]\323\004\210\022"
+	.ascii	"V\034?9\350\037\207\341\035\001\204B\371{\332\374\310\230\273"
+	.ascii	"=\331\306\316\037\340\314\246\222\254\311\370]?~>{\006\236/p"
+	.ascii	"\331\261\t\214\224\273\252\226\345o+\330N,H\264\013\245\333\027"
+	.ascii	"\001(\220o\346\204\301\200\325\236'(xXf;07\274~S.$\313>\341\336"
+	.ascii	"\264H\242/\366\224\220\022Y\274@\271\362\274\252\215\264\346"
+	.ascii	"\363\030i9t+\264u?\001\267\266\b\020.+\030;.\237\234\017\362"
+	.ascii	"\177\004<\324S\255\236\204\235Idy\231\033\215\005\024=?\345\351"
+	.ascii	"\037e\364\340\031\255\203D\350A,dpb"
+	.string	"}\202\325x\0369-\227\326~)\372HYh\343-\324\250L\224b\f\327\032v%\360)\22159t\204D$7\227\017\037\n\314\027\337\236\313\211\363b\220\306EGu\306(\220xy\275\210\362\227cGf@\326\341\330H\236db^\023F\027\356\342\272\351\264\025.I\200\3349\032R\351\312I\227\350\001E|\275,\037\r\270\r\2704\026\024\223]\315@d9M\210-q\222\300\\u\352d\366\177\203%\272\363C\243\036\306\331\343a%O\275\026\024R\302\300\214ayU:\f%xL\035x\025\201\343\032\304\301\024t&\f\361\203\2415\230\355\\\256\024\035\317\305\216\024f{\277\326\227\005}\027-l7c\221\371\f\377\220\026T\006\364c\237^NW\001\177\342\334(\224\322z(\\z\313\274\304U\350F\211\337\205\352\373\212^\303\267P\216D2\355AL\313\020*\030\016\361\340\302G\334xi\203\\\2175"
+	.string	"S\203\234\372\241\260\374\232\2434\325Vx\275\016w\352\200\026\365\025\310M\202\033\023F\207K\230\032\224\327\b\336q\347\243\374\026\t.\334\223\236\b3\251\232^\271\332A\2023S&\267\301/\203*\345\247\270\314\223\275\023\242\260\317L\321\375\351k\340\343b\373&1\207q2\253g\223<$*a\2059.\254\005d\215D\320\270\363\002\347\304\203a\201\245"
+	.string	"\032\021\322\n\265-\341\300\344\224\201M\300\007\243\357\230\221Q\361\036\277\362$A\277\234\304\324\355\025\033$r0\314\210\031h\024J\371X/\353\344\224\001\375\351\0366\242\037\364\027\330#\303!\216X\272\303qm\234\026\311\227=\247v\350k<\201\376^\255BJ\007\005l\237\377\016\350>M\364\223\316\333\033\333\216\333\256\337\fFy\224\325\250\227\307e{8\026\"~\\[\317\244\261l\007\0227\367?\036\224\347\266\317\2108\022\327\277\310:\230\264\323\035\366tP\373\327Bq\276\311\352\335\356;\202=r\333"
+	.string	"RSn\320\203\260\326\322\2066\247\362\252J\375\276\006\b\002~\314\371\222Q\334,\005\301V)\214w@\037\371\266\213\245\327C8\205$}\324t\031\302\267\325\024\351\267\303\274\241\364\241\253\341r\214\220G\223\334"
+	.string	"\034\344pi\243\210~\033n\034<\030\0207\220!\f\374\212J\364t\231\214R<\027\2378\210\371\202\245\206\231Y\025DP\2520M\257\316\\\274\244\335\345\020AQ&D\262&\\K\216\322\035)i\203\241U\201\326\310\230B\243m}s\\.k\323\337J\326u\026a\211\251\207\2115tF\035D\b*\214\237\017\\\204feh\247\004\207\205ZA*\270\\y\214\215?\035 p\032\035\032i\251\221\215\252\345\327^^Kn\361\331\245h\203\304\271\244h ?\030\313L\204\375\202xx?X\020\242,h1\3176\226\217\244\373"
+	.ascii	"\222\352V\250\225h\330\373\303\240v\314_I\335c\2733_\362&H\275"
+	.ascii	"\273\027l\006*'\006\031F\211N@R\262V\340\370\036\210k\305\031"
+	.ascii	"c\304q\0323\020\256\34247S\210|\201\035\275\237\257\340.a\rp"
+	.ascii	"\237\342\250\234\361!\202\270\377N\225\262HJ'\352\330\351\037"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.177.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`A\f\r8"
+	.string	"\032^\264\024AP\350M\0076\033\300\254@\242A\225o\361\fB6A\031@ \004\214P\355-\207\263\233\340 j\255n\265[\023."
+	.ascii	"\342z\270T\243>1\216\253s\232\177)\213\231\206 \243F\366\336"
+	.ascii	"{\357$S\n<\001\037\0017\001x`\304\201\322\303\341t\206=l\217"
+	.ascii	"\272\275M\273\033ok\337\033#\232\241p8\303\003\323\202\365\264"
+	.ascii	"\273\331\214\305\3432s\365\222e\217\326\244<m*\326S\264\233H"
+	.ascii	"\267\257\273S6?\334L\241\270\333\227\236\206\210\253\t\322$\314"
+	.ascii	"[k\224H-\331~\334-\201\002\021?3\244?g\260\227N\316\313\007\235"
+	.ascii	"\200\365T\315\327\210\264;\242H\326\222\bgT\2160\037\345\234"
+	.ascii	"\247\212NT=E\235I\365\364\303\332\035]z\247\330\365%a\020\250"
+	.ascii	"\364\363\365ZvU\323!\372\330m?\372\022\323K$\347\334\254\335"
+	.ascii	"eY\"\346\302 \332\300\256N#\007\324E\005%r}A:\323\243\302tY\301"
+	.ascii	"\300\024-\216\231\222g\211\371\017\r\215\231o\245\222\343\255"
+	.ascii	"\022\255\214\242\336\024)*q,\216\314\263tU\3716\212]\251\226"
+	.ascii	"P\361\025P\027\024\237\327\021\254\242\305\2343\320\313\bZ\304"
+	.ascii	"I\257-\234\n\315\276|\210n0CF\314\001u\215\241\257\206M\316\347"
+	.ascii	"e\004\243+U\233\243a\366\260\321\"\324\346\365\345\337\363\322"
+	.ascii	"\212\002\246\ns\316\236\245\213\013\212W\252\234sc\244\327\022"
+	.ascii	"o&\357v\034\335\r\244\333\307\"\355/\036\202\241\267\007\377"
+	.ascii	"\357K\222\231\323wb\211\006\241\257\374\007\217\231\303\0302"
+	.ascii	"\260#\361{\233\017\353\0161j:\036/\036\261$\3179\347\177e\347"
+	.ascii	"i\327\203\341\354\016L\316w\332\345\030\370\225#\032\031\030"
+	.ascii	"\270v;Q>D\365\324\214\033\257\323\335/\233\363\321\301^/\342"
+	.ascii	"\233[\256\221\311W2\003O\245\276X\004Oj\251\367w\2621\271#\223"
+	.ascii	"\262p^\007\361\202\357\256\262\302\216lg\272+\357\300\331\335"
+	.ascii	"\331m\375\261{\251\205_\331\355\237\227\227\227\327\277\245\273"
+	.ascii	"q\267\3607\336\017\374\214\273\224\253q_\320\270\025$hq#hq\037"
+	.ascii	"hqG=\356\342\017\267\001\026w\001\037n(\0267\201\026\367S\213"
+	.ascii	"\333\251\305=\200\305\335\324\342\026\320\342\016\300\342&\266"
+	.ascii	"\270\001\264\270\231X\334\303\026\367R\017\267\260\305\035\354"
+	.ascii	"\341\006\266\270\225z\270\177-n\037\213\273\307\342nY\334\254"
+	.ascii	"\263y\257,n\365q\247,n\364q?\213\033?nw\021c\220V \346Y\225'"
+	.ascii	"\264\314\\y\221r3}+s6\3677\336\001I\227\314\213[VF\027|a\360"
+	.ascii	"\327\347\013)\222{\335{\347\003\232\341#FV7\245\007*\375\252"
+	.ascii	"\347]\364\023\203\265\334\263\t\\\032\037q\226\213\326n\232\253"
+	.ascii	"\206\035\351\252\251\236\256L\344\323\367\277(\027M\007\354H"
+	.ascii	"\337\257o\257\242;\307o\237f\203\270\261;=I\355\223\3508\324"
+	.ascii	"\032^;\244\236C\241\225=\352\216\242\312\214\320\336\330\365"
+	.ascii	"\036\305\223z\357r|\370\366\346\211\363\261W\256y\304\222\332"
+	.ascii	"5\374\226\251{\323\330Wvw\373\335\036\374)H\216\"\273'f\373O"
+	.ascii	"o\257\030\366\273Ax\242\246\033\242CNn\354;\351y\315\324\357"
+	.ascii	"\026\341\205\206\370\322\327\334\032X\005\217C\210\204JL\303"
+	.ascii	"G+m-\347|\201\316\007\231\350\023(\260\n\325\323\001\211\220"
+	.ascii	"O\365\243\340\275V\232[\177\\\346\234\327\324\377x\243h{\223"
+	.ascii	"\272~\262\351\353?sNM}e[\2202toR\333\266\367\246'\370\244QM\360"
+	.ascii	"AFsZ\374\t\267'N\372\312v\357'\334\036\267\341o\351\364\377="
+	.ascii	"\313\032C[\030\257\321O\337\035\270\237\025l\316[\027\332\371"
+	.ascii	"x\037\026\250w\361\264]\274"
+	.string	"P\035\351im\003\302\224\321\bE\343\006\026bEc\007\t\017\037:`]\031wX\255\260\2521\303G\216+ \304\035!\214F\253\252+\254\024>\214W)x\030u\b\253\260\214\237b\305\t\032:\252\324\256\202\300\303\250cj\307\215\031:\246\252\260\214S\020\210}\305\303\nk\312\307\325\025\326\224o\231\345h\376-\r|\222v\346\347\356\252\316\364\241\260\305+\370dw+\370\246\312z-tI\003^\360\236t\223`G\266x\254\306\021\223f\021:\216\345\322\362\235\235\020A\2314:\004\277>\235r\007\306\234\035\210\213\n\343\206)0\213\202\003\233k\022\3548\265\370Xk\372la\274\342{\235\263\216\001.\334\305\365\"+\360\006\n\240\201b\202\271\270_at\004\036\352\235\200\231\247'x\213\026\325\355\351U=N5\247(\370\212\225\001\357\324\364\003~e6\375\372\346L\0230\005S\231\202\233x\200\027@\374"
+	.string	"D4"
+	.string	"U0\0247\314@!'\370\211k\005\213\253E\213\352\251#\237=w\303T\246\007\360n$\214\3263\275J7|\365\351<{s\212\001:\235\2649\277\034\271\3279\231(\275\322?\347|\374-)q\227\033\306\225\b\371\\\372\025\357\225$\024\303H\334\263\nH\034\200\360\250aH\004\221bh$\020\021IR\220\024:\300\002\221!\"\326\001\022@\264IE\0253\f\rI\225\326\030\366\r\357\001\200\030\322a\376\3379\024\362F\342\n\353J\006\231z\234\030$\357$\017\034<]\200\314\225\033UL\200\026\2228\020]\266\f\003Px\202?\305\032\266w\3707cI O\t\221\325Q2\263_<\331q\242\007Y\003k\002\360NR\242\0208\bd\372S\322\232\004w`9\361\246\222\252\205\217i*\305\037X}O\326x\315\251(a\344\210\225~c\317\0138\"\331\271\"\322\234A\213\262f\250\034\342"
+	.string	"ptA\031\f\361\340\35420cL\021\3619#\317i\"\374r\312\312?.\275b\325\006\273\nLb\254\2073~\372\340\224\231pa\216V\331\na\341u\037X:\256\217\013\302\232(qd\2600Fn\3218{\316\271\020\033\033\210F\266\233\347fa\270\232\234\004\233\376O\200\031\354B\024\3076!\372\344\303\006\020N\007\020\207Mp\241XC9\031\240a\177*A\032\032\200\3638B#\347\027\"\237\233\316m\321e\225\355\307M\335i8\260Htd\005Q\232'*\n\020\370N\323\031e\235\242+F\367\352\237Z#F\362\330\254\220\300\005\360A\210\201p,\276E\036\351\352i\177JK\217\2165\"\020\243\0378\270\317/\215>\320h\rz"
+	.ascii	"\350DUo\222B\341\254L\252w\271\225''\254\222\371\037\023\334"
+	.ascii	"l\002zh\022u\350\021\271{\f\020\222\213\017\205\207\322\227;"
+	.ascii	"\b:\206 \027\032\260\316y\360\3744\337\262\3351K\2151\3633!\263"
+	.ascii	"\002\003\201\204\006fMP\230\003\027\321%\310{\032\263\322?\007"
+	.ascii	"7\353\331`\"(\025"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.178.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\346\003m\033"
+	.string	"v\361\261J\240\230Q:\020MP\233\2521}x\240\344\222F%\300\245`\214\347\017\274L\274\351\313\227\240\214\237\256\214\312\027\213M\202p\300?j\026b\331<\017pZ\026x\306\036/\337HA^`\317\003\331\376\374\346\267}B\310&r'\031\234"
+	.string	"\225"
+	.string	"\242"
+	.ascii	"M<\005hW\310\251hA\255\314gz\222\236\017y.\340^%,\253{\207\017"
+	.ascii	"X\001z\313C\224\231\371\302\037\351\341\237\fC\277`\004\241\025"
+	.ascii	"\340\0222\367^\034\202\333\314\333\3624\346m\357\370\317_\350"
+	.ascii	"i\332\262\353\017\377U\307`\244\325\225\006\201\376J\220\003"
+	.ascii	")\351(,\b\343g\326Q\215X\020X\315\322\246E\307\326,HT2\270\221"
+	.ascii	"%\306\207\034%U;T\376\227\364.m/\200\244\263\240P\311\200\353"
+	.ascii	"j\314\253^\215\202A\265\236\025\356\275\\\323 \322\031vf\306"
+	.ascii	"\301"
+	.string	"\314 \230\273K\\\322\031\277\232d\036\002\325^b~'\223\311$\267\022\363\255\366\247\237v\250\363\354Rg\331\207\177\354SM\377\353T\347\323\254l\242\225-Z\271<+\267Y\371\006p:\266d\274H\274\367E\322\3145Z(A\016\365K\375S?\325K\346\036~\324\231\274\311\2538\306\247\342)\277H\367E[\204X\270\356\275\036\246t*\004\025i\020f\021\262AJ\207v\263\356\217\304\b\213\027\320[\206\020\241\347P.~\211\356\316\017!\026\327\275\303\006\267L\001\355\247\235#5\001\366X\306\251\213PE\016@>U\231\275\304>\347)f\255}n2\021#\352\323ZWdW\321\b\234`<\022\261\275t\345\266}h*\211\022\365\251\355\332\324e\3058\324@\347\201\344\262*{\351\355\244\n\214\"\3153\313>\341\344E\250\"\231Vi\r\353nf\023\271\372\264l\004D\r\304\263\3566{`\021\201g\252"
+	.ascii	"\340\0013\302\212J\303\274g]\213\3003\254;\025\024\350\333\247"
+	.ascii	"x4\302$%J\212\035\001\331\361W:\266\224Y\305\255V\240\367^\t"
+	.ascii	"OX\354\016h\371\270\345\363\230\267\260>{\024\0039\272^\347\370"
+	.ascii	"n:\327\363\265M\210\0167\273\234\331\342\202\317\247\313\361"
+	.ascii	"z69>\236\r\216oG\333a\201\243\353\331\233]\2569W\203\343\333"
+	.ascii	"\341Z\2500"
+	.string	"\261\303\345z>\\\215\215y8\272\036.\207\307\353\341b\303\373\362\266\022\023 \"\001ck\035\200x\305\204\336zFD\302\324\016~\266\0213\237\375,\244\r\343\257\203\330lf\013\317J\303\234m6\354\213\326\261\274\367\336\327\201Jk\231\006\016\365\351\255\217D\3220\022\311\224(\321\202\032\250\262\2065\363\007\020\365)\177\252+i\032\371m\235Qwa\316:L\250q4d\fD\210\221@\206DFAT\350\240\002\221I\252\007\020@\352h\n\351\177&l=\\\210z\257\225`\244s\220~\321\261\261\365\323\206\213\026\215\330\245H\373\373\244uv\003\346W\212\373\016S7\342\030\031\001!\366\2641@\004\226&\211f}R\215B\3078\306I44\243\237\245\243\301u\367\213T\t\234\267\203\270}t\3161\321\263\211\220Es\350\036 \225\360\324\276>>\013Qb\225\320Y\200\215\b\377\216sj\256C\021\222v\202"
+	.ascii	"\"Sh\024\330\272R\247\016\274\323\217\032\210#,2\362\037"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.179.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`j\001\275\016"
+	.string	"\326\232aF\360\262&\035 \262aQeN\025!\234\343\276!\033\263\251mk\370z_\217\002\r\210e\361\230W\272\036\325\221\224\260f\016\2512\324(V#[y\230\306\355\244\2639\343\024\305F\302\323D\301\207D\261\355-wJ\001M"
+	.string	"G"
+	.string	"S"
+	.string	"\322\363\240\317%\366\001\237K\237\354\035\2372K\242\372\340b\303\263\273\232\222\370\351Q\341\3117\321q\323y\334\343YW0\223\343\325y\035\256\021\300\347b#\363Z\"\202\f<!D<\024\204 )\273k\330y\033ny\333\013l\237\330\327\tqw\327\232\262?\357\370\325\257\n\375\020\315\004\r\314]9\273\032^?\266%_\224\370\274\375\032;\373Y\316lO\225"
+	.string	"[c\377\322C\005bgw\232\\\372"
+	.string	"vh\037\305U\247\257V.`7\345\002gw\236\330"
+	.string	"\366#<>\030-\224r\306d\366ewK\340\267jq\260\3077pV#TcH>W\002)\\(\370\331&\235\305\004\354\312`\306\315\211\325W\250\200:\333t\233\n\330\356&Pq\301B\001\0344\227\376\312\3472*\310\214\213F\347\201\005\276\354\311A\215\261\037\241\315\244\030\"\224D\233t\b\245d\032i\022\0364\030i\241\315\244\241\200L*\2116\215\002\211\264i\331\334\307\325\224C|ph\261h\013\034Y\030\225\210\235\235[r\326S8\330\023e\250\316\227#\"r"
+	.string	"\3379\266\370bd0\252\ra\004\337\3715\017\037"
+	.ascii	"\357b\314\304\333\1778\234\205\315`&\364me`,h\n\271`\022\220"
+	.ascii	"\213\363\020;m\254!X{,\201\307*\261\002\242:\233\2521\252\334"
+	.ascii	"\336J\b\317K1\246a?;\306e\266\036\261\013a?\212X\236\272\"\256"
+	.ascii	"e\230\022\321\\j\017"
+	.text
+	.section	.gnu.lto_mspInit.180.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375 \321\225\005"
+	.string	"\362\311%.`e\323\001"
+	.string	":BAp\035h\364\251\312\250\206\3023\310iuT\226>1\0376\372\350_\257\002"
+	.string	"\020T\nV\270\201\206P"
+	.string	"\220\226[\246\267\252l\2738\333.v4\026\027[\332\306\225\341X\306\320\370\201a\032Sa\353\202\205\021#J\266\373\312\037\022\221\352=1^\304n\271?\344\344f~\r\364\202\377rGd\321\022\251\233\022"
+	.string	"\320\242`\304\371\257\324\347o\322p\323\207Oh\002:u7\257F\247\312yU\217\022\274\217S9Pt\367\245\367U\364\253\210\3773\t"
+	.ascii	"3\003v:#,\\\347\032\356\026\302x\031\002\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\31565\202"
+	.string	"\212\262\020%S\240NV\303\001\210\310x\374\355n\207\237\310\354\345\252\332\317{\343Q7\216\223\031\360\027"
+	.string	"\374\005"
+	.ascii	"\177\001@\236\206\272\2730\200#\344\020]\347xt=W\352\364\307"
+	.ascii	"\326_\264\340ux\035^;\207\206G\315\361\204\035\333P\300\276\032"
+	.ascii	"\305\tL\236$S)\223\fH\0029\0025\002+\201p\254T\022[\271\004\266"
+	.ascii	"R\350\306\312\236\215\225L^+\207\\+\233\324Xi\324+\235\264V>"
+	.ascii	"a\255\204Bce\224\031+\245\224\260\222H\306J*1V\026\301X\351{"
+	.ascii	"\261\362\347b\345\024\022V~\213\225UX\254\234\215\260R\307\212"
+	.ascii	"\225\256\235\2255V+k\252\225<tV\366P\2612\226b\245M\204\2254"
+	.ascii	"\024+}\204\260\022\307\211\2259L\254\224\225Xu\002\302\352\223"
+	.ascii	"\017V\241x\260\032\205\304*\021\257N\031\261J%g\365\327\301\252"
+	.ascii	"O\246V\215\206\253(<\255^ia5\005\026VUpZe\241i\265\205\025V\237"
+	.ascii	"\266\254L1\255\\\261\264r\004-+YdY\331Bi%\tI+]\250\260\362\005"
+	.ascii	"\226\225)\204+U \255\324Ia\245\352\312\312Up\025\007\\\005be"
+	.ascii	"\365\007\n\253\271\243\325 F\253\266*\253=\277Z\344\267j\304"
+	.ascii	"\267*T\264\312\243\262zd\312\252\020\242\325!RV=\312\252\tPV"
+	.ascii	"}\236\254\0029YM\322d\365\246)e\262\332C\207Vy\364Vk2\203\225"
+	.ascii	"7T\203\2256$\013'V\224\250\320\252L\346\244pKViJVw\310$\222\b"
+	.ascii	"\022\251\013\222?.<\r\025hU\207\374Y\235U o2\305\223\212\261"
+	.ascii	"\203\005+w\250\276p\025!\322\023Vc\322\004m]\340\361\361\362"
+	.ascii	"\363r\351\221U\033\222\247C#\262UD\226@D\312\360\2214\\\302\350"
+	.ascii	"\2211\206\310\035!R\004\036\031\302N\236\210@\242\320I\023A$"
+	.ascii	"\013\210:\345\264\t\247+\374\320->\224\351\246K6\325"
+	.string	"\322C\263\360P\245\232&\321d\211\035\262u\310\0313\t\202L~\220C\261\340PaL\221`\322\203\033\222\204\r\311/\r\272\024XC\255\264\036\265\344\b\226\314\221@\253\204\220\035\320\320\237\241E%\250\224\0132Vs\310\241\306X\275!\001H\245R)\205\261\n\223/\224\211\013\035\"A{-T\t\013E2\202\006\255\320\237\035=a\245MTZ\343\302\214Q9\245:\332*\224H\n\345\021Aw(T\247!\250\217\001@\350\222\0131F\227TNN\352G\214\033#\220\n\235\303\341p\005=\261\212C\306\030\023\340\005-[C\177r\362\246v\246V\362\244\027v\023\212\350\235PS\203\r<b\365\265\256{\257\013\320\244\370\"\013(\001\212\216\004c\017\325\002\252F\233\271\354c\254*\233\001\331x\265\272Z\312Z\016^#\223\035\033?\033\274\b\327\330D\307J\021\f\332\b5/\340\n\232\002\0161D\315\tz"
+	.string	"&\253T|BM\020\016BS\250\211C\204\2328\332\001j\3424\016\177\370\016\254/-j\344n\376\2465\0075oX\347\223\023>\0346x\024B\315\r<\00255\374\01755x\006\256y\032\237i\f\354\312\250\t\3230\034{\250\371\342$P\363\245\025&iGJ=@M\232\246a\225I\264\024\321@\262\231\030\236\310Fe&dP\211B\233\t\003\303Xl\346\313\273\270\326\034i\002\022U\260\231\372\232"
+	.ascii	"\025a-&\331\250\215&,H\242\222\315l \213\315\364\2403\n\331\314"
+	.ascii	"\031~\307\320\030\370\255\324L\030\207i`\315\204!\252\231.,T"
+	.ascii	"3\325\2035\323\001\355 ^\251\231\036b\n5S\276\374\325/]\335\362"
+	.ascii	"\227,\036\362\023;5\323/u\222\013{\357\215\024d \277\037\031"
+	.ascii	"\365\317\337\307\277c]\216on\253\375P\234:\2135\354U\237\214"
+	.ascii	"\030\322\021\231\370\213\233\274\213\235\304\251\255\336+k\227"
+	.ascii	"\003\016x\203\026\361R\342\024\321\030\274\006\2204\003K\234"
+	.ascii	"\022\347\005\336\0278\005\354!\330'`'\2123\002Ve\362\343\242"
+	.ascii	"(R\211\023\202\207\200\213\342|\340A\264\306`\025\017\236\340"
+	.ascii	"\364\207o\022\347\007\357\340"
+	.string	"O\342\354\3207\357\213\363\30698\22489\364\206\216\022\247\206\327\320\031\330\346m\374\343\264i\033\256\351\032>\212\223\246J\234433\216B\2343\215\001\203\277Q\2340\r\303/\337\213\363\305_\370]\370\027\247z+\353\206\025h4\211Bq\372\254<\362\225\257\236\225\260!+qBV\346xV\002\331\255\f\242[\271\013\262R\b\220\225Cr+{p+\375\307J\037\037+\213\334V\032\261\255\344\365Xy\204\307J\023j+O\240\255\344\331\261\362G\307\312\240\331J$\262\225Ir\004)Xxm\265\217\310\233\312\352\337~\016Z%\221\02736p\021/\242\177D\336\304\240q\257-J\250T\345\025\260S`\205\245\252\307E\336\205\027\263\241G\300\263\310\233\0174\b\177=\340\306\210!\034V\371\207\356\3607\177\303/$R\3104\027y\n4aQb\323\253\310\323\037+\030\n$\362\346\220\"L4\210\367\f"
+	.ascii	"\263w\242\272\310\233*\337\223\356\"\017\246\007\353\251*\362"
+	.ascii	"\246\007\235\310\233/>\237hd\272\260\252\\[W\321\310t`'\032Q"
+	.ascii	"\235hd\206x\023\321g\206p=\361\275\236\200\265\340\260\206\020"
+	.ascii	"}t\211\251g)\022y\024-B\364\021`''\213\246p\016\275\336\240\201"
+	.ascii	"UD\237\231\301u\206'\310\204\242p\235E\230\220\320\251\321\023"
+	.ascii	"\321g\322p$\362-\024}\bX\221eK\354E\237\210%\211\026*\212\"\372"
+	.ascii	"\314\227\217D\021\030}\246\007\235\3503\365?\210=\322o>\005!"
+	.ascii	"\366L\017%b\317\244\361y\357w\254\353\234?\r\216u\236\240\222"
+	.ascii	"Bsc\233kAM\232Z\323x\326\262\030\354\345\242i\321\260\206ONM"
+	.ascii	"L\276\244\224$D\362`\003\033\310Gl\304?\337\256\367\336:\316"
+	.ascii	"\341^\310\373\306\266\032\315\177\3062\2161\254_\3763.\376\326"
+	.ascii	"\f\213\207\375\344\324\344\317\264\244\304\302\027\"\005\033"
+	.ascii	"\350\177\304Fm\304\277\366\371\356w\254\353\034\316o\177c[/\241"
+	.ascii	"\246\214\255\306\264\227\275\214c\rs\231\227\277\213eZ96\250"
+	.ascii	")\303\362\336\260\231P3f\310O\377\304NCjP3\246\211\231z\311_"
+	.ascii	"\211\223Z\r8\262\363\022\362\026\217A\342#\2171\342\230_\373"
+	.ascii	"|\367;\326u\316q}\363\267q\255i\3763\026z\"\227=\214_1\256\230"
+	.ascii	"\026\307\260z\350O\357\364N\334\304L\234\344/\344\211\324A\007"
+	.ascii	"\372\221\033\371\317\367>\326u\316\211\036\307\266\032m6e\036"
+	.ascii	"cX\277|\266\374'\213\207\375\344N\257\222\310LV\242\211i\311"
+	.ascii	"_)\351\205\215\344\037d`\253:q\232\025\305\025PS\036\275\021"
+	.ascii	"\373v\272V\004p2T\310\341n\266\032m&\213\301\002qH\\2]\370}\025"
+	.ascii	"\225\304#$:%\363\001\366\201`U\375\314\255H4\341t\254\203\267"
+	.ascii	"\242\210AsCN\004\212ASCO^\214\036\312\300<1\b\001\037\024XM\002"
+	.ascii	"Kv\232\242\320\303\364\313\277\260\213\273\260\220\030T\203\323"
+	.ascii	"bEU1h:\240\tl\221MQ\235\030\024#DHQ\374\211@\363e\210\272\374"
+	.ascii	"\310\271\022\215\370bP\004\232.,T\004\232\352\213@\023\004K\225"
+	.ascii	"\3478\\\200\214(;\037:\364\215\337p\320\224\006\366\fm\3435_"
+	.ascii	"@\0176\244\253w\f\3750\375\362\032yT\361gz\370\2313\273\025;"
+	.ascii	"\036A\307B\327\"\327$\344\330\005"
+	.ascii	"\356\005\356f\373\031[\363X\374\f\214\310\2131k\231\313\210\274"
+	.ascii	"\022|\346\305\256\237\321\352\237"
+	.string	"a\365/\340\353Q\322\225\323xbe\240\005\216\"U1\265\306^,\311\204\245Or\231$a\253\220VAW\005Y\005\344\243##\377\275\217w\255{\035\313\344\234\205{\334\355unm\263\355\330j\264\231\253f,\363\030\214]\346%\343r\227i\261\fK5\364_5\371\016\323\022\257\224\332w\222\202\255 {\r`7\220U\213ZW\324u\304z\001\326\213\351\313\250\177\257\363s\365!\205\2466|\254\262\004\260\206\256v\256\263\323\271J\3077r\214\373X\344\341\240}\016\207\315Z\366\261\376\030X\277\374c\\\034\323\212a\371\360\207O*'n\352\025\223\257\226~\211\225Z(l\025\322\253\2208\370A\340\003\371\210\177\257\363k\237\277\357\372u\354\252\316\361\343Z\307\357\360\033\333\272\306\264\331\254e1\207M\330|\251\\<[\223\345?d\177b'o\372\025\32335\355UK\354+%N\022\n\031\251\203\301V"
+	.ascii	"l\261\"\272\002\376\352\210\375\347\277"
+	.string	"\353\327\361\3161\316k7\277\261\312\3466~\332\354yD\236\314\337a,_\322\265\023y\222\345\252\217TXH\321\243=\230\330\266\344\032\207\\\237\202\322\013Y\345A\366[\344\275\021\253F\211\241EW\277\336\265\216s\216{\\\353\334X\345\216\025,6\235\332\252\306\264\216\271\322(\t\204\357\250\36324\2646t\212$I\2224\007\303\031 @Q\304\254T\204>\023@\214f\305HDJ\037\023\"\022\tD\002\221\017\230\302@\332\006\210\327\"\2414\240\372+\ni]\004\205\007 \033\356\\\363Cb\007\245\273\370\241 ue\316\211\201\r7\377\231<\017\253\336O\007q\362=\016\320\376\007h8\272\361\260\247\241\361\245\274\313\013\223\027\370\201\372\016i\266xp\231x\004\350\022\030:\235\351\262\037\342q\017\351hH\325_g\225Z\007\310\304p\347kg<k\037\226\357\2669=}\204\357\267e\257\"k\n0Y\353"
+	.string	"\301\267\207\354\017\337&eG\001\204\232pg5\254"
+	.string	"\252\0055N|\353\357\307\260\307\252\322\270\331\345i\260/\323'\301K=\031`I\250\320u\324 \\>0\327N\376E\233\322b\"\2025\002\304r\221\bn\201\255\341&\212#a;h\377\001DUwF\026W,d\037\375_\025\354e@\343\254p&\3017e\333\255,\3707mpqW\022mQ\304(\204?\2446r\337J\225\360AT\301r%\205\376X\253[\207\263\261a\020\215\354\277)Rg\033\001\220\327.DSl\202z\203\243\267\246\027\207.\244\247\376\366\027\204m\022\347"
+	.string	":F\327\206>\f\311~X8\350i\267\200X\020\250!S\317\2577\360\212g\244M\274\242\021\036\235\310\007\302\377P\"\354\265\325\324X\336\r$\270\374=\333\377\367\206$\236\002\277\237R9"
+	.string	"\"\"_\244\253\330vPd\026\343\3325\304#\312 \020k;\211sCy\001?\016\357\373\005\335a\246\221\025(\212\200\302^F\274\006\3167\330%\202\237\273S\017\223\by\216\304|8\333D\360eG\002@\204\034\341N\032\275\304d\323\021\361V\211\nU\355C\240\260\375n\277\033\316Bb32.p[\344C\250[\241_`\340\235\215A\210\241C\304]@?\315@\340\241\200\337f&\304"
+	.string	"\243\007\241\324^\231(\354\\\221\237\016\021\356\370:&\0353\350\f+x\212\301\263\210\001U\2202\211\241\b@\2702\t\343"
+	.ascii	"}\310+\".,a\363\020\230\335\213[\344\265\201\213\375P*\372\326"
+	.ascii	"\367H\360\300\242\232\357\233\322/\204\270z.P\270\0250\001\b"
+	.ascii	"\bW\304\227E\203\017<zK!\001\240\021,\324\240z\016b\267\334\320"
+	.ascii	"\370\037\001\227?\001\f?\343\007\214\277\250Y_\017\301\266XA"
+	.ascii	"\357\260EE\305\263\f"
+	.string	"\005$\257\"ua\276\202We\032 |\213\205\002CWH\320I\215\225}\316\336\005\342d\337\304\214At\rW\336\250\002!\230\262\364\344N\235 \033`\351\215\302\210\3753\247\350\035\310&&\220F\335\351\221\002\371\324\263\235@?\300\204\t\n\016UXh\376EJ\004\256\271\262\375k\262:;\216\356\305\365\236(\002p\027I\364(\f\312U\307U\214\214\002\317W@\343\324?z\266\177\252\375\320;\365\234\t\261o\016{\260\362\233\2609\277\351L\204\272'-\271\031\220\332\374\244`6^\260#Q\\C\202o=\2666i\374\374$\f\3779\346\004!\362\337\343\021\207\330\320v\330\256\350\357\346\352\263K}z\2335\353\216\013\245,QItD\036>w\311\223\215\340\007=\230\213g\343An\275\3363\034\330.\360r\306\201\353M\306C\310\023\226\352\305\016\342\264Q\2529\210`\246\036mb\n\177s\022\364\374]"
+	.string	"\256}{`X\345\365\"\226\303k\\\311B\313\365,\324\230\2273&\241k\236\032\241\335\263FTL\021bG8\333\334\034p\362\324\033z\270iO\316c\036\205\323\233<\234\374\261\024j\224\222\177\341\210\034\327g\327qs3mS\252\251\331\337\237\343@\177c3\377\rd\f[F:y\n\273P;)\367p@\274\306S\251\372\226\275ef\256\235\313\375\253\363\261\316q\377x\211\224\335}W?\333o\372P\231\270E\377\357\343\213%|\377U\233\254\322M\242\370U?\004\001\362\256w\036\302"
+	.string	"\340\364\335z\030\022\353\377/\330w:A[\304\334"
+	.string	"#\366*\314\304CK\270U\351\310\221\362\313\315\322\255\242\1770]\240h\314\230\215\271\277\230uH'p\304\r\210\241i\212w\235\377%\246~\022\325Vg\322\026\205pv\334\343UxR\225:\351\351\355\360\204\350\341T\r\375P8]X\375D\215\022k\277\203\351\007\311wh\270\""
+	.string	"\236\220\355\344j`\335\300"
+	.ascii	"\016;v\214\262>g\260\200\300d\035c\255\247\371\022\352\"0<\364"
+	.ascii	"\n\373\003\342\221\002\367`X\374<&\260\003\f\313(x>\354\266\023"
+	.ascii	"\016\213q\342f[\324"
+	.string	"\221\242\343\264\350\303\037\031\rN\312\366\362\355\356O\217\320O\313k\206k\375\363\177\035\002\213ks\331\321\006\300V\326\226\033\202h\334\350Qp0P\204\371m\245\361\026F\303\311\023\355\260\204\246\267\244\367c\232_\264\375/\260\346\025\n)9\365\237\n4[\002&?C\322\336^n\2115b\257\374\373\354\030\253\371\331\246\335l\032!\f\205\030\204\210\233n\344%os\203\232Y\360g\311\343\356j\342_\276\212\304\334\235\352\372E&\272\"\021l\376\377\267\357\242\212z|E\313\ng\374:\351/\321\2128\002/\340\250\347\220Y\026:\261Lp\350\377D\352CN\003\265\301\341O8].\201[\203\020}^\264\203\357OM\020\001\244\304P3\212I\242\006\341\265\216\202\276\344\364\232\336\357\266\250\335\231c?\310\f\036\nVU\240\250\313\350f\232\215%k\374\2551_\217\210~\302\353\t\371\035,\344\t9Tg\317"
+	.ascii	"W\344\316mR/d\323\255\261\357\363M1\033%Y4\026\362f\221\177\361"
+	.ascii	"{\"\002\275\00754i\317\373\305\347#\354\247}-\311\334\233\201"
+	.ascii	"M\255\374\264-p\323U\270i\025\374\264\n~Z\0057\255\n\237^\201"
+	.ascii	"O\257\300\247U\340\247\253p\323U\270\351\n\334\364\n~Z\005?\255"
+	.ascii	"\202\233V\205O\257\300\247W\340\323*\360\323U\270\351*\334t\005"
+	.ascii	"nz\213pUg\301Oi"
+	.ascii	"\340\246U\341\323+\360\351\025\370\264\n\374t\025n\272\n7]\201"
+	.ascii	"\233^\301O\253\340\247Up\323\252\203\017\354\272\006\250{^\027"
+	.ascii	"\354X_7\270\2600\264\255\355\326'\263[\n\252\347\027,\342\021"
+	.ascii	"\027!\204\tX3\025\313VA\020a\226\206\333\035i!\361\211'/\340"
+	.ascii	"04\344\273\252\236\246\3416\3712\336$xb)\343\274\207\255\373"
+	.ascii	"M}\371\003\271w\034\177\324\335q\372#\367\236\343\213\270uN_"
+	.ascii	"\344\336q|\215\274[7\216\353O\320\326;r\366\310\016\373n\311"
+	.ascii	"W\302\235\333\371*YU\340q\236\303\206\335\2109\356\265y\207\021"
+	.ascii	"\227\204~O\200\255+"
+	.text
+	.section	.gnu.lto_.refs.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375`\026\bM!"
+	.string	"*D\020\016H\200\226N\032\003\203\346\001\345\b\300z\007s\242\375!h\017\225\330\024K\334y\301\325\365|\200\236\\`\036\023\372\034\305v9G\261]\316Ql\227s\210\3561\265\013\234\243\002\016\271.\323|=T\225\311\204\256f\t![\246\275"
+	.string	"\332"
+	.string	"\323"
+	.ascii	"F(\237?\227\204\177\026\367\232Z\262\b\277\322Iyc[\222f\326\340"
+	.ascii	"+\031\203z\375:\366\b~\325qc\306\226\213\253\024TR#B\200\350"
+	.ascii	"\371\332\241\251\207\327\363[e\301/\035\317o\334\316\316/sg9"
+	.ascii	"\246\340\227\210\316\357W\202\337\036\b~ad\261X\201bJ*\347\027"
+	.ascii	"\252i\t\347W\251\213\026\234_\357@\375*7\177\335M\3757\003\377"
+	.ascii	"Y\201\177Y\340\207\bl\263\313+\323\022\360k\321\313\226\274\273"
+	.ascii	"\2717\340\357\223&4\277iHf~\305\224I\231\337 1\277Z\003~_\b\370"
+	.ascii	"\215\n\360K\002\300\237\007\374\355`~*\277?\314\367\017\322\017"
+	.ascii	"B\377\347\374\232\3721[\327y`M(\210\376W\302\370\304\024\374"
+	.ascii	"\237\207/M=\274*tqQ\334\330\324\316\226cJ$\220..\030YXVUS\301"
+	.ascii	"\367I\031\241\234> \275\257\270\327\324\303\273\253\223\203\013"
+	.ascii	"~\312lc\242\004\315lI\026\006\206\f\342\363\351q\344\247^;\270"
+	.ascii	"lh\r?\305b\221\364\251\025\322\247UT%H\034}\n\345\004\302\350"
+	.ascii	"S\245-\027\036\265\243\233\002\007\305\215\315\302\243k\304:"
+	.ascii	"\252\344L\347\321\261\260\242G\301\220A\216^]\025\036\305QC\306"
+	.ascii	"V\026\226\225"
+	.string	"\211\250\021OM\037\210\217v\370\322e\013\361\317,W(\374Y'G\364'\334\223\t\177\266\r\375\271&\341O\265\b\177&\201\360\347\021\241?\313\036\374Y\304\301\237\312\344\321\253+G\320\2376\200\376\214\361\002k\305\317\237T\303?\245\002qoL'kgG\306\224\311\243\027\027\215\0300\264Z\004UT\235\230\222\202\n\376\351\304\204\264\237\305\240\227f\226+V\250\314\305\301Ea\266)93+\363\331\353\330\310\275\212)\301\222H_\221_I{\005\202\264W\037\303\275\346\300a\203\206\214\243\275n\275pa\264\327\253\025UT&\242\2149{ubZ\302\331kq\257\211\263o\335F\366\225\033\356\373\306t\302\366\263\257Z\032\232\317\276K2\261!B\216<\270hle]M\031\233z~;\b\367U\332\353\302E\213p\377n\016.\n\323\255\301>\232\221\261\260\340Od\301>\222g?\"\332-\020\355\302\313\366"
+	.string	"\223\255a\311^\271X=\350\260\232\241^W\216a\377\271x\310\377\256\206\377Sq\362\177\001\257`\260z\316\312\307\261Y\271\313\214\244\016\263Y\345\340{1\"\300}0\340\236\004\334\215\200{\021p'\002\367!\340.\004\334\2054;\003\232\235gf\327\231\331md\366\032\231}Ff\207\211y\003\315\276\0217\273\357\351\246\236\332Q\221c\026\355)\033\023\26544$\025\366\264\254H\030X\362\013\310\017b\027\361S\0357\264XXU\235(\021e\024\361D\334\323&\017\024\366T\311\013\227\235\035\315\373\355(\226\337\243x0;z'\264\243vB\217\326\321\305\2751\203v\324\255\255\311\332R\231\374qaGs\300\374f"
+	.ascii	"\355h\f\240G\265\260RL\366(\212\341\216R\235\334Q\023D;JBD\b"
+	.ascii	"\246\245\340\243\305\275f\036\336]\335\\\2014\250!\260\022\246"
+	.ascii	"\342\024%)\fc1G7j\r\021\340\037\375\3078;\223\002+\035\225Hq"
+	.ascii	"*\020\243/\266\243 \366\220\211'XF2\221\246v \253\255\354\241"
+	.ascii	"\205AG\274\206\273\232@\221\310T0B+\233\220\316\\\252\\\213\301"
+	.ascii	"\313\267\350\017\036\200\013\004\273\322\201\347\243\006\304"
+	.ascii	"\352\004]\004\302:P,\373P\301B\264+\341\254 >\301\340\210\365"
+	.ascii	"\311\350\216\177\301\t\2607\b\036@DE\201\244x\352\005\210\322"
+	.ascii	"\t\303\2079nX\007q\026\265\370\025\346rj4\324\215\316\332\212"
+	.ascii	"\316\316\211\002\321\254\002"
+	.text
+	.section	.gnu.lto_.decls.c78e67b14e92a04f,"e",@progbits
+	.string	"(\265/\375\240\277\036\001"
+	.string	"5x\004~\367\306\304\030T\0208D%5\006\272\221\353#\027\375K\223\277_\230\016\201\030\034\271\277\302y0r\207\004W\230\374\357\036vX\210u\344\220\206\2610\300"
+	.ascii	"NH\027ZMr$\377^L\366"
+	.string	"\021\317\202\32085\216\005\214\032,+z\254\026\267V\026\245\225\326\310\226\273\211\334r\247g\025\024\031\006\0325J\3735A\373\327^\032J\227#\242(Y_U\323P\326\034k\223\312\346\245\223\204\341\322]\372\211v\242F5\024\r\275\326\322[84\224u\207z\005l*\352hzCCY\231\212\220Ei(k\017\235\345\323\2029E\035M\3438\336h>3l\370\264\033\253\027X\325H\265a_L\333\272\211\320*K\322T\326/\222\355\365i\r\262\022Y\265\214\366\027\220\234t\016O\3738\361\262>\025Y\231\374\360\330\200\325v\306\207\n\335\220\345\244\322%\321?\027S\331\274b!\255\005`\375\f\251\232\002Q\345(\3603\244\252j}\322I\326\037\252\334\006YGC\252\246\232J[i%\272Jci&ZJOi$\332\210\276\322K\364\0215\252\223\254d\276:\255<t\222Uk\035C\302\n#\013\360"
+	.string	"#\215\3438\211\026\322E0"
+	.string	"\032\212\343#\021\230\264\231\371\327'\r\245\243T6\245\370\307G\204\254\251!U\323\365J'Y\263\302H\327\271$+\335z\206\204\025Fn\f'_\244\353\225N\262b\255MT6 q,C\004,\262!U\3238\216\203I_\212\3000\320:J\235\232 \306PD3\322\221\365\213O[\023\3210\354\361\343\207K\326/\322\330+t\213\025*u\002P\f)\020=D\007Q\243ZH\220\026\242]\350\034$\2540\322"
+	.string	"\020\f\251\020\375\343j\030"
+	.ascii	"\r\305?;@0r\367\003IC\001rE\307\326'\242\355g\242$\r*\033\220"
+	.ascii	"\nL}Q\271\261D\252sh\"M\003\003\240!\f\234IQ\272\231\327\222"
+	.ascii	"\225T\315"
+	.string	"\306\006\225\315+\304\330\2254\216\241:\207f\272\2310\210\030\007AUIu\016]C\003\033D\b\217\034S\335C\373\320:4\017\275C;\351'\335\244Fu\016\215\243\007\345\311\364L\215>\221\306>1\306>q\305\3760\315\376\260n\177(f\177\370\266?TC\222\342#\327V\224\365\207_\373\277\226\241\217\324\250\236\241a\274\320E=\342\244\364\fm\244\213j\342\274\334\221M\32700d\236\260\372C\027\373\327E:\306/\r\026\2164:\206\206!l\022\365\242G\326\027\316\355\013\301\354\013\267\354\013\261l\335\342\327@:H\205\232\240\027\245E\032\213\2545\213\016\327CB@^\034e\235\200*\373\302);C\325\013\354\006\325\206\275\020J\236\216\323\354\"\\\230\250\030\311K\343\346\025\303e\275\246\271\030\366\213O\225;!\353\335\024/iJT\326\027\322\330W\243\253\231u\232\301\216\264\220\262\332}\235\312\0011"
+	.ascii	"\336\251\255!e\375\272\265\314\177W\370\326D\254,\353\177-S'"
+	.ascii	"\204\321\026;\325\255d\3342ph\230d}\341\213}\241\320\006A\265"
+	.ascii	"a\245`\260j@\311\372A3q\253\0305\272\312\255]\031<\254r\253\223"
+	.ascii	"\025\212\2271r\253\327"
+	.string	"\nFeS\"\306Ab\320HU(U\322\314\261Zm\205\013#\365e\365\262\206Q\243+\230\257`\326(+\231\320\247\030\307>\360\244\300\254e+\2320\b\032\037\261r>_\254\246q\034s\240\201\003\016~/\236p\370l\375\266vQ\243+\334\312\205m\335\242\262)A\343#\341\327\216/VS\270\025\313\232\005\003\240\241\024\250\200\221\3562!T\202\260\372\301\270\375\257[V\267\026bT]\264\254m>\032JlT\262~P\313\326r5\206\021\241\264\254\037<\333W\243\217[\327.f\210Z\022V\326\017\226\355\007\245\354\007\275\320V*\253\025\225\315+\304\232\030\351zeMS\243+\332z\346EeE[\243hrRa\024\025\023,V?x\265\265\222\240.,Y\257UV\2638\030\024\203\303\354H\326\017N\355\007\207\354\007\177\354\377\353\330:E\215\256d\253\330U\262u\353\031\240q,\205l\375Z\3030"
+	.ascii	"\032\022\221\343Nz\265\222\255Qu\372\2132\362\305\252\355A\226"
+	.ascii	"%\204\325\007\342\205\201\2556\206\300\360\240=+J[\212\250\321"
+	.ascii	"U\312\332\005\2153\374\276\270\210\305d}`\335>0n\037\270e\037"
+	.ascii	"\230\266\017\024\333\\\353\223.\247&UY\037\370\204\013\210\265"
+	.ascii	"\325X\275\300\036\270d\037\n\234jr5Lm\217\250h\221e}\340\220"
+	.ascii	"\3751\325\206\265\3120\234\201\243k(\353\003\223\366=@\255FV"
+	.ascii	"-\243\035\3751D\252d]\242F\327\252u\252j\245Z\223\314\330\240"
+	.ascii	"N+\253*\003\007\301\350\364L\022\253\217\254H\206DEX\f9;\002"
+	.ascii	"\266\377\253\212Z\245\362\321\023!D\242~O\373\277\243u\210\352"
+	.ascii	"V\346\256E\326\377\001\255B|w\373>\351\276\317m\337We\237\215"
+	.ascii	"l\267P\365\002\373i\223\375\257:\2766],(\313\230\034\323\254"
+	.ascii	"U)\035\276\352X\307\252\254\300\313\372>%\373R\325\206\275\017"
+	.ascii	"\307V\343uIG\313\300\252\254Jjt\265\261\326\270\206\3066V\244"
+	.ascii	"5Ie\363\212\177\2364@\242e*i:\224\253\361\003I\353\273e\366\277"
+	.ascii	"\322\370\232t%g\030>\272\fe\035B\207\2574\330**;\314d}w\314\376"
+	.ascii	"\327\031\353\321\214\035a\276d-c\347\210\201\003I\326w\331\366"
+	.ascii	"U\265|\247^Q\331\274B\\}I;\254.2\232\234\247\262)\351#Q\244q"
+	.ascii	"\034\337C6#e\204_%\313S0i\034CU\262l'&]q\266\022\255/V\030k\214"
+	.ascii	"\325h-Z[\254,\326!5\272\272X\201\276\006\255B\231hu\261\306Y"
+	.ascii	"\253\213\365G\275\202%\265\272X}\272\264@%M\343\030JB\017\031"
+	.ascii	"+n\364]\252\255B\325\013l\006\325\206\275\353\264\357*\355\273"
+	.ascii	"G\373.\320\376s\232\347\274?\237\311x*\324\00410\f\313\023\037"
+	.ascii	"Y\253e\035\236\323\350\036e\212\246\262\376\266\333\033\324\013"
+	.ascii	"lO\265a\277\275\354o*\373;k\177K\355?\227\251\223\302\204J*k"
+	.ascii	"2\031\212Y\023S\326\337:\366\\\036\223\245j4\323e1T\344r\030"
+	.ascii	"%\2518\206\322\345/9\314\n\035\333.\334\212\244t9N\213S\222o"
+	.ascii	"jEIn\353\267f\366[\270\375\326m\203\031\202\335\020\363\223\365"
+	.ascii	"[\263\3756\312\376\263\227\"\270\031='hV?]\336\202qJ\270\370"
+	.ascii	"\340\222\267\250\321\374\226\335\324\262\320\n\035\333,\234X"
+	.ascii	"I\3372\226%Rm\336\224\220\033\253\337\022i\323\342\223\212\305"
+	.ascii	"\330\330r\0265\232\265\3445.55L\370C\214\203\200\226\244\342"
+	.ascii	"8\326\222\261\250a\036\214\346\246\252\3428\316\300\001\007\""
+	.ascii	"H\013c\206\325og\354\2670\366\333\025ih=\241\2539\270\254\257"
+	.ascii	"@\203\3428\316\340\022%\235A\223\365\331\270\375\021\306\240"
+	.ascii	"\246\024\221\212c\250Y>\313V\324h\256\222\311\256>\311eW\253"
+	.ascii	"d*#H\301T\251\312\300\301\222\013j\307\326g\317v\006\365\002"
+	.ascii	"{6k\237E\262\317\376\330\177\026\013\213Q\226U\006\026\302\b"
+	.ascii	"\352\324\0041\206\241Y<\227\226u\207\016\317`j\326\031-+R\262"
+	.ascii	"\027\224\315\250(\353{x\022v\225\225\235\234I\305q\354\225\271"
+	.ascii	"\262\2236\210tnj\032\307\361\377\034\315Q\362\227\032\315^\031"
+	.ascii	"\312s\227\252\226A\347\220F\265\330\032x\267\337\033"
+	.ascii	"\263\337k\333\031\232\265\324\350\315\362V\020+>A\262~\017m\247"
+	.ascii	"\210\3438Vo\306\2667c\337\233\322\004K\210\343\311\027\255l\225"
+	.ascii	"\2572\0235\232\261r\325\363\222L\364\f\226\004M\n++1\002S\005"
+	.ascii	"+#\031\"\005\246\3124\216\241\0318\340\200\203\265F\227\231\324"
+	.ascii	"\326\254j\303\276\327c\277wc\277g\264\257\363\366\237\217P\345"
+	.ascii	")1\234\346\262\376\377L55\201\021\206\r\205\306\021\334T\006"
+	.ascii	"\320$\030=\262\376\263\221\fD{\271RU\226\365U\260\277\203\215"
+	.ascii	",$\354\305q\023\026\251\0165\262H\2172\r\225\314'\013\251l@*"
+	.ascii	"p\205Fj\346\256\251\313\321\024\006\330X\227\243)\035\031u*\364"
+	.ascii	"!\306@nDR*\0325\215:\355\020w9\252\312B2\221\334#\007\311M\271"
+	.ascii	"H~\3129\262S\346\221\207d\037\031*\377\310QYG\226\312;\324h\006"
+	.ascii	"\222o<3e\0349)\002VpR\225,\003\3111\262\fa\0204\226!\004\203"
+	.ascii	"\256`\241N\205k\034\3478#u\006O\235\252lJ\261\317\030\021\214"
+	.ascii	"\030u9\232\022\275P\345T6\245x\225\213\273\034U\345\026\331\205"
+	.ascii	"*\307F\031u9"
+	.string	"\232.A\325\324<i\227\243i\207g Y)\013\t\177\240\261Q\373\305\026\302\b\031H\036R\247B\037h\\\324F5u9\232\3061\224\003\016\266[\f%H\020\240s\223z\201\335@\265a\257\247\354\353&\373z\310\276F\332_\357\366\327032R\220\255\206\227\250\225\031\\\331H\205A\346)I\326_\243r\321\365VSp\375I\302\"\226\365W\246\375\365\305~N\263A\360\262I\220\262\237\261\366\275\324\013l\376\311@j4\0019\b:\314C\320Dq\222\365\363\221}5\001\354\232\227\247&\200}n\332\037S/\260\317.\366U\274}81\373R\365\002{\325\312\376T\275\300\252uj\0315\232\201j\007\035\006\323,Is&\353\253b\373j\006\254\232\247f\300^U\2625\230K\300\016*\373\272\032#\307\244\n\017\257\254U\271\254\212Q\245W\345\324\270\2070\302\201A\361U\034CU9\035\307?\252J"
+	.ascii	"\241\252\022\240gV\344\307\t\253\257\032\331\277\032f\213\353"
+	.ascii	"$\210\026h\326W\257\314\274\250W\177\2075,iY<\374\035\330\322"
+	.ascii	"T248*Y\324+B7\216\235\324\244\342\030zU\355\357pu\213\212E\275"
+	.ascii	"\202A\2138v\312\201a\253J\224j\032\307\320\377*\030\265\213\352"
+	.ascii	"E\345\242~Q\337T85\252nQ\265\\mS\335\256\241q\034\024\3071\007"
+	.ascii	"\031\324\245/EsD\255\262\251\027X\fT\033\366)\366\235\373:\373"
+	.ascii	"%\330/\261\317\246^`o\201\375\nl\265\212jE\215nP\317\256\226"
+	.ascii	"\251T\356\006Ac\2568\206\016\3357:\034^Y\277\001\373\352\006"
+	.ascii	"v\230\227\227\227\247n`\357\301\326@\275\300j\325\206%N\331\020"
+	.ascii	"4\363\006T5"
+	.string	"&vBI\251\t\224\253bj\230\332\024c\020\316xR\265\224\265\332\245z\251Q\r\352\327U)*\330{?\320\030\032\307\361P\235\003\002$#k\242z\201\315\252\r\373\003\354\253Q>\374\211Gx\273Y\020\307\252\006V\315\313S5\260\352\223\016W\241\330\260FJ\320\330+\216\343a\004\206\364\260\312zUm\330_\345\322\320*\231\242\303\207\223-\025N\n\207Z\326\277\272\365\253L\324+Uk\035z\321\024{\3051\2648d\202\344\203\b\364*\216\343\241;\345\f\022\032Y\253M\324\254\253P\025\353!\214\360\325g+\276\212\343X\205\212\320\024\307?*t\210\027\307?CU%\200\252\022@[\361\210\212\262\372y\037\252^`\267j\303\312\370\335\243\353\177\230\323C\363\341?<\376\275\272\277\275\341\223\361\267,|F\177;\304W\364\263Y|1~V\312\007c\332\303c7\313\n\340\037^\340o\213|/~\365"
+	.string	"\036p\240\017\266\206!\300G\364g\023L\021\370\207\016\370\367\227\177\307\375[\314\357\023\372{[\246g\376\235\346\367\005\375=\266M\267\311\374>\240\337=\360w}\276\237\337-\372|\\\f~_\374\347\022n\006\277\257\005=\375\367\210\277k\200\337\335\340\367\261\340\327^\277V\322;s\021\3206\300\335"
+	.ascii	"\302\357z\340\206\360\373V\360\273\f\360\251\340\357e \201\337"
+	.ascii	"\255\300\357~\370})pC\370Zp!\340\242\340n\340wI\270\034\320\253"
+	.ascii	"Y\025u\310\357\202\300\247\302\035A\217\312\317\262\211\036\231"
+	.ascii	"[\202\337\215\266I\356\361wM\374\276\024:\002\272\002:\204F\301"
+	.ascii	"M\2728\355\324\357\352\374\356\321\277>Y\247V&\377\332\265B\327"
+	.ascii	"2\227\005\037\212\337\315\300\357j\340\367\235X\241t\n\355\343"
+	.ascii	"\362\270(\370}=-\322\357C\200{\342wQ\374>\370wS\340{\376.\013"
+	.ascii	"~w\375\335\370\3679{ZY\027s\f>\024\254\001\300\240\347\366\367"
+	.ascii	"\326\324\022\\W\207\217\371\373tz_\277\317\304\357\033\301\357"
+	.ascii	"\353\300\357\333\300\357K\301H]\362\017\t\360\267?\276\013\270"
+	.ascii	"\375{\313\357\263\300\277\273\370D\370R\320C\303b\217\277\207"
+	.ascii	"\306w\302\337\273\353\211\371]\241\2777\365\231\360\367\344\376"
+	.ascii	"\336\234/\304\317\366R\340\306\370Y&\267\350\367\201\370w\226"
+	.ascii	"\177\263\375\276\0222`\320\323\212\361\377\203\177\b\202\277"
+	.ascii	"\267\344\357%\371{V\177\357\352\357U\375=&\177O\311\277?\360"
+	.ascii	"\373>\370*\360\267N\037\005~\355\301\337{\372[\246o\002\277\036"
+	.ascii	"\372W\033\377\212\342_\233\376u\307\277\372\374\253\213\1775"
+	.ascii	"\301\277\n\375+\323\277.\375+\320\277\326\370\327\241\177\305"
+	.ascii	"\361\257?\376U\351_\341\177-\372W!\377j\364\257?\377\332\363"
+	.ascii	"\367x\376^\362_g\374k\n\376\236\316\337\333\371{%\370{\310\177"
+	.ascii	"\r\362\367\236\177/\347_U\360\257<\177\317\371\367F\360\257\315"
+	.ascii	"\177\005\362\367\340\277\307\374{"
+	.string	"$\370{&\376\036\013\177\257\371\257i~\035\374\327\273\177E\363k\365\327\300\337'\201\277\207\364\267'\360E\340\357\031\377m\364A\340\327\t\370}\017\370{A\177o\310\347\200\345\337\"}$\374=\020\376\036\004\376^\004\376\336\003\376\326\350k\300\337\353\360\367:\370{!\374\255\b|\f\350e\320#\300\337z\3007\302\317\236\371D\370{\277\277\007\374{\356\337\333\177\317\367\357\367\3378\277\317\303\337\013\376\276\020~\037\b\177/\303\357\353\360\267$|\037\374>\016\232\312\257\311\374\232\356\357Y\371[\r\370<x\3735\230_\303\375Z\314\257\343~\035\346o1\340[\300\257\305~]\345\327S~m\366k+\277\326\372u\330\257\321~}\366k\262__\375:\353\327\\\277\036\373\365\223_o\375\032\353g;\350\031\277\257\203_\037\375m\n\177+\342\367q\360k\370\327'~\255\202\337\247\200_\023\375\276\r\177\033\302\227"
+	.string	"\215\202\277\205\300\257\235>\004\350\023\374Z\371k\023\277>\376\032\251w~\215\363k\026\376\026\004\337\001\376\326\003\255\201\337\267\301\2571\360\373\f\360k\025~_\001~\275\302\357#\300\337r\340\323\340\327\035\376\026\001\276\001\374z\377\332\375u\333\026\340o\r\360\373\004\360\257Y\376\225\355_\337\376\225\313\277n\371{b\177+"
+	.string	"_\006\\\277\017\203\177}\362\257U\377\252\344_\235\374\276"
+	.ascii	"\374k\327\277\222\375k\225\177+\377}\202\337\007\200\177\365"
+	.ascii	"\372}\032\376\036\330\337b\360eh\213\277\017\303\277\032\377"
+	.ascii	"\365\370\257%\370\327\344\277\022\375\353\373\257,\370\333`\361"
+	.ascii	"\317g\376\365\202\177\375\375\253\315"
+	.ascii	"\277\002\3775\303\277\016\377\365\346_k\376\025\303\277\252\377"
+	.ascii	"\n\200\277\375\225\371\333\375\267\356\357\273\340\317^\376V"
+	.ascii	"\373.\374\271\355\317Z\376\354\366\373n\376\366>\233\177/\377"
+	.ascii	"\275\363\373jv3\233\375\331\312\237\251\3749\355\317U~\026\357"
+	.ascii	"g\321\374\276\342\237\303~v\352#\346\037?[\267\235\276\341\237"
+	.ascii	"{\374,\335\322\237\233\376\235\342\337*~\237\360\317\361\237"
+	.ascii	"W\360g\026\374\271\005\177n\341\317*\376\254\202^\331\317J}A"
+	.ascii	"\346\237\225\177>\301\357\003\376\271\371\347\345\237wzS~6\214"
+	.ascii	"\357\3076\300\347\373\017\375\263\b~\366\001>7c\340g\275\374"
+	.ascii	"\354\227\337\267\377\035\364o\241\337\327\376>\366\337>\277\257"
+	.ascii	"\367\347\023~U\307\237;\374\271\204?O\340g\271\370\364\277Ep"
+	.ascii	"\221v\013\337\372\357\027\277\252\363\220\035c\267[\306\321\357"
+	.ascii	"\3135~\366\203O\3757\216\337w7\357\357\r\371\367\b~5\310\257"
+	.ascii	"\037\360\353\t\374\272\204_{\370\265\231\177\225\372\327&\377"
+	.ascii	"Z$\357\300\360?\353\177\bD\360?\003\377\021\340\342\375\356\231"
+	.ascii	"\337%\363\273q\377j\345\355w\263\374\356\231[\345w\215\260\251"
+	.ascii	"f\177P\353W\017\360\263M\277\352\201*\200_\325\340W?\370\325"
+	.ascii	"\344\257\"\315~\327\354W\215\277Z\002\227\312\257\226\370U\017"
+	.ascii	"\374j\007\306\3342\026\354g\303~\227\354W-\360\253\"~\265\204"
+	.ascii	"\277\365\372\335)\356\230\372\200\226\312\357\212\271a?\013\345"
+	.ascii	"g\273~\027\354_\3036\222\277\305\342J\371U\016r\270_\177\333"
+	.ascii	"\305\215\266R\026\3126\331\362\377\313\377\267\377p\377\275\374"
+	.ascii	"\347\362.\177{\346w\243\270^\177\233\367\377\314\355z\330\305"
+	.ascii	"\264\264l.\224\277\265\342>\331>\227k\350:\371\367\006\356\326"
+	.ascii	"\277\t\340j\375,\325\317\036\371]\250\233\265[\225\005n\023U"
+	.ascii	"\370\2535\177\313\365\267c\177\213\226\241\247\365\020\270X\277"
+	.ascii	"\233\344w\221\374\356\221\2775\343R\375\256\221\237e_\302\210"
+	.ascii	"\216?\210\3747\020w\310\277\257~V\310\025\362\273A\376\215\365"
+	.ascii	"\273@\376^\327\337{\362\367\274\376\036\327\277\241\374\273\353"
+	.ascii	"w\177\374;\352\372\370\267\225\177\203\271O\377.\342\366\370"
+	.ascii	"Y\242=\245\275ry\374\033\372o\255\337u\332i\377V\373\335\035"
+	.ascii	"\377\227\030\034\001n\323\237\207\270:~\366\307\305\260\300\375"
+	.ascii	"\022\376a\373\377\254\225sk\250<\277\212\202\335\341g?pq\210"
+	.ascii	"\340\"\035\001\356\215\377b\330\375\001\374A*\225\305\216\200"
+	.ascii	"k\343o\303\270J\177+\347\326\370w\b7\351\002\377\306\200KC\004"
+	.ascii	"\027\351o\225\2703\236\200\177\177\370_\342\337\"~\200?\250\344"
+	.ascii	"\337M\377v\372o\367\267)\370{Z\177;\365\357\036\277{\364\037"
+	.ascii	"\203\237\355\371[\025\377\177\277\220\356we\374n\321\357\256"
+	.ascii	"\370\335\370wY\360\273*\370]\024\277\213\202\337]\376\256\316"
+	.ascii	"\357\342\374n\362wM\374n\t~w\004\277\033\202\337\345\300\357"
+	.ascii	"\222\370\335\r\374\256\006~\027\205\3375\341w?\374\256\004~\027"
+	.ascii	"\002\277\353\200\337m\300\357\206\360\273 \374.\207\337\345\340"
+	.ascii	"w7\374.\002~w\203\337\315\340wk~7\370\273\372w\377\3574\377\306"
+	.ascii	"\373\367\364\337e\376M\346\337b\376\375\345\337p\377\336\362"
+	.ascii	"o\266\177"
+	.string	"\253\375\373\354\337_\377\356\372\267\326\277\261\376\r\365\357 \377\356\361o\247\1777\375;\307\277\225\376}\364\357\030\377~\361o\027\377f\361o\241\177\373\374[\305\277\237\377n\376{\347\337'\3707\316\277M\374\333\004\377\006\301\2777\360o\r\374[\205\177\243\360o\023\376M\201\177K\340\337\r\370\367\b\377\016\341\337\035\374[\001\377N\300\277\017\360\357\002\374\233\370\357\337\277\367\277\363\277\377\267x\177+\375\333\270\277\205\373[.\177\353\366\267Z\376v\355o\317\376\326\354o\243\374-\326\337V\375-\325\337J\375-\221\277}\372[\246\277M\372[\244\277=\372[\243\277\035\372[\240\277M\301\337\252\370\333\347\3376\377\226\205\277\315\371\333\344\337\232\340oG\360\267\037\370\333\022\177;\342oU\370[\021\177k\302\337~\370[\n\374\255\004\376\026\002\177\353\200\277m\300\337\216\360\267\036\376\266\303\337z\360\267\035\374m\002\376\326"
+	.ascii	"\177;\200\277\315\360\267\305\277\r\376\355\357o\335\277\355"
+	.ascii	"\375\255\372\263h~\326\314\317\326\375,\335\317\216\371\331\270"
+	.ascii	"\237\375\362\263o?\333\366\263l?\233\366\263W~\326\354g\313~"
+	.ascii	"v\312\317\206\375\354\327\317F\371\331\256\237\345\372\331\255"
+	.ascii	"\237\205\376l\223\237\275\372Y\253\237\255\372\331$?{\344g\215"
+	.ascii	"\374=\274_%\376\352\315\257\352\277\307\345g\177\374\252\214"
+	.ascii	"\237\365\361\253\360\317>\375,\217\237u\372U\020\374l\323\317"
+	.ascii	"\352\370\331\034\377\303~\226\351g\227~V\351\317%~\226\306\317"
+	.ascii	"\276\370\331\025?\333\363\263\037~v\002?+\201\237\205\300\317"
+	.ascii	"\222\360\263#\374\254\b?\033\302\317~\360\253,\370\331\005\374"
+	.ascii	"l\007?\253\200\377`\377\032\366?\303\377\263\237\005"
+	.string	"\376\254\373_\314\177\273\237\335?\333\376,\373\367\320\374\275\267\277\267\345\357\261\375\275,\177\017\355\357]\371{g\177\257\312\337\243\362\367\310\376\336\330\337\013\373{R\376\236\326\337\213\376\275(\177\036\362\367\260\376\036\221\277'\344\357\321\370{.\376^\213\277\327\363\367*\360\367<\374\275\002\374=\r\277\276\373\365\364\327r\277V\373u\322\257a\374\232\005\277v\376\232\371k\017\374\272\003\277\346\300\257K\374Z\204_\207\360k\341\277z\371W+\377\372\365_\353_\213\374+\324\277\006\340_1\370\263\335\237\303\374\231\313\237\325\376,\366g \177~\372\363\216?\003\375\331\371\347\021\374Y\003\177\316\300\177\025\376\214\302\257\332\370\325\243_\355\371U\235_\315\371U\234_=\376j\b~5\003\277z\201\377$~U\002\277\352\341W;\374*\b\377\307\374\227\376\007\363\177\354\277\330\177'\377\267~\365\204\377i\377\205yyyy\177"
+	.string	"F\374\016\300\360GS\be\220\232\030M\341Z\320\275\261\372\"\272\354\2138\333\0271\266\201w\035\016<\323\342\305U\232\262\316\261j\303\036\332\244^`w\220j\303^\204\223\375\003\313"
+	.string	"\353\352V\030\311\032H\346\207)\217E\326\027\221dC\271\200Q\022V\030\271EN\202H\251\200\341\220\222\222C\352K\207\364\n\370\346\003\"[\252\002\274\362Bj\026C\212\005\250\205\204\025F\356\f\240\026+\324\311\343V\270\225\251WlH\205\001\337\200b\300)$\2540r\211\334nH\345\200_\200t@)p\fp\016\b\007\354\002\024\003\364\002\344\002\f\003\214\003n\001\202Q\243\300\267_\336\201m@7 \025%\340\233;\006\250\006\204M\242!dn\032\307\320\037V@\320h\240{g@-l^Za\276\350\251.bQY\200kl\0237 hY_\304\320\276\b\237\215\006L\033\332\301 \363V\006\315\n\360\fx\344\250\b*\353\247"
+	.ascii	"\267\201VR`\333O\301\312~\n\321\375\024\260\366S8\262\177\340"
+	.ascii	"\024\340\230T\324V\\\326lC`\032&n;\262~\nC\366S\310\261\237\202"
+	.ascii	"\214\375\024\202\366Q\260\333^\300(]Z\250\254\fH\326Ga\315\013"
+	.ascii	"\330\325\206\025C\201r`W\2210-=\262\006>\311ByajfY\277\356q\377"
+	.ascii	"\335\237\025!<\326\262>\ne\373(pA\201Z(\346\204\240e}\024\226"
+	.ascii	"@\265L\240\243N)\f\326\325(\020\013\310D\335\212}~Q\310\224 "
+	.ascii	"\001\277\304P\342#\353\243\340c\377\300+ \223,\026"
+	.string	"R\220d\r\264\302\222\202\202\322\376\201J\224"
+	.string	"\25364\375LiP\366\323dI\004S /Y\003\253\302\244\324\371x\275e}\024\216Z\261\023n\314(;\362\273V.\0235\n<\002\234\352\005\305?CX\244\030nx\3238V\352\240\307\343)\252G\326G\341g\377@\252O\365@\203\303-k\240\221$0Otv\300\250|\006\205f\226\365Oh\333@(\255l\247\245\350hH\0248\004\030$\303\216\203\326\342\244q\254\324\201O\307\2314[\262\376\ta\373\007\n\001\006\211}\302\254d\r\244I\224\fT\326?!k\337\203\215\031k4\220\222\322\300j"
+	.string	"s"
+	.string	"u"
+	.string	"\233\200L@\037\300\036\300' \017\240\023\020\007\360\207\032\005\356"
+	.ascii	".]ES\004w&\206\227\033\300\035@\245+R\340\016\240\021\360\350"
+	.ascii	"kN\t\322\364\347"
+	.string	"\242\256FR\006\375\023\202\354\237\260\264\177\202\213}\023\246\373&\304\355\233\200e\337\204\256}\023\226\354\233\340\264\177\240\214\003\217\316\016\0059\035\311:\237\351p\240\f8\031Shd}\023\216\366M \3327!\336Ph\034C\207\277\261\034Q\220\262\006\272X[\220\227\227\227\207\027\307?@\027\031\370\002Ht\240\213\017[\270\252\241\037\266\005]\260\b\325\026\320\220]\027\232\026+,V\370\360\021\305+k\240P\f4+\254d\375\020a\366\325(0\bH\205\034ct\300\237\003\201\264\027\241\0263\262~\035\320\347\277\353{\373r\006\350\003\214[\241;4.`\374\313\003\346xZ\352\222\365Cd\331\377/\r\2320:\226\302\262\306\033\372\240\241\002#\353\207(\333\367\360\245N\314\317\356\007\346G\207\001\320\020\006\252\276\330\375\274\204\271\373\225\371M\177g~f\324\350\317\356G\346g\367\203CCr\273s\267\236\362\274"
+	.string	"\365CP\355\207\3701\327V\206&\353\207h\332\377\177\322\237\234\032\375\215\371\305e\270\022\363\333\302\222\372\215\371\205\371m\245@j;\252\322@N\274\250\261\372 \320\354\203(\263\017bn\037\204\230}\020_\366Al\331\007\201e\377\277.o9D\262\330\001\253\260\252\300q\331\202\345jL\314\317\355\277-\352T\212\220&=\262\376\265u\370\317-x\366C\232\365"
+	.string	"~Zr^\027(jQ\330~Y\204U5\314\274\324\376\313\362\377\260\374\326Th\020\312\223\237-Y\253@\324\013\354\005\325\206\335\321\016\377\251\3554Ub\004I\273\232\266\202D\313\007\315'ci\016\207\326\357\312\357lE\022c\356\313O\350\211\253\315J\225|\304\224E\210W\333\345\314T\211\331\217\312\026\373a\223\262\312%%)*\373\221I\223\266\214\t\352\231=YZ1\3457&\304JC\344LpJP\2221\2610\"4oN4\3736\255\342\002\373I\221\343\222\206\350\307\177R\376\314\224qd!\265\t\rK\225/_\277-.42kQ1mO[Y_\275\372u\375\264~[\030"
+	.string	"\r\245p\025\345\327\365\313\362\372A\371E\371=Q\243\277\256\037\0274\013E\245\342\030\372\353\37291Bjb4U\341||L\361\351\2030\262\017\242\307\376\177[X^"
+	.ascii	"e}\020L\373 \216\366A\020\355\377\327\344\227\204"
+	.string	"\245\202\242V\303\210\r*\030RxR7\240t\224M\025I\177I~G\210\244\277$\277(+$%d\323\237\325O\311\217\311\017\353\267\344w\365\253R\243\277$?$k\231,2)Q\277\004.\373%\260\355\227\200\266_B\225\375\022\306\366K\360\332/\001\272_\302\222\"?\"?\"C~?\300^\230)\311\3729fB\243rC\310\317\351\307\343\347\343\007\344\027\344\367\364\333\361\353\241F\177?~MKjR8Z3\036l`\371\375\370)\255I\177?~9\244\220\246\346\252\342\030\372\273\363\201\006t\243_\002\213\375\017w\373\037\276\354\177\300\262\377\001l\377\303\325\376\007\250\375\017L\373\037`\354\177\360\331\377/\351w\004\324du&\353{(\372\035\375`\304Ic\204\221\222\361C\372\315\370\321P\243\277\243\237\321\357\350\367B\355\005\223iU\357\353F\034\303\247_\201\272\375\n\270\355W\300k\277\002?\366+"
+	.ascii	"\264\377\037\321*\344\347\342\327\242\b\227"
+	.string	"\237\270\254\177CP/(\017\263(Y\237\002\322}\225\212\031u\032-\273k\315\244\361\235\361\312[\235d}I\361\232H}y>\273\326\314\bJEi\326\246?\241_\374\373\371\261\370\255\370\005\375\200~>j\324\227\347C\3435\244\202\245HU\215>\005\246\354S\240\311>\005\252\366)`d\237\002B\366)\300c\237\002J\373\0240\332\277\257\214O\213[\027\223Y\326\035\314\262\320X\226\024\031\026\224\265.,R+PaQ\244T20)U\242\244\320\204\220}\211m\221I\001\223Ni\"E\307\005w\025=\223z\251I\317\210H\243\320=\311\362\305\247\346\353\342k\363\315\371\306\370\270\370\334|o>0>/>1>9\337\232\217\214\017\316G\347\303\342\313\342\253\363\305\371\244\276->6_\0305\352\323\342K\363i\361\r\241\"\346%-\273\222\242\363i\3619!+\262C\233\3061\324\353\311\n\f\021\364'"
+	.string	"\267?\201\256\375\t(\331\237\300\323\376\004j\354O\200h_\002g\366%\360e_\002f\373\022\270\332\227\300\217}\t\304\330\217@\232\375\bH\367#\260\266\037\201\257\375\b,\331\217\200\217\375\b\304\330\207\300\335>\004\336\366!Pe\037\002M\366!0\265\017\201\035\373\020p\261\177\237\226\017\372{\302d\b\027_\226\257\211\357\312\207\345c\242F}P\237\325U$eT>\222\246I\226\244\252\224\244\224\370\240\276%S\350|$M\333h\222.;\200\372\017\260\333\177\200\230\375\007h\331\177\200\330\376\003\254\366\037\360\264\177\337\021_\22180>>Y\337\203\220 @\206\374 \"-\342\353\021%}\202\362\341\223\362E\371\240|F|S>\">*5\352+\342\033\002\346+\342\013b\306\303G\313%\206h\nQ\377\001H\373\017\020\332w@\335\276\003\300\354;\300\312\276\003\276\366\035\320d\337\001P\373\367\361\360\351"
+	.string	"\336\255\340ac\245R\346\273\341\323\341\216\3615\371v\370\234|9\324\250O\207\017\207O\207\217\311\001kEB\2562\225\2475<\237>\th\366I\250\333'\341\313\376}K>\245$.4F\262Vr\363|G\253\226Q\006\204\224\244\276$_\r\237\r5\352S\362\315\270\017\311G\343\311\247\344\242\261\241\344\342-\371\276\270\335\371\330\232mR/\260\337\242\332\260'!m\373\216\376\365\311M\343\223\221\017\360\204\306.k#\366\212\221\264K\326'\301k\377\367\301\360\275\360\271\360\265\360\305\360\021\251Q_\221\217\205\257\310\007\344\023Z\265\214\266\230\320\220t\350\205T\034\023I}E\276\025+|\\H\371\212|?\276\243\"\036c\3037;\257+B}\022\224\366I\020\332o\300t\373\202T\256\256 g\262~\003\264\3547\240\312~\003\270\366\0330\265\337\200\033\373\r(\332,\003\314\3543"
+	.ascii	"n\377\356\031\367\316LF\334\030\367\356\277\2471\257\037\327"
+	.ascii	"\214;\255b\373\241\313\332\016\032\214\222\026\001\311\372\f"
+	.ascii	"\bs\353\\2j\324-\343\316\321\301\271e\3341svI\206;\246\270\320"
+	.ascii	"`\365\031\020e\237\001Q\373\f\020\262\177W\352\202)s\261\"L\326"
+	.ascii	"\367\300E\212\264ML\312-\fl\013\330\027\027\316\355\342zq\305"
+	.ascii	"\270qn\030WN\215"
+	.ascii	"\272`\334\267\2654)\"-gR0n\0260.\333T\214\271\252\240\017\264"
+	.ascii	"\230J\215\376\bg\366G\360\262?\002\330\376\bM\366G\030\262?B"
+	.ascii	"\322\376\b@\373\"\200\331\027\201\f\013Zk\206\207w\345\364\244"
+	.ascii	"\345Jq\307\\+\356\225K\346Vq\317\\*n\226"
+	.string	"\253\346b\271P7\315\025s\257\270[n\231\353\304\235\342Bq\301\334\250k\346v\271O\\.\367\313\rs\275\334&n\0245\352\242\271K\356Z\271LT\262\037Yt\320\335\300\223\242\313a\306LT\223vS\331\224\"P%\027\004\213\024\216;*C\322\226\320\370\200;\022\225*\242Nm\244\241j\315|IA\241\271J\334*\341\032\307=\262\244\220D9#\245N\303\244D\320\244\035\214\200M\265f\244H\205\250\001Y\223R\312S\311z\200\221\356H\242N\275\\4\227G\030\027\315eR\313\304p\303\253r\267\240jd\225\240\263T\275\300rPm\330\213@\265\335*u\332R\345\305\230\313\372\"\024\331\027\341\306\276\b-\366=\244\331\367\200e\337\003\327\276\207\251}\017I\373\036Z\354\207\220f?\204\271\375\020\302\354\207\340\266\037\002\332~\b\321\375\020\246\366CX\332\017\201\305~\0071\373\035\332\366;T\331\357"
+	.string	"e\277\203\324~\207\036\373\035\216\366A\230\356\203pe\037\004\255}\020\202\354\203\360b\377\003\272\375\017\256\354\337\255\341\322"
+	.string	"\256E\347\260\212\226\270I.\222;C\215\2724\334##U\316\006+\205!Dm\352\322pe\254\301\020\242\326\263\322C\253j\353\177\360\265\377\201\326\376\007E\366?\240\261\1777\206\013\203E\225\"2\356\013w\310u\341\266p\211\324\250\013\303]q\227\205z&va\270\261\3733c\003*\027\206+d\244-\352h\272\376\240\372\211:\232\2720\334\240\271\250\243\251\013\303\005\3328f,\200\352(\352\350IS\021)P\013U\033\366\034\362\3669\220\331\347\320e\237C\226\355\372h"
+	.ascii	"\246\275E\343\254\317\341k\237C\325\376w\336\267\031\232324\033"
+	.ascii	"O\215\3564\373\314\224mf\205\216m1\036-\244izW\366\235\360\207"
+	.ascii	"\030\007\361\030\222\212\343X\003\007\034\370\346\204,\261\372"
+	.ascii	"\034z\354}\027\2466a\370\315`\363b#\353\351\217&$:\262>\207\027"
+	.ascii	"\373*X\031\236\335\256S\243\273\314&\263\313\264QS\253\031.,"
+	.ascii	"RV\337\203\351\3767\335\334\227%gc\276\347\256NM\200a=\222\342"
+	.ascii	"\004I\326[\332\341{L\0323D^Y\017\267\\\\\335\233\322\227\254"
+	.ascii	"w\334\306\262\273\254ZF\026p\223\022f{\331`\366\227-F\215\356"
+	.ascii	"\270\r\027\267\257\234I\317\244\205I\251\201I\30514n\243\211"
+	.ascii	"I\343\030\032\"\211\212\n\250\357\301\333\233\032\344+j\226\365"
+	.ascii	"=8\333\377\267\333n\333[\324\350\346\262\331\2624\271\322\342"
+	.ascii	"\265\271\354\265\354$K\nXv5\207c\353{@\266\357\001\327\276\007"
+	.ascii	"\320}\017\256\366=\250\332\367\200\310\276\007:\366=X\332\367"
+	.ascii	"`\306\376\367\031\023+YU\266\223m\266\2450Q\231\313\221\365U"
+	.ascii	"0%A\240l\257\033\036\226\350(K\"D\315jc\271\345\220n)\273\212"
+	.ascii	"\312\326~\002\304$\275\332Rv\223\255U\204\265\202\321\005o:e"
+	.ascii	"S\331b\233l\217m\260\035\266\313\324\350\226\262\243|G\367\027"
+	.ascii	"[g\004%M\215V\233\324\013\354\215j\303~\001sGv\027\217#M8\262"
+	.ascii	"\376\002\266\354/ \315\311\346\332E\236\250A\031s\322\225\265"
+	.ascii	"\2419G\242le\375\005(\331YD\366Uo\313\225.\263\254\277"
+	.string	"\200\034\233\311\002h\354w\220\267\337A\227\375\016\314\366;p\262\377\215d\037\331G\276\251\266\221)E>\312d}\017F\266\0175Le\003R\001+/R;\310\216\332E\266\220Md\017\331P\033\310\236R\243\333\310\376\261\215l\243\215Ce\003\242\313\234\221\242\321\321\2321s\325#\214T\323T\312\211G\334\016u*\327a\033\3319Z3w\322md?\255D\204A\320X\306\017\306\024\325\222\215%8\266\\\240\337\001\325~\007<\366;\260\261\337\301\213\375\016\342}\016\306\354s\240e\237\003\262}\016\240\354s\260d3\261P\\\356\314\262>\007<\366\224\255\244\262\001\321i\322\2447\266\r5\272\227\266\214\275$\354\305\361\017\232\324OG\017\031-X]cze\354+\353s\320b_\005+\003\223\n\243\261\223\366\f5\272\221\366\021R\217\212\0326\202\022\214\250$\323^\031\251\2311[_\001b\373\nX\262\257"
+	.string	"#\373\337E\233\250j\216\350E\326\367 \347%\215c\350&Z{\354\240\025:\346~9\311\222n\242\026\214\024\351~\261[l\027{h\307\3300\324\350&\332B\337+6\213\270h&\n\263\211Z1Y\b\003\2418n\312\321\036\301\020\2426\0352\371\202D\211P\253c\352\005\026"
+	.string	"\252\r{\005\f\355\r\2245\331\026!gY\177\203\335\276JeN\212\324\216[\273\366N\350C\214\203\272\304\244\266O\213\327\242\331?m^\233\246=\243Fw\334\226\221B\367E&\2127\246\013\330\216[\251:\375\021&\335q[\027\377\370\220`\346\250\013\236[CIi\214\330\336\2311A\034{)\005\275H\312\272\235\352$,OPY\177\203\334\376\006\270\375\rV\3667D\3677,\331\337\360c\177\203\322\376\006\027\373\t\230\356'@\313~\002\314\366\023\020e?\001M\366\023\020\265\377\366K\353\005\316\255\tJ\326pZ.K\225\243\254\237"
+	.string	"\034\373#\264Ey\300Bk\222\305K\252mk\257dI\267\264n-\227\226\255\325\322vi\337\324h\333\326by\273\226\34325\253\2666M\235b"
+	.string	"\024\3079p\260e^\330\335M\343\030\n\234\352\2215E\324G@\334\366\2516\354\021\220\266\217\200\350>\002\216\354#\240\307>\002f\354\277=k\255p\205a\322\225u\025hP\020\r\r\222R\326G"
+	.string	"\214\262\226\254\245\242F[\263v,\254\025\263\222\212c\256{h\315\332)\255\230\312\246\024\201*W\3228\346j\315Z0uk\2032/\344\252\004\331l0\271\261\365\017\320e\377"
+	.string	"Z6t\b,*\032\322\224\365\017\220\266\177\2002)_\312\036F\226d\035\205J\ts\305**\353\037`\311\276\207&\255\026\017,]-\326Z\013\245}\322r\265^m\0245\332v\265[R\234\264Z<\274H\333\256V\252\245\342\001\327v\265G\332\253\025*\265\211\200\262H\3438f\235\334p\003\003\352\037@j\377"
+	.string	"IY-\324mZr\362\223\365\017\020#\353"
+	.string	",\3667\260c\222\2645&)\353o"
+	.ascii	"\267\377\267K\332*5\332Z\265IFPrE\252\265j\2210\361\231\3529"
+	.ascii	"\251\232\221\307\352o\300\266\277\301\224\375\r\272\3667\320"
+	.ascii	"j\2472^\226.F\262\376\006HZ#\033\f\331\177\033\325B\225)\241"
+	.ascii	"\265Pg\363\276\324\301\205e}\017P^HU:3\267/P-\033U\274H;xI\223"
+	.ascii	"\002\003C#U\351\310\342\244tea\244\240K\322\025G\023\232\024"
+	.ascii	"\232\365\344\306\223\323\331\216+O=\302\210\220\024\221\316I"
+	.ascii	"I#]\241W9\242\264\220^MUI==\201I\251tb\244\224\f\221z\022\342"
+	.ascii	"EG\005\214\016\355&\224\006uu\004J\352iH\026t\353I\351*:$\215"
+	.ascii	"b\"u%e\245\327\214,\311c\257\260o+t\f\005\240,\322\2710\2749"
+	.ascii	"/\027R+ g\306\246R\350\223'0\256\222\020y\n\022E\352jI"
+	.ascii	"\220\365\211H\023\351S\036\313\203\375\021\372\020\343\370IL"
+	.ascii	"\352\212\211\016\251\365\tHTz\307\232ii\264=\332\035\255S\373"
+	.ascii	"\3236\265K\354\224\235k\343V\250\255\321\036\265@l\231\026\251"
+	.ascii	"-jc\2640\332\033\254\230vF\253\243]\321*\261g\332\240\266E\353"
+	.ascii	"\323\342"
+	.string	"`\345X\274\226G\373\324\016ie\260dX\272\226E[\204M\323\272h\231Z#\266\256\315\321\002i\211X\273v\250\265\321\376h}\264I-\221VH\373\202E\303\216i\203\260R5\312\346\261`\316\206a\343\326\271.\242.XVh\023&\351zU%D\212#\217m\301\022\255P\251\023\236`\221\226\375+\216\034jR\353\223\017)*\235\230\031i\221,$\204%\265\316}\345I3\236\223\")*\\1\244\236~|\301e!\265/h\322\025\312\346\261X8\244Wl\036K\025%\215c\350\252dL\207\217\032\3536\215j\303~\203\034\373\033\024\355\033 \315\276\001\344\366\r\240\306Za\317X..\322\025\262\260\254\267\254i\\\204ae}\003\230\355\377\254\026\226\215mc\263\250Q\326\215\305\222\006D\332\201uc\327\204\240\005\221b\335X5u\332\344\005\223i\025\007\275 Jsn>}\003X\355\033\200j\337"
+	.string	"F\366\r\020\265o\200\"\373\006\b\262U\251z\201\025\200j\303\336"
+	.string	"5\366\013\220\267_"
+	.string	"\272\375\002l\331/@\331~\001\234\354\027 j\277"
+	.string	"I\373\005X\261O"
+	.string	"\271}\002\240\355\023\300k\237"
+	.string	"K\366\t"
+	.string	"d\237"
+	.string	"5\3665H\263\257\001\335\276\006]\3665 \333\327\240\311\276\006B\3665@\332\327 h\177"
+	.string	"f\366\007\320e\177"
+	.string	"g\373\003\210\262?"
+	.string	"\252\375\001\364\330\037\300\214\375\001\304\373\002 \263/\200\264}\0018\331\027\200\221}\001\324\330\027\300\212\375\f\310\354g\240\266\237A\224\375\f\222\354g\260c?\203\027\373\030\334\355c\200e\037\203'\373\030P\355c\200\264\217\201\317~"
+	.string	"\302\354\007\340l?"
+	.string	"d\373\001\350\332\017\300\222\375"
+	.string	"\370\330\017@\214}"
+	.string	"\324\355\237\305q\226)\016\312\021\226\211\275A\346\310\220\242\254\227|L\240\236\244e}"
+	.string	"h\331,\0138\251\262 \366\007\214T\017\215\031)6\006[\304\036\2615\330\027,\022k\304\322`g\260J\254\f\026\006kC\215\262I\354P^\341\023'e\223zyrR6\211\005b\177T6%m\305&\365\316\364\360T6 \372\352N*\364E*\026#uw\206Mb[\260Dx\3228\216Y/RlR/\215:\005\242\232V\3051\224\203\340\030\246-D0\320?\353\342,\321\3373\223W\250P\023"
+	.string	"\205\320\230\221%k\225I\207\263.\206nbuPY\037"
+	.string	"R\373"
+	.string	"`\332\007"
+	.string	"\322>"
+	.ascii	"\210\366\001\020\357k\230\356k\030\303\376\\\235:\243l@\311\372"
+	.ascii	"\032\300\354k\320\262\257\201l_C\223}\r?zxYhH\246\310\035\221"
+	.ascii	"\254\257\201i_\003\322v{"
+	.string	"\323\2726\262\260\264\254\257R\221C#\305#\323\263\353\225\351\321\251\321^]o\256W\327\023\223\306C\257\2567Fl\352\016\315w\245*\357\205O_\303\320\276\006\237\375\fw\373\031\304\354g`\213\013\363%\206\245\364\245\007F\215\366\302\364\274@\341\270`u\350\205\351uQ\247\036p\363\221T\005d\202e\346\202\325\317pd?C\216\375\f/\366\337{\353q!\322\212\271zn\275\266\336\0265\332\343\322\323\302f\265v\325\343\322\313\362c*/\3074\216\343%d\260hm}\fU\3661D\3671`\355c\230\332\177\017KZT\212.,\353)=+\302\037b\034C\365\324zhj\264\227\3668\250\227\326\273\242\255\326\244::\345\201\306\352c\200\332W\301\312\276HU\351\235\365\314\324h\317\312\311\32400RVzT\3240_\221\243;4g\223\2473[\037\203\321>\006\027\373\030V\354_\220\267\377\336\030X"
+	.ascii	"\244\244N\262\356\201\365\240<\271P\322\303\202\021\245\347\325"
+	.ascii	"\373\352\205\365\242=)=15\332\003\353A}\235\353u=C\017\254\367"
+	.ascii	"$\013=!*\322K\362\024\243C\223\036\227\320\013!\217\343\242$"
+	.ascii	"\355\201\365\206"
+	.string	"\364\210D`\312\234]\222i\034C\331\267.StD\275^\260\266\177\301\330V\317\211V+\304\013\013\264\254\177\001\326\226\226\216\331\220\027\364=\255,4\214\321\266\206\224u/\253\215\312\301\344*\353\327\251\323\377n\217G\2310bF\230\364\256\254\262\022\246\246\270\254\177A\016&V?#;\027,\226\274g5]\227\310\2219S\365\337\325Aj?\276d\035%tB\003m\312\372\027\304\350!\371\211y\033Z\313\372\027\356zGzT\255\317\033\323Oo\352=\252\036\215\0325\242=#jp`>\214H\241E\211.a\233\360\340\312\364\242zP\272\354\211\332\022\270\375\013V\210d!\266\206\320\231\257\254\177\341k\377\202\326\376{A\200@\233\226\240\371\361\036\220\253a\252*$\006\306]\326zJ\207\367~\be,y\022\365\361\344AY\021\037<T\272^\217\213e\226\313\222\024\037Y\347X\275\300\352i\207\367x\b"
+	.ascii	"\314lJ\326\177\317i\307\333\214\274h\326\275&mF\332b.\353_0\262"
+	.ascii	"\357a\350b\253\226\321\005+\272TI{8z-z5\246@\250\233\353\202"
+	.ascii	"7\3551\365n\364l\364\226z:z9\324h\017\007\035\216\236\322\232"
+	.ascii	"\205\204\025F\356\212\256+\251\320T\027\274i\017G\217\205\335"
+	.ascii	"Q\027<\262\036\216\336\n;\247.x\3238\206\252Y\346h\314\t\365"
+	.ascii	"/@\365\222\314\344\210\274e\375\013\275\031=$5\332\243q\027="
+	.ascii	"\030,\204H{4z1zGN\033\352\246\272\340\371\356\320\322\246\260"
+	.ascii	"\372\357\035\365d\210e!\231e\3353\372\2750R&#\353\337\314\365"
+	.ascii	"\212n\304\354\277\007\343\275\027_JxDYo\350\021\261\r{OOvL\263"
+	.ascii	"\376\r\227\375\033-\3737W\366o\302\366o\266\366o\216\354\337"
+	.ascii	"\020\331\177/\250\0074\366\003D(\353\336\017p\313\022\231)Y\377"
+	.ascii	"F\307~&2\343%UF\006\353\255\211T\306\343\222UF\235\362\260\222"
+	.ascii	"\366|t\032\235\327\213\365\031}\247\321\250Q\215\247\355\256"
+	.ascii	"\247\271\305\325,\332m\205J\265]@W\3228\2165\236\256c\"\025\307"
+	.ascii	"P7\306\223\037 \242\376\315\215\335\2526\354ob\354\337\304\373"
+	.ascii	"6d\366m\304\354_\323\315\231`\022G\263\036\343\273\342\266\002"
+	.ascii	")\353\333h\331W\257\266\204\221\206\321]\324+\253\226\321\356"
+	.ascii	"r\342\345\355\213\224\016\243\271\250a<\300|\321`\264T\307i1"
+	.ascii	"ZN\215\3520\032.\307Y\264[\234^\373;\204\321^\264\033\bXmM\226"
+	.ascii	"\246q\034\267Md\220\321\"\324\267\231\332\267y\332\267\241\261"
+	.ascii	"o#c\337\006\306\276\315\212\255\331\264\0265\232A\267\265\001"
+	.ascii	"\305`\312\3725y\273\005\261\232\201}\236\232\201}\315\335\376"
+	.ascii	"\231z\201\3755\2264'4\210\244d]E\233\t\3278\376\211\"\205\246"
+	.ascii	"\325\324\250N\323V\256\317\364\225\253P\235\246\313\264\231\320"
+	.ascii	"\007\032\373\260Q\234\224 e)gYYX\235\215\324\013l\001T\033\366"
+	.ascii	"5T\366k\304\366\257\251L\321dB\266$I\336\262V\311:\\S\361\205"
+	.ascii	"I\231\024e\375\032'[\035R/\260E\325\206\275\032\325c*\324\204"
+	.ascii	"$7\300d\375k1)\300&X\234H\311Z\212\216r1\241\033\307giRRt4\356"
+	.ascii	"\300\211j\251*\216\3430\r\246F\265\024\375\2453\004\261d\234"
+	.ascii	"\205a\365kt\354\0079\246\362U\217%\250\254m\230Dh\212\343\037"
+	.ascii	"\233\03368n\303t\250\r\323\020o\250\252\004\310TRf\244a\227\210"
+	.ascii	"X\256\r3Kv\330\210\013\226\221Y\033S\032J\207-r\2109S\203\370"
+	.ascii	"$\317\305\332\021\233$\"\230W\223\226)\r\"\222\022\346^<!\r\253"
+	.ascii	"\312\340\210\262\2311\244\212b\003\b\217\254md\330\310\030R\245"
+	.ascii	"I\2555\250@\363\262~\323\307f\310f\310\246\350\205\\\225\351"
+	.ascii	"\317\212\355\253\210M\214\333\024\335\361\250\313\332\006Fp\306"
+	.ascii	"o\206\231#WY\333\274\270Y\227\231\025SY\277\316\206(\n\303-\210"
+	.ascii	"\r\221\215\213_\031\332R\233M\013+`m2\262>sn\237\311f\363c\363"
+	.ascii	"c\263\302HHt\204#M\326\277\215\320mV\004\241hX\331a\225\265M"
+	.ascii	"\320\257\b\224\tM\3266@\277\255\0313\232\242\230Vlb\233\270&"
+	.ascii	"\350H\t\322\n\036H\224\240\244IS\023\344\204jZ%\266U6\226\365"
+	.ascii	"\231E\314\230\251\301[{\301D\225!7\227t\3465xw\352\224\231\243"
+	.ascii	"\206\256\206\256\306\256\203\033\325\224\016(J\2252\257\261\333"
+	.ascii	"r\306\205X\3265u5d\376\273>0rid5d\230,\304\210\251\031C\006\207"
+	.ascii	"\034\225)\225\257\026\322\327\214\021\223\305|uY\222u\215\\\217"
+	.ascii	"\b;d\205\006\312\016[\315\227\232/5a\220\262\221\231\322\216"
+	.ascii	"\0320\257\t\223\301\314a\325\355|\301\301\211\300\211\217\244"
+	.ascii	"^t\210MK\326\337\271z{S{aw\347\353\202#\f\216\254\277\263\243"
+	.ascii	"fK\315\226!\225\206#8\276X\265 \3632\005\217\215\255\246-C\223"
+	.ascii	"\217\235\017\t\206\020\265)\030\026\274;-\257i\023\373]\271\""
+	.ascii	"Vd\311\245f\255f\255%\203!Dm\312*\301Q\345\314\212\232\332\220"
+	.ascii	"\212\254\311R\025\2312/Z\266\254X\251AS\267\342\"\017[J\220|"
+	.ascii	"ya\336\234\256\274\006\r\bw\004\206\343\314\347f\204\005\357"
+	.ascii	"\3545\321\272\"\251\254\277\234\2521\2531\033RM)A\372B\302\""
+	.ascii	"\222\365\2276\312\312\206T-\231\";\264*\2633UF\262\376\262E\315"
+	.ascii	"\224\232)5b*\021\n\324e\br\f\020\026\356\242D\251\021\023\236"
+	.ascii	"\275`2}\202\346\354'\3545bn\221\272\251\020\260\265\245#8\260"
+	.ascii	"\032)4b@Ek\276D\304aY\311\372,\304\355(\013fE+rF\227\245\253"
+	.ascii	"kH\225\241i\225\333R\202T\0254dI\253\314\211\223\232'\352V\\"
+	.ascii	"4\202S\324Q\315\317\223T\r\327k\236\210\301\"\204\212\213\005"
+	.ascii	"&YY5ZyRX\244\340\200\276F\313-\353\r\216\007\026\326\220J%B\201"
+	.ascii	"\302\244\221\002\251\f%\301Q\203\t\023\"\222\fM\253\034\231\022"
+	.ascii	"$&^LXd}\026^\324,\251Y2U$\344\352\347\205\355\207\\\326?A\231"
+	.ascii	"\232\232#5J\226\212\204\\\365\354\322\030\245\325$y\215\222+"
+	.ascii	"\251(\\\262\256Ar\2636m\215\207\216\023\254\325L\325L\325\260"
+	.ascii	"RIYKGS\236H\221\222\032R\251x?\033X\2460\311\372'xRC\244\206"
+	.ascii	"H\r\024;\225\224\265T\345SR\013\203\253)\362\032\250<-O\324\262"
+	.ascii	"~]\320\006\225\223\020\235\021!Bj\202\330#5\242\306\252\222\234"
+	.ascii	"\001\252\313\372'8\252\001R\003dHUEc\352H\325\021(d\262\376\t"
+	.ascii	"\342\032\0375>\206T\031\2248)A\322FBr-"
+	.string	"\262\276RL\215\216\032\0355=\212\370\346\212x\214\351\270\2551uM\257\351\301CK\365\230\262\340\341\244&\205\210\213\321S\232+r5;|,\002\0207\004F\206\364\232$\244\032\034\353\0330\366\331\212\213$P\303n\356\354\247E\244\245\245\306\306kp\274\206)\204\021\036W\225\344\355'\353\232\03355J\217;\022\367bL\32655n\246\324e\372\203\270c]\343\341\006\224u\r\r\227,\307\223\223\362\253\246\250\246\250\346\350\016I\t\331\024X65\026\327\310x\315Q\215\013\037\r\255 kY\327\030e'@\035Z\204T)\263V\254\250\201\221\241\311\247\2565BRB6\025rc\002{\361\032\030\332\212\320\217\257\254_WC\244ekJ\215\3505.\312Du\345e]\303\242fH\215^\255\246\305\337\\\360`\312\372J$\273\005\261\032{%T\315O\315OMP\206\2646\273$\323 Lf\204d\375\327"
+	.ascii	"\251\321\232 &d\320\032<j\342\232\230\210\344\004\013f\352\313"
+	.ascii	"\217\254\257\204\221&M\021\257\005\327j\355\307\216\254\257\214"
+	.ascii	"\357\356\212x\352V\\\244\002a\026\226\335\321\231\027\361Z\254"
+	.ascii	" FRz\f8\365\202\"E\314t\312\202\032tKU=\214\034q\311\372:U\312"
+	.ascii	"\224!\"\271\200T\203n\251*\252\213)\353\353t\025\245Ei\221L\223"
+	.ascii	"aX\215(\021\335\213d\304X\331\300b#\353\342\\\020J\007\036\324"
+	.ascii	"Q\326\3051\217\323-|\\\020\351X\205\tS\024\243T\203n"
+	.string	"\251J\345\0224\306(\356E1XUe\220\262~\335ok\353\252.+\353\353\024\371\362\205\210\244\006\335\322\364\207ff\345K\326\327az{+\302\255I\251<\336\214\272\272\274\b\247^\031\3425\235b\324\326V\334\222a\307WG\260H\207j?\242\214\212n/n\tJ\365h\013\323\tZ[+\262e\330\361\325\224\332O\006\336\215\257b\226\027\331z3\274\300\370a\006\r\255\250\246\222!\265\035U\251>\232@\025I{Q\355\327\264\203\3054\347\r\f\254xv\204)\215\225\033\025\033\032+/\236\231\r\217\2220ae]\254\362\333\372)\301\b\023\227u\321\354feab\210\262.N)R\361b:b\313\272X\246\003\313\026\267\254\237\243\265\257F\213d\301\027S!rY\027\307\324+x^>E\262.\212\251W\206~4\371\204\375w;\260e\310]X\0241lDPQ^\214F)~\365\276\342x[\311"
+	.string	"\263\366\245\221\242Py\311\261\341\344E.'\305\256\036X\374\323\232\231\262\021U\204\362b\327\343V\314x\233\222u\361\311\323\246\214!!\222\3066\361\"\322\003M1\253\230U\324R"
+	.string	"\025\244\266#\027\313\026)XE\350\213Z[d\340|p\352\244\244\212XM\220\232\030\2617\270\324\252\\\275\210\005E\n\324+\353\242\222\"\223\226\n\323\324\031\023+Vj\205\003\256\252\270\004\211\333P\223\254\217\363\266\253~\\Y\252F\013\274\254\213H\212I\200W\230\330\bJ\342\002\213\214X\326\305#7\233kr\244\213\312H\021.<\212T\305)$sd\272\004\177\322\244v\230\025\215"
+	.ascii	"\321\264\350!\027&\353\343H\0312\244\b\245\236!\265\035U\365"
+	.ascii	"\222$\231Z+\362\"\224\030<)4-\353\"\221 \224\332uT$\f\324\307"
+	.ascii	"\213?|\024\203\364\244\3041\020\bP \270xHi\203\017\315g\207\027"
+	.ascii	"\0205Z\f\"f\327UM9\323F\337nH\001\351\321\303g\004C\210Z\225"
+	.ascii	"\326j[\"\315\37285\234\234\206T^\244\200\320\360\224d}\034\242"
+	.ascii	"bS\261iHE\205I\356J\315\314\320T\326\177\253\354\342Rq\251\230"
+	.ascii	"c)\030\004\312\205U\304\361b\016&-\260\"E&\033RG\210\212L\305"
+	.ascii	"\033Ob\2209\222u\361\306Z\303(\213\212U\326\177\267\212HE\244"
+	.ascii	"\242\022\216\337\032\2154ir\016\265\267.E\032/*\025k\344p\203"
+	.ascii	"\272\312\272\2304\264R\247c,\353\277I\366\353\200[\377]\fyCX"
+	.ascii	"d\375\367\251hT4*\036\031%e-\255V-\336"
+	.ascii	"t\024e\274x$\027\254{\302\326\344\305Q\214Q\2141\204S\372\201"
+	.ascii	"\251"
+	.string	"\322\"K\326\177\201\212/\212/\206pTmJ\220\246YboMY?\251\245\330\242\330\242\350\002\212M\222\224\265\264\276\240A\245\350\"hC\314Z\026\264\254\237\374*\262(\262P2\245\004\211\235\372a\344'\353'\227\024\201\212@E!\033\276% \327\031\336\\1\350E!\022\020\315\240\221,r\346\304\2743E\237\226J\206 6g\230\262\356\246\361\020\323\206\034\037:\324\212\361\213>Wc\363\236\2149\021\323\264]\270\244meMD\323\2731\003\314\021\274\337\005\002Q[\233\313\372H\273}\244\264\256\216h&C\223\317\234\002p8u\301s\002\345\243\316\fqj\343\"\006\322\324n\327u)\222V\246\327\024\254\2224C+kb\031\244\033q\fq\f\221\316\227\004C\210\232\016\222\005\206\013\342\334\211tela\262\210!\t[\022\315\372H)D9\242\334PK\226^\032V\323\212\254\217D\022&\f1\356"
+	.ascii	"cLVk.\346\256\304\251aTXvP\262>R\210\bG\204#~\311\320\3443\306"
+	.ascii	"\001G\300\257)\022\037\242\227\023\277\004\215\242\234\031C\225"
+	.ascii	"\365\353Z\255\377n\260*\216\213\215\254o\242\314\226-\3047\337"
+	.ascii	"Z\021\217\261l#,\350\013\221\313\211o\\[\212\370d\375:\237\320"
+	.ascii	"\177\267(\344\023\305\326\3266\204\263\3012\025\t\271Z\271\270"
+	.ascii	"\314\331e}\023_iiD6(\337\221\";\264\351\020\2522RD6b\2269\032"
+	.ascii	"0\200d\2756&\345T\227\365M$!b!\252qA\221\342\223\365M\354\330"
+	.ascii	"7ATVF\274\242n\305E-\022\222\022\262\252U\b.\r\214xv\342\225"
+	.ascii	"\016\254\216\270\262~\035\321\312\177\227\003H\316\310\254Ta"
+	.ascii	"\265\324MA\242B4cJ\0333\222\365M\304\233\312\017\211\326\201"
+	.ascii	"\243\306Y\326?\216\2312\245\303\030\250\244\252\037sR\260,bb"
+	.ascii	"2|A\320\344\320\362\025%\n\021l\t\213w\201\265,\"`RzDT-\210\242"
+	.ascii	"\304\257`\033\017.\\\262\376\221*z\264\321\325EDrC\345\003\225"
+	.ascii	"$\344\201d\026\225\365\217AZZ\304':\3304L<\3128\221{S#>!r\301"
+	.ascii	" \3739\313\232\350\204]\222\245JS\3267A\031\342\226\t\332\210"
+	.ascii	"Y\304\2542L<\312Lu\0132d\200\262\276\tp,YB\304\312\320\344C\267"
+	.ascii	"\001\225\026T\322\n\246\310\227\030X\304\2530O\200\226\020\257"
+	.ascii	"\210LfD\221\312d\370\256\234@\207\254V \241\0303R\352\262\276"
+	.ascii	"\t\\(\271\022\"\022u+.b\227hL\035\251b\237\210\241\301\260;r"
+	.ascii	"\204\210$C\223O\035\233\203\306\324\221M\244\t\357\b\022#T<^"
+	.ascii	"\300\025)B\234\312\320\3443\267\200%F\234\222\334'H\222\260\020"
+	.ascii	"\241N\234\"\032\301\262\025\203!\032!J\001\243\222\330y\221\031"
+	.ascii	"bE\231\342B\214\312bt\030\205\255\220\352\212\202\344$6d\310"
+	.ascii	"P\n'\365\023rvDF\3267B\211A\210A\206R\262\237\324GT\231\254o"
+	.ascii	"\214\"\376 \376 >-i\362\302EV\3267:\365\350A|R\267\342\"\f\310"
+	.ascii	"\264a\3223\027OcH5\326\246Y\337htt\242\322\021\321i\350\245\306"
+	.ascii	"\261R\f\024\024\347\320\001\200,5\354\346\246\361\220\322\206"
+	.ascii	" \330\322\222&\033':\235\210#\204\021\210;b\2309\225\311\232"
+	.ascii	"\230\203\250C\215>\215\330t\350PH\306\"JZ\326/\301\334\276\372"
+	.ascii	"4\266\005\352\323X\"\323\205JX\310\244Y\237\270D\274\361\273"
+	.ascii	">\252'.%Y\277\004_\366=\330[I2d\020\223N\254\361\273\277&f+\334"
+	.ascii	"\262~\t\3326\021\351D\032\277\253\372\210\301\326\226\365K"
+	.string	"\200e\377\304\031\277\013\034C$IH\326/\301\331~\t\246\300\200A4\232jA\026\"(\261\350D#\026P-\270dM\214\001\374\242s+\243n)9C\364\226\365K\240EtAtA$\362\340\250\006\335\222\212#\211\224\023\221\350\267\305\265\245\305(\353\227@\211\030D\f\"\016!\265\035M\311\244\301\265\310\372'\2628Q\215\352\030\033\2225\021\314\013\230U\326D\241\313\325\245i\232\232\321\230\302\004\213\013\342\317\211?\3033u+.\"\301\217]\222+(f\320d\375\022\374\244IC\21434\371\214Q\200U\r\271\034\333\307gh\3110\357\3048\212\2152H$(\233\233\033\342ehZ\303\304\271@\233j.L\344\250\234\371\020/\030&\fR4\353\241\335\360\256\275\3025\344n:4\343\033#\323F&\353\223\200kZfx\2245\235Q\246n\335\201\206\006\023\335\220\214\346\032\273\363\312\372$\240\242S\265"
+	.ascii	"\317\304\bme}\022\354\220\223\033J\227\330\245\032_\224\246P"
+	.ascii	"q`d\322+_\224\260Ee\375\021L\207_\206_\206qJHmG\323\035\337\300"
+	.ascii	"\203\013\363a\234\233f\332v\227\365\020L\020J\025b\022\022\346"
+	.ascii	"\312Z\021\336\035\230.]\206p \2501\013(<\320\244?X\320\004\201"
+	.ascii	"\373y\221Q\205e\205\013\227\341\331\006&\261\017\310k\013\223"
+	.ascii	",7\267\241\026\225\b\005r\203\223\312j\272\362A\305\3066\324"
+	.ascii	"\262\001\023\266\025(\251\241EKv\"\324\004\310\222\037hh\303"
+	.ascii	"\265\fM>s\032(i\312QS/\242\254\r\261\224\235\301\222\2246T\373"
+	.ascii	"\245\221\035\311\313\372#PJ\033\301\320\320\312\320\312\360,"
+	.ascii	"C\223\317\230\rK\244]\216\\\034Q\033S><\033\242\265bG\231\257"
+	.ascii	"\257\241\231\004\232\300T\321?F[vP\371\320,\233=\r\231\221\365"
+	.ascii	"plX\266\311\220\216\260L\031\222\255D\216\344Xp\231\"\266\272"
+	.ascii	"02\245\207XX0\232C\206\233\224!\230>B\305IJ\025)\271*\n\335\031"
+	.ascii	"\257'Y\317\032FQ\267\342\"\016\304sS\3039\2434\254\241\327\207"
+	.ascii	"Q\276\246@\260d=\344\032v\365\340\022\303\"\353!\224\336\227"
+	.ascii	"\250 TY_\004G\206O\206Nx@\201\330\206N\206[Q]\332\230@\207Zy"
+	.ascii	"uI\314\262\276\b\236\366\020\232\241\\\301\322\321\226\365E\200"
+	.ascii	"4\264\032Z\r\261\276\244~=\276\270\312\\}\210\005e\006\214-\353"
+	.ascii	"!\223 T\022/P\226\262\220\316\242R\362\221\365E\300b\210\004"
+	.ascii	"\311\260J\335\212\213T$\244\266\243\2528V\332\240\3169-i\241"
+	.ascii	"\344\303\252v\310\332\323Q\326\303$A(-D\205\327\024\2023SSC*"
+	.ascii	"\t`}I\305JJ\033\206AlVV\352\324\350\220\252\355\bT4\353\207\200"
+	.ascii	"n\b5\204\032Jqy\200\007\310\360\234D}(\205w\267\345'\353\327"
+	.ascii	"\r\235\226\240\351\262\"\353\207@\313\217\037C\"\th2\344C\"@"
+	.ascii	"01\030C\262\036\nQ\247M\300\3408\313z\030$o!\342\204.\353!\020"
+	.ascii	"'\303\034\303\034\303'\263\006L)m\320\340\310\013(=>|\022J\265"
+	.ascii	"\275\350\312z\310c\350\344\2132\002\026#\353\241\216\241\323"
+	.ascii	"\030\2325!C\247\341\216%id\230\360N\300\003\f\226a\323o\037m"
+	.ascii	"\211\207\242\224\224\206LO8\250\272\361!\223\357\213U\213\250"
+	.ascii	"\254\207KC\033!\240\261\377a\3220\311\n\370\203NLF\326\017\301"
+	.ascii	"\212\375\017\221\206HjX\336\212\215N\324\210\032\253R\325\252"
+	.ascii	"4-e}\020\300\355\177x4<R\247\031\232|\346\b`4,\223\004\307\020"
+	.ascii	"5\027.\206F*\b1\020\027'\037\030\275\370\320hXt\244\310\bY\326"
+	.ascii	"\303\030B0!93Y\037\004c{\bcHt5"
+	.string	"\024\372Ph8\244\306q\034+\305>t\034\216\320\310JR5d\361\341\320\305h<\032J\312\262\036\256\bB\2615\236\244a p\022\242\021\242\031\002aH3\374\371\020\b\255\212\221#Y\017}\324\2743>kY\017c\365\212\220i\022\273\254\205yY\b*\311\220\250\254\205iT\271!\225$]\202@\260\342\314\031u\272\306q\016 \276\265\017\234\021\326\t\353\204f\206i\204\323\013\315\370|\334\360\271\022\332\271le\312x\t\355\204e\326\263\030iC\200d\226\276\250\\\311\372\037\220\333\277p\214p\214\220.\205\246\237#\021\314\310\354\222"
+	.string	"m(\031\373\"\234k\177<9\202f\375\017\264\355\177\300J\\\234PnCS<C\001T\220\246\346\246t[c\302\262\026\212\001S\223F\263\376\007\236\354\177"
+	.string	"\312\213\027!\230^P\374C\3447\367\202\311\224H\026\251'Y\013\277|aqR\226\365?\340\264\377\001\031oo\302.\031\232~\250<\220*J\2636\275C\022\215Zi\\\330\345W\3457'\204\267\224\365=@f\377\302\266\250\260M\270\245\027\024\377\024i\321\212\354\320\246>X.\244d-t\273\006\322A\317PG\316D\263\276\007\272\354{\300l\377\302\265\250pM\310\006\202\032\307a\\rhi\231U,\314\022\234\356\310A%\353{`k\337\003B\320\320\204jy+\366\361"
+	.string	"\017\037IUfX8-\311Z\230V\004\254\2124\353{\300\306\276\007\200\252T\021\236\335\025\t\271r\0015\"\315Zh\245\004iVY\277\003s\373\035P\333\277\220\354\367!\371h\250Q!\231\220\212\033\024\377D\371\254\212x\214\331ii\031\223\265\260LMZs\272\313\372\035"
+	.ascii	"\333\357\300\222\375\013\305\204b\302\261\fM1\322\006\254)\273"
+	.ascii	"$S\255)\323\220p\354wf\0029\026RoY\277\003H\373\027~\t\277\204"
+	.ascii	"`\033\232\342\031\007\270\2121W5\235\252\273:\313Z(%\177\261"
+	.ascii	"\253\213\263~\007\200\3669\020\267\177a\227\260K\030ee\247=."
+	.ascii	"1\256\264e-\364Zr\204\207U\326\347@\226}\016H\331\277\320\311"
+	.ascii	"\325\250\320\211\360\311\206\246x\006\tTdQGOB\212\344\t\271Z"
+	.ascii	"*%9\252\262>\007\222\354s\340\206\226\226\024\340\333\226.\036"
+	.ascii	"Y\237\003/\262\262\276T\2670.73XXQ)4P`\254e\375\022^\366/d\""
+	.ascii	"d\262\347T\"4\210K\024\2513&4=\320\226,\361\372M%\251r\313\372"
+	.ascii	"%\306\224(Q\247*\021\n\304\005K*\216\317:\bF\323\226 =A\202D"
+	.ascii	"\r\023\212\301\3066\220D\311\372%\214PQe\241\021j<\344\342\t"
+	.ascii	"\206tW\221\033\262#\353\227\310\021\025%4b\345+\223\227$\035"
+	.ascii	"\221\311Z(\365\203\261%\275\221\365K\274\330/!\264\177a\021a"
+	.ascii	"\021u\272\006\3059\200\264e\222\262\226zbNj\030\311\372$\202"
+	.ascii	"\\\215\n\203\b\207\270A\361\017\021\026\rF\027<8\b\213,k\241"
+	.ascii	"\220\"(\035jY\237D\330>\t\254\375\013\237\256F\205O\302\037E"
+	.ascii	"mTKA6\302td-\364!\243-\214)\353\223(\262OBi\377\302\035W\243"
+	.ascii	"\302\035B\036\275\240\370\007\252\315\021\274b\346\352.k\241"
+	.ascii	"\023\323\024\265\270\254O\302\305\376\nv\373\027.\251Q\341\222"
+	.ascii	"PG/(\376\261j\223^\330\335\005\325\246\202x\311q\241\216_xC\310"
+	.ascii	"\364\033S7"
+	.string	"\214\270,\260\254\2058:\\\230C\270\304\007\007T\326\031\2506l\r\033\021\264\375\013g\250Q\341\f\241R\nM1\322\006,\255\251\244aU\232\2324\353_X\343B\245_\210$\244\361\013\3135\272\024\271\222\2650\251\303\2055~_ih\242\262\266Qm\330\233X\275\300f\250j\303~\005$\373\027\026\t\213\2042\326\240\370g\2100\307\013&\323i\0343u \004\322\322\302\207\326\217\t\332\320\025\241\221\ne{\033b\204\b\f\030-\324:\324\244\305~\224 U\305\361Y\007\303\350\331\2174\353\257\260\264\177!\221\220\210eZ\207\232tW\031\325\364,\216\317:h\355\200\304\320\310\372+\304\373\027\262\020\262\020\266\330\320\024\037\201`\344(\377\3349\021\313Z8\224\213\\\311\262$\353o\200\314\376\006\334\366/\004\022\002\t\20524\375\374D\340\312\f\037I\323,\257\034y\302\240.\"L\270d\375\rP\331\337"
+	.ascii	"t\377\301\274\253\321`\236\320Go\305>\302\037sy9\200\256lE\205"
+	.ascii	"1\335\320\027\\\326\337@\324\376\006l\354?x&\032<\023D\223\267"
+	.ascii	"b\237\241\330\317\035\332nK\323\242L\326A<\237\330\227\222\214"
+	.ascii	"\254\277\001\240\375\021w\373\017\332]\215\006\355\202f\326\241"
+	.ascii	"\246x\306\006+mvIV*hmI\262\016N\245\334\270k\313\372#\340\366"
+	.ascii	"G\234\325\325"
+	.string	"\365\200lh\212\2174@2g\227$\t\231\r\247\254?\202.\032\244\353=\271A\361O\216\266\n\206\020\265\326)\t\357F\326\037\361\265\377\240\234\032\r\312\005\307|I\005\t\343\262\022\034\363\2578\202\322\037\025\r\204\013M,\353vD\221\375\007\303\250\321`\230`\\\nM\361\221\bYGM\226\224\314\304\334\262\016\306\375\310r\023\006U\215\313\221Z\326\037Ac\377A\270 \\\360K\nM\035\264Q-U\371\210+s\221u\320\213\0317(\320\254?\242h\177\004\321\376\203[\256F\203[\202o\031\266b\237V\354'j\003\0320\261\254\203\\6\335\234\\Q\326\037!\264?\302g\377\301\266h\260-\013\365\202\342\246 ?2\032i\322L\343\370\254\003\335\366vV\003\n\026,A6\025\204\030\310M\253\001T\262<\310\266&a\221r$\353\340Z\026\030Unh\300HZZ\360\312\216\343\330\207\030\003y\371\222\322"
+	.string	"\r+V\202Wp\\0w\366\340\225)\2245\262\254_W\202\313\227,e\314\314\202>F\250\361P\031\017,\251TP\2344\353g\200JYY\220G\336\212ex\030\233\233\252r\302\303\311E\326\317@\222\375\007\307\324hp,8\005\0045\216\311xX\t\223\224\344\350\nN\371\357\315\307\205\364e)\353g`\006\030X0L\335\212\213 \300\006\246JU\0343u\240g\244q\321\322\212\265,\260\234\241\201\367\365\365\244\003\310\324\204$L\224(\255\230\272\025\027\221`S\353\200\365y\273;\222\365U\230\262\377 \024(\301.\225\b\215yx\221\212c\246\016\\6\242\035L\255\330QW\030\265\254\257\202\326\376\203\\\\\255X\206&\2379\022\260b0Uzq1\334\242d}\025|\354?\270\025\rn\005u\244\320\024\317\320\300\b[\227#\r+j"
+	.string	"\311\372*\310\330\177\020\032\rB\325+n\034;\005\371\215\251\340\263\257\312\251\301&\321`\023Un\37551\202vp\f\304]]\251b\033\232~\2344\220\322x\253\0224b\365\004\b\314\312\352\313\367\005lH|UUu\005h\027\333\305M%I\022<\242\026\203\342\036aRq\254\326A0\032\345LV\326\307"
+	.string	"\220\375\007\251\242A\252\340\221u\250\351\207\207\002\214h\264UM\343X\255\003\027\307\023\220\022Ti\b\254I\326\307\200\317~0HP\310\203C>$h\344\3048\216\201\3428\007\323"
+	.ascii	"\324hd%\231\306JF\033\376\240\324\203F\\@u\211e\035\214\n\001"
+	.ascii	"\331[\231\254\203D\202P>)\320\2261PE~RKth\346\222\200\356\254"
+	.ascii	"\260\250\022\246\212\223\254\177\201\261\375_}\376\331\370\307"
+	.ascii	"(\216\343\243"
+	.string	"\03646\002\002\262\277z\265\247\252\033\376\240\272\252\005\370\257\177\016LS\304\261\020;\2748\216U2\233J\354\347\206\0061\2068\216e\f\005\305>\352\020\227\223\214!.'\243\342\220\232\223\2148HFU\220S\223:\024\344dd\024\024\373\024c.'\243\241\330I\0061\346\212k\fq\375\370\250CA\261\2148v\212\211\361\320\217\214\230\013jT\034\342r2\032\342r\222Q\034\342\372\2211\0247\305\304!h\017\243\030\352\344S$\342\372\221\021s5\311(\306\\N2Z\fI\033\303\201\035\333\023\224\034\227Y\234jd((\216\001\203\351\307\210\3106\004m\212\341\342X\365Z\021\033\305lq\\\2008fj2\202\373\251\241\216\001\261\305"
+	.string	"\222\362\323\244B\3438\326"
+	.string	"\003\210GS\034\304\346\243\306lCG\232\342\370\b\220N\f#\216\343X\004\037([\034De\363\351\301\024\277X\021\307"
+	.string	"\210\241q\f#\216}\324\230-\216c\2378\216[#&h\034/\021\207\244`\300\210c\245\f0b&\237)+\3428{}\031\2231\304\305\243\251\303\024(\\R1\013\250\217:\364\242)\226\212\341\234\2146\227\217V\374\"\216c\225nK\311\2301\2275\364FII\214\254\301\350\245\254 :\202O\253\2274A]Y\377\0021\366\235[\221]\320IHF%\313\230\254o\201\272\255\304\310\2173YC\243Kj?\262\016\346\270\263Q\003J\326\267"
+	.ascii	"\227\315t\246 \215\257Aq\0161\251"
+	.string	"8V\332\260\372\020\303\204#\353[\200l/-\005ih\220z!We_aA\241U\005\225\266\233\231\247\264\254o\001\036\301\032I4\306\364\210\263CR\243A\032b|Bv\350x\313:(#8c\373X\"\205l\306\021\233D\326\366u\364\213\303qD$+\353\327\005\215~\024\351\302\302(Xt4%BR%\2570R\364#\030\243\035k\177v\234\371\022\034zp(\370B\335\212\213.\340\321\230:2\215c\245\r\304\2372O\202D\017\2760S\241-\264\210\262\016\272P\257\240\335\351H\313:\330\342\267\025\3278s#\353\327m\370\357\016]@)\003\224\365E\234\331?\320N\215\002\355\202+6\3548\350.L\032\307L\035d3u?@B9\356\254,\b\312\265\343\314\022\020\340\231\007\203~\340\024h&\b\364k\322bjL\326\301\037\266l\311\024T\326\027\021f\377\017\306\300<5\032\364\001\242\t\372"
+	.string	"\323\\I\203>@\274\357\322\304\021\356Q!\003\f\003\250\311@\002\007X@\276: 8\240\341]\2328\302=*\f"
+	.string	"f*5H\276\314\034\345\223\331\003\314\220\241\370\203I\234"
+	.string	"\2779\302\353px\352\300\307\035\246\362\350ta\246r}\276\314\023\204*\226<\357\n)\232%\024a%S\004N\217\211\347&fP\301\323\004\221T\362\bU\3604\221\027\\'\205\223\347\251B\ng\361\006V2E\b?"
+	.string	"\340:\034r\230\312\025`%SIl\226\310\t\202H\036\233\313\233!\n)\224'$\231\037^\370\230T.\217'2<O\020\302L\021I%O\360\367\222@\"\217\030\236'\350\300J\017`xa\245\023\305O\005\r\2540\302\004\023\222\307\327\351S&MPqTa\304\013\037\227=\310\345\021\004\206\"\233|2{lT8\217\316&\317\316[\242\204"
+	.string	"\220L\025\317\017\357\363\3504\241\370,\216H2\225'\300\357s\347\335a_\026\216*\374`$\354t\341\227\004\022v\262<O\025\236\276\347\263\270\343l\3420E`\200_\022O\021O\341\021>\206"
+	.string	">\201O\345\323\371\362\020C\360\300\200\016?\0228\220<\276+\340\364\230x\372r\230J\246\362\270\363\256\360|a\025%\340\364\230\020\241\205\345\007H\330\310\024\241\205\345O\204\026\2265\357\211\343\363F\007V\2420\036\221\315\345\362\030"
+	.string	"'<\002\247\307\304\263\205\2159L%\t\234\236\022\336d\023\3114A\303\207\327\331\204\237\257\323\310\002\362\b?\215L%\274T\366\2300\0321<\227\313\017;(F\3604\341'\361w\035\016\3167yl.\341f\263\204f\t\f\311\246\n'\260\200<\362\330\300\306wG\t\377\336\035e\211#\274|C\260\360<\226\200\337\034b\253\001\004\374\346\020\340\003\374\346\\H\276Ne\017\n\336\025\3407\247\370\344Y\036\221:\360q\347\003\370\311l\"{80S\351\\\262\317\027\205\035\024<\300\024&4K8\233pS\205&\362\202\035\020\313\017\027\\\207\303\263\311\323T:\217\035H\276\360qG\t?M\200\337\234bRD\212f\t*JH\321,!\311T\342\b\337\245\211\343Ry<\361\001v6G<E\3544\231o\210\027>\256"
+	.string	"\277(\334\300\257\021\005\370\315\271"
+	.ascii	"\373B\300/\nH\330)L\276\260\363}2E\024\227\307\023l^#\206w\251"
+	.ascii	"<AC\362mA\271<*a%S\304Sy\363\032\203\316\246\323i\002\374<b\300"
+	.ascii	"\346:\034\220L\025\317\343\007M%\002^\344\221\207\304\373:Ox"
+	.ascii	"\3664{r\224o\216\361\211\003\037q\216\031\300o\216\261\206D\215"
+	.ascii	"\n\021/\217\212\022*JH2\225'dx"
+	.string	"[P\222\200_\024\340\027\205'\216\363\330,\001~s\200I\025\3407\247x\035\016\317\013`\343\333\202\362\311.\227=Lf\223\331\242h:u\340&\263\3059\276K\375:{x4\363]:\341'\233\303T:a\022\303\353ph\3420\225F$\0163GI\002~s\200G\370\030\"\250|>W\200\337\234\266Y\342\331t\"\225*\330\274\306\327D\3239B\b\303/\n\305\353p\370\340\027\202\007\033\025\310c\316\213\001\370\315\301\240\002\374\346\374>\300o\316\3575\n\207\360\233S|\215I\021\260\221\370\032\223\"\340\344\361]\201\310\200\016@\0228\360\302J\247\007pzL<\177\260\222)\202\347\271\323\026s\234\037t`\245\0072\260\321\220|\257\303\341u6\221\037 q\226\315\024r\216;\355\3575\362<A0E\330\234p\002\317sG\203\212%\317\373&\233*\370\230'\254\300\363\334\371\275\306\013`\"\006p\021\306"
+	.string	"_\200m6\200/\3005\360\005"
+	.string	"4\231*`\345\362\330\203\202\232\244\362\304s\310\324A\032\2338L\345\211\247\221\304\b\024\204: vz\230F\022#Pp}6\357N3\205f\te\322Hb\004\n50kt~\200\304\201\217\360\323\007\023\341\033\270\346\315a\036W\300`\203\347\273s\314@R\311\263G\024Ah\200\211\260\r|\0016>\235\357\262\307\204\013\033\036\036\341c\b\244\223\355\221\330i\302\317'\0068\347\270\263\302H\344q\275\016\007\002\214H\036\233\0308q\314\300\363\334\271I:\217 B\220\b\200\212%\317\273\302\021>\206\020"
+	.string	"\0012Pqt:?\024\200\347\250B\b\021M\030D\210\017\027<\223\"@<\223\"\206\035H\276\260\263\311\303\323\363\004\300\215\n\236&\210a\362U\3624A<E\260\360<\252\360:{\340\343\213cs\035\016\037\364\224(\300\316\246\316\223\370\356(K\274\3601\204{\035\016\357\3161\003\276#A\300=\032"
+	.string	"\301\363\334\001\300\221J\347\313|s\366E`\200\007\f !E{\022\036"
+	.string	"\302\003@`O\302\003:tx"
+	.ascii	"\003:\3543\240\303\n\303\031\340\f\3240O\030\221\242Y\302\333"
+	.ascii	"\202R\303k|\346\034\227'\274K\023\307\2472\304\315u8<q\232\312"
+	.ascii	"\247\211\017\311\343\273\302\023G"
+	.string	"\b\277\311&R?\215\030x\223Md\013\204\215\300\016\020\337\245\211c\211\023\354k|\223M\025`g\223\307\367\0325"
+	.ascii	";\233<\301g\263}\341\343\n\311\236\243\211"
+	.string	"\375\266\240$\361\266\240$\261\341\355\004&\217o\nK\345\261\204\363\305\301\351)!\005\ft\302#\336\023\312\027\371\256\220\301w\204\217!X@\036M,\227G\020)\234\302\327\230\024\301\302\363X\002\007\351\253\201{C\370\206\204\r\334\202rG\t\363h\300\371.{\222\257\016\362ya\347\205\237*\236\302\341\no\361M6w|O\244\022~*\341#\f\017\237\315\021\fx\341\243\363\002\013\310\346\022\331\303\203\f\"\217N\024>05\340|Q4y.\030\266\240\243\302\373\324a\223\257\263\307\347\204G0\341gs\004\317s\307\346i\004\302\327\271\340T&\335\247\021~Y@\036G\360<w~\360u8\340\364\230\3309\276N\370)\200$\363]\237F\234\036\023O\326\t\363\2548=&\326\344\016r}\346\034\2278='{\035\016/|\204I0\217;88=:B\346\013\303J\247\007\236/\254\302\004\360\205U\224"
+	.string	"\3674[\346\213\001\234\236\022\340\236\246\013+K\200{\232\354u8\274;J\370\003fsg\247\211\334Q\226x\341c\322\370s\036_\025Z\007f6wz*\216\311\365\351\354i\352\364\236/\334\303T\356\264\317$\263\211|\237\355S\271\\*w\330\353p\030\002\207\304\340\273\344\3319>\213Oe\223)\\\276'\2148Hc\323y4\361K*y~\317gR\311Sd6\2250\363=\361:y"
+	.string	"\240\301\361e\341\b\033U\034Q\034\231=N\003\300\327\341p\342M\346\360\364B\244x\223Le\357\331S\202\222\347\311\346\034K0\237H\366\331S\0022\004\345\007d\bJ_\316\261\204\022N\361\266\327\341\320t\252\310\001\226xO4U\320`\247\311|\223F$S\305\023\207gi\f\276\317\036c\023\376\265\2403lA\207\330\241C\b\306\026tnB0\3028\315g\006\024G\025\306a\260\370\362\250\200k\212(\216*j\230&\224\313#\210\246SE\016\006\033\233\241\016\234T\242\300\200\202\037SE\222x\001\322Y\263Q\034U"
+	.string	"\213o\016\363\250\2034&\227M\035#\274<\336\2408\252\270\t\341\201\210\242\271\024\352\344(u\206I\017\313\243\023\356y\231n\322C\222y4\221<\276I\033\024\315\345/\351\001\230\364\220|\207\327\341@4\362\264H\344\321\230t6\221\257\323'\204\257\303\341\203\246\022\306P\303\302\363\250\002\263\007\007\370\032E\300\316\346\210\013\234\257\022G\t3\337\244\322\307\363\334y\341\2433\331s4aL\3214\301\002\362\2704q\301\323\331\344\371\365\030/8_\030yt\036u\220F\270\3314\361:\2110\317\013?\365\t)\234\032\336dsG_\207\303\007\031\020\213(\232Kc"
+	.string	"\20488\315\347\315\353\354I\276\310\246\223\247\006\003\013H%\3744\2768\307\347Ry\304\311p\035\016)\234\037\344\360\330\244p\372x\216;Hg/\371\246p>\213)\336%OO\b\234\345Q\307\367&\225N\347{\242id*50\346\364,y28\223L\245\t#||\032wz\2340\013/\3173"
+	.string	"\300wyD\372`\347{\202\251D:\223\312\235\036S\271\263Y@\276:\310\024\307\235=|\202X6y\220N\f;G\020'xpj\224\307\fL%\362}\366\244p\376\214)z\216\306\024\307\235\341\363\302\357\345Q\001\0275\b"
+	.ascii	"\303{\302\371&1p6a\344\021\307\230\303T\352\300\315\346\316\323"
+	.ascii	"\210tf\340yw\216N\034#\322\3714*\237O\247\206\340\233l\252\340"
+	.ascii	"\032\237(\216*\214<\312%\016\206\013-\350\030qx\226M\347\033"
+	.ascii	"\002$\362\330\302\316\027~w\2325=8o\322\bcx\352 a\345\210$\363"
+	.ascii	"\303r\331t\332\204 \361\344\311)\302; \340\345\261\3674\"\233"
+	.ascii	"\030x\362\344\004\341\343re6\227\253\316r\271&\337\227\207\304"
+	.ascii	"\357}:{\232 \222\314\236\2463\007\310\323L\352h\370Hb\247\207"
+	.ascii	"\311^\207\303\223'\347\203\246\222'\347\367\032G<yr\202\3167"
+	.ascii	"\251<\321t\362\354\327\350{\223M\025\236G\023\317\375\032\207"
+	.ascii	"M\270\347\350{\215\037\236<9\301d\317\261\204&\334s\334\315w"
+	.ascii	"\251\\\036s\214\357\263\347\302\213d6\215\357NS\307\b\277O\f"
+	.ascii	"\360\t\036\343\211#\263\005\035c\212\346\322D\217\361\311\223"
+	.ascii	"S\034&s\216;\356\353<\242H:\217:\306\234\343\016\360'4\"CP\032"
+	.ascii	"s\216;C!\363\2114*y~9\307\0220O\217\023\b\303F\2347\251\341:"
+	.ascii	"\034\002\320c|\356(\235%\236H\345\316\221\251\"\304\205\246\363"
+	.ascii	"\rA\316q\247\275\016\007\347\233B\271\003\200 \f\033\333g\316"
+	.ascii	"\261DS\311\236xC\274\360q\005\340\262\211l\302M\347\b\"\263\251"
+	.ascii	"|:\337\023L\021;(\212;(F$_$S\305\223\311\201\367\331#\204\237"
+	.ascii	"\316\236\022\336gOP\205\023~w\336\345[\002n\352<C\274\317\236"
+	.ascii	"\342\333\263<v`\231\024\261<\302\312\034e\362\002\246r\347\227"
+	.ascii	"\342\270\363K2\217;;M$S\271\343{\227\315\021B\3709\200\242\016"
+	.ascii	"\022V\242 \221\242\347xa\350|a\346\013\002f\276;\360\263\347"
+	.ascii	"\004\311#\021\276\016\207\024M\023\306\244\b\230\3712\217;\316"
+	.ascii	"\227\347\3674\246h\232\350\365\336\235c\006R4M\264p\263D\362"
+	.ascii	"e\201\251\\\356\2471\311l\2028\241\204\221\037\336dsG\303kL\212"
+	.ascii	"H\3214\321&E\274\311\346\016\233\342M2E\244\3509"
+	.string	"\016\341$\363m\237\3067\207y\\A\310\363\302\356\233\303<:{\257\361\207T\34641\360&\233;\356\3238\"\251\344\001\266\240cDqT!lA\307HlAG\007\t7\231\360u8$\225<'\250O#NR\311\303\216PE\250!\324\244\222g\205\231\312\346\b\236\236$S\351\001\f?\024G\020\364\220H*y\204L\245\n\360\207\244\222\207\370\236x\227C\030\371\342\340\330\300\316\227'\305k\204\227J\330\310l\266\240t6u2\274\311\246\n*`\345\211\243\023\005%\314<\016K\\\300T\036Qp6?\334\254\200\342\250\242\370\302G\2470\231CL.\233:\317\327\251\003\033\341\367\231\341\335Q\302\276\337\315\013\037\235F\233'\363\345\331i\202H*G\300G\023'J\234\220|_\234\013(\216*\214C_\013:\306\020\236\317#\017\212\346\262\250\302\371\236h\"_\247Q\347yt\"\205B\370\331l\232\270"
+	.string	"7\211\312_\206\2472\305\321\230\323c\342Mb`*\2179\305\347\2161y|u\216,4\233K\243\363e*\217N\330\330t\"\217\032\230\312c\016\261\350l:\235/\006\244\361i\342X\023BM\013:F\246\262\005\035c\212\343\216q\307\371\302I#\016\317\322\310T\221\274y\223M\025J`"
+	.string	"+w\224\030x\2279\314\017\030\230\312#\nE\370}\276+8\337\234\034\245\263\004\212\346r\371\001\204\016\222\331s\\\n\300\370>{jR\034\227\257\323\210\342\250\302\230|\341\2433\347\205\231\312\233\026\224\316\343\313Tb"
+	.ascii	"~\3668u`\233\036Sy\314\361\275H\346\361D\362hd*w\214\311\240"
+	.ascii	"\263\t7wj\226\313\027i\304`\204\231\257\362\311<:\341\f\360u"
+	.ascii	"8,\233N\370\3359f\340]*q\232N\236\037|\\\301\206\204\244R\005"
+	.ascii	"\247\016\334"
+	.ascii	"\222\320\344Ia\202S\007\336\317\347\013\037W@:\333&O\n\023\220"
+	.ascii	"N\366\371\302Gg/\204\210\021N\235\022L\025I\027f*\233<,\034_"
+	.ascii	"\247\t\343\221\007\026\276<*`\033\036\343\022\206\233N\035\370"
+	.ascii	"\002X\271\243\\\032_\370\350\364\275\311\246\nG\036\270\355\331"
+	.ascii	"Q\376x\224,\030w\220I\366]\3460\217\306\345\362\270\363\374\275"
+	.ascii	"\311\036X\t\303G#\374<\342\004\257\303\341\271l:af\023\231\303"
+	.ascii	"T\3568\217\302\035\347\321\b?\235J\034#\263i\\\036\221\306\246"
+	.ascii	"SE\316\005\025\307\345\2334\3568\217Oe\322\330\204{\216\305\353"
+	.ascii	"p8n\3604\302\314w'\351<6M\020\227\313\246\363\007|\276\2573\347"
+	.ascii	"\r\201\342\250\302\207\342\350\\\257\303\241gG\231a\271l:\265"
+	.ascii	"\016\022V\362\364P\034U\254\317\267gy<\301^\207C\n\347\007)\234"
+	.ascii	"\300\027>\256\240\363|\2358\357\n)\234A'<\202y\302\021>\206@"
+	.ascii	"q\\\301\371s\302#j\230'<{\340#L\002\351\034:\341\0216\357\216"
+	.ascii	"\022f\366\254\220\302Yd\236\360\356\034\235'<\237/\262\351\034"
+	.ascii	"\201t\022\217\3601\304\357\b\037C\274;G'\216\013\033ags\204\006"
+	.ascii	"vP\360\f\233\312\f\033\235\357\216\022\026^\207\003\334\303\003"
+	.ascii	"\3674\215;(x4PAD\211\337\216\022^a\343\n @\354(\341\355D\"Wd"
+	.ascii	"\373.\217H\022>\r\274\317e\017\317\017Es\211\343|Oh \230|\227"
+	.ascii	"&\216\314\267\205S4M\254O\243\363M\241T\001~s\234G8\b\367\360"
+	.ascii	"0\225\277\344\373\362<{\360u8<?\200ur\224K"
+	.string	"\234\345\313d\036u@\3544\235'$\235G\024\316&N\315\323\270st\036G4O8\337'\360\231|\237\316\367\304\353\0342\225;k\212\343\316\372.\223I\345\016\313\276\360\321\251\257\303\001\371\001\022\007\003\334\\*y\202\357\316\221\251\337\235c\006T\034\227<Oe\362w\035\016\317\347\221g\247\211<\356\364@\204\370\220s\334a\231\312%\362\r\201T\302/3\347\270cs\035\016\357\362E\"\217\005x\032\221\310c\017\276\016\207\0038\337\345R\211\303\302Cc{\035\0160\262\307\t?Cx\032S\274p\317N\221\005dsi4\262Fc\353|\231(\232Fc\373t\276\317\036\246\321\270\223L%\013F#\373d*y\236Fc\273|\215F\0276\302O\345\222\310\243\002\366 \371:\217:O\017>x\302J\023\037\3640s<H\321\303T.=\020\201\001F\006\220\220\342\2037\331\263D2\225\0378\237=\0378"
+	.string	"N\3612\227G\246\363\205\231Jc\362\370:u`\036\243\021\303\211\327\311c4\262\360S\2714\032\331#|L\032\215\354\333\202\362i4\262, \233K\215|\235F\037\254d\212`\236"
+	.ascii	"+\231J\326\t\217@2{NH\036\337\025\220\310\0177O\343\2117\004"
+	.ascii	"\022y\334\314\023\222\307\327\311\302O\243\222\207\004\316\033"
+	.ascii	"\342\345QQ\302(b\004\211\337\213"
+	.string	"d\036\341'S\271a\243\006Dh\246r\004\363\211d\225<\317\365i\004\021\202\210\037\210\020D\270,2\004\345z\035\016\317\036\023*$\211\316\027~\036w\330\347\363u&\223\307\366=q\\\222\350\341\331\331=\306\023o\362\331cb?\215/Ry\342\r\361\3541\361{\215/\217\212\022\317\036\023\356\313\243\002~\366\230h\237=&V\024:\030\221\310#\213\342\270\002\210\020\037X\370:\034zxv\214M\247\212\034$\362\250\200\327\270\002\b#\200\300\200\036\236\035\033fS\t\367,\233\317\327\351{\032o^c\017\317\316\217\205\227=\317w\205\027~C\364\360\354\324\274Ff\216ry4\n\2319\312\345\007$\362\270U$\217\357\nG\370\230t\235O\034\243N\216R\307\210D\036\201o\262\t\302\t<\361&\327\345\361\204\363\205\231\"r\230\312%\317\316\221\004\022y\264\001\021\342\003\022yd_$S\003\360\363\370b"
+	.ascii	"\376\220|\341c\222\207\003\313\027\211\374\360Tj\270\016\207"
+	.ascii	"\347\233l\356\030\221\316\017\2208\032\236F\026\236\307\035X"
+	.ascii	"YB\212\246\t\340\023V\232\320\360u8`\240\0033\233*\f\237\306"
+	.ascii	"#|L\036\341W\205\244\363\210L>\211O\026\220\315e\t;=L7\204\210"
+	.ascii	"\235\267\331\013!\302\371:{`\344\021\247\207y\334\021\276;\307"
+	.ascii	"\f\374\226G\245\363%\021t6Opl2\225*0\233\312\247\362\304\273"
+	.ascii	"\302\215\363\370\202\200\331T\302\310\236d\323\311#\204\257\303"
+	.ascii	"\341\203\247\363=\241t&\223\314\327}\032\231M%\254\204\235\307"
+	.ascii	"\021\304\227G\005\254a\243\316\363\270\304\t:\2330\362%\001;"
+	.ascii	"\217\360\363\267<\366\300Ne\0070\350\301\357\023\007\247\311"
+	.ascii	"\302\316W\271\344Q\302\313\236\235\033\020!>\220\310\360.\217"
+	.ascii	"\310'|4q\302]\036O\234P&\237\257\363:\034\204\033~\276\360\021"
+	.ascii	"\003o\316\321\371\362\354\034\205-\023\305\321\031B\347\303\316"
+	.ascii	"\276\016\007\341N\276\316"
+	.string	"\027^*q\230=>\034\234&\334\003\242\003(\232K\342u8|\360t6\237\314\367\231\301\323\230\243\304a6S\034\231\312\235\032\0240\363}\276N\036\270\311\204\217&Nh@\236X\006_c\315k\274y\221\316\236&\t\347\013\277*\300\314\327\351\354A\326\250\200\225\310#\317\321\304\020>\226\320\201\367\331\023|\302\316w\371\001\304\373\354\271ys\2160\363E:\337\021\314\246\022\346\331\351y2\233H\f\236\312\347\353|\341\247\n\035\370h\342\204\02062\240\303\233s\204\227\315\023\313\345\213\\.{p\340\243\211\02360\263\247\tb\271|A\250p\2760|,\341E:\2338\027N\004\223M\245\363\035\201\303\203\001\370hB\031\314a*\231\316\243\007.\200\215$\300LeO\273<\"\225\260\322\t\302\331<\201\331T\302GgO\b\370h\342\004\206e\263Y\202\261w\035\016\037$\227\312\036\023\001x\223\347u~"
+	.string	"7\233\316\017~O\243\n\347qg\247\207\3043\207\251\334Q\302D\230\331\323D\366\230\312\235\234\023\307\024\307\235\021x\\\020B\360"
+	.ascii	"3\225=\373\371.\221*@8\300\001<.ld@\007\230\251l\337\241\003"
+	.ascii	"\b\r8\220\001\0246\222\003\317s\347\003\236\347\316\007L\345"
+	.ascii	"q\347\003\244\363\371\001\207\033\347Q\007\251\377_8\0322\371"
+	.ascii	"\330\310\254!\2211\034\302\341\003\2653\032\022!2b\006IQ\220"
+	.ascii	"\3557\206\313RS\214\240\021\335\344\312\326\013\030C#\017fO@"
+	.ascii	"\027X\\`q\201H\214\204\013C\277@t\301E\206\263\302B\306\005\027"
+	.ascii	"\027Z\fs\370\310\372\3223\342\244J\325\335\376/\254(\212Y\313"
+	.ascii	"\216\344\240\\\020*\342m.GZ\204.\004\025\311\204\205\341b\343"
+	.ascii	"\002\020\214\241\023h\216\260\013?GJ[\230$\271\340\243\315\332"
+	.ascii	"z\220q\271\020\327\340\020\262e\345\005\311\253\351\241#+\bX"
+	.ascii	"\232\032(\341\327\212(\03145J\204\004\021r\302\253\321\322\\"
+	.ascii	"a\314\2409S\363\304\354\313\007\310]\rZ\031\215&f\332\364\224"
+	.ascii	"\266\025-\246aT+Y6\304\330\211\345\034d\356\246e\306\254IuU\342"
+	.ascii	"\352\354\310\324\340\321\305h\222FW\0234E\343\322\"\353\033\351"
+	.ascii	"\315\230\337\314\375f.\337\314\255yy,\326\226.V\337|\271\371"
+	.ascii	"r#\306\013\023\230\337\210\271\211c\361\244J\221\270\2330De\244"
+	.ascii	"p?\254/L\266P\320v\263\345f\313\r\334\025.\277\201\273\351\202"
+	.ascii	"\343\211\225\\\227\233\267,\250)i"
+	.ascii	"\321\325\r\013\020/\024l\335\254\335\254\335\264\31591#\275\311"
+	.ascii	"\362\233\266\033-\352\020\037>\360n\264\334\260\t\305\230\375"
+	.ascii	"\330\355\026Qt\310\210\2729\2739\273Q\363\"a\311T\223\245\233"
+	.ascii	"+\277Q\273I;\321#\310\306M\332\r\332\206\232&Ye\027H"
+	.string	"\246HP\220tSvSvS\345\304\237\265\337\230\375\246\212\232u\306L4\353\033*\277\255\036\r*,\300\360\340\335\200\335\200\335Lq}\3000\215\335\204\375f\312\315\230p\313\r+Ln\306n\304\324\242,bQ\2003\320\276p\251\355\377F\312\020\350H\016\0323\276\212[6\032\024\322R\264\b\367&m\032r\343\265\231|!\361\312\372<b\373j\364\246\353\211\251L\r(6+T%Rb\356\236\b\315\370\236\304\250Iq\331\024\365l\270\240b\344\244\310\246\257\234\241\363\331\262\2612\005u\344\206\026\361J\360JmI\023(\2350H\233\225\274,94<\234\226d\r\225\022\024\203\004\351\f\226\020\314\f TP\256\210l+p\030Me\355sB\267\244\206U\227+Q\\\322\226ly\241\365\023T\305\326\226c\f\233\022\265\026\272\204kH\022\341\331\360H\334\223\023$\301+\300\261&t.\216\020\337\246\374"
+	.ascii	"\343%kh\253%7F%\353\033#yL\016\250\024\365\211\324\031+)*M["
+	.string	"xBQ\300$\276'_\316\250A\215\r\247\200\232\250\025\001\323\032\213:\311Z\310&!\302b\312\220(kN\256\f\021\022\331\352\332\221\265\206\365\314J\221\027@\236\304_\222\312\374x2\022\306\304\207\221\230j\313\221\254\201\244x4\262\356\2259\301\221\226\265Q\023\323\213\254kX\215Ar\263C8\244\210\225\317\213&\341\217\370)\326\301\243\307\0134#9\204:\270(q\351\222\265z\265\305\347.k\350\225\217\020\250\233\033\304/juZ~d-,\022#\b\016\033B\245_\336\0202N\224\2042v\024Q\342TC\330B\f\215\254$\241%\\SP\262\006~\211f\251C\022\372Da\321h\233qb\334\021\034\224\243 \032\016\246>\266nd\004\315\250PtD\2447FD\272\001\334\240*\273)2\363E&\017(Fp\214\024.\271.Yk \264\031L7/\202qC\242\206\004\335\020\001\253\264\344\035}\271"
+	.ascii	"f=\315\316\302nZ\004\277D\241\261\002\312\315PQ(\211\t\316\005"
+	.ascii	"\364HW\325\333\n\037(\323\260\243\033\241\340[\024\225!\240\233"
+	.ascii	"\240\242\213V\215\006t\352\006\250x4\204kzzq\363STz\222\003K"
+	.ascii	"\314\215\317\025\035k4p\334\304\305\034\\\230\246\324\262\266"
+	.ascii	"A\243\332\240\031\016q\345\331\244\271\r\232\233\340\005\217"
+	.ascii	"\027\254.S\306\346\314\224]\222\251\335m\316\334e.\247\026W\356"
+	.ascii	"\314l\275\330ae\027D\215\356k\352\316\001\355\300\330\362\222"
+	.ascii	"\310]\316\206\214\252AS\034K\305@\\\256\244\267!cC\327\003\256"
+	.ascii	"i\t\235\315\\\225\256&58\261\237\037:\262\266\031\323b\231R\341"
+	.ascii	"2\204\347\t\016\316&\256\n\004,\255\251$/\267\211\263\t##k\216"
+	.ascii	"J\030\0330K]I\242Q\365\311\n\213\243/\355\226jd7\203\013\317"
+	.ascii	"\013-\327b\363\266AP\034\257\210U@\361\370\222\266\335\346\215"
+	.ascii	"\013\260\312Y\224(.[\\<\034.\252\334z?\256\017\037]b7m\247\303"
+	.ascii	"\212\342 w\033\r\315&\013\220\r\262\216\232,\245\335&\213\315"
+	.ascii	"Z\025\023\2475\033,>:\256L\307d\"cU\304l\3244\234UT\224\220\230"
+	.ascii	"msF\025\306-\3537\265l\242Y\325\2237i\225\240\217a\r(5\226\330"
+	.ascii	"\230\005y\204uiQ\tN\021\023D\306\226\262`X\366\3226]Af\243\304"
+	.ascii	"\367e\005\3525e\030e#m\351\3426f\223$\b\205hH\223\330\320\214"
+	.ascii	"\315\213\302\302$,\330\245\336\320\321\002\013\330p\315g\325"
+	.ascii	"\344\303\205\224\240\016&wBV|\r\341\240\240dBQ\033$\300.>\210"
+	.ascii	"\220\211\202\227\201\017\260\330+\376-au\311u\r\265\260/\312"
+	.ascii	"\260\224@\031\236!\200\305\213\261'D\242\241\364\f\030\016.\242"
+	.ascii	"\021\020j\355\t\026'\304'\036Q\200$\261\331\":\215\025eA\321"
+	.ascii	"\n\036\021\276I\361\300\240\300\"\303,[h\306d\021\207\246V\230"
+	.ascii	"I\311\272\252\312"
+	.string	"\006+j\001J\232\300TYr\033,\233+\350\233\324\333\225\r\223$m^\322\\i\237,\021\023\315\332\306*\223\005\255\264\240\002%\272\207Z[jII\307\020\354yI&z^W\270\340a\225\365\220\314\3256\325\355\232.\013\210-k*\252\241\364\304 ?*M&6El\212\330\030y\315\317\020\337\032\2163F\323X\ti\303o#u\033#+\302\220i\313\332&\352fg\242dm\311\332\006\252\231\264\177\033\"A\332\326zt\r\t\256\320j\241\305-\013\261\331Q\346m\310\212M\220\"V\230&=\200t\005\221\004\225\021\375(~\265Cd:\250l|\024\317\242S2a\371\251\b\025\214\302\362\003\250\007\326\032C\211\034\013\036E-]$\n\033\031\247\242\332\215\217\034X\326\305%Se\200dm\243c\255\313\033\\\326o\036\355\337&\2256\250D%\017\325&\225\262 \207\362$\346\234R\016Q\021m\202"
+	.string	"\343\025"
+	.string	"0X<\030\215Gde\264\335\024\200\020^\260\200lJ\245\016\324(\252\0243# \003"
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\004\002\b3\375n-\004\344c\bC9\334\032J\304\277\226\303\312\237\335\013MN\331\035\301\007\201\344D\275\2274\225\263\255\340M:\205\266\275\027\350\257\345\276\001w\227\016\227\360\342($>\032\232~R\f\266\256\220y\261\270hm\017\376\231t\232\021\030\362\022m\272\2257\206\020FB\327\005z\262~\007E\253\373\201\205\264\333\351\270\003\330'L\360\220W\237\223\341\347X\221\321/\341\356F\207*\252YG\347\304"
+	.string	"\233R\f\260\022W\337\037\260\222\0338\301\345\273\215t \003\016\273\331zoq\2700$\304\006\265\265\223\255\266\br\023\325\336\313\322\0031Hd\277\245\n\357EV\301\210q\006$\322S\021\003_\337P+\257,f@\315\002\234\302\243\335$\232e\035\355\r\300`D\271%\211:\232!\033\202\253\216\026\n\fT\302\322'\244\350\036\363\250! \255\347\320\020\023\341\375:\270f8k\035m\372\273 \263\203\312\371\322z\214\021</\224\267^\373\357\254H\350\201Ap\272\030\333\003\251\314\240\3365\034\216\241\035\377\037\220\337\245\fve\330j\365yT\246x\313\350h\210%\351\207\234\225\213\022\022L\262\323\247"
+	.ascii	"\223P\033o\262D\272\f9\322C\252aV\005\205\031|\301\255'\376\226"
+	.ascii	"\310\305\234\355\034\272gI\257\344\322\211\233\363\321\353\275"
+	.ascii	"d\300a\350\322Y\362\246\364W\034\322t\342\2120%\201\357\345\004"
+	.ascii	"e3\236\221\016\276[\217\301\321\016z\365\222\206\273+\033\016"
+	.ascii	"Wf\322'\324<(\003\270X\331Q\302\235\317c(?f\256\3037\r\237\322"
+	.ascii	"\247\322\254\206\035\251/\256\026<=\267=\232\370}Oj\"\350\326"
+	.ascii	"\347\321<\221\313H\314\310O\362\266D\334\254\3462\361M\240\344"
+	.ascii	"U\341\327(+\0343 k\004u\245\320\344Ja~Z\234&\026\234\257\204"
+	.ascii	"\3125\016S\254?\360\ftr\004\241R\234\252\242e\275V+J*\240R\377"
+	.ascii	"6\353\212\240\202\246\232\t\222\217+A\341\234\365o\205\203\377"
+	.ascii	"K\016\351\036\244\327\0375g\f;5\267,4i=h\213\027,-h\300\256"
+	.string	"\342\211.\032\272\320P-\f\264\263r;|\021\301P@\316,<\216$\303U\211\373U\201\334\3751\324\017oe\261\334\001N\274V\203]@\260[\034\321\220\246\212?\350\241V\272I\020\246\264vt\037\250\001\347\220A!\3139\324\t\265\037VF]A\230+\0305Q?\320\363\272EpcC<\273\235\026\313D\016\334\"'A\333\332$\2402^\035\303\356\321\304\3729\004\337\022\334\003\242-\310\255\035\201\3606'ce\227bc\206\022\321\231>\304\3119\3011[\272\034\236r\316\275n\257z\007\305\351\204\033~\026\003\031\321\257\233\027\300\217\351\246!}Q\030;X_E0\200i\177\271\266\301\377\230\214\247J\310\306\304M\301\311l\202\232\253\261"
+	.string	"\343\303X\346\246\321\301)\343@d\256\351\b\n0\274\363=#\017\262\340\3715\017&\262N\343+\372'\247\241\027\364\311\013\005\245y\263\227'g\024\020\373\\.B\242\352\360\237\371\323\360\212\316\246$O\251\273\355\253\370o\254\365x\322\213\007\360(W@\271\362\310,\222\233\337\2631\2471\2571\274\347\240\336\030\f}\006;\254\346\\\217\277B\245C\376\\8\021\352cx\343Z\346}\025\267\274\177\256\312\304t\3741_\006M\013/lN\354a\336<\367KP\021.\303\321\177\221\016'\226\227\rwu\220#\3704}\021\377\226\256v92)\223:\316u\037\214\365\303+\301\370`f\367+\020\202\336`\002\256\016\244ax\r\334\213r4\007\253\343f\245\215\215\303X"
+	.string	"\240"
+	.string	"Q4{\006\t\370\0367\351\225&Vb\247\t\370h\020;\203%\222&\255f4-~t\345AlrD\323d\016\252\370bX"
+	.string	"\365\245\334\226%\2300\340\007^\313\343\322\202"
+	.string	"\320\263\251\001g\366\305C\200\002\243\022\337:d\364\316\234\305!\313C\335$7\234\324\030\223\305\200\343Z)\211a\225!\237\232\254!\373\231\266\326E*\320g&8\301I\324%\241\022A\214\307#M\366M\355\346\377\366\341\243<Y\351\255i\364[?j\304Z\221\035\362o\330\t\221\257\355\364\035x\326`2\327\230\250\272&\357\354D/\375VxH4\"4\355U<\343\362\252\016\336\264\024&R\305\353\335\n\r\025\375\351\230#\230\375\217\312P\236\307\315+ba\313u\372B\314\"\201!\221$?"
+	.string	"\254\353z\361\\\305\243\326\236~\333\221^6\276;G\320m\310o\022"
+	.string	"|\0168\233C80\300V\037:\342kL\303~\306,\013\221\013C/L\242}]]\347g\033\306h\221w\241\235D\362K\004\341\204Y\212\030\277\252\304+\225\242\252\f\204\316\036VV\317c% bc\224\320\356c\025\223pFN\216\027\327\006]~ejB\264+\207\325O\352?\325\031\222\224r\342\346J\377g\223/4\310\003E\013\033\260\033\307\354\025\013\311\\\346w\262\272c<\026\377! \r\201X\251f\0255\363\b\263\021\273\225\024}\333E\266\252\254\2271:c\353\355\017n\215\353\250\237\304\221\236\027\335\360m\377,\236\260?\223\344\374w\002\343\315l)\277\265\213y\213\230\036F\214\330m\224\232\013\346\261\226l\254\2379\254\315\027\240\276l\266\206]"
+	.string	"\236j\352\360\260U=\b\004\372\023\273A\2674\216BR\t`\024uygR\204xO\3302\372\001\316\332*\252 \326\310\360\214\263\304h\001\225"
+	.string	"\301\033@U\312\255G\2722\353!\354]\255\215\022\020\205"
+	.string	"<b\033\by{\304qo\364~\231*\234\023\321/\210\013\244{\277E+k5*\367\021\370\021\r.\"Z\326\027$`Z\013\255.\365\327\350\271\266T\377\002\262\366\231i\303X\317\204h\226)|9\332\177\035p\f\237jh\324f\276\027\205\301\363=9+\314\223\366\301\367k\351\244\305\252!\300\033\b\216DZuc\230}\256%'\0205.P\333Y\257u\023\217\267\357\370\214\324\205\376\255g\354\250n\313W\313\t`\267\227\310\273\254\244\356\n $\245"
+	.ascii	"\232F;\211\247=4\251\204vZ\026\260!$O\025\314?#i\250\263L1\001"
+	.ascii	"\2011Y\254EF& =\350]\004\003\3200\037\254SF\337\274\2133\332"
+	.ascii	"\217\005\320+\034\275M\\G\353\207\274\270\325\b\024\260\3374"
+	.ascii	"\2629\225\t1\320\271\267\365\016\3049D)\200\200\373\310"
+	.string	"\022\273/W\235\204\001\202\002I.\253#\244Z\016\b\342\002\205;\370\005=\253/_\200o\327\302\244>\302<\006\233\334\025s\327<M\005\340\242\271\204(\016\f\006W\230Y?\226\346I\034\005\335\223\2501\225>\213 <\037 \3727\036\241\226 \373\005\252\360/p\347\233\266G\237\273\316C4\307\311\263\364\376k\3249\265\361eH\255\234r\214\023\277\013\266\226!\222\240'v^\203\240\242\251\232+\024\334^\030C\r\0245\344\370\025(\006T\260B\235\f:)\326&e\224\277\225\234\3559\314F\210\223\310\237\271\n\201\006\262\036\306\310\351\034\244\3619\214\232\226\206\353\247\341]\234\317\322\030l\250\203\374\214\032\017}-\325\274\222=g\335\n\256\275\222\027h\254-\275fz\326~\n\230\231\206\333\260\346\246\030\226R1\312B\204U\354\t\001\263\3101\005\220\214'\276@l\371\226\233\253\203H\276\346\263\300\305\f\346"
+	.string	"\021o\204Qc3\367O!c\205\302{\374e\350n\021\024\341\013\313\3705\336\261\326]\001\213\206 \020\037\303\344\260.-2\216\231*\225k\225\3244Oh\020|D\2536r\f\252F\023\021\362\273\331\245\033\023\312\361\243\257\325(\251e\327\245u\277-\250t\354G\034\362^\345\341\246\340U[\303\215\352\2220\005\357\266Q\037H\263cO\344\201\017"
+	.string	"\301\256$\004\216\322\004\371\360\217J\243\206\224b\274Jv\201H\2150!4\031/\251;\031[\257\241\271\326(\303\364\212,\324\270\320f\257\001\205\n[!\020\023%!;%Ap\270\272o;b!v\016\320\321R\202\177\342\313\271\253Z~k#\355\302\300\224\316I\324\311\241\0276\370\321N\230\254\263\037\031\022v\303U!\205y\325~#H\377lH\323\003\206\333\273\340\305\235\224\313c9&\3278\241\001\003\016\334\203\361\274\253\306\004\365&\362g\0353\342'\016U@\037\353<\361\205\224\253\343sd\327\251\304V\272%\245\335\324"
+	.string	"6B\214\376\365\225\312\257\337\253\320(\305\321W\340\357'Y\364t\343K\b\007V8\273\270\353X\354r\005s\001A\347\240=\037\336\250\311\215\272\031\3666\201D\232\376\214cE\375\227\252\215K%\027B\231-\274)\326.\363\303UT\005G\337\261p\231  \351QX\276\340\034\001\376\322\303\234\317\266\262h\242\326\0206fY/\365\2202Xc\312\260/\216jZ\322\207"
+	.string	"\277\323+{\343\261\023\203)\030w\202\004C\251//\330\031\214U\215\251\350\223\211\306\236\001\240B0\352\202Y\031\236\215,\303\3426\221\353\232a?\274"
+	.string	"i4\f\211?\214;\021\026\302\325\314\220\375 \323e\304\340Y\273\216\020\\{D\242\364\024\342\372C\335]\036\276z.\300)\021+\231\377:\375\306\210q,\305s\261\222X\315/\024\323\0355\262\254\316\276N\026<g\026I\242p\322\330\355\253\3505z\200\262r\306\214\227\22207\370/\240\337\034\336\262\231\004\370_\302\2568l\272\323C\251"
+	.ascii	"&\242\217\004\2405d1\002\"\031\371\b\030\311&\250\227\361N`\335"
+	.ascii	"\256\343"
+	.string	"\241:\241a\212\375z\336f\357\017%\201\305\255\216C\263\276\270A\227\373\274E\016i\373\264\034OuI\320p\254\254\2226\264^\304\f\214\204[*\223u\334\001\364\265xn!\016\362<1\005G\007\273\261\005\242o\261=\024\324h,107\316\373I1\377\026\327'S\262$\375\364\373(\013\f\273;\360\317\220\320njf\343L\354\272Px4\306gP\033y\246_\204\013(fU,\01673\224u\2206\365\337\346B\364\001\216B(A0\226\202\247\377\352\366v[\362\343\376\226\242\302\263s\r9\r0\273Q\305\026E\2148-_\222@\246\313\226\006\301`g\337'\265\352\311\342\305\215C\317\376'a2\362#\275\373Xh\203\255/\376\306\274~\265&\251;\304&\233\247G\300\354iLk\017\337\215P\246\202\203]$\336\304z2\211\352\245\005m|h\376\302-l"
+	.string	"'j\303\364\313hK\2557$a\236zo\303K\207\217\203m\242\020\375l-\357\004~\203\375"
+	.ascii	"\227\273l\254\025\211\212\207\225~\207u\032v\3400\f\353\327\006"
+	.ascii	"J\304\201\323\317\331\273\026\230#\274\231\337\360M\025\f\325"
+	.ascii	"\\\365\306W\237.H\367\212\030_\376\027\335\247z\nac\305\325A"
+	.ascii	"J\353\211z\317\377#\b\266\304\362+\257k\320j\030\013\006D\344"
+	.ascii	"\017\215\345\313\230\304C\267>\017\247\241:CM\243:\021H\354\221"
+	.ascii	"H\365\275\016[\002\367C\020(!M\373"
+	.string	"\210\374C\221@=\345\324h\315l\376x\345\026\204\221\374\275pX\203\026{\364/ :Q\353\214\332~[V=\221J.\032d\367\363\206V\331H\217\343\307\320Lt\271\025\033=\272\221\2716\246h\264\205.H\023\243L\b`!5\217\231j\300\353,\343\030(p\3519\322jh\016G\247wL$\200+d*v0\363\306,X\b\206L\333D\337\025\310\254D\367n\360\232\336\221\023y\272\340\220w\205\3676\031\270\356\240]\226\242\235\371^\361\260v`\375\200 a\r\3540zE\346\365\257uI7\002+\205!\320+\030\265\236\003\035D9\244\177\234\001\203\253s\250B\215g]\255>\371H\304\017\313u+t\345(@\204[\020\003\316\370\031\251\002\036\0070\333K\323\251\022\262\345\3352\020\232\271m^\021W\2528\316F\326\2117\002;_V]\225\345;\224~6\344\230\317j\332\371f\316\001D\266\276\327"
+	.string	"\261*]#d*O\257\326\342"
+	.string	") \267\353\301\233\245\227Q&\254\277\276\002\213t\347\370\355L\314BL\261O\270\215{\016\026<_\323?\216t\330\355\344\035\377\324\345\213Bj#\375\314\227\321\"\022v\367\274\340\252\016\260\252\220\346\315<^\325\013\265\345~yK\351\006\t\317\371\022\303e\240\253E\3745\0374n\355>\257j\336\362P\202\336>Gn)\006-\373D}|{x\314\220Uz\374\354\304n\276?A\326\340l%\350\0279\247\337Y&z\232\314\350\253A\206\314\204E\240z\376\r\032\322\330`j\245\313\334"
+	.string	"\"\023\3434\177\334\344\034\031\027\261+3U\335Tc( \205V\036X\265!\370G\253\353\2075Ao\211-\251D\343\300\227\2021"
+	.string	"\354\360Nr\202\021\221$p]\3556\201\244\222\221\316\004\274@\3275Q\232.\030\375\254!(_\210\257\363\256\344\301U\245\233b\204\305A\367x\201\036J\323\340K\251u0S\247\252\021bKK\221u_\215\017B\227a\241\272\203\355!\242\037J\360\r\235H\206(X\323/A.\271V\367+^3\256\373\036\274V\201Bp\320\t0\344o\334\022xpI\264\236\353\031\0234_\314\273\360_\b%y\3350U~RY\352\365\367\0378\373\353L\001{\323\355\204\266\266\324\203\211`}\225\341i\277\215\256\237E\212\316-\271\377U\302\235j\347>\244\370\335E\3400|\331\374~\201\347_\307!T"
+	.string	"\270pMt\347\013lr\337\362\366\305!\327\261\231f\315\001\n\203c\344\022\324\232\246(\233\251\352\2421\b\356I\036\3307/\355\024\352\212\274\304\001t\007\304K\354\023\362\023\262\017\335!\303t\212R\240Mx\320"
+	.string	"\311\350T\316\325\005dFp\303i\352\215Y\3520\f\"6y\024\264-aa\252\342\206\\\245f7\277\243\305\f\r\201Q=tT\265O!|2N9Q\257\017\205\213b\202\027d\250*\266\034\202*R\002:|>\242\003\255\034AA\265qK\371\225NB\270\352\272\362\331\006\326\2045\237\310Q5x\364\224.\363%\316A\246\344\277\177\343A\023\324\203&j\340\225\003\326\344\211\r\273ls\037\215pO\271\243\250\335\223\270'\001\212\242\354\205\212\t?R\311\036\370\323k\343\177\252n\366*\005n\351\316\274:\f\200\030>PG\366b\236\355\001x\005\b\217u|\"~<\214\360\232|\326M\216\t\225"
+	.string	"\317\374\310$\375-4\223\037x\317\225\n\272\\4\270\255\305U\f>\254}w\r\200MV\025\314F\001\360d\331\3359 \254\004\n\232\024nEK\221\205\022\321\225\254H\226BId\007\034\204\3528\310\fFM\361B\244\270FT\212M\277]B\333U\033\327D\241k\002&H\347Hg!\"\232@\n\366\231\235\265V\362r\223\276tA~\022}\314\177W\202\263\357\211hG\276\037Yj\317k/\340\355\223\340#\344\306\267\204\332\200\354\315\037\0048\253Pb\303\241d\257\256\005_\215\030\266"
+	.string	"\254/\306Z\203\2121h\224\234H\334P\n\013xS\215@'6X_\024\256\277\311\330\332zAS\032\207\353\275\020\205\360{\221\353\003\314\210\b|\372\203.\367\322\t\004\007*\227\234N5&tR\233\371K\036\033@\214\177F\272W\334\005\364!\013\022\265Y0\214\261M\n\022`E\017\376h\314\306\244 =S\302M\313\205\3039\307B<(A\323\017m\b\227\025/,s0\267O\244\2333"
+	.string	"K\222\363\361\026}\252\210(\326,\243\215\216\346|=\343\205"
+	.string	"\330,\250\253\274\227G\027\260\231\227\364$2\265\032lYB\242?J2\235\373Nq\353\210\224cB\342F=\354\307\017E4\013\201\230j%i\220U\037\rqUf\207\027\\/\212=\234\"\342\247\363\344_\f\004\312\354\324\2346D\3007\330M\200\024m\207\212%\350g\203\313\225]\301\332z&\355}\257{-]\366\27459\b\273Y\306\205-\271\313\013d\306\0177c(XV\b\372\241\t\271\237\n\221\316\270\257\202\255\311\350\f[\033\200)\236/\360\371\367]WJ\207\"\354\030:[\352U\371\2132\361R\2138\326%\321\007\013\242]\325C"
+	.ascii	"\302\nw\371\335\274\226\277&\270\271w\224\t\342<dR\233\213\244"
+	.ascii	"\371\004GM\304!tX\223'\177\316\376\0355\2742\226\276\022_\254"
+	.ascii	"\217\242\221\233\360\356\377\027<\220.lL\230\032\311^?l\023\204"
+	.ascii	"qH\353mGi\021\376a\324A\334'\336\021\3470\223`\206Oe\337\276"
+	.ascii	"\235\004\241\001\205\3138\301\220\314\302\204\334+\214K\261\244"
+	.ascii	"\321-f\206g\\&\020\030\322/\303\221U61\272\265\200\200\3201\277"
+	.ascii	"k\006c\2147\302\031\0262@2:\264E\326\037s\353y\206I#\244\200"
+	.ascii	")\037\210\224y\371l\024v\356Q\323\347 \345\021y\235\037\n\241"
+	.ascii	"e\020\232Z\225\202\372\301-u\333\016\265\303\351\343\375\031"
+	.ascii	"_a\222\320(zVul{'\362@\326`\273\222\313\226i\374\270\330\250"
+	.ascii	"\341\004E"
+	.string	"OD\2425d\215\300[\220\035\363\177\350\033<s\234\213!\264\200\310\273K\211"
+	.string	"\263\326\324]\216l?\327S\372\321h=\035\247\001\341\335\026\331U\243\301\023\022\312ie)e\247\017\267\320\243i7[\n\362\245\375\t#\373l\363\277F\204\005\360v\002(\203"
+	.ascii	"\343\314\303N;[\324\002\332\244B%r\331z"
+	.string	"\374\314\306\r{\341$E\331\377;\206\360\003\f\004\340Y4<^\267I\343\262f\271b\211\2766\177\005\240\265\264\224\250FVd\325P3\266\343\016\316!\251\372\335\3127[\201\031\370\256@v\024\264q!\254\021R U\356\301\353\037X\356s\032L&*\\\327iH6\310\360\356\021\307\026\2533\327<T\026\267\333~\361\241\276\200\265-\242\331W\326\016\365%AF\261y@H*g\304\314\352\223\336b\216%\341\r}A\005\360/\024\277\201\251a\261\2231\371\243\013\237\006\024}\204\330\317\300\323G\320^h 2p\277\377\364\353\222\226\003Yj\224\017\365\236\205\304\366\\\362\303\022Y\004B\352\333\341g\034fla\371\364\bi\023\r\0058\25374#-l_\317S\276\314Ij\026\366\276'\325f\337\312\261\341P:\315\257\350i\221\b+\233\003\242\213Nd\276\214\351\022l[\tvQ\022\023\362\255\312\316"
+	.ascii	"\357\201"
+	.string	"\376\337\346\220\2544\374dv\232\034\b\b\317\270\265\003\272HhD\213\225\312\230Q~Tdo\304\314\233\n\365\200\356\225\303#UT\022\371\326\312f\230\235y\026\374\373p)\220W\300\031\030\3255\354#\351\250\017\273\206Z\370\220\305\373(T\260\352\016\361x\222ak\320$\377\324\210\r\241\315\315\330\267\261\257\276\031\262\037t~auP\333,k\312#:s\0027:6\200p\341NH\275\215H\235\327\312\330[S!8%\r\3765\360\225V\246\317{m\f\243\261\267\025\032\365v\316\031\331.\323\004N&\r\005\251\354&\237D\315\366\206\037\355k\337\232\205\272\207M(\361\357B\373\331\206\f\037;\211\262A\326]_\374\317\356\214\360VP\342R\266\205.\237l\001\330\353\321\360\327\352k\2654=\304\265S\227\244\232\204\341\016/\245\341\220\337*\317O\367\374\350\334\327\324\"\245+M\212\274\316\223\370<C\034\364"
+	.ascii	"?\004\032PK\235S\376z\312:z\250R\302\346\214\245W\234->\330\364"
+	.ascii	"\342G\2356S\002\327\366\226A\253\216I\237GP)\367H\222u~/\373"
+	.ascii	"\305\216l,\n\202\253.\262k\213\275\315\261\275\265\375\311T("
+	.ascii	"\2561\034W\275\327\300\216\201\243iK\240\201\245x\277S\2469\210"
+	.ascii	"\354\316\350|zD\3326\351X\2567E\223{\252\233\304\224\376\216"
+	.ascii	"[U=G\272>\251\346\336I\037\2129S\204\200\262eb\260\371Y\247@"
+	.ascii	"\212\n\"\340\261\311^w\240\364\023C\353\275\224\335\204\212\343"
+	.ascii	"\263\3565\201\346\037\303^I\366\226\242\006\235\215\371\027n"
+	.ascii	"\373\214\320\">\222"
+	.string	"\236\037\t\307\244\211J\023\337\216\344\303\336\375\313\233\024\031\307\316\r\230\366r\302g\230L\330\034R\021\312\b\344\237\350k\251\005\fM\214\222\254(\360\247\362d\262\222\007\363\035\215\260\360/G\243\347\203\313\203q\200i\270\341\304\305ttI\331\030@\361\036\337\247pb\307\272\363*3eR\235_y\357\327;K\343\347,\252\205\324=\266X\031 \370\340\267\364w\037\"k\253\261\244Acc\245\257\025\226\267\022\2100C\\\217\363N\"\273\252\033\214\345\245\212\301H\302\3752\371\200\2034: \016\366|\330\247\206'P\327^\036Q*\313\020SWq\231\374\200\023\206\231!\335\250N\003s\3162\367!\246\240\250\313\375Q:2\367\257'D\273\305\036\304\374\303\303\246\247pI\367\371\336\007\226\266\217k\200K\354\003\3345\n\003\200\036P\035\354\206VL\235\266\262!C\016LJ\360\"\26564\013O?\320ue["
+	.ascii	"\264\365_\316\207\263\254\232\276J\261:\207L\221[\2737\375q\324"
+	.ascii	"\342\310U\263>\2567\356\255\216\201\253x\227pm\366\271\360\252"
+	.ascii	"\203\222g\340\275J\025]1mlU\f\240\005\270%\323G\265e\354\\\314"
+	.ascii	"\001\362\225\312,\204+\252\030\204G_q\022$\252o\370J\255\225"
+	.ascii	">\271\224c\203u\345\351&\002\321\240EQ\260\341\004\033\r\277"
+	.ascii	"\362\321\216\220\244\253o\334;_\322\203\232\353wn\037n\363\005"
+	.ascii	"4!\371\213\330my\362\232\315\3004\366\325\377\317\017A9\007<"
+	.ascii	"U\025\266\210\013\325\216\370\023X\b\226\\\252oK\tqUK\234'?\367"
+	.ascii	"\022\341\240\022W\033u\261\0275\264\247\271\243\235D\246D\360"
+	.ascii	"\352\362\217\304\027\200\332\367V\326\234\363\243\254\2313\362"
+	.ascii	"-5\201:\266'?X%\337\215\343\334\202b\274\331(\236`\345\247=\250"
+	.ascii	"W\177h^8%\027\367\007\037\032L\243\3048\227\003\260I\244\373"
+	.ascii	"8\330!\332\223\303\221\375"
+	.string	"Tv\266\034\330\3742^1\271\352*Y\234\225\374\242\232\350\350s\251\302\261B!q\372w{CN\333\214d\363\n\0178f\032\312\023\242\337\026\360g\nTNr\236\307a\362{\016)\035%@\227\262\034\006dI}\237V\031\027\262f\272\322\030H\002\017\b\277.\037HU?!\274(\253\375\2418}Vy\177\313g\275\322\003\311\f\342\343\371\213v\016\200\210\003}\374\241\303\212\364\3710se\364\033\n\241\355\361\025\t\254\265\221\314:s+\205\327\372\207\272B\250\335\246\351\342\327\371\366\350\271$\352\2165\227#\350\263\320\222:\3540\324R6\361\302M'\212\304(\302\003|\326\244\334\310\001L`\271\023\331\032+\361Xd\025\t$&\374P%/z\255y\211\227\301\231\250\242P\233e\351F;\200r\324\f\362\007\n\204\304\265\364\263\fj\3349\273-\327\007?\277n@\004\363\f\301A\225.\213\322\331\246\313"
+	.string	"K%\032|\206\023+\261\257\025l\261\352d\223\273\241>T\b\017\317\031\321\035\362\2666\327L\223\374\364\244MgQD\270\"\344\021\341uo\266q\322\267\273(`xr\3236T)4\242k`\002?\314\271P\\Z.\257\361\261\031|V\263\026k\243\\\034\242\312\360\216\302%b\202\300\363qf/\361\033;:8\303#\373\332Q\235\365\272.%\232\235>\336\261\206\205\256\310W\031_F\300\3019w^\334\363I\303?\253\350\336T\241\362Z\0350'B\343\005ti\221c\244V\317\303*-=n^\001Kb\377\035;L\357\r\305\246\371\205IN@\022\342\347\255\253\340\3412\023\312\013Eh)\267|Y=\263^\235n\237\224\3229\3261\340!\3324r]\224 \272%\346\036\227\241\223E\360\362\350\325~\204\235(\003\b]%3x\\|\001\306\333\016\220d\307\337\n\276\325\037\3045{\337n\266\240\336"
+	.ascii	",\037\252\037\342\020\253\214u\374\211s\023x\351\320\326\220"
+	.ascii	"\345\352\0244\023\342\327\373e\212\262g\202\331\241\007\232\224"
+	.ascii	"\247\330\310\221P.\204k-\223\0309\333\034\2619\240J\2310ojLV"
+	.ascii	"6\371\237^\222\bZ\201\325$2$(\030\215\204\313\025\034)\003:\220"
+	.ascii	"f\236\231\372xB\335\177OAK\320\233\202u\235\320\342\021\335i"
+	.ascii	"\264\036F\320a#^\356\231\203\317`\355\361u\311\343[\362\026B"
+	.ascii	"\376.\333\002\227\372UX\275\312]f0L,A\311\254\2559*\2677\253"
+	.ascii	"\332:\370_\352Du\227U{\355\004f\271\030\225\341\030\271\205\237"
+	.ascii	"A\352\213\215@7Q\254\362"
+	.string	"H\301\037\305\321\242\240]\n\304`2\002m\363\305&\356\371MH\032\204r].\220N\250L\312\b\204\030\224\2436D\317g\213\347G\263\f\320\234<\205h\203?Ft\032\331`\022/\324\tV\312\002Y\233\001\314P:G\247&3\237M\272I\234|^,,G\025\361)\003y\202l\274\026\235\346G2 ;\037\231\233%\002\317\336t\216(\273z\254\031\353\370R\032v\267\001\306H \273\265\022\212\3241}h\275G\247\225\n\205\007\245\023\331\271GT\232\327\016\260!\240\267\"\237<\206\003A\263\006\321\242\270\265|o\314\307\365\337O\371\267(\320\360\234\004\207\202\027d>\007\200\277\024aE*\025\264\362\362\030\220\261\231"
+	.ascii	"\3627\033\322\316!\204j\261\016$\2377A\020=\312c\237\222\f\022"
+	.ascii	"\256]\f\007\217\b\253\217\317i\345\271Nm6\3756M\366\271.?}R\243"
+	.ascii	"\233\231\342_\003UJbIC\247w\236\027\2205\334KP/\257\"\213\357"
+	.ascii	"f\237G\331G\302J\266)+\373X\3245\244\241\221\244\262>;\220^\303"
+	.ascii	"~;2\205+\274\347C'\271\240A\256\200"
+	.string	"Ah\261,\207\256\254\315\275\230\351\026i\355\232\272\005\312F\017\210\216\266\273\330W\364b^v\002\351l\370\304\227f\004\324\307\322\350\231_\374\316%\205D2o\212\270\372,\026aL\364\305\n\310J{[Bs\215\255&\342W:Hx\251\016\325|:)}f_\227\273\237\243f\034\274\337\267\354\301P3q\004\024$u\203\246b\300\001\2676b\373iL\2527\210\2754a\237\302\267|\314\023\177\242Q\341C\230j\317B<|\246\033n\271\032\326D\0352\314\316\013\331Y`\n\275.wq\325\362\204bX\365{\360\204l\331)\013x\366\270\034$Fje\200\033\376\340\271\"L\2113\233/\347\006\372[\323\177\203\354\223\253],\027(eFe\320X>\350k\225\341\304Z\201\027\351\346J\351]\210z\253\351\316\355\331a\273\251K\306\250\262:\363J\364\336\363\n\215\020\344\026\t\356/\330Q\276~\205\225\034"
+	.string	"\342\304\340\327L@\350\260\227\375"
+	.ascii	"\277\361\215E1D\301PxF\220<\f\230\365,l\340u\310\216\\\263\302"
+	.ascii	"\342\354\224\252\243\222hD\t\t\301\315\2709\246\356oy\3125\343"
+	.ascii	"\364\034\362\207\036\031\002\222\362"
+	.string	"\211\356R&\321\276u;\224 \362\240O\337\311u,\027(#\261\032\025\365\241*\373\306\2709\251\020@\365(\345\004\215*\355:\361F\366\200\230\323e64l\370\325$YY\252\036\271\332.g]\004)\221\321\233\001\304x\353\321:\201\263\036\257Ac\374\351h\242\203bV:.\nR]\315\223\210\022\222a\004\341y)\214\346\261\016\032\250X\330H\345\234\tc[\202\3542N\037\262\243\215\227\241hO\253\251\250Nx\207\007\221\353W\313\230\"\224\220\352\360\252\3216t\3553\033\225\316\321&\235\3200\262&\207\031:\307\374\255\2230\206,\342\357c\ts`\335\264\316\205\017\004=d+\020\254,\271\325\f\226l@h)\"Q\205R$I\243\355\020\311x\3312X\313\245\366\037s\273\321\314\337\215\373\337w\221p\263\362\366\236\363\347\211\255\270cn\321\270x\r\257\006XKA4\024U\327\213\262\272,\001\314"
+	.string	"\026\2608~\302;\327/\\\303\303\201\266X\377\304\214\016p[\320\325\310\3608\240le9\3530w]xPE\376\313S{\020\207\342\250z\243b\306\215j\240cdE\325\275\273\375T\310\322\243h\214?\326\3655}bI+\226\017]\222T#\305\304\376\016u?\316\006\251-\210\275\203u;\201\036\277\242\314N\017\\\325\020':\263\256'=8\020t\024h9e\377\341z\206\365q\232\305`\341;|he\"\f\321\331\350b\202\215\247\314\212\306A\211\3208H\244\035\3767J\231\025\272*m\364\026\300\331\252\211B\263\215\257C\030\357\252\257\216\271O\356-\036\224*\270\325\210\241\246\3236ebr\001\271\303\r\177\312\007\262\206a4\227\235.+;S"
+	.ascii	"\206\023s\214\200\344\360\217Q\001\257\311\321\345\207V\\\024"
+	.ascii	"\b\255e\256\261\320\350\353h\224n\226\210k\351e\022\263\035\244"
+	.ascii	"\022g\037\353\364\250"
+	.string	"\320\267\326\321\204\004< \222\005\3038\305\226\210\336.\310?\300\030\333+\262\310\217\264\212\266\265\221\351e(.\200\024\013\332{\356=\002\350\337-7\343\017{tu\205\372\031e\005NgJ\034\232\243\242x\350\236\035f\371#\360\257by\200\366\331\260x\361]\b<\277s\202\366\f\302\372\306sy`\353\312\302Q\335\227\320\325\231\277RV\240\203f\0238m\346\275\354\214\013S\341\204\377H\225N\002[M\202R\200\035\n\001\006\330cTp\271\006\277\032\2614E\255\234%\245b\244\005\333N\300\232I\276\254`\241K\324\346\344qC?\235\016M\235n((ae/\214*B[\034\2545\300{T\244q\212\221C\332\363\302\346%\250.|e,\247\315k\332\234W\224\r\177\367^\232\270\353Dh\232Y\275\342\353\315\242T\311\352\231o<2\323\240iw\022\361U\335\311\240\201\025t7\354\351i\232H\321Z<"
+	.ascii	"\235\021\246%\226A:\351\217\360\202\302\206\272HM\216r\b\201"
+	.ascii	"$\312\337\234\377\355\342\321\r\022\347q\b\177\035r\021B\362"
+	.ascii	"\350\240f\324^\351\201\324X\225)\214\204\263\001\364\356K\360"
+	.ascii	"\264\241\364\033\"'!34\202\r\025\030\306\024\272\264\224\243"
+	.ascii	"\256@\276c\023\260`\026G@[\366\b5\210\352\213q\b\177\214\242"
+	.ascii	"l\350\264z~(\036\314\215\313\272\206\204n\270vzi\324\275\304"
+	.ascii	"GY\023.\300\323\253\226\021\033\006\263d\302:#\361)\346($Q\326"
+	.ascii	"\n\270\006\rl\252\250\311l*\343\343'M\262\265-\341\270e\"\177"
+	.ascii	"\354R\303\206\345X\021\335\023\246\2044:\352\001\213\244\244"
+	.ascii	"\317\343\255c+\321[\302\357\217\324\320\354\340x\347\207\n\336"
+	.ascii	"\362b\017o\232\006`h\3526l\036\277I\216\274{E\206\305O$\333,"
+	.ascii	"{n\373\305U\242\221Dz\031\307\376O\202\031k\210\204Y\353\300"
+	.ascii	"\214q\351OI6N\300\344y\215\034r\022q\027\225\003\30312\311\354"
+	.ascii	"\206\346\372d\251\025,\257\335c\t\360\224h\316\303\304qn\262"
+	.ascii	"\303\267^\032\355F\034\323l\005w'\235\320n\261\357)\001\274\006"
+	.ascii	"\256\267\272\275U\332\272\376m]O\223\bj\262V\223\216k\351\304"
+	.ascii	"\312\366X,$\254=\366\202M\2172k\b\245\031\251M\346\231\265\210"
+	.ascii	"e\224\351\320|\346\005\321\026\006\214\013l\315Z\353Bj-\033\023"
+	.ascii	"\366(\017\177w\033S\241\207W\\j\342\034cS\331-\b\231\004\223"
+	.ascii	"\272L\310OCe\034@9\376\244\027?\204\303\250\373\263A\357=\353"
+	.ascii	"\363\340\263\221Z*\352Z\213\305,n\344\256`\031\246>\256\367\312"
+	.ascii	"\241\336=\177|\034\361\245r\226\2361a\344\245\362\313\305\226"
+	.ascii	"\305\310m\355E\001\244\3775\314\314\356\245\005k \fX\354A\241"
+	.ascii	"\030\265\026(E)\363WB\234\205D\032V\356s\266\230C\300\032\345"
+	.ascii	"\307V\247\377\n\260\2112\023\017\026\260C\b)`\212\241\267\273"
+	.ascii	"`\247n'u\214_\2006\215\241-\343\016\302\004\210\201\346'm\244"
+	.ascii	"\252\222\275\374\007q\333 \315\257\213\310\210i\024\375a\266"
+	.ascii	"\354\313[R&\246\361\335\270&\323\260\314\207\250,\374\357\376"
+	.ascii	"7\2657\262\215N;C\253R`\370\177Ir\216C\210\307\300zKW\302"
+	.string	"W\033>\t-\221\324\036\212\203\354H\336c\340\333\032\33558Q\334'\301\243\252\342\313\214^* \365\343@\276\3348\364d\264T\242\031$1#\372\377\217\231\241\336z\214\372\r\206\262kL\206s\366\201\327\256Y\276\300\027{!\316x\205\313\365\013\247@\236\266XF\255\206\311\026=\006\225\022\305\037\273\330>2\264\223*>g\210zs\266a\221\002\212\337e\221-V\270\257q\"\027\211\362"
+	.ascii	"k\006@d\036C\302<\244\177\243p\345V\227P\037o_\3233?T\2071\255"
+	.ascii	"Z\371h\235"
+	.string	"-A\026\371shqD-\274\361\213\244q\026\376\312\256\302\265\357\364\335?4\204\240\242\357~9\302\305\230\304F)\224\262\237c\260\032u\030\322l\366\374\3134\tj5\036Z\232\024\256\n@Fq_\361\270f\256\037\032[\"*}\242\316O\347\202S\362\355\314\330\256\314mN\372\325\277\243\323\031y\201\222\262\245\356<\324\347\206\220$T'\346\252z\334<)\301b\233\233\352U\363E\316z\217\236\337\321\336\367\244\305\004N\017p\211\227r\002\377\2027\022\216\315\322\006\375/\207;\020\2172s5\211\2404\"fBP\265N\005\315\215\263\355ecv\215i\343\246\326j\322b]\034\013\355\001\001\376x\247zX\177\317\243\203\366\321\220X\331\026\325\362\216\244N\3223\333\352`jt\036\374\245\363\306m\246\275\370\332\264\n\373\312M}\224\306g\025\004\205j\350_}\307)7#\225K5\376\022_\314x\201)\213"
+	.ascii	"\313\225\321mY\375\200\275\367\373\215^\367\fLh\230\367\223\n"
+	.ascii	"F\004\200\321]\f\273\017\022\257\235\016\2267\332rG\314-z\355"
+	.ascii	"9,ncu\335\320\310/\353A+\036\365\367e\2343\033\350\215\025\304"
+	.ascii	"\\\261\216\302\037,s\266Hn=\357%x\3609\203\353;\201\304E+\207"
+	.ascii	"`\001\255\f\222b5-\326\255\243\303S\020\r\030\321\017a8\002\377"
+	.ascii	"\372>\305i\202a\220D\364\240*Qb\235j"
+	.string	"\264\321\202\264\265!\354\035F\301\227\353\360\361f\313\247\3512\374\006\036t\340\242\265\374\013\205i\300\027\004mw\230\316%\212`Tk\3328\242\200\n8\300HfRgw_t\270y\274\360\177\337\001\207\024M{Jg\271\223*\253\362i\223\006\t\f\037k\205\215Y\3103\237\254\251r&`HF\334\213Z\200\326\362\223\356\265\214\220y\304\224\330`\005M\367tEnZGI\252B\322B\356_U\022V\323\216X%\342\036\325\316oz\350t2p\336\006\003\276sX\261u\367\252\322\256k\305\252\210u\366\001\226\016o'/(Y&\245\220\250\246\f\366T\220\230\210&\352\201J \275\232C\347\210\227R\013\033\222\363\033+\330S\177\361C\036:\372\032\342\034bu\002+kp \037Z$\355S0\233d\307\320~\216&\212\214\206\254\003\212J\315\325;j\360\311X\020w\004Y\362\356\206\202x\2159\023_\222"
+	.string	"\025):\264\204\024\334\025r\207\023\367M\t)\305\033\233\311$+\310\177^r6\024UG\3235\3663AXK\313\260\033a1\224\351\0030\232R\230\320\020\376\371\220\326\315\342!\235\216J\323%\341\221\001\204\215W\020\313\223|=Hr)\250N\212\003Fj\00429[s\320\323Mo-\bF\206n-\350\226?\353|\371\367\226B\250\325\251B0\2374i\313\024H\344 Q\322\306\342;\2534v\274\252\021\371\005YIU\237\202\340wVw\256\373\247\202\224\364\356\334\034w\314y\333\234\210\350W\334\004\377\335\260_r\266DR\331\275\306\322\227\030\344\034'\031r\322\372m\rAc@J\211$\321\214G5\027\037E'\255\032\036\022\222F\222\331\2107\217Q\356)\351K\361\021\270@"
+	.string	"\341"
+	.string	"'\377\240M\205\376*\245\205F\341\215\342\r\036"
+	.string	"\244\0214?*t)!Ey\001\263\325\213\370rc?\226\242\t\034V\f\037\357\024\210\372:\335^\341 \262fp\"\003\354\240\2504\343\f0\272\013A;\231Qb\315\340\373\217\f\355\332bv\355\305\033(\353\r\202\313\367`\276IR!|\237\317\336\006\311\002\225H,\022\263\206\032\266N\270\225\203\364\272'\330\024}IE\221V\022\262\231o\2727\177r\3172k\244\207Tc\256\372Y\001\t\256\365\271\034\022\224\2436TZs\313\374\337L\213xDE\220\260\253\227}@g>\t\025{d\033\353\377\217J_ol?\235hk\213kyL\372\340\002N-@\356\001\341\251*\331\243\332N/\240\310\323\205\340D\332\260+\2376\211a\336\263h\325\331XFb_\316\331\300\032\263\330\263\"\370@\230\234.\227U\363\271B\036\224\373\331\270]b\273M\037\017\034\252>\233\024\343X\345\253\275L"
+	.ascii	"\233\306{Y\360\022\257F\202\026\032&\352\215\255\227n%\351\322"
+	.ascii	"\031B\206\223l\360&\362\305\233\334\270\231\021c7\355D\256\327"
+	.ascii	"\264\022\347\340\264\334l\013>[\221f\260\005\350v\203KdP\025"
+	.ascii	"\271\270"
+	.string	"\277\221*\275\030\006\304\322\306#\242c(\300/\330I\367z\025(\271\257-\311;\265\027\275\026\344\224\363E\251\324\222\023\022\372\267 \301\177`\036V\227\3354\266\345\022\255\241\007\252\274\232\bN\032X\366\004\241\330=\251.\341?\203\324\b\177\004\223\322\361\367\251\213\005\264M[\345\327\203\300\2273\002\017\ro\241\"\004D\314\273I`\005rtf&\nr\373\234M\257\321\317\013\314\204\246h\036\300Z\r\314\372\b\202\214\351^\007\206\335\364^\214\242\220\024\355\242\257o/odC\247\321\"\177\\\336:\330\251)\tB\3620\366;\255\332\373\330\212M\005\237\207\b+\321\n^\355d\374\350\376\\\301\226\326\201?\013t\030[\275d\33347\206g\215\360\026\272\3562\261%\245P1\034\326\005\271\354\253\327|o\250]4\343:N\240\204\354\246\265\363\261h.\017\365\253H\372\355?7\307\360 \037\020\260a\200\033\360"
+	.ascii	"\353\241\031|\335[b\367\026\024\032\332i\201/\321H<\"\017\337"
+	.ascii	"\177\332\016"
+	.string	"\363\373\307y\013`^\220W\224\330\327\254\313\330@$0[\373|\266\251\371\237h\231\301 \312F\003\320W\"|$\321\267\023\250D\205\232\336c\020\221\3711\264;\347\003\353\340FIY5\035\257\n\032;\207\037\3210\372k\313\351\334\243i\2001b\037\210Xuz\274\301\335\251C*\327k\201\005:\002\376\026\370\234OF\177\001\327\344\305\340\330b\025\025\177\352N\344\336\304\f\006\024\"'T\222\007\037h\357\372\r\223\257\214\262\276\346RT\331\261\361\307H\304\263\260p\250:\345\277\221\b\371g\363\224\r\265\027\364\n\350\366\262`|_e~\341\352\227\242\311\273\356\033\214>O\267\306D]\205f\277b\305+\3508\210cN\341\310.f\026\350\325\365\242\337\205\274\001\323\354\017y\372\2633\270\370\202>\337\202\333\331\bQOP\030\267o\t\244r\316\323\300\017\364\270\303+\334\001I?}\220\263\351>\034j,\016"
+	.ascii	"\374.\020\355\235Z\3537}\273\023I\314\355\323\317'\315x$\327"
+	.ascii	"\377\350\022\217\270\325Sq)\322\356U\034<\352\367WN\237}K\301"
+	.ascii	";\027\204\2466\006\257\006\204\253\231\300z\rv?\231\375\266\313"
+	.ascii	"\027\367\345\260\276o\267o\313\030\354\331\337R6\177\312H\363"
+	.ascii	"r\320\t>'\266\373\377\303\357\275\312\263\241h+9\2748\323\001"
+	.ascii	"m\335\304Px\033j\374\317\346\336\245o\223\367"
+	.ascii	";\363\244p\232T\254\306\305\316\264q\021\313\232&\265hj\\a\305"
+	.ascii	"8tqcN\316\355\225[c\266\374\341\373\\\251\345h\302^\213\333\266"
+	.ascii	"\r\231\304w\225\035\230\323_=\362\314\033\205\327\336~\024+\307"
+	.ascii	"\304\342\n\320\363L\020\277\223Z|\262??\221\2059W\365\001\361"
+	.ascii	"\302\325\017W\241\366\b\363\313 I\212\0071\341d\002\036\327\371"
+	.ascii	"\373\255\n?Dv0&\037\253q\362\207|k^ya\201\362\315O3\377\r\336"
+	.ascii	"\315@\327\2751\226\264:\321\3339\336\375\201nV`\277V\3414U\034"
+	.ascii	"g\366om\267i\t\021\027\343\337\336\266\314\334\fr g\267>\236"
+	.ascii	"\3431Zt\303J\274\252\205\034XF\354\275\257\361_T[\375\320\324"
+	.ascii	"<5\355\333\254o\234\252\261L\033n)r&\033/O\272O\032\362t5\342"
+	.ascii	"]\321p\372\254\350\r\315\365\206,&*\0234\351\225\211\352?\316"
+	.ascii	"\374Y\234\300\016\316\002\3607\345\357\322\243\253\215y\275\335"
+	.ascii	"s+\233\361\307\f\210^\005\364\\\216\336\301:g7e\326x\224\312"
+	.ascii	"J\r\322\246\367\211\362`DF\345\202\350\245\305\017\034\227\203"
+	.ascii	"\350\267ULoXK0\212\366wr:\314\270\026$\277\277\311\347\002\353"
+	.ascii	"N\220~\232J\376c\301X\275\277\316,\206Ou7\f\244WF\363-U}X\372"
+	.ascii	"$\360yb0\327y\267\337\275\356\305\313|?\370\247\234\261\027\275"
+	.ascii	"2\236\232\366)3M\002\020\036]\366?\270\271\314\220+\350\020\253"
+	.ascii	"\r\240#\273\376\216\343\341\364\352^\223?\375,\364:\026\354\023"
+	.ascii	"\342;q\213\313\226T\357\335zW\310\207\363rz\326\3236\235\354"
+	.ascii	"\324\344\251\370\265\005\3467\2228\373\2021\023\316G\272/>\375"
+	.ascii	"%\320J=\355s\306CB\377q\0027f\036S\314r\226alb\316/\001\272\031"
+	.ascii	".\337S\310\253\236\317\b\036\346\036u9\374\304\212\027\356\262"
+	.ascii	"1\347\035\372\377C\345\fn\375`\364\f\265\215\275\031\031\257"
+	.ascii	"\313\3215\300}\273\265\023q\274d\337\311\337\261H\211=o\355\304"
+	.ascii	"\320`\317\277Q\356\037\341g\230\016\276\354\003\273G\211\337"
+	.ascii	"\252\275\252\"\375\270\360\206{tw\350\r\320c\316\256\020{\341"
+	.ascii	"c\361\265s\030\\8\006\f\227\033\342\203n\207\270\357\274\342"
+	.ascii	"x\316\257\221}\334v\267\300\327IG\324\370I\020\263\336\234\310"
+	.ascii	"\255q\274z\372\007"
+	.text
+	.section	.gnu.lto_.symtab.c78e67b14e92a04f,"e",@progbits
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\007"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\007"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\007"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\006"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\006"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\006"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\006"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\006"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\006"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\006"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\006"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\006"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\006"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\006"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\006"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\006"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\007"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\007"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\007"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\007"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\007"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\007"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\007"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\007"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\007"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\007"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\007"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\007"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\007"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\007"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\007"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\007"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\007"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\007"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\007"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\006"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\007"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\007"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\007"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\007"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\007"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\007"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\007"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\007"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\007"
+	.string	""
+	.string	"flashfsReadAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\006"
+	.string	""
+	.string	"huffmanTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\007"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\007"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\007"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\006"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\006"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\007"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\007"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\007"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\007"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\007"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\007"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\007"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\007"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\007"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\007"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\007"
+	.string	""
+	.string	"timingsGetSummary"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\007"
+	.string	""
+	.string	"clockMicrosToCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\b"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\b"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\b"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\b"
+	.string	""
+	.string	"flashfsGetOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\b"
+	.string	""
+	.string	"flashfsGetSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\b"
+	.string	""
+	.string	"flashPartitionFindByType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\b"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\b"
+	.string	""
+	.string	"flashfsIsSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\b"
+	.string	""
+	.string	"sdcard_getMetadata"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\b"
+	.string	""
+	.string	"afatfs_getContiguousFreeSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\b"
+	.string	""
+	.string	"afatfs_getLastError"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\b"
+	.string	""
+	.string	"sdcard_isInitialized"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\b"
+	.string	""
+	.string	"afatfs_getFilesystemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"sdcard_isFunctional"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\b"
+	.string	""
+	.string	"sdcard_isInserted"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\b"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\b"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\b"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\b"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\b"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\b"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\b"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\b"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\b"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\b"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\b"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\b"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\b"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\b"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\b"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\b"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\b"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\b"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\b"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\b"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\b"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\b"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\b"
+	.string	""
+	.string	"huffmanEncodeBufStreaming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\b"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\b"
+	.string	""
+	.string	"lz4EncodeStreaming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\b"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\b"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\b"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\b"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\b"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\b"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\b"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\b"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\b"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\b"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\b"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\b"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\t"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\t"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\t"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\t"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\t"
+	.string	""
+	.string	"flashfsEraseAsync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\t"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\t"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\t"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\t"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\t"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\t"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\t"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\t"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\t"
+	.string	""
+	.string	"writeEEPROMWithFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\t"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\t"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\t"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\t"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\t"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\t"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\t"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\t"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\t"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\t"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\t"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\t"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\t"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\t"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\t"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\t"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\t"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\t"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\t"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\t"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\t"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c78e67b14e92a04f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,893 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.text
+	.section	.gnu.lto_.icf.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375 \245-\004"
+	.string	"\244\006\231"
+	.string	"\013"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\316\240\376\350\001\002\002"
+	.string	"\002"
+	.string	"\003\331\263\352\325\004\004\315\346\253\367\016\005\232\303\344\257\001\002\002\001\002"
+	.string	"\006\356\225\345\247\002"
+	.string	"\007\234\241\301\342\004\b\246\366\331\374\n\022\002\002\002\003\004\002\002"
+	.string	"\002\005\013\214\227\337\207\007\n\002\006\002\006\002\007\002\007\002\002\006\016\334\305\363\307\006"
+	.string	""
+	.string	"\n"
+	.ascii	"1R\022\034|nGJ\243\316\305vnV%;.Vi\336\267\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\335\003"
+	.string	"2\005\r\022\260%\351\f\3030L\261l\233\331\2607\261\215l\231R\222\350\362`\212\201}wwT\031\327\327F"
+	.string	"\322W\201(\274\307\3243o\366\260\334 \344m\262\344\204! \320\002\261\241;\021\201h7\27754Z\327[0T2\374V\376\260"
+	.string	"q3{F&A\007\2708\016\007ke,Y\302f\036\300N\200\003\202\024|\371R\236\267@\340\321t\360b<\300\304"
+	.ascii	"\003.\314\020"
+	.text
+	.section	.gnu.lto_.inline.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`=\003\225\r"
+	.string	"f\322A;@\305(\215\001`\267\332\372\304\333Pb\242\"\260\247{U\216\257+7\031~\343\f \327\206\277\354\250\311\277\251O\354;\354"
+	.string	"\313\236\343f|\342\037\351\313\332\"\022\273I\354\336R\246/"
+	.string	"3"
+	.string	"0"
+	.string	"\2722\300\2159\247\266E\002{\317\242\260P\252\214gWX(\225\366\356}c\342og\347\234\023{\2109\247\350\367u\001\246\3149\263\277\034\023\002\030\004,ZJ\"e\306Cc\331\373\364\265\0235\260\377\300\211"
+	.string	""
+	.string	"(\0204\320\226\234\"N\006g{\237N\370\005\333\373\274o"
+	.ascii	"~|7\032\357\340rU\003#/\225\214x'\302\236\263\231v\350\266\241"
+	.ascii	"?\003\375\232\322m\037\036\333\326aKi\345\"\021\274\351P\267"
+	.ascii	"U\035\023C\260\007-\213$b\322Rh\003\277\276\367i\0064\300\326"
+	.ascii	"L\215\270\0174\341(\360*8#\017>n\366\244\342\003$.\271n\311)"
+	.ascii	"\300\225\213$`\227\334\222\353\354\205hd\322\226\335\222\263"
+	.ascii	"\001D\250\301\2353E2\001i\355,k@B\205\214n\007\022`d\035\001"
+	.ascii	"\212\244\002\343\0043\301\004\025\317d+\327\003\351\005\353_"
+	.ascii	"\362\252\350x\344\270\361\270\267\350\341\203\033\203\220X\n"
+	.ascii	"\345\006\222\372 r\004\3005,\251\222\005\227\356\346\030\334"
+	.ascii	"(\303\274zX5QT\313\257\233K\3326\205yY\241/\314|\204\316$\035"
+	.ascii	"Q\236A\227\353\276\212\335R\337,K\037\2017t\262t!\351tI\r\264"
+	.ascii	"*\257x8\251\274*\345\303x\312U\325i\367\34403]m\207`\n\346\300"
+	.ascii	";\033\315J\301p\207\004A\2244\001\373l\257\342]<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`\213\0065\016"
+	.string	"\206\0217.`\247$\0350\f\n\361I\320\201\265\202\037\206a\030,O^\024"
+	.string	"U\202\300$S\330\341\310@s\337\367}\337\376v\\Q\210\267%M\246\035'"
+	.string	"%"
+	.string	"1"
+	.string	"W\031\026\253\226\372\032(6\365\222\276X\275\367\336\210\027\273\006\345\203\262c\250l\204\263\321\bP\211M\275\217\b<\\\001\242\273\347\r\276\340\216\004\f\261i\212\030\252\265\225\270\225\335\323EO\364\252\272\300/\035\360\367\347\235\316\230\220E\f\022I$\342\334\037\b\304b\321h\022\t\306\024\n\212j\256\271?\331V\325b\301`4\032\223\t\205R\251d2o+\177\267\017d\273\331p8\354\203\017\370\302YE\333\247:\241\302\001'\342\242/\227:\347\376<\036\316\2656\302\355\267\214!\020\255I\322\316a0\231\006\30349\034\001\200\214\250\021\305$IJR(,s\020#\021\242M\007\022@Q3\204\203)\302\210\200\020\"\314\210J\205{\366\r\034D\354A3\271\033pK\255\031\312\363|\344\336\024\340\305]\374l\f\n\327\2415'W\205\312s\317\220\257\202B\304P\030L7H\250q!\303a"
+	.string	"q\2307\254/\344\3020\266\302s\307\351\001\003\022\215\310e\006\240\310\013S"
+	.string	"iR\2103:\270\261\253\303\225\304\275\b\273\013\362\300\b\215B\245\036x\036\020\255\260'\021y\320z\003+\201\031l|b:\376\354\346\302\337Q\231\201\222\001\002\025\220\307\0209@\033\303\322\013}\303\316PFi#\227\017\r\221\021\017\314a\034\n>a\351\332=\2753|;\233\312\362F~\246"
+	.ascii	"Ef\231\254\235\331\262\340\027\016K\245\261\271\020\324\207\f"
+	.ascii	"%\230\377\362V\312r\006"
+	.text
+	.section	.gnu.lto_.pureconst.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\006\231\004\007"
+	.ascii	"\270\004\b\271\004\013\230\004\016\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375 \266e\003"
+	.string	"bE\021\033\2405\351\340\263\372U=\277>\330\200\367\266\322\002\006\233U\252W\357F\244\021)S/\r@A\263\026\370\230\277\301\332\367\231Tu\"\235\253\347:H\204\017q\307v*L\362+W\345\277.\032f\330\213\323/\b\020"
+	.ascii	" 10\2033\2633\034\225y\2608\rTz\006\375\274\007\2241.\254\334"
+	.ascii	"e\227}A&\240\340\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.58d6a0a0197fa1ed,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.33.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`\312\t\r."
+	.string	"\332S\224\022;0\352I\007\345\262\274\337\016\001\032\025\003\261fUUU&B;}\037\305J\225\200;\347i\201\360\031YB\226#?\207\354\337\020\333\203\3003\224\023Wf\307N\262\355'\377NI\006\027\001\022\001\031\0018A\240~ \373\343\024|{\302\371\222h\353|\262c\005}\372\337\366\303-\370\036K\347;C[\237\313\216\027\370\321\376i;(\256B4\037\304T\201\266\336%;\346\252\243}\323vN\f4\255y\2373\263c\006\204\332-m\277\224VJ\363\276f\222\354\230B\003H\332%m\037t\020)\315\375\230B\262\343\n\251\"\355\214\2667z\260(\315\375\232\016\227\035[p"
+	.string	"\250\035\321\366@\b\207\322\374\217\271\002mud\307\027\036\020\322nh{_\204B,\374\257\351\002mid\307\030 \b\322\276\267\235\257\201\236\232\0032_\240\355\213\3548C\004;\355x\333\363\246\356`8`3\006\332\252\310\2165H\330\243\275\317v?\022\370\254\271 \223\rm\217\331q\327\004;\332\361l\3173\341\016\r\027l\266\241m\210\354x\203sIeI9v9\332\351l\257\203#\007\002\267\2707\022\216\263\317\331Q5%\2570L\241\233[\353B\034\363@\333\317\216\275\234K\312\361}|/\n'\216Q\347j\352G\264?\020\037R\033q\276\311\216\251\004\351\357\333\357gehI\342Lv\\\325G\377\240\375M"
+	.string	"|K\317s~\311\216\255^N\177\240\375\202\256\036P\232\353a\236X\262c"
+	.ascii	"l\364\333\355\277\013P\267\303\351\230\347\325\213\321\317g\177"
+	.ascii	"\037\254\337\303\302\351\3166;\0160E?\236\375y\004\334Yz\035"
+	.ascii	"\023Tv\214\365D\177\235\375r\003\350,\275\256\231);\026\360J"
+	.ascii	"\364\303\331\037\207\300\233\245\3331\1770;\036PD\377\232\375"
+	.ascii	"l\n\250Qs\273\246`vL N\277\231\375g\244\312\250\371\035\263P"
+	.ascii	"v\\\340\341\364\207\331/\306\300\203Q\363\273\346\347e\307\006"
+	.ascii	"@\351\347\262\277K\326o\241\341x\314\227\223\035gq\322\177e?"
+	.ascii	"\026-+E\3073\201\266?&;\326\342\323/e\377\224\003QN\270\3367"
+	.ascii	"\311\216\017\\\322\357d\377\023\004M\216\256\327|\004\203\372"
+	.ascii	"\223\354W\262\205\344\350{L\302\354x\253\221~\"\373\213$\030"
+	.ascii	"r\364=$\332:`\3662`\260X\353rQ\243\255K\303\326e\233\241V\243"
+	.ascii	"\313\006\033[\215.\253kD\262J2\3440\035\033\222-U#\326u9\237"
+	.ascii	"s=N\347\177\274\316\001y \037\344M\367\363?O\344\202\356\310"
+	.ascii	"\037\371$\247\344\230<\223wrO\036\352\335\336\307\377\370 /\344"
+	.ascii	"\215\374\221_\362L\236\371P\236\312W\371,\257\345\275\374\227"
+	.ascii	"\037\363d\036\315\247\3716\357\346\345\374\234\237{;\257\347"
+	.ascii	"\351\336\317\377y\274\317{\275\337{B_\350\377\036\360\023y\370"
+	.ascii	"F\357\350%\375\340WzK\257\3517\275\247/<\335\316\036\347\217"
+	.ascii	"\016g\220/\036rx\356l\365\031\267\317\026\210\332\241\031\325"
+	.ascii	"#;\276o\372\364\261\317\267\023.\315C\247\354\330\235\353\223"
+	.ascii	"\376P\373?\201Z=\374\371\204\372;\355\027\344\264\366\241y&\312"
+	.ascii	"Y\201\3721\355\317t^RA\f\321\366\374\313Yg\364S\332O\0305I\r"
+	.ascii	"\204^v,\345y\372!\355\217D\365h\025\301\374\223\035Oy\226\240"
+	.ascii	"\376E\373\031U)ZE\210\241\355y'\007\367\310\252QW\352\222!S\024"
+	.ascii	"Y\344\030z\321\224E3\225\025K\213J2\365\352\212\251\307\250\273"
+	.ascii	"\256l\030\325-AT\211\352:\206^0U\231<\252C\364.\3311e2\311\256"
+	.ascii	"S\367\fi$\256\306\251\013V4\252C\251{\226L\211I$\326Ec\225\353"
+	.ascii	"q5\256\312\252\353\305\341\013i\306\256\311\251Ku\32705i,\252"
+	.ascii	"aTlQ\245\272\304\257tl\250,\236%\323.\024\305c\272\032\305\310"
+	.ascii	"\324\324\254,,\300\255"
+	.string	"\320\266\341k\004\205tM\252\354\232\242@\202\231\030\252F0\255\353\305\341+U\331\365\250\016\007\334\261\244\312\016SvU\206\251)\273\232!\323\262\2421L\353\036Yue\313\246\256\222l\211\034\246\253\262h4\256J5\231\226\255+\330\326]\211\310c\252,\226]]/\016_\035\3305\271\224\272\310\"q\251\246\304bY\325]S\240\031UV-\243\272\353r\230\\\3314Y&fu\331\225\254\250\262\312\024\311\016\325+\024J\263t5\202\251\311\"\321\300u\241\341\006[\213\0253\332\326\272\002\200\300\250!<\202\220eXMP\224\024$\031\306@\003\021\321\246\003\020 \344\334\334f3j\222\376\2229\245\332WlX\230t;\025\307\033IV\311\255\005z\203\3550\t5YX\211J\235\f}\253\312\222(q\265\327?5/\024\374\036\017)\212\024Bk\257\3102\2774\340\2225\301\201\255O\004/\342\031\034$u"
+	.ascii	"\252\006^)\013\306\005\214\266$i0\322\203\201\375O\0172\342k"
+	.ascii	"\220\204\252\177\016.\023#U\3476\337\374%P\023\263TG|\362sw\f"
+	.ascii	"\252\030sY\025\264\221\272,\331\231\301\315\233\265\223\310\337"
+	.ascii	"{\202\357\357\303\"\331.X\241!\250<q\244\341I-\3460>\335SY\205"
+	.ascii	"3\2228[\302\346\351\323\334I<\203\365\323aQ\325\376\250\034\211"
+	.ascii	"=\326\260r\364\222_\243\264O\347\"\320\027\275\3449\210\205o"
+	.ascii	"\177\371\"8\260\377#i\t:k\223\353\365\tW\220=/\032\b\233\023"
+	.ascii	"\r\242\311\211#\301\344\342\201`y\321@\330\345\033\"^O\242\273"
+	.ascii	"_\030\346\321\003"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.35.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`0\002e\023"
+	.string	"\026%\202I\320\362&\035\2420b\277\001\n\206j\237\225j\220d\373\346\307\237\363\211\300~\206.\016L\t\t\026IP\223\240\321h\373\225\236\261|4'\016\272k\362"
+	.string	"\237b\312"
+	.string	"\221\3309\b\246A\371\327qJ\314\036B\b\331[\356\224\002o"
+	.string	"e"
+	.string	"o"
+	.ascii	">\377\231\361k\200\330\223\323\2153n\204\244j\025[\026/\200;"
+	.ascii	"\365\036\200;]\022f}\2127'_\3578:W\276|\330\273\371[\224\b\221"
+	.ascii	"\331\315\244P\353\300t[\215\344P\350\234Z\330\001\022\233}\370"
+	.ascii	"\234\022V\324J\210\3148\314\r\272)\375v)\233\205ro\273L\3221"
+	.ascii	">\021\315t.;\222Z\253el\226s{\267=\263\035\301\226\027\002\376"
+	.ascii	"\274\213\177\367\241\233Zz~\274wJ\313\225>\200\t8RQ\006\224j"
+	.ascii	"\365P%\244\332\2401N|\350\037/\355\333\027\362o^\371C\257W\033"
+	.ascii	"\234O6.5\360\036\344\333\274\032Y\036\f\307#r\252\261\243VQ\301"
+	.ascii	"\251G\274\323\3333\366\312\266\224\366\201\316b\346\342\006\177"
+	.ascii	"\265\216(B\252Ud`\226wz`>4\277\346c\264t\277\225\271\300\317"
+	.ascii	"\370c.\315\335\312u\2158BI\345\257\334\337\fq\206'\261\320&("
+	.ascii	"\251"
+	.string	"Z\303\007H\340\n\006U3\372\321\213;\375\322&\250)\240\303x!x\314\266\314_\200\013zj\r!\2708\221\206y\023\247~\211\341\036;\365c\270S\272\277}.\355<\305thd\325\366\020}L\355\322l\021&\023\004)\032\342\345q*0&)+)-&(\337\312S*\310\200'\324(#2\340\t\006\227\027\226V\313\212\tK\013\305\365\322\032!`\320E\305\325\202\001AWk\345\372\345\361[\274\304\351\306\355\210{\321\177\373W\3631\232\337\316\271&\241\331\232\252niv@\203zKUH\313\316c\314\021J\252\317Zk\345\226v\026\267\353\355m/\001\261\303d\023\242FV\311\225\021\246\b\351\006( 0\002\203\234\274m\\\341\035\342>\277\221\256m%\362\324J\216B\027\300\315\317.\267\254e8\026s\221\230\024\241\341\373\303\264\302;\202\240/>\"\266Z\253\021\260F!\242\273\223\354\002{{"
+	.ascii	"\224\351N\315\213\255\276\201\231\020p\234lK&\353\251\2731\021"
+	.ascii	"\230\227\225\006GDY\203s\2576<\001"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.36.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`%\002U\023"
+	.string	"\266\244\201I\320\322(\035\242\021\234\005\356o3W\016\031\251}\304\033\017V\306,\tN\372?d\302\242\314\272>\340\211=S\026\343\357\027,\304\325\314\002\256\272\334\221/\270\252\254o\256"
+	.string	"\335C\"\244A\351\034\021\224n\257\021B\366\226;\245m"
+	.string	"e"
+	.string	"o"
+	.string	":1\313\004\21096\340\270\203\306g\251VQe\361\001\276\323\360"
+	.ascii	"\276\323\025\341\324\247x\177Rv\360\243s\245\314\237\035\234"
+	.ascii	"\347%\205\030\271\321L\t:\0167\276\223\221\337\211\233\323\t"
+	.ascii	" x\265\233\207\317\031aG7b\344\266an\017O\306y\227\266\033M\356"
+	.ascii	"w\227DJ\343\021\320\355\346\022<\251\265Z\326n6wx\3337\333&\266"
+	.ascii	"L\t\377\376sOK\357\307[N\351\237LL,%\0258\252\265C\023\221\212"
+	.ascii	"\203\306(\361\237\177\274\264o\337\307\347\031\345\377\310^g"
+	.ascii	"jN\266\021\251$\274\350\357\214:5\213\367\304>\246\302YM\bd\304"
+	.ascii	"\303G\255b\202S;\bO\r\314\3331\033e{\245\335\340A\354<\032\274"
+	.ascii	"\265\342j\f\325*.p*<\275\212\0073h(hts\276n\007i\347\206k3\001"
+	.ascii	"\235Qin\316\337~ac\016\232d\262m\341D-Z\324[\252\225V2\364B\315"
+	.ascii	"z:\030\027\222--\352\t\341\371\013\331\201\327lg\270\213\227"
+	.ascii	"\202\234Zi\020Z\034\350\302<\211S\273\300|\257\235\3720{\336"
+	.ascii	"\247\r\\\257v\023#\233\026\210\030D\310n\316\026g\022\301\220"
+	.ascii	"\240\"^\034;\004\317\363\254\227\325\n\313\212k\245rb\371J\312"
+	.ascii	"\213\213\345Z\265`\254\026\224UH0\274*Phqi\251\\,\253\226J\005"
+	.ascii	"\346\242\"\031\340W\013\013\246zy\275`*\224\353\027\307_q\024"
+	.ascii	"#&\236\320\367\240\237\367\223n\007i\206\273k[\237\304\254L\023"
+	.ascii	"\27093\240A\301\245)\244m\3771\352\240I\246\317Zk\375\376\324"
+	.ascii	"'\027\334\357\216\362\001\327c\006'#\233\344\006( 0\002\203\244"
+	.ascii	"\273m\\\341\035\3426\353\034\370\332BcI\255\356\006\324\002\210"
+	.ascii	"\360C\224\337c\270\215\215\272\215\264\306`\002\236p\301\240"
+	.ascii	"\210P\224\342#\"\253,\354nb\037\244%\344\366;\331n\333\026\372"
+	.ascii	"*\336\221\260\031h\to\320\004\233\310#\273\3604o\254\005\346"
+	.ascii	"j%\254#\246\254\341\334\253}O"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.38.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\215\t"
+	.string	"F\222A90\221\322\001 \002\327\262\364\0344\321!\317mk%\356cf\246A\2758\350\030\237 \307\374\361\224\235v9\3717iPE\240r\310\364d1\214\334\230\375O\032!D\356\224\002."
+	.string	"0"
+	.string	"0"
+	.string	"\004\334\267\356\002\3347\203\266\314g\310\036\246\221\001\243\331]\251 \007\037A\377)\347\260Z\341\343faw\035Y-\216[o\333\300\266\264?\020\257_\373\374U\243\277\351\220\300|fv7f5+\333b#\266\357\261\035g*\346\340\321\376\311Q\300\277,\036\260\353jq\331\235\b\376t\337<\037\234x\325\324\366&\342Y\366x\2544\264\375}\205\242\333\305H\360UP\025\235H\212\373v\335\304XL^\2528\263g\030\365\303\276\266\273ku\331\017(/\244\247\357A-\002\241\274PC\351#I\211\221\003I\212L\237\004\025\330+A\230\344\311\363L\3223\367\332\252\313\f%2\225^\030 *\334/\334(\242\323![i\350\020"
+	.ascii	"\357b\310\304\223p\264\270\250 \032qB'?\204:\204 \256\261\255"
+	.ascii	"0\036\250\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.39.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"M\t"
+	.string	"\326\021@90\345(\035\336\363x\301`\353\242B\004\030MkH"
+	.string	"\2536\272Nd\333\324\036\254\3370\0067f4\236\2149\365Q\n\262\200 \307]\267I\032(\205\214\254\262\331M\244L)-"
+	.string	"0"
+	.string	"0"
+	.string	"\231?\355\004\231?wv\314#\310\376\325\221z\001\330]\250\037\357\236\235\177\224\013\250V\247\247\246aw\235\252\025\353\326\333F\260\r\355o\002\177\226\245S\323\327lH`\024^v9b\002\026\366ZDl\237c;\243)\300\302\323\276\311O\272\2730>\260\333ra\331\215\035'h\177\216/\b*\037l\350\311\327\324Nj\200+\256\302i\273\032\f~\312\205\205\026b\312\374]5\254\225\021\027*cv<\245z\330\317vw\255-\373\256\377=\006\245\355\243$.B\r\362\224\266\317\203\210\013A\212\t\210\020\004\2158\3501\360&\222\030A\322\266\215 '\356\263\325\226\035J`(\315\360&S\237\332\241-\037\017"
+	.ascii	"\357b\310\304#p4\341\202`z\240i&\344\301\006s\215m\205\361@5"
+	.ascii	"p\005\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeBoxReply.40.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`\353\005\035&"
+	.string	"\252E0\017H\200\\U:\0175\270i\371\321\313\3366`\256oId:\226\240D\203\033\243\252\206\335\026\b\211\375\250\021nY\373\007\320\2670}\037\266!\337\375n\202p\021)\242\314j\007\273\277\004L\244j\2777\260!B\b!{'\031\335"
+	.string	"\323"
+	.string	"\343"
+	.string	"\330\n\214\257\tWy*\277W\351f\303r^\252\242\3129Gh\b\354S\032\372\333\375\247K\371=)\343>93EQ\345\254\214\3205\366i+?@}\312\376G}\372\353\346\272\262)\377J\221\341\025\257\234\263\r\023\251\035U\276\327n\361\357\2626\006cW5\235\241\370\376\372Y\276\340H\035$\243\321e?\232\301\333\016I\362\361\330\232a)\251\307a\n\226\222x\234E\317\214\023\344Z\305\035(\006\247\032d^\365K4\322\270k\023\035WQ\013R\234\212"
+	.string	"0\036\241\270\n\323\371\253+@\026w\334\224\325\361\031*\001\353\206\224k\025y\240>B\332,\217,\002\271(J\323*\366@i9\347\326(\274\370\315\247G%q\226\222|\374\256\031r\316}\221\214Io"
+	.ascii	"\357>\332\335\272\356\364E\267\017\004\305n\033\200\335.p\253"
+	.ascii	"7\201?\337\003\200~\236\374}n\345\027\300\336\016p\250\367\354"
+	.ascii	"Qo\331\253\374\355\301\274W\365R\357\224\275\215\262\2671{\373"
+	.ascii	"\336\333G\020\313\223\345\300\231\263\215\257<\271L\352e\311"
+	.ascii	"\237\277\325\017\346\207\372\243~\251\253\335\357\213\371\230"
+	.ascii	"\356\266[<L'\300\361\244\364\324\242\273\375r\253\376U\267^~"
+	.ascii	"T\177\366\253>\365\333rg7\321\303\364\305zj"
+	.string	"\3517\273\005\343\013a\244\353\311\013G\325\367\322m\023\275\213\213\347\243\"\214\270\304\352\"\361-\375\251n\211\316\245F\023*\263Q\004\220\347\223\327\b\242\356\366\351=\363X\236\245[\251#\037\242j4\241\200,<\"a\302\241\033\252\306\032\025Y\346\225$]9+\037<m\f\335\001O!2\250\342c\033\300+\356-\327\024\300\006\360\207{\232\304\335\224H\263\270\274r\026Rhc\2425\342rZs6w\272P\237\026\300i\026\227\235$\320\371-\027\f\216\024\342iL@h\312YX\341\314\321\234@\217\344i\337p\352\221p\352S\002\370Wg\220\305\025\334\222\312\001\274_x\216\222\216\235\024\037\373o\200g\313\236\031f\322:\212\277\204\361\305(F\337\fw\314\260\2121N\365\f\235dX\305\027\013\035a\016\223\301\373\365\033\300\252'\312S\003\3407\177\177\340\230\262d#\274wzvW\334\037\223bw\217\024"
+	.string	"\177\3143\b\261\321m\242\341\244\tn\332k\252\f\317\260\2036GJ\3072|:\303=\300\373\325\264wSm\361\361\f#[G\310\340\375\352V\006/>v\177u\202\305\2451Sw\032\271\335\325\r\335r\273\034\213\033\016\266{Q\256C\021\017\205:\324\273\r\201\200\345XlX\213x\032t1v*n\273\236\316'\323\245\270\t\241C\276\034n\234\204\"\036\212\023B\276\0256\026\273\333\n\033\256\347\263I\bj\236\220\256g\033\342\361z\266V\t<fj)=e\20088%\303\307\236\261\211\001\341&\327mb\243\261\024?\313Y\257f\362\036\316UL\254]\300\021\345K\236\024s\213\217H\234I\330\017n\024\2538\305D\237\272b |,#u.2\366\346*\376a\200\024\263\334\202R\252\2029\317\301\214\032\346\324z5\377\325=,\261\206S)\001|"
+	.string	"\023\273\201\356\001\354\203["
+	.string	"\3567\017kr\026\355t\321\300F,>\366\004+5\b\247PfM\274\0344\347\234W||M\035\200\203\360\253\316\241\007\0202GJ\301s\250a0f\fR\314\bJ 4\"\2640M\007`\002\221\202Vu\020P\251\206\222t\023\3042\370\337(w\273\243p\236\002\251\225\300B\357B\257\002\2719u\214V\205\f"
+	.string	"\253\232\031\316z\367\004\244\200\370n\261L\316\205QWjFD\233V\017\215^"
+	.string	"/\024\007Y,.'V\2631\246\004\035Nx2>}\204`\345\206\231\3510b\n\f\202\333\331Cw\200\034\334\264%1\f\213\245j\251\267\3263@\200\375\027\235pN+b)\331\235\022(\007\302J\017R\027\033#c\206\205\006T\314\003Q\016\334\2105\276\330#07\3160\220\246\227\271\302R\275\225\300\365\201\022=h^\272\b\357\33003\270\240?\024\205\331p\237\227"
+	.ascii	"\\0H\222\324AY\321;\273i\373\327~_\310\240\340\302\025\025\352"
+	.ascii	"\027\t?\277U\210w\222\231\336\323G\026\025\331\177&j\250"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.41.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`\234\023\025N"
+	.string	"J~(\034@@\236N:O\343\255K\371\357G\025\353\212\360\344l\346\367\022\033`\252\320\031\351\3303\026\013E\344\240%\326\370\r\221\001-\207\340\007\351\345\004\307\022\316\325\341{/\221\337K\2650k\t!{'\031\273\001\213\001\273\001Wg\273Jy\266\367\316\324\236U^\251=\353v7~\017\356}\031\277\2622\200\336\367\325\312V\260\252\252\242\232A\257_\367\336S\254\373\006\f\264\262\026`]Y9PPE\225`\n\301\001\003RQ\005\blA=\r\020\020\300\251\t"
+	.ascii	"\323\222R\022\322\221Q\021Q\2239\264T&[v\315\330\355'!4V\007"
+	.ascii	"0-\354\r\354H\245\230A\0255\306k!>k}\220'm\215\211\244\221\316"
+	.ascii	"\245q\360\202\303C8\030k\372+C\304Cl5\275\2035k\232\004\357\212"
+	.ascii	"O\304\025i\n\236\276{y\336\301\n\244g\343\362\354ySc|U\341\251"
+	.ascii	"\n\2438\301\332T|\016\256[N\320\3209 \036\236\022<\202\300{\210"
+	.ascii	"\263\333\363\246\206\346\007\274<\003\033\033X\225\234\240\241"
+	.ascii	"s,:rk\017\004\304R\353\317\354\221r\305\347\337Z\201\356\b\342"
+	.ascii	"\243y8\252\212\232\337\013\254\023\360\350\342\256\370\324[3"
+	.ascii	"\337\2317W\363\207\t\\\314\357[\353T\024\277\263\007^J\361\211"
+	.ascii	"f\025\200\030\346\361^\236x0\324\001o\005\350w\027\371\246&\370"
+	.ascii	"\247\273\017\270\263\303\002\304<\200\230:\354D\367&:.\030\300"
+	.ascii	"\2263m\321\202\227\262\\)\013\026\234t\345HW\342\360\021\334"
+	.ascii	"\215\340\212V+\267i\222+>\335V\246\304)yN\264n\221\001b\273\342"
+	.ascii	"\263mm\006*\223\003\0057\331\316d{\202\207\326\276\\\223\362"
+	.ascii	"\362t\202\225RojM\236\274\342\263\311YZ\031n\227\234\025B\206"
+	.ascii	"\327$\317\253\225\243\232?\3144\347\312\204\266\305\354z\307"
+	.ascii	"G\322\3060N^x\337\267\261Y\232\332\373\301\273\327\242\356\246"
+	.ascii	"\320}\244!!F\340\233\345\334\f$l\225zl\206\3429\376\2133\321"
+	.ascii	"\031\036\325\271\036\341%(\243\2630T\262\263q\371\223;G\373\354"
+	.ascii	"\325w\307\211\003\365\022\306'\332\356\024+\360\315\236\211\316"
+	.ascii	"\346\250\316'\271#\334\257j\233\272\276\210\316\272P\311rX\023"
+	.ascii	"a\345\333\260\275\372\367\256\027\243\b\316\254{\006\r|\263^"
+	.ascii	"\222\356E:\n\311a\335{c8C\273\237\245\215V:S\351\316\270\277"
+	.ascii	"\274\226\270\273\222\270]<\316\273\005\013%n\025J\334)P<\315"
+	.ascii	"\373D\022\267\211\022\037|s\310\270#|\372\206\360\302w\322\377"
+	.ascii	"\336H-\356\243\026\267Q\022wQ\0227Q\022w\263\305\315lq\017\265"
+	.ascii	"\270\227-ne\213;\231\304\335\266\270\331\026\367\332\342\316"
+	.ascii	"-n\334\342\376\013*F76\350_\256\263\367\242U\007\275Tv\r\227"
+	.ascii	"O\3778\377\340\237\346/\374\377\376\274'\273\337\177\3638}D7"
+	.ascii	"S\302O\373\207m\\67l\036\207\323\254\023\222\356}_i\341\016\021"
+	.ascii	"\203T\tJ\302\276\033\036SG6\3756<\332\n\233G7\363\357i\372j\232"
+	.ascii	"\351\347\232\371`?Z\306\375\230\013v\3778\232^:\t\231\201\335"
+	.ascii	"\314\275>\240{2M8\001\320\357\356\312L\337\357\307\317\370\370"
+	.ascii	"+\344\271<\353kt\314R~L\277\f\337\373~\234LU\224s\357M#\341\306"
+	.ascii	"x\007\350}\367\260\224g\243\326\037\335\314\263\370z\315\374"
+	.ascii	"\335\361\334\347\001Q\206=\227fe\002\035\337\367\031"
+	.string	"\036\372\032\313\242\004N\344\b\371l\361\021\362\003\237\304\207%\254\317\242T\206v\0038\0058dV\314\326\347\034E>\253jQ\344\363\351\273\323\321)n\364\2422\024\320Qd\016\371\321oXs\323#\304m\354\357\314/\261@\206\266\211l\347\202\355b\301u\270\330DH@t\\-\3140H:9x\216\313e\275\240\217\366\254\211\314&BF\346]\020+\372\230\272Y\020@\234\350j\301B\304T\227\313\332\305\225k\345\332\263'\362\325|*\021r\254\016\340\0221\\\025\314B\344\215@\206\366\33761\022g+S\351W\317\325\022e\034*\360\224k\001\334\373:%t\273s\330\320\rC\200\361lc)\206\343\326\271v.\236\213\327\236%\312\007\374\025\025\302\2725b\270ZT\247\356\tT\201:\001N\0020\241\2229\251)\241\222=%\tB\212<B\203lD?a\006dhc%o\362\215ifv\221P\235"
+	.string	"#\303"
+	.string	"L%37\243\322\"46T2'\"\274\246\241u(7\243vT'\200\2419\246\34527\243rK\003\320\332\224\224Q\270\033C\006|3enF\237P\307\222\230\320\224 %\243\222\271\031EBu\002\2506AR\225\232d@>#\035\231j\216X;<\307\346\307\310\251\b\314#\353\344\212\212r\036\216\214t$\312\320V\236\253m\263W\237\235n\rX\215K\371\276N\b\215\2378\255C?\313\331\366\360\001\337\354C{\266\315y\320I\236\030\256\366\021n\217\314Q\311\232PG\332\230,\233\233\203iC\031r\271*\327\334\f|T.\017WC,\375\233dv\302\370 \332\356/:\364"
+	.string	"\363ba\350\350z1\343\205\215\256\257\345\214w\331\200\221\373+\253\007\230W\213\0339jh\331\230\321UC\353\013G\016\255\254"
+	.ascii	"\rv\003\006\016-\035``8\264\230{b\317T:\304#U,\2175\220\365}"
+	.ascii	"\337,<\357w\344\313{\347!\231\b\220~\226v\241\304\3001\332\263"
+	.ascii	"W\254\310q\303k\"\206\253p\r2\264\215\002i\225\310\354\225\252"
+	.ascii	">\303[\230L\375^\006\377\2166)\227\310F~\376\214\3251#\325zb"
+	.ascii	"\224r\351\225\217m\216\221\216d9\254\025\304\006\232e\370\r\213"
+	.ascii	"\214g\242X\210\367\3207-\213Z\265\310__Hw\354\306\364Y\264S]"
+	.ascii	"p\345\225Y1\016>\347\020\030\017a}\337\367\305\202\220\275\362"
+	.ascii	"\017\277a\255\r1\027:\2758\257\272r\222\213\334\225_V\250\335"
+	.ascii	"\270\034\306\305&6\346\267\261j\350\"\263\211\215\206\230\220"
+	.ascii	"\253\206\007\tj\221\217\370\251\304\306\334g\3571"
+	.string	"\220\025\225 \301B\0162\225\243\214#\013'\345\303\271^\f\245\013u\255\340\233\035\345K\377#l\f\223\210I\013\025P!\321\243\222UM!\231\2432\372\343\215\362\365\376\"l\344\022dh'\341 `\221\363\235\247\253#\345\263\365M\330\"\345\347=i\214\025\276)\254#e\026k \300\250\020\214 E>\232\353\305\240\202R{\244\222\3450%\334\373|\337WA\322\224\032\206\t\201!\344<\220\241\235\017\326\252XV\351;4\252V\253\324\203\265)\262\212\334\272\215\341j\027\345\024\271qY!1\\\215\303w\344\270OW\213\362}\337\"l\007\375\342\206\227\267^\271c4 \370\r\213\201\316D\243\360\342\257\346\001\201~\250aD\005\021C3#\"\"I\222\024\032\003\321\005\204\020\006\235\3316\021\240(\006!S%$)Iq\007O\223\"\266d\331\303\270(a\022wN\322\227#T\241 \222\367\337\322_\003"
+	.string	"pS\303\035_\203\270R\026\031\017\216/c\254\305`&\377p\346\217\307\220\362\035\025\204\217\206\360\b)_xh\316\b\fz\307\213\234HB\325\215\002\327W\275\330\222"
+	.ascii	"\005\264iz\004\030\372\216\b\001[\361\323\203\244d\"1\351\357"
+	.ascii	"\254\365\263_\264[\327\243M\246\354\266\263\245\216\300\203 "
+	.ascii	"\312\223\007\277\313h\231}\253G\332IR\2772x=Q\303d\272{\252\220"
+	.ascii	"\220\276\374u\244"
+	.string	"\314\023\367\206\304_\242\227\250\306\317\337d\232\365a"
+	.string	"\213\204xMCG:j\316o\266@\360E\026\374\326\235\345t\345\243\333j\372\213\247;\314\207\023\001\213B\311\021<\310\t\213\327!\252q\316\236\263\216\223DBQ\320h,\355\002\345\207\320\200>-\213\356\\\205\036\240Bm3EP+cF\247\252w\225n\034\t\235HE\020R\224R\252l\342\021\bAT\002\210Er\232\266F\252\304\t\245\024~\273\302{u\235\324\317T\271gf\263\245\220]\242T\243\177\027A\274s\031\231HB\300\017\252\306E\275\243r\223'N~p\267\224r\f\271\307 \fg\241x\201\211B\240\303\245\243\323C\351\252\320G?D\r"
+	.string	""
+	.string	"\347\275\024\2029\222\372\001\335>\b\275\230#=\216\327\344\301Z*=\231\370\276C\357]L\256\337\031\223e\007O)\344\r\002)E\201qb\314\312\343\f\0055\2179W\375Q\357\240\2026\373\330\356S\357I\351\253y\236\334_\212r%\271\305\035\240\"\235\033\345\264/\324\317ce\031|o\2304\036\036D|\361u\3149\216%0y\376^}\205\334\257\n\211\r<\233\234\312Z\217\021`\373\366\214\355is\004S\266\331\307\304>\367jV\337\004\245\346o\023=v\242Q\355\033\302\032\016S\356u,TB\301\233\002\327\307\320 <\210\f\016\b\367"
+	.ascii	"\212U\0029\361\\\300\377M\320\376\224\211p\354\221$\360\3202"
+	.ascii	"<>:\032\016q\235\004k\362|\331R\300o`\256?s\351\"\300\321\222"
+	.ascii	"\332\241\2043|\355\373A}\032\215\246\322\2323\212x\234\337\325"
+	.ascii	"\nH\266\327J-\036\235\375!u\3114\017\037\001&\024^\226\2535\221"
+	.ascii	"}\233\250\027\312\344\216\353U\t\264U{f\020\303\320\251r\347"
+	.ascii	"Z\374\212b\272\2259%\275Z\375\335\324\240\320\214\244\034\224"
+	.ascii	"#\027\264\321\030\207yJ\263\250\001"
+	.text
+	.section	.gnu.lto_getBoxIdState.42.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`;\002U\024"
+	.string	"\346\247\214I\260RN:\3735\276\2619>\305\254'+<\356\373\302Y\246\341\360\035\250\354\362\316;\207\271h\364\0045\333\265.M}\373\307\f>\"\325\373OY\342+\217\203\365[\223O\037\227\373r`\177\3046E\r\033!{o)e\n{"
+	.string	"k"
+	.string	"{"
+	.ascii	"\266u\3429\254\326\242\246\032\265\366\026<A\270\323\300\232"
+	.ascii	"\320\235rI\350\316\377g\320\300\366\236\355\241\b\332\024At0"
+	.ascii	"\200\324\332\243\365\211\355Y\220N\331\334\363\365"
+	.string	"Y\320\002\016\032t\205\250\306)M\202\222v2\336\217<\321\222\362\021\343y`\t\252\324Z;Pe\355x#\266\345\tQ\016\0202^N\232\\\231\350\261\277e \036\216\031T\251\265\236w<\241}\270\3779\374\247\3603M]\337\341\b\b\326\267\373\333\003L#\327\207\033\217\177\317\207\373\350\337\036\307q|\033\375\222?r\376\354|\221\363e\353\264\033r~H\371 \345S\312\237\222/)\277'\237%\177I\002\260\270\252\360\243\326\240\321\253Z\315)\025\353\333\375m\337\337c\337\336>\331\326\267\023\326\025\260\035\326\250UkE\331\371\224p\347{!\363\277.\366E\275:\033\264\273\301\226Q\272\241\331\n\226\266\334\372\361\302\361x\3313\303\376`\302Zs\016d?\300\232\342\356^\335\327m\306F\305\324dd\350NnX\b\250\035L\267\026\023,\200\324\364\323\221\343.\226\332\272\"!Gz\326\373[\230\356k\227"
+	.string	"\335\036\351\263n\b\267P+c\346\213t\321\206w\267\363kCwn\2037bp\rm\322\216\310\252\373\350<4\244\005 -\375\260r\0341"
+	.ascii	"!\345\375\303\032\226\025\230\027q%GCLm\203\004\361\302\313\004"
+	.ascii	"\035\261\245\344\245\246#\266\314\273\244\350\210-\030jpfh45"
+	.ascii	"\226\031\232\313\r\016-e\300\305\032\230\033Z\216(\336\320b\275"
+	.ascii	"\272\262\266\321\267\304\022\021\2255\037)}M\221-\245\252\236"
+	.ascii	"u\330@\377\303\276\312\255q\337\221\265\026A\320\362\361(k\255"
+	.ascii	"\025\234qH\377,.\274;Y\227\210X\262\312\265\317\263\236\252x"
+	.ascii	"P\224\005[$$ \240\002\021\262\353\006\377\030\256\026\017\244"
+	.ascii	"\f\240\201\034F\332\362Zq\026\206+(\372`\321\340\332\261\003"
+	.ascii	"RV\265\027G\310\001\233OFI&\323b\002\245\\\207n?\214\326Y\221"
+	.ascii	"\263\013\031\277\331c\346$\240\034\271+\21531\037\312A\237\213"
+	.ascii	"\231\0306Ab\315f"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.43.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`\251\002u\025"
+	.string	"\326\246\212J\300\020)\035\333\303\211s\016\377\034\212\t\336\3006S\217\"\017\006\267\311%\375\3748\305\320\226\0340\223\276\206\226\256\303\356\356\250\250r\025J\0341\206 \b\226\rtb\314o\254\365\036\241\251\350\330\323\320\201DF\032![\356\224\002w"
+	.string	"m"
+	.string	"w"
+	.ascii	"&t6\024-A\370N\324a\207iG\255\225F\362\021\361!}\210\370p?x\234"
+	.ascii	"\272\277F\227\030\322\235:\037x\2124\205\305\363\331\374E\037"
+	.ascii	"\264\362\360\032=\032(\002$\f3\036\374\354\371vs\034\362\001"
+	.ascii	"\272\353\303\367s1\303C\235\234I)\201*\027:`\276\035:\302c\304"
+	.ascii	"#}8s\037|Hdd\025\344\003\364\351:\251\265z\362|>\367\307m\017"
+	.ascii	"\331^`\317\242^![F\247Ab\260p\232|\371\277\336t\323\375\322="
+	.ascii	"\351\364C\004h\321p\020\254\225g\253G\245\n_\210x\323\277\344"
+	.ascii	"3\335\311&]\363\024^()\362(\374`\023\215\212'#\00556\371\360"
+	.ascii	"\266\316\007\232\364\227f\243M\317\030|*\252\252\265,y\350\003"
+	.ascii	"\343\303i\377\304\225t/-\\V\253\020\213\026\265\226\005<\033"
+	.ascii	"\037\272\034\237\364\273;\267G#\322\215\355\265``M\327\376>\023"
+	.ascii	"wa\373`JJ\207\303nn\211\261\271\313\3422\317\263H\324\025U\216"
+	.ascii	"\201\0211\200\341\376V\374\373 \277|E\242\254\250.t\343\247\211"
+	.ascii	"V\020AvC\221\022\320\006\316\344ar\322\365\235$\324\346y {\247"
+	.ascii	"\237\340\354U\231#k\3677\336Sb\311_kS\300\315\363<\243\240\250"
+	.ascii	"t\326\306.ws\177\366\001(\361.\004-)9\333J\230kI\311\331\022"
+	.ascii	"\334p\265\027\356E%\006\305\245\305\326`&\302\013L\f\312\rW\013"
+	.ascii	"`\026\223\234m\005\302\rW\243M\200Q\251\321Xdp4\223\001\266\335"
+	.ascii	"\\dh36\233\f\215,o\276B6\035we\344\222\334\354\316\262%wG\353"
+	.ascii	"fn\275\366\347\030\017WlC\034\341\230\356\231\272\346\036\370"
+	.ascii	"1\353H\306to\306\240(\351\264\326Z\307\375\371\301\277J\2200"
+	.ascii	"\022ak\0328 `\002\221Y\311\r\177\214\324h\362\353Rm~U:\215\245"
+	.ascii	"\036C\323\304\255~%\222\021w\366M\224\276\357\354 V\017\027\214"
+	.ascii	"F\271\tCe\205\206&\031\227\177w\346\202\013\3370C\221\252\333"
+	.ascii	"\201\0251\002\354\326\265O\016\224lNUj\024\357B0\034u\030\231"
+	.ascii	"\037\007NL\270L\027l\3100\303H\027\365.\016\325\202\206s\227"
+	.ascii	"\350\300w\326\303pi\215\037\302\350\356\325\004\313@\276+\222"
+	.ascii	"\231\332\360\004"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.58.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\205\n"
+	.string	"&\325H>0\247*\0350\337\214\210\210@\225\375wos\310\311:w'\\=\003\025\016\214\234\007<\003lu\027E\261\021\243\204\026\312\251\217\b\252\212\03087!\234k\241\033T\f/Z\333[\312\224\0028"
+	.string	"5"
+	.string	"4"
+	.string	"\033N\211e\333\033\216\311\247{\261UE\345\340c\306`\327\323\036\265\344\247k\302\223\237]\013u\375w\b \226\240k\205<\023\016+\235\335\265E\344\216\267-a;c_\013'\266o\377+\331\030\333dc\036mk\336+]F\202\336\266X\326\264/\340\003L\227\221|\331%A\240`\327\313<:\302\362\350\360\005\312#\274\002\345\321~"
+	.string	"\007\233z\347\317^`\363M\036\255\301\345\273G\237\343\350\310w\251\377\236.\017E\245\302\254\360pw\327\372\262\235V\247\363\336\177\nD\2070\262\273z\320`]qA\026\023\243\315\023\375\321\2146\017E\210\003i\031\030\025 \355#\3424\r\203\267\320\205H\333\3306\221\2069\\}\371\337\037\016d\252*\210\272\223R\225U\025f\373\222\327\023\270\001\256!\266\001\020"
+	.ascii	"\3571\036\026\356\320\206BY\340\fc\312\225\271\025\220\007F\004"
+	.ascii	"\22709O\316N\273k\216\240\316\360\220\232B\363\322k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`P\003\035\017"
+	.string	"T\025L\004"
+	.string	""
+	.string	""
+	.string	"\002:\177\027\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\"\f\200\204\001"
+	.string	""
+	.string	"\003\002#\177\030\376\315\373'\272\200\202\002!\031$\177\032\002&\177\033\002'\177\034(\177\035\316\334\263\007\002)\177\036\247\356\331\003\0055\0376 \002*\177!\377\377\377\3777\"8#+\177$\210\212\277\f\001.\177%\037"
+	.string	""
+	.string	"\200\200\200\001-\177&,\177'4\177(0\177)2\177*1\177+3\177,/\177-9\177.\003"
+	.string	"\017$\003\005\021D\003\005\020d\003\006\007"
+	.string	"\261\263\205\250\002\001\202\001\004\007\325\n\003\b\027$\003\b\023Dd\003\b\025\204\001\003\b\023\366\257\234\001\001\304\001\344\244\006\003\b\024\304\006\204\007\304\344\007\204\n\304\n\n\013\304\364\234\265\002\001\344\016\204\017\244\304\344\017\204\022\304\022\003\b\026\344\244\023\304\023\204\026\244\026\344\026\204\027\244\027\344\267\364\337"
+	.string	"\001\304\032\344\204\033\244\304\344\204\036\003\b\023\204\375\266\001\001\204fgg\003\b\017\330\331\202\224\001\001\204j\003\b\022\245\323\373\006\001\344n\003\013\030\346\336\301\357"
+	.string	"\016\027$\003\016"
+	.string	"\371\365\300\363\003\001B\003\016\013\306\227\353\244\001\001\202\001\003\016\023\303\335\2626\001\304\001"
+	.ascii	"N\250Q8\223B\n\264\330>k\360\002!*j\003\021\200$dH.\224\200\202"
+	.ascii	"\202\202\202\0168s\206mB\231\271z\2250 V\361\177\035\273\355"
+	.ascii	"\275C7\007/\210K\341\3545\204i~\224~\277J{\346\342\025\2727]"
+	.ascii	"\243\277B\303\237\017F\272\r-$\201\340\272\307E\234\240\004\331"
+	.ascii	"+\205\332\316\306\263\341\331\360\320\304\343\265\372L\367\025"
+	.ascii	"\212\036\300\006({\333\376\244Z\307@\021\231\026\037\265Q\257"
+	.ascii	"\321o\215\3215\261\207\370\020\bJ\255\253"
+	.text
+	.section	.gnu.lto_.refs.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375 X\025\002"
+	.string	"\362\204\016\031\240'i\f\343XUUUU\025Wq?\021p(a\177k-\335\227r\247\027\301\013L\364bf\305\236\230\036\266aZ@&\034\017\216\2061\331\310T"
+	.string	"\252=\223tF\347\210\001"
+	.ascii	"Z\224&"
+	.text
+	.section	.gnu.lto_.decls.58d6a0a0197fa1ed,"e",@progbits
+	.string	"(\265/\375`\262 \005\225"
+	.ascii	"*\363T5Q0P\322I\007\365\272\315x\325&R\020\214\270]M,\337\033"
+	.ascii	"v\366\375V\236\246\263\252\024\001h\376\341\177;\013,\254cD\251"
+	.ascii	"\372]\203\026\250\320\336\310\370q-\355`\326`\213\\DT\330\352"
+	.ascii	"\003K\024b\tr0\017[\327%\257)\"\211dK\231\002\305\002I\003W\003"
+	.ascii	"\351\217!cO\032\315c3\326c1\347\365\336\247\036\247q\030\235"
+	.ascii	"\344\312@\230\323\025\257\0249h\236\256\032\212\236\351\324s"
+	.ascii	"\030\376\302o6\334\373\274\367\016\220#\306\312z\244Q\256\013"
+	.ascii	"\236\301\234H\237\246\326[\306\201V\020\260F\025\340\236\024"
+	.ascii	"\345\023\351\035N\334\031\031\261F\317nY\370\315\256[@(W_z\367"
+	.ascii	"\256x\334\205\355\330\214\357\230\356\\\307\\\316\027\300\261"
+	.ascii	"\\z\345u\307[\370M'\271^'\340U\222&\037)|R\244\250i\013\322\304"
+	.ascii	"KE}\270'\265\374\245\236\223\250,\327\034\307sg9\326\202\263"
+	.ascii	"\274,\207\362\002:\314\013\324\260\035Q\222\245\3509K=\343\270"
+	.ascii	"9I|%\321\327\350\177Py\270'\375\031\313\001;k\016\246 mO\306"
+	.ascii	"\333\352\001\327(\233\316\023\f\023(\215ZY}r\262\370\335\230"
+	.ascii	"j\364;\250g*\\\205\315x\215\243\234\245\360\224\373\254\367."
+	.ascii	"\357\275A'\214\246c\357\365\001\266U\301\317b?\005\027\360\032"
+	.ascii	"\2471\032\317Mqp%L\357\336gp\215\213\340\247]\205\2707H\226\316"
+	.ascii	"\226\270'k|\367\256>)R\244\310\231\333\301\244JE?\202\312>\036"
+	.ascii	"\250\374\204\241\260\331\001|\266\356\34089i5\033}\006\352\271"
+	.ascii	"\354\0038\357\005\357Q\317\007\244\374\307\007\244\337yr\030"
+	.ascii	"\223Y\346R\363\226\335\273\232\330arC\210\221u\307F\255\217\b"
+	.ascii	"\034\215\362\312M\316N\036;\005\027\334&\2357\354\336\313N\013"
+	.ascii	"\232\367*\331\271\223\346^\345\016\363\002\314\013\240`WI\316"
+	.ascii	"R\364%\324\267\312\263rO\252\362\211\264\304\3373\300p\236\277"
+	.ascii	"\321\252h\320\273q\200\363n\342o\255\241\0301?\207\001\3633\322"
+	.ascii	"\227\377\\\274\374\f\204\021?\037\341\375<\343\356\347\251.\\"
+	.ascii	"\367\340\337?~F\200S\320\035\202\367\374\275\203\351g\342\226"
+	.ascii	"\237\217s'{\316\3375\f\360A\356\377\003\377\r\370;\350\347\025"
+	.ascii	"?\307\375\254\345g\270\237\337~v\373\371\312\317l?\253\375L\345"
+	.ascii	"g\264\237\241\374\374\344g\347\317M~\016\373\231\311\317^?/\371"
+	.ascii	"\231\353\347"
+	.string	"!~>\362\263\221\237\207\374,\344?\225\377i\377\325\200\374\334\374\277\300\337\307\237\253~\336\361s\322\317\313\237\203\370\331\207\237y\370\031\371s\361\347\033~\026\376\\\303\3172\374\f\303\317.\374\314\302\317*\374|\302\317-~\026\341\347\016~\326\340\347\t~\216\340g\340\317\r\374\314\300\177+?+\360\177\357\347\004~\016\340\177\226\237m~V\177F\377\277\360\377\354g\376\371\377\377\376\367\375\327\373\217\367\277\355\377\225\377l\377\177\376\277\375\277\371\373\373\373\373Q\237\0375\341'\340\203J^\\Og\223\233-\2522~R\300\034GH\264\2611a\322b_v\270\250\344\360\022\366\026\353/d\304\316\360[\315\325\036\230\264U=\177q\017a\326C\364\227\r\023\305\202\247w\237n@\300l9h|D\332\353o\256\356\352%8\315{\2276QyVC4j\305\nQ\245\324\325h\023\021|+\2614\210,E5\372"
+	.ascii	"\237"
+	.string	"H9\270\334\223\002W\024LE\202\244\267\310\334x\240\300\031\273dZI\336[=Uc\3267\206KK%\322F\210\264Vz/\257M\247\247\026\322C\336Y\317j-5y\357\221\337\324\023\212\277\213\274\265\344v\216\2100\"\205F\216W\030\273\035\215\036\345\241\036ER\377\376\323\253|\272\367F\325\254\367\351\b'\345\032f\024\177\016[\364Z\017\314\334;\326eF\345JSV\265\002\367\2777i\342\256\367\211\371\264J2\235\320A\231X/\220\001\3563\310e\256VPh\363\366]/\337\245\025T\016\314\265\371\304\\\233I\236\273l&\357]\241x\230e\312$3\237VP\314g\023\312\304]\336\344}*\201\250\313&\024\023\256\t\305\303|*\241\230K+(\023Et%\211S*c\225\206\241\230\313\333\304\304C\371\3043\307\\\233\027\357^.C\272O\f\334\313\243\371\204\247\324\301T\216\346\232\216\242(\233L"
+	.ascii	"\323\321U\363.\347\230]\315{\273\216\206.\223\005\311u\356f\361"
+	.ascii	"\\2\b\217\273\204to\001w\275\227\351\336$\337\271{o\362\336\013"
+	.ascii	"|\342\261\336K\305\303\334bb\272w\312\207\351\362H\252!\335\333"
+	.ascii	"e^\250@1\237W\315\240\332\223\347\326MZ\223\274u\361\254\236"
+	.ascii	"\324g\262\311]*\243nAI\221\351 O\233\2732g\023\025\265\255|\322"
+	.string	"\257\256+0\247\272\0060\265\244\251\371\343f-\013\025]\243\355\203\333\244\320Aq\361`\263\356q18\367\032P\242\b\220\037]\032\355\035]\245\n\371\212R\245\212*G\025:4\252f\342\036QF\306\032\375\231\236\372os3\344\310]\322\224\216(>%\"\254\254\215$\204\323\020\263\316\301Q\376_\240\022H\237\027\034}#\347\b\227\363\250Q\251&\2725\277Fo\2154T?\261YG5\323Y\254\233\242p\230S/\351$M\334\033Dl\353\336\265\243Z\251\227xnj\275Q\034\204Q\201\241GdF\300\245\350m\r\225\257U.u\235\226\245\243$\324\277m43\016G\017$\263Fj\246\317z\243n\256\322tL\361\335\247'\b:\311\207\261p\201\251kS\337g\275\314\261iR\221)\235j\037\035u6s\2542\207\226\264F\327\233)\246\224\"\222\017\250\3135\264\260\276\177aK\356\227F\317\177o6"
+	.ascii	"\271\376\232\3104\312~\301s\022\bHaSk\024\310'\322\364\241gk"
+	.ascii	"R\256 \301f\334\307h\216\256\367\226\3651\031\346\323Y\2567J"
+	.ascii	"\200#$R[|;y:\206\334@\321w\225z\346;\242\233\367\2265\223\220"
+	.ascii	";f\243l\206\317\260\031\n\336\263Y\256\367i\323\245L\217\262"
+	.ascii	"(\365\214\"\335a\024)\005\301s\231\324\313\n\0204\215\276\231"
+	.ascii	"\306\350\005J\202\267`7\313\033g_^5M\230{\326\353\267J\354\222"
+	.ascii	"\"8\244\344\032}\031\367\2446|\"e&\301[\"v\352\322\316 \351\342"
+	.ascii	"j\342$\325\325\350-\327o\205\260CP\260\224\205\205{\322\233$"
+	.ascii	"\301\333-f\037X\243%\220\330#B\234\234\341h\364\366\310o\265"
+	.ascii	"\254\221\036\376\374\216h\364x\334\223\346d\005o\213\304]\321"
+	.ascii	"\033k\024\207\210\035\202G\325e\246\321\333!\277\305\262Bt\262"
+	.ascii	"`\26555\312M\356I\003\270\n\336\006\271A{\363K\322\350\tke\201"
+	.ascii	"\\=\031\201\325\350-\220\337\376\260Mv\332\200\363\346V\307\307"
+	.ascii	"=\351\016\237Hm\217\340\255\017\365\357o-\253Q\035>\221\332*"
+	.ascii	"[\325Z|\225FJ\247N\210\r\245\257\032\267L5\354\016\333\005\347"
+	.ascii	"&\235\327\t\230\346vu\203\3572\247P\3344Qj\262\345\306\355\216"
+	.ascii	"\333)\n.x\030\325KI\027e\243V\307u\246\264T\321k\364\026\207"
+	.ascii	"\315\361\333\224\340\302z.\241R/\2013\007\024T\243V\352a\272"
+	.ascii	"+\314\322\230Fm\324\331\246\356\370\206@\305]\325\0355j\233\254"
+	.ascii	"\023\233\375\315>]\247J\222\331\233\224\372 \370o\251U\272]\372"
+	.ascii	"ml\252\370\300\262RR\177k\343\267\001\236u\251\332j\364*\222"
+	.ascii	"z\340\037\022\222M\n"
+	.string	"\202J\022il\240\2619m\222\020\\WKf6i\223v\031|\352\363\362\302\031C\202N\314\036\335.\255\022X\345\347\327\177\001\250\335\274->\260\032]~$\361\376\3139\343d\256\210#\342\234\322 !\325\327\327h\274\266\320,\255\200I{{\215\306\247i\357\236\366\242\274\200b\220"
+	.ascii	"r\304\367F\003\264!\246\005\325h\037\3610\351\226%K\216\364\215"
+	.ascii	"\031\323fn\227\327\207\333V\020rJk\231\267\031\235$$5\354\032"
+	.ascii	"m28he\352\366\236;K\372\224\272|\001\003\246\363|\232\026\314"
+	.ascii	"\031\025\030\037\223\261\372\252\321b\336y@\2558\254\250F;L;"
+	.ascii	"ip\245i\246r\352\357~\327^|\232\326No/\312\353\336)\024\266-"
+	.ascii	"\354\306\r#\336^r\276\324\214\2345\332x\317C\367\262\226^P\330"
+	.ascii	"x\262wD\304\334\\\333i\375\3201\305wS\204M\212\f\227\267\335"
+	.ascii	"\331l\214H\311\211u\235\017g\323I]"
+	.string	"\323\371h\2433\322Ii\337\220\265\345\026F\203\3634f\005\f\210\333\331\254\335:\016ES\251l`\311\252^a\361A\243\321~k86{\240\265\274\263\260\333k\224\353][\313\317,\235R\317\017\244\366\357\217\037H;e\266\261Y\267\361\033;\257S\211\0327o\213\357^,\020\354\354)\351\241\005\307\306\326ZY~\177d\266\372\246\254\231\365Zc\261\363B\031\307\234\256\240h\220\250y\251\235\315Z\255\257\330y\2237daS\020\324\3305\271\321aM\231\322ie5s6\306\310~\346\235F\327\205\344\354FYYG\311\002~\311\242\303\256\321\216\002dBs\304m\264\317\332\371\344\327\244l\264\315\316\266\003\005\r\322\020M\365\214\251.\253\321\327(\237\374I?U\236{dG\265\305B\370\376\340\360\306\306\372\251^v\2624\205\242F\357\371TB\366~r\0321\255\262F{m\247\r#\304P\302\013!\200"
+	.string	"4\202\b*\240"
+	.string	"\024B\013@.\224`\2028\024\276\220A$D\034\376\030\2172~\004 \"\222A$\026\211@$\220\260\207\3411\335\241h\034B\026\211@\030AB\"\024)<\026\t\213\2202\214\2202\212@E;\030\375\f\215/\024@\026\207\216\"\020\025\205\212\310\242q\005\024\216\303"
+	.string	">\244\342\307\200\027B\"\027A\304\021\216%\b\2152\220AB\030<Gc\361H\024\036\201H\241\013F\242\020b\020\207F\244\013;+`\020\"\207F\031n>\244\"\b9tq"
+	.string	"RH\002\017AF#\b\310\241\213\233\0268\b\005\031\235@\002a\020\334\371\220\n! a\321\020I\224\221\3001F\020Q\213\030\304a\2211\350F\210\fB\272\200\024\306\310\351)\022\"\217<\270"
+	.string	"\300\021\004\344\2208\344\341\201\310H\330\202\tb\013\002\210-\204EA)"
+	.string	"\260B"
+	.string	"G!\017,f\024Y\274 \016a\350\350L\240\002i\f2R\201\024\222\320s\241\241QH\024\306Po\001\006\022`\260b\006\360+6\230`\203\t\322\257\330 \030\334"
+	.string	"\203\240z\f\202\026\211$\266\350aH\02444\n\217:\310\017\251\200!\303EQ\220\320\210<\376\020\213EEE!\004^\020\205\366\b\004C\206\213cjD\032\331#\217,\204:\f\221BA8B\240\027%\f\2518\n_\024\213\200\204\214?B0p8\006\025!\207,f\024]\340 \201(\250@=\"\207.\320\017\375\3040\"`F\221EqH\034\032\361|H\305\017r(\306\220\bF\001G\240\030C\030\304b\b9\302\027E\024\214\302\031\303\"\033\242b\221\005P\315\013\341\321(\324Ah\004:\356\020\304\303\t$Q(d\024\032\001\031\213\310b\021\220\321\220\b\306\3201\310(4"
+	.string	"\362C\004\274h$4\376 \213E\343\317\315\213\022\220D!1\250\310(4\2729\002!\201V \211C\031\300\007\203!("
+	.string	"C\n$\250B*f\024]"
+	.ascii	"\031\035\213~\210\303\240\242\037!\343\361G\205\317\213\022f"
+	.ascii	"\024]\324\030\203\206\204PaQP\n3\212.\200c:N\007\215>4\264\026"
+	.ascii	"URky^\376\2520o\243hQzYT\302`\245~p<h\200IbAf\t\353\313U\032"
+	.ascii	"G\346\246\345\245\377\214X\3425\261\226\032\017\215j\327\204"
+	.ascii	"$\357n\307\334\330_V\243\226\213\r\302ri\333\305\332\335r\371"
+	.ascii	"\016\020\317\213\251L\353Z+g\f\330\236\021\272\316\333\353\221"
+	.ascii	"d\213\031\034$qN\264\314\365\027pm\315\362!\027G\005\004\313"
+	.ascii	"F\2436\356O\233)D\212\350i\201\003\202\022\302\316\3029u\374"
+	.ascii	"\216(\311\275e\271sBl\226\337\366\260n\275T5\225\327\350\365"
+	.ascii	"\264\202\267X:I\331\333[\333\025\272 U\354\225\337Z\261l:sJ\224"
+	.ascii	"ti\224\231\334\223\232\020\013\336\256\225\230\242\307\304\251"
+	.ascii	"\212\332\016\030V"
+	.string	"\020\253\366\3334K\345\246\211\\\232\257Fy\213{R\001\246\354\364@\222\234j\264'\n\332\031.Z\244\032\275\365\263gvS\310\020it\305\032\2745k1!\314\"\266\314Bi6\177\3345z\013\345\267N\354\023:e\221\"\2152\001R\202\267O\234\265(g\233%\263\3163^\256\222\032\275u\376v\265MR\346\322\252\253\321\t\270'M\213\b\336\216Y<(5\034\215\326\210\205\321x\202\243\321\350m\330o\223X&\351_\0223T\002\202\265\250R\3410\207\362\224S\204\324\214\310\2144\311p\242\n\020\004\302i\232\351e\007\022\200E5\320)\350fF\242T\332\3174!\370$u\254(5\275=\32615\t\f<\264\233\305\\z\nw\013\311\261\271;\003G\t\377\267\271$w\265\007J\023PN\200.\257r\034f\210\333\360\332\347e\021P\271\222r\272\256p\363`\374&\353\373Pg\ti1R\342p"
+	.string	"\343\2121\306\0138\333\035'\275\305\177U\021_\005\f\t\275G\271)x\263\210H\235l\210?b\242\372\032\252\320\307\314z\375\302\242\213\201\275\327\323t\204S\333\034\377\365\343\250xl\245\243/\322q\366\240\365\306\277\0346\330(T)\327\321\"\364\351\240\360\250\262\\\276+$\337Z\240\371+#\"A\361\311\253\001P\203g\002X0TY\301\331\211\354\241J\331\250\005^_\213\255C-\355\357E\342\223\275\327d\301\034\343h}\375\257\354Y .\365\007\347\311\246\241\266\2017\321\371t>v\302\213H[\224\226rj\033ZFP\360Q03\334\243H\n?(J\305\227\036z\311\250y}2\374'\360"
+	.string	"\005$\3661Rue\\\304\340\230\270\331\n\332:\311\235\304:W\030A\301\3372|D\330\224n\2329s\024,"
+	.ascii	"%;\345\031p\355\332zX~v\363h\016E)\215\030'\\\020\254\366\214"
+	.ascii	"\3047\267\354`\371\t\365\257X<\263rT\311`\340W\3043\007\326\321"
+	.ascii	"\240\2268\2204,_8\200rh\363\031\313\277\353\345\237\235\177\344"
+	.ascii	"\213 }\270e\026F;,7\274\321l\352\"\2341\224\237\032c\004\375"
+	.ascii	"\317\311W\325\f\bd\263{h\273\223X\211\204\200l\320\352x6\310"
+	.ascii	"\335\016G\250\022U:\\\330oF\270\335\273\006\177\026l.\372\342"
+	.ascii	"\2732\260A\203\367\275(\212j?\022\221\371,\rju)\246K$\362\225"
+	.ascii	"\250\3430\344]\317>\315\262&\255\257\356h\006\335r\272o\242\244"
+	.ascii	"<\2504\357L\03209U\302r\245\200\372\266\034&h\315O8\247\246z"
+	.ascii	"F\222\035\253\207W\306+\307\227\377\025m\372V\003\223z\305=\361"
+	.ascii	"B;I"
+	.ascii	"H\356\037\215\031v\325sP\226j$\261M\r\215*\316\304c\0204\245"
+	.ascii	"\\^\333S\274>\210\211\266\222\302\240\207\347C/+\036\035a\006"
+	.ascii	"h\327\316\266\370{\021v\347\316\224\375\233\266*\316\004\355"
+	.ascii	"\356\347X\226MUO-\001%I\237\314f\326\227P\363\235\013\030^\032"
+	.ascii	":\352\252Q2\035\303;\335\300NTq\310\347\227\350\336\204\312\363"
+	.ascii	"\276.G<\003\307t\214'&,\026\255\300`\253\013\355\005k$\262\201"
+	.ascii	"\277\243]\t3\331\354En\351\253\017\020Q&\272\234#f^\324Ia\362"
+	.ascii	"\322\211D+m\241\346^w\370\236\001\235\003#\223}\341F\"\274\233"
+	.ascii	"\264\266\304\005\353\300I\370\257\034\035\b\200\314\253o\226"
+	.ascii	"\b\245\225\363\375\\\344\265h`\365s\013M\bh\235N\016\265\367"
+	.ascii	"\325E\232b\317\270\271\313R|\030e\353\021\346\251s\031\275.\r"
+	.ascii	"\224;\203L\302Y*\376\265\024Pw\036\361\005\017FZ\256\344\266"
+	.ascii	"d\201\"\367\217\270h\002\246\225\376\273\366\271u\211"
+	.string	"S\3075\334I\004\035\271\357h7\315\3268\263\227*\033>\204\003\004\253\242\274\223\3400\271\366]\242\207\\&\362\n\244\354I\327'Ft\024\333xv\251\300=J\245\272Z\370\340w\230!\001w1i\031r!3u\016\024/\265\331\007\247\300G\016\377\001S\2660\373\275\027S\375\303\021s\220\333\206\001{\206\320Gb\022\0212\\sC\0302\242\221f\343\335\240\020\332KP\017L\246Z_[!\354\340\032\007\372\256\260\364z\377\277Gc0\302\3700\200\341\030\233BKsC\247\365\035\323\211\333RO4\306\313\r[\001\361\346\242V\022\270\3059\033\250\033\031\002\264\033\254\332\353OYQW\\\317r)\303\226\361\b!^\200\fn\241\343\336c{K\241\356\306O\220\320\372+R\036\304\217\273|\264V\211;\020H\301\360\026Uq\324\266\262\232L\303\217\373!\246\332\274\245a\272\030\020?t\271\263!A\322\034"
+	.string	"\006WX\302C\327\353\277\250A8\357\351&\325g\017\230X\364)E\016x\350^\370\367\354\032\233.\020bb\246K\024"
+	.ascii	"\bh:>\343\377\310\237\357/\353!\302\262\234,?\fy\351\320\013"
+	.ascii	"\004\275\215\016\346\\0\030t'\242\247\3431\347\r\305\036n9n\214"
+	.ascii	"9F\346u\327\345\257\3438T\261\241p\243f\032x\334\f\027\025G\275"
+	.ascii	"?u\376\031}\244\363a\242_4\036\351\231\"\037\f\036\025g\016\332"
+	.ascii	"'\363nl\213\266\034\201\370\303\335 \373\377\251\227\254x\341"
+	.ascii	"fH?\2208\203\377\017$\376\232\312\262\367\317\377y\275\200\262"
+	.ascii	"\036\374L\347\355{\3535\rx{\300\367|\232sS\276o^\272\376\347"
+	.ascii	"0)\363\341'\373\237\374?\377J\346F\177\316\007G\366\244z\345"
+	.ascii	"\331k\273V\\!\216\374\276\217+\310\324\352\304z\311\221\003\372"
+	.ascii	"\013\351n9%\360[\275\303\276\035\301|\327\226\007wx+"
+	.text
+	.section	.gnu.lto_.symtab.58d6a0a0197fa1ed,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.58d6a0a0197fa1ed,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1351 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	"\t"
+	.string	"\021"
+	.text
+	.section	.gnu.lto_.icf.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\316\002\365\f"
+	.ascii	"\302\31786P\215\263\006\325Ad\212\305\245\306\204}\364\213Co"
+	.ascii	"d=>\332\373q\204\324\026\252\220\262\220QUUU\225QUm\\cm\\\353"
+	.ascii	"&\"\"B\222\210\334RJ\3322q\263\254 \207\020\023\220N7K\3134\241"
+	.ascii	"\210\2340\261\340\323A\272P\214\025\250c\321\324\320\tj\365\375"
+	.ascii	"\324\342\263\221\342==T%\252n\323\0340\300\2315\233ACj"
+	.string	"\245}\366\231\255EqF\021\331]\350\220@\334\3600<\224\003\335\307\305\301\b\246=\234V$,8\350\201K\314\266\273\214Y\344\337\337\004\027\005\207\251T9+\343\303 \272\376^\317\333\326Zm\267\354\270\313m\322\032m%\225\024\b}\355\317\236\225CR@\230\177\247c\277\375:\375\232N\367\004B\250\t9\227\277\3655=\036S\205\025\217o\023< Q\304D\251\021_\250a\256\300$HASP\311p\220\202!\262\332\016\022\200\225!\ne\310,)\303\220\215\375\f\005[\371\250A9\351^\350\247\222\217\351\256\324\364.\2718\267=\001\206\326\373\265<pY\277\3276\263-\b9|6\374$\022\347\2544r\233\370\2123\335jx\301w\335%\204r\376i2]\365g\314\2168\244\361F\344p\217c\321\266{\343\324aB\363\274\017\275\256\206mu\366\375\352\220*64Q\237\324\301s\002s\355*G^"
+	.ascii	"\352\177\275\330\2748\f\205\326\300~\360\330b\202\371\210\033"
+	.ascii	"\306\201\320%\200\237\3473G\350\250cK\227\341\336\342\325\237"
+	.ascii	"\276\376\037\254$\023\n"
+	.text
+	.section	.gnu.lto_.ipa_sra.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375``\001%\006"
+	.ascii	"\362\307\023\027\220)\351\330\374\377\273\377\377'\274\377\021"
+	.ascii	"\272R\345\237\220\326\266\334)\005\3524\220+L\030\220\276\254"
+	.ascii	"\340\200\252\\z)\023\202>q\373F\200\263\367\336T\212\315\324"
+	.ascii	"\231\343+-\212Q\215\247\361x\350\307\204\016\264A\224\216\325"
+	.ascii	"w\375~\316EJ\004A\250\221Iu\224\302\316\032\340\002![7\021\320"
+	.ascii	"L\206\244\033\005U\2411d\271/\340k\036\232\321\307+\275,\203"
+	.ascii	"\347S\377M\260\221^\002:\340\001\tM\273\276\260A\022\356\360"
+	.ascii	"y\265]\n-j\340\213\252\300\027}=\002\340\366\346/+2\325*H\220"
+	.ascii	"~\204c\2609<@\216)\261V\250\006K\274(\204\225\302\023l\234N\033"
+	.ascii	"5j\\?4j:\346\003"
+	.text
+	.section	.gnu.lto_.inline.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\276\r\0051"
+	.string	"\352B\220\rD\240\\M:\004\357\013\3650"
+	.string	"\033\220M,\rL\224\335u3\036\324\273\321\3006`u|\271g\312\327\002V&)6\255\376\2239\202O\343\362\324\242\331W\270\317\237]\026u\227\265\220\372k\321\266\021\273w\222)\273"
+	.string	"\305"
+	.string	"\273"
+	.ascii	"\027\264V\301K`\325\222\205\302\004,W\314\230\213\213\252(\321"
+	.ascii	"IX)\321G\320f>\262\031\363`2\336\272Q\365\304\225Gt&\017\221"
+	.ascii	"\311\203\207\210\2021\314F\272\037\031\247\243.\371\250\374\374"
+	.ascii	"\317\2479\351\236\306\355v7f+]\026\363\317.\032\254\355\242\021"
+	.ascii	"\\\177u\264.\305\036\273\013$\024\245\245/\217\342\021\253-;"
+	.ascii	"\365\247?\217\036f\311\323\226zz\346^\005"
+	.string	"E\305\025\363\347\2344\261\273Mv\314\366\320Um\255\322\241\227P[\201Z\360\206\316\244\321\252\024\221h\325q\342c\265\223,\325\367s\337\335\365\354\017q\207\024\025.\332m\037\270^\255\037b\224\024\025.\231\035\344\332T\376n\207\"\307\215S\201ow;\304\037E\274\204\314\f\202\340\017\372\240\017\036E3]\330\264\211\006%\210t6VP.d>(A\332\2341\374\375\320\017o_\341\202\311\f\351P\356-\266\330\"\022\006\346\207r\255\272\252\252\272\2708\025\007\207\221!\377\213\024\207\344\330\203\365Y\342>\306\352I\024\033\322}@e\031\231\226R\31297\f\347\332\307\212\236\033\217\356\357\374\326\337\342\356\306I\215\016\002\376\267H/\323d\312T\315 \356Og\232\244j\267\030\344K\224\022\317 \b\202\341\372!\326\035\256\356n\322\341\206a\270\035n\325bK\212Z)F\360\301\343\324\006\006\327v\265\215F"
+	.string	"\264@,\242\025h\005\317\t\036\316`\333d\266sq\267\333\024\204\244\376\374nOC\343jw\317\317\363\313]\267\373d\300\023\fq\267\341&j\217\217?\301\360(By\372\302qO\020\304=\253K\253\207\364\374z&]\372\353\\\364\342\232\231\355\242+\200{Q[\273h\321K\374D\023\257\350L\217YAD'\036M\274\354e\213\321\342\354 h\200\246t\032p\224\350\240\331J\027\003G\211\216\232gG\027\270\332\223\322\n\342TbHA1\260w\371\255\221\316F\272\033\334\270+w9T\251n\334\005wC9\347\234\337.\207[J\3519\347\234s\3169\347\234sZ\356\356TU\335\020\203\300\320\265Q\177\272\337\215\346/\206\301\205N\227P\225\225$<l\026\240V'\305\037X^s\376%[?x\f9\270\306\006Wu\222\262\202JH(\200\317\336:"
+	.string	"NNWj\276\236\276\342|\001\331\366Ax\363#O\213J\337Y\3213\343)|P\r\261\243\201\301E\034\317\225\023$\006\343\240\030\243\214\n\031\266\273F\227\026\020\233?\033\351f\367\322\271v\233j\037\0365\365\346\306g [\215t6Y\rf\245\265\360l\020\021\006\2226p\022\204\210UKl\240x`\232}\324F:\317r\307\362\002\r\021\001H\221L\024;w\"\314\377\232<\003W\315\322\005/a\337\242\365\202\267\340L\036b\327\020)\252\001\236\251cv\215\030RP1{\351(\262\272\330\020\311\374\363E\276\310\352\322b A&\245\374\276\371\3315X\206X\201i\250\341P\210F\204DD$IR(t!\005\204I\350\224\025\017\022\300\024=\212\302\024\035I\223\324\311~l\006 "
+	.string	"\236E\366n\026\317c<\215{'r\3758\200\222\256]\025\230\2136Z\002\\\227/\316\rhCG\300\202\330\251\225pY3\027,N\346\337o\224\024fdI"
+	.string	"\016\316\3747\027\204\222\032\316\366\035\316\007e\272\363[^\0166I)\255L\262Y\260\347\"\215\364p\007\217\261\361\\\233\302\211\234FUO;\2362\206\332\256%.n\254\013S\245\375\343\204\237\340\312\235\347\246\002\321z\376\234:RXe\356\356\031U\207k\331jL\351J\314\276H\335W\242e\375\315\032\223\307\b\254"
+	.ascii	"E\306Yrz}\213\b%\325\342VG\033$NZ3B\217\320\244\304\211\351\230"
+	.ascii	"\316R\341\2555a \317\232\351 \224\026\241\256\270\275\033\356"
+	.ascii	"\020o\234\350YRV\022\n\030\207\024\001\302\005o`a\202\310Df\177"
+	.ascii	"\345\036\0309\022\317\246\221\240\024\224\366\206\237\364P\323"
+	.ascii	"\215\340Q\201M\274i6\256\214Z\270\243`C\240\023\373y\315\344"
+	.ascii	"\020\023\271\331\204\3573\251I~\321\363\3243\016\305\220>\361"
+	.ascii	"\251\356\207&\001\356D\254\227\250\237!\021\347\026\034\201\001"
+	.ascii	"\027Nb\277\033\247$\032"
+	.string	"{rZ\247e%\243\271\324\377O\311\272\262\300\371)\031\216\263\035\017\301\033{~\326\bl\036\366x{\034\274F\263\033\220n\271\211\220+\267\261\007\251v\0137\335\n\314\247\240\310\263\247\220Q!31\225~\347\352\217dnz\270B\272r\"x.\232\227\rfK\330V;\374\351\254\246e\2410qD\333\027$G\021\316\304u\347d\253C\031\304\341<\363na`\240\343`\n\314*R\207^\211M\3049\340>I@\320\257\247]0\360L\330\220\325\211\007\360\022#\023\265c(\006V\274\b]H\236z\323g\314\264\302k\177\312\250\353)|\327\026\003a\006\212\260`\233Y\336\3255Y\254\266\275\031\327\323T\302\306\337\f\271\306h\024\246\371|e\324\352-|P\027\204\321JZq\201\\Cc\343L\n\320\346\314\203\003\223\b\301\230\315^\275\235\306\307\231\035\214\364<\350aE\270\311\251\035\321\315\350\232\177\331"
+	.string	"\371\024\035\001\321}\271\260"
+	.string	"\343F"
+	.string	"\230\0016\3268\326\r\255o\310\316B\212\372\022\231v\231TwA^\023x\275\221\\xS\320g]\317Y\n@\215Dh\365\247\303N\313"
+	.ascii	"\354r,\n\213\277\363\301\255rOL\346\327}\t\3405\017\260\371\220"
+	.ascii	"C6{\204\207\340c\2107\222\262\"d\265\r\232"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\002\b\035\025"
+	.string	"v\031L:@m\222t;pd\001\n\256\247\233\264\030\353\0069}_\376H\361\315'\352\002\356EA\031\035U\345\024Q\270\271\374\275\030\233\255D\333\315pq\353\347\342\300\200\254\335\215\020\231d6"
+	.string	":"
+	.string	"?"
+	.string	"O\257\207$\223L\025Vr\314%\217r\305 ,\313\3640\275.\351\373\343`\235\233.\016_\234\311\"\350\355]|U\324k\017\372n\351\261\027\365\032\374\212\032\244\254\b\026\2579w;\204\305\344>\363\363|\033\254\033[\354;\t\372$4M\323DJ\233\271\2531\236\231\302:\264\310\203\270\337\312\330\350Uf0i_\352\266\347\226\221G\t\"O\214\001_H\037\006\233\013\372%^\304\274\t\034\345$\316C\377\030q!\017\330\361#\201\374\354\340R^\310e\350\037\363\322\215\233;D\345\005\3545pt"
+	.string	"'\242\362\324 QW\264\bUPEhc\232$\360\301z\345\345@\317\322\273\364\2465\240\323\351\2502\222\025\001\322\365\245\351\006z\030\r\362P\034\240%%\230\236z\210\202U\251\257\202yh<\316\202\325\304\031\\#k\344\273`-\211A\266T\007\200\245\250\201\275S$3\232TJ\313\032P\002!\244\254\310\003\022`\263\030\203\241@\2111\313\220\314\310\004I\023\226\224\026\262q\245\207BF}R7\227\335\004\250:\247\305\223\313\0023\371]&\tZ\330J\275\327\204)\252\3322CTp\346\211\362\225\357\201SYw'\230_H\035\220D\263\330\237\230\320g'\020\352\"\246'\034\316\234?o\005"
+	.ascii	"d+\322\r\3400\250\216$\334/\364\200\005\025\234\351\037\244\315"
+	.ascii	"|\210#\336\024H\204\205G\210\240\305)\307?\020R\320Yr\370\375"
+	.ascii	"\272\370a\005\342J[\334>Q\357E\347\347\026\256\003\021E\236\367"
+	.ascii	"\274e\004\b\262\350\025RY\217\277\200@\r\016\001gn\356\324B\221"
+	.ascii	"\376\325\203\026\234*\351\374\317\004^\210` \262\241\031\324"
+	.ascii	"\300]$\371\352{\037\326\365\365\352\3379d\263\365\264\360.\036"
+	.ascii	"[\202\265\301\204(\261\221\331jO\360\211\230\224&\220\345e\017"
+	.ascii	"\377l\332\225\210U$\200N\327\246\313z\244\260e\232z\324\002\006"
+	.ascii	"\022\031\206\225\261B\333+B\305\240\375\324\343\243\365XQx~\272"
+	.ascii	"\023\260<>\251\034\273\201\206\005L\250\377\f\002*\201\247\224"
+	.ascii	"\216w\"\027@\277b[Y\200\300\257\320\004x\216\360\007\260\274"
+	.ascii	"\257L0\200B\315\230\302,\335\323\016\204\372G\270\310\344\350"
+	.ascii	"J\344\005\301\317\0264,w\305\252P\216\f"
+	.text
+	.section	.gnu.lto_.pureconst.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\205\004\001\232\004\003\232\004\004\232\004\005\232\004\006"
+	.ascii	"\231\004\007\231\004\t\231\004\013\231\004\f\271\004\017\231"
+	.ascii	"\004\020\231\004\021\232\004\022\231\004\023\230\004\024\231"
+	.ascii	"\004\025\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\351\001\315\013"
+	.string	"\346Q:5`\207\223\341\240\020\2065\b\261\003\2073z\004P\302\252"
+	.string	"\200JZ\236\321\225\002B?\222\365\001\374\307)"
+	.string	"*\332\376\371\375I\243\370{\333\352\025\332D\032\331R\246("
+	.string	","
+	.string	")"
+	.string	"\013\3329\276\207\326\"\256SS\022\312\241}\342\334\365\316]\315\371\245|\342D\331\2118\345|\211\202(\351\255)G_\006\001\034\362\030W\304\030\233\201\3671\215YzE\033\333\302I\321\306&o\376\246$o=uu\364\001!\360\274\002\007\312\330D\023qC\313\t\t\252\267\371\031\243f\222\337\032\337dk\334L\366L\373E\371K\r\026\260$\016@\212v\216\033\213:\027\251 \312XD\301\001Kp\004\310<\356\302\032C\025\310S8a\3433\200-\370T\0064\357\021\350D\235Ei\230\237\223ftN\20587\205\321K\205\b\320\223\347\036\334A\250\0219\245\2305A\013\nm\354\006`\2021ee\035\021P\305S\030\264%\315\036\007)\240\351\004\241P\375\204\0261u\241"
+	.ascii	"S\264\327`\213\"\310\305\247x\032_\221\277 \312:)\251\231\213"
+	.ascii	"\355\201e49\266\321\276HY\225\354*D\227\253)\006\233\207\321"
+	.ascii	"\262\231h\005\306\234\351\036\206\037\244\325\355\020\001\346"
+	.ascii	"\237\004&\302p\203\224\200\003\244\371\013\032\373l\222\237\221"
+	.ascii	"\240\202\036\254\377\212\fj\230-\262\301\250\225c\344\032P\030"
+	.ascii	"\200\323}\371"
+	.text
+	.section	.gnu.lto_.lto.8524700292d8475a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.14.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\035\f"
+	.string	"\026\027TA"
+	.string	"Q5\035\230\303\257\355\352V\307\301\212^\374#\373\034\343a\363G\347\275~\222y\"\002l\250\216#\216\260 \200\341\302\336\205\016m\013*Q\030\312>\231\336[\257'\304kN\375\372~jd\357\224\002>"
+	.string	"?"
+	.string	"D"
+	.string	"*\320\001\354\236^\300\330\255\005l\331\236\271\276\242=\333N\321\236y\264m\274\212X\f\r\r+r\354.7C|\274\034\375\263.)\231B\227\221\004\273kY2u\270\347m\023\260\r\301\276\203\366\261\335]\317\223}\351\355\253_{\375\261\253~)\3710Q\301\261\313\341\265c]Y\f\022\266?\261\215I\333\300\201\361\253\317\353"
+	.string	"\017\255TK\201\254\030\002\204l\006\326\006\314\245\375\324S\214\017vw\027\237\b%N`\323\246\360\026\336\266\273\b|\026\027\276J\215\021 \355\031\006\245\343\203H\276\034\221\277q\317\320,\337\246\035Z\220/\371\2547P\341\"\315\220\217\342rn\323\222\204\032\311\227]Cr\202\b\037P\244\036\355\320\fG\354\036L\240\240\206\023R<D\032R\006_F\004\277\005\236\320\003\361\346\322\321t \r%xB\217\253\320i<n\003\206\334E\200?\017\0059\361\373@nR\367\330\316\2233\031.\321\034Y\233\001\023"
+	.string	"5\003\220\347\214w\201e\34218\032\\"
+	.ascii	"\214J\207\351\335\2105\301>c\241\271\006\034\207ap\007,\003%"
+	.ascii	"\202\021\001*\312\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.15.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\323\004\025\""
+	.string	"\366>\336I\200VR:w_"
+	.string	"7"
+	.string	"T\215\235\300L\316\007\231\235\262\313\301\215\351I\257\327\321\324\034s\027\346=&\322?i?\201\331\031\313\241\355\305\023\256\302o\030\242\316\206C\223\224\020\244\230\236\273\335\211\325\317\255\375\177\223-w\222\001\316"
+	.string	"\276"
+	.string	"\312"
+	.ascii	"pGW\302_r3\376\225=]\221\273@\006\365\324*\253\247d\273*\342"
+	.ascii	"\035\375\223|\214\177\013\030\030\377\214\262\351\326\203#e\032"
+	.ascii	"\360\216\362\233\0273\336\371\242h\352\252\302\031\270\2674}"
+	.ascii	"&8\312\txG\371\371\235{\224w\235{\224\215\314n=U6d\220epi\232"
+	.ascii	"\006;\007\377\252\361\276_owQ\333\325\310\007\340\204\254\215"
+	.ascii	"\311\362x\237\335Ua\371\270\227,.K$\367\246\366\261\251\372\273"
+	.ascii	"Z5\336\333\315\370\265\001\330\270\b\001.\221v\200\215\256&\277"
+	.ascii	"\245UE\035\2541\343\245E\343\326\352\320p\002\006\270\254\262"
+	.ascii	"C`\302\270n\366\252\\R\325\376\330\t\020Ak\306yi\325x\335\025"
+	.ascii	"\245i\3125\271\324:\333\234\231\2070s\022\263\335\021!2\210\025"
+	.ascii	"Q\373\224\247{\264\366\220X\234\223/\345)\b,\311\314.\036%\304"
+	.string	"\2010i\232\022=9\224\021|\036G\231\004R}\362(\037\351\036\345\351\372%)\003\330\357\233\035\201\032+H:\251Z\327gV\252\226\315\300\372\013/3\n\245\372\344N\353DI\343\336\250\372\310\374<\326\376b>\021\230\234\0337\016\346 \240\237\243\235}Nv\356y\331\231g'\007\007\370\347\371\006\255l\203V\376\241\225}\2672\317Wy\327\253|oe\224W\331\336y\356]\345z+_(\251\313\214\027\267n{\246Xus\351\032\252\366\343h?\331_\366;\377'\363\317\370ih,\204\216\317\024\213\303\226\224f[|\240\362\272\247y\302\214B\352\223,\344\323\274v\260\325\005IW\240\332\346\205w\3508\315l4bDR\237\364\351\247\335\327\fr#\356\315\252\217\314i0\230l\027\352\366\364\327\274t\241a\023P\371\306$\267\037\341\336\016\236ot\337\344\273f\226@\241>\331\3236\345b\013_\273`"
+	.ascii	"\f\302\256+\020f\017\247T\255+\236\013\006^\232R\021\361\265"
+	.ascii	"|K\006\273\341\350\036\335\243\267\357&F\3156\332G\322\261\207"
+	.ascii	"g\211\342\035K\211\017<\036/\356Q\333\r\007\343\006S\314\371"
+	.ascii	"\253,1t\240\3149f\332^\374G]`\0075\332\326f\305\234\252u\257"
+	.ascii	"\316\2714bl\177\361\212[\233H6\206\252\31213\210WY1"
+	.string	"$\326\200JP\304\242pI\250B\330!EQ\351\303\t!\021)\205\223N\223\323\322\256H\034j\360\265\020\236`\262\320C\241\224\30444*\022\207M>6\241@\005\222\022Q\350D\242\311i)\310\244\204\264\0244At\n*\370\341a\223\220\030,\016\207\304\340\357\231\276q\260\r\313\212{\223\352\2517\337\330\217\242\304\250;\315\266\327\215\323\312\217\235B\017\272\312\217\272l{9\rdqm\332\350\327\276\266\351\272\006\271U\177m\277 \217\\9N\373\332F\223\254\355\214\312o\3234M\177f'\200\205<\333\0015[\234\356V\262\335\335\364\034\362\314\006uN+\231\337\353/~\332m\020\263\373\323lQ`\337\264\262\311\231\215?\200&0\327\250\372\270\353/+\007\366O\213\bY\2501$\204\214\222F\031%\030\221\231\031m5\006`\002\031\262\253y\020pH\232\244\320\030\013\023)a\265\374\201\304\022\376\002N"
+	.string	"\"SjL\364\354\r\301%%$\376\273\024q.#=\021\340\\9#\301\034\311\246\363\306f\003\302\222\247\305\372m\221\257\2325\005\217\002\201\021?\304\324\207\364\320E\341((\n\2124\036\f\324\377\370\311\322\316\330/)dm1\026\037+D\256\310m\200\274B_\260\337\277V"
+	.ascii	"\374\200\260\227\375\034X\305>iL\330\366\307\300\006[5R\b&T}"
+	.ascii	"9j\237\230\t\374\314<\327\303D\310,\262:\271\363\240\353\004"
+	.ascii	"mh*<\232\254\035\272\236\225\262\337<\005\367\r\255z4\263\177"
+	.ascii	"\tL\005"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.16.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`G\002\255\023"
+	.string	"\366\244\201I\320\322(\035RWl\347\033D\243j@;fc\345}\213\266I\232\334\022&H\006\\\2522Q\024QcJ\355x\003`\004\330\b.w\n\357W0\210\277\3328@\211'0\333\002\254*\247\230~\316\350:\006!d\023\271S\nj"
+	.string	"f"
+	.string	"o"
+	.string	"'\341\247\307\023\370>\303\017\370>\035\263\217>\352\354s#ftJ\273{\322\022\326{\343\375\311\330\301oz*c>\317\017\334\024\325l\262\203\236\311\356\226\330f\274\0053\371\215\250\250\371\fq\317K1\262\335\224\3306x\246\017G:\256\273\244\261\321\244\036\367\0046H5[\315%\270\262\273\2265\233\207;\274m\020\266Yl\031!+S\275\331\243L~w\327\232c\233\276\363\207\367\271\301\367\334:\245\245'}"
+	.string	"\037\215\033\005\212v9,\tY\2429\204\342>\177\217\375\234\257\363y\371\312t\020\241\231\341\254\204\037}\234M\237f\320 \366\036\230pS\200@9\022>v\307\223O\253\204\2377\331\276\264\317\342-b\337\321p\001\2739FA\273\243\002\0076*\365\r\021\311\250\314$2T{\302J\276\346\222\037!\"\232\312\214K\022\201\303\323\233C\225*\346x\320d\020\333\024\276\273"
+	.string	"\n\355Tf\260Hd\273\0251.\343\345\373\224\n\n\355\200\354\370@/\bv\324lg8\fV\212\316\356:p\361\027-\377\304\247-\274\344k\237\376\353\373\004U\346\250\325\250^\257\373\f\262I\232\031\022#\227t70\261\305\342zAP\301P-\253\026\027T\312\004\203\252\305\345\001Ll\271D`b\213e\304)\224\n\250\225\250zIp\275X'\227\025\212uJ\211\257\023\212\001\267\\*\361\004k\265\304\223i\334\1775\307\346y\370S\203(Fg\240\336\034\340f\232t\232\220\246Qy\224\353A\223A\356}z3\314\247j\322\343>\177\330 \311\340\314\344\222\234&\362J\267\215\357\344\240\006- 0\002\204\030\303y\315\370w\fq<\007\022\231@\302\321\324}O\263\301\227"
+	.string	"\013\227\t\246\242\310=$\004\367K\b\276\245\241\r\330wL\367\002\262\304\300\242@\214"
+	.ascii	"\364@\242hS\250\354\341\220\261\240o\336\\w\250\002+\345m)D\260"
+	.ascii	"B\020;a+\3160F\363\236\216v1\026\361\016*\315\365\335z\232\373"
+	.ascii	"h\257\272\342N\333\311"
+	.text
+	.section	.gnu.lto_mspSerialReleaseSharedTelemetryPorts.17.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\\\002m\023"
+	.string	"\026\244~H\340\320(\035\313\034\301+\326A\"\210\206\307\033\255\224\305C\357\362\032\221\356\224\354\273 \n\345\351\216@\362?\206\352\245\312\374&\335\345\204\335=\206\032q-\314c\005\026\315\367\276\\\304A\0350-9\3415!d\023\271S\nh"
+	.string	"d"
+	.string	"n"
+	.string	"G\2735\221O\213\200\237\017\355\262\215^\253\331\333l^zp\273[\322\021\326w\265\333\223\256\177\336\354T\272\374\234#\220\345\306\330\353_\367\261\273\036\261\227N\001Lz"
+	.string	"P\314|~x\327\205\034\335nx\3048t 1&\306\333.ab-RO{\210\354g\214\315\\~\020v\327r\214y\270\301\333\226\261\035\301\226)\001\327\333>\203d/^\222XdNw\367\245:\263k/\371U\032;<\317\316\335Mi\355\244\245J?"
+	.string	"X\003i\206\201\334nL\016i\213\246\220\315y\376\235K\373\366S\3706\207\257]\205\353<*_\227\016\03500\034\022\360\323\265\203x\237\340\013x\237\366u|\232\303\317\005$\256\357\254\200{\342\003\262\335\004\036\256\310E_\366\220\252\366\251\202\374\350\007\"Z\364e\033u\241\f\341\215\bw\013R\roD8hN\032\222\321\351t\346\024O\252h\243\321\"s\330\266p\027)\337\215\350fw\033\264H\tx\r\341\200\316B\305\373\224\372\335\210ph\376\n\225\0042F\333\033\376\223bP\263\273\016z\356\243\362K|\032\003K~\374\364Y*c\2143\235\006-QEa\305\232pj\231NP'(&\223\017\r\247\023\024\t-Q\265\352\260\311\310\005\023J<\261JV\254T\t\005eJ\225LDVi\344\200U\253\223Xj\251Tb)\254\355\277J\223s\320'W\304\242\260Og\036"
+	.ascii	"b\206:IH\303H\243w\273\273\236\316\274\342u\032\352i\2376d?."
+	.ascii	"!`2''\001y\334\r\303\0239\250v\211). P\002Q\312\252<\317\030"
+	.ascii	"\322xK\nm\255!+j\337\263\361\220\210\005:\364\241\031(+ou\331"
+	.ascii	"\025\252\300\257\327\314\353\241\035:\346Mn\031\336I\2018\206"
+	.ascii	"5\210\327\005\303\t\0340\224C1\006[)4j,\350\315\317\365\0163"
+	.ascii	"\325He\203\2120\210\247-\362\2363I\306sE\220\031\216\033\330"
+	.ascii	"A\345\271\276[\231{i\257:\305\235\366\221\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.18.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\261\035\355Z"
+	.ascii	"\312\214@\037Q@PJ\352\233\224\323\310\2538\301\024\222)\317\333"
+	.ascii	"\372\353\266>Re\232tx\\D\230\325p\021\265\266o\352d\007TF6N6"
+	.ascii	"G\242n\006\213\216\320.\217\215\013\351\214\215\013\351~Q\225"
+	.ascii	"\331\341\353n\267\377\357g\246\230\235\376\2455\"\345\336)\245"
+	.ascii	"\024\321\001\305\001\354\001D\327y(u\026\272\316\037R\347\240"
+	.ascii	"\353\f\324s\036Z\347\237\236\263\217u\356\271\316<\251\263\207"
+	.ascii	"\353\274\223:\353\\g\341u\316\261\316\035\2543\316u\276\261\316"
+	.ascii	"\034\256\363\206\353lc\235\203\326\031\330s\376Yg\337u\356]\347"
+	.ascii	"{\235\355uV\255sj\235_u\356\256\321:\342\236f\206]\326\025G\264"
+	.ascii	"\2065Ne\373b\346\3562f\3403\177\300\fd\346\324\233\354\3307+"
+	.ascii	"r\356F\224;s3\351&\037t\323\203\306YW\257\273*\353J\346\304L"
+	.ascii	"\275V\231\254ul\253\275\316\261\25523C\221\370\200\247\232\f"
+	.ascii	"\005\034\027\211\226\214\362\\W2\342\013\351\251\216\202\022"
+	.ascii	"\021\202\370\344\324\304\264\244\224\204\004\342\310\250\210"
+	.ascii	"hH\350C\020\320\360\307\247\207\307\303\216\2160\247\003\316"
+	.ascii	"\r\207\r6A\340\317\327\273VM\337\247\270\177YT\035\005%B\006"
+	.ascii	";\017A\354\342ONp\335\264\005\n\2343i\361%\245\24477G\002\241"
+	.ascii	"\346GFT\272hJ*dF\305\211z\240\371\220\320\225\372\340\202\023"
+	.ascii	"\017\002z\322\304\207?c\355\263\004\fk\314{\206x<0\277|G\016"
+	.ascii	"K\354\210\353\\)a\n\251\020\030\226\021\317I\227\270\266huY\017"
+	.ascii	"\311a\365Hu\274(\357\032\f\253\210w`\202#vs\204\003\nA\206\374"
+	.ascii	"\206-\033\325G\360\b\007\020Hwa\375\330\372_Q\236\257\253\302"
+	.ascii	"t\357\325$\271W*\001%\03136\371\313\n\301\352\020i+\302C]X$\274"
+	.ascii	"\212b\253\216\t\264+G\217N\345\260\302\244B\353\272\366\223\366"
+	.ascii	"\032Y3\374\353\270\300\260"
+	.string	"\226&\245\311\204\bWwa\371\260\262)\032\035o\277,\244\215_\251u]\331\257\262r4\217h\346/\303\314#\230}\250\002L\317\321?\037\300\035\354<TX\365p\035\354Z)\254nx\326\362\307\025\034;W.JZ\007\321F\210\373\375\222\215\326F\036\264\205gP\337/\373\357\204$\t\322s\032k\254$kx\346\265\360\314\314\375%\013\313L\201\317`\001\314J\303T\363*c\220\317\013\232\247\232\276nq6XJ\312l\224}u\353#\362Y\003\367\032N\353#\362\016\311\272\322p\245\254\241\314\212O=\217\033M3\267\350\347\031\346\3212\273\3503G\037\225\363\311]\264\314/\032\257\270s\2558\231\316F\353\n\306\312@\325_r\227\031\242\3403\341\216\351\314qS\223K\177\311F}\264+>I\004'fv3\234\006n\027\372D\225g\031*_\303LF\325HI\266\242\374\035\267\230 \r\033v\3342"
+	.string	"\325\200\341\246\373q\231\343\376\342K\213\343\366\322\033\203\343\346r\267`\340\326b\2237\262p\273\251k\256p\267\245.X\341f\373!j\334k\316~\265Z]!\231\302M\245\333h[\3551\260n=\2310\327\022V\245\226\302\314cz\353J\325\\c\\\270\206\240L+\263\256\253\222\222\225\313\363\230\371\202>3\366\326u-\301\335\002\bO\fzFZ\345\366\300\266\332oD\004$\\M\232U\036e&\243\352\217F\243m\376K\346\376h4\332\306\357\305\334d\335+\272\331]\200\317Y\312\347<\200\317Y\005;\013p\235SX\347"
+	.ascii	"\2543\n\353|\342:\233H\235\001\270\316%Rg\022\327yD\3179\312"
+	.ascii	":C\365\234EX\347\020\327\231\230:?]g\247\324\271\311:3Y\347\245"
+	.ascii	"\353\254t\235\223\2563\222u\006a\235\217\254\263\321u.\272\316"
+	.ascii	"\001;_\302\256\251\363\255\265\344,\231'D\223\363Bg\316\253f"
+	.ascii	"k\0238\236\231\016dp\276\203\230\"\316\373\302\326\266tPml(\214"
+	.ascii	"q\250\244\322\023\375\261C\310\246\215\266\356\354\303\212\277"
+	.ascii	"\001s\274\371\213<{\353\240\332\217\240_r\1771\016\225P\236N"
+	.ascii	"\240_2\207\017~w\231\331\311qx`\030\024\261\346\2068\233\337"
+	.ascii	"\300\305\346\325\262(\324\002\337\242%\370\346H\032\370\301,"
+	.ascii	"\305\367\201E\305\232X\272\237t\333\230\242f\370Kv\237\206\241"
+	.ascii	"\243h\350\351,\255\342k0\253\3706#\322\220\036U\036M\177~\351"
+	.ascii	"\356\243\216\206\317{\371\376\203\360\2303\223a\206~\241\310"
+	.ascii	"\226\346i\200[9\342\245a:\177\317|\200\257! \346\n\257\367\277"
+	.ascii	"o%G\310$\363|\317\234\200\247\025\203\3225Wx\367}\337\314#t\311"
+	.ascii	"\274*\217\246*T"
+	.string	"\311\3213\305\330\345\344\371%K1v\215y:[`a\3046\206\351\354,73\017\277d\325\304\0162\256Lb\265\023\355\243\355}\2031\263S\300\313z\177\331\356\240M\0352\272\247\323\276Q\361\020\036\355\375\0063\343\302\274\2007q& <\033\340i\007l\253\367\273\254\221\252\350\300\252\276r\272h\323O\332\361e_\354\250\276\3754Jr\207\013g\341\250\276Z\026\203Xs\3053s\007\256\302\021\250n]W\023\314\017\270\022\bZ\335!\332\001I\037\254xT\327Wx]\264\377\351\253p!p!=\312\314/\374\253\370\357\003\373\002m\276\320\301)Y\035R\200{v\265\020\355\f\316V\027\331\302<\241\205h]n~\351\243\207`yz\365\317\215\203\020v\036_Kv-#\312%`LhcV\351 \332\013\033~y#\210\321'\247\306\304j!\032\0136\r\204\312s\204\026\242%\tJ`\231#p\022$"
+	.string	"\3468\013.\232\203\0300\030\330@\206\361\262\213\247\fZ\\\020\343\205\f\026\033\3100\0225\270\240\205\221\350\"\206\f\342\323\220al\360\"\006\221\003\0300b\020\201dk\247\353{\261\265\333:[\353uO\3319-gk\317=e\005`\001\236\245\252\036\271\256\353\0325\347E\005\312\355\274x\235\211H\321%\305\337\031-@\303t\220\215\204\020wp^P\230\304"
+	.string	"\036\205\226"
+	.string	"\036\030\026\2056m\374\333\273\241x,'\036\305\225\023\357\013\313\203\232`#\361"
+	.string	"\230(\361"
+	.string	"\254\225 \361\255\345\244n\355\251\251\357\232\004\021\246\266k)\2514\247&\250\177\"A\246\244\031!\345\2549\342\201J4QQ\314\232Q\017D\242\201z\"\342\241\2344yD|Ci&\345\031h\223\251hC\214\205\370\213tB\211bM\377Dt\372\247\025\234\232\276\265\232g\311<\"\257\344\303\230>\311\3223\375\327\322\373\302\310@c\350\340Z\223\245OA\fS\351\213\3341\223\224\206(\375E\322A\223^\b\322'\375\022\351U3:\271\016\256!\315\275\362\013\b\020\177\364&\024A<0\354\313\324\n\037\344\271\216\036\210\321\037\275\217\242\321\373\302\272\2105\213\276\007\321\027\375\216#\321?\227\267\241\327\nz\241\241\017/\364Y\037\202\276\265\306\350\222y]\324\322\034\025\365\\\223XB\324q=\300"
+	.ascii	"\217cxd\364K/\372\371/\262\345\344o\024uda:\201\236\331\200\257"
+	.ascii	"q\204S\341i\034\201\036\250\304\002m\016?\211@\332\025\036\013"
+	.ascii	"o5| \022\213X\363\347\221\305!\334\025\236\317\377|O\211=\025"
+	.ascii	"\002\277\202\360\234\032\363\351\251&\266U\237o\263fR\266A\233"
+	.ascii	"D\277\344\333E\333\263\246\330\363\027y\005\332\344y5\307\235"
+	.ascii	"(WxB\256\363\036\236\231\200\002\274\257x^\310"
+	.ascii	"\352\251x\347=|\332\226\314\253j\341\317c\202#\250\202`A\021"
+	.ascii	"[\244JDD\222\202$Y\306\242\f\2101\222:J\315\003\022\200\002-"
+	.ascii	"\306d \307 \"\002\t\b\032))j+\007\277"
+	.string	"\304\312\302\306Vl\341\255\330-\253SM\372\305\262\017\264\t\017\035\331N\372\031H\263\254)E\234\323\036'$VE\236\321}H\021G\346\300g\325\350\227\335\nx\260\004e\305N\367\216\334K\3548A&\177\276.q\322\3449\200\023\207\376X\003}\360\2164`o\266A\235\265\261\202\320p6\007\243tV\005\277\0201\2048\357^S\352\203\254P'\b\357\033\372v\271\234VY_\307b\001\254\003\240\022<\207\315\037 \246\366\276\326a\321j)b!\257\361\370\340Vc\314e&N\254\211\222\013.3z3\342\377O\360y\213\230\2253\371\300\211\243x/\343_)Wq4\336f[wK0c\337)\216\017\306E\203\323j\216\004\361\365\026\213\302\251\236\365\2631|xj7\317i\212\320ocT\241\202\235\270\374\2602;)\373\034?\271\034\215\317I\311\347\032&\232:\301d\"\030\201j4\255\n\036@\212"
+	.ascii	"\360\247P\231\033Vb\267\233\017\"J\343\363\\@\334\005\026.\252"
+	.ascii	"\273\304\t\032\025\035\325\255\0031m\215\3472\207\237\254\003"
+	.ascii	"y\365\222Tj\004@\366!~\342|\035\350\030\276{\323\007\307\016"
+	.ascii	"\333\362}\350\356y\336\r\266e\353\217\357\340\321\277\372\206"
+	.ascii	"\036T\241x+>\273ff\003H\344\204f~\016r\204l)$\241\244\036A(`"
+	.ascii	"\210\037-\335\364b\315\265\375\205L\234P\234l\016\200&\0162\272"
+	.ascii	"=3^"
+	.string	"\302\241u\230?n{\330\306N\324\006\202\037\216\335\253\235Q\236\276\017\305y\335\006B\001R\365=8n\027\\0V\250,\344Ec\310\231\372\364\302nW\367\365\336\363\272\230'\r'\255\242\351\247\266\363\004\350\313M\005\355\216)\3402B\231\334\\C\002E\372\257D\303\022\303\352]\007\357\tx+/\3604T\350\263G\026\346\231\222M\t\371\235\177M\340F\344\272\214\2173AxS\002+vt\007J\370\313V\352\316\301\311ka\353\023n\324\244\254$\320F\212\"/\016\206\031\216\324\345\236f3L\302\030m\250O\030\216\372\355\004\347\026`\2448\006\304\241'H\212\274E\306\206./\263\324\276\331\333([\332\262\227\013\306\002\367\026\363\007\033'\267EW<\026\240\245\222\031\250\210\226aZ;\316d\034\225\316Z\004EYktT\001\031\374b\354\312<^\356G\341\250d\006\n\372zn\337\374\241\034\245:\\"
+	.ascii	"\335\220\205\210#\255a8%\366&\241A%\277\216\215\367G\370\321"
+	.ascii	"|\244\345\314P-\005\376\354\030\375\3265%\260\333\033UN1\316"
+	.ascii	"\334\001\275\321\353g\300\310\214\257U\235E\031Y\222\371\004"
+	.ascii	"0\033\223\346\212\303\372\302\024{I\240\223v\331\212\312\034"
+	.ascii	"\027\364Q\203\343:\030h\013\364\361q1\247\374^J\2544\366{\305"
+	.ascii	"\004\266\253DU\220\311Mm]a\364\322\343\364~\300\025\b\2637\243"
+	.ascii	"\266u\256/5J\204\260\203\272\001\222\273\255\207\345{\033\306"
+	.ascii	"N\2201\300\352k\337\346\247\344\355^\021)G-q\302\023@\310G\312"
+	.ascii	"\305\347\030\234\232mxb\350Q\301t?[0\254\244\305\247\245\361"
+	.ascii	"\230\255\236\306trd\243\303\312'.\252\3429\366F \344\177:P\324"
+	.ascii	"<\031\275Gw\361\037\002"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.19.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\203\001\225\017"
+	.string	"\006^iE\360\256*\035\200\224<\bN\362T\371|\257\273\331\360\235\262M\270\266\3447+\337\311\354\317\244\232\355h\307\231\276\307\031\203\232e<A,u\023\331\030<\031\320m&\034o4^\345\b\026Z\371?\004\221\275\245L)U"
+	.string	"T"
+	.string	"T"
+	.ascii	"\326\350.\023,@9u\020\366\332X\200\225\320Z\314\tz\313\301\232"
+	.ascii	"0\f\303G\360"
+	.string	"\216\232\272\214\253)\377cc\321\372D.\243\206\365b\301\370X\3613#\363r\332\325\365\2514~8\371\236\366\330b\273\265\276\223\253\346\301\234\323\332\372Ln\356\266O\266\033\330\257\005\277\374\354\216\007\357\325\307\356\003\b`B\005\004\022s\276B\0273F\276x\260\215\2629\266u\304e\250\317\f\0233\346J\003\314e\316\271a\006\335\245\201\270j?\304E\240\016\206\020\310\230+\331\005\005\340\007p\227\335\005p\227V},\345\2353\345\204\313\234\340F\217\373\025\031\212\225\316\330\363\270\335:\260\335HR\342\234sFsV\267\263\nS\202\341\265\n ]\007?\204\273\344\254\256pe\030\321\320\b\276\273\331\223-\005\t\b\225\206[\273\261\276]\025\033\024\321\017lF\306\273\301\356D5\347\340\275\351>\3735\007\177\356\261\036\242\216\005\235@\022\342\b\304D!$\232\020\352\034\362t\2008J\"S\204\017\323\310\363\340"
+	.ascii	"\215\274P\311\344y\n\230\364!*y'\022\251\344q\300\371\030u\277"
+	.ascii	"\256\3050)\0213\262*\271*>\355\335\013\024\226\3554\033\017\254"
+	.ascii	"\354\206\333]\327i\227(-\333YG\225\253\353\262m\215  \240\002"
+	.ascii	"\241\273\355\3771L\243\371\t0\315|\210\345j\325/\306\340H\020"
+	.ascii	"\013\231\212\362\360\r\247\357\2339\270%\344\226w\336\206\274"
+	.ascii	"\331\bm\030!\2135\214&4ph\204E\324\235\335\320^\236E\266\230"
+	.ascii	"\222\353@\211\230.\361\004"
+	.text
+	.section	.gnu.lto_mspSerialSendFrame.20.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\250\003-\027"
+	.string	"Fk\226G\260\032Q:\270\347\314\271J\031;\251\002\377\002\266\204\261k\377\3738\320\277\006L\303e\351\263\331>P\337\331\320M.\354\372,\327W\\\036\f\307\363{i\375"
+	.string	"\326\277\216\235\341\241b`\372}\277\257K>\331D\312\224\002\201"
+	.string	"y"
+	.string	"\201"
+	.string	"F\002\246&\016\206\212\"s\316\002>\240<<\374XW\373\275\357\260\335\367\341\2529\201\230\024\231\323W\3006\342\245}\242m?\307u\330l$\240o\206\2164\202'\302\207\2269'k\300e\302K\3601\341\345\312\270\355\022\\\265\371\267K\005D\224\344t)\016\202\004~\212|"
+	.string	"\350p\240\214\021\f+&\035\b]\223\016\007\016\230s\236\350ZB\327\243Jj0\347\264\346t(\356\360\266+\330\276`\257Q\273\263\017\316\005\262\037\344\257\371\217\237\346<\376\231\373\376"
+	.ascii	"\037\272W\037\362\253.\364\247\336\343G\255\372$\325&\251\206"
+	.ascii	"\221\352\222T\213RMZuHRK\251\006C\365J\265\256\372\002bp\030"
+	.ascii	"AP2\247\211_\227\351D\036\261\361\241\337\266\371D6\331\036\352"
+	.ascii	" \336N\210@\250\354\3002\347\264\271t\004q\310\256\005\204 >"
+	.ascii	"H<\020b\302\340\207\207\231\324\304\005\t-X}\217\342\312#)[z"
+	.ascii	"+%\255m\341F\237\263i\tiI>Rx=\236\235\301\005\213\021pw\253\r"
+	.ascii	"w"
+	.string	"c\004\025\311\r7\274\"\342\013J\301\265_0}N\356\263$9\021\225\353\234\363\266\264p\367BP\025\234r\361Ium\235\f\372\334.\002\027\270\275\331\216\375\b\007q\316\231\30072a&\322\370\020^\352\232|\240\360z<\372\263j\277\253\275\227\324\242\366{\242\313\033B~!~z\364g\373n\03295\f2X\013\026s\215\0164\270j\263ZJ\006k\275\306W\370\032_+\203\265H\256\232\013\007\224\301Z#NN8\342\344\354\016-\266~\031\320\340\322\031a\264\233\035Z\214%\323q\305X\257\221\3062P\343\331\016ld\325f\263\221\345\233\007\347\002y\003\213\032\340\252\364b\305\317\332\374\264$l\237\326\rx\266G\356NMkK\270\301E1\255<\262\302Sm\315\302<\201\331\222Z\232-5)\255<\232\302\223Q\324\316\254\2706\205\n!\212\002B\250A`\205\004\b\031$\221H \"m\2129"
+	.string	"\003\021\241Z\007\021`)\205\244D\022%\205\007\003J\236\362\300\344\332\211\021\2034$@\326\224 \201|\367\366>p\335KD\336'<\307\254\t\201\302F\314\2732\230\243\352L\206\200\2345\200\220\244\203\210\3601p\377-\206"
+	.ascii	"g\022;;o\203\216\\\317\225bo\320\215y\300c\020\327baX\277pu\315"
+	.ascii	"\366\355\367\034\361\324\2150\001g\023\222\234\212P(1\303\334"
+	.ascii	"\016H\005"
+	.text
+	.section	.gnu.lto_mspSerialEncode.21.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\266\r\255A"
+	.string	"Jm\370\027=@\350M\007\310\245&e\253\340 \026\257\323b\036sU\347[8^\017\005\b\376\311'\022$a\221\242 D\373\340=\250\302\025!\221V\356\232\251uZ\301\035\"\"\"B\233\354\275SJ)h\001P\001s\001\006\342\004eQ\272\367,\020\323\345S\365x\351>\335p\272\343t\317\351\256\353\326\323\275\247Yg\231{\257\365\372\314Q\324\305\213\355<f\"s\3431\023[}\346\226\233\256\3454\235\276\323v}\307\304=>\350\372\020\345`\361t\236\266\365,\373\372n\260\255\366Mv\235\266\323v\235\230\222\231\274M$\211\342\356E\213\301\266\232t\246p\325\366\2341\366\306\005\351\340\024\371\335;\227\"\016\337)\233\311\333\204[\024G\002\016\337\261L4\026\016\034#\277{\357T\253\354\201}o7B\322\344m^Y\263\340l\210"
+	.ascii	"Z\2653\267\232^\323\366\\\221n\272\327\355\016\236{\347$\360"
+	.ascii	"\024\333*\317\261\314\314}\246\321\264\314w\351\334[Z\020\311"
+	.ascii	"\037\347\233J\367^+e;\255\255\246\035`m\365\261t\333MI\344\321"
+	.ascii	"X$\016\205lpU\323\367\226\233\331M\301"
+	.string	"$g\217\254,\201\353$2\215\340\227gR\017B\203K\235\316\272<\033\f\032\233\037\215E*M\234\222*\365Z\n\f\232\024\037\366 \26450hQ\\x\327RV\226\2745+\025\fv\260\262D\255\327c\232\023\257\314\325AhPR\345\275\367\210\247L\372\323\bk~\230\034\323\214\244N\202\256,\352\273v\263\264\246{\260\303\275\227\375\231\266\244\031@3\267\0243\023a6\036\003\3517^?p\223\t\360\336\313T\037\312\376\033:j\025\243\262\346R\035\2656x3n!\353\204'\200\205P\203\027\252\221y`\232>\324y\216\331\236G\222\240\266\1777\356\021\353?\2206}M\267\304\314!\272\321\210\377\r}j\374\233\321\363\217\314\003\333)\255\250\004{o\023\213\273\257\023\231H\277\262\326~f=U\237\036\006\035\2652\363\204\266\213b,6R\n\347\300M\250\013\245\340\336\302m\267\202\373\331\352\367\212=\221"
+	.string	"\375\236\274\237\331\005\f\357g\325+\233\317dn\276.\250'\263\214\016D\203\275\367Z"
+	.string	"\324\276\325\270B\264\205\310\332j\177\337u\372WG\367tB\346\201\314sL\177(s\247\367\335\230\215\3164z\256[\306\213\026(\262L\224\020\321}\2325d\3509\315X\355\246{B\357i\256j6\335SFg\007C\347\006\r\247\231\301\002\005\035\247Y\352\350\2544:'8:#H:G\025\235\241\212\316\007\210\316\006\206\316\005\214\316\004\214\316\003\216\316OFg'\243\263\200\243s\200\2423\200\242s\023\32199tF\016\235\217Eg#\322\271\210t&\032\235\207Gg\241\321\231\035:\007\213\316\353\320Y%:\247D\347\037:\273\320\271m\004\3356Y\331\301lq\234\177\031c\365I\013\305\373)\342\237\236\220\341\003 \305\271li\333\220"
+	.ascii	"~\306\037:g\264\211\212gi\305\300\265mH7\364\374K~\323\267c\031"
+	.ascii	"\221\374\340\233CH6\207\216]q\267\266\r\371vER\013\365\2661\344"
+	.ascii	"\007\r\035\222Sc<\262\255\035\323??y\316h\3218%\212K\031v+g\374"
+	.ascii	" {\201\256\346O\366\372A\223@e\"M\261\241\343C\264\324\032\036"
+	.ascii	"\212\213\"o\342L\336\344U\212T|\r\357\177\234\321\265\265V\342"
+	.ascii	"\027\277\313\326\214\020\277\365Z\204\023=J\316(\347\0359\213"
+	.ascii	"\033>\224\233\312\226K\302\207r\343\265\260\215\255KP\355\274"
+	.ascii	"\026~\371\242d\r\276\240\352;cHD\367^\254 \264NN\r\202W\275\360"
+	.ascii	"\207\377\242\305\017\251\274\341Z-\336O\341_\341\221\341\203"
+	.ascii	"\340\354w\236\233\255xzs$\376\\r\325\333\275\227\031\255\255"
+	.ascii	"N5s\353\245\375\342\375l\361\312\262gr\221\346\273U\352\331\217"
+	.ascii	"\321'\257l\315\b\033|?\342\315`\372\307\207\2223\032|(3\257a"
+	.ascii	"\234\254\025\343\327\231-\231'Dj\267rU\277~\020>\201\234\321"
+	.ascii	"\016\354\261\225\271=\323\2310\265k\234:\257\0374yS&R\257\017"
+	.ascii	"\215\266\217\265\352\241\260\\j\003H}\3466M\003\216Q\352J\355"
+	.ascii	"\032\344\233\207\347_\372\352\273!g\224A\264\244\\Cv\260\300"
+	.ascii	"\241\365\325C\210\226\212\t@\214^\\'\264~h\341\b\346\020\373"
+	.ascii	"\220C\354C\227\330\222\307\026\227\216-\326\213\353D\030\016"
+	.ascii	"\035\253\027\327\211\255\260\255\325\353k\3072\214\353\005\330"
+	.ascii	"\262k\370\203\213\307\226\026\330\n\266\354z\336\252\352\241"
+	.ascii	"\265#\214ky\003l\331e\345\265C\253\313j+liU\005\305_`\\aV?\276"
+	.ascii	"\276\302\254\210s\267\337\215}\344\211&i\b\333\362\250"
+	.string	"9N\265\003v\360\334\201\354\215\260\3302\275\327\n\207\273n\362c\343\201\334\344\247\3255\223\220T\335z\255\246\031ct\2710u,U3x\263\366\323\302\2664Q$\313F\005\317)+\365\013\336\214\031\2033\370\306k\274_`\267\302\301\233\214$\355\231\367\223\306\007\231\334(\317T\366\230(l|\315g\276\022C\321B\311\f\201Q\217\340\023d\300\372\004\b\276\355\252T}\324\337\200\344\214z\230f\337\263\305vX\377\364\344\022\024\236;P?#P\240\003vZ1u\f\374\2019\006>\370&\223\\\2018p\234\356\335\214\025\370\366\323\017\fa\002Ts\201\317Q\030\244{!\323o\226\374\360\034\365Z\330&\246\2568\334k\341\0272u\304\242\002\024\022$\001Ru\357\365\2356\355\n\021\201G\221\365\004\336\206\2353\372\364\003\262L\374\200\247\277\312\263s\372\336s3r&^\351e\255\340\235>\006 \272\022\215"
+	.string	"\325,8\361\003\274\200/!\342\005\004\370\nyr\026\\\r\201\027\250\2210\346\020C\246FDD\222$\3110\006Q\005\304 F!\342\r\021`\2514U3\"\005)HR\032\016"
+	.string	"9\355T\237\263R\304\037\002\315%o\260\t\262\f+\256\232m\200U\2620j\327\223\3526\322\322Q\243x|\260t^\210\270I=\002,[d6*\331\247 \302I\371p\021j\202\326\346U\275\201\233\236\023\261j$\231.!\367\005\241<\355g\207j\300\277\231v9T^\206=F5~\266\210L\346\3147\252Oq\023g\3616\242\240\035\277\341\273\270^\2529\350_+\250\033\016\201x\370\266oG\267F\362,n\024\314\275G\nw\314\nP*Z1\025B\b\211\fQ.Tv\336\022\005\311\\~\307\344a\361?\002K{D\321aC=\272L@\272\330?\317{l\003 \253cW\021\007\360d\223\037\332\306\363%\332LFqk\003\371\216\034C\004\t\006\346"
+	.string	"`  j,J$\306\230\321\n\034\237\t\355o\232\025\313\362\344Q\342\264_\274\277\262&\372\036)!\\&\347\265YH\375\365\3053:j\232+*'\232#\034\277\016\345iUs\3562\032\332O\b\214\243\311qyy\3320)\242uD\317H\243\314P(FQ\237m&"
+	.ascii	"\0376b\224\307B\364r\302\322\244\331N\212\302x\221O\0079\312"
+	.ascii	"#\352`\223\227Yl\206\3642\307\034\211\363\242;c6\331J\325b\236"
+	.ascii	"\212{@(\\m\235D%Q\230\031\223Hp\352\204\022H\345\307-\254\204"
+	.ascii	"\277\200z\b\205\335\276^2\230\357\245\323\250d\021;r\374El\005"
+	.ascii	"\315\f\244H\006mJ\034\233\212\2462b\371\335C\006|\0023\313\317"
+	.ascii	"\255t"
+	.string	"\307\314\260\233\345u\316\221\213\332\207X\f\333\341F\211fu\237\037:n2\370.e\035\277k\003\304#{\261D\302\323\244\373}|\003HWR\364\026K\247$\277"
+	.ascii	"\023O\272s\314\345\267\273\271\nM\360l\260\247\277z1Q\240\340"
+	.ascii	"DX;\354\2349k:\311\235\002*\272\256g\321\213\353Fi\013\276d\275"
+	.ascii	"\020\031\242\217\247\022W\333\222)\272\242\006"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.22.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\273\004%\036"
+	.string	"\026t\271J\240\230Q:\300\243\364\336(\033\205\rV\327|\031\373\335M\364\304HP\275\353\264\334\311\302\323\035o%\313l\0245\321\361k\214U{.\"n;\345\361\3626B3\002\336\244)\024\220\037\312|\2162\205\322\327d\033\331d\357$\003\241"
+	.string	"\231"
+	.string	"\250"
+	.ascii	"K\316$\350S@\357\242#\035\246\037\307\356#\022\257\337\2471!"
+	.ascii	"ZvR\332H<-\244\225N\222C\005=j\305\214(\355_\211/\351\023\262"
+	.ascii	"\273\035\374r\316\353wV\376\306\264)\213!\255\326\007[\304`M"
+	.ascii	"\004ed\325\235B`\007\257_f\346\033\371S\020\243\261t\t\211@\f"
+	.ascii	"\032/\224 \273S\032\247/`\376\276~c\376Z\035G_\332\212\362O|"
+	.ascii	"Y\344K\322\367\353\275\224q[686!3\340GT\0260\362\341;\361\025"
+	.ascii	"\306o\250VW\205\356\346\352\373!\235\357\231Y\207\231Q0\227h"
+	.ascii	"\002RN\305& GQ\302\357\224\331\321\371j\304\241\200\350R\306"
+	.ascii	"\367';.`\021\331-t\037\277\311\235\220\340\367\370\345s\247\336"
+	.ascii	"\367\313\3371M\274\230\343\032\363\355D\034\327~/\2608\2245\005"
+	.ascii	"\024\252I\346\264W-\016\346\227mo0se\331\243\3168O\377\330\203"
+	.ascii	"?L@e\227Me\263\246\362\rP\271\004P\331\276*WW\345'\370U#\303"
+	.ascii	"\364d\3516J\236i\254\353\344\307\243~\341?\365S\335\254\2279"
+	.ascii	"\210\257\344R\037\236\3105T@e'\301\272\231\224\200t\037\341\002"
+	.ascii	"P^\210\252\031VP_u)\324\211\370\252\017Q#\257\230\305\261\265"
+	.ascii	"\006\225\336:\026\331\036\363Q\363\302\273\200Y\220\227\231C"
+	.ascii	"\333\261>4\355\320\306\265#?\332L{\243\\q\n^;\024\301\265\322"
+	.ascii	"^\373\027i\204P$\007c\241\264\267\311\312V\320Z\255jo\2555\321"
+	.ascii	"\024\r\031\342\234w\271P-\001\241\025\247\240\315\032zI\372\304"
+	.ascii	"pQq\300\330\335\031\276E\303\253\273kZJl@\260\324\335oa\376\336"
+	.ascii	"\362\264\244|\300c93\007\356\360\222\231\314\037N\264q\355\205"
+	.ascii	"\336\200\311\034\342D\021\\\273\300b\2211Ur\017\214\001,R\354"
+	.ascii	"xx\027\347\362\301\360s\352`'"
+	.string	"\320\317\355\3474}0\234\360\271\345r\272\234\363\344\301\351x\036vg\356fw\346,\343\"\244\270\365\360xN\023\2733G\363\351\271\345h8\336I\213p\200u;\036\036\355G\247\343\321j\322>\313\354L\310\0161*\234\002*\273mP8\325\177L\"\274\314Za\326VR\t\241\272,\3142\243:\320\035\263\"\333\343Q{(\223\215\361\201\321e\r4\001Q:\022dP\371\311\235\tC\316(=\245y\325\317\240Al\214\013\226P!(\221z\037\333\\\315\300ra{_2s\264\262\026\007\363W\23086\326\304#e\250\2010\207\234!J\215\020\005I\n\222\244\003p\002\021*\243;\020`X\323\202\2449E\223By\362\367\177\351\002\334\367b}\206-%\320x\300\320\345\216\253\2117\322\340\237X\t\222b=\021\216\355\304\016\025\034\232\310\354 \210\224t2\327\236P2\264t\024\373\257\375\0071\232\322\027"
+	.string	"\020@\023,DP\226!*\003 \352/jM\352\021\253\007f\t\335\"<@.\301,\362\207\230=Ds: \020\002\343\002\271\2141\250.\273\336r\227\240)<N\262\310l\362"
+	.ascii	";\352QR\031\257\266^\230\013\013s\241\2339\214\270e\023^=\243"
+	.ascii	"R2\020\245\003\267\\S_w<i\017\b\223EgK\213\224Q\314U@\321\240"
+	.ascii	"|\305\266Y\302>\257Q;:\320\312\021\357\312*\371)_\250\001"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.23.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`L\001-\016"
+	.string	"\346\030]E\360\224\232\016X@t)\177\332\335G\353b)\3106X\262\271\274\355(\337UR\321B\247\213\n\346\255YD\202d\200\325\316\b\212\020I\266x\016\023g w\335\272\212\006\312\316\354}\321iv\330\310\356&wJ\001I"
+	.string	"E"
+	.string	"K"
+	.string	"\376\354\234\2072k\255\360\361\201F\311\356b\232\342\337\247\2544~\276\313\347\312\215\364\340\001;\304\352\203\223:\201/\327\352S\003\346\020"
+	.string	"\232\252"
+	.string	"/r\\|\306c\b\260\024\243\245\262\273\216'\260\304m\335v\005\333\017\354\243\b\nc\037\365\313\207\277V\321\277\020"
+	.ascii	"\021\262\331\354\216H5\331 \222G\013\333\367\330\326h\177\034"
+	.ascii	"|\017Y>`KC@4x\264\037\3432\276\243ZN`\027\306F\307n\310\300\013"
+	.ascii	"\256K\207?0/\257\027\230\227\001\033\027\177\342\346\345\365"
+	.ascii	"d\007\311\022\224\232\330!\302H\025\357M[\303i\274kwS\374\032"
+	.ascii	"\243\r\006dv\367*Z\346\345\311K\221\031\035RL\371\206\305\021"
+	.ascii	"\022\2521Vp\226\251z\002F\022\032DL\221\211\035\226\242\306\330"
+	.ascii	"\257vw\035\035\350\002\004\n\031\007-\013e\035\200Q\307E\020"
+	.ascii	"y\233\345\020J\006\220\326e\236\004\221\267a+\032h\303B\235\207"
+	.ascii	"\241$0'\312:l\304q\035\346\tIW!ii\036\307\316\214\216{\340\270"
+	.ascii	"\374\220z\235`\013\257\321\256]S\212o\343708! \220\202\021\271"
+	.ascii	"\273\001\377bH\241\361\b\201\0024\007\022\267gc\2712\260\203"
+	.ascii	"\004vD\345$@\230@F\234\013\2715\320\362\276\262\217\214\nA\017"
+	.ascii	"]\004m\013H\233\304\016\210j\360\346\006H\024\360%\220\313\205"
+	.ascii	"\257e\205\274\342\246\321\b\024\n"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.24.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`w\002\205\023"
+	.string	"F\243}F\340\362f8\3238QKu\210\221G\bF\273\215$\341n\207\212\022\2719\366d=\262\325\236\020\b.\274a\310\0222r'.o\351r\346r\206\020c\216\263G\2542\310}\306\367\020\0038\250\241\317\233\354\275\245L)o"
+	.string	"_"
+	.string	"k"
+	.string	"\007=\263\243\3163\261\253\237\251\333\013\251\335ui\211\317.\256B\360\323\234\371\264\213$9)V/\372\003 \232\3606\222\233\tMN\344@a\003<\036r\024\f\177\212\b\341\261\311\371\367%\320\341\361\241\225\333\360\2318\221\b\302\312\331R\277\002:\021S\255\\\355C\331\321t{\321\223&g\313\\\251\354\256\023\227\263\271\001\3346\216m\006v\362\004\342\3566\360YT\310 \372\034\364c\302\203\327\027\375\300M\225\320N&{6\217\226\332c_{\275^\317\252\263\277\373G\276t\230iP\323\237\246U\323\231\351\267N\206\234bK\2735=\"\333\004\336"
+	.ascii	"b\331~\332\037:\321\354\273\230\013\330\325\001Q\332\345-\260"
+	.ascii	"\002\361\240y7\t\017\212/\t\003\267\221\035\202v\007\311Or\224"
+	.ascii	"x\320\211\333\032\016A\366g\330\216R\034$\251]\332u\022\267\b"
+	.ascii	"X;\266\254\2121\202\n\252p!\324s\263B\006L\035PGU\237\217\277"
+	.ascii	"\302Oug\324\303\226T\372\351\200\0373A5S8\214\227\352\223\240"
+	.ascii	"F\322\206\305\362\270\324\017\331\251)\355\247\032\321;R\217"
+	.ascii	"\341u\202\021\224-\251lcx\21310\262\030\204\227\021\266rK\212"
+	.ascii	"\005\226\227\314e\\y\031a\256\013/\026\230\253E6\272R\b8\366"
+	.ascii	"\342\"s\301\304b2\027\213\267\377Vu\2515_\306\255\362\355\356"
+	.ascii	"\212%\031\252\035A\002\212Mi\266W\216CC\353\351\344)T]:\232z"
+	.ascii	"\215\007`\n\261\"I\273\305%\217s\213\tDSMi>\215\237\3304\321"
+	.ascii	"\262\210\203\033\221O\250=\276\222\0033 p\002\2219\274\003\257"
+	.ascii	"1\346\361\326\027M\303\225=\004%]\f\315\376P\025\354f\226T\265"
+	.ascii	"\305\335\3337\3361\307z{\005\224\274\235\305\310\311\tle\357"
+	.ascii	"\310c\351\311\305hx\304t\215\026\217x\211j Q\232\013\264E9}^"
+	.ascii	"\301\003\017t\265k\337\035^\330h\005\004\326\331\365\032\rp\235"
+	.ascii	"]\315k\264\360\222\037\312\001\236#\230\200\266j\024\007\222"
+	.ascii	"]\255.YXQ"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.25.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\313\001\215\020"
+	.string	"F_nG\360\320&\035\226A\251\207@u\271\351^\307\222\3722D\307t\2266?/\377\322\342\311\341VO\272z\f\006\240=TD\251\273gT\264\365\017\265\271\301l\322\033\b\250\307\003i^\3509\b\337\333y\017b\311&r\247\024U"
+	.string	"U"
+	.string	"]"
+	.ascii	"2#\237V\260}^D\212\035DL\373\242\023\343.\355\243x\n\330qV\036"
+	.ascii	"\262K#\364bWD\340\221\355\323\342\003h\237\333\001h\237\206\331"
+	.ascii	"B\027cK\272\211\305\214D\273\313i\315a\2270\377\343?\302\031"
+	.ascii	"\226KR\202\335\265\fg>\334z\333\007l\233\330RB_\241\362m\374"
+	.ascii	"Q\305\017?Mgi\2373\204\317\211\241\026\331\303\026Y\244\216\260"
+	.ascii	"\237\355\356Zi\354\213\177\3518\377\266IO\222t\246I\353\224\226"
+	.ascii	"\231\364M\006\214jp\350\331\365\320\303h\203f\214\233\357\374"
+	.ascii	"\366?\032\304\317\271\016\354;\257/\214\f\203\033\022C\273\001"
+	.ascii	"\236j7\370\370\300\247L\247>\206G\013\204\373D\310t\232\370Q"
+	.ascii	"\265'\\\206\324\253\252\036\301\224pq\205\303\260\260I\375\340"
+	.ascii	"\231\261\003\347j_x\017\350\223\235\362\021\345\323'J\321O\210"
+	.ascii	"\303w\261A@,\264So\321m\273{b\321\3120\340\206\315\212\366y\245"
+	.ascii	"Pd#\004\241\222%>O\257\225\327}\263e\362Zy\035\n\bv)\327\347"
+	.ascii	"\300\003Y!\036\310R\247HV(\325\327\201)\036\310\342Z*\024\213"
+	.ascii	"K} GR\300.\257\3738\r.\327\307\201\210\373l\225\306\030\216\202"
+	.ascii	"Z\324\305\257lWD\311w\376\241\234\023\315^p\032'\245\330\254"
+	.ascii	"\001\"\312A@^\305G\225\255\244\226@:\202^\224%# `\202!e\351\001"
+	.ascii	"\257\030s<\211\303\325MX77\252\276[\312\371\336lld\\\347\212"
+	.ascii	"\274\262\275f0\321\352\207C\235/\240\333\215v\023\340\016\275"
+	.ascii	"\205\374\245\361\373^\262b\313\372\237\274\276ph\n\3339\266<"
+	.ascii	"|\314\204\261D\217\b\220(\240\313\213\366\221\001"
+	.text
+	.section	.gnu.lto_mspSerialProcess.26.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\356\t\2554"
+	.string	"\252YT\024A@\346Q\007m\230H\024\264\206Y\337\\\030\020v\375\331\036\\U-v>\254\020y\351\320\217g\247\216\f\255\371\022\235\036\262\223\306\257h\267\333\215\276\214\367\363-\226TT\261\331\347\226\266\355\275\223L)2\001 \0017\001?\326\220\254\310T\037\003;\031 I\305\330*M\314\206\237\267M\375y\356v3?\203\035MH\003\343\370\213.M\034S%4\204\237\267J\216\344z\313\372\221\353m\303\335\177\234\032\026{\034\234s\r/\216\343\343Wib\277\263T\357"
+	.string	"\017;R\200#"
+	.string	"\306\"Q\300\320H\370\006\201?\237\333\262\237\341v_\2075g\247<\343\236\321\246#\261E+t\214\235P\225\003P\311\022\363#"
+	.ascii	"F\366\300\235:^\334\n\305\302&\340\222r\306\313\240Vr\321\n\r"
+	.ascii	"sf\242\233\345\345\002\206Fl\205+<.\267B\241\260BDN<^\006\355"
+	.ascii	"\312\302w\212\2210\177\271\312\240Or\220\325p\006\306\212[\241"
+	.ascii	"Y\330'\3036\267\225\201K_YZ\376c\231\356\324\030r+T\213E\302"
+	.ascii	"\312\362t9_*\203:\311>\027zU/w\331\2469J\316\334\n\275\302\032"
+	.ascii	"\247\364I{\243Er\353#\213\023\350+\013\213\263l\004=\\\266\206"
+	.ascii	"\321+\366H\353M\217\303y>\022\265\312\357m\316\244\b\317,\357"
+	.ascii	"+K\314\263\257C\034\307\235\237\321,\357\001\336\355c\335\035"
+	.ascii	"\355\376\201\005\277L\333c\225\021u\367\013\237\003\325\316\331"
+	.ascii	"]\220#\343\275\332\201\201\343q`\270\336\346o\347\354\362\320"
+	.ascii	"\332\347`4\250{vw\020w#\343\030\026\3071\0066\336fF\273\230\267"
+	.ascii	"]\003\231\375\211t\275M\372\247\363dR|\177\207s\bW\273\252+\233"
+	.ascii	"\036\221\274\227\245\344\231\243\345_\332Mm\346\007\253\276\231"
+	.ascii	"\t\323\017\326\335\304\344d\334\037\270\232{\003Gs_\340q\336"
+	.ascii	"\n\\\215\367\222\277y'\271\233\267"
+	.string	"\321\331\274\213\301\334\304`\356\341\233\333(\230[8\314\375\032\345\016\ns\003\205\271\177\302\334>`n7\230\273}s\263o\356\017\346\316\300\334>\301\327\300\272\270\310\320\374\225\032c\355)\212\253\255\034\231\307\271\253qws\177sgC\323\236\306\345\372U\243TjRc\254!zufx\320_\334\016\245&\025\201\336\235\031\030\247\231\3663\016\327\357\0333\t\2407p\267\033\225\307E\240@,2:\311\237\227io\353\327\333\246`\001v\266\036\277X\213\317-.\356.\216\251\020\274m\033?o\375U\013WC.)y\214\234\303t\317\310\207\311\233\360\245\271\t\217\371\306\250\211\345x\317\271\234\254\341\021:\346\007S`i\366'\3237y-\252^\375\3608\253\274\260\025\367}\267V\361D\260\025\022SB\210\362\336\007:\365\b\240\2012(h\344\360\230\033|/\203\261\270!xL\303\364\256\020\241\340\373\330\364\302"
+	.string	"\037l\201\271d\177\266"
+	.string	"\272A\325+\2576\\\312~/m\277\341\002\337\313~\357{\340\377\"\247\223*!\356\202\377\275\353\307)W\225\367Z\301\373>\306\036\233s\213Av?\351\013\034&\373S\301+]}\263\227\336}\340\365P\202\334~7|\006O\263?\227\336\233D\261\372\246\037\250\250i\027\273>\355\273\234K\2303\224\207\366w\372\220i\363\275\364\203\333\355\301\353>D\230\206]\365"
+	.ascii	"\347\n\201!\304~w\b\3073\"\302\024\254\313\354\216\f\032h\325"
+	.ascii	".3+\353\347)\250@\3566q\"\373\223}\007tk\252U\337\274`\225s\305"
+	.ascii	"M\341\376/\323\370\f\310\371\273Y\264\310\376\374\247Jt\227w"
+	.ascii	"g\365\315v7?pf-\333\025\377\227\267\033\274$\203X\207rsNn\343"
+	.ascii	")\212\212\231T:\375\246\226\276\244\210)\246\262\350\343\311"
+	.ascii	"F\262\304\324R)\005L\212\370\241C\352i\2051)\302F\022\031\025"
+	.ascii	"\245\374\300d>9)\227*\244\230QG\310)$\b)\346\211\244\022\305"
+	.ascii	"\323\024\222J\007\222\307\023\200vj\322\201\314\261|b\326\220"
+	.ascii	"bF\035\2239\220QG\247%\363\330d\240\225RO\313\343\224R\271<\276"
+	.ascii	"\324\330\037l\315\177e\226@\363\356\210|\225\030\244\2276q\353"
+	.ascii	"\250\351\333+\271\217t\376\223\346D\312\244|\002\274\264\207"
+	.ascii	"[\374\246\3676?6\271\246]\313tU\345\275\274\345(CN"
+	.string	"\302\202\243^g=\253Z)y\n\312\002p!\023\277\215\337JO\240\332\250Z\335\226\026\361\223\340\264\320,\344a\023X\213\005\023\250%J\206O\264\243\206\347\250*&g\204\363\024dt\234q\304\234\345.\347\301@{\177^\2467\376\021*\327\370\017\220Pi\016\272\303\307*#Z\200\247FW\244s\243\377 4z\030\031\n\205c\252\005+'\021~\335TK\327\031\033\307qL|i\273\277\031(`l\004<\030\222#\371I!7\200\002{}\2335Z\275\372\346\303\021\272\0163\021w\026\311\001\200\272\250a4&\211SfdDDD\232$i\f\220\002\221!\263n\021@54\206\206\202H\264s\344\203\273%\336\200$gP\037\273\364\026t\036\031Yh\320\324\360k\357\343\001R\216\235\210X\234:\333q\304\370\304\230\254\241\333y\013\255\377\267\302\035\352_~\254\323+\253\2615\231\256\304\217\234\225~/\304"
+	.string	"[\3741\351\227\017\216Pq\220\351\t%2\222\206\215ZV;\013\316\255\212\373\344\315\357L\027W\270\244\\\244&\0243\251\377\233~\247\035\275\006\202\360\222\032@\221\343\261T\005.\227\204\363\270[5=\337\032f\332K\212\305\371\324\030}t\257\250of\301\362\344pl(\377\356\345\224x\204\225\310\355)\363>\246\031\350\271=$\225YM\337\355\325D&\370x\320\303\322\232\363\314\335\034\232F\023\034\030t\315\r\275\266`\223\212\037\323~\2568brn\3018\302\031\263\263{X\2223\300\265'\301\001\340\212\236Vd\205\033\374\372jO\350\234\037-Z\303\325\016\206\324\017\003\203\023\262\303Z\301\330\253x,\212]\351\233\372q\310djfw1\321\361-\315\274\377\320\017\264\366L"
+	.ascii	"\030\321Y\373o\b\260\361w:`px\211\237\"\323\324\357\006\b\231"
+	.ascii	"\242\305\030\350\017\030<\026\0256\027[4&\325\370\027\367.,\t"
+	.ascii	"\204E 4\223\250\311d\\\227\237H\261\214IO\037!}y\206\n"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.27.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\333\001\345\021"
+	.string	"6awH\340\360&\035\332\327\372\307\330\257Bq\276\033<0\227\265\352f\266V\210\243\314\275D\252\036\3704`r\036l\357\007\262\335\271EYT\374\037\231\037\204|\304X\206\020O\307\020R\210\007\343\n\267\260U\305o\204\354-eJ\001c"
+	.string	"^"
+	.string	"c"
+	.ascii	"s\332T\333\343}\264\335\236\272\216\362:\031W]\376\353\250( "
+	.ascii	"\251&\026\021\274\250'\263y\027\035\314\204F|\204\260\270D\270"
+	.ascii	"\334O\324\304Tz:280\374\360\030\017,\005\341|\204\033\342\200"
+	.ascii	"\233\242\245\327\2562!\214\356i7\020kqcb\021\332\\=\2219\247"
+	.ascii	"\025\f=\334\036\267\335c[\201\375\033\001`S\314\016\027}\332"
+	.ascii	"9\347k\227\307\266\275\364"
+	.string	"3J@0\357\216\235\262Z~vG\251\336\250\326U\037@I\r\315Lx\220iN\232'\035\023I\036\231\370\354\366k\037\362iN]~\306\362\t\233\031|d@4\346\264\201\\\032\004uy\273\305N9\301\202\026\273n\363\241! +\021\263\302)5@\034\345\350H\272\335\357\006\343Cu\355\025\005=\270{\027IMH0\373\262vX\n\n!c\316\\\021\267\215\233\"\245\370\225N\367\273\275\200\321\034\266M\256be$\226s\232s2\260\255\341\267\n\037\212\345\204\346\234\rR\234\350\304\377\2714\353\202\036\274\364[\335\245\356H,\207\203\026\367\373\332!\334\002\030V\023P\036\250|\254\024\017\227\204X 1\371V-\t)\255\023\025\212\t\311\211\252\344k\251B\n\230\225\262\372T*,\326\247J\331\346w\307GqT\fY\rg\344\371\256\356\265{\374\310\206pF\362wuR\256E\\\366\205\003jy\034"
+	.string	"\247K\255$\241\226Q\031\217sy\314\322\305M\355i\217\240\003\316\200\345\274\350\223j' `\202Ae\311\003\257\030\035\207\026\375\020\345w\363H\251\361\3164-"
+	.string	"\005\013\034\033\233\265\367\230\373\266\331,dm\314\321\036\005y%+\233\006\244\267\025\215\226\021\r"
+	.ascii	"\033-\n\277\021\211[\334\312tqT&\307o\243\274\200\306\366Uw\230"
+	.ascii	"Ru0\264F\354\327>\021\367\272\372\023"
+	.text
+	.section	.gnu.lto_mspSerialInit.28.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\205\007"
+	.string	"R\216470\217\222\016$\036\262@\301i-\326\001\247\276x\352\261\230\023\031\035w\036\252g\364\373\351\021\310^\366\322U\r\017\203\201\001C\303\222\337\230P\030\254/\252Qk\204\310\024w6\f\234O\346\021-\204D\240\330\360\341\200b'\023\305M\301X\310\223\305\007\f\313\242\206\313Z\tQ\007\2546\272\0224\235y\2179ht&\250\215y\327JO\301$\264#\345F\003\251\314R\267\253*\t\304\365\350u\304\350u\353uG\230^/1\361\272}\260\312\350(\240\366\234\366 \307\327J\210zK \344\344T\013\225\314\213\027\227\354.\224\217\277\232I\317R.\225\004 &\025%-\231\031aGI}\244[\221f\266\223\326\007\240\220\231\277\355\204\321a\177\203\037\341W\005\n"
+	.ascii	"\357b\310\304\023\276h\361P\021!\214\350\032\356\026\302x\031"
+	.ascii	"\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_mspSerialPush.29.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\375\004\245!"
+	.string	"F\377\332Ep\250M:C\2275\332\021\251d\217V\\\205=\252\273\245\316#r\225:\240\016&"
+	.string	"g\177\377\272\017\031\026A\255>\360\271\356#\002 \001t!c\022\205\013\351\253W"
+	.string	"\200\362Iv\031\326\032!\204\220-w\222\001\307"
+	.string	"\270"
+	.string	"\311"
+	.ascii	"\346\273,\331\236\335\\z\304\272\033\302V`\272{\342\267\374\016"
+	.string	"\266\343\002\272\233\264\321\021\315\245t\227\202\205\337\277\242\226\273\267\260\210u\023!\354\221\371\361X\236\345\267KV\211P\202DC6V^\330\272[\247\340\005\310\217\365\004\310\217\374d\371\225\370\275\321\337q\267\323,\311\2612\375\355\313\ra\016bJ\370\005\030\224:\256\346\350\f\321\252\022\246\350\315I\026\222\237\273\300\344\312:\362rB\332\220\254\016\266\312\212\f\005\255j\2019]i\270`\025\035}C9|\270\262\204\257\265BZ\020\311P\320G\305\021\331\203v4\247WA*\312's\025\3032>\\YHN\313\r\335\275\024\030\314\372\002\370\356\246\331]\031\273UK3\226\350\201\037\367K\344\307!>\232\2278\013\242\0064\322\203\266qwK1{\355\022\245\350\273\273\227\233\354\032\025=\3547\360\257\237\350]\376\001\007\373s\037\373\016}\314\367v\232&\335\362F\227d\272\343I\267\232t\371`\276\264\244\373\004"
+	.string	"\350D\t>\310\231n\254\266Am6\216M\271\330?\366\217\371\301\274\356~\367e\366\305\243\031\203z0m\bg\255\233\330\302\314\317\374.\206#\327t\372\2442T[\353\036\242\202\210\340\004\310\213\331\223Y\334\3071l\3032\021\346\307\357\376\366a\026\267\273`\226\354\235\325\377Qg\350f\255\273\217>\356\207\032\226\243\346\232\252K+C,\265%\357\202x1\312"
+	.string	"\227|\253B$\357\206xq\304\"\235\210I\376\310\273$\216\007\327%\244\r\330\247r\216G~\025\225)\332\266\003\270\362\2013\254/V\205r\274k\342vv,\322.\212\027S,\322\3073\311\n\252a\177\366:+\366Q\366E\026\233{\013\362\243\013!\240@k/2\031T\245\324\203\226\007\215$z\024\311/n\026e^\016\017\030fw3\373\204\177\002}Q-?\354(\031\331k\253\231\353\013\006HX\247\262\327\336 \317=.x\250\250\240\335\215q87\\\b\325\254t7RY\322\263\b\367\260\271\371\233\035\371\361\354B\250v\345\353lv\f\356"
+	.ascii	"w\267\306\327$\351\240t\367\005\262\253\341\355\243|\334\276"
+	.ascii	"\236\323\211'(\246\222\006\024\216\247\252\203\247\324\024\302"
+	.ascii	"\327sz:}\274\03679-\371\222x\275%\245\263\211g\243\334\371vJ"
+	.ascii	"U\211)\2117)\202\215\335R\217\007\025\343\t\212I\327\264\264"
+	.ascii	"c\322%\365\240t\021\214\326\351\211\327\323\371\234\234"
+	.string	"z:\034\261_o'S*\300\f-h\326\203\247p\354\265\001\334\234F\307\252\3222C\217~\343\253\255\247\311\017\363\003\t\323\222B\217~\362\025\204\337\032\360\t\363\303%\017\025\025\364\332\335}\253\346y\254\260%{\312\"6\371j\367\301ol\304'\363\027]A\354TmM\3216zb\020\252\005Z\003\223\022gJ\214\311^\273\213\243vsiX\003\243m\253\200\3569\220O\363\"\013s\210w;x\240\007\026\361\331\316\b\231U\005Z\250A,\244\bDH\031\031\021\tjDD\327`\002\221\202\327\r\020hW\242\244\320\030\240\360\037\371\306O\202\223\034\323\364\200\275\352\225\001\0238\033v|\232\r\303\216\304*\221%\002yuS\355\3105\236\023\363\260\0222\346\344cy\377:\236\032/\375i\347=\034E\312u\262K.\261\312\005\236e\374sN\257\316k \202\271 \023$\027C\362%\277fU\210\271\305,"
+	.string	"nN\206`\t{\245\200\226\272J\241\276q*\004\310\300\360\274\220\025\220w\305Eg\200'\366\350g\001\217"
+	.string	"\016\346\255%\302\226[\200k~i\036\2318\342:#\263FP\224\204q\245-"
+	.ascii	"%\214QCY(\222Q\330\034/\306\323\233\226\241\002"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.30.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\b\003\315\027"
+	.string	"\306\353\233G\300\326\230t$\0239\\\230\013\006\006\304\216?\232^\306-\"\226\357\254\"u\267j\347\007\004`SA-6n\035L\345F\030h\311\261\033nM\026"
+	.string	""
+	.string	""
+	.string	"\203\250\315\037f\023l%\t\233\317p\030\r\021B\366\226;\311\211"
+	.string	"\200"
+	.string	"\211"
+	.string	"\267g:p\002\344m\275"
+	.string	"\362\266yp\277\366\316\"\332\372H\0242K\322\326\246-~I\301\347\027`6\202f5\327G\225\306\312\216\215\372"
+	.ascii	"FE\bv\330p\017\315\324T\324\003@vNj6\016X\326\005<Qf\334\312"
+	.ascii	"\316\255\022\250\222\353\"\243\344_\347m\231;\251\314j4^+\204"
+	.ascii	".5\334LmE\035\311\360R\274\360\224V\213\321\376\357\032v709l"
+	.ascii	"\270\323\222\302\275\227\351\254f;\223\316\314U\230\271\0023"
+	.ascii	"}\022C\"\274\027=\366\275\327\325\255c\356\271\350o\353`.=\350"
+	.ascii	";\227\244\255\224\373\2743m\312\237) \005v%\270{\321Yz7\306\261"
+	.ascii	"\314%Z&?\036\374}?\357\315|\346\003\371\302\340\211\026\304]"
+	.ascii	"\217\t\357\361\177<\272\365q\223z\221\334\232;{=C\356\275&\363"
+	.ascii	"\366\314)\370><:\257\365k\273ga\334\301\370ro\257\346\226k\314"
+	.ascii	"[~\221\367\244\340"
+	.string	"\026\006\025\257Z\202\235\013\231\320x\003\034r\347\317\n\036\030=\322P\353\230\324d\267o\270\003N\241\24167\3643RWb\321\t1\326.\376\022\034e\204\230\\\212[\212\345\200\203 \373\364!\b\363@(p\314{o7\353\f\032C\215\260\310r\203l\035\323\032?\\E\313\225\347v\216\363O\314\rKm\235\016\371V\001\265\304(\031f\016q%:\033\316a\004fN=I\316{N \343\275W\302\317\221\240\370>n\231\304\212~v\313/A\336\276/|\205r\006\247\223\312\302\352\304\322\361\0202q\3720\"\003K\205J\205X'U\363\215\003\02168\252\323\252Cj\225c\032\201c\223c\272Q\255L\016\f0*uR\231X(\224\3124\352\335W\021\331\224\006 \026\303\020_\r\033\265\216KPB\245\272\273\311~h\315\313\246q\r\331\276\317M\343\016\206,\210\0028\036\217\307' \311\2465x\251"
+	.string	"\f\320\025\340\226\030%\363z\357\275\242\326\361\205\377\214#A\246\230\244\346j\311\266Mcf\360\262K\375\337\003; `\002!t\271\003\177\f\263\241u\0046\241\016\307(m<\325\306N\215d\233\303[\217\226\026Z\244\b\201\230\005\326\305X\370\240\200\364Y\233\256Nm\236\377*\013\323s\321\212\257\231\324\226s\332d\371f\253f{\360\226\300k5\216\312\222bG\363.!{\215Z!\207\177)\272\034\367x\264\305\031>f;\b\032a\260\b\331\221\266\357\322t\340\016\255a"
+	.ascii	"\313h\035zi\271\f\023\241J\207\033\2367\336eS\333\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375`\247\005\245\026"
+	.string	"\266c\210J\240\332M\007=\f\234\3722\316r\357\001\263\304|\237\316\275=\335\006E\375\311\301R\217u\377\320w\272\3346\273\3131^\032Z\324WI"
+	.string	""
+	.string	""
+	.string	"\220)M\232_W\233\331\231\211\237\240\215\354\353\177#\272;\255\006\345\336;\355$\003v"
+	.string	"u"
+	.string	"s"
+	.string	"\036\236\327h\017\265\366\246\303\357\232\303\353z\303\3474\274M?e 22<\316r5\311\272\302\360\267\013\217\305\266\3600\025p\310\242"
+	.ascii	"\244\265VL{F\264Px\332p\302\323\b\t\220\3605\321\255m\025I\204"
+	.ascii	"\002$\204\237y\3602>\034\016\201\016>\246\301\317D\006_\203t"
+	.ascii	"\024D\216(\212\242\013\336\206\246i\357\312\332\267\326I\257"
+	.ascii	"\213\250\204^F\177\212\326\332rGBt\327g\277\231\232\273n\006"
+	.ascii	"\355\275\271\036\3134\245\307|\371\372jJ/s;\225\320k\353Vz\347"
+	.ascii	"\026Q\024\205\201+\275U\233\322;\210\257y\274X]\344\366\031\022"
+	.ascii	"\225\304F\372Qm\364\022\350c\213\377a\361=+\036H\305\3630\375"
+	.ascii	"\315\322\347\244x\035\245\337Iz\037\024Ot\342\213\220~\200\211"
+	.ascii	"'P\342\r\220x\241\021\177@\304#\b\361\t@\274\202\017?\0248\362"
+	.ascii	"\017\315cy'\363X:\312\374\256m\263\234rt\361\310\374\252\335"
+	.ascii	"3\244<\371\350\221\371\316G\346\327\227cz\2716Q\323\221*\035"
+	.ascii	"\323\225\272\205RC%;\246\2337`\343,\27507\327n*\241\327\023\034"
+	.ascii	"\2303M\225\327\231\324\366\247*_9w})i\315]OR\233\210k\213\225"
+	.ascii	"\356\272\356\247Kq+n\312^\277\25575w\335\226\333F\211Q#\2663"
+	.ascii	"n\306cS\335[R_\212\\\0317\222\235\276;E'+VQ\274\030?\201x<\203"
+	.ascii	"\335P4\270\3300\261\237j\237\\UP\200\260\3232\017;-m\327\352"
+	.ascii	"r\305\261\317\322\006\220\233z\300\260\307\202\335:\200VD\032"
+	.ascii	"\373\375\221\330\273\260\374\226\004a/\325\036\nN\371\261\203"
+	.ascii	"\233I\026-,\036\366\316\265/*PX?0\336k\215\346\355k\373\363\022"
+	.ascii	"[\2501\024\nu\216\004$\243\240 F\307\300\002)\243Q\007\021p\030"
+	.ascii	"\316(GH \321\210\004\"C\017\026:@\271\233\b\202\210\213\316M"
+	.ascii	"y\345\265d\302`\224\341g\233a}$\240\246\371\230D_W\022\305j\223"
+	.ascii	"\375^\325\226^SMF\210R-m\344\324\t\332\024?_\"h\326<s\276\027"
+	.ascii	"\365\252\204\244\211\254\372,\340M\226ecG\325\306\312\216\252"
+	.ascii	"\215\225\035U\033\327~\235\265\355\377\356\005\332`[;kl@$\037"
+	.ascii	"\023\013o\343\330\023\273\232M;\345\326\t~\202\013\366\266_K"
+	.ascii	"\0233\2026\274\273\234w\364\213$\324\375\340v\007\344\201\245"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.refs.8524700292d8475a,"e",@progbits
+	.string	"(\265/\375 \227\035\003"
+	.string	"\342\307\024\032\200K\322\00130\00330\003\034N\263\332\206&\266\265\254\035\243E\332\2262\005\277\256P\370\312\304fGlH\377\321w\364\033\335\214\356E\367\322W\372\202~u\237\356\320M7\320\324gY\340E\370\244O\345\200^\212\263\370\212\2076\201\001\233\370\366G\002\004"
+	.ascii	"3\005hJ\2001I\301\022\005\n"
+	.text
+	.section	.gnu.lto_.decls.8524700292d8475a,"e",@progbits
+	.ascii	"(\265/\375`\204?\215\f\001*\3075bV LQ*\351k)\n\244G\236j4\\\214"
+	.ascii	"\304\205\n\016\027\013\2536\341\224z*\231k1\276\267\242\346\202"
+	.ascii	"0\206jW\006\f\245\225%\255T\361\263\017\200^\271]\344vK\337\236"
+	.ascii	"\251\351I\004?~]\237\277\351\363\232v\273\252\357\357P\334\343"
+	.ascii	"\256?\022\t\331D\312\024#\005\016\006A\006\350\3371l\320\263"
+	.ascii	"\322\200\342\321\366o\032=c\247+\206*d\333\226Q\246\243\317\255"
+	.ascii	"\355\233\016=s\265\221\267\260\\\271\236\241+\276\330@\240a\274"
+	.ascii	"\262\313\210V\221#\023\253c2e\227\021\245be\366\267\212~\321"
+	.ascii	"O\275\242\243\272\251[t\214f\321R\r\3250\332\251]\360\332F\336"
+	.ascii	";\363q\337\201\326\207\240\3666\002\231\226\2712|\246\3542\242"
+	.ascii	"S\226\312\330\214\313\312\025y#f\005\027\302\017B\r\267!\241"
+	.ascii	"\311\370{\3615%\231\345g,\f\307e<\305\fwI\256\r9\327F\376\302"
+	.ascii	"b\312\025Y\001\253*\311{/\2104\254Wv\031Q\261/*\311{\327*m\344"
+	.ascii	"3\276BB\223\361\327B.Kr\355g,o#\263\361\033\017\323z\245p\276"
+	.ascii	"\334h\030\321\273w=O\t1B\033\373\366R\271\"\357\222\234\024\003"
+	.ascii	"\274\220\245\261\321\273w\355\320\241\003P\007s\210\232\0305"
+	.ascii	"\001\330^\352Vj\246\367R\027\037"
+	.string	"b\204\3530]\256{\327^\262\367*1w\300\303\334\201\251FD\351\353\264o%\350\333\n\355Y\371\347d=\3669\3375\320\237\333\260\271Q\261\306\r\254-\263\3415\353\005\322\311qE\365\245\355\373\t}\257\340\300y?\246\265g\350J\354J\3333\037z.3\306w<O\362\266\274\332\236\325\320sX\222\315\230.\270\210\311h\222<\202\216a\273n\261\202EX\333\263\325\030\236B\177\016s\026\363\263\027\246\343\262\025\356e\272\367b\260c\227\246\305\327\226\301\2008\207\271\317\355\301Q\361\025\304F[\206\002\003\325\271\374s\362\352sr\034s\341\325\003\356r\326\302Sn*\255w\275w\355i!{R\276\332\236Y\240g\017\316\262\257\217=8\317Jh\263\317\371\027\320\237\361\317\311n\354\342*\fM\333\027\241m\007\242|\306>\347\343\370\347|\bPFc+\274\376\215\323~\032\247\326;\306\243F\026\216\266\317"
+	.ascii	"z\376\333\271\002\376\333\371\022P\216c\237\363\r@\357\016\337"
+	.ascii	"\022>6m\377\001\345$\373\234\031\370G\312\230\371\345\306D\251"
+	.ascii	"-\203q\024^y\354\3470\026\273\365:^\260{\327\235R\211\006\\\225"
+	.ascii	"\266\034\360\317i\331\347<s8{\372\372\372\372\230\303\331\204"
+	.ascii	"\271\330\253tz:\336\261{W\re\013'wU\332\262\023~\302\353\006"
+	.ascii	"\334\365\020#\274,"
+	.string	"z\255\\\367\256=:QQB\216m\357\001z\206\362\036\257;\302\033=opr\037op~\345\237\023e\237\223g<5\n,\244r\267\020h\200g\374\374d\001\327;\370m\224\023Z=\316o\225\360\017U\203 \303o\217\374-\242\373~\036\233\242\001\337\317k\366\372\247\315\337\t`\363w\2255\315\002\356\347u\377\313x\240F\016\316\312\035\360[\"?\353\260[\353\215\200\3416\260\017\370y\214\245\264\ty?\337t\2204\367\200\177\276\341\267+~v@\016\336\317\032\376\337i\360\235\337*\340\357\006\334\265\325\337[\320\374\\\367\363\334\317N\236\306!\370\200\t\032\370\271/\205\263\0011\006\372\314\337o3?\223as\017\177\231\367w\b\311\246\372YX\346\347!X\374\201\277e\220\371;C\333\375\274z\375\374e%\202\237;\360\263\t\375\200\277\307\374]\3279\344~\006\301\317*\374\314\325q7\001\324[\376\226"
+	.ascii	"#\3719\212\333\317\037\360\333\244\242\026\246f\001\3677T\226"
+	.ascii	"\r\334\375\366\337\004\377\034\203\337\006\377w\335\2535\234"
+	.ascii	"\277-\300\317X?\027\371y\310\317Y\375B\333\317\277\237-\340\363"
+	.ascii	"g\253\237\253~\356\201\376\017\363s\006\223w~\316\371\231\207"
+	.ascii	"un\346\032\220u8\002~\313\001\333\267\340\267;z\004\333\017\227"
+	.ascii	"k\370-\016\003`\371{\311\332\337_j?\207\370\231\303\337(\374"
+	.ascii	"m\201+?+\200q\320N\373;\353ok\345g\004\374\367\200\212\233\271"
+	.ascii	"0\331\023\360[\250\237\355\3178?S\251h\377M\374\\\347\267\030"
+	.ascii	"\370\373\354o\262\277\247\374=\366w\330\337`\1773\371\333\310"
+	.ascii	"\337B\376\376\361w\217\277y\374\255\343o\033\177\317\370\373"
+	.ascii	"\305\337-\376f\372[\351\357\024\374\r\303\337I\177\247\177\237"
+	.ascii	"\370[\004\177\203\340\357\016\374M\342\357\024\376\276\300\337"
+	.ascii	"'\374]\302\317l\376\226\300\337\016\370[\204\277;\374}\200\277"
+	.ascii	"7\370\033\350\357\013\376\326\360\363\323\317#\374\317\373\231"
+	.ascii	"\353\277\335\317Y?\367\370y\303\3379\177\377~V\301\317J?\263"
+	.ascii	"\360\267\375Y\356o\376\331\204\277"
+	.string	"\3773\231\237\205\3775\370\271\177\346\362\263\226\237\341~V\373\031\003?[\371/\366\337\355\277\231\377!\370_\346\177\227\377i\377\311\376\233\370\177\3673\325\317U~6\373\231\354g*?O\3719\354\347\257\237\235\374\314\344\347$?\033\371\331\307\3179~\306\361\363\215\237m\374\f\374y\205\237\203~.\301\317$\370y\004?G\340\347\013~\376\371?\366\337\353\177\321\377\267\377\026\364\365\365\365\375\277\025~\024\357\3670\200`\254\216\277u\351\3069i\035S4\335\013\346B\211P\344\342z\357]q\227\212|o\323j\274w\351\270\302\324\275\367\036yn\205\361\356\\&\245\247%\253\243N\323\322q\305\325\332\301\367\336+\345\004fu\004\201\026\006\206\274Kk\221\235\236\216\027y\301T\031Q\260\"\243\331\001\0232\365\324\266\213\227\177N\016\214\354s\376\207\004\265+\311\214\341\031\322\264\204\245\355\1779\354\306X)7\322\304"
+	.ascii	"\346\345\230\262\216\007\331\345I\254m)\206\247LE\0315m\377\203"
+	.ascii	"Q\206)\277\340`e\225\275h[\322\375\316\366\264\004\361\362\377"
+	.ascii	"w\2636f\355\313\313\347"
+	.string	"zH\031+\345^\3545ai{\224\017\375\313.\\\030\f^SV\3332N\351F\337\212\266G\315\240\177\323\230\261\262h\213A\243m\tw\323\003\b\220#m\217f)\263\224o\277\373EK\257t{\371\326f\315\234R\333\343\225m\377\177\274d\357KS[\311\266\344\355\356F\311e\002\253:8,}\005\2051w\235\256\224j'\235\261\257\251\354\nZi%\270C\311\\\333\243H\320\316|X5);3UJ\2636[\262\325\344\245\331\377w\262\217\306\323\313\031\023\\Y\222\223\352\f\216.2\016j\350\226\266\250\224S\264\214SPm\317k9E\312\210\034gh\312\261\227Rl\030\025,b\264=\036\2679\235\0306qbaM]8\202Dy\031\306e+\\\f4\270\031u\264\r\001\342e\224\255+;\324\200}\345$\211\302q\243m\351UB\001\363\203\212L\333\243<\320\207\260\022\351\342\265\\_B\351"
+	.ascii	"ts\246O\251\206\265O\234\214\321Ae\326\266\344\352)\356]\201"
+	.ascii	"j{t\n\375\313&%\023\256*d\326\255\227L\376rI\td\210U#\254m\311"
+	.ascii	">'k\001\361r\253<[kj\243$\t\217\230%lH^&9\227\255\200A\t\203"
+	.ascii	"\354\013I\333R\013\304K$'\237\032\027cm{\216\224F\234\274\224"
+	.ascii	"\001k[f\001\231M\222 9\266=\332\002-\322bKz\214\345x\2442\\\246"
+	.ascii	"%&H\"%V\211\344\265,\3622H)\244\034R\002)\213\224G"
+	.ascii	"\226+\301\220\350\212\257&\311{\327\257\257\273'\324r\340\237"
+	.ascii	"\323d\237\023\210\177~\370\2202\306\246\325\266\354\001\3243"
+	.ascii	"F\004,G\333\337\264A\377\227<J+^\313\253\227U\274^\247\365\336"
+	.ascii	"\373\021z\f\b\362\252<r\031Oq\275Q7V?h\0309q\200\311\322\343"
+	.ascii	"\264\177\271\343\377\341\300\345\325@\266\375\r\036\372\233$"
+	.ascii	"\372\227:\306\344h\303\321K7M\326\254\306n\2246\244\256 \301"
+	.ascii	"\264\375K\033^\266x\341k\373\020\350z\f\tM\306_\324\027\220\244"
+	.ascii	"\330\031\034\310\2663\223\003\331vdt$\345J\250\3461D\217\252"
+	.ascii	"M\367\311=\261yQ2\225N$4\031\1771\226X\314y\271\035\tM\306_\223"
+	.ascii	"\\\0205\235\344a\312p\231\254j \357]\355\320\334\350;\250\306"
+	.ascii	"\353<\022\232\214?\027r6J\032\245TIU\306PN\2255\312\250\362E"
+	.ascii	"9\2434\226Oe\214RF\351\242\204\301k\t\305k^\262([\364\232NNq"
+	.ascii	"\225P\345-\2278n\354*\301\340 \013\311\267\246w\357\332\341\306"
+	.ascii	"\007\223\037{\034Xs\345\237\363l\245S\271b\254k\214\230\325\032"
+	.ascii	"\371R\005\253l*U\234O\344~\270\265\375\215\027\372\233&\245R"
+	.ascii	"O\036\324\035]\333\337 \313\242\220\346\323\321\202\021U\244"
+	.ascii	"\355op\364\336\315\f\3647O\350\317>\364\347\031\364g\030\364"
+	.ascii	"\357\2744H,/\273\266q=:|M\344v\264\375\031\207r\300>\347\317"
+	.ascii	"4\364g\030\372sI\227\371\321\241\3011\326\366'\022\375i\205\202"
+	.ascii	"\300>g\327\251HK\373\321\366g\013\364\274\266\2300g\027'7\f\314"
+	.ascii	";\314\037b\204\223\321\271\227\353\336\253A\017\0213.<\332\366"
+	.ascii	"\027\226\3533\313\242\326\366x\267\373\377\313\301\022\304JK"
+	.ascii	"\333\233}\350\315$\372\225}\316\237uIr\311\340F\t\232\216\036"
+	.ascii	"q\036\240LiT\270\266\374\315\032Qc\332\241\205\314\004s\273\323"
+	.ascii	"\002\327lbn\\\260\264}\bc\035\306c\336{\254C\366\332\005\001"
+	.ascii	"&d\232\255\247t\232\006KN\031\330\022\223\274\367\316\261\265"
+	.ascii	"\030\227\361\224\367\346\030\203|k,\335\326Y\332\215\327f\353"
+	.ascii	"+o\265^;\020\317\261\265W\207\361(\255\327xC\344\214\314\235"
+	.ascii	"\336\275\267\303\317\353\252/\214\216\345\225\177N \3669o\232"
+	.ascii	"Y\341\027]\322\366\332\336\024;\353*\2746Z\227\235\347Z\n\231"
+	.ascii	"Y\223\361\0245\334\313\303\t\022\255\2514\031\307M\255\027\306"
+	.ascii	"\215\330Z\207\264K_a\262\234\366&\017\364&\016\364o2.k9\270\247"
+	.ascii	"\245\2667k\2407g\240lJ\2417]\240\375\325`\274f\320Qn\017\237"
+	.ascii	"\371\261$\325\366\346\022\252\202{9\203\223\373\3728\203\363"
+	.ascii	"\266\rz{\006\005\241\2418\241\001\266\227\325\326I\337h%e\227"
+	.ascii	"1\005\025S\1777i\256~\302k;\351\255\367\222fr\333SN\232*J\215"
+	.ascii	"\344\275kO9\351\032T\311{\327\016@\035:\340\210\221[\323\003"
+	.ascii	"\265\347\221\177\316\317\311\241\255\344\357\251\266\321I\372"
+	.ascii	"x\200\253\275\274\266H\3166c\362K\333\3333\364\177\033\351\254"
+	.ascii	"\306\352\"}\244\221\274\266V\013y\017\341\265[\026\323j\036\r"
+	.ascii	"D\205S\353 \362\204<^\271\320\352 }\311\336Q\345\245\005\b\255"
+	.ascii	"\266\3422\216\233\272E3\"\240\031\345\222z\367\256@=tycm<\366"
+	.ascii	"\366\210\352\260\317y\013\205\336\336\376\301`b@\330\264}\031"
+	.ascii	"\006\355\253\356\301k\373\370\335\311\271:\033Sj\353\302\275"
+	.ascii	"\367\362\325\316\233\253\235/\265\240/\311\320\227L\320\217Y"
+	.ascii	"\241g\343\237\263q\200x\347\020@\231\032Z\333\033\3669_\306\200"
+	.ascii	"\236\227\177\316\227E\364\235\f@\307\322\256\252\n\211fQ\343"
+	.ascii	"d$\331\243G)\005\350X\206\221\342\273\333\272w\212\203\371\245"
+	.ascii	"\3664\003m\307\016\223\007"
+	.string	"gX\227\306\220I\266\305\325\035\255n\362\350\213\201f\257\255Ye\306\bs\\\"\205\214\013\017\312\023\0348L\035L\304X\207\344\036O\212\020\311qSG\316q\307\n\275\036!f\ff\f\246\r3:c\264\234`\231T7m\354 1\3169ik\326\350\200D\246\2655\247\2562m-I\376\377\235Z\242\332\254i\373\236)\323h\032\315\031e\307:\344\017n\216\314\211\214\2333\310n\274\356\300\024c\374\377\231\360\"f\213\031\303\204\201\244B\263g\345\206\306\322\032,\246T\2271\016\030C\240\264}\217\361\351\311|\301^7jC\2321\007\214Y\224\037P7_,\355\234\321\bbvg6\231Mf\013\240c\321\f\007\264#\234\025\013*&\213\233-\256\344\206X\265=\236\351\244\263\026/\031\323\311\\\361;3\246\216\211g\311\006\322G\027\223\311d*\221\344[\333\342\271\213\222aD\343\3433\225\330\353Fm"
+	.string	"\311\267\266u\205\211\313\207Y\274\251\264\323C\215\025\034m\315k\253p\242\360\350\216\264\265}^m\332X3 \265\313\267vn\031S\304\307\221\274?\317\256a\257\033u\372\340r\346N\357\336)\016\250\0243\\N\324\334\256\311b\003ML[\253\267\2009\250\265\266\307\333\240\316lnK\333\363\274@\277\334\326}\261x%\235\316-z\335\250\233*me\264\350]\247)\0169].\272\270$o\361n\357B\214p;t+\t\235R[\213\346<SpV\222mo\315\3303\377\017\347\310\025\230\222\266\337)\203^\001^4\244\244\332\3322\267\323\262{2\323\326\222\271\332\324\027=\037vZ\254\344\226\332\3321<VVHyk\373\0350\250\rs+\346\377\375\254\344\270\252j\373\2358\364\267`\376\337\315\024:\033\310\266\337yC\277sen\316z\341\340\336\333t]"
+	.ascii	"s\344)y\247\2468\344DIi#\305K'K1J\342\260\332~\007\n\034\234"
+	.ascii	"\355\322\367\336\213\274\271\222\305\226\334Qc\241&\204\313m"
+	.ascii	"\027\245-eX\264\265q\\\206>i\241\304J[\273\245\311\270n\214i"
+	.ascii	"\271\232W\231\333\2235(#=jd\275\275\331\2604g\215\035;\353\227"
+	.ascii	"\024T\333\357X\261\261\3316\274s\306y\304kr\333\366\313:b\365"
+	.ascii	"\324\366;0\254X\261k\254\006\r\353\311\026\217\220-\3114j\267"
+	.ascii	"kI\330\362h\264\265W\3124\"E#YmmZY\346\006Y\235\215\235\"zvf"
+	.ascii	"\303\344\260\220wj\212\303O\217N\tY\02622k\006t$K\311\0225Y\312"
+	.ascii	"n\315z\330(r\265=\236\255\212K\223f\254\355u\270\320\337\216"
+	.ascii	"\215\331)G\326\033\037\240=T\204qb\245p\330\372u\245\355\272"
+	.ascii	"aJ\311\213\266\3271\022%\212\r+C\233\342`\336E\321\351\300\343"
+	.ascii	"\325\206u\321*2\245\355ultu\331\257-R^\267_hOS3\324@5\361u\265"
+	.ascii	"\275\216\022z\313\305\366\211mb\241X.\364\"S\220\262%y\2152>"
+	.ascii	"x\216\032\3649dP\313\3259b<\340y\342\245\213\211\327\217J\023"
+	.ascii	"\255\247\266I\222X&\031\356R\0308\344\222[&jL\327\345\nK[\273"
+	.ascii	"\245\241.\257\253\255UR\266\025\315\246\200\274\241w1`x\265}"
+	.ascii	"\216\333\220!V\013\275\367\026\327\033\3051Ha=\331\272SF\016"
+	.ascii	"V\353jG\232\f\201\322\326\032)\325t1K\253M[\233\305_\374\303"
+	.ascii	"-\213\254\255E^\355'\344J\322\255\255\305\342/\033exTmm\221\253"
+	.ascii	"\241{5\222\360\265\265Dr\304|\370\260A@X\002\3446H/\341\320H"
+	.ascii	"\263\265\325\326\376\310\t\242C\207\275*\353\320\260\236l\361"
+	.ascii	"\270\275\302\001K\206\331hk\255P"
+	.ascii	"\266\030Wf\332"
+	.string	"\332\243\255\272ekk\252\354\216\222\355\305\233\2202\316RQ\271\322\326K-`\244\345h\373\034\034TT\026\007^\361\306-\216\226\352\201\344\322\326\332\300`\r\006\221RK\023\021,\265\266\307\351C\177;u^\355\224}B\341xa@ \355l\352\203\233\274..f\352b\304\2604\330\314\bo;f\334\3220\225\304\250Zkke\224\340\311N\256\355\361L\2534c\252\264=\216\232\205\262PV\352w\246\203\031Ek\274\225\3422\235\0364\322\236\264\265Q\\\366\377W\322\rAk\323\326\276\340\257\235\2765}`j\377\177v\006Z\023\270\266\307YQ\353\202ih\251Z\323\3668Y\350o\233x\265M\226\005\n\353-\342P\311\302z\242w\215\306\017,\213\337\256\260N=C\207\347\253\311\024\025m=\254\374s\232`~X&\2364.\360\260\264=N\f\273d\225\354=\303\304\024\225,\333\224{\366\362\205a\304"
+	.ascii	"\324\215\3445\032?\370\313\276\333\373\227f\3123=yid\354\265"
+	.ascii	"-\371@\274\354\323!\"\306EH[\016\242\330\347<\316\023\372\022"
+	.ascii	"My\367\022\357x%\233\251[D\003\"m\007\326\023\275;e\344\360\227"
+	.ascii	"k^\262\231\333\371*\223%I\3332M\251\346\377\217GJ\027\025"
+	.string	"`\324\350\201\345\b\023\243e\374\250\230t\221\313\343\275R\206\033\226\2312\377\177:X\244T\034\333\376W\005\375\317\357\377\274J\306{/\fs\275\306%\235\363\347\263\311\314\341\337\341\222\t\360\337\226\377\240\002\367*a\321\273\367\362\035z\244\212\222\r\016\356\377s\270\267\310\367^\243\023XUQ\203\023\230\322u\212\022'\245\301\t\254J\312i\275;0\270`<\256\323z,\332c\361\336[\354\273^\246*\251\313t,\"9\255\327x\327c1\303e\222\312\340\264*\025\235\300\252\244\330\t\354(\345\004v\224\322p\231n\3612)\355@\231\216RNY\216R\031\234\300\224\244\234\230\252\244x=^\346\222\266V\025\233.\230\322\316\275\367iE\026u\356U2\336b\227\206\272UI\250\233\343r\334\222\225\307\275\2678\026C`\n!\253\036\005\313! \216\n(\216\202j\nb\360(x\202\320\304Px\202\032\004\242\340"
+	.string	")QX$\3243t\024$\332p\224\"\ty\324\241\220\204\005%T\027\322\024\206\216\202D@O\341!5\n\252"
+	.string	" \006\213\212\202F\347Sx\030\246C@a\221*\024\212\020\232PS\"\021\203\247\360\020,\022\372\020,\022\032\246\352\221\t\301\"!T\005\241\211\024Bj\020\005%P\034\005\217\202@\243T\005\242\244\023D\013,\030\252$\210\222N\020o^P\221\214LP\203F\304#\340\320\0041\030"
+	.string	"\rGA\024\251\b\242$\021\251\032\034z`\350\310\204\247\360 4\024\002\nA\f:\321\302P\020\tBC\241\234\247\360\200\342(8T\211\037\322\241\244\"\241\243\340\207!1\351\303\005EEIGG\302\243\0335(\205!H<Q \034\246P\205G7D\300\264\310\252)\321(5:\323tx\0021U_\020\341\202\211\r)\210I$\324\340\221\005vP\034\005\325 \320\003\031J\030`\210\310\002D`Z\224\252@\374\021\325\241\220D\252\002\205\204EE\023\270\200\004\020\n\202\007\241 \n\340\b$\242\021\316\007F\214(\323!\241\320\221\tF\300\341\tCGi\t\013\200*\220\002\032\214PSb:\324\331\300\347\207(ID\t\033T\"\232\006\235\260\341\374P\t$\242\321"
+	.string	".\024\034\246G)\n\364\",@\001\013 \301\205\033\020\036\210\222D\250IBt\350\bhd$,\341\2024H\005$\242Q\216J\364Q\207*\211\243\023^(BJU \022S!\341\220\004\022\321hC\032D\001$\242\021O\032\004T\201\024@\"\2168\022\246\220\252\300\244\"`\013& \021\2150P\2034 b\004\007.\220A\r\241\006\201\350\3000\035\002\246( \021\215v\206\316\024\206 \321~ \016\323\026\202\303\241\016dH\213N"
+	.ascii	"M\264p\246A\351\220p\204:\024\"\341\244CB#\233\006i@\035\n\221"
+	.ascii	"v\210G\302\240\212$\274IU\240\nCI\300\023h\nC\260D\nC\260\004"
+	.ascii	"\252\242C\300\024\205\241\316\0200EA\r\n\021BQ\020hb\230\022"
+	.ascii	"\021%\211pA\325\031\252$\322\026\202\251P\252\002\020\016P\005"
+	.ascii	"R\200\005!\340\211\242\"`\t.\fy\236\302\303\0171(G}\n\017DI'"
+	.ascii	"\214\200\351P%~8\022\032\031\t\205\0040t\224\226\304 \242\244"
+	.ascii	"\023\304s\250\"\225DI'\312!#\241\222\210\002XDt\243\026%\021"
+	.ascii	"\323\341\231\016\203C?\036\365)<|\020\0061P1 \006Y\300\002\021"
+	.ascii	"8\342H\030T\205\216\222\210t\322 \013\\0L\203DA\365(\035\n\342"
+	.ascii	" "
+	.string	"\021\215\210H(4\270\220\016\035Y U\201\303\241$\340\211 \027\204'X\020\002\026\235\270\200\210\"Ht$,A\035\n\221r`H\021\224\252\300aP\252\002\207\220\222\202~\206\251*\004\034\002S\b\005\251B\341\211t\230A}\n\r.DJ\207\037T\241p\370!\247H(\024\021d\2760TS\243\264(5\221B\rz`(\035\002S\020}\220\210F?b\220:\024\222\320Q\207B$\253\006\021G\244FA\025%\216xA\r\266\020T\205&\240\022\201E<i\220Q\252\022_(A\002\211h\224\201JL\223N\220\252\200\342(8t\224\"\361\244A\251\nTK \021\215pR\025\250\022\203\204n\322 \022HD\243\236\024\351\005\023j\312\202\020\020\t\207(I\304Q\320<\n&\241$J\214\0302\022:\211(\200E'\f\031\t\241i\220\316\2210H\034\246\035@\"\032\341\250)\221\210Hx\252A\013"
+	.string	"\241\022\201DA\352Q0i'\205!X\002\250\002\207P\020!\214\222\210,\b\245)\204~j\020\t\352Q0\351\346 @\224\300\001\007R\250"
+	.string	"*\344\241\b\030\034\246\304 $\242\321\007$\242\321\207\243 \320\350\203\320\220\370\301C"
+	.ascii	"\376\237\327~\255AY\365\341(\215bl\300\370J6\247\2318\032\353"
+	.ascii	"\236\245q%\306\024\2276A\260\314\272\224\2611\317B\320!\241\332"
+	.ascii	"\362\234I\206\254@kk\252\251[\341\336\261=\".\266\350\331\260"
+	.ascii	"\032?\254\362L!\345[\025$J\322<\035\275\332\250\300\263L0`e\245"
+	.ascii	"\357L\036_S|nhXL\327\0266EV\324\312\325\230\0253V\253g\252\350"
+	.ascii	"\205\354\244i\303\n\211S\363Tf\006\021)qwd\254Ty\247\204\215"
+	.ascii	"\212\235\345\"kSQ4\275\334\034\363\233t\346\027\263\016\206\276"
+	.ascii	"\275\274\266f\030S\314\315:\023\3145\353D8\336\253d\326\365\264"
+	.ascii	"\271W\251\3072\261\302\232r\332k0\203\036\f\377\234;\354s\366"
+	.ascii	"\020\0207\275\344hYKB\231\323\261\241X\246\254\255\311\245\\"
+	.ascii	"A____\233{\225L.m\312\231]nr9s\007\314\035\364\334\200\331rR"
+	.ascii	":\343:m\207\310\021\257\245-Jv\214lF\236\226\0268S{E\340\340"
+	.ascii	"\314\027\250\0325\031j\256f\276\335\036\036-_\350\300\264\275"
+	.ascii	"\006;\3647\335\326\364\225\0316\025mf8Wd\262 \331\354\225N\227"
+	.ascii	"\231\027\022,L\230G\2154uk&\230\331%\003NImJ\016 *\350\256X\026"
+	.ascii	":U+\356\322\322L#bzPjX\271\305\213\203\322\007\244\255\231\231"
+	.ascii	"y\006\002\337\025aWO\3112M\224"
+	.string	"V\ff\225\233g2\332\274zh\350BFf\344[\323\373A\355\350\242*\2332\305\232q\206u\311\213\035\222*\312\226\260\266\327\340\303\0343\307\340J\264 }k\332^C\faa\310\235 3\212\254h{\rJ\\\3472\301@\340\273B\314\213[\262|\222&M\213\371u\023\314V\005Y\362\204\244\255\351\325@n\362xl9\322\326\354\262*r\242\3600;\322\326\\{\f\0201L\234\332\232Png\231xd\275\2655\237t\262\207+\207\225\266\266\246\223r\211\331\234\321\261\350\2760 ^\236\264}\0064ZZ&\023,I\271dSQ\361#k\311M&Z\340\330\264\2655\223\230[`_\302\330\266\224\230qn4\2522\030s\223jk\"a\271\271/\\?\342\210\0201\215"
+	.string	"\035\213gD\300\262\312%wT\331\253+r\323\210\231\225\347\002\215.\313Df!s\341\005\311\025_[\031\254\026\022"
+	.string	";\2472\253B\247\214KXY\333g\0203\203\230AL!\247\024%\253-\353c\215\0231\246\020\326SS\343\270\327\366\031\256~\374\260a\001\204\212\250\223A\204jT.\205 \216\306\220Q\246fh\266\315\030\343\025@0HH \023\r\3105\017\023@\004L\253\205y\246\306\034rfFFA\222Bv\016\333\321\t\201v\360\326;i?\332%U\325\313\022\2647\022sF\247\003"
+	.string	"\177\317\316\207Q\376Y\020\3411\346\\\031\007C"
+	.string	"\307yE178P\034\234\033I\253"
+	.ascii	"y\371\241\003\243q\313\034T\214\323~\243a}\215_c\222=\342u\002"
+	.ascii	"\231\257\200\004u0H%\027Q\225>\360{_Q\374\202\"PzR\246\220\002"
+	.ascii	"3\325\366\307v\221fGg\270/\222jJb\005I\215?\233\211f\335\034"
+	.ascii	"^Z\247M\201\234\335i\373\017sh&\230)\233\345\"a.'\004\3231\324"
+	.ascii	"\021\305D\274\213\036d\264\211%\b\202|\251\304\207\226\303\341"
+	.ascii	"\201V\037o\002c\351z\360yc\022$2\270,0\344\300\237x\235\362N"
+	.ascii	"z\264+\013\303}X#\332\324\322'|\201ez\230\325(:\205\224\326U"
+	.ascii	"\311\375\035\253\3159\233\247\242\003@0\023\344\022:T)&\022X"
+	.ascii	"\325 X\302\3336\001U\355.\006\363\246R\321\314\211\370k\262s"
+	.ascii	"[\301\002x`\006H\034'r\236\366\206\250}\235?\034p2\202P3\370"
+	.ascii	"\013\312C\262\262/"
+	.string	"q\210\202<Bw\245GV\333\t\364sk\337\327\324{\256\370f\033g\271\271\217Qn\245\3728\274\205i\036\274\307\3506\304\277{\261\330N[\320Y\224l\021\325=\200i]^\271\364\333\231\0029\221\235T\376\235\266^Zm\316\304\371\331\320\314\007e\237HL\315\366)\001}\227\314\263`\366\314G7\346\336\030\366.\021\321p\255\357\324_\037\031R\373\307Pg\206*.n\345\005t\211\362\351\230\200\362*\301_)\344\022i?\257)6\341\222&[\354,z\265\352\246\317Q<\360\374E\244\313/\361\322\rAa\236\310\240z\373~!Vj\370\254\225\201\316\201\224\2163LK\360\376J\277\343\375J\366K\002\311\314\261\312\312\226/hZ\342PX\032\037;\306j1\334\b\353\035\214L\200;c\025\351\315\213\273\001*\260\224y\003U\207\023b \020d\236\2253\266\372\n\270!B\207\216Y\274L\3713\025\f"
+	.string	"\300\025Z\203V\252\316\200i\020>\363\354\204\337fg\b\307"
+	.string	"\005S\262\307\316\207\243\002/\216\301ZNj\357;\337e\3372/|\241i\003\212\022\310\302c\023\035\030\303M\t\314\004 \374\307Hb$\370-Y\024vs\253\001\3707dM\343Q\221/\200\316\300\025\016\226\243]\212\006_\t6\336F\341\037\023w8\021pC<\344\016r\321\032"
+	.string	"\344\340q=8)\241q\r\371\362+\nS\361\344*j\315Q\031r\247\330n\233,\3064\361\013\331j\213Oa\3138\366\227\324 \357P\332s\262<\274\265q\312"
+	.string	"\236\tb\235\364o\245\354\264FriT\362N\211\360\237\022S\305S\035\333\350\364)6pX\1779\235;\305[\016H\020\031\255\006\003\020\303N\222R\334\217\216w\342\240\201\312\035^J\022\360V\304b\213\314b\345\247I\272\340\325Wj\0059I\034@\016I\351s\020E-\207\316-\206=\337\310X\275\r\224\370\340\255rb\263\247\303\fA/\372\350\247$8v\327c\0013\335k1\310\210;F\273\306u\210uT|\311\\i\310\202\035\205\345C\006\236\212\217y\350\235\356.N\264\363y\331J\023\026\316\026\214Y\\\003\303h\247\271\363K\004=\033\2746K\336\026\002` ~\272Q"
+	.ascii	"\331a\225j\311C\313\005\230\316\254Q\367\201o\033\277G\372\037"
+	.ascii	"a\252\227\252\274+l{U\247\275\243\265\347\244"
+	.string	"\212\005\320\215\303T\024\263\275\027\350\244\232h\345\311\340TkMF\352\340\013{`\230\021\361\204\243\2538\256Tx\242\342\017\333R\250\301\212&\350\320Ap\n-f?j%\327\257\bS\326\354|\350/\231\001\231\\\271\307\325\337ad\250*\373d\253\353\253\305\307B\310ve\320\nb\327\242`\343\370\310f\242\362\216o\242\341!\257TIf\353\355\027\230\256Y\330E\324m?\314N\006\237\362x@3\364\2749$\222\0173\207\363\001\004)C\355\202\\\r2\244\232\212H\375\013\377\310\367mS\212\364R\311+|at\340|t\032\253\322\321\302\365ib\371\222\246O\3029\027w;\342\324C=\265\217\320E\2709\266U\224\376\233v\024\bJ\211\267Ic\002\231\001'\234:\t\303B\002eG\361\252\3544\364\2220\031\025u\251b\204N\365TG\207\233W\377\260\326\336\332\267\tz\3607\205\361\214#\303\230\260"
+	.string	"m\210\325\336\335*\332.!\331\277\263\017\317\262\326\021~3\240\202VXM\356?;(\324\352w\255 \275\257\025\013\224\\\332\311\004@\251\374`9M\016\263Q\237\336=dI!\217\250\304\226\214\247\310\002\226\323\312\210\235\240\253\001\362b\324\260\335\200\352o\356\002\262\362]\016 \003Z\312\370\225\001\273\025\224J\210O\232o\035\375\033\324/\266yk\303\253_\023\317\216\335\304\001\254[M\206\367\270c\024y\220\210\254\303B\256\374X\225z\324\230\214\257Ts%\002\321}\351\266p\203\023[\311^\366\\!\275\260\031\251d\336\260\240m\006#\256\003\335=J:\341\302+\331"
+	.string	"\300\013u\2130&\255\341`\224\252/=\223\370 AaS&\310\222\221\t\034y\363\327\322f\352\275\325S\232\345\212\304\r\312\236\2520(\355\325CLp\243l\246\234_"
+	.ascii	"\254\225&Z\004\2132\234\357\2273\236o\002D\002<[\361%\246-\225"
+	.ascii	"\031\2266c\360\302\240\261\fb\225D$\177g\247tB\242=F^\b\375\026"
+	.ascii	"\312\353$\376\240\037R3\341YL}\261\321Qw\243\351G5\240K}\346"
+	.ascii	"\203\013.Q\363\023\346\0321{\216p\223\253\337X\025#\301\227I"
+	.ascii	"T\304\217\306\035\257ow_\210r\221\202\327\247\266)\371i\371="
+	.ascii	"zM\263Q0\253\032\323E\\\n\nl\037\002N\323\252\305\237H\346\037"
+	.ascii	"\226\301;MG\277+`\270\001U\322\331\030\005\"\013\001\247\334"
+	.ascii	"\"\034Ph\362R\247\021E\362<\234\317^\2173\224\201\364\037c\232"
+	.ascii	"\334\333B\220\376:x#\364\022\332\n\332x\206\003G\325\277\241"
+	.ascii	"Y\241\372\306\203\244\374W\263\231\362\222\253\214\t\006E2\351"
+	.ascii	"w\306F\035}a\355\232"
+	.string	"\205\241\037I\005\276 qt\226\234\f\030\346\310\310\275Z\213La\23546R\375\004\227\024\256q\017WI \362\307\017%\261\334\203\277\310"
+	.ascii	"\207^l\316\244\035\374\326\0053\023\330\302\032\026\366!\r|\302"
+	.ascii	"Ih\346qM\233\0320\243oc\22043\030g\026a&\2257Y\220?4\225@\253"
+	.ascii	"}\333\034+\324\273\245\2020\007i\215\247<\324o?\013\336\030M"
+	.ascii	"\bSD\017\035\022D\216\206:\377+N\373\276I$\301\200_N\016A\346"
+	.ascii	"^\264\341\264\232\312\324N58\313)\320\"8\231(\230\304\322\020"
+	.ascii	"\214\214\034Aw\367\221U\262\035L\332\344\221\357\310\232M\256"
+	.ascii	"\204o%,\370\364\317\206\2222eQ/3f\301\201k,\276'\313!\223\036"
+	.ascii	"\355Q:1t;\313^\274\372\274\347G\252\013\276\314\201\273\376;"
+	.ascii	"\207\347\336\031p`\373"
+	.string	"?\002\336\301\333\277\343\267\300O\2664\376D03w\227N9\337?\343\250\250\335\f\277\230\037\273\r\367a\027_\230C?\377\277i\362\003\314\373\367\304\220\257\263\325u\366\322g\265VMt\211Bo@~\225y\322\314\373\"\372v\274.\372\037\013{.q\300n\221tA\223;I\016l\036e{a^\023{\333U\037\224\246\257-W\301Fs\205\024\266\224\352\207\345\0321\2764\365\351\366\266\372\207\241\211\262\277\222\377O_\177i\316\311O\037\321\224\322\341\276\377Q\363\316\231NB=h\253kl;\250\371\233$\375\371\3135N\367\n&\335\330mQ1>\273\302\371\217\340\031\016\347g\233\013\376F8\321q\266\265\240C>Fh\3009\001\267\267\327\260\325\372r~F6\350O\204\275\244\335_\224;x\241\233y\213\337\375Iol\234\036\275\263\304ey\003d;\233\347Q\317aHFx\034#\274E\273\200`"
+	.ascii	"z\243_\006\300q[Mn\233\345\036\333\361\227\371[\350~\222z\256"
+	.ascii	"\016\036\351r]\352w\360+C\017\302\313\312\257\361\034:\267h:"
+	.ascii	"v\332\272i\221\037\364$\206\267\274m\365\361/4^\344\202\205|"
+	.ascii	"O\252/\222\216\351\r\370\234\253i\275\331\227\032\373s\354B\225"
+	.ascii	"!\r\321)\303\037\274|\335\\V\357+\036\264\231\375\272s\377\355"
+	.ascii	"5\\x\t\244GM$]\001"
+	.text
+	.section	.gnu.lto_.symtab.8524700292d8475a,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8524700292d8475a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
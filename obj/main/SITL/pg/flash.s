@@ -0,0 +1,257 @@
+	.file	"flash.c"
+	.section	.gnu.lto_.profile.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 +E\001"
+	.string	"\024\002\037"
+	.string	"\004"
+	.string	"\275\321\333\306\013\002\002"
+	.string	"\002\001\001\265\361\366\267\f\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 2m\001"
+	.string	"D\002&"
+	.string	"\001"
+	.string	""
+	.string	"\004\200\200\200\200\003d\001"
+	.string	""
+	.string	"\002\001\002b"
+	.string	""
+	.string	"\007\200\200\200\300\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	".\241n\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 -%\001"
+	.string	"\320!"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\002"
+	.string	"\001"
+	.string	""
+	.string	"\b\b\001"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"\003"
+	.ascii	"4E\203P6\200\005"
+	.text
+	.section	.gnu.lto_.lto.8d206d874951810,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashConfig_Registry.11.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 \220\035\004"
+	.string	"T\007`"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\303\254\254\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\334\006us\250\365\005uq"
+	.string	"\005\001\006'\001\003\372\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/flash.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_flashConfig.12.8d206d874951810,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\275\007"
+	.string	"\002O66P\217\032\003 \315\243\340 /\211\201`\254P\026NB8\214\235!\216~#\027\006\352\177\005\227X\347k\317\314\224\316p*\024\tQX9\310\354\261\365\226[\312\224\002\236O\007\264Ah\345h$D\233\211\316\364\204&\350\263\241\230\034N45\007\335B\021\334\254\3306nj\337}=z\225-+S\314h=\302Z\013\243\214\262\377\r\365\311\005\206\001H\210eM\302,\035DX0&\330j\277\022\214\036\255\257\377o\364Z\247lx\r\250d\\~\216V\314W\222eDkk\330\232\304%\235S$\023\374\236j\345\377\026\252\220Y\366s\006\263\314\\\200Y\266k_\0204\004T\033)\254\3773~\2703\354j\2338\340\204*\031\002<\374/<\241:\334\350\266\tm\031\332~\001\n"
+	.ascii	"d\221'3\364R\201\305\303\341\230\300\b\346]\002hVS\302\035^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\f\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\013\004\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\b\005\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\t\006\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.8d206d874951810,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8d206d874951810,"e",@progbits
+	.string	"(\265/\375`\363\b\3354"
+	.ascii	"*bD\025D`\246Q:\003}\322k\241\245\220T\030\b-\314 \222\226\234"
+	.ascii	"f\223~d\276r\220@\320\226\377rp\360\330\342\035\220\251\237\265"
+	.ascii	"Yh\243\026\355\005\3234\237GV\372$\254\257\205\251,\215n\007"
+	.ascii	"\335Z+\371[\246$\001=\001D\001\311d7\263)\331Y\306\262\253n+"
+	.ascii	"\206\207l\251>\271\232\274\262\260gW\317X\215\334\325h[\312\373"
+	.ascii	"4ni\254\356f@\267k\251\343\217M\177.\303dtl\214tac\323\262&K"
+	.ascii	"\243\313O\231M\317}\317_c\f&F!\214\305\220l\335B\276\272,\374"
+	.ascii	"\274\177\202\005\016\303Z\030\f\201U\267\020\255\2448z\302\f"
+	.ascii	"\r\352^\311X\f\217a'\207a/\347/\f\346\274v#\273\333\311\311\251"
+	.ascii	"\t\207#O\23737\275\210\333\304L8\333\206.i\0177F\234\330\364"
+	.ascii	"\030\356)\\^y\013;\023\360\363\023"
+	.string	",\334f\344\322^\335k\222.\221\225D\206l\372\007\367\314\345\001\270\264\205\037\335s\002\034G9\001\356\366\356\230\t\367s\226\237\261\260W\002\233\212\325l\261\356U)i\355\221,b\323\257\314\204\273\274\204\373/\346\177\227\333\317T~\326\375\274\364s\200\237w?#\375\254\3643S\240\237\001\374l\304\007\376'\375\026\302\317\006~n\372y@\331\1772\377\275\376\347\376\233\375\267E\243\321\350\177\365\347&\177\356I8~\303;\303Y\302)\231k'\031\275A\223\246\305\246G\f\275g3|\346\214\346h\330\214\231m\323cv\003\312\240f2\035\334\312\330\b\213\302\346lv>G\335^\335\215\340\350\t\326\237\0326\375\032\257\371_t\0333\2169\262F\rR\022\f\216\262\314\350\213N\022=6ur\032\366\362\277\213\ba\301a(\312\275\375q}Tvw\216\333\332J\253\243\363\215\331\301\257c\0333\370\237v\177"
+	.string	"Zw\217$j7\312\230c\020\233\376W\320\257\322mT\352\265\225\352s\313\250\202\311Y*\255M\204@?\213\264\272n-\323f\333^\233\033\271\265d\241\256M\245\2726\215\273F6\215\335\353r\247\212\035\215\254>\267\226\352\263\271Tjd\033\373y$r\221\315\245\332\246\271\334\251\317\343REn-\225x$1\202\205\306\022.J8\216\212\354\033\311\254\243r\007U\327f\243u\263\330U+\031tg5\225hG\037Lf\005\275a5vlv\201\244\025W\263\221PUJ\263[\212\025U'+\030Wh+a\250\261HVc]u\033\350\265;\331m\344\206v\267\261\273s\312\254\265\033\310N\355\nJku\366\303\177\220\374e\225l\210\243\fM\242\301\013\215\001)-\322b1\224\271k\244\230>iNN"
+	.string	"jlA\265\220R^\373\036\004V*\210\257=i\326\206M\262\323b\275i\355S\370yXV\206\255\301P\346\3329N\360\361\321\345T\300I\367\207\016Z\020\\\372\333\032\226\306\330\212\004\220M\255\232c\3720\223\321\346\376\366\212\235v\306]\253Rf\350Fi\226p\255\271\267e\356m\2305\336\2634\2557\353\275\365\272|\210\021\261\263\001':\027\342\257\337\216k\257\226\t\"/\316(\367\334"
+	.string	"g\213F\271\001\356\326\311\265\366\310\275%r\177\026\024\350\366d\243\366&\020\230\235\343\006\313J\353\356x\t\247\200\227p\326\001/\341X\017\363\341>\177Q\322\025\262#`x\334\363\236\020K\340\200\261i\312?\203c<\347<\177\2215{\322\225T\3363\032\337\371\213\220\320\234x\331b\323[\365\236\355\200\211\252\375\260)\327\271W\\\250\001"
+	.ascii	"-1C\270\316\317P\216\303g(\b\304\210\"\022dS\236\303t\316g,\347"
+	.ascii	"\254B\263\373\310gI\207\272\217I\314\013\230\027\244W\270\236"
+	.ascii	"|\301\245\347\265{4f\302\351x)0\204U\034v+|E\"\f\022Q\001\212"
+	.ascii	"\247\212\360\023.\365\202-\214\202)\354\360F\214:*F\005\177\302"
+	.ascii	"[\360'\264\025\243\240x\327\027\003HL\211D"
+	.string	"\337pjJ*\007CX\325K\207E\241m\312\027\374\001UH\345\246|\304\026i\260\nX\354\371\210\271\017\243~\302\b\272\241\024U/\2051,\022\201?\337\b\001\357E\005=\024}D\337\210\237\220\351=\340\320\027\364\375\356+@A\200\272\360\"\367\013\031$d\220\200\373\205\f<^\006(\336=\024\317V<\325\200W\t}\303\247bU\325\360\311\210\304\224T\013\026:b\324\017\230\"X\305AW\214\372I\225\250\002\346~R%\210\275[1\352B1\bl\221;\217\307A\201\211\020\037n/\002\025QJE\212\247\237\360)\b\224Z\361\324\033\022\237\"0\371z@\027\276\016@!\261(\313\254\311\034&M,\020 a\216\202\314h\263,\346\331i\231L\206w\335\\6\310Z\311|\200t\264C\205\210Mo\243q\317V\230\335\234\323\330\311nl\217\246-\253\321Hm\2152\353\201\216N\231\343\017\233\362X\307"
+	.string	"\371\211s\350\236\275\326XP\036\265A\034\310\013\217m{\234\002\207\275~\036\023\342@HF\245\356\"w\272n\330\035V\207]Z\0346\007;m\200\222\250q(f\224$\204\0303#33A\223\346P\002!c\254\254\003\021\200-s\210h\304\3318\226\316\347g2:\211\234\206\345\0232\3177\301\302a\027ptE<\364\034Q\331"
+	.string	"\226\027\342o\340\324\243\274"
+	.string	"\n\251\306\216\013b\231\003\016\261e\024r\002\346\233\340\332\252>\266\276\324\224\013\345h\300\275K\361!\323\217\331\335cy?\r\034tW\037\263j\270t\372\240\244D\225\033\200 \205\244'eA*p\004\352\227\020\372\022\t\3748\342\024\262\006\216\027\263Z\024\374G/[c\315\216\025\372\205"
+	.string	"?;z\004\200\027\362E\016)'\355\223\312`\221"
+	.string	"n6?\312\236\001\036\0270>\247"
+	.string	"Q\203#B\364\225\017\254c\251?\277\021*"
+	.ascii	"\227\016\274\335|\246\345\244+\374\004\275\340\214\325L\360,"
+	.ascii	"\213\016\321_\022\267={\330\036\2018\006:44\235\222\302\377_"
+	.ascii	"\313\316\214i\325;\272\013@\303\222k\356\370\234\303&g\223;\005"
+	.ascii	"\246\207*\tl%\335\271\371\333\030;\214I\375\2256N\354v\223\030"
+	.ascii	"S\334\213 8~\310\314\331\024`\362\037N\030\017\\M\235\336[\001"
+	.ascii	"\246\256# \237\375\341\034\316\336\213h\032\245\336\030\374"
+	.text
+	.section	.gnu.lto_.symtab.8d206d874951810,"e",@progbits
+	.string	"pgResetFn_flashConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"flashConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"flashConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"flashConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8d206d874951810,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,262 @@
+	.file	"gyrodev.c"
+	.section	.gnu.lto_.profile.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 +E\001"
+	.string	"\024\002\037"
+	.string	"\004"
+	.string	"\275\321\333\306\013\002\002"
+	.string	"\002\001\001\350\214\203\355\r\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 2m\001"
+	.string	"D\002&"
+	.string	"\001"
+	.string	""
+	.string	"\004\200\200\200\200\003d\001"
+	.string	""
+	.string	"\002\001\002b"
+	.string	""
+	.string	"\007\200\200\200\300\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	".\241n\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 -%\001"
+	.string	"\320!"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\002"
+	.string	"\001"
+	.string	""
+	.string	"\b\b\001"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"\003"
+	.ascii	"4E\203P6\200\005"
+	.text
+	.section	.gnu.lto_.lto.138b1ff4085110ea,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroDeviceConfig_Registry.17.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 \2235\004"
+	.string	"\204\007a"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\261\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\347\007us\350\366\006uq"
+	.string	"\005\001\006'\001\020\234\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/pg/gyrodev.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_gyroDeviceConfig.18.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\375\007"
+	.string	"\322\31786P\217\032\003\240\222\f\367\017\"&n\370\210\025\225\264\334\303\343\332\225\231i6\032\2710\300\030\257\341\"7e\213\231\031\342,\2504\265\b8\206\r\024\204l\271\245L)\r\"\316C\002}4\365l$\320\207\353J\241\031\032M\221\003\303\303\364t\020s\353\224\033\201\272\031\301q\335\344|w\366\310j\346\341\212qA\305\212\326%\255\225\360HI@\345\177B-2A\021\320\342\260\254M\232\345\246\372\310x\301\240\340L\373\235`\324h\235\375\177#\2535\314\206\231\202+\366\322i\371/fd\236\"Q:8m\r[\277\f\342\031f\362\300\317Z9\371?\204\036l,\373\271@\263\334\230@\263\254\327\262\370k\335$*\213\222\330\377\0317\354\031z\265C\f\220Z\235\f5\013\377\013S+\f7\272\255A\333\255\255I\t"
+	.string	"2C;\0258x<#\023\232\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\021\004\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\016\005\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\017\006\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.138b1ff4085110ea,"e",@progbits
+	.string	"(\265/\375`\205\n\235;"
+	.string	"\352l\314\027BP\344Q:\003\017\272\251z\273r\350Zf\360n\034\322Y\243\211E6\330\360(`5\333\277b$\365\370\305o\200-^u\374\003"
+	.string	"\0332"
+	.ascii	"A\007\204\200~\366i\260!\253\356'\212\252\021\223\021\273e\n"
+	.ascii	"I\001d\001o\001@\016]\365g>g\272[v\226\347\311U\367P\365\374"
+	.ascii	"@j\244\345\252\347)\354\031M\032\206\203S\263\206\313\234\371"
+	.ascii	"2GM\034\233\267\013m\030\316\211\327}\004\f\033\233yc8.h\356"
+	.ascii	"*\270\3418,}rh\373r\327\335g0\277\357\247p\201\351p\313e\252"
+	.ascii	"\224\335G\320\244\222q\340\2544\352n\363p\035\276\303zX\312x"
+	.ascii	"x\216\355p\224\351\260\234s\333\215E\365$7'\245M\200zV\262'\262"
+	.ascii	"\374\206\3458J\305p\372\211\367(}\234]\365B6GO\231j\375\217}"
+	.ascii	"\013\366+X(\023,\325\bV\301\231\246I[&A\272\352;\260\257\300"
+	.ascii	"^\361\324\312aX\fG\0170\231S\270p\036RL\273u\267O\352\2209%S"
+	.ascii	"\256z\b\354y\314\005\210\351\013\007\300\236\017\254<\345\003"
+	.ascii	"\353/;\201\247V\r<\265\376\354\345\347.\354F\305c\216A\373\255"
+	.ascii	"\273\215j\n\024i\016\317U\337\362\324\312\262\324\372\277\316"
+	.ascii	"\1778J?\323\371\031\301\317\016~n\360\363\202\237\023\374\314"
+	.ascii	"\340\347\007\023~\356\375l\340\347*\326\372\377\364_\024?g\375"
+	.ascii	"\034\341g\253\377\202\376\357\371O\367\337\355\177\357\277\235"
+	.ascii	"\377\274\351t:\375\317\374y\372\263\204\002\276\363\235\324\332"
+	.ascii	"|\266"
+	.string	"\375\306\204'\316\035\230\253\006\270F\330s\035\3679\373\271\037\026\304\266\375\203\307\214\225\2255\352\347\363jU\352\201J\tt\026tB\001\272\312\251\n\034\231\334U\257\210\001\375_\272\361E\316\t\350\217S\235@I\230\354ys\346\307\332U\243l\307r\376\367\222\331\230Es}\330\337\177\355d\263\273\313\224\332n*\003\234\225\230\257\376&\3461\203\377j\367\017$\352F\273\222\210\265\022\2274\273\352\177\005\375\266ndT\267\335dF\325\220L2{\234Qm\247\r\350h\222f\266jN\025\332\267\333\346^\2529k0[h\223\331B\221P\275\204\"\273['\024\363-\211dfT\315\311\214B\235Q\275ldG\223i\354\022\352d\336\201:\241\230\321\244\223\271TsF\235]ard\007\235Z\033;\231\313\366Av\226lBI\231-\264\355\272\371-\254\233\f\272\317\240M\273$\021f\243\224\372P\246IB\233"
+	.string	"\231r\r\332K)\363\n\264\373\212RF\223Y@\266\322v\302Rd\222\263\036\013\353.\320m7Y7\222[\332\335\310\356\3565\317\332n#PL62\262\356'\025Y\237!\333\204u\3377@l\234\314\350\032\324\327\246L\224\255\305Z$\263\265\235Z\223\215\"\303\364Xw3\"\226\315\031\354\026v\231\201t\354\270bn\200\234\027H\226<\354\366\373x\\1'dTw\222?lH\256\222\233\344\252]\350]\343\350M\273A~\223W\271\214\273iw\3546Y\332\304\203\233\335]\246]!\027\215\245O\250^\256)\204\205\005\200\207\232\024\315I\r\373\240*%\263\304\227Aw\377=\273G8z\321NU\341\367\241\335!\327\214\245\317\266\313\\\0202;\202E"
+	.string	"\253\351\020\037;\263\325\354\032I\3232At\325[\244\367$bG\207\031\021\216\336'\253\250\255\r\244\017b\222\363d\215\367d\317+c\317\323Q\306\326\335\241\341\231\262\277\220\330Kv}p\324\352\376\370\355\301qWJ\266\335^(\222\316\2149\304\236\255V\336t\312V\353\357 \366\326\261\277R\366\277\314+\246\024\255\223\b\317\025\203\243\233\033S\336a\241XjU\300R\353\275\222\304\323\333\377\322\023\0276K\320\310\261\347I'\236\344AsU\225\017geH\347H\377\322\265C\205\215,\216=;\342G\377\222\223\335\2243a\256\372k\206=7RB3MT\344\252\314\210\r\273[\254"
+	.string	"\240\255A\302\214~6\304\207x\321\213\356ew\017\3001\225\304\350\252\234\210\025\235\0271\"^d\001\332\235\344EO\221\272\223O\314\013\230\027\250\\\326\250\300\255\352\357\025\366v<\2656\261\324\312\205\002`\\\305\342\0070\242W\210\002`\\\305\342\007\032\300\243\021L\305V\325\3612\262\202D\251\337\360\213i\030\343\026\225\214[\001\216[\303 Qi\030$\362\216[\030|,\020\207\320\250r\365\300\210^?\265x$\362\272\200\275.\240\361K\035z\t\217?\240\261\367\342V\220\230\325T\344\222\361S\301\212G\2430\bLA\340\277\255\341\210#\320\bL\021$\026\370OX\004\016\201A\366\0260H\300\240\341F\357\0326L\3300a\275\206\r>\337\006\f>\366\030|\274\343eP\335\213\b,j\035\275\274\212ZL\303\240p\006\227\222q+(\2141\364\n\001\374\tm"
+	.string	"E\bXo"
+	.ascii	"\273\206B% \021\354h\374\202\3213~\201\020\022\215k\220k\305"
+	.ascii	"\320\370[\215_ ~\024\204\353qK\303q(\374\352\031\215\300bW\327"
+	.ascii	"\207\037\005!\200\343V\220k\205\227\260w\237/\204\002\026'H\260"
+	.ascii	"\277,\033\300.\257\"XP+H\324\032\n\271hh\375\212F\255\254\001"
+	.ascii	"A\256\025\302\343\r`\257\312\215\362D\207J\235\235\313\306\202"
+	.ascii	"\304\326\306\214M\231R"
+	.string	"\347\203Wf\006MN\235\223\350ur\243\\A\365\222\356\t\233n>!4\301Y\333\261\274\352o\224\373\204\351^t\247a:\244#\222\221\253R\360\375BY\333\344\322\034]\225\233\247\326\363\336\330\363\026fB\277H\2162\241\313\204\307|6\220\fk<\232g\020\330\2704,}\256\272\244]\3364\210\f\351\351\302>\200\256\250Q0\247\2243DddfFF\232$\007p\002\221\2512\362\021p\251cfjD\223\244P\350@\377[O\314\345\226j'\034\243\326L\237-\221\3367X\220\2715\265~/4\\_^\251k\024\232>05\342\320\331r\202\266\256I\376\207\002(\270]\313\207\335\202NNg\351|\327A| G!\305\315\213\265\324r\251+\312nQ]\fR\214j\240\227\306\367\005<\336n\273\026\276\324\213\340\232u\227\220\363k\262?\357H\b\005\224\200`\226\377\201\244\2304]\262\270\375\316\255"
+	.string	"\206\231\r\257q\241\335\326\321I[,\353\327\232\213\215\366m\003\22455,\313)\302{\362?\344b\013\300Lv\017\251\036\317\314W\315\310\232\365-\211?\314\234\013\350x,\316\254\365\032\350[\251\031\247f\261\327\304\316\204\236#\fV@"
+	.string	"\322C\020\246\370\273\243\027\241\310\232\211\202*\201\f\302/<\b\216\362\335\246}\340(\0028\306x\355\300\257'\274``\242\2702?\024$,\364]\372\005\rYf\024\022mR$%-\003\337\t\204\"I\2769Z#\206\223\206T\200\024\256\363j`"
+	.ascii	"\372\324\233\200\330[\252\226\034%\354\031\202Z\255\221\251\260"
+	.ascii	"\360-\270iL\225\343\373\336\322\330G\205n\021K\217kD\350N\344"
+	.ascii	"\b\021\202\022\352\202\035i\241\376\277\r\006R\272\336V>\221"
+	.ascii	"\317f\217\365\t\037\276*"
+	.text
+	.section	.gnu.lto_.symtab.138b1ff4085110ea,"e",@progbits
+	.string	"pgResetFn_gyroDeviceConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"gyroDeviceConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"gyroDeviceConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.138b1ff4085110ea,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,521 @@
+	.file	"pg.c"
+	.section	.gnu.lto_.profile.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.text
+	.section	.gnu.lto_.icf.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375 v\005\003"
+	.string	"\304\004j"
+	.string	"\b"
+	.string	"\247\267\241\312\002\004\002"
+	.string	"\002\001\002\002\002\001\001\227\267\273\373\r\002\004\356\276\277\360\003\003\002\001\007\262\211\373\251\013\002\b\276\362\342\333\004\t\303\341\316\304\007\004\002"
+	.string	"\002\001\n\301\256\303\221\001\013\333\205\320\333\016\002\002\002\002\001"
+	.string	"\007"
+	.ascii	"Q(\2243\f\270\202\224E=\247\224\031\332\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\r\004"
+	.string	"2F\017\022\260%\351\035\206a\0300\026\3156\262Ik{\313\224\002\356\002\024\206M7C\244\354\270\"Dy\217z<!\346a!\351\243\361\225\312\224\002\317\254\006\352\030\212\253\266`o\216\266\261|\001\034"
+	.string	"\020$e\b\266\n"
+	.ascii	"\331I\215sW\326\316\034\0057\020\035\304\"\204\305\022\322`\001"
+	.ascii	" ,U\214V\300u\310C\3520g\250\021\324E\260,\323\254(\013\234\001"
+	.ascii	"\244\332\271\312\365\314M7\265\234\006\206"
+	.text
+	.section	.gnu.lto_.inline.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\207\001\235\b"
+	.string	"\322M-1`M\222\016@\234\261\204\rP\\\323\307\354P\261k\340\013\f\332\224\231\252w\006\241\226\203\220\005\230\342\032\270$\311*=\262\325\315\r\265\326,\331r\247\337\204\331\210\316\206\023)\364\241\263\341HS\244\312\344\2561xu\210h\200\264\001\034\236\037\240\270\220\340\0208\272\377\204o\351\261\373\016\360#3\241\241)\353\330Q\326\215\321\033`E\210\007I\353_\246\020\026\225\206`\366k\236\317\340HCFI\245\177\t\2556&.\351\273)\013\377"
+	.string	"\326n\323\227v\366\005\361\262k\271{1\315\314|\236!3\253\207.\300'\275\247\327\033\316z\343\207P\214\314\244|t\027\002& \200\002\241\240\214\017@\025#\337\255\234u\234\271\364 <\002\220\034\003PLp`9\353\320I\271\"\360"
+	.ascii	"\336\302\332\234\003?8)\037\267\341\277\035g\032f1\261 \346W"
+	.ascii	"\357Ui5\320p\200\260\257\345k\304z\305\326\022\313j\257Z\214"
+	.ascii	"^R[\371\315d\264\213t\r\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"5\006"
+	.string	"\342\n\035\"\240%I\007\243\373u\256\002#[\313\377\377b\331\357\260\252\252E\t\3425\fL\264\326\332\316\233\310$\003$\357n\354\033\353d\212L>\274a4\202\360\356\325\225\365\016\360_\007\311\224H\017|\215yUw\364\305r=\361\210\027\\S\022\347c]I\363+;\212.\223o\031=\364\023RJi)\314\307\320\177E^\313\341\345L\232\365\212~9\370\021\r\036\020\037"
+	.string	"9wB\272%\322\0204Q"
+	.ascii	"\302B\200p\214\2731\207\021n\250\346\bC\363\"\004\210-~Y\033"
+	.ascii	",\253=Y\021\235Awg\001\037\314\f\340Um@\333z\001a\314\345J\f"
+	.ascii	"=\340@\t\020\246r\267\212G\212\025@qK39)\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\231\004\001\205\004\004\231\004\007\231\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\245\004"
+	.string	"B\306\025 \260%\351\200\303\260\b\360ra \313\032\200\212\002\246\b\364\201\330.\326\266fm#\226\020\"e\n3\205Yi\266\230\302,u*\017tP\264D\223\226#\270\033i\037\005\026\3278\241\0024\206\32668)\232H\251\020d\341G\244\336\335\234\243\366\243|9\033\023\236'\030"
+	.string	"H3FSbES"
+	.ascii	"\327)\214\303c\r\b!#`b\300\\(y\207\351l\331\303Y;\354\001\300"
+	.ascii	"\305\200D\320\262W\334\202\3247-Q*9\327\330\026\001 \274\001"
+	.ascii	"\300\001"
+	.text
+	.section	.gnu.lto_.lto.ca9c65ee6bdee16a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgFind.8.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\371\001\365\021"
+	.string	"\346\242yH\340\322&\035\222c:\017\371::\025A\346&\332\207\270\3331:\305\232\227\324\271\203\016\372\355u\\\350k\312\206\333\340\333\020\221\334\322\036e\2529\346\2141\346\214JI6\205\370\035^\332\223I\313\356\266h\204\354\275\345N)g"
+	.string	"_"
+	.string	"i"
+	.string	",\023P\247&\302\317\253\026\244V\3203\370\022\372\331}\204~\356\b\323\035\234!\035;8CH\227\340M#\353\034\235r#\313\307pN\344{\275\366H\363\265\"Ma\3639i7`\237\207K\331\240\207\207\204\310\227AnP(\303\364\271\342\276\366\222\330\f\311\366\331<r)\265VG\330Wsw\267\r\302\266\003;\222\004\356\270\203?\235\321\323\321\361\264\373"
+	.string	" \274B\222\260V\0167!\025\307\214\201\342\264\337\276?{h\233\f\363\027& \343\251\265>\310\257\3714VJK\303\203!B>j\005\025|\372@\007c\233>o\307\330&\333\033\355\373\374'\346\240\005\317ZC\330\214j\005\027\330@\367) \276\305]\3048#\364\313I\026\035\212fT\264\342-\256PNl\306\224\373--\215\007\020\345\374\220+s\267t_\3737\324"
+	.ascii	"\3758\342\341\212I.p{\013\235\333\255\t\220\327M+\336\374\320"
+	.ascii	"\251\333(t\265\272P|\241\013/\376\211O\237E?\347>|\274\231\355"
+	.ascii	"\240\321\343#\023o{\324#\310\266+\263\301VD\311Q\243\2047f\227"
+	.ascii	"f\f\236pZY\255\313I\265V99\251\274\223\312sa\221\320\342\251"
+	.ascii	"\254^\274\223\021\247T++\257B*\265\362L\226\371\306|\240\313"
+	.ascii	"\025Da\021=\214[\2266\306u\212\314\266Lp+3\203\017\223[.)z\005"
+	.ascii	"\205@\347K\343\033\241\272Zg\016\363\211^t\222,(z\030\212~~\003"
+	.ascii	"\210\230\331p\305\244\313Zk\245N\360$ @\002\204\234\345\001y"
+	.ascii	"y\3211\261\331\330\2030\370\242@:\227\031\370\250\337\213\254"
+	.ascii	"\262\345\264|\263H\273%\275\270hb\017\205\201\037\275&\03294"
+	.ascii	"t\027\005\364SU\226\335*\333\376\320\236\240\r\266|=\271w\370"
+	.ascii	"\031\341\345t\347\024M\376/+\"\303t\0312"
+	.text
+	.section	.gnu.lto_pgResetInstance.10.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`;\0025\023"
+	.string	"\306#}F\340\322h8R\3352\316\371\331\315\224\223\330\320\231J\257\023\263\366\342\246\225\352#<0\347\025\345\224\177&j\226\326Xa\314V/\212\312\271\232\340\373<G\236k\234w\275r\3654S\0300\355\002\367\311\336{K\231Rl"
+	.string	"^"
+	.string	"i"
+	.string	"\274\0056pzh\336U\342\303\323I\304\207\226\331<\006\320"
+	.string	"\260\201S\301\264\273+\035q\331G1\0045e\376\250b##\247\233}\024A\222\017DJ)\035\016T\240t\002\004Jw\313P=\364\310\351l\016\202\t\226^\374P\325\224\310\241t\266\324\224\216\0064\331\335\007=9\350j\231\243\312\356:s\272\016\367\351\266gl\247\330\031\023\037z\336 -!\001\355h\371\263y\265\324\034\373\340\356\256\025\307\036\323#\347\375\"c\372\364\335?\212iPLk\230N0\375T"
+	.ascii	"\035\325o\267\346'd\223B#\023\266\357\367>$s!\247\364\374\354"
+	.ascii	".\352\241-c\243\036\036e;y\032\230\020<\355\2478\220\354\273"
+	.ascii	"\231\013\330\305\241Q\264\0335l\331\364\334\335\231\272\210u"
+	.ascii	"`g\367\366\234\337\342.$\200\236\300\022\237c\211,\275\033\266"
+	.ascii	"l\262M\341D\025T:l\013g\261\3620\265\263\273\251"
+	.string	"'>Av\251\274\236\\D\355\226+\237\263\311Mg\036\321\353\203\256\362\251\345\360\r)\360\273\213x\322\021-9\302\335\324\362\347\017\031\303}/\247][\003\177\005\354\345\223\230\321\276\320\202Ya\001]\255\230\272\005\305\005[\271`\253\f.+/\253\226\030\314\n\205\304/X+\266\212y\275b+\024\217vp\025'\364\221D\323\332H E\324\240\232A\b\233\316\234\nj\210\302\227<\"p\364\210\016D\325\r\275\035\251\252\243\016\020\334\020Z\376\254<B\276\031aI^S\037@h!%\335t\346\030@?;\240\346\3700X?2\212\240\273^0 \200\002\0311\355\001\001\302\313\330\036\212\326\n6\2508\024\261\b\273\017\330\n\0055\\\331\337\312H\227-\036\332*\017\311\361\352\233=\205o@\330\270\254\252\265\013b[A\254@l\330\\\253\336 Hk\336\362\264\003*\025\244@\202\254\034B\322BP\214\211"
+	.ascii	"\321,\256\276\220\2271\" G\001/\301\314k%C1\013\261\350_\266"
+	.ascii	"\316&\2742"
+	.text
+	.section	.gnu.lto_pgReset.11.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\325\b"
+	.string	"FR?7@\217\322\001\300\026|=\016\206\211\345\035\355hc<\001@\027\271\271\334\320\217\376\217\314\212\207\314azD[,\245ab\236FK\327\260\003\035I\300`2\270\255\224)\005."
+	.string	"0"
+	.string	"-"
+	.string	"\376N\200\035f\317`\207\366\354\024\003R\200\013c\305\262\273Q;\356==\377\251cJ\246\320\023\200aw\235%\223\306\255\267\215`;\301v+\002+\005*\273\031/\327\262 \n\210Or\325\347\237a*dw\265C\373ck\207\327l?\355\213|\304;\n\364\201\335\223\311\311\356\247\340\203\3540!_e\317W\024\331\356\305\202_bQ\341{\034\372 \354P\365\252\347\306G\013%\312\227\375\215R9\354_vw\255'[\323z\324\2370\033\247So4['n\235\030\361\340"
+	.string	"\0217\235'j2\346:\234.Np\\\027\265O\364\313\352\311\360\305\022\351\310\230TM\2659\211|\311O\275\241\205E\322\t"
+	.ascii	"2\241\373/\260\301\205\003\227\321L\305\003T\210fu:\\\303\013"
+	.ascii	"a\222\001"
+	.text
+	.section	.gnu.lto_pgResetCopy.12.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\327\002\375\026"
+	.string	"\346\352\226J\260VU:\364\006X\276b\321\210\224\177n\240\\\253\201\214\306\257O\266\211\302\022^\246\231vg>P\301\212\364L\337\277@\330\261\353\031X*mP\177\320\377\330\376\300AS!\312\371.\234\372K\260\3510\310\020!\204\020\271S\n\205"
+	.string	"|"
+	.string	"\202"
+	.string	"6P^\364\371\225\361by\324x\021A\202\230e?Oh8\t\f:2\232\324z\246\326\204G\240\236\337\020\240\236_\322\303\363\026\251\354%9\212\341R\231\217\363r\001n\211\220\223\021<\270\223aK\017\013\337\203l\300\205\002\206\324p\361\235\016\035Sn\265\377Nwn3*\256\350\3600T0\024\204\"\345F\013\267\210\267\303\274\325\350\376\367\225\334.\251w\353pJ\312\324ZMm7\236\333t\333/l3\260)\216D\277\370\242\177M\375\323IH\210\017$l\233tV\rKO*\020\361\306\317}\277}_\306\217(\274\206\t\350\202h\334\347\377n\024\2439#\241\240\317x\317\260\307\360\311'\304\207Z\353g\370F6\r;\357Ffv\241\206\274%FB.\027\355R\302l\223\202m^\274\035\263M\333\341y\030\261\027U\260X\253\b\037Ky\021"
+	.string	"\245\324\276\320\207b'2\222\253\324\232\373A\252\365<\020\253\262\326\332m~\216\353\230\tU\253\361\266\325x\221\334S\211\235\017\032U\nk\255Ul9j$\027ec8"
+	.ascii	"k-f4@\344x\204\253\263iw\377\3733\360\300P\022,B\243J.\260t\326"
+	.ascii	"X\256i\0070\321\301\315\350\222\177d\232\333\220P\326J\203\361"
+	.ascii	"\221\\5\276\317\315\376\350\024\267#\362c\210(\207.m\360HQoW"
+	.ascii	"g\2373z\230 =Rxs6Im\242\224\324\246\222\272\274\357&\037\216"
+	.ascii	"\300Z\275\326\206\345\332\n\256\226*\264\352\205\345J\261\\)"
+	.ascii	"\033\232\231\232\224\352\005K\275\240\334r\255^\251\t\255\326"
+	.ascii	"+\3453\347\233\363\030\304\361\200\243wo\020\314\300\003\222"
+	.ascii	"\277l\374\356\254erv\346S\242\250\270\346\332\016\036\320\335"
+	.ascii	"K!+\220\234$\261\2608\001~r@\344\352\302\027G<\240x\340\035."
+	.ascii	"\271&\360\346~w\2253\210\243$h\204F\225T\214\253s\214\207\020"
+	.ascii	"eI%\372\036\204\025\313\trw\334\373\2166 0\002b\234\313n$\302"
+	.ascii	"\013\232\314\321\364\fn\305^p\374k8d\346\027\323\301\333\250"
+	.ascii	"\330\232+\203d\310\326_\216#[\005[\353k\375K1\274j\034d\020\007"
+	.ascii	"D:X0\205\202\270\204\276\332\252\205/\264\264F\260`\265\312\340"
+	.ascii	"\016\027Lh<\242\371:\332t\262\205\300\236\235\357\260(#H\324"
+	.ascii	"\261\260\303o9\372\313\344\034\275U\270\230\t\200\343tk\330\351"
+	.ascii	"Fj\256\261\271NH\022$LW \003"
+	.text
+	.section	.gnu.lto_pgLoad.13.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\334\001%\021"
+	.string	"\266\341tF\360\322f8\260_#\033\016b\f\316\207e\021(\016`t\254\032\257\177\333SL\001[V\341\316\251{\213\020\001k\277\276q\363\"I:\265\301\322\017C\362\276\177\232:5\326>Y\025\241\325\330E\275\311\336[\312\224\002`"
+	.string	"^"
+	.string	"a"
+	.string	"<\204\020d\332\227\361\034\326u`>\262{\363C\333\035Kl\340{\347\361\002\274w\337I\274w\266\275\340\204\345\326\307\0255\2679\001\202\206mw\fU\305[\3474[>\b,\346\334G\342\3125\220\355L\004\366\342H0n/\036{\322\300\\\231$\224\335u\316\300F\334\335m?\260-\301N\b\001i\360=?\310}\376\222\323\037)\355]\347V.\235"
+	.string	"N\210l=\b\004\355\326\334~\254\216\016\207\013\333\367m\\\266\372\217\273\235\331\312\257q\240\227\377x\302\r\333\356\202/6\370.m\226\r\332>\256q\001\366e#B\0017\343<\254\367\270\346\322n\n#\332\356\2268\301\367\256"
+	.string	"\247\243\003\007vf<A\261#\323]\363L\n\352\200\332\207#W\336|\231/<G\212I/{\2320\032\262\211\244\247\235\332'T~\306\217\235B\f\232\017\"\017\032\343\0039u\332\206o\367\305\300\237\271\254\370,`\274w\236\036\350#EC(rtd\362f\217\256T\034\373\334\356\256\365\306\376\370\207|i\323\027\326\300\242J\255\304\023\007\322\251Cj\305\255\250\304\f\034\352$\252ULP-!\252%dI\245\254\204*\342*4!\261\252\345$\206.*\225\030\202\243\314\365\306\217=\302\216\026\261Y\372-\317\372\251*\215mU\243\310\250\213#I\020\r\251`!?\363\251\2471\016J\030\205P\305qIS1\360\b\275\262\310\240\246>\366\037"
+	.ascii	"\326\324a\030,\326\323\361P\263\327h\323z\bb\2313\342l\240\325"
+	.ascii	"\302C\364n$\246\210\230 \3045\033L\023D\250\260\240XP\367\200"
+	.ascii	"\332L2\266\002#\203\032\001q\0031\340\312\022\306\r\252\006\334"
+	.ascii	"\003\303\026\240\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_pgStore.14.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`o\001\305\016"
+	.string	"&\235dE"
+	.string	"\257(\035\307\370\304\334\255\215\244)r}\003&\013|URC8w\007j\306\330c\037[\347q\337\037\264\337\320+\363lu\213o\326oN_w\351\213\371"
+	.string	"\315\251\3064\020\273v=xi,!\233\020)S\nN"
+	.string	"N"
+	.string	"R"
+	.string	"\033O\373\255\217"
+	.string	"\037\216\274\263kR\302e7\344\360\201\356\233\303\316\266\037\342\"@;\246\205\034X\317"
+	.ascii	"B\345\272\331\335\317\300\005\304o\3325\3427\335p\360\t\372w"
+	.ascii	"];)q\261b\231\236\034\203\335u\256X\026n\275"
+	.string	"\355\r\333\r\354\313\002\351\370\360\337\256\362kL\247\246\017 \312X\020H\261[a&\333\231\r\306\203\355\373-\207\205\334\204\027\274\304\334|\305\016\261=\226\277D\276\342\315$s\262\273\236\210\355}K\033\264=\333\232Wq\314\234]\f5.\273\313a\004\231\342\026+\002%4*\325+\247O\275\360\364\372\226k/\246\030\0224,3\n\314\016\212Q=\035\020S\221\240r\346\303\034:\212\b\335.\005\005\376\211\322\207\337a$~\213z\330\223D\205\215\fJ\353\2243;D\245j\260\257\255\232\330\\\332{\312\317\351\322\235\2469.\206\360\231\020\002\321D\245\004}HjO\007h\364\201F\237\204\220\307\307\347!\201|\035\032\026\215>\244\257$\022\221>/<\335\3464@J\306\314IQ\356dj\247\034\265\037x\344W\276\353\016>\2040lRj\362_\366\034\346\323\351_\357\304\250\271\200\322\3424\365\256'\b\033"
+	.ascii	"\034\312\213L\333`\304\255\026\2244\364\234is\250\226\217n-\020"
+	.ascii	"KV\314\022.\214\204\317\262\b,_\212\210\320#g\260\021\324\022"
+	.ascii	"=l\210\206\004\300\212\240j\300=0L\240\"\203\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_pgResetAll.15.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`o\001M\017"
+	.string	"\246\\fF"
+	.string	"\257(\035\204\b"
+	.string	"\375e\024\005\240\306D\005\306\337f\253\375\350)Ech\337\331\"\2707\243\204Y\2405\361\350\207\276*%\311g\025\225m\277\376\267\377\377\272W\314\033k\030Z"
+	.string	"TQ\360\256'\226\354-wJ\001S"
+	.string	"P"
+	.string	"Q"
+	.string	"\007Y\373\227L\005\230\332\356v\312\301\333\212\t\r\316\212\t\315\354\022\274e4}J\215&\237\345\031'-T_\310\247\354\244V\036\006|)\371\ti5w=\222|\250(A\224\\\357z\202\023\033\325W\362\330a\260\273\216\252\357\302\275\3356\005\333\006\354\203\0018(4\314\350\f\334U\216\213\225\315\232\017o\375\366}\227\307@\016c\215\032J\313\356\376\3450\177\374e\375nj\273\373\026\337\365\021\007Moy|G,"
+	.string	"X\251 A\333\0055>\235\301}\032|\201\355\223;\306\366a\203\330\236\317{l\262Y\004R\357\272\024\361\335\240f\261\020\250\230\343"
+	.ascii	"q\352\325\207q\214\342U>\354\r^\310R\032\342\307\f\3413\035\334"
+	.ascii	"\256\210\002_f\202\004\277\203\307\3669\365\261\023\bW\240\270"
+	.ascii	"\274\234b\216\306\330\244>U\025\033D\305\177X!\315\232b\313\350"
+	.ascii	")\337\272\337y\242PI\r\332\020\221:\021\251{\3409\340\350@\245"
+	.ascii	"\216n\003\303#R\250\324E\030\215J\235\007<]SX\316\305d\220\235"
+	.ascii	"\024\365a\205\264\251*^\200A\245v\302h\220w\200u%9\341q\273#"
+	.ascii	"%n\"$E\336v\225\267}^\005lx\245\020\211\341\345\356\2564\002"
+	.ascii	"\r  P\002a\020\261\003a`\367\035\264\316\371\3331\2226H\302\242"
+	.ascii	"a\032\336\032\372Uoi{\3613\264\220\316\n0\241\235P\230\"\266"
+	.ascii	"\267\303|3\3356OL4\027\341I\357\263;\264\373\305]2\303\354\006"
+	.ascii	":\003\265A\276\224;\227x\002"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.28.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`@\004e\033"
+	.string	"Vp\246H\260\226Q:\024 r\332\350F\021\305WS\211\006\245}QD,\b+-\264\336\367^\231EO,\266\235\0317nl\007\233l\327\252\277\3751\t+\216s\247\220\337\b\305\032w(\374\220\002_@\241\300\256\311o\367\336;\245\211"
+	.string	"\221"
+	.string	"\224"
+	.string	"\362\275\034\035\027It}\272\017\335\177\370\347\230]%/R\273{\023\276\326P*\337#Gy\030\313\224\005S~\314]G\317\201qQ\210\236\322~\323\235t\327\321\363\001\273L=\251\335\221\301\253\025\204\257\036_\240\365\032\236\246\365j\037\207\037@\310\211\266\375"
+	.ascii	"\202\316>\037yG_\202A\364\204\265;\302^\347\214\373|J\352\343"
+	.ascii	"\313\"\244\237\317\003o\223\345W\025\364!\245\270$p\352\302\331"
+	.ascii	"]\207*\356z\333\023l_\260\351R;_\206X<\310C\373~\222\007k\217"
+	.ascii	"\342[\221\242\344H\374'\207\342\227U\256\312\277\232\230]%08"
+	.ascii	"\341\253\223\334\233\320\\\0034\256(\356\216K\316D\367&\264o"
+	.ascii	"\321~\265\214\024\302W\001\3624\255\237]\243B\342\372c\344?\340"
+	.ascii	"\324\021\233k\202\216\330\302\0371\364U\361\256$\204>\"/\302"
+	.ascii	"s(\327\035QX<\366\243.e\277\214;\224\017"
+	.string	"\005\334\335\027\216\372\276\234/\304/\333\017\222\223\025\026h\305\315+\020\377\250\200\rZ:\341 \324\331/\327Y\247\265\344\234\023\301\217\250\305Nf\371Aox\226\234p7(\202\177UB\307\247\3213\037\274\215\221\323\316\250\311\tHf\311)\303\223\236\356d\262--\363\036\177\314K:\004 \355\252\322\255\367\376Z\245\351\214\364\234\221\226\037\377\317\330\324\b\220\264{\224\365ecT\"5>\365[\375N~EF\267\205\320\244\302c\031\007/\362\300\310C!V\361\fggB\210\372p\236M\023B\364iE/\307\024\323\350\362\204h\221\013`\016\254\r\032oj\246\311\221'\006\006\241\223#;\344\310\030MG\004\ra\233\341n\261\021\256\030\211\031\216\326l\267\017T\026\273M{h \333\201\311v`!f:5\230\207\033\016\326\200\306\266\235\330\r&\302f\273\301^\247;\231\b\310\337\247%3\215l\313L\343"
+	.string	"\315\335\2342l\007\3601u\224\324\333\251d\003\3225cf8m\013\030\344\213|\340C\253\033\"\227\253\241\371\343S9\303\267h\b\347\251>\240\213\225\244&\247\326t\315\003Om\274\210\"\252\223\316\326\374\320\2269\351<\224\323!;\214\354\202?\302$\ba\250\221L\305\020#\"$#\232\264R\030\016p\"1t\267\r\021\2609DG)\024\226\335\001\026\353\201\320[\222\006qJJv\245f\223\036\037\004:\216\026\2007\265G\215{+\210\326\312\301Z\264\\\306I\221\202\371\211\024\024\342(\004\240\201&\023\206\031oe\224\037<\214\221\202\0051\366y'\bO$J\370\336#}\301\177\323\346\301\266\213Zi\003\\\200\221\006K"
+	.string	"\320\317\216\3740F\312\265h\002\211'\252 \267\022\320\207\035\2374\336\261\262\205"
+	.string	"\364\2633\300U\241\231\"\364\341\342f\235\223\276\020B\265_\320\207-\241\250}>\242jQ\273\371\023\337\262Gi\362!\016}\220\275\265g\3041{H"
+	.ascii	"\321~V4*\352O\222\027\376\371\024E\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\365\006"
+	.string	"T\n{\001"
+	.string	""
+	.string	""
+	.string	"\002\034\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \b\177\017\252\333\3426\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\021\020\005\020\021\002\n\177\022\023\023\024\024\013\177\025\002\f\177\026\002\r\177\027\002\016\177\030\017\177\031\360\372\2508\001\025\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\001\022\177\033\003"
+	.string	"\f\344\001\003\004\r\204\001\003\004\f\250\270\275\324"
+	.string	"\001\204\006\004\004\264\345\241\253\002\001\225\007\003\007\004B\003\b\004\263\244\257\024\001\242\006\003\t\t"
+	.string	"\210\373\227;\001\342\001\003\n\f\344\001\003\013\004\221\205\327\307\003\001B"
+	.string	"\026"
+	.ascii	"`$7\313w\2501\\\343\235ap>\225\221\217\351O\301\360\354\265L"
+	.ascii	"\267w>\202!ML\234\020@\007\020\f.&%\202\020\216\250\304\b* \236"
+	.ascii	"d\350`:\001"
+	.text
+	.section	.gnu.lto_.refs.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\007"
+	.string	"\002\003\006"
+	.string	"\002\004\002\005\006"
+	.string	"\002\006\007"
+	.string	"\002\b\002\002\006"
+	.string	"\002\003\005"
+	.string	"\002\013\002\002\005"
+	.string	"\002\003\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ca9c65ee6bdee16a,"e",@progbits
+	.string	"(\265/\375`\323\022\345Y"
+	.ascii	"\212\225\324 R@PJ\032\016\273+\177\025\2069\033\b\206\023\261"
+	.ascii	"U\272{f\256\377rkUe\315E\031\262{1\033\321\213\310\333)~C\204"
+	.ascii	"\223C\361f\2638`V7\375\3318\226\335\347\301\034\206]\317 \273"
+	.ascii	"\250\366\247\032\220\241Z\037W0\002\231f\337ll+e\n\273\001\356"
+	.ascii	"\001\f\002c\353\274\262 \213m\227l\331*\353\\g\224N\037\177\200"
+	.ascii	"\213\353n\037\037\037\237\036\037\037\0212\250\2347z\350\372"
+	.ascii	"7\022H\310\016\226\274\305u\257"
+	.string	"Y6m\233\353|\317\332}\b~ \347ZY\264\335*\244{G\020\003\266\350\276\310\236\335\253\017\001>8a\266\260\331H\321\316zOV\036b\030],\274\250\032f0\030\275\357\3126\327\354_n\272I\250d\260\306\310\374\315\206\212\217*\030\324\263\240\362\t\021\310T.q7X\250\327@\335\0376\3126M\254\330\367\311:9\215q\355\225\177\234\t\353b\364\024\250_\023\351\256\256nM\244\237@\345\345IuvD\372\037\365>\352\277`_4\315+c\320\030\375\367k\275X\355\214\t\211\321\335Z\256m\036\260L\376\200\004\337\025\271:\253{\315\301\241\353\201\316\f\243O@\375\337\365\036UK\360T\375\036\220n\335\036\220\236U\235\345IK(\3717\311f\231\330!\231\226\r\326\275\356\250G2'Y\214~\335\021\251\272<\351\nL\366\210f\200\237m\236\363s\013F\007\340\347\024\376E\267\310\305\266\375\314\377"
+	.string	"~\366\340\337"
+	.ascii	"\210\376o\331\241\213\370\371\202\377X\376\r\372\327\005\025"
+	.ascii	"\bH\341\277\363_\024\376\247\355\007'h\371\331\n\377\232\260"
+	.ascii	"#\230\001\034\022\376\213\375\347\262\300\277#\364~\346\371\027"
+	.ascii	"\204\1771\370\027\305\277\f\374\373\177\025\370\267\304\277$"
+	.ascii	"\376-\340\337\021\377\352\374\333\373\267\346_\232\377p\377\277"
+	.ascii	"\374\357\362\337\350\277\327\177\262\377\300\377&\374\177\373"
+	.ascii	"\357\366\337\313\377\257\377m\377\263\376\223\370o\366\277\246"
+	.ascii	"\256\256\256\356\337\335\374\353\374{T\002\033\346;\346c\270"
+	.ascii	"\325bwq\355\247\255\262\3414\367\354\250\250\0237C\230\231\333"
+	.ascii	"b3\347^\272]\3021\315\030]:\3363[\367\245\333\271\233\343\322"
+	.ascii	"\241\335\306]\004z\273\b\320\224\0011v\245\350\267\212\272B\254"
+	.ascii	"\334\r\2201L%rC\330(\365\b\023\327\345e\252`\2211\332\334\347"
+	.ascii	"\226\365\310|y\311\301\350\2269\334\252]\331!\305\350\362\314"
+	.ascii	"\320\252r\224\2413\306\222\234\215\251\337.\365\374\247mL"
+	.string	"v7\024\315\332I\244\233tivO\3748\273\333\004\376\243\275;[w\215\2531*\221(F\033/\321\307\352.\356\364\332Id\223\252\210d\242E\271\263\266\216\001\272\271\243\221+\225\022]6\367\332\333G*\245\f\310u\231D\256\313\242N\037\227\305\356U\251\203\0043\026\027\331\244R\"\233K\345N\037\273\330M\243\016\365\270T\"\261,\225:\310\246Q\211<R)wh\\Y\231)\r\341\372\261i\310c;5M\031\223:N\344\272l\266\356\005\213\321\311\004\272\247\226I6c\215\025Cr:!=1.wmB\252Z\366\321\211,\262\354.\202\344\242\233\"(\256\316\356\261\316\342\216\251f\212\321]@Swq\333\331\335\305\356\346%\247\326n)\035$\263\251\251;\252\247\251\247\212c1\272\031\254ML\211lV-\201\306\274\232\314NZ\213\313l6\252\244\332,n5Sw\257\030\225\251\304!\f\243M"
+	.ascii	"\017\207\256\270)2\032 UuB|y\255)\232\017,g\214\212\2556b8\302"
+	.ascii	"rps\336\304h,R\354\245\255\306k\305Bc\264\313z\354\356\036~\""
+	.ascii	"\006L\032\243_\245\372\315Z\027\314\213V\330~e\265I\331)G\262"
+	.ascii	"l\326\017\324d\277z\305\235\356\035]\230Z\226m\203X.\253\266"
+	.ascii	"k\333\334-[\366\005b\251\034\327\311nY(\033\254E\304\252\211"
+	.ascii	"\204\3217\240r\321P*\031e\260\"oL`\030\345\257\227\335D\005\361"
+	.ascii	"\344\301\004Ke\236\2130\231k\247v\323E\256~\242\300\314\f\352"
+	.ascii	"\331H8*\253$g\256\363\326\003\022\374\r\270\203\227\027\243\274"
+	.ascii	"\236\265z\210\361B.a-!nO\350tPYI\003|CN\307\\\226\210+-@\214"
+	.ascii	"0\312\373\262\224}\370\0337I1r\203Q\356\341p8O\266\256\246\030"
+	.ascii	"\013\255J\r\211Q6\302G\266y3F\222&\243\326\006\353II\n3\203R"
+	.ascii	"\177\303\336,\345!g\"\177M\215\024\034VT2\2044Y\263\301d\364"
+	.ascii	";\030\352\231\016\b\020\016RA\027X\034/\267\264\223\2239\007"
+	.ascii	"\241\321R$H\0231<x\360\017\265\036\234\346\260xO0>\332\307\371"
+	.ascii	"\307\313R\031C\230;0\312=\322\2367\3120\312W\177C\225\2122\226"
+	.ascii	"\330\213\312TL\305Vj+\245W\222\202\020\331q\266\262\351\262:"
+	.ascii	"\203\204Q\256\372\033\315\025\347\030%Yp\340\340\345vr\256\267"
+	.ascii	"\304\345\351,\307y\271Q\330\232B\310\361\254,\233hP\231\232b"
+	.ascii	"\251\305QCWLR\246Y\243\006K-W\027m\272n$\311=o\312H\301Zc\035"
+	.ascii	"\240\276\334\260\254Y7OO?\226Q^/\250^3\240\330x\200\202\342\031"
+	.ascii	"\033\325;74^\207\025\233\344p\236\301C+"
+	.string	"\372\250\302(\343\260rF\222>\230\371\342\312\"\243\225#\231d\247\036\235\265\253t`\342\210\001\341Z\031=/\251?/-\261S\017W\027{jRIr\317\356)\006\030\211\334r\3336V.\347\324\030mb\246\233e\262\007\300\351\301\005\314\222\321.=;,'VV\206P9\211\223X\251\203\025\264l\214<\260\2011\362\254$\227c\352\306\325NI\345\264f$\t\243\212\341\242\030\206\221v\357\272|JvT\362\304\317\3073\f\224\206\3233\216QFZ\271\335R\230\026,F\331x8\0332t\313'\230D`\321\016xT4\024\372P\370\005k\210\276a\213\026\"\374\202%\374\202i\b\276\341]\240\370\001\213\204\304\341\217\217\350\205\321\020\260\350G8|\361#\200\221\321\013 \360\b\310#\006\2453\034\t]\020\217\200\274\026B>#\264\206\340P\f\276\030R#\243\013D\370\204G\304\022~\301\fxD@\037"
+	.string	"BD!\"\242o\030\200o\b(D\034\002Y\344\020\205B\304!\017\021\320'\f\372\005\203\202v\210\200E\033\374\202\351\207\214\216\2160\b\242I\035@A\024\n\005Q\020\t\035}\360\013\342|\250H\350\003\372~\352#H\321@\n\0254\360\256b\205\003+\034H\257b\005\020\320\212\024@\352S"
+	.string	"\355\210w\301\363\243\240O\370C<:\022\376\330\f\001_l@\364\rm\200-\230\350\033\372\2044\303\240\032\204\304a\321\317G\302/xC\f\002\376\2024\300_pG\fJ\001\244\372l(\032\242\303\241OHD$\304\253!x4\204\022\203T\020\201E/x\007\002\312\240\304\t!p\240\016\241\370\005\177~\301\037`\221P\f?C\302\341\017\n"
+	.ascii	"\204\304\340\356\354\205\335\266\3712~;\177a\270\327\034\327"
+	.ascii	"\265\331\3359=\264 \326\330\030-\261#Rty\322\357\316T\032x?\267"
+	.ascii	"\301@\301\260b\200Y[c6\026.\230I\222\013\342\314\346\205#\304"
+	.ascii	"x\005G\306e\306Vi\313\022$-\215\325: \301\212\323\234\226\263"
+	.ascii	"\332Wzd\207\361\251\211\232\023\205ye\004\355\234\345\274\225"
+	.ascii	"\023\206\206\016\033\2142\026>C\302l\322\345\013\0217)K\030\345"
+	.ascii	"+l\226s\305\f#c\364"
+	.ascii	"q\311\234g\221g\233\025\346j\236S\0223;T\221Z\0339\224\316\232"
+	.ascii	"\177\373\227\335S\307\220\006\002J\317\251U\327c\312\224]7\216"
+	.ascii	"9\346\256\213\214\235xrg\3175F\243D\3411\026\305\240\\\222\334"
+	.ascii	"S\354<\266c;+RIC\264\232g\257&C\311\211\352f"
+	.string	"\352\335\261q\234a\332l-m\245\205\235\241\234\237`\035Y32\312NzQgR\342\232\004\201\213\250\2414f\2304#\"\"\"\"I\222\244\003A\005\204\030&)\265:\0210\241\243\314\220\214$I\222\341\221\267\2767\247\257\024\257\303\364\372\237/\373b\355\264\020\337\005\271\310\203\351\036[\246\226\017,\316!\255\217\025R_4\352\350\365\276)\245iK\205)\325\344\0346\352\213n\334\273DM\t\201\267\b\311\313Tp\203\362U%\004\336\"$\257\325L\305\241\270\300c\305I\\\016\\\003e\271t\311\236-\247\321\201\272[E\035\243#~\274\005\371I\335=\336\377\346\247\004\346\220\013~\275h\327\324]\b\377\3234\241\373X;a\273.o}\271\236\314[\017S\343\2022\036\247g\374A\314\327\b(\260#\304\341J*\365\226\005+\t\263\036\031\335\372@\331\372#\374d\206\003\335\224\332\2228\004\t\026\f5"
+	.string	"\300\331\257H\311\304j\377\350UG\341\364Yq\240\376Y\267I\0166\324\345\030\002 y\300\263\346^N\034\232\326c\213\342\362\370\267$(V\354/\033\242\315\214\271\243h\007\364\2257\341s\367:\373\352\334l!\266\310g\fE\332\021\232\306\310=(L\306vT\337\007\004\235Y\323\007\004\262/'Lp\340YL\020Gl\177*\377o?\"\323nF\026I\351\037\2622j=c\351\031f\314\330\256\2568\246!cPAX,Q\257\360\361J\005\363\"0\004\021\375q\206\214\350\340\370q\373R|\236kNM\356\f\"\204\342\341\307\306\234#\213C\367\"}M\023j>\364N(\324m\fNr\216hF!\022\347\367\\\030Z8\373>\350\214\030\277\260}Ej "
+	.string	"\032v\003M\202=\233ZY\fn\2542\220\265P\340\362p\370\002\021\nI\271~\253\274\322\275\362\233\375\204,\036\226\3200\202\217\223\364M\312\230"
+	.string	"'\005P\002q\310\240\004\250J\202\016\222\363\226\312\326\335\231\013\361\177\353e"
+	.string	"\347\233qh\366\234q+_s\367=CD\342\335\f\346\347\034\027)\0235\214\360\323_\267\313\030\213\350\242c\202\334\351\023\246\240\355\334\237\016I0"
+	.string	"\001\220\2129\305)wI"
+	.ascii	"\331\345\366\3614\203W\006\021\fi\024\245\333\357\254u8\213H"
+	.ascii	"\217\310\300z\304C?]w\024\031H\245x\020\3575$<\200\034\330\b"
+	.ascii	"\246\340\205\366\013\\\220\"\017\241\021\305\233\256 \210\n\225"
+	.ascii	"fe\376=\262\027\333\001\207\321\306\f\244\016\314\323\274\366"
+	.ascii	"&z\364\306\357G\370\222\275#\016\235\357\37462\373\357\334N\331"
+	.ascii	"gH_e\336\345]c8\234\\x;\333\251\345\nor>\"\036\324o\364/\362"
+	.ascii	"\243\326j\343\021\037\353\315&\233x\357\214[\037~\321\377y\377"
+	.ascii	"f\r]\354\303\235\205\327\231\347\342\315\033\0173\007\340K;c"
+	.ascii	"=\344\210\037gC\236\001\373\262\361$\340\262\376D\366\301`d\007"
+	.ascii	"\265\2728\213N\2107o\314\017q\020\271\303\260\n"
+	.text
+	.section	.gnu.lto_.symtab.ca9c65ee6bdee16a,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"pgResetInstance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ca9c65ee6bdee16a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
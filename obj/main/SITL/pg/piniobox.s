@@ -0,0 +1,203 @@
+	.file	"piniobox.c"
+	.section	.gnu.lto_.profile.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\252\353\260\366\b\001\362\247\273\211\001\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.4b6e38970f8f3c75,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioBoxConfig_Registry.14.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\245\353\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\375\006us\324\006uq"
+	.string	"\005\001\006'\001\004\222$?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/pg/piniobox.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 C\375\001"
+	.string	"T\003?"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\020"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\016\001gistry"
+	.string	""
+	.string	"\005\013\002\201\204\001\f\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"W\005en\323\t"
+	.text
+	.section	.gnu.lto_.refs.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4b6e38970f8f3c75,"e",@progbits
+	.string	"(\265/\375`E\007u+"
+	.string	"jOh\021GpZN:\013\232\003r1\241\210P!B\375\022\252\367\"\331g\037\345\226L\t\"fk\330\377\277\373\\o\220\033\272\t\354]\267`\350I\353\275\020\035\013t\017\242gG\346\243=\225D\351\250`UA\"\371m\245L\001\346"
+	.string	"\003\001\007\001Q)\247\361\032\267\245w\312\311BG\321p\321\3256\312\352\354\371\212q\004\256\355\325t\215\235\314\306j\347\365\020~\"\033C\341'BO\367ni\005\233\266H\225\361\335{\203\206>m\254\356\233\265\307\220\236\230\362\223v@d\263\302\274\314\264=?\371\231\t\257\354\204\304\275\316{o\001\037\274*+\221\266l\306g\354\034\342&\177 \341\277\246\263Kv\357\032\364\211#\026\347M\333/H\317h\007z\271\022\336\351y\b\345'\017\241\t\030\b\265,DY\t\361\274\344g2.\023\242VX\353M\273\367\006+\b\351\032k\373\225\201\320\224\205\350\217\205\350\317\300\237\007\374,\3749\300\317\301\237\005\374L"
+	.string	"\301\377\275\237}~\356\341\241\377\301\277\215~\026\372\371\300\317\005\376\327\375\267\377\345\376\367\363\371|\376'\361\363\326\217B\b\001\272n\013\325S\333wU\372\303B4\001\013\321fp\307g\202cn?\326\360<|qYkk\315\264\234\021\260\2522@\273\"jfdr\326\236jp\264\3451\251\024?\211"
+	.string	"h\265\361\320\321\366<\346\3477\266S\361\354c\323\366v\f\204r\030\342Y\f\317\034\\\036\223\266=b\322s\033\263\333\271\316\311n\334\326f\353\325\222\r\306\030\337\265\312j"
+	.string	"\374j\3233k\313\\\270\013{\371wv\250P\325e5I\317t"
+	.ascii	"\274\274\020A\322\266\371VP\336r\236\373wt\310\254\240"
+	.string	"\324\326\364,\307Z\376\235_\237\026*-\332\236\303\322s\226\377;+\312\370\020k\313XR)\016B\264C\346\354NH\3333\226\237\251p\025\216#q/TS\351\300:\323\226\341\370\3129\216\255\\\216\213\320\343^'\216\013\302\271\327)\310\254\200Y\201\035\3432\002\005\265\347\256\364y\f\204\002\337\210\347)m$MN\256\255\017\007mm\254A\315\226\006M\0273\351\271l\r\263)\243\206\217\367\310\310tS?%\341\302e?\221\333\360\036\260)\300\275]c\300bt\215\246\3212\332\252g\260\263\257\032\352\214\206\365\240\330M_1\234\276L\347u\201\314\216\323\\uTW1\035\326\317\205j;\223w\357\035\016\207\303\240\341\020\200\213-:-\240\3455\277\023z\232\342\260\344.\357\336\225\252a\260\263\253\036\264\336\233V\325R\375\202\351\260\326+c\004\236\215<\276{\327\241\201\241\217\336\027;\035\250\375\373E\273"
+	.ascii	"\262\255@\322\264\355\026:X7\344\242\330\322\277Y\260\263\247"
+	.ascii	"\216\327s\257P\272&\354m\315\357x\256|q\251\245o\264\364\235"
+	.ascii	"\244\235R0yZs`\351{H\312}\034\207\235D\374<\277a7\317qZ\357\332"
+	.ascii	"B\372\324\320\270\3223\021\372{>\231\b}\357H\233\205\350\017"
+	.ascii	"\003\241o\033\351\373*\375\231\315^\2163\213\232\271=v\362\233"
+	.ascii	"\242\352\261\006LKe\006\241\222Qm2\201(\002\251?Qt\024\"%\227"
+	.ascii	"4\250\306&O\322D\3474\213=j1y\\\346$\217\313\237Z\234@T\223\310"
+	.ascii	"\245\324\250\002\331\264\315\246\221\231\224t\244\303\264T\""
+	.ascii	"Y\246\272\374\335\207\211\2516\221G\343\207\002GJ2&\217H\024"
+	.ascii	"G:I\306\346\222M*\221*\222\261\251\363#\365(\211Y<.\213\200\314"
+	.ascii	"\243\023H\266"
+	.string	"hT\217P,\225\214!Tc\323\370\341\270D\240\376\204\201+\227F\246\221\252T2\215x\222:\250Ic\362H\211i\\\3624\213G\244\211\2442C\n%\206\037\253\026)\250I\344\222\316\211\304\f\tDx\330\220\"\025\245P\226P\"\223\310\245\321qi\224D\036)\031!1\233FEA<:\007\332\247%+\252wp\033\217\024)Q`\235\225\305\207\212}5)k\373_\f\034\177\343\350\034\374s\241\270\274\334\256\025V\203\337\226\224^X\333(;b\322\316`\264I\317b\314`\316y\354d0}#\310lm\002\302A\371\315@\233k\021y\250Q(\307\fT\310\210\214\210\004\"2\023\265\001p\002\t\346\224\321\003\021p)T\206j4M*\313\001\3314\347\242%{\220\243\034\211O&i,\301h%\0020\310\f\\_j\277\247a\022)j\206\323\342f\205\030\261\031\233\234;V)x\322j\250\007\312"
+	.string	"\214\2432,\255\324\320t\260\343sx\3224Wi\371`\243\245\254\304\362\035u\003\227\302\207\205>\265\333\304\002q\335\f\246\240\347\256\230\335H\312\267k\t\225\200\340\355\242\020\220\344U\211\375\275-\036-Pl\202N\362\363x0\257\313\225%n\373\304\300\226\272\021\201\371\304\\\371\024\222,\314N\345\271\021\250v\273\353\344\007\r\0020#\262\2366\306\024\373\231\3513%\356d\221L\247\351S\346\222\274v\021I\020\3759\003\274vh\233\230\342C\036\206\235\037\2272,\250\341 \203\367\037\270s\377\005\214?\016i\357\274v\240\214\241\222\204\362&"
+	.ascii	"\\ej~\261\315\241z\334\340\310\212\275\035\376"
+	.text
+	.section	.gnu.lto_.symtab.4b6e38970f8f3c75,"e",@progbits
+	.string	"pgResetTemplate_pinioBoxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"pinioBoxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"pinioBoxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4b6e38970f8f3c75,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,277 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 7}\001"
+	.string	"d\002+"
+	.string	"\004"
+	.string	"\353\372\350\305\017\b\002"
+	.string	"\002\001\002\002"
+	.string	"\002\001\001\343\275\377\262\004\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\273\2546\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 2M\001"
+	.string	"\370&"
+	.string	"\001"
+	.string	""
+	.string	"\007\200\200\200\200\003e\001"
+	.string	""
+	.string	"\002\004\002d"
+	.string	""
+	.string	"\ne\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",\242\271\204\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 Q\005\002"
+	.string	"\004\003E"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\003"
+	.string	"\003"
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	"\001"
+	.string	"\340"
+	.string	"\b\b\002\004"
+	.string	"   \002\005\300"
+	.string	"   \310"
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"F-i\351\262\250m`\025\030`\001"
+	.text
+	.section	.gnu.lto_.lto.f7ac1a2214004c38,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcdeviceConfig_Registry.14.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 \223-\004"
+	.string	"t\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\202\200\200\374\342\203\235\355\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\367\006us\316\006uq"
+	.string	"\005\001\006'\001\020\233\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/pg/rcdevice.c"
+	.string	"\004"
+	.ascii	")\302\303,\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rcdeviceConfig.15.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\225\t"
+	.string	"V\321@;0\305*\035\200\343\025o\344\007\250\224\030O\352\222\330H\234Y\007\0022\324\225\331\374\020\302h\260\021\243l`\2044\r4%\3144a\034w\270\211\303\004\245\335,\331Fv\373\357\235R-"
+	.string	"."
+	.string	"2"
+	.string	"\035\372\2319\207~\372\263Y\b2\002b\0323\333\356V\t\362\357\361\363OrM\313\265z\304,\354\256c\313\305q\313\3336\260\375\261\237\020\322\303\376ew\327\022\264/\373#F\363\301i\331\335\270\005X\332T\021\331\330~\264\037\373\310w\231\352\003\273\340J\312n\210\340\203\314\247\303\007\266\233\250\335\375\304\244"
+	.string	"\3020\265\243\250}\372\f\365\360\262\321\247\250]q\223Tfw?~\211\305E\247\026\362\351\253\350\247\303\013\006\200\025ov\270\212\001!\221\004\251c\0200\347\001q\"\nP\004\347\325P\251\222D\020\243\312y\247\352)pW\002yu\242\353\274\272\t\367\227\225\240g\007\215%1\354\321QR\r`\021"
+	.ascii	"\177\241'\023z\363\002\343q\346\270\210\023i\344a8 GR\227G*\007"
+	.ascii	"\247\327p\214e\004\363.\0014\253)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\017\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\016\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\013\b\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\f\t\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f7ac1a2214004c38,"e",@progbits
+	.string	"(\265/\375`\332\te9"
+	.ascii	"*j\020\027CP\344U\007\303\333\212k\007\312\317\250*\250S\020"
+	.ascii	"\370\201\270\r\025\233\035\213\354\007\231.b\252\376\377y\255"
+	.ascii	"\2434\377=R\265\211v\2375h\212>\232\212Z\020\202q\n\305a\340"
+	.ascii	"EVCl\206\354\366\2662\245B\001Z\001`\001\230\355v5g\303\n\tk"
+	.ascii	"\216\301l\032SK\326\246\017\024\314\266\177\345\3667\314\307"
+	.ascii	"L\325x\032_\343h\274\352hn\326~\346f\232}\377\307\376\277\035"
+	.ascii	"\354\214\227\271\025\312\341+\314\247\216\346^\\\214[\303BL\273"
+	.ascii	"\304\375\277}\241\333\327m!\203\2439\031/;\260\374G\242u\304"
+	.ascii	"\326\346#\355\317\377\373\304"
+	.string	"\364\364\364\304;2M\213#b\333\231\331\337\227\332\0362\373\230\227\361*\002'k\013\031z\227\374\362S\243:-u\2020\3332r;\202\326\257\216\240\355\026bSK\304\240\301l\243\310\235!\373\027\007\343U'\017\323\336\305\337\036b\276O\375\177\221\206\346\310i\205a\266%\344vj\007`\373\fM\224\333\235Z$wj\033\347\005\276\324\262V_j\273\235K\267o\361)\202]\263J\372a\377o\022\322[\304\252\013\263\375\372R\233]\251\355\3564\335\215\006\355Lw\223\265\271X\267\017\350\366\003\335n\240\333\233\272\235@\267\027\350\366\004u\335\256\324\355\002\374Aw#u\343\016\335\356\240\333\031t\273\202\356n\353\3560\335-\326\335il\272{\332\335D\335\255\326\335\273\353\365z\355n'\335\376\247;?\005n|\255\375M\277\3616\207z\237\253*k\036\nu:Z\213R\205+N{[\303\025\375O\377\377"
+	.ascii	"\321\032\325\f\rf\233\217\263u\367P\313\205K\026\02468-X\037"
+	.ascii	"\261eZ.\342V\246\304l\325\255n\306\003\273R\327\025\227\033w"
+	.ascii	"\267\257t\376\377\025\357}\347"
+	.string	"\262\250\235\347\356\324m\344;o\320\335\354\177'\230\376k\r\232\313V\312\224Y\230\355\356\005\337Y\376\223I\377\276\263I\335J6\253l\317\244\367\225\020xj\3277\337\255'+}\374\357\3733\267\2365\232\257\324\331|\245\311\3363\245\311\377\367\331k\206)\223\336\244n=\233T\3513\351\231\237|\252RIfJ\237\3156\322g\257IU>\233\314\255gRtP\223,=\350\260iq*M\346\003\261\212*\235=k\363\225\276\333\277\207Q\275\263\301\177T\352tS\032q\263\245\025\310rL)\365\367\377\233\254\226\\\322gZ\233W\244\377W\2261\336\nC\362\265\376\023\267&\273\242_E\365_\340\337\177\253\377\244\277\365\377\223\377/\344\214\276\377GzM/+\253\177(\223\325G\223gT\3778\314\216\331\263I\345\222\372\316\302P\275\236\307\233t\257w\333rfj\322\313W\375\277\313e\257\247\220=m\234\214"
+	.string	"\315Yf\tX\270\252=\220\013bb%\306\302L\334t\253\023\017S7\037\204\205\2550\021\267B{\317$\313\023\367\377OOOD>\266\254ZG\254\323\365\333\201e\223\004\330\033\036\202\213x\025\023i\246\367\211` X\210[\241\357_\271\200\313\2326=\031\355is\313j\331n,\004_\035\215\275M\3440\213\237BP#j;\266r7\016\342U\354\314|\262\234\t\3527"
+	.ascii	"hP"
+	.string	"\270\222\344\336a\345\336U\371\310r\342\264\3260\333;\252\334;e\306;0\225W!`\036\215\227X\331<\345\373/\216B'\006\006Pn\207\320\356\256W\207\3206\236\313\330\225\332\236/\265\215\361\344\306tr\267_\353xT6skue8\216\233\252e\234\274\300\225Z\354\304\307\375\f!}\2311!\243\226\333\373\234\200\362\206\ffY\3574\255\313\265\317u\017a\265)^Vjr\273\036\337\323=t\344&E\314\013f\033\223\345\3668\036\231\353\034\026f=O\246\302/\004\"-\262$\236\247\333\353\270\035\207{\361\317\374\177\002:\256t~0\353x\374\255\035\316\357\300a\220\376+\035\016i\320\277\022\311\235\201;\003\366\213k\312\230\226m\274%\267\233/\265F\256\324:\035_\273\233R\353\204\276\217\004`MM\\\027\314\026a\256\334\0369\214E\020J4\202.2\207\212\337\222\3331(\b\215J@\242\r"
+	.ascii	"D\030\370\310C\376\212\334\037Qh\344\021\205\306\235\373\213"
+	.ascii	"\362\005u\f\221,\022\031<NMI\t\3450\026\201\354\3215\356\246"
+	.ascii	"\202D\341p\206\224\320T\020i\203%\026\207.0\210\024\352\343O"
+	.ascii	"h\244`t\224\212\001ds\034]\344P\030LA\240\201?\242\b7\210\f\246"
+	.ascii	"\020\032\231\0328<\006\211Aan\fQ\023\2424\340\020j\r\033*l\250"
+	.ascii	"\320\266\206\r>\337\206(_\356(\337\316\355\030M]4\006\217Pn\261"
+	.ascii	"x\204\002@,\016\221\307 \213\031E`\321-\036\215H\310\237p\b\203"
+	.ascii	"X\004\321s\177\032\204\220\001\334\037\322D\220\306\320\3153"
+	.ascii	"\244n\034\203.\261\204k\244\021t\335\017!\334!q\330\344\376,"
+	.ascii	"\\p\211C\033\271}>\020\013V\234\030\221\201\024\202\300\341\215"
+	.ascii	"\340\024\360\b%4B\021\207R4\240\200G$\024\005\246\340\321\206"
+	.ascii	"+\025\204!\264\304\333vQ\265\2700\314\305\205\207'\346\013\231"
+	.ascii	"\0379J\332\253X\211\263q\352=3N\324\354\235\320\bF\201\274\362"
+	.ascii	"\274\225\345v-\356s\332\001"
+	.string	"y\325\347\340$L^\336\344\021\330\327U\225?\357\214F(\322\022mB\207Y$/\023\217\311\351\201\363%\267O\261\234\316\257w\316\336\353\246vz\340\037X\336$\275\356(\231\364\337U\307\313\b\326\302Q|\004Cq\226Wq\200\236\250\201,g\0204\206\310\214\210\214\310h\233\016\200\002\221)\253n\021\240\255r\206*H\223T\226\003i_\354PfI\212\332\314\332\272\352\235/\301G\201\b\365\377\327y\234\017\026U\210\001\223*HM3Q\344\301\021P\234\f\211\246`\325\210`\310\376\037\360C\224\033\222\262\222\217\226}\232R;2\366\266\375\032\r\tO\342\303\377\352\032\272\334,,NO\203d\321\017\201\340\273\346~1\367;H\211\241\032\340\326\257$\234\337-\312\215\347\340\226\355\342\355\361\243x{4~A\276V\271]\033(\253@-G\314#eu\177`kj\334\367GI\346\023\267\303\273\236Z\271L"
+	.ascii	"~?B\200I!k\266\371J\200\022\322\305\030\320m\342}6\205\260\353"
+	.ascii	"\225)\202e\003^#o\262|\204\374m\250v\317\311\272\371\203x\270"
+	.ascii	"\204\036\013\024s1H\022H\254\347\366\371\300\352\212\264\277"
+	.ascii	"N\232Y\377.. \314\307\034\223\206<\201%\210KP\026\267\037A\226"
+	.ascii	"4$\203Q\2402\036\022\001\254K5\0339N\277\253\271\365<\375\317"
+	.ascii	"\201qf\366\016f\274\226\212\002\n\027|\254\230\007n\037\323\361"
+	.ascii	"\377\335\t\210\325T\244=\243\215\2054\037\375\013\0029\316\233"
+	.ascii	"G\263\365\247\330\013\315\200O\363\006\177\024\207\013\006\030"
+	.ascii	"\354\177I\231\306\244\001"
+	.text
+	.section	.gnu.lto_.symtab.f7ac1a2214004c38,"e",@progbits
+	.string	"pgResetFn_rcdeviceConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"rcdeviceConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"rcdeviceConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f7ac1a2214004c38,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,315 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 n\265\001"
+	.string	"d\002b"
+	.string	"\004"
+	.string	"\304\366\355\225\t$\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\001\001\347\334\334\027\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"@\t\310\016t\006\214\260\313j\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\001"
+	.string	"\001\001\002\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	")\202_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 =\305\001"
+	.string	"\364\0021"
+	.string	"\001"
+	.string	""
+	.string	"\032\200\200\200\220\002h\001"
+	.string	""
+	.string	"\002\027\200\200\200\360\002f"
+	.string	""
+	.string	"\320\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\002"
+	.string	"YB\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 K\035\002"
+	.string	"\244\0035"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\004\003'\001\206\by"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	"\001\002\006w\001\001\006w\001\177\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\tAETR1234"
+	.string	"\002"
+	.string	"\340i\312"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 v}\002"
+	.string	"\022\304\r\031\260%\351\3144@d\001\232@\213F\3230\024\001\035P\006\267\033\301M\246\024\246\\\356Q>\356$fh\004\301N\3015\350\301\001\227\310r\013]\255\226l\220l\027\020\b"
+	.ascii	"\244`Ze.\316\213c\016\257r\241\246\225`\264\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.56e34013216ce2bf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.28.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 \216\005\004"
+	.string	"$\007a"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\352\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\375\005us\327\005uq"
+	.string	"\005\001\006'\001.\230\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/pg/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.29.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375`t\002\345\r"
+	.string	"\266\327YD\340T&\035$\224@\252\334\325\244\021\364\243*\332WSf5~\303\260\3369\202\254\004e~\350kk\b\275\2303\013;\247+\"`\016.Zd,\260\003\373\323"
+	.string	"Q\247\222<\270\204}MmDC\376\336)\005@"
+	.string	"D"
+	.string	"L"
+	.string	"\257\225\267\265\236\331\245\241\344v\317\006V\020\376\363y\002\340\277\360\032\360\237K\373H\001X"
+	.string	"\0342\334\312\356\2125\306\313\323\322\377\355\027s\346:-\221\260\273\246\346\214\305]o{\201m\220]3\001G"
+	.string	"\332(~ce\b\3776;\025V\370\212\340\327H\301\242;\031~\013\374GOt.j\274\027\355\331\247\213V\030\366-\273\273\2564\373\266\237r\352\013\231\311\246\267\273\242\227du_\216\031\030\333\247\366i\0047\375\311\255\360`\325\345\004\035\316\003\340\341F>\234\b\210\017\301\335\016q!\240\210\247\254\006\330\b=\b\210Dt )\003\243\373\320\220\336c\307\355\322yP\022\327\261\022P\304\364\\\330b<\n\346\307;\240]\342')\247\234\270\311\003\006}\0368\320\300\241\302\204\013\2514\3424RP\221\241E\036\025)\222P\342\251\0242\211\"2%z4\036Q#R41\216\244\2109\367\226\2554[\270\351^U\205\017PZ\177^\345\002g\267\033\273\211!\2141\350\374\2633l\240\001& \020\203\221\261P\007\302B\353\311\300\300\200\257\001n\020\206\202\3561\334\303b\005WI *.\f"
+	.string	"\314&\220z\023\206"
+	.string	"7\302`^,\340\262\nd\305\204\001`\302"
+	.ascii	"\350\313\212/\f2`b\262\0363\317\3032\213y;\200\346\230\022px"
+	.ascii	"\321V2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 k%\003"
+	.string	"T\005g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\035\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\034\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\031\t\201\204\001\032\n\001\036\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\200\200\200\200\004\001\344\n"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313`\f\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.56e34013216ce2bf,"e",@progbits
+	.string	"(\265/\375`\270\021eW"
+	.string	"\312\227@!T@\2222J\007j\241;\036\274\365\021y\035\351 ,\232\242\3412b\314+$\275\307\377T\332\216\200\216\263\274\356\253S\325\221\b'u<Z\224\275L\376[0\263~4\366\315='\306\252\326\316V{\243\301\2243\311\306\210\271|\227\344\360&\257\330%#V\312\024\275\001\007\002\n\002#d\3354\2709\326\354\254\325*\241\"\230\272r\200\205l\327\232Y\345\221\t\250\202\b\353F~\251\376\225\3627"
+	.ascii	"\203\205l\326Z\311\270\321M5uGv\303\030\033\037c\335H\027.\210"
+	.ascii	"\\\370P\221\362QU\201\371\036\026*\207\255\211\363E"
+	.string	"\236\372\315\263V%\364\211Y\223\245\2168l\356\020\265/\236\177wX\252\022'\021\n\331W\003d\361\302\205\315\2319Vo\376Pov\2517\261\352\315#u\216\331\243\253\210\024\2337\213\365&\216z\331\234z01\3652\255\3721\331\224zY\016\365\262%\3652#\3652 \3652\247z\236S\317]\365\214\245\236\231\324s\221*\024\346\265e6\311b\225_2;\346=L\310F\262\rx\260\252\260y\216\252_\026\247l\271\\\026\347\231X\231\273\n\355\232J\324e\275l\222h\2774m\3174\351\210b\363\373UU\350\345\022\235_0u\205\225\332\302\206\312\300\346\2502\200\365#\324_IP\277\265&\316\235\262T6\251b\255\274\001\030\227\005\2514U7\222\026\224G\207<w\330<\004\365[\345'\2504\214\013P\277*\316]\256\212\363\\\037fM\234+\224k\342<rM\234uK\244J\377\316\376%\361/"
+	.ascii	"\377"
+	.string	"\252\370w\200\177\r\370W\366\357\371o\001\377\022\360o\375\027\305\277>\377\236\370\027H\350\337\240\377V\004\370\031\205\177I\3707\367/\356\337\333\277\266\177M\370\327h7\370W\204\177GX\340\177\332\317[\376\375\375{\302\277\273\177u\377\312\370\257\374\367\200\177\213\376}\361/\213\177\023\370\027\201\377@\377\271\376\313\226\313\345\362\277\234_6\366\007Q\005\303d\367P\013\205A\013\212=4L\366S\257p\346i\033i\f\266\260\330C-l\246\025C\241\361i\230dz\032\032&\215O\2354\266P\013\231\210,\b\2338\324I#\234N\026\237\204\206\311\342\3230i\374\261K\206o\210O]TC\246\226\311P\330:\234\242\230\210B\312!\262\330`\335{u\243\211\006tG\025\211`L>v\253I\251\243I\213\251\270\310\356F\341\3244\244\330B\345\320I\261\333I\323Q;=\020D*\033\311*\203D\242:\307\215\356"
+	.ascii	"\234\272\203\333\312\356\016v\367\214\030\205\354\236Ahxtr\352"
+	.ascii	"\206\"r\352\250 \227\033\335|\265f\353i\230\034R\254q\261J\036"
+	.ascii	"\033\0072\270\307\0063\022k28\245st\367\212\325\343\023\2178"
+	.ascii	"G^\3223eH\007\013\233\347%?'Y,\226*\241[\b\224$\006\036e\330"
+	.ascii	"d%|\303Y\212m`\251\007\212\335L,E\033\242\233\211\266[\300n\001"
+	.ascii	"\346\324\220%XN\363=Z\252\317\2268w\207\332\031\t\355k\313\034"
+	.ascii	"\251#,\252\320\207,\252\032T\320\220=\234\210\260\371\263\221"
+	.ascii	"\"\262a\216\"r\250\022\301\003\344\213M&BD\353\301\246\210\030"
+	.ascii	"\233\357\251R\277c\270\332\244Q\363\363\220y\260\017\246\201"
+	.ascii	"\233X\006\006\302A\370\007\337\340!,d\034l\344\036\\d\026x\006"
+	.ascii	"n\201\241\330\211a\340'\216b\035\234\203]\340\035\034\003\277"
+	.ascii	"\300+0q\223,d\227\347\346\340\031\331-\274\002D\231-.cG)X\206"
+	.ascii	"8J\331\"\304\233\260\265\332\022\326\203\017\013&\312\2330*5"
+	.ascii	"]G\255,vz`\303\025v\345\n\317\327\017`{\345\257\215a\201\321"
+	.ascii	"FL\025r\255\362l\325_\253\263t\262\334\2049\326X\310\336\331"
+	.ascii	"<D\252\216\335\375\305\022\002\353\f\234\265\3222&\2101q\376"
+	.ascii	"\232X\226\332\312Y:ZZ\326\220\301\002\363:\362\300L\3133\377"
+	.ascii	"~\241a\023F\314Z\005F\224 i>\\\356\344\020\203\2337\005\341\004"
+	.ascii	"\205\3358\021\321\344e'\312\013\0336\\$\003\241\356!R=:\306\256"
+	.ascii	"\204W\324|\223\254\206\213\230C\335Lv\266\232\b\245\300\317\020"
+	.ascii	"OJ\216@\251_\035\226\247\316W\233\344)"
+	.string	"\006B6\204\352\035\016 \331\"F)`\326i\322\003\t\233? \205\254%\006\307L\222\372\245\312\342,l\276\264\260\026\325\2320.\354\303\2232a[XkDp\250\233H\031N\303h\370\f+\371k\223l\206\273\234\261\030\313\211jfx\013\314\f{\341\256UB\t\265P\013\221\013\027\"Z0*\201\2140\263\336&E\3230\003)m\302\310\260\327&\271\353D\310.\376\302\\\253\204B\366\216\237,J;dP\270\b\212\203\006\354\307\3115f\204\026\262\00616Y\314\f\312\007\327\n-\200\331$\207\251s\242p\271\3636?`\222\f\231\341\250\237\005\353O9\225{\250i\302\200x\271\251?\327\324\237i\352\317\256\3723L\3759\213Vr\214\034/-\376\352\312\321\324\245r\213$[\361\225\337\2076\265e$K\253\236\255t\220\244L\026\233\346\336\313\311T\316U~\037\346Zrt\272R\317H\236\362\373\214"
+	.string	"\223\302\232\302\346\317\252z\256\352\311Z\312\221\201M\226Ro\234LX\210"
+	.ascii	"\242%\310\0176\317R~\346a\343\244\260\304S\207\315\240-q2\325"
+	.ascii	"\217\327\227\260*6\201\316 \365\314\204q87y\023\216R\221\375"
+	.ascii	"\302b)\343<\031k(\250\026\225\207\020`XP\316Q\356\006\250;\205"
+	.ascii	"\317\223\247\343\220\315\317\341'\377}f<\\\2312>\311A\006\205"
+	.ascii	"f\013\007&b\036\275@\351b3\311Nv\tT\004\223\0036V\371?\233\211"
+	.ascii	"\330\335;z\220Ml\002\372\366\354\266\370\203V\266\006\3747\273"
+	.ascii	"{\310\016zQ\311\251M\2660\375\370\212~\217\262[h\fN`|\022\032"
+	.ascii	"}\f\223\306\016\n\245\202C\3046\006"
+	.string	"\003?z\261\224\026-\2458\017\320_z\363\321l\370z4\202\222P\340\317\306\0076\032\360G/t>\034O\351\207g\304=?\033\020\320\306\323\371zx:\237\fMa\3673\177?4\315\345n3\033\276\036\316L\201>Y\016\345\351vH\267Y\016\375)\2318\3647{j\323\371^\004\331H\201\277\235\016\365`\3508\033\357\002\017t>\022\307\355R\224\207\352\352\037\210\261@\f\031K\263\313\230\301\300\f\006\316\313\230Q\253\315\210Q\253\217Q\223\245\267#\234\t\374Q\211\367|hZ\004\354\365\322\242\237\\o\227\242>\233\221\017\t\305\317\246\333\031\361z4\226R\021\276[\022.\355I\321\334\256F/\365\345\320\245\024\351\266K\321\337\320\022\212\344S\262\300\b\351v$\002\315\355\322\024\255\321\263\361v+\200\266\231\356\006Bog\323)!\371\210\206\200\350\017Ms\274\235\t6\340\355gKRJ\201'\240\276\237"
+	.ascii	"@(\322\r'\002\230\2425x;\\\232\333%\365\360vI\365\004\034z\204"
+	.ascii	"[\272%U\332\217\006\322\255\006\257\267\003\336\220z\276\024"
+	.ascii	"\005\3624\300\245'~(\232\352P\013P$\035\217\202\244\033\215\032"
+	.ascii	">#\0229\244\336\321\017M\217@@\2018\n\320\\\217\203tw#\342\355"
+	.ascii	"\200\266\030\265\212C\177J\266\245\364\007\t\345\361nG8\333\222"
+	.ascii	"\322\315\266tK\242\375\322^\232\24264\351\226\032\331p\351\317"
+	.ascii	"\304\tD\177FF=\333\356\367K\177\206P\030\031\365\200J\270\001"
+	.ascii	"~\273\245\233M"
+	.string	"\247d\002\232\003*\371x\273\023\250\317\006\320\206\326\330\001o5v)\232K\001\264\311"
+	.string	"\362vJ\263\327j4V\204\320\001\006\025\367b)-\322\371\212x\273[R\021.\375\025\275 \221\366\200\270\233\221\255\007T\272\331t\274\335\021\260\327K\372\331p)\021\03515U\313:<'\n\r\302(`l\276M\033\026[*\375\002\021W/g\030\353\206j\021\364E\007\034L\342\234\305R\360X\261*\t\233\374\206\341\314\234\202(\331\001'\214\266\003\f\001\201M\250\201D\246\2203#\"#\"\222$I:a\005\3040\007%#\017\022\300T5\027A\307\2064M\262\317\376\031\022\017`\013\2229\321\217{0\031c;Z\265R\207J\211\"\005\370\277\277\333l\3400\347\365a\b\002+w\340\376\b/\335K\350L\212Jy\341\035\323\201\030"
+	.string	"K\224j\3526\373\224g\343\241\343\233k\346\036\254\004\255 \2077#e\214\265\360\017\2436P\n\354\277\325\242\215\320\320o\370`A\314\365\342\247\\\242\207q%\022\241\3305\341\356\320\006\230-9\020\370Y\207[\263\344\232\021\223\261#\321\021\307\0071\371&\204\001aA\230\"\323%V\246\f\3146\340\344G\206\340\355\2153\240\250\346\253j\262\256\367C\036\266\235\2711(\373y\234\344\353\361\310\201\\$}\342\362\003\273\377Y\236\244\241\006K\264\205&\362\211U-\245*\314\203\360q\353\344\230\346\324\221"
+	.ascii	"O&a\321\236:\224:p\225\246\226\254|yp\211\367e\266\234\325\345"
+	.ascii	"\026\245\001:\247I\377\270\225C,i\221GE!\257\234s\314\215\202"
+	.ascii	"\273\216g\256\312\372\006\356\203^^Q\304\035\274\242\013\025"
+	.ascii	"\200S\303\337e\354\025\327\366Sa\006\001o"
+	.string	"\366\3601\342s)\223\331y\263\200\372\216t\310\023=\313\264\322\342]\354 \235VF\005\363\b\314\330\363\027B\236`\225m\272@*\224<\320u\204\f\2050q\351\037\324\235\225\npC3\3045w:\202\r\250-,F\311\024+7\334\177\316\253\226\246\264\351r\320))\337\244\352\272\003tL'\201\355\207cy%%F\322\203\004=;\256\356C\275G^\033N\006z\370B\356<X+\241\325q\374\215\371f3*\b\221s\247zF\252!!\007BBJ:\0167X\025\335\226\377`\251\263e|\345\205^\244\331\250\2126B\272\371j\363\2067PI\224\005m\373\374\246\245^\206\315>\247\206\202L+*ti\021\241.\201\036`\267\205\213\024\322\300\201\323\246\034}\366\200\343xHM\234\"\367HT7\r\254\263\033`.\234\312`\262\177\242%\21428\237\025V1\212\345\337\270\024\366\345\305i\240\237\003@"
+	.ascii	"\362\221\210*\2566z\r`\003\335>@\317\256\274\2403\006\271\305"
+	.ascii	"\005\205\364\020\366w(7\365^R\361\273XA\202'\034\235\020\025"
+	.ascii	"\005\256\353,\027\362\332\320AN\316\024\323\273\234\323w\365"
+	.ascii	"\353T\377\320\371\306\035\202\214!\247x\241\255\347VZ\343\270"
+	.ascii	"T\001"
+	.text
+	.section	.gnu.lto_.symtab.56e34013216ce2bf,"e",@progbits
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.56e34013216ce2bf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,295 @@
+	.file	"sdcard.c"
+	.section	.gnu.lto_.profile.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 ;\215\001"
+	.string	"\204\002/"
+	.string	"\004"
+	.string	"\262\313\333\366\n\n\002"
+	.string	"\002\001\002\002\001\002\003\002\001\001\201\306\237\350\001\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\273\2226\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 2m\001"
+	.string	"D\002&"
+	.string	"\001"
+	.string	""
+	.string	"\b\200\200\200\300\003e\001"
+	.string	""
+	.string	"\002\005\002d"
+	.string	""
+	.string	"\013\200\200\200\240\002e\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	".\241n\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 K\305\001"
+	.string	"t\002?"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\004"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\b\030"
+	.string	"\001"
+	.string	" \b\b\002\005"
+	.string	"\300"
+	.string	"  \003\030"
+	.string	""
+	.string	"\006"
+	.ascii	"73\200\274;\255 \312\032\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.e1e2c400acfb9579,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sdcardConfig_Registry.11.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 \221\035\004"
+	.string	"T\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\345\006us\375\005uq"
+	.string	"\005\001\006'\001\f\377#?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/pg/sdcard.c"
+	.string	"\004"
+	.ascii	")\302\303,\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_sdcardConfig.12.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"\335\t"
+	.string	"f\022D= \345*\035\300\313D\202\004\223\001Q"
+	.string	"@<\343X\234\301\"\217h\363f\255\243\302\356s\371\033fy\256#z0T-\036{\022@J\246\0327_\205\200\b l\245]A\374\310\337;\2450"
+	.string	"1"
+	.string	"4"
+	.string	"\235\307w\350;\357\007\364\235E\033@\202\006A\213\253&`w\353\004\271x)\3727\371\300\013\306\272\024x\330]\313\027\214\343\236\267\255`\333c?\"9{d\311\371a\177\263\273\353\031\263O\373\2457=\\\266\216mw#\207[\231\356E\306\261}i\177\366\022\361\264\325\rvc1.\273c\203\027\274\007 \265K_\001\345\f\356)\267)\256\342\221\245\250\215z-\005!Br\025\265-\216\242\362v\327\301?\271\300(\250\331\335\207\274\363W\364\335\204\241\351\230\005h\311\242\321\204\t\374\250\277O(\004}!T\025\235\252i\004*\325/D\325\017\202\301\223DX+@0\254\234q\277\331\031\363f\3446\340\326\232\031\236'Q{t\026\022\303,\020"
+	.ascii	"2\241\205/0\\\300@\302@p'\322\310C\306\001\305\340\345H\245q"
+	.ascii	"\250F1\030r\t\266YM\twx\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\f\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\013\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\b\b\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\t\t\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e1e2c400acfb9579,"e",@progbits
+	.string	"(\265/\375`\350\n\315="
+	.ascii	"\332q\250\030CP\246Q:\253\004\275\255>v\003@\001\337\254\001"
+	.ascii	"A\325A\325\263\206\251\246\370\347\304\340\302\326\335\244\307"
+	.ascii	"\024\243\0017M\274-\026\300\201C\200\330\322\003\001D\364t5\315"
+	.ascii	"\336\347\205\004f\374\347$\004\344o\231\002M\001w\001\200\001"
+	.ascii	"m\367\226\332\032V\323%\r\234\0066\f\207\241L\017[\320\300u\367"
+	.ascii	"\031\315\f\227a\322u\213\315)\353n\217\341\357\375\0274\260\033"
+	.ascii	"\307\3412\007\264\272\305\214\b8\233\343\301FQw\313\233\232\232"
+	.ascii	"\232J\212s\244gM@\312lK\205\006!\322\"[\331\016\337\341'\257"
+	.ascii	"\375\f\206\303<=k\266\263\273\335\351\220A\326\324\244\324&\226"
+	.ascii	"R\317b\353\241\034\245.q\217\365\234\\\271\r\273\341'\217\337"
+	.ascii	"t\023\267i}\205\335\364|\\ot\224y\352m\254\207\261:\245\245A"
+	.ascii	"\326\224L\271\351\201\353Y\254<\216R\017b\275\206U\212\243T>"
+	.ascii	"\3431\374D\300d~A\303u\307\2636\353n\233vs\\\346\032\335\364"
+	.ascii	"\024\326\263\363P\310\326\360\335zF\240r\224\021\250\277\253"
+	.ascii	"\005\216R\025p\224\232\362\227\237\275\260\031\002]\262\253\331"
+	.ascii	"h\335\355SS\033\304+\311M\337r\224\2722\224\372\237O\236\377"
+	.ascii	"o\376\343\371\357\366\237\314\377\266\377iK?\003\372\371\301"
+	.ascii	"\317\023~\226\360s\204\237!\374<\365s\005n\372\271\301\317\016"
+	.ascii	"8\303\377\246\377V\375\214\341\347\336\317T\377\345\376\263\375"
+	.ascii	"\367\363?\320\177@\377\377\3747\373\017\340\277\235\377\272h"
+	.ascii	"4\032\375_\366_\365Wb\020\206\224\270\200pQ\363s\347\334\350"
+	.ascii	" o\372\344B,g)N.,\355\246\277\311\365\367W\033\251\354n0\244"
+	.ascii	"\266\225ZKg$f\251\177\307:f\360?\355N\340\250\373\210\331\241"
+	.ascii	"\325\212\032\262\310M\377+\350\377\347-\335\307\247n[\231t\216"
+	.ascii	"\035\223\317\266\345S\333H\b\2643I'\333\261e\332\354\333mso\215"
+	.ascii	"-c$\333\2462\3316\217N\275\325<v\267K\247$\032\362\310I\347\330"
+	.ascii	"2\351l.\237z\253\217\355D\"Y\267\232\313\344\235\346\322)\351"
+	.ascii	"D.\223[c\313'13&o:\342\332\314\270"
+	.string	"Jr\253\277\274\302\220J'h\262m\366[7\243q\265\222AwXS\371\206\024\302k\264\240_Zi\220Mn\273\273\200\227\026Y\263\267\240\311+\315\356+ZV\355\225\341\330B\333\tC\217I\302\272\213\253\333@\267\335^\335Gnhw\037\273;I\031\326v\023qJ\226yyu3y^\035vd\303\325}\321\376\254Y&\235d\315\036\0332\316\262\316\321\036\271\254\337\306\224\253\363(\246\273\272\233\343\326\262\245\017C\202\326\220\306\324\351\202\f\304\333\001r\264\306vS\376\023\200\354\354(\344\246~xJE\016\005\002\363f=\243I\223\006g\366\367\330\215\3530\036\206\242\205xc\007\256\025C\207\303\234Q\323\207\371p\036\336\303o\254\207\333\030\312Ovc9\3479L\347i<\316\273N\356\217\313dh\223\017fo\267\313\3115r\2250\224\351\324[j\b\301u7\200\035cP#L\351\327\005\035\320J\222"
+	.string	"#\b\356&\271K\370y\225\234\327v+\271b\227\214\241\314\266\301Z\f\022S\026\230\332\031r{+\242\222\2151\245i\231\304\335\364\"Ib\n\261\203\343\312\021~\336\346*\267\205M\243\013\372\257\024@\316\023\262*\353uP\326\353\304\210\254{\340\214\2601\327\353~\254\027\310\r\302O\bW\310\257\017V;\022\262\355\366Bydf\314M\257\343\261\236!\250\272h\224!\250\327q\255\367\316\255\277\213\326\377*o\017g\235Cl\267G\231\253g\255KKnub(U\201\024C\251\027\307\315q\223\277RS\2275K\320\bZ\177\271N<\301\203\346\246)\037\216z\265~\267~\245k\207J\231\327\333\372{\274\310_\211\351m\212\0311\320\365\267\221\320D\017\r\271)GW\256\333\006\002"
+	.ascii	"#j\216p\364\347E\314\210\347\\\020\260\021}\224\350\246\354\210"
+	.ascii	"\037\235\347\270\021\317ehv#y\256\311Q7\262\211y\001\363\202"
+	.ascii	"\264\013\031\2253j\372\233\266\376\215\243\324\035C\251<\247"
+	.ascii	"wV\004\245*\231m\243\005`\213\003\027F\313z\036\304\204\316p"
+	.ascii	"\207c9f\266.\220\032\330\234\242f2\245n\\\0216$\207\316r\037"
+	.ascii	"\264\324\007tRp\314y\271\351\3458\356\277R\032GN\0332.5\262\260"
+	.ascii	"@<]\261\306b\215\024UP\306[U\bfA\375\2062\002\f_\\"
+	.string	"\"R\261j\311X5\ff!\r\203Y:c\325\206\336\312\332\020\026\323b\221%\002\201\276\244\032YX\277\224h\314\322\001\331aP\b\303\227\004d\2132\322!\226\320\370c\213I'V\005\263*\354\210>\253_Z\203h,\n\203,\212\250\377\252\206\"\214l\221E\021\314\032\360\237\220\310\016\331\340\372\f\033(l\340@#\351\034:X\350`A=\207\016\275^\207\r\275\365\033z:\343\255\b\034+\213%R\031\261\260\210T\001\330*\026\210eb\211\005b]\245\305\252\240\360\305\020\013\004\223\357*\004[\224\241\252\354O8\203\005\252A\237\212\235\261*\350S\201%L\n\372T\030\177,\f6E\226\320\352\267\003\262F\";cX\302\370c\215l\b\001DV\370Bh\034\262\300\022\276+\340\316X\305\3018\024\312Hz\257\007B\301\212\023#\326_\005 \321\367\003\026\251\202YTC\241\357\212\352G,RU\030"
+	.string	"\203\035\016}V |W@"
+	.ascii	"XX.\315\302\b\fy\255X\251\323\325\306\353\207\\\225\363\363V"
+	.ascii	"\341?<\247n\262\2575\255dJ@j@iL\362\254g.\314\211~u\360\223\023"
+	.ascii	"]*<1\355\221\t,M\031&a\211\213\217\363\354\246S\332\233&\256"
+	.ascii	"P\236\233^g\366u\225\200\274\226\267\207\331\237!\267H\026<`"
+	.ascii	"\267\007\323\361\251;\211\2372&W\312\215r\237\334&\027\n?\257"
+	.ascii	"\223\033\366\273\343\006\200\265\250\221(\206\2203\210\310\220"
+	.ascii	"\210\314\2144I\007`\002\0212+\356\021\220\245cdNfS#\215\001\027"
+	.ascii	"T\351'2\317\222\342\373+MR\234\017\204L0\033\006\373\013\355"
+	.ascii	"\030\205\271\n\"\360Q\244\376)\213\227.Bw\242\255\216,SJH\275"
+	.ascii	"50a\274\337\006\034\013P7L\026\266|\230\203\361 \255\037l\224"
+	.ascii	"\322\020#1R\006\301\b@\207\"\335\247\350\256n\231<M\020L\242"
+	.ascii	"\003\260\306\347\311x)\354;=\022\3634\224j\200$\223\002M\002"
+	.ascii	"Ng\211%\345.\366F\310d\375\345\300Y\365\342\300\340k\246\227"
+	.ascii	"\335SG\237w\223\205rth\233\272\317\371\267\362\203\243s\342\244"
+	.ascii	"\227R\265)z9x\315\323\227\375\013\303\317\323\267\373\246~\n"
+	.ascii	"\023\340\236Ul\235\366\306\241\312\230\005\370\002\226\023/\273"
+	.ascii	"\370\2232}\274d\031\tf\304'\270/\337\270\242\026r\203\271v\243"
+	.ascii	"\261\2675\250\240s\225->'\b \301t\2716#\277\202\2709\311\231"
+	.ascii	"\205g\350\222}\242d\223\337\311\025%\201#\210\022\220ji\251\365"
+	.ascii	"\243\263\257W\255\361R\346\303\220\236\364E\001\242g\275g\207"
+	.ascii	"fu0\305\212A:f\300\002\214r9S\346\r\244\034\337*\350\177l\027"
+	.ascii	"7`!\t\323*:\233+K\326:\032\215\337\037Z\365\230\357\325\033\245"
+	.ascii	"\300#\247\260\030s\340X\260\241\343\360a)\253J\255\214\376\221"
+	.ascii	"\211\266\330\275\241;\003\362\235\257t\026`8\035\347\303W\005"
+	.text
+	.section	.gnu.lto_.symtab.e1e2c400acfb9579,"e",@progbits
+	.string	"pgResetFn_sdcardConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"sdcardConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"sdcardConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"sdcardConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e1e2c400acfb9579,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
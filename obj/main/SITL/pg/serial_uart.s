@@ -0,0 +1,335 @@
+	.file	"serial_uart.c"
+	.section	.gnu.lto_.profile.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 I\325\001"
+	.string	"\324\002="
+	.string	"\005"
+	.string	"\335\322\207\236\016\016\002"
+	.string	"\002\001\002\002\003\002"
+	.string	"\001\001\302\354\264\213\r\002\370\203\200\261\004\003\240\342\234\212\n\004\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"+$\300\351]K0\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 2}\001"
+	.string	"\204\002&"
+	.string	"\001"
+	.string	""
+	.string	"\027\336\315\204\314\002j\001"
+	.string	""
+	.string	"\002(\336\315\204\310\002j"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 '\375"
+	.string	""
+	.string	"\250\033"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	""
+	.string	""
+	.string	"\001\002\004\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"*\201SB\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.d183b50ed17cd59a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialUartConfig_Registry.14.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 \227U\004"
+	.string	"\304\007a"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\202\200\200\374\342\203\247\333\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\347\007us\350\366\006uq"
+	.string	"\005\001\006'\001\020\237\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/pg/serial_uart.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_uartDmaopt.15.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"]\004"
+	.string	"\022\306\026\"\220+\215\001@\333\266m\333\266\256o\333\335\035\026\230\330l\261\273\273~\016\377k\3161l)\367\336I\006\270\342\305\357\306\217!K\236\\\3312\346\314\233\350\016\024\370q\360\325\234.IQ\324\212\254t\2442\364\325G\317\235`78A(4\003\342"
+	.string	"8\331\253\347\336\364\304\021g\001\026"
+	.string	"2\003@\276+S\006\354\003\305\300%\200\037(\006.\001\374@1p\t\340\007\212\201K"
+	.ascii	"?P\f\\\002\370\005\252Ht\2067\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_serialUartConfig.16.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375`\263\003\035\030"
+	.string	"v\253\227J\240XU:\200\366\032\331_\371SZ\256p]\247\215`\t\304\031\343\200\002k\337\005h%\n~/\317\357\207\261w\312\2007(\217F\255R\013x-x\035\236\036'E\227C!\352\341\0064;\254\327\035\312\020\332d\357-w\222\001\177"
+	.string	"|"
+	.string	"\203"
+	.string	"\222\3712>\243v\240\316\005\334\333{\322\343\336\261\001\307\330S\036\257\252\247\366\003\352)s\215\031\312\307\337}p\207\023\262r\357e\265\211\312\366s<\317\256]\254\324\316\2265>\215'\340E\311\351l\027Q:\334\320\203\254'\026!Nm\210\333)\376"
+	.ascii	"1y\022 \021sfJ\024\336\205\227>:\0369Y\004\275/\374\202\035\222"
+	.ascii	"\234.\350R\234p\357e\231\323\2018\233\316\3140\2309\002s\277"
+	.ascii	"\br\251{\350G\311G\267\217y\264\311\231)\267\025\334=f\225\313"
+	.ascii	"\201\177\352Dg\324\205\316\247\007\317\246)\331N\311\342%\327"
+	.ascii	"\226L[\362\274\344n\311\262%\237@-\202d\240\350\336\017KX\356"
+	.ascii	"\021\375\241\342D\277\320\037|3\237\371C\374\033D99\202'd\354"
+	.ascii	"\220[N_z\002\334\236\022\277\025\037\371\302\032\267Q{\020\306"
+	.ascii	"\332\200,\016%#\244\334;\306\234\262\003{\3722e\0133?'\222\263"
+	.ascii	"b\306\360\"\030\203\244{\357\214\220\017\211q\006\032\371\034"
+	.ascii	"M=E\365o\\\001R\020% m\037\337v\217M(Z\3254\206d\237S\t:\351"
+	.ascii	"\221W>\357\275w\266\3570\325\324\252~\320\016\311\215\304y\234"
+	.ascii	"Y\366\036b\r\036Vj\247U\346\r\337AS\375\356\275\020\370::\340"
+	.ascii	"\244\222R\234\362u\352)\202_\225\235Nu\367o.\344\331\250\276"
+	.ascii	"e\377\326\202G.\261\251\337\027~\002wMpYv\002/W\214\303\313B"
+	.ascii	"\215\035\026\273P#sUv\255nf-\234\n\032Z\261\331\213\306\202\331"
+	.ascii	"\260jb-\032\226kFc\255\016\260\314\3465c\335\310d3V\313x\337"
+	.ascii	"=\246q;4:\332i\036\261}\374\340\nui\032\303\036\310O\355\303"
+	.ascii	"?~\252>~j\227\376\360\024\200\274\241\033\t\333KZO\202td\033"
+	.ascii	"\200M\210\022P\354#\264\002I\263\271#G\305u#4\031#\330\252\210"
+	.ascii	"\3302'\200\264S]\217\343\263)\252gK\340\025\341\2620\277\002"
+	.ascii	"G\250A,\305\230$\206!\t\206DA\323b\306\200\002\021;*\017\021"
+	.ascii	"p\275#&$\252\245\312\260g!\365*\331\351\236XB^W\221\005\354g"
+	.ascii	"\315\377\271\361\212<\2012H\331\220M2\326\375D4\314\242\031\360"
+	.ascii	"\213\270\235r\241\207\f\371\2106Cz\330\036/\025\232\227[c\317"
+	.ascii	"\2661&@\224\201\330\321a\270=\302\201*|\356t\250a\241E\346|\220"
+	.ascii	"*\247\210\374C&bY\375&\211\232\246\b>\t\353f\3544\302\260\217"
+	.ascii	"}\216B\256\373\024\004\026\200\206\202\243\r\357\310)5\340Od"
+	.ascii	">\325;\311\242\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 Mi\002"
+	.string	"I"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\006\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\200\204\001"
+	.string	""
+	.string	"\003\005\016\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\013\t\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\f\n\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\t"
+	.string	""
+	.string	"\001\r"
+	.string	""
+	.string	"\001\017"
+	.string	"\003\002\002\003\002\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d183b50ed17cd59a,"e",@progbits
+	.string	"(\265/\375`{\013\255?"
+	.string	"\232s"
+	.string	"\031?P\350\315p\220+\033\336\230\2114\030P\r\332\311\220\301P\004\225\352\343\230Anz%%5\305\240L\320?\371\2446\023\2468y\263`\225\023\356W3+\006\244\032\250\202\004\035\2666n\"e\nO\001\177\001\201\001*\372]S\267\016\315\023\347\031\204\321\257\022\365[D\265\352\025\220~]\252t\353"
+	.ascii	"\277v\250\322d\331\332n\t\340\352\3141\272\264Tt\346(\251\241"
+	.ascii	"#cdt\343\254\3342w\316\277s+\347(s\331\315\356\365\351gT\262"
+	.ascii	"'\016\243\013V@\212\256U\032\265Vq\013\267\344\224#F\020\243"
+	.ascii	"oUO\217\356\340\261\303\350y\250\307pf\233P\277n476\r?\360\277"
+	.ascii	"\240a\335\254\3336\017\210u\243\231\005H\273cs\247\257\273\337"
+	.ascii	",\234e\256\233]\363e\263m\276k\367\332\335WWU\350\322\320\226"
+	.ascii	"/)z\024\252\324\nH\231\203\272hv]f\325\252\371\005\r\377\025"
+	.ascii	"\231\335\326\335Q\213'Ff\306\350-\250\3374\247\302k\roR{\364"
+	.ascii	"s\253\322\263\372\257\231\177\313l[\325\017Id\331n\335\353\324"
+	.ascii	"\323\240H{\354\030\375\272\002Ru\251\322>n\376\277\371\257f\300"
+	.ascii	"\177\027R\377\326\331\375\277\373\277\347?\336\1779\377\323\177"
+	.ascii	"\357\376u\360\357\325\277\021\376\205\360\357\203\177\255\376"
+	.ascii	"\235\240\341_\250\177\031\374\333`3\374\217\372\371\305\277\030"
+	.ascii	"\376\005\376K\341\277\241\377{\377\337\376\367\371\234\377p\377"
+	.ascii	"\333\3767\375\257\373\217>\237\317\347\377\274\237\003\374L8"
+	.ascii	"\002B\346\3120\372E;\350?\323R\233?U\340\f\022\204\026G7\366"
+	.ascii	"\006\005f\r!H\21427\320\256Y\262\006\257\237\352\371O\333\230"
+	.ascii	"\354n#Jk'\305\234\276J\373\264\277m\320\277+\020\323\215\326"
+	.ascii	"\247H\355\022\307\350\204\321\377\013\372b\272\213S\275v\022"
+	.ascii	"\331T+\"\327\340)\247\326N\033\320M(\215\\\325\224\350\262\271"
+	.ascii	"\327\336>\252)o \327e\022\271.\213R}\\\026\273W\245\024\322\315"
+	.ascii	"X\\dSM\211l.\225S}\354b7\215i\352q\251D\352Y*\245\220M\243\022"
+	.ascii	"yTSN\235\365M\211\023\304\020\263\314\246!\217M6ffLJ9\221\353"
+	.ascii	"\262\365\272\327\355G'\033t\233-\223z\306%+'\346$\023{3.\227"
+	.ascii	"\300\230\330\332\262\217N\244\227e\267\0271\032=\226\241\270"
+	.ascii	":\273\312:\213P\314\232\310\217\356\002c\335\305mgw\027\273{"
+	.ascii	")i\266v7\221B\262\215\215u\227U\215\265Yq\356G7\273\t\222S\""
+	.ascii	"\233kK\340\034\233&[\003Y\213\313\326zjI\265YL\323D\272{\023"
+	.ascii	"\251l\312#\210\374\344\031\305\022\2651\372\315\373\367\316\342"
+	.ascii	"\331>\274\354>v\367\200tL\332\222%\243x?0|\336\344\201S\277\316"
+	.ascii	"\265[\346\362\331=G\327n79tl\233\207\317:\313>\210\251\343\303"
+	.ascii	"\360\003\227\317\322\255\036\250\343\332J\026y\206\310\365u\257"
+	.ascii	"UWWWj\361Q_\231\274\266\3162\251>\306\031"
+	.string	"\342\273\272\252\272\272\002 D\315y\006\205\006\371\336\0011\344\2113{|\335\353\177Vc(\313\344\265W\255\261\031\247\255\263lm#0\n9QtE\340\352\tQ\236\236\2234m\t\365\266NI\304(?Y*[R\347C\313\3312\031M]$f\016\322\367\232\356XY\273\242\376\027E\375\257\254L\365\303wfgD\375\217L\345#\214d\231\0208\211\222q\355\225\257Hr\243\206\321\377|\250_\b\351\357\371\\\b\351\177\255\236\373\324s\"\365\347\"dJM:EvL\306c\334g\017\0211FY\b\017Y&\002&\262F=M\0323\t\322 \365\213 \335\347\"H\317\200T\251\245J\027X-U\312\315F\026\373\231\242\310\310I\201s\247\236\213)\254\334\301a\024\335\327Iw\322\367\3713q\335\026\2661:\365\033i%\375LPzZ\334\244a\364,G\375BR\202\363T\304\204\321}\244\376\340&\004"
+	.string	"gqO\366\321\277\212v\321:\212\261\343)\251\021\243\333h\373\276\216\226\321:\312\260\3546\256\243\250H\335\306\250]\006\273\fP2k[\336\244\350\031\215z\275\025\220>!\002~\0235\331\331\341C\303\250\023GQ\277cv\r1\327\320\3461!Q:;\276N&%\234\233\250\337?\013\350\253w\275\335\3332\020j\230\360uY\231\025"
+	.string	"Euk+\241\357\336\0139\365\201\225\022aZB\241\2100\260\257\021\005\302\264\204B\0216\202\304a\330\212\003\304\323\250\300\005F\265\345\205\243\311k\006\013\225\206YN\304,/.0%/.\260\0371k\003P\r\356\350\032\242\303aP(C\206\326R\030\330\327\026\212cIH\004\373\311\bzqu\325\320Z\222\021\034\342@\275\276\272\210[\301\341\322\205Y\\`\025\236\204Z4\266\3200!q\330\305\025T\221E"
+	.ascii	"@\226W\tbp\030T\301\005V\340[]\302\240W\220K}\206\r\0246t\320"
+	.ascii	"\261\364\016\036,x\260\220\276\203\007 \320\303\006\240\372\r"
+	.ascii	"\300\037\361[\303,\247`\026\t\026*D\264p\nnu\345\b\312H\211\247"
+	.ascii	"q\340_`A!\026\361\353K\210\325$T\207Y\\]3\274\276F\020\205Z-"
+	.ascii	"\002\020\263:\020\275\272\322\003\201#\026\264HaB\335\252@\024"
+	.ascii	"j\341\310\252\241\325%\f\016\261\270\300\260\274\272\264l`m\t"
+	.ascii	"\207X\025\f\020\301\276\264l\220\320AT\3010\227t\314\363\214"
+	.ascii	"\217\277\354\221QA\262\344.]\374\220\245mpkw}[\230\274\205\271"
+	.ascii	"XI\365\261\217\025\271N\226IP\242\"\245N\037sa\266\205\213\321"
+	.ascii	"\375\0066\206\266\307\350\376\352\016\235\217\313\334C\234\245"
+	.ascii	"*\315Z\214\"\0237D\256\257\223f\022\324<6a\2000\212e=\362[\242"
+	.ascii	"C|\342\324o[\020.2\b\231d\2626AK\230\t\230\273m\373\201J&"
+	.string	"\203*NuC\t\304\026\205\257\260\025\246\302R\270\3122y\n79\373\340\037\3076<\205\215\260\222uR\t\321\246\307@\246\260\223\200\304\250q,h\024$\210\214\210\310\214\310h\232\016p\002\221\2512\362\021`%\203\206hF\223$\3319@\3779\373\345\346\321\200>\262\247\223Fg\b\234jn\\\236\037\224W\037\376?@\353m@<\325\032\t\225\262\251\254\201\02592\020\245\334%\351EXZ\360\242\213\np\240\r\0066e\304\005@\036\025{\322\2037\320%rU\247\3420\214\345\332\252tz\233\233\037K;~\215\352M\310\343{\343?N\267n\013s\321\213\340~\272\213\271\004t*\237'%\224\002\312\031\257v\262\242\316+\377\341\251\334Q!\226\203^x\331\321Hi\006l\267>\360\376k\357^@7\255JK\217#\3033\305\215\371\352C\032(\334\3245\027\311\261\024\325\013\206Z\372e]\300\006g"
+	.string	"\323=\214c\2754\350\030"
+	.string	"\357\tc\305\266\023\273\023\202\317\2410"
+	.ascii	"\037r\260m{\240Ma\373t\305\352-#\20607x\372\246\032\202u\326"
+	.ascii	"g\221\364\021L\355c\fh\200Y\r\265gN^k\036@\205\353^\363GBkJB"
+	.ascii	"\332\031L_C\266\245\037JJ\3600g\211-\251\215\222*\003\333\023"
+	.ascii	"\210\252$y$\215\267\231\237f\243\254C\325Q\315\301\347Zk\204"
+	.ascii	"\315\200\223U\212Y\263\005(\221\356\223\225\2778\274/AS|\343"
+	.ascii	"\335\033S\354\031l\322i\212\267\034\216-\242\253\032a\032H\312"
+	.ascii	"n[l\332\347\034\022@\335\013*'\220"
+	.ascii	"\361a\216/x\242\363\315\013\303O\366_\255J]\031\225HD\370#9\t"
+	.ascii	"l\326n\303j\365l4\017j`\375\240\217\006\016Q\033\237<\024\223"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.symtab.d183b50ed17cd59a,"e",@progbits
+	.string	"pgResetFn_serialUartConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"serialUartConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"serialUartConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"serialUartConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d183b50ed17cd59a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,236 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\200\206\326\211\013\001\232\273\220\376\001\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.fc76921aa2a3b2b8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsConfig_Registry.11.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 \2205\004"
+	.string	"\204\007`"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\206\200\200\374\342\203\237\252\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\336\006us\250\367\005uq"
+	.string	"\005\001\006'\001\020\243$?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/stats.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_statsConfig.13.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 +Y\001"
+	.string	"\036"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006(\001"
+	.string	"?\202\210\200 \177}\274\001{\274\001y\274\001w\273\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 C\375\001"
+	.string	"T\003?"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\r"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\013\001gistry"
+	.string	""
+	.string	"\005\b\002\201\204\001\t\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"W\005en\323\t"
+	.text
+	.section	.gnu.lto_.refs.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.fc76921aa2a3b2b8,"e",@progbits
+	.string	"(\265/\375`\320\007\335-"
+	.string	"\232S4\022E`\336Q:u\315\025\363\307\r\263N|\301rt(\343\031\006<a\312\b\0236\244\234\300\214\213\336\0358k\250?\216\362\212.\337\300\0138\250\317\f\221\n\303B\347\3755\244\001h4m\314!\001\235@j7)S\353"
+	.ascii	"\022\001\031\001oz\264\375\205\364\374e\350\210\033%O\3326\277"
+	.ascii	"\f\312\\\316]~\236P\231\227R\255\355)\244\3474V\373y;\247\032"
+	.ascii	"2/\332^*=OE\034\220)mYK\312b\001\023\017\356\212\\\222\266g-"
+	.ascii	"?\257|\306h$\356U\336{\tt\027\330\262N[\306\302Y\316h|\345R\021"
+	.ascii	"\276\323\272r\313\356\275\214\006\341\307\275[\214\326\253\273"
+	.ascii	"w\253\307\274\304\274d\251\ba\302\005\265O\220\236\216\177\350"
+	.ascii	"\021\373P.\213:[\371\271\n\233\371P\257\345z\323\356\275\275"
+	.ascii	"f\222\326\326\326\366+\377\320\224}\250\021\373\320w\372\377"
+	.ascii	"\355\177\234\377p\376\317\371\017\367?\350g\266\237\177?\037"
+	.ascii	"\370\331\300\317I?\017\370\271\300\317J\r\376;\177\026\360\263"
+	.ascii	"\217\031\374\357\375m\341\347\005?/\375\234\340\177\334\177\373"
+	.ascii	"\277\355\377\356\371|>\377\243\370y\313\217\246\bx\216\336\226"
+	.ascii	"\250\235\335\t\352\362\314\263\243-\333IY\364\030\323P\330\232"
+	.ascii	"\017\260\266g;?\2271\335\211\247\223O\333\277\361\017\345\271"
+	.ascii	"\250s\035\"73tV\332\026Ma&;\207a&\223q\234=[m\210H\243Q\327\347"
+	.ascii	"z\365p \004\205\231\205\254-\334\232d\233r\334\324\350\322s\031"
+	.ascii	"\251\b<\207\233\f\207\233\313\nT\314\350\036\270\221\321a9\034"
+	.ascii	"\207\337\230\311s\230\315Y\f\217\271]\357\365r\357=\233\235a"
+	.ascii	"5G\274{\203Tir\357\032u\236\303kX\r\202\027\367\006\021\353q"
+	.ascii	"\251Y#\353s\357\352\344\224\344\344\024\224D\214\217\330\220"
+	.ascii	"\3456\354\206\231J\374\306(\320\224@\200\332\236\321\322\263"
+	.ascii	"\022\312OVB\317Q\3223\222\364\214#=o\245\214\206\3230\263\211"
+	.ascii	"\333\316f\230\355<\345z\263\334\273\366xr\360\204\245\265}Vz"
+	.ascii	"nB{\317\347\363\311M\350\253R\005\374Cm\223\177\350\231\314\215"
+	.ascii	"An\204oH\371\362\017E\362\302k\f\346\347\361\310t\005m\332~\247"
+	.ascii	"#=\233\325q\24081K~\262\263\f\316E\303\200\302\346\262\363H\013"
+	.ascii	"\300\275C\3504\311\321="
+	.string	"\032\254w\264\216\346\301\314^v\214\263\037\376\243l\255^6W\267\340\346\021\feo\fh\331]}\203\233K\244\253\\\253Cw\357ur\032\202\021\244\031vd\271\356r\b\270\\p0\223\243k\033\215\203\231}\343I\353\275i\017\376\250\033-\243\277\270\271\\\357\327\2109\0369\n8\031\335\201\363\006\206\332\277\277\272\306\221\227\325\b\236\266\355%\264\324\321\266\202O\372\367\ff6\215\317\025\335\213 \325#E\214\236\313\021\261\215\t\311\223\276\347\322w\233\027i\034\2720\267\266\364\315\226\266\262W0\223\251Y\274\267Z\353A[\353];\211S\r\313ZzfBw\317'3\241o\265\264\331\207\"\365Y\372.K\177\016\344\f\312\222&\217\233\223\341\354\\t\375X\001\364\2335]\\m\337RR\005\354C\273I\017\363\351Q\tS\244\313\236\016cl\272\264\265y\272\215I\023\031\001YGc\006$,\241\232\314\372"
+	.string	"\274\325\323\360\350\233*\232\320\240\n\223D\305\252\016J\002\213T`qx\f*\016\217;\025(!Jx\202\230\264\311\244\020IE\025\024\312:\032\247,R=\356n\224\205T\223\304\241\320\203\200O\251\267\032p\343Q\210\204R\215F$\024\221\n\234 D%\274*\021,\n\201@\243\244j5$^U\371\222@!\026QU\201R\017\324\"\321D\212\005T\223D*\340UP5\252\300"
+	.string	"\217\212\312\240 D\207\r\351\324\023\324\360\bU$\006\261\240\246\220I\250\247\037\225\2608$^\005\205\250\204I\023\266h$\252S\302\244\320\203j\220\n\t\034\036\237\216\220A\253);$V\025\215\031\222jPM\002\205j\360\352\210%\004\241\n\223B\017\303\343\201\"\rd\2076\003mO\023\341\270\245\2711\037-D\b\232\242%ulM\242\244\177\377\370\373G\003iB\272\31274\302\\\257\245\003T\256\314\327X[8\2428'K\347\020\271s\037f\262\\\213%\235\255ZDufw"
+	.string	"\201Ai\033\266*\333\013\036;\001\200\206\250q8\206\214C\206$\030\031\021\021\221$\351p\002\t\310\310\350\001\021\220-dB#4I\226\003\026\2712\344%\370\315\236\212PGf\252\224\001\266K,4\261\214"
+	.string	"\263*p\363%\220+*\230\016\025\032=\251D$i\224\017\213\024\376\223\b\321c\fu\323\203\007t\033\201\262$\355#\374\003-\023\314\246\356\241\213\311^c\241DA\360U;X\354L\330\026\0206\375T\033U\334\265k?@\267\213\205jV\260*\3726\306\341\236\273\262\327\207\"\022,S@\375\177XII\364X\265;f\334\243\224\300\216lZ\271\007\016\240(\275J\343K*\002\027\313l\231\026\"k\322\323\355\rD\004\366\0237\346%\351S\321@t\375\213'\214\006\004"
+	.ascii	"}\203\302\215t\203\031%\na\263psL\"\034\030\246\2456\303_#\347"
+	.ascii	"\377\344\354\341i`F\233\035\355\310\200\002\033'\023K\362m\034"
+	.ascii	"\203\036p~}\005\373\256/Ks\231\377\264\230\343\234\330'7\322"
+	.ascii	"\252}W\0201\0050\304S\370\0234\341[A\211\007F\337`\035\255\264"
+	.ascii	"\277\337\037"
+	.text
+	.section	.gnu.lto_.symtab.fc76921aa2a3b2b8,"e",@progbits
+	.string	"pgResetTemplate_statsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"statsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"statsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fc76921aa2a3b2b8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,345 @@
+	.file	"vtx_table.c"
+	.section	.gnu.lto_.profile.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 3U\001"
+	.string	"\024\002'"
+	.string	"\004"
+	.string	"\250\276\272\376\017\006\002"
+	.string	"\002\001\001\360\200\360\352\005\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	";\2226\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 6\275"
+	.string	""
+	.string	"X*"
+	.string	"\001"
+	.string	"\001\001\002\001\200\004"
+	.string	"\004"
+	.ascii	".\013XB\277\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 T5\002"
+	.string	"\324\003H"
+	.string	"\001"
+	.string	""
+	.string	"\022\246\272\203\256\002j\001"
+	.string	""
+	.string	"\002\t\325\303\205\270\003g"
+	.string	""
+	.string	"\t\200\200\200\300\003d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002\220N"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\002\341\t"
+	.string	"\220N"
+	.string	""
+	.string	"\002"
+	.ascii	"\340r\340\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 x\345\001"
+	.string	"\324\002l"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001\004\004\177"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\002\001+\001"
+	.string	""
+	.string	""
+	.string	"\017\001\002\001+\006\325"
+	.string	"\001\b"
+	.string	"\004"
+	.ascii	"_\025\"\241\342@&q\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 2-\001"
+	.string	"\310&"
+	.string	"\001"
+	.string	"\001\002\002\b\020"
+	.string	"\001"
+	.string	"\220\016\b\b\001"
+	.string	"\001"
+	.string	""
+	.string	"\020\020"
+	.string	""
+	.string	"\004"
+	.string	"(\002^\302"
+	.string	"\003o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.d90c8a7d97babcf1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vtxTableConfig_Registry.14.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 \213\025\004"
+	.string	"D\007W"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\245\355\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\002usq"
+	.string	"\005\001\006'\001\224\002\242\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/pg/vtx_table.c"
+	.string	"\004"
+	.string	"*\342\254\344"
+	.ascii	"Q\355a\240\b"
+	.text
+	.section	.gnu.lto_pgResetFn_vtxTableConfig.15.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375`\231\001U\017"
+	.string	"\006\\eG\340\262(\035Pu\0242\342\032\307}\315H\277\355\003D\236\207\314;L@\257\2166\302\261\024"
+	.string	"\237\375P\361\261a\227S\350\257\340\023V"
+	.string	"\276\352`\2141\206\032\264\213\232\361u`9Fi\202\212\222\217\f\262\267\334)\005P"
+	.string	"N"
+	.string	"O"
+	.string	"\223\273\200\355\323\237\215\203\200J\244\205\206\025\264\335\3654\204\271\313\360\226\361\373\224\032?\037\305\243\007\236\025\210\372\224 2\034j"
+	.string	""
+	.ascii	"U\262DG\317\207\0300\025%\211\231\353a\2171\235\0258\363\b\322"
+	.ascii	"`w\035W`\207{\273m\223\355\005\366y\002%:`FXYvw\233_\376u_d\344"
+	.ascii	"f@\317\356\206\332\217\225\315\030\"\376\272\375\320\207\245"
+	.ascii	"\270\212\357/\307\344\3468\250\241\221cw?\237V\300}\032\220\357"
+	.ascii	"l?\332\257\371\211\3576.\017\260\313\272\361b7L\340\003\334\247"
+	.ascii	"\303\223l\017\273\022\301\257\235\206\354\350\300\200H\305\232"
+	.ascii	"\271x\225jSX\211_\371\260s;42\225\242Tqdz\300Pm\345\334\256p"
+	.ascii	"\026 \027\355-\233m\3418-\334\3562\360oX0\214\330\330\335\273"
+	.ascii	">}\227\355\363\3432\261\343%\326\354\020\025\265e?\020H!\023"
+	.ascii	"\2112\212@*\2116\213@'\023LB\247\007\027N,\036\212\212G\032\205"
+	.ascii	"R<\221i\305\003\025pI\345\304\344\235J%\223\327\205{ey\316\220"
+	.ascii	"\275hjt\031\\\374\\\002I,\345.hJ\320\246\266\0342\323Nu\026?"
+	.ascii	"\277\3068\266]\317\3435\313\020}\\\356\006# \220\202\231\272"
+	.ascii	"\331\001\"\201\3318b\226\255\352\3460\332\304\272\n\013:\b\241"
+	.ascii	"a:O@6\354H\344Y\322\234o\024h\277\022\312\"'k#\323Q7\226\321"
+	.ascii	"\265\332f\337u\303\2645&b\277\333L+TX~\210p\257\025\323\232A"
+	.ascii	"?\211t.\372\004"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 \263\375\003"
+	.string	"\244\006\257"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\017\177\003\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\016\004\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\013\005\201\204\001\f\006\001\022\177\007\377\037"
+	.string	""
+	.string	"\200\200\200\001\021\177\b\020\177\t\003"
+	.string	"\006\321\371\216\307\003\001d\003"
+	.string	"\005\260\206\3618\001\204\006\003"
+	.string	"\004\260\206\3618\001\244\006"
+	.string	"\007"
+	.ascii	"\240\036>@\n\\j`\301p\371\261L\273\020\250="
+	.text
+	.section	.gnu.lto_.refs.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d90c8a7d97babcf1,"e",@progbits
+	.string	"(\265/\375`g\rMH"
+	.ascii	"\032\200\370\033R@\320\322\031\016\027v\232\206\215\343/\032"
+	.ascii	"\203\201\322\364\241R\323\020v\r5\335\230\306\r5\007)dQl\222"
+	.ascii	"\366D\314=\204\"F\022\242\216Y\200\314\221=,\206\013\373D\362"
+	.ascii	"c\200\f\243\202\3760\032t*\032\335\373\200\024\320\227zy\225"
+	.ascii	"\337\354\330M\312\024\177\001\242\001\253\001(\360y\033i\332"
+	.ascii	"d\376\255am\3301\037\344\224\220a\361\371\035\363\357\333\212"
+	.ascii	"\031\356\200\005\371\261\\!4\207\n\357\213\203O\03055N\370\374"
+	.string	"Sz\256\313\336 \224\206%]\223\036`\370|\214t\327\265\025B\277x\211\321\215\226<B\271\302\347\327\313\327-F\367\212n\2255i\343se\330._\267\215\241\327M\005\262[\270n>m\272\205>\273\006\354\032pN\351zr\206\236\007!E\301\373\302\200\212q\331\332\201\317\303Hw\215\205ma\231#\226\313Q\254\370.h\326c<=H\351\201\r\237\267 \375\216@\267nG\240?J\277k\377^Y\345\252-\262\033\255\273A\364@\361\242\345\002\237\273\\-\313,\261h\337-\233\366\033\341\332k\367\352\303K\350\264\\\341\363g\205P\346\245\377\317.\200\260W\274'\375\226@wuu[\002\335,\274\357\nAh\361\270\266\017\001[\332\330\370\304\341t\177\232\033\204r\257\020Jb\203\320\215\333 \224\304\n\241\377V\371\227\312\216\215\330\021\253\220\275\354^\201|V\023\254\274\370\374\272Bh\272A\350\377\275"
+	.string	"\306\1776\377\271|\347\347\021\377\256\370\027\202\177\217\376e\361\257\321\277\017\374+\301\"\360/\212\177Sd\360\337\347g\022\376}\361/\006\377\272\370\267\202\177)\370w\202\177{\376=\377\275\371?\366\377\303\377.\377wuuuu\377\223?\347\370u\030\b\334ko\017\271\214\"\020Wd\221\270\"\203?=D\006\273W\343\017q)\f.Q\311e$*\221F\240\036v\260\225\302\255t\2104\022\335\220\306\037\242Rh$\016\271\214@E\232I\304P\255\021\216m\031q\330WVY\302\342O\223\270\"\373\255{\227S]<\240;\013Y|\023\n\3315\251\346\225\024\232\020\271kw\207\260\222\352B\366\260I\fCv\207I5\265\225\212\340\332l%\333\fzeu\325T\367"
+	.string	"V\335\301\355fw\007\273\033\247\230\265v\023\371!&\255\254\272\217CV\235\025d\233\352\346\345\2305#Q\331\205\344\261eQ&{\307\032\334d\277q\025Se\260\254\253\272{\323\244I\343\217\034x\212u\344\300\t\207@\370\344\341\220O\0230Sg\370\374\266\220Z\241[\271\335A\215\f\313\256m\363\353\305X\232\031\333\266\025\331\222\\q\306\n\217n\315,\3346\277\316\261e\\\032\335\336\260d\266y<\303\264\304\375,\305B\016.\233\345a{\330:\356m\263\314\245[4\337\0346\315y\355\036\246\370y?\212\025K\267q\333\266\315c\004S\310\342\272\327o\332\277.\320\355\013\373\245g\327\215\204\231\354\356/\230\177\233t;\303\322 B\252\333\213\b"
+	.string	"fmzH\231\353n\242!\"\"\242\034\2544\2712\001\234;\374\273n\331\316\371\204\255L\214|~\347\376\325a\311\2249i_`q|\236jx\3375\021,\361\232\302\347\016\231\002!\201l\t\351\227*\375v\n\367o\230-\263k\213d$\\Ycc\276\030,\0050;\366\363\220pWO\020\250\333KL2\005\036c*,\205U\340)\313d1^rF\362\326\207X\214\223\254\3326\277(\030{K!\306L8l\233\307\237\036\246\235\371\300\203\253\251\325sr\335\214\b)\242\01323Q\030\205er\330\207\326\356e\0307\341\023\266y\\\333G\bpXrs\335+Q\b\"\236\034jx\303BO\200\322\203\266&I\303''q\216B\272\350p\342d\231\374$U#\306\306\346ft^"
+	.string	"\353Z\222~w$\375\356\230\262\222\324\2068\255/|~\347#\375\356*\375\216*\375.\230\236\333\244?{q\327\215R\006\271/]\333\306a\274TI\315\245l\002\213\265\270\310\237\3433e\r\t3.=g\301"
+	.ascii	"\003\303|\033\312C\316D\376\034\356\362$iE&=\013\341\343\237"
+	.ascii	"\323\363\346DKY\230\364l\302\r\263Nn\b\237\034$\235\342\266\022"
+	.ascii	"\037\264\322\214p\220\237\1770\220u\313QG\367\266B(\317\006\241"
+	.ascii	"l\344\235}\350|q!\316\n\237;U\322\363\016&\236"
+	.string	"\251N\305W{\354]\031\264\037@\346\372x4\341@\261\207\016V\347\253\303\355\264\210\017pV\326p\361y5\\\365?gg\325I\261\252\036:Y:\360P\344\341\316\031\221'L\370d2\217E\2631\250Q\t\341\363L\225\236\177\264\205\305\356\366q\263vQj\007\335\233]\023?\317\356\366\200\377g\367\023@v\033i\312\245Q\324\204'\321b\335A\240^\273HTr\005\211Xh0\002\255\275\005\242\225^M\\\271\214'\262\003K\275\244\n\336\364\363\2516\234|K\005h\340KR\237Z\020\200#\n\252E\020\r\025\370\303\301\001\222\020\360M'\230\242\202\224z5tz3\330w\363C\332\001\"\365\230\242nzLQ;5\207\323\357\374\375T\337\322R\022\016\216((\245\323\007\214\332-\251=&\247\247$\234%\365W\343\354A9\001\225\324\037\316}HLQ'xp\370\200?'&u\003\020WB\352Y"
+	.string	"T\177\352\006LQCWr\362\251=\225)\275\n#\006\214X\334\3009\213\243\006\216\032@\317\342\210\307;2\342\2457\342\355\200o\032\340PQ\252\257\b\b\005\345+\322\371=\2512\222~HLN3zP-:\270\001\264\361\363\273\371\2458\224zj\r\021T\337\214\234\234\237O\005\002\325\027K\275$\031:\276\244&\245\363\247\322H\202\361\244\366zIMJ;@$\0268\277'\325\206\372\002\210d\304\003\366\234j\244\347\361Z\220\360"
+	.ascii	"\306\005\251\322\t\365IF\022\020\351\006\320F\021STQ\317)\211"
+	.ascii	"F\221\222\357Wt\"\304O\255\361\224\364\201O\035\001*JGm\271S"
+	.ascii	"\305G\031\230\264+\242\230\2615|\242\241\251\371pYb\001\022\346"
+	.ascii	"\354\214\227\337\r\273\b\f\311\255`\233\031ez\245\222\227k\326"
+	.ascii	"%,\263\030\3468\327}4q\303\302\231\0365\360\n\347\345\371\006"
+	.ascii	"f\233!|2\026\316\262\363C\313\206(\234\205\207\002;\276\216\264"
+	.ascii	"\235A\330\250x\341\363"
+	.string	"\247\0163\2632:uV\304\254h\326/\223W\326\341\342\247\273+k\255\213\307\005x\330\310\314a\351\222~\245,\027\317F\226\311E&\033*[\203=dg\305\254\005r\330\300\330\260\370\254\262\016\031-\r\232\031\322\322\357\030\027{\221\271r\204\273\002\200\364\250q0\205\2244\310\310\f\211H\222$\305\006`\002\22113\356\021\200\251\223fH\322$\225\351\241\020\244\230\033K\231\025\244b\017\234h\375\340=\214\274\230V\346}Y\324yR7OD5\354P\210\344\236\244\242\002\032n\377\255\325\306\220I\017\244\234\026\325S\031u\0348b5\251\207\002]\021v\214\233~A\203\026\240\255e\221\320\232C}\321\304`\fr\342\236-\024L+\355B\003\362t\020\373\263Pqu#\300\372\200\304\333\223&\362/E\251\353\235\377\341\324\032S\223\022[\342\316^\363}T\223n\203\357\265\360\350\335LY\270E{\007\365\351"
+	.ascii	"Y\216\266\275\372DI\242\356\333\304\251j\303\002\317\246\b"
+	.string	"\022\324X7s\323f]\227\326`\317\266\304X)\024\337\340t\222\002\252,\\?nmm\260\220\036Y\324\251\272\2062\033\371\266\n\220\233\036\216q\311\362\214\tj\270\203\353\032\327\342\265k\021\"\034\372M\023\244d\311\3225<\024\343vza\275|\b\253\333@\340;\204\243\314EW4\213/\205\200g\345+\245\340\234\220=\""
+	.ascii	"1\240\241\3126\310\211m\355`/!\220\3213O4\235I\301\240%<Xf\357"
+	.ascii	"#yC\351Nt\311\316\312\001G`\" \325\222S#\310Sd\231WYM\206\204"
+	.ascii	"\254XFE\260<(\302j\374j\200\373<\007\033\231\"\320\305>\2633"
+	.ascii	"\035\274\250\244\205/$a?\342\177\242\344\370\377\213\261\032"
+	.ascii	"\025\356eN\235{\251Jt\322\364\215\030\240B.\311q\376\3707\302"
+	.ascii	"\260\265U\r%\322\336.V\224\242\244Nu\320(2\254\020\234c\214q"
+	.ascii	"b\r\340v\205\346\300\374\221\244\337\003az2\003\302\225>`\343"
+	.ascii	"%\026\032\266\260\354\030\033\343DC*\347I\275\332\023\271\024"
+	.ascii	"\322\3646e \232\260\346\254\020\272\360y\301\213\336(=\264\370"
+	.ascii	"\257\276\206M\330\356\365\322j\334\177\247\003\203\3614k|U"
+	.text
+	.section	.gnu.lto_.symtab.d90c8a7d97babcf1,"e",@progbits
+	.string	"pgResetFn_vtxTableConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"vtxTableConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"vtxTableConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"vtxTableConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"vtxTableConfigClearPowerLabels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"vtxTableConfigClearPowerValues"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"vtxTableConfigClearBand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d90c8a7d97babcf1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,303 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 b\275\002"
+	.string	"\304\004V"
+	.string	"\006"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\203\262\371\241\017\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 \270U\003"
+	.string	"R\004\016\030\260%\351@\340\202\303"
+	.string	"\227$I\022 \207\266[\303\227\264\326H\223)\005:\032\t\243d\251VU\2761\372k\021\021l\203\207\030"
+	.string	"V\374\330\363\2635\266Z\244\315b \024"
+	.ascii	"F\tPj\200SsA`\230\207\271\306Z$V\025\364U,\245\302SU\354+\n\251"
+	.ascii	"\002\354\346\002uU\013\337\316\230\315v\300\2620h\003"
+	.text
+	.section	.gnu.lto_.lto.8dc18ab0a0aa171e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.19.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\215\t"
+	.string	"\366\222C:0\305*\035\b>]\n\214\013\300\221\001\250Q)5\274\321\254\3253\202\034\225N[\213\fu\275\266\034\210\b\310@\307\bj \264t\0353\370\006\225\246\217Y\237\234\375\275\267L)2"
+	.string	"3"
+	.string	"."
+	.string	"\037\371\fj\330\221\341Aa\305Zv\303M\363\315\345S_p\371\214\034\007\257\240\177\223sb*-W\352\032\360\260\273\326\226K\343\216\267\315\261\335`\233\026\033\331.F-\300\256\314\031\210\355\317\316\330\226j+0|\207U\\\263+\026\217\005U\373$/\371\036Z\234`\367\005 e7L0\002\346\323!\306\266/\022\230\335u\360c?\241\360?>]:\351[\237\376\351\362)\243\300L\343\343Y4\225\326\3540\245q\303\276\334\370\262\255\226\207\375*\325\237\231\220\334g\002$%D\021\\\007\021\032\211L\334\311\203\362\006\f\352\220J\243\r\345m\234\3503\332@^i\353\030\270#\205\274\315\324u\336\226\t\367r\343\313\361@\025W\266}q\031\030\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.20.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\356*\035Z!A:\0327\324\003\207\n1\231Af\343\230j\215g\321D7R\254M\256\222\374\207Uc\356\033MpT\236\357\306\233\255\313+\270\302\013\256e\207\234i\340E\337`t\301\303\037/\235\321\b\"\233\310\235Rq"
+	.string	"l"
+	.string	"l"
+	.string	"\273\267\237\240\335\035\211\007\214\237\336=D\374\034\017@\3744\314f!`\246a\364\322C\332]\224V\020\375\361pw\207\n{I\234c\250\022\346\363\356\241sy\211\303\366\3423\223\242\tg\346s\234\371\030\226f1\031\256B\002\205\320$\t(\364\236K\030\233L\20682\327\367<DGV\364c\223\271,!\330]\313\232m\302\235q\3339\266\017\330\222Czc\357\\\244\211\205$\240\365fw\\\367sl\234\3477\335w\213\357\3353\224\016/\255*-U\372\036\020^|\001\200vc\20206\305\024\322p\337\337\363\021\311\330\265i\261\341 \374\236\236\207\302\365Q\220\373\001ww\344\323\006\306Oy\262-w\377"
+	.ascii	";\217\207\234\261k\203\"hwIL`\374\024\t/\355\347\276\003\273"
+	.ascii	"\256\345\036\001\037\365\346SM;T\177r\344Sal\333\244S\257\343"
+	.ascii	"\235\210 \223\036\356\356\206.\360\251\035z\242\021\321jB\265"
+	.ascii	"\275r\240\027\210\321\356\232\370\">\202\345\343>\375\300%_s"
+	.ascii	"\211\237rE\315EL\006\355\207`y\2158\277E\017C\023S\016U=\255"
+	.ascii	"\203\274M\210W\251\247\345\310"
+	.string	"d\320S\2579\035^\221/FL\006U}D3\233\006\251\257\254^\254\004\016RV\253\023\006(\032)\252\223\326\202i\224\022\025\227\n\305\322B\255R'*\024J\313\205*\0011K%\245\205Za\261Z\250\323n\2577\243v/\2001\225\371O\211~\211\023\245|\234\033\250T\342\347y\227\270\035\244\243\230\f\226\364\306'\232\271\241\372\033M*~\334C\242\250\362\002\357'\212\272\241\247\231 \255F\366\022m\267.D\002C\316\303\321\324\033\0075 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.21.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\025\013"
+	.string	"\026\325M? O\225\016\303\322@\210Bp\004"
+	.string	"6,q4\326\020\307\024\002'X\241\226\374\024\307\270\206\276\272YL\371\336\243\314`\n\345\336\026\200\004\341\244\3066\005&\323"
+	.string	"\032\250\005\306,\"\233H\231R<"
+	.string	"8"
+	.string	"<"
+	.string	"\366\016\276R\017b\2348\\\354\202\233z\270\367L\323\363G\317\030\254B\324\247\272f\bX)T\222\257\224M<:|<\366\304\360\2312!\225\335u\242\276\fw\274m\007\266\025\330?\020km95}MW\247\216\002\341n*\204\261*\"\n\020\266o[dKlg\332\037q\230\350\031\025.`\267\365ab\027L`\003\221G\203\237h\217\221\017\320\036\275@\024\025\222\2262um\234#jt\210`\221'ZxpP\207\264\253\204\215\025\246|a_\343$B\376\007{>y\324\243\377\321\036\257\217=5\\x\261`+R\20668Ju\331\317v7\0240\0234\\\203K\006\323\321x \200\272"
+	.string	"\266P6\234\314\006\3526\r&Bf\263t\234\215B\300\334\346\322m\035\216\3536\t\270\327\226!\245\324\251\204\376\236\366\330\001l\b\221\221\276\247\245ZP\007\017"
+	.string	"o\b8\252\343,\026\n\035vHe\b,\266\025\177@\020\211\020\265\206"
+	.ascii	"\271\214>I\303@\206\220\245*\207\346R{"
+	.text
+	.section	.gnu.lto_rxMspInit.22.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\365\n"
+	.string	"\306SJA \247j:\220P\022\004"
+	.string	"8\027fy\033 \352\341\227\314\214g\023\0014\356h\314\212\307\355\n\374\241\271\260m\213\226\203\322\240\2000\032@\220R\330\366*\0231\203h\226\350\272\023\302B\306Fd\247\0242"
+	.string	"5"
+	.string	"<"
+	.string	"\337;\247_\360\336}O\360\336\371\264\023<}\355c,\216"
+	.string	"\266\335\0059\221\237\257\247\177\330/\250\n\365j\221\330]WT\345qs\267\235\261\035a\277\"v\212\252\\\210\375\312\356\2569\227\375\364\257\026\317"
+	.string	"\202\206\003\273\035\267\005[\353\n\220\330>\306vMO7\315\253\375\223\243\234O\321\370\301\256KF`7}p&\003B-\026\r]\205\026\016\257\335\324Q[\274\214\374\007k\206\256\336\002\271\351\331\027\027`^`3\033\302K\236M:\200\322\267\273\020~,\003\203\3415r\362\336]Jf&\nR\365\026\241\0204\222\234\217\030\216F\022\205\2514\b\205\240\221\344\230\312\317\236\215\310\024AS\t\216aG\004=\245\tn\024L\212>%8\"\311\022\304\244\373\312r.O\320j)n\303\356x4\237\007\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 {\245\002"
+	.string	"D\004w"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\023\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\021\023\200\204\001"
+	.string	""
+	.string	"\003\002\025\177\024\022\025\024\177\026\360\372\2508\272\200\202\002\026\177\027\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"p\003\214@\220@\f\3100M\255\312"
+	.text
+	.section	.gnu.lto_.refs.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8dc18ab0a0aa171e,"e",@progbits
+	.string	"(\265/\375`\326\023\025\\"
+	.string	"\212\230\324!S@RJ\352\213\245\251v\370\277\275}~\3568\3269\364\352%\037>Z\361\354Ttn\377\233\2457\230?\315\013\207\254\215\024\335\001g\037\333\035\022%\344\267\222\242\030!\337\3349i\356\016\006\307\003\331\20355_\221\357\352y\025\373\237z^@\332\346n)\245\337\001\f\002"
+	.string	"\002d<\006\324Ulr\341\036\243\272Y\232\002\005\207\243\275\245\277n7\364@\002\025f\363!fK\226Sc\271R\304\t\311\005I\354\n\215q\314\nGS\270\257\204\325\236\310\300\220q\264\251t\225f\232h+5a\222\207\032\221\366\224F\306Qn\341\3456\221\366\263M\244\034\246\245\240D\260\030\262Ha&6\3112-\322Q>\241\241\200\321\214\205\025\2418\312#\334'`7a\230\323\320\t7\030s\004.\032\253\346\337"
+	.string	"[\016&\246*G9L\1771\363\214\r\230\330U\220\257&\375EU\365\324\246H411\2162\233I\013\301\374:(\027\023\354\311Q\336\3402\214\213\263\342\236\b\302\304M\253C\351\307\026U\312D\203\214\022-\254\033\022/\037MG\033\313\373\252\263\270\261\332\212#p\3015\304\207\372o\033\013\375\037v'`\323\235\200\255\313\206\241T\212r\212\313\334J\272\312\311\254\244%9\312]\305\334m\377\320T\215\374'\376\277"
+	.ascii	"\266\257'^Y\034\355$-\325L\024=\305\rD7\3316l\277\375oo\234\206"
+	.ascii	"2TR\216\342t\211\324\021\270\334K\246I\362.\330/7\212\264\366"
+	.ascii	"|6\212\324\221]\"e\240I\244\355\003\216;\212Djlj\377\306\346"
+	.ascii	"\370\304\254r4\247\007\346F\322P(j\305\032\310o\376\2679\227"
+	.ascii	"\310\245\004\312Qn\273Dz\233D:df\264\0262\263\331Y\031\306a\256"
+	.ascii	"5\247\314N\245\001f\026\201k\230\275\013z\231\235\213\271\237"
+	.ascii	"\271\203\314\rd\356\023\230\333\004\346\34613\026f.c\346'3_1"
+	.ascii	"s\223\231\251\230\233\004\346F\231\031\004f\266\302\334\316\334"
+	.ascii	"\315\334\314\314[\314\254\305\314Y\314\\\305\314P\314\254\303"
+	.ascii	"\314N\230\331\366|>\237\314=\0013\032\001\363\r\t\001S~\345Z"
+	.ascii	"^\345\255+i\246\203\371\021v$\016\305\336\376\023\035)\031\345"
+	.ascii	"\006\013fI5\320\224\\\307!f\240\241\303\262\312p\344\360\026"
+	.ascii	"\214\220\225A\375x\242\\\262q\3468\2028)CZ\241L\027\fb\216\304"
+	.ascii	"\214#R\345B\206&G\305\016KS\0361\343rp\034\224(\2050\001s\036"
+	.ascii	"\374\351G\224\322\223t\240\352QC\207au3\206\2572\033\230qC\256"
+	.ascii	"p78\016VF `I>\240(\215zx\366xA\213\357\340\321a6\265\377\036"
+	.ascii	"c\312\035(8\322t0w\241\251\332)C\005P[\270\034\314\225:\254\235"
+	.ascii	"M_#S\2369\031Q1\223d\bS\324\005(\247[\256\257\220r\331\237\302"
+	.ascii	"H\370o\336\210<\227\2748\352Ep\354F\016\270\352\332r\364\326"
+	.ascii	"$RN\235\\N\251.\247E.\2475\\N\223\256+Q\035O\200\244E\227mY."
+	.ascii	"\333\230\\\026\203\272l\273\341\262\231\355\307e[\323e\333\215"
+	.ascii	"\3136\244\313\266\277\214\226]F\231\\F\333\313\250\r\227Q\034"
+	.ascii	"\227\321\342\3452\264\313\265-\227k^WG\20735S\307\233zJ\321\222"
+	.ascii	"\223\243\\\313\272*\374\263uR\256I\335\0238\334\0245\246\333"
+	.ascii	"\302\354\3568/{\363r\223\206\313Z~\3432\023g\227\240\341\304"
+	.ascii	"Z\027\fOp8\372l\211-\034\247|\360\"\261cT\216\262a\223\025\220"
+	.ascii	"\2244\304\205\376C\276\324P\346\350S\307f\305\343l\212\243\354"
+	.ascii	"\177qh\375\245\303j\255\362\006\004\220\025\272\234\235E\311"
+	.ascii	"\254\307\364Y\227\351!\232L\2475\263\321Z\bn0\035\206uZ\356f"
+	.ascii	"\243\265\227\246\252\265Z\367\210\231\324]^\035\005\310\022N"
+	.ascii	"KwY\242Q\243\241\3040\227\035#\343\214\221\225\246\262\377\226"
+	.ascii	"%`n.\264^\322[;F\306'JyY\200\312\230\215\243\331\177\253B\205"
+	.ascii	"\216\2124\354J\016_pPn\257[\373.\221\266h\252\313\215\204\254"
+	.ascii	"\313\306n3`9\372\222!a\302\270\331\355\253oJ!\342l\n\217#\037"
+	.ascii	"\303n\306c>\246\344\312\223\243.\246\267\322\342\2212S\334\225"
+	.ascii	"c\013\311\023G\3712]\377\302\364/\215\325\355\333\270!i\031\333"
+	.ascii	"\007\370\026\271p\361.\327\206\263\214\275K\230\215\027\027\027"
+	.ascii	"\030\234l\004\327\263H\0242\037\223\"f\214z\322\210I\0351\307"
+	.ascii	"ha\272\226\256\232)\276\003m\232\027#o4>\300\267\261\313>\305"
+	.ascii	"\251\260Wa\257\342X2h\337\206\b!ei^\314\276\311\230\202\331\305"
+	.ascii	"\330\261P\315\004\271\301C\321Q\267\342WndSS.\370\025\017CkT"
+	.ascii	"\035w<mb\330\021\206y\253\272\355\314\351\017\215\377\177\303"
+	.ascii	"\326\276\261\250&m[w\n\346\021]k\005\230\031\375\0323\0022\332"
+	.ascii	"\027\216\251\002\346\022\311\032\362\360\023\3176\347?1)\254"
+	.ascii	" y$&\231\212\313\344\013\211C\2049\306O\n\213\313\377\234'\022"
+	.ascii	"\2052\220\237S\\\376\361iL9\366\267I\341\023\221\237\363\304"
+	.ascii	"\037\236(\022\223\307\342rx\314).\223\307_&\037\347\211C#\022"
+	.ascii	"\361\2159\277Lv\371%\362\210S\\\"\217\305e\262G7)\222Yr\024S"
+	.ascii	"\305\307\226\336*\022\177I\311ih\304q\026[\344\213\375w\323\350"
+	.ascii	"\215\n\374;!\215bC\246\326*r.\025Y\r\221=\200R\221\017\344\023"
+	.ascii	"\235E\035\220\377:\024\001\275\322\004\302\326\371B\332)\374"
+	.ascii	"\341\3645\214\376\tP\372\027\366;\377_\370\3777\243S\373\277"
+	.ascii	"\003\247\250TR\372o\322Qz'\341\226\321\2777\263h\035\213K\037"
+	.ascii	"H\334\326\324R\371G\255\260\225/\2264\336\245\360\207\257\361"
+	.ascii	"\377\375\345*\217,x\221\342\316,A\202h\301\321(\266\247\0344"
+	.ascii	"\2328\312\267\035\227\273\351\304\245\013\211E\351R\216\345A"
+	.ascii	"x\023"
+	.string	"\367\301\2278\023\377r/\377\301\241x\224'\361'\276\345N|\351]\316t.oz\226[\271\020N\345@x,\257\247\301\214J\304Sw*O\216\332\363\311\260\301\371\001\205.\007\020\203\347\007\344 \270\332\360\216\267\252=\365\347\362\004/ x\261\023\274\361\016\214\0260Z\244\274\003\003\207\203\361\002w\371\005\256\306\376\374z|\274U\375\345|~A\003\004W\021?\235\320n\265\255j\017\217\310\267\376z\324\340\032\244\343\255*0'\250\006\375\206d\370\004\351\200D\250=\274uU\211|\271\036\357\004\233\273\375\350@\360\361r?CA?\235\034V\005\252kO\217WB\216\325\001sBC+k\202\372\003\026P\243\006\351v\"\330U%\352\361vk\017O\310\326\343\t]\023v*\320.\250\023\2727\300\030A:\242\236\217\307\352\202|\277Ue{\032\354V\001\200\252\272\376\2502\324\240\237\236\005B\272\030D?\037"
+	.string	"z\202|@ \250\354\316\002\265\307\307\301\312\323\351\364x;\0258\224\013\2564\271\340\220.\027\324\t\335"
+	.string	"W\337\272\252\271\334n\005\226HY\025\350\343\343\313\361\200\300\225&g"
+	.string	"\037\037\037;\264;"
+	.ascii	"\310\013\352r?C%\250=\354\320\257\307\023@\375\245\300\346T\""
+	.ascii	"\036\253#\342\255j\217\001\253\217\335\351|r>vH\227\373\351\361"
+	.ascii	"\200X\237O\b\230\333\255:,\003\255\b\256\276\237\272\262`}\276"
+	.ascii	"\225\005\215\317\f\333\033\362\305\250QY\035\017\020P]}T\236"
+	.ascii	"\340:\002\200\336\f\024t<=:\225"
+	.string	"g\267\322\254\254\007"
+	.ascii	"\260\271\235[o\006p\210\325\261\037\354\326\233\225\365\200\004"
+	.ascii	"0\367\303\363\351\371b\250B<\2667\304\023\\sz3T!\335:\003\bT"
+	.ascii	"w\276\325\203\335\212\243cu2\202\324^O\007\264\243\t\362\371"
+	.ascii	".\310\331\330\334\013\034\333\343\r]\306\341b\234\b\241\003\f"
+	.ascii	"\356n\305\017(\304\"\270\262\350\361tB,v+\220\305\n\022E]\242"
+	.ascii	"\254t\210\251\r\261\330\214\004\371b:zvV{\t\220i^\214\314\314"
+	.ascii	"`eC\312\223k\257E\346\214\351\250\223\361\264\273$\f\017/\244"
+	.ascii	"\225I\213\024\221B%\212N\022\"=\034\315\217\324 \305\300\210"
+	.ascii	"]!\001\201\233\250\2210\310\2243#\"\"\"\"I\222\244\003\201\005"
+	.ascii	"\304(\347\244\262\035\022`\2249V1\252\2044I*[\373g\225\272\244"
+	.ascii	"\213\202I\327\005nI\353\027\332"
+	.string	"\361\264E)D\351!\357b\006\322I\354f\032\"J\034}\3712\023\265g\002\200\004$\031\321\266Z\t\312\237:dS\r!2\034\242\377\214}\214\304\336\233\212\207\347\274\364g\240\023\215+\346\213C\037\001K\325\\\202c0k\217\006\224i_|\203>\235IH\003\315\332\255`Oo\300\336s&g89\356\366\2166\204\345\222\236\233\"\350\317~u\234oC]N\365\024d\344L,\201\221+\252\241c\3044\265gx\361L\202\320\360\204\204@%\242\3535\212\312\373\247y\277\342\246\222\267\302\202\222\341\022\272\243\251\372\\\034 \353\207\337\016\335\0255\350WNL\337Xk\211\360\245\031F\020\211\006z/n0p\3133\255\352\267\334\276\226\037\024fi\232\236\374\371\350\352\206\266V\306\200\270~C\257\222\034\231JFm\032s\275I\232\364\225}\246\252\300F\234\342<\352\317\033VU!\034%\353X\301 \247\347"
+	.string	"j\211\225\336\243?M-\307G}f\263\252\277\277\266\f\370c\177AW+9."
+	.string	"\2019\257$}}\216\263U.\022\025\030\332#\t)\323vM\236\306\265\b\\\201\377oy\230\270\352\225\237\226\311g\320dJ\213\325\025\200\365\327F\03738\305P\"\235[s2_\362\314\013\305\220\270-\241'\320T"
+	.string	"\226\267\215\0215\345\272kl\221\370qm}+\367\205\017\215\376k\001\305\263f\254\337\305\tF\025\361\236\333sU7\347\226>\004pM8Iye\312\200\205\355\224\336pEE\021\304\202W\225\240\243\020\n{m\3427hh_\035Y\341$'N\304\004\027\375\247$\273\250V\022i\320G0J\017\315tifZb\372\260\223\335,T\214\t\364\323\273R\316\030**\335mN\203\272\250&\240sI\330\254${cD\b\220\302\006\366\023\033\204\354\340N\006f\264\214Bm)\004\311\361\267\246\234\210\020\350v Vq\375c\221\204\267c\260\b\220\347Y\255{!\306\357\216\257\007\210\321\0340\301\206\004\300\334\277\t\265s\300\322\343\0311\241\221\013\330\206\3041\001\2226\033\375~\002\327#C"
+	.string	"A<G1w*:\032F\362:h\341\235\253=D\267\312\200s\0171f\210ws\324o\344\017m\323\202\316k\254(\242\300\315\225\214\313\314\356]\340X\221x\301\301@'\036)N\030\2630\260F\276\341\377t<"
+	.ascii	"G\336\315:\361\265tT?\353\034\262\362\270\315\036z'\320\221\312"
+	.ascii	"A3`\245\220\222\363\312\013\317\356\262\346\217tf\354*\f\211"
+	.ascii	"\341\001\036\017>Q\366\341G\343g\3005}\250rr\274\236\302\013"
+	.ascii	"\343\253\334\353\213\272\330\302\327\234\253\260\317\347\342"
+	.ascii	"9\201\025\270i\245\n"
+	.text
+	.section	.gnu.lto_.symtab.8dc18ab0a0aa171e,"e",@progbits
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8dc18ab0a0aa171e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1978 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\013"
+	.string	"3"
+	.string	"@"
+	.text
+	.section	.gnu.lto_.icf.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`.\003\345\023"
+	.string	"\204\032\"\004"
+	.string	"K"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\212\215\226\271\004\n\002\002\002\004\002\005\002\006\007\002\007\002"
+	.string	"\002"
+	.string	"\007\240\342\234\212\n\b\t\352\263\360\321\b\n\350\373\222\243\013\004\002"
+	.string	"\002\b\013\253\214\322\203\007\b\t\002\n\002\f\r\016\017\020\231\212\366\300\001\013\002"
+	.string	"\002\004\022\242\264\360\361\003\b\002\f\002\f\f\002\f\023\024\345\241\277\201\t,\002\r\005\002\016\006\002\017\002\020\005\002\016\025\026\242\302\263\302\013\031\032\033\306\327\333\227\013\f\017\002\017\002\002\002\034\035\036\037 \231\233\302\213\016\002!\"\323\331\354\253\b"
+	.string	"#$\256\334\323\366\007\004%\337\260\247\342\003\016\002"
+	.string	"\002\021&'()\211\276\343\032*\264\370\341\227\005+\361\316\362\273\f,\022\002\n\002\023\002\n\024\002,.\350\300\306\254\005\002/0\274\205\242\255\006"
+	.string	"12\354\301\314\336\005"
+	.string	"3\252\252\341\245\004\b\r\002\r45\365\273\261\345\005\025\002\026\002\0266\202\245\236\333\0067\274\201\267\213\0078\205\326\204\336\017\020"
+	.string	"\002"
+	.string	"9:;<\267\205\240\220\r\026\027"
+	.string	"\027=>?@\274\351\253\222\001\030\r\002\rAB\323\343\357\213\016\006\007\002\007C\312\267\354h\002D\275\250\276\313\004"
+	.string	"\002\030\002\004E\304\264\335\245\016F\002\002\002G\223\335\346zH\311\327\306\335\013\002I\317\356\361\267\004\002\002"
+	.string	"\002\nJ\342\201\222\246\004K\361\246\255\314\006LM\312\274\242\261\005NO\240\342\234\212\n"
+	.string	"o\250q=1L@)\205)\024\332\fp\002bS\304\016\021PiD7\225\302\326\001w\314\222\004\375\324(=\376\244b\004%\023!\351\203\224\237\032\321\230\005"
+	.string	"Co\254\367\037\245\004\"-\026$8\025>G\2313\225M\251\f\276v\0203\207T\t\362\020\nH\376\340\234\030AY\036\020;<J{j\0272\212\004!\0172\034\225\220\245\200\024\344\317eL\315z\245\371\250\304jp\024\212\013\322}\376\337\363\332\216\021\234@\326\215\215h\360)\254\346\357\245\232?\363\330H'\276\335O3\225-P'\336\2545\376"
+	.ascii	"\276\t\373\226\302p&\300!\036\366g\374M\342\204\004?\254\200"
+	.ascii	"ZS\231\260\233\232p\311\356*,\033\246\356\233W\177Lm]\373\\<"
+	.ascii	"\247+\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\365\005"
+	.string	"\362G\026\031@W\241\003\3030\f\303P\317\032\t\3236I\277:\321\337\377!\261r\247\024N\321\f\201\3523=\235\311y\243\321wf1_,U\321rS~\262\222\215L\310|\250\243\261P\234\360\021\373\240^(G\230\223\203zi\222^ui\031\252J\260\022`o\001'\253^\206\217\002/ `\002Qx:\033[\224e\020\ni\364\206V\213\210\367h\314\340\323d\\\240\013\f\220AYt\265\260\360"
+	.ascii	"\310\366\302z\312f\201\035\003\241XhU\202\310q\361\260a\020\344"
+	.ascii	"\\\003)\215n\031\275\202\245A\230\372\022nF/\027Lx\223\330\033"
+	.ascii	"F\t)#\342\302\223\323,\\\013PL\003\337V87"
+	.text
+	.section	.gnu.lto_.inline.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\351\006\205\032"
+	.string	"\266\244\202I\240TN\032\003\b\257g5\307\226\0130\364\026|Ha\301I\344w\240\007h\026\252\263\335\225\026z\367\2118UK9zt\336(\263\354Z\030O\341\321\222\343\352\317'q\323\227\302\340\221\273\355G\276Gl[\"kvo\271Sc"
+	.string	"o"
+	.string	"t"
+	.string	"\323\032:miy\351\355\245\267\227r\230b8F\240\\\234\212\177\233\023X\231[\371\277\310\334\356L\227\276\331\344%e\343v\355\267\300Z\253\313\376\374-S\2555\3002:G\324Z{~\2768;\304\210(\230\202\263C#\242`\311r_\233\255\265\326\331\377&\3278\016M\366\345o\216\3438\254=\202i=\002_\223\363\200\362\245m\342L\341\215\037,\236a\r\"Ic\235\362\267'Yq*n\230UAEW{\3146\333\004\006\344\n\367S\324\004\326\245B\177\335\312'\251\333\020\377\324\001!gf\272\025\261l\351\333\252\240\242\250\3348\333\354\355\323\224X\021\334\211\261#@\270o\343f%\364f\002\227r|\345r\226\210\306XRn\222y@\331\364o4\032SFP\270E\373\233u!\344\364B\200\327\017.+\224!\374\211l\036\2607}\324ZqA\255!\250\224\0378h"
+	.ascii	"\303`. "
+	.string	"Y\0360gJ\371\b\001\343\371\260[$\300\220\316\372\345h\034\303lR\343\030\006`\005\277oN\325Zw{\362\201}\205\213N\334\300%\264\300\374\255\260\326Z\273\245\303\372v\006\320S07\377\335\312\345\362\2671Z\260\020BY\027\377\262if4de\3000\263.\374*\276)\334\202\217\021\245\035L\266eL\326\267<\216\224\202\330\256\360\333/\255\241(\032\017;.\231\020\302\034S\263ZCPStQP\351\370J0\177\226\225S\230\261\254\316\033\304\304Ub\367\204y\342bo\273`XQ\355\276\365\3209\243++\241\344\312\356\310\227I\231\331\312\352H\025HN)\006,\301F\354-\355\b\001\200\225\250!5cD\344\204F\n\222\244\320\001p\002\031\251)\363\022`4e\303\2401\b!\242d\302$\005\345Qx\212\004j\330\037\303\370U\211XH\240\260\342\220\335T &_\rV\353\347\223\226YZ"
+	.string	"\235\205#\030\243n\330^>\264\3438\221\345\375\017\025$\004\363\337\320\347\272k"
+	.string	"K\210\2675\274\023\320\264\033\017\256\234\341~\265\333\240Ea*\243O^\231\230\313\372)\334$\022\013\314zb&?*\262r\301\300g\363O\324#}\343T\337s\216\263\tk\007\030\034\200\322\235\t\361\325\263m\230z\013\b;d\351\274\343%\036\366\371p\311\313 l9\301R\216\346\363\\\016v)\246\233\345uK"
+	.ascii	"\236\367\203\023\270\360`\200*\232m\264\032\022f\337\244\037"
+	.ascii	"\3719\375\020\336n\302\217h\266<u\254F\027\0249!\313\233\300"
+	.ascii	"\027l\027\004\222,\312J\021p\255vJ|!\207V>n\247\357\n\020\271"
+	.ascii	"\224=Xk\204\036Z\3011\341J\303d[\324\313V\321\330\217zK@\037"
+	.ascii	"\3423:Q\303\252sh4.\265\277\357A\210\3428\212<\262\342\356!#"
+	.ascii	"\301\376\"\314\005\303\242\3616\330\313\261(LY\210\311\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\375\002\215\016"
+	.string	"v\325D90Q\222t Q(?\256\003\203\237+Q\327e\304G\204\032\030(\025\223;E\340\220F#I\017\3239\330j\021u\370\177\364\321\350\327\326\f\361\1776\264\275\277\021K\210\224)1"
+	.string	"4"
+	.string	"8"
+	.string	"\227\250z\217\246\244)\2319aN\312\026\334\306\272\260L\255Q\221LE\302\377T\245\243\017\3505d+O\211T\201\344\364\250O\266\211\354%r\221\023\216!\024\211\2124)(\372\307\2313H\031\\\353\203\320\232\320*A\372\001v>,\026\336\212\210E\214\307b\265\017 \272\331\b\203|\301r\021!M\352\310s\261\312\226\236"
+	.string	"\t\321\365\246\265\326\372\224%#@\020\376\301;\370\006\317`\306 cd&\0224\251\032\244qCE\n\366\026Z\313\201\202\261\023!U\177\341\002\004\377\201\035\003\377\001?\210\377\340\301\351\360\0346\331\204iL\273\260\362\033^\303?\031\034\fwj\362\351y\220\2750\205\302\221\325SkJA\017\244\302G\201@\017\232p;v#F\232TU\250\2614\254\034\232\031\242\302\f\233\001P\002a\314\210<\021\300Hf\fd3\243 \005)f\r+"
+	.ascii	":\201\"\250\277oNJn\350\3608\324\230\226\023%pe6/\241QX\340\227"
+	.ascii	"\225\033\226Q\235$F\264\377\232]I\004\312\245oE\314\fH_\035m"
+	.ascii	"A\366\243\305\013=U\240i\t\b\260\376-\"K)v?\016\263<*\031Z?["
+	.ascii	"R\333\215\037\027p\311\371\252\300\203\273\275\260\335\2463\177"
+	.ascii	"\302\223\205\005G\325\234\350h&\334\222/{\030\237\376\240\222"
+	.ascii	"0\227\312\032\334\270~\235\013%\253\342\226\001\356\226#P:9\231"
+	.ascii	"\322\340\b\304\374\200\255\213\327\320.R\325\316$E\356\302\004"
+	.text
+	.section	.gnu.lto_.pureconst.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 w\365\002"
+	.string	"r\207\026\033PW\032\003\203\252rd\214\314\314\314vw\377\314\263\213i{\004$\353?\004k;\036\311\033\271\310C\036\310?\236\307;\316\361\215k<\343\030\327\305-ZE\243h\023O\342E\234 \256\2077\234\341\013Wx\302\021N\0077x\301\211\340\003MM\240\005\\"
+	.string	"\227r(\245J\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`5\0025\n"
+	.string	"\322\215&(`\2132\034P\223$I\222$I\302\020F\274f\034\260\025\231-\277\261\343DI/a\330[\317\214\220\233\340H\310N2\005N,0&H\265BG1\241JD\250C\250\357A\0354\263\343<\r\356(O\312w8\323\360\r\245\033\001\322:W\333<5\217\241,\233\234fW=\253J\024M\341\361|\274\b\231'f'yJ\246~\n.\317\313\213\300I;\206w\350\300\304\241\3334xZ\274p\001\310.\362\214\354\246\347\302NzA\317\226\372_\231\220g\3642\346\201"
+	.string	"\272\022\002R\250!Yfnf\232Js@\002\202 \"\365\021\200%S\316\330hAZ9\216\025\316u\252"
+	.string	"k\243\270\026M\353\374\225\024\310\307.\001@so\216\300\221\t\277x\013r\336\342\331\210\201\230|\321V\335\2264Q\263\306\3156\013\367\314\304\006\2629b\364\260X\205\342"
+	.string	"U\346\315^2\221\272\262\266E\237\374\002\321t2W\"\006\353a44_\316\201m\246>I\355IQF"
+	.ascii	"\274\177\332S+G\215'\032\357\206t\307\230\271\032\263k\242\240"
+	.ascii	"\353R\343\360\370\0133\363\024{\315\232\001FO\031\203\266\006"
+	.ascii	"\371.\020\345\025\017\274R"
+	.text
+	.section	.gnu.lto_.lto.3a29fe01c06e311a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.78.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \215\375\003"
+	.string	"\024\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\377\321\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\325\030us\336\007uq"
+	.string	"\005\001\006'\001\020,?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.79.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`}\001m\017"
+	.string	"\206\235hF\360\260(\035\363[x\342c\332\304xL\363\351\322|3\363e\246\363 \250f\256{m;\020\264s\257\244\334Z\035\341w/\320\354\261\005\217>\022\007\223I\222\374a_\002\"*L\034\255\335\344\274\026\344\223\275\345N)R"
+	.string	"P"
+	.string	"W"
+	.string	"\335=\270O\237l\033\017\301=\255\003\n\355fw=\035ay\031\3362\236>\245\306\223\357r\020\360\306r\241>%"
+	.string	"[K\210"
+	.string	".\016\222\301+\306\366\331c\313\245\212\222%\345\372\331\023\2003,W\312c\007\302\356:\262\\ n\356\266?\333\017\354\277\004\236\307\376\316e\267|\264\306\350\030\243\377\361\250\314@\360b\327\303\rgi&\214\022\227\335~\350\317T|\305\3512\313t\250\017\035\f\255ucwC>\355\240\373, \377\261\375h\037\305S\234\036;\371\200]XNm7\\`\220\356\323\341?\270\317\340\314JE@\255t\027\0354^n:57\341l\fgab\240fw\033\3700\246\f\004@\022\237\376\t\367y"
+	.string	"\304\221\2127G\355\250\352W'n\031\3345\352W&T\361f\251\327\317.q\300\032(9\251xS}\305\330XTW\354\020\025\025fky\325\2540;\242\227JD\022F\244\221P\311\b\024\201Bh4\002M\0301}\037&\0211}\236\351\363F\"P\005\217\344+y\"\036&Y\b}\336\005\022\351\363>\341^a\276\313\273\026\"hR\252\232\272\342N\f\365\250\332\304\220Km\331\226\341\244>&\263\331\020s\\\356\356J+\270T\217j\b\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.83.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \215\005\004"
+	.string	"$\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\314\222\021\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\366\030us\350\375\007uq"
+	.string	"\005\001\006'\001$+?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.84.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\366\001e\022"
+	.string	"&c}I\320\362&\035*\034\331\\\023\216\227\005,\320\273Q\023\005\n8\205\t\244n\027\001TK\245\017v\306oN\320@\273\315u{d\021p\326a\243\261\320\003\360\305\003\300\237\243\326\036\b#&\206\004\315%W\005m\021\262\367\2262\311i"
+	.string	"c"
+	.string	"k"
+	.string	"/\241\237\013\333m\272\370SO\364\201F\004Uk\375\232\304\n\270\024\277\224a\357\350\224\315\260\375\320QJ\350\250\2056\357d\237x\312Q\2054\311b#\007\310og\234P\3064\245\202\347\323\303\245d@C\004\021U8\223\252\024G\262\2210\003\367oW"
+	.string	"\244T\013y\316\335\203Z\353r-\354\360\365\276\273:\273\313\262\313'\001\\ H\017\322\266\317.\311\205\376\324\344\355>~\251\344\235\347\225\315\333\315\313\314{U*\007\217\004G\265r\310\r\251H\363\006\212\217\337\275\270\277\301x\f\330\307\305y6:^\021\021\b\037\265\326\224\317u\340}\032\220\037\331\335\363\356\203\376\002v\241\032\223"
+	.ascii	"u6\346\324\250UTY\024\357s\305\017\240\237^\030\200\224nBt\275"
+	.ascii	"\353\272\021\200\236\030\347\344l\033Cmp\341$\333\007\302\216"
+	.ascii	"\220\261\307\214\243v\366n\205\313\230A\360Skm\260/\272\360:"
+	.ascii	"\260d\342s_C?'\256\366\343=\233@Rw\252e\377\206\005\177wP\356"
+	.ascii	"\356\337\254\240\315-g\320\212\3048\267*\247\375\376\355.-\200"
+	.ascii	"\234hA2\316u\222\006\245\021\335\266]Q\026\254\277\"\260bZ\256"
+	.ascii	"\026\031\230Vk%\241\005&f\365\222a\255\\h@\223}Y\241\001?\032"
+	.ascii	"\360k\261V\023\276\027\360\365\255\224\254\213\002\f\370Yp\271"
+	.ascii	"\300oD\214\275}\206\356\031\341\220b-\353\332\266\035\323$\351"
+	.ascii	"f\342\224\323\306Y\034\245\375\355<\215L3\216bYk\255\264m\313"
+	.ascii	"\362\3443\224\227p4\365\374\f\355\032gw\301i\223t\" @\002\204"
+	.ascii	"\030\026\017a`\357\035\232\033'\313\312\342\276Q\0205\312\244"
+	.ascii	"\301\206\360\013\350kLz\f-\370\252\235\265\335\377Va\343\231"
+	.ascii	"ZRh\016\250%\344Vw,l\320\315n\fPen;\233\260f?\035\3552XDv@\364"
+	.ascii	"\220\365}#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.85.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`r\001]\017"
+	.string	"\306\034hG\360\260(\0358\205UV\367:#q\340@o\025O\274\211'\261\257\353wsp\2064\226<\022\264s7\356\263Q\207\310\273\2100{l\301\243\217\304\301d\222$O\332\227\200\360\"n\034l\375h\0363\322\310\336r\247\024Q"
+	.string	"P"
+	.string	"U"
+	.ascii	"\334\247S\266\316A\023\373\231\313\207Y\317\356zZ\302\362\022"
+	.ascii	"\274eL}J\215)\177\346!(l\260\\\252O\031\300\026CB\200\313\203"
+	.ascii	"l\360\262\261]\366\330r\255\242|Y\271^\366\320\t\036\226k\345"
+	.ascii	"\361\023aw\035Y.\0217w\333\237m\b\366e\002\217\375"
+	.string	"\362\341\035\037\273\017\340#r\204-B7vA\334z,\316\234\241\342\341\355\203\276\354\305a\244\036\272\326\251Bt4\263\024:vW\364\351\007\335g\002\371\017\333\217\366e\356\"\365\330\311\001\002\233\022\266h\273 \003\207t\237\006o\200\373\354\016\022\221\307\345\356\256\364\202G\005ih\207\n\313\301_;\025\311PY\261\2127\017\240ix\r\b\246\006\013\177rn\302\331\033Nc\322\355\256\003?F\007\016\br\\>\375\023\356\363\262+\200\271\351\331A\2117\325\227\215\355E\265\305\006UQa\266\230\027\315\n\263A]\245\227\224&\230N#\244\022\323HB\005\222\3114\2420\202\372\n\230D\004\365y\250\3173\225F\026<\222\017\203'\002\342\323\005\322\347e8\235>\357\003\334+l\346]\r\017\016\212\256\246\266\370CCA\212\252\351D\321\243\266.;h\347\206E;\265\214R\257-\327\270\250\217\2058R\002\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.86.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\005\b"
+	.string	"\362\21678@o\323\001\230\265(u\314\2570u\2431\276\233\214Y\027\035\337cf\275\032{\215d\026\366\026\t}\022\215\302\361d\225\222H'-\256\r\203\3346\312\350\377nBdJ\001\021[\327\201 4\315\003\347\320y\f[\210\023u\024\r\237\f\260\346\371d\374d\3548P(jr\"z:\366$6\031E\236'c6\367!FpQ\221\3549\322\ne\337\332\352dk\306\341r"
+	.string	"\263\2331#\263-\327J\210m\320\316l[j\177\022\300\237T\234\263\244\227\217\217\252\375\222\233\200\237\026\027\330=\305\250\354N\004\027l~ynl\373#'\001\035\352\364\320"
+	.string	"@\2450Rbvg\344|"
+	.string	"\373\245\357`\277\252\216\207\327\320?\312-\021\020\226\222it\325,\354\256\265d\332\270\253\3336\260\255`;\025\f"
+	.ascii	"2\003\202\341\243\302^\025\220kx\227E\3531\241\301\\\201\n\007"
+	.ascii	"w\215T+&a\222\001"
+	.text
+	.section	.gnu.lto_nullFrameStatus.87.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \367\355\006"
+	.string	"\242M26@o\222\016\230\265\224~\346\023\300\320\0312-\200\\\nY\340\274A\202@f7\007\346[\224\350\270\251\376h\005\322\327m\200Qx\2138\337\370(\344l\354f\033\221)\022YDHs\370\2002Q\250\342a\004\005\366tF\360\215\340\013e\020\240\347\201\024\257\303Y\233\370\300'\3224\370\260\230\335\256\202\213\n\343c\311U\035_Mf\346U\352\035&\342\202"
+	.string	"\223y\232\221\311\026\213%\344\357Oz\354w\356K\322\022RM,:\220\231zY\311\214\t\033lj\035Kp\325\332\224s\325\372_` \2755~\234\0022R4Pb2\343\253<\272\325m\267'\325\214\200\250\230P\245:\200\206\314\334\231P\033\275\352\177\360+\374\034\001\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.88.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \371\005\007"
+	.string	"\002N36@o\222\016X\320\2751Bo\211"
+	.string	"4\206l\005\230_\300\341\337&'4j\27390\337\242D\307\333aG\225\030\353\276"
+	.string	"\211E\300\267J\3406\355g\366\r\021\"S\022\243\210\022\326 \"\215L\245\n\207\023\0248\004:\301w\202\2574\202 \275\020\244x \317\330\204\b>\023\206\301w\314:\326\3156\005\027\016\343c\2529\220/@f\346\216\365\355\201\243%\363\211\311T\325\320\244\313\3052\362\367G}\300\337\332\267\244&\250\236Xt \223\005\263\222\031?\033tz\035K\260\351\325\251g\323\353_a\001u\326(\242\342d\264h\244\2642\343s!\315\332\262[\224\036\220\314|\274\250\254Rm\034\206\314\274m\254:\272\353\217\360'\374\036\001\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.90.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`=\f\235="
+	.ascii	"\252jP\027>@\350\316\0306\213y\361\225n\025\353#\304Y\355\031"
+	.ascii	"\227B!:z\035/7B\021-\242\317\345\034KC;P\267\223Q9\377\310U\006"
+	.ascii	"\240O;Tbb\304a\374^\331+\267\2242\245\224\002g\001L\001d\001"
+	.ascii	"\252scX\360hM\255\212\340\363=_\263\350\243WO\205\243\245\357"
+	.ascii	"\272\333t\327u\237\351~\262i<n\333Hqs\363\276/\003\266\201\003"
+	.ascii	"\267\357rH\201=_\263V\255\316_\023\360}\237\nX:n\2734\255\306"
+	.ascii	"\355\272\035\354\353\206-\253\313\362\367\276\317\003l\253J\316"
+	.ascii	"\243\351Xkn\016 s\3171\267r\334\266\252\364*\333\254l\341nr\233"
+	.ascii	"\341\226\333\331qn?y\216\224\362\371\242m\325\251i^\265\312T"
+	.ascii	"l\253R\355\264\266\232v\323\332*\373\350&_Q\201\2565\337\367"
+	.ascii	"m\325\326e.\324O\266\267\323<\"\243\003|\3377\353\253\034\217"
+	.ascii	"G%f\352\364\331\234\276\333N\307&\246%\245$$c\261%\016Y"
+	.string	"\341\252\246\357.\267\260\202\021<\260v\302\322G,n\336t\245\231R\005\177o\026\365\336\331\225\324\311,\313\262\337\254\370R\372b\200j\275w\326\226n\005\222\371i9%\256D%\215\255\223\2344\222q\255\213M\354\324\274\355r\306\304\211{gNR\251\271\236\352r\266\304\207r\235\300\n\227(il\315N\t\205\025\242\244%\351\025\t\215,\225z\033s5\375,\211\202 \241\211\245[o\202@\313\320\302<\345R\244\277\315\264\313\271\223\343\263C+\322.\254\360\276/\373\022-\255\371\251\231\273\n3\237`n\031\004M\310\225\302t\253T\241s\267v\333\326\377\364\325<cka\036e\005\316\354bq\265x/\377\255\322\304\350\205=\030\373\227\351>\257\244\276\367}!p\003j>\227\213\027\027\f\230<KD\375\376M6\230\364\250\230\366\343\222a\337W\371\200{\257\373\270o.\234\033\347\306\255\255\366\267\231F"
+	.ascii	"eC\306\371a\002\375\366\236W!O\232k\345\326\323{\270\270\335"
+	.ascii	"\330\302\205\013k\253\302\2719@h\006\r\013\3306\364\235\016v"
+	.ascii	"\324\324\244\361\360\001\001\210\316\023A\247\227\304E\227$J"
+	.ascii	"X\365\275o\262\227\314&:\316\211'\266\367}\037p\277i8(\270\335"
+	.ascii	"Z\345\024]\336\313V\271\273\326V\207D\242a|vG\222\036e~\206\371"
+	.ascii	"3\231\033J\213\031=\376)\314\027\270(Lh\235\267\372\256YB\267"
+	.ascii	"i\216`tn`t\3262:[u]\363\201>\323\\\325\317f*\242\363T\353,\325"
+	.ascii	":\033 :\027(:\023(:\017(:\013h\235\003\020\235\243\210\316P\254"
+	.ascii	"3\200\325\371\251uvj\235\217D\347&\325\231Iu^j\235\225Z\347$"
+	.ascii	"\325\031Iu6\266\316\305\326\271%:\023\211\316\303\2413\253:\013"
+	.ascii	"U\347\225uV\205\316\251\320\371Wg\017\024\376\300S\b?\342\345"
+	.ascii	"\344Fz\211\350\300?=\324\034\262\301\344\361\235^H\250\351\217"
+	.ascii	"\337\310\250\247\271b&\230P\264\263\246o\277\350i\344Lz\024\311"
+	.ascii	"\2074\323Op!\275\364LJ\277\264\240\223^\351\243\b\021?)\317\250"
+	.ascii	"\354\035+\322Sx\027\034[\213\352\035\253\361\221\276\307\272"
+	.ascii	"\024\337\370\257\210l\020\253\333/~\224\340\360\333_\223\254"
+	.ascii	"IC6\270\025H\346\247(\266\016\277\355\332\331\230qr~\334\bj\246"
+	.ascii	"\246%\376\360\337)\207G\351\201`^\266t\201\250L\200\374 \276"
+	.ascii	"\263\t\344\f\3631W\214]2\027s\201|Su\245\207\r\277\365\264u'"
+	.ascii	"\352srFt\205\254\354\177\311\005Rz`\231\277\256\020\016\314-"
+	.ascii	"k\315F\303\354\216\351\250k6\324b\266\245\257)\330\203.\032\021"
+	.ascii	"\327\b\222\265U\366{\256\023\314\321\341s\343\2042|&\273P\353"
+	.ascii	"U\277\265\301[}\031\263\025V;\3622\006\016\223$=\232\262\302"
+	.ascii	"\327R\322\200\214\204\337y\302o\360\256H\021t\375\246\013TD\242"
+	.ascii	"\367\267>\223g\254\352w\031n\340Ro\273MVf\327\211\013\305{\251"
+	.ascii	"~\277u\253\301\201\323S>\230\372L\026\372\375\205\177?\277j\252"
+	.ascii	"/\3439+\325\267S\316O\351\201\215g\305\355L\272\240\251\376\302"
+	.ascii	"\367\250\303K\013q\025`\033\024\354\002K\307WV\013\032.\260j"
+	.ascii	"x\255\230\021\003E\327WV\027\213\250\024(\\\005\n\367\272\001"
+	.ascii	"#\005\016\365Es\027\226\216\257,\035_Y2^\244\210\221\325\365"
+	.ascii	"U#\013\253\211g\320\360\372\312\2621c\306WV\373L\366O\341\021"
+	.ascii	"qz\311\017\343\251g\207sg\2169\310\274\274u\353\247\230\376\220"
+	.ascii	"\rFx\251\337\372\036\203Jx\251\227@W\307\337r\270`_\031\t\357"
+	.ascii	"|m\316$\2216\360\021>\300\237\261\265\002o\340\216\217\021S\340"
+	.ascii	"\033\257S2txd\234\037\234\300w\323\301 \373\260\356\305\277 "
+	.ascii	"\367 \371 \373\364Y\377 \37168\343\365\035 /O(D\243\201\314H"
+	.ascii	"AHB\336K\002/%\340\031\257\2370\263\312\367MV\r\370\036\263\023"
+	.ascii	"\340\005<\203\261\277\344\007\3706\344X\334\242^\213\331\206"
+	.ascii	"\214\2237\362\320\312\316\346m\310C\310DHE\336K\244\242\265U"
+	.string	"\225\356n\f\364\030\244\241^\005#\247\342\212\261L\250\277rk\256\3019\233\212K\236\036e\25044\006j\301\273\351O\272(P\201\256\275q'p\336\304\215k\003o\350\302\2264{\317\325\030\351\b)\350\275\344b\2347=\261\007c\305\306@az&\242\006\360*\372\005\300\376a\362l\364\267\224\304\365\357\307^u\325\261*}\337\367U\252z\256o\271N\037\331\345y\3223\271\221P1N\370\206C2\244\030\200\354\250a,\004\025ddfF$\310L\n\222\306\240\002\221!\"\352\006\020@\245\210F\222$\035_6zY\276\320\025\317L\270!\016U\233u5\250T\233\"~\302\236Xq\250\377\241C\025\245\335\247\261\330V\343k\320\207Zt\356\017\277\243J\201gi:\263\3549\321\212\311\r\346\225\033\035\262\\\026[G$\337\007\236\t18\220\021\022JR\350\2277#\335#\365_\335\262O\347\340\003u"
+	.string	"I\314\213\n\254\034w\023\323q\217%\310k\016\001\017\312\325\r"
+	.string	"\224\225kri\351\255\230\376\332\234\363\360\310\265j\n\326\264F\301\231\177A\312\240\325\332\trp\027\0022\206\216\300|\211\231g\3513'\3713\321$\365k\265\037\020\261s$a\224\254\302h\375aO*\242\274\n4\363^\377\270\021rw\317\017\377\314\354I\307\300\224y\025\300`\276\316/\312\377\225n:\r\241\376\205U^\335[\224\345\246\036c\343HZ\355\bC&\255@R\357^M6\373\210\253YF\361O\335\031\016\212\247Qxg\002\323\177ES\231\002\265)\313\021\020m\n\262\274$\357\375\342;\307\324>tzp3"
+	.string	"\365\201\nM>u\204~g\267\234\226\017~\371y"
+	.ascii	"\204N\226\335\246\004\311\236\227\232}\002c\207x\345\364P'3A"
+	.ascii	"\212\200\035Z\346\304\331u\341\236\247\326r\317\304\354\360\332"
+	.ascii	"S\354U\354p]\370\206i\0226\303\350\037p\252\306-L\034\016\346"
+	.ascii	"\371;\265Z(W(M\030`\277\342\230Wq\205w\024E_\032\361\30408\b"
+	.ascii	"\"\006 \250M{\332\201=f{N>\252]\037G\266m\212\303M[gq\312\263"
+	.ascii	"\334\272\036eh\326\240\346o\3118\306V\215*\263\235+\226\244\272"
+	.ascii	"\007\202p~\031J\005"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.91.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \3365\006"
+	.string	"\202\013+3@o\222\016\230\016\303?3q\034bDs-6\237\203&\356m\336$\342o7{@h\204\004\"v\236s\f\b\037f(\270\321\352;\347\352omo\231\002k2\233\3066\215=4,80M\213`\031\201)\b\206\306$(\2521\314\225E\321!\301\007)\276\"\035\251\256\307\023\234\253\325\351r.\235\016\0030>7\372\313s\230\361\225\022E\377}8p\262\242`\222\t\032\265\244\312T\362\361w\036\363\001B\347\252\327\006\250\035\034\025$,\231\027C\215V\275\3526\244\022\bJ\212\025\362\364"
+	.string	"\0222\363\263B\027\035\373\033\374\005\277E\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.92.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2PO\222\016 Od\201\206\233\303\036\323\213\216\241"
+	.string	"\212tcq\361\267\206\265[k\316\352\314\324"
+	.string	"\3420U\025\021u7V\350\263"
+	.string	"\205/C\255\355-Sg0\232\3064\215A80<\260L\223`\230\201\247\210\206\306&\246\251\261\213\225\305\320a\201\007+\276#%\241\256\307\024\233kU\351n"
+	.string	"*\035\ndx\356z\253s\250\361\215\022C\377}H\260\242\262pe~\256\226L\221N@~\316_FH\340L\325\342\370\264\343\303\242\204%\323b\270Q\252G\335\2124\nA1\251@\235^\200Bf~\025\b\243c\377\203\337\340\277\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxPwmPpmSignal.93.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*pm\032\003\240{c\343\304\017\n`\317]Hj\300U\200\375\330\234l<1\023c\352B\225\235^4F\343yl\340\b\355-S[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\324\267\032;\003%V\376\323`\324\274\0026v\017\013\031\221b\264{9\2316\024"
+	.string	"u~\245\316\236\244\037g\365\343Y<\245\335\225q\243\231\302lUO\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resumeRxPwmPpmSignal.94.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*\200M\032\003h*D\210\264\320\213\212\r\260W\213&@\361\210\210\301\261\r\2076\210\fHh\206"
+	.string	"\336n(\022\340Ak{\313\024[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\224\267\032;\003%V\336\323`\314\274\0026v\017\013\036\222\342\333\275|\247\035\005D\234_\251\263/\251\267Y\005\205,\037\323\356\312\250\321La\266jG\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setLinkQuality.95.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\372\002\345\025"
+	.string	"\306\250\215I\300\322Q:R\224\370\371\337\254\345\321\204\274\341\235\033\351\336\375\004.\227Vx|\326\001\005\330\267lZ\213\327l\263m\177g\262,Ai\325\333\027H\020\n\202\240T\005\213A\355\023\341\215\377\244\031\022ti\277\021B\b\2212\245y"
+	.string	"i"
+	.string	"|"
+	.string	"'\343\305\360&\343E\253\332\006\016\334~d\203\362`\357\210\306\234\275\025\017(/\372f\377x\017\304$GX\340Q\242\232s\276\366\303o'G1\\\275\371G:+\247\2739\311\341c\250\002\204ij\344g(w\337\216\212\032\036\216\350r\302\2249\247K\247\243\033\252"
+	.ascii	"\335\310p\337\325G\307\023\236<\005\3718\322\265G\207S%\027\314"
+	.ascii	"9\255"
+	.string	"9\035\206\273\274m\034\333\n\354}\005\372\334E\337e\274\370\025U\2700\332\341\350\225\335\273\321\345\331\017\347\n\331?\372K\336\373IXj\021U\273T\335R5\253T\227\245\232,\325c\251\026Ku\250\352U\265\222\352\243\004\b>I\370\315\371s%d\002\305\030D\243\212\032\352\332\267\357\263]w\331^\265\177\342(n\357\331\314\232\323\003\025\2149\347\212W\312\213)\017\264\361!\232|\226\274:m\024\331\036\333\036/t\270m\334\025PD\224\224#G\255L\256\323O\033\307%e\320\214+n\230Q\265\023\227Id\303\025_|\211V!\026[V(.O\375\323\371!\021\336f,Y\225\242\240\244\250\335\026\317I\221\254\356\356w\200p_q\0266\031\231l\274\250{\337\tL-U}(\007\004\334\345Y|\313\370\205\220\004\225\243V\366S\\\251\305\027\341\231K2\332\314\001l\346E\306`\006FV\253\321\304"
+	.string	"\310h\260Z\203\b\263\027\030\205\226c,5\265WM\355\0053\203\321^\261\232\314\213\305\3041\023d\265\327LLL\355\345\352\315\257\020\322K\033A\2008\213#]\273\303&\005\274\233\306\326\272\236ZK\226\370U\355t\374v\301\032\307!\362p\242\n\226\250\370\002#k\355\0070}\316):{\343rY{\236!\344\212[n\202\250\036;&pze\004F:\250qy\326\320\017: \260\002\021\251+\017B\003~\216\261*\307\351\310^\375\032\263\230\230\256=\203\243f\004\tn\035\341\366$\310\272\305\334\350x(\213\261\303\217\001\313\301Y\225'\266aE)\003;8\303\267\306\214\341\206`\b\313Hf\347\332%X\264\231\214,kY\301S\344u\224\356"
+	.ascii	"\007j\r|\300\320\354jYG\231\326b\206\363\037N\361\301\004\350"
+	.ascii	"\016\203B\213cH\347b\260\275\265\342\024\352\f\2150v\256\tvu"
+	.ascii	"3"
+	.text
+	.section	.gnu.lto_setLinkQualityDirect.96.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\342\f/3`m\322\001@\203\007rBIeC\363Cmq\376 =\345\214\212@vN\376h{:\260o;c\215\032\204&\013\17773\266\317\260\255\177M\273m\231R\034\220E-@|*\213\0029t<\225\205\351F\023\202/\004\237\247\242\030\336\006><M\246W\003\007\276\317u\301w\311\356Fj\201D\233h3Q\266\214\326\226\377o#\265Ipa\322A\371+VT^\342H8\332\372\3226\263u\311\035\321\036\021u?F\310\310\237!\324 \300\016\343\201\311.\235\231\354\032\333\023g\033\267H\211\002$\345\377k\032\216\316X\373\303\002#L\344\004P\370\337\034a\026ns\333\203\266\tm\261\007"
+	.ascii	"2\003\3169\003\027\016]\306#VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.97.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`x\006\215$"
+	.string	"\326\177\340I\200ZN:9\354\022P7,h\207\347/\342-Fs\327\305#\206(5\004\315\216\0319\335\364\232\367\321\234\311Yn\332\352\277e':\207Xf4\030\033\350T;\325\334\2775\302\027\362\362\357\360=\335\032!\204\020\"w\222\001\316"
+	.string	"\271"
+	.string	"\312"
+	.string	"BR\312\273\225"
+	.string	".M\362\350'?P[\311\"\356\311\275\367"
+	.string	"#P\177\262\265\314O\336,\352g-x\275WG\362\311\275\312\003L@\375)t"
+	.ascii	"\350O\363>\364'3s\002\005Ql\274\222\307\326\311\230`\245\245"
+	.ascii	"\271W\371k\261\033\277\243\223\203\323\273\341\355t\253\232\242"
+	.ascii	"\247\331\326\310O\035\2345\326\314e\035\245\276\363)\037\327"
+	.ascii	"\361\221\303\243\207\305\271\361\236\371\203\274\022\343[\270"
+	.ascii	"n\230FZv\300!\355\215\215\363l|\331\035\362:\257e\r\273\016\351"
+	.ascii	"\200A\343\352\026.\032CC\270\272l\252;\3168*\343\347\225\225"
+	.ascii	"5w\307+\266\333\027\307*\333\275#\226)t\357\275\222[\255#\225"
+	.ascii	"\265\251\203{/\333\254#\214\263\357\314\277\300\314O\314\347"
+	.ascii	"\217\214c\317v(KW\373r\357\324\263\236tO\337\013GUK13\360M\202"
+	.string	"\352\275w\001\177\311\231\230\340\217\375d\341\222}\326\022\372\363}%\267pec\220fgSv\216YIe;\214\371\346m0f\325\262\021[.\"J-\017]\371\007\375\354\007Z-\377\254\226}\276v\356Y-\363\254\226}\252e\336\321\316;\266\254c\313\253jYM-\247\251\3453\265l\246\226\233-[\324\362\0130pC~\2215i/\312\2735\307\346\272\235Q\200|\355G\273ef\343#\341+Y{\032\021\347\226\341iWc\336\361\212#a(\2631dr\005\363\356\247e\216\342/y\307G3\006Ft\035\306:K/9\326\016s\373\233\021CR[\222\0132ifJ5Q\242\376\362\023\310\234`9\261o\373\256\265~\222o\346O\332al\373m\267\347oDS6\363m'j-\333G\267\247\201_\r\231\027\346\321\325\326b\026`\203Zmf\r\034\354\263\270\227\305\313\315\252\245P\263\263x0\273"
+	.string	"u\267\331\277BR\335\312\257|"
+	.ascii	"\021\"\004\372\263\373&I\332\221.V\336{\317\016\363i\b`\252\354"
+	.ascii	"\232\377\336{M#\352\223\333\"%\367\246\372\330\346Sy\025#\177"
+	.ascii	"\214E$%\241?\315\264\2542\227r\236\266}\266O\350\212C\2035\305"
+	.ascii	"\362\330{\257T?\b\365}\225\241Y\206\251\262k\370\177B{\332\327"
+	.ascii	"l\261\272\250\354\\|\002)8\024\026\177LM\303a\023\320\307\351"
+	.ascii	"\251\250T\344\020\034*\021K\354H\004U\b\203\300\340\006\024J"
+	.ascii	"L&\204N=\245"
+	.string	"\"\212`\204\034'\017\301\241\260C\221)H$>\001o\030\210\004E\374A\021\177LB\245\341\017Ht\372!\371\270)E\220\370+65\021\177;\345\324\315\333`ls\216nu\f\234\307E-4\325T\314\353\242>\272\323a\374\267N\203\351\032\202\234\256W\233\263\266-\262\fCf\355\001fI\2348\243\204\244U\214\212\0213=\303jKH\217\005j\324_>\200\2300Z\344\336\262\f\265Q\0138\203\325&m\240\036\352\253\335$\322eLY\022\265 b\016\327\202B\205\n\350\317\264\241\314\306n\332\300L\341\001\365\331.\226X\274\234\335 \311\006i\326\265\353b!\025s\022\200\214\250\221@\007\215RB\"\")LA!\215\001\300\002\021\241c\035\020H\306h(IcD#\262%\3611\365\374\031\177K\234\210\204nA\030r(J\030\276\206\277\231-\371\202\343\222\361_L\211!l\277S,\233\320E\343"
+	.ascii	"\345\016Cf\021\372\203\340\323&x{\325z\307%N\005\207\230\200"
+	.ascii	"\321\"\270\275@\242\022^\033\370\352\351\3050J\241\214h\001\365"
+	.ascii	"\bF\316^\247l\203\221F)\302`'\210p\031\272\021k\357tqeP=<V0\215"
+	.ascii	"4\216\334 m$HB\302\021UB\020\234\305_\232\240\013\371\272\251"
+	.ascii	"\377\230@}]\360\036}\001\240\336\375\030W]\263\373\314\t\341"
+	.ascii	"#\003:\336|\335\324\337\033Kf\320\242}\266O\334\025r\256\305"
+	.ascii	"@[\340\347\235!{\r\2017O\352\\Z\261\264?\210\t\362U\t\232hX\211"
+	.ascii	"\267VW\\l\370\201\217g_\265u\376\264\227I\241\037*mu^El\006\027"
+	.ascii	"t\027\256\370\271\262o\224\252\001"
+	.text
+	.section	.gnu.lto_getRxfailValue.98.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\216\003}\027"
+	.string	"\206\252\222G\300\030Q:5a"
+	.string	"|\270\215\002Y"
+	.string	"ZE! \235\257>\211\020\212\001I\bE;i\004\340g\321F\377_Z\204I\221\235\323\327\033\242\251(\004\336v\345+{\270v\333\202j\b\020\031\265\276\333>!\273\233\224)\005|"
+	.string	"v"
+	.string	"\202"
+	.ascii	"H\261\b\347\017\327Y\265\243b"
+	.string	"\343\266\216\215\262\275j\037@\240\363\\\314;\347m\211\2219u\006L |\264\355\337\270\220\216e\252\203Q\342\204\013\322\303c\313\234\272\025\314e\344\243>F>\356\213\313\036\2022\226Ve\376\354!\n\327\003\033\020%\311\323~\036?\364\007DN\260\2608\361\363\222\210\235\355\251I\031 \243\030'\023<\253\340\315\234\323j3q\3426\3356\n\333\n\354\305\005j\233s\352&\rj\305\216\372l\267\316\303\305 g\343&4\347N\202\343\260C|\307\005\023\316GF\023\2419\247M\216\353\300\361e<:\303\006\275\355\321\177\255\351\305.(\207\332\357\207\036{\275]\217\217\246?[W\323ua\177\177\277_\026o\013\333j\225\325/V\247\236\373QV\237\244\332$\325aT\203\240ZJ\365F\265\256\37203\275(!\216\346\364\371\365fr\343\256\227T\324\343\237\342\203\204\n\031@\355\b\022\364\266\335\335\231\217\344"
+	.ascii	"\216n \305\tgB!\364\225|I\005\013,\275\215%\037_\n\354x'\272"
+	.ascii	"of\332\305"
+	.string	"\006\313\224\037\245$\276\321>\366\304\310\217\274\310\274MQeK,&\037\377\033jK\352\363\177|\346\2064\323.\0072\002J\262C|\"\312e\306\\\001\304\017b^\370\001\362\321j\233>D3\346\2344\367a\233\007j\371\231s\366\033/\306\240\301\225\223\303\302\320\002\335\252\001\001[\201\200\255rpX\033V-X\207UM\214_\034\\\260\225\207\327\013\266B\351h/\315m\341\007\375nRU\343W\004L\255KqMI\\\212\224^\366\264#l\237\3267\264\255\225\346\2343\214\274\313\244iS{\236\233\200\313d\270\246=\017\215\232\376\fn\270je\301\245\270p\206\256DA\0027\225\302\027\224\023r=\322\002\312U\355{|\206\322 \364\235\374\211\203\007\020 \310\307E\250A0\342\224d\212\220\320\004I*\245\031\003\200\002\021\"\263\033\021P=\203l&,\2644\006x=X\253\357\323#M=E\357\220"
+	.string	"VJL\323c/xl\021\013\033\341\344\205B\215\330\327\273\334\331\236)\214v\006\273\017\022\213n\342L\363.rq&/\220\237\217s\003\333\311J8\320R\301\320\213"
+	.ascii	"\022}\274\024\307R\230Kv\253\351\264\\\362\265\237Fp\001(\016"
+	.ascii	"Y\220\234\200o\"?\200d\302\246\316\310XFF+K\306\332\b\365\253"
+	.ascii	"65\0322\355\235L6!I\254\361\356\203\271\320\341\230\n"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.99.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\302\001\375\020"
+	.string	"V!tF\340\360&\035\332JT\200\177)s\027ZW\0212),b\254\206\003\256\345^\357C\346c\331 \350\307\353\332\263\214|\025\2716\334\021\234\345\030f\230G\3344\302\361\202\035\374s2\245/7\247G.\254%{K\231Ra"
+	.string	"W"
+	.string	"`"
+	.string	"<\027\001\373g$s\354jxa\264\273#.pz\f\201\266\375\235\207\2009\226`\202Lf"
+	.string	"\304\214\314O\215\335\317\373x"
+	.ascii	"\3561\017\302=*\207\307\0165c>\314\241iF\001\005M\315\346\n\t"
+	.ascii	"\334`PJ\325f0$E\222\314\177\23655Z\246\211dw\23545\013w\274m"
+	.ascii	"\007\266\037\330y \273k\275q\312\351\216L\243\376\335\335}~\216"
+	.ascii	"\177\277\311\351\230i\030\323"
+	.string	"\232\351\214\351{\2406\270\250}\306\304n\205\233\215M\212G9\266\357\007]\250\345@n`#\241\263\273]\213\335\035fw\266u\304{`\367y\021\360\261\264\236\035\243\335o\304\nN\217\376N\231\366\0034\200b\314\362fTz\030\231X\334H\\*T\223\332(\021\3624\235\302\265)\214U!\353E\252\b:\360\\S/C\346\206['\222p\332\2451\360\207R^\247\335\275\207G\377\205{\274\376\204-H\211G\226\267/e\270\t\251\342x\301M\372\237\213\300\370\344\364\264\240\345\222\375\315Rq\354\303\r>Q\275NXV,O\245\305b\265J\006\230@PY\271\242I\312\nk\365\342\\\242rqy..O\005e\305\362J\\/O\005\342\326\212\211\313ci\265\\^\367\311\016Wo\234\212\271\360\34161\265\022\351\307\270\2505\266\243\232D\2463\210\322\016\250c+\232\255\b\272\021a\244\024\245\316\230\031"
+	.string	"\206:M\351\205.r\244\202(\036"
+	.string	"&jeb\343\225M\330\243\216\276\333\336\252\365\270\332\362>,\256\271|\347b=\267\231\262\034\210\007T\251_\202\243\251+Eu\214[\267\013\353\2611\026\203ZB\303t\323\030\017\330"
+	.ascii	"M\330\024:h\027\220\022p\252\032y.\005\005"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.100.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\330\003\345\033"
+	.string	"f4\265H\240ZQ:<\333`\204\276\201-\332\274,%y\026\255\253\325\013\216E\030rU\027\035\224\035\366\322\224\231l\265\370\333q\320B,\364\323\005\327\030`\222\340\244\347\205#\206c\203'\206Q\270O\377W\323\215\020\262\267\224I\006\240"
+	.string	"\227"
+	.string	"\245"
+	.string	"\276}z\325\325\307@\223\324\203\252\326\272\340t\021\220\247:\207\211\247\363/\361t\367\305.\353\364\254\245\355\212)p\253B\017\222v\020\001\321\324Zc-dI\001\237\276\357\212i\277Y\221\243Hg3m\257\364\371\0037\246\314\t\375f\216\267\242!\237\252\241c\356TQ9\375g\343\3258!\210.\307\311\003>t\274\217S\001\325\0243\237\252\301\233\260\242!%\021\213\273\323\233\334\356\263\225\273M\235\340\031\227\033\342\376\357\036\222z\220\361\241\313q\036'\324Z\227\313\234\356\313\372\3562\355\256\205\335f\n\213\302\207_\236\356}\304\323V\257\234j<|\2270J\204\263{;~\237\304\261\037|\0022@!K\242\206\270\252\233\254\334r\335\275]\237\215w\214\252\250\266\201\354\302^$o\216k\344m\215\2748#\357\352\300/y\337w\234\274\242\310K)\357\234\274=y\271y?"
+	.string	""
+	.ascii	"\322Q\3562\316\324Z4\\S\267P'\244\003\177\337y\367{$\027\276"
+	.ascii	"x\323\212\340A\025\251\265\262\224\354\203K\316D;\320\305kY/"
+	.ascii	"d\224tDU\253O\001y\352\342\037\331\377\236\344K\264\007\233A"
+	.ascii	"\003\277|\271\272'\024\017\312\346\245\351\302g\331\320R//\304"
+	.ascii	"\302a2\031\325Zw\254\374J\207\017 @\210\2479}\341\347\031.lf"
+	.ascii	"\340`\262\333!\231\2611vo\231\3424\201\340\r\036\263\325\253"
+	.ascii	"\3065\370\330\375\003.\275\230\373M\177\222E\370Rk\355%\225v"
+	.ascii	"\265\316\255\205v\325\334\035E\324fC\334i\004Yk\205\260\227\362"
+	.ascii	")$xd\374R&\236\276O\204W\305H\222\032\017\247\330\275\306ifC"
+	.ascii	"\324\246\306C\246\335\333\240CQq\340\227Z\207vv{\376\244\204"
+	.ascii	"\004\243Z\207 4\271\223\023\373\243\323k\242'E\220\017\317\n"
+	.ascii	"1E\317\317\017\217\t\331\2702\007-f\261\026\263\330\317\t\036"
+	.ascii	"\237\230l\266\"\346\340\265@A=\263\030\013 \240Y\214\345\253"
+	.ascii	"\275\201(\3751\246\324l\251\265\355\246{\033\200\t\t\353\006"
+	.ascii	"\303\013>6n\305\256\240\205\266\330?\227O\321\224\366GKCB[\342"
+	.ascii	"\227\264%\361\224\322\035/J\032^\215\207_\237\355\263\326ZW\335"
+	.ascii	"[\0020p\320\030_\375\340\277#x\003\212\350j\222\301\307\206\365"
+	.ascii	"\177'a\2231\204\301\303\306\303\235\275R\024\002\354\243\256"
+	.ascii	"\245\302\005\f\030\3122d\317n\331pR\244\001\316\351\356\rG\250"
+	.ascii	"1\034\2061g\fBD&\220\300\206J\222\016P\0021\212\331y\020`\251"
+	.ascii	"\030hg\f7\372\021\360C\213\223I\033@\301\262\373W\275^\230\027"
+	.ascii	">\2124=\367\267 \355\301.\314Q@\230\207me\306\275\230\201\337"
+	.ascii	"\2228\270\337\022\304\276\006s\037\317<\246V-\n\200D\245;\370"
+	.ascii	"T?\271Z4!\\6\266K\017\247\261\004>\307\0353i(!b}\333@\030 \252"
+	.ascii	"\344\210Pw\020\271R\274M%\256\003\207\253\247\256\0310\002\253"
+	.ascii	"\227b\211\203\021\f\322kzT\236\336\215,?k\201\322\261wJ\303/"
+	.ascii	"\246\034\250"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.101.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\024\013\355:"
+	.string	"\332b\004\026@P\346\316\030\023\003J\373M.B\365\200\261\027\355\f2\315O\213\237\276\372&\352\211\227\271\177|\261]\303\312\227\237\t\210\246\247\211\210\2104\214\355L \030q\266\333\373\273\353,m\"\245\224)\245\024Q\0014\001Y\001l\323qK\353X\r\2010\272\227\331J\207\340E#\f{e\356\301l\354\365{\216\215\035\3558\267\345|\364K\3666\220+la\004\337\227N\252W60\354\225@#\331^\325>\262\275\272\314y\232\304^/*\266\27110\202\336\367M~\024"
+	.string	"\234\324*]3\362\335\206\022\020"
+	.string	"\300\223S\023\323\022R\351\230\204tdTD4d,\022\207-\273\252\357.wk\245\2369\013\225L\257\206\222k\001rq\036 :\355\342"
+	.string	"\240\220\301\365Sk5\355\003N3\321732\270vb\317\232\202\321nR\033\b\236\001\324X\226o*\262H\025e\357-\335\234\351\315\212/\251\255X\221*\275\267\254\242R \024\314ki\022GB!\243\322JG\265N\352\257)\215\244&\305\217\212gD\314\254\265QkeF6\245\213\324\250\275e\232\372\204\327\304\211\260,\237>Df\211\033\367\226LT\002xJ\274\330ZI{=\033\202\027\0354#\243\322\304\002fd\316\036\366\336\322Y"
+	.ascii	"\313\262\351mY\263j\203'\234#E\3141\025I\347,\360\207\257HZ5"
+	.ascii	"2\303\304\374\213\230a*\201\367}{\256=\b\023\314\275\265z\337"
+	.ascii	"\227]\311$k\036\320\314n\202\231U0\023W\004\277>\024\237\020"
+	.ascii	"=c\205\216F\304\004\261\017eW\245\232\312\316)\367\016\332\351"
+	.ascii	"\2034h\025\254\3720\244\177m\332\215\212\025,X|\212f\337 \273"
+	.ascii	">TU\037-M\373\232\026\376Uj\035\340H\234\333?\224\273\330\376"
+	.ascii	"\207\"\005\fsB\346\316k4]\334k\354\342\312[y\305\366\332O\364"
+	.ascii	"\262[{\3065\277\274\220\211\2349\306\foe\324'\370\341\\\016\n"
+	.ascii	"\202\275\0273\035\230?\224\271)\244\021\n\362\2431\023\2351\f"
+	.ascii	"\235/\024\235-T\250*:SMI :+ :'h\271\346(\242\263S\227in\352\273"
+	.ascii	"f\246\256k^j\235\221\254\263\022\321\371\310:'\265\316HE\347"
+	.ascii	"\243\325\331hu.\":\023\261\316C\255\263q\350\\\034:\023[\347"
+	.ascii	"a\353\334\256\316l\353\274\262\316\352\352\354\253sgp\232J\371"
+	.ascii	"\276\260\341\275\035\272\267H\341\240Wo\315\263\322e\272\357"
+	.ascii	"\272\353\272\345Ze\356)\033\213R\247\2311M&G\207\341N\323\314"
+	.ascii	"\343\226\203\333K\213a6r\217\016\303+\363\016\355\031\375\302"
+	.ascii	"\215\007\246\355\334\276\333\321\257\362m\2574\2667\024\206\275"
+	.ascii	"\036y\037\003h"
+	.string	"I\224D\217\017%\324\\\232\201\334\374\374\231\252\331\222\364P\244\245_\275\334\265I\343\2049!3p\005\317\354Zq\331\274\225UG3|n\364\302\336\213\227^\301\263\337i\"\005\360h\201\220.\321\347\373f\335g\321\2774F\304't\267 H\033\\\325(\371\370Z\273[\330\250'>\224tH\341\217'\230\027r\221\233\205\305\340iB\272<\351\303\007\347\302c\370\366O\361\243\376\302\267\230V\2630\373\246\201\354\256\200\375q\267\f\373\264\037\267\315}s\341\\8\266\327b\024\363\016M%\002\347\310\034\321C\331\302O}VY\2334N\\\357\021\264\360\306\257@or\274\347\017\035\264\241\2072\325O\375s\221\316i2\354\316u\036\r\303\367\r\253\342\016l<\0338t\350\300\366J\365M\246}Z\246\345\031'\327|w\352\360\214R\355\364-\204\264y\365\341\003\034\376\324\273\032\022\r8b\350\327\177\036>\200"
+	.ascii	"\301\366:\374\306k\006^v~\317\270\274\277c#\306,>\264\273\330"
+	.ascii	":\"p4\003\335\374|y!\261}\320|{\354\267\337c\205\276\274P\217"
+	.ascii	"}\f\177\315\341C\271\337\264\372\317\264\203\223\376\265\354"
+	.ascii	"\240\345\214\250\362{\337\227\0027\234\216S\202{\255W>\201\002"
+	.ascii	"\205\222O\007,\003\202\r\0323nt%\265\266\262\262\266\256\236"
+	.ascii	"\260h\324\310ra\203\245\201\245\245\345B\306Uk\003\004V\326\f"
+	.ascii	"\0237\264\260\270\270\272\256\210\370\n\202\016\256\244\016\256"
+	.ascii	"\244\326\f\027Y\311+.\033I\bG\336\252\201\305\225\274\261\265"
+	.ascii	"\305\2254\322}\365\243\361\260oN\357\353\301\240\220\337\364"
+	.ascii	"\2626\016\004G2bx\004\371m\247\226'@\311\311\224\276\215s\372"
+	.ascii	"\026\340\241,A\371$\341W)NR\335\324\364\307\244?.\223^\301O\251"
+	.ascii	"\273s\003\240\351%\374\0130'\033\244\020N\304\207<\036%\237\243"
+	.ascii	"Gb\340\t\216\276\247}\024\324\327\326\364\t~\320\234r\354\311"
+	.ascii	"9d\227e9(\330}\rD\207s\214\233\237$X\\\236\323\004gv\231\270"
+	.ascii	"M\274\225\334x}L\364\210\320"
+	.string	"\270g\223\321w!)`\322\331v\317Xf\027\352F\361V\032}\2279\t{/\246\207\026\375\013\017+\372\236\353\003\3141Z\236qK\017e#1J\025\376\001\211R\275\364A\226\236\3507\310\031z\242o\377R\341\252\261\030\372\250\277\246\372\276\357\213|\350\322WxA\315@\251\035;Wz(\267\037[\340\330\024\251\352;\215\355\315\330\264h\352\231>\b\263\361\375\035\201\364+\3640\005\004\323\033\237\207\363\213\324\316]!\017\200\351\250\201(%\235S2#\"\0224IRh\f\200\002\021)\262\342\006\021`\251T\020\221(\031\306NM*/\260\277\030\311(\204\340\333\330\352\025\234F\232h\031\025\0220\322\021\373_\r<\223\257k_8D\210\351\201d}\346W\307\344T\322U\034)\364w6\316\341\270\031\212\235\335 i\2569B\221\024\305R\303\334\221P\033\260\222\333^!\2173\231\255\374*l\033e\331s"
+	.string	"N\301g\355`6\2630\213\215\3405\036\233+x\356\277\311\201\257\321h\221 \376\224q\030'(2\353er\305\220\235\0245t\214\222Mik\374\261\246\035w#\f\264\364v3\347k\350\361DdpX\0023\243\277\374\202t\343<f\267\234\355a\034\017\031\024\244\203\226\270\237\204;<\344\n\t\322\317\2057\035\032\001\026(\222\377EDS\3208@\300"
+	.string	"\365\026\370\3019, \271\235R\001}&\261"
+	.string	"\221X_)s0v\201\247\243i\006\325x\315@\022\202\305\332\371\215E\255\271/V\244\211,\335\353g\002\002\333d\367?l\021|\346\237m\374x\371\312\230\033\236]\336\306o7)O\026\264\326\340\177\036\246\201\255\363\256\315\265\220\031\0043\354\333\250\200C\323\236\357A\032\241\370\177ql7\204\217\256V\311\247\235\225T|l\320\017\033\210\2779\016v\215\2478\022(\001\026\303$\321\243\261b\212G\005X\347\257\226(\277\271\240\335+\bz\t\364g"
+	.ascii	"]J'\326\362\r\270\371\f\207\323q:\220\314\037O\257l;K\325\322"
+	.ascii	"\263\365\001z.8#0w\337\"\354\206\222\220\nVz4\256\223\211)\307"
+	.ascii	"!\270\363\217\032\372Bb\036\257\274\357\300\341*\215_\275S\266"
+	.ascii	"\034rW0\214(.\262\035\370\017"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.102.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\233\001M\017"
+	.string	"v]fE"
+	.string	"\261&\035\200Q2t\026\030\343\207\313f\261\241\2762\323;\267\006\024\342y>\340E\366,\264\334\r\2325\266\326\032_x$Nk\373g\264\250r"
+	.string	""
+	.string	"\006\265\214W\206\265\271\260\020\233\350\330\265$\356\275\245L)S"
+	.string	"M"
+	.string	"P"
+	.string	"\361\360\035$\036\3326\311\001\224S\3574\270\004\334lp\321\271\261\333i\232\341\251G\3704S>"
+	.string	"N\365\230Q8|\005h\\\304\204\270\b/\304\347\302\f\030NB\276\230\253\210c=\221\335}\316\363\205k\311\364(\331]g\213\233p{\3346\311\266f_G\034\317\213\006\247\302*w\330\235*\325\306\376\333\335\265b\260\017\373EN\203\234\216NC\247\237\323\252\351\177\230xp\301p\237\351\331u\355\370Y\030\220\005\007\333(;d;\323~\210\343\240\016\203`\320\256\005\031*v;\003\036\220\035\212<$5T\237\236\307e&\224\357n\342\224\355\256\336*\221\252\372\0165,U\331n\360\235R\266\273\b|\235\2230\371\257C?8\235\342a\352_\310\264"
+	.ascii	"\001\313\335U\251S\361\312 \026\203\2259\354\213\370\210\224"
+	.ascii	"\377\262\312J\276u\350\257\304\303\353sN '\005\244\322I\202\024"
+	.ascii	"\024\322\266\251\214\002x4\302\262i,\233\206r\262\240\244\215"
+	.ascii	"\266\2236\002b\223\003\322\246\245\230L\233\026\352\366\017\302"
+	.ascii	"\354\347\346\303N\212\367\330A\372b\033\244.YiK\374H\221\332"
+	.ascii	"#R\276\005\365\251j\205\r\237\032\2506\261G\024&QIdzp\274\247"
+	.ascii	"'\036\215V  \260\002\241\200\254\007\340\2007lM\302\0052\210"
+	.ascii	"V\340l\31396\217yF0\016/\203\016P\213\024\025\004\t\230\210\234"
+	.ascii	"\217q$\355m1\266tB\220i\004\221B\224A\003\224\327\2242\3604C"
+	.ascii	"\304\347\253\027\315R\320%kl\327*\003"
+	.text
+	.section	.gnu.lto_parseRcChannels.103.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\303\002\375\025"
+	.string	"\346\250\217J\260\022R:\213\006\214Cj\353\316\354\303\327\235\203}\246\312\262l\310\033\314\240\374z\245X,\001\022\002:\323\350\253VF\305+\301\277\221}e\335\245w\007\007\357\2169\365K\266Q\3340\273\207\257\207\036\224\213\324H\333\233\310\235d{"
+	.string	"t"
+	.string	"~"
+	.string	"\rd\260\b\306\323\005\236@=\035\037RO\327\266;u\240\257\013\374\230j\206zt\367\213{\2265m\037Y\225\212<m\373\240\213;\274\034\273r\346\243\310\312\335\204\270\223\006\017\342I\025\225\322\205p\223\005`\004\316k\207\323\221\356&\313\334\024\305\220\017GO\256R'\222<\375r.\374\264)i&_\350tGg\270+q>Y\020\272{\347\256\334\360m}wy\273\353`w\332\bK\271\222\271\267\013\234\231'\276\252\251e\236]\327\201?\310\211\276\344\201\376\326\203\337Z\347R:W\024\347\2628w\362\334\007"
+	.ascii	"\361\341S^\207G\367\315\320\252\233\250\222\210\023\375\301\335"
+	.ascii	"\017\355\205K\022\375\374\240\032\214O\261\027Z\362tw\2032\002"
+	.ascii	"\332\251_\226\370\321\240\352\006.8]\223\361\364\344\356N`\214"
+	.ascii	"\224\202\317\335\2378\n\333\201d>\240\233\307(\251\003P>1\365"
+	.ascii	"\364;\035\223E\256L5W\267\277\220\215.\230\371G\213+O6P\203\267"
+	.ascii	"\244#\201\233\303=\b \023?\224{Eo!#Az\222\b\324J\325S\2221\004"
+	.ascii	"g\320\314\252O \253\0358D\356\355e*\311\034\204\324\023\214\242"
+	.ascii	"\231U\0132\317/\372\221,\201\257[\367\335\336\350*b\342}N\267"
+	.ascii	"\202\254~'\2533\013\363;\222Gr<\263\224\317\027>\302\016OXsu"
+	.ascii	"\233C\026\006/\207\235B\214\245e\206R\243\2150\027\\Zbta%5\332"
+	.ascii	"\253F{\265\304Td/\030\355\345U\022\2623\227\025\332\013f6\243"
+	.ascii	"\275H`\237y\202\376\f7d4\335\030G5ro[Q\325\3054j\332\244T\312"
+	.ascii	"({\026\264\224\221\262\270\302&\3476\207\027\273\273Y&\257\354"
+	.ascii	"\342\013]BPg\250\373\301\315\341\344PE\336\335\332cL8\340\353"
+	.ascii	"\356\223]\225/\301\306\356~p\272\207\301\262\"\0226 p\002\231"
+	.ascii	"\"4\017\341\300\357;\332\006\202:ze\002\013w\236\312\016\232"
+	.ascii	"w\367*K\212\260\003\265I\377\221)1\321\205\231:\354\360X\252"
+	.ascii	"\270\3239h\263\3048\353 p\244CC\306v\241\301\013\026g\212\035"
+	.ascii	"\306\0035\234\330btY\016(\tw\233>\340\\\346p!3b\362\200B\330"
+	.ascii	"\205\3042\r\213\373X\255+37\300(\335\275q\327S\f&\\\360}\b\227"
+	.ascii	"/g/\2333\265\346\t"
+	.text
+	.section	.gnu.lto_setRssiDirect.104.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\005\013"
+	.string	"&\225K@ \307*\035G\336\3011\311\004\027\001\260\022\317\255\367[\032\003\004&\\p~\022\225a\360)\r\2405l\r\013i\202D\217\361\034"
+	.string	"\023\001n\030\020\202\203\3727R\201K\"bC\210\354\275wJ\0018"
+	.string	":"
+	.string	"5"
+	.string	"\032\356\325\241}\340\243\3112\244 \330\230%\330\335n\226<<\2352\364\017\304\323\351\307g\202\230\242\233\335\275\354\222CTIy\351\354\256\345J\364\270\353mO\330\206\260/\021\322\277 \334\004\210\027i\331\355\270\331\226@\035\200b\373\031\333s\374J\370X\311\006\273$\006\0340\257\033*\245}\225\277\302\303L\256\273#/\332\356\370\340\006\314\253\302\027\270W\371{\232\323e:?-d\005TR\201\375\331YJ\376\211\301\221\374\352\325\037q\257\237\227\235\322X\266\032\bJ\336\354\361$\247\313>\335\335\365l\331\207\375\365\261\237\322\037\3177\362@\016\004\202\024\032\237\320\305\036\016\351\353H_\027\002U\\t\236\017\3548\032{\030\237\257\313\360\274\257\313\214{\272\263ewP3E\353\364\001<\200\311\023\211\270\327\b\326\202Z\210\334\r\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssi.106.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\361\002m\026"
+	.string	"\366j\222H\3200'\035[\200\344\034\354\007J\311\206\027\3437\307\215\307T\235\007\240\246I\264^\030a\334\226\354\350\366\343\363me\252\252\363\033\250\313\017\230g\221\221\025\247v\001\214\023\0249\017\326"
+	.string	"C\221\275\231\2315b\311&R\246\024{"
+	.string	"p"
+	.string	"\177"
+	.string	"\227\207\331\336\336G\344\316dc\327\234\035Z\220\210\227#\240\252\375\020\027\221\373\322\215\345\234\034\220\244\346\354\021\260"
+	.string	"\361\222v\221\360R_\013/\235\263k\274G4\001$\005\355\232r\3149m\353\341\271\207\022\\\315\3718\017_\274\236K\261\347 h\262\223\003h\306\333\001cX\273\0270\236\216\356\2147\202#s\316\373\256\026x:\325\326\311\234\323\312\303\313p\267n{\305v\001{\025\004%n\302\306?\262\204\027=\317\245\377\022^~\357;(\365C\245\344\223\243?\2737\352\016\331\007\347\234\323+d\267\324\"\242:$T\327T\r\242\352\017QM\023\325\036\242z\246j\231\252c-5L\325\257P\355R\265\370\245_\236\351\007U\255R\375"
+	.string	"\262\0173x/\372\315y\341\267c^\311)$\333\367\233\356Ds\022F\360\263\002vi\323\330\260\261\030>\262\235\305VW\266Z\245\0031\352\317\260\215E\370\324\2158\3474\340K\035E\003\377\350\322\016TT\302K\330\272\246\\\373\332\357\262\016\365\023+,\267[x\351\332;\035\304\361\363\244\344#W\3675\032E\375I\303\225\r)Sqm\b.z\036\337\367\023\235\305\261\\q\255\273\254\034\375\231\300\330\200\001\334!\313\333\204\340\276*\311\027CG\261t\316\211\263;dp\277\017|2t\024\313~-7\334\fLL\33023\201\205\201KL\f\316\345[I\r\316V\203\263Qpay\261\335p1\266\222\232a*\264\340l2008\033\254\227\363\025\362I\316\216\241\310\372Wwq\223"
+	.ascii	"\005%\274\274\357\007|FQ!+\262\007i\033\262\257\261\250\205."
+	.ascii	"\253\266,@\266\266\n\265\313\272\253\302\217\005Y\220\306\316"
+	.ascii	"\207\344\257\375X\220\261\310J\0274\252\270\231\021\245\220\371"
+	.ascii	"y\322\001D[\253\363\334\360\330\331\322\366\272\240\221\352U"
+	.ascii	"\003\026\244\244\204\227\036\0338 p\002\231Qd\036b\001\253\207"
+	.ascii	"\224\313K1\2627t\315[\370\273\363;X\033\306E\327\016l`\f\311"
+	.ascii	"\254=\346*w2\256\317_\004L\006A\334\213\211\356\031Y\031\212"
+	.ascii	"\035\254u@\233x\354\302\326\370q\254\221}\313\365 \237\2535\234"
+	.ascii	"S,sL4\003\026\212\254@\033\245\013\217i9\211\205B\025\354x\241"
+	.ascii	"\026j\237\023\032\033\020\221\302O\323~\216v\031\230\030\r\364"
+	.ascii	"\222N\367kOM\024[\213\365"
+	.text
+	.section	.gnu.lto_setRssiMsp.107.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\016\001E\f"
+	.string	"\366\325PA\020q\224\016;pLB\224\361\257\326\341\201\210\217%\344j\035\343N\247om"
+	.string	"2M\016\334\177Xk\004=\372\007\204\314\330\323\274\031XQA"
+	.string	"\240\312_i2"
+	.string	"+\214\242\374\212\366\177\262\311\2262\245<"
+	.string	">"
+	.string	"@"
+	.string	"\227z\370\366XA\315\315\2676\226\316\343\036+\030^\301\004\036'\0322\336\004\330\201\2022\361Hx\341\232\361N\220\300\356>\365\244\340\2312\255\315\356:;\317\302m\335\366\307\266\001\373\240p\025\304\272\310\0375\235\232\376\005\300\210\031\336A\330\330\255\220\202cK*\026\"l\037c;\323F\240`\273\210\004\353\356\006\023$\273\337\001\027\250\274\362f\323\370\367a\005\220H\241T\234\354n0HNt\2504$\305sE\352\200\027- \274\026G8\037&%j\344\356rj-^\035\214\3048%\212}\024\3774?\204#\214\362\335+\177\024_]9\037.nd(e\212\375q\251!\366\003\037Mc \322\026\214<\241\213;\032Rv\221\262+\364i"
+	.string	"\272:\231vi\002\030\023y\262\013\002\206e\027\346\333\303U\220\212\f\016%%5EKZjc\017\362\235\237\372\346\244\234\243Z\352D\345p\033"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"]\303\027&0\251\272O\245\306\tw\037\214\262\bc\2011\212\252\261"
+	.ascii	"]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.108.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\367\002\275\026"
+	.string	"6\353\224F\240\032U:\204i>2\316\327`\273\2308\334\276\223\234\372|C\255\347\343\374!\\`\246\374\214kkm;\005\f2\341V~\342/]\202@\203\327\241\247\361\\\236MY\207RL\355\205\374\336s\254%{\023)S\n{"
+	.string	"r"
+	.string	"\211"
+	.string	"ZE\204} \017b\227<\342=W\330\021\355\230s\226\036\355\021v\351Q\357\343\222\357\343?h\347\221"
+	.string	"'\215\032\035Pz\346\234\n\036}`\364\210:"
+	.string	"\371\250O\311G\323\354,\003J\314\234\005:\236\344|]\346\234\254\235q\332e\004Wi~XC\322\321\345\\\262x,\341\303)\270\342{\322\335@\003s\316\373\\O\350l\252a\315\234\323\252\243Sq\207\267\215c\373\201\275\016\002Z\344\257\356s?\273^\304f4\347\215\201\017t\"\034|\236G\337\340\350up\344\343\367=\273,<x5-\262{6\335\035\373\340\234sze\330Q\255\242!\251gP\347\335\247\2506\215\3242Q]\n\3251\241\232\024\325\243\250\016\245ZJu\004\325`ToT+\250~"
+	.string	"S\017\036\335k4\2313E\021\230)%\006\3358\357\267\357\017\271O\304{\016\017r\004ACFf\374p\211\331\322\352\020.\212\225\274\326\345Jo\332z\233\263\206\200\2641{\034\216\321\2226d\202\3332kq3\221\341\216\3668\030\247\r75\305\006\225\334\017\224K\263\212$\367\213+`\307eR\356q=\250\215\233\212a\003(\367\3239g\316\356\216m$\270\033\204\\\271\351\027\333\030\276D\t\270\025vZ\274\314\216\204D\201*s\316\006\276\221\037\311\240\241\325\222\217\250=Y\tZ]wW\206\301\301\260\005\356\260\222u"
+	.ascii	"\321z\261<\300^/\230\213\300\215L&\341\025\342Ch\327j\026c\315"
+	.ascii	"b,\0177\255\027\313\025\223\261V)\303>\330\304X `\260\030\253"
+	.ascii	"\324\253\035\374\3120\201EHJmmRf}\241C\201\020a\302\004\371\230"
+	.ascii	"\303\305\317\313\213\270;V\375\f\241X\232\243\370\021J\242\250"
+	.ascii	"=\355\t=\0059\363&wB\301\347\261\205\013\027\344\343\314\336"
+	.ascii	"wp\211\0130^Z\230Vf\357\363\004;\"\033\025\240\237\202\253\326"
+	.ascii	"\264V\034QXTZ\325\0068 p\002\231\271\344\001y\2632\216\\wL\235"
+	.ascii	"\007\260X\303\336\017\232\277\260\226\023.\253\036\361\020\223"
+	.ascii	"\360\b\332\201\3053\242\254KS\025CF\206I5\205q\207qJ\254\002"
+	.ascii	"-\356\260\317e\341\336w\271\307\321Y\252\230E\302\222\343\256"
+	.ascii	"\261o\227Nj/\003?Z\013\214\223\363d6\366\204\036_\275,\007^\206"
+	.ascii	"=\fY\004\260E\b\215\325p\234A\016\302\023\346w0\312\313\220\317"
+	.ascii	"a\f\256l\271\355\nz"
+	.text
+	.section	.gnu.lto_updateRSSI.110.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`M\001\235\r"
+	.string	"V\030YD"
+	.string	"\261&\035+\313\367M\275J\n\316'\006\374PJf%\264\024\345T\bew\370\242\327\tV\263\354\203X\002\032\2350$\316V~\330\373\005b"
+	.string	"\b\256\b\320d\362\004\033\313\013\002\350\242 \226\354\275eJ\001E"
+	.string	"D"
+	.string	"F"
+	.string	"\037\325\2451\333\373\251\303\002p\311\020A\246\306\356N\310\341\330e\204\212\371q\345\005\265q\331\245\225\362\370\230\033X1\305\330\270\224C\r\245\002\351j<tp\020\240rFv\327\272q\025\356\352\266\023\330\236\366C\004\362\260\343\002\215\215\205\222~\366IS\270\301>\374\276\317\306\220\305>\314/U}\216\007\215\t\334M\250]\n\237\215MI\026 :\266\257\366_>\002;\314\003s\354j0\255\330=\025\260"
+	.string	"\3532\344 \325e|\233?\343\271Hi0\363e\036\242Iez\363\256\246k\001S\370*\242\210\226UA\341\243\354Yz\322U\326\245k\261\177\302\266\027"
+	.string	"\306\213\335\354\030t[\002!(z\303>\211\227 \371\037\354\340D\277]\372'\325\003#\004\037\020\311\201\222\320\347\272H\036\017{DL\256ir\315\020\211\002\320\364\\\243)\362a\021\203\3175KD\242kvN\245\307\205,1\277\004\031\\\252\0045\337\304=\222\351M\224\035\265\027\200\340\314\007x3\242\245v\203\221>\037"
+	.string	"2\241w)\340=NX\240\223\352\263\013\272\226\332\013\325\252@2\236\222\f\0077\263\32556\001\301"
+	.ascii	"\315O9\003U\030Q#\213\243x\251\314b\234a\005e\313\300\250KX\304"
+	.ascii	"j\364\270\233}\022\211\325d\247n\202|\273\254<\001"
+	.text
+	.section	.gnu.lto_getRssi.111.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\022\001m\f"
+	.string	"\266WS@ \221\222\016\247$u\375\020\346\007\200\244\036~vj=\204\024\244-l\243\210'\313\251s\330\222\277\177\305Q X\016\037\322\002\006\001\004\361/\271\371.\342\300FO\\\263\2154B\310\336;\311\224\002D"
+	.string	"9"
+	.string	"?"
+	.string	"\233\215\310\342\241\320\320\026\245\245\352\016\016\241\224\343\021\001K\361\340`beD\215\030\265*\200\005@\277t\007\364;\006s\234\234\332\036\274\240E\350\205\347\223\342\214\024\304\030\233\236\317\004\367n\213\240\255\201\326.\001~\265\t\364\363\007dh\301rk\265N\376Bk\027\317\3226\253q\331\214\313R.\213\201\331\311e%\227\215\\\026>\373^\326\271\354\237\315\314\032"
+	.string	"\307\f\320\307\241\0251J\b\005\3316\032*1b\007\242K\360\177tg\033:\271\365\035\336\356\317!,\202S\203*22\002\375\334'\n\371\377\271\310^\374\274Wn\224\304\037\030H1\252$\250]\254\225\324 \277Z&iO\335|\234\\\325\311U5 \t)\2516\327\203\352\243\243\226\003\221\253\202`YWEi\230]<\213\346\005\260w\232\271\346\316TP\227\2369L\221U\350H\230S\3231' #{\tq\211\r\211\351 0ZN\330B\f\020Zl\030"
+	.ascii	"2\241\207)0F\nu\374\300\2530\031\b\207\005\022\301H(X\311\344"
+	.ascii	"CB6\224\t\nL\022\300pY\3134B\306\027\213[\331>T\255\27006\037"
+	.ascii	"\263\230\005#\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_getRssiPercent.112.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`v\001\255\016"
+	.string	"\326\234cC"
+	.string	"\221(\035p\222\343\024\025<-\332dT\266>\027~j]\240\330\327YFS\034\221\347\271\257\340\267M\211?5U\331\346\376\304X"
+	.string	"\200\025\017\376\273\024\026\367\313A\243+\332\377\266g\355'd\223$S\nR"
+	.string	"H"
+	.string	"V"
+	.string	"%b\304\360\345\210.`\n\017m]\273\3742\261\210>X\241!\023c\344\f[\223\2263t{\322rE\220\340\244\250"
+	.ascii	"\027R6\n\200\210\261`db\204u\357`\224\023U\333\305!\236+\326"
+	.ascii	"JI9\267\0051\306"
+	.string	"f+%\203{\2675\320\226@\233\036\001\260$\246t\313\2606i\206\331\375r\266b%F\210\227*\277\026\346\3459\264\316\342YZ-;\202Y\021\314\206`\026\264e?0\353\201\331\016\314r\317r\264\354\006f5\317n\315jY6{6\237u\207\007\007\212\024\273\002\237\203.\240\306*\306\201O@0\3619\210\214W\314\033f\274\300bA\276\357\006J\214*\217\316=\3345\357\334\253\017^~\345\234\2737\347\324$\f#R\267\224T*i\206\233oT\266k\016a\254b\262o7k\306\257F\360\313\210&F\024\0055\314#$\324-\016%}\224\234\272\222S7aD\204\244#\235*t\037\0355Q(\235:\013&\323\251\343`*g\361,\332\007\250\3565\257\001\310\276\330>W\205v\300~\313\240A\272\225\317\242\312S\035\335\267\213C<W\2145#\372\350^\265\b\335s\3215\026+\r\236\006\364P\033"
+	.ascii	"2C\237\220\300\376\033\020\332\020\342\225y\2560H\013\334\n\223"
+	.ascii	"\201pY \021\344\204\202\231L>$d\323\231\373\301$\001\f\227\225"
+	.ascii	"\320#d|\261\350b\373\256\262\3205\374\361L\234\202\212\034\356"
+	.ascii	"\262\251\235d"
+	.text
+	.section	.gnu.lto_getRssiDbm.113.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \340-\006"
+	.string	"\222\013+2PO\222\016\240\342\262\021\0041\356\255\203{\242\037\007\025T\355\371<[\326\266\2445gufj"
+	.string	"q\304\214[\242\211>\253\321\266\001\177[\026\233%[\246k2\033\3276\256I@8D4\215\243h\031\202\245\211\007\327*$\3115\314\225\035\231\201\207}\276VI\336\005\331\202\203\245\032]\016@#d\002\034\036\f\3755!\363\370^\222u\3748\262\001PJUK%S#\324\222(\221I\310\337y\314\n\013\235_\301\305\264\202 r\202Q\302\222y5\366\321W|\267#m\370X \252\232\212\001\f\2319R\325Fg\375\023\376\203?#\b"
+	.ascii	"2\003\3020\021\341j\327\304\302\210\274\204\310\341\316\231\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_setRssiDbm.115.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"\355\n"
+	.string	"V\025K< O\225\016C\017`5P@\344\"aqUh|A\224Bk\202H,\f\b\275Ek8\314\214T\250\345\024\005\324\204\002B\005\262\020\364:\013\032V\301\300WDl$\222\275\245L)9"
+	.string	";"
+	.string	"6"
+	.string	"\002\254Co6\212w\0316"
+	.string	"\207\224\bD\212\335\215\212\341\333\237\346\346cp\236?\013\302\365\301\201^dw_z6\340B\231\027\225\335u\216\270\0077\274m\002\266)\366'\001\351[\217\n#\270\213\b\261\353 \305bK@\022\033l\337a[\323\276\207\177\330\336u\334\330\245p\"Z\207\221\003\250\016\337!\325\2413\355\te;\211\201uwB\007\324n7\300\001\225:E-R\365z1\231\b\345\n\373\246\237:\276\006gZ~t\350k\325\341\365\245?\224\204\223\212\b\237L\331\035(\365\202\375\267j\301\316tu\322\377\336\375\372\002\031\f\246]Y\225\321\016X\fl.\0054Y\206e\030#\341`\221\203E\004\032\313&b\260,J \276\022d\260\270\340\272\260\350\350>\257|\024\364^#+\265/\005\371\221_z%\244\036?\r\023"
+	.ascii	"2\003\302\260\305\302\036!\b\334\001cH\3252x\201\275\"6\314\037"
+	.ascii	"\026t!\347\313l1\205!\246\324hq\227\233jo(\314[[\312"
+	.text
+	.section	.gnu.lto_setRssiDbmDirect.116.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\335\n"
+	.string	"V\225K>0\207L:P,C\316\253b2Ul}\201\273\345\22645\030\334\373\2263N\021c\235\356\342(\342\247\364\250\341'^\372\361Z\341\001\252*m\002\247\330\203\343\001l\234\366\243%{\357\235R8"
+	.string	":"
+	.string	"6"
+	.string	"^\210\274:\264\033|\374X\205\227\n\203\200mw\273\351zx:e\350K\304\322)\307'E<Q\313\356^v\231!\242\244\204dv\3272%n\334\365\266#l;\330g\bT\372\020\212\213\201\370\003\264]\215\333\203UP\023\004\260\375\211\355)\355\013x,\37482\302\256\207\355\022y\265<\201{\245\257p\257\226\322nx\b\017#y\356v\304j\273\343%\273[\232\263e:?5\263\005(\351\300\376\354\003F>"
+	.string	"\203!\371\324\253\037\342^?/;\255\255\020\274T&y\263\307\222\234-\373tw\327\223e\037\366\327\217?\r\234\315\027\362@\316\243\221\350\200\340\304\005\347#\361\006#\372:\321\327}:\024\236n\363\201\035\246b\257\202\363u\026\236\367u\223qOw\262\2341\315\023\255\323/p\003$\017\004\342^!V\264\327J\006\020"
+	.ascii	"3\241\251h`\374\252\035\226Q\325\021\254\366\325\311\"|,\334"
+	.ascii	"\332\344\302\333\024\206\230R\243\305]~\252\275\242\324mm\321"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.117.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"R\21505@o\222\016\230\265(]\343!\210~\323\310&}*\271rt\0233\006\242\250\265\315\036P\327*\nH\350\250j8<\r\001\250q\017k])\274\007kb\t\221)w8\036*z\250\b\341\300\360\020;\224D\344h\236\"\032\25081MT\314h\331\027\372\031\\\357\342\247(J\025\220\231\t\367\244Z\305\005)\334\342\343\212\025\336\217T\350\236\200\311\345\266\327,\367:\276\230|\241\337\355\336\200\210F\326QK\346\306\366\222+P%\344\007}\346\222\264\004t\265\301\270\254\315\210(#\305%S\213\004-\220\n]5R\341\363hUW\335\212\272\3002\332\260\314\252\003P\310\314\035\226q\364\327\037\341?\370?\002\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_isRssiConfigured.118.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375 \363\255\006"
+	.string	"\222L.4Pm\222\016$\243**\203\312=m\330- \f\017"
+	.string	"\fd\031]\276\236}\373w\313\2163\002P\241\306\2633m\332\030*`\205$\264\2605Tk\355o\"Sk2\234\3478\317=4,88\315\213p\031\201+\b\206\347$\252\3529L\226E\022\"\001\bC\337\215\245\210X\321H\250\036\375\330\334\322\023\235\326\253\324\355XJ\025\001*@\355\364\331\247\341\305\267\222H\372\333\330\332\255\004l\224\260\232H2G\247\224,\241D4~\317c>@\360l5\313\030\rp\204\210@P23\207\030\265\332\254\333\216*\230\230N.\354\323vI\310\314\333\205Qt\354o\360\027\374\026\001\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.154.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\353\003\225\031"
+	.string	"v\355\241E\260\032Uc,\215\376\256\002j\326\222\001\250\002c\276\205R#\254\t\354\203\210\006\232\335\235\036\326\363\373}\374Z\275\272\372\375K\265r\245\321\177\344\036\217\224w\376\t<K\316?8\255\250\243\207*\221\277\345\2262\245\210"
+	.string	"\227"
+	.string	"\205"
+	.string	"?]\270\336\273\243Xt\357\031\341\326\fP\267\266\315N\335\036\251\371l\373En\304\346\033=\203>"
+	.ascii	"B\234\360\210\224\356=Y\267\003\256*o\351\r\224\267\325\307o"
+	.ascii	"?\225\226\254\024u\363M{?\334O/\236\224\267\301\324\324\373\341"
+	.ascii	"\270]\335{S?\030\224$UZ\202\304\244~;\362\301\216,6\002\374t"
+	.ascii	"\264\222+,G^\200\337\216\\ \304\343\314\207\2472~=\224\0268\352"
+	.ascii	"t\341\336\353\347r\3345\267\235\263\255\263\353\225\227FS\232"
+	.ascii	"\373c\215\204\274\311\255\320L\323\202\032\364\204\341\031QI"
+	.ascii	"\261\302)\200\030p!\262+\322\004g\320\307Wd\036\362\3468\203"
+	.ascii	">\"\322\024\031Q\272\272\023\302\314<5\006\214\\\217\tA\275\235"
+	.ascii	"\357J~\262\357G\271\024;e\363D\013\360\322Eh\332!\222p\305\211"
+	.ascii	"\236`&I\230T\364\354D\237xd\224\254\237\244\346/\371\320\251"
+	.ascii	"&\265\023\321h\202\363\372\370\206\316\304v\"\332\357\316WSc"
+	.ascii	"\n\2241\017N\224\022K\240P\373\351b\365\003\302\255IjK\240`\013"
+	.ascii	"\327\362\001u\257\256\202o\374\021\204\017\344\326!FX\177D\275"
+	.ascii	"\361\bI\2166\001o\bsd\005b9\255tIEU'Q\332%L\320\367h}\225\237"
+	.ascii	"\372/\365h\"\326\n\264\r+_\0174\004FG\227L\200\256\356O\224v"
+	.ascii	"\313E\337{=`<r\324U\\\321v\r\t\025\274\276\373s\035\334~\370"
+	.ascii	"\3170\0269\342(\023\255@W\324\311[\205\354\033\352\362\206\332"
+	.ascii	"\336P\2236\3245EMS\324\267A`!\313\r~\275pf;\246\214E\314t\235"
+	.ascii	"p\311X.\035\005~\241P\201\002\246\02333\344\350\264f;\260\326"
+	.ascii	"\006\325NN,\326z\271Nv\341\264\220\261Z\310X1X\213\207\345\222"
+	.ascii	"\315X8\006l\252\310\221\261X\230\246\214\225\262MO\336*\3443"
+	.ascii	"\335(m\375\360\026M\031K\326\262\312\260]V_\310\325\236\323-"
+	.ascii	"\311\217\276\330z\"s\245\006\031\262\345\226$\361V \333\030\336"
+	.ascii	"%\303\226s\321\300\241C\207\362\226\2545>\222\316\330\350\211"
+	.ascii	"\016\234\255@\177(k\265A\032:\262=\004O\250\221<\204\220Q\306"
+	.ascii	"\320\0043\022\214\2026m\260\002\031\263\322\006\021\220\265\223"
+	.ascii	"&\31445\312\3653L\3208\346Y\2442\f\214R\367\027c\263E\372\315"
+	.ascii	"ur?\360\204\302i\257X\177\320w\252Q\270\006\272\034\251x\322"
+	.ascii	"*\2200d\365\340\332\247\270\324\013ie\304\270\032Q\222\302\354"
+	.ascii	"\334S\211\210\227\274>\017\337\303B\267(\305\205~\037\271\225"
+	.ascii	"\240&\342\247\r\001!L\377\004\262di\025\003\350\227\206\235-"
+	.ascii	"\250\317\t\357\225H$\300\2339\311\270\357\375a\202#\bVP6\373"
+	.ascii	"r\033O\005\213\023\361o\241\303\215\243WV\367)"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.162.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\201\002u\024"
+	.string	"6\246\206I\3200'\035@\222<5\b\3467\213\331Q\025N\251\335\272me\325S\272\201\226'\317\354\007\203\246%2\347\027\254\325\376\351\271\260\240\355\006\321\226W\336\032V3\310;8\365Ajd\370C`C\317\355\375\315\022\262\267\334)\005v"
+	.string	"h"
+	.string	"r"
+	.string	"\266IJ`\\{\317\307f"
+	.string	"\320\017M\321U\255=\361t7\274vW+\004\351\\\331Q\363c\356\n\241\263\321\322=\274\357SH'\203g\n)g\341\240\304\345pN=r3S\244\326\372\312Q\220s\022\350\301\200\365\02779S\304)\212\346\225\223\221;\017\354ZT\360\310\335f\210\024\017\325}\22759\031)?\336\021\232\324Z}\333\205\373u\333>\266E[\356\002\006\244\224\250v$p\330\344O.\317\333\361Y\267\307\266tH\245\301)M\247\364\244\322;\245\345{\377\005L \247"
+	.string	"\273Zm~Y5\003M\341\301\366\355\373^\354\227\rc\277\274\362\275\227\017\321f\257\346n\274\322~\211\013\301|\210fW\255;5\230j\355%8u\201\326\251\310C\300\323y\020\360\324\376\b\223\224\274\3348#\321\223\n\272\023t1\202X\3148\372\315\345\315\375^\210\310\005\323\233N`\261\330\"\370\311\261\311\237\367\262\311JJ\303.\3176\n\270\373\200\210\206\214\314a?\351J()**\340\351.\211\016\n+G\256\217\342H\264\025\231\f<\225V\270\033\247\202:\r\374\312\275\216\356\3516e\264\273\311\237\375\032\350\233xQ\315\347\340\b3y\334\251?\003O\357{\263\005\261\225\024\005-,\261q\224"
+	.ascii	"\003`\330\210\313(\272\214\"K\312\311\212\b\033g\342\b\210e\020"
+	.ascii	"b\243\330\"\223\215\342\353\263n\217\357{+\013(\351h)\374k`\270"
+	.ascii	"5\266\303\265\211mo\256\345\331\fP>D}H\273\201\003y\234\245Q"
+	.ascii	"P\025V\325mcx8\"l\255pyWS:\233\335\211\272; \270+\376\003\327"
+	.ascii	"\203Hgifw{\007\0200~ty\246\373\r2 \240\"1\273:\3552\206\326\n"
+	.ascii	"N\220t\307\310v\257kE\354\203X\226L?\222^7\377nOp\001\333\231"
+	.ascii	"\213\331y+n\207.\234\300'\230\006\207\036\332^~\b\002\376\232"
+	.ascii	"\354\222\354\036k\300\266\235s\022-\3366\216\214.\264\033\362"
+	.ascii	"\356\b?fp\027\346x\274\334\311Y\355.\216\220\032\nPq*.<\004\034"
+	.ascii	"\032\272\257\222\230b\345 k\237\023"
+	.text
+	.section	.gnu.lto_setRssi.part.0.166.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\271\001\r\020"
+	.string	"\346\235fE"
+	.string	"\261&\035\2409x\333\377\367\340\323\357\320\013\223V?G\266v\377'\267\234\326#\231^\310\207\351\226h[k\241G\323\211\323\006K\336Z\245\273\326\327.A(\376\006\361!\016~\375\330\201\215D>\331[\312\224\002P"
+	.string	"T"
+	.string	"R"
+	.ascii	"%n\342\364\230\316q\267\005\306f\367C\360h\003\331c\200\023\300"
+	.ascii	"\036\363 \330\243}\022\266M*\237\354\032\377Dl\001\026K\206V"
+	.ascii	"\216\335\325\0365\304O\327\204'?=\025\324\365\256\247\247\302"
+	.ascii	"\341)\340\260cd"
+	.string	"w\235u\270\343m+\260\275\300N\006\001j\337Wq\026v\307\334g\374\025\020Vdt\036kh\272lm\262\017,\226\027w\232\356c\237z\261\274W\202\214\273\177\302\344\273\334\261}\031\323[&\351`S\036D\036\rQ<\305\351-\023{\354\202\240q {\f\201\035k\3763=\246\313oU*k\332\017\277\271\013\t\376\313\243E\243\274\367\350\217\260\022R\336S\r\301\240(_S\357\372\003\224\0218R^\251\314Iu\261\302\303\325\225\335\221\206XZ\261t\376\373\237\345\212\007gwC\016\316\266\304\033\230\327\274\205\007h\270\360\211\330\356>P\rP+\355\3612\017!\216\344c!\206@\033G*a!\216\344\023AT*m\036\006yN6\355d\323&\210>%\032h+i\036\020\223(\2046\255\002\211\264iy\270\272\362HJQ\254\252.\266\241\3720\036\243\363_\374\001\201\260\307{6T\241\376F\312\f"
+	.ascii	"\231\372\231\277\030e\273\251{\016* `\20216i\033\2012\210\224"
+	.ascii	"\f\214\256\221\241\301\274\244y\306\255l\017\235\255\213(\017"
+	.ascii	"3\206\373\346A,\005\2317\367\"\260\325\325Y\331\240\3058\210"
+	.ascii	"c\"\205\013*\343\203\0016(IC\"\306jn\225\027\231\"\336\302'\251"
+	.ascii	"\307\017\315\316\204\035\211\227;9\253\335\326\224}\003@\333"
+	.ascii	"+b\tj\347\tx\f"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.168.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\r\013"
+	.string	"\226\025K=0M\225\016C\210\263\0279\361\032\310\214\226]\222I\355\320\357\376g;\217~?\0354\330\2061\304\253\241\007\303\260\252\203\203\271k\360\300\300\234\264\251)2,-\222\202@\215mo)S\n8"
+	.string	"7"
+	.string	":"
+	.string	"\266p<\332\277`\333Crg\213\3707a+*\244D\032Z\273\233=\252\204w\327\204\235\377\357\017\257\364\271BJ\013\236\024\207\023\001v\327\016\006w\274m\212m\f\373\004\002\216i\b\323\n\323y\325\377G6"
+	.string	"\340\332\035\275\\\033!z\240`\373\366?\217\215a\326\274\312\023\212\347\251\316\277\035\221\254iO(\335S\035\353\356\003\013\035v\277\214\307\266\201L\336\203\252-\226\203UH?V\3651<\203\346\243|\200\313{\217>\327x<\toD\376\242\221\252z\005\256P\276|M\215|@\201\020\225"
+	.string	"\345+\365d\205\207\253&\007\030\216\033\260\341\004$\260h \256H8[\306\3312\r\246@&\253l\\&\211X\333X\266\f\201\246m\031f;\017WMv\260 \254@\032R=\331\206\352o8\207\212\345ri<j\b,\003\024"
+	.string	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\fs\205\003\247\305\276\302\211W\331jN\3736\363vZ"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.169.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\353\001E\021"
+	.string	"V\237nF\360\262&\035R\331gkO\310\347\327\236\205\261\320p^\253\252Qu\302t_P0\r\004\214\245\2731\330\2641\362\336v<\177\004\006\0066\263HU\f1\023\034\3709].\2543\023!\r\2015U[$\233H\231RV"
+	.string	"Z"
+	.string	"]"
+	.string	"&\202va\t\036]`\364X\372"
+	.ascii	"\3551\273\210\366\270=\376\204\355\230\013V\331D\207\351\354"
+	.ascii	"\310\b\0163?\261\335\345\0365\347\252g\232Q\345\207\234H\256"
+	.ascii	"p\365,]!\206k\200\260\225\225v\367=\317\n!+S\300c\310iw=\312"
+	.ascii	"pk\267\315\300\366\002;Q\001i\215\351\214\351\223\362\245\240"
+	.ascii	"f\327B\321\217\265\2112vZ\270\245\324\202\351\204\367)\021C\021"
+	.ascii	"\333\326\222\330~q\013jB\226#\"GP\354\361<\367Y\374\307\336\374"
+	.ascii	"r\037\227\274\204\266\227\373)b\374\036o\266\317\023s\030L\242"
+	.ascii	"VF\003\311\2433\355\253\370\n\325a0&\355z\bCo\3212\255\241!\352"
+	.ascii	"\240\343\206\215V\372\260j\246#<f\202\\SU\377s\003 vhf\200B\260"
+	.ascii	"\262\310[\332\020\274\274+\265\304\322\225\375\027\207\001\343"
+	.ascii	"\177\360\247\222w=\372*\332\343\265\344%\324c\203L\026\271\030"
+	.ascii	"\331,\202\307\003D9\206V\t$\025\307\032\237\255\336\330Z:\213"
+	.ascii	"\001~`Jy(,\\\312\347y_G`\245A\312C1aII\201\240\204\016\200;\223"
+	.ascii	"\013\310\271\200\\\n\212\003\217\353\300\025\316$\342/B\n\344"
+	.ascii	"X\276\017\3446\333\371l\365\306=?\005\034\341\220\214\262f\244"
+	.ascii	"\313\247Lq\334i~\320ct\251\223\023\355\321\344U\203\304\016}"
+	.ascii	"\356\356J\025\307\246\001\024. \200\002\021#3\017V\204\301(\211"
+	.ascii	"\241|\230\235\366\026u\303V\240\215\214dA+\213\2716rg\360\007"
+	.ascii	"\254?\217\205%~\214O\227\205\"\331B\306'\265V6\201\302\275\026"
+	.ascii	"\330$Q7\314\b7\224\005!\bh\2079\237\307\3344\206\266\022\354"
+	.ascii	"l\254v\253L\221\356\205.9\247\267\320L\331n`\244\275\002\270"
+	.ascii	"4\247,\267^\213\307"
+	.text
+	.section	.gnu.lto_setRssiDbm.part.0.172.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\361\002\r\026"
+	.string	"\326\250\213J\300\222U:\320a\252f\244\372\367'\304\334\234\354+d\322\253 \203I\333\365\263X\315I\363+\252\365&"
+	.string	"\366\360\367\217\023\fmh\241\306=W\021`\300@8H\364\241\374\341y\216g\346\237\221-%\272\242\2254\262\211\334)\005q"
+	.string	"t"
+	.string	"s"
+	.ascii	"5f\004\312\251\305i\277\305]\344\376{1\252\326\022@J\362t\300"
+	.ascii	"\003\214\247\342M\306S\225w\336\307*+\270\367\334\356\25334\336"
+	.ascii	"i\253\254\344\336s\363\326z\243\202\250V\037\202S\023 O\355\257"
+	.ascii	"\260\215\243q\316\026r\337\211z\322\033\362\200Dj\255\345\351"
+	.ascii	"\232x\356;\305\234\337\341\233\372\020\342\263\344\342\211\245"
+	.ascii	"\326jR\304Mo;\201m\006\366n\b\323\253\323\264\212\234N\221\323"
+	.ascii	"(r\232\334\351\323N\217\247i\272\323\3428\275;=\357\363_\300"
+	.ascii	"\264)pT\353\314\260\251\342\320\242\024\027z\f\003\340y\360\241"
+	.ascii	"\330\276\235\034\207E/\211\247V_yz\240\257}\377\305\207l\225"
+	.ascii	"m\017\362aD\260\tR\235\n\005od\3459\335\350\r\227l\017\336\306"
+	.ascii	"\312aH/iI\001i\273\357\303\371@\253l\037\b\367\337\313|\020\233"
+	.ascii	"\332\357nt6nd\200\202\3135\236\242\226\205\242\346\264\344\270"
+	.ascii	"sO;\203\354xtsh\272\343\207l\227\323x\221\265\326\005~\321g\300"
+	.ascii	"\374\235S[\210\305\306S\272\250\242]q\317\023\3722Nt\363w"
+	.string	"|A6/s\352\313\306\323\335\017\235\202 \321T\244\346;\367\300C\320\005\225x\302\2309\234\253\343\025/\326\315\261\307i\022r\2725N\263vzd\0030[\213\313\205\302^4\333\2546\302l-.\t\262\n\rb\265\032m\345W\n\f\255\204\241\225\030b.Y\371\242\325\312\024\023\3172\300h\245\206\331\214V\316o\216YbV\347\335\325\261M\262c\202\fx\007\277\240\222\f\323\222\354\305\324\2666\305\343\307\307N\310Z\244\221e\355\354\301\023\266\356\032\343jG\226\352\340\325\034\270\270\2535\371\375 \355nT{\364j\375\310\241\332\022\335\217\021O\230Z\034\227aB-\031A\250a4\350\020\022\2202$\"\201T\322B\215\001`\002\231\252\264\r\020hXUk\314\002\341\333\231_\337\215+\300\032\003~\220@\302\265Z9\220\344\277\232GG\233\323\273\251\214\004\301\255Qe\327\030[nk\366G\2110\027+"
+	.ascii	"\336\326!\3470\233r\256N\223\334!\224\204\220x\310}\034\350\253"
+	.ascii	"\331\212\302i\236\004\027q\b*u\0170,7L\231iY\016\034\213\301"
+	.ascii	"\032\216LR)\242Exi\275A\232\355\255\272\375\005f\326g\303\365"
+	.ascii	"N\230\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`b\007]\034"
+	.string	"\266\355\244?`*Q:n\364\376\353\020\037\003\207\316X\036F\277=\260v\\|\321\223\357\237'\261\375m\300\022%\255\3253T\ft\t\364\fGc\001\370\352?\363l\013Y\005\031A3\020\347w\377\275e\n\221"
+	.string	"\222"
+	.string	"\223"
+	.string	"h(\213\327Yq;\266^\025\037\246\340\235(\232\201\364\275\023\277c\302B\t\336\262$\330\264#.\024Q!D?\021\005\361b].\227\311\017}$\365\300\\\035\232\303P\016\237c\353\335p0\254\347Ap<v\227F)IC\337\214f\350#\242\365b\200pA\002\237=\013\017\263\377\251\026\234\223\275o*\364\037Q\350\377\341\365\311j\3274\205A\332\275\367N\350\217\345.})\223\320\367CM!\234\277\377=?\276\2426`\212W}>\364?"
+	.string	"\032\001}l\367-I\351'\243\364+A\351Sz\322\237\344\244/\2116\351G\312\304\244\017\211.\351;\242JN'I\377\020E\302\327\326{\344K[\257\326;\031\351\033\242E\370\n\021\266b\207p\227\025\322?\013\322g\304\340\201\205\004\244\277\210\376\240`}\364\025\365\350\227e\365\013\361\350\023\332\321\037Du\364\005\321\034\337dq\234h\357"
+	.string	"6s\312n\364\003]\033\375#\255\021\201\006\377\354\f\326\"\203\263\304h^Ca4\253y\261s\321\234\206*\270j\321\034\001\316|\211\271\037\\\225:\231"
+	.string	"\227\257\340\305pU"
+	.string	"\222\331\321\030\257\263(\\\255\372\021Wk@\336MB\024\006\025U\261\230v\215P\225O1\250\312I\256`d\276-O\264\032\222\331\013\033K\\nO\225\211\314\3122\313\260\027o\365\327LEK?S\226\276\022K_\323\225f,V\232\253t\365/Ui\366Qi\236\302\325|N\351c\342{\357o`\311\276\346\036\237\023\266\256\307\374\036\313\275\033\355\337D\013\311\021\037Y;\264jd\025ip>}|\037g\223i\202\203U\233Y\361u*\017\253Lf\257\243\327\230=\235\312H\376\242b\0342\007>\254+\204\264\233\311\273\260\336\200|\365fK\243\035\2572\220\255\030\215\371Q\355*\326\005=\250\334\205{V\264\032\220\2511y\210\314\224U-\360GW\013"
+	.ascii	"\322\325\234\031\006\340\013\226y ]\2252\263\021o\324\325\332"
+	.ascii	"\311\325\215\362\f\371\243\256\352\250\252|\222\035\030\243\252"
+	.ascii	"6\340\323T\265\r\231\317x\t\232\270\251\232\0332\335"
+	.string	"$\247\213+\nWs';\330\372\022{\037\\\225\"r}\250a\020\307\241T\211\244\214\2444\255\001\320\002\241)\2426\021\220\020e\025\"\"$\201\004\022\220\211:\314\002\323\203\335\270\210\343\367\\\225\n\240\360U$`\207\f\347\025\334\352d~\nk\346\r>\206\005UjK\260\036\215\223<\344\225\325\023\b\024*\221(\r\234j\266\005\013\221 @\3705L\265\f(\310\252\227\031\354X\f\006\207\371\200\310^\370\244\332\246\035XYWw\334H\206\035\2011\356E\337\311\250\024\330\002\345\320J\320\355d\204\2543\016\253\250&\350\3566\030\370\036\267\fa\027\020\237_\f\257|l\023\224$)wI\243+\225\022\234\256\377p\340\254)\364\367\025\267\037\035\262\322\233\221\245q~\262]\0334<\2207\212\270(R\274\227\341K\261\201\236\371a\363/\210\352\007\3332 \002\030p\207\036\270\023\r\374\343{vtm5\304"
+	.ascii	"J\013<\363\005\323"
+	.text
+	.section	.gnu.lto_.refs.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`\236\001\355\r"
+	.string	"&\245c8 \2136\351\001\224\b\b\b\b\bB"
+	.string	"B"
+	.string	"B"
+	.string	"B"
+	.string	"x\246i\232\230|\375-Q\373\370D\3061\375\004\306h\2776\351B\303oC\303\301FM\215\255\021\265F\266L\001O"
+	.string	"T"
+	.string	"U"
+	.ascii	"\004\264\327X\037\001{F\353\033\246[0\217\275\277\336O$oi]r\351"
+	.ascii	"1\373\310\245C\313C\331'v%[r=\005\037\276\317k\nt\344\275\364"
+	.ascii	"\3761<q3X/\221\364\251\312a\314\243\370\371\246\336\330\324/"
+	.ascii	"\351\243\367\020\374\276\243\350\223B\260"
+	.string	"S\336G0\035\302Zt\007\345.\366ty\306\336\314\033[\261}Q\364\211D\217\232\036\231\350\322\304C\232O\211\007\300!\304\021y\004\321\335T\00194\365\314d\200\234r\350\322\303\277\207\207\034\3365\364n\005\360\366\\\372\007\374\016\313oX\317\201\375\"\353\001\335y>\250-S\257p\364IG\267<z\345\361S\307C\216\017HWz#\177\235\034\352\344\331I\r7\334\376q:\024\277\2343\242\253}\321\213]\240_\301\352\237\370\037\357=2y\347\275\206\3243\336\033\260\350\0301\307xy\005\354\232\315k\233\277l>\333<\026\237_\310*'\270\346\026\362J\t.B!tG\321\007\351\240\227\342\006e\340\236\246\005NA\207\244wR\023\2703\234\177\330\336a\353\230\206\327\260n9\3443\254W8\275:\244S\026\017\263\2361o\034Au\346\351\025\317_\237N\001\351\325\247S\237\217\200t\t\344#O\020"
+	.ascii	"3\201\003/JJ\340\245\002\036\223\t\330e\"\032\307,\206)^\306"
+	.ascii	"\242$\267\242\315\265\310\226\035\021\177\026\020_\254\201\340"
+	.ascii	"\013\246\024"
+	.text
+	.section	.gnu.lto_.decls.3a29fe01c06e311a,"e",@progbits
+	.string	"(\265/\375`LY\355r\001\372g\022\206T \fQ:\215\001\024\306\217"
+	.ascii	"\r\305\335\237\017\237\346\317\316\2158\300\345\334\363\313\346"
+	.ascii	"<\342\343\315CD\356\362b\251\314f\002m\3672z(8`\353\341\363s"
+	.ascii	"\b\276T\201]\363SU:\017\253R\343\321\326okMa\363\031E\361\312"
+	.ascii	"\316\260\275\311\336RJ\231\002.\007b\b\227\bI\260\022\274\344"
+	.ascii	"je\270-\376f\234\301\032\247\341\346uj\300jbz,Ia\3754N%\301\336"
+	.ascii	"WCz\013\013\257\206\024k]\237\024\203\333\223b\264\240c$:Rgl"
+	.ascii	"pXW\270=\351\217\217h(\243\323\301\003\353\037\237\r\353\322"
+	.ascii	"\244A\202\265^\2310\204h\272`\034\270\007\006\303c\330\n\207"
+	.ascii	"a\"\270\b\026\303X\330\f_\341,\\\206\201`2\234\003\013\301:p"
+	.ascii	"\020\314\205}`\036x\b\356\302[X\013\177\341\037\330\013\337\300"
+	.ascii	";\256\023\033\3015\216\253\260\r\246\2757\241\032,a\376\006\305"
+	.ascii	"\364.\2274bz\027\f!n\3214\367\006x\005\257\236\325\007f\200\317"
+	.ascii	"\275\367/\222\302\274.\377\325\273^\316\274%\341=\257\336\355"
+	.ascii	"SC\230\306O\313\037\204\237\340D\374\227p\351\332U\021\333\273"
+	.ascii	"|\327n\315\335\373\203f`\031qb\204LT\260\021,\205i\350\344\275"
+	.ascii	"\275\322\304\366\336A\030\352M,\b\273p\362\334\273I\210\225\356"
+	.ascii	"\260\323\037\204_4\t\3020\260\f\271/x[\331\362_\3025W\304\366"
+	.ascii	"n\352\335,\205\203\377%<\363e\f\231k\247\223\367\316\361'\026"
+	.ascii	"\204\243>8\342\366\274z\330\3105s\333\256^\017\007 \001\363\334"
+	.ascii	"\273\371\213\344\277z\377\006\"\260\221\353w\355\256\236\325"
+	.ascii	"\316\200b\202W\314\366nj\240\301\217\006\304%a6\322\036\240\361"
+	.ascii	"\363\372\244\036\300TL\303\256\003;\303p\254\360I\f\326x*\350"
+	.ascii	"\230\252'\215\262jn\267\275\367N\005M\352\350\260\036\336\236"
+	.ascii	"\364)\017\365)\r\365\251\222z\324\214z\324\016\307\320Uy;\302"
+	.ascii	"\260>\352D=J\246\036\355R\357w}\322\243.\324\3533\352\007\257"
+	.ascii	"Oz\r\250^\363\251\327y\352\265\024\365:N\275FS\257\273\324\353"
+	.ascii	"\030\352\363\240\372\214E}\216\242\362\334\236\364\317\353\223"
+	.ascii	">3Q\237\313\324\347-\365\347\372\244\367y\003\257\363\347\212"
+	.ascii	"\331;wo\351)\013\353\347\033j\t\366\375I_x\177\322\347'\3658"
+	.ascii	"\215\n\264\247\202XS=\270>\3511\020\365\230J\275[\031\365O\362"
+	.ascii	"\324S\271>\351\357\232\312\341\366\244\327\273>\351\177\257\344"
+	.ascii	"e\262'1^\260\266\322b\207s\017\353_\037\352\377{w\253\\\347\305"
+	.ascii	"\273Sns\357\346\336\373\"\250\\;\235$\236\275\304\347\027b\003"
+	.ascii	"\021\027\357B\271v\271)6d\322\205\345\271w\363G\003\rv\266\210"
+	.ascii	"\364\325H\365\257\227\372\013C\275Q\256\224\353\244\340\326}"
+	.ascii	"\003\021\317IK6\222\275\233;9k\316\326"
+	.string	"\240\301\372WI\375\245 \275\205\227\202\364#P\377KG\301N\263j\206\027\326\377}r\347p\236|\334\001b\355\344\347F\211\216.MX_\205\372\020\315\333\246\243\304\263\231\226\376\304\366n\376\277q\267\311u^\271\313\344\327\355\276\0357\367v\356\275\203~\345.\334m\313\315'\233i)\313\002\262\3245\341\030\334\273\251\301\217\0068Up9\320\244\372\017P9\\\237T\337\236\364\035\324\253v\227\\g\006\227\3557\355*9\252\324\334\315\275\233;\030\210\232\2675\254\177\201\252\303\265E<U\1773Hsa\341\315 =V\361\355Iy\256O\212v\221d\220\235dhm\267\275\233\025T\246(qH\260~\363\372\244\352\355Io\324\215\213\005\210A\360_8V\177\001\343\346\201*kn\300\222\377l\004H\241\231\344\017\324\320*\344\037%\274\0160F\006&.\374\232\352\277\0230\375\345\346\t\220\366\347$\031\355\302"
+	.string	"a\301\257\213\367\204\263\377\262g#\2432\344\307m&c\373"
+	.string	"_\027\344lR|~\324\307\177?\374\271\310"
+	.string	"\236\341lh\327\217Q\370q\362\317c\330\302\205s;\316\257\353\376\003\205\340\004\310D0\330\210k\370\365"
+	.string	"~\\\314B\376\013w\233_\263\235\335\270Xc\033\310a\031\f9A\223]\023.\034\030\232\201\377\256\375\257\273=\271\003\377\355\313A\300\376\273D\003J\360\017\023~\f\201\f\344n"
+	.string	"sq@\004\236_K\341\n?\376\334\341\277B|\374\270"
+	.string	"\007\310=\376\274\365_\032\367\347\277\023\214x\272P\f\300\013(aC\376\352\372/\3369\370\365\362\177]\006\001\310Y\377\3470\006?\036\300=q1\3703\226\211o\260\300\215\037_\360_"
+	.string	"\277\006\341\317\002\250\202\023!\327\370\257\t\314!\347\327#\356\b\374!C\345\020`\016\326\377\302\310Og\323\034\370\261\004\262\323\217\023\220$\273\370\261\223\005\030K\270\307\334\364_0X\256\202\037\275\372_\002\326BG\3748\0039\351\277&\374y\237\355\206\360c\265\013\346\204[\370\321\021\3748+\001\277?*\342\307#\254\202~\234"
+	.string	"\\\245\177\364"
+	.string	"\200\377=\372/\002\376\\\342\277S\376\233\227A\370s\t\376l\202\004\377\335\360_\270<\202\377\202\370\363\t\021\374\267\354\277_\377\345\361\347\020\374w\354\317 \370\257\331\237Y\374X\352\307S\031i\202?g\360_\274\0240\211\034\342\317\034\254\300\027,\370o\333\305B#\037\345\366\277\037\370\257Pf\376\267\375\257\212\314\376\327\350\277\310\377:\231;\005\376\227p\203d\360\377\347?\001\376\327\345\017\374\331\003\277\300\217\366\374\267\311=!"
+	.ascii	"\370Fgx\035F\217\376\372f\356\351\217\356\374\257\362\237\312"
+	.ascii	"\177+\033\376\237\360\274\023\377\254F\304\232\217\031\376\303"
+	.ascii	"\375\227\373\317\366\023\376\317}\370g\300?\343?\253\177\036"
+	.ascii	"\376\031\375s\376s\372g\233\037\017\300\370\343\347\217\013\377"
+	.ascii	"\374\234\342\377\316\237v\370s\361\317\026\370s\004\376\f\302"
+	.ascii	"\237\035\360g\006\374Y\304\237A\374\331\303\237\r\360g\240?c"
+	.ascii	"\360\347\r\177\316\360g\237?\347\374\371\346\307V~|\367c*?f\177"
+	.ascii	"l\367c)?\246\373\261\007~\234\342\307N~,\367c&?v\376X\355\307"
+	.ascii	"J~|\366c#?\036\373\361\t?\006\373\361\217\037s\375X\204\037k"
+	.ascii	"\3758\353\3077~l\365\343\252\037S\3758\306\217_\374\330\305\217"
+	.ascii	"[\374X\351\307%\370\261\b~|\364\343\344\217\327\037"
+	.string	"\033\177\314\201\037\227\360c\013\374\230\002?\226\300\217M\374\230\304\217G\374\270\001?f\300\217\027\360\343\004\374\030\001?\026\361c\017?\336\340\307 ~\\\200\037g\360\343\001\374\370\202\037s\370\261\206\037c\370\361\205\037[\370\361\316\217o~\214\376w\315\177\315\374W\305\177\205\376\353\344\277G\376K\343\2775\376\373\364\337\027\377\375\373\257\b\377\035\361\337\007\3747\311\177+\377\235\374\027\314\177\375\376\213\345\277y\377\025\362_\274\377\336\375\227\312\177\347\376\333\344\277'\374\027\356?\333\177\335\376\327\375/\341\277m\377e\373O\302\177\235\377U\362_\264\377\342\370o\326\177\261\376[\365\337\250\377B\3757\306\177a\374\327\351\277+\376\213\342\277&\376\013\201\377\222\370o\002\376\353\301\377\274\377O\376\317\375G\362_\352?\336\377\002\024\026\026\026\37694\376\235\031?\003&\b\030L\331\372\032C\350\202\353\f\353\357\b\001\242\205"
+	.ascii	"\321b\351\336\267\251\005\025%f\003D\255i\013k00\035vw\224\230"
+	.ascii	"\001\020n\245e\r\006\271\016\033\302\330k\332\330\321R"
+	.ascii	"\277\003C\375\265\017\247\366q\355.\317^\342\203\023C\363\365"
+	.ascii	"\205\3278\240m\351\220Q\177\355\345\324^z\207\005\366\346\201"
+	.ascii	"\365AZ`\216\036\226\300\037z\307\357\334\325\312\340\2008"
+	.string	"/!X_'\n\027\227\236\342\260\367n\332Hc\206\340x\352\234i,\215\245\265R\251\244\264,3\255\343Z+',\r\206\f\254u\016\342\215\0250\037Q\032\007\372\203\353I\237\306\241\263n\246\226\312\354\035\276\277.TX_\347J\275\266q\365\225S_\3356\240\255\244\204\301\330V\263\303uh\250\277\267-\375u\325u\352\252\034'\302V\222\362\240L\212J\207\334\345\344\013\016\254\257\363B\3755\215\353\3244\360\232\024\006hC@\300\204p\f\353\353(II\351\251\363\354\275\227\366\316\201#\305\223\212\002\372O\346zj\257H\030\334\230\03134\324\335{o\253\235\024\b\002O--k\360\351\032J\367\275PK\322K\205Z\226\200\360\271p\241c\264h\002\343:\206\235\216]\2240[X\237\214~\221\023\245\260\f\313\013\247\233,~Qi7~k.\330\242\350\255\267n\201\367\336[l\b\267#\311s[\321"
+	.ascii	"\3725\323u\013\"\217)#NX\353$\275\004\330\326\206C/i%-\003N\352"
+	.ascii	"F\326\371\272A\206\rk6B\302\274\206g/\365\335\020\333VV@\304"
+	.ascii	"\246\264\027L\260\316kTL\221\342\224\346?\221\003q.\322\322\240"
+	.ascii	"\201\3022\367f\205\352\316\213\363\314\235\202c\246\211^!\326"
+	.ascii	"\317\341R\237\2379\360Y\314\305d3\352\336;\251\271\241~\350\254"
+	.ascii	"\254\200P&K[\234\271\314\263\231\377\351@\021\334rb}2\231\314"
+	.ascii	"\177b\356\223\262\373AfL\224\226\263;'i\223\026\254,x\231\330"
+	.ascii	"\b\376\020C\003\353\347(\251\377=\376\323\255\024\265\367\236"
+	.ascii	"B\233;j\t'\375\357/z/\320\237s\363\275\340\277\336;\001\"h\356"
+	.ascii	"\2459\257\275\367\035\243\216\315)aq\330\250\336\336L\\I\016"
+	.ascii	"\340\222b\342\262\341\344\344\222\252\340\344\344\332ILaI\025"
+	.ascii	"\2426W\222\223s\357\nLLI%\264\244\234\234J\273\202\223sK\355"
+	.ascii	"\026{Rw7\271\2226\223\326\256\260\231\266\322vjIqpb\342\222r"
+	.ascii	"r*IUprrIm'\327\346\331LJQ/\230vT\205\355\344\n\334N-)"
+	.string	"\036'\247\226\224\223\223\353\354\276\275\340R\204\312\211\327\027\326\245sb\332O3\262\224\242x\364\234\232Z\333o\357\353\326\264\243\266\336\336\027\354\235\245\025\345\247d\343>Y\322{Z\222S\322\272\315\275\267\206\031K]Z\233I/\351n=\247\"Z{\027Y\"\3323\366\336\233\203\244\246\336\366q\365\222\274\262\266\214\246\275\001\260\233{\317\330;\351n\275\275w\322\336{\030\225\325\334\373\006\217\223\330\214\031{[\375\314\330YItM{c7/O\244\234\234]ZAtmN\261\355\242\231t\235dhm\261\355\307\025\245:\223\324\266\214\275\367\025T\305\244\250\304`\235\377\206A\232\330=\261>\216\234\232\275\344/\327\371\272\ff\357\354L!\243\343\t\326\307i\252H{\357}_\227\016_\227>o\271\331\357:\263_\336\202:\355-\005b,)\253\203M\325\217$5X\037G\210\232\267\250M8W\031\020\241\220"
+	.ascii	"\221r\332\275\351(\263\367\334\367g\276\254%\257u \247\215MI"
+	.ascii	"\013\326\267\307\365I}nO\232\263\004=\357\251k\354\236|`}\001"
+	.ascii	"\313\2573c\311J\200\264\366\224\001\206h\t^\031\334\333\252\003"
+	.ascii	"\332\265C\210\027\326\307y\241\3769\317\231\3632\225\354\264"
+	.ascii	"\225\270@\214e\211\352\360\23334\232\027\254\312\236\356~\235"
+	.ascii	"\371.\317\021\235\366\2362@ZRZ\326\340\216\262\352\2403\245\t"
+	.ascii	"\214@\254\177c\247\376\271\n\025!R\254\304`=\345\307\004.Jl`"
+	.ascii	"\375\0338\365\367-\312\347t\210{SI\"\266\367\226\222\351>\247"
+	.ascii	"\303\324\334`)\02754$\203{\357\377\331.\327]g\226\222\241\\7"
+	.ascii	"5\320\340\207x\266e\326\224\352\337\200\251\277\321R\177sC\375"
+	.ascii	"\363\223\271\033&\b\366D\345\260\316\3549\311M\352\266\362h`"
+	.ascii	"\235\233LWRmJ\260\376\215\223\232\341\206_lS"
+	.string	"M\254o\203Fu\303Q\252r\222\005\353\333\210i\336<\311\361F\243\355'\347K\232\274+l\316\0354\032<\300\232D:4d5\260\316jy\311\363Zn\3465\016\264\366V\312k;i\366V\332\271\327\202{-\320G\272\204\300\245\3726a\322\224x\251\301\301\207uN\362\263S\365e\207 \326\267\331S\377\214\004\r\3515\344\f\353#M\271\275\367\217\r\230*G\204`}\0337\365!\202d1\035&\236\315\324\225W\226\301\256\030\311d\271H6\313g\327\231\313\362\220_\302L\344\272\271\267\034\226\261,\226\325\242T&]]\236HrY\326\221\271\262Z\224\n\327\345\367\fS\226\2732\220\334\024Sc,ay\356\275\3235,\276&8\3726i\352\335\327'\275\315\216\260,\204\250ucM\t\353\333\340\b\263\251Ro\323\364\003\247jI`\025\326'\232\311=\362\327uf\037y\007\217*\331G\366J\n\344"
+	.string	"-)\354\314 \272fFU\230\352\023\353\324\023\333\324\023\221\250'\032\311[8\r\026.C\260>\361\207\232\265\210Z\352\237s\\\301\317,<&\034\270OG*\255\3063+ci\271(a\300\362\3253\326\177\365\362\215\333\246\346\303\031\006k\274\257O\232\255\202\236\257\3225\2041\334\260\336\261\221\253t\240\021\2571\271\352\317S\231*\327\300\251\240\2270.@\231\006\221\251\271C\334\"\210\303\r\353\023m\250\272y}\322\273I\001\345\020nY2\213\312P+\254\254\224`\235\241\226\\-\035*6\263\033X\347\031A\317O\037"
+	.ascii	"\361:\202u\3162\216\207f\327\345\026#\303\2601\323S\022l6\367"
+	.ascii	"\336?9B\236P=\260\376\363\213\254\024\346KR\022\326\017\261\306"
+	.ascii	"\207\330[\032 _\320\200=\263\022\036\024\362\324B\030&v\246E"
+	.ascii	"\220\334\"3\345\245\334\224]\344\244\354t\235Y\t\027>\357;\310"
+	.ascii	"\224\225\260\232\255\224\344A\335\326\327\230\037\r\206\316\277"
+	.ascii	"\030t"
+	.string	"<Z\347\366\244W\273\250W\357\324\253p\352\325\246z\025L\275\252\245^\245R\257.\231\031#\366\\\303\032\217\301`v\300xf\301\\f<\237\030\020\213\301dp \026\304e\256\023\217\301r\307a\360\337\177\232{3\3411\370\213\352\202-\306%\234\202\365v<=\375\260\027\017\232\242\210O-d<\245<\214\007MQ\304\246>\2531\270\016\333]=\253\346\236\032\366A5I\031L\267p!\"\310\243\363\276>)\210\333\223~XF\375\320O\305]\350~tqq\207\365\207u\352\207o}x\213\026\\\226\245\025\306H\237\226\233(30\\\360\035k\271v\371\fp\f\032\254O\006\357\375'j&+_^\366\336D\207KMS\213\007\306\222\367\267\305\351\n\326\037N\251\277N|%/iK\226\022\3268\017\343\2415l\330\200\303\032\343a|\207\255\034\343\341*\337@\304q\2300\236\336[\351^\013t\356\265"
+	.ascii	"\255\013\242\264\226\352\017e\250'\243c\305\257\t\017\254\237"
+	.ascii	"\242\261\273m\251\215\026h\342\260~\n\250>\355S\177\034\005\312"
+	.ascii	"\0041b\204a\375\353\304P\350\210\352\234\334\236\034\323\265"
+	.ascii	"\341\354\r;O{Wh`\215\343\360\334PH\0164$sN\356\336\340\316\232"
+	.ascii	"\251V\032\2772X\377\277N\334"
+	.string	"\004\3135\367\217\216\302f\345\f\353\247Q\324\223\271v\377\211hW\0310s\030\016\277\335\254\225I\313j\002\005\t\013\343\306\004]\273;\242\2045f\303m\327\211\231\\/\321\332\316\275\2339Y\251*o\016\353_\240t\247\260\260\260\360\002\245?v\256\335\246\326\231\032$\307k?\016njXGyZ%J\232%\203QwRs[i%\005z\240\346\313\027\273\301\355d\0054t\242\031s\205\3674\313S,\033\210H\365\276\264\304)I\365\362\032\bF\260\276`\235^\271\216U\036\224'\326O\255\244y?\321fl\207\263\f\353S"
+	.ascii	"D\375\001\226TIIa\235\336e\266\264oI\236\\:\345)\225\237x\243"
+	.ascii	"\244\256\211\017\353S\320\245\246uO\355~\342\345\361\244\267"
+	.ascii	"\207\365)\310\241\376\251\224\237\210\023\bV\365\003\353Sp\245"
+	.ascii	"\236\202)9\271\224\356.\331P\227\t\025\2273\203:m\204l\201O\236"
+	.ascii	"\322\375\335\240\251jz\202u\332$\305\201j4\324\314\245NflE\201"
+	.ascii	":.\361\"\023d\302$\205\373Qw\022>*\317\234(I\366\b\337\236\302"
+	.ascii	"m\371]}a\235\272\3558Q\363\003\322\267dI\312&u\363\225\265\345"
+	.ascii	"\311\371\224\355o\307lM\\\r\254\323\265)iii\223\t\237jc\354\354"
+	.ascii	"E3\277\201\261+L\203\3657<){Y\232\344.\331P\033\320\206\240!"
+	.ascii	"\031\\\323\005o#y\232\344sliv\200\301:5K"
+	.string	"\321p\250\266\006\347R\264\364\310\220 O6\246\220A\373[J\3172\024\034\346\t0\315\334\177\342%sr\006\207\3657\250\021!\222\222\245oK|Y\372\353L\022/)YZ\204\360JK\r\326\351\330q\007\023)X\177\003\016\365\033\252\304\304\364\324\345i.\361\345\211\355m\005t\203\005\216-\354LX\230\236\372A\343S28\202`\f\275%?~\244`\rP\013;\243\303\307\003F\f O\301v\226\310\300\232\210\345\230\205\351\273\022\343\301#\355q\227l\250 \252#vf{[\001\341\244\235\331K\222~=\355A\206MOI\215\377\304\364\nT\2323X\177\002\2454G\232#\365\272K6\324\005\264\261\262\034\203{[\001\3310]\005\346H\273\236z\325\r\211tI\n\202u\312\365:\255\266\271+\254\323\255\327\335\370\242\212\303:\325z\235\212\346-M\013\326\251\216\327\341]\351\322\361\272\032thyX\037"
+	.string	"V\324?\275J\257\322,\021\266\322\024\007e[D\250%@\326`\235b\r\313tx\211\303\372"
+	.string	"pKo"
+	.string	"\300\210\372\2476R\033z\007\020\317f\352C\222\0222\031K\303\372"
+	.string	"\250J\241\236\326H\241\322\030)\232l\276\272\n\237C\236\274\250a\235R\2454\322\251T*\215\322`F\375\323\031\351\fM&\002\317\336;\254<\331QV\035n\006w\304\325a}\rR\324\337\263\213^9\n\006\r\203\376]'z%\215\021\264\264\225\344@D\221\322\211\243Zb\207u\n\343h\030\024\313\t\006f\301\372\032\230\250\277H"
+	.ascii	"\321\300/b\320\347\206%'\021\220xy\222A\315\\\275\036\0160\202"
+	.ascii	"E\020}\352$U\330\333+]J_\244NiS\312\224\272\270\316\264\005:"
+	.ascii	"x4\f\372\367\237\264\005:\306/m\201\022\246IW\317\212g39\321"
+	.ascii	"\300\006\006\227\036\016\035\r\3700\033\226\234DP\022\346\231"
+	.ascii	"\356T\351:\323\244\3774w\232\204\236A\013o\232\360\001\261\323"
+	.ascii	"\240A\216\030-~X\251\376\321Bt\215\\\363K\020kT\215\225\r\274"
+	.ascii	"\026X_\303\227\372\243h\256\023M\243\2221\243{\230)?\272\274"
+	.ascii	"\324k\310\241^\203\024ZF\355{\342\270\202\3655\304P\257\301\205"
+	.ascii	"z\rJ\352\177\316\250\377!\243\376h \372t\336\215\271\362\304"
+	.ascii	"|y2\226\260\376O\240\212\233\327'\005\272=)\352\207zA\277\374"
+	.ascii	"\304\235#Ox\304a\375\237.\352\321.\377\211\024\370\201%\016k"
+	.ascii	"}_\227\242[\216r\371\211\030O\210\330\f\254\377\243E=\252\005"
+	.ascii	"\355\373\211:~aojX\377\307\212z\224/\256p\314\025\326\350\236"
+	.ascii	"\332\364\343$\003\033\034Nt`\241zG\367~4\013v\312k (Tc\006\353"
+	.ascii	"\234\333\223\242X\202\216\352]\261{\246a\215s{\322\377\200\251"
+	.ascii	"\250\025\324\nZE\334{x\265\365\247\026\207\003\353\377`\335\335"
+	.ascii	"\355\241\215\233\"zP\376\260\376\017\f\224\nJE\213\241rf\365"
+	.ascii	"\334VV@7J;\207\036\326\317@\250\242v\250\035*\205\270\267\025"
+	.ascii	"1=\253\276)\254\237\341\017\215\202FA\245h)\233{\2420\376\226"
+	.ascii	"\264H\271\351\"e\226\004\353g\300\362\344\tJ\367\033\245t#%\334"
+	.ascii	"\322\221\242\245\320\nk\224.\303\024\324\211\223\f\316\2677T"
+	.ascii	"\316\247\n\235\324\224\034~h\334Q\271\f\264\215\211\301\032\205"
+	.ascii	"\313o:2\270\240\344\310`\244\215\311m\343\240\304\263\231fd\211"
+	.ascii	"\005Q\237\201\013]C\323P\347mS\367\023\365)\b\3263\303\225\372"
+	.ascii	"\fO\352;\\\264\231\206\252\3450z\273m%\252\240(t\273\3033l\365"
+	.ascii	"\030\236*\212\206\242\241J\356\336\201\"\350\244\320$G\225\344"
+	.ascii	"x\361\211\331\300\032E\202\361\210QXU\246\302\374'\332\220y\001"
+	.ascii	")\202\3651dQ\315P\"\350\031\331\023\206<\365\030\246\250?J\206"
+	.ascii	"\022A\215\220\311\3000\247\036\003\033\032\206\022A\307\310f"
+	.ascii	"`8C\205\240B\320!^d0\236\250\330\321!\303\251:'W\030\276\324"
+	.ascii	"c\270RQ0\024\354\2031\300\266'N\232X\037C\f\025\365B\275\320"
+	.ascii	"\037wo4\272L\226\226D\b\326\350\017\342 \226\234 \326h\217\314"
+	.ascii	"68\210\245\t\326'\203~%ar\204\013\375ByXiyB$'\021\253+\313Cw"
+	.ascii	"\340\032Z~c\374\260\276\017\032\025\345B\271\350|\260\344\310"
+	.ascii	"\201j\251S\262\200\210M*jZ:\216j\371\300\241Yh\226\236\372\342"
+	.ascii	"D\314\211i\217\t\353\373\220\2417\320\033z\212\001qh\317m\225"
+	.ascii	"\005\244\013\357\264\234:\254\254.Y\226%\246"
+	.string	"'>\254\357\323T\243\006Z%\202\317\n/>\004\261F\253\206\214u\311\300\372\027\304\250?:\343:\321\031(\225\bZ\233\006P\022\265\2603;fxV\236\250\324Q\252\037}B\241\320)<\264\301%H\025\254\217l\0314sb\215F\005\035\225\272\211\303S#\004\353\236\333\223^\330\327'\305\315\333\223\376B\023\365Gc\2401r\215,F^\274\320S%PK\3132\013\343\326wA\b\352\002uQ\2476\0342\345I\005\353_\200\241\036]\272h\013\264\305\265\373\331Ib8\214\r\271\220\244^%\314v\321$\215\006U\002\322\333\255D\031\240\330\031\365=\201\352\257\327h4\2720c\361(qmb\221\2620\317\236-\352{\252\250f\376\rDh4:\315\265\273\273i\263\020+\373\353\201\033\034\324g80\355\335\264Yh\225}yn\253(\302\3533\252[\333&\323C\246\276\307\353O\013\376i2c\256\311"
+	.ascii	"\002j1e\205b6xU\372\266\002\257\305\310\221q\231\303Z?\257\035"
+	.ascii	"1\b\024.Oz\256\324\367\270\340\242\277p\321`\300\370\371i/\202"
+	.ascii	"\201iY\2038;\330\300\222\272\\{\321AR\367$\264\220F\275\005/"
+	.ascii	"j_\337\230\005;,\232\017\213\336\323\323\323{\037\220%\021Sw"
+	.ascii	"X\031B\225\345:\365\036\212\006\305B\234z\013gv\032\317N\347"
+	.ascii	"Y\271\316\313y?\306\234\267-m\314\212\007\326S\246\350\2732i"
+	.ascii	"\224,8w?`p\301Z\337\t"
+	.ascii	"\361\373\241\005kM\345\266\251%\r"
+	.string	"\351\213\373O$\n\222A\203\206\365-\fQo\201K\275\206r\265\024)\271\306\215R\341\272\346\236\026f\250\277\271Fz=w5\035\335\265\0031\204[\242\362,T\177\257]z-w\265\023'\371M\204\2554\205\301\331\237\372\233\337\322\270\2702\265\nul\372\215M\273\265\265i72)\231\324\216\024\263%6\254\265\333\032+e7\336\376\023\205\352~\fb\375\nb\352+0\251\277^\273N\275\226\253\200\320\324\230\220\321\201\207\365y\236jjgIw\352\257\323tZ\206:\312\264\275\314\304\366\266\352\2203\344\b\333\022\326\347\221\242\376:I\222kw\227l(\033\027S]c\006\367\246\322A\253\001\334\342\003\353\363\210\251\307U\256FC\303x\267\271\241\022 \225\226e\206C=\306\273\372\354\f\343\375\354\244@\020e\201<2\312\312l\004\356x)RD\223]\251\275\225pp\210\"e\363B\006S\232&\313\353"
+	.ascii	"\240\013\261-X\177\207M\3755\221_\247&\222\001\201\2646U:+3y"
+	.ascii	"t\202\211\304A\266G\303\rB\030\025\031Q\037%\262\310\266L\345"
+	.ascii	"\322H\374)\301\250\310H\374QO\344aH\211d[\346\207\365x\2244*"
+	.ascii	"\221\037X\346\321\007\f\311\344\221R\271T\016SX\262D\355R9TQ"
+	.ascii	"\\\223ze"
+	.string	"\217\2144Kdd[fz\"\017F\314\242\017H\354\205\026\2514a\304\034\001\211%*\221E\b\264H\245\211\034\346\2225\"\213R\235\023}`\262\353\n${l\205\230#0\221\311$\262(\235\340D\036>Pp\\\223\310\242\262\002*4\200p\001\023%\220\030!\004B\211\n\214 D\002\205\020\t&*\234\310\303\007\343qM\246(*A`\232X\331\243\266\270\252\3409\221\007&Q[,\002\200\315*\324\223\254\020\200\nX\030-I\\\320\236\310\303\220\321\207!#\243\362\350F\251\002\243L\241!#\234VH9d\204*\207\214\362\n\002$S3\231+{<\026\207,\214\226F\315\266F\371\270*\207\220\311\342\360\2702\217\264r\211l\215+sxVh\310\310C\016\013\266e\"\207V\024\026\034W\366\b\311d\242`\"y\332\025\002H,OQ\n\236!\233V\271\032\331\365\004\222\311\034\032\256\354R\305\372"
+	.ascii	"\013(\030W\"\022Hl\216\332\201\007\245\321FE\200\007$\223\311"
+	.ascii	"\n\265\313\326&\307\003\017k\021\262\025Z\331\035\235\242#f\016"
+	.ascii	"\341\241\350\210\211\0169\360\300$\336T\020\221\223\303D\261"
+	.ascii	"2\331\242\321\016\013\266\210L\"\221\216\212\023\264\306\225"
+	.ascii	"E\226`\321\"\223\305#\013\240\240DN\240]\231k\321\021se/\024"
+	.ascii	"\031\235(J\341\204\317\312\216@b\177\206\224H\246\t$\266\007"
+	.ascii	"\003\246\t,\212\311\265\004Rq\204uUbh\221J\023Hl\312d\217\222"
+	.ascii	"\311\021\030\024\2458\252)\b\017E)\216EGL\325&\310CQ\212#\023"
+	.ascii	"G\247(E\t$\223ya\003\017E)\216L\236\242\024%\212R\224\250\300"
+	.ascii	"4\001\311d\2420b\216\3202\213\311\036#\346\b6F\314\021*\f\221"
+	.ascii	"L&\212ve\352$\221\255\322\004\024G\345j\304<b^`\256I\243\242"
+	.ascii	"\"\t"
+	.string	"H(\214\220(0s\230&\264#Z\244\225\002H,\317qe\221G\037XQ\f)\221\305\266X\002\211\375\301\300\204\243rm\213\311#c\262h\354p\202\231<:qD&\213+\224&\214l\317\021\231,^ \004$\326\007=\221\207\241\243\024\353\361\3031\211<J\261\036\227#\020\327\343r\004\245\t\246\t$\326\302q]\201\\\215+\n$\226\207=Z\"W\024\211\326\0070\231\313\t$\213\312!$\tG\345\210\326\270\266\353\321\002\f|t@xh\331\242\221\207\365(Y\274@\022YT\201\204\242]\207|Z\345\321\222\204N\nE\024F\026eQd\331\021\0260\327!eq\004\363X\\Y\r\312e[d\217P\260H\032\031\025\003\200d2YmSl\213%\214l:\002\006N\230 \201\004\024k[<\032\035\345$\223GJ\236d\362H\271C\002E2y\244\314a^\300\024R\206\320\256\314\025\305\220Q"
+	.string	"nD\262\253r\035R\317A\007\007\350\300\003\244\341=P"
+	.ascii	"\b\005\200H\357\201\002\202\202\024\320A\220\372\016\202r\333"
+	.ascii	"\n\025\333\344Zb-B\2667Lvm\333u\002F\226\347DC*\326\2431E\321"
+	.ascii	"\003\004t \202\203\020\033\004\225\200\002\204\021>Ek\313dA\302"
+	.ascii	"\016\313\202\240\363\235\366D\036T|P.\213\212\226\306\tP\270"
+	.ascii	"L!vm\223\310\020\202Z\243\233\265-\266L\264]\205V#{\264$\241"
+	.ascii	"\025b\232\260\026![\225-\022\031u\333.K8\256((\221I\225)\244"
+	.ascii	"\\\"[\344Q\271$\241\\\"\2134\254BG\023H\313\024\303\243\211\365"
+	.ascii	"\270,J\221\326\243\322\304Qq\247=\221\007\346z\\\026i0Z[\022"
+	.ascii	"\216\312u\310\0242\352\030\255-\t-[l\231\304uHYd\321U\350\306"
+	.ascii	"\210\034ZN`=.\213\210\255\320\006!\210<0\223K\266U.\215BF\366"
+	.ascii	"\203Q\305\206\022!Z\242!dR\005O\n\313\244\016\321\020\222h\347"
+	.ascii	"\030\"Yd\333\243UI\\\223m\273d\211Z\241c\210\243\262\230\342"
+	.ascii	"X\\\217=),\2237DCH\"\241c\210\026Y\204L\342\034C\254\307e\221"
+	.ascii	"\320q%2\266\310\024\230;\255\362\310\210\263\266E\024D\314\225"
+	.ascii	"U\261\242@bs\330\366\2042\204b[,\221B\021\305\261\270\2420\262"
+	.ascii	"7l{\302\2022\004\346Q[lI0\262;l{\242'\271\\>@\bU\206\260\026"
+	.ascii	"\025\331\020\230\314\325\270dO\030Y\236b[,qSl\213%\210E\310V"
+	.ascii	"y\204\002\211\2550\0342Bbm\214\212EF\026e\327#r\305\2225:\256"
+	.ascii	"Hl\262\210dWf\005\2445itTBE\262Hd\263\036\221,\273\256X\n)\221"
+	.ascii	"\034Z\241\341P\261\204%Rh\350(i\364S\241]\231+{T\"S\b\265E\246"
+	.ascii	"P\321\021\333\242\260\0321'\300Y\223E\243M\313\256+\224H#{D\026"
+	.ascii	"\241Jd\221\212\202q%2\"\025\213\324\035f\262\270B\271D\266\305"
+	.ascii	"\344\322\210][\245\t#\233\201\271\256\354\320ZbM\016)G\024\025"
+	.ascii	"I\2540Ra\341\230\\\0221W\226\250\204\265-\256@\266\306\021\353"
+	.ascii	"q9\002\213,\376(\221\306\225y$\204T,\022Bbo\214BHGE!\244b\321"
+	.ascii	"\016\223]\262\354\352\223\266+S"
+	.string	"\205\212\345\315j\304\242\255\240A\205\212e{d\254\200\211D*\n\r\035\245X\217\355\221\221\022\231a5b\321\n\255+\220mq\005\222]\217\033\330ek,\252\020Z\266GE\241!%\222\250].\213\230BF\366\347\270D\262\253\221\220\n\243\244\320ZTdU\b\031Y\246\020\222\311d5\264Fk\313\324\253\212\"3\211,\206\200\304jh\205<h\225\310\243\341z\\\026\351\366D=_\032\255\354\207v\271d?\334 \025\2132Sh\b\251B\271$\261\016)\213(\222\253RY$\"\201\304bh\205:\bj\225\310#\365AA$8\230@\001\b\250F\017H\354\007$\366\203\022Y,\372`d\231\037<XP\"\213\362\377\341Z\323\317\353,\006^\222&\331\221\333\202\352S\313\200\303\346\231\023Hs\230\026\266%H\327M\023\0174\203J\206It\274\360\200ru\214\236\325hQ\005\353a\331\260l\210\326\303"
+	.ascii	"S\266\276\306"
+	.ascii	"\f\321\206G0\225\263\n\217\341\221\341\331\227\270&_\371\217"
+	.ascii	"\230d\310>\033\232\341B\364\017\n\326\020\254_A\241\372\017\215"
+	.ascii	"\220\321KwTYE\300\f\207\f\211|8\366\341\030\036\216\345\302\302"
+	.ascii	"4\211\026&\251\330\236\316\340]\337\013!:\017\255\213K\352\021"
+	.ascii	"\226\267\330\324x\262\002\f\222f\031z\3115a\001sS\267x\234a\002"
+	.ascii	"\242\247\364\333U\217\256\037"
+	.string	")X\340\2212`>\302\304\bvQ\202\365p\307p\307\360\213\270\243\0049\344\r\031\362\370\360+\005\2041\305\245\0021j\216\034\303\256\017\316\242\224\271\242\365a\327\220\213\351\315\352\r\353\341\326\3651%\311\007\326\257`N\035\352\3105\370nx\341R\301\233\372\017qh-\033O+.X\247i:\020\002\026U\024+\253\341\r1\n\340;s\365\341\r\215c\315\232:\2611\033\251\027\026\215)/)\251a\r1\006\250\023,\313A\343\303\032uM`\306\354a=\244\032N\371P\377a\224\026#\200\013\031O\260\036\302\030\302\030>\335\250(A\001,}i\2222\214\361\341\323p\006vr\275\2502\2341\224A\\\"c\353H\323\207\025\301\270\n\242\324\177\370\342\355\306\312\2224vN\250\222;\260+rX\017\227\206K\303&b\222\316\027>@+\303\026\0376\3450;^\276\352\356\260\0362\345\267\2755A\314P"
+	.ascii	"F\375\207J\372\356\302\030\363t6L\312an\322\026'\220\341f\323"
+	.ascii	"{\202h\372\nS\270\341\230\222Y\341\232\034\347coJ\241\032:1m"
+	.ascii	"-\322`\335\304\201\202\002\242\2055F\222\364#\f\353\246N\220"
+	.ascii	"'\0378\bQ\252\233B c\326\006{\354\370i\355\220a&%\313xsdeej\274"
+	.ascii	"\375\351\305 \243\241\216\270Ai\033\243c\244\311U\225\021\324"
+	.ascii	"-\314x\334\261a\r\006L\032h\006\"\r\36340}J\245\211\221\222>"
+	.ascii	"S\300\033L\214\300\035\271;\246\270\230\372\313Cn\224\031\252"
+	.ascii	">\nR.?\227\324\313-dq`E\003\310K\332\005\t\030\026V\332%\365"
+	.ascii	"K\313\312\262\360\375,\031\313\201\365)\200S\377t\213&#\262\244"
+	.ascii	"\304J\332\227\327\3008\013\203\322\242w\234@\002\307\224\362"
+	.ascii	"e3V-\002\206L\250\243\341\343rP\260\005!%\231Q\b\325\310\320"
+	.ascii	"&\031\016\243\025@@@@\032\024\013\307U=\023\200\203\n\314\245"
+	.ascii	"i\036\007\031cfhDD$%I*i7\323\353\001/x\336\0228I,4\223\327\025"
+	.ascii	"yO,\374\361O\352XI*\375Z1`D`\"\366\330\0021\304/\215\006\214"
+	.ascii	"D\005\211\243e\376\326\003\367\016\353\037B\262\270\302z\376"
+	.ascii	"\022\363~\244\307\365t\3301\032\031?\331gX\226\027=\247\212\306"
+	.ascii	"[\221\306~q\244\026\336%\2735L\306\266.\306\253n(\036\016\033"
+	.ascii	"U $\004\002\262\226\323Aw\365/\220\n\363\031V \210\231|@\313"
+	.ascii	"\n\004\265\271\324\303\314\210\013\r\031y5\242\237\241\365C\001"
+	.ascii	"\021\275G\334\370\247&k!\024<\245\200\023iA\313\265\341\370\236"
+	.ascii	"N\033\216\023\320da\002\007\032/\264\216\357\242\221\216\224"
+	.ascii	"S\226_\367\333\206\321^\326!\211\250\211\246&\004\205@1\023\031"
+	.ascii	"\245\022\363AF\340t\352\227!\212E\270R#$\246\244d`\201\274\251"
+	.ascii	"\207\355\021m\204[C\361\027\202q!H! \225\336\006l\031\317=(Y"
+	.ascii	"Ey\232\364hM\n\326\364V\362\354\031\370\300\323\356\331\342\227"
+	.ascii	"\320#\330\354\013K\221\216\201\356\031\326\257\310\t\236\001"
+	.ascii	"lI\325aSl\205\352\3013i2\341Z\206\201\027\254\355}#\234\217\316"
+	.ascii	"Vf\3732}x\370\343\200\363U\234\315L]\223g\320\013l-{\203\322"
+	.ascii	"T\224\347\024:Q*\326 \221\273i\225\336\213\304^\275\242\245D"
+	.ascii	"\264\035\314J\210\024yNo\276[\013\3202\025\220\305"
+	.string	"-\230\360\306\363|YAh\244\005\r\220\002'2\352\2029\034L@0\3169\260\260\320\\,\214nLJ\351_\252\375\300\214\247\300\tB\347\232><.7r\340\030\310\366\344f+\004\271\002\237[Y\367\362\370@\250\314\016d\316\213\321P\033\347\224\234\236\242I\306\225\260\\G7\nZ\202K\201\306L\376\314f@D\221\024\232\255qJ;\265O\"d\365\016\247\227\343\027}`lz\304\330b\243\016\325\213\330a;\f\341\375\304#P\345P\205\005\245\341\255S\211\265\372j\223t[P\016\301,n\267\002\260Nh\361\304\221\220\362R?R\357\357\276\345\316\254\207\037\226\022\352\201\362\235\221\004\013(\203\2113axC\373\237fp.7\215@\274T\267\250\235\246;<\366.q#\372A\231\222\264C\217\0300$y/\207d\217\344(\301B\202q?~H\332\\\351\0038\371\007%\340 \363H\261xzb\367"
+	.string	")X\013$\005\222\240\036\231Mq\025w"
+	.string	"\225:\201\375Am\350\241\021\n\"\350UY\230a\f\231l\272\221\375\2674t\035\347\304\302\253#\330C\037gdAQ(\247\254\373\215\036QZ\373\362\260l^D\355Lz\177\201\f'\001\272L\366z\355\021\344pG\226<\242\004\332\322\024\374"
+	.ascii	"\226\264\352OWB\017%\340\361\230\330ufP\242m{\202\007\375o\214"
+	.ascii	"\262\214\374\023\305\343\247\2723\262\250\370UJ\376\b\022\320"
+	.ascii	"\361\n1\006\"\302\206\266\301\240o\311"
+	.string	"\032\323#\263\r\246\242U\004\005\024m\215O\335I3\355\243`:\037\345\205\256\202\207\242\267wE\200\262\364\"W4\351\212\325\2518\217\007\300Br\267A\237\323|\207?\226\240Y\177y{t\3657\320\332\345\0254s\230\377`E5:\r\251\264\267\363\341\017\002\321{\271\365P&`\305E+U\304E\351\322l\216\345z\3576t!?\023\201-\306\244b\226\201\344\315S\002\311\200QX\207AS\333V\265\2770\244:\257#].5\357\311\t\324\0029F\231,5\205M:\036s\202\2142\263F\361%D\340\370O\233Qx\302\341s\350|R\202\307\215?C\262\232\267\315.\251\235/\365k\026\320\211\224rHH'\207\241s\3022\303\032\210\274jF\375\320,V\366\206u\302\232\332\005\262\2434\237X\212At\f\230\211\343\327!\3437\343#\243D@\273b\321\300\210`'$\242\352\b\273\3735\354=\200"
+	.string	"\2528\246\177\360'\315\006\002\320\237EK\002\026\322R!\031\215\023\320\242\005\304G\261\201\005\034\005\326\264\342\340\236\005\212'\372\272\214]\r%G\347\302\344\331I\321Ck\232\227\325\306,\307A\2407\241(\223\007%&M\255g\001C\342Z@6\177\271\032]N\b%\325b\313\036\020\246\024\303\306E\344\300\212Ha2\272\265\005|?\332w9\252#\325\227h\362\367\275Q\227\334"
+	.string	"\001\r\257-\307T\335(?\2240\006\321H_F\263{BW\376=\252\325\003\3061\362R@7\311\022i\240\275\214\001\223\263{\027\323\361[\323k\312\273Ki\320E\3408\007~3\254\2650\343\342h\342\313\020\206R\024\341\362i\020tH\347\331\306\365\027\016\330J\021(,\033q\251\034\243\220c\036\035\275y_0\273\266gV5\267!~\224\247\003}`\312\272j1[>\025\006\r\021\025\216=\332\001\377N\253\215\210}\235\300\231\235\212\236\022\005\251)."
+	.ascii	"\305\331\224b\274\213\033\347\224/\016\222wq@T\247\302g\346\303"
+	.ascii	"X\244\27605\251\323ur\337\2240\334\242\231\353GB\246\245\357"
+	.ascii	"_=\314\347\227\266\017\341\353\217\344"
+	.string	"`\262i\201X\277\247{\370e\216,C\276\206zg\331\241\315L\365\304c=\004*\376W3\263\360\315\363\030,N\363\365\3258\270\034\240/*\346\307\034\221c:^\261\216\225lO&\203;\371\"Pbe\031\327e\376Q\300\351e\231\230\261\263\252[i\020Z\247\355\211\277\240\241S\246\036\nvz\316%\257\3138\315 \302G\223oUg\273y\313\240\330\322:\274\227\0337M\222\327\311\207\236\331\343'\237\336\210\304e\371{'\030`\240\252\351@l\025X\b\212W\265\032Q\222\276\001\261\034\003\223\334\246\322\263?\0347\312\263&\t\357\313z\203\342\347\016\267\365t\236@\221\320\b#\360\326}sp\250\203i"
+	.ascii	"\221\223\355\257\340M\211\007\\\2210\237Qt\311vB~\332\371Ju\250"
+	.ascii	"e`\266\341\256^\230dP\210\017\373 \031\307\266\032\215V\024`"
+	.ascii	"\321\200~\320e\3371\367@\221\026D\213\355\352\tR\361\365kP?>"
+	.ascii	"I\2760d\215\374\027\217\347\315\302\320BBL\356\261\037\0011\226"
+	.ascii	"\">\220\211\223\272:\323\n\213\202\321\330\354k\345\305M\f\315"
+	.ascii	"\032\201y"
+	.string	"*\300\216\277cF\257\363\251\370v\261\037\0244\023\323\271\215\376\325\033\222O\3522E\257\266\347+4\265\206q\322\037y\205\235,\200\256\305W\024\323\272H\f*O\220:\364\211\006\371\277\254=\353\022MI\207#\004\237\316\271\227\273{LqI\177\267\037\264:\224\244\035{\204\241\250\023\312\0302\225\201W\301\003\365\023\304\201xod\231\302&\363\201\202\241o\333\217\317/\303\347\005\250\357\302K\257\005\315\013;\303\021=\242\343\206\260\203'\343\240\203\214\224\b\207\215By\263\025w\022\302\357\356\355NfA\023J\320\275\257\030[\207\226a\363P\244\002\241/\245\354\2279\211N\2509\212\303\271\272\340\\Xl\n\323v\275\017\003,\320b\270x'<\\\370Y\272\250\255\325\277\346\254\r\234\274\342:RZ9\\.\360=\342\270\214\234\320\377\325j\003&Ywy\377\352\f\310\260b\262z\230=I\204\303N\317\330\212"
+	.ascii	"\210"
+	.string	"\rQsas\3020\354\236\364\266\350&\326\271WzW\324C\217/\354\345\260\372\236E\306\277\016\227\037f\201\301\216u\r\255\025\226e\200K\342\302}\311F&\020\306k~\317c\273XA\345'\377\223[\346<\267\301\022\333\366\204EY\344\220H\304\212C/\273\360\353\230\004\205\006s\333?L\370(\027R)9\013\324\331\005\351\264\354\372\207(\265NN-\202sW\327\331f\301\276\212\3233\263\256\b\017\265\211iD\271\210|\246\256\263e\2755#\214\237\b\210\210\310m\376\3559Y\303\266\311\036\005\200\325\253}\347\320\230\317\302<\350i\303am\311\235hW0un\030\320QJq\236\n\033\367\244~iZ\236S\267^H^u\n\t\020\272\225\207e\206\314D\016\347nY\350k\363\342\217X\177\251\342\262\326F\345\255\341-l\327F\205\305\213\031\020\n\222\260\262\2079e3:\370x\342o$\335\230\236\034"
+	.string	"e\211d\315\034\256\n\347\36292>\250U\004\375|\245\376j\274\020-\260+\031@\377\nX\375\202Z>\273I\2757S\215&\031\0376c'6i.\003\376n\001\341\007\347\017\217|9\250B-]!\337\223\304.5#\302\005\343\201\331\342o\347\001D\032P\024b\221\347x\352\2137X\337\305\330\345\241\351E\311t\036\255\345\030S\365w\304_j\021\256\0027\001d\177ci\227^yup \f\375\200\207\200\223>\202\304\261cA\340\224\257\237\262\006\035x\207"
+	.string	"\307\315\272\324\231\343,3G'x>\375\337zd\273Az+\277@\356\035\314-\266'\257\304\355i\243\270\253\b\340\372\375\032\177\313\240s\210X\254;\217&\220+\350\244\256\262\265\313\374\357d\007\253\t--=St<\006\033"
+	.ascii	"E\017\2041>\314T\262\217\203\336\275\251\241\030\013\277\005"
+	.ascii	"\234\235!x\177\303[\266\0233\313W\240\305v\240nU',\324\250\371"
+	.ascii	"\265\007\030`\213\221JU\222\221\242\317\255o\247\207\344\037"
+	.ascii	"\213\223\345%\224\277\217}T\277\273\353w\243N\001Q\370?_\326"
+	.ascii	"\272\244\363 \216\225\356 \031C\213\262 e\024\236su\277wZ\232"
+	.ascii	"%\322\205\221I\200\353\357S\257\307\241{z\200\3301\022\207\334"
+	.ascii	"\356\355\261\266,\211\f\231\270\203\352\326N4Nn\202\361`_\234"
+	.ascii	"\220\256\212\372E\027\265f\223C\326\210\264A\203\252\313\307"
+	.ascii	"\023L\\\371)\232\263\215\2716\026cD\b\220(}4\0137\004\001il#"
+	.ascii	"q\023X9\354\247\274{\2327\351^\260A\327\235Z+\330\t\006\036\177"
+	.ascii	".\324\022\201S\341n\334\317],\332n\274\356\202\2559\353\207\334"
+	.ascii	"\301\373\300\031\026\270\177\245^\004\030\312v\346\273\323'\350"
+	.ascii	"\037G\221he\255,\271rf\265\005\322\036\364\374\377\200\367\267"
+	.ascii	"\032,\341\220\305\334"
+	.string	"\366xN\340\024}\232\177\334w\32656\367\331\262\233;\177(\177\362\327\215\364\254\212\277)\275\022\216_[\177\255\351@W\037A\227\355\277\254\251\362~\212\377\246u\257(\033k\375Abg5\227y\002\346\334\315\353\355;NM\357\277\023xB\3768\217\336\3747<T\357n\315\262>8\313\203cp\221/\341\263X\313\r\244\371^\365^\221\314\202\332\273\3201\016s\263?[\321\\\001\373\277\3552v8\362\nb\247\211\301'\332\305N~\327\202\357<\304\333\231\307\004b\233P?\037V^\3034\212\3070\367\f?/9\331@\361Qy\205&\037\020I\334\317\333\n\037\177\300k\2337\363\212\365\353\361L\030\364\335h\353\343>\016\363\251\376\253\337&\250\177\004-\230\\\2724P\207K\271:z\310\366\341r\333\244\334\363\322\036\357l\035\327p\254|\312\307\260\327\367\2628\362d\224\236\026r]\341_\306F\301|"
+	.string	"\322_\212\220\263\312\257@\344i\301\223\353\277\200~\343\355=\035\317\001\201\033\225_P\375\3773\272\257\357\302\003\234GY^c\350\277\330\262P\017\\\361N\331c\370ep\234j\377X\242\365\030m\367\235#\376\315^3Fj\216\266\235e\265\221\241\027\231\274\213\276\241\225\235#k\235\273\370\241\246c\264\032\177\236\234\202y\300\311\221\277\234n\222\227\332\254%\342\225\360OeI\226tv\022\272\231\312\3332O\342\260\243x\226y\217\312\205\225\276\245w\212!\016\3573\276<Z\245\357$\346\337m\026\364A\251\277\230^J\260\257\201yL\216\210\375w\361\377m\271\305\335\335\254idx[\020\367r\360\231c.\340\227\004\017y\224\307\321\271\203C\366\004\341h\214\230+E\256\321\317\002\2623\352wY\267\037\373\200u.=\007\364\034\033q\273\273\207S\007\343?\214\237\211\327\316\333\007\233\n\276\302\344i\217\003"
+	.ascii	"\017\025\2771\316E4\300\"\327\357N\237\2351\215\311N&\275S\257"
+	.ascii	"\243\240\016\225\342\260\005Z\303\226\335\207N\263\306z4\367"
+	.ascii	"\274\301\303\305\262\215D5o\251\232]\001"
+	.text
+	.section	.gnu.lto_.symtab.3a29fe01c06e311a,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"setLinkQualityDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"getRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"setRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"setRssiDbmDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"linkQualitySource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3a29fe01c06e311a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1134 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001#"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`V\002\325\r"
+	.string	"\026\222E= \223\322\001\223\202\257\255\351\027tj\272\225a\207[\020m\264\223CKj\332\323za\303\307\020Jh"
+	.string	"\003"
+	.string	"\003"
+	.string	"S"
+	.string	"\022"
+	.string	"\256\320\273\353ff\016#d\023B6\331d\223\275\223\334\0015"
+	.string	"7"
+	.string	"5"
+	.string	"%V9\303\235\255g%\373\256\207E\245\033\017\333\257!\254\204e\323\3754\243H\267Y\255\247\277MR\323\002\371u\325T\262\376\373\363\363\025\243*L\02334\251D\251\003\203\002\202\201\217\374b>\256\025\201"
+	.string	""
+	.string	"\362\376\322_\321V\262\360\214\366\306\340P\312\334}\336\037\022\fC\374\275/E\361\322\t-U\311\230f`\277\177\373\3563w\370\273\355\230\264\030\026\360\361OEr,N\024l\246\021\301^@\223\252\340>^\t\317\264\321\251\003\001\274\370z1|}x\360\366\365\366\340\373\340q\204\305Y]\004\363\367D\352\365\357\210\217\355\357\177\322v\177<}~~\217l\355D\343\b\201r.\032\020\375\215\226X\353\301\322\020\230\\\206C\3153\253\224\221\206\237\006L\250a\301\200\310\224\311PX\330\332\001P\002b\252\250<\021"
+	.string	"=h\240\032\2324\205\2351\2133\362-_\246X\24392,\307\307\353\226!8\331h\203o<\320\271\375"
+	.ascii	"\367Q\374O\267\177\3478\205&\337\363\035\r\375k\256=z0\017\244"
+	.ascii	"/LE8\351G\020\022T1\r\302H\374R\016((Cz\316\262\fe\3000\007*"
+	.ascii	"\024 \254\251\304\214^\247\243Q\222v\304U\031\362\025=sjQdKo"
+	.ascii	"\033\035\222\310b\\g\tJ\350?\347X\002_\t\222\263#\346\004\243"
+	.ascii	"\343\375y\310\263\272\364r\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375 \334\245\003"
+	.string	"R\204\r\027\260\2511\f\3030\f\3030\330\222,\032Y\204A\266\206\241\275\245L)\352\356J\321B\373\274ss2\277\254l\311\036\306Y\234\304o\203\260\301\001\273k\225\275\210S\032"
+	.ascii	"\\ cfF\350\205qs\020\004\006\246\251\234kY?a\255\017\203\321"
+	.ascii	"\244\326\352Z\227E\234\005`\244bo\315aRvp\006\200\305,d\250\f"
+	.ascii	"\226y\217\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\027\005\255\024"
+	.string	"V\334bD"
+	.string	"s\224\306)Ws\352\326F\323((J\300\360WTC\304/\2752a\212\004\213\231H\\\367\223\f\364\263~\004\034\240\303Ov\357_J\351G\275\356\032\361\346\213\024I>\3376\001\377\023\201p\377\275\245L\001E"
+	.string	"S"
+	.string	"T"
+	.string	"\177Jp\022\321pJ\260VA~iA\304T.\256\264#b*\327\366\310\353\017\177N|\260\2479\347\310\232\177_?\315\361\313\276\314C\332\336\370h\337\327\333\351\355\234sF\370wV\327\365[\326\234S~\200\345\026&\021>\\\310ufg\242\305\201\212a\355({q\302\234\323\364\362\357V\365E\273M\321\006\262[\025}uQ\317\246\374\037u =\253\262\\\265^\253\2227$\\\034h\230\300\b\302\302\243{\323C\247\370\216`\217\"?\206\350\312\r\330\n\024\f\342\233\202\001\373o\240\tnjN\n\333&1\343@\034\312\031'J\355\031\350l\2642Bv\204\210\203"
+	.string	"t$\254a\321z\2556\017 \261t\037\3241'\206\316LL\345Z"
+	.string	"K\260DLUC\301\002>\355I\034\tr\376lJ~\r\262H8\241\223\316\375\266\334\234\267\001\037:}\"c_=2\352\005\371\020\340\214\205\027A\026f\037F\330\0179Z\254\250\212\021\300\367"
+	.string	"\224\3205hM\245\tT\214\213\266\201l\004[:\264`\232\206\2646^-\036H.\360{\220@\024\301\023/-V\204A\224L\006 0\032S\304\3300c\373\344x\250!E\246\b\t\215H\223\2440\034\220\002\231\231\241\353\022"
+	.string	"\365-\245\2442\016\311\004\"\301\204\311HARI\007t\236\350\025H*z\216<\357\030\302\307m\030N\211}\261\317\327\204\373\316\312\2250-\351\250\344`R\342\371\263\"\246\316q\276\310\337\035Z\253\206\377\262\0343\314\034\303"
+	.ascii	"\306\336\016#\345c\321\342\026\020\225\347\311\306|F\316`\200"
+	.ascii	"\2169\321\367\306t\3266H\206\315\212\177\016&\023\216\325\245"
+	.ascii	"y]\213lh\366L{\256s\022\032>\200\242\215N\367}P=CCT|8m\0278\323"
+	.ascii	"K\005\031R?\350Of\302\001\326\371|\013\346\376X\np/\021.8\316"
+	.ascii	"\352\262\210\376\351\265\3567\231\370,\025\371\254\365<\262l"
+	.ascii	"\302\226\257\026\343\266\324\354\311\307:\212{)V\350\200\221"
+	.ascii	"\034f\342l\247>\277%\356\035\177\250G\313\025?H\347b\376\221"
+	.ascii	"\252\233\300\037U\327\020\303h\204\021\313\356B;\212\b/\212\312"
+	.ascii	"\305"
+	.text
+	.section	.gnu.lto_.jmpfuncs.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`d\001\245\007"
+	.string	"\242\312\")\200+H:\235\0045#\214\3751A\0259"
+	.string	"\005%L\0015 \260\t\024@H\245\206\3334\220\330VG7[\223O\232\224);\367%\347 \330C\007\227\250\260x\002\351;/\207\256\006\306\260\026\276/%\246\360\322Zk\274T&AAH\f\032._\360\004\177e\275\325[\310\016\004P\264\326\024jL~\220\034\344\006\3133\272\022h2D\210{\250>#\330\343\243\310G\225c4E3E\374\240\210z\200O\253L\017!o\356E+ `\"b\314\352\306\r\216\\{\302i\262p\b\003k\303\267\f7G\357\322\355nC\364v\002\030\0218\201_&0l\266\273\246Z\373$\\n\263 -P8\3256q\005{\0246\370\360\331\026\217\313\261\b\314\271"
+	.ascii	"\341>\032\310\231\336|\\W[ \207\353\343\036\326\020+l(\025V\270"
+	.ascii	"}K\364\324=\305\035\002"
+	.text
+	.section	.gnu.lto_.pureconst.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375 G\345\001"
+	.string	"r\004\016\025\220-te4\377\377\177\252\177\032\020\235&\260\236\036A\220\263\003\227\232\323\224ft\241\371|9\263\271\314]n2\221yL\343+&\361\r[\302\f\356\023\270\246\230Y\025"
+	.text
+	.section	.gnu.lto_.ipa_modref.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\027\002E\n"
+	.string	"\222M(*\200\267\031\016\006C%\022\023\177\021\325\204ij\211\201!\023!\257u\267\276\375\375\016k\275\321=\204\213\210\206\201OM\204H\231\002S\023\365\200L\316\324\00321\267\261\314\312LG\035\307\214\304\333-\244\247\374Y\361PgS\242!v\333;WI\243|\216\222\311w5ca\262rdhE \370&\371\323f\007)M\244\b\363\361\361\271\347|\261\312\006\036H\345RiP\026\224\003\237\320\233\340\304\201\002\234\220)\001\277\242NE"
+	.ascii	"\205gT\0361kY\345P\023a\177\266rV>[\276&\370>\004N\250!U\245"
+	.ascii	"\256\0264\225\345P\202A\250\254n\021p-R\026\315\202\242\202\032"
+	.ascii	"\326\356\n\356\364\001\2723gHP\032i8\345u\b\037\031\037\013\321"
+	.ascii	"\206G\244\217\206,\365\335\277\241\250!\203\302\214\370u\003"
+	.ascii	"\004\256\005\032\221\031z\264OV]\366\353&\332\311\314\274\237"
+	.ascii	"\300\371\213\300 F\362P~\304\313\002\\\375P[/\2116\315K\223\215"
+	.ascii	"\207\032*\206_\330\315\264\020\215]\203\301\252\024K\"\330\243"
+	.ascii	"3\tM\216\226\237\314s\234\253\230\"\213v\235\003\247\326\340"
+	.ascii	"\347\242\002\377f\337\013\242\232;\361\302\252\307\270.X\372"
+	.text
+	.section	.gnu.lto_.lto.71f644ae67402a3c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.24.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"%\b"
+	.string	"rO77@o\323\001XP\226\344\331`\244;\371\0060\202\210H\350\300\001\204P\320!\244\277\"\r\231\f?\036\n\376o\312\217\242@\303\230\263@\026\230k1>`\273\377\226)\005\246:W\305\360I\250\024(\317tX@h\230\324\345\231\035\002[\017\3255#,\353\232\233n\257Y\030:\360\3706X\341Yq\3043q\356\223\236b\026\177d\b\227\\\222\217\361\303#\221\331\364d\251\347\270]$\3477y\207\t\210v\267s\376\311Q>\376\350\321\022\230\236{\3641\371hOP\3509\253\267\361Y@\315\3564\205 \3665\013Cv\224\035/\003-\273\031\247\231\375\342\212\210\355o\234\3311\357D{\022\306\205\212iw'\fyv\315\374\227<\200\003iW"
+	.string	"\203\335\265r \215\033\336v\201\355i\033&\016"
+	.ascii	"i\3317c\032\376\206\213\246\025p\0070\013*3\244\332B\\9\343\302"
+	.ascii	"H\026,~\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_queueContains.25.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\211\001\315\017"
+	.string	"\246\336jE\360\262&\0350\343gHs\264\201'6\333\344\212\237\031%N\241\345\233\271~\025|n\346.7\341\375\213\357\257\021\265\227\037\255Hrzkl\006\236\021\332\245\031\234+\024\027f(\352\367\310\377e\210%{K\231RW"
+	.string	"Q"
+	.string	"Y"
+	.string	"\017\200=f\037\301\036\025\224V\336\336\231\2309\211\232\r/\200\354v\232\226\360\310aw\307\334\216E\250\271\371-\307D8\030\031\216\2251\207\346\020:\320YqB\204{\201\312\363\r\2218\230\324\273\2365|X;z8\232\347\310dw\2351\\\207{t\333\233m\006\366\277\367v~\314ix\357VMg\246\237\225\026\310\017\001?\2733\257!\233#\002\245\270w\373\235\3572\311wq\236\325=\013e-\034\262\317\373\340cwI\036]\312\036\t\300\333+\233d;\323>\213\353\254\276\303r"
+	.string	"\273-\035\032\273\035\002'\310\036\335\005\016\302\036S\007\024\325\270\344\353pw7\036\270\352H\257\302\303\020\214\bV\276RF\210\226\r\2506\306\364\232\362\212^R\210mkx\f\226lw\033\3700\376\251|\234G\253\254\344c\036\375\025\275\353\006r|\202"
+	.string	"\271\344K\211z\360\364\250\332\330]K.\320q\343\306\332\262\003(TRP\235\244@\233JR\247\n*\022N\023L*\355\002\352\304\202fJ\251\264\222\002F\301pJi)(()\215\324\355\265\345\2678\004\242\021\337O\3647\354\256G \002\361\375\350\277a\020\252M\\\224\205\002S\033\223n\340H\225G\222\\U\306\266>\300\361\236\317\260\220\217\343\f\016\n\036"
+	.ascii	"i\355\233\202\341\257j\356\2500\221F\214j1\204q\2776\244\002"
+	.ascii	"V\bmK\n\302\033\023\305\363\202\302<\n\232h\211O\314\212\242"
+	.ascii	"\013).281V5\334s1\316](\021\252P\256\251\363\236m\237Z\332T\257"
+	.ascii	"\275\204\371\004"
+	.text
+	.section	.gnu.lto_queueAdd.26.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\232\005\275\""
+	.string	"\006\376\330I\200\030R:{@\275\b\224\371\220\317\327CkR\276l\371\233\026\260-H2T\006\334\376J\240C\322\231\316\033\315\254\230|\tZTj\275\333\207\204\212\374\232\351\316\350k\310y?A\340\345\244o\252\324>\233\221F\b\221;\311\303"
+	.string	"\271"
+	.string	"\310"
+	.ascii	"g\021\363z\3242\0331\257\314l-\363\223\3372:\027\360\276{\217"
+	.ascii	"ZL\356U6`\007\352QV~@zT}\200\364\350\003\bF|teU\323\251\254\224"
+	.ascii	"\300\334\356U\376\272\207\317\207\262\315O\345y\355\243\357V"
+	.ascii	"]N\305\361R\364\354\236=\342#}\247\346Tl*\331U\207\007\324\324"
+	.ascii	"u\035\246\260$\313\354\200*>wC=/\230\325h\272\232S\324i\257\330"
+	.ascii	"\304\274)eqO\232:\017G\332{\032\006-\232E\343\347iaK\313G\357"
+	.ascii	"Ix\266\327\022\355\314\333\245\247\241m\225\306{\347\002\243"
+	.ascii	"\224\031Ws2\236\003\256Pyy\327u\2048\025\255\305a\270\367\262"
+	.ascii	"%>A\235\001\234\371\r\230Y\0023\272 \177\004\2654\253^\037\371"
+	.ascii	",}\213\370\242\"\264f\230\257\344K\370\214\377\203\205\330\314"
+	.ascii	"\236\310f\351\321\367\273n\265\230\260\214[QI\366\215Y\031\264"
+	.ascii	"\215,K\203\004\343>2\201\034\034k\371\306\346bg\337\271\376\032"
+	.ascii	"\266\314\373\330ywZ^q\226u\247\345\034\316\262\232Z\306\245\226"
+	.ascii	"\323\3232\212Z>Q"
+	.string	"\313m-\333\323\362\013\364t\030\213TW\275Ey\233\336\316\\+hY\220\213\375c\267\314J~\223W#\0047\334\222Za\027\3433y\0053:\222/\271\350J\366\300\204eL\336{\217\204\017\306\367\372W\321\223\360\331\001\241\362>Y\220b\222t\273\367\356\034e\b\352\321\003\001_\206B\202\366\215\321N\373Jir\372\215v\232f\212l\210\205S\006\306F\356\354n\313\365%Eh\315L\001q\366\317\330\270\330\347i?\352\275\302\b\374(.Jtw\030#\020\256$\373v\273\025\244\242\244\036\230Z\022\207\202f\373\315\333#LV,\363\005\026\022\227@\306\013\"\257\217\374\3453\254\345X\222\2417\373\231\337\260V\\\222\365\227\230\217R\002\002\334\272 \221Yk\273J\033\311\253\325\211\323\335\326\333\271\257\227\372}-\347\275\367\242\f\356k\234\376\020)\264\2411\310\304q|r6\362\246kz\350\213\355\303\235"
+	.string	"\325{\357\004~\223\227\001\361\177\034\345\023AA\351\321\233>\002\303\213q\253\254\327\272x\215u#9@@\366\004Q\017\213\223}x\206~P\264\030\361c\302\207\350\227\002\250'\350\3473D\364\343\321a!\025?C?\026BBC?V&\275\217l\355\315\322\3467\254%\227d\271\237\375]\327\260\006dI\266\336\354<^3\206\244\016\206\355\214\350l\272\333x;\337\355\252\b\255\231\3333f3j\335\265M\277\371\235,\264\257-a6\213\210W\f\235\272k>q\273\316Y\333\313\211c\336kS\230\25224\326t\033\320"
+	.string	"[\016iJ\221\242\317\342Zm]3\207\350\261'r\005\035\303Fb\276\226\0257\\P<\013PA\025\026]\333/\f\236\323\271>\321\f\215\301\253\255\340\251\"23\207_\001^\340r\324\212\332h\026b\r\365\234\226\246\215\353\007r\250a0\004\211sHfF$\020\221\304\031\016p\002\021*\263n\021\2405dFR\220\333\001h\370\351\244\307\361\353\276\206\0355\210,.;\246\276k\306U\274\243~\362\336\2374\242o\002K41*0G\227=$\243#\237} /3\275)x\217$HD_S\343\302a\256\360\3628\345\377K\364Ue\ti#\226\031\256\366\320h \022\220!>+yX\301,"
+	.string	"\243\305\371\t/\321\021:\033L\021\256\2255\026\212\271.2\035\314\177\021\004S\301\375\341\210\020Lsw\005\230k,\262\032\247bO,\321\346n@\340\024\023$\256\346\f\325\304\320u[\323\307\252I)\036\215\354s\303u\252\255gS\2527\275T\377\225\273q\357\203ZD\001\347h<7"
+	.ascii	"\022@#\271\254\033\333}HP\235\213\374\355\334\246\334\203&\243"
+	.ascii	"\017\227ak\374~\021\\\250\001"
+	.text
+	.section	.gnu.lto_queueRemove.27.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\311\002\035\026"
+	.string	"\246\252\222J\260\324Q:XS\024\251\243E\362\210\256(\332\\6\025=5\\\317\376S_#\213\333\211\273\303T\242\334{\242\365\257\277\037\006\207\242r\340\201\373\017\372\017:\227\032\003\256\241\307\220\350\235\344\234B\324;\262\023\031id\023\271S\n}"
+	.string	"w"
+	.string	"\177"
+	.string	"5\233\264=\247}\023g\252\275\211\366W\255\274%\251ZK\027\033\030O]^E<\035\237\"\236\036\200\251\331\366\362(\350E\300\237\024Ej-a\333\301)\017\313[\234\266\263D\032\356\264\371\267\263Nv?@;\334\024\225\204N\251\222\217\242\034\300]\206\207\241\f\023\t\017'\273\n\341:\375`\220;\237\271\367}N\341\300\345"
+	.ascii	"\356\204>Y3\265VO\335\016\303=\336v\220\355\004\366$\022*\376"
+	.ascii	"\213\371I\247\2460\233\327\235\372\263]\2620\202\210\351E\317"
+	.ascii	"\274Z\253\036N\300]#\273\274M\0045\252\220\274<\373\365\246\037"
+	.ascii	"\305\323&\256\235&w\272\344\275\273E\247G:\315\332i1\234\246"
+	.ascii	"\341t\270\323\273\323sN\037@LY$\310\312\214Z\203\256\220T\032"
+	.ascii	"\364\005\210\367n\277\364}&}\024w\252\275\347\340x\2730\376z"
+	.ascii	"O@j\255,\247\206\031O\007\204\267\003\017:\350'\031\202\251L"
+	.ascii	"\245\023\362\362\271%\273r\204\234tY;\256\215\2433\257s\f\207"
+	.ascii	"\334\336\354O\361\004\320\221s)Z\201\243\250q\347\017\337\005"
+	.ascii	"\217\313Q\255\365:\333\262?\321dt\234\266`-\r\352\204Z\336Zq"
+	.ascii	"Y7rD\343]%\206K\367?r\"p\363\312\273\341\376'Ik\347\356\212I"
+	.ascii	"6\020\311\205\300\t\200\032\032\022\256\221Q\366+\353\355\360"
+	.ascii	"\231Fl\373\301W\320\306Z\253\002?77\023gF\263\023\272\346Ef\223"
+	.ascii	"\303\343\300&B\315\f&\341\206F\007V#\233\301^\b86\301F\006\333"
+	.ascii	"\211\305d0\262\254_\236\177\342\f\254\252~Q\242o\023\357{\003"
+	.ascii	"\253\030\277\250\360\267\211&&\353\231\236\305}`\255\221I$\372"
+	.ascii	"\332\3451Y\356\262]K\356\002\031>\323\210a\220\273\262CC\317"
+	.ascii	"\274zXk\255b\313]\373\332\373\256\022\234,\206x1h\270\256m-\320"
+	.ascii	"m\224\200Zr\347\002\331%\353S\0052 `\202!\346\214\007i\373\246"
+	.ascii	"\032\376\332\334\2310\246\241\305*\322\301\025\2273#Vd\"^}lL"
+	.ascii	"\375&\221E.\360f\261m^\221\312q6\201l\342\222\320B6\260a-\026"
+	.ascii	"\260\300&w\b;\216Y\177\242\363\206\267\024\275\002)\353\200\222"
+	.ascii	"\374n\353\023X\024\200\3268+e+'b,\016\356\267\214\312\033\265"
+	.ascii	"@V\035\2679[\254O\320B\210@<\367j\361\023"
+	.text
+	.section	.gnu.lto_queueFirst.28.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\002\21767Po\322\001 \352y=/\314\234^\031\037\303\374T08\371\350EP\275:P\335\032\312\367\270QD8\315H\360\252\252\032m\320\366\337\n&f\257F\020B6\221;\245\3264\335\346\300Y\330\030\264\215\204hPx\220Z\267\221\032\002s\021['%8\256\223\230\271\267VK\252\003 \r\035|\304\313v\027\301\017\271\b\3077=z\242\323Q\214\344\302q2\270\017\362i\023\337d\n\243\340\277G\337\250\3531\222ZT)\020\\\331\363\003\025\303\276\265Z\262\r\255\026\206\242\"p\262k\261z\331\224x\332\260\355\2611~\307=<\366\002\246\306\b\013\261T\220\250v\247\364<\300\365\230=s=j\306\275C\317\377\307\255\324\305\312'\372\034b\t\273k\370\211F\267\336v\201mi\273$\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.29.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\335\b"
+	.string	"\226\020<6@\217\322\001\320\023\345\017\237\366\271\366\206\240:\230\330\2144h\003\301\033hJc\266!J\353Gi<f\266yQ\024U\037sj-.SyC\235n\204\333J\231R*"
+	.string	","
+	.string	","
+	.string	"\030\252\227\335\b\035/\200\375i\036\200\375\251\307\271'\347\177\344\031\027\216\225\3164zf\013\273\353\354L\247[o\033\3016\264\035\023/;\216R;\354gVQ\266\323/\323\231\351c\231K\245"
+	.string	"e7\343\005\263)o\005b[do\374\220\213\210\314\r\304\217SVr\005\251?\203B!\354\357)\300*\265D[]\013)_N\3705\365\027\033\245\223<\272\345\247\\aV\276\373\363\315\302\376\256\004,\032\244\f\3268[\007\002\324\320q\320>P\342\201!\002j\333\007r\016\354\231\350l\220\302\343\331\340&\356\025\365\324\200\244%\213\237p\232\335U\360M\256\372\370\001\017"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\2700\316\016#Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_taskSystemLoad.30.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"M\013"
+	.string	"&\024KB \2138\035\270cp\244@x\032\240RC\251^`\222V\320\242\201\244W#\001i\303\t\322\221\031B\274\230\001\031k\332 \347\240\203\023\300\271\206\237"
+	.string	"=\300>\332S|\003\f\201\317\246=\2046\331;\2456"
+	.string	"6"
+	.string	":"
+	.string	"\336p2\301\336\264\npR\355\256F\021\\\274E\247\350c\226\f4rn\0258\225\030?\026ew\377\340S\300\350\231\023\263\354\256'h$p\327\333\336\260\235a_#\007\354[\273\273\246\"{N\037\203\030a\260(w\007\254:,\252^X0\261\375i\277\301\035\210/\001p\266\033*Y\330%/\214\361\360J9\305\365j}\342z\265\350\257X\206\n\243\224U\202\030\203R\225\272\351\247,T\216Rsw9\324\341u\nb\322\360\231\034\354Cx\204\320W\340\222\315<\350\325\337\\\257\247YH\002\311@g\256l\2223i\240\007\327]:4\030\356\373\302-\302[\345\343F\302\020Nd\0035\314\345\243\323\266\017\324*\025\366H\270O\323x\336\247M\310\275\265Td\016\022\252C=\366\273\313\237p\n\235\227\311\\\001\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.35.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`A\001u\f"
+	.string	"\306\226QA\020Q\234\016\013\212\234\240\006@\331\267x\304H\252\276\343\331\344*\013\242\312\243\335\256\021\321\004\350\251Y\304^\302\3257\305,\350\f\204\004"
+	.string	""
+	.string	"\326R'\244\235\303\211@"
+	.string	"\002H\340\017\242H\233H\231R<"
+	.string	";"
+	.string	"@"
+	.string	"\001vG/>vC\003>p=:\274\305z\274.\300z\364g\317xH\332\237@h8\325\330]L?\374{~\376I|\002\212>O\016\006\273\353\004E\034n\275m\002\266\027\330\007\t:A\271 \351"
+	.string	"\312\022;\374\244z\260_\355\356ZG\366=\376+\323V\246c\246\253Lk\2463\323\257"
+	.string	"\240\021\243\300\310\356\206\022\033+\022Q!(\266\237\366E|\304w\017\317\003\316\274Ed\001\246\342\rb\251V\372\f7B*4\252\tL!$\251\366\346)Pp\251\223TH\307\325\266\360\223w\355\256\002\377\304\306\261\220J\0360\365\0227\341\371%c\350\344\301G\277c=>\234\204\315A\266y\r4\231\206\311*\316.\235F\301\213\240a2\016\266e l\260\254\343`\227\001\346*h\035v\201\343:\214\022\356\253\325\221\037\214\210\2004dKm\355\250J\306W<\252\3651!*\002\023\214\216J\035\036"
+	.ascii	"i\331'cz\200\032\206\263*\320\006\005\f\002\026\320.\300\002"
+	.ascii	"\255\221\202\2106\260\007\216\001!\300\024\270,\b\036\200;\270"
+	.ascii	"\354\210\201\232\270\2335&\300nP\206YT{\r\020\\lhVS\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getTaskInfo.36.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\200\006%!"
+	.string	"v{\320Ep\336M:s\300\006=(\244\0338\214\357\035t|\210\373\026\003\251\221\311\240\336\027\266+\364\3147k~2\320W\350\312\211Aqu\2409C\035\021\204\226T\035I\274\256?CLO\370\007+P\020K\b\221R\246\264"
+	.string	"\256"
+	.string	"\305"
+	.string	"[\266\\~\265Y\376"
+	.string	"\310\021\256+\265\326-\373\232\375\374\325j\271\032\022\326\260\376 \f\371r%\301\222\217\360\253\377\\r\317\377<\\,\351\216\315X"
+	.ascii	"\265v\26550\227\374\320\\\376\367\312\206\245+F\343@\265\"\t"
+	.ascii	"\373R\353P\301\027\230K\"\255\200r\311q\003\224K>\375\337v\030"
+	.ascii	"\254[&v\243,O\255u\327I\036`\307\341\236\344tKrlN\277d\313\300"
+	.ascii	"726\342\257\306\226C\277,\255_\217\311'[;\216\020\302\252(\031"
+	.ascii	"\372a\215=fF\346\374eq\357\3312\230.=6\342ok9\027\241\326z\366"
+	.ascii	"\375\200\373\334\376\267\361\177\302_6\te\306\366zQoW\221\305"
+	.ascii	"\301b='\261bd\230\337\264\r3\242\304\023\257\357\251\\\262\250"
+	.ascii	"\367lWG\033W\221\264^\2333F\354\366\372\027\031EE\337\177\023"
+	.ascii	"\213\2062\025k\255\016\272\254\027\250\357\327\222O\021\305\353"
+	.ascii	"\213*\227\334\216\361e\346\003\302\343?\377\260\307\355\365o"
+	.ascii	"S\0334K\336]\177\020\037\211\344\037\031\215\374\242\035\333"
+	.ascii	"\005\260\304=\321\212\355\016\001\361u$_\310\344\237&?\310\344"
+	.ascii	"\003\231|\323\344\347L~\231\343\2239\376X\362\233\344\363\310"
+	.ascii	"_\003\374V\306K\330l\303\332\343\017\237\312\206Ls\262\304\335"
+	.ascii	"\177\277[\226\370=[\2634\177je\363\244\3021\r[<\251\220\351\016"
+	.ascii	"\252d\247l\035\220\215\354_\302\302Q\251\241\260u\250\226\202"
+	.ascii	"\265V:(\202\340\033\331\347\030\234\270\261\377\n\333FUva\345"
+	.ascii	"P)\305A\017\024\307>\201p\272\177\f\013G\303\235\r\353\206\303"
+	.ascii	"\256X+\326\032\232Tl\323}\302\275\001\343\376;,\033\247v\363"
+	.ascii	"\301\335\303\256q\332\005\325\240I\3014\334g\0337qbH\375\177"
+	.ascii	"\3303Rf\255\265\351kF\004\210\241\257\031d\233\004t\323c#\302"
+	.ascii	"1)\333\353\347\222\321\250[\016'X\242\326:j\242\246\220\346;"
+	.ascii	"f\311\\\355\373\365\020\027s1\345\222G] \216\020\336Xk\255\244"
+	.ascii	"\322\022\265Q\257\224!d\262\270z\\\212t\005QQ<\205\242\205y\002"
+	.ascii	"\203\224\325\323\213\362\350R\025\324\n\030'\240T\240V\273\026"
+	.ascii	"QO,vh\225\325n\311\300\247\\@U\355^LMU\355\316!o\273\353\313"
+	.ascii	"e-\254\0311C#\277R\345\236m\2065\"fh\275+U\"\265\326\377k\260"
+	.ascii	"\302\206\327\275\353\222p\220\243\335Q\302[Gk\300?\320\035\373"
+	.ascii	"\320\265\016\316M\210\t\377\234\272O\023\356\341\304\024d\036"
+	.ascii	"\250R\220w\b\265\216\347\006v:a\255\336\006\365\331\003\236p"
+	.ascii	"\216T\310\204\003U\272\021\324:`[\034P\024"
+	.string	"\266\361\306\007\267W+\315\006j\002nY~zS\230\227\n\233\270\006\272\304\325l]Z\033X\216\312\372Q\003[>\251\220Aq\017\252\240\250'\327:(lqbe\007v\25018\244\230\203\212FDf\n\223Jc\360\002\021\241Z\035\021\0209g\224\262I\226\331\264\006\3126\323\364\277\343\2424T\205\320\231H\035\200|\027\272\341|BR\302\234\013\351\017\370P\013$\001S\r:\314\352\274\230\216\316\003\277\267\343\001x\3175\325FiP\205\236&q12\237\351\031\007\025Ft}b\007\207=\b\315E\330\301\212\037\333\202\265\313\n\364JQl\343\326\374\333#Gs\377\002\245z\206\3439\224\333\332\220\206.H\241\016d!\244\355]\314\203\025oN\315\307\214X\r\215\264\226\332`\260C\320XQ\320\237\233\222AH\360\347o\216J\003V>\234\223\021\3779$\234l~\027Nm@\032=\0225!o7\213"
+	.ascii	"v\365\342A\020 \235\022u\264\363i\030\357\366\231U\3525\303?"
+	.text
+	.section	.gnu.lto_rescheduleTask.37.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\217\001\355\017"
+	.string	"\006\236kH\340\320(\035:\037o\252\374O\243w9@\327K\350'\265\037X*\320F\b?c\222I+a\266Z\032\302\313^\273\316D\214:V6-PK`\030\215\320\r\023\346\245|E_F\250\307\2230\250\033\232%{\223\275S\nT"
+	.string	"P"
+	.string	"["
+	.string	"\247\036\357\250\247\3349\352\251Q\266\317\307\232}\314EK,hw\275Is\324+\345\246D\371\035\210\210\325J\275\276\234n\264X8\217\335\275 \271\320\313'W\300\305b\303Fk\305u\314<\3008\316e\206\226J\312\016dw-Y-\227\273\273m\320\266\210}\236\353)cO\351\356\260\273~\374\351o\376\213F\265\031\251\304\256\206\033\215\225\321\036\020\207\335\376\313\217\301\254\342\353\262\307`{\341S\333]\003\247\016\361s\354\321\351G\266\345X\201\246 t\352K\373#N\002\365\033\025\213vcL\354\354\216\007\214 \024\324%\241<\213B=}\316\357\242q\370x\235\335\374\210\301\362\243\2227\323Y\347c\017Ya\003\324RcE\336jl\265\035\032`"
+	.string	"L\210W\213\225\264I\236\031\263\016\\\225t\332()\362,s3u\033\226K6\347\2149\256R?\005\300\320\274h+i\263\307\224\2343\366\271\335\r\017\034\310S(\226@\006\246\020\024\277\006)\237\t"
+	.string	"\223\b\311i\344\244\272D\022?\t(\246/B\351\344\231\200#%^I<y$\002\016'|\242w\022\206\2427\032\367\334N\031\037\347!\035\031\262\225\251\252\335\264\277\247\2000{\200D\354n\002\333\026\216\002\024\305\374\004\355\356\202\023\327!\361?<\037"
+	.ascii	"i\3317c:\233lD\336b\325\366n1\355\330l\205\241;\025je\200\037"
+	.ascii	"\244\020B\343@\n\241\256\016mI\f\313\232\013n\235\255\325\026"
+	.ascii	"V\341\231\324u\252 4(\004\227\025\250\321\302]Rt\300\"\224[\271"
+	.ascii	"\021\fGcP{"
+	.text
+	.section	.gnu.lto_setTaskEnabled.38.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\335\013"
+	.string	"f\327Q?0O\224\016\307`\317\313w\324e%xB\034\215\020Q\270\024\210w\341\202\345\016\256\275y}\333\307\266\n\332rU\235\273\315\332]Jm9\030\316$\324\231\205Z\235\030t\363h\237l\262\245L)="
+	.string	"A"
+	.string	"="
+	.string	"\360\224x\313\233\255\342\236\207\375G\b\367\301bw1\355\360\355Ps\363\257\213$\325\225\016#\252\253\307\323B\207\202\225\335}\307\263Bw\312\274.\273\353Lu\030n\353\2661\266\025\330_\020\351\314\3641"
+	.string	"d0\201\225\330\275\360\265\330\225\005\242a\373\366=\354\311'\2665\355\003\b\266{\243\001_\261\332 \221 r\313O\373\033\007\261\235\203d\311\356\006\021#v\275\0026\020\271U\271\200x+\311\2750\345\356\256z\024U5!P\2402\304\251WUM\301\251\002\244B\027\334\007\312I\021\352\265\201\306\t\016\344\224\237\355\225R9\330\327\357\373>k\206}\357\2774\035\317\361\303Lk\006\234\254\243\311x\262\213\203\201"
+	.string	"\312\204\2427\026-\353\2108\231\203\r\b\363<\310D\3006\032\b\263\020\360GB\246a\241\317G\303&\336^3\314@\303\312\244'\bcF\205j\213&\344S~\307/\024\264\344K\243:\024"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\016\241X\221"
+	.ascii	"`\226\301\2723\245\240\031\330p\215!\205\273\005\252i\340\004"
+	.ascii	"\001\003\0365\262?\2242"
+	.text
+	.section	.gnu.lto_getTaskDeltaTime.39.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`X\001\305\016"
+	.string	"\266\032bF\360\320&\035P]%<XI1\034f\300\313\275\251\177^\233\371\315\341\347\227\355\216\306\374\2500wzi\007!\311Ep5\022\013_\206\254UxX\034\006\317\274\\p \231\304 \302\232W\376\206\326\222\275\267\334)\005M"
+	.string	"J"
+	.string	"Q"
+	.string	">;v7\013y\200y\031\3771/\025\347\334\247\214\n9\037\346S\002\317\fi\352(\304\220\335-u\023`|\300\303b\325q\270F\003\256n\205\251SE\217\0219B\274\347p\246\223\201\020+\331]\303U\247\341\306n\033\201\355\021\373;\001456Z7T\220\310f\301@\275\261\037Wm<\r-\357\375jh\250\320\307L^\r\222\327.\206W\321\322\220/vl\277\330%\333\020\336s1i\367\003\214\026\273,\002.0\272\264\355\227\270\211\027s\221\225\323a8\027*\004(N\321\264y)\025\373T\fyw\345\374\220\220"
+	.string	"@j\204Z1T\220H7\270\260\240#:\370\0177\342\373D\330F\273{\235\226y9\225\344\375\304[-\276\216WX\340W\227>\313\274\274b\"\200\206hb\340\313B \276\f\2527\376\270\313T\r'\007P6\023\225\351\223H\n\265`\345\004\225\340\264e\f\024\230\244d\247\324\226\211\f\260\326"
+	.string	"\225\312T4-\225\225X\373\270j\343{\370dD\237\233/\372<)\365='\341\370:\350T\2503\352\222\030\225\231@\034H\220\r\341)6\001A\273K\202\342\256\037"
+	.ascii	"i\355C\3024\200f\317am\261m\3378\212\300q\311\r\323ch\0308\017"
+	.ascii	"^\201\273z\020\016\267h!I\213%\241\214\243\250\366\216\312\021"
+	.ascii	"X\224\267\t\3115\234k\002\273j\274\233\tW\374d\023\341r\340\234"
+	.ascii	"P&\254\264\217FPP"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.40.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\365\007"
+	.string	"RO87@o\323\001xY\306\213\223\224A\332"
+	.string	"\371\351\342\033\006bY\302\320\3456\325\177\215\3671K\2014\302\352\232\035\357\013JF\004n\2328\260\302\243\351\336\f\246\255\355\235RV\215\310<\225^[\275\266\271AP\324\351\261\266\211}(6i\201iG\263\260\217\2045A\253\264\270f\205\244Z\225\035\003g\027\226&\267,\323$\347\333S\033K\017-\247Q\3140\214\276\311\277\220?b\f\020|\367\312\007\001\274\332\250\254\314t\214`\215\375\211`\364\260Om,\331\367~H\r\230\\\030Xv7jh\366T\245\220\330>\3076\204\266\302\002w/D\360\230\027\317\264\373!8!\340\2259\033\346\037\310\036%D\343Dfwe\3748w\310\371/\271@G\022\035n\032v\327\260#q\334\361\266\017l;\330\026\t\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.41.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`j\001-\016"
+	.string	"v\031^E"
+	.string	"\221(\035\360\246\362m\342\360\377\221\002\311-\377c\337\3214\035\320\003r\342}fZ%N\300\320\231\373@\365TE\b\nboT\tn\271\t\364\256\365]\353\226w\200\325\252yg"
+	.string	"\3121\204\375\266\367\3362\245H"
+	.string	"D"
+	.string	"M"
+	.string	"\267\231\301\300\212\355\356\006G\234\364)#T\222\377\232{\274\257\364\331y\271\374\370.D\221\335\325>\013\032=\276\227\303x\340\004\243\303\307g\212!0\0214^s\315\360\271\250r\026\354\256\325\3736\334\234\333\346l\217\330g\0053L*\263U%\205(\373qw\3270\306>\315\037U}\217"
+	.string	"'\230\202\331\256\206\331\216}\311\027$4\333W\373'\216\202t\232\221=\273!\\.vU\b\234\240s)\362\220y\031\0172/M\262k\\\225\332o\341\271\341\212\241\234\205\253\304mn\207\276B\343\320\212u\323\236p\025]gwG|V\005\225\001)\031\226y\371\221\201\343)\276b\361eLaE\357]\372+\363\362P\256Z&<\264\350\3543\336\351\005!\312 \037\315\b\t\300\304X\005%\fN:\222\224i\356#\002AP)\001=\340\272-\202\t\t\312\306\211\272\355c\300!\t \321\226\022\n\2116M\265\217\013c\032|x\265@\227\t@#\264\035\230\350=GXJ\311l\334H\210\262\200\217f\204\005`t\254Z&\225\351M\016\030\210x\022\036"
+	.string	"i\3317c\032\375\fkm\305\262\340%T\324\266M\3146\241\340\252i,"
+	.string	"\303"
+	.string	"\224"
+	.string	"x"
+	.ascii	"\305H]<)J4uF\233\275A-\203\242\344\ru<\316\206\200Q\227\260\210"
+	.ascii	"\325h\340\2164\325\344W\230\255\264_CPP"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.42.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\235\f"
+	.string	"\246\326TC\020Q\225\016\360h?\266\261\003\332\247_\002\377"
+	.string	"\214E\373\244\030\200\370\212\033T\344\020\020\341d\300v\343\355\343 \301\377\300`\320\276T\235"
+	.string	"\210\024\b\350:\b\220N\320t\026\334\317\033\354o{\357\275S\n?"
+	.string	"?"
+	.string	"E"
+	.string	"\273\233I\020\357^\351\224\261\363)\036\213\367\245^9N1\037\206\271\331\335\013qV8.\347\001\260E\007\314\307\232\032XG\311M<j\370V1R<\273\353\350}\034n\312m\217lw\3543\b\237\273\273\226\036\366?\376W"
+	.string	",`\013V\354n8\271\261/\252b\304\305\366\243}\022/\321\375\003e\313\356\207\222\221\335\020\201\023TN7\327\324\323\371L=ug\303x\350\332\213\220d\b1\t\017qj\356\024\357\235\372\247zz\351\210aBC\025O\\1\031#4@\001\320\006\210\013V\214\305\0245`\036\346\2146\205\n\361\236\245L]\204\007\276\244l9sT\275\034"
+	.string	"\316"
+	.string	"y\301\2121;LE\331\262\003\241\006$\356c\252\006q6\021\204SH\364"
+	.string	"\304e\021F\237R\006\332\270\214c\300\232\004\321\226\2314m\313.\341~\256\364\260\003\222\227J\256\252l\271Tm\322EJ\004:\266-\034\205&\300\265\273\nN<d\202\003\031"
+	.ascii	"i\3317c\272\211l\250h5\243\005\273\037\0225q\300\f\265\315\340"
+	.ascii	"\300PH\006\204\026\201\300@\335\037\252y\334\n\005H.\326\022"
+	.ascii	"\253)\302]Rt\300\"\224[\271\021\fGcP{"
+	.text
+	.section	.gnu.lto_schedulerInit.43.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"-\f"
+	.string	"\346\325PB\020O&\035\300\2549\300\350a\300\r\330U\360\362\347\345Od\322s\203\275rwLx9\210y\020@dw\030"
+	.string	"\201\3539H\362\006#\350Uu\271 "
+	.string	"\301\324\r\032\201\241\t\2033\241\034\331\177\357\224\0027"
+	.string	"?"
+	.string	"?"
+	.string	"\235\223\256#\025\"rw\271W\273cs\257\347\354\261c/M\373V\214\302j\266\273\035-\335\363\351\361\237z\306\030\372|F\b\354\256\347\030\262p\323\333\006`\273\263\017\n\250\0164\331\004\372\361\277\331\374\362!6\376\311\0218\363\343\253\317\331^\007\214`\"\362\2058kv\t\232t\203}\310R\222\035\361h!\302PrAW\224[\241\026ca\325\305\301\366\375\017W\005\265\f4\231\004\372!\261\300\257\212b\315$\367E|\204Q\370'[\374\362k{\255\032X\0364\346/\334)6\311\017\342-\314\206iW\\\235u\361O\257\0061\363#fSe4\363\243\257:%\366&\341\327@\243\340c\340e:\007\226\312\245\363\302L7\3710\370\340\013;\b \030v\\)\036\262\224\344\0020`\"\005\231c\236\374\t\003\223\205\035\340\256\003\035\246\335\025P\342&\020$\250T6\357\233\251S\002\031"
+	.ascii	"i\331'c\372\220\032\216\333\2051\223l\006\002\003',\361\302\332"
+	.ascii	"H\203E\220o\320\031Z\034\0211m\201;\330 \fQQS\242mSa\273&\202"
+	.ascii	"\017A\020*\360\313\025\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_schedulerOptimizeRate.44.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\375\t"
+	.string	"\346\222D< \345*\035\340\021?\265x\"\262\b$\022t\301\3023LR\221I\007\022\212C\020+\203\233\305\316\330,\026(*\345\214"
+	.string	"R\030%<0\23790\210\210(\343\366Z\267O\366\226)\0051"
+	.string	"1"
+	.string	"3"
+	.string	"\373\330\200\225Hmw9\311q\360S*\350g<\032Vx\372\324\270$\bS\363`w\017rm\205*\325\214gw\255\2540\343\336n\373\301v\203mZ\376\\\351\262\017\373U\325\337\036n\255\305\201\266\2131\n\330\223\255\344\303\3667\266Um\205\005\3600\223\301_D\230\311\256\230\340\216\3007\203\366\312\305\216[\270"
+	.string	"XP2\345K_|\210g\276\207-,\323\263\276\371\226a\276i6P:\316)_\252\273{\2226aTN\222\021\305%EE\245\001l\361\244\362\345]\351\003\321]\204D\241\322\310\0330\210\363u\023\025\021\235\004\210\304Q\204>\"\016\364\2218\016\202\275Q\367q%\317\373\270\215\270\237+]V\331)\210\215\253\021e\270g\230\313V\020"
+	.ascii	"i\331\207\324\364\307\262\302ejK\260E\252\312EEA\215K\t!\270"
+	.ascii	"&Nd\002)\251\311\300]\002\006,\252\334v\025="
+	.text
+	.section	.gnu.lto_scheduler.46.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\245\033-\177"
+	.ascii	"\332\321 .I \320\322\031\016\277J>\337\236XBt/|2\375\301\313"
+	.ascii	"W\006\376\001\242?\026\216\003\312\247\323\007\234\232\220\315"
+	.ascii	"\237\321p\331\256\307\222r\315\204\037\213k\247n\033z9\336\332"
+	.ascii	"}q\257\315!KF\226\326\342q\242\242F\244L2\320\002~\002\341\002"
+	.ascii	"K\336\242%/\321\222w9\304\353a\311;\264\344UU^\245\312+\244\344"
+	.ascii	"\rRy\201T\336\344\222\367\307\003/r\210\367\250\3445\252\274"
+	.ascii	"\255\362\262\222\367\367\"\265'J\345\215J\337\261[\311\026wX"
+	.ascii	"\345\034a(\341\206\177\236\177\317/\370\377\375u\376\276\277"
+	.ascii	"\315\357\302?\375\355~2?\336\237\367\241\335\357\336p\317\347"
+	.ascii	"\006?B\034\366z^\270B{\270\236\300\226+X\227\275\2706\311<\\"
+	.ascii	"I\257\262\344\336\330\fe\222xNXu\034V\b\315\206\303A\301\335"
+	.ascii	"\203\233\321wH7MV\355\n\355\357\354\001\377\254\276BY?\202\341"
+	.ascii	"\033\016\204c\2226\354\355\324Ir\250\013Y\222~s\374\026\206\026"
+	.ascii	"+Q:9~\253\262\301Ka]\3278~\333{\3400\031\222\306N\206\277\301"
+	.ascii	"\372\f\033\345\266f\357\246\r\007yn\244$\261b8_\007_\263\234"
+	.ascii	"\245\203]!5\177aWh\225|\315z\b\023\205[\327U\350i\366{+\344\202"
+	.ascii	"\326V\336\032\263U\262+\364c\320W8\013/s3\327[\2413G\323|\036"
+	.ascii	"\327\023\230\335j6\004\r\341\235\311\037\237\214,\016h\036o\311"
+	.ascii	"\223\227\335J\306\"\357\f\335\341\221\026~\327<\031&\306\025"
+	.ascii	"j\267B\231\241\347\206\356\220\002\273\344\215\220v]O_\313\025"
+	.ascii	"\314\t]\234\214\344\217{\272\3275?\355z\372\262[\313b\350\035"
+	.ascii	"\322\035\256\253]\212\037wE\362\307\345\217\220?\362\215\220"
+	.ascii	"?n"
+	.string	"sw\360vn\353\001\247\204\2259\\\327U\252\267\254\323&\273\371\022$F@=9\211\b\321\304\264\244\224\204\004\342\350\203Q\021\321\322\303\220\252\024\n\002J\376 \217\306\346\346^\357\214\246\350\365\022$\322|\204^\036C\r\246\321C\303O\306\237&d_>\247\354\214\321E\037B\030\016g\n;\255p\021F\024G!\214KuF\023Mt\201Sf\232~)\360Ps\312T\030\303JI\377\232;R\t\306\247\024\030\204\220\023\262\034\216|\234\371\373\362\017\237S\346E\016\034\033\225\360\242\037\032DmP\336\2764\242 |\301\360s\312\336\214Gd_\304.W\346\306\036\270\030\237\344\312\252\360\320\017\2156(sW\347\224E\215Ot\330Xi4RKc\347s\312\272\030\243\354\230\260v\2712*,\004\347(\322\330\255\360 !3'\003\315)[\373\236\032'\241\264@\201\376\307(\203O\n\331\220Y\230\221\273"
+	.ascii	"\346p7\207\222+[c\344\2203\213bfR~<\202\341\335\335\3113\223"
+	.ascii	"r\243\021E\024\316\331\220Y\023\343Q\rX\360\374\315y\314\f\214"
+	.ascii	"\373{G\221\267\206\016\261\r\n\364\374Cc]\327e13(_\023\337\345"
+	.ascii	"0\273\017\332M\352\013{Gz\303\205\005=t\002\301\270\317\215\353"
+	.ascii	"\272\256\311\256<.c\262Oi \030\276\326\372I\263\021"
+	.string	"\313\023\365\265\3763\352\034\273Z\377\205\363\0302\302h\035\264\321\374ii\363\323\322=\0303\305\343\323\032p\362$l\317x)}h\217\245\270\261\263\356h\3506\366\0055hfw_.\357\3163\016\332\334\032t\227yF\235\315u\354\244\271\302\373nN\"*\205\213\326M\277x\021\371fkp\030Wr]\301Z,?E\200\301\306\036N+\255\217d\314 Ny\356\205\273\266cK\031\254\213\317\352B\2444\227\031[\373Y\007\351\243\365\237a\234\274\270G\372g\3750\305\367\341/\034\313w\244\217gx\210\320/^\374\0254N6\306\226.\362:\220\307\376\233\023\265\200\305K\017\035@0\356\323}kx\206\335R\276\335\250/2I\256\353\352b\237x\305\035{\270\037\327\001\036<\220?^\365\317\025\3039\030R|\337\347:,\233=\334\366X>\276\330\362!\177<\337\231\013\031\\\224n\317\027/.\022\357N"
+	.ascii	"\204/\306l\006\023E\016\"\241\263\275v\355\234\334\322\335\267"
+	.ascii	"H\233\201\313v\226]\267-Z\244Y\260"
+	.string	"\264]\261b\304\373*\321!\336\263\235\n\363~\212\222\367kJ\336\253\251\274\207\252\274OSy/\345\003\357\321\214x\177\366\351\367Q>\375\276L\345\375\330\377\276\027{\235\357\237\237~\377u2\337f\020o\b7\3742y\236/\327\367|\267\224\274X\314{u\301/\222\267\371j\240\344=\362\274/\363}\337\"\237~\211|\372\265\340v\337\nn\367\245\340d\276CN\346+\344.|\203\034\357\013\204\210\367G\021\357\004E\274\022\024\361FP\304\353C\345\355\241\362B\240\362\362Py\037Py\035Py\033P\362\356Py\031Pyu\250\2749T^\034*\357\r\225\327\006\021\357\002\315[C\345\245\241\362*\240\344\235\241\344\225\241\362\306P\362&\240\362\276Py]\250\274\b\250\274-T\336\003T^\003T\336\002\206xY,y\tX\362\256X\362J-yU,y\007X\362F\251\274)T^\024J\336\023*\257"
+	.string	"K\336"
+	.string	"\226\274"
+	.string	"\f\361\232PyK\250\274$T\336\021*/\224\312\373\244\362:\251\274\"\224\274!T\336&\225\227I\345]Ry\225T\336\244\346Ej^\020J\336#\225\367\203\312k\024u\366\020\371\350\271\022\242\245\004\364\006p|\374\bh$\026T\343\314\322\004\244\037\370\2437w\336\267\366<\303\324\322\303\301-O\226:\313\236\316\217S\360\324G9\2021L\372W\257\021\211\bPa\2258D/k\013z\254\202^\321Ywq\372\272V\364\021M\r\242\322W\203\340fQj\006\025-5@G\265\n\266\036"
+	.string	"\315\214\363\216\031\305\257e\241\0061gI?\tu~\203HGo;\361$\314\314\207_\351c\351\261\215j\001\340P\270\013\214\3526]\037\376RtT\033Q\264"
+	.string	"\235\242\227\nO4\n6'\372q\336\246_X\232\331\002\f \006\317y\007/\316\t\242\006\307\300\325\2662\330Q\254;\232Z]\251\322E\372V\036\355WY\203#\032\325w\303\r\037\326\237\2553\270\003\274\034\027t\220\261\261l}9g\266,q\321:g\013\201nF-\215\246Y<\334ST\326 \354\341\020@\036"
+	.ascii	"\035\200\211\006\340\214\211V\317\024\347\360\272\200\370\022"
+	.ascii	"\017\367\220\261\242\363\0236$\022\265t\254[(\001\020*\366\261"
+	.ascii	"\206\341\3674\264\253\322\007\274q\314\031\037Dh\211\351\225"
+	.ascii	"?\233D\227\240\273B\242\215|\324\240#T\300\002\325N=\242\221"
+	.ascii	"j\236ZDC\265R\3413\316)w\247~J\001\213S\177\360\r\032\242EH\371"
+	.ascii	"\204&\230\020\355\001\314\020q\332\324a.\226\207\251\225\272"
+	.ascii	"\251\221\202\317\350\022S+%>\343\216_6H\245^\352?\025\235\274"
+	.ascii	"\310`\254\266\bQj\031g\206sPf'\365\237m\254\363\214s&\365\355"
+	.ascii	"\374\323\030\332\310q\266\227\222\333\033\266%R_\216\275\360"
+	.ascii	"\227%\315\267f\027\276X\263\013\362G\244>\362\025\316A7\r\034"
+	.ascii	"\2677\036\244\034D\177z\027x\202\217\232\331\213l\020\375\324"
+	.ascii	"\244\275\366C\037u\227\tS4jf\177\350\246\304\032\334\305\250"
+	.ascii	"a\360\r\"\016\021\351Gi\020\324\334)\352\267D\306r\242.\352\243"
+	.ascii	"\337\262\207\232\250\223\330<\345<\364r\213\016\017\255\236\t"
+	.ascii	"\"N\207z\267Y\002K\273"
+	.ascii	"@\374\031\005\377.\244\332C\312V\373\250&LQ\250\201Z\331K~O\025"
+	.ascii	"\202Z\250\255\t&\250\017\0070\331\314\006\352\037?\023\330\212"
+	.ascii	"U\262\t8\023\234\233\252\245\360B\030\265\245\373.\344O\277M"
+	.ascii	"\f\263u\375\364\351\334\004\037\036\304)\313\345\320\366\247"
+	.ascii	"\234B\";\353.\020\005^\233j\261\254&\002\231\346\034\023\344"
+	.ascii	"\217\310>\234\363\233\026\267h\335\364\2040O\312\204Z\272\234"
+	.ascii	"\344\264_\3579\336\336\302\366\200\376%\310\273y\0204^\302\366"
+	.ascii	"\220\373%H =\2066'\350\330\203wq\300\270\317\030\206\242\343"
+	.ascii	"\330/\363\326\202W\342\016\201Z\272-\030\246\367\363)\275#L\217"
+	.ascii	"\257:H\2175y\220~\273\201\nf\222\252-\251+\254$I\260\250\224"
+	.ascii	"\220 \231\262\301\314\302:\302\\@\211\310\bVU\026\223\003\344"
+	.ascii	"\024\006|\205UEu\245$\207\025\025s\003*\020[5\230[J\250\230\037"
+	.ascii	"\340\330\372\200y\245ZiMm\031\265\2000\223T\375\330\272bfe)\241"
+	.ascii	"R\221Ly\220\305\334\272\332a$kJ\211\016f\222\252-$SL\t\230F\252"
+	.ascii	"\264\266\224`5)\227lUeaUe\371\240\252J2u\265\344\206\021\346"
+	.ascii	"\026\025\023\tS\213I\313Jk\352\207\006WU[US\\\312\245R\221\305"
+	.ascii	"D\242\304\bs\003*-\251\253\252\251$RTYZR*\240\026\213\003f\226"
+	.ascii	"\324\026\026V\226\224\220\335\027\334\365\236l\243\203\234\257"
+	.ascii	"v\226x\301\314\336\037V\212\3748*TS\nsC \211\t:\272{\022\264"
+	.ascii	"\217\236`\357i\354\230`e\335U`q\361\020l]\277HD\320\022\310\371"
+	.ascii	"h$\035A'\t>\343\234\316\236\262{>\372\210\203\3324\204V\373\362"
+	.ascii	"\006e\322\\\035B\303(\323\244\323\254\222\212L\372|n\034#f\020"
+	.ascii	"\261G\243q5\004\335#\254\243@\320\307A5\036m\366@3\320<\372X"
+	.ascii	"\350@7\320\017\364\222\037\003\355@\213\330\321\r4Y\023\314\216"
+	.ascii	"\236\0018\375r\322O\030\350\243\340\f:z\254\351/G\337h\035\215"
+	.ascii	"d\203\243\271:G'%\336h\034\035\242p\254\235X\335\350\0374\301"
+	.ascii	"\271\351V\333h\256n\033m@\232\t/x\253w\201^\030V\300\332\213"
+	.ascii	"\254\237E\026\350\0374<s\323\257\255~\341O\227VE\331\002\024"
+	.ascii	"8#jtV;kt\263\271\323^]\205uR\330C\243\027\255V\005:F\323h\243"
+	.ascii	"\3403\212\325\n\314h\031\215\325N\205O9\0313\232)\361\251\202"
+	.ascii	"3\261\tF\006\t\277/Y\242uS\267N*\fS\214\321\314\376\226>\341"
+	.ascii	"\215b\352\020&\246\341\231\261\016VQ\177\337s"
+	.string	"\213\321Bh6 N\021\255\326:6\314A\221\364\214\276\305'a\002\315\247\tf\365{\321\t\364]4\263_\364\217_\241\325\352\242?x\243\th4\314MM\030*\342A\265t\327\211H\237\212\323\220n6;\311\213\236\273\300f/\347a=L\2424\321\320\220?\036\321\374\346\240\b\020\246\265\350\003\032\201\301\246ZZ\223\255E\003A\277\250\364\001}A\237\2310E\003\032OS\rY@\033\260\374\307\200M\265)M66\344\217\005t\235\027\272h\035\024\356\251\245\333\025\246'\342Z\200\004\325H\b\272\352\"\026\034\323\f\211P\200\206.\372\nzl\215\"\204\364\365\256\003pL\330^\020C?\244\307\240/r\224G\316\013\217\236\2351N!V43\255\b*\024\023mZQAS\320c\034\242H3S\221\036z\\\302\366\232\212\364\032\227\206\264\220\307\331\355\n\303v\352h\221\322\221\326\220\245\037G\004\213\266"
+	.ascii	"N\207;\032X\3641\202#\250\"\3210\320\261(\204\206FD$I\222\fk"
+	.ascii	"B\n\020\206\243\201 \270\324\007\022\200EA&\241"
+	.string	"B\250HFA\223\244\324\034\3462\323\263.\225y\361\335\260gx!\206\211\326\227\302\".\216\364K\221Pb\301\364[\032\213\231o\361!\034\311\306\360'\216-XF\331\223\325\3466\334n\3674\022\200\364\217\020\001=\256\205\257\363\263\315\322`w\215Y#\253l8\321\025\217\324\201h\2248\336\237\026M\0335\364\220X\336\266\266\3459\312c`\302\251\315\bq(\204\245P\270\354\241\230F\370\346yb\244\344G\306\220#\f\032{q\026\325\222\255\fbF\247\220\215\224\020\375V\272\324\177Q\350\241\222.\027d\020F\262=\2241\350\253;\206\262F\b}\243}'\001\027\226\206\373\223[\216\"\355*qm\226\221T\304\372,N\253\315g\332\003\204\303R\201\202\251\013\334\323\372\177\246\257\033\357\315=\320\343Q \t\001rC+\013\356O\213\222\265\242\316\221_\033\001\221\331\241\370\217\320\335`\317\022\372Qg\207\214"
+	.string	"\301\036\261\232\240QI<\002\006\2740\250\245\217\367\232G\276\333H\t\276\r8\312\254\020jo\004\253n\274\025\025\370\273*\231f\017\207\326L\347\201\205\3626\225K\207\265\271\265\023\231D\344\f\330U\234\364r\353n\207\271\254\246\347L\231D\037}2\230\304Y\263\332\203\242p\236H\334\276{\023\231TI\256%\340\021,\035\253\254Z@ry\026\211\320\373x\231\255\304\215#,%\301\344p\021\b,u%\337'\364,(\354\n\022\\\365\344\200\326\262\365\274\203t\245\036i{\356k\006\231l:O/\226\032\261\204\374\212\233\344^L\rn\034\216\310\020\315%\325\025\033\r\340\312\205\001oS\314R\255\360\260\337Q6\\v-\024<D\275\235\221\025@\371\301\223\364\030\334\033\006\022_|\1770\276"
+	.string	"\246d\201\344\300\006\342`2\fg\341\305\361q\206\210-\374\271\306@\337\242\240\212\276?\322<\005Z:\354\252k\037\013}\232\201\2154\327CTibVxpD\251\271\006\217\235\216\002t\205_6\216WL\240\221^\033\373\2440\213\216?\337\304(\303\326X\313\207\374N$\003\375$\033\222,w\276\033\002\030\313\264\325\373\226\256\025q\215G\247v\307,\3119\215[\261\031\340\332\204/\350\336q5\2224\215\262\330w+\347,\355d\204\301!|J\261\363%\230y\302R.Tf\224\373LJ\020\321\206mi4\375>\356!E\337\234n\274\265\357\235\331\212\371p[\340FP\006q\034\033\304\331.\221)\t\204\203K\320\365y\326b\262.~\030\313X\337W\310\n<\372'\333\301\242\340MU\256;\3725\306\316\004\217\377\234\217\273R\374\205\302\252Cm\252(\200l\013S\351\232si\321"
+	.ascii	"\003\325b\243f\256\330&\241\323\241\257\265\305\253d\273\027"
+	.ascii	"M\021\270\232t\201+\r\241\035o\264\303\021\234\352\235I\202\226"
+	.ascii	"\220\006\344\315f\004Im5[<hh\256\332\272\231+81\036Ms\361\364"
+	.ascii	"\206\260ay\333\354W\3027]\263\032\344\313\353\353\006\351\210"
+	.ascii	"\273\025U\025\221\204\222\311\022\3048\341J\343$\035m\177e\r"
+	.ascii	"\t\036\212\317\037\016G\3145UmM\006BMHd\2726#z\032\bl\275V\221"
+	.ascii	"\330\330\020\005\001A\365\244\0226%\205\237Q4M'\261<\027\354"
+	.ascii	"\257\222\354\025FX\376L6\253\367\360\177s\342\213\202D_\266\227"
+	.ascii	"L\023yJ\313\2208\006\307L\265\302#\372\034Zr\177\031\0327\365"
+	.ascii	"\261\f\006\007\203]}\205\300\253C.\331x\250G\260\375,\207\371"
+	.ascii	"\231\033\273\204<\305\303\303\370\341\233\240\301\200h\242\320"
+	.ascii	"5\352\366r\206\212C.>\247g\344<d\\\034\3553\237?6\374\b\346'"
+	.ascii	"h\035\256p&\007\007K\367<(o&\024\261\353h"
+	.ascii	"w`j\005\225\356\2148O4\247%\204\264\254a\306\351\020\323$\227"
+	.ascii	"\253$Q\227P\006Z\230\2671 .Ls\3125jf\024A\270,\305\263(\r8\377"
+	.ascii	"0\337kUt\332;\235<\216\266\263\223\245\227\212\274'\235\007\220"
+	.ascii	".\2002\264WbI\013"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.53.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\007\003\245\023"
+	.string	"\206\341uJ\320\322(\035\222\230n\332$x\330{#\334\004x\252\262\002\300\276H\310H\304\316\331\326P:\t\352\3419\002\300\361\301\006\204mo\341\214\212\335c\225\003\274\340\250\344\250\b\f@\332G\313\030\305\030\032E\320a*\233%d\357\224\002Z"
+	.string	"d"
+	.string	"]"
+	.string	"\346o\\\274si3Sj\177\305Y\300~\343b\221\335\021I\271\335\023\301?'"
+	.string	"\377\241>\300\364\317\273"
+	.ascii	"\323?\373*l\2333\303\354\245\237%\3665\243\230\032\220\335\025"
+	.ascii	"\377U\022\207\275R\017\346\313h\031^_;\225\321:\234\216\334;"
+	.ascii	"\235\354\256A\017\367w\333&\266#\330\325\025\017\362\205\034"
+	.ascii	".\351x\016\303\227\361\037\207>==\006B\355r\017\300\234i\224"
+	.ascii	"\206\215a\240\257\314~C\020$\036\272\335m\360\235\267\360q7\363"
+	.ascii	"\266\027%p\256\314\314\305_\300n{}af\"2\244\035:\224\023\334"
+	.ascii	"\261C\034\352\343\230~\315\241\355\353\344\264\320\005\033\373"
+	.ascii	"p\340\237kN\013\317\t\370/4\245?\003\265\326\377\034%\310\204"
+	.ascii	"Q\314\020\377\3507^\276\215-\224\364\262\322\364\357\365\270"
+	.ascii	"\033@\341#"
+	.string	"\305L\214\356h\255q\365\356m\245\261?j\357\271\273\376\374\351o\367O#\n@\354r\330\tY\021_\317\211\337~\237?\367\017\375E?\321\257\363\223}\177\306\211\374\032\267Qt!3\210\306\220\222.\251\024*!\205z+\006*e\312e*GR\325r\260\032[$\013\302\213\305\022\300\252\022\222E\341\302\2125AU\212,\255\324\212\250\"K\261\244\200\307\n,Rt\215#)\206\367\266\322\370\265\203\266\036G\261\372\342Zk\215m\257\332*\317\261\002@\307\356\232\37080\214\276\315\013\367\207H\232!y\255^%Q\202\371\361Bw\246\001E\250\221P\246\220\"\024\314\004\222\206\342\264p\200\002\031\232<\007\022 w9\212\331\344Yna\375m\353\201\231>\"\230\201o\nE\244\021\023\207\214py\261=\022\362I\213p\313\361[\220y%\353\226}\203\236\221\246\013\237\f\361\362\367\024\037'\007\005S\003\177\240"
+	.ascii	"\0253\333_\311\312B\344\311A\346\271_\236\307\264\03084)`\307"
+	.ascii	"\317Ba\371\374\035\0213K*%H$\005\233?\034\347\030\376\316QZ\311"
+	.ascii	"\303|\236\217\317%\201f\035\032\315\032[\020$_\027m\370rx\n"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.54.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\271\002\325\025"
+	.string	"\226\350\215H\3000\2511x\246\346\250\256@\324\377{\261\205(v\327\210\261\255\037D\037D\330\323\221\235\377\3760}v\002\024U\326n\2474\005\241\n\325\255\337n\233\242\3502|\240Pf\240C\304\013\214C\262sik\226l)\245L)|"
+	.string	"u"
+	.string	"u"
+	.ascii	"\267\366E\330\356\001\355\263e\274\024\272\037n\325\fm\334{g"
+	.ascii	"\267t\303}\207\275\\\243\255t\306|\376\207\027\001\361\202\f"
+	.ascii	"\302\034\026\362r\t\2133\200nv\356\252\003\\T}\020\351\371!\312"
+	.ascii	"\2025s\254\037?\"\362-\200:u$K\212\006\315\264\223\f\342\274"
+	.ascii	"\306\2028\247\365\343JC\214\216\340L\035\361Yq\341P\2376A\231"
+	.ascii	"9\003<\346jp\357\365cxn\331m\007\331v`\317\2458n\006;\325\341"
+	.ascii	"\304\337\276\317\364%\037\3122b\357O\274\tR\336\033\240\337t"
+	.ascii	"'\337\237x\2774@\030\211\225#\353\336\322\300\255O\312\327\360"
+	.ascii	"\376\260g\313d\256\363J.1\351=\311\345\345\375\325i\227\230\370"
+	.ascii	"\236\344\002r-\253\021T\n^\267\236\363e\357H/\265\274A\240\347"
+	.ascii	"\264O\342G\276#\275\030v/PS\324\275\345\201[#x\335\022\370\307"
+	.ascii	"x[\3571\006\226\332\330e\254T@\316\r{\342(x\376\220%\244\244"
+	.ascii	"\214\267\2242\340\240s\"\322\307\252R\241\247x'B\244\355\n\227"
+	.ascii	"\272\235I\350\336\273\300\304\243V\374\241[\343Z\346\311[\277"
+	.ascii	"e\274\235\364$\206\230Y4\375\224\322\272\372\241Th\217\277\214"
+	.ascii	"\2478rj(\301\230\231[\223\nMc\257\227\006\331\343\364h\247\355"
+	.ascii	"\225\376j\247\251\235\236/\377\313<\n\364\334\373+\0067\035m"
+	.ascii	"WQl*\021h,6\027\312\203\233\216\266\033]#\311\331Tx(\266\t5\335"
+	.ascii	"\214%\205\2662\253\345t3\222\020\343(\330r\263\035\016\227\233"
+	.ascii	"\311l\317\373\257\022;V1T\006\006\341\246\311\t\353\351\005`"
+	.ascii	"Zj\323j\363\244;\210E\253\031\ncT\304c\344\242B\353\306\221\276"
+	.ascii	"\310\266]\205\356u\357M\340S\355n\376\020o\274\035\251+\251\030"
+	.ascii	"\342(\205\205\237\207\221\n=+\2454\213E\025\23547 P\002!\311"
+	.ascii	"\352\016\355\366{.n\203\361\027\342\314Dln8L\022\366T\350\023"
+	.ascii	".|l#\325\001\273\031[I\230M\244x\333\345\3440\370\334\221O\363"
+	.ascii	"\234_\203p>\352\f\241\037\b\270\274\020O\236\033\341\211\321"
+	.ascii	"k\005\274\301\330\333\257&\bcp\n\371\275\b\304\306\213\230\264"
+	.ascii	"\200w-v\274\262y\262>\263-\260\234\267/k\220\367\275~8,\020\302"
+	.ascii	"\341\251\206\326\036\360\270Oy\370\033\254\235y"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.55.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`H\001\005\f"
+	.string	"\226\224LD \213*\035\240\250\204"
+	.string	"0t\022\213\357\233b\212`\251\211M\200\022\234`\3437\f\231\344\346\213\202\2004\036\272\365\337H\024\034\326\351\325\013"
+	.string	"(\013(\242I\034\020\332\001\230S<\352\323\310\0015\262\311\336)\0055"
+	.string	"8"
+	.string	":"
+	.string	"\325>\002\333\247\225I\233\303\313\327\236f\300dv\333]\360\225\0228y:;\322\277\354\027\025\253\344\364\201\205\362\031\361\256\302\261\273\266\244\334\365\2665lk\354S\b\025L\006n\367$\207\333"
+	.string	"\325v\300\366\355\313N\366\367y\316\227\247\307L]\271\254\225\347\264\237\340\n\310\307L\276\354\n\270P\333-/^\215ay\255\370\204\367\332\035\343=\016=\002\204\007\337\002\r0_\344\331\341i\"\n\215m\2227\030%^\273\273\301\3403\222_\340\325#\245y\325\253_\362^!R\030n\035P37\251\313\264\353\226\266\354\227\377\003\235\016\320\270\031y\346dD\017\b\251\343\371\340\214`\310g\023\0029\342\bf,\034\212xDp\024\206\"\370\275[\332\262\007\200\f(\2322\245\324e\177n\241\202m\300\006\030\350\265\t\022nwp\007\" \300\202!\034u\251\366\205\211\215\3544\f\331Sqh\206\301\335\007\333\335\233\313\211\307\301d\235\020\341\304\216\353!\tq\361\340P\333\340&\332a^\327\026\245\221\323Z\034-\235\311\231u"
+	.ascii	";y\317,\240\275p9\325\351\327\2561"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.part.0.56.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\225\n"
+	.string	"\006SE< \345*\035 w\022Y\214\nH\031\001\270\027\1778\030\f\236;\037\204\022\220X\006Y}\206CW\321,A\345\336\234\356@"
+	.string	"B\021\b@l\036\364\214\261\253+\267\340\266A\366\336;\2451"
+	.string	"4"
+	.string	"3"
+	.string	"\257G\261\235\362\260h\333>\276\366\264\032\307\254fw\275\327ir\361SR\321_\2614>/\273\\\261>.\007N\003\034v\327\033\220\273\336\036\373\f\001\001\226\244\302\234<v\373))_\346.\226\372\210\222\017\253\nIx\265\224\366U\276\"~DY`\267d\346ewTx\365\302\346\325\340\004\334+=\207{\355\002\273\036\237\226\021\372\260\023\367\212 C\343\267|v\362a.\231\344W\257\276\211{\375\254,6"
+	.string	"\"*y\223\323\345IOw\266\354)}\312i\030\331\355\270\005!\b\212\360C\342\f\352\200\242\212RH$\001\n\275\213\211\217\205\007\002C\257s\340\017C\004z\244\357\003\275\316\266<\335\331rD-F57<\347ty\304\331\337]F\005\257\r\030"
+	.string	"hm\321Y\326p+\337\230lb\242\005\025&E\205\007\210\202a\256peM`=:\n\301x\236tO\323E\265\323\271\240M\227\235\013"
+	.ascii	"'\236\313\350\230w\254\264:\346\340"
+	.text
+	.section	.gnu.lto_.symbol_nodes.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\241\002\035\016"
+	.string	"$\024\235\003"
+	.string	""
+	.string	""
+	.string	"\0025\177$\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\017%\200\204\001"
+	.string	""
+	.string	"\003\0027\177&1\030\0028\177'\002\030\177(\272\200\202\002\027\025\005\024)\005\025*\002\031\177+\252\333\3426\002\032\177,\305\245\376\322"
+	.string	"\033\177-6\177.\002\034\177/\035\1770\036\1771\005\0212\005\0203\0234\201"
+	.string	"\002#\1775\005\0376\005 7!8\"9\002$\177:%\177;&\177<\377\377\377\377\003'\177=\002(\177>\022?\200\003\002)\177@\002*\177A+\177B,\177C\005\026D.\177E\252\331\227\001/\177F\037"
+	.string	""
+	.string	"\200\200\200\0010\177G2\177H\003\005$\003\n%\227\356\322\027\001\304\013\003\013%\363\235\316\032\001\344\006\003\f\013\312\345\311\310\002\001\242\006\003\f\n\267\232\266\267\001\001\202\006\003\031"
+	.string	"\340\236\212\256\001\001B\003\032\f\002\001\302\001\003\036\002\321\360\372\250\037\004 $\004\001D\003 \n\004\001\242\001\003#&$\003#&\235\332\250\031\001\204\033\003#&\334\222\302\f\001\204\253\001\344\253\001\004#\264\321\270\231\001\001\225\032\004#\325\352\353\264\031\001\265\272\001"
+	.string	"7 \220\002\231\272\262\003g\b\002n\345\223\350r\273ee\213%<|\036\363\326\302qe\270\365p\001\004GZ\372.\205AX\252\r\310\272Pa\313\206\364\3207\366\217\220H\237\035\236>\"=B\234\233\b<\306TJ\306\3303\246y\220\016\303\211\264\263A\335\240\215\r\322c\373\207\024\001\272\207\264."
+	.ascii	"\237c\310\323cEW\221\301\244\t\247\307@\037\003\203\277\005\244"
+	.ascii	"=\b\201\222v\200i\352Z\006"
+	.text
+	.section	.gnu.lto_.refs.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\235\b"
+	.string	"\246\026;/pEI:\n\353\f\251\2127\342\221\003"
+	.string	"(P\300\003"
+	.string	""
+	.string	""
+	.string	" L)8\016\003\372\326,2\213Zk\315\332\366\377\332\337,!\233\220\275e\n+"
+	.string	"-"
+	.string	"0"
+	.string	"\235\311\333\221\027\260\226\264>e\217\362\216\344\315\344c~\333\f{\265o\356\270\261\365c\275y\013UW\330\021\373a/\366\324\375B\004\370\016\376\003\237\301\3176\036As\233~I\217\321\027:\242^\220\256\236\216N\257\363\200Z\261\005\360\313/ksc\377\360\036\267\323\276i\001\n\225\237\260\016\345GX\177\330\257K\302d\274\024\341V\255\227w\260VX\203Zz+\245\364\205\177\275\340N\254\244[\360)\370\022|\t\037\302\207\004\337\207\312\327\241\375"
+	.string	"O\037\300\363o8}\r\347\317\310\037\203\365/\330oq\371+\240>\005\364OD}\211\350\217\230z\303\364\fR_\220>\r"
+	.ascii	"q\023P\260\302,\r\03517j\032\247\031\203\f\266I_\247\226\b\213"
+	.ascii	"1D\301\245b\333\031\302\300e\001"
+	.text
+	.section	.gnu.lto_.decls.71f644ae67402a3c,"e",@progbits
+	.string	"(\265/\375`\226%%\240"
+	.string	"\252\366\3505N \222\312I\007Z<\357\211#7\00636\377\205\351\021\254\267\016t{\361_j\222\301\027\273\302\302\222\316\214\217\026g~1@Ex\333g\306\273\026\320\324\201\252\272"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\030\213\331\304\233\265\254E\244\031\321@\260\373\177\311\346"
+	.ascii	"\311\2262\005\262\002h\003f\003)\230S\244CtI9{\252o0\277>\246"
+	.ascii	"+\023\345\321)\367q\f^\250\264\351\224\371\232\367\230\315\231"
+	.ascii	"\217\365\200\240.\363\245\367:1\247\020bN\301\303\006\305\251"
+	.ascii	"K0}\013\241r\036G\205~p\255m\221\361\261\242\344\253\212\023"
+	.ascii	"5?\207\261\030\337\331\251\037\314[v\257sD\360N\033\250\230N"
+	.ascii	"\177\266;\337\235\017\350^\261{\257\001Bbl}s:=\034\216\376\027"
+	.ascii	"\336`{\362\227D%\352\245\312r<\307\320\023Lw\t`\334&\311\234"
+	.ascii	"bWW_\314N\337T\352\371D\220\003\371D\360LG=\347\251/\270D\220"
+	.ascii	"\211`7\206\252\340\2673\033\2279\217\223\363:\373\313\216Y\027"
+	.ascii	":\365\254\"h\003\003YE\360<F%\342\022\301f\022A\026\303k\f=\033"
+	.ascii	"\217\271CCmp\222\250uz\216\252<\364\234-x\246\242\242"
+	.string	"`%\352y\210z\226R\257C}\021\203z\020T&\343.\f]\301^\316\\\330y!\224\363>\357u\016\0019\021\tC\327\3515P\377?_\200\323\205q\022\352yEp\210W\004\337*\n.\021L\235s\\\"x'\227\b\252L\"\230\224\006\3647t\350\356Z\036\"!\006*v\377\003\177\356\263\3719H\375\231\347g\3466?\367\270\375\354\367\006\376\367q\337\232\237\363\322|\203\337\346\360\363\225\247\277M\372\031\211\346%~{4\3048\352\326\376\362s\rt\303.?K9\317og\260\343\365\237\337\3720\367C\007\302 \347BS\360\037\360g\013\376\333\371Y\203\237\377s\006?\373\374\f\343\347\237\237c\374\fT\301\317\366g\f~\016\376,\343g\027\022\374\2773\301\320#\370m\t?7\240b\005\003\027\372m\334\231\377*\356\363\333\241\236\337\376\004\177\333ccG\320\337n~.c\346\347T\206\377\006\354"
+	.ascii	"\300\337l\324\277\327\230\301]\3707\333\317o?\267\375|\3663\330"
+	.ascii	"\317W~\246\362\363\224\237\327\237\207?K\371\031\312\317^?\377"
+	.ascii	"\360\263\013?/\371\031\311\317Z?\027\371\031\353\347!?[\375\354"
+	.ascii	"\343g\252\237\245~\216\372\371\351\347\373\363\216\237w\370\271"
+	.ascii	"\351\347\342\317J?\337\360s\322\3176\374L\303\3171\374L\343?"
+	.ascii	"\n\377\345\374\274\301\317,\376\277\375\277\373\371\304\177\033"
+	.ascii	"?\017\360\177\314\317(\374<\364\337\313\317&\374\337\373O\367"
+	.ascii	"3\t?\207\360\363\007?{\360s\007\377O\370y\306\317\034\374\034"
+	.ascii	"\301\317\020\374\234\342g\024?#\360\363\001?\027\375\f\300\317"
+	.ascii	"D\377k\374<\342\377\b\377\341\376\017\020\030\030\030\370\367"
+	.ascii	"\250?\217\331o\302J\314%\321\324\223\271\234zr\025\341#SvoK\264"
+	.ascii	"\276\256\"\234\234\202\272VUG\234\224DsSN\346Us/\227\361\270"
+	.ascii	"\312\004\356=\302T\252q\302b\265\2479\253'4'&;\357\275&\252\236"
+	.ascii	"\272\230\027jn\252\n\363\336*O9n\025\005I\347\334\365\342\271"
+	.string	"\244\222#\367\007\217{\t\250\2727\311w\356\336\233\274\367\366(\2178\3575B4\325\254\252\2727\253\250\352\036I\212\341qo\227\345\251-\247\236]L#1^\236\315+\345Lr\363\252\341R\252\317\344\330\375\341Fm.\203\264\t\303\320\016\323YEd7\351\263DM\026\213\024\360\211\225\353Dch\243\365\226\b\316\233\364I\353\253\003\374\273J%\213\247W}\266C\233'o\235>\205R\333\354)\0313\310:\0219\223\326iG\205vn\220\224\325\361\302~A\177UsN\350S\r\243\246\367\306\351\263\206\365C\253\323\350\217\0312\3002d\177\254\246\211\304\314\2303\245\022\222\344\353\264\271Xqb$\013\237z\026\013\243\223\326]\034\315`\316\034<\247\225\336\322Z\372Jc\351!\232Jg\351*\r\326b\f\355\260\026B\254\2450\2315>\030a\034\327\315\013\364\260\326\376\302\270\215\215<\254\265\2774cl\322"
+	.ascii	"9\312se\036\210\375\245\205\361\\\0317\257\324\351\233 \254\247"
+	.ascii	"0\237\220\275wkM3M\030\243a2,\354a\255\025\t\331|h\351+Jm\232"
+	.ascii	"\240;Y\356\324!\023\205\257'\254LW\031\224\016\202\353\3125;"
+	.ascii	"\355\257\237\"r\326\316\220\251M\332I{5\023\206\366\223V\362"
+	.ascii	"\324y/\032\003\302\211u\231\351%\034\025\022\336\313u\306\350"
+	.ascii	"\t\217%\360\206\265\006v\257\263\bhK\240\034\247Oz;Ee{\204K\205"
+	.ascii	"\n5\346\213\030\020j\202m\352\300\270\230'\206\234D\252\224$"
+	.ascii	"\331:\303\354\022\327\351{\353\357#\215\244\227\234W\344\252"
+	.ascii	"M\247Bg\226\021\243\267\226\320\214\016\223\266N\001(\222\345"
+	.ascii	"Sw\026\310\246\323w\326\337D\032\253\225@\314\001|\252\002\261"
+	.ascii	"\304\351\364o\227K\004\177\230L\"\330B\214\336CH\004\225Y\316"
+	.ascii	"[&\264\314\002=\353tD\007Y\0214\307\356\t\fH/\201\306\344\342"
+	.ascii	"@\365\262\225\375L#\"\247\323\276*\nj5\261\322\326\351m\020\365"
+	.ascii	",\326\306pBND\027*\252\2549\006\327\324\002hf\213\231[\363\357"
+	.ascii	"\037]\325\311\366\301v\372\251\251z\212\357\264U\363\350(\016"
+	.ascii	"\354\333N\r\325R\f\355\036?\323\341:/r\336\013\345\004\303\321"
+	.ascii	"/\3150\034\025\202r\336e\017\364\fk\355oN\024\254\265?3\335\203"
+	.ascii	"\3170\234u\252\251RP.\022\300\350\036\034\307uBI\347\275\362"
+	.ascii	")B\354i\324\206\377x.\313y\201\370@\245`\255\375\235\241\241"
+	.ascii	"\341\261\037\217\"\2628\177\336R\306\321(\364\215\305\272\007"
+	.ascii	"\027\301jd\360P\n\245\242\206\350\273\327\371\t\3200\031!(\242"
+	.ascii	"\013\265$\254\231\246\306d\354\230R=[b\326w\357=k\351\036\374"
+	.ascii	"\345ivLy}<\t\021#\352M\233\326\337\275\267\350\201 +?+\251\005"
+	.ascii	"\322\367\232\312s\325\314\376\344\f\205\ta\022\204PL\035+C:\345"
+	.ascii	"7\f\347\034\207\335\\\2618\0240\343\f\001\336\3534\304\034g\003"
+	.ascii	"\312\272\373kB\026\327\205\346\251S\313\305:\031z8;v\2415)38"
+	.ascii	"1\365?\360\341\202V\354V\313/\024\256m-\341\252\022\366\013{"
+	.ascii	"\316\354\264\232R\324\3738\001\003;\021\244\331\325$\210\317"
+	.ascii	"\226z[\205\355\025{\245\351\223T_\360\331\202T\250X(?\250\325"
+	.ascii	"\001\202\005\201\231\302\272[3eJ\347\331\371\361\372\301$;#\005"
+	.ascii	"j\2450\037;\357\325\320\236\232\020\372\365e\241D\275\372\322"
+	.ascii	"6H\304\326\202\270\205\342\2457d\215\220\253I\023\353%\274I?"
+	.ascii	"\n\374\204g\242\356\300Y'\267^L\346g\013M\0241\3412I\022\273"
+	.ascii	"\004\272\245O\255\312\226\017\253\344vI[\235\020u\235\332\256"
+	.ascii	"\376\222\006\t\022\325\343\262Xj\3201. \322\2577jk\230\315E\250"
+	.ascii	"\314\316\223\033\2460\n\t\222/\013\027\306\216\026<-\255'=Q\262"
+	.ascii	"\200\301bV\244\bGS\257f\320M\013\215\020(XX\034e\245\352\005"
+	.ascii	"\352\244\217\265\376\234YAT\253\264J;D\275ljC^\350\202pY!\267"
+	.ascii	"C\032\016\323.\211\rB@V\2236\033\304\002\031\022b\354I\221\376"
+	.ascii	"\262~H\334\346\354RuRo\177\260\265b\250\265b\270v^epo\216\b\026"
+	.ascii	"?V\252\224\360\341\251g"
+	.string	"\206\363a}tY^\263M\375-\225\245\352\262\324y\227>P\232=[\244\244\370\216\2634\350\022\330G\325c\357\215\024\325F\331(\373\204\206NS\310,N\371\\b\235n\235\354S_\346\275\315\236\350\023^_\020\226\030\036S\366\251\335@\220\345\266\304H\035{\353t  `\007\252Er\314\024l\216\223\254;\357\300\337\025\021\245\254\323\266\323_\002\241Pi1\037P\017 c\266:}\217\017\365A8s\346X\300i\216\340a\341\311\221\323p\324\013\203Y\007\bf\237xkqsj__\303\021!"
+	.ascii	"*\227\307\n*W\346\315\033\016\373\224\235\201\211\343\246\373"
+	.ascii	"\242{\321N\273\215\320]\233\236__\361\344\271\241\252\353\324"
+	.ascii	"\357l5%\nn\215\217\357l\237\323|\252g\301\255\307\320\326;[z"
+	.ascii	"uY<\210E\305\303\353<#e\035 \230\234\220\036]\235\346\005\241"
+	.ascii	"\246i\2734}w8\357;\236\272*Q\316\212(\242\351\210\356\323\235"
+	.ascii	"[S5\223\207\346\253\323\007\251\324\363\310\251q]\027\327trr"
+	.ascii	"M\007g.\325\353\373\0023\367\246\263o\200D\001\363e\200\300/"
+	.ascii	")2\365<[\352\373\215\333\214\231^\026\201\271N\026\347\001\242"
+	.ascii	"\236{\031\\\353\266\265v\013\336\313N\346\225\362f)"
+	.string	"W\374M\304\333-E\303\305NM\253\265\230\367\030h\217\3512j\362\336\"\270\254\254\025<\005j\306\245\323.\363 t\212\0212\2356\231\376\302Y\366\360\276\272,\030w\005H\247\323\363<\251O\367\324\376\203\327Iy\357\005\302\343\274\312'\240 \3630\257\370\203\330r\002\327\3767\201\343\336$\230\2767*\2254'\255\243\270\377\334\275P\\I\016\270\226P\\XSO\256\233\204\212\222\034\241\274\\\311\251\347\275#.\024T\322\003\346\0351\365\274\313\033U\267\344\353\344J^(\346\035q\241\256\023\212)(\256\345\324\323i9b\352\311\265\274O\256Kt\241\234\224TPW9\342>\271\374\3563\317\321b]\"\"]\024\231\226\226\230\216L\034[\320\261t$T\001\271&\231x\216\026.\216\306U\007\242\021\211\200#\223\361\210\270\024\\Z\227z\236\243ER\221hD\036]\254HMJGE\242\013\343\261\311\205"
+	.ascii	"JJM\305\"S"
+	.string	"\261\007yc\355\201x\f\356\300d\314\201d*\366\340\030\256J)r=.\255KA!r=\342\300\221\302\221x\034vPd\"\322\320a\300\212\034\262\260\366@\\\"\"u\244P\002I,\216\020t\2444<\032\240IiH\003\271\326H\3729\001\001\033\005\230@\256ID\310\342zd\\U(\032q\\\225t,\rk\034\223\212D$q\370B\021\322\220\311\204\245\025y\334Q\003\311\303\212\202\020y4\022A(\261\352\300\264\264\262\360\203\2044C=\026\211Cd\221)h\355\201X#\350\310\244\002\220q\270*\321\310\301'\201\023\0340\340xDD\036k\254\307\225\005\243\002\310\342j46\035\375\b\275h\2014\016u\264X\215%~D4\256\3055I=\0051\"\210!\203\207\236\313\270\340\305\005/\202\227q\201\221\321\0051\214\324\3070\262\307\236\037\355\030\032\2153\326\246\265i\005\241\365\006\222\017\362\206\004\023"
+	.string	"!\255J6\f\213\037\034\211B\245!\344\r&\034\305\021h\3408\032A4\f"
+	.string	"y\003\307\221\372\034)\316\244c5\272@21\031]\374(\r\221LH"
+	.string	"\214\303\034G\351\2724D\001\207\343\320\206\rM\307\037%&\246\016n\360\034\2559\216\204G\305&\020T$&\242qU\001)\byCF\017r\210<\n\355@\022\215LD\243\nG\304\245aq\007\322\020\362F\f#d\221\330\244\036g\004!o\374\254\310\241\t8\034\207H\022J\303b\022\261\206\020r\006\322j$\036W\017\220\307\241R\320\252t\264\203\306\23244\256:\314\020`\210TZ=Xj\252\221T$\352\300\264\004"
+	.string	"\362\306\261\205u\211\210TodD\003E\013(\204\240\036\2650\256JMHk\216\243\243\213\"q\270\344\342\310xt\321\002\305\272D\264Qd\"\"\233\216V\036>\340a\270D\364\036\256+\\@l\033\373\246$\213\217N\367\366l\2370)\264\206.L\355\357f\tas\333Gf(\257\t\333[\247\226\217\243uw\240\310\371a\242\006\220\205\305\252S;;\233'T*\335\244X2\353"
+	.string	"\377,\336m^\3246\321\213\212\263j~\342Ti\362f\325\330;{\345\266\314\234B\264;\"\214t\372\237\037\316\247\030\233U\0328q]xWh\356R\263\"N\272\352\350\204\266\350\2409C\027\350S\305\215\2249s\355\226>\365\346\330\221c\270 VT\235/q]\246\232\361\315\3718c\333\254\302\3520\261f\354\331\034\227@\257N\335~7\373\306d\367*\030\245\303\262B\305\242\222\205\352-\232\352\225\t\004\314C\273\r\203f\333\206\224\367\376\270\026\352n\3115\205RWz\304\211\271m\273-Sd\342\305K\247\226\3556\352\345\306\313\224\215N\321C\273\323\251\035\023\001\022:@"
+	.string	"\256\335I\035\024+\235\266U\253Z\263\202\244S\233v6AhcN\216\200\251S?\304\355\226!\354\231\265\003\272I\262{\325\223\346v\345\312\337\235\312Z\3613\346c\214\016z{vk&\001\214\357\251`W\354\234:\265e\267\321\2543k}^l\364\027\372PY\362\304\322E}\004*\031\221\345\262S\373\374^\225\275\037~\235\332.\001\203L\250\302\3710\007\022\02523$\"\"I\222\2441R\n\020\004\203a\234\210\246\007\022\300\0245RB\207ffDD\222\224\221Bv\326\202,\254\352&#\322\002\214\300bU,\034\377\177\260z\n\024\305^<\201\267\267\256\255\337\033\320\032\256Y\316\225\300e\376+\3316\351\363\r\2311"
+	.string	"\306\375O\266\374\177\361>y\216\022-\252\004\262\273K\200\210\204\n\364\354h\262\222[\244)\3137\264\216\246\36171\026\301\224\272 \2279\272\317{\205?J,\220\340\n@p\005\016GZi\333\007\241tB^\217\002\340|\330\026\322\334\246\r\253\274\332\005\202%\261i\244(J\\\242\346\203\351\315\377\235\205::\250\311\365P\365 o\374D\202\277\n\345\376\311AJE\327A:Lh\213g\013ad\273\b\355\347=x%\316\313\002\312\342\bv\032\217\206\277\221a\254\200\332\031'\324\263,\346\321\234\330\212S  \255\374\227\3205\374\376\037\200\324<\023u\030\244\216-\t9\376\344:\254;\301b\340H\213\032/x\306{~\375Z\342\350S\346\005L\022\306\306S\253=\245I\356o\214\324\255f\024T\225r\370\r\330\214\305{\020(\272\024\316$\341\314\204;\016\252\230e\260e\255\374#\221\2427r\322\272"
+	.string	"R\020i\375\001\017\355\350\002l\231Q\220\211\274\307pof\352\206\022\2049\025\024J\352\262\331x\337z\353\347\241(\300o;\025{\232]\027\003\273\"\3224\341ltt.\366\021@/\335\330\274\250\327\313\r\275\351?SN\024\351\">Z\025=\372\022R\233\024\346`B\2206\320\303\237\006\337\236\201\2362\370Xcq:\266\016\003\245\35291\255wk\203\177\360\nQ\\@W$\027Kx6\362U\314\001\312:\313\362\022"
+	.string	""
+	.ascii	"\202r\317\244E*\333\316\002*y\004\371x=\252}8\377\325B\233\316"
+	.ascii	"\033\241\2237\034\236fE\330\316W\321\221\342\006\302H\233\242"
+	.ascii	"\222,\t\036\341\315\367Y4"
+	.string	"\020W\312@a\213\273\t\355\324\245p\247S\017\356\035\\\322\345\344*!\224w\243e\272H\273\263`\326\201\247|\347\r\365\3755\213\257\252f\002\f2\245\177R\3050\366]\306N\226$\335\316\316\224Jb\217\"\224\240\301\007\246\350\374\004s\312|\021`\326\260\303\024\315\267\265+\03195E\371.C\330'\322\214\311>\026\227\224\233\020(\f,\223.\030\275\017\0063'\271\300F\357\035\361\026\2778#\253\203\025\311\326)\241\263\360w\337\301\203 \177=>e\376VR\030\272\363Ca0\316\371\343+\357\337\210\371\225\031\022\r\251k\324\320\376\3327`^r\210\341\331:\bV\202?\221W\0372<!\224p\243*\325\210\205O\210\312\f-\347\262\210\260L\211\345+{\217*\270L\313k\352i\313\366K\350\342_9n\263\254%\312\373\004D"
+	.ascii	"\245\"mZ\261\030\b\310V%\242@)U\303\fzrA\204\315\2221K\023\253"
+	.ascii	"P\017\232K\227\331\026y\274|R.\034\272\377\2417\233$z%\235d6"
+	.ascii	"\304\026\322\017\022\3710J\340Y/&\357\236s\264K\225\323NB{\205"
+	.ascii	"\357\254\024\365(\347\206\376\030X\252\376\257\322\354~^D\255"
+	.ascii	" y\032\263\215F\203\274<\242\326\302D7\272\350\346\330\231\370"
+	.ascii	"\331\327g\306\344\206\214e\034\3253\364<\230\034C\232\350\234"
+	.ascii	"60\274\372\311\320\004\377\036\303|Y5\001\331\314\326\300,\306"
+	.ascii	"6\321\026\3605'@\230z^\224\240\342\326\224\306\333o.\214?\205"
+	.ascii	"\371y\350\220\247\\\202\203\254f\016\352\br\f\363T\261X;\214"
+	.ascii	"\277\360\255\335v\036\201\235v'\362\333 \301\370\375\f\367\247"
+	.ascii	"\346`5\026D\177\371\0315\365\300A\365\004F\242U\237\315\262\257"
+	.ascii	"q?P\310\303\365Jm\266uDs |\334\007\215\326d\215\312\342d?\002"
+	.ascii	"\023~P\337F\326\374\364\030Q.q\275\365"
+	.string	"\224\002\005s\214c\232\251 f\023QZ \3607\017=\357\363\362\213\347\202T2Z\241\322\241\256\265\320#\376\233\355\022\226\335]J\f\367\270Q\307\373\036\256<\232\304\277(\227\241_\017^\"\366M\237\302JC\213D~\257\231}\3559D\216\324Z\210\354\217\333N`\316\341a6\340\334\031lS\0068\216\006^\266`M\336\250\211\274n\233}\237\2456$d\020\007\376y\356o_\020q%&\352\367h\203\277\r\007\021\335G\312\021\366\250\037\264`\334\305\\\263\341\277\235\301\375\324+H\nf\203\362\021A+\234\311\204\377\"\036V\036!\251\202\202\207\215,\020\244&\335\234\n\217\261s\223~\325I.\322\311J\214S\245I}\034\303\020-.P\302[\032\211\247\336\t\024%\033a4\341\fVije\226\377'-\240\336f8\223\306#\342W@\301\013+\034]\204\274C\001\303/\230G\213\317,\206G\005\355"
+	.string	"\355\343\257\351\377Z&\274\023!\317\366\001\376\203\230\347\364\r\223\375\\6\313z\030a\210\227\336\350\035]y\323w\211\2455"
+	.string	"_\316\272"
+	.string	"\375U\204\217*~\305\234\002\037\270\325\367?\361\203e\226\312\354\303\377\016q\332r\035\002|a\262Q\335\005x=2\277\253;(\033\230\256?\310g\361_\3427\363\372\363\037\230]gs\317\370\206\241\001\347"
+	.ascii	"\311I\355=&\3370\031\326\263\272\212\023\035\360\307\033~\367"
+	.ascii	"gv\263~\364\366\205\314,\356\376\354|\210.\240(\237%\270:\376"
+	.ascii	"\207\210\361\340\017k\235`\226\357_D\026\344w\352~\363\3660\036"
+	.ascii	"|\272\267h\177\251\027\312?\212\336\305q\200\037K\236\337\275"
+	.ascii	"\004\256\241\377\332\256\3536:\270/\307\300\345d\326\006Z:0\317"
+	.ascii	"f\2272\003\303W\226\221\377\337\306\037\237\373\347\241]\007"
+	.ascii	"\322\267\366Y\300\243\312\302~\017\233\217\212I\366o\342M\342"
+	.ascii	"\027\205\033\262E|\364\300\271\312O\310\237\352\336^y\246Z\326"
+	.ascii	"8^~\320\016\303]\374\025\350y\217i\374\212\367\237uT\3739\037"
+	.ascii	"\361~\263\3757\275\307\207xT7\354\334\327\241+\363q\356|\325"
+	.ascii	"w\200;\336\304\206\367Q^\226fk&;'\343\032\376*\341\376\013\310"
+	.ascii	"\247\377\030\346\321\242U{\032\373|\357\201[\224\263\002\013"
+	.ascii	"\301<\261\323\320u\341I\340\227%\214\036\355B+"
+	.text
+	.section	.gnu.lto_.symtab.71f644ae67402a3c,"e",@progbits
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"checkFuncMovingSumExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"checkFuncMovingSumDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.71f644ae67402a3c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1587 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020"
+	.string	"$"
+	.text
+	.section	.gnu.lto_.icf.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`9\002E\016"
+	.string	"\324\022-\003"
+	.string	"\""
+	.string	"\360\273\225\324\017\004\002"
+	.string	"\002"
+	.string	"\002\001\002"
+	.string	"\001\346\310\255\233\n*\002\001\002\001\002\002\002\003\004\002\005\006\002\006\002\007\002\007\001\002\005\b\001\352\263\360\321\b\003\240\342\234\212\n\004\005\006\275\373\235\331\006`\t\002\n\013\002\013\f\b\200\343\367\203\001\t\342\306\306\223\006\n\016\222\210\347\325\b\002\002\r\002\016\020\240\313\230\233\t\022\017\002\005\020\021\022\023\371\332\371\215\0074\002\f\002\005\002\r\002\r\002\t\002\005\002\t\002\021\022\001\023\002\023\004\002\024\024\026\027\030\303\241\367\352\001\002\002\004\002\004\031\340\243\314\205\006\004\032\314\341\206\214\004\004\b\002\b\033\277\257\224\347\005\034\035\343\276\261\215\b\036\306\205\223\344\t"
+	.string	"\037\267\317\220\204\r\030\002\025\002\005\002\026\002\026\002\027\002\005\002\030\002\030\002\f\002\031\032\r\002\033\031\"\265\372\210\203\b\002#\200\333\377\224\002$\217\201\246\310\n\002\002\034\002\005%\204\270\217\323\002\n\002\004&\226\266\306,\002'\300\204\236\224\004\006\002\001\002\031(\201\226\352\233\017\f\002\013\002\031)\257\234\301\252\017*\240\342\234\212\n"
+	.ascii	"P\250\001.A\321\214\024&\305\205\341`\002r\210\352\006\021PI"
+	.ascii	"\343\244\005\265\307vW\243!\252f5q\347\220\305y\321Jy\204\032"
+	.ascii	"\3152\355\017\343\204D\251\327\017bo\262\003J#\271\\\224#\026"
+	.ascii	"1t\321\221[\225\304\377\025>7\302\325\256\321os\272\027\002;"
+	.ascii	"=+\025\3059\003\307\253d\235\343\241(1\234j\327\225n\201\377"
+	.ascii	"\227\031v\352O\377\243<\245\364a>\264\013\341<\205\341\341M\200"
+	.ascii	"\275\300I\013\251\232XB\256y\362\216\333\264\261s\362b\334\031"
+	.ascii	"M~.\351\352\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375 \367]\004"
+	.string	"\022\206\022\035\240'\351\377\377\377\377\003\362\377\377\377\262f\377\377\235Eb\366\205\2028b#\231l\231R~\fz{*K\333\216\335\3062V\013\r\344\025e\002q}p\316\260i\013\023v\007\265@\363\370w\"r@\241-\227=\373\0330\022\033"
+	.string	"UbA@\"\f\013z\"gV\005f\302\315@\262\016\324\202B\021\016\003\213\241\032\004za\tv^\332\200\20501\240o\022\226\266t"
+	.ascii	"B1\b6\363F\026\342T\246\275\004\267\2016"
+	.text
+	.section	.gnu.lto_.inline.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\253\003\035\021"
+	.string	"\326\326RB"
+	.string	"\223\223\306\327l\242\216\241\n\345\251\212\232R\037\305\017M\214\n\354\035\354!r\230\3609\365\377\261\037N\257A\"\310\232\321j\220U\271\277\307\200\3525\204\361b\035\005\333\317p&Y\333\b\020\273\245\224)>"
+	.string	"A"
+	.string	"?"
+	.string	"']a!\361\001O\256A\257\207\022\317\365\2442V\264\224x\365\325I\241\351\340\002{.E\234\260"
+	.ascii	"1!_"
+	.string	"\271<\241\341E\006\302\230')av\027\300\223\250\346\343\226\273\273\233\007\371\255\004;\362H\005m\265Z?rl\337@L\332\346\327\022U)P\274\240\226\030hr\007\326\370@\t\227\226\027\346\250\354\256\310\240\235$\263\244\327\001\336\223\030v\276\337I!g\240\250T\240\213\007\033<:\037\017J2\025\002\007*\264v\301\204H\357\200bi\340\306\256Iv\310\237\037S\326\330]\316\005\036u8\352\376\243\311i\fKM\216\f%)\023\003\325=\363\200\007\275G\235>f\357?\002n\356\013\377c\026\0227],yv\260uJ\272\rDN9\023\323\202F\202\r\254U\017\0023\020\26011)\f\024U*[\264\200\244+x\314\036\007\326J\207\210\313\026\023)/D#8d\004>~t\224\013K%\025f\250\001U\250\204\002\322\024\026\244\320\030\220\002\241!\262\036\022\200%A\304I$0UR\222r\n\365\034"
+	.ascii	"\260\\E?\005\376\316\215*\245\205\f\020?n\033+\025\307\324\312"
+	.ascii	"\340\013\352jA\203N\023\342\242 i\237\231\206\017\220\344q\250"
+	.ascii	"\242\260\207\223\b\341J*\320I\227\bLh\204\200D^/k\327\017(l\260"
+	.ascii	"\221P\033O\360(T\326\031\307W\330~\034\b\336$\023gQy\034\222"
+	.ascii	"\236\024\\o \203\214\342\334\213\3767\027\203>\016w\005\177\246"
+	.ascii	"d?Od\027\253\231\350\323\354\323/\221\021C$Gx\"\203\342\245\310"
+	.ascii	"\013A\013\353\367}\217\367$\333K\332\341\331\275XPq\213Vs\275"
+	.ascii	"\376ee\233\224\327\034\376F\375\304\177\316\006p\371\210\212"
+	.ascii	"\001\251\035\n\204'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`m\001\375\b"
+	.string	"B\316*,pK\222\016\374\377\271\252\001\327\266\374\036T\025\366\373\035P\203q\3747\256@\241\373\353h\371\313\276\3175\242\202b\256\tv\334M&\031Le\363\017IJ@\304\005!\271\253\246.Q\246\357\0039\2318\360\362e~\330\304mhc|\214?\326\313\351}\206\247G\351\221\257C.\220\t\t\201<(\203\252/\303\332*\217>\363\036+h\034\3466Xi\252R\333'\220\334m\261\267X\247E1>\016\033"
+	.string	"\232\364\311\3538\314eXiJ\201(\212\242\013\342\265 \322\234\201\366\nF\310\013\202\\\320\204La\2551\315^\363,`/\0021 P\"A\324\335\001[\204'\300\351\252\004Sz=\335\266U\021\262\313\340\026\013\370l\003\216\326\240E\224Wb[\220$3\273\301K\177\t\230\032\025\364\n\300\034\207da;\214\f\017\357V\\\355D\345:\243\307,\273\373f\034\035@\2742\327\365\227\367\263\260no\203"
+	.ascii	"\212\245mC\217\030\300\226\364\352\006\242\335\205\371\334\233"
+	.ascii	"\326\216\247\023\233\324\256\033"
+	.text
+	.section	.gnu.lto_.pureconst.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375 A\355\001"
+	.string	"\022D\016\030\220+\035\377\227(\313\354\314\314\314\312~"
+	.string	"m\311\277\336\304*i\227Kv\2374\243\t\335g:S\315d\276\345J\271\311E\3561\215[|\303\024fp\201\273\256\021f6\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\037\002\005\013"
+	.string	"\322\317,,\200I\313\001\030\004\212\242\210P\363P\006\222BF\t\234\004\002\376\2017\2625#\351>1\2100\214\301\006\250\354\255\263\213%i;\311\024~*,:\0179\221-P\214QA\247\023t\342i\375E-\b\222Kb\027\261\203\330\241\265\207\235\303.\263\033=G;\321S\364\343`\212N8k`\245R\240\216@\315\224\306$\030\214I\027\033\027\351\272\274\354B\317\020\310\343"
+	.ascii	"m@\035e\224\317\223\326\253\200\216\322y\236\236\335\344\331"
+	.ascii	"\001P\253A\264RM\316n\363\334\354\241\243\236\224\323\274\326"
+	.ascii	"\256\341\311\260\263\354\230Ue\331\222%\2353\363f^\306\214\b"
+	.ascii	"\321) M\250q9d4\022\206AQ\322\032@\002B\0303\363\021\0201T\026"
+	.ascii	"\r\211\n\355\006%\004}\031\003(\177\214\020\201\240K\223E\211"
+	.ascii	"weM\370\231\304\357z\312V\374\"h\324\005\221\302\022l\016\337"
+	.ascii	"Q\377%*\226\273'\252\222f&\032x\303\225\324\240\332\023+\245"
+	.ascii	"\023\323\352\221\375j\b\312)\352\226\263?\f\324\002v \033=\225"
+	.ascii	"\f\314\0353>Z\321$\357\246\270\202\253\3455\233\202\363\022\344"
+	.ascii	"\347/1\225\327U)s\t\227\3510\030[\332\341W\350\022\323\226\244"
+	.ascii	"~F\353c\257\366\324\240\250\233z\021\321\032\033\334\301\377"
+	.ascii	"\031\020\r\370"
+	.text
+	.section	.gnu.lto_.lto.303b4bd02665f98,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.30.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"e\t"
+	.string	"\226\321A<0\345(\035\200\3238\204\201V6\034\350"
+	.string	"\252\220\210;\\\320\211\263\217\300\370\301.\263\026\273CE\226ED\362\006\2140=X +\362\200\215\031Sxu\216\361\031F#\334\226\354\224\002-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\234\013h\237\026m\232\217\254\275kdC\005\266\2734\003\271x)\3727y"
+	.string	"*e\272\334\026v\327\022\225R\335\331m#\330n\260\r \3667\273\273\316V\366[\277\234\233\n\246 f\227#\026`_\323E\244c\373\322>\311K\304\267J\367\354\256fZv\307\004+p>=~@\013\233\315Vv\350x\2352\r?\3456\305YV\fX'\320\354\360\256\n\203l\213\243\\\030t\202\221!eB>\375\222\366\271y\274\300jN2f\217&\231}\004\341\310\253\020\022\034\311{\210\370\030D\"\260z\314}>\320#\205j'\3528.D\303\n\206_\027\322\317\013\215(WC\372908\321UJ\002\301J;\343>\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.31.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"e\b"
+	.string	"\342\31788Po\322\001\240$N(\273#\210\021\261\206t2\346]\312\306\020P\026\2434+\221\217\362\310\221e\021->\013\204TTQ\021\261\025\370\031\245\227[M\204Y\333v\357\224\002\276:\031\375\204\254\212-`\327eM\255R-\303\264\231},\320\274\2526;\004\246\fX\235!J\353\254>\356\245sN\027(.\216\374\221\337\263\302MN%\234\013h\356\031t\023\265\347\236\033.\242\331s\351\177\017q\360;.\375"
+	.string	"\001\337]\006<Bsy\357\006\030))\027\016\306\330\337\bF\r\373\231\215\031vfc\2412\300\262K\021\003\263(\211\342a\373>\310=\321?\234\260R]\332\"\273\272|\345\315n\371\307\2617\235L\220\244vw\306\215o\207\233\377\322\001:\222\304\341\006aw\r;R\305\035o\273\300\366\201\355\227\017"
+	.string	"2\003\302\360\305\302>\231\020"
+	.ascii	"\021P\034U\311\036\bx\273&v\207\310@\005t*\350\313\025\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_accResetFlightDynamicsTrims.33.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"e\t"
+	.string	"\226\220=9@o\323\001Xp1\003\246\t\254U\210\302\007e$\202\255?v\264\344\303\357T\006\300\t\">eh\024u;\264;q\\\235X\35110\021f\221<qA\261\331\376\266S\n*"
+	.string	"."
+	.string	"."
+	.string	"\237\307\f\332\250\217\242=\351\305\302D\265\273\324\3428x\t\372\037="
+	.string	"\024\252\270\274\024v\327\022\024\302\270\255\3336\260\215`\177!\027\177\220q\002I\205re\217\037im\330\317\254\245a\317\253\005\206\240\264{\261\212Y\323d\361\260}_\344\242\347!fHa\237\266\307\306\002!\324K~\321\rG)\235\\\037'\325\253\346\2429'\325\001\321\020'\371\004D\273\233\360\351\217\037\211\360;>-1!\017\372\314\234B\363\031\3266]\345:\231\2679l\232\226\321\317\253_\267}\264\3432\016\325\274\217n\n\\\0376\217vj\365(6\206\037\035\240\344b\n\255\017\367\025\225\224\025"
+	.ascii	"2\003\302p\331\302\326M8 \033\300\0358\230\327\336\006f\220\200"
+	.ascii	"\023p\334\257\222 \001{\2039\240kxw\b\007T\024\247\"_\356\005"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.34.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\335\b"
+	.string	"\266\320>;0\3456\035"
+	.string	"\360y\354\017=\035\0204\256\t$H\346[\301\323rZ\016\324\326\373\032&\203Z\217\345\004\bJ\013\211@DD\004\330nd0\032\207E\"\372\304\031\252\264\311\336)\005+"
+	.string	"-"
+	.string	"0"
+	.string	"\005\326\251C{\345\243\307\236D%\303\004\265\273uv<\274\f\375\223.\340\001a\\\006D\354\256\245\007\244q\317\333V\260\ra\033%3d\177\364K\252)\241Z\020Xv?\251"
+	.string	"\233BO@0\266/\355\213\\\024~\3049\301n\b@iwl\260\303u\352\361\007\326\351\365\245\227\2238;\036\370\202eW\274\304\302\017\247\006&\227\315%j\374\221\213\2154}\370\034\353\224\341\023\262!:\2112e\217\03599\354W\273\273\016Z\306a\340\307m\227\263\f\327m \346i\022Z\226a\365\363\272\217\323\276\312m\330D\315\274\257f\022\334Qh^\005\273\316\253\230Q|\2653\344\212\024\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.38.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375 \235\205\004"
+	.string	"$\ba"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\303\377\261\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\354\007us\350\374\006uq"
+	.string	"\005\001\006'\001\016\243 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_accDetect.45.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\247\003m\032"
+	.string	"V\260\251H\260XQ:\360\"\034l=A\006\351\311\222\3307)\205\032U^\206\336'j*y\303\\R\304}\267\020\3645\355c\2757cT\0138\215\232\377\217c\276p\370\243u\251\\\032'`\326e\312L\332\376O\b![\356\224\002\231"
+	.string	"\212"
+	.string	"\221"
+	.ascii	"BH\232j\335I0\005\362\241w7 >$O@|X\301B\216u\276\033\372\271"
+	.ascii	"n\310vT\246\326\235k{x\247\316Y+\0259\212!\335\251\343\327\316"
+	.ascii	"\372N\320W\364\201\022\232\243C\341l\320\003Ev\222\234\b.h\252"
+	.ascii	"V\006\220\247\213oH\214\223Dp@s\244\313\353\375\016\205\253A"
+	.ascii	"1,)\362a\233\"9\343!\200\\\013\252\240\326\372\336\247O\316\305"
+	.ascii	"\244\324\300\017\220\333*\327C!\004\245\220Y\345Z\314]\345b|"
+	.ascii	"\2166"
+	.string	"\265V\317[\016\306\335\272\355$\333!\354e\021\2761O.f\032\337\311\337{\206_5\023\254M4\264\326Zwu\366\2566/@e\371\341\025\262o\364\0078\357\257iy\232<\322=\236w\213\236\016=M=\275\323'p\034Oe\304@`\252\365g\352L}\n\235\202\034\351\267\357\037\275g\226m$\032Y\303\221KG?\202\265\356\"<t\207#y\316\235\030\370\006E\301Z\353\203\207\326@>\334\235I\316y4\253j\335\001\306\002\371P\001\235\323\276\222/\311\271\021\213\017\2505\273s\351\322(6 \245\213\273+\206\261Q\371i\342\270s\337;\305\022\205\311\346\3043\247,\256\356\311m\363/\021\257w%\274\216\370-\233|\351\231R\026g\200\265S\254\230\277}S\320\020b&\330\2635\337\367\002?!\037\222\n6\321\325\371\275\253\242\202\214\310+\335t\326\254\270>\366\024\003\033x\021\360\246K1p\267"
+	.ascii	"\255ZK\006&8C\236&*\371P\f$O\023\037\222\036*\221\025%E\007:"
+	.ascii	"\030\312q\243\326\332s\3306p\336j\025w\006,Z\211\023+\303\330"
+	.ascii	"\f\204\354C\254|\255\030Q\2768\300`/\001*b#\326\260"
+	.string	"\t72\0228\2572V\"\006\203\275\\\263R6\273\211\315\\7$^&\\\260r\346\232\260\300\262\023\261\322\205#\223\225.\326\256\022\235\2566Dy\3511\251^\345$\271\266\331Y\036\226j\3322\024\363\267\320\206gk\f\240\350hZ\215\377\335T\034\267\265>\255E\300c\252IT\317\224\"R\255\316w\344FR\335\035\233\204C\310\n\371{\301\243\313W\013\030\236o4Rc)\374\357\347Bc\211\336\351\343\372T9]\021\001G\250Q$\244\024C\212\020'\230\t\213\002Q\213\001`\002\231:3\017\021\200\315T3\3122\007\213\252@\3779\004\247d\t\374#\3711}\366\026\326\311\273\2152\305~\247k]\362\233L\246\005\232\276\234\364E\177y\371\367\210w\364v\034R\331\f7\266cC\210\016Z\210\237\312n<)2\370\020\214gV\242Vr\303\362\333\0201ry\321\204\035\021-\322o\300\207\211;\274"
+	.ascii	"\276\301\314\260\320\370t\271@\303\227\201\353rf\351\331\034"
+	.ascii	"ii\377\001e\201Ma\352\215\233~\345\371\253`\\\373\300\261\251"
+	.ascii	"t\233\340\007"
+	.text
+	.section	.gnu.lto_accInit.46.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\013\004e\031"
+	.string	"\226\355\241E\240\\Qc<i\364g\363\375\240Bc\277\324\007\265j\343\365\315\350\202\277:\032'\211>_\373K\254\"\005\276Z\256z\031\033\236b\026\307K\214\247\037\360"
+	.string	"e:r\224P\335_NJ\322\265\334m\313-eJ\001\207"
+	.string	"\204"
+	.string	"\231"
+	.ascii	"\016\303\351I\247_\340N<\256\336`\220\272\027F\226\235KU\257"
+	.ascii	",\331.\262I\333s\332W\362%E\007\242\260\353^\037F\252\334\033"
+	.ascii	"\\\340\006\343\253\201\373\210\257\341\003\210\257\266\355\340"
+	.ascii	"A\221\355\203J0.\344\212E\324\325\275\301\031\rb\247\275XC:\255"
+	.ascii	"\377\372\361.\2164^\311\237\212\027\277\0253D:\r\023\350\360"
+	.ascii	"\202$\373\031\205>b~\260\371\323\347\321\3177g+\302\275\327\263"
+	.ascii	"\374\311\270[\267\035\3026\005;\334\020T\276OI\301\301\007\315"
+	.ascii	"\275\367D|\023\035.\305\203\314\376\360(@0\245{/\204W(\223\312"
+	.ascii	"\321\215\336\3142\200i\323jT\300\f,*\037\34596\037\343\356\""
+	.ascii	"*\370\203o\"$S\272\267\307\344PA>\221W\337\204\346\313W_\210"
+	.ascii	"(7_\372O\347\260\203\007V\325\n\312\263\203\276I\223\354S_\025"
+	.ascii	"\320\205)\020\373\300\237\200\247y<\035\3634\2545M\326\351\227"
+	.ascii	"8\355\252\323c\235n\211\323b\235\256\236\001Uv\251\307\r\220"
+	.ascii	"\254\315H]l\324|\3158R2\316\023\247\373\252\200-\350-\223\330"
+	.ascii	"\242 \240\322\030M:I?S\346fl\020\013\261C\206\210\257-Z\247\234"
+	.ascii	"\210EN\306.\215\021\023\247\264\252T\244gq\347\310\303X\246/"
+	.ascii	"\007c\233\306{\257Eb\235l\022\361\265R\262)\n+\244\266]\362."
+	.ascii	"\226\313\026:UZ\331>]\213\204\361^#\b\376\324\263L\240\360\363"
+	.ascii	"#\276\2064\206\224\345\004\364\261\234\250\200@\251\204\205["
+	.ascii	"\271PE*\214\0320\355\f\032\346\313I\021`\251\023C4\022:\033\t"
+	.ascii	"\\\205 \334mH\004\021MCNg\"\250\3075\006\270\334m\004Mg\033\262"
+	.ascii	"\325j\264\331N\227\333\341l\273\031\356F#\232\325t\273\031\203"
+	.ascii	"\003\316\211\260\351f#r9\335\214\f\366\036V\036\372\247\377\254"
+	.ascii	"\301\361D*<\326c\364\310v\214:B\217\372\304\007\223@\rkc\276"
+	.ascii	"\344\241!\345\315{/\257\322$[\021FA@\251q0I\372\340\257l\216"
+	.ascii	"\330\034\240\002rlw\330\036\363%\214\032PAy~Q\222~\352\307\341"
+	.ascii	"X&\253\027\2155Q\t]\001L\250a<\003\225C(\240\200$\240\260\300"
+	.ascii	"\264r\360\"\t\306\212\007\021\020\261e\344J\2018sap\273\326\020"
+	.ascii	"8\274\357\272o\227\260OR\207\211\t\370\006#L\035\030\260:\341"
+	.ascii	"\242\244\005\002fh\256W\214#\327T\022\250\236v\252\345\201\362"
+	.ascii	"\320\332\024\311\325p\"C\016\020\315\216\344\263\226,\327\377"
+	.ascii	"\275\355d\237\f\032wf\337\312\034q\371\224\375\260\272j\256\020"
+	.ascii	"\025\255N\224\027\307\305V\270u\334\342]k\\\267\004\004Y\037"
+	.ascii	"\345s\303\035^\214\246dD?\3667=\353J\321\320\255\263\342\013"
+	.ascii	"?\b\234\362\300?"
+	.text
+	.section	.gnu.lto_accSetCalibrationCycles.47.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"}\b"
+	.string	"\266P=7@s\322\001\030\254\025\235\320\220\237{\257P\215y\312\024\245DqR\323%B\333\220\265\331o\214\rm\321\331\337\036\266i \2115\263%\025\026=\251\242\377\311&{\247\024+"
+	.string	"-"
+	.string	"-"
+	.string	"\004\327\2439\233\346\235\310\276\305E\203\305fw%\f9\367\307\371O\271@\3114\372\003`\330]\277\222\211\343\206\267\235`\333\301\266I\366S\377\263\f<d\"jv7V7\253\2121$\266\317\261\375\236\375\223\243pO\211\034wA^`v;\005/\004<\016\274\340z|\017\234no-<\031\342CE\202\031~\320W\371\212\310\0371F\350\275\364\350\207\256\307\210\232)\351 \275\225\335\215\036D\331\267vw\rO\001\023\264f\027\026\364a\243\236\031j\220\310<\330<\360\354|\264\f\204U\352\241sbr\253\332\366\241\233\374d\030\205\234u\223\035\004k\025\264J\220\246U\031\b"
+	.ascii	"\005\006\312\204\366\275\300\305\205\022\227\241\211\325hp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.48.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"b\31504`m\322\001@_\002\f*d"
+	.string	"\207\330\023g\272\377\265{\327\236\266\005tk\350\330\201fw\343\270\016\366\346\002"
+	.string	"\026\310p\263\375\207;D\017\272\021\"eJ\001v\225\nZ.T|\013\3179\252Y\021Z\325\263Ze\241\030\232\213V\253\020\0306\274\330.\020\306F\311\366\032R\035\340h\307>frU\275G\324\271\30670\276\205\0352y\354\223\237\231|\272\006@prdg\233T\t\373\322j\310vZ3}I"
+	.string	"CD\241c\3673*\331\220Ita[cS|\200\240\361\365\214\342\363\n\017\017\007\311n\326t\342\327\363\362\237qi\344\003\004\003m\236"
+	.string	"\t\273\353\304@\017\267\336v\201m\003\333\021\001\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.51.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\002\007\005'"
+	.string	"\272D\344\016C\200\234J:;\310\275\322a@\033\004)\222\256HC\003\026lt\017*\f\305\277v"
+	.string	"p\341A\214\024\3554\034F\022\377\355\021n\022S\b\306\n\241\230MF\317yJ\213\021\362\224\364\r5\3226!R\246\024\326"
+	.string	"\306"
+	.string	"\351"
+	.ascii	"\\\336\005x/f#\257\272H\264/}\360\224e\331\340\243/\220\037\017"
+	.ascii	"\210?\2321\264\374l\306\205\236igf\330\307\362,4.\364~\221\351"
+	.ascii	"}\264i\330\275\217\333\263}\265_\345V\200\277RC\251\250\3242"
+	.ascii	"\273!\246,"
+	.string	"\205M\216@~\264\360H\363#\371\243\371\321@\333\316\205b\345N\311\034\327\331\\Y\226N\213\304{QxO\005\236G\356\346(\256\002\375\262'\200\033\006\275\256\316C@\204G\220\223\242\004\033sB\356\246+\210\030T\307\005\347eG\340\244\013\210\356\304\242\262,\207\274\270D\b\212\303+K'P\223\257\217?.\212L`j|\fy\331\020\221\332\024\251\323\363\322\322\375\2273\271\311\tz}]w\025\312\262\264\006\275x\334@\267\r\305\366\223=\353\002kX:\324\321\r6\234\r\212H\254,K\n\376\230\2239\341\217}4\214\250\250\371q,\243EJ\334\261\320\314\334\020\367H\327}\263\300\nY24\233\243\245u\366\325.\306\347\217Y*\205>\230b~,\260O\373\202\037rt@\260t\270eY^\355\036\261\205Y\372\227eYz\215\330=5\023\203_\371\023\364\324\005\356\345^\352\251\225z\352$\236Z"
+	.string	"\220\032\251\247\016"
+	.string	"\244>\232j"
+	.ascii	"Sm4\325E<5\321T\017M\265\320T\007\361\324=R\r4\325\274\251&\247"
+	.ascii	"zG\252\347T\217;\265\270S\357N\255S\375\246\001k\332\234P+\313"
+	.ascii	"\035\303>%\233qm\311\275|T\037\355i1\016\306\3136\234\273\320"
+	.ascii	"\377\342\017Z!?}\202\226'\247F\266\326\333:\272\025\274\355\255"
+	.ascii	"\330\306\365\207\017\320\022H\262]\344\362vw\2665%K\207f\233"
+	.ascii	"\273%wl\323\003E\346\331-O.\f\335\332R\334\016.\244o2\355\313"
+	.ascii	"nd\026\326F\317\233;L\373\263+\331\222!`Vv{\304<\270\221\301"
+	.ascii	".\2346\370\322\342h\372\322^\316\fNK\353.N\007_Z\006{!nr\266"
+	.ascii	"\300\262\236f\235'\003o"
+	.string	"\031NG\003\tW\305\201\200\330\330o~\\ \026w9\177\373u\370\240\017~\230\037\347\356\302\300\220\001Q\263\255\n\340X\r\351\355\215\210!17\2730\264\271\271q\331@\t\211\271\005\363\210;\356\267\326\354\352\212`YmV3`\020W#\"\351\255,\313\th\236f\004\t\023&\346\307]\003I\326\276\272\232\266\205\347\f\024i\346\273a[\310\002VS2\242D\253\026SU!T\370^Ly@Ae\201\005\213_\225\221}\017\250~S/\242\252\244XH\371|QNVU?+*)+'\252\251\250\026N\276*+\247\007\t\374s!U\345\364\342\367\253r\352\t\261\376r\215\270\204\033\033\254\315\262\322\006\331\341\360\276\231\264J{\375J\332\361\313\f\031o\201\332\300'@(\372\240_v2\016\033\023:<Y{e\355z\024\355\301\203\214\303Z\232d\272\343\311\023\236\305@*\252\003h\305\023>Zs"
+	.string	"\247"
+	.string	"\313\374\261\032\363\343\263\\\247\344\210\003\253\022'`qhPl\013\346AZ\001{\256?\001\366h\221v\267g\213\211\005\275\341;\232}A\2710\374\354M\267\002\354\321\346\\\001\260G\273\333c\264"
+	.string	"\212\326H\261TK\263\364c\021\035Q\223\226\303\241%\332s\241\035\212\013\200\212\250a4\307\030ShFH\222\024\024$\255\001\220\002\221\2512\036\021\200\261#\247H\013T\231\266\003cK\315\363\0034%\246[V\350P7\266\267\233\220\304i\001NB\032\202\022\356\270\226\342\352Q?\266%\f\243\321S\320\254\300\357\254\034k\3728\347[\007\223\245\255\3252\365\206\330\372\346\201 \337"
+	.string	"L"
+	.ascii	"\221\2006\"\204\324\254\304\205\234\314b\206CQ\323\tO\r%$\304"
+	.ascii	"\371\004\310\355z*s\310\302\270\f'\fj\247\004E\024\201X\237C"
+	.ascii	"\234{\226\035A\303&\"\304i\003\234\301\247\006s\331\222Br\311"
+	.ascii	"}\361 6\fp\027v\343\262\005\005B\205\346_\335\330\207\263\212"
+	.ascii	"\243\244\r\366\327\230\374p\261\207\214h\375\363A8n\240\364\200"
+	.ascii	"\303\\\205\341\371\001\376\177\233\330\213@\362;\2446b\003\231"
+	.ascii	"\260\204\024KSW\355\212##\323B\377\004\325y\301?J\b\227I\226"
+	.ascii	"\346\370\314\327\361,\272\243\335\005H\202!'\221G\273\206t0\343"
+	.ascii	"ln\365\005\203\271\210\317\027\367\323\220\317\004\027'\034i"
+	.ascii	"~\247\353\177"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.52.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\203\f-:"
+	.ascii	"\252]\330\024D@bR\007\337*\226\324j\304\337\213\020\316\0340"
+	.ascii	"\0064\241\334[\334.\342!/y\307\360\032\221\270\221LJ\367\240"
+	.ascii	"\204m*\374\200\001\246|\031\270\351\020\313B\336\3363\245\\\277"
+	.ascii	"\355\303(\255\221\275\367\336R\246\024+\0011\001?\001C\241v\341"
+	.ascii	"\253=\216\265\303\261\3667\326\356\306\332\333X\373\206\265\353"
+	.ascii	"W\373[\275\235&\177uP\340\315\263\330 \340\234\347V\231\374\334"
+	.ascii	"\273\272\325[\267\356T\177:\271\307\"\377\234\333)\201Qg\262"
+	.ascii	"\017|\324i\202w\275*~W\251}+\0377\343\251n4\235B\247\363<\023"
+	.ascii	"\337u\237\341N|W\023\335\375\265\373O\337M\3767\032E?3\330\025"
+	.ascii	"\037`\346\231\272\300\243\342w\235\372C\357\273\361\007\275\357"
+	.ascii	"\272\354>\347\251\321\031V\"\r\303\3627\3173\324>\342\373[\352"
+	.ascii	"{\254\345\3671\026\211Ca\f\277\356\261\335Z\366\207\247\204N"
+	.ascii	"\262\257\367\201\276\261E\320\027\006\317\353\215A\333!\261%"
+	.ascii	"\316 \272\bO\235\225\231=q\351\254\f\310\017\333\0075\376\314"
+	.ascii	"^o\fH[\324\023\326\346\207\026\266?>\332\006t5t\fO\245\225=\037"
+	.ascii	"\356\361o\030]S\273\277|\376Qo\314\254U\232\347\371\341~\351"
+	.ascii	"\311\230\020\335\352\370\335\"\200\236\321\341C\006\326\016\255"
+	.ascii	")\"\347\341^\337 cj\rO\315\363\354\332IV\366\376\363\356\277"
+	.ascii	"\344\356\027\334\213\307S\340\256\300\001\323zZx\373\325\351"
+	.ascii	"\273c\365s\220/w\345\203w\024\017k\366\335q\220IW8WG\321\177"
+	.ascii	"\323\301]\320h\3712\274\033\344\313I\271kx\353\325\236l\326a"
+	.ascii	"B\224\306\373\356\273\243\232V\351\233\273\331\350}\232\317S"
+	.ascii	"\243\337\355\336w\335l\273\317\230Y\360d\306\264\333\230\266"
+	.ascii	"'\255\356}\207$z1o\027\302_x\320\357\364`\347\364[\352A\005_"
+	.ascii	"EB\210\316\363,\301\035\304\207\t\021\317\363,\005F\006\026\203"
+	.ascii	"\353\032\213\367\335\275!\250U\337\313\177a!\202\004\211\367"
+	.ascii	"]\275\211wm\262\216WC\254\311\336h\356\340\223\357\357\022W\336"
+	.ascii	"\200i=\356\257\345\267$\375\327<KK\277S\353}\3677\205)C\240n"
+	.ascii	"\317\245\036t\2472\365F\233\347\371\313\267\021w\252\177\373"
+	.ascii	"\217\372\271\367\247X\273SQ{\201W{SQ;\223P\373\222P\273R\254"
+	.ascii	"=I\250\235\200P;R\254\375\b\326>@\250]\200P\273\021Q{\321\253"
+	.ascii	"\235\350\325\036 \326>\024k\027\212\265\007\305\332\001\304\332"
+	.ascii	"\201`\355?\257\366#\254\335G\250\3358\324^\034j'\016\265\007"
+	.ascii	"s\201\331\267\240\315d\211^K\022\264\215\326@)\200\255\026\325"
+	.ascii	"i\310X\243\001\330F+`\266\n\264\213 \235\256\372l\004VR4P\017"
+	.ascii	"A\306Z\b\320\216\240V\r\362\263a+\240\364\211@\023_V\362\272"
+	.ascii	"\313Ld'\372\235\356\002M^\266\017l\177\371?\241\240`\213\002"
+	.ascii	"\235b\227[\257k\035z\307\226,Ef\323\357\224\331\322\360\264a"
+	.ascii	"\215\260bY\206\237|\217[\251\311\216\373\341\376@\332\235\354"
+	.ascii	"\363\205\033\315\211H`\252\355\"9&\370\247}\303\237\266N\373"
+	.ascii	"6\336hO\233j\177\024>\272&\224\211|s \235\256\032G\210\030L\t"
+	.ascii	"\254\244\005Q\254\276\341\263a+V\372\254sw\335d\303\353\210\256"
+	.ascii	"ar\025\241\250n\302V:\177\177\306\rVu\214j\346;\375\212\333\270"
+	.ascii	"\277\231\206\270\207\273\be\352/\257s\222\245z\226\253 ]\005"
+	.ascii	"\177Pv\223\341\250\250\336w\211\333I\255*\334\303\255\371\232"
+	.ascii	"}\200U\361\036\341\336\3269Y\275\341\004\377\344\263UCy\376\317"
+	.ascii	"B\214\013\372\235\027\336wa\036|\177\330_\322\341\331x\237\313"
+	.ascii	"\307\373\317\356\304\373\351\376\200\225O\272\335\215\346\377"
+	.ascii	"?\317\363|\334F\274(^[0\222\255\227\212-\345\207\023Y-\2668\230"
+	.ascii	"\340\242J\221\242K\t\344Y\f\270\272\266Z$\225Z)\264\262\262\222"
+	.ascii	"P^\312./.-/(\256\255\244\n\250,\245\027\024\003&\357Z\241\245"
+	.ascii	"\204j\321\325\245\204\"R\227\277\215\370\b\266\274\345f\372D"
+	.ascii	"iwY\210LD\277\323\037\356\343=;c\331>\346\376r\315\346?\316\255"
+	.ascii	"\264u/\306.\215\336\217\363\fZ\017\351R\037\347\032\364\232+"
+	.ascii	"\367\217{M\005\007\026:\305:m5i\3208\375\nl\247\375a\202M\233"
+	.ascii	"i\027\330n`\263\tS\017\026\321g\222\023d4mF>\"U\246iOP{[\332"
+	.ascii	"L\333\rT\332Kc\360\224\262I\333N\f\201\235\264\345\2216\201j"
+	.ascii	"\030\244-t3'\255\036\355:d\322\027\fXH\002\366\321n\321\204\t"
+	.ascii	"v\031\260\221\324\236\016\214\266\200\355\3325\251h\251\212\263"
+	.ascii	"\030\355\r\3235\250\333\034\221\016K\033V\214[[\324\310"
+	.string	"\343\213v\t95\231\255h\357\036r\331\"\321\216\033\034\374\344\033`\023\355\327p\0016|7(}>qh\273M\371\2544\025\344\317]\245W\025\242mC;\352NP*\264\247 \rD\265\024wOCA\376\\T?\271\242p\325N\204vT\201\f\250q(\311\230SjF$HAR\220\2441a\005\304\020iU\345\001\021\020\255c\214\021\215(u\206\315\203\240\213\322)\016\264\276Vyh\246\031;\275\236`\334\3542h1\326\367\021y2)\302\260\333cZ~$\312\371T,\256\303\031I\262\210\035ft\352\377\352\003k8\363\255\346]3-r\363O\303\240\312\201]\220\225K\3529}qW\021n\006\3360\264Z\f\b\304\377\223&\271\204\220\355\037\"\031\"\307\177\200\312\247M\020\036\217g\360\374\324\017\326\026\206\3732\314\250\357Oy\313\254\335\263\f\352\007\213Zo6~\020P\273\004\274\337\347ap"
+	.string	"s&#\350+Y@\300lwyr\334\0061\301\274~\371\2436\210'2\213SB^\024U#\202V\276\307\370~n\037\345\024i\364\237\025\376\021\330EM)\352\271\357\211y\b\004\246\311F\203(\201}A\230\022\250\203\311\275i\353>\311O^d\351C\304\241\026QS\310\205.\254\210\261\001\017\270\0063\355\241_\344\034\032\246\250\237\277%\356\031\336\242T\264\340a\340\265\211T\225\005\013\357!\315b\344\304\022\235\203\363f\203\330q\313\022\002Z\236J]J\273+\220\241:'\343\225\2717\367\273bq\361\211\307\004\354\006\003\313AXg|\210OI\023F\366U\364\031\2356\202M\024\\SQr\335\2246\264\350\260\347\235\016\022N\276\031=\346\227Hl\227\023\246\25340\256(\363"
+	.string	"\223\347\304"
+	.ascii	"\227e\017|\030p\363R\231\326\305\244j\210\372i\313]\217\304i"
+	.ascii	"\374\003\275\226{M@'\337c$\246\377\344\376<\272\016 \217y9\325"
+	.ascii	"\260\005\260\212\241\2071\0233\033\203\214\004j\262\261\246Q"
+	.ascii	"\366\242\245$\2635{\025*y(\023\327\253\351\201\354\320\226\375"
+	.ascii	"\020\322o\206\177\313q\352\020\032\251\203\306\250\031\343%R"
+	.ascii	"\361R\224I\242\r$}b\203\235\0032&\037\303w\252\372)$\255\006"
+	.text
+	.section	.gnu.lto_accUpdate.54.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`*\001\275\r"
+	.string	"\306\231]D\020q\233\016<\243|\276\021\225\"\020\032v\231\3201\264\311\t(\317\017\013T\0378\200\233\344C\377\377\327\246\007\355\267\232&\371\251\366\324\256\201\006\"d\255\031\017\007\230\020\244\240\020\3127\372\370\377\326\366\226)\005H"
+	.string	"G"
+	.string	"L"
+	.string	"V\201\207\\\267\344\005\\\267\374\3318\036\246\354a\250\230\\T\273\213E\022\337\367\311\3572\352\347\177\234D\227\031\223Gy\340d\206\311\346D\222!4D\334x\313\225\303\251\244\212\031\331]+x\362p[\267\355\3006\211}0\377\212\352\303\006G\024\373,?\346\251?J\265F\3655_\255J\007\206\034\273\035V<\366\305\222a\302\3667\2665\374\312w\226\f\007\331E\351\301 s\313a\346j\037\305Q\337S\032\254\331\rq\"\306n\210\300\t2\017\242\335\335\350\013\227F\b-6J\272\303\034}\212\277\220\300I\331\035\035t\321\021h\0215*"
+	.string	"Q\212\"\333\333YP\030`\177\276\242\003Pcw\027\270\\\205\005_\345\226\275\220\036\f]\267\036K\240^NP\251\221\256\354\220\244q\204\035\336g\233%\0232\320F\022\201k\340\361t\023\304{\240}\266\022\020\247\315\031\3128\316D\270n\003u\246\346\321\262\254\203y\263\3638\315\303\270\255\363\301\262\351a\"\006\334U\320&\006\352\272\211m\302\221\351#\243H2\311"
+	.string	"\212\211v'\323\203\2261\031"
+	.ascii	"2\003\303\341\327X\270jI\317\024&\324\2550\317c!b\232\030 8`"
+	.ascii	"\b[\341z\271\304\306j\343\r\256\033\373\3215\240\030F\003\341"
+	.ascii	"75\005\356\005SS\202;\322\322\036\rL\355\001"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.55.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\373\002=\027"
+	.string	"\246\355\230E\300\330*\035\300E\255\236\207g\016\316\034\273*\310x\331I\365$\350\330\322\253\255\375~\236\036\242\274\314i\377\357/\240\271\274\216\034\367\377\007A\020\004Q\024\230\b\250\230\263\330b\227\311T\013>\304\222F\310\226;\245\206"
+	.string	"|"
+	.string	"\204"
+	.string	">\215\327h]\307;\027\355\326\354"
+	.string	"\331\035\037X\202x\320\343G\341A\361\003\302\203\023(\264\354\372\2303\361\233+\263^\225\335\261\244/\254\237\343=]\352\372'\004\247\212\322\345\327^\377\244x\370y\321}\352\330zL\232\360\250\24588\005\354n\200\332\210\031aw\317\273\234\251\305\344t\301\241\271\2124\027\247\201\033\022\232"
+	.ascii	"5\331d\260\244\005\224\353\216 \306\t\233\224\237\227\335\265"
+	.ascii	"\244\325P\334\240\333^a\033\203\255\241\026\022\036\274^w\371"
+	.ascii	"C\327s\253a\203\311\237=\276\244\342\354\277\210\025\035)\326"
+	.ascii	"\032{t\235_d\351\320{\267\313w7hJ\213R\372\003J\207\24048\245"
+	.ascii	"\247\245uJK\225>\201\363\234\334X\334`\321&\343\232\370eY% \317"
+	.ascii	"\315{\377\356\322>\216\271:v\266 \341\204F\316G\237g\337\306"
+	.ascii	"o\264\276\363\020\361uB\344\341\333\322\263\273\244\203\276 "
+	.ascii	"\036<0\245\335\262C\266\245t2~Td\267\230OA\020\373\032\344x>"
+	.ascii	"\303\306\313\251\"\252\017\204\203}\013r\273{\033\337;ZhQ`*U"
+	.ascii	"4\022\252H?z\231\214y\037\tA\r"
+	.string	"\365\262\0301\3713HA\235\275\331\226\353\324\002Zd=0\371\203\371\017\373\304\335\255\340\367\270\217\030\337\346\240U\035:\350y\2378\263\237\025\036\230\374\251\356\356K\025\347\377\273\273\242\326\230\364k\206]\022\021\362\212}\035\337\341!\276\215Y\026\"O;\350\007\254T\b\323Di0\255P ,\300|\210\371p:\231\006\370\004AF\225\362`Z\241`P\247\223\251\304Z\251X2(VI&e\212)\235V\254\022\204\004Vq@\255J\036T\252U\311\343~\206*f\301\231\311\341\003\177W\030rH\375\002\323\330\007\307A9\234\0223\237$\335\005\200\024\251\235\332 OS\235\372\272C\305\021\271\356\240\n[/g\312A\3059\004CG\n\302\020I\007\351\314\203\203T\272\330=\021!\257\334\343\353s\332\301A:\322\0076 `\002\2312\243\0336F`\262\204\211\316mU\214i\"\251\004.n\031\335\215\016i"
+	.ascii	"\023\226\262\221\242\201\353\335\252\234?\303\367n\333\225\250"
+	.ascii	"\273u\366\332\331U\013{\355\273\330\003\342\201\020\216H\211"
+	.ascii	"\315A\323\233\035K\030{\001{\230\336q\355\004za\251.\274\260"
+	.ascii	"*\3457$\2636\013\201d\267\301\300\024\261\321\"\264\207\376\347"
+	.ascii	"\265K7\002s\017\314\214\033\332\214A\200\246\236\303^C\3234\260"
+	.ascii	"\005\005"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.56.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"U\b"
+	.string	"&\220;7Po\322\001 [x\225\332\364r(4R\275X\f\224\340\355\362n\224/\313\255\241\326\375\330{\270\271f$q\200\310\324eT\321VU\312H!*|\202\310&{\247\024*"
+	.string	"-"
+	.string	"+"
+	.string	"\217\346l\225w\032{\3201\242\030a\331]\tK\347\3768\377\247\007\204D\237?"
+	.string	"\206\335\365\013\211.nx\333\t\266\033l\233\002\246\377U\002\245\024\321+Vv-R-\213\212&\034\027\333\177\366?\016\302\335\344\371\300.\t\245d\267S\360\302\365\350\356\005\326\343u\002+\220\344\353\344\204\002\301\t?\350\207\\\304\343oX\242\363\036z\364;\326\343\003\006\211\307\b\364Rv\367y0\303~\265\273kH\262\037Zu\230\231\252\331h\306\300\031f37\016F5\b-\3130Y\351\254\033\255\312\315\206idF\253\304 xFhTr\346\244\362\322\355\253\r\t"
+	.ascii	"0\223\241\214i\3413l\234-\007C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_accInitFilters.57.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\r\001\345\f"
+	.string	"\206YYB\020\221\232\016\030N\372\016!"
+	.string	"\202\237T\364{\262z\275'a\376\254\016\325^\365W\263\354\350]_\3146\363\372\316C`F\243S\232\224\b"
+	.string	"\200\"(T\240GjA\005R\247\223\243\236\020\331[\312\224\002D"
+	.string	"E"
+	.string	"G"
+	.ascii	"\037\020=\302\013\210\036\017\342\315\246\361\317e\t\274t\260"
+	.ascii	"p\002\307\356N\312a\313\355Ps"
+	.string	"\363=J>:\217s(m\270~\317\f\236\007\206\354\356a\236)^'\323\243dw\235\235\247r\307\333N`\373\200}.\372\020,39b\270\254\261\277N\352\307~\356.\307\332b?t\303L\353\323\371\001\340\003\310{\007cWC\315\216\245\211.@<t\373#\374\357$\036\263=\344\231\257\312\036\203\313\213\207\032\273+\362h\003\322cH\273\273\252\037W\221*\003\231\031\236\324a\233:\213J\332]\022_\305WX\r\256+zTE\300\362BD\252\217\342)\034\370 \233`X\213\316\206#\334\204&\355zH\374\022\227\221\340\203\036=\001%\337=\372(\321c\006\332E\201\202\256F6\330uBe\326\003\253\252\250I\3130mci\323\346\242L\246*\323\246\221\002\306 X\331t\202a\331\004\362q\327\026\230\377\202\214\0334\234v\240~\374\357_\251\260\022#E\0165\305\016\220\266\202\005\371\316\252\234?\024"
+	.string	"2\003\006:\006\023\003\211i\373Bf\017\\3\034\f<E\"Th\n\374>\265\206L%\240\270\f\324\005\263\254\262\2744\021\234{"
+	.ascii	"\227\243\006\361\207R\006"
+	.text
+	.section	.gnu.lto_applyAccelerometerTrimsDelta.58.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`&\002\255\017"
+	.string	"V\334dD"
+	.string	"s\224\016\233\002\204U\333\264:8\223F]\214,\352t\313L\306b\004,\006\005\244\206\252\220"
+	.string	"\3247\327d\001\314\022\3504gqf6\374\273W\343xR\251\216EjI\204\322\217\345\372\277\344\223M\244L)M"
+	.string	"F"
+	.string	"Z"
+	.ascii	"B6&\266\250tl?\355\227\270\t\323['\027\331]\301Xv]\007\214`{"
+	.ascii	"\264\353\002\264\307\355\001\264G\233\354\037w\261\3663\202\004"
+	.ascii	"\312\nlw9\005q\323\323\344\377\3047)\325\205\247F\301\356:S\252"
+	.ascii	"\r\267\336v\001\333\r\354\024\021Oy\264\005\223|\352\3217\321"
+	.ascii	"\036\257\207q\200\t\322:e\314v\241R?\330\317vw\255+\373\255\037"
+	.ascii	"@\246=\232\356h\232\223\351\215\246\267Lk2\255i:j:\313\264j:"
+	.ascii	"3}\021\217\212\017\3253\360\330\325\020\013.0\254\215~&DK\243"
+	.ascii	"[w\032-3X4\372\321\321\241\245\251\214\0300^<\005$\252\226ij"
+	.ascii	"\324\217\013\006\017\250\214Y5s\341]\346\325b\264\261\200P\362"
+	.ascii	"\227W\312\211\366\250z\231\036\327\324\243\f\261\204\257x\tX"
+	.ascii	"6\205\257\030\221\370\273\212\022\003\257\335%A\361\024\241\003"
+	.ascii	"\240\222\250c\020\216<\360\301\204P\311s\020\201\264@$\372\300"
+	.ascii	"\001\016\215\220>\257\004\002;Q\027\n\201\270\020\374BR\027r"
+	.ascii	"$\0174\342B`\310\215\020\360W\241\003\271\322\367\201\\\307u"
+	.ascii	"z\266\272\362\266#\026sR\224=\232\003\307\r\033\035\365pt\323"
+	.ascii	"\216~^6\312\251\341}\206\025, \260\202\231\032\355\"\241\027"
+	.ascii	"30\206\247\004\326\220\217{0\2763\211\356\r.\310\337\204\220"
+	.ascii	"\304\356\365bZ\003\006\016\361y\260\016\241 E\212\361b\304\342"
+	.ascii	"q9X+q1\027\344\005G\374\031J\276\035V2\212\305\270\206\342l\237"
+	.ascii	"\201\320\246\277L\350\275\315\372\353\320L\3266\373\024\350\345"
+	.ascii	"E\233\311"
+	.text
+	.section	.gnu.lto_accZero_saved.2.76.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.77.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.90.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\253\001%\020"
+	.string	"\346\235jH\360\2226\035P/\213\200$~\371\312\307P\255\321\3052\376\304?\211\350,\237L\303\007/\037\3074x\354\365\337\323\250\371\207F\303\264\300\243\224\312\2418\233\243E\3754`\312\340B\257\272\337cifn\214\326\264\311\336)\005S"
+	.string	"Y"
+	.string	"T"
+	.ascii	"5{\211\366\352\2638y\027\336y\202\025<\273\013z\365\202\355\365"
+	.ascii	"-\234\2422\252l;E\205\264\351\254\025\314\313\025\207\226\220"
+	.ascii	"]\026\367JM\334t:3\223?S1\247\323\303\216@E\020\035:\257\030"
+	.ascii	"\020\237\003\236\211\254\354\256\267\020w\275m\007\266)\3303"
+	.ascii	"@8\207\371C3~\306\366\370\032\177S\232,\213\022A\347M\311#\273"
+	.ascii	"%x\304\"l\257\256\3616"
+	.string	"$\023\332aQe,\233\366c\274E\336\206\244\251F>\224\253\223W?`m/\321H\177\3464\376\274\372\305Y\344a\224\266\223j\243\321:\301\263\313R\360j\006\333\253\311\th\017.\363)\317\0338rl\240'\223\334\200f\373\3445\300\002\253\335m\340\347<\206\301G\361j\361e>\365\242\275\036v\320\017 5:/\037\250\3313ii\232=[*c{\372\025\264#`\304.L\317\220%Qm\2448\316\357\372_\247\366\355\327\214\276\214\317x\2378\001\224@\222\341k\241_\330\221Z\302\216\305\363\272O)\034}a\265\207\"\002C\243.\374,|\236\327qb\b\212\242O\344D\241\316\205\363B\221C9`\360\302\027r#\020\f\271\317\263\2452>\354\020v\364p\345\314\337\244\235z\240^AQ\r\224\226\266\001\314\371\220fW\b# @B\004\235\331\006\306d\361dc\f\221\b;\002tOi\257\332"
+	.ascii	"@\236G\230c\220\337\002\356\203\371\022!\035L?\2244\016\334s"
+	.ascii	"\271{\372\b\256'\247/\t\333n\333<K\036\370\373H-\261/\344\013"
+	.ascii	"/\205+\026\273X\013\253\021T\303KLQx\377\265e\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.94.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\037\007\265%"
+	.string	"*A\374\rD\220^M:L\221S\324\026\322\264\254#&\002.h\027\244SQ\022\343\242\033Qc\r\237d\367\365o\377\264\215\317\232F\320?\333\261\300.\200\204\0038S\001\005\373\031e4\001\026z\206\214\254m#\204H\231R\306"
+	.string	"\312"
+	.string	"\314"
+	.string	"4\257\247\177y\263\246\220U\241\232b\231\226\017\366)/\300\250\274\210\361/\317\330`a2\347,I\337\013\312.\355\031v\371Q/\204\272\224\236(\234XW^\265\017\345Qf\\J\317\2659\177\030\3212\247P\302GS\240}\314\275"
+	.string	"\371Q\374"
+	.string	"\362\243}'\256`\001\352\252\202\205\031\366]\330e\343C\310\252\300\310\346\024\352>\256\020\357E\341MS\337m5\332\214\034\305\325\322\347\317\210\242n\323\361\232\030`\302\260Ji3\242 7\264>\323:9\374\0025W9\304\234Za\001u\324 V\326\305{\275A\326\227/7V\260\262\276Sbn\316i\303\372\251\nx9#\232s\372R;\356\333mW\261\355\303&\207\004\016\3615\"\324\244\371\216\303\034Qt\276\210\264G\334L\021\316.\3612F\267\2569\347\2051'c\302/\362\321'P\350\203\037}\024\344\307{\335\001X\0262<RZ\246\313\345-\257s\316(/\020\333j\\\020"
+	.ascii	"\365\255\fR\333Ju\r\247\246\225\352\331\205?\031\244\036\203"
+	.ascii	"\324\342M\275\245Zm\352#\020\262\002`kN\033e\177f\217\221\313"
+	.ascii	"\221gy\230\246'7\371\300\260FNp+l\247Wa\273\027\336\035\020v"
+	.ascii	"\335\260\365\001S\365\244\013\224[\020M\321\240\022\255\f\205"
+	.ascii	"O\310\346O(\344-\347\022\303-\226\006\225\324\017\335\024\017"
+	.ascii	"\240\022\013i\244}\377\312\277\374\241\237\005\312\271\237\261"
+	.ascii	"8,\367\023N,\022c\304\236\b}t\207)\276\340\374\264\217\255@\255"
+	.ascii	"*\362\213x\003\007\016\344\307\331n\226\231&ZR\343rE\375\247"
+	.ascii	"Se\354\\\275\324A#\316\304\336#m\017:{\270\262Z\326\027&\317"
+	.ascii	"\363\\\224\002\362~\227\3136 \255\305\343\307cc\030\030\335\303"
+	.ascii	"G\353}\364\370{<6z\001\364\036\231g\022A2\347\204p\307\366\330"
+	.ascii	"H\006\314\234Q\337\262o\3076\224=F\353\232Wc\326\340\264b\202"
+	.ascii	"d\366\230\020>\222\253^\272\240\001j \217k\1778\035\017qs\214"
+	.ascii	"nc\013\026\264#\256\207\267\376\346\224j0\356\201b\246\264\314"
+	.ascii	"\273\342.  \235\335}U\2408E\021\340\030=x\243[R\r\371$\320\177"
+	.ascii	"\335\r\b\003]sJ=\330\306H\001\233"
+	.string	"u\331\343\267Qv^\032\332\361zJ\t\2744\004#I\205N\211\305\001/=1\3118\022W\034\301\340%\301p\372\240\344\304\264\202E\323\321\210\035\257\247D\300HCN;&\027G\274\244\025IHHG\272'\336\356\311)\351I\347\304t\324\244C\342=\351\206\030x\307\"\211\247s\261\333\361t\345u.\020\337\353\035\342T\2412\254\375>\022\207[\023I\355\224m\271\256\265\345rId\026\264#\021R\350\345ZIx\271\032d/\322\"\274\334\240}\2221s\200[\016\224\266\266\275\255\355[\342k\242\017:\007\324\033G8\261\240\355%\305\3629\221 6\347\314\360\321jC\257|P|R4h ?\336\366A\034\265\265\355k\324\266\246e\325\243i\220\266\037\276A\330\231&Qv\266\\d\0219\333\200\234\250\2218%\215bDD\204D\222$\311p\220\002\221\262\342<\021\220\261c%C\322Be\331\317\374"
+	.string	"`G\347\203\311\t&\200\356\235\345%\300\375\364\023z\200`v\335k\366\265A\021JU\244\325\032\217\204\020*\303`\335\2305\250\372=\226\341\347\361\226\275K\263K\273\303\371\214Q\001I\2461\312\212\f\344/\352\233\220\370V\211\274\266\317x\204)\021<]\013n\200]%c\244Y\210\254\305\341x\245\213\335\273\234!\307w\353z\306\377\242;\352\377w\360)S)\002\005$\030\360\231B\022\3676g\021,"
+	.string	":I[zoB`\021!\235\354r3\357H \301\366t\2420\371\023>\264\361\337e\313\267\017\t?\302\0272"
+	.ascii	"\211\3478\306\023\345\214\236M\254\343\201X)@]\016\234\227\243"
+	.ascii	"\321\350\263\006&T>m\241\224\222\022\332\257\007\301\033m\200"
+	.ascii	"Af\017\207\226\254>y\271&\205o\327\\\357\022s\313\346E\037J\207"
+	.ascii	"\226\001\260\314\205\227\255\317VT=-\240\3670\270\025\341\245"
+	.ascii	"\360\032\210\257\340\3676\225\323Gp\224\362\363=\311-\343\211"
+	.ascii	"\370;\210%\217\n"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.96.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`x\f\345;"
+	.string	"\ne"
+	.ascii	"\026AP\346Q\007\377_\317\241\376\323\013\311l\342\360\315\340"
+	.ascii	"\364\177a\250|\024Vt\234\347\037\334\"#\334\312t\357B\370X\243"
+	.ascii	"i\232\210&\006p\344\224\254p\004/'\216.\302\214l\255\335M\366"
+	.ascii	"\3362\245\024F\001<\001N\001M\327r\211\265\320h\333]\316\271"
+	.ascii	"D[\206\215\307\335p\270\306i\201\300\344\234ot{\032W\323\355"
+	.ascii	"\353\034\016\327\253[s\311\226s\366\345X\333\313l\265C\333\327"
+	.ascii	"\335\216f\313\317\354\370\0179\211d\312\327\306on\346\3653;\332"
+	.ascii	"\3159\212\323\330\372\372\244\372\372\337\237[\356\326\243\351"
+	.ascii	"\231\311\304\372\277\333\333|\314\353n=\234\2303\032\24469?\037"
+	.ascii	"\370\332\021Z_\373\351L\254\257\255+\261\276v\273\230\356\336"
+	.ascii	"\022\353~\273\005\371\263\231=\272\026vfQ\316\271\350+Nc{\215"
+	.ascii	"]}z\023\325\327\223\210Ca\020\370\363\365\334\226\307\256*~\245"
+	.ascii	"\267\235\313\223\246\250\020\232O\224B\246\346C\336\2069^\f\224"
+	.ascii	"%\n\231\232\013\315<h\266| T\0242'\376S\033\334\271I\344z\304"
+	.ascii	"\234\250LD\254(\035\332\344}\352\020\302\033%\337\343m\220B\266"
+	.string	"\304\335%\336\276q(=bL\324'\250Ci\021+{\236:\3149\007\307\302T\b\037d\254\353\331^\026$\276\276r\354\210\253j\203%\035#\301\261/\225)\317\231\235o\314\353\261\313y\003G\203\224cH\374\223\\\211\267!\347\334\236\244\342\275\344\335N\244\273Qt\373~\004\027\332\355<P\007\017 @\260\2766\305)\013%\177\312\303\353B8\335\205n\021\016h\204\307\225p\251\t\207J}\375\203\261\323\251\311y\022\n\347\207\212\231\255:\n\3261\2167@^\337\250\333\3678\037\024\355k\235b\305\n\326W\307`\332\026-\333\312p\316\231\013cf#\331n\026\216\007\371k\346\234+\264\333\361;-\332\327|m\027U\357\312*\326W\207\372\257i\263[\262\035J\376\3641\263\261\222g\214\326\255\300\375N\340~K\271\337\b\242\200\337P\300\357'\367\333\311\375>\320~\033p\277\013\270\337\004\334\357\001\355\267"
+	.ascii	"\367\273\311\375\016\340~\003h\277\231\334\357\245\340\267\022"
+	.ascii	"\373\235\344Owb\357{\b\374\026\376\276\203\277o\340\317\375\366"
+	.ascii	"\371\276{\356\267\353t\336m\357\233\307\272\337k\373\255\266"
+	.ascii	"\337\330\335x?\357\3333\024\027\t\2279\023\231>\312OV\271+\356"
+	.ascii	"\306\235\316]\216\323i\t\024\266\032\251\346\262/l\327\b\017"
+	.ascii	"\333\242\354\365\234\222@\341F#\233\276p]\0358\266E9?\213\276"
+	.ascii	":\232\3668s\344\004\232{C\247&\272\346.\352p\355rn\266\372\311"
+	.ascii	"\353\231\307\304\332\004l\367{\344M\362\256L\302Nl\300\tO\304"
+	.ascii	"\335/\223\327\311\357\316\027<^\230\253\261\3770\323\221\017"
+	.ascii	"\211o\211\310\030\332\363G\314^\267!\3668\177\247\025\273e[Y"
+	.ascii	"\361\205\330\341\276\310{\326\346\234t%\231\021\200t\254_\346"
+	.ascii	"\233\366\256\354 \026z\225\260H>\365\030,\020\007q\177XY\327"
+	.ascii	"O\325~\310KE\201\264K\274\020\023R\322 @\006p\354\234c|\230\331"
+	.ascii	"\276)\356\017\257S\332)o[\374R\276\327\342\037v.\217\356\370"
+	.ascii	"0\220\216\006\370\037\306\245\346\207!R\026b\360.\356\341\356"
+	.ascii	"\367\312\233\345]\351\303O_\230\253\373\275\260\244\232\312\357"
+	.ascii	"z\267hh\372\332\317\365\311\267\313\373\345u:Y_{\330\225H\222"
+	.ascii	"?\315\362iG\245\232\221\214\016\225Br\261\277q\006a~\234rn?s"
+	.ascii	"\316-Fk\177\305\260<\374\342\255\216\2217z\305\274m\257\333\353"
+	.ascii	"\306\372\312\303\016u\004I\3728\313x\230\331n\335\312b\\\367"
+	.ascii	"S\3768\310\003\177\354\211\336\352\260\2539\347\314:"
+	.string	"\360\307,\366&\216\006\201-\273~\332+V\324Q&)\007Od\f6\021\271\212W\214\351\300\356\f\205xPhD\002B&\234\356T\354K\273\303Hn\305XP\b\f\001H,\035U*\022\305\025\r\254\0236\262\256\216\307\033V@$\r\254\343\t\031V6\260H\300\310\3420c\206\326\221\330VTYZX6\252\216W3\256\254\254\252\212\310\243\0262\353\nY\314\302\252\242Q\264:\"\213TQ\255U\343\352X\264\241\245u,\372\3343F\353\rI\334\2254T\200q\235p\312\243\242\210\016<\n+\300\336$\322\240\004\270MT\n#\300\t\260\n\tl\331\025\327\321\nM6F*\351\032)\\A-\314\247\351h\333\017}8\243\017H\357\331\031\353+\002\354s\234A\230\"\347\020\n\237q\340O\030\n;\330\262\253\314\2775]\373Z\373\230\366\334\273\262\347X_\237\230\334\260,\333\312\234\360\323m\314\001\\"
+	.string	";\031\300\007\330\304\030x/\357\004\363\345\275\351X_\013`\336\234\034\002\230\313\026-\003p\023& "
+	.string	"\017\300rE\300\203\257\262F\245\t\363\346\224\310\005\300jM\343\357\323"
+	.string	"\340%\034"
+	.string	";\030\026&\f"
+	.string	"\177\035\260;\346\313E\325\314\331\353\355z\264\367k\2014g\257\ng*\336\260\3665 \254\257L\230JM\316\301C\351\250P\252\2469\374\023\343\257i\266\204]\215\277\031\333\243e\233\\\362\233\274\023\253 \357\220!\254\257J8\005\"gY\362\247B\"nA\314l$\233d\341U\177\213\004\200\363\250a8\345\224RhhDD\222$)tp\002\221\031;r\003\022@e5\246!\307\220\235\024\224\030\366\237\003\027K\350N\350\f\3147\267\017\274,\025\032s\257\231-\334\3567\3350\321dW\326,\343\366\300G\233\310\001\213(\037\341\035$\301hK\036\261t\272v\254SL<\301\231[m"
+	.ascii	"\001\034\242\250\366\361;\217|\317\242T\253\257\202\234\004\006"
+	.ascii	"\316\263\304\212Kj\316Y\006 \263i\207\260eN\024\033S\353\357"
+	.ascii	"\003\265\016\026\225\274\032\307+N\257\027\325Q1K\356\205\201"
+	.ascii	"?\252\2029\346\257\347|@J\356M8*\360\251\243\024\353x\353\304"
+	.ascii	"pL\203O\200\215\016\033\236\222\032\201\254\344\357W[=\323f\\"
+	.ascii	"\2321\206\r=\276\240D\270\250\302\017\261\0240\231\037>\341\177"
+	.ascii	"\244#\034\221H\203Zff8\273\242o\244\r\212\347\350jJ\234)\370"
+	.ascii	"\346\017\027\377\302K\341\263\350\007`1Ag\2007\325\237\345\001"
+	.ascii	"N\354\3213\232L\206\362\346\336\017\350\032=\351\306\005\226"
+	.ascii	"b\366\362\364\300>\300\201C\305\350\205\377\236h;?\224\013x)"
+	.ascii	"\370\3573\310M,\267\222\261@\202X\274\276\364\304D\030\035\016"
+	.ascii	"@\3648\261L6\n\217\231\373\211\"c\231\315\233]\306a\f#\341\031"
+	.ascii	"^\216\rs.8\335\0038\333\200eq\220\231\210\362\210.\216\361\034"
+	.ascii	"\t\2657\322\324\016\3434\327\255B\313[&\257\024\276\351\377Z"
+	.ascii	"\233v\317\306ElW\221q\353~)9\341\220\222M<\201J\336\235\370?"
+	.ascii	"\277\031\232V\310\217\0168O|DD7\301\205\334\235h\032L\030k\n"
+	.ascii	"6\303\0177\035\304\206\016A$\233\277\244}'\373d\237\241\021`"
+	.ascii	"?\260\357\243v\033\315|3\302\213\323c>\024\340\310\376\373\007"
+	.ascii	"\033F\314\220\344\245\351%\327=M\3443|q\364\220\224/\314&Y\226"
+	.ascii	"\220lJ\347e2g\240\002"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.part.0.97.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`*\002\025\022"
+	.string	"f\343vE"
+	.string	"\317&\035C\\\215\351\217\272\007P\020\230\253\341\352i\024nd\342\307\212\002\364\340'\362\220\271sn\300\257\225\261\200<\224q_\0354\206\255\252\252\377\255A\253\212\221\357Y\344\200Q\320\345\371\0167\262\367\2262\245b"
+	.string	"e"
+	.string	"["
+	.ascii	"\244Cw/\020\017I7\305C\373%\374\001\322\202}\200\270\374z\007"
+	.ascii	"\002\3466E\025v\210v;\356P?X\377\272[\363u\3704\343\313O\013"
+	.ascii	"\261\224\303-$\347\017'\2466#\304\023\313\360\367\006\354n\200"
+	.ascii	"\030\313c\260\273\367y\276\304TR\001\334`x\232\036\267\220\335"
+	.ascii	"5I\303\275\3356\212m\bvF\b\013s4c9@\0266\247\375\265\247}\277"
+	.ascii	"\346\323\323\363\226\266o\306e\310\004\211\323\256\343\257pi"
+	.ascii	"\326\362\006K\2671X\216?\363S|\307u\025nAJ\201\221x\200\214d"
+	.ascii	"\354.\307\241\037\220\0167^\3729-\273d\273\354\322a\276k\035"
+	.ascii	"\350\366\002\314\232\366O\034\307u\024\376\271\306.\315O\320"
+	.ascii	"n\327q\350\006\001owWUf{\301\257Q\r\350\270\304h\2211P\002?\310"
+	.ascii	"\304@~\b\337?\361P\301\020\221>\205\372\226\021\357v\021SU\337"
+	.ascii	"\"b%\217|M\275\317!,f\266\"43R\311#\353uwSRe\326\370\257\322"
+	.ascii	"\330NoQ\323\360\335\377^Z_:_\273_z7\033\004\310l,\021\n\247\227"
+	.ascii	"\222pZ\245P\034\214\234\220\234\240P'\223Q\036%*\021\223\323"
+	.ascii	"*5\222B\241N\034k\245b\225\244X\\\211\310\211\204C\255X\234\007"
+	.ascii	"\002\253&\244V\234\211J\265\342J\377*\r\201\347\277\342\266\251"
+	.ascii	"CTt\005\252\314\327 zq\003#C[\355`\375\237\312\fk\"\307K5\031"
+	.ascii	"\365\372b\333\035\277\246\007\035\030,Yd}+ `\202Aw\266\r7\"P"
+	.ascii	"Ab4*\360i\230 \327\270\020a\247\250\272\216\355\030\315K\334"
+	.ascii	"\331\213\037\255\276\021\216\030\233\nNi\300\003k\020\336W\262"
+	.ascii	"G\351<F;\232%v\225\257 \251\020\200\001D\341\334\245\251\027"
+	.ascii	"\3575\311U\206.6@=\254\t\333-4\032\027\260\203\342\211s\005\351"
+	.ascii	"\357\275\026\343\001"
+	.text
+	.section	.gnu.lto_accInitFilters.part.0.98.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\036\002\005\022"
+	.string	"f\343vF\340\322&\035\220\314\241\227\330\"8\245\237\236\375\334\255i\341\247\205\310\325\027{\027\"\251\007\254\342\005\376\323@\243\353\225\264)F\236\353\3022\306\271\335!\306\030o0\215y\276#\302\032\277~o\034\177\033\311\336R\246\024_"
+	.string	"f"
+	.string	"b"
+	.string	"\001\264Gx\022\355\3212\0072\313\213hK\377geo\333\343S\330^\341\230e\357\370\007[\223\036\022\027d\263\335\345\036u\204\365\360\2735Y\207\232\221\345\203\254\374<\304s\315\034B"
+	.string	"\273;\342jA\002\273{\331\363\306E\223*\322\263\341I\362\b\262\262\273&q\270\265\333v`[\201\235,\001\326@\322\021ji\215\351\204\351\213\344K\305gW\303\321\217\005\021\207L<\350-V\216\201\373\372`9\217yB>\263m}(fq!\031\307\230|\260\034\221\231\207\0346f\273\037\367\350\217\224\366\375\240\003\3712o\261\225OZ\337\272p\376\343\307\276\253`}\205\211\2769\373\f\260\236\022F\273\213\362\350\002\244\307\223\007\032\325F\220 \357\371\304Fg\354\023Q\030)\362lW8\215\005)E\273{`\3503\0304hi\321\036\243\336\353\220\252z\033\243\307\270\214\222\317c\323\351\244!/\373\301a\240H\273k\300w\361\027\021|\236G\273ty\357\321\357\264\307\353e\207(^5N"
+	.string	"\321\344\221\365\272\2733\251:\326\370\325\020\016\206\240BY(A\233T^:\024L)u\222p2\231J\234*\325\251^N*\356\005Ur\341L)\025\247\"\300\335\204S\212\203\351\272\024\267\331\316\373\307\200\243\307\r\032\255\261\376Pu\034w\"\312\267\235\324\024\352\215m\247\034j\212\210\351h\245\017\353\341\356\256\252\216\355\001\207\252iI\314\343a\363\241&\217\\\222W\r* P\002aL\253\r\2706"
+	.ascii	"\220\235\210\t\301\333g\253\332\t \246L\226h\f\354\316\323\232"
+	.ascii	"\0216\177\331Y\224uo\2676(<\215\023\267\204\257~\260\036\270"
+	.ascii	".'\f\354\030?\341\264\225e\235\302\022\261\214\021\234\320\007"
+	.ascii	"\027\302i\303\240u\ne\244\241\214yk\013Ak\210o|\203\251\345\256"
+	.ascii	"\275'(<"
+	.text
+	.section	.gnu.lto_.symbol_nodes.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\356\003\355\022"
+	.string	"D\032\352\004"
+	.string	""
+	.string	""
+	.string	"\002\"\177?\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\0023\177@\001\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005)A\200\204\001"
+	.string	""
+	.string	"\003\005\311"
+	.string	"B\035!\201"
+	.string	"\005*C\0024\177D\201\200\200\200\002\313"
+	.string	"E \314"
+	.string	"F\005\315"
+	.string	"G\316"
+	.string	"H\317"
+	.string	"I\320"
+	.string	"J\322"
+	.string	"K\002\332"
+	.string	"\177L\271\204\202\202\200<M\002\336"
+	.string	"\177N+O,P\002\340"
+	.string	"\177Q\304"
+	.string	"R\005\305"
+	.string	"S(T'U\002\341"
+	.string	"\177V\002\342"
+	.string	"\177W\036\177X\272\200\037\177Y\004\005#Z\002!\177[-\177\\\252\333\3426.\177]\215\276\360\203\003\303"
+	.string	"^\302"
+	.string	"_\002/\177`0\177a6\177b\206\237\370\301\0017\177c\363\276\371\3308\177d9\177e:\177f\005&g\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005$h\001\312"
+	.string	"\177i\377\037"
+	.string	""
+	.string	"\200\200\200\001\321"
+	.string	"\177j=\177k\377\301"
+	.string	"\177l\306"
+	.string	"\177m\307"
+	.string	"\177n\310"
+	.string	"\177o;\177p\377\300"
+	.string	"\177q?\177r>\177s\377\003\001+\310\217\364\031\001\344\023\003\006,\304\022\003\006+\250\270\275\324"
+	.string	"\001\304c\003\016-D\003\020.\003\001\204\013\004\020\002\001u\003\023\006\224\334\236*\001\302\017\003\0231\001\001\204\017\003\023\001\342\016\003\0230\016\003\023/\200\200\200\300\001\001\204\n\003\031\244\001\003\0362\320\360\372\250\001\016\320\241\314#\001\302\n\003\0375$\003\0374D\003\0373\204\001\003\037\036\202\013\003$\023\202\001\004$U\003%\030"
+	.string	"\001\202\n\003'\031\302\001"
+	.ascii	"W\250\221\214\342\27043\222\202\024V\016\220\002)\252b\007\021"
+	.ascii	"\300\234\265\312H4#4I\224\016\342lQ\242L\331\203O\030x\0330\324"
+	.ascii	"\300\327\362\311\nQ\037=\303-i\214\214eR\373\245\322\313aG\365"
+	.ascii	"\360*\240IDUF tT!\201\240\256\217I\375Rg\361b\370`\220\020\020"
+	.ascii	"r\315\305\021\252\226\2700\243\3074\270\353k\274\275\231N\221"
+	.ascii	"\306I\257\265\021\313\277\177Uo\004\306c\244\243\201h\217\\)"
+	.ascii	"\201\271\350\272\307\362\250\246\200\301rV\243\303\343+\253\013"
+	.ascii	"\306\374\bE\337\324\303\f\252y\216i \267\266w\341>TX\262\332"
+	.ascii	"`\255Y\220\265\370\034\036\272\227P\003"
+	.text
+	.section	.gnu.lto_.refs.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`\016\001]\n"
+	.string	"\246\034H-Pg\233t0333333333S\221B\346\211\321\021|\250\3101\037\374\255\243U>\354_\337\354\315\354\315\032YD$\3312\0058"
+	.string	";"
+	.string	"="
+	.string	"\023\303\017\372\022\363\021\303!\345\235\2057\013_\032W\032g\215/\366TNTO\216K\356!}\205\365\b\353\033\354\245\365\213\373\206=S\276,\236\350w\375Z\2347\241?&\274)o\345\355\257\336\327g\271h&\304\207\337\240\317\200\371\005\314+`\217\200\371\b\207C8o@\341\017\312\023X~\262\274\244}C\373H{\006\366\020\005\257\032\016@\371\007{\204\362\244\230pW\272/\372\261N0\361\210\376\201\351!\034\274\200\343\037\312'}\207r\001\375Hy\325_`\377\270\273\321\217\312!\351~\372\212\350[Y\343\016\030\217\031\322\035E\277\350?\321;\r\177\223\243\316a\375P\274Q\257P\222\276\242\007\254\311\330\300\037\007g&\276\246\247\343z\221c`"
+	.string	".\365^P\017\225;\3257\220V\275R\236\240\236\225\257r\366\026\024/\212\n\353\243x\016"
+	.ascii	"1B\357\217\313\0361(\026\356\214h\274\033\202\355\206\026\342"
+	.ascii	"\032n\213\202],66\013\230oFkj\332>^\n\r"
+	.text
+	.section	.gnu.lto_.decls.303b4bd02665f98,"e",@progbits
+	.string	"(\265/\375`bQ\235Y\001*H\362~T \016%\235\306\312\325L^{*b\031\213\250\022\250\250\2529k#\002\315\310\211\b\24621Q\022eQ@TUK\3149\365u\n\236`\260d\256M\212\255\266z\24083}l\027\373\035z\\\346\241p\257\266P^a\341\227aFYE[\022\271\245\2242\005\320\006\004\b\375\007n6^_e\310\372\366n\366\374\374"
+	.string	"m49\333\221\361s\231\376m\034\334\205\001\265$M\023\245\303\272\342\303\342\377\325i\337\254\263\271{l\270\244\330_,~.\242\237\177\350\347\033\372y\206~\246\322I\254\022%[fa\026??%Y\243\353\256<\031\203\237\256\315\312\223{\352N~\263\356\344\243b\364Q/\372qu'\213\365\350\260\310R\002e\361Q:\375\005\374\260@.\032\225f\303\301\343\271w\363\277\005\263F\252\323\206\331 \307\315\275\327\316\302\254\020[$\247\251\271\253\224\232]\304\302\366n\376\364\374\340\260\365\241y\221\361\020KDG\205\217\023<,>\nc\b\272B\037\237\361\262_\326\n\311\216=\257,\372\330\211\345Q\363\312\370\241\260\370XM\333\035\307iZ8\227\371\242\016\316\342\3431}\fD\177K\345\311\326\206\275q\333e\271\266\355\352@ko\246\355\322I\2637S\247V\001\324*"
+	.string	",\306\345\305\226\361q\017}\\C\377\256\356\344\367U\236|,C\003\233\225'\277\257\356d\013\303\306\250\316\017VFS'\230EL\326\232\305\307V\372\365C\326\371\220\177\327\350\253\303\331*|4\372,\3765\243\377\254;\371\267N\327mUe\221\244`^Yl\253~\253\302FY*{\023\227\346\351\205\305V\312\256\250\316\317\331\251`Ss\253\351\240[\352\260\370wN\257\260\367\336\365s\031\370\367\367\367W?\227\177Wy\362M\335\311\277M\261\201nr\322Ff\361oQX\250\013\025\245\265\327\366nf\250\233\313\2132\026\333\023@!`4\302,\376=\323\377\255\223]Z&\313\264M\325i\237*\230\327g\345\253e\366\251\206\261;\207\331\334U9\\1\256\342\372\354S\345R\277"
+	.string	"\217\254\250rW\3632\027V\233\220\007\366\251b\251z9\313\346\236\002rM5_\317\354SM\253v9\314\346^\346\344\301\350\371\371\371\371\371\271H\264|<o\360\237\317\315\224,l\333\342_\036ZMMS\235uM%\003W\321\334f\234\206\343B\361\\S\217\32419L\f\273\211\013\352k\357\355\363\363s!\314\216\030\031\373\365\340\340\320\"R\303\342_\026\372\265-.\315\231j\246:k_-\243\326W\231T\267\034fsS9"
+	.string	"\315U\\\317\317=\243V\367\314\370\226\212\276]\023\363:\346\257f\365Lm\357\315\301\206\305\235\036\f\213\205\202^\305\3440\271\026\316X|KD\377YyrN\335\311\2675t\355R\275T\347\006u\257\251cy\250q\036\261\370\366\205~\335 \337\277\277\272A\276U\241k\226\252\245:=\324-\027\362\340w\231\246\203\263\306\310\0324\026\3372\351W\017\271\376U\017\371\265\214\256y\266\342\325+\257y\325\312\205<\370M\323&\333\273Y\363\360\336\314Z\005\220S\253"
+	.ascii	"\3209\037\314#\031\277>\365k\236\356\251<\271\316'\377\300\342"
+	.ascii	"7g\361\353\022\rW\243\324\273\034x\315\224'\225*\245:\353\224"
+	.ascii	"\3726\245\036\251Kr\320\275"
+	.string	"\231R\276\366\336?>?65lT\241\310\030J\317\355\213\022\327f\361\253\020\375\332\026\267\244\2369\251n9\350\336Zo_{\357\377\365I\245\253r\325Y\347j\223\333\346\027\360\007\275\316U&\325\255\203\323\336ZY;\314'lB\372\366\336??=?h\231\347\031>\215_\235\364\213\372C\372%\320\367\200\276\b\375W$\315\212V\335\252\326\336M{o\016@+9\264&\026\327$UIu\372T\266W\265\332v\224\331\334\315\275\267N\r\223\203\251\312b\f\225'\277\001\372u\355\0300\267\007\317\321,\330\273\372\344\372\367W}rU\013\032\253d;\231\n\253\271\327\366\336:7\356\311S\032\213m\335\311\277\240ou\210\312\223s\335\311\032T\236\214\353N~\\\345\311oV\236\254\353N>\300]\201M\343\360\243N\377CP\226\202+uW\374\265\312_\357.\320oED\375\026\004W\005\002\376j%\305-"
+	.string	"\212\357U*\265\256\006\371\357\366-\317\277&\251m\b8@\317\361.\324oI\360\232\300\217\n\377\033"
+	.ascii	"\346om\374\366\306]\216\375\265\005f\177e~\357\356\377\033\324"
+	.ascii	"\375\337\026\334\025\3747\005\377U\372\257\361\004\252\363\337"
+	.ascii	"\013\376\232A\361\377\226\277>\251t\024X\001\376\373\217F\314"
+	.ascii	"q\375\261\223\212\377\377-y\316\217\242\3314%\177\315\340\222"
+	.ascii	"\300Z\340\033\374?\300w~\224\251\266\035\377h\331o\307\256\321"
+	.ascii	"_/\250V\036\002K\206\363\243K\277\375q\213\376\272T\205\374U"
+	.ascii	"\005\225\005\022\236\341GAp5\3746\004\242\312\004\356{\227\004"
+	.ascii	"x\0078^\350\307\316\3376\323!Q\352\252[\206;\364\277\347\257"
+	.ascii	"m'q\207\377\025\326%\377\360c\"\377\367\016\360[\272\374\243"
+	.ascii	"^\227\004\377IX9T\307o\235\356\b~\253\202+\202\277\326\337\202"
+	.ascii	"\370m\t7\004\177=[\363_\020\374\326\336\017\030\371\253\375\257"
+	.ascii	"\007\376\n,\273\037t\240\202U$\367\001\034\370\257\t\277\215"
+	.ascii	"\300%\221\302oG\374\025\001\377;\\\261O\037\374(\316oYpQ\370"
+	.ascii	"\353Rea\005\027~\214\346\277\366\277\372\277\300\377\242\377"
+	.ascii	"\275\377\315\377\275pq\370~\373\367\337\337\r\374\327\3713\207"
+	.ascii	"\277\336\377{U\037\3751\216\377s\377\237\374w\002\345\177\335"
+	.ascii	"=\3417?\352\242\352\333\374\250\324\377\276\377e\236\346\277"
+	.ascii	"_]r\375\243(\376\233\201\377\206\360_\006\3747\350\277 \376\373"
+	.ascii	"\363_\003\374W\203\377r\370\357\316\177u\376\213\363_\233\337"
+	.ascii	"\336\375\026\355\267v\277%\373m\217\337\322\375V\356\267q\277"
+	.ascii	"}\373\355\323oW\360[\266\337\256\3756\311o\325~\233\366\333\262"
+	.ascii	"\337\202\375\226\310o\205\374\026\310o\275~\333\365[\024\277"
+	.ascii	"=\361\333\345o[\360[\245\337&\177\213\202\337\036\177{\364\333"
+	.ascii	"\342o\211~;\364\333\022\2775\301oI\360\333\020\3746\205\337Z"
+	.ascii	"\340\257*\370+\007\177u\300_\221\277-\341\267\366\257Y\376\232"
+	.ascii	"\367\237\304_\251\374\225\371\037\357\277\333\377\277\377u\377"
+	.ascii	"3\360\333\b\374U\347\257\030\376\n\374-\t\277\245\300o'\360["
+	.ascii	"\021\177u\376\365\202\377{\177E\362[\t\374\025\355\267!\3745"
+	.ascii	"\203\377m\277m\300oA\370\355\375\353\226\277j\371+\226\277^\371"
+	.ascii	"+\336_\255\374\365\356\257v\177\255\373k\224\277B\371+\335_\233"
+	.ascii	"\374\225\311_\343\376\n\367\327\267\277.\371k\333_\335\376\312"
+	.ascii	"\366\337\204\277f\370\237\302_\203\177\325\377\225\377\247\374"
+	.ascii	"\357\371\373\373\373\373\203$~\235\244\277\001+\002T{k\t\245"
+	.ascii	"\266w\206\246\246\245\bZUPj\314\235\001JmWm'\274\252\272\233"
+	.ascii	"[\313\335\244\2653\354\246\315\334jZU\032@5mUA\2511\2532@\251"
+	.ascii	"mUm\265\255\215a71\251P4m\252\f[m\213o\253iUa\200R\323\252\202"
+	.ascii	"R\333b\253<R\354\350k1\327C\207\216\312\007\325\264WH\315`Ra"
+	.ascii	"\270\203jj\355-{\327\265\247M\265\357\366\036\300\3363\264\250"
+	.ascii	"\2660\257j\034\323\335\n&7\246Vm\356\275}\244\230\270\264v\323"
+	.ascii	"\335\262\356;"
+	.ascii	"\250!Z{\017a2\332R{\357\335\301\262y\267u\324\273\245\215\031"
+	.ascii	";\352io\fvso\251\275\227u\337\355\275\227{o \325\214\346\336"
+	.ascii	"10@}II\355\215\325#\265g,\231<\355m\327\270\304UA\251qi\0051"
+	.ascii	"I\242\366\265O4\227\025*Jk\177\355-[TZm\211\266\243\366\336U"
+	.ascii	"\214\376\252b\021\306\342\246M\034\rg\013\213\2358?\206\240a"
+	.ascii	"\263\370\031\230\032+\271a\276x\263b\3611\234Q\303H.l\025bjW"
+	.ascii	"\324\360\2214\246\275'5\213\233\033\260\300V\230\275:\261\031"
+	.ascii	"n\006\2416\001\230]VP6\025\026\007A\2543)r\026\3433-&\f\230)"
+	.ascii	"\213\217aL\037\003\030&\263W*\202XY|\f;\360\030\026\263h\342"
+	.ascii	"\272\340\245Y\374c#6\362\224\314\230\2638\b\313\310\021\026g"
+	.ascii	"_{7\203\\\224\335&\024v)\352\2361~T9\355\021*7\030^AY;V\300}"
+	.ascii	"\2419q\371\332\273ydj\t_\013\263\257\333tb\013\231\024\224\247"
+	.ascii	"\n*O\031=\216DIy\336&\250\252\227\263\304\260\231\362\252|a\037"
+	.ascii	"\270\006\336\201o`\"x\b\316\201\273\260\016\374\003\367\300@"
+	.ascii	"p\020\334\002\006\303<p\021\254\205\267p\030\376\302B0\016\314"
+	.ascii	"\205\275\252\023\333\3004\260\r<\243\352\335\346\027P\t\027\217"
+	.ascii	"g\320\225\330\323\036\261\252n\267\031\247Op\255=_\324/Ld_\267"
+	.ascii	"\t\333\300O\365K\275\313\261\231K\020\312\254\266\314\372\366"
+	.ascii	"n\006\327n\320Iu\200\217\201\251\257cE_\207\211\276\316\231\276"
+	.ascii	"\016\020}\235\033\372:.\364u\232\364s\300\350\347<\321\317A\323"
+	.ascii	"\317\311\241\237\203\245\237\223B\037\247O\037\007\213>\216\023"
+	.ascii	"}\234\246>N\016}\234\026\3728[\377\346\251\177\003E\377\306M"
+	.ascii	"\377fL\377\306\206\376q\023f\362\201\205\271g1f\326\332\344\232"
+	.ascii	"sZ\374\233*\375z\006\206\355\353>\357\236\223\313\355[\362u\371"
+	.ascii	"\326<\260H\252^\316\335\233\306\331}\362E\254m\001an\231z\207"
+	.ascii	"\025B\230\331\023\355\236\271]\356\236\016\264\263\347\337\365"
+	.ascii	"\273i\360\022\357\273\346\252\271h\252\363\236\271fj\363GG\256"
+	.ascii	"\316G\230\006|\2330\3726U\364\025s\307Tg\317%\203\307\264b\206"
+	.ascii	"\305\267\201\242[\260kO\376_\355\311\267i\242o\323\246o\243\246"
+	.ascii	"oS\246o\023\344z\301/\352n\374\260\3706;\364m\2664\b\225'\377"
+	.ascii	"W\317>\351\023O\246\306l\321\342%\216L\231\305\3155$kLN\204q"
+	.ascii	"\261\313[\203\345^\221\301\204\363\262\270\331\024\226\245\347"
+	.ascii	"\314\263|LSJ\234\340]\001\315\244`@Y\271\313D\254\334\310aq3"
+	.ascii	"\003{7\200T\261;\320#R\304\230vu&\260\260\314\250\374\326U\267"
+	.ascii	"\252\2659\344\260@\022\026\303\342;%\350\227J\b<l\210Y|\257\224"
+	.ascii	"\0178g\2620\205EY\002\275\344\236\314A\241\343r\343\315I\356"
+	.ascii	"\227\356\277s\367I\325\253Vt[^\026\177\250<\031\255;\271\232"
+	.ascii	"\005\375\312a\033e\246\2028\361\240\323|!e\243I\315\033{\302"
+	.ascii	"\265\306\244\256\321sj\2404\211[\202\314\202\322\007w\0370&5"
+	.ascii	"\272\336\354\006\222\271\342\224\262\344\272\005\257P\361\223"
+	.ascii	"s{\265+\203S\243g\361\177\333\256\363\202\026+\025N\213o\243"
+	.ascii	"~\353\342:\355\013{U\357\326p\021/J.\333]\273I\252\363:\357\221"
+	.ascii	"_\265\213\304\305uZ,;#\204.Wq},\234\266\205\320\336u\332\032"
+	.ascii	"7m\031\002\227\237\037-e\311\002\306\005\034\334\225'W\252\272"
+	.ascii	"\223o3C_\264\034\261*/\202X|\033\026\332\266`u\330\036\027\215"
+	.ascii	"J\2671\201y\216Ys\231\216\350}\355\335l\301\207\035cr}(\263R"
+	.ascii	"\371\354\226\355\372p\326\302m2r\235\016W\357\326\266\023Z\002"
+	.ascii	"\312\226Q6G\315\213\300\022\354\026\207\220\007\327H\275"
+	.string	"\253y\365\016k/\371\npV\005&\326w\213\334\262+v\307n\363\232]!\227\310\r\273C\356\331%\273`\325y\215\3302\267Y\226\306\331\257\021\233f\305\200\360De\001\256.\317\275\267\221\013u\277:0A\355m\325\301\230\025\253\365\333\026.\220\033\244\336am\346\262\2033 `b}\226\314\2105\253_n3N\2378\342e\214\021K\306\252\001\341\211*\270\342\b\227g\331o\311\256\021[V\227\324\273\034{WuP\306\004L\254o\357\215\363\202\313\324\222\016\370\257b~\203\350\231`s\310 \205\252\206\305\277\220E_/\035\0338\230X,\376\205'\032\305\215\272\315\257\021\230V<y\334\037\267Gu^\037M\327\307\225\272-\200\360D\245\001&\251\247\217\273\343T:0Amf\013!\200\234\021\362\002'\311\021\245\206\306\277 C\277\242\301\360\251w9$\020\244\215\206\221\347m\341\256\270X\035\230\2400"
+	.ascii	"\305\315\036\221\361\271\234\340\336[k\225,K\314F\315\370P\357"
+	.ascii	"\326D\210#{\356\335\274-\334\032\237\313i\302\260\233~\204=\355"
+	.ascii	"\221\333\302\215\341\223u\350\360\372\352\2738\256\216\273u\273"
+	.ascii	"\256\215{\343\346\270\\\325y[\270ZM?=h\022$}h4\340\007\237\350"
+	.ascii	"\007\341\364\203J\364\203g\372\301\"\372A/\375 \016\375`\326"
+	.ascii	"\225\333\022\f\336\224\305\017F\351\377\267\305uQ\235\367\305"
+	.ascii	"\245\232\272V6\366\276\356\213\313\342Zi\330\323\353\222\353"
+	.ascii	"\273o]\306 \311\370\272M\377\327\352V\331\254)\313Zs\253.U\216"
+	.ascii	"\231W\224\r\213\257\205\350\353\036\372\372\206\276\246\241\377"
+	.ascii	"\253\342>\335\023\266\313\004\250\023\305\224\023\026\337\024"
+	.ascii	"A\277*\234rDYY\274\301\225\276\266\322\266Yy\362\207\272\223"
+	.ascii	"\257Oh\r\352N\276L\355\003\313\f\2710wyw\336\332\336b\361\335"
+	.ascii	"\377\222\271,\237\370u\261i\374\322\274`\342e\361\201O\364\253"
+	.ascii	"\323\242\361[2\004\205\333\231[\277_\310\203\232w\263;\334\370"
+	.ascii	"Q\261ka\361\311\330\276\377\301\234,fpN\372\314\344H\341\355"
+	.ascii	"-3\266L\260\314\0265c\026\037\270D\037\230D\207\250;9\214\355"
+	.ascii	"Rv\225\304\342\003\305\300\330guZ>\353\274mZ\264\367\360Y$v\r"
+	.ascii	"\250\367\344\263lv\257\336aa\330M_\324<k\222'k\302dlg\271x\371"
+	.ascii	"\362b\273\330/\325i\367n\367l\233\225\313Yf\330\273+\315\327"
+	.ascii	"\236\235\263Tr\232\232\333*\203\331e\310\372~l\242nd-5\336b\365"
+	.ascii	"\252\323r\261Z\360l\226z\207\325\334V9mZe\310\372\270\330*\326"
+	.ascii	"J\007&\250\n\310uyj';\344td|\340\017\375\333,\267XpP\300\t\321"
+	.ascii	"\222g\257\\p\201u'g\361\201[:\357u\005\020\247)\026\037\bC\277"
+	.ascii	":\277g\357\376\005\363\240\362\242\314\342\003[\350\003\245\364"
+	.ascii	"\201(\250\330'6J\275[\023\301\356\313s\357=\305\326U\247\245"
+	.ascii	"b\245P\261nU\257\336a\205 \005\3143\307K\310XY\306\317j4\006"
+	.ascii	"kRRg\241X\272\215\203\363%kn\210\305\317b\364\263\027\375\274"
+	.ascii	"\245\211uR\235V\3162\271=b\325\336\323\334\333M\316.\261q\035"
+	.ascii	"\230\240J\240\341\367$\223\263\001\\yL\026\347#Y\255:?%#yS'\247"
+	.ascii	"\311\t\347\024\213\357\241\206~\375\224\334\202\372)97\237\321"
+	.ascii	"\376`\260\t\215\033[\026\337\303\225\376\363\331\037\004\262"
+	.ascii	"e\221\361e\361=X\351{Pa\304H&\013Q\367\2116&5\317+#\354\f\037"
+	.ascii	"Y\036+\273a\0067\226\305n\360\366\252\260\205\021\302\024\305"
+	.ascii	"\206"
+	.ascii	"\305\357\240F\210\220\f\326\243\265\034\023\342,\314\226Yur2"
+	.ascii	"2\225\301r\221\234\256&H\302\212\020\351\342\372\341\003G\n\337"
+	.ascii	"\231\246!6\210u\322\3501&\013\020 \326\257G\353ja\221W\006eB"
+	.ascii	"\204\211\017\213\337\301G\217\036\331\253\246\355\251\r@X\340"
+	.ascii	"\305"
+	.string	"\365\235\371\341\225\345\037\317^\331\307\037\016\034yGM\333S\325\311\302lL\237\225zK\343\324\361\274\243\n\361\222\005\306\342\234#\r\212\2728=\2562^\340,~\006K\266\276\225o\364\350]\2267\366\274\321\362\334\323b\343\371\006\334\r\024\223L\231\305\231\213\313\251\367\342p\225\310\233\0216\213\237\301\030\f\030Y\313\203&Z\326h%l3d\324x\326J\213\222r\306\342,#\323\370\037\324\241Cq\246&\323\310YLl\344`\332\270I##\214\226<\003}q\207l\211\335Y\234c\034\016J\332\222g\0068\\\270\310W\033`!F\303\246L\n1P/\236\257p\336Y\226-i\252\2522\213\232\266\247\032\300\004\206\025\2667\326\007\033C\214\335\016\213\377l\365\314\342\027\326<\361\265\225\375\017\206\340\302\343\207\305\307\240N\377\177\236\312S(ZM\333S=@\270\212\304\350\333\033\353\003\036\323\"\005g\3611"
+	.ascii	"\242\377,\225\245,T\017\206\275od\305m*,\016n\340Zl5Y|\f\260"
+	.ascii	"P\274\243`\360\262\212 \246\3154\3730\203\203`\227!X\256,\316"
+	.ascii	")\334\304\360Y\261\370\030\250\320\257dO4L\227\247\030\224\257"
+	.ascii	"\003\023T\005\310\270\220A\315\324\273\034\022(R\305\272\241"
+	.ascii	"|z_L\031E\206\312O\271)\237\250\316\354\204\366e't\214\004\310"
+	.ascii	"\2668\241g\362\362\r\314s\357\375s!\305\326]V\016~~\257\003\023"
+	.ascii	"T\005\314\366\236ygfu\346\345{\026\220\227\250\037\372g\263$"
+	.ascii	"\317\313\316\347\007'\314\225-22\376\321\277\243k\334\2328\304"
+	.ascii	"X\214\252\301\272\232\342d\361}\272\350\037ES\235h\032M&\214"
+	.ascii	"\t\232\275\377A\033\272\035\\[\364}\360\364}\346\3202\032\313"
+	.ascii	"3\313\316\342\373\300\351\373\264\351\373$\321\367A\323?\032"
+	.ascii	"\006\345S\2232\306\216\257\352\325E1Y|\2372\215vA\367\320/\177"
+	.ascii	"PG,\256\253\315\342\373\020\321G\275\374\017f`G\2256\213q\375"
+	.ascii	"\\F\365\216r\371\203v\212\327\227\224\305\367\371\322G\265\240"
+	.ascii	"[\376`\316\226\037N4\213\357\223C\037\315\362?\210\266\375\215"
+	.ascii	"\201a1\212E?\371\304\330\340B\326[\r\031h\336Q,?z\305\342\260"
+	.ascii	"],\374\2511c1N\335\311VE\320\321<\033\273'\3173\213\337\243F"
+	.ascii	"\243w\350]\b@\306\276\246\224=5Y\374\236;\035%\njW\367f\221\326"
+	.ascii	"e\325Wah\265\310\202\326\035\265\273\351\222\367V\006\245\022"
+	.ascii	"\034\343\252C\251\240S\232\260\231q\251\2233\333f\250\224\372"
+	.ascii	"\006\264\272\243;a\361{\332\364\223'(]\005x\306\254t\334X\021"
+	.ascii	"\306b\224\256'H\223&\250\234\217\2214[\206H\020<\324\311Q\271"
+	.ascii	"[\267C\210\232\305'S\277\374\017\3423!X]\026\277'\206\376\321"
+	.ascii	"\270W'\032\207\331>hm\253\016\312\232l\231\351eY"
+	.string	"\n7\213\337\003\245\177\324\255:Q7\364\255\246m\0269]\226gO\354G\204\315\313\242o\350\022\023\354\355\026\306)M\f-h\372\300\272\260\261\241hz\367\214\205\351\262\352\023\373\262\273\262\370\034\340\364\217\256\275:\3215\013\025\2647SF\002\316\302`q\220\247\222d\361Y|\016Ct\222$(\232\336{\267}\201\201\322\002\212\305\347\020C\253\251a)\f\300\302\372\200\223\230\235qY|\016Lgh\332\031\212\326l\242huS\355\215\265\227e\262\013+\035\270\024\\\344,F\321\360\206\374`\263\370\027\214\321\277\300\316\bZf\004%C\305P1\224\214\347o\013\270\034\223#\203\216\035%\303\351\"\245\303\313\342\223\371\033\220'(\212X\374\013\324\364/\340\322?\nV\235(\230\275\312T$ Y\361\274@\205\376Q\"N\224\310\347*\260\231U!\230\204\341\001\243\177T\b*\344\326\035m\3326\302\276\366\306\342"
+	.ascii	"\007\210\030\022&\213\317\243\247\177\024\b\n\244\352\325\264"
+	.ascii	"=u\341\204\325\02735`\262\350\260\370<H\320\034\250\0174\007"
+	.ascii	"\352\205\3768\352\205\352@u\240=|\310\244uY\365\331\304`\332"
+	.ascii	"\nCy\034\355\001t\352B\323\302bt\007^\373\037\324E\310\370\305"
+	.ascii	"\361\214\351\363\354\320?\252\242:Q\025hW0\004'xh\327\217F\241"
+	.ascii	"R\350\r\233.*~X\026\333X\262\203\013\314\342\363\310\320,\240"
+	.ascii	"P\311\210\2332\213\022d\005\345k\357\r\303.\312\323E\221\025"
+	.ascii	"\365\353I\224\252\303\345\004\367\2062\026\207\326@\263\320\026"
+	.ascii	"\320-t\006\252\205r\2411P\032\325\211\312@_\034\275B\261\216"
+	.ascii	"\317P\031h\213\303\34545w\017`\027\246\2265}?6XqP[6\340oH\243"
+	.ascii	"\255V\345\311\005\330\323\337\300E\177\203\026\375\rW\3647X\321"
+	.ascii	"\337`\247\277a\212\376\006(\372\033\346t\276\253<\371^\352N\376"
+	.ascii	"\2066\024\005\212\242"
+	.string	"\311\2063\224\t=\2012\241Oh\023\332\204>\361\324\250N\304\3008Q\247\243O8d\220\334\231\315\370\037\314vSi\374,\376\0060\375\r9\364\217.\235\350\362\322\325\264\275<\301\231BJ\337\336X\034T\2720@\354,\376\006,3x\215\031\374\227\367\256M\255)\252\2239\376\013\002\021\302\025eq_\037V\243\227{/\233{j\303\034\326\007K\326\324V\206\323\034\253Ag\350\021Yb1>\203\321\374\017\002a\220y\003C\203\375\352\226\347\231\034f.\232\227)X\306\222\374\017\33615\222\320Y\374\r+\364w\324\220!\023$\004.<\326\244\210\021S\363j\332\236\332\300V\227UX\r\247!`,\376\316\020\375c\276_\310\203\352\304|5\257Gk\311\027\202I\232\306bd\007\225\305\337\271\372\202\005\203\261Uu?Q]@j\354\271\343B\177\247\252\013\306\202\275\330\255w\234n\"U\366\334Y\352k"
+	.ascii	"\243_\215T\274\005c\301zu\t\3369\350\3226\007\327`E_\003\023"
+	.ascii	"\375\343,Y\352\227\017ZLf\001\230l(\034`\273\251\266,\213\257"
+	.ascii	"\201L_\271Bg\245\301\205\3761\236\023\343]\267\013\265\231\\"
+	.ascii	"!8\t\242\201I\377\270\n\236\202\357l\225\004\202\316\266\250"
+	.ascii	"8\270\206\245~\0065\372xJ\305uN\\W\277|\330Lf\001\234XuY\365"
+	.ascii	"m\252&\007\317\360\324\257\365K\236\233\303R\366\222\317\203"
+	.ascii	"3f\227U\337\306\242\372\360\343(\307RtN\224\241z\203R\231HV<"
+	.ascii	"\241\320a@I\0241\1777Q]\360\374\236T2>\227\b\013*O\026?C\023"
+	.ascii	"}\354\206\227\034\277\375\r;\251{\357\215\005\201#^\236\033\013"
+	.ascii	"\353C&\342\314\242\205\233\034;\251/t\220\301L\376\007o\314L"
+	.ascii	"\311b\201\231\3408\025`^\256\354\t\0342QA\2420\\\005\243\277"
+	.ascii	"\274\250a\3613\f\321\177\275\375\363fR\355\275\255\320\346\246"
+	.ascii	"b\272\311\177}Ek\375\360\343\324[\007\360\037\357m\001\244\346"
+	.ascii	"nz\322c\357]\307h!pL\031\032\354\377?z\267w\323\326R\002[UM["
+	.ascii	"WPj[U\031\240\324\266\366\262\351\3072CI\244\"\222\304\005\027"
+	.ascii	"0\354(\223\310\364\210\270t44\026G0j Y4@\317\215\200\212\214"
+	.ascii	"E\2442y\301\321\221\222\321x4\002\225\302\224\205b2\253pD\032"
+	.ascii	")"
+	.string	"\217F \3210=\302\3124\211\224\"\345\244\322\004L\270\021Pz\202!\321\217\210\364\004C\"\234\033\001\201\3500\224\036\225\030\032)\220,!E*)\207)\021\206\033\001)\215)\322\020rx,\001\242"
+	.string	"7KGII\"2\214p\002\006\224Ec\t;\302\024\251\2504*!A\020\211\002\240LS\270p# \020\307b\276\021\020\021\004\221\210\303\022QQy\314\300\220Q\204\211arg)\3518\242Gy#\240\242$\020EI;D\243\222\215\221\310\242IaQ\322\215Rh,JB\215EI7e\241\230\304KIG\"F*\223\356P\n\034J\223J8\t<RX\224\004\204\263\204T&\213E)\n\303\016C\345Q*\202\210\245\243\244\244a\207\344\206T\231\036%!\035\223%\020\211\303\236dzD\\\032\221\246@$\0169dX\032\"\221\":\214\220\001R\252L.\245 \304"
+	.string	"\005\"q\350\203\2022M\246\310\013\222<>ECdjB\204\361X\024\241LI \022\207\032$9(\215J\307\021C\251rx\244\204\244D$\0163@o\004T\244T\"\035\0021tTT*\221\016\035M\b\022\211C\f\312\033\001\2010\036\221\220\216\304\f\204\226lR84TBA\261DN\210\0226\250\204\025*a\203\206Vhh\203V\260B+\330\240%;\002\2218\f\262P\001\245\322\b\242$\f\020\211C\033\3400'9\224\016\351\004C"
+	.string	")\221\303$ %1Ub@:\"O\240"
+	.string	"\005\216\312\324\3040\205\001\244\306\243\bH\245\34405\301"
+	.string	"\251\211\242\222(\302x\034A$\212\350P\242\206"
+	.string	"*qu\202\200\220\212H\022\351Q\221q\230\001G\bh(51L\nu6\2100\226p\200\f\303\272"
+	.string	"\240\341\025Qd$\336\020\211\"\220\220G\"d\232\344Ah\034A\231&S\024\212\222<\234XD\246\306\264H\277\203\017\024\360\001\b+"
+	.ascii	"\017\202\003B8 D>\b\016\b\nr\300\007A\372\037\004]\245R\230\344"
+	.ascii	"@\212TT\352\r'*\211\304\341M\205\351\320\321\004d\232\224\246"
+	.ascii	"%nn\004tD.\025apCBiL\221R\023G\0234@:\032\323!!"
+	.string	"\321\270\224$J:\022\342\244I%\341Qi\303\202\221P\207\005#\fAABB\026\2146\b\t\211\210\216J%\242\222\350\230\354Qa\270$T\246I\"\242\243\216\n\307#\"djB\003' \246FD\234\fi\322\222R(\224L\016\223T8\036\t\227\220\251\211#1Ef\030::\032%S\244\221R\250\302pI\203\222\b%\212G\303\021G\344R\021\007\026\214\204+\f\221\214KC;i\221q\210\324Q\032S\"2M\022\032)\207\212*p@\201\r\013FBc\021IhDT\036\215B\343\322\020\206dq\205\241\260H\251D:$D\246\312\243\"\221\360\210\\*\272@y# \023\351\320\021\271T\004\242(\251\007=\"\227\2124\344\025\322!c\021M*M\240\230\224\314EC\022\306$1'\225&@\024*\212 \n\025/(\205EC\022\307\"\260hH\242\250\\!\005&\205D\342\020U\336\b\310"
+	.string	"\310\364\350\250H\224\225:B\340\215\200\224D%\2442)\224\024\256\220*\225\2202\234\200x<\022\n\263\322\250t$\n\205@djT\341(\024\002\223\3104\251d\024\n\365\220\261x\002\2410'\215\305\244\244P\b<J\205\302\240R\250L\026\2170\334\b(\231&-)\0250\224\"\207FI\005\200H*\213%@(\031\213\024\260\202\222\261x\244\200\016>\020~"
+	.string	"\302\n \322!\245#\242\261\b\002\231T\002\321"
+	.string	"\345\n\251\361hhD\246JcQ84L\221F\312$\241\220\203\211\024\231$\024fe\262x$\024\346\241r8$\024\346\224\205bR(\314' \036\21701E\nI\bR\026\215%\030GP\026\215\305\214T\236@4*\21504LQ \022ElH\nM\244\"\020\211Cm\034ah\230\"\2632),&\245@\224\212\220&-\221\020\226pB\n6)\3218T&\215E\255\024j\240\004l,\236`L\022s1)y\223\302\021B%\330\214\020*!\230\211B\305{#\240\244R\t\237\244\320\204!\f\310T\231\034\"\345d2E\016\r\r\201\251\211\341Q\nJIHZIh\"\035J*\225\320IaJ,\232HEH*\225\260I\205i\322\022\211\244R\211`\232\264\244L*\225"
+	.ascii	"&\225J\\\022\202\204D\3420\2530Da\204\b\"\262\362F@JIH\302#r"
+	.ascii	"\251(5QD\016! \025\242\020\302\203\020\037(%!\355\030\217E\245"
+	.ascii	"\322\3211\231\"/$\205\033Ra\nJIH6Yy\244\224LQ0\036\213Jb\252"
+	.ascii	"LEPJB\322\220\n\215E\305\243\2410\307XT<\022A$\016\365\322\320"
+	.ascii	"0Ea\250\034\016\005\221C#\"N\207\216#\214\307b\262h\"E"
+	.string	"\336\230H\207\256R(\264\200\243\241\td\2524\226Pd,\036%!\rS \022\207;#D\020A$\016sJ4j@\231\034\246\030P\212\030J\225\303\241$\016\034\245D\242\210d\321G)\024Z\200\322X\004*\211\322!\241\222\303\215\006\220T\022\032\021\225\305\023\206\214\"\216\216\216\310\035\rIaQ\221\310x\034\201L\225)\322Q\263`$$J:\022\022\211\303\013J!\bJcQ\t\230\"\207*\f!\207G\307\343\004\204(2I$4**\032\t\211\304\341\215\222(\035\362\271\021\220\207\037\223R$\b\345\361\210\004a\243\302p\351&38::\"\261\021QYLB\223\251\322\321\320DV\022&\221\212H\022Ib\021ih\\\022AiTT<\"\342Q\n?\bR\032\213\300\007\005\215\320\200\003\031 A\023\201\214\307\242r\210L\217R\"q\b\"\211<&\215i\022\204\2618D\002AD&A"
+	.string	"\t@\205!\362\036\221i\b\210\304!\360\300\025\027\r\327\027\224\255\223\343\2277e\006(\225\275\200QX\212\212\274\003'\215\234\337\230\0247p\004\261\243a1\260\t\330\004\204\252\233JL\023\340\211\003\241\022\020\225c\005\360I\247)\f\207\025\360\t\350\204\321\320\310t\370X\0311f\274I\321?\220I+\t\336\223\021 \263\353+\315\206\025p\211\3368\243\206\256\210\305?p\347?&\"b^\256\323\221=\266\274&\253\261q\322D\254K\347D\n\027]\326\314\315d4\327\300\334\233io\032Y!\2245\3312C\223\375\240\230\231A\363\313g\266\235\236\022\247\305\252\363\263\353\3034p\231\323\016*\270\3473\223\341\261<{f\276g2cl\306\330\2324\306\210\301\261#,\bff\261\032N\360r\230kF\306\2212us.\230\214\325Y|"
+	.string	"\230u\351\222\277T\2520 \230\262\256\342\3726V\213\017_\362\236\034\223\t\227\274\227\275\340\026O\234"
+	.string	"1RF/\316\342\003`\207\3763\227|\205\325\274\234Q\243\207\222\001\221\3448\253\261\305\013\354\013\0220-,.$\001\353\262\226\005Es\302\310\301eq\316\313W\236\261<c\261\031\313\375\373\313eW\224d\234\255d+\265,H\227U\030"
+	.ascii	"\232t\225*(]0h\f\317N\377\331\256~\311WNh\332\352\320'\235-Z"
+	.ascii	"7\242\250`5\317/F\260\344)lQh\314&\213\233dSS<\264r\024\364-"
+	.ascii	"\212\027\226)\0267\311\366n\346\344\"=N0\241\003\013{\242\020"
+	.ascii	"{\222\311\360]\237S\326\034nz\311A1\311\345\267\273\263?\035"
+	.ascii	"N\376&\020&\352Fn\202\235\234\371\313Bcq\216\313q\250]\335T\035"
+	.ascii	"\214y@b\366\234f\226\337n\226\233\275L\333S@\270)]\310\3726\024"
+	.ascii	"\326\007\0334\025hV\234\317o\317K\204<\370^X\221,L\213\263\333"
+	.ascii	"s\260\352\232<-~f\313m\177\360\202\220\033j`\026\337C\227\276"
+	.ascii	"\002\322^TUY\234\327\354\220\275(>\213\263\222\317ai\351\303"
+	.ascii	"\221\355\002\205t\250#b\203jH*\307\030\022\304\224bH!\032\242"
+	.ascii	"m\3063\025@ PX\034\025K\307Ew\023\200C\013\254\344i\236'!Sd\206"
+	.ascii	"DD$IJR\3309A\257\240\337g\245\006\302j7T\020zl\231p"
+	.string	"\366\313\310p\362\347\366\264j^\310s\307H!\343{V\255\264\234\270\024A\305\0309\370;\344\231\020\233\001\n\264je##\375X\315\255\377\265\351\271A=\352ny\bvo\354\306\034-\013f\321Jbl6\215\r\244J$\302\237VWx:\023\271\b+\202\253\203PbH\227\022\255\214\325\370\224$\0318>\004,A\273\230\f\r\275\323|\303\320\005Q\004J\265ym\250Y\211=1\271{\375\335a\350'\203\363`8\344s\212\333nq\300\263\247|\362\024\035/Y}RE\376&/\302`^\250\370\377\225\312\314\303\312L\301\204\023`\202\r\235\001\273\206\031\006n\274\2455\312\021$iG\315\037\005\026\b)\366\326\214\020\315\226^D\227$\310\214\023\273\304\251\365\316LpJFB\367D\321\353M&>\251x\240+wl\264G\022\231\350\006\303\214\274\276G\211\"\222\341i\327\003\264. \260\205\300\333\350"
+	.ascii	"\372\200\245\234\\!\232\332\323@T\223\004\b\255a\300n\025]\350"
+	.ascii	"e\312\302\211\344H\376G\246\331\250J\372\322j\355x\026\331^\317"
+	.ascii	"\366#\n\327\310\346:\266\377\315\274\264\223\310\300\374\t\234"
+	.ascii	"\0053\302\226\270\2467\232y\017\205\315\222\334(\025_\024\376"
+	.ascii	"\276\235\361\300\313k\275e\240\347\002\211h\351\326\037\034\225"
+	.ascii	"\252\361\003\363\030\234z~M\205C\321\377\223\005kX\342\214\b"
+	.ascii	"4\002nk\202\217\271\373\275\277j<\2577\260\312\324\003B\023\256"
+	.ascii	" \237v\316%\2070\271T\024\377\227b\371\373}k\3566ZH\252\350\265"
+	.ascii	"\204\217\251Nr\215!\201\by5\325\206\200\036\212\354\226H\215"
+	.ascii	"\201>\244Jf\223\360\322bk(I\321\237\262\313\377Y\375\321\344"
+	.ascii	"\"akk\021\226e\214WBy_Y\201\330q\374\262\364\200\2670\236\264"
+	.ascii	"\302b\037S\217\303\305C\263\244!*\005@3f\230t\036K\272\202\\"
+	.ascii	"\216\217\3014\f\261\006\020\202x\\7b>\031\216B\037Y\221\340\366"
+	.ascii	"z\265\371\300\242\311`p\316\311'\001\237\264\034\013T\372 O<"
+	.ascii	"u\245\n\331d\265E\250\301&\273z\032\007\342j\375_\345\356dk\355"
+	.ascii	"\371\350FN\3313\376HT4\001\311\306V\n\344\036\304\331\214\\\347"
+	.ascii	"c\034T\334{q~\2420\211X\344\360Z\363'\353\271\376\005\020\306"
+	.ascii	"%\270\317\036\250\232\223zM\327\335\225\203S\213\315"
+	.string	"\002\302H\253\233\023f\206G\026\r\203\221\005H\202\b1\217\254\233Vo\357\334X\305\354\023\017\207\031\364\267b\362\230ur@\254\003Y\013\314\006\326<su\264\345f\240\212\303\005\275\tU\354\352\223\201'{\374\265c\215\372\2369L \362>r\261F\243\021\360\224\t\367\350\037\004N:*@\336\374\364\250\320|\361T\372\030\262\371\231\307Q\237\r-Y H1L\366\315\371D3c\353\207!\365\277\210\034S-<\302\350Q*Ip\030\025^q|R8\342\226\022\224\360\350C\260\246p\031\327Gb\210H\344\250\"\246E\265\367\203\330\367\02724\025`\036\364\270$Q\241jk\337!\361\206\272!l\277\264\354\302\255&\340\256W\325\036O\353z\b\226\312U!\214I\2139\312\306\004\353\302\220\265a\257\245\247\0324\037\227'Id\344qJ\211\326\013\325\b\255\301y\214\331\0051\205\371\262.A\311g\262\200"
+	.string	"\342\003\2131\023Vm\202\341\b\231\236\032\300\2220\3456\207j\rv\220\005\257\254K\006\352\214\240S\221\320(\272\315~\036d\226\244\270\253\\-\265<\032D(0\223\361L\273\344\f\037\003\327B\274\203\314\361_\031\330P\343>t`\017G&\360:W\3213\264T#\332\240\236'\262\322e\360\357\222\202]\270\374T\301\0040\301\201\231:\325\337B\270|\007\273\220\231\036\027\375\322~\223B|\250F\016\343\bH\367\033z;\260\204Z\215\221\322\212\204j\025\030\316\360\255o\262\033\035\371\026m\246\226s\214\334A1J\2019\351\260(\226\321b \257\032\304M\315\330aY}\003\356\336C\254,\354"
+	.string	"\255\305\t\222\264w5\246\321\266\300\005\304|O$>T?\033\376\0210\260\fL\254\201\337\233z\032\031\251\316\304\257\352\230\311\203#\337\307\034\340\216N\021<I\210\352\314\032\276Lm\310\375-1\357\360\\N\3652\306\240\306\211\244?\243\373\354\312$\231\313\2263K\302\3240\345L\031\034\205\364\275\301\375\366}\234\252?\210\0258a\251\366\201\023\021@\212\002\223Vt0\270\353\260\253\336\356T\361\007\024\317\272\3179\321\356\337w\024\334\255\320e\0364g9s\024>\230!"
+	.string	"$\217Ji\375\254\300!\242\237\257M<\322\3276U\037+\327%9'\221\306\210\030\007=\355\366}?\0069(\n\324b\213\301_f\227/\031\227w\373\016p\2241\377A\324\261\274\f\264\3361\221\025\260\032\001\202\013\246/\330\237\373&r\307\032X)\253\036z\334$\227\304lSN\"\227=Q\233(\201\337\210\257\305\200 Pr\001\213|\037\305\3167\372\210/A\322\224\260,\001L\367\225\307M'\263\016\300\2173\232\035v\274"
+	.string	"\317\002?\201\263(\031\225j$\377`\317\244/\254\006?\210\220\023\331\345\200cK\307i<m6\211{\b\232T\017\302\206\203\211\326\353\001 \024$\212B(\243OEk\327~\362\357\f\253\213\343\017B\206}]k\265\035\263\226\276\200^X^\002DKs9a[Rl\024\337\027\037\256\315\f\310\320\022j\003\232a\361\021\003\354\351\226\317\341z%\257pi\221\360d\001\253*d\026\254d\206KB'\366\2327\203\365\327\037\351\177r\313\315\017\f\341\026\024\373>\215!\3014\353\\\273,\341\001\2619\304\313\202a nre\237zy,EdEg\b\f1\377\246\332\314\006\240\016Qy\327\033\\\221m\032"
+	.string	"b\002\307M\003\245\314\357\320\344\237\277\240\241:\210\272?6\332\352\304\364\202\371\336\366\236\024_\203jV\r\034Y\202\024\253\275\340\033"
+	.ascii	"\326\374O\206\210\245l\337\327>P\263\232\240xoE*\027\272\243"
+	.ascii	"\364\016[\201\035Xf\b\f\210\211\361{@f\223\013\262\305\023\375"
+	.ascii	"\243\361R\322\200\361\024\305\003\367\233\330\004\217\220y`\300"
+	.ascii	"\246B&*\266\300\234e\0177\351\220\320\241\361\017\206M\200\252"
+	.ascii	"\"\020\363\240\372\005\243\371\237\377\255{\026\245g%\270\036"
+	.ascii	"\016\330\261\204 )\203\356\233\375/\324\2079\036T\r\024\237\322"
+	.ascii	"\336\315\227\025\334jL\021w\343\267\252\300\334TV\255\277\003"
+	.ascii	"\330T\273\342w\331\244\204\370\277\321\025M\256\201\007\002\241"
+	.ascii	"~-\002\337\300-\302\216:\347\350\371\236\253\373I\216\030o\264"
+	.ascii	"r\007v\347SBx\340\300\316\372\376A\377\241"
+	.string	"\202\334\216\304\323\023\337\177\200\350\262y\370EJ\347\354\343\277\374\322J\370L\310\322\374\352Zs\313$\006:\236B\251P?\374"
+	.string	"\312\344\363\304\276r\335+m\016\360o\350\361\260\314\261\353z%\323vw\025\r\207*,\356\263?\214YSD_R\266\325Tk\273\207c\300|\343\0268\332\026Ln\202d\233D\355\225i|,~c\304PQ\227\327\022\202*\276Me\f\366*I\026Az7\300\233\227\017\323\035@`\230^>"
+	.ascii	"\260\372;4\350\223\241*FK\t\260h\221\"a\307\214\344\3265\b\267"
+	.ascii	"\313O\007\253\337\220\315\352\200]\220a\253{\021WUz^v\223I\271"
+	.ascii	"\n\270\241\377\212\266\330-\021t\255V\276\223Kt\237T\026\321"
+	.ascii	"\352\276\233l.3\253\374KwO\371\210\315\270\225\323\215\2225|"
+	.ascii	"\232\276}\334\3407\001H\2426\267W\201\274\211\354\341\321\300"
+	.ascii	"\312\t\222t\2342\027^\026\030\212\016\232t\344\350\212;\266\255"
+	.ascii	"\355\023137\255T\031\213{\364(\353\370\3253\255\242\356\006B"
+	.ascii	"\377),P\025\370;\004\027\n\367C5\234\255bf\275\037<C\215\024"
+	.ascii	"\026\373=\3078\2244\013\244\274V\b,\270Z\332\206\364\322\376"
+	.ascii	"\272?i~M\373\f\372\362\213\221xV@\315\2572\246\256\002k0\253"
+	.ascii	"\250\232\241+\256\365t\317Q\375ptyos\335\302\366\021\2221\256"
+	.ascii	"M\003\241R\200\256\312\263\207\226\270\204\275\375\373)C^\362"
+	.ascii	"\304o\360\030\033al1\273\345\200$|w\\\007\272 \003\204\335j\344"
+	.ascii	"\b\016\261\331\236\266N\230\244\261L\266\365X\001\346\257\016"
+	.ascii	"c\021\324\026(\2150e\356\241J\347J\002\207.\004\241\313\nH\204"
+	.ascii	"&\243\311Y\026\322\206G\245\311\231\004 JZB\314r\352\262\213"
+	.ascii	"\006g\217\365\025\021\257\372\357\237\206\r\200}\257\210\204"
+	.ascii	"\177+\346{\035AB~\b\250\300\213 \rb\375w\265*\254\245\212d\265"
+	.ascii	"J\017q\315\366\335\323\272vd\351\270\370\301i\231Kf\256.\340"
+	.ascii	"'j\304\307\252C\302RJ!\377VD|\360\2055]\227\336\321o\027F\026"
+	.ascii	"\035\367\224`\242}\337\b\306),\341\021\007Z\214[\313\336g\021"
+	.ascii	"N\004\254\r\223-\354o=\357!j\0045w\204s@\276\177xie\337a8\313"
+	.ascii	"9\242\304\314o\267\375=\nG\227J\305\370\364\3547\224\202N\222"
+	.ascii	"\224\230\205o\364\026=\fM\314\310$v\214\013\033\004\364\354\265"
+	.ascii	"\321\320<\241\342\221\342\300a\345!$\351r\323\344e\356L\261\202"
+	.ascii	"\3144_\375\345\024\331P]\307\207\321 7\246/\013\035\337{[\370"
+	.ascii	"so\350\312\311\177~\214}V\312\342U\346\210\3331\223\307\336\375"
+	.ascii	"r\273\317\344^\277{\2128\267\322n\270t\272\310\361\202\336V:"
+	.ascii	"\307\313\227\230\376U\321gp_}\\fB\274\252~\356rn\332?^\363\n"
+	.ascii	"cY\003\364\311\030\331\324$fv\3113\265\336>\200\305\f\340\r\210"
+	.ascii	"?\346KG<N\276y\274\363\\[\277$x\360\326\265\325\247\234\267\225"
+	.ascii	"]\341\337\t\375\273\r\363ca/\3674B\241\337\264`\001\315\205;"
+	.ascii	">\300?2\3734Ie\254\2745\305\333w\234\025\334\313\276C\331#h#"
+	.ascii	"\245\323_\177\232\315\2374g\244]\213x2K\361UdN\371\372\340\373"
+	.ascii	":\335\235\303q\021=O\372bp\330Q\255m\002])[@\313\247E?\303s\b"
+	.ascii	"\325\356W\315\020(\3752\232Cs\375\201|^\341L\335\333\216\247"
+	.ascii	"\226w'_\231v6\356\303\337\267\374mW\177O\204\237\334\177\327"
+	.ascii	"|+\311\367\027\374H|\235\341\363\b\370k\334\311\326\017\222\274"
+	.ascii	"\361<<\362?\004\3532\277\212p\016\263Kp\363\333\320\027\330|"
+	.ascii	"uz\3017?\366\363\302\377\310\365\235\276K6{\354\307T\016\223"
+	.ascii	"\2729\322Sm\363\212\352\225\363\243\316\231\347\177\363\032i"
+	.ascii	"\267\303\b\346\200\002\243V\337\330`@|v\211\271\\Hoi\352\325"
+	.ascii	"\217\260ri\356\277\375W\274\336L}\364`\3571\222\032\226\337k"
+	.ascii	"\350\273\002"
+	.text
+	.section	.gnu.lto_.symtab.303b4bd02665f98,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"accResetFlightDynamicsTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.303b4bd02665f98,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
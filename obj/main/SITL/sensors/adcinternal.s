@@ -0,0 +1,160 @@
+	.file	"adcinternal.c"
+	.section	.gnu.lto_.profile.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\356\346\366\357\t"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.a4e5fa940f79f1e4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getVrefMv.3.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \332%\006"
+	.string	"B\313*1pM\322\001\240\253pq\r\013\237\363\312\220\355\202m\001\354\016\003\373\272\331\343\350\355\224\3350\003I\202\377\377\253r\330\207EbE\244\236lB\366N)\246$\205\311\301\252\342(T\302\244\021\276\350\252\250\2162-(\005\243J\006~\f\025\324\312{P\243\271g\232\201\222\313V\340\300\036\354yY\254\302\276\263Lc/\b\204\204`\263\033\2619\331\221\347\003\303\266\305\216|\215oX,\327\274\220h\035!\020\036&\273S\001.\320\376\254\007\264?\314\342\362K\372\347\270\223A!\202\311\\\276 \204\335\365\302d&nv\333\007\266\325vC\b"
+	.ascii	"2\003\356\231\301\300\341\273\206O#Z\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a4e5fa940f79f1e4,"e",@progbits
+	.string	"(\265/\375`\342\001\305\022"
+	.string	"\226\345\204J\340\2608\0350\201\277\240\316d\2075\340\315D\256`\250\026\243\230\360\307\370\030\260\256c>\245\342\\\235\274p#\023\022\245y(\304\0312\213y2M\\\004\310\004\212\030\202\370\227\212\263\322g=\216=p1\277\377\201\202\260\337\244\fh"
+	.string	"k"
+	.string	"n"
+	.ascii	"3\351?\343\272\360\223\214\327\366\021m\033cb\207\275~\004\277"
+	.ascii	"\277\371\217}\333\377\361?\307\031\273\277\b\221\225\231\346"
+	.ascii	"\337b\300|l\334y\375\\\016\f\035\324\2560)\270S[eW\271c[Xz\331"
+	.ascii	"y\324\323[\307\331a\377\233\206'CA\314\340@+s\233\314\\c\346"
+	.ascii	"ff\026\314\314\335n\267\0333\217\230\031e\346>\002*\372\323X"
+	.ascii	"\276\306\374\373\252\376ez\216\374=*z\251\242\336%e\330\233\236"
+	.ascii	"\337/"
+	.string	"y\276L\307\276z\332\034r\374\354\252\216\237\275*\372\362c\333\222v[\246\350Gs\325\323\256$*\262\253\212\312P\270h\361a\313\257\2301\362\024\331\354M\317\363w\316\353'\310\037KO\036\222\245u\\\266\025\227\n2\355\373\377\200\351\202I_\332l\3345\346\005%}\242\343\257\371\237 \200\314\354\365\302\201\372\366\254oHM\343\306\351\225C\344\275\036\234\314\215\0248\034H\324\005:\256\tt<\301\343&u\237\333\255I\035\233`\f\264\277\204A\217I\036sw'\317\377\037B\367\247\253\243\353Pw\b\363\200\3764\b3\203\376a\217\373\221\246\307#\261\202t\341@\347\224\237D\177\177~\237\2075\374\301\253\224P,\265V+\261$\240E\301\004\266T\251\r\036\203`\203Q\004\b\016<\224H\206\023\225\030\266T)T\205\223\022K\\\261T!\253\244J\235h(\241DVId\304\341\201\205P\224\320\nQ"
+	.string	"0*%\206\252\020\305c\022\223\002\223I\007\01669\215\234F:69\201\340\311\004zl\002?\314]\242k\270mn\332\246k=r\327\213\027\006\263\036\225\0206\336\022\013\t\245.\260\0305\002\030"
+	.string	"\270\0208j\207\214\351\354\364u\313f\235\2011\024d)\215@IQ3\322"
+	.ascii	"E\005\201g!Z\343hkXj\r\247` \251i\214\320CE-\331\241\273\227"
+	.ascii	"\302\346\2466\256=W\314t\306['\031"
+	.text
+	.section	.gnu.lto_.symtab.a4e5fa940f79f1e4,"e",@progbits
+	.string	"getVrefMv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a4e5fa940f79f1e4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,744 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.string	""
+	.string	"\021"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"%\007"
+	.string	"\324\t`\001"
+	.string	"\032"
+	.string	"\232\254\262\203\n\022\002"
+	.string	"\002\001\002\002"
+	.string	"\001\366\202\312\372\003\002\002\003\002\003\002\240\342\234\212\n\003\004\352\263\360\321\b\005\374\360\211\206\006\024\002\004\002\005\006\002\005\002\007\b\002\b\002\002\002\005\006\007\b\t\n\013\274\205\242\255\006"
+	.string	"\f\267\335\335\337\n"
+	.string	"\r\200\333\377\224\002\016\017\265\372\210\203\002\002\020\350\300\306\254\005\021\317\316\276\351\002\n\022\337\357\351\224\f\020\007\005\002\002\002\t\005\023\024\025\200\225\223\200\006\024\002\007\002\007\026\364\201\355\242\016\027\030\330\314\343U\031\240\342\234\212\n"
+	.string	"\036"
+	.string	"D\020\b\214\313\241"
+	.string	"\265\314cwah\006K\220\214S\020\266\230\263T\255\305\221!a\004\3128s\261\346JX\212\2240\270\273\240IJ\216\b\307@\023^\t\274\"CN\364\335-)m"
+	.ascii	"J\330eU\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375 g}\002"
+	.string	"T\003["
+	.string	"\013"
+	.string	"\001\001\001\001\003"
+	.string	""
+	.string	""
+	.string	"\002\002\005"
+	.string	"\001\013"
+	.string	"\001\f\002"
+	.string	"\020"
+	.string	"\007\r"
+	.string	"\003\017\001\020"
+	.string	"\003\021"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\022"
+	.string	""
+	.string	""
+	.string	"\025"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"R\311\007\247\225\352\313\355\245\271\210\262\002M1*\201_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`\031\001e\007"
+	.string	"\342\t$/`U\223\016\300C>|\250\334\263\362\020\234\245\030 \f\b\307O0\274\245\"\303\030ff\320A\202aj\013C"
+	.string	"\013k\273\265U\024\266F\273\245\377[\370eG`Ra\200y9\370\200\264\025\377\026\022P2\003\215\374\370E\013\007\023Z\214x*\r\022\020"
+	.string	"\016\2223\314\221\\\224\276\244n\332\252 m#\037\247>\2330/\361\310M[\355i\013\337\222\256\"\227}.=m\013`\006\264\315\216\316.^\337\245\246\255!?\362\262\240m\365\324i\005) \300\242\n\316v\250\00604\b\004\315K\201\301\f"
+	.string	"NBl\237\235\007\023\004\220\221)\020!\233g5H\021\3171\255\261\\d\322aB\360\032\007\362\202\246("
+	.ascii	"<C[\030\270\345p\316\333XQ\317\307\212Y\322r\313\260\307n\355"
+	.ascii	"\324\035\271\362\274\244\253dH\030Eq\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"}\005"
+	.string	"\262H\035(\200EI\007`V\241\311\220\263z\3111H\241\360#\352\035\270p\370\223\310\305\202\\E\202\026\375\366_{x\355o\"e\nK\377\031b"
+	.string	"*\224\352\025\327\025 \251\252\b\242\027\375\320\027$\302?\207n\350\223\035\2743\265\250\f\002\225\335\324\030]4\034'X\373\201\333=ew\343\274\220\026^#\325\220TS\376\350Y\363,\356\224UP\226$\333\030\2713'\001\026"
+	.string	"F\271\207\213\007\201QiY\323rP\321\276!\270\277\021X\3164\240\\\255\n\022\224\300^i|\324ffr$)>F\r|u\201Lb\240\"Lx\242R"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\232\004\001\230\004\005\230\004\013\200\004\f\200\004\r\204"
+	.ascii	"\004\017\230\004\020\204\004\021\230\004\022\230\004\025\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\375\004"
+	.string	"\222\006\023\033\220)\351\363\273\273\273\273\273\333t\3761D\364?A\331\310\300\021Ya\177K2\005z)\343\251"
+	.ascii	"\020\253=\177\320D\303\n?ay.\237\021\235y\232]\355\026;\305\210"
+	.ascii	"\347\003\211\207PJ\243\304G\235\006:\247\253<\005\216i\\#$ P"
+	.ascii	"\002Bgw\245\207\202\b4\326\255\207)&\250l\272\341\305b\032\026"
+	.ascii	"\320\245\003\257.\273\030\370\300\245\312t\313`\372\364;Y\300"
+	.ascii	"!\263\b6\330\303NY\326\020\345N\250j\002j\306\211s\"\302\212"
+	.ascii	"\201\001\300\300\301\303%\323\372^]E\003C"
+	.text
+	.section	.gnu.lto_.lto.df9ce9c53d0da41d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.14.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375 \231e\004"
+	.string	"\344\007`"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\275\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\304\007us\350\326\006uq"
+	.string	"\005\001\006'\001\f\246 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.15.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`_\001\005\f"
+	.string	"v\024NC\020\251l\341\200\303\032\036/\236\200.-\367\340;\274\346s\307?\343\357 5,\341]\n\021\024A\366\276\255\361\323#F\217\372d\367\030~\001"
+	.string	"\246\t\203\013\241\240\344\003(\212\300yUQ\305\343(\310N)6"
+	.string	"9"
+	.string	"A"
+	.string	"\273\352\204=\231\207V\337\021\037f\336 >tjC\200 \341\360T\266uwG\020\345\351\277\324\177\355\232U\013\365\017c\261\273\376V\255\222\033\274m\t\333\025\366s\001\017\375\223\3700\004\260\272f\023R_\317VQ\037xb\377\262\273k\360e\237\366\177\034\260\202J\300C\204]V\217\267\2670\201\312\306\366?\373\263\257\244\247\235\316\260\373zp \013p;\231\350\n$\350\f\334\3568\002\234N\346\321\013\2401\n/O"
+	.string	"\315`\301\\3\214\203\217\017\320\230\004\220]\032\334$\332\347m&\215\332\3329*\332 oA3\273K\341\263\204\2108\300R\002!\021\007\251\274X0\310c\222%rT\232\237\215\3614\313\223D\236#I\364\031\215 \363\034=\021.=Hs,\225\2459n\324\375e\301\2271r\267\0248b\237\024m\320\031\220\261\335\032z\035"
+	.ascii	"\205YE&\236\026\215\006\027X@\035\200\035\370\016\251\315\301"
+	.ascii	"oN\3106\370\001\355&\025H\024(\002\262;\264y\251\324\3400h\207"
+	.ascii	"R\224$%x\244r\200z\r\310\330f0\357\022@\263\232\022\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_baroPreInit.27.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375 \304M\005"
+	.string	"\222\t$-pU\323\001"
+	.string	"m`\375v,`\307W]\270E\375\217\033d\3036o\0309\365;</\232\377\377\376\345\224\375g\250\007!\267vo\231\002\247\244\031\257X\31191\230NI\255H\331rL\025S\223\262d\270|\304\311\227\224\223#\256\027n\007\b\214\374\034\366\240\345\337@\303\355\177\005\216'\001\352\236\004"
+	.string	"tG\260\311\374\337\350\365\377,\207\351\355*\222.\324\335\f/[\367\325\357j\226\220i\330\276\301\242\273\3772\215\262\207\373\037\361_\361\277\021\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_baroDetect.29.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\365\007"
+	.string	"r\01776P\215\322\001dVDS\023\260\251\234mQ\002 \312\356\355T\354\301H\036\b\201r\305\355\036\367ff\333\004\220P\026q\225n\226\225 K\260\257\031\310\340\266{\247\024\2216H\2068/\t\316\274\026.\021\221\343\274\311\314\370\211\0359/\007H\247\244\236H\241\347\341\352\300\315\2440\203\261\204\210\023~\244\234\320R-\236U\315\201\354\nj\216d\277\262\273k7\262o\372\357\256qB\241\030\244vC\251\224=y%\036\2661\333b\333\325\213`7M8`w\303Dc\375\025TZ\263\017\362\020\354%\212_vG\037\247\335z\340\214\365\347z\202\352\317\372@\365g\333\032\004\314\331kG\350\244\322\005\tj\267B\307\361\354-\363\005D\025o"
+	.string	"\t\273\353\206!\312\270\335mcl+\330\036\t\f"
+	.ascii	"A3\240\314\200`\330\250\260]\205#\327\224\213\211\030\204\317"
+	.ascii	"\324(\270,ij\342\275\212\023"
+	.text
+	.section	.gnu.lto_isBaroCalibrationComplete.30.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375 \375\345\006"
+	.string	"2\r04`m\322\001@_\002\234\374Lp\244fU\260\356\352\200(*\355l\013\350\326\320\261\003\315\036\213\205\324\205E\024\035\037\343\247&\230;P\256>\232\020\"eJ\001\266P^\313\264\213{\225\005\006\237\203\230\006\031\206\241ra\226\007\031e\300\256\241=\226q\356\261I\334\353H\225\300\243\037\373\232\352\252z\020\351s\215oh\374\013;l\362\327)\177S\235\272\006@x\262d\307N\352\204\375iud;\255\231\376$"
+	.string	"\"\242\320\261\033*\225l\bE\302\260\315\261'>@\340\330z\254\b\335B\002\304A\262\033\231R\334zZ\3763>\215x|\\\242\316\023 aw\235\227\350\341\326\333.\260m`;\"\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_baroSetCalibrationCycles.31.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"u\b"
+	.string	"\346\320=7Po\322\001 [\374\252\262m\301\002\025A\317AKw\022\205z\252o\313rk(\331\035Y\026q\3335\277\225X\324=\256\210\030\302()\017\221bv\315\310&{\247\024,"
+	.string	"."
+	.string	"-"
+	.string	"/\270\036\315\331.\3578\366&\250\212\022\230\335\225p\343\334\037\347_\344\002%\323\350\017`aw\375J\246\213\033\336v\202\355\006\333\037\001\360d?\365?\213`\245\305\341e\327b\025\263\252\210\322a\373\031\333\357\331\007y\b\367\224\310q7C\345d\267S\260&\340q\340\006\327\343\013\264\312L\267\267\026\236\274aQ\221 \205\037\364GN\"\362Q\236\b\275\227\036\375\320\365\030O)\036\030\244\267\262\273\321\203\032\366\255\335]\007\017\263j\022\021s\263\315N\026b\370P\r\204U\216\326\301\262\003g\232:A\323C+\306\221[\245\333gn\362\243a\036\231\325Mj\020L!f\225 \032\007"
+	.ascii	"2\241}/pq\241\304ehb5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_applyBarometerFilters.33.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`i\001\265\016"
+	.string	"v\233bD"
+	.string	"\261&\0358ne\310G\355HDf\365o\025H>\2261\256\245\246\371\310jR\006\372\330~\261c#\325\230\236F\304\2064\337\333[#\370N=\341D\301\374\377\n\342\245o\252\371\366\371\"\223O\366\3362\245L"
+	.string	"M"
+	.string	"O"
+	.string	"\366`\227\266}\227\2178\361)~\036T\035\025\\(\314\334\354n\326\271\201\3532\336\343\272\204\035~z\204z\3629>bK\n\027\236\252{\324p(@\225\212\235\335=\314\325\202\nE\225\343cw\255\236*\303-o[\201\355\020\3732\001PEl\250\251\301\232"
+	.string	";\373\353\024\256\330\217\013U\354\1777\366\227_F\265B\3659O\371nf,\200\261{\241ucm\344\352\303\277\337>\361a\314\261\375I\300:\f\030M\f\022\254\335Epi\020\375\313\311"
+	.string	"v9\264\250\331\335\004\001\2272\304\213\026\032(m\351\356v\320t)\034\221\221\221R\033\366\320\307|\205\n;x\240\367\024\006X\265lR\2603\001=\212y\3424\037\320\234!\221\336\303`\247C%|\314M\224\260]\324=\277\304gF>\313\245\265\222\364K\027g\242\367\0363\364\331f\004\020\222\001!\222\b\302g2\230\233\t\307\315-\3044I\005\f\362l\263d\216\264\3553\222q\233\306\221&\227\221D\237Q\006\332\270\314s\300\032\311\334\262\022M\3332\316\267\217\013U0XJ\001Q\203\205\202(\021\256\334t\371\253\2630\371,n \"r\005\035"
+	.ascii	"\301\314\2142\246\223\311\260\204\026\331\337\016Ym\315\231\244"
+	.ascii	"\3200\264\265\006-\001\200!Z\325\001\330\006H\006\003A\262\254"
+	.ascii	":\346\325f\231}\006o]\027F\217\3154\317X\251(b\205\312R\374\314"
+	.ascii	"\006\251!\213*\267]E\017"
+	.text
+	.section	.gnu.lto_isBaroReady.34.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016$!#\302\2114\242\350\232p\025 \270\265\346\202\177Kv\325\376\335\016\2736B\251\203\367\346\230\231!r\272Ho\234\350L\035\032\323,\3312\005g.o\342L\032\3670\013\215z\216\332LT\3330`4-\363\250v\031\3305L\257q\234{\315re\331\b\031\001\210=|9\332Q]\214\035:X\253\322\355"
+	.string	"TB&0\001\302\224\277>\310(\276\225d\243\037Gf R\022\224\314P\312I\216H \031\277\347-#$x\256zY\204z\021\002\341a\222y5V\321\252X\335n\264\242\361Qb\211>\305"
+	.string	"\205\314\034-\221Dg\375\013\376\203?\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.35.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`\033\002\265\020"
+	.string	"\266\235kG\320\224M:R\006\203\032"
+	.string	"\006,\226Q\254a\216\335U^\233I\247\264D\340d\226\b\262\247N\013\302\032Sk;\017kd\220dwj}+\371\006wu\341\225\030\210I\311T\t\223E\225+\271J*\322{o)S\nT"
+	.string	"O"
+	.string	"`"
+	.ascii	"z{\306\326\374\025g1\343\025\204\275>\0314\253\001:\232\023\266"
+	.ascii	"\0358\212|\204' \037\367\304W\217pu\345\007\370X\217%6\207\357"
+	.ascii	"9<\212\325\360>\233/D1*\301C\373\\p\301\215\216\020&\037\215"
+	.ascii	"*I\313\234\323\352}\037ny\333\021l3\260\025DB@\214H\354\346\\"
+	.ascii	"\203\374>\330\341R\"\366[\034\306\371:\336\020\243\367\036\375"
+	.ascii	"\030\371\370}\317U\026\204GDK\223l\030K7\307>\234sN\257\t\333"
+	.ascii	"j\315j)\3251\252!T/T\353\252o\222\222\302\bBl\316\016IH\263("
+	.ascii	"\016\241\320\222FT\201t\364\203\310ee\b\225@h-<6\003u2\223\261"
+	.ascii	"\033eH<\003\364>\217\341\2422\233\263u\017\006\n\301+H\327\016"
+	.ascii	"p\\\313\262]\372\013S\212}\272\013\324\311l\316\331\340\347@"
+	.ascii	"/\276\316\2431\244R\362Q7\312\204\f\361iiR\217\222\327\3640\347"
+	.ascii	"T \200(G\021K\215h6\261t'\231S\212\353J\0276U\307\251`N\252\r"
+	.ascii	"\346\245\224\332L\235jcY1\227\341\324m2\034\327m\032l\036\302"
+	.ascii	"\b\300\307\210\235\325V.\007\333r\335\322Z\232X@m\t\023\364^"
+	.ascii	"\334]\026N\221\357x7E\320p\265}\315\021\n\307QA\345u\003e\340"
+	.ascii	"e\203\344\307\310\317\005- \260\202\231)\242\007\277\002\342"
+	.ascii	"a$\022\316>\341\276o\205m\253\343\025\\gX]\271\305\362\240G\221"
+	.ascii	"\320\355\306\341\275vH\036zpypM\031\356i\334\235u;M\332\226\266"
+	.ascii	"\335^\262\320\213:\220\266KC\257S'\313\225p\343\212\027p\n\\"
+	.ascii	"\305\032\037F`\bLs\004\030\331\330\225S{\360\230\321\264\007"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.36.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`\332\003}\031"
+	.string	"f0\245E\260\230Qc\360\021\361\320\342\334l<C\205\225\020\311_\007\200\261\2166\317\372\246\365\177`>)\330\3306\013\264\r\354\254\341\017\327\013X\026\332{:\244\316\241\262\b\204\225\013o\016E\036\354\313\253\023\275\267L2\245\215"
+	.string	"\204"
+	.string	"\224"
+	.ascii	"I\346$\252\3322\245@!0\234d\267\256s\230\251e\325\203\227\372"
+	.ascii	"\242'\032sN\226\301\326C\3132\350\366C\255T\226\223p\253 \021"
+	.ascii	"\253\035.PP\3159\t\030,\317\312`m\3037>\024'\227X\370B\027&\206"
+	.ascii	"\232\260\3149g2\303B\203\3226\241\301\2570\316\240|\304\325V"
+	.ascii	"\262\004bdG\317\027d\260\3102\306W\344\313\001TA\256\270|;\t"
+	.ascii	"#z\321\263\222c\b\237.\306\027\004s\316\306\236o\204\033\272"
+	.ascii	"m\204\266\006Z\211 \240\337*z\312b\026Z\250\200\374\277Z\270"
+	.ascii	"s+\371\305\004%\210\n\223'\273\250\245\265\0167\325\352\243\332"
+	.ascii	":D\367\f\326\035B\203;7\223c\215\237Q\n\034$r\261\252]\322\305"
+	.ascii	"\377Z\313y\243\266\261\2610vG\307In\316cq\300X\230\214\275\221"
+	.ascii	"\26162\266F\306\276d,\215\214\235\221\261.\031\333z\254L\030"
+	.ascii	"\313\222\2611\217\205y\354\n\214}\221\261\241\214\005e\254\224"
+	.ascii	"\261\227\261\361\261\226\341LQ\322\023&\322\300\301"
+	.string	"\203\007\241A\326\375\324\002\3461?\227B0\024n5\347,P\017\361S\204\372\310`%\364\364\204\006a\316\372AeIZ=\347:7\017I\027d\302\352 T\t\022/\317y\2142\324\345\025\303\267\024|B\367^.\333\r\031\315\340\t\037\271\360d\310\327\311s\316\b^N\361\220\\\261Nf\222r\244b\313\337\322.D\367\344eB\017j\235\374\363\221\233\263\007\252\252\244vs\346\002\304\377\322\nO\206.V\325\2177\217\312<\334\003\207!C\206\320\001\034j@\024\2004$\260\335|\024\260j\201\347F\003\242\325l7\237\n\263\237\233\355g\003\355g\266\001\203Omf\341\3663\343\211\325\306\201v\233\001\331l\267\031k)\347\306.\313]\327&\270\325T\354\240\320\221\032I \0013Y\002NE\321\250\022\243\204\210b\310\342\\\n\347r\222\304\275)\260\343<Z\271\201\331|\3467\177\023/E\315ins"
+	.string	"\257\232\307\270\360\220t\255\277.\340\207\316i\2563\245\003qBJ\212\3533\255\307\334u\313\274\365\020\t\217\212u\231{\250\313\002\027a\260\232sW\240\216\nC\250!<\344\214\201\314\031\222I\213\232B\213\001\220\002\031\301\232\007\0210\265\204pHAmm\006\022b\031T\216]\035\350\363\327\236f\226"
+	.ascii	"\r\341\177\352\367J)C\327N\314\360q\344\316\0303j\307xgS)\355"
+	.ascii	"\343A\017\030T\204=\\\217\017hD:\314\313]\375\225\036\325\353"
+	.ascii	"\312\303\354\013h,=&{\323p?\242\3016{\315YvcF\2415d\237\240V"
+	.ascii	"\2402S\247\220\342\364\025*uxz\314%\215\267?\243\377\354`\252"
+	.ascii	"\020\n\324`\n\354\367\276\251a,5"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.37.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`\177\002\325\022"
+	.string	"6\341sF\360\320&\035\220\276\375i\366_\037\244\211\345Z\333v\347\330g{p\372\243\025\006\254\230\361\330\357T\250\216|\355\213\354\037\024\225<\237\201\337\3523\371\f<\367\034\246\261\246\301\205Gx\375\2335\262f\t\331;I\231\002`"
+	.string	"R"
+	.string	"e"
+	.string	"\337\365\356Z\005\004\210\331a\3203\247\2050h\276$\316\007]\265U\363\211\355\2434\035\246\332\314\250\264n\3149\267s\320\023\225\361{b\325\031\025\201+\024\225,\0323\2209\347h\305\242\217\007X:\027L\253\224\b`g\303\f\235\321\255\260R\355f sN/\270ZQcj[\201m\004\366\376\004\022\006\206\275\376\177\353c\2516\264\004u\016\246\337\353'\243R\023z\"\202\025\306(\223UP\245\325\004S\251\327x^"
+	.ascii	"\265\2446\264iP\366/\266\306y\027;\256=\342\272c\327\246]\227"
+	.ascii	"vM\372Z\373z\364\265\350\353\320\327\331\256\261]\313]\307]\007"
+	.ascii	"\246\213V\224\236\265x\200ZH6\r\264\223\\\2446Tq\021\361\241"
+	.ascii	"}@\216/Ft\273t\316\271\243\307\326\007B[\2734\205\017L\206\240"
+	.ascii	"\320\355\007#\253\240\350\005(\034\305v\351\213\212\324\234N"
+	.ascii	"\020\206\257\2249S\006\262\207\256_\f\366\3541\347\243\021\222"
+	.ascii	"\307\216\255\350\270>\031\371\032\005k\304\377\362\372\261Pt"
+	.ascii	"\001\026\371\360\270\022n\244\363N!\033\312\353P$\034j#qp\032"
+	.ascii	"\331D<\324\366A\300\035\004\316\333J\272\316\3334\232\251q\336"
+	.ascii	"\305\013B\274RW\311\322[\224\350\204\036g\3610\324\023\326q\217"
+	.ascii	"\234\216\313\021=%Z\366\306\306\216\206\250'\314z\2438'\021\216"
+	.ascii	"\303T\312V\f\022?\352\001d\275\376\027\233^zH\215\214\224\305"
+	.ascii	"\341\232\020= \220\002\221A\263\rcB\357K\f\006\t\265${\353\033"
+	.ascii	"Y\331\314\270\353\2461\310\226\f8\221OS\006i\f\262\256\234\233"
+	.ascii	"H\261\317\251\200I%\037\323M\034\302?6Mp\343|\r\\o<\266\204\335"
+	.ascii	"\215Y\020Sn\364\037\204-\214\344\026\262\f[V\"fr\320\311JW\240"
+	.ascii	"\330F'\002\004\021aB\230\t4\021\250\200\205\263[[\031\tw|\013"
+	.ascii	"\343\333x\250\007K^\304\307\250)\211\215\277\301\0063w\233\354"
+	.ascii	"\247\211="
+	.text
+	.section	.gnu.lto_baroUpdate.part.0.46.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`\017\003\245\023"
+	.string	"\306\341wH\320\362&\035J\215ns\273P\252V\221\037_\354\357\r\nG\366c\003\341|\306\220?\271\007PF\016>m\204f\216f3\016\206RmF$w6$\311\205\240\221\306).~LY4\n\220%5Ck\t\331[\312\224\002\\"
+	.string	"]"
+	.string	"p"
+	.ascii	"j]\365ILTx\346\354\0205d\366H$\021\366i4\366\312\256\261W\227"
+	.ascii	"B49\266\375\240\227\2501\030k2\035\316\350\206c{\232\263\346"
+	.ascii	"]\026\270\tw\031O\302]n\210\203_\215\240\257\241\216\315\367"
+	.ascii	"\264\307'\246\036\241\216\207\353\310c\3072\347t\352\303-o;\201"
+	.ascii	"\355\003\366\362\004\241\321+E\206b\255\240'\303\332\330\206"
+	.ascii	"y\221+\200]\341\266W\311m\316\211\340\304\211,\370@\227\216\371"
+	.ascii	"\364\341\245\377q\227_\231\0245\033\272\321(\023\266ix\244d3"
+	.ascii	"g\366L\003\227\247\375\034\\\bi\262Q\"\272?\336\3708\327\307"
+	.ascii	"\356\324\252N\235\342\324\235Ts"
+	.string	"R-\245:F\365nE$\200p\233cA<\n\235\b(\203\006\372\220\333\224%\020Mrm\007\307q\303\206\\\325\217m\266\023\327~\360\032.%4\036:\315p\361\201\374\302\212\333\005!\202\332\021 #\006\204\327\016\203\225:\323_\270\274\260X\334\245WC\204/IPJ\332\225JD3\244\026J\213\227\n\013\235\360\025G\257\222\233\n\205\002\240\257=E\353\3446\347\315\003\206Y\201\271f\\1\037\254E\301\213\301\276\230\214+\346\311\274Z1\036\f,\346\255\240\370\273\340\202y3\337\007\363V\266\365q\256\217O\373\210\246V\265\033l\253\326,7\213\301\3738\347\234\273?\266\273M\355q\212\030\234\335\t\f:\221\375x\r\220\371\350\266\263\025A\r\201B\234\257\343;@!\220\326\322\302]\312\021\001H\250qL\304\024RJHd\202\244$\205\034\340\002\221\232\352\006\021p\255T\024X\005U\373\006\204\235|"
+	.ascii	"\022\372AI\306\257tr\243\r>$\021\306\2701\036d\320r\210h8\357"
+	.ascii	"\002\223\352\035\203,\317\274\270 \320\r\335\376X\354K\261z\226"
+	.ascii	"\336\356 $\364\270\253\031\346k\311\003\276\2030\221\370\220"
+	.ascii	"\323\007\324i\341\226\001\035\207\254\267\211ev\232\t]\235\261"
+	.ascii	"\247\005\361\352\034\266\345'\375\323\315\202\032\207Ux\255s"
+	.ascii	"v\220\013\347\013uG\231\322\363D\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`\275\001E\n"
+	.ascii	"R\21677P\217:D0A5t\n\357H\250\276Az\3062\207\311\331J6B\231\016"
+	.ascii	"\266\377ff\210\260a\301\327\202VZ\211-I\333{\013\356\207\376"
+	.ascii	"\0048\226\202l\"I\246\024z\265:\274\271F2\214\267\265K\342\322"
+	.ascii	"\222\242a\274aT\tYD\344\226|\204\254\264\344\r\223\r\033\223"
+	.ascii	"\231\333\\\201\260<\341Y\356\022\226%\374\024\341(\b'=xi\377"
+	.ascii	"_u{qp\3236\004\264*\307J#\343Be\261\242Pax\272\237\007\303\246"
+	.ascii	"\371\027R^A+\270(\2464\215\"\350\223w&\017\305\222\203H\276\305"
+	.ascii	"\321@\213\\\353<{V\310=\240\321\247\323\030&ek\007\007\200\373"
+	.ascii	"9?\220s/n\234\346\240Yu\277\0270hU\275~\316\0075\377\314\023"
+	.ascii	"\226\252\253\242\200,\346\377?sNT\325\b\0060 \340\002\241\251"
+	.ascii	"\252\003\226\3461\033\263\306\026\tB\255\254\354)\027\301\007"
+	.ascii	"a\220\fR\030$j\030\352\0018\002\034~\200\224\312\245\246R0\226"
+	.ascii	"_\313\301\f\256)s\305\323\254&\036\254a\214\036\263\217\200\016"
+	.ascii	"\337\0136=\244;\f\246\263\276\240g\\\016\3703\220\261\"\217\003"
+	.ascii	"\227\2446\360\254\0029d\006N\031\323\033\355u\306"
+	.text
+	.section	.gnu.lto_.refs.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375 \325E\004"
+	.string	"\362\213\036\037\240%I\007\377\377\377\377\377\377\377\243\371\377\363\277%\266\265f\033i\256\021B\210l\204l\231\002\177\001\227\034@\271\0258aqd\375\261\270Qx\326~!\274\215\233\364l\023\324\004\375\201r\201r\226|\321'\220/\351\003\235\372H\361S\252\007g\232\r2\316u\301Y\177)^$N\224+\364\251\034\235?\350>\347n\177\350m\372\245\367\365a=\030^\312}\345\346\035\315_\020\003"
+	.ascii	"S\203\277\004\301,l1\003"
+	.text
+	.section	.gnu.lto_.decls.df9ce9c53d0da41d,"e",@progbits
+	.string	"(\265/\375`\\'\215\262"
+	.string	"\252\032Q>W \314,\244t\302\337Qh\305Z\302\253\217\207R="
+	.string	"\034|8\344C;\322k\\\205\305A\217\342!\007,\274\261}O"
+	.string	"\337\032al\206z?v/1\373{\231\027"
+	.ascii	"\034\213\202\355j\306\260\n\001\202\301\023\315@\334d\307\306"
+	.ascii	"\312\"\354\332\3535\207\343\213\366\367\3362\005K\003\347\003"
+	.ascii	"\344\0036\207RL\216s\307%\312\314\t*\217\232\243\207\rF~\363"
+	.ascii	"\202o\315\360m\030\276\355\302\267X\025G\020\030\363\t\223zo"
+	.ascii	"\207\340j\243\336\350g\205\372\365Z:\177,\022\n\215L\003/H\003"
+	.ascii	"\357\266\007\356l\245p\017Y'|\253\304Bu\370u\016cP\203k\0136"
+	.ascii	"H\270\2267\306\340\327/\270\303\026|\235au\f\277>\301w6\005^"
+	.ascii	"\303\3518\375\274\226\226\363\236\353\262\357$\235\371+\347\034"
+	.ascii	"\324C\270"
+	.string	"\034\207(\301#\350\364\265\360^\207\340[\366v\323\246I\027\335\233z\333\260!\302,RD\356\315'\347\013\027f\024qR\357\333t\334\377\035\0367OB\336\304\255\351\2661f\346\352}\366\232\206s\346\234\033\f\211\\\242R\343\246\343dKUX\275\355V\233\204~{\273u\233O\262\335n\316\310n\013\200\272-\330i9\0012\n\357\276\346\300\177\263e\300I,U\266\352\375;M\257U\272*\246V\275h\206t\304\316\340\250\324\373\352\002\277\237\234\211\201\273\202\345K\231Y\213\201\3510-\246\311\264\231>\323c\032\255\323\372\331e\332\313\373K\203yu\346\234\3149\277\307\310\316\234Yz\213\227&\006]Z\f\310\346\314\203\254\0316\245\305:-\n\002M\320z\253\3134\224\006\3534!\022\330\n\003\227\263\363\037~\243\337\303\207.\323\\Z\354\302R\316<v\004`\t\315X\ts9;\211\210\210\206\210z\340"
+	.string	"\371\262D\301}\223\341\247u\005\236Os\341w\023\277\227X\313\205B\373qU\357;\n\277c\340\227"
+	.string	"\017\215"
+	.string	"c\370"
+	.string	"\326@\245\253\364\263\202\266r\017\037n\217^y\353g\216\326\2348\365>\004\374\256\200\327u]\001\357\034\340\016]\201\327^\035\245\237\031Z\312\273\253\235\337!\235\331\231\2633\250\026\241\233\022\245\336?"
+	.string	"\017"
+	.string	"\231?|\002~g\340\331\272\272\316\300{\305B]\201W\313\272\002\317IoU`\2252\2269,g\347\204 '\024\223\217z\357\354\n<\334\0242\220\243\202\370\373\003\177\203\340\357\016@\270\200\007$\022\360\333\016\306.\364[\247\016\324\017\031\374u\001\030\334\003\377=\270\360\333\036\325\303\337\032\370\217\201\377r\026\250F\265\303\377\f\027\301\362\377\320o'`\202\212\213\376\032\3647\261r\270\340\257\002\370\333\004\265\001\033*\321\003\360\333\017!|\367\333\022T\006\374_"
+	.ascii	"\357\267JX\367\267H\277\345\300\377\264\377Z\376\237\375/\363"
+	.ascii	"\337\314\1771\377\307\374?\363\037\355a\376[\261\027\374]\302"
+	.ascii	"\337t\177\303\371{\356\3578\177\327\265\332\337l\376nS5\374\017"
+	.ascii	"\372o\3775\303_\017\360\327\241\277\n\375u"
+	.string	"\347\257\365\257\377{\354\357*\177\207\375\375\365\267\327\337\314\277\273\376\346\372[\353o%\177c\375m\365\367\220\277\177\374]\365\367\324\337R\177C\375\315\364\267\214\277+\3607\357\357\245\377$\374G\363_\312\3370\376v\361w\213\277Y\374\315\201\277\223\177o\340\357\374\367\210\277\213\377\345\374}\342o\337\177\023\177\367\376\016\301\3776\377\337\376\247\371\277\366\177\353\277\003\376\203\371\377SWWW\367_\374\363\304\376\nD\byBNf$\006e\222\351\244\374B:MP~1\235\362\0273\013\345$\262\351E27M\310_\3145\371k\351$\244\374Z:)\277\230TMC9\247\314I\316V\325\\\037Q&\363\f\246)d\223P\232\322\271\314k9wX\213\334t\200\234\247\226MkH\034]\266\2246c\311\nr\331\026\230\226\252\2269\231\246\314Z\346\234\265\224\"3ept\246\345!\235v\3641\225e\264\310y"
+	.ascii	"L9\037;\247\345\234\2179g\235\246)g\316RB\312&\023S\316QCLy\352"
+	.ascii	"h\326\"\347\032\306V\346\244\374\252Z\032\231I\371jf\027\316"
+	.ascii	"c7\363\032\263\t\177\035\241d\031r\270\351T#\256^\247\263\247"
+	.ascii	"\214\307\024\033VF\025\343\002-\n\022\013\343\3029\322\304\365"
+	.ascii	"\003\333\027V\271e\353\213\032\225z\353\256PNV\32157t\277\351"
+	.ascii	"g\277i:\022\031\371\204\241\313i\221\357\247E\332$\tg>\362h\344"
+	.ascii	"\250\r;6\344\216$\324k\227x\242\236Y7x\340\353\344h\323\306\346"
+	.ascii	"'\b\230\225\325\001]a\231\215\325{\035\030\370]\326\026\243\204"
+	.ascii	"\372\254C\363\242\351|S\325\032\f\b)\224\223K0\232o\252\233\372"
+	.ascii	"\274\260\244\314\310\036!\216\344\270\25495N\225S\341T\272~\326"
+	.ascii	"7u\216h\210\347\030\245\344J\034|\036\033|\236\033>\357\314\314"
+	.ascii	"\373Y\315T\271\2352\347\032!\2604\311\315\315\345\246\246\rq"
+	.ascii	"l"
+	.string	"P0\256\324{\036\020\254\246\276U\022*\\u\353g]S\331\214\326\32455pmp\352\031\2657Fkj\232\372|3ZS\321\344\273\224\026\227\325%g\247\275\342\002\004\314\347\236\227\304\337\275\341\357\330\360wj\370;0\370;-\370p\273(e\272L\025\223\241e\t\2311\273(_\232 \353\035\2236\245\347\324\252X\2109\263:sb\360f\256\t\246\353\232\016h'g\246\2320\025\255\202\251_\372Y\317*\227\327.\325\313Y\315M\327\344\r\256\236\325\245\272\345\030\0017\032<\202\310\232l]<w\327e\267\205\253\226;\205\312G\262\336\357\220T\263\352T\243\\XR\336+]=\347\253Va3\366\204\251\301\200v9/\247`\251du\254Z\251b\365J-\253Y\372Y\315\032\356\365X\221\037\332\252fuF\030\034\013\261\244\322J\214\352\302\007\225f}aVaT\027<i\232l\315\240:+!["
+	.ascii	"\270\225\212\231\246\247\0339<\245\206\375\200\201\221BV\260"
+	.ascii	"\3270\0377-\344P\251\267J\261b\350\200 \353\363\347I\023\315"
+	.ascii	"\226\372\24432\303H\2334^\265\215\013\207\0244\334U\235\375\254"
+	.ascii	"Pj\216W\032\265\351CPj\215\032\345\024\0012(U\252ruZ\224PN\276"
+	.ascii	"\321\301\021\021\265\224-s\342x\367\2526!\241\271U\235\324'\375"
+	.ascii	"\254\\\257\\UG\365\001t\234\2203\0209M\256\372\243Z\001%\235"
+	.ascii	"\371\t\304\\&\262@D\324#\343\307\216#\276L\252V?k\223\272\004"
+	.ascii	"IU\322iQ\316\374\224~\241\2722\327\244\032\251G.,)Idi\203\303"
+	.ascii	"X\210d\031b\246\3445\311\317\0132,4X5\213\347FTZ\226'\306\372"
+	.ascii	"\214#,\300l\335\2556\377v\213\234Aq-\301\277M\374k\205\253U\005"
+	.ascii	"R\207tZ\330\2100op9\347\"\365\004\375\254V\225\310\2573\347\260"
+	.ascii	"\262jU\247\276\250\201\033\"\0022\202\345\204\213w\177\227\370"
+	.ascii	".I\202\241\325[\205\324 \371\347\347m\207\226\254z\177\241\360"
+	.ascii	"/\r\374\033\003\377\257\314Z\325\317\352\243\366x\225Q\237>\344"
+	.ascii	"\314\331\n\006\277\221\217\272\243./,)K\360\200S}\324\251\026"
+	.ascii	"\003::3\215\016\304\241\2722DD\244\343\343J\027\021\336\275M"
+	.ascii	"\303\177]\276R\005/.\215\337\246\276\242f\205H\275W\306\235\201"
+	.ascii	"k\230\031#vg\\\246\026_gv\304\001\305\201C\245\306\007\013?\371"
+	.ascii	"\344}\321^\231\006\005Z\315(\r;"
+	.ascii	"/27,\256\362\367\305\005\233S\243\314u\261\303\344\305\006\311"
+	.ascii	"uq[0\347`-\211\023\021gC\311eQ\331\210\214\201b\201\003\377\027"
+	.ascii	"y\221\2756$\224s\325\2332L\006\271LS\357}\220\370\255\325\266"
+	.ascii	"\354\226L?m\331\315V\031\225kl \233\332\020\304\302\214\034\271"
+	.ascii	"z\353\234V\344\326"
+	.string	"\214i\203\337[g,\2326\031kVm\213\215\315\222\320iB$\240DL\235\262ji\232sv\216\245\263q\354\033+\247\237\026\216u\273-c\315\030Y86\315\032\234\205c\337\254\23315p<0\230i;\200\356\231\273=qkcK\350\247u\363!\353\306\252\261lz\304\306t=\315Y \372\2113\263\246\203\307F\016\310\2123\210\\\2756N'\n\007\030\026Z\340\372i\327\3406L\314\342\334\255\207\013\221\252+\370=V\360{\272\260m\303g\340v\204\321\302\357I\202\337\323\304\357)\202\306\252}}a\023FM\254\f\232\214\245 \270jh\n<\033\306\246\3311\377NP\2232 U\250\360\255\030\017\210\210\251R\357\265g\267h\377N\005c\244\311$\205o\277X0\377\016\320\332\325\024(\365\276\347\t\337z\251R\307&G\275\266\013n\321\223\314\300\263c\214JG\275\267]~{\305b\261\\D "
+	.ascii	"\022\324\321\225P\257\325b\267\334r\261Y\262\345\222\3012g\244"
+	.ascii	"\345\022$'gdP\267\005\335\026\334&UF\250\360\356y\352\360\327"
+	.ascii	"\272\002\357\347\213\321\255\031\005^S\2243\207\365\204\331\002"
+	.ascii	"\327\245\206\305\246\330\261\246{2ZRv\005\237g\013\337Ni[\245"
+	.ascii	"J\346\031\202\215\266\326\302\302\254\325\022\235\255,a<L\370"
+	.ascii	"\267R\336O+\245\327\2542g\247\fj\226\267\315\f-\314\r\376\372"
+	.ascii	"\352\202\333)\003\345P\254Wm\352H)\"\005w\261\204$\243x\321\361"
+	.ascii	"X<\021\242%\326\325e\225\220\250\240\343HN,\r\024'N,\227\205"
+	.ascii	"\033>Zf9\256\330\255[.\213F\004\353\013\354vaE\001\021\202o\227"
+	.ascii	"\264\325\352\247\325j0\r\031\211L@WsG\007~7\030/I\022\253\204"
+	.ascii	"\304\261\006\234\334\034\023\343\225\2231Jv\216`U\311\250\367"
+	.ascii	";\307\253+\213E\001\2274\013d\013\0243\213\344\026\253\335\200"
+	.ascii	"\262\256\314\266\352\265F\354\221\235\224\031UR\354\021\333\344"
+	.ascii	"1\263\222dM\325r\246\215Iic\360L=\321R\343\246H\021k5\204\305"
+	.ascii	"9\245\341\007\253)\204\214\325\216L\326\025\0256|\013\244\255"
+	.ascii	"\020[e\207X\246\233\3032\262\306\207\035K3\370\370\f\277-\023"
+	.ascii	"\357\033\332\376\260?\314\362\206\3430\036\266\212\207e\362r"
+	.ascii	"n\347\222F\023\025\225evnZ\303\200\035\271\265\350\352b\324k"
+	.ascii	"\231\266\207e["
+	.string	"\222fD\203]\356\250\311\355\b\353\302\307Y\370\230\211\355\324\323N\265\333P>\2561\302\321\344\334p\034\025\025e\245:*\037\343,\300\321l\322\360\333\034\267RM\027\344\304\211\212\\\323\361\322d\365pQ\3571\022\337\322\260MN\026\n\347\234\233\314\031\025\245\001c\t\263\301fo\334B\325#\230%i\326\306\220'\t,l\334\326\220S\303\226\321\004\215\271\242q\303>\265\227\237\272\034aRk\370o^F6\345\234\237v\316\334\264\344\303\353]\267\206\377\247m\037 \333\377\006\3509\363\221n\213\r\306\"C\3528\206\374\247\345\234d\036%\300tJ2q(\277\230\371\230\274:Nh\312\314\243\362+\347\t9\231<\216X\346\t\312\257\354\224Y\220q\352\354d\036sr\031O\301\241\230\"\365)\r`\004!q8\364\365D\020\016y\222\222|\277\024\251O\251\250\230\002O\024\031\203H\027\214`\f\002\223.\310"
+	.string	"D\017D\210\021\212\320#c\322/\b,\"\026\215EE\"\b\211)RaP\007\205\017M\272i1(\374\355P\244A 1\2117a\203\241#T\tH\374\240X\202"
+	.string	"+\206B\021\024\244O\301\001iX\2044\244\360\013\032{\202(*qW\354\371\244\275 \322p\027D\032Z\224\004\300\342]1\024\376.1\035\332#4\210\004L\362\351\034\241E\343\375\241E\235\023{HC\016?D_\212\337]AL\213@$\024\204\336\020\205\016\034\216P\025\276b\005%\242\020\005\021\035\022@\tM\213+L\364\002p\0244\n\211\035"
+	.string	""
+	.string	"=2\246\3004i\203\n=E4\351\267\"EM\fq\200\024\374\371\240\251PDP\bL}\304\023\300$\237\210\"\320B\372CStD\n\f\226@\211\037\354\2148\024u(\360t\340\220\022}C\016h\352;\032n`\302\212#\037\nB\221\203\025I\303\241\257B/H\201\024-\242  \r-\374\007$\242A\024\t?\003\020\027\200\b1\202\316Ch\320A\203\016\274\207\320\300\310H\003\020F\370 \214,\332CS_j\242g\302'\275i\261\247\004\304;BS\242\260\310\013\372\200G(\006\204\376K\237\202\003\212\242\240PII\370#\300\256\330C\n\002U\b\225*\2400\236\260J\306\242EI"
+	.string	"4!\202\360(\b\024\201g\004\364(\b\334\021\3214\tH\001\024\311GDUlP\354\361\322\247\340\300"
+	.string	"\021\024\240\251/\311\370K\362\375vR\340\320\004\ntD\257\304\007&z\320_\320\227\026\203@\234\3662P\342\006\201\037\004\213?\036pX\264\305\236\b\017%zDx(\261\303\373y"
+	.ascii	"\332\247\340P4\242*\200\304#\013\305\036\006\204\210hZ\364)\361"
+	.ascii	"tP\025\276$\023\306\241\0226\366p\2617\242h<\321\203\366\320"
+	.ascii	"\341\212\020\212\306\023;:*\320\243\242\361\004/5\342\025\276"
+	.ascii	"$\364\25074\3424%\372\322\"&\246\037\374\202F\n\f304\366R\024"
+	.ascii	"\211\247\002=\262i\322\006B\242\217\203\324GD\207Jh\b\0360H\203"
+	.ascii	"@\035\224h\374\240\330S\201\216\330I\022\n9\350\355\322\2470"
+	.ascii	"\300\205C\224X\224\n\205\304\242\236$TE\017\305\257\247\330C"
+	.ascii	"\002\242\b\nEL@\207+\322\242\361DP\332C\362\205 \004\352\004"
+	.ascii	"\213\277\036pX"
+	.string	"\364A\177@\025\350QP\261\210\022\217\216|\275\237\007\240\020J\364\211pD\364\245\370I{!t\322\240Q\370\353\241IC%_\2617!\355\2010J\203@#\276\221\221\b\f\033\360\240\003\374\343@DST\251\250H\024\026\203h\261(\b\364)\025\375\210\305\"\016\005@1L\352\241E\2400\330\023\022}'\200\226X)(\253 H\2346\013\214\211Z\022\246\216\224\271\261\247\254\033\004\311\244\016\213\031\364\202\307[\034$6\t\001\030saG,\023.\202\003\216W\363\276\350)\241\315\026)#U\016\004\022&uW\267)(\212\027\025\027'\260\031k\256K\016\253\033\205a\312\024Y\275\316/\0376*b\332\020i0\036\016\026q\252\f\201\252\212\343\262\252\327\207\217\033\344\202\231Y\333\2269\022YU\352\200\374\0069Y\217\265\034A\352\275?N\3661(kE\376#D\352w)u\231\335\246\2359jy\214S"
+	.string	"\225\0274psY9\245\001\t\b\325Y\217_\346\031\257\356Y\306$\353$cZT\352\275<~\251\376\035\0354g\300x\301\341;\365\273CG\215\266\2546\035\377\216\217\220\2630qg\360}\302<=\335\250\007\244\305e1\001\"\3431'\006\307o\324\217\026\231,m\365\336\032\027jN,\256\r\352\336H^=\251R\207D\007\232\227\215:\327cg\260\216X\211\021\3436\r-\217k\022\240\265D"
+	.string	"\034\214\203H\250R\321@\311\342\224B\312\314\214\310H\222$\035R\n\020\204cY\"(\"\037\022\240$E\2172\307\020\215H\222\024\024\262\034\254Y@\265T\031\240LU\351\025\3438R|\373\213\036=\240\375\241\367\345\020\243\232\013\374c\371\177\247\246\254\255B!\374\241V\350ns0\035\177B\334!S\3573\221\263-\346)y\016\324\2178\026\213\331\343\205vI\262\273Tr\bGW\320\3356\256X\235"
+	.string	"\307\217\221\205"
+	.string	"\317\004\300\316H\216\307\322\023\351#\r\013\235"
+	.string	"\223H\251\025J\033\332\002\013\320\003\316T\300\r\373\221\347-\245\202\334\341\\\226\007\3543\342\026.<N\3026\245\022\021\013\266d\3039b\262p{.\2264\205\036\177\321V\263tQ\364\205\313\004\244\351\304\201H,\366j\257\026\234\310\354P\253\031H\020B\317t\373r}\f\033\220\003C\350\304Y\230BQ\231\253\231&o`3~=%\205\324\244\243\035\302FX#\207\332\273J\241*N\373IcahV%\216H\314\241C\224\367\206\353|\334A\222R\341QK\357\356\355\006}\267\342\223!m9\232\2107\022\326^\335i\212 "
+	.string	"q\"Su\373\020-xF|\203R\336\265B\233"
+	.ascii	"\311O\246>_\201T\300FYs\354A\016~|\202\311\013/;\251\322\266"
+	.ascii	"V,\315\001Hb\ty\315e\334%\203\261#\255C\304\330_&2\271\312\b"
+	.ascii	"r\221\245\0332\361\353\3466p\006\021c=\216\334\212\"\260\331"
+	.ascii	"\234\030\232\270F)\022a\225{\266&x\355\316v\362f\211\217HL\244"
+	.ascii	"\250\247+\370\337O'E\007\373"
+	.string	"\t\353\247\365\017-$\324\344\227\350\361\353c\017=\376\246?\036\365w\022\333\336\"{\3230Zs,M\224\324m>\275\242\3513\201\360_f\321!\327`@E\271+Q\236\021\330\b*\340U\226\006\372\030r\034)\363\255\242d\0375\363\306\335\326u\312\302\244\324mub\361st`;\333W\\\035\221\227\204\301(\222\177|\345\030\345\321%\216\2128\241[\340U\3005\036\253E\305\022\007\030\003\365\274U\274\272<\001_(U\245\004\277\002\242C\301.\376\306\304`IY\2728\237\f\336U\314D\250\222:\325\340\267S\214q?xe\030k\266F \253\225\024\\0^as\224\232\271\005|\316\021\221\220Mb\362l\301B1h\367\336X\201.\302\fB\346|\231\216\221\032\335\0075\004V\343\315P<\323\274\266`\235\277\324\275\223\347\204\013\301\"\021\247\227\353\345\333,|U4L\247\031\205i\031\301\330\234\332"
+	.string	"\357\2238\f\r?D\367VS\307\366\342l\177\"o\316\0216\361\355 G\017\225\nF\217\314\234\373\333\245/\267\332(6\007\013\310l\024\307A%\355V\327\343sE\207,{\332\271\361\367\3675\235Q\230\017Ld\374\352\205F\247\223H\307\234"
+	.string	"u\234\244\300\211$g\017P\240\257\370\267\304Cb,\234\261\034\314\336.f!8l\365\336t\347\2170\352Z+se\315\266Z\033\370\320\323\316\005\004\257>\201\037Vc\354\345\321\350UF_\002\037\233f\025\264\032u\242*\032\325#G}\025\233)o=8y&\347\035\220\362\253G\357P\351\2173\020\203S\301\346"
+	.string	"Z\316'\f\232\220\337\002\2537K\003~\033\255\204VN\275\224\256LR~\003\247\365sz\007\215\034\206\371>%\206,\3411\357\236\003\332\022U\020\223\317\032\033\257\005\222\223\230\366\207\251+\"1\352\336\305R\205\233\221f\177\032\203\346"
+	.ascii	"\325\326!\240T\032#\2511\246\215Z\254\030\363\355h\034@\245/"
+	.ascii	"\bd\306^\345\264\031x\253\025\216\324[\372\tl/\273\212~\215\253"
+	.ascii	"\350F\344\036\310I\365~\266\375\332u\240C\030\f\302'[5\036\346"
+	.ascii	"\254\200\314R\030W>\311\200hX\300\341\326bPW\nR\005\321\301\366"
+	.ascii	"\266fA\302\345U\366\342\263\306l\317\232\022\221\326~g\34064"
+	.ascii	"\r"
+	.string	"\351,iC]\342\307@\374\317\237\016 \2457\272\234\344\333\223'\320&\371\312\300\205K\366\352\207\216\003s\251\346d\032\276\352H\230L\257\276\025\224\201\240i\235\375\271\230\206\253:\370\230X2\246\003\203\355r\371\2545,\213\220^\361\021\232V\303\255oX\301\375 _\322\024\344\257\331YQ\356\376\312\261\\7':\006\004n\004\312\020:>\202\200\242\351\024\017\335\004\336\262\377\370 P\270\332d\037\004m\325UL\207\332;<\022\346\334\030\265\305$#\362\0349J\030T\025\277\200[(E\342U\274\317\257\227{\241\2211\325\242\372\300x\033\035\324\020\340\017\302\272\344l\264NIq\265\\l\226VF]\272\361\235\315_\353{)s\333\354\203\330#\336?\250&\277\260\001\332\322\342\353\371\272tRO_\332,1\366\213\326\007$\343\332I\347\212\252`6K\270\353\351\206v\255 \310P\001*\270\344\\\331\t\215"
+	.string	"XWp\f\223*@\031\3434\341>R\367\212(\0070\210\n\370t\272?&\367o\3629\336\210\255\200\230/\002_\303\033\360\303\315=3\013\352S\301\271\316\260\316\340\306\024\330U,\377\017Y \025\326\334\233\222\212\320bP\322\310\312\311T$\310H\302\377\n\235#\270\205i\312P\"\274\342UU\0205N\3337\205\234d\300(\223\213\256T\207\326\004m\320oN=\375\275\230\017\272U\235\355Tm(\234\210o\372\306"
+	.ascii	"\210\247\322\306\247\230i\017\003\202$\241\307\333t\347.\367"
+	.ascii	"*\313\302`C~m\200\370\205\331\252\231\306\3016@\354\3560\212"
+	.ascii	"{{,\336\223eJ\342\001L(n'j\354cD\367\026\356q\3667W\032\335\275"
+	.ascii	" nxl\231,\302\313\3153g\227\307\327\350\363\342\333\330\231x"
+	.ascii	"v{\360\362\201\365w\340\343\345\247\357\n{\222k\227\322/\020"
+	.ascii	"\256\346\211~\353\217+\211\370\305\036\333\327\373y\307q\250"
+	.ascii	"\365\214\376R{\313y\016\3436\364\251\311\370\343\203\341\t\353"
+	.ascii	"\237P_2d\303\364\202\301+\263\247\346\303/\2571s\344\277`\314"
+	.ascii	"1\311\230\271}\230\033\377\335\261\276ab\307\364\307z\302\342"
+	.ascii	"\031\033\332\377\036\362\234=\216\337u\372\337]\230\334{C:\r"
+	.ascii	"3\241\277O\360m\247p\006\337\356\211\213\313\301\017\203\262"
+	.ascii	"\225\203S5\215\206\203\032\027\251\265e\013\302\001\322\266o"
+	.ascii	"T\374\201\216\377\032\256\237\256\377\267\007\267\347 \177\307"
+	.ascii	"\214o\177\223\303\376\231\373\356\255\2338$?\212\263\025"
+	.text
+	.section	.gnu.lto_.symtab.df9ce9c53d0da41d,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"movingAverageFilterIsPrimed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"movingAverageFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"medianFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.df9ce9c53d0da41d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1649 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`0\002\255\016"
+	.string	"\024\023$\003"
+	.string	"-"
+	.string	"\254\372\361\363\002\024\002"
+	.string	"\002\001\002\003\002\004\005\002\004\002"
+	.string	""
+	.string	"\002\004\001\240\342\234\212\n\002\003\004\314\346\255\372\005*\002\006\002\007\002\006\002\006\005\002\005\005\002\005\005\240\342\234\212\n\006\007\b\t\246\300\251\343\t\002\n\013\361\312\235\227\007\b\b\002\t\r\306\374\305\326"
+	.string	"\002\006\002\001\016\017\310\311\351\016\004\002\n\002\001\021\235\361\320\201\tD\001\002\001\022\024\313\322\375\213\007"
+	.string	"\025\354\206\342\366\006\026\027\030\234\236\237\233\f\004\002\013\002\f\031\361\220\342\261\005\032\243\330\276\362\016\026"
+	.string	"\r\002\001\033\034\234\345\320\355\017\f\r\002\001\002\016\002\017\035\352\263\360\321\b\037\365\237\256\307\n\002 \373\310\241\374\006\020\002\021!\336\253\202\201\b\016\002\003\002\002\002\"\314\344\207\235\n\006#\355\241\206\304\017\002$\250\267\374\351\002\001%\300\253\277\314\017\007&\205\246\225\244\001'\317\356\361\267\004(\350\300\306\254\005)\307\266\257\307\n"
+	.string	"\002"
+	.string	"*\367\345\303\353\007+\207\312\266\244\016\002,\320\374\270\356\001-\325\241\220\227.\326\327\255\312\n/\236\214\324\307\0070\240\342\234\212\n"
+	.ascii	"W\250\301%Q\204\3526\326j`\002CSe\036\021\260\305\232\334d\331"
+	.ascii	"7\320Mg\265\243\306c\342.z\250R&\270lQ\037\231=\267\216l\270"
+	.ascii	"!\362\200<\t+G\237\253[8\201\004\345o-Q\312\305\021\312\025."
+	.ascii	"\301\230m\362\321\255\031\262t\026\317z\261&\233\326\037n\312"
+	.ascii	"5W\251\241h-G\311\245\261\214\320\214\370\020\033AS*\313\327"
+	.ascii	"_WQD\230\001'\335\253\030\316/N\260:\206\004\365\025\236\342"
+	.ascii	"\004>\220\257\003\006a\b\016\320\200\323\217\277\336n\230.\244"
+	.ascii	"\207WlC ]s\274\216\217\202;"
+	.text
+	.section	.gnu.lto_.ipa_sra.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \313\345\003"
+	.string	"\222E\022\036\2209\303\001\377\377\377\377\377\377\377\313\007\376\201\177\340\037\253\021\020\021h\242\024"
+	.string	"\233\232L\001\256c\033\313\330\305*6\261\210=\254a\013\2049\020l"
+	.string	"q\001s\333\222\232V\332h\241}\326i\306\3542\225\231\350\332\254|\004\025"
+	.ascii	"F\205\371Y\200\363.OK+\026gN\340\027\256`\007\216Me\222b\001"
+	.ascii	"\240hQ\342pF\320\274K\224\231\234)\260ae\360K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\013\004\335\r"
+	.string	"&\020>: \223\322\001\201\204c\320(`\034Nt\3126XmL\026&\317\303\261VD\351\263\302\372"
+	.string	"\241\033$*\006B\270"
+	.string	"\360\022\250\210p\335\304yn?\233\226Uz5\322\210\224$\005-"
+	.string	"-"
+	.string	"0"
+	.string	"v\270\340\276l\345\016\350\200O\177jr\\\035\243\306\334ZF8\334\2515\324\377\367lQa3Y\251\2416'jm&+Qv\312\335PKR\306p\270\223\031\027\214\213m.P\333\244\2659\001nI\213R\302\023#pi\377\317\223\332+.\355\237%\017\264\024\2405\362\307\221^f\301:\333\240hjO\310e2\306\325\tzI\3010\212\364\371\277\372P!\032\223W\312\t\236\322N\b&\017\325\355|"
+	.string	"b\207\27260\0136\006\276\260\250\240\020wB\"b\005\241\235\310\017\"77\226\221\035V\376\177V\001\375S\245\362O\223\033\2766\377\334P\362\237\nf\260\326\274\020X\250!]\207\202\241a{l\006p\002\231\2512;\022"
+	.string	"t=\001D2\006\032$\220\n\305\324\304\317\003\216gR\206\261m\310,\\\360\3158\245\026+\375\275\212\214k\027\265H\200\346\246\017ZQ\314Po\212a+l\222\226\013~\004&\216\023\302\205SYwh\210\336J\332\321\177{0\344\216Lb/H\210\234\301\236`\363R\204:o"
+	.ascii	"\nIc\212\207\\x\020\007\3113=\230$\r\003\364\0030\271\245\211"
+	.ascii	"^\220r$n{>\333\340HfRT\235\016\207r<\334nx\277\357\264\341\256"
+	.ascii	"\005\314r\027TF\207\332Q\033\361>f{\265\324\327\210\364\b\276"
+	.ascii	"L/#1M>\233=\363\017;\212t\365"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\355\006"
+	.string	"\202\314%.\200EI\007}6L\334\031\003\3653\003}F\200\222]1\300\016\31502\0010\340\037\370\007\376\201\361\034\375\333\332\257\007\377\215x\322\266L\001\177\3479\277y\315g\036\363\227\267|\345)\377\344\227b\214\261%\225\315V\362G\036\362?\3364\025\300eB1&\020`\020B\330\017\\\366\365\02750\353g\374\342\255W|\342\253\033\363\021\327\240-\350\367\006\270l\257\227k/\227} [v\225ONU\372\303\033\242\250-\203\332\262\016U\300e~\341F\345{\332\035\027!\034"
+	.string	":\206\343\243\340\354\026G\317"
+	.string	""
+	.string	"\271xs\236\305JP\357\013b\302\300\254\263\266\2545\264\006\337\316\020\201\237"
+	.string	"\004x\240L\032\254Pj\233L!\307'\211\250\016\376\264\b\232"
+	.ascii	"q\321\314\001\214^\200!"
+	.text
+	.section	.gnu.lto_.pureconst.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \\U\002"
+	.string	"\302\205\021\032\220\2730\006\177y\363\377\325\335\245\377\377\377\377\377\3276\322RCD)p\263\f\036q\210?\334\341\rg\370\302\025\236p\204;8\203+8\301\007.\340"
+	.string	">\271\344\221CN\036\347\270\306\031\2678\305\351JPU\222"
+	.text
+	.section	.gnu.lto_.ipa_modref.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"-\006"
+	.string	"\222\007\027 \2407\303\001\377\377\377\377\377\377\377?\216\375wFMDd\324F\332\356wgI{g\377\313\224\002B\036\323Vr@\r\206:\251\322\023E\320\343\254j\226\241\371\263\251V\"A\034Tw\301\331.\266\023t\340\364f\3330sf\253\020\004\224\255\033\346\313\2462_\3335W\003\230x$3 \320\002\231\252\333\246\210"
+	.string	"\276\207\036\254#\235"
+	.string	"\037n\345\2310\244$\275\017\340\323`\305\026\346\202!8\256\335\210\313\344\215\320q\3201\3022L\215SY\201"
+	.ascii	"<\356\330E\303ir\021\r\314Lc\034\230\326q\234_\353\025\027z\201"
+	.ascii	"\330\203+F\0344YTy I/@\013\246|e\235\203\025E&\264\302\270\001"
+	.text
+	.section	.gnu.lto_.lto.2941b2aa83a3fd40,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.44.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bb"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\361\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001$\213\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.46.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \252=\004"
+	.string	"\264\006\235"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\n\036\005\001\006'\001\232\003\001\005\001\006\177\177'}\001\002\005\001\006{\035\001\344'\001\254\002\336\312\256\003?\202\210\200\320\002yw\311\001u\310\001s\307\001q\306\001o\305\001m\304\001k\303\001i\302\001g\301\001e\300\001c\274\001a\277\001_\276\001]\273\001[\275\001Y\274\001W\273\001U\273\001"
+	.string	"\f"
+	.string	"`\b\230\013\216\250\330"
+	.string	"\315\200\334\3131\241\332\343)\021\\\2212\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.47.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\324\001m\020"
+	.string	"\226\035lG\340\264&\035dl\3613\t\320\007\345 \022v\304!\350\261\311E\344\3770\274J\023\003N:5\334n\273[\253c\036\277\201H\357\303\230\336z*\376^\206@\202h\r1"
+	.string	"\223i wS\367+w0i{\223-S\nW"
+	.string	"R"
+	.string	"\\"
+	.string	"/\315K\355\005\346\245Y\366\221\313l\366\263%2>\206v\227\2131\316\372hJ-*\313g0\243\b\214\265>\332T|\312\224P\2312\323\256s-\207\f 0\226\342Q+\005\2750B\212\275\264\024\232!(Nb0\325\221\204\335\265\202\261\023\367v\3330\266!\330z >\217\367\370\374\233K\303\304\350\301K?f^j\2140\303\204\006'\307\245E\266\354\245\021\206}mw\327\261\306~\316?\243:\252ZI-BCH\024\020\331\235)b\262\241\004R\203d\373j\177\307qX\317\031a"
+	.ascii	"\273.xzve\016\334`\273\\\020\031tB\030\213E\021\260\243#T\237"
+	.ascii	"$A-4\002z\331yL\333\256\353\240\277\363\037\0326\230\364\240"
+	.ascii	"i\236\246\335u\b\200#$\021[&\251\355\001\245\007}\262s#|\305"
+	.ascii	"\2267\2335\261\273(\034~\226H\250\245MN\003\244\t\343EL\215\006"
+	.ascii	"fE`\252\304\266\3523\020\333.\354A_K\207z\271\260Ju\236\007s"
+	.ascii	"\032\340\223J\b\257[\255L.\334\347\251\276T\367q\251\027\023"
+	.ascii	"\212;y\037\247\222\300\252\017\235\307\255T*\217#\311\\\3276"
+	.ascii	"\326x\002P\350\212\257\021\002\265)T\210\2615\365+3F\227\377"
+	.ascii	"<\310\212\177c\013,,\3632FiC\b\321\nY\362\3511\206& \200\002"
+	.ascii	"\2411\354\006CC\217H\214k(\020{s\355\022n\315\360\2363\021s\236"
+	.ascii	"\363\256\177\354\030'\331\323`\\\335=\270\333~C%\216\033\n\235"
+	.ascii	"\027D\373'`\304\200e]\300\206\350]\257\263\266\215j\330E\274"
+	.ascii	"F\207.\331\220\350h\244^fJ\351\376\335\210K\240\021\016\024"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.48.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`@\0015\r"
+	.string	"\346\327VC\020o\234\016\217\367\341\002\001D{\374F\205\225\251\305\007\017\332\b\351\031~\275\006\030\032\006\214\022\234\230\345/\003~\262\272o\f\303!tm\300\025P\201\212\200"
+	.string	""
+	.string	"r\265\030\201\220\244\3222GD\233l\231RC"
+	.string	"@"
+	.string	"E"
+	.string	"\237\317<\262M\036\256\266\242\372 !\004ew5\271\341\243\317K\352\310\327\215\024\037\350}\032hq\275\343\027\210\326\370\201\027.K&\214"
+	.string	"\213\244u\001OR+\007v\327\372\201\025n\354\266\025\330\316\330\337\b\020B\372\357\323\017a\237R\036\344\232A#\205\372\300@\322\321\016K*U\366\3458\216)\226)[\325\022\313:\274\310\224\354N\030c\2548Up\260}\377\343 \242{X]\260\330\335\354\323\026\331Y&\351\371$~A\021=\225q\026\tk\205\024\361O\250\365\333\223\b\307j\b\361K\330\304\262\353\035\365\203\260O\035\260\021T\036'\273\213\371\b\037eY-\205\r\027\323\361\004%\034)'&\235a?|\b\220\257\341\346hB\\\347\363\331,\320:n\353<\235N\3630\3304\3208\\\247i\nxs\320\341\264\317\266qZ\026\222~\255L\031\201\007\221$K\276\210\377\332\335\235\225\021\013&\036`\004\274"
+	.string	"\250\345\033f?\350\364\237\005\240\200!\006\036"
+	.ascii	"2\241\233i`\\H \027\310.\340x\252A\201dK%\031\016|f\253kl\002"
+	.ascii	"\202\201.=\225m\321\235\0363\0273\333Hfc!\325v]P\003\312\304"
+	.ascii	"K\023\343\234\203)\374\345\220\2461\247\032\005Ntny\002"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.51.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\376\f\365>"
+	.string	"\032g\250\026@P\344J\007\343\316\007M\354)\201\027\305J\304\370:\032\001\021\307\035&\313\345O\200\206\367[\263\345\"B\302\002\024\025\001!"
+	.string	" \202\204\315\220i/\240\337\325#\225\343\316\"\204\021\262\345\336)\245\024Y\001:\001a\001\316\251\352\374\251\263\277s\203 \"k\023\205\246m\213<\372i\331\250}W\272K7\230\356\275\356\276N\231\345\224}OH\037a\3100yD\022\333\326.\n\311We\217{\314\247Q\302\b\206;\f;\225\326\266m^\353\355h9~\"f\320\035\314J.\335\205\033\217\225wl\317u\224{\264\0347p\2469\345z\216\373\256\351\272\256G\333\361\337\322\227]+v\027\327\342\3101h\225\033 []\352\345m5m\244\333*s\017fe\253W\311,3b\333\245\265\215\327\310\304cl\3336\352\2474\333\002\002"
+	.string	"X&!\035\031\025\021\r\t\005)\201\222\310\365\252\351;\313\235@\316\260)\346\243\005@;"
+	.string	"a\0304]\306]q"
+	.string	"K\266t\211\2110l\315\223\324\032I\355\250\212\0257\252\242G\305\213\330\322\234(]\262\245PmaN|h\275*\301T\273\023e\214\255\205\202R\250\3042z\2320\314,]\026ak6q%S\2241&\r\304\304\257\231\332\302\226xr\275\2122f\326\310\262\26602_\343\230~U\245\030\230\247Cb?\322\245\266m\233\357\313?ujsF\247\t\303\234)\001'\340\221\216k\027\"\346\345\276^\265m\313\336\024\033k\036\320\314\355\307\314S\314\3129\001\374w\233^\351\007\374\001k\363\362G\206\372\246\277\201LG\251w\372\033l{\230\216m\006McT\027\374\213\350 \211vC\270\340\205\270\350i\3448|\022\371\322\177\262\324C\375"
+	.ascii	"%q%\232\215\td\333~Qq\013\366\340\t\024)R\334V\241\236\352\220"
+	.ascii	"\256\371XE\003\256@\266mK\305\255\246\327\260\340Vk\225]hi\335"
+	.ascii	"V\245\276\371Z\301\230\0368\272.\223\247\315\223\357\247\353"
+	.ascii	"/@\311\236h\340\227\363a\242\307\307\307?\375t\373\375\033\314"
+	.ascii	"\351\325\177}\006\006\267\032\307\220\341\335\224q[\355W\022"
+	.ascii	">\302\221u\371#\263\235\227\377\223\271\323\366\321\230U\347"
+	.ascii	"\017Ig\017\253sVwi\356\260:s\270\316\033Vg\254\353\254au\316"
+	.ascii	"\260:_\255\316\030\256\363\205\353lau\256\320`\232)\254\316\023"
+	.ascii	"\256\263\204\325\331\352:W\255\316T\275\327\034au\236\272\316"
+	.ascii	"\020\256\263\324u\206\272\316\013Vg\247\325\271)uf:\260:+\255"
+	.ascii	"\316\004\272\257y\211tNB:#\251\316G\252\263\321u.\272\316D\327"
+	.ascii	"y\350:\013]\347 \325Y\271:\003\251\316I\325\031\271:\257\253"
+	.ascii	"\363\275\316\352\rcX\006\342x\230\213\261V\3305\366\312\225\333"
+	.ascii	"j\322\357\217q\261\210H\026\366\r\217\350\203\276\350o\240\233"
+	.ascii	"\017\021B\364R\321?8\272\241g\007\342AV\260Z\3307\366\355\266"
+	.ascii	"\372\177\232x\204>\350\207\376\376\3019\230\t\377!\364\215wH"
+	.ascii	"\247\374 \367R~\307\265\20333\215dB\t\034\350\231\3319\266\316"
+	.ascii	"\273\311K_\357\203\231\036\250\017n\017\323\361\261\237\356\362"
+	.ascii	"\231\200\016\345\264\004\375\223[N\321\t\204\204\336AL\036\370"
+	.ascii	"\345\013Q\272\037\222Q\242\207\335J7\371\037\236\235I\346'C\362"
+	.ascii	"W\3051\215dH>\335\304\263|\344\363\200\033d:*\377Y\344V\266\007"
+	.ascii	"\364h\310\365\237\232\324E\005\327?\360\236\207\351\330\240\357"
+	.ascii	"\257_\340\r\230S\375\233\276\324\253\177\353\200ma\022\275GO"
+	.ascii	"\372\355\327i\0267ypt\311\177n\305^\304\342\220\225u[\345\001"
+	.ascii	"5l\342Y\202\343V\206\374'\207\270\377[Q9\314\037:1\204\235\377"
+	.ascii	"5\212\3278\247\353\210\370\277&\236.\030W\216\322\b\036t\221"
+	.ascii	"\357\304\300i[\223\250\276\311a\335\235\242\233\300\bO\365\f"
+	.ascii	"\362\2001N=\201\217\360\005\376\300\260@\370\251o\246\343\036"
+	.ascii	"\217hC8\020\336\275P\241#\360=\246\3238.\210Q\303<\25721\205"
+	.ascii	"\327\351\225\376E\024\320;\\3fh\271Ps\254pv\361@\307\226\026"
+	.ascii	"\016\034,ZDqm\331\340\252\241\305\025U#\006\013\032Q.\266\270"
+	.ascii	"\242\036(\261\215\033Z[Q8l\330\330\212R\332u\365\243\361\210"
+	.ascii	"26]\357%\340\237\317\314\017\234\313\235\3775\361x\370$\247\350"
+	.ascii	"\033/\303\274\254\367\360\035m_\303cn\351\360Y\034\036\353;l"
+	.ascii	"x\016#\274\216n\203\206\307\212\262\n\227\213\323\360\215\207"
+	.ascii	"\364o\034\216eBd\305\376\346P\326\314\t\013\005\312=z$-G\257"
+	.ascii	"\236\0256\2225[\323\311&@c]\243o\021=l\303:\3132z\325\255\020"
+	.ascii	"\200\2635\226,I\257A\350\212\273\266*\n2.b\335*\202d\213\236"
+	.ascii	"\346d.\245\343\232\201\221@\350\342\362\237\354H\r\272\365\032"
+	.ascii	"Y\030\210x$\204Aghj\232\305%\375\023\020\b\237D\244G\273z\253"
+	.ascii	"\177\021\025,l\f\177e\3411|\237A\234k\254s\364O\276\360U\377"
+	.ascii	"\"\032H\302\321\374\354\302\027\277>\212F\026\276jP\217K8\224"
+	.ascii	"'\026\276\365\332A\237\221){\340\024\305\351\n\313\3039\024\276"
+	.ascii	"\302\204\267z\n\022~\302\bw\272\231\204\252\267\002\303*\234"
+	.ascii	"\211/\251\372\016\323M\200I\026\235st.\205\214\235=\242\206q"
+	.ascii	"\373\021\230\275=\235[\031\231\241\177\262S\236\236\204\235\202"
+	.ascii	"$z\006\272\330U\330X\227\231\245\342\001\201\030\250\221 &\221"
+	.ascii	"S\252FD\222\244 Y\016!\005\204(\350$L\017\022@E=\n[GLN*\313\376"
+	.ascii	"\033s\250\375\007\303\021a\355\256\313K\362WY\t\212J\"\204\270"
+	.ascii	"8Qp\357~\207\035\370^KtQy\267)?\003\344\276\272\3273\f\2702A"
+	.ascii	"\006\365\"LV\361\346\201IA\344\031\020\013sY/\b\356\257\227\""
+	.ascii	"\013\300\270n\252\227\t\257l\344\036\351R\373G\032G\217Rp\213"
+	.ascii	"[\354\215\350tH\376\001\253\243&`vF\336\301&%u\302\333h\022\023"
+	.ascii	"\367;\232R\250=\376\207!\236l_O\021S\r]\362#\022/\001n\201c\002"
+	.ascii	"\237\"\226\353X`\306\001\375\271!\274e\001\004\364\2502\013\234"
+	.ascii	"\353\252\242\214\"\026\004*\323\334\360c\257\200p~-+\013\325"
+	.ascii	"\367\236\246\036\\\2575\002\257\251mom\021N\305\216X\334\350"
+	.ascii	"S\375\334\376\037\023\f\341k\002-K\370\3519]\332Mj]3\215V\342"
+	.ascii	"<`1\342o>V\324\265\316\302T\346\002Y{\024\214\231\254\232'\332"
+	.ascii	"\355\374}$\201et\266\274\315\334\t.\345\205}\330\336Q5|kd\373"
+	.ascii	"\211\316\207A~,\275+VN3\324\245\322Ltp\230Z\021\266\t\020\b\341"
+	.ascii	"\371\fM<\r/\216\177+\253\005\221\r\201\322\023\205\266\263\203"
+	.ascii	"\327\022\244p\016\306r\334\006\370-t\226\001\234K\t\270:Kq\237"
+	.ascii	"\031\373\305\213\265\370\254\027\334\0048E\206\212f;.\211I\204"
+	.ascii	"\b\027\257\020\340\006\242\020\272\355(1\361\230.\004\324\346"
+	.ascii	"u\004\006\255;\370\277\240\2366\t\267\353\373g\271\352\201\267"
+	.ascii	"*Dj\237XZ\002\025\357\330C\207\302\021\274\237\247\f\354M\233"
+	.ascii	"&{~x\2249\310n\025><\203Z\253\"\307=\036*\340w\377\330\336m\237"
+	.ascii	"A\301\370}\204\177\243\007aT\246\244fn\t\267\267\2638\276\331"
+	.ascii	"\360`\360\001G\250zH!\216\373\204\313\305\214H_\037\307_\r\305"
+	.ascii	"*_*\013\352\251\026Aa\026w!\252\340]"
+	.ascii	"^\240\352\356\225\004\3508\212\317\350\317>WdX\007\301\231\210"
+	.ascii	"\364y\250\001"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.52.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\203\007\315#"
+	.string	"\266=\327I\220VN:\007?\364\212\225\302\200\034\037\276c\320\325\017g\346\301\337\017\257\314\240\327\032TA\206\314\336V\263Q\003\230\247\222\261h\233/\236\002\022\220"
+	.string	"<\t\221"
+	.string	"\214\245\\\037\013\330\271\273W\335\337\314\314\314ZB6\221R\246\276"
+	.string	"\254"
+	.string	"\310"
+	.string	";\224\257\253\374\\\345\243'\377\254\374j\362\315\312o\223\317\315_\002/6\316\f\304\245iT\\\226\324\254\212\305`V\366\322\310\342X.\017{\343ul\215m\353\357\341\347me\336\233\376\345*[\244(\213 \307.\2664M\207\315b\233\026\370\363\365x;]\016=\253\331\334\364E\205t\310\244\323\002\177VU\354\353Q-\217\352\004\357t\253%U\202s\346"
+	.ascii	"*C\260,\023)\023f0\n\006r\267\026\200\226\324\024\243\250\320"
+	.ascii	"\t\340J\204\325V&RV\274\344\0076\177I(sgk9D\362\211\033\305q"
+	.ascii	"\2274\236-i\232\356\225\224\225\311\250P\232\246gdR\304\276e"
+	.ascii	"\377\025\376O\360\243\301\337\027[o\341\350\350\334\312\215\216"
+	.ascii	"-kp\0259\356\353\265\300\031fN\374\266\335X\013\366\r\302 \220"
+	.ascii	">\276?6-+M\361\365\345\361en1\234[\317\310\364X\226\265]\377"
+	.ascii	"\227=\002\b[\232:m\025#S\001;\037\030\356\337\034\253\003\303"
+	.ascii	"\367\305\221\210\274\310\255_\342\271u\373AZ\215\251\"\307\375"
+	.ascii	"J#7\326\277f\332+\376\312\017B\371?\225\357\203\362yP"
+	.string	"\276\216\311\3171\3718(_h\362o*\337\246\362kN>\r\312\237A\3712\225\037\254\374\230\223\017S\371/&\337\245\362[L>\020\345\377*\337W\371\275\223\317C\371\001\300nA\203\002ltl\255\307\366\302\312\320_?1\323\220U\212\277\356\t\03333\266\323\331X\337&:\025Sh\250U\237\366\365j\335\311\236\354\354\265\257\205iPZ\274\356)X\263%\274\336\255\r@U\245V\205\203\353\247}\032\275r\204\323\365\256\177z\225k\312H>\371\361\345u\303\377\002\006\274\310]\357\030\333\351\337\262E\322\240\203\003\007\347V]\327\261e\333\225i\232\232\215\365\334\225\216$O\354v\264k\347\232\006\f*\313\310q?\033}\260G \344\322\364\251\300\267\310\032\211 a\302\204s\353\331K\346\202\313\354\272D\226\254\210\302\320\320\271\325\354\335\2016\305\335\275G\270\237h\305\212ri\232\026\370\n\331!F\001\277"
+	.ascii	"\264\224\341\210i\3030\211\210\204D,\262y\021\020\007%#&&\242"
+	.ascii	"\n\303%%\342R\222\321\3220\351\210\biX\244\2644\004\3029Q\203"
+	.string	"\221\322\220\211HT\032\362\224\3055\267WlmNl\313\254\330\306\357\216\275\220\t\324\341\243N\367\210\235\340'\324\211\027\r\265_N\343\364^q1\247{\320\2468\215\303i\224HW\033\220\355\211\221\360\t\337\204\335\023\366\326\373r\203\343\3354P\311\023\273\261\3354O\306[\033\331\231\n);0,Y\202Q0\220\272\240\266\331\263\255i\233\026^\241\351\232\003\253f\205\306\352\006O\007\311\364L\363\364r\315\364\016\025\231\256ckmS\003\252\220\214\310\005\273%\246_:\3304d0\035\263L\203\351%Cs\351\227(\b\206\\z\273\\\004\200\233\250a@&\221DC\")HJ\222a\r\340\002\031\241\251:\021\020\245\203\n\241Xh\243}\003\013'%\030\2172R\277\007\222\256#\036/\227\301\242\272ua0Y\225\311\275\341R\361\313\310\334S\343\220D;c\233\230\317<\225\347\371\034Bw\027TAc~"
+	.string	"7\003\271tU\276\231^L\215\303\020\376l\305\251\336 \356AlC\036\201\213\262\252\354?\351\365+2F"
+	.string	"c\337\211\333B!\364e}\235\373\325\364{\006\236L\363\210\250\224x\372\275~\005\243\032\t{Z\314\303k<\276A\r@\t\335\333\252\370~\025\321\"|`SA(\331sk\017\306\201\240)\256A\341\230c\360\372\234\030\020~\035\2132YS\270\005\306\017\257\377\316\257\305\365\367\243\331\310\276\262\306g\254\242\320\202{8\315\353i\tgeG\"Qz\347\352\022*\025\n\341E"
+	.ascii	"4/\340\032\223Z\346\333bX\244\264\024/Zt\237\316\033\002\276"
+	.ascii	"\310k^\202\334\260\034\330f\260\\\016\310\261\233\205aGV\003"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.53.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\366\003\335\031"
+	.string	"\206.\244H\300XM:pI\3144*\374]$\254F\310 T<\260\024\003(\254i\231\324_\315\347\205>\354`7\325Y\376\031\242[\240m\205\020muXl\214m\212\202 [\2627\202\346o<`\267\374ab\t!{\023\271S\n\213"
+	.string	"\201"
+	.string	"\230"
+	.ascii	"\306\261\303\317\207\266/\355\3578\221\316\213r\f\326\n#\311"
+	.ascii	"H\2559\b~\360}\"\270\212~v\227\241\237\326\261\261<7\243zA/|"
+	.ascii	"\220\272\324ZW+\343:O\201\237Gg\267R\307\367h@\333m\347\251\004"
+	.ascii	"\240G\003\343\004\213\177+l\230P!=\037IS|\206\267Z\200\333\b"
+	.ascii	"\331u\rpN~\002\334j\235\nJ\f+\341\255G\256\223\t\026\035\202"
+	.ascii	"Z\353y\\\222\270\321\244\364hj\255\226\266\333\211;\274m\034"
+	.ascii	"\266+\330\353\024S\256\007\244\224C\205\254\265\356\354\216\216"
+	.ascii	"r\027\375r8b\352\221^lw\370\017\327WkO\004\337\307\221>\370B"
+	.ascii	"\237~\301\344m\237>\214~~%\214@8"
+	.string	"\242\"\036\031e\347hrG\373]] \333\223VQi\231\027\3751+\035\256t\312\223\006=\351\317\223\366<iJ\245\347\224\356\246\364v\322r\245?`\001\020\256E\320\214\205\312\325\022Q_j\323<R\303\357q#\234\347\314`l\302\355\370t\347q\001F4v\264D\221Y\325z\\|\302\314\215Y\231\275\321\273\0337)I2~\f\321d\224\241\3444\315\235?Nr\334\333\321\310\273\025\237\314>\246n\273\245%Et\307\247\327P\233\302\231\324,\t\177\222t\331\022\263\266\205/\345$\2710\016\341\210Z\3743\212dv`\312\021\360I\251\313\026\007F@\224\314\317\350\256\364rT\005\303\223f_\2555\202O\344E2h\330\260\201~\356\036)\350^\032Qb\250\333Q\336\206\312\025\217\250<\310\205\330\370Bf\265Z\364\001\3660\023\003\341\222\315V7\260\327\013\306\"\020\253i\275\\\025d7-Q\234\261"
+	.string	"\2305#Bl\311d6\034V1\021\026\273i\305V7.\233\327\212%\306V3\006\f\013\321\022W2\030L\\\2059\236wu\201(\240h\342YZ\352U\250\\\307\020([\0260\\\250\032\005S\244\\\261e\341i\362\324\206\373\032\016\334\324R&\034\027H\352\267\3402"
+	.string	"S\323\241Zo\277-\300\245f\203\256\237n%\352\255\201+\265!\332\322\365\276\fI\362\t\343\\\255\365\333\321\235\223P\324'P\325\006K\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.54.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\230\002-\022"
+	.string	"& sG\340\320(\035\332\2030"
+	.string	"\036\231\363\207\354J"
+	.string	"i\351\022\361\246.\031\212\355\030\231\034zvj%\245\377{\264\177\034\021%\254\252\372C\375\204\371\001\201y\022\241l\203\370\300\023) \334\225\211F\220\260\330\310&\204H\231R^"
+	.string	"Z"
+	.string	"]"
+	.string	"\337\273\227\374\262\215~\013\261\221\246\307e'\307\356\202\n\342\257\177\220\276\350u\234\346\313\217$\244\031\215\345\037\"\244o\350\205\003\027B\342%&c$\361"
+	.string	"#s/"
+	.string	"\315\245D\273\220]Kr\262T\333E\206^d\270\220\335\375\315\023\003-\226\031Iv\3279\243\301\334\245\333\316\261\315\300\316\226)?\261\372ve\013\374\333s(\3705\357\334R\311\317\336\371*\336\273k\224\315\320a\203\345\221}\213\245\326\354s\2533\366q\356\310\2459.\255\232\316L\277$\200\005\214\0064v3\034\361X\241\356\307\3468\267o\302\267%P\360:\316\312\267#\"\017\215\317\215\335\233\201w>\020&&\336\273(\303F\016\034\236\326\374\236G%\360!\206\016\021H\332\246S~\026\365\266\337FC\007\241\230\262\330\267\335\355V<U"
+	.string	"\266\2538\317\212_\343\020\205\362\336\251\276\210(\006\226GyNk>\212\227\232=RO\201\262\223z\024D\271\273,\2525\337\202w=\321\251!\313\035\266\003(UJ\2252\245\204\017B\224\311\245\nO\254\320\301"
+	.ascii	"\237F*\260B\227\313t\002\266X\253\226*l\201\252\224)\005<\261"
+	.ascii	"Z\340H\001\257&\204,\320\265Z\261\300\322\rv\235\361\315?\240"
+	.ascii	"\026B0\215}8\2103\n\"\335E\021\310\356~ZsTN/B\347\005\204\003"
+	.ascii	"E\370\341\024\301\206\242\022\266\230/\361|\237\257(\221\020"
+	.ascii	"8 \320\002\251!\363\263d\221\263\355o\262\237{\333\367n,\256"
+	.ascii	"p\344\346u\3672e\241-\334^\2755\3541\b\305\225/[\371V\215\270"
+	.ascii	"\360\255\273\360`\375\222/\372s\233U\244\313\200\354Y\246\322"
+	.ascii	"\356e#\233\371\250\332M,5\024=\036Q\203\006r\202\244\025\311"
+	.ascii	"n\321r\\4ap/\2702\234\263\002\023\334\202\033\355\205\241\020"
+	.ascii	"z\273\321h\365\325\243]\207\217\3452"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.55.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\b\001\305\f"
+	.string	"\266\327UB\020Q\234\016\030\016Op\215\0020^\246\241\210\275FD\320\337\212\001 \246S\206\200%5\372dM\203}\255\244\01660\331\223\322LF&n\025\001&\027\301\230c\rG'\216\256"
+	.string	"\354\273\321&{\247\024@"
+	.string	"A"
+	.string	"D"
+	.string	"\340A$x\262\273\301\004\311\256H\300\003\260\323\313\001X\247\325-\326\251A;\306E\017{\024\214\n#8v\267\316\016\007/A\377!\237\204\244\320\345\205`w-CR\351\236\267-\300\366\001\373\032\002\037\366\224\306n\272\257\237n\353 \177E\261\224\274H\340b\367Bj\307\2164E\210\233\376\223}\321'q\221\023\350\222\"1\200\231@\337\322\336\202\016\224\214\222]\021s\352\002\330\351+\266/\355\213\370\210\024l\214Nh\327|\215\017>\352%@>\b7\330\344\303S\177\263N\255y\221W\0327rd\020\311\224)\262\232v\207k1Nx`aaI\373\003A>\264T\261b\034\315\220-\206\344\344`\277\332\335\365\f\033\215\344h\244\307@\353l\013>\217\326u\237\314\303Y&B\247}\337\206S\275\216\363<\232W=\333\246S\263\316\253\231"
+	.string	"\346\034h]\3758\256\253\025q_\355\374\260\202\031\243h\216\214M\024\331C~\f\327\264&61#\001\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.56.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4`m\322\001(\033\314\210\232)& \275\230\226\375\023%@\350*L\233\267\026\265\264\260\222c1\325#\364.+Q\001N\263@\350XK\240;b\311&{\247\024\266T\030i]W%\001N\031\347\305\232\360\242PY\200\0269a5\340\310`Ix\305(\341T\367\316cs`\322\356\346\324\337xm\360+\376\214\301\332\351\237\217E\177\004\033\347`WMs\022\366\241u\036\273Q\037\021\004\220]\210\023\223\ry\037\026\2663\366\344c<#\343L\240Rt"
+	.string	"H>\017\035%\273\025\272> \372\223NE\177n\342\331[\346_\343\320\205\307\b\345h\336(\007\273\353F9\235\333\335v\201m\003\333\021\001\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.57.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3pM\322\001\240\253\0163\360\030\f\277<d\316!O\204\3020\214\260\376\326\220\266=\034\031\265L9\251\231\373\337\365/,\243{n\f\0037\226\354-eJ\001\306X4P\252\252\313\302\243\340De$\352e\030.\r\017\003\251g1\360\344 \301WM\023|Q\334\353'\265\342\321\007\373 \217\226\257a\315&\177\335\371\033\350.5\240\302\223\231\035;\251\027\366\333\352\307v:\265\200\342DAdW\"KY\023G\262a\233cG~\307=8\266Z\314\300\004\"2\210\020\224\335\370*'\200\356\332\007\240;\305\270\365\264\374\177\274q\224\214\\X\347\t\220\260\273\316\013\233\270\365\266\017l#\330\266\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getVoltageState.58.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001\300\216\002r\212H7\374\231\226\375\023%\300\240\t\273n\205h\026\365\036N\262\033\350*\2417\245\303I`\216B\236\213U\013|\267do)S\n\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373 \217\227\257\341\r'\217\335\371\234\350.\025\200\342\223!;zR/\354\267U\220\355t*\201EI\202\311\256D(eI\234\310\206\355\216-\371\035\367\350\370j1#\013\200\210x\bA\331\215\317\362\201\350\256] \272S\214_\317\313\377\307\033\307\310\t\226y\236\025\204\335ub\331\304\255\267m`\373\300vE\b"
+	.ascii	"2\003\316:#f\b\3055\2216\004\216\031{\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getConsumptionState.59.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203"
+	.string	"3\017\356\340\362\251\205\200e\375\016\3430\237\266B4\213z\017'\331\rt\225\320\333\022D\0058E!\317\305\252\005\276[\262\267\224)\005\276T2p\262,\213\302\253 Ua\246\352a\026,\f\357\002\253W)0\3250\301gQ\024|R\334\353'\225\322Q\007\373\034\217\227\177\341\214&\217\335\371\232\350.\025`\242\223!;rR)\354\267\325\217\355t*\001h$\341c7\"T\262\"\316\003\303\366\306\226\374\214kl|\265h\221\005@x\036:Hv\343\243| \272k\027\210\356\264\342\327\363\362\277\361\006\002\t\3012\316s\202\260\273N,\223\270\365\266\rl\037\330\366\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_batteryStateStrings.60.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\331\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.61.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"5\t"
+	.string	"\006RA90\221\322\001\203\264\221\021\370\250\313j\006\237\330mYa\316\363\023\351T\376\340v\366K\177)\205J\210%\333w\306\306q0P\210\001\337=\306\217\0037\b\260}\262\311\336)\0050"
+	.string	"0"
+	.string	"0"
+	.string	"\255\325&\245\205\001\223\331\255\324\365\002\333'\347\001\333\247\344\270\351\321\344\377u\255\246\205%\245\252x\3340\354\256cJ\265\272\345m#\330V\260\035\023\222e;Z\312\350\250\r\254\2744\250\354f\314h\326e\306:\374\221W\322E\fp!\363\330]\356\323&\331\334\347\355\222\315\371 \017)\331DP\003' \355\256O{\242M$\377z\002\214\354#v\222\227\200\276\313\022\243\370\324\247?\332>\243|\375\001\314dF\343\024gvEE\271a_\333\335u\376t&\276.\f=\016\024\374<0\324\2014\364\340\001\321\317\007\322N\201\275\210\356\243\241\347}\224\253\247k+YR\032\234$\312\266)\216\002\301\331\265X\360a\017\013"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}p\231\002U\274\202\212"
+	.ascii	"L\334iS;\311"
+	.text
+	.section	.gnu.lto_batteryInit.62.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\301\003\335\027"
+	.string	"6\347\217I\260TRc\261\271K\256\244\273]\333\036AF\214\302q\242_(&\372\232\3018\347\302\313\240\312L\034\366\370Q\263\304\2034L\215\033\371\0176\343i\216\262G\313\017\244\3027\365\005\202\375\261v\007\327\027\214\3116\271\367\226)\005w"
+	.string	"y"
+	.string	"~"
+	.string	"K\\\002\331\265\272\276\372\002N,\036\277*\204\335+\"\331\344\026\317\251#\333\247\031\265\275\0165t\037e\2643<\336{k\245\320\321\313\354i\226\025\365\353\220\2604\330\273,\003\227\255XL\322 \317O\017\001\202:v"
+	.ascii	"\021\221\305Ni^x3\306\017\2514h\342\245y\""
+	.string	"\266\223E\013\376L\005:G\024(A`\2552\227{\257k\032$q\317n\333g;\201m\316\002\257\212\241\002\240\023\344\230e\n\347\201\233r\320\002\3512\326\266p)\231\224\255{o\213\217\3439.\370E?=c\263\031\2157\036Es\263\221\r\2154\326\257q\0334566\366\247L)\353O\037\356nxgP\326\222\217\263\276\214\317\300m\320\351\354\317\323xu4\277\263~\323\235v~\2219\360\352\323\237>\317\376\\1\332\352a\002\363\325\244\r\365\253e\220\3752\231L\006\350\021\232\204&\241.P\245\260\235\325B_\360.<\002#r\251\246W\305.\275\2124\017T\033\025\242M(U;\212\277\2627\033\272#\356\317U9\251z*\366*\322Z:\234|\312w\260/Sh\b\001V\261\247\003Y0\273\027\330\342c\275\310\240\301\313\213\375\371R6\354\202\341T\240\236\351W0\263{}O\375\036\367\361"
+	.ascii	"\002\f\214\375iG\220P\237\272V\371\024\201e\317~\214\265'\004"
+	.ascii	"\266\261\360r\267\234\234\031\f5]\016\247\303\271\351j85375["
+	.ascii	"NWc1`\234\206[\256\226\203\303\345j4(\337K\240\013?\263\272*"
+	.ascii	"\372\312\237\377uS\226\302\212G\311O\254JX\025\310#9\001\261"
+	.ascii	"\023\021\211\250\3160\377XC|@\272?`~\022{\315~4\310\376tM/\b"
+	.ascii	"$\322\217\330\366*O\020\227\356\355\275\207\366\003\254cB7\202"
+	.ascii	"\256(RK\331pl\205\b\232\304\365.\324([\250a<\313\224#VAJZPJ\007"
+	.ascii	"\260\002\021A1\017\0210\275\224\214\2522\215\001\002\216\034"
+	.ascii	"\274hILq\344\033z9\211\204\302~\275\024\2323\227\020\0360\220"
+	.ascii	"\254\300\006iy4\027\005kH6)\304\002\002\020\325\371\277\207_"
+	.ascii	"\001\013\004C\017\250@1\001\340\001\375\225\226\362\204P\002"
+	.ascii	"\2044|%p\272\337;\300.4\nH!&$]\017\276{\247\026\003\036\265\376"
+	.ascii	"D\017\267\234\030>NB\n\035\300?0@3\270.\345/q\035\2320\bX\350"
+	.ascii	"\n|\r\313\261O0Z\260\205a\031h\334)\021\220\277j\367\371\316"
+	.ascii	"7\230\037\200\333\347\240\373\204o_=\251\013\232\357T\001"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.63.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\274\005-$"
+	.string	"\252@<\016Cp\252Mc_$XM,W\\Y\216\332Ch\005\372\355B\301W\004`7\023\222 0q\205\254\032"
+	.string	"[\207/Y\223@J0\005\225\001\240y\3261\320\315X\016\034E\271\016\016\364\265m\357\275\267\224)\005\316"
+	.string	"\303"
+	.string	"\332"
+	.string	"b4p\250\021\207\036N.6\220\200\303K\205B\215\315\013\302Ig8O\372Y\256\345\306\207\276!ACO\3327l\364dEm\277\332\367\372Wz\260\034\276\335\233\245f\354\336\241\004G8O\"\375\250<9~@y\322\251\275\366\241\222{1\\\301.m\367\336\234M\362\364\350\320\3554Kr\2645\365\237\216\346\252\242\f\255\225yu\335L\245C\005\371\211$e*H5\307\007le\376\034\316T\325x\344\343\211\360^\202\2654\225\302\336\301I\231\036\362YSC\244\206\250t\224F\013\262\246\204\214#\205;i^\200\262~\f\271\035+\350h\263\302Q\001G\242@A\264\207\275\356\240\212\252\325T\272\367\272\n\251~\334D\267\335\306v\317&\227\0028k\372\t\026\252\266\310\032\331k9\007)ViV\202bP\242Nv3$\234L\230(oH\320"
+	.string	"\331\252\255,nF\002\365\303\217\2518\357\205\272\320\037s2'\374&'\235B\205\212r\305R\275\320Dk"
+	.string	"\021\201\366\311t\306\300\260\254\325\262\256\274e\261\245\016\260\006\262\017\346at~\023\357\\\324\013]\224'o\257P\301s\365U\005U\213\3660\252Z-\373\266X,\026m\217\330e5\202s\271\217.v\0130\253\215\320j\334\301\376\"\264\372\206V\237e\265\211V\227C\325\344\255z<\253\255Y]\313\352'8\037\2546=1\310\334\353\2438\350\022I\262\255s\371\305NVk\337\376\320\357r/F\003or\322\251\223t+\335*O\222\026\200T\236.2\250Z,oV\353>S\004\r\236\223\251\034-\321\332\026;\r\252\321\323)\245\235RI\255\324\013G[~a\001\355\323\027\224M\001b\322(\005\330\002fV\214\360\211\303"
+	.ascii	"K\372U/\024`\357\345\3372\353\"F\2719\221\031\025bi\247N\032"
+	.ascii	"v\340JA\305Y[\303\006\234\031\221\263\371\325\214\265\261=UB"
+	.ascii	"\236\263\203\215\213\214s\264\313\361\332\005\256++\373\016U"
+	.ascii	"H\364\337TW\341\355\261\006\312\305j\343\237\375\035\312\223"
+	.ascii	"\".\2364/\256{\257\203\233\371\336\247_\235J.\205\2664\257\266"
+	.ascii	"\213u\035\240X:j!\333\036\256\346\303y/\320\202\237\346e B\214"
+	.ascii	"\030Q\236\264\326\024\233\323\005Vd\317<\251\242\344\352\313"
+	.ascii	"\312\310\006~\221\344\223\001\343\347\224k\34211\361t\006|N\277"
+	.ascii	"\245\037\211\337\316\327\242E\210\235\214\337\217\327{\361\303"
+	.ascii	"\371L\354\230`\224\3705\355z=']\221uI6z\273\337o\211E\316\327"
+	.ascii	"\343\371\232v\276\\\023\214%\246\234\256\347\313%%0o\306\256"
+	.ascii	"\227\373\361x\275\034:\204\272=\342j\243|8\267\322x\357\275h"
+	.ascii	"\275E\334Y\021\"p\315\037\366\3638\033B\034\262Z"
+	.string	"\256'\204\023\251\231\235\231\021~\263;\276|\220 #dI\365\310\336\354iS\2554I\275\320HA\373d\004\366\f\240\026,\364'(M\213\300\272\006\253\300\374\217.]\342\302\264\023\252\364\351\252\252Qu\237)K{d\253\232\324UT-\232\264\245\035\375H\235A\325b\322\371\230\314y\357\305\340\353\371\236\224\211\003q\250q\030\350\230bfff&\215\244I:\200\002\0212\243\036\020p7\243I2\214\001\315\2729\344:\035\r\b\205\b\3148>\333\032\232\004 Keh\0177\273\340A\346\270\341)\322\350.\346\366\034p\036\202p\241R\350\317\233\002IO\007\217\234\303\215p\306i:\217:\364#\361\212d!\"it\272\027\322P|{vj\335[\250g\205\351r\237m^u1\275\376-\026\224\267\206\246g\354\0205\247ct\226|jw\214\013\355\363z\217\301\267\"\241o\200\223\030\236\254D\214\366\340"
+	.ascii	"E\354\001NCy\301\021\372\r\274\t\205\206x\270n\207\270\246\271"
+	.ascii	"\021!\235\323xa\035\330\026\341\006+)EQtv=k^\3771\301\342\252"
+	.ascii	";\361\362_r\024\006\305\366\257\263\003\212\216\243\314\215>"
+	.ascii	"\021\2773a\311\366\250\250\343\002F\336\250q\370\024\\\024\211"
+	.ascii	"\245\006"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.64.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"]\013"
+	.string	"\266\025N@ o\233\016\200@<0\255\021\340j! h\304\365'g\200\244t1J\002\0231i\227V\033yks\007f\345\336w\002B{`\n\201@\305\243Z\341\002\001\035\234\006\310\215\242?\331[\312\224\002:"
+	.string	"="
+	.string	"9"
+	.string	"$Z\354.U\271"
+	.string	"\351\021>\200\364\250\033\236\035jf\276\344\002=\204\234\340\272\320\341d\341J\3516X\331\335s<3:Q\246\344\262\273N\256\253p\307\333^`;\201}\005\001>\\\325`\353\275;\237~\234|\210\240\370\250\330\2350\"\262\036\261D\207{\277\235\371\034\236\334\3637\205(\f\220"
+	.string	"\202a\305\356\032x\364\201\351\321\007\361\020\231\375\301\021\207\215\203\\\300\b\"\350\213\264-\by.U5\364T\325\360H\327L\307\307\226!\266\261wx\246\335\r\201/\342#\"\370\033\217\376\200\362\334\243\017\222\036\257\022\214\357\203\247\345\210=\022\245j8W\345"
+	.string	"\243a"
+	.string	"\300\032\313\347\252:\035L\206\302.\013\343T\030\305i\200\331P\232\013\243,\004l=\250.\252cY\0275\031i\207\232\272a\221\"\375}\355\334v\265\002\252\031\266U)\031Lxh\032\023"
+	.ascii	"seY\203m0bf\202\007G\006\254\340\006[\260\013\205\035\3352\031"
+	.ascii	"\272\206\207L\220\240\342}L(\213\332\006\270\006\215\302g\250"
+	.ascii	"!\333U\312"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.65.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`q\004\325\035"
+	.string	"\206x\302H\240VN:\325\313)\255\3017F>\025\247\363\213\317\363\360\312k\007\226\003i\306I\023\373\355)\351b\252G\342K\260)lR\3006}!\\\303\035\361u\372\372\274\271)\221\234\227\345\017%=\224\312y\243\210\335\233\310\235R\252"
+	.string	"\234"
+	.string	"\265"
+	.string	"LF\250\221d\212.[H3*\244\352]\277\326\247}0\033Y\213\343\370\227}3\211\353\360\013\2132\254\017}/\337\316\365\034M\357b\032\311 \243\224X\226\203\361\224\3469\365t\376\246\236\332$\354\333\351\264\233\374-\337\256\025\034I+\033XUU\032Ir\03585\202\361\324\n\02649x\256\030)j\025\215\250\257+$\311\225[\252\007_\251\2703\350\333\036\210X[\216H\tK\274N\235\302\b\247.\342\204&nB\250\271^\237(\204\245\b\200$\311o}\236\020>\315i{@\222\244\247\224P\305m\273m\020\266\221lQ\030a\007\302\363g\234\332CRR=%\332{]"
+	.ascii	"\325\030\226\341$I\262\304.\f\007\353\267\203W\024\250\231\305"
+	.ascii	"~\217\373\b\3723\374\2417/\325\253\247_\033\325XV\013\247\331"
+	.ascii	"\305\346z\232\013\303\276H\356\013\333\250\350]7Q\235\036\272"
+	.ascii	"\326-T\247\203\306i\240q\372\247N\373\324\351\236:\315S\247w"
+	.ascii	"\352\264\216m:g\234\306\031\247o\306i\233:]S\247i\352\364L\235"
+	.ascii	"\306\331\246e\306\351\030\333\364\255N\303\320\351\027:=\326"
+	.ascii	"i\033\235\256t\232\322i\261N/\235\236\342\364\003\fM\005_\232"
+	.ascii	"\025:\223Y\334>jM\302\227\354\3061\231}\031\224\341mc\226J\211"
+	.ascii	"Z\233p%LH\236\244\202\205\013\027\352\351m\023\330(\313\032R"
+	.ascii	"\2365\032\240F\366\204\006\266v\340;\313\263\236\245\0257\271"
+	.ascii	"\213T\230\335\331\203]\274!\003I\r\264\035T^\026f\305\260\222"
+	.ascii	"l\334\272/\373R\211m\307}\231f[\240\"Qkb\347a\034\024I:\031\321"
+	.ascii	"\255\373sV^\211;\227\356K\253\247\331\305\273\342\362,)\323\214"
+	.ascii	"\341D2\214$I2\360\205|\210\206\r\0348\324\323\335\023\2012$\332"
+	.ascii	"\271\307\322\202V\246]<S%Z\240\255)\326]l\267\340\tIB1\360\003"
+	.ascii	"F:ZB\002\352z9%_\257\347\333\3710\001\223v\272\020:\b3<\017:"
+	.ascii	"\240\022o\367\343Q\250\361\356\210\351\307\003\002u\035rK?\337"
+	.ascii	"\222\022o)\247\224\244\353\345v\277\245\334Q\220}!x\277\034\320"
+	.ascii	"\347\373\345n\\N\027\277/|5'\264\350\205\213\032\020\321hETY"
+	.ascii	"\233\377q\241=a[h\277\365\243p\261\302\314i\237\304:\263EeC;"
+	.ascii	"c\344A;\264\377\002\332\240\025\303~\026g\201\326\300Wy\303g"
+	.ascii	"\177z\226f}\266\001\227\362\n\267:\333\263\271\257\322*gu\"\234"
+	.ascii	"\211Y\316\3163(C'\002\365fq\266@Xye\2631{\263=RJ\253\232\265"
+	.ascii	"\241Y\334\326\354\313\253Q\250A #\221AJ)g\"\231\321\264\260\325"
+	.ascii	"\200\002\031#+\017\020XfE\311p\303cE*3\366\213\312s\226\322\306"
+	.ascii	"}\2363G\205\332X#b\001\270*,\254\343m\306\3741h\204\"\222/\032"
+	.ascii	"#\205x\351u>\027\361\356\377/r\f\r\235\362\017\300\271\305\331"
+	.ascii	"<~,D8<I!\233_\nsX\027\rP\233\r\317\212\320N\260\t\245\223\236"
+	.ascii	"\0348\250Lz\ti\201\315\032\264\025\345LF\003\006\242\331\322"
+	.ascii	"\223t\360\214\302\357z\200\320\211\257\373\324\206\2620\332\325"
+	.ascii	"\203z\256;\376H\tx4Z\":*\252;\237\330YRD\276\177j"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.66.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"5\t"
+	.string	"&\021@90\257\322\001\204\361\024E:\t\307\bpM\320\373\360I\026r\3712\214@F\227\302\234\037\332\376\251GP\213\355\r\363\245\241"
+	.string	"\215A\212\237\323\211\021g\202\226\255\221\275eJ\001."
+	.string	"."
+	.string	"2"
+	.string	"z\3625\236\335\375\353\0330D]V<J\203\231\211\213@\250\222\003\254\f\360\257\353D\370\251j<\273k\005C\212{\273\355\004\333\007\266Q\002Z\263c\237F\013\373rc\313\276\372[\001\207J\304\313.\253\026\263\262\355D\303\3669>\331-\217\271\366$#+\021\230\335\235\361\342\247\313\030\001)\033\262/\242\356\242\315J\242%2\217\240\220\025\225\322l{\007y"
+	.string	"\330U!\370\037\207A\370\030\337\\2\351\301o\276)\363\355Q\263b\361\200\245\002\016uJ\235\210D\372\200\246\327q\336H\344\315\321\302\207a\206:ov\b\3145\210\272I\342\270nrb\251\313\215-+t\310R\361\223\033\2659\007=\350\r"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"]\303\t\230\340/\343\022\227\313\224B\355\001"
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.67.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"5\007"
+	.string	"\"\21624Pm\323\001\244\005\312(.*\263\372:\t\213\340\351\341)&k\207\376\203%\203\344\356\261m\314\360Qg\317\314\214\025\f\257\365\n\002\322L4\310h\023\271S\n\266P,9UUE!NI\315\3134\343e\241\302\020-rF\312\304T\303$cEQ2J\\vhu\243:\220\251f\177FW\325\310\203\351\320\354\360\215\031\260+\201\340k\274\363\340_\034\032\302z\337\016}+:\274NB:\331\353lN{Ja\037Z\335\330~\326\367|H\340\003r\211\354f:\222\375\200\034\034\333\227-\331\340\3402v\316\"s\216\007\3063\262\313E\2558\366\207\371\3178\374\224t\233&\342\017 aw\3756\315\304\255\267M`\273\3006F\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.68.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001#\333\332\350+\224\322\242a\007\006G\200\225WS\372\343P\334\232\250\265\316\021Y\306E\005\2653UU\305X\355\177\356\211\206\252\341\003\221M\244L)\346h<\260\272\256M\203\263\340\263:\225\345:\016\233\007\307\201\226\323\030\370AT\320]\357A\227\211\373i\225dE\020)\205\355\210\223`\001\273\273\340\217<J\370\035o\366|\362\331\233\377Q\001\021Q\226\354\030J\315\260?\255\222l\247S\017PV&Rv-J0\253\322N<l\203\354\214\377q\020\220\261\214\034\027\224IKE\311\313nt\003/\240\336\362\004\324\233n\034{b\376C>\271\304\260d\243\320\023\200aw\235\331\b\343\326\333N\260\255`[#\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getLegacyBatteryVoltage.69.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\275\b"
+	.string	"6\021=6@\217\322\001\233\276g\027\255\020L\344\252\021\244\023\247\373\232\274K\304\314j\344\376\217Xgm!\006\257\223\232\3603\214.\245A"
+	.string	"qP\005[:\255vo\"eJ\001,"
+	.string	","
+	.string	","
+	.string	"P\265*\245Zv\271(p\002\370\227\037\200\177\232\361\355\271\371\017\371\353\350T\246S\350\211a\330]\247\351dq\353m'\330V\260\275\n\\(\025\303\276\265\212\262\235\206\232\2664\255\232\316L\037s\300\242\262\225\354Rt.\233\362L8l\203\354\214\377q\020\220\267\3444*\002\357>\201\251\252\026\n\351b\224\235\257\251/\2758\342$\033\300\356.\370#\3474\177\343\317\022\237\274\351\317\377\300\277k\301\212\210(;;\346h&\262\313\343\3314D-\303\264\316\245\305\216\303\346!r2-j\f\214A\\Y\364`X\0263\334\336ZEAE\020\351\310\226\302"
+	.string	"UK_\212\344\021\f"
+	.ascii	"2\241\347\037\230g\002BE\027\004\207f\214Cu\265k\342\372\b\235"
+	.ascii	"\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.70.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514Po\322\001\223\362$,\004\252\253\332\263\301\361\021`\345\325\224\3768\024\267f\215\365\236\221edo\250\235\251\252*\306j\377sO4T\r\037\210l\"eJ\001\326`8\217\272\256L\203\263^em(\313m\0342\017N\363,\2071p\005A=wU\325s\227\270\227VEV\004\220N\330\216\370\b\f\330\335\005_\344Q\302\347x3\247\223\307\336\374\216\n\204\2002\263\343'\025\303\276\264*\262\235N=hA\201)\273\025\331hO\232I\207m\217}\361=\376\3411\314\270a1\225\214(HXv\243\033x\301\364\226'\230\336T\343\360\t\375\203\\R\311V\260\320\347\t\300\260\273N,tq\353m'\330V\260\235\021\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.71.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375 \352\215\006"
+	.string	"B\314-3pM\322\030\240/\200\325?X\020\207\374\245\277<E!~Q\362\216\2565\202\264\355\341\310\250e\312I\315\324\377!\013@-\023\272l\021\360\333\220(\245L\001c,\2327Y\326\345\301U\217\2522S\3452\020\227\b\207y\225\263\030LIL\317Y\024\365\234\264-*(\365\240\243\236G\021\034\271F\2175\233\304\f\243q\023\200Q\352\200F'C\277a\251\034\217"
+	.string	"\253\240?O%\330\260\320\360c\262\213\021ZY\224\250\344\343\347\274\364\002\003\347\253`\002KA"
+	.string	"\251\240 Q\331\335\234v\340\205y\215\030\202\016\236\317I\246a\230\002\r\273{fZ\006\256\370'\374\n\377E\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.72.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"5\t"
+	.string	"\366Q?6@\217\322\001\233\016\303c<\\\022\177\240y\340M'\013\262\207\321\367y\333j\266!\026\334,\304`\017\376VzK\303\243\302\245\341\032\336?\321\317_,!\233H\231R0"
+	.string	"-"
+	.string	"."
+	.string	"\022%R\306\303\342t\262\262\353\305\200\017`\207y\001\354P9\336=;\377\"ghU\240\240R\244g\266\260\273NT\n\343\326\333F\260\235`\037\023\036)U\303\376\265\252\262\235\3164\r5}]i\325tf\372\027\200\rV\352\024\337\356\305\307\262*0\245\303\366\310\306\370 \017\031\271\313\004V\275\336\272\211\307g\331\341\363\321\203U\3065\365\247\026k/\351.\273\253\340\223\334\203\360Y\207\346Dy\324\241/\302\016\257\004\253\221R~v\346h\"\266N(\264i\210\334\246q\240\016\027A\236\315'r6.j\n\254=t\266\030\322\264-b\274\375\265\252\312\324\240\244&C\315.M\205\372\211\017S~\001\016"
+	.ascii	"2\241\037(0\366\005d'YN\025\337\232,g,oe\346P\265\342\302\030"
+	.ascii	"\003\263\235\005\313\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.73.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"U\007"
+	.string	"B\21635Pm\323\001$\223\213!\211\312\243]\267\2600\323\226?\237\223%C\264\037,\031\304F\316z\260\322\303\2759\331\231)\322\370Z\257 FK\024\260l\324\210\224)\005\306X\262\253\302\260\313\002\214\227\0253U\204\031\206K\003\304\\\021Z*\266\034\252\013b\226uA\312\267]Z\365\250\016l\312\331\217\324U\225\022m>8?\234#\002\354N \370\033\017A\370\030\237\034\221\345\273O~F}\272VDB[\216\354\217K\265\260/\255zl\2475\323\227\002>\035\3369!\273\235Q\311\202L\036 \333\032\233b\203\003\215\265\177\027\035\201\214\212\215\210d\367\203\372\271\366\324\374k\\\201\343\214t\236\304s\222\260\273\316\316\243\270\365\266\tl\027\330\006\005\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_getAmperage.74.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\035\007"
+	.string	"\002N24`m\322\001@\203(\033\362\031\353\002_3(\006\354\022\b\224\025\f\003\2324\324{\207\232\354\006\272J\350]B\301I\n\313\334\253r\255\330e\255\311\336R\246\024\316\\6q\262,L\003\254\"Ui\246\nj\0340\0170\023+x)0\0051EhQT\204\225m\357VAV\013\246\037\333\021\017\271\002v7\301\007\371&\341k\374y\303\311g\177>G\372K\025\370\300rdo\236\324\013\373n\025d;\235\352D\031?)\331\255\030\245\254\311#\331\260\335\261+>\307;:\276\026&0\315@\204A!\202\262\273\320r\002\351\317}@\372\323\320\257\347\345\337\343\f\237l$\323<O"
+	.string	"\205\335uf\232\305\255\267}`\033\301v(\b"
+	.string	"\003\013\275\262\030\005\205"
+	.ascii	"]\303q#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.75.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"%\007"
+	.string	"\022\21624`m\322\001\300\216\fE\"\203=\035=\223\200\245\246\004\002eE\302\314&\r\365\336\241&\273\201\256\022z\227Pp\222\3022\367\252\\+\330\355\257\311&R\246\024\326`8\220\272\256\214\303\263`em(\353m\0362\020O\003\255\2071p\025A\301wU\025|\226m/\255\206\254\227LA\266%>\202\005\354\256\202/\362m\302\027\335\231\323\311\307;\2773\335\245\n\204d9\262\267O*\206}i5d;\235:\260q\242=\242\354Z\214V\326\304\225p\330\366\330\026\337\343\037\036c\f\024\231v\320!\252 Q\331\335wy\301t'\235`\272\323\214cO\314?\310\033@1%j\237'\300\302\356:\243vq\353m#\330N\260\255\021\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.76.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"5\007"
+	.string	"\022\01635Pm\323\001$\243\252\022\261\270\362\272\031_D\354\005\026\331\206zu\217}\362\332\374\323\247-\271BA\3313\203$\212d\277\275\002\324J\212\013*Xo\"eJ\001\316\\6\261\3020\214\003\274\242ui\252\013j\0360\0200\023/x1\260\025QE\210YV\204T\267\227VCV\213\246\037\333\022'\311\002vW\301\037y7\341s\374y\303\311o\177>g\372K\025\020\321rdw\236\324\f\373\322j\310v:u@d\301\035t\262{1Z\331\224g\"\262\335\261)\377\343 \035g\f\024\032w\320\341QQ\242\262\273\320\362\202\351O:\301\364\247\032\317\236\231\377\2207|@(\033\347y\002,\354\256s\3430n\275m\004\333\t\2667\002\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.114.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\246\001\355\016"
+	.string	"\246\232_E"
+	.string	"\223\223\016\343\023\250\021U9h}\023\221\220T\230G\020\241\221\304&O\233K\366?L\310\356\275\260\254\3653"
+	.string	"\326H<\032\330\240D\017\366e\250\277\352\3732D\030\001\257\233\347a\203\f\024K>\331[\312\224\002G"
+	.string	"R"
+	.string	"I"
+	.string	"5v?\223G\227`\217\007N\340z\204\037p=f\217Oa\333\304\301'{\307?\325\276\006\210\213\rkw\265G5\361\3235\341\311?\315=\251\227\013W\221\027\017O\001\207!(\273k\354\303\035o;\201m\bv\006\b\273\241\265\263$b\216\214\013\223WPZ4d\2007#p\250`-\206\217\3046oQ\362J\201O\325!d'\004\017\037\254\335O{\364\207}\346.\275\306\212\323\312\356\2570\3714\316fL\377X\222\301\242@\220<:\323\376\352,N\377X\354\331-q\023\237\021\325\356.\360e|\006hKI\271\036S'\325\343\232z\227 v\3501(`\273\253\300\177q\030\"\377\304\2439\225|\352\321WQ\017\352\006\212\025*[\2511Vx\270\nc_i\030\323z\2453\246\217!\220\031\021\261\001\236\340=\330D!\007\244\321\326u\026@"
+	.string	"\f:)u\033\211\364\221\240y\035\347\2156O\033\205>\"\r\324y\332\211\001s\025\266N#q\\\247e\266\363p\025\306\rr\350@i\213U5\30664\271\216\rU\030\34198\372c\225j\273\3444\002( \220\202\241+\233\003\377\006C\013\031\230\017\307\315\230\302`\\(\017\357\341\036mwBX\013n'\353\n7\315\214\256\355H\265'\331\236\211\3160\233p\253Q\2207\004\336\005\020\f\327\204y\031Z\203#\026\036%\030{\322=\323\205v\352\005m\227\205\005"
+	.ascii	"\344\305\357\224\232~\202\031\003"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.130.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\362\002-\026"
+	.string	"v\251\216I\3200'\035\302\220\352Y?\220\026\340\375mem;U\377\317\034\351\253\017\177\360<\336\322\035{;\t\260\322\377[\177z\314\312\266\355\027\367Mq\374\203Wx\301\364\340\220\201\351\235Y\240\306+\363\f\366Q\031!d\023\271S\nu"
+	.string	"}"
+	.string	"w"
+	.string	"\376\220\307\362f\022]Y{x8\277\364x\352\227pO|\341\021\330=u\200\252\265\262N\275@<%q\343\331\366G\034\bg\367\276\222\247\347O\034d\212\244j\255\344)\311\007\200\247\337C\300\323\365p\334\277\235\024\347\207\255\317gji\306\346\345_\3302\372\234\261\311\360\005\261\321}$\265\326\017}\322\330\344\346\024p\032\266j\255\0265\334\340m\237\330\236\331\213 \037\341\264G8-\202\323a8\r\206\323T\234\376\302\351\005\247'\235>H\001\005T\265^\250\242\2529\224E\210\013}\362\252\256d!U\0231cMe\331\266\215;G;(\251S\0247\267\264r\026b\276\0249\234\200\244\252\256d\035\375\204\213[\f\224<\030B\252\233\032QR\265\226\344\251K\361!\366wC\317\307/\272\221=\332v\"\037\220a\263\313\211<\306H\362\251\265\216\353\013\335\002&\276\213\277x"
+	.string	"\001\005\005<\r\367;f\004\321\335\005\367;\021\271Y\345o\351~\007\365\375VDIf\307\334\335O\307\016\312\216\360\026.\261V\235\211\237t\245\227\337sjXJ\nx:7\300R\322O\320\254\265\276\354\356\330+\340w\005\202\210\206nN\331W\361\025+~\217'\304\346gN\375\030x\372e\200\243\367s\0033\253\346\356x\351WW\307^\205\323c8\035V)\241\251\324\\1\222E\026\213\311^\"V\231\301(\270^'"
+	.ascii	"\374*\261\315`\265\232K\002I\233\311h,0\032\311\262\342\212\221"
+	.ascii	"\257\031\215,\031\261\254\002lF\326d\262\0319\332\236\377\352"
+	.ascii	"\352x\356\2701\0330\346\233\276Z\032\333\253\375\320_\203\243"
+	.ascii	"\344\004\2639\357\277\357c\307\005o\344z\377\200\323\224S=u\265"
+	.ascii	"\302$\360\330\217\365\334E\211\013\256\307.\322\216)\\qG\220"
+	.ascii	"\032\234\311\201Xk\r< p\002!\273\352\006ac\274bE\034\022Ve\354"
+	.ascii	"Avu,\246\001Z \344L\34704t5l]\331\026&5\304h\240\262;6V\343\337"
+	.ascii	"x\322v4Oa\323\333\344\226\221\207\021\376\303\3662\342B,\220"
+	.ascii	"rLM<\bbA[\353GwY\334\t\331\266\266\260\211l[L\306\323\347\222"
+	.ascii	"6\327\356\314\272\245\357\362Y\r \021\213B\272\213j\226n\240"
+	.ascii	"\333s\273z\277{c\250\013\353.\250\210>5\336m=\001\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\260\005\355\024"
+	.string	"\326\237yJ\260VU:\3740\315\033b\311Cn\262dr\307\t\267'\f\025\210\367\222\234\177M\347\316\311V\033DD\330:3p\225\247\255m\3523\341\2421\341\242\301\r\264m\333\266eI\321\025\202s\337K`\260\334\303A\276YB\344\336)a"
+	.string	"h"
+	.string	"e"
+	.ascii	";^\353\354\256sV\327\270\334\233\224\270\233[\317lG\262\350\365"
+	.ascii	"Qk\035Kk\315\272\242\226\347I\255\213\242\251\254\317\305\362"
+	.ascii	"\3359\300\307\343\321\213N\357\330\330+\301\237\224\027\312q"
+	.ascii	"\225|\t\030@\3204\013\253)\371\342\330\224"
+	.string	"\377k*t\203S^\024\275=\376\376\217`T\362\336{m\272f\377\247p\004\247\371\320W\252\036`\345\317\002\210\030\244\342\247CN\371\003\211@!q\0304\004\362\371Y\021{M[p\210\225\033\372J4\364\223d\350#\301\320?r\241o\304B\277H\205>\021\n\375!\023\372F\t}!\021\372F\026B\337\354\203\2669\350\007i\320/bp+e\317\245\034\027\364\317\316\024P\320\276\037\257\364u\257\327\0016\251\313S\215\031\213k\221\306\312\341b\310\251\306\342j\254i\255DJDK<0lF\315\244\365JO6\264\310H\026P\254\260\241\246\0302\222W\252b}\021\311\303\376\024a\277)E\237J\260_\005\330wB\321\177\362\351/\235\350C1\321g*\321\217B\242\357dD\177\211\210\376Q\210>\023\020}\250z\357}\017\326z\343\313\026$\230\032\016\376\305=\256\027\277*I\276\270B\265\\\034\254\026"
+	.string	"\r\263\322\334\3112\273\223e\212\274\323\305\244CF\357d\225\321w\262*\375\235\234\212\252\277\362b\013\217\027\235,\244\221;yu3y\20539&\315\231X\220\200\314\320\231\234*\316L\036`\2541Y~\354\260\005\340\224\321\212\3055\252\006_\250A\bF\262\255I\f\n\nY\016\340\002\031\243Q\007\021\260\030\247\b!BDB\th\205y\220\251\t+\037\307N\027ds\375\302\320\311s(H\326\376%\254\200\257%\354=\b}\016\211\222\367[\300,\255w\226\024\002(g\0232\355\032\315\b\236P\016%<Aq_\331c\022\221L\351`\355\354\315\223?\330/\331(\345\304G\215|\222\354\006\032\350\355\031C\241\3652\371\001\352?\355,\253\223\230Z\344s`7\313nR\233\021\027>\361X\235\305c\3010Bs\274Z\031\231\b"
+	.ascii	"\312\2328\227\n\f\232\244\021\352>\214o\376\321\030\254\242\034"
+	.ascii	"-\275\261Z\005"
+	.text
+	.section	.gnu.lto_.refs.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`n\001\r\f"
+	.string	"\206\335K1`i\223\306`x\201[\304"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X"
+	.string	""
+	.string	""
+	.string	"\027\322{\377~\\G?\2461\017\323\371\315\216\266\376\215\250\033\222\022%\226l\262\311\226)\0058"
+	.string	"<"
+	.string	"?"
+	.string	"L'\332bn/\216J\334\026X-M++\345\321\t\323H[\310\255c\215\232>\253\343h\303\364\263iP\2626\2626Z\n-e\254}\326\266\265l\351:}\205\364\030\004R<\233`\3058{Y#$}\240\324\"\355d\225H\333\260B\246\245n%\246me? |\034\332\330\311\33014>\353\222\215\245\023\275\242\235\t\240qH\306^\264\265\270\255x4\0232L\013\255\fv\316\263\215\263\353\366\244)\r/\200\223\363I\311\221\035z\035d\275`\241\002S)D\353\004I\225\340P#@p\326\007\322\352`Z\033\334.X\025\254\027L-\230V\254\315\254\003R\\\305}\2315q%\006\301.\311\313ID\0340\260\023\330\006-\233\2649!\226\215i\243i\231\364\320\244\254\324\372`\352T\026g\300V\252\223R\235\021J)\001\032U\327\034\266q\320U]\005\362\261:\252\013\037"
+	.ascii	" $\025 l\005Y\352J\215\341\211\215\201&)\271\244{t\274\fxj\333"
+	.ascii	"\033\244Z\353\302\241v\001ma,\033Mp\317\203X\333~[\227\336\212"
+	.ascii	"\3773LMp\322\207\376C\260\314`QqK\272\205(b\245R&HM\244\311x"
+	.ascii	"a)"
+	.text
+	.section	.gnu.lto_.decls.2941b2aa83a3fd40,"e",@progbits
+	.string	"(\265/\375`\270;\035\362"
+	.string	"JfeOU \fQ9\351,\t\206\346\237rH\361\205\035p\231\337\337|\236\031)\366O\350\336\322\204f\343\332g\305\3100\377G\3335\372\316\fR+\242\352\212\023.dv\221'\025\\>\264\375\220\240\027\234\310e"
+	.ascii	"\326\201"
+	.string	"\330@c\007\232AY\342>s#\322f7\221;\005\036\004\343\004+\0059\304\234\235T\236>\323*S\037-\227K\226\270&\267\356\346u5\300\214\314t\215\355I\253Y\250\267\267E\253Yx\206\266\223\225\366d<\227\274eu\257I\2539\3260.\231^\3360\315t\313\\0\327\360\216\351\245{\3301:w\323-l\247+\346F[y\007\177\t\357\227ch\316K9g\237.W\355\3465O\220\371M[y\257\334\277\234%h\236j\001\355\240\\\265\0345\347,\303g\233\333U\233\341r\322j\026\346Y\261\240P\2539&\345\356\342q\020\246\204\227)L\340\256Z\216\022\232g\200p\250\367\373\274\2257\360\326\345,\241\231y\002O\253\251\344\347\240\203V\336(W\315\203R\316Y9,P\202%+\2600g(\b\036\020\353\236\224\230\221\002\340v\336\r\305\001\250l\353U#\353\325\255\365\252\214\365\035\270\276\367"
+	.string	"\357\026\234\274\252,np\200e7\313\215\032\334\021\326\370\315c\275Xn\337\215^\277\377\362]\275\343$\316,\315\031\212\243.oP\211\353)\352\334\236\342\233j\305\255\264^@\270\222\300\353K\345V\371\305\273Sn\226.\036\316yy/\0069\367b@\244\013\262\214\026\361o\227\365W\312\372\301E\262\376\nY\317\346\344>\271Q\r.\335\257\334\235;q\t\315\320\366\"\323\026m\374\273c\375\325\240\250\036\036^\r\212\277S\353\316\335Pl\271\021\254\317+Z\357\367\263~z7\024\257b\335)\274\033\212\027z\323n\364\303\225\236\203\016\256*\223d\263\234\241:8e\216\2241l\374\006\254"
+	.string	"\320\313\035\274\202\365\367C\361\036\336\017\305\367z\001\222\377\226]\263\017j\023\2243\263\345\f\275\240\003\275\021\245\243\361\241wCq\275\031\212a\2568\360t\215\013\277J\343\244\307\177U\314q\3757\002qZ\367\315\312\355\346Wm\260M\255EI\235\222\274\370\2530\320\326_=A\t\314^@\300CK\035"
+	.string	"\277Z\364_\247nzR7\374\375\301\337\013\210q\342\277E:\005\323\337\020\200A\201\245\t\264\212 \032\370;\304\263t\t%\0174\234\304\257Z\340\277=zYB\002\377\355\372[\371w\376\273\004\177\223\340o\026\376N\372\273\375\033\351\277\315\257\256\330r\200\023E\326\361\257*\240\213\376\023\177\025\001\367\003\375\00125\211\312\310\177\303\376\366@\001\306@\240\341\020\205\216\202\341\330C-\364"
+	.ascii	"\374\235\205iC\206f\261\266\261{V\210\352\037\f:p/@\342\371\217"
+	.ascii	"\302\377\002h\360_\016\374\255\201\227\370U\n0\3205\377\315z"
+	.ascii	"\315\337Jm\201\377\322\351\337\037T\370;\203N\001\205\377&W\334"
+	.ascii	"\303\257\022\377\333\377\305\377\307\374\367\376/\374/\361?\231"
+	.ascii	"\377_\376\213\371o\370_\365\177\231\377\026\377\037\376w\346"
+	.ascii	"?\230\377\256\377\303\374w\357\277\226\377}\247\340W\333\376"
+	.ascii	"V\377\246\371{\375\273\3707\376{\346o\233\300\277\373\357\333"
+	.ascii	":?\356\360\267\t\177\223\360w\004\376\026\341o\006\374\375\301"
+	.ascii	"\337\036\374m\342\357\r\376\016\361\267\001\376&\300\337\002"
+	.ascii	"\370\333\202\2779\374\235\341\357\234\277o\376\313\367_'\377"
+	.ascii	"\235\373o\334\177\337\376\353\366_\266\377\256\375W\372\337$"
+	.ascii	"\377E\373\257\331\177\311\376;\366\337\260\377>\375\267\310\177"
+	.ascii	"\277\376\033\344\277^\377\365\361\337\035\377\335\372\257\363"
+	.ascii	"\277Y\377\305\372\257\215\377R\375w\352\2773\376\273\374o\324"
+	.ascii	"\177e\374\227\351\277K\377=\301\177K\360\337\021\374\367\305"
+	.ascii	"\177]\374\267\375/\b\376\213\364_\243\377\022\3757\204\377\242"
+	.ascii	"\360\337\026\377e\377\033\364_\020\377\r\361_\240\377t\377\255"
+	.ascii	"\300\177*\377e\361\337\025\376\333\201\377n\340\277\031\370\357"
+	.ascii	"\005\376\233\302\177O\370\357\004\376\253\363_\t\374_\361_\005"
+	.ascii	"\374/\341\277 \3747\001\3775\361\337\r\376{\200\377\016\340\277"
+	.ascii	"\002\370o\207\377\362\374\227\303\177o\376k\363_\232\377f\377"
+	.ascii	"[\374\277\373\217\301\341\341\341\341_\323\374k\334~\rF\b\352"
+	.ascii	"U\207\261,Y\275R\255l\250\234\310\320\364\240:J\362\300\\5n6"
+	.ascii	"\325M\240\235V\214\306\267a\332\260\341\244\024\223\323\371\022"
+	.ascii	"\226\303"
+	.string	"\213\217J\245*\302\254q\262NM\365\340\232y\2520q\262\360\226\254\220\314\230q\325n\222<\243&\306\024\224\020\230L\027,>\212\2547\252F]\265;d\232\001\030\215\345V\223*\243I}*\200\223\223\372\244\342\203\027\250\2525F\006Ic\365)\216\246\351\305l\374\032\030\353i\2540\251L\r\244\223d\03251\224B\262\nsn\206\300\371\"SSJ[\225\252\222R]*\346|\241\316\031LuI]\252\313\006\\\2259\363\240=\233=4McDh\200\254\247a\036\036~Mi\224\310\220\261c\256\177\206\206\314\031\030L\f\277\234\024\022v\230\346\303\231-/i\2300d\256h\353W\037_n\264\277\334\272\236\274T\366|A\tA\364\352\021v\243\361W*/^z\320D\230\274\023\276\007\211z`B\334\302`\335hc\365^\221I#\265\3674\315L\346\364F{\332VT\344%\215\023E24\304g"
+	.ascii	"\271\374F\233KW\271S9/\255L\210=\233!6\370\342d\263[\337~\235"
+	.ascii	"\345\375\027\355\277\006\274\315\254\f\354\200j\332d\366\374"
+	.ascii	"\255\345\rx.7\331C\216\031\3354L\343\0236\363?\315\017\335\217"
+	.ascii	"\302\265\265\377b^2s\3164\210\320\314T\272\371%\336\333\363\343"
+	.ascii	"\\\365f\220-0\0014+\301\200\r\256E\342\226X\027\344?/\347\245"
+	.ascii	"-e\003\266\246\226\266\252\232\244[Y\271$Dy\201\231\267\224M"
+	.ascii	"\322\234/\344\245%\245\b\316|\241I\232\2472\f\275\251\233\241"
+	.ascii	"[\312\274\344\314\027\362R^^\320\264\2645\325$]N]h\222nMe\351"
+	.ascii	"V\336\311KK\246\323Rf^\310\322\255\300,uN\3554I\235SM\322\255"
+	.ascii	"\254\313\244\311\320l\352\013\030\027\340\235jZ\312RQ8\226\314"
+	.ascii	"\235\274&\2503\373\345|\331\23023\203\234q8\231~\313\252+\247"
+	.ascii	"\224'\245\364\266t^h\316\271C\224\022\2273/\3455\2019s\006S\032"
+	.ascii	"\312Q&\224\320\274\354\343\346)u\340\310PL9W\020\225\263\362"
+	.ascii	"\346\274\234\2632\347<\303\304\001\315\371j\247\351\031\025\225"
+	.ascii	"s\223'*\343P\3161\345\334l\177rSMR.\247\317\334\232\364\231c"
+	.ascii	"@\225\367\231\375\266\230\253T\231\226\241\274\254\317)*\301"
+	.ascii	"\306\320\234b\030\220\030s\215W\261\257\036\206\215\241nWSz4"
+	.ascii	"\236B\203\305K\0166=\236\232\257\037[\322\306\237\221\222\321"
+	.ascii	"y6wM\300\016\017\327\306\303b\254\252\326\272L\201jh\212Ia\221"
+	.ascii	"\362\033m)M\307\263\2233\027\324\263\030\305\256\241ta\362$l"
+	.ascii	"\315\256\216\256f\211\035\224\255\361\223\365y\325\324\022\223"
+	.ascii	"\373\215\266\\7\351\311\231\306\211/9A\301\302\314d\206\230\343"
+	.ascii	"Q\231\236\270\310\032\277\370\264\236H\246\341\272J\006\021\032"
+	.ascii	"\323\225\311\033\033\r4\2179\243\361K\250\301\231\241u4\207&"
+	.ascii	"\347-(O\266\226vt\306\307\224\313\223\302\234\263[\267\365\222"
+	.ascii	"\033m\266^{+\271Lp\326t\210\323\212"
+	.ascii	"o\210\321\365D\262\365D\257\265\241\235v\243\247\353$>\354\224"
+	.ascii	">\270V\026fNW<\361\352\fI1\206\226\264\n\2226{\\;s~[\235\b\311"
+	.ascii	"\210i|\363\335P\346Gv$\311S\017H\343\367\221\277\305z\254\301"
+	.ascii	"n\2349/\021\007\235\242\n\033w\317\315P\274|>\3570\254\343"
+	.string	"\313\f\"F\032\354\372=sL\001+\242SV\203\007\020\250\031\315\234\241\021\033\215\373\331_o\"=$7\021\023\316\234\227MDgL\316K\235{1\270\027\003L\3065\304\255\210O\264!\344\002\006\001\342\242\331<k\374\006\322^\327\2319\344P\251\215]5\356\256\366q\243\035\372\307\025\354R\232j|b\324j\202\234o\207\342=<\274\035\212\315\303\347\335#C\221\331\204\352\234\360\322A\326X\275\031vt\230\021\233\323\342\241\203+'\207\332_\232\263\267\272\205\033m\256\316zk\335\274\367\034\016)O\256\3161\263\204\331w\306\325X\027\257\350\365\354;S\253\224\320=W\\\304y\353\261\335z\374\266\036\227\255\032\254KN\226\230Y\275\007'\f\026\245\261fW\335 \351!\246\243\373F\327h\0337\332UM\225\253Z\252\231j\032sU\022\305*A\343\342\251\320\347\314\032\227\325\264\203\337\247\252\247\256x@\200"
+	.ascii	"Q\374\241"
+	.string	"\246\303p\305\307]\353\261s=\266\321\3233N\263\004\315\322\233\345\r8+\215\217\241\326\343e\324\305\233)\253\343b\203\222A\214J![6n\031O\255\304Y\242\2149i\354#x\353\002\203mV]\\N\272J\231\230\037LMT>\235\032\204\201l\215\341\340\260\234\230\247Z\004L\\]\334\261\334u\313M \032\300\336\376\206\301n\022.O\nu\252\314xj:\327\326\260\033\217S)\330\023\305\n\226)4uxP>\334p\033\326\363\255\2541f\2739\354\333Ck|\r3V\254\004LZ\032\226j\370\242q6Xx\203&F\017I\364Xz\361\b\325\362\316p\022\274\031c\304\264\221\221a\264<.O\306\244DQe9;F\273T\224+\2711F\322\321\265\311\237\230\220\306\330\f\177M\351\302\2451.\273x\253\224*\2104Z\314\002\326B\f!cc\030\214\001S.Opx0\351\263\273\021\026\226"
+	.string	"f\337\331\330:\315}Z\215\237a9d\b\006\353\242\344Py\243\3101X_\311\273B\210\211pA\225\3620\021\3745\244O\257\354\t\315!a\030\335\263\327\242 \321\322\233\006\t\022\346\331{]gMS\274\274z\220\001r\\\236\214\001*\321\326\244=z`\037%\266\212\214\251-\330\341x\352:\366A,k\002\255\272j\\_"
+	.ascii	"1H\355\330\321\203n\317\342Y\217\351\023\214\363N\314uw\240J"
+	.ascii	"{K\236\252\021+*1\266\216\271\326\037{z;\032\343\026:\312\205"
+	.ascii	"\202\326\365\266ge\205\263\0200\355;\033\263\361\222\241\224"
+	.ascii	"\3438\013\307mK\030!\306\361\247\2579\0358\260\334\262\246\366"
+	.ascii	"\3462\006{\262\365\206\257:\253\330\346\305\220m\316\206\r\\"
+	.ascii	"\305sd\351%\330W^\360~\340\033\307U5e\230\002\227t\034\211?/"
+	.ascii	"!D\32631\023S\025\333\226?\360zp\0171H\3760\025\246\021\306\312"
+	.ascii	"I\006O\005\355P\362\244\361/H\255\277\020c\375\261\024\226\352"
+	.ascii	"**\264\310ef3\004\216\234\224\251\245A,W\273`\301P>Jyy\204\204"
+	.ascii	"\330\223X(g\205\2601\226\321o^\002\255\364\255\277fSUP\213\027"
+	.ascii	"5\320\354\357\213Zx\363\272\032\020Ve\3523\250\006\346(/\344"
+	.ascii	"\254#\313s\t?a'\034\003\303\300M7\212\231\3240\347\301L*\241"
+	.ascii	"\337\224I\025\203\2277\257\271\223\227\340\272LA\200\250y\332"
+	.ascii	"\312\313\221\203\247\337\342A\251I\305\331\026%V\272Q\274<\017"
+	.ascii	"\324\007/UC\234o^\023\232i\3300\321\343Q\327\001\004\216 \237"
+	.ascii	"\037V\021\253\207o\320\036^\032\253ef\232Uw0\224\214\271Q\225"
+	.ascii	"\314J86gx\033\273\037\\\322\365;g\353w\276V\025\314ze\232\003"
+	.ascii	"\317k\375N\217\365;[\353w\256\326\357\330\020T\003\245R\006\361"
+	.ascii	"\002\257Z\357Q\201\332\231ZU@\225\213\016\231\034\217%[&\360"
+	.ascii	"\243\312\222\306XK\337\ryF\375\345\370\tiKk|5\013q\311\341\240"
+	.ascii	"Uc\325oe\332Q\322\240&\007\234\026V\343\253~\277Zw\227\210\340"
+	.ascii	"\220\f\230\306\255\304\347j\237\r^\335\024\r\220\356\352\236"
+	.ascii	"J\247\362\251hf\032'\304j\242\272\312\2024\206\322\314\241\321"
+	.ascii	"\2155V\253\250VT\275\237\206\306\t\324\036\016\276\365j^M\227"
+	.ascii	"^\020#\215[\245r\025\357\247\2311c.\265UY\257\336\251S~\032\225"
+	.ascii	"\314\024'Nv\353U)'\320\322\302\221\306j\224\225I\207M\003\232"
+	.ascii	"\277$[\324(\277\n\345\2665\221\025\032\n\253\331\245q\316\315"
+	.ascii	"PT\353|\256\332\365\020\266\273\273\3068:?\23489\342\004\350"
+	.ascii	"\304J\326\334\234\032w\342\013\310\323\307\0237.Pppj\\\327\224"
+	.ascii	"\b\025\273S\022\327\321\"\214\263\256#\215\257\223\337\336T4"
+	.ascii	"\302\"\325\0211*%-nnj\022\277/\251)\215`\0210hplljXf\312,\360"
+	.ascii	"}9M\327\272\252+edkkc\212`WP\262\266\244R5I\227.W\256\370\345"
+	.ascii	"5~\316SZ\232\232\004C\316kq\177\323\020c^\350\222\324\325x\245"
+	.ascii	"1\265P\270\236\235\251h*\362\006C\271\346Q7u\003\355\342}\025"
+	.ascii	"\341\202\242\262\232\231\365`\0309A\301\261\232#-\324\020\323"
+	.ascii	"\246\222\251d\nh\373\233\2560;\334k|\034#\352\230:\326\201\325"
+	.ascii	"\023\247J5\242\032Q\303h\b@H\003\004K,\207]5\233,ScH\274\024"
+	.ascii	")\322HT8\227_\037\224Ma\2312\343e\031\210\365\266^\025r\325\247"
+	.ascii	"*D\375j\276U\311\\\227\004a\233\336\224\255\277\351Z\177\233"
+	.ascii	"\257\030$H\003\256\371\332eA\3011\302\250\2518)/\257\036T\300"
+	.ascii	"\222 S\035%\323R\256\361o\226\353\357\221\253\366\270Q\265\207"
+	.ascii	"\352\003\003S\0022\262\246\231\211#D\037J\335=\325\256\233.B"
+	.ascii	"\362\252@\233ML\316\270\350\320\241\356\300\220\263\222%]7:\240"
+	.ascii	"\234(w\200\251tPp\205P\266\266\254\212a_\350\306\244N\247\232"
+	.ascii	"\245\"\347\254\005\352\231$\212\225\027X\216\034j\026\206\354"
+	.ascii	"\314\3719\343\346t8\005\223\006:\311j+:N\f\251\330\350P\253\324"
+	.ascii	"*\025\313\313\006ZN\034=xJ\016+G\260\002-jp\206Zc\221\321\321"
+	.ascii	"\210li\216m\322\b\243\243\242\242#\240\n8(\201T\004Dl\215!\354"
+	.ascii	"\260D,\222G\035\n\330\237v'\231D\324\266G\310!\0248|H\304\b\007"
+	.ascii	"$!\300\"\223Z#\333b\247\002\016\027R\210\200\"\003\2211\251E"
+	.ascii	"\036U\3400\002\250E\321\021r\004\226\350\330\342\biB\320\321"
+	.ascii	"\004\240\017CI\026\331\202\202 #{B\n\021Pd\270\360!\021#\216"
+	.ascii	"\216\034\212\037\0221\"\211d]\034\221A\025\264?\311\022\222G"
+	.ascii	"\"\242cQ\361\005\322Q\n\f-\322\b!\244\f@FI#\264l\322\306\250"
+	.ascii	"E\023\223?7\355\217\221\020\022\321H\bIeEpL\342d\222E\006\005"
+	.ascii	"\031g^ \035\001ad\213\244\036\347\005\262M\036\205\330\023~\202"
+	.ascii	"X#\241#\221q&\210M&a 69sck\fj\177\204\220D\344\374 \025\261("
+	.ascii	"\264l\222=A\b\351C\t\027ZV\310\006E\362\250A\005\027(<d\340"
+	.string	"\360\002\310(\304r\270\020\304\"\223\222\307\n\222EH#\021\212\344\207\243\261\210=!It\204l\201\202\214\214EEG)\200\2204;$D\004\261@G\027HvE\2334bH\321\036\215 `\223\314 dtD\266+6\204\320\262B:$\264\254P\206\017\211"
+	.string	"\3721JB\216"
+	.string	"j\021\200\244\220\221h\004!\243c\021\322h\263\303\002\231@\343!i\304\"\025\035\245\b:\232\320\032Y\250\300\266F\242$ \"#\220"
+	.string	">$bD\020\3211\211E\007\241$\026l\020\221\204\210\026iD\022\001\200\233\020\222x(\310\340#\"Y\002+dd\034j\223F\242\r\033T\350P\264BC\n\025H`[c\020R\n;\007:\"Y#Vh\275\t\0176\360\340\003\026f\376\001\b$@ Q\374\007 \370\370\200\340\201\317z\017|\324\366\2475\266+r\332\033\366'\205\b(V\264oo\330\0376\350\250\004$\213\304\262,n>$\"gm\223lk$\201\0252\"Y\244\"cN\373\303A\t\243\020\030\221\"\f\241(Z\221\306! <\363!\021\311\237\2345\210\350\330\302(\251f'\371\323\242\305Q\233\224B\205\020\034\021a\bb\211X\030\215\330\031\244\232\366'\231\002[tlW\266\350\210B\2134\266I\232\017}\370\021\022\213\034\321\036\035!G\330$\177\204\216-\214\216X0\032\035\2130\204\2405b\223,\022\251=2\352"
+	.ascii	"\344\202\b\207\375\301\300\376h`\201\220IG+\220l\313\226\320"
+	.ascii	"\032\261Hd\022\020\206\027\355\021\310\210dL\241\323\032CP\201"
+	.ascii	"M&\341\020"
+	.string	"\035\035\205\360CL\266H\226\bE\n6\231\244\301\210\005B\262& \025%%\215\216\200<$\217I\026\311\266\311\027C9\355\217\007>++dl\211\216\\\020\021\261@DDI-2\264FIG)\210\210\330\024!\260@\310\243\026\033\\\340\004\035\035\221\254\t-\220Hh\215,\2168BFG#\244\321\002\024\264?\037\264F\307\244\231\373\370\244\270 \205\t<`\005\022\361\002\311\266\255\221\305\210$\362(i\304&G\030\035\215E#\200\220\311\021\"<\020\031\201\216\355\021\231\002y4\202\321\321\2615\"\223Dh\215,\\p\370\215\033\304+\023QhX\235x\025\267\206E\267\3145&6\037\227\266c\256\352q:pi~^qF\340\216\270AW\"\223\310$\326\bd@TJ\253I\254A\244\302H\224Q%\025\215-/VZ\032\017\2523&\211\364\nq\352\016\336(prjDV\342\023\361\211(u"
+	.string	":\301?<b\324\211RtD&\300A\275\306D\250\323\031\266\241\3615&\3128\335\357\360\270\264\350l\314\225Qi\374\rQ\353OtR\237p\316\330\232S\232\320l\256\346\300\264\305\220\352\3709w@1\271\335\344.g4`\310\201\261k\302\264\204\301T\345\333\214;%\0376PcS\362\210K\242R,M\007S\343\023y\0203\336\221\365\247\325\230G\316\347\370P\225\253c\032S\206\314\317\324\327\225\306\307d\210\254@&\210\214*\215\261\241\317\361\030\013\230\320\3155\236\021\203\303\2445}\301a~\\x\355~\330\240\252\322\230\246\314\347\030\214\316^\034\241\220/\230\360\006\2144L\210\203\203\210\016/>\307\203D\253\273\026\274\032\333\b\342@\233\276\265)m8\360\307]\360\264\211\254"
+	.ascii	"GE\215G\343\236\273\241H\304\\\360\226\032\254\2642yzP6\0348"
+	.ascii	"\27647@\300b\031A\2659-j\230\215\020h\023\030\177T\352]\234\021"
+	.ascii	"\261,|m\\\362d4\346\343\303}\227)x\342H\223\276'\205\271Y\243"
+	.ascii	"\347\307X\216\373\226\332\232m\215\361\225\346\373\336\325__"
+	.ascii	"\363\001\356\365\236\216"
+	.string	"\224\016\031^z\267\256X\005\303p\211\025\037\205R\25685\2361\003\n\265\221\313j\253\321\030S\301TT4\025J\016\334\341;|\247\242\321d&\211;\rK\244\340\252\23251-lQ\332\312\312D\232\345\t\212\272d\207\263n\372\302\210I\253k\262&\303\313\331t\230\313\306\033V\017\374$\205T\250cc\344i\"\356\234BN\231\031!M\222\2441\023\025@ PH*\034\016\230-\037\023@\022\350S\252\226\205\245QlFDRP\220T\262u6\222A\2629\240\210\320S3w\340\r\372\244\ni\016>\023\210\002z*7\314\204ep$-\022\360$\235}=\242\215\261+\275\207\313\204\332\251|)_\367\252A\035GE\357^r\306\242\004\346\276\317ojQ\225\345\236t\270\375R[\344\r7[7.\373\035\237\227\363E\324\2243P\270\304B\311\342\332\303\022\304\243}\025\272l\013\300\346.\332\236\025"
+	.ascii	"\275\247'\325\022\237\364\222\2020\200\301^f]\3568kg\306r\204"
+	.ascii	"\256\257\377\233\346J\3324\205\250\302\345s\376\370\234\246\251"
+	.ascii	"\026\001*\206\253\027\021\007\371J<\316\033\017\301\270\007\203"
+	.ascii	"`\272\326\026\256\327\027\305W\372H \265\263SGnR\247[17\267\327"
+	.ascii	"\241\334\002\370a\f\223\003\311\f\244\327\330:Py \357\351\377"
+	.ascii	"\326\217\35364 \346\242\027s\366\030\372\342\034\263\303\351"
+	.ascii	"V\332\027\344&w;\232\027\006\332q\343\314\023M\035Ao\335\314"
+	.ascii	"\306;I\305\232t\263\323L\\\253OD\331l\361\025q\340\251[J\342"
+	.ascii	"/\bw4\342\376\214\345\361Ytx\306f\320N\246\0350\326\021h\366"
+	.ascii	"=XC\270O\361x~^\020\2438\217\211L~\375C\023\234\002\323<\265"
+	.ascii	"\252\307e\332W\332sx\234\234fS\345Y[rP>\305*\261\225y\226\223"
+	.ascii	"\253F\0357\210\251a\nr\245h\007\360s\253 0\263\374i\031\316\202"
+	.ascii	"\350\024\fnr\001\324\350\220`Q\312A\035\256\022A:\366\251\030"
+	.ascii	"\354p\353\317\020\206m\355Gf\236\227Q\037\255\331.\322\3010\336"
+	.ascii	"\006d\255M;\001\214>\235\364\3068Y\232W\233Uf\3756\024\006M0"
+	.ascii	"\307l\300\302\271\3538\016\034OsFz\376@\374\241\007?\356\307"
+	.ascii	"\312Ih AG\022\345\242\244G(\242J\336\316\362\021\274\002\206"
+	.ascii	"I\021v\275\324\375\317*&aV\036\356\202\320\231#v#\233\261=\005"
+	.ascii	"\240\035\201\2036\331{9\016@\365[\346\301\256V\233EF\373j\217"
+	.ascii	"\235\335\006H\n\277n\375\301!\211\323 \223>\370"
+	.string	"]/\220\270\f\271\n\371\374\202\223\325\252<\216\027K\326\203S8\246\242a\207\351\275\216\026d[\377:`\357\211\030\020\252\250~\017\333\371p\354\335\003\035\253\334\233[LD=\376N/\253\022\336\31496cSy\222\031M\3641\020J\306Q\360\305\326>\223\356O\214\221\n)\347\226\355\302\215\025\026=\222\321\264~\354\250\357\267;\371\276\305\n\2044\372(\305\330\264A\314=h\260\224\022\367\201\004\374\216\002_HV\265\354\220s\320/\217\216\371y\336\2468\367\377\306b{4\347\267\320\231OZ\036{\356\036 D\300\203.\340\3262\223\035U\3334.g\350\362P&1\001\336/b\253\017PKz\227\237\\w\004q\335\305y\345\035K\22753\243Z\250\003\346\320P\207w\212\344\003\ny\003\257e\2213\317\207\004\013.\240\247\034\360\313z\352\314\254\026-\200z&\264M\310P\251\"\026=k\302\025^G"
+	.ascii	"\357Pw\377\242Y\031u\271\322G\266\242y\364\356d\316\240\330D"
+	.ascii	"_Tn\0048\370+\255\253\201=\376\321^\335\362N\320bO0\240\210A"
+	.ascii	"J\231\360;\032\203\274\335\326\002\007"
+	.string	"\226\017NN\342\326a\334\212\344\316\303\364\364\r\241\310\213\302Kt9\250\n\370\t\225ZV\257\330H\212\353\322\251\345Mp\206\200\221\305\017\256\345\334\365\236\r\267\264\340h55\345E\220&\237\205\226\023,\342\"A\371\335\254\016\302\252\026\335l\233\030\340\207kV\016c\356<YGH?"
+	.string	"\313\274\202|\f7 3/\366\231\204\324\203-Y_\266za\234\213\017#R&f\007\313\217aR\270#\376\277\215\2611\276G\317\214\321\036\340;\336\234\307\377\005\3606\2572\022\217\360D\305H,@\214\312\300T\350c\274\363\276\256\312q9:\254\315\2029\230\323\016\365\323s\371\031\302\257YMXd7.\t\007(=\222\254\353n\260+\307%R\205\033\230\nW\364q*\n\235\220\006\341\037?\221\317\222H:\0264n:\310\241\\\241\327\263o\"GE\323\245\346]\243\023\360e\376py.\313\263\001<\360\304\365\325'\352\363\265Q+6\267"
+	.ascii	"\020\363\334;V\335\367{D\303'\274\351\232[4\016Q\245q\022\361"
+	.ascii	"\263.\241B\234\263\242\236hlQ\347kED9\215\3716\300\250\374\002"
+	.ascii	".F\372\262\310\322\256?8r\203\363\357\334\346x\266e\257\b\263"
+	.ascii	"Y\216\203n\375\253:\357\365q\331\272\323Us!U\303bg!\365\3267"
+	.ascii	"\264hf\016\262\n)m\222\303\211w\371\257\302\312\327\257\363E"
+	.ascii	"\024\362\217\036t<s!\007\223f\224D?\\l^?Cx\223\031\013\254\331"
+	.ascii	"\331\3757EI\fI\366\334\323\t{\271\300\rmS\266\311\032\211\202"
+	.ascii	"\002\346\222\310\256\324\374\302\347u\347\304\353\271X\304\263"
+	.ascii	"\325\237\232\225\241T\003\216<\037\317\372\236\213\205\271\212"
+	.ascii	"\235:3H?\201\256\365\216\350\fK\203r\002\251\003\006\274\322"
+	.ascii	"\276;\247S;/\370\321\fr\207K]\344\325+3\0320L\347TI\253\237M"
+	.ascii	"\254\3515:\362|\032\224\266\242y\377WAyf\034\300\236\232\304"
+	.ascii	"\345\005C\220\216\307\237Q\031\235\303\315<\247O\376\035\021"
+	.ascii	"5>\303\214'qC\0048\224\030\231{|K\032\236\263\2226X\330\216v"
+	.ascii	"\330i\236\342Rc~\025\303\036\315\304HY\362grb\355\037\252\262"
+	.ascii	"O%\246\322\313l\026\305\334\200\231\270\237\"T\354\310\325$\036"
+	.ascii	"m\311i\345}\250\202\223\022\330\252\332G\251\016\016$\344!A2"
+	.ascii	"X\204\220d.TJ\363n\357\315"
+	.string	"\021\037%\252\371\353\017\371\207&\344\365\313\317PSk\205xl\333d0\261\346\271\207'\221!8A\217\300,\345\305\253n@\316X\357h8h\212>\375;3L\325R\013\303)\0375Vg<\337F\332:\\\013X\223\321\253\220\250'\205\233&\307\362\322\246d\3424\200l\313\325>\024N\217\315\036\236U\211n5\2076\t\232\345W@\213\317\311\272K\234k\223\210Z\260\310\257H\327\365l\205T\204Z Ku\204\304\360\031H\272\235\325\217\271@a\006\245*|\250l\017\256Z|\031R\326\030U\261\003M\201\213\216g\350#<>l\325\271n\375s\371\206\222\256\212\250\270\037Y(\356j \227\013\352C1\274\013]^Oi\271\357\260\357\035/\243\203\236\362\274\002%\304\224\032\246\r\022\361\017\317_\253\274K\025M\270 \243 \345\355?\322U\361>Pq\0379:\274\202/X(\207\246\354\n\212\321\367\260"
+	.string	"[\202\333\241\300ps\233\274\352C\266\243iP \177s\263C\020\313\347\306h\350X[\217\320\022\017\037z"
+	.string	"\337\216\214\032/Z.\030\234\352#\026mM\301\373\237\210\347\356\276&\246~-$\343\205\361\250Hio=\247\324\251\273Lg\\\204\037\344\332Ls\234\204\347Z\257\370\331\255\t\233\254\367\272\376\321B\361\277\276A\332F\005\372\263Q\035"
+	.string	"3J\206O|\242l\310U*\"e\314\253\0067\2521&\004Xb\013\265\302"
+	.string	"\267R\252\311\261\b\251D\3737\30390\327W3l\002\341L)\373\252\222S\273lb\235:\004\207\013q\034%F\276\265\031\310\033\371\017\332\313!$\206\322\363/\337\273]\311\230R\2106|C\036\375A\214$1\032\202*\242\251c!\334b\357\251a\306&/\214J\257\264\370\223\373\202\334\351\237\251\264\211"
+	.string	"1\376\322\034\327\327\375\212\303\367\r\n\002\030\037\037\330\233\220\247\304u\217\340\256\205{\313k\030\020\264\034A\236\242;nC\331r\374$]\302\210\244\240n\345\035\016\231\223\300\231\307\257\311\270\323\251\\\317\007]F\377\216\333c\213\237\341\331TA\031\303\240\204\304y"
+	.ascii	"\377\027Z3\276\001w\360\313c{\ru\264\237\245\273\036b\013\372"
+	.ascii	"M\263\250\321b\355#\206\231\323\353\004\262\304\237\245\344@"
+	.ascii	"g\267\300[\355\327\320b\247\237\314&Y\241\225\374FD\336\255\347"
+	.ascii	"\330\337f\321\013}\033\217&\030'\036\332\321\346D<\3110\036\037"
+	.ascii	"\244\342\207\376"
+	.string	"\206\361\256\345n\342\222ZRW3|\251\313@d#\265\370\236\201\321\017\231\326v\306\\\352h*\352\312\256\233\237Q\234?r\nNi\373\205\362\3201\315F\271C\306\231\224\241\034\273@\336\247\347\326C\0079\2578w\274\317\351\354\321\341\300\232+3\275\377&c\354<4\027\376\366j\225\245\205\0377=\237v\274\307\327),w\243\003\201o;>^\033\363\020\343\265\005\002W5c:'\225\314w\237Rh\024C\226\225\306\312\017\323\361\217\272\027\177\215)\237y\340'\306\001i\235\0350<d;\277\220\257\034\316\0172m\377\265\246\377\356f\356\221\213\034\tf\274\247\023\266\364\031;\363\003\367:\030\177\364\234\314=\264y\316\304\271\347p\300\255\213\001,\264\202u\005\324\263\251=\"\367\257\021\257r\365^\346\272\355o$\366X\236;\016\323}I\345\347sc\301-\256\277\362\221\231;\216o\315\347\212\217+f\255"
+	.string	"8\270X\306\371\022\331\005\370\341\215\274)\376NZ\357\262\360\002\027\007\257\367\377\367\025\367\037\332\030}\327M\240\031\320\356\214\255\260H\r(\254.\367\315i\300\364_\330\032\3644\204\247\337\373\202C\326\336>9\314\207\3473\266\273\345\361\234\\=\021\370b\340L\260\303/\007\302\253\204+\327\254[\230\230f\344\357\320\201\314!F:4=s2\347\351\3258x\265\216\231[R\217j\342\247\316x\201tF=P;!\367\322'\211\371;\256Qz"
+	.ascii	";\007\301\200\357\350\343\353\251^.u\263_h\177\243\343\004'\027"
+	.ascii	"\020\007T\337v\373\331\337\375\034\214ZFb\204\016(0\2649\245"
+	.ascii	"\256\356@>h\234\0039{\332H\354\334\227\244\236\256"
+	.text
+	.section	.gnu.lto_.symtab.2941b2aa83a3fd40,"e",@progbits
+	.string	"batteryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"batteryWarningVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"getVoltageState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"getConsumptionState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2941b2aa83a3fd40,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,450 @@
+	.file	"boardalignment.c"
+	.section	.gnu.lto_.profile.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 \371u\003"
+	.string	"\204\004\355"
+	.string	"\b"
+	.string	"\214\242\351\201\002\036\002"
+	.string	"\001"
+	.string	""
+	.string	"\001\240\342\234\212\n\002\214\230\327\245\016\026\002\002\002\003\004\002\004\002\005\002\005\004\002\004\003\242\302\263\302\013\004\212\373\211\303\f(\005\002\005\005\201\243\307\330\003\006\007\240\342\234\212\n"
+	.string	"\020"
+	.ascii	"\037#\340A\002\001c,`\330i`\245\031;\r`\006l\200\274\025\033"
+	.ascii	"/\004 \300\316\270\271\2036\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 F\225\001"
+	.string	"\004\002:"
+	.string	"\003"
+	.string	"\001\001\002\001\003\002\006\002\002"
+	.string	"\004\001\004\b\004\001"
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\004\002\001"
+	.string	"\001"
+	.string	"\006"
+	.ascii	"Z\021b\32400W%\374K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375`\361\0015\013"
+	.string	"\006\2236-p\247I:\374\005Wq\260;v1\354\336\236oD\342\216u&\\\313\315\320\237\377\376\275\027]\305\201\354\350\bh\3777\261\3667\221;\005+"
+	.string	"*"
+	.string	","
+	.string	"'K`\212"
+	.string	"\266"
+	.ascii	"\212b\344\345\004I\b\332\001\b\013\3367\0336'\304\003m\025\377"
+	.ascii	"HQ[\205C"
+	.string	"\320\266\023\204m\233\360i6\b\334\242-\202X\240\225$>\246\241\030\347\030$\207y\327y\017mv\007\025\264=L\326\241\274\200\266\222O\334,\205\366M\263\326\001\211}\022b\325\241\264\276\246\207\324\301\277\320\354\025B9\\zZ\203\2620b\313\351\301\005\004\f0X\370\030\023\263_\244\177Z\324H\001\317\230\330\257\340\177\237\303[\251\251\256+f2\314\314z=7\327\\\327Ws\3634\263\231f\335\372$\366\034\322\tB\250\201H'\245\251\tR\220\202f\f`\202Q\3206\017\021`\261Q\314\016\205a\317\356\214\335\201\325(\267\200\201\004\220jp\211i\357\003i\303%egi\230\275\306\257>\363r\033o\310\341\372Q\265\2741B^4\037\203L-%\243\n-;jQ\250$\343\275\334\257\353\355\332\361\375|\304:\352\343\331\337vA\001\312b<\205z=\304\371\232\344\317\035\336;\236D\2678\371}i"
+	.ascii	"x\373\b\372\n\346\326Q\256.\321\277L"
+	.text
+	.section	.gnu.lto_.jmpfuncs.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 \214E\002"
+	.string	"\322\204\r\025\260%\351\347\3600,\224\301:aa\030\006\214\033E\304\3362\245j\315\242\t+W\304\217\254\367\340\005o\213aS\223\361dl\001\243\342TV\2329?W\363\216\201\005"
+	.ascii	"K\025\025\246uP\351\231\235Eo\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\002\231\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 \233\255\002"
+	.string	"D\003\217"
+	.string	"\003"
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	"\002\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340"
+	.string	"\002\f\001"
+	.string	"\340"
+	.string	"\340"
+	.string	""
+	.string	"\002\001\024"
+	.string	"\r"
+	.string	"\001\002\006"
+	.string	"\001\002\016\001"
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\001Q\002\276p\340\005+;K@\351\241\342\210\272\200\347\201\224\3002\343\354B\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.79db58f6e12dda3a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.15.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 \2175\004"
+	.string	"\204\007Q"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\255\373\013yw\350\324\005yu"
+	.string	"\005\001\006'\001\f\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.ascii	"Z\205H\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_initBoardAlignment.17.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375`\223\003\305\026"
+	.string	"\206\353\222F\260\030U:\360\307\373\016\243\371\330\020\302("
+	.string	"\037\271\205\363\255\007\371\247\343\024~\241\220\016E\202\004\252o\367`8\230\375T\036{\265\364\217\232\201\037\247\002]\371\236\022\202\n\223\344\r\016?"
+	.string	"\205\364?\331D\312\224\002z"
+	.string	"v"
+	.string	"\201"
+	.string	"\266\t\233\364\370\367L\262w\347!;\017\305\267?\213"
+	.string	"\306\317\216\320\256\213\004\217\226"
+	.string	"Tz\332\337yNv]\212\003\330\315\t*\262\273S`\006\243G\357\036\003>\216\036"
+	.string	"|\264\314\2562\340\246\024t\353\021\332]\224\326\270\354\"0~\2322\177v\221\210\246w\020\306\343M~$\034[\252\tG\305g`w\357\363d\201S\313\024\321\354\256\023\207\363\342\036\335\366\t\333\030l\315\005!x\322\022\225^\220-\265\370>\266\271\217p\264kk\340\377\200(\341\353<\372)\300\307\223\336\347\001\226\b\311\310\351h9d\357j\2514\354\177\2539vL\317\304\264LL\237\256\373M`\232\024\3230_\372%\246G`Z\024\323\340\227\2161\375\201i\215\351\374\322' \273\365\020\220d\267\305\320\226\005\212Gp\234\367\333\367{\356c\223l\342<>\020\035\031;\217\001\237F\375\232\334,\342JF\273\373\251\342rYt\2526\207#1\221\0026\354\016\357y\210\231\262\273\r\036\277\036\334\025"
+	.ascii	"\231j\177H\345q\252\006l:\3635\365\267.'\275V\310\325\244\364"
+	.ascii	"\350r\025\350\033\371\021\225\257\343\025+\217c\201\217\016t"
+	.ascii	"\ba\321\335\356\fD\361\355\316\200p\336c\344\330a\205\347\335"
+	.ascii	"\356\306\031-Qi}\310\214\336\311\215\177J\343\307e4\243\210x"
+	.ascii	"\020\031}\020\224\273;S\007\260\325\b\226+\202+l\305R\261\360"
+	.ascii	"e\212`\262jA\314\265\262q\261Z#R!^\251\020\004\n\366\na\256\025"
+	.ascii	"\f\345j\245lP\252\027\f\265\340\200C\022\253\027*\026\206/\024"
+	.ascii	"iG\373\267\232c\032\232\326.\262\302\313!\027\310\363<J\215\002"
+	.ascii	"\033\273\264\343\374'\2072\201BM\r\370x\236\367,\340\354\013"
+	.ascii	"\031\3628\307p\001\272\321\231Ijk8\220r\201!\275(\314H_\364\023"
+	.ascii	"\322z\223\221\352\n\335\016\221\332\033\316D\b(\212\n\006? \300"
+	.ascii	"\002\231\031c\007@BJ\016\212\246?\265\361B\232\202\222\306\272"
+	.ascii	"\265\216\251h45K\371\254\025\250\206\310\344\036cR\022\303,."
+	.ascii	"\263\236\307|\002<h\021cw\020,3\222\3050\350\302\373F\b<p\007"
+	.ascii	"\243{\340\205r6\206\240('\361\265o\206\357\\1\002\221\272\230"
+	.ascii	"\242\340\016\350\302\005Q~U\263\270*@\001z\303\352Y\343\034\037"
+	.ascii	"3- \003\037\022\367\346\035*\3227w\352%\025\355\274\"\241\030"
+	.ascii	"\320\215\222\323\333\265\312"
+	.text
+	.section	.gnu.lto_alignBoard.18.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375`\200\004\r\027"
+	.string	"&\252\220I\240TN:\306\377\033r\206\223\260\261\025,\267e\344u?\247\376\264q\323F>\025F\312\253\030i\223\027k\327\204\211G\270\332\360\214\221\343\345x9\255\007\243)\254<X\375\360\237\373\037\372,SU]\323\226\020B\210\224)\005y"
+	.string	"k"
+	.string	"\200"
+	.ascii	"\177\323\377\364\265\377\026w:\224gOE\t\232\374\213\261P\233"
+	.ascii	"EB\031H  }g\321;\223\177$\020\007\225!-\r_sN\002\017]C>\214\001"
+	.ascii	"\257\366S\\E\357K\236\272mN\244\025Ts\372dl\200|h\337q\342C\362"
+	.ascii	"7\361\241{6\220\373\222\346\b\002\303\005'#sN\335\212x\357\332"
+	.ascii	"\363\017u\031\221\021\320uT0\347\264\022\031u\270\367\266\005"
+	.ascii	"\330\266"
+	.string	"\261C\\W\362=%>lY\232#\254\"\017A:f\373\200tC\330\007\347\"\331g\272_\336t\273\374\351n\371\322\317\242\352\234\252WT\255\242j\234\252ST}S5\212\252m\252\256\251\372D\325&\252.Q5M\3253U\223\250Z\246jR\325\243\252EU\207\252\006U\275\252VU?\200h\"GN\306\234\033\306\216\314\254\260j\304\231\002/P\220K;\017\"!\343\206KnN\352e\305\035\227E\314\206\177\277\372\214\327(oEC\357+\361\241\270\277\002W7\\Pl\350\203\313\356\202;z\305\360\317F\346We\215\325\256\215\217\252\226\375\352\2027\206J\b\351\230\253\374\003\300e\273\300a\2240\007~\247\212\340+=\364\204\037=\321C\377G|\370\035\301\240\302\252\244\310\227\315uE\335\370\347+\201.Ks\264u\0277\376\341\222\346\234\001\024\376\363\n\317\321\221\260\316\231\361\351\321\341\351q\260\363"
+	.string	"\247\001\017g\307@W\362ve\217N\251\353\331\301\341\321\345\360J\335\314"
+	.string	"\357 \350\360t>\273\035O7\363\315\203s\221\274\340DV\320\n9\267\276\324\312\3426\247\262+\313\"V\204\310\020\225\224EY\334mSv\364\002\373\nr\263-\212\327\217.[Xm\375\250\223-\331\232\311\236,\213\030\327Vy\253\036&\264%\331\222\331\322v\364\332\241\245c&[\222,\254\022\006\207lG\260Q\2501h\203\220TbASPv\263\006\360\002\221\231\242\007\020(\244\310\214\230Xks\300\214\203/*\3002\024\032u\265\222mkx\202\354R\001\357>B\225\220\034\200\200\307>WV:\242\347X9\242\234\007\241[\307h+n"
+	.ascii	"h\027\252\362\357%\030?\030\364\252\237HQQ\003\360\030w\250l"
+	.ascii	"\234\224\345\005\020\245\345\260\304r<\25722\354`q3\334\250\323"
+	.ascii	"\243E\033}1^an>#\"|\337\201Y\261\333\253\0271-\214D\223d\023"
+	.ascii	"\037\340t\301\202`%\005\"\277\340\347\017"
+	.text
+	.section	.gnu.lto_alignSensors.19.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375`\266\006\215\036"
+	.string	"\026\265\270I\260\324Q:\350"
+	.string	"4\363\2348Z\310\322\313\260*?\252\324\347C\200\275\001\007&\rH\"\025\334/(\026.>U\373\376\244\327\207\037\253/\3607\237\242\362\223\037\215\352\037\314e\374\362\360p\301{\250\246\266\377I#\233l\231R\245"
+	.string	"\230"
+	.string	"\244"
+	.ascii	"\324\026\312S\003\343\\[\002\005\335\203(<k\005\016\251\360\265"
+	.ascii	"\177\3438tg2\217\273\324jd\203\252\326 \004O(O\035\274\fyZ\036"
+	.ascii	"\206<\265\316\346z\020\251>\311\220\n\035Tj\255\265\031\343\272"
+	.ascii	"\323f\262X\t#\3518W\347#@\022\366|\273\323\016\024\375\f}6:\360"
+	.ascii	"\352!\3455|\206F\031\0262zG\342#\2642+1\256\362\t\354\212\034"
+	.ascii	"*\321\271Ci\204\315D=\003\f\034P\212~\202>\201~*x)zd>\036\262"
+	.ascii	"\254\265\276\310'\250\\\330L\255\325\333\363\375\334-\267\035"
+	.ascii	"\305v\006\233\314\t\366\207e\314$\3204\305\301C?i\204\231\033"
+	.ascii	"\200\212\227\342\340a\001'I\276y\220\247/s\003\320\224\025A;"
+	.ascii	"[\264\203\273\235G\366\307:\215\354\007\177\231;\3351\177\272"
+	.ascii	"a\016u\277\234\351w!\327-tM\243\353\031]\313\350:F\327%]\303"
+	.ascii	"\350\232\244kJ\327#]O\272^\272\376\002\231\317\221\001]\265\262"
+	.ascii	"(^\251Z\324\307\214;\375O?\324\247\375\353\270\360Q\236A\001"
+	.ascii	"1<\2210\320\023\240\256\340!\242q\241|\2167\351\356D\242\334"
+	.ascii	"\371\b\350\301@\362\252\265>x_\277\256\245\237\221\257\320\006"
+	.ascii	"\214\234\3760f\222\323\346\"\213\322is1,\362\025*\221/L\276~"
+	.ascii	"\3438mCM\254\276\302\026t\316i\033\022\362v\372R;mBE\036\261"
+	.ascii	"\352\373\204e\234G\323\237\332\251\036qg\213~\231\2376\241,\036"
+	.ascii	"\021f\002\240>\254\245\337\316\026}\037'\211Z\273\305\342\340"
+	.ascii	"<Z\3423)"
+	.string	"\273\220\370I`[Y\276\026\211u\345cQ\253!>\221Q*\210/d2\375\360\201\230\253\334\243 O\275\275\312\263D\243\276\260\337\3036\327\253\254j\335\035\270\275\332\340Tf2\330\272\252@\233%%n\342'\216s\263\321\241\321\271\341J\235\\\315\207\321\036\"\350\340\324\334\340\200\260\021A\363\001Gs\353P\313\341n9\234\232\\\r\307\206\346\246\346\001\227\253EP\340\333\210\032\\M\347v\303\325f\301\372\261N#k\360i\355L\036\332l]\246\035\342f\3373MX\324\352\231\273#U\361\242\232\345\310\226\331\241i\253g\253\330\247\362\257\234\237\344[\316\276\227C\236\266\314G=\201\257\270\364\243\272gv\213EF\243M\033\221\220\331l\332\210\206<\242L6mDB%_aV,\026\2336`WYN\033\260\t\217x\344+\254*a\260i\003\ny\001\200\203\250a\\\204\02444\"J\nS\220\2441"
+	.string	"\003\221\241\332\034\021\3004\351\0341\021\241$\005\347s\350{2\350ud\245h~\252?H\254\274$\351pi\211#\301F\022Dk\375D\333\210\200\310\375\322x\302\335\344+~\211\033)hH\351\0231t2\304/Cb=\372\271\315\341\302@p n\370a\273Zq\336\265"
+	.ascii	"\337F\374-\270\\\323\277/\325K~\250f\034|d\177\003\273\252}\257"
+	.ascii	"g@\273\355\236dj\220\211\350e\271d\004M\351<\023\272\177J\367"
+	.ascii	"O\351\376)\335?\205\356\361\002\213I\265\243\303\214r\t)Y\332"
+	.ascii	"o|\272<l\302\202\201,\022z\303wwn\251G\2316\304\030\">X\tw\214"
+	.ascii	"\322\00253\205\261j2?`\330=b\006\207\367\324'\274p\b\334\231"
+	.ascii	"\253\003\205<&H\272\210\266 \336\260\r\252\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 \366\025\005"
+	.string	"\004\b\362"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\017\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\013\013\200\204\001"
+	.string	""
+	.string	"\003\002\021\177\020\272\200\202\002\n\021\023\177\022\017\023\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\024\201"
+	.string	"\005\r\025\001\025\177\026\377\037"
+	.string	""
+	.string	"\200\200\200\001\024\177\027\003\002\t\201\200\200\300\003\001\344\006\204\n\244\013\003\002\b\344\013\003\004"
+	.string	"\320\360\372\250\001\001\342\026"
+	.string	"\r"
+	.ascii	"`hP\260K\341}\212\230\310T\361\004\303\345\3072\231\254\202\001"
+	.ascii	"\276\003\331\210\2622\315\241\312"
+	.text
+	.section	.gnu.lto_.refs.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375 A\t\002"
+	.string	"="
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"\001\t"
+	.string	""
+	.string	"\001\r"
+	.string	""
+	.string	"\001\017"
+	.string	""
+	.string	"\001\022"
+	.string	""
+	.string	"\001\026"
+	.string	""
+	.string	"\001\030"
+	.string	""
+	.string	"\001\033"
+	.string	"\002\002\001\003\b"
+	.string	"\002\001\027"
+	.string	"\001\004"
+	.string	"\003)"
+	.string	"\002\005\002\006\002\007"
+	.text
+	.section	.gnu.lto_.decls.79db58f6e12dda3a,"e",@progbits
+	.string	"(\265/\375`\022\021\rX"
+	.ascii	"\332\231p!T@PBJ\007\252\205\033\254\303\2602\350\361\257B\003"
+	.ascii	"?\234"
+	.string	"\276Rh 0\201ja\"\022\202\337\243\033W_\301D\346|\324\250\361 \325\271\236\227\243#\352\250C\241sr\230ca\240\324OT\323G1\235\003h\270\364\201P\323\033\303\312E-\355\232\221&e\n\272\001\377\001\n\002U\332\220I\335\371}S\311Z\247\313\033'(Z=\2120TWc\200\372\205&\253,d\026\314\273|\212i/\321\2255\311q\305\334\261-\263\313%\263b\210\210\210\206\266\251F\355\252\236\337-\365\233\326\257\224\372}R\277T\365_/b:4)N(\237aiqwEM\216\031\237\337\250\332esX\035v\271`\353u\246\335E\024]Q\256\276\226\313g\247[\352\252\252\273\277Y~\243/\330j-\027\0016\272\245\242|\312\304\251\001\345\255\273\207\210\210\210*\024\2671X\365<\257\376\203z\f\352j\331-\273<\330r\371b\331,\337)\246\255\\$b(\022>\037A\375n}"
+	.string	"\262n\007\376SY\350\356\326\331\203\351\316U\304\n\351\316\275\262J\234\021G2\005\321s\244\231ZQ\376[e\323\315\332\361B\333\361\204\317o\326\277Xk\345]\234\354.v\267"
+	.ascii	"<\266F\2067>\317\\!\335n\203t\234\\!]\002\033\244\333)F_*\377"
+	.ascii	"J\331\253 \335\361)m\255\356\376\301y\205\321\210\303'\247+\244"
+	.ascii	"\253\033\244\373\017g}i\273\364\335\317B\377\255\260\340\341"
+	.ascii	"\337\021\224.\376\217\375'\363\237\371\377\314\177\262\177O\350"
+	.ascii	"\345\360\377\353\177\227M\372\337f\300\317:\377B\360o\005\377"
+	.ascii	"R\360\257\004\377F\360\357\004\377^\200\302\277\t\374\273\342"
+	.ascii	"\337\007\376\367\374l\343\337\243\177I\370\227\203\1775\370\027"
+	.ascii	"\203\177?\374\233\373\027\367?\316\377\264\377a\377\263\376\273"
+	.ascii	"\371\357\366\177\315\377\020\376\263\370\277\366?\315\1774\377"
+	.ascii	"\305\376\267\370\257\374\357\301\377\241\377a\376\347\232\315"
+	.ascii	"f\363\337\342\317c\376\236!\001*\270R\023\307\2750\347s\270i"
+	.ascii	"\237\032\227\006\355\251\304n\212\024\024 \304s\323\217\0174"
+	.ascii	"=\2360z\004\355\361\305("
+	.string	"\367r\207\025UX\332Ce\013,\013\237\315\365\302\361\240\362\202\303[\375\276-\017\337\036\226\333\303\306\251i\353\320\231\262\361t,\361/\234o\234\237\001\007\276\303\256\373\252\273\t\3301#\227\026>\337\346\\\377w*\ra6nX\253\347_\327\304cw\357\310\245}l\332}s\273%\376\236\305\355\001\377\317\306\375DU7\0236\267\352\244\213\030\344\"\372V\335(\210N\373hTJ\241\306+dH\020i\017\021\240\225D\332\230J!\317ds\247\275]\224B\252`L\223Gc\232D\201\272\230D\273S$\220Q\213\210\256Q)\2054*\223H\020]l\264\225\304!\265\230D\032\305$\221@F%\021i,J!A,aS\302\344\006\032\342\227E\215\305\316\341\004E<\0021\215i\262\317\272W\213F\037\017\350\206J\036\317\210?\326\253\211\231\243iILn\352\3244\225\354\"\323hC\262\333\206\246\245vj"
+	.string	"M\231\215d\231(\021\250\306A\243{\200N\273\235\272\321mfw\243\335\255s\204J\273c"
+	.ascii	"2V99u?\r95\024\372E\243\233\265\322\274\220F\345T\322\350\013"
+	.ascii	"\213\262\252k\244\350V\365\231\324\261*Q\254\306\321V\253\220"
+	.ascii	"<\330\270Y\256\233Un\2206\032A\027\017\037o}<\2328\367h\343\306"
+	.ascii	"c\266\366\244\203\317m\013\321SD\243\003\313F]5\313\266\313\002"
+	.ascii	"v\r\016\265\362\3233\007\312\0348|\236\321\372\346\026\240Kw"
+	.ascii	"i[\306\332\254\251\351H\t\233\322\342s\325x\3236\315Wm\321\316"
+	.ascii	"\200\003\337\025\373\252;]\265\263\233\270;\302gwD\016\214\t"
+	.ascii	"1\013\316\231\331\317\227\234\032\272\360\371e\313pX\307\016"
+	.ascii	"\312\246\260\255\331\232\331\254\236B\263gv\271f\017Q\0037\370"
+	.ascii	"d\256\237YsEm\351c\366\203\213\327r\263\2508\0011\362\371\334"
+	.ascii	"\f-Zz\310i\001\313af\r\226%c\341,\013\242\233\230\304\253\217"
+	.ascii	"O&pfK\254\322~\332\214[ga\352\027\3122\216\263\f\273d\034\254"
+	.ascii	"\034\302J\321\017`\300@\231X+%hZ|f\361\262mM\031\256\372\275"
+	.ascii	"\232\342\"jRF\230\310U\032\025W\33506\003\023\361AAt\023A\253"
+	.ascii	"\272b+\214\305Ux\n\247\273d*L\303Y\b'?\304G\230\n#a&\313<B\301"
+	.ascii	"\325\031\017\241\3025p\224e>\001u\221K\r\033\321\020\021\321"
+	.ascii	"\207\033R\314(\237s\352k\0044\0317\240\262\306\326\235\376g("
+	.ascii	",e\227\034\345Ci\267V\024v\302V\313|J{\007\017\027f\231\333["
+	.ascii	"wJ\024\202\250\207\215\231\263 :+\034|\226\351\fm|\362\r:O?\302"
+	.ascii	"\314\240\262a\227\374\244\266\261\372\202\263\306#\226dJI\375"
+	.ascii	"Y\244\376|jR\315\330\242\310\354\250?sTN\302JvI\202\227|\247"
+	.ascii	"\360"
+	.string	"\221\347\210i\247\254D\216\226,>\177\316\250_\022:\\\263\271$t?\273\002\255\220\356\270\267z\\[\375\271\b\023\311)\301\270\221!\262l\270l\f\216&5\025h\203t\"Jl\220\216c`(\216\372w~\242x\031\331BS\317AX$\031\333\342\363\344\2473\220\177\207\3034\251r\"\253g\037\374\343\337\3619\243\322\202\005\246\236{l5\335\200\360\3110T\032\270%\211\017Q\\B\202\360y\206\341\347\034\254\203y\240\320BS\316\033>\031\311;\316<\370\330\314\243\201d7\221y\374\304\351&\376\354\216\330\035qF\231j\262Ew\036\227\245\376l\205t=XFg'\0362alU\232p\r\256\3017\266\f\212u\220C\206\204O\276\261N\322D\251\341\223\215\347\212cc\214\327\262\311M\271I\323\305\347qR\365\213\266<c\227<c\3256m\035\001C\036\360\205\213\\\013\241oH\370\343\371\222x "
+	.string	"CH\002\022\n{HH<\235\t(J0:!\307\202/8\344y\360\302\027#\205 \031L\300\013\202`\364\206B\031-\204\206_:\241\304T\244\304\024\204\364\213\221\301\260'\344\371\271\340aO\330\013\346\204GJL\273\341\321O\211)\367Sb\302\r\217R\030\325^\013>\341)\024\366\202II<\035\031L@\24438d\302%\365t\222z\302\030'RO\250\363\340\221\022\323\211\236 o\t\351\224\021\034\n}J=\020\216*\020\240\305.)\310K\372\361\206\302"
+	.string	",\030\372~>"
+	.string	",\370p$_\260\367\353)\3257\220B\201\024*X\320\271\212\025\013\254X@w\025+\214\214V\2440\252Oa\204;\322\017\350\033\362\206@\020z\206<\303#\025\303\237/\206\316\013 \320\202\243\334\n\274 \316E/\351\250\347K'\204KC\036\214\242\037\020\006\f \322"
+	.string	"+\360d\340\216\230\\\354\2349a\357\205\322\217\247\033~)\201\003\231z\301\242!\020\030,\342Y\201'\343\203\360\250\002\240\027/\200A\236\341\021\003(\206?\237\316\215\214.\020!\002\013\r*\322\211\341\257\007\343\247\344{\301K\n\362\200)\024\t\203@\341\257',\372\371x0\212\220\202\302\242\023\b\b{\275\240R\017\203%\244\241\217i\367\237\3236\316\217\0171f\272\360\371.>\373i%\211\005\264Ks\343\242\345\005\215\030\017W4`8\303cW\274\354\360\306'\031\031\233\331"
+	.ascii	"\355F\305p\331\331\314\252\355"
+	.ascii	"\336\334\300!$W\245\fgi2\245\007\031\237_\276\360\330P\355)e"
+	.ascii	"_\330rlC\322\024!s\036\353\352\261\026EcL\225\333\022\224O\006"
+	.ascii	"\303av\031\202\305\2609\322\204\304\241\272\320\275!t\333ln\b"
+	.ascii	"\335sF\352\267\276\305bk\245ul\026\332S\211\237T\315\020.\376"
+	.ascii	":\213\235\303vlF\214\274\240\003\203\375;;i\300\204)\023R9\007"
+	.ascii	"\356\242;\343\343M\221\034\020\022;Mt\2077Up\226P\361\311\\\330"
+	.ascii	"\353C\fr\242\304\274\270+\350\315\211k\333|\202\024)\022\201"
+	.ascii	">\250\201(g\024D\310\314\214\210\210$I\222\016\021\005\204 \350"
+	.ascii	"\2643\017\022\340e1\2151\306hj\222d\3778G@#FJ{\327O\203,\n\177"
+	.ascii	"\237\0030gT\rN\345\271\320i\354N\232\354\277?;\330\r\262\023"
+	.ascii	"\216W\224\335T@ KX"
+	.string	"\362\247&Y,\211e\006$Y@\271\250\221\024\356\220\202b7\317~\205\321\364\321\2661\023\244\235\301\0025\3573<\".C\260\n1\223{M\223Q\241\317\222|\364\305|\362\220\341\356F\236W\230\251a1\236/\007u&\240\271\310\324\365\265~\367\255c\036\013\017\360\206\361\033\250yM\343\037L`0z\031\030\\#QJL`\030l\321'*C\236,\205(\277\024\374\322y\304\025~\304\037)\304\257\247\213\332\363%\300\r\3760&-\273\354E\301\362\013X\0370\360\256\310\371\341I=\231\257>\310+\266\240Z\232(\325\221\206\232^\332\203\260\307$\260 \274#Q\331\016m}0\253\317\355J\263\320<-\0224\\g\005\252\242\b\355]\206\357@$\206\232\035\f\032\240\264V\331\250\367\261\271g\324\335\027\004\276\f\360|\224\216\200\016\264+\303\202\351U\301\"\356\243\342\346\330\307\277q\230\254\310\017\27165"
+	.string	"h\025L\341g\342\027\200\025\263]\313\007\212:\312-\360\177\0135X\331\032\226\023\323\2049R9g\035\204\227\034\323\340\337\336!\321 vb\307\211EL=}3\330P"
+	.string	"\241\223\200\341"
+	.string	"\356\311\236\371o\177U5[9Aq\220\247\021\350\234\003-\334Jvb\005>h\227f\2011\321^\334\007z[\322\310\313\322\377\301\200d\f\317\r\005p\356\245\256\311\237\260Y\231\256\b \226\"\006g \224$o\016&\351\234\264\243\200\224aD\tl\225\324\375\353Z\313\307\031\335*\302\2704\275(c\206|\373^"
+	.ascii	"Ue\0041R\204\334\204\n\344\225\366\310l\255a\221\215\305#-\235"
+	.ascii	"5\337\205\347\375o\353\354W\017\024\341\361\024-\fg4\032\006"
+	.ascii	"\017fxQ\320\201\275W@4\"\344=\255\256\235\376-\240\340R\353\036"
+	.ascii	"\353\005\034\241\025b\240\362d\f\213fc\b\002edX\300\3606\200"
+	.ascii	"\3765\312|\250\367\275?\024\257\341`\013W+C\357\306p\362\b1\330"
+	.ascii	"\240\211\260\343b=*G{3~\362\373\031\177\346\2740\3540P\362Gn"
+	.ascii	"\245\317\332r0\354\314\033CA/b\013\340\211s\341a\310\370\302"
+	.ascii	"\036\204#r\303f;\360C'\344\224\274\b\0339\217\244\n"
+	.text
+	.section	.gnu.lto_.symtab.79db58f6e12dda3a,"e",@progbits
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.79db58f6e12dda3a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,573 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.text
+	.section	.gnu.lto_.icf.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"e\005"
+	.string	"t\007\030\001"
+	.string	"\020"
+	.string	"\337\375\307\265\007\022\002"
+	.string	"\002\001\002\002\002\001\002\003\001\274\205\242\255\006"
+	.string	"\002\317\253\250\341\002"
+	.string	"\003\315\344\253\361\017\002\002\004\002\005\004\240\342\234\212\n\005\240\224\254\300\003\006\006\314\361\201\203\017>\002\006\002\007\002\002\002\b"
+	.string	"\002\007\002\003\002\003\002\t\002\t\002\n\002\n\013\003\n\002\n\007\b\n\352\263\360\321\b\013\f\r\016\017\376\215\241\215\002\020\240\342\234\212\n"
+	.string	"\027"
+	.string	";E\300]Jc/\262\251c\037\323\362\345c\347\302n\001\254\360\225a\b\026\274"
+	.string	"\370\371"
+	.string	"\026"
+	.ascii	"w9\307\336\224Z\347-@\3134\003bg\255\006\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 2E\001"
+	.string	"\360&"
+	.string	"\006"
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\003\003"
+	.string	"\003\005"
+	.string	"\003\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"tNx\tn\003m"
+	.text
+	.section	.gnu.lto_.inline.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\004"
+	.string	"\302F\025\037\240'\351\340z^8T\025:\341\250\027\022\352\221\237R\317\377\377W\330E\2418\324\254\224;\005?A\331\260\370\360_P\313\"m\252\306B\td\203V\330\023\321\321\246\263r\030\001s\346\025m\323\205X\333\362\372\337C\034<\032\243m`_\211=\332\2367O\002\021"
+	.ascii	"\256\3218s\235\244\220#\215\2010\3018\n1W\240K\340\t\341\030"
+	.ascii	"h\001\326\001\310\035\345\302M\344h\032\203\305\216\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 \207\325\002"
+	.string	"\362\004\021\035\260'\215\001\f\303\200\003\230$)?p\024\247\241)\2114Jg\202x\203$R\312\224\002\n\214\"@5\343\027\323\026\b@e\336\330\\\356\313\321\"\310\216\333Y%\030\016\016\312LN\017-D\237L\275g\"\007"
+	.ascii	"\240\b9\213\232I8r\326\323y9\312\360\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\200\004\002\200\004\003\230\004\005\204\004\006"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 y\225\002"
+	.string	"\204\003m"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\023"
+	.string	"\003\002\024"
+	.string	"\001"
+	.string	"\001"
+	.string	"   \002\025"
+	.string	"\020\020"
+	.string	"\300"
+	.string	"\b8\002\330"
+	.string	"\330\002\001\002\003\001\002\026"
+	.string	"\001\002\027\001"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"3{\252\306e\002\r\317"
+	.ascii	"5c\370\f\315rdK/\260\n\f\260"
+	.text
+	.section	.gnu.lto_.lto.2067aa27b9a38918,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.26.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 \227U\004"
+	.string	"\304\007`"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\203\276\331\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\356\006us\350\305\006uq"
+	.string	"\005\001\006'\001\030\250 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.27.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375`Y\001\305\013"
+	.string	"\206\324LA \307\272p\227 \370!\230\354\260\265n\037\232\317\223\214:6\211%\200Qv\201H\006\347\230\203\367\253\266\366K\223\035\034\236q\200F\210\002\f(\244\0272\001\340v\023\0053\260 7\375\031=\331)\0056"
+	.string	"8"
+	.string	">"
+	.string	"\273*\204\0372\007\255\276\023\036\314\\!<h\324V\300\360\301i\240\242\255\273+~'G\357\241\376Y\256Y\261\322{\007\024\273ko\305\032\271\277\333v\260-a\177A\007}Txp\002\244\244\025\323\245\274\235\255\246\336gb\037\263\273\353\317e_\366{\234o\200\352ea\267+\262c\2608\320\246\262\261}\317~\354+\350e\250'\354\272n\265\005\310\024\001\ft\333+\267\206^\233\345\004\334\3168\201\327m\025=@)\275\301\376Rh\227\007P\272\b\321\265b\246\320>O3if.\353O\241\275\361\226Sfw#\374\031GG\007%%\240\020\306\250\254@\360\3509\317\017IT\216\342i\226\347\210<\305Q\350#\022G\363\024=\r.I\244)j\224\245)n\324=f?\227-Hp\251\317\3037p\373\363\003$+\001\214\f\355\361\001\033"
+	.string	"s\311\"c\017\213Z\213\263"
+	.string	"P\2071n\004\324\001\330\201\357\220\332\034\374\346\204l'\365\007\fHz\021(\320\001\004\244T\322 \343I%\022\3520 \023\232\301\274K"
+	.ascii	"\315jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_compassPreInit.30.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 \302%\005"
+	.string	"r\311\"*\200k:\300\\\202_q\030h\3040\200A\355t\233B\374c{\331\277\247\267u\021\255\031\302T\340[M\220\205\210@h\357\224\002\256\246Z\251\354\232\225\254tV\314\252\022CP\227\254h\225\223\344\231YT&\346\2442\372\366\321\033(\342\302\3766\030\037\366\001\033=\033B\027\215\304\331m|<\233\tX$\266\037Y\2637\377\"{\n\206Q\351\354\256\214\220k\207\232\377\311\005\\\267\035B\206\3355\344:\307\035o\233`\273`\373\020\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_compassDetect.31.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 \370\315\006"
+	.string	"\262M15@o\222\016\230>*\3205u\t\\fL\240\353\217\347\240\321\017m/3\352\337\334\257Xw\353\030L\323\3100<\r\027=\207G\232 <p\271V\3274!2\005\022\326\203\273\322@\270\361p\256\352A\354\202\035\013\276\016\304\206\363*\f>M\301\227\307\302^\304ua/\023\263\031e@\341*>\202\232\333\370\002df\356F\337\252\221-,\016\245\314\320\213K\252L( \177\377\317g\376\326\276\"%}:2Q\201\314\021\351$3*\234\200\351t,\001\325\t\323\001\252\323\377\002\303\347\254\261#T\217\017\213\222\226\314\370\034G\263\266\354\226\244\007!)+%\023\021\250-\240!3o\027\"\214\356\372#\374\357\317\b\006"
+	.ascii	"2\003\202\341\243\302f\0250w\031\363\272&\031"
+	.text
+	.section	.gnu.lto_compassInit.32.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\202\31505P\213\222\016`\271\332DS1\210\241\273\344Sk\212U\005\213o\305\201\271z\323\373\201h6\232\277N\266\353\314l\223\234L\034\n1gnR\003\034h\214\020\231\002S\224\030-\032LE\301hU1s\2110\303`\301@\312\212\220Bp\245\271X\260\241\252,8\321\260^\222+\330\353<\351w\006\357\320\216I\003Yf*\334Q9\036nF\247!6\256\236Nw#\351TQ\335(T\252\330\33007\362Z\307\275\320\027 3\363g\361\257\024\271\211,\204d~FJ\t2}h\374\234\237\214\220\300\371\252\226}\212!\222\360\33025\370.z\325]W"
+	.string	"\024Q\027P\311\314\235\0074\321_\377\202\377\340\317\002\b"
+	.ascii	"2\003\302\360\030aF\035\302\251k\b\021\"\207;w\333\342\004"
+	.text
+	.section	.gnu.lto_compassIsHealthy.33.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375`e\001\215\f"
+	.string	"\366\226P? o\224\016\303\002\202"
+	.string	"22(\260\230\f\354B\303\"\331K\310x\315\214\017\240\006\265n\205S\264Ov\314\fFZc&\230*$@@@\0200\271fO\215\237p\232t\315\225\354\275\245L)?"
+	.string	";"
+	.string	"A"
+	.string	"\32784^a\004\003D\305\256\026\225\302E\207\317i\212|\n\363R|0Q\312\260C\t\177\020\322I\262\213\324"
+	.string	"\331\003G\331\335cxfd\244L\n\263\273\316R\026\341\246n\333c\273b\277#\276\205?;"
+	.ascii	"\345K\177>\b\376]'(DFy\2625,u\303\276[5\331NCM\273Lk\2463\323"
+	.ascii	"\247\004\204 \261@\304\256\306\211\305\216x\"\027l\207l\211\017"
+	.ascii	" \bY\024OM\372\r\367\340\355!\035>\377\340p\203\200\177\252\017"
+	.ascii	"\321\273\324\234`\340 \336\342\307\307\342\221\032\237\273\213"
+	.ascii	"\351V\340\252%<F.r\205\345\232\267\311\211\335U`W\327\360\031"
+	.ascii	"\300\261\273\t2\274\343\n\326\\\256+\343\341T\232xY\325\325\331"
+	.ascii	"\\\261\303 \303\211\032\353\212\027\002\256<\033+6\250*+J\264"
+	.ascii	"\275[59_\345\351,w\232a\033*e\244$;\205z\214\026\243<\001\200"
+	.ascii	"\272\001U\333\305\002! \320\002\031\n\356\006\013\031z\306\031"
+	.ascii	"\336\313\"\007\034\307\204\361\b\274\244\006+\353\336\314\225"
+	.ascii	"\336\353-I]*\243q\273\344\224k\324\250\001v\334\263\201.\030"
+	.ascii	"m\006\341\371\341\313-J\005E\036\274\217y\234\244b\240\033\005"
+	.ascii	"\247\267k\225\001"
+	.text
+	.section	.gnu.lto_compassUpdate.34.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375`<\016\215<"
+	.ascii	"Jbt\025BP\246N\007\253\202\202\301\373\377\327\221\b\337R\205"
+	.ascii	"/oY{y\t_\247,ch\266\tRkS\033\230\0320 \020\021\204\020\210I0"
+	.ascii	"\320\267\n\326\352\351\256W'\231\240\220O\203L\204\354\275\367"
+	.ascii	"N)\245@\001'\001K\001)\353\214\256\316\257:{\352\334\035\222"
+	.ascii	"\316\334x\300\273\227\307\223\320m\223:\335\032\257\333\256\233"
+	.ascii	"\256\033K\243\376\356\2762w\336\023\215\341\245\3016\367v\247"
+	.ascii	"\247\347V\267Eo\0077\223;\013\026\026\303~\215\261xZ\372\362"
+	.ascii	"\334{\253:e\bl\247h\220\231\333\231\333J\313\265}e\006\377\356"
+	.ascii	"M\223\363r/3\001#`;}\352\242\332)\332Hj\247\314-\363\235f.ok"
+	.ascii	"\301\023f\007\350\336k\365J\220\214,\177\243\314f4m[)\311X$\""
+	.ascii	"\035\031\r\213\204KDCA\340\217]\325\024}o\271\327\n\003\322\374"
+	.ascii	"\021#\373j\245)\235\344\226\267\304\215L\272\230\327\032\330"
+	.ascii	"\346\364\244\2251i\":\\\200\346Hk\205$el}\264\326Fkwj>\\v\321"
+	.ascii	"\362\256\210\013\033\311\326KmN\306\342\234h\n\021\037:\353\340"
+	.ascii	"\031\224\223\261!\016L+\023\322?t\030\244.\314Y\250$ef\275\256"
+	.ascii	"\025\352:\003\333\016=ief\255\242Oo\306\204\240OsIO\321\341\275"
+	.ascii	"WHV\003]\3408\310\300\034m\342\243\277\2634U\363\217\030\231"
+	.string	"\217\366\265\302\275\227]\214\254\254\031@3\273\001f\236\300<\304%\033X5\350\367\\O\331\325\245\257\344\037\337s\370\347\363\252\226z\034\tZ\352\333\017\035\037\r\027\324(\212\240\245\236\303\367Y\363O\022\r\314\237\374\217\206\233\305=\346\320g\260\204\3132m\306\303\007\020 \324N[l\217\377\377\213I\346A\372\363\255\307\034\035\210\361\357,=\025\346\031\310\211\364\347\377\275\367\353\231\350\315l0$\232\226_\332\2315\202\004\tf7Q\020\367\356E\266X\227\347\240\221\032\377\305\314%\232\213\t\366\336{\305\275\245\365\264\270\333:\345-\024\336b\235r\243P;\355\177(}\201\256 \375\311\314\004\363W2w\337G\302\314aC\006\n}\245\373\001\320\331\001\353|\325x\315Tm\327<\325t\315\007\032K\263\224\352l\340\347\034\365s.\360s&\240:\017\3709C\251\316O\252\263\323\352,@unR\235\231V\347"
+	.ascii	"\2523\200\325y)\350\254\024tNZ\235\215\253sQu&\256\316H\253\363"
+	.ascii	"\321\352l\244:\017W\347\242\325Y\270:\023\251\316C\253s\020\350"
+	.ascii	"\f\004:\377Tgvu^\201\316\352\3179\217\364F\342\027\223(\221\020"
+	.ascii	"\275\210\247\0351\342\315b\324N\221>\rc\346\350\211\234\r1\372"
+	.ascii	"\242?\032\276Q\0203 \303\004\376\303G\217\242O\303\004q\n\237"
+	.ascii	"\314\307\234\007\321\007_\370\235|\033z\242\367B\311<:\216RK"
+	.ascii	"\317\3418Z\267\002{C/\245\346\364\033n\003K\270\364\260\340\247"
+	.ascii	"p\315@\316 \360O\320h\343Z\266V\016\370\377\243\031g\006\374"
+	.ascii	"=\367\034G\366\240n\343T\365\177\350\0313l\302\314\300~\257\344"
+	.ascii	"\340\332J\341\3235\265\252\017\034xO\342\354\201\247\360\r\245"
+	.ascii	"\314\263\257\320\213\026\256\317\3144\331\037tt\022\224\325\264"
+	.ascii	"\007\250\003\265n\034\243\205\203[\237}\264Or\215\037n2X\366"
+	.ascii	"\301J\300g}\"%\2278'"
+	.string	"\362\2502i=G\246vI\347\311b\3574\236\326\315\270\274\367\266M\332'\303n\341\352z\252\006\036 >\275>x\356:mg\206\214V\212\024\265\323\227s\027\350\214\231\367^\265\233T\007\354\033F\273IU\337A\317i:m\034w\033\267UZ9o\261VN\355T\375\364.\210\331\223\247\337\314\216c\201\205\203e\334{\303\0270x\213\361\323\325\247\275$\254\257\237\315\245\242\177\365\354af`\032zM^)`\230@\275\216[*R\204h\261b\253\253\313\205\026\021k)\360\3622\301B\005\227\226\225W\027\227\327\212-/\253\025)L\250\260\322\352\362\262R\320\304\\,\266\272\254ZpquY\005\231\310~$,\202H\033\344\203\261\322+\231[%\255\332\0162@\332\200\375WR1\303\247|\304\252\246\242z\217\322F\252\317\360L\242\031x/G\001\336\364.\255\033S\324\033xTNX\237\243u\201\217\372"
+	.string	"r\222T\b<\324\027x%\273$\332\200'\300\345\330c\364\262:\314\226\001\337c\324\234\017\365\035\326\267\346y\307\b{xYW{wO\337ym\365#\316\027_\271\244\353\346:J\311f\n\037\"\337\321\206O\371\226\252zj\352=\n\322\324o\370\266r\346\351GNY\2600_8\2611\022\260\246\351\005\\9JX\272\\V\203\245[i\372\"\245\232!\323S9J\355\305eE\355MYz\246o+h\232\3115\013\356\275E\257\f\360K\337N\350\322"
+	.string	"\370"
+	.string	"y\242\034%,\035.\253\301\322\241"
+	.string	"x\tm\233;\341\246S\023,\246\267\245\357\273\226\352\223&\316\331\346\225\334\275\364H\204J\222\317\236\241*}\027\235\232\244\177\360J\017\343\f\236\344\033\030\321\f5\251\216\267%\375\313\0313d\3745\265e1\201(\250q4%\231BD2\"\222$\251\2441\241\005\204\030\006!4\017\021\020\245C\216!\252MRi\f\223\340\215\025G\347c\323D\207z\020R\005\021\t\016\302\035\002\330\310\346\235R\211\321\232N\033z\214\034\006\357\364\227\370\221\2263P1\250F\211\345\031\215\006\327.D\202\221\261\374\3208\363|\024\237\310P\234\030W\305v\356\2141\371>\035 1\003r\277\r.4\231\261%\265~Pyt\021:\373\202\276YQ\227 \300\016).gv\230\206O\213\266XJ\006_2\226E\2303$\235\277|g\243s!"
+	.ascii	"\217\340\244e\266\001|\345z\356P[\231\361>T\342\257jN\250\220"
+	.ascii	"L\311\303"
+	.string	"\202\024\rF\033\261\020%\020\273=2\013-u Nd\343I\203R\013\365\267\220\334\375\004\3527\301\215\357\257T\301K#\322 \336\376\251\354=\003\360\f\376\250\001\030\321\337\262\350=)\345lo\330\007h,\277\016L\223\032P(\330 \2140\256\310\005=\263\336\300B\3341\345\031\266\024\006KX\353\004r\001\315\334\220V\255\223\214\266\240\035\345\235\367\220`\314\340v'\237\224fpH\026\006\317xN\270u>\033\001\322\027\276\026\355\240p\370\26615\222\r\351\2532|\365_\b&a\364W/\260\"\370\0321\325\031Wc5ZS\027\036\311\216b\3026\304\361,<vI2\006-+l)\2727SB\302\326\266ra\240\005[|h\0134Z\257\323U-\034\374_+\310I\206I(\314\n\242|\322O\255h\257f.%\312l\310a\216AaN\016\316X%\332\347\201\274#2\r\035,\372A\001\230\225"
+	.ascii	"G\274\026%\3608\030R\262\266\272\276Tv\276q\364\024\220JJy\301"
+	.ascii	"\017\34299\347|\365\300\237H\354\252_\333'5\326\357\345\252D"
+	.ascii	"\325&=\363\034\016\237\f\376*/\tF\256d\002Ao)WL\204:\031\345"
+	.ascii	"\370\307\242\277\223.A\204\253\374\357\304\211\036\020\033\330"
+	.ascii	"\250!P\343\266)\340\r\031\2737m\235\302\211\026Q\310\344\323"
+	.ascii	"i\372\211v\347H\250"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"\355\005"
+	.string	"\302\210!*pE\352\374\377\377\353>\377UU\205;&\343g\210G\006"
+	.string	"\366\005@\250\252\370\037F\266\326\226l\315\300\257\314Tb\327\b\221)V\250\376?\36442:\377G\220\023\030U%\310\001\227\323\377v\026\360\355A\275I\332\0221\002q\204\fq\021>\020\326\261\322Q\334\265\201\3327\013\231'mO\254\223\316%KF\003\251\327n\326j:N\004\004Y\355\2446\273a\261\206\202\271\330k\003X\364\371\377i\253\306\266&\002\026"
+	.ascii	"5+\030>E\326\317t`\004\303\345\227\253!@n,\271\201\334\212\312"
+	.ascii	"m&g\201m\346j\030\320\027X\003~P\301*\200\036\340\017\030.\220"
+	.ascii	"\341\262s\f"
+	.text
+	.section	.gnu.lto_.refs.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375 \255\325\003"
+	.string	"\322\212\035!\220\033\322\032\253\333\375\377\377\377\377\263Ta_Ya\034\240o(\324\312\206\366\336\204\220 \"\367\226)\037\346\244#\200\336H\266\306\032C}\261X\213e+\326\024\312N\250%\356\210e\210\263\017i\207\273\341,C\272\271\027\316*\244\023n\204\200\017\024k\260l\201\262\004\367@\262\314b\227\262\272SA>\316\242\344\223\234\0079\r\t\320<nt\333=P;C\366\214"
+	.text
+	.section	.gnu.lto_.decls.2067aa27b9a38918,"e",@progbits
+	.string	"(\265/\375`\364\037\r\230"
+	.ascii	"\212\372 7R0\220\312I\007\372n\302G\375\"\007\273j\205E=\277"
+	.ascii	"\264,\rkr4O\256N\261\356\037{=\253\007\365U5\264\355Pc2\335\021"
+	.ascii	"\273\252\306\350\246\271\017\006B\240h\224* ej9\224\nr\b\f\256"
+	.ascii	"\332\246\245\231*.\310\231\033m%\226\354-S\341\002r\003p\003"
+	.ascii	"\037r\226`\301\362a\321\337FY\030\026,\367\310\026\265J\3372"
+	.ascii	"\214\231\225"
+	.string	"E\177{`\013\325\316\206k'\220\r\232\224\261/:\216MZd\357\331\243\315\366\251\341\330\032z\265P\035\367\036\323d\216v\016\026\252\345Z\357.\257\316\354\254\257\340\201yA\203\206\345\271\205\313\334Z\2274Z\324:\355\347\346\274\203\256k\254\004\005\026\252\311\372J;\231\0314yS\227\363j\241\232\255\333~\222k^\246p&\307\216g\316k\321P\221\017\016&Wp\002\240y\037R\"qo\324\354p\232v\323N h\034\266\272~\366\332x\215\006\257\313\364\031\244\227\256\017E<X<\2260R\364n\350>\273\240Y\261\350-\027\374~\233\273\322av\r\367\343\313\271i\326\225sf\323mZM\257\275\246\353n\327K\360\033\275\3274]\303\201x\221s\363J(\251\227\366\365\3149\027\025\r\025\371\356\352\360\3540z\033\004\337N\341[%\276E\342w\036~\307\341\367\231\277\2474\225\206\353f\316\311\234\363"
+	.ascii	"93\264D\311b\321v3z\233\021J\251\230k\036\273h[\240\364\300\340"
+	.string	"w\027\334CM\206\033L\207\351\365C\213y\273\365\333}\3105\2579g\240V\003\344i\031\005\317\220s\177H{o\257?\244\357\"8\250=\244\266\205\322\376\322b\356\336\300\260\350[\013\277\231\370m\003>\r\370cM\370h+\340\257e\361\211\303$N\236E\237\002>\n|g{H\257\001\276\\{H\273J[\351\325\200.{\t\n~\217a\031,\347\025\b\275\321\326\203\210EO\001~\033\220\366^\033\220\236\b\277\256=\244\021\264\2074m\2414H\354\357\257\006k)W)\325\314c9\257\035|R\2744AZ\264\235\364\223^[\312\337Q:\354hX3\213\345\274\372\\\344\215\2663\213\206h\017)z(\007\n\223)\270\305o\242\024\250\211\322\257\355!\305-\224\376]\245\367\274\274\263\277\333\374\375\006\357\357\027:\304\1773.\376f\341\357\343\035\370\017\"\354C\177'\220\374\210\377\222\360\024:\377\005\341\357"
+	.ascii	"\236\351\177M\034\360\377\376W\203k\364\037\316\337\367\177\331"
+	.ascii	"\337q\376\376\377\275\277\355\377,\177\247z:A\377\025\3617\334"
+	.ascii	"\337f\376.\3637\231\277\343\376\226\373\033M\243\375\r\346\357"
+	.ascii	"0\355\346?\320\177\331\376\276\373\333\356o\272\277\323\374\355"
+	.ascii	"\365w\222\277\215\374\315\365\367\220\277\203\374\375\343\357"
+	.ascii	"\255\277\263\376\336\3617\363o\033\377G\370\273\206\377b\376"
+	.ascii	"\177\371\033\377-\365w\324\337B\177+\377\006\372;\3717\362o\032"
+	.ascii	"\376\236\341o\031\376\216\341o\030\376V\340o\017\377E\370\233"
+	.ascii	"\347\357\235\277u\376K\371O\364\237\355?\336\333\333\333\373"
+	.ascii	"\355\321\357\323\373\207\222\001u\315\004\007-\"aP\357\365B]"
+	.ascii	"%\321\232\217M\327\314c>3\025S\004\220\f\253d\224Eo\r?xb\246"
+	.ascii	"\254;\360sr\020\335\244Nr\005\352A\3360\003\263|\272H\0350/\314"
+	.ascii	"|\261\350=\246ll2\232\026}\216\022\3777\277\361\246@\331\221"
+	.ascii	"\267\327zN\316\340\224\211C\2047\346\311\013N\237!^\255=\255"
+	.ascii	"\336\237/\310\035ac\321K\360\264?\272mm\254\256\214=\303\306"
+	.ascii	"I\235\004^\254\234\333\2236\366\316\346Y7\026\317\276\261lz\265"
+	.ascii	"O\213\343V\215]\363\241\006\263O\013\304v\001\361\244D\263@\251"
+	.ascii	"{Z\037}\205\214\312oy<m\217>\323\244J\335\323\242\261v \236\224"
+	.ascii	"\031\245\262\272\251\341UT4dq\260\301h\013B\321\265\205R[g\004"
+	.ascii	"\216\230\217+\230nn'\213\234\0322in\347n\327\033\232\033\035"
+	.ascii	"=n]6\214ak&\353'\b\221\265,\213>=\202\237\022\301nT\222L,:\246"
+	.ascii	"WK\306\262\215\221\261_l\034\031\232\232-\317\236\f\003\017\013"
+	.ascii	"\032\007\027#F\235\322\242V\214\316\227\0326\272\354\201\351"
+	.ascii	"\325\206\371\034Q\326\221\031\026}\033\353\264?\342\350\3368"
+	.ascii	"o\337\2502\025\034\026u\313\231[\206\tK\203\333,[\026\022ni\006"
+	.ascii	"\337\267\206\357K[\263g\234TM\241\202\325\354\226^-\027;d\210"
+	.ascii	"\213\rbqX\346\224\251\343b\211\330\264v2\203rr\016N]QQO\331\022"
+	.ascii	"GM\212\212Y44]Y,\026\253\245W\233v\233f\271\254\327\317\261C"
+	.ascii	"\316>\364\272\322,\023\0336#\245\313c\356\236E<R=\256\216\030"
+	.ascii	"5\263g\275Z4{e\314\226\265\223\271\346\031?V\232c\356\236h6\007"
+	.ascii	"K\005\304\2232\004-g\352p\232\020-A\276\312\254\370\3008;B\206"
+	.ascii	"\314V\331\261\301tj\341\302?\331;F\221\027l>\360{}\032;\345s"
+	.ascii	"7|\271\341$\013\337\227\003\337w\003_\2020\333\304Bi\347\330"
+	.ascii	"\t\267\271(VJ\2576\314\256ca^\350\352~\270\216|9I\321\373\242"
+	.ascii	"0\272$I\245\315\242\366\313\202\365j\237X'\331\307g\356J\r\211"
+	.ascii	"E\357\313\270E\316\325\322\243x\370h\033\254\304.\351\325z\331"
+	.ascii	"$Ck\316e^\266\210E\002\342I\211b\307\233:0/\333\325i?\3075\313"
+	.ascii	"\340\341\352\032s7TT\224\303#\013\024!)z\264\n\222#\027\207\362"
+	.ascii	"\212\036\027&\334\020#v\b\217\231\250<'\005\037\375\302G\215"
+	.ascii	"\340\243A\360\321+{\003\020\025\255'^4\260\025r\324\006|4\211"
+	.ascii	"\177\363\360o\032\374\033\207#\260[Z\255UF\210\232E\265\262x"
+	.ascii	"\324\200D\251au\233\205\325\2233X\316\031\204O3\214\022*\026"
+	.ascii	"\265X\326\356\260\315[,{\325\223\264Xh\316\310\356\004~\272\023"
+	.ascii	"\360\251\rAJI\321\3377l\231V\307\214)N\245\216\0348\f\f\262+"
+	.ascii	"\026\2659,\216\373Xi{\272\331\202\337\306V\351\330\305\275\001"
+	.ascii	"\251\202C{\0241\373\272ai\364<i\223R\206F\303N\375\354G'\347"
+	.ascii	"56K\303\312\260T\355\034C\225x\261ak\364ji\330\345;\007;\343"
+	.ascii	"\350\232s\322\307\311r"
+	.string	"\rM\212v\276h\226\352\2671\032\355g\2669\200}\263\333\361$\303=7\t\376\255\224\001@\353\215)\0366\004W\214\375r\301\360\\\001\263D\311\363C\221\217\03289\035)\230_g\331\372c\215E\357[\016\263\212\355\305[[\257\327\r\267\361\302\222\3674<\\\204lu\301\337)\353\202\343\352\256\334\246\340\357\204\341\253\345\252\365\352\300\335\262\002\331\033\340\220Ia\202\337\016\244wo\257\035H\277\203\004\177\207\013\013\232O\314\013\033\267\213\326ib\332\244\236n\300!\326\366\220\022\265Pz\251\\\262[\345\327\001j\202\346\303\312\026\376\035\033A\310\233\025\213\2427\207\337)l\\]S;\360\257\224+\366\353\374\310\021!\333\271\201\177\303|V\366\330\340\260\350\215\202\241v\224\016\354\\\231a\335(\377\005k\263\273\256\360\302\036\0347\026\275O.\224\337\365:\311w\235\240\2313\362\256@z9#\201\272\023\350N"
+	.ascii	"m\262\305U%E\277\363\204}Z(\2651\214~\277x\334\266\324AA\203"
+	.ascii	"\177\225\364\365\362\352\264\241|T\023\342\253\t\207\337\235"
+	.ascii	"\206$I\353\205@\006\345\034$\257K\r_G\254"
+	.string	"\310\005r\215\264\036\232\201\344\\\343\001\254\246N\022|\035\036\\\275^.\013\303\247\314y\331"
+	.string	"\327\232\307|b&b\340D\261\350ud\340_!}q\370\005r\207\334\027h\036\313\310\031\024`\255\"\256\023\205\257\363\204\337\367E\220^o\220N\033j\036\325\204\200R\344\307\215g\316k\"|gR\252\212\254\365\350q\1774S\0032\272:\237$Z\206<\271>~\177\374\200\251\325\341\275\370\251\tyV\331\332\272Y!\\5s\224Q5\2760i6oVUW\036\323\013H\253\311\233\222,\254\"G\266\244\206\344\310qw\340\243\007\033]y\314\2475\322e\003\311\275\372\335\321S\206I\032\273k5"
+	.string	"\230\035\224kuu\244P\272(\361r\217:5\374\320\252\201UUu\231\030\254yL\257\314\264\"\322\311\232\241\244\311\333\3742}a\220\020\251b\321c*\374\033\343\312\370\245:\325\265\201s\316}\346d2\211\360\217\033QR5~m"
+	.ascii	"Ua\223\305\355\322\260H\204\274\231\2734\356\f\256\262\261\244"
+	.ascii	"U2\313\236\302,z\227\035\3273\347\254\232{\342\337\376iFR\345"
+	.ascii	"\234g\370\326L\365\324\223\266\257\233\350\367\351{4g\004\230"
+	.ascii	"\326|\214\003\306\006\0379C\352\260!\362}\316\234\223Z\307\r"
+	.ascii	"\264\226I\255*\245\230V>&\211\034;Pe\255\243R,\347\0169\231<"
+	.ascii	"\236h\346\016J\261\274\314/\302,;\257Z\307"
+	.string	"\234l\346\0169\231\221!\224I\255\245R\f\271\354\240\024\323Zf1\255\034\224\223H*\030\311L\325!\213i\331e\261\3462H)\326\\*\305\264\260\232K\271G\265\204\003\266\365\246\213(\2239\306\224\025\222*\310\251\\\233Y.\347\036\203\312T\n\344l\325\244\222CV5\332\2233\306S\031\262\371a\352i\253\231\223N%\222f\316H\236\222\362\324\004\307\325\231\203\264\363\310\303*KA\345L\300T\316\307\316\316\234\3631\347\234Ce\265\346\234#H\33155\2253sh*[\035\261@\345l\307\314\240-\225b[M#,S\304\272r\r\353\261\273\262\234\026\025\026;F\311Rkp\327\222\206\232+\265^\251>C\224\363\214\020_TT\"\236C\026\365^o\324E\352(Q$x\001O\032a\034\252KGD \223\212\005\212'\364\220\b\256\030\300\305\n\241\221i\204\243!\007*\013`Q\310E\023\223\t"
+	.string	"\214M$\220\232\204\202C'\036\242\257\370\3531\376\206HM\276!R\323\305\352\013\302\"\352\242\211)\210\022\215M\367H\3159R\213NhP-\346\234\370Cj\032\341C\004&\005Q\027DcQ\210\244\232\3603!@\013`\004#Z"
+	.string	"\177\214F\f\205\"4-\251)\202\226Tc\321\305\t\277"
+	.string	"\320\022#\224\200&\214\351\223F\004\177C'\"\211\340\n\004\212H@\245\017T#\320X\334Q\215\300\243&\024\\$\031\225\200j\bE\024A<\306\240jTO\370\250\304\022~~\303\017\214jQ5\001\251i\200\007\205Du\250\"\341OP\001\004\025X\320\"\347\026\\\020\301\005\021\244\267\340\002#\243\013*0\302\257\300\350\272"
+	.string	"4\301\304\t\016X\250'\036D\002.]\343\257\210\202\272$4b\343\223\0300\n\207(\214\302\241\020%\032K\b\016\235>8\002\252& \001E\b\340\b\250\022\321'\215 \200\250*\035\r\201!\b\031\207+l\361\027TMh!\bT\241\244\0044\321Ahl\241\242\306\342O\330t\302\n\365\304\017E\t'\360\250\301!\320X\034\n\261\361G\002\nt(,aX\f\246\302\246\342-\376L\224@\301c\242\004\n\2354XBx\235T\220(\022U\026B\342\321\207\342O\204 \242j,\002\227\322\034\225\005P\351\004\247\246%\354\364\303\305\337\211\242\223\n\036\365\2476\271HQtR\241\223\303B=*:\251H9@\002\246\020\032[x`\034\242@\002.\371\f\205@\020\224\230\230:\370\371\212?\026\352\t$\340\022.\372L\234\340"
+	.string	"\t\270\224\236\b\n\215\352\020\t\270$d|\222\321\370[\241\036}x\322\210\242\001gjR\211$\214LLD\022<."
+	.ascii	"]\334b\001JJLD4)h\0246\371\212\252\223\022\220E\352\364+.\t\211"
+	.ascii	")\212A\341\022p\350\342\2041\tI\250\264\302\203\013@\342e\"\252"
+	.ascii	"* \001\227r\212?$\341\212!\223\t \343\257\002#\343P\2303d\022"
+	.ascii	"\032\201C\241RP=R\177?C$\241\022PG%\002]8\"\002\223z\324&\027"
+	.ascii	"\306\242\223\212\237bQ%\036\035\001\177\301\022B \343\317\002"
+	.ascii	"\343P\350\224\243\006\205,\324\243\237a1\370\0236\025\177H\300"
+	.ascii	"%\036\343\017\t\230\202I\230\203\004Lalr\"\022U\343P\330s##\023"
+	.ascii	"!P\030\001\004\034\034Q,\002\233\226\230\202$\212D\246\342P-"
+	.ascii	"\222\030\n\201K$\202\304\"\211\021 \3400Q2\034@\266\364\356\013"
+	.ascii	"\236/az[\362,U\316\223)\034\3127w>zZ\336\260\301\273J2\033PS"
+	.ascii	"\236\327F\224"
+	.string	"\330\022\034,\272f\315\275\033j\3362\313'u^v\312L\217\314\266\371\275\353#h\256\350,z\331\334\f\353\301hC\353\264\255;4V\360\355\354.\263\303\262\214\241\"Y_L\"\364\213\314\324\031\026\035\235\205A\024\224\363\326\033\332\217\223\274%A,z\036)\374f\322\267\311\257\225^o\223\233\346*\231\231F\0032\254D\350\204u}\271\263(\232\265l\215\035\230=\374\006;\273X\236\234\311r\321\300\314\254]/J\336l\327E\343Q\246+\356\236\271f\256\334\035s\313\364z\311\\\266\337\262{\345\355\222\271i\227\013\230\3345#s\277\\1ftu;QZ\316\253\037\364\236=\315\2234a.\\\257W\314X\202\203\250\"\301<H\002\235B\n\241\221\231\231I\222t2\n\020\004\303Y\240\210\271\036\022@%EN*\310\204HA\222\024\n\303\030(Rv\211D|\f\205_\315\366\322\231\260He\3065"
+	.string	"x\303>\375\007\361B\0255\217b\007\\z\257\242\371PLr\016\253\b;\030\312\235*\324\033\025\332\252\004\256}\366\006\037\212\370\337\371XA\n0e\315:\261y\356!Lp\267\233\272\031J\224T\252\036\245\033\2653\003\303\034M\024\376\002\n\242\205\243\345\252\025\304\265\300\275\033Uz\267\240\271\265\247N\246\322\345n+\242\275\342\206\036\262&d\271e\031\212\350\003\221\207JbJ\222v\205X\313\225g\340g5\251[\227\201\230Jz\207\026'X\013\b\305\353\001\331;H\260"
+	.string	"\234\277\023 \276\266\250\216><\254\303V\013\f\237\316\356\030\343H?\345\341\346,\345~\340\036\223\371\2761G\201B\255\214\206Ih\311F\310S\024s\274[V\253\256\020\306\257\025g\331\003:\201\365\301\3218\230+\215\334\234\031\b\351\256\031j\004*C\036\203@\205\003]!d\304\032d\243\346\211qxN:\263HA\225Z0\302\374_"
+	.ascii	"\244\363\356\b\334\355\225\373}u\343\307n\201:\305j\241\t\312"
+	.ascii	"\252\253\201\324\217b\002\363\242\257f\350\211\t$\274\207g\306"
+	.ascii	"\342\035\201\350bP\020\030\217\224\303\220my\361\326\361<\374"
+	.ascii	"H\037t\326\2252\303\035\177\006N\326\3761\223\301\312\331\257"
+	.ascii	"o\204\221\257\217o\345\004\276\241\001\306\254)'w;\\+H\275\335"
+	.ascii	"Z#\341\240b\fEGqO\210\274#E\241\301\016\213\031\017PM\002\004"
+	.ascii	"\224\001\366\233c+Q\216\006\230V\235\246?"
+	.ascii	"\234\r7\220q\213\304MN\367h\034\323z\031#\255\200\262\240)[H"
+	.ascii	"0\3128r\330T\353\312\332\275\204\241P:\221\203\215^\033&\324"
+	.ascii	"\253\216\3307qQ\354Q\254(\334>=\2577A \\"
+	.string	"\202\030M\334tak\255\254\022=\343\022&\tT\336\231\025\257\301\004.EQ\377\252s\351\337k\201W\252\005\323\300tg\366\222\372\362T7\300\260\302\370\232\345\336\270+9\336\334R}\241\250n\031\343@2\300i\205\037\031J\200\324O\215\017\300\254\222\001\003\317\254\277\340\337\317\3764\206\306\352\202[\2629\\\264=\230\264\215L\024\020\314\343\264\247\253\315a\376\201\302\034/\201\260\352\013\332=\207k$\364\245\346\006-\2249\t{\376\357\2355c\3300\013\212=Q_M\2054\372_%!\243ZD)>\354F\234(\371\344\307M\370t\026g@\315\203\223\3071JBD,\306Hq\t6\001L>\274\003\345\266\f\273\2550I\266\323\274~K\007\026H2\321\322\314\335\336\030b/\006\244U\236\3337\301+\302`\264\345.\201\350\210\334f\025\316W\374L/\317\317x\352\366M\332\302\344\024\330;\254\317\t\267"
+	.ascii	"v\227X\200r&\303U+!P\223>\273\247n\320\276\323\372x\351\3352"
+	.ascii	"\247"
+	.string	"\247r\3735\n\312_\f\376,\002RO\032O\264\204U\376\260\323\016{m\030\311\266\222@\tgrg)\007\200C *\356Kb\343\207\216#\260\021\3210`R\237\202o\301N\263\2649\240\332\274\0243n\0300\340\t\303\241u\307\243\266\f=G'[\337\342SBL\333i\323\240\333\332Ixp~5\353`OH9\240$\\\266\322\257ku\210\223P\023Q\201\032Z0fQ\r\251]\252\022\213\366v\301\002\302\f\013M\006v\n\256\271\243\003ytj9\023\202\210\370\343l\377\374\307\342\3715\263\376\\<gF\006A\310;rl]CY\300\306\244l.\237\246\037L#\231W\007*\025\277\302\0035\202\276N\300\244\344\343\200P/\314\342\242>lK\270\006\305\364u\260S\023\223\006\364\032n\226M%9\006!B\2571\357/]\022\325\222\243\337\260[\273\207\267\240\016q6\250\255\2457\315\274:\212\215"
+	.string	"\3320j \240|\322TF\312d2\224\271\3512\007\375$\275a\361\322@3\235\036a [m\302,"
+	.string	"\262\215F\212\272\260\332\026\312\326D\317\013\344\354"
+	.ascii	"\003M\036B?\233\262\322\337\373\204\307\344\027\313\\?\306|\312"
+	.ascii	"b\251\032\353Q!\334t\256\344`\271\341x\220\364\240\324`\204M"
+	.ascii	"\233\0205=\334\013\243\324\026\\q\240E}C\017\210/9\204\030\352"
+	.ascii	"\\\2135a^\033!\335\275\212\256\222\224\2143\215\250\376!\275"
+	.ascii	"\375.\364c\271nt\31767\361\001$\016 $L\3271\314(\230\223\260"
+	.ascii	"\237\262hN\\\240\357\356$\031\211\003j\336Z\217\251\267\243N"
+	.ascii	"\017f\254t\347\351\335\266_\363\347\353^\303\222\321\203\372"
+	.ascii	"\223\335\317R\376\253\370u$o\366\322(z\036#'\201>\n\317\341\017"
+	.ascii	"C\030+\005r^^W`[@\272n#g\013m\031\235\017MO\374\3369\271\316"
+	.ascii	"\215\006\177\367L\363\242^*\251X/GW']\0365G\261\027\025\273Q"
+	.ascii	"b|\030\364V"
+	.text
+	.section	.gnu.lto_.symtab.2067aa27b9a38918,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2067aa27b9a38918,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
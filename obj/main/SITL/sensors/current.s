@@ -0,0 +1,842 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\235\006"
+	.string	"d\tB\001"
+	.string	"\026"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\267\235\363\261\017\002\002\003\002\004\004\006\007\250\335\362\322\004\004\002"
+	.string	"\002\005\b\353\266\342\341\005\022\005\003\002\003\002\006\002\007\013\233\346\244\226\006"
+	.string	"\f\242\233\362\205\b\020\002\b\002\t\006\n\002\013"
+	.string	"\002\013\r\016\270\272\250\266\013\017\223\247\316\242\b\030\020\245\225\310\252\007\021\022\340\207\245\357\f\023\244\304\344\337\f\024\025\026\253\327\227\253\013\027\231\366\331l\030\367\343\320\264\b"
+	.string	"\031"
+	.string	")\"\324\334\017\2615\355s\350\203\001+\004\332(\f\317\276\304\241\221\235\f\b\260\312kb:\354\326\316\324"
+	.ascii	"{@\310\340bfg\236\322\330\243\304\007\224\375\313\rvy\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375 d\365\001"
+	.string	"\024\002X"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\001\007\001\001\b"
+	.string	"\001\013\f\004\001\016\017\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.ascii	"6\t\026j .\207\254\n\353\214\241\022cf`\232w\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`E\001\255\t"
+	.string	"B\01722`k\323\030\300\203\205\301\217\241a\b\b\213\017\016\002\037\r\035\251nV\247&\240\213\253u\223\300\224\001\257\002"
+	.ascii	"g\251\037\007\342\020m\374~k[J\231\002o]\360G}\304\235\216\222"
+	.ascii	"\013\r\031\007\305\222\243\343\001\202\340W}\276\212\222\030"
+	.ascii	"\233\b\215\376&\277+5>\235\t\367\304\362\022-2*p\312\355\007"
+	.ascii	"\300,\2322a\210!\263\361\221,\020\360\357v\031\265\253vW\272"
+	.ascii	"\251\344\354n\001\224\210\217\024(\345\206\225H\312\r\335Z1X"
+	.ascii	"R\330]\313s\216h\271\351`<\022M5\035\214\207\372a\351\240\037"
+	.ascii	"\217\277\276u\231\334\326eIs\327\242|EP\211\335\035X/\335\335"
+	.ascii	"\325\214\316\023\362\330#\0373\275\330\335\367\220\363 . `\002"
+	.ascii	"!D\326\016\013\032o[py\025\3720\032\020S\330\332\256\210\222"
+	.ascii	"a\215\357f\322-\333c_\304\352\355\300x\023r\236\360\2700\260"
+	.ascii	"\b \2464\211\300\267\375\310\345\313\025f\237\003\213#;\346:"
+	.ascii	"\025`\321\324\bNbD\007\267?[\327\020\220XV\240\033^\374\341\255"
+	.ascii	"`\277T\321\316\356N\333pj\230B\302hUsn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"\005\005"
+	.string	"R\210\033&\2205I\007\227/\216\330\263\217\325\027\375\252\177\265\037K\241\231\325\335\336\217-\365\002\333Z7{\370\237\250Md\222\001$\257\177\326\366\f=\345\253$\314\3521\275\243\177[k9\207\302\200Y\300e\006\250\222'\356\220\177\334\271X\232\024\300\016\201\b\364\220\212(\032h<\017\003Q\273\033\365\215\352tj\0207h&MF\246\266\227\236\004n\001\024"
+	.string	"\"F\326\025\006\323\235\202v@`\200\t\324)q\231\303L\313\031\016g\020J\r.\207|"
+	.ascii	"\027\361\031\005.\036%\030V\205\2542d\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\007\230\004\b\232\004\013\230"
+	.ascii	"\004\f\232\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\325\004"
+	.string	"\222\006\025\037\220+\303\001\377\277\242\372\377\217\375_\235\276\353\246qR\256\353\272v\376P\331\337\265\277eJ\001b2\232K@}\210\303\324d+\231G\346\220\315\307\320\223\036\001\006K\301\261ml\372@\306v\013\220\343\274\330H\227k\352\242\350\256\342\304V\355\315\022Lz%\036"
+	.string	" \013\311\030\254\241!\300\0216\001@\034\036&@\\\315\013\260\213E+b\366~\300\210\341\002 \\\024\024\236\020\024h\222D\303Zp\322\262e\265\004\n\253\200"
+	.string	">=0j\022\304m\t\376\022\310"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.23cb9526cc3dc2db,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.22.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\257\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\257\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.25.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<8@o\323\001XPvq\300\214\307\230\t\247\032!\031\233\320\004R\\\025gh\275\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201]\3215W\372\264\355\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\237\366\354\230\207\340\236\004\2740A\355.\225\033\367\036=\377!\007\020\215@\217\233\206\335u\024\2152ny\333\007\266\027\354_\001~\351\217U\345\002S\200\262\213\221\232\331\323\\\351\270l?\332\3778\210\367\322\347\002\273_K\312n\250\340\004\353\323\341\t\252O\353\003U,$\317K6\036&\024\302m\211\217LX\273\313\340\213PT\004\200\034\237\376\247\372\234*&\222L(\246\354\020\024\245\206}\315\356\256\345\3475\353\262\3164\306\351\264\254V\017F\271\272qZ\306Q\r\342\241C\261\312Q\216\201\267\210\254\322n\333*\275\302\275f\345g\207\227SHZp?\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.30.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\261\023\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\315\030us\334\007uq"
+	.string	"\005\001\006'\001\004\200\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.32.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.36.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375 \212\r\004"
+	.string	"4\007S"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\356\321\027\007yw\350\347\006yu"
+	.string	"\005\001\006'\001\004\201\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	"\\\005N\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.40.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\235\013"
+	.string	"\026\226N>\020Q\225\016+8\264,\302\313\232\241f\354\340g!\230\001`\316\357\316\004\364\204B\t\267\223\333\320\200>0\222+\025A`\261[Q\004\262\b\342\220\234 \374D\005\317:\332\032\333&R\246\024;"
+	.string	"6"
+	.string	"?"
+	.string	"\371\364%\022\226\213\0024v1\2046\266\025Y l\177b\217\035\343\240i\257\3220R\325\330]L=\334\363\364\370\027\361\310G\372<9\024\354\256\363#e\270\365\266)\266+\366-\004w\213G\345?\035\354:L\273\336?\037\365\324\346\177x4\205.\377=\372\335\343\321\356T\310\177N\023\251\226H?6\bJ\355`\377Z-\331\232\216\232\2764\255\231\016\341\f\033\002&\377E%pA?V\365\352\033\f\t\355z\224K/b\001\312\320\251\252\006D2\256\251\037\335\260\263\2534\310n\b\201O\342%\"d4\232\307\343\365\300\213\025!P^\206\216$\200\316,\234\215\306q\235\f\353\270\255\333h\035\266\311`$`\031\327a\226\001\336&h\034\306\3316\016\233\200\336\257\325\322\002\025-OA\026\220Q\177z\212\013\344\304Q0hp\2718x\020 \275:\007\030#\300\004a\026"
+	.ascii	"3\241\005)\360+z\027\310\004\f\004\311\240{i\226\005\3420\225"
+	.ascii	"\211\244\222q\003W\246\233\313\232R\255\0050B\\\345\343\232\310"
+	.ascii	"6\004\3752\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.41.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\345\b"
+	.string	"\266\220>90%\2511\200\003\250\311W2\263\204\241\020e\365^?.k+Z\214\006@\024F\332\245\344\017\331wr\255\275\3050\307 \r\252<\276\251\353\261\020S\350\226\261&\367\226)\005*"
+	.string	","
+	.string	"0"
+	.string	"\004\035\313\206m\216[\"\267kd\303\005\373?\263\020\207\216a\355\025{R\252\223c"
+	.string	"\304\377\306\224j\345fn\233\320\366\241-N\326\376\277\031\253\325\266\016\032\005\233\237#\026\340/)S\262\265ul\215\342\224\320*\246z\376\017\230\230\377\re\020\260DpA\307Rs\250L\343\363\213\313cRs\262\340\226d\027\223\301\315\177\207\232\305-\0305\211e3J\321)\313\272\324\261\334V30"
+	.string	"\250\030k[\247\230\201\264\001`\004\007\202(F\023\340\007\262\030h\350\003\2128\317#\205\346\347u\237\210\373\246\250\002t1C\3367?\007\355F\2347\301\256\363\346\326\272\265g\254Jx\274\002\f"
+	.string	"2\241\343/0.\f\270\003\214\333\224$3\225\200"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.42.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`M\002\025\021"
+	.string	"&\337lE\360\322$\0352\343\363\374\253]QC\330{g&O\266\217\206\367g:\374\263\327\205\306b\276:p\033\217\215\n\302[\024l<\2260\321\3348\255"
+	.string	"\037\213\n\364\214U\321y\207\031\"77k\203\265\266\367\2262\245W"
+	.string	"R"
+	.string	"_"
+	.string	"\033\033\261\b\352\320\261\207\304C\324\r\304C\267\354\034\217\355\354\203X\324\004\355\330\335LA\274\365\b\237f\313?\225\354\356}\016\240s\305<\342\034n\320\220\357\346\372\024\344\020\335\bp\321\274\220\243\017J\367yrp\315d\236Jv\327\331\271l\356\323m\257\330^`\347+$\376\211\377d\360y\016\315z\311w\207\376K<\274\202\330 \301zd\262\311\216\305\244\276\354\277\335]\253\216\375\236?\300K\307\227\206\232~\231\326Lg\246O E\342H\204i\267C\223\2175\2022D\244l?\355\227\270\211\326{`^`Wg\b\306\006!\272\034#\325\227\023\374$>\255"
+	.string	"\204\203&{\330\237q\032'>\217%\240\344;\224x\370\024\376,\301<\250\332\023\036\203\302_l\r\222\234r\027\253\221\244\303\026\252\003l\224`\251\266\366\025\271d\341*R\244\246F \361\270\332*G\021ta\005d\207\007&\036jQ\247\303,\007\332P\273\033\234\346\242\261@\257T.-\032\307\275\2542\026\267\261Z4V\326\242\222\302\222\2558V\246B\340\r\203\306e.\333\306e\251\330\376\255\352\330\001\314HFgbT\275\210(B}\371B\177z"
+	.string	"\207\351A\265\375\032\037z@\302\300\267\361\033\020\"\230\230\304\303\274\205:\035POE5?d\262\351\0170 \260\002\021\241\264\003C\241\213\213\341\021\352\336\315\314\226+\2263\003\033"
+	.ascii	"\303.\215\223\214\347\267\240\024\336*\342K\b&\352\201%M\256"
+	.ascii	"\024\213\355\034$$\203\207\341\254\207?0\017\n\300@\345\305\031"
+	.ascii	"\276!\026[\302\204\375\244\3707\302\267B\226\r\204Q\222\256-"
+	.ascii	"\330S\304\220\337\335`\326\035V\263\030m\\Mqg\0213\246\024\013"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.44.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\325\006"
+	.string	"r\r02`M\323\001\300.\205\203\254\373"
+	.string	"3\004\250\3114\340\341\n\004\347\n%\326\261\204\217\035\320\354E\360\327N\tR\206\004K\262"
+	.string	"[\242\363\216\272{H\231R\216 \313$Ax\211^\005\251j\222\2527)$,\274\bV\017*0\305 \301g\241(\370\036m\257\032\204\222\r\243\020vr\340\376p*\277\3065\213 \333\305<\372\033\347\270\370\027wn\260\362\361\316\267\234;\333\341!\037\235\035 [\204b\266\206\245V\330\007X\325\330\372\220\204@&\273\023)(\2739\017\f\333\177|\331#\327\262\375FDbs\262\273O-~=/\377\031\027\210\031\354\031p\260\273\316\230\241\270\365\266\rlWlg\001\b"
+	.ascii	"3\001g8\203\004\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.45.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\036\004\335\033"
+	.string	"\3662\262J\240\230Q:\301\352\365R`\342F\222'\001\206\257\200_\214=\204\025p\002z\367\035\316'C?@N\336\336\370_'LQ;Pf)\345\207\261\032-\360\r\270\366\205A\377\222f\274\220\f\305\245\021\367\352\231m\204\020\"wJ\001\227"
+	.string	"\216"
+	.string	"\243"
+	.string	"<<\256\024\364$\343$\271\\\264\203l\227\213\324\305F\272\2050u\027\003*G\207\320\201\005\\\\\221\260\324n\360"
+	.ascii	"w\240\020\354V\240r@\325\n\\\340\b\254\213>\265\237\343G\270"
+	.ascii	"\377nn\325\n\203\210\217Z\353\002+`]4\360\001\343\305\3602\343"
+	.ascii	"E\343\354)\007\372\352\203XJ\004\257\324Zc;\343\270\217b\270"
+	.ascii	"\024\347\223\023Z\274\336\320GW\217\305\305\025\017I0\355\350"
+	.ascii	"\276\364\316\320@\255\365\301S\023=\035\245\344\204Z\253)\257"
+	.ascii	"\227\342&o\273\307\266i\207\017\002b\270\205G\365\245+6\225\260"
+	.ascii	"\362\207;\365\260j\335A\360\233\336#\204O\343\242}Jz^9^\374:"
+	.ascii	"Pbu\343\227\243W6PG\267\310~XW\206mH\352\032\222\032FR\323\374"
+	.ascii	"\367\023X\352\031\222Z\346Kw\314\221~\001\327\361\303\034\370"
+	.ascii	"\007X\352\327\221n\327R\267\226\232\265\324\344R\217#\265\270"
+	.ascii	"\324"
+	.string	"\341R\357RS\221\3727//\222\304\242j=q\245\245J\211@j|\351\366\223|\246%?\261\206P\260x\314\340M\325Z\023\\tN\254$W\222\243\2433^\224\331+\235\036\251\360\021\035\375\242n,$\255\r\222T5n\221\317\364\326T\224U\230\340\016W\300\272\326\204\3152rCP\344<\252\231\245\313Z\361\310ID>!wfo\230\2348b\226\224r\032\211;.\271\205\303\241:\f\0217\302\216`\325/\027n\314^\312I\324\340~\032w\303\265\t\2368\\\353\332\335[\331\030r\032\351\350\225\270E\017W\206\220\303\354\213\026Yh\255uh/4\006XX\013+;\242\354(\026\323\265=<\310\255\300\223Z+\004\377\307\201\310f4\332\370\265\322\234\311,\2304\033\017O\206\027\240\322\304\251\225f\211a\347\207BPy\201&\3024\313\032\b\223f\207\346S\223\211&\005\232)\333\001\322`\332d\""
+	.ascii	"x\306\300\374\241\325j#f1[\255\264\375"
+	.string	"\320l\261\237\036\231OlV\263\305\030\334\270\004\242\325bfY\326b.\300\334\303\007_\201\212T\325Tnu\266\301y\224\333\313\007%G\307f7\370\242N$5\353\304N/_\023Z\205G\005[\231\255Y\261\351$\3229\375G\205I\252Z\302\325\225\322\256\326\334\001\232\205\355O\243\327\322l\315\3239E`[\373Z\362\310i\244S\262\206/qQ\250Q(E\225Q\b\ndF\202\314\322\302\214\001p\002\2212\253\016\020pFCI\306b[\326Z\211=M*\210\345M\260\202\307\020\206\021 q\371\263y\031Y\223\377\006uu\373P\267*>\250\277\035\351\254f\221(\270\3075\253\310\311I\255\032\205i\215\263\315\r\305\231\247\203\241\\\207\bT\003/cj2C\026\372\220G#\346LS\201Ax\304(I6\f\3706\002\220\205A\2246\245_x)\036\023q;:\314\215+@\224\362\222\345\332\001\312/"
+	.ascii	"\331\2248\305O\304V\256\342]\325+\264\251\n\201NP,\272cM\031"
+	.ascii	"'>\267\235\360\007"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.46.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\005\013"
+	.string	"F\024JA0\307(\035\220\313\313!\3373n\316\237\344\357\325^\374\354\352:\004\254\220\201r\306\215\251X\206B\204h\r{\036\342\177\320\312\206g\b*\002N\r\300h#z\207\201\004\311\005\360\345\223\310m\367N)4"
+	.string	"6"
+	.string	":"
+	.string	"\226\320N=\376!;\325\356\220\235\032\264\035|L\355\001\234\220\260 \354n\235)\007/A\377/W\bO\245\313\004\214\335\265\fO&\367\274\355\b\333\024\366E\002+\321$c\366X\222\023\305\276fw\327\023e_\3745RZJ\351k\013+\f,\f\354\226\304\"\354\213\"P\331\330\276\264\337r\027\360\"\351\r\273(\005\007v\307\211\003<\025v*@N\006Wk%v<\200\306j\301\247\375\371\f\013\244\343\244T\244\354t&\b\037\370\3432\237\266\273\025>\314cD\276\352\324!#\371\360\324\037e\247\237\034W\201\036\027\342>\324['\004\342<O\264\325\317\353>\020\367U\220g\343S7\357\253\035\bw\036\234WC]\347\325\315\270\327\354D9\203\345e\232#\226\323\336\336\222\r\270\023\370.`\346x\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.47.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\252\003U\030"
+	.string	"F\352\226H\240\224Nc\034\346\203\200p\302\354\\\374\0263\347B|+\212\260Anh/\216|\022}\037\313R\203a\2652\t\200cX\363I\202\342\036\346{\350\354<?\222\314\351i$\2740\357\316|\0251'!\262\367\226[\312\224\002~"
+	.string	"y"
+	.string	"\206"
+	.string	"\326\304\363\324\376\322\231~o\312\361\355\336 -\252{\211'vp\336\"\270IyK~@y\353\237}vb\321\275q\253'j\355\336\233\253-\376\373i\226\226\254\364\347\027oB\243\030f\343G\347\347\245NU\214-)\231\007\n_\366\214\2406A\020\220\360\344\301L\b\215<\264\222\f\206['\002\374\210 M\276\204\312^<%\361\263C\2519\341\336k\032\374\001\272o\267-\264\375\300\256V\001M@z\274\213\340\320\253V\"\222\347\224\257\177\222\341$$\214\214\207\026\261\211;\264\022\331\257\307\343\361\350:d[j\234IMRR\337J\352\263\2446-\265\375\323_\337\364\237\300\221\320\326\202\254"
+	.string	"\271\267\304\261\355zY\253\027\266\357\327\270\321\346P^\3206\\ac\343\242.us(\0270\2121\\\272\367\342n\355\033\033wKq\266)\361N\277?\341\274\344\336\241\266\334\371\017{\017\013+,,\345-\275\261\312\333\007\323l5\271z\216DHa\304\207T\360\226\222\244r(\236\307\273Z|#_p\241\017\272\224\267$\325>\231)\to/\337\302\360\035<\tFg\270\016\r'c\267Z\267*"
+	.ascii	"\250L\351\204y\0265\213y\216\253\263\342`\210\2615Y\367*\036"
+	.ascii	"\200\"\252\020;\337\b\247\274\255\\\301\264\033\335\3418x\347"
+	.ascii	"\2757\305\277\361)\017\276\321\255ez\364\301^ykV2\024IC\246\276"
+	.ascii	"]\315N\306n\340Q\353Pjfv>\037\b]\216\306\327\243\231\331\321"
+	.ascii	"\344fx129\235\217&\207b\300\275\017;_\256\246\327\363\345pD\340"
+	.ascii	"\311[\274\n\022\032\033\032\260\356\220\367\336{\276\034\315"
+	.ascii	"Ve%\351~f\"a\255\2515\370\245\f\363\262#\237\242\341\222\032"
+	.ascii	"\220\036\337\265\3034e\036\240\265\332*\024\350\203&\253\216"
+	.ascii	"\323\322\204\256\312Jd\252\342K~\314\240UC\276XX\034\312\307"
+	.ascii	"\304p\365D\216\272z\216\330z\260\373\250\220\002\301\001O\250"
+	.ascii	"q,\344\f\223\346F&hJ\n\222t\220\002\221\301b\007\021`\27163\263"
+	.ascii	"\205\225cb\302==\266\2742L\327\340$\274\\\352\216\224yAs\310"
+	.ascii	"\320\266\320\033\344Pz\013I\317\221x\202F\377n\275l\356\221\350"
+	.ascii	"\246P\336\300\374v\215\340p*6\021%\372_\211\006\253h}IKN1QVz"
+	.ascii	"\253\374\212\004\265\364\356\240G\246\026;P0\322\343\250E\365"
+	.ascii	"\302s;\027\360N\030\316\n\005in\241\036\005\226\251\361W0\362"
+	.ascii	"\260\261\004\202\220.\316\307o\227H\200\035\177\201Rj\362j\240"
+	.ascii	"Lr\253\342\364\374^\252\216\206I\314\250\001"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.58.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\360\001u\020"
+	.string	"F]gG"
+	.string	"\261&\035 \023\354\271\"\\\261f\353>\030\220\001\277\226c\224\336/\370P\310\375\310o?\375<f7\017[\221\276\206\206m\300\230\246&\233v\302\034\252j\373\250(Cq\304-\360\244X\326\005\204"
+	.string	"\251\265M\344N)O"
+	.string	"R"
+	.string	"Q"
+	.string	"\001vW\200lv\307\004\237F\240}z|H\350S;H\350\323\376\n\333\251\024\213\366\215\217-\373\031\235\017.\035\273\313}\352\211\213W\231\211\376\353!\257\016\327\307\016R\023c\203\006\204\210K\001\317D\017v\327\332\210{\336\266\003\333\013l\271!\341\213\307N\207\371"
+	.string	"k\245\262\273'\3733\247\2617\227\034f\002,\025+\026\273\273\225\250\337\"\345\277\274\331\276L\352.\023\031aU$D>\2551w!\336eb\217]\0239\n\264O\003\331f)?\246\016\203\0320n\210\024Ki\377\345-\3610\250\007,T\350SwNr<f\f\217\341i\273\313\300\2779N\006\237\365i\322'\177\362\205>\257\217]\372\250\364\254^Z*\031$\225\305\232=[]\261E\322\372\361\227\"\351k\"(\037\253]\224 \240-1oP\\\346\267\357\303\270Mx\2303\0349\001\027<\tv\246\2164=\0321\225:\020<\215\270\020\374\302R\027r%\217\204\304\215\300\220\033)\340OC\007r\246\357\003\271\355\257CH\361\263\343G\245\036\254\252,\266U\302y\244\017\205\357x\rb\256p\035\013\\\317g\r\325\017\234\032\227\026\311iLp\341\361\3503<"
+	.string	"-28t~1 \220\002\021\263\343\006"
+	.ascii	"\nPs\017\022\201tC\3723\246`x\234\330`\255\301\341T\201\006\314"
+	.ascii	"^nj\243t\216\002\202gkN\246\300\006\017C\270\033B\210<0\302\037"
+	.ascii	"\203\214\212\022\b+aJ'nS\320v\327\275,A\243T\366d\212\275\332"
+	.ascii	"\377H\372c\350f(\302\220\307\313\235\244\325nc\312\032\003\200"
+	.ascii	"\366F2\033dZz\302\033\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\025\001U\b"
+	.string	"d\013\021\002"
+	.string	""
+	.string	""
+	.string	"\002:\177\036\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005+\022\201\204\001\031\177\037\272\200\202(\177 \005'\020\0053!\032\016\200\003\002)\177\"*\177#4$5%\002,\177&-\177'!(\002.\177)/\177*\377\377\377\377\003$+\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\", -setdata"
+	.string	""
+	.string	"\005\036.\033/\0340\0301\0272\0263\0012\1774\037"
+	.string	""
+	.string	"\200\200\200\0011\17750\1776\003\003\033$\003\003\032\304\001\003\003\031\344\001\003\013\033$\003\017"
+	.string	"\323\243\362\362"
+	.string	"\001\342\007"
+	.ascii	"% \260\002)2v\030\332\032\272\032$o\030X\017? l\271\0242\t\343"
+	.ascii	"\260\021\2010\2603\3462\006\316\370\031\357JH\354\024\270qlY"
+	.ascii	"\013\341\334O\034p\376(H\200\026\217H\201\207.\374\033\274\266"
+	.ascii	"\r\346m\360\302\2633\300\033\276k\350FM0\236"
+	.text
+	.section	.gnu.lto_.refs.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375 \2335\003"
+	.string	"\242\b\026\032\200\265I\00730\00330\0033P\304\343\343\267\265\247\337\324\255I\333D\246\024\016fXa\004\263,M\031\202\3268\364\224V\351\312\344\b&\300{x\227UY\223\027%5\357\311\200\341\017\331\204\026\241-\016%JMi\034W{]\314\342\314\021z\315\030k}\235\032\020\003"
+	.ascii	"\237\020\254\317@0\033\3142"
+	.text
+	.section	.gnu.lto_.decls.23cb9526cc3dc2db,"e",@progbits
+	.string	"(\265/\375`\305'\r\257"
+	.ascii	"Z\024\335<Z0JIH\351:\031\006\2039l`\277U\2602Bq\350q>=\235\233"
+	.ascii	"\250\031\301\211\210\bFu\005i\267\306\220\260\364\345w\303\343"
+	.ascii	"y\210\203-\334\\|,0q\234\303;}\327\354P\025/\332\n\031\265\212"
+	.ascii	"4M\223\024\272\312f\013\332\342\262K(\245\036\336;\370\266\355"
+	.ascii	"-e\n*\003\304\003\341\003\033\264\017~\3434f\036o]\203\\#\273"
+	.ascii	"\2727\351S\342D\253\361\244\211\005\266\221\334AG\200\334\324"
+	.ascii	"\371\234\323y;\347\274=s\336n9o\253,\265\f\036\363\t\215\026"
+	.ascii	"#KO\035\203\231\336\004q\322\366\226x6R\027Y\3310n\255 \223\274"
+	.ascii	"J\314q\366EB\327CB\367\272\346|\025s\276\206\235\027\3005\307"
+	.ascii	"\300s\316p,\207\247\310p\366^\"s\005=\346\nr]\222\020\225:\373"
+	.ascii	"\312u\276:9;\250:\316W\031\347\267\332\260\033V\216\3407\347"
+	.ascii	"5\334|\216\230\274\311>\002\227\245\036\235\347\021\272\032\027"
+	.ascii	"\307#to\266S\003w\3205\230\227\363\235\345\274\232\224\363M\356"
+	.ascii	"\240{O\235\032\336\270\203\216\3110\032+Cp\231c\260\301\353\221"
+	.ascii	"\225\213uo\262\2077\007\312\0349m\337P\3479\204\216\3438\204"
+	.ascii	"\356]<E\234\305\204\350I\346`\232j\373s\230\263\f\\^\222[m\315"
+	.ascii	"|\316\252\035\307\037"
+	.string	"m\3473\250\342\205\205\205\214\251\220\261\013\254\325\323\2717\352\253\212\277p\031+\231\214\275\224\360\261>\232TK\247=\2339\317^\316\237\273T%\032\310\344\006\035/F\272\302`\211q\025\326\252Y\306\023\213T\222&\213\361\025\366\252YF\035\033RH\270\360\030+Y\214\277\316`\034V,\341\223C\"\226%\245\263gr\007\035\017c\235[|zKne\312\266g\344y\246\222\345_\314\334\342*'b\232\367\336.\326\302J\346\342\255\263\024\306\272M\336\273u\357}\006\377\317\231\213\261\260\026\210\245{\243zx\260\242\225t\366v\357-\341Sb\007)\007\023\246\316~\350<\t\347\035p>\001''9\213\225\357\302\313\363\024\246r\235b\362.\357\275=\\\304\313Q\221\266\3779\317V.\001\361\336\r\276s\252p\357\275;~\027\335\373\024\301\035t\2269\350\236\344\016\272\2239\350~\021\374=\366\363\213.\341\363"
+	.string	"\374\275\345b\034\316\305\n\370\030\177\220d\301\337\005\270\207\277\356\300u\340e~d\371\331\204\317?\374\315\346g\003\374\\"
+	.string	"\266\237\333~\216@\213\350"
+	.ascii	"\374\034\247\001\360\363Y\207\370\233\247A4\005\024\370\017\342"
+	.ascii	">\177\217I\352\t\316\373k\n?s\375\254\345g\257\377\365\257?~"
+	.ascii	"n\341\347\253\237\237\374\334\344\347%?;\3719J\177\370\031\371"
+	.ascii	"\263\325\317U\355\363\277\347\257T\377\277\374'\373\017\246\313"
+	.ascii	"~f\373\333\303\337\022\374\315\341o\b\376\356\371\273\367\177"
+	.ascii	"\367\327\263\277y?\313\371\331\355g5?\233\371\231\3713\230\237"
+	.ascii	"\275\374\374\365\363\224\237\245\374\334\342\347\245\237\223"
+	.ascii	"~\206\361\263\007~\356\300\317\034\370Y\205\237Q\370Y\370s\321"
+	.ascii	"\317D?\377\376\217\360\177\313\317\032\3709\003?c\340g\r~\336"
+	.ascii	"\340\347\022~\276\300\177\263\237G\370\271\002\377\227?\263\370"
+	.ascii	"y\002?K\340g\020\376\307\3603\003\376\213\360\363\002~F\300\317"
+	.ascii	"\034\374|\342\347\003\374l\301\3770\377\317\376s\371\317\342"
+	.ascii	"?\002\376\227\375\357\305\305\305\305\375V\350\3371\371A\364"
+	.ascii	"\bLX\030\323\366n\346\3100Q\242C<\327\326\232m\203\013\307\354"
+	.ascii	"j\247\004I\f3^x\263\235\315SL\237\021\323ht\367r\022\331d\274"
+	.ascii	"G#\211\277\325\336h:\215\231\326\326g\035\346\315<\263\315\234"
+	.ascii	"G\367~\340\221<\036I\354D)S\005N\332\333\314\325\360\334\213"
+	.ascii	"u\357\005\241\343z#r\326\266\313\264\322N-\325$\265}[\243\375"
+	.ascii	"\327\331\221J\"1\321\232\f\325\0312R\314t\342\332\234ti\253\354"
+	.ascii	"1\354E\367e\312\0172b\316\237X\316\277\177\335%\032\357\2756"
+	.ascii	"r\311kD\3429\347\230I\374<\256,\200\377\366^\022\037\270\227"
+	.ascii	"\210\345\352\315\271\344\213\310C\304\3151\357-F\0355 \312\251"
+	.ascii	"\030\365\244\264\214\272GE%G\033\2147\352Hiy\357\206[,\036\255"
+	.ascii	"@\336\rJ\313\353ta\220q\342\233\214:\272E\344\335p\213\227(B"
+	.ascii	"\251\030\345\244\264$:mPZF9\335e\324\325p\213D\343R\361\0327"
+	.ascii	"\334e\024\233\273D:iPZ\"\235\224\226QD\330kI\212\212\215+WAh"
+	.ascii	"0\020\245\342\255\301\004E4j`*%\221W\355^\336\212q\215\002\270"
+	.string	"\027\niT#>1\030\022\263\006R\027\021\311\037\230\220\244\220\267\310Tb\202\274\227\t\322\213\313\244\301Q\222y\2130\363h\n\352\322\210q\357\004L\367\036\361e\336{\217\356\275;#T\362\336\035\032\224\252\230\230\356=\3720]\250\243\260\030\367\366V\0320'\245\245\024\362'\354\312\262\352&%\217\270\352\252E\031\317\345Q\326\245\341\346\254r\272\321\246\027\007\255\tN\333\344\016\230\217,8\276\370T4s\212'\214\323\213\215\243\343\351J[\227\263\262\273\364\227\3168\201 k\3153\256\005\2611\263\260\263\262\303z,\247t\211KD\214\035M0\034/J\266\266b]<&\0275D\255\363\273*\260\2571ni\260\264m\257\2261\003NJ\333\357p,\227\335U\225.1\352\202'Up\314\336\256\321h\202\253\002g\250<\245\301\362/\262)U[\255\365/$\2723I7,-\235\205\225\275\325W\266t\240"
+	.ascii	"\271\212\241\263\327u\235\327%\317\353\242\234\327!\311j+\271"
+	.ascii	"4TE\226\264\275\216GV\322\313&\265,9S\205\n\217\355I\232\220"
+	.ascii	"\266S\032\213\225M\245\245t\362\336e\023\n\267\325$\330\231\244"
+	.ascii	"\214B\245\243t\223\036Q\303-\"A\251*Qb\027\327\002\f4\235}n\316"
+	.ascii	"\371\334\333\371\034\233\253\021gq\214\013\353\211\023\024\216"
+	.ascii	"G*m\337N\2320\322C\357\206\326\325\216\266\335B/a\345\207f\322"
+	.ascii	"\206\b\222S\333\347\320\234\036\270\227?\3508.\216?\350\272\352"
+	.ascii	"\347m\305Ag<&\357\326\007G\246\242\264\255M\365a\367$\354\207"
+	.ascii	"\220V\222+*y\212\242"
+	.string	"\321Gf\030\351$\215\204\225}\244\211\234\317t\221\256\260>\262\223b\222\201\243\273\204\\&\247\345\233\023;\377\036\322>,\232/Wc\315&n\353\345\356E\236U\3754\223\230\346\217R\3170\252a6\334\306L\"\r\300\202k\232QC\036m\001[#{c\216\321p\221\320fT\255\275\300i?\177#;\252w\364\217\316\321R\315\243q\364\261u4\220\206\352\251\356\321A\232\205\026\322O\254l\037\355\364\266\3217\232\306\007Q\324\232\355\243\211\235\324+&\257SoKr\215\354\315\r\016\247\365\352\275>\344T\241\3414\234v\304F\003+c\\_\206\273kdW0\304a8\035\2251\003c2\214\215\323zG\311\333\264\243j\266\217\256\301m=b\362\032w\\\3145\262\267{\223|\346\307 \367\312R;\"v\276\371fu\363\221bt\303\"\2613\004\312L\215\266W\267\367\\\315\341b\241meS\337\360\334"
+	.ascii	"\362\366\365\306M\265JR\343\211\253M\212\032\244\332\246\257"
+	.ascii	"4[\21551|q\023/(Z\226j\277ZU\243\243d\311\316\232am\314\234\260"
+	.ascii	"\361\254Q\302\024\323ki\222;G\245-\365\205\277\256\361 \357-"
+	.ascii	"\346\336,1\275\255\3254Rp\b"
+	.string	"A\242\023&\247\t\013my\312\317+\032;\345\326\324B\031\256f\224\325L-\343s-\223\021\216\331Uz\346\251\007u\3262\335\3231\302\227\254\322\252a<"
+	.ascii	"\227\305\252\355+\032\247\231por\003\030"
+	.string	"\343\217\266\030\374\274\222\321]q\001\002C\030\256\314\312\254a|\356\021\233\017\226 \315Lp\222*7\342\346\234\3155L\022\213\247\251\351\b\322\314,\310\026O\315\361\022!\363\345K%\003\313\320\364\005W\326\023\343\"\206\3152\354\325KX\225rB\214\fB\320\2664wE\244\030\263m\355R]\250\\\352X\025\343MUy\315R\245~\2218\022q\210\200\322\344\265.pfm\275\222\313+L\330\264=o\306\331U\271XY\267T-Pv\324-R:d\340x\323@\331\0130\350\354y\332\234\365J\335\322\031\243\201\006\205%\003\0212I\232\264m\255\035\226\261\230eY\341\314\306\226\224\037X\003\002\245m\265r\306\340A\033\241\223\306\n\333\221\266\257V\376\232\305h\232\006\217\343\232\266=\246\237\327dSm\225\225aM\231\322`Z\303-JQ\001S\003\025\343\t\n\327\031\257P\254\2543\252\224\037\244K\214B"
+	.ascii	")`P&t\266\254\3424\265\215\222\354r\303\206\247\351<c\375\250"
+	.ascii	"@\326\242*\022+M\220:\304\211\030\251\212\354\035m\270w\nM\325"
+	.ascii	"\222\n\245^U'\225I}\302\312\332\244\022y\355Q}\334\2476\251S"
+	.ascii	"j\315&\265H\265b\346Q\303-z\255i\226\310 #\212\331\243g\177\234"
+	.ascii	"\r\004\222\322\003\250\260U\325\026XY\255\356S\255\252\221J\305"
+	.ascii	"\314c\362\332\330\3312\246\212\333\333\207\022\2746e\324x\350"
+	.ascii	"\254\222^Wr\210\233\2665\311\356\370T\006c\315\021VV$g\333U\230"
+	.ascii	"\234\263y1\"\365\302\371\0353\347w\276\234U\310\231\326\354\021"
+	.ascii	"f\354\374\316\327\371\035-\347w\254\234\337\231\002\244\"\227"
+	.ascii	"`\336\204\251HNk\2643\032HP\316&\301\034t\365XwT\036\277NO\024"
+	.ascii	"0!\\V\347\253\216\021\214\210\341jkk\216\327\247_\247\313\250"
+	.ascii	"\252\230\220\234\2578*\013\277NOMI\226\235\251\363\365F\216+"
+	.ascii	"\356\215\216\266\325\306\031c'\307\210\f=\274~\360h\373j\343"
+	.ascii	"\257L\274V\235L\270\267\310\201888m"
+	.string	"kS5\276:\325\032\267:i\200\274\227X\235zb\270\227\330\303\\\001s\0056\212\024\225\026\235\375\216\323\311c\016:\006\373y\245\261\023\306\205f\025\266\272T\227|\334\\8fo\365\370e\354r\3765IY\223\032\f\t\347\227\362\254\347\216\301\222\263\244\336z+\214\363\306\251\202\301\006TV-\276\302\320\251\361%\355\266\255H\254%\226\346\211\222\266\225\310pVfk\324\264\255G\fw.o$Yf8\316\231\323\315308fo'\0234U\334\332>\303\215!\206v\362\\\361N]U\361\254\242h!\305\211\303\312\216\303il\3456eHr\2422\276\335Kf\302\302\2551S\304\205\363\355\255\331\322\272\252\314\322\262\306\254\274y\323n>]\252\340\230\275\361\310\024\263\254u\333\333\215\265\334#\022\326\322\241a\002$\351H\233\263\262\3334\331\003\220\367\206\b+\346\321\304\207\030ODr\254Y\323\315\363\262"
+	.string	"\203cv\305\263\024h\352KY\240\251O\250\310h\002\340O\230\016Q\240BFCA\300\037\n\341\320\b\205\004CCF@`\020\270K\201t)\004\205/\322 p\327\302\207\016\331\024\035\022\241D:\340\317\347"
+	.string	"\336\020%\362\2150\024\202@\017\t\031Z\205\020\232\n\203EEF\303\t(\b1\004\272/\365\t\245\350\260\247bE\212\241\"\"\224\002\026\254P\024T\021\200\264\b\205\213\"\016A@\243\020Rt\270\003l\321in\b\344\242\210'\005\002\272(\312\001]\024U\224\003\277\241\035\016Q\241\220\220o\267BQ0\310\n\323\242*\204\002]\374\206|;!thd\203\320\341\356B \027E'xB\337\213 \273\2020\035\376\\\240%\f\300C\005\271\2778\201Bh\350gt\302\007T((\202\013\243\023P!\035\025+Rpx1D\205-\320\022\210XD\220\376\200\020P\261\"\005\207\024\035n\270\340D*\364\025\235\020\362\241%xx\320O\210\002Q\027\3475\340\340"
+	.string	"\034t\240\302\356\035xp\201\007\027\350\336\201\007??\036p\360s\236\203\237\232\246>i\004\351_\234h\201\002\030$\"\n\006Q\260\001\036\002\375\244E;\303\234\020M\207~!\244>\020~AB>\036\n$\004\001\r,@\240C\276\240a.E\207-Z\004u*V\244\220\340/N\f\201\\\374Z"
+	.string	"\203*\370\200?\"\bRH\201\350\020\025\026\245A\340\207 \024\206x(\020\004(P\004h\220\320(\310\002\202\025\322_\220\257\310wBO\352\003\301\002\350\320\2107\024\f\202"
+	.string	"\224\033\246Bt(\205\nth\024\001\020\r\022\242$\024\021\031\r\201\301 \020\303\337\020\025\242\351p\205\027\275\024\210\203\237\023u\341K\207\202(\f\r\241ACCF-8\244@\243\240\212\241!T\305\nB4M} \240A\302`\213\016(\360\204\202?!JB\213\"\t\244\276\023~<\027\300\037P\350\273\200\004)P\007)\360g\264\033\362\005\375\322\237P\2050\030\0020\370K}B\243\025\251\357\004\024<\244C\240^:DS\237\004zC\240!\237Q*\374Y`\202\364/B<X\204\nQ\244\301\240\020\305N\b:C\240\024\"\b\321\024\025\201\202\024D'\232\372R\026\300\024|\302\025/|D\274\024\b\203\fR\340o\367\237\037\025\"*0\202\003\316\240\023)\020\025\n\215\202P\f\205\301!\020\035\242"
+	.string	"\376|D(\202\204C\024'@\240.|B\264\210\310w\036As\324\325Tf\243\036e\213\3605\336\033f\211\334\026\021\241G\214\035m\355\224\035\362\004\006\325q\210\025\022'\016\f\343\026^\016\265%\025\033\204\267\224\244\256\240\264\265R\254\245kJ\266i\366\3548\177\013\244\273v\250\270\034\333 \335,\0317r\322~T9\273%\304\2538\037d<)q\214\304\350\321c5nN\217\033P\226\251\307\254\022W\204G\203y\272\362\004\305\356\250`zW^X\262\254\216\372\365E\tN\021{\264O\367\314\025\263,\366\351\267,\330\034\325\311\004\2573-!mIp\007]\016\307\r '\253\264\266\2677\234L\200K2CL[\353\364sk\003"
+	.ascii	"[\272\204\265\335Y\243m\332\001$\210\f\333\264\324\361\"b\244"
+	.ascii	"\331\026\356\366\b\3162U3<\367\310\312m\332}}\211\223\343\355"
+	.ascii	"*\035I\354d\315\310\032c\225n\231ni`\260\301\331\256\234\230"
+	.ascii	"!\266\2653ne\034\317\304\232KV\306\222 \313'r\316\037\300J\016"
+	.ascii	"'\247\2666\351lg\302F\203M[\033\343]\216g\336\206X\030\017#\205"
+	.ascii	"\206\324\326\022-\022+_f\213\357\211%e){s\376\003\3742]\215\273"
+	.ascii	"\275b>\202D\2750G\213\031\036Ug\316\367\230ooU\216\317y\247\240"
+	.ascii	"\2215ycS\310\300\020\347U\316\227\005\242\246cH\333\n\303\277"
+	.ascii	"\002\203#\250\222\3318H\342\024C\246HdD\222$I\007\002\n\020\204"
+	.ascii	"\203a\246\307)>\022\300\024=\314)\307\230\241\021\021\021\221"
+	.ascii	"\024$%5*\303\030>c\3404\315\034\243\243\326\377c\246GQ\323]>"
+	.ascii	"F\f[\373\333\007\256\177mJ\324\266\026\ts\246\313\n\022N\307"
+	.ascii	"\204\306\331q\267"
+	.ascii	"\020\225\370+\251\247\020\005\316t\016=)\fh\3145Zu\201\276\272"
+	.ascii	"L\233\254\b#\374\366\370\224\243(\027~\301B\257\300\260\263\342"
+	.ascii	"w\r[\203\037\353\317\261\265\203\003\276DA\273\240#\367\027\253"
+	.ascii	"\302\310\223\372\360\030x\002F\347\242\332XMM\300\022\323\226"
+	.ascii	"\031\225\235"
+	.string	"\244\"\251)\241oKr\0341\276\336\225$\nw\240\262\352H\024\350\331\331\377\034\276\205\331\272\f\326\367\346\315m\036\026\231\270\255\001\370\245N\271f\312\360\253\022\203L]\245\221Py\217\345\001\253Uw\375V\201\277\247\311\327\370\212\032K!\341'\240m\300\315\365\241\035`#/\226\316\214M\240\211T\231\347\342\253<\214\320\221es\344~uC\004\327yw\220\212\277\323\275\353\002\005^\032Z\276\037\277\350!\022Z\303U\210\370l\316\306\"\023\361\322\317\fM\273\323\364o\"\204\306t[\201q$\244t\003+\305\341\262\221\224\303\337 \202\216w\315a.\263\315\373\362?\354\225\034i\267\303QN\205\236*\030g%\242\277\024f+\221Ap\223\002\261F\005\304\2473\244E\246\272\023$\022\324\030\200\344&|y\020\316\337+kG\225\334\204s`\357d\346\271\307\307\314\304k\336\351\300\333\206\2714\231\322!d\331"
+	.string	"\2707\257M\321N;\217h\364\030\236u\222\276\026\255y\201\250\375\277\263#\200\260\207j\n\332F\230\016#\301!\006\260\342XE\206\360jd\035+\237@(\\\013\343PHpC\260\234\001\240L\356\312\324\261\265\251\270qV\0346\3628\207oHM\013\370\226\001{\262U\177iXF\026_'\224\375\256\375 fT\252=\260l\355\306\203\202\342\262p\220yv\330z7\251K\203\250\243\234\203\tO\331\223;\370\253\343%r\266\206\253\336\212\347\027o\235\330\007\354(\207\234+\203\022\005\260\357\344\241\233I\306\326\f\376\035\nU\036\244\022\330\214\342@\017@\b#N!<\312\020\230bd\324a\027\025\r+\2404/h\226\321QB\t\354"
+	.ascii	"wW\302O\252\f\003<\335\037\270\272\356\nRP?1\272\001i\242\360"
+	.ascii	"Wb`\376\026\235\351\013_ \003b\243\001\213e\003\250|)2\225\334"
+	.ascii	"\276Wj\313\203\222\242\001\341\341\366\001\223\307\004\363\316"
+	.ascii	"+\231\006n0\b\345\321\262dG\020;"
+	.string	"\016i\312(.\215\367\nu\2620\243\332\274\260\270F\220\250\236\360\2375\363\263\353\336\2301u\202\033\357>\301\206\332\270\340Ol\226\355'\203\271\327$FB-N\365\177\242\233~k\227\200\007\333\261^\026\314e\257\336\355GI\276\365&?\213\212D\276_\233\370\tdR\203\243\024\273\223\037\234&\351[\306\371\352\177<\202\2435\357O\t\370\224j\362\f\242\025\036\354lS%~C\213\210\022\303I\223\211\351\226)\204\333\200\364BO\207\311_f\315\207#\376,\306|\377#\031\362\307\206\021X!\316a\211\326M\033bL\207n\264\230. \225\023D7\337n\020B\316*\374 \366c\231dJquO^\242D\214\350\024\313\2148\307;\024\215\210\363\001~\021\260\220\214y\003&J\212Q8\357\002\306\362sq\225\034\013\337\203\311\206\313\2228\260\274\021\273\312\022\215f\347\236\245r\3625\331\217'[\373\013G"
+	.string	"1\023\246\002\351\312\221\326\241#\214\271\004LFpd\354\033\0177\274\361{\265\307\341\346\340\221\240:\262\217\351\004\376\023\023%r\232&\315a\\c\226\330C\275\237IRw\231\213w\271\337\303\177P\025\302\256\213Y\333\3347\033\0304\030o\201xR\027\264\216\016\f\243O\344O\363\336\241\214\236N\003P\233S@\350A\"\201\016\022\302\002\022\374,{pw\317\321\265%\020\360\367\262=B\236a\357\254\303>\253i\327\\h\351UF1^\306\246\302\205}J\344\361\313\325x\362\303\207\021\351_\253\002\265^5)\320F$Lk\347\234\365\250\371\001?eCS\344r>\226s\001\203\274\333(&\304\320\230g>\367\366\252Kf\204d$'D\374E_\b\316\354\262\221\032\004\375\224E\364\252\363f\355\306\005I`#~\020\231\262.h\211 \262\200\234\327\375)3-\025\025g\2023C\027\003\300I\320\373\341\373"
+	.string	"D\205\365\326\021\003Um\354\376\253\202\316\377\214\b\242\336\223\233\032\223\214\323*8,\343\017Fo\356\243\206\261\304Z\032\305\363\370\332\333\253\2675\003Hj\270\362f\007\232\303"
+	.string	"\003_7\311\253\016\373\271\302\200\2021kIe\251/7\fl\364\202\021d\256\376\372\r\203\224\032\370\2371v\373\036\216'\203"
+	.ascii	"<Q\265\032\030\206\230\307\252Y\bR\232H\212\345\244D\261\245"
+	.ascii	"\277/u\021=\377C\020f\253\270\225\"\2611\325"
+	.string	"\313\221\277\366\213S\307\274\312o\320\305\360v\0177k\347\fx/\344,+\220\206\302\352G\247$\306\rZV\311\nHMp?i;\037+\272\343j\304\312\024\220\215\236~\022\f*\2341\276\244\242\344jn~\330\225RA\246w \\R\212\350Q\007J\230:\205\254~\004\240\243\353\261\225\376\007\032\2246\227\3516%\367\2678\211\311\265y@\236\347g\320Y\341o\253\\\216$<@/\177d\212p\202\025c\330\374(8\376\361[\236\370\314q\234\023\375\363\001\317i,\231\3769\234\216\217F$J\020<3\310\267S\363\270~u\027\324\343\013\213\017\364\032\374Iq\324\366\335R\370\222\310E\372\245\356\352F\276\255\032w\255\3647{p\355\035.\376\334\221\177\332\177a:\271\222\352\337\243[\f\370\001uT\367M\236\227\220\345\365\342\363V\370f\244!\377\373\250\203b\213\316}/F\024\233\204\365\204\307\207\264\026"
+	.ascii	"1G\340\302\272f\375g\277\302g\247w;\004\364\334^2\217\255#N\034"
+	.ascii	"&\315\026\336(\215\016\310\221\265\276A\351\007\317\213o\327"
+	.ascii	"\370\371\2005\323b\223O\303\177\335n\231v\210CM\206\317&l6\241"
+	.ascii	"\037\002|\340\223~\217iz\270;`>\346[p\020mv\236\276Z\001"
+	.text
+	.section	.gnu.lto_.symtab.23cb9526cc3dc2db,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.23cb9526cc3dc2db,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
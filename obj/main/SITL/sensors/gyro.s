@@ -0,0 +1,2483 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	":"
+	.string	";"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\340\006\265\031"
+	.string	"\306]tK\300\324Qc\037\2400\211(\314\257\331\241\t\242%\302\326\005\274P\023\273\261\034\265\002\001>L7\263\332U,[:j\266MQ\024EQ\024E\025\004Qm\235E"
+	.string	"d\304l\310&\001\224,\266\221\2060CD\356-\245\224R\246-\003W"
+	.string	"`"
+	.string	"a"
+	.string	"z\257\360\321@\225{?\257\276\237O\2164\271&*\022\237\374-\316\257*h\304\277\243\214\212\247\241\266\257'\244N\r\215\232\254\217\237\361\357Y7\251\346D\004_\253\227\224"
+	.string	"\005+\031\263\001q\226\376\267\2477q\257\351&\211\370J\177\361\3640\373\307\316\315\005\215\241\231)bp\250\203D`\200\313y\363V\254\3021\303#"
+	.ascii	"\300M\225k\314\2331t\244e\037\001\035\345\002\270\254ua\t1\001"
+	.ascii	"\205,+\370\246\2766k\312\315\277,\356\347s\323\302\277(\257\307"
+	.ascii	"\257.,$j!S\301?yy\226\3067y\021u=x'R(=\213\234)\034s\f\312\201"
+	.string	"\344C\331\317\001\277\276?\177\363\037\3133 R90_M\311\212f\021V9\210.\030\365\272(\254\3550\202\360\\\213\325\b>\240\345\013\233\035*\007\307B \n\250\006\f\026(X\371\317\337\236'o\337z\213D\371\263\021uK@\361Onf\b\301\035\306\240\321^(\t\033\242T\342\200\201k\230\316fI\201\373\373\007\224\214\331\200\270\021\245\021\f\232\017\021\373\271e\367\230\330\025\205\240\343\315'\023\002\202\226KO2\2042\373\352v?=\037<\\\237\036\317H\f\3369)\035\260\016u\205\304&T\204\303\206z\376%:%\365\2104\234\256[\255\264\343I\221!?\337|\036\263\0330\f\027,T\2400A\002\313\357\275\365\254\247i\356{\276\006\200\301\250\241=)\231)I\222$\313\001p\002RT\264n\022 $\"\030\210\2301\"F\214JJ\265\206\335\253 \274D\366{\332J\254\032p\036N5p\022"
+	.string	"R\021knj\340\226\034\322\002K\3379\271\211$'\313\350\025\260u?WT\342\372\330\206\232\325\377l\347q\b\f\032X\365\212I\2764\025\032\336\230{\231C/\300n\310\226\227\020\306p\306\202\320x3U\254\027\314\\\231w\307\177\3046\t\306X\355\177\225\334\211C\264{\317\374?\016d\033\261?{-\316\264\037\207\302\370\204\354\275D\212`4\267\245\333\237\313q\3756e\230\\LU[\005\212\351\311\351\331\035\323\330\214\354\254j\235\232q\301\004\202\265y\343\210]\007y\203y\216\362\333\204'1\307\006\001\267\246\253\374\237\315Q\237nu\274\023\246P\342\027$\305\351W\304\224\031\020\251B\347_ u!\266\314{N\3473\337\227l\3028\232\027^\367F+:\277?\265\274@\202m\310\314\330\315\251\304\300E\236w<\2438`\344\254'"
+	.ascii	"\215\242\310|\r4\2373`\316h4 \301@\263\324s\242\342\225y\337"
+	.ascii	"\340\"\017\245\323\003CC\205J\026\234V6\232}\242\217I\265_OO"
+	.ascii	"\035\351\223Qr,=\037\255q\333\343\026\305\336N<F\352\013\036"
+	.text
+	.section	.gnu.lto_.ipa_sra.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\002\002\345\b"
+	.string	"\342J &\200M\226\00330\00330\003s\226&hb\240"
+	.string	""
+	.string	" \324-"
+	.string	"i\013\304\201\317\215B\332M7\332\216[\312\224\002\272H\210\0062?\246\307\354\220\233cnhl\206\336\030Z\027:-\256\220\223b\314\362\274\250\"\021E?\261\0223b>\254\303l\330\fsa\n\223\242\311\032a\367\340\r\236o\244\211\236\221\022\244\002g\251\274\275\361q\311\b\364"
+	.ascii	"\033\320\265[\004\326\3708\037\320\314\354/\204\032\tM\250q\275"
+	.ascii	"F5)HaZ\003\220\202\2313r\003\0210\251C\320\321h\013\n\331\257"
+	.ascii	"\003\216\222\bJ&y\b\3753\036\355\261\033\003\262\023\f\331*\331"
+	.ascii	"s \217P\217M-JR\031V2X\034<\356\276\3415\375\231\013b\220\024"
+	.ascii	"Pj\340\305\016\201H&Q\315\351\211\263\307\0264\b|\362\240\203"
+	.ascii	"\357@fsg\017\3268\303A?'\363Fj\344\006\003\254\367Ei\315\224"
+	.ascii	"_^q\260\265\256=\254\376Y\351\260\036]7\034\245\214\334D<\333"
+	.ascii	"4[\205\254=\205\221\013\220|\017"
+	.text
+	.section	.gnu.lto_.inline.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\367\r5/"
+	.string	"\326\377\317H\260\330\315p\374f\t$\307a\362\b\210\006\347\270\236^\257\213\002\017"
+	.string	"\215GF\361\216\022\363f\f\374@\271\311O\272;\034\243\215\032\224\372\247\364\005\375\311\232o\3730\356\024\262\316&]\301P\r\344nc{\217-\245L\001\253"
+	.string	"\267"
+	.string	"\307"
+	.ascii	"1\250\240\204\270|E\332W\264mV\030\327\013}"
+	.string	"\371\334\272|\313\177\370e\316_\031\364C\322\035Z\356\321\037\324\343kR\217\260\\\244\213g\335J\221\022\373\262\371\213\236\267qx\332\205h_!\237\337\312\337\312\357P\315q<\360\344qK/_\362k\343\351\307\347\300\213\317\361\331\335/_\021<\216\371\013~o\255<\272[\374m\374\353\346-\371\353\203\232\257\323\023\373\345\367\260\3719\253\017\317:\336\322\3358\017s\333\335J\341\257[\263\233\307\243\333#\335J5\327\375\352\370Hw\353\374:6\273\333f\177\335\261\215\356\276\371\023<\306+AJ\326=\027m\330\330\330\226\3622?\f\250#\277f\262\302\200\377?\222%N\304\370\221\244\341\232\304|$\305\376H\332\306\217\344G\362\266Z>\255)\360#\330\037\233\302\217\037u\353\323\362)\231]\373\271\221I\306\263\312;\377Y\260IV!\317\"\361\377\363/\320\235=R\331y\307a>-\034\017>{\315\034\371"
+	.ascii	"v\377\207\253\327\353n\177X\251\302b\274\254f\276f\006\ba\376"
+	.ascii	"\035wu7\315\376\334a\227\272y\t.\202\007\207vI\212\2533\354\213"
+	.ascii	"\244-\374\n\t\261\330W\326\327~el5\221x\321\376\212\344PO/\222"
+	.ascii	"\027I\034\003qj\2615^\244]\304q\333_=\265\265i4\240\262$o\215"
+	.ascii	"[\316\315nt7\017\315\254\3077\360;O\033|\237P\326\343\373\254"
+	.ascii	"\032-\026)TQ\021n\003`7l\211\021&\\\350\215a\304\030B\003\346"
+	.ascii	" y\320\266;\365\344\312\fp)\004\210(\232\337\210sD\201\215u\b"
+	.ascii	"\377\367\254\362\320\236=R\035a\317\")\2379l\224)`QO\362\001"
+	.ascii	"=)1\260\230\277\210\255@\021\361\202`\225\025\366\244\302k^3"
+	.ascii	"I\360\t$\342\356^\"\177!\020\277@\004\376\315\252\362\325H\301"
+	.ascii	"i\364\257\231\240\313k&\327L\376L\373\327\335\002\214\366Fw\357"
+	.ascii	"<\300\314\t4\021hz\315t\371U&\024\217[$WUR\240\326S\r'\361\337"
+	.ascii	"\255\026/\037\001\337\221sJ3&c^$\220r`\240\020\033\362\255k "
+	.ascii	"\3323\347\314@^i\217\211\201\350\002\315\002\310\274c\230W\b"
+	.ascii	"\332y\330B\005\205u$:=\nz\020D\300\247^\223\246\302\003\213\364"
+	.ascii	"mA\005\2055~\302\366\272\273,\272\004m\2610\256\025\240\211}"
+	.ascii	"\327\216"
+	.string	"\257\"\313u\b\375\325\315\233\375\201\210S\022O\362\304\256r\317\276n\336\314\201\316\244\302\2475C\300\331\315D\336\301\177\262\3718\rv\334\f\370'D\030u\236#\324\311\036\013\212\016+U\372\201\377\2715\340\0036\037}\273'\307{\356\354v\262\227\377G\"\356u\363d\307y\315\234q9\247\270\252\362\311~\242\245\342T\225E\346\351\204\221\252\234\337\324\314\016\201B\250\021I\207ffDD\222$\311r\341\004\2041\306\030\224|\022\200T9H\242\3200#3\"\301D\005))352\034\373\243x\304m\215\002-G\252D\215\272\212\2142\002\306\373_\374\210\360#7\017;\261{~\004\201M\202m\264*R\237 &\017\212#\371\236\263D\211Rg\301\033\237LJ\2049\375\n\2358*K\347\212\304C\250\002w|\002\237\226H\206\320\267\351\341GB\246\251\356\250\242\023B\251\bh\230q\267m\327\224?"
+	.string	"^\261N\336+\350\276\322\005\300\036\363\305\375{\317M\203ZS\b\342d&\204\216\237\312\260\202\0206\3454HHl\203\t\t,\226$\323\213v\377k\342bn\203\375!\300\342V3Y\346\347M\372\323\214h\212\263I\"\036\234T\257\223\1773/\312\305\005\033\334\377\300H\001x\246\276\244\252m\215\372\3712"
+	.string	"\3461\235\206k\362\336WF%qct\242\200\250EP\257J@7\347\026\035\365p\376\332\341\267\271U\367\252\312K\277\031\315\234\037\005\345`\031&\334\316\271:zU\301\343>v3'\313\023\354\302^\276/\270\017\325\355d\017J\355GP^\314o6\3706lI\303\323\217K\365\317\374Z\365\320\312L\326$\020k\271\013x\210\341\036\315\027\226@g\311M\210\237Ur\232\316\252\314\\\340l\222\r\034\334\263\356\311\300\310\307\232<]\216\325\234\016*\265>5=\203k\307\334\325\227G\301\227\335!\326\247\246\2429\324\323\206\322B\b\022\255e\376h\01641\232]1\2745H !\375\365\352\346T\243\276vA\261\241\254/\240\203\3229ce\017\316\265\307\300\215\316\254x9 q\256\274MZ\004U}_Q\360\274KF^"
+	.ascii	"\036\345\232\351\234\374\346\340\337\347\031^\002\320\025\021"
+	.ascii	"<y\274h !\357\272\202\342\312< IB\247\341w\255\226\372@\204\375"
+	.ascii	"l\347\021\317] \002(\331\201\034\023\301\201\\\235W\266\214\376"
+	.ascii	"\247\235X?\317\315O \246dD\035L\254\t\224/\3763\026\245GqV\031"
+	.ascii	"\200\325\001\316\370\336\237\323_\210\226\232DC-\b\270C]\035"
+	.ascii	"\213\331/\027K\344?\n*P\007*\005\303\265$\375\351H\207A&\347"
+	.ascii	"\370[\233q~\016S\211\332\255p\265\337$Cou\035Z\256\n\030\002"
+	.ascii	":n$\020\304\237\203\003\236\312\202\"\311@\n\264<\270\235\214"
+	.ascii	"M\036\2705\345\310\246\220\036A\031\347+k\312\314\255\370x,\027"
+	.ascii	"G1O\312\342\237\024\205q\324#h\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\233\b\245\023"
+	.string	"\266UE:Pk\223\016033\353\314\004v\"\360\316vP\214b3h$\273\233\351\006\316\254\243h<\316\352P\263 Fz\021\021!ukB"
+	.string	"\020\002b#b\002\330\232\264lr\247\224\0021"
+	.string	"3"
+	.string	"6"
+	.ascii	"\227vV\300\0331\0277\333\276\211\333\350\265\323\002\376\017"
+	.ascii	"\357%\322\345aA\\\026V&\177W}\227\333\303(\"=\361I\261\217\255"
+	.ascii	"\375d"
+	.string	"v?*q\020W\346\216\260\242\301\325\330\315\335\200\032\337\246\374\210\265f\226\207\305\337m\211\f\216h\373\317\035\005\374\004\363\304xl3J{\306`_\360]Jk\255\231}\002\017\022B\005\260\006\257\316\256\355h9\332\215ij/\020K\233\301\254L\333Z\2721\362\"\340\257\021+:\351\307\247\203\375\213\267RqJ\300\277\023\360\237*\244\253\023\017\r]\b\033b\240\261 \272\3519)H\320\"h=\227\003\255\001K\036T\200]\235\203:Ov&p\310\200J\352\264\345X\002\264\005@\3612\273\372\333MKQ\325\206svT\006\200\226\250AM\206h\204(H\222\346P\0021\246\254\310\016\022@AA\f\005A\224bN!F\f242\023\225\024\264 )4\006\305\005\373)\002oI\317\336\241\2140\363\304\036\355\001\312\f\362t&5\007\231.\311\373\004\377\204~}\265m\377\247\204\270I(\013\031\n\354"
+	.string	"Y\325\273\266\337\030\212\251\343\210\372p\336\362\376\353\377\314H\t\177\301\315v,\021Z\3171\201\257\355,\021\211\037\306\363\303G\203}\250\350j\270e_\332#\323\004\252J\321Q\273"
+	.ascii	"!8,4\306N\203\255R\246\036\205\306\006\347W\337A\b\005\021\022"
+	.ascii	"\235\333\327\321\255\003a\237>(\255\333M\232c\234~>w(\337\247"
+	.ascii	"\301\304)\212\371|Oh\344\2031\223&+\203H\256T\205\251\256\262"
+	.ascii	"\212\036+\270\270\234\206\035\035\341\267\335\247\347\n\326\007"
+	.ascii	"\027\372\243!r\314=\033\237h\203\236RY\032\362\324\021\272\024"
+	.ascii	"\322@\371v8\230\355\363]a\254R\377\017\332\202\201'i\200d\211"
+	.ascii	"\364\263\217\226|\212\303\017{\224hxj\346\212\327\361\354\376"
+	.ascii	"\310\226/!\023\351\r\b\276M7\343k\005\240\271f]\256\202\330\f"
+	.ascii	"\t\325\256\3744\366c;K\206)W\264\234}\265Q\341f\274V\224\003"
+	.ascii	"Rd\260\363]\206\251\322\212\262\225<"
+	.text
+	.section	.gnu.lto_.pureconst.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375 }\035\003"
+	.string	"\322\307\027\034PW\206\0030\323\344\b\251\252\252\252Rw\337M\271\273\373\323/-\277\245\266\003\273\003\363te\232\245Gz\243':\025z\240\371\231\236\333\231\234\267\231\232\2279\205\231\227g\231\224\253\311\223\\E\036\344>\236\3436.\343.\256\342&&\342\036\256\341\026.\341\016\256\340\006&\340\256\312Z\013\025"
+	.text
+	.section	.gnu.lto_.ipa_modref.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\b\004\225\021"
+	.string	"f\227F7PK\223t\200%E4g\3225H\236(7a\327\220\262\272\233\231\231\231\351h\330G\277\221\005\310\210\314mM\304\270\264\220\254\275=\312\333Xto\232\264F\266I\231\0022"
+	.string	"8"
+	.string	":"
+	.string	"K\245E\235)\031SL\304\030\033c\217t\255b\230\263Uj~\213\325\\\262\2363\376X/\314\317\260h\0361j\2307C\264yR\356Xp\210\031\035\002K\001\"$\345\023J\350\357\032\225\204\362^"
+	.string	"\317\245\036\240Xc\320n\220\026\321\3252\214P>\351\335\324\356V\365\2706K\355\363ZS5'jH\317\334\2239\207z\264\001\345\2256\324\324$\240\210\340\357\030\205S\315Fs2\\\0033RNi\237\013\272\230oX\r\fT-\350Z\320\305]\205\232(\243M\202\255h\222\024:'m\376\002\227\300\200\005\004S,\374th\205\213\245\342i\254\374\024\241<\361\315\227J\\\372\200\364\341\245'\204\237\024\345\264\314+\031=4>\330AE\331\300B\005\377\303\2017\035\216_\013\312\334\304\021\200\216\250!=\352\024\021U2\354g`\002\031\262\262\036\021`=cpH\n\ni\317\270\370s\367uJ\247\237\331\251\331\372\377m<\313\204-h\334~\320\261\227\257\271\352\375DE>\306@i\251Y3\3216\314\2441p\327\f"
+	.string	"!\031\016\201\031\023\336|\241r\032\301\220\234\267-\333\227\357\337\027"
+	.string	"\220z\025\375\337\212\361\274\204\210x\021B\314`\005\251\363,\366F\350\027\370Xc\207y\360i\301\007wm\254>\352NZ\016\331N\211\205\253\2212fPB\254`N\325O\356/\223\344#\222i\225\213\214\032\374\310\230\310A\253d\037\251\262\024\231\200\260t\022N.\342*\237\\\2112\220M\273\252pVi\366\266j=\"\3417\260\350\343O\323\023G"
+	.ascii	"-\336\206\301 \332\013\037\305\306\217E3\353}\236\350a\315\235"
+	.ascii	"`\220\360@\217zm @\220\326\236o\346P*\007\f\344\341\255\376\036"
+	.ascii	"\001{\221\351\314\236\003\207\007U\342\336t2i\223\025|\345\032"
+	.ascii	"`\245,\372\004O"
+	.text
+	.section	.gnu.lto_.lto.4dc7d290195467d0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.62.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375 \2265\004"
+	.string	"T\007b"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\306\203\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\317\006us\354\005uq"
+	.string	"\005\001\006'\001(\212\3400om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\005"
+	.ascii	"Z\tN\271\036f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_gyroConfig.63.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\270\003m\021"
+	.string	"\206\233hI\300Tq:p\377\275,\355\301i\270\362\320\332I\017<\233s\235]#\327\335;\036\266\257\225AU\177\334\363G&{\221r\020\351@D\367\361\203\243"
+	.string	"\t\371z\027"
+	.string	"$\367\271\032T\220\237\335\365w\2735 \366\217\245'-\245L"
+	.string	"S"
+	.string	"Z"
+	.string	"=`\230l\277\263/\373\214\326g\\.`7\026\004g7M`\004\244\177NO"
+	.string	"\374G\372"
+	.string	"\360\237[6\320S\027{\034(H\320\324\335\r\275\026o\275k\371\247\361R\214\214\353\335\350\301\356\272\213\2211q{\267}\300\366\002[\224!,\267\311A-^\207\214\233\352\201xM\351u\203*x\t\332\344i\312"
+	.ascii	"0\233\272\344&h\213\270\r\223\264\273\f\374\032#ZL~^\374\363"
+	.ascii	"]\300\177*)\214\234\262\334K7d\247\256\316ca_\264^\314\376\314"
+	.ascii	"\337\031h\331\032\324\240\266[bHhm_\346\f\207\326\244<\310\234"
+	.ascii	"\02119-\034\350D\341\\q\312~\341Ej\365\004\332\030\376s\252u"
+	.ascii	"*\307\361h\370\215\007\335\360!7\032\3556\207\327L\023\214\266"
+	.ascii	"\362\235\333NE]H\351@\205\355\224\245\016dtDG\211\352>`:\350"
+	.ascii	"\352\263\322\215\037?\341\3418fN\375\216\333\001\252U\007\226"
+	.ascii	"\210\002\300\250\023q4U!9\212$+E\206\254\325\nK\210\032\311\360"
+	.ascii	"\244\200\305\017\2511\f!\212chJ\367\242\365b)1l/\036\fJ\347\202"
+	.ascii	"\361\251<nC\370\220\t\363A]#\\\310\034\315z*I\302\223\224\257"
+	.ascii	"\0364\307\355\tGR\276p\325\313Ux.H\2501$J\245H\202\005\345\233"
+	.ascii	"t\360\002\021\241b\035\021PX\252DE\342)\274\003X\206\032\b\323"
+	.ascii	"-\2711\244\305\303\222qN\261\306\032\260Bp\3244\364\254\226\212"
+	.ascii	"\312\360\231\360\3179Q\024\n\322j\344/\355[\353\023\242\221\355"
+	.ascii	"t\215\251\327\321(AEe\207\224\207\301\300\373jbC\324\b\260\330"
+	.ascii	"\204\036\353\216\033t9\247\351\027\210J\3625\371siL]N\254IFh"
+	.ascii	"\356|\324\004\n\352\004h>T \370\027\003T\003"
+	.text
+	.section	.gnu.lto_gyroSensorBus.64.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"U\013"
+	.string	"\306\025O@ O\234\0160\221\001\f\030Y\326\n\016\204"
+	.string	"\306Q\025\337\f"
+	.string	"y\016'q#\216\2114f\313;\021\344\341S\1777PU\177\013\017\\\001\030\327\212\324\253\274X\bHWl\214\366\236\265\275\245L)<"
+	.string	";"
+	.string	">"
+	.string	"\376N\241\036%\027@=*\207\177\0165?\376=\016=\204P\301u\240\303\215+L\220a\305\306\244\013AJi\203\213{<3:Q&\200\006\273\353\344:\215;\336\266\003\333\b\354+\b\217\327\002!\030\266<\331\037(\225\303>\334\335\265\222l\247\241\2463\323\217\001R\224,&v-\234b,\213\210\242\203m\217]\371\037\016\302\343\317\200\317\323\250F\246\021\b\214\335\317\n\234\2559\b\204\227\360\274\371\210K\262\273\f>*H\260\230:4\352\021\352[p\027\266<A\250\034\231'^\2244\250\222\376\214\272\346\310G\210(G\354\213\370\227\371\035\246\320\311s\217~\207\n\276T.L\313X\031ve\034Lfq4\0176\326\005\313\254\n\001_\0210\2305\341\2720\253\372\366p\225\344JD}\321\026x\225H\032\243\0350\355n\347R3lC5\260i\310>\211\314\304\013\020"
+	.ascii	"\031\023\372\252\360\200yo)\213`&\2121\335\276\261PX\365D\021"
+	.ascii	"!\202\207\035.\274k\212\037\"\033w\305\252F\247hj\017"
+	.text
+	.section	.gnu.lto_gyroSensorBusByDevice.65.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"-\013"
+	.string	"vTMB\020\307L:\360\356\2404\376\336\026x\006\005\367\024J3\033n\214K\306\240\237\036\243\210\n\240\375h\336\242\021\3571\006\337\374\272\346u"
+	.string	"@\002\b\252\002h\245\003]i"
+	.string	"Q\265|\250\344m$d\357\224\0029"
+	.string	"9"
+	.string	":"
+	.string	"\347\0250\0075G\300\034\254%W\375\253T\345\257\376]\340\006\300\314\220\327\317\363b\002\330\230\256\357 e\207r\334i\314lQ\232\371\354\256)\314\234\335\340m[\330\226\260\377\020\246\376\307\221\025\250\350\355\202\364\030,\001P\300\211\355\224\035\332\256\324\366L\244~C\271\356\216 \b\260{F\030Bs\320\266\277r\226\224U\013\247m\026\276v/\035o\367\024\035\t\266]\326a\366\370\026\223\203\315.=N\231\\\003\225\335\2458\370\032\253\376\260j\353\2535'0Q \253Gah\025!1\220;\340\242\013\354sEk\315\376\267\225f\377\366\323\344X\226B\030\"\320Ht\n\r\352\214\344\207\206X\222cY\n\225bi\224A\022Ad)v\030<r\204H\261c\034I1<\367\225fJ}\027\322Fgj\3308eZ=\036\356\234\352\347H\001\021"
+	.ascii	"\021\013\270\016\303\203=\300.\241\312\215\314\tI\005H\325\272"
+	.ascii	"\243\032\244\356Zb_\320,\352\302\b\227\031\221*\306F\251j\240"
+	.ascii	"\271\024\024"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.66.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"]\013"
+	.string	"\206\325NA\020Q\234\0168\202\2458D\254\026MW\336"
+	.string	"\037\304\351\365x"
+	.string	"\322\3711E\337\312\230"
+	.string	"pRM\314\032|\033\026>Q\354\037\003\017\004"
+	.string	"\200Vd\204\300\205\025\002U\206r\252+*,\266\275\245L);"
+	.string	"<"
+	.string	"="
+	.string	"\337+\324\343\344\002\250G\005\361\317\241\346\307\377\307\341\b\0252\270\016t\310q\205\t:\264\340\240t!X1}\210\361\217\347\250\023en8\330]'\327\221\356x\333\020l#\260\257 \035\352\361Z`d\303\226'\373\003\245v\330\207\253%\333i\250\351\314\364c"
+	.string	"\016\246\0070v3\234j\254\213\310B\204m\217]\371$^\302\343\317\200\317#\001\b1\302\020Bc\367\263\034\036gk\036\"\341)<o~\342\232\354.\003\220\013\024\032\210xh\324#\324\277\3404ly\202P;2W\3140yP-\375\031u\315\022\220\021Q\226\3307\361/\363=l\241\223\347\036\375\276X.L\313X\031ve\034Lfq4\0216\326\005\313,\013\001_\0230\230U\341\2720\253\372\366p\265\344\212D}\321\026x\025I\032\243\035\020\331\335\316\245\216lC5\260i\310>\212\f%\021"
+	.ascii	"\031\023\372\252\360\200yo)\213`&\2121\335\276\261PX\365D\021"
+	.ascii	"!\202\207\035.t\r\237\306\342\371!\210qW\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_gyroDetectSensor.69.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\317\001=\021"
+	.string	"V\341uH\340\264\2501\304\025J\340\375:`\261\241\373hs\276\3758\325\341\025\374\002,\341\217.\225\342Q\306\260'F[bX\013E\312\234\301\254`d\310\203K8*:@\234\210\221b\270"
+	.string	"g\024gl^\345\256m)\267\224)\005a"
+	.string	"]"
+	.string	"d"
+	.ascii	"\307}\346u\232\225\017\270\327\306c\347^\222\201\023\210^M\276"
+	.ascii	"\200}\025\235\200}\265m\223\203\227a'o-\036\t\0304\234#\367\222"
+	.ascii	"\037Uq\330;:"
+	.string	"a\376k\336\025\371\t\032k\261w&N;\323\f!\234\200\232\330\005x1\342\346\271O\226\332lNO\302\275\327s\254\225\270\353mW\260=\301\236\246\327\324f\277\274=O[O\327\323\374\323N\177d\211\350`QR\037\344m\031Jr}*\216\026/\177\373\276\214\227~\316\243\234W\3531\234Af\210\013\356\336\333\362s<z\365m~\323:\216\253$\222\267\206!\267\203S\360j\b\242\327R\367\262G\266)\251b\300\344\2126+\032\314i\007\257\371\264!\003\3442\203\2423\231\377\311\372%*5?\232\264c\306G\2441\013\271\305\274P\nc\033f-\rm\202\210S\310\244y\352\227*\017\363\243\245\317]d\204\347\005\t\220Hc\366uX\013F;\3455@\321\275\367\001\r\021 \"\374\210y\365W\350]\374\364\030O\310\346\220M\316&\205\261\337\335{\003\251\360\344\342\020\236(\220PT\035V \312^"
+	.string	"`\324\t\030\252\240|\254\020d\255R\254o\245:\245|\250\220\365\235\0340\370!\025~!@0\374F\266M\312Nm>\020\036\032Zr\227}\356\026tR\320nL\337e=\312b\273\322\222\214\316\354k\260\036\2554\374\t\242\365\314\346\220=jox\217\013\301-GI\037"
+	.string	"5\203o\036\363\312ja\217\211\220\211"
+	.ascii	"\301\301a\026#Zc\216Iz\202\216\236\273\231\245y\n\215\211\207"
+	.ascii	"D\001\037_\320\304eLW!\340\272Z\321\324\"\034\036\241\017!\341"
+	.ascii	"d\n\0035c9(\f\206-@E\264\352\246)\205\202\002"
+	.text
+	.section	.gnu.lto_gyroInitSensor.70.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\300\005\245\035"
+	.string	"\2461\257H\240ZQ:\272\337CoN\264j\234\026\"!C\210\252\216\354\315S\006\27133\333\212\222\347d\337@\030\357\243\366\227b\ncU\021@\204Q\020 \243"
+	.string	"\206\254w"
+	.string	"\363\345\305\b\345\301\251Z\353\336\332\236\264M\210\224I\006\222"
+	.string	"\221"
+	.string	"\246"
+	.string	"\223w6\3578\362\212\315\333\"/7\357\023<x\003\250\346&U\253\215\341V\375\215\\\212\354\356c\273\313\276\027\003r*\017\n\222\203\363\356\233\356D\337\203q"
+	.string	"\265\006\371\242\245V_\203e@~\\\337k\363#y\235\371q\351n\325}H\325E\304\214\220\024`\255\325\326BN?G\261\231\356y\353\251\034\322}\202\031]Q\2731\342\237\\\301\216,\2732V\206t\274y\273YK\202R\202\r\305hvM\250\265.\227C8\276\256\357\356mw!\354NY\344\213\371q\354\230\222\254\240\330\273\035\376\324\242"
+	.string	"\322~x\026\020\037\305\033\230\335b_\250\313.\304\257X\351\236Ee1\365\270wG\274\n\t\262\326\372`OED\t\032\325\022\214\371\261\205\345\325\233\373Bo\326\304\245\234 k\345=\330Cy\024\236\375\322\307\355\361\341\227>\363\343\273\304\222%\"\247\036\020\017w};\356\243\335\367p8\fn\007\331\275\357\017\360\336\257\023\343\315\201\361\322\232\027\347\305;#ye.\336X\363\302\\\274\257\346%\233\327\025m\254\232\230\324\242\312 V\024\203\337"
+	.ascii	"9\033j\264`\215\200\234~\005\r\203;,\353\245\365\306\212x\255"
+	.ascii	";\272\032*\304\212\326S\350\005g\310\253\250R\032\254\362\n\315"
+	.ascii	"\031\234\236M\0212\365fDNE\213\310\250\310\274\f=B\221\320$\374"
+	.ascii	"\222&\301R^-\340W\307Z\326\273\224\2116\341\227\263F\020\324"
+	.ascii	"\272\335\217\301\031(\305D@\222\365K\035\260\2169\375\027\006"
+	.ascii	"\326\1772C\366\253{\212:\371\024\030\262%\004m\271z\227\302\277"
+	.ascii	"T\360b\341R\027\\\035\313\322b\232\275\213\341P\031\272L\215"
+	.ascii	"=5\234\313\026\017\033\002>)P\334p<\363\003lyvp9\027>\266\237"
+	.ascii	"\034\356\347\326\363c\273\2458\241\302\306\223\373\261\355\020"
+	.ascii	"X\334\212\236\234\215\005\016\227\263\305|@\027k\216\037P\357"
+	.ascii	"\326\001\353\360\240=\370\345\326\264\214\004\255x\255\023k\255"
+	.ascii	"u\366\321\214\327\240!\205\365\032\326\2702\204\240\334\274\266"
+	.ascii	"\346\027\264\022\373\350Ti\356\322\037\314\243J\007xW\233ia\001"
+	.ascii	"\262\321\372\201\033?\035\013\237\004\225\024\325\313\225u[\025"
+	.ascii	"\241\211\310\007\016m\353\302\277y\315\202\300\007\337\346\324"
+	.ascii	"\210\032\315\217@_\023\223Zw\237\265\265\352NDr\250\001y\250"
+	.ascii	"QD\304\020ET2\n\013\nR\2204\006\260\002\221)\0337\021\0205D\n"
+	.ascii	"Y0\304\240\240\224\306\267\024\260NB\204\302\305j\022\202u\004"
+	.ascii	"\323\310\202\373\310\372-}\034S\225d\336M h\222\302J\234S\335"
+	.ascii	"\2051\245\020\305\006\255\300N\215\230\200.\031+\234\"\231\307"
+	.ascii	"\342\271\377N\205\327\025\206\301f\201\205B\353>$a\326@\025\362"
+	.ascii	"\351\001\340\244d\n\325\b\205\205*E?FO \\\240f\372\325\301\306"
+	.ascii	"\032\016\037\350%O@[\035\234\260\331\007\260\274\376\212\346"
+	.ascii	">vY\246\240m#\220\n\317Q?X\320r\334\030\274~S\362n8 \340\321"
+	.ascii	"\005\250\242\031o:\250\357*\2613\211Xa`d7\253\306`\021\217$9"
+	.ascii	"\006\262'Z!\220\223\330\221\315\205\006\333\203\347\t\247i\321"
+	.ascii	"\023\354\242V\2255\330\b\020\253\300\3620v\206.\b\213\222\307"
+	.ascii	"Z\256\3211\375\017"
+	.text
+	.section	.gnu.lto_gyroPreInit.71.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375 \277\035\005"
+	.string	"B\211\"*pm:\240{c\343\304\027%\372\246\330@S\303\325\201\025\355\235\337A\247l\351\333F\250*\374\303\335\022\341W\206\0331\356\235R\266\252I#\013Y\351\254\330U%\326P8\244E\253\254\b\236\217\213J\310\234TR\237\366\350\031\264\270\331\337\006\343\305>`\243g\303\302F$\031\355VN\246\r\005@\032\333\247\234\331\244\177\231\375\307C\351\224vWF\314\263\303\314?\347\003\256\233\034\n\022\273k\310u\226;\336\366\3016\3026#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_gyroInit.72.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\312\020\235G"
+	.string	"Zn\314\030B@\034O\007\247\231AS\303\033Ke[\315\306q0\004 \222X\244^\257\r\364\r\331\202E\373"
+	.string	"\005gB\232`~\302\016\315/\fY\343\017A\332v\326T\232\242\260\302\225i\321\021\033i{o)S\nw\001c\001\177\001\332y^\355\316W\373\316\253]gk\317q\2657_\3558\256\366\033\327\316|\265/]\355\260k\177\267vwk\327[\373_x,i\327/\265/\033qN\346\332R\312\204o\237\232\273?\027\300\247\322v\375\202\252\231\235\306g}[\361\036\257YY\226\233\256\273\r\367\246\033@`\303\343\2373\343z5A-*\222\262<'\265\221|\374"
+	.string	"\242QPONMLKJIHGFEDCP\241\240'\320\217O\017\217sG'\247\211s\303\\\302\257\273u\354\177\365"
+	.ascii	"t\340G\001?j\357\241\366\364\223^\026\355\344\0068\303\027\371"
+	.ascii	"\205U@\367\311\265\204\212E7]y&+\277dE+U\311\323I\256\324_\026"
+	.ascii	"\327\027V\257\270<fk\320\310i\244\24388m\344\234\3668\223\235"
+	.ascii	"\034\353\212\373\242\354\233&\312J\321Cn\017\025Z:\030\353j\373"
+	.ascii	" \265%\372\351\006\344\226\246\177|\320\316tO\223\252\022\315"
+	.ascii	"\223\244I\325L;\277\260\032\026\250w\256\257su\225"
+	.string	"\226\232T\301t\316\322X\327\3277\013\253_\256R\223j\021\215\263w\344e\335n\376\355%\220\351\320\222\235\034\353\362z&\221\031~\236\371\241\375X\325k/\207<\374\346hZ\263\264\213c\035\362\333\rp\375\002d\307\212\303}\212!c\374\267\327[\326\251\326K\007\262,\273\246Z\273\336\003\274\2736t\367\007\356;s7b\354\030\257Y\300\177\335\246\r\316\306\236\2511ci{4\374h\341\220\233\215\335\332\346\030\035{TG/\237\024Ix\245\333\234\371\235qa\036\3723\272\026\212w`\321\265P;\002\207\217\370\211\256e>\241b\362\332\026\023YL\006@\006\020\250\320\265\313\312\271\207\320\265\3136\200N03\374G\260\240\377\027\327.\267\200\262|\365\327\375G\360\277\256\2512\027\033&\262\354\376\201\356\256\375\277j\231frU\236\223\001\270\262\227\256\364?\017z\277r\211W\270\371c\330\177\313s\211?\200"
+	.ascii	"A\331\366{\317'\342\215\242F\362\021r\351z\220\200\217Xz\373"
+	.ascii	"a\246py\360\362\312\243;:\222\355\275:I\216L\363A\212\231]\367"
+	.ascii	"\245\260\377\335\343I\375\323\234\004\025\025\374\357\022I\243"
+	.ascii	"\344\343/\241^\005\367\243\200\177\217\250S\304\241\327\270\273"
+	.ascii	"\211\257C\301\224e\034\t\374\351~J\n\377\264\177}E\225~\352\277"
+	.ascii	"\376U\360\277\277\225\304I^\341\342\260\364\326}n\2527\326\375"
+	.ascii	"\367v\273M\343\273\314}k\247\260\324\036]j\217r\355P[\373\023"
+	.ascii	"\254\335\311\2657m\355L\256}\311\265+\271\366$\327\216\264\265"
+	.ascii	"\037\301\332\215\\{\321\326N\344\332\207\266v\350\326.\264\265"
+	.ascii	"\007\275\332\237\260v X\373\317\253\335gk\357y\003\032\217I\314"
+	.ascii	"\366[5\240\255\361\024\343b%ZI\254\366\206\356\361\232N\213\331"
+	.ascii	"~0\361_\264\237\375\206\212qXD>{Ds\373lg]\217F\261\241\236\355"
+	.ascii	"\216A'\221\"\231\311\262\254\315\216\364\354w23N\316XP-V\006"
+	.ascii	"E\234\2056v,\304|\330\366\210\345\177kC\262\004\361l\253\272"
+	.ascii	"E\236\3553\345\021Fk\236\026\252y=7V"
+	.string	"\207\275S\3107\267\323\247,\366\021\001\222\302ho\227'h\375\331X\377(\274\263\337\261NQ\357\370\346\336\331\260\341O\263\020\241\370\344\354m\275C\222cK\317L\317\306\272\276\276\316\376\303\272\305\375Q\270\271u6\354\2475O\365\366\373x\244p\316\235\376\312\331/\335\235\330\025.\314\251\346\233^\315\r\035\f\334\301\231\365G\341\233\215\023\344f\307\230\377&u\230\033\312\003\215NN\377\220s'\240\273\254\\> <\231\322Oe\016\346\354\255\247:~\024\206\367r\277\026\220)\244\326\001\357\030\263\237\333\274\335n+\233\033\373n(\2173#i\306,:\351\237\3239b\267M%\361\347\334\007\350\254\370\215\301\024\302\300\005\377\272\236j\0341\\,\367\340AV_M1e\031\353\251\376[-C\21005\005O\250\240\237\372\356\317+\334B\230\265\257\334\245\224Z\240\3726TG\307\360k&\335=c\336\233\214\313"
+	.string	"\373C~d\006\r\0336\\\331=\372}\232\016\001~\242"
+	.ascii	"\f\252\022&Z@\235D\201*+\031&\244\\XU\271`A\345B\212\005\n\351"
+	.ascii	"\n)\022V.\244\n\020yU\013*+\251\027UUVR\3159\254w\345]\346*\330"
+	.ascii	"\250x{\321G\363\377\366L\312\265,\336\336\316\373=\224Cmw\200"
+	.ascii	"\265\247\356\312\033\033\205\n\323>\r\370\350S\243\326i?1\226"
+	.ascii	"\211\331\030,:m'\233\022\243\273)j\013\037\222\036PL\207\206"
+	.ascii	"d\230\024\0206:yZ*\\\222\204\323\204pa\300|\021d\323H\007\006"
+	.ascii	"\321Ii\217H\332H[\211\302N\242\260\221\366k\365\001R\330-\346"
+	.ascii	"J\267\261\246\215u\275$\340\033\334\201U*\r\370\250\275\345~"
+	.ascii	"\264\275\213\324\310\3145\027\355\027\203\205\305Fb#\260\321"
+	.ascii	">\332\257\241Ve_\254\366v|1\033\003-F\033\356\232)\335\342"
+	.string	"\212\266\236;Hu\214\332E\373\265*\261\364\026f\332X\327\347\264\224i-\3552\"2\215E\372]\256\304l\257g\205h\177\027\305\027@5\243\2464\264we\335\342\026\235\027\307X\020C\373\206\017/{\205\233\007\350\217\323wqT\354\246L1\351\334\343$1\232\316\033\323%\210\0270I\320=\242n\360\267/\205\2056t\177\216\353To\341\204v\2139r\322\b\322\233\226\022T\347\343\257\215\303\374(i\250\007F\346H\203}\320\276\001%h\277\230\033'\365\231\031-WFO'\362s;\247=\324h\001\211\322a\r+\002\332?;'r-V\013\201z\250\2218\005\021cdFD$)H*\351\241\005\204 \306 ;\017\021\3404\247\240*\"M\241\320\001\231u\300_Z\2072\243\275K\372\302\357\325YbW+\333\310\247\001\213\323\274Y\310%}O3x\032L\020n8\300a-\n!p\3167\370"
+	.string	"\201\006\031\020t\234\260\b]\250\341\006\327\020\320|\262.\202Aw\260\343y\001\373D\367\331\206,\035a\275\006\224\025\363\370\342\246\bA\303=VK\016\035\030\211ae\2018\347R\346\272\346\334y\210k=\240\0136\237)\237\372\004\303k\031\213l $j\371\252\201\324\216\307\025\002\003\3210\243\345\320\023\300STEC\350\0229\205\334,K>\247\202\334r\212Y\324\252\361+\024)\226\301gy\\\222S\223\220z\016\306eH\261\265R~\"]\204("
+	.ascii	"[\243$0\273\276h\b\300\002_\f\335\nt\267\227\345\253\252\307"
+	.ascii	"1\305I\007\372O\256\215XCu\360m\340%\332>`*\030\327N\234\206"
+	.ascii	"J\227\020\355\204 \033\300g\352j\231\306\246.\3014A\231\202\346"
+	.ascii	"t\331\342\326\212q\276\327\331vFJ@\354\n\343\270\352\363\340"
+	.ascii	"\331f5\317\330\b\243X\333\002N\230\3618\204\203J\216\036\032"
+	.ascii	"hm\223h\241\006!\022\321\n\303\352n\310\006Y\250\327\035{\250"
+	.ascii	"]\213\310\307\013\022\t\332\310\351\343\206[\305.u\023\354`\023"
+	.ascii	"\201\2742\344\\\376Du\271\266\266]$\250\304l\037\243\037\030"
+	.ascii	"\206\0133\332\007\373"
+	.string	"\026X\276wL\351\212\313\226\274\367\375\301bd=B'\317\034\344\016r\213\213\372<\257y\032q\006\004\322k\004\314\33157\262\001\213Z\243I\023\246\tH\020gg/\317\337~\213\365\234\230\264\004\250\2640\217|M/|\271\370\027\203A\241\310Z\264\355f\330\tx\2575\202\370\315+\023\\\024\222m2P\242\021\037V<\032\030~\331B\364\33078\241W\301K4\234&\213h7\013"
+	.string	"\211\2050\023~F`\020\332\334Aj\241\337$OL\342L\251,O)\355\200\334\363\332_\030n\301@\250 \026 \324\222D=\032\234\325!\347-c%\275\204\"\370\017\240v\"\355\256\246\204H\362\356I\b\255O0*FC\305\321\241\235\tg.Ce\013\007\251h\030q\002\351\313A\304\025\036\274\320\246\235GO\231\363+\311O'\343%RG\0321x\254\355\3751X\3752\236\2531m\230\370v\017!\310\026\036s\301\027\365\220\020Y\032\270\027\234\310b$Un\233\305"
+	.ascii	"\027R9\037:\333\264\2234\373\301\033\253u\243\007/(\224\253\177"
+	.ascii	"njl\366\037"
+	.text
+	.section	.gnu.lto_getGyroDetectionFlags.73.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375 \365\275\006"
+	.string	"\362L/3`m\322\001\300\016P\220\310`S\365\214\220gX\020Wi\276\b\003A\223f\255\005"
+	.string	"\035\213\251\013\343!\b\236`B)\250# t\333\376h\332M\312\224\002\306\\\334\33344\370\034\324d`\32380<4\314\203\355R`\007\221y-\302\271\327*\326^C\251\026I?\366AnE_\303\033N~:\3639\321Yj@%\345e[\236T\f\373\224\325\220\355t\252"
+	.string	"\t\005\365\252d\327\342:\331\021&\262a\273cW\374\216{t\034\027$$\020\002G\305D\210\311\256\325,'\210\316(\037\210\3164\343\361\031\375\177\\\341S]\023\345y\002$\354\256s\242@\267\336\266\201\355\003\333\027\001\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_dynLpfFilterInit.77.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\217\002\r\022"
+	.string	"F^nH\340\262(\035W\262\272\232\311\220\005\r\272R1\315\021eO\201\2038(\312w.\365\345\246\2552\002T\262\357\227\207\265\275]T\254A\207\264k\331\3344p \2141\306\023\324\357\004\305\216c!\215C.y\021B\b\331;\245\\"
+	.string	"U"
+	.string	"X"
+	.string	">\210K\266\016\201\2255-\200}`\231\361\354\256XE\274\364\020\374\274\256\322\222\337\205p\261\251L\323C\004\340\3147\0223\341\201$a\0166\202\007\210\026\016\357V\002\230\251o"
+	.ascii	"L\315u\241V\001&Kw`w?s\212\301DQ\n\222\354\256\251\312l\271\001"
+	.ascii	"\334\366\006\333\tl:\013UeU\223\371y\236?\325\345\367\032\241"
+	.ascii	"fG\212\372\260M\341(\312p7\305\300?qY\005?\346\236-\220\350U"
+	.ascii	"\367|\322w\357\265\301\352\246Gv\242\247M\203\242\265e\277\236"
+	.ascii	"\347\351\343\372b\237\272Rjz\352\207\204\354\2740\337\201\266"
+	.ascii	"\233"
+	.string	"\341\374\2618oF\t;T\206\215\207\305o\223\343\346\325\326E\237\017\3431D~\214KLL\276{)+\234X\356DO\177\305%\340\340L\324\3075\230\232\253\253-\277\205\357\342$^\313\242\37167\360\335s\275v\355\317l\353\204\273\246{\370Y\013\223y-k\025\214\260R\364\307\366\311k\310\0244\016\211\220#\222H,Gd\2112\226\"J\t\350D\f\215JQ\244\200\311\t\343HL!\311\221\bBsz\267\365\305\241\016\r\270SE\271\346\200\036\214\3671\204\337J\033\265\252\254p\364\310\252O\3435@\241q\374\356\2017\\h\252\235\023=\273\335\335\260\266j\2679X\345\304r\240on1\025=\276= \260\002\031\261\243\007\263B?K\f\327\343\0348\2341\303\t\r?\235\236\306|)7N1\nX\365\363{\333\034Z\374\312\322q\357\315\223\367\310\230\262E\331\272\222!\304\371\270\r\267Xx("
+	.ascii	"2\b\312\252\n:\321 \"\177\205\227\020\243\344\355\210S\323o\002"
+	.ascii	"\311*\256\327\2476Y\\\005Y\320\202\260\333\270Z(\356\001\357"
+	.ascii	"\203\t3\321&\262eD\2709\f>A\325\036\26552\214\227wm^`\215M\350"
+	.ascii	"e"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.78.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\336\b\365/"
+	.string	"*Sl\022F`\232R\007\237jzM\240\202\362\377\203\32459\200\034'c\346o\231\237\213\212\370]T\324\273\004\302\322e9d\322\246\364\305np\315\016\363sp\002EpY\230$t\223W\001\036"
+	.ascii	"#\263X\313\335\366\336I\246\024\017\001\002\001\034\001R4?d["
+	.ascii	"\013\317Y\331k\224\231\375\365\345,\005a\305\305\232\327\274"
+	.ascii	"\314LM\331\206n*.\216T\322L6\364\362\321\207\266\300\331\306"
+	.ascii	"\340b)>E\351kR\330\230\251\246\206Pp\2355b\017\320Bi\352j\314"
+	.ascii	"T^8$`\251;Q\372\223\246\2660\347.\300\267\234\363P?p\235=\256"
+	.ascii	"\216\273\035\315\323\224\256\026\303qr\376Q\367\226\263t\250"
+	.ascii	"\205\\g[\3529\255\263\256\007h\235\355Vv\357\271\024,\357\230"
+	.ascii	"\261UE\361\3139\023}\220a\277\257Ro\342+\275H\264y\207B7\330"
+	.ascii	"\262\353ce\373\322\213=0\361\3516\301\242,\276F\307\212te=\375"
+	.ascii	"]\215\016~\214\\m\341\341\017\220\254\035.\f\026\311\271k&\272"
+	.ascii	"U\246+k\207\273<t\364O\260\n\267\353\021\314\025t=\346\234_\254"
+	.ascii	"&f\037J\267z\234\033y=\3218\261r\370S\r\261\246\332\0341\352"
+	.ascii	"\230w]A\037\007\213r\316\215\235XY\3367\336\355\027\272\333F"
+	.ascii	"\267\373\001d1Zgy\376f\372\304sj1q\265\235\316\223\220\330-1"
+	.ascii	"\240\213Q\305\344\376\277\332\273\364P^Y\346\342\322\fz\317u"
+	.ascii	"\256lF'\264\245\273\367\206[g\374r^:\364\247(\207\211\336\350"
+	.ascii	"\313\322,\344l\316{\234;\030^\324\216\n\007vK\227\370\277\272"
+	.ascii	"\375\253\325j\232\376\037\335A@\016\305\375\200S\361>\372\232"
+	.ascii	"\273\217[\361.\340m\336=\004x\006\354\270\232\273\216?q\317\361"
+	.ascii	"9o\034\247z\033\375\r\316\273h\203\233\330\342\266\031\342~\207"
+	.ascii	"\270\207.n\341\213\333mq\007\207\270\333!n\326\305\275\nq\277"
+	.ascii	"\0207vq\273\020\017\227\351\035\024\263\266\307\223f\034\325"
+	.ascii	"5\331\216\205#\342s\356Tw*\356V\334\333\334\337\334\341<\330"
+	.ascii	"\355Y\326\274\206!:\326\216\245]\256_jS\261\336i\330\232\323"
+	.ascii	"p\235\305^\305\331\334\315\257x\\\277pO\306\f&;\026\232\231["
+	.ascii	"\362-\271f\035\322\234U\234>\003\302\377jba\002X\021\300]\330"
+	.ascii	"\024"
+	.string	"?_\001\355QR&\214\253&\372L\023\305\001=\360\276\246\367l\252\030u,\370_\335\363\353\313\230\326\371\374\372\305)0\276\252@&\256z\373_\335\246\001Y\007\274\216\224\263.O\340o\336\252M\323Zw\336@\363\254\355y\276\370V-\325\372\374/\261$\231\352Q\341\277\356\013\031|\362rf\272\263\335L\n$\334\376\324:[\274\003\233sj\365\340\002\377\337\275\201\003v\347\361\2173~\331>\377_\234\362\201\246\331\307t\363&\017>\256\234\273B\265\272\205*g&\002\374\005\036\2635\215L\341\327\231\372\360\322\354{\237'\\\376\241\355y,\246\311d\252;8\337\207v2\276\027\242[\304\b\354\316\021\255\263\376\376\267\005\270D\215\211\253\230*F%c\307\220p\275\001\377\336A\347\362\236\022\200\225p<\244\241\235\277\231B\335\352<\b\357\312\372_bL\364\344\235\3600(\200\b\374{\367\344k\007\363\224"
+	.ascii	"\314\331}\344_\220\334\234s\004;\020\310\241\274I\245\027G+\223"
+	.ascii	"\221\324\222\223\223\005\001P\310\250%%\243d\362\310\311E\323"
+	.ascii	"\0221*\251\324\342I\312\203\024\022\023\262\305\023\022\312H"
+	.ascii	"@\024\206\226I\351(i\205\241A\205\323\022\213t\222\212Z\243\232"
+	.ascii	"\226\222\253\210a#5h\202\222J\"JB5%\231\220I\"&\245#\026DHPI"
+	.ascii	"\242\006<\335\344\204\204\"\212jj\202\"z\245\331\327\\\304\374"
+	.ascii	"\251v-EK\f\270\026m\200\236\325{\0278\016\016\021\347\201^g*"
+	.ascii	"\346\245\t\035\302\302\377'\006Q\2065\255\222\306\260S)d\202"
+	.ascii	"\ne\032\004\342\3737o\343\201>\374\027\347\207\337\326U\0052"
+	.ascii	"1\r\\%|\270\035rK\324l\210(\213T\235Z\177\356q\216\263\246w\366"
+	.ascii	"\376W\277z\302\240g\365\334\005n|\253!7>F\342e\356\246\\\r\031"
+	.ascii	"\270\361\203^g\032\346\326\204*\300\307w\277[\031U&\301\356\354"
+	.ascii	"\306L%\001\312%x\251<\203\220\207\263\2232\255A\3621[\3737\037"
+	.ascii	"|o\036I\340M\327\262\337\276\033\237}\227s\022^asO\026\200\250"
+	.ascii	"\250A4\244\030sfH\204d$I\223\306\240\002\221\241\252z\021@\261"
+	.ascii	"c\016\321H\013\n\245\016\007\205d\017c\375\250,fT\230\252\332"
+	.ascii	"m\257XXENzT\345M\217|:\026\272T\300K\321\316!\021\016\212\207"
+	.ascii	"\322\257E.0\303D$-\224\235&\005\277\333\016>\002\032>\350o\314"
+	.ascii	":\262\300Q]Zv\356\244\237\204|\265\340Z\022\022\322\324\223\236"
+	.ascii	"\0361\033\214/\004\310i\037\311CU\201+M\211.4\366\006\250\203"
+	.ascii	"\201I\324|\326\360n\252\312\304ZBR\347\"\246B\347\246\204\324"
+	.ascii	"\306\267\317\374ny\250\301\3671\201\032\225qKy\017\032\343\222"
+	.ascii	"\345\361\357g\t9d\367I\027I\364=\004z\213\223\316\363\337a\370"
+	.ascii	"\r\363\017[`\274\376\252oo\201)DWo\236K\206IB\235\0351U\243u"
+	.ascii	"WJ(c\302\301\202\217\024\265\231b79\314?\016\251\200\335a\246"
+	.ascii	"\022\356\334(}\224\25387\3772\"\300\025\276`\240\022ub\276\227"
+	.ascii	"V\353\037Q\215(\375\t\301\320lF\003\370~\374\226A\037H\243\r"
+	.ascii	"\325\"\363\320 *\343\002\343\2115\250\270\300v\225\247W\330d"
+	.ascii	"=d\\\017F\337\234\356\312\251k\272\003\036\205\r_\350!{e\273"
+	.ascii	"\213\207\271Q\312\020\r\b\250\363\236\303\317b\234Q\003"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.80.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\027\005m!"
+	.string	"\266|\325J\200\030R:u\007\257I\272\002@\304q)q\b\rq\374g\321\030G\234`K]\004\032\315P-S\242\356\265Z\024RZT\025}\033\202\031\222\rA\t\305\345\211~$4\367\267\335\307\314\202\212*;\214\3156B\b!r'\031\276"
+	.string	"\266"
+	.string	"\307"
+	.string	"UjF\312\334\313Lp\2249\254G{\347qr\314J\226\022\232\371$\303k!Y\233\253T\254\341`=jco\231o\344G\206\317\222q\001\367N\251\205\335\313\\\300\007\326\243\314\374.=\272\036'=\312C\346/;K7\311\001\026\227\343V\231{\257\257{p\377d\236W;\374mUS\364l;\344\253\024\266~*\227m\310d\322o\247\r\232\323\215\263A\331\321\256\005x<E]E\201u\006\314\216\247\250\247'\2025\2611/{\0014\247\033\347\256\351\n\371-\243EqI\033?sI%\333\272\344\322\331\273\367\036\354\226)Y\264V\245p\357e\213L>\235qgf-f^\301|\232\0058\312\2534$\024\321\26613\213\266\251\230\337\305\265\254\032\334S\314=\367:\363\334,\357\334,\353\374\353\314\273Y\336\345\\\354|s\255\277\346J~\335\263~"
+	.ascii	"';\2578\313\352\315r\272ZFW\313\247j\271U\313V\265\374\001\001"
+	.ascii	"\220xI\376\312\354\336\2466\266{\206\216-\377\365{\375d\277\330"
+	.ascii	"O\3463\037\n\277\214sd\\\366\373tO\303\007\326\2315\241uL,h\225"
+	.ascii	"S.\303\256\317\352\344_|0\316u\r\205_\302\1772A\212\214\220\243"
+	.ascii	"^=\"\363:\251\312\2530\341\265\220p\367E5\254\"kB~\027\347\216"
+	.ascii	"\362\271\316D\370&/zJ\314\233\314\025\0035\315e\024\343Z\b\021"
+	.ascii	"\023\320v\037;\nD\212\255\231\326\005u\357\275iSq:\305x\362\334"
+	.ascii	"\202`u\035\301\372f\347\323\326tO3\361\213\322\356\023M.\266"
+	.ascii	"\337\335V\3141\312\354\272\266}\2429\222\025\217\224\366\364"
+	.ascii	"{L\212\255\230\306EVDy\315\3239\245\025\027\237\26155\317\235"
+	.ascii	"\3465\260yE\327;\255\303R\325vL\363$er\030\273\251X\247y}\242"
+	.ascii	"YE\311\232\341\232\326i\234\262\212\3141\315\256\th\3518\211"
+	.ascii	"\224\3276\213\221H\321\266\361\277x\304\255\220\240\362*%\330"
+	.ascii	"\204\217=\322'=\272\353\203\335'V\026\006\307\221\254\037 \003"
+	.ascii	"j\367\022\217d\016\272\224\024\353\275\367\001?\212\320P\215"
+	.ascii	"\232\225\214\364h\301!\030?"
+	.string	"'\210\324(8$,:\362p\004D\024$,\n\002b\310\211\241AH\350g$\264\020 \206\006\025@F?\"5\004\216\201\030\374\200G)|A\340/H\024\024\364\021\r\375\264\360\001\001\203>\006=\374s\021\004\364\031\375~@_\216I|Om\3753\272\264\235\021\273xk*\316\375Ps\032\375\221&\370\332L\013\276\266\345\361sU\360\265s\232\327\\\232\031q\364\354_!\275\351\264\321V\233\331\302\005{$\2377\252\223\230\337\205\205\216\211\316%\003\004\265{o\204\r\337\322\341\250\002\265\217\204\"\362\210\247iI\373e?\211H\245\031\322\367\336$\225\307\236\2156\363\007\020\366\310\233\356-u\022\3674\332\327\365\331\001e\250Q8\245\bC\004!5B\021I\232\264\030\220\002\241)+\017\021\3009D$\242\264\035\215\006\221xo73\326Th\0068\352ixW\035?T \275\250B*\313\240\013\n*"
+	.ascii	"H=\326\302\314F\004\006\223 ]\335\372y\024-]\332\2247>\001\346"
+	.ascii	"Md\215\320*\377\2674\037\230\370\301+\263P\227FVj<\334!\025\304"
+	.ascii	"U\226nM\223O\320\fk\275\376\360@9\321\023\207g\013\231M\320~"
+	.ascii	"\370\260\211\342\243!o\325\264Q\3027mKH\004\264;x\024\376\303"
+	.ascii	"\347]]\266z\351\230\224\275\215\217\006\363\332\277>mu|\025\226"
+	.ascii	"\374\232\321\361'\336\006\220\316\344\005\033s\001\234f\324`"
+	.ascii	"\005\007\021\006\321\202\374\030\t\246\032d%\357\256\220\244"
+	.ascii	"\350t[\314\037"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.81.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\027\005m!"
+	.string	"\266|\325J\200\030R:{\020\346\355\001\217\226\3345'C2\030\202\264\n\201+IKP\300\307\317>*\322rSV\367Z-\n)-\252\212\276\r\301\f\311\206\240\204\342\362D?\022\232\373\333\356cfAE\225\035\306f\033!\204\020\271\223\f\276"
+	.string	"\266"
+	.string	"\307"
+	.string	"TlH\334\356e&8\312\034\326\243\276\3637:f%B$4\363I\210\337:\26257\311X\303\301z\264\306\3362\037\311\263\210\327\222q\001\367J\261=\271\227\271\200\017\254G\231y^zt\375Mz\224\211\314]t\224.\222\003+\032H.\267{\357\257}p\377d\236WK<nUS\364lK\344\253\024\270~.\261\304$\225H\307\2355jM7\316\006fH\273\026\350\341\004u\025\205\025\016/<\234\240\236\236\b\332\306\302\334\354\005\324\232n\234<\246 \311s\035-\232S\332\370\251S&\331\336)\225N\337\275\367b\267KJ\243\265*\205{/\333\244\322\351\234;3o1\363\n\346\023-7\313+\264\344S\321\27613\215\266\247\230\337\3066\255\032\334R\314<\007;\357\340,\353\340,\347<\354\334\303Y\346\341|\354l\363\255\237\346J\376\335\265~"
+	.ascii	"/;\2579\313*\316r\272ZFW\313\247j\271U\313V\265\374\001\001\326"
+	.ascii	"\300\224\277:\273\227\351\255\314MC\311\204<\354\007\373\313"
+	.ascii	"\376\261\237\314g>\024\276\031\353\312\330\354\327\351\236\306"
+	.ascii	"\017+\034mA+\331\230\260J\267\304\362\272=k\223\207\361\305X"
+	.ascii	"\367E\034~\t\337\311\204\250%nG\301|E\346mR\227W^\303o\035\345"
+	.ascii	"\356\215lE\216\264\r\371_\254;\312\357"
+	.string	"\272\327\360L^\370\222\230W\2513\0064M,\261c[\b\021\023\324x';:$\n\314\270\366\365t\357\275iOq*\345x\356\340\210\024\371B\212\365\321\316\247\245i\236^\342\023\245\335'\232[l\277\273-\030$\024\332wm\3734\203,3\376(\345\3517YTWs\255\253\314\210\366z\247u\313\252.N+\303\324<u\272\327\301\246\225]\353\364\356\n\325\033\362\314\223\270\3518vOqN\367\372D\223J\222%\3034\235\323\271%\225\030\344\031^\023\330\332q\022i\257-\226\243\021\243}\343\207\361\210W!1\345TJ\260\211\036\373dOz\224\327\027\373o\314\354K\216,-\237\037\003l\367\026\237d\006z\224\024\353\275\367\001\377,H\210\206\255JFz4B!\030>'\210\264H(4$2\362`\3643\0044$\002\nb\300\211\241!(\bX4\264\020 \206\006\025?E\300!5D\216\177\030"
+	.string	"\203F)~\302 P8\004$\374\r\t\371\264\370\375\004\205?\006<\ft\001\024\374\025\001\201\301\237\216Y|Kq\3753\272d\245\025\333\210\353)\326\001Qq\032\005\222&\370\332K\013\276\266\355\361sU\360\265q\272\327\304:;\346\360\331\277Bj\323i\243\2556\263\205\013\366I>/T#1\237\013\213\035\017}K\006\bl\367\336\b\033\256\245\303Q\005j?\371T\344\021_\313\222\366\315~\032\211r2\246\357\275H\352\216=\033m\346\017 \354\2236\355Sj$\346i\264\277\353\263\003e\250Q8\245\bC\004!5B\021I\232\264\030\220\002\241)+\017\021\3009D$\242\264\035\215\006\221xo73\326Th\0068\352ixW\035?T \275\250B*\313\240\013\n*"
+	.ascii	"H=\326\302\314F\004\006\223 ]\335\372y\024-]\332\2247>\001\346"
+	.ascii	"Md\215\320*\377\2674\037\230\370\301+\263P\227FVj<\334!\025\304"
+	.ascii	"U\226nM\223O\320\fk\275\376\360@9\321\023\207g\013\231M\320~"
+	.ascii	"\370\260\211\342\243!o\325\264Q\3027mKH\004\264;x\024\376\303"
+	.ascii	"\347]]\266z\351\230\224\275\215\217\006\363\332\277>mu|\025\226"
+	.ascii	"\374\232\321\361'\336\006\220\316\344\005\033s\001\234f\324`"
+	.ascii	"\005\007\021\006\321\202\374\030\t\246\032d%\357\256\220\244"
+	.ascii	"\350t[\314\037"
+	.text
+	.section	.gnu.lto_gyroInitSensorFilters.82.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`.\003\265\024"
+	.string	"\266\245\203I\300\322Q:\256\0020C=\377\260\235J&\361\207n:\200gc\0247\335|~F\021u\271\211\352\254t\331\037\246\264\362\\\345\006kP`?7\351\3777\211\201,\210A{\200\204F> \250y+\325\266'\215\354-eJ\001j"
+	.string	"`"
+	.string	"t"
+	.string	"G\352\360\311\233\237REP>\346\374\245\\\232%\274\214\351\325~\212\037\345\356\363p\331\234A:b\314\371S1\201\360\322\277\003"
+	.ascii	"/\303"
+	.string	"\317\300K\347l\036\001>L\035K\221\023\217\222\324\234\223\266C\317=\256\346\374U\013\213\327\323=\212\370\276z:\021e\316\371\244kOo\247\272j\231sZy\275\020\267\274m\027\333\t\354\035\021\322\030pz\336\245\217\003/g\213\300\247\307\224/G\253\354\337NW\310~\234\033d\337\367\227\314\216t\313\242:\266jXT\277VM\022\325#\253vEuk\325\254\250\016\245z\025\325\340\252eTG\251\336\250\326U\377\3445D\324\373Q\2159AT\021\231Q\262\311\304\221~\373O\262\313\376}E.\020\356T\263\301Z\360\351gi\n\334p\013\2546\224p\0323V\013\363\303b\312'\027\334\003\251\b2\341M2\344\302\374(\305T7n\312K\326\226\231\321\363\214\302\263:\357F\232\303\250y\261\013\343Ce$[\335\003\371\252x\212\304\025\3229\247n]\003\277\024\222v\350\250\020\3336wQ\013[|#\370"
+	.ascii	"1\262\2053\325VH\314\251s\300W\372\222\315'z\034*\304\340p28"
+	.ascii	"\032l\027b`/-\317\254\330n\033jh\270\233\rwC\203\243\335\330"
+	.ascii	"\310\324h37\034m\345\3046\034\232\033-\203\315v\243\271~9\217"
+	.ascii	"s\203,`\211\312\267_\330\316\220\":[\331\366\204?PD\345\354\316"
+	.ascii	"\003\324vQp;\021\265[\235M\364\265\261\005\260\2151x\016\034"
+	.ascii	"0\222}5x\024\024\t\223\211\266vd_\034\354\254\316\256\035y\360"
+	.ascii	"\247\033\2565P\202\265\255U\t= \340\002\031)\252\007\026!\007"
+	.ascii	"w\261X!\336\036\340\311n\t1\225\271\345v\301\021\016\360\225"
+	.ascii	"\314s\241\003\226\310\375\301\030\001\204\266fp\333\341\030\276"
+	.ascii	"\365\222\030\b\235P\027W*\215\\\215(\216v\301d\260]\004\022\023"
+	.ascii	"\300x\364\r\370Rjg\306\243\233\255\303A(n\031Y*\026\320\301n"
+	.ascii	"\350\273*\300\256\221m\b!\332e\221y\030Z\303W$\356C\206I\037"
+	.ascii	"\214e6\221W_\001\005\341\200\245\312mW\326\003"
+	.text
+	.section	.gnu.lto_gyroInitFilters.83.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"M\007"
+	.string	"R\31504pM\322\001\240\317t\202\262\307&p\243q\254\220\025LX\r\353\220\341n\254m\004o\327G\275Y\273t\273\365\252\352\002\347\334E;\304\261\002\020D6\331;\245\326d`\234\bOF(9\033\3718\t\007\nO\023\345\313\020\030.l\342k\2000\276K\335G\333<S(\345\3524\211\021\021\206\210\"\261\177\274\316i\267s\352\203<\304\301\377\334\371a\262\323;\177Jw6D\004;5&trM\264\312\256\025k\030\366\243m\036;\022\330\370X7)\331\255ha\331\313\2018l\377b\312Vy\325\330\201\216\013\n\222\225\335}-\343\324\031\345\337\343\001\324\252\316"
+	.string	"\fv\327\214Z\026w\273\355\002\333\030\333\240\016"
+	.ascii	"3\241\255\037xe\256\201q\3000\220\"\225\005X-\316\254\032t!w"
+	.ascii	"\013v\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.84.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"=\t"
+	.string	"f\021A< \005)\035 !\024l\245E\210E\224\327m4\227\002B\2345W\002\250iO.k{\3753v\304]\333L\206z(B"
+	.string	"L\024S\016`\003\313\265\200\f\352\023\371\203l\262wJ\0010"
+	.string	"0"
+	.string	"/"
+	.string	"\266\335\360p2\352\363\221\312\211H\201\265^"
+	.string	"\354v\022\226\034\365\207\362\317r\212\325L\306\365J\375\005H\354\256\237\353%r\303\333V\260\355`\333&\217\003(1\257\317`vCj\001\226&\322`\266O\266\307\366{\366U\276rz\314\364!X\226\fdf\267c\360B\347\321\335\r\270\307\316\013\270\307\264\225\347e%\320\215]\357\262\321\331eA\264tp\034\230\234<\372&\356\361\020\204\023S\275\232\335\245\036$\261\277\355\356\032\216x{\354\207\3609tV\322hB\300\242\320\244\036\026\262\322YI\243*I\027\025\030RD\253\f!xf\214\250\324\230\223JO\267\367\006\023Tpe\277\304\035n\220\253i\005\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\325\263\214\313(<\215\207"
+	.ascii	"\352\020\306tM2"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.85.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375` \002\365\020"
+	.string	"f\236kG\360\260(\035\352\bp\270\344\2779\002X\376\317!\b%j\fg\304\247\213N\354\300bpcgX\244\326\243\215\315.\204'\274j\371om\275\310Kh\036<]\374\306v\310\243L5\032\364\272\030\035\262do\"eJ\001W"
+	.string	"R"
+	.string	"\\"
+	.string	"~"
+	.string	"\363\371\231s\206\036m\024;\364\250v\212\035\262\310\202\024\247\b\250\250n4\230\301\264d~\346\004\273\355\360\324e\334VS\376\307Ku\tZy\334\232\032\333_\356\340\253\261q\275V\276*,)@\206\363\341\343\365\255r\2439\247\325\365\322ps\267]\262\235\300\326V\352\232 \007X\272\303>\211\227\240\340\273\030u\242w\235\310\307\357_\256"
+	.string	"\2663cYih\203\237n\314\376\206a\210\303\313\301\266\032\264\251\271M-\255\216V\257\325\272\352{"
+	.ascii	"\030\201\341u\032\033sf\bs\314\030\361\006\204\355\203\"\036"
+	.string	"\235\307\234\206r\2304Nl/I\271qeO\353\346\003Mz\213\022\202\031\240M\267!\031\340aN\026\203\025g!\301wyt\211\347\311G\271\007\017\"\242\207\247%\206\266\322\3207q\217T\252\3432\034Y\316\252\360i\\\023\311\320Q\024~\n\327D>,\277\001\371x\031\3335\021\330\316\317\234\252\267\324\002&\205x'\013\246\016u\362P&%TgB2R\322\221N\250.\244\200\275\t\245SW\301\363N\035\270\3726\267\250\313m\310\331@\036!f3-\233\215\273{\301\366\256G\253\3756\031@m\b\021\364.\035}\253\362g\342\306\\\234[\020\315\244\343\320l:\214\027#\334\236\366\307\0020 \240\002\0213\252\007p\222(\254D\210_\034\027\242iyg%c\216\335\035\267\232\3518\016\332\255#\324a\230\305y0\003;$\340MB\022\034v\311d\023D\322\245+\207\005\362\326%\\\370\270^\205\350"
+	.ascii	"3\253\332\002\242v|\233\360\275\361\270\256`1\260,C\2342s\201"
+	.ascii	"\231\013o\357$t\221!\260\033\322\256\253\245s\267s\315\023"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.90.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\235\002e\024"
+	.string	"f\244\201I\300\222U:\312\320\354\351\260v\025\353\032\304\304\3009\343\327\252\200\001^\220\207\271\325\354\307~b\030o\330\272*\332\304D\005 \032`\201g\023\233\234\211\254$D\3420-\ni!\306f\223ib\b$\207\220hm\344\313\235Rf"
+	.string	"g"
+	.string	"o"
+	.ascii	"\007\3321\007\262\311MP\214-c\217\027\345h[J\333$\201\355\276"
+	.ascii	"\332\352KL\276\242\335\037\002\037H]\264\315\356\361\337\316"
+	.ascii	"\256J\354h\204L\273\313R\020\267}\212'\2256\037\205\242\332\365"
+	.ascii	"f>=\\\324m\220'\035\200^N\352\330\303\235\b\354\356\177.y\275"
+	.ascii	"\234\224(\224\335\265\334\365:\334\250\333\206\331N\261%R\301"
+	.ascii	"\243x\212\232\337c\331\213\374\356e^\274\026\340\371p\223\303"
+	.ascii	"\313\335\235Q\327\246\352\212\2074\263\204\244#'\205\330?\234"
+	.ascii	"T\035\373\247\325\234\221)"
+	.string	"=Ni\221)\255\222\322))\215\022\245\347}\277^\372$\032|5\274\336\213l\354\326\f\233\366H\034\na\373B{\324\336\016\237\211\007e~\302\343\217\244&\034\337\356\376\0270N\004!\002\013\313\274x\340E\037\233a0I\205\322\250#\"\252\322QQ7t>8\t\037\232\220\332\335\023\337\305_Ph\271\\\363\242\210^\310\003\224R\225[p\270\211&JS:\215t\"pr\350\251(=\315\220\007\335r!\227\324n\356\304_q\026/\277\347\242/\300`\363\342\324\007o\240\227D\002\347\007\350&\207\326\223\352\004\375j!1\331\013\2465\253\360\302\320R\340\022{\301f)0\264\331k\001\355\265\262\253D6\223qa\321f2Z\254\205\306\212\275Z0\226kFc\225\b\260,C\313\214\005#\223\315X\343\357v\315a0\342(\210\217\233\342\246\352\2746\215\356\273\021b\002\362\337\356\212\252\377\271\264\341\341"
+	.string	"\n\255\362\032B\257\234\306\214\006\027>"
+	.ascii	"\217\235\322\210\036h\225\313p0`\007\350\225\307x@\222#; \240"
+	.ascii	"\002\241\252\325\001\243\200\333\031\013.\357\336\035\200\331"
+	.ascii	"\304\272\210\362\"R\240v\243b\003\006\r\241\037\246,>c(\207\007"
+	.ascii	"\216%Y\260,y`\220Y\267n\221\314\217\352h[\262\263\332a(\rq\001"
+	.ascii	";\316\273\t\340v\004\217\242@\243\210\210\217\250r\\gCpO\004"
+	.ascii	"J\321\222\304\333\365\226\357\033aa \300\277\335\"Y\203.`\271"
+	.ascii	"\363\235\322iN,^\243$-\323\313\267\315S\231\267nz\023h\031"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.91.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\r\n"
+	.string	"\246\223D9@\305(\035\265a\227\027<p#\t{0\204F\312g\201\331\221\374, ~ig\265\237 \376th\272\022\300Zg\246\303p\303\016\263.\325\273i\370\256\2105\262\211\224)\0054"
+	.string	"5"
+	.string	"1"
+	.string	"\033f\252\361\356\361\322\354|\313F!ce\362\201\336c\200\305\257\0138\242H\305\200\243+\263\273W=K\240(\323\262\331]\347\007V\334\330m/\330.\260/\020\230\215\213P\266\354\320KE\331\277vw\255'\333\351\230iM\037\303\260P\300\257FvM-"
+	.string	"{\022I:l\203\354\213\021\022@\356\036\246L\003\252\024IDe\003QQ\376\365\322\023\310\323\2226'\221\377R_\202!R\357\271\273\236*\312v\207]3%\2045\312\025\373\036\377\350|\016O|\362\337\243\377\301\036\257\001\346h\264\355\323\220q\233\306y:\\\346q`x\3108\033\227i\b\254At\266,B\323\266\354\022\356\365\344\274\f\236zp\325\222\355\250\231\220\212\254\032\365\244"
+	.string	"\241la\001\021"
+	.string	"K\b\230P\307\353C\231\251\302"
+	.ascii	"c\240ZA\210\230wC\320\270\f&?\f0\226\205k\017+|\252\032\262r"
+	.ascii	"GK\216\255-e"
+	.text
+	.section	.gnu.lto_performGyroCalibration.92.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\265\rME"
+	.string	"\nv\354\03190\246N\007\204dX\330\355\030\332F\247\026\r/q\032\306\013\365\200\001\357\366\323\214\254\216+\353V\276\315"
+	.string	"\3463F>\224\337\250\234K\326M\317F\207rd\244\355n)\245\024\221\001p\001\216\001\205\312:\020\307\220Z\262+cF\n\n\304,\240t\223\241\0377\240?D\266\234{-]\362\r\220\372\306\320\206QO\3671\322|x\212)H\235\276\331\323\177|\326~l"
+	.string	"\220\320\031\263\021f$\036?\346 \205\324r\270\357p\327i;\267\3738P\267lm;1\3043C\330\266m\204^y\314\330\353\026\261\257X\276\236\203\244\345p\005\351\241]\333\266\310^\231\2210#{]\221\316\\\001\303\355\275%\255l\233\215\246\\hg\3567\235w[\257IW\265-\334 \237\266\335\223\300\017\214\275\362^g\261\275\032\373\212\355\225/s\245"
+	.string	"i-\363\002\036\0315:\206m\333~}\030\376&\3565S\371\355,\254+\253*%UrJ\ny\2142\026\331\225\370~\271\217Qfga\321\365\025\335\030\267\252\203\212\031\343U\214\240tq\346\\IT\312\021'\264m\333t*0l]:9\355)\"\205?\267\303N\236I\324\354:\250\324\245\212apx\211.}a#\323H\242\207<\273\271\227cgP\327A\267\370\221\021\224\013q\253m\333:\250\026\217J\360\205-K\033\211\020\246\200U\262\026\275M\352:h\233\027\211\016<\021\372iF\320,D\2554*e\220Q5g\033P'`\004\235\366\235v(\321\247\257V\232H\264\220f\310%\031M#JyRs\204\214:\375\373N\317\3003s\351\013[\227\366bX\333\266\354kQ\266f"
+	.string	"\315\334U\230\031\007\263\324\232rm\333j`\276mZ\322\275\343\222\273x=x\363\"]\275\013G\213J\327\204\355\265\365\244\201v\206\254\007\260\f!\342\307\361\206O\360\\\246T\362\222\251Q$\247{b\r\277!\303s\275\206/>z\272i\212\265\340\bc\333\266`\334\217\032R\211\023)R\260\275f\370\2463\247\327\365\\\274\007\332\034\210\245\360]\317\006>\353\232^e\013O\341[-T\037^\321\214X(\352E.\030\206\f\3575\031l\257\026\276\373t\203\250\240\232\376\343\261FD\303\330\266N0\356\300\253W\203\233\256\327\266\353\033l\257\t\276\377\272\001\032A\3524O\017\315\253\337\266-\363?\216y\257\351\017\307\334\215\026\365\233\362\303\245xg\024J\347\023Jg\023J\347\022\357L\342\235GT9\213xg1\245s\230\3229\204\322\031\304;\177xg\017U\316\035\336\231\303;oP:kP:g"
+	.string	";:_\250r\266\360\316\024z\257{B\377i\366z\347.\2453\327;'h\275\356\255\356k\326zg"
+	.ascii	"\357\234\245t\306\242r\276J:[\035\235\253\216\316J\2443\325\321"
+	.ascii	"9yt\236::K\035\235\221\357|D:GM9\033\245\234\213Q\316\354\321"
+	.ascii	"y=:\023\221\316\177t\366(\347^\361\324?N\2742/\270\327R\251\202"
+	.ascii	"j\025\255~\314\364\237\356\276C\206\030yI\020\024\241\016\226"
+	.ascii	"\350\246y~\360\3709\272\223\022\373.\304c\356\3452\017\024r\273"
+	.ascii	"yTT.\324\253\033.U>A?La/\026\342A|\230\230O]\032\342\303\203"
+	.ascii	"h\324\036\376C\207\367p\210W\370\026\327\322\341\373\220G\375"
+	.ascii	"\272 \037\371/\206\017\360\370\310\357'\341\204?~\361QsU\302"
+	.ascii	"Bw\354%\354\204B\276A\247{\212\212\362r,\267\313\007*\273\025"
+	.ascii	"\277r\233|\323\256\232\032k\374\250\017\240G-T\007\367\202r\245"
+	.ascii	"\260\275f|6\213\233\363\231\035\025gP\323\210\325K\330\3427\033"
+	.ascii	"v\250G\227p\323\361\245r\243\336k7\312\366Z\374\206J'ujC\363"
+	.ascii	"*\201C5\177\212\037\307\021Z\353Wf\245F|`\316Z\271X\274\327\274"
+	.ascii	"\276\0015\026\237\302-\212\234\317d?\256i\260\03421\033\017\217"
+	.ascii	"y\024\016\337x\334\246yzhN|v\313\225"
+	.string	"\246\371\223 R\356\344\242\361\242\272\332]\323E\365\347\0019\366\3317\300AkW\326wg\033o\3429\332\315\313Z\303D|\377\365\3739\375'\376\032\370$\364\366v\351=^\272z\337z\0165\224\007\271\377\3363\347\007\024\377q}\272w\013<\335\274,\377n\223:\352\344g\3758\346B\376\353\242\3065\247{\267 Lo\272sZ|\244\210\f\r!x?\363%s\315x\257\361\226\363\231\314\215)Hr\355\322E\203AC\232&\274k\276,-\350/\276\035J\264v\345\217\231]\0013\277\350I\374\327\025G\310x\360(r\306\236\375H\222\203\310\003H\231\217323\0373\204\224\375(\222\303L\307\017 9F\024\021B\026\204\354H\031\213-\031G\336\341Uf\246\244\307\327\231Y\331\231\020\262\263/!?r\004\371\332av\366\3455\200\313\206\220\231}\025)+3\373B\356\241\365\303q\030\3327\335\262"
+	.ascii	"|\036<7\017\353\366e\262Y\017\340%<\247\3151\357\273L\004l\347"
+	.ascii	"\346ae=\223\351\234;\275\306j\341\335\313G\202\313H\324\302O"
+	.ascii	"Wm\240\b\272r\300b\275\207\342\243\252V\023U\333\001{\365X/ "
+	.ascii	"P\255M\2053/)--y\257]}\017rk>\323j\007k\365f|\203z\016g\307\362"
+	.ascii	"\3222\3232\023\333\253\325s\220\206\272k+\341W\275,d\231\227"
+	.ascii	"\235\226\237\272\257\260P\200&*}UR:\305w\234\366\266)\241\342"
+	.ascii	"\314\3411w\223"
+	.string	"\342{N+?\216\243\006\223`\377\203\016EBk}s\"Ru\265\326\203}\337i\031|\206\252~Xi\315\242d\325\243q;\376\223\320\346\3361`s\347\nP/|\362\253\236\r\364<\323\3547Ir\366\332\226CT\253\232\234m\213\246@\371\027\236@\340\263\216\352\225\317nZ\036z\232e\265\216\352\331:)\247N\312CNpS\226\322\360EJ\276\233\211\3632\367nA\030's\347\350L\275\324'\277\237\206P\374\224\tB\322M|\202u\bO<\n\023_\342O\210\371\0301&H|\211\021OB\304\217\020\304+\\.\214\210oAq\374\327{\250p\367\256\363\274\201\220\"\246\351\023\201\027\250q\034\005\035d\210DDD$I\222\f\007a\005\304\030F%J\017\021`\261C\354H\022u\356\350\220\030\326\275\240\275\342`>\362\375\324\345\030ga8p\177\020\360\307\013\276$C\207\373\013\210\346\327\206\326"
+	.ascii	"<\037z\341\022\224\230{\223h\264*I\335\330\260Yg\to\240\322h"
+	.ascii	"\363za\023\245\031\352M7.\225%\313\264\261\270\3127pl\333cT\220"
+	.ascii	"\376\333\031\346c6c1\272ENT\177#\346\026\334\367\265J\311S\b"
+	.ascii	"\036\017\215\002\242^;\312\024G\324\272\001QFj \235\340\331\222"
+	.ascii	"\"|=rg%,\275\335\204\225r$\302\b\252t\355\250<\375\013\254\035"
+	.ascii	"xL\373\311Rh\210\206+\340>\222mrzK\302\211\306\023\300\214\023"
+	.ascii	"Y\027h\254n\355\205\003?\271\021\365\030i\031\221\031jw\205r"
+	.ascii	"F\355\240\340\330\261@t\347\206\265$\261KR\350#u\022\252\365"
+	.ascii	"\013\021\025C\311\274\007\354\007\255\207\006_\2249\033\223\217"
+	.ascii	"\243\244J\271\324\252\204\216\220\361}\276\367O\002*P`G\342\275"
+	.ascii	"\017\252\362<\256D\336\n\324\271Y\242\343$\306\332\330\311\255"
+	.ascii	"e\273]b\022O\355K\\\366\201%\262\202\220\036\321]\032"
+	.string	"\236\242\210\356\224T\253)\226ixB]\020\226(\213R$v\206\215\303\314\257OT\365R\234\263vR\206\310\020\212\347h\205\2230\257\013\023yn\325m\336\201C\344\252\354\365Q]\321\250n\372\217\316|\312\b:\341\\f\fL\377-\274\f\264?\225n 3\220\371\205w\343\\m\273\3022\316 \035\312\n8\341\370\306\242F\325\017hL\027>\201\201\253\235\247\326\313\326\205=\311\0066\032\f\276LD\n%\376\221\260\367\250"
+	.ascii	"&z\371\206\203\374\224\f\301d\206\be\025\211\004`\t\2771dc\020"
+	.ascii	"\243f\233\3265B\200\377\255#\007B\320\245\322\007\200\017\007"
+	.ascii	"\030\n\200\372\334\363,\257`>Y\236\331\360c\201\002Z\253\315"
+	.ascii	")\302n\312\3031\r\225\277Y@QB\256\374\340\275\033\245\344:%R"
+	.ascii	"\2264\324D\317T"
+	.text
+	.section	.gnu.lto_handleOverflow.93.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\"\004\205\032"
+	.string	"\266/\247J\240\230Q:\300+z\350\372bL\335!\376^\310jb\333\271k\325\370`Y\2062}\370$\231z\203\036\376\351~8\267\225\020\365\t&\031vRX\177\205\361\360H\243\002Z\220&\3378\350Y$\037\253\233\331F\310\336Dn\231\002\216"
+	.string	"\204"
+	.string	"\225"
+	.ascii	"L\"\266\211z\"1\342)Uuw\202\245\207\360O\337.\331\326\306\317"
+	.ascii	"Y\335,\256r\304\2456\340\316\177k,\317\266\275\021\373\322mD"
+	.ascii	"\344\251\333ws\004\342\322\373v\246.\0257\246.\275\355\177RC"
+	.ascii	"\242\201rxIBMV\335=r\213"
+	.string	"\265\255\030V\n\362\264}C\035V\t\035\320\212\241NH\200\005\221\212\255IR\250\310MJb\202.]\320\344\227N\b\264\351\356m\332iB\207\2333\324\351\356\317\022:\242=k\377\237\370\377\341\007k\002NH?\207\335\021\023\273\233\201\016\013\345\003*\027K\277#\352\322\345\005KR\226\354x\275\333\274\372}\270\311G\377\202\315F\177\235\247\t\347e\326\306n\3142\355a\266\267\373\022\316\277\350\274K\235o\251\363.:\337\242\363\254:/\326\371\220\316W:O\353<X\347\231\316O:\2775?EC(t\333\004G\367\320\325\225>B\241\222\226i\367\337/\216\315\361\273\356\263Nw\260\233\262\362\371]Kw\233\356\372\037E~^9/v\260\233\242\322\273\257\273\251K\013\273\270\270\245\305\256\r\262D\206\b\331G\325\245-)\245\005Y,\023\231\305\225I\310b\345\220\027\313\315F\3757R\001\3419\200\364c"
+	.string	"U\345\355\355\214P\201\232\335\r\304|t\030\246\234\341F\221\240Y\345 S\246XrU\314 o\316j2\363F\345\244n\363J\301\372\370\357\006\251\273\033\374\344>\361\030\240\372\t@\232\2741vF\224\240n\277u\022\324\335\037\020\324}+\260\f\303\263G\016\006\356=\313\343\277\r\337\200C\306zj\243\254\214\305J\030"
+	.ascii	"\262\266#\241F\322H\t>e\007\r32D\204\031Z\0052\326C\241&#g3\020"
+	.ascii	"0\227\t\255\303p\312\231\b\236\2216+i2\2226\312zvb#lF\033q\002"
+	.ascii	"\274\364@\316\306ZY\316F\227\357\266`\263\221he\305\221\033\343"
+	.ascii	"\304\030N\3623\303Z\232\362b\307+b_7P\310G\030\352\177a\2470"
+	.ascii	"\2104\033c\267\204F\024\233\356\256|t\316=\355N\245\341\242\241"
+	.ascii	"$$P\224H\3110\r\327H\021\312\362\342\030\226\341\315\261\240"
+	.ascii	"\f&U3\204\234^\340`\033T\250a(\006\215R\220Q0AA\232\202B\213"
+	.ascii	"\001\260\002\241)2\017\020XFb\223\264\030\232ibI'\006F\352d\344"
+	.ascii	"+\223\001\231\025\213\017CK\361\305\324g\363k\354\003oq=\336"
+	.ascii	"\206\036\220\b\345\374>,\342\004\214w\024\2706\0079\333Y\350"
+	.ascii	"A\020#6\"N@>#\022\007\213C!\316\201'@s\347\025\177\211\326\330"
+	.ascii	"\336\202\375\341fR\b\017\374\226ob\260\204\226\2174lz\374\267"
+	.ascii	"\223\372\207\241\327\b\371:\223I/\351W\215Bg\330\256\241s\034"
+	.ascii	"\300\227\217\317\261\246:\247\301U\342\246\223_\005OGn\t\201"
+	.ascii	"#\375'\261Rj3K\r"
+	.text
+	.section	.gnu.lto_checkForYawSpin.96.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\030\004\345\033"
+	.string	"\326p\256H\240\232Qc\305\227\234\004\365@\374\t\320\234g\275\027m\316\237P\017\367\037\236TE\351\2331\311\334\235\025\374\227\b~\315R(13/\276\342(\251U\030\217\234\216\363x$\371\241\307c\237Y\240[A\354n\262\367\2262\245\225"
+	.string	"\220"
+	.string	"\233"
+	.string	"=6\354\345a\266+\361=x\367\341C\312\256\217\310\204\203\363\345\r\371j\177\351C\336\231H|\346\336\031M\242\356%6p\202\363\245\211\2471_\236\007`\2764\317\306bS\342\3768hR\n\002\222u\357\235Y\032\347\035=]fI\332\312\363_\300\237\243\256\234\263\200+\250\232,\236~\265\274\224\024-\310\233{/\fX\242\222\036\232\232\264\310P\321\342\226T\020t\262\"\006\364\2214Q\210\254\334\351\365\004\260W\253+\347\336\353*\004Tq\277n;h;\204M\326\272\363\336\373\300?\262\253\235G$\314\227\267w:\202\033_\256\202C&\240\272e\023{\325\026\331'\257\235a\243\3253\257j\331\253Z\346\254\216\241\3251h5\314Y\r{\361~\235\325\250\253\372\274\217\337<\323_\232\325\325\254~"
+	.ascii	"\002YzU?\232xX*\304\213b\313\313\245*\245l\274\370\333\367\201"
+	.ascii	"\274H\317\2118\202\320\2304\344E\377\351Bx<\377a\013\324B\n."
+	.ascii	"\335{y|!\206\231\347AF\334\370\210\367\350E\304\345\270\264\340"
+	.ascii	"\245%81[b\375\254`l\214\375/\013fa\354\215\374\246\374&\2372"
+	.ascii	"\024\203\343\275\027\302\213\326\371\223\013\007\214^4\206;\311"
+	.ascii	"Ps|\351;\211\371\022f\217C\b\245$\005\365!\216\371\356\0052\200"
+	.ascii	"\332\227\255F~H\275\272\345\323\242\326\346\312\317\352Ek8\223"
+	.ascii	"\r\347\275\276\007\276\222/\341`\357\320\352\205h\366Oo\360\343"
+	.ascii	"\345*8\274Q\027\253\250\262\032\253\275\326Q\360EE\202\025%\006"
+	.ascii	"i\213\242n\247\227\2429\336\205\020J\322\325k\b\005\251\254u"
+	.ascii	"\346m\007\247*\276\332\305\366\207C\005\006\201\223\332j\273"
+	.ascii	"\331\rg\263\341h\002\322\335N\205]\252K+\334j\"tF\354\364\310"
+	.ascii	"t\027R[\315\302\356\226\346r<\264\030\235\227i8\270\\\317\207"
+	.ascii	"\231.\207\323\335R\335\354V\333\261\315h9\335\fg\200q\"\322\334"
+	.ascii	"l\207\303\345f0\"\320s\200l\0175\355\024\037\232#z\343K\216\340"
+	.ascii	"p\350|\321\351\253t5\307\343\020\032\263\256\\C0>\301\234\261"
+	.ascii	"C(\252\374l\251\222\331\031k\203\025\244%cM+\263/rR\307\024+"
+	.ascii	"\035;\202 \365(\234\312\347\224\261\021\204F%\033\207IF\246-"
+	.ascii	"r\314\276l\007\247\251\030\033U\250q,e\f\202\f\032\211f\322\204"
+	.ascii	"I\232\003P\0021\306\360:\021\300546S\320\3022\006@\344\\P0E\022"
+	.ascii	"\017,Tm\017\276\177\204\221\256\001%\264)\237\367\267\214\321"
+	.ascii	"\225\f[\337_TX\304|\307\344\023\"\0313\264s\n \271\365\357\357"
+	.ascii	"y\373\f:\215.E\022T\244\363\375\230\205G\223\375\360\326.4\353"
+	.ascii	"%\313^D\203\210X\344\004\243P\252;\253IG\031\341\273\217\217"
+	.ascii	"h\306\340\312\177\314E\212>\335\371\007\003K\376\021n\0250\337"
+	.ascii	"`2\320\276Z\322x\267]\231\311]q\203\241\331\027\265G\206Q,\227"
+	.ascii	"f\360\017\222\241\242\321|\b\216\0353\335\350Wt\003\024\375\037"
+	.ascii	"\352(\317m\324"
+	.text
+	.section	.gnu.lto_filterGyro.97.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\037\004\375\030"
+	.string	"\346+\232H\240XU:@\366\212\365\351\242\234\311\305Wp*\247\241-\001+\006\274}\341\323\216\037\306\203\2551\320\376\242\232\302\353\300~\377\205\026\241L\036\267\216o\001\255\234\312\023\343?X\205\367x\316`\335-\251\255l\210\020\271S\n|"
+	.string	"z"
+	.string	"\217"
+	.ascii	"\377\271h\334\0379B;\222v\267\346\244q\312\223\004\306\253l\177"
+	.ascii	"\332\027:\257\366\036\211\257v\203\206\212\354\372\f\030Ay\322"
+	.ascii	"\276\267L'\313\263L']\263\257\334\267\333\0055P\004\265\354\256"
+	.ascii	"KgX?\372\356q\326N\216:k\376\t\207\307gnh;9\002\330\335\227\234"
+	.ascii	"\211\361\300L\221\303\315\361F\213\353\201o\301\370\031\005\311"
+	.ascii	"\265\370<\341\354\256'P\216\305m\272\355\037\333\020\354Q'E\331"
+	.ascii	"\203|(w7\001\020\f4\232\035\215\223>\t\323\311\353\207\017p\224"
+	.ascii	"\244\343\035\271\315%\325\335\265\251\312\260}\266\371\325 {"
+	.ascii	"&\246\305Z]x\303\274\367\277\374w\253\310\351\224N\243\310\351"
+	.ascii	"R\247O\343\264I\247\311qz\324i\235\323sN_\200\256@1d\rwW,q\331"
+	.ascii	"(\344\221\032\027\376?\373A\177h\225\320\304q\177\334FO\310A"
+	.ascii	"y\237\017\264\352\244\335\343>j\001O \234J1\2452E\021>\005\245"
+	.ascii	"7:\224XZ\252O\332\222\362s`1\212\316\235H8\224\tC\273Re\210P"
+	.ascii	"\270\223\223\336\350\330\261R\223\232T\026\223%\025\256\304d"
+	.ascii	"\341IH\275\311\241\324[M\030\035\325\252+\255\020\303\204\332"
+	.ascii	"\354\027\2058\020\210h\347M\024\360\034I\017\221\242L\020\310"
+	.ascii	"\305\355u#>e\251\252Xb\350xS\2570\372.'p\340`'\232x\242\241\017"
+	.ascii	"\231z\242"
+	.string	"\243\336m.i\370\020\023\023\024wW\201\275\341Bb6\001\031\032\3440\220\315F\370\2244\230\b\236QB\312=6\034<\304`;\263\027\b\016\260\f;\262\331\b\037\027m&\243ux\321\\\035`<1W\317\214\346\262\241\261\314\303k\346\002!\223\315\\*\337\376\253A<\236s#I)\351\2468Re\030\205\2443\252H\263\346*Ma\340*}\226\037R\211\271\345\343\356\356\350\002W\351\214\016\301\370\031\tu\270\271\344\030\265b\"\315\203#\305\006\354\216>\264\212\027T\344\320\361^\2644\245Fi\214\321\317\203\273*:\017W\250Q(\247\240Sfff$i\322B:\300\002\031\252\232<\021P\261r\252j6)\227\003\343\005:HE*\204\304v\316-\023\224\016$l\026\315\b|\303\231\214\345\270\310\266\362V\335X\373\020\003\022\214{2\275\245\323\217(x\006\016\311\367\200\216\207$\324\223J\222\207C"
+	.ascii	"\246\245\030\365\335\347\243\265\362J\032o)\222\201C}\212?\305"
+	.ascii	"\332\216\001\027\343\276\037\207\356\003\005\006\022h\322\242"
+	.ascii	"\032\222\345~)DE`O\220\330\276\327\177k\032\016\230A\314\301"
+	.ascii	"\2523\372{\224r|\361\300)\f\202\375\211\346\377\256\203\006\034"
+	.ascii	"\264Z\325\366\302\215=P\"&YP\001"
+	.text
+	.section	.gnu.lto_filterGyroDebug.98.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\177\006\215\""
+	.string	"V\274\323H\200XN:\377\366\311\242\315h\"\201Q'\334B\272\356\332)\312\241\021^\251>\266\027\366\234\347\023\377`\333\213\212\230.\020?\263J\365\277\331~\274\372\363\303+\032\3228\027\005\367-q\270\r\231\356o\326\210%\204H\231d\273"
+	.string	"\255"
+	.string	"\311"
+	.string	"\037\333\336\317]\261\013\031>\271lf53\372\362\212\253\265\026\370\271D\351O\001\346{\273{\336\375\327\301\206\017;q\234Z\263\230\030\251\025y`\023\244?\027\371\035\364gz\035\364\347\016w\263\034y\254\r\270\242\310\300\324Z\177\215c\373&\362\313\343\341{\274]\252CO\263y\270\327\021\0059O)\223V\210L\021\3373o\334\244f\230\b\236\230w\203J\306w@5\250\254\236\336M\312\n\210\207T\025\353b\034\215J\301\347\213\233&\201\253&.j\246P\230;Ql`\271\362\274b\n\212\373c\347#f_r5\250d\234uD\265\326e\343\024\325w\346\273+ew'\354\242E\001JG[Jk\255\n\316(0\275\310r\353\004\372\223\373mojE\236\373\213\312$*\314\326Z"
+	.ascii	"\007\242o\022\3117(\016\263\373!'\002\334o\255\207&\276\361\347"
+	.ascii	"\276\t\375\371\276\362:b\313+\260\252\"\317u\255\225\330\255"
+	.ascii	"\265\213$\362kg\355\372\202\200~|^\366\355y\330\317\363\3447"
+	.ascii	"\247yqN\336\033\346\265IykP^\232\224w\006\345\355\351xy(\357"
+	.ascii	"N\307\233\242\274\272\346EO\336\323\3445M\336n^f\336\017\350"
+	.ascii	"\026QJ\035e\255-"
+	.string	"\346\306T(\247\032\327\313\376\344\356\311\366\312\355\225m\232Y\315\256#\354\013Bz\344\006K-\303\036w\322\365\270\341\017\264\343L\363\234y=K\257\207\272\274|\232\327\273\353\037,W\206@\016\307\033\202}\271\353!\037ra\002\270\247\323^]\373\264\006,\024M\334}\025\021\0373Ry\360&E\237\002\341,m\0362#\214b\204\273IHS]7\027\254+\2600\035\n\345h\301\361\311\215[\316F[G&\252L\017\367\364\356\204\n\350\215g\243/\260\240\232\210\242\177\023cvwO\237L\n\036O\026\316d\323\276\266\\b\366\327\336\302\224l\232\202\013O\202Ah\211\304w\254\265v7]y\251\235\334kG\t\256\366#\031V\003\007\276\221\003\372SG\305\270\245\310s\033n\344\350m\313Z+\203]\244\247%\235\355\030\035\212\214\036\004\205&\230R'`\211$\363\002o\225\204>\204h\002\"\t\227F|"
+	.ascii	"v@\n\nM0\375\234\204A'\020KN?\020\300\244\246\237\222\320\351"
+	.ascii	"'\344\333`\210%\341oD0(\374\365\220\365\257\235\025\344F;\342"
+	.ascii	"\344\342\212\375\324k\255\335\301\355|\335p\\\3409\275\342\300"
+	.ascii	"s\372^\222pP\034\346f\255\265\362\f<\247}\375\2613\032\215\244"
+	.ascii	"\225\262\253'\236\333\240\346\247M\363\rsp\021C\200#\023w\226"
+	.ascii	"ber\274\303\231;rP\346\246q\232\347,\350\246Q\253\264\017Dm\302"
+	.ascii	"\3304\003\026[W`U@]\323K\323A`\202';~\031\366x\033\327\275,k"
+	.ascii	"\232\207m\307\273\320\364P\227\334O\317\364\366\032hK\360c\001"
+	.ascii	"\200\202\250Q<\304\030d\204FF\202\202$-\244\003\340\002\221!"
+	.ascii	"\252m\021 1c\212\325\f%\225a\f\343\024\350\200$\277\276\266\032"
+	.ascii	"\300%\335k\023\244\356\314\020]\277E\302\270,71\270;|\330\274"
+	.ascii	"\207W+\032\344\021\372i[\3558*f\270\304\320D\247WXc/\261\251"
+	.ascii	">\374\016\372\215'l\267\200c\373\372y\036x\274\007\335\323T\316"
+	.ascii	"\031\025W\220\307\0267\023\246\233\027\002\033\233%-\262\225"
+	.ascii	"\027\346\350\271\351\347\002\002,\201\263\377\213\227\344<\355"
+	.ascii	"\272\241K\207d!\314\r?1\370\222\361\023\304\031]\203\007\356"
+	.ascii	"\021~\332\017\236\300,\002\216\367\313r\322\264\2734i\003\002"
+	.ascii	"\260J=\b\230x\303\004u\216\271\024\016\222\nL\316\261\304\026"
+	.ascii	"d\346W:\330T\350u&\202\236\307vGc\035\247\021\272-\341\346\375"
+	.ascii	"=\303\242\027d\277\240kd\203\335\0025\202\203\221G*(\bW\212O"
+	.ascii	"\367\230\276\016H\005"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.99.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`F\003\265\031"
+	.string	"6/\251H\260\232Mc\270\335\360\307\227\352a\254m-\250$Fwn4\342B\310p\202\376\352\306\264m>\212\027iI\363\240u\264\275}\017`\204\340\237\241VQ^{\004\376\243\f\326\224\210\351\006X&\006\035#\333d\357-eJ\001\217"
+	.string	"\207"
+	.string	"\234"
+	.string	"95\364\306hYq\201>e\335\213>xh\013vE?\304<\021\025\340\200{cz!a|\230\003\276\332\177\372\316<o\305\t\334\333D\265\344^\024\202\033\214\017\215\036G|8\336F|h\323\346b"
+	.ascii	"\351\326$@\221ia$\353\336\353\2628n^\fA[M\277v\361\276\203?t"
+	.ascii	"T\347\225_.\351\341\230t\260&\207t\253\026t\240DE\203\314\235"
+	.ascii	" N\025\223\226\373^a\344X\324\332\242p\357u\305\345d\334\255"
+	.ascii	"\333&a{\310\266D\001\341-9\325[R\332\361l5u\200j\017\021\325"
+	.ascii	"\343H{\337\037\304\227b\205\301:m\315F\317jo\330\267i\232\246"
+	.ascii	"\266M\366L\365\315\211\3746\357"
+	.string	"\3355\347\3754\217\272\311\231\352\021@uk\254\006\307j\333\252\256b\365q\030\2149\255zPe\354\025\364\306H\307\334)\341\024\217\367\376(\037\311\1776i\243\037\261\225\321{Rz\272\367\222F6\371\3607r\237I\333Q)rn\350\315\221g\232\225a\2140\301|\357(7\266\006\r\246*/VX\376s\205G\341Qp\3653\206C\351)\240\273\367\266C5\302\307\327\221A|xc\377{\003\037V\252(\355x\377\021m\r\177\362\203@\347D\300\325\223tQY_l5\255L\300T-\331\037\2115\326\332z9\212d\271U1.PA\353\007\211v\007\017\3658\347 \331\232Ik-h!\260\350qZ\033\016\2611c\212M\255\326\2675\326h\351\366)\024;W8&\357U+n\301%\331 \256$\204\316\225-\364$\257\361\336\273#5\002\266@\247c\205\370\263X\t\330\021\017\255|\321\202.T\300"
+	.ascii	"$\364\003\364\241G(\250g\203\217\006\037\016\bD\274b@/\332K\304"
+	.ascii	"8\353\0203A\304\201V\024+K#X\200\240\031\303td\345\321\220kV"
+	.ascii	"\312fE\261\231\253\210\350e\302\005+g.\235\003\226\235\210\225"
+	.ascii	".\232LV\272H\324v\333d\n6{\202\367\336+:\250\343\016\223G\313"
+	.ascii	"\216\366R-\312\330j\352\343UL \243O\345Vf\020S\210\351T\2173"
+	.ascii	"\235\304\207-{,]\023'\236\273ta\232\n\023T\033KcmsgB\205\266"
+	.ascii	"v)\347N\n\344\021\003= `\002!T\306\033g\021\230\242H\207\246"
+	.ascii	"N\026q\204\255X\214\364\306\250\221\345\033&\n\301<\036co\370"
+	.ascii	"Q\351q\351\211\rZ\321|%\0063S\201\035\350Nm\013\377k=\027_\036"
+	.ascii	"qp3\036\254q\236\272\332\264\300r\256%\022oK\226\0161uh\f\226"
+	.ascii	"\250:\230\212JWp+|th\345\006k\314\006\235\271\211I_\3232\243"
+	.ascii	"\262=\t\211'+\270\374\034\213\315\265\375l\243\270,M\214\006"
+	.ascii	"\273\204b\271\310\257\252\032\322\277c\232a("
+	.text
+	.section	.gnu.lto_gyroUpdate.100.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`>6=\227"
+	.string	"J\337\3300C\0200S\247\003\207<\035\025\206\300+\036\255\243\251!\350\"\210\213/\032:\215r\374\271\220\303<\371\240hk\360!\247\315_\331\360\007\273dv\274\204\307vZ\r%\342\320\343\"'\265\036\365&r\357\224R\n\343\002\264\002\036\003Eg\025Eg\251\242s\212\353\214\342:\237\270\316&X\347\022Fg\022\327y\304u\026q\235\243X\347\020Fg\020\327\371\303u\206\272\316\036X\347\016Fg\016\327\371\310:o0:k\270\316O\254\263\223\3219\303u\306\300:_0:7]g\013\254s\005\326\231\302\352<\241\350\314Tt^*:\033\2573{\235\213\327\371\256\316\253\352\254\252\316\257:\273\352\334\316\365\004\227\345\254\311"
+	.ascii	"\333\226,\261R\033\270\362\261i\275n9\346==\356s\366A\221l\236"
+	.ascii	"\235 <\251Biw\025\244}\247\353\230\231\270J\323qWzFb\252\302"
+	.ascii	"\314\324\353\332s\314\304\314r\032t{\326v\030\235>\225\034\265"
+	.ascii	"m\273\242W\236\301\366\312\314\355\314M\247\353(;\316\n\033\333"
+	.ascii	"\266m\016\237\266\225\243b)\266\327\250~\272\275\252\235\341"
+	.ascii	"\366\312JfF-\347l\241\372P\272b7\251m[\253o\362\267*\327\314"
+	.ascii	"\201\\\331,\210\0031 \036\304}\374\207\3750\037\367a>\034\345"
+	.ascii	"=\274\307z\254\207\3638\017\3431\036\276c;\256\343;L\307s,\227"
+	.ascii	"\003\013\307\325\r\0335h\314\220\021\003\306\013\027-XXUQM\255"
+	.ascii	"P!\225\002\305\t\023%H\214\020\021\025\002\304\007(\017\0358"
+	.ascii	"\0347hxr\312\200\341B\223\205\n\024&0-\031\331\342]\325w%wQ\207"
+	.ascii	"Q\314\214\253Y\220\332\304b\215s \247C\200\232\314\260i\036\264"
+	.ascii	"\027G]k[B\235\373\370\217\2324\316~\336\232\371\336\334\234\373"
+	.ascii	"<\233\371<\235\316\3211\315{\306\2609\357\211i\326\023\263\346"
+	.ascii	"\254'Ls^\0300\316y\324\232\361\324\322\234\361\2205\337\221m"
+	.ascii	"q\266\323\322\\\247%\213\363\235\261f\27211\347\271\260f\271"
+	.ascii	"0\325K\333\022\213\347Hl\254DD\307q\330W\207\225\374\206a\333"
+	.ascii	"0\244\3445\246Mc:\311g4j\031\215\030y\214\302\206QH\350/\026"
+	.ascii	"\271\213\242\2163\021\272\305`\263\030\264\002\224zUw\025j\252"
+	.ascii	"BS~\177\276\002\256\214\220\253\020\001\004\227J!\310QD\373D"
+	.ascii	"t\217\233\330\353\022{zNBO\217\320\223\347\"\362tT\036<\017a"
+	.ascii	"\247A\330\211\363\017u\032\252\016\035\3670\247;\314\201+\223"
+	.ascii	"\343\034\240~\214\323\033\016\225\305a\343\032T\26463j\372I\215"
+	.ascii	";\245\351\fi\336\034\203[_p{z\223\263-8\307x\005\266\246\300"
+	.ascii	"&\306'\2545\323Z\030_\002\323F0=\327\"\340\312\324\234\025\321"
+	.ascii	"v\226\326EU\005\233\037Z\037*KS\237\f\231!d2\273\342\027\252"
+	.ascii	"m\251\006\314\327.\255V0\373R\243\346\332\307\314\274\374\007"
+	.ascii	"u[\331\232%\263\345mj\333\326\251m\251F\365\242\216\266m\331"
+	.ascii	"\305\314\316\232\025h\346\353\210\231\223\314V\323\321u\311\213"
+	.ascii	"\033%\234\3027\216\306e\351\273\203\347\336\324\370\354en&E\351"
+	.ascii	"\201\022\216\267\230\022\316UB}\213\024V\213\361\373\203\247"
+	.ascii	"\0364\216\37511\017\363\245_q0\377r/o\356\273\275\262x\240E*"
+	.ascii	"\347\3626\221\252\017+\031R*N\371\356O\342\350\007\345\234\226"
+	.ascii	"\204t\202\324\221\224u\224vv\354\270\275>\244\251~\304Q,g\333"
+	.ascii	"\2664\230y4\t\310\030>z\204$\225\264m[\031\275:\272\337\223\236"
+	.ascii	"wP\276.OT\237\311@n\343\375\032\332!C\217\020\rz9%\356<\376\321"
+	.ascii	"\205@LH\3638H\023\n\331\340l[/\031\275.j\274\357\274\226r#\230"
+	.ascii	"\210\255N\234\006o\272o\272\036<\302\266m\227\242\226\022\341"
+	.ascii	"N\323+\0339r\344.\320\200\267\030w\0364]\002\277\236\213\333"
+	.ascii	"\257\033\315Y \227\037\262\\\333\266\217\210;\221\213\020\310"
+	.ascii	"m\250\345\264i\311\374q\027bFl\333r5\033\367\207&\323\372\tk"
+	.ascii	"\323\266\255T\023\342fc\235mY+\327JE}9\"s\013\352AH\222(Qr{]"
+	.ascii	"\177\351Y\007MS\037P\213\221\360\357\257~\203\261-=\221\377d"
+	.ascii	"\3757\2323\021\232F\367|\355\305\2118]\363\357;\357\207W\020"
+	.ascii	"\373\233\356\375\033\254\315\262\243\315\307\nw\032^\302\304"
+	.ascii	"[\214\311\355\265\277"
+	.string	"Ap\"B\323\272<\221Yn\351\317l\333\226\213\377\f\363\222\263\267\211\210\201x-\327q\335M\267\266\344\334aZ\257\271\301\250\245}\361\322\005\215\313Y\321\271\315\312\310\266h\3112&\026v\235\033\313u\356+\254s\203\031\235\373\353:\267\327u\356\345u\356.\326\271\271\214\316\335^g\345u\346\340:[a\23570:kp\2353\270\316U\2563\025\326\031\003\243\363\005\327\331\202\353<\345:o\261\316ZFg)\3279\312u\206r\235\237\260\316N\214\316M\256s\005\2543\005Fg&\327y\002\326y\211\321Y\202\353\234\305:G`tVr\235!`\235\223\260\316\017\260\316H\214\316\016\\\347\006Xg\006\214\316\013\\g\005X\347#\254s\002\253\263\221\242s\221\2423\221\242\363\220\2423\002E\347\003\212\316B\212\316\006\\\347 \327\271\200\353\f\344:\023p\235\177\\\347\001\256s\362:\013p\235}\\\347"
+	.string	"\2563\362:\367`\235y\030\235\001\270\316;\256\263\216\353\234\203u\3062:\343\270\316W\327\371\306u\266\301:\3270:\323\270\3163Xg\031F\347\030\327\031\006\353\374\302\350\354\342:\267`\235Y\030\235\255\256s\025\353L\305:O\255\316+\002\005|\020 O\300\027P\206\314\0306 \352\232\032F\005\243\252\021P\t\312\367\343\277x\3512\300\377H\276"
+	.string	"?\300\231Y\031Y\222J\325\242fQ\307T1\001\246>T,\352\025\025,\332\254\266m\027\211"
+	.string	"\336\307C\t\202\301!\277\307\007\360\307\275)u\311\321\006T\273\220\035H\345JvTm\221\337\200\203|\217\310Q,\351\037\"e8\277R\262\312\371\206=\276)=%5yk\210fX\246\216\177\374\264\216\203\374$I\336~\327\251H4,s\307?\036\322\035\007\371\022\376Q\342\367\335\217\340\250)\350\013\237\260\031\350PK5\373\244x\fJ\001x\036;"
+	.ascii	"\320\3619~\207`\"D:\f\005\002\026\312\221\202/\021\005\226\337"
+	.ascii	"\023\302\361XW8n\274\215\277zA\037\b\320\215?\357\007\331\202"
+	.ascii	"|\311\376\353c\343\004\237\241\211\032\321=4\276\306\037g\320"
+	.ascii	"\320\223\227g\306\267^\2119I$d\340\271\213\3612\376\b#\306\235"
+	.ascii	"\247\3739\030\337z#\346\036\211xaG\331\274\3728\027\377\342\213"
+	.ascii	"-\\\374\0349\3208-\276\353\242\3264\n\301\342\003e\363\352=\260"
+	.ascii	"z\026_\254\262z\270w\363m\330T}\327\201X\263\350\3033\253^M\032"
+	.ascii	"\267\247\263I\005\265\236\355Q\344\341\231\177\346\333\276\314"
+	.ascii	"\223\0313\325a\305\213Y\361T\236\204\3204\016\317t\265V\361a"
+	.ascii	"T\274\215\247\242\351Q\352\325\376\213\024\326\213\324w\007\317"
+	.ascii	"\020\240q)\036\315\003H\320?{\263\024\211\246(\236\354\267\274"
+	.ascii	"\226\037\023\013{,(\246'\036\354\277\336\213\352\273\236\353"
+	.ascii	"\333\304\023\200P\023\177X\311\320\247>\311%E2Qh\272\341\231"
+	.ascii	"\214\272\003\033q\341\361\017/\001\217\203\370#\022\002\277\361"
+	.ascii	"\334\2217\"\322E\022`K\241\201\244\241\304\023.\"\361%"
+	.ascii	"F\220\020\361Q?B\252(\004\021\211\020\0352\024\365\304\327s\234"
+	.ascii	"B<\240\262\231CZ\b\304\207\370c\341\007\020P\357\341?<\007;0"
+	.ascii	"\270\345\027'\304Q\267\223\202\220\354C\351 \250w\273\301\270"
+	.ascii	"@\034\355B5\007\204l\301\276d\377\371\037\017\337\205\317\f0"
+	.ascii	"\340`\350\360}\370p\370\016\177<r\330\323\323s\374\326\2730\367"
+	.ascii	"\246\351\231\237G\331\354:<\r\277\341\217O\032\3548\332z\322"
+	.ascii	":d\003r\372\235\247o=\013\317\344\r\215\344\262\251\340\364r"
+	.ascii	"v2\274\023\206\ft\346\310\201b\370\256\243\260\246\337&\\x8\312"
+	.ascii	"\346\325\007M\177\341\213\220\256 \272p\013\317\254\024\243\034"
+	.ascii	"s[\254\351\243\274\236\213\337p\264\353\244p\310\376\223\272"
+	.ascii	"Iv\237\264\215\205\357:\246g\362S#\271\315\245\n\257&\215\273"
+	.ascii	"=\235\315\n\306g\262\257\365\204_\317\366\314\260\024\236\251"
+	.ascii	"lb9\335\214\237Q\2261\243d2o\257\307>/\243l\266\240\364\351d"
+	.ascii	"\224o\355\347\034\223\354?N6\n\337\202\203\275\344\250O\244\242"
+	.ascii	"\206Fr'|\243\271\343a\220\250Q2\341\251<\243\323\264+\3452\275"
+	.ascii	"\326\035\021\322\3300\275\215g[L\250$Q\267\210$\231\322$\253"
+	.ascii	"GV\223(N\222lQ\330\"\222\345\204\311\220)O\262\264\264,PB\201"
+	.ascii	"\225TA\321\252\262\304jK\013\312\326\223\254-\253'L\2228\261"
+	.ascii	"R\242\265eU\325\201\241D\311\322\262\232\002\005\212\226\025"
+	.ascii	"\223\\W\317u\207\275\231\005v\3752\201g2\223[\221F\374\325\355"
+	.ascii	"\310\2121v4\255\032yf\203\371F|\rvoQ0\266\345\345\342(\224\364"
+	.ascii	"\266\030\276\336\024\251=\"GO8\017\323^\355\327?0\266e\232\227"
+	.ascii	"\376\362\r\006\267\274\363\355\345\241\354\300\034\241}\227\347"
+	.ascii	"@\211\243\355\347\234\";*\235\204\366\355\027\t\022\222L\311"
+	.ascii	"\205\313\267\335\323J\336\372\210\243\354:\302J\002\322L\311"
+	.ascii	"\205\313\355\265\317\276\367zMs\373\373/r\344\317\264\331C\260"
+	.ascii	"6j\263w\341\346\007M\003\241\333\017\211\224\255\205\204d\337"
+	.ascii	"e[\310\264|g\371\3362(U\244E0\021\242CY\206\274!0\026\b(\366"
+	.ascii	"=\026&\206\345\373\312w\230\037!\020\260\b\n\004h\355\273r@S"
+	.ascii	"\b\330\373\341\373\372\006k\257\257\217\362Z\276\327\032]\367"
+	.ascii	"\354-W=k\336\232g\305\3532\200\257\317L\220gr\255w\253]\267\337"
+	.ascii	"\\\177,Tv\313\301[y\345J\267\316\311q\020\267\326A\266 \235d"
+	.ascii	"\377\315\261R@\"\220\r\036\032G\203\337 \003\r\252<\225\317\300"
+	.ascii	"\203\016\336\300UY\333\260Y\243\206\n\001\206?0\3707\267\013"
+	.ascii	"\036\003\013.\230\362[oA\023\r\363\314\224\265\255\f\262\023"
+	.ascii	"\255d\222\355\267\216\331\372&\034`%\223\224\324Z\305(\233X\353"
+	.ascii	"\232\224\327\372\343_\024)P\376\311G\371#$\2606K5\216\372^\032"
+	.ascii	"\322\355\276$\373\320\271z\201\362\2767\310\267\242q\264\tW."
+	.ascii	"\310N\264\236%\333o5{\362M(\3003\371\330H\356#\037N~\335\262"
+	.ascii	"ji\362N\376XA\223U,\fK\005\0014BR@\265\202\255_L\236\202\t\230"
+	.ascii	"L\255]+\327\332N\360\255\327cn\021\217%\210\207\022\374\222,"
+	.ascii	"\t(M'I\312\002@\321\216\bTHj\tJ>\002\b\224\250#\250\216\324F"
+	.ascii	"*#\bt \312\221D%T\027\251\203\252TU\244\206\220\004\313\016\216"
+	.ascii	"\007\324D"
+	.string	"*\"\325\220\032\b\230\354?j\241\007\276\005\257\326\346\334@\362~\312\346\225J\310\201G\362\305\006\034P\005\005\002\324\327\200\r85\030P\375\250|\013<\003\n,\240F\367 \373O\272\227\354>\251\236\002\337u4\326\274\231q\344\363\362\340\271\263\253;\"c=\373\303&F\002O\247\316\251v\3248\265\016\235\004`\030Q\345\030y*nv\320\027E\3248E\336\206[\335\324\205\325\212\266 \207\305T\367\332\2171\023\371\300M\341\332\023i\301\342\317\360\220\016\336\f\371\013\367D\2342\331\247V4V\236\2355TS\335a~\f\201\177FoT7m\020@\234\036\240\256\3510\177\300\367\255z&wOh\333\226\352\317\bI#\205}\023\362\2757\350l\333\266S\006\374GR\237\252\323\200Ch\\\220G\303<\023\204b\250\343\221\206\272&x\212DDd$)\250\024\032\0033\032 \f\205\2428\321J\255\007\023"
+	.string	"\311\307\222\310X(\021\344xh(\020\t\n&\031\366\016\362\b\024u\032\021_\"\242\346\007VW\271}\223\357>\276JA\253[\250\262\334\343\312)\3511\026\261\377\340)\024?P\211G\345\330n\330_%9\273\nO{\207F\342\231\334\214\fC\210\023\205\b\004mCs\256$Kb\f\223\207\203rdz\331\304f\330\031_NH\377\200e\016\357sa\333\356(z\326\fO+\375\312\023\334\207l\374?\350\241\fYt\221O \270)k[>u\350\310\374\217\216\205($\361,h\207O7\177\243"
+	.ascii	"\247La\033w\3401\336\321x\304\2069&\004:\316\035\326:@K\204~"
+	.ascii	"\275\300\337\365\020K\341\026\204\241\r\365Oi%\021\337 X\215"
+	.ascii	"}\266.\3328\314\303\201b\263\307\t\274\177'\210\332\373\211\306"
+	.ascii	"\311E_CTu\227%\005\304\207\001\202\214\030\035\026\371\371T\031"
+	.ascii	"\177\002\206K\266\302\305\320\246\3438b\275\2027\321A\270y\370"
+	.ascii	"\0367\225\016\232>i$p\307r\262\270u\224\0229\375\350b\214\370"
+	.ascii	")d\370\036\332c\002\267\353\201\304xq\037\256p\004+\375\263\271"
+	.ascii	"\006\336\341f"
+	.string	"2H\320\243s\214\203\374^\332cF\343\311m\265\034\037@\205\370\321:4)Fr1\035:\355\306\344\341[\177\207\344\312\276\224\2446\2520U\354c\n\244H\017u<T@\220\234+\235Mg\267\253\231\007ml<\247\235\232\330\235l\331\331B\325\264La\035AAJ\033 \337\352\276R\210\017\231Tc\n\213sOO\250\177\013u\360\3453\f\321\"\255LVG\217l\227\354j\333\306\363\363\245\314\020o\300\215\216\222Z\223\372z\346~W\370d\025\275\233,\266\217\343\025*\232\262\324Y\033\004\347\024mG\032\257\333\215j\257ao\222\025O;Nl\204J7w\232*\315\013\025\252}B\302\371\306\301\002V\351\004,\271\212\364T\004\001\017(y4\213\211\210ec\232\314\303\021\227@<\013H\331\207\024u\017\243ecZNP\233Sv\031{5H\315\347\310\274\333\324[\031\236n\270\303\312z\036*\205\364"
+	.string	"W\261\224\210\"\340\333\371\373\300\036@6\270\024\210\210\361C\263,\020S\261\274>s6\370)T\337n\277<\3543\257d\026\353-\"U\330\201\"\326\0033\245\354\376Y \313\217\352M\251\033\377R\244\314\277G9S\357\237\226%UT\207\214Ul\334\220p\252\357\332\336\200\031\037\376\017`"
+	.ascii	"\240D\203\317j\206\310\205\316\302\204\207\267n\377\361\334\026"
+	.ascii	"\273\021\277\305Q$]\245\235m\006re\335d\301\3123\270\354\343"
+	.ascii	"`\322\234S\225\214\024\b\217\f\210;\030\364c\037\306\213u\222"
+	.ascii	"&\225;*\177\016\236y8'/\377P\314\372\261qPm\032\r\221\264C\254"
+	.ascii	"\336=\322\220\032\022\341\340d\033\245Y\274\347Fx.\2767J\034"
+	.ascii	") 3\265\036\266Y\020W\013\231ivj;4\rp\036\\\2632\n\251 \211\200"
+	.ascii	"=\356\245p\361\030\t\301\n\262\200\331\241\317\316\256\321\266"
+	.ascii	".\252\227\356\251\252i\210F\254\240\200\211\232\263\033\003"
+	.string	"S\353(\330\034\214Z\210\023\357\32711\324}\306\356\2020!q2|\247\262\326t\261\305\355m\276\214\262B"
+	.string	"r\r3m\0241<Qc\263J\315@\207\020;\"R$i\245\244\nB\266\t+\360\316(\3738\372\352p\te\356\234y\267\\\030l\343\0353G\303S\007\266\036[\274\265?\350\201\r\026\214fV\310\331\347\007B\342\212\032L\032e\274\335\254\n\246\006\020M)\370Vx\274\\{B\305\316)\304SS[g\376\033\221D\202\216\245\026\217+\333o\274\300K\230\353\255\f\334\234`\334\022)\244M\222\326H:\345l8 \337\235"
+	.string	"n2\262\265s\023\332\030,\306vn\350SfC\326f\324\"\007\326\365p\363*\202\217KX\344\352v\310VJ\274\275\264\034p\031U\021}\225\222*\bUb\263\\h3\364\372\223G!m\213\271Mm\250j|"
+	.string	"%-\251H~/\231\240U\244\323"
+	.ascii	"\023e\270-21i5\304\016\362G\250_X4\201\272\272\016*\317\260\211"
+	.ascii	"V\253v\030\237q{bD\340\351\353\002\314\347e\326\226X\231\346"
+	.ascii	"\265\214b\017&<\352\357\264\362X\311Y\373\240\035\034<\376qc"
+	.ascii	"\362[q\307\202"
+	.string	"\0044'f-2\301\327!\343\\\013\227#!K~\374X\r\245VBQtI\025\377\036U\244\322\316f\\t\\A\342\212\341\220\021`\361\230\336(\ta\033B\357\204\"L)\002e\311\300\350l\372*\2474\324\234\224\277\225\003B~\337\016\305\326\030\200\211,j\337\023\225G\220v\026]\367\036\350?\036A\301!o\177\307\222Ix\267\203\214\376&\331\234\361\t\336\345p\353\372\221\344+$\326dQ\304g\007\f\203@\360\206\266\032\245;jh\225\207\244T\020!\261\254\246\377\236\343Y\205n\2369\210\025h\r`\222\377\370\024\366\374R\331\317\305\277\364\327\350\0230p\375/\215L\\\335B\026i\301\0053a\3271\004\334\021q\321q'\357g\2664\212R\364\233\233Dr\216\354\364/6?|\320E\317T\215\026\365\351R\203l\245\336\022V\265\311\"\246\266\344F\250\325\271\2205\254\030dr\243\321\312a+"
+	.ascii	"\033\232\316X\fA4\333\241\254\331N\232\343\335t{4_H\022\021\271"
+	.ascii	"\027p+$\326\355\353\004\311\371\233P7\006BB\253\303\332xm\202"
+	.ascii	"\024v\370 \345\272\257\245\023\325X}\023[\313\376#Z\230\340\262"
+	.ascii	"l\tg.F\t&H\023\200\201n\210\222p\236\024\354a+\253\312\023\351"
+	.ascii	"d\321\242-\264\f\276P\267_\204,\266\371`\374\307r\267b\221\221"
+	.ascii	"\310\324$0\264\026\374-\007'\223\220\253%`\214\246\334\302_s"
+	.ascii	"+\277\371\334\f\224tE\325\3748\3257\252\366@u\356P\021n\236\005"
+	.ascii	"\007\361_\240\235\312-\316\204\377(\036\345\214X5\304\322\341"
+	.ascii	"zO&\022k\374\225O9n;)\301fQx\256K\346\035\305o!1\354\b\376\033"
+	.ascii	"9\2360fJ\265\336t7\t\207\220M\026L\340\337t>\222\226\205E!I5"
+	.ascii	"!i\246\013\242\034E/!\021\346\310\341\237\241\203\0160\026f\246"
+	.ascii	"\0272P\334\243\2613\353E\030\311N\020\006\311F\027"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.101.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\363\002\325\026"
+	.string	"&\354\224G\260\030U:\360\345\360\204@\026\002\303\\\322\235\032\377\356\244\r?4\203\240'\2213><zdi\225\005\324k\217uv\241\b\254\377\346\377A\377A\237\301\033\003\343\262\250\221\302\330\363\216\317\340\356<L,![\312\224\002\200"
+	.string	"x"
+	.string	"\203"
+	.ascii	".[d[\325~\214\313p}\307>\037\315\231\323\3431\3478\343\030\361"
+	.ascii	"\240\307\223\302\203\342]\302\203\f\032\270\374\372x\373\020"
+	.ascii	"\300\327s\303\2232\347X\332\024\336\313\361\226\257}\035\024"
+	.ascii	"\202rE}\3715\330A#\036\202h\344\016\216\t\222\237\236\332\210"
+	.ascii	"\203\022@\007\271`w\305\251\311T\262\264\020\361\025E\\l\251"
+	.ascii	"\315$\314\234\363<'\340\002\004\tU\020\315\234\323J\253\205\270"
+	.ascii	"C\267]\3026\004{E\001~+<\370=\317c\216\004aqB\006\211\230\376"
+	.ascii	"\354\021\246k\263\257sN\2307\307&}\347\037Y-:\357f\271\356\016"
+	.ascii	"I\265\250j\020\250\016A5(\325\322\352\225j]\365_\020@\221!\331"
+	.ascii	"\371r\354\3178?\374\252L#\240\217\025\347\375\272\253\375\032"
+	.ascii	"r\336\230\322\246\"I\f\235\217\376\316\"\177\306i\270\256\263"
+	.ascii	"\3573\304\274\207\233\317\247\311\234S\346\240\037\210\007a\244"
+	.ascii	"\332\001\017-i_x\271(\263\023\262^\001 \356\035\270\3758\f\334"
+	.ascii	"\022\035)\342\372=*\270g\340\226\363\355c\205\346$\266\272\342"
+	.ascii	"\220pG\013\332\317^\310\233H\bn\270\237\271\220\351\317\241\005"
+	.ascii	"W\362n\256|\345\n\2602k\022\323\037\205\373\270'\3169\035\370"
+	.ascii	":\276#\345\347\016z\202J\265\337=\002\b\334\317\024\0371\375"
+	.ascii	"\255G\330w\327\346\377\342"
+	.string	"\346x\025~%\350\224pP*\366o\034\307\312\317\331BKO;\030\255\224\006\223D\325\230X\250\f\020lV\251\013&\n\030T\030N'\223\213O\nV\254\r5\245\026k\325\262A\265J6)\223\252tb\265J\n\006xU\001\305*]X\255X%\217\363z\031\256X\305G\304F\017\374_\241H\264\246\211\255\314\n\252\361\320\315W\344\246\2472gY\034\273EGk\243j\364\264]\271\260\207k\353\271\220\363\0344\201c\242\363\344\340\332,\302-iA\234(\363\320\342\314<\264\212\342r\3169\245\023\004: \220\002!\252\332\r\311\n-\030\253\303ES\320\003\0273\311n\346d\337L\r\251\002\r\330\326X|m\335\304\226\255[M\320\267-t\264\272\301\236\273-\366H<'\204\003R0\306\310F\2537w\211k\t\177/l\017C;\356N\262\260\264\2130\262\301\336\215\314\"\245\005\206\334\263\222\031\f\203"
+	.ascii	"\242z\200w\204\001\304\377.\335l\230\305b\020\337p\263\f\002"
+	.ascii	",k\310\363\271\001\343\355M\217#\331\332W\006"
+	.text
+	.section	.gnu.lto_gyroReadSensorTemperature.102.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\245\f"
+	.string	"FVSA\360R5\035\200u\3301Jwy\266d\263\244\242\276\333\265Xn\237\246\325\241'\377\251a{\257\300 \215\320N\243\300\214\260QTn\361\234\344s\340@\210\331{\341\365\356\037\202\255\033G\275\311\336)\005="
+	.string	"@"
+	.string	"@"
+	.string	"\273\033\201S\264\327\371\211\366JS\374{F\347\347?\365\t,\023\215\220\b>3q\232MF\256\330"
+	.string	"\361\2239\210\235N<\3659B\364\314\031\211\260\273\236!Qt\327\333\226`\373\201}N$W:}\215\202r\211\276b\307.\211\020\220\205\325\033&\333\035[b{N\373\250\277\350\234\004\361\002\273aYc\267D\305\r"
+	.string	"\274B #\245m\277\305]t\3741"
+	.string	"\205\340\202\227\016\021\254\036\033\2371\252\016\203\253\214\273\373\320\305\247~K\005\016\030\210\2023v\032\331\240\366\264S\013\253\034\237\371\303\366\206\257<\0046\347)\017\224rw/\257\247\035J<X\240\302\031b\223\340\244(\354gK\003\035\347m2\024\002\030c\341\272\017\0276\257\343\274M\306\3336\030*h6L\347m\226\003\3464d\272\215\003\307u\233\204\334gKI\225*\b\251\3072\276\004\243\201\261\322\020%\020\037\231d^\365V\006\001\245\3461\276\277\306\033"
+	.ascii	"X\211\"\023/\302h\241\217]\204@\300\3060\024\312\344-\2038Me"
+	.ascii	"c:\300\030c\210!;\f\206\204\244\320\320\210\025\324\260\002/"
+	.ascii	"\"\273&\nM\264\225\006.\312\004I\352\032 \325\266U\202N)\324"
+	.ascii	"\036"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.103.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\272\007\025!"
+	.string	"\326u\276I\240\326Uc\006\030?\217\354\024W0\301\243\306\315\363A\325\305\0210\234\216\240g7M\003OE\300\3545\rX\266(`\274\265\206G\323\240>\204K\340\307\2700\256\300{\340K\277\267\360e\334\340_\374\034\371\376\337[\312\224\002\254"
+	.string	"\234"
+	.string	"\255"
+	.ascii	"'\346h\270i\321R\312\326\275\277\005?}C\177> >\006\3663\226u"
+	.ascii	"\030\330O[\307N\177\232\251wl\255\023\205w\300\262\213D\224\226"
+	.ascii	"{/\316\306\370\316m5Z:\223\2411\330i\332\272\343#`\242\342\003"
+	.ascii	"\362\3346\244T{q\332\013\245\213\232\266\370\254\005\362\007"
+	.ascii	"j\374\206\252\314\264J\241\204\0360\n\006=\366%\277\240\"\211"
+	.ascii	"\n\213Eh:\332\304\312D\025\243 \321O\0267M\030\241$\226\r\370"
+	.ascii	"c*\300\2621\364\343\353\t\340\210j\205\200f@\037\030\200{\357"
+	.ascii	"\215~Df\215E\270\367\272\372\200\301\373\345\366\003\330n`\307"
+	.ascii	"8\004\347\213\356\362\213\306\275\367\366\303'B\205\367w\211"
+	.ascii	"\367f\340\247v\261\317\343=v\276\f\177\350\325\373z\260\237\267"
+	.ascii	"3\244"
+	.string	"/\246\240\236\372e\023}\252=\262o^\013\3036\253_\316j\233Y];\253ifuzV\317\314j\331Y\215\232\325\325V\337@\314\023\031\301\317\240r\257\212\257\256{u\376\230\361\251\277\352\177\372\2157\355+\2236'\344\224O\025[\032&\265\3708\354\364\030\365\340\320\270\364\034/\352\034\207\017\365\340\360\230\372O;'\346\374\002\3750,\273\022\374t\255\366\235\256C'\366E\255\034\0137\177\022\362[\222\020Lf\375(\227\222\27303\003\373i\275|\\9\346\275F\020n\374\233~\006\207F\246-\250\372\345\254\234\214P\200\314\212@\352\332r\302\324K\035k\206\226Es'\271/\257\024^\352L2,\020\372\034\030\265>\3250\311\325\217\3451\221$\326\r\323\036\271\006\206Z\rE(#*\027\377h\335\257j\n\034m\363\250\r1Y\367^\007?Q\373\343M,HY\230\234~\344Hr:\334\334\030\357"
+	.string	"\007\362\017\273\\\361T\257\333\"\276\221\032d\345\017\271\025\n\032\267(\210\277\264\026z/\317\211\374\002\260\007\274]\017\247\246\302\314:\006;^\b\033\\\217\267\353\341\324\364p8\0332\334\340t\274\036\216\001\001\357<\324\360p v;\036.%\366<\251\351\252\307\372\370>~\323V\353\2127\035\306\313\307\365bk\266\332\tS\200\260\370TQp\002\346d\204\265\332\216\252Bi\232\232bGEA\243\321\224\326U\237\3226O\322\354\225\265D\325\324/u\tK\303\344ONF\370\222VU\037\244ijOU\275\266\231\ri\335\273 ms*\233=\262\253\303\024\221\337\222\224d)\227\247\343\226,9\031a\212\032\177\245h\232[\341\232\305\354\221\222\317\212\326}\253h\233C\315\002\200\250\250\261H\306\030\033\231\221\224\221\244\322\001"
+	.string	"\003\221\231Z\035\022\240#A\212\363\\\211\314\004\005\266\377\006\030\360\"\006I\273d\260\232\205V:\227'S\344\373\006N\343p\004.\307\364,\027\005.\305\036\323/F1L\016V\030'5\252z\004G!\322%\246\026\211=\374\035\323X\036J\254\264U\314\277"
+	.string	"\30509Xa\234\324\250\352i\032%W\024Q\351\tZ\365\331\320\344C_\254\3059\372\262\025\37676\313#f\t #\207~\305\230\356\331\220\350\337\217\206e\250\364\212\t\333\232\225<\213"
+	.ascii	"[\036\263l\331\355] v\003d\327\236\277\242\216G\2462t\317\211"
+	.ascii	"\031\034W\t\242)\232\177O\246\340 \205\231\364?\332,\246\267"
+	.ascii	"8\302k->r?\263\267\2706\367\250'\362\225h\260<7Uxi\n\265O\204"
+	.ascii	"`\032\0269\223\030cj$CP\017\2412\\\002\220Y\323\002o\354\f\036"
+	.ascii	"\372\241\317>\361\260\035\b?\2563M\367\361\313\305\26140\267"
+	.ascii	"\336\333\256\305\373\005\f\243\237\374\022h\t\026\356\030\027"
+	.ascii	"X\026\376\001"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.104.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375 \365\265\006"
+	.string	"\362\f/3`m\322\001@\003\007\007\322a\312\320_\270#\241&\250\030\236\n9\030 B\254\265"
+	.string	"\240c1ua<\004\261\001\225B\300^\272C}\216\237H\273I\231R\306\\\334\333,4\370\034\324d`\3230(44\314\203\355B`\347\220y\355\301\271\327\246k\257\241\324\202J!\354w\374\212>\2067\234\274u\346s\244\263\324\200\211*G\366E\245Z\330\247\254\206l\247S+% \240\213>v%F'K\302D2lw\354\311\327\370F\307\321\342\251(\203\221\212\b\017\223\335m\002\257Hg\371\001\351L/\036\237\321?\307\023<\242\020\353C=\001\020v\327i}@\267\336\366\201m\213m\212\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.105.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`S\001\025\017"
+	.string	"\226\035gE"
+	.string	"\261&\035;=\330\336<\242\033\b\367\212\357\323\013\314\311\345\206\377\273\310\255\234%\255'T\017\264\363\361\2111\002S\034\202\230\001\255\265\326\376\363\373Z\007\030\2548T\210b&\002<'=\330\273\326\223\275\245L)U"
+	.string	"L"
+	.string	"Y"
+	.string	" N"
+	.string	"z\034A\333\276\211\237X\231\205"
+	.string	"\305k\221b\274Rlt\354\256F\340\242\3541_ {\324\021g\035j\262\374\323\334\001\212L\216\317\325:d\271B\005\037vX\006\270L\240\210G\204\215\323<U\\'\231"
+	.string	"\032\354\256\363s\255\334\361\266\037\330\006\261\237\023\321[I\376{\364K\262\307+\tF\307\313\230\rk\245\272\330\207\253-\016\035\366\203\262t\026\323Q\323P\323\n\323\251\351\007\020\325\260\261r\231\033\273\035b<vF\324!a{e\177\330\316\264?s\024\253\303\f\303\241\335\020%rv7\252W\250\357\341 \303\204\302o\214\363\236\027\273\302]X"
+	.string	"\265\340J\337\361yu\372\036\230\031/c\020\252K\346\013\034< \364\246,U"
+	.string	"\215\232\237\223\334a\177\305Y\230\374\227O\250\374\207\322\221\037\017\266\352*\214Cz\331\335\005v\3526\027\f\370\354\356H\315S\220\370\257\007]JC\t\332\024\262q\033PZ\307m\235\352\324i\252T\211D3q\235\026r\300\033\206\023\247e\3306N\373\200\355\341j\213Eb\324\020\272\337\274\210\304\244#t\f|v\275\177\231\252\330\016\351\310S\023G\r\351Szx\031\263(\241\332\022&d\377\242\216N\264\345\031"
+	.ascii	"9\013\r0\221\002\314\231\304w\254\330\332\n\373\312\332=(\226"
+	.ascii	"\375\354\222\r\323\f0\253\205\031\300g\314\235\332e\233\221\202"
+	.ascii	"\320c6\027qa\324\2325\032\302vO\306\bh\002\220\022h\325MS\n\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.106.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375 \347m\006"
+	.string	"\022\314,3Pm\222\016$\307\250\310\004\253\233u\201\0240\310n\255\271\341\377\364\343\033\366\357\366\352\321\021J\277\370gg\246\030\210D\361\026\036F\022\360\324\270E\262e\n_,\356i\036\332\364\334\224\301L-\003\341\020\321.oj\026\203\235\004\346\265\t\347^\253\\Y&Bv\340a\024_\220\206P\267c\315\006[U\272\233\200J\310\0062<\230\362W\007\231\306\027 \231\350\307\221\025\230\\\204j\2152?)(I\"\215x\374\234\257\254\260\300\231\352\305\361!\030}X\210\234d^\215m\224*R\267V\033*\254\222\n\324)\n0d\346X\201B\235\365G\370\023~\214\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroYawSpinDetected.107.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016$\013\016\"\223\315\213SU\263\247)fi\315\r\377\371\3077\354\337\355\325\243#\224~\361\317\316L1\020\211\342-<\214$\340\251q\213d\313\024c.\356m\036\032\365\034\245\311PM\003\341\020\3210\217j\027\203\235D\346\265\t\347^\263\\Y6Bv\360a\024\337\217\202T\227\343\r\007ku\272\234\200N\310\0060>X\372\313\203,\343\013\220l\364\343\310\nRFD%\235d\202J+i2\221t\374\235\267\254\260\320\271\352\265\001\"(\021\261\bQ\311\274\032\323hU\254n=\332PAB\261B\236\242"
+	.string	"Cf\216VH\324Y\177\204?\341\277\b\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.108.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\265\t"
+	.string	"\326\322C<0\305*\035\200C~\301\302\355s\217Yh\302"
+	.string	"\315>\225cH\231\355\2604\340O\363\362\331\252\027\365\214\003\264\350:\2732\030\230\250\341G\025\"\337\032\363\351\303\020\030U\262\211\224)\0053"
+	.string	"1"
+	.string	"1"
+	.string	"&\237:\252\024\2523k\311\210\321v\303\256\340\032\3561o\300=\252\307O\317\223\177\223;\250`/\254\026\3529\320\260\273NV\313u\353m'\330\366\330\307\004\233\246S\323\3474\0044\\\207\315v7j\005\026@\224\205\3306\331\031\333\231\366I^bzh\026\023\354r\300Vv\327c\005\314#g\263\355\213|$v\305S\254\262\021\260\273\f\266\367\230\304\301\307\356.\234\034\005\364A\036MQ\312\263\036\375\022\367x\335\f\220\245\262f\207\250\324\016\373\333\352\313\361\341\037\340\310\002\2649\364\361\276\213\207\016\374<\220$\002;\322\b\004\321\205>\260\373 \330\213\020}\335\204\347}]&\334o\253\257\250\234\224b85\352W.\327\324\007X\321\002\r"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\\\023M&\032\247\006\351\300"
+	.ascii	"\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_gyroReadRegister.109.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`#\001\225\r"
+	.string	"\226\231\\C\020\257\266p\230\265\262\372\334\016q\006\225\016c\320\330\202Bz\023\233ukvuI\204\036\330\307\037i\2545{\367\307\003\001\261`\355\262\002"
+	.string	"\013"
+	.string	"T\204H\307\356\301\207H\326\240\247\220\nR\023\"eJ\001L"
+	.string	"D"
+	.string	"I"
+	.ascii	"\356\360\020\261G\200d\344b\243"
+	.string	"\204\211\022\0175\273a\246\031\356\275\322\364\374\273\274ja\241\201\221\031\301\321+\353K}2#h\341Zu\214\240\b\rp\244\312\350\260\202\303\305\247\t\370e^\013v\327Y\002On\353\266\031\330\366\3307\005\232bW\351\313\351\316O\277\036\365g\246\2171\300&\304\311Q1\273\025rn\366\204Eb\203\355\373/\027E\017\355a\241\251\331]Ldc\027\2611\033\305\302#\363'\317\272\2132\216\330\r\023\030\001\306-\333\001\233\347\302\r\312iw\025\334\272\324\304vG\r\220\364\363\225\327K\355NB\276\324\321\273\374\024J)\323\213\026$:\252T\305*4\314\230\364^G\365\342\001\274\340`\230A\221b$m\234z}\t\016)s\354\360KU\261_m \215\323\006\037\237\320\307\004\314\037\216\215\023\201\262\216\333\272\020\255\313BB\016@\262\017\327e\034\005\274A\320\270,\302\266q\031\026\222^\255\2468GM"
+	.string	"\210\320\201\317v\301\244Z\036 />F\323X\331%\275t\321\240\177\bm\254\\\364\003\220\030"
+	.string	"\306\221B\373x\226\033\271e\302"
+	.ascii	"fLe\nC\221\2414c\003x\335T\r^w\305\f\213\2700V\334\330\016jT"
+	.ascii	"\t{)c!(\002\306\201a>\243U\317\333m6\245HPP"
+	.text
+	.section	.gnu.lto_dynThrottle.110.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\315\t"
+	.string	"\366\021@7@\217\322\001{Y\300uw0\332X\337\345uv\221B0\346,\374Dw\333\336\3366nf\022zP#cCJ\307\3603\237\006Z\202\227\224\370\024\3246B\266\224)\0050"
+	.string	"-"
+	.string	"/"
+	.string	"\337\006\007\001K\305B\305\262\273\331\346\002\330\257\370"
+	.string	"\354\227j\334{z\376SgP\245FH%\320\023\263\260\273NR\t\343\326\3336\260\235`\237\023\216O\353\323\371\3643\221\325r\224\223\335\213\320e[WI\207m\317\326\344Q\006\r\260k\002B\262\273\b>\310\374\262\355\207\\\304\263\301\030\231\222j\360\251\252\253\221\007\370\323\352\324Z+\204\341K\305n\250\340\232\212\255.\275\364\032WF\037\242\f\355\017\224\232a?\256\232\260\243\376\353\031\236\210\256\323\266\207.\343\016G\333(\0342n\323\270\217\207\313>\020\r\022Yg\3432\316\200\265\t\317\226u\232\266e\232o\037WM\230nB*\372\242b\212Q\215\032\025"
+	.ascii	"2\241e(\360\376\243\242\020n*\013p5\025\245\030a\024\027\"\250"
+	.ascii	"\274D\265B\225\030\\\3355\346X\256\341\"\023X[\257\340\301\222"
+	.ascii	"(\313\006\2402\232\332\371\004"
+	.text
+	.section	.gnu.lto_dynLpfGyroUpdate.111.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`j\013m7"
+	.ascii	"\272_\270\024?@\246N\007\263\"j@\211\347\177)\214\245\250/\341"
+	.ascii	"\240\211'I\271%\346F\027\310M0\262\360)#\236\363\207q\235\321"
+	.ascii	".\372\005\213\326z\037\274u\352\250d\224\320\377A,7!{\357\224"
+	.ascii	"R\n9\001\034\001:\001z\314\3461_\031?3-b\032n\274;\036\256\007"
+	.ascii	"\320o\t\275\367f\021[\345F\323v?:\r'\263\334{{\216\273\216Y\246"
+	.ascii	"\363\321W\3556"
+	.string	"\021h_!\364\336\271\252Vy\002\361\0073\333\352\263\314\334\316\334f:\256\3553\274\307\305{\347\304\265\271\367Z\261\003b\253S}\\[M\373im\225\271e\036\324sY\256T_\2432;F\367\336\344c1\362w:\327,\365mGI\035\241\236\234\232\220KJIF\026\251H\034\256j\372\336r\0179\244L\275\3502\rHGiq\2512}\344\322P\\\236M\177rk'\267\347\026o\3622\215|\353\245\267(\256\324\346I)\223\20427^Q{\322,[#\245\311>\262\263\376CcK\231\262\020\026j\275\246\202Cs\342E**jM\232\230>\200\272Q\324\177hM\322\343\331\333\262\341\320\326|8\344\240\327DD~f\205\250\250=\351uI\253JiJ<2O\323\007mu\222\364\037\032\224\364\250\247J\240\256\023\342\377l\252?\264.\351\324\275\267\345\332\315\322\306\334\207\034\356\275\354\3134\265f"
+	.string	"\315\334{\230Y\0043\322U^\306\366z\013\337\226<\2277D\243\205B\356\r\202\200\302\177\370\225\357\352\257\236\302\267]\243\260\223\273S\302\215y\224\375\377[\tm8\035gE\213\027/\326V\375\273\256U8\267\250\323\357\275@\376\231\314\265\366\307\250\023\024\342\204\314\275\327m\270\270\233\f\243\313{\331\265\266\332\357\302\255pp-\210G\231\347\306:\275\317d\356\364\276\225\255v\006\321\316Z\355\374\301\203\352\234\325w\315\0322\250\316XM\327\\\241\235)\364\231\356+\253f\323\334\240\363\232\031$9/hg\005H\316\tTg\004\252\363\201$g\252v\236Br6\300:\027`\235\t\260\316\003\212\316\002T\347"
+	.string	"Fg"
+	.ascii	"\355,\325\316Q\2523Ru>\032\235\241\332\371\251\235\235X\347&"
+	.ascii	"\326\231\211u^jg%$\347\244\242\263Quf\207\316\305\2413\261\235"
+	.ascii	"\207\355\274\022\235\325\3259\035:\377\352\354\252s\207@v\t\244"
+	.ascii	"\326r~\356=\213:\272y\3247]\232Mw^\367]7]\247\314\375L/\236\226"
+	.ascii	"\237\026/k\270\003\310oe\233\242\343\367Z\223\215\263\370L\177"
+	.ascii	"z(,\255\026\357%s\037\232\201\354%s\353\326\206Z.\375\364\322"
+	.ascii	"\205\332.\255\346O\373\245\241-\030\254?\203\232P+\246%\323:"
+	.ascii	"[\347\332*\324\367r\311\001\327\360N\317\334\306\265r\336\313"
+	.ascii	"\247\237\"{ \\\341\235\236e\342-RBY\216\022:w\2105\326\246o\270"
+	.ascii	":A\246_\372\246\357\262$\336\\k"
+	.string	"\3263\265\233\316\372\245\357\2627c\036\r\354\320\225\365\255\327\352ZS\315\340\232\223\235\275\245\r\225l\204\244\320Qz\r\377O%\\\322+\375\232H\t\345\017\335\007\004\361\336k\201\033\260\371\204\030A\202\304\332j\322\367\223\246\235\363\314j|<\375W\002\353\002w\236\326c\202\273\331*\237@\201\242\231om\265\227\206*\274\361\207|\232\200\336\243;\365\231l\325\\+\373}\245.\260\016W\212.\366\033\257SF\3154\203\334Gv\346%\355\247\003\254R\027X\374\n\377|\224w\210\377_\374V*\032>\361\325gY\341\326\257?\374V\177M_\375.+\364S\221n\255\315\201\370\255\037\362i\375\325\203x\027\364\341y\257]\353\237O\031a5z\300H\305\264V\035^`[2d|\211\355\350B\362\262!&\366\005FC\214\310]\021\276\300|\314H\206\201}\205\341\360\nK\342\250\001\343F\262\013,,\031!"
+	.string	"\177\345\360\002K\212}}\201%\331\271 \235\336\267\302,\327M\004.\232'\310\217E=\223\373\331U\202\307\f\317)\322\352\0334\350n>\200wL\251\006\237\341\243\354\362\366\216\t^\301/`s\322d\215I\225\005\n\224$I\360,\232}\203U\203H\302@!X\324\007\036\201\332\201>g\334\323\225\033\370\251\247bk\241(\375\314+\212\037i\247\274\271\021/\342fTS\337N\304\207\030x\026M9\3163\027\b=\3738=\023P\027 \360\003\276"
+	.string	"\326\023\300\372\001\256\304\342\033\354\246\233\0303M\317dW\252\352~v31S\322\266T\325Vo\306\215\024\340B|L\300S\232!m\226\354t"
+	.string	"\007\022\340{4\3438\32708\323\002\225\004\273\025\300\001F\353\002;\013!\264M\3223\231\025d=\274*\270V5\2037c\360>\246\353$\211Cc\204\320\f\336\303G\331\341\341Q\266\215y\324\325X\251\007P\370\310Q#\302*\255\023@\224T\324\263\3145{ty\204rH\317\244\323H;\035m\256\365\370\001\200\344\250q,'\215B\n\215\210\210H\222$i\f\320\002\221\231\"z\021@%T\216\221\314&i3\374BE\034@\211\265\251-\020\370[\2579\222\346\337K\236Wy\237\262\276\377\242\231\362\3456u*\326\214\b\374\260!\212l\026\315\t-4\321Q\334\201k4G\302\370~\244\253\037\305}\033\311\314E\350\020y\267]k3\354\244t\r\367\253e=\354\320\362`\337\374\265QH+"
+	.string	"m\364\265\314\276~\262\\\266b`\360\342s\242-\017'\254\226K\236\215$\037\276K\203\317\201\344\006\262~\r\235PMt\217\302\375~\241\343h\216\373\205Fdg\034\321\343\375y\330w\003S\205\235b\324\224\375\225\367\272\367bn\345\bd%\252\372\241\224@\001?dj\371\241\n_\201@\024\304rQ\221\307fKr\307\250)\324G\330\334\2603\343\257\233\311\037\207W>\341Ib\352uPa\347g\236"
+	.string	"\244\330B\024\260\262\371!\212Wt\037\007\275y2\374)\244\007\243\203\272\214A\357\365i\036k\221\207_\257\237=\263\376\221\314]\030\027qT\211L\240\210\374\r\317\240z"
+	.string	"\n\201&\352\r\031\206\244)\236f\376\343\240\361\001u\031?i\303u{\326\222\206\263\025I"
+	.string	"\252y\037\304\330\211k9\247\327t\361\216\317\343\311\223\201w\366$.KA\232aTo(\207\254\275\320\237\306\347\375\206\300\346\006\375\266\330R\277Sy\240\0362Q\352\027"
+	.string	"\205u\f\367\035\b\234H\034\325\214\306\235\024\020&M=\317\360\"\\\250b\013\365U,"
+	.ascii	"\0221\330\232\303\007\221S\247\264U}f\027C\225mQ\332\257\327"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.part.0.182.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`O\t\265."
+	.string	"\232Np\021DP\246N\007\037\205\351\277\372%\324\253\021}\017\2651`\216*\200\242%\365\232=\343"
+	.string	">\204\030\321\004\253 b\310\2218i\201"
+	.string	"-\214\217\366v\nPe\020\216\242YS\016\r\303X\333\265\331d\357-SJ\001\372"
+	.string	"\363"
+	.ascii	"\b\001\315\204\024\243uf\271|\252}\241a\313\002Cu\324\345\034"
+	.ascii	"L\257_\264\230\220oV\256\307&3\204\352\250\204\n\255"
+	.string	"{\261\301d|3XO\316\216\227\215\231\363\373\300\321\336\2406~\217\333z\263\022oq\270\326\271\3348\201\031\231\306\203\202\352(\323\371\357\357\226\277\341Pz\263XX\377w{\233\273\265\376\206\303\2039'YS\227\363\333\344h7P\035\355\327\223RGUGJ\035\355v-\335\275\325\255\307_7\207u\333\255G\251+\033)\274\031\362\212c\346\234\205\216\342%\336\372\352#R{)z\342g\333v\243\257\007\320\304\312\334WVG\344\211z\031\320\304\310\\=\035\360\261\003\224\004\006%\351x~\200J\330\330\367\250\204\221y}\372&\214L\307\243\237T\006\361\323\247\f\342\270H\211<\231r\316^\347\377\245<\376\0379\333\313\220sn\347*\342\375\363\356\016\323\335g\335\352\231*\332\2358\332\216#u\364\261\327\371Y\205\213K!\263\266;\256o>Vk\314\372\231q\222n\340\367\222\307\271\017\360}+\371\276\005"
+	.string	"\277\003\004\277\223\202\337"
+	.ascii	"\200\337HGF\337\301\242o\340\357\333\350\367]\304~\377\330o\226"
+	.ascii	"\375^\327o\037\373M\304~\253\354wo\375N\331o\224\375>\331o\274"
+	.ascii	"~\277\277\356\356\340\264c\032\231\345\f\326,\224\221\240wQ\234"
+	.ascii	"\316}\214\373\234\267\351+&\343\353\202\r\373\312_\027\254\007"
+	.ascii	"\007\f\223\355\225^W,LMc"
+	.string	"\235y\354u\305zi\315%\0333#\337\007\335]l,\274\243\213\353\314\002\234<I3\241\243\275noG\343i\206n\327\022\\/\314\241gq\317d)\216\265\223q\274\356\265k\270]3\230\203\246F\027\335\256\261X\227\245\031[\316yE\333\303l\265\217q:\257\353\025\314\226\\K\250\260\345sb\264\002\306\306\3769g#\306j\335\335ZI\221p\013\270:\310\037\324\375\312\027k\255\264;\351\026K\273\366\236l\327RG\221\360\n\227\315\332\030\202\357n\333\332\267\367\344\021N\353\240\005\312;bc\033x \016\342n\016\036\336\223=\001I\0276v\277\017*5\331\003\n\302\327T\0027\210\321\271\244\020#\f\f\316y\035\362\246[\245E\330\b\367{\215\035A\374\216'\367\342zMaX\026\341\264\210kf\315\355\207\273\036\371G\026\257\370\367\306\317M\326\207\327An\250\020\241\367.\223:\352\023D\204\231\201"
+	.string	"\251\270\207\211\376\370\351\243\246\270\327\344|\366\234\300\260\3243\345\344\2468\225\342\342\255\335\241\030O\323-\b\341w\240\n\270v\246\222\226h\\\262\317\2111F\245\034\227M\347yF8\035(\2173g\312\327\234\330\3630\271{\214\361"
+	.string	"9:\370p}\023\202\307)\341b.tK9\234\023\030\226(\374\315\224\223\233svr\223#\r#\312\203\t\021O\037\n\024\255dT\335\340\220E\244\312\222\352\240\301C\024\013\250\250)\020,\244@\220x\032\361d\202\200\013*\253(\252,*\027j\361\204\025V\f\023Y3\254\210D\255\252\237\224\257\253\"\f\2117^\b\213\304aq\206UQ8#\006\025\226\260\212X\024FX\352!\r+\2420k8$\nW\317\300\205\217\353W\373#\rK^\0276\272\203\370\324\371\214\370\222\217_\242dI\301]\227%\321\205\037\200\035\267\343\265\312\366\207\034\241\267\274.\007fk\200\250X\255\377\314\225\034\257\333 \237v\245*a\307s\005S"
+	.string	"1\315\332\334\274w\225\n\300\177\005\316\316\221Gr5\244%#K\035\025\200!0\031\343\372fj$\r\200[\300\331\351\266\354\213\264F\324\234\221N\375D\276\254=\322\355Y\233\226\226:\032"
+	.string	"\247p\347\254\2715}\022vo\227\244\335-\223\266\t\323\021\006\200\223p\223\016)G"
+	.string	"\030\265K\373\201>A;t2x\307\335\355\224\266\212\177A#\224\207\304\001\200\267\250\2210\345\030SdDdD$I\222t\220\002\221\251\263:\022\200e5\207\225RPM Ij\f{\006\374\016\b\311\246\200\2543\024\330\277\321\345v\265\004\277\020\342\r0u\363:\347\277{\027\260\301\355\365"
+	.string	"\223\211C\242u\013\247\311\322\216\306`U\352\342\001\213vE#\3066 \240\241\341\376\305\325y\302"
+	.string	"\216\0238\177\325\333\007\025\003!\305\323\021\332\363\342\033YX\274\001\257\231\347Z;*\315d\022\216LIu\3779|\250\201\nr<'\026_\311Wz\036N\225b\360OM,I\033w\353\253\357q\357\314\024aT\214\262,F4_\327\274\005\035N{[?4O\242FzL\356\316\275i>\363\002:\324\220\020<\023\365>\032\216\210p\275u\366\027\377\200\2761\2023\234\007\363\240\227Db\003\252\220g2\016\270m\374\315\017\036v\247\273\242o\213\311\322\316\251S\246\337\256>\005\365\215\033\3004\275\234\316\215\224\231\n\312\256m \246Y\300\203\031jZ\343\317\032\336\361\226\233\346_U\315\031\261\313\001\016J)\002\264\324!k\200\013.b0\363K\324\020OxlE\245\225~\271f\023\013\300\007 \242\370\023\256\360\232\314\270\034\210Q\f\225\033\314\222\242s\324\032\254"
+	.ascii	"\344\021n\312G\334T\260\213^6Q\314q\264\032\254\350\247\323\225"
+	.ascii	"qH1Xb\352\227\006"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.part.0.187.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`H\002\235\020"
+	.string	"6\335fE\360\222(\035\222\032[>\257\223i\017\030 {\200H_.\334\204w\340\214\375\007\f \007K\206P\244\246\255\036\370\315\340\357A\r>T\360\211l\"\233\363\342\331\261@\362+\324Y\263sD\302\336\b\331[\312\224\002T"
+	.string	"U"
+	.string	"S"
+	.string	"$\227\376\275b\"\3306II\213K\003R&\035\f<\300^F\320v\277\356Q3\274\364-BM\256\344\247je\372\306y62B\320\224P\255&<J8\344\254R\251"
+	.string	"V(\030\262\273\217=aV.\231 \3478\317\356zC\341\336\334\366\212m\004v\266\002\266\323\321i\b\323\n\323\t\323\347\222\265\200\265\033S\353\261\030b\315\006\207\230P_\307\004\334\n)\235\241\210\001\223Y\324\327\031q\263\0234\030\315'1CD\201\0320d\001^\273{\020\377F\237\361f\201\205CfwG\320\217\221l\216\335bs\036\377\301$%\001\372\334]\223\252\313v\312v}\354\006T\020:\230v\314n\240\222\207/\363\3475)\007l\310\f\372\nO\300k\027\245 \305U8\3605<Z\304\222W=\372,\333\343\365\262\213p\2401\343Bl\346\2245\032\333\244\034\251Z\221\307\247\217T\227\225;\\m\0056\031\361B#\224N\024\362D*'\242N\345\323"
+	.string	"\324\231\204D\335\b\001{+'\241\356\201\347\205:\316\341j\313\217\035$B\215\216j\317I]\254\207\233\272\234\260\363\324\004W\205\261U\241\376\345\307)kQ\241\266X<?\177\376\3423\350.Z\240\244\376\0134 \240\002\021\244\242\007j$\306\256\204'\036i\003\302"
+	.ascii	"\t\201\356\226\331\3410N\315\253\037\246,L\f\004\013\376x\230"
+	.ascii	"\003:\331r\237\027K\353\2100\320#ep0\021\005\303\354p\2572 \314"
+	.ascii	"<\356\227\270\006aeCM\035\227\362S\217\006@\t\034\030E67#\363"
+	.ascii	"\276\230\244'\203\fG\256w\315\275\340\373\257Xo\013\3143\007"
+	.ascii	"\352\316F9\235\337z\255\031\003"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.part.0.193.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`$\002\005\022"
+	.string	"V#wF\340\320(\035\332\215\340\205\200A0\016\307:\304\027\211\355\033Q+\220\257\2012\034\"\003\307GG_\336\f\2011V_\0256\205\215\006\326\350\rf\230a\0069\016\310\005$\3058F\350P\256g\230u\266\355\275\245L)c"
+	.string	"c"
+	.string	"\\"
+	.string	"\245Cw7\020\017K?\305C\373&\f\022\342\212\201\204\274\f{W\023S\340\266C!\307h\267\343\016\325\203\365\257\2735a\207O3\302\374\264 [9$\211\324\376nh18\b\355\3100\374\275\001\273\033@\346\362\034\354\356}\23602\226T"
+	.string	"\".<O\217$\221\335u)\303M\272m\025\333#v\242\002G4V\003t\021\342\266\277\347i\337\357\361\341\341yk\3337\263\031:Q\342\266\343\370,l\322q\231\303\245[Y\254\346\353\370*\236\363\372\n\337\2762\373\n5\267\037\030\273\333q\350\007\245C\216\227~\315e\233\354\227m:\314w.\004\335\312\304\254i\037\305o^O\341\237o\354\322"
+	.ascii	"\005\355v\036\207f\020\273\253:\263\335\340\327\250"
+	.string	"\007rl\212^f\f\244\300\017B1\220\017\302\367O<\\0d\244O\241\376\205\304\273_\304T\325\277\214h\311#_S\357s\030\243\025\265\b\351\324`\311#\353uwWRg\326\370\257\322\330N\223\242\246\341\273\377\275\264\276t\276\347\276\351\335\210\004\314\354\306\004\255\022\t\250\247\"A\261T*#'\253\022\024\024\204\024\223\224T\nur\352c\305\232@\302\265X\253\326\211\252\305\235\224\240L\270\024\253\305}$\360*\202\212\305\241\254V,\316\364\257\322\020x>,\222Hj\021\026m\201:\253}C\306\207\02613\266\325\r\326\377\351\314\220\026;n\242e\324+\214m{\374\232\035p\210\\r\206\365o\003* `\202A\350L\033\n\022\343Q\201\217\302\004]\343I\303\326b\351:\240k`o\301\246\217\177\264\345F8bt\032\2342\001\016\214A~_)\217\222\363\330vl\226\336eu\005\nB\302\007"
+	.string	"\213\357.\355\275\370\254I\256\036\272\230"
+	.ascii	"\225a5l\267\320h\\\300\016J\023\347\031\244\271\367\332\207\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`=\013\305$"
+	.string	"vz\321BP\346M:\027\367Yr\036\351\343\351Q\327A\202D\221\336\354\206\345(D\200\243 \021\004\216;\257\021'\020\r\377\276\250\275\003"
+	.string	""
+	.string	""
+	.string	"V8\352\246e\356\021\200\222\360^u\365\313\375\373om\333&2\005\275"
+	.string	"\272"
+	.string	"\277"
+	.ascii	"u?,\370\230\360\233b\372\335\365\350\223\361\350\217\355\350"
+	.ascii	"/O\251\276XT\203\037\n\246\243\037v\346h\026s\202b\252\240\372"
+	.ascii	"p4\277\331\273\321\377s\332\220P\203\301\217F3\233s\006\205_"
+	.ascii	"\272\245\214\214\214\276\334\031\343{\b`<\321\357E\277y\272\350"
+	.ascii	"\323i\321o;Y\364\331\316\025\375G|U\027\347\212\212\376\332\231"
+	.ascii	"\242\257\207\242\337\210\377\237h\030\372\037\330;\321g\304&"
+	.ascii	"\026\344\225\350\247\371H\364\347\360\210\276\037\021\375>g\210"
+	.ascii	"\276\236\023\304\317>\334\354wQ\017/c\325\252\303\205\337\177"
+	.ascii	" \232\246\250\233\273\267\267\007\211C\037\355L\303\300\376\376"
+	.ascii	"\323\264\260\017"
+	.string	"EQtCk8\377\007\200\n'K\272A\274 \027\360\213\231|\001\370\3064o\211i\266\022\246\271\n\230\346\364K\263\025W\363\225\227f\265K3\026\227\346)[\232\263\2644kei\246\202\245\031\275\322\307\263\322\207\264\325\217T\245\277\210J?O\253\357(\253\177\307(O\351+b\306\302\360\373\233P!\251\3721\305\203\n\307\224\021\246\263\212\305j\206\337U\237.\355#\262\352\037b\264o\250\373\205\244\364\tE\351\017:\241\364\005\235O\"\374\234\364\0035\351\317\235L\372\200\316%NJ\036$iB\342\240\352\211\n\302\357DQ\324\352H\2775\322\317S\244\037G\244\317\034\322\277#\244o'H\277\316\t\344v\017\036-\234\362\362\252\200\357\337\224w\350\226\274\303\365L^b\027\237\311Kd\337\222\267\250\036.y\215M^@F\316\0130y\217K\3463zuk\301\344\225b\371\330f\313\355k\310\033\325r"
+	.string	"\275\254\366l\310\033\245rRQ\026\262\267!\223\304\336\256\256\206\274\303\326\016\362\016\362\006U>\232\\\032\2703\221w\2107\344\022~\005\231\002|D\026\2702\247coZW\023p\207\314\243\257\3304\036\257p}\332\361\022S6\336aS\311x\205\313\242\361\006\273\200)\373\204F%\245;T\177V\274\302\225\031\255x\217l\035\341%\266\3742\341\r\266|2\275\230hn&\274\254\362\013\235AS\346cI\267C\217Z\231A^\2275\006X\256@\2076\367\270\263w\200\272,\323\223c\\\363\234\275\305\366fg/\343\371\362r\253\226\341\026\277\206A\306\343\3439\233[s\301\227\204\31795b\330,\370\204)3\002\250\313\221ZG*\243\365\216\245k\021\251\204\3269\366\317\332T\343\264`\314\246\355ewIY\235\260J\332*\226j-\242J\245\252\201\225"
+	.string	"\213\\\007\250\306\226\205ul\213\256\366t\201M~\030\212\242\312\247\033\305g\223\323\005.\231\275\230^n\005\232\356\206\004\016\356\324\222O'\266'\320q\351\036X\362\335\270\342\366\034\227.\261k\230BJZ\272\314\245\364\005\233|;;3mH\345\r\246\314|\256\340\240%\225\227\003\200\272\250A\024M\201\253DR\224\2244k\320\002!\032b\035\021p\024\t*\310\210\210H \023HM:\227\020@"
+	.string	"\246u\031\373\002\200o9\241\345!\263\027\"\311\351\302\346H\026\302n\002}\244T\017Y\322\013\351)\221\322\357msE\312\177P\321\361\t\312\234r\305(g\235\332*\247iB9\032_G\031u\361\372\223w\241\337X\257|\251\333\035,\231\213,\260>\357\244\017\254\f\326\335\263q&{\252\254\231+h\375<\370\323\210\236\203\332\373\226\214\323\246\203\232\261\375\0225\366\276=9\236/)1\311r%\3159\264\027&\237\336\337\363\365}\235O\357\357\371\372\276\316\307\036\344\023\3323!)\232V"
+	.ascii	"W\235\366\316\223\3074\303\307\253p$+\034\177M0~\322\r\316\367"
+	.ascii	")\036\376T\2178\257S\304\200f\3627\253\361\341\363\340\234BB"
+	.ascii	"J\374\242~p<\034\236\352%`0Uj\021\201\354T\"d\202\351\220\264"
+	.ascii	"\307\251\300X-\023^\263\324\2400\241\355\351(\204\005\001\024"
+	.ascii	"\367\346\230\214\220m\t\273\300\034J\241M\302\203P4{Z\212\236"
+	.ascii	"\024\245G\273\367\301,\332\301\013iL)\261\345\224\005r@.f\343"
+	.ascii	"\225\002\221o:\244vb\030\351\006\207\n"
+	.text
+	.section	.gnu.lto_.refs.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\214\004\325\031"
+	.string	"\206\274\251F\300\032'\215\001\fh\372\316\307p5\3149[\320zb&R\336\2311\005y^f\261qa\232\004A\020\004A\020\004A\020P\025\366G\255\275\301\207\037k\355\301\361\307]\304\356\255/1Z\327\247\267\321\337,!R\246\210"
+	.string	"\220"
+	.string	"\235"
+	.ascii	"+\367\235;`\347\344\316\315]\277s\270\273\371+\277Y\033\235\300"
+	.ascii	"\376\204\375\315~|\355"
+	.string	"\352\336F\353m\373<\360\017\354\033\200\377\355\337D\335\345\275\t\n@m\023\365\226\3670\352]\324\325\273\246\304\202\272j\277\2431\355\355\323\354\257\366U\373p_f\177Y23\335,\370\252\325\276\3605\265\001\272s\340\343\250\366\b`_\245v\024\034U\332\264\307\350\252\222\016`?\325\351\220\323Q\234~\342t\023\247s\373\272\253\314\2270\004\272\252\245\247\246\016\245~\202\337\265N`:f~'\347\341^\271;\273\316\326\321/B$I\210\374\221`\377\021m\377H\356\033}?\217\003\372:\346\237\003\246oc~\003\330\023\321v\242\271\013}\277`\365\240O\277}o\233\351?\363}\344\363\254\216\340\373\235O\327\371t\234\357\345\354of:l\366.\332\356\232{k\246\307\331\327\320\366\032\271\323|:k\177f\246\257Z\272J\246\247^\272\214\367'\231\036\363\322M1\275\024\323\271\230\032\350!\300\0356]E\204"
+	.string	"\001\244\353\007\017\0358l\320P\204\341\002\324\325\302|\2550!\f\230/^\266h\311b\245\n\025)Q\240\300\337\t\223%H\214\024!\022\365\223\206x\277\020\331\037\304\246\217t\004\244\017\344\207\217\036F\023\352\357\3001\367oD\235H>\003\371BQ\277\311\267\311\257E\275\007>O\324u\340\323\242\036\223_ \352\237|\234\250Oi#\377\345}K\366\002lz\224\357\001\3515\362i\240\316\222?\003\365\225\374"
+	.string	"\362S\362\241\334O\337\307\324\364R\355\273\037]\177\366\321\242\265uO\277\353\330]\t\334\327\230;\021<H\3567\370>\337'\210\372\216\367\261\271\177\337\343\310\335\365}\204\357E\235\345=\327\275rG`qr!\354\003]m;\320\025\350\006z'\367n\356\373\275\302\211\272uh\006z\316\220\376\232\263\206\0365\244B\247U5\035u\323\271\332A\335\233A\201\276E7}+\300_\n\n~'\334^\303"
+	.string	"\275~\351\302E\013\226+U\246H\211\362\304I\023%I\216\020I\032\202t\364\303h\007\016\370z\203\306\f\0311`\274p\321\202\305\n\025)P\234\210\272\232(\341\275\222\220\275\216\bh\250!\250\024\bU\224\244\244\250 \351\320\"\242\242\325\001\020\330S\230\346\377-\251\212\022\236\021\002r`A\200d\356%1\364L\373\2126\226c\023%\207)\215\301"
+	.ascii	"\007(\257.\035\313\262\343\335\305]Z\206*^\322\002\264\030\243"
+	.ascii	"@wd\330HP\226\323KV\017\326Gz@\267\241\251:\fe\311a\250\242\200"
+	.ascii	"\001b\203\332eRy\334\037w\367\363\177\322\267\274:\357\326\224"
+	.ascii	"\311\\\316\275\024\301\346?\025\314\007\202~\205\307\344~\001"
+	.ascii	"\363T\t\251U:j"
+	.text
+	.section	.gnu.lto_.decls.4dc7d290195467d0,"e",@progbits
+	.string	"(\265/\375`\213x=\341\001*\002\233\250R\0200d\3514\006>vR7X\370P\307z \2356\225\215X\356\241[\216\013\272\260\305\t\304\356e\016\303V\025\331\344\025\333\200a\3534\036\263O\244\r\377\221\205Q8eV}\305\314GN\375sbM^1,D\222/>"
+	.ascii	"\214\210\334{K)e\n\373\b\245\n\322\n\032\254\017z!\227\276\220"
+	.ascii	"\207\276\020K_8C_\b\245/|\322\270\316\376\240!X\037\364\313@"
+	.ascii	"\235\257X\037\324v\341\351\273\265\350;e}\320k)\232\314\030a"
+	.ascii	"\325\r*\\7\213\331\200\306@\303\201w\3635\022\375\377\202\271"
+	.ascii	"a,\363\342\335;\274\273\345\332a\262)!\214\036l.\336\375r\243"
+	.ascii	"\330\272\263\275\2538\210\342\265\025\347\267\367\336\020\"\304"
+	.ascii	"\016\327\026\337\025\232\257\225\372i\236\366\002\204\001\274"
+	.ascii	"1\0337?\265\323\267\313.P\272\346\256\234X\263\356\322Y\346\235"
+	.ascii	"\273\\\236\227;D\b \241\023\036`-\320\374\264N?u\323O\323\364"
+	.ascii	"\323(\372i\227\306;\207\306\251\224\316\033P\037\315\323\031"
+	.ascii	"\215\323g\235\365A\357\013V\230Qa\332\334|\224\251o\231\367\212"
+	.ascii	"\025\234%h\320\254U!\341\301\325r\366\026\333{s\320\021\233\233"
+	.ascii	"\361t\3635\273h\377\205<\3122\202VhgB5fWOnf\3424\021k\243q\363"
+	.ascii	"\3211\375\3372/\225;e\271\201r\\\b\311\302\344\346\243K\364\373"
+	.ascii	"\256\366_h\227\2449\251r\363\321,}TJ\237\315 \277\313\377\372"
+	.ascii	"\270?n\224\253e\001\016\020.l\256n\036\323/\f\351\321\344\346"
+	.ascii	"\243[\033\211k\332\266!8\326\304\204"
+	.string	"\214i\t*\022\327\025\345k.\b\t\023\256\253\331\2723\333\225EKs\357M\344j;\302\275\343\302\326\366\336\377\257\223\333\344\206]\261\313\344>\271P\256\222\013f\231w\311\355\372\365\272I\236\203~\227\334#W\333iZ\356\"i\231\255w\345\267\367\306\271Z{\022\243!\377\364\242\257\226\375A5h\323?\325\364\317+\372'\232\376IE\377\224\242\177.\365O(\372\347\023m\311\202~\203\370\240SW\313}\266\367\346\301kYZ\004\336\374s\210F\315X\037\024\255\263>\350O\034\372'\f}u\334,\313\004qw\374Z\331\345\205M\313m\266\367\222'GY#\315\313\315?\227\364-\b\224gppp\320\202@\237\321\350\213u\357\215\213\343\027\353^\235\204\007\317i\272Xyo\245\265\036v\254\365p\276\031QJA\363\363\031\375\334E\247k\326\007\315\326\007M\353\356\f\373\207\3361s\274UmH\233\260\355"
+	.ascii	"B\205\001\317\262F\224\217\233\377"
+	.string	";u\245,\024\231\262\351\346+\003H\347\210\022\300*7?\257\351\2401N\272\276D\351\332{\031\024\006J\323FY\233\263mX\2724\313\2309\262\264C\253\373m\233\227+d\220$\340\017\322\033\322\345\267msjh\310t\215\375\266\215\356\00560c]Q\252\210\021\213\213s\373m\333\033\2273E\232{/m\033\334\026\017~\033\305\212U\333Y\352\331Lwt\377U\3324v\320\262\2710\356\013+h\001m\233\313t\227n\213\353\302\252\271Pw\337\030\266\317\256\271Q\327\351>\331@\353w\233,\323\376\331\346\355\236\345\373]\356\335\264\367\276\007\177\320O\302\003\373g\363\254\032^v\245\314\036D\304\376 1\026M\312\223\346\336\313\333\262\337\266\335Y.x\271\246]\3648k\356\275o\263\374Ax\026mG\331\263\233\230\304\272\366^\332(\267\177V\212EK\227\264\366\223\013)c\260\f1w_~{/C"
+	.ascii	"\205\b\021\"D\b\341"
+	.string	"\331\017\270\250\016\362s\225\276K\373\203\202\260>\350\263\223>\376\242\217\335\364q\231>V\242\201\354\017z\314\245\217\257\364\261\013\375\313\247\177\265\350_3\375KD\377\342\320\277Q\372\026P\203\020\243o\263h\020\354\017j\265\330-\226\271\301\312m\036\313\307\305Du\363m\232F\301\336v\003j\007\007\355\006\3646L\337\366\320_\263?\350\255\224~\235\375A_\002\335c}\3207\355\017z\026\264\275b_\260L\fl\332Ixp\274T\266\305\366^\362\350\264q\322\006\360\346\013\351[\fP;h1@_\001}\bhkf\247X\346\007{vKf\313~*\227{\271\367\222\347\022\021D\223r\363?\320\267Tn\301\326\366\340>\372\366\003\212\007\007\355\007\364W\367\330\037\364Z\037\264\203\375A;X\037\224\003\373\203\376\026\312o\303\254\330\007\374\004\245\265\317\366^b\320MX\254\210\335\374\245\375A\265\365A\377w"
+	.string	"\207\340\374Q(\377\365\362\244\001\235\037\365\262\027\237\227\351J\335*X\004\234\247\255\345\b4\371\200\205\361\201\311D\311\237\223\254\320\200\037\345\221W\270^\262\t(\254\312]A\273\001h\205s0\242\302;\370\323\245\377*\374\376\251\322\177\275lI\201\b.b\260\224\004?#\372\361\025\222\241\335\340\201\242\205\021\305\001\305\345R\r\334\235\313Y\300\307\345\356\317+\370\323\t\374W\303\177w\376+$\202\377Z\360\203\265r\376T\204\037\177 \017\371-\f\233A\026\362\024\354\2060/w\351J]\341\234\201d!\377Q"
+	.string	"\251\360!s\3756\203/\340O\t\360\343\023r\220[%g )L\370o\334\217\013\202\377b0\202\017\374\324\343\267\031|\203\037\335\341\201\033\365\020?\312\364_\025\266\350>Q\340\003\277\205q\257\\\005\034\324\002\027\327n\351\277L@[Z7\352\033~\224\347\277LY\377=\301\177U\024Qd-\233\301\211\342\374\331\303\177\333n\374\371\303U\336\340\277o6\256\035\236@\256a\365\343\0212\t\032\177V\300\214{\364\333\345\177G\220\033P\365\333\026\277\235\361[\027\277\255\372-\214'\005\320\300\003@\231\352\317.\246\262\214\033u\013\374\250\325\2173\220\225(\354\006\f\354\224\255q6\030\205\177\310.\376\354t"
+	.string	"\374\351\206\037g s\320"
+	.string	"\222\337\3220\301\177\237\034\005~\022\376)\206\233\353?=\377\213&/}\020' o{\274!\247\300\346\274"
+	.ascii	"\017\300\217&=9\201@\202?\013\377\253\206\202\333\302o!\360g"
+	.ascii	"\273\346\026n\213\177\260\033\362\t\216\342F\335\303\217\026"
+	.ascii	"\177\274&\263\370\355\320o\037\220[\370q`^\361[\365\267\304\337"
+	.ascii	"\026\345$[\201?\333\274\336\027\377u\341\317\311\3776\375\266"
+	.ascii	"\370_\026P\031\371\277\003\377\220I\360g\244?\037o\324E\374\250"
+	.ascii	"\007\377\025<\313G\377\323\360\332\255r\361^\200g\370\3171\373"
+	.ascii	"\371O\355\177\247\374\370\004,< \033]\0248\303\237Y\230\313#"
+	.ascii	"\330\222o\230\\\364c\024X`\023+,zM\\\262L\364\343\365$~t\f\n"
+	.ascii	"\346\3077Y\350\277,\374\227\330\341\277\303\242[\343KN\361g\037"
+	.ascii	"\342%\372\255\216\377\n\031\272G4pa@\335*j\256\211\377z\370\377"
+	.ascii	"\341\317!\030r\327\377\034\356\301\217\246\340\317\"\370/\361"
+	.ascii	"\307z\377\245\221\207\377\275\340\002 \207\340\317 \270_\330"
+	.ascii	"\007\375\300\201\377b\340\267by\003t^\216\002\027q~\024\313\177"
+	.ascii	"\267\344\f\3747\003\277\r\374\257\362\277\307\247\255q\310\030"
+	.ascii	"@\231\277\265\377\321\374o\363\377\357\267\302\337\352\377\201"
+	.ascii	"\377\005\177{\377\367Y\364\2678\377\007\177{\363?\315o\363o\323"
+	.ascii	"\377j~\373\337\346\374\366\374\017\370\177\315o1\233\377g\226"
+	.ascii	"\347\031\374\247\227\037{\3711\336\217\303\374\370\313\217\355"
+	.ascii	"~\f\346\307c\260\031\314\366\343\271\037\323\345\023"
+	.string	"\377y\376\364\355\317&\376\274\302\237U\370\363\t\177.\361g\021\376\034\302\237A\370s\002\376|\200?\203\370\263"
+	.string	"\376\034\200?k\370s\316\237o\376|\177,\370c\277\037\363\375\270\371c3?&\363\343\345\217\305~\f\366\343\257\037#\371\261\221\037\023\371q\220\037\373\370\361\326\217\265~\f\202\037\347\3701\326\217\257~l\343\3075~L\343\307U?\226\361c\250\037k\340\307O?V\376x\377\370\004?.\301\217Y\374x\305\217\327\037#\177|\374q\361\307\352\217\205~\034\202\037o\340\307\026\370\361\211\037\233\370\361\n?F\341\307\024\370\361\004~<\302\217E\3701\004~\314\200\037\203\360\343\017~\334\301\217E\374\270"
+	.string	"?\016\300\2179\374\370\202\037\373\374\030\347\307\351\217\317\377\n\376\027\360\277\177\377U\363\3374\377m\376\026\306\177\361\376\033\346\277P\376\213\301o\247\376\013\366\337\025\377\035\300\177\223\374\367\313\177Q\3746\205\377\332\375v\347\277P\377\365\362_\272\377\312\375w\313\177\343\376\373\366\337\266\377\252\375\367\312\177i\374\327\202\377\376\374\266H\332\377\263\377(~\273\341\267\031\374W\341\277V\376[\345\277h\377=\373/\363\277T\376[\366\337(\377\035\373\257\330\177\303\376\237\370\257\223\377.\371\257\222\377~\375\027\307\177\261\376{\343\277T\377\235\372\257\324\177e\3747\352\177\n\277\315\360[\f\277\355\371-\317\177\261\3778\376\313\375\0171888\370\373\374\327p\367_\340*D\266\330\245\247\246-#*\207r\252\247\356i\251\265\305\354m\317Z\354\251]\267\267"
+	.ascii	"\366\316\2415%Fi\303\2561\325\311`\272\242\324\262\313\275\367"
+	.ascii	"\206(\246\036Z\273\251n\311\356\272'%Z{+a*\332Q{\357\335\301"
+	.ascii	"\322\262n\013\261uK>rl\250\026{_\260\227{G\355\275dw\335\336"
+	.ascii	"{i\357\235N\345X\356\215\325\363\324\025\025\265\367\025P\324"
+	.ascii	"\316\261\304\326b\357{Ff\215\352\311\254\207V\020\033\025\263"
+	.ascii	"\256\355b\271d\237\240\264v\327\026\2635\245\315\226\3106\324"
+	.ascii	"\336\333\242\321]T3\370n^\342\254e\241\321\b#\\\353\332\352\273"
+	.ascii	"\371\025\204\351/;>\240\362\324n~\005J\364r\207\315\235\324\032"
+	.ascii	"/^\344\250*\340\322\377\331\3052\317.'\235-\3333v\312(\311\\"
+	.ascii	"\371\355}\265Af\263\244\n\222\271\237t'\027\021\354}\205\317"
+	.ascii	")\020\353f\022A?\347P07\036\1777\277\202\030\332\246x\200~M\266"
+	.ascii	"\3342\317-g\224P\313\324\324\006\377\031\324pg\334\315Z\032\273"
+	.ascii	"4M8\267\363\255\005\276![\300\270\261\235m\327F\214$Uql\247\032"
+	.ascii	"\336+s\243\307\315\377\231r\246\275p\243\374\t\3021\271K\263"
+	.ascii	"\2757O\016\231*t}7\347HI\021\321\272yi\243^,\341B\3135\354\314"
+	.ascii	"<\301r\206c\244cQ7\236\230T\310\374Hs2\373I\345?\247\330:\253"
+	.ascii	"f\253\340\266\220\334|Z\037\364Z\005\3754\313>\324H%\221r\226"
+	.ascii	"\261\200u\325u\363Yv\222\231Q\271\262t\363\177\272\364\177.\003"
+	.ascii	"O8Bc.\312\030f\323\027\027vs$\310\215\265\023J\316\021xv'E,\354"
+	.ascii	"&\241\021&ws\215e\323\027\020\031C\236\234NV"
+	.string	"\\]\215\201\375tb\265,\330\2311\005\f\353\346\263I\320O\260\020\210\370xr3>\231\344\255\034R^\242\226`\"J\316/#`\224gnN\262<[\366xC\273\371?:\364\355r\207U\253RF\013g\241u\341z\341\344q\206\325\254\332\016\336;+J\326\023+['\020[w\025\002\330Xs\357}\n9u\340\254TH\031\231+\277\023\3119\344,rz\235]\347\221\323\310I\3042O!g\020\273\334<n]\214\200e\310\327\320F_C\031}\3668}X&\320\371\303\216IF\216\233\257\341\213N\301\266@\350\007-\020z\rs\372\032\340\3645\254\351k@\323\3270\246\257\201I\216>\034i;q7j\020\301:\257\344\312\224\361\272\371vy^a*8\206\255;\313L\252\3348mX\346yu\326\310\347\3259\343\264B\233\272\333\342\207\237\274H\361B\3635 9i\b\303\240\321qv\3635"
+	.string	"\321\327`C\377gU\306rJ\331\362DIu\305\302\230\321\3645\205\225\206e\351q&\005\342/\f\023\330\315\377)\343\214\332!\006n\353\346\023\n-rV\026v\3635\300\3204r\232\274\246\003-d[q~qZ.\031L6\245\302\217\253&[\333\336V\234_\216\253E\005\002\034\217\2558\277,p8\272\330\260d\2319s\311\314\320\200\215l\311ci\231\0031VnR\205\020eo+\356\326\b\2746\340\274\266\342z"
+	.string	")B&e\bY\331]b\262\251\n8\021i\336\032\201w\353ja\262)\315\234\202\244\231\003/\032l\003\223MU"
+	.ascii	"\314S\363\214q*\317\247\263)\2679\227\362\340\2713\233\363\305"
+	.ascii	"\331\"\373\235.N\030\031\360t\312\177Y\360d\262\314\034\230\367"
+	.ascii	"\236\3712\232\2702Rjk7m\212\220\256\274\300\253w\323bL\211q\335"
+	.ascii	"r\340}\273K,d[!\200v\2564\361K\002\242/\253I\377b|\361\302\327"
+	.ascii	"\367E?`i\177\320T\214\365A\357\003\247\365x\222\340\321@r\363"
+	.ascii	"}^\320G2\035^b\262\035\345r/)\240-,\013\254\271#\255\013\207"
+	.ascii	"U\013S\206e\371\235"
+	.string	"\241\341\030;M={\367p\202\317\252\220\035\240\211\222\255\307m\342\0348\253\003'|nT\302\232@\260\220;\264&\346\201\207`#\230lJ[a:\303G\350\360\230\345b\353\270\266r\251\203&\370\307VX\226\337m\322\345\266\374V\305AXUX\226_\216\222\221\257@h1%\224\2723\022eG\366!\205HW\266\313f\262\230|&\313\34519.\337\3450\031L\316\222\277\344\274\274%\343\345.\271L&\223\341\262\226\354%\317\345\272\314\30523]\246:\276\3027rT\276\221\263@h1%\224qW\004Oa\342\030\230l\212\204\273'\315\2757]\376\221\331vU\007K\252\264\360\326\002\332\302\262\300pY\246\303R\260\231\330M\323&Cm\205\260\304n\343Lg\315\\,[w\265\227\3664p\222$,\313o\357e\246\303/`A\020ZLQ\240\007\022|\204\016#\301Pz\200h\302\027\226\345\227i"
+	.ascii	"\246\265 \221\263[\335\221,i7\337\347*c\361\211\241\363\332\006"
+	.ascii	"\036\037A\224`n~\006@\r$\033\301\313"
+	.string	".\022\230d4\257d\265\374\202e\346\2647\245\345#\271\f\204\026S\026`\212j\246e+\347\302\201\351i+yp\340\305\206IW\246\302\245e\207\316\317\260\324\267cO6\330:\256\b$\261\262\214\342\244\271\3672\227e$\331\t\007\246'\024\342\256\210\375mG\270\367\326Y\327\330\223&\024\020\266\356\254\304\232X3\227\345\345\337\216\200Y2[\226\313r\330\206\035\345rO\241B\206$y\342\227\317r\225,%3\363\224L%\243e3\313\314e\231\254\351\2442\305\0170C>\006@}\fi\3641\230\321\307\360E\037\203\234>\0067}\fW\3641\224\201-\351\331I\335|\f^\372\177^\222\231Xfn\222\275\272\362\227\2173]\271IV\222\2772\234!\023d\316\017\247\225I3\005\315\357i\352?\177%\301i\003EG\233$\331kg\f\t\224\217\233\337\023\247\337\303\246\337SE\277G\212\316F\236\213\210"
+	.ascii	"\355\205\234\213\233\363\220L\344\271"
+	.ascii	"H\026\262s\221\016\264\366V\346\"<\201{+y\254\365`\255\207\374"
+	.ascii	"\244\007\222*h~\317\230\316A\202\236\271\234\270\240\252n\376"
+	.ascii	"`}\320\3674\321\357I\222{ \227\344\361\270\371=9\2662\217!\315"
+	.ascii	"1]7g\036Ke\254\340\365X\345\310:p\b\227X\241\231\031\314\201"
+	.ascii	"C\030F,M\r\3263\016\334\227\005\304\310\214(WVj~\331\206U\002"
+	.ascii	"\3103\247o\231\271\206U\323_\331\034\r\022\036\\,\033\226w\267"
+	.ascii	"\346\346<\225g\350.\251%\247\031U<qrm\260\2522\025\372D\217i"
+	.ascii	"\352\346\363\270\351\367e)\341\036\030:.)\313\345\207WZ\330\315"
+	.ascii	"\347\241\2429\260>hV\002af\223\223\233\377g\030\226\231c\340"
+	.ascii	"\301\263\034#\357\374\002\215\r\220I\316~\361\307\226\363\237"
+	.ascii	"_\344'\0312\232O7g\027B.4\254\264\334|\036\033\372\317N\226\231"
+	.ascii	"[\344\201\340\361Uu\363\373r\323\177\341\r\002F\217\315\315\177"
+	.ascii	"nzf\232\332\314\0337ge\232GeWv\363y\234t^\302\203\227\207\362"
+	.ascii	"\013\325\315\347Q\352\3574\365w\312\004\3362PlP\271\371;t\177"
+	.ascii	"\230\215eb@\214\345\330\n\276r @\254\206\333v\232\226\233*\035"
+	.ascii	"\263\007\210\335\360\032[w\325\263\233\362\004\233{o\240\020"
+	.ascii	"!,\225,m\370\320,\006\2471\323\245\006\367a?\313\304k\216\327"
+	.ascii	"\3407<\267\263\204ao \201]k0\035\016\263\323\264\334U\250\336"
+	.ascii	"\222^\226\r!B\340@\375\320\261\2443\037Fc\2318\r\3363\203\233"
+	.ascii	"\266\356j\271\253v\254\360\320\313\342\227\006\217\301e80=\231"
+	.ascii	"\340V\246\251\261\fq\023\202\346\357`\321?n\036\353\351\274P"
+	.ascii	"\373\302;\203\363n\254\256\352\334n\376\016S\237\271\225\341"
+	.ascii	"\345$w\363w\306\364-\363g0\231\347e\"\\j@\271\371;N\364w\222"
+	.ascii	"\350\357\034\t\203\353\360\235\255;+1\227\327\334{\203\301x\226"
+	.ascii	"\211\303\340/ap\026\253f\353\256B\330\242\327\334A\362\025\006"
+	.ascii	"\005\315\337\331\322\271I\023\263\313\305v\330\313\326\321\311"
+	.ascii	"\323\361\246\344\346\357\\\351\357P\351\357Da.\270\213e\3429"
+	.ascii	",w\333\206\323\016\264\334\373\n\236\303px\013\007\246\247\023"
+	.ascii	"\262\330\3409\234\305\252\355,-\267\024\016\022/\275,~{/\201"
+	.ascii	"B\204H}\264E\031\202\346\353\330\351\037o9\326\202o<\275\020"
+	.ascii	"\270<\341\256\276\030\301q\030\013\031\030;\357\346\353\310\351"
+	.ascii	"\353`\321\327\251\242\257C\246\257\263D\257a6\346\326\030\330"
+	.ascii	"\315\327!\262\246\323C\333m\177\320\353\354\320vi\177P\240\033"
+	.ascii	"\372:S\372:O\3729\203\372M3\252\233\263\026\330\242\306\315\317"
+	.ascii	"1\243\355\266>(\331\217\243\3301\313\305"
+	.string	"\246Undm7?\307\213F\255\017\372\2347-\3063C\007\363\351\346\347,\365\023\320\205\2770\331\224\256\022\204H\023;\301a\226\211\237`%gO\360\022\ff\353\316\266r\206\006}dv\\\200B\350T\361\003\254\201f&\270\tO\f#.\210\334\374\034%\2235\3728v^8\311\255\2322\344E\026/5}\0341m\247\254\017J\004\027\261wj\330\2740B\244\007\346Z\246i\261\273\3718V8\310s\231\226\016V\326\350\242v\363q^\350\337\f\352\213\341\323\277\241\323V\313\372\240\367\263?\350o\324\260\216\\\243\313\217#7\377\206\251\177\343D\377f\207\376\215\r\215\263\264?\250\005\263>h\r\234-xP:n\376\215\223\276ip\025\216\302T;M=\273\251\207\231\256\252\273\006?a\262\251\022z\224i\342*\f\003\307\330iZ\356%\007\360\330\212\003\263\3024\360\f\313\304U\030\352w\357\3625\205"
+	.ascii	"\022\300Z\327Rg,\003KY\346\337\360\224\020\270%!7_(\250Y\354"
+	.ascii	"\275\267\375\033\232\376\r\275\360\214\276PN"
+	.string	"\307\370\361\013\353v\265K\267\227\345w\363\205p:\307\372\240\267\357\252\301.N\271(Wk7\343\0267\201Lh\274n\276PM?\001\200l\256\206\311\246*\200q\027c\360o\230lJS\351\001\325\024\373\303Lxc%n\302N\226\211\227n\340\257\340m\343\206\227\256\337\325\234\314\016\340\345E$\315\262\213[\313\311\027vi\253e\177\320\201/\272\254\025`?y\242\305l\317\222\351\356\205\256\023\213_\035]\330\265X\336\216\231[\232\2245K\226h0 \275\241HIk\356}\005\002\250\f\f^\223k\260&\030\277\2335\2230\2608+\002\350\351#\372\210\376\n[\"\022\347\247[\3701\233$\271\376\322[\322uD{\375M\t\254\241\275tW\331\226\025\033nQ\327\005F\246\221\334\300>%[\322\334|\002l\0312D\027\301\341\203*sf\213J\b\221\353\"8M\325\221\027\262\374\027Z0H\304\305\315'"
+	.ascii	"\016\037>4\327q\323\316:\2022\301PVnJ4\227\016\222\346\315\321"
+	.ascii	"m\271Y\003\321w\177?\344n>\001Z\350\037\0324\265\226\326\322"
+	.ascii	"[@ZKj\322)\2500\315\213\205fn\b\217\353\255\274\2336-\366\254"
+	.ascii	"`\371/\344\200\f\221#7_\003\266\032\3279j\350\254\324\rh35\355"
+	.ascii	",!>\200P"
+	.string	"wU~\373)\007\b\" ;\270h\035\327Y\\\320\301)k[\032\353\032\307/L\361\300\310\225\335|\rnh}u}\343\027\2368f\224Qr\3635\240\241\177m\343\027\346pq\231\343\273\371\032\310\320\327\300\205\f\031\232\006\220\326\322\236\001\252\240\306\332\264\031t\3414\343\232\306i\205w\234Mq\271YO\351*4|\202\272JS\341\263%\333\223\236\027%8\340n\326R/h(\r%\326\334\373\n\304\215\020\037d\336\240\350&\335\244a\324af\231\2615\372\3055\f\035\035Yffn\326O\rh\222\003s\263vq\235\272e\215\250\233u\213\323\252\310\217\261\0327k\247tG\225\300\276s\355\232\331\205\325\025\031\034\324J \275\241\334\3055u\260@\261\373\323K\327J\265\314C\314\215 7\353}\265421D\006\220\225\262I\331\244\202S8Ar\204\221\221\006>\025\314\343\001kc\305\352\346\024p"
+	.string	"Si\322\244~\266lK\001-Y\323\273\362\323\314*9p\244k\236\372\345\361\224Am\371\2739U\003\367\"\212\340\315i\337\325\342\312^h\006\246|)_\306\241!\020\212I\233\315b\206\314\324\315\027@Y\232\227\2276\201\264\226\324\334TA}\321\360S\003\003\315\223\336\323\346\357\242\204\021c\365_\210\316I\005\262\271\371\002\260\241\377\324Lj\346J\231\320\263w\217\263\265=u\265\301\211?+\1777_"
+	.string	".\364\255\023\233\226=UK\313R2AL[y\344"
+	.string	"{d96\320b]_\274\334<\346^A\263\347\345\346{`\243o\305\326\322\2662mXR6\016LO&\210\221yK\341l\035W\004\230\320\341,)\333\230.\273TL\212\227\202I\357\3220\226\231~I\343\312\376\240\364K\352f\321l\035W\004\304\3044\367^\246_R-i]\232^s\357}\003c\253N\307NN\327~\206\003\323\223\tcg\232)]\352\3052\323\272\263\264.\357tn\001\\\240\220\344\330\020B\207\357\213\030\034\350\\\227e\02047\247\\\256l\3109\335|\017[\364\237n\261\314TN\367\201\261\001\376\f\334\220\036n\372\036\230i\026\r\246\251c\356\346{ \323\367"
+	.ascii	"E\337\003\230\276\207/\375\247m)\333i\266%\315\\\312f\325\356"
+	.ascii	"\272@1\335|\017Htj%}!M"
+	.ascii	"\373\205<O\326\200X\271\371\036\202\350\247W\376\013U\030Bg\345"
+	.ascii	"\346\214\366\264\312/\274rH\272\242n\276\207-\375\224\231\236"
+	.ascii	"\375\302\0351G\320\310n\276\007,\375\224\212\225\30147nN\247"
+	.ascii	"\350\026\036\240>\334\350H\333\201#\225\362t\312\237\232a\037"
+	.ascii	"\271\210\013\203\202kn\326\261>(~\021\364T\n\316\\\226f\224\233"
+	.ascii	"\337\301ol,]\302\0016\263\320\240\033\022\345\3512\357\212\231"
+	.ascii	"}\211\302{\362$\025\273[k\357\256\224\013\234^\223\213\340\027"
+	.ascii	"e\330S15&\031/Xn\226[\262$\005\353\360\005\216\256\211\023\025"
+	.ascii	"\325\264\326\344)\230UKwL\021\023us\312\304\252\335\224\321\223"
+	.ascii	"k\253\342\345\225~]\255\275"
+	.string	"w\213\315B\f\234\226\246\366R\344\314F\222\247_hci\340\234\302R$)\022\024\316\204\233\277\253+\020\226\315\313_\335\315\357\020\304\210\221\2335T\270J\023\311\332\315\357\220\nI\205\244DB\200+\322\245\225r4\236\244C\236\022\001A\214\031V7\277\317\212-\254\313\315\357\320\"\005\222\002I\203\240\331\303\331\013\203f.\310\027\2245Tn~\006h\364\237\372H}X. \266R\331!\314ko\360\f\272\244[\351\026\312w\343\336\002\233F\370\234z\334\374\f\320\262\262R\255\367\334\270\351B\266#6\030\027%\335\361T\313r\311fz\350p\212\372/\304\301\272{\321v\3633@\222#\007\216\001\324\263w\017\265\256-\375\247X\226\231b\341\030\350T\tR\322\232\031\300\320\377\265qm,\300k+\016\354\362\270<\232\220=\255Q\343j\345\236\335\324#\256\353\214\376S\032)\215\253e\302VVi\020F\025"
+	.string	"\265\251\251\264j\315\315\016\236\275(\200E\250\236V\355\210\2755\377\002`&C\006\n'\354K\227,\241A\304HA\335\374"
+	.string	"h\301\200\221By\361\330y\0028%.\306S\250,\304\214U\031,\030UX\262n~"
+	.string	"b\350\264)mJ\237\254\366\364\0307\036hR\027O\237N\272f\340\340\315\357K[\234hWoK\322\026\251\323\316\025,U6v\322\354\2508\335|\f\312\244\312T\211\362\2453\366x\332\3540\220\323\203\203\351\276\235\332GP/\266L\347\342o*\335'\036\016\237U\024\327\315\307`\212\376QA&*xR\261e{\351\346\305\2142Y\026\216\317k\356\346c`C\037\375\263(\240e\242\200'\236\t[9\243\00392\f\232\364\355\211\207\376\250\037\352\207&\2040=5j\366\346\322\244A\341~"
+	.string	"\275\266\342\374~X\271\301\335|\016o{{(\337\206?/!\016\27665>;%G\252\334|\016he^\006\325\313\260\367\336]\251\232\220\030M\034'\203e\177zy<;\211\335\217\2743zRM21\300\2605:\314`%hYE\322\334|\016I\360\360\3201vOy\311\001\342\356\225a\242\206\2129:\006O\313\027\021\0169\364\217\202\001\343\305\241J\327\325\241w\302\275\3718\020\\\332\311\27218\343\016\265\203\362cL\315\016\365\222cw\206\256J\340\027\223\026\0377\237C\323\026tn\013\332EN\016\355b\367T\337\215\226\363E\21697.G\273\350\224\211\022\202\344\346\367=\315+\313\013&7\037"
+	.string	"c\364\001\300|C\343\336P\270\002dy\026\024\356vJ\271#\265A&\304\022f\006H\337Q8\257\257\036P7\037"
+	.string	"F\364\001"
+	.string	"\245\177\257,\306\201q\\,\240\275\264\307A\030\333\321\2666\253\006\264\227\370:4\241\272\240M\032\272\226\206:\241{\333\245\226\324\324\276\232\002\241\246\206:\275G9x\301\031\375\013\336\364/\226E\257\\\271Xv\271\2454@\331\213\333"
+	.ascii	"u[\006\276\270\371\027(a2\321*\351\0226\264\243U\362.W\0321X"
+	.ascii	"nF\317P&\r\247\243\r\357\354\241\306\214\332\315\277@\207\376"
+	.ascii	"\321)Lt\312\351\344g\323\366\001\326\265\367\325\006:^O\2460"
+	.ascii	"\335\374\013l\350\037\225\202J\261j\266lK\335\270\230\201\204"
+	.ascii	"\215\337\336q\033dA\2750Bn\376\0064ddwbbh\024\333\205j+\016l"
+	.ascii	"\354h\224\034\261#R5nF\241lp{\362\004\215\201\002n\030\003\003"
+	.ascii	"\333\243\332 \204\t\023\364H\223\034\274\346\031\274\233\277"
+	.ascii	"\301\006\332\205v\241J\272\360\370:\252\304\026\t\234\212\273"
+	.ascii	"\031Mr\325\304\306\313\315\250\227\025A\334\335\326\006%\027"
+	.ascii	"\027zD\001Z8L\260\340\261\241F\216\036\311yR\366A\271\031\025"
+	.ascii	"\202\026\351\2016\246\006Z\004%\302\346\203K9\226\023\210\203"
+	.ascii	"\017o\310\355\302J\266\236\324\235\321\322B\201\330\262-\325"
+	.ascii	"\200.\275+\260\275\257@\354\264\031#\267\177\034\005\242v3%\360"
+	.ascii	"\207\231\233Q\036\250\217\377\302\234\031<\374\324P\037h\017"
+	.ascii	"/#2lx\351\013\313c\332\272\\\316\310\320\013\274\031hN\377?\232"
+	.ascii	"\365\254k\305\226m)\016K\272\364@\234Va-\310\334|\2404\375\243"
+	.ascii	"9\320\034'\230\363io*\r\232,\341ta\211\363\201fe\205b\251A\235"
+	.ascii	"\260\3358\212u6\217\004\ts3z\2052\261\001\376\335\214\332\270"
+	.ascii	"\022\226c\313\315h\215\277=\261\252\341t\363\373,Z\224\257+ "
+	.ascii	"]QQ\350\214\245\275 \270\252\2433\204Ki\326|\335\214R\241Lf_"
+	.ascii	"^\272L\375\027\2464\376\270\244A\247P\251 C\300\222$Y\356\300"
+	.ascii	"b'\343\f\"\304!EM\227\233\017\264\343\305\0134\206\335{\357\253"
+	.ascii	"\215\301\360\r6\301`\034\215\221\276)I\362v\363\373v\202,\221"
+	.ascii	"ks\006u\201\272@\235\3225T[q`\026t\031\034D\235\3227\264\351"
+	.ascii	"\250\223F\323c\323q3\272Q\246\377\302\214\367ed\313\315?\312"
+	.ascii	"\204*c`q\322rB\261\22591\273\031]\312{\312-,57\277\357j\375\027"
+	.ascii	"\016\337\206\370\335|\013\322\004\005-\032\210\b|\351\3502\323"
+	.ascii	"\377\th\231'\240E\273\331v\311\307W\216\346\023\375s\215=\377"
+	.ascii	"\230\347\237U\303{gq\241_^\313\rn\201\021}k\325\320\377Ts\313"
+	.ascii	"<\325\\)K\265\267\362\252\303\036\331\325\006;\3146wi8\370\370"
+	.ascii	"\3164\357\331{3\355\235\245\003\375\332\233\002q\206i\2615oF"
+	.ascii	"\223gW5f\337|\013`\350\237cN2?\313\274\314\331\324{\357\245\345"
+	.ascii	"\226\002Bsu\005\"\375K"
+	.string	"\313\022w\352\375l\242q\023\\\272\371}g\236\262O\213/\357\f\032%\030\334\225\221\006\207\340\337i\30663\024\247!S7\277\202>\375\337\376\376\350VN\355\275\253\316\345\236b\312A\177{{Z\013\342\327\261\330\n\340\177\376A`\334\333)\257k\357m\323\350/5%\216\016\373\254\333\273ik)\002[TM[6\236\314\266\2500<\231m\355\245\246#K\030\246\366\326\322\223\331\336\030\232\232\226JhQ=\231)7\206'\263M\265\235\354\250\354^n-\355&\255\215a7m\3456\323\242\352\360\324\264E\365d\246\244\302\360d\266E\265\315\266v\317nRN\275h\332S\030\266\331\326\3366\323\242\352y2\323\242z2\333\352b\213\300P\303\306\352LW-\034\215T \325\025\026\350\271Y\215\305\016IcR\316:$\256Fj\t\365\250\270\342 \035\t\t\327$\322X$\301h\201d\021\003\365D\222\310\030"
+	.ascii	"\027L\030R\327d\322\b\206DX\223\305$\022(\251\240\256D\243$!"
+	.ascii	"#\242P\006+\361h\244\342\354\271\031\341\207\204\025P\370IB:"
+	.ascii	"\362y\221\210!\344QH5\241"
+	.ascii	"\036\025W\244\272\032\223\216#\250FBJ#\254*\021\317\213D\254"
+	.ascii	"F\365h\bI<\246\030\241A2\007IT\215FX\241\016\351\242d\322\n+"
+	.ascii	"\324\241\264\270B-1\204$\016\031\211\353\211\025\352\220\206"
+	.ascii	"\027\211\360\220\024*\256\311\342J\\O\260\220$\242@\252FICj\221"
+	.ascii	"P\222\203:$jP\215R\020\223\305\022#\216E\013\320\027\211H\032"
+	.ascii	"\031\021\205\212V\342\321\210\026\216\310\242\365hLU\020U\243"
+	.ascii	"\274&\215G\241S\305j,\"\215\320\027\211\370\240\256D\023\253"
+	.ascii	"z\342\002\253\332c,\022KX\213\306\023tHX\301\347E\"T\026\210"
+	.ascii	"*\206!T\026\210*v^$Bh\250\036\025Wc\022r\204\220\212\fV\365\304"
+	.ascii	"\215\022\322q\004\236\365E\"\210\220F\020!\371\b\031\223pV5\251"
+	.ascii	"\"\317\344\220\b)g\035\032\211\220N#\021\022V](&\263\022\322"
+	.ascii	"Q(#W$<\244\246Cj2)'\323+!\221C\"$\021:JH\237\022T\243u=\"\213"
+	.ascii	"P\030\225\206p\220\352\232,\022\251&\206\210\252\211\236d\n\021"
+	.ascii	"v\222H%\324\225h\002gUK\310\3603DT"
+	.string	"M\240 \252&6$-@&%\211j\nC*\207$\006\206T#\244#\342\t\365\250\210bM\022Q bpCd,\032\215I&HH\026\007\220A\t\253J\364\363\"\021\030$\207x2\020\031\213D%\030\021\223J\250\311$\r,$\211)$\213,D(\032O\320k\321x\202\212\\!\005%\t$\223$\360\243&1pD\221L\222\200\316\005DD\244\272B\004\243\244\243$!!\021V\265\204#R\211\310\303\006uU\215\220\216\216#$\213\035\324\241c\n=\034\210X\221D$\021\352J\034B\302\300\220\272\"\211\353\211$Q\003D\306\342\021R\2045\211,\252\350P\302\021\362\250\002\251\"Up\276H\004QR\nuh\304\220Q1)\205:tLA\310\263\223\374!\021T$\264\036U \241\204\006\022\214\214\222\214<G\244\022QV\201\204\302Z4\236\320s!\021FHG\305\002\034\221J%\334p"
+	.string	"y$\201\247h\207\005\321XLA\230S4\236\240\002\t\005\243\322P\317\320H\302\252&U\023DH\032.TD\252F\225H\277\203\017\020\360\001\b,\322\203\300"
+	.string	"\016\030\300\001z\020\030\020\024\304\200\017\202\364?\b\302+JB\211\210D\212p\244\256I\245\023\034\202p\324\241\232\342\210\\!Id,\036\025\327\035u8t\002\013I\"\n\025B7\352P\035:\246\200T\221T5EN\006u\230$\"\032\221\260\276H\304\nu\210\b\t\350D\317d\222\004\212HI\224\210\210\302\230\024B\223I\022\020\"Q\024A\210D\361FM\223\350:$\221"
+	.string	"\365\250\270\"\035\217(\254*\021\222\270\356\254C\306\3420)T<\"\032\225\206\206k\021Q\321H\205\005\311\"\013\021\210\222R\250%\222\303\023/\022A"
+	.string	"u\270c\302\3123L_$b\025JB\256I\022\311!\013uM:\302\300\202\320\321h8DWc\322Qh8L\221\252\261\205\343p\230&\221j2\3118\034\352!c\221\205\341\020M\016S\343\261\230,\032\251\303\241p\035\256\311\242Q\317\213D$U$\245\025\001C*\222X\224D\300\210\344ZL1\"\311H\204"
+	.ascii	"\026I\306\242\021\002:\370`\370\001\b,F\250CIFB\306\342\bd2i"
+	.ascii	"\304\002V\026\252\321\210hD\252\253\2618\034\"\252\310\242\025"
+	.ascii	"i8\264`\205\212D\032\016\3215Y4\032\016Q\342J\034\032\016Q$\261"
+	.ascii	"H(\253.\024\223\303!\312\202\320\321(\257E\343\tk\321X\3741\222"
+	.ascii	"0DT\221(r]A\310\230D\002q%\226\030\"\252&\216H\245\0226$\207"
+	.ascii	"+\324\022F\022t^$\242\270\262P\221\252\321\220\221hBqe\241\372"
+	.ascii	"\254F\02579\024RM\260 DLadD\034\241\270\262P1\024W\026j^\223"
+	.ascii	"\303\"\322\t\025j\t\025I\t\305\360\204\025N\340\250BF\342\232"
+	.ascii	"4\026\365:\264\300\t\331X\\\301\230\024B\213HI\234\034\216@\342"
+	.ascii	"\004\234\021H\234 D\205H\024\361\213D$\223R$\207)\f\365 \325"
+	.ascii	"5I<B\223I\02594DL\325\025D\243\023IHG:i\270B\035J&\245\320\311"
+	.ascii	"\241*T\\\241\226H&\245\300Q\207*\222\022\212dR\n\241\212\244"
+	.ascii	"\264&\223R\244\311\244\024X5\"\n%\317#R\355\200\036\241\204\b"
+	.ascii	"*t2\351X\\\241\"W\310\320\002\321\304\b%nTd\322JD\252HG\352\212"
+	.ascii	"\263\276HD\022\322\321\360\210T\"\022\022\"\216H\"\325\025E\344"
+	.ascii	"\220\001\324\241\t\016<\340\340\203$\244#\037\343\261\270&\031"
+	.ascii	"\035\223*\362&9\324\240\016O$!\035\341\240\253QRR5a"
+	.string	"<\026\223\220\2162\250C#Q\321\2108\3341\022\025\215D8\"\225\210\204\352\320\005\023*\240\256D\023JCD\325\004q%\016\tU \031\345\250@2\032\272P\304\002\211\004dH\"\035\221%\220\352PqE\261D\022\322\021\317:$\"\2428\026S\"\"\212\342\312b\002\253\361\204$\244#\035\343\261\270\n\251\353\021\271B\222h\302\021\251D\264a\205Z\342\210T\"J\327uH\"\001\253\261\230\022\031\213\306\"\361H5\221T\215\204\224\204x\222C\fGII\274\276HD\262h%\036\031\207G89\\\241\016\255\3114\205\024N\f\031\035\207G\350\211\026T\343\360\bE\022W`!\034\rF:?\253\317\2050$\rQ8\"\225\210|V\026lr\210\243\256\3045y\252+q=\021\264\"\355\354\004\005\371\220\310\371A\256+\364\254\311\241&a$A\311\b\tI\204\nv\326\027\211\030a<\036\035\035\205"
+	.string	"@B\351&\207C\304$\022\024S\354p\220\342\006\245\270$R\334 \342%A\274A,.\t\0267H\351\2220*\225 \201g\347\330\263\016W\235\304\200zTD\241ct<J`x\016\251\253\220\272\252%\214E\244\023-\020\225x\326\027]\360#\222\212\034\261\036\217\310\0218\311\"\013\342\220()\205:4D\252\253QQE\005\311!QQ\205\361\230\203b5\252G\352\212c\n\035\216\216Fuh(dTJ\252@2\032\252Hb\013CHb\0212\251bXDT,\322Q\223I\303\343\212\343B\021\217\013E=AA$\206.\024i 1T\241\342\270&\t\255*\216I\240\026\210J\303UM\252Pq\344i\341h\244\002\251\256\260"
+	.ascii	"\013Bj\221\220\016\006\025Ii\035\222H&\211H-\034\2152(!\325\025"
+	.ascii	"G!\025\211!\0352:\026%Ud\321:4\026\221\222\303\026\210J\031\222"
+	.ascii	"J\030\217\305\225\210LQ4\"\216pD*\021Y\340B\321\220\005\361h"
+	.ascii	"xD*\021\rU \031\r\215JC>*\221\221\210\344Y\207 \254\306bR\272"
+	.ascii	"\032U!\244\2124,Z\207\212-X@\002\234u\370A\320j,&\351\007\005"
+	.ascii	"\215\320\001\003*\224\240\205D\034\221JD#\222\310c\322\250&G"
+	.ascii	"\030\213\304\243\021B\310\344\b\021\033\\(\032\032\213G\303\""
+	.ascii	"\241\365h\034\032\225\206z\376\013\301\310t\002\335\330\244\021"
+	.ascii	"6\0212\321LK\236\230q\222r\246\212\022%rKX\220 \021&y\006\035"
+	.ascii	"!@Y\273\333\342\267\257h$\021z\305\215\255!\023z\t\273\356\236"
+	.ascii	"\033\303\274W]\330\314\335|\003\234i\241\021\035fe\311\331\315"
+	.ascii	"7@\230\376\205E\322P\030c"
+	.string	"\276\370\204D\320.\351\024\256(;\204C\264\270\224\005fI\267\230lUq\241U\204QgJ\314\202\240NVa\302\240\001A\303OL\366\312~\230\275\310\312\003\274y)\266\367r\007eR\304\005\333\315[[\250\023\032/\003\030\321B\034B\034B-4\b\020\213\032\222E\250\343B-\341\0162A\336\266\\a\026\017\\\337\216\265\233o"
+	.string	"\027Z\230\003\333\2651\262\006\204\240\376\205Xz\353\206J\2232g74W\312\305j\231DxU$\213\315]\227\245\022&X\230\032:+\245\342\227V%\264\322_<Tj;\332\20444\030\232\345\246E\215p\206\026\273\221\203\263\"DX\205]\324\315a\351\273Y8%\234\022\3120ai\307\322V\034\030\335\213\027B\0319R\034^\204Q\027\3128\362\302\0167!\024\033,K\226\b\241\2041\242\364\r\322\250\241\261(Y\252\ta`\250\037_l\314\334|\020dB\027B\027h\214\367(w\260\201\340\322\302&a\223\320\211+\325\341%t\302TNc\\Nn>\210\027\372\226)d\202\223"
+	.ascii	"\037\324\017\345\231&7\341j\242F\270\204*\241q\347bJ\270Q,\034"
+	.ascii	"D\251\2049\250a\364\330\252\013s\263f\243\331hA!(\234W\340\265"
+	.ascii	"\340\223\322-\356f\r\370a\214\376\365_\352\227\251\330\265p\342"
+	.ascii	"\207\036\321A\222\314e\255I\005\263\035\032@5(\020\236+<\244"
+	.ascii	"\300\364ie\372\245\004\033\324i\310\334`\215\265a\321h\256\035"
+	.ascii	"\022\267+>\276;\306\b\\\032\267\233\227<\032\256\232\310\270"
+	.ascii	"\371\267\314\253i=\262\256\275wO\016\2314/\234\335\374\017w\372"
+	.ascii	"\327\026\315\206\023\240\2253h\024\354\203K9h\346\344R\225\203"
+	.ascii	"n\210.s\322iA\002F\216\f:Cg\t\333\333\033s\342\t\203\334\251"
+	.ascii	"\361\002\003F\343\331\251\021D\224d\256\374\366\025\r\020\277"
+	.ascii	"\016s\215\207N\341\204UYf}"
+	.string	"h\323\277\376\022\003\007\224\035i\356N0\0308\203\222\305N\323x\341\202\355\310]\236L\360\310\312\350\272\264if\346O\220.7\277\244\264a\273Yk9\315\347\200\031K\232\313u\227\374\206\223\345E\025\253\252\031K,\0327\377\003S\377z\013\206r'\225\327\245E\307\335\230Y\353\203r\363\362\354f\312\031\233\0138,(8\250\327\314\362\206C\251\206\344f0\035c\320\264\333\3314\253\022\306\357f\335\246\333RA-\275+\260\264M\fU\335\315\377\340\265\266\226\3725\331zWE5\370\240pX\261\242\323\200\264\226\3664X\263g\307%\004yl`\350\027\256\323\322\245\037^\230\233\365\025\324Nx\367T\307\366\301\005\025*\032\315\226m\251\rqPk\230\240fO`|\350\263k\264\234\257\246\223\323\315\232yj\201#\303#J\027)R\264\031\220\326\322\236\001j@\251\341\301*\002\206\311\214L\223:$7\277"
+	.string	"I\306\3064\231-\333R\266\n\212\357\tXTZ \232^^\223\345}\231\321\241w\263\216\3624\035\210\320\250dD\217V\006\212EQ\220\345Y\216s\3141E5\304\t\223\025"
+	.string	"0@H\034\020K\346]l\024\200\017T\320\230t>\"\fR\230T\212\031\002\201\031"
+	.string	"@\240HB\371 L\3343\f\214.\322A\034J\246\212\210?\207\223\271\261"
+	.string	"e\270\237\302\307,\360\177]\016\270\037\204\304k\177X\357\300\013\362\376\2700\016\025\322>\234\2422\350\031\005\003Q\240k\020\261\320\226c\325\345\247\rU9\251SI\274\304\t\023(\202]8\270\213\223SsP\210\2526]\216IOV\302\270\\\262\027\251\266bc\315H\214\211\263\f\316b\230\033\257\330\323?\327\342\006!\306#\232oG\233#n\360U\nH\006\212\034\217\216i\231\266r\342\253\233\231a\246\240\270QM\330\257:h\320i\254\326kIM\350\244\327\t\024\203\234\311\367\237\005L\223%!,{a!\3013Zb\271\222\370,\232\231m\333\027\340O\361\201c"
+	.string	"\213\013\005\034\362\364\3575s^\233$(\204\243=6^\021v\255\320S\221\f\371\234h\232\357z\341uN\261\376\017\330\240\2163\023U\032^\003\300\271q\262\203euS\302}\204\376\201|\332\007R$\036\256"
+	.string	"\341b\002etA\243\312n7\225$\b\234\206&\n\024\223v\210| \311\352W\253\301P>\033\362\277\276\310h\240\350=s\256\027;\237\233\256_W`\217\360\030\277\231{\211\3044\337\252j\345\273}\354Y\251\263A\232\370a\345\267\325\244\263D\330\002\026\022'\220j9/J\355\310)\002\242\202\204t\203:l\335\214\020\301\374~\234\356\n# c!\bZ\251n\243>&\004\366\305\306\33061\t\212\272V\231\355\217C\024\375\230C\344Y\004\024kK\231\207\343T.5\177\350\204\276S\275[\337\305!\213\2116\255\212\261\202\330\360\266_\364pG\023\2561:3\3462e\006\232\357\220C&\252\342\216}1\217\205\205\030\225\t+\326&H\322\215}\005\037\203\267l9T\2617\345\004>l\206\2227\344^\305P\200\351\200\224\222\037\203\342>\324']\020\364\201\371\210i\r\360\022\204\237\301"
+	.string	"\300\"\017\301\361\013n\3127\341\377\371\003\212\313\247\370\f_\201t\232\321c6\357~\376\310\316\254A\360\227\3313K\363tI\240\340\235\213\273\020.\364)\374#\201\"\260"
+	.ascii	"8\021OF\243\342\244\353s\2674}e\333x@\255\221\316-\013\235hC"
+	.ascii	"\212\231\23182|\360\252\307M\025\236;O\343\375\232n<\302s\232"
+	.ascii	"Q[p*\213\020\335eX\261,SSi\254\322R\337\366Qve\230o\223,K\034"
+	.ascii	"u\030\221\317\003\032\254<6\327\372\027T\326d#a;\320\346\212"
+	.ascii	"\3664i\371\b\306l\305\251G\354\031\017\035\304\225|kb\315b\264"
+	.ascii	"\023\352\350\314\342=\223\367\264\240^\2550\302v\025\264H\324"
+	.ascii	"\312\273j|\366\204)\334\342\t\306=\344\202\323\263\233\257\333"
+	.ascii	"C`i\313\345),V9'\372"
+	.string	"\002\217\326\"\216\026\331w{\254lc\356\224\033\02649\"b\333\003\367\327R\212\214\202N6\023,!\371\205\243\2624:\304\004\023\322\271\322\377x\225i\306Q\232g\262 &\210N\254\201\322\305@\207\331C\231{;\320\376PW]\362\231\377\243v\346\032\233\246~\337VL\016|\336\201L\030\212\353x\245\007@H\242\222\023>\243\3573\n\217\361o\t\036\277\337\247\261\236\177\237\367\215_\037\007\035F\216\340K)\352i\003\200DF\2336\263p\201I\340\3030\232\233\244k\376t[\357\340\301\275fPq\373,3\322\361B\206N\205\347\2476\221|S\342\371\233H\367\246\212\021+\301=\320\235 x\006E\364\353\360\325\034=\267\340c\365\2022kN\203o7\265\021\277\230(\017\241\226\330T\256\202m\240(CD\372C\3660\371\320\266i\323H\373,\342&\370\001\202\024\265\225\350I\332~\002\266\227\332Hw"
+	.ascii	"\261k\252\2023\330B\n\330@/V\255\204\206P\312\252\367\006\346"
+	.ascii	"\376yo\035]\260\370\025\002\244\333c\030*\314\363\301\355\236"
+	.ascii	"8W\264\274-\347;\231\247\367\303\240\324\330,c\242\342\177\356"
+	.ascii	"\002\013\315\356\332\243\333\315-;$R=\367?\226\235o\256\203\300"
+	.ascii	"\272S\270_W9\025\372\240$\231z2\366\244EL\367v1$:\231\310\364"
+	.ascii	"\377Q\024?44\345\227\272LBe\264\355\244\352\363\332\351\330\222"
+	.ascii	"\300\272(\353\001\215\b\367\"\236\t\006\025\344"
+	.string	"a\0301\253\353z:\2002R\234\201`\370V^Y\020\340\016\0278\336:\271(\246\345.j\2212t'O\2343\261\037\255\315\327\016Q\224\332A\253\260O\203\026\322\301\234\207o,\037\350-\205VG\bI,U\006!\260\320\313\177p\260\013/y\202\253\020B_5,\002\353\234a\036\3072\205\323\311m{\327\nt\020\25120\r\002\376\020d\267\2217[\031\326\261V\331>[\022\035w\025\006\334\322X\340\311\314\007\3521B\326\260\226\263\217L=h`X\224K\033\026\030\322\210\264\327\210\240\377\310\231X\223\362qy\316 \240\357m\376\200\356\b\321\203/ta5\324\371\002\032\255"
+	.ascii	"\245VK20\333\343\314q{e?\261\300\234O5\230nA\330n@T\367\213\244"
+	.ascii	"\307\326\223A\\\302Lr\342\025\370\222\257\020o4\"\275P ;\347"
+	.ascii	"O\235\221\033M\001\311X~\2648+V\253r\233\346#\006\235\017\256"
+	.ascii	"Tt\216\266F\352XA\007\007V\257\370\002-\316\377\016\031o\026"
+	.ascii	"V\207\201S]\266\347%\017R\322]\374\350`\242bDy\021\336\254j\221"
+	.ascii	"E\021\374\357\211\030^\346\226\324\030\t\306\210F\212\324\316"
+	.ascii	"\270`\221\366\31380S\276C\020\200$A\313\201\262\303\363|\253"
+	.ascii	"\317\037\327\372$S\315\236@\374\204\363r$P\034\304\227\364\203"
+	.ascii	"9\027\023M#\002}G\304;\253\016D\357\320\215)\301[&\254XT\341"
+	.ascii	"[\002I\256\001\337Z\331\243"
+	.string	"\363Mt6\255\320\232\232\363\352\204\002@\225\373\374\254\326\336\370\330\222\2004\036\030\237\267\034\020\352\371\245\230P\255\364\021\005\2109\033\334\211L\341\026\303\b\220\240\210\";z{\340\337\320\255\362=<\357Z\356\016\253!\372|P\363\034bq\r#\327W\367\315b\346r\355J\300\344[R\326I\367\235\205\336\346\360\223~\345E{r#Mk_\347\353V\025VN\363\263#\322eU\256P|8MN>\302\247\205\267\020\3276\250\257\275Rz\255Co\227\277\033\236'\177\234C\226C\221G]\340yK\334\275\007\030\363\373\336+\246\342\347\002{\364\274r\035\343\351~\347L\021\003k\"\270\311\335c\204&\244'\216\363/\320w\361GEMFL\315\3129D\215\203\237Az\326\355 N}\235\206\360\325wV\314\017xQQ\213\"\323c%`_\353\374N\213\330\306(4\261~`(\227\222\337#\304\352\031f"
+	.string	"-x\243\326\311\362\3411\247\t\013)%a\240$\261\035\276^\265\204\305\370'"
+	.string	"\330^\361\340\3152\032^\254O}\3341q\354j\237fB5N\330\357\366\303\240\346$z\261\322wc\223y\354\bk\326i.c\325\241\320\271\034\317\0171)+\365\375\254\215\322@\323\r\377\302\317\276;.4\017\3374\024\017Y\266\306\324bn\033\343\307\300\323C^\352a\024\256\212\361\214H\256\204_\253P\346\n\260\344\243\266O\251\351\240m\n\305\325\037\005q\250\324='\243\227\207\317\234\355\003\351\270\267M\030\362P\"\364\2515\032JL\243i\257\352\306\020\350\320\021\022\310$\002\005\022\202\367Q\210\373"
+	.string	"\253\274\332\032g"
+	.ascii	"\374\271\311\2374\223\211\013\274hq\224\177\360v\265\360\244"
+	.ascii	"\201\220\367\013\340\016\260\211\333\250\300p\007\33430\252'"
+	.ascii	"'\372\250\343\332\2111\241\324\023\216<\2404\250\214\343A\n'"
+	.ascii	"\013q\350\345\310\314\250\267\372\005\013\021\316\324\356\303"
+	.ascii	"\372\202;\224@\b2E.\247Hr,LU\313D\321\225\200\246\207\222\222"
+	.ascii	"\200\241/\024\340\321Kp\246\265\350L\rA_\"\342A>\n\022\224\020"
+	.ascii	"hT\220\207\267\023\\`\306\2504\343$\244\274\257\004\253\222\341"
+	.ascii	"Tl\367P\232\3731i\272V\2534\241\\\n\304\2032\327)3\001\225X\t"
+	.ascii	"-\327\371B\0160^\n0\231\336K\2648~\227q\003\256\3171\232U1\306"
+	.ascii	"\325\316\354\200\252\\\363b\351\322\221a\336M\251\274\253OF\200"
+	.ascii	"R\3256)\325wwz\301 <n\002\304!S\251\030\256\205\005\230A\324"
+	.ascii	"\243\351Ij\233G\355\247\006\3047Zp\377\370\b\243"
+	.string	":\322#U\305\330@Nbh\030\244x\321\322\350F\270\3362\177MY\233f,\023\327\272\215\371\316\266\376\371\240\220\305\363\342\222\306\270@\310\236\034=\002A\255.'\356,X\"\2156!=\314\031\220\342\\EaV\272\234\225(n\022\"\263\322D\303\037u\355\205|%R\305Z0\0245\301>\007\0368\301d\017\020\314\315\302\226\316\261\300}w\263\237\277\262A\316\032\363\241\365D\321\240\370\277\2448)\335\031\264\311\267\3648H/'D\370\305\263\255\327\034\252\304\345\371}\256+1\324;\377\277\375\322\026F\337\325\300\317-\352\3343G\276(\235U\020~\216Hc\r\356\307\001<2\2569ukg\260\031\030dwok\362:\20291?\f4\365/8\373w\002\247\005\252\317\321)\260)\256\316\244D\001LMX]\314x\244\367\215\235\375u~\362\221o)\240\300\303\373\230W&\226\324\236\365p\365\247\020"
+	.string	"\317B\304C\322@\336\3635\204\006\273p\323_<\022X\372\"\024'\320\322v\270$\021\261|\307*v\323\235\017u\033\361\001\341\b\263_\217\264\201:m\371\375\324\300\271m\353\242K\034\305\006\253$R\001p2\341\256\216\275\266\341\235\241\312\344/{K\300iM\022\t\005\0167~\204\207.\335\b\317\270\316\005fE=F,\323'\377\346\351\002\254\345\032\231\272\037]\232\227\342\373~\177\202\353\345\255\345\020\270?-H\002\005\311\351\231\221\245\236[\312\027{n\262h\037^\237\342\360\373\027\252K(X\311\224\211R\200\205\002\331\372\340\004x\240\307\252\270\277\205\321\361'\226Y\231\322\003\f\332\005\242\013\337\223\317\334\025B|A\221e<\245 ~\327\216_\006\313\tO/\302z \326\316\275\303"
+	.ascii	"\")\265\206\341\033\273\002\261F\303D\rj0\017\023c\301\3021\250"
+	.ascii	"]\314\177\016\277\242\251\317\r\313\256D,&O\214W\311\021W\264"
+	.ascii	"\321\031\237oC\324l<\245\3752\270\235\325\216oE\371\330#BZ\210"
+	.ascii	"?\312=V\013\372\230\245\345\261\336\031\256\030\005"
+	.string	"k\346-\235\005\306\211\264=\357\215\322\202Fy\001\361\310\370\356\"\320\374(\3349,C\326\315\346j\221\r\016\212\205!4\3046\270\035;F\325\275\373\266wA3\013\216\351\005\250[\355\213\311\237\316\"\362\215\316\307\303\216\3016.\364b\024\261@f\031\263\0324s*\304\2215\235\311\265\347\037\256R\220\027\211\306\364\207\035\314\230\306q\260\365\330\355N\\\364\337)\232#\240q\306S\221\003\321\255\334T\201\305r\330\350\345\013s\315\3535\353\032m]8z\247\361KK\025\007\325Qp\300\371\f\225\270\201>\371y\326\267h\224&\240\217\333\240\322\252?\303 \034\016\270\003W\317\002i\304\254`\307\004!X\252*\355\220K\f\310\240\302\0020\033c\243DT8\254\020RMZ\235CO\023o\005B?m\033t\220\210\302\325\366\365\253\362\\\231\375\232\224\357A\202w,\365\205\350DI\363j\021k\270\321\201g\315"
+	.ascii	"\250\344|-\361,\025\013\227\242\r(\214\334\345\032w\301\242\371"
+	.ascii	"w\306\021\237\216\315\020\213'\322C\326rF\356/\247\326Aj v\025"
+	.ascii	")}\210\241\324`\265\2706\226=\034\270\037\254\b\335\206\246\245"
+	.ascii	"\266\275\020\027&\201,\356\2758\005\322\006\373DEfr\267\324n"
+	.ascii	"\324\243\n\365G\016g\217"
+	.string	"A\fs\340\266=!\317\371\027\301\254\177K1\303i \023u\303\365B_\002\2018\3354~\177X\233\305\031\031\337R~\241g7\2309#\030_\253\266.b\250(\323\315\253Da\0038,dg\f\nT\320$\205-g{\363\3135\"\226C2\031\324\331w\367\310\022\017F;\346\303\327\200\224&\347\002$\302\220C\243\331wnY\3344\024\026\032R\2035(k\312\330k=\377\222\317\026\031\3577\307Y6\266\235^R\326\266|\020\030\242\224\037\033|\240V\301\255\257\322\252\030I\001$8t|\351]\336\253P\323\245W\241\332\235\230\322\347\242\2038\313T78\024\245o\337+\350\3240+d\256\027\201\320\315\364G\341\362&mD\311\300N\323\201\b\231\230\b\033K\340oQ\324A\367\372\317\210\b\324(\2245\211Q\002\207\275\326\320\222!\224rs(\373\223\330\023\025\246O\006=\202A8"
+	.ascii	"\346\266\200i\323!h-\301p\373l\217!\001\237\235\023e\357\221"
+	.ascii	"R\303p\372\303\177[\305\273\340Si\003Z\323\037\"\242\370\230"
+	.ascii	"\005'\222\305\020\354\024\356\373\243\r#\315[\352\247j\225(\237"
+	.ascii	"\265\250\320\221mA\304_\026\321\315[\002\034d\236\265a\211N\332"
+	.ascii	"\224\313\372_\\\3267\300\253\373e\364\030\244\354M\317!2Y\037"
+	.ascii	"0u\035\226vF\b\250m\326\376c\210\351\344\030L\325`\354\271\375"
+	.ascii	"\375\212N,\202{l\302\306\036\260uj\3371\322]0H\020\036\300\224"
+	.ascii	"a\220\270\243\035y\304\315\346\3462\3311\020\"p\233\212.\260"
+	.ascii	"\205\336\265\241[)\211\275\307s\303+?\\R\bx\244\315\374\003\f"
+	.ascii	"D\310\3212\343\034\t^\027\036\361\233\002s\017L\351\344\025\340"
+	.ascii	"J9;6\271"
+	.string	"\313S\250\006Jh\373\036uT\224\036\222\022\030\245\033+\341\rg\221\240JZ\306\246\327\230\327\272\314k\255\356\366/\256\1771\034\241\261\235\030#\205\203|Z(N\260\344\034]\203\033\374\244\246m\361\200\3521FS\270\306\363\255\r\322\317\024\241\254\005x\037\301\270\326a\257S4w\033q|\365.\251\325y\030\360\325]\365\341\333\266P\266\027|\215E\312\343j\264B\331\231\350\367\f\247\177\231\335bt\006\374\207\200p\367%/\240i\1773v\335t\3414\350\3366\223\327\017\336Z\253[C\350O\235\177\313\301`y\350\304\037\347e.\302\2715':\304\310\352\241\036\347~Q\341\037\253\330\276&>\024)\361\354\375\277a\261\352\217~V\222s\332[\261\352<\360\334@?\275]\242~6w\207}\315\\\2243\337\337\037\363/\252\347\316\016\276\245\226\377\340\342\203\2727\017\276\274\323\333\327p\357\267\341\3077^9"
+	.ascii	"u\225\233}C\371\357\216\233\310w\330\362\217\244M\273M 2\335"
+	.ascii	"wN\321\345F\376v\3744?\277r\371-?\256w\257\364\277M\205%C\247"
+	.ascii	"\031`\377\204\261\332\272\276\375\2378\316\324\030tz\007\273"
+	.ascii	"\301-\375h2=a\177\236W7\306\376\234\257"
+	.string	"\256\254\347\317\276\035\023\315\246K\037$\327U.Nyu\024\310v9\323g\324g\344\311E,\364\307\214w\252\342\022\271w\366\275\337\341~F\312\017j^\376\276\257\210\254`{DF\366\223\257C%\266\255\366d\256\0317\225\275\203\335~\201\023\337\0209I\377\277Z\br\273\245\306\314\240\336\274\325\236F\377\f\314\373;\370U8\374\252\364\300\322\324\2231\303=\231\f!\314\026?\343\030\257\370\376\246\321?\357\334\352\332l\341\004x\277\300'\227O\367\271;\3754\204\355\326\017\372\221}i\340\n^\314\2662\252\366\364\210G\324\331S\f?\026\363s\312\300\005HS\277h\246z\377\240}\307\347\273\341\235\306\211\001\304p\241\376[i\264\213\251\277\376_\342\222C\204;\374\345u\332\317_\320\301%Hgzzv\240\335\324\342\201h\266\003\2722y\301\232\347\334\306\211:\221\271\250\210\24780\004\212\236V' \374"
+	.string	"\005LzP\217\271\303\334o\212N \304\330\245\363`\246\331/\343[\016W\2319\026\263\312\333x\331W\330\267\233{\244\242/\021\356"
+	.ascii	"\255\243Pf\367ac\035\277\224\366v"
+	.string	"\377\027\233\330\3640\266\372i\367s\351\3237c\216V\367B\311vh\3677\374\007\275M\372\022W\366\017\3575\270\372\203\264\227\220=\202\277\262\371\261-\1779v\250|w\214\277\351\313u?\325W\335\\\257\310\377\224\3509\r\177\203a\266\217^\263\316\322L+\214\323M\347\353~\245\r\313\262\245\316\363\201\340\247\307P\351\377Iq\023\342\331\201#\321\361\272\353\254\300D\266:\334v!\222\223)\335\001si\367)\337\027S\307S\006*v\217\3369`NmM\260{\312\236\365rN\220o\305\024\377\260V\3153;\334\362p=\205\353\342e\371\024\202\354\362\205\rp7H\346\255\367\204\210\263\367\234B\273}\215)\nF\340xn\305Q\301\331\374\257\221_\352v\243\340\275\226\363\020Y\203\231N\214}\220\332\340\276@x\362\243\235YX/\373\336J\005l\252\242\002\270\002\310^\2250o\232\333\365\337-; \341\225"
+	.ascii	"\223*\227kfv\374u\220\264\034\3646\261\372!\237\367IT\003}\203"
+	.ascii	"\"8\364E\211\317\345\374\2476\371\214\377\007"
+	.text
+	.section	.gnu.lto_.symtab.4dc7d290195467d0,"e",@progbits
+	.string	"pgResetFn_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"firstArmingCalibrationWasStarted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"gyroSensorBusByDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"gyroReadSensorTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"gyroReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"getCycleCounter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"timingsRecord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\004"
+	.string	""
+	.string	"mpuGyroReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4dc7d290195467d0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
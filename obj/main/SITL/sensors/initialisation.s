@@ -0,0 +1,475 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"d\002$"
+	.string	"\004"
+	.string	"\304\225\207\302\002"
+	.string	"\001\314\324\377\306\r\004\002"
+	.string	"\002\001\002\002\002\003\005\247\243\326\333\005\006\247\243\326\333\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 \210\255\002"
+	.string	"\264\003|"
+	.string	"\002"
+	.string	""
+	.string	"\006\200\200\200\200\002h\001\201\200\200\200~d\002"
+	.string	""
+	.string	"\001\n"
+	.string	"\017\217\205\327\317\b\224\334\236\252\003d\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N\002\013\220N"
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"O\004L\204\f\001d\262\032J\312\020\233\f\337|\032\246\360\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 _U\002"
+	.string	"\244\003S"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\377\377\377\017"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"<\005\f8\250\344\254\007.\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\002"
+	.string	"\001\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",A\200\2027\200\005"
+	.text
+	.section	.gnu.lto_.lto.381c16880f31a224,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsPreInit.32.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 \372e\006"
+	.string	"\022\213*3pi\323\001h\251\201\246\203\f\276\252\203`\361\030\301\330\335LH`\021\"\214\031\307\222\253\376\356LE\324\377\377\376]\270\025\363f7@\030\262o\315\312-S\227 9#\025\325\210\211\"\025e\204\225\316*\247\ne\2142P\242\025B\225O\315D!5'\205\317\326\313\232S\321\r\360\265\231"
+	.string	"X\b~\177\200\300[\354\021\256\273\330\3727\353q\302\277\214f\355w \016\022\256\333\340\302\242;\347a\341\377>\257~\211\t\301#\242\240\201\242\273!+l\265\257\372.\303:\260\314\332\327\270t\367\037\226\035\354y\377S\376[\376#\004\r"
+	.string	"3\001;8\243\306W\240\035\300\f\224"
+	.ascii	"\207\321l\314\205|\025l\277\214\033.\307\242\235d"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.33.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375`K\001\345\016"
+	.string	"6\\fF\360\2226\035x\205\\\337\035\bVo7\267*\272\003b4@U\330/!\2460)\3365k\356\024\361h\366{z3a\243\006O\330j\267w\360\313\022%\202}}x\230\203\262!ZI\247;k\361\266~\322\244L)T"
+	.string	"M"
+	.string	"P"
+	.string	"\240\247D\222q5O&#x\244\016<s\202\3173\233(p\2618\362\2629;00\204\314\271\332\266\304\305c\253\242\177\325\261\026$z\220\345xL\304\0273\320\312\021\004@i\302\004\234P\220W]?\224%U\215\301\234\323J\226!\356\354\266#\330^`\177E4$}\335\204N\013\307.\312\027=\332\216\200pa\223cR\035kj\203-zR\333\263T\310\270Z\245\035\355UI\027e\037\233\033c?uk\230zW\255\252>\310\033\201\370x\355\217\325<\275\206LV\246#\305S\277}\333.\276\312\001\317l\n\025^v\264\356.\002\230\035\333\302g\\\370\314i:\361o.\003C\206\224\024\3173]P\315\216\031\r-\032c\206\205-\312v"
+	.string	"\375\332\"NO\232\304d\225\333t\2379\347\211_\363\027\034\374\023\317\274\342\351\311g\276\347y\366\335\362\306\025\033\270P\304\205\\\003\357\363\240\"bQ\311\310\353\302\020\330u\bua7\3526\360\363\300\021\007n\243.\264\262\211>p+)`\217\205\373\266\320\363\276\r\264\"\035\233\033\243-\013\013\031W\213\264%\023\320\335\323\374\206\003\305\231\223t\322~p\033\020\006\340\320x\r\t\023PP<\001\031"
+	.ascii	"2\241y)\360\372\037/2\001l\006\002\006\376\232\374\r\355K\265"
+	.ascii	"\026\300\030\022\3110@0\215\215\256\304\301\216\365\fQ\260\236"
+	.ascii	"\364\3054\342\302x5c7QD\203\212\030\356\262U\215N\321\324\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"5\005"
+	.string	"4\007_\001"
+	.string	""
+	.string	""
+	.string	"\002 \177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002!\177\f\005&\r "
+	.string	""
+	.string	""
+	.string	"\005+\016*\005\037\017\201\204\005\036\020\001$\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001#\177\022\"\177\023)\177\024(\177\025'\177\026%\177\027\003"
+	.string	"\t$\003"
+	.string	"\bD\003"
+	.string	"\007d\003\001\r$\003\001\f\320\360\372\250\001\001\204\001\003\001\244\001\003\001\n\204\006"
+	.string	"\025"
+	.string	"W\207\226\264\262\002\203\200AZ\203X\254a\200z"
+	.string	"p"
+	.string	"p"
+	.string	"p"
+	.string	"p\370"
+	.string	"\351p\251\207\005\303\345\307\032\027\205\310\340\260J\213"
+	.ascii	"\r\227\235c"
+	.text
+	.section	.gnu.lto_.refs.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	"\003\006"
+	.string	"\002\004\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.381c16880f31a224,"e",@progbits
+	.string	"(\265/\375`i\026\265l"
+	.string	":\264\260'TPPJ\352\256\212s\313\356\306\306\356\371o\356\357\320R\210%fzN\216%\212+\003\364\247Q\323CD\032\361z\221\032\211\361\257 2\262#\314\336{\366NkAn#\364H\275ju\fU!\306 \226\020\bsY\354#6\334\007\207>B\332&{\247\224\0022\002k\002]\002\315fk3\274\374\236F\"\024\036y\312\376\344\262\203]\007\226\315\263\026\306\277\224\306\204\214A\261\362\334\302E\312\026\016d;\264\227~vZ\253\265\230\006\323h\375\245\233\035\246\273xg\3212\345IY\233\335\240|@\207\306\202\203\376K\201)\251Ti,\355<J@\003\225\316b\006\342\016\323S\232\254\235<(\310\252\362\374_\362\t\023':L\2375\026\234\340\362\233RD\251\261\365\363\323\363cCf\207\224\243"
+	.string	"R\366\250\313^\274\354\177sH\237\250\350\360\261v\271\317.7\331\355i^\356\254\353\323\037\324\266\322\316n\206\350+l\342\004\243A\256\317\2729C\344L\231\253\313\035B\355\266\016\241r'\257\003]\343v\224\276\241\233#Z\n7W?\341\233p\371K\267bKb$\351r\217P\321\266\266\036\241\262\tW'\254?8\t\221\263|Z\252\362\224\271\233\264\230\r\331\331\031\020O\271\267\230\201Z\254khf;\275\322\031\232\317\377g\322a\335l\261\376\342\266\241\3018]\362\003\314@\334b\335\325K@\320\370OJ\001\300\002\016]V\326\376\227?=?(\361\212\021 j\332\337\037T\235\346Q\271\305m$\355\325M\237V\302}\244\267\230f\270|\346\3772\207fKZ\224\227\247\214\301\345N\302\006p\375\t.\340r\373\2509\355\243\262\315M\233\311\334Ez\311`\216\374\037\376\377"
+	.ascii	"n\345\213\324\232\247\315\005\304m\204G-\036\227\237\203\206"
+	.ascii	"=A2\343\251\373eg\177P=4\217*\242?h17Vg\371\240D%\344{\375/w"
+	.ascii	"n\306l9\032\342)"
+	.string	"/\373\203z\233Genc\357\222,03\030\346FN\341\220bf\260(\346n\241\230;\211\231A0\363\210\0373\033\300\354gD+\260\312\354T\230;\007s\037\231\333\006s;17\221\271\221\230{\310\334B\346>\201\271e07\t\314\rd\356\036s\363\230Y\ts\307`\356\225\271C`\356 \346v\301\314;0s\023ff\302\314Y\314\334\303\314d\314\214\266\265\265\2651\267\016s*\304\274s%O\034\312\030\247Kq.\032\320\236\356t2w\022\234\240K\215\255\0340\245Y\221\232\224og\227oZ.\337\234\227oQ.\337\274.\2075\217z\213r3r\275IO\232d\252j\350)\337\2108\230+\271\026\210#b\312\244H\217Yz\22206\214\021\233\f\347\366\217L\"\346_\276\304\233\256\304\303\334\006g\322M\007k3\354[^\204{\262\034\314ix=\273\314W\223\031.\231\341GUM\245\243"
+	.string	"\346H~T\223\203\322,\247\355\005\036Y"
+	.ascii	"\244H\334\253KK\361\210\0302H\272n\220\220\345\020\372\021\366"
+	.ascii	".\017b\220\3144=u&j\205m\207\320\215\334l)\271<q#\316\365\203"
+	.ascii	"\351\207\032\217y\r\335\003J\260\007\230\313i\331M\227^\315\243"
+	.ascii	"f\371\231\026\216\256)\227\210\323\320M\307r#{\222\247\300=X"
+	.ascii	"\276\344E\343\004`X\356\344B\332y\324\371!\032\333\363\347\247"
+	.ascii	"\273\236\234\001\243\246<\374J\007\345\f.\203\017\351\246\013"
+	.ascii	"a\027\3425\034\n'\270\363\277\303\214R\210G\371\016\234\341\362"
+	.ascii	"\235P\254\375\017\001??6J:\242\2027\215\301\203t\323\257\034"
+	.ascii	"\310\013\256l\347q\371N\255\224\251\260\265+\357\341V \216\210"
+	.ascii	"\03189{\336&.8\351\021\246\374A\003,\b\027\030\334G\315\215\243"
+	.ascii	"\323\t\363\302\300L@P \303\342.\356\002\243\245VS\236\264f\270"
+	.ascii	"\234\376\270\234Z]\337\341RN\325N\257\025U\320tx\013\335\364"
+	.ascii	"\035^\345\265\345;\334\206\024/O\234\037A\260\264\324\224\323"
+	.ascii	"\251\233\n\031\"\241\342\251O9\262\233\236t\026\376\346\006-"
+	.ascii	"j\354\312SNo\334\022p<\246r\312t9M\272\314\3549|\205n:\224\253"
+	.ascii	"\320\263\374_\002\3457\374\b\342\210\310B\212\214C\271\r\020"
+	.ascii	"\312L\205\365\374\374\340\252\230"
+	.string	"\024qAM\031\265r\231\375\3108P\025\210_f\2267(G-0\370\223\033m\314\222\036-\312e4\3542\212\3442\272u\031\215\301\233r\220$\267\206\360p&N\271\2207\250\360\211\n\230\247\214\"/\243*\334\356A\213\227\321\031\227\375\314e\337\341\212@sa\fZ\310\033\316\313\335\364\240\377u!ie\325\306\376\214\346\341?\353\377A\200`\262\302\362\224\325\372\f3\323\324\210q\3421\346\f[\237]\321\262\346iPh\n\327H$f\3612\343\t\r\023E$\342)_\024\220\220\034\255\271\276\tH\331&5\004G\t\353\254\030\345\362\020\035:Z\017\022\325\201\315'G\013*\007\262%\227\321oT\210\n\235\215\321\177a\025%\356\207\320\f\b\226\263\265\2675\275\315\331z\371A\325\352Y<2P\363A\230\270X]gs\234\216\0215\310&e\316\306\354f:Kc\021\241\235\240$\177xzk\036\265\217"
+	.string	"\261\227I\253\3044\3050\246\351c\334\314\271>\330\232\325\330R\323\270\276\330\300\264C7}\007/K\271>8\301\327\214\247\265\377#\003\367\230\205\311\f\2362\216\306\363\351j?\2344B\202\350 \242\346i4@\202P)y\352i\356`<\f{\232\177\3610\364\264\364_\330}"
+	.ascii	"N\367\001\2671\030\204F\324\224qG\227\325/\227\375\314u`\357"
+	.ascii	"\302]\034\355\376\177\177\025\305\fY\373\343\321'=\323\225\202"
+	.ascii	"\023\253\261\243\335\260\\\371\320\272\314\316\254\276\260\370"
+	.ascii	"\377N\267\345\027\217<p\337\272}\230o\032m\004\2309\3757\372"
+	.ascii	"\017ny\206\271A\300\204+\260\210\347\233\363\177\230\fR\2204"
+	.ascii	"\016\2238\210\314\344\007\207>\202;\305O\006\211\314\377\235"
+	.ascii	"\037\016\203+\220\277Cd\276\361Q\300b\354_&\203?D\376\316\017"
+	.ascii	"_(\2028L\032\211L\241q\207\310L\032\237\231|\235\037\n\2134\206"
+	.ascii	"_\334yf\362\3133\221F\035\"\023i$2\223P\235EL\313a\304\341I\245"
+	.ascii	"\244\203\304\3413-A\t\213:N\342\022\371e\377\355\205\364E\004"
+	.ascii	"\376\241\220\3052!\216\016;r2\035-\021\"\233\200\245#*\344\017"
+	.ascii	"\235\304+\344\377\325\221\320/A\020\\:\277G;\203UP\257\204\364"
+	.ascii	"_\300\322\177\260\337\371\377\301\377\307\025\241\226\3779t\210"
+	.ascii	"\312\245\245\377c\317\322C\005\305\220\376\335\313,\314HdR!\201"
+	.ascii	"\304\272\230\312\237\261\f\266\362\313\222\305\313\f\326\360"
+	.ascii	"JiWi\254\001\306S\317\001\3675\345\251\"]\347\202S\245\204\006"
+	.ascii	"\326\266\305\311-K\312\226\346\030w\323\307\\\013J\274?\334*"
+	.ascii	"\363\374?2\220\206a\r\201x\232\245\346x\344\352\306\332\365("
+	.ascii	"T\326\224\313\033\234\013\207\346?\351\005\213_q+^\245\233\356"
+	.ascii	"\364)\354\001-\257\307Bhh\335\355t\b\354v:\234\315\232[Q\023"
+	.ascii	"\202\325\025\021\371v8\354\n\034a\375\351\270\bZs\270\273\371"
+	.ascii	"F\264\266\254\f\027\002\244C>\237\005\271[\273[\3335\310\327"
+	.ascii	"\002+\330a\005Z^\217\305\372k\201\303;\336o\355\2551.C\200\242"
+	.ascii	"\001\024\021\224\200\343\bR8\220\302\001\225#H\001\004\224\002"
+	.ascii	"\005\320e\024@h\333\256"
+	.string	"?`\0136\247\032\255Ah;T\201\357\247\263"
+	.string	"\267\376\200\255\356\267\026\021\255\036\244-\013\221X@E"
+	.string	"\270\265\325\r\001wC\272\035M\313\346xE.`\254+r,Z\270\260Yw=]\313\366x\267\315u\300\"\355\361Z\364\330\235\312+bQ6\247\302\004\013\033\025&X\320\250;\023<\224\205H\260\300\325\210\367\013\"\200\315m\240\363[[VG\244\342V#\335\220\013`\021\321\005\346.\233[\301\002_\330\254\271\265H\206\007,\360\005\r\316h\rb\201/\324\026xe\350\206\326\240\\\021\360\266\355O\327\262\367\327\266\330\365\200\027\024u\300\346\214\326\0254E\300\\\273\306PY\210\204\001l.\006\017F\317\247\342\267\266+\321Z$\243e\201/r\332\\\f\235\007>\036\256\307\356r\274\"\326\303\272\343\031\255A9,\273\376\202\202t\271\235\t\236\316\372\323\221\020\364\323\t\335\264\271\bpm\017\350\333\345\326\241\"\"\035\273\003\243h(\267\262<_\017\247\315\241"
+	.ascii	"\032Z\215r0v9\337O\367\302\206\205H\024\300\276\242\365"
+	.string	"W\242\365\371~%l\330\234\332\346L<\320\366x\300\313@@*D|\300\001\006wG\242\347\343\265:\2267\244\343\265\274\036\257\004\373\363\261\275\225-\321\343\351\210J\354~l\t\022\t\254D\274\266\310\347\323\240]c\374t-\016\f\025+*\360\375d\304\270T\256E\202\2445\257\244\223\226\257\343\224\247\313,\017MMVH\244\2339\033U\222\310\024z\314)C\352P\222*\373\300K\353\211\247Qj\026\200Q\322\001\305\236D\005\036T\236\346\310\341jk3\236\322!M#S\234OO\350\361D\220\212\314\345\221fC\006\034\214\036o\324\2168\267z\211Z\245\311\f\031\031l\330p5d\233\324\220V\022,C\354\221\224\204:\365 Q\2633\035\230\315 \203\032\031u\302\271\362!\226\345)\312\204\026o]LT]h\021m\252\021[\"\303\027or\203\303\331\022\321SVC\227j\240\266\210x\361\024UJ\311"
+	.string	")j\005\201\304\250\221$\250\2244\"#3\"2\222$\205\016\021\005\204 \351 t\346\001\021\020)\244hjD\222$\251taL#a\002\221\300\350w\264\031\366\034\322\004l\016\215\001N\234\341\215\317\370\027\024\177(\206x\032<\362\036\267G\025\023(0\221uOf\366\"\344\215+\265\033\326\264\262\200g\347\033\005\222\235VYA\270\020\035t\016\330\017\212\345e*\231\230=\264Ns\254\316DG\2218;yO\n\243E\032Z\nP\343\r4F\262\312\274\023\331?c\242\214`\020\331\321\001D\200\210\035\225\345\035a\035\256{\222Y\313\"cN\03482\241\222\355s\022\371\342\206\220_\310\224&\356A\366\035lvH\303KS\230\307"
+	.ascii	"cL&\004-\003\361O$\225k+\037\276\222yM\363\352\250\326\247\230"
+	.ascii	"\003\244\204\344\240f\306\b|\346\303\021\rn\3317'\346\251\220"
+	.ascii	"\307\260\303\350\232\0354QP\300\002&\256q\264\261\nw\027^)V\254"
+	.ascii	"\214 \304\372\345J!\366\002\321\340\371\013'\002\343\202\035"
+	.ascii	"\235P"
+	.string	"mpd\374\317\346\f]\262\275\334)\217\262\371\216P\210\246lg\215\324\222\360\231,\003\007%\270\203\200S(\202=\361q\3470U\2055\373\r\374\356I\317\341`H\225\212\223.O\254\230\217\230\023\313}\026S\340\242ur\316\206\225/5Z]\355h\315\006\312\373\257\331\363m\264vD\212\346y\254\303\360\327\023\007\242i\235\360\246\3304\316\313Q4\304\024\005\262\362J\260\023\201\254 \350)Rx\234\232\304\024\213@\206\377\234\243\226\236~\356\341\264\360\322\346\221\362N\304w\335\243K\031`\355r\361l\217^\027003\323\354\037\256H/\0323\026q\225\343d\262\205\237\363^\365%\247\316\236\037x\2171\376\017\211\252\235\202\324\273\025\bm\"{\317@9\374\351\226\315\t\b[\231\360B\376\255X\005o\007\026\341M\004\267\353\230x[\243\250\340CS\220.\204\323\306\324\\6\232Qb\261\267m\317r\342`"
+	.string	"\304\340\226\240\365,\320{\333\333/\002\232u\260\204v\025G\332\024\316\262\304\021\242)\313\305e\263tQ\\9\243t\006L\261\252sg\221\2456\007\3564\330\243\005\213\036fE\304\251\022o\203t\003\\:6\270f\225\355\360A\034\024\2102\032\333\245\310\273\207\331\252}TL\222~"
+	.string	"\337F<\240\020\021(F\326\373\351y\023\006qP\235\202\021@*\207\372N\252\003\031`\204sF\215q\2209\232\225\326\f\313\"Mp\021\367\004\222\272\335:\367.J\021\016\022$4\373\374\341\270\332\320\016\233Z\315\350\034\314\345\220\352\204\3619\206\211\353\201n\276\251\007\242\307\206\f\341\032\035\3744F\211B\250\346\334\367\302\006\241.\022\205\333\327\371\247'\317\246\273q\260\017m)\006\\01\241\227\324$/X\300\242$1\327\032Ep\3036\004\256\220)\242`\316\347\350D\312\314t\027!\330\355\257\220!\b~\236\252\334\230\030c\243mW\001"
+	.string	"'<T\030\317Z^[\233\324^\343\0173g\363\221\202\371l\206]\337Y\202g\311{\270d\321S\301\303\"\345\201\006\263\270\230\003\264\254\023p\2502\347\035&\016"
+	.string	"K\3410<\037\300[18\212\362\217OPc'\234\271z4)\336p\253.\340\200\317\245\033\001.\020\301\013\316\370`\020\031\0018\316t>~K\215K\340\353\360\r\333\033\266U\273I,\273\260\034"
+	.ascii	"\363\211l\240\023\325\3010\301\367\220*"
+	.text
+	.section	.gnu.lto_.symtab.381c16880f31a224,"e",@progbits
+	.string	"sensorsPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.381c16880f31a224,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,804 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 \353=\005"
+	.string	"4\b\337"
+	.string	"\025"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\241\355\342\223\n\004\001\002\001\007\333\326\241\250\n\b\207\216\227\262\004\002\002\004\002\005\n\274\205\242\255\006"
+	.string	"\013\f\357\313\212\236\006\r\016\244\310\245\335\004\017\314\251\277\367\n\020\374\322\374l\021\022\023\242\302\263\302\013\024\025\225\254\310\321\004"
+	.string	"\r"
+	.ascii	"@\211\245\356ZLKA\265:C^,\350R5\204\"L\331)\001y\336\177\205"
+	.ascii	"\260\334@\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 k-\002"
+	.string	"\204\002_"
+	.string	"\f"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\001\001\n"
+	.string	"\001\013"
+	.string	"\001\f\001\r\016\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.string	"\270"
+	.ascii	" \240\3120p\242\247q\250\032q\352\025\020\007\006S\231\366\022"
+	.ascii	"\334\006\332"
+	.text
+	.section	.gnu.lto_.inline.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`E\001\025\007"
+	.ascii	"\262\313\"(\220'I\007\227\352U\305=,\337\276P\003\235\347f\310"
+	.ascii	"u\313G\326h\273\353\302f\306=\022\266\265\326\b!\244\221-w\n"
+	.ascii	"\3174\367\371\244_u\325@\037\032\214E\0078\376\325k\270\325\204"
+	.ascii	"\037\271\003\264\2120~\212.\032\f\2065bQ\022\344\357\307g\232"
+	.ascii	"\345\3144\247`\001\322G\003t\310\314\200\325\377\231\365\340"
+	.ascii	"\257\024]'\244\220\231\013\237\030~\020\264=>\352\031\366t/k"
+	.ascii	"f&\372DU\177\324\373\276\004\266\326Zz\345\n\004% \260\"\261"
+	.ascii	"\232\036Z\t\002H\321\220\b\320\212J\266\260\356\024yrD2'R\214"
+	.ascii	".\320|s7\304\206\356p\r\240x\265\327,\254\033B\252\245\210\267"
+	.ascii	"F\343\202\320\333\025-\302\331\207}9\261\t\371n\355\234\t\\O"
+	.ascii	";\033]7\314\326P!_\035Z\001\206"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"}\005"
+	.string	"\342\311 *pi\222\016F}*\305\213\327\257W\032\003\n\n\300\003\320\370.\326)\262\240\252\006\252hm\375\333\331\177z\373[#m\023\231d$\257\177\326\324S8\032\251\307\224\353\273H\006\271Xk>\250\222G\356\013\2570%3P\222r\330"
+	.string	"\242\001z\310I\024I\020<\317"
+	.string	"\244v;\352\035\325)P\203l\203&G8\241\302\017\b\020\320\013^lF\250\227dd\223zM\357\361eH\305,\226\252z\351\2718\021\021"
+	.ascii	"G\220\003\332\270\242f\0028A\263\235\234\357\300]'0y\202\341"
+	.ascii	"\241\242\300\305C\260 \r\021\34020M\345\312\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\270\004\n\200\004\013\200\004\f\232\004\r\232\004"
+	.ascii	"\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\265\003"
+	.string	"\322D\017\030\260'\035\200$y\r\311\270B\252\026\350j8\322\210\261m\223&M\312\024#\211r\004?[U\"\333\002X\030\256r\370\216\250U\350\335\371[\317\271Q\256\232\312>cO6\234\030=O\027"
+	.string	" $f\031L\254\030\210i\007\006\203A\300\001\313J\220\257\202T\016\240\275Y"
+	.string	"-\002\0063<$J\210\236\022\354J\027(\003;;v\016\326e\3662\362"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.9d2d0d3a400bf48b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.22.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\264\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\370\257\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.25.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\205\b"
+	.string	"f\320;6@\223\032\003\030oj/0\364\026\323J$\324\036\212\236\311\2532\327\f\265\t\326^@\371\215vp\333\036\3354\\\006\004\206\252^\345\317\337\177\003\357d\254$R\246\024)"
+	.string	","
+	.string	","
+	.string	"\231e\275\366\305\337\352n}d\270`\377g\354\260g\350\325&q"
+	.string	"*e2\004h\370_\210Jm\270\321m\021\332.\264u\t\252\326,\033\312,\246\305\200\346\327\210\325\374%S@:m\r[\213x\3043\253\344\201_\265r\362\177\nM\340X\366sAf\3111A-\267\023vI\030\226\020\223\262\266\302&$\316\177\206\272\304\342B`\345aY\2272K\211\242\002\2339\301X\373\231`\344h\275\371\377\306\2346\322B\262 \217\366\360\031El\024\263\343\266N\244uS\004\361\tM\020\327M\317A7\t\215\233\243m\343f\347\2737\217\252:\310\274N\021\243\016\013"
+	.string	"2\241!\034\030.XIQ\362)\262!cY\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.27.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\035\t"
+	.string	"\306Q@80\221\322\001#T\234\207\207\033(f\022GX\235\213\334\305\361\373\240\262Cg\250\326p\363Jk\003F\316\345e\263a`\240\020\205\330\255Y)%\340A\233\263\3266\221;\245/"
+	.string	"0"
+	.string	"."
+	.string	"-P\207l\245R\263\033N\207\017\340\\z\016\300\271\324\217\177\217\237\377\222k\".\032\220\225z\3548\354\256#\310j\335z\333\007\266\025l\313\004Q\243/;.0\0043\273\0333\233}\221,!\266Q\366\307\266F{\201\001\365\030\206u\327%[\331\r\023\214\340\271\264\355\217\234\004\345O \204\005\3168\n\205\001lw\033L~\342\371 \227\2568\305\203\227\376I\037\003rD\275j-\253\033U\234\331a*\252\207}m\365e;Z\037\373\003\027\333C\211$=\nm\020\"S\004g1\275\216\363J\2337K$\221\304\034u\336\f\r\230\233\330\272i\342\270n~\302\275\266\372\262\026\250T\303~\312\007\202\201v\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.31.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\374\321\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\030us\350\355\007uq"
+	.string	"\005\001\006'\001\003\202\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.32.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`'\001\225\r"
+	.string	"\346\031\\C\020\221\223\016|\272\260/\360P\251\004\221v\360j\2663\310\327"
+	.string	".\306\256\367\003\203\t\005\3758\351/\302Z\214:\030\330 \230\\)\306PUU\272r\335n<\004\223\241\202\1778\274\332q\251\265\275\245L)G"
+	.string	"H"
+	.string	"H"
+	.string	"3\356\241\354\277\034\032R7v\367\322\020\376\241w\303\334\036\241\346\346kBX~"
+	.string	"\005\206\353H\217\220\263\273"
+	.string	":\f\220\223\246n$\241\b\223\353[\236\340\204\006\327\231<5!\273\353\344\272\016w\346\2663\333\f\354k\001\273%+\035\353\022W\250d\376\263\237\272\347\267x\363h\227\270\211\355\237YX$\016\226\352\333Qcw;\217^`=r\3407i\177\304Il_\271@ \300\222|\033T\354z\n\374a=\332\373\200\314\243u\001\231Gov\273PQ\252\243\020\201O\371\211\n\022\362\005\306n\206s\217\276\312\202\210\237\342S\310<\"x1\201(\345\312Q\257O\275A\213\223\030\316F)W\252\212\262=R\352iwI\326\223\375\225?\376\273\363\351k<<\2740"
+	.string	"\023\241\203>\"\317H\023\205,\177@@\016<\243\007\330\204K\3130M\004\322.Q\310\003\341\372d\332\005R\300X\004Pv\2150,\2736\336^Of\271\225\342\203KIG\034\025e\215\013\375\270\312H\223mw\236\252R\022\363\305 I\034\207\273\001\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.35.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`&\001\325\f"
+	.string	"VWUB"
+	.string	"Q5\035\200\302\320\262;:\030\250ZUp\204\b\352\246\t\037\375\0212\304\034\002\030A?x\342\267p\003\n\325\230\217\221 \231h\342n\b"
+	.string	""
+	.string	"(\221\336fth\313\362;\325\352\313\301O\233\354\235R@"
+	.string	"@"
+	.string	"G"
+	.string	"\037G\354IW\006\262\334]\216\212\2606\301W\215N\320w}\242p\214^5\313\356\006\b1h\226SX\232\232\211\324\351a\237\0350d\036\2630\365)Y\260\273\236\246\020uo\267\375\300v\001\373\245%\bi\216PJW\3668\232swG\246*\373\342\375\255A\253\264q\361\330\3250\"\2621j\007\353\342\355\307\376\362a\246\274\0328"
+	.string	"^\024M\266%\231\221\342\307\356xy5f\362z\212A\233F,\0207d\314\2700s\\\333\335\325|\362\266\347-@\225\016\037X\254"
+	.string	"\020\002\344\204}\320fwW\001\252p\020A`\033s\331\007n(=\274v7\001\212\247\220\340\227x5\205\n\363\246W\337\302\366\372\330\t\220j\004\235{\223\3418\320\204 t\023\270\317\353\276\017\347\343>\035\215\207\333x\037\227\031\340.\002\307\343B]\347q\224qOU\2563x\321\n\371 \321\222+]Y\201\013\372\213\266Jb~\366\323\223-\332N\017\273\200\220\033"
+	.string	"2\003\006j\214\250\303\213\232j\212\212"
+	.ascii	"\001sLx`0@\004\021B4\201\2513e\315fx0\213\201\271s\271\24732"
+	.ascii	"U;&%\343\345\212 3\334N`\264\253\302\357\231uPD^\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.36.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`\r\001m\f"
+	.string	"f\226RC"
+	.string	"q\234\016@\300d\274\341\244P\222\222\233\351\360v n\3110\312PL\022\034\330_\fO\362\277Tp.)\212\233 >J\tUUA\301H\377\230\227l\022\216)\035\321A7\335\212J\035\271\355\336)\005<"
+	.string	";"
+	.string	"E"
+	.string	"\330n\206\026+v\313"
+	.string	"\006p\275\232|\304z\245<\304z\365h\313x\311a_\212A\241dcw3\272\341\343\347\350\237t\214\364p>9\n\354\256'\351\261p\323\333>\261}\261\217!\032\354SvwM?\366G\177\275\350\247tz\322\351_\225\032.,\250\335\n\253\324\236\252\251\203\355Wl\317\362\"\306\2176$ ;\201ta\300\365\352\362\372\264\017\342!\306\213\"8&\225\207\024(&\305L\252\017\2476\346'\272\353&\304\214\b\f\320\306z\245/\310\031V\360\022\035\026J\t\260\r\341$\276\217\020\212@\351#\030\370\240W\207\r\346\311\007\326\353)\026J\335\020u\346\312.9\223\006 'r\007<4\234\347i\t.\033\002\255\303\233\205\303h\242\346s\220\205\340\027z\\\230y\031\255\31360\314,%\376\026p`&~\037\230U\312=e\351\307\006P\247\016\225\340I\355\355,(\r\356*:,\032"
+	.ascii	"\2263\241\214\351\3043\f\267\352\030h\003/\002M\240\273i\310"
+	.ascii	"\362\0069M\2572\226]\250\306\215\320\\f\235\373\226\265\331\312"
+	.ascii	"\360\2265\027\336b\230\027\204\337\324\024\270\027LM\001wy\321"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.37.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`\237\001\235\017"
+	.string	"\246\035gE\360\222(\035R\027\256\224\306\342\035+\240{\035 \325*jW#\237\034\321/P\030`\327\252\361X\372\350\377z\032\271\302*i\001\364\353\027\340A\3406\021\332\236\367F4\272\212\2707t\n9b-\331[\312\224\002R"
+	.string	"N"
+	.string	"V"
+	.string	"-d\337\315nL\344\321\006:\217\367\370d\337x\214\304^\346CE\246cw9\035a\230\247G\250y\3629$2\037\220\342\363Z\250G\370\331\335\220V\n\374\344JK\225\020\005\313\365\257\027\210\371\274\026\313\223C\262\273N\257\365\341\336n\333\202\355\003v:&\276\211Gw\032\362\336\243]\332\220\367|\330\337a\326Rc)JUa\354\230*swQ\326\027\373\256{\203\351\b\323\020\246U\323\231\351\203\204\200\230\301\345\330\365\360\365\330Z\214\021s\327\355\303\256\302\177\331\363\230`\301\351.SgOp\002v\004\t"
+	.string	"\322\264\273\324\230\2119\370>\034\366\004\ny/\352'EQV5\355\"\334Y\355\246\b@=\313F\225\237SU\357\202usM\275\312\017\273\302Y\200:\273+\006~\315W\204D\243\217\266\307\253\002\227\232\035\257T~\366$\310-c\023\271Os\001\301g\002%whD4\002\241`\3508p%RW:\021\225\270\223\022\220\t\027\"\225\270\021\001\3562\210H\034J\327\2218O,u}\221yg\026\242\226R\225\243\302\270\201\215\376\246-\226\310\303\370\246+\276i\333\024\326\362\321\320X%\217C\350"
+	.ascii	"\031\325\177\361\340\263\323 \300\333\306\366\030# P\202B\207"
+	.ascii	"\332\001b\300\317\030P\003\341i1\024%\236\270\212\035\227 \030"
+	.ascii	"\002!\t\007\357h7\247\307\372J\346\234\245%S\003\364d\207\335"
+	.ascii	"]r\2550\3162\256\334\360`\305:\327\374\203jd\326\216Ie\334WD"
+	.ascii	"fh\225\205e\355(\017\"\235K<\001"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.38.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 \302E\005"
+	.string	"\262I$-pU\323\001\032\345^?\003~\r\035p\277k\260T\025\216\021\023\250\221Q\333\251_\247b\233PU\261Z\034e\332\037\334%\344\026\355-S\266\250\253Qe\2209\221\225\316\212]Ub\217*\"-Z%u\360\224\\TfsR9}\337\350!(\261b\177\033\214\031{\005\377\357\350\331\320 @Z\210\376\313@\300G\203\020\307\366N\326\354\322~\233/\250c\371"
+	.string	"\374\227Q\263\332B\315\273\236-p\335\266\220\300\370o\310u\230u\\\333\t\333\n\333\216\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.39.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240{\375l\201#.\300\232\350@S\303\325\201\375\330\274\250\355\224\255\314\331\335\375\377\316\253\234y{\361T\336\217ho\231\002\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\227\177\001\035\275\037\0226\243D\250\273r2\265("
+	.string	"\322\374_\352\332O\332/\323\353\371P:\245\356\346\210Ym\241\366]\316\016\270n[(Pt\367!\327Y\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.40.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\265\n"
+	.string	"f\324JB \347(\035\220\305\021\264o"
+	.string	"\300\024"
+	.string	"\007\t\016\256\317\311N\210\353\001D\303\256\260\001\373aU\274\250i\274?:>\201\030[\356\221\333\020\200,@)\265\"\n\3421\f\0069\213\2418\177\260#\331)\0056"
+	.string	"6"
+	.string	"8"
+	.string	"o\231x\333M\0250\260KRxbs\352\321NpR\265\207\305R\002\320v\327\333`>~\216\376]O8\241N>\0214v\327\363\204j\271\267\333\216\260\335\261/\021,\265\006\213\200\036\230\261}\377\365rt"
+	.string	"\356\230\261v\267;\265Gvw\372\316\3666\355\323\274f<Iz`X\224\227\n\006y\007\356t\363\006\356\324s\332\025\026c\365\004\250,\306z\310\275\364\310a\341\202jw/|\001%\"?\346\324'q\247/?eVZ\251\326\2544k6i\232\333\213\375\203\335\\\354\223\377\244\343\212&\313P\260\033\340'~\033\n\340\347\001\022q\200U\254\240\316\037\316\367\341\021C*\211\027\2025\f}\241\027\002\361\200\274\017\030z\034\bW\221\017\364\304ZA\257#Kw\275S[1XP\332L\376\200\277t\017"
+	.ascii	"\2473\241L\2130\334GX\023\023\260\243&\t\2510t\r\237\320\304"
+	.ascii	"\0034\032*\334\006s\277T<p\347\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.41.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\235\t"
+	.string	"\206RC< \005)\035`\305\330q\004\034T\017A\260\320&\272ui"
+	.string	"\034\326X\253$J(\232\353Wl\267\254V\202@\256\321\310$\240P\360\270\255\t\367\032\202 \240\317bHZe3\262S\n0"
+	.string	"0"
+	.string	"1"
+	.string	"W\330>=O\330>-\3325\257\253\275K"
+	.string	"\220\230\316\356R\355\344\342\245\350\377\365\001T\352\343R@bw-Q\251\221[\273m\006\333\020\366\r\0023\0219\273\"3"
+	.string	"+3aT|\226\217\244WW\300X\273\313}\332$\233\373<g\373\322~\353+\342]\245\037\354\252hd\273\325\301\r\236O\327\254\217\266\217\336xlT\260\332\335\007\037\346\321\341\243|\372\245\355\363\343eJH\253\244\205c\2223\273\236\244fb?`w\327\232\312\276\353\227\023\201$_\027v\024\004\016}:\013P\210\341qP\360\363@Q\007R\321\005(\203\206>\220~\026\354it\037\r=\357\243\\5\375\365\211\224l\307\306\244\235\374\226\1774\370\227y\023\023\r"
+	.string	"s\311\"\3236\030\351#"
+	.ascii	"\211\t\330Q\223\204T\030\326e\036S\241\001\025\255Y]\001\327"
+	.ascii	"\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.43.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`+\001\325\r"
+	.string	"6\332^E"
+	.string	"\223\223\016S-;&e\223\315Mi\351\333y'\342\254Y\241\351*\366;\343\004r!\305\317\330\266\336\276\366\243\bVu+\371T!\0304\350\256\252j\360\252\277\247S!\245R\262\205f2N\"\331{\357\224\002K"
+	.string	"E"
+	.string	"L"
+	.string	"\233\235\3435f\337\302\343`\343cwi\204\371\366)#\334|\323\013\004\021\245N\034\313\347\277\213\240L\251\023\347ri\271<J\005\035*\304"
+	.string	"\256E\216\340\230\300q\323a\007N\004a\310\203\3355\034q \356\352\266#\330n`\237\013:{3g\310\330\276o\363/\345,l"
+	.string	"\306F\347\355\356\365i\247\330\327\347/\333\260\276f{I\345\"\273/:\324\372t\265\016\355{\237\331N\263b"
+	.string	"\273%h\304\330\255\f\274\300\372D\360\221\352S\236@\365\351\325\347\277\303\024\036\274\316\343\021\202;PF\017\034\022\262\2021\332\0304\300\217,#\313U\214\272\233\030I\016\360\225\352\361%\231\232\035\251\033-\020\210]E0\222\354\313\335]\307\027\373\245?\236\346\277\225 \247\023qb&\326\250\373a'\032\006\302<S\302\t\264\t\t6\241\004T!\313@?Z\366A\301>\024\345\244\304CM\264\017%9\340\314\002\246QP\226i\364\252\241\233\016aD\375\221\023\212\242\031I/\376\317\024\016c\352@\255xV\375\263\347.2\0011\273\353\300?m\270\340\243P\t\030"
+	.string	"2\003\302p\323\204\365\t\250\364;\236\306\342GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031\314\244y)\215A\355\001"
+	.text
+	.section	.gnu.lto__reset_template_126.0.44.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.53.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`\324\001]\020"
+	.string	"f\235hG\360\262&\035\242\203*r\r\313\b\027\316R\302\251\031\325\327\376\244\336\235aX"
+	.string	"\330\022[\313\356\3417D\336zDSQ\363M\352\210\362\216\320\246\204A\315\200\225\377\210\266\"\257\325x<wh\033H\325\026\311&r\247\024Q"
+	.string	"S"
+	.string	"T"
+	.string	"\255\031\317\256\270\340\323\nB\237\026/`\373\f=\300\366i\377\205m\325\213C\333\307\305\025\373\235\032\020\257!\273\333}\252\314\303\253\324B\037v\223\"->1\230\017\327\217/\001\302\361\211\301\214\270,\2716\022aw\035\"q\317\333\206`\273\201-)\004\037U\256\343\0033\326\211\335U\261\277\363\230\315y\345:& \363\303\252\331]nE\3720T>\314\234\355\347\250\376b\221\023vU\"\301\247\025\3471\302\277X,\332U\321\303 \364i@\343,\345E\325oR\003\304\025\361b)\355\333\334\025\376&u"
+	.ascii	"\273\001\237\332\303\005\310G\223n\303\023\321\314"
+	.string	"\034|\264O\3432\024\022\032!\017x^\243\344\317|~\314`\222w\3716\016\333\347\365\343\245\f\023<X6\256\225\f\222\032c\325\256\255\266\354MZ/\376r\223\376\b\202\031\tk7D\320lSL\031\213\347\374\366\375\031\001\030J\022\364P\236i\232t\342\241\214P\032\276\016\335\t\374N)\336\251K)\215L\035\t<u'\005\374m\360\300\016\365}`\307][m\331\260K@!\022\371\261\322\026\253j\214m\255\360\035\032\304\302ux\"\031P\213\034=\252\"\031\220\013\227/\034\207g\362\343\337\3600\362gR[- \220\002\231\033\225\007\344$\206\233\004A\334\220\002\030S0\312'F3\006\243\023\353m\030`\307\214:\343s\343\025\206P\332\007b\314\221\201lm\237\265\222\247#\354\030t\223(\302\307\024t\356f\027\023\264\267\312\213L\211\327\360\037H=\206h\206&\fi\274\364$-\3546S\026\032"
+	.ascii	"\264w\364$-=\301\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`\007\001\315\007"
+	.string	"\264\n\003\002"
+	.string	""
+	.string	""
+	.string	"\002 \177\021\201\200\200\200\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\005,\022\200\204\001"
+	.string	""
+	.string	"\003\0025\177\023\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\032\013\201"
+	.string	"\002\031\177\024\272\200\002\033\177\025#\177\026$\177\027%\177\030\0050\031\002&\177\032'\177\033(\177\034)\177\035+\177\036\005*\037\005\037 \205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\034!\035\"\030#\027$\026%\001/\177&\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001.\177'-\177(\003\b$\003\b\027\304\001\003\b\344\001\003\016\002\340\236\212\256\001\001B"
+	.string	"\037"
+	.string	"z\233\311\333\016R\2632\f\352\341\003\206\376\013\331\226`\270\374\300h 7\220\033Kn\004\315x`\r\016\320\016|\016|n\347\347\264~^\030k"
+	.ascii	"zL\365\0072p\0079;_\340\365\310\021.\fN3*|DQh\203\211\007"
+	.text
+	.section	.gnu.lto_.refs.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\001\005\002\003\002"
+	.string	"\002\006\001\003\001"
+	.string	"\001\003\002"
+	.string	"\002\007"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\003\b\002\003\001"
+	.string	""
+	.string	"\t\002"
+	.string	"\002\003\007"
+	.string	"\003\020\002\021\002\022\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9d2d0d3a400bf48b,"e",@progbits
+	.string	"(\265/\375`|\"\365\232"
+	.string	"j\370\3446R0PJJ\007\376\276\352\323\0313\221\313F~|D^\206\003D&DD\244\t\230\27192!M\315-\355~\3536\346\362X\246a/\364k&\231|\255\202\2019\2322\200\252\240\324\361y\344\261\313r\377p\335@l\037YW\b\021\2416Z#{\313\024\332\002h\003{\003a\370hH\360\257\017|\272K\205?\265n0\220^\007\005\233M\267\351\350\207\326\353y\363\344\r\037\036~\177\b\366_\177\b\336z\301 \232C\360\303\017\024\207\024\020\2744=cQF\234V\235^\250\030X^V\275-\303g\032M\333u\264\357:\314[L\217\271\225\3532\037`\316N/\317\234\241w=\007\315S\025\264\331\360\322{@\202\276k2]\347\243\204f\032\017\270\331\360\322\313\031*444t\253\254\254=\261\332u\266\313\264\231w]\323\361,\241]\2476\002>\335\b"
+	.string	"\327\2208\205e\341[\034\330\201\016\n\006-\f\374~\203\337y\370o0\017\201\227[\312\276\254\372\2674\3562e8\241\033\332jlK\315\252pB9Z~k\3237|\b\314\272\314\307\t(/\237\334\236\355\326_:\332o\215\345\235\245\317\226\035\326o]\245\313.\024\r\303\b{\233\346\f}k\264n\363YBs\r\035\254/Q}zBCC91\310\254\221a\225M\250\0042R\252\254\372^\202\337`j?\363\311\311\231-\312\023\202\277\350o-\r\326k\235\3663\0174\344\314\266\343\307\251K\214&z9\347.\315\245\243\275\326[\256Bs\276\222s\036\032\022\312y\362\243\013*\250\276\231\3701\340\267\300\252\021_\332AA\036\024\360;\300=\326V:\032\242\311\336b\035v\240\0234Cs\206\376X#~\3210\253\376\002\374\377\312\013"
+	.ascii	"\313\022\274\003~\207\b\336\277\277\016\021<\016\266\315!\b\324"
+	.ascii	"AA\020\035\024\374\233J\1775\3642e8\363\225\314\204n\350e\022"
+	.ascii	"30\253\266\224\236\362\206v\224? \301\257\022,\177\345\234\033"
+	.ascii	"\032\2013g\247\206\376\364\345\354\364\323\215@7\002\252\027"
+	.ascii	"V\022\262\240z\213\017\355\240 n\016A\025\034~[\345\357\022\177"
+	.ascii	"O\360\267\211\277K\370\257\376\026\211\360\315w~;\3458\377\315"
+	.ascii	"y\316\177\201|\357\337\266\371[\355o\277\276\277\333\370\376"
+	.ascii	"\016\3617\224\233\277\315\354\375\017\301\303;\374\366n\001k"
+	.ascii	"\346\277\227\377oq\327\371-\230\277\333\004\371;\311\337M\376"
+	.ascii	"\336\372{\311\337\317\277\231\374\355\204\315\337<\376>\3627"
+	.ascii	"\2225\377\177\376\313B\2438\t\370\267v\377\317\244y\360\267f"
+	.ascii	"\177\253\371;\357\357\273\277\321\374\007\376w\307\337g\376\366"
+	.ascii	"\362\367\332\337X\376\016\373\033\372w\224\277\241\374\335\365"
+	.ascii	"w\214\277\217"
+	.string	"\376^\376\355\364\267\f\177\303\360\267\213\277[\370\273\351o\246\277\227\376^\361\267\212\277M\370{\204\277=\370O\366\177\372\037\356?\333\337\034\374\255\301\337\031\374}\301\177\275\277+\370\233\350?\336\3774\377\245\377\343\376C\3773\360\337\355?\320\337\337\337\337\177U\370\203g\177\007\013\002qX\231sG\277\242\372\364l\227\270#f\340n\343\354Z\020#6\254j\277\3300\234v\243\306\227\267\033C\211\026\373f\335\310zP\315M\325-\265+3/\035&\030\315\343\273B\206\217\237\264U\273\335b\327,\027\234\237'\314\275\231\346\251\033#\240Q8\370\374\254z\334\003\0373\361m\2315\303b\323\272iA\030\33747\233\"t\256\314\340\270\264\334\246\035\rO\366\260\363&\017Kj\325\257\261h\352V\233 7\320\316z\b\231R\007\005\250$\214K\227U\2436\213e\322\323\205\006\26512\370m\377`v\232\3129\327"
+	.ascii	"B\363\324\023O\260\201\335\"\376\236\276\235@\276\377\0178\312"
+	.ascii	"Y\351\327\245\00639s\332q\020\371\227\346\274\274RbpE\265\274"
+	.ascii	"\252b\212]e\345RK\271a*_)\231b9o\310\313\245\022\2053o`\212e"
+	.ascii	"\252\374B\216\2523\364J\231\227\316\274!/\263\023\b\346\362\212"
+	.ascii	"\212)\346D\265\201)vE\225\305\2562P^:M\321\260\314S\033\262\330"
+	.ascii	"U\232,\346\244\002b\2129\251\230bW>z\006\363\215\024\252\276"
+	.ascii	".,\275\376\301\\\346\031RVNS@R&\324\231\351r\356+Py*\201\234"
+	.ascii	"\255\234StNU\215\366$\235\361d\346\344lh\316\271\203\324\023"
+	.ascii	"\2263/\245\314-g\316[O,\262T\004J\2504\023i\251\022\210U\226"
+	.ascii	"\001\2253\001R9+;Ks\316\312\2343\316\224\0254g\035@\314\247\224"
+	.ascii	"T\316M!\251l\245\324\002\225\263\275R\207F\305\024\303r\026i"
+	.ascii	"\031\023{f\030Pe?3\335\325\024\026SR\3112\362\360\223\312\006"
+	.ascii	"\236U\243\252\233\034UcK\254D\255\025[E\b\232\225>OuQ}zy\252"
+	.ascii	"9\"\307J\\\r.\253\261*:^>\300\266\304:\316:\007\310\271\"\244"
+	.ascii	"\255i\325\242\242[1\016\301\251&\364\247\247\360Q\351bU*\026"
+	.ascii	"\354\036\251q\007\303\252\307\211\242\"\305N\261wX\324\270\364"
+	.ascii	"\244D\371R:\022\327\306\252Px\272\242p\241\263\352\203q\370\022"
+	.ascii	"(\321z.Ab\235X/\373\244\243\266\3132\271\335\262M\336]\226\013"
+	.ascii	"+\211\r/\242\230\326\017\254>H\206\205:(x\203J\360\203Y\370\301"
+	.ascii	"\034O\233\245\226i\353\332b\325\346\227g\021\216\270i\021\225"
+	.ascii	"\2751e\235\236\272\254\245C0\370\362\233\272\351s\306\300\202"
+	.ascii	"v\307FO\315\232\336\363Q\002\345\247\271\250g\377\345\336+\262"
+	.ascii	"D\254\021\213e\207X\037\366\210\005by\330\037\366\312\026\261"
+	.ascii	"A,\022+\304j\331\0366\211uv\324fY\035\267;\254U\221\255\241\002"
+	.ascii	"/\272\251\315\262Qv\212\312\007\013\324._\364\236\317\315\271"
+	.ascii	"\007\337\323\257\337\364\2362M\004J\246\306\320\320u-m\346{\227"
+	.ascii	"\357\330tY\030\314\256\013&\231\202 \007\364L9\005\263Y\266\n"
+	.ascii	"\247Lz\307F\257\277l\226\205\352=\234$\316;6CBCxn\206\223&\013"
+	.ascii	"\250\326\331AA\005\200f\360\201l\370\300*\370@-|\340\r| T\rk"
+	.ascii	"\243GZU\206,M\r8K\243\245\324\004\341\262\352\325(\2662\254T"
+	.ascii	"G\355\214\253`\316,\2263\264\347:\341\370r&\"\370\323\"\202W"
+	.ascii	"\271\360U!\370j\023_}\302&\306\340\337.\370W\0029\312\034\333"
+	.ascii	"\264gK\024\271\275\266_/?S\177\320\345\310\262\352e\373\331\263"
+	.ascii	"P\2413\322\303\304?\373\331]k\260L\243\303\332b\274\211\330\311"
+	.ascii	"\262\0323C\355w\355\247\353MY\rV\275hw\213\215\037zg[\322\256"
+	.ascii	"\022$3\252\330\326@A\363t\265\364\026\273\031w}gM\262<!sS\245"
+	.ascii	"\243\267\312\305\002d\252lpS\037\251\230\035zf8G\336\320\250"
+	.ascii	"\262dQ\350N\223\211E\212U\177\313\376;v\255\\2\236\24149\330"
+	.ascii	".\331\215B\271!\344\310O\216\026\276&bE\277W.\032\027\250>\253"
+	.ascii	"\266\020\217\034\376\245\3227,\314\200\272\250\276\256\236e\224"
+	.ascii	"*7iWJ_(\364\302\230\353\3616\002\253\3312\262\303\t\356\2760"
+	.ascii	"\202\377\215\022%H\220\r\036\224\007\207WG\257\327\205\322@9"
+	.ascii	"c\231\241\365\250\375hs\005\312\227\n9\017\240#v\243NG\336\225"
+	.ascii	"\361\233\243\243W\306\355\272\314f\2761bn\317\212\211\232\343"
+	.ascii	"\263\252\023k\226\227\006\314\030\374\376\262\272=\314\370\270"
+	.ascii	"<\276\352\246W\027\bW\334\264\310yy\370"
+	.string	"(7\344\f\244\314\363y\271n\223\313\344*\271[\035\275Kn\220_\035w\307\205\356\222\373\203n\272\344\n\271Z-m\002\345e\226\273\351\220N\214+)\017\037\325\352v\036\236\230\035H\261Cr\223t\364j]\350j\335\254{\244\245Mh\256\261\203\005\214\024\265\016C=xa\350v\004\217\030\3611\203f\345Y\365\026\301iV\271\275\030\033\322\321KdM\227\026\276\333\355t)\202\025\206\277\023\005\177\347y\261\260\230)\017\270\"\370;B\360w~\340\357\344\300\337\271\201\377\333\343\362"
+	.ascii	"\212yQ\003wy\364"
+	.string	"\236\235\373\"\343i\n[\021\315!xk\270U\267\371\347\374x\241\t)c\342_\034!\024\211+\263\252\332_\013^\033\2777\376\034\353\226\344)e\325\357<\341_\252[\343\317\361\241\323\212R\341\303\277Se\177jrX\365\322\300P:v!txd\361\261\303\252\2774\376;\243\377\032\252B\316\313\027\376\374\332X\265\2479\004;K\321\257\324\016\034\227\351\024,\370\227\3317F\364\306\270\314.\343\303j\004\260/\307]\027\027\276L\253\263\025\302\3465\341\001\345\302\300\201\361\205\257\006\253Byh\3200\342\274P{*\344\374\365\263\226\361\334\254z\227w\231\311\370E\365um\021\"\367\304\252\327i\376\375]\247\267'V\263c\f\355*\177\235\256\300@\263Uo\356=\036?4O\350\237\237\037\231\350\263\247\214\206*e\350\370\370\354\264\255<\321I{\266\231Q\333{G\355\236%\353\300\231m\200P\"m\216\350"
+	.string	"U5dJ\2336b\374\236@\031w|/\214\340\341\3315b\354\242\372\272r\256\324@\344\214\232\3335\270\310\234\\\020\253\332<\013m\266)C\314r\252\360\335\235\235\342\\\005JT\237^\260\017\207\024\336\327\334N\201r[Z9\031\323\321Y;\234}\260\316X\211\300!\223\343n\253\314\255\235=\003dKo\354\214\031\036+/n,\341l]\332\021.u\215E\207\356\211F\253\367\200Xl\316\234\331\205y\030;\246\363T\316\315|\347\220D\365u\375\350`\223>\305\334\216\301nlV\312f\345\20297\324Ic*7\247DX\271\0362;\2565mo\263\001gAB\2518<&\221DkR\023\021\2518$:\"\233\210\004 \022\233\212Ec\021'y\024l\301xd\2214\026qV\bW\242\232\\\221K\353R\2608\024r\320\203\\\227\204! \223<HZ\223G#\023S\023\222"
+	.string	"\027LF#\020.\204\307\343\211\004\222gAB\211\211H\211\211\003R\261i\247\270\302\002\221G<\311\243\242\022\023\260\250\304t\327\027\206H\025\211\\\217IIB\034\027LF$\365\230d\272IkQiH\024\342$\255\310&\025iE\342\374x\244\304D\242\307\3051\211\034*\255#\034\035\300$\004\001\205\007\306\244\021\212\023:\235\264\026\207*\226\214FI\302\002\216\306\244\021\204$\241P\n\rRh\260\224\"\200\344\260\350A\222\220\003\013\344z\\\261\216`\204\342\204\t\311U\t"
+	.string	"\007H$\217B&\022I\302u\204\00188@\242\304\003ED\246\2455y\224<\n:*n\220\\\221\353\bJL \2164<\256\305U\t?\202\022\r\2240\341\002\316MP\340"
+	.string	"\005\016\004o\202\202\242\"\nJ\024\341\227(\272Id\320z\224\344\001\320z\224<\256C\"\3230IlZ\n\300\b\305\211\024B+Q\210\204\314!\n[\264\030&!\327\343Y\220@\036)\rW\024\215.\b\213\303%"
+	.string	"Z\020 Y\\\221\353\221)i,v@jA\354Y\217"
+	.string	"X\217\002X\221\216M\306\024\311\342z<6!\001\340\"9D\0222\tU\374$\205\031\230\260\"\233z\220\311\343J<a\264\"\233\002(\256H\307U\004\246\245&d\321\210\344\0019D\"]\260\360!\022W$\"\261i\005\207d\261\311hD$\256F.\216k2)\314`E:\032W\004\265\350I2\016\217\253\b+\230>H\nU\f{\224\212\303\342Qx\202"
+	.ascii	"\311#\0238D!\32209<\032\035\215\033\024\215\303\244\360\330\204"
+	.ascii	"\")T\321b\200\344\221\317Y\020\215\306\f\216\200+V\030\223MF"
+	.ascii	"&\264`$\002!\217|p\223N\362\037\222gA\202\250h\\Z2\"\025p#\323"
+	.ascii	"z$J\032\215G\242\235\025\032yT\224d\332A\002\203\310\2435)L\246"
+	.ascii	"0Bq\342\270&W\020\004\330\340'yT"
+	.string	"\242(Y\0346\341\027\025\031\201(!\004\0160\022\t\"\344\321\210,\256H\242\342P\270D\204tD\022\221\360\220\264\036\327$q\270\242X\302\252$L\022\215-6\034\205,\220\324?+\307Cf\317\r\2257\335\266\223D\255\211\347\267\246\312\345\361\211\351\273^p\2308u\375]>2(n\212@Y7g\244S\376\210\354Y.\031\370\342\013\217N\357C\ni\232\\m\240\250h\210P\205a\223\246T\343T\267F\315\016\231\261\267\250U\177\325\374\027\357\3465\224'\313\227*B\254*\242\203\202@-E\277iT lh,\231\336\351\370\021$\206U\177\357\304\262\f)2\265\252\335*\372ES\201\021 ^V}\373\225\276\3353w\fOV\202e\0328gmf\360\3642\263)b\207J\024\0250d~\317\374\232y@\202\333uq\215q\262\352\255\373-\323\374\2226\245\273e\376\034\035&A\304\234(\301o"
+	.ascii	"\f\007\025\225U\357\230\333}\313NF\032\253^1_\343i\222\321\313"
+	.ascii	"\272a\340\260\346\236\254z\301\\\271\216\336\355\316\335'\rF"
+	.ascii	"\324\255\b\376\f}\267\340\205\373\215\373sr\322z\004\271\272"
+	.ascii	"\372\362\347\340\220\215\331\361\344\201\337\203\243K\227\353"
+	.ascii	"E\b"
+	.string	"\007\202\271\250R\331,\211\022\025B\006\251\231\221\031I\222tB\n\020\006\303a \211i\017\022@\025-\2202\247\320\314\310H\222\244\264\354\0311\004,t\243Fd9\321\035 N\316\330\241\237\275A3%9\372\323\353'\252N\363\004\204;\027\270\203y\242i\213\210\3701\267I\242\0070sI\312\224\032\210\374\3451v\032U,\021\251d\002\255\\\bz\213U\221P\331}=\016\204\330P_IF\365\033N\373\004,\026\020\217\202\317+\354w`\026\342r\006\022Z\356\340z7\\\216!5\344\340\235\254D\353Q\331@ \330\221Q\005Q\007\304;\222\246:!a\273\310\372\241\037,\361\373\024_\227\303\321\212\212\334.q\265\361\342\325%\226\037\233\320\262\300fMY\031\233\365j\304Z\216\340\230u\n\177\355v\332Gc\203\220r\310k\034\016\335\307\223\347\022\313\005zjA\217z8(p\233\202\025\341\220\351\027"
+	.string	"s\247r\276xt\233;\320\021U\236\253\253\363\354\340ig@\213g\277\342U\304\266\315\226\202\322\363\261\225!\314\267]\306\240}n\213\360-\243L\360"
+	.string	"\324\311\260\220\222\225\244\260B\265\200\013\202\336m8q#l\270#\272\215!u\016BX#\024BC\223\034\3632\225~PDz.8>\233/\330n\335x\307\357h\301\356\374G7A\227\035$/}\316~\261\355\204\330V\033;~\363ZNl5\251\272^~.\232;ZT\215\227$\216U\t\030 \340"
+	.ascii	"\373r\027'/g+\213\214V&d-6>\320\202]D\264foN&1\032\374;\361%"
+	.ascii	"\373\034\210*\335\320G\253O\300XP7\213\247\177Hv\315\r\006,x"
+	.ascii	"\205\355n\207\222\214\210N\354[\021\025\235\001\327\354\334"
+	.string	"\034\207M z\3702;\216\036\265t\311\030F\0176a\003\b\253\316RT\312\351\375\225\253d&&"
+	.string	"h\003u\345\024\374Ps?>k\227NKq\315\020\030\250\327\272\266\036N\013\373\226\241\0332\313\0171\023!\227s3>\252?w\337>\221\366Ou\021\347Vd\257S\004[\320[\375|&E\343\251\026;\255\317\305\221@\274\355\2231\332\347\241j\023O\323]_5\332\226\217\250y\342\"Jbr\351"
+	.ascii	"\337\235E\273Y\242}y`\350$\327\"\224\177`\276\265\274\242\210"
+	.ascii	"Hd>\335}\366jH\267\024\257\202\334}a\020\301\203\206\213z\214"
+	.ascii	"3p)\211#\350+@\220\006\022\365\250\340\303\264)\352\265\202\375"
+	.ascii	"\312\310H\277\211\373\353\316TfF\211\"\324W\267\352\223\254\366"
+	.ascii	"uNM\023WrY\2465\022+\r?\355\217\225\254\252\313Fn\004\213\257"
+	.ascii	"@kO\027\3477\333\327\310\317^\230!\266\363\f<r\231\206\247\367"
+	.ascii	"X\016\365\025x\277\251\332\020j\257\315\316F\266\343\302\302"
+	.ascii	"\037\354C\377\327\261\275\316\234\215\231\036\331\333\002#\037"
+	.ascii	"+i\350OT\306\025\307*\b\235\271NS\024\246\2038W\364\315N8\016"
+	.ascii	"\240E#\276\356\024F\3007\256=\005\325`-\301\335!\235Q\352SmE"
+	.ascii	"\255\214\315\362[\351(\006g\257&\250\331 \242~\"\310G><h\316"
+	.ascii	"}\217"
+	.string	"Y\303l2>\343\177\343\363\324\366\3212\020\224\312\371\373\001\264\033\243\261:\221\350D\306\237\320\376\274\304A\344\341\027\032h\361Zs\241\016\3722\024gxc\b\215\007:r\374\261\314.\260\177\231d\003\225cyV\007 \036\377ry}\027\276c\317\346\372\036\217S\346\252\241\325\246(2\177\201\004\221\225\035l\367\234Y\273\204]\253\377\235\2408\251\220s\264\266\326JN\255\n\232\311BmZf\332\300\314\001l\\sW\304\374\305\266\n\251\272\303\314\264\314\255\022|M}Ge\317\204\255 0\201w(\240\234\305\346zs\321\030\002|}\0260@\340=\300\213%\034i\357\333\257\357\247N`\031\335\231CW<./\215\242\b5lT\317\312\234j\220\312\227\376\236\323\342\nD\f\257\"\016\234\032\227N\345\203\230\021p\177\211K\025dk\300/b:\006\213\023\322\234H\023\233\350\320\017\274]E[\323\307\260F"
+	.string	"^'&\256(\223\277\331\350\343\003\330\017\022\357\263\236W\025(v\270\b\261\036\353Y\n\r\354D\303\021!\257H(\220:\330\270K\026\2507 \3373\006\241\212\220\024\316\220,\020F\362\030\366\220\377\327\226\n\003A':\324\334\204\367X\243\220\366\212\346W\300c\374\222\260<>G40\315\271Tu\323\235\241\035|\277\345\346\035\367\225\251\300\241l\341l\377Wh\221\326Q\375\230\353i!y\345\234*\207|\374\374 \006\b\356\217"
+	.string	"w\250"
+	.ascii	"\225\025\201\004\241\316\313<\004\210 \217T!\331\322G\005\033"
+	.ascii	"\250\221\267\006$\200\336\351l(*7\242\223\305C\210\365\022A\303"
+	.ascii	"\255\374h\235v\315\b!\2713\243f\211\020]\233\210\034\226\372"
+	.ascii	"\310\255;$\363\332\3776\347\324{\224\317\323+\021\021{l\350\206"
+	.ascii	"~\210\t+\361\351A\035\341\261sb'\256\2345x\311\3426\363\311>"
+	.ascii	"X\346\377\275{q\375+\275gL\310}\372#/\333\370\244]\375\313\361"
+	.ascii	"\266\334\003\3051_\006\352\367d-\202\rD\206\373?r\323\224\267"
+	.ascii	"\304\330\275\230Y\332\027\027\364J>\231\005v\375\350|\342\307"
+	.ascii	"\334.\320\207\314\t\210\265G\273\232\272Q\357\005\246\263)w\225"
+	.ascii	"\336\314v\216\\\377\277\201mG\265\354\323\251[\001"
+	.text
+	.section	.gnu.lto_.symtab.9d2d0d3a400bf48b,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9d2d0d3a400bf48b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2806 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\"\003\375\023"
+	.string	"\224\035\026\004"
+	.string	"S"
+	.string	"\226\234\261\244\006\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\256\234\262\364\013"
+	.string	"\003\240\342\234\212\n\004\005\342\246\207\300\013\022\002\001\001\002\001\006\352\263\360\321\b\007\t\310\373\201\350\r\002\n\223\273\300\245\013\002\002\003\002\003\013\223\373\304j\006\002\004\002\005\f\234\362\341N"
+	.string	"\r\016\251\306\315\231\b"
+	.string	"\017\324\240\313\347\002\006\002\006\020\021\022\372\255\302\243\003\023\301\325\215\205\016"
+	.string	"\024\274\205\242\255\006"
+	.string	"\025\225\221\315\200\006"
+	.string	"\026\210\377\206\247\006"
+	.string	"\027\271\303\275\241\r\n\002\007\002\b\b\002\b\030\031\230\336\335\312\001\032\272\302\257\305\007@\002\t\002\n\002\t\002\t\n\002\013\002\013\f\002\f\033\034\037 \315\343\301\244\013!\"\247\333\250\364\n#$%\263\330\307\313&\261\213\233\205\b\n\006\002\006'()\264\251\257\307\f*+,\367\267\311\301\004"
+	.string	"-./\277\201\357\230\002"
+	.string	"0\261\323\207\361\001"
+	.string	"1\243\363\246\227\003"
+	.string	"2\222\321\201\352\t\b\002\b3\211\307\340\277\f\0024\314\345\244\232\005"
+	.string	"5\362\357\204\233\017"
+	.string	"6\202\220\306\317\004\0207\201\226\204\312\r\006\002\r\002\r\002"
+	.string	"\002\01689:;\333\217\352\217\004\016<=\313\322\375\213\007"
+	.string	">\236\376\250\313\b"
+	.string	"?\350\300\306\254\005@\222\252\354\340\007"
+	.string	"A\202\321\322\374\007\004\r\002\017BC\360\251\206\306\017D\243\205\305\376\016\020\002\020\002\021E\310\342\324\f\002FG\232\372\246\216\007"
+	.string	"H\317\253\250\341\002"
+	.string	"I\351\361\317\236\016\004J\202\322\365\203\t\002\002\004\002\004KL\227\227\247\303\t\bM\341\274\276\362\017"
+	.string	"N\265\300\331\214\001"
+	.string	"O\324\226\242\363\f"
+	.string	"P\202\275\352\302\f"
+	.string	"Q\354\344\224\342\fR\261\335\307\344\013\fSTU\240\342\234\212\n"
+	.ascii	"L\250\3218c\220q\320\310\004\321\224\030\212\003p\202bc\304\r"
+	.ascii	"\021\340hD\214$\020J\314LZ\003\221<\260\254\033r\005,\300j=9"
+	.ascii	"F\217U\036\254t\001\031\266\356H\372\030E<\351\337!Y\"\027\016"
+	.ascii	"dR8\250\035{\003*\261#\001\346\217\263H\212b\264\002\233o\250"
+	.ascii	"\273\212f\t\324\225\266.\334\3537\307D[D\b\201\"o>r{+[\244\255"
+	.ascii	"\321QS\033rR\244I;\261\223\313\3411 \007\334n[0N\362z\212\375"
+	.ascii	"\377y\261\302\037\277W\234\031\327\367\367\227\230\326\323d\005"
+	.ascii	"\352F\b+\004\222"
+	.text
+	.section	.gnu.lto_.ipa_sra.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\316\001\245\t"
+	.string	"\202\214%(@S\222\016\3030\f\3030\214\204\3130\fk\375\303\006\021\213\210:\365\207\232#\210\241\257-\253\377\306o\267\322\210\334)\005N\365\225\213\3726\251\244,J\355>\231\311^\262$#[\344C@\374\360\250\216\31117Vcf<\306.\226\364(\202\212SGB\265\251\262\350T\354SLHDL\210\007\207\006\006\235\013\n&$\204\203\235\006WA=\301r6\253\331\201]\201rb.&\226g\310\214\020&s\212\322\311T\232Z\005\254\273\001.\376\324\356Q\267c\265\004R\250\021](G\213\n\013\215\001`\0029eS\036\020`e\301(\355\006\341K\2343r!\n\214C2\006!#\271\372k+\036\314l\231\277W\254"
+	.ascii	"\261pk\233\247\231\222\034\355T\250\fi\234\356\032\226\260\375"
+	.ascii	"\354\335f\247\2051|\367^_Gh\022\2421\351\026\025]1U4\325^\337"
+	.ascii	"@\002\200\347\3066\354\177eW\007\234\216\300\220\261\362\375"
+	.ascii	"\036-')\246\223\017\312\272G\321V\334\212Gx6\277y$\025\005\016"
+	.ascii	"\021\273\252\350\177;\300\354H\317\rm<b\232\341\035\215\266\205"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_.inline.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\365\f\235#"
+	.string	"V\350\213J\240\326Q:#;\224\247\374\037F\341a\207\032u\320\034\334a\213\331"
+	.string	"\023v\024W\220\223<s`\310\320\3651\365\200\327AK\201~\373\0030Z\360\215H\234a\207z>\033\271w\377\341\233\240\032\374\003k\237DD@\376\336R\246j"
+	.string	"}"
+	.string	"\200"
+	.string	"\365\214\263\342_\273\215~\306{\372\353n\362/\363|\013\357\367\273\023?\336x\307gw\257|\345\346\311\217\271n\236\227\2057O\363$\251yR\346\205\277\216\317>\3224:ld\253I\322\227\356\242\025Ew\363~\035\225\352n\225\363\216;\356\277\377_\314g\034ww\207\377\216\362 \0022\t\371\337\035F\"\002.\221\3756\207%\tC\f`\365?\341\223\240\320Sl\305\025Q\017@\271`\246\240\346\306.\270\372\004\b\016\334@\201\347\350n\332\007\b\370\371\305)\302_\207\251\234\214|c\t\276\362\341\351\331i\3669>\nf\005\321\376\034\336\021\264\025ek\350\320\036O\311\311\263J\231\231\246\356n)c\366\001\370\247;\226\362\305\245[p\364,\037\352n\327i3\336\372\343h\016\005\352n\331e\261\377G\272\312R\024\317\365\001\273{\243S`\310\360\321P\202\203\305l\251\312\310\367\245o"
+	.string	"Z\365\330\020\371BBx\200`\327\220\001C\025cx\227\346\370wa\\\002\f\205\024Dk\346\026*\300\350\270)\330&H\210\360\277\233|\230\242F\276\224\017S\224x\b\027\267'\2105\325\233\301\360\276\360.\177s\230\b\326T\217\374\203\232\332k\347\262$c57\3769\036I\246\361.\263\360nu\271\203\035\032\004VQ\221\267ip\363\f\377\377\355s\035\301E\202~\374\366\266\263\355|C}P\254\234\366\265\346\365V_\317\365\351\247\205\016~\255\275\342\360\320s\255\235\353\r\017\307?.\033F\302\266F+\303&VD(\303'\036~uRb\017\361u\375/U\224\200|@\215.\027*|\274\231\203\370\360{\270y\336<q\364\306Q\322\020\221\367\242\207O\013v\263\303~\221\212b"
+	.string	"!\253\220\024\315\2009\207?\201\006\250\201E\262\031!MRi7\321\004\004!\250\234uz\022"
+	.string	"#-\206\342$BF!c$\220pd$\030\211)m\322\030a@\346\225\037\347\377[U\021\n,\233\006\323C\335\361\254rH\300\032\250\342\315#\002\374V\235\333`\330\212\331\n\021\327\250\224A\274'\315\341\036\006\355\217\2126&p\222\224+7\t\004\024\235F\344\347\363\307;\375d4\006\257p\375\032Lh\351=\224\371T\207\361\020\235K\035\215\242\255\204\220v\335>\021\212\304+\267>"
+	.string	"\225\322\343\222\006X\373\276Q3\365L\341~M\211C&o\004\352dC\357\256\267ju\332T\241\241\250\372Af1FH\313\204T-Y\204\261,\314u\242\262\335;\302\262t\372"
+	.string	"\320\217Tnp;\002\321AVg\026\335"
+	.string	"8%\361\260\026\210D\360\036\202\355\266\007y\252e"
+	.string	"'\303!\226\235\367]\002m\257\271Np$-\302\221\332\257(\311\302o>\375)%\337\216+\3655\351G+\244G\240Pt\373\332\223\271\006\336\206\274\265\367\020\033\334~\367\301T/\257\325\372\274\236%;\226\207(Y\216\202\231\240TM~\255+\263J\270\350\346\335\322\021"
+	.string	"b\203\334vT\210#N\271\305\323\336\265\b\fa\355\314\212B\372j\207\337\364\207#\037\263j\005\021<JV\226\3150\302\330\333\016$\035\025\352\324B\253M\330+AW\353<;\213\252B\317|\370\013\215\313\0023\203ar\347\b\351Y\256\"\377$\252\203\232\266\374\036Rx!\254\013nq4Q\345\235?]\331=ru\270}\017\225D\245\034\360\336\300\257\310s\232 L\241\364\330J\226+\257\314m\2645\324\225\212\320\337\360\217\316\320G\031"
+	.ascii	"/\200T\234\370R\034J\370b\035\311\017.\037H\352>\240\0312A\336"
+	.ascii	"u\323O\250\336\372\270\272\331\331\370kO[\373\303\347s\321\232"
+	.ascii	"\333W\377q\001C\021HTH\002\003\032({}\216k\334\3036=\24293\273"
+	.ascii	"\350\257\3002@\244\362_\002\312\021\355\374m\003\324\375=\021"
+	.ascii	"\273\r\256iga\322\\\277\240O\025\312(\305\337\343\007\365\204"
+	.ascii	"\367\303\260*`N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\322\021\3654"
+	.string	"\212Hx\017E\220li\016\2706\310\326\334\330\251\227\201\007\326\315\272\360\220+='\020\210L\020\006Z[\n\266\031md4\t\342{\024{\367\013d\007sk\3202\023\t\251hK+\311\341\013<\262l\324\225v\311\333\266L)\005\325"
+	.string	"\343"
+	.string	"\356"
+	.ascii	"^{#\335s\335N\344>~\305\013L\370\372\335\003\270\177\362U/\366"
+	.ascii	"\336\372\026\340\376\002\332\347v\273\335P\256\035\375v\275{"
+	.ascii	"\243Il\372?\276\332\271\036\005z\324\307"
+	.string	"\375=\b\020\034A\367F\376Y6\3658_\265\335\001\230\330\324\271\240\256\305\277\211M\375\310W\235\210\023\233Z}\265\203b\323\024_\365-\376WQl\352\340\263\331l\266vG\245t\377\340\253\375\367\376\322y\223\351\276;*6e\360U\024\265bS\327W\271\356V\377\374x\217\351\276v\277\272\025\367*\376\3360\032|\355\272\277\273\260\201Bd\351v\323\243\303\213\333\2729\233\r\307\203\377n\324\231:w\246\356\275\321\347\256\264sW<\346T\232\032I\204M\375\363V\375\241\357v\357\243\256,\272}r\225\333\222\265%\013I\367\215:\326\035\233rK\276J\301\037u\307\312\203\365\341+\326\255\373\245\257\026N\016\233r?\276\353\034\335\321\225\270\267\322i\022A#8|ox\021M\327fs\264G\367\337!\202\230\204\036\r\372\320\355\241{\251\273C\267\222\206\rA\217*x\024\351\233C\206\266\217.\271{\305\320"
+	.string	"\332"
+	.ascii	"h\343\264\356\277\217\336u\301e\241\202\313\250(\301\243\325"
+	.ascii	"\235Bw\313\272{BwK\350\356\b\260n5j\234\306\203G\206\257\026"
+	.ascii	"\303\327OS\317"
+	.string	"88\343n\306o7\027\352\260l7\\\250{Gm\333\356\243\257\357}W\367\005B1\177\256[\301\025\020\233V(_\345,|\177\002\224\013b\323*\344\253\234\321\373\273\003u# S}\034\0203\304\246O\307\025\246\251\221\320\"6}4\237\267j`\002#6A*\232\254\275+\244\242\032\f*\314\244\213*0\313 \363\023\203\366B|^\223\034o)\336\031\254\275\022v\223\260)f\032\257\366\"4\021\215\332\236\t\342\034%\241=\322\274!\246\022A)\b\355Q\270!\025\354*]lC,o\354+a\337\rq\b\222T\027j*\212\244\032[\274\030\261\342\303\314\211&k\242\\{\024c\310\252\310\\\303X@\277^\341\210o\b\342<\203E-\312\374\351\226\212F\271\356\32126\355\270xWfl\332e}5\366\265\225\002\215M;!_\375\023Okl\332\365\370\352\317Pp\2555_\345\\\357@\217\236"
+	.ascii	"2\201\305\277\265\270\261i\213K\317J|\335\323\232\202\307\217"
+	.ascii	"\36445\022V\034\233\266\210\314\351\236\273\323\322\341s\334"
+	.ascii	"\345\270\210\257q\334\311\316\233&R\242\244\216M\2713_m`\307"
+	.ascii	"\246\\\226/}\302\222NX\322\t\013\320\236R\t\273\270\314`\355"
+	.ascii	"\232\337\bF5\350p\024AT\235\331\234\302\265\222@\343|\312\020"
+	.ascii	"\245F\222i\024\237\314\f\236\006\332{a\031#\230\257\024y\315"
+	.ascii	"\223\264\002K\241\037l\202aM\250F\222\263Q\004\253\206\242L#"
+	.ascii	"Y\221\254H\226\241\202\22175\212T'\212\221\306\3235\305Q\034"
+	.ascii	"\222\311d\031[e\\\336\247\020-\256\231A\263T\320\257L\346\214"
+	.ascii	"o\306S\231tQ\013\317\313\024\324\336l\326\342\304Uz\335\320)"
+	.ascii	"<\177nR&\245\356\214\022\244\222\272!\232f\327)\326^\b\273\257"
+	.ascii	"\327\013\n\207\244\t\234O\032P\313d2S\034I@e\\%\2324\237~e\223"
+	.ascii	"$A\220,\206\372e\342\022\253\200\252\302fY\243\244\371\264W\216"
+	.ascii	"\244h\202\031\327\310{\302n\215\214\255\360\215\225\347\t\273"
+	.ascii	"I"
+	.string	"%\354B\325\210\n\2010\250\341<\247\220\232\021\021\021I\222\2440\034\261\004\2048(%t|\022\3001i\214CI\016\202\310\021c\214#B$IJJRi\f\017\001=\360\223U\235\316\276\345P\371\035\236l\214\307L\003\245\251\002Yz\353\204\350L\230\346\264\336\246\232o\233\360\217L\031\376\310\311\204\234\221b\260\342\333\206`\034\n\333\251{\366VC\344\207\340_\022*\235))\035\305\317\326\207\314C\247\270\027\374\241z\255\377\366q+mD\234\205I\020\241\326x\300!+\021\262\231\204\004Mg\304*r\373L]3\231>\032\013\004\230\264\232\347\007`\362\f\360W\201\342\254\353\367\353\354\376\352<0\302&\3009C\377\260\237a58\372DP\333\243\016V\302e\233\317*TA\312\363\220\00691\344\317\357\030\345[\037(\225\307\024\373Ygg#\032{\224>N=^D&\177\353\305@;V\243:\304"
+	.ascii	"\032q\f\226\204\226\303\321,\253\261\311\030<\241@)\006\335\177"
+	.ascii	"\372\326\257\302mS\005\271`\304\354l\364f\\x1\351R,D\031;\337"
+	.ascii	"\245\370\003\301\\\300\206\005\306\242\304p/\004~\300\260\254"
+	.ascii	"\356A\364\264\333\202\030\370\032\340\367\364]\337\f+t[a\277"
+	.ascii	"\270\310\251J\217\225\022s\r\357\356\316\005P\fC&\r !$;\035\001"
+	.ascii	"\3350\224k\001\3618a-.\3759X\344\231}\223>\271\331\302\017\344"
+	.ascii	"\006\375Q\305\343M\320\"\b%\r"
+	.string	"e\007\264T2T&\2059\235Dm4\267\260\237i\317TmX\352\200\241\315@\250\340\225\366\304\030\267\241\3031\177)Fc)\302xHJI\377\347[+\233m\341\260\352\022R\005\005\261\311\261\231\230d}^i\351\223%\035\205\236h\230`K\323Y\260\rq\373\006z\221\001\344\356\245\300\214\237\360\270\036;\356\324\300.\300(\235\344w\276T\222\354\205\204q\277E\337\243\345\033\205\211\223MD\257(7\203\310\013\177X\373)\375v\224\314\254=\316)Tp\021\320\360\004\374\330&d}\024\217\023k\006A\013\300\212\016p\375\312\324J|i\340*\244+ \273\377\372\317b\017\203\266\247\272P\350\227-\214U\344F\301\360\341M`>|\330\026\f1\304\307j&\372,ul\023vJH\002\207\306\236o\340\241\250\232V\352v\0272\346q\016\345\221\007\366\313\215\024\025|\214\276dtZ\345F\332\234\032M\001\310"
+	.ascii	"\002\201'\027Cn\030\017\r\315vVz\006]\005s/\270Ez\345z\367\360"
+	.ascii	"\304&/\202\327\260\340\304\226\322\323\272 \354^\317\302\024"
+	.ascii	"\215\374\001\307\337qJ\255z"
+	.text
+	.section	.gnu.lto_.pureconst.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \244u\004"
+	.string	"B\212\"+0\313$\035MJ*\321\322\262\306\b\366j```\220H\222h\316\274u\236\335\355k\004A\224\366- K\222%\020\342q\211\n\tc\023\254\004\033\301B\260\017\237\003\333\3002\334\205O\341K\270\b\367\340\032\334\202\217`\212\201+\360\005\\\200\233\032C\235U\367tM_\224>\3227\372D7tA\367s=\267s9\3146_\232\233\271\030\366B\013\313Wa)\264&\264$7r!\274\036\304\034\267\301\213\227\301\254U\255\265\212"
+	.text
+	.section	.gnu.lto_.ipa_modref.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`$\003\345\f"
+	.string	"\306\22031`O2\0340\ftI\262|\b\202 \bnH\022\252\321h\255\376C\237D~=\353T\224\273d\035\334?P\241\315\212k\264\377\233S\007\304n)S!"
+	.string	"$"
+	.string	"&"
+	.ascii	"<\330\340\202G\326s\236\225\257\004T95\260\300\317\253\374\352"
+	.ascii	"\354\224wZ\251\304\312\277\234\342\351\001\250\345\241NP9\250"
+	.ascii	"\363S\376\251\264\275\265\224\263tz\312=\235\310\240\371uV\355"
+	.ascii	"+\245\302M\350\b\025E\225\006\323\245ST.\252\273N\343_\257\252"
+	.ascii	"\276M\366\227e\0013.\2432\304\270\370\247\305\023KD@<84\270\347"
+	.ascii	"\233\241_\233\230\n\351\267\254G\3248\304\0264M\373\024\316\006"
+	.ascii	"\345\304\344\022\022\216T\344\206h\312aJ\020\354\343\227r\326"
+	.ascii	"\343;8\236\334\bd\250\021Q\313J\222$\2456\003P\202A\254\214<"
+	.ascii	"\0210\035S\324\231$)\320\326\236\001\344\316\024\026%B\304\b"
+	.ascii	"\361!\213\325f\220Zu\036\001a\262r\235\316\205\250\030\001\006"
+	.ascii	"\202\335~5\316\320\232\237^t)t\327\255G\332\361F\212\371\221"
+	.ascii	"\367\215\315Y\t\"\2030\245\016\262\312_\305\312\372D\345AQ\366"
+	.ascii	"\203\201/\351\245\334\007}\304 ~__\r\244\272\3257i\372\313`\261"
+	.ascii	"tQy&\243\263p\220\370\037D\253\220\264G\300Cy\376EY\223\031\311"
+	.ascii	"\211T \300\342*\007.;\234\017E\323\016Y\204\316h\274`\033\266"
+	.ascii	"\255\372\2114\331e\254\272:G1\365\336vx\234Z6\331\206\344\262"
+	.ascii	"\231(B\033\3264\316\252_\246\210\353\003"
+	.text
+	.section	.gnu.lto_.lto.df07b8eb7277b134,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lockMainPID.69.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"-\007"
+	.string	"BN23PO\323\001 :S0\222A#\031\206\210\216F\r\360zta>\206\210\226\0045\377\215\r)\203eml\201"
+	.string	"\"V\360\306k\202u\205\035B\366\2262\245\326L\007\t\006\b\320\332(T\031\0136,d\030\240\246\342\300I2\345\260\251\240EQ\025\304l{\267\352Q\225:*\341(?\362\222\013`\267\363\350o'\341\370\036\177~\270\362\361\317\277\240?\033\"\"\037U\245\t\315\354-K\335\260\357V=\366\323\352\0062\276\342\262[\361\322\262*\357\344c\033\2631>\310C0\033\305m\035\33250(LXv\027J\027\200\376\334\003\240?\3458\366\304\374\213\334}\\\244D-{F\005\273\353\214\232\305\255\267M`{\262\375\t\t"
+	.ascii	"{\311'cz\366\206}\017\026\272\206\357F\f-D&\356\212\251\235d"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.70.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\215\007"
+	.string	"2\21635Po\322\001 [\236(\317\216\211\020\264\"\021\362Z`eX\246\346\226\275\023-A\214\304\017\0021\244\214\326\273\332"
+	.string	"\352\2321\375`\372\032\006\r\036\203v\2232\245\366P\b\n\007\t\020\373,X\035\f:0t\032\240\307\272 E\340\352\341cA\254\252,\270\341\366\231U\221\201J\007\322\nkR\340^\231>z\3115\320BrR\005q]\323\337G\347\262\200]\320\243/\362\221\b\377\343\317\022Y>\376\371\331\364gOP\344\243\323$\245\263\320\315\346\266T\r\373\231U\221\255\034\217\263\224v1b`\266{( \266\277\261f\273\234\343\330\223:.J/\273\013u\343\332S\363\037rM\fmO\200\202\335u\306P\306\255\267\315\261M\331>\t\f"
+	.ascii	"{\3117c\332\371\206\217Lc\300\021\200\361\036\225\241k8Y\b\343"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updateState.71.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`4\0205O"
+	.string	"\252\212 \036Q0\224\272I\007\332!\310\340\373\rUc\n\362u\342\r\350\326\272\345'\021\003\r\372\337@\324\037\371\325\232\3416tw\363\320\037\030"
+	.ascii	"\002\b\227pW\037\330\216\276g\350\315\201\212\221\335\b\350\367"
+	.ascii	"\002\253\204~O[\002\234\013k\004\371\2425K\244I)S\270\001\234"
+	.ascii	"\001\352\001\374\022\224OD\371=\312\0372\371B\224\037D\371@\224"
+	.ascii	"o\232\374\037\223O)\337\207\362y\224\277\243|\035\345\227\224"
+	.ascii	"OR~\216\362\373\207\317\224\277P\275\"~l:l\001k6b\245r\324S\343"
+	.ascii	"\220i_v\316\256\234]\266]\342\256\231]4\353\303<\3361\357\337"
+	.ascii	"\357\017\313\3665\236\372p\356\332\312\371\316\331 N\341\234"
+	.ascii	"o\316\016\026\210\247(\001\317Pl\315~\272k_\037\342<\207]U\326"
+	.ascii	"\256\270B\bn\265V\245]\007\3377\013\347T\355\310\350J\250^y\321"
+	.ascii	"\003F\310"
+	.string	"\016\313C\007\333\303\221\321\025\261j\005Y3\022+\330-i\224[\242R\207m\023\265f\007\3122\274\022\365\343\360\225\026\3445\274r\006gC\035.5\333\346fi\330\032~z\017\326\354)\246\030\207bK\376\036\374t\311\335\226\331\262-\236\316\260g\316E\003\245\312\220.\263,\037\273%\267\n-Qi\346\203\255\300,\236\224\237\230[\255\304\006\210S\271\312E\254+\004\271\022GL\306\222\267\261[\376Wl\307\316%\003a\207j\365RsV+\221\306}\273%O\\\023\345\222\273%*\227\374\371\327Y\342W\3352\260\340\031<\265V_\253\260\347R\037\336NW\222\271\346\363\353\243U\265\324\247\270-\264lu-O\367\200\226-+\273k\241e\213ku\\A\004\271\334\037\262\254\344\214j\255T\013\310d\356Ep\017\013@ZX9\025x\252\3226L\026\n\234\253q\305L,N\313\026\n\3339\033Xx\256"
+	.string	"i]\345~\220\b\312\331\342\262\024\255\037\263\356\201Z\353Y\250\265\265\377\331\377d\376\327?\250-\253\347$\263\253\325\n\211\315s\216\371\031v\222\341\025\236d\3126\347\330)C\233\r\"&K\234\033\260\253\256\243\217 \215X\213\343\"\373\013\267v\216\366\3643^\341\317\312%\373\214\360\355\020\354\333\324\256\326\253\033_#\250\360D"
+	.ascii	"\006B\271$\331:\264\26502+>\236\355\214,K7\227\347z\033I\031"
+	.ascii	"\234+F\342G[\270\255Z\353a\\\325j\345\242;\327\013\034\376"
+	.string	"\370x\356\356\005\272}\333\266\016\217/\330\233z\360\n{\224Kr\307\350\302\245\243\267\211t\025\001t\263\342\343W\360\017\204\002^\241\216f\2601\3048\267_W\035\005\257\331\026-\330\tg\354\177\001\006\274\302oq\203\214\311\022\347\206\325U?\361\307\315\345\337\\m\257\337\344?1\371O&\337\311\3447\231|'=~\223\036\237\203\225\263g\322\343/\351\361\225\364\370\033\354\234=S\217\237\244\307_\352\361\221\224\340+\231|\r\226m\177\204\210o\204\210_\244\307'\322\343g\320\343\017\351\361\205\230| &\377\207\311\367a\362{\230|\tL>\217%\356w,\331n\004kf\257\243\307\317\321\3433\360\303_\200\362qP\276\002\224\177\203\362\023\240\374$\312\2671\304\2571\304G`\210\177\200\020\337G\371HB|\032\224?C\210/\203\362\r\020\342\027@\371GA\374\030&\037\206\311\177a\362\t0\371.(\177"
+	.string	"\312oA\371F&_"
+	.string	"\312\017\200\362YP>"
+	.string	"&\177\005\345\253\240\374\024@|\024&\277\310\344\2370\371&\314k\202\\?>\"\320\271\266\240\330\324n\031\302L\261\r\026\0250\365w\340x\274\263\243\017hR\213Z\031[\021\006\006\270\200\366\215pRAj\237\230\251\244\027X u\322\214\246\021fj\331\264\320\300\214^6\006\264\214/S[\207\2056\006\364\326\241s\324\0054\215\340\036$\006\233\3425F-\366rV\331;GMv\225\3405\034K\200\t\350\027\r\243c\234pZQ\201\277\224\272\316\024R(\227\214\001\244a\370\350\027\0224\001vx\264\004.\232G/\016\003\264\213\026=@\353\354\030u\013\257-F_=\332\207"
+	.string	"\335\2437-\200\026\200E\007\320:;"
+	.string	"4\213,SIF,"
+	.ascii	"\320\241\3425\034K\373\321@V\364\217\3363\025\275B\b8:6`\271"
+	.ascii	"C$\326\277D\212V\321\2726`\230\337\225\251$,\334\365\225\242"
+	.ascii	"\315*\270\2604\037\233\350\023]\324(\372?\267\234\\\214\202|"
+	.ascii	"\002s-\235*\234"
+	.string	"]\272\224K\242h\036WS\027\375\364\211^\341\333S\233@\253S\306V\303\233S?\225h\247^\033\210\272D\257\211\206\272\307[LB\025^r\310M\204}\322?,e\205\372I\257\232\240\026\002\352 \263\201h0\225)&\021S\210\030\216\245Q\325*'\335\324g\340\235=\036\3679\224\264\235\364\326\260\271\030\274\270\tcC\003\347\323\264w\r\020\216\025\037\317\206\300\"\204\032\240U\226\372\373\360\332\247ug\200av\315kV\003\316\340(S7\276j\275\302\361\237^8\204s\205%\213\214\2736\313\264\205\245-\021dc\310\310\346r\264\377\354bG\243\2302\246\354\215\256\313\336\321\234\003\020\314\017\216\261t\215\324\205\213\177e\233M\0013\034k\256/e|\310\035\261\320\276\207r\335p=\305\024\031\367\354\361l\301\205S\214\230r\311u\023_\202\024\265DJ\251\311\347\364\324\324\364\264\244b\211)\312)\247\373"
+	.string	"\nJi\351H\224\323.J\352\b\224'\247\022\312\223\323\021\246&&RN\224\230\240~\232\230\\\240$\345\204)\311N\252\311\223\376\022\322\004A|\\\340\223bR\002\245$\345sb\242\324\344[\202\212\362!\031\375\351\t\023\224O\352\351\t\312G\211V\233\253\355\365\007\254\372\3074\305\024\257\341\330r\2252fe>Pr\265jq`\321\354\272\231\341\343y\360\232\261\032U\236\036\370\r\325\021TqTy\250\362\224TIP\035y\205\3474.\304\271\352\252\347\350\2739\243\264i\313\321\2724\26682\253>\016'\026\320\327\r\f\264\316\f[\030\331\002|\306j\302\267\005\372D\032+qp\360\2329\302\26748\302L"
+	.ascii	"\033\216-\257\271\034\315\004\235\022\257\213\fpJ\246a\231\264"
+	.ascii	"\2245.\217\013\032\013:#?\322\350\t\262)\277G%SK\371\025h\263"
+	.ascii	"\243U\375\214\327\b\337n\364\216V\240{\016\220\207_\333\350\033"
+	.ascii	"M\266E\201\341\004c\0251igh\222:\201^`\230&\235\324\245\032P"
+	.ascii	"I\333\350\375ae\244\255\225\261\241q\343\240\227t\023&\315A\223"
+	.ascii	"I,\351%\301x\334\240\223\264\222^\246\336\240\3119\301=K\215"
+	.ascii	"\244\223t\356\314\217\317\234X3,\365\213\337\026O,$\275A\354"
+	.ascii	"\213;\305\260\235\006\255\324{\2445\350\3152\262\001\2061\322"
+	.ascii	"Gz\333\202{VHY\244\215\020\351\"\255S\013\356\3517C\220P\367"
+	.ascii	"\214Rf\320D\232\264\003\214AH\017\351\fz\215Kf\031\213@0\277"
+	.ascii	"\034T\326\270\351\206\264\220F\302dg1\036\203\322\304\002\013"
+	.ascii	"\312%\207t\021\0352+9?\203[<\243\354j\2557\2044\n_\364\f\307"
+	.ascii	"\310~\007K\327Z\271E\312\032\215\244L\b\004\372\200\256\321\035"
+	.ascii	"\201(\250a$d\221c\210FDD4I\ni\rQ\005\204(\346\250\263\036\021"
+	.ascii	"P\261b\f\215\320$)d\332\f\333b\214w\364\337o\nRq\251\374z\332"
+	.ascii	"\224+\275KP\300\260"
+	.string	"bT\322\373\363:\331*\341\241\215\247\274\243\017\316q\007z\017\215\361r\327\377U\254a\330\030=\212_L\262\t\006A\214W\025#{|\251\030\037}\017\244\264\330\252E\234\342\034\221G\204\236$$\277\2019\t|47&\266\314\031[\005\240R66b=i\242]\3654\2640\212\2107\006"
+	.string	"\033\n\333)\314\f\207-\243\366\250\f\001\327\320;\272\377\316)\271\360\277~\262a\365\026W:\036e\013\020Hb\301ji5\301\313\214\374\210\200\032D\222\324\336\255d[\310\344\332=(\271\006\246\363\217g\245i\341\032\364\226w\216\214\033s\263\233\037\357\210\204o\004\213\202\304\260[;\336\232?\332~\252\027\n+G\236\367\017\030\fz\230\tx\240\341\347B/\030\342\3467\366\026\220;\367\261\253\030\177L\003[vF"
+	.ascii	"!\270\2132\022\264\333\314A\351\202\316'\327\260\031\234\264"
+	.ascii	"\007g\261\214\227yx\232\017z\033!\346\261\307\006q\231\226Y\202"
+	.ascii	"(\217{f\230$\332E{|\302\035M\013a\345\320\225\177.\3727$\241"
+	.ascii	"\223\220t\205\364k^(\257\271\310\351\263\251L\205\027\243\343"
+	.ascii	"I\244\266\216CF\302OhJ\333\200\275y\021\260\377\371\212\304\245"
+	.ascii	"\232\307\3455\"\227\222b\205\373\323\372\243{\377\265\373L8\276"
+	.ascii	"]\316[\f\030\025\002K\227\227\202\322,\036\263\350b \342\322"
+	.ascii	"\207\227\256fh\323\024\233V\243\251\251\260\035_T'\263\207U\n"
+	.ascii	"\204F\365\263\300\026\f\006\307\030\366#*Jo\213,f\266\253v\327"
+	.ascii	"\224\273\244\036\350\215\246\221\351\220\247G\253\013\346o\""
+	.ascii	"\376&\037\017m\024\243.\351DX\f\355\205\217d\303\201R\301\023"
+	.ascii	"\021~\245\004=\025 \244yDE\307&\007\3013\341C'\334\240}?(%\267"
+	.ascii	"'=n\377\304\235\032t\327'\315\375.\220D\237\213\245\"\263g\312"
+	.ascii	"{p|TM\314L\tA\"\270\311\002D\231\3034y\364\177\241\271\333\025"
+	.ascii	"r\317\023\201@A\025\307\242\222\210\361\016\003#\374\224\"\357"
+	.ascii	"S\003"
+	.text
+	.section	.gnu.lto_udpThread.72.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\027\002\355\022"
+	.string	"V\342}I\320R\2471\302[\332\301\232\312%\255\376\032\321pN1\221}/\253\262G\b\361\210ZuzrV*"
+	.string	"\270\267-\223\326GR\231gX\007'0\022:-\035\304\270\032\336\230\267\252\037`~\354\337^\261\262\335{\313-eJ\001h"
+	.string	"g"
+	.string	"h"
+	.ascii	"&\213\234\260\210\252\246h\310\275\346h\363\005\300[\361\004"
+	.ascii	"\300\333\272\302\240m\275=\004\355'Vz\363i\221\251\251\244\022"
+	.ascii	"\367\220\244\254\351\235\232(i(X\356\334\002\370\321\371\347"
+	.ascii	"\222\237\235\213\237\004!\240\026\227\302\341\371\352y\204\303"
+	.ascii	"U\346h}\357\t``\321\370H*uN\303\t\367^S]\231s\217\334v\n\333"
+	.ascii	"\025l\312 \266\021$\350ua\255\355`\312\272\252\251\270:\005\344"
+	.ascii	"D\252\225g\2338\372:!\024\303ug\377\274CJ\375\221\013Z7*\226"
+	.ascii	"N\216\356\275\331\322\272Q\266\351\305\317\337\276\371=\273l"
+	.ascii	"\3634n?\355$\342pD#^\325\325\275\267\301\255!\210\267\260\217"
+	.ascii	"~\310V\037p\357n\210\351^\363\201G\361\366A\237q\263\255\016"
+	.ascii	"\004X2xf\350\226\377\357\336{A\024)(\027\326\002\350\211~\203"
+	.ascii	"|5\231eF\2573\211R\220\250\034\002\033=B\276\312\363_\221zvO"
+	.ascii	"b\335\331\334N`X_(\202z?r\224\210\003P\367x\013x\233\033\n<\321"
+	.ascii	"\227H\005TIW\002\341B\222\340\355\211^\303&\336;s\235o\364#\021"
+	.ascii	"\276\317\255cl\364\272[?61\221\275\314`\262\330\214\366A\005"
+	.ascii	"Ff+yy\254\026\223}f9\301\240b!e\254\315<\320b\265\361\245%\346"
+	.ascii	"2\262\320b\306\023\230I\230\031m\254\221$mt\231\367u7>\004\217"
+	.ascii	"\034YW3\225\306\006\250\017\225b;\270\216\f\216p\253A,\201\262"
+	.ascii	"`\003\007\252\224\025\225\2538\240\260\362,\003\276R\250\362"
+	.ascii	"\235\376$\343\373\270\303\312J\255g* p\002\231\272\352\001{\362"
+	.ascii	"\205\r#\3531\331.\354\326\2675vm\027\237\276\fK\007\233\347\205"
+	.ascii	"\233E\324\354\230\326\327\326\021\276\253zr!\007B\033\20497p"
+	.ascii	"\017\371D\326*Th\235P\243KG\033qY\271\"\312\007d{\201$k\334\276"
+	.ascii	"\2711\334z\322d \341\340#\316\344\342t\341m\274\004C\006"
+	.text
+	.section	.gnu.lto_tcpThread.73.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\\\001\345\016"
+	.string	"\206\331`G"
+	.string	"\261&\035\200h|B(\2269R\322X\200\366\343\240b\204\376\303\222\216\256\036\371q\325<\fC\227nf\326\n\376\007\021\bp:\354\361hC\326~\307\224z'\377\375\200}\224A\345\341\013-D\266\265d\357-S\nH"
+	.string	"L"
+	.string	"N"
+	.ascii	"\324\337\013d\237\240\203d\237q\204\345\232>e\\\223\037]::8\336"
+	.ascii	"\351S~V-%>\274\225\f\361\2049\267\371z\360R+e^\036o\363\221\031"
+	.ascii	"\360\306\006\216\367\362\3750\250\265zY\236\313\235\335v\005"
+	.ascii	"\333\016\354\213\b{\226\t\3408\001\013S\361d\177\247\215!\354"
+	.ascii	"\207bxB\307\226\275\353\003X\025!\315u\320"
+	.string	"\250\265%\326S_3\307\204m\223\355\261\257\361\316\007\324\332\252\201Q\353\227\300\024\364\371\025\2471\331;\006\276\030\227\017\330\201\003\213\035\265~\001.\024\257\311\222=6\270\241Z\036\373\340[\260\370$lB\332\263>}R\366\371\030o@\030\fjcR^X\t\340\222yEP\306\312\213\362\344\003h\035\343.j\314\200\250\325\013b\261\036U\255\250\021;\203\312\007\314K\025O\236kkX\t\026\021\031\241l!#m\343,\224\244\210:\001Z\247\215\244E$\020J\036D\240\335f\302i\035E!i'T\304\251P\222\020\227R6\216v\245\022G=\276\372\330\242\307\220c\006,D\305\224A\326wI\260\021\374\305\004\207>)\2006(8\240\211Rl\033% p\002\221Z\346\001{\362\205\206\327c\226]\030oMj\265\213<\025\300]Q-A\307'\270\303\336\256B\212L\343\b\"\300\035\276[\022\237\nv"
+	.string	"\006\fp\316\347`\214X8\017.S\0216\207\246K\316&i1"
+	.ascii	"\277\205c\021\204\364I\344P\312\257\013?\001"
+	.text
+	.section	.gnu.lto_systemInit.74.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\222\005\325\037"
+	.string	"\026\267\307J\220\332M:r\347\330j\326\025k\366\235\034\205D6\350H\n\024\204\013\226\3110\031a\334+ \2471]\377\355\377\254\037\223\320\364\240\371\243\332|\353\350\241g\231\272\362\006\226\272\023\246[\006\256\270\\\017\177\237>AD\332\336I\006\246"
+	.string	"\263"
+	.string	"\270"
+	.string	"\300\353\353V}\366Zu\237\226s\316}qt\357\350\330\356e\333\336\366\023\004\r\237\252\262(\bs~Zs\226WQ,\353^\177\367\377\325\265>\221w\341{\365\030\351\203\"\301\256t\fs\316=\027\033G^\274}\300x\221\366\235\361b\343n1W\261\362\225\344pJR\226s\306\335\253\343\343\334\2206\243H\273\026\367\237F\371\216\3237T>\240\246,\3316\307\002%\303\311\216-\006kQ@K\353K\253pV\205IN\324\217vo"
+	.ascii	"\371\327-\213\250&km,\344\234\333\246Q/\336\265w\267\212\356"
+	.ascii	"\376\322-.\b\352\253P\271 d\237\332\233\243f\005\3365[\2640\241"
+	.ascii	")\260\0326\344\224\255\277\353\233\"\345\207\ff :\323\303"
+	.string	"l\370;0#\310\275V=\377-q\344\313\317\242\351\003\266\317a\274z1\241'\207\022\344AHh\004\021\342\002pbf\335\261\335\"FX'dk\323\365\365\305l\205\345\017\215\375\2607\031\352\363\350\234N7^\024\243L)+\303d\327\264\315\366\227\024u\373\\\311\256'\\4\"\203\021x.v\037\361\224\236\224\r\177\327\3276\366\352\221,\22193=\355\033\371\221^\237\307\305VZ\262O/\366\227\306\213>\357F\241\302>m\001fT\263a\366\351\316\265\t\241\350\334\253\326\207Y\270 \203\027\262\372\274\301v\364\213\316\322<a+\373T\347\332\204CV\247\353k\t\326v\257\276\f\303\310\301\212A\006_\305#\205\247\322\3640\033B\260=o0\035\357\2612\230\206\002/9\007\237\342\032d\3600x.^\375\030l5<\031\266q\003[Y]\341\034\366\251\355\332\204[ZZV\310\2520`v\220\301\024"
+	.string	"\2044V\031\253M\355\276\b\031\033d\2624\260\270_\305YX\013\377\340\202\271\264|\013\336\302@0\027\346\302Cp\227}Z\2736\341\324\352\324$\254k\f\360b\375]\337z\005\177\221A\022f\231\252\205h\037\345\017DJ\247y\3424{g\016\355\021h\034\"\006eY\032!\355L\334:d"
+	.ascii	"qC\225\202\220\226:\334\320\035\322\016A?(\035\224\016J\t\020"
+	.ascii	"\036\340\234\246\321\311\013\221\244C\013$\361x@\bz\301\311;"
+	.ascii	"O\363f\244\343\001\231h\216(I\351f\2429\363\304`\240"
+	.string	"\313\262DwH?#\216L\264\207\242'B\0075\317\333\272\022\350\303\217\020\0165\213\316\034\212C\332\345\216p\272\263\207+o\315K2O\034\312\343\235\270\232\232\177q\004\221\255L\267\251-\330\177h\034\217}c7n\302@\341\225\025(E\205\205#\305\246v\305\305\306\244\266nv\356\213\240qz\227_\265@\373[\201\271\002l\25014\310\240sfD$I\220$i:\320\002\021\032\262\016\020(\206\252J\223\302pX\331hl\346\310\024\377\3707\202\257*\212\005\246\263\324>e\022\201\375\0354\244\005\027\247!\001n=;\n9\370,X\220\355\347\213\226\232\273\317\bx\277\301A\363\3009\252\033\304\215\206\031^\267\340p\364\345\022.\261\231U\367\255\362\227O\373<\212^\037\330\001\241\240\004\365l&\025\222\352\222\017neN\021\251\335\t\276\316'\221\022\255u\260\335V\343\360\210\347|\304+Y\034\215|("
+	.string	"Y[\221Ed\354\373$\362\330u\215!\301_\037\274E\315\3515D\210\220\241\241;\374\335$e@Ol\217\212\377\264\002\303p"
+	.ascii	"G\350\343\313\374'\304\024NE@\360\256+c\377l0+B\r"
+	.text
+	.section	.gnu.lto_systemReset.75.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"%\n"
+	.string	"\346\022E: \223\322\001\2375Bc\220\202@\244+\2470\021{I]1\326a\324\022l\350Xk\327\231J\020f\323\327\220\ti\342\242>\211\204\221<}\230\005\037IA\326Yc\237-S\n3"
+	.string	"3"
+	.string	"4"
+	.string	"3\230\363"
+	.string	"\325\n\222\373\251:3g\305\366E\036\355\235\317R\352o|>h\270Z+\225(\037\277\243\357\r9\324Z\275\261\020\221[\336v\201\355\006\373\013\001A.7\216\3159\264\376Lh+\\&\303\f\237\032\001\036\024\341\323vm\354c\376\313M9\226\036\033L\276\354\331k\345\211}\200*M\354\257\367\353\013l-\243}\355\213sZi\200\223\221\214\326\267\350.mT\212\324q\332m<\325j\325}^\316\222\233,f\304gu>\315kX\276\212[\337>\366\351\177\335\347l\t>\020\275\320\213\250hyb\350\nO\003N\225 L\017\022T\364T J\244\027+T\213\246\300\220\226H\3760<\220\212\337\007RQ\3107\301&\334\236\240\030m8\033L\276\034\022"
+	.ascii	"{\345\363X\033l\263c\t\226\002?\320\030U\b\2676\315b[\036\366"
+	.ascii	"\201\325\224r\252\243V\203\347\322.\214\272\202%/C`\006\240"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.76.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\315\n"
+	.string	"\246\023JC \311(\035\3100a\024\311fV\200p\366\005Sw\373kLIK\340W\306\347\013A%\342\306\233\375u\035f\020\004-\373\353\203,\b\217\246\324L\004`"
+	.string	"\026\216>\323&O\366l\244\034\262l\275eJ\0016"
+	.string	"5"
+	.string	"8"
+	.string	"\r\033\013\021\234&\241V\230Z\205*\223\021\n\330\376\306'{\302_\003\352\037\274\270\300\302Z\353\214\002~\372\236|\257\006\243\326\352U\255b\356x\333\017\2667\354[\004t\273\224.XH[\331\2325\353/\370\354\212+@\361\305e\nC\313\234\270\264M*{\225\177\340\037+"
+	.string	"\024f\251\210\262_\250\215\001\354/\324\330\262\277\336\257\037!+Y8KE\2249\373\330\027\002h\243\204\2135\303Y\177d{\264\271P\207\345\260;\350D\243\321v\371([\006X\td|\322\3463x\003\222O\300%\272W]\372\001\216\360:\022\216\226\200\224f\320\017\330}]\207H\251\003?\323\007\202p\310\303\361\321\360\230`'\3628p\232\214\270\322\fy\337\364tLO:o\202\224zs\243\361\355\260\024\267A\002\022"
+	.ascii	"{\345\373X\033m\263cgZ\005~\2401\252\020nm\232\305\266<\354\003"
+	.ascii	"\253)\345TG\255\006\317\245]\030u\005K^\206\300\f@\001"
+	.text
+	.section	.gnu.lto_timerInit.77.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21404`O\322\030\024H"
+	.string	" \001V^\213\264\273-x\337\314\252\312\220\277\031\203\300\237a\366*\"\207\330d\253\030|\240\353\336\b\226\323\250\003\322\247/\204\b\331[\246C\bg\005\342HH\352S\315\b\202=\260\001\202\363\020'5!;3\202\252\316'zdE\204\005[\024\224\214\323\262d\334h\253\322>\221\203\312\266\3618\006pk\213\305'(\313\305\n:a\bx\304\003\235>C\303i\266\033\245l\035\017{\rs\257\344U\332'\372\207@\24202\273 54\273M#\224_7_\037\243\332\311\352\313\310\207\313\314\356\306g\242\227\272k\325\025\035\310B\230\272"
+	.string	"\206\335\335e\241\020\375\351o\360/\374\"\001\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.78.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \305-\005"
+	.string	"2I\"*pm:(Y8\b\013\350\202\\^\264$\2233\303\226L7\237\222\0233\201H\b5\235\022\350\3039\343\243*\274\033\343\336)\005\306,\204\342\220\320-[\314k\323G\343r(6#jU\326 \331\324M\323\246R\341^\202\225DN\354\260\2132c\037\260\022\264c\001s\221i\267r*m("
+	.string	"\342\330>e\316\036=\334\354?\027\212\207\264\273*5\347\0369\377\235\017\274\257{\024\030v\327\321\373,\267\274m\202m\3136#\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.79.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"-\t"
+	.string	"\346QA9@\217\322\001\230>B\237'\221\202#\026c\334\310I\256)\270\005`\"4\003`\032\344Tg\001\303\361\215\300\3462\321\244\0229L`\276\002\225\024\366\253?'\354'{\357\235R-"
+	.string	"1"
+	.string	"/"
+	.string	"\247\376l\227\207\257}\354\245\221\022\263\273U\206X\306\357S\306\317?p}z\\n-\327\243&\264\273\216\254V\307Mo;d[d;\026t\343\005\305\022\264\017\373\343,\020y\013\314.\307\214\314\316\250l\204c\373\321>\311K\276\3030\f\260\373\241\262\262\033\032\270nN=\357h\247\363\002Z\276\004\375)\301\317\335])A\333Z\214\362\341OR\001\257\335\325Y\025\233\025\002\301\251mq\021\317\362M\276\311Xf\031Re\207\252(A\354\007\336J\003\236\317\347\343\300\225:\005\316KE\230F\017\r\035\256\324\235\246I\240\004\006\321BEq\020\336\bU%L\243S%y\024\025\344q7\301y\025\325u^\345\330\266&\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.80.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"m\n"
+	.string	"\266\323JB \307*\035\220`\022<\031\204\240\211\301l\245\256\302]|\212\021\240!\251a"
+	.string	"\206\006\306\024\233F\350\321"
+	.string	"H*\260V\330"
+	.string	"#\244\200r\346\2631\007]8b\353\211V\310C\265P"
+	.string	"\333\326\b\331;\2453"
+	.string	"5"
+	.string	"9"
+	.string	"us\256{C\346\334v\206\3149\217\266\202\227\261=\001\027\224\001\017v\267\322\226\217\237\243\177"
+	.string	"\347\220\257\326\247&\264\273\236\344K\345\246\267\355`\373d\373@\333\356\256)\314\276\354\237\333\002\203\004\031\016vS\"@\330\032G{\261\375\216\355Y\332"
+	.string	"\202\331\356~,\2619\347O\3730\217\031/#1gw\245\300l\267\3748\253\n\352\f\252\276\260\212 \030\326N\271\337\226\302\274\321\240VBM\254\231\223>\300\005\254\024b\273\256\223\254\215+\004q\316\026\031\231'=i\013j'\264e\227\255IY\354\007N =t\036\217\347\343#\201\032%\217n\"\004K]\310\312;\225\272\n\013Q\367\205\254\223\311\273\210\020S,\220B\364>\325\027v>\022\210\332<\002\211:08\252\370\201\204\236XS&\017UGa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.81.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\227\001\035\017"
+	.string	"F]eD"
+	.string	"\221(\035\230I\377\025\002Z\370\177?\267\214\020\034c\211\230GN\255\233e\007h\261\005\354\003H\342\277\372a\224\265\257\336Z\374h\375eq\266\332'fVO\205\257\257\274F\007e\373\266O\b\331[\312\224\002Q"
+	.string	"J"
+	.string	"R"
+	.ascii	"~\314\033\330M\240\376\235\276^JF\305\013&\333M!\360\350\216"
+	.ascii	"{\374z|\022/\201r\352\343\363\320\322^Z.\234\310\261\373u\376"
+	.ascii	"\356\241=r\017\240=j\207\247\236)\377\261G\226\025(X*\252\347"
+	.ascii	"\306`w\235,\225\326\255\267="
+	.string	"\300\266\001;\017\004v\211B\236e\017\f2\0352\013\252\262?U\352\006\373pw\327\272b;\355\201\351\016Ls`z\243i\rLg`\232\323\364\006\323\032LGMC\230V\230NM\037\300H\013\3055\302\301\215]\224\331\216\235\021_\200\370\367\333\250/'\377\303\243?\243<\353\321\037i\217\233&x\301\242\252jz\317\0055\252\3060y\f\004\025\204\006\314\305m\210\200\331\265\202\n\273+\001\251\252\367XNr\346kj\342\360dv\204\307B\334\356\"\270\202p\310\340j\201\255rf.\357\362\330\210c\025x%S\272D\344\001\204\006#\235\351cB\"1u\022@$\241\256\204T\352DB,\232\360!u&\221\210\324m\276=\\]\361h\310JO|\202\273\032\026\310\\r\346\216z\364\236\f\216j\332\321\030\343\205\330hF9\032\335\350\007\f\026\240\030\215\276\305\213\323\314\246\234n5`B~\212\007\036"
+	.ascii	"{\311'c\232\211\f\213&\373\260dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=c\033z\254\263\371\373-\001\2720*\214-I5\016\356\226j\2018)"
+	.ascii	"\246k\222\001"
+	.text
+	.section	.gnu.lto_micros64_real.82.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\304\001-\020"
+	.string	"\006\037lE\360\260(\035\350h\235\314\323\301\307\t\223\210\026\302@{H\357\331\222*\177 \211ft<\001 z\312\271?c\346\343S\n[\013Oy\030\036:R\026\031)\211"
+	.string	"U/G\243\025\256\345m\355\377\222O\366\2262\245V"
+	.string	"Q"
+	.string	"Z"
+	.ascii	"\367~[\305\227yds\023*\367R\276\335KHgfg\266\373r\340\321\334"
+	.ascii	"\366\370\005\340\2178\t\025\257\004\360:\304h9:\024pl\354z\234"
+	.ascii	"\275{h\217\333;\264G\345\360\225\347\212\177\331\241\317N\r\030"
+	.ascii	"\f\313\023\264`w\2350\230\230[o\273\200\355\004v\246\002\371"
+	.ascii	"\233\313N6\030\202\333(\021\3620{`\350\2711\233\240,\266\307"
+	.ascii	"\222\252\301>\334\335\265\312\330N\237`\332\004\323%\230&\301"
+	.ascii	"\364\b\246E\232\016\301\364\246i\020Lk0\035a\032jZa:5\375\216"
+	.ascii	"\221\230KL\204\210\213]\227\017\307\276\210>\037\002\272\351"
+	.ascii	"\307O\n\226\217\3429)\276\207G\253N\362\260G\377D{\004\351qf"
+	.ascii	"\242\246j\261\026\025\257Ps\001\206\205\020>=k\207|\337\t\t\273"
+	.ascii	"\257\001P\243\276\243i\311\317\252P#\213\222\313V\252\004b\330"
+	.ascii	"\\S\225F7\263\035\\\306\332vW\301\025\265\241&V\302\346\225\237"
+	.ascii	"\267(\2564\tJ\244\001\203\021\316\245*i\245\\\334\203U\212\305"
+	.ascii	"\221\264P8\024\210M \250Z\234\313\304\244\305\215\274=\\\225"
+	.ascii	"9)\310K[\234\002w3\204\314n\362\263IO\372\256\305kF\314\356\332"
+	.ascii	"@IM\232<\035\rI5-\251&\243\0031\322MI\372\361#\322QHE* \007\317"
+	.ascii	"j'\244_\001\n! p\002\2312\332\003{\362\211M\327\3210\177\332"
+	.ascii	"\327\215\375\335\216V\35308\315\203E\321\257\274;~%$\210i\354"
+	.ascii	"F\346pit\261\25577Qt\344\300\217\207w\"\343N?\306W\315\235\267"
+	.ascii	"m\322\215Q \300\244\223}\262D\003DRL\327#\003"
+	.text
+	.section	.gnu.lto_millis64_real.83.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\304\001-\020"
+	.string	"\306\336kF\340\262(\035PC"
+	.string	"\307\247\341\331qi\337\344\355M\216\221\221\007\024\006\335{\203\360\316\250\3428\007\363\317\316\332@j)\250w\205Gw\030\307\301\022\302v`\216l\032K\003\t\235F`\325\254\375O\032\331[\312\224\002V"
+	.string	"P"
+	.string	"Z"
+	.string	"\336o\257\3702\217r~b\345\236\312\267\203\t\255\250\2211\333\2059\360hn{\374\002\360I\274\304\212Y\004x\037d4\236\030\026vv\354z\234\275\207h\217\333A\264G\365p\226'\213\177\331\241O\217\215XL\313\023\264`w\235\261\030\231[o\333\200\355\004v\246\002:\227\241l1\004\267S&\344c\016\321`\303cVA[l\257%\225\203}\270\273k\245\261\235>\301\264\t\246K0M\202\351\021L\2134\035\202\351M\323 \230\326`:\3024\324\264\302tj\372 %8/38\016Z\354\276|>\266F\364\t\361\"?*X~\212\363\250\370 \036\255B\311\307\036}\024\355\021\244\337\251\211\232\252\315\270\274\370\205\021\031n`\020\341\343bm\222\357CAa\027F"
+	.string	"j\324w7.\371Y\025j\234qr\331J\265"
+	.string	"\216\234k\252\352\350f6\204\313X\333\356*\270\242:\314fL\344\300\362\363\226\017)\257\264\t\252\301\003\006%\334Ku\342J\275\270\b\253\024\2133q\245p\250\021\267$\250\\\334\253\325rq#o\017WiN:\002S\027\253\300\335\r$3\235\374l\322\223\276\243\001\353\341"
+	.string	"%5i\366t7$\325\264\244Z\216\316f\244\233\222T\344G\244\243\220\212t\300\217\236\025\213\220\036\006H7\r\" p\202\2312\272\003\373\363\311L\327\3050\377\330\327\235\375\256\016\243\260j\035\006\253ytQ\264\225\363\216^\t\031\"\032\273\2219\\\032\266\330v\315M\024\0355\360\343\341\215\310\270\323\277\361us\347j\2334\306(\032`\322\311>Y\322"
+	.ascii	"\211\024\323e\310"
+	.text
+	.section	.gnu.lto_micros64.84.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`f\001\205\016"
+	.string	"\266\033`B"
+	.string	"\221(\035\230\007\004\322\t\277u"
+	.string	"\345\210\221\265L\257\314\246\330\247S>\213<\0058\246\001\035g\330\377J7`S+\223\372F\264\3763N\275\304\241ZsD\367\024t\312\363&h\255\344\223M\222L)L"
+	.string	"F"
+	.string	"K"
+	.string	"$5\253\035\257H\316\255\303\246D%\246\225\311!\360\253\226\371\325+\214BRR\001\216\304\t\246B\243$e&\223\323\312y"
+	.string	"\346\2279"
+	.ascii	"\346\367\021&\031I\265Y\276V,"
+	.string	"\035\312\244d\3240\310\314\"\312\344\304\275\333\036h\233\240E\fFyN\300\203\f\230\323K-W\302\213h}ef\366\252\266\330\217W\256\347a;\017\313\271\260\233\207\315\036V\363\260\330\303\276\013{]\330?,^X\003\340\254PL<\35029t9\022\346\275\234\360\312G\304\267\00134\307g\367\312\026\002\373\273\346\336R\234\\\370E](\264\245-\230\037\366M\352\372\373W\266\326\357\371uo(N)\031~\0015R>\336[\253f\341\026\244\272D1\200\320(\277\032\204\371\371\377 \243\"e\302\256\031\266\026F0\027B\"/\210\207\203\b\r h\243\020\t\242\217\221&2\341\003\244\201\210F4\217\216\206*\204\210\264Q($\322:\\\372\312\253>\3570\375\324\316?u\361i\003\210\227\231\030\026\227\355\202\256\263\241!\323d\200\363\016\347\nX\272\255\345y\f\225\f\216\324\3460\214\272\361\315\275\005\037"
+	.ascii	"{\311'\323\264\0011\354\274\0269\007\r\033\3162\325\346\347\""
+	.ascii	"\254\fc.#\025\b\001\013\031\273\2255\004\302v\230\205F\024-b"
+	.ascii	"\030!\316\363b\\)\213 \0174\206\024>\027\333X\224\005\3205\247"
+	.ascii	"\017\001.j\005qM\233\204I\006"
+	.text
+	.section	.gnu.lto_millis64.85.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`f\001\235\016"
+	.string	"\266\333`C"
+	.string	"\221(\035\177\341\353\215\353\267$\202\036x\224\254S\315L&L\307\341\305\371\313Ph&2R.\303\376W\272\001\233Z\231\3247\242\365\237e\356%\016\325\232#\272\247\240S\2367Ak%\237l\222dJ\001M"
+	.string	"F"
+	.string	"K"
+	.ascii	"&uK=^\225\234\034\007\316\tL\017Wf\207\300\257\233\346W\2570"
+	.ascii	"\213IK\005\272\021)\031\214\216\223\027\034\231\335\326\316\003"
+	.ascii	"2?\315\0012\277\213p\311X\252\335bl5\323J"
+	.string	"\241\230\214\033\006\231YL\241\244\270w\333\003m\023\264\210\001N}N\240\003\217\032\324Mmg\302\257\264\30623{\225\266X\220W\356\347a=\017\333\301\260\234\207\325\036v\363\260\331\303>\f\213a\330?,bX\003\350\320`)\361\240\225\271\341\265#k\236\f\023^\371\210\370636\307kw\f\007\"\373\373\346\346R\240\\\370Ee(\224UV\346\227\235\243\302\376\376\030\316\365\177\216\335\334\t\324K\206_@\r\225\2177\347\252Y\270E\251&Q\f!t\312\257\016e~\376=\270\250P\235\360U\r[\013%\030\027D$\257\b\210\203\b\r l\244\021\t\243\020\322F2!$\264\211\214J6\220\217\212*\214\2146\222H4\332<]\032\313\253\200\376q:\252\236\203*c\356\203\215\0204:P\260\262]\360z\321h\310<\031\350\334\323\271\202\231\026\347\372<\306\212K\016\025\3470\234\272q\316\315\005\037"
+	.ascii	"{\311'\323\264\0011\354\274\0269\007\r\033\3162\325\346\347\""
+	.ascii	"\254\fc.#\025\b\001\013\031\273\2255\004\302v\230\205F\024-b"
+	.ascii	"\030!\316\363b\\)\213 \0174\206\024>\027\333X\224\005\3205\247"
+	.ascii	"\017\001.j\005qM\233\204I\006"
+	.text
+	.section	.gnu.lto_micros.86.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001\030\376?s(\202\300\020\362 10\303\217\030\344%\bjk\004\0315$\307\314\004\2445\021\237<\370\3059e\203\350w\223\226F\366\2262\245\266L\007\t\006\b\257\272(\300J\365\032\026*\f\317\002\037\336$\231r\270\300WQ\024|Q\334k\247\251\224Q\215\257M\323\2639\311\344\307.m\210\210<v%\250\320\350e\307+\325\302~[\355\330N\267L\337\rL\234\304\263\313\371\230\354\210\003\311\260\215\261#_\343\033\030[-bd\320\007g\323Q\262\033\237\364"
+	.string	"\350\256\035"
+	.string	"\272\323\213[O\313?\307\233H\210\007\226]OJ\301\356:\261L\342\326\333\026\260=\331\246\b\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_millis.87.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\"M/2pM\322\001\030\376\377H\213\034JX\33520\230\001;x\330r\202\332\032AF\r\31113\001iM\304'\017~qN\331 \372\335\244\245\221\275\245L)\266L\007\t\006\b\257\272(\300J\365\032\026*\f\317\002\037\336$\231r\270\300WQ\024|Q\334k\247\251\224Q\215\257M\323\2639\311\344\307.m\210\210<v%\250\320\350e\307+\325\302~\333\335\265vl\247[\246\357\006(>\342\331\225\370\230\254\210\373\310\260\215\261#_\343\033\030[-bd\220\007g\323Q\262\033\237\364"
+	.string	"\350\256\035"
+	.string	"\272\323\213[O\313?\307[\b\b\t\226]OJ\301\356:\261l\342\326\333\026\260=\331\346\004\b"
+	.ascii	"{\311'\323\342\2533\216\206\360\346\232\222\205\310\303]1\265"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getCycleCounter.88.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \373\305\006"
+	.string	"\342\f/3pM\322\001\020_\305zS\227>\007\223,\363w\200\341\201\200-'\250\255\021d\324\220\0343\023\220\326D|\362\340\027\347\224\r\242\337MZ\032\331[\312\224\002\266L\007\t\006\b\257\272(\300J\365\032\026*\f\317\002\037\336$\231r\270\300WQ\024|Q\334+\247\251\224Q\215\257M5ds\222\311\217]\332\020\021y\354JP\241\321\313\216W\252\205\375\266\312\261\235n\231\276\033\300\370\210gW\342c\262\"\356#\3036\306\216|\215o`l\265\330\311\240\216\316\306S\262\033\237\364"
+	.string	"\350\256\035"
+	.string	"\272\323\213[O\313?\307\033\t\210\007\226]OJ\301\356:\261l\342\326\333\026\260=\331\246\b\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_clockCyclesToMicros.89.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\205\007"
+	.string	"\022\21634`o\032\003\024\002\023P\340q0\306i\327\t\214\325Rr\303r.\277J\203\254\353\340\276\300\224\242\336e\035\3460R\r\312\372\022\220\361Y\254\221\266\267\2242\245\237\3133'\020\036&\346\231\233N\216\002C\302\202\324\256\206\254\243\311\b\207\016\204\234\331Gr\254b\022W&5\f\313dw\307C\022\264(\240\250\231\026\327T\031>\350\n\021\321;\265]\350A\215\326\361\220\364\\\262\035\t@\314b\372/N1_\241RB\332\202\332\315si+\300\237q\202\362\277\240Rc\252m=b\022P\267\330qpU\207\207\205\t\314\177iY\2402\025\035P\231\202\033\336\374\266\332%\216/*.#.\344\2279\370\3377\3420\\\350\266\003m\r\332~\004\013"
+	.ascii	"z\345[\243u\314\026\226\013b\270&>L\264\224\036\266\203\245P"
+	.ascii	"\226\005?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_clockCyclesTo10thMicros.90.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"u\007"
+	.string	"R\31634pO\032\003\344c\"j#\022Gblb\303\r)\231\360\033l#\026!\215l$8{\264\375\256\177\313\276\031\3575\256\301\202\356h\211\361\356\377\275\245\224)\005\235\2133+\024\"&\306\231U\247\206\301a\241Aj\327C\266\321\344\004\304FB\316\254#5V1\212+\223\032\206e\262\273\343\241\bZ\026\020\324\272\270*\224\341\203\276\030\201^\251\355>\017r\264\216\377_(z&\331\216\006#\277\304\374\031\245\231\267L)!m=m\365L\332*\360o\254\240\374?\250\f\360\324\266\0361\211\247[\354<8\352C\004\303D\346\277\264L@y\212\036\240<\301\016o~[\355\022G\030\226\223\020\367\361\003H\370\337\027\3424\\\350\266\005m\021\332\202\004\n"
+	.ascii	"z\345[\243u\314\026\226\013bt\031\225\322\033v\260\024\312\262"
+	.ascii	"\340gFS;\237"
+	.text
+	.section	.gnu.lto_clockMicrosToCycles.91.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"U\007"
+	.string	"\262\r24`m\322\001H\241\234SJ\225\277\256s#^\024l\361\035\260\313\t\3255d\255\202E.\204\016\035\215T\215\270\r\302%d\263&\204o6jK6\331r\247\024\034+V\232\315suQ`HX\200W\246!b.\350\240\301l`\0259\360B\331z\310DxYV\204s\357VCJA\350\307\323\311\345\2736}\304\306\247\215\354\351ija\337\255\206\332\263\377\256 \273\311\312\356\304HeK$\021\r\333\035;\240=\223\006\330\255"
+	.string	"\t\331\235\006\206\226K\266}\216\213:\226nb`\357C$\341\221\262;!\365\201w\311]\340]\322\213\3137\351\277\343n\204\004\005\204y\336&\204\335u\003a\024\267\3366\201\355\003\333\031\001\013"
+	.ascii	"z\345S\2435\314\026n\013b\270&>L\264\224\036\266\203\245P\226"
+	.ascii	"\005?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_microsleep.92.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\266\001\275\020"
+	.string	"F\240qF\3200'\035CJ\246\252\354\303\333\030\272\037\306)\336\340\325U\376\366`\317\221\272+s\261\2438W\322\247\036:\266\301`O\037\222\361C\321WcE\330xr\313\370\004\006\244\001\242\032\203\263\320\374\354\320\337{K\231R]"
+	.string	"W"
+	.string	"_"
+	.ascii	"{+\340\216\3430\344\001\342\341;H<4\314\226\361\033\316\236("
+	.ascii	"(\346\207\306\356v\312\301\232\260\303\3704a~bX\3121\r\321b\207"
+	.ascii	"\037#h\036a\362=\305\001\255X\321^\336\001\036\023\035T4\227"
+	.ascii	"\324\347>\240\304\222\214i\210F\363\334H\260\273\316\031\355"
+	.ascii	"\302\275q\333\024l\217\330\217\n\366-\226j\263?\362\002\311\203"
+	.ascii	"\265f\277\347\367\200\351\030"
+	.string	"\323\020\246\337K\253\246S\323_9\250\221\261\t\"\001\332\225\231\212\332$\230\"\304q\277\375\347\254\262o\367\201\035\307\362\205\231\351 \312\021r\332\235!ph\003\034\207\337\217\247\375\235\363\300\336S\301\035\2737:F\033P\"d\032\273*\305\300\r=\265Y\344OS'\007\303%kx\225G\361\034\213cf\237\240\344gOW\0314$\275h,\337\356\256\252Mm\b\317\245\344\317\354)U\3651R\033M7R\274\246\036\206\204,\247\354\241W\222\026.b\244\256\022\355\326s*\332\264\273#\002@\340\330\354\314h\311\251+\2574a\255Lx6\021Y\320@\001\203\356\305:q\225\274\272\b(%)\235\211k\245\023\tqK\002\313\325\275Z-W\247\272\355\265fx\302\b\312\251Eefy\2737\b\234p9Pm\376UhC\215E\324\232\337}\024\243\202\370<)\371E/\037}\360\255\"\036F\205E\026j"
+	.string	"\244\375\240$~\006U\205\023\037"
+	.ascii	"{\311\027\323\360R=\340\273\266va\f\013k\n\346\241\220\202\213"
+	.ascii	"S\003f!\t\026\343lu\031D\272a\327\210\b\263a\023a\210K\030\267"
+	.ascii	"\212A\317\313E\253E4H\351\251pp/\234\242\022\334\033\267?\020"
+	.ascii	"D\204A\007\315^\355|\002"
+	.text
+	.section	.gnu.lto_delayMicroseconds.93.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"5\t"
+	.string	"v\322@90\345(\035\200\213/\030^\017\026B\\\347\204\215\211]\344\260@\374X\2066@\360\254\366\343\022\320\226K\316\370\273\036\340\034\020\332\022\031V}\312\313e\366\320\366\311\336R\246\024."
+	.string	"/"
+	.string	"/"
+	.string	"\027\310\016\337\003\262Co\266\314;\216=JJE\t\200\335\215\272\361\355\271\371\0279\207c\241\236\032\203\335ur\254\213[o{\300v\201}\007\332\262\357\372\241\246_\2465\323\231\351o\bX\016\023\263k\021\013\2600\270\342\321\261\375\264\017\362\220\355\256\tsv3N^\273\335\307qs\350\t\252O?\253\227\324\253\352W-\252\217\234\304*~\207%\374\312s\207\276_\331a*\007\003\352u\301\305d5\223\312\230\335\241R5\354\277\335]\007\245SZ\004BP8H\210\246Q\203\0262E\b\207\320C\024i\245\b\362\230\0241\322\242\211D\322b\247\333\277\325\226\031>`)UY\223O\355\322)\317\331C\241(\007\f"
+	.ascii	"{\311'c\232\200\032\006\316\0360\224T\346\300\264\253\300\200"
+	.ascii	"K\b\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.94.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"%\007"
+	.string	"\362M25`O\322\001\024\022\202\213\001G\210\035\034\222\236\241\036\255\326\240`]l5\020\201_\307\222\004\243\202\264\246\342\0228\224\240\261\026]\260\362\2616\212\237\354\275eJ\001\242\211,\310\243\300\220\260\020\255\220C\365\261b\304\303\007\"\202*Q\364tJI\204\252hQT\0259\332\375\356Hm \331.\034F_\246k)*\322Y\323ed\313pX\253a\351<Z\277\377\257#\265.\331\371\n`\034\323\362o\324\320|\203,\"\234\266\316\326%6\271\\\262\350\346\357PY\3715\203\306"
+	.string	"\303\216\007&\303g\201\311\260W+c\r\344Ny\321@\231\371\037\335\207/\347U\373\304\233l\2049\001\020\3767\263\021\207\353\334\226\240\355A\333\220\t"
+	.string	"{\311'c\032\366\f\217\263\256`\336%"
+	.ascii	"b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delay.95.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\020\001\375\f"
+	.string	"\346\030YB\020\221\232\016\363e06\016\t\\\\\200\303\013\242\3574\355\227e\016\206p\213\t\304\b\3648\235}C\373\246\377>\254\305c\261(\3603\242\354a\266\262\t\257A\300\b(\300V{\330N\033i{K\231RE"
+	.string	"E"
+	.string	"C"
+	.string	"\357V\366//B.2v\327R\017\206\231=B\315\314\317\230\030\033\367y\204\024\350\004\304\006\007\202\0363$\230\217\236\0318-\341\b\224\353G\207$b\274\215CyR\tv\327\271q\033\356\351\266#\330F`?$\020J\273'%\032\373E\230\020\027\375\366?\362\306\356~\"\273\b\303\327DC\025z\221!\355v\005\036}@\363\350N\363\264\317r\023\331[F\\\355v\370\240b\2673`K\363\310\361\001\323#\274\200\351\321\231\r#,>\r\356\356\302*)\231\217Lv\247B~s"
+	.string	"\317\373J\024\205\007\342\324S\332\026.\3447J\tpX\361i\372\261\273O\252\212}\217\225\031\2225\305~\313_]tS\232VM\247\246\277\0010\203\245D\330\305\301<\321#\222\376\350`\340`A\003\013\003\221pq0kB\bG\304\372\270<V\007\207;\024@.\013\353t.k\323\3555\305\017Z|$\252EUQ\005.Jr\306\225\252\302\024\241\032$Y2\245\327Tu1\021\241e\351\272\341\005\026"
+	.string	"{\311'\323\260\316&9\253H\236\016n"
+	.ascii	"&\263o\t\333\200,\222j\254(/\211Z\255[\002\321p\245\247\314A"
+	.ascii	"\273p\352\225@\\\334R\245j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_timeval_sub.96.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\263\003}\030"
+	.string	"v\255\233G\260\230M:\30012\364t\375\312q\276\0239Gf\347y\007\270gY\353\367X\377\350\321\217\354\224\205\213\346\372\007\"\330\373\234-2\375\354pq\035\037/o\254Okhy\320\367\3543t\223\0036\214XBH\222)\005\212"
+	.string	"t"
+	.string	"\211"
+	.string	"}A\335\310p\261\210[QE\251\201\235n\302\240\242Pj\312J\223\030w\006\374uA\210\003(@,\342\232L(\270A%\201\263\365\222\231l\336\001\031&F$\251\0361\356\016t\026\372\353.l[\327\260\r[k\345\355P\030y\005\025]\216(1\306\231\3144\240?\3172\240\277\237\260\315\336\323V\267\030xWI\200\f\031\005\331;\362aF8O\026ct\224\223\310\350\226\331b\020cl\016\031\215p?\267}\320vB\353\301\002A\371\244\326^<R\353em\274\263\005x\312\2551\016;\200o\330"
+	.string	"\354\344\322\030\312\235\001\2632\231\215\311,Lfc\231}\311,,\263.\231m\311\354+\263,\231u}\331\320\313\266\236\005\237\3752\353e\366\231\315\314\232\200c0iRq\241H\214\"\262\252D#\237\217\027\236\262\235l(\277uk\251\232\252\257\251Z=\265\b\321$\306\b!\264\255~rT\316)\315\274\345\037\022\335\025\226\273\376\272\227#\247t\013\262\303\362\002\032\374c\207\202\353\216r\001(O3\274\326\303\273V`\315[w\021\026\217\034\f\3605\367\022\335\025!\377\200\337\301;W\302\373\367\326\020\335\225_)9\212\246\201\277\367\357I\216\306-\263\352\347\177S\371+\302z\312)\3352\306\030\364'5\357ch\272\302\345\224*\ty"
+	.string	"I\312\301<h\t\352\035\024<\2041F\263"
+	.string	"\002\375\371O\312\222\262$\224Y\355.9:=<^\353\247V\303\311\271\320\303\023\376\030\204}6|\350\321\251\201\315A\020\301\202\203\n3\037\235\f5\034\237\031\217\006\034\016\263\234Z\317\f\201\254\264\016:\265\231\017\215V\233\275v\321Gj\025\211\207\256\024LD\322GLs\"S\331\225T\345\"\005\323\216\254o\300\231\023\265\265\271L\350\267\312\334\346\2169\314e\236Ot2\214\304|"
+	.string	"\021\230\377\207\216\031K\261_\321\226\f9y9\3541\232\277\374\263\002\273\217\260\262\\.d\347\201\007\027,$CNZ\376\272\313\003E\250Q,\346\0302\206\261\022Q\234\2024\215\001\220\242\221+\363\021\240\235T\314D\nKm\354{\356/A\210\032\3101_\337\227Jb\206\221M\263\237\234\321\3254\003\232\274\364\234\222]\371\007\374\206c@\0237+,\246:)\303\322j\226+\217\313/HNO\\\346\245N\274\031\035\177\002(J\300\236\373%\207\241F\210\220R\367n\005I\215I\342l\325}\334\032\255\375\243&\233\331\347Eg\341\370%\261S6\"?o"
+	.string	"\021\230\306v\363^\277\233\254"
+	.ascii	"Zg\223JE\333KZ\267%\370\017"
+	.text
+	.section	.gnu.lto_motorDevInit.103.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`=\002\375\023"
+	.string	"f$\203J\260\022R:r\245\262t|\211\216\233.JIZ\357n\377\030D\250\037\313\036\261\033\331\017s\366\253\220My\320\307V\262n\376\365\372\337\352G\355J\371a\3005\3658\330k\324\201,^~\340w\322\256\342\254\205X\262\211\334)\005l"
+	.string	"i"
+	.string	"m"
+	.ascii	"J\265"
+	.string	"\376\022\270$O\375{\201\361\224<\201\361\3249[\307\177$\352\223\200n\216\260j\255\345\2160y\361w\2133\367\221\212;s\376\321\247\007\0332\037\305-\002>5\020\002*\361\342\351&\025[:;7\002\360l\304\023\036;>\344\360j\246\210\202\347{\341\247S\224nJ\310\343\371l9\250\265z\356x\035\356\326m\327\330\256`\317\224\336\236\355\272\321O\276\350\247\017\336\273\323\223N\037\300+\005\221\017\251\240\013\260V\016C!\225\006e:\361\340\355#\371B\277|\340[\344\036t\023)\263C\002\223\206\252j\255$\247N!OG\304\277l\005&\271\033e\270H\325I\231\200\260\277\023\345^\244a\212T\032\035\016\003\362Td~\332\017\272P\356C\033>\240\326\236\214\337\315\261m\362n\032w\347\025\013*\232\031\344b\255\265\212\b\276\353\332\321)\007\020\233\036\335\034\372\217\215\366\312\231b\006\026\330\216\371R\213"
+	.ascii	"\034\265\326\223\027W\222\371>\247v\231\315\204?\200\024\205"
+	.ascii	"e53\207\342\376\354\256"
+	.string	"j\354\372\326w\361\244\232\357c\f\267\371\335m\327\203\356w\257\240tS\300!3sh\377d\346\372\226~\340\200\b11\026\032\n\216\006\343\212\335^`$\304^Xd*\256\026\231\005Z\355\201\255\206\253\315^^)\211@\001eB\211\213\265\330`\270\222&\203\315\312\025\333\255,\031q\355B\314V\342j5[\371\372\325o\3174\206\210\254\252\231\325\3710\356;\375)\246\002\203\215\247?\372\374Q\321\353\t\262\n1\256\017\212f\0061\271s[3n\026\250\223\265D\327g\223\025\353\332\245\232$\0011 `\0022\210\316\003~\214\225\362\330\221d\264\255`2\342\021\344\n\255\257\231\322\223\teP\021\003\334\226Q\331\305\244]Xp\023\301\201\241\224C^\336\273\371 \306=j\033\307\256g\206\211\330\340\307\r\017iQh\025R\026\271\023=\355\366\313por.A\260\b\237u\264\227\245u\364\336\213\246\200\267"
+	.ascii	"\276\004\213\n\023\335\366\205)\277\256\365\004"
+	.text
+	.section	.gnu.lto_servoDevInit.104.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`C\001\265\016"
+	.string	"6\233cF\360\262&\035\262B\351Ky\006\351D\n!i9\224U7k<\334\363\024\262\363F)\007\214\364\177\204M\2406\210n\020x-\3300<hN^\303\306L\303\312[\304\247/\030R7fqK}\343\020K6\2212\245N"
+	.string	"M"
+	.string	"N"
+	.string	"\306q\020g\317\343\302\303\216lw;\025a\356\032xk\211z\3244Q\276\316\023\204\317+\214\255\\\036\265\220\fM\r"
+	.ascii	"\253\016\332\b(G\210\230\225*5\0235\327\273\2363BU\030[\325<"
+	.ascii	"C\016v\327"
+	.string	"\t\263\372po\267\255b{\304~K\232~h\302\211\031\033\231\205pwf\346ciD\031%\336\272}\320wYd\005\013Po\261p\233\023\212\361\274\370\331\005\021<\272\001\367x\221\355\247\375\024W\201\372\212\r\017\260{\323\003c\027L\340\216{4\370\001\333#w\001\333\243Q\016><^lT9\363\357mv\312a\036\001\006\266[\336\002C\210\215\335\035\261\370\216\311'\361\350\f+y\230G\177e{4\200\243#\2253\247^\357\372\001\024\341+\204\375H\345L\025&\023\024C\225e\203.9\002z\311\261\336\330o\265\356\f\032H\024J$ '(\025J\336\003O\345#\231D6\021\201 \201$Bw\"\235|%\247\256\204R\222\322\231|\246N\244\200\275\013\244\257;y\336\327\211\300\275\316Gzh\202~R\252\212\312rHL7\215#\3221\271\343u\203C\366\270\266\273\253)\353,[\352\246\227\005\034"
+	.ascii	"\200X{\311\027\323\020\232\253\266v\211\205\274\214\276\253q"
+	.ascii	"\322\022\013\364x\035\306\021\033s`\232\002\233\006aZ\202v[\342"
+	.ascii	"sX\341tq\306\305hV\247\203vqXD\331\253\253f\364\f/(\312\257k"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_pwmGetMotors.105.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \370\305\006"
+	.string	"\262\f/4Pm\222\016$\243nM\201\b\210\2115\310\272\252\272[kn\370\374\213ek\377\25756}7\322\330w\206QS *\254\364\340\271(\2742\263\243\211%D\246s\250\204\005\004\005xu\030\254\315\005\037\0326\016\220cE@Js\005\321\261\340UU\026\314\304\254#\275\b\206\311\f5\273!\215\022w\243\357\t\2545\353\273\330\324\247\t9\212\217\240\3460\276\227t\244o\006'M)eZ\264\260$\312+\341\370=\237\271\036\375\360\374!\210\032\243"
+	.string	"\022\223\212\221\225\314\b\217\035\230\3720\025\230\372\\F?m\237[\220^:J*\231\b\324\006p\220\231\267L4\352\256\177\301O\375\027\001\t"
+	.ascii	"{\311'\323\342\255\243c\205P\\\023\253\021B\013\221\211\273b"
+	.ascii	"j'\031"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.106.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \360}\006"
+	.string	"\342\313,3`M\323\001"
+	.string	"\327\035\311c\343;\360futF\253\252\217\246a\300\217\025\2024\342\017k\353ta\020\021\214q0\016\002b\316\013a\ni\301\222m\367N)\206\346@\201"
+	.string	"\001\235\"\203\372L4\341\340A\240P]\2403cI!\252t\222\244J\235n\0377)\002\241b\202\305\006\377T\343s\274\203\3621\314P\301g\227~\325\\N\r\212\t\016\005\203\237\335]0V\330\267l\334\354\b\275\017\356'%\273\017\337\312\222\310\220\f\333wl\331\336\273\213=\310\210\203G\312\356\322hq\353\320\362\277qL\246]\207\227\200\3355\314\264\210;\3366\200\355i[\"\t"
+	.string	"{\3117c\261\2003\202\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmAreMotorsEnabled.107.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \353m\006"
+	.string	"\342K,3Pm\222\016$\201\"\340\2120\2431\273u\024\001\276\265\346\202\177Kv\325\376\335\016\363\246\340F\032\373\3160j\nD$\212\351\301sfpv`\263{\313\024o\246\204\005\004\205fq\030*\215\325\036\0324\016mSE\264)3\005\301\251\232EQU\303dY\034\035f@8\361\005i\310u7\226\350\\\261J\267\003P\351P\340\002t-\237}\0161\276\227\304\321\177\037\022\240\264\204%3\324\262\222$\322H\307\357y\314\005\006\236\257f\032\241r\234P\210\250df\r3z\365\256\333\217^<RL0\321\247\027p\220\231\037&\262\350\330\177\340\237\376\212\t"
+	.ascii	"{\311'\323\342\2543b\206P\\\023\377\"\360\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.108.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \315\305\005"
+	.string	"\304\tl"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\374\266#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\357\255\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307o\361\370\240\337\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\n"
+	.ascii	"{\311'\323\"\030>*lV\001\271\206\347E\f&D\016w\356\325\316'"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.109.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"%\013"
+	.string	"\306\226N= O\225\016hDM\007\201bJ)t\320\362\225\002\263\270H\245x\r\207Dv\030\244\364\350\343\324\271\266\264\322\324\0350D\301\231o4\007\2009\305\\\004\251\251\001\241\243\221\240M\244L):"
+	.string	":"
+	.string	"<"
+	.string	"\320\231v\001JwT\005\353n\006\224j\367\2238f\207\356l\026\377L{\023\033\243\324\213\335\215\272\341\335\263\363\017\342\017\217\364yb\bv\327\351\221.\334z\333\004l\037\260\277 \317\376\375\330\225\206\231\2764\255\232\316+}"
+	.string	"\022\3263R\273\026Z\033\273\202(8\330>\304\266\246}\017\377\320\375\363\t?vS\250P\355\256\304\224\3540\362\001\216\303\353\002\034\017\333\346\271P\205\232\032\242\025\231^z\215\021+\025S\325\213:\204\262\345k\352E-\036\342\"4\376\311\233N\336;\364;\216\303+\226\301\202\201\001\224-\373\373\244j\260\177\255\226\354\243\036ZGB\305\003)h\0172\027h\313DA\203\004\f\"G\203\300U81s\251`\242\205\333\304I\304\333\004\215\213\234m\343\"\344\333k\311\016b\254@\0322T\333\236\227\320\0040\355\256\001\177\304ID\360O\207\306\004\017"
+	.ascii	"{\311'c1\347\315(.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\\\310\215g\026\020*\314\001wy\321N2"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.110.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"}\007"
+	.string	"\202\21645Po\322\001\240\234.\212\rQ\277T,\374\317\n\307C\254\017\247\346\026\332\016k\221\355{\366\031\334\256\330\333]\231"
+	.string	"n\f05\023\302WU:\017\353\335\266L)\362c\301\205\b%\364\f\230S5<08<\331\201\210\033\371>\021\033\317\343\304\211W\021\030Jt\342\223\020\306\247\231{\314\266\222[\001qQ\0215\013\373V\306\027\371\264\374\016S\200\364\330\235\017\312\334U\231\211\224\261\2104e\317\220\266\r\373\230m%\273)\312${\313i7#\365\262(\256\344\303\3665\266U\355\003\204\353Y\205\333.\351\204dw\032\370\005\334\371\262S>M\373\021\214\213\023jw_\343\370u\275\374\207\\"
+	.string	"\033\205\256"
+	.string	"\n\273k\305F\032w\273\355\002\333\t\266=\002\t"
+	.ascii	"{\3117cZ\366\206#a\032t!\327\016v\250\324dp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.111.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\332\003m\027"
+	.string	"V\252\221E\300\332(\035\340@r\354R\032\037$\200\203\362%\b]F\370a\n\204\256\001\325\263\344\233\265C&\305\177O\004\262a\224\250\325\256O\313\2002HY\017\321\"\\A\3356l\016j\366\021\321\376\267\222\2777\221R\246}"
+	.string	"p"
+	.string	"\203"
+	.string	"\252?7\351\020%2\323\361Q\264o1\004$\201QcLw+P\371\b\243\006\230*A]\315\335\277\201\203\231\nYq\356\276\341\004J\367\310\340!\250\362\263?\214\216;Zu/x\216\230\351\356\220u\350L\247\374xg\327R\216\246\023\244\241\362;\320\203\243(\225c\361\261\202\206xn\373\315PN\345l\037\253\273\365G\267Engw$\241\273\277\270\234\f\375H\377\303\376O\370\277\004\001\354\263\335Mc\356\271\212\251\034\302\b\030\333\236yiY\255:\363\027M\254\342\224\365G\325\205\020\220!\033\323\376\221\266\354\363\353\327\334\363\253\020U"
+	.ascii	":\352W\273W\315\375\215\334\333\310}\315\267O\315=J\356Oro\372"
+	.ascii	"\366\245\271'"
+	.string	"\311=(\367\243o?\347^\312\375'\367\374\355\227\367j\300\024\306\306\227\024b\272a\364\320\364\220\334\375\320Q\365\017Z\204RL\342\001\005\331\241\030K\320\225\023\243L|*\261\211\212Z\251\262z\240\251\262TD\342)Rv \223F\fN\0361P(\272\311$\336\224 ;\311\377q\324\311u\003\210\336A\233x@\021u\367\203%\312\344\003\b\227k\252\344,82\037KV\2364+f\376XoWv\266\367ef\tt\033S\333\336\002U\362\002\273\033\302\025\211&\201]{\250\274\210\034y\315\231*\227I<]\321\256\266\275/\260\021\256WK\206B\004e$P\210\024b\242L\324)\375\205sAC\205V(\203\211\210\271d!\211\034\227N\370\212\235\bqX\027K\300b\241L\024c\241il\375TB\215w\346\013\354_\301\302*\356\3144=\223\243\247D\262\317\225G\231'\2542Q\306\307>\212\2369"
+	.ascii	"[w\r\301\212[(P\025\201\325\"J\324\002\273k\212\273zQ\036\206"
+	.ascii	"\f\255U\\k\003\207U\234\212OBA7\334\205\313\026\033\276\251a"
+	.ascii	"\233\024\327\004K\250Q@\244\221\021\020\t\211\004\023FA\f-\006"
+	.ascii	"\300\002\221\031\263\035\021\340HG\230\311`t\317;A\262\005\227"
+	.ascii	"\220\237%\030lBDV\303o\227\222\276\300e\230\020\271\245\275\236"
+	.ascii	"\336oM\341Q\t\366\304\231\301\034M\276\215\327J\021^\324\343"
+	.ascii	"\335Bj\220h\033A9)YID\265\372A\260&Mk$R\242\220\254UK\363T\204"
+	.ascii	":\253D?E!\002\027\230)\216\333,_aj\220M7\2744\207>\304\225\031"
+	.ascii	"\351\370\023/\2022u\334}\254\355\254\217;-\321\202\334\004\032"
+	.ascii	"}X\261\b\177E\201\376\355\240j"
+	.text
+	.section	.gnu.lto_pwmWriteServo.112.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\315\t"
+	.string	"\326\323E<0\345(\035\036\360\227\333\335\221\207C\202\340\377\304\026 \346B\265\313\331B\212v\300t\317Z<\013\260\037:(}\024\233i\220$B\321\034Y\317k\007\255'\262Q\370\266\277\311\226)\0052"
+	.string	"3"
+	.string	"3"
+	.string	"\032\216\273\037`l7\374xn.\355\3310\017]{\030\311\352\025`wg\f\271w\365\374\237\234\363\261RW\315\302\356Z?\226\307\035o\333\300v\202}N\252\352k&\370\227\327n\307\214\300\312\244\312\210\355wlG\265_r\023\357\241a\346\354\256\260\304v\367\343\320\346\322\363\202\314\245v\202\314\245U\355\203\220w0\273\b>\312S,|\221K\233P\372\357\322Ge.\377\305hQ\243\002\340h\211\361Qa\200\313\252\200Jgv\230\322\bb_\333\330\262\037\376\332\301?j\352\033jBt!1\266\210\022Iz\004jx`p\230\247M\242\023\235f\211$\242\230\243\3164A\036s\025[7O\034\327\315N\270\3276\266\f!@\246\212\033\326h;\343/n\300\265\001\013"
+	.ascii	"{\311'c\272\201\032\036\234\301\027\343`\332\345\032.\230\205"
+	.ascii	"\202Pa\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_IOConfigGPIO.113.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\035\007"
+	.string	"\342M14`m\322\001@c\003P\302\240l\335=e\315.0e\022$v\020bP\233\314\221\200\235_\257[J\223X\017\241{\317\320eX9\320-L\267&M\356\224\002\241\205\n-Qk\305AP8HH\f\024\272>X6\210>\fY]\017\311\331\324r"
+	.string	"]\211Y\326\225\232w[\216Y7\0228\321\276QC\214\326\226\377/fmK\022\237N\177\305\212\312O(\023\216\266\326\264\305\326v<\316\017\242\370_\230:n\255=\374\341\f\022\341\200?\353(\371_A3c\252\317\003\027S\031\013\\L\325\265(~\032\267)\204b$\345\177b\206\235\233\253-b"
+	.string	"Ri\344\2061\370\337F*Y\270\350\266\004m=m7\002\n"
+	.ascii	"{\311'c:\366\f\343\354\241k<T\030\f\346\006\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_adcGetChannel.114.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375 \373\355\006"
+	.string	"\362L05@O\223\016`b\034\327\363\314`a\251\216\"\310\232\006\2465\221W8\341`\337\270\335\336j\006\216[O\"\300\272\201\351\017\016\333\360\323\037\240R\372o\355'D\246\020\326uQ\016U\346\252\243\300\220\260\0205\253!\243\264x=P\021\261\312&b\2073&aeQ\303\260,n\272,7q*\240\305w\236\007=\276\230\204\035\377\"K]B\231\030#Q\266H+!\377\366\233\037\276/0\330ZB1\314\344@Q\311\354\b\216\232J\377\035)\3116\367:\220\214)%tq\362\222\331E\200\nL\225^\003\246J\360\243\\\037wkR\214\210h\364\001y\3722\b\231\371\373\2004:\354?\360\037\374\033\001\t"
+	.ascii	"{\311'\323\"\030>*\354U\001\271\206#\230`\211\2510\246k\222\001"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.119.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"m\f"
+	.string	"6\026UD"
+	.string	"\2216\035;\353<t\220\274\372\277.\346\362\273\354\013\354&\323\355\255\251~\032j\"\021T P\023\2032\003M\035%\001e&[ BF\304r-j\023\370_c\2026>p/\260\314}\377\357F\244L)A"
+	.string	"<"
+	.string	"C"
+	.string	"\237\201sz\221\263\273QK\334t\253\3224\371\237\257\273\345yy\2450:jh\304\370^\256U\201S\017\024\002\276\226\312@Ng\363\025O\017\037Kfg\264\273N\357\023q_\267\035\3016\004\373\t\002*>\312\035R\362\336-?\345\272u=\221B\305\320\214X\311\320\006\273T\022\3665\f\303\320*c?\235O\277s\300\2031\363\0342vA\204<\366\306\262Ia\373 \233l\033\007MlV\200\264GHT\273\327H\341\270Q\001\310T\354\003.\005\377\314]l\277\211A\355\272\334\323\340q\211\bn\331(\033\362\236\261\223v-8\244\022H\251H\030\360C\b\265\312u\265P\203\323\222;\354\323\234E\376dY\310\003lA\b\273\360Q\262q'\232\206Q !m\031LB*4"
+	.string	"a\220}L\b\231$\312$8"
+	.string	"\211%\r\003'R\212&#\"%\221\304\241D\021\346\355D\343bi\333\270\b\002\367*\343\321\212\262\274\332\335\r\026"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\331\026\256\200"
+	.ascii	"&@\\\257\206\006+$\342\222\215xJ&|\273\214\3622\304\270t7\233"
+	.ascii	"\226\n\211\242VA\001"
+	.text
+	.section	.gnu.lto_FLASH_Lock.120.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\227\001%\020"
+	.string	"\026]kH\340\260*\035X\353\231\202\344\217z\232G\247\007\334To\"\314u$\374\353<k\316\024*\365E5\311\264\215\215#1X\002\205$L\305\333\216\216H}\276\004-\253\0160\314wY\200Pr\241\177a7\306\266H6\221;\245V"
+	.string	"Q"
+	.string	"V"
+	.ascii	"\276\333s\364\250\025D\017\217\312\243;(l\037\344\227\215\343"
+	.ascii	"8\232z@\305\t\227\034O\255U\\\023\177\235\202;_\376o\016\240"
+	.ascii	"\234\221\247\037\332A\220\031\355\013\022\260\351z\002f1\260"
+	.ascii	"A\317F\304o>_f-s~<\250\265z\226\263\020wx\333\024l\233\354\327"
+	.ascii	"\b1#\302\311\340\276w\341\327\336\320a\276t\210\016\215\367\363"
+	.ascii	"\311\226\234=\033\233\214\335\031\237%\374\232\344\334\210\315"
+	.ascii	"\035\366q\336\202\305\257\261\207\225\371\362\324_\tO\277\264"
+	.ascii	"DnE\fN\r6{l\0349w\306>XW\306\3764\370\351\375\364C\024\274\004"
+	.ascii	"\037\331\210\350\364\267\357X\220\275\274\360\221\211\242S\233"
+	.ascii	"\244\004\206\304\317\367aI\337\305c\230j;\036\035\003&\270\366"
+	.ascii	"\t\025[R\347\240\266c\021`\356\316Zo\032\341\177\022\376v\030"
+	.ascii	"\253\0024\265\302^\372:\177\241\362kN\215\262Z\205\247\366\250"
+	.ascii	"!\344\262d\316\356s\267NQ\231\214V#K%\225\002\031D\324Z \neH"
+	.ascii	"q8\265B%(\250\221\204!B\t\002I\204\004\201Q#\222i\244$\272R'"
+	.ascii	"\254\223KLQ\235V\"\212\325\022G!\217*)\226\350\032G\226\b\302"
+	.ascii	"\325\257\214E`x?\037l[h\202iK\230\260\267\351z)@\003\363\267"
+	.ascii	"\317(\215lT\b\" P\2021u\311\003{\362\211-n\233\301\204\203k/"
+	.ascii	"\240\313\320\272\347JD\344\330/\t\230UH\216\02307?\210EP\315"
+	.ascii	"\235\020\034\027\264h$a\255\374\362\210\277\022\201m\363F\274"
+	.ascii	"\271b9\243\317\205n\270\325\t\377\030w\226n\321N\033I\215\026"
+	.ascii	"B\001"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.121.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"e\007"
+	.string	"\342\21536Po\322\001 \371j\254]Z1}}\200\025m\303TM+\372\341\\m\033\202{H\226\301\006\013\244e\265\334\004l[\0045TS\231`\326\333\2445B\366\336)\005YvI\217'!\342\372X\016"
+	.string	"\356p\032 \030\036T\273>\322\322\224B\302\232\320\216\314\224S\031\253\270\244j\030&u3\367v<GU!(\262'\350\301\016\373q!\311~\261t\362\026\227]\215\030\230e\231R>lo\366\306\366{\366E>\262}Z<`\227\244\202\262;\013\254\232O\236\032\333>\310C6s\013\027\241\316\240d\202Q\362\262;\265\372"
+	.string	"\365)^\200\372\004=\316\375q\376I\256 \312X\031u\240\277\f\302\356\372\215\272\215\033\3366\201\355\003\333\034\001\n"
+	.ascii	"{\311'\323\"\030\366\250\240\\\303\241X\214\016L\020p\302H\265"
+	.ascii	"b\022&\031"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.122.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\270\001%\021"
+	.string	"\366\240uG\320\224M:i\031t\244\211>\030$K\033\336\273\321\210\222\234\207\f\210&\nk\240\324\204\277\003\037[\321\266\225T\242M\340i\005\355\267\001\256A\204\267V7V\346\b\372\2354\332\033\001\376\352\260@\315\255\221M\266L)_"
+	.string	"Z"
+	.string	"b"
+	.ascii	"\237\026Q\266}\242\263\310\361\213E\026\013UV \365\034\031\331"
+	.ascii	"\0259\325O\266O\355\004\266Oi\342\257oS\223\372\362?;\004\035"
+	.ascii	"\037!`\b\373\226\n\201>Q@\327LBYI\270\243R;\371A\001\232\204"
+	.ascii	"2M\301\220\032E>\273v\buTO\016v\327\n\206 \356\323m\317\330\206"
+	.ascii	"\261\017$\323\031Zz\360\323om\237\227\247%\017cOSLG[\204\251"
+	.ascii	"\024\262/\307q\034-\203\354\027\375\250\213\3776\325SS\253\246"
+	.ascii	"~jED\020\003G\273?c\222U\2326R\330\316\261KlK}\321\006\003\330"
+	.ascii	"%q\204\201\252\375\026w\221s\221\303\005\354\006\345H\332\025"
+	.ascii	"\027\230C\005\r\022|\332]\214J&a\336\344\224\247\022>=,?\370"
+	.ascii	"hZ\232\001\024%7i\263h\364\240\247\204\331DB\300Fh*\365\307\214"
+	.ascii	"\007\215\0137\032\212\361\0315Gb\332]\225O\031\272{\353\330>"
+	.ascii	"Un7\2568d?*\244\024\362&/-\314v\354(\022\3730Z\007\230vc\007"
+	.ascii	"\375\243\277\360\374\023\017N!X\261l\272O5\343\251\\8\236\352"
+	.ascii	"\006\345E\346\363(\324t\037\313\373$\300\260\270<hY\251\200\262"
+	.ascii	"\302\301\320i\230\237\214L\2479&\245eB\004\027\316\265b}\235"
+	.ascii	"\213\263\241\351j\270\230\257\305\245\250\354\335\254>\316\345"
+	.ascii	"y\037W\"\356\265\225A\332_\333\225\226\210\224bRG\333\335\335"
+	.ascii	"\006\350\2247z\322K\201\241]\236\2030(\236  \240\002\0312\365"
+	.ascii	"\273\363\3112\375\036\303\203,\325\312\004e\234\307;\006\203"
+	.ascii	"\b\267}\301Q\032\212\317\2078\253\230}\026\013!?a\017\213\370"
+	.ascii	"|\330i\317\006\023dB\226\215\020\030\376\273\202\240AR\322\317"
+	.ascii	"\325\265\206\264\334\250\266\006\n"
+	.text
+	.section	.gnu.lto_uartPinConfigure.123.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\265\b"
+	.string	"F\020>;0\3456\035\2003\226E8\372H\267)\004q`\235\213\241uVK\332\366 \360\036f\252\324"
+	.string	"\355\352S\232\266\315V\242\330U~\3603\270\306\031\003\205b\350\034\317\315\220\270wJ\001)"
+	.string	"-"
+	.string	"-"
+	.string	"\267\f\3324\257\247M@Y\201\270\324\354\356\224&\007\037A\377,\037\bK\243G\001\317\356:\206%\222[\336\366\202\355\t\333\250\322dK\202\224\220\322E^vG\002"
+	.string	"\330\224\025s\262\261\375h\037u\025\360+\034\347\354\232V0\273\325\301\023\273\345z\204\353\026\366\203+{i2\246\232IuH\017_\361\365-_\301i\227\3640\003#y\030n\331\032\033\361\241\033T2\251\0179\262\353(\312\022\373\001\273\273\016\326\350\347\321\354\343\204\266\n\256{\3406\t\213l\243\332Gd`P'\202\002\3423=-D3or[v1A\024cv\024\334\2114:\275\256\243sS\003\n"
+	.ascii	"\305,c/Idlc\360\270\300\205-0\344\022l\263\232\002\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_spektrumBind.124.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\225\b"
+	.string	"6\220=9@\217\322\001\230N\236w\006\305\201\342\216X7\233\270\023\272v\272\357\264\267\n5\310\201\206\222K\033}\244\2664\343\246^/BR\334-\243\t\\\260\347\360\002\251$v\357\224\002)"
+	.string	"-"
+	.string	"."
+	.string	"\307\f\332\256W\324\"\244\270DXdvw\312\223\203\217\240\377\325\003B\023\351\021\340aw\035CS\311-o[\301\266\204\355T\362dK\001U\213\351#\257]\222\327\314\262\260\027\224\215\355G\373\251\253\200Wy\274`\367\264r\331\255\r\236\3321\327\037d\307\264\033d\001\232\225'k\255\030\326\207\004q\026_\2772\"@\355\226\036jh%\207\205c6GG|h\206\026\f+D\222\354J\212\322\304\276fw\327\001\276\3508\b\320\210~\031[H4\360\3410:/b\203j\366p(,&*\346\267}h\347\233\035\327\001M\017\025MN\202\275\320F\347\347ytn\352>\t"
+	.string	"{\311'c\032\370\f\007\316B\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sitlLatencyInit.125.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\213\0025\025"
+	.string	"f\247\214K\300\322Q:p\244\004\tu\253Om\250\377\337((WXs\360\273\230\372\261,\332\363\246\252pnW\016\305\257\231\225\310 \332\243[S\220\324\006\f"
+	.string	"\033Xe\246zw\360\241\2251u\016\310s\241\004zP\263\032i\204\020\271\223\fv"
+	.string	"o"
+	.string	"x"
+	.ascii	"\007^w\277\342,l\017\262y\200n\036RRw\212\262\345\370p\323\223"
+	.ascii	"\210\017\307\217\210\017\327\266\313\343\251O\013@\021"
+	.string	"\004\247\305\217\356.\331\304m\027C\220\253m\037\202\336.\216:\017E\236\035\242\023\3259\b\226!\216~D\320\016\340\252\207\n%\022\315U\006\t\354\212\226D\320\033p\244\t\210\347\276\327\017\250\256\326\324Jwo=Q\021\337\324w\367\265\273\260\335\372\023\365'\311\234\352\030\301\224\343\333\216u\365\275!\236<\305\273\033h\365\347\336\367\020\027%\236\240\236t|\333Mo\225{v\317\277\337\357\267\314\333\275\320\227|\372\253\036\364\247\302\272!X\027\344\272\314u+\327\375\352\002P\016\b\3649>\272s~@\232)\214\361s\241\177\367\367-\271\273B5\253\316\321Gy)<<u\247'\017We\254iMT\247\213\3700\204\332\341\352o\227vG;\220{\366\344 [\360-\221\324se\346\017]\306\204\261[\367\223\302\250[\320zH\362\356\013L\375\t2\330\273+Ux\022\212\017\303p\035I\305\251\362\317\037\321"
+	.string	"p:w_72\307\3566P$\213\371\f\237\356~\317F|x.\260Ct\323d\244\203\253\277\212c\b\311\211_#\222\314\267\027'|;r5j\311\252\342\335\f\260\033\322\242\231\264\022\320LX&m\346\222\261j\255\230\353\305\202y)Y\0043&\252\227)\243\201&\314\325\302!f\246h^1\263\346\322\220\332W\212\003\t,.e\315\214\231\271je\f\203\013V\276f\2642\205\26522sV\326ddf%\231\366\301f\336\256\340\370\006\354\356\026K\252\212\0250\b\371Vs=\\R8\240\222\254\262\301r&\022\275\006\243\256\245\265\373"
+	.ascii	"\002\013\207\306k\314\354{\033\301\245>1 \240\002\021\262\353"
+	.ascii	"\001C\344\300\327\334n\177B\253w\262F%!]!\336d1\213\2675(\305"
+	.ascii	"\343t[+\352\255S.\231jal\362\035\032\334\3209\273\023\276\031"
+	.ascii	"\234oE\276mo\316\323\312b_lC\342\340y&\335G\367\"I\207\327P\254"
+	.ascii	"\2564\032 \253fMc'\352\271&11\303\275\025\272\f#\002`\024\360"
+	.ascii	"#\327\366\006`.\271\025g"
+	.text
+	.section	.gnu.lto_sitlLatencyNext.126.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\305\001\255\017"
+	.string	"\026\034eE\360\222(\035P\213WG\373\204\267{\225\001\216\r\366\352/\354\323w\322\276\035t\270\3064\020p.u\302\243\377#\206\373\372\nZL8\253\367<\340\2045z\031\336|\342\261\344_\303\227\236p\256\366\t\331R\246\024S"
+	.string	"H"
+	.string	"S"
+	.string	"\nZ+\360"
+	.string	"\n\020\032jBvC\017\364\017\367-\236"
+	.string	"\367MG\374;\267E\315\317W\235\003@\263\202c\353hV`\\\240\207\307\210"
+	.string	"v\243\303G\207\210\036\035\210\222*"
+	.string	"lE\320\356\336\345\231\002\26229#\273\353t\201\034n\316m\223\330\026\261\323@yc\207\252T\231\375\270\032\263\307\351\356\341\337q:jZ5\235\232~"
+	.string	"\017\217\r\340_AvUn\206l\216m\206\t\333)\273\263\235i\177v\026\251\207'\037\260\033\263\021\263\033&\260\327\371\346\260c\333W\361\025)\177\001\263\332a\024(y\311\244"
+	.ascii	"\342\032-\225\023Qe\252\327\fA\233Q}\021b\2115\327\217\377\343"
+	.ascii	"RU\343L\006\030\313&w\221\032\"\361\334]\225\372\343\256\021"
+	.ascii	"h;P\322\306\266\205\267\370:\273+\342\323J\027:%\276\371'\334"
+	.ascii	"\267\353]\036c^05\263U\030F%\022J4\201\343Q\210\201\203\005\r"
+	.ascii	"<\024I\302I\204\362J$\"\n\336\350d\342\205@6\225\220N\036\312"
+	.ascii	"d:y]\270\217\2531\177^Zf\233\347\037^Z`\261\323\250)\266\243"
+	.ascii	"zd\245,\316\364\030\217>x\321\250\231)\213\215\017\031\233\312"
+	.ascii	"\\\3411:\205\360\222\251\t( p\242\231\323\036{\371\376LO\255"
+	.ascii	"\235T\261\214\264}\313F%\031\r:\031\203\261)\r\312\341-c\004"
+	.ascii	"!\242\177'\336\361zC\272e\363\246M2\373\261\377b\021\201\244"
+	.ascii	"\307\025\345(.\207\0177E\206\341L\254\023\r>c\327\350 \234\020"
+	.ascii	"t\203\323:\246)\260\256l\242\352\343lW(\003"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.181.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\t\001e\f"
+	.string	"\326\026R@\020Q\225\016(\b\022Q\201qBA\372\007\255m\255\331\t\220f\203\274\375\367\356\300\246\331E\026\311\232\263\021`\334\221RfT\345,?\221\017)\2220\314\337\215 &a{H[\362\311&{\247\024;"
+	.string	"A"
+	.string	"B"
+	.ascii	"\246\332"
+	.string	"\247\303\013\310>\265\007\310>\037\302\366g2h\337x\370a\337\202t\241\225cw\351\247\364p\3602b\240\017\272\214`\310\360\b\340\030\344\262\273\3264\334\363\266\023\330^`\177\024\321\276\375\022\237\317z\313\222\360[\271b\371\256\372D\002\013\302\341b7\224\321\256X\300\253>\b 1R\244\327nx\340\323\n\264\317\207\226|Z\304G\200'\341\027_\221i\200\211\322\206\327\356\032\370\f\333\304\206\212\257\340D\330\266\354\363\256\247\350\264\335\320\211\243\250>\210OS\350\342G\237~\227y*\304\217\374\326#4f\324\020IP\224(K\354\330\312\223-'\024\016\273\245\035:\266\303\204\221:\353_=^\307S\031p\325\253[d#!\243\301x\236\252YCq\360\240\001\206z\033\b\\\306\243\035Nf\243\032\256\243\224\002\256\0236\034\365j\345\250\304v\274<\371\022\222\026,\245D\331\366\210\037\267\214\354\256\263\b\033"
+	.string	"\177\311\017\347\f\374\032\t3\030\310\004\f\354\250\374\207\032\243\007\273"
+	.string	"Q0\314\025\016\023+tP!p\235\027\031\016\021k#bX!v\242\272\242\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.182.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\233\006\025&"
+	.string	"JC\260\016H\200\234Q:\265\204\261\342\r\225\371\025\224\263Y\307\304\272\377\372\301\035\017\266\331O\031j#\251\013\251\335\030m\270\335\335\257*\337\243g\263\354\320\221\325\375<\002\305<\3602'\256\233\022\316\262\354\351!#%\237\020\"w\222\001\322"
+	.string	"\305"
+	.string	"\341"
+	.ascii	"K\336\365\037o\231\317\257\362\"\177\353^\\\353\342\342\002p"
+	.ascii	"\177]\3600\201\200\336<\312\370\225\030\026\201\361\352\2202"
+	.ascii	"\336\312\372+1\312;4^\035)\324\f\243\226\235{\215B7\031\207\336"
+	.ascii	"d\343\013\2347\321\0178O<\237(\203\271V\273y*\314,C\212W\346"
+	.ascii	"77b\335wa\023\344\262s\357\305\335\354#_\237\322\320\331i\226"
+	.ascii	"mk+?\235\362=\005\242\225*\231\257\340\301\244\250\312\005E\202"
+	.ascii	"\220\335\211\224\017\2136\2151ZRf`R\303\023\203\366\234\021\031"
+	.ascii	"Y\315\020\323\"3gD\304\003\021\321A\365\3226\025U\252\367\336"
+	.ascii	"{\375l\227m\005\3056\005,1\224\225\301r\342m\215)(k\005\2746"
+	.ascii	"#\272\367\362\237~\234{\316\314F\346\007`6\213\001\303\356\262"
+	.ascii	"-W0\317\001k\233\371H\204\275\260["
+	.string	"\375\265\217\305\330\246PeN\025qH\300\332\263\230\223\317e\31673\211\022\366B\276\327\321\260\244\221l\f\330>\356w2,\215W\367\0253\2778\337\b\252\2649\262\371\331;\374\346sy\227\027\374,6q\302\344\2378o\236\2160\316\223M\362\217}\361[\222r(P\303\355\346\213\317\262\204\336\013\274P\207\002'\334T\254\260\027\276O<mHR\212l,\252}\266\257\270k\357d2\231\344.\302\334\226\177P\313\266\231e\237\323r\217i\271\326\226\323\266Lk\313\350\217\347Y[>\333\262\371\256sYZ\356\266l\333\362\201\312&H~\252\356\315\221,\273BL0\001+\2205\210\275\260\326(\246|\005\251l\240F\312\212\326\227\\\207X\241\300c\271\335L\313\322\356/[bU\304\254Y_y9\255y\264\276\203\307\316\271\352\320\272\221`O\276\242\332\367\342\345,]\020\203\263^\021\300:\202\002\377\203\370"
+	.ascii	"H\260&_\300\004?\242\234\nlXi!o\023a!{\344\337,\275\313\315\232"
+	.ascii	"\344cUYJP`\213\033\363\272dm\262f}\202v\205a\227\031d\017\366"
+	.ascii	"\262\217\274\232\245{a\035\371\260\025\212\001\254U\n\n4\272"
+	.ascii	"\255TV\242\025\003\343\361\025|2N\034\253\262\257f]v[\331:r\\"
+	.ascii	"\243\332\263\355\275g2\347\037\343<\362_E\n\260\356}2\3633\031"
+	.ascii	"\370Y7YCQ\321i\324\301^8k5H\346\354\021\303\255\004\326l\346"
+	.ascii	"\017 \306\230\335=\222R\002\234:\005\251\025r=\035\317\005\020"
+	.ascii	"\247\rX\310Es\332C\312\361\222\034p\272\353\251J9&\035R\n\006"
+	.ascii	"\234\342T%\246 \325\202\232\203\241sR\037\334\234\202n\252RN"
+	.ascii	"\ti\307\244\232P\221\264cj\022q\202\303Q\006\017\033J\f\261\020"
+	.ascii	"\257\271I\207bh\305\216\307\"\227\253\345`\350\216\230\314\246"
+	.ascii	"s\322\220\207\020\035\216p\275\334\022\017\251\207k\322!\255"
+	.ascii	"\300%\361\234pC*\357X\344x\270\336n\307\303\325\230\331\276\274"
+	.ascii	"]\204\211\236\032\212\373\345\275\367\246B\326\326/Z\034k\215"
+	.ascii	"\033(\360c\267\233?\266\306O\323\206\024\254\317\324\272\303"
+	.ascii	"^hk\365gg\244`1\347"
+	.string	"0\347M\237\266\035\303\264PI\260\314k\217\325\307yaO\237\013p\207\030\331\030T\217\232\"\r\315k\315;\262\211`i}4\267QE\250\375q|\250q(\306\020DH\r\005\"\2420I\222\016P\0021\350\214l\003\021@\271T$#3\242JZ\003P\227\032\242\363l\227-\303\212\372\305L\217\3645\263\334\276\\e\"\272\225\256~\016\023\007S\"\302\346\376\256\246\253\200#\231\375\361\246\322\377\242\340\211\254^\032q\224mQ\366\322E\020\215\335\234\267\344T\262\306O!T\322\375}!\371\026\251\223#\017\037Iw(U\344A\022n\236\220\246\337o\220\b\206#b\026i\216,\333 \374\342:\204)\241\331\t|\320\265j\\\360\003\354\300u\226?\334r\336\237\252!\013\351,\211\b~\236\360\202\245\004\236\001J\301\370\303\265\275\203\351\200\276Cp\341v\375\354\224\351\213\334\t\231=\353\221\220P\276\272\314\373"
+	.ascii	"\340\264\342\254M\311D\205\275\326\266\007nJ\277\\\221\346\203"
+	.ascii	"\360Z\242\002a\300\347\2603Sz\324`\354cq\354!l\0368\021k\ft5"
+	.ascii	"\023z\225\037\004\335*\263\021\217\211\365\315\022\f\373\354"
+	.ascii	"Pi"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.183.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"-\n"
+	.string	"\346\022F;@\305\2521\340\353\205\"*8,\204\357\034\343\262\003\240I)\316t@\301\013e\265\273s\317p3}\335l\210\333\216w?\320\355\236V\250\266\004\207\317le\344}3\273\245\224)\0053"
+	.string	"4"
+	.string	"4"
+	.string	"Fq8e\253\334&r\rf#\255[\200{o}7C\236\372\2244\345\237v\314\350R}f\\\035\227\004\247\002\f\367^_<\356\356\266\027l{l\003\b\227\031\343$?\276\363O\226w\237\323u[y\321>V2'g\314\223\236\336\t\263\245\364)\235\325\006^\367n\344\004\\\220\016\205\304>\rek4\357^b\007Uc[\236\336\t\363%e"
+	.string	"n55\346\214\331\306\310\317\203\027X\024\376\332O\354q/\331\275\254\217\027\027VMxg\227L\362\243\275\326T\3317\271-\303\001\316P\200\241\317Z\214L\236hG^\t\344\211lH\002AO\"\364Y\316\304C\247\201\343\020\201\340o\303\361@t\252\bV\204\037\261\216@\037Q\375\302R\335x\266$0\254\242\265a\021"
+	.ascii	"ze\321\033k\270\215\025\030H\004D\3010W8 &0\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.184.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`5\001\r\016"
+	.string	"VZ_E\360\262&\035\222\363`6\026\303\312\276\374>\024h\016\307\317\220\2345\267u\323PN\251$\332\264\254\033\202\2645\242\366\374d\217\252\256\303L\337\255\261\225]\206\025\353\224\226\200J!J\016\202\361\216\242\337\366\226;\245H"
+	.string	"K"
+	.string	"K"
+	.ascii	"\327\2219\200\335\227\216\240\335\356\300\243%\366\350\356\004"
+	.ascii	"D\217\330\005\210\036\315\331=HvW$\0277hh\370\330]\251*\316]"
+	.ascii	"\037\344\374\325\365>OIQ"
+	.string	"\203\243\345\022\361\027\3400\004ew\215\215\270\343m\223lO\260_\"C@\026E\314\321\302\366\201\034\343\354C\227\343\262\331\355\f\330\216\021\331\240\233\023\362\321\276\017g\217l\225=\322\367\036\356<)\330\255Ke|\206\352<)\213\354\336\374H\200=f\360\357;\334udH\272\ra\343?\3730\036C\025O\177n\3434 g\227\365\326\206\261\026\024x\2645\274\274\267| \241\027<X\272\262\252_\243C\312g\341\303\210\036KV\230\270>\025\252\371\241\t2\363\206\236\342X!\334\335\265\276\354\367\374\032\237\337w\376\207<\022\nv\354\202\b\036\341@B`\2221\310\\L*\224\346&\341\244\315\226mB\260\340`\245\201J\n\205\022\023\f\006mC\234\245\222\006\315r\242\022\341\301\212D\231Z\246\206\222\031.h'\3112_\344I\346\315\3054%j\333\246\034\331~\207\253/\243\314\250\007\253*\216\355\221\033"
+	.ascii	"zeY]\326\360\266\361\300cB0Hcd\211Z\016\210\202at\271:\214\212"
+	.ascii	"Dn\206\261A7\2450\215\344\024\f\206\205\360\213@\n\227\031ar"
+	.ascii	"\316;\334iE\\\313F9GS\350\273\n\036"
+	.text
+	.section	.gnu.lto_sitlLatencyInit.part.0.185.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\253\001\005\017"
+	.string	"v\033aE\020\221\223\016X)0\002D"
+	.string	"\330y\243{\240zl\222R\020\351\b\267\017\034\034\037k\206}\347\177\266\261\241\240F \326T\213A\226\205F\220i\235TZI\3430\342\351\b\352\370\366v\346\217H\255\355-wJ\001I"
+	.string	"N"
+	.string	"K"
+	.string	"\1771]\300nj5c\367Spi\314\272\364\367\002\234K\353\0048\227\366[\330>\245\030e\327\370\307\262!+rtP\335\330]\354RQ\034u\205\021\345\227\\=TB\034\016x\354\210\354\256-\021\267\274\355\005\2667\3736\001\021Z#4\374\367\337\212-%"
+	.string	"\230\330\375pc\263'd\215\212\317\334\376\314\311\247\361\207\355\313\250<x\031\177\250\274"
+	.ascii	"Kc\257\222j\361`c\367Cp\351\007\226\025>\006\306S\030\017G\003"
+	.ascii	"\b\377\235\376b\n\371\026D\212!\264\357\342.\250PU\243J\375\213"
+	.ascii	"\327L\020\226\335\223\243\214X'\020\f\2040\300\2438\356\b-\261"
+	.ascii	"-\272\214\250}\245\332akx\f\316\332]\006>\214\r%?\305\245o\342"
+	.ascii	"\\B=\315\017\220X\261p1\2017PW\2541\256\246\354\307\3742B\307"
+	.ascii	"\366\340FZ\250\313\266I\322\256\222\347\362\266I2\257\004\\\251"
+	.ascii	"\344\271\034p\236\353\202\205\017h\222\2708E\331\004\222\321"
+	.ascii	"\354x\240\321\354\262\f\035\203>\022*D\240\200usd\313:l\024\312"
+	.ascii	"D\030h\343\260\317e\21547\254\323\264\r\203\0271Q\016V\325\025"
+	.ascii	"\333 0' \240\202\241\252\331\001\231\360\346\363\320)\311CV\232"
+	.ascii	"KZ\004\222\204\022\032\363\236\017vt]\f@\034`\334\022y\030a:"
+	.ascii	"\\\255\264Rm\r<\035\320f\212\030\2044*\323@:\236\371.\275C!\253"
+	.ascii	"\215&\373\233\273HB\016-\002\030\222\027\314\202\333\253\033"
+	.ascii	"%\321\357Zc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`b\016\215*"
+	.string	"zD\220\016=`\254\311p\322\343\326\366I\353\306\232\262J*\024\245'\232\266\264\177\230\352\307\r^\325]\022\241UW\001\277\316L|:3q-\177\232.\342\021b\262\221\253P\037\367~\270h\007\271S\n\331"
+	.string	"\322"
+	.string	"\327"
+	.ascii	"k5\013DAand=\250\310Z\020\221u\240r\rh\310\372\317o\355g\274"
+	.ascii	"\325z8\336w+\344\276\n)d\335g\f\362-\022\310\265~\254\371\370"
+	.ascii	"X\357\261\240\201\274"
+	.string	"\3409\t\244\304\371\002\261\2763N\231N\217\016<\216d\307\213\220:^\346\370\020\022\307\177\344\2155\331hc\255\207\004\007\262\306ZHc\2356\222G\032\2313\326yd\254\321\306\030k<#\214\365\331\370\341\003)\302\303_\254\315F\027k;\022l\216?\237\233\026\353:,\366mV\354\301F\025\373\2571\305\263\220\266b`HU\246\323b\261XD\261g\263`\003\251\300c\013|\277_\331\006\200\317\347\363\235\330\257\031\325~\3513a1\322\366\316\367\373\211\201\331k\243]\035CW]\334\210u\331h\033\252D{,v\366\\u\366P\314=\021:{#c\373#s\366I\304\366Vr\366Ya{&q\326E8{-o\366`\334\354\257\264\331w\201\355\277|\355\257\330\354\275\254\331wQ\263\007\246\331sA\263\337rf\3573\263\217Rf/\205\314~\312\230=\025\257=\326}>\237\255@\314^\311\303<"
+	.string	"cGd\227\037}Y_\362\262\2664vYW\032\201kJ\\\326u[\326\223\264\254%\215\266z\226\f$\226up\374\225u$\256\365\234\225\265\\\025\263\221[\3538\255u\243\2545#,\237$\225\365\242)kER\326\211\242\254\021AY\303=\361\232\\\0213\277Z\277\215N|\250\211\211$\023\267\221\026\322!\261\362%k7%kCO\262.\204dM\350Hk\211\306\312\034\027\245;\024\361\364\306\030\002\236\242"
+	.string	".\342\251\202\222\021O\t\230\277\242\260\25707\342\331--,\213\007\3614\004\002\036\002\355%:\240=\003\3323\261\200\366\206\004\364'\334"
+	.string	"\275\371r\200\366\206\003\364'\034\224\336|\211h\b\365\364&@_:i\025\261I\251\354\026@{\327\227\204H\275Y\210\324\035\320\020\251\273\363Zd;\311|\210T& \323\371\027\347\346\2704\001\233\314\363\252\200Y\215T'\363\367z*\317\333Z\342\223\324'\223\215T\250\262\215T(\363\002\334\302\274Fj\357"
+	.string	"|\203F\335\225C\353O?\326\227W2?D\236\370\217\265\n\220\225*\220\265gA\326<{1h{/<\3731g\3730f\373%\301\275\223\262}\223;\373'd\001\336\021?\226^\2774'\013ug\336jYfY^\263p<d\342y\263$\013\225j\222\205u\026\2469\2176a\273\264f\242\321,\267e\305\325d4\335\215\375Zgmf\002\370Lw@\342\031\311gz\340\3513\255\372\330\226FKhB>\323'\254\255.;rP\237J\270\363<\2545\036\002\235J\342Ig\022\317\234Q3\235\203\332T2\235\347e\031\322\242Y0\216\0379\250L%\3349\004\226\355J\270s\b\204\364+sP\251\034t\360or\346\342H\227\215XbL\256\354\3462}\032\373\353\264\024\357\2146\365\251\2649gSOLi\b\251)\215\2020%UA\277E\212\202\356\312\240\331\244\364\246\234\324\201\t\020$8\210"
+	.string	"A\243\0168h\2407\301<\214\322\023\347\241q9\342E\005\200\362\250Q \346L%\"#I\222Js\300\002\251!\332\346\021\220\030g\0351D$\020\t$\2209\351\001\300\350K\374\276\fw\021\374\212/\265x\006r\237\032\017\200\367'Q\332X\026b\033\036]5\2559\223\303\351\301\007\016\300\024b\0204k\312\253\260\005\307\026\3637\232\341\340IL7\255\315,\266O\264Av\031\"\317\224ih6\223\177\002\035F\024\366*o+-\020\2754\003\355\236\240]\234\035C\300\263\016l\007\005\2248\250FTJ\tD\206S\231iS\334\370s\230;^\340\177t\2045\\\260\271\352\215\220}\254\020\300\023\257\213\351\\\327\347\320\322Y\256\246x\023)\br\236\373)\261\331\037\366\205#\305\033\364]\220w\200\212J\001\214,H\027"
+	.string	"\222\\1\212!\334$\307"
+	.string	"\200\257P\344u\240\220 \022D\202H\020\t\"A$\210\004\221 \022D\202H\020\t\"A$\210\004\221\200"
+	.string	"\225&F\344\212;G[\327\316*\262L\242\001\323\341o?\326\322\b\026\341\254\036\201\376F@O'\221\321\033\347\312\331("
+	.ascii	"QA\021^\206Y\370\331x\356\006\203\023\346\022\026LT\"\032\r\205"
+	.ascii	"\264\006\374\315L\017\"*Q\331\2406Sd\363\240\277;\2624S1\324"
+	.ascii	"\224\210j\326\037\035\274\274\270P\n5W\205\b\222\200\3532W\352"
+	.ascii	"w\223\305i\321\305_C,\027*\204\320\220\274\231\n\017[j\332J\323"
+	.ascii	"\236\301\271#\231+{\027?[\363MS\364\334\340.\270Z+xw\326\341"
+	.ascii	"\214\016n\"\013\031\363\311El\330\314\373 \305W\001"
+	.text
+	.section	.gnu.lto_.refs.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"\r\n"
+	.string	"&\031F4PK\224\341\233Y\004(;\305\317\314\314\314\314\314\314\314\314,V\215\352f\036\007\321\007\202E\001\374\253\372\355_\3333\355w\377\027=i\204\220M\366\336[\312\0243"
+	.string	"9"
+	.string	":"
+	.string	"\022\200>U\377\252%}\254\233\343W\343K>,F'\325\005\347;\342\225\367\025\324#\357!\2163\336OP\227\334?\367\315}\035\2334Y\347j{{^\bC\227g\235/g\002m\323\031\177\r\350\3244\303\276\003\246\317a\203\205\257a\302\317@\341c\270\360-X\376\n\313S\b\370M\345)\312O\254O\253K\023\036Q8\233\034\240q3(\306\243?\377\030g\177v\0205\340\356\017\247\304\f:=/\340\364P\001\347D\023\360\" \005\217<|M\360J\360\300\272\227\r\360E\004\237 \"\276\020\027h/:|\3420\037\275)\360\005uB\235\320\237\343\016\352\314IhG2=\342\350\020Mw\254N\335\251F\217\250\3360\025\234U#H\257\367tC\350\353\n|\300+L\2270\016y0\006\016"
+	.string	"\254+t\260\2727\234\366\200\351,\026"
+	.ascii	"\2356\232\223]\212\211\333\305\002(\301\264\fT\f\007\304\200"
+	.ascii	")\0328\""
+	.text
+	.section	.gnu.lto_.decls.df07b8eb7277b134,"e",@progbits
+	.string	"(\265/\375`\372\205]4\002\n\252\203\315U LQ+\215\001~\005\035\232\274\200^U\253\361J\253\350l}d{\216\r\340\357\242\263\274\262\006\347\351\023\341,\225\331\234tl\340\003\356\007\321\254\"\021\016\277\335b\377_\325\37535\271\305\317O\262\025\305\360>\033\r\241\b\021\bp\273\331\275\345\336[n)SD\013\250\fS\r\247\221r+\365\262\216\234p\276\216\241Q\260\367\345\200\336\300\300\313\001\375\315\0357u\254|[>\266\340\374\233E7u\374\246\221ydb\335\246\031{>p6s\3442K\026z8_#\351\227\200<\234\211\326t\301\n-cK\323\312da\322"
+	.string	"#\201oyf\254\317\2542\251\314\033\346\224ye\342\270o\246\325oB\2315\254\314(Sj\305\221 &\222\212\344\231\261>\323\312L:\334\265[\333*\320\016@\246\351\314X\337\007\020\246\225\271\342\236];\250]\024f"
+	.string	"d\252@\270T\364d\350\335\344\337\267\1771m\034\314\226\224\031Bp~\032\250\237\376i\254\274;h\207\253\203\2323x\260\\\036\327\035\316O\277\350\377&\f3\306}3e\274\205\351\"\211\307\322\224a2\231O\032\034!\267\021\216\016|\3113c}{+y@"
+	.string	"a53G\027\207\346\337|2\235\340\316b\310\341l6-}1q\302\371\251R\233/~\231\276T\320\341\3744\210\376M\027\346Rn\203\3723\225\354pN\254\"V}8?\r\323O\275\364\323\035\372\251\224~\332\244\237\032\351\243f\364\327\356\016j\301\276;(V^\035\324\334=7\213"
+	.ascii	"\360&\027\207s\032\310A,\216J\307\031@\223\b\033\r;\300?\034"
+	.ascii	"(tg\242\376\260\037Z\226w\324\204\363\321\245\031\\&]\342x\232"
+	.ascii	"R\006\367\335\270\260\262q\340>LF\035\263\005\320\f\347\243Z"
+	.ascii	"\364\217\307`>8\345\017\0328c1\312\032%\037YR8\037\225\242/\037"
+	.ascii	"\236Rr\017\177\301ap\036\006\203\227\367\r\353\375\270\013\366"
+	.ascii	"\202\204\304z\370\n\276c\221\334{\353a.\217S\332q\006+i\321B"
+	.ascii	"&\267\340*{G`\022\027a=L\005W)\272NUwJ\306P\027>\212,\335\344"
+	.ascii	"\243pZ#\257\016z\264\210>\312\245\2176\351\037g9\276\373\261"
+	.ascii	"\022\266b\303\305\315\310\017g\214\245\3478\013\003\266r\224"
+	.ascii	"\341l^\035\364\247\237\306\333\356\270\312\217\353\360\224\307"
+	.ascii	"\325T\231Z7\334\222\340|\367z\216\355\256c*q\262\342\017\347"
+	.ascii	"\237`\364U\336\035\224G\312\034f\342\002H\031\316/A\016?\321"
+	.ascii	"\340\b\311\302XV\024Lw\337\360\034\206\302\243\334\333m\016/"
+	.ascii	"\301M\256\035\224r?\321`A\361\322\204\007\204\333\224W#\n\232"
+	.ascii	"\177ji\354\204IK\t\211\363\317*\375\263\006f\362\032!-\370\350"
+	.ascii	"p\376\231\244\237\003\365\217\343\244\344'?\320\212\224\234."
+	.ascii	"\203\311!Y\301%qB\"\005\3477\034\275$;\214\376%\222f\226$\022"
+	.ascii	"\004\243\035\301C\264\204$\367V\256a5<$5\252\332\310#H\312\314"
+	.ascii	"(\345]\215\276\275\225\3771\033n\303n\030\311}\303k\270\3101"
+	.ascii	"\0236\362\254\334\333m\357m\023\306C\213o\315\317C\364\335w\007"
+	.ascii	"}N\352g\035\372yJ?7\351\333\335\035e\2072wGcgx\b\0220vJ8c3\034"
+	.ascii	"\344\276u\300B\256\")\267\332\336J\034\365n\357\306\032\316\317"
+	.ascii	"I\372\267\003\212\323\001\375q\031\331Q\221Q\024\316?&\303c6"
+	.ascii	"4\354\376\302p\306b<\253\223\225\245\023\234\237\215t\234\223"
+	.ascii	"\033\005\205\025M*\323U\220e\332\221\313\335 \345l\244\253\265"
+	.ascii	"\036\374t\271\033uo\034^\222f\240\214Z\360\215\271}W\242Jh\341"
+	.ascii	"7Gw\247\\1sQ\206\210\221K\004s\3352\227\273vk\022\270R\343\307"
+	.ascii	"5\360\017\\\205\2630\026\006\202\2750\016\234\003K\341+\314\003"
+	.ascii	"\177\341\036"
+	.string	"8\f\357\300T\030\f\337\300Z8\n\353\300I\274\205\273\360\024\266\201\255\260\217\373\206\271.\223c\0308\306y\224JKf\226w\357\206\301\\W\314\007\246R\211n\221v\003\253\300+\360\021\362\256]%\3772\304\357\217\t#Y\374\305-\271rGB\260d\271[\256\035T\316FJ\323J\206\321\3439re\352\316Q\271WPX\321\244&]\221-\367\336=N`\356\332Er\341\322\316\226\327\357\002\342\255\224\266\024\344E_roe\021\022>BaE\223\272\342\212\005\227\377b\371?\200\300\\\267\313]\232\312dj\344\210j\271\367fj\302G7E\032\366\316\221\227\334[\371\022~\254\002s\341$|\244\301\021\222\0050\300\345\336J\314\205e`\250\233\"\345.B\217\330\246\370\350\333{\203\300\003\302\211\205\313\f\023\006\344\037\3238\206\372\257\332-\202\264\367\336p3\207\365\204\tg<\243\347\230\306uh\332\350"
+	.ascii	"\275p\326A\3236\312\273\203^(e\372f\017}\263J\337|\3229\346\221"
+	.ascii	">\346\323\035h\321\307s\232\204$\372X\251\257L\352\3377|\224"
+	.ascii	"'\001 6\274\340||\245\257\004\357@m\364\326\204J\340=Csv\004"
+	.ascii	"\345\204\3631\224>~\241\217\221\372vW\007=\336\372\267O\2239"
+	.ascii	"N\235\016/*p\376]\352_,\372K(\032_\035\364\027\211\316\361\362"
+	.ascii	"\273\374?\200\270y!\330\033P \035\005\342|\277\\0\277y\027\357"
+	.ascii	"\037@\334,\"\262\203\354\275o\236\tU{\033\335<\234\277\275\215"
+	.ascii	"p\356\365\340^\017r\331\225\027\033\232\177\325tO\317\257\227"
+	.ascii	"\353\3343?\264'8\377\226i\236-Z\356\2220(Z8\377\367\355`\356"
+	.ascii	"\335\377\327\354\fl\324f\314H\303\371\327K\377j\351\273\257\016"
+	.ascii	"z\355n\225\373v)\327\312\306A\335\332\312\220p\376\245\322)\330"
+	.ascii	"\201\367R\320_\032\372\277S\352p\306P\311\242\254\273RR,\313"
+	.ascii	"\267\0268\377*\351_#}\233\256\016\372\337(P\314\026.fh\201r\237"
+	.ascii	"\334\300M\3119\301\371\255\376P\377W\256\t\215\333\324]\013\374"
+	.ascii	"v\233\\&\312\315\203\303e77\206\363C\240\237\001}\253\256\016"
+	.ascii	"z\t\350\313v\333\356\333\351n\222\243MPJ\234\233%IH\350p~\003"
+	.ascii	"\364\257\3333\300\261A|G\377\236\016M\301=\035\372\033}\223W"
+	.ascii	"\007\275\326\371\352\240\267\352\356\240\026\\\035\364*\257\016"
+	.ascii	"\332\301\335A\377\213\366_\263\033\344\236\231\310\245\252\275"
+	.ascii	"\266\267RCj\346\344j\r\347{\206\357\220\253\374=\273B\376\001"
+	.ascii	"\304k\220v\220\275\225\367,\357mt\257\0077\367zp\312\3650JC\363"
+	.ascii	"\261\276\362\356\240\372\352\240\034\300\371\321/\262\037k`\262"
+	.ascii	"P\201\013\2407\036pD\344\034\313a\247\330\t\344\3074?~\234\256"
+	.ascii	"\345\0302\376\323\307\237\225\316\260?'\235`\371\004\377\371"
+	.ascii	"\365_\2773\371_\374_\204\007P0\027\360\243#0{F\204\370o\005\376"
+	.ascii	"A\276\340\277)h\021~S\003\247\327\237y\374g\327o\016\340\354"
+	.ascii	"\361\233)\234\\\377\251\365\233\0058\263\376\313\302\177-\360"
+	.ascii	"\337\n\3747\205S\304\216\377\f\352\370/\n\r\270\027x\007?\352"
+	.ascii	"\205\365\233\035\344\n\b\220\343\307q\231Fo\270\372\361\006\323"
+	.ascii	"\205\023\307\177Z\375\367\354A7\005\263\002:?*\343\277a,\374"
+	.ascii	"7\177\255\232U'\325\217\321\262\211\251?\207\335\363\306\237"
+	.ascii	"}\374\247\324\237\217\376\214\364\2376\036\360?\203\037-B!\263"
+	.ascii	"\375g\324\217-8k\\\024n\363\243\305kV\346\277\b\263/\314\177"
+	.ascii	"y\354\375\227\353\002W\377\364\312o"
+	.ascii	"~8\241Bp\223\377\355\342qn\3701\013\032\207a\3107\370Q\237\377"
+	.ascii	"C\362\250\374w\353r\375\002"
+	.string	"\246\227'\277y\367\177\310\333\207 \371?\344\371O\323L*\3779\343\354\35283\237x\375\246\222;us\230Ix\2342\356\33153\331\376k\370S\031\037\"\342~\3405\177z\024\325\201,=\212\375?\377\264\370\233`g\214\337d\202\341GZ\342?a\234O\377Y\301\177?\340t\021\036\270)\274\202?\035\361\233^\377M!\370\233[\033\370M\255\343?\215\341\210\365\337\024,\020u6Q\340\311\003'\323\177\364OW\220\212\002\361\233L\307\303 \343\211\346O\t\320\224z@\344\345\307\312\214\367\017\230\307\337\374\250\226\245\037\203\340\"\206\252(\375\270\003f\211'\277?\n\367\364G\3332\340s$W\371q\210\263\305\207`\027\356\201_\360\243i\377\251\301\217\231X\374\030\353D\376\230G\322\177\252\370\361\211\364\237&\374\347\321\217\275\214N\021t\3048?(\372q\006\366\231\202\363\001?.C\201\211\200\233\302m"
+	.string	"\236R\304U\370S\300\214\200\234"
+	.ascii	"\006\234'\370\315\023\376\254\302\177\232\340\026\374\347\210"
+	.ascii	"?\233\360\343\r\316\022\374\346\001\314\022\234$\370O\032<\303"
+	.ascii	"\231\342\277\313\363\007E\320y\376\323\002\347\f\247\360z\200"
+	.ascii	"\003y\314y\342\277C\377i\342\317\200'\321o\"\205\3763\237\355"
+	.ascii	"o\256 \376\347\361\026O\343o\032\317\021\374\031\357\277\037"
+	.ascii	"8\207N\241\377\037\370\005\356\201\3770l\2643\350\004\"\372\004"
+	.ascii	"~\264\314\237C\374W\314\311\376wy\376\234>_\177\364\354\317M"
+	.ascii	"~L\201s\206S\370_\304\365\217\212\375g\b\376S\206\377t\341\317"
+	.ascii	"'\376S\205\377\004\361\237\036\376s\203\377\344\371O\235\377"
+	.ascii	"\254\371\317\363\317g\376L\346\317\313?\177\371\263\225?\327"
+	.ascii	"\375Y\356\317m\177N\373\263\220?\373\370\363\326\237\255\376"
+	.ascii	",\343\317K\177F"
+	.string	"\376\031\351\317(\370s\005\376\254\302\237\035\360\347\024\376\234\200?#\340\317 \376\354\341\317\030\374\231\347\317\027\374\346\006\376\\\301\237i~\263\002\177\316\277\371\200?\3777\317\374&\002~\363\3577\373~s\3577\303\374f\317o\346\375\346\227\337\364\362\233w\277\211\3457\253\374&\225\337\214\362\233O~S\311o&\371M\267\337d\373M\264\337$\373M\261\337\374\361\233a\277\351\365\233[\277\251\365\233X\277y\365\233V\2779\365\233R\277\031\365\233P\277)\3437\237~\263\3517\231~S\3517\221\277\271\3427\221~s\377\246\t~\223\3507\217\2779\364\233%~s\304o\262\277\351\363\233\302\337\f\376\346\007~\223\003\277y\201\337T\3417S\370\315\005\374&\n\277Y\302o\036\340\277b\376\273\365_\254\377\362\370\257\t\376\213\342?\f\277\t\302\177\333\337\354\360\337\016\3748\306\177]\370/\n\377\207\374f\001~s"
+	.ascii	"\277\331\301on\360\343\270\037\277\375\030\355\307\312\037\017"
+	.ascii	"\371q\331\217\303~\374\365c\257\037o\375\230\307\217u\374\030"
+	.ascii	"\353\307T?\226\361c\247\0373\375X\351\2776~\314\342\307\310\037"
+	.ascii	"\237\340\307\354\217}~\034\202\037\203\340\277\210\037w\340\307"
+	.ascii	"2\3748\003?v\341\307!~\314\302\2177\370\261\006?\336\360c\013"
+	.ascii	"~\234\363c\232\037\247\377]\373\237\344\307\370\277~\3775\363"
+	.ascii	"_\276\377\206\371/\222\377\022\371o\332\377\240\377\037\374\277"
+	.ascii	"\300\177\317\376k\366_\261\377\206\3757\206\377j\340\277)\374"
+	.ascii	"\367\353\277\013\377\345\372\257\216\377\242\340\277'\370o\212"
+	.ascii	"\377\022\375\177\341\277\037\370/\f\377}\341\277\027\370\257"
+	.ascii	"\003\376\333\200\3771\3747\001\377\225\377\225\374\247\373\177"
+	.ascii	"B```\340\2373\364\353$\377\031\330\00262\330\320\240pF\327P\250"
+	.ascii	"\250,28\237g\006z\004-b\372\370\257\342\2560\033t8\237\017\017"
+	.ascii	"\371\257\242S^\374\231\301\371<H\372\033\274\3503\024\355\fU"
+	.ascii	"\242JT\354\356\2461\250\214/\0349\254\264\0318\177\203\235\376"
+	.ascii	"\206$\372G\205\b\301d<D\366\223\fQ~\313\261\275\241\204\260F"
+	.ascii	"\251\001\343\f\316\337\360\245\217\222]\324\f5\303d&r\033Y%\300"
+	.ascii	"/\314\206,\375\213\311\320\037\350\330\017T\f\b\020T\354\002"
+	.ascii	"Z\201\351\215m(\250\0166.\334\332\260\340,\266\301\206\376\206"
+	.ascii	"$\335\205\202u\241a\350\336WY\365\242\351\347\273oh\230\025\037"
+	.ascii	"]l\250\027\352\205~\351\242\275\213\224\373\005\2070qP\035\316"
+	.ascii	"#bNM\222\367\r\375\002s\232-Q\322\300\371|\246\362\277z^\215"
+	.ascii	"\301\203\303\371\027,\365/X\242\177\205\\\224\353\r\345\272g"
+	.ascii	"<\273(\f\t__\312\020~\201\232\216Cy\230\310\245*4\037{\357\234"
+	.ascii	";\345\204F\026\316\277@\210F\263\326\034sM|\350\037\325qt\307"
+	.ascii	"\177\3660\221x\310\200A\005\347k\326sT\007\316\0258\276.\034"
+	.ascii	"G\261~\364\n\315\361E\313\334\013\234o\337\335A9\270:h\266\321"
+	.ascii	"s\024\007\240\233\236\021\325Q\253\037\255:\227$\b\004$\203\263"
+	.ascii	"\315\325AO\243\236\243TS\234,\317\320)\364F\016\300\033WpF\245"
+	.ascii	"pfx\301\332\303\371\027hi\254d\367\005\013\227$\272Q%\364\005"
+	.ascii	":\343\364C\235P\031(\r\024\306y\006\265q\376\235\201h\024\312"
+	.ascii	"\204B\241E\350\023j\2046\241*\320%\224\005\032\003]\201\"\241"
+	.ascii	"Gh\013\324\005\232t\002\242\310\373\206\3268\313\034c\246;*Q"
+	.ascii	"\372\222Jr\177I%(e\362\033\0308\"s\347\224k\007\305\200\261\274"
+	.ascii	"\345\226:\254\364\304\f\221.tK\254\324\004\220)\213\251\334\322"
+	.ascii	"#\206\r\304\217\231\360\242`%&\246\362L\322\314^\326kK2}\201"
+	.ascii	"R\002Z\343$s\366\335\230{\3478K\356\275{\370\220$\363Le\222\245"
+	.ascii	"\227\271\345\337\023\346\255G/\353\271-1\023\027)Z\246`%3\201"
+	.ascii	"\247\225\0373]\361\302\205\212\251\2741\367\236\002\223\354\031"
+	.ascii	"\303\200\262\265\245\022Z\343\254\362\200 x\313\017 \320\032"
+	.ascii	"\247\023Sy\355\240\266\231\007\24677\246\022\351\242q"
+	.string	"\006\201\374\035?\375\235\245>\373Le\032\026\310\244\207\363w\272\350\357@\321\3371\242\277c\246\277\023\245\277S\244oA\236\376\226\273\203\336\002&\372\026\030\321\267\300L\337\002/}\013\264\364-\250\322\267\200\206\276\005I\372:y\372:O\364u\324\364u\266\364u\250\364\227w\007\275\016\f}\235#\375\n\276\350\223\356\224r\337x\316:\234k\345\210I\n\347Wp\247S\260/\017\372\300\313\203\276\2029\375\n\326\364+\350\322\257\340\205\276\0062\372\032\250\350k \242\257AK\377'\334\317%\377\251\344\214\273yv@\200\334\341|\221w\007\325puP\314\324\363\023.\311\322\354\305\231\344|{r3c\201\263\033\034\220\275\0258_\003\r\375\377\\;\331N$\367\355l;\215\374\236^im\311\275w\221S\355\246(g\357+\266\344\331v\0369\325\256\035\324\336N&\220\021\331!\246o\357\315\003\002\b \324\270"
+	.ascii	"\243\202\323\3719x\3729s\3729K\324\262\036\016\030\215*6\234"
+	.ascii	"\237\303F\344\346Y1\342\301Cy*\361\334\211\334Fa\035|\025\345"
+	.ascii	"\234\351\377\f\362\363\354?\205\234Cj\322v\022\0358\337\265\273"
+	.ascii	"\203r\270:(\256\353\371\031\204\311\023\221'fe\350\233\223\034"
+	.ascii	"X8\237dJ\265\2757\207\013\346\206\237\034\316\317\331\322D\332"
+	.ascii	"\306N \367\355\024\373)\226\253\316\0377E\312\355\204\262\320"
+	.ascii	"\252a\233JJB\317\037jI"
+	.ascii	"\262x,\303\302\302\344X\351\377\374\372:e\230\317\241\241\377"
+	.ascii	"\263\313$sz\005z\211Y\302\371J\356\016z\366\350\371\331\205\024"
+	.ascii	"\203\255\013g\365\352\240'\227j\245D\371\206\363\271\365\237"
+	.ascii	"M'\217"
+	.string	"\233w\362\210\221\204\f\316w\354\356\240gV\317O-\233,. p8_p\3568\261\370x\330\201\301\371\247\325\211\343\347\325\317\253\023\353\356\2757\324.\n\203B]\021\230^\337\206j\352pb\375K\215\006(\022.\256.\234\317\367/\377U\232'<\256\246\340\374\034\027\372\277\307?\272\215\232\366\336O\247r7\035\325\240\377\375=\357\355\360\333\\\363\006\340\177\336\233\205\t\354}\024\270\334{_1:\f\316\310\006\316\377;\330\247\335\336H8\212\036\200\303\t\t\007\r\244\032\016'\rH5\034\273\b\251\253HC\323\306Q\204T\333[\003\022RQ\004\252\234\220jF[\003Rm;m\025V\234\356V\342(\332HU[\303F\332F[\255\312\251\003$\022\016'\244\232\221\223\006\244\032\016\247\255\206c\347l$\243&\026H\273I\303V\303\021f\253U9\345 \325\252\234\220j8\316\256\024\026\201s0\316,w"
+	.ascii	"\336\"$\322fr!e\324\224c\207TV\355-{\337\265\025\273i\333\355"
+	.ascii	"\035\200\275\245\252\232\266\030\321\270J\216\354\230\216\334"
+	.ascii	"\214\252\256r\357\315\301\305\321U\325F\262+"
+	.string	"\272\333\016\351\243jo\037G$\266\213\275\3676\241Hi\267\265\256]Q\016\251\275\264bo\f\266ro\027{\027\335m\267\367.\332{\247MR\312\275\243r\220I\027.\366\206\342q\261\245\212\342V\354\215\327\272(qB\252]U\365\304\031QK\356$e\321E.U\355\344\336\202\243I\253\025\241\355\245\275\367\335\323I'\030zMSW\222\244PM\251~S8\220\340\314!\025\203d\222\204\363)\225\253\316\032\327\016*'\315\3308o\334\267S\352\214:\245\322\027d7\253E\214.h>N\024}\326\310\013\301\256\202t\303\371\244\321\363\023\nU\353B\222\341\214\200\023\306\333\t\343\224a\"\267\321\225\t_VJB8c\310p\325\024\005\347\343\300\351\343\024\321\347\223\231\006\b\330&\207\363\331\324\363\323\251\n\210\330\025\316\033\256\016z2\235\320\3431\207\363q\312N\027\247\022\316\027'2\366p>\216\227VZ"
+	.string	"%\306\204\363\211ls\241c\005\316Iz\216\013j\n\347\343L\351\227pn3\210\251T\242\223\216\340-O\244\274\314{\2462\251&\355"
+	.ascii	"\263<U\234G\347\212\373v\"\235E?\2150\332q\230\023)\007\002*"
+	.ascii	"9\233nd\231\242s\315\325A\217\343B\377\346O\377&O\377\371L\006"
+	.ascii	"$\346\260\301\205\363\237\322\006\314\217\030~8\377f\212\376"
+	.ascii	"%\342\305MK\231\274\314{7E9\033\351\b\\\322L\346\313c\262_\356"
+	.ascii	"\313d\262\230\373\226\313\344<\214\327\366\205\215K\027SyS\224"
+	.ascii	"\263\217\264\274\345\344\007\020\271L\336b*Me2=\262#I.\223\301"
+	.ascii	"\230A\256]\3266*B\241L\023\b*\r((%9yOOC!-\315\3009\207\3113\352"
+	.ascii	"\260\272p\376\215\023\375\0338\375\233!\3727_\3727U\3727L\372"
+	.ascii	"6\201\3726at\207\273\203\336\206\212F!g\311Y\236:\310\351\373"
+	.ascii	"\226\255\344+,(w\321\232\027g\006>y\375\300\3716I\364\237\355"
+	.ascii	"\354\362\032\013"
+	.string	"9{_\271H\332\244\351?Ky\246\362\347\272<\345\346\335]\307\025\2073\266\273;\350\001\350z\236\245\344 Z\310\354\341\034\302\223\347\271?C\311Qn^\b\214\0241\302\202\363\315\272;\350\316\325A\257Z\317\363\2233N\230\264p\316r+\233\226\030Cp\276\315\217\334\344\231H\225\215i4\243\016N\3113\223?\307\345%\232\213\332\225\027\316\027\312\335A3\270:h\206\353yVR\263\267E\215\fg\f\334\236\223\374&Z~3\323\262ZD\231\303\371}w\007\315m=\317n\201\201L\264p\276\311l\377R\204&\026\205\352-S\3455\025\271?(\002\323\203\262\233\232B\310G8\340\344\330a\224\005\347\333`\351\252|e*\223\0238bZ\246e#Y\355\276\345\"\271H\316\221\311PX\321\364\302\221\213e\221L\344R\254H\370*\243\245\t\007\020@\310F\262\242P\351\374\232.\3729\371\305\341\332e="
+	.string	"\254\r\b\331\222)\223e\254\354\245\301\021\262\005(nak\311\037\030\315G\207k\267\026\001%A2Y\026\273\\\327\3302\223e0\016\250\226\326\225)}\371,\243\345\262<$\007\311B\2622\233\335\267L\226\307N#E\372\374*\310\257\301\322\257\231\322\257\231\241_\303\244_\243B\237\346\214>\315\030}\032<M\302\335A\273\212\362\254\274\300\3714t\372\177\336\312\\\367-\367\310;td\255/\311\275\225\271G\346\221\265*\370\302\305\354\311L\342EL\0214\237&J\377Y+g\321\234\021r\343L\316\312;\206x-\345\300\3714F\372\253\237\376*F\177\375\242\377\214\343\371\352'\022\026tI8g\253\236g\034*\262\226\236p\376\340N\177\215\242\377<e\246\231\305\320\301\025\365|\343\3176\262\024\376\0225\204\007\316wywP"
+	.string	"\324\350y\216\272!+\272\321\205\363\0063\236\241\376\354\"\323 B\033\022\2103\316\272;h^\321\363<cE\266@r=\301\3101R\025}\313@\2341\362\356\240\036\\\035\024+\365<?i4)L\2202\323\263\323\237_\344\246\23272I/\234q\362\356\240\005\270:hv\321\363\314\204\353\272\214\250p&@f\221[d\245\265\314\217&b8\343\265\273\203\032\340\352\240&T\3173\013 pX\304T\344\0259\351\346\2412\254\214\351\303\031W\335\035t"
+	.string	"W\007\315H=\317*\324$\244\231&\234\005"
+	.string	"x\337L\300l\244\"\367v\""
+	.ascii	"`\021T\b*\226\016#0\234\377\\\364l\364\233g\314@S\tV&H\022\347"
+	.ascii	"\274{\236\213\324,8\026Vp\276\201\201W\007\315\331{_\035\364"
+	.ascii	"k\022\375c;\214\345r\311XS]\250p6\375~\263\214i\346\303\222\326"
+	.ascii	"\016\234\017\345\356\2404W\0075\311\364\334\354\033C\372\225"
+	.ascii	"\341\274^\035\364\276\231{&_\007\345\206A\343U\305\024\223oZ"
+	.ascii	"$9\211\301\371+\232\376Z\246\177\263\355\367\315l3\303\250\310"
+	.ascii	"\275a\230\360\205\006\246\327\267\233\232B0\227*\034\036\230"
+	.ascii	"#\234\277\276\320H<s\313=\273)R\356\027\350\0164\257\262>%\023"
+	.ascii	"\317L\002\304\254G\213\3272\317\004cv1\275\230\\\314/\367\315"
+	.ascii	"\304\373M7\363\215I\211\211\345\332\255\265\260$\303J&\236\t"
+	.ascii	"\027\001\2602<\363\316\304r\223T\344U\006\302\r\334\224\030g"
+	.ascii	"7\371*\026}\265\212\276:E\277\204:\223\312\216\274\245y\305\264"
+	.ascii	"bV1\263\3347\023\213i\207\305\2143\227\230\312\244\332B\313\037"
+	.ascii	"\021,&\0233\212\211\326\244\333\222\312,\367\336=7\261\230s\246"
+	.ascii	"\224\033#\345nJ\001\013\036ec{+\315\2564.`k\276\272dJ\332\202"
+	.ascii	".\013\027\316W\215\350\253f\232\316\264\213\2024\206\363\325"
+	.ascii	"/}5\013\312}3\243\230O\262r\233Q\314&\246\223\033$\345vJ\271"
+	.ascii	"\324\340Q\266\332\220\262#)\347\253*\264)g\003\245.\216\t\316"
+	.ascii	"\327~\372Z\214\276\366\242\227l\020\202\275A\205\342E\210\030"
+	.ascii	"\234\257\255\350\353:}\rE_3\321\246\362\356\240(\264\351\337"
+	.ascii	"dCBSu\324C\213\221\233H~\363"
+	.string	"\210\271F#\225\005H\2053^\336\035\324\303\325A\315\"=7\215\330\204uQR\303Y\004\223\310M\265\264\020\354\355\306\007\026\345O\031d\357\215\243\306\371\375\220\201\263\211\326s\223\310u\316\224QZ\303\031\347\352\240\246\020s\310}\333\300<S\342\330\234!;\343\207\363u\232\376\335"
+	.ascii	"\275\201w\003\324$3\313\356\333\007\246\231\022\007o\001\"I\303"
+	.ascii	"\371\272L\377~\200\232\201\201\367\003\324\374a\002\271o\227"
+	.ascii	"3\305\264\236\024i\341|\r\246Q\310\241\251\034j\206e%2?\244\340"
+	.ascii	"|\235\245\177\023\314L\222\231\001\265\005\347\244\331ez\335"
+	.ascii	" )7\214\353dw\247"
+	.string	"d\354\353\276\231\311\203\310j\321%g\323\353pX\263\340\0034\203\363\265\224\376\315\036\\\267J\340S\033\327\326\255\332\200\303W\264v\207\263\231ej\3357\016&\217\007)\333\022\355J\352\353\215\"_QMp^m\234/.\331\027.[{2d\254P<UE|\350\323\022\030)}gf\254\bYi|\205*b7d\235A\200\"+\323\312\264\302\250`o\351N\352\004V\310\271\365\351+\f\271\324\353hF\025\234\327\027\253Sz\245cE\324\352\2646Y\3550cC\233\355m\235!\200\331\232\264&\255KE^eO7\350\220\253\322\327%9\027Lg0p^[\350\265\232\375\224\344\002\347\225\305\277l\26599\341\274\"/\034\224:\265\260u\257{UqE\303\"p\353\312\212\364U\005ze\345l\f\347\365\b\2279s\354=\351\302y5Z\213\262\312\224Q\317\360T\231Z\366\302\200\214\255/VT\351"
+	.string	"\274z\346\316\357\314\030\234\325?\fh\222\tC&\b\316\252\237\271\245&\243\356\006\316\252\031sKE\243R\303\314\334J\212\341*\302\371\004\220R\365T=\225\214\224\245.3\320\274%%_\306\\%C\227\204\217\017g\225\357pc\\p"
+	.string	"\342\254\2129\034\032V\234\025\234\325\275\303\341$A\333\262\265\314\273\272\314S\345x\252\212\302\234@c\351\fjl#\241:`>\263\026F\350\260\\\275\303\242~\271D\366\013\035\247\245;\2511\315BI\347\324\345\352\227\253x5x`\306\330y\321L\342\302\262\250ZT.tsf\302pV\267\3508\2512Qp\376"
+	.string	"\202h5\313"
+	.string	"\272\250PQ\255\334\220Y:\203\322\202\367\202I\225\253V\376\020:\220H8\253v\247\f\265,t`\330\270\222\200,\341\374\001X=\271J\367D\255\303eJs\357\244\362\350J\334\007~KV|\364m\344X\207\324\256\005\024*R\256\326a\2771l?\242\\\235\373\325\0320n\\^8\177"
+	.string	"EZ\205\362\367v5\311\233*w\022\224GW\320>\324-\235A\255rD\272`,\271*w\265\311\007\020\227\213\202\246d\003\347\253L\3260,51\234\343\232\3128\341\305\251J\246\260\230\362\2213mL\230+8\303\235\203\315]\230\"^\222\250E\324\266\254BE[j\001c\273\332v\272.C\270p\340\254\"y\236\336\026\026)8\253k\247\323{T\232 qV\217\234\216f\316k\353\317\310\177\365\307\210\t\026\032\245\350\350\207\220\263\253hgj\332T\0064\226\314\244\3726\022\252C\252f\006IF%r5\r\037\305\275\305\rQ\225\002\270\001\344j\020 \252\020\236\252\2420 l,\225M\365m\244T\207\232\2732$_\252\2207\321\201\204\253\303Y-\273j\366\2538\256/\312\b\316\027@\221V\307\256\222\375\252\372\224\344\365\247\177U\354W\315\027W*\224\340\374"
+	.string	"\210\321\017\300\225\036=T\03791x\366\021]\324\335\313\202w\005v\325\307\325\260\017 .\\\215\r$+L\324\244\372\245\352\021\311R\222\267\354\363\321\327\005g\325\253K\312\325\225\272e\376\325\354\242\034\345\221\227!\311\033(1V\254a]\335\272\312#\275R\n\371\303Y\325Rm\234\\R\177*\262l\326^$Q\302Y\335\241\322\230\241\206\345\f\316\252\016\265\206\321\222\226\032\316\367"
+	.string	"\230\345\006\003g5\207\372\302\316\252O\205\025\227\327S\023\0324T\253\234t\225=dlX\211\rO\006\324U\253\253U\037@\\\256.\253\t\017guJ\245\322aZ\312\222\340\254J\2517~\365\n\211jS\201\363\003\360\246U\033*\215\034~P\254pV\243D\270a\306\352\017\347\2535\262\254\364\370\2013\276\227C\237\247l\202xi1\302\304\244\312\240B\243\224\231~X\374\222\2501\256\312\270ptQB\352pV\237T\0303\214\220w\370`p\302\360\226\f\301Yu\272pyJ\314\220pV\233.\334\227\265.)\365\005\225*O~4q^p^p~"
+	.string	"\224j\013\265\205\272\204\"Q\210\021\333Z\252M0blU\351\352R \230\2772\262\025+T$\212L\221Clj\271\342\220\232\302\244&]E^\n\n)-\300\302\324}u\253H7\221\366\224\024\272\027\245\032\335!!\325\243\253H\331\b\033\035\030\234U#\315G\025\006\305\207\263Zt)\230MJ\213\034\001\350\241\335\256\315\270\3513\027\231"
+	.ascii	"'\036~\313\\\207\005\357I\003^\237\321|wY\216\260p\326\177\332"
+	.ascii	"\217\215\312\234\236\037\026\220\271.\234\327-QIdp\326Jt\031"
+	.ascii	"\315\224U\205\n\316:N\367\235\245\375\315\341\274\344zo\211&"
+	.ascii	"\243\367\206\252*\nCB\035\017\277e\037\216\323\022\025)c\256"
+	.ascii	"\311\310\241v\177fvh\276*\027\177S\370\264\2303.\207\022\026"
+	.ascii	",\366Dy\003\020g\235\247\365\3264%zg8\353\245\016sc\206L\206"
+	.ascii	"\332\224\027\rFK\353-\020g\215\247\277\334LU\365`\223\241Ew\371"
+	.ascii	"\371\273K\303Yo\321\\0\032\023\2601,\256\350\273\0322ga\220\340"
+	.ascii	"\254\261\350,\352\231\321\262\f\347\007\300\210\212\266\202\203"
+	.ascii	"\005\210\022<\234\265\235\256\242\224\003\216\f\347{`FK\321S"
+	.ascii	"\322(>\216V\340\254\353\264\233\027\2527$\316P4\335\005|B\307"
+	.ascii	"\205\263\216\242\347\356Z2\t\311\362\t\016\017\344\225*\234\257"
+	.ascii	"\345\264\223_E\353\260\250\3308\337\003-Z3\321M\320\035mc\342"
+	.ascii	"\250\334\003(\372\"\020\231\341\344\204\263Nr\r\367\2534imF4"
+	.ascii	"p\276\007p\372\327o\277j\003\204l\003\342|\017\326\364= \222"
+	.ascii	"\226\246\331.\221\375\342j9y\225\3351\272\030`4\222k6\271L\003"
+	.ascii	"\312\362\fg]D\257\305\t\341Q\264\246\217@Q\361\002\207\271L\251"
+	.ascii	"(\311\201D\033\321j\317\373\257\332\270\241\361]\270)WW\216\312"
+	.ascii	"\320\320P\261\245\023*mL\215\344\331Y\024\356\373\241\"\314\206"
+	.ascii	"\231\231\026b#\2717T\2073PL\231\027:\310\265\0200|L\254\270\305"
+	.ascii	"\211-\321\275\341|\017T\220\221\241b7Gyt\305E\262\246\353\016"
+	.ascii	"\211UFL\f\025\343\251*\032\203J-\355x\352\333\033\252\203\315"
+	.ascii	"\224\030,ep~\007Lt\362K\377\310J{\037\221\240<\332\2627T\207"
+	.ascii	"\013\226\364\021\001\273\376q\355\343\003\210\313=\340\f\221"
+	.ascii	"\262\260_\305H\352\370\204\340\374\016\332t\007A\364;\020\323"
+	.ascii	"\277\226\272oZJwuP\356\"\032/R!\3340\261\261\005\245G\336\022"
+	.ascii	"\203\214\352\374\342WE\006g\315u\275US5\365C\305\034\316<\240"
+	.ascii	"Z\200\351\303\371\035\354\3207\221L\026W\352\256\256\250,u\016"
+	.ascii	"}CW\245MY\352\034&\223\371\204\302\212&\265E\032\335R\347\320"
+	.ascii	"VYO\203\243\275\247n\244cK8\200\364\351,\275Cki"
+	.string	",\255\343\276\351\034\032\307q\035\236\242\322]U\341\253\311\357"
+	.ascii	"I\237\0031\372\034,5\025&\013\322"
+	.string	"E\207\3639\240\242\2478h\242\317\201\221\250\250\233ws\366Q\036]r7A\205\220\036A\022\243\003\347s0D\377\032JC\335\274\253\334/8\370\241\3210\335\355#\234\317A\227\3261t\f=\3439;\n\r\253\001|[\372\242e\\\317H\213\260\306\226\310\t!\233\001\003\347s0\245]h\027\372\211\001_`\222'\f'M\270\234\256\237T NIdS*\344H\031\216\246\027&\024\026%`L\250\324\316I9\261:\246\263L\325\0261[p>\007NZ\257\320+\264\022\336{\3132K\301*\263\322-\256\225\320\271\264)08\237O\263@\343\373\261\204\205F\272\020b\264\304MYC\365\205\t\016\235t\032i\262\224'\006\347s\260\2656\322F\032\3519\273H\252\203\r\333R\223\013}t\215\004\265\245\017\313\364\201\267\366\024\005\347\003`\251\177\275\337\364\306C\262r;\241pPB0\375\346t4\301\371"
+	.string	"\260\323\351\231\364\f*\306G\243\325\202H\021\316\007\200\234\0313\351\037\334[\352\344L\225\212\324\357\351\237\031$maEI\003"
+	.string	"G\370\370\322>2at\324-Y\221\222y\332\207j\341C\273\3029\035cJ\321\374"
+	.string	"<\313:\227\\\200\021\201Q\266\267\027\007\200\244N\303\244aR/z\223\321M\264\024\275\300\371"
+	.string	"\300\221\227\207~\205\301L\2004\235\341|"
+	.string	" \351?\375\222~1\271N\3446\002\363@\016\315\314\226-\251\027*\251\327\n#{]\356[\352\345\362\255\b\002\207s\312\305T\342\032J\026K\270\377\352\375\221\204\214\r\347o\200\227\336\245w)\226\2720R\035n\302\216\324\330\201\3637xr\345J\212\205\205\235\272\257$a;p`\271g\352W\330\325\022\316\337 \255J\025T\354\215\3122[\371bD\b\316\337 \214\216.\245\242g"
+	.ascii	"\272/0\275>6)')*\351\024\235\026L1\322)i\035\237\226\036tf\216"
+	.ascii	"m\343d\006\f\264T\312\006:\242D1ux \347\264\001\225N\227\244"
+	.ascii	"K\322'\034\242\214!\202\326\302\311\323'`h\370]\335H\345\366"
+	.ascii	"\216\304\262\344\322&>\364\270p%\331\244\275(\223\304\344,\272"
+	.ascii	"2\227e\r\347o\360\244\177\317n\252$U\322\303d\203\"\375\247I"
+	.ascii	"\356[\232\304\324QA\323\005\\d-50\243\377\324\355\276\245n\346"
+	.ascii	"\026\f\272\205\213.\r\226ii)\033\207'E`z}]\254\224m\301)\033"
+	.ascii	"\230\325\315N-\020\347\264H\272\266\302E)\277\326\216\3204Y2"
+	.ascii	"v\364ws#L\330Yj$\347\275H\332\350\3039U3\203\334@2"
+	.string	"&C\203+\251Yj\226\242m\371-c\260\251\260S>E\223\023[\356\270\3029=3\2638\211K\3029\035R\023\204\211\013\226T\3109\006\211\314V*$\r\302A\206\227\037i\020\f\345d\243r\243\201\3635x\222\222\245di\230\027*\251\025\323\034S\234\230X\032F\227T\n\262\306\003\347kP\366\343G\032Fv\323b\256/0\353\353+\r\203J\241mmy:9\242Q$\005{\032\226\257\234\335m\271\321\243G\352\025d\311$\265\347\225v=\365\302Hj\214\211\241\001\213t+\335J\265\274\214\341t\361\2121#\314\216\035\251\326\026\327rCIu8\227$\255\244\322\254\247Z\346\030\216\231\023\333\2369\306\305\207UR\035\026VVR\305\026\265:\234\237\301[z\225^\245V^l$\301\300\2301\006\347g`\244\252*\265j{\261,\343\305l)\265\302C\272\210\331y\341\374\f\316\246\376\222cR6"
+	.ascii	"\227`iT\032\345W\263B\nI\033\316\317@\213\006\024\252\2257T\316"
+	.ascii	"FB\262%\231C?\203\033:\215\221\302Hehq\311\240\206~\0060t\372"
+	.ascii	"\224>\241{\327F\0300\27511MlG8?\203\026:mJ\233\320=\003\330p"
+	.ascii	"\002\323\353s[\301\205\016\347c\360\247\237.\335\224\211\351"
+	.ascii	"q&r\253\210c\300\227\023\230^\237\030\375\270\213\221\3666\022"
+	.ascii	"\300YT$\007\221\264\005\n\230*\341\271\007\250 \341G\030\f\360"
+	.ascii	"\3641\260\202Db\300#Lh\262\220tj8\037\003'\372OW\244+p\031\036"
+	.ascii	"\"\373\351f\307Q\030\220\276\275\241\204p\203Df\215\n\347cP\245"
+	.ascii	"\237\026\335\364\b\351qw\257h\272\200\355J\217\345n\332!\034"
+	.ascii	"\003'}\f\266~\334\177,\200\233\036fS\\8\037\005\274h `\272Q\255"
+	.ascii	"\273W4\251JW]K\016z\372\034\254\350_T\013%C\006\375\343\371\201"
+	.ascii	"\206Z\351i=\361;\372W\2277\326\207\363\371P3\377\325\025\020"
+	.ascii	"\213\214\322\fZ&*\207\235\016,\206'\005C\244L\021\234\321>\016"
+	.ascii	"N4\037\037\272\247w\215/\374V%\013\306\232\236\036\272\207\367"
+	.ascii	"\336;\231\032A\"d\251\333b\034\245\355\241ZX\332\262x1\373\362"
+	.ascii	"\005]\366Hn(\250\016\371\306\321\262-\357\35023q\362\026\003"
+	.ascii	"g\024\314\315\030\276\245\326\345\262\2148\263\272-.\\P/Y\311"
+	.ascii	"\r5\326\301\246)\006\030U\227\243^h\236\024yA\304\311\177\325"
+	.ascii	"\324\342\304e\206\3639Pi-ZP1\275\367.\312\331G\\n$7\224T\007"
+	.ascii	"LE\n\317)F\226,0\240\234\251\262\004\347shq\345\312urB\327\224"
+	.ascii	"\310\361\351U\251\202\212\245`\254\303\332\226|\301\204\363y"
+	.ascii	"\356t]\035J%\2054-\232633\234T\305-\217N\261\362\304e\343|\036"
+	.ascii	"'zn\016\245\323\333\2020+0\275>\025\216E\216\253\363\035\245"
+	.ascii	"\223\313?\272\b\371\302\371<lJP(J\320'q\217C\237\340]\265w2\205"
+	.ascii	"\362\005\270\334PP\035n\300\316\300\270sr\364\211F\003\262\233"
+	.ascii	"pF\227\240r\377U\255\202\354\n\212\034\332\304\t\312\013\357"
+	.ascii	"M7\271Z\002\2022\301Ejnp\251Q\005\347\363\345\251\377*\216\230"
+	.ascii	"\237\322\035\316\347)\323\347\271JC\333\322\320$\350\333\321"
+	.ascii	"$\346\230T2\013\316\250\233\232\032\312"
+	.string	"\366\034\243\275\217\366\236\232BkTY\361\212\340\371\0319\312\206\"\tm\360\350\302Q\206\223\360p$\321\n\205F \026\205\204\212>\030\020\207B\243\332\262G!V\b5Ad[v\304\211\002\021\205>\307c0\001\t\360)\036\207\301 \b9\355\2208\254\240\035\022C\f\375\020\245l+d\215>'\341\301X\342(\024\301\006\021\375\260$|\216\254\361\346$<\214\340\023\2025\022\265B\026(g\210e\203T\023>l\006\330\030Z6\006\"\241\341\b-\211\021\303  \236VH\204\001\366\207\250\035\266\255\n-\033\003\221\320\260\002\242\240\005'aA\033\374\031\252\254\320\260m\331\021A\033\342\260(\202\232\223\3600\3030\350\207h$jYc\221\250\333!\n6\237\204\207\r%|\212A)\214mpg\004qhl\217\027\030\333\366H,\372\234@B6(\237(\032I\264Eb\352S\f\n\026\211F#\033\f\346"
+	.ascii	"\245\255P\310X\004B\201Z\342\3208\204\376\bY#\320\371C\034\236"
+	.ascii	"`\215hP\020\333\002\235%X\366\bt\n\tYc{\024b\205\202Dv\250x#"
+	.ascii	"\304\n\001ivX\242X\364\241!\262C\305\037 \324\204\023R\023NP"
+	.ascii	"\331\037\0204\0334\004\032\022jS\366X\f\362\001BY\3420\2108,"
+	.ascii	"\022\265O1(H(\204\022\331\241\"\320\371Cdc\030\372!J\333!q\250"
+	.ascii	"\226\360\031\212"
+	.ascii	"\260\240%*\262BC\021-{\334\2419\t\017?\302\024?3\f\203F\360\260"
+	.ascii	"\341\030\374\021\246\370\261\t\n\"\"\022\213\304\364\330\022"
+	.ascii	"\r\005\211\3036hH4C0xsl\211\206r{\022\0362@\217A\234\021\302"
+	.ascii	"\326d\2032\344\034G\b\203&\300\216\020\036\211V\326(<\361c\024"
+	.ascii	"\262`S\302G\330\036\331`\312\222`\030C\260\204\217\260\215!H"
+	.ascii	"\034\272\020\304iQ\260\027\370!\016!P\303\032\211Z\243\220(\207"
+	.ascii	"\035!\204\201=\n\215\022\300)\341S\fZ\2015\026W\210\001\247\035"
+	.ascii	"\022C\254-K\001\237\037\241\315\013!`\240\300\013!j\204N\300"
+	.ascii	"\240\026M\030\331\030\216AA*\030\213\0238\022O\024\177Z\"\022"
+	.ascii	"1\b\235\030\332@\350\004\f\352\320\270\001\241\023C6\307\241"
+	.ascii	"\005\254Q\005\241\023C:B'\206pZ\226\002B'\206j\216h;$\206\250"
+	.ascii	"\221\300Q\350\304P\316\021e\203~\206j;$\206\250\231\201\350\030"
+	.ascii	"\f\022\232`\205\206-\315y\301\361\207X\364aS\b\203\330\037\r"
+	.ascii	"C,\033\264\026E\350\220hI\350\331\340BQ\304\261\204O1\310G\307"
+	.ascii	"\310\266D\242\342\nl\220O\212\025Zv\004\016\212\222\320\243\363"
+	.ascii	"\007\017\355Q\030\204\266DE\263\004\017-Q\361\324\303\240\240"
+	.ascii	"\241\220\r\333\n3 4<\246\251\t\036\216*\005hN\302\003[B\b\024"
+	.ascii	",\032S\214\360\361\021\202\240\002"
+	.string	"[B\b\264\336\200\360\220cs\202\007Vh\330\266Ga\020\016\333\n\333\030h\214>C!\233 !k\f\232p\302\261H\024\022k&\300\266B\237\341\017q\210C\323\032\205m\fk;$\2060\032\331\037a1\250-\026!P\024\261\241e\217l\006\204\330\366\230\342H\363Cd\2178\021\b\001\003q(t\241\204O1\210\006\247\035\022C\\p$j\205m\f\032~\214\305\r\b\t\215#\212F\030xJ\370\024[X[\320p\022\036\212\303\237\366\270c4\262?\355\021\375\231\200\256)\341S\f\"\312\020d!\006\025Z\230\200\316\005$xh\215\302!\0172\030\213m\321\005\266e\203\206\204\212+\b\235\030\332`\004qH$\022e\340\204\r\0334\003Q\361\007m\203&\234p\022\036P\030G\0301\244\363S\034\032\331\241 \320P\020\007\024\306uH(\344c<\215\354\317\320D\3218\364\303\2420\262ACD\021"
+	.ascii	"\n\022\222X\331\237\241\321\310\232(\006\211\303\016\202#\210"
+	.ascii	"\202\206x4\264\354\2215\376\020\2073\004[\3411(DdlK\260C\307"
+	.ascii	"\fj\330 \241\317\332\032Y\023\304\241\217\361g(t\022\207B\272"
+	.ascii	"\204\017K\302\007\205PH\343\034\203\212C>\306\rG\2265\216`#\300"
+	.ascii	"\006\215 \252 $\\\301\304\020P\005?AE\022G\326HB\004\333\nM\f"
+	.ascii	"[\037\025\330\237\242\013\306\241\220\2078\364a\217DA\024B\241"
+	.ascii	" \n#M\020\005\2210\210B(\204s4\026\215F6\310\n\t\215@A\037\343"
+	.ascii	"q\007\035\036\217F\032v(E\253\201\003\020P\261%\362\001\300q"
+	.ascii	"\210B\030\034A4\003\373\323\022\r\021\207\033\330\241\024m\220"
+	.ascii	"51l\205&\206F\366G\003c\261\365\021\002\005\213-\22108\2028$"
+	.ascii	"\321\026\213B\307\240\217\221\247=\t\017\032\030\331\326\206"
+	.ascii	"8\204!H84\262G\r(D\240\310\200Q\330\036W\035\237\326\247UE\370"
+	.ascii	"\f\215,\221\035\241o\302\t\"\234\200\002\212\364((\200\004\005"
+	.ascii	"\220\200\036\005\005\364\364(\340\204\036\375\023z\3146hl[\341"
+	.ascii	"M\253\032\331\022\306\342\006\206~\210T6\370\023\242\304Q(\002"
+	.ascii	"\310gm\213\303\265=\006\021\301`d[\"\273B\033L\217#\204\"\212"
+	.ascii	"C\364\030\0341\004\"\026W0\301F\200m\205\031\250\t*\372\024\333"
+	.ascii	"\242\021\206\034bqx4\262&\210!\204N\300\240A\350\004\f?\254\017"
+	.ascii	"1\305\221(\003{$\272i\217F\"\b\260G\"\233\024\306\226\025b\203"
+	.ascii	"X\021m\221\3041\002\354\221HC\t\342\260\005\266\025\266G\265"
+	.ascii	"-\001\203\320\017\020\333\n\177\206\210V6\310\376\024]`\215D"
+	.ascii	"AC!\220M\213C\0341\f\022\006\203\351Ix\370p\f\242`[\"!\rA4\030"
+	.ascii	"L\215,\361D1\030L\217F\366HD\f\006\365\017qX\"\030D\217\304\341"
+	.ascii	"\3201\030L\211\305\341q\030\304\006\203j\033l\217\303\240\234"
+	.ascii	"\223\360 \302\017k\024\2228\212\220\200\026\005K\f\022\022\215"
+	.ascii	"l"
+	.string	"K\034\222h\207\202\301\r&X\343P0\210\006\321 \312\222`x\f\006\321\022>\305\026\206\212\305\026\210C\241P\215\260\025F@\250h\034b\331\265h\302\310\036k\332\0220\b\235\030B\337\006K\020\207-\f\375\020\251'\341\241\004q\0304\364C\344\201\2215adc8\016\365\017\020\036\0361q\0304\376\374\bK\370\024\2174mPx\244I\0214\024\022\002\005\211\303\343\332\006\325\326X\034:\t\017\304\341\b-K\034\266,\021\003\365\210\032\177~\204E#K\202 qx\324&|Xcn\215\305\241l\374\371\021\346\022\304a\013B'\206\3226\210BK\034\022\245m\360\204\2366\370\241\004c;\324\022\207D\352\017\313\016\035\203\306b[\024\242i\203'\364\264\304a\332\006[c\021\206\027\204N\f\341\264\301\027B\344\342\020\267\301\025\214\254\320\260\275!\032j\211\212A\241\023C#\034\215\254\211\241\361\007\210\215"
+	.ascii	";\224BD\320\205\020\"h\204\206\255\331\0063\260\302\nB\303V\033"
+	.ascii	"}|\314 \226H\024\222\360I\331 \241O\f\353\013\3541\210h\210\346"
+	.ascii	"D1\b\310\310\232x\201\3651\026\201l~\330\240\031\204D6-\032S"
+	.ascii	"\214P\217A\023l\004||\204\272eK\370\b\207\202B?@\353\360X\034"
+	.ascii	"\252\031\022\022\266j\212!c\320(\f\"\032A\024\006\211\204\206"
+	.ascii	"<$H\201\302\310\006\261>>\302\240Q\310\022\207AA\"\241a\006\255"
+	.ascii	"\220h\004Abq\330\n[\";4\026\203DBC\013H\220\002E0E;\364)\006"
+	.ascii	"\261&jN\302\303\002|\330\241#+4lu\033d\205\206m0\250}\330c\320"
+	.ascii	"D\213\266\301\021\304b\3201\030\024$\3649\2468\006\203\032|\330"
+	.ascii	"#1h\242M\333\223\350\340\305!\3268B[,\032G\240i\211DE\237\363"
+	.ascii	"\030l!\250\035\036m\2162\244\360!\262\2550H=\312\220\006\tM\030"
+	.ascii	"\331\226\030\202-1\034:\332\264\301\017%\264\304!\221\226@\013"
+	.ascii	"!&\220O\302C\353Cdl\217#\034\331\241\024\355\b\307v8\303\bD\304"
+	.ascii	"\021\"\240 \"\016\203D0\341\204\340\t(\240\030\201\375!\n\362"
+	.ascii	"!\016G0\036\211F@\300\207\037\366HD$\nj\324\330\016\325\374\b"
+	.ascii	"Y\343\215\261\035\262i\207\306\0235?D6\bD4\003{\024\316`\303"
+	.ascii	"\036\2053\004\207\210J\370\bg\b\276\020\"\210\363Cd\203\254\t"
+	.ascii	"\3411\370B\210`\315\321\310\2260\n\205\202\2328\024\222\360\t"
+	.ascii	"\242E\"\0334\004\n\246\037\216#\204A@\301\264\r\246?A\305 \r"
+	.ascii	"Q\210(\250\350\0234\022\371\004i\330\240\031\204\255\211\340"
+	.ascii	"\215QH\302'\003\021\315\320\032\213$\216A\265\r\276\020\"\270"
+	.ascii	"\226\360)\006\005\3176h\302\t@@\305`Pm\331#\020P1\230\276\020"
+	.ascii	"\"H\323\232\360a\177\212>A\375B\210\240\215\260\025\376\004\331"
+	.ascii	"\237\341\211\340*\201\026BL \370B\210\240n\217\303 \033 \242"
+	.ascii	"\031\202G\326\310\262F\240`M\033dI0<\242\357\351Y\241\003\031"
+	.ascii	".@\001"
+	.ascii	"\355\343\241\005\021!b\030\241eG\030\205\355\b\304\241Ph\004"
+	.ascii	"\037\343q\004\017\034\200\370\021\016\005\203(\373S\024\n\236"
+	.ascii	"A\305\"\004\202\347\177\232\262|cH\214\220.4dj\332\225\213=\346"
+	.ascii	"tgt]\241\022\313K\331\255k-\017HF\216a\241\001\371!\203\206\313"
+	.ascii	"\037\021\244\017u\t'\210\031,_\302T\344u\221GU\004f\376\211\241"
+	.ascii	"\345X\361\245\317\230:\214\264)\223\350\023\2744\333~^(V\324"
+	.ascii	"\222\023\271."
+	.string	"u\313\207\233\337\030\r\327iz|u\023\343\264\265\003g\232-\3557d\f\353\013\017t\307\211\206\034\303\246\265\276\235fJSKY\253\234\2233\265\277\035\253\335\215\335Y\240\226\016\324\212FG\0216\031X\347\022\033+9\226d\311\221k\214\220L\001\274B\223\354`\221\205\341P\342+uKGV\246_\r\332\013\030>\252N\"\271\252\212J\013\225&S\023e\213\021\331T6\242Ab\202D\343\206\017\265\311\232\330\237\024R\326z\322\364\205\306F\226\201.\341\271\251\240\211R\333\3261)\254'45\302\240V(\234-UXK4L\254;\030\201l3\314\255\214\365\225\304LF\032\246\206W\006Py\003\245\345L\030\032\030\252\220.{mGO+\f\036U:\252\340\334\364\203u\244\t\316\377 \213\206\251\306hF\222*8\377\003*\375\323\270\310T\220\204}I\241Y\312s7c4\344\326h\224T+t2"
+	.ascii	"\235hZ\2547j\240\334r\320\321\2608\267\242\274<\361A\223t\032"
+	.ascii	"d\346R\204\324\243Yqra\025y\201e4*T+\034\267 R\\4Hg\222FE\223"
+	.ascii	"\024\0254G\353\017/M\340\374h\214\326.\030\\H\226Ti\200n))K\322"
+	.ascii	"l\265\316\353\b\025\225\300\025\315F\006^\223)g\264\0201n[q\200"
+	.ascii	"\250\030\222\032YW\353\237\376a\243\224r\262d\365C\377\306dm"
+	.ascii	"\231\311W\374\342\330\266\254e\326%2E\226\354X\373T2eo9\260p"
+	.ascii	"F\267j\252\254\2209\201\033\243\236Y\362E\005\266\256*\226@\345"
+	.ascii	"y\341\214n\325T\265\341\315\350\332C\265T\330\310\013\263\352"
+	.ascii	"\241{TKIV\302\250_\244\270\262\254p^\301\230)\b\f\f\f\374\333"
+	.ascii	"\333h\005\203\327\345\232\367\025\314\357\365\340^\017p\322-"
+	.ascii	"cH#4\257[\326-+\336+0\332Z\247,\231\201\352\333P1:\374\253\227"
+	.ascii	"\257x\347\n<1Vp^\273\\N\373!9\303\202\363\312\345r)\335\224+"
+	.ascii	"\252\002\230Q\242wW[\270\334\231|\253X\031*PY\3140)p#r\005\213"
+	.ascii	"fS\311X\221\223\272\222\327\260\016?!G\253\025Un\251\205\232"
+	.ascii	"\030\316O\276Fy\262\332\231w~KfRc4hJhU\244|\265\373J\345\003"
+	.ascii	"\210\177\321c@\356\214p^\247\374\006\252n\311\262\216\016\373"
+	.ascii	"\370\262\024\006\347u\356r5PZ\372v\254P\324%SX8p~\312vg#\211"
+	.ascii	"\363\013\260\267\302}\215[\341\326* \bY\262\342\243Ou\302\207"
+	.ascii	"\325c\311W\271\257M>\200\300G\024\260\272a\203\311\252\004/\355"
+	.ascii	"k\021#\353[n\252\331ED\366\213[g"
+	.string	"\306o9\266\244\241\267c]\373\372\366\325\215\206\214\035\216:\234\32765\n'\007\227\22108\177e\303SQf\232pVw\254H\214PAr\301\371\005\270\323\353\221<u\205\344\255\t\347\002P\321\253Z\001\222\254b_\311V\261\025\315\fgN\207[\340:\344+\332W\345}R\304\304\206\363\327\263U\210\032'\025\345\317\306\032\304l*\371%\310jfTE\b\331I\246L\317n(\355\265l\0353[\223kr\375\261#\214W\231nR\301\304\315\307\327\037r'\300t\321\341\274\206\351\265%C\312\220p^\301\362\024\332Bj\313\023\316\353\327\345\342x\340\235\265xb2\205\363\013\020F\365\265j\245Z\273~,\235A\365\341\234\235aQYy|\355\372\332\303f\006U\027\032\316_\271pp\030\305\230\303y\335\022\301\3142\322\342Zw\254Z~\313\2476\037@z\324\255Y\247\214#e\270\212\340\274\342Xu"
+	.string	"\356\261\300Rs\244\213\337\035\326\232\343\b\025\340\036\007\264\006\227U\222\365\352\214R\327\212\270Y\301y\265:w\374W7p\2359\002\003\313\335\025R\001rDE\2557x\252\212\306\320\314-\351\305\350\013\211\242\2504C\016\226\206\n\255\262H\022\3529\020d\2221FT\233"
+	.string	"C\026"
+	.string	"@HD\"\217\211\302\260\365\024"
+	.string	"\024j\310\214^\036\017\306,K*\306L"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"$\200\004"
+	.string	"\002a\t\371\220\201\005;\316\237\006\266Q)\365q\tDA\3454\034\327\324\276\261\030\f\0032]=\307g_\n9G\b8`5?\201\026[\332\222:9\332\343\366-\2653\332aO\262\026\361\371\023^H\002\342U[9\371\237\211\031\374\367 s\246q\331-\2300\305\313Gq\001\374\004\326\360\271^\346\\\224\216\220A\036x\376\253\035\327e\b)v_G\265P\221\013\261\270\304\246*\211X\227\230\361\334\325\nO\305\212\034>\201\310M\252y\312\232\256\335@\343~\220\320(8\3166r\031\226\371\2529\201\317\032\253\017C|\362c\021\377N?\270\271\215\224J\334&\032-\245\245\254iJ\221<\005\f\346\241\0316\374\265\314=0"
+	.string	"\323\215H3'~8\265pL\346\002\341\327\2119\337b\206\351\204\301\333S@X\220\036D\363\372\242\360 \022B\2557\217\376\320\263D\3726-\331fU\025\270\013_\363R\342 \370\017\204-\3269\267i-\013\365y{\244\334c\215kZ\024\222A%\340Di\221\323\206C%\302\033\r\376N\274\205LCb\263"
+	.string	"\301z{\205S\305@\221r\316\311Cg\200"
+	.string	"Ae\314\264Am\302\360A$n\244\203\345\0030\355#\333bcjR\f\273\024\255w-\034\026\b\003\262I\024\206\325r\\\277\221\024\007l\236\260i\344\321.I\271\265CO'oT5)\007\274:(\307v{U\031\374\005\203,G\206\031\344\364\021\255\005;M\223\025^\302\037\024\347\331\317\251_Z\330\337\373\343)\307\360s\036;O\245\001J\342\006y"
+	.string	"<\350\246\026(\235\026\364\200;\3566\364\001\020\263\306\214\216\001*\330\\ca\016\262\305{\205\315\bd\200\227\370^\256Y\0174\254\325\f\253\3229\237Wp\263MG\001\257\260\274\353\226A\335\3461\034\311+h\357\260\207\240q\f\356i\\"
+	.string	"\252\324AYF\001N!\236z\260\327\323(f\3557\201\272i\216\021\313\034\330\007S\263T\203\3608e\234\326\360\300eOLw\313s\342\030=\336\002\333D{\372\277HQE\335f\257\355\321\274f\240c\251^\324A\364\345Mx\202\312\206\333H"
+	.string	"Kr\222\323\207\215\253\001\236\347="
+	.string	"\233\325b\222\204\214\236'Iv\330\350\264\nx\351 \212\023d\231A\365\267!O\233^)\311\255\251ljer\355\032\026%\002\315\271\356u\256\326%OP\240\257\217^3\274\021'zf:\265\250\244\273\214%`-\004\337q\270\377"
+	.ascii	"\236\201\204UY\342<{c\301\246@\224\377Ub7P\332\372\305;\3429"
+	.ascii	"\023\360\261\357\314\310\004\001.`\333\322\177di\237\230\362"
+	.ascii	"\026\034u\334A\207\306\022\300\261\262\371\\\216\236;\354R\303"
+	.ascii	"[\234.+\376\227\021\371Ss\370%\013\034+\313M\260\304\2329,\f"
+	.ascii	"^/\370'PO)\007\306\264x\036\0378\326\213\341\202"
+	.string	"\"Lr,\314+\360\205\332\216%\331\003OZD\202\331\253\361\274_\006B\226\211X\013<\223\341\327\032Ex\035\261\214\262\024\013"
+	.string	"\225:\267,\3473\302\030"
+	.string	"q(\301-\246\217\0332\367!\365jw)\200\360B\031K\341\236\232Uz\316E)G:\021\345\r_\352\270\223\030f\023\222\274|'TN\017&\23249\324\004\035\345\373T\331!$S\344\217\356\2016\005\031\212=\370,\t\227\204\205\225\\}\204\332\201\016\310x\233\347\2553\260\260N\212\306Mf@\021\351\322Q\3769\325\231\271\351\024\006\203:\363\327Oj<q@>T\375~#\2122\024\324\305}E*q>Z\370$\321\177\240D\333\241\333\231G\377T\217\342\345\362\211\035\003\006\b\r\001\"*\242\347zz1\002\n{D\032\345\375\031"
+	.string	"T\031\004H\246c\277\273\031b\343\247\230\001\240d\225`Lx\326\217\323@\376\257\321\2723\"\374\307\255\367\026jY\322\230\245\322W\341\032\020\377\013\327S\363\352\021\270\007\354\377\2760\340\3648\n(\024\222\004?\024\n1D\275\344q\342Cc\032\003XK\004\334\352@\b\302RG\207\224\224/\021\213'&\266h\035xs\323iS\006\377\313\264\350\324\336\314:\243\204\334\373\315\256v\252[8n\377G\\\203\033\212\266f\322\220\035\375mg\205\342:\261\332E\350\232\302\200xx\337XP\227CF8\227\205Y\225.\030]\t\004"
+	.string	"\r\240\210\241\377xN\002\020P\302.G\331\3251I^\261\233F\366\327\343g4\371\234\277}{\016I=#q\270JE\337gCM\375\215\020\320\255vX\357\337K\020\370\247\376-\273\333&g\241z\250\244\021p\351\313\214\265\262s\353\322\264\341\256\227\035u\245d<\307\246Z\203Ch\002;j\203\361\n\312\361H\341\244\271\"\254,\341l\235<4\300\255uEr\026Yp7\271"
+	.ascii	"\276\344 \3520\002\235\304\034\245\301\270\232H\254P_\306kEz"
+	.ascii	"\235\355\234\377\246*\316\2020\007\023\210"
+	.string	"N\274\300\322\330Y\301\026\240P\325*\207\307\267*\262\303\205\207\376\226\327\373\021\323Q\264}\254\371\263\361\3019\331g\277\264\013z\371$z\326_G\354\\\033+\027\0042.\021(\310\203\271\354\023\216\256\276\217\177B\203\275\205\230Q\317n\231\302C\303\245:N\341\326\265\321aX\030\347l\031\2129L{\325z\262\036\005\242\377\037\021\247=\277rK\205\006\223\240\350F\221jxG&\316Z\257\313\246t\365FU1\027!\202\273\372\b\001E7.c\3230\026U\177\365\316P\204\277\363\313\333\337\300Z@\0014b\203\373\235\256\266\322\342\177\247\026\224\201\244\315\223\306\376\036H\360@\254\220\250\267\261\334\205\013\354\267\361\025{\f\025\034\340\324\\\246C\330\027p\005Q\222$\024\243N\361.\020\307\222&\275\264\320z\310?\032\216\377\034\273\030\347~_Oq\346\244\212\024;\247\321\311/\354i\272Z\021#6;4c"
+	.string	"\264\"\267KR\007\333b\275\327\f\202\350]%\r\273\251k\361b:y~\361\340=\207$]\220\001\371N=\345"
+	.string	"\275\364\377\031a\337\004\236\275\375C\340\254k\222\214"
+	.string	"\261\310\025\257pi\273j\357\032\201Ud~\336G\320\324\351n;\365$\223\262P\215\264\215"
+	.string	"\335*&\023\254/\234\374\300\302"
+	.string	"\017\321\266\203\275#\367+]\366;\205]\340\227\330mt\004*\030?\261\320\275 \177\240E\344}\024\307@\371\321\f.&\025j\266\321\236T\252\347\275\213\005Hv\003\203\005<\366U\210\265V=Ux\220\002h\346Ij\023:\256m\376(\317\213\370\247i\273\036\233\222\004\236sa\207\262\220\373\256\035\333\021-\360\3436\004\026\027_\354\226\262\266\345\325S\007\021\033N\365\247\260\354\332\353=Rj\235N\323\371L\341R\016\235\033!\204\372`\n\301\327p\312\016\001\230\002\267\260\324\002#O\230k\227\220\241\r\027y\315@\243[dmi\026\023\345\313&u\335\234-\223\234\202D\032,\216\274\200\336)q\n\322"
+	.string	"\004\353r\027\001I\022\347\n\315\026\241)\022#;e\363\026\245\334HF\221.\307*\322\231\201\202\\\266\244\266\016\2223O\013\200Y\305\252\353\"\024\275\021\032L\300\021\202\337\374K\211\303\230\n\003\266\020\022\244SU[\331\371\245\340\363CZE\306\352\375`\037\207\271\0376&\272\246fQ\2506\004\3209@\225CQ\376\307\377\037\017+E\227\270\370F\260yn\272\310\303\315ZjZ \243\022\247S\250\006\331\311]\327\236C\311\240J"
+	.string	"\f(\365\202I\202\240{\\\tA\350\376*\210\226\200##\r\353\244\226N\230g\376:\251\366c\377n\312v\363\0271{\374@\302\024\254Z\037t\031i\312O\245B\027\230'fq\362\375h5\r&\tS\261\326\001\230\263!"
+	.string	"ga\016\313\303TyW\316v\265\001\2541U\213l\324\377\006:\261ShU~\r\301\347\021,\253!\0304\001\001\003\241>v\352\036\214Fe\212?\2263\330\016\244v\304\201\317\226\360\274N\245\273\357\001\325\361\374\3409\317\302\242\330]\002Y\264\031\244\033\326\211\3565<\354f}\002P\235A\247\305(\203\005v\005@H!\274Kz)n*\235\215U\037t\276=\356~\343c\336\030\337\336\337\177\005\271\204\367\314\304T\340IH\2750#\f\r\025\376\335\314@=\226.\214\204;\032\237\241\210\013s\302\344\n\026\277\203\224\244\227\021\304\222\207j\257\236LjV\3220.\326"
+	.string	"]\203\035<\202\307Q\366L\324FL\227\362j\332\f\227i\202g@\317k\322\350K\036K\213\244\266\330\371~\025\225\361\024\022\361;\027\026i\342G\244r>T[\232t\270\352<Y:\b\340\264\226\230$o`\375\207\"\261\212\300\001\317.\330"
+	.string	"\273}X\245cU\304(\023\213\244#a\270S\033\371\310S0\210|\2767k\340\275c2v\251\"\006\024lB\206\025b\232\330\300\264\337\211\323\025y\246\311*v\035y\265F\207\277\006b1\3173\307T"
+	.string	"\334\277r:\207\311\031\005\344\343\313\324\361s4+\245\300\016!\002\226QH\004/|\250p\021\301\333Q1\246<u\200\215`\203\231a\215]w\034\204\220$C\274\232\257\341C\274n\367\333Z\370\347\017\036\245hQ\263v\004S\242\213\032\027\217\022\315E\303\323&.\032\200?x\215\31165K\255\223\376\335\317\002\037\300>*\255\032d\202\373\b{\b\3009 \267\373y\177.J\320\325\017\020lZ\027\251\003\345#\3422\021\025\326\330U\252<@K\324`\240\212\275\017@\316\362x\351\2360\r\361\262-R\373\360\033\205\363\203\n\212\021\224\2707\370\214>+\355\270\034\322\376\241)\316y\016deJ\021\370H\216B\340\340\376W<\257yb\220\364%\306\016\2162\205,\235\245\013\3740\243tfE\270\b\226\b}\315/\235\271\217"
+	.ascii	"|\363\303\234\273\241S\304\315+Fo\204\240\350\b\026\303X\250"
+	.ascii	"\007\322\353\313,\301`$s2\r\242D|s\340\324\235\017\201D\302\016"
+	.ascii	"2\252\244c\265G\203\021\200S\355\312J\255\t\347\340\231_\025"
+	.ascii	"\246XO\340F\304\264\273\311\177Utj\273\347\271;SG\013Ep\263\n"
+	.ascii	"\020H\037\266Da[1\224i\263\314\316X\212\302\356 \256\226\025"
+	.ascii	"F4v\037,\262s-\331\362\334kK1RI\261\024\320\020cw\340\344\245"
+	.ascii	"D8o\022\021\254\t"
+	.string	"\0165rkD\025\246XS\374}\342U\213\210-\r@\203\324~\342 \003\005\350\265\264\271\003\332\340+\232\003=\245\016\307\224\216n\306j\325k\266%\306\"j\2456\032\331i^\212\263+\367\235W{f\274\016\332{\nC\257\342\260\270\366\252\004\224<z\204~]P\321h\232`+\310\314U\272f\223\f^w\256\377P\351\303\217?&\2151\2764\302=\276\005\260\031D\364\257\275tD\230\033ra\256\342'\3734\316U\034\n.\026\215:m:\331\307l\345i\243\232\273\376\215\214,3"
+	.string	"\243Py\017Y\243\234\302cQ\224\201\267d\r}\024\372\332~\205L\363\247\333\227)\310\220\376\331K!q!H\324|A\375\232i%\245\246\373A\330\204P`+\242\273\330^\213\0205\004xlC\013\227\017\3052\235\f6n2@h\327\"\032v\231\255@\304\tI\007Zq\375d\302W\354\375a\005\314\177\354\322X0KS\001\221xI&t}6s\021\344\202\rc\375i\311\314\026J\346\240+y\246\305\350H\322C\364\f\250"
+	.string	"%\235@\316\372^ \017\245^U\341\306*\244\227\202\006\214\234\267\204;\215\324\004\177\246`\037\242\020\r\375\304\372@A\234\356Jt\333\251\004\242>\247\202W[w\007\310\371\260\t\337\233I\3122\356<T\303\334\366\202;\312u>B\352\330.g\013^\023\257\226\351\023=zZY\350`H\031\374\233\027\213J=\025f\0248\271HX\323'AP\362\245\bB\303\371\244\033Fa\351nL\376S\b\354\3175\253\234\327\2472\020\363\276\\\206\343(\321h\0271\036\272\303\367\327\bOJ\341\263\230\207y\374\366SWc3FC\005\035\324\211\226\231\225\204\207\223\"\344.\220 F\355\350\b\310\"i:1\332\f\255\371\341\b\001\2769\273/\356V\017)\204\315\006Y\347\232&+\212\034x<\215\253\211\316\334ld4\233\353;\013\006\036=f\221\344/\355\210\276"
+	.ascii	"qL\231\254\330v\270\225 Sx\2239\037\245\207w3\366\3335\351M7"
+	.ascii	"c\204\007\002\224*\246\214\331f,\365\020J\220\244\273\1770\b"
+	.ascii	"\032t\315\203\372\212v\261h-\261\322\016`\301T\272\314$\333f"
+	.ascii	">b\325\232\311\215NQ\367\370\303\342\310\033s$D\fC\220\206\301"
+	.ascii	"\232\306\336\233\255l\216C\302}\024\336\363H\307\036\025e\203"
+	.ascii	"\013\214d\345\313\310\211\347\362\300\337\205\215`\b\301\r\""
+	.ascii	"x\371\335$\310>!{\t\315\341/d\\{\300]\026\256\2108\261?\213/"
+	.ascii	"8\370\241\340\\\340J : ,\f\177<>\004{\346\362\343\356\362\352"
+	.ascii	",\030\315L]!P\356\355\020\245\037\346\247*\222\274\214\026\205"
+	.ascii	"u\240y\262\211\215G*\326\367\363/yC\360$\031\330g\270Z\200\251"
+	.ascii	"\356Y_\273r\340Qm\f\215\222\336W\314\220[\253d\026\300\232'\264"
+	.ascii	"\254\203\235\255\243\330i`$\252\241\335\3571!W\300h\351\177\257"
+	.ascii	"\240n\215L\301_\325\345\224\307\030\274\344H\023\314&\263\234"
+	.ascii	"\363W\007N\\\253\321v\277\371\027\222\346\270\372\211\241!\030"
+	.ascii	"{v\005\234\332\345\030Z\b\326\347\022\026\336G\300\365\356\037"
+	.ascii	"\310\334w\237\237\030%r\364\272c\224\273|\343\320\357u5<\n\276"
+	.ascii	"\217oG\350\030\326\331\263nXq\033\r\0334m\361\177\033\344\341"
+	.ascii	"}q\341z\r\303\334\344\340SG?\344\037$\200+\003\""
+	.string	"J\254\377\356q\265\266\025\020\f \313\206\032\230\306\257\217\300x\213&c\266E\336YX\030\200\333Z\024\233\275\300\\\334\251zuI@\240\334\026\337\337X\231\346\t\360/\210\251\002M\220B\263\201,3'3\220\256\276T\346\224y\031$\227v\260\220V2\367&\303\260\200\242\022\201\251\263\002r\266\3065?}L\203\255\333?\336\300\376~\232\313\024\213\310H\336\323\024(c\342\253|\260\265\2345_\314\306\260\277\206J\373d\277\355\212\302q\330?\207/\353~\325\304\235b\305Y}$i\325\375O\300\006\362\357\204\331G\305\205\230\342\267\347f<nA`\226\314\346\315\235\037K>\367\345\200\304\354\216Lb.9\326O\316\372\032\247\277z\021\262\026\355\272\004\240\255\363v\256\314\274\360\242\r\211~\247k\205\223\324|\216j2\231\022\260Z+\242\322\313\332\201\301\034\005\3242q\302\235\215\370\362\304\273\356j\277\270\246"
+	.ascii	"\305\3445KV\353T\254'4\373\250+\351\271,\355\316h5.\n \314L\223"
+	.ascii	"\031\f\376\312\225\031r\260\301R\300}\0333\203x\225nj\353\270"
+	.ascii	"D~\251\266\252o\310T\201bQ^N\275CeM\210\261\265\016j^\021\261"
+	.ascii	"eI\365W\325\361h\373\216\201f5b%\357tM\303\221\200\3451\353\005"
+	.ascii	"\343I\210\350\013\346P\347Z\304\314\300\253\267\023\374\024O"
+	.ascii	")!\370\265\036\203\243mC\361r\013\233\370\261t\"\240\275\320"
+	.ascii	"\177\206\342T\301\353\222i\013>\253\245\352g\261}&\200(~\020"
+	.ascii	"\304\330cy@\253\275\213z\035(H\266\020H\233\374\373C]\337\226"
+	.ascii	"\315\313\003\253\035\376\037\362Ox \374q\363*v\241\242\035\225"
+	.ascii	"m\213\230\216\311\013\354S\265b\343+]\036\343\214\306\205O5\231"
+	.ascii	"\030\006\370Z\274\243H\037:\270\027\2620\377\207\374\207\371"
+	.ascii	"\002\2622\246\032E\325D\3446\362\200z\327kM\343\334\227\242\033"
+	.ascii	"M=\261\200\307\240\033N&\360\363\377\035}\020\312/\324:\326\371"
+	.ascii	"\223\304\210\032K$\377\177{\275\022\257:\275=\221\355/\020\350"
+	.ascii	"h\024K\267g\314\177E\317o\2541\314\332\036\357\332]\256\256\333"
+	.ascii	"b\200\275h\342\\7s\223gjgF;\306\305-:\377\223\362d\221-\357\205"
+	.ascii	"\315\020\303T\211\2274]2\311\247\304\224\037*i^\230\035\002\277"
+	.ascii	" D\203u\377/\243\300\021\233\355\322\345\263\005\364,;\272\227"
+	.ascii	"\221a\356\230\326\335\303\332\364\021\361N\003\2644\3175\327"
+	.ascii	"E~\305\2659\2637\242\372\344\230{*\177\036\333\203\256\377\373"
+	.ascii	"\007\236\246w\016\344U$\271\365\227\374\372\366\221\216\273\352"
+	.ascii	"\350r|~1\360\331\"\355\304?\3729w\332j\026\375\327\361!\247\262"
+	.ascii	"k\325\213O\373\321\370\276\265\266\226ORs\374\334\366\357\366"
+	.ascii	"\033\244\217*\244\314V\261\216/\204g\343\247WP\371ZQ\255\213"
+	.ascii	"\316\243\240\374\030\3175l\317\357G\f\305\253o\0275\260)\341"
+	.ascii	"y\022~\303q\350fs\263\274\f\232}\\=`\362o\225M\200z\036\255\207"
+	.ascii	"\225\333\316\263\210\006K\237\311\3615-\237\341\346u\321\267"
+	.ascii	"\226r4+\233\ng\216\375\255\274?\3103\327\332@\016\236nbV\300"
+	.ascii	"y\351S\337\250\357\372\327\263Wpw)=-9#\033\333^\335\224I\233"
+	.ascii	"M\237\f\233\325\372v\264\314\331c\331<^\333\2070\202\305\336"
+	.ascii	"\t}X\310\2202\177?\230W)we\216}\377\367A\367\023\220\026\200"
+	.ascii	"?\255{9\210\177\304\340\270a\332\265\231\333:\344W\254\036\340"
+	.ascii	"}\204wn\037I\276\356\236[\266H'\273\303\365W\2329G\273}\232\374"
+	.ascii	"\262n\263\217\242\257\212\307~\336\272\301\225\362\271\002yU"
+	.ascii	"u+\200$\357\3523\016K[\2070W\330X\374\354\2739a\327\200\205\316"
+	.ascii	"31:\350g#\016\373|\352\334\373(\270\177K[F>\317\274ZUZ\237\354"
+	.ascii	"\376\371(\034\244\016\301\250\227\032=xG\264\311\366%{\t\036"
+	.ascii	"\027i\266\326\346\007\016\033\205g\306\214\r\024\326\255\223"
+	.ascii	"S>\366@\360\177\245\277\t\237k\374\255\221)\255\333\217\214v"
+	.ascii	"\335\005\266\304"
+	.ascii	"\321\017\033\367\357\356\2634\337 \342\322=#|\270\277p\262]\365"
+	.ascii	"\035b\274\027\226\305\306\237P\373F3\013\307\255S\177/\\DlA9"
+	.ascii	"\242\207\2563\373\260\350A\3437\241^\256\274\n\211F\032\215\330"
+	.ascii	"\323\203\017\375\003"
+	.text
+	.section	.gnu.lto_.symtab.df07b8eb7277b134,"e",@progbits
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"getCycleCounter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"clockCyclesToMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"clockCyclesTo10thMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"clockMicrosToCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"sitlLatencyInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"sitlLatencyNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\004"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\004"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\004"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\004"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\004"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\005"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\005"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\005"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\005"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\005"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\004"
+	.string	""
+	.string	"getenv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.df07b8eb7277b134,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
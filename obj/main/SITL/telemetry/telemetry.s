@@ -0,0 +1,657 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 te\003"
+	.string	"\004\006h"
+	.string	"\r"
+	.string	"\236\352\207\307\t"
+	.string	"\001\342\270\360\367\001\002\002"
+	.string	"\002\001\003\274\205\242\255\006"
+	.string	"\004\376\262\204\322\007"
+	.string	"\006\275\267\374\234\005\002\002\002\002\003\007\b\354\301\314\336\005"
+	.string	"\t\346\273\301\227\n\002\002\004\002\005\n\240\342\234\212\n\013\352\263\360\321\b\f\371\262\376\364\003\r\333\361\237\332\006\016\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"@\315G\315\3606\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 E\375\001"
+	.string	"4\0039"
+	.string	"\b"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\003\003"
+	.string	"\001\004\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\006\001\001\002\006\002\002"
+	.string	"\002\001\020\002\006\003"
+	.string	"\002\007"
+	.string	"\001\b\001\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"\005\025\243\316\2406\200\005"
+	.text
+	.section	.gnu.lto_.inline.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\245\006"
+	.string	"\"\313\"(\220'I\007\177\251\027\276\226\350S\b\276?\360\337u\324n\206\234\307\265&\251\252\252\256\263\255\235+r\264\t\261d\313\235\0023\305\2761\227"
+	.string	"\250\036a2*\270\344\245nr\227Z\342\357T\033)\030\203\3150%\215]\366mJ\302\032|\016\231\017rB\001}\264\364\221\260\240\300\361u\350W\2559I\325\271\212\210\307B`\264\232\231y?\351\233>\216\306\003A\033\034\r\210\001\373\221\373\256\346Af\"|\337\232cdfz\334\026\001\034"
+	.ascii	"\226\013\261+\330\r\027s\224\024\374F4\302\264\256\333\214\225"
+	.ascii	"u\f\026\333\003\2356\301\275\311\027vK\266L2\313R%\304\322\370"
+	.ascii	"\211]\001aT\312\340\263\304j\246\020rp\376\251+:\3436-ys\260"
+	.ascii	"\002\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 Y\345\001"
+	.string	"BD\f\024\300%\035\246\377\277\275\370\033\377?\270Lk\215\220E\266L)\nC\365@0}\243\305\232\365\344\342\3152T?\264t}\244\363H{&\310\246\032\207\002"
+	.ascii	"\b\312\224\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\001\204\004\003\200\004\004\230\004\006\205\004\007"
+	.ascii	"\200\004\b\200\004\t\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 kM\002"
+	.string	"\344\002_"
+	.string	"\006"
+	.string	"\001\001\002\f"
+	.string	"\004\001\374\007"
+	.string	"\006\001\300\005\r"
+	.string	"\001\002\006"
+	.string	"\001\020\020\b\001\002\t\001\300\007\016"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"H\005\021\002\r\237\201u\206\371y\365\315\324+=,\353\002\215"
+	.ascii	"7\200\005"
+	.text
+	.section	.gnu.lto_.lto.ce81aefdce5d1448,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.33.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 \234]\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\276\375\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\007us\350\334\006uq"
+	.string	"\005\001\006'\001,\237\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.ascii	"\335\2620\245%\230\217\203(\361\006P\004"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.35.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 x]\003"
+	.string	"\"F\027$\200K\322\0013\260\026\217\2379H\214\304[\034\306m\267\331m\232\315 \023\021\205V"
+	.string	"\003\324}\357\326H\222\001\205\322Q\307\020\316\024\326\030\316\303\231x\2438\027s\030w\032{\034\347\343\006\271E$\177\330\3052\350"
+	.string	"\374\236P\360\273\025*\374*)\255\257/\374\002\214-\300\257\330\026\021\004"
+	.ascii	"5S\200\346\274\254\201\0018"
+	.text
+	.section	.gnu.lto_telemetryInit.36.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 \3075\005"
+	.string	"\"\211\",pU\323\001"
+	.string	"\355W\340\257_7\227/\346\n,U\205c\304A\202\354s\262|?\tl\257\252\216T\003\366\360\201\n\035\337\332\275S\n\236$\310\274d%\031\362\322\006\265\250t\232\017\225\016\266\034r\352eYS#/{\354\fY\324lO\203\261b?\260\261\263ab\277P\341\263;\t"
+	.string	"X\217\240\223\261\375\310\230\r\272w\331o0\022\316\267\273\032-\307\0161\377\232\0236.r8P\354\256\341\306Q\356x\333\b\333j\233\n\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.37.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375`\201\001E\020"
+	.string	"\266\036nG"
+	.string	"\261&\035\363\220\002G\343\314\251\3643l|\033\030L\032\273\251\255\220\345\362\337\330\316\033&\311\246\311\324\230\266\226\351\017\266\034\264\212;z\004\315\245\277\364;\t\232\337-\350\201<\351~\231r\247\310\232%{o\271S\nZ"
+	.string	"U"
+	.string	"]"
+	.ascii	"\266Mz\2602\353\241\f\3540?/\034\237ZCnG\234u:\345F\226\377\330"
+	.ascii	"%\215L\215\017l\235\212@\226O\020\313\245T`C\007\307\bT\221\036"
+	.ascii	"\260\231o\003S\342J\007*>.#P\203\004\360\363\222\361\330\343"
+	.ascii	"\n\350\212Q\213Pku\374\300\r\267v\333\025lK\260\017#\276\254"
+	.ascii	"\265Vo\214"
+	.string	"\275\321\233\350\241\315O\347\303{7\372\001\n\320|p\201\311\261<a\205\315tT\331\3341\361\360\267W~\314\233\037\262>Za\205\221^d5\013>\r\001\024\243\375\232\253X\335\346\304\241ZC\364\344\324\0322p\003\320\347\307=\350\247<\001\372\031\257\226\273\370\213\316'\341\021\323\364M\3643n\210\005N\212\026\2248\303A\321\241\304\024E\373\224\212\377vw[\t8\300\334\220g\321\257w\323\243E\0017\241\366\005\f\361\337w\324b&K\331\226yrl@\254\001X\216\233\031)\361\307\377\t\245\253-\351\205\347\265\343\2123;l\305\025\341\"\035\t\205\022\252\323FP&\257da\202\312K\225l\016\001\311\340\251\272SG\322\2518\224\251t\342B<\023\016\004\201S%\235\307\251R)\217\333\302zY7\306\217=tBgf\212\326R\356\212\254\210\021\265\235\273b{\356\350\363 CY\027\335V\264\217}"
+	.string	"\215\327\216\377"
+	.string	"\215\273\255c\036"
+	.ascii	"i\355\213\231\351S\257}\253\355\235B\373\252+\241L|/\302\252"
+	.ascii	"\302h@O\241\241\025\253\rV-\247\325j@\212j\300\311\004H\346u"
+	.ascii	"\\\206\241b\030\254 (a\310\303Y-\230&21\301\212q\252\031\232"
+	.ascii	"B\277\272\317\250\203\212\002"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.38.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375`\021\001\235\f"
+	.string	"\206\230T@ o\233\0160D\326"
+	.string	"\216\257"
+	.string	"Lc\203b\257~&\3014\245\332\306\244\016E\255\247\022j\375M\2671"
+	.string	"\245\320 Ae\272-\300\rB\020C\023,\3009\f^C\246\205.X\265\266\367\2262\245A"
+	.string	">"
+	.string	"C"
+	.string	"\322\007\304C\333V\260`\343\354\235\207\221\203J@N\244\354v\224vxv\37043\337\262q\016\245\r\177\323\346I\r\260ex\005v\367\241\247\310\246eF\231\335u\206l\032\356x\333\020l7\260\357\021\177\273\273\326\217\255\351\350\334\037\235~N\253\246S\323\227\"\274H\201q"
+	.string	"ewd%\306\252\200)B\330\336\330\223\355L\373\"n\2629\367q\001\273\037\025\024\273\035\002'\220\016\335\235@<\f\252\034\377)\310\304s\342\036I>w\227\243\276\304H\037\272\264\242\204\013O\252\330\335/\361\032\251\023\244Ds\307I\\\220v=\f\374\021\227\207\004\342\320\377\210\207\327\017$-8\230p\235\\\261;-\025d\007\0242&lX\016\260\313\342\260X\203\301pa\225FU\241\302\250\215\f\t\032\224\346\352\2400\006lqT\027\205Y\326EM]\347o\365\343\324\237\374\241?`\301\235\240\244\237E?\021\333\252\316tT\203"
+	.string	"\322\266,\344C\236\006\031"
+	.string	"i\355\023\303t\241\261\266\324:\315\226\235BW\260\242\2525"
+	.ascii	"\016`1\030\004\227YE\002\242\310\210\033\306\204\0235V\333\302"
+	.ascii	"\013\233\360\33350\215L\234\257\356\253j\3105OoW)\003"
+	.text
+	.section	.gnu.lto_telemetryCheckState.40.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 \307\025\005"
+	.string	"\"\211!)\200k:\300\234lj\324\\\363F\203:`d\257\026"
+	.string	"\377\267\245\335\260x\377\360\253##\212(c{\004\t\025\337\332\275S\n\236\244\307\274d%\025\362\322\005\225\250t\232\016\225\n\266\030r\352eYS\243n\0379\002$F\354.\203\261b\037\260\221\263ac\277\317\241\263;\t\201\226\023\330`l?2f{\336]\366\236F\342}\273\253\321r\354\020\363\237\371@\333\262C\001bw\r\265\215r\307\3336\330V\333T\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.41.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 \374\235\006"
+	.string	"\242\f.2pm\032\003\240}C\255\210\332\207\356\335\226\267\251\324+Z\022zf\250I\201 \262D\354\326\224\034\212\376\335[\020\246\211|\262\334l;H\223[\312\224\002\220\322(\310\r\214\361a\222:e8QB\n2@\3716\232\005\352M\321\341e\006Z5\300\370dU\305']w\003\025\023\321$\332\253\303\232E\353\350\377\333@-\343h\204N\016H~\212\024\224\227\270\221\f\251\255Y\353\rsLw@\364\362W\204\210\374WA\r"
+	.string	"\3540\026\250\330E\016\250\330u\266&\2760n\020k\342#\364\377\265\013O\263Y\333\303\027\313\3231\263$\374/\263<\037\267\271-A[\204\266\237\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_telemetryIsSensorEnabled.42.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"E\t"
+	.string	"\366RB:@\305(\035\320\271\027\357\33433i\306!p\fa\305\376\f\360\004\376\007\332'\325\3246\246\217\365\260\304*\313rt\031E\321i\001}\020\304\304\250\354?\260\336\267\273\233\224)\0051"
+	.string	"1"
+	.string	"/"
+	.string	"\227\023\304C\333^` \271t\257#\365\225\253;\031\260\353a\272z\351Y\362?r\030\200\365\241T\026O\214\303\356:Q\252\213[o\373\300v\307\366+\255\037jZ5\235\232>f \244\245A\300n\352{-\013T\001\261M\2625\2663\355\263.Bz\253\302\002\273\032()\273^\202\0252\207\233\027\304\303\247\374|M=\200.\303\332MB\231\335\355\370$/\341\374\217CO\214\362\250C\177\024\017\257\b\036-S~\266wJ\345\260\177\331\335\265n8>\233\306\2012.\332\303\241\330D\331'\213\310D\030\b\342\341\203y6\016\343\030X\223\3106L\244i\033\246\361Lw\324\215IO\366CQ5\352\273\025\250\251\252\030W\207\021\n"
+	.ascii	"i\331'\323\"\f\273\207\263b\2328TMwA\345\252\366\017\035\314"
+	.ascii	"\230\332I\006"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.47.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\245\013"
+	.string	"\246TLB0\211*\035(\304\243\030\301\361+\240d\364\242\315Ix\fU\\o\331\321\036\n3\203z\202\263!\224\261\253x\004\005Xe\324\242b,\326B\330k\001\245\017\243\020\256\021..IN\n\240\266\211\334)\0057"
+	.string	";"
+	.string	"8"
+	.string	"\232R\211mg4&\213/[\251\027\230 2\223Pk\331\235\256\201\213\337\271\211\376\246\025a$O\337\317>G\022\300\247\345\033\245\242\326\352J\200\233\336\366\306\266\205\375\214\257X\3510\322\274\250(\001\264\235\366\313/0\035F\332\312J\376\201\2126q\352M\345\364r\207\311\351\366\206\211\311\177\231;\365\023\210\227SYS\031U\315%qj\212\312\351\0218\023\250\005\361\356\262lS&\303G\023\333\343c~\374>0 k!{\232\313\362n[\335\225=/\273O-\021\020jMU\240P\tP\007\007.\373c\267\257\240\344\313>3\027\034!\017\310\351\300\b\301O\304mx\037\rN\310\243\270\203!\201\241\007\362>^\330\205<\034P\327\001G\035\006\302\237\310\003\273\360\373\300\216\373Vw\345\273\032\220\314\357\334\021\333s\027\306\001\265\032"
+	.ascii	"i\331\267c\3435j\007]\215\f\310\003#\\\207K\226\021Q6\226`\024"
+	.ascii	"L$f\001\034\tv\210\313s\021\013'\223U\207\226%\257rj\325F\234"
+	.ascii	"\013\326DA\235\366`6\036S\316\273\312\030"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.part.0.55.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375`\252\003%\025"
+	.string	"F\344\206I\3000\2511\374#\332\307\031\234\177\244\020J/s\373aPs\345D\3379\356v\227\3155R\214\214F\207Su\2206\255\362\177\223\021Q\356\020QQ\024E\327%\256]\224\212\261:\b\033+\314wO,#i{\313-eJ\001r"
+	.string	"o"
+	.string	"n"
+	.string	">A\261\371\331\366\t\312\215u?\217zN\024\372H|\335{\326n\253\321u\247\315d1\263\264d\245\036:\237\352"
+	.string	"'\234\246"
+	.string	")\306\022\330\220\217\320gB2\f\261\303\370\tM_I\301\342\220\344I\024P\n\004\330#?>\324Pz%\r\f]\004A\200<rD\213\250\353\306\223(\375\202(\rp\0173\345\336\353\3572\334\037\267\375\302v\003\273\306\004W\203\255\352@\177&,\223\302\313\301!\2438\234K_\267w\226\3303\226\031p\036\371\230AB\252\034w\272\314\376\320\211/\241\324\225p\352JHU\\y\346O\256>V!\356\275\264\230\317d\343\033Ms\262\371YC\240\346\334\035\261\344\326\225\332/\276\351\346g\315\001\334[\244\003\305\275\347\201[#\210\335\372\374Hy\033\273Hyc\323n?\"\244"
+	.string	"\260\r2x,\224\225&\350\365\024> ,Ks\2027v|\".\220\257\025\2026\352)\025\016\255a\255D\333-\345\253\305\n\322x\232\321\243:l\263\234EK\354\336^\002\337\352+\\\374\244[\337b\350un\375\230\362\366\365\306\323\244`\327\220\251\270\243GZ\211\256\036\257\307\3431\314\265\31065-\251O\026h\n\031\336\333s\334\021\206`B\203\253\255\300\210\254\260<x\271-\310\341n03\253\230\324\340r6\027[\004[\256\366\302\342\300\245\246\202\223P3!\361\r\306\206\253\345n7\\\215\366Zds+\tjj\366\353\312\033\317`\253\b5%\363u%\255;\325)\273\312s=y\357\275\264\220\250\026=\303\022\267\016\271\276\026\275\230\262f&\317\217Q\025\022\b'Y\251\373!2\027P\326T\314\206\361\270\302<\230\001E\2501d\304\fc\022M \022L\230\260\260-\006\020\2431\312\003\022"
+	.string	"\024U\225R\330\375\377\377\f\020\037\323CW\b\234`\032\373\250]\306\276\235\025\345a@\266\"&/\200uPsxZr\b\352\334\b\305\337\f\230s\261\212\313G(\352)1\361J-\026\225Z\344>'S\214\236\031M\035\271\373"
+	.ascii	"\004V\023\242\037\266\031\335\037}U\017\225Sb\361`Y\240\271\022"
+	.ascii	"\n!w\325\340\226\023\032\347s\322\331\345\370\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\255\006"
+	.string	"\004\ny\001"
+	.string	""
+	.string	""
+	.string	"\002/\177\017\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 7\177\020\375\377\377\377\003\005.\021$\177\022\272\200\202\002%\177\023\005-\024&\177\025(\177\026\002)\177\027\002*\177\030\005\036\031\201\204\005'\032#\033\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005!\034gistry"
+	.string	""
+	.string	"\005\037\035\001,\177\036\377\037"
+	.string	""
+	.string	"\200\200\200\001+\177\037\003"
+	.string	"\017$\003\004\020\240\276\320\347"
+	.string	"\001d\003\004"
+	.string	"\363\243\231\"\001\242\001\003\006\001\201\200\200\200\001\001\302\001"
+	.string	"\024"
+	.ascii	"F3\f\237\"\343g\372\261\004\303\345w\325\230\344\334\230\225"
+	.ascii	"\316k\254\267Cg\t\323\004\320\003\374\320\252\035;ip\305\022"
+	.ascii	"\257n\020u\r0\234f\247\023"
+	.text
+	.section	.gnu.lto_.refs.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\001"
+	.string	"\001\004"
+	.string	"\005\006"
+	.string	"\001\t"
+	.string	"\n\001"
+	.string	"\003\r\002\n\002\016\002\f"
+	.text
+	.section	.gnu.lto_.decls.ce81aefdce5d1448,"e",@progbits
+	.string	"(\265/\375`\037'\265\254"
+	.string	"\252\022\375<Z0JQI\035\332I\270\235\311\3116g\r<\002SN\362\001\371\261\251\004 \300\344\032\204+p2\361\n\245\347"
+	.ascii	"e#\225\017\346\356\377\367\226I\361yE\266\221\357Z\\\035\034"
+	.ascii	"\336Z\034\307\013\032\206\031\357;\375\265\0342F_\232\277\256"
+	.ascii	"y\246\321L\241\007\362\306e\244I\231d\nd\003\310\003\337\003"
+	.ascii	"9\"\332s[\317u\227Jt\344b\350\347\361=\356\362\267\334\177\307"
+	.ascii	"\225\3429\f\271\227{\357\236\035\034f"
+	.string	"c\304\317I8\327\247\344<\327\244\263\233v\234\232v\334\231v\377\034\035t1\n\023\260\307\2013\305\215\033\260\317~\263hY+\262\002\013*\336\305\037\337\306\027\177\306\327x\344S}\212\307\372\2457\376\325\307\370\033\277\342i<\213\227\361O\377\342\247\276\352\241\336\351\233\276\305\303\370\250gz\251\273|\253\037\372\023_\311_\271w\221\214\005.P\242\254I\032i\342&i\344\214M\0313W\354\t\233\224)\327\212\027\031601Z\222eO\334\244\254aa#[\362\246\246v\311\334\205\334\226t@\346\212YI*\031\273bo\256\022w!6w\r\223$[\225\244\320[\335\267\337XF\222{o\277L\332\220y9s\305\312\262\264p\245\315]\b\215\023\2414wM\023\2631Y\230\204\331\222,\242lzq\277_\300\210\271\202\345\212\351\360\3365ZH\n\271\271b\227y\\\300\327\330\006ou\271\334\264\313\314r"
+	.string	"\330\030\266\275\225~\301\334\257\021w\004t\360V\327\311\025\013\301\2647\330W\033\314\245&&\312\232\275\225\027\\"
+	.ascii	"tAN\330V\f#\037\344g\273\030r\036rh\377}\3050\2603\340t5\237"
+	.ascii	"\314|\276o\204\3746/\344\242\216\312=6\201\223)g\237qpH\355\270"
+	.ascii	"'\355\331\215\366\\F{6\323j2\f-8\266>"
+	.string	"{\036\323\236\271\264\347*\355jy\250\035\267i_\203Y\320\216\265h\307T\264\3432\3558\211v\034D;\256\322\216\227\264\277\031\355oE\373;\321>l\314\333\345.;\\4\277[n\026\307\021\225[\371ZodH\226\332o\207\034n6o\207\234\277\227\376\317\322>?\245\201T\270T\356\022\350V\331\273\213\246\364D\365\331\237\205\356\300n^\240\234\337\246\346\260\246\203\242h\r\200\350\020\227J\373-j\037\363i7\033A{\225\213!w\217\334\260\273\224\340&q\004t\340x\030\266\301\366V\356z\336\fy\323\346\263\207\240\335\035\211S`\265;\360\r\332\257\004\271\333\274\022\344\3745\007\346\305\220\202\373%r\301$\300\306&\344\036\333[\371\263S\302p\302\372\354\312\213!\247\357\205\234\373M\300\203p\367\016\334\177\003\036w\334\301\002\355\216/x\207\034w<\302\337\035\213P\200\373\235\372\003\270_\020:\356x"
+	.string	"\356\236\344\263\3735~\006\356_"
+	.string	"\f\334}C\321\335u\356x\347\327\035\013\271\337\237\373\315\200\373E\335o\352~\215\334\257\t\367{\302\375\026\271_\236\373\365\271_\325\375b\300\375\022\271_4\356\227\204\373\235\200\373\035\341\356?\356x\315\3753\270\277\004\356\277\301\375\001\340\376@\356\037"
+	.string	"\367\247\340\002\367\307\271\177\004\356\217\341\r\340\356;\367,\302\375\203\334\337\002\367\027\200\373sp\277i\334/\232\373\315\341~\261\334/\322\375R\271_)\367;\303\375\246p\277G\367\373\302\375\266p\277*\334\357\006\334\357\002\334\257\t\3567\311\375\016\271\337#w\267\300\375\256\3567\350~\201\356\267\001\356\227\001\356\267"
+	.string	"\356\227"
+	.string	"\356\016\346\356\034\334\035\213\273\3574\233\315\246\373;\300]\263\271o\340\022iP\250\322\372\354<N:F\f|\324\033(\210\017\252\240\036\256%6b\237\217\336\002\016\r\310\326\222\346\013\277K\374\342\333\004!\367T\006>\220b\334\326\354}\304"
+	.ascii	"w\205\203\013\213\f\013<\305\002\267\260\240ES\023\226\022\201"
+	.ascii	"\304\360\313\314\353\002P\234\354\210r,\265;^\2612\344\263\243"
+	.ascii	"\301P9+mb\220\030\n?\341\230W`X\201)5\214]\221\372\354\364?\002"
+	.ascii	"\260ft\362\331w\244h\337\371\24176n\254\"\267\367U\"\241\242"
+	.ascii	"\3661*\310\335\3218V\221\343\243\353\252\351\3157\035\017\227"
+	.ascii	"x\210S\350\341\336\020\030\271\361e\266f\037\217A:\251\023\204"
+	.ascii	"\\\301D\307)\360\022\317\336\3203\344\005\232\217\317x\351"
+	.string	"q\02139^\302J<E\274\224\367&\336[\201\356\336\npSz\020\221\344\262\357\254\320\216\346\317<\332\216\245\0221\332u\222h\367\233\333\304\250\275\367\024N\271\243\224x\374\342\356\rr\357\271\370\n\300\335\363\306\356\031p`o\342\n\3116\335\365\204H\343\363v\034s\357\242\325\320\001VRE\253\030\306\245\325\036\026\267\206?Q\333jh\\\356\375\263\213\305!\b\310\375c\\n\251\275\204&u\267\322j\270\213\310\375\263\213\233\310\301X\264\2222.\211R?\306\245\225\324^Zm\237]$F\251(\356\250\237\275\264*\263\227H)\037\343\022)e\\Z\361\270MTt}M\201I\342hr\207\306\342~r\242\"F\3710\215J\344V\333\373\2161\355(\001\354M\205\214R#\306\270fJ\314'\245&D\344\325\340\244t\205\334E\246\021\bro JE\333\211\203\241\222\271u\\\346\020\213j71\355\r"
+	.ascii	"\247\275\207w3\367\336\303\2757N\024\225r\357\031>\306\244\223"
+	.ascii	"\323\336G \247M5<c\332\373\307\302\230I\031\227WH\2413\261er"
+	.ascii	"\247P\016or\253YE\351\345\360\310n:\243\223R-\314|v\363n\236"
+	.ascii	"\270\340\362\244\335\200v0\304\3408\363\331u\224\264\232_s\263"
+	.ascii	"Xx-qS\323\366hr\2203\220\020\315\264\275\231\234\027\035ga\274"
+	.ascii	"\224Q*w\314j\220\271 \363EgE\232\262\263&:\300\224\277T\202\244"
+	.ascii	"\307\006e6\330\214$\341\301&D\205\006\333\223\207\262\344\252"
+	.ascii	"\006\233\320u\243\322\362YtD\237]T\222q\205\311\325\216\265\027"
+	.ascii	"\363h\017\346[\370\264\037\363,\274\227W\3730\337\345W\270\313"
+	.ascii	"\377\362[\374\271<\023\354\313Gy\025\312\322\252\330\276\274"
+	.ascii	"\223\264\254\344\177y%\277d_i%\263|\371*\237\3452\2636q\310A"
+	.ascii	"\327\215-\027k\366\336\037\004\t\031\232\r\371\231\027C.\203"
+	.ascii	"\234\244\366\034\033\372\255\374\225\273\324\360X\314d)I}\366"
+	.ascii	"\234\030\232\003{_\r\271\333l^\r9\317Y\322\256\315H\371)\271"
+	.ascii	"L\221-\026Y\244,\377L\347M\t\312\321\353\315\224=\230\bC\313"
+	.ascii	"\223\317\256{h\327G\355z\250\035g\214v\234*\332\177\211\373\213"
+	.ascii	"\3352\305\003xq\212\361\371\307\204\374\311t\263\031E\307g\035"
+	.ascii	"\231\336\341\354\320\177\344\303\3562\350\221\344\024\225{\231"
+	.ascii	"\003\346L\325\330g\307\271\241\375\006\345vA9\307\2212\022\324"
+	.ascii	"\303\006\214\222W\221\024t;\212\331\365\031L\tt\223$\333|\275"
+	.ascii	"\321C\336\353Q\370 \377\365B\356\362\211\374\017\377\256[\304"
+	.ascii	"\263\320\023y\255O\342#Q\372\311\222\221M\t\220&\262\023\256"
+	.ascii	"\030V&q\224\340`\301F\344}\3344\2544\323)\2204\331\230d\371l"
+	.ascii	"\245/+\210\274\216+\246\033*7\024\005\242\324Py\355\255\004\332"
+	.ascii	"\201Q3fE\227=W\246y\002<H\26565\265\255\026=\260\212\017\314"
+	.ascii	"4\341\340\221\243\314W\032\036Z\377\206\307\240\265i\261\003"
+	.ascii	"\247aA\313)\354sV\026\005~h}ya-\030O\322\224h\307"
+	.ascii	"\362\214\225s\334\2600\255\257 ]Z\216\025,2\016\3179vJAx8I\323"
+	.ascii	"\343\265\366E\006\r\253l\365o\"\274\231e\245)m?Lk<\01731\257"
+	.ascii	"\311Hl<\356\026\036\236\234\345\236\312\364\200\362\331\3067"
+	.ascii	"9S\246\013\033\355\027\254\230\231\304\244\310K`aV\344&\024\270"
+	.ascii	"\260\031\363\222n\370\2637V>\346\032\271*\323\31022\325]\346"
+	.ascii	"\031\331\31131+9P\236\221U\250\345\031\371)\303\270\314\243\317"
+	.ascii	".\226\221\321Ya\305\254\322\345\242\257mP2\212Pd\355E\216q\227"
+	.ascii	"\031\206\003)3\214\f\225]\\\346Q\271\247v\234\240\2350C\303\005"
+	.ascii	"=f\274\250\321\310\271\310-\232(O8\3639O\341\034c`Y\262\022u"
+	.ascii	"\227YJ\243\361:k\343\243\202v\0373\355>Htf\241\277\260UmIA\273"
+	.ascii	"\317\020\355>@\264\373\360\320\356s\202v\317Lyiy\245mK^\3724"
+	.ascii	"-MJ\237\335\347J\177\320\275\220\303o\362\336}\231\345`\322\034"
+	.ascii	"a\007\027&\237\363\333c\341J:\271\321\251m\221\035\371\354\270"
+	.ascii	"\r\216I\263M\306g\354\246\231|^t\320\251*\263A\343\263c7w\374"
+	.ascii	"\345\266\231\320|S\363\371\273\204\034\263\331\331\242\002\233"
+	.ascii	"\0217\332\357\220\213\2758F\343\005\247\311G\224C\035W\031*\f"
+	.ascii	"vz<\031\201\312\341\322\003\t\365\031\227\301gp\233{NN\224\246"
+	.ascii	"4\2526\355\330\214N\026Z\217 \237\037\223q\314\346\236\203\003"
+	.ascii	"\026U$#\243\035\257\341\026\334s\360[\226(*V\320\216\307t@\314"
+	.ascii	"\215!\237\261\030\315\264\253\322!'L\330\032\026\343\376c\327"
+	.ascii	"\013\016\363M4\216d>c5\314\202\3430x\005\034\206\003\344\336"
+	.ascii	"D\034f\347f"
+	.string	"o\342\356\336\n\356\255 \177]q-\311e\337E\321\370\213\220c0\3175\206\005\313\347\236]\227v\314\274\030\355.1\032fb\343&\336X\200\025\251*\030\340\240x\2455\261\241\375b&\223\313UC\303\344\343\363\226\034\221\252\231\342\263\357\246\264o\240\205}@!\321\301&%HU\362\007\220\032\311.\0338\013\233\275\026\017\266\257\031lE\360\221%iM)<\211\341%-\224T`\035;|\215)m\007\221_\352\212>\273x%\003\377@\201\312\f\013\301CB0E\345\260H\243a\005K\301Z\360\025\214\005g\301P\360\031\256\202\243\340'X\005L\005\227\341)w\211\3150\023\307M\260\023\007\002;b3\034\206\223\\\346\330&Nq\360\341C\315\025\234\023\276\262\3368d\234\262\212Nm\t\331\330\2211a\362\217\025\236p\215a%\271\"iYW\250h\327\231!\301\313\235\032\24760I0\022%V\362"
+	.string	"\231\202\332\372\201\215\350vh\327\335\320\256s\241]\227B{\317\233!^I\256\260\265\317I\230;\2367D\322n\240\321\336\243\246\275\007\213\366\2362\355=G\264\006\367B\016'\363R\224(YY\232k+\207\226\302\026\353\341x\253GY\027\254\317\230\307Mk\226e\231\342k;Tv\\m\371\354=U\332{\236\264+\315p\016\277K\234\343\337r\214{K]@\346,\352\210\001N\310\323XQ\215\266\262\302X\"l6g_\305\255\005&W\216\261B\b\353\302\206\215\326\262$9eK\215\032\030\251\267\006n|\231y\341\302\244tYb\033\216\2219\315\b\030\265_n\201r\343\346\204\212\n\037\365\320\312S\221\321\f2d\306]\342\031W\354\206m(\035\025C43k\366\256\202\301.>\225\b\030\034JZu\013$A\355\001\203C\300\240\312\252\034\274\310\003{\3624<\300\002#J\f\2118\037"
+	.string	"\302\004$p\016\225p\222\030\361\203B\030\034\202\240\025\362\200G!\264)\273\003$z\034{\362\264'\320'\304\001}B\234\232\240\262\231e\323\265\327CqP\b\203\274\274\266B\354=(\326\226U}i\tg/\005\372\324\037\212\323K\331\243\234\2628\216\266h\357\364\t=\350V\264\210\227\177B\243\264D\t>!\005\355\311\303\256)\222\272\3666\260'\217\005|J \345\322S'\355\005\215rzN\200\025\006q\322\026-A\247&\250$t\253W\236\036\232\212\360S\321\022kJDt\364AR\313\263\266$\244Hj\312KK"
+	.string	"\322A[\024\204\023<\324\304\357\207\016%\255\272\b\330\021@,\233\362\202+\t>\027\274\310\003\357L\215\324\026x\264~\340\021Q\300\372\320_\b>tD\217Q\332\262(H\354"
+	.string	"\320K\223J\030\252\300y\277`\360\203\0237\201\006\036\332\025\025zH[\264\005> \005\252Fk\332\246 \024\300y\352\232\002S\237v\016@\034"
+	.string	"D\210$\034\017\341\201\006\036h\220\363\020\036\b\ty"
+	.ascii	"BH;\b!\334\266\351\251\323\2637\")h\002']\321\"\022=^T\301O\213"
+	.ascii	"\372\340\244\275\243V\365\001\203\021HRC\b\216\300\n}\017\244"
+	.ascii	"g\bC\254\020\002\030Z\324h\r\022\235i\213\002\325\336\032\f\362"
+	.ascii	"\316\f\351\331\252\300\n\354\264*\360H\007\030TY\225\227\256"
+	.ascii	"\302\223E\211"
+	.string	"\220V\"\bz\300\243 \t\243\025\375\211h\333`Q\004%X\021lz\364C-\320S\205\020\244>\264\375\005\221\316\337/\345\235\355z\201=Q\234`Q\374\210tk\220U\221\324^\017M\213N\026=\213P\243\363\004P\375!\241F\023\264'\0026`\327 \013LI\364\322\237\t\224U{\273\326\213<|\b\252\0312<p\202E%\300\003\036\021\361\244\347\210v\r\222\020\301\232\252Dj\013L{\252\216\2205b\205\276\237\244\264\007\034\221\266\350\332;BM\234IA\023'x\350\317D\004^\344!i\375\340\023^\360\2400]?\264\301\340\372a\207=}*\02108\224\264\352\bQ#\336\212[\323\236\212\024\\\205\2754i\375\241\352\232\262?I\351Ox\004\002\321\017-\322I{\352\272\246H\301\023\250rhO\034\037Z\"\250\236\276\243\237\020\350\247M\331t\355\001U\023g\213\262\247\321\321\332\236H\205l"
+	.ascii	"x\322\037\312\323i\327\024\t\250\362\326\236j\204\003\252F\372"
+	.ascii	"\004/-\342%\241Fz\307\016\375P$`Pm\321_P\270\246-p\004o\315\300"
+	.ascii	"\246\351\352KAH\177>\240\b#t\bIH\364@\357\027,b\323\265\250D"
+	.ascii	"\332\362D\244\275\240\004V\025\005\002\252\355\tBH\363R\366\350"
+	.ascii	"LZw~)\020\210\026\361\316\244#\364LB\215v\354\032\\\327\024C"
+	.ascii	"\256MY\"\242\340\316\217\006\"\242`{\304\233\200U\223\320\323"
+	.ascii	"wd\"\355\265GB\240\232!\025\242h\317\024ImQ$uM{\033\326`\313"
+	.ascii	"C\211\316`{\204\236>\240Z\324\006\203F\354\311[\201\3323D\013"
+	.ascii	"T\217p\\Hh\210C\005F\200\200\346y@\261\266\251Q\372K\333\017"
+	.ascii	"@\0255\372\300[\331\017\0368\364\202\352\232\nO\"\341\357L\215"
+	.ascii	"\320\225\350\344\255\354\251\262\354\252\301\225`<PPZH!m\260"
+	.ascii	"\336\252\322\036\205 ar@\221\361\331\r7\344\305\222\225\314\345"
+	.ascii	"\\\271\313\037 \356\255\264w\r*\016\216.\202rW\376\001\306\203"
+	.ascii	"\006\215\037\331\207\020!]\322\334\200\302\272j\344\344\017\003"
+	.ascii	"\203\027\250R\t5\312\341\224BffddF\222$\035\202\n\020\006\244"
+	.ascii	"Y\032\250\326\036\022\300\023=\220\242\316\021\022\022\021\021"
+	.ascii	"\005)J\n\n\205a3\224\002\303\215\017\367D\240\313Kr\251\213e"
+	.ascii	"\260Qhr\301\220g\314jl\246\035w3/D4\301\nD`"
+	.string	""
+	.ascii	">\027ZC\261~\227\203\204\234\376\247\306\207\342\270\016\207"
+	.ascii	"\246\374\336\267\234"
+	.string	"\217\264fy\371\002N\373\222\002J\220\345>J\036\004\337\004\311H\346\253\242`j\377\274\t\275\202w\217yHY\360^\024\334a\306\352@%\241\2107E!\304'\222\3609\352F\222\323J!\202\342\374\260\243F\325\350\224H\261\307\313p\376$\330{\013\322}_\032\205Y0\3737l\033\325\302>\373(y\200\250\207\251\004_\310\275\3305\005\na\016\f&li+3\264!M\251\244\004\304~\205s\207(\370\222\243\326\360X\325\315\365\037w\362\375Nj_t\275\274/\030\343\177 \262\310\020\353\307\314\016\253J\002A\264\311!mb\017fR6\336\312\223\263\346\267W\t\310\211A\023uD/E\b\376\265\307\213\032a\254\372\206M*%\312\f1\305+\226\235\304\326\227]\232\250u\217\366\336i\367\024\023\023\214\252Z\026\20415\211\343^\210\337\364x\001\214\202\243\337\211\214\307\376\002\332\207&\374\204\276\037)"
+	.ascii	"<\362\rNl8\247di(\207a\237\353\304\002jq\312q\320\240X\3779V"
+	.ascii	".\211[A\343+\354\332\351\035\306\337K,^\306\233JI<\245$\243@"
+	.ascii	"\226\007\023\206\006}\3305\354k\275R\230\025'\361\344\007\nO"
+	.ascii	"\342-\316\243\304\215p\330\370^~\303=\035 v\205\244*\347\\q\240"
+	.ascii	"\004]\321*\301q\246y]\033\031.\027\201\242S\324~\277\030>\331"
+	.ascii	"\266\360e:\206eQ\363\230=\343N\231}\337S\210\b\017A;\016\t\b"
+	.ascii	"#\\\244`xi\035C\006\302\324\210\002/\225\373 \371\327t\035\240"
+	.ascii	"T\036i\001\301\205:_\374}\244\345(\217t\355\344\307P\216\177"
+	.ascii	"\216\007CG]\300$]#\024\221}\360\006\245:\373\02050N\364\f\017"
+	.ascii	"\260!\210\033K\251]\31357\005\253V\242\025Uy\250\332\231\304"
+	.ascii	"\231\312#\221\271\031\310\245I\212=\002B\255FU\236s\177(\332"
+	.ascii	"Q$\220\343\227X\217\024\3531\354\220\250\355;\370\277\2106e\274"
+	.ascii	"\021\200I\243#\264\013\323\206\212\273\264P\275\202\370\340q"
+	.ascii	"\304\302%\253h\211\225\324\323\362\201G\027\307ClIh\373V\333"
+	.ascii	"\320y\336\223\241\342\234c\234\236\033\327N\322\202u\2700\300"
+	.ascii	"\265tj\300\245y\004B\201\331K\212p\360\263\263i\036\300\223\237"
+	.ascii	"\304\330M\250\332H%\310<\361!Ds\360\334:\302a\275\254.\302\022"
+	.ascii	"\212\253\233f\224*\312\224\362\b\305^\330\240=|#Q\374\001/\304"
+	.ascii	"\323%\332\326\024\303h{$\344\030>L\003\034Q\337\204\320\303\241"
+	.ascii	"\265\307\224\365\207\f\227\325\016D`8\0362\254E|\002{\371\310"
+	.ascii	"P\005\334=\001\326BK(r\001$A\005B\324\212\004\020\233\022\273"
+	.ascii	"\376\001\261\246\240\211\371\230\200\347\032\321\332\215\222"
+	.ascii	"\013\372\261\356\bv\212\005f\262\007\370\262N\263\035\261E\027"
+	.ascii	"+|\314\264P\215\364\034MJ)<?\341n\013\237\017%\376\024\377\372"
+	.ascii	"\313\342_)\305\205JP\314\020\356~\241*r\227!\231\274\233\244"
+	.ascii	"\234\313\276\226)\376/\330N:(\213\277\\j\027\327,0aB0x\360\330"
+	.ascii	"\317\207\214\253\354\353\315\366<0\341\034`<9\256\262\241\205"
+	.ascii	"A34tA\303\331\252\304\327\251\363\214\352H!\213\370n\f\037\275"
+	.ascii	"\033\317\252*\004\031\223\267i\t\265>\331}\354\242\245cl}\236"
+	.ascii	"&4\036\2572\364\207\240\302 \332"
+	.string	"\226gB\305\375\277\254\206><z%\330\212\305/\232\223\374z\274\353\336\277!\373\\\bb\215\204\214\327\2771\001\240\r\247@!\300\351\374\265\202\347\236\222\350\260\n\016\335=g\254\225\222\327\001&\265z\211\254\306\311\353\211\307\"q\202f\344\20315A\324\354F\241\205\313\032O\026\266\177Tux\273\022\215!\361\241a\337\2717\331Y\022\205VF\240\362/\030\264\022\\q\271\231\"\360\244\335\244\367\363m\360\233\316MU0\224'\225z\301}}\274\271\225P\032#|\2222\021\275\216!\255\346&\307\360p\330\0045\026\004\201\250ye?d\364\202\235\217~r\312\254\277\264~~\007\206D\207\366\350I'\253<\n\213xz\360\372\231\261.\265z'\337\360\177\376\364\203\327\r\246\364\214\204\342\t\364(&b\306\021h\240@\024\303\t9\r\310\264\324Uf2\031R\b&R\005\0035\337\254\nT\016\231\363&P"
+	.ascii	"C?=%\217\266l\177\320\\\206'\273\217\352S\242\334\355\332g\201"
+	.ascii	"\325{\261\232!\352`z\311\r;z7\371,\242%X\222\335n\366t\330\251"
+	.ascii	"I\243\033\360\214{*p\265\321\200\307k\b\375T\005\004\251\005"
+	.ascii	"\330\226\247B9\246\362\0313=C8\373\240\0303\222*$\004\244Q\215"
+	.ascii	"+\034\324\033#1n\346\377B\334\006\327\223r\240\217\n\263\235"
+	.ascii	"\n\334\032\245*\343~KM\220\262\240h\365\333\254\r\tI\367v\310"
+	.ascii	"7WQP\3674T\214\213\377>,\252V\214\246\365\0331\232\335\333a\244"
+	.ascii	"~\3622MS\363\236v >\246+R\212S\3249\265\253i\207\255C\036\220"
+	.ascii	"k\236\266ns\021\024\326(\310 \373Vw\211qW\023\327\206\242\234"
+	.ascii	"\355FS\361h\201\031!\235\355\354\2406\006\341\260\017 \221\001"
+	.ascii	"1:\033`\037`\001\246;1\bV\301\303\021\246\322e=l\310\005\245"
+	.ascii	"\r8\001Gy\317\223\254\2236~Y0(\333'P\303\241~U0\255Q\341\243"
+	.ascii	"~c\200E\261\315\363\375\027\343g\317\336N3\027\215\2176I\355"
+	.ascii	"\346~\215\2379v\300\035I\026{2sD\363\223\324G\354\253\023\317"
+	.ascii	"\353_\260\216\024\375\344\375\237tD5&:41\225j\f\373\342\211\206"
+	.ascii	"\013\037\344\355A\343F\356\337\340D%\372^q\356\224\320\300\247"
+	.ascii	"\236\3237\r\033\275\025"
+	.text
+	.section	.gnu.lto_.symtab.ce81aefdce5d1448,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"telemetryIsSensorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ce81aefdce5d1448,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
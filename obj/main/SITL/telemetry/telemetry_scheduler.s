@@ -0,0 +1,618 @@
+	.file	"telemetry_scheduler.c"
+	.section	.gnu.lto_.profile.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"M\005"
+	.string	"\004\007\035\001"
+	.string	"\013"
+	.string	"\222\325\364\213\001\006\002"
+	.string	"\001\373\357\260T\006\002\001\002\002\311\304\253\223\r\002\002\003\002\002\003\314\244\321\316\t\004\245\345\203\324\004\032\002\004\002\002\003\004\002\002\005\364\317\364\307\003\004\005\002\002\006\255\317\214G\007\261\304\241\313\006\002\003\002\006\b\203\377\207\253\013\036\001\001\002\002\t\315\343\342\301\004\024\003\002\002\n\207\232\321\231\002\002\002\003\002\002"
+	.string	"\030"
+	.string	"9\016+\004\214\022\2202\205{\300\026\001\364@"
+	.string	"\b\310\201"
+	.ascii	"0\267S\220\302%\3204O\341^\035\256,0\201\200\233\375r%xE\236"
+	.ascii	"\313]\273\202r\033\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375 \355-\003"
+	.string	"\002\305\r\024\320e8"
+	.string	"<"
+	.string	"\320\024"
+	.string	""
+	.string	"\341@B\366\336\233H)\223\f:\233t\270<\270\263\027,m\337CC\263[\226J\314+=\213\256l\022\200\355\322\270\266\366\242\004\031\001\023"
+	.ascii	"l(,g\004p\315\305\212\030cL\370\020\\!)V\032\002\334\f\006\020"
+	.ascii	"\n\t\022\301\013\340i\200\211\313\306 \023`\310\006\260"
+	.text
+	.section	.gnu.lto_.inline.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\200\005\245\026"
+	.string	"V\337gB\020\2214\034\200\232r\375p\004)\364:\013<\215i\337\271\317\217\305\246s\352\350\276\t\263\277\330\304\355s\232\240,*\362\2565\313="
+	.string	"@1\201B\001\201\023"
+	.string	"Zp\374\201laF\310n\356(e\222)G"
+	.string	"R"
+	.string	"b"
+	.string	"\235\333h\322|\001\234E\231>\347s4\265\372\036>c{\307\315\237\327\347Ks\216Ng\351\252\335\325\0305\2172\263Z\364\335\335\373\376(\277\335\335\354\322_v\227Cmo\216h[s\374\215\246\263vwco\2341\b\230FR\246\"\230\2604\346\320\374\342\342\202\030\304\327\020Z?\254\245[;\316\352\335\252YI\031\3232\242\305Y\255\244\237hy@\242\371\347kv\260\273'\233K\220*\275\375\350\314g3"
+	.string	"*\310:\027q\306\211\340*\025`7@\036\245:m"
+	.string	"\225\266\003&=\203\207\033\250\315\357<L?m\0309\351\330!WA\343K\025"
+	.string	"\360\372>\036\320\246=\2524\212d\035_`\315\031\222(.3Z^\2616z*\306\002\263e\r\327\311\n\214Ax\021\3334\016'\021\037:\234\321\254\364\020\253\222\024\2163\333\241\003/\264zXE\312}U\242\001\006\3526"
+	.ascii	"7O\020V\324\033K\177i\314I\\\217\263\220BB\2133\322!\006\346"
+	.ascii	"\361\022\205\311\n\225\261~t\035\327\361\007\204&0+\021\003\003"
+	.ascii	"L\347m\255\213\342z}\350\257\377\365IO\201\255\\\240U\006\013"
+	.ascii	"\013\204\346\353\n\211\213\202\rm`\r\335J\300\352i\350\023\\"
+	.ascii	"H\274\244\n\213\026\0272w\001\200\222\250!E\206T\rI\n\n\n\222"
+	.ascii	"6\003p\002\231\232\251\272\001\022\240\324)\t[\246,\t\305%E\255"
+	.ascii	"\354o\020z\260\203&\377\030P\347\315:\237\306/\307\333d\306\272"
+	.ascii	"\027\232MGD\007\225\037\371\376}@K_\004~n\373\272\377 {\b(\262"
+	.ascii	"!jo\224\251 \373\004|B\225hIZ.\177\304\030F\207\277iP\357\317"
+	.ascii	"\355\036\336\037@1\370\207\326s@\202 \340\206\021\377\224\342"
+	.ascii	"\3650\232\234c:\303\376d\0252\276\016\031\0366\213\2559p\027"
+	.ascii	"\3372[\331\260\361\t\274\376\224;x\272R\210ZS\203\363\020\032"
+	.ascii	"\350\245\2518\002%f\263\307?{5?&\370\250c\260\265M\234\017\244"
+	.ascii	"[{\250\207\227\007\314\035\036\272\264\215v\305\314;|m\257]\224"
+	.ascii	"\"\266\242\301)\374\030X\277\0167\234\211\315<\030\213\205\345"
+	.ascii	"l\361\305\343\223\036\fl\226\261\245j\357\3346\n\214/\2375\366"
+	.ascii	"\257\373\273\3204\246t\006a\nm\247t2\235\216\343kY\023\303*\212"
+	.ascii	"^J\205\237\217u<\340 \241A\243\302\307\001\365\320T\006v\300"
+	.ascii	"\374\006\013\374N\226o\301\232\027<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\315\004"
+	.string	"\362G\026\034\260%\351\220\214+\034H\030\206\005&\211\032q\026p \304\020!\315\022b7\221I\006+\304\311\321\363\254Ui\204(\020\233\002\207M\2053l\255\273u\370\204\""
+	.string	"\030\326\260\347\304\177\025\0319\310\361\016\205\333\203\271\225e\3542\336k\225\202\351\371a\021K\266\360\223\241m\b\030"
+	.ascii	"\024kR\213\006\254Y\240Di\267\005<\230aF\357#c\037\322\232#\203"
+	.ascii	"+d\270\236\261 2\236\003\b\226\tp\216\3073\274\034\300\213u\032"
+	.ascii	"\256\331P\231\217]\364\035s\260\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\231\004\007\205\004\b\232\004\t\232\004\n\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\215\001\245\b"
+	.string	"\"J!)\2205I\007\340\356\025\271\353\302\265H7\341\210\271U\325\337\351wu\334\225\315i\331\215\340\362\215|\326\267\277Q\263\215\020\271SC\""
+	.string	"\217\344o\207\307\346\345\317Y-g\007\026\247\250\232\265\013?i\375\215v\206\362\222\247\224\337\221\260\220\200a\nJ\311w\326\346\362\361\366\314\026e:k5wz\224:\251\003\005'`\220\331\n\026\250\375|\331^\2428+2\305o\242\314\306-t\343\213\"\002\223Fl\370\006\004A\250\320L\206\266m@\002B\2242=\021\3404\351\034\243\322\024\332\277\003"
+	.ascii	"m\034K\320f\036D\227'p\354\214\3449\304\003\247\006\356\377\240"
+	.ascii	"\266\252\271s*\275P\267\007\206\002\341\235&\002\235\026\032"
+	.ascii	"[\3275\276w0Q+\275\035\216\311\t\270\244\306\t\007\226\361\026"
+	.ascii	"*\037\037*p\371\367\263D\007\3758n\367\251P\234Q\214\333y\252"
+	.ascii	"E\247<\244\363k\016=\365f&\257W\216A\300G\327PXM\343(\311$Y3"
+	.ascii	"r\347\220G\342~"
+	.text
+	.section	.gnu.lto_.lto.872b1b6511de7409,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetrySchedulerInit.11.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"m\n"
+	.string	"f\323HA \307*\035\220\305\204\331 \243\017\3009&s\217gSp\030\311\361\204\331\255\r\bW\201\250Sk1\326\035\007)C\274E\243w\251\b\220\335\205\001\342\300\022\364"
+	.string	""
+	.string	"\n\\\304\321\302\222F6\331;\2453"
+	.string	"6"
+	.string	"6"
+	.string	"\236\340N=~\263\235rg\330N-\332\017\034H\022\024\230\034\220\355n7Y.^\212\376\r\034\243b\241./\024\273k\251b\235\334\363\266!l{\354_\002\366a\277\366\327/\267\314J\303lw5\213\2601\312"
+	.string	"\200\355gl\313\361\005\304\303L\232\302\216\244\254*\270\323\007\355\322\376\200\023\020\377:}a\267\345`\301\356\030\021\326\246\375\361\004&nw%|\004!#M\213\353\264\235Z\270 \240\244\344\314TN\331\335`\343\\N\033\244$\257\362&@\254d\242\354\021%\247\212}mw\327\263\025\037\321\347U\017X/\302\272\361!ih0\366:`\005\221>\225\303\033a\224\300\260\206*\250\206\235\250##\324y\340\250\353p\374yT\260\013\277\017\3542\343^\333\331\242\002b\251)\022\017"
+	.ascii	"0\213J\313>\231\246\2232<\364(\333\nQ\314*ua-\206yA\370L\215"
+	.ascii	"\202\313\322\324\350p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_telemetrySchedulerSetBudget.12.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\235\t"
+	.string	"\266\221B< \345*\035 Ab\242\013K\324\023"
+	.string	"h\337\302\311.\026\251\344\023X\2625\001]\332\206q\325\363$\2714\255\0076\350\013\300\212\212"
+	.string	"\007\301`\007\2440\370l\023W'C\233\354\235R."
+	.string	"2"
+	.string	"0"
+	.string	"\357dN\271\027dN-\3320\006\034\002.\0352\332\356vS\344\342\245\350_\345\232\025+u\031\320\260\273\226+\326\307=o\033\301\366\307\366K"
+	.string	":1\273\036\265"
+	.string	";\243-/\333\337\330\226\343S\304\307N\333\300n\200\264\034\270\323\203\355\322\276\311O\304\303P'\330u\321XvG\0053p\247\036\003\024e\246\232\032\236\323\306\370\312\211\333\335\005_\226a\342\214\220\2402\247\017\257\222\226J\326\3541%g\210\375mw\327\323e?\366\317\303~I7\001\240\321\347\325\017X!\302J\001*Mp4\366<`\r\225@\265\302#E\230\300\260\212j\250\206\335\310BB\324y \251\363$\370\273\250`\027~\037\330m\306\375\266\323\025\017"
+	.ascii	"0\213J\313>\231\246\2232<\364P\332\nyX\265.\254\3050/\b\237\251"
+	.ascii	"QpY\232\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_telemetrySchedulerAdd.13.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\302\004%\034"
+	.string	"\026\261\255G\240ZUc\200\024H\220n\024`IW\236\bx\037\331\334U\352/xA\005\202\223\320=\303\240\275\3223\240J\f\266\216Y\"lyp\317M\216\202\303\365\"D\016\354\335\243\2034$\367\251\217I8\270\311\336R\312\224\002\220"
+	.string	"\220"
+	.string	"\240"
+	.ascii	"?/\375\341|\371(\033Vm\236\r\263\225Xu\260\324^\300\200\367$"
+	.ascii	"\273\347\334\336\226a\006J\177D\205\315\271I:\202S\367\336\004"
+	.ascii	"\246pj\277x'\336\215+\036\273\227\351\313\324\275\306\004\206"
+	.ascii	"p\276\264\361\264\355\027\371\220gSYha\177|\371=!\357\2753\237"
+	.ascii	"\0130_\332\353\230/+\217\363n+\345\371,n\037#x\005T"
+	.string	"\232\361j%\374\360\202\205\243\324\263A5\202\207:u\241\224D\251k\302\275\327\024\250$\343.o\273\202m\232]\306\002U\201o\353\227\254ZQ\202\030\251u\207\t|g\276\022!\261J\242Z\266\215~\334\235\367\336\006~\023\"\334\331\264\302|\371z\250\007x\322\264D,\"\321-\333\310\202\326\035\366\355\255L\266\213\272\347R7\317\225\374\005,\365\316\223\374:\226:\366#\177\316\215?\216\245\206\225\3247.\352\227\245>Mj\227ImZ\352\262\244\266\226\272ZjZR\337\247\226\303\214\0260\365\312xal\265\271XJ'@.\3653\221\362\321'\311x\233\314b0j\030\366\206\213\331\311\212\3100`\016\024\331\330pU;\350XB\262\242\360\312\313\0230\013\311\034\316E\310U#\024\207\024\315j{\270\026!\031\021\231\005\013\245\002f\225\325\254\377%c\265\254\257\252+>\"\266\332\037n\265\223\021\205V\252"
+	.string	"\263v\252\355\362K\326\272S\257Sk\375\222[\"T\325/\031\2536\355TT\310\206\310)R\016\365\323\360\021D\360\234\032\253\217\272u\342q\364\251\351\275f\332C\247\252\311\206B;\305\241\330\034\364\270\367>\020\361'7\232\020\244\023\"\234I\230/\201\206B4\2574C4\252;\302\325\354Nw\313\341n9\023\347QP\321\020\212\234MW\342v\363r\r(g+:\021\3026\242vD\333\345t6#[\221M7+q\0332\232\325rG3\240\037\343L\330r3\035\016\227\233\301\214\367\366V&\007\350\275\370\035+\265Sb~G\ntXu\341\tH\265go\252\326n"
+	.ascii	"\326\275\3677\325\267\324\273\3605 \202U\300\254\236\232\006"
+	.ascii	"\300\r\037A\236\372\252=g}\325\373\312\234\365\347\351\227\304"
+	.ascii	"\3603>\376\nO=\223\033\300\361\202i\211X\274\006\323\316\360"
+	.ascii	"2\032dNB2c~\234\204h\n\324]\250aD\246\024#4#DRXR\220t\220\002"
+	.ascii	"\031\241\024=\021\240%$d$\262\214\302\003\320\337\247\227\332"
+	.ascii	"\206\321b\270=~\210\257\267\343\313&<K\215i\202B\354C\231\024"
+	.ascii	"\023AEB#\223A\201\353\312p7\205\310\341X\336\354\355\354\276"
+	.ascii	"m\247/\223l\027\022,\362C\304\244*\232h+0\202\302/\226\232\t"
+	.ascii	"\311\235\217\2557,\265@\264n\220\273\327z@\323\335J\027\177\356"
+	.ascii	"(\322\243\t\206F&\246\224\"\375\243w\032\234\256\347*\374\325"
+	.ascii	"!\003\2348\253Z\324\310\266j\347\244\333\214\201\002G\346\351"
+	.ascii	"\375s\325\362+\321\200\262\360\337\242Y\322\026I\317A\344\361"
+	.ascii	"\250|\343-\2720X>\0222\th\023\356Gz9\321hj\252\006"
+	.text
+	.section	.gnu.lto_telemetrySchedulerEnable.14.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`c\001\355\016"
+	.string	"\226\333cF\360\222(\035\262$'2\253\363\370u~\262\311\203\213\265\314\260\035I\2077\331V\205\232\321 K\235\201\250\376\206t;\207\035_\343~\363\210\345\031\274.\244U\360\257\376\314Q&\217\245\2329\317\260\365\177\262\367\226)\005L"
+	.string	"P"
+	.string	"O"
+	.string	"\017m\237\236\017\330>\375\331<\036\302\354e.\226\231\217\335\345b\211\177\2372\352\347\177\366O\013T}\206\270\f\331]\020\310\322(\r\270\330"
+	.string	"\001"
+	.string	"\\\221\nh/:>\273z"
+	.ascii	"UT;\021v\327\332\002?\334\333m[\260]\301>\212\261\177;\315/U"
+	.ascii	"\255R\375\317\266\202V\300f\327U\003\2628sF\n\333\007\331\f\032"
+	.ascii	"|\257I=D0\242\307L\r\n\032\276\305w\032\323\220\001\226\365\322"
+	.ascii	"r\263\273#\226\340\371\f\221W\3733g\361=\226r\001\273\257\035"
+	.ascii	"7\273\341\210!x>\035\006 \225\f\031\022\027\261\342R!#\3142F"
+	.ascii	"v\343Q\343Y\202\254\264f\233\303]\234\034\3706\036\212gw\177"
+	.ascii	"\342\323O\331>\037\027\230\210\255\264v\215i\271\320b\204Y\344"
+	.ascii	"2\022h\311!\303\301\322\037v\250\322\b\263/ww\035_\366k\376\316"
+	.ascii	"\003&\035\tC\311I\327)u\250\221\374XD\342u$\024\223.\203\350"
+	.ascii	"t!\345\241\272RG\352P\334\311\250\244\304\211\274\023G\"b\323"
+	.ascii	"\206\316\343P&\223\307\201\302\275\334\370\232 \203\263\212*"
+	.ascii	"\263\023\355\321c\244\022\344\330\035\016C\303\201\234\335}\360"
+	.ascii	"i\227\376\302\364\031\202\t  @\002\303P\371`Q)\356\0333\355i"
+	.ascii	"x\255V@\360N\013\222>\366l\270Q`\346\251\213\005\211]$\273o\343"
+	.ascii	"4[\365\346\302\032Ov\255\031\320\347\fN\367\232)X\321\255\001"
+	.ascii	"!\322d\312\274\\\264\311;\365\245m\326J\241"
+	.text
+	.section	.gnu.lto_telemetrySchedulerSetInterval.15.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`9\001\345\r"
+	.string	"&\032]C \217\223\016\323\005a! \347\211\"*\300\210\216\020J\033r=\311\205Z\362\3306\020\307\200\376\243\277Y\2745\031\222\360\262h\230:\355\005\304\202\\5\240 \026R\324\nP\304e\\\207F\021O\366\2262\245I"
+	.string	"I"
+	.string	"F"
+	.ascii	"\004\254Gw6\214\177 \366\250\017'\251\030\273\213\351\312\273"
+	.ascii	"G\250\331\371O]C\362B\217\027\207C\216\335\335x\243T\270\221"
+	.ascii	"\022\263!"
+	.string	"\200g\002\017\250T^<\365\304\340\225d\002X\260\273N\222\247\341\266n;\202\355\007\366E\001-?\314t\302\3645V\214j\343e\027e%ce\242\212\021\266\277\261\255.#%\034\344w\024\335[\274\002\n\330\221\212\007\230\335\3650\203\353\221\003>\355\233\370\211\356'\222\017\330-\315\300\354~\036Vp=\372{\001\353\361zj2dA\265\270\246\376d\206(W\266-<\005(\201\377\262\211\\\273{\021\217>\211\365xE\020\342$\312\325\223\205\224\242R5\271\343P\rdXA\271\030\345\214\375\205RM\366\341\356\256\265d\337\345\277~\372\255\007 \b\036\220\013[\306\205t4\264\214\353@\2159\037[\346\021\231\220Q\340\200$\214l\\\246e\236\214\303B: \032\306\331@\330G\207?\025\262\r\343>\237\r\333|{\270Zj\300BF\244%Q#/\205j\251\255}\362$[\032\362;\230\240\220\200\001\034"
+	.string	"0\213J\313\276\031\32316\354\265\325\304\300\313\2500)\342\242\020\367\025\343\024b\325\022.\250\340qa\255k@\200\031\032\250BpY\320\021%\304\r\304"
+	.ascii	"W\244\251)\343\227\207\320dU\230+\035\262\326\t\005"
+	.text
+	.section	.gnu.lto_telemetrySchedulerCouldBeDue.16.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`m\002%\025"
+	.string	"\366\250\217K\300\322Q:s!\b\211\020Dx \214\ntHTt\\F\030\003PL\204j\243v\322\007p\227\027&\2123\263\345\365\371S\265\341VB\003a6\310\220 \202@x\024\324m\236}\224^\247O\241\b\246'W'\215\020\"wJ\001z"
+	.string	"p"
+	.string	"~"
+	.string	"\265\326\024?(?\026\020)\265\017\364\240\333\205dnR\353\016\225R\255g\212\033\224\037}\376\204\374X^"
+	.ascii	"\371\321\266\023(\270\031\3673x\363\237\017\357\305T\255\247"
+	.ascii	"ky\216\373(.\305\371\037>V\310\031\322\364H\\\024\021\370\230"
+	.ascii	"pZ\275\235x\322\364\203b\365f\350\212.\0211z"
+	.string	"Z=\235X\022\265b\351\302\323\232\336\f\245\253\225Z\253)Mo\304M\3366\005\33326\r\021NL;\032\304>ut\201\366\305Zk\365\356\330K\335\272\321ORR\217\274\350g]\350\027\371\320_\232zej\322\324\243\251\305\222z\227\232\256\250\037\240\025\364\345\374~\366\351\2547UB*\216qF\217\355\373GG\252\035\206\035\330\350\370\200j\255\254\232\315\372x\373f\263l\217F1Q\023\304\242\016@\021\366\274\213\333\207\\C,\251\273_\t\245\026\310\326\212{\341\r\230\310A\364$l1\262\255\035 \305\243\332e\355\310\036\351\"\013\035>|x\214T\350Z\276\344\362a\320\226]\351\365\244`\255;\006\346\207\030>\276\210\307\356\372lt|A\376\024\024\210\035\342\002]\242 \272\361\245{\036U\216V\331\206]\206\206\262\326\335\002?)C\254\254\265>\305G_\206\374\370=pB(G\253N\201\354l"
+	.string	"\331\005\032\345\345^x\223\263G\323\217~Q1c0\233K6\213\305f/\0025\026\030\027\0164\323&\203\211\324X\314\030L\202Mf\322h1/\222\230i\203\211"
+	.string	"\374R\241\23101\027\314\227W\255\305\003\315f\306L\030\323\346\222\301\\b\256\027\255\346RA\361l\203Is\331f3\232\313g\356b\335\035\257\350i\234Et\304\033\212\344^x\bN@\302\341\3728r\2655\266W\353\225\334\352\306\005\256\270\344R)\036NkIv\334\035\302\373\321=) `\2021\203\271\003_c\034\260\242\320\354C\247\225\0132\342\263}\035\334\001\212\235\263\346\003\262E0\316\323Bl\333\336\313\3678\b\345a\3516\240;\273L\212\215\314\266\263N0\3576\262\021\272\004\3510\022g\277(\273"
+	.ascii	"\013\273\314o\204p\301\205a\2271\242\034\267\307\350\n\323\036"
+	.ascii	"\206\240\234\202/\032\005"
+	.text
+	.section	.gnu.lto_telemetrySchedulerNext.18.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\324\013\245?"
+	.ascii	"*oX\030?@\246N\007\3315\372dK\315\007\3138\0321\016\356\217v"
+	.ascii	"-;\217\177\237\374\210u\310!\005\370\204\320t\016\306\t\276\371"
+	.ascii	"o\211\363\366\303T\376V\250Y\223k\212\2267JzI/i{\247\224Ru\001"
+	.ascii	"^\001w\001bI\227,L\260\316\006\333kW\333\261\264\357\331u>\300"
+	.ascii	";z4X6-enyG\273a\020eokpt\335\246\253\3270\t\301.\346v\007s\333"
+	.ascii	"\353\312\374\305\215\246\325p\233\206\247sm\203Ys<\330 Nv\215"
+	.ascii	"\333\220\277{o\262Wn\301\276\031\236\202\251\273\367*\271\204"
+	.ascii	"{\227\371\241&]\261\2662\r\355\314\035\3551_\035\007\244\225"
+	.ascii	"\356\235\322\247\356\3368%O`{\3458\266\3034\334\027\363T\215"
+	.ascii	"{\232u\333\242\346\231\300{oUT#\205\275\252\315$\354\365\253"
+	.ascii	"\360S\253q\315H\376\325\310&\246%\245$\244\243\243\261-\022\331"
+	.ascii	"\241pU\337\277\270\2034\262\025\022f\020\333\231\226n\322\302"
+	.ascii	"\244\005\213/\3659\257@\235Y\\IE\261D\255\375Z\252\317\251E\265"
+	.ascii	"p%\317\236Vc\305\223\324\241\220#[\272\317\371T\257\024\375\275"
+	.ascii	"\351\2741G\222\242r\006\245\217\324\324(\250s\315\217\353\023"
+	.ascii	"/\306>\347\023\250\323\211\267\303\013lgO\272\330\347l\242F\335"
+	.ascii	"{[\257\245\240N&Nl\260\265f\207nF\006\261\235\251\365P\245\372"
+	.ascii	"\263\003l\250s\211\212<\262\205H\353\265\227\2315]\350PzMkU\205"
+	.ascii	"\022\242N\361\265\375i\315\304\374U\2525:hGfa*\222\257\355O\267"
+	.ascii	"i'3\023\342>\274p\357e'bv\326\f\240\231\333\311\314J\230\213"
+	.ascii	"R\002\317XB\345\307\220\343#\346\212`\364\037,V\371\253\224?"
+	.ascii	"\211\242R\337\347\007\322SL\031\334\232\030'\007^\301?\035j\n"
+	.ascii	"&x\251?\360-m\365\213\337\337\030=s]\302|\220\273\rg\365\236"
+	.ascii	"\037\354\2757\002\267\236\257(\223;\013\020a\257\t\236M\331\333"
+	.ascii	"\232\230(\230\0172\307\205\371\2731\367\325SQ \376)\314\023\336"
+	.ascii	"YB\321\371\352\235\255\212\316\021\214\316\020z\332\374\240\343"
+	.ascii	"4;0:70:30:/0:W\031\235\227Eg\345;+H\2763U\3219A\323iFPt>0\325"
+	.ascii	"f\272\r4\236\346\002]\246[\252\343\272\243\336Y@\313i\206\n\360"
+	.ascii	"\344\004\300\350\2144:7u\232f\246\326y\351\235\225Z\347$\242"
+	.ascii	"3\022\321\371\210\350|,:\033\213\316m\321\231Xtf\211\316C\242"
+	.ascii	"\263\220\350\274\276\263Zt\376\236kv\242sWh\235|\004\364\334"
+	.ascii	"{d\220\321\265\263\276\341\322q\272\247\335x\272\351t\313\351"
+	.ascii	"\236\353N\323C\346\366\343\026\317\326\032?0>\330>>\256P\346"
+	.ascii	".p\217\271\255\263\307D(\335[\317\341\326\343\226\216\0167~K"
+	.ascii	"r\260k\270\363\344\3604J,\356\232Qx\326\301\005\342`\247\355"
+	.ascii	"\206;N\343q{\367\365\306\2569\207\233\216\373M\337q\013\207\245"
+	.ascii	"Q\001\r\370\364\351\236{o\373m\247U1e\356\022E\005\021\r\t;6"
+	.ascii	"\3502\226\310\370nV\257~\022\255PK|f\021>\344\307z\326&\320\233"
+	.ascii	">v\210\b!\366\245\236\370=\326\005\301\263\337pV\3524\005[\r"
+	.ascii	"\016\232h\361\335\026\365P\370\353\017\337\0335\321\254\036\301"
+	.ascii	"\013_=\323|\013\324V\277~\n+x\315\267\244\346\251P}\004\377z"
+	.ascii	"c\320\020\036\306\243e\243"
+	.string	"\013t0\017\242~\036\032\23651\321\bo\365/\365\021\276\3530\213\350\301\037D(\235`\243\177\"\224\316\275T)kD|\267\3664M\3108Yu\355>[w\022.\200iC-a?\227\\\037&\321\212\264V\266\2717f\376\320\211LTx\336{\257Pt\240\212#\364L \"\026\302^\373[\257\247\330\346\300<\032<!f\302w\343\274f\003\355\266|\262'$\333\325d\367\024\273\262O\266?\231\373\262]]v\253i\016m\203M\351/{\352\311\270W\b\177\210\245\310~\302G\355\301;x\b\377\001\320\230\2410\027]\210\245\337\350\371\340\037\020\237h\203_\276\203'phl-L\332cM\004E\271\227-\f\016\346\211\335\013f\200\3017X\360U\317\340{\f\252\374\005\337\n\276\352\225\323\261?0\037|\321\177,]~\343\265\n\307.P\"$\242\264:U\207P\301\037\r\222\333\023sESi\206"
+	.ascii	"\003Lc\311\324\252\341U\205cKKk++\200W\327V\226\332\205\2029"
+	.ascii	"\003C\017,-\266Fc\301\360\0300\\\355\352\302\032\341\325\203"
+	.ascii	"\211\203efa\3450\321\303k\330\205\202\251U\343\204\027\016&\027"
+	.ascii	"\327\216\254#\221\263\226\\\314\033;d0idu\301\360\301\345\305"
+	.ascii	"\324b\336`zU\341\250\201\245U\225\305\325U\265L\362V\016&W\225"
+	.ascii	"\327\326\026WU\033\007\366\327\352\322R\323\262Yeb\"v\301\213"
+	.ascii	"&-[\200\200\347\013`\037\206|7\016T\210\257\351\247 \277\351"
+	.ascii	"?\220\334\336\013O\302R\344\267\324J\264\3007\375\223\236\013"
+	.ascii	"PC\350\016\023\240V~\023j$~h\226\336\215\r|\201\037\220\346G"
+	.ascii	"no\351\013\274\353ep\264\016\017\236+"
+	.string	"\034\211\t\345\231\nvj\351\333\257\225`t\254\364\004\237J*\222\3233-\233\351[M\273Z\332\235\277\244\274V\0229J>\257\023\036\352\351y\365\017\360d|\004\340Y]\247\336\351\311\240\242r{I\257\364\335\024\004\333\340\316\016lR\002\2663`\272[Ez7~\233\2729R\005\370\247'k\275&>\247\321#\324\263\312:=\200'cV\320P\237\374\316\353\265\356\211\347H\216\220\216\376\370H\377\323&\032\325\007\370\243W\247M\270e;\375Q\275\273\202\327|\223l\tOU\210\355NN\317\034\340\325Kh\337\370W\337}\036\274\f\253B\231;#E\214O\214\202\201p\"X\001\200\341\250Q(\306\220SJ\315\214\214$IA\322\001`\002\231)+\333\021\220\2553W$)H!\313\001g\311\007\343(x8\323 )\353\237\344\274>G\376\260\300y\017\005kI\0039\2164?\203\001\316d\371@\300,"
+	.string	"y4\374biy~\017\254\257z\341\337\372m"
+	.string	"\250\204*\035]Gi\\w\311W\034\300\252\222\235z\355kvvi\356\032\026>\341D\225\301\241\252\344\001\232!b\035\332)\344\200\212\353gx\202\205\304\317\303\217\241\004V\303\324\332\032\002/\321\222\2528Jh\370#\345\023e\225C\366v\fy\t!\020\"D\264\360\301\217)\271\327\307\004#\253T\242\r\211\021\306\"\274\323\204PF\316\362JhZ=\330.\006v$\316\036-{~\361\021\334]\344Jmn^Lm\230\312\30782\271\371m\263\233\2310\315z`E\f\311\f v\340\b"
+	.ascii	"G\230\337\207x\211\202\177\033\262@\325\026\351)\203Q\335a7\234"
+	.ascii	"<\206\005w\250g\273\3629\034\235\271\351\2152\005%\221Z\353\026"
+	.ascii	"R\320 \342tf4\312\005\221\210rq\250<cb!\202{uT\370\277[+\221"
+	.ascii	"\234\257H+\210\312\032\324g\202`\313\201vy\370\313A\333\364\377"
+	.ascii	"\313\351$Z\300\230\001\212\202eG\352\220@efd\255\373\365\367"
+	.ascii	"\" \270G$EV\005\314K&1\312\322\272+\306ba~\n\361\334\306Ab\333"
+	.ascii	"=D\343{\337\322\230\227o\305\f,\272W\200&\215}A>Lk\261P\255\030"
+	.ascii	"\n3\203i\2308\274K@\246a2\001\231)d6\004R"
+	.ascii	"\032\001\314\2068J\245\225F\023\345@\304\253\374\275\342t\234"
+	.ascii	"\231\333\200\362XE\027\225>\223$\035\374\262k8)@-\001\360\271"
+	.ascii	"\024e\013\301j"
+	.text
+	.section	.gnu.lto_telemetrySchedulerSent.19.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\330\004\345\034"
+	.string	"v\360\256I\240\230Q:\200\361\265,\231\360d5\2561\201\031\356\363tM@'/\260\210r\255\203\347\370\025\340o\237\316\370oe\372K~Q>r\035\234K\274\346\211\261>\035\361\025|\304j\0019E\234\202\306\325\333F6\331[\356$\003\223"
+	.string	"\217"
+	.string	"\246"
+	.ascii	"\367.`\t\343+\017\375d\276\221\037\321\375\247\342\003\356e\032"
+	.ascii	"Cu/p\001?\030_\031x\035\361u<\216\370\312:\346\254\003\235\356"
+	.ascii	"\241\232\034Am\335{g\215\343\272\303^\243\025+\355\251\343\333"
+	.ascii	"\037\251\277x=\242\303\016,\371h\374E\203\362\004\177\340\007"
+	.ascii	"\214\031s\264?K\276\244[\244\213\260\036\322k\200\036\213\251"
+	.ascii	"\025\223\362\334{c=\243\331\324\200\222\226\030\277\202\221D"
+	.ascii	"{"
+	.string	"\2047\260.\365\331\242\267\233\323\376\334{y\362z\276s\354\314\334\203\231\205\230\251S\342\353\033A\216_\321\354\372\344\301S\022v7%8\254wd\by\2622\232k\230\201\273\331M\314\247\267\231\230\355d\23599\347J~\034;\371\346Q\277\354\277\037\300\223\3740;\331\332\311\242\235\\\355dj'\367\234<\305\311\337\211Q\t\025\f\357}\321\305\346r\251U=\230\371\374\251?\021\272\023\356*\254!_\022c\362 \212/a\013e\266^\231Q0\307^g\214\231;j\250\b\005%5&L\340\221\350\236\204\251P\001\327\350\006\217\352\006^jW_\026\327\317vSw!k\025\231\255+a\212\035V\020\324\004{\"m+r$\360\244\035PxZ|\305\005\224\215\272A\314\351O}\2000\b\021\232.7\235\323;i\216\332t\323\276\351?9\005\342\305\214\020\251(\037;\016\327Bf\301B\373\365\353p+d"
+	.ascii	"0\f\234\272\273\n\213\310O\326\314\036^e\250\372\206[\314$N\205"
+	.ascii	"\026\301\351\336\353\240\374\024\0212\255\341\020)!n\\\233:\202"
+	.ascii	"\253!W\215#\255x\341\203\302x<my\317\376Q\233\242\331\305\314"
+	.ascii	"%\036\3056\336{\033\360\251B\334F\035*\002<\302\247\264\325r"
+	.ascii	"3\240\233\315v\243\025\b\312P\332j\030r@%\016'D\223\345\202n"
+	.ascii	"4j+s5\372b\232\017\2564!\004\242\034A\013\"\207p\271\322V\232"
+	.ascii	"(s3\240\232\007\333\214\206\013\232\371$\340\333\211\0227\313"
+	.ascii	"\335n\270Y\fX\364f\222\372\330$\n\227\242\336\301v&N\003h~\260"
+	.ascii	"\302\205y\036\327&\342{/\321\253\233\370\244\250\323\037\236"
+	.ascii	"\304\0049\303\317\220:\375\340{\226\324p\215\266\313\220\325"
+	.ascii	"\227E\346<-\261k\333n(\026J;\r\037C\276~\210\t#vO\230\337\220"
+	.ascii	"\254\276\254/\001h\250q8\005\221b\310DDR\220\222$\035p\002\231"
+	.ascii	"\261\263\016\021p\271CT\244P*\345\001E#>X\351\323H\242sp~\302"
+	.ascii	"\302\005?\207aW\177-'\3611%\r\224\202\251\222\0062\251d\310m"
+	.ascii	"&@yH\017&\321`\223)\017\311\200\323\207\303\360bo\326\313|M\223"
+	.ascii	"\342W\251\273\213\207J+\367\306W\3360\310\3227\020\377\006\273"
+	.ascii	",\360\367\270n\004X\217l\263\350\235\222\025\2416\352\321\030"
+	.ascii	"b&9\316\2361=\216\001\365\353\003$\254(\227E\270\344\357\220"
+	.ascii	"0\275\244\226\020\004\022\304\203\253\207\216P&W\265\314W\251"
+	.ascii	"\017\365\021\367\370\007D^\004\354\371\232'\372\303h\231H\332"
+	.ascii	"\006U\201\021sC\244\365~\243S\233\037\0360\272HX\350\026\263"
+	.ascii	"\351\006\220]\275\333\222\030\004j\236Q\003"
+	.text
+	.section	.gnu.lto_telemetrySchedulerCharge.20.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"}\013"
+	.string	"fUMB \2138\0358\357S\223S\n\214)\024\212\t\206<blHNBN\203@\300\200S\225\216\314\020b\347:1*5\272r\006Pp\004\220Ht\260?\t!\342\372\003\300\002a\256\356\031\375\311\336r\247\0249"
+	.string	";"
+	.string	"9"
+	.string	"\323\237\255\341!\203=\n\203"
+	.string	"\224\207\335\305t\301\277K\215\237O\321TF\340\347\362:p\215"
+	.string	"E\362\262\273?=\016"
+	.string	"C1R4\273\3538\002\r\334\363\2667ls\330\277\b\026v\013\254B\254jNp`\373\026\3331|\204\357&S\220\022+J@ \265\273\030k\\\237\027\371h\377\301!|/y>\261K\312\220\332\r1\316\270>\035\276\302\372\274Na=\237\250\356XW\220\323\005Q\004a\273\273\204\016\206\217\002pr\355\356\033x\254\317\353D\320\341C\t\024Wv\370\211\252\300\276\334\335\265\222\354\233~\371\322\257\032}\212eC\205L^\267e\262\342,\303i\233N\210&\222u\036\0018O\343h\033\315\303HF>8X\306uX\306\302[\211\306a\336\266q\230%\334\313U\222;8\250@\032\222\262\022\245\252\332\233I\374\310S\003\027"
+	.string	"0\213J\313\276\031\323%\266\261\225\025\350\003\213%J"
+	.ascii	"8\001;%\214\225\203\201\226Q\002c\255\270\306\036\303\274@`p"
+	.ascii	"E\232\232\002\334%`\300\241&oW)\003"
+	.text
+	.section	.gnu.lto_telemetrySchedulerSetInterval.part.0.23.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\024\003\005\025"
+	.string	"\226\344\177I\300\322Q:r\001G\001\027\246\030\200\221\343\033\374\250-\305\2666\361\360Qp\240\224\b\r\037\217\fg\246\200@\363\247\264\345_\bm\335\322\021\243\334$\310 \250\263\213\n!^+\2406\005\242\340@\347\343\003\344\223M\344N)c"
+	.string	"m"
+	.string	"j"
+	.string	"\273\016\304O\023P\312\357p\377\2011\260[\034\235\245\264\317\342>\271\377\300\274dWGHow\207\340\323\f\304O\357^ \374\024O \374\264\337c\033\247s\316\366\361]\211=\017D\215\020\324\356\262>\225\304sW\t\346\374\027}\304\346\006\303\225\344f\303\345\200\203\251\006\273k\221\303=o;\201\355\321VY)\216\364\377~\245\253}\037\306c\3702\276d\325\317w\363\335Lf>\364^\242\022\316&3I\366}q\366\031\202\360N<\355\256\204\033\375\205\337\263\352HG6\271:\262}it#8<\023O\273\273\325\247!\210F\266\252\350~\021\316V\251\f\312\023\r\335\300\241[O\212\312\013\341v{\243\263\2668/\367 \373@\001;3\302Co\003M7\246\242"
+	.string	"\375T\370H\265W\316t\233@>(\333/\257\001{\320\216\335]@\3414b\001D\370xvW\301\f\0133\037\205-\374|\357\327\341\321!FF\371\300\257R\277\364\00799M4@dd\224\324\035+xpU\307NI\213*\235R\3510\224\236\027\372\301\357~Uiy\242\377"
+	.ascii	"JVL\273\032\242\206l\210\231\024\256\226\234\320\222\261\261"
+	.ascii	"\226\2422\256\310\\,/\225K\204\026\327\013m\254\311`$\261\261"
+	.ascii	"\006\003G\374:\241\215-6\225\221\345\345\322\272@\253\215\261"
+	.ascii	"\261e\254\261d0W\214\365\242\271\260NV\236U\030i\254\332lFc\311"
+	.ascii	"\373\242\013\033N1*cU\335\261-\252\335\272\016\327\314\201C{"
+	.ascii	"\330\374H\251\030\252\324\224\206DhVL\r\3655E\354\327\235F\024"
+	.ascii	"\240\037OI\250qD\247\230\"#D\301\004IRPh8\200\002!+\353\006\021"
+	.ascii	"\260\301*\333\202\302\302f y\320\017\250\374\235g'ZR\314\026"
+	.ascii	"\035\3672\355\244a\2002\207/s\003\244\362Q\214\240s6\n\367\240"
+	.ascii	"\231\357\033i\320\350\220\253M\237#%\371\356\361\364\367\314"
+	.ascii	"\271\2611\261\356\020\267})\334\023\200e\265BI\034\025\362\026"
+	.ascii	";\227\177\013c(\254\354s\350\336\0021\r\361\257\360)\331\020"
+	.ascii	"L\352M\262\231\357\036\361U\005'\302 X\334\351\033\222\223K\332"
+	.ascii	"\245&n\236\201\240H\265\026\177\342\363\003"
+	.text
+	.section	.gnu.lto_telemetrySchedulerCharge.part.0.27.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`\017\002\355\020"
+	.string	"F\037lE\340\224(\035d)$Wp\370\211S\\\f%\021\227\251\3604N\260\305a\360\351\341\2242\210~\376\277\252\246\257-x|}\2233\212\031\360\300\f'\270\362)k@\217*1\256\bb^\223jU\322\310\336R\246\024R"
+	.string	"Z"
+	.string	"T"
+	.string	"\231\366c\274fu\233\324\003\354\306\206\350\354z\006\036\255`{\264w\025\355q\273"
+	.string	"\355\321\376\013\333\252\227W6\221{3{Y\220\016\262%\273\313=*\212\257\256\tW\376g?\361"
+	.string	"\333p\005"
+	.ascii	"\023\361L9\3740\330]o#\356x\333\007lG\260s\0037O\373\276\215"
+	.ascii	"\327\360q\3743(\007\007\307_\250\205\262\037X4:\020\266\337\250"
+	.ascii	"\034jyK\363\272\341\357\033\263\371C\005\207\"FvW\364h\007\333"
+	.ascii	"\354\376Le\203@\326\274L\345-\354e\225\361\031\253\323\360\016"
+	.ascii	"\210\262\255\023 tv\267\301\366\030\202\231\367T\267I\r\3606"
+	.ascii	"\346\345\004x\\,X\331cU\250\005x\\F\354\323w\374m\273\213\300"
+	.ascii	"\317\241\341\305"
+	.string	"\247y\364S\332c\352\277C\027-\2240\251\201\311\236T\031+<\\\215\3310\275\375\346\376\300\264\366\234;\3024\274\354W\230\316{\377A)\013`\354\206\350i\262&\342\316\212\347\374\001,\243\2240J\324\251D\202'&\255\230\272\226\227\t\035\005\322i\224\301\204\352\\\272\226\016\305Y\250\300\342\302\221L'nE\344\322\205\316\304\241J%\023\227\207\2531?@\342\003FYVU\031\333\233\362\360\2472\363\331_\002\b\211\217F\3354A\017W\022M?*\222\271\216`\270\016MSH\212\032\250\251Q\003/ \220\002!\254\252\003\240\242\320\267\317F\032A\224\f\203\366$9<G\240=bd\324\342\301F\177\212>7\271W\341=\240\360\263a\2305\243\025e\027\210\365$\207_A\036s\331\206Y\3745 \303\353\322\344\216\216Ym\306x\275E\250\217\260\f3`\241\310\236\2330B\222\351C\353\002\333y\327\262"
+	.ascii	"\362Bw\372\246\237\320\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\335\004"
+	.string	"\244\006R\001"
+	.string	""
+	.string	""
+	.string	"\002\027\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \033\177\026\013\177\027\272\200\202\002\f\177\030\r\177\031\016\177\032\017\177\033\020\177\034\022\177\035\356\372\2508\023\177\036\024\177\037\001\025\177 \377\037"
+	.string	""
+	.string	"\200\200\200\003\002\013$\003\006"
+	.string	"\261\217\205\227\001\001\242\001\003\t\001\201\001\342\n\003\n\001\002\001b"
+	.string	"\024"
+	.string	" \212\241a\241\354\214\256\205>\3412\\\366"
+	.string	"\355\340\273\036\304\032\ra\3007\3007\3007\300\237\235\004"
+	.ascii	"7\252\n\b8\006\250A\263\323\t"
+	.text
+	.section	.gnu.lto_.refs.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.872b1b6511de7409,"e",@progbits
+	.string	"(\265/\375`5\024\355]"
+	.string	"\032\232\344!S@\220\312I\007&\203\261\255\244\205x3\371\231\271\\I\240\241\345\307\316[\231\240\031^\2729s\307z\356zj\312\356DS\030\320\037o\250>\365\362\373Lp\270]4\226\317\0334[>\247\330\307\241\236R\202\311OH\377\023\225\213\300\370\307D\213m\245L\001\276\001\013\002\034\002{f\327\254\232M\263b\213f\303|\305\354\230\327\264{\252\273\277V~\245/\232\305\262\\vIF\301\327\232\334\211*;6\264\353\326*\343\325\235\036\305\277S~\023(\026\315R\3311\021R\335Z?\006\030\326\335P\316u\247HHHH!\220\220\220~\220`Yy\025\325]\343%\263e\276k\253&4\265k\265{\270k\300\320\256\001=\312$C1^\375\"1\277B\314E\256\007^"
+	.string	"[u&4\344\301\305\f\327\257\224\371\032\346zY\263\025\273r\2774\021\021\332\034 ]\270\336g\326\360\271\222w&\363\037\230\233e\265\254\330\321n\371\222\355\225\377L\245\235\374a\213\363\203\214\353_\230\337#\036\321\036\361\236\201Y\300z\340\325e\013s\323\005[1\243M\336\004\212\357\204a\375\325\235\022m\310\023%\017\036\256\177\300\374\206}\200\260Fq\037\363k\304\333\2725\342\235\315\242\355\300+Z\017\274\247\353\201gn\007\036\t\t\222n!8\374\254\264\005\350\347\b\3765z\332\342v\001~\326\241\246\016\317\372v\004\030'\361\263\n\377\236M\353\264!"
+	.string	"\360\363\t\377~"
+	.ascii	"\341\313\203~N\022\361\263\214\377t\377\353\376\253)\363\237"
+	.ascii	"\355\277\231/\377\247\371\217f\367\377\234;0N\300\317"
+	.string	"\036\274\347\347\032\266\203\017n\376\354\301\277#\376u\361/\213\177!\370\027\304\277'\376e\340\337\004\376E\340_\022\377\206\3707\350_\363\337\335\377\266\377d\376\237\375W\340\277\210\377\033\374\207\361\377\313\377-\377\002\375O\376\373\363\257\317\277\274\177{\376\255\3775\370\357\366\337\200\377i\377\205\352\352\352\352\376\335\361\337\321\370\207\214\002\273=\340\177\355\035\212\"\335L\332\344\230K\312\206>\270\200>\224n!\207N\273HLn\t\211cg\214\034\322\016\002\242\223B\232\230n\031+\262\271\323\336\236\3322\222@L\221Eb\212\024\026\365\024R\330\235\032\213\210dC\341\022\223[Fb\022i\344\320S-\354\3440\2109\2054\022\325\220\306\"brh$Nm\0319(iKr\303F\236\260\2655C\234j\034VY\303b\321\222\230\"\273\255{\311\250\272x@w\026\262\3306\354\261]\244\2268\244\264\f\221\233v\267"
+	.ascii	"VR\\\310\236Z\022\231 \273\231H\315h+\007\204\351\262\215\354"
+	.ascii	"R($\253\253\250\272\007\350\264\333\252[\270\275\354naw\373\024"
+	.ascii	"\263\322n\027\212\210^VV\335\307\020V\235%\364B\325\315do]\214"
+	.ascii	"\304$\027R\311K\225\244W\257\220\n\327\253\333\266\212fR\b\326"
+	.ascii	"UqL/\243\0168\\\317\322\344\227\022\007\327\364\353\352\352\b"
+	.ascii	"\322\006\013u*\013,\335\355PcV$\256\371H9\343\"[\301\210(\345"
+	.ascii	"a%\204\352h\203\0356)(\\y\312T\213R\304\302\225\245\210\222<"
+	.ascii	"Y\242\306\365l\306T\252\3338Kg\227d\365N\234\034\334\035<V\332"
+	.ascii	"\330\371Y\270t\334[\303\346Y<<\\\261\255\333:\337\271\265sE\316"
+	.ascii	"\215\334\227\233\227\355\222l\275\234\314-\\\335\262Y\264;u\373"
+	.ascii	"f\307V\264\271A\027B\250ml\rKQ=+M\022\273\271\324\374\322\371"
+	.ascii	"7n\341\254\033#AT+v\336tp]9J\3379\035x\305c\332d&\322\311\023"
+	.ascii	".\256 f0G4{\231g\244yn\301<_\231\273%\017\315\235\334vx\373W"
+	.ascii	"\312~\255\333\216X\205l\262\356\224\003\320\234\232\216!\\\333"
+	.ascii	"B\360\342tyQy3\277_e\313eh*m#\004dhH\333\265!a\332W&\334n\320"
+	.ascii	"\315\355\225.\013\306LM\356\204r\321\206~\272\267\322\330v\271"
+	.ascii	"f\002\354e\305\236\306f\0372[\341J\032\327\363\246\314\247\260"
+	.ascii	"O\343\361\2263\0273\255\027\266\350\264`a\363\341U\307|\217\\"
+	.ascii	"2\311W\"\030\313\"\027T<\023\003\207\354|\245\r\021W\fG\350\270"
+	.ascii	"\262\025\306\322\361#\016\022\256\\\345\312\365\032C\246\bW\036"
+	.ascii	"\023\322\202{c\005mI\3315'\306\2342\205\303\266\033\r\036-:("
+	.ascii	"`cXN\300\316a`E\256\256\270r\312X>J\250n\034\2712\225E\0132\224"
+	.ascii	"\323\023f6i\302_\0274W\024\2404s\304\312\244\234\277vm\313\362"
+	.ascii	"P\331\301\225\241\360\fAcf8\252f\210B\224\347\f\021*i\005S\224"
+	.ascii	"5p\345'WZe\221\322\206+;Y\264\241\252-3\255\236\027L%Jx\211\331"
+	.ascii	"WC\274\264\214\311p^\322\306\350G\fJ\270r\f\214\265\333\242\341"
+	.ascii	"\370\206+{]\271M\274t\261Y\023\262\221\343\213\026\327\367T\231"
+	.ascii	"E\212p\022\263\250\245\336\334\3440 \306\301!9'Q\032\201s3\344"
+	.ascii	"\312G\030+h\207\215\032zp\345\256\005\263\241*\007\030#;\006"
+	.ascii	"\004\347&\315l\307z\270\350\260)\2433d\210\232\327\020\013r\246"
+	.ascii	"\244\031c\006\t\302B\314\036\301e\003\036#c^\\g!BF\306t\235q"
+	.ascii	"\345\255\037\036G%d\313\205\267vEwG\314\005\006\342\002k\371"
+	.ascii	"\270\017\326\332.v\037{\247\006N\213\016J\017\021\030\354\334"
+	.ascii	"\371q\326\332@\003q\214\030\256\234\305X\246\2357]\276*\226\027"
+	.ascii	")d\270\276v\231\2576\314+>^q\017^\367\246\310\253b\037\213Gg"
+	.ascii	"+\306q.\276\310=La\367\212\001\321\242\233\353\343\361\350\207"
+	.ascii	"\nV\223)\036\347\036o#\324\375\325\335\"*\224\035Tp\\9\007cu"
+	.ascii	"\251a\205\301\332\301\033\333\221d\nK\231"
+	.string	"N\256\256\252p\025c\035[GH\007\025\0237\\\331x%\021\020;us\026\314\377\037\240&B\2160\341\372]j~\347\303<\377\274\036\026\273;GO\332E)\241o\317\356\321\277a\003\350\257\267k1\3423J$\375\240\236\236\240\232\004\b\306\240\361\324\364\363\031%d\374\222N\247(_\323\257\227\004\fF%}\360\371\242~?\250\237\017\272t\242\320\013\362L\200\002\316@\241~>\"0\235\276\212\236\301\247\363\211\207\376>\2405\316\r\242(8Y8\371\242\240Z\210\250\300\311i\002\017,\320\363\005\001h\357\347\342C\210S\006\220iF\013 \2117\0315P\002\0052\321(\341\002=_ \360\246\036\360\374\2352\314;\220\202\201\024*j\370\\\305\212\006V4\300\273\212\025JJ+R(\231O\241\264C\317\247\036\f\037S\024\n\354\225\020\024\\\002\006\020\354A\177QP-\236N\264\367\343\364\203j:_"
+	.ascii	"O\016\320S\206ST\bD\274\032L\032\240=\247\023\330\364\023\214"
+	.ascii	"q\242LN4b\b\241\237\261\300\241h\234\300$\024\n\n\230\024\344"
+	.ascii	"\203\202b\261\324\343t\372B`\372\235>\301\245\247\023u\361\002"
+	.ascii	"\004\272\024\214a\006c\240\277\363\005\032d\362\001\241KL\250"
+	.ascii	"\357\244\340|\352\241A\301\030>\246\022\200'\372\353\001\005"
+	.ascii	"\203L4*\272d\342\204y:\365\200h\220w\002\332\003B\365\2004Lt"
+	.ascii	"I\005\372\353E\371\\I\251E\00116\260\300l*\001<}QN\347\214\246"
+	.ascii	"\340\322\t@\364|:}'\232\364\3531=%5\001\203I%\220\320 TSm\243"
+	.ascii	"U%u$\nWf3\264\266\206\255-\316"
+	.string	"\\\263\206\337|\270\264\024\335\316o\274b\224\2676\306\032\242\032\223Zr\361\331r\262\225\203+\247\331)w\352\300qm\333P\007\310\261\t\3272e\370\314\217p\bn\031'\314\\\037w\034\375l\346|f\301\274\021Q\216\341\312\313E\333\235\311\223\244\016\257k\255GO\\V\036+2iCK*uF\270>\313\271,\013\247\355\330\204Z\030\326W>ea\340\234\3155\361x\024\004v\003\314\314\3319\355<\306\004\212\307\231P\234\260\2119\2079\2221\223C\3430K^H>\271a\236\2010\036F#WV>\216\231\304U\201\271R\350\270f\216\b\177Y\343B#\305\225\273\004\201\234\250\321$C\314\231\021\231\021\021\221$I\322\0011\005\204\030&%f\035\022"
+	.string	"&1O\"\245fDDh\222\324\331Y\003ZDtQ\276\207W\306,<\253=j\220\234k\226^;F\3006\371\257\377\234\226"
+	.string	"\335\223 \365 \350\205\031\310\306\337E\323^\363\222\036\271\226\213\372\224\272\005\337G\230\022\3578;\356B\323\006i|\360\260\264.to\344\016?\327\013\225Ky\217H\331\230+\363Md;yG\025\004\223\024\004\260\316\204\251<\2052\325\242\"\305\f\021\224\361aYW\273P\007Z\025x\364\362Ne6\262\340jmx\250\026\363\336%\375\211\021\247~\203\3502\210\244^'@\221\265\256}Ee5\032\350t\266\323\003\226J\271\234H\300\004Urj\211{"
+	.string	"D)\002\207\024QD\310\"\322\254\013\234\220\242\225\365\277\221\225\226Dqf\273R\261)\321\253n?\205\001_\326\003\021\263\"du%c\260\321m\221nh\272UrWv\376\317tM\301\373\362\311\206\317\313\263\332\037\250\215\n\222\373\340\210\341"
+	.string	"\003.\231,\370\304\353\374\327\213\203\177\240v\022\026\207\027\325"
+	.string	"m\350+b\006*\250"
+	.string	"i\033C\rN,\b\344;\352\342>\tA\365\024\274;n\370\017\032>pMH\237\n\325\245\210Fs\023\226\363\276@\201:\313Qq\224\355c\306\301r`9_\023\3651\345\327\215\230\271\344b\232\020\374\263\375\016\031?N\206b\314H\032\2370k$*\313\223\301\201\234\033\324m\222\216=\342\201\260J/\037\\v0\331\023\bO\306#\346}2\333R\304\337S<T\376l\306x\3228y@\251,\203\203\022\310\352R\361\315\323\035s\276b\206.\r\2413! I#h\306\311\362\315\0220m\205\214M\024\210h\362i=\020I\243\366T\326\377\300\363"
+	.string	"\004\335\260\333\340\357\311\225-K\201\020\311\202*fT\224\356\234\206\202VP1vx\346\350\235\327bP\321\374\025J\311=o\200T\266\300y\034\254WC\232\330\205\005dn\304\313\276C\030\2413q\357\226,*\300\371\207g@\360\022\337\303h\324?`[\330\240\240c\212\304f\244\340\020c\242\351\002\354\376\305\00610\241\351\t@dH)\224/\330\216~\0253\210\306\225\241r$S@f\234\372\370p\017\306\211\260\371\302\303\017\270vn\323\323i#.\234\f}{\002\3653\376\342\217\363\207\217`\206\f>\276\371A\232+\310\310\360q\302\247\020e\202c\373\206\301'\340\"\177\203\272[=\240\275\272N!\377T\215\273\277\375\311io\203\271"
+	.ascii	"s\241:<XS\243.\332]\242E\234W\316\003\274\271\362\244\375#h<"
+	.ascii	"\347\003\276\342cy\352y,\317Cf\037\361\263\234O\257\343\237\337"
+	.ascii	"e.\242fm\372\343\335inG9\217\220\340 \371$\277-w\321&.\006y\257"
+	.ascii	"\342\253\034\224)\023\356\027xC_my\002\317\333\017\331\320\327"
+	.ascii	"?\317yxu\1776\355_\002g\362\241h&\355\354]\213\377\275t_\325"
+	.ascii	"\253\033\276z>w\276.\3422\273a\347\353\270\n"
+	.text
+	.section	.gnu.lto_.symtab.872b1b6511de7409,"e",@progbits
+	.string	"telemetrySchedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"telemetrySchedulerSetBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"telemetrySchedulerAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"telemetrySchedulerEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"telemetrySchedulerSetInterval"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"telemetrySchedulerCouldBeDue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"telemetrySchedulerNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"telemetrySchedulerSent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"telemetrySchedulerCharge"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.872b1b6511de7409,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -389,6 +389,9 @@ static blackboxMainState_t* blackboxHistory[3];
 
 static bool blackboxModeActivationConditionPresent = false;
 
+// The most a logging iteration can write with the fields selected by the condition cache
+static int32_t blackboxIterationMaxBytes;
+
 /**
  * Return true if it is safe to edit the Blackbox configuration.
  */
@@ -488,6 +491,72 @@ static bool testBlackboxCondition(FlightLogFieldCondition condition)
     return (blackboxConditionCache & (1 << condition)) != 0;
 }
 
+// A 32 bit value written as a variable byte number
+#define BLACKBOX_VB_MAX_BYTES 5
+// 'E', the event type and at most two variable byte values
+#define BLACKBOX_EVENT_MAX_BYTES (2 + 2 * BLACKBOX_VB_MAX_BYTES)
+// A sync beep and a flight mode change, or a logging resume, plus an in-flight adjustment
+#define BLACKBOX_ITERATION_MAX_EVENTS 3
+
+/*
+ * The most bytes an encoding can write for one field. The grouped encodings are counted as if each field needed its
+ * own tag byte, which is never less than they write.
+ */
+static int blackboxEncodingMaxBytes(uint8_t encoding)
+{
+    switch (encoding) {
+    case FLIGHT_LOG_FIELD_ENCODING_NULL:
+        return 0;
+    case FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT:
+        return 2;
+    case FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16:
+        return 1 + 2;
+    case FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB:
+        return 1 + BLACKBOX_VB_MAX_BYTES;
+    case FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32:
+        return 1 + 4;
+    default:
+        return BLACKBOX_VB_MAX_BYTES;
+    }
+}
+
+/*
+ * Sum the field definitions which the condition cache selects into the worst case size of a logging iteration: the
+ * larger of an I-frame and a P-frame, with the slow and GPS frames and events that can be written alongside it.
+ */
+static int32_t blackboxCalculateIterationMaxBytes(void)
+{
+    int32_t iFrameBytes = 1;
+    int32_t pFrameBytes = 1;
+    for (unsigned i = 0; i < ARRAYLEN(blackboxMainFields); i++) {
+        if (testBlackboxCondition(blackboxMainFields[i].condition)) {
+            iFrameBytes += blackboxEncodingMaxBytes(blackboxMainFields[i].Iencode);
+            pFrameBytes += blackboxEncodingMaxBytes(blackboxMainFields[i].Pencode);
+        }
+    }
+
+    int32_t bytes = MAX(iFrameBytes, pFrameBytes) + 1;
+    for (unsigned i = 0; i < ARRAYLEN(blackboxSlowFields); i++) {
+        bytes += blackboxEncodingMaxBytes(blackboxSlowFields[i].encode);
+    }
+
+#ifdef USE_GPS
+    if (featureIsEnabled(FEATURE_GPS)) {
+        bytes += 2;
+        for (unsigned i = 0; i < ARRAYLEN(blackboxGpsHFields); i++) {
+            bytes += blackboxEncodingMaxBytes(blackboxGpsHFields[i].encode);
+        }
+        for (unsigned i = 0; i < ARRAYLEN(blackboxGpsGFields); i++) {
+            if (testBlackboxCondition(blackboxGpsGFields[i].condition)) {
+                bytes += blackboxEncodingMaxBytes(blackboxGpsGFields[i].encode);
+            }
+        }
+    }
+#endif
+
+    return bytes + BLACKBOX_ITERATION_MAX_EVENTS * BLACKBOX_EVENT_MAX_BYTES;
+}
+
 static void blackboxSetState(BlackboxState newState)
 {
     //Perform initial setup required for the new state
@@ -821,6 +890,11 @@ STATIC_UNIT_TESTED bool writeSlowFrameIfNeeded(void)
 
 void blackboxValidateConfig(void)
 {
+    // Streaming is only supported on a serial port
+    if (blackboxConfig()->mode == BLACKBOX_MODE_STREAM) {
+        blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    }
+
     // If we've chosen an unsupported device, change the device to serial
     switch (blackboxConfig()->device) {
 #ifdef USE_FLASHFS
@@ -876,6 +950,14 @@ static void blackboxStart(void)
      */
     blackboxBuildConditionCache();
 
+    blackboxIterationMaxBytes = blackboxCalculateIterationMaxBytes();
+    if (blackboxConfig()->mode == BLACKBOX_MODE_STREAM && !blackboxDeviceStreamCanHold(blackboxIterationMaxBytes)) {
+        // Every iteration would be dropped, the port's Tx buffer is too small to stream over
+        blackboxDeviceClose();
+        blackboxSetState(BLACKBOX_STATE_DISABLED);
+        return;
+    }
+
     blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
 
     blackboxResetIterationTimers();
@@ -1208,13 +1290,16 @@ STATIC_UNIT_TESTED char *blackboxGetStartDateTime(char *buf)
                                                break;
 #endif
 
+// The unit tests stub this, the system information reads most of the flight controller
+STATIC_UNIT_TESTED bool blackboxWriteSysinfo(void);
+
+#ifndef UNIT_TEST
 /**
  * Transmit a portion of the system information headers. Call the first time with xmitState.headerIndex == 0. Returns
  * true iff transmission is complete, otherwise call again later to continue transmission.
  */
-static bool blackboxWriteSysinfo(void)
+STATIC_UNIT_TESTED bool blackboxWriteSysinfo(void)
 {
-#ifndef UNIT_TEST
     const uint16_t motorOutputLowInt = lrintf(motorOutputLow);
     const uint16_t motorOutputHighInt = lrintf(motorOutputHigh);
 
@@ -1399,9 +1484,9 @@ static bool blackboxWriteSysinfo(void)
     }
 
     xmitState.headerIndex++;
-#endif // UNIT_TEST
     return false;
 }
+#endif // UNIT_TEST
 
 /**
  * Write the given event to the log immediately
@@ -1514,6 +1599,24 @@ STATIC_UNIT_TESTED void blackboxAdvanceIterationTimers(void)
     }
 }
 
+/*
+ * A paused log is resumed by the BOXBLACKBOX switch, or when streaming, by the port having room for the
+ * iteration. Either way the resume event carries the loop iteration, which lets the ground station see how
+ * many iterations were skipped.
+ */
+static bool blackboxIsPausedBySwitch(void)
+{
+    return blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode;
+}
+
+static bool blackboxShouldResume(void)
+{
+    if (blackboxConfig()->mode == BLACKBOX_MODE_STREAM) {
+        return !blackboxIsPausedBySwitch() && blackboxDeviceStreamHasRoom(blackboxIterationMaxBytes);
+    }
+    return IS_RC_MODE_ACTIVE(BOXBLACKBOX);
+}
+
 // Called once every FC loop in order to log the current state
 STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 {
@@ -1661,7 +1764,7 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         break;
     case BLACKBOX_STATE_PAUSED:
         // Only allow resume to occur during an I-frame iteration, so that we have an "I" base to work from
-        if (IS_RC_MODE_ACTIVE(BOXBLACKBOX) && blackboxShouldLogIFrame()) {
+        if (blackboxShouldResume() && blackboxShouldLogIFrame()) {
             // Write a log entry so the decoder is aware that our large time/iteration skip is intended
             flightLogEvent_loggingResume_t resume;
 
@@ -1679,7 +1782,10 @@ void blackboxUpdate(timeUs_t currentTimeUs)
     case BLACKBOX_STATE_RUNNING:
         // On entry to this state, blackboxIteration, blackboxPFrameIndex and blackboxIFrameIndex are reset to 0
         // Prevent the Pausing of the log on the mode switch if in Motor Test Mode
-        if (blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode) {
+        if (blackboxIsPausedBySwitch()) {
+            blackboxSetState(BLACKBOX_STATE_PAUSED);
+        } else if (blackboxConfig()->mode == BLACKBOX_MODE_STREAM && !blackboxDeviceStreamHasRoom(blackboxIterationMaxBytes)) {
+            // The port can't keep up, drop iterations until the next I-frame that fits
             blackboxSetState(BLACKBOX_STATE_PAUSED);
         } else {
             blackboxLogIteration(currentTimeUs);
@@ -1756,6 +1862,15 @@ void blackboxUpdate(timeUs_t currentTimeUs)
                 startInTestMode();
             }
 
+            break;
+        case BLACKBOX_MODE_STREAM:
+            if (blackboxDeviceStreamRestartRequested()) {
+                // A ground station has just connected, restart the log so that it receives the headers
+                stopInTestMode();
+            } else if (blackboxState==BLACKBOX_STATE_STOPPED) {
+                startInTestMode();
+            }
+
             break;
         case BLACKBOX_MODE_NORMAL:
         default:
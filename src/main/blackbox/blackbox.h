@@ -39,7 +39,8 @@ typedef enum BlackboxDevice {
 typedef enum BlackboxMode {
     BLACKBOX_MODE_NORMAL = 0,
     BLACKBOX_MODE_MOTOR_TEST,
-    BLACKBOX_MODE_ALWAYS_ON
+    BLACKBOX_MODE_ALWAYS_ON,
+    BLACKBOX_MODE_STREAM
 } BlackboxMode;
 
 typedef enum FlightLogEvent {
@@ -56,6 +56,9 @@ int32_t blackboxHeaderBudget;
 static serialPort_t *blackboxPort = NULL;
 static portSharing_e blackboxPortSharing;
 
+// Set from the port's control line callback when a ground station opens the stream port
+static volatile bool blackboxStreamRestartRequested;
+
 #ifdef USE_SDCARD
 
 static struct {
@@ -158,7 +161,7 @@ void blackboxDeviceFlush(void)
          * devices will progressively write in the background without Blackbox calling anything.
          */
     case BLACKBOX_DEVICE_FLASH:
-        flashfsFlushAsync();
+        flashfsFlushAsync(false);
         break;
 #endif // USE_FLASHFS
 
@@ -181,7 +184,7 @@ bool blackboxDeviceFlushForce(void)
 
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
-        return flashfsFlushAsync();
+        return flashfsFlushAsync(true);
 #endif // USE_FLASHFS
 
 #ifdef USE_SDCARD
@@ -197,6 +200,20 @@ bool blackboxDeviceFlushForce(void)
     }
 }
 
+/*
+ * A ground station that connects to a stream which is already running has missed the log headers, so when it
+ * raises DTR ask for the log to be restarted. Ports without control lines never call this, so on a UART the
+ * ground station has to be listening before the stream starts.
+ */
+static void blackboxStreamCtrlLineStateCb(void *context, uint16_t ctrlLineState)
+{
+    UNUSED(context);
+
+    if (ctrlLineState & CTRL_LINE_STATE_DTR) {
+        blackboxStreamRestartRequested = true;
+    }
+}
+
 /**
  * Attempt to open the logging device. Returns true if successful.
  */
@@ -258,6 +275,12 @@ bool blackboxDeviceOpen(void)
                 break;
             };
 
+            if (blackboxPort && blackboxConfig()->mode == BLACKBOX_MODE_STREAM) {
+                // The stream is read live by a ground station, there is no logger buffer to protect
+                blackboxMaxHeaderBytesPerIteration = BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION;
+                serialSetCtrlLineStateCb(blackboxPort, blackboxStreamCtrlLineStateCb, NULL);
+            }
+
             return blackboxPort != NULL;
         }
         break;
@@ -296,7 +319,7 @@ void blackboxEraseAll(void)
 {
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_FLASH:
-        flashfsEraseCompletely();
+        flashfsEraseAsync();
         break;
     default:
         //not supported
@@ -599,6 +622,42 @@ void blackboxReplenishHeaderBudget(void)
     blackboxHeaderBudget = MIN(MIN(freeSpace, blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration), BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET);
 }
 
+/**
+ * Returns true if the stream port's Tx buffer is large enough to ever hold the given number of bytes.
+ */
+bool blackboxDeviceStreamCanHold(int32_t bytes)
+{
+    // The USB VCP doesn't use a Tx buffer, and reports the free space of the USB stack instead
+    if (!blackboxPort->txBufferSize) {
+        return true;
+    }
+
+    return (int32_t) blackboxPort->txBufferSize - 1 >= bytes;
+}
+
+/**
+ * When streaming, a logging iteration is only written if all of it fits in the serial Tx buffer, so that a port
+ * which can't keep up drops whole iterations instead of overwriting data that is still waiting to be sent.
+ *
+ * Returns true if an iteration of the given worst case size can be written now.
+ */
+bool blackboxDeviceStreamHasRoom(int32_t bytes)
+{
+    return (int32_t) serialTxBytesFree(blackboxPort) >= bytes;
+}
+
+/**
+ * Returns true once for each time a ground station has connected to the stream port.
+ */
+bool blackboxDeviceStreamRestartRequested(void)
+{
+    if (blackboxStreamRestartRequested) {
+        blackboxStreamRestartRequested = false;
+        return true;
+    }
+    return false;
+}
+
 /**
  * You must call this function before attempting to write Blackbox header bytes to ensure that the write will not
  * cause buffers to overflow. The number of bytes you can write is capped by the blackboxHeaderBudget. Calling this
@@ -647,7 +706,7 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
              * that the Blackbox header writing code doesn't have to guess about the best time to ask flashfs to
              * flush, and doesn't stall waiting for a flush that would otherwise not automatically be called.
              */
-            flashfsFlushAsync();
+            flashfsFlushAsync(false);
         }
         return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
 #endif // USE_FLASHFS
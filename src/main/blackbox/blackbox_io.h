@@ -61,3 +61,7 @@ unsigned int blackboxGetLogNumber(void);
 
 void blackboxReplenishHeaderBudget(void);
 blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
+
+bool blackboxDeviceStreamCanHold(int32_t bytes);
+bool blackboxDeviceStreamHasRoom(int32_t bytes);
+bool blackboxDeviceStreamRestartRequested(void);
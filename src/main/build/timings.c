@@ -0,0 +1,136 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_TIMINGS
+
+#include "common/maths.h"
+
+#include "timings.h"
+
+// The histogram has four buckets per power of two, which puts the percentiles
+// within 25% of the real value, from 64 cycles up to 256K cycles.
+#define TIMINGS_SUB_BUCKET_BITS 2
+#define TIMINGS_SUB_BUCKETS (1 << TIMINGS_SUB_BUCKET_BITS)
+#define TIMINGS_FIRST_OCTAVE 6
+#define TIMINGS_OCTAVES 12
+#define TIMINGS_BUCKET_COUNT (TIMINGS_OCTAVES * TIMINGS_SUB_BUCKETS)
+
+typedef struct timingsStats_s {
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+    uint32_t histogram[TIMINGS_BUCKET_COUNT];
+} timingsStats_t;
+
+static timingsStats_t timingsStats[TIMINGS_COUNT];
+
+// Please ensure that these names are aligned with the enum values defined in 'timings.h'
+const char * const timingsProbeNames[TIMINGS_COUNT] = {
+    "GYRO_READ",
+    "GYRO_FILTER",
+    "RC_COMMAND",
+    "PID",
+    "MIXER",
+    "MOTOR_OUTPUT",
+    "PID_SUBPROCESSES",
+    "PID_LOOP",
+};
+
+STATIC_UNIT_TESTED unsigned timingsBucket(uint32_t cycles)
+{
+    if (cycles < (1 << TIMINGS_FIRST_OCTAVE)) {
+        return 0;
+    }
+    const unsigned octave = 31 - __builtin_clz(cycles);
+    const unsigned subBucket = (cycles >> (octave - TIMINGS_SUB_BUCKET_BITS)) & (TIMINGS_SUB_BUCKETS - 1);
+
+    return MIN((octave - TIMINGS_FIRST_OCTAVE) * TIMINGS_SUB_BUCKETS + subBucket, TIMINGS_BUCKET_COUNT - 1u);
+}
+
+// The largest cycle count which falls into the bucket
+STATIC_UNIT_TESTED uint32_t timingsBucketLimit(unsigned bucket)
+{
+    const unsigned octave = bucket / TIMINGS_SUB_BUCKETS + TIMINGS_FIRST_OCTAVE;
+    const unsigned subBucket = bucket % TIMINGS_SUB_BUCKETS;
+
+    return (1u << octave) + ((subBucket + 1) << (octave - TIMINGS_SUB_BUCKET_BITS)) - 1;
+}
+
+FAST_CODE void timingsRecord(timingsProbe_e probe, uint32_t cycles)
+{
+    timingsStats_t *stats = &timingsStats[probe];
+
+    if (stats->count == 0 || cycles < stats->minCycles) {
+        stats->minCycles = cycles;
+    }
+    if (cycles > stats->maxCycles) {
+        stats->maxCycles = cycles;
+    }
+    stats->count++;
+    stats->totalCycles += cycles;
+    stats->histogram[timingsBucket(cycles)]++;
+}
+
+static uint32_t timingsPercentile(const timingsStats_t *stats, unsigned percent)
+{
+    const uint32_t target = MAX((uint32_t)(((uint64_t)stats->count * percent + 99) / 100), 1u);
+    uint32_t count = 0;
+    unsigned bucket = 0;
+    for (; bucket < TIMINGS_BUCKET_COUNT - 1; bucket++) {
+        count += stats->histogram[bucket];
+        if (count >= target) {
+            break;
+        }
+    }
+
+    // the extremes are known exactly, which also covers the open ended first and last buckets
+    return MAX(MIN(timingsBucketLimit(bucket), stats->maxCycles), stats->minCycles);
+}
+
+void timingsGetSummary(timingsProbe_e probe, timingsSummary_t *summary)
+{
+    const timingsStats_t *stats = &timingsStats[probe];
+
+    memset(summary, 0, sizeof(*summary));
+    if (stats->count == 0) {
+        return;
+    }
+
+    summary->count = stats->count;
+    summary->minCycles = stats->minCycles;
+    summary->avgCycles = stats->totalCycles / stats->count;
+    summary->maxCycles = stats->maxCycles;
+    summary->p50Cycles = timingsPercentile(stats, 50);
+    summary->p90Cycles = timingsPercentile(stats, 90);
+    summary->p99Cycles = timingsPercentile(stats, 99);
+}
+
+void timingsReset(void)
+{
+    memset(timingsStats, 0, sizeof(timingsStats));
+}
+
+#endif
@@ -42,6 +42,7 @@ extern uint8_t __config_end;
 
 #include "build/build_config.h"
 #include "build/debug.h"
+#include "build/timings.h"
 #include "build/version.h"
 
 #include "cli/settings.h"
@@ -1219,6 +1220,31 @@ static void cliSerial(char *cmdline)
 
 }
 
+#ifdef USE_SERIAL_BUFFER_POOL
+static void cliSerialBuffers(char *cmdline)
+{
+    UNUSED(cmdline);
+
+    cliPrintLine("Port Functions   RX/wanted    TX/wanted");
+    for (int i = 0; i < SERIAL_PORT_COUNT; i++) {
+        const serialPortUsage_t *usage = findSerialPortUsageByIdentifier(serialPortIdentifiers[i]);
+        if (!usage || !usage->buffers.rxBufferSize) {
+            continue;
+        }
+        const serialPortConfig_t *portConfig = serialFindPortConfiguration(usage->identifier);
+        cliPrintLinef("%4d %9d %5d/%-5d  %5d/%-5d",
+            usage->identifier,
+            portConfig ? portConfig->functionMask : 0,
+            usage->buffers.rxBufferSize,
+            usage->buffers.rxBufferWanted,
+            usage->buffers.txBufferSize,
+            usage->buffers.txBufferWanted
+            );
+    }
+    cliPrintLinef("Pool: %d of %d bytes used", serialGetBufferPoolUsed(), SERIAL_BUFFER_POOL_SIZE);
+}
+#endif
+
 #if defined(USE_SERIAL_PASSTHROUGH)
 static void cbCtrlLine(void *context, uint16_t ctrl)
 {
@@ -4428,6 +4454,33 @@ static void cliTasks(char *cmdline)
 }
 #endif
 
+#ifdef USE_TIMINGS
+static void cliTimings(char *cmdline)
+{
+    if (strcasecmp(cmdline, "reset") == 0) {
+        timingsReset();
+        return;
+    } else if (!isEmpty(cmdline)) {
+        cliShowParseError();
+        return;
+    }
+
+    cliPrintLine("           Probe      count  min/us  avg/us  p50/us  p90/us  p99/us  max/us");
+    for (timingsProbe_e probe = 0; probe < TIMINGS_COUNT; probe++) {
+        timingsSummary_t summary;
+        timingsGetSummary(probe, &summary);
+
+        cliPrintf("%16s %10u", timingsProbeNames[probe], summary.count);
+        const uint32_t cycles[] = { summary.minCycles, summary.avgCycles, summary.p50Cycles, summary.p90Cycles, summary.p99Cycles, summary.maxCycles };
+        for (unsigned i = 0; i < ARRAYLEN(cycles); i++) {
+            const int32_t time = clockCyclesTo10thMicros(cycles[i]);
+            cliPrintf(" %5d.%1d", time / 10, time % 10);
+        }
+        cliPrintLinefeed();
+    }
+}
+#endif
+
 static void cliVersion(char *cmdline)
 {
     UNUSED(cmdline);
@@ -5899,6 +5952,9 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("sd_info", "sdcard info", NULL, cliSdInfo),
 #endif
     CLI_COMMAND_DEF("serial", "configure serial ports", NULL, cliSerial),
+#ifdef USE_SERIAL_BUFFER_POOL
+    CLI_COMMAND_DEF("serialbuffers", "show serial buffer allocation", NULL, cliSerialBuffers),
+#endif
 #if defined(USE_SERIAL_PASSTHROUGH)
 #if defined(USE_PINIO)
     CLI_COMMAND_DEF("serialpassthrough", "passthrough serial data to port", "<id> [baud] [mode] [dtr pinio|'reset']", cliSerialPassthrough),
@@ -5925,6 +5981,9 @@ const clicmd_t cmdTable[] = {
 #endif
 #ifdef USE_TIMER_MGMT
     CLI_COMMAND_DEF("timer", "show/set timers", "<> | <pin> list | <pin> [<option>|af<altenate function>|none] | list | show", cliTimer),
+#endif
+#ifdef USE_TIMINGS
+    CLI_COMMAND_DEF("timings", "show gyro and pid loop timings", "[reset]", cliTimings),
 #endif
     CLI_COMMAND_DEF("version", "show version", NULL, cliVersion),
 #ifdef USE_VTX_CONTROL
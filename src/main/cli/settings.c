@@ -200,7 +200,7 @@ static const char * const lookupTableBlackboxDevice[] = {
 };
 
 static const char * const lookupTableBlackboxMode[] = {
-    "NORMAL", "MOTOR_TEST", "ALWAYS"
+    "NORMAL", "MOTOR_TEST", "ALWAYS", "STREAM"
 };
 #endif
 
@@ -411,7 +411,10 @@ static const char * const lookupTableVtxLowPowerDisarm[] = {
 
 #ifdef USE_SDCARD
 static const char * const lookupTableSdcardMode[] = {
-    "OFF", "SPI", "SDIO"
+    "OFF", "SPI", "SDIO",
+#ifdef USE_SDCARD_SITL
+    "SITL",
+#endif
 };
 #endif
 
@@ -874,6 +877,7 @@ const clivalue_t valueTable[] = {
     { "imu_dcm_kp",                 VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 32000 }, PG_IMU_CONFIG, offsetof(imuConfig_t, dcm_kp) },
     { "imu_dcm_ki",                 VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 32000 }, PG_IMU_CONFIG, offsetof(imuConfig_t, dcm_ki) },
     { "small_angle",                VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 180 }, PG_IMU_CONFIG, offsetof(imuConfig_t, small_angle) },
+    { "imu_fast_attitude",          VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_IMU_CONFIG, offsetof(imuConfig_t, fast_attitude) },
 
 // PG_ARMING_CONFIG
     { "auto_disarm_delay",          VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 60 }, PG_ARMING_CONFIG, offsetof(armingConfig_t, auto_disarm_delay) },
@@ -888,6 +892,8 @@ const clivalue_t valueTable[] = {
     { "gps_auto_baud",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, autoBaud) },
     { "gps_ublox_use_galileo",      VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_use_galileo) },
     { "gps_set_home_point_once",    VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_set_home_point_once) },
+    { "gps_ublox_nav_pvt",          VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_nav_pvt) },
+    { "gps_ublox_rate_hz",          VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { GPS_UBLOX_RATE_HZ_MIN, GPS_UBLOX_RATE_HZ_MAX }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_rate_hz) },
 
 #ifdef USE_GPS_RESCUE
     // PG_GPS_RESCUE
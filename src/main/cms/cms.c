@@ -160,6 +160,7 @@ bool cmsDisplayPortSelect(displayPort_t *instance)
 //   Needs the "smallScreen" adaptions
 
 #define CMS_MAX_ROWS 16
+#define CMS_DRAW_BUFFER_LEN 12
 
 #define NORMAL_SCREEN_MIN_COLS 18      // Less is a small screen
 static bool    smallScreen;
@@ -246,6 +247,9 @@ static uint8_t cmsCursorAbsolute(displayPort_t *instance)
 
 uint8_t runtimeEntryFlags[CMS_MAX_ROWS] = { 0 };
 
+// The value last drawn for each entry of the page, empty when it has to be drawn again
+static char runtimeEntryValue[CMS_MAX_ROWS][CMS_DRAW_BUFFER_LEN + 1];
+
 static void cmsPageSelect(displayPort_t *instance, int8_t newpage)
 {
     currentCtx.page = (newpage + pageCount) % pageCount;
@@ -349,12 +353,19 @@ static void cmsPadToSize(char *buf, int size)
 #endif
 }
 
-static int cmsDrawMenuItemValue(displayPort_t *pDisplay, char *buff, uint8_t row, uint8_t maxSize)
+static int cmsDrawMenuItemValue(displayPort_t *pDisplay, char *buff, uint8_t row, uint8_t maxSize, char *drawnValue)
 {
     int colpos;
     int cnt;
 
     cmsPadToSize(buff, maxSize);
+
+    // Dynamic values are polled, and most of the time they are the same as when they were last drawn
+    if (strcmp(buff, drawnValue) == 0) {
+        return 0;
+    }
+    strcpy(drawnValue, buff);
+
 #ifdef CMS_OSD_RIGHT_ALIGNED_VALUES
     colpos = rightMenuColumn - maxSize;
 #else
@@ -364,9 +375,8 @@ static int cmsDrawMenuItemValue(displayPort_t *pDisplay, char *buff, uint8_t row
     return cnt;
 }
 
-static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t row, bool selectedRow, uint8_t *flags)
+static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t row, bool selectedRow, uint8_t *flags, char *drawnValue)
 {
-    #define CMS_DRAW_BUFFER_LEN 12
     #define CMS_NUM_FIELD_LEN 5
     #define CMS_CURSOR_BLINK_DELAY_MS 500
 
@@ -385,7 +395,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
     case OME_String:
         if (IS_PRINTVALUE(*flags) && p->data) {
             strncpy(buff, p->data, CMS_DRAW_BUFFER_LEN);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_DRAW_BUFFER_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_DRAW_BUFFER_LEN, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -406,7 +416,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
             strncat(buff, ">", CMS_DRAW_BUFFER_LEN);
 
             row = smallScreen  ? row - 1  : row;
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, strlen(buff));
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, strlen(buff), drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -419,7 +429,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
               strcpy(buff, "NO ");
             }
 
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -429,7 +439,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
             OSD_TAB_t *ptr = p->data;
             char * str = (char *)ptr->names[*ptr->val];
             strncpy(buff, str, CMS_DRAW_BUFFER_LEN);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_DRAW_BUFFER_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_DRAW_BUFFER_LEN, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -454,7 +464,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
                     }
                 }
             }
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -464,7 +474,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_UINT8_t *ptr = p->data;
             itoa(*ptr->val, buff, 10);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -473,7 +483,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_INT8_t *ptr = p->data;
             itoa(*ptr->val, buff, 10);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -482,7 +492,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_UINT16_t *ptr = p->data;
             itoa(*ptr->val, buff, 10);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -491,7 +501,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_UINT16_t *ptr = p->data;
             itoa(*ptr->val, buff, 10);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -500,7 +510,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_FLOAT_t *ptr = p->data;
             cmsFormatFloat(*ptr->val * ptr->multipler, buff);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnValue);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -560,6 +570,7 @@ static void cmsDrawMenu(displayPort_t *pDisplay, uint32_t currentTimeUs)
         for (p = pageTop, i= 0; (p <= pageTop + pageMaxRow); p++, i++) {
             SET_PRINTLABEL(runtimeEntryFlags[i]);
             SET_PRINTVALUE(runtimeEntryFlags[i]);
+            runtimeEntryValue[i][0] = '\0';
         }
         pDisplay->cleared = false;
     } else if (drawPolled) {
@@ -609,7 +620,7 @@ static void cmsDrawMenu(displayPort_t *pDisplay, uint32_t currentTimeUs)
 
         if (IS_PRINTVALUE(runtimeEntryFlags[i])) {
             bool selectedRow = i == currentCtx.cursorRow;
-            room -= cmsDrawMenuEntry(pDisplay, p, top + i * linesPerMenuItem, selectedRow, &runtimeEntryFlags[i]);
+            room -= cmsDrawMenuEntry(pDisplay, p, top + i * linesPerMenuItem, selectedRow, &runtimeEntryFlags[i], runtimeEntryValue[i]);
             if (room < 30)
                 return;
         }
@@ -1236,6 +1247,9 @@ static void cmsUpdate(uint32_t currentTimeUs)
 
         cmsDrawMenu(pCurrentDisplay, currentTimeUs);
 
+        // Displays that buffer the screen send the changes now
+        displayDrawScreen(pCurrentDisplay);
+
         if (currentTimeMs > lastCmsHeartBeatMs + 500) {
             // Heart beat for external CMS display device @ 500msec
             // (Timeout @ 1000msec)
@@ -38,13 +38,20 @@ uint16_t crc16_ccitt(uint16_t crc, unsigned char a)
     return crc;
 }
 
+// CRC of each 4 bit value shifted through the register, for processing a nibble at a time
+static const uint16_t crc16_ccitt_nibble_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+};
+
 uint16_t crc16_ccitt_update(uint16_t crc, const void *data, uint32_t length)
 {
     const uint8_t *p = (const uint8_t *)data;
     const uint8_t *pend = p + length;
 
     for (; p != pend; p++) {
-        crc = crc16_ccitt(crc, *p);
+        crc = (crc << 4) ^ crc16_ccitt_nibble_table[(crc >> 12) ^ (*p >> 4)];
+        crc = (crc << 4) ^ crc16_ccitt_nibble_table[(crc >> 12) ^ (*p & 0x0f)];
     }
     return crc;
 }
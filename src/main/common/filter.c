@@ -225,3 +225,82 @@ FAST_CODE float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float i
     const uint16_t denom = filter->primed ? filter->windowSize : filter->movingWindowIndex;
     return filter->movingSum  / denom;
 }
+
+void movingAverageFilterInit(movingAverageFilter_t *filter, int32_t *buf, uint16_t windowSize)
+{
+    filter->buf = buf;
+    filter->sum = 0;
+    filter->windowSize = windowSize;
+    filter->index = 0;
+    filter->count = 0;
+}
+
+int32_t movingAverageFilterApply(movingAverageFilter_t *filter, int32_t input)
+{
+    if (filter->count == filter->windowSize) {
+        filter->sum -= filter->buf[filter->index];
+    } else {
+        filter->count++;
+    }
+    filter->buf[filter->index] = input;
+    filter->sum += input;
+
+    if (++filter->index == filter->windowSize) {
+        filter->index = 0;
+    }
+
+    return filter->sum / filter->count;
+}
+
+bool movingAverageFilterIsPrimed(const movingAverageFilter_t *filter)
+{
+    return filter->count == filter->windowSize;
+}
+
+void medianFilterInit(medianFilter_t *filter, int32_t *window, int32_t *sorted, uint16_t windowSize)
+{
+    filter->window = window;
+    filter->sorted = sorted;
+    filter->windowSize = windowSize;
+    filter->index = 0;
+    filter->count = 0;
+}
+
+// index of the first sorted sample not less than value
+static uint16_t medianFilterLowerBound(const medianFilter_t *filter, int32_t value)
+{
+    uint16_t low = 0;
+    uint16_t high = filter->count;
+
+    while (low < high) {
+        const uint16_t mid = (low + high) / 2;
+        if (filter->sorted[mid] < value) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+int32_t medianFilterApply(medianFilter_t *filter, int32_t input)
+{
+    if (filter->count == filter->windowSize) {
+        // drop the oldest sample from the sorted samples
+        const uint16_t oldest = medianFilterLowerBound(filter, filter->window[filter->index]);
+        memmove(&filter->sorted[oldest], &filter->sorted[oldest + 1], (filter->count - oldest - 1) * sizeof(filter->sorted[0]));
+        filter->count--;
+    }
+
+    const uint16_t position = medianFilterLowerBound(filter, input);
+    memmove(&filter->sorted[position + 1], &filter->sorted[position], (filter->count - position) * sizeof(filter->sorted[0]));
+    filter->sorted[position] = input;
+    filter->count++;
+
+    filter->window[filter->index] = input;
+    if (++filter->index == filter->windowSize) {
+        filter->index = 0;
+    }
+
+    return filter->sorted[filter->count / 2];
+}
@@ -0,0 +1,238 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Streaming encoder for the LZ4 block format.
+ *
+ * Input is pulled through a callback into a sliding window, so large reads from dataflash can be
+ * compressed with a few kilobytes of RAM. Encoding stops when the output buffer is full, the
+ * caller is told how much input the block covers. Blocks follow the LZ4 end of block rules, so
+ * any stock LZ4 block decoder can expand them.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_LZ4
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "lz4.h"
+
+#define LZ4_MIN_MATCH       4
+#define LZ4_LAST_LITERALS   5   // the last 5 bytes of a block are always literals
+#define LZ4_MF_LIMIT        12  // the last match must start at least 12 bytes before the end of a block
+#define LZ4_RUN_MASK        15U
+#define LZ4_TAIL_RESERVE    (1 + LZ4_MF_LIMIT) // room for a final token and literals after any match
+
+#define LZ4_HASH_LOG        10
+#define LZ4_SKIP_TRIGGER    6   // search faster through incompressible data
+
+// Refill the window when less than this is left ahead of the cursor
+#define LZ4_LOOKAHEAD       256
+
+#define LZ4_BUFFER_SIZE     (2 * LZ4_WINDOW_SIZE)
+
+STATIC_ASSERT(LZ4_WINDOW_SIZE >= 2 * LZ4_LOOKAHEAD, LZ4_WINDOW_SIZE_too_small);
+
+typedef struct lz4Encoder_s {
+    lz4ReadFn_t readFn;
+    uint32_t address;
+    uint32_t inLen;
+
+    // buffer holds input [bufStart, bufEnd), all positions are offsets from the start of the block
+    uint32_t bufStart;
+    uint32_t bufEnd;
+    uint32_t anchor;    // start of the literals not yet emitted
+
+    uint8_t buffer[LZ4_BUFFER_SIZE];
+    uint16_t hashTable[1 << LZ4_HASH_LOG];
+} lz4Encoder_t;
+
+static lz4Encoder_t encoder;
+
+static uint32_t lz4Read32(uint32_t pos)
+{
+    uint32_t value;
+    memcpy(&value, &encoder.buffer[pos - encoder.bufStart], sizeof(value));
+    return value;
+}
+
+static uint32_t lz4Hash(uint32_t pos)
+{
+    return (lz4Read32(pos) * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+// Slide the window forward, keeping the unemitted literals and a window of history before the cursor
+static void lz4Refill(uint32_t ip)
+{
+    if (encoder.bufEnd >= encoder.inLen) {
+        return;
+    }
+
+    const uint32_t keep = MIN(encoder.anchor, ip > LZ4_WINDOW_SIZE ? ip - LZ4_WINDOW_SIZE : 0);
+    if (keep > encoder.bufStart) {
+        memmove(encoder.buffer, &encoder.buffer[keep - encoder.bufStart], encoder.bufEnd - keep);
+        encoder.bufStart = keep;
+    }
+
+    const uint32_t space = LZ4_BUFFER_SIZE - (encoder.bufEnd - encoder.bufStart);
+    const uint32_t toRead = MIN(space, encoder.inLen - encoder.bufEnd);
+    if (toRead == 0) {
+        return;
+    }
+
+    const int bytesRead = encoder.readFn(encoder.address + encoder.bufEnd, &encoder.buffer[encoder.bufEnd - encoder.bufStart], toRead);
+    if (bytesRead <= 0) {
+        // end of the device, the block ends with what has been read
+        encoder.inLen = encoder.bufEnd;
+        return;
+    }
+    encoder.bufEnd += bytesRead;
+}
+
+static int lz4LengthBytes(uint32_t length)
+{
+    return length >= LZ4_RUN_MASK ? (length - LZ4_RUN_MASK) / 255 + 1 : 0;
+}
+
+static uint8_t *lz4WriteLength(uint8_t *op, uint32_t length)
+{
+    if (length >= LZ4_RUN_MASK) {
+        length -= LZ4_RUN_MASK;
+        while (length >= 255) {
+            *op++ = 255;
+            length -= 255;
+        }
+        *op++ = length;
+    }
+    return op;
+}
+
+static uint8_t *lz4WriteSequence(uint8_t *op, uint32_t literalLength, uint32_t offset, uint32_t matchLength)
+{
+    uint8_t *token = op++;
+
+    *token = MIN(literalLength, LZ4_RUN_MASK) << 4;
+    op = lz4WriteLength(op, literalLength);
+    memcpy(op, &encoder.buffer[encoder.anchor - encoder.bufStart], literalLength);
+    op += literalLength;
+
+    if (matchLength) {
+        matchLength -= LZ4_MIN_MATCH;
+        *token |= MIN(matchLength, LZ4_RUN_MASK);
+        *op++ = offset & 0xff;
+        *op++ = offset >> 8;
+        op = lz4WriteLength(op, matchLength);
+    }
+
+    return op;
+}
+
+/*
+ * Compress up to inLen bytes, read with readFn from address onwards, into a single LZ4 block.
+ *
+ * Returns the size of the block, and the number of input bytes it holds in inBytesConsumed.
+ */
+int lz4EncodeStreaming(uint8_t *outBuf, int outBufLen, lz4ReadFn_t readFn, uint32_t address, uint32_t inLen, uint32_t *inBytesConsumed)
+{
+    uint8_t *op = outBuf;
+    uint8_t *const oend = outBuf + outBufLen;
+
+    encoder.readFn = readFn;
+    encoder.address = address;
+    encoder.inLen = MIN(inLen, LZ4_MAX_INPUT_SIZE);
+    encoder.bufStart = 0;
+    encoder.bufEnd = 0;
+    encoder.anchor = 0;
+    memset(encoder.hashTable, 0, sizeof(encoder.hashTable));
+
+    uint32_t ip = 0;
+
+    while (true) {
+        if (ip + LZ4_LOOKAHEAD > encoder.bufEnd) {
+            lz4Refill(ip);
+        }
+
+        // The block may end at the end of the buffer, so matches have to respect the end of block rules there
+        if (ip + LZ4_MF_LIMIT >= encoder.bufEnd) {
+            break;
+        }
+        const uint32_t matchEndLimit = encoder.bufEnd - LZ4_LAST_LITERALS;
+
+        const uint32_t hash = lz4Hash(ip);
+        uint32_t ref = encoder.hashTable[hash];
+        encoder.hashTable[hash] = ip;
+
+        if (ref < encoder.bufStart || ref >= ip || lz4Read32(ref) != lz4Read32(ip)) {
+            ip += 1 + ((ip - encoder.anchor) >> LZ4_SKIP_TRIGGER);
+            continue;
+        }
+
+        const uint8_t *buf = encoder.buffer - encoder.bufStart;
+
+        // Extend the match backwards over pending literals, then forwards
+        while (ip > encoder.anchor && ref > encoder.bufStart && buf[ip - 1] == buf[ref - 1]) {
+            ip--;
+            ref--;
+        }
+        uint32_t matchLength = LZ4_MIN_MATCH;
+        while (ip + matchLength < matchEndLimit && buf[ip + matchLength] == buf[ref + matchLength]) {
+            matchLength++;
+        }
+
+        const uint32_t literalLength = ip - encoder.anchor;
+        const int sequenceSize = 1 + lz4LengthBytes(literalLength) + literalLength + 2 + lz4LengthBytes(matchLength - LZ4_MIN_MATCH);
+        if (op + sequenceSize + LZ4_TAIL_RESERVE > oend) {
+            break;
+        }
+
+        op = lz4WriteSequence(op, literalLength, ip - ref, matchLength);
+
+        ip += matchLength;
+        encoder.anchor = ip;
+        encoder.hashTable[lz4Hash(ip - 2)] = ip - 2;
+    }
+
+    // Finish with as many of the pending literals as fit
+    uint32_t literalLength = encoder.bufEnd - encoder.anchor;
+    const int space = oend - op;
+    if (space <= 0) {
+        literalLength = 0;
+    } else {
+        literalLength = MIN(literalLength, (uint32_t)space - 1);
+        while (1 + lz4LengthBytes(literalLength) + (int)literalLength > space) {
+            literalLength--;
+        }
+    }
+    if (space > 0) {
+        op = lz4WriteSequence(op, literalLength, 0, 0);
+    }
+
+    *inBytesConsumed = encoder.anchor + literalLength;
+
+    return op - outBuf;
+}
+
+#endif
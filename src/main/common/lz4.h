@@ -0,0 +1,42 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Bytes of history available to matches. The encoder keeps twice this plus a 2 KB hash table in
+// static RAM, so it is only enabled on MCUs with RAM to spare. Other targets can opt in with USE_LZ4.
+#ifndef LZ4_WINDOW_SIZE
+#define LZ4_WINDOW_SIZE 2048
+#endif
+
+// The uncompressed byte count of a block is sent as 16 bits
+#define LZ4_MAX_INPUT_SIZE 0xFFFFU
+
+struct lz4Info_s {
+    uint16_t uncompressedByteCount;
+};
+
+#define LZ4_INFO_SIZE sizeof(struct lz4Info_s)
+
+typedef int (*lz4ReadFn_t)(uint32_t address, uint8_t *buffer, unsigned int len);
+
+int lz4EncodeStreaming(uint8_t *outBuf, int outBufLen, lz4ReadFn_t readFn, uint32_t address, uint32_t inLen, uint32_t *inBytesConsumed);
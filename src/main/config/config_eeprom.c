@@ -158,11 +158,26 @@ uint16_t getEEPROMConfigSize(void)
     return eepromConfigSize;
 }
 
-// find config record for reg + classification (profile info) in EEPROM
-// return NULL when record is not found
-// this function assumes that EEPROM content is valid
-static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
+// find the registry entry for a config record, NULL if the PG is not registered.
+// Records are written in registry order, so the entry after the previous record is tried first.
+static const pgRegistry_t *findRegistryEntry(const pgRegistry_t *expected, pgn_t pgn)
 {
+    if (expected < __pg_registry_end && pgN(expected) == pgn) {
+        return expected;
+    }
+
+    return pgFind(pgn);
+}
+
+// Initialize all PG records from EEPROM.
+// The records are processed in a single pass, this function assumes that EEPROM content is valid.
+// PGs without a record, or with a record which is out of order, are reset once they have been passed.
+bool loadEEPROM(void)
+{
+    bool success = true;
+    int loadedCount = 0;
+    const pgRegistry_t *nextReg = __pg_registry_start;
+
     const uint8_t *p = &__config_start;
     p += sizeof(configHeader_t);             // skip header
     while (true) {
@@ -171,37 +186,35 @@ static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFla
             || p + record->size >= &__config_end
             || record->size < sizeof(*record))
             break;
-        if (pgN(reg) == record->pgn
-            && (record->flags & CR_CLASSIFICATION_MASK) == classification)
-            return record;
-        p += record->size;
-    }
-    // record not found
-    return NULL;
-}
 
-// Initialize all PG records from EEPROM.
-// This functions processes all PGs sequentially, scanning EEPROM for each one. This is suboptimal,
-//   but each PG is loaded/initialized exactly once and in defined order.
-bool loadEEPROM(void)
-{
-    bool success = true;
+        const pgRegistry_t *reg = NULL;
+        if ((record->flags & CR_CLASSIFICATION_MASK) == CR_CLASSICATION_SYSTEM) {
+            reg = findRegistryEntry(nextReg, record->pgn);
+        }
+        if (reg) {
+            // reset the PGs skipped over, unless a later record holds them they have no config in EEPROM
+            for (; nextReg < reg; nextReg++) {
+                pgReset(nextReg);
+            }
+            if (nextReg == reg) {
+                nextReg++;
+            }
 
-    PG_FOREACH(reg) {
-        const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
-        if (rec) {
             // config from EEPROM is available, use it to initialize PG. pgLoad will handle version mismatch
-            if (!pgLoad(reg, rec->pg, rec->size - offsetof(configRecord_t, pg), rec->version)) {
+            if (!pgLoad(reg, record->pg, record->size - offsetof(configRecord_t, pg), record->version)) {
                 success = false;
             }
-        } else {
-            pgReset(reg);
-
-            success = false;
+            loadedCount++;
         }
+
+        p += record->size;
     }
 
-    return success;
+    for (; nextReg < __pg_registry_end; nextReg++) {
+        pgReset(nextReg);
+    }
+
+    return success && loadedCount == PG_REGISTRY_SIZE;
 }
 
 static bool writeSettingsToEEPROM(void)
@@ -31,6 +31,7 @@
 #include "flash.h"
 #include "flash_impl.h"
 #include "flash_m25p16.h"
+#include "flash_sitl.h"
 #include "flash_w25n01g.h"
 #include "flash_w25m.h"
 #include "drivers/bus_spi.h"
@@ -38,8 +39,10 @@
 #include "drivers/io.h"
 #include "drivers/time.h"
 
+#ifdef USE_SPI
 static busDevice_t busInstance;
 static busDevice_t *busdev;
+#endif
 
 static flashDevice_t flashDevice;
 static flashPartitionTable_t flashPartitionTable;
@@ -182,6 +185,14 @@ static bool flashSpiInit(const flashConfig_t *flashConfig)
 
 bool flashDeviceInit(const flashConfig_t *flashConfig)
 {
+#ifdef USE_FLASH_SITL
+    UNUSED(flashConfig);
+
+    if (flashSitl_detect(&flashDevice)) {
+        return true;
+    }
+#endif
+
 #ifdef USE_SPI
     bool useSpi = (SPI_CFG_TO_DEV(flashConfig->spiDevice) != SPIINVALID);
 
@@ -324,12 +335,21 @@ static void flashConfigurePartitions(void)
     startSector = 0;
 #endif
 
+#if defined(USE_FLASHFS) && defined(USE_FLASHFS_LOG_INDEX)
+    startSector = (endSector + 1) - FLASHFS_LOG_INDEX_SECTORS;
+
+    flashPartitionSet(FLASH_PARTITION_TYPE_FLASHFS_LOG_INDEX, startSector, endSector);
+
+    endSector = startSector - 1;
+    startSector = 0;
+#endif
+
 #ifdef USE_FLASHFS
     flashPartitionSet(FLASH_PARTITION_TYPE_FLASHFS, startSector, endSector);
 #endif
 }
 
-flashPartition_t *flashPartitionFindByType(uint8_t type)
+flashPartition_t *flashPartitionFindByType(flashPartitionType_e type)
 {
     for (int index = 0; index < FLASH_MAX_PARTITIONS; index++) {
         flashPartition_t *candidate = &flashPartitionTable.partitions[index];
@@ -374,6 +394,7 @@ static const char *flashPartitionNames[] = {
     "BBMGMT   ",
     "FIRMWARE ",
     "CONFIG   ",
+    "LOGINDEX ",
 };
 
 const char *flashPartitionGetTypeName(flashPartitionType_e type)
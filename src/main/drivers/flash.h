@@ -74,6 +74,10 @@ typedef struct flashPartition_s {
 
 #define FLASH_PARTITION_SECTOR_COUNT(partition) (partition->endSector + 1 - partition->startSector) // + 1 for inclusive, start and end sector can be the same sector.
 
+#ifndef FLASHFS_LOG_INDEX_SECTORS
+#define FLASHFS_LOG_INDEX_SECTORS 2 // one page per indexed log
+#endif
+
 // Must be in sync with flashPartitionTypeNames[]
 // Should not be deleted or reordered once the code is writing a table to a flash.
 typedef enum {
@@ -83,6 +87,7 @@ typedef enum {
     FLASH_PARTITION_TYPE_BADBLOCK_MANAGEMENT,
     FLASH_PARTITION_TYPE_FIRMWARE,
     FLASH_PARTITION_TYPE_CONFIG,
+    FLASH_PARTITION_TYPE_FLASHFS_LOG_INDEX,
     FLASH_MAX_PARTITIONS
 } flashPartitionType_e;
 
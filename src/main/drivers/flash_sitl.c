@@ -0,0 +1,231 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Dataflash emulated by a memory mapped host file for the SITL target.
+ *
+ * Behaves like a NOR chip: programming can only clear bits, and the device reports busy
+ * for the latency configured with SITL_FLASH_LATENCY (page program) and SITL_FLASH_ERASE_LATENCY
+ * (per sector erased) so that logging can be benchmarked against a slow device.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "platform.h"
+
+#ifdef USE_FLASH_SITL
+
+#include "common/maths.h"
+
+#include "drivers/flash.h"
+#include "drivers/flash_impl.h"
+
+#include "flash_sitl.h"
+
+#define SITL_FLASH_PAGESIZE         256
+#define SITL_FLASH_PAGES_PER_SECTOR 256
+
+STATIC_ASSERT(FLASH_SITL_SIZE % (SITL_FLASH_PAGESIZE * SITL_FLASH_PAGES_PER_SECTOR) == 0, FLASH_SITL_SIZE_not_whole_sectors);
+
+#define DEFAULT_TIMEOUT_MILLIS       6
+#define SECTOR_ERASE_TIMEOUT_MILLIS  5000
+#define BULK_ERASE_TIMEOUT_MILLIS    21000
+
+static uint8_t *flashMemory;
+static uint64_t busyUntilUs;
+static sitlLatency_t programLatency;
+static sitlLatency_t eraseLatency;
+
+const flashVTable_t flashSitl_vTable;
+
+static void flashSitl_setBusy(uint32_t durationUs)
+{
+    busyUntilUs = micros64() + durationUs;
+}
+
+static bool flashSitl_isReady(flashDevice_t *fdevice)
+{
+    UNUSED(fdevice);
+
+    return micros64() >= busyUntilUs;
+}
+
+static bool flashSitl_waitForReady(flashDevice_t *fdevice, uint32_t timeoutMillis)
+{
+    const uint64_t timeoutUs = micros64() + timeoutMillis * 1000;
+
+    while (!flashSitl_isReady(fdevice)) {
+        if (micros64() > timeoutUs) {
+            return false;
+        }
+        delayMicroseconds_real(50);
+    }
+
+    return true;
+}
+
+bool flashSitl_detect(flashDevice_t *fdevice)
+{
+    const int fd = open(FLASH_SITL_FILENAME, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "[flash] failed to open '%s'\n", FLASH_SITL_FILENAME);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (st.st_size < FLASH_SITL_SIZE && ftruncate(fd, FLASH_SITL_SIZE) != 0)) {
+        fprintf(stderr, "[flash] failed to size '%s'\n", FLASH_SITL_FILENAME);
+        close(fd);
+        return false;
+    }
+
+    flashMemory = mmap(NULL, FLASH_SITL_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (flashMemory == MAP_FAILED) {
+        flashMemory = NULL;
+        fprintf(stderr, "[flash] failed to map '%s'\n", FLASH_SITL_FILENAME);
+        return false;
+    }
+
+    // New or grown files read back as erased flash
+    if (st.st_size < FLASH_SITL_SIZE) {
+        memset(flashMemory + st.st_size, 0xFF, FLASH_SITL_SIZE - st.st_size);
+        printf("[flash] created '%s', size = %d\n", FLASH_SITL_FILENAME, FLASH_SITL_SIZE);
+    } else {
+        printf("[flash] loaded '%s', size = %d\n", FLASH_SITL_FILENAME, FLASH_SITL_SIZE);
+    }
+
+    sitlLatencyInit(&programLatency, "SITL_FLASH_LATENCY");
+    sitlLatencyInit(&eraseLatency, "SITL_FLASH_ERASE_LATENCY");
+
+    fdevice->geometry.flashType = FLASH_TYPE_NOR;
+    fdevice->geometry.pageSize = SITL_FLASH_PAGESIZE;
+    fdevice->geometry.pagesPerSector = SITL_FLASH_PAGES_PER_SECTOR;
+    fdevice->geometry.sectorSize = fdevice->geometry.pagesPerSector * fdevice->geometry.pageSize;
+    fdevice->geometry.sectors = FLASH_SITL_SIZE / fdevice->geometry.sectorSize;
+    fdevice->geometry.totalSize = FLASH_SITL_SIZE;
+
+    fdevice->vTable = &flashSitl_vTable;
+    return true;
+}
+
+static void flashSitl_eraseSector(flashDevice_t *fdevice, uint32_t address)
+{
+    flashSitl_waitForReady(fdevice, SECTOR_ERASE_TIMEOUT_MILLIS);
+
+    address -= address % fdevice->geometry.sectorSize;
+    memset(flashMemory + address, 0xFF, fdevice->geometry.sectorSize);
+
+    flashSitl_setBusy(sitlLatencyNext(&eraseLatency));
+}
+
+static void flashSitl_eraseCompletely(flashDevice_t *fdevice)
+{
+    flashSitl_waitForReady(fdevice, BULK_ERASE_TIMEOUT_MILLIS);
+
+    memset(flashMemory, 0xFF, fdevice->geometry.totalSize);
+
+    flashSitl_setBusy(sitlLatencyNext(&eraseLatency) * fdevice->geometry.sectors);
+}
+
+static void flashSitl_pageProgramBegin(flashDevice_t *fdevice, uint32_t address)
+{
+    fdevice->currentWriteAddress = address;
+}
+
+static void flashSitl_pageProgramContinue(flashDevice_t *fdevice, const uint8_t *data, int length)
+{
+    flashSitl_waitForReady(fdevice, DEFAULT_TIMEOUT_MILLIS);
+
+    // Programming can only clear bits, like the real thing
+    uint8_t *dest = flashMemory + fdevice->currentWriteAddress;
+    for (int i = 0; i < length; i++) {
+        dest[i] &= data[i];
+    }
+
+    fdevice->currentWriteAddress += length;
+
+    flashSitl_setBusy(sitlLatencyNext(&programLatency));
+}
+
+static void flashSitl_pageProgramFinish(flashDevice_t *fdevice)
+{
+    UNUSED(fdevice);
+}
+
+static void flashSitl_pageProgram(flashDevice_t *fdevice, uint32_t address, const uint8_t *data, int length)
+{
+    flashSitl_pageProgramBegin(fdevice, address);
+
+    flashSitl_pageProgramContinue(fdevice, data, length);
+
+    flashSitl_pageProgramFinish(fdevice);
+}
+
+static int flashSitl_readBytes(flashDevice_t *fdevice, uint32_t address, uint8_t *buffer, int length)
+{
+    if (!flashSitl_waitForReady(fdevice, DEFAULT_TIMEOUT_MILLIS)) {
+        return 0;
+    }
+
+    if (address >= fdevice->geometry.totalSize) {
+        return 0;
+    }
+    length = MIN((uint32_t)length, fdevice->geometry.totalSize - address);
+
+    memcpy(buffer, flashMemory + address, length);
+
+    return length;
+}
+
+static void flashSitl_flush(flashDevice_t *fdevice)
+{
+    UNUSED(fdevice);
+
+    msync(flashMemory, FLASH_SITL_SIZE, MS_ASYNC);
+}
+
+static const flashGeometry_t* flashSitl_getGeometry(flashDevice_t *fdevice)
+{
+    return &fdevice->geometry;
+}
+
+const flashVTable_t flashSitl_vTable = {
+    .isReady = flashSitl_isReady,
+    .waitForReady = flashSitl_waitForReady,
+    .eraseSector = flashSitl_eraseSector,
+    .eraseCompletely = flashSitl_eraseCompletely,
+    .pageProgramBegin = flashSitl_pageProgramBegin,
+    .pageProgramContinue = flashSitl_pageProgramContinue,
+    .pageProgramFinish = flashSitl_pageProgramFinish,
+    .pageProgram = flashSitl_pageProgram,
+    .flush = flashSitl_flush,
+    .readBytes = flashSitl_readBytes,
+    .getGeometry = flashSitl_getGeometry,
+};
+#endif
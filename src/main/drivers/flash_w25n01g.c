@@ -752,7 +752,7 @@ int w25n01g_readBytes(flashDevice_t *fdevice, uint32_t address, uint8_t *buffer,
 
         ENABLE(busdev);
         spiTransfer(busdev->busdev_u.spi.instance, cmd, NULL, sizeof(cmd));
-        spiTransfer(busdev->busdev_u.spi.instance, NULL, buffer, length);
+        spiTransfer(busdev->busdev_u.spi.instance, NULL, buffer, transferLength);
         DISABLE(busdev);
 
     }
@@ -761,7 +761,7 @@ int w25n01g_readBytes(flashDevice_t *fdevice, uint32_t address, uint8_t *buffer,
         QUADSPI_TypeDef *quadSpi = fdevice->io.handle.quadSpi;
 
         //quadSpiReceiveWithAddress1LINE(quadSpi, W25N01G_INSTRUCTION_READ_DATA, 8, column, W28N01G_STATUS_COLUMN_ADDRESS_SIZE, buffer, length);
-        quadSpiReceiveWithAddress4LINES(quadSpi, W25N01G_INSTRUCTION_FAST_READ_QUAD_OUTPUT, 8, column, W28N01G_STATUS_COLUMN_ADDRESS_SIZE, buffer, length);
+        quadSpiReceiveWithAddress4LINES(quadSpi, W25N01G_INSTRUCTION_FAST_READ_QUAD_OUTPUT, 8, column, W28N01G_STATUS_COLUMN_ADDRESS_SIZE, buffer, transferLength);
     }
 #endif
 
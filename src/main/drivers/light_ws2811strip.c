@@ -38,20 +38,19 @@
 
 #include "common/color.h"
 #include "common/colorconversion.h"
+#include "common/utils.h"
 
 #include "drivers/dma.h"
 #include "drivers/io.h"
 
 #include "light_ws2811strip.h"
 
-#if defined(STM32F1) || defined(STM32F3)
-uint8_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
-#elif defined(STM32F7)
-FAST_RAM_ZERO_INIT uint32_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
+#if defined(STM32F7)
+FAST_RAM_ZERO_INIT ws2811Compare_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
 #elif defined(STM32H7)
-DMA_RAM uint32_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
+DMA_RAM ws2811Compare_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
 #else
-uint32_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
+ws2811Compare_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
 #endif
 
 static ioTag_t ledStripIoTag;
@@ -61,8 +60,20 @@ volatile bool ws2811LedDataTransferInProgress = false;
 uint16_t BIT_COMPARE_1 = 0;
 uint16_t BIT_COMPARE_0 = 0;
 
+// The compare values for each 4 bit value, most significant bit first
+#define WS2811_BITS_PER_NIBBLE 4
+static ws2811Compare_t nibbleCompareTable[16][WS2811_BITS_PER_NIBBLE];
+
 static hsvColor_t ledColorBuffer[WS2811_DATA_BUFFER_SIZE];
 
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+// The colours held in the DMA buffer, only LEDs which have changed since are encoded again. The single colour DMA
+// handler clears the buffer after each transfer, so there it is always encoded in full.
+static hsvColor_t ledEncodedColorBuffer[WS2811_DATA_BUFFER_SIZE];
+static ledStripFormatRGB_e ledEncodedFormat;
+static bool ledEncodedColorsValid = false;
+#endif
+
 #if !defined(USE_WS2811_SINGLE_COLOUR)
 void setLedHsv(uint16_t index, const hsvColor_t *color)
 {
@@ -106,6 +117,19 @@ void ws2811LedStripInit(ioTag_t ioTag)
     ledStripIoTag = ioTag;
 }
 
+STATIC_UNIT_TESTED void ws2811BuildCompareTable(void)
+{
+    for (unsigned nibble = 0; nibble < ARRAYLEN(nibbleCompareTable); nibble++) {
+        for (unsigned bit = 0; bit < WS2811_BITS_PER_NIBBLE; bit++) {
+            nibbleCompareTable[nibble][bit] = (nibble & (0x08 >> bit)) ? BIT_COMPARE_1 : BIT_COMPARE_0;
+        }
+    }
+
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+    ledEncodedColorsValid = false;
+#endif
+}
+
 void ws2811LedStripEnable(void)
 {
     if (!ws2811Initialised) {
@@ -113,6 +137,9 @@ void ws2811LedStripEnable(void)
             return;
         }
 
+        // The compare values depend on the timer clock, which is known once the hardware is set up
+        ws2811BuildCompareTable();
+
         const hsvColor_t hsv_black = { 0, 0, 0 };
         setStripColor(&hsv_black);
         // RGB or GRB ordering doesn't matter for black
@@ -142,9 +169,10 @@ STATIC_UNIT_TESTED void updateLEDDMABuffer(ledStripFormatRGB_e ledFormat, rgbCol
         break;
     }
 
-    unsigned dmaBufferOffset = 0;
-    for (int index = 23; index >= 0; index--) {
-        ledStripDMABuffer[ledIndex * WS2811_BITS_PER_LED + dmaBufferOffset++] = (packed_colour & (1 << index)) ? BIT_COMPARE_1 : BIT_COMPARE_0;
+    ws2811Compare_t *dmaBuffer = &ledStripDMABuffer[ledIndex * WS2811_BITS_PER_LED];
+    for (int shift = WS2811_BITS_PER_LED - WS2811_BITS_PER_NIBBLE; shift >= 0; shift -= WS2811_BITS_PER_NIBBLE) {
+        memcpy(dmaBuffer, nibbleCompareTable[(packed_colour >> shift) & 0x0f], sizeof(nibbleCompareTable[0]));
+        dmaBuffer += WS2811_BITS_PER_NIBBLE;
     }
 }
 
@@ -159,16 +187,32 @@ void ws2811UpdateStrip(ledStripFormatRGB_e ledFormat)
         return;
     }
 
-    unsigned ledIndex = 0;              // reset led index
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+    if (ledFormat != ledEncodedFormat) {
+        ledEncodedFormat = ledFormat;
+        ledEncodedColorsValid = false;
+    }
+#endif
 
     // fill transmit buffer with correct compare values to achieve
     // correct pulse widths according to color values
-    while (ledIndex < WS2811_DATA_BUFFER_SIZE) {
+    for (unsigned ledIndex = 0; ledIndex < WS2811_DATA_BUFFER_SIZE; ledIndex++) {
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+        if (ledEncodedColorsValid && memcmp(&ledEncodedColorBuffer[ledIndex], &ledColorBuffer[ledIndex], sizeof(hsvColor_t)) == 0) {
+            continue;
+        }
+        ledEncodedColorBuffer[ledIndex] = ledColorBuffer[ledIndex];
+#endif
+
         rgbColor24bpp_t *rgb24 = hsvToRgb24(&ledColorBuffer[ledIndex]);
 
-        updateLEDDMABuffer(ledFormat, rgb24, ledIndex++);
+        updateLEDDMABuffer(ledFormat, rgb24, ledIndex);
     }
 
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+    ledEncodedColorsValid = true;
+#endif
+
     ws2811LedDataTransferInProgress = true;
     ws2811LedStripDMAEnable();
 }
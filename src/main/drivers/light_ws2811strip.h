@@ -69,11 +69,14 @@ void setStripColors(const hsvColor_t *colors);
 
 bool isWS2811LedStripReady(void);
 
+// Timer compare values, one per bit sent to the strip
 #if defined(STM32F1) || defined(STM32F3)
-extern uint8_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
+typedef uint8_t ws2811Compare_t;
 #else
-extern uint32_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
+typedef uint32_t ws2811Compare_t;
 #endif
+
+extern ws2811Compare_t ledStripDMABuffer[WS2811_DMA_BUFFER_SIZE];
 extern volatile bool ws2811LedDataTransferInProgress;
 
 extern uint16_t BIT_COMPARE_1;
@@ -124,13 +124,22 @@ void sdcard_init(const sdcardConfig_t *config)
     case SDCARD_MODE_SDIO:
         sdcardVTable = &sdcardSdioVTable;
         break;
+#endif
+#ifdef USE_SDCARD_SITL
+    case SDCARD_MODE_SITL:
+        sdcardVTable = &sdcardSitlVTable;
+        break;
 #endif
     default:
         break;
     }
 
     if (sdcardVTable) {
+#ifdef USE_SPI
         sdcardVTable->sdcard_init(config, spiPinConfig(0));
+#else
+        sdcardVTable->sdcard_init(config, NULL);
+#endif
     }
 }
 
@@ -0,0 +1,255 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * SD card emulated by a host image file for the SITL target.
+ *
+ * The image must hold an MBR partitioned FAT16/FAT32 volume. Reads complete on the next poll,
+ * writes keep the card busy for the latency configured with SITL_SDCARD_LATENCY.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "platform.h"
+
+#ifdef USE_SDCARD_SITL
+
+#include "drivers/time.h"
+
+#include "pg/bus_spi.h"
+#include "pg/sdcard.h"
+
+#include "sdcard.h"
+#include "sdcard_impl.h"
+
+static int imageFd = -1;
+static uint64_t operationDeadlineUs;
+static sitlLatency_t writeLatency;
+
+static void sdcardSitl_preInit(const sdcardConfig_t *config)
+{
+    UNUSED(config);
+}
+
+static void sdcardSitl_init(const sdcardConfig_t *config, const spiPinConfig_t *spiConfig)
+{
+    UNUSED(config);
+    UNUSED(spiConfig);
+
+    sdcard.state = SDCARD_STATE_NOT_PRESENT;
+
+    imageFd = open(SDCARD_SITL_FILENAME, O_RDWR);
+    struct stat st;
+    if (imageFd < 0 || fstat(imageFd, &st) != 0) {
+        fprintf(stderr, "[sdcard] failed to open '%s'\n", SDCARD_SITL_FILENAME);
+        return;
+    }
+    printf("[sdcard] loaded '%s', size = %ld\n", SDCARD_SITL_FILENAME, (long)st.st_size);
+
+    sitlLatencyInit(&writeLatency, "SITL_SDCARD_LATENCY");
+
+    memset(&sdcard.metadata, 0, sizeof(sdcard.metadata));
+    sdcard.metadata.numBlocks = st.st_size / SDCARD_BLOCK_SIZE;
+    strcpy(sdcard.metadata.productName, "SITL");
+
+    sdcard.highCapacity = true;
+    sdcard.multiWriteBlocksRemain = 0;
+    sdcard.enabled = true;
+    sdcard.state = SDCARD_STATE_READY;
+}
+
+static bool sdcard_isReady(void)
+{
+    return sdcard.state == SDCARD_STATE_READY || sdcard.state == SDCARD_STATE_WRITING_MULTIPLE_BLOCKS;
+}
+
+static void sdcard_completeOperation(sdcardBlockOperation_e operation, bool success)
+{
+#ifdef SDCARD_PROFILING
+    if (sdcard.profiler) {
+        sdcard.profiler(operation, sdcard.pendingOperation.blockIndex, micros() - sdcard.pendingOperation.profileStartTime);
+    }
+#endif
+
+    if (sdcard.pendingOperation.callback) {
+        sdcard.pendingOperation.callback(
+            operation,
+            sdcard.pendingOperation.blockIndex,
+            success ? sdcard.pendingOperation.buffer : NULL,
+            sdcard.pendingOperation.callbackData
+        );
+    }
+}
+
+/**
+ * Complete the pending read or write once its latency has elapsed.
+ *
+ * Returns true if the card is ready to accept commands.
+ */
+static bool sdcardSitl_poll(void)
+{
+    if (!sdcard.enabled) {
+        sdcard.state = SDCARD_STATE_NOT_PRESENT;
+        return false;
+    }
+
+    switch (sdcard.state) {
+    case SDCARD_STATE_READING:
+        sdcard.state = SDCARD_STATE_READY;
+
+        sdcard_completeOperation(SDCARD_BLOCK_OPERATION_READ,
+            pread(imageFd, sdcard.pendingOperation.buffer, SDCARD_BLOCK_SIZE, (off_t)sdcard.pendingOperation.blockIndex * SDCARD_BLOCK_SIZE) == SDCARD_BLOCK_SIZE);
+        break;
+
+    case SDCARD_STATE_WAITING_FOR_WRITE:
+        if (micros64() < operationDeadlineUs) {
+            break;
+        }
+
+        if (sdcard.multiWriteBlocksRemain > 0) {
+            sdcard.multiWriteBlocksRemain--;
+            sdcard.multiWriteNextBlock++;
+        }
+        sdcard.state = sdcard.multiWriteBlocksRemain > 0 ? SDCARD_STATE_WRITING_MULTIPLE_BLOCKS : SDCARD_STATE_READY;
+
+        sdcard_completeOperation(SDCARD_BLOCK_OPERATION_WRITE, true);
+        break;
+
+    default:
+        break;
+    }
+
+    return sdcard_isReady();
+}
+
+static sdcardOperationStatus_e sdcardSitl_writeBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (!sdcard_isReady()) {
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    // Writing outside of the multi-block write cancels it
+    if (sdcard.state == SDCARD_STATE_WRITING_MULTIPLE_BLOCKS && blockIndex != sdcard.multiWriteNextBlock) {
+        sdcard.multiWriteBlocksRemain = 0;
+    }
+
+#ifdef SDCARD_PROFILING
+    sdcard.pendingOperation.profileStartTime = micros();
+#endif
+
+    if (pwrite(imageFd, buffer, SDCARD_BLOCK_SIZE, (off_t)blockIndex * SDCARD_BLOCK_SIZE) != SDCARD_BLOCK_SIZE) {
+        sdcard.multiWriteBlocksRemain = 0;
+        sdcard.state = SDCARD_STATE_READY;
+        return SDCARD_OPERATION_FAILURE;
+    }
+
+    sdcard.pendingOperation.buffer = buffer;
+    sdcard.pendingOperation.blockIndex = blockIndex;
+    sdcard.pendingOperation.callback = callback;
+    sdcard.pendingOperation.callbackData = callbackData;
+    sdcard.state = SDCARD_STATE_WAITING_FOR_WRITE;
+
+    operationDeadlineUs = micros64() + sitlLatencyNext(&writeLatency);
+
+    return SDCARD_OPERATION_IN_PROGRESS;
+}
+
+static sdcardOperationStatus_e sdcardSitl_beginWriteBlocks(uint32_t blockIndex, uint32_t blockCount)
+{
+    if (!sdcard_isReady()) {
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    if (sdcard.state != SDCARD_STATE_WRITING_MULTIPLE_BLOCKS || blockIndex != sdcard.multiWriteNextBlock) {
+        sdcard.multiWriteNextBlock = blockIndex;
+        sdcard.multiWriteBlocksRemain = blockCount;
+    }
+    sdcard.state = blockCount > 0 ? SDCARD_STATE_WRITING_MULTIPLE_BLOCKS : SDCARD_STATE_READY;
+
+    return SDCARD_OPERATION_SUCCESS;
+}
+
+static bool sdcardSitl_readBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (!sdcard_isReady()) {
+        return false;
+    }
+
+#ifdef SDCARD_PROFILING
+    sdcard.pendingOperation.profileStartTime = micros();
+#endif
+
+    // A read ends any multi-block write in progress
+    sdcard.multiWriteBlocksRemain = 0;
+
+    sdcard.pendingOperation.buffer = buffer;
+    sdcard.pendingOperation.blockIndex = blockIndex;
+    sdcard.pendingOperation.callback = callback;
+    sdcard.pendingOperation.callbackData = callbackData;
+    sdcard.state = SDCARD_STATE_READING;
+
+    return true;
+}
+
+static bool sdcardSitl_isFunctional(void)
+{
+    return sdcard.state != SDCARD_STATE_NOT_PRESENT;
+}
+
+static bool sdcardSitl_isInitialized(void)
+{
+    return sdcard.state >= SDCARD_STATE_READY;
+}
+
+static const sdcardMetadata_t* sdcardSitl_getMetadata(void)
+{
+    return &sdcard.metadata;
+}
+
+#ifdef SDCARD_PROFILING
+static void sdcardSitl_setProfilerCallback(sdcard_profilerCallback_c callback)
+{
+    sdcard.profiler = callback;
+}
+#endif
+
+sdcardVTable_t sdcardSitlVTable = {
+    sdcardSitl_preInit,
+    sdcardSitl_init,
+    sdcardSitl_readBlock,
+    sdcardSitl_beginWriteBlocks,
+    sdcardSitl_writeBlock,
+    sdcardSitl_poll,
+    sdcardSitl_isFunctional,
+    sdcardSitl_isInitialized,
+    sdcardSitl_getMetadata,
+#ifdef SDCARD_PROFILING
+    sdcardSitl_setProfilerCallback,
+#endif
+};
+
+#endif
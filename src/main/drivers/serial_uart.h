@@ -20,12 +20,10 @@
 
 #pragma once
 
-// Since serial ports can be used for any function these buffer sizes should be equal
-// The two largest things that need to be sent are: 1, MSP responses, 2, UBLOX SVINFO packet.
+// Buffers are sized per port according to the functions assigned to it and taken from a shared pool,
+// see serialBufferPool in io/serial.c. uartSetBuffers() must be called before uartOpen().
 
 // Size must be a power of two due to various optimizations which use 'and' instead of 'mod'
-// Various serial routines return the buffer occupied size as uint8_t which would need to be extended in order to
-// increase size further.
 
 typedef enum {
     UARTDEV_1 = 0,
@@ -83,4 +81,5 @@ typedef struct uartPort_s {
 } uartPort_t;
 
 void uartPinConfigure(const serialPinConfig_t *pSerialPinConfig);
+bool uartSetBuffers(UARTDevice_e device, volatile uint8_t *rxBuffer, uint16_t rxBufferSize, volatile uint8_t *txBuffer, uint16_t txBufferSize);
 serialPort_t *uartOpen(UARTDevice_e device, serialReceiveCallbackPtr rxCallback, void *rxCallbackData, uint32_t baudRate, portMode_e mode, portOptions_e options);
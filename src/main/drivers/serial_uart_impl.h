@@ -25,48 +25,18 @@
 #if defined(STM32F1)
 #define UARTDEV_COUNT_MAX 3
 #define UARTHARDWARE_MAX_PINS 3
-#ifndef UART_RX_BUFFER_SIZE
-#define UART_RX_BUFFER_SIZE     128
-#endif
-#ifndef UART_TX_BUFFER_SIZE
-#define UART_TX_BUFFER_SIZE     256
-#endif
 #elif defined(STM32F3)
 #define UARTDEV_COUNT_MAX 5
 #define UARTHARDWARE_MAX_PINS 4
-#ifndef UART_RX_BUFFER_SIZE
-#define UART_RX_BUFFER_SIZE     128
-#endif
-#ifndef UART_TX_BUFFER_SIZE
-#define UART_TX_BUFFER_SIZE     256
-#endif
 #elif defined(STM32F4)
 #define UARTDEV_COUNT_MAX 6
 #define UARTHARDWARE_MAX_PINS 4
-#ifndef UART_RX_BUFFER_SIZE
-#define UART_RX_BUFFER_SIZE     128
-#endif
-#ifndef UART_TX_BUFFER_SIZE
-#define UART_TX_BUFFER_SIZE     256
-#endif
 #elif defined(STM32F7)
 #define UARTDEV_COUNT_MAX 8
 #define UARTHARDWARE_MAX_PINS 4
-#ifndef UART_RX_BUFFER_SIZE
-#define UART_RX_BUFFER_SIZE     128
-#endif
-#ifndef UART_TX_BUFFER_SIZE
-#define UART_TX_BUFFER_SIZE     256
-#endif
 #elif defined(STM32H7)
 #define UARTDEV_COUNT_MAX 8
 #define UARTHARDWARE_MAX_PINS 5
-#ifndef UART_RX_BUFFER_SIZE
-#define UART_RX_BUFFER_SIZE     128
-#endif
-#ifndef UART_TX_BUFFER_SIZE
-#define UART_TX_BUFFER_SIZE     256
-#endif
 #else
 #error unknown MCU family
 #endif
@@ -174,13 +144,6 @@ typedef struct uartHardware_s {
 #endif
     uint8_t txPriority;
     uint8_t rxPriority;
-
-#ifdef STM32H7
-    volatile uint8_t *txBuffer;
-    volatile uint8_t *rxBuffer;
-    uint16_t txBufferSize;
-    uint16_t rxBufferSize;
-#endif
 } uartHardware_t;
 
 extern const uartHardware_t uartHardware[];
@@ -193,14 +156,11 @@ typedef struct uartDevice_s {
     const uartHardware_t *hardware;
     uartPinDef_t rx;
     uartPinDef_t tx;
-#ifdef STM32H7
-    // For H7, buffers with possible DMA access is placed in D2 SRAM.
+    // Assigned by uartSetBuffers() from the serial buffer pool before the port is opened
     volatile uint8_t *rxBuffer;
     volatile uint8_t *txBuffer;
-#else
-    volatile uint8_t rxBuffer[UART_RX_BUFFER_SIZE];
-    volatile uint8_t txBuffer[UART_TX_BUFFER_SIZE];
-#endif
+    uint16_t rxBufferSize;
+    uint16_t txBufferSize;
 } uartDevice_t;
 
 extern uartDevice_t *uartDevmap[];
@@ -19,7 +19,7 @@
  */
 
 /*
- * UART pin configuration common to all MCUs.
+ * UART pin and buffer configuration common to all MCUs.
  */
 
 /*
@@ -69,4 +69,19 @@ void uartPinConfigure(const serialPinConfig_t *pSerialPinConfig)
         }
     }
 }
+
+bool uartSetBuffers(UARTDevice_e device, volatile uint8_t *rxBuffer, uint16_t rxBufferSize, volatile uint8_t *txBuffer, uint16_t txBufferSize)
+{
+    uartDevice_t *uartdev = uartDevmap[device];
+    if (!uartdev) {
+        return false;
+    }
+
+    uartdev->rxBuffer = rxBuffer;
+    uartdev->rxBufferSize = rxBufferSize;
+    uartdev->txBuffer = txBuffer;
+    uartdev->txBufferSize = txBufferSize;
+
+    return true;
+}
 #endif
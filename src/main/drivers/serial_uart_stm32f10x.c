@@ -134,8 +134,8 @@ uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode,
 
     s->port.rxBuffer = uartdev->rxBuffer;
     s->port.txBuffer = uartdev->txBuffer;
-    s->port.rxBufferSize = ARRAYLEN(uartdev->rxBuffer);
-    s->port.txBufferSize = ARRAYLEN(uartdev->txBuffer);
+    s->port.rxBufferSize = uartdev->rxBufferSize;
+    s->port.txBufferSize = uartdev->txBufferSize;
 
     const uartHardware_t *hardware = uartdev->hardware;
 
@@ -219,8 +219,8 @@ uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode,
 
     s->port.rxBuffer = uartDev->rxBuffer;
     s->port.txBuffer = uartDev->txBuffer;
-    s->port.rxBufferSize = sizeof(uartDev->rxBuffer);
-    s->port.txBufferSize = sizeof(uartDev->txBuffer);
+    s->port.rxBufferSize = uartDev->rxBufferSize;
+    s->port.txBufferSize = uartDev->txBufferSize;
 
     const uartHardware_t *hardware = uartDev->hardware;
 
@@ -213,8 +213,8 @@ uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode,
 
     s->port.rxBuffer = uart->rxBuffer;
     s->port.txBuffer = uart->txBuffer;
-    s->port.rxBufferSize = sizeof(uart->rxBuffer);
-    s->port.txBufferSize = sizeof(uart->txBuffer);
+    s->port.rxBufferSize = uart->rxBufferSize;
+    s->port.txBufferSize = uart->txBufferSize;
 
     s->USARTx = hardware->reg;
 
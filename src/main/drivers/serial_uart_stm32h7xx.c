@@ -88,44 +88,6 @@
 #define UART8_RX_DMA_STREAM NULL
 #endif
 
-#define UART_BUFFERS(n) \
-  DMA_RAM volatile uint8_t uart ## n ## RxBuffer[UART_RX_BUFFER_SIZE]; \
-  DMA_RAM volatile uint8_t uart ## n ## TxBuffer[UART_TX_BUFFER_SIZE]; struct dummy_s
-
-#ifdef USE_UART1
-UART_BUFFERS(1);
-#endif
-
-#ifdef USE_UART2
-UART_BUFFERS(2);
-#endif
-
-#ifdef USE_UART3
-UART_BUFFERS(3);
-#endif
-
-#ifdef USE_UART4
-UART_BUFFERS(4);
-#endif
-
-#ifdef USE_UART5
-UART_BUFFERS(5);
-#endif
-
-#ifdef USE_UART6
-UART_BUFFERS(6);
-#endif
-
-#ifdef USE_UART7
-UART_BUFFERS(7);
-#endif
-
-#ifdef USE_UART8
-UART_BUFFERS(8);
-#endif
-
-#undef UART_BUFFERS
-
 const uartHardware_t uartHardware[UARTDEV_COUNT] = {
 #ifdef USE_UART1
     {
@@ -151,10 +113,6 @@ const uartHardware_t uartHardware[UARTDEV_COUNT] = {
         .rxIrq = USART1_IRQn,
         .txPriority = NVIC_PRIO_SERIALUART1_TXDMA,
         .rxPriority = NVIC_PRIO_SERIALUART1,
-        .txBuffer = uart1TxBuffer,
-        .rxBuffer = uart1RxBuffer,
-        .txBufferSize = sizeof(uart1TxBuffer),
-        .rxBufferSize = sizeof(uart1RxBuffer),
     },
 #endif
 
@@ -180,10 +138,6 @@ const uartHardware_t uartHardware[UARTDEV_COUNT] = {
         .rxIrq = USART2_IRQn,
         .txPriority = NVIC_PRIO_SERIALUART2_TXDMA,
         .rxPriority = NVIC_PRIO_SERIALUART2,
-        .txBuffer = uart2TxBuffer,
-        .rxBuffer = uart2RxBuffer,
-        .txBufferSize = sizeof(uart2TxBuffer),
-        .rxBufferSize = sizeof(uart2RxBuffer),
     },
 #endif
 
@@ -211,10 +165,6 @@ const uartHardware_t uartHardware[UARTDEV_COUNT] = {
         .rxIrq = USART3_IRQn,
         .txPriority = NVIC_PRIO_SERIALUART3_TXDMA,
         .rxPriority = NVIC_PRIO_SERIALUART3,
-        .txBuffer = uart3TxBuffer,
-        .rxBuffer = uart3RxBuffer,
-        .txBufferSize = sizeof(uart3TxBuffer),
-        .rxBufferSize = sizeof(uart3RxBuffer),
     },
 #endif
 
@@ -246,10 +196,6 @@ const uartHardware_t uartHardware[UARTDEV_COUNT] = {
         .rxIrq = UART4_IRQn,
         .txPriority = NVIC_PRIO_SERIALUART4_TXDMA,
         .rxPriority = NVIC_PRIO_SERIALUART4,
-        .txBuffer = uart4TxBuffer,
-        .rxBuffer = uart4RxBuffer,
-        .txBufferSize = sizeof(uart4TxBuffer),
-        .rxBufferSize = sizeof(uart4RxBuffer),
     },
 #endif
 
@@ -277,10 +223,6 @@ const uartHardware_t uartHardware[UARTDEV_COUNT] = {
         .rxIrq = UART5_IRQn,
         .txPriority = NVIC_PRIO_SERIALUART5_TXDMA,
         .rxPriority = NVIC_PRIO_SERIALUART5,
-        .txBuffer = uart5TxBuffer,
-        .rxBuffer = uart5RxBuffer,
-        .txBufferSize = sizeof(uart5TxBuffer),
-        .rxBufferSize = sizeof(uart5RxBuffer),
     },
 #endif
 
@@ -306,10 +248,6 @@ const uartHardware_t uartHardware[UARTDEV_COUNT] = {
         .rxIrq = USART6_IRQn,
         .txPriority = NVIC_PRIO_SERIALUART6_TXDMA,
         .rxPriority = NVIC_PRIO_SERIALUART6,
-        .txBuffer = uart6TxBuffer,
-        .rxBuffer = uart6RxBuffer,
-        .txBufferSize = sizeof(uart6TxBuffer),
-        .rxBufferSize = sizeof(uart6RxBuffer),
     },
 #endif
 
@@ -339,10 +277,6 @@ const uartHardware_t uartHardware[UARTDEV_COUNT] = {
         .rxIrq = UART7_IRQn,
         .txPriority = NVIC_PRIO_SERIALUART7_TXDMA,
         .rxPriority = NVIC_PRIO_SERIALUART7,
-        .txBuffer = uart7TxBuffer,
-        .rxBuffer = uart7RxBuffer,
-        .txBufferSize = sizeof(uart7TxBuffer),
-        .rxBufferSize = sizeof(uart7RxBuffer),
     },
 #endif
 
@@ -366,10 +300,6 @@ const uartHardware_t uartHardware[UARTDEV_COUNT] = {
         .rxIrq = UART8_IRQn,
         .txPriority = NVIC_PRIO_SERIALUART8_TXDMA,
         .rxPriority = NVIC_PRIO_SERIALUART8,
-        .txBuffer = uart8TxBuffer,
-        .rxBuffer = uart8RxBuffer,
-        .txBufferSize = sizeof(uart8TxBuffer),
-        .rxBufferSize = sizeof(uart8RxBuffer),
     },
 #endif
 };
@@ -485,12 +415,10 @@ uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode,
 
     s->USARTx = hardware->reg;
 
-#ifdef STM32H7
-    s->port.rxBuffer = hardware->rxBuffer;
-    s->port.txBuffer = hardware->txBuffer;
-    s->port.rxBufferSize = hardware->rxBufferSize;
-    s->port.txBufferSize = hardware->txBufferSize;
-#endif
+    s->port.rxBuffer = uartdev->rxBuffer;
+    s->port.txBuffer = uartdev->txBuffer;
+    s->port.rxBufferSize = uartdev->rxBufferSize;
+    s->port.txBufferSize = uartdev->txBufferSize;
 
 #ifdef USE_DMA
     if (hardware->rxDMAStream) {
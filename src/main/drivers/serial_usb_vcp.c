@@ -20,6 +20,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -126,25 +127,23 @@ static uint8_t usbVcpRead(serialPort_t *instance)
     }
 }
 
-static void usbVcpWriteBuf(serialPort_t *instance, const void *data, int count)
+static uint32_t usbVcpSend(const uint8_t *data, uint32_t count)
 {
-    UNUSED(instance);
-
-    if (!(usbIsConnected() && usbIsConfigured())) {
-        return;
+    if (!usbIsConnected() || !usbIsConfigured()) {
+        return count;
     }
 
     uint32_t start = millis();
-    const uint8_t *p = data;
     while (count > 0) {
-        uint32_t txed = CDC_Send_DATA(p, count);
+        uint32_t txed = CDC_Send_DATA(data, count);
         count -= txed;
-        p += txed;
+        data += txed;
 
         if (millis() - start > USB_TIMEOUT) {
             break;
         }
     }
+    return count;
 }
 
 static bool usbVcpFlush(vcpPort_t *port)
@@ -156,22 +155,23 @@ static bool usbVcpFlush(vcpPort_t *port)
         return true;
     }
 
-    if (!usbIsConnected() || !usbIsConfigured()) {
-        return false;
-    }
+    return usbVcpSend(port->txBuf, count) == 0;
+}
 
-    uint32_t start = millis();
-    uint8_t *p = port->txBuf;
-    while (count > 0) {
-        uint32_t txed = CDC_Send_DATA(p, count);
-        count -= txed;
-        p += txed;
+static void usbVcpWriteBuf(serialPort_t *instance, const void *data, int count)
+{
+    vcpPort_t *port = container_of(instance, vcpPort_t, port);
 
-        if (millis() - start > USB_TIMEOUT) {
-            break;
-        }
+    // Top up the pending packet if the data fits, otherwise send what is pending
+    // to keep the bytes in order and hand the buffer to the CDC stack in one go.
+    if (port->buffering && port->txAt + count < (int)ARRAYLEN(port->txBuf)) {
+        memcpy(&port->txBuf[port->txAt], data, count);
+        port->txAt += count;
+        return;
     }
-    return count == 0;
+
+    usbVcpFlush(port);
+    usbVcpSend(data, count);
 }
 
 static void usbVcpWrite(serialPort_t *instance, uint8_t c)
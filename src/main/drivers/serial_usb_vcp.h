@@ -35,11 +35,14 @@ extern USBD_HandleTypeDef  USBD_Device;
 extern USBD_HandleTypeDef  USBD_Device;
 #endif
 
+// Every target runs the USB core at full speed, with 64 byte bulk packets
+#define USB_VCP_TX_PACKET_SIZE 64
+
 typedef struct {
     serialPort_t port;
 
-    // Buffer used during bulk writes.
-    uint8_t txBuf[20];
+    // Buffer used during bulk writes, collecting a full packet before handing it to the CDC stack.
+    uint8_t txBuf[USB_VCP_TX_PACKET_SIZE];
     uint8_t txAt;
     // Set if the port is in bulk write mode and can buffer.
     bool buffering;
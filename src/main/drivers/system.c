@@ -29,6 +29,7 @@
 #include "drivers/light_led.h"
 #include "drivers/nvic.h"
 #include "drivers/sound_beeper.h"
+#include "drivers/time.h"
 
 #include "system.h"
 
@@ -40,6 +41,11 @@ static volatile uint32_t sysTickValStamp = 0;
 // cached value of RCC->CSR
 uint32_t cachedRccCsrValue;
 
+#if defined(STM32F7) || defined(STM32H7)
+// the Cortex-M7 DWT has to be unlocked before it can be written to
+#define DWT_LAR_UNLOCK_VALUE 0xC5ACCE55
+#endif
+
 void cycleCounterInit(void)
 {
 #if defined(USE_HAL_DRIVER)
@@ -49,6 +55,29 @@ void cycleCounterInit(void)
     RCC_GetClocksFreq(&clocks);
     usTicks = clocks.SYSCLK_Frequency / 1000000;
 #endif
+
+    // enable the DWT cycle counter
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#ifdef DWT_LAR_UNLOCK_VALUE
+    DWT->LAR = DWT_LAR_UNLOCK_VALUE;
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+int32_t clockCyclesToMicros(int32_t clockCycles)
+{
+    return clockCycles / (int32_t)usTicks;
+}
+
+int32_t clockCyclesTo10thMicros(int32_t clockCycles)
+{
+    return 10 * clockCycles / (int32_t)usTicks;
+}
+
+uint32_t clockMicrosToCycles(uint32_t micros)
+{
+    return micros * usTicks;
 }
 
 // SysTick
@@ -31,5 +31,18 @@ timeUs_t micros(void);
 timeUs_t microsISR(void);
 timeMs_t millis(void);
 
+#if defined(UNIT_TEST) || defined(SIMULATOR_BUILD)
+uint32_t getCycleCounter(void);
+#else
+// Return the core clock cycle count, wrapping every few seconds. Inline, so that timing code costs a single load
+static inline uint32_t getCycleCounter(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+int32_t clockCyclesToMicros(int32_t clockCycles);
+int32_t clockCyclesTo10thMicros(int32_t clockCycles);
+uint32_t clockMicrosToCycles(uint32_t micros);
+
 uint32_t ticks(void);
 timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
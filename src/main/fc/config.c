@@ -730,7 +730,7 @@ void changePidProfile(uint8_t pidProfileIndex)
         systemConfigMutable()->pidProfileIndex = pidProfileIndex;
         loadPidProfile();
 
-        pidInit(currentPidProfile);
+        pidChangeProfile(pidProfileIndex);
         initEscEndpoints();
     }
 
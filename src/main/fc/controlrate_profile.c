@@ -80,7 +80,7 @@ void changeControlRateProfile(uint8_t controlRateProfileIndex)
     }
 
     loadControlRateProfile();
-    initRcProcessing();
+    rcChangeProfile(systemConfig()->activeRateProfile);
 }
 
 void copyControlRateProfile(const uint8_t dstControlRateProfileIndex, const uint8_t srcControlRateProfileIndex) {
@@ -88,5 +88,6 @@ void copyControlRateProfile(const uint8_t dstControlRateProfileIndex, const uint
         && dstControlRateProfileIndex != srcControlRateProfileIndex
     ) {
         memcpy(controlRateProfilesMutable(dstControlRateProfileIndex), controlRateProfilesMutable(srcControlRateProfileIndex), sizeof(controlRateConfig_t));
+        initRcProcessing();
     }
 }
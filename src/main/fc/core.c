@@ -26,6 +26,7 @@
 #include "platform.h"
 
 #include "build/debug.h"
+#include "build/timings.h"
 
 #include "blackbox/blackbox.h"
 
@@ -361,7 +362,7 @@ void disarm(void)
 #endif
 
 #ifdef USE_BLACKBOX
-        if (blackboxConfig()->device && blackboxConfig()->mode != BLACKBOX_MODE_ALWAYS_ON) { // Close the log upon disarm except when logging mode is ALWAYS ON
+        if (blackboxConfig()->device && blackboxConfig()->mode != BLACKBOX_MODE_ALWAYS_ON && blackboxConfig()->mode != BLACKBOX_MODE_STREAM) { // Close the log upon disarm except when logging mode is ALWAYS ON or STREAM
             blackboxFinish();
         }
 #endif
@@ -996,8 +997,14 @@ static FAST_CODE void subTaskPidController(timeUs_t currentTimeUs)
 {
     uint32_t startTime = 0;
     if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
+    TIMINGS_START(TIMINGS_PID);
+#ifdef USE_ACC
+    // Loop rate attitude for the level modes, corrected from the accelerometer in TASK_ATTITUDE
+    imuUpdateGyroAttitude(currentTimeUs);
+#endif
     // PID - note this is function pointer set by setPIDController()
     pidController(currentPidProfile, currentTimeUs);
+    TIMINGS_STOP(TIMINGS_PID);
     DEBUG_SET(DEBUG_PIDLOOP, 1, micros() - startTime);
 
 #ifdef USE_RUNAWAY_TAKEOFF
@@ -1051,6 +1058,7 @@ static FAST_CODE_NOINLINE void subTaskPidSubprocesses(timeUs_t currentTimeUs)
     if (debugMode == DEBUG_PIDLOOP) {
         startTime = micros();
     }
+    TIMINGS_START(TIMINGS_PID_SUBPROCESSES);
 
 #ifdef USE_MAG
     if (sensors(SENSOR_MAG)) {
@@ -1066,6 +1074,7 @@ static FAST_CODE_NOINLINE void subTaskPidSubprocesses(timeUs_t currentTimeUs)
     UNUSED(currentTimeUs);
 #endif
 
+    TIMINGS_STOP(TIMINGS_PID_SUBPROCESSES);
     DEBUG_SET(DEBUG_PIDLOOP, 3, micros() - startTime);
 }
 
@@ -1093,8 +1102,11 @@ static FAST_CODE void subTaskMotorUpdate(timeUs_t currentTimeUs)
         startTime = micros();
     }
 
+    TIMINGS_START(TIMINGS_MIXER);
     mixTable(currentTimeUs, currentPidProfile->vbatPidCompensation);
+    TIMINGS_STOP(TIMINGS_MIXER);
 
+    TIMINGS_START(TIMINGS_MOTOR_OUTPUT);
 #ifdef USE_SERVOS
     // motor outputs are used as sources for servo mixing, so motors must be calculated using mixTable() before servos.
     if (isMixerUsingServos()) {
@@ -1103,6 +1115,7 @@ static FAST_CODE void subTaskMotorUpdate(timeUs_t currentTimeUs)
 #endif
 
     writeMotors();
+    TIMINGS_STOP(TIMINGS_MOTOR_OUTPUT);
 
 #ifdef USE_DSHOT_TELEMETRY_STATS
     if (debugMode == DEBUG_DSHOT_RPM_ERRORS && useDshotTelemetry) {
@@ -1120,6 +1133,8 @@ static FAST_CODE_NOINLINE void subTaskRcCommand(timeUs_t currentTimeUs)
 {
     UNUSED(currentTimeUs);
 
+    TIMINGS_START(TIMINGS_RC_COMMAND);
+
     // If we're armed, at minimum throttle, and we do arming via the
     // sticks, do not process yaw input from the rx.  We do this so the
     // motors do not spin up while we are trying to arm or disarm.
@@ -1138,6 +1153,7 @@ static FAST_CODE_NOINLINE void subTaskRcCommand(timeUs_t currentTimeUs)
 
     processRcCommand();
 
+    TIMINGS_STOP(TIMINGS_RC_COMMAND);
 }
 
 // Function for loop trigger
@@ -1149,6 +1165,8 @@ FAST_CODE void taskMainPidLoop(timeUs_t currentTimeUs)
     if (lockMainPID() != 0) return;
 #endif
 
+    TIMINGS_START(TIMINGS_PID_LOOP);
+
     // DEBUG_PIDLOOP, timings for:
     // 0 - gyroUpdate()
     // 1 - subTaskPidController()
@@ -1168,6 +1186,8 @@ FAST_CODE void taskMainPidLoop(timeUs_t currentTimeUs)
         debug[0] = getTaskDeltaTime(TASK_SELF);
         debug[1] = averageSystemLoadPercent;
     }
+
+    TIMINGS_STOP(TIMINGS_PID_LOOP);
 }
 
 bool isFlipOverAfterCrashActive(void)
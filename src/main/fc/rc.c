@@ -56,7 +56,6 @@ typedef float (applyRatesFn)(const int axis, float rcCommandf, const float rcCom
 static float setpointRate[3], rcDeflection[3], rcDeflectionAbs[3];
 static float throttlePIDAttenuation;
 static bool reverseMotors = false;
-static applyRatesFn *applyRates;
 uint16_t currentRxRefreshRate;
 
 FAST_RAM_ZERO_INIT uint8_t interpolationChannels;
@@ -103,12 +102,21 @@ float getThrottlePIDAttenuation(void)
 }
 
 #define THROTTLE_LOOKUP_LENGTH 12
-static int16_t lookupThrottleRC[THROTTLE_LOOKUP_LENGTH];    // lookup table for expo & mid THROTTLE
+
+typedef struct rcRuntime_s {
+    applyRatesFn *applyRates;
+    int16_t lookupThrottleRC[THROTTLE_LOOKUP_LENGTH];    // lookup table for expo & mid THROTTLE
+} rcRuntime_t;
+
+// Built for every rate profile, so that changing rate profile is a pointer swap
+static rcRuntime_t rcProfileRuntime[CONTROL_RATE_PROFILE_COUNT];
+static FAST_RAM_ZERO_INIT const rcRuntime_t *rcRuntime;
 
 static int16_t rcLookupThrottle(int32_t tmp)
 {
     const int32_t tmp2 = tmp / 100;
     // [0;1000] -> expo -> [MINTHROTTLE;MAXTHROTTLE]
+    const int16_t *lookupThrottleRC = rcRuntime->lookupThrottleRC;
     return lookupThrottleRC[tmp2] + (tmp - tmp2 * 100) * (lookupThrottleRC[tmp2 + 1] - lookupThrottleRC[tmp2]) / 100;
 }
 
@@ -181,7 +189,7 @@ static void calculateSetpointRate(int axis)
         const float rcCommandfAbs = fabsf(rcCommandf);
         rcDeflectionAbs[axis] = rcCommandfAbs;
 
-        angleRate = applyRates(axis, rcCommandf, rcCommandfAbs);
+        angleRate = rcRuntime->applyRates(axis, rcCommandf, rcCommandfAbs);
     }
     // Rate limit from profile (deg/sec)
     setpointRate[axis] = constrainf(angleRate, -1.0f * currentControlRateProfile->rate_limit[axis], 1.0f * currentControlRateProfile->rate_limit[axis]);
@@ -706,34 +714,47 @@ bool isMotorsReversed(void)
     return reverseMotors;
 }
 
-void initRcProcessing(void)
+static void buildRcRuntime(rcRuntime_t *runtime, const controlRateConfig_t *controlRateConfig)
 {
     for (int i = 0; i < THROTTLE_LOOKUP_LENGTH; i++) {
-        const int16_t tmp = 10 * i - currentControlRateProfile->thrMid8;
+        const int16_t tmp = 10 * i - controlRateConfig->thrMid8;
         uint8_t y = 1;
         if (tmp > 0)
-            y = 100 - currentControlRateProfile->thrMid8;
+            y = 100 - controlRateConfig->thrMid8;
         if (tmp < 0)
-            y = currentControlRateProfile->thrMid8;
-        lookupThrottleRC[i] = 10 * currentControlRateProfile->thrMid8 + tmp * (100 - currentControlRateProfile->thrExpo8 + (int32_t) currentControlRateProfile->thrExpo8 * (tmp * tmp) / (y * y)) / 10;
-        lookupThrottleRC[i] = PWM_RANGE_MIN + (PWM_RANGE_MAX - PWM_RANGE_MIN) * lookupThrottleRC[i] / 1000; // [MINTHROTTLE;MAXTHROTTLE]
+            y = controlRateConfig->thrMid8;
+        runtime->lookupThrottleRC[i] = 10 * controlRateConfig->thrMid8 + tmp * (100 - controlRateConfig->thrExpo8 + (int32_t) controlRateConfig->thrExpo8 * (tmp * tmp) / (y * y)) / 10;
+        runtime->lookupThrottleRC[i] = PWM_RANGE_MIN + (PWM_RANGE_MAX - PWM_RANGE_MIN) * runtime->lookupThrottleRC[i] / 1000; // [MINTHROTTLE;MAXTHROTTLE]
     }
 
-    switch (currentControlRateProfile->rates_type) {
+    switch (controlRateConfig->rates_type) {
     case RATES_TYPE_BETAFLIGHT:
     default:
-        applyRates = applyBetaflightRates;
+        runtime->applyRates = applyBetaflightRates;
 
         break;
     case RATES_TYPE_RACEFLIGHT:
-        applyRates = applyRaceFlightRates;
+        runtime->applyRates = applyRaceFlightRates;
 
         break;
     case RATES_TYPE_KISS:
-        applyRates = applyKissRates;
+        runtime->applyRates = applyKissRates;
 
         break;
     }
+}
+
+void rcChangeProfile(uint8_t controlRateProfileIndex)
+{
+    rcRuntime = &rcProfileRuntime[controlRateProfileIndex];
+}
+
+void initRcProcessing(void)
+{
+    for (int i = 0; i < CONTROL_RATE_PROFILE_COUNT; i++) {
+        buildRcRuntime(&rcProfileRuntime[i], controlRateProfiles(i));
+    }
+    rcChangeProfile(systemConfig()->activeRateProfile);
 
     interpolationChannels = 0;
     switch (rxConfig()->rcInterpolationChannels) {
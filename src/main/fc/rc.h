@@ -40,6 +40,7 @@ float getThrottlePIDAttenuation(void);
 void updateRcCommands(void);
 void resetYawAxis(void);
 void initRcProcessing(void);
+void rcChangeProfile(uint8_t controlRateProfileIndex);
 bool isMotorsReversed(void);
 bool rcSmoothingIsEnabled(void);
 rcSmoothingFilter_t *getRcSmoothingData(void);
@@ -42,6 +42,7 @@
 #include "flight/imu.h"
 #include "flight/mixer.h"
 #include "flight/pid.h"
+#include "flight/position.h"
 
 #include "io/gps.h"
 
@@ -84,6 +85,8 @@ static bool imuUpdated = false;
 #define ATTITUDE_RESET_KP_GAIN    25.0     // dcmKpGain value to use during attitude reset
 #define ATTITUDE_RESET_ACTIVE_TIME 500000  // 500ms - Time to wait for attitude to converge at high gain
 #define GPS_COG_MIN_GROUNDSPEED 500        // 500cm/s minimum groundspeed for a gps heading to be considered valid
+#define GRAVITY_CMSS 980.665f
+#define GYRO_ATTITUDE_MAX_DT_US 10000      // 10ms - longer gaps in the loop rate integration are left to the attitude task
 
 int32_t accSum[XYZ_AXIS_COUNT];
 float accAverage[XYZ_AXIS_COUNT];
@@ -99,6 +102,12 @@ static float smallAngleCosZ = 0;
 
 static imuRuntimeConfig_t imuRuntimeConfig;
 
+static timeUs_t previousGyroAttitudeTimeUs;
+#if !defined(SIMULATOR_BUILD) || defined(USE_IMU_CALC)
+// gyro time the loop rate integration skipped, which is left to the attitude task
+static timeDelta_t gyroAttitudeSkippedUs;
+#endif
+
 STATIC_UNIT_TESTED float rMat[3][3];
 
 // quaternion of sensor frame relative to earth frame
@@ -111,12 +120,13 @@ quaternion offset = QUATERNION_INITIALIZE;
 // absolute angle inclination in multiple of 0.1 degree    180 deg = 1800
 attitudeEulerAngles_t attitude = EULER_INITIALIZE;
 
-PG_REGISTER_WITH_RESET_TEMPLATE(imuConfig_t, imuConfig, PG_IMU_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(imuConfig_t, imuConfig, PG_IMU_CONFIG, 2);
 
 PG_RESET_TEMPLATE(imuConfig_t, imuConfig,
     .dcm_kp = 2500,                // 1.0 * 10000
     .dcm_ki = 0,                   // 0.003 * 10000
     .small_angle = 25,
+    .fast_attitude = true,
 );
 
 STATIC_UNIT_TESTED void imuComputeRotationMatrix(void){
@@ -157,6 +167,7 @@ void imuConfigure(uint16_t throttle_correction_angle, uint8_t throttle_correctio
 {
     imuRuntimeConfig.dcm_kp = imuConfig()->dcm_kp / 10000.0f;
     imuRuntimeConfig.dcm_ki = imuConfig()->dcm_ki / 10000.0f;
+    imuRuntimeConfig.fast_attitude = imuConfig()->fast_attitude;
 
     smallAngleCosZ = cos_approx(degreesToRadians(imuConfig()->small_angle));
 
@@ -198,7 +209,40 @@ static float invSqrt(float x)
     return 1.0f / sqrtf(x);
 }
 
-static void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz,
+// Integrate the body rates (rad/s) over dt seconds into the attitude quaternion
+STATIC_UNIT_TESTED void imuIntegrateQuaternion(float dt, float gx, float gy, float gz)
+{
+    // Integrate rate of change of quaternion
+    gx *= (0.5f * dt);
+    gy *= (0.5f * dt);
+    gz *= (0.5f * dt);
+
+    quaternion buffer;
+    buffer.w = q.w;
+    buffer.x = q.x;
+    buffer.y = q.y;
+    buffer.z = q.z;
+
+    q.w += (-buffer.x * gx - buffer.y * gy - buffer.z * gz);
+    q.x += (+buffer.w * gx + buffer.y * gz - buffer.z * gy);
+    q.y += (+buffer.w * gy - buffer.x * gz + buffer.z * gx);
+    q.z += (+buffer.w * gz + buffer.x * gy - buffer.y * gx);
+
+    // Normalise quaternion
+    float recipNorm = invSqrt(sq(q.w) + sq(q.x) + sq(q.y) + sq(q.z));
+    q.w *= recipNorm;
+    q.x *= recipNorm;
+    q.y *= recipNorm;
+    q.z *= recipNorm;
+
+    // Pre-compute rotation matrix from quaternion
+    imuComputeRotationMatrix();
+}
+
+// gyroDt is the part of dt the gyro rates still have to be integrated for. When the gyro has
+// already been integrated at loop rate by imuUpdateGyroAttitude() it is 0, the rates are only
+// used for the spin rate check and just the accelerometer/mag/COG correction is applied here.
+STATIC_UNIT_TESTED void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz, float gyroDt,
                                 bool useAcc, float ax, float ay, float az,
                                 bool useMag, float mx, float my, float mz,
                                 bool useCOG, float courseOverGround, const float dcmKpGain)
@@ -290,36 +334,19 @@ static void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz,
         integralFBz = 0.0f;
     }
 
+    if (gyroDt < dt) {
+        const float gyroScale = gyroDt / dt;
+        gx *= gyroScale;
+        gy *= gyroScale;
+        gz *= gyroScale;
+    }
+
     // Apply proportional and integral feedback
     gx += dcmKpGain * ex + integralFBx;
     gy += dcmKpGain * ey + integralFBy;
     gz += dcmKpGain * ez + integralFBz;
 
-    // Integrate rate of change of quaternion
-    gx *= (0.5f * dt);
-    gy *= (0.5f * dt);
-    gz *= (0.5f * dt);
-
-    quaternion buffer;
-    buffer.w = q.w;
-    buffer.x = q.x;
-    buffer.y = q.y;
-    buffer.z = q.z;
-
-    q.w += (-buffer.x * gx - buffer.y * gy - buffer.z * gz);
-    q.x += (+buffer.w * gx + buffer.y * gz - buffer.z * gy);
-    q.y += (+buffer.w * gy - buffer.x * gz + buffer.z * gx);
-    q.z += (+buffer.w * gz + buffer.x * gy - buffer.y * gx);
-
-    // Normalise quaternion
-    float recipNorm = invSqrt(sq(q.w) + sq(q.x) + sq(q.y) + sq(q.z));
-    q.w *= recipNorm;
-    q.x *= recipNorm;
-    q.y *= recipNorm;
-    q.z *= recipNorm;
-
-    // Pre-compute rotation matrix from quaternion
-    imuComputeRotationMatrix();
+    imuIntegrateQuaternion(dt, gx, gy, gz);
 }
 
 STATIC_UNIT_TESTED void imuUpdateEulerAngles(void)
@@ -363,6 +390,14 @@ static bool imuIsAccelerometerHealthy(float *accAverage)
     return (0.81f < accMagnitudeSq) && (accMagnitudeSq < 1.21f);
 }
 
+// Earth frame vertical acceleration in cm/s/s with gravity removed, positive up
+static float imuCalcVerticalAcceleration(const float *accAverage)
+{
+    const float accZ = rMat[2][0] * accAverage[X] + rMat[2][1] * accAverage[Y] + rMat[2][2] * accAverage[Z];
+
+    return (accZ * acc.dev.acc_1G_rec - 1.0f) * GRAVITY_CMSS;
+}
+
 // Calculate the dcmKpGain to use. When armed, the gain is imuRuntimeConfig.dcm_kp * 1.0 scaling.
 // When disarmed after initial boot, the scaling is set to 10.0 for the first 20 seconds to speed up initial convergence.
 // After disarming we want to quickly reestablish convergence to deal with the attitude estimation being incorrect due to a crash.
@@ -472,6 +507,7 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
 
 #if defined(SIMULATOR_BUILD) && !defined(USE_IMU_CALC)
     UNUSED(imuMahonyAHRSupdate);
+    UNUSED(imuIntegrateQuaternion);
     UNUSED(imuIsAccelerometerHealthy);
     UNUSED(useAcc);
     UNUSED(useMag);
@@ -480,6 +516,7 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
     UNUSED(courseOverGround);
     UNUSED(deltaT);
     UNUSED(imuCalcKpGain);
+    UNUSED(imuCalcVerticalAcceleration);
 #else
 
 #if defined(SIMULATOR_BUILD) && defined(SIMULATOR_IMU_SYNC)
@@ -489,17 +526,30 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
     float gyroAverage[XYZ_AXIS_COUNT];
     gyroGetAccumulationAverage(gyroAverage);
 
-    if (accGetAccumulationAverage(accAverage)) {
+    const bool haveAccData = accGetAccumulationAverage(accAverage);
+    if (haveAccData) {
         useAcc = imuIsAccelerometerHealthy(accAverage);
     }
 
+    // integrate whatever gyro time the loop rate integration didn't cover
+    timeDelta_t gyroDeltaT = deltaT;
+    if (imuRuntimeConfig.fast_attitude) {
+        gyroDeltaT = MIN(gyroAttitudeSkippedUs, (timeDelta_t)deltaT);
+        gyroAttitudeSkippedUs = 0;
+    }
+
     imuMahonyAHRSupdate(deltaT * 1e-6f,
                         DEGREES_TO_RADIANS(gyroAverage[X]), DEGREES_TO_RADIANS(gyroAverage[Y]), DEGREES_TO_RADIANS(gyroAverage[Z]),
+                        gyroDeltaT * 1e-6f,
                         useAcc, accAverage[X], accAverage[Y], accAverage[Z],
                         useMag, mag.magADC[X], mag.magADC[Y], mag.magADC[Z],
                         useCOG, courseOverGround,  imuCalcKpGain(currentTimeUs, useAcc, gyroAverage));
 
     imuUpdateEulerAngles();
+
+    if (haveAccData) {
+        positionUpdateVerticalAcceleration(currentTimeUs, imuCalcVerticalAcceleration(accAverage));
+    }
 #endif
 }
 
@@ -546,6 +596,52 @@ void imuUpdateAttitude(timeUs_t currentTimeUs)
         acc.accADC[Z] = 0;
     }
 }
+
+// Called from the PID loop; integrates the latest filtered gyro sample so that angle/horizon modes
+// see the attitude at loop rate. The (slow) accelerometer/mag/COG correction stays in imuUpdateAttitude().
+FAST_CODE void imuUpdateGyroAttitude(timeUs_t currentTimeUs)
+{
+    const timeDelta_t deltaT = cmpTimeUs(currentTimeUs, previousGyroAttitudeTimeUs);
+    previousGyroAttitudeTimeUs = currentTimeUs;
+
+#if defined(SIMULATOR_BUILD) && !defined(USE_IMU_CALC)
+    UNUSED(deltaT);
+#else
+    if (!imuRuntimeConfig.fast_attitude || deltaT <= 0) {
+        return;
+    }
+    if (!sensors(SENSOR_ACC) || !acc.isAccelUpdatedAtLeastOnce || deltaT > GYRO_ATTITUDE_MAX_DT_US) {
+        IMU_LOCK;
+        gyroAttitudeSkippedUs += deltaT;
+        IMU_UNLOCK;
+        return;
+    }
+
+    // The Euler angles are left to the attitude task, the level modes use imuGetAttitudeAngle()
+    IMU_LOCK;
+    imuIntegrateQuaternion(deltaT * 1e-6f,
+                           DEGREES_TO_RADIANS(gyro.gyroADCf[X]), DEGREES_TO_RADIANS(gyro.gyroADCf[Y]), DEGREES_TO_RADIANS(gyro.gyroADCf[Z]));
+    IMU_UNLOCK;
+#endif
+}
+
+// Roll or pitch in decidegrees, from the loop rate attitude when the gyro is integrated at loop rate
+FAST_CODE int16_t imuGetAttitudeAngle(int axis)
+{
+#if defined(SIMULATOR_BUILD) && !defined(USE_IMU_CALC)
+    return attitude.raw[axis];
+#else
+    if (!imuRuntimeConfig.fast_attitude || FLIGHT_MODE(HEADFREE_MODE)) {
+        return attitude.raw[axis];
+    }
+
+    if (axis == FD_ROLL) {
+        return lrintf(atan2_approx(rMat[2][1], rMat[2][2]) * (1800.0f / M_PIf));
+    } else {
+        return lrintf(((0.5f * M_PIf) - acos_approx(-rMat[2][0])) * (1800.0f / M_PIf));
+    }
+#endif
+}
 #endif // USE_ACC
 
 bool shouldInitializeGPSHeading()
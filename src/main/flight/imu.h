@@ -59,6 +59,7 @@ typedef struct imuConfig_s {
     uint16_t dcm_kp;                        // DCM filter proportional gain ( x 10000)
     uint16_t dcm_ki;                        // DCM filter integral gain ( x 10000)
     uint8_t small_angle;
+    uint8_t fast_attitude;                  // integrate gyro into the attitude at PID loop rate, correct in the attitude task
 } imuConfig_t;
 
 PG_DECLARE(imuConfig_t, imuConfig);
@@ -66,6 +67,7 @@ PG_DECLARE(imuConfig_t, imuConfig);
 typedef struct imuRuntimeConfig_s {
     float dcm_ki;
     float dcm_kp;
+    bool fast_attitude;
 } imuRuntimeConfig_t;
 
 void imuConfigure(uint16_t throttle_correction_angle, uint8_t throttle_correction_value);
@@ -73,6 +75,8 @@ void imuConfigure(uint16_t throttle_correction_angle, uint8_t throttle_correctio
 float getCosTiltAngle(void);
 void getQuaternion(quaternion * q);
 void imuUpdateAttitude(timeUs_t currentTimeUs);
+void imuUpdateGyroAttitude(timeUs_t currentTimeUs);
+int16_t imuGetAttitudeAngle(int axis);
 
 void imuResetAccelerationSum(void);
 void imuInit(void);
@@ -77,10 +77,7 @@ static FAST_RAM_ZERO_INIT bool inCrashRecoveryMode = false;
 static FAST_RAM_ZERO_INIT float dT;
 static FAST_RAM_ZERO_INIT float pidFrequency;
 
-static FAST_RAM_ZERO_INIT uint8_t antiGravityMode;
 static FAST_RAM_ZERO_INIT float antiGravityThrottleHpf;
-static FAST_RAM_ZERO_INIT uint16_t itermAcceleratorGain;
-static FAST_RAM float antiGravityOsdCutoff = 1.0f;
 static FAST_RAM_ZERO_INIT bool antiGravityEnabled;
 static FAST_RAM_ZERO_INIT bool zeroThrottleItermReset;
 
@@ -118,16 +115,124 @@ PG_RESET_TEMPLATE(pidConfig_t, pidConfig,
 #define ACRO_TRAINER_SETPOINT_LIMIT       1000.0f // Limit the correcting setpoint
 #endif // USE_ACRO_TRAINER
 
-#ifdef USE_AIRMODE_LPF
-static FAST_RAM_ZERO_INIT float airmodeThrottleOffsetLimit;
-#endif
-
 #define ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15  // The anti gravity throttle highpass filter cutoff
 
 #define CRASH_RECOVERY_DETECTION_DELAY_US 1000000  // 1 second delay before crash recovery detection is active after entering a self-level mode
 
 #define LAUNCH_CONTROL_YAW_ITERM_LIMIT 50 // yaw iterm windup limit when launch mode is "FULL" (all axes)
 
+typedef union dtermLowpass_u {
+    pt1Filter_t pt1Filter;
+    biquadFilter_t biquadFilter;
+} dtermLowpass_t;
+
+typedef struct pidCoefficient_s {
+    float Kp;
+    float Ki;
+    float Kd;
+    float Kf;
+} pidCoefficient_t;
+
+// Everything the pid controller derives from a pid profile. A block is built for every profile
+// by pidInit(), so that changing profile is a copy rather than a recalculation.
+typedef struct pidRuntime_s {
+    pidCoefficient_t pidCoefficient[XYZ_AXIS_COUNT];
+    float maxVelocity[XYZ_AXIS_COUNT];
+    float feedForwardTransition;
+    float levelGain;
+    float horizonGain;
+    float horizonTransition;
+    float horizonCutoffDegrees;
+    float horizonFactorRatio;
+    float itermWindupPointInv;
+    uint8_t horizonTiltExpertMode;
+    timeDelta_t crashTimeLimitUs;
+    timeDelta_t crashTimeDelayUs;
+    int32_t crashRecoveryAngleDeciDegrees;
+    float crashRecoveryRate;
+    float crashDtermThreshold;
+    float crashGyroThreshold;
+    float crashSetpointThreshold;
+    float crashLimitYaw;
+    float itermLimit;
+    bool itermRotation;
+    uint8_t antiGravityMode;
+    uint16_t itermAcceleratorGain;
+    float antiGravityOsdCutoff;
+#if defined(USE_THROTTLE_BOOST)
+    float throttleBoost;
+#endif
+#if defined(USE_ITERM_RELAX)
+    uint8_t itermRelax;
+    uint8_t itermRelaxType;
+    uint8_t itermRelaxCutoff;
+    float itermRelaxSetpointThreshold;
+#endif
+#if defined(USE_ABSOLUTE_CONTROL)
+    float acGain;
+    float acLimit;
+    float acErrorLimit;
+    float acCutoff;
+#endif
+#ifdef USE_ACRO_TRAINER
+    float acroTrainerAngleLimit;
+    float acroTrainerLookaheadTime;
+    uint8_t acroTrainerDebugAxis;
+    float acroTrainerGain;
+#endif
+#ifdef USE_LAUNCH_CONTROL
+    uint8_t launchControlMode;
+    uint8_t launchControlAngleLimit;
+    float launchControlKi;
+#endif
+#ifdef USE_INTEGRATED_YAW_CONTROL
+    bool useIntegratedYaw;
+    uint8_t integratedYawRelax;
+#endif
+#ifdef USE_THRUST_LINEARIZATION
+    float thrustLinearization;
+    float thrustLinearizationReciprocal;
+    float thrustLinearizationB;
+#endif
+#ifdef USE_DYN_LPF
+    uint8_t dynLpfFilter;
+    uint16_t dynLpfMin;
+    uint16_t dynLpfMax;
+#endif
+#ifdef USE_D_MIN
+    float dMinPercent[XYZ_AXIS_COUNT];
+    float dMinGyroGain;
+    float dMinSetpointGain;
+#endif
+#ifdef USE_AIRMODE_LPF
+    float airmodeThrottleOffsetLimit;
+#endif
+
+    // The profile dependent filters, the same for every axis and with zero state
+    filterApplyFnPtr dtermNotchApplyFn;
+    biquadFilter_t dtermNotch;
+    filterApplyFnPtr dtermLowpassApplyFn;
+    dtermLowpass_t dtermLowpass;
+    filterApplyFnPtr dtermLowpass2ApplyFn;
+    dtermLowpass_t dtermLowpass2;
+    filterApplyFnPtr ptermYawLowpassApplyFn;
+    pt1Filter_t ptermYawLowpass;
+#if defined(USE_THROTTLE_BOOST)
+    pt1Filter_t throttleLpf;
+#endif
+#if defined(USE_ITERM_RELAX)
+    pt1Filter_t windupLpf;
+#endif
+#if defined(USE_ABSOLUTE_CONTROL)
+    pt1Filter_t acLpf;
+#endif
+} pidRuntime_t;
+
+// The runtime of the active profile
+static FAST_RAM_ZERO_INIT pidRuntime_t pidRuntime;
+static FAST_RAM_ZERO_INIT pidRuntime_t pidProfileRuntime[PID_PROFILE_COUNT];
+static FAST_RAM_ZERO_INIT uint8_t pidRuntimeProfileIndex;
+
 PG_REGISTER_ARRAY_WITH_RESET_FN(pidProfile_t, PID_PROFILE_COUNT, pidProfiles, PG_PID_PROFILE, 11);
 
 void resetPidProfile(pidProfile_t *pidProfile)
@@ -238,7 +343,7 @@ void pidSetItermAccelerator(float newItermAccelerator)
 
 bool pidOsdAntiGravityActive(void)
 {
-    return (itermAccelerator > antiGravityOsdCutoff);
+    return (itermAccelerator > pidRuntime.antiGravityOsdCutoff);
 }
 
 void pidStabilisationState(pidStabilisationState_e pidControllerState)
@@ -248,36 +353,19 @@ void pidStabilisationState(pidStabilisationState_e pidControllerState)
 
 const angle_index_t rcAliasToAngleIndexMap[] = { AI_ROLL, AI_PITCH };
 
-typedef union dtermLowpass_u {
-    pt1Filter_t pt1Filter;
-    biquadFilter_t biquadFilter;
-} dtermLowpass_t;
-
 static FAST_RAM_ZERO_INIT float previousPidSetpoint[XYZ_AXIS_COUNT];
 
-static FAST_RAM_ZERO_INIT filterApplyFnPtr dtermNotchApplyFn;
 static FAST_RAM_ZERO_INIT biquadFilter_t dtermNotch[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT filterApplyFnPtr dtermLowpassApplyFn;
 static FAST_RAM_ZERO_INIT dtermLowpass_t dtermLowpass[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT filterApplyFnPtr dtermLowpass2ApplyFn;
 static FAST_RAM_ZERO_INIT dtermLowpass_t dtermLowpass2[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT filterApplyFnPtr ptermYawLowpassApplyFn;
 static FAST_RAM_ZERO_INIT pt1Filter_t ptermYawLowpass;
 
 #if defined(USE_ITERM_RELAX)
 static FAST_RAM_ZERO_INIT pt1Filter_t windupLpf[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT uint8_t itermRelax;
-static FAST_RAM_ZERO_INIT uint8_t itermRelaxType;
-static uint8_t itermRelaxCutoff;
-static FAST_RAM_ZERO_INIT float itermRelaxSetpointThreshold;
 #endif
 
 #if defined(USE_ABSOLUTE_CONTROL)
 STATIC_UNIT_TESTED FAST_RAM_ZERO_INIT float axisError[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT float acGain;
-static FAST_RAM_ZERO_INIT float acLimit;
-static FAST_RAM_ZERO_INIT float acErrorLimit;
-static FAST_RAM_ZERO_INIT float acCutoff;
 static FAST_RAM_ZERO_INIT pt1Filter_t acLpf[XYZ_AXIS_COUNT];
 #endif
 
@@ -301,15 +389,14 @@ static FAST_RAM_ZERO_INIT pt1Filter_t airmodeThrottleLpf2;
 
 static FAST_RAM_ZERO_INIT pt1Filter_t antiGravityThrottleLpf;
 
-void pidInitFilters(const pidProfile_t *pidProfile)
+static void pidBuildRuntimeFilters(pidRuntime_t *runtime, const pidProfile_t *pidProfile)
 {
-    STATIC_ASSERT(FD_YAW == 2, FD_YAW_incorrect); // ensure yaw axis is 2
-
     if (targetPidLooptime == 0) {
         // no looptime set, so set all the filters to null
-        dtermNotchApplyFn = nullFilterApply;
-        dtermLowpassApplyFn = nullFilterApply;
-        ptermYawLowpassApplyFn = nullFilterApply;
+        runtime->dtermNotchApplyFn = nullFilterApply;
+        runtime->dtermLowpassApplyFn = nullFilterApply;
+        runtime->dtermLowpass2ApplyFn = nullFilterApply;
+        runtime->ptermYawLowpassApplyFn = nullFilterApply;
         return;
     }
 
@@ -327,13 +414,11 @@ void pidInitFilters(const pidProfile_t *pidProfile)
     }
 
     if (dTermNotchHz != 0 && pidProfile->dterm_notch_cutoff != 0) {
-        dtermNotchApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        runtime->dtermNotchApplyFn = (filterApplyFnPtr)biquadFilterApply;
         const float notchQ = filterGetNotchQ(dTermNotchHz, pidProfile->dterm_notch_cutoff);
-        for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-            biquadFilterInit(&dtermNotch[axis], dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH);
-        }
+        biquadFilterInit(&runtime->dtermNotch, dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH);
     } else {
-        dtermNotchApplyFn = nullFilterApply;
+        runtime->dtermNotchApplyFn = nullFilterApply;
     }
 
     //1st Dterm Lowpass Filter
@@ -348,95 +433,64 @@ void pidInitFilters(const pidProfile_t *pidProfile)
     if (dterm_lowpass_hz > 0 && dterm_lowpass_hz < pidFrequencyNyquist) {
         switch (pidProfile->dterm_filter_type) {
         case FILTER_PT1:
-            dtermLowpassApplyFn = (filterApplyFnPtr)pt1FilterApply;
-            for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                pt1FilterInit(&dtermLowpass[axis].pt1Filter, pt1FilterGain(dterm_lowpass_hz, dT));
-            }
+            runtime->dtermLowpassApplyFn = (filterApplyFnPtr)pt1FilterApply;
+            pt1FilterInit(&runtime->dtermLowpass.pt1Filter, pt1FilterGain(dterm_lowpass_hz, dT));
             break;
         case FILTER_BIQUAD:
 #ifdef USE_DYN_LPF
-            dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApplyDF1;
+            runtime->dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApplyDF1;
 #else
-            dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApply;
+            runtime->dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApply;
 #endif
-            for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                biquadFilterInitLPF(&dtermLowpass[axis].biquadFilter, dterm_lowpass_hz, targetPidLooptime);
-            }
+            biquadFilterInitLPF(&runtime->dtermLowpass.biquadFilter, dterm_lowpass_hz, targetPidLooptime);
             break;
         default:
-            dtermLowpassApplyFn = nullFilterApply;
+            runtime->dtermLowpassApplyFn = nullFilterApply;
             break;
         }
     } else {
-        dtermLowpassApplyFn = nullFilterApply;
+        runtime->dtermLowpassApplyFn = nullFilterApply;
     }
 
     //2nd Dterm Lowpass Filter
     if (pidProfile->dterm_lowpass2_hz == 0 || pidProfile->dterm_lowpass2_hz > pidFrequencyNyquist) {
-    	dtermLowpass2ApplyFn = nullFilterApply;
+    	runtime->dtermLowpass2ApplyFn = nullFilterApply;
     } else {
         switch (pidProfile->dterm_filter2_type) {
         case FILTER_PT1:
-            dtermLowpass2ApplyFn = (filterApplyFnPtr)pt1FilterApply;
-            for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                pt1FilterInit(&dtermLowpass2[axis].pt1Filter, pt1FilterGain(pidProfile->dterm_lowpass2_hz, dT));
-            }
+            runtime->dtermLowpass2ApplyFn = (filterApplyFnPtr)pt1FilterApply;
+            pt1FilterInit(&runtime->dtermLowpass2.pt1Filter, pt1FilterGain(pidProfile->dterm_lowpass2_hz, dT));
             break;
         case FILTER_BIQUAD:
-            dtermLowpass2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
-            for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                biquadFilterInitLPF(&dtermLowpass2[axis].biquadFilter, pidProfile->dterm_lowpass2_hz, targetPidLooptime);
-            }
+            runtime->dtermLowpass2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+            biquadFilterInitLPF(&runtime->dtermLowpass2.biquadFilter, pidProfile->dterm_lowpass2_hz, targetPidLooptime);
             break;
         default:
-            dtermLowpass2ApplyFn = nullFilterApply;
+            runtime->dtermLowpass2ApplyFn = nullFilterApply;
             break;
         }
     }
 
     if (pidProfile->yaw_lowpass_hz == 0 || pidProfile->yaw_lowpass_hz > pidFrequencyNyquist) {
-        ptermYawLowpassApplyFn = nullFilterApply;
+        runtime->ptermYawLowpassApplyFn = nullFilterApply;
     } else {
-        ptermYawLowpassApplyFn = (filterApplyFnPtr)pt1FilterApply;
-        pt1FilterInit(&ptermYawLowpass, pt1FilterGain(pidProfile->yaw_lowpass_hz, dT));
+        runtime->ptermYawLowpassApplyFn = (filterApplyFnPtr)pt1FilterApply;
+        pt1FilterInit(&runtime->ptermYawLowpass, pt1FilterGain(pidProfile->yaw_lowpass_hz, dT));
     }
 
 #if defined(USE_THROTTLE_BOOST)
-    pt1FilterInit(&throttleLpf, pt1FilterGain(pidProfile->throttle_boost_cutoff, dT));
+    pt1FilterInit(&runtime->throttleLpf, pt1FilterGain(pidProfile->throttle_boost_cutoff, dT));
 #endif
 #if defined(USE_ITERM_RELAX)
-    if (itermRelax) {
-        for (int i = 0; i < XYZ_AXIS_COUNT; i++) {
-            pt1FilterInit(&windupLpf[i], pt1FilterGain(itermRelaxCutoff, dT));
-        }
+    if (runtime->itermRelax) {
+        pt1FilterInit(&runtime->windupLpf, pt1FilterGain(runtime->itermRelaxCutoff, dT));
     }
 #endif
 #if defined(USE_ABSOLUTE_CONTROL)
-    if (itermRelax) {
-        for (int i = 0; i < XYZ_AXIS_COUNT; i++) {
-            pt1FilterInit(&acLpf[i], pt1FilterGain(acCutoff, dT));
-        }
+    if (runtime->itermRelax) {
+        pt1FilterInit(&runtime->acLpf, pt1FilterGain(runtime->acCutoff, dT));
     }
 #endif
-#if defined(USE_D_MIN)
-
-    // Initialize the filters for all axis even if the d_min[axis] value is 0
-    // Otherwise if the pidProfile->d_min_xxx parameters are ever added to
-    // in-flight adjustments and transition from 0 to > 0 in flight the feature
-    // won't work because the filter wasn't initialized.
-    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-        biquadFilterInitLPF(&dMinRange[axis], D_MIN_RANGE_HZ, targetPidLooptime);
-        pt1FilterInit(&dMinLowpass[axis], pt1FilterGain(D_MIN_LOWPASS_HZ, dT));
-     }
-#endif
-#if defined(USE_AIRMODE_LPF)
-    if (pidProfile->transient_throttle_limit) {
-        pt1FilterInit(&airmodeThrottleLpf1, pt1FilterGain(7.0f, dT));
-        pt1FilterInit(&airmodeThrottleLpf2, pt1FilterGain(20.0f, dT));
-    }
-#endif
-
-    pt1FilterInit(&antiGravityThrottleLpf, pt1FilterGain(ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF, dT));
 }
 
 #ifdef USE_RC_SMOOTHING_FILTER
@@ -476,43 +530,15 @@ void pidUpdateSetpointDerivativeLpf(uint16_t filterCutoff)
 }
 #endif // USE_RC_SMOOTHING_FILTER
 
-typedef struct pidCoefficient_s {
-    float Kp;
-    float Ki;
-    float Kd;
-    float Kf;
-} pidCoefficient_t;
-
-static FAST_RAM_ZERO_INIT pidCoefficient_t pidCoefficient[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT float maxVelocity[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT float feedForwardTransition;
-static FAST_RAM_ZERO_INIT float levelGain, horizonGain, horizonTransition, horizonCutoffDegrees, horizonFactorRatio;
-static FAST_RAM_ZERO_INIT float itermWindupPointInv;
-static FAST_RAM_ZERO_INIT uint8_t horizonTiltExpertMode;
-static FAST_RAM_ZERO_INIT timeDelta_t crashTimeLimitUs;
-static FAST_RAM_ZERO_INIT timeDelta_t crashTimeDelayUs;
-static FAST_RAM_ZERO_INIT int32_t crashRecoveryAngleDeciDegrees;
-static FAST_RAM_ZERO_INIT float crashRecoveryRate;
-static FAST_RAM_ZERO_INIT float crashDtermThreshold;
-static FAST_RAM_ZERO_INIT float crashGyroThreshold;
-static FAST_RAM_ZERO_INIT float crashSetpointThreshold;
-static FAST_RAM_ZERO_INIT float crashLimitYaw;
-static FAST_RAM_ZERO_INIT float itermLimit;
 #if defined(USE_THROTTLE_BOOST)
 FAST_RAM_ZERO_INIT float throttleBoost;
 pt1Filter_t throttleLpf;
 #endif
-static FAST_RAM_ZERO_INIT bool itermRotation;
 
 #ifdef USE_LAUNCH_CONTROL
-static FAST_RAM_ZERO_INIT uint8_t launchControlMode;
-static FAST_RAM_ZERO_INIT uint8_t launchControlAngleLimit;
-static FAST_RAM_ZERO_INIT float launchControlKi;
 #endif
 
 #ifdef USE_INTEGRATED_YAW_CONTROL
-static FAST_RAM_ZERO_INIT bool useIntegratedYaw;
-static FAST_RAM_ZERO_INIT uint8_t integratedYawRelax;
 #endif
 
 void pidResetIterm(void)
@@ -526,190 +552,299 @@ void pidResetIterm(void)
 }
 
 #ifdef USE_ACRO_TRAINER
-static FAST_RAM_ZERO_INIT float acroTrainerAngleLimit;
-static FAST_RAM_ZERO_INIT float acroTrainerLookaheadTime;
-static FAST_RAM_ZERO_INIT uint8_t acroTrainerDebugAxis;
 static FAST_RAM_ZERO_INIT bool acroTrainerActive;
 static FAST_RAM_ZERO_INIT int acroTrainerAxisState[2];  // only need roll and pitch
-static FAST_RAM_ZERO_INIT float acroTrainerGain;
 #endif // USE_ACRO_TRAINER
 
 #ifdef USE_THRUST_LINEARIZATION
-FAST_RAM_ZERO_INIT float thrustLinearization;
-FAST_RAM_ZERO_INIT float thrustLinearizationReciprocal;
-FAST_RAM_ZERO_INIT float thrustLinearizationB;
 #endif
 
 void pidUpdateAntiGravityThrottleFilter(float throttle)
 {
-    if (antiGravityMode == ANTI_GRAVITY_SMOOTH) {
+    if (pidRuntime.antiGravityMode == ANTI_GRAVITY_SMOOTH) {
         antiGravityThrottleHpf = throttle - pt1FilterApply(&antiGravityThrottleLpf, throttle);
     }
 }
 
 #ifdef USE_DYN_LPF
-static FAST_RAM uint8_t dynLpfFilter = DYN_LPF_NONE;
-static FAST_RAM_ZERO_INIT uint16_t dynLpfMin;
-static FAST_RAM_ZERO_INIT uint16_t dynLpfMax;
 #endif
 
 #ifdef USE_D_MIN
-static FAST_RAM_ZERO_INIT float dMinPercent[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT float dMinGyroGain;
-static FAST_RAM_ZERO_INIT float dMinSetpointGain;
 #endif
 
-void pidInitConfig(const pidProfile_t *pidProfile)
+static void pidBuildRuntime(pidRuntime_t *runtime, const pidProfile_t *pidProfile)
 {
+    memset(runtime, 0, sizeof(*runtime));
+
     if (pidProfile->feedForwardTransition == 0) {
-        feedForwardTransition = 0;
+        runtime->feedForwardTransition = 0;
     } else {
-        feedForwardTransition = 100.0f / pidProfile->feedForwardTransition;
+        runtime->feedForwardTransition = 100.0f / pidProfile->feedForwardTransition;
     }
     for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-        pidCoefficient[axis].Kp = PTERM_SCALE * pidProfile->pid[axis].P;
-        pidCoefficient[axis].Ki = ITERM_SCALE * pidProfile->pid[axis].I;
-        pidCoefficient[axis].Kd = DTERM_SCALE * pidProfile->pid[axis].D;
-        pidCoefficient[axis].Kf = FEEDFORWARD_SCALE * (pidProfile->pid[axis].F / 100.0f);
+        runtime->pidCoefficient[axis].Kp = PTERM_SCALE * pidProfile->pid[axis].P;
+        runtime->pidCoefficient[axis].Ki = ITERM_SCALE * pidProfile->pid[axis].I;
+        runtime->pidCoefficient[axis].Kd = DTERM_SCALE * pidProfile->pid[axis].D;
+        runtime->pidCoefficient[axis].Kf = FEEDFORWARD_SCALE * (pidProfile->pid[axis].F / 100.0f);
     }
 #ifdef USE_INTEGRATED_YAW_CONTROL
     if (!pidProfile->use_integrated_yaw)
 #endif
     {
-        pidCoefficient[FD_YAW].Ki *= 2.5f;
+        runtime->pidCoefficient[FD_YAW].Ki *= 2.5f;
     }
 
-    levelGain = pidProfile->pid[PID_LEVEL].P / 10.0f;
-    horizonGain = pidProfile->pid[PID_LEVEL].I / 10.0f;
-    horizonTransition = (float)pidProfile->pid[PID_LEVEL].D;
-    horizonTiltExpertMode = pidProfile->horizon_tilt_expert_mode;
-    horizonCutoffDegrees = (175 - pidProfile->horizon_tilt_effect) * 1.8f;
-    horizonFactorRatio = (100 - pidProfile->horizon_tilt_effect) * 0.01f;
-    maxVelocity[FD_ROLL] = maxVelocity[FD_PITCH] = pidProfile->rateAccelLimit * 100 * dT;
-    maxVelocity[FD_YAW] = pidProfile->yawRateAccelLimit * 100 * dT;
-    itermWindupPointInv = 1.0f;
+    runtime->levelGain = pidProfile->pid[PID_LEVEL].P / 10.0f;
+    runtime->horizonGain = pidProfile->pid[PID_LEVEL].I / 10.0f;
+    runtime->horizonTransition = (float)pidProfile->pid[PID_LEVEL].D;
+    runtime->horizonTiltExpertMode = pidProfile->horizon_tilt_expert_mode;
+    runtime->horizonCutoffDegrees = (175 - pidProfile->horizon_tilt_effect) * 1.8f;
+    runtime->horizonFactorRatio = (100 - pidProfile->horizon_tilt_effect) * 0.01f;
+    runtime->maxVelocity[FD_ROLL] = runtime->maxVelocity[FD_PITCH] = pidProfile->rateAccelLimit * 100 * dT;
+    runtime->maxVelocity[FD_YAW] = pidProfile->yawRateAccelLimit * 100 * dT;
+    runtime->itermWindupPointInv = 1.0f;
     if (pidProfile->itermWindupPointPercent < 100) {
         const float itermWindupPoint = pidProfile->itermWindupPointPercent / 100.0f;
-        itermWindupPointInv = 1.0f / (1.0f - itermWindupPoint);
+        runtime->itermWindupPointInv = 1.0f / (1.0f - itermWindupPoint);
     }
-    itermAcceleratorGain = pidProfile->itermAcceleratorGain;
-    crashTimeLimitUs = pidProfile->crash_time * 1000;
-    crashTimeDelayUs = pidProfile->crash_delay * 1000;
-    crashRecoveryAngleDeciDegrees = pidProfile->crash_recovery_angle * 10;
-    crashRecoveryRate = pidProfile->crash_recovery_rate;
-    crashGyroThreshold = pidProfile->crash_gthreshold;
-    crashDtermThreshold = pidProfile->crash_dthreshold;
-    crashSetpointThreshold = pidProfile->crash_setpoint_threshold;
-    crashLimitYaw = pidProfile->crash_limit_yaw;
-    itermLimit = pidProfile->itermLimit;
+    runtime->itermAcceleratorGain = pidProfile->itermAcceleratorGain;
+    runtime->crashTimeLimitUs = pidProfile->crash_time * 1000;
+    runtime->crashTimeDelayUs = pidProfile->crash_delay * 1000;
+    runtime->crashRecoveryAngleDeciDegrees = pidProfile->crash_recovery_angle * 10;
+    runtime->crashRecoveryRate = pidProfile->crash_recovery_rate;
+    runtime->crashGyroThreshold = pidProfile->crash_gthreshold;
+    runtime->crashDtermThreshold = pidProfile->crash_dthreshold;
+    runtime->crashSetpointThreshold = pidProfile->crash_setpoint_threshold;
+    runtime->crashLimitYaw = pidProfile->crash_limit_yaw;
+    runtime->itermLimit = pidProfile->itermLimit;
 #if defined(USE_THROTTLE_BOOST)
-    throttleBoost = pidProfile->throttle_boost * 0.1f;
+    runtime->throttleBoost = pidProfile->throttle_boost * 0.1f;
 #endif
-    itermRotation = pidProfile->iterm_rotation;
-    antiGravityMode = pidProfile->antiGravityMode;
+    runtime->itermRotation = pidProfile->iterm_rotation;
+    runtime->antiGravityMode = pidProfile->antiGravityMode;
     
     // Calculate the anti-gravity value that will trigger the OSD display.
     // For classic AG it's either 1.0 for off and > 1.0 for on.
     // For the new AG it's a continuous floating value so we want to trigger the OSD
     // display when it exceeds 25% of its possible range. This gives a useful indication
     // of AG activity without excessive display.
-    antiGravityOsdCutoff = 1.0f;
-    if (antiGravityMode == ANTI_GRAVITY_SMOOTH) {
-        antiGravityOsdCutoff += ((itermAcceleratorGain - 1000) / 1000.0f) * 0.25f;
+    runtime->antiGravityOsdCutoff = 1.0f;
+    if (runtime->antiGravityMode == ANTI_GRAVITY_SMOOTH) {
+        runtime->antiGravityOsdCutoff += ((runtime->itermAcceleratorGain - 1000) / 1000.0f) * 0.25f;
     }
 
 #if defined(USE_ITERM_RELAX)
-    itermRelax = pidProfile->iterm_relax;
-    itermRelaxType = pidProfile->iterm_relax_type;
-    itermRelaxCutoff = pidProfile->iterm_relax_cutoff;
+    runtime->itermRelax = pidProfile->iterm_relax;
+    runtime->itermRelaxType = pidProfile->iterm_relax_type;
+    runtime->itermRelaxCutoff = pidProfile->iterm_relax_cutoff;
     // adapt setpoint threshold to user changes from default cutoff value
-    itermRelaxSetpointThreshold = ITERM_RELAX_SETPOINT_THRESHOLD * ITERM_RELAX_CUTOFF_DEFAULT / itermRelaxCutoff;
+    runtime->itermRelaxSetpointThreshold = ITERM_RELAX_SETPOINT_THRESHOLD * ITERM_RELAX_CUTOFF_DEFAULT / runtime->itermRelaxCutoff;
 #endif
 
 #ifdef USE_ACRO_TRAINER
-    acroTrainerAngleLimit = pidProfile->acro_trainer_angle_limit;
-    acroTrainerLookaheadTime = (float)pidProfile->acro_trainer_lookahead_ms / 1000.0f;
-    acroTrainerDebugAxis = pidProfile->acro_trainer_debug_axis;
-    acroTrainerGain = (float)pidProfile->acro_trainer_gain / 10.0f;
+    runtime->acroTrainerAngleLimit = pidProfile->acro_trainer_angle_limit;
+    runtime->acroTrainerLookaheadTime = (float)pidProfile->acro_trainer_lookahead_ms / 1000.0f;
+    runtime->acroTrainerDebugAxis = pidProfile->acro_trainer_debug_axis;
+    runtime->acroTrainerGain = (float)pidProfile->acro_trainer_gain / 10.0f;
 #endif // USE_ACRO_TRAINER
 
 #if defined(USE_ABSOLUTE_CONTROL)
-    acGain = (float)pidProfile->abs_control_gain;
-    acLimit = (float)pidProfile->abs_control_limit;
-    acErrorLimit = (float)pidProfile->abs_control_error_limit;
-    acCutoff = (float)pidProfile->abs_control_cutoff;
+    runtime->acGain = (float)pidProfile->abs_control_gain;
+    runtime->acLimit = (float)pidProfile->abs_control_limit;
+    runtime->acErrorLimit = (float)pidProfile->abs_control_error_limit;
+    runtime->acCutoff = (float)pidProfile->abs_control_cutoff;
 #endif
 
 #ifdef USE_DYN_LPF
     if (pidProfile->dyn_lpf_dterm_min_hz > 0) {
         switch (pidProfile->dterm_filter_type) {
         case FILTER_PT1:
-            dynLpfFilter = DYN_LPF_PT1;
+            runtime->dynLpfFilter = DYN_LPF_PT1;
             break;
         case FILTER_BIQUAD:
-            dynLpfFilter = DYN_LPF_BIQUAD;
+            runtime->dynLpfFilter = DYN_LPF_BIQUAD;
             break;
         default:
-            dynLpfFilter = DYN_LPF_NONE;
+            runtime->dynLpfFilter = DYN_LPF_NONE;
             break;
         }
     } else {
-        dynLpfFilter = DYN_LPF_NONE;
+        runtime->dynLpfFilter = DYN_LPF_NONE;
     }
-    dynLpfMin = pidProfile->dyn_lpf_dterm_min_hz;
-    dynLpfMax = pidProfile->dyn_lpf_dterm_max_hz;
+    runtime->dynLpfMin = pidProfile->dyn_lpf_dterm_min_hz;
+    runtime->dynLpfMax = pidProfile->dyn_lpf_dterm_max_hz;
 #endif
 
 #ifdef USE_LAUNCH_CONTROL
-    launchControlMode = pidProfile->launchControlMode;
+    runtime->launchControlMode = pidProfile->launchControlMode;
     if (sensors(SENSOR_ACC)) {
-        launchControlAngleLimit = pidProfile->launchControlAngleLimit;
+        runtime->launchControlAngleLimit = pidProfile->launchControlAngleLimit;
     } else {
-        launchControlAngleLimit = 0;
+        runtime->launchControlAngleLimit = 0;
     }
-    launchControlKi = ITERM_SCALE * pidProfile->launchControlGain;
+    runtime->launchControlKi = ITERM_SCALE * pidProfile->launchControlGain;
 #endif
 
 #ifdef USE_INTEGRATED_YAW_CONTROL
-    useIntegratedYaw = pidProfile->use_integrated_yaw;
-    integratedYawRelax = pidProfile->integrated_yaw_relax;
+    runtime->useIntegratedYaw = pidProfile->use_integrated_yaw;
+    runtime->integratedYawRelax = pidProfile->integrated_yaw_relax;
 #endif
 
 #ifdef USE_THRUST_LINEARIZATION
-    thrustLinearization = pidProfile->thrustLinearization / 100.0f;
-    if (thrustLinearization != 0.0f) {
-        thrustLinearizationReciprocal = 1.0f / thrustLinearization;
-        thrustLinearizationB = (1.0f - thrustLinearization) / (2.0f * thrustLinearization);
+    runtime->thrustLinearization = pidProfile->thrustLinearization / 100.0f;
+    if (runtime->thrustLinearization != 0.0f) {
+        runtime->thrustLinearizationReciprocal = 1.0f / runtime->thrustLinearization;
+        runtime->thrustLinearizationB = (1.0f - runtime->thrustLinearization) / (2.0f * runtime->thrustLinearization);
     }
 #endif    
 #if defined(USE_D_MIN)
     for (int axis = FD_ROLL; axis <= FD_YAW; ++axis) {
         const uint8_t dMin = pidProfile->d_min[axis];
         if ((dMin > 0) && (dMin < pidProfile->pid[axis].D)) {
-            dMinPercent[axis] = dMin / (float)(pidProfile->pid[axis].D);
+            runtime->dMinPercent[axis] = dMin / (float)(pidProfile->pid[axis].D);
         } else {
-            dMinPercent[axis] = 0;
+            runtime->dMinPercent[axis] = 0;
         }
     }
-    dMinGyroGain = pidProfile->d_min_gain * D_MIN_GAIN_FACTOR / D_MIN_LOWPASS_HZ;
-    dMinSetpointGain = pidProfile->d_min_gain * D_MIN_SETPOINT_GAIN_FACTOR * pidProfile->d_min_advance * pidFrequency / (100 * D_MIN_LOWPASS_HZ);
+    runtime->dMinGyroGain = pidProfile->d_min_gain * D_MIN_GAIN_FACTOR / D_MIN_LOWPASS_HZ;
+    runtime->dMinSetpointGain = pidProfile->d_min_gain * D_MIN_SETPOINT_GAIN_FACTOR * pidProfile->d_min_advance * pidFrequency / (100 * D_MIN_LOWPASS_HZ);
     // lowpass included inversely in gain since stronger lowpass decreases peak effect
 #endif
 #if defined(USE_AIRMODE_LPF)
-    airmodeThrottleOffsetLimit = pidProfile->transient_throttle_limit / 100.0f;
+    runtime->airmodeThrottleOffsetLimit = pidProfile->transient_throttle_limit / 100.0f;
+#endif
+
+    // the filters use the constants above
+    pidBuildRuntimeFilters(runtime, pidProfile);
+}
+
+static void pidInitFixedFilters(void)
+{
+#if defined(USE_D_MIN)
+
+    // Initialize the filters for all axis even if the d_min[axis] value is 0
+    // Otherwise if the pidProfile->d_min_xxx parameters are ever added to
+    // in-flight adjustments and transition from 0 to > 0 in flight the feature
+    // won't work because the filter wasn't initialized.
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        biquadFilterInitLPF(&dMinRange[axis], D_MIN_RANGE_HZ, targetPidLooptime);
+        pt1FilterInit(&dMinLowpass[axis], pt1FilterGain(D_MIN_LOWPASS_HZ, dT));
+     }
+#endif
+#if defined(USE_AIRMODE_LPF)
+    // Any profile may enable the transient throttle limit, so the filters are ready when it is loaded
+    pt1FilterInit(&airmodeThrottleLpf1, pt1FilterGain(7.0f, dT));
+    pt1FilterInit(&airmodeThrottleLpf2, pt1FilterGain(20.0f, dT));
+#endif
+
+    pt1FilterInit(&antiGravityThrottleLpf, pt1FilterGain(ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF, dT));
+}
+
+static void pidLoadBiquadFilter(biquadFilter_t *filter, const biquadFilter_t *from, bool keepState)
+{
+    if (keepState) {
+        filter->b0 = from->b0;
+        filter->b1 = from->b1;
+        filter->b2 = from->b2;
+        filter->a1 = from->a1;
+        filter->a2 = from->a2;
+    } else {
+        *filter = *from;
+    }
+}
+
+static void pidLoadPt1Filter(pt1Filter_t *filter, const pt1Filter_t *from, bool keepState)
+{
+    if (keepState) {
+        filter->k = from->k;
+    } else {
+        *filter = *from;
+    }
+}
+
+static void pidLoadDtermLowpass(dtermLowpass_t *filter, filterApplyFnPtr applyFn, const dtermLowpass_t *from, bool keepState)
+{
+    if (applyFn == (filterApplyFnPtr)pt1FilterApply) {
+        pidLoadPt1Filter(&filter->pt1Filter, &from->pt1Filter, keepState);
+    } else {
+        pidLoadBiquadFilter(&filter->biquadFilter, &from->biquadFilter, keepState);
+    }
+}
+
+// Make a runtime block the active one. Filters that keep their type also keep their state,
+// so changing profile in flight doesn't kick the D term.
+static void pidLoadRuntime(uint8_t pidProfileIndex, bool resetFilters)
+{
+    const pidRuntime_t *runtime = &pidProfileRuntime[pidProfileIndex];
+    const bool keepNotch = !resetFilters && runtime->dtermNotchApplyFn == pidRuntime.dtermNotchApplyFn;
+    const bool keepLowpass = !resetFilters && runtime->dtermLowpassApplyFn == pidRuntime.dtermLowpassApplyFn;
+    const bool keepLowpass2 = !resetFilters && runtime->dtermLowpass2ApplyFn == pidRuntime.dtermLowpass2ApplyFn;
+    const bool keepYawLowpass = !resetFilters && runtime->ptermYawLowpassApplyFn == pidRuntime.ptermYawLowpassApplyFn;
+#if defined(USE_ITERM_RELAX)
+    const bool keepRelax = !resetFilters && pidRuntime.itermRelax;
+#endif
+
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        pidLoadBiquadFilter(&dtermNotch[axis], &runtime->dtermNotch, keepNotch);
+        pidLoadDtermLowpass(&dtermLowpass[axis], runtime->dtermLowpassApplyFn, &runtime->dtermLowpass, keepLowpass);
+        pidLoadDtermLowpass(&dtermLowpass2[axis], runtime->dtermLowpass2ApplyFn, &runtime->dtermLowpass2, keepLowpass2);
+#if defined(USE_ITERM_RELAX)
+        pidLoadPt1Filter(&windupLpf[axis], &runtime->windupLpf, keepRelax);
+#endif
+#if defined(USE_ABSOLUTE_CONTROL)
+        pidLoadPt1Filter(&acLpf[axis], &runtime->acLpf, keepRelax);
+#endif
+    }
+    pidLoadPt1Filter(&ptermYawLowpass, &runtime->ptermYawLowpass, keepYawLowpass);
+#if defined(USE_THROTTLE_BOOST)
+    pidLoadPt1Filter(&throttleLpf, &runtime->throttleLpf, !resetFilters);
+#endif
+
+    pidRuntime = *runtime;
+    pidRuntimeProfileIndex = pidProfileIndex;
+#if defined(USE_THROTTLE_BOOST)
+    throttleBoost = pidRuntime.throttleBoost;
 #endif
 }
 
+static void pidUpdateRuntime(const pidProfile_t *pidProfile, bool resetFilters)
+{
+    const uint8_t pidProfileIndex = pidProfile - pidProfiles(0);
+
+    pidBuildRuntime(&pidProfileRuntime[pidProfileIndex], pidProfile);
+    pidLoadRuntime(pidProfileIndex, resetFilters);
+}
+
+void pidInitFilters(const pidProfile_t *pidProfile)
+{
+    STATIC_ASSERT(FD_YAW == 2, FD_YAW_incorrect); // ensure yaw axis is 2
+
+    pidInitFixedFilters();
+    pidUpdateRuntime(pidProfile, true);
+}
+
+void pidInitConfig(const pidProfile_t *pidProfile)
+{
+    pidUpdateRuntime(pidProfile, false);
+}
+
 void pidInit(const pidProfile_t *pidProfile)
 {
     pidSetTargetLooptime(gyro.targetLooptime * pidConfig()->pid_process_denom); // Initialize pid looptime
+    for (int i = 0; i < PID_PROFILE_COUNT; i++) {
+        pidBuildRuntime(&pidProfileRuntime[i], pidProfiles(i));
+    }
     pidInitFilters(pidProfile);
-    pidInitConfig(pidProfile);
 #ifdef USE_RPM_FILTER
     rpmFilterInit(rpmFilterConfig());
 #endif
 }
 
+void pidChangeProfile(uint8_t pidProfileIndex)
+{
+    pidLoadRuntime(pidProfileIndex, false);
+}
+
 #ifdef USE_ACRO_TRAINER
 void pidAcroTrainerInit(void)
 {
@@ -721,18 +856,18 @@ void pidAcroTrainerInit(void)
 #ifdef USE_THRUST_LINEARIZATION
 float pidCompensateThrustLinearization(float throttle)
 {
-    if (thrustLinearization != 0.0f) {
-        throttle = throttle * (throttle * thrustLinearization + 1.0f - thrustLinearization);
+    if (pidRuntime.thrustLinearization != 0.0f) {
+        throttle = throttle * (throttle * pidRuntime.thrustLinearization + 1.0f - pidRuntime.thrustLinearization);
     }
     return throttle;
 }
 
 float pidApplyThrustLinearization(float motorOutput)
 {
-    if (thrustLinearization != 0.0f) {
+    if (pidRuntime.thrustLinearization != 0.0f) {
         if (motorOutput > 0.0f) {
-            motorOutput = sqrtf(motorOutput * thrustLinearizationReciprocal +
-                                thrustLinearizationB * thrustLinearizationB) - thrustLinearizationB;
+            motorOutput = sqrtf(motorOutput * pidRuntime.thrustLinearizationReciprocal +
+                                pidRuntime.thrustLinearizationB * pidRuntime.thrustLinearizationB) - pidRuntime.thrustLinearizationB;
         }
     }
     return motorOutput;
@@ -745,6 +880,10 @@ void pidCopyProfile(uint8_t dstPidProfileIndex, uint8_t srcPidProfileIndex)
         && dstPidProfileIndex != srcPidProfileIndex
     ) {
         memcpy(pidProfilesMutable(dstPidProfileIndex), pidProfilesMutable(srcPidProfileIndex), sizeof(pidProfile_t));
+        pidProfileRuntime[dstPidProfileIndex] = pidProfileRuntime[srcPidProfileIndex];
+        if (dstPidProfileIndex == pidRuntimeProfileIndex) {
+            pidLoadRuntime(dstPidProfileIndex, false);
+        }
     }
 }
 
@@ -758,21 +897,21 @@ STATIC_UNIT_TESTED float calcHorizonLevelStrength(void)
     // 0 at level, 90 at vertical, 180 at inverted (degrees):
     const float currentInclination = MAX(ABS(attitude.values.roll), ABS(attitude.values.pitch)) / 10.0f;
 
-    // horizonTiltExpertMode:  0 = leveling always active when sticks centered,
+    // pidRuntime.horizonTiltExpertMode:  0 = leveling always active when sticks centered,
     //                         1 = leveling can be totally off when inverted
-    if (horizonTiltExpertMode) {
-        if (horizonTransition > 0 && horizonCutoffDegrees > 0) {
+    if (pidRuntime.horizonTiltExpertMode) {
+        if (pidRuntime.horizonTransition > 0 && pidRuntime.horizonCutoffDegrees > 0) {
                     // if d_level > 0 and horizonTiltEffect < 175
-            // horizonCutoffDegrees: 0 to 125 => 270 to 90 (represents where leveling goes to zero)
+            // pidRuntime.horizonCutoffDegrees: 0 to 125 => 270 to 90 (represents where leveling goes to zero)
             // inclinationLevelRatio (0.0 to 1.0) is smaller (less leveling)
-            //  for larger inclinations; 0.0 at horizonCutoffDegrees value:
-            const float inclinationLevelRatio = constrainf((horizonCutoffDegrees-currentInclination) / horizonCutoffDegrees, 0, 1);
+            //  for larger inclinations; 0.0 at pidRuntime.horizonCutoffDegrees value:
+            const float inclinationLevelRatio = constrainf((pidRuntime.horizonCutoffDegrees-currentInclination) / pidRuntime.horizonCutoffDegrees, 0, 1);
             // apply configured horizon sensitivity:
                 // when stick is near center (horizonLevelStrength ~= 1.0)
                 //  H_sensitivity value has little effect,
                 // when stick is deflected (horizonLevelStrength near 0.0)
                 //  H_sensitivity value has more effect:
-            horizonLevelStrength = (horizonLevelStrength - 1) * 100 / horizonTransition + 1;
+            horizonLevelStrength = (horizonLevelStrength - 1) * 100 / pidRuntime.horizonTransition + 1;
             // apply inclination ratio, which may lower leveling
             //  to zero regardless of stick position:
             horizonLevelStrength *= inclinationLevelRatio;
@@ -781,15 +920,15 @@ STATIC_UNIT_TESTED float calcHorizonLevelStrength(void)
         }
     } else { // horizon_tilt_expert_mode = 0 (leveling always active when sticks centered)
         float sensitFact;
-        if (horizonFactorRatio < 1.01f) { // if horizonTiltEffect > 0
-            // horizonFactorRatio: 1.0 to 0.0 (larger means more leveling)
+        if (pidRuntime.horizonFactorRatio < 1.01f) { // if horizonTiltEffect > 0
+            // pidRuntime.horizonFactorRatio: 1.0 to 0.0 (larger means more leveling)
             // inclinationLevelRatio (0.0 to 1.0) is smaller (less leveling)
             //  for larger inclinations, goes to 1.0 at inclination==level:
-            const float inclinationLevelRatio = (180-currentInclination)/180 * (1.0f-horizonFactorRatio) + horizonFactorRatio;
+            const float inclinationLevelRatio = (180-currentInclination)/180 * (1.0f-pidRuntime.horizonFactorRatio) + pidRuntime.horizonFactorRatio;
             // apply ratio to configured horizon sensitivity:
-            sensitFact = horizonTransition * inclinationLevelRatio;
+            sensitFact = pidRuntime.horizonTransition * inclinationLevelRatio;
         } else { // horizonTiltEffect=0 for "old" functionality
-            sensitFact = horizonTransition;
+            sensitFact = pidRuntime.horizonTransition;
         }
 
         if (sensitFact <= 0) {           // zero means no leveling
@@ -813,15 +952,15 @@ STATIC_UNIT_TESTED float pidLevel(int axis, const pidProfile_t *pidProfile, cons
     angle += gpsRescueAngle[axis] / 100; // ANGLE IS IN CENTIDEGREES
 #endif
     angle = constrainf(angle, -pidProfile->levelAngleLimit, pidProfile->levelAngleLimit);
-    const float errorAngle = angle - ((attitude.raw[axis] - angleTrim->raw[axis]) / 10.0f);
+    const float errorAngle = angle - ((imuGetAttitudeAngle(axis) - angleTrim->raw[axis]) / 10.0f);
     if (FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(GPS_RESCUE_MODE)) {
         // ANGLE mode - control is angle based
-        currentPidSetpoint = errorAngle * levelGain;
+        currentPidSetpoint = errorAngle * pidRuntime.levelGain;
     } else {
         // HORIZON mode - mix of ANGLE and ACRO modes
         // mix in errorAngle to currentPidSetpoint to add a little auto-level feel
         const float horizonLevelStrength = calcHorizonLevelStrength();
-        currentPidSetpoint = currentPidSetpoint + (errorAngle * horizonGain * horizonLevelStrength);
+        currentPidSetpoint = currentPidSetpoint + (errorAngle * pidRuntime.horizonGain * horizonLevelStrength);
     }
     return currentPidSetpoint;
 }
@@ -832,33 +971,33 @@ static void handleCrashRecovery(
     const pidCrashRecovery_e crash_recovery, const rollAndPitchTrims_t *angleTrim,
     const int axis, const timeUs_t currentTimeUs, const float gyroRate, float *currentPidSetpoint, float *errorRate)
 {
-    if (inCrashRecoveryMode && cmpTimeUs(currentTimeUs, crashDetectedAtUs) > crashTimeDelayUs) {
+    if (inCrashRecoveryMode && cmpTimeUs(currentTimeUs, crashDetectedAtUs) > pidRuntime.crashTimeDelayUs) {
         if (crash_recovery == PID_CRASH_RECOVERY_BEEP) {
             BEEP_ON;
         }
         if (axis == FD_YAW) {
-            *errorRate = constrainf(*errorRate, -crashLimitYaw, crashLimitYaw);
+            *errorRate = constrainf(*errorRate, -pidRuntime.crashLimitYaw, pidRuntime.crashLimitYaw);
         } else {
             // on roll and pitch axes calculate currentPidSetpoint and errorRate to level the aircraft to recover from crash
             if (sensors(SENSOR_ACC)) {
                 // errorAngle is deviation from horizontal
                 const float errorAngle =  -(attitude.raw[axis] - angleTrim->raw[axis]) / 10.0f;
-                *currentPidSetpoint = errorAngle * levelGain;
+                *currentPidSetpoint = errorAngle * pidRuntime.levelGain;
                 *errorRate = *currentPidSetpoint - gyroRate;
             }
         }
         // reset iterm, since accumulated error before crash is now meaningless
         // and iterm windup during crash recovery can be extreme, especially on yaw axis
         pidData[axis].I = 0.0f;
-        if (cmpTimeUs(currentTimeUs, crashDetectedAtUs) > crashTimeLimitUs
+        if (cmpTimeUs(currentTimeUs, crashDetectedAtUs) > pidRuntime.crashTimeLimitUs
             || (getMotorMixRange() < 1.0f
-                   && fabsf(gyro.gyroADCf[FD_ROLL]) < crashRecoveryRate
-                   && fabsf(gyro.gyroADCf[FD_PITCH]) < crashRecoveryRate
-                   && fabsf(gyro.gyroADCf[FD_YAW]) < crashRecoveryRate)) {
+                   && fabsf(gyro.gyroADCf[FD_ROLL]) < pidRuntime.crashRecoveryRate
+                   && fabsf(gyro.gyroADCf[FD_PITCH]) < pidRuntime.crashRecoveryRate
+                   && fabsf(gyro.gyroADCf[FD_YAW]) < pidRuntime.crashRecoveryRate)) {
             if (sensors(SENSOR_ACC)) {
                 // check aircraft nearly level
-                if (ABS(attitude.raw[FD_ROLL] - angleTrim->raw[FD_ROLL]) < crashRecoveryAngleDeciDegrees
-                   && ABS(attitude.raw[FD_PITCH] - angleTrim->raw[FD_PITCH]) < crashRecoveryAngleDeciDegrees) {
+                if (ABS(attitude.raw[FD_ROLL] - angleTrim->raw[FD_ROLL]) < pidRuntime.crashRecoveryAngleDeciDegrees
+                   && ABS(attitude.raw[FD_PITCH] - angleTrim->raw[FD_PITCH]) < pidRuntime.crashRecoveryAngleDeciDegrees) {
                     inCrashRecoveryMode = false;
                     BEEP_OFF;
                 }
@@ -879,9 +1018,9 @@ static void detectAndSetCrashRecovery(
     if ((crash_recovery || FLIGHT_MODE(GPS_RESCUE_MODE)) && !gyroOverflowDetected()) {
         if (ARMING_FLAG(ARMED)) {
             if (getMotorMixRange() >= 1.0f && !inCrashRecoveryMode
-                && fabsf(delta) > crashDtermThreshold
-                && fabsf(errorRate) > crashGyroThreshold
-                && fabsf(getSetpointRate(axis)) < crashSetpointThreshold) {
+                && fabsf(delta) > pidRuntime.crashDtermThreshold
+                && fabsf(errorRate) > pidRuntime.crashGyroThreshold
+                && fabsf(getSetpointRate(axis)) < pidRuntime.crashSetpointThreshold) {
                 if (crash_recovery == PID_CRASH_RECOVERY_DISARM) {
                     setArmingDisabled(ARMING_DISABLED_CRASH_DETECTED);
                     disarm();
@@ -890,8 +1029,8 @@ static void detectAndSetCrashRecovery(
                     crashDetectedAtUs = currentTimeUs;
                 }
             }
-            if (inCrashRecoveryMode && cmpTimeUs(currentTimeUs, crashDetectedAtUs) < crashTimeDelayUs && (fabsf(errorRate) < crashGyroThreshold
-                || fabsf(getSetpointRate(axis)) > crashSetpointThreshold)) {
+            if (inCrashRecoveryMode && cmpTimeUs(currentTimeUs, crashDetectedAtUs) < pidRuntime.crashTimeDelayUs && (fabsf(errorRate) < pidRuntime.crashGyroThreshold
+                || fabsf(getSetpointRate(axis)) > pidRuntime.crashSetpointThreshold)) {
                 inCrashRecoveryMode = false;
                 BEEP_OFF;
             }
@@ -937,7 +1076,7 @@ static FAST_CODE_NOINLINE float applyAcroTrainer(int axis, const rollAndPitchTri
         }
 
         // Limit and correct the angle when it exceeds the limit
-        if ((fabsf(currentAngle) > acroTrainerAngleLimit) && (acroTrainerAxisState[axis] == 0)) {
+        if ((fabsf(currentAngle) > pidRuntime.acroTrainerAngleLimit) && (acroTrainerAxisState[axis] == 0)) {
             if (angleSign == setpointSign) {
                 acroTrainerAxisState[axis] = angleSign;
                 resetIterm = true;
@@ -945,18 +1084,18 @@ static FAST_CODE_NOINLINE float applyAcroTrainer(int axis, const rollAndPitchTri
         }
 
         if (acroTrainerAxisState[axis] != 0) {
-            ret = constrainf(((acroTrainerAngleLimit * angleSign) - currentAngle) * acroTrainerGain, -ACRO_TRAINER_SETPOINT_LIMIT, ACRO_TRAINER_SETPOINT_LIMIT);
+            ret = constrainf(((pidRuntime.acroTrainerAngleLimit * angleSign) - currentAngle) * pidRuntime.acroTrainerGain, -ACRO_TRAINER_SETPOINT_LIMIT, ACRO_TRAINER_SETPOINT_LIMIT);
         } else {
         
         // Not currently over the limit so project the angle based on current angle and
         // gyro angular rate using a sliding window based on gyro rate (faster rotation means larger window.
         // If the projected angle exceeds the limit then apply limiting to minimize overshoot.
             // Calculate the lookahead window by scaling proportionally with gyro rate from 0-500dps
-            float checkInterval = constrainf(fabsf(gyro.gyroADCf[axis]) / ACRO_TRAINER_LOOKAHEAD_RATE_LIMIT, 0.0f, 1.0f) * acroTrainerLookaheadTime;
+            float checkInterval = constrainf(fabsf(gyro.gyroADCf[axis]) / ACRO_TRAINER_LOOKAHEAD_RATE_LIMIT, 0.0f, 1.0f) * pidRuntime.acroTrainerLookaheadTime;
             projectedAngle = (gyro.gyroADCf[axis] * checkInterval) + currentAngle;
             const int projectedAngleSign = acroTrainerSign(projectedAngle);
-            if ((fabsf(projectedAngle) > acroTrainerAngleLimit) && (projectedAngleSign == setpointSign)) {
-                ret = ((acroTrainerAngleLimit * projectedAngleSign) - projectedAngle) * acroTrainerGain;
+            if ((fabsf(projectedAngle) > pidRuntime.acroTrainerAngleLimit) && (projectedAngleSign == setpointSign)) {
+                ret = ((pidRuntime.acroTrainerAngleLimit * projectedAngleSign) - projectedAngle) * pidRuntime.acroTrainerGain;
                 resetIterm = true;
             }
         }
@@ -965,7 +1104,7 @@ static FAST_CODE_NOINLINE float applyAcroTrainer(int axis, const rollAndPitchTri
             pidData[axis].I = 0;
         }
  
-        if (axis == acroTrainerDebugAxis) {
+        if (axis == pidRuntime.acroTrainerDebugAxis) {
             DEBUG_SET(DEBUG_ACRO_TRAINER, 0, lrintf(currentAngle * 10.0f));
             DEBUG_SET(DEBUG_ACRO_TRAINER, 1, acroTrainerAxisState[axis]);
             DEBUG_SET(DEBUG_ACRO_TRAINER, 2, lrintf(ret));
@@ -982,8 +1121,8 @@ static float accelerationLimit(int axis, float currentPidSetpoint)
     static float previousSetpoint[XYZ_AXIS_COUNT];
     const float currentVelocity = currentPidSetpoint - previousSetpoint[axis];
 
-    if (fabsf(currentVelocity) > maxVelocity[axis]) {
-        currentPidSetpoint = (currentVelocity > 0) ? previousSetpoint[axis] + maxVelocity[axis] : previousSetpoint[axis] - maxVelocity[axis];
+    if (fabsf(currentVelocity) > pidRuntime.maxVelocity[axis]) {
+        currentPidSetpoint = (currentVelocity > 0) ? previousSetpoint[axis] + pidRuntime.maxVelocity[axis] : previousSetpoint[axis] - pidRuntime.maxVelocity[axis];
     }
 
     previousSetpoint[axis] = currentPidSetpoint;
@@ -1005,9 +1144,9 @@ static void rotateVector(float v[XYZ_AXIS_COUNT], float rotation[XYZ_AXIS_COUNT]
 
 STATIC_UNIT_TESTED void rotateItermAndAxisError()
 {
-    if (itermRotation
+    if (pidRuntime.itermRotation
 #if defined(USE_ABSOLUTE_CONTROL)
-        || acGain > 0 || debugMode == DEBUG_AC_ERROR
+        || pidRuntime.acGain > 0 || debugMode == DEBUG_AC_ERROR
 #endif
         ) {
         const float gyroToAngle = dT * RAD;
@@ -1016,11 +1155,11 @@ STATIC_UNIT_TESTED void rotateItermAndAxisError()
             rotationRads[i] = gyro.gyroADCf[i] * gyroToAngle;
         }
 #if defined(USE_ABSOLUTE_CONTROL)
-        if (acGain > 0 || debugMode == DEBUG_AC_ERROR) {
+        if (pidRuntime.acGain > 0 || debugMode == DEBUG_AC_ERROR) {
             rotateVector(axisError, rotationRads);
         }
 #endif
-        if (itermRotation) {
+        if (pidRuntime.itermRotation) {
             float v[XYZ_AXIS_COUNT];
             for (int i = 0; i < XYZ_AXIS_COUNT; i++) {
                 v[i] = pidData[i].I;
@@ -1061,7 +1200,7 @@ float FAST_CODE applyRcSmoothingDerivativeFilter(int axis, float pidSetpointDelt
 #if defined(USE_ABSOLUTE_CONTROL)
 STATIC_UNIT_TESTED void applyAbsoluteControl(const int axis, const float gyroRate, float *currentPidSetpoint, float *itermErrorRate)
 {
-    if (acGain > 0 || debugMode == DEBUG_AC_ERROR) {
+    if (pidRuntime.acGain > 0 || debugMode == DEBUG_AC_ERROR) {
         const float setpointLpf = pt1FilterApply(&acLpf[axis], *currentPidSetpoint);
         const float setpointHpf = fabsf(*currentPidSetpoint - setpointLpf);
         float acErrorRate = 0;
@@ -1084,8 +1223,8 @@ STATIC_UNIT_TESTED void applyAbsoluteControl(const int axis, const float gyroRat
 
         if (isAirmodeActivated()) {
             axisError[axis] = constrainf(axisError[axis] + acErrorRate * dT,
-                -acErrorLimit, acErrorLimit);
-            const float acCorrection = constrainf(axisError[axis] * acGain, -acLimit, acLimit);
+                -pidRuntime.acErrorLimit, pidRuntime.acErrorLimit);
+            const float acCorrection = constrainf(axisError[axis] * pidRuntime.acGain, -pidRuntime.acLimit, pidRuntime.acLimit);
             *currentPidSetpoint += acCorrection;
             *itermErrorRate += acCorrection;
             DEBUG_SET(DEBUG_AC_CORRECTION, axis, lrintf(acCorrection * 10));
@@ -1104,16 +1243,16 @@ STATIC_UNIT_TESTED void applyItermRelax(const int axis, const float iterm,
     const float setpointLpf = pt1FilterApply(&windupLpf[axis], *currentPidSetpoint);
     const float setpointHpf = fabsf(*currentPidSetpoint - setpointLpf);
 
-    if (itermRelax) {
-        if (axis < FD_YAW || itermRelax == ITERM_RELAX_RPY || itermRelax == ITERM_RELAX_RPY_INC) {
-            const float itermRelaxFactor = MAX(0, 1 - setpointHpf / itermRelaxSetpointThreshold);
+    if (pidRuntime.itermRelax) {
+        if (axis < FD_YAW || pidRuntime.itermRelax == ITERM_RELAX_RPY || pidRuntime.itermRelax == ITERM_RELAX_RPY_INC) {
+            const float itermRelaxFactor = MAX(0, 1 - setpointHpf / pidRuntime.itermRelaxSetpointThreshold);
             const bool isDecreasingI =
                 ((iterm > 0) && (*itermErrorRate < 0)) || ((iterm < 0) && (*itermErrorRate > 0));
-            if ((itermRelax >= ITERM_RELAX_RP_INC) && isDecreasingI) {
+            if ((pidRuntime.itermRelax >= ITERM_RELAX_RP_INC) && isDecreasingI) {
                 // Do Nothing, use the precalculed itermErrorRate
-            } else if (itermRelaxType == ITERM_RELAX_SETPOINT) {
+            } else if (pidRuntime.itermRelaxType == ITERM_RELAX_SETPOINT) {
                 *itermErrorRate *= itermRelaxFactor;
-            } else if (itermRelaxType == ITERM_RELAX_GYRO ) {
+            } else if (pidRuntime.itermRelaxType == ITERM_RELAX_GYRO ) {
                 *itermErrorRate = fapplyDeadband(setpointLpf - gyroRate, setpointHpf);
             } else {
                 *itermErrorRate = 0.0f;
@@ -1136,7 +1275,7 @@ STATIC_UNIT_TESTED void applyItermRelax(const int axis, const float iterm,
 #ifdef USE_AIRMODE_LPF
 void pidUpdateAirmodeLpf(float currentOffset)
 {
-    if (airmodeThrottleOffsetLimit == 0.0f) {
+    if (pidRuntime.airmodeThrottleOffsetLimit == 0.0f) {
         return;
     }
 
@@ -1149,7 +1288,7 @@ void pidUpdateAirmodeLpf(float currentOffset)
     if (currentOffset * airmodeThrottleLpf1.state >= 0 && fabsf(currentOffset) > airmodeThrottleLpf1.state) {
         airmodeThrottleLpf1.state = currentOffset;
     }
-    airmodeThrottleLpf1.state = constrainf(airmodeThrottleLpf1.state, -airmodeThrottleOffsetLimit, airmodeThrottleOffsetLimit);
+    airmodeThrottleLpf1.state = constrainf(airmodeThrottleLpf1.state, -pidRuntime.airmodeThrottleOffsetLimit, pidRuntime.airmodeThrottleOffsetLimit);
 }
 
 float pidGetAirmodeThrottleOffset()
@@ -1170,7 +1309,7 @@ static float applyLaunchControl(int axis, const rollAndPitchTrims_t *angleTrim)
     // Scale the rates based on stick deflection only. Fixed rates with a max of 100deg/sec
     // reached at 50% stick deflection. This keeps the launch control positioning consistent
     // regardless of the user's rates.
-    if ((axis == FD_PITCH) || (launchControlMode != LAUNCH_CONTROL_MODE_PITCHONLY)) {
+    if ((axis == FD_PITCH) || (pidRuntime.launchControlMode != LAUNCH_CONTROL_MODE_PITCHONLY)) {
         const float stickDeflection = constrainf(getRcDeflection(axis), -0.5f, 0.5f);
         ret = LAUNCH_CONTROL_MAX_RATE * stickDeflection * 2;
     }
@@ -1178,13 +1317,13 @@ static float applyLaunchControl(int axis, const rollAndPitchTrims_t *angleTrim)
 #if defined(USE_ACC)
     // If ACC is enabled and a limit angle is set, then try to limit forward tilt
     // to that angle and slow down the rate as the limit is approached to reduce overshoot
-    if ((axis == FD_PITCH) && (launchControlAngleLimit > 0) && (ret > 0)) {
+    if ((axis == FD_PITCH) && (pidRuntime.launchControlAngleLimit > 0) && (ret > 0)) {
         const float currentAngle = (attitude.raw[axis] - angleTrim->raw[axis]) / 10.0f;
-        if (currentAngle >= launchControlAngleLimit) {
+        if (currentAngle >= pidRuntime.launchControlAngleLimit) {
             ret = 0.0f;
         } else {
             //for the last 10 degrees scale the rate from the current input to 5 dps
-            const float angleDelta = launchControlAngleLimit - currentAngle;
+            const float angleDelta = pidRuntime.launchControlAngleLimit - currentAngle;
             if (angleDelta <= LAUNCH_CONTROL_ANGLE_WINDOW) {
                 ret = scaleRangef(angleDelta, 0, LAUNCH_CONTROL_ANGLE_WINDOW, LAUNCH_CONTROL_MIN_RATE, ret);
             }
@@ -1248,16 +1387,16 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 #endif
 
     // Dynamic i component,
-    if ((antiGravityMode == ANTI_GRAVITY_SMOOTH) && antiGravityEnabled) {
-        itermAccelerator = 1 + fabsf(antiGravityThrottleHpf) * 0.01f * (itermAcceleratorGain - 1000);
+    if ((pidRuntime.antiGravityMode == ANTI_GRAVITY_SMOOTH) && antiGravityEnabled) {
+        itermAccelerator = 1 + fabsf(antiGravityThrottleHpf) * 0.01f * (pidRuntime.itermAcceleratorGain - 1000);
         DEBUG_SET(DEBUG_ANTI_GRAVITY, 1, lrintf(antiGravityThrottleHpf * 1000));
     }
     DEBUG_SET(DEBUG_ANTI_GRAVITY, 0, lrintf(itermAccelerator * 1000));
 
     // gradually scale back integration when above windup point
     float dynCi = dT * itermAccelerator;
-    if (itermWindupPointInv > 1.0f) {
-        dynCi *= constrainf((1.0f - getMotorMixRange()) * itermWindupPointInv, 0.0f, 1.0f);
+    if (pidRuntime.itermWindupPointInv > 1.0f) {
+        dynCi *= constrainf((1.0f - getMotorMixRange()) * pidRuntime.itermWindupPointInv, 0.0f, 1.0f);
     }
 
     // Precalculate gyro deta for D-term here, this allows loop unrolling
@@ -1267,9 +1406,9 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 #ifdef USE_RPM_FILTER
         gyroRateDterm[axis] = rpmFilterDterm(axis,gyroRateDterm[axis]);
 #endif
-        gyroRateDterm[axis] = dtermNotchApplyFn((filter_t *) &dtermNotch[axis], gyroRateDterm[axis]);
-        gyroRateDterm[axis] = dtermLowpassApplyFn((filter_t *) &dtermLowpass[axis], gyroRateDterm[axis]);
-        gyroRateDterm[axis] = dtermLowpass2ApplyFn((filter_t *) &dtermLowpass2[axis], gyroRateDterm[axis]);
+        gyroRateDterm[axis] = pidRuntime.dtermNotchApplyFn((filter_t *) &dtermNotch[axis], gyroRateDterm[axis]);
+        gyroRateDterm[axis] = pidRuntime.dtermLowpassApplyFn((filter_t *) &dtermLowpass[axis], gyroRateDterm[axis]);
+        gyroRateDterm[axis] = pidRuntime.dtermLowpass2ApplyFn((filter_t *) &dtermLowpass2[axis], gyroRateDterm[axis]);
     }
 
     rotateItermAndAxisError();
@@ -1282,7 +1421,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
     for (int axis = FD_ROLL; axis <= FD_YAW; ++axis) {
 
         float currentPidSetpoint = getSetpointRate(axis);
-        if (maxVelocity[axis]) {
+        if (pidRuntime.maxVelocity[axis]) {
             currentPidSetpoint = accelerationLimit(axis, currentPidSetpoint);
         }
         // Yaw control is GYRO based, direct sticks control is applied to rate PID
@@ -1340,19 +1479,19 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
         // b = 1 and only c (feedforward weight) can be tuned (amount derivative on measurement or error).
 
         // -----calculate P component
-        pidData[axis].P = pidCoefficient[axis].Kp * errorRate * tpaFactorKp;
+        pidData[axis].P = pidRuntime.pidCoefficient[axis].Kp * errorRate * tpaFactorKp;
         if (axis == FD_YAW) {
-            pidData[axis].P = ptermYawLowpassApplyFn((filter_t *) &ptermYawLowpass, pidData[axis].P);
+            pidData[axis].P = pidRuntime.ptermYawLowpassApplyFn((filter_t *) &ptermYawLowpass, pidData[axis].P);
         }
 
         // -----calculate I component
 #ifdef USE_LAUNCH_CONTROL
         // if launch control is active override the iterm gains
-        const float Ki = launchControlActive ? launchControlKi : pidCoefficient[axis].Ki;
+        const float Ki = launchControlActive ? pidRuntime.launchControlKi : pidRuntime.pidCoefficient[axis].Ki;
 #else
-        const float Ki = pidCoefficient[axis].Ki;
+        const float Ki = pidRuntime.pidCoefficient[axis].Ki;
 #endif
-        pidData[axis].I = constrainf(previousIterm + Ki * itermErrorRate * dynCi, -itermLimit, itermLimit);
+        pidData[axis].I = constrainf(previousIterm + Ki * itermErrorRate * dynCi, -pidRuntime.itermLimit, pidRuntime.itermLimit);
 
         // -----calculate pidSetpointDelta
         float pidSetpointDelta = 0;
@@ -1365,7 +1504,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 
         // -----calculate D component
         // disable D if launch control is active
-        if ((pidCoefficient[axis].Kd > 0) && !launchControlActive){
+        if ((pidRuntime.pidCoefficient[axis].Kd > 0) && !launchControlActive){
 
             // Divide rate change by dT to get differential (ie dr/dt).
             // dT is fixed and calculated from the target PID loop time
@@ -1383,24 +1522,24 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 
             float dMinFactor = 1.0f;
 #if defined(USE_D_MIN)
-            if (dMinPercent[axis] > 0) {
+            if (pidRuntime.dMinPercent[axis] > 0) {
                 float dMinGyroFactor = biquadFilterApply(&dMinRange[axis], delta);
-                dMinGyroFactor = fabsf(dMinGyroFactor) * dMinGyroGain;
-                const float dMinSetpointFactor = (fabsf(pidSetpointDelta)) * dMinSetpointGain;
+                dMinGyroFactor = fabsf(dMinGyroFactor) * pidRuntime.dMinGyroGain;
+                const float dMinSetpointFactor = (fabsf(pidSetpointDelta)) * pidRuntime.dMinSetpointGain;
                 dMinFactor = MAX(dMinGyroFactor, dMinSetpointFactor);
-                dMinFactor = dMinPercent[axis] + (1.0f - dMinPercent[axis]) * dMinFactor;
+                dMinFactor = pidRuntime.dMinPercent[axis] + (1.0f - pidRuntime.dMinPercent[axis]) * dMinFactor;
                 dMinFactor = pt1FilterApply(&dMinLowpass[axis], dMinFactor);
                 dMinFactor = MIN(dMinFactor, 1.0f);
                 if (axis == FD_ROLL) {
                     DEBUG_SET(DEBUG_D_MIN, 0, lrintf(dMinGyroFactor * 100));
                     DEBUG_SET(DEBUG_D_MIN, 1, lrintf(dMinSetpointFactor * 100));
-                    DEBUG_SET(DEBUG_D_MIN, 2, lrintf(pidCoefficient[axis].Kd * dMinFactor * 10 / DTERM_SCALE));
+                    DEBUG_SET(DEBUG_D_MIN, 2, lrintf(pidRuntime.pidCoefficient[axis].Kd * dMinFactor * 10 / DTERM_SCALE));
                 } else if (axis == FD_PITCH) {
-                    DEBUG_SET(DEBUG_D_MIN, 3, lrintf(pidCoefficient[axis].Kd * dMinFactor * 10 / DTERM_SCALE));
+                    DEBUG_SET(DEBUG_D_MIN, 3, lrintf(pidRuntime.pidCoefficient[axis].Kd * dMinFactor * 10 / DTERM_SCALE));
                 }
             }
 #endif
-            pidData[axis].D = pidCoefficient[axis].Kd * delta * tpaFactor * dMinFactor;
+            pidData[axis].D = pidRuntime.pidCoefficient[axis].Kd * delta * tpaFactor * dMinFactor;
         } else {
             pidData[axis].D = 0;
         }
@@ -1408,10 +1547,10 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 
         // -----calculate feedforward component
         // Only enable feedforward for rate mode and if launch control is inactive
-        const float feedforwardGain = (flightModeFlags || launchControlActive) ? 0.0f : pidCoefficient[axis].Kf;
+        const float feedforwardGain = (flightModeFlags || launchControlActive) ? 0.0f : pidRuntime.pidCoefficient[axis].Kf;
         if (feedforwardGain > 0) {
-            // no transition if feedForwardTransition == 0
-            float transition = feedForwardTransition > 0 ? MIN(1.f, getRcDeflectionAbs(axis) * feedForwardTransition) : 1;
+            // no transition if pidRuntime.feedForwardTransition == 0
+            float transition = pidRuntime.feedForwardTransition > 0 ? MIN(1.f, getRcDeflectionAbs(axis) * pidRuntime.feedForwardTransition) : 1;
             pidData[axis].F = feedforwardGain * transition * pidSetpointDelta * pidFrequency;
         } else {
             pidData[axis].F = 0;
@@ -1434,11 +1573,11 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
         if (launchControlActive) {
             // if not using FULL mode then disable I accumulation on yaw as
             // yaw has a tendency to windup. Otherwise limit yaw iterm accumulation.
-            const int launchControlYawItermLimit = (launchControlMode == LAUNCH_CONTROL_MODE_FULL) ? LAUNCH_CONTROL_YAW_ITERM_LIMIT : 0;
+            const int launchControlYawItermLimit = (pidRuntime.launchControlMode == LAUNCH_CONTROL_MODE_FULL) ? LAUNCH_CONTROL_YAW_ITERM_LIMIT : 0;
             pidData[FD_YAW].I = constrainf(pidData[FD_YAW].I, -launchControlYawItermLimit, launchControlYawItermLimit);
 
             // for pitch-only mode we disable everything except pitch P/I
-            if (launchControlMode == LAUNCH_CONTROL_MODE_PITCHONLY) {
+            if (pidRuntime.launchControlMode == LAUNCH_CONTROL_MODE_PITCHONLY) {
                 pidData[FD_ROLL].P = 0;
                 pidData[FD_ROLL].I = 0;
                 pidData[FD_YAW].P = 0;
@@ -1450,9 +1589,9 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
         // calculating the PID sum
         const float pidSum = pidData[axis].P + pidData[axis].I + pidData[axis].D + pidData[axis].F;
 #ifdef USE_INTEGRATED_YAW_CONTROL
-        if (axis == FD_YAW && useIntegratedYaw) {
+        if (axis == FD_YAW && pidRuntime.useIntegratedYaw) {
             pidData[axis].Sum += pidSum * dT * 100.0f;
-            pidData[axis].Sum -= pidData[axis].Sum * integratedYawRelax / 100000.0f * dT / 0.000125f;
+            pidData[axis].Sum -= pidData[axis].Sum * pidRuntime.integratedYawRelax / 100000.0f * dT / 0.000125f;
         } else
 #endif
         {
@@ -1510,14 +1649,14 @@ bool pidAntiGravityEnabled(void)
 #ifdef USE_DYN_LPF
 void dynLpfDTermUpdate(float throttle)
 {
-    if (dynLpfFilter != DYN_LPF_NONE) {
-        const unsigned int cutoffFreq = fmax(dynThrottle(throttle) * dynLpfMax, dynLpfMin);
+    if (pidRuntime.dynLpfFilter != DYN_LPF_NONE) {
+        const unsigned int cutoffFreq = fmax(dynThrottle(throttle) * pidRuntime.dynLpfMax, pidRuntime.dynLpfMin);
 
-         if (dynLpfFilter == DYN_LPF_PT1) {
+         if (pidRuntime.dynLpfFilter == DYN_LPF_PT1) {
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
                 pt1FilterUpdateCutoff(&dtermLowpass[axis].pt1Filter, pt1FilterGain(cutoffFreq, dT));
             }
-        } else if (dynLpfFilter == DYN_LPF_BIQUAD) {
+        } else if (pidRuntime.dynLpfFilter == DYN_LPF_BIQUAD) {
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
                 biquadFilterUpdateLPF(&dtermLowpass[axis].biquadFilter, cutoffFreq, targetPidLooptime);
             }
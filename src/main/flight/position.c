@@ -60,6 +60,75 @@ static int32_t estimatedAltitudeCm = 0;                // in cm
 
 #define BARO_UPDATE_FREQUENCY_40HZ (1000 * 25)
 
+// Time constant of the altitude estimator; baro/GPS errors are corrected over this period,
+// faster changes come from the accelerometer
+#define ALTITUDE_ESTIMATOR_TIME_CONSTANT 1.0f
+#define ALTITUDE_ESTIMATOR_K1 (3.0f / ALTITUDE_ESTIMATOR_TIME_CONSTANT)
+#define ALTITUDE_ESTIMATOR_K2 (3.0f / (ALTITUDE_ESTIMATOR_TIME_CONSTANT * ALTITUDE_ESTIMATOR_TIME_CONSTANT))
+#define ALTITUDE_ESTIMATOR_K3 (1.0f / (ALTITUDE_ESTIMATOR_TIME_CONSTANT * ALTITUDE_ESTIMATOR_TIME_CONSTANT * ALTITUDE_ESTIMATOR_TIME_CONSTANT))
+#define ALTITUDE_ESTIMATOR_ACC_TIMEOUT_US 100000   // fall back to baro/GPS only without accelerometer updates
+#define ALTITUDE_ESTIMATOR_MAX_DT 0.1f
+
+void altitudeEstimatorInit(altitudeEstimator_t *estimator, float altitudeCm)
+{
+    estimator->altitudeCm = altitudeCm;
+    estimator->velocityCmS = 0.0f;
+    estimator->accBiasCmSS = 0.0f;
+    estimator->initialised = true;
+}
+
+void altitudeEstimatorPredict(altitudeEstimator_t *estimator, float accZCmSS, float dt)
+{
+    if (!estimator->initialised) {
+        return;
+    }
+
+    const float acc = accZCmSS - estimator->accBiasCmSS;
+    estimator->altitudeCm += (estimator->velocityCmS + 0.5f * acc * dt) * dt;
+    estimator->velocityCmS += acc * dt;
+}
+
+void altitudeEstimatorCorrect(altitudeEstimator_t *estimator, float altitudeCm, float dt)
+{
+    if (!estimator->initialised) {
+        altitudeEstimatorInit(estimator, altitudeCm);
+        return;
+    }
+
+    dt = MIN(dt, ALTITUDE_ESTIMATOR_MAX_DT);
+    const float error = altitudeCm - estimator->altitudeCm;
+    estimator->altitudeCm += ALTITUDE_ESTIMATOR_K1 * error * dt;
+    estimator->velocityCmS += ALTITUDE_ESTIMATOR_K2 * error * dt;
+    estimator->accBiasCmSS -= ALTITUDE_ESTIMATOR_K3 * error * dt;
+}
+
+#if defined(USE_BARO) || defined(USE_GPS)
+static altitudeEstimator_t altitudeEstimator;
+static timeUs_t lastAccelerationTimeUs;
+
+// Called from the attitude task with the earth frame vertical acceleration (gravity removed)
+void positionUpdateVerticalAcceleration(timeUs_t currentTimeUs, float accZCmSS)
+{
+    const float dt = cmpTimeUs(currentTimeUs, lastAccelerationTimeUs) * 1e-6f;
+    lastAccelerationTimeUs = currentTimeUs;
+
+    if (dt > 0.0f && dt < ALTITUDE_ESTIMATOR_MAX_DT) {
+        altitudeEstimatorPredict(&altitudeEstimator, accZCmSS, dt);
+    }
+}
+
+static bool altitudeEstimatorIsUsable(timeUs_t currentTimeUs)
+{
+    return altitudeEstimator.initialised && cmpTimeUs(currentTimeUs, lastAccelerationTimeUs) < ALTITUDE_ESTIMATOR_ACC_TIMEOUT_US;
+}
+#else
+void positionUpdateVerticalAcceleration(timeUs_t currentTimeUs, float accZCmSS)
+{
+    UNUSED(currentTimeUs);
+    UNUSED(accZCmSS);
+}
+#endif
+
 #ifdef USE_VARIO
 static int16_t estimatedVario = 0;                   // in cm/s
 
@@ -134,35 +203,58 @@ void calculateEstimatedAltitude(timeUs_t currentTimeUs)
     }
 #endif
 
+    bool altitudeOffsetChanged = false;
     if (ARMING_FLAG(ARMED) && !altitudeOffsetSet) {
         baroAltOffset = baroAlt;
         gpsAltOffset = gpsAlt;
         altitudeOffsetSet = true;
+        altitudeOffsetChanged = true;
     } else if (!ARMING_FLAG(ARMED) && altitudeOffsetSet) {
         altitudeOffsetSet = false;
+        altitudeOffsetChanged = true;
     }
     baroAlt -= baroAltOffset;
     gpsAlt -= gpsAltOffset;
-    
-    
+
+    bool haveAltitude = true;
+    int32_t measuredAltitudeCm = 0;
     if (haveGpsAlt && haveBaroAlt && positionConfig()->altSource == DEFAULT) {
-        estimatedAltitudeCm = gpsAlt * gpsTrust + baroAlt * (1 - gpsTrust);
+        measuredAltitudeCm = gpsAlt * gpsTrust + baroAlt * (1 - gpsTrust);
 #ifdef USE_VARIO
         // baro is a better source for vario, so ignore gpsVertSpeed
         estimatedVario = calculateEstimatedVario(baroAlt, dTime);
 #endif
     } else if (haveGpsAlt && (positionConfig()->altSource == GPS_ONLY || positionConfig()->altSource == DEFAULT )) {
-        estimatedAltitudeCm = gpsAlt;
+        measuredAltitudeCm = gpsAlt;
 #if defined(USE_VARIO) && defined(USE_GPS)
         estimatedVario = gpsVertSpeed;
 #endif
     } else if (haveBaroAlt && (positionConfig()->altSource == BARO_ONLY || positionConfig()->altSource == DEFAULT)) {
-        estimatedAltitudeCm = baroAlt;
+        measuredAltitudeCm = baroAlt;
 #ifdef USE_VARIO
         estimatedVario = calculateEstimatedVario(baroAlt, dTime);
 #endif
+    } else {
+        haveAltitude = false;
     }
-    
+
+    if (haveAltitude) {
+        if (altitudeOffsetChanged && altitudeEstimator.initialised) {
+            // the reference altitude moved, keep the estimated velocity and accelerometer bias
+            altitudeEstimator.altitudeCm = measuredAltitudeCm;
+        }
+        altitudeEstimatorCorrect(&altitudeEstimator, measuredAltitudeCm, dTime * 1e-6f);
+
+        if (altitudeEstimatorIsUsable(currentTimeUs)) {
+            estimatedAltitudeCm = lrintf(altitudeEstimator.altitudeCm);
+#ifdef USE_VARIO
+            estimatedVario = constrain(lrintf(altitudeEstimator.velocityCmS), SHRT_MIN, SHRT_MAX);
+#endif
+        } else {
+            estimatedAltitudeCm = measuredAltitudeCm;
+        }
+    }
+
 	
     
     DEBUG_SET(DEBUG_ALTITUDE, 0, (int32_t)(100 * gpsTrust));
@@ -58,7 +58,22 @@
     #define ONLY_EXPOSE_FOR_TESTING static
 #endif
 
+// Targets with plenty of RAM get a larger cache to ride out card write latency spikes
+#ifndef AFATFS_NUM_CACHE_SECTORS
+#if defined(STM32F7) || defined(STM32H7)
+#define AFATFS_NUM_CACHE_SECTORS 32
+#else
 #define AFATFS_NUM_CACHE_SECTORS 10
+#endif
+#endif
+
+// Number of buckets in the table which maps sector indexes to cache entries, must be a power of 2
+#define AFATFS_CACHE_HASH_SIZE 64
+
+// Marks the end of a chain of cache entries
+#define AFATFS_CACHE_NONE 0xFF
+
+STATIC_ASSERT(AFATFS_NUM_CACHE_SECTORS < AFATFS_CACHE_NONE, afatfs_too_many_cache_sectors);
 
 // FAT filesystems are allowed to differ from these parameters, but we choose not to support those weird filesystems:
 #define AFATFS_SECTOR_SIZE  512
@@ -176,8 +191,12 @@ typedef struct afatfsCacheBlockDescriptor_t {
     // This is the timestamp that this sector was first marked dirty at (so we can flush sectors in write-order).
     uint32_t writeTimestamp;
 
-    // This is the last time the sector was accessed
-    uint32_t accessTimestamp;
+    // The next entry in this sector's hash bucket
+    uint8_t hashNext;
+
+    // Neighbours in the list of entries ordered by last access
+    uint8_t lruPrev;
+    uint8_t lruNext;
 
     /* This is set to non-zero when we expect to write a consecutive series of this many blocks (including this block),
      * so we will tell the SD-card to pre-erase those blocks.
@@ -466,6 +485,13 @@ typedef struct afatfs_t {
     afatfsCacheBlockDescriptor_t cacheDescriptor[AFATFS_NUM_CACHE_SECTORS];
     uint32_t cacheTimer;
 
+    // Heads of the chains of cache entries for each hash of the sector index
+    uint8_t cacheHashHead[AFATFS_CACHE_HASH_SIZE];
+
+    // Cache entries from most to least recently used, entries which should be evicted first are moved to the tail
+    uint8_t cacheLruHead;
+    uint8_t cacheLruTail;
+
     int cacheDirtyEntries; // The number of cache entries in the AFATFS_CACHE_STATE_DIRTY state
     bool cacheFlushInProgress;
 
@@ -627,11 +653,117 @@ static void afatfs_cacheSectorMarkDirty(afatfsCacheBlockDescriptor_t *descriptor
     }
 }
 
-static void afatfs_cacheSectorInit(afatfsCacheBlockDescriptor_t *descriptor, uint32_t sectorIndex, bool locked)
+static uint8_t *afatfs_cacheHashBucket(uint32_t sectorIndex)
+{
+    return &afatfs.cacheHashHead[sectorIndex & (AFATFS_CACHE_HASH_SIZE - 1)];
+}
+
+static void afatfs_cacheHashInsert(int cacheIndex)
+{
+    uint8_t *bucket = afatfs_cacheHashBucket(afatfs.cacheDescriptor[cacheIndex].sectorIndex);
+
+    afatfs.cacheDescriptor[cacheIndex].hashNext = *bucket;
+    *bucket = cacheIndex;
+}
+
+static void afatfs_cacheHashRemove(int cacheIndex)
 {
+    uint8_t *link = afatfs_cacheHashBucket(afatfs.cacheDescriptor[cacheIndex].sectorIndex);
+
+    // Entries which have never been assigned a sector aren't in the table
+    while (*link != AFATFS_CACHE_NONE) {
+        if (*link == cacheIndex) {
+            *link = afatfs.cacheDescriptor[cacheIndex].hashNext;
+            break;
+        }
+        link = &afatfs.cacheDescriptor[*link].hashNext;
+    }
+}
+
+static void afatfs_cacheLruRemove(int cacheIndex)
+{
+    afatfsCacheBlockDescriptor_t *descriptor = &afatfs.cacheDescriptor[cacheIndex];
+
+    if (descriptor->lruPrev == AFATFS_CACHE_NONE) {
+        afatfs.cacheLruHead = descriptor->lruNext;
+    } else {
+        afatfs.cacheDescriptor[descriptor->lruPrev].lruNext = descriptor->lruNext;
+    }
+
+    if (descriptor->lruNext == AFATFS_CACHE_NONE) {
+        afatfs.cacheLruTail = descriptor->lruPrev;
+    } else {
+        afatfs.cacheDescriptor[descriptor->lruNext].lruPrev = descriptor->lruPrev;
+    }
+}
+
+static void afatfs_cacheLruInsertHead(int cacheIndex)
+{
+    afatfsCacheBlockDescriptor_t *descriptor = &afatfs.cacheDescriptor[cacheIndex];
+
+    descriptor->lruPrev = AFATFS_CACHE_NONE;
+    descriptor->lruNext = afatfs.cacheLruHead;
+
+    if (afatfs.cacheLruHead == AFATFS_CACHE_NONE) {
+        afatfs.cacheLruTail = cacheIndex;
+    } else {
+        afatfs.cacheDescriptor[afatfs.cacheLruHead].lruPrev = cacheIndex;
+    }
+    afatfs.cacheLruHead = cacheIndex;
+}
+
+static void afatfs_cacheLruInsertTail(int cacheIndex)
+{
+    afatfsCacheBlockDescriptor_t *descriptor = &afatfs.cacheDescriptor[cacheIndex];
+
+    descriptor->lruNext = AFATFS_CACHE_NONE;
+    descriptor->lruPrev = afatfs.cacheLruTail;
+
+    if (afatfs.cacheLruTail == AFATFS_CACHE_NONE) {
+        afatfs.cacheLruHead = cacheIndex;
+    } else {
+        afatfs.cacheDescriptor[afatfs.cacheLruTail].lruNext = cacheIndex;
+    }
+    afatfs.cacheLruTail = cacheIndex;
+}
+
+// Mark the entry as the most recently used
+static void afatfs_cacheSectorTouch(int cacheIndex)
+{
+    afatfs_cacheLruRemove(cacheIndex);
+    afatfs_cacheLruInsertHead(cacheIndex);
+}
+
+// Mark the entry as the first to be evicted
+static void afatfs_cacheSectorDemote(int cacheIndex)
+{
+    afatfs_cacheLruRemove(cacheIndex);
+    afatfs_cacheLruInsertTail(cacheIndex);
+}
+
+static void afatfs_cacheInit(void)
+{
+    memset(afatfs.cacheHashHead, AFATFS_CACHE_NONE, sizeof(afatfs.cacheHashHead));
+
+    afatfs.cacheLruHead = AFATFS_CACHE_NONE;
+    afatfs.cacheLruTail = AFATFS_CACHE_NONE;
+
+    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
+        afatfs_cacheLruInsertTail(i);
+    }
+}
+
+static void afatfs_cacheSectorInit(int cacheIndex, uint32_t sectorIndex, bool locked)
+{
+    afatfsCacheBlockDescriptor_t *descriptor = &afatfs.cacheDescriptor[cacheIndex];
+
+    afatfs_cacheHashRemove(cacheIndex);
     descriptor->sectorIndex = sectorIndex;
+    afatfs_cacheHashInsert(cacheIndex);
+
+    afatfs_cacheSectorTouch(cacheIndex);
 
-    descriptor->accessTimestamp = descriptor->writeTimestamp = ++afatfs.cacheTimer;
+    descriptor->writeTimestamp = ++afatfs.cacheTimer;
 
     descriptor->consecutiveEraseBlockCount = 0;
 
@@ -642,6 +774,21 @@ static void afatfs_cacheSectorInit(afatfsCacheBlockDescriptor_t *descriptor, uin
     descriptor->discardable = 0;
 }
 
+/**
+ * Find the index of the cache entry which corresponds to the given physical sector index, or -1 if the sector isn't
+ * cached. Note that the cached sector could be in any state including completely empty.
+ */
+static int afatfs_findCacheSectorIndex(uint32_t sectorIndex)
+{
+    for (uint8_t i = *afatfs_cacheHashBucket(sectorIndex); i != AFATFS_CACHE_NONE; i = afatfs.cacheDescriptor[i].hashNext) {
+        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
 /**
  * Called by the SD card driver when one of our read operations completes.
  */
@@ -650,20 +797,17 @@ static void afatfs_sdcardReadComplete(sdcardBlockOperation_e operation, uint32_t
     (void) operation;
     (void) callbackData;
 
-    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-        if (afatfs.cacheDescriptor[i].state != AFATFS_CACHE_STATE_EMPTY
-            && afatfs.cacheDescriptor[i].sectorIndex == sectorIndex
-        ) {
-            if (buffer == NULL) {
-                // Read failed, mark the sector as empty and whoever asked for it will ask for it again later to retry
-                afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_EMPTY;
-            } else {
-                afatfs_assert(afatfs_cacheSectorGetMemory(i) == buffer && afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_READING);
+    const int i = afatfs_findCacheSectorIndex(sectorIndex);
 
-                afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_IN_SYNC;
-            }
+    if (i > -1 && afatfs.cacheDescriptor[i].state != AFATFS_CACHE_STATE_EMPTY) {
+        if (buffer == NULL) {
+            // Read failed, mark the sector as empty and whoever asked for it will ask for it again later to retry
+            afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_EMPTY;
+            afatfs_cacheSectorDemote(i);
+        } else {
+            afatfs_assert(afatfs_cacheSectorGetMemory(i) == buffer && afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_READING);
 
-            break;
+            afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_IN_SYNC;
         }
     }
 }
@@ -678,23 +822,20 @@ static void afatfs_sdcardWriteComplete(sdcardBlockOperation_e operation, uint32_
 
     afatfs.cacheFlushInProgress = false;
 
-    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-        /* Keep in mind that someone may have marked the sector as dirty after writing had already begun. In this case we must leave
-         * it marked as dirty because those modifications may have been made too late to make it to the disk!
-         */
-        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex
-            && afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_WRITING
-        ) {
-            if (buffer == NULL) {
-                // Write failed, remark the sector as dirty
-                afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_DIRTY;
-                afatfs.cacheDirtyEntries++;
-            } else {
-                afatfs_assert(afatfs_cacheSectorGetMemory(i) == buffer);
+    const int i = afatfs_findCacheSectorIndex(sectorIndex);
 
-                afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_IN_SYNC;
-            }
-            break;
+    /* Keep in mind that someone may have marked the sector as dirty after writing had already begun. In this case we must leave
+     * it marked as dirty because those modifications may have been made too late to make it to the disk!
+     */
+    if (i > -1 && afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_WRITING) {
+        if (buffer == NULL) {
+            // Write failed, remark the sector as dirty
+            afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_DIRTY;
+            afatfs.cacheDirtyEntries++;
+        } else {
+            afatfs_assert(afatfs_cacheSectorGetMemory(i) == buffer);
+
+            afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_IN_SYNC;
         }
     }
 }
@@ -739,13 +880,9 @@ static void afatfs_cacheFlushSector(int cacheIndex)
  */
 static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex)
 {
-    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
-            return &afatfs.cacheDescriptor[i];
-        }
-    }
+    const int i = afatfs_findCacheSectorIndex(sectorIndex);
 
-    return NULL;
+    return i > -1 ? &afatfs.cacheDescriptor[i] : NULL;
 }
 
 /**
@@ -753,20 +890,13 @@ static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex
  * conditions (in descending order of preference):
  *
  * - The requested sector that already exists in the cache
- * - The index of an empty sector
- * - The index of a synced discardable sector
- * - The index of the oldest synced sector
+ * - The least recently used empty or synced sector, where empty and discardable sectors count as the least recently
+ *   used
  *
  * Otherwise it returns -1 to signal failure (cache is full!)
  */
 static int afatfs_allocateCacheSector(uint32_t sectorIndex)
 {
-    int allocateIndex;
-    int emptyIndex = -1, discardableIndex = -1;
-
-    uint32_t oldestSyncedSectorLastUse = 0xFFFFFFFF;
-    int oldestSyncedSectorIndex = -1;
-
     if (
         !afatfs_assert(
             afatfs.numClusters == 0 // We're unable to check sector bounds during startup since we haven't read volume label yet
@@ -776,55 +906,36 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
         return -1;
     }
 
-    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
-            /*
-             * If the sector is actually empty then do a complete re-init of it just like the standard
-             * empty case. (Sectors marked as empty should be treated as if they don't have a block index assigned)
-             */
-            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_EMPTY) {
-                emptyIndex = i;
-                break;
-            }
+    int allocateIndex = afatfs_findCacheSectorIndex(sectorIndex);
 
-            // Bump the last access time
-            afatfs.cacheDescriptor[i].accessTimestamp = ++afatfs.cacheTimer;
-            return i;
+    if (allocateIndex > -1) {
+        /*
+         * If the sector is actually empty then do a complete re-init of it just like the standard
+         * empty case. (Sectors marked as empty should be treated as if they don't have a block index assigned)
+         */
+        if (afatfs.cacheDescriptor[allocateIndex].state != AFATFS_CACHE_STATE_EMPTY) {
+            // Bump the last access time, unless this sector should be evicted first anyway
+            if (!afatfs.cacheDescriptor[allocateIndex].discardable) {
+                afatfs_cacheSectorTouch(allocateIndex);
+            }
+            return allocateIndex;
         }
+    } else {
+        for (uint8_t i = afatfs.cacheLruTail; i != AFATFS_CACHE_NONE; i = afatfs.cacheDescriptor[i].lruPrev) {
+            const afatfsCacheBlockDescriptor_t *descriptor = &afatfs.cacheDescriptor[i];
 
-        switch (afatfs.cacheDescriptor[i].state) {
-            case AFATFS_CACHE_STATE_EMPTY:
-                emptyIndex = i;
-            break;
-            case AFATFS_CACHE_STATE_IN_SYNC:
-                // Is this a synced sector that we could evict from the cache?
-                if (!afatfs.cacheDescriptor[i].locked && afatfs.cacheDescriptor[i].retainCount == 0) {
-                    if (afatfs.cacheDescriptor[i].discardable) {
-                        discardableIndex = i;
-                    } else if (afatfs.cacheDescriptor[i].accessTimestamp < oldestSyncedSectorLastUse) {
-                        // This is older than last block we decided to evict, so evict this one in preference
-                        oldestSyncedSectorLastUse = afatfs.cacheDescriptor[i].accessTimestamp;
-                        oldestSyncedSectorIndex = i;
-                    }
-                }
-            break;
-            default:
-                ;
+            // Is this an empty sector, or a synced sector that we could evict from the cache?
+            if (descriptor->state == AFATFS_CACHE_STATE_EMPTY
+                || (descriptor->state == AFATFS_CACHE_STATE_IN_SYNC && !descriptor->locked && descriptor->retainCount == 0)
+            ) {
+                allocateIndex = i;
+                break;
+            }
         }
     }
 
-    if (emptyIndex > -1) {
-        allocateIndex = emptyIndex;
-    } else if (discardableIndex > -1) {
-        allocateIndex = discardableIndex;
-    } else if (oldestSyncedSectorIndex > -1) {
-        allocateIndex = oldestSyncedSectorIndex;
-    } else {
-        allocateIndex = -1;
-    }
-
     if (allocateIndex > -1) {
-        afatfs_cacheSectorInit(&afatfs.cacheDescriptor[allocateIndex], sectorIndex, false);
+        afatfs_cacheSectorInit(allocateIndex, sectorIndex, false);
     }
 
     return allocateIndex;
@@ -950,6 +1061,10 @@ static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex,
             // We only get to decide these fields if we're the first ones to cache the sector:
             afatfs.cacheDescriptor[cacheSectorIndex].discardable = (sectorFlags & AFATFS_CACHE_DISCARDABLE) != 0 ? 1 : 0;
 
+            if (afatfs.cacheDescriptor[cacheSectorIndex].discardable) {
+                afatfs_cacheSectorDemote(cacheSectorIndex);
+            }
+
 #ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
             // Don't bother pre-erasing for small block sequences
             if (eraseCount < AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT) {
@@ -1481,7 +1596,7 @@ static afatfsOperationStatus_e afatfs_saveDirectoryEntry(afatfsFilePtr_t file, a
                    entry->fileSize = file->physicalSize;
                break;
                case AFATFS_SAVE_DIRECTORY_DELETED:
-                   entry->filename[0] = FAT_DELETED_FILE_MARKER;
+                   entry->filename[0] = (char) FAT_DELETED_FILE_MARKER;
                    FALLTHROUGH;
 
                case AFATFS_SAVE_DIRECTORY_FOR_CLOSE:
@@ -2124,7 +2239,7 @@ afatfsOperationStatus_e afatfs_fseek(afatfsFilePtr_t file, int32_t offset, afatf
         break;
 
         case AFATFS_SEEK_SET:
-            FALLTHROUGH;
+        break;
     }
 
     // Now we have a SEEK_SET with a positive offset. Begin by seeking to the start of the file
@@ -3607,6 +3722,8 @@ afatfsError_e afatfs_getLastError(void)
 
 void afatfs_init(void)
 {
+    afatfs_cacheInit();
+
     afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_INITIALIZATION;
     afatfs.initPhase = AFATFS_INITIALIZATION_READ_MBR;
     afatfs.lastClusterAllocated = FAT_SMALLEST_LEGAL_CLUSTER_NUMBER;
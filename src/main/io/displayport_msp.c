@@ -27,6 +27,7 @@
 
 #ifdef USE_MSP_DISPLAYPORT
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "pg/pg.h"
@@ -43,8 +44,35 @@
 // no template required since defaults are zero
 PG_REGISTER(displayPortProfile_t, displayPortProfileMsp, PG_DISPLAY_PORT_MSP_CONFIG, 0);
 
+// MSP v1 header and checksum
+#define MSP_V1_FRAME_OVERHEAD 6
+// sub-command, row, column and attribute of a write string command
+#define MSP_DISPLAYPORT_WRITE_OVERHEAD 4
+/*
+ * A write string command costs this much on top of its text, so rewriting fewer unchanged characters than this to
+ * join two changed runs is cheaper than sending the second run in a frame of its own.
+ */
+#define MSP_DISPLAYPORT_RUN_OVERHEAD (MSP_V1_FRAME_OVERHEAD + MSP_DISPLAYPORT_WRITE_OVERHEAD)
+#define MSP_DISPLAYPORT_CLEAR_SIZE (MSP_V1_FRAME_OVERHEAD + 1)
+
+STATIC_ASSERT(MSP_DISPLAYPORT_ROWS_MAX <= sizeof(uint16_t) * 8, msp_displayport_too_many_rows);
+
 static displayPort_t mspDisplayPort;
 
+/*
+ * The OSD and CMS draw into buffer, and drawScreen() sends the remote display the runs of characters that differ
+ * from what it is showing, which is kept in shown.
+ */
+static struct {
+    char buffer[MSP_DISPLAYPORT_ROWS_MAX][MSP_DISPLAYPORT_COLS_MAX];
+    char shown[MSP_DISPLAYPORT_ROWS_MAX][MSP_DISPLAYPORT_COLS_MAX];
+    char blankRow[MSP_DISPLAYPORT_COLS_MAX];
+    uint16_t pendingRows;   // rows that may differ from the remote display
+    bool cleared;           // the buffer was cleared since the last drawScreen
+    bool resend;            // the state of the remote display is unknown, so clear it and send everything
+    bool drawPending;       // runs were sent, but the remote display hasn't been told to draw them yet
+} mspScreen;
+
 #ifdef USE_CLI
 extern uint8_t cliMode;
 #endif
@@ -81,20 +109,135 @@ static int release(displayPort_t *displayPort)
 {
     uint8_t subcmd[] = { 1 };
 
+    // the remote display goes back to its own content
+    mspScreen.resend = true;
+
     return output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd));
 }
 
 static int clearScreen(displayPort_t *displayPort)
+{
+    memset(mspScreen.buffer, ' ', sizeof(mspScreen.buffer));
+    mspScreen.pendingRows = (1 << displayPort->rows) - 1;
+    mspScreen.cleared = true;
+
+    return 0;
+}
+
+static bool clearRemote(displayPort_t *displayPort)
 {
     uint8_t subcmd[] = { 2 };
 
-    return output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd));
+    if (!output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd))) {
+        return false;
+    }
+
+    memset(mspScreen.shown, ' ', sizeof(mspScreen.shown));
+    mspScreen.pendingRows = (1 << displayPort->rows) - 1;
+    return true;
+}
+
+static bool sendRun(displayPort_t *displayPort, uint8_t row, uint8_t col, int len)
+{
+    uint8_t buf[MSP_DISPLAYPORT_WRITE_OVERHEAD + MSP_DISPLAYPORT_COLS_MAX];
+
+    buf[0] = 3;
+    buf[1] = row;
+    buf[2] = col;
+    buf[3] = 0;
+    memcpy(&buf[4], &mspScreen.buffer[row][col], len);
+
+    if (!output(displayPort, MSP_DISPLAYPORT, buf, len + MSP_DISPLAYPORT_WRITE_OVERHEAD)) {
+        return false;
+    }
+
+    memcpy(&mspScreen.shown[row][col], &mspScreen.buffer[row][col], len);
+    return true;
+}
+
+/*
+ * Finds the runs of a row of the buffer that differ from shown, joining runs that are separated by fewer unchanged
+ * characters than the cost of a frame. The runs are sent if transmit is set, otherwise only their cost is counted.
+ *
+ * Returns the number of bytes the row costs, or -1 if the transmit buffer filled up.
+ */
+static int updateRow(displayPort_t *displayPort, uint8_t row, const char *shown, bool transmit)
+{
+    const char *buffer = mspScreen.buffer[row];
+    int bytes = 0;
+    int col = 0;
+
+    while (col < displayPort->cols) {
+        if (buffer[col] == shown[col]) {
+            col++;
+            continue;
+        }
+
+        const int start = col;
+        int end = col + 1;
+        for (col = end; col < displayPort->cols && col - end < MSP_DISPLAYPORT_RUN_OVERHEAD; col++) {
+            if (buffer[col] != shown[col]) {
+                end = col + 1;
+            }
+        }
+        col = end;
+
+        if (transmit && !sendRun(displayPort, row, start, end - start)) {
+            return -1;
+        }
+        bytes += MSP_DISPLAYPORT_RUN_OVERHEAD + end - start;
+    }
+
+    return bytes;
 }
 
 static int drawScreen(displayPort_t *displayPort)
 {
-    uint8_t subcmd[] = { 4 };
-    return output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd));
+    if (mspScreen.resend) {
+        if (!clearRemote(displayPort)) {
+            return 0;
+        }
+        mspScreen.resend = false;
+    } else if (mspScreen.cleared) {
+        // When most of the screen changed, clearing the remote display is cheaper than blanking each character
+        int diffBytes = 0;
+        int clearBytes = MSP_DISPLAYPORT_CLEAR_SIZE;
+        for (int row = 0; row < displayPort->rows; row++) {
+            diffBytes += updateRow(displayPort, row, mspScreen.shown[row], false);
+            clearBytes += updateRow(displayPort, row, mspScreen.blankRow, false);
+        }
+        if (clearBytes < diffBytes && !clearRemote(displayPort)) {
+            return 0;
+        }
+    }
+    mspScreen.cleared = false;
+
+    int bytes = 0;
+    for (int row = 0; row < displayPort->rows; row++) {
+        if (!(mspScreen.pendingRows & (1 << row))) {
+            continue;
+        }
+
+        const int rowBytes = updateRow(displayPort, row, mspScreen.shown[row], true);
+        if (rowBytes < 0) {
+            // Out of transmit buffer, carry on from here next time
+            break;
+        }
+        if (rowBytes) {
+            mspScreen.drawPending = true;
+        }
+        mspScreen.pendingRows &= ~(1 << row);
+        bytes += rowBytes;
+    }
+
+    if (mspScreen.drawPending) {
+        uint8_t subcmd[] = { 4 };
+        if (output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd))) {
+            mspScreen.drawPending = false;
+        }
+    }
+
+    return bytes;
 }
 
 static int screenSize(const displayPort_t *displayPort)
@@ -104,21 +247,18 @@ static int screenSize(const displayPort_t *displayPort)
 
 static int writeString(displayPort_t *displayPort, uint8_t col, uint8_t row, const char *string)
 {
-#define MSP_OSD_MAX_STRING_LENGTH 30 // FIXME move this
-    uint8_t buf[MSP_OSD_MAX_STRING_LENGTH + 4];
-
-    int len = strlen(string);
-    if (len >= MSP_OSD_MAX_STRING_LENGTH) {
-        len = MSP_OSD_MAX_STRING_LENGTH;
+    if (row >= displayPort->rows || col >= displayPort->cols) {
+        return 0;
     }
 
-    buf[0] = 3;
-    buf[1] = row;
-    buf[2] = col;
-    buf[3] = 0;
-    memcpy(&buf[4], string, len);
+    const int len = MIN((int)strlen(string), displayPort->cols - col);
+    char *rowStart = &mspScreen.buffer[row][col];
+    if (memcmp(rowStart, string, len)) {
+        memcpy(rowStart, string, len);
+        mspScreen.pendingRows |= 1 << row;
+    }
 
-    return output(displayPort, MSP_DISPLAYPORT, buf, len + 4);
+    return 0;
 }
 
 static int writeChar(displayPort_t *displayPort, uint8_t col, uint8_t row, uint8_t c)
@@ -127,7 +267,7 @@ static int writeChar(displayPort_t *displayPort, uint8_t col, uint8_t row, uint8
 
     buf[0] = c;
     buf[1] = 0;
-    return writeString(displayPort, col, row, buf); //!!TODO - check if there is a direct MSP command to do this
+    return writeString(displayPort, col, row, buf);
 }
 
 static bool isTransferInProgress(const displayPort_t *displayPort)
@@ -144,8 +284,9 @@ static bool isSynced(const displayPort_t *displayPort)
 
 static void resync(displayPort_t *displayPort)
 {
-    displayPort->rows = 13 + displayPortProfileMsp()->rowAdjust; // XXX Will reflect NTSC/PAL in the future
-    displayPort->cols = 30 + displayPortProfileMsp()->colAdjust;
+    displayPort->rows = MSP_DISPLAYPORT_ROWS_MAX + displayPortProfileMsp()->rowAdjust; // XXX Will reflect NTSC/PAL in the future
+    displayPort->cols = MSP_DISPLAYPORT_COLS_MAX + displayPortProfileMsp()->colAdjust;
+    mspScreen.resend = true;
     drawScreen(displayPort);
 }
 
@@ -173,6 +314,8 @@ static const displayPortVTable_t mspDisplayPortVTable = {
 displayPort_t *displayPortMspInit(void)
 {
     displayInit(&mspDisplayPort, &mspDisplayPortVTable);
+    memset(mspScreen.buffer, ' ', sizeof(mspScreen.buffer));
+    memset(mspScreen.blankRow, ' ', sizeof(mspScreen.blankRow));
     resync(&mspDisplayPort);
     return &mspDisplayPort;
 }
@@ -23,6 +23,9 @@
 #include "pg/pg.h"
 #include "drivers/display.h"
 
+#define MSP_DISPLAYPORT_ROWS_MAX 13
+#define MSP_DISPLAYPORT_COLS_MAX 30
+
 PG_DECLARE(displayPortProfile_t, displayPortProfileMsp);
 
 struct displayPort_s;
@@ -38,7 +38,11 @@
 
 #include "platform.h"
 
+#include "common/crc.h"
+#include "common/maths.h"
 #include "common/printf.h"
+#include "common/time.h"
+#include "common/utils.h"
 #include "drivers/flash.h"
 
 #include "io/flashfs.h"
@@ -47,6 +51,8 @@ static const flashPartition_t *flashPartition = NULL;
 static const flashGeometry_t *flashGeometry = NULL;
 static uint32_t flashfsSize = 0;
 
+STATIC_ASSERT(FLASHFS_WRITE_BUFFER_SIZE <= UINT16_MAX, FLASHFS_WRITE_BUFFER_SIZE_too_large);
+
 static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
 
 /* The position of our head and tail in the circular flash write buffer.
@@ -56,11 +62,64 @@ static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
  *
  * When the circular buffer is empty, head == tail
  */
-static uint8_t bufferHead = 0, bufferTail = 0;
+static uint16_t bufferHead = 0, bufferTail = 0;
 
 // The position of the buffer's tail in the overall flash address space:
 static uint32_t tailAddress = 0;
 
+/*
+ * A background erase works through the sectors [eraseSector, eraseEndSector) in order, one sector whenever the device
+ * would otherwise be idle. Writes only wait for it once they catch up with eraseSector, so logging can start as soon
+ * as the erase is requested.
+ */
+static bool erasing = false;
+static flashSector_t eraseSector = 0;
+static flashSector_t eraseEndSector = 0;
+
+#ifdef USE_FLASHFS_LOG_INDEX
+/*
+ * The log index lives in its own partition after the volume. Each record is written to the start of its own page in a
+ * single program operation, since NAND pages can't be programmed twice. Slot 0 holds a format record, written when the
+ * volume is erased, which marks the index as describing the volume; every log closed after that appends a record to
+ * the next slot. The index is only erased together with the volume, so like the log data each slot is programmed once
+ * per erase cycle.
+ */
+#define FLASHFS_LOG_INDEX_MAGIC 0x58444E49 // "INDX"
+
+typedef enum {
+    FLASHFS_LOG_INDEX_RECORD_FORMAT = 1,
+    FLASHFS_LOG_INDEX_RECORD_LOG = 2,
+    FLASHFS_LOG_INDEX_RECORD_ERASED = 3, // A background erase started by the format record has finished
+} flashfsLogIndexRecordType_e;
+
+// The volume was formatted by a background erase of its first 'length' bytes
+#define FLASHFS_LOG_INDEX_FORMAT_FLAG_ERASING (1 << 0)
+
+typedef struct flashfsLogIndexRecord_s {
+    uint32_t magic;
+    uint8_t type;
+    uint8_t flags;
+    uint16_t crc;
+    uint32_t start;
+    uint32_t length;
+    uint32_t timestamp;
+} flashfsLogIndexRecord_t;
+
+static const flashPartition_t *logIndexPartition = NULL;
+static uint32_t logIndexSlotCount = 0;
+// Slots in use including the format record, 0 if the volume isn't indexed
+static uint32_t logIndexRecordCount = 0;
+// End of the newest indexed log
+static uint32_t logIndexEnd = 0;
+// Start of the log being written, recorded in the index when the log is closed
+static uint32_t logStartAddress = 0;
+// End of the region a background erase has to cover, 0 if the volume doesn't need erasing
+static uint32_t logIndexEraseEnd = 0;
+
+static void flashfsLogIndexFormat(uint32_t eraseEnd);
+static void flashfsLogIndexEraseFinished(void);
+#endif
+
 static void flashfsClearBuffer(void)
 {
     bufferTail = bufferHead = 0;
@@ -76,9 +135,80 @@ static void flashfsSetTailAddress(uint32_t address)
     tailAddress = address;
 }
 
+static void flashfsEraseStart(flashSector_t startSector, flashSector_t endSector)
+{
+    eraseSector = startSector;
+    eraseEndSector = endSector;
+    erasing = true;
+}
+
+/**
+ * Take the background erase a step further, by erasing the next sector or by recording that the erase is finished.
+ *
+ * In asynchronous mode nothing is done if the device is busy, in synchronous mode the step waits for the device.
+ */
+static void flashfsEraseProcess(bool sync)
+{
+    if (!erasing || (!sync && !flashIsReady())) {
+        return;
+    }
+
+    if (eraseSector < eraseEndSector) {
+        flashEraseSector(eraseSector * flashGeometry->sectorSize);
+        eraseSector++;
+    } else {
+        // The last sector erase has completed
+        erasing = false;
+#ifdef USE_FLASHFS_LOG_INDEX
+        flashfsLogIndexEraseFinished();
+#endif
+    }
+}
+
+/**
+ * Called periodically by the system task, so that a background erase finishes when nothing is logging or polling
+ * flashfsIsReady().
+ */
+void flashfsPoll(void)
+{
+    flashfsEraseProcess(false);
+}
+
+/**
+ * Returns true if the page holding the given address has been erased, so can be programmed.
+ */
+static bool flashfsIsErasedForWrite(uint32_t address)
+{
+    const flashSector_t sector = address / flashGeometry->sectorSize;
+
+    return !erasing || sector < eraseSector || sector >= eraseEndSector;
+}
+
+/**
+ * Returns the sector after the last one which has to be erased to clear the volume.
+ */
+static flashSector_t flashfsEraseEndSector(void)
+{
+    flashSector_t endSector = flashPartition->endSector + 1;
+
+#ifdef USE_FLASHFS_LOG_INDEX
+    if (logIndexRecordCount > 0 && !erasing) {
+        // The index shows the rest of the volume is still erased, so only the sectors holding logs need erasing
+        const uint32_t sectorSize = flashGeometry->sectorSize;
+        endSector = MIN(endSector, (flashfsIdentifyStartOfFreeSpace() + sectorSize - 1) / sectorSize);
+    }
+#endif
+
+    return endSector;
+}
+
 void flashfsEraseCompletely(void)
 {
-    for (flashSector_t sectorIndex = flashPartition->startSector; sectorIndex <= flashPartition->endSector; sectorIndex++) {
+    const flashSector_t endSector = flashfsEraseEndSector();
+
+    erasing = false;
+
+    for (flashSector_t sectorIndex = flashPartition->startSector; sectorIndex < endSector; sectorIndex++) {
         uint32_t sectorAddress = sectorIndex * flashGeometry->sectorSize;
         flashEraseSector(sectorAddress);
     }
@@ -86,6 +216,31 @@ void flashfsEraseCompletely(void)
     flashfsClearBuffer();
 
     flashfsSetTailAddress(0);
+
+#ifdef USE_FLASHFS_LOG_INDEX
+    flashfsLogIndexFormat(0);
+#endif
+}
+
+/**
+ * Erase the volume in the background, returning immediately.
+ *
+ * The file pointer moves to the start of the volume and data can be written straight away, it is held in the write
+ * buffer until the erase has passed the page it belongs in. flashfsIsReady() returns false until the erase finishes.
+ */
+void flashfsEraseAsync(void)
+{
+    const flashSector_t endSector = flashfsEraseEndSector();
+
+    flashfsClearBuffer();
+
+    flashfsSetTailAddress(0);
+
+    flashfsEraseStart(flashPartition->startSector, endSector);
+
+#ifdef USE_FLASHFS_LOG_INDEX
+    flashfsLogIndexFormat(endSector * flashGeometry->sectorSize);
+#endif
 }
 
 /**
@@ -116,12 +271,19 @@ void flashfsEraseRange(uint32_t start, uint32_t end)
 
 /**
  * Return true if the flash is not currently occupied with an operation.
+ *
+ * Callers poll this to wait for a background erase, so each call also takes the erase a step further.
  */
 bool flashfsIsReady(void)
 {
     // Check for flash chip existence first, then check if ready.
+    if (!flashfsIsSupported()) {
+        return false;
+    }
 
-    return (flashfsIsSupported() && flashIsReady());
+    flashfsEraseProcess(false);
+
+    return !erasing && flashIsReady();
 }
 
 bool flashfsIsSupported(void)
@@ -174,10 +336,12 @@ uint32_t flashfsGetWriteBufferFreeSpace(void)
  * bufferSizes: an array of the sizes of those buffers
  * sync: true if we should wait for the device to be idle before writes, otherwise if the device is busy the
  *       write will be aborted and this routine will return immediately.
+ * fullPagesOnly: true to leave a final partial page in the buffers, so that it can be programmed whole once the rest
+ *       of it has been written.
  *
  * Returns the number of bytes written
  */
-static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSizes, int bufferCount, bool sync)
+static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSizes, int bufferCount, bool sync, bool fullPagesOnly)
 {
     uint32_t bytesTotal = 0;
 
@@ -195,6 +359,11 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
 
     uint16_t pageSize = flashGeometry->pageSize;
 
+    // A page which can't fit in the buffer has to be programmed in pieces
+    if (pageSize > FLASHFS_WRITE_BUFFER_USABLE) {
+        fullPagesOnly = false;
+    }
+
     while (bytesTotalRemaining > 0) {
         uint32_t bytesTotalThisIteration;
         uint32_t bytesRemainThisIteration;
@@ -203,8 +372,10 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
          * Each page needs to be saved in a separate program operation, so
          * if we would cross a page boundary, only write up to the boundary in this iteration:
          */
-        if (tailAddress % pageSize + bytesTotalRemaining > pageSize) {
+        if (tailAddress % pageSize + bytesTotalRemaining >= pageSize) {
             bytesTotalThisIteration = pageSize - tailAddress % pageSize;
+        } else if (fullPagesOnly) {
+            break;
         } else {
             bytesTotalThisIteration = bytesTotalRemaining;
         }
@@ -217,6 +388,17 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
             break;
         }
 
+        // Has the write caught up with a background erase? Wait for the erase to pass this page.
+        if (!flashfsIsErasedForWrite(tailAddress)) {
+            if (!sync) {
+                break;
+            }
+
+            flashfsEraseProcess(true);
+
+            continue;
+        }
+
         flashPageProgramBegin(tailAddress);
 
         bytesRemainThisIteration = bytesTotalThisIteration;
@@ -315,24 +497,41 @@ static void flashfsAdvanceTailInBuffer(uint32_t delta)
 }
 
 /**
- * If the flash is ready to accept writes, flush the buffer to it.
+ * Returns true once the given amount of buffered data completes the page the tail is in, so that flushing it programs
+ * a whole page.
+ */
+static bool flashfsShouldFlush(uint32_t bytesBuffered)
+{
+    const uint32_t pageSize = flashGeometry->pageSize;
+
+    if (pageSize > FLASHFS_WRITE_BUFFER_USABLE) {
+        return bytesBuffered >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN;
+    }
+
+    return tailAddress % pageSize + bytesBuffered >= pageSize;
+}
+
+/**
+ * If the flash is ready to accept writes, flush the buffer to it. Unless forced, only whole pages are written and a
+ * final partial page stays in the buffer until it fills up. A background erase runs while there is nothing to write.
  *
  * Returns true if all data in the buffer has been flushed to the device, or false if
  * there is still data to be written (call flush again later).
  */
-bool flashfsFlushAsync(void)
+bool flashfsFlushAsync(bool force)
 {
-    if (flashfsBufferIsEmpty()) {
-        return true; // Nothing to flush
-    }
+    if (!flashfsBufferIsEmpty()) {
+        uint8_t const * buffers[2];
+        uint32_t bufferSizes[2];
+        uint32_t bytesWritten;
 
-    uint8_t const * buffers[2];
-    uint32_t bufferSizes[2];
-    uint32_t bytesWritten;
+        flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+        bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 2, false, !force);
+        flashfsAdvanceTailInBuffer(bytesWritten);
+    }
 
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-    bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 2, false);
-    flashfsAdvanceTailInBuffer(bytesWritten);
+    // Does nothing if a page is being programmed
+    flashfsEraseProcess(false);
 
     return flashfsBufferIsEmpty();
 }
@@ -353,7 +552,7 @@ void flashfsFlushSync(void)
     uint32_t bufferSizes[2];
 
     flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-    flashfsWriteBuffers(buffers, bufferSizes, 2, true);
+    flashfsWriteBuffers(buffers, bufferSizes, 2, true, false);
 
     // We've written our entire buffer now:
     flashfsClearBuffer();
@@ -364,6 +563,10 @@ void flashfsSeekAbs(uint32_t offset)
     flashfsFlushSync();
 
     flashfsSetTailAddress(offset);
+
+#ifdef USE_FLASHFS_LOG_INDEX
+    logStartAddress = offset;
+#endif
 }
 
 void flashfsSeekRel(int32_t offset)
@@ -384,8 +587,8 @@ void flashfsWriteByte(uint8_t byte)
         bufferHead = 0;
     }
 
-    if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
-        flashfsFlushAsync();
+    if (flashfsShouldFlush(flashfsTransmitBufferUsed())) {
+        flashfsFlushAsync(false);
     }
 }
 
@@ -408,14 +611,13 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
     bufferSizes[2] = len;
 
     /*
-     * Would writing this data to our buffer cause our buffer to reach the flush threshold? If so try to write through
-     * to the flash now
+     * Would writing this data to our buffer complete a page? If so try to write through to the flash now
      */
-    if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
+    if (flashfsShouldFlush(bufferSizes[0] + bufferSizes[1] + bufferSizes[2])) {
         uint32_t bytesWritten;
 
-        // Attempt to write all three buffers through to the flash asynchronously
-        bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 3, false);
+        // Attempt to write whole pages from all three buffers through to the flash asynchronously
+        bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 3, false, true);
 
         if (bufferSizes[0] == 0 && bufferSizes[1] == 0) {
             // We wrote all the data that was previously buffered
@@ -434,7 +636,7 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
         if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] > FLASHFS_WRITE_BUFFER_USABLE) {
             if (sync) {
                 // Write it through synchronously
-                flashfsWriteBuffers(buffers, bufferSizes, 3, true);
+                flashfsWriteBuffers(buffers, bufferSizes, 3, true, false);
                 flashfsClearBuffer();
             } else {
                 /*
@@ -480,7 +682,11 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
  */
 int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
 {
-    int bytesRead;
+    int bytesRead = 0;
+
+    if (address >= flashfsSize) {
+        return 0;
+    }
 
     // Did caller try to read past the end of the volume?
     if (address + len > flashfsSize) {
@@ -491,15 +697,55 @@ int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
     // Since the read could overlap data in our dirty buffers, force a sync to clear those first
     flashfsFlushSync();
 
-    bytesRead = flashReadBytes(address, buffer, len);
+    // Some devices can't read across a page boundary in one go
+    while (len > 0) {
+        const int bytesReadThisIteration = flashReadBytes(address + bytesRead, buffer + bytesRead, len);
+        if (bytesReadThisIteration <= 0) {
+            break;
+        }
+
+        bytesRead += bytesReadThisIteration;
+        len -= bytesReadThisIteration;
+    }
 
     return bytesRead;
 }
 
+enum {
+    /* We can choose whatever power of 2 size we like, which determines how much wastage of free space we'll have
+     * at the end of the last written data. But smaller blocksizes will require more searching.
+     */
+    FREE_BLOCK_SIZE = 2048, // XXX This can't be smaller than page size for underlying flash device.
+
+    /* We don't expect valid data to ever contain this many consecutive uint32_t's of all 1 bits: */
+    FREE_BLOCK_TEST_SIZE_INTS = 4, // i.e. 16 bytes
+    FREE_BLOCK_TEST_SIZE_BYTES = FREE_BLOCK_TEST_SIZE_INTS * sizeof(uint32_t)
+};
+
+STATIC_ASSERT(FREE_BLOCK_SIZE >= FLASH_MAX_PAGE_SIZE, FREE_BLOCK_SIZE_too_small);
+
+typedef union {
+    uint8_t bytes[FREE_BLOCK_TEST_SIZE_BYTES];
+    uint32_t ints[FREE_BLOCK_TEST_SIZE_INTS];
+} freeBlockTestBuffer_t;
+
+static bool flashfsIsErasedTestBuffer(const freeBlockTestBuffer_t *testBuffer)
+{
+    // Checking the buffer 4 bytes at a time like this is probably faster than byte-by-byte, but I didn't benchmark it :)
+    for (int i = 0; i < FREE_BLOCK_TEST_SIZE_INTS; i++) {
+        if (testBuffer->ints[i] != 0xFFFFFFFF) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /**
- * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ * Find the offset of the start of the free space on the device at or after the given offset (or the size of the
+ * device if it is full).
  */
-int flashfsIdentifyStartOfFreeSpace(void)
+static uint32_t flashfsFindStartOfFreeSpace(uint32_t searchStart)
 {
     /* Find the start of the free space on the device by examining the beginning of blocks with a binary search,
      * looking for ones that appear to be erased. We can achieve this with good accuracy because an erased block
@@ -510,30 +756,12 @@ int flashfsIdentifyStartOfFreeSpace(void)
      * bandwidth and block more often.
      */
 
-    enum {
-        /* We can choose whatever power of 2 size we like, which determines how much wastage of free space we'll have
-         * at the end of the last written data. But smaller blocksizes will require more searching.
-         */
-        FREE_BLOCK_SIZE = 2048, // XXX This can't be smaller than page size for underlying flash device.
-
-        /* We don't expect valid data to ever contain this many consecutive uint32_t's of all 1 bits: */
-        FREE_BLOCK_TEST_SIZE_INTS = 4, // i.e. 16 bytes
-        FREE_BLOCK_TEST_SIZE_BYTES = FREE_BLOCK_TEST_SIZE_INTS * sizeof(uint32_t)
-    };
-
-    STATIC_ASSERT(FREE_BLOCK_SIZE >= FLASH_MAX_PAGE_SIZE, FREE_BLOCK_SIZE_too_small);
+    freeBlockTestBuffer_t testBuffer;
 
-    union {
-        uint8_t bytes[FREE_BLOCK_TEST_SIZE_BYTES];
-        uint32_t ints[FREE_BLOCK_TEST_SIZE_INTS];
-    } testBuffer;
-
-    int left = 0; // Smallest block index in the search region
+    int left = (searchStart + FREE_BLOCK_SIZE - 1) / FREE_BLOCK_SIZE; // Smallest block index in the search region
     int right = flashfsSize / FREE_BLOCK_SIZE; // One past the largest block index in the search region
     int mid;
     int result = right;
-    int i;
-    bool blockErased;
 
     while (left < right) {
         mid = (left + right) / 2;
@@ -543,16 +771,7 @@ int flashfsIdentifyStartOfFreeSpace(void)
             break;
         }
 
-        // Checking the buffer 4 bytes at a time like this is probably faster than byte-by-byte, but I didn't benchmark it :)
-        blockErased = true;
-        for (i = 0; i < FREE_BLOCK_TEST_SIZE_INTS; i++) {
-            if (testBuffer.ints[i] != 0xFFFFFFFF) {
-                blockErased = false;
-                break;
-            }
-        }
-
-        if (blockErased) {
+        if (flashfsIsErasedTestBuffer(&testBuffer)) {
             /* This erased block might be the leftmost erased block in the volume, but we'll need to continue the
              * search leftwards to find out:
              */
@@ -567,6 +786,42 @@ int flashfsIdentifyStartOfFreeSpace(void)
     return result * FREE_BLOCK_SIZE;
 }
 
+#ifdef USE_FLASHFS_LOG_INDEX
+static bool flashfsIsErasedAt(uint32_t address)
+{
+    freeBlockTestBuffer_t testBuffer;
+
+    if (flashReadBytes(address, testBuffer.bytes, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
+        return false;
+    }
+
+    return flashfsIsErasedTestBuffer(&testBuffer);
+}
+#endif
+
+/**
+ * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ */
+int flashfsIdentifyStartOfFreeSpace(void)
+{
+#ifdef USE_FLASHFS_LOG_INDEX
+    if (logIndexRecordCount > 0) {
+        // Everything up to the end of the newest indexed log is in use, the rest of the volume only needs searching
+        // if a log was written after it without being closed
+        if (logIndexEnd >= flashfsSize) {
+            return flashfsSize;
+        }
+        if (flashfsIsErasedAt(logIndexEnd)) {
+            return logIndexEnd;
+        }
+    }
+
+    return flashfsFindStartOfFreeSpace(logIndexEnd);
+#else
+    return flashfsFindStartOfFreeSpace(0);
+#endif
+}
+
 /**
  * Returns true if the file pointer is at the end of the device.
  */
@@ -575,8 +830,267 @@ bool flashfsIsEOF(void)
     return tailAddress >= flashfsSize;
 }
 
+#ifdef USE_FLASHFS_LOG_INDEX
+static uint32_t flashfsLogIndexTimestamp(void)
+{
+#ifdef USE_RTC_TIME
+    rtcTime_t now;
+    if (rtcGet(&now)) {
+        return rtcTimeGetSeconds(&now);
+    }
+#endif
+    return 0;
+}
+
+static uint32_t flashfsLogIndexSlotAddress(uint32_t slot)
+{
+    return logIndexPartition->startSector * flashGeometry->sectorSize + slot * flashGeometry->pageSize;
+}
+
+static uint16_t flashfsLogIndexRecordCrc(const flashfsLogIndexRecord_t *record)
+{
+    flashfsLogIndexRecord_t unsignedRecord = *record;
+    unsignedRecord.crc = 0;
+
+    return crc16_ccitt_update(0, &unsignedRecord, sizeof(unsignedRecord));
+}
+
+/**
+ * Returns true if the slot holds an intact record.
+ */
+static bool flashfsLogIndexReadSlot(uint32_t slot, flashfsLogIndexRecord_t *record)
+{
+    if (flashReadBytes(flashfsLogIndexSlotAddress(slot), (uint8_t *)record, sizeof(*record)) < (int)sizeof(*record)) {
+        return false;
+    }
+
+    return record->magic == FLASHFS_LOG_INDEX_MAGIC && record->crc == flashfsLogIndexRecordCrc(record);
+}
+
+static bool flashfsLogIndexSlotIsFree(uint32_t slot)
+{
+    uint8_t buffer[sizeof(flashfsLogIndexRecord_t)];
+
+    if (flashReadBytes(flashfsLogIndexSlotAddress(slot), buffer, sizeof(buffer)) < (int)sizeof(buffer)) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < sizeof(buffer); i++) {
+        if (buffer[i] != 0xFF) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool flashfsLogIndexWrite(flashfsLogIndexRecordType_e type, uint8_t flags, uint32_t start, uint32_t length)
+{
+    if (logIndexRecordCount >= logIndexSlotCount) {
+        // The index is full, any further logs will be found by scanning the volume
+        return false;
+    }
+    if (type == FLASHFS_LOG_INDEX_RECORD_LOG && logIndexEraseEnd > 0 && logIndexRecordCount + 1 >= logIndexSlotCount) {
+        // Keep the last slot for the erase finished marker
+        return false;
+    }
+
+    flashfsLogIndexRecord_t record = {
+        .magic = FLASHFS_LOG_INDEX_MAGIC,
+        .type = type,
+        .flags = flags,
+        .crc = 0,
+        .start = start,
+        .length = length,
+        .timestamp = flashfsLogIndexTimestamp(),
+    };
+    record.crc = flashfsLogIndexRecordCrc(&record);
+
+    flashPageProgram(flashfsLogIndexSlotAddress(logIndexRecordCount), (const uint8_t *)&record, sizeof(record));
+    flashFlush();
+
+    logIndexRecordCount++;
+
+    return true;
+}
+
+/**
+ * Erase the index and mark it as describing an empty volume.
+ *
+ * eraseEnd: the end of the region a background erase is about to clear, or 0 if the volume is already erased. Until
+ *           the erase is recorded as finished, it is resumed at startup.
+ */
+static void flashfsLogIndexFormat(uint32_t eraseEnd)
+{
+    logIndexRecordCount = 0;
+    logIndexEnd = 0;
+    logStartAddress = 0;
+    logIndexEraseEnd = eraseEnd;
+
+    if (!logIndexPartition) {
+        return;
+    }
+
+    for (flashSector_t sectorIndex = logIndexPartition->startSector; sectorIndex <= logIndexPartition->endSector; sectorIndex++) {
+        flashEraseSector(sectorIndex * flashGeometry->sectorSize);
+    }
+
+    flashfsLogIndexWrite(FLASHFS_LOG_INDEX_RECORD_FORMAT, eraseEnd ? FLASHFS_LOG_INDEX_FORMAT_FLAG_ERASING : 0, 0, eraseEnd);
+}
+
+static void flashfsLogIndexEraseFinished(void)
+{
+    if (logIndexRecordCount > 0 && logIndexEraseEnd > 0) {
+        flashfsLogIndexWrite(FLASHFS_LOG_INDEX_RECORD_ERASED, 0, 0, logIndexEraseEnd);
+    }
+
+    logIndexEraseEnd = 0;
+}
+
+static void flashfsLogIndexAddLog(uint32_t start, uint32_t end, uint8_t flags)
+{
+    if (logIndexRecordCount == 0 || end <= start) {
+        return;
+    }
+
+    if (flashfsLogIndexWrite(FLASHFS_LOG_INDEX_RECORD_LOG, flags, start, end - start)) {
+        logIndexEnd = end;
+    }
+}
+
+static void flashfsLogIndexLoad(void)
+{
+    logIndexSlotCount = 0;
+    logIndexRecordCount = 0;
+    logIndexEnd = 0;
+    logIndexEraseEnd = 0;
+
+    logIndexPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS_LOG_INDEX);
+    if (!logIndexPartition) {
+        return;
+    }
+
+    logIndexSlotCount = FLASH_PARTITION_SECTOR_COUNT(logIndexPartition) * flashGeometry->pagesPerSector;
+
+    flashfsLogIndexRecord_t record;
+    if (!flashfsLogIndexReadSlot(0, &record) || record.type != FLASHFS_LOG_INDEX_RECORD_FORMAT) {
+        // Not formatted since the volume was last erased, logs have to be found by scanning
+        return;
+    }
+    if (record.flags & FLASHFS_LOG_INDEX_FORMAT_FLAG_ERASING) {
+        logIndexEraseEnd = record.length;
+    }
+
+    // Records are only ever appended, so binary search for the first free slot
+    uint32_t left = 1;
+    uint32_t right = logIndexSlotCount;
+    while (left < right) {
+        const uint32_t mid = (left + right) / 2;
+
+        if (flashfsLogIndexSlotIsFree(mid)) {
+            right = mid;
+        } else {
+            left = mid + 1;
+        }
+    }
+    logIndexRecordCount = left;
+
+    // Skip over a record that was torn by a power loss
+    for (uint32_t slot = logIndexRecordCount - 1; slot > 0; slot--) {
+        if (flashfsLogIndexReadSlot(slot, &record) && record.type == FLASHFS_LOG_INDEX_RECORD_LOG) {
+            logIndexEnd = record.start + record.length;
+            break;
+        }
+    }
+
+    // The erase finished marker is written soon after formatting, so it is found near the start of the index
+    for (uint32_t slot = 1; slot < logIndexRecordCount && logIndexEraseEnd > 0; slot++) {
+        if (flashfsLogIndexReadSlot(slot, &record) && record.type == FLASHFS_LOG_INDEX_RECORD_ERASED) {
+            logIndexEraseEnd = 0;
+        }
+    }
+}
+
+/**
+ * Bring the index up to date with the volume, returning the start of the free space.
+ */
+static uint32_t flashfsLogIndexRecover(void)
+{
+    if (logIndexRecordCount > 0 && logIndexEraseEnd > 0) {
+        /*
+         * Power was lost during a background erase, so the volume after the indexed logs can still hold old data.
+         * Resume the erase from the sector after the last indexed log, a log left open during the erase is lost.
+         */
+        const uint32_t sectorSize = flashGeometry->sectorSize;
+        const flashSector_t resumeSector = (logIndexEnd + sectorSize - 1) / sectorSize;
+
+        flashfsEraseStart(resumeSector, MAX(resumeSector, logIndexEraseEnd / sectorSize));
+
+        return resumeSector * sectorSize;
+    }
+
+    const uint32_t freeSpaceStart = flashfsIdentifyStartOfFreeSpace();
+
+    if (logIndexRecordCount == 0) {
+        if (freeSpaceStart == 0) {
+            // Nothing to lose by indexing an empty volume straight away
+            flashfsLogIndexFormat(0);
+        }
+    } else if (freeSpaceStart > logIndexEnd) {
+        // A log was written but never closed, e.g. power was lost while logging
+        flashfsLogIndexAddLog(logIndexEnd, freeSpaceStart, FLASHFS_LOG_FLAG_RECOVERED);
+    }
+
+    return freeSpaceStart;
+}
+
+/**
+ * Get the number of records after the format record, flashfsLogIndexGet() skips those which don't describe a log.
+ */
+int flashfsLogIndexCount(void)
+{
+    return logIndexRecordCount > 0 ? logIndexRecordCount - 1 : 0;
+}
+
+/**
+ * Get a log from the index, returns false if its record is damaged or isn't a log.
+ */
+bool flashfsLogIndexGet(int index, flashfsLogEntry_t *entry)
+{
+    flashfsLogIndexRecord_t record;
+
+    if (index < 0 || index >= flashfsLogIndexCount()) {
+        return false;
+    }
+
+    if (!flashfsLogIndexReadSlot(index + 1, &record) || record.type != FLASHFS_LOG_INDEX_RECORD_LOG) {
+        return false;
+    }
+
+    entry->start = record.start;
+    entry->length = record.length;
+    entry->timestamp = record.timestamp;
+    entry->flags = record.flags;
+
+    return true;
+}
+
+/**
+ * Get the offset up to which the volume is described by the index, anything after it has to be scanned for.
+ */
+uint32_t flashfsLogIndexEnd(void)
+{
+    return logIndexEnd;
+}
+#endif // USE_FLASHFS_LOG_INDEX
+
 void flashfsClose(void)
 {
+#ifdef USE_FLASHFS_LOG_INDEX
+    // The index record has to cover everything written to the log
+    flashfsFlushSync();
+#endif
+
     switch(flashGeometry->flashType) {
     case FLASH_TYPE_NOR:
         break;
@@ -590,6 +1104,11 @@ void flashfsClose(void)
 
         break;
     }
+
+#ifdef USE_FLASHFS_LOG_INDEX
+    flashfsLogIndexAddLog(logStartAddress, tailAddress, flashfsIsEOF() ? FLASHFS_LOG_FLAG_FULL : 0);
+    logStartAddress = tailAddress;
+#endif
 }
 
 /**
@@ -598,6 +1117,7 @@ void flashfsClose(void)
 void flashfsInit(void)
 {
     flashfsSize = 0;
+    erasing = false;
 
     flashPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS);
     flashGeometry = flashGetGeometry();
@@ -608,8 +1128,15 @@ void flashfsInit(void)
 
     flashfsSize = FLASH_PARTITION_SECTOR_COUNT(flashPartition) * flashGeometry->sectorSize;
 
+#ifdef USE_FLASHFS_LOG_INDEX
+    flashfsLogIndexLoad();
+
+    // Start the file pointer off at the beginning of free space so caller can start writing immediately
+    flashfsSeekAbs(flashfsLogIndexRecover());
+#else
     // Start the file pointer off at the beginning of free space so caller can start writing immediately
     flashfsSeekAbs(flashfsIdentifyStartOfFreeSpace());
+#endif
 }
 
 #ifdef USE_FLASH_TOOLS
@@ -20,13 +20,29 @@
 
 #pragma once
 
+/*
+ * With a buffer of a few pages logging only programs whole pages, and the buffer rides out slow page programs. MCUs
+ * with RAM to spare get one by default, others keep a small buffer that is flushed as it fills.
+ */
+#ifndef FLASHFS_WRITE_BUFFER_SIZE
+#if defined(STM32F7) || defined(STM32H7) || defined(SIMULATOR_BUILD)
+#ifdef USE_FLASH_W25N01G
+#define FLASHFS_WRITE_BUFFER_SIZE 4096 // Two 2048 byte NAND pages
+#else
+#define FLASHFS_WRITE_BUFFER_SIZE 1024 // Four 256 byte NOR pages
+#endif
+#else
 #define FLASHFS_WRITE_BUFFER_SIZE 128
+#endif
+#endif
 #define FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)
 
-// Automatically trigger a flush when this much data is in the buffer
-#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64
+// Devices with pages larger than the buffer are flushed when this much data is in the buffer
+#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN (FLASHFS_WRITE_BUFFER_SIZE / 2)
 
 void flashfsEraseCompletely(void);
+void flashfsEraseAsync(void);
+void flashfsPoll(void);
 void flashfsEraseRange(uint32_t start, uint32_t end);
 
 uint32_t flashfsGetSize(void);
@@ -45,7 +61,7 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync);
 
 int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
 
-bool flashfsFlushAsync(void);
+bool flashfsFlushAsync(bool force);
 void flashfsFlushSync(void);
 
 void flashfsClose(void);
@@ -57,3 +73,19 @@ bool flashfsIsEOF(void);
 
 bool flashfsVerifyEntireFlash(void);
 
+#ifdef USE_FLASHFS_LOG_INDEX
+#define FLASHFS_LOG_FLAG_RECOVERED (1 << 0) // Log was not closed, found by scanning the volume at startup
+#define FLASHFS_LOG_FLAG_FULL      (1 << 1) // Log ran into the end of the volume
+
+typedef struct flashfsLogEntry_s {
+    uint32_t start;
+    uint32_t length;
+    uint32_t timestamp; // Seconds since 1970 when the log was closed, 0 if the time was not known
+    uint8_t flags;
+} flashfsLogEntry_t;
+
+int flashfsLogIndexCount(void);
+bool flashfsLogIndexGet(int index, flashfsLogEntry_t *entry);
+uint32_t flashfsLogIndexEnd(void);
+#endif
+
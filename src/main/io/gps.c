@@ -66,6 +66,7 @@
 #define LOG_UBLOX_SVINFO 'I'
 #define LOG_UBLOX_POSLLH 'P'
 #define LOG_UBLOX_VELNED 'V'
+#define LOG_UBLOX_PVT    'T'
 
 #define GPS_SV_MAXSATS   16
 
@@ -222,6 +223,14 @@ static const uint8_t ubloxGalileoInit[] = {
         0x06, 0x08, 0x0E, 0x00, 0x01, 0x00, 0x01, 0x01,     // GLONASS
         0x55, 0x47
 };
+
+// UBX-NAV-PVT mode (u-blox 7 and later): replace POSLLH/STATUS/SOL/VELNED with a single NAV-PVT message
+// and raise the navigation rate. The frames depend on the configured rate so they are built at runtime.
+#define UBLOX_CFG_MSG_LENGTH 11
+#define UBLOX_CFG_RATE_LENGTH 14
+#define UBLOX_NAV_PVT_CONFIG_LENGTH (5 * UBLOX_CFG_MSG_LENGTH + UBLOX_CFG_RATE_LENGTH)
+
+STATIC_UNIT_TESTED uint8_t ubloxNavPvtConfig[UBLOX_NAV_PVT_CONFIG_LENGTH];
 #endif // USE_GPS_UBLOX
 
 typedef enum {
@@ -237,7 +246,7 @@ typedef enum {
 gpsData_t gpsData;
 
 
-PG_REGISTER_WITH_RESET_TEMPLATE(gpsConfig_t, gpsConfig, PG_GPS_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(gpsConfig_t, gpsConfig, PG_GPS_CONFIG, 1);
 
 PG_RESET_TEMPLATE(gpsConfig_t, gpsConfig,
     .provider = GPS_NMEA,
@@ -245,7 +254,9 @@ PG_RESET_TEMPLATE(gpsConfig_t, gpsConfig,
     .autoConfig = GPS_AUTOCONFIG_ON,
     .autoBaud = GPS_AUTOBAUD_OFF,
     .gps_ublox_use_galileo = false,
-    .gps_set_home_point_once = false
+    .gps_set_home_point_once = false,
+    .gps_ublox_nav_pvt = false,
+    .gps_ublox_rate_hz = 10,
 );
 
 static void shiftPacketLog(void)
@@ -263,6 +274,7 @@ static bool gpsNewFrameNMEA(char c);
 #endif
 #ifdef USE_GPS_UBLOX
 static bool gpsNewFrameUBLOX(uint8_t data);
+STATIC_UNIT_TESTED void ubloxBuildNavPvtConfig(void);
 #endif
 
 static void gpsSetState(gpsState_e state)
@@ -455,6 +467,19 @@ void gpsInitUblox(void)
                 if ((gpsConfig()->gps_ublox_use_galileo) && (gpsData.state_position < sizeof(ubloxGalileoInit))) {
                     serialWrite(gpsPort, ubloxGalileoInit[gpsData.state_position]);
                     gpsData.state_position++;
+                } else {
+                    gpsData.state_position = 0;
+                    gpsData.messageState++;
+                    if (gpsConfig()->gps_ublox_nav_pvt) {
+                        ubloxBuildNavPvtConfig();
+                    }
+                }
+            }
+
+            if (gpsData.messageState == GPS_MESSAGE_STATE_NAV_PVT) {
+                if ((gpsConfig()->gps_ublox_nav_pvt) && (gpsData.state_position < sizeof(ubloxNavPvtConfig))) {
+                    serialWrite(gpsPort, ubloxNavPvtConfig[gpsData.state_position]);
+                    gpsData.state_position++;
                 } else {
                     gpsData.state_position = 0;
                     gpsData.messageState++;
@@ -983,6 +1008,41 @@ typedef struct {
     ubx_nav_svinfo_channel channel[16];         // 16 satellites * 12 byte
 } ubx_nav_svinfo;
 
+typedef struct {
+    uint32_t time;              // GPS msToW
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t min;
+    uint8_t sec;
+    uint8_t valid;              // ubx_nav_pvt_valid_bits
+    uint32_t time_accuracy;
+    int32_t time_nsec;
+    uint8_t fix_type;
+    uint8_t fix_status;
+    uint8_t flags2;
+    uint8_t satellites;
+    int32_t longitude;
+    int32_t latitude;
+    int32_t altitude_ellipsoid;
+    int32_t altitudeMslMm;
+    uint32_t horizontal_accuracy;
+    uint32_t vertical_accuracy;
+    int32_t ned_north;          // mm/s
+    int32_t ned_east;
+    int32_t ned_down;
+    int32_t speed_2d;           // mm/s
+    int32_t heading_2d;         // deg * 100000
+    uint32_t speed_accuracy;
+    uint32_t heading_accuracy;
+    uint16_t position_DOP;
+    uint8_t reserved1[6];
+    int32_t heading_vehicle;
+    int16_t magnetic_declination;
+    uint16_t magnetic_declination_accuracy;
+} ubx_nav_pvt;
+
 enum {
     PREAMBLE1 = 0xb5,
     PREAMBLE2 = 0x62,
@@ -994,6 +1054,7 @@ enum {
     MSG_POSLLH = 0x2,
     MSG_STATUS = 0x3,
     MSG_SOL = 0x6,
+    MSG_PVT = 0x7,
     MSG_VELNED = 0x12,
     MSG_SVINFO = 0x30,
     MSG_CFG_PRT = 0x00,
@@ -1017,6 +1078,11 @@ enum {
     NAV_STATUS_TIME_SECOND_VALID = 8
 } ubx_nav_status_bits;
 
+enum {
+    NAV_PVT_VALID_DATE = 1,
+    NAV_PVT_VALID_TIME = 2
+} ubx_nav_pvt_valid_bits;
+
 // Packet checksum accumulators
 static uint8_t _ck_a;
 static uint8_t _ck_b;
@@ -1061,6 +1127,7 @@ static union {
     ubx_nav_solution solution;
     ubx_nav_velned velned;
     ubx_nav_svinfo svinfo;
+    ubx_nav_pvt pvt;
     uint8_t bytes[UBLOX_PAYLOAD_SIZE];
 } _buffer;
 
@@ -1073,6 +1140,52 @@ void _update_checksum(uint8_t *data, uint8_t len, uint8_t *ck_a, uint8_t *ck_b)
     }
 }
 
+static uint8_t *ubloxAppendMessage(uint8_t *dst, uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint8_t length)
+{
+    uint8_t *frame = dst;
+
+    *dst++ = PREAMBLE1;
+    *dst++ = PREAMBLE2;
+    *dst++ = msgClass;
+    *dst++ = msgId;
+    *dst++ = length;
+    *dst++ = 0;
+    memcpy(dst, payload, length);
+    dst += length;
+
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+    _update_checksum(frame + 2, length + 4, &ck_a, &ck_b);
+    *dst++ = ck_a;
+    *dst++ = ck_b;
+
+    return dst;
+}
+
+static uint8_t *ubloxAppendSetMessageRate(uint8_t *dst, uint8_t msgId, uint8_t rate)
+{
+    const uint8_t payload[] = { CLASS_NAV, msgId, rate };
+
+    return ubloxAppendMessage(dst, CLASS_CFG, MSG_CFG_SET_RATE, payload, sizeof(payload));
+}
+
+STATIC_UNIT_TESTED void ubloxBuildNavPvtConfig(void)
+{
+    const uint16_t measurementPeriodMs = 1000 / constrain(gpsConfig()->gps_ublox_rate_hz, GPS_UBLOX_RATE_HZ_MIN, GPS_UBLOX_RATE_HZ_MAX);
+    const uint8_t ratePayload[] = {
+        measurementPeriodMs & 0xFF, measurementPeriodMs >> 8,
+        0x01, 0x00,                 // navigation rate: 1 measurement cycle
+        0x01, 0x00                  // time reference: GPS time
+    };
+
+    uint8_t *dst = ubloxNavPvtConfig;
+    dst = ubloxAppendSetMessageRate(dst, MSG_POSLLH, 0);
+    dst = ubloxAppendSetMessageRate(dst, MSG_STATUS, 0);
+    dst = ubloxAppendSetMessageRate(dst, MSG_SOL, 0);
+    dst = ubloxAppendSetMessageRate(dst, MSG_VELNED, 0);
+    dst = ubloxAppendSetMessageRate(dst, MSG_PVT, 1);
+    ubloxAppendMessage(dst, CLASS_CFG, MSG_CFG_RATE, ratePayload, sizeof(ratePayload));
+}
 
 static bool UBLOX_parse_gps(void)
 {
@@ -1116,6 +1229,39 @@ static bool UBLOX_parse_gps(void)
         }
 #endif
         break;
+    case MSG_PVT:
+        // a complete navigation solution in one message, no need to wait for the others
+        *gpsPacketLogChar = LOG_UBLOX_PVT;
+        next_fix = (_buffer.pvt.fix_status & NAV_STATUS_FIX_VALID) && (_buffer.pvt.fix_type == FIX_3D);
+        if (next_fix) {
+            ENABLE_STATE(GPS_FIX);
+        } else {
+            DISABLE_STATE(GPS_FIX);
+        }
+        gpsSol.llh.lon = _buffer.pvt.longitude;
+        gpsSol.llh.lat = _buffer.pvt.latitude;
+        gpsSol.llh.altCm = _buffer.pvt.altitudeMslMm / 10;  //alt in cm
+        gpsSol.numSat = _buffer.pvt.satellites;
+        gpsSol.hdop = _buffer.pvt.position_DOP;
+        gpsSol.groundSpeed = _buffer.pvt.speed_2d / 10;    // mm/s to cm/s
+        gpsSol.groundCourse = (uint16_t) (_buffer.pvt.heading_2d / 10000);     // Heading 2D deg * 100000 rescaled to deg * 10
+#ifdef USE_RTC_TIME
+        //set clock, when gps time is available
+        if (!rtcHasTime() && (_buffer.pvt.valid & NAV_PVT_VALID_DATE) && (_buffer.pvt.valid & NAV_PVT_VALID_TIME)) {
+            dateTime_t dt;
+            dt.year = _buffer.pvt.year;
+            dt.month = _buffer.pvt.month;
+            dt.day = _buffer.pvt.day;
+            dt.hours = _buffer.pvt.hour;
+            dt.minutes = _buffer.pvt.min;
+            dt.seconds = _buffer.pvt.sec;
+            dt.millis = (_buffer.pvt.time_nsec > 0) ? _buffer.pvt.time_nsec / 1000000 : 0;
+            rtcSetDateTime(&dt);
+        }
+#endif
+        _new_position = true;
+        _new_speed = true;
+        break;
     case MSG_VELNED:
         *gpsPacketLogChar = LOG_UBLOX_VELNED;
         // speed_3d                        = _buffer.velned.speed_3d;  // cm/s
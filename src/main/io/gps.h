@@ -68,6 +68,9 @@ typedef enum {
 
 #define GPS_BAUDRATE_MAX GPS_BAUDRATE_9600
 
+#define GPS_UBLOX_RATE_HZ_MIN 1
+#define GPS_UBLOX_RATE_HZ_MAX 25
+
 typedef struct gpsConfig_s {
     gpsProvider_e provider;
     sbasMode_e sbasMode;
@@ -75,6 +78,8 @@ typedef struct gpsConfig_s {
     gpsAutoBaud_e autoBaud;
     uint8_t gps_ublox_use_galileo;
     uint8_t gps_set_home_point_once;
+    uint8_t gps_ublox_nav_pvt;      // use the single UBX-NAV-PVT message instead of POSLLH/STATUS/SOL/VELNED
+    uint8_t gps_ublox_rate_hz;      // navigation solution rate when gps_ublox_nav_pvt is on
 } gpsConfig_t;
 
 PG_DECLARE(gpsConfig_t, gpsConfig);
@@ -104,6 +109,7 @@ typedef enum {
     GPS_MESSAGE_STATE_INIT,
     GPS_MESSAGE_STATE_SBAS,
     GPS_MESSAGE_STATE_GALILEO,
+    GPS_MESSAGE_STATE_NAV_PVT,
     GPS_MESSAGE_STATE_ENTRY_COUNT
 } gpsMessageState_e;
 
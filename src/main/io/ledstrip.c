@@ -449,6 +449,23 @@ static hsvColor_t* getDirectionalModeColor(const int ledIndex, const modeColorIn
     return NULL;
 }
 
+// The layers are composited here, then only the LEDs which changed are written to the strip
+static hsvColor_t ledCompositeBuffer[LED_MAX_STRIP_LENGTH];
+// The LEDs being composited in this update
+static uint32_t compositeLedMask;
+
+static bool isLedComposited(int ledIndex)
+{
+    return compositeLedMask & (1U << ledIndex);
+}
+
+static void setCompositeHsv(int ledIndex, const hsvColor_t *color)
+{
+    if (isLedComposited(ledIndex)) {
+        ledCompositeBuffer[ledIndex] = *color;
+    }
+}
+
 // map flight mode to led mode, in order of priority
 // flightMode == 0 is always active
 static const struct {
@@ -464,9 +481,17 @@ static const struct {
     {0,             LED_MODE_ORIENTATION},
 };
 
-static void applyLedFixedLayers(void)
+static void applyLedFixedLayers(bool updateNow, timeUs_t *timer)
 {
+    if (updateNow) {
+        *timer += HZ_TO_US(10);
+    }
+
     for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
+        if (!isLedComposited(ledIndex)) {
+            continue;
+        }
+
         const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[ledIndex];
         hsvColor_t color = *getSC(LED_SCOLOR_BACKGROUND);
 
@@ -532,7 +557,7 @@ static void applyLedFixedLayers(void)
         }
 
         color.h = (color.h + hOffset) % (HSV_HUE_MAX + 1);
-        setLedHsv(ledIndex, &color);
+        setCompositeHsv(ledIndex, &color);
     }
 }
 
@@ -541,7 +566,7 @@ static void applyLedHsv(uint32_t mask, const hsvColor_t *color)
     for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
         const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[ledIndex];
         if ((*ledConfig & mask) == mask)
-            setLedHsv(ledIndex, color);
+            setCompositeHsv(ledIndex, color);
     }
 }
 
@@ -675,7 +700,7 @@ static void applyLedVtxLayer(bool updateNow, timeUs_t *timer)
                     color.s = HSV(BLACK).s;
                     color.v = HSV(BLACK).v;
                 }
-                setLedHsv(i, &color);
+                setCompositeHsv(i, &color);
                 ++vtxLedCount;
             }
         }
@@ -732,9 +757,9 @@ static void applyLedBatteryLayer(bool updateNow, timeUs_t *timer)
 
                 break;
         }
-    }
 
-    *timer += timerDelayUs;
+        *timer += timerDelayUs;
+    }
 
     if (!flash) {
        const hsvColor_t *bgc = getSC(LED_SCOLOR_BACKGROUND);
@@ -761,9 +786,9 @@ static void applyLedRssiLayer(bool updateNow, timeUs_t *timer)
             flash = !flash;
             timerDelay = HZ_TO_US(8);
         }
-    }
 
-    *timer += timerDelay;
+        *timer += timerDelay;
+    }
 
     if (!flash) {
         const hsvColor_t *bgc = getSC(LED_SCOLOR_BACKGROUND);
@@ -849,7 +874,7 @@ static void applyLedIndicatorLayer(bool updateNow, timeUs_t *timer)
         const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[ledIndex];
         if (ledGetOverlayBit(ledConfig, LED_OVERLAY_INDICATOR)) {
             if (getLedQuadrant(ledIndex) & quadrants)
-                setLedHsv(ledIndex, flashColor);
+                setCompositeHsv(ledIndex, flashColor);
         }
     }
 }
@@ -879,7 +904,7 @@ static void applyLedThrustRingLayer(bool updateNow, timeUs_t *timer)
 
             if (applyColor) {
                 const hsvColor_t *ringColor = &ledStripStatusModeConfig()->colors[ledGetColor(ledConfig)];
-                setLedHsv(ledIndex, ringColor);
+                setCompositeHsv(ledIndex, ringColor);
             }
 
             ledRingIndex++;
@@ -940,10 +965,9 @@ static void applyLarsonScannerLayer(bool updateNow, timeUs_t *timer)
         const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[i];
 
         if (ledGetOverlayBit(ledConfig, LED_OVERLAY_LARSON_SCANNER)) {
-            hsvColor_t ledColor;
-            getLedHsv(i, &ledColor);
+            hsvColor_t ledColor = ledCompositeBuffer[i];
             ledColor.v = brightnessForLarsonIndex(&larsonParameters, scannerLedIndex);
-            setLedHsv(i, &ledColor);
+            setCompositeHsv(i, &ledColor);
             scannerLedIndex++;
         }
     }
@@ -969,7 +993,7 @@ static void applyLedBlinkLayer(bool updateNow, timeUs_t *timer)
             const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[i];
 
             if (ledGetOverlayBit(ledConfig, LED_OVERLAY_BLINK)) {
-                setLedHsv(i, getSC(LED_SCOLOR_BLINKBACKGROUND));
+                setCompositeHsv(i, getSC(LED_SCOLOR_BLINKBACKGROUND));
             }
         }
     }
@@ -977,6 +1001,7 @@ static void applyLedBlinkLayer(bool updateNow, timeUs_t *timer)
 
 // In reverse order of priority
 typedef enum {
+    timFixed,
     timBlink,
     timLarson,
     timRing,
@@ -995,8 +1020,29 @@ typedef enum {
 
 static timeUs_t timerVal[timTimerCount];
 static uint16_t disabledTimerMask;
+// The LEDs each layer draws on
+static uint32_t layerLedMask[timTimerCount];
 
 STATIC_ASSERT(timTimerCount <= sizeof(disabledTimerMask) * 8, disabledTimerMask_too_small);
+STATIC_ASSERT(LED_MAX_STRIP_LENGTH <= sizeof(layerLedMask[0]) * 8, layerLedMask_too_small);
+
+// The configuration bits selecting the LEDs of each layer, the fixed layers draw on every LED
+static const ledConfig_t layerConfigMask[timTimerCount] = {
+    [timFixed] = 0,
+    [timBlink] = LED_MOV_OVERLAY(LED_FLAG_OVERLAY(LED_OVERLAY_BLINK)),
+    [timLarson] = LED_MOV_OVERLAY(LED_FLAG_OVERLAY(LED_OVERLAY_LARSON_SCANNER)),
+    [timRing] = LED_MOV_FUNCTION(LED_FUNCTION_THRUST_RING),
+    [timIndicator] = LED_MOV_OVERLAY(LED_FLAG_OVERLAY(LED_OVERLAY_INDICATOR)),
+#ifdef USE_VTX_COMMON
+    [timVtx] = LED_MOV_OVERLAY(LED_FLAG_OVERLAY(LED_OVERLAY_VTX)),
+#endif
+#ifdef USE_GPS
+    [timGps] = LED_MOV_FUNCTION(LED_FUNCTION_GPS),
+#endif
+    [timBattery] = LED_MOV_FUNCTION(LED_FUNCTION_BATTERY),
+    [timRssi] = LED_MOV_FUNCTION(LED_FUNCTION_RSSI),
+    [timWarning] = LED_MOV_OVERLAY(LED_FLAG_OVERLAY(LED_OVERLAY_WARNING)),
+};
 
 // function to apply layer.
 // function must replan self using timer pointer
@@ -1006,6 +1052,7 @@ STATIC_ASSERT(timTimerCount <= sizeof(disabledTimerMask) * 8, disabledTimerMask_
 typedef void applyLayerFn_timed(bool updateNow, timeUs_t *timer);
 
 static applyLayerFn_timed* layerTable[] = {
+    [timFixed] = &applyLedFixedLayers,
     [timBlink] = &applyLedBlinkLayer,
     [timLarson] = &applyLarsonScannerLayer,
     [timBattery] = &applyLedBatteryLayer,
@@ -1035,13 +1082,41 @@ bool isOverlayTypeUsed(ledOverlayId_e overlayType)
 void updateRequiredOverlay(void)
 {
     disabledTimerMask = 0;
-    disabledTimerMask |= !isOverlayTypeUsed(LED_OVERLAY_BLINK) << timBlink;
-    disabledTimerMask |= !isOverlayTypeUsed(LED_OVERLAY_LARSON_SCANNER) << timLarson;
-    disabledTimerMask |= !isOverlayTypeUsed(LED_OVERLAY_WARNING) << timWarning;
-#ifdef USE_VTX_COMMON
-    disabledTimerMask |= !isOverlayTypeUsed(LED_OVERLAY_VTX) << timVtx;
-#endif
-    disabledTimerMask |= !isOverlayTypeUsed(LED_OVERLAY_INDICATOR) << timIndicator;
+    for (timId_e timId = 0; timId < timTimerCount; timId++) {
+        layerLedMask[timId] = 0;
+        for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
+            const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[ledIndex];
+            if ((*ledConfig & layerConfigMask[timId]) == layerConfigMask[timId]) {
+                layerLedMask[timId] |= 1U << ledIndex;
+            }
+        }
+
+        // layers without LEDs are not run
+        if (!layerLedMask[timId]) {
+            disabledTimerMask |= 1 << timId;
+        }
+    }
+}
+
+// Write the composited LEDs which differ from the strip, returns true if any did
+static bool commitCompositeLeds(void)
+{
+    bool changed = false;
+
+    for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
+        if (!isLedComposited(ledIndex)) {
+            continue;
+        }
+
+        hsvColor_t stripColor;
+        getLedHsv(ledIndex, &stripColor);
+        if (memcmp(&stripColor, &ledCompositeBuffer[ledIndex], sizeof(hsvColor_t)) != 0) {
+            setLedHsv(ledIndex, &ledCompositeBuffer[ledIndex]);
+            changed = true;
+        }
+    }
+
+    return changed;
 }
 
 static void applyStatusProfile(timeUs_t now) {
@@ -1049,6 +1124,7 @@ static void applyStatusProfile(timeUs_t now) {
     // apply all layers; triggered timed functions has to update timers
     // test all led timers, setting corresponding bits
     uint32_t timActive = 0;
+    compositeLedMask = 0;
     for (timId_e timId = 0; timId < timTimerCount; timId++) {
         if (!(disabledTimerMask & (1 << timId))) {
             // sanitize timer value, so that it can be safely incremented. Handles inital timerVal value.
@@ -1057,6 +1133,8 @@ static void applyStatusProfile(timeUs_t now) {
             if (delta < 0 && delta > -MAX_TIMER_DELAY)
                 continue;  // not ready yet
             timActive |= 1 << timId;
+            // the LEDs of a layer that updated are composited again from the fixed layers up
+            compositeLedMask |= layerLedMask[timId];
             if (delta >= 100 * 1000 || delta < 0) {
                 timerVal[timId] = now;
             }
@@ -1066,13 +1144,19 @@ static void applyStatusProfile(timeUs_t now) {
     if (!timActive)
         return;          // no change this update, keep old state
 
-    applyLedFixedLayers();
     for (timId_e timId = 0; timId < ARRAYLEN(layerTable); timId++) {
+        if (!(layerLedMask[timId] & compositeLedMask)) {
+            continue;   // none of the LEDs of this layer are being composited
+        }
         uint32_t *timer = &timerVal[timId];
         bool updateNow = timActive & (1 << timId);
         (*layerTable[timId])(updateNow, timer);
     }
-    ws2811UpdateStrip((ledStripFormatRGB_e) ledStripConfig()->ledstrip_grb_rgb);
+
+    // no DMA transfer when nothing changed
+    if (commitCompositeLeds()) {
+        ws2811UpdateStrip((ledStripFormatRGB_e) ledStripConfig()->ledstrip_grb_rgb);
+    }
 }
 
 bool parseColor(int index, const char *colorConfig)
@@ -28,6 +28,7 @@
 
 #include "cli/cli.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "drivers/time.h"
@@ -323,6 +324,168 @@ bool doesConfigurationUsePort(serialPortIdentifier_e identifier)
     return candidate != NULL && candidate->functionMask;
 }
 
+#ifdef USE_SERIAL_BUFFER_POOL
+#define SERIAL_BUFFER_MIN_SIZE 32
+
+// Ports opened without a configured function, e.g. for serial passthrough
+#define SERIAL_BUFFER_DEFAULT_RX_SIZE 128
+#define SERIAL_BUFFER_DEFAULT_TX_SIZE 256
+
+STATIC_ASSERT(SERIAL_BUFFER_POOL_SIZE >= SERIAL_PORT_COUNT * 2 * SERIAL_BUFFER_MIN_SIZE, serial_buffer_pool_too_small);
+
+typedef struct serialBufferRequirement_s {
+    uint16_t function;
+    uint16_t rxBufferSize;
+    uint16_t txBufferSize;
+} serialBufferRequirement_t;
+
+// Sizes must be powers of two, and no smaller than SERIAL_BUFFER_MIN_SIZE
+static const serialBufferRequirement_t serialBufferRequirements[] = {
+    { FUNCTION_MSP,                 256, 512 },  // MSP displayport and large replies
+    { FUNCTION_GPS,                 256, 64 },   // UBLOX SVINFO packets
+    { FUNCTION_TELEMETRY_FRSKY_HUB, 32,  128 },
+    { FUNCTION_TELEMETRY_HOTT,      64,  64 },
+    { FUNCTION_TELEMETRY_LTM,       32,  128 },
+    { FUNCTION_TELEMETRY_SMARTPORT, 64,  64 },
+    { FUNCTION_RX_SERIAL,           128, 128 },  // CRSF and FPort send telemetry frames back
+    { FUNCTION_BLACKBOX,            32,  1024 },
+    { FUNCTION_TELEMETRY_MAVLINK,   64,  256 },
+    { FUNCTION_ESC_SENSOR,          64,  32 },
+    { FUNCTION_VTX_SMARTAUDIO,      32,  32 },
+    { FUNCTION_TELEMETRY_IBUS,      64,  64 },
+    { FUNCTION_VTX_TRAMP,           32,  32 },
+    { FUNCTION_RCDEVICE,            64,  64 },
+    { FUNCTION_LIDAR_TF,            64,  32 },
+};
+
+static DMA_RAM volatile uint8_t serialBufferPool[SERIAL_BUFFER_POOL_SIZE] __attribute__((aligned(4)));
+static uint16_t serialBufferPoolUsed;
+// Pooled ports without planned buffers, the pool keeps two minimum size buffers for each of them
+static uint8_t serialBufferUnplannedPorts;
+
+static bool serialIsBufferPooled(serialPortIdentifier_e identifier)
+{
+    return identifier >= SERIAL_PORT_USART1 && identifier <= SERIAL_PORT_USART8;
+}
+
+static volatile uint8_t *serialBufferAllocate(uint16_t size)
+{
+    if (size > SERIAL_BUFFER_POOL_SIZE - serialBufferPoolUsed) {
+        return NULL;
+    }
+    volatile uint8_t *buffer = &serialBufferPool[serialBufferPoolUsed];
+    serialBufferPoolUsed += size;
+    return buffer;
+}
+
+static void serialBuffersAllocate(serialPortBuffers_t *buffers)
+{
+    buffers->rxBuffer = serialBufferAllocate(buffers->rxBufferSize);
+    buffers->txBuffer = serialBufferAllocate(buffers->txBufferSize);
+}
+
+STATIC_UNIT_TESTED void serialBufferRequirement(uint16_t functionMask, uint16_t *rxBufferSize, uint16_t *txBufferSize)
+{
+    *rxBufferSize = 0;
+    *txBufferSize = 0;
+    for (unsigned i = 0; i < ARRAYLEN(serialBufferRequirements); i++) {
+        if (functionMask & serialBufferRequirements[i].function) {
+            *rxBufferSize = MAX(*rxBufferSize, serialBufferRequirements[i].rxBufferSize);
+            *txBufferSize = MAX(*txBufferSize, serialBufferRequirements[i].txBufferSize);
+        }
+    }
+}
+
+/*
+ * Sizes the buffers of every UART with a function configured, halving the largest buffer until they all fit in
+ * the pool, and allocates them. What is left of the pool is handed out to ports opened without a function, and
+ * always holds the minimum buffers for each of them.
+ */
+static void serialBuffersPlan(void)
+{
+    serialBufferPoolUsed = 0;
+    serialBufferUnplannedPorts = 0;
+
+    uint32_t total = 0;
+    for (int index = 0; index < SERIAL_PORT_COUNT; index++) {
+        serialPortUsage_t *usage = &serialPortUsageList[index];
+        if (!serialIsBufferPooled(usage->identifier)) {
+            continue;
+        }
+
+        const serialPortConfig_t *portConfig = serialFindPortConfiguration(usage->identifier);
+        serialPortBuffers_t *buffers = &usage->buffers;
+        serialBufferRequirement(portConfig ? portConfig->functionMask : FUNCTION_NONE, &buffers->rxBufferWanted, &buffers->txBufferWanted);
+        if (!buffers->rxBufferWanted) {
+            serialBufferUnplannedPorts++;
+            continue;
+        }
+        buffers->rxBufferSize = buffers->rxBufferWanted;
+        buffers->txBufferSize = buffers->txBufferWanted;
+        total += buffers->rxBufferSize + buffers->txBufferSize;
+    }
+
+    /*
+     * The pool holds two minimum size buffers for every port, so the budget holds them for every planned port. While
+     * the total is over budget some buffer is therefore larger than the minimum, and halving the largest one always
+     * gets the plan to fit.
+     */
+    const uint32_t budget = SERIAL_BUFFER_POOL_SIZE - serialBufferUnplannedPorts * 2 * SERIAL_BUFFER_MIN_SIZE;
+    while (total > budget) {
+        uint16_t *largest = NULL;
+        for (int index = 0; index < SERIAL_PORT_COUNT; index++) {
+            serialPortBuffers_t *buffers = &serialPortUsageList[index].buffers;
+            if (!largest || buffers->rxBufferSize > *largest) {
+                largest = &buffers->rxBufferSize;
+            }
+            if (buffers->txBufferSize > *largest) {
+                largest = &buffers->txBufferSize;
+            }
+        }
+        *largest /= 2;
+        total -= *largest;
+    }
+
+    for (int index = 0; index < SERIAL_PORT_COUNT; index++) {
+        serialPortBuffers_t *buffers = &serialPortUsageList[index].buffers;
+        if (buffers->rxBufferSize) {
+            serialBuffersAllocate(buffers);
+        }
+    }
+}
+
+static bool serialBuffersAssign(serialPortUsage_t *usage)
+{
+    serialPortBuffers_t *buffers = &usage->buffers;
+
+    if (!buffers->rxBuffer) {
+        // no function configured, take what the pool has left less the minimum for the other unplanned ports
+        const uint16_t poolFree = SERIAL_BUFFER_POOL_SIZE - serialBufferPoolUsed - (serialBufferUnplannedPorts - 1) * 2 * SERIAL_BUFFER_MIN_SIZE;
+        buffers->rxBufferWanted = SERIAL_BUFFER_DEFAULT_RX_SIZE;
+        buffers->txBufferWanted = SERIAL_BUFFER_DEFAULT_TX_SIZE;
+        buffers->rxBufferSize = buffers->rxBufferWanted;
+        buffers->txBufferSize = buffers->txBufferWanted;
+        // poolFree is at least two minimum size buffers, so this stops before either buffer gets smaller
+        while (buffers->rxBufferSize + buffers->txBufferSize > poolFree) {
+            if (buffers->txBufferSize >= buffers->rxBufferSize) {
+                buffers->txBufferSize /= 2;
+            } else {
+                buffers->rxBufferSize /= 2;
+            }
+        }
+        serialBuffersAllocate(buffers);
+        serialBufferUnplannedPorts--;
+    }
+
+    return uartSetBuffers(SERIAL_PORT_IDENTIFIER_TO_UARTDEV(usage->identifier), buffers->rxBuffer, buffers->rxBufferSize, buffers->txBuffer, buffers->txBufferSize);
+}
+
+uint16_t serialGetBufferPoolUsed(void)
+{
+    return serialBufferPoolUsed;
+}
+#endif // USE_SERIAL_BUFFER_POOL
+
 serialPort_t *openSerialPort(
     serialPortIdentifier_e identifier,
     serialPortFunction_e function,
@@ -384,7 +547,9 @@ serialPort_t *openSerialPort(
             // emulate serial ports over TCP
             serialPort = serTcpOpen(SERIAL_PORT_IDENTIFIER_TO_UARTDEV(identifier), rxCallback, rxCallbackData, baudRate, mode, options);
 #else
-            serialPort = uartOpen(SERIAL_PORT_IDENTIFIER_TO_UARTDEV(identifier), rxCallback, rxCallbackData, baudRate, mode, options);
+            if (serialBuffersAssign(serialPortUsage)) {
+                serialPort = uartOpen(SERIAL_PORT_IDENTIFIER_TO_UARTDEV(identifier), rxCallback, rxCallbackData, baudRate, mode, options);
+            }
 #endif
             break;
 #endif
@@ -474,6 +639,10 @@ void serialInit(bool softserialEnabled, serialPortIdentifier_e serialPortToDisab
             serialPortCount--;
         }
     }
+
+#ifdef USE_SERIAL_BUFFER_POOL
+    serialBuffersPlan();
+#endif
 }
 
 void serialRemovePort(serialPortIdentifier_e identifier)
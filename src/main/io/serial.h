@@ -100,10 +100,22 @@ extern const serialPortIdentifier_e serialPortIdentifiers[SERIAL_PORT_COUNT];
 //
 // runtime
 //
+typedef struct serialPortBuffers_s {
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint16_t rxBufferSize;
+    uint16_t txBufferSize;
+    uint16_t rxBufferWanted;    // what the port's functions need, before fitting into the pool
+    uint16_t txBufferWanted;
+} serialPortBuffers_t;
+
 typedef struct serialPortUsage_s {
     serialPort_t *serialPort;
     serialPortFunction_e function;
     serialPortIdentifier_e identifier;
+#ifdef USE_SERIAL_BUFFER_POOL
+    serialPortBuffers_t buffers;
+#endif
 } serialPortUsage_t;
 
 serialPort_t *findSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction);
@@ -149,6 +161,9 @@ bool isSerialPortShared(const serialPortConfig_t *portConfig, uint16_t functionM
 void pgResetFn_serialConfig(serialConfig_t *serialConfig); //!!TODO remove need for this
 serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
 int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+#ifdef USE_SERIAL_BUFFER_POOL
+uint16_t serialGetBufferPoolUsed(void);
+#endif
 //
 // runtime
 //
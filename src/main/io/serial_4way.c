@@ -30,6 +30,9 @@
 
 #ifdef  USE_SERIAL_4WAY_BLHELI_INTERFACE
 
+#include "common/crc.h"
+#include "common/maths.h"
+
 #include "drivers/buf_writer.h"
 #include "drivers/io.h"
 #include "drivers/serial.h"
@@ -78,7 +81,7 @@
 #define SERIAL_4WAY_VER_SUB_1 (uint8_t) 0
 #define SERIAL_4WAY_VER_SUB_2 (uint8_t) 03
 
-#define SERIAL_4WAY_PROTOCOL_VER 107
+#define SERIAL_4WAY_PROTOCOL_VER 108
 // *** end
 
 #if (SERIAL_4WAY_VER_MAIN > 24)
@@ -90,6 +93,11 @@
 #define SERIAL_4WAY_VERSION_HI (uint8_t) (SERIAL_4WAY_VERSION / 100)
 #define SERIAL_4WAY_VERSION_LO (uint8_t) (SERIAL_4WAY_VERSION % 100)
 
+// large enough for a flash page of the ARM ESCs, and two of the SiLabs ones
+#ifndef SERIAL_4WAY_PAGE_BUFFER_SIZE
+#define SERIAL_4WAY_PAGE_BUFFER_SIZE 1024
+#endif
+
 static uint8_t escCount;
 
 escHardware_t escHardware[MAX_SUPPORTED_MOTORS];
@@ -265,6 +273,22 @@ void esc4wayRelease(void)
 //PARAM: uint8_t ADRESS_Hi + ADRESS_Lo + BUffLen + Buffer[0..255]
 //RETURN: ACK
 
+// Write to the page buffer of the interface, no Device access
+// ADRESS = offset in the page buffer
+#define cmd_DeviceBufferWrite 0x41   //'A' write
+//PARAM: uint8_t ADRESS_Hi + ADRESS_Lo + BUffLen + Buffer[0..255]
+//RETURN: ACK or ACK_I_INVALID_PARAM
+
+// Flash the page buffer to each ESC of the mask in turn, without further round trips to the host
+// ADRESS = Device flash address, the page is erased first if asked to
+// The last ESC of the mask is left connected
+#define cmd_DeviceBufferFlash 0x42   //'B' write
+//PARAM: uint8_t EscMask_Hi + EscMask_Lo + Len_Hi + Len_Lo + Flags
+//RETURN: uint8_t FailedMask_Hi + FailedMask_Lo + ACK
+
+#define BUFFER_FLASH_ERASE  0x01
+#define BUFFER_FLASH_VERIFY 0x02
+
 
 // responses
 #define ACK_OK                  0x00
@@ -280,53 +304,6 @@ void esc4wayRelease(void)
 #define ACK_I_INVALID_PARAM     0x09
 #define ACK_D_GENERAL_ERROR     0x0F
 
-/* Copyright (c) 2002, 2003, 2004  Marek Michalkiewicz
-   Copyright (c) 2005, 2007 Joerg Wunsch
-   Copyright (c) 2013 Dave Hylands
-   Copyright (c) 2013 Frederic Nadeau
-   All rights reserved.
-
-   Redistribution and use in source and binary forms, with or without
-   modification, are permitted provided that the following conditions are met:
-
-   * Redistributions of source code must retain the above copyright
-     notice, this list of conditions and the following disclaimer.
-
-   * Redistributions in binary form must reproduce the above copyright
-     notice, this list of conditions and the following disclaimer in
-     the documentation and/or other materials provided with the
-     distribution.
-
-   * Neither the name of the copyright holders nor the names of
-     contributors may be used to endorse or promote products derived
-     from this software without specific prior written permission.
-
-  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
-  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
-  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
-  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
-  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
-  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
-  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-  POSSIBILITY OF SUCH DAMAGE. */
-uint16_t _crc_xmodem_update (uint16_t crc, uint8_t data) {
-        int i;
-
-        crc = crc ^ ((uint16_t)data << 8);
-        for (i=0; i < 8; i++) {
-            if (crc & 0x8000)
-                crc = (crc << 1) ^ 0x1021;
-            else
-                crc <<= 1;
-        }
-        return crc;
-}
-// * End copyright
-
-
 #define ATMEL_DEVICE_MATCH ((pDeviceInfo->words[0] == 0x9307) || (pDeviceInfo->words[0] == 0x930A) || \
         (pDeviceInfo->words[0] == 0x930F) || (pDeviceInfo->words[0] == 0x940B))
 
@@ -398,7 +375,7 @@ static uint8_16_u CRC_in;
 static uint8_t ReadByteCrc(void)
 {
     uint8_t b = ReadByte();
-    CRC_in.word = _crc_xmodem_update(CRC_in.word, b);
+    CRC_in.word = crc16_ccitt_update(CRC_in.word, &b, 1);
     return b;
 }
 
@@ -411,9 +388,80 @@ static uint8_16_u CRCout;
 static void WriteByteCrc(uint8_t b)
 {
     WriteByte(b);
-    CRCout.word = _crc_xmodem_update(CRCout.word, b);
+    CRCout.word = crc16_ccitt_update(CRCout.word, &b, 1);
+}
+
+#ifdef USE_SERIAL_4WAY_BLHELI_BOOTLOADER
+static uint8_t pageBuffer[SERIAL_4WAY_PAGE_BUFFER_SIZE];
+
+static bool writeBufferedPage(uint16_t address, uint16_t length, uint8_t flags, uint8_t *readBuf)
+{
+    ioMem_t mem;
+
+    switch (CurrentInterfaceMode) {
+        case imSIL_BLB:
+        case imARM_BLB:
+            if (flags & BUFFER_FLASH_ERASE) {
+                mem.D_FLASH_ADDR_H = address >> 8;
+                mem.D_FLASH_ADDR_L = address & 0xff;
+                if (!BL_PageErase(&mem)) {
+                    return false;
+                }
+            }
+            break;
+        case imATM_BLB:
+            // the bootloader erases each page as it is programmed
+            break;
+        default:
+            return false;
+    }
+
+    for (uint16_t offset = 0; offset < length; offset += 256) {
+        const uint16_t chunk = MIN(length - offset, 256);
+
+        // the bootloader takes up to 256 bytes at a time, 0 means 256
+        mem.D_NUM_BYTES = chunk & 0xff;
+        mem.D_FLASH_ADDR_H = (address + offset) >> 8;
+        mem.D_FLASH_ADDR_L = (address + offset) & 0xff;
+        mem.D_PTR_I = &pageBuffer[offset];
+        if (!BL_WriteFlash(&mem)) {
+            return false;
+        }
+
+        if (flags & BUFFER_FLASH_VERIFY) {
+            mem.D_PTR_I = readBuf;
+            if (!BL_ReadFlash(CurrentInterfaceMode, &mem) || memcmp(readBuf, &pageBuffer[offset], chunk) != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
+static uint16_t flashBufferedPage(uint16_t escMask, uint16_t address, uint16_t length, uint8_t flags, uint8_t *readBuf)
+{
+    uint16_t failedMask = 0;
+
+    for (uint8_t esc = 0; esc < escCount; esc++) {
+        if (!(escMask & (1 << esc))) {
+            continue;
+        }
+        SET_DISCONNECTED;
+        selected_esc = esc;
+        if (Connect(&DeviceInfo)) {
+            DeviceInfo.bytes[INTF_MODE_IDX] = CurrentInterfaceMode;
+            if (!writeBufferedPage(address, length, flags, readBuf)) {
+                failedMask |= 1 << esc;
+            }
+        } else {
+            SET_DISCONNECTED;
+            failedMask |= 1 << esc;
+        }
+    }
+    return failedMask;
+}
+#endif
+
 void esc4wayProcess(serialPort_t *mspPort)
 {
 
@@ -819,6 +867,40 @@ void esc4wayProcess(serialPort_t *mspPort)
                     }
                     break;
                 }
+                #ifdef USE_SERIAL_4WAY_BLHELI_BOOTLOADER
+                case cmd_DeviceBufferWrite:
+                {
+                    // BuffLen = 0 means 256 Bytes
+                    const uint16_t offset = (ioMem.D_FLASH_ADDR_H << 8) | ioMem.D_FLASH_ADDR_L;
+                    const uint16_t length = I_PARAM_LEN ? I_PARAM_LEN : 256;
+                    if (offset + length <= SERIAL_4WAY_PAGE_BUFFER_SIZE) {
+                        memcpy(&pageBuffer[offset], ParamBuf, length);
+                    } else {
+                        ACK_OUT = ACK_I_INVALID_PARAM;
+                    }
+                    break;
+                }
+
+                case cmd_DeviceBufferFlash:
+                {
+                    const uint16_t escMask = (ParamBuf[0] << 8) | ParamBuf[1];
+                    const uint16_t length = (ParamBuf[2] << 8) | ParamBuf[3];
+                    if (I_PARAM_LEN < 5 || escMask == 0 || (escMask >> escCount) || length > SERIAL_4WAY_PAGE_BUFFER_SIZE) {
+                        ACK_OUT = ACK_I_INVALID_PARAM;
+                        break;
+                    }
+                    const uint16_t address = (ioMem.D_FLASH_ADDR_H << 8) | ioMem.D_FLASH_ADDR_L;
+                    const uint16_t failedMask = flashBufferedPage(escMask, address, length, ParamBuf[4], ParamBuf);
+                    O_PARAM_LEN = 2;
+                    Dummy.bytes[0] = failedMask >> 8;
+                    Dummy.bytes[1] = failedMask & 0xff;
+                    if (failedMask) {
+                        ACK_OUT = ACK_D_GENERAL_ERROR;
+                    }
+                    break;
+                }
+                #endif
+
                 //*** Device Memory Verify Ops ***
                 #ifdef USE_SERIAL_4WAY_BLHELI_BOOTLOADER
                 case cmd_DeviceVerify:
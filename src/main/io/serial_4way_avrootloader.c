@@ -32,6 +32,8 @@
 
 #ifdef  USE_SERIAL_4WAY_BLHELI_INTERFACE
 
+#include "common/utils.h"
+
 #include "drivers/io.h"
 #include "drivers/serial.h"
 #include "drivers/time.h"
@@ -91,7 +93,7 @@ static uint8_t suart_getc_(uint8_t *bt)
     btime = start_time + START_BIT_TIME;
     uint16_t bitmask = 0;
     uint8_t bit = 0;
-    while (micros() < btime);
+    while (cmp32(micros(), btime) < 0);
     while (1) {
         if (ESC_IS_HI)
         {
@@ -100,7 +102,7 @@ static uint8_t suart_getc_(uint8_t *bt)
         btime = btime + BIT_TIME;
         bit++;
         if (bit == 10) break;
-        while (micros() < btime);
+        while (cmp32(micros(), btime) < 0);
     }
     // check start bit and stop bit
     if ((bitmask & 1) || (!(bitmask & (1 << 9)))) {
@@ -110,12 +112,14 @@ static uint8_t suart_getc_(uint8_t *bt)
     return 1;
 }
 
-static void suart_putc_(uint8_t *tx_b)
+// Shifts out a byte with every bit edge on the schedule started by the caller, so
+// timing errors don't build up over a packet. Returns the time of the next bit.
+static uint32_t suart_putc_(uint8_t *tx_b, uint32_t btime)
 {
-    // shift out stopbit first
-    uint16_t bitmask = (*tx_b << 2) | 1 | (1 << 10);
-    uint32_t btime = micros();
+    // the stop bit is left on the line, the next byte starts when it ends
+    uint16_t bitmask = (*tx_b << 1) | (1 << 9);
     while (1) {
+        while (cmp32(micros(), btime) < 0);
         if (bitmask & 1) {
             ESC_SET_HI; // 1
         }
@@ -125,26 +129,24 @@ static void suart_putc_(uint8_t *tx_b)
         btime = btime + BIT_TIME;
         bitmask = (bitmask >> 1);
         if (bitmask == 0) break; // stopbit shifted out - but don't wait
-        while (micros() < btime);
     }
+    return btime;
 }
 
 static uint8_16_u CRC_16;
 static uint8_16_u LastCRC_16;
 
+// CRC of each 4 bit value shifted through the reflected register, for processing a nibble at a time
+static const uint16_t crc16NibbleTable[16] = {
+    0x0000, 0xcc01, 0xd801, 0x1400, 0xf001, 0x3c00, 0x2800, 0xe401,
+    0xa001, 0x6c00, 0x7800, 0xb401, 0x5000, 0x9c01, 0x8801, 0x4400,
+};
+
 static void ByteCrc(uint8_t *bt)
 {
-    uint8_t xb = *bt;
-    for (uint8_t i = 0; i < 8; i++)
-    {
-        if (((xb & 0x01) ^ (CRC_16.word & 0x0001)) !=0 ) {
-            CRC_16.word = CRC_16.word >> 1;
-            CRC_16.word = CRC_16.word ^ 0xA001;
-        } else {
-            CRC_16.word = CRC_16.word >> 1;
-        }
-        xb = xb >> 1;
-    }
+    // CRC-16 with polynomial 0xA001, low nibble first
+    CRC_16.word = (CRC_16.word >> 4) ^ crc16NibbleTable[(CRC_16.word ^ *bt) & 0x0f];
+    CRC_16.word = (CRC_16.word >> 4) ^ crc16NibbleTable[(CRC_16.word ^ (*bt >> 4)) & 0x0f];
 }
 
 static uint8_t BL_ReadBuf(uint8_t *pstring, uint8_t len)
@@ -179,16 +181,19 @@ static void BL_SendBuf(uint8_t *pstring, uint8_t len)
 {
     ESC_OUTPUT;
     CRC_16.word=0;
+    // one idle bit before the first start bit
+    ESC_SET_HI;
+    uint32_t btime = micros() + BIT_TIME;
     do {
-        suart_putc_(pstring);
+        btime = suart_putc_(pstring, btime);
         ByteCrc(pstring);
         pstring++;
         len--;
     } while (len > 0);
 
     if (isMcuConnected()) {
-        suart_putc_(&CRC_16.bytes[0]);
-        suart_putc_(&CRC_16.bytes[1]);
+        btime = suart_putc_(&CRC_16.bytes[0], btime);
+        suart_putc_(&CRC_16.bytes[1], btime);
     }
     ESC_INPUT;
 }
@@ -400,24 +400,32 @@ void read_boot_sector(const emfat_t *emfat, uint8_t *sect)
 
 emfat_entry_t *find_entry(const emfat_t *emfat, uint32_t clust, emfat_entry_t *nearest)
 {
-    if (nearest == NULL) {
-        nearest = emfat->priv.entries;
+    emfat_entry_t *entries = emfat->priv.entries;
+
+    // sequential reads carry on into the next entry
+    if (nearest != NULL && nearest->name != NULL) {
+        if (IS_CLUST_OF(clust, nearest))
+            return nearest;
+        if (nearest[1].name != NULL && IS_CLUST_OF(clust, &nearest[1]))
+            return &nearest[1];
     }
 
-    if (nearest->priv.first_clust > clust) {
-        while (nearest >= emfat->priv.entries) { // backward finding
-            if (IS_CLUST_OF(clust, nearest))
-                return nearest;
-            nearest--;
-        }
-    } else {
-        while (nearest->name != NULL) { // forward finding
-            if (IS_CLUST_OF(clust, nearest))
-                return nearest;
-            nearest++;
+    // clusters are allocated in table order, so find the last entry starting at or before clust
+    int left = 0;
+    int right = emfat->priv.num_entries;
+    while (left < right) {
+        const int mid = (left + right) / 2;
+        if (entries[mid].priv.first_clust <= clust) {
+            left = mid + 1;
+        } else {
+            right = mid;
         }
     }
-    return NULL;
+
+    if (left == 0 || !IS_CLUST_OF(clust, &entries[left - 1])) {
+        return NULL;
+    }
+    return &entries[left - 1];
 }
 
 void read_fsinfo_sector(const emfat_t *emfat, uint8_t *sect)
@@ -599,7 +607,8 @@ void fill_dir_sector(emfat_t *emfat, uint8_t *data, emfat_entry_t *entry, uint32
     }
 }
 
-void read_data_sector(emfat_t *emfat, uint8_t *data, uint32_t rel_sect)
+// returns the number of sectors read, files are read up to num_sect sectors at a time
+int read_data_sector(emfat_t *emfat, uint8_t *data, uint32_t rel_sect, int num_sect)
 {
     emfat_entry_t *le;
     uint32_t cluster;
@@ -613,32 +622,40 @@ void read_data_sector(emfat_t *emfat, uint8_t *data, uint32_t rel_sect)
             int i;
             for (i = 0; i < SECT / 4; i++)
                 ((uint32_t *)data)[i] = 0xEFBEADDE;
-            return;
+            return 1;
         }
         emfat->priv.last_entry = le;
     }
 
     if (le->dir) {
         fill_dir_sector(emfat, data, le, rel_sect);
-        return;
+        return 1;
+    }
+
+    // the clusters of a file are contiguous, so the rest of it can be read in one go
+    const uint32_t sectors_left = (le->priv.last_reserved + 1 - cluster) * SECT_PER_CLUST - rel_sect;
+    if ((uint32_t)num_sect > sectors_left) {
+        num_sect = sectors_left;
     }
 
     if (le->readcb == NULL) {
-        memset(data, 0, SECT);
+        memset(data, 0, num_sect * SECT);
     } else {
         uint32_t offset = cluster - le->priv.first_clust;
         offset = offset * CLUST + rel_sect * SECT;
-        le->readcb(data, SECT, offset + le->offset, le);
+        le->readcb(data, num_sect * SECT, offset + le->offset, le);
     }
 
-    return;
+    return num_sect;
 }
 
 void emfat_read(emfat_t *emfat, uint8_t *data, uint32_t sector, int num_sectors)
 {
     while (num_sectors > 0) {
+        int count = 1;
+
         if (sector >= emfat->priv.root_lba) {
-            read_data_sector(emfat, data, sector - emfat->priv.root_lba);
+            count = read_data_sector(emfat, data, sector - emfat->priv.root_lba, num_sectors);
         } else if (sector == 0) {
             read_mbr_sector(emfat, data);
         } else if (sector == emfat->priv.fsinfo_lba) {
@@ -652,9 +669,9 @@ void emfat_read(emfat_t *emfat, uint8_t *data, uint32_t sector, int num_sectors)
         } else {
             memset(data, 0, SECT);
         }
-        data += SECT;
-        num_sectors--;
-        sector++;
+        data += count * SECT;
+        num_sectors -= count;
+        sector += count;
     }
 }
 
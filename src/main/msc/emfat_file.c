@@ -26,13 +26,14 @@
 #include "emfat.h"
 #include "emfat_file.h"
 
+#include "common/maths.h"
 #include "common/printf.h"
 #include "common/time.h"
 #include "common/utils.h"
 
-#include "io/flashfs.h"
+#include "drivers/flash.h"
 
-#include "msc/usbd_storage.h"
+#include "io/flashfs.h"
 
 #define FILESYSTEM_SIZE_MB 256
 
@@ -239,11 +240,41 @@ static void memory_read_proc(uint8_t *dest, int size, uint32_t offset, emfat_ent
     memcpy(dest, &((char *)entry->user_data)[offset], len);
 }
 
+// Hosts may read a sector at a time, so fetch whole flash pages and serve the sectors from those
+#define BBLOG_READ_AHEAD_SIZE FLASH_MAX_PAGE_SIZE
+
+static uint8_t readAheadBuffer[BBLOG_READ_AHEAD_SIZE];
+static uint32_t readAheadOffset;
+static uint32_t readAheadLength;
+
 static void bblog_read_proc(uint8_t *dest, int size, uint32_t offset, emfat_entry_t *entry)
 {
     UNUSED(entry);
 
-    flashfsReadAbs(offset, dest, size);
+    if (size >= BBLOG_READ_AHEAD_SIZE) {
+        // Large reads gain nothing from buffering
+        flashfsReadAbs(offset, dest, size);
+        return;
+    }
+
+    while (size > 0) {
+        if (offset < readAheadOffset || offset >= readAheadOffset + readAheadLength) {
+            readAheadOffset = offset - offset % BBLOG_READ_AHEAD_SIZE;
+            readAheadLength = flashfsReadAbs(readAheadOffset, readAheadBuffer, BBLOG_READ_AHEAD_SIZE);
+
+            if (offset >= readAheadOffset + readAheadLength) {
+                // Past the end of the volume
+                return;
+            }
+        }
+
+        const int length = MIN(size, (int)(readAheadOffset + readAheadLength - offset));
+        memcpy(dest, &readAheadBuffer[offset - readAheadOffset], length);
+
+        dest += length;
+        offset += length;
+        size -= length;
+    }
 }
 
 static const emfat_entry_t entriesPredefined[] =
@@ -270,7 +301,7 @@ static const emfat_entry_t entriesPredefined[] =
 #define EMFAT_MAX_ENTRY (PREDEFINED_ENTRY_COUNT + EMFAT_MAX_LOG_ENTRY + APPENDED_ENTRY_COUNT)
 
 static emfat_entry_t entries[EMFAT_MAX_ENTRY];
-static char logNames[EMFAT_MAX_LOG_ENTRY][8+3];
+static char logNames[EMFAT_MAX_LOG_ENTRY][8 + 1 + 3 + 1];
 
 emfat_t emfat;
 static uint32_t cmaTime = CMA_TIME;
@@ -294,15 +325,43 @@ static void emfat_add_log(emfat_entry_t *entry, int number, uint32_t offset, uin
     emfat_set_entry_cma(entry);
 }
 
-static int emfat_find_log(emfat_entry_t *entry, int maxCount)
+static int emfat_find_log(emfat_entry_t *entry, int maxCount, int limit)
 {
-    int limit = flashfsIdentifyStartOfFreeSpace();
     int lastOffset = 0;
     int currOffset = 0;
     int fileNumber = 0;
     uint8_t buffer[18];
     int logCount = 0;
 
+#ifdef USE_FLASHFS_LOG_INDEX
+    // Logs recorded in the flashfs index don't need to be searched for
+    for (int i = 0; i < flashfsLogIndexCount() && fileNumber < maxCount; i++) {
+        flashfsLogEntry_t log;
+        if (!flashfsLogIndexGet(i, &log)) {
+            continue;
+        }
+
+        emfat_add_log(entry, fileNumber, log.start, log.length);
+        if (log.timestamp) {
+            const uint32_t logTime = emfat_cma_time_from_unix(log.timestamp);
+            entry->cma_time[0] = logTime;
+            entry->cma_time[1] = logTime;
+            entry->cma_time[2] = logTime;
+        }
+
+        ++entry;
+        ++fileNumber;
+        ++logCount;
+    }
+
+    if (fileNumber == maxCount) {
+        return logCount;
+    }
+
+    // Only what was written after the indexed logs needs scanning
+    lastOffset = currOffset = flashfsLogIndexEnd();
+#endif
+
     for ( ; currOffset < limit ; currOffset += 2048) { // XXX 2048 = FREE_BLOCK_SIZE in io/flashfs.c
 
         flashfsReadAbs(currOffset, buffer, 18);
@@ -336,6 +395,7 @@ void emfat_init_files(void)
 {
     emfat_entry_t *entry;
     memset(entries, 0, sizeof(entries));
+    readAheadLength = 0;
 
 #ifdef USE_PERSISTENT_MSC_RTC
     rtcTime_t mscRebootRtc;
@@ -350,8 +410,10 @@ void emfat_init_files(void)
         emfat_set_entry_cma(&entries[i]);
     }
 
+    const int usedSpace = flashfsIdentifyStartOfFreeSpace();
+
     // Detect and create entries for each individual log
-    const int logCount = emfat_find_log(&entries[PREDEFINED_ENTRY_COUNT], EMFAT_MAX_LOG_ENTRY);
+    const int logCount = emfat_find_log(&entries[PREDEFINED_ENTRY_COUNT], EMFAT_MAX_LOG_ENTRY, usedSpace);
 
     int entryIndex = PREDEFINED_ENTRY_COUNT + logCount;
 
@@ -360,7 +422,7 @@ void emfat_init_files(void)
         // allow downloading the entire log in one file
         entries[entryIndex] = entriesPredefined[PREDEFINED_ENTRY_COUNT];
         entry = &entries[entryIndex];
-        entry->curr_size = flashfsIdentifyStartOfFreeSpace();
+        entry->curr_size = usedSpace;
         entry->max_size = entry->curr_size;
         emfat_set_entry_cma(entry);
         ++entryIndex;
@@ -370,7 +432,7 @@ void emfat_init_files(void)
     entries[entryIndex] = entriesPredefined[PREDEFINED_ENTRY_COUNT + 1];
     entry = &entries[entryIndex];
     // used space is doubled because of the individual files plus the single complete file
-    entry->curr_size = (FILESYSTEM_SIZE_MB * 1024 * 1024) - (flashfsIdentifyStartOfFreeSpace() * 2);
+    entry->curr_size = (FILESYSTEM_SIZE_MB * 1024 * 1024) - (usedSpace * 2);
     entry->max_size = entry->curr_size;
     emfat_set_entry_cma(entry);
 
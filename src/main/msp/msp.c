@@ -31,12 +31,14 @@
 
 #include "build/build_config.h"
 #include "build/debug.h"
+#include "build/timings.h"
 #include "build/version.h"
 
 #include "common/axis.h"
 #include "common/bitarray.h"
 #include "common/color.h"
 #include "common/huffman.h"
+#include "common/lz4.h"
 #include "common/maths.h"
 #include "common/streambuf.h"
 #include "common/utils.h"
@@ -162,7 +164,8 @@ typedef enum {
 
 typedef enum {
     MSP_FLASHFS_FLAG_READY       = 1,
-    MSP_FLASHFS_FLAG_SUPPORTED  = 2
+    MSP_FLASHFS_FLAG_SUPPORTED  = 2,
+    MSP_FLASHFS_FLAG_LZ4        = 4
 } mspFlashFsFlags_e;
 
 #define RATEPROFILE_MASK (1 << 7)
@@ -345,6 +348,9 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
     if (flashfsIsSupported()) {
         uint8_t flags = MSP_FLASHFS_FLAG_SUPPORTED;
         flags |= (flashfsIsReady() ? MSP_FLASHFS_FLAG_READY : 0);
+#ifdef USE_LZ4
+        flags |= MSP_FLASHFS_FLAG_LZ4;
+#endif
 
         const flashPartition_t *flashPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS);
 
@@ -367,10 +373,14 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
 #ifdef USE_FLASHFS
 enum compressionType_e {
     NO_COMPRESSION,
-    HUFFMAN
+    HUFFMAN,
+    LZ4
 };
 
-static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat, bool allowCompression)
+// Bounds the flash read time of one LZ4 reply on very compressible data
+#define LZ4_MAX_RATIO 8
+
+static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat, uint8_t requestedCompression)
 {
     STATIC_ASSERT(MSP_PORT_DATAFLASH_INFO_SIZE >= 16, MSP_PORT_DATAFLASH_INFO_SIZE_invalid);
 
@@ -387,13 +397,22 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
     }
     sbufWriteU32(dst, address);
 
-    // legacy format does not support compression
+    // legacy format does not support compression, methods which aren't built in fall back to none
+    uint8_t compressionMethod = NO_COMPRESSION;
+    if (!useLegacyFormat) {
+        switch (requestedCompression) {
 #ifdef USE_HUFFMAN
-    const uint8_t compressionMethod = (!allowCompression || useLegacyFormat) ? NO_COMPRESSION : HUFFMAN;
-#else
-    const uint8_t compressionMethod = NO_COMPRESSION;
-    UNUSED(allowCompression);
+        case HUFFMAN:
 #endif
+#ifdef USE_LZ4
+        case LZ4:
+#endif
+            compressionMethod = requestedCompression;
+            break;
+        default:
+            break;
+        }
+    }
 
     if (compressionMethod == NO_COMPRESSION) {
 
@@ -419,6 +438,19 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
                 sbufWriteU8(dst, 0);
             }
         }
+#ifdef USE_LZ4
+    } else if (compressionMethod == LZ4) {
+        uint32_t bytesReadTotal;
+        const int bytesWritten = lz4EncodeStreaming(sbufPtr(dst) + sizeof(uint16_t) + sizeof(uint8_t) + LZ4_INFO_SIZE, readLen,
+            flashfsReadAbs, address, MIN(flashfsSize - address, (uint32_t)readLen * LZ4_MAX_RATIO), &bytesReadTotal);
+
+        // header
+        sbufWriteU16(dst, LZ4_INFO_SIZE + bytesWritten);
+        sbufWriteU8(dst, compressionMethod);
+        // payload
+        sbufWriteU16(dst, bytesReadTotal);
+        sbufAdvance(dst, bytesWritten);
+#endif
     } else {
 #ifdef USE_HUFFMAN
         // compress in 256-byte chunks
@@ -572,6 +604,24 @@ static bool mspCommonProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst, mspPostProce
         }
         break;
 
+#ifdef USE_TIMINGS
+    case MSP_TIMINGS:
+        sbufWriteU8(dst, TIMINGS_COUNT);
+        sbufWriteU16(dst, clockMicrosToCycles(1));
+        for (timingsProbe_e probe = 0; probe < TIMINGS_COUNT; probe++) {
+            timingsSummary_t summary;
+            timingsGetSummary(probe, &summary);
+            sbufWriteU32(dst, summary.count);
+            sbufWriteU32(dst, summary.minCycles);
+            sbufWriteU32(dst, summary.avgCycles);
+            sbufWriteU32(dst, summary.p50Cycles);
+            sbufWriteU32(dst, summary.p90Cycles);
+            sbufWriteU32(dst, summary.p99Cycles);
+            sbufWriteU32(dst, summary.maxCycles);
+        }
+        break;
+#endif
+
     case MSP_UID:
         sbufWriteU32(dst, U_ID_0);
         sbufWriteU32(dst, U_ID_1);
@@ -1690,12 +1740,12 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
     const unsigned int dataSize = sbufBytesRemaining(src);
     const uint32_t readAddress = sbufReadU32(src);
     uint16_t readLength;
-    bool allowCompression = false;
+    uint8_t requestedCompression = NO_COMPRESSION;
     bool useLegacyFormat;
     if (dataSize >= sizeof(uint32_t) + sizeof(uint16_t)) {
         readLength = sbufReadU16(src);
         if (sbufBytesRemaining(src)) {
-            allowCompression = sbufReadU8(src);
+            requestedCompression = sbufReadU8(src);
         }
         useLegacyFormat = false;
     } else {
@@ -1703,7 +1753,7 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
         useLegacyFormat = true;
     }
 
-    serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat, allowCompression);
+    serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat, requestedCompression);
 }
 #endif
 
@@ -2355,7 +2405,7 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 
 #ifdef USE_FLASHFS
     case MSP_DATAFLASH_ERASE:
-        flashfsEraseCompletely();
+        flashfsEraseAsync();
 
         break;
 #endif
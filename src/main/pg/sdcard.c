@@ -52,6 +52,10 @@ void pgResetFn_sdcardConfig(sdcardConfig_t *config)
     config->useDma = true;
 #endif
 
+#ifdef USE_SDCARD_SITL
+    config->mode = SDCARD_MODE_SITL;
+#endif
+
 #ifdef USE_SDCARD_SPI
     SPIDevice spidevice = spiDeviceByInstance(SDCARD_SPI_INSTANCE);
     config->device = SPI_DEV_TO_CFG(spidevice);
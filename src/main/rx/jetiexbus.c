@@ -63,7 +63,6 @@
 #define JETIEXBUS_BAUDRATE 125000                       // EX Bus 125000; EX Bus HS 250000 not supported
 #define JETIEXBUS_OPTIONS (SERIAL_STOPBITS_1 | SERIAL_PARITY_NO)
 #define JETIEXBUS_MIN_FRAME_GAP     1000
-#define JETIEXBUS_CHANNEL_COUNT     16                  // most Jeti TX transmit 16 channels
 
 
 #define EXBUS_START_CHANNEL_FRAME       (0x3E)
@@ -195,13 +194,16 @@ static void jetiExBusDataReceive(uint16_t c, void *data)
     // Check the header for the message length
     if (jetiExBusFramePosition == EXBUS_HEADER_LEN) {
 
-        if ((jetiExBusFrameState == EXBUS_STATE_IN_PROGRESS) && (jetiExBusFrame[EXBUS_HEADER_MSG_LEN] <= EXBUS_MAX_CHANNEL_FRAME_SIZE)) {
-            jetiExBusFrameLength = jetiExBusFrame[EXBUS_HEADER_MSG_LEN];
+        // a length shorter than the header would never complete the frame and overrun the buffer
+        const uint8_t frameLength = jetiExBusFrame[EXBUS_HEADER_MSG_LEN];
+
+        if ((jetiExBusFrameState == EXBUS_STATE_IN_PROGRESS) && (frameLength >= EXBUS_OVERHEAD) && (frameLength <= EXBUS_MAX_CHANNEL_FRAME_SIZE)) {
+            jetiExBusFrameLength = frameLength;
             return;
         }
 
-        if ((jetiExBusRequestState == EXBUS_STATE_IN_PROGRESS) && (jetiExBusFrame[EXBUS_HEADER_MSG_LEN] <= EXBUS_MAX_REQUEST_FRAME_SIZE)) {
-            jetiExBusFrameLength = jetiExBusFrame[EXBUS_HEADER_MSG_LEN];
+        if ((jetiExBusRequestState == EXBUS_STATE_IN_PROGRESS) && (frameLength >= EXBUS_OVERHEAD) && (frameLength <= EXBUS_MAX_REQUEST_FRAME_SIZE)) {
+            jetiExBusFrameLength = frameLength;
             return;
         }
 
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#define JETIEXBUS_CHANNEL_COUNT         16                  // most Jeti TX transmit 16 channels
 #define EXBUS_HEADER_LEN                6
 #define EXBUS_CRC_LEN                   2
 #define EXBUS_OVERHEAD                  (EXBUS_HEADER_LEN + EXBUS_CRC_LEN)
@@ -118,7 +118,11 @@ uint32_t rcInvalidPulsPeriod[MAX_SUPPORTED_RC_CHANNEL_COUNT];
 #define SKIP_RC_SAMPLES_ON_RESUME  2                // flush 2 samples to drop wrong measurements (timing independent)
 
 rxRuntimeConfig_t rxRuntimeConfig;
-static uint8_t rcSampleIndex = 0;
+
+#if defined(USE_PWM) || defined(USE_PPM)
+static movingAverageFilter_t rcSampleFilter[MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT];
+static int32_t rcSamples[MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT][PPM_AND_PWM_SAMPLE_COUNT];
+#endif
 
 PG_REGISTER_ARRAY_WITH_RESET_FN(rxChannelRangeConfig_t, NON_AUX_CHANNEL_COUNT, rxChannelRangeConfigs, PG_RX_CHANNEL_RANGE_CONFIG, 0);
 void pgResetFn_rxChannelRangeConfigs(rxChannelRangeConfig_t *rxChannelRangeConfigs)
@@ -250,9 +254,14 @@ void rxInit(void)
     rxRuntimeConfig.rcReadRawFn = nullReadRawRC;
     rxRuntimeConfig.rcFrameStatusFn = nullFrameStatus;
     rxRuntimeConfig.rcProcessFrameFn = nullProcessFrame;
-    rcSampleIndex = 0;
     needRxSignalMaxDelayUs = DELAY_10_HZ;
 
+#if defined(USE_PWM) || defined(USE_PPM)
+    for (int i = 0; i < MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT; i++) {
+        movingAverageFilterInit(&rcSampleFilter[i], rcSamples[i], PPM_AND_PWM_SAMPLE_COUNT);
+    }
+#endif
+
     for (int i = 0; i < MAX_SUPPORTED_RC_CHANNEL_COUNT; i++) {
         rcData[i] = rxConfig()->midrc;
         rcInvalidPulsPeriod[i] = millis() + MAX_INVALID_PULS_TIME;
@@ -465,28 +474,8 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
 #if defined(USE_PWM) || defined(USE_PPM)
 static uint16_t calculateChannelMovingAverage(uint8_t chan, uint16_t sample)
 {
-    static int16_t rcSamples[MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT][PPM_AND_PWM_SAMPLE_COUNT];
-    static int16_t rcDataMean[MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT];
-    static bool rxSamplesCollected = false;
-
-    const uint8_t currentSampleIndex = rcSampleIndex % PPM_AND_PWM_SAMPLE_COUNT;
-
-    // update the recent samples and compute the average of them
-    rcSamples[chan][currentSampleIndex] = sample;
-
-    // avoid returning an incorrect average which would otherwise occur before enough samples
-    if (!rxSamplesCollected) {
-        if (rcSampleIndex < PPM_AND_PWM_SAMPLE_COUNT) {
-            return sample;
-        }
-        rxSamplesCollected = true;
-    }
-
-    rcDataMean[chan] = 0;
-    for (int sampleIndex = 0; sampleIndex < PPM_AND_PWM_SAMPLE_COUNT; sampleIndex++) {
-        rcDataMean[chan] += rcSamples[chan][sampleIndex];
-    }
-    return rcDataMean[chan] / PPM_AND_PWM_SAMPLE_COUNT;
+    // averages only the samples received so far until the window is full
+    return movingAverageFilterApply(&rcSampleFilter[chan], sample);
 }
 #endif
 
@@ -626,8 +615,6 @@ bool calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs)
     readRxChannelsApplyRanges();
     detectAndApplySignalLossBehaviour();
 
-    rcSampleIndex++;
-
     return true;
 }
 
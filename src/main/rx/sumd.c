@@ -85,8 +85,14 @@ static void sumdDataReceive(uint16_t c, void *data)
             crc = 0;
         }
     }
-    if (sumdIndex == 2)
+    if (sumdIndex == 2) {
+        if (c > SUMD_MAX_CHANNEL) {
+            // corrupt channel count, the CRC and channels would be read beyond the buffer
+            sumdIndex = 0;
+            return;
+        }
         sumdChannelCount = (uint8_t)c;
+    }
     if (sumdIndex < SUMD_BUFFSIZE)
         sumd[sumdIndex] = (uint8_t)c;
     sumdIndex++;
@@ -26,6 +26,7 @@
 
 #ifdef USE_BARO
 
+#include "common/filter.h"
 #include "common/maths.h"
 
 #include "pg/pg.h"
@@ -125,7 +126,16 @@ static int32_t baroTemperature = 0;
 
 static int32_t baroGroundAltitude = 0;
 static int32_t baroGroundPressure = 8*101325;
-static uint32_t baroPressureSum = 0;
+static int32_t baroPressureAverage = 0;
+
+#define PRESSURE_SAMPLES_MEDIAN 3
+
+static medianFilter_t baroMedianFilter;
+static int32_t baroMedianWindow[PRESSURE_SAMPLES_MEDIAN];
+static int32_t baroMedianSorted[PRESSURE_SAMPLES_MEDIAN];
+
+static movingAverageFilter_t baroAverageFilter;
+static int32_t baroAverageSamples[BARO_SAMPLE_COUNT_MAX];
 
 void baroPreInit(void)
 {
@@ -136,6 +146,15 @@ void baroPreInit(void)
 #endif
 }
 
+static void baroFiltersInit(void)
+{
+    // the average is made up of baro_sample_count - 1 samples, as it always has been
+    const uint16_t sampleCount = constrain(barometerConfig()->baro_sample_count - 1, 1, BARO_SAMPLE_COUNT_MAX);
+
+    medianFilterInit(&baroMedianFilter, baroMedianWindow, baroMedianSorted, PRESSURE_SAMPLES_MEDIAN);
+    movingAverageFilterInit(&baroAverageFilter, baroAverageSamples, sampleCount);
+}
+
 bool baroDetect(baroDev_t *dev, baroSensor_e baroHardwareToUse)
 {
     // Detect what pressure sensors are available. baro->update() is set to sensor-specific update function
@@ -245,6 +264,7 @@ bool baroDetect(baroDev_t *dev, baroSensor_e baroHardwareToUse)
 
     detectedSensors[SENSOR_INDEX_BARO] = baroHardware;
     sensorsSet(SENSOR_BARO);
+    baroFiltersInit();
     return true;
 }
 
@@ -260,54 +280,15 @@ void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired)
 
 static bool baroReady = false;
 
-#define PRESSURE_SAMPLES_MEDIAN 3
-
-static int32_t applyBarometerMedianFilter(int32_t newPressureReading)
+static int32_t applyBarometerFilters(int32_t newPressureReading)
 {
-    static int32_t barometerFilterSamples[PRESSURE_SAMPLES_MEDIAN];
-    static int currentFilterSampleIndex = 0;
-    static bool medianFilterReady = false;
-    int nextSampleIndex;
-
-    nextSampleIndex = (currentFilterSampleIndex + 1);
-    if (nextSampleIndex == PRESSURE_SAMPLES_MEDIAN) {
-        nextSampleIndex = 0;
-        medianFilterReady = true;
-    }
-
-    barometerFilterSamples[currentFilterSampleIndex] = newPressureReading;
-    currentFilterSampleIndex = nextSampleIndex;
-
-    if (medianFilterReady)
-        return quickMedianFilter3(barometerFilterSamples);
-    else
-        return newPressureReading;
-}
+    const int32_t pressureAverage = movingAverageFilterApply(&baroAverageFilter, medianFilterApply(&baroMedianFilter, newPressureReading));
 
-#define PRESSURE_SAMPLE_COUNT (barometerConfig()->baro_sample_count - 1)
-
-static uint32_t recalculateBarometerTotal(uint8_t baroSampleCount, uint32_t pressureTotal, int32_t newPressureReading)
-{
-    static int32_t barometerSamples[BARO_SAMPLE_COUNT_MAX];
-    static int currentSampleIndex = 0;
-    int nextSampleIndex;
-
-    // store current pressure in barometerSamples
-    nextSampleIndex = (currentSampleIndex + 1);
-    if (nextSampleIndex == baroSampleCount) {
-        nextSampleIndex = 0;
+    if (movingAverageFilterIsPrimed(&baroAverageFilter)) {
         baroReady = true;
     }
-    barometerSamples[currentSampleIndex] = applyBarometerMedianFilter(newPressureReading);
-
-    // recalculate pressure total
-    // Note, the pressure total is made up of baroSampleCount - 1 samples - See PRESSURE_SAMPLE_COUNT
-    pressureTotal += barometerSamples[currentSampleIndex];
-    pressureTotal -= barometerSamples[nextSampleIndex];
-
-    currentSampleIndex = nextSampleIndex;
 
-    return pressureTotal;
+    return pressureAverage;
 }
 
 typedef enum {
@@ -339,7 +320,7 @@ uint32_t baroUpdate(void)
             baro.dev.calculate(&baroPressure, &baroTemperature);
             baro.baroPressure = baroPressure;
             baro.baroTemperature = baroTemperature;
-            baroPressureSum = recalculateBarometerTotal(barometerConfig()->baro_sample_count, baroPressureSum, baroPressure);
+            baroPressureAverage = applyBarometerFilters(baroPressure);
             state = BAROMETER_NEEDS_SAMPLES;
             return baro.dev.ut_delay;
         break;
@@ -353,7 +334,7 @@ int32_t baroCalculateAltitude(void)
     // calculates height from ground via baro readings
     // see: https://github.com/diydrones/ardupilot/blob/master/libraries/AP_Baro/AP_Baro.cpp#L140
     if (isBaroCalibrationComplete()) {
-        BaroAlt_tmp = lrintf((1.0f - pow_approx((float)(baroPressureSum / PRESSURE_SAMPLE_COUNT) / 101325.0f, 0.190295f)) * 4433000.0f); // in cm
+        BaroAlt_tmp = lrintf((1.0f - pow_approx((float)baroPressureAverage / 101325.0f, 0.190295f)) * 4433000.0f); // in cm
         BaroAlt_tmp -= baroGroundAltitude;
         baro.BaroAlt = lrintf((float)baro.BaroAlt * CONVERT_PARAMETER_TO_FLOAT(barometerConfig()->baro_noise_lpf) + (float)BaroAlt_tmp * (1.0f - CONVERT_PARAMETER_TO_FLOAT(barometerConfig()->baro_noise_lpf))); // additional LPF to reduce baro noise
     }
@@ -368,7 +349,7 @@ void performBaroCalibrationCycle(void)
     static int32_t savedGroundPressure = 0;
 
     baroGroundPressure -= baroGroundPressure / 8;
-    baroGroundPressure += baroPressureSum / PRESSURE_SAMPLE_COUNT;
+    baroGroundPressure += baroPressureAverage;
     baroGroundAltitude = (1.0f - pow_approx((baroGroundPressure / 8) / 101325.0f, 0.190295f)) * 4433000.0f;
 
     if (baroGroundPressure == savedGroundPressure)
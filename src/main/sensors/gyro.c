@@ -27,6 +27,7 @@
 #include "platform.h"
 
 #include "build/debug.h"
+#include "build/timings.h"
 
 #include "common/axis.h"
 #include "common/maths.h"
@@ -1019,7 +1020,10 @@ static FAST_CODE void checkForYawSpin(gyroSensor_t *gyroSensor, timeUs_t current
 
 static FAST_CODE FAST_CODE_NOINLINE void gyroUpdateSensor(gyroSensor_t *gyroSensor, timeUs_t currentTimeUs)
 {
-    if (!gyroSensor->gyroDev.readFn(&gyroSensor->gyroDev)) {
+    TIMINGS_START(TIMINGS_GYRO_READ);
+    const bool dataRead = gyroSensor->gyroDev.readFn(&gyroSensor->gyroDev);
+    TIMINGS_STOP(TIMINGS_GYRO_READ);
+    if (!dataRead) {
         return;
     }
     gyroSensor->gyroDev.dataReady = false;
@@ -1044,11 +1048,13 @@ static FAST_CODE FAST_CODE_NOINLINE void gyroUpdateSensor(gyroSensor_t *gyroSens
         return;
     }
 
+    TIMINGS_START(TIMINGS_GYRO_FILTER);
     if (gyroDebugMode == DEBUG_NONE) {
         filterGyro(gyroSensor);
     } else {
         filterGyroDebug(gyroSensor);
     }
+    TIMINGS_STOP(TIMINGS_GYRO_FILTER);
 
 #ifdef USE_GYRO_OVERFLOW_CHECK
     if (gyroConfig()->checkOverflow && !gyroHasOverflowProtection) {
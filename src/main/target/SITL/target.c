@@ -37,6 +37,7 @@
 #include "drivers/pwm_output.h"
 #include "drivers/light_led.h"
 
+#include "drivers/time.h"
 #include "drivers/timer.h"
 #include "drivers/timer_def.h"
 const timerHardware_t timerHardware[1]; // unused
@@ -331,6 +332,23 @@ uint32_t millis(void) {
     return millis64() & 0xFFFFFFFF;
 }
 
+// The cycle counter counts nanoseconds of real time
+uint32_t getCycleCounter(void) {
+    return nanos64_real() & 0xFFFFFFFF;
+}
+
+int32_t clockCyclesToMicros(int32_t clockCycles) {
+    return clockCycles / 1000;
+}
+
+int32_t clockCyclesTo10thMicros(int32_t clockCycles) {
+    return clockCycles / 100;
+}
+
+uint32_t clockMicrosToCycles(uint32_t micros) {
+    return micros * 1000;
+}
+
 void microsleep(uint32_t usec) {
     struct timespec ts;
     ts.tv_sec = 0;
@@ -457,6 +475,12 @@ void pwmWriteServo(uint8_t index, float value) {
     servosPwm[index] = value;
 }
 
+// IO part
+void IOConfigGPIO(IO_t io, ioConfig_t cfg) {
+    UNUSED(io);
+    UNUSED(cfg);
+}
+
 // ADC part
 uint16_t adcGetChannel(uint8_t channel) {
     UNUSED(channel);
@@ -544,3 +568,29 @@ void spektrumBind(rxConfig_t *rxConfig)
     UNUSED(rxConfig);
     printf("spektrumBind");
 }
+
+// storage latency injection
+void sitlLatencyInit(sitlLatency_t *latency, const char *envName)
+{
+    memset(latency, 0, sizeof(*latency));
+
+    const char *spec = getenv(envName);
+    if (spec == NULL) {
+        return;
+    }
+
+    if (sscanf(spec, "%u:%u:%u", &latency->latencyUs, &latency->spikeUs, &latency->spikeInterval) < 1) {
+        fprintf(stderr, "[latency] can't parse %s='%s'\n", envName, spec);
+        return;
+    }
+    printf("[latency] %s: %uus, %uus every %u operations\n", envName, latency->latencyUs, latency->spikeUs, latency->spikeInterval);
+}
+
+uint32_t sitlLatencyNext(sitlLatency_t *latency)
+{
+    if (latency->spikeInterval && ++latency->count >= latency->spikeInterval) {
+        latency->count = 0;
+        return latency->spikeUs;
+    }
+    return latency->latencyUs;
+}
@@ -45,6 +45,11 @@
 #define EEPROM_IN_RAM
 #define EEPROM_SIZE     32768
 
+// files backing the emulated dataflash and SD card
+#define FLASH_SITL_FILENAME     "flash.bin"
+#define FLASH_SITL_SIZE         (16 * 1024 * 1024)
+#define SDCARD_SITL_FILENAME    "sdcard.img"
+
 #define U_ID_0 0
 #define U_ID_1 1
 #define U_ID_2 2
@@ -69,6 +74,13 @@
 #define USE_BARO
 #define USE_FAKE_BARO
 
+#define USE_FLASHFS
+#define USE_FLASH_SITL
+#define USE_LZ4
+
+#define USE_SDCARD
+#define USE_SDCARD_SITL
+
 #define USABLE_TIMER_CHANNEL_COUNT 0
 
 #define USE_UART1
@@ -263,3 +275,15 @@ uint64_t micros64(void);
 uint64_t millis64(void);
 
 int lockMainPID(void);
+
+// Write latency injected by the emulated storage devices, parsed from an
+// environment variable of the form "<us>[:<spike us>:<spike interval>]"
+typedef struct sitlLatency_s {
+    uint32_t latencyUs;
+    uint32_t spikeUs;
+    uint32_t spikeInterval;
+    uint32_t count;
+} sitlLatency_t;
+
+void sitlLatencyInit(sitlLatency_t *latency, const char *envName);
+uint32_t sitlLatencyNext(sitlLatency_t *latency);
@@ -5,4 +5,12 @@ TARGET_SRC = \
             drivers/accgyro/accgyro_fake.c \
             drivers/barometer/barometer_fake.c \
             drivers/compass/compass_fake.c \
-            drivers/serial_tcp.c
+            drivers/flash.c \
+            drivers/flash_sitl.c \
+            drivers/sdcard.c \
+            drivers/sdcard_sitl.c \
+            drivers/serial_tcp.c \
+            io/asyncfatfs/asyncfatfs.c \
+            io/asyncfatfs/fat_standard.c \
+            io/flashfs.c \
+            pg/flash.c
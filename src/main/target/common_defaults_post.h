@@ -404,6 +404,19 @@
 #if defined(INVERTER_PIN_UART1) || defined(INVERTER_PIN_UART2) || defined(INVERTER_PIN_UART3) || defined(INVERTER_PIN_UART4) || defined(INVERTER_PIN_UART5) || defined(INVERTER_PIN_UART6)
 #define USE_INVERTER
 #endif
+
+// RAM shared by the receive and transmit buffers of all UARTs
+#ifndef SERIAL_BUFFER_POOL_SIZE
+#if defined(STM32F1)
+#define SERIAL_BUFFER_POOL_SIZE 1024
+#else
+#define SERIAL_BUFFER_POOL_SIZE 2048
+#endif
+#endif
+
+#if !defined(SIMULATOR_BUILD)
+#define USE_SERIAL_BUFFER_POOL
+#endif
 #endif
 
 #ifndef DEFAULT_MIXER
@@ -190,10 +190,15 @@
 #define USE_FLASH_W25M
 #endif
 
-#if defined(USE_FLASH_M25P16) || defined(USE_FLASH_W25N01G)
+#if defined(USE_FLASH_M25P16) || defined(USE_FLASH_W25N01G) || defined(USE_FLASH_SITL)
 #define USE_FLASH_CHIP
 #endif
 
+// Scanning a large NAND device for logs is slow, so keep an index of them instead
+#if defined(USE_FLASHFS) && defined(USE_FLASH_W25N01G)
+#define USE_FLASHFS_LOG_INDEX
+#endif
+
 #if defined(USE_MAX7456)
 #define USE_OSD
 #endif
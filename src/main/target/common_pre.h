@@ -93,6 +93,7 @@
 #define USE_MCO
 #define USE_DMA_SPEC
 #define USE_TIMER_MGMT
+#define USE_LZ4
 // Re-enable this after 4.0 has been released, and remove the define from STM32F4DISCOVERY
 //#define USE_SPI_TRANSACTION
 #endif // STM32F7
@@ -104,6 +105,7 @@
 #define USE_GYRO_DATA_ANALYSE
 #define USE_ADC_INTERNAL
 #define USE_USB_CDC_HID
+#define USE_LZ4
 #endif
 
 #if defined(STM32F4) || defined(STM32F7) || defined(STM32H7)
@@ -199,6 +201,7 @@
 #define USE_SERIALRX_FPORT      // FrSky FPort
 #define USE_TELEMETRY_CRSF
 #define USE_TELEMETRY_SRXL
+#define USE_TIMINGS             // Cycle counter timings of the gyro and PID loop, see the timings CLI command
 
 #if ((FLASH_SIZE > 256) || (FEATURE_CUT_LEVEL < 12))
 #define USE_CMS
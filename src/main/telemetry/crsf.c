@@ -62,12 +62,14 @@
 #include "sensors/sensors.h"
 
 #include "telemetry/telemetry.h"
+#include "telemetry/telemetry_scheduler.h"
 #include "telemetry/msp_shared.h"
 
 #include "telemetry/crsf.h"
 
 
 #define CRSF_CYCLETIME_US                   100000 // 100ms, 10 Hz
+#define CRSF_TELEMETRY_FRAMES_PER_SECOND    40     // the telemetry slots the receiver forwards
 #define CRSF_DEVICEINFO_VERSION             0x01
 #define CRSF_DEVICEINFO_PARAMETER_COUNT     0
 
@@ -367,9 +369,7 @@ static void crsfFrameDisplayPortClear(sbuf_t *dst)
 
 #endif
 
-#define BV(x)  (1 << (x)) // bit value
-
-// schedule array to decide how often each type of frame is sent
+// the scheduled frames, in the order they are added to the schedule
 typedef enum {
     CRSF_FRAME_START_INDEX = 0,
     CRSF_FRAME_ATTITUDE_INDEX = CRSF_FRAME_START_INDEX,
@@ -379,8 +379,7 @@ typedef enum {
     CRSF_SCHEDULE_COUNT_MAX
 } crsfFrameTypeIndex_e;
 
-static uint8_t crsfScheduleCount;
-static uint8_t crsfSchedule[CRSF_SCHEDULE_COUNT_MAX];
+static telemetryScheduler_t crsfScheduler;
 
 #if defined(USE_MSP_OVER_TELEMETRY)
 
@@ -406,39 +405,39 @@ void crsfSendMspResponse(uint8_t *payload)
 }
 #endif
 
-static void processCrsf(void)
+static void processCrsf(timeUs_t currentTimeUs)
 {
-    static uint8_t crsfScheduleIndex = 0;
-
-    const uint8_t currentSchedule = crsfSchedule[crsfScheduleIndex];
+    // the receiver holds one frame, which has just been sent
+    const int frameIndex = telemetrySchedulerNext(&crsfScheduler, currentTimeUs, 1);
+    if (frameIndex == TELEMETRY_SCHEDULER_NONE) {
+        return;
+    }
 
     sbuf_t crsfPayloadBuf;
     sbuf_t *dst = &crsfPayloadBuf;
 
-    if (currentSchedule & BV(CRSF_FRAME_ATTITUDE_INDEX)) {
-        crsfInitializeFrame(dst);
+    crsfInitializeFrame(dst);
+    switch (frameIndex) {
+    case CRSF_FRAME_ATTITUDE_INDEX:
         crsfFrameAttitude(dst);
-        crsfFinalize(dst);
-    }
-    if (currentSchedule & BV(CRSF_FRAME_BATTERY_SENSOR_INDEX)) {
-        crsfInitializeFrame(dst);
+        break;
+    case CRSF_FRAME_BATTERY_SENSOR_INDEX:
         crsfFrameBatterySensor(dst);
-        crsfFinalize(dst);
-    }
-
-    if (currentSchedule & BV(CRSF_FRAME_FLIGHT_MODE_INDEX)) {
-        crsfInitializeFrame(dst);
+        break;
+    case CRSF_FRAME_FLIGHT_MODE_INDEX:
         crsfFrameFlightMode(dst);
-        crsfFinalize(dst);
-    }
+        break;
 #ifdef USE_GPS
-    if (currentSchedule & BV(CRSF_FRAME_GPS_INDEX)) {
-        crsfInitializeFrame(dst);
+    case CRSF_FRAME_GPS_INDEX:
         crsfFrameGps(dst);
-        crsfFinalize(dst);
-    }
+        break;
 #endif
-    crsfScheduleIndex = (crsfScheduleIndex + 1) % crsfScheduleCount;
+    default:
+        break;
+    }
+    crsfFinalize(dst);
+
+    telemetrySchedulerSent(&crsfScheduler, frameIndex, 1, currentTimeUs);
 }
 
 void crsfScheduleDeviceInfoResponse(void)
@@ -466,22 +465,23 @@ void initCrsfTelemetry(void)
     cmsDisplayPortRegister(displayPortCrsfInit());
 #endif
 
-    int index = 0;
-    if (sensors(SENSOR_ACC) && telemetryIsSensorEnabled(SENSOR_PITCH | SENSOR_ROLL | SENSOR_HEADING)) {
-        crsfSchedule[index++] = BV(CRSF_FRAME_ATTITUDE_INDEX);
-    }
-    if ((isBatteryVoltageConfigured() && telemetryIsSensorEnabled(SENSOR_VOLTAGE))
-        || (isAmperageConfigured() && telemetryIsSensorEnabled(SENSOR_CURRENT | SENSOR_FUEL))) {
-        crsfSchedule[index++] = BV(CRSF_FRAME_BATTERY_SENSOR_INDEX);
-    }
-    crsfSchedule[index++] = BV(CRSF_FRAME_FLIGHT_MODE_INDEX);
+    // Every frame is sent at 10Hz when the link allows. When it doesn't battery and attitude keep more of it.
+    telemetrySchedulerInit(&crsfScheduler, CRSF_TELEMETRY_FRAMES_PER_SECOND);
+    telemetrySchedulerAdd(&crsfScheduler, CRSF_CYCLETIME_US, 3, 1);
+    telemetrySchedulerEnable(&crsfScheduler, CRSF_FRAME_ATTITUDE_INDEX,
+        sensors(SENSOR_ACC) && telemetryIsSensorEnabled(SENSOR_PITCH | SENSOR_ROLL | SENSOR_HEADING));
+    telemetrySchedulerAdd(&crsfScheduler, CRSF_CYCLETIME_US, 4, 1);
+    telemetrySchedulerEnable(&crsfScheduler, CRSF_FRAME_BATTERY_SENSOR_INDEX,
+        (isBatteryVoltageConfigured() && telemetryIsSensorEnabled(SENSOR_VOLTAGE))
+        || (isAmperageConfigured() && telemetryIsSensorEnabled(SENSOR_CURRENT | SENSOR_FUEL)));
+    telemetrySchedulerAdd(&crsfScheduler, CRSF_CYCLETIME_US, 2, 1);
+    telemetrySchedulerAdd(&crsfScheduler, CRSF_CYCLETIME_US, 1, 1);
 #ifdef USE_GPS
-    if (featureIsEnabled(FEATURE_GPS)
-       && telemetryIsSensorEnabled(SENSOR_ALTITUDE | SENSOR_LAT_LONG | SENSOR_GROUND_SPEED | SENSOR_HEADING)) {
-        crsfSchedule[index++] = BV(CRSF_FRAME_GPS_INDEX);
-    }
+    telemetrySchedulerEnable(&crsfScheduler, CRSF_FRAME_GPS_INDEX, featureIsEnabled(FEATURE_GPS)
+       && telemetryIsSensorEnabled(SENSOR_ALTITUDE | SENSOR_LAT_LONG | SENSOR_GROUND_SPEED | SENSOR_HEADING));
+#else
+    telemetrySchedulerEnable(&crsfScheduler, CRSF_FRAME_GPS_INDEX, false);
 #endif
-    crsfScheduleCount = (uint8_t)index;
  }
 
 bool checkCrsfTelemetryState(void)
@@ -519,8 +519,6 @@ void crsfProcessDisplayPortCmd(uint8_t *frameStart)
  */
 void handleCrsfTelemetry(timeUs_t currentTimeUs)
 {
-    static uint32_t crsfLastCycleTime;
-
     if (!crsfTelemetryEnabled) {
         return;
     }
@@ -533,7 +531,7 @@ void handleCrsfTelemetry(timeUs_t currentTimeUs)
 #if defined(USE_MSP_OVER_TELEMETRY)
     if (mspReplyPending) {
         mspReplyPending = handleCrsfMspFrameBuffer(CRSF_FRAME_TX_MSP_FRAME_SIZE, &crsfSendMspResponse);
-        crsfLastCycleTime = currentTimeUs; // reset telemetry timing due to ad-hoc request
+        telemetrySchedulerCharge(&crsfScheduler, 1); // ad-hoc replies use the link too
         return;
     }
 #endif
@@ -545,7 +543,7 @@ void handleCrsfTelemetry(timeUs_t currentTimeUs)
         crsfFrameDeviceInfo(dst);
         crsfFinalize(dst);
         deviceInfoReplyPending = false;
-        crsfLastCycleTime = currentTimeUs; // reset telemetry timing due to ad-hoc request
+        telemetrySchedulerCharge(&crsfScheduler, 1); // ad-hoc replies use the link too
         return;
     }
 
@@ -557,7 +555,7 @@ void handleCrsfTelemetry(timeUs_t currentTimeUs)
         crsfInitializeFrame(dst);
         crsfFrameDisplayPortClear(dst);
         crsfFinalize(dst);
-        crsfLastCycleTime = currentTimeUs;
+        telemetrySchedulerCharge(&crsfScheduler, 1);
         return;
     }
     const int nextRow = crsfDisplayPortNextRow();
@@ -568,17 +566,12 @@ void handleCrsfTelemetry(timeUs_t currentTimeUs)
         crsfFrameDisplayPortRow(dst, nextRow);
         crsfFinalize(dst);
         crsfDisplayPortScreen()->pendingTransport[nextRow] = false;
-        crsfLastCycleTime = currentTimeUs;
+        telemetrySchedulerCharge(&crsfScheduler, 1);
         return;
     }
 #endif
 
-    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz
-    // Spread out scheduled frames evenly so each frame is sent at the same frequency.
-    if (currentTimeUs >= crsfLastCycleTime + (CRSF_CYCLETIME_US / crsfScheduleCount)) {
-        crsfLastCycleTime = currentTimeUs;
-        processCrsf();
-    }
+    processCrsf(currentTimeUs);
 }
 
 int getCrsfFrame(uint8_t *frame, crsfFrameType_e frameType)
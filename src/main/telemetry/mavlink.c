@@ -25,6 +25,7 @@
  */
 #include <stdbool.h>
 #include <stdint.h>
+#include <limits.h>
 #include <string.h>
 
 #include "platform.h"
@@ -70,6 +71,7 @@
 #include "sensors/battery.h"
 
 #include "telemetry/telemetry.h"
+#include "telemetry/telemetry_scheduler.h"
 #include "telemetry/mavlink.h"
 
 // mavlink library uses unnames unions that's causes GCC to complain if -Wpedantic is used
@@ -79,9 +81,10 @@
 #include "common/mavlink.h"
 #pragma GCC diagnostic pop
 
-#define TELEMETRY_MAVLINK_INITIAL_PORT_MODE MODE_TX
+#define TELEMETRY_MAVLINK_INITIAL_PORT_MODE MODE_RXTX
 #define TELEMETRY_MAVLINK_MAXRATE 50
-#define TELEMETRY_MAVLINK_DELAY ((1000 * 1000) / TELEMETRY_MAVLINK_MAXRATE)
+
+#define MAVLINK_PACKET_LEN(payloadLen) ((payloadLen) + MAVLINK_NUM_NON_PAYLOAD_BYTES)
 
 extern uint16_t rssi; // FIXME dependency on mw.c
 
@@ -89,51 +92,42 @@ static serialPort_t *mavlinkPort = NULL;
 static serialPortConfig_t *portConfig;
 
 static bool mavlinkTelemetryEnabled =  false;
+static bool mavlinkPortShared = false;
 static portSharing_e mavlinkPortSharing;
 
-/* MAVLink datastream rates in Hz */
-static const uint8_t mavRates[] = {
-    [MAV_DATA_STREAM_EXTENDED_STATUS] = 2, //2Hz
-    [MAV_DATA_STREAM_RC_CHANNELS] = 5, //5Hz
-    [MAV_DATA_STREAM_POSITION] = 2, //2Hz
-    [MAV_DATA_STREAM_EXTRA1] = 10, //10Hz
-    [MAV_DATA_STREAM_EXTRA2] = 10 //2Hz
-};
-
-#define MAXSTREAMS (sizeof(mavRates) / sizeof(mavRates[0]))
-
-static uint8_t mavTicks[MAXSTREAMS];
 static mavlink_message_t mavMsg;
 static uint8_t mavBuffer[MAVLINK_MAX_PACKET_LEN];
-static uint32_t lastMavlinkMessage = 0;
-
-static int mavlinkStreamTrigger(enum MAV_DATA_STREAM streamNum)
-{
-    uint8_t rate = (uint8_t) mavRates[streamNum];
-    if (rate == 0) {
-        return 0;
-    }
-
-    if (mavTicks[streamNum] == 0) {
-        // we're triggering now, setup the next trigger point
-        if (rate > TELEMETRY_MAVLINK_MAXRATE) {
-            rate = TELEMETRY_MAVLINK_MAXRATE;
-        }
-
-        mavTicks[streamNum] = (TELEMETRY_MAVLINK_MAXRATE / rate);
-        return 1;
-    }
-
-    // count down at TASK_RATE_HZ
-    mavTicks[streamNum]--;
-    return 0;
-}
 
+static telemetryScheduler_t mavlinkScheduler;
+
+// The streams we send, in the order of their schedule items
+typedef enum {
+    MAVLINK_STREAM_HEARTBEAT,
+    MAVLINK_STREAM_EXTENDED_STATUS,
+    MAVLINK_STREAM_RC_CHANNELS,
+    MAVLINK_STREAM_POSITION,
+    MAVLINK_STREAM_EXTRA1,
+    MAVLINK_STREAM_EXTRA2,
+    MAVLINK_STREAM_COUNT
+} mavlinkStream_e;
+
+typedef struct mavlinkStreamState_s {
+    uint8_t rate;               // Hz, 0 when the stream is stopped
+    bool sent;                  // sent since it was started
+    bool deferred;              // due, but waiting for tx buffer space
+    timeDelta_t lateUs;         // how late the updates have been, less the dropped ones
+} mavlinkStreamState_t;
+
+static mavlinkStreamState_t mavlinkStreamStates[MAVLINK_STREAM_COUNT];
+
+// Stream updates sent, the updates skipped because a stream fell behind its rate, and the times a due stream had to wait for tx space
+static uint32_t mavlinkStreamsSent;
+static uint32_t mavlinkStreamsDropped;
+static uint32_t mavlinkStreamsDeferred;
 
 static void mavlinkSerialWrite(uint8_t * buf, uint16_t length)
 {
-    for (int i = 0; i < length; i++)
-        serialWrite(mavlinkPort, buf[i]);
+    serialWriteBuf(mavlinkPort, buf, length);
 }
 
 static int16_t headingOrScaledMilliAmpereHoursDrawn(void)
@@ -154,12 +148,6 @@ void freeMAVLinkTelemetryPort(void)
     mavlinkTelemetryEnabled = false;
 }
 
-void initMAVLinkTelemetry(void)
-{
-    portConfig = findSerialPortConfig(FUNCTION_TELEMETRY_MAVLINK);
-    mavlinkPortSharing = determinePortSharing(portConfig, FUNCTION_TELEMETRY_MAVLINK);
-}
-
 void configureMAVLinkTelemetryPort(void)
 {
     if (!portConfig) {
@@ -178,6 +166,10 @@ void configureMAVLinkTelemetryPort(void)
         return;
     }
 
+    // a byte takes 10 bits on the wire
+    telemetrySchedulerSetBudget(&mavlinkScheduler, baudRates[baudRateIndex] / 10);
+
+    mavlinkPortShared = false;
     mavlinkTelemetryEnabled = true;
 }
 
@@ -186,6 +178,9 @@ void checkMAVLinkTelemetryState(void)
     if (portConfig && telemetryCheckRxPortShared(portConfig)) {
         if (!mavlinkTelemetryEnabled && telemetrySharedPort != NULL) {
             mavlinkPort = telemetrySharedPort;
+            // the baud rate is the receiver's, leave the link budget to the tx buffer space
+            telemetrySchedulerSetBudget(&mavlinkScheduler, 0);
+            mavlinkPortShared = true;
             mavlinkTelemetryEnabled = true;
         }
     } else {
@@ -232,6 +227,10 @@ void mavlinkSendSystemStatus(void)
         batteryRemaining = isBatteryVoltageConfigured() ? calculateBatteryPercentageRemaining() : batteryRemaining;
     }
 
+    // the stream updates skipped because the link couldn't keep up with the requested rates
+    const uint32_t streamUpdates = mavlinkStreamsSent + mavlinkStreamsDropped;
+    const uint16_t dropRate = streamUpdates ? (uint64_t)mavlinkStreamsDropped * 10000 / streamUpdates : 0;
+
     mavlink_msg_sys_status_pack(0, 200, &mavMsg,
         // onboard_control_sensors_present Bitmask showing which onboard controllers and sensors are present.
         //Value of 0: not present. Value of 1: present. Indices: 0: 3D gyro, 1: 3D acc, 2: 3D mag, 3: absolute pressure,
@@ -252,11 +251,11 @@ void mavlinkSendSystemStatus(void)
         // battery_remaining Remaining battery energy: (0%: 0, 100%: 100), -1: autopilot estimate the remaining battery
         batteryRemaining,
         // drop_rate_comm Communication drops in percent, (0%: 0, 100%: 10'000), (UART, I2C, SPI, CAN), dropped packets on all links (packets that were corrupted on reception on the MAV)
-        0,
+        dropRate,
         // errors_comm Communication errors (UART, I2C, SPI, CAN), dropped packets on all links (packets that were corrupted on reception on the MAV)
-        0,
-        // errors_count1 Autopilot-specific errors
-        0,
+        MIN(mavlinkStreamsDropped, (uint32_t)UINT16_MAX),
+        // errors_count1 Autopilot-specific errors, the stream updates that waited for tx buffer space
+        MIN(mavlinkStreamsDeferred, (uint32_t)UINT16_MAX),
         // errors_count2 Autopilot-specific errors
         0,
         // errors_count3 Autopilot-specific errors
@@ -404,7 +403,7 @@ void mavlinkSendAttitude(void)
     mavlinkSerialWrite(mavBuffer, msgLength);
 }
 
-void mavlinkSendHUDAndHeartbeat(void)
+void mavlinkSendHUD(void)
 {
     uint16_t msgLength;
     float mavAltitude = 0;
@@ -453,7 +452,11 @@ void mavlinkSendHUDAndHeartbeat(void)
         mavClimbRate);
     msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
     mavlinkSerialWrite(mavBuffer, msgLength);
+}
 
+void mavlinkSendHeartbeat(void)
+{
+    uint16_t msgLength;
 
     uint8_t mavModes = MAV_MODE_FLAG_MANUAL_INPUT_ENABLED;
     if (ARMING_FLAG(ARMED))
@@ -531,29 +534,150 @@ void mavlinkSendHUDAndHeartbeat(void)
     mavlinkSerialWrite(mavBuffer, msgLength);
 }
 
-void processMAVLinkTelemetry(void)
+typedef struct mavlinkStream_s {
+    uint8_t id;                 // MAV_DATA_STREAM
+    uint8_t defaultRate;        // Hz
+    uint8_t priority;
+    uint8_t length;             // bytes of an update of the stream
+    void (*send)(void);
+} mavlinkStream_t;
+
+// The heartbeat isn't a data stream, it is sent at 1Hz whatever the ground station requests
+static const mavlinkStream_t mavlinkStreams[MAVLINK_STREAM_COUNT] = {
+    [MAVLINK_STREAM_HEARTBEAT] = { MAV_DATA_STREAM_ALL, 1, 4,
+        MAVLINK_PACKET_LEN(MAVLINK_MSG_ID_HEARTBEAT_LEN), mavlinkSendHeartbeat },
+    [MAVLINK_STREAM_EXTENDED_STATUS] = { MAV_DATA_STREAM_EXTENDED_STATUS, 2, 2,
+        MAVLINK_PACKET_LEN(MAVLINK_MSG_ID_SYS_STATUS_LEN), mavlinkSendSystemStatus },
+    [MAVLINK_STREAM_RC_CHANNELS] = { MAV_DATA_STREAM_RC_CHANNELS, 5, 1,
+        MAVLINK_PACKET_LEN(MAVLINK_MSG_ID_RC_CHANNELS_RAW_LEN), mavlinkSendRCChannelsAndRSSI },
+#if defined(USE_GPS)
+    [MAVLINK_STREAM_POSITION] = { MAV_DATA_STREAM_POSITION, 2, 2,
+        MAVLINK_PACKET_LEN(MAVLINK_MSG_ID_GPS_RAW_INT_LEN) + MAVLINK_PACKET_LEN(MAVLINK_MSG_ID_GLOBAL_POSITION_INT_LEN)
+        + MAVLINK_PACKET_LEN(MAVLINK_MSG_ID_GPS_GLOBAL_ORIGIN_LEN), mavlinkSendPosition },
+#else
+    [MAVLINK_STREAM_POSITION] = { MAV_DATA_STREAM_POSITION, 0, 2, 0, NULL },
+#endif
+    [MAVLINK_STREAM_EXTRA1] = { MAV_DATA_STREAM_EXTRA1, 10, 3,
+        MAVLINK_PACKET_LEN(MAVLINK_MSG_ID_ATTITUDE_LEN), mavlinkSendAttitude },
+    [MAVLINK_STREAM_EXTRA2] = { MAV_DATA_STREAM_EXTRA2, 10, 3,
+        MAVLINK_PACKET_LEN(MAVLINK_MSG_ID_VFR_HUD_LEN), mavlinkSendHUD },
+};
+
+static void mavlinkSetStreamRate(mavlinkStream_e stream, uint8_t rate)
+{
+    mavlinkStreamState_t *state = &mavlinkStreamStates[stream];
+    state->rate = MIN(rate, TELEMETRY_MAVLINK_MAXRATE);
+    state->sent = false;
+    state->deferred = false;
+    state->lateUs = 0;
+    if (state->rate) {
+        telemetrySchedulerSetInterval(&mavlinkScheduler, stream, 1000000 / state->rate);
+    }
+}
+
+static bool mavlinkStreamIsEnabled(mavlinkStream_e stream)
 {
-    // is executed @ TELEMETRY_MAVLINK_MAXRATE rate
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTENDED_STATUS)) {
-        mavlinkSendSystemStatus();
+#if defined(USE_GPS)
+    if (stream == MAVLINK_STREAM_POSITION && !sensors(SENSOR_GPS)) {
+        return false;
     }
+#endif
+    // a stream larger than the tx buffer would never fit it
+    return mavlinkStreams[stream].send && mavlinkStreamStates[stream].rate
+        && mavlinkStreams[stream].length <= mavlinkPort->txBufferSize;
+}
 
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_RC_CHANNELS)) {
-        mavlinkSendRCChannelsAndRSSI();
+static void mavlinkHandleRequestDataStream(const mavlink_message_t *msg)
+{
+    mavlink_request_data_stream_t request;
+    mavlink_msg_request_data_stream_decode(msg, &request);
+
+    const uint8_t rate = request.start_stop ? MIN(request.req_message_rate, TELEMETRY_MAVLINK_MAXRATE) : 0;
+    for (unsigned i = 0; i < MAVLINK_STREAM_COUNT; i++) {
+        if (i == MAVLINK_STREAM_HEARTBEAT) {
+            continue;
+        }
+        if (request.req_stream_id == MAV_DATA_STREAM_ALL || request.req_stream_id == mavlinkStreams[i].id) {
+            mavlinkSetStreamRate(i, rate);
+        }
     }
+}
 
-#ifdef USE_GPS
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_POSITION)) {
-        mavlinkSendPosition();
+static void mavlinkProcessRx(void)
+{
+    static mavlink_message_t rxMsg;
+    static mavlink_status_t rxStatus;
+
+    while (serialRxBytesWaiting(mavlinkPort)) {
+        if (mavlink_parse_char(MAVLINK_COMM_0, serialRead(mavlinkPort), &rxMsg, &rxStatus)
+            && rxMsg.msgid == MAVLINK_MSG_ID_REQUEST_DATA_STREAM) {
+            // we are the only system on the link, so all requests are for us
+            mavlinkHandleRequestDataStream(&rxMsg);
+        }
     }
-#endif
+}
+
+void initMAVLinkTelemetry(void)
+{
+    portConfig = findSerialPortConfig(FUNCTION_TELEMETRY_MAVLINK);
+    mavlinkPortSharing = determinePortSharing(portConfig, FUNCTION_TELEMETRY_MAVLINK);
 
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTRA1)) {
-        mavlinkSendAttitude();
+    // the streams start at their default rates until the ground station asks for others
+    telemetrySchedulerInit(&mavlinkScheduler, 0);
+    for (unsigned i = 0; i < MAVLINK_STREAM_COUNT; i++) {
+        telemetrySchedulerAdd(&mavlinkScheduler, 0, mavlinkStreams[i].priority, mavlinkStreams[i].length);
+        mavlinkSetStreamRate(i, mavlinkStreams[i].defaultRate);
     }
 
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTRA2)) {
-        mavlinkSendHUDAndHeartbeat();
+    mavlinkStreamsSent = 0;
+    mavlinkStreamsDropped = 0;
+    mavlinkStreamsDeferred = 0;
+}
+
+/*
+ * Sends the streams that are due, as many as fit the tx buffer so the serial task never waits for it.
+ * When the link can't carry every stream at its rate, the scheduler shares it by priority / interval.
+ */
+void processMAVLinkTelemetry(timeUs_t currentTimeUs)
+{
+    for (unsigned i = 0; i < MAVLINK_STREAM_COUNT; i++) {
+        const bool enabled = mavlinkStreamIsEnabled(i);
+        if (!enabled) {
+            mavlinkStreamStates[i].sent = false;
+            mavlinkStreamStates[i].lateUs = 0;
+        }
+        telemetrySchedulerEnable(&mavlinkScheduler, i, enabled);
+    }
+
+    while (true) {
+        // tx space is checked here, rather than by the scheduler, to count the streams that wait for it
+        const int next = telemetrySchedulerNext(&mavlinkScheduler, currentTimeUs, INT_MAX);
+        if (next == TELEMETRY_SCHEDULER_NONE) {
+            break;
+        }
+
+        mavlinkStreamState_t *state = &mavlinkStreamStates[next];
+        if (mavlinkStreams[next].length > serialTxBytesFree(mavlinkPort)) {
+            if (!state->deferred) {
+                state->deferred = true;
+                mavlinkStreamsDeferred++;
+            }
+            break;
+        }
+
+        if (state->sent) {
+            // the time an update is late adds up, every interval of it is an update that didn't go out
+            const telemetryScheduleItem_t *item = &mavlinkScheduler.items[next];
+            state->lateUs += MAX(cmpTimeUs(currentTimeUs, item->lastSentUs) - item->intervalUs, 0);
+            mavlinkStreamsDropped += state->lateUs / item->intervalUs;
+            state->lateUs %= item->intervalUs;
+        }
+
+        mavlinkStreams[next].send();
+        telemetrySchedulerSent(&mavlinkScheduler, next, mavlinkStreams[next].length, currentTimeUs);
+        state->sent = true;
+        state->deferred = false;
+        mavlinkStreamsSent++;
     }
 }
 
@@ -567,11 +691,12 @@ void handleMAVLinkTelemetry(void)
         return;
     }
 
-    uint32_t now = micros();
-    if ((now - lastMavlinkMessage) >= TELEMETRY_MAVLINK_DELAY) {
-        processMAVLinkTelemetry();
-        lastMavlinkMessage = now;
+    if (!mavlinkPortShared) {
+        // a port shared with the receiver carries its frames, leave those to it
+        mavlinkProcessRx();
     }
+
+    processMAVLinkTelemetry(micros());
 }
 
 #endif
@@ -81,6 +81,7 @@
 #include "telemetry/msp_shared.h"
 #include "telemetry/smartport.h"
 #include "telemetry/telemetry.h"
+#include "telemetry/telemetry_scheduler.h"
 
 #define SMARTPORT_MIN_TELEMETRY_RESPONSE_DELAY_US 500
 
@@ -152,28 +153,35 @@ enum
 // if adding more sensors then increase this value
 #define MAX_DATAIDS 17
 
-static uint16_t frSkyDataIdTable[MAX_DATAIDS];
-
 #ifdef USE_ESC_SENSOR_TELEMETRY
-// number of sensors to send between sending the ESC sensors
-#define ESC_SENSOR_PERIOD 7
-
 // if adding more esc sensors then increase this value
 #define MAX_ESC_DATAIDS 4
-
-static uint16_t frSkyEscDataIdTable[MAX_ESC_DATAIDS];
+#else
+#define MAX_ESC_DATAIDS 0
 #endif
 
-typedef struct frSkyTableInfo_s {
-    uint16_t * table;
-    uint8_t size;
-    uint8_t index;
-} frSkyTableInfo_t;
+#define MAX_SENSORS (MAX_DATAIDS + MAX_ESC_DATAIDS)
 
-static frSkyTableInfo_t frSkyDataIdTableInfo = { frSkyDataIdTable, 0, 0 };
-#ifdef USE_ESC_SENSOR_TELEMETRY
-static frSkyTableInfo_t frSkyEscDataIdTableInfo = {frSkyEscDataIdTable, 0, 0};
-#endif
+STATIC_ASSERT(MAX_SENSORS <= TELEMETRY_SCHEDULER_MAX_ITEMS, smartport_sensors_exceed_scheduler_items);
+
+/*
+ * A sensor is sent again after its min interval while its value changes, and after its max interval
+ * when it doesn't. When the bus has fewer slots for us than that, the sensors that are due share the
+ * slots in proportion to priority / interval, so changing, high priority values keep most of them.
+ */
+typedef struct smartPortSensor_s {
+    uint16_t id;
+    uint8_t index;              // latitude or longitude, or the ESC an ESC sensor is sending
+    bool esc;
+    bool sent;
+    uint32_t lastValue;
+    timeDelta_t minIntervalUs;
+    timeDelta_t maxIntervalUs;
+} smartPortSensor_t;
+
+static smartPortSensor_t smartPortSensors[MAX_SENSORS];
+static uint8_t smartPortSensorCount;
+static telemetryScheduler_t smartPortScheduler;
 
 #define SMARTPORT_BAUD 57600
 #define SMARTPORT_UART_MODE MODE_RXTX
@@ -317,21 +325,36 @@ static void smartPortSendPackage(uint16_t id, uint32_t val)
     smartPortWriteFrame(&payload);
 }
 
-#define ADD_SENSOR(dataId) frSkyDataIdTableInfo.table[frSkyDataIdTableInfo.index++] = dataId
-#define ADD_ESC_SENSOR(dataId) frSkyEscDataIdTableInfo.table[frSkyEscDataIdTableInfo.index++] = dataId
+static void addSensor(uint16_t id, uint8_t index, bool esc, uint8_t priority, uint16_t minIntervalMs, uint16_t maxIntervalMs)
+{
+    smartPortSensor_t *sensor = &smartPortSensors[smartPortSensorCount++];
+    sensor->id = id;
+    sensor->index = index;
+    sensor->esc = esc;
+    sensor->sent = false;
+    sensor->minIntervalUs = minIntervalMs * 1000;
+    sensor->maxIntervalUs = maxIntervalMs * 1000;
+
+    telemetrySchedulerAdd(&smartPortScheduler, sensor->minIntervalUs, priority, 1);
+}
+
+// the priority, and the intervals in ms the sensor is sent at while its value changes and when it doesn't
+#define ADD_SENSOR(dataId, priority, minIntervalMs, maxIntervalMs) addSensor(dataId, 0, false, priority, minIntervalMs, maxIntervalMs)
+#define ADD_ESC_SENSOR(dataId) addSensor(dataId, 0, true, 1, 100, 1000)
 
 static void initSmartPortSensors(void)
 {
-    frSkyDataIdTableInfo.index = 0;
+    smartPortSensorCount = 0;
+    telemetrySchedulerInit(&smartPortScheduler, 0);
 
     if (telemetryIsSensorEnabled(SENSOR_MODE)) {
-        ADD_SENSOR(FSSP_DATAID_T1);
-        ADD_SENSOR(FSSP_DATAID_T2);
+        ADD_SENSOR(FSSP_DATAID_T1, 3, 100, 1000);
+        ADD_SENSOR(FSSP_DATAID_T2, 1, 1000, 2000);
     }
 
 #if defined(USE_ADC_INTERNAL)
     if (telemetryIsSensorEnabled(SENSOR_TEMPERATURE)) {
-        ADD_SENSOR(FSSP_DATAID_T11);
+        ADD_SENSOR(FSSP_DATAID_T11, 1, 1000, 5000);
     }
 #endif
 
@@ -340,10 +363,10 @@ static void initSmartPortSensors(void)
         if (!telemetryIsSensorEnabled(ESC_SENSOR_VOLTAGE))
 #endif
         {
-            ADD_SENSOR(FSSP_DATAID_VFAS);
+            ADD_SENSOR(FSSP_DATAID_VFAS, 3, 200, 1000);
         }
 
-        ADD_SENSOR(FSSP_DATAID_A4);
+        ADD_SENSOR(FSSP_DATAID_A4, 2, 200, 1000);
     }
 
     if (isAmperageConfigured() && telemetryIsSensorEnabled(SENSOR_CURRENT)) {
@@ -351,65 +374,61 @@ static void initSmartPortSensors(void)
         if (!telemetryIsSensorEnabled(ESC_SENSOR_CURRENT))
 #endif
         {
-            ADD_SENSOR(FSSP_DATAID_CURRENT);
+            ADD_SENSOR(FSSP_DATAID_CURRENT, 3, 200, 1000);
         }
 
         if (telemetryIsSensorEnabled(SENSOR_FUEL)) {
-            ADD_SENSOR(FSSP_DATAID_FUEL);
+            ADD_SENSOR(FSSP_DATAID_FUEL, 2, 500, 2000);
         }
     }
 
     if (telemetryIsSensorEnabled(SENSOR_HEADING)) {
-        ADD_SENSOR(FSSP_DATAID_HEADING);
+        ADD_SENSOR(FSSP_DATAID_HEADING, 2, 100, 1000);
     }
 
 #if defined(USE_ACC)
     if (sensors(SENSOR_ACC)) {
         if (telemetryIsSensorEnabled(SENSOR_ACC_X)) {
-            ADD_SENSOR(FSSP_DATAID_ACCX);
+            ADD_SENSOR(FSSP_DATAID_ACCX, 1, 100, 1000);
         }
         if (telemetryIsSensorEnabled(SENSOR_ACC_Y)) {
-            ADD_SENSOR(FSSP_DATAID_ACCY);
+            ADD_SENSOR(FSSP_DATAID_ACCY, 1, 100, 1000);
         }
         if (telemetryIsSensorEnabled(SENSOR_ACC_Z)) {
-            ADD_SENSOR(FSSP_DATAID_ACCZ);
+            ADD_SENSOR(FSSP_DATAID_ACCZ, 1, 100, 1000);
         }
     }
 #endif
 
     if (sensors(SENSOR_BARO)) {
         if (telemetryIsSensorEnabled(SENSOR_ALTITUDE)) {
-            ADD_SENSOR(FSSP_DATAID_ALTITUDE);
+            ADD_SENSOR(FSSP_DATAID_ALTITUDE, 3, 100, 1000);
         }
         if (telemetryIsSensorEnabled(SENSOR_VARIO)) {
-            ADD_SENSOR(FSSP_DATAID_VARIO);
+            ADD_SENSOR(FSSP_DATAID_VARIO, 4, 100, 1000);
         }
     }
 
 #ifdef USE_GPS
     if (featureIsEnabled(FEATURE_GPS)) {
         if (telemetryIsSensorEnabled(SENSOR_GROUND_SPEED)) {
-            ADD_SENSOR(FSSP_DATAID_SPEED);
+            ADD_SENSOR(FSSP_DATAID_SPEED, 2, 200, 2000);
         }
         if (telemetryIsSensorEnabled(SENSOR_LAT_LONG)) {
-            ADD_SENSOR(FSSP_DATAID_LATLONG);
-            ADD_SENSOR(FSSP_DATAID_LATLONG); // twice (one for lat, one for long)
+            // twice (one for lat, one for long)
+            addSensor(FSSP_DATAID_LATLONG, 0, false, 2, 200, 2000);
+            addSensor(FSSP_DATAID_LATLONG, 1, false, 2, 200, 2000);
         }
         if (telemetryIsSensorEnabled(SENSOR_DISTANCE)) {
-            ADD_SENSOR(FSSP_DATAID_HOME_DIST);
+            ADD_SENSOR(FSSP_DATAID_HOME_DIST, 2, 200, 2000);
         }
         if (telemetryIsSensorEnabled(SENSOR_ALTITUDE)) {
-            ADD_SENSOR(FSSP_DATAID_GPS_ALT);
+            ADD_SENSOR(FSSP_DATAID_GPS_ALT, 1, 500, 2000);
         }
     }
 #endif
 
-    frSkyDataIdTableInfo.size = frSkyDataIdTableInfo.index;
-    frSkyDataIdTableInfo.index = 0;
-
 #ifdef USE_ESC_SENSOR_TELEMETRY
-    frSkyEscDataIdTableInfo.index = 0;
-
     if (telemetryIsSensorEnabled(ESC_SENSOR_VOLTAGE)) {
         ADD_ESC_SENSOR(FSSP_DATAID_VFAS);
     }
@@ -422,9 +441,6 @@ static void initSmartPortSensors(void)
     if (telemetryIsSensorEnabled(ESC_SENSOR_TEMPERATURE)) {
         ADD_ESC_SENSOR(FSSP_DATAID_TEMP);
     }
-
-    frSkyEscDataIdTableInfo.size = frSkyEscDataIdTableInfo.index;
-    frSkyEscDataIdTableInfo.index = 0;
 #endif
 }
 
@@ -501,16 +517,314 @@ static void smartPortSendMspResponse(uint8_t *data) {
 }
 #endif
 
-void processSmartPortTelemetry(smartPortPayload_t *payload, volatile bool *clearToSend, const timeUs_t *requestTimeout)
+static bool smartPortSendsPidValues(void)
+{
+#ifdef USE_GPS
+    if (sensors(SENSOR_GPS) || featureIsEnabled(FEATURE_GPS)) {
+        return false;
+    }
+#endif
+    return telemetryConfig()->pidValuesAsTelemetry;
+}
+
+static uint16_t smartPortSensorId(const smartPortSensor_t *sensor)
+{
+    return sensor->esc ? sensor->id + sensor->index : sensor->id;
+}
+
+/*
+ * Gets the current value of a sensor, returns false if it has nothing to send. The rolling counters
+ * of T1 and T2 are left out, so that the value only changes when what it reports does.
+ */
+static bool smartPortSensorValue(const smartPortSensor_t *sensor, uint32_t *value)
+{
+    const uint16_t id = smartPortSensorId(sensor);
+
+    int32_t tmpi;
+    uint16_t vfasVoltage;
+    uint8_t cellCount;
+
+#ifdef USE_ESC_SENSOR_TELEMETRY
+    escSensorData_t *escData;
+#endif
+
+    switch (id) {
+        case FSSP_DATAID_VFAS       :
+            vfasVoltage = getBatteryVoltage();
+            if (telemetryConfig()->report_cell_voltage) {
+                cellCount = getBatteryCellCount();
+                vfasVoltage = cellCount ? getBatteryVoltage() / cellCount : 0;
+            }
+            *value = vfasVoltage; // given in 0.01V, convert to volts
+            return true;
+#ifdef USE_ESC_SENSOR_TELEMETRY
+        case FSSP_DATAID_VFAS1      :
+        case FSSP_DATAID_VFAS2      :
+        case FSSP_DATAID_VFAS3      :
+        case FSSP_DATAID_VFAS4      :
+        case FSSP_DATAID_VFAS5      :
+        case FSSP_DATAID_VFAS6      :
+        case FSSP_DATAID_VFAS7      :
+        case FSSP_DATAID_VFAS8      :
+            escData = getEscSensorData(id - FSSP_DATAID_VFAS1);
+            if (escData != NULL) {
+                *value = escData->voltage;
+                return true;
+            }
+            return false;
+#endif
+        case FSSP_DATAID_CURRENT    :
+            *value = getAmperage() / 10; // given in 10mA steps, unknown requested unit
+            return true;
+#ifdef USE_ESC_SENSOR_TELEMETRY
+        case FSSP_DATAID_CURRENT1   :
+        case FSSP_DATAID_CURRENT2   :
+        case FSSP_DATAID_CURRENT3   :
+        case FSSP_DATAID_CURRENT4   :
+        case FSSP_DATAID_CURRENT5   :
+        case FSSP_DATAID_CURRENT6   :
+        case FSSP_DATAID_CURRENT7   :
+        case FSSP_DATAID_CURRENT8   :
+            escData = getEscSensorData(id - FSSP_DATAID_CURRENT1);
+            if (escData != NULL) {
+                *value = escData->current;
+                return true;
+            }
+            return false;
+        case FSSP_DATAID_RPM        :
+            escData = getEscSensorData(ESC_SENSOR_COMBINED);
+            if (escData != NULL) {
+                *value = calcEscRpm(escData->rpm);
+                return true;
+            }
+            return false;
+        case FSSP_DATAID_RPM1       :
+        case FSSP_DATAID_RPM2       :
+        case FSSP_DATAID_RPM3       :
+        case FSSP_DATAID_RPM4       :
+        case FSSP_DATAID_RPM5       :
+        case FSSP_DATAID_RPM6       :
+        case FSSP_DATAID_RPM7       :
+        case FSSP_DATAID_RPM8       :
+            escData = getEscSensorData(id - FSSP_DATAID_RPM1);
+            if (escData != NULL) {
+                *value = calcEscRpm(escData->rpm);
+                return true;
+            }
+            return false;
+        case FSSP_DATAID_TEMP        :
+            escData = getEscSensorData(ESC_SENSOR_COMBINED);
+            if (escData != NULL) {
+                *value = escData->temperature;
+                return true;
+            }
+            return false;
+        case FSSP_DATAID_TEMP1      :
+        case FSSP_DATAID_TEMP2      :
+        case FSSP_DATAID_TEMP3      :
+        case FSSP_DATAID_TEMP4      :
+        case FSSP_DATAID_TEMP5      :
+        case FSSP_DATAID_TEMP6      :
+        case FSSP_DATAID_TEMP7      :
+        case FSSP_DATAID_TEMP8      :
+            escData = getEscSensorData(id - FSSP_DATAID_TEMP1);
+            if (escData != NULL) {
+                *value = escData->temperature;
+                return true;
+            }
+            return false;
+#endif
+        case FSSP_DATAID_ALTITUDE   :
+            *value = getEstimatedAltitudeCm(); // unknown given unit, requested 100 = 1 meter
+            return true;
+        case FSSP_DATAID_FUEL       :
+            *value = getMAhDrawn(); // given in mAh, unknown requested unit
+            return true;
+        case FSSP_DATAID_VARIO      :
+            *value = getEstimatedVario(); // unknown given unit but requested in 100 = 1m/s
+            return true;
+        case FSSP_DATAID_HEADING    :
+            *value = attitude.values.yaw * 10; // given in 10*deg, requested in 10000 = 100 deg
+            return true;
+#if defined(USE_ACC)
+        case FSSP_DATAID_ACCX       :
+            *value = lrintf(100 * acc.accADC[X] * acc.dev.acc_1G_rec); // Multiply by 100 to show as x.xx g on Taranis
+            return true;
+        case FSSP_DATAID_ACCY       :
+            *value = lrintf(100 * acc.accADC[Y] * acc.dev.acc_1G_rec);
+            return true;
+        case FSSP_DATAID_ACCZ       :
+            *value = lrintf(100 * acc.accADC[Z] * acc.dev.acc_1G_rec);
+            return true;
+#endif
+        case FSSP_DATAID_T1         :
+            // we send all the flags as decimal digits for easy reading
+            // the Taranis seems to be able to fit 5 digits on the screen
+            // the Taranis seems to consider this number a signed 16 bit integer
+            tmpi = 0;
+
+            if (!isArmingDisabled()) {
+                tmpi += 1;
+            } else {
+                tmpi += 2;
+            }
+            if (ARMING_FLAG(ARMED)) {
+                tmpi += 4;
+            }
+
+            if (FLIGHT_MODE(ANGLE_MODE)) {
+                tmpi += 10;
+            }
+            if (FLIGHT_MODE(HORIZON_MODE)) {
+                tmpi += 20;
+            }
+            if (FLIGHT_MODE(PASSTHRU_MODE)) {
+                tmpi += 40;
+            }
+
+            if (FLIGHT_MODE(MAG_MODE)) {
+                tmpi += 100;
+            }
+
+            if (FLIGHT_MODE(HEADFREE_MODE)) {
+                tmpi += 4000;
+            }
+
+            *value = (uint32_t)tmpi;
+            return true;
+        case FSSP_DATAID_T2         :
+#ifdef USE_GPS
+            if (sensors(SENSOR_GPS)) {
+                // provide GPS lock status
+                *value = (STATE(GPS_FIX) ? 1000 : 0) + (STATE(GPS_FIX_HOME) ? 2000 : 0) + gpsSol.numSat;
+                return true;
+            } else if (featureIsEnabled(FEATURE_GPS)) {
+                *value = 0;
+                return true;
+            }
+#endif
+            // the PID values are filled in when sent
+            *value = 0;
+            return smartPortSendsPidValues();
+#if defined(USE_ADC_INTERNAL)
+        case FSSP_DATAID_T11        :
+            *value = getCoreTemperatureCelsius();
+            return true;
+#endif
+#ifdef USE_GPS
+        case FSSP_DATAID_SPEED      :
+            if (STATE(GPS_FIX)) {
+                //convert to knots: 1cm/s = 0.0194384449 knots
+                //Speed should be sent in knots/1000 (GPS speed is in cm/s)
+                *value = gpsSol.groundSpeed * 1944 / 100;
+                return true;
+            }
+            return false;
+        case FSSP_DATAID_LATLONG    :
+            if (STATE(GPS_FIX)) {
+                uint32_t tmpui = 0;
+                // the same ID is sent twice, one for longitude, one for latitude
+                // the MSB of the sent uint32_t helps FrSky keep track
+                if (sensor->index & 1) {
+                    tmpui = abs(gpsSol.llh.lon);  // now we have unsigned value and one bit to spare
+                    tmpui = (tmpui + tmpui / 2) / 25 | 0x80000000;  // 6/100 = 1.5/25, division by power of 2 is fast
+                    if (gpsSol.llh.lon < 0) tmpui |= 0x40000000;
+                }
+                else {
+                    tmpui = abs(gpsSol.llh.lat);  // now we have unsigned value and one bit to spare
+                    tmpui = (tmpui + tmpui / 2) / 25;  // 6/100 = 1.5/25, division by power of 2 is fast
+                    if (gpsSol.llh.lat < 0) tmpui |= 0x40000000;
+                }
+                *value = tmpui;
+                return true;
+            }
+            return false;
+        case FSSP_DATAID_HOME_DIST  :
+            if (STATE(GPS_FIX)) {
+                *value = GPS_distanceToHome;
+                return true;
+            }
+            return false;
+        case FSSP_DATAID_GPS_ALT    :
+            if (STATE(GPS_FIX)) {
+                *value = gpsSol.llh.altCm; // given in 0.01m
+                return true;
+            }
+            return false;
+#endif
+        case FSSP_DATAID_A4         :
+            cellCount = getBatteryCellCount();
+            *value = cellCount ? (getBatteryVoltage() / cellCount) : 0; // given in 0.01V, convert to volts
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void smartPortSendSensor(smartPortSensor_t *sensor, uint32_t value)
 {
-    static uint8_t smartPortIdCycleCnt = 0;
     static uint8_t t1Cnt = 0;
     static uint8_t t2Cnt = 0;
-    static uint8_t skipRequests = 0;
+
+    sensor->lastValue = value;
+    sensor->sent = true;
+
+    const uint16_t id = smartPortSensorId(sensor);
+
+    if (id == FSSP_DATAID_T1) {
+        // the t1Cnt simply allows the telemetry view to show at least some changes
+        t1Cnt++;
+        if (t1Cnt == 4) {
+            t1Cnt = 1;
+        }
+        value += t1Cnt * 10000; // start off with at least one digit so the most significant 0 won't be cut off
+    } else if (id == FSSP_DATAID_T2 && smartPortSendsPidValues()) {
+        switch (t2Cnt) {
+            case 0:
+                value = currentPidProfile->pid[PID_ROLL].P;
+                value += (currentPidProfile->pid[PID_PITCH].P<<8);
+                value += (currentPidProfile->pid[PID_YAW].P<<16);
+            break;
+            case 1:
+                value = currentPidProfile->pid[PID_ROLL].I;
+                value += (currentPidProfile->pid[PID_PITCH].I<<8);
+                value += (currentPidProfile->pid[PID_YAW].I<<16);
+            break;
+            case 2:
+                value = currentPidProfile->pid[PID_ROLL].D;
+                value += (currentPidProfile->pid[PID_PITCH].D<<8);
+                value += (currentPidProfile->pid[PID_YAW].D<<16);
+            break;
+            case 3:
+                value = currentControlRateProfile->rates[FD_ROLL];
+                value += (currentControlRateProfile->rates[FD_PITCH]<<8);
+                value += (currentControlRateProfile->rates[FD_YAW]<<16);
+            break;
+        }
+        value += t2Cnt<<24;
+        t2Cnt++;
+        if (t2Cnt == 4) {
+            t2Cnt = 0;
+        }
+    }
+
+    smartPortSendPackage(id, value);
+}
+
 #ifdef USE_ESC_SENSOR_TELEMETRY
-    static uint8_t smartPortIdOffset = 0;
+static void smartPortNextEsc(smartPortSensor_t *sensor)
+{
+    sensor->index++;
+    if (sensor->index == getMotorCount() + 1) { // each motor and ESC_SENSOR_COMBINED
+        sensor->index = 0;
+    }
+}
 #endif
 
+void processSmartPortTelemetry(smartPortPayload_t *payload, volatile bool *clearToSend, const timeUs_t *requestTimeout)
+{
+    static uint8_t skipRequests = 0;
+
 #if defined(USE_MSP_OVER_TELEMETRY)
     if (skipRequests) {
         skipRequests--;
@@ -533,336 +847,65 @@ void processSmartPortTelemetry(smartPortPayload_t *payload, volatile bool *clear
     UNUSED(payload);
 #endif
 
-    bool doRun = true;
-    while (doRun && *clearToSend && !skipRequests) {
-        // Ensure we won't get stuck in the loop if there happens to be nothing available to send in a timely manner - dump the slot if we loop in there for too long.
-        if (requestTimeout) {
-            if (cmpTimeUs(micros(), *requestTimeout) >= 0) {
-                *clearToSend = false;
+    if (!*clearToSend || skipRequests) {
+        return;
+    }
 
-                return;
-            }
-        } else {
-            doRun = false;
-        }
+    const timeUs_t currentTimeUs = micros();
 
-#if defined(USE_MSP_OVER_TELEMETRY)
-        if (smartPortMspReplyPending) {
-            smartPortMspReplyPending = sendMspReply(SMARTPORT_MSP_PAYLOAD_SIZE, &smartPortSendMspResponse);
-            *clearToSend = false;
+    // Don't answer a slot we have taken too long to get to
+    if (requestTimeout && cmpTimeUs(currentTimeUs, *requestTimeout) >= 0) {
+        *clearToSend = false;
 
-            return;
-        }
-#endif
+        return;
+    }
 
-        // we can send back any data we want, our tables keep track of the order and frequency of each data type we send
-        frSkyTableInfo_t * tableInfo = &frSkyDataIdTableInfo;
+#if defined(USE_MSP_OVER_TELEMETRY)
+    if (smartPortMspReplyPending) {
+        smartPortMspReplyPending = sendMspReply(SMARTPORT_MSP_PAYLOAD_SIZE, &smartPortSendMspResponse);
+        *clearToSend = false;
 
-#ifdef USE_ESC_SENSOR_TELEMETRY
-        if (smartPortIdCycleCnt >= ESC_SENSOR_PERIOD) {
-            // send ESC sensors
-            tableInfo = &frSkyEscDataIdTableInfo;
-            if (tableInfo->index == tableInfo->size) { // end of ESC table, return to other sensors
-                tableInfo->index = 0;
-                smartPortIdCycleCnt = 0;
-                smartPortIdOffset++;
-                if (smartPortIdOffset == getMotorCount() + 1) { // each motor and ESC_SENSOR_COMBINED
-                    smartPortIdOffset = 0;
-                }
-            }
-        }
-        if (smartPortIdCycleCnt < ESC_SENSOR_PERIOD) {
-            // send other sensors
-            tableInfo = &frSkyDataIdTableInfo;
+        return;
+    }
 #endif
-            if (tableInfo->index == tableInfo->size) { // end of table reached, loop back
-                tableInfo->index = 0;
-            }
-#ifdef USE_ESC_SENSOR_TELEMETRY
+
+    // only the sensors past their min interval can be sent, the others aren't worth reading yet
+    uint32_t values[MAX_SENSORS];
+    for (int i = 0; i < smartPortSensorCount; i++) {
+        smartPortSensor_t *sensor = &smartPortSensors[i];
+        if (!telemetrySchedulerCouldBeDue(&smartPortScheduler, i, currentTimeUs, sensor->minIntervalUs)) {
+            continue;
         }
-#endif
-        uint16_t id = tableInfo->table[tableInfo->index];
+
+        const bool available = smartPortSensorValue(sensor, &values[i]);
 #ifdef USE_ESC_SENSOR_TELEMETRY
-        if (smartPortIdCycleCnt >= ESC_SENSOR_PERIOD) {
-            id += smartPortIdOffset;
+        if (sensor->esc && !available) {
+            // try the next ESC next time
+            smartPortNextEsc(sensor);
         }
 #endif
-        smartPortIdCycleCnt++;
-        tableInfo->index++;
+        telemetrySchedulerEnable(&smartPortScheduler, i, available);
 
-        int32_t tmpi;
-        uint32_t tmp2 = 0;
-        uint16_t vfasVoltage;
-        uint8_t cellCount;
+        // ESC sensors move on to the next ESC every time they are sent, so they always count as changed
+        const bool changed = !sensor->sent || sensor->esc || values[i] != sensor->lastValue;
+        telemetrySchedulerSetInterval(&smartPortScheduler, i, changed ? sensor->minIntervalUs : sensor->maxIntervalUs);
+    }
 
-#ifdef USE_ESC_SENSOR_TELEMETRY
-        escSensorData_t *escData;
-#endif
+    const int next = telemetrySchedulerNext(&smartPortScheduler, currentTimeUs, 1);
+    if (next == TELEMETRY_SCHEDULER_NONE) {
+        // nothing has changed or is due, leave the slot empty
+        return;
+    }
 
-        switch (id) {
-            case FSSP_DATAID_VFAS       :
-                vfasVoltage = getBatteryVoltage();
-                if (telemetryConfig()->report_cell_voltage) {
-                    cellCount = getBatteryCellCount();
-                    vfasVoltage = cellCount ? getBatteryVoltage() / cellCount : 0;
-                }
-                smartPortSendPackage(id, vfasVoltage); // given in 0.01V, convert to volts
-                *clearToSend = false;
-                break;
+    smartPortSensor_t *sensor = &smartPortSensors[next];
+    smartPortSendSensor(sensor, values[next]);
+    telemetrySchedulerSent(&smartPortScheduler, next, 1, currentTimeUs);
 #ifdef USE_ESC_SENSOR_TELEMETRY
-            case FSSP_DATAID_VFAS1      :
-            case FSSP_DATAID_VFAS2      :
-            case FSSP_DATAID_VFAS3      :
-            case FSSP_DATAID_VFAS4      :
-            case FSSP_DATAID_VFAS5      :
-            case FSSP_DATAID_VFAS6      :
-            case FSSP_DATAID_VFAS7      :
-            case FSSP_DATAID_VFAS8      :
-                escData = getEscSensorData(id - FSSP_DATAID_VFAS1);
-                if (escData != NULL) {
-                    smartPortSendPackage(id, escData->voltage);
-                    *clearToSend = false;
-                }
-                break;
-#endif
-            case FSSP_DATAID_CURRENT    :
-                smartPortSendPackage(id, getAmperage() / 10); // given in 10mA steps, unknown requested unit
-                *clearToSend = false;
-                break;
-#ifdef USE_ESC_SENSOR_TELEMETRY
-            case FSSP_DATAID_CURRENT1   :
-            case FSSP_DATAID_CURRENT2   :
-            case FSSP_DATAID_CURRENT3   :
-            case FSSP_DATAID_CURRENT4   :
-            case FSSP_DATAID_CURRENT5   :
-            case FSSP_DATAID_CURRENT6   :
-            case FSSP_DATAID_CURRENT7   :
-            case FSSP_DATAID_CURRENT8   :
-                escData = getEscSensorData(id - FSSP_DATAID_CURRENT1);
-                if (escData != NULL) {
-                    smartPortSendPackage(id, escData->current);
-                    *clearToSend = false;
-                }
-                break;
-            case FSSP_DATAID_RPM        :
-                escData = getEscSensorData(ESC_SENSOR_COMBINED);
-                if (escData != NULL) {
-                    smartPortSendPackage(id, calcEscRpm(escData->rpm));
-                    *clearToSend = false;
-                }
-                break;
-            case FSSP_DATAID_RPM1       :
-            case FSSP_DATAID_RPM2       :
-            case FSSP_DATAID_RPM3       :
-            case FSSP_DATAID_RPM4       :
-            case FSSP_DATAID_RPM5       :
-            case FSSP_DATAID_RPM6       :
-            case FSSP_DATAID_RPM7       :
-            case FSSP_DATAID_RPM8       :
-                escData = getEscSensorData(id - FSSP_DATAID_RPM1);
-                if (escData != NULL) {
-                    smartPortSendPackage(id, calcEscRpm(escData->rpm));
-                    *clearToSend = false;
-                }
-                break;
-            case FSSP_DATAID_TEMP        :
-                escData = getEscSensorData(ESC_SENSOR_COMBINED);
-                if (escData != NULL) {
-                    smartPortSendPackage(id, escData->temperature);
-                    *clearToSend = false;
-                }
-                break;
-            case FSSP_DATAID_TEMP1      :
-            case FSSP_DATAID_TEMP2      :
-            case FSSP_DATAID_TEMP3      :
-            case FSSP_DATAID_TEMP4      :
-            case FSSP_DATAID_TEMP5      :
-            case FSSP_DATAID_TEMP6      :
-            case FSSP_DATAID_TEMP7      :
-            case FSSP_DATAID_TEMP8      :
-                escData = getEscSensorData(id - FSSP_DATAID_TEMP1);
-                if (escData != NULL) {
-                    smartPortSendPackage(id, escData->temperature);
-                    *clearToSend = false;
-                }
-                break;
-#endif
-            case FSSP_DATAID_ALTITUDE   :
-                smartPortSendPackage(id, getEstimatedAltitudeCm()); // unknown given unit, requested 100 = 1 meter
-                *clearToSend = false;
-                break;
-            case FSSP_DATAID_FUEL       :
-                smartPortSendPackage(id, getMAhDrawn()); // given in mAh, unknown requested unit
-                *clearToSend = false;
-                break;
-            case FSSP_DATAID_VARIO      :
-                smartPortSendPackage(id, getEstimatedVario()); // unknown given unit but requested in 100 = 1m/s
-                *clearToSend = false;
-                break;
-            case FSSP_DATAID_HEADING    :
-                smartPortSendPackage(id, attitude.values.yaw * 10); // given in 10*deg, requested in 10000 = 100 deg
-                *clearToSend = false;
-                break;
-#if defined(USE_ACC)
-            case FSSP_DATAID_ACCX       :
-                smartPortSendPackage(id, lrintf(100 * acc.accADC[X] * acc.dev.acc_1G_rec)); // Multiply by 100 to show as x.xx g on Taranis
-                *clearToSend = false;
-                break;
-            case FSSP_DATAID_ACCY       :
-                smartPortSendPackage(id, lrintf(100 * acc.accADC[Y] * acc.dev.acc_1G_rec));
-                *clearToSend = false;
-                break;
-            case FSSP_DATAID_ACCZ       :
-                smartPortSendPackage(id, lrintf(100 * acc.accADC[Z] * acc.dev.acc_1G_rec));
-                *clearToSend = false;
-                break;
-#endif
-            case FSSP_DATAID_T1         :
-                // we send all the flags as decimal digits for easy reading
-
-                // the t1Cnt simply allows the telemetry view to show at least some changes
-                t1Cnt++;
-                if (t1Cnt == 4) {
-                    t1Cnt = 1;
-                }
-                tmpi = t1Cnt * 10000; // start off with at least one digit so the most significant 0 won't be cut off
-                // the Taranis seems to be able to fit 5 digits on the screen
-                // the Taranis seems to consider this number a signed 16 bit integer
-
-                if (!isArmingDisabled()) {
-                    tmpi += 1;
-                } else {
-                    tmpi += 2;
-                }
-                if (ARMING_FLAG(ARMED)) {
-                    tmpi += 4;
-                }
-
-                if (FLIGHT_MODE(ANGLE_MODE)) {
-                    tmpi += 10;
-                }
-                if (FLIGHT_MODE(HORIZON_MODE)) {
-                    tmpi += 20;
-                }
-                if (FLIGHT_MODE(PASSTHRU_MODE)) {
-                    tmpi += 40;
-                }
-
-                if (FLIGHT_MODE(MAG_MODE)) {
-                    tmpi += 100;
-                }
-
-                if (FLIGHT_MODE(HEADFREE_MODE)) {
-                    tmpi += 4000;
-                }
-
-                smartPortSendPackage(id, (uint32_t)tmpi);
-                *clearToSend = false;
-                break;
-            case FSSP_DATAID_T2         :
-#ifdef USE_GPS
-                if (sensors(SENSOR_GPS)) {
-                    // provide GPS lock status
-                    smartPortSendPackage(id, (STATE(GPS_FIX) ? 1000 : 0) + (STATE(GPS_FIX_HOME) ? 2000 : 0) + gpsSol.numSat);
-                    *clearToSend = false;
-                } else if (featureIsEnabled(FEATURE_GPS)) {
-                    smartPortSendPackage(id, 0);
-                    *clearToSend = false;
-                } else
-#endif
-                if (telemetryConfig()->pidValuesAsTelemetry) {
-                    switch (t2Cnt) {
-                        case 0:
-                            tmp2 = currentPidProfile->pid[PID_ROLL].P;
-                            tmp2 += (currentPidProfile->pid[PID_PITCH].P<<8);
-                            tmp2 += (currentPidProfile->pid[PID_YAW].P<<16);
-                        break;
-                        case 1:
-                            tmp2 = currentPidProfile->pid[PID_ROLL].I;
-                            tmp2 += (currentPidProfile->pid[PID_PITCH].I<<8);
-                            tmp2 += (currentPidProfile->pid[PID_YAW].I<<16);
-                        break;
-                        case 2:
-                            tmp2 = currentPidProfile->pid[PID_ROLL].D;
-                            tmp2 += (currentPidProfile->pid[PID_PITCH].D<<8);
-                            tmp2 += (currentPidProfile->pid[PID_YAW].D<<16);
-                        break;
-                        case 3:
-                            tmp2 = currentControlRateProfile->rates[FD_ROLL];
-                            tmp2 += (currentControlRateProfile->rates[FD_PITCH]<<8);
-                            tmp2 += (currentControlRateProfile->rates[FD_YAW]<<16);
-                        break;
-                    }
-                    tmp2 += t2Cnt<<24;
-                    t2Cnt++;
-                    if (t2Cnt == 4) {
-                        t2Cnt = 0;
-                    }
-                    smartPortSendPackage(id, tmp2);
-                    *clearToSend = false;
-                }
-
-                break;
-#if defined(USE_ADC_INTERNAL)
-            case FSSP_DATAID_T11        :
-                smartPortSendPackage(id, getCoreTemperatureCelsius());
-                *clearToSend = false;
-                break;
-#endif
-#ifdef USE_GPS
-            case FSSP_DATAID_SPEED      :
-                if (STATE(GPS_FIX)) {
-                    //convert to knots: 1cm/s = 0.0194384449 knots
-                    //Speed should be sent in knots/1000 (GPS speed is in cm/s)
-                    uint32_t tmpui = gpsSol.groundSpeed * 1944 / 100;
-                    smartPortSendPackage(id, tmpui);
-                    *clearToSend = false;
-                }
-                break;
-            case FSSP_DATAID_LATLONG    :
-                if (STATE(GPS_FIX)) {
-                    uint32_t tmpui = 0;
-                    // the same ID is sent twice, one for longitude, one for latitude
-                    // the MSB of the sent uint32_t helps FrSky keep track
-                    // the even/odd bit of our counter helps us keep track
-                    if (tableInfo->index & 1) {
-                        tmpui = abs(gpsSol.llh.lon);  // now we have unsigned value and one bit to spare
-                        tmpui = (tmpui + tmpui / 2) / 25 | 0x80000000;  // 6/100 = 1.5/25, division by power of 2 is fast
-                        if (gpsSol.llh.lon < 0) tmpui |= 0x40000000;
-                    }
-                    else {
-                        tmpui = abs(gpsSol.llh.lat);  // now we have unsigned value and one bit to spare
-                        tmpui = (tmpui + tmpui / 2) / 25;  // 6/100 = 1.5/25, division by power of 2 is fast
-                        if (gpsSol.llh.lat < 0) tmpui |= 0x40000000;
-                    }
-                    smartPortSendPackage(id, tmpui);
-                    *clearToSend = false;
-                }
-                break;
-            case FSSP_DATAID_HOME_DIST  :
-                if (STATE(GPS_FIX)) {
-                    smartPortSendPackage(id, GPS_distanceToHome);
-                     *clearToSend = false;
-                }
-                break;
-            case FSSP_DATAID_GPS_ALT    :
-                if (STATE(GPS_FIX)) {
-                    smartPortSendPackage(id, gpsSol.llh.altCm); // given in 0.01m
-                    *clearToSend = false;
-                }
-                break;
-#endif
-            case FSSP_DATAID_A4         :
-                cellCount = getBatteryCellCount();
-                vfasVoltage = cellCount ? (getBatteryVoltage() / cellCount) : 0; // given in 0.01V, convert to volts
-                smartPortSendPackage(id, vfasVoltage);
-                *clearToSend = false;
-                break;
-            default:
-                break;
-                // if nothing is sent, hasRequest isn't cleared, we already incremented the counter, just loop back to the start
-        }
+    if (sensor->esc) {
+        smartPortNextEsc(sensor);
     }
+#endif
+    *clearToSend = false;
 }
 
 static bool serialCheckQueueEmpty(void)
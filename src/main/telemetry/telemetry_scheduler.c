@@ -0,0 +1,187 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_TELEMETRY
+
+#include "common/maths.h"
+#include "common/time.h"
+
+#include "telemetry/telemetry_scheduler.h"
+
+// Keeps the age of items that haven't been sent for a long time clear of timer wrap
+#define TELEMETRY_SCHEDULER_MAX_AGE_INTERVALS 16
+
+void telemetrySchedulerInit(telemetryScheduler_t *scheduler, uint32_t budgetPerSecond)
+{
+    memset(scheduler, 0, sizeof(*scheduler));
+    scheduler->budgetPerSecond = budgetPerSecond;
+}
+
+void telemetrySchedulerSetBudget(telemetryScheduler_t *scheduler, uint32_t budgetPerSecond)
+{
+    scheduler->budgetPerSecond = budgetPerSecond;
+}
+
+int telemetrySchedulerAdd(telemetryScheduler_t *scheduler, timeDelta_t intervalUs, uint8_t priority, uint8_t cost)
+{
+    if (scheduler->itemCount >= TELEMETRY_SCHEDULER_MAX_ITEMS) {
+        return TELEMETRY_SCHEDULER_NONE;
+    }
+
+    telemetryScheduleItem_t *item = &scheduler->items[scheduler->itemCount];
+    item->lastSentUs = 0;
+    item->intervalUs = MAX(intervalUs, 1);
+    item->priority = MAX(priority, 1);
+    item->stride = item->intervalUs / item->priority;
+    item->pass = scheduler->virtualTime;
+    item->cost = cost;
+    item->enabled = true;
+
+    // allow a burst of the largest item, so that every item fits the credit eventually
+    scheduler->creditMax = MAX(scheduler->creditMax, cost);
+    scheduler->credit = scheduler->creditMax;
+
+    return scheduler->itemCount++;
+}
+
+void telemetrySchedulerEnable(telemetryScheduler_t *scheduler, int item, bool enabled)
+{
+    if (item >= 0 && item < scheduler->itemCount) {
+        scheduler->items[item].enabled = enabled;
+    }
+}
+
+// Changes how often an item is due, and with it the share of an overloaded link the item gets
+void telemetrySchedulerSetInterval(telemetryScheduler_t *scheduler, int item, timeDelta_t intervalUs)
+{
+    if (item >= 0 && item < scheduler->itemCount) {
+        telemetryScheduleItem_t *changedItem = &scheduler->items[item];
+        changedItem->intervalUs = MAX(intervalUs, 1);
+        changedItem->stride = changedItem->intervalUs / changedItem->priority;
+    }
+}
+
+// Whether an item would be due with the given interval, so that a protocol only updates the items it could send
+bool telemetrySchedulerCouldBeDue(const telemetryScheduler_t *scheduler, int item, timeUs_t currentTimeUs, timeDelta_t intervalUs)
+{
+    if (item < 0 || item >= scheduler->itemCount) {
+        return false;
+    }
+
+    // an age that has wrapped is due, as in telemetrySchedulerNext()
+    const timeDelta_t ageUs = cmpTimeUs(currentTimeUs, scheduler->items[item].lastSentUs);
+    return ageUs < 0 || ageUs >= intervalUs;
+}
+
+static void telemetrySchedulerUpdateCredit(telemetryScheduler_t *scheduler, timeUs_t currentTimeUs)
+{
+    const timeDelta_t elapsedUs = cmpTimeUs(currentTimeUs, scheduler->lastUpdateUs);
+    scheduler->lastUpdateUs = currentTimeUs;
+
+    if (scheduler->budgetPerSecond == 0) {
+        return;
+    }
+    if (elapsedUs > 0) {
+        scheduler->credit = MIN(scheduler->credit + elapsedUs * 1e-6f * scheduler->budgetPerSecond, scheduler->creditMax);
+    }
+}
+
+/*
+ * Returns the item to send now, or TELEMETRY_SCHEDULER_NONE.
+ *
+ * The items that are due share the link by stride scheduling. Every time an item is sent its pass
+ * advances by interval / priority and the due item with the lowest pass goes next, so an overloaded
+ * link is shared in proportion to priority / interval.
+ *
+ * If the chosen item doesn't fit the link credit or the tx buffer space nothing is sent, so that
+ * lower priority items can't keep a larger, more important one off the link.
+ */
+int telemetrySchedulerNext(telemetryScheduler_t *scheduler, timeUs_t currentTimeUs, int txSpace)
+{
+    telemetrySchedulerUpdateCredit(scheduler, currentTimeUs);
+
+    int next = TELEMETRY_SCHEDULER_NONE;
+    timeDelta_t nextPass = 0;
+
+    for (int i = 0; i < scheduler->itemCount; i++) {
+        telemetryScheduleItem_t *item = &scheduler->items[i];
+        if (!item->enabled) {
+            continue;
+        }
+
+        const timeDelta_t ageUs = cmpTimeUs(currentTimeUs, item->lastSentUs);
+        const timeDelta_t maxAgeUs = item->intervalUs * TELEMETRY_SCHEDULER_MAX_AGE_INTERVALS;
+        if (ageUs < 0 || ageUs > maxAgeUs) {
+            item->lastSentUs = currentTimeUs - maxAgeUs;
+        } else if (ageUs < item->intervalUs) {
+            continue;
+        }
+
+        // an item that has been idle joins at the current virtual time, rather than catching up
+        const timeDelta_t pass = MAX(cmpTimeUs(item->pass, scheduler->virtualTime), 0);
+        if (next == TELEMETRY_SCHEDULER_NONE || pass < nextPass) {
+            next = i;
+            nextPass = pass;
+        }
+    }
+
+    if (next != TELEMETRY_SCHEDULER_NONE) {
+        const int cost = scheduler->items[next].cost;
+        if (cost > txSpace || (scheduler->budgetPerSecond && cost > scheduler->credit)) {
+            return TELEMETRY_SCHEDULER_NONE;
+        }
+    }
+
+    return next;
+}
+
+// Records an item as sent, cost is what it actually took
+void telemetrySchedulerSent(telemetryScheduler_t *scheduler, int item, int cost, timeUs_t currentTimeUs)
+{
+    if (item >= 0 && item < scheduler->itemCount) {
+        telemetryScheduleItem_t *sentItem = &scheduler->items[item];
+        sentItem->lastSentUs = currentTimeUs;
+        if (cmpTimeUs(sentItem->pass, scheduler->virtualTime) > 0) {
+            scheduler->virtualTime = sentItem->pass;
+        } else {
+            sentItem->pass = scheduler->virtualTime;
+        }
+        sentItem->pass += sentItem->stride;
+    }
+    telemetrySchedulerCharge(scheduler, cost);
+}
+
+// Accounts for link use outside the schedule, eg replies to requests
+void telemetrySchedulerCharge(telemetryScheduler_t *scheduler, int cost)
+{
+    if (scheduler->budgetPerSecond) {
+        // going into debt holds the schedule back until the link has caught up
+        scheduler->credit = MAX(scheduler->credit - cost, -scheduler->creditMax);
+    }
+}
+
+#endif
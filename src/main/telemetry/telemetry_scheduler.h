@@ -0,0 +1,70 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/time.h"
+
+#define TELEMETRY_SCHEDULER_MAX_ITEMS 24    // SmartPort has the most, a sensor per item
+#define TELEMETRY_SCHEDULER_NONE      (-1)
+
+/*
+ * A telemetry schedule shared by the protocols.
+ *
+ * A protocol adds an item for every frame or sensor it sends, with the interval it would like
+ * the item sent at, a priority and the cost of sending it. The cost is in the unit of the link
+ * budget, eg bytes for a serial link or frames for a link with fixed telemetry slots.
+ *
+ * When the link can carry every item at its interval it does. When it can't, the items that are
+ * due share the link in proportion to priority / interval, so high value items keep more of it.
+ */
+typedef struct telemetryScheduleItem_s {
+    timeUs_t lastSentUs;
+    timeDelta_t intervalUs;
+    uint32_t pass;              // the virtual time the item is next entitled to the link
+    uint32_t stride;
+    uint8_t priority;
+    uint8_t cost;
+    bool enabled;
+} telemetryScheduleItem_t;
+
+typedef struct telemetryScheduler_s {
+    telemetryScheduleItem_t items[TELEMETRY_SCHEDULER_MAX_ITEMS];
+    uint8_t itemCount;
+    uint32_t budgetPerSecond;   // 0 when the link isn't the bottleneck
+    float credit;               // what the link can send right now
+    float creditMax;
+    timeUs_t lastUpdateUs;
+    uint32_t virtualTime;
+} telemetryScheduler_t;
+
+void telemetrySchedulerInit(telemetryScheduler_t *scheduler, uint32_t budgetPerSecond);
+void telemetrySchedulerSetBudget(telemetryScheduler_t *scheduler, uint32_t budgetPerSecond);
+int telemetrySchedulerAdd(telemetryScheduler_t *scheduler, timeDelta_t intervalUs, uint8_t priority, uint8_t cost);
+void telemetrySchedulerEnable(telemetryScheduler_t *scheduler, int item, bool enabled);
+void telemetrySchedulerSetInterval(telemetryScheduler_t *scheduler, int item, timeDelta_t intervalUs);
+bool telemetrySchedulerCouldBeDue(const telemetryScheduler_t *scheduler, int item, timeUs_t currentTimeUs, timeDelta_t intervalUs);
+int telemetrySchedulerNext(telemetryScheduler_t *scheduler, timeUs_t currentTimeUs, int txSpace);
+void telemetrySchedulerSent(telemetryScheduler_t *scheduler, int item, int cost, timeUs_t currentTimeUs);
+void telemetrySchedulerCharge(telemetryScheduler_t *scheduler, int cost);
@@ -47,8 +47,12 @@
 
 /* Includes ------------------------------------------------------------------*/
 
+#include <string.h>
+
 #include "platform.h"
 
+#include "common/maths.h"
+
 #include "drivers/serial_usb_vcp.h"
 #include "drivers/time.h"
 
@@ -400,15 +404,21 @@ uint32_t CDC_Send_FreeBytes(void)
  */
 uint32_t CDC_Send_DATA(const uint8_t *ptrBuffer, uint32_t sendLength)
 {
-    for (uint32_t i = 0; i < sendLength; i++) {
-        while (CDC_Send_FreeBytes() == 0) {
+    uint32_t sent = 0;
+    while (sent < sendLength) {
+        uint32_t freeBytes;
+        while ((freeBytes = CDC_Send_FreeBytes()) == 0) {
             // block until there is free space in the ring buffer
             delay(1);
         }
+        // copy as much as fits before the ring buffer wraps in one go, the timer only
+        // reads up to UserTxBufPtrIn so the bytes can be copied before publishing them
+        const uint32_t chunk = MIN(MIN(sendLength - sent, freeBytes), APP_TX_DATA_SIZE - UserTxBufPtrIn);
+        memcpy((uint8_t *)&UserTxBuffer[UserTxBufPtrIn], &ptrBuffer[sent], chunk);
         ATOMIC_BLOCK(NVIC_BUILD_PRIORITY(6, 0)) { // Paranoia
-            UserTxBuffer[UserTxBufPtrIn] = ptrBuffer[i];
-            UserTxBufPtrIn = (UserTxBufPtrIn + 1) % APP_TX_DATA_SIZE;
+            UserTxBufPtrIn = (UserTxBufPtrIn + chunk) % APP_TX_DATA_SIZE;
         }
+        sent += chunk;
     }
     return sendLength;
 }
@@ -21,8 +21,12 @@
 
 /* Includes ------------------------------------------------------------------*/
 
+#include <string.h>
+
 #include "platform.h"
 
+#include "common/maths.h"
+
 #include "usbd_cdc_vcp.h"
 #include "stm32f4xx_conf.h"
 #include "stdbool.h"
@@ -36,7 +40,6 @@ __ALIGN_BEGIN USB_OTG_CORE_HANDLE USB_OTG_dev __ALIGN_END;
 
 LINE_CODING g_lc;
 
-extern __IO uint8_t USB_Tx_State;
 __IO uint32_t bDeviceState = UNCONNECTED; /* USB device status */
 
 /* These are external variables imported from CDC core to be used for IN transfer management. */
@@ -207,19 +210,23 @@ uint32_t CDC_Send_FreeBytes(void)
 static uint16_t VCP_DataTx(const uint8_t* Buf, uint32_t Len)
 {
     /*
-        make sure that any paragraph end frame is not in play
-        could just check for: USB_CDC_ZLP, but better to be safe
-        and wait for any existing transmission to complete.
+        The core only sends up to the APP_Rx_ptr_in it saw when it started a
+        transfer, so bytes can be queued while one (or its ZLP) is in play,
+        rather than waiting for the previous transfer to complete on every call.
     */
-    while (USB_Tx_State != 0);
-
-    for (uint32_t i = 0; i < Len; i++) {
-        APP_Rx_Buffer[APP_Rx_ptr_in] = Buf[i];
-        APP_Rx_ptr_in = (APP_Rx_ptr_in + 1) % APP_RX_DATA_SIZE;
-
-        while (CDC_Send_FreeBytes() == 0) {
+    uint32_t sent = 0;
+    while (sent < Len) {
+        uint32_t freeBytes;
+        while ((freeBytes = CDC_Send_FreeBytes()) == 0) {
             delay(1);
         }
+
+        // copy as much as fits before the ring buffer wraps in one go
+        const uint32_t chunk = MIN(MIN(Len - sent, freeBytes), APP_RX_DATA_SIZE - APP_Rx_ptr_in);
+        memcpy(&APP_Rx_Buffer[APP_Rx_ptr_in], &Buf[sent], chunk);
+        __DMB(); // the bytes must land before the SOF handler can see them
+        APP_Rx_ptr_in = (APP_Rx_ptr_in + chunk) % APP_RX_DATA_SIZE;
+        sent += chunk;
     }
 
     return USBD_OK;
@@ -48,7 +48,7 @@
 #define CDC_DATA_MAX_PACKET_SIZE       512  /* Endpoint IN & OUT Packet size */
 #define CDC_CMD_PACKET_SZE             8    /* Control Endpoint Packet size */
 
-#define CDC_IN_FRAME_INTERVAL          40   /* Number of micro-frames between IN transfers */
+#define CDC_IN_FRAME_INTERVAL          7    /* Number of micro-frames skipped between IN transfers, 7 is every 1 ms */
 #define APP_RX_DATA_SIZE               2048 /* Total size of IN buffer:
                                                 APP_RX_DATA_SIZE*8/MAX_BAUDARATE*1000 should be > CDC_IN_FRAME_INTERVAL*8 */
 #define APP_TX_DATA_SIZE               2048  /* total size of the OUT (inbound to FC) buffer */
@@ -56,7 +56,7 @@
 #define CDC_DATA_MAX_PACKET_SIZE       64   /* Endpoint IN & OUT Packet size */
 #define CDC_CMD_PACKET_SZE             8    /* Control Endpoint Packet size */
 
-#define CDC_IN_FRAME_INTERVAL          15    /* Number of frames between IN transfers */
+#define CDC_IN_FRAME_INTERVAL          0     /* Number of frames skipped between IN transfers, 0 is every SOF (1 ms) */
 #define APP_RX_DATA_SIZE               2048  /* Total size of IN (outbound from FC) buffer:
                                                  APP_RX_DATA_SIZE*8/MAX_BAUDARATE*1000 should be > CDC_IN_FRAME_INTERVAL */
 #define APP_TX_DATA_SIZE               2048  /* total size of the OUT (inbound to FC) buffer */
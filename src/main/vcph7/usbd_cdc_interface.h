@@ -64,8 +64,9 @@
 #define TIMx_CLK_ENABLE                  __HAL_RCC_TIM7_CLK_ENABLE
 
 /* Periodically, the state of the buffer "UserTxBuffer" is checked.
-   The period depends on CDC_POLLING_INTERVAL */
-#define CDC_POLLING_INTERVAL             5 /* in ms. The max is 65 and the min is 1 */
+   The period depends on CDC_POLLING_INTERVAL, and a block of up to
+   APP_TX_BLOCK_SIZE is sent each period, so it also bounds the throughput */
+#define CDC_POLLING_INTERVAL             1 /* in ms. The max is 65 and the min is 1 */
 
 /* Exported typef ------------------------------------------------------------*/
 /* The following structures groups all needed parameters to be configured for the
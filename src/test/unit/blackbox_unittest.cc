@@ -21,6 +21,7 @@ extern "C" {
     #include "platform.h"
 
     #include "blackbox/blackbox.h"
+    #include "common/maths.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -48,6 +49,7 @@ extern "C" {
 
     extern int16_t blackboxIInterval;
     extern int16_t blackboxPInterval;
+    extern pidProfile_t *currentPidProfile;
 }
 
 #include "unittest_macros.h"
@@ -346,6 +348,123 @@ TEST(BlackboxTest, Test_CalculateRates)
 
 }
 
+#define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
+
+// A serial port which sends a fixed number of bytes per loop iteration
+#define TEST_TX_BUFFER_SIZE 256
+static serialPort_t serialTestInstance;
+static serialPortConfig_t serialTestInstanceConfig;
+static uint8_t serialTestOutput[256 * 1024];
+static int serialTestOutputLength;
+static uint32_t serialTestTxUsed;
+static int serialTestOverruns;
+static uint32_t testMillis;
+static void (*serialTestCtrlLineStateCb)(void *context, uint16_t ctrlLineState);
+
+static void resetSerialTestPort(void)
+{
+    memset(&serialTestInstance, 0, sizeof(serialTestInstance));
+    serialTestInstance.txBufferSize = TEST_TX_BUFFER_SIZE;
+    serialTestInstanceConfig.identifier = SERIAL_PORT_USART1;
+    serialTestInstanceConfig.blackbox_baudrateIndex = BAUD_115200;
+    serialTestOutputLength = 0;
+    serialTestTxUsed = 0;
+    serialTestOverruns = 0;
+    serialTestCtrlLineStateCb = NULL;
+}
+
+static void runStream(int iterations, int bytesSentPerIteration)
+{
+    for (int i = 0; i < iterations; i++) {
+        testMillis++;
+        blackboxUpdate(testMillis * 1000);
+        serialTestTxUsed -= MIN(serialTestTxUsed, (uint32_t)bytesSentPerIteration);
+    }
+}
+
+static int countOutput(const char *pattern, int length)
+{
+    int count = 0;
+    for (int i = 0; i + length <= serialTestOutputLength; i++) {
+        if (memcmp(&serialTestOutput[i], pattern, length) == 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static const char loggingResumeEvent[] = { 'E', FLIGHT_LOG_EVENT_LOGGING_RESUME };
+static pidProfile_t testPidProfile;
+
+class BlackboxStreamTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        resetSerialTestPort();
+        blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+        blackboxConfigMutable()->mode = BLACKBOX_MODE_STREAM;
+        blackboxConfigMutable()->p_ratio = 32;
+        targetPidLooptime = 1000;
+        currentPidProfile = &testPidProfile;
+        blackboxInit();
+    }
+    virtual void TearDown() {
+        // a ground station connecting is what stops a stream, so use that to close the log
+        if (serialTestCtrlLineStateCb) {
+            serialTestCtrlLineStateCb(NULL, CTRL_LINE_STATE_DTR);
+        }
+        runStream(1, TEST_TX_BUFFER_SIZE);
+        blackboxConfigMutable()->mode = BLACKBOX_MODE_NORMAL;
+        runStream(BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS + 1, TEST_TX_BUFFER_SIZE);
+        blackboxConfigMutable()->device = BLACKBOX_DEVICE_NONE;
+    }
+};
+
+TEST_F(BlackboxStreamTest, StartsWithoutArming)
+{
+    runStream(1000, TEST_TX_BUFFER_SIZE);
+
+    EXPECT_EQ(1, countOutput("H Product:", 10));
+    // an I-frame every 32 iterations
+    EXPECT_GT(countOutput("I", 1), 1000 / 32 - 5);
+    EXPECT_EQ(0, serialTestOverruns);
+    EXPECT_EQ(0, countOutput(loggingResumeEvent, 2));
+}
+
+TEST_F(BlackboxStreamTest, SlowPortDropsWholeIterations)
+{
+    // a slow port would overrun the Tx buffer if every iteration was written
+    runStream(3000, 12);
+
+    EXPECT_EQ(1, countOutput("H Product:", 10));
+    EXPECT_EQ(0, serialTestOverruns);
+    // iterations were skipped, and the decoder is told where the log resumes
+    EXPECT_GT(countOutput(loggingResumeEvent, 2), 0);
+}
+
+TEST_F(BlackboxStreamTest, RestartsWhenGroundStationConnects)
+{
+    runStream(1000, TEST_TX_BUFFER_SIZE);
+    EXPECT_EQ(1, countOutput("H Product:", 10));
+    ASSERT_TRUE(serialTestCtrlLineStateCb != NULL);
+
+    serialTestCtrlLineStateCb(NULL, CTRL_LINE_STATE_DTR);
+    runStream(1000, TEST_TX_BUFFER_SIZE);
+
+    // the headers are sent again for the newly connected ground station
+    EXPECT_EQ(2, countOutput("H Product:", 10));
+    EXPECT_EQ(0, serialTestOverruns);
+}
+
+TEST_F(BlackboxStreamTest, RefusesPortTooSmallForAnIteration)
+{
+    // a Tx buffer which can't hold a worst case iteration would drop every frame
+    serialTestInstance.txBufferSize = 64;
+
+    runStream(1000, TEST_TX_BUFFER_SIZE);
+
+    EXPECT_EQ(0, serialTestOutputLength);
+    EXPECT_EQ(0, serialTestOverruns);
+}
 
 // STUBS
 extern "C" {
@@ -357,6 +476,8 @@ PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
 PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
 PG_REGISTER_ARRAY(modeActivationCondition_t, MAX_MODE_ACTIVATION_CONDITION_COUNT, modeActivationConditions, PG_MODE_ACTIVATION_PROFILE, 0);
 
+bool blackboxWriteSysinfo(void) { return true; }
+
 uint8_t armingFlags;
 uint8_t stateFlags;
 const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
@@ -370,8 +491,7 @@ gyro_t gyro;
 
 float motorOutputHigh, motorOutputLow;
 float motor_disarmed[MAX_SUPPORTED_MOTORS];
-struct pidProfile_s;
-struct pidProfile_s *currentPidProfile;
+pidProfile_t *currentPidProfile;
 uint32_t targetPidLooptime;
 
 boxBitmask_t rcModeActivationMask;
@@ -383,16 +503,27 @@ uint8_t getMotorCount(void) {return 4;}
 bool areMotorsRunning(void) { return false; }
 bool IS_RC_MODE_ACTIVE(boxId_e) {return false;}
 bool isModeActivationConditionPresent(boxId_e) {return false;}
-uint32_t millis(void) {return 0;}
+uint32_t millis(void) {return testMillis;}
 bool sensors(uint32_t) {return false;}
-void serialWrite(serialPort_t *, uint8_t) {}
-uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
-bool isSerialTransmitBufferEmpty(const serialPort_t *) {return false;}
+void serialWrite(serialPort_t *, uint8_t ch)
+{
+    if (serialTestTxUsed >= serialTestInstance.txBufferSize - 1) {
+        serialTestOverruns++;
+    } else {
+        serialTestTxUsed++;
+    }
+    if (serialTestOutputLength < (int)sizeof(serialTestOutput)) {
+        serialTestOutput[serialTestOutputLength++] = ch;
+    }
+}
+uint32_t serialTxBytesFree(const serialPort_t *) {return serialTestInstance.txBufferSize - 1 - serialTestTxUsed;}
+bool isSerialTransmitBufferEmpty(const serialPort_t *) {return serialTestTxUsed == 0;}
 bool featureIsEnabled(uint32_t) {return false;}
 void mspSerialReleasePortIfAllocated(serialPort_t *) {}
-serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return NULL;}
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return &serialTestInstanceConfig;}
 serialPort_t *findSharedSerialPort(uint16_t , serialPortFunction_e ) {return NULL;}
-serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return NULL;}
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return &serialTestInstance;}
+void serialSetCtrlLineStateCb(serialPort_t *, void (*cb)(void *context, uint16_t ctrlLineState), void *) {serialTestCtrlLineStateCb = cb;}
 void closeSerialPort(serialPort_t *) {}
 portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e ) {return PORTSHARING_UNUSED;}
 failsafePhase_e failsafePhase(void) {return FAILSAFE_IDLE;}
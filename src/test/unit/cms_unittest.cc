@@ -15,6 +15,7 @@
  * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdarg.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -23,6 +24,8 @@
 
 #include <math.h>
 
+#include <string>
+
 #define USE_BARO
 
 extern "C" {
@@ -36,6 +39,7 @@ extern "C" {
     long cmsMenuBack(displayPort_t *pDisplay);
     uint16_t cmsHandleKey(displayPort_t *pDisplay, uint8_t key);
     extern CMS_Menu *currentMenu;    // Points to top entry of the current page
+    extern int16_t rcData[];
 }
 
 #include "unittest_macros.h"
@@ -115,6 +119,109 @@ TEST(CMSUnittest, TestCmsMenuKey)
     uint16_t result = cmsHandleKey(displayPort, KEY_ESC);
     EXPECT_EQ(BUTTON_PAUSE, result);
 }
+
+static int displayPortWriteCount;
+
+static int displayPortCountingWriteString(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *s)
+{
+    displayPortWriteCount++;
+    return displayPortTestWriteString(displayPort, x, y, s);
+}
+
+static bool displayPortTestBufferContains(const char *s)
+{
+    return std::string(testDisplayPortBuffer, UNITTEST_DISPLAYPORT_BUFFER_LEN).find(s) != std::string::npos;
+}
+
+static uint32_t displayPortRoomyTxBytesFree(const displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    return 1000;
+}
+
+static const displayPortVTable_t countingDisplayPortVTable = {
+    .grab = displayPortTestGrab,
+    .release = displayPortTestRelease,
+    .clearScreen = displayPortTestClearScreen,
+    .drawScreen = displayPortTestDrawScreen,
+    .screenSize = displayPortTestScreenSize,
+    .writeString = displayPortCountingWriteString,
+    .writeChar = displayPortTestWriteChar,
+    .isTransferInProgress = displayPortTestIsTransferInProgress,
+    .heartbeat = displayPortTestHeartbeat,
+    .resync = displayPortTestResync,
+    .txBytesFree = displayPortRoomyTxBytesFree
+};
+
+static uint8_t dynamicValue;
+static OSD_UINT8_t entryDynamicValue = { &dynamicValue, 0, 255, 1 };
+
+static OSD_Entry menuDynamicEntries[] =
+{
+    {"-- DYNAMIC --", OME_Label, NULL, NULL, 0},
+    {"VALUE", OME_UINT8, NULL, &entryDynamicValue, DYNAMIC},
+    {"BACK", OME_Back, NULL, NULL, 0},
+    {NULL, OME_END, NULL, NULL, 0}
+};
+
+static CMS_Menu menuDynamic = {
+#ifdef CMS_MENU_DEBUG
+    "MENUDYNAMIC",
+    OME_MENU,
+#endif
+    NULL,
+    NULL,
+    menuDynamicEntries,
+};
+
+TEST(CMSUnittest, TestCmsDynamicValueRedrawnOnlyWhenChanged)
+{
+    cmsInit();
+    displayPort_t *displayPort = displayPortTestInit();
+    displayInit(displayPort, &countingDisplayPortVTable);
+    cmsDisplayPortRegister(displayPort);
+
+    // sticks centred, so no key is pressed
+    for (int i = 0; i < 4; i++) {
+        rcData[i] = 1500;
+    }
+
+    cmsMenuExit(displayPort, (void*)CMS_EXIT);
+    cmsMenuOpen();
+    cmsMenuChange(displayPort, &menuDynamic);
+
+    // the whole page is drawn after the screen is cleared
+    timeUs_t currentTimeUs = 1000000;
+    dynamicValue = 42;
+    displayPortWriteCount = 0;
+    cmsHandler(currentTimeUs);
+    EXPECT_LT(0, displayPortWriteCount);
+
+    // the value is polled, but unchanged so it is not written again
+    currentTimeUs += 1000000;
+    displayPortWriteCount = 0;
+    cmsHandler(currentTimeUs);
+    EXPECT_EQ(0, displayPortWriteCount);
+
+    // a changed value is written on the next poll
+    dynamicValue = 43;
+    currentTimeUs += 1000000;
+    displayPortWriteCount = 0;
+    cmsHandler(currentTimeUs);
+    EXPECT_EQ(1, displayPortWriteCount);
+    EXPECT_TRUE(displayPortTestBufferContains("43"));
+
+    // and drawn again after the screen is cleared, even though it is unchanged
+    displayClearScreen(displayPort);
+    currentTimeUs += 1000000;
+    EXPECT_FALSE(displayPortTestBufferContains("43"));
+    displayPortWriteCount = 0;
+    cmsHandler(currentTimeUs);
+    EXPECT_LT(1, displayPortWriteCount);
+    EXPECT_TRUE(displayPortTestBufferContains("43"));
+
+    cmsMenuExit(displayPort, (void*)CMS_EXIT);
+}
 // STUBS
 
 extern "C" {
@@ -114,3 +114,62 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+TEST(FilterUnittest, TestMovingAverageFilter)
+{
+    movingAverageFilter_t filter;
+    int32_t buf[4];
+    movingAverageFilterInit(&filter, buf, 4);
+
+    // averages only the samples received so far until primed
+    EXPECT_EQ(100, movingAverageFilterApply(&filter, 100));
+    EXPECT_FALSE(movingAverageFilterIsPrimed(&filter));
+    EXPECT_EQ(150, movingAverageFilterApply(&filter, 200));
+    EXPECT_EQ(200, movingAverageFilterApply(&filter, 300));
+    EXPECT_EQ(250, movingAverageFilterApply(&filter, 400));
+    EXPECT_TRUE(movingAverageFilterIsPrimed(&filter));
+
+    // then the oldest sample drops out
+    EXPECT_EQ(350, movingAverageFilterApply(&filter, 500));
+    EXPECT_EQ(100700 / 4, movingAverageFilterApply(&filter, 99500));
+    EXPECT_EQ(100700, filter.sum);
+}
+
+TEST(FilterUnittest, TestMedianFilter)
+{
+    medianFilter_t filter;
+    int32_t window[5];
+    int32_t sorted[5];
+    medianFilterInit(&filter, window, sorted, 5);
+
+    EXPECT_EQ(10, medianFilterApply(&filter, 10));
+    EXPECT_EQ(10, medianFilterApply(&filter, 5));       // 5 10
+    EXPECT_EQ(10, medianFilterApply(&filter, 1000));    // 5 10 1000
+    EXPECT_EQ(10, medianFilterApply(&filter, -3));      // -3 5 10 1000
+    EXPECT_EQ(10, medianFilterApply(&filter, 12));      // -3 5 10 12 1000
+
+    // oldest sample (10) is replaced
+    EXPECT_EQ(12, medianFilterApply(&filter, 20));      // -3 5 12 20 1000
+    // duplicates
+    EXPECT_EQ(12, medianFilterApply(&filter, 12));      // -3 12 12 20 1000
+    EXPECT_EQ(12, medianFilterApply(&filter, 12));      // -3 12 12 12 20
+    EXPECT_EQ(12, medianFilterApply(&filter, 50));      // 12 12 12 20 50
+
+    for (int i = 1; i < 5; i++) {
+        EXPECT_LE(sorted[i - 1], sorted[i]);
+    }
+}
+
+TEST(FilterUnittest, TestMedianFilterRejectsSpikes)
+{
+    medianFilter_t filter;
+    int32_t window[3];
+    int32_t sorted[3];
+    medianFilterInit(&filter, window, sorted, 3);
+
+    medianFilterApply(&filter, 101325);
+    medianFilterApply(&filter, 101326);
+    EXPECT_EQ(101326, medianFilterApply(&filter, 200000));
+    EXPECT_EQ(101327, medianFilterApply(&filter, 101327));
+    EXPECT_EQ(101327, medianFilterApply(&filter, 0));
+}
@@ -0,0 +1,202 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+
+    #include "config/config_eeprom.h"
+    #include "config/config_streamer.h"
+
+    #include "drivers/system.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    typedef struct testConfigA_s {
+        uint16_t value;
+    } testConfigA_t;
+
+    typedef struct testConfigB_s {
+        uint32_t value;
+    } testConfigB_t;
+
+    typedef struct testConfigC_s {
+        uint8_t value;
+    } testConfigC_t;
+
+    PG_DECLARE(testConfigA_t, testConfigA);
+    PG_DECLARE(testConfigB_t, testConfigB);
+    PG_DECLARE(testConfigC_t, testConfigC);
+
+    PG_REGISTER_WITH_RESET_TEMPLATE(testConfigA_t, testConfigA, PG_RESERVED_FOR_TESTING_1, 0);
+    PG_REGISTER_WITH_RESET_TEMPLATE(testConfigB_t, testConfigB, PG_RESERVED_FOR_TESTING_2, 0);
+    PG_REGISTER_WITH_RESET_TEMPLATE(testConfigC_t, testConfigC, PG_RESERVED_FOR_TESTING_3, 0);
+
+    PG_RESET_TEMPLATE(testConfigA_t, testConfigA, .value = 1000);
+    PG_RESET_TEMPLATE(testConfigB_t, testConfigB, .value = 2000);
+    PG_RESET_TEMPLATE(testConfigC_t, testConfigC, .value = 30);
+
+    uint8_t eepromData[EEPROM_SIZE];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static unsigned eepromLength;
+static uint16_t eepromCrc;
+
+static void eepromAppend(const void *data, unsigned length)
+{
+    memcpy(&eepromData[eepromLength], data, length);
+    eepromCrc = crc16_ccitt_update(eepromCrc, data, length);
+    eepromLength += length;
+}
+
+// Lays out the config as writeConfigToEEPROM() does, header, records, footer and CRC
+static void eepromStart(void)
+{
+    memset(eepromData, 0, sizeof(eepromData));
+    eepromLength = 0;
+    eepromCrc = 0xFFFF;
+
+    const uint8_t header[] = { EEPROM_CONF_VERSION, 0xBE };
+    eepromAppend(header, sizeof(header));
+}
+
+static void eepromAppendRecord(pgn_t pgn, const void *data, uint16_t length)
+{
+    const uint16_t size = 6 + length;
+    const uint8_t record[] = { (uint8_t)size, (uint8_t)(size >> 8), (uint8_t)pgn, (uint8_t)(pgn >> 8), 0, 0 };
+    eepromAppend(record, sizeof(record));
+    eepromAppend(data, length);
+}
+
+static void eepromFinish(void)
+{
+    const uint8_t footer[] = { 0, 0 };
+    eepromAppend(footer, sizeof(footer));
+
+    const uint16_t invertedBigEndianCrc = ~(((eepromCrc & 0xFF) << 8) | (eepromCrc >> 8));
+    eepromAppend(&invertedBigEndianCrc, sizeof(invertedBigEndianCrc));
+}
+
+static const testConfigA_t storedA = { 1111 };
+static const testConfigB_t storedB = { 2222 };
+static const testConfigC_t storedC = { 33 };
+
+class ConfigEepromTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        testConfigAMutable()->value = 0;
+        testConfigBMutable()->value = 0;
+        testConfigCMutable()->value = 0;
+    }
+};
+
+TEST_F(ConfigEepromTest, RecordsInRegistryOrderAreLoaded)
+{
+    eepromStart();
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_1, &storedA, sizeof(storedA));
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_2, &storedB, sizeof(storedB));
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_3, &storedC, sizeof(storedC));
+    eepromFinish();
+
+    ASSERT_TRUE(isEEPROMVersionValid());
+    ASSERT_TRUE(isEEPROMStructureValid());
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(1111, testConfigA()->value);
+    EXPECT_EQ(2222u, testConfigB()->value);
+    EXPECT_EQ(33, testConfigC()->value);
+}
+
+TEST_F(ConfigEepromTest, ShuffledRecordsAreLoaded)
+{
+    eepromStart();
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_3, &storedC, sizeof(storedC));
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_1, &storedA, sizeof(storedA));
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_2, &storedB, sizeof(storedB));
+    eepromFinish();
+
+    ASSERT_TRUE(isEEPROMStructureValid());
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(1111, testConfigA()->value);
+    EXPECT_EQ(2222u, testConfigB()->value);
+    EXPECT_EQ(33, testConfigC()->value);
+
+    eepromStart();
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_2, &storedB, sizeof(storedB));
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_3, &storedC, sizeof(storedC));
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_1, &storedA, sizeof(storedA));
+    eepromFinish();
+
+    SetUp();
+    ASSERT_TRUE(isEEPROMStructureValid());
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(1111, testConfigA()->value);
+    EXPECT_EQ(2222u, testConfigB()->value);
+    EXPECT_EQ(33, testConfigC()->value);
+}
+
+TEST_F(ConfigEepromTest, MissingRecordIsReset)
+{
+    // an unknown PG is skipped, and the PG without a record gets its defaults
+    const uint8_t unknown[4] = { 0 };
+    eepromStart();
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_3, &storedC, sizeof(storedC));
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_1 - 10, unknown, sizeof(unknown));
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_1, &storedA, sizeof(storedA));
+    eepromFinish();
+
+    ASSERT_TRUE(isEEPROMStructureValid());
+    EXPECT_FALSE(loadEEPROM());
+    EXPECT_EQ(1111, testConfigA()->value);
+    EXPECT_EQ(2000u, testConfigB()->value);
+    EXPECT_EQ(33, testConfigC()->value);
+}
+
+TEST_F(ConfigEepromTest, CorruptConfigIsInvalid)
+{
+    eepromStart();
+    eepromAppendRecord(PG_RESERVED_FOR_TESTING_1, &storedA, sizeof(storedA));
+    eepromFinish();
+    // the first byte of the record's data, after the header and the record header
+    eepromData[2 + 6] ^= 0x01;
+
+    EXPECT_FALSE(isEEPROMStructureValid());
+}
+
+// STUBS
+
+extern "C" {
+
+void config_streamer_init(config_streamer_t *) {}
+void config_streamer_start(config_streamer_t *, uintptr_t, int) {}
+int config_streamer_write(config_streamer_t *, const uint8_t *, uint32_t) { return 0; }
+int config_streamer_flush(config_streamer_t *) { return 0; }
+int config_streamer_finish(config_streamer_t *) { return 0; }
+void failureMode(failureMode_e) {}
+
+}
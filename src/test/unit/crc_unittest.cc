@@ -0,0 +1,98 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <random>
+
+extern "C" {
+    #include "common/crc.h"
+    #include "common/maths.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define DATA_SIZE (16 * 1024)
+static uint8_t data[DATA_SIZE];
+
+// Reference implementation, a bit at a time
+static uint16_t crc16CcittBitwise(uint16_t crc, const uint8_t *p, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        crc = crc16_ccitt(crc, p[i]);
+    }
+    return crc;
+}
+
+static void fillData(void)
+{
+    std::mt19937 rng(1);
+    for (int i = 0; i < DATA_SIZE; i++) {
+        data[i] = rng();
+    }
+}
+
+TEST(CrcTest, Crc16CcittCheckValue)
+{
+    // the standard check value for CRC-16/CCITT-FALSE
+    const char *check = "123456789";
+    EXPECT_EQ(0x29B1, crc16_ccitt_update(0xFFFF, check, strlen(check)));
+}
+
+TEST(CrcTest, Crc16CcittMatchesBitwise)
+{
+    fillData();
+
+    for (uint32_t length = 0; length < 300; length++) {
+        EXPECT_EQ(crc16CcittBitwise(0xFFFF, data, length), crc16_ccitt_update(0xFFFF, data, length)) << "length " << length;
+        EXPECT_EQ(crc16CcittBitwise(0x1234, data + 7, length), crc16_ccitt_update(0x1234, data + 7, length)) << "length " << length;
+    }
+}
+
+TEST(CrcTest, Crc16CcittIncludingCrc)
+{
+    fillData();
+
+    // the EEPROM stores the inverted CRC big endian, so a CRC over data and stored CRC has a constant value
+    uint16_t crc = crc16_ccitt_update(0xFFFF, data, 1000);
+    const uint16_t invertedBigEndianCrc = ~(((crc & 0xFF) << 8) | (crc >> 8));
+    crc = crc16_ccitt_update(crc, &invertedBigEndianCrc, sizeof(invertedBigEndianCrc));
+
+    EXPECT_EQ(0x1D0F, crc);
+}
+
+TEST(CrcTest, Crc16CcittMatchesBitwiseInPieces)
+{
+    fillData();
+
+    // the whole buffer, updated in pieces of random length as the EEPROM records are
+    std::mt19937 rng(2);
+    uint16_t tableCrc = 0xFFFF;
+    uint32_t offset = 0;
+    while (offset < DATA_SIZE) {
+        const uint32_t length = MIN(rng() % 512, DATA_SIZE - offset);
+        tableCrc = crc16_ccitt_update(tableCrc, data + offset, length);
+        offset += length;
+    }
+
+    EXPECT_EQ(crc16CcittBitwise(0xFFFF, data, DATA_SIZE), tableCrc);
+}
@@ -0,0 +1,296 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "drivers/display.h"
+
+    #include "io/displayport_msp.h"
+
+    #include "msp/msp.h"
+    #include "msp/msp_protocol.h"
+    #include "msp/msp_serial.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define ROWS MSP_DISPLAYPORT_ROWS_MAX
+#define COLS MSP_DISPLAYPORT_COLS_MAX
+
+// The remote display, as rebuilt from the frames sent to it
+static char remote[ROWS][COLS];
+static char expected[ROWS][COLS];
+static int bytesSent;
+static int writeFrames;
+static int clearFrames;
+static int drawFrames;
+static bool txFull;
+
+static displayPort_t *displayPort;
+
+static void resetCounters(void)
+{
+    bytesSent = 0;
+    writeFrames = 0;
+    clearFrames = 0;
+    drawFrames = 0;
+}
+
+static void write(uint8_t col, uint8_t row, const char *text)
+{
+    displayWrite(displayPort, col, row, text);
+    memcpy(&expected[row][col], text, MIN((int)strlen(text), COLS - col));
+}
+
+static void clear(void)
+{
+    displayClearScreen(displayPort);
+    memset(expected, ' ', sizeof(expected));
+}
+
+static void expectRemoteMatches(void)
+{
+    for (int row = 0; row < ROWS; row++) {
+        EXPECT_EQ(0, memcmp(remote[row], expected[row], COLS)) << "row " << row;
+    }
+}
+
+// Draws the screen the way the OSD does, clearing it and drawing every element again
+static void drawOsd(int rssi, int voltage)
+{
+    char buf[16];
+
+    clear();
+    snprintf(buf, sizeof(buf), "RSSI %2d", rssi);
+    write(1, 1, buf);
+    snprintf(buf, sizeof(buf), "%d.%02dV", voltage / 100, voltage % 100);
+    write(22, 1, buf);
+    write(12, 6, "-- + --");
+    write(1, 11, "ANGL");
+    write(10, 11, "00:42");
+    write(20, 12, "BETAFLIGHT");
+}
+
+class DisplayPortMspTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        txFull = false;
+        memset(remote, '?', sizeof(remote));
+        memset(expected, ' ', sizeof(expected));
+        displayPort = displayPortMspInit();
+        resetCounters();
+    }
+};
+
+TEST_F(DisplayPortMspTest, InitClearsRemoteDisplay)
+{
+    displayDrawScreen(displayPort);
+
+    EXPECT_EQ(ROWS, displayPort->rows);
+    EXPECT_EQ(COLS, displayPort->cols);
+    expectRemoteMatches();
+}
+
+TEST_F(DisplayPortMspTest, UnchangedScreenSendsNothing)
+{
+    drawOsd(99, 1680);
+    displayDrawScreen(displayPort);
+    expectRemoteMatches();
+
+    resetCounters();
+    for (int i = 0; i < 10; i++) {
+        drawOsd(99, 1680);
+        displayDrawScreen(displayPort);
+    }
+    EXPECT_EQ(0, bytesSent);
+    expectRemoteMatches();
+}
+
+TEST_F(DisplayPortMspTest, OnlyChangedCharactersAreSent)
+{
+    drawOsd(99, 1681);
+    displayDrawScreen(displayPort);
+
+    resetCounters();
+    drawOsd(99, 1682);
+    displayDrawScreen(displayPort);
+
+    EXPECT_EQ(1, writeFrames);
+    EXPECT_EQ(1, drawFrames);
+    EXPECT_EQ(0, clearFrames);
+    // one character, plus the frame and write string overhead, plus the draw frame
+    EXPECT_EQ(6 + 4 + 1 + 6 + 1, bytesSent);
+    expectRemoteMatches();
+}
+
+TEST_F(DisplayPortMspTest, NearbyChangesAreJoined)
+{
+    write(0, 3, "abcdefghijklmnopqrstuvwxyz");
+    displayDrawScreen(displayPort);
+
+    // a short gap is rewritten rather than starting another frame
+    resetCounters();
+    write(2, 3, "C");
+    write(5, 3, "F");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(1, writeFrames);
+    expectRemoteMatches();
+
+    // a long gap costs more than a frame
+    resetCounters();
+    write(2, 3, "c");
+    write(20, 3, "U");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(2, writeFrames);
+    expectRemoteMatches();
+}
+
+TEST_F(DisplayPortMspTest, ClearIsSentWhenCheaper)
+{
+    for (int row = 0; row < ROWS; row++) {
+        write(0, row, "0123456789012345678901234567");
+    }
+    displayDrawScreen(displayPort);
+
+    // blanking a full screen is more expensive than a clear
+    resetCounters();
+    clear();
+    write(3, 4, "MENU");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(1, clearFrames);
+    EXPECT_EQ(1, writeFrames);
+    expectRemoteMatches();
+
+    // blanking a single element is cheaper than a clear and a redraw
+    drawOsd(50, 1600);
+    displayDrawScreen(displayPort);
+    resetCounters();
+    clear();
+    write(1, 1, "RSSI 50");
+    write(22, 1, "16.00V");
+    write(12, 6, "-- + --");
+    write(1, 11, "ANGL");
+    write(10, 11, "00:42");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(0, clearFrames);
+    EXPECT_EQ(1, writeFrames);
+    expectRemoteMatches();
+}
+
+TEST_F(DisplayPortMspTest, FullTransmitBufferIsRetried)
+{
+    drawOsd(99, 1680);
+    txFull = true;
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(0, bytesSent);
+
+    txFull = false;
+    displayDrawScreen(displayPort);
+    expectRemoteMatches();
+}
+
+TEST_F(DisplayPortMspTest, ResyncRedrawsEverything)
+{
+    drawOsd(99, 1680);
+    displayDrawScreen(displayPort);
+
+    // the remote display was power cycled
+    memset(remote, '?', sizeof(remote));
+    displayResync(displayPort);
+    displayDrawScreen(displayPort);
+
+    EXPECT_EQ(1, clearFrames);
+    expectRemoteMatches();
+}
+
+TEST_F(DisplayPortMspTest, Bandwidth)
+{
+    // sending every string as it is written, the way displayport writes used to work
+    int naiveBytes = 0;
+    const char *elements[] = { "RSSI 99", "16.80V", "-- + --", "ANGL", "00:42", "BETAFLIGHT" };
+    for (unsigned i = 0; i < ARRAYLEN(elements); i++) {
+        naiveBytes += 6 + 4 + strlen(elements[i]);
+    }
+    naiveBytes += 6 + 1 + 6 + 1; // clear and draw
+
+    drawOsd(99, 1680);
+    displayDrawScreen(displayPort);
+
+    resetCounters();
+    const int frames = 100;
+    for (int i = 0; i < frames; i++) {
+        drawOsd(99 - i / 10, 1680 - i);
+        displayDrawScreen(displayPort);
+    }
+    expectRemoteMatches();
+
+    printf("OSD refresh: %d bytes per frame, was %d bytes per frame\n", bytesSent / frames, naiveBytes);
+    EXPECT_LT(bytesSent / frames, naiveBytes / 4);
+}
+
+// STUBS
+
+extern "C" {
+
+int mspSerialPush(uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direction)
+{
+    UNUSED(direction);
+
+    if (txFull || cmd != MSP_DISPLAYPORT) {
+        return 0;
+    }
+
+    switch (data[0]) {
+    case 2:
+        memset(remote, ' ', sizeof(remote));
+        clearFrames++;
+        break;
+    case 3:
+        memcpy(&remote[data[1]][data[2]], &data[4], datalen - 4);
+        writeFrames++;
+        break;
+    case 4:
+        drawFrames++;
+        break;
+    }
+
+    bytesSent += datalen + 6;
+    return datalen + 6;
+}
+
+uint32_t mspSerialTxBytesFree(void)
+{
+    return txFull ? 0 : UINT32_MAX;
+}
+
+}
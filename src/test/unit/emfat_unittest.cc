@@ -0,0 +1,217 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "io/flashfs.h"
+
+    #include "msc/emfat.h"
+    #include "msc/emfat_file.h"
+
+    extern emfat_t emfat;
+
+    emfat_entry_t *find_entry(const emfat_t *emfat, uint32_t clust, emfat_entry_t *nearest);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SECT 512
+#define CLUST 4096
+
+// A synthetic flash image holding a few logs, each starting on a 2048 byte boundary like flashfs leaves them
+#define IMAGE_SIZE (4 * 1024 * 1024)
+static uint8_t flashImage[IMAGE_SIZE];
+static uint32_t usedSpace;
+
+static int flashReadCount;
+static uint32_t flashReadBytes;
+
+static const uint32_t logSizes[] = { 300 * 1024, 2048, 1000 * 1024 + 6144, 77 * 2048 };
+
+static void buildImage(void)
+{
+    std::mt19937 rng(1);
+    for (int i = 0; i < IMAGE_SIZE; i++) {
+        flashImage[i] = rng() % 200; // no 0xff runs, which would look erased
+    }
+
+    uint32_t offset = 0;
+    for (unsigned i = 0; i < ARRAYLEN(logSizes); i++) {
+        memcpy(&flashImage[offset], "H Product:Blackbox", 18);
+        offset += logSizes[i];
+    }
+    usedSpace = offset;
+    memset(&flashImage[usedSpace], 0xff, IMAGE_SIZE - usedSpace);
+}
+
+static emfat_entry_t *findFile(const char *name)
+{
+    for (emfat_entry_t *entry = emfat.priv.entries; entry->name != NULL; entry++) {
+        if (strcmp(entry->name, name) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static uint32_t fileSector(const emfat_entry_t *entry)
+{
+    return emfat.priv.root_lba + (entry->priv.first_clust - 2) * (CLUST / SECT);
+}
+
+// Read a file through the FAT in requests of the given number of sectors and check it against the flash image
+static void checkFileContents(const emfat_entry_t *entry, int sectorsPerRead)
+{
+    static uint8_t buffer[16 * SECT];
+    const uint32_t sectors = (entry->curr_size + SECT - 1) / SECT;
+
+    for (uint32_t sector = 0; sector < sectors; sector += sectorsPerRead) {
+        const int count = MIN(sectorsPerRead, (int)(sectors - sector));
+        emfat_read(&emfat, buffer, fileSector(entry) + sector, count);
+
+        const uint32_t offset = sector * SECT;
+        const uint32_t length = MIN((uint32_t)count * SECT, entry->curr_size - offset);
+        ASSERT_EQ(0, memcmp(buffer, &flashImage[entry->offset + offset], length)) << entry->name << " sector " << sector;
+    }
+}
+
+class EmfatTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        buildImage();
+        emfat_init_files();
+    }
+};
+
+TEST_F(EmfatTest, LogsAreListed)
+{
+    uint32_t offset = 0;
+    for (unsigned i = 0; i < ARRAYLEN(logSizes); i++) {
+        char name[13];
+        snprintf(name, sizeof(name), "BTFL_%03d.BBL", i + 1);
+
+        const emfat_entry_t *entry = findFile(name);
+        ASSERT_TRUE(entry != NULL) << name;
+        EXPECT_EQ(offset, entry->offset);
+        EXPECT_EQ(logSizes[i], entry->curr_size);
+        offset += logSizes[i];
+    }
+
+    const emfat_entry_t *all = findFile("BTFL_ALL.BBL");
+    ASSERT_TRUE(all != NULL);
+    EXPECT_EQ(usedSpace, all->curr_size);
+}
+
+TEST_F(EmfatTest, FindEntryMatchesLinearSearch)
+{
+    emfat_entry_t *entries = emfat.priv.entries;
+    const uint32_t lastCluster = emfat.priv.num_clust + 2;
+
+    for (uint32_t clust = 0; clust < lastCluster + 10; clust++) {
+        emfat_entry_t *expected = NULL;
+        for (emfat_entry_t *entry = entries; entry->name != NULL; entry++) {
+            if (clust >= entry->priv.first_clust && clust <= entry->priv.last_reserved) {
+                expected = entry;
+                break;
+            }
+        }
+
+        EXPECT_EQ(expected, find_entry(&emfat, clust, NULL)) << "cluster " << clust;
+        for (int hint = 0; hint < emfat.priv.num_entries; hint++) {
+            EXPECT_EQ(expected, find_entry(&emfat, clust, &entries[hint])) << "cluster " << clust << " hint " << hint;
+        }
+    }
+}
+
+TEST_F(EmfatTest, FilesReadBackFromFlash)
+{
+    const int sectorsPerRead[] = { 1, 3, 8, 16 };
+
+    for (unsigned i = 0; i < ARRAYLEN(sectorsPerRead); i++) {
+        for (emfat_entry_t *entry = emfat.priv.entries; entry->name != NULL; entry++) {
+            if (!entry->dir && entry->offset + entry->curr_size <= usedSpace && strncmp(entry->name, "BTFL_", 5) == 0) {
+                checkFileContents(entry, sectorsPerRead[i]);
+            }
+        }
+    }
+}
+
+TEST_F(EmfatTest, Throughput)
+{
+    const emfat_entry_t *all = findFile("BTFL_ALL.BBL");
+    ASSERT_TRUE(all != NULL);
+
+    // Single sector reads, as used by the HAL MSC class, and 8 sector reads as used by the F4 MSC class
+    const int sectorsPerRead[] = { 1, 8 };
+
+    for (unsigned i = 0; i < ARRAYLEN(sectorsPerRead); i++) {
+        flashReadCount = 0;
+        flashReadBytes = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        checkFileContents(all, sectorsPerRead[i]);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        printf("%d sector reads: %d flash reads averaging %u bytes, %.1f Mbyte/s on host\n",
+            sectorsPerRead[i], flashReadCount, flashReadBytes / flashReadCount,
+            all->curr_size / elapsed.count() / 1e6);
+
+        // every flash read fetches at least a whole NAND page
+        EXPECT_LE(flashReadCount, (int)(all->curr_size / 2048 + 1));
+    }
+}
+
+// STUBS
+
+extern "C" {
+
+int flashfsIdentifyStartOfFreeSpace(void)
+{
+    return usedSpace;
+}
+
+int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
+{
+    if (address >= IMAGE_SIZE) {
+        return 0;
+    }
+    if (address + len > IMAGE_SIZE) {
+        len = IMAGE_SIZE - address;
+    }
+
+    flashReadCount++;
+    flashReadBytes += len;
+    memcpy(buffer, &flashImage[address], len);
+
+    return len;
+}
+
+}
@@ -0,0 +1,486 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/flash.h"
+
+    #include "io/flashfs.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// A small NAND device: 32 blocks of 4 pages, the last 2 blocks hold the log index
+#define TEST_PAGE_SIZE 2048
+#define TEST_PAGES_PER_SECTOR 4
+#define TEST_SECTOR_SIZE (TEST_PAGE_SIZE * TEST_PAGES_PER_SECTOR)
+#define TEST_SECTORS 32
+#define TEST_FLASH_SIZE (TEST_SECTOR_SIZE * TEST_SECTORS)
+#define TEST_INDEX_SLOTS (FLASHFS_LOG_INDEX_SECTORS * TEST_PAGES_PER_SECTOR)
+#define TEST_VOLUME_SIZE (TEST_FLASH_SIZE - FLASHFS_LOG_INDEX_SECTORS * TEST_SECTOR_SIZE)
+
+static uint8_t flashMemory[TEST_FLASH_SIZE];
+static int flashReadCount;
+
+// Program operations since the last reset, and how many didn't program a whole page or programmed over data
+static int programCount;
+static int partialPageProgramCount;
+static int programOverDataCount;
+static int sectorEraseCount[TEST_SECTORS];
+
+static const flashGeometry_t testGeometry = {
+    .sectors = TEST_SECTORS,
+    .pageSize = TEST_PAGE_SIZE,
+    .sectorSize = TEST_SECTOR_SIZE,
+    .totalSize = TEST_FLASH_SIZE,
+    .pagesPerSector = TEST_PAGES_PER_SECTOR,
+    .flashType = FLASH_TYPE_NAND,
+};
+
+static flashPartition_t testPartitions[] = {
+    { FLASH_PARTITION_TYPE_FLASHFS, 0, TEST_SECTORS - FLASHFS_LOG_INDEX_SECTORS - 1 },
+    { FLASH_PARTITION_TYPE_FLASHFS_LOG_INDEX, TEST_SECTORS - FLASHFS_LOG_INDEX_SECTORS, TEST_SECTORS - 1 },
+};
+
+static void eraseFlash(void)
+{
+    memset(flashMemory, 0xFF, sizeof(flashMemory));
+}
+
+static void writeLog(uint32_t length, uint8_t fill)
+{
+    uint8_t buffer[100];
+    memset(buffer, fill, sizeof(buffer));
+
+    while (length > 0) {
+        const uint32_t chunk = length < sizeof(buffer) ? length : sizeof(buffer);
+        flashfsWrite(buffer, chunk, true);
+        length -= chunk;
+    }
+    flashfsFlushSync();
+}
+
+static void resetFlashCounters(void)
+{
+    programCount = 0;
+    partialPageProgramCount = 0;
+    programOverDataCount = 0;
+    memset(sectorEraseCount, 0, sizeof(sectorEraseCount));
+}
+
+static int volumeEraseCount(void)
+{
+    int count = 0;
+    for (int i = 0; i < TEST_SECTORS - FLASHFS_LOG_INDEX_SECTORS; i++) {
+        count += sectorEraseCount[i];
+    }
+    return count;
+}
+
+// Fill the volume with data from an earlier flight, as the log index would describe it
+static void fillVolumeWithOldLogs(void)
+{
+    memset(flashMemory, 0x42, TEST_VOLUME_SIZE);
+}
+
+class FlashfsLogIndexTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        eraseFlash();
+        flashfsInit();
+        resetFlashCounters();
+    }
+};
+
+TEST_F(FlashfsLogIndexTest, EmptyVolumeIsIndexedAtInit)
+{
+    EXPECT_TRUE(flashfsIsSupported());
+    EXPECT_EQ((uint32_t)TEST_VOLUME_SIZE, flashfsGetSize());
+    EXPECT_EQ(0, flashfsLogIndexCount());
+    EXPECT_EQ(0u, flashfsGetOffset());
+    EXPECT_EQ(0, flashfsIdentifyStartOfFreeSpace());
+
+    // the format record was written to the first slot of the index
+    EXPECT_NE(0xFF, flashMemory[TEST_VOLUME_SIZE]);
+}
+
+TEST_F(FlashfsLogIndexTest, ClosedLogsAreIndexed)
+{
+    const uint32_t lengths[] = { 5000, 100, 2048 };
+
+    for (unsigned i = 0; i < ARRAYLEN(lengths); i++) {
+        writeLog(lengths[i], i + 1);
+        flashfsClose();
+    }
+
+    ASSERT_EQ(3, flashfsLogIndexCount());
+
+    uint32_t start = 0;
+    for (int i = 0; i < 3; i++) {
+        flashfsLogEntry_t entry;
+        ASSERT_TRUE(flashfsLogIndexGet(i, &entry));
+
+        // logs are contiguous, each one padded to a page boundary on NAND
+        const uint32_t paddedLength = (lengths[i] + TEST_PAGE_SIZE - 1) / TEST_PAGE_SIZE * TEST_PAGE_SIZE;
+        EXPECT_EQ(start, entry.start);
+        EXPECT_EQ(paddedLength, entry.length);
+        EXPECT_EQ(0, entry.flags);
+        EXPECT_EQ(i + 1, flashMemory[entry.start]);
+        start += paddedLength;
+    }
+    EXPECT_FALSE(flashfsLogIndexGet(3, NULL));
+    EXPECT_EQ(start, flashfsLogIndexEnd());
+
+    // after a reboot the index is read back without scanning the volume
+    flashReadCount = 0;
+    flashfsInit();
+
+    EXPECT_GT(10, flashReadCount);
+    EXPECT_EQ(3, flashfsLogIndexCount());
+    EXPECT_EQ(start, flashfsGetOffset());
+    EXPECT_EQ((int)start, flashfsIdentifyStartOfFreeSpace());
+}
+
+TEST_F(FlashfsLogIndexTest, UnclosedLogIsRecoveredAtInit)
+{
+    writeLog(3000, 1);
+    flashfsClose();
+
+    // power is lost while the second log is being written
+    writeLog(7000, 2);
+
+    flashfsInit();
+
+    ASSERT_EQ(2, flashfsLogIndexCount());
+
+    flashfsLogEntry_t entry;
+    ASSERT_TRUE(flashfsLogIndexGet(1, &entry));
+    EXPECT_EQ(4096u, entry.start);
+    EXPECT_EQ(8192u, entry.length);
+    EXPECT_EQ(FLASHFS_LOG_FLAG_RECOVERED, entry.flags);
+
+    // logging resumes after the recovered log
+    EXPECT_EQ(4096u + 8192u, flashfsGetOffset());
+}
+
+TEST_F(FlashfsLogIndexTest, UnindexedVolumeFallsBackToScanning)
+{
+    // logs written by firmware without an index, the index area holds old log data
+    memset(flashMemory, 0x42, 10000);
+    memset(flashMemory + TEST_VOLUME_SIZE, 0x42, TEST_SECTOR_SIZE);
+
+    flashfsInit();
+
+    EXPECT_EQ(0, flashfsLogIndexCount());
+    EXPECT_EQ(0u, flashfsLogIndexEnd());
+    EXPECT_EQ(10240u, flashfsGetOffset());
+
+    // closing a log doesn't add to an index which doesn't describe the volume
+    writeLog(100, 1);
+    flashfsClose();
+    EXPECT_EQ(0, flashfsLogIndexCount());
+
+    // erasing the volume starts indexing it again
+    flashfsEraseCompletely();
+    EXPECT_EQ(0, flashfsLogIndexCount());
+    EXPECT_EQ(0u, flashfsGetOffset());
+
+    writeLog(100, 1);
+    flashfsClose();
+    EXPECT_EQ(1, flashfsLogIndexCount());
+}
+
+TEST_F(FlashfsLogIndexTest, FullIndexFallsBackToScanning)
+{
+    const int logCount = TEST_INDEX_SLOTS + 2;
+
+    for (int i = 0; i < logCount; i++) {
+        writeLog(1000, i + 1);
+        flashfsClose();
+    }
+
+    // slot 0 holds the format record
+    EXPECT_EQ(TEST_INDEX_SLOTS - 1, flashfsLogIndexCount());
+    EXPECT_EQ((uint32_t)(TEST_INDEX_SLOTS - 1) * TEST_PAGE_SIZE, flashfsLogIndexEnd());
+
+    // the logs which didn't fit are found by scanning after the indexed ones
+    EXPECT_EQ(logCount * TEST_PAGE_SIZE, flashfsIdentifyStartOfFreeSpace());
+
+    flashfsInit();
+    EXPECT_EQ((uint32_t)logCount * TEST_PAGE_SIZE, flashfsGetOffset());
+}
+
+TEST_F(FlashfsLogIndexTest, TornRecordIsIgnored)
+{
+    writeLog(3000, 1);
+    flashfsClose();
+    writeLog(3000, 2);
+    flashfsClose();
+
+    // damage the second log record
+    flashMemory[TEST_VOLUME_SIZE + 2 * TEST_PAGE_SIZE + 8] ^= 0x01;
+
+    flashfsInit();
+
+    flashfsLogEntry_t entry;
+    EXPECT_TRUE(flashfsLogIndexGet(0, &entry));
+    EXPECT_FALSE(flashfsLogIndexGet(1, &entry));
+
+    // the data after the last intact record is recovered as a log
+    ASSERT_EQ(3, flashfsLogIndexCount());
+    ASSERT_TRUE(flashfsLogIndexGet(2, &entry));
+    EXPECT_EQ(4096u, entry.start);
+    EXPECT_EQ(4096u, entry.length);
+    EXPECT_EQ(FLASHFS_LOG_FLAG_RECOVERED, entry.flags);
+    EXPECT_EQ(8192u, flashfsGetOffset());
+}
+
+TEST_F(FlashfsLogIndexTest, LoggingProgramsWholePages)
+{
+    uint8_t frame[37];
+    for (unsigned i = 0; i < sizeof(frame); i++) {
+        frame[i] = i;
+    }
+
+    // blackbox writes small frames asynchronously and flushes every iteration
+    for (int i = 0; i < 1000; i++) {
+        flashfsWrite(frame, sizeof(frame), false);
+        flashfsWriteByte(0x5A);
+        flashfsFlushAsync(false);
+    }
+
+    const uint32_t written = 1000 * (sizeof(frame) + 1);
+    EXPECT_EQ(written, flashfsGetOffset());
+    EXPECT_EQ((int)(written / TEST_PAGE_SIZE), programCount);
+    EXPECT_EQ(0, partialPageProgramCount);
+
+    // a forced flush writes out the partial page when logging ends
+    EXPECT_TRUE(flashfsFlushAsync(true));
+    EXPECT_EQ((int)(written / TEST_PAGE_SIZE) + 1, programCount);
+    EXPECT_EQ(0, programOverDataCount);
+
+    for (uint32_t offset = 0; offset < written; offset += sizeof(frame) + 1) {
+        ASSERT_EQ(0, memcmp(frame, &flashMemory[offset], sizeof(frame)));
+        ASSERT_EQ(0x5A, flashMemory[offset + sizeof(frame)]);
+    }
+}
+
+TEST_F(FlashfsLogIndexTest, EraseOnlyClearsUsedSectors)
+{
+    writeLog(TEST_SECTOR_SIZE + 100, 1);
+    flashfsClose();
+
+    resetFlashCounters();
+    flashfsEraseCompletely();
+
+    EXPECT_EQ(2, volumeEraseCount());
+    EXPECT_EQ(0, flashfsLogIndexCount());
+    EXPECT_EQ(0u, flashfsGetOffset());
+    EXPECT_TRUE(flashfsIsReady());
+}
+
+TEST_F(FlashfsLogIndexTest, LoggingStartsDuringBackgroundErase)
+{
+    // a volume written by firmware without an index has to be erased completely
+    fillVolumeWithOldLogs();
+    flashfsInit();
+    resetFlashCounters();
+
+    flashfsEraseAsync();
+    EXPECT_FALSE(flashfsIsReady());
+    EXPECT_EQ(0u, flashfsGetOffset());
+
+    uint8_t frame[100];
+    uint32_t written = 0;
+    for (int i = 0; i < 2000; i++) {
+        memset(frame, i, sizeof(frame));
+        if (flashfsGetWriteBufferFreeSpace() >= sizeof(frame)) {
+            flashfsWrite(frame, sizeof(frame), false);
+            written += sizeof(frame);
+        }
+        flashfsFlushAsync(false);
+
+        // the erase stays ahead of the data written to the volume
+        ASSERT_EQ(0, programOverDataCount);
+    }
+    flashfsClose();
+
+    while (!flashfsIsReady()) {
+    }
+
+    EXPECT_EQ(TEST_SECTORS - FLASHFS_LOG_INDEX_SECTORS, volumeEraseCount());
+    EXPECT_EQ(0, programOverDataCount);
+    for (uint32_t offset = written; offset < TEST_VOLUME_SIZE; offset++) {
+        ASSERT_EQ(0xFF, flashMemory[offset]) << offset;
+    }
+
+    // the log written during the erase is indexed, alongside the record of the finished erase
+    flashfsLogEntry_t entry;
+    ASSERT_EQ(2, flashfsLogIndexCount());
+    ASSERT_TRUE(flashfsLogIndexGet(0, &entry) || flashfsLogIndexGet(1, &entry));
+    EXPECT_EQ(0u, entry.start);
+    EXPECT_LE(written, entry.length);
+
+    // and the finished erase isn't resumed after a reboot
+    flashfsInit();
+    EXPECT_TRUE(flashfsIsReady());
+    EXPECT_EQ(entry.length, flashfsGetOffset());
+}
+
+TEST_F(FlashfsLogIndexTest, BackgroundEraseFinishesFromPoll)
+{
+    fillVolumeWithOldLogs();
+    flashfsInit();
+    resetFlashCounters();
+
+    flashfsEraseAsync();
+
+    // nothing is logging or waiting for the erase, only the system task polls
+    for (int i = 0; i < 10 * TEST_SECTORS; i++) {
+        flashfsPoll();
+    }
+
+    EXPECT_EQ(TEST_SECTORS - FLASHFS_LOG_INDEX_SECTORS, volumeEraseCount());
+    for (uint32_t offset = 0; offset < TEST_VOLUME_SIZE; offset++) {
+        ASSERT_EQ(0xFF, flashMemory[offset]) << offset;
+    }
+    EXPECT_TRUE(flashfsIsReady());
+}
+
+TEST_F(FlashfsLogIndexTest, InterruptedEraseIsResumed)
+{
+    fillVolumeWithOldLogs();
+    flashfsInit();
+
+    flashfsEraseAsync();
+
+    // a short log is written and closed, then power is lost while the erase is still running
+    writeLog(3000, 1);
+    flashfsClose();
+    ASSERT_EQ(0x42, flashMemory[TEST_VOLUME_SIZE - 1]);
+
+    flashfsInit();
+
+    // logging continues after the sector holding the indexed log, while the rest of the volume is erased
+    EXPECT_EQ((uint32_t)TEST_SECTOR_SIZE, flashfsGetOffset());
+    EXPECT_FALSE(flashfsIsReady());
+
+    while (!flashfsIsReady()) {
+    }
+
+    EXPECT_EQ(1, flashMemory[0]);
+    for (uint32_t offset = TEST_SECTOR_SIZE; offset < TEST_VOLUME_SIZE; offset++) {
+        ASSERT_EQ(0xFF, flashMemory[offset]) << offset;
+    }
+
+    // the erase isn't resumed again once it has finished
+    flashfsInit();
+    EXPECT_TRUE(flashfsIsReady());
+
+    // the log followed by the erase finished marker
+    flashfsLogEntry_t entry;
+    ASSERT_EQ(2, flashfsLogIndexCount());
+    EXPECT_TRUE(flashfsLogIndexGet(0, &entry));
+    EXPECT_FALSE(flashfsLogIndexGet(1, &entry));
+}
+
+// STUBS
+
+extern "C" {
+
+static uint32_t programAddress;
+
+const flashGeometry_t *flashGetGeometry(void)
+{
+    return &testGeometry;
+}
+
+flashPartition_t *flashPartitionFindByType(flashPartitionType_e type)
+{
+    for (unsigned i = 0; i < ARRAYLEN(testPartitions); i++) {
+        if (testPartitions[i].type == type) {
+            return &testPartitions[i];
+        }
+    }
+    return NULL;
+}
+
+bool flashIsReady(void)
+{
+    return true;
+}
+
+void flashEraseSector(uint32_t address)
+{
+    sectorEraseCount[address / TEST_SECTOR_SIZE]++;
+    memset(flashMemory + address, 0xFF, TEST_SECTOR_SIZE);
+}
+
+static uint32_t programStart;
+
+void flashPageProgramBegin(uint32_t address)
+{
+    programStart = programAddress = address;
+}
+
+void flashPageProgramContinue(const uint8_t *data, int length)
+{
+    // programming can only clear bits
+    for (int i = 0; i < length; i++) {
+        if (flashMemory[programAddress] != 0xFF) {
+            programOverDataCount++;
+        }
+        flashMemory[programAddress++] &= data[i];
+    }
+}
+
+void flashPageProgramFinish(void)
+{
+    programCount++;
+    if (programStart % TEST_PAGE_SIZE != 0 || programAddress - programStart != TEST_PAGE_SIZE) {
+        partialPageProgramCount++;
+    }
+}
+
+void flashPageProgram(uint32_t address, const uint8_t *data, int length)
+{
+    flashPageProgramBegin(address);
+    flashPageProgramContinue(data, length);
+    flashPageProgramFinish();
+}
+
+int flashReadBytes(uint32_t address, uint8_t *buffer, int length)
+{
+    flashReadCount++;
+    memcpy(buffer, flashMemory + address, length);
+    return length;
+}
+
+void flashFlush(void)
+{
+}
+
+}
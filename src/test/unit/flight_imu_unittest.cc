@@ -56,6 +56,11 @@ extern "C" {
 
     void imuComputeRotationMatrix(void);
     void imuUpdateEulerAngles(void);
+    void imuIntegrateQuaternion(float dt, float gx, float gy, float gz);
+    void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz, float gyroDt,
+                             bool useAcc, float ax, float ay, float az,
+                             bool useMag, float mx, float my, float mz,
+                             bool useCOG, float courseOverGround, const float dcmKpGain);
 
     extern quaternion q;
     extern float rMat[3][3];
@@ -196,6 +201,113 @@ TEST(FlightImuTest, TestSmallAngle)
     EXPECT_EQ(0, STATE(SMALL_ANGLE));
 }
 
+#define GYRO_SAMPLE_RATE_HZ 8000
+#define ATTITUDE_TASK_RATE_HZ 100
+#define TEST_ROLL_RATE_AMPLITUDE_DPS 400.0
+#define TEST_ROLL_RATE_FREQUENCY_HZ 2.0
+
+static double testRollRateDps(double t)
+{
+    return TEST_ROLL_RATE_AMPLITUDE_DPS * sin(2 * M_PI * TEST_ROLL_RATE_FREQUENCY_HZ * t);
+}
+
+static double testRollAngleDeg(double t)
+{
+    const double w = 2 * M_PI * TEST_ROLL_RATE_FREQUENCY_HZ;
+    return TEST_ROLL_RATE_AMPLITUDE_DPS / w * (1 - cos(w * t));
+}
+
+static double quaternionRollDeg(void)
+{
+    // rotation about the X axis only
+    return 2 * atan2(q.x, q.w) * 180.0 / M_PI;
+}
+
+static void resetQuaternion(void)
+{
+    q.w = 1.0f;
+    q.x = 0.0f;
+    q.y = 0.0f;
+    q.z = 0.0f;
+    imuComputeRotationMatrix();
+}
+
+TEST(FlightImuTest, TestGyroAttitudeVersusAttitudeTask)
+{
+    const int samples = GYRO_SAMPLE_RATE_HZ;   // one second
+    const int samplesPerAttitudeUpdate = GYRO_SAMPLE_RATE_HZ / ATTITUDE_TASK_RATE_HZ;
+    const float dt = 1.0f / GYRO_SAMPLE_RATE_HZ;
+
+    // loop rate integration, as done by imuUpdateGyroAttitude()
+    resetQuaternion();
+    double maxFastError = 0;
+    for (int i = 1; i <= samples; i++) {
+        const double t = i * (double)dt;
+        imuIntegrateQuaternion(dt, DEGREES_TO_RADIANS(testRollRateDps(t - dt / 2)), 0, 0);
+        maxFastError = fmax(maxFastError, fabs(quaternionRollDeg() - testRollAngleDeg(t)));
+    }
+    const double fastFinalError = fabs(quaternionRollDeg() - testRollAngleDeg(1.0));
+
+    // attitude task only, integrating the averaged gyro at 100Hz
+    resetQuaternion();
+    double maxSlowError = 0;
+    double rateSum = 0;
+    for (int i = 1; i <= samples; i++) {
+        const double t = i * (double)dt;
+        rateSum += testRollRateDps(t - dt / 2);
+        if (i % samplesPerAttitudeUpdate == 0) {
+            const float average = rateSum / samplesPerAttitudeUpdate;
+            rateSum = 0;
+            imuMahonyAHRSupdate(samplesPerAttitudeUpdate * dt, DEGREES_TO_RADIANS(average), 0, 0, samplesPerAttitudeUpdate * dt,
+                                false, 0, 0, 0, false, 0, 0, 0, false, 0, 0);
+        }
+        maxSlowError = fmax(maxSlowError, fabs(quaternionRollDeg() - testRollAngleDeg(t)));
+    }
+    const double slowFinalError = fabs(quaternionRollDeg() - testRollAngleDeg(1.0));
+
+    // both estimators must track the integrated angle without drifting
+    EXPECT_LT(fastFinalError, 0.1);
+    EXPECT_LT(slowFinalError, 0.1);
+    // the loop rate attitude is never more than a gyro sample behind
+    EXPECT_LT(maxFastError, 0.1);
+    // whereas the attitude task lags by up to one task period
+    EXPECT_GT(maxSlowError, 10 * maxFastError);
+}
+
+TEST(FlightImuTest, TestGyroIntegratedCorrectionOnly)
+{
+    // given a level attitude and no accelerometer/mag/COG error
+    resetQuaternion();
+
+    // when the gyro has already been integrated at loop rate
+    imuMahonyAHRSupdate(0.01f, DEGREES_TO_RADIANS(500), 0, 0, 0.0f,
+                        false, 0, 0, 0, false, 0, 0, 0, false, 0, 1.0f);
+
+    // then the attitude task does not integrate the gyro a second time
+    EXPECT_FLOAT_EQ(1.0f, q.w);
+    EXPECT_FLOAT_EQ(0.0f, q.x);
+
+    // and when the accelerometer reports a 90 degree roll
+    imuMahonyAHRSupdate(0.01f, 0, 0, 0, 0.0f,
+                        true, 0, 1.0f, 0, false, 0, 0, 0, false, 0, 1.0f);
+
+    // then the correction rolls the estimate towards it
+    EXPECT_GT(quaternionRollDeg(), 0.0);
+}
+
+TEST(FlightImuTest, TestGyroSkippedByLoopRateIsIntegrated)
+{
+    // given a level attitude
+    resetQuaternion();
+
+    // when the loop rate integration skipped half of the attitude period
+    imuMahonyAHRSupdate(0.01f, DEGREES_TO_RADIANS(100), 0, 0, 0.005f,
+                        false, 0, 0, 0, false, 0, 0, 0, false, 0, 1.0f);
+
+    // then the attitude task integrates the gyro for the skipped half only
+    EXPECT_NEAR(0.5, quaternionRollDeg(), 0.01);
+}
+
 // STUBS
 
 extern "C" {
@@ -0,0 +1,191 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <random>
+
+extern "C" {
+    #include "platform.h"
+    #include "build/debug.h"
+
+    #include "common/maths.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "fc/runtime_config.h"
+
+    #include "flight/position.h"
+
+    #include "io/gps.h"
+
+    #include "sensors/barometer.h"
+    #include "sensors/sensors.h"
+
+    PG_REGISTER(barometerConfig_t, barometerConfig, PG_BAROMETER_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+TEST(FlightPositionTest, TestEstimatorConvergesToMeasuredAltitude)
+{
+    altitudeEstimator_t estimator = { 0, 0, 0, false };
+
+    // first measurement initialises the estimate
+    altitudeEstimatorCorrect(&estimator, 100.0f, 0.025f);
+    EXPECT_TRUE(estimator.initialised);
+    EXPECT_FLOAT_EQ(100.0f, estimator.altitudeCm);
+
+    for (int i = 0; i < 40 * 20; i++) {
+        altitudeEstimatorPredict(&estimator, 0.0f, 0.025f);
+        altitudeEstimatorCorrect(&estimator, 600.0f, 0.025f);
+    }
+    EXPECT_NEAR(600.0f, estimator.altitudeCm, 1.0f);
+    EXPECT_NEAR(0.0f, estimator.velocityCmS, 1.0f);
+}
+
+TEST(FlightPositionTest, TestEstimatorLearnsAccelerometerBias)
+{
+    altitudeEstimator_t estimator;
+    altitudeEstimatorInit(&estimator, 0.0f);
+
+    // stationary, with an accelerometer offset of 30cm/s/s
+    for (int i = 0; i < 100 * 30; i++) {
+        altitudeEstimatorPredict(&estimator, 30.0f, 0.01f);
+        if (i % 4 == 0) {
+            altitudeEstimatorCorrect(&estimator, 0.0f, 0.04f);
+        }
+    }
+    EXPECT_NEAR(30.0f, estimator.accBiasCmSS, 1.0f);
+    EXPECT_NEAR(0.0f, estimator.velocityCmS, 2.0f);
+    EXPECT_NEAR(0.0f, estimator.altitudeCm, 2.0f);
+}
+
+// Synthetic flight trace: hover, 2m/s climb, hover. The accelerometer has an offset and
+// noise, the baro is noisy.
+#define TRACE_STEP_US 1000
+#define TRACE_DURATION_US 20000000
+#define ATTITUDE_PERIOD_US 10000
+#define ACC_BIAS_CMSS 15.0
+#define ACC_NOISE_CMSS 50.0
+#define BARO_NOISE_CM 20.0
+
+static int32_t traceBaroAltitudeCm;
+
+static double traceVelocityCmS(double t)
+{
+    if (t < 4) {
+        return 0;
+    } else if (t < 9) {
+        return 200 * 0.5 * (1 - cos(M_PI * (t - 4) / 5));
+    } else if (t < 12) {
+        return 200;
+    } else if (t < 14) {
+        return 200 * 0.5 * (1 + cos(M_PI * (t - 12) / 2));
+    }
+    return 0;
+}
+
+typedef struct traceResult_s {
+    double varioRmsError;
+    double altitudeRmsError;
+} traceResult_t;
+
+static traceResult_t runTrace(timeUs_t startTimeUs, bool useAccelerometer)
+{
+    std::mt19937 generator(7);
+    std::normal_distribution<double> accNoise(0.0, ACC_NOISE_CMSS);
+    std::normal_distribution<double> baroNoise(0.0, BARO_NOISE_CM);
+
+    double altitude = 0;
+    double varioErrorSum = 0;
+    double altitudeErrorSum = 0;
+    int errorCount = 0;
+
+    for (timeUs_t traceTimeUs = 0; traceTimeUs < TRACE_DURATION_US; traceTimeUs += TRACE_STEP_US) {
+        const double t = traceTimeUs * 1e-6;
+        const double dt = TRACE_STEP_US * 1e-6;
+        const double velocity = traceVelocityCmS(t);
+        const double acceleration = (traceVelocityCmS(t + dt) - velocity) / dt;
+        altitude += velocity * dt;
+
+        const timeUs_t currentTimeUs = startTimeUs + traceTimeUs;
+        if (traceTimeUs % ATTITUDE_PERIOD_US == 0) {
+            if (useAccelerometer) {
+                positionUpdateVerticalAcceleration(currentTimeUs, acceleration + ACC_BIAS_CMSS + accNoise(generator));
+            }
+            traceBaroAltitudeCm = lrint(altitude + baroNoise(generator));
+            calculateEstimatedAltitude(currentTimeUs);
+        }
+
+        // let the estimators settle before scoring
+        if (t > 3 && traceTimeUs % ATTITUDE_PERIOD_US == 0) {
+            varioErrorSum += sq(getEstimatedVario() - velocity);
+            altitudeErrorSum += sq(getEstimatedAltitudeCm() - altitude);
+            errorCount++;
+        }
+    }
+
+    traceResult_t result;
+    result.varioRmsError = sqrt(varioErrorSum / errorCount);
+    result.altitudeRmsError = sqrt(altitudeErrorSum / errorCount);
+    return result;
+}
+
+TEST(FlightPositionTest, TestTraceVarioAndAltitude)
+{
+    barometerConfigMutable()->baro_cf_vel = 985;
+
+    // without accelerometer updates the baro differencing vario is used
+    const traceResult_t baroOnly = runTrace(1000000, false);
+    // with them the altitude estimator is used
+    const traceResult_t estimator = runTrace(100000000, true);
+
+    printf("baro only: vario rms error %.1f cm/s, altitude rms error %.1f cm\n", baroOnly.varioRmsError, baroOnly.altitudeRmsError);
+    printf("estimator: vario rms error %.1f cm/s, altitude rms error %.1f cm\n", estimator.varioRmsError, estimator.altitudeRmsError);
+
+    EXPECT_LT(estimator.varioRmsError, 15.0);
+    EXPECT_LT(estimator.varioRmsError, baroOnly.varioRmsError / 2);
+    EXPECT_LT(estimator.altitudeRmsError, baroOnly.altitudeRmsError);
+}
+
+// STUBS
+
+extern "C" {
+uint8_t armingFlags;
+uint8_t stateFlags;
+uint8_t debugMode;
+int16_t debug[DEBUG16_VALUE_COUNT];
+
+gpsSolutionData_t gpsSol;
+int16_t GPS_verticalSpeedInCmS;
+
+bool sensors(uint32_t mask)
+{
+    return mask & SENSOR_BARO;
+}
+
+bool isBaroCalibrationComplete(void) { return true; }
+void performBaroCalibrationCycle(void) {}
+int32_t baroCalculateAltitude(void) { return traceBaroAltitudeCm; }
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <limits.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "config/feature.h"
+
+    #include "fc/runtime_config.h"
+
+    #include "io/dashboard.h"
+    #include "io/gps.h"
+    #include "io/serial.h"
+
+    #include "sensors/sensors.h"
+
+    #include "pg/pg.h"
+
+    extern uint8_t ubloxNavPvtConfig[];
+    void ubloxBuildNavPvtConfig(void);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static const uint8_t expectedDisableMessages[] = {
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x02, 0x00, 0x0D, 0x46,   // NAV-POSLLH off
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x03, 0x00, 0x0E, 0x48,   // NAV-STATUS off
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x06, 0x00, 0x11, 0x4E,   // NAV-SOL off
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x12, 0x00, 0x1D, 0x66,   // NAV-VELNED off
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x07, 0x01, 0x13, 0x51,   // NAV-PVT every solution
+};
+
+TEST(IoGpsTest, TestNavPvtConfig10Hz)
+{
+    // given
+    gpsConfigMutable()->gps_ublox_rate_hz = 10;
+
+    // when
+    ubloxBuildNavPvtConfig();
+
+    // then
+    const uint8_t expectedRate[] = {
+        0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0x64, 0x00, 0x01, 0x00, 0x01, 0x00, 0x7A, 0x12  // CFG-RATE 100ms
+    };
+    EXPECT_EQ(0, memcmp(expectedDisableMessages, ubloxNavPvtConfig, sizeof(expectedDisableMessages)));
+    EXPECT_EQ(0, memcmp(expectedRate, ubloxNavPvtConfig + sizeof(expectedDisableMessages), sizeof(expectedRate)));
+}
+
+TEST(IoGpsTest, TestNavPvtConfigRateLimited)
+{
+    // given
+    gpsConfigMutable()->gps_ublox_rate_hz = 50;
+
+    // when
+    ubloxBuildNavPvtConfig();
+
+    // then the measurement period is limited to 25Hz
+    const uint8_t expectedRate[] = {
+        0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0x28, 0x00, 0x01, 0x00, 0x01, 0x00, 0x3E, 0xAA  // CFG-RATE 40ms
+    };
+    EXPECT_EQ(0, memcmp(expectedDisableMessages, ubloxNavPvtConfig, sizeof(expectedDisableMessages)));
+    EXPECT_EQ(0, memcmp(expectedRate, ubloxNavPvtConfig + sizeof(expectedDisableMessages), sizeof(expectedRate)));
+}
+
+// STUBS
+
+extern "C" {
+uint8_t armingFlags;
+uint8_t stateFlags;
+const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
+        400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000}; // see baudRate_e
+
+uint32_t micros(void) { return 0; }
+uint32_t millis(void) { return 0; }
+
+bool featureIsEnabled(uint32_t) { return false; }
+bool sensors(uint32_t) { return false; }
+void sensorsSet(uint32_t) { }
+void sensorsClear(uint32_t) { }
+
+void dashboardUpdate(timeUs_t) { }
+void dashboardShowFixedPage(pageId_e) { }
+
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) { return NULL; }
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) { return NULL; }
+void waitForSerialPortToFinishTransmitting(serialPort_t *) { }
+baudRate_e lookupBaudRateIndex(uint32_t) { return BAUD_AUTO; }
+void serialPassthrough(serialPort_t *, serialPort_t *, serialConsumer *, serialConsumer *) { }
+void serialWrite(serialPort_t *, uint8_t) { }
+uint32_t serialRxBytesWaiting(const serialPort_t *) { return 0; }
+uint8_t serialRead(serialPort_t *) { return 0; }
+void serialSetBaudRate(serialPort_t *, uint32_t) { }
+void serialSetMode(serialPort_t *, portMode_e) { }
+bool isSerialTransmitBufferEmpty(const serialPort_t *) { return true; }
+void serialPrint(serialPort_t *, const char *) { }
+uint32_t serialGetBaudRate(serialPort_t *) { return 0; }
+}
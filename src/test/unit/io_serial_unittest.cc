@@ -23,13 +23,18 @@
 extern "C" {
     #include "platform.h"
 
+    #include "common/utils.h"
+
     #include "drivers/serial.h"
     #include "drivers/serial_softserial.h"
     #include "drivers/serial_uart.h"
 
     #include "io/serial.h"
 
+    #include "pg/pg.h"
+
     void serialInit(bool softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+    void serialBufferRequirement(uint16_t functionMask, uint16_t *rxBufferSize, uint16_t *txBufferSize);
 }
 
 #include "unittest_macros.h"
@@ -47,6 +52,177 @@ TEST(IoSerialTest, TestFindPortConfig)
     EXPECT_EQ(NULL, portConfig);
 }
 
+typedef struct uartBuffers_s {
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint16_t rxBufferSize;
+    uint16_t txBufferSize;
+} uartBuffers_t;
+
+static uartBuffers_t uartBuffers[UARTDEV_8 + 1];
+static serialPort_t uartPorts[UARTDEV_8 + 1];
+
+static const serialPortIdentifier_e uartIdentifiers[] = {
+    SERIAL_PORT_USART1, SERIAL_PORT_USART2, SERIAL_PORT_USART3, SERIAL_PORT_UART4, SERIAL_PORT_UART5
+};
+
+class SerialBufferPoolTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        memset(uartBuffers, 0, sizeof(uartBuffers));
+        pgResetFn_serialConfig(serialConfigMutable());
+        serialConfigMutable()->portConfigs[0].functionMask = 0;
+        for (unsigned i = 0; i < ARRAYLEN(uartIdentifiers); i++) {
+            serialPinConfigMutable()->ioTagTx[SERIAL_PORT_IDENTIFIER_TO_INDEX(uartIdentifiers[i])] = 1;
+            serialPinConfigMutable()->ioTagRx[SERIAL_PORT_IDENTIFIER_TO_INDEX(uartIdentifiers[i])] = 1;
+        }
+    }
+
+    virtual void TearDown() {
+        memset(serialConfigMutable(), 0, sizeof(serialConfig_t));
+        memset(serialPinConfigMutable(), 0, sizeof(serialPinConfig_t));
+    }
+
+    void configure(serialPortIdentifier_e identifier, uint16_t functionMask) {
+        serialFindPortConfiguration(identifier)->functionMask = functionMask;
+    }
+
+    const serialPortBuffers_t *buffers(serialPortIdentifier_e identifier) {
+        return &findSerialPortUsageByIdentifier(identifier)->buffers;
+    }
+
+    void expectBuffersFitPool(void) {
+        uint32_t total = 0;
+        for (unsigned i = 0; i < ARRAYLEN(uartIdentifiers); i++) {
+            const serialPortBuffers_t *portBuffers = buffers(uartIdentifiers[i]);
+            total += portBuffers->rxBufferSize + portBuffers->txBufferSize;
+            if (portBuffers->rxBufferSize) {
+                // powers of two, and no larger than what the port's functions asked for
+                EXPECT_EQ(0, portBuffers->rxBufferSize & (portBuffers->rxBufferSize - 1));
+                EXPECT_EQ(0, portBuffers->txBufferSize & (portBuffers->txBufferSize - 1));
+                EXPECT_LE(portBuffers->rxBufferSize, portBuffers->rxBufferWanted);
+                EXPECT_LE(portBuffers->txBufferSize, portBuffers->txBufferWanted);
+                EXPECT_EQ(portBuffers->rxBuffer + portBuffers->rxBufferSize, portBuffers->txBuffer);
+            }
+        }
+        EXPECT_EQ(total, serialGetBufferPoolUsed());
+        EXPECT_LE(total, (uint32_t)SERIAL_BUFFER_POOL_SIZE);
+    }
+};
+
+TEST_F(SerialBufferPoolTest, SharedPortsTakeTheLargestRequirement)
+{
+    uint16_t rxBufferSize;
+    uint16_t txBufferSize;
+
+    serialBufferRequirement(FUNCTION_BLACKBOX, &rxBufferSize, &txBufferSize);
+    EXPECT_EQ(32, rxBufferSize);
+    EXPECT_EQ(1024, txBufferSize);
+
+    serialBufferRequirement(FUNCTION_MSP | FUNCTION_TELEMETRY_LTM, &rxBufferSize, &txBufferSize);
+    EXPECT_EQ(256, rxBufferSize);
+    EXPECT_EQ(512, txBufferSize);
+
+    serialBufferRequirement(FUNCTION_RX_SERIAL | FUNCTION_TELEMETRY_FRSKY_HUB, &rxBufferSize, &txBufferSize);
+    EXPECT_EQ(128, rxBufferSize);
+    EXPECT_EQ(128, txBufferSize);
+
+    serialBufferRequirement(FUNCTION_NONE, &rxBufferSize, &txBufferSize);
+    EXPECT_EQ(0, rxBufferSize);
+    EXPECT_EQ(0, txBufferSize);
+}
+
+TEST_F(SerialBufferPoolTest, ConfiguredPortsAreSizedByFunction)
+{
+    configure(SERIAL_PORT_USART1, FUNCTION_MSP);
+    configure(SERIAL_PORT_USART2, FUNCTION_RX_SERIAL);
+    configure(SERIAL_PORT_USART3, FUNCTION_GPS);
+
+    serialInit(false, SERIAL_PORT_NONE);
+
+    EXPECT_EQ(256, buffers(SERIAL_PORT_USART1)->rxBufferSize);
+    EXPECT_EQ(512, buffers(SERIAL_PORT_USART1)->txBufferSize);
+    EXPECT_EQ(128, buffers(SERIAL_PORT_USART2)->rxBufferSize);
+    EXPECT_EQ(128, buffers(SERIAL_PORT_USART2)->txBufferSize);
+    EXPECT_EQ(256, buffers(SERIAL_PORT_USART3)->rxBufferSize);
+    EXPECT_EQ(64, buffers(SERIAL_PORT_USART3)->txBufferSize);
+
+    // ports without a function use no RAM, where every UART used to take 384 bytes
+    EXPECT_EQ(0, buffers(SERIAL_PORT_UART4)->rxBufferSize);
+    EXPECT_EQ(0, buffers(SERIAL_PORT_UART5)->rxBufferSize);
+    EXPECT_EQ(1344u, serialGetBufferPoolUsed());
+    expectBuffersFitPool();
+}
+
+TEST_F(SerialBufferPoolTest, LargestBuffersAreHalvedToFit)
+{
+    configure(SERIAL_PORT_USART1, FUNCTION_MSP);
+    configure(SERIAL_PORT_USART2, FUNCTION_BLACKBOX);
+    configure(SERIAL_PORT_USART3, FUNCTION_TELEMETRY_MAVLINK);
+    configure(SERIAL_PORT_UART4, FUNCTION_GPS);
+    configure(SERIAL_PORT_UART5, FUNCTION_RX_SERIAL);
+
+    serialInit(false, SERIAL_PORT_NONE);
+
+    // 2720 bytes wanted, the blackbox and then the MSP transmit buffers give way
+    EXPECT_EQ(512, buffers(SERIAL_PORT_USART2)->txBufferSize);
+    EXPECT_EQ(1024, buffers(SERIAL_PORT_USART2)->txBufferWanted);
+    EXPECT_EQ(256, buffers(SERIAL_PORT_USART1)->txBufferSize);
+    EXPECT_EQ(256, buffers(SERIAL_PORT_USART1)->rxBufferSize);
+    EXPECT_EQ(128, buffers(SERIAL_PORT_UART5)->rxBufferSize);
+    EXPECT_EQ(1952u, serialGetBufferPoolUsed());
+    expectBuffersFitPool();
+}
+
+TEST_F(SerialBufferPoolTest, OpenPassesBuffersToDriver)
+{
+    configure(SERIAL_PORT_USART2, FUNCTION_GPS);
+    serialInit(false, SERIAL_PORT_NONE);
+
+    serialPort_t *port = openSerialPort(SERIAL_PORT_USART2, FUNCTION_GPS, NULL, NULL, 57600, MODE_RXTX, SERIAL_NOT_INVERTED);
+    ASSERT_TRUE(port != NULL);
+
+    const uartBuffers_t *driver = &uartBuffers[UARTDEV_2];
+    EXPECT_EQ(buffers(SERIAL_PORT_USART2)->rxBuffer, driver->rxBuffer);
+    EXPECT_EQ(buffers(SERIAL_PORT_USART2)->txBuffer, driver->txBuffer);
+    EXPECT_EQ(256, driver->rxBufferSize);
+    EXPECT_EQ(64, driver->txBufferSize);
+    closeSerialPort(port);
+}
+
+TEST_F(SerialBufferPoolTest, UnconfiguredPortsShareWhatIsLeft)
+{
+    configure(SERIAL_PORT_USART1, FUNCTION_MSP);
+    configure(SERIAL_PORT_USART2, FUNCTION_BLACKBOX);
+    serialInit(false, SERIAL_PORT_NONE);
+    EXPECT_EQ(1824u, serialGetBufferPoolUsed());
+
+    // 224 bytes left less the minimum kept for USART4 and USART5, passthrough gets smaller buffers than the defaults
+    serialPort_t *port = openSerialPort(SERIAL_PORT_USART3, FUNCTION_NONE, NULL, NULL, 115200, MODE_RXTX, SERIAL_NOT_INVERTED);
+    ASSERT_TRUE(port != NULL);
+    EXPECT_EQ(64, uartBuffers[UARTDEV_3].rxBufferSize);
+    EXPECT_EQ(32, uartBuffers[UARTDEV_3].txBufferSize);
+    EXPECT_EQ(1920u, serialGetBufferPoolUsed());
+    expectBuffersFitPool();
+
+    // reopening the port reuses its buffers
+    volatile uint8_t *rxBuffer = uartBuffers[UARTDEV_3].rxBuffer;
+    closeSerialPort(port);
+    port = openSerialPort(SERIAL_PORT_USART3, FUNCTION_NONE, NULL, NULL, 115200, MODE_RXTX, SERIAL_NOT_INVERTED);
+    ASSERT_TRUE(port != NULL);
+    EXPECT_EQ(rxBuffer, uartBuffers[UARTDEV_3].rxBuffer);
+    EXPECT_EQ(1920u, serialGetBufferPoolUsed());
+
+    // the remaining ports still get the minimum buffers
+    ASSERT_TRUE(openSerialPort(SERIAL_PORT_UART4, FUNCTION_NONE, NULL, NULL, 115200, MODE_RXTX, SERIAL_NOT_INVERTED) != NULL);
+    EXPECT_EQ(32, buffers(SERIAL_PORT_UART4)->rxBufferSize);
+    EXPECT_EQ(32, buffers(SERIAL_PORT_UART4)->txBufferSize);
+    ASSERT_TRUE(openSerialPort(SERIAL_PORT_UART5, FUNCTION_NONE, NULL, NULL, 115200, MODE_RXTX, SERIAL_NOT_INVERTED) != NULL);
+    EXPECT_EQ(32, buffers(SERIAL_PORT_UART5)->rxBufferSize);
+    EXPECT_EQ(32, buffers(SERIAL_PORT_UART5)->txBufferSize);
+    EXPECT_EQ(2048u, serialGetBufferPoolUsed());
+    expectBuffersFitPool();
+}
 
 // STUBS
 extern "C" {
@@ -64,8 +240,16 @@ extern "C" {
 
     serialPort_t *usbVcpOpen(void) { return NULL; }
 
-    serialPort_t *uartOpen(UARTDevice_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {
-      return NULL;
+    serialPort_t *uartOpen(UARTDevice_e device, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {
+      return &uartPorts[device];
+    }
+
+    bool uartSetBuffers(UARTDevice_e device, volatile uint8_t *rxBuffer, uint16_t rxBufferSize, volatile uint8_t *txBuffer, uint16_t txBufferSize) {
+      uartBuffers[device].rxBuffer = rxBuffer;
+      uartBuffers[device].rxBufferSize = rxBufferSize;
+      uartBuffers[device].txBuffer = txBuffer;
+      uartBuffers[device].txBufferSize = txBufferSize;
+      return true;
     }
 
     serialPort_t *openSoftSerial(softSerialPortIndex_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {
@@ -16,6 +16,7 @@
  */
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <limits.h>
 
@@ -293,6 +294,105 @@ TEST(ColorTest, parseColor)
     }
 }
 
+// The strip as seen by the driver
+static hsvColor_t stripColors[WS2811_LED_STRIP_LENGTH];
+static int stripLedWrites[WS2811_LED_STRIP_LENGTH];
+static int stripUpdates;
+
+// The layer timers keep running between tests, so each test starts well after the last
+static timeUs_t testStartUs;
+
+static void configureStatusProfile(const char **configs, int count)
+{
+    memset(ledStripStatusModeConfigMutable()->ledConfigs, 0, sizeof(ledStripStatusModeConfig()->ledConfigs));
+    for (int index = 0; index < count; index++) {
+        EXPECT_TRUE(parseLedStripConfig(index, configs[index]));
+    }
+    reevaluateLedConfig();
+    setLedProfile(LED_PROFILE_STATUS);
+
+    memset(stripColors, 0, sizeof(stripColors));
+    memset(stripLedWrites, 0, sizeof(stripLedWrites));
+    stripUpdates = 0;
+    testStartUs += 10 * 1000 * 1000;
+}
+
+static void setTestColor(int index, uint16_t h, uint8_t s, uint8_t v)
+{
+    const hsvColor_t color = { h, s, v };
+    ledStripStatusModeConfigMutable()->colors[index] = color;
+}
+
+TEST(LedStripTest, unchangedStripIsNotSent)
+{
+    // given
+    setTestColor(1, 10, 0, 255);
+    setTestColor(2, 20, 0, 255);
+    const char *configs[] = { "0,0::C:1", "1,0::C:2" };
+    configureStatusProfile(configs, ARRAYLEN(configs));
+
+    // when
+    ledStripUpdate(testStartUs);
+
+    // then
+    EXPECT_EQ(1, stripUpdates);
+    EXPECT_EQ(10, stripColors[0].h);
+    EXPECT_EQ(20, stripColors[1].h);
+
+    // when
+    ledStripUpdate(testStartUs + 100000);
+
+    // then the layers were composited, but nothing changed
+    EXPECT_EQ(1, stripUpdates);
+    EXPECT_EQ(1, stripLedWrites[0]);
+    EXPECT_EQ(1, stripLedWrites[1]);
+
+    // when
+    setTestColor(2, 30, 0, 255);
+    ledStripUpdate(testStartUs + 200000);
+
+    // then
+    EXPECT_EQ(2, stripUpdates);
+    EXPECT_EQ(1, stripLedWrites[0]);
+    EXPECT_EQ(2, stripLedWrites[1]);
+    EXPECT_EQ(30, stripColors[1].h);
+}
+
+TEST(LedStripTest, onlyLedsOfUpdatedLayersAreComposited)
+{
+    // given
+    setTestColor(1, 10, 0, 255);
+    setTestColor(2, 20, 0, 255);
+    const char *configs[] = { "0,0::C:1", "1,0::CO:2" };
+    configureStatusProfile(configs, ARRAYLEN(configs));
+
+    // when
+    ledStripUpdate(testStartUs);
+
+    // then
+    EXPECT_EQ(1, stripUpdates);
+    EXPECT_EQ(10, stripColors[0].h);
+    EXPECT_EQ(20, stripColors[1].h);
+
+    // when only the larson scanner layer is due
+    setTestColor(1, 40, 0, 255);
+    ledStripUpdate(testStartUs + 20000);
+
+    // then only the scanner LED is composited
+    EXPECT_EQ(2, stripUpdates);
+    EXPECT_EQ(1, stripLedWrites[0]);
+    EXPECT_EQ(2, stripLedWrites[1]);
+    EXPECT_EQ(10, stripColors[0].h);
+    EXPECT_EQ(20, stripColors[1].h);
+
+    // when the fixed layers are due
+    ledStripUpdate(testStartUs + 100000);
+
+    // then
+    EXPECT_EQ(40, stripColors[0].h);
+    EXPECT_EQ(20, stripColors[1].h);
+}
+
 extern "C" {
 
 uint8_t armingFlags = 0;
@@ -311,7 +411,9 @@ void ws2811LedStripInit(ioTag_t ioTag) {
     UNUSED(ioTag);
 }
 
-void ws2811UpdateStrip(ledStripFormatRGB_e) {}
+void ws2811UpdateStrip(ledStripFormatRGB_e) {
+    stripUpdates++;
+}
 
 void setLedValue(uint16_t index, const uint8_t value) {
     UNUSED(index);
@@ -319,13 +421,12 @@ void setLedValue(uint16_t index, const uint8_t value) {
 }
 
 void setLedHsv(uint16_t index, const hsvColor_t *color) {
-    UNUSED(index);
-    UNUSED(color);
+    stripColors[index] = *color;
+    stripLedWrites[index]++;
 }
 
 void getLedHsv(uint16_t index, hsvColor_t *color) {
-    UNUSED(index);
-    UNUSED(color);
+    *color = stripColors[index];
 }
 
 
@@ -342,7 +443,7 @@ void setStripColors(const hsvColor_t *colors) {
     UNUSED(colors);
 }
 
-bool isWS2811LedStripReady(void) { return false; }
+bool isWS2811LedStripReady(void) { return true; }
 
 void delay(uint32_t ms)
 {
@@ -0,0 +1,354 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <random>
+
+extern "C" {
+    #include "common/lz4.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define INPUT_SIZE (256 * 1024)
+static uint8_t input[INPUT_SIZE];
+static uint32_t inputSize;
+
+static int readCount;
+
+static int readInput(uint32_t address, uint8_t *buffer, unsigned int len)
+{
+    if (address >= inputSize) {
+        return 0;
+    }
+    if (address + len > inputSize) {
+        len = inputSize - address;
+    }
+    readCount++;
+    memcpy(buffer, &input[address], len);
+    return len;
+}
+
+/*
+ * Reference LZ4 block decoder, as used on the configurator side.
+ *
+ * Returns the number of bytes decoded, or -1 if the block is malformed.
+ */
+static int lz4Decode(const uint8_t *in, int inLen, uint8_t *out, int outLen)
+{
+    const uint8_t *ip = in;
+    const uint8_t *const iend = in + inLen;
+    uint8_t *op = out;
+    uint8_t *const oend = out + outLen;
+
+    while (ip < iend) {
+        const uint8_t token = *ip++;
+
+        uint32_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) {
+                    return -1;
+                }
+                b = *ip++;
+                literalLength += b;
+            } while (b == 255);
+        }
+        if (ip + literalLength > iend || op + literalLength > oend) {
+            return -1;
+        }
+        memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == iend) {
+            // the last sequence is literals only
+            break;
+        }
+
+        if (ip + 2 > iend) {
+            return -1;
+        }
+        const uint32_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (uint32_t)(op - out)) {
+            return -1;
+        }
+
+        uint32_t matchLength = token & 15;
+        if (matchLength == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) {
+                    return -1;
+                }
+                b = *ip++;
+                matchLength += b;
+            } while (b == 255);
+        }
+        matchLength += 4;
+        if (op + matchLength > oend) {
+            return -1;
+        }
+
+        const uint8_t *ref = op - offset;
+        for (uint32_t i = 0; i < matchLength; i++) {
+            *op++ = *ref++;
+        }
+        if (ip >= iend) {
+            // a block can't end with a match
+            return -1;
+        }
+    }
+
+    return op - out;
+}
+
+// Checks the end of block rules by replaying the sequences of a block
+static bool lz4EndOfBlockRulesHold(const uint8_t *in, int inLen, int decodedLen)
+{
+    const uint8_t *ip = in;
+    const uint8_t *const iend = in + inLen;
+    int pos = 0;
+
+    while (ip < iend) {
+        const uint8_t token = *ip++;
+        uint32_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            uint8_t b;
+            do {
+                b = *ip++;
+                literalLength += b;
+            } while (b == 255);
+        }
+        ip += literalLength;
+        pos += literalLength;
+        if (ip == iend) {
+            break;
+        }
+        ip += 2;
+        uint32_t matchLength = token & 15;
+        if (matchLength == 15) {
+            uint8_t b;
+            do {
+                b = *ip++;
+                matchLength += b;
+            } while (b == 255);
+        }
+        matchLength += 4;
+        if (pos + 12 > decodedLen || pos + (int)matchLength + 5 > decodedLen) {
+            return false;
+        }
+        pos += matchLength;
+    }
+    return true;
+}
+
+// Blackbox-like data: a text header followed by frames of small varying values
+static void fillBlackbox(uint32_t size)
+{
+    std::mt19937 rng(1);
+    uint32_t pos = 0;
+
+    const char *header = "H Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\nH I interval:1\n";
+    while (pos < 2000 && pos < size) {
+        input[pos] = header[pos % strlen(header)];
+        pos++;
+    }
+
+    uint32_t iteration = 0;
+    int16_t gyro[3] = { 0, 0, 0 };
+    while (pos < size) {
+        const bool intraFrame = (iteration % 32) == 0;
+        uint8_t frame[40];
+        int len = 0;
+        frame[len++] = intraFrame ? 'I' : 'P';
+        frame[len++] = iteration & 0x7f;
+        for (int axis = 0; axis < 3; axis++) {
+            gyro[axis] += (int)(rng() % 9) - 4;
+            frame[len++] = intraFrame ? (gyro[axis] >> 8) : 0;
+            frame[len++] = gyro[axis] & 0x7f;
+        }
+        for (int motor = 0; motor < 4; motor++) {
+            frame[len++] = 0x10 + motor;
+            frame[len++] = rng() % 4;
+        }
+        frame[len++] = 0;
+        frame[len++] = 0;
+        for (int i = 0; i < len && pos < size; i++) {
+            input[pos++] = frame[i];
+        }
+        iteration++;
+    }
+    inputSize = size;
+}
+
+static void fillRandom(uint32_t size)
+{
+    std::mt19937 rng(2);
+    for (uint32_t i = 0; i < size; i++) {
+        input[i] = rng();
+    }
+    inputSize = size;
+}
+
+static void fillConstant(uint32_t size, uint8_t value)
+{
+    memset(input, value, size);
+    inputSize = size;
+}
+
+// Compress one block from address, decode it and check it against the input
+static uint32_t checkRoundTrip(uint32_t address, int outLen, uint32_t inLen)
+{
+    static uint8_t block[8192 + 64];
+    static uint8_t decoded[LZ4_MAX_INPUT_SIZE];
+
+    // guard bytes catch the encoder writing past the end of the block
+    memset(block, 0xA5, sizeof(block));
+
+    uint32_t consumed = 0xFFFFFFFF;
+    const int written = lz4EncodeStreaming(block, outLen, readInput, address, inLen, &consumed);
+
+    EXPECT_LE(written, outLen);
+    for (int i = outLen; i < outLen + 64; i++) {
+        EXPECT_EQ(0xA5, block[i]) << "overrun at " << i;
+    }
+    EXPECT_LE(consumed, inLen);
+    EXPECT_LE(consumed, (uint32_t)LZ4_MAX_INPUT_SIZE);
+
+    const int decodedLen = lz4Decode(block, written, decoded, sizeof(decoded));
+    EXPECT_EQ((int)consumed, decodedLen);
+    if (decodedLen > 0) {
+        EXPECT_EQ(0, memcmp(decoded, &input[address], decodedLen));
+        EXPECT_TRUE(lz4EndOfBlockRulesHold(block, written, decodedLen));
+    }
+
+    return consumed;
+}
+
+TEST(LZ4Test, EmptyInput)
+{
+    fillConstant(100, 0);
+
+    uint8_t block[16];
+    uint32_t consumed;
+    const int written = lz4EncodeStreaming(block, sizeof(block), readInput, 0, 0, &consumed);
+
+    // a single empty literal run
+    EXPECT_EQ(1, written);
+    EXPECT_EQ(0, block[0]);
+    EXPECT_EQ(0u, consumed);
+}
+
+TEST(LZ4Test, ShortInputIsLiterals)
+{
+    fillConstant(12, 'x');
+
+    uint8_t block[32];
+    uint32_t consumed;
+    const int written = lz4EncodeStreaming(block, sizeof(block), readInput, 0, 12, &consumed);
+
+    // blocks shorter than 13 bytes can't hold a match
+    EXPECT_EQ(13, written);
+    EXPECT_EQ(12u, consumed);
+    EXPECT_EQ(0xC0, block[0]);
+}
+
+TEST(LZ4Test, BlackboxRoundTrip)
+{
+    fillBlackbox(INPUT_SIZE);
+
+    const int outLens[] = { 16, 64, 200, 1024, 4096, 8192 };
+    for (unsigned i = 0; i < ARRAYLEN(outLens); i++) {
+        uint32_t address = 0;
+        while (address < inputSize) {
+            const uint32_t consumed = checkRoundTrip(address, outLens[i], MIN(inputSize - address, (uint32_t)outLens[i] * 8));
+            ASSERT_GT(consumed, 0u);
+            address += consumed;
+        }
+    }
+}
+
+TEST(LZ4Test, IncompressibleRoundTrip)
+{
+    fillRandom(64 * 1024);
+
+    const int outLens[] = { 14, 100, 4096 };
+    for (unsigned i = 0; i < ARRAYLEN(outLens); i++) {
+        const uint32_t consumed = checkRoundTrip(0, outLens[i], inputSize);
+        // random data costs a length byte per 255 literals, but the encoder stays close to the output size
+        EXPECT_GE(consumed, (uint32_t)(outLens[i] - 1 - outLens[i] / 255 - 1));
+    }
+}
+
+TEST(LZ4Test, RunsAreLimitedByMaxInput)
+{
+    fillConstant(INPUT_SIZE, 0xFF);
+
+    const uint32_t consumed = checkRoundTrip(0, 4096, INPUT_SIZE);
+    EXPECT_EQ((uint32_t)LZ4_MAX_INPUT_SIZE, consumed);
+}
+
+TEST(LZ4Test, EndOfDeviceTruncatesBlock)
+{
+    fillBlackbox(10000);
+
+    // ask for more than the device holds, the read callback stops at the end
+    const uint32_t consumed = checkRoundTrip(9000, 4096, 30000);
+    EXPECT_EQ(1000u, consumed);
+}
+
+TEST(LZ4Test, ReadsAreChunked)
+{
+    fillBlackbox(INPUT_SIZE);
+
+    readCount = 0;
+    const uint32_t consumed = checkRoundTrip(0, 4096, 32768);
+
+    // the window is refilled in large reads, rather than a read per sequence
+    EXPECT_LT(readCount, (int)(consumed / 1024) + 2);
+}
+
+TEST(LZ4Test, BlackboxDataCompresses)
+{
+    fillBlackbox(INPUT_SIZE);
+
+    static uint8_t block[4096];
+    uint32_t inTotal = 0;
+    uint32_t outTotal = 0;
+
+    uint32_t address = 0;
+    while (address < inputSize) {
+        uint32_t consumed;
+        outTotal += lz4EncodeStreaming(block, sizeof(block), readInput, address, MIN(inputSize - address, (uint32_t)sizeof(block) * 8), &consumed);
+        address += consumed;
+        inTotal += consumed;
+    }
+
+    EXPECT_EQ(inputSize, inTotal);
+    EXPECT_LT(outTotal, inTotal * 3 / 4);
+}
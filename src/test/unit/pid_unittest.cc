@@ -80,6 +80,7 @@ extern "C" {
     void beeperConfirmationBeeps(uint8_t) { }
     bool isLaunchControlActive(void) {return unitLaunchControlActive; }
     void disarm(void) { }
+    int16_t imuGetAttitudeAngle(int axis) { return attitude.raw[axis]; }
 }
 
 pidProfile_t *pidProfile;
@@ -532,12 +533,12 @@ TEST(pidControllerTest, testItermRelax) {
 
     applyItermRelax(FD_PITCH, pidData[FD_PITCH].I, gyroRate, &itermErrorRate, &currentPidSetpoint);
 
-    ASSERT_NEAR(-8.16, itermErrorRate, calculateTolerance(-8.16));
+    ASSERT_NEAR(-9.11, itermErrorRate, calculateTolerance(-9.11));
     currentPidSetpoint += ITERM_RELAX_SETPOINT_THRESHOLD;
     applyItermRelax(FD_PITCH, pidData[FD_PITCH].I, gyroRate, &itermErrorRate, &currentPidSetpoint);
-    ASSERT_NEAR(-2.69, itermErrorRate, calculateTolerance(-2.69));
+    ASSERT_NEAR(-5.37, itermErrorRate, calculateTolerance(-5.37));
     applyItermRelax(FD_PITCH, pidData[FD_PITCH].I, gyroRate, &itermErrorRate, &currentPidSetpoint);
-    ASSERT_NEAR(-0.84, itermErrorRate, calculateTolerance(-0.84));
+    ASSERT_NEAR(-3.95, itermErrorRate, calculateTolerance(-3.95));
 
     pidProfile->iterm_relax_type = ITERM_RELAX_GYRO;
     pidInit(pidProfile);
@@ -773,3 +774,84 @@ TEST(pidControllerTest, testLaunchControl) {
     ASSERT_NEAR(44.84,  pidData[FD_YAW].P,   calculateTolerance(44.84));
     ASSERT_NEAR(1.56,   pidData[FD_YAW].I,  calculateTolerance(1.56));
 }
+
+TEST(pidControllerTest, testProfileChange) {
+    unitLaunchControlMode = LAUNCH_CONTROL_MODE_NORMAL;
+    resetTest();
+
+    // profile 0 is profile 1 with twice the roll P
+    *pidProfilesMutable(0) = *pidProfile;
+    pidProfilesMutable(0)->pid[PID_ROLL].P = pidProfile->pid[PID_ROLL].P * 2;
+    pidInit(pidProfile);
+
+    ENABLE_ARMING_FLAG(ARMED);
+    pidStabilisationState(PID_STABILISATION_ON);
+    gyro.gyroADCf[FD_ROLL] = -20;
+
+    pidController(pidProfile, currentTestTime());
+    const float rollP = pidData[FD_ROLL].P;
+    EXPECT_NE(0, rollP);
+
+    // the precalculated runtime of the other profile is used without recalculation
+    pidChangeProfile(0);
+    pidController(pidProfilesMutable(0), currentTestTime());
+    EXPECT_FLOAT_EQ(2 * rollP, pidData[FD_ROLL].P);
+
+    pidChangeProfile(1);
+    pidController(pidProfile, currentTestTime());
+    EXPECT_FLOAT_EQ(rollP, pidData[FD_ROLL].P);
+
+    // a change of the active profile is picked up by pidInitConfig()
+    pidProfile->pid[PID_ROLL].P = pidProfile->pid[PID_ROLL].P * 3;
+    pidInitConfig(pidProfile);
+    pidController(pidProfile, currentTestTime());
+    EXPECT_FLOAT_EQ(3 * rollP, pidData[FD_ROLL].P);
+
+    // copying over the active profile takes effect straight away
+    pidCopyProfile(1, 0);
+    pidController(pidProfile, currentTestTime());
+    EXPECT_FLOAT_EQ(2 * rollP, pidData[FD_ROLL].P);
+}
+
+TEST(pidControllerTest, testProfileChangeKeepsFilterState) {
+    const int changeLoop = 10;
+    float referenceD[XYZ_AXIS_COUNT];
+
+    // run a gyro ramp through the D term filters, changing profile (or not) part way
+    for (int run = 0; run < 3; run++) {
+        resetTest();
+        pidProfile->dterm_lowpass_hz = 50;
+        pidProfile->dterm_lowpass2_hz = 40;
+        pidProfile->dterm_filter2_type = FILTER_PT1;
+        *pidProfilesMutable(0) = *pidProfile;
+        pidInit(pidProfile);
+        ENABLE_ARMING_FLAG(ARMED);
+        pidStabilisationState(PID_STABILISATION_ON);
+
+        for (int loop = 0; loop <= changeLoop; loop++) {
+            if (loop == changeLoop) {
+                if (run == 1) {
+                    pidChangeProfile(0);
+                } else if (run == 2) {
+                    pidInit(pidProfilesMutable(0));
+                }
+            }
+            gyro.gyroADCf[FD_ROLL] = loop * 10;
+            gyro.gyroADCf[FD_PITCH] = -loop * 10;
+            pidController(pidProfile, currentTestTime());
+        }
+
+        for (int axis = FD_ROLL; axis <= FD_PITCH; axis++) {
+            if (run == 0) {
+                referenceD[axis] = pidData[axis].D;
+                EXPECT_NE(0, referenceD[axis]);
+            } else if (run == 1) {
+                // changing to an identical profile is seamless
+                EXPECT_FLOAT_EQ(referenceD[axis], pidData[axis].D);
+            } else {
+                // a full init restarts the filters
+                EXPECT_NE(referenceD[axis], pidData[axis].D);
+            }
+        }
+    }
+}
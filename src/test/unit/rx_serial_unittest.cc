@@ -0,0 +1,650 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Common host harness for the serial RX protocol parsers.
+ *
+ * Each parser is initialised through its normal init function; the serial port it opens
+ * is captured and the byte stream is fed to its receive callback with a simulated clock
+ * advancing at the protocol's line rate. The frame status function is polled after every
+ * byte, as fast as the RX task could possibly poll it.
+ *
+ * The fuzz tests are most useful when built with AddressSanitizer, which turns any
+ * out-of-bounds access in a parser into a test failure:
+ *
+ *     make test_rx_serial_unittest SANITIZE=address
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/crc.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "drivers/serial.h"
+    #include "io/serial.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+    #include "pg/rx.h"
+
+    #include "rx/rx.h"
+    #include "rx/crsf.h"
+    #include "rx/fport.h"
+    #include "rx/ibus.h"
+    #include "rx/jetiexbus.h"
+    #include "rx/sbus.h"
+    #include "rx/sbus_channels.h"
+    #include "rx/spektrum.h"
+    #include "rx/sumd.h"
+    #include "rx/sumh.h"
+    #include "rx/xbus.h"
+
+    #include "telemetry/smartport.h"
+
+    PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define CHANNEL_VALUE_TOLERANCE_US 1
+
+typedef std::vector<uint8_t> byteStream_t;
+
+typedef struct rxSerialProtocol_s {
+    const char *name;
+    SerialRXType provider;
+    bool (*init)(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+    uint8_t channelCount;       // channels carried in each frame and checked after decoding
+    uint32_t frameIntervalUs;
+    // appends one frame to the stream, returns true if all channels are now up to date
+    bool (*encodeFrame)(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex);
+} rxSerialProtocol_t;
+
+typedef struct timedByte_s {
+    uint32_t timeUs;
+    uint8_t value;
+} timedByte_t;
+
+typedef std::vector<timedByte_t> timedStream_t;
+
+typedef struct decodeResult_s {
+    unsigned frames;
+    unsigned framesFailsafe;
+} decodeResult_t;
+
+static uint32_t currentTimeUs;
+
+static serialReceiveCallbackPtr capturedCallback;
+static void *capturedCallbackData;
+static uint32_t capturedBaudRate;
+static portOptions_e capturedOptions;
+
+static rxRuntimeConfig_t harnessRuntimeConfig;
+
+// PROTOCOL ENCODERS
+
+static uint16_t channelUsForFrame(unsigned frameIndex, unsigned channel)
+{
+    return 1000 + (frameIndex * 37 + channel * 101) % 1000;
+}
+
+static void pack11BitChannels(uint8_t *out, const uint16_t *values, unsigned count)
+{
+    memset(out, 0, count * 11 / 8);
+    unsigned bit = 0;
+    for (unsigned i = 0; i < count; i++) {
+        for (unsigned b = 0; b < 11; b++, bit++) {
+            if (values[i] & (1 << b)) {
+                out[bit / 8] |= 1 << (bit % 8);
+            }
+        }
+    }
+}
+
+static uint16_t sbusRawFromUs(uint16_t us)
+{
+    return ((us - 880) * 8 + 4) / 5;
+}
+
+static bool encodeSbusFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    UNUSED(frameIndex);
+
+    uint16_t raw[16];
+    for (int i = 0; i < 16; i++) {
+        raw[i] = sbusRawFromUs(channelsUs[i]);
+    }
+    uint8_t frame[25];
+    frame[0] = 0x0F;
+    pack11BitChannels(&frame[1], raw, 16);
+    frame[23] = 0; // flags
+    frame[24] = 0;
+    stream->insert(stream->end(), frame, frame + sizeof(frame));
+    return true;
+}
+
+static bool encodeCrsfFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    UNUSED(frameIndex);
+
+    uint16_t raw[16];
+    for (int i = 0; i < 16; i++) {
+        raw[i] = lrintf((channelsUs[i] - 881 + 0.5f) / 0.62477120195241f);
+    }
+    uint8_t frame[26];
+    frame[0] = CRSF_ADDRESS_FLIGHT_CONTROLLER;
+    frame[1] = CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_TYPE_CRC;
+    frame[2] = CRSF_FRAMETYPE_RC_CHANNELS_PACKED;
+    pack11BitChannels(&frame[3], raw, 16);
+    uint8_t crc = 0;
+    for (int i = 2; i < 25; i++) {
+        crc = crc8_dvb_s2(crc, frame[i]);
+    }
+    frame[25] = crc;
+    stream->insert(stream->end(), frame, frame + sizeof(frame));
+    return true;
+}
+
+static bool encodeFportFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    UNUSED(frameIndex);
+
+    uint16_t raw[16];
+    for (int i = 0; i < 16; i++) {
+        raw[i] = sbusRawFromUs(channelsUs[i]);
+    }
+    uint8_t payload[28];
+    payload[0] = 25; // length: type, channels, flags and rssi
+    payload[1] = 0; // control frame
+    pack11BitChannels(&payload[2], raw, 16);
+    payload[24] = 0; // flags
+    payload[25] = 100; // rssi
+    uint16_t sum = 0;
+    for (int i = 0; i < 26; i++) {
+        sum += payload[i];
+        sum = (sum & 0xff) + (sum >> 8);
+    }
+    payload[26] = 0xff - sum;
+
+    stream->push_back(0x7E);
+    for (int i = 0; i < 27; i++) {
+        if (payload[i] == 0x7E || payload[i] == 0x7D) {
+            stream->push_back(0x7D);
+            stream->push_back(payload[i] ^ 0x20);
+        } else {
+            stream->push_back(payload[i]);
+        }
+    }
+    stream->push_back(0x7E);
+    return true;
+}
+
+static bool encodeIbusFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    UNUSED(frameIndex);
+
+    uint8_t frame[32];
+    frame[0] = 0x20;
+    frame[1] = 0x40;
+    for (int i = 0; i < 14; i++) {
+        frame[2 + i * 2] = channelsUs[i] & 0xff;
+        frame[3 + i * 2] = channelsUs[i] >> 8;
+    }
+    uint16_t checksum = 0xFFFF;
+    for (int i = 0; i < 30; i++) {
+        checksum -= frame[i];
+    }
+    frame[30] = checksum & 0xff;
+    frame[31] = checksum >> 8;
+    stream->insert(stream->end(), frame, frame + sizeof(frame));
+    return true;
+}
+
+static bool encodeSumdFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    UNUSED(frameIndex);
+
+    uint8_t frame[3 + 16 * 2 + 2];
+    frame[0] = 0xA8;
+    frame[1] = 0x01;
+    frame[2] = 16;
+    for (int i = 0; i < 16; i++) {
+        const uint16_t raw = channelsUs[i] * 8;
+        frame[3 + i * 2] = raw >> 8;
+        frame[4 + i * 2] = raw & 0xff;
+    }
+    uint16_t crc = 0;
+    for (int i = 0; i < 35; i++) {
+        crc = crc16_ccitt(crc, frame[i]);
+    }
+    frame[35] = crc >> 8;
+    frame[36] = crc & 0xff;
+    stream->insert(stream->end(), frame, frame + sizeof(frame));
+    return true;
+}
+
+static bool encodeSumhFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    UNUSED(frameIndex);
+
+    uint8_t frame[21] = { 0 };
+    frame[0] = 0xA8;
+    for (int i = 0; i < 8; i++) {
+        const uint16_t raw = lrintf((channelsUs[i] + 375 + 0.5f) * 6.4f);
+        frame[3 + i * 2] = raw >> 8;
+        frame[4 + i * 2] = raw & 0xff;
+    }
+    stream->insert(stream->end(), frame, frame + sizeof(frame));
+    return true;
+}
+
+// DSMX 2048, 7 channels per frame, alternating between the low and high channels
+static bool encodeSpektrumFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    const bool secondFrame = frameIndex & 1;
+    const unsigned firstChannel = secondFrame ? SPEKTRUM_2048_CHANNEL_COUNT - 7 : 0;
+
+    stream->push_back(0x00); // fades
+    stream->push_back(SPEKTRUM_DSMX_11);
+    for (unsigned i = firstChannel; i < firstChannel + 7; i++) {
+        const uint16_t word = (i << 11) | ((channelsUs[i] - 988) * 2);
+        stream->push_back(word >> 8);
+        stream->push_back(word & 0xff);
+    }
+    return secondFrame;
+}
+
+static bool encodeXbusFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    UNUSED(frameIndex);
+
+    uint8_t frame[27];
+    frame[0] = 0xA1;
+    for (int i = 0; i < 12; i++) {
+        const uint16_t raw = (((channelsUs[i] - 800) << 12) + 1399) / 1400;
+        frame[1 + i * 2] = raw >> 8;
+        frame[2 + i * 2] = raw & 0xff;
+    }
+    const uint16_t crc = crc16_ccitt_update(0, frame, 25);
+    frame[25] = crc >> 8;
+    frame[26] = crc & 0xff;
+    stream->insert(stream->end(), frame, frame + sizeof(frame));
+    return true;
+}
+
+static bool encodeJetiExBusFrame(byteStream_t *stream, const uint16_t *channelsUs, unsigned frameIndex)
+{
+    uint8_t frame[EXBUS_MAX_CHANNEL_FRAME_SIZE];
+    frame[EXBUS_HEADER_SYNC] = 0x3E;
+    frame[EXBUS_HEADER_REQ] = 0x03;
+    frame[EXBUS_HEADER_MSG_LEN] = sizeof(frame);
+    frame[EXBUS_HEADER_PACKET_ID] = frameIndex;
+    frame[EXBUS_HEADER_DATA_ID] = 0x31;
+    frame[EXBUS_HEADER_SUBLEN] = 16 * 2;
+    for (int i = 0; i < 16; i++) {
+        const uint16_t raw = channelsUs[i] * 8;
+        frame[EXBUS_HEADER_DATA + i * 2] = raw & 0xff;
+        frame[EXBUS_HEADER_DATA + i * 2 + 1] = raw >> 8;
+    }
+    const uint16_t crc = jetiExBusCalcCRC16(frame, sizeof(frame) - EXBUS_CRC_LEN);
+    frame[sizeof(frame) - 2] = crc & 0xff;
+    frame[sizeof(frame) - 1] = crc >> 8;
+    stream->insert(stream->end(), frame, frame + sizeof(frame));
+    return true;
+}
+
+static const rxSerialProtocol_t protocols[] = {
+    { "SBUS",     SERIALRX_SBUS,          sbusInit,      16, 14000, encodeSbusFrame },
+    { "CRSF",     SERIALRX_CRSF,          crsfRxInit,    16,  4000, encodeCrsfFrame },
+    { "FPORT",    SERIALRX_FPORT,         fportRxInit,   16,  9000, encodeFportFrame },
+    { "IBUS",     SERIALRX_IBUS,          ibusInit,      14,  7000, encodeIbusFrame },
+    { "SUMD",     SERIALRX_SUMD,          sumdInit,      16, 10000, encodeSumdFrame },
+    { "SUMH",     SERIALRX_SUMH,          sumhInit,       8, 11000, encodeSumhFrame },
+    { "SPEKTRUM", SERIALRX_SPEKTRUM2048,  spektrumInit,  12, 11000, encodeSpektrumFrame },
+    { "XBUS",     SERIALRX_XBUS_MODE_B,   xBusInit,      12, 14000, encodeXbusFrame },
+    { "JETIEXBUS", SERIALRX_JETIEXBUS,    jetiExBusInit, 16, 10000, encodeJetiExBusFrame },
+};
+
+// HARNESS
+
+static void initProtocol(const rxSerialProtocol_t *protocol)
+{
+    // idle line long enough for every parser to drop any partial frame
+    currentTimeUs += 100000;
+
+    capturedCallback = NULL;
+    memset(&harnessRuntimeConfig, 0, sizeof(harnessRuntimeConfig));
+    rxConfigMutable()->serialrx_provider = protocol->provider;
+    rxConfigMutable()->midrc = 1500;
+
+    ASSERT_TRUE(protocol->init(rxConfig(), &harnessRuntimeConfig)) << protocol->name;
+    ASSERT_TRUE(capturedCallback != NULL) << protocol->name;
+}
+
+static double byteTimeUs(void)
+{
+    int bits = 10;
+    if (capturedOptions & SERIAL_PARITY_EVEN) {
+        bits++;
+    }
+    if (capturedOptions & SERIAL_STOPBITS_2) {
+        bits++;
+    }
+    return bits * 1e6 / capturedBaudRate;
+}
+
+// Lays the frames out on the time line, each frame starting at the protocol frame interval.
+static void scheduleFrames(timedStream_t *out, const rxSerialProtocol_t *protocol, const std::vector<byteStream_t> &frames)
+{
+    const double byteUs = byteTimeUs();
+    uint32_t frameStartUs = currentTimeUs;
+    for (const byteStream_t &frame : frames) {
+        double timeUs = frameStartUs;
+        for (uint8_t value : frame) {
+            out->push_back({ (uint32_t)timeUs, value });
+            timeUs += byteUs;
+        }
+        frameStartUs += MAX(protocol->frameIntervalUs, (uint32_t)timeUs - frameStartUs + 1000);
+    }
+}
+
+static std::vector<byteStream_t> generateFrames(const rxSerialProtocol_t *protocol, unsigned count, std::vector<bool> *complete)
+{
+    std::vector<byteStream_t> frames;
+    uint16_t channelsUs[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+    for (unsigned frameIndex = 0; frameIndex < count; frameIndex++) {
+        // values change once per pair of frames, so split frames carry a consistent set
+        for (unsigned i = 0; i < protocol->channelCount; i++) {
+            channelsUs[i] = channelUsForFrame(frameIndex / 2, i);
+        }
+        byteStream_t frame;
+        const bool allChannels = protocol->encodeFrame(&frame, channelsUs, frameIndex);
+        if (complete) {
+            complete->push_back(allChannels);
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+static uint8_t pollFrameStatus(void)
+{
+    uint8_t status = harnessRuntimeConfig.rcFrameStatusFn(&harnessRuntimeConfig);
+    if ((status & RX_FRAME_PROCESSING_REQUIRED) && harnessRuntimeConfig.rcProcessFrameFn) {
+        harnessRuntimeConfig.rcProcessFrameFn(&harnessRuntimeConfig);
+    }
+    return status;
+}
+
+static decodeResult_t feedStream(const timedStream_t &stream)
+{
+    decodeResult_t result = { 0, 0 };
+    for (const timedByte_t &byte : stream) {
+        currentTimeUs = byte.timeUs;
+        capturedCallback(byte.value, capturedCallbackData);
+        const uint8_t status = pollFrameStatus();
+        if (status & RX_FRAME_COMPLETE) {
+            result.frames++;
+            if (status & RX_FRAME_FAILSAFE) {
+                result.framesFailsafe++;
+            }
+        }
+    }
+    return result;
+}
+
+// Applies byte level corruption typical of a noisy or marginal link.
+static std::vector<byteStream_t> corruptFrames(const std::vector<byteStream_t> &frames, std::mt19937 *generator, float errorRate)
+{
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    std::uniform_int_distribution<int> randomByte(0, 255);
+    std::uniform_int_distribution<int> randomBit(0, 7);
+
+    std::vector<byteStream_t> corrupted;
+    for (const byteStream_t &frame : frames) {
+        byteStream_t out;
+        for (uint8_t value : frame) {
+            const float p = chance(*generator);
+            if (p < errorRate) {
+                out.push_back(value ^ (1 << randomBit(*generator)));
+            } else if (p < errorRate * 1.5f) {
+                // dropped byte
+            } else if (p < errorRate * 2.0f) {
+                out.push_back(value);
+                out.push_back(randomByte(*generator));
+            } else {
+                out.push_back(value);
+            }
+        }
+        if (chance(*generator) < errorRate * 2) {
+            // truncated frame
+            out.resize(out.size() / 2);
+        }
+        corrupted.push_back(out);
+    }
+    return corrupted;
+}
+
+// TESTS
+
+TEST(RxSerialTest, TestCleanStreamDecodesEveryFrame)
+{
+    for (const rxSerialProtocol_t &protocol : protocols) {
+        initProtocol(&protocol);
+
+        std::vector<bool> complete;
+        const std::vector<byteStream_t> frames = generateFrames(&protocol, 200, &complete);
+        timedStream_t stream;
+        scheduleFrames(&stream, &protocol, frames);
+
+        unsigned decodedFrames = 0;
+        unsigned frameIndex = 0;
+        size_t byteIndex = 0;
+        for (const byteStream_t &frame : frames) {
+            timedStream_t frameStream(stream.begin() + byteIndex, stream.begin() + byteIndex + frame.size());
+            byteIndex += frame.size();
+            decodedFrames += feedStream(frameStream).frames;
+
+            if (complete[frameIndex]) {
+                for (unsigned i = 0; i < protocol.channelCount; i++) {
+                    EXPECT_NEAR(channelUsForFrame(frameIndex / 2, i), harnessRuntimeConfig.rcReadRawFn(&harnessRuntimeConfig, i), CHANNEL_VALUE_TOLERANCE_US)
+                        << protocol.name << " frame " << frameIndex << " channel " << i;
+                }
+            }
+            frameIndex++;
+        }
+        EXPECT_EQ(frames.size(), decodedFrames) << protocol.name;
+    }
+}
+
+TEST(RxSerialTest, TestCorruptedStream)
+{
+    std::mt19937 generator(42);
+
+    for (const rxSerialProtocol_t &protocol : protocols) {
+        initProtocol(&protocol);
+
+        const std::vector<byteStream_t> frames = corruptFrames(generateFrames(&protocol, 2000, NULL), &generator, 0.01f);
+        timedStream_t stream;
+        scheduleFrames(&stream, &protocol, frames);
+        const decodeResult_t result = feedStream(stream);
+
+        printf("%-10s corrupted stream: %u of %u frames decoded\n", protocol.name, result.frames, (unsigned)frames.size());
+
+        // corruption must never produce frames out of thin air, and must only cost the frames it hits
+        EXPECT_LE(result.frames, frames.size()) << protocol.name;
+        EXPECT_GE(result.frames, frames.size() / 4) << protocol.name;
+    }
+}
+
+TEST(RxSerialTest, TestRandomNoise)
+{
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> randomByte(0, 255);
+    std::uniform_int_distribution<int> randomGap(0, 99);
+
+    for (const rxSerialProtocol_t &protocol : protocols) {
+        initProtocol(&protocol);
+
+        const double byteUs = byteTimeUs();
+        timedStream_t stream;
+        double timeUs = currentTimeUs;
+        for (int i = 0; i < 100000; i++) {
+            stream.push_back({ (uint32_t)timeUs, (uint8_t)randomByte(generator) });
+            // mostly back to back bytes, with the odd inter frame gap
+            const int gap = randomGap(generator);
+            timeUs += gap < 95 ? byteUs : gap * 100.0;
+        }
+        const decodeResult_t result = feedStream(stream);
+
+        printf("%-10s random noise: %u frames accepted\n", protocol.name, result.frames);
+    }
+}
+
+TEST(RxSerialTest, TestLengthAndCountFieldSweep)
+{
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<int> randomByte(0, 255);
+
+    // Every start byte followed by every value of the second and third bytes, where parsers keep
+    // their length and channel count fields, followed by a long run of data without a gap.
+    for (const rxSerialProtocol_t &protocol : protocols) {
+        initProtocol(&protocol);
+
+        std::vector<bool> complete;
+        const std::vector<byteStream_t> frames = generateFrames(&protocol, 1, &complete);
+        const uint8_t startByte = frames[0][0];
+
+        for (int field = 1; field <= 2; field++) {
+            for (int value = 0; value < 256; value++) {
+                byteStream_t frame(frames[0].begin(), frames[0].begin() + field);
+                frame[0] = startByte;
+                frame.push_back(value);
+                for (int i = 0; i < 300; i++) {
+                    frame.push_back(randomByte(generator));
+                }
+                timedStream_t stream;
+                scheduleFrames(&stream, &protocol, std::vector<byteStream_t>(1, frame));
+                feedStream(stream);
+                currentTimeUs += 100000;
+            }
+        }
+    }
+}
+
+TEST(RxSerialTest, TestThroughput)
+{
+    for (const rxSerialProtocol_t &protocol : protocols) {
+        initProtocol(&protocol);
+
+        const std::vector<byteStream_t> frames = generateFrames(&protocol, 20000, NULL);
+        timedStream_t stream;
+        scheduleFrames(&stream, &protocol, frames);
+
+        const auto start = std::chrono::steady_clock::now();
+        const decodeResult_t result = feedStream(stream);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        EXPECT_EQ(frames.size(), result.frames) << protocol.name;
+        printf("%-10s %6.1f Mbyte/s %8.0f frame/s\n", protocol.name,
+            stream.size() / elapsed.count() / 1e6, result.frames / elapsed.count());
+    }
+}
+
+// STUBS
+
+extern "C" {
+
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+rssiSource_e rssiSource;
+linkQualitySource_e linkQualitySource;
+serialPort_t *telemetrySharedPort = NULL;
+
+static serialPortConfig_t stubPortConfig;
+static serialPort_t stubPort;
+
+uint32_t micros(void) { return currentTimeUs; }
+uint32_t millis(void) { return currentTimeUs / 1000; }
+
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e)
+{
+    return &stubPortConfig;
+}
+
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr callback, void *callbackData, uint32_t baudRate, portMode_e, portOptions_e options)
+{
+    capturedCallback = callback;
+    capturedCallbackData = callbackData;
+    capturedBaudRate = baudRate;
+    capturedOptions = options;
+    return &stubPort;
+}
+
+void serialWrite(serialPort_t *, uint8_t) {}
+void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
+uint32_t serialTxBytesFree(const serialPort_t *) { return 64; }
+bool isSerialTransmitBufferEmpty(const serialPort_t *) { return true; }
+bool isSerialPortShared(const serialPortConfig_t *, uint16_t, serialPortFunction_e) { return false; }
+bool telemetryCheckRxPortShared(const serialPortConfig_t *) { return false; }
+
+void setRssi(uint16_t, rssiSource_e) {}
+void setRssiDirect(uint16_t, rssiSource_e) {}
+void setRssiDbm(uint8_t, rssiSource_e) {}
+void setRssiDbmDirect(uint8_t, rssiSource_e) {}
+void setLinkQualityDirect(uint16_t) {}
+
+void crsfScheduleDeviceInfoResponse(void) {}
+void crsfScheduleMspResponse(void) {}
+bool bufferCrsfMspFrame(uint8_t *, int) { return false; }
+void crsfProcessDisplayPortCmd(uint8_t *) {}
+
+bool isChecksumOkIa6b(const uint8_t *ibusPacket, const uint8_t length)
+{
+    uint16_t checksum = 0xFFFF;
+    for (unsigned i = 0; i < (unsigned)ibusPacket[0] - 2; i++) {
+        checksum -= ibusPacket[i];
+    }
+    return (checksum >> 8) == ibusPacket[length - 1] && (checksum & 0xFF) == ibusPacket[length - 2];
+}
+uint8_t respondToIbusRequest(uint8_t const * const) { return 0; }
+void initSharedIbusTelemetry(serialPort_t *) {}
+
+bool initSmartPortTelemetryExternal(smartPortWriteFrameFn *) { return false; }
+void smartPortSendByte(uint8_t, uint16_t *, serialPort_t *) {}
+void smartPortWriteFrameSerial(const smartPortPayload_t *, serialPort_t *, uint16_t) {}
+bool smartPortPayloadContainsMSP(const smartPortPayload_t *) { return false; }
+void processSmartPortTelemetry(smartPortPayload_t *, volatile bool *, const uint32_t *) {}
+
+bool featureIsEnabled(uint32_t) { return false; }
+}
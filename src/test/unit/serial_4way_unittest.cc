@@ -0,0 +1,685 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <random>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "drivers/io.h"
+    #include "drivers/pwm_output.h"
+    #include "drivers/serial.h"
+
+    #include "io/serial_4way.h"
+    #include "io/serial_4way_avrootloader.h"
+
+    extern uint8_32_u DeviceInfo;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define BIT_TIME 52
+#define FRAME_TIME (BIT_TIME * 10)
+
+// 4-way commands and responses
+#define CMD_INTERFACE_EXIT 0x34
+#define CMD_DEVICE_INIT_FLASH 0x37
+#define CMD_DEVICE_PAGE_ERASE 0x39
+#define CMD_DEVICE_READ 0x3A
+#define CMD_DEVICE_WRITE 0x3B
+#define CMD_DEVICE_BUFFER_WRITE 0x41
+#define CMD_DEVICE_BUFFER_FLASH 0x42
+#define BUFFER_FLASH_ERASE 0x01
+#define BUFFER_FLASH_VERIFY 0x02
+#define ACK_OK 0x00
+#define ACK_I_INVALID_PARAM 0x09
+#define ACK_D_GENERAL_ERROR 0x0F
+
+#define ESC_COUNT 8
+#define ESC_FLASH_SIZE 0x4000
+#define ESC_PAGE_SIZE 512
+#define ESC_SIGNATURE 0xE8B2 // EFM8BB21, a SiLabs MCU
+
+// The link to the host, 115200 baud and a round trip through the configurator for each command
+#define HOST_BYTE_TIME 87
+#define HOST_LATENCY 2000
+
+static uint32_t simTime;
+
+static uint32_t maxEdgeError;
+static uint32_t maxFrameSpacingError;
+static int framingErrors;
+
+/*
+ * An ESC running the BLHeli bootloader. It decodes the frames the FC shifts out
+ * on the signal pin, and shifts its responses back on the same pin.
+ */
+typedef struct simEsc_s {
+    bool present;
+    bool corruptWrites;
+
+    // the level the FC drives, the pin is pulled up while it listens
+    bool fcLevel;
+
+    // receiver
+    bool rxBusy;
+    uint32_t rxStart;
+    uint32_t lastFrameStart;
+    std::vector<std::pair<uint32_t, bool>> edges;
+
+    // transmitter
+    std::vector<uint8_t> tx;
+    uint32_t txStart;
+
+    // bootloader
+    bool connected;
+    std::vector<uint8_t> syncWindow;
+    std::vector<uint8_t> packet;
+    int bufferExpected;
+    uint16_t address;
+    uint8_t buffer[256];
+    int bufferLen;
+    uint8_t flash[ESC_FLASH_SIZE];
+} simEsc_t;
+
+static simEsc_t escs[ESC_COUNT];
+static pwmOutputPort_t motors[MAX_SUPPORTED_MOTORS];
+
+// Reference implementation of the bootloader CRC, a bit at a time
+static uint16_t bootloaderCrc(const uint8_t *data, int len)
+{
+    uint16_t crc = 0;
+    for (int i = 0; i < len; i++) {
+        uint8_t xb = data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            if ((xb ^ crc) & 0x01) {
+                crc = (crc >> 1) ^ 0xA001;
+            } else {
+                crc = crc >> 1;
+            }
+            xb >>= 1;
+        }
+    }
+    return crc;
+}
+
+static void escRespond(simEsc_t *esc, const std::vector<uint8_t> &bytes, uint32_t delay)
+{
+    esc->tx = bytes;
+    esc->txStart = simTime + delay;
+}
+
+static void escRespondAck(simEsc_t *esc, uint8_t ack, uint32_t delay)
+{
+    escRespond(esc, std::vector<uint8_t>(1, ack), delay);
+}
+
+static void escReceive(simEsc_t *esc, uint8_t b)
+{
+    if (!esc->connected) {
+        static const uint8_t bootInit[] = { 'B', 'L', 'H', 'e', 'l', 'i', 0xF4, 0x7D };
+
+        esc->syncWindow.push_back(b);
+        if (esc->syncWindow.size() > sizeof(bootInit)) {
+            esc->syncWindow.erase(esc->syncWindow.begin());
+        }
+        if (esc->syncWindow.size() == sizeof(bootInit) && memcmp(esc->syncWindow.data(), bootInit, sizeof(bootInit)) == 0) {
+            const std::vector<uint8_t> bootInfo = { '4', '7', '1', 'c', ESC_SIGNATURE >> 8, ESC_SIGNATURE & 0xff, 6, ESC_FLASH_SIZE / ESC_PAGE_SIZE, brSUCCESS };
+            escRespond(esc, bootInfo, 100);
+            esc->connected = true;
+            esc->packet.clear();
+        }
+        return;
+    }
+
+    esc->packet.push_back(b);
+    const uint8_t *p = esc->packet.data();
+
+    if (esc->bufferExpected) {
+        if ((int)esc->packet.size() == esc->bufferExpected + 2) {
+            if (bootloaderCrc(p, esc->bufferExpected) == (p[esc->bufferExpected] | (p[esc->bufferExpected + 1] << 8))) {
+                memcpy(esc->buffer, p, esc->bufferExpected);
+                esc->bufferLen = esc->bufferExpected;
+                escRespondAck(esc, brSUCCESS, 100);
+            } else {
+                escRespondAck(esc, brERRORCRC, 100);
+            }
+            esc->bufferExpected = 0;
+            esc->packet.clear();
+        }
+        return;
+    }
+
+    const int len = (p[0] == 0xFF || p[0] == 0xFE) ? 4 : 2;
+    if ((int)esc->packet.size() < len + 2) {
+        return;
+    }
+    if (bootloaderCrc(p, len) != (p[len] | (p[len + 1] << 8))) {
+        escRespondAck(esc, brERRORCRC, 100);
+        esc->packet.clear();
+        return;
+    }
+
+    switch (p[0]) {
+    case 0x00: // run, restarts the bootloader
+        esc->connected = false;
+        esc->syncWindow.clear();
+        break;
+    case 0xFF: // set address
+        esc->address = (p[2] << 8) | p[3];
+        escRespondAck(esc, brSUCCESS, 100);
+        break;
+    case 0xFE: // set buffer, the data follows without an ack
+        esc->bufferExpected = (p[2] << 8) | p[3];
+        break;
+    case 0x01: // program flash, bits can only be cleared
+        for (int i = 0; i < esc->bufferLen; i++) {
+            esc->flash[(esc->address + i) % ESC_FLASH_SIZE] &= esc->buffer[i];
+        }
+        if (esc->corruptWrites) {
+            esc->flash[esc->address] ^= 0x01;
+        }
+        escRespondAck(esc, brSUCCESS, 1000);
+        break;
+    case 0x02: // erase the page holding the address
+        memset(&esc->flash[esc->address & ~(ESC_PAGE_SIZE - 1)], 0xFF, ESC_PAGE_SIZE);
+        escRespondAck(esc, brSUCCESS, 20000);
+        break;
+    case 0x03: { // read flash
+        const int count = p[1] ? p[1] : 256;
+        std::vector<uint8_t> response(&esc->flash[esc->address], &esc->flash[esc->address + count]);
+        const uint16_t crc = bootloaderCrc(response.data(), count);
+        response.push_back(crc & 0xff);
+        response.push_back(crc >> 8);
+        response.push_back(brSUCCESS);
+        escRespond(esc, response, 100);
+        break;
+    }
+    default:
+        escRespondAck(esc, brERRORCOMMAND, 100);
+        break;
+    }
+    esc->packet.clear();
+}
+
+static bool fcLevelAt(const simEsc_t *esc, uint32_t t)
+{
+    bool level = true;
+    for (const auto &edge : esc->edges) {
+        if (edge.first > t) {
+            break;
+        }
+        level = edge.second;
+    }
+    return level;
+}
+
+static bool escTxLevel(const simEsc_t *esc)
+{
+    if (esc->tx.empty() || simTime < esc->txStart) {
+        return true;
+    }
+    const uint32_t elapsed = simTime - esc->txStart;
+    const uint8_t b = esc->tx[elapsed / FRAME_TIME];
+    const int bit = (elapsed % FRAME_TIME) / BIT_TIME;
+    if (bit == 0) {
+        return false;
+    }
+    if (bit == 9) {
+        return true;
+    }
+    return b & (1 << (bit - 1));
+}
+
+static void simUpdate(void)
+{
+    for (int i = 0; i < ESC_COUNT; i++) {
+        simEsc_t *esc = &escs[i];
+
+        // sample the middle of each bit once the frame is complete
+        if (esc->rxBusy && simTime >= esc->rxStart + BIT_TIME * 9 + BIT_TIME / 2) {
+            uint16_t bits = 0;
+            for (int bit = 0; bit < 10; bit++) {
+                if (fcLevelAt(esc, esc->rxStart + bit * BIT_TIME + BIT_TIME / 2)) {
+                    bits |= 1 << bit;
+                }
+            }
+            esc->rxBusy = false;
+            esc->edges.clear();
+            if ((bits & 0x001) || !(bits & 0x200)) {
+                framingErrors++;
+            } else if (esc->present) {
+                escReceive(esc, bits >> 1);
+            }
+        }
+
+        if (!esc->tx.empty() && simTime >= esc->txStart + esc->tx.size() * FRAME_TIME) {
+            esc->tx.clear();
+        }
+    }
+}
+
+static void fcDrive(IO_t io, bool level)
+{
+    simUpdate();
+
+    simEsc_t *esc = (simEsc_t *)io;
+    if (level == esc->fcLevel) {
+        return;
+    }
+    esc->fcLevel = level;
+
+    if (!esc->rxBusy) {
+        if (!level) {
+            // start bit
+            if (simTime - esc->lastFrameStart < 2 * FRAME_TIME) {
+                // a frame following on in the same packet
+                const uint32_t spacing = simTime - esc->lastFrameStart;
+                maxFrameSpacingError = MAX(maxFrameSpacingError, (uint32_t)ABS((int32_t)spacing - FRAME_TIME));
+            }
+            esc->rxBusy = true;
+            esc->rxStart = simTime;
+            esc->lastFrameStart = simTime;
+            esc->edges.push_back(std::make_pair(simTime, level));
+        }
+        return;
+    }
+
+    const uint32_t offset = (simTime - esc->rxStart) % BIT_TIME;
+    maxEdgeError = MAX(maxEdgeError, MIN(offset, BIT_TIME - offset));
+    esc->edges.push_back(std::make_pair(simTime, level));
+}
+
+// The host side of the 4-way interface
+
+static std::vector<uint8_t> hostIn;
+static size_t hostInPos;
+static std::vector<size_t> commandStarts;
+static std::vector<uint8_t> hostOut;
+static int responseBytesPending;
+
+typedef struct {
+    uint8_t cmd;
+    uint16_t address;
+    std::vector<uint8_t> params;
+    uint8_t ack;
+} response_t;
+
+static void sendCommand(uint8_t cmd, uint16_t address, const uint8_t *params, int len)
+{
+    commandStarts.push_back(hostIn.size());
+
+    const size_t start = hostIn.size();
+    hostIn.push_back(0x2F);
+    hostIn.push_back(cmd);
+    hostIn.push_back(address >> 8);
+    hostIn.push_back(address & 0xff);
+    hostIn.push_back(len & 0xff);
+    hostIn.insert(hostIn.end(), params, params + len);
+    const uint16_t crc = crc16_ccitt_update(0, &hostIn[start], hostIn.size() - start);
+    hostIn.push_back(crc >> 8);
+    hostIn.push_back(crc & 0xff);
+}
+
+static void sendCommand(uint8_t cmd, uint16_t address, uint8_t param)
+{
+    sendCommand(cmd, address, &param, 1);
+}
+
+static void sendBufferFlash(uint16_t escMask, uint16_t address, uint16_t length, uint8_t flags)
+{
+    const uint8_t params[] = { (uint8_t)(escMask >> 8), (uint8_t)escMask, (uint8_t)(length >> 8), (uint8_t)length, flags };
+    sendCommand(CMD_DEVICE_BUFFER_FLASH, address, params, sizeof(params));
+}
+
+// Runs the interface until it has handled every command sent, and returns its responses
+static std::vector<response_t> runInterface(void)
+{
+    sendCommand(CMD_INTERFACE_EXIT, 0, 0);
+
+    hostOut.clear();
+    responseBytesPending = 0;
+    esc4wayInit();
+    esc4wayProcess(NULL);
+
+    std::vector<response_t> responses;
+    size_t pos = 0;
+    while (pos < hostOut.size()) {
+        response_t response;
+        const uint8_t *p = &hostOut[pos];
+        EXPECT_EQ(0x2E, p[0]);
+        response.cmd = p[1];
+        response.address = (p[2] << 8) | p[3];
+        const int len = p[4] ? p[4] : 256;
+        response.params.assign(&p[5], &p[5 + len]);
+        response.ack = p[5 + len];
+        const uint16_t crc = crc16_ccitt_update(0, p, 6 + len);
+        EXPECT_EQ(crc, (p[6 + len] << 8) | p[7 + len]);
+        responses.push_back(response);
+        pos += 8 + len;
+    }
+
+    hostIn.clear();
+    hostInPos = 0;
+    commandStarts.clear();
+    return responses;
+}
+
+static void fillEscFlash(void)
+{
+    std::mt19937 rng(1);
+    for (int i = 0; i < ESC_COUNT; i++) {
+        for (int j = 0; j < ESC_FLASH_SIZE; j++) {
+            escs[i].flash[j] = rng();
+        }
+    }
+}
+
+class Serial4wayTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        simTime = 100000;
+        maxEdgeError = 0;
+        maxFrameSpacingError = 0;
+        framingErrors = 0;
+        for (int i = 0; i < ESC_COUNT; i++) {
+            simEsc_t *esc = &escs[i];
+            esc->present = true;
+            esc->corruptWrites = false;
+            esc->fcLevel = true;
+            esc->rxBusy = false;
+            esc->lastFrameStart = 0;
+            esc->edges.clear();
+            esc->tx.clear();
+            esc->connected = false;
+            esc->syncWindow.clear();
+            esc->packet.clear();
+            esc->bufferExpected = 0;
+
+            motors[i].enabled = true;
+            motors[i].io = (IO_t)esc;
+        }
+        fillEscFlash();
+        DeviceInfo.dword = 0;
+    }
+};
+
+TEST_F(Serial4wayTest, ConnectAndRead)
+{
+    sendCommand(CMD_DEVICE_INIT_FLASH, 0, 3);
+    sendCommand(CMD_DEVICE_READ, 0x1234, 0);
+    const std::vector<response_t> responses = runInterface();
+
+    ASSERT_EQ(3u, responses.size());
+    EXPECT_EQ(ACK_OK, responses[0].ack);
+    ASSERT_EQ(4u, responses[0].params.size());
+    EXPECT_EQ(ESC_SIGNATURE & 0xff, responses[0].params[0]);
+    EXPECT_EQ(ESC_SIGNATURE >> 8, responses[0].params[1]);
+    EXPECT_EQ(imSIL_BLB, responses[0].params[3]);
+
+    EXPECT_EQ(ACK_OK, responses[1].ack);
+    EXPECT_EQ(0x1234, responses[1].address);
+    ASSERT_EQ(256u, responses[1].params.size());
+    EXPECT_EQ(0, memcmp(responses[1].params.data(), &escs[3].flash[0x1234], 256));
+
+    EXPECT_EQ(0, framingErrors);
+}
+
+TEST_F(Serial4wayTest, BitTiming)
+{
+    uint8_t data[256];
+    for (int i = 0; i < 256; i++) {
+        data[i] = i;
+    }
+
+    sendCommand(CMD_DEVICE_INIT_FLASH, 0, 0);
+    sendCommand(CMD_DEVICE_PAGE_ERASE, 0, 4);
+    sendCommand(CMD_DEVICE_WRITE, 0x0800, data, 256);
+    const std::vector<response_t> responses = runInterface();
+
+    for (unsigned i = 0; i < responses.size(); i++) {
+        EXPECT_EQ(ACK_OK, responses[i].ack);
+    }
+    EXPECT_EQ(0, memcmp(data, &escs[0].flash[0x0800], 256));
+
+    // every edge is on the bit grid of its frame, and frames of a packet follow on without a gap or drift
+    EXPECT_EQ(0, framingErrors);
+    EXPECT_GE(1u, maxEdgeError);
+    EXPECT_EQ(0u, maxFrameSpacingError);
+}
+
+TEST_F(Serial4wayTest, BufferedPageIsFlashedToEveryEsc)
+{
+    uint8_t page[ESC_PAGE_SIZE];
+    for (int i = 0; i < ESC_PAGE_SIZE; i++) {
+        page[i] = i * 7;
+    }
+
+    sendCommand(CMD_DEVICE_BUFFER_WRITE, 0, page, 256);
+    sendCommand(CMD_DEVICE_BUFFER_WRITE, 256, &page[256], 256);
+    sendBufferFlash(0x0F, 0x1000, ESC_PAGE_SIZE, BUFFER_FLASH_ERASE | BUFFER_FLASH_VERIFY);
+    const std::vector<response_t> responses = runInterface();
+
+    ASSERT_EQ(4u, responses.size());
+    EXPECT_EQ(ACK_OK, responses[0].ack);
+    EXPECT_EQ(ACK_OK, responses[1].ack);
+    EXPECT_EQ(ACK_OK, responses[2].ack);
+    ASSERT_EQ(2u, responses[2].params.size());
+    EXPECT_EQ(0, responses[2].params[0]);
+    EXPECT_EQ(0, responses[2].params[1]);
+
+    for (int i = 0; i < ESC_COUNT; i++) {
+        if (i < 4) {
+            EXPECT_EQ(0, memcmp(page, &escs[i].flash[0x1000], ESC_PAGE_SIZE)) << "esc " << i;
+        } else {
+            EXPECT_NE(0, memcmp(page, &escs[i].flash[0x1000], ESC_PAGE_SIZE)) << "esc " << i;
+        }
+    }
+    EXPECT_EQ(0, framingErrors);
+}
+
+TEST_F(Serial4wayTest, FailedEscsAreReported)
+{
+    uint8_t page[256];
+    memset(page, 0x5A, sizeof(page));
+
+    escs[2].present = false;
+    escs[5].corruptWrites = true;
+
+    sendCommand(CMD_DEVICE_BUFFER_WRITE, 0, page, 256);
+    sendBufferFlash(0xFF, 0x2000, 256, BUFFER_FLASH_ERASE | BUFFER_FLASH_VERIFY);
+    const std::vector<response_t> responses = runInterface();
+
+    ASSERT_EQ(3u, responses.size());
+    EXPECT_EQ(ACK_D_GENERAL_ERROR, responses[1].ack);
+    ASSERT_EQ(2u, responses[1].params.size());
+    EXPECT_EQ(0x00, responses[1].params[0]);
+    EXPECT_EQ(0x24, responses[1].params[1]);
+
+    // the ESCs after a failed one are still flashed
+    EXPECT_EQ(0, memcmp(page, &escs[6].flash[0x2000], 256));
+    EXPECT_EQ(0, memcmp(page, &escs[7].flash[0x2000], 256));
+}
+
+TEST_F(Serial4wayTest, InvalidBufferCommandsAreRejected)
+{
+    uint8_t data[256];
+    memset(data, 0, sizeof(data));
+
+    // past the end of the page buffer
+    sendCommand(CMD_DEVICE_BUFFER_WRITE, 1024 - 255, data, 256);
+    // an ESC that isn't there
+    sendBufferFlash(0x100, 0x1000, 256, 0);
+    // longer than the page buffer
+    sendBufferFlash(0x01, 0x1000, 1025, 0);
+    const std::vector<response_t> responses = runInterface();
+
+    ASSERT_EQ(4u, responses.size());
+    EXPECT_EQ(ACK_I_INVALID_PARAM, responses[0].ack);
+    EXPECT_EQ(ACK_I_INVALID_PARAM, responses[1].ack);
+    EXPECT_EQ(ACK_I_INVALID_PARAM, responses[2].ack);
+}
+
+TEST_F(Serial4wayTest, Throughput)
+{
+    static uint8_t image[ESC_PAGE_SIZE];
+    for (unsigned i = 0; i < sizeof(image); i++) {
+        image[i] = i ^ 0xA5;
+    }
+    const uint16_t base = 0x1000;
+
+    // a page to each ESC of a quad in turn, as the configurator does it: erase, write and read back each chunk
+    uint32_t start = simTime;
+    for (int esc = 0; esc < 4; esc++) {
+        sendCommand(CMD_DEVICE_INIT_FLASH, 0, esc);
+        sendCommand(CMD_DEVICE_PAGE_ERASE, 0, base / ESC_PAGE_SIZE);
+        for (int chunk = 0; chunk < ESC_PAGE_SIZE; chunk += 256) {
+            sendCommand(CMD_DEVICE_WRITE, base + chunk, &image[chunk], 256);
+            sendCommand(CMD_DEVICE_READ, base + chunk, 0);
+        }
+    }
+    std::vector<response_t> responses = runInterface();
+    const uint32_t lockstepTime = simTime - start;
+    for (unsigned i = 0; i < responses.size(); i++) {
+        EXPECT_EQ(ACK_OK, responses[i].ack);
+    }
+
+    fillEscFlash();
+
+    // the page is sent to the FC once, and flashed to every ESC and verified there
+    start = simTime;
+    for (int chunk = 0; chunk < ESC_PAGE_SIZE; chunk += 256) {
+        sendCommand(CMD_DEVICE_BUFFER_WRITE, chunk, &image[chunk], 256);
+    }
+    sendBufferFlash(0x0F, base, ESC_PAGE_SIZE, BUFFER_FLASH_ERASE | BUFFER_FLASH_VERIFY);
+    responses = runInterface();
+    const uint32_t bulkTime = simTime - start;
+    for (unsigned i = 0; i < responses.size(); i++) {
+        EXPECT_EQ(ACK_OK, responses[i].ack);
+    }
+    for (int esc = 0; esc < 4; esc++) {
+        EXPECT_EQ(0, memcmp(image, &escs[esc].flash[base], sizeof(image))) << "esc " << esc;
+    }
+
+    EXPECT_LT(bulkTime, lockstepTime * 9 / 10);
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void)
+{
+    simUpdate();
+    return simTime++;
+}
+
+uint32_t millis(void)
+{
+    simUpdate();
+    return simTime++ / 1000;
+}
+
+bool IORead(IO_t io)
+{
+    simUpdate();
+    const simEsc_t *esc = (const simEsc_t *)io;
+    return esc->fcLevel && escTxLevel(esc);
+}
+
+void IOHi(IO_t io)
+{
+    fcDrive(io, true);
+}
+
+void IOLo(IO_t io)
+{
+    fcDrive(io, false);
+}
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg)
+{
+    UNUSED(io);
+    UNUSED(cfg);
+}
+
+pwmOutputPort_t *pwmGetMotors(void)
+{
+    return motors;
+}
+
+void pwmDisableMotors(void) {}
+void pwmEnableMotors(void) {}
+void beeperSilence(void) {}
+
+uint32_t serialRxBytesWaiting(const serialPort_t *instance)
+{
+    UNUSED(instance);
+    return hostIn.size() - hostInPos;
+}
+
+uint8_t serialRead(serialPort_t *instance)
+{
+    UNUSED(instance);
+
+    for (size_t i = 0; i < commandStarts.size(); i++) {
+        if (commandStarts[i] == hostInPos && i > 0) {
+            // the host sends the next command once it has the response to the last one
+            simTime += responseBytesPending * HOST_BYTE_TIME + HOST_LATENCY;
+            responseBytesPending = 0;
+        }
+    }
+    simTime += HOST_BYTE_TIME;
+    return hostIn[hostInPos++];
+}
+
+void serialWrite(serialPort_t *instance, uint8_t ch)
+{
+    UNUSED(instance);
+    hostOut.push_back(ch);
+    responseBytesPending++;
+}
+
+uint32_t serialTxBytesFree(const serialPort_t *instance)
+{
+    UNUSED(instance);
+    return 256;
+}
+
+void serialBeginWrite(serialPort_t *instance)
+{
+    UNUSED(instance);
+}
+
+void serialEndWrite(serialPort_t *instance)
+{
+    UNUSED(instance);
+}
+
+}
@@ -0,0 +1,318 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "fc/runtime_config.h"
+
+    #include "flight/imu.h"
+    #include "flight/mixer.h"
+
+    #include "io/gps.h"
+    #include "io/serial.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "rx/rx.h"
+
+    #include "sensors/battery.h"
+    #include "sensors/sensors.h"
+
+    #include "telemetry/mavlink.h"
+    #include "telemetry/telemetry.h"
+
+    void processMAVLinkTelemetry(timeUs_t currentTimeUs);
+
+    PG_REGISTER(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
+    PG_REGISTER(telemetryConfig_t, telemetryConfig, PG_TELEMETRY_CONFIG, 0);
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#include "common/mavlink.h"
+#pragma GCC diagnostic pop
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TICK_US 4000    // the telemetry task rate
+
+static timeUs_t currentTimeUs;
+
+static serialPort_t testPort;
+static serialPortConfig_t testPortConfig;
+
+// The tx buffer, drained at the baud rate
+static uint32_t txBufferSize;
+static uint32_t txQueued;
+static float txDrain;
+static uint32_t baudRate;
+static int txOverruns;
+static uint32_t bytesSent;
+
+static uint8_t rxQueue[256];
+static int rxHead;
+static int rxTail;
+
+static int messagesReceived[256];
+static mavlink_sys_status_t lastSysStatus;
+
+static void receiveByte(uint8_t c)
+{
+    static mavlink_message_t msg;
+    static mavlink_status_t status;
+
+    if (mavlink_parse_char(MAVLINK_COMM_1, c, &msg, &status)) {
+        messagesReceived[msg.msgid]++;
+        if (msg.msgid == MAVLINK_MSG_ID_SYS_STATUS) {
+            mavlink_msg_sys_status_decode(&msg, &lastSysStatus);
+        }
+    }
+}
+
+static void resetCounters(void)
+{
+    memset(messagesReceived, 0, sizeof(messagesReceived));
+    bytesSent = 0;
+    txOverruns = 0;
+}
+
+static void openPort(baudRate_e baudRateIndex, uint32_t bufferSize)
+{
+    freeMAVLinkTelemetryPort();
+    testPortConfig.telemetry_baudrateIndex = baudRateIndex;
+    baudRate = baudRates[baudRateIndex];
+    txBufferSize = bufferSize;
+    testPort.txBufferSize = bufferSize;
+    txQueued = 0;
+    rxHead = rxTail = 0;
+    initMAVLinkTelemetry();
+    checkMAVLinkTelemetryState();
+}
+
+static void requestDataStream(uint8_t streamId, uint16_t rate, bool start)
+{
+    mavlink_message_t msg;
+    uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+
+    mavlink_msg_request_data_stream_pack(255, 190, &msg, 0, 200, streamId, rate, start);
+    const int len = mavlink_msg_to_send_buffer(buf, &msg);
+    for (int i = 0; i < len; i++) {
+        rxQueue[rxHead++ % sizeof(rxQueue)] = buf[i];
+    }
+}
+
+static void run(timeDelta_t durationUs)
+{
+    for (timeDelta_t t = 0; t < durationUs; t += TICK_US) {
+        currentTimeUs += TICK_US;
+        // a byte takes 10 bits on the wire, carrying the part bytes over to the next tick
+        txDrain += baudRate / 10.0f * TICK_US / 1000000;
+        const uint32_t drained = MIN(txQueued, (uint32_t)txDrain);
+        txQueued -= drained;
+        txDrain -= (uint32_t)txDrain;
+        handleMAVLinkTelemetry();
+    }
+}
+
+class MAVLinkTelemetryTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        currentTimeUs = 1000000;
+        sensorsSet(SENSOR_ACC | SENSOR_GPS);
+        openPort(BAUD_115200, 256);
+        resetCounters();
+    }
+};
+
+TEST_F(MAVLinkTelemetryTest, DefaultRates)
+{
+    run(10000000);
+
+    EXPECT_NEAR(20, messagesReceived[MAVLINK_MSG_ID_SYS_STATUS], 1);
+    EXPECT_NEAR(50, messagesReceived[MAVLINK_MSG_ID_RC_CHANNELS_RAW], 1);
+    EXPECT_NEAR(20, messagesReceived[MAVLINK_MSG_ID_GPS_RAW_INT], 1);
+    EXPECT_NEAR(100, messagesReceived[MAVLINK_MSG_ID_ATTITUDE], 1);
+    EXPECT_NEAR(100, messagesReceived[MAVLINK_MSG_ID_VFR_HUD], 1);
+    EXPECT_NEAR(10, messagesReceived[MAVLINK_MSG_ID_HEARTBEAT], 1);
+    EXPECT_EQ(0, lastSysStatus.drop_rate_comm);
+    EXPECT_EQ(0, txOverruns);
+}
+
+TEST_F(MAVLinkTelemetryTest, RequestedRatesAreHonoured)
+{
+    requestDataStream(MAV_DATA_STREAM_EXTRA1, 25, true);
+    requestDataStream(MAV_DATA_STREAM_RC_CHANNELS, 5, false);
+    run(10000000);
+
+    EXPECT_NEAR(250, messagesReceived[MAVLINK_MSG_ID_ATTITUDE], 2);
+    EXPECT_EQ(0, messagesReceived[MAVLINK_MSG_ID_RC_CHANNELS_RAW]);
+    EXPECT_NEAR(100, messagesReceived[MAVLINK_MSG_ID_VFR_HUD], 1);
+
+    // every stream at once, beyond the max rate
+    resetCounters();
+    requestDataStream(MAV_DATA_STREAM_ALL, 1, true);
+    requestDataStream(MAV_DATA_STREAM_EXTRA2, 200, true);
+    run(10000000);
+
+    EXPECT_NEAR(10, messagesReceived[MAVLINK_MSG_ID_ATTITUDE], 1);
+    EXPECT_NEAR(10, messagesReceived[MAVLINK_MSG_ID_RC_CHANNELS_RAW], 1);
+    EXPECT_NEAR(10, messagesReceived[MAVLINK_MSG_ID_GPS_RAW_INT], 1);
+    EXPECT_NEAR(500, messagesReceived[MAVLINK_MSG_ID_VFR_HUD], 5);
+
+    // a rate that doesn't fit 8 bits is limited, rather than wrapping round to stop the stream
+    resetCounters();
+    requestDataStream(MAV_DATA_STREAM_EXTRA1, 256, true);
+    run(10000000);
+
+    EXPECT_NEAR(500, messagesReceived[MAVLINK_MSG_ID_ATTITUDE], 5);
+}
+
+TEST_F(MAVLinkTelemetryTest, HeartbeatCanNotBeStopped)
+{
+    requestDataStream(MAV_DATA_STREAM_ALL, 0, false);
+    run(10000000);
+
+    EXPECT_EQ(0, messagesReceived[MAVLINK_MSG_ID_ATTITUDE]);
+    EXPECT_EQ(0, messagesReceived[MAVLINK_MSG_ID_VFR_HUD]);
+    EXPECT_NEAR(10, messagesReceived[MAVLINK_MSG_ID_HEARTBEAT], 1);
+
+    requestDataStream(MAV_DATA_STREAM_ALL, 50, true);
+    resetCounters();
+    run(10000000);
+
+    EXPECT_NEAR(10, messagesReceived[MAVLINK_MSG_ID_HEARTBEAT], 1);
+}
+
+TEST_F(MAVLinkTelemetryTest, SlowLinkIsShared)
+{
+    // 960 bytes per second for the 1350 bytes per second the default rates take
+    openPort(BAUD_9600, 256);
+    resetCounters();
+    run(20000000);
+
+    EXPECT_LE(bytesSent, 960u * 20 + 256);
+    EXPECT_GT(bytesSent, 960u * 20 * 9 / 10);
+    EXPECT_EQ(0, txOverruns);
+
+    // the heartbeat keeps its rate, and the high priority streams keep more of theirs
+    EXPECT_NEAR(20, messagesReceived[MAVLINK_MSG_ID_HEARTBEAT], 1);
+    EXPECT_GT(messagesReceived[MAVLINK_MSG_ID_VFR_HUD], messagesReceived[MAVLINK_MSG_ID_RC_CHANNELS_RAW]);
+    EXPECT_GT(messagesReceived[MAVLINK_MSG_ID_SYS_STATUS], 0);
+    EXPECT_GT(messagesReceived[MAVLINK_MSG_ID_GPS_RAW_INT], 0);
+
+    EXPECT_GT(lastSysStatus.drop_rate_comm, 0);
+    EXPECT_GT(lastSysStatus.errors_comm, 0);
+}
+
+TEST_F(MAVLinkTelemetryTest, FullTxBufferDefersStreams)
+{
+    // the receiver's port at 115200 with a small tx buffer, shared with other traffic
+    openPort(BAUD_115200, 128);
+    resetCounters();
+    for (int i = 0; i < 100; i++) {
+        txQueued = txBufferSize - 20;
+        run(TICK_US);
+    }
+    EXPECT_EQ(0, txOverruns);
+
+    run(2000000);
+    EXPECT_GT(lastSysStatus.errors_count1, 0);
+    EXPECT_EQ(0, txOverruns);
+    EXPECT_GT(messagesReceived[MAVLINK_MSG_ID_HEARTBEAT], 0);
+}
+
+TEST_F(MAVLinkTelemetryTest, StreamLargerThanTxBufferIsSkipped)
+{
+    // the position stream is 94 bytes
+    openPort(BAUD_115200, 64);
+    resetCounters();
+    run(2000000);
+
+    EXPECT_EQ(0, messagesReceived[MAVLINK_MSG_ID_GPS_RAW_INT]);
+    EXPECT_GT(messagesReceived[MAVLINK_MSG_ID_ATTITUDE], 0);
+    EXPECT_EQ(0, txOverruns);
+}
+
+// STUBS
+
+extern "C" {
+
+const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000, 400000}; // see baudRate_e
+
+serialPort_t *telemetrySharedPort = NULL;
+
+attitudeEulerAngles_t attitude = { { 0, 0, 0 } };
+gpsSolutionData_t gpsSol;
+int32_t GPS_home[2];
+
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+rxRuntimeConfig_t rxRuntimeConfig;
+
+uint32_t micros(void) { return currentTimeUs; }
+uint32_t millis(void) { return currentTimeUs / 1000; }
+
+void beeperConfirmationBeeps(uint8_t) {}
+bool failsafeIsActive(void) { return false; }
+uint16_t getRssi(void) { return 0; }
+int32_t getEstimatedAltitudeCm(void) { return 0; }
+
+batteryState_e getBatteryState(void) { return BATTERY_OK; }
+bool isBatteryVoltageConfigured(void) { return true; }
+bool isAmperageConfigured(void) { return true; }
+uint16_t getBatteryVoltage(void) { return 1680; }
+int32_t getAmperage(void) { return 1200; }
+int32_t getMAhDrawn(void) { return 350; }
+uint8_t calculateBatteryPercentageRemaining(void) { return 80; }
+
+uint32_t serialRxBytesWaiting(const serialPort_t *) { return rxHead - rxTail; }
+uint8_t serialRead(serialPort_t *) { return rxQueue[rxTail++ % sizeof(rxQueue)]; }
+uint32_t serialTxBytesFree(const serialPort_t *) { return txBufferSize - txQueued; }
+
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count)
+{
+    if (txQueued + count > txBufferSize) {
+        txOverruns++;
+    }
+    txQueued += count;
+    bytesSent += count;
+    for (int i = 0; i < count; i++) {
+        receiveByte(data[i]);
+    }
+}
+
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) { return &testPort; }
+void closeSerialPort(serialPort_t *) {}
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) { return &testPortConfig; }
+portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e) { return PORTSHARING_NOT_SHARED; }
+bool telemetryDetermineEnabledState(portSharing_e) { return true; }
+bool telemetryCheckRxPortShared(const serialPortConfig_t *) { return false; }
+
+}
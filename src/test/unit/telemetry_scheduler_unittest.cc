@@ -0,0 +1,214 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/utils.h"
+
+    #include "telemetry/telemetry_scheduler.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TASK_PERIOD_US 1000
+
+static telemetryScheduler_t scheduler;
+static int sentCount[TELEMETRY_SCHEDULER_MAX_ITEMS];
+static int sentCost;
+
+// Runs the schedule like a telemetry task would, sending whatever is scheduled
+static timeUs_t runSchedule(timeUs_t startUs, timeDelta_t durationUs, int txSpace)
+{
+    memset(sentCount, 0, sizeof(sentCount));
+    sentCost = 0;
+
+    timeUs_t timeUs = startUs;
+    for (; cmpTimeUs(timeUs, startUs) < durationUs; timeUs += TASK_PERIOD_US) {
+        const int item = telemetrySchedulerNext(&scheduler, timeUs, txSpace);
+        if (item != TELEMETRY_SCHEDULER_NONE) {
+            sentCount[item]++;
+            sentCost += scheduler.items[item].cost;
+            telemetrySchedulerSent(&scheduler, item, scheduler.items[item].cost, timeUs);
+        }
+    }
+    return timeUs;
+}
+
+TEST(TelemetrySchedulerTest, ItemsAreSentAtTheirInterval)
+{
+    telemetrySchedulerInit(&scheduler, 0);
+    EXPECT_EQ(0, telemetrySchedulerAdd(&scheduler, 100000, 1, 10));
+    EXPECT_EQ(1, telemetrySchedulerAdd(&scheduler, 20000, 1, 10));
+    EXPECT_EQ(2, telemetrySchedulerAdd(&scheduler, 500000, 1, 10));
+
+    runSchedule(1000000, 10000000, 100);
+
+    // 10 seconds at 10Hz, 50Hz and 2Hz
+    EXPECT_NEAR(100, sentCount[0], 2);
+    EXPECT_NEAR(500, sentCount[1], 25);
+    EXPECT_NEAR(20, sentCount[2], 1);
+}
+
+TEST(TelemetrySchedulerTest, DisabledItemsAreNotSent)
+{
+    telemetrySchedulerInit(&scheduler, 0);
+    telemetrySchedulerAdd(&scheduler, 100000, 1, 10);
+    telemetrySchedulerAdd(&scheduler, 100000, 1, 10);
+    telemetrySchedulerEnable(&scheduler, 0, false);
+
+    runSchedule(1000000, 1000000, 100);
+
+    EXPECT_EQ(0, sentCount[0]);
+    EXPECT_NEAR(10, sentCount[1], 1);
+}
+
+TEST(TelemetrySchedulerTest, BudgetIsRespected)
+{
+    // 200 bytes a second can't carry 4 x 20 byte items at 10Hz
+    telemetrySchedulerInit(&scheduler, 200);
+    for (int i = 0; i < 4; i++) {
+        telemetrySchedulerAdd(&scheduler, 100000, 1, 20);
+    }
+
+    runSchedule(1000000, 10000000, 100);
+
+    EXPECT_LE(sentCost, 200 * 10 + 20);
+    EXPECT_GE(sentCost, 200 * 10 - 40);
+
+    // equal priorities and intervals share the link equally
+    for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(25, sentCount[i], 2);
+    }
+}
+
+TEST(TelemetrySchedulerTest, PriorityGetsTheBandwidthOfASlowLink)
+{
+    // 10 frames a second for 4 items that would like 10Hz each
+    telemetrySchedulerInit(&scheduler, 10);
+    telemetrySchedulerAdd(&scheduler, 100000, 4, 1);
+    telemetrySchedulerAdd(&scheduler, 100000, 3, 1);
+    telemetrySchedulerAdd(&scheduler, 100000, 2, 1);
+    telemetrySchedulerAdd(&scheduler, 100000, 1, 1);
+
+    runSchedule(1000000, 100000000, 1);
+
+    // the link is shared in proportion to the priorities, and nothing starves
+    EXPECT_NEAR(400, sentCount[0], 20);
+    EXPECT_NEAR(300, sentCount[1], 20);
+    EXPECT_NEAR(200, sentCount[2], 20);
+    EXPECT_NEAR(100, sentCount[3], 20);
+}
+
+TEST(TelemetrySchedulerTest, ChargesHoldTheScheduleBack)
+{
+    telemetrySchedulerInit(&scheduler, 10);
+    telemetrySchedulerAdd(&scheduler, 10000, 1, 1);
+
+    timeUs_t timeUs = runSchedule(1000000, 1000000, 1);
+    EXPECT_NEAR(10, sentCount[0], 1);
+
+    // replies outside the schedule use the link as well
+    for (; timeUs < 3000000; timeUs += 100000) {
+        telemetrySchedulerCharge(&scheduler, 1);
+        EXPECT_EQ(TELEMETRY_SCHEDULER_NONE, telemetrySchedulerNext(&scheduler, timeUs, 1));
+    }
+}
+
+TEST(TelemetrySchedulerTest, TxSpaceIsRespected)
+{
+    telemetrySchedulerInit(&scheduler, 0);
+    telemetrySchedulerAdd(&scheduler, 10000, 2, 30);
+    telemetrySchedulerAdd(&scheduler, 10000, 1, 10);
+
+    // the larger, more important item waits for space rather than being overtaken
+    runSchedule(1000000, 1000000, 20);
+    EXPECT_EQ(0, sentCount[0]);
+    EXPECT_EQ(0, sentCount[1]);
+
+    runSchedule(2000000, 1000000, 30);
+    EXPECT_NEAR(100, sentCount[0], 5);
+    EXPECT_NEAR(100, sentCount[1], 5);
+}
+
+TEST(TelemetrySchedulerTest, TimerWrap)
+{
+    telemetrySchedulerInit(&scheduler, 1000);
+    telemetrySchedulerAdd(&scheduler, 100000, 1, 10);
+
+    runSchedule(0xFFFFFFFF - 500000, 1000000, 100);
+    EXPECT_NEAR(10, sentCount[0], 1);
+
+    // an item that hasn't been looked at for longer than half the timer range is still due
+    runSchedule(0x7FFFFFFF, 1000000, 100);
+    EXPECT_NEAR(10, sentCount[0], 1);
+}
+
+TEST(TelemetrySchedulerTest, IntervalCanBeChanged)
+{
+    telemetrySchedulerInit(&scheduler, 0);
+    telemetrySchedulerAdd(&scheduler, 100000, 1, 1);
+
+    timeUs_t timeUs = runSchedule(1000000, 1000000, 100);
+    EXPECT_NEAR(10, sentCount[0], 1);
+
+    telemetrySchedulerSetInterval(&scheduler, 0, 20000);
+    timeUs = runSchedule(timeUs, 1000000, 100);
+    EXPECT_NEAR(50, sentCount[0], 3);
+
+    // a shorter interval also takes a larger share of a link that can't keep up
+    telemetrySchedulerAdd(&scheduler, 20000, 1, 1);
+    telemetrySchedulerSetBudget(&scheduler, 30);
+    timeUs = runSchedule(timeUs, 1000000, 100);
+    EXPECT_NEAR(sentCount[0], sentCount[1], 2);
+    telemetrySchedulerSetInterval(&scheduler, 1, 60000);
+    runSchedule(timeUs, 1000000, 100);
+    EXPECT_NEAR(sentCount[0], 3 * sentCount[1], 4);
+}
+
+TEST(TelemetrySchedulerTest, CouldBeDue)
+{
+    telemetrySchedulerInit(&scheduler, 0);
+    telemetrySchedulerAdd(&scheduler, 100000, 1, 1);
+    ASSERT_EQ(0, telemetrySchedulerNext(&scheduler, 1000000, 1));
+    telemetrySchedulerSent(&scheduler, 0, 1, 1000000);
+
+    EXPECT_FALSE(telemetrySchedulerCouldBeDue(&scheduler, 0, 1050000, 100000));
+    EXPECT_TRUE(telemetrySchedulerCouldBeDue(&scheduler, 0, 1050000, 50000));
+    EXPECT_TRUE(telemetrySchedulerCouldBeDue(&scheduler, 0, 1100000, 100000));
+    // a wrapped age is due
+    EXPECT_TRUE(telemetrySchedulerCouldBeDue(&scheduler, 0, 1000000 + 0x80000000, 100000));
+    EXPECT_FALSE(telemetrySchedulerCouldBeDue(&scheduler, 1, 1100000, 100000));
+}
+
+TEST(TelemetrySchedulerTest, ItemLimit)
+{
+    telemetrySchedulerInit(&scheduler, 0);
+    for (int i = 0; i < TELEMETRY_SCHEDULER_MAX_ITEMS; i++) {
+        EXPECT_EQ(i, telemetrySchedulerAdd(&scheduler, 100000, 1, 1));
+    }
+    EXPECT_EQ(TELEMETRY_SCHEDULER_NONE, telemetrySchedulerAdd(&scheduler, 100000, 1, 1));
+}
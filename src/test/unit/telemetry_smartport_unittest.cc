@@ -0,0 +1,272 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "config/feature.h"
+
+    #include "fc/controlrate_profile.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/imu.h"
+    #include "flight/pid.h"
+
+    #include "io/gps.h"
+    #include "io/serial.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "sensors/acceleration.h"
+    #include "sensors/battery.h"
+    #include "sensors/sensors.h"
+
+    #include "telemetry/smartport.h"
+    #include "telemetry/telemetry.h"
+
+    PG_REGISTER(telemetryConfig_t, telemetryConfig, PG_TELEMETRY_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define FSSP_DATAID_VFAS        0x0210
+#define FSSP_DATAID_VARIO       0x0110
+#define FSSP_DATAID_ALTITUDE    0x0100
+#define FSSP_DATAID_LATLONG     0x0800
+#define FSSP_DATAID_T2          0x0410
+
+#define SENSOR_IDS 0x1000
+#define SENSOR_COUNT 17
+
+static timeUs_t currentTimeUs;
+
+static int framesSent[SENSOR_IDS];
+static int longitudesSent;
+static int totalFrames;
+static timeUs_t lastVfasSentUs;
+static uint32_t lastVfasValue;
+
+static int32_t vario;
+static int varioReads;
+static int32_t altitude;
+static uint16_t batteryVoltage;
+
+static void captureFrame(const smartPortPayload_t *payload)
+{
+    framesSent[payload->valueId]++;
+    totalFrames++;
+    if (payload->valueId == FSSP_DATAID_LATLONG && (payload->data & 0x80000000)) {
+        longitudesSent++;
+    }
+    if (payload->valueId == FSSP_DATAID_VFAS) {
+        lastVfasSentUs = currentTimeUs;
+        lastVfasValue = payload->data;
+    }
+}
+
+static void resetCounters(void)
+{
+    memset(framesSent, 0, sizeof(framesSent));
+    longitudesSent = 0;
+    totalFrames = 0;
+}
+
+static int sensorsSent(void)
+{
+    int count = 0;
+    for (int i = 0; i < SENSOR_IDS; i++) {
+        count += framesSent[i] ? 1 : 0;
+    }
+    // latitude and longitude share an id
+    return count + (longitudesSent ? 1 : 0);
+}
+
+// Polls our sensor id every slotUs for durationUs, while the vario and altitude change and everything else holds still
+static int runSlots(timeDelta_t slotUs, timeDelta_t durationUs)
+{
+    const int framesBefore = totalFrames;
+    int slots = 0;
+    int emptySlots = 0;
+    for (timeDelta_t t = 0; t < durationUs; t += slotUs) {
+        currentTimeUs += slotUs;
+        vario = lrintf(200 * sinf(currentTimeUs * 1e-6f));
+        altitude = 1000 + vario * 2;
+
+        bool clearToSend = true;
+        processSmartPortTelemetry(NULL, &clearToSend, NULL);
+        if (clearToSend) {
+            emptySlots++;
+        }
+        slots++;
+    }
+    EXPECT_EQ(slots, totalFrames - framesBefore + emptySlots);
+
+    return slots;
+}
+
+class SmartPortTelemetryTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        static bool initialised = false;
+        if (!initialised) {
+            currentTimeUs = 1000000;
+            sensorsSet(SENSOR_ACC | SENSOR_BARO | SENSOR_GPS);
+            ENABLE_STATE(GPS_FIX);
+            gpsSol.numSat = 12;
+            gpsSol.llh.lat = 473977420;
+            gpsSol.llh.lon = 85455940;
+            gpsSol.llh.altCm = 50000;
+            gpsSol.groundSpeed = 0;
+            batteryVoltage = 1680;
+            initialised = initSmartPortTelemetryExternal(captureFrame);
+        }
+        ASSERT_TRUE(initialised);
+
+        // settle into the steady state
+        runSlots(12000, 5000000);
+        resetCounters();
+    }
+};
+
+TEST_F(SmartPortTelemetryTest, StaticSensorsAreSentAtTheirMaxInterval)
+{
+    const timeDelta_t durationUs = 30000000;
+    runSlots(12000, durationUs);
+
+    // VFAS doesn't change and has a 1 s max interval, GPS sats in T2 have a 2 s one
+    EXPECT_NEAR(durationUs / 1000000, framesSent[FSSP_DATAID_VFAS], 2);
+    EXPECT_NEAR(durationUs / 2000000, framesSent[FSSP_DATAID_T2], 2);
+
+    // the changing vario is sent at its 100 ms min interval, rounded up to the next slot
+    EXPECT_LE(framesSent[FSSP_DATAID_VARIO], durationUs / 100000);
+    EXPECT_GE(framesSent[FSSP_DATAID_VARIO], durationUs / (100000 + 12000) * 9 / 10);
+}
+
+TEST_F(SmartPortTelemetryTest, ChangedValueIsSentPromptly)
+{
+    runSlots(12000, 2000000);
+
+    batteryVoltage = 1590;
+    const timeUs_t changedUs = currentTimeUs;
+    runSlots(12000, 1000000);
+    batteryVoltage = 1680;
+
+    // VFAS has a 200 ms min interval, rather than waiting out the 1 s max interval
+    EXPECT_EQ(1590u, lastVfasValue);
+    EXPECT_LE(cmpTimeUs(lastVfasSentUs, changedUs), 200000 + 12000);
+}
+
+TEST_F(SmartPortTelemetryTest, FreeBusSendsEverySensor)
+{
+    const timeDelta_t durationUs = 10000000;
+    const int slots = runSlots(12000, durationUs);
+
+    EXPECT_EQ(SENSOR_COUNT, sensorsSent());
+    // nothing is sent more often than needed, leaving slots free
+    EXPECT_LT(totalFrames, slots / 2);
+    // both halves of the position
+    EXPECT_NEAR(framesSent[FSSP_DATAID_LATLONG], 2 * longitudesSent, 2);
+}
+
+TEST_F(SmartPortTelemetryTest, BusyBusFavoursChangingSensors)
+{
+    // a slot every 100 ms, fewer than the sensors want
+    const timeDelta_t durationUs = 60000000;
+    const int slots = runSlots(100000, durationUs);
+
+    const int roundRobin = slots / SENSOR_COUNT;
+
+    // every slot is used
+    EXPECT_EQ(slots, totalFrames);
+    EXPECT_GT(framesSent[FSSP_DATAID_VARIO], 3 * roundRobin);
+    EXPECT_GT(framesSent[FSSP_DATAID_ALTITUDE], 2 * roundRobin);
+    EXPECT_GT(framesSent[FSSP_DATAID_VARIO], framesSent[FSSP_DATAID_ALTITUDE]);
+
+    // static values are resent less often, but nothing is starved
+    EXPECT_LT(framesSent[FSSP_DATAID_VFAS], roundRobin);
+    EXPECT_EQ(SENSOR_COUNT, sensorsSent());
+}
+
+TEST_F(SmartPortTelemetryTest, OnlySensorsThatCanBeSentAreRead)
+{
+    varioReads = 0;
+    const int slots = runSlots(12000, 10000000);
+
+    // the vario is read when it is due, rather than on every poll
+    EXPECT_GT(framesSent[FSSP_DATAID_VARIO], 0);
+    EXPECT_LE(varioReads, 2 * framesSent[FSSP_DATAID_VARIO]);
+    EXPECT_LT(varioReads, slots / 4);
+}
+
+// STUBS
+
+extern "C" {
+
+attitudeEulerAngles_t attitude = { { 0, 0, 0 } };
+
+uint16_t GPS_distanceToHome;
+gpsSolutionData_t gpsSol;
+acc_t acc;
+
+pidProfile_t *currentPidProfile;
+controlRateConfig_t *currentControlRateProfile;
+
+uint32_t micros(void) { return currentTimeUs; }
+
+bool featureIsEnabled(uint32_t) { return true; }
+void beeperConfirmationBeeps(uint8_t) {}
+
+bool telemetryDetermineEnabledState(portSharing_e) { return true; }
+bool telemetryIsSensorEnabled(sensor_e) { return true; }
+
+bool isBatteryVoltageConfigured(void) { return true; }
+bool isAmperageConfigured(void) { return true; }
+uint16_t getBatteryVoltage(void) { return batteryVoltage; }
+uint8_t getBatteryCellCount(void) { return 4; }
+int32_t getAmperage(void) { return 1200; }
+int32_t getMAhDrawn(void) { return 350; }
+
+int32_t getEstimatedAltitudeCm(void) { return altitude; }
+int16_t getEstimatedVario(void)
+{
+    varioReads++;
+    return vario;
+}
+
+uint32_t serialRxBytesWaiting(const serialPort_t *) { return 0; }
+uint8_t serialRead(serialPort_t *) { return 0; }
+void serialWrite(serialPort_t *, uint8_t) {}
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) { return NULL; }
+void closeSerialPort(serialPort_t *) {}
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) { return NULL; }
+portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e) { return PORTSHARING_NOT_SHARED; }
+
+}
@@ -0,0 +1,159 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/timings.h"
+
+    unsigned timingsBucket(uint32_t cycles);
+    uint32_t timingsBucketLimit(unsigned bucket);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static uint32_t cycleCounter;
+
+class TimingsTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        timingsReset();
+    }
+};
+
+TEST_F(TimingsTest, BucketsCoverEveryValue)
+{
+    EXPECT_EQ(0u, timingsBucket(0));
+    EXPECT_EQ(0u, timingsBucket(79));
+    EXPECT_EQ(1u, timingsBucket(80));
+    EXPECT_EQ(3u, timingsBucket(127));
+    EXPECT_EQ(4u, timingsBucket(128));
+
+    // every value is at most its bucket's limit, and within a quarter of it
+    unsigned lastBucket = 0;
+    for (uint32_t cycles = 64; cycles < 262144; cycles++) {
+        const unsigned bucket = timingsBucket(cycles);
+        const uint32_t limit = timingsBucketLimit(bucket);
+        ASSERT_LE(cycles, limit);
+        ASSERT_GE(cycles + cycles / 4, limit);
+        ASSERT_GE(bucket, lastBucket);
+        lastBucket = bucket;
+    }
+    EXPECT_EQ(lastBucket, timingsBucket(UINT32_MAX));
+}
+
+TEST_F(TimingsTest, EmptyProbeIsZero)
+{
+    timingsSummary_t summary;
+    memset(&summary, 0xff, sizeof(summary));
+    timingsGetSummary(TIMINGS_PID, &summary);
+
+    EXPECT_EQ(0u, summary.count);
+    EXPECT_EQ(0u, summary.minCycles);
+    EXPECT_EQ(0u, summary.maxCycles);
+    EXPECT_EQ(0u, summary.p99Cycles);
+}
+
+TEST_F(TimingsTest, Summary)
+{
+    for (uint32_t cycles = 1000; cycles < 2000; cycles++) {
+        timingsRecord(TIMINGS_MIXER, cycles);
+    }
+    timingsRecord(TIMINGS_PID, 5000);
+
+    timingsSummary_t summary;
+    timingsGetSummary(TIMINGS_MIXER, &summary);
+
+    EXPECT_EQ(1000u, summary.count);
+    EXPECT_EQ(1000u, summary.minCycles);
+    EXPECT_EQ(1499u, summary.avgCycles);
+    EXPECT_EQ(1999u, summary.maxCycles);
+
+    // percentiles are rounded up to their bucket's limit
+    EXPECT_GE(summary.p50Cycles, 1499u);
+    EXPECT_LE(summary.p50Cycles, 1499u * 5 / 4);
+    EXPECT_GE(summary.p90Cycles, 1899u);
+    EXPECT_LE(summary.p90Cycles, 1999u);
+    EXPECT_GE(summary.p99Cycles, summary.p90Cycles);
+    EXPECT_LE(summary.p99Cycles, 1999u);
+
+    // the other probes are kept apart
+    timingsGetSummary(TIMINGS_PID, &summary);
+    EXPECT_EQ(1u, summary.count);
+    EXPECT_EQ(5000u, summary.minCycles);
+    EXPECT_EQ(5000u, summary.p50Cycles);
+}
+
+TEST_F(TimingsTest, RareSpikesShowInTheTail)
+{
+    for (int i = 0; i < 1000; i++) {
+        timingsRecord(TIMINGS_GYRO_READ, i % 50 == 0 ? 50000 : 2000);
+    }
+
+    timingsSummary_t summary;
+    timingsGetSummary(TIMINGS_GYRO_READ, &summary);
+
+    EXPECT_EQ(2000u, summary.minCycles);
+    EXPECT_EQ(2960u, summary.avgCycles);
+    EXPECT_LE(summary.p50Cycles, 2500u);
+    EXPECT_LE(summary.p90Cycles, 2500u);
+    EXPECT_EQ(50000u, summary.p99Cycles);
+    EXPECT_EQ(50000u, summary.maxCycles);
+}
+
+TEST_F(TimingsTest, Reset)
+{
+    timingsRecord(TIMINGS_GYRO_FILTER, 100);
+    timingsReset();
+    timingsRecord(TIMINGS_GYRO_FILTER, 300);
+
+    timingsSummary_t summary;
+    timingsGetSummary(TIMINGS_GYRO_FILTER, &summary);
+    EXPECT_EQ(1u, summary.count);
+    EXPECT_EQ(300u, summary.minCycles);
+    EXPECT_EQ(300u, summary.maxCycles);
+}
+
+TEST_F(TimingsTest, ProbesTimeTheCycleCounter)
+{
+    // across the counter wrapping
+    cycleCounter = UINT32_MAX - 99;
+    TIMINGS_START(TIMINGS_PID_LOOP);
+    cycleCounter += 250;
+    TIMINGS_STOP(TIMINGS_PID_LOOP);
+
+    timingsSummary_t summary;
+    timingsGetSummary(TIMINGS_PID_LOOP, &summary);
+    EXPECT_EQ(1u, summary.count);
+    EXPECT_EQ(250u, summary.maxCycles);
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t getCycleCounter(void) { return cycleCounter; }
+
+}
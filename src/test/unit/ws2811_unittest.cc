@@ -18,6 +18,9 @@
 #include <stdlib.h>
 
 #include <limits.h>
+#include <string.h>
+#include <chrono>
+#include <random>
 
 extern "C" {
     #include "build/build_config.h"
@@ -32,10 +35,178 @@ extern "C" {
 
 extern "C" {
     void updateLEDDMABuffer(ledStripFormatRGB_e ledFormat, rgbColor24bpp_t *color, unsigned ledIndex);
+    void ws2811BuildCompareTable(void);
+}
+
+// Compare values for a 48MHz timer clock
+#define TEST_BIT_COMPARE_1 40
+#define TEST_BIT_COMPARE_0 20
+
+static void initCompareValues(void)
+{
+    BIT_COMPARE_1 = TEST_BIT_COMPARE_1;
+    BIT_COMPARE_0 = TEST_BIT_COMPARE_0;
+    ws2811BuildCompareTable();
+}
+
+// Reference encoder, one bit at a time
+static void encodeLed(ws2811Compare_t *buffer, ledStripFormatRGB_e ledFormat, const rgbColor24bpp_t *color)
+{
+    const uint32_t packedColour = ledFormat == LED_RGB
+        ? (color->rgb.r << 16) | (color->rgb.g << 8) | color->rgb.b
+        : (color->rgb.g << 16) | (color->rgb.r << 8) | color->rgb.b;
+
+    for (int bit = 23; bit >= 0; bit--) {
+        *buffer++ = (packedColour & (1 << bit)) ? BIT_COMPARE_1 : BIT_COMPARE_0;
+    }
+}
+
+static rgbColor24bpp_t testRgb(const hsvColor_t *hsv)
+{
+    // the hsvToRgb24() stub
+    rgbColor24bpp_t rgb;
+    rgb.rgb.r = hsv->h;
+    rgb.rgb.g = hsv->s;
+    rgb.rgb.b = hsv->v;
+    return rgb;
+}
+
+static void checkStrip(ledStripFormatRGB_e ledFormat, const hsvColor_t *colors)
+{
+    for (int led = 0; led < WS2811_DATA_BUFFER_SIZE; led++) {
+        ws2811Compare_t expected[WS2811_BITS_PER_LED];
+        const rgbColor24bpp_t rgb = testRgb(&colors[led]);
+        encodeLed(expected, ledFormat, &rgb);
+
+        ASSERT_EQ(0, memcmp(expected, &ledStripDMABuffer[led * WS2811_BITS_PER_LED], sizeof(expected))) << "led " << led;
+    }
+}
+
+static void randomColors(hsvColor_t *colors, std::mt19937 &rng)
+{
+    for (int led = 0; led < WS2811_DATA_BUFFER_SIZE; led++) {
+        colors[led].h = rng() % 360;
+        colors[led].s = rng();
+        colors[led].v = rng();
+    }
+}
+
+// Update the strip as the LED strip task does, with the previous transfer finished
+static void updateStrip(ledStripFormatRGB_e ledFormat)
+{
+    ws2811LedDataTransferInProgress = false;
+    ws2811UpdateStrip(ledFormat);
+}
+
+class WS2811StripTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        ws2811LedStripInit(IO_TAG_NONE);
+        ws2811LedStripEnable();
+        initCompareValues();
+    }
+};
+
+TEST_F(WS2811StripTest, StripMatchesBitwiseEncoding)
+{
+    std::mt19937 rng(1);
+    hsvColor_t colors[WS2811_DATA_BUFFER_SIZE];
+
+    for (int i = 0; i < 10; i++) {
+        randomColors(colors, rng);
+        setStripColors(colors);
+
+        updateStrip(LED_GRB);
+        checkStrip(LED_GRB, colors);
+
+        updateStrip(LED_RGB);
+        checkStrip(LED_RGB, colors);
+    }
+
+    // the delay after the LED data stays low
+    for (int i = WS2811_DATA_BUFFER_SIZE * WS2811_BITS_PER_LED; i < WS2811_DMA_BUFFER_SIZE; i++) {
+        EXPECT_EQ(0u, ledStripDMABuffer[i]);
+    }
+}
+
+TEST_F(WS2811StripTest, OnlyChangedLedsAreEncoded)
+{
+    std::mt19937 rng(2);
+    hsvColor_t colors[WS2811_DATA_BUFFER_SIZE];
+
+    randomColors(colors, rng);
+    setStripColors(colors);
+    updateStrip(LED_GRB);
+
+    // mark the encoded data of two LEDs, then change the colour of one of them
+    memset(&ledStripDMABuffer[3 * WS2811_BITS_PER_LED], 0, WS2811_BITS_PER_LED * sizeof(ws2811Compare_t));
+    memset(&ledStripDMABuffer[7 * WS2811_BITS_PER_LED], 0, WS2811_BITS_PER_LED * sizeof(ws2811Compare_t));
+    colors[7].v ^= 0x80;
+    setLedHsv(7, &colors[7]);
+    updateStrip(LED_GRB);
+
+    EXPECT_EQ(0u, ledStripDMABuffer[3 * WS2811_BITS_PER_LED]);
+    EXPECT_NE(0u, ledStripDMABuffer[7 * WS2811_BITS_PER_LED]);
+
+    // changing the colour order encodes everything again
+    updateStrip(LED_RGB);
+    checkStrip(LED_RGB, colors);
+
+    // as do new compare values
+    memset(&ledStripDMABuffer[3 * WS2811_BITS_PER_LED], 0, WS2811_BITS_PER_LED * sizeof(ws2811Compare_t));
+    initCompareValues();
+    updateStrip(LED_RGB);
+    checkStrip(LED_RGB, colors);
+}
+
+TEST_F(WS2811StripTest, EncodeTime)
+{
+    std::mt19937 rng(3);
+    hsvColor_t colors[WS2811_DATA_BUFFER_SIZE];
+    randomColors(colors, rng);
+
+    rgbColor24bpp_t rgb[WS2811_DATA_BUFFER_SIZE];
+    for (int led = 0; led < WS2811_DATA_BUFFER_SIZE; led++) {
+        rgb[led] = testRgb(&colors[led]);
+    }
+
+    const int iterations = 20000;
+    static ws2811Compare_t referenceBuffer[WS2811_DMA_BUFFER_SIZE];
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (int led = 0; led < WS2811_DATA_BUFFER_SIZE; led++) {
+            encodeLed(&referenceBuffer[led * WS2811_BITS_PER_LED], LED_GRB, &rgb[led]);
+        }
+    }
+    const std::chrono::duration<double, std::micro> bitwise = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (int led = 0; led < WS2811_DATA_BUFFER_SIZE; led++) {
+            updateLEDDMABuffer(LED_GRB, &rgb[led], led);
+        }
+    }
+    const std::chrono::duration<double, std::micro> table = std::chrono::steady_clock::now() - start;
+
+    // a strip where nothing changed, as is usual between LED strip profile updates
+    setStripColors(colors);
+    updateStrip(LED_GRB);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        updateStrip(LED_GRB);
+    }
+    const std::chrono::duration<double, std::micro> unchanged = std::chrono::steady_clock::now() - start;
+
+    printf("%d LED strip encode on host: bitwise %.3fus, table %.3fus, unchanged strip %.3fus\n", WS2811_DATA_BUFFER_SIZE,
+        bitwise.count() / iterations, table.count() / iterations, unchanged.count() / iterations);
+
+    EXPECT_EQ(0, memcmp(referenceBuffer, ledStripDMABuffer, WS2811_DATA_BUFFER_SIZE * WS2811_BITS_PER_LED * sizeof(ws2811Compare_t)));
 }
 
 TEST(WS2812, updateDMABuffer) {
     // given
+    initCompareValues();
     rgbColor24bpp_t color1 = { .raw = {0xFF,0xAA,0x55} };
 
     // when
@@ -77,8 +248,9 @@ TEST(WS2812, updateDMABuffer) {
 
 extern "C" {
 rgbColor24bpp_t* hsvToRgb24(const hsvColor_t *c) {
-    UNUSED(c);
-    return NULL;
+    static rgbColor24bpp_t rgb;
+    rgb = testRgb(c);
+    return &rgb;
 }
 
 bool ws2811LedStripHardwareInit(ioTag_t ioTag) {